@@ -61,6 +61,17 @@
 #define PICO_FLASH_SIZE_BYTES (16 * 1024 * 1024)
 #endif
 
+// --- CAMERA DATABASE ---
+// Two database slots (A/B) at the end of the flash, read in place through XIP.
+// The firmware image must stay below CAMS_DB_FLASH_OFFSET.
+#define CAMS_DB_FLASH_OFFSET (8 * 1024 * 1024)
+#define CAMS_DB_SLOT_SIZE    (4 * 1024 * 1024)
+#define CAMS_DB_SLOT_COUNT   2
+
+#if (CAMS_DB_FLASH_OFFSET + CAMS_DB_SLOT_SIZE * CAMS_DB_SLOT_COUNT) > PICO_FLASH_SIZE_BYTES
+    #error "Camera database slots don't fit in the flash"
+#endif
+
 #ifndef PICO_RP2040_B0_SUPPORTED
 #define PICO_RP2040_B0_SUPPORTED 1
 #endif
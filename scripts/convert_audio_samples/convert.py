@@ -1,5 +1,121 @@
 import os
+import struct
 import subprocess
+from datetime import datetime
+
+# Must match src/audio/audio_adpcm.h
+ADPCM_BLOCK_SAMPLES = 1024
+
+ADPCM_STEPS = [
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66,
+    73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408,
+    449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
+    9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+]
+ADPCM_INDEX_CHANGES = [-1, -1, -1, -1, 2, 4, 6, 8]
+
+INT16_MIN = -32768
+INT16_MAX = 32767
+
+# Prompts are played back to back, silence at their ends would only be a gap between the words
+SILENCE_THRESHOLD = 0.01
+SILENCE_KEPT_SAMPLES = 44100 * 30 // 1000
+
+def read_samples(input_file):
+    output_file_raw = input_file + ".raw"
+    subprocess.run([
+        "ffmpeg",
+        "-i", input_file,
+        "-f", "s16le",
+        "-acodec", "pcm_s16le",
+        "-ar", "44100",
+        "-ac", "1",
+        "-y", output_file_raw
+    ], check=True)
+
+    with open(output_file_raw, "rb") as f:
+        data = f.read()
+    os.remove(output_file_raw)
+
+    # Convert raw data to 16-bit signed integers
+    return list(struct.unpack('<' + 'h' * (len(data) // 2), data))
+
+def normalize_samples(samples):
+    # Normalize samples to 16-bit signed integers
+    max_sample = max(samples, key=abs)
+    samples = [sample / max_sample for sample in samples]
+    samples = [int((s * (INT16_MAX - INT16_MIN) / 2) + (INT16_MIN + INT16_MAX) / 2) for s in samples]
+    assert all(INT16_MIN <= sample <= INT16_MAX for sample in samples)
+    return samples
+
+def trim_silence(samples):
+    threshold = SILENCE_THRESHOLD * INT16_MAX
+    loud = [i for i, sample in enumerate(samples) if abs(sample) > threshold]
+    first = max(loud[0] - SILENCE_KEPT_SAMPLES, 0)
+    last = min(loud[-1] + SILENCE_KEPT_SAMPLES, len(samples) - 1)
+    return samples[first:last + 1]
+
+def adpcm_decode_code(code, predicted, index):
+    # Must stay bit exact with audio_adpcm_decode_block()
+    step = ADPCM_STEPS[index]
+    difference = step >> 3
+    if code & 4:
+        difference += step
+    if code & 2:
+        difference += step >> 1
+    if code & 1:
+        difference += step >> 2
+    predicted += -difference if code & 8 else difference
+    predicted = min(max(predicted, INT16_MIN), INT16_MAX)
+    index = min(max(index + ADPCM_INDEX_CHANGES[code & 7], 0), len(ADPCM_STEPS) - 1)
+    return predicted, index
+
+def adpcm_encode(samples):
+    """Returns the IMA ADPCM blocks of the samples and the samples the firmware will decode from them"""
+    encoded = bytearray()
+    decoded = []
+    index = 0
+    for first in range(0, len(samples), ADPCM_BLOCK_SAMPLES):
+        block = samples[first:first + ADPCM_BLOCK_SAMPLES]
+
+        # Every block restarts from the exact previous sample, the step index carries over
+        predicted = samples[first - 1] if first > 0 else 0
+        encoded += struct.pack('<hBB', predicted, index, 0)
+
+        codes = []
+        for sample in block:
+            # Pick the code whose decoded sample is closest, the decoder only sees the codes
+            best = None
+            for code in range(16):
+                candidate, _ = adpcm_decode_code(code, predicted, index)
+                if best is None or abs(sample - candidate) < abs(sample - best[1]):
+                    best = (code, candidate)
+            predicted, index = adpcm_decode_code(best[0], predicted, index)
+            codes.append(best[0])
+            decoded.append(predicted)
+
+        if len(codes) % 2:
+            codes.append(0)
+        encoded += bytes(codes[i] | (codes[i + 1] << 4) for i in range(0, len(codes), 2))
+
+    return encoded, decoded
+
+def write_sample_header(output_file, encoded, samples_length):
+    var_name = os.path.splitext(os.path.basename(output_file))[0]
+    with open(output_file, "w") as f:
+        current_date = datetime.now().strftime("%d-%m-%Y %H:%M:%S")
+        f.write(f'// This file was generated by a script on {current_date}\n\n')
+        f.write("#pragma once\n\n")
+        f.write("#include <stddef.h>\n")
+        f.write("#include <stdint.h>\n")
+        f.write("#include <pico/platform/sections.h>\n\n")
+
+        data_list_str = ", ".join([f"{byte}" for byte in encoded])
+
+        f.write("// IMA ADPCM blocks, see audio_adpcm.h\n")
+        f.write(f'static const uint8_t __in_flash("{var_name}") {var_name}[] = {{ {data_list_str} }};\n\n')
+        f.write(f"static const size_t {var_name}_length = {samples_length};\n")
 
 def convert_audio_samples_to_c(input_dir, output_dir):
     if not os.path.exists(output_dir):
@@ -8,51 +124,12 @@ def convert_audio_samples_to_c(input_dir, output_dir):
     for root, dirs, files in os.walk(input_dir):
         for file in files:
             input_file = os.path.join(root, file)
-            output_file_raw = os.path.join(output_dir, "data.raw")
-            subprocess.run([
-                "ffmpeg",
-                "-i", input_file,
-                "-f", "s16le",
-                "-acodec", "pcm_s16le",
-                "-ar", "44100",
-                "-ac", "1",
-                "-y", output_file_raw
-            ])
-
-            with open(output_file_raw, "rb") as f:
-                data = f.read()
-            os.remove(output_file_raw)
+            samples = trim_silence(normalize_samples(read_samples(input_file)))
+            encoded, _ = adpcm_encode(samples)
 
             input_file_name = os.path.splitext(os.path.basename(input_file))[0]
             output_file = os.path.join(output_dir, f"audio_{input_file_name}_sample_data.h")
-            with open(output_file, "w") as f:
-                from datetime import datetime
-                current_date = datetime.now().strftime("%d-%m-%Y %H:%M:%S")
-                f.write(f'// This file was generated by a script on {current_date}\n\n')
-                f.write("#pragma once\n\n")
-                f.write("#include <stddef.h>\n")
-                f.write("#include <stdint.h>\n")
-                f.write("#include <pico/platform/sections.h>\n\n")
-
-                # Convert raw data to 16-bit signed integers
-                import struct
-                samples = struct.unpack('<' + 'h' * (len(data) // 2), data)
-
-                # Normalize samples to 16-bit signed integers
-                max_sample = max(samples, key=abs)
-                samples = [sample / max_sample for sample in samples]
-                int16_min = -32768
-                int16_max = 32767
-                samples = [int((s * (int16_max - int16_min) / 2) + (int16_min + int16_max) / 2) for s in samples]
-                assert all(int16_min <= sample <= int16_max for sample in samples)
-
-                # Convert samples to hex strings
-                data_list_str = ", ".join([f"{sample}" for sample in samples])
-
-                output_file_name = os.path.splitext(os.path.basename(output_file))[0]
-                var_name = output_file_name
-                f.write(f'static const int16_t __in_flash("{var_name}") {var_name}[] = {{ {data_list_str} }};\n\n')
-                f.write(f"static const size_t {var_name}_length = sizeof({var_name}) / sizeof({var_name}[0]);\n")
+            write_sample_header(output_file, encoded, len(samples))
 
 def main():
     script_dir = os.path.dirname(__file__)
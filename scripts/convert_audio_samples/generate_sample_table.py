@@ -0,0 +1,85 @@
+import json
+import os
+import re
+import sys
+
+# Writes enum audio_samples and the prompt table of the audio task from the prompt list in
+# src/audio/samples/audio_samples.json. Run by the build, the prompt data itself comes from convert.py.
+
+CODECS = {
+    "ima_adpcm": "AUDIO_CODEC_IMA_ADPCM",
+}
+
+def read_sample_length(samples_dir, var_name):
+    with open(os.path.join(samples_dir, f"{var_name}.h")) as f:
+        match = re.search(rf"{var_name}_length = (\d+);", f.read())
+    if match is None:
+        sys.exit(f"{var_name}.h: no length found")
+    return int(match.group(1))
+
+def get_clips(manifest, samples_dir, prompt):
+    clips = []
+    for clip in prompt["clips"]:
+        if isinstance(clip, str):
+            var_name = f"audio_{clip}_sample_data"
+            clips.append((CODECS[manifest["codec"]], var_name, read_sample_length(samples_dir, var_name), 0))
+        elif "tone_hz" in clip:
+            clips.append(("AUDIO_CODEC_TONE", "NULL", clip["tone_ms"] * manifest["sample_rate"] // 1000, clip["tone_hz"]))
+        else:
+            clips.append(("AUDIO_CODEC_SILENCE", "NULL", clip["pause_ms"] * manifest["sample_rate"] // 1000, 0))
+    return clips
+
+def write_header_start(f, manifest_path):
+    f.write(f"// Generated from {os.path.basename(manifest_path)} by generate_sample_table.py, don't edit\n\n")
+    f.write("#pragma once\n\n")
+
+def write_enum(output_file, manifest_path, manifest, max_clips):
+    with open(output_file, "w") as f:
+        write_header_start(f, manifest_path)
+        f.write("enum audio_samples {\n")
+        for prompt in manifest["prompts"]:
+            f.write(f"    AUDIO_SAMPLES_{prompt['name'].upper()},\n")
+        f.write("    AUDIO_SAMPLES_LENGTH\n")
+        f.write("};\n\n")
+        f.write("// Most clips a single prompt is made of\n")
+        f.write(f"#define AUDIO_PROMPT_MAX_CLIPS {max_clips}\n")
+
+def write_table(output_file, manifest_path, manifest, prompts_clips):
+    with open(output_file, "w") as f:
+        write_header_start(f, manifest_path)
+        f.write('#include "audio/audio_prompt.h"\n')
+        f.write('#include "audio/audio_samples.h"\n\n')
+        var_names = sorted({var_name for clips in prompts_clips for _, var_name, _, _ in clips if var_name != "NULL"})
+        for var_name in var_names:
+            f.write(f'#include "audio/samples/{var_name}.h"\n')
+
+        f.write("\nstatic const struct audio_clip audio_clips[] = {\n")
+        for prompt, clips in zip(manifest["prompts"], prompts_clips):
+            f.write(f"    // {prompt['name']}\n")
+            for codec, var_name, length, frequency_hz in clips:
+                f.write(f"    {{ {codec}, {var_name}, {length}, {frequency_hz} }},\n")
+        f.write("};\n\n")
+
+        f.write("static const struct audio_prompt audio_prompts[AUDIO_SAMPLES_LENGTH] = {\n")
+        first = 0
+        for prompt, clips in zip(manifest["prompts"], prompts_clips):
+            length = sum(clip_length for _, _, clip_length, _ in clips)
+            f.write(f"    [AUDIO_SAMPLES_{prompt['name'].upper()}] = {{ &audio_clips[{first}], {len(clips)}, {manifest['sample_rate']}, {length} }},\n")
+            first += len(clips)
+        f.write("};\n")
+
+def main():
+    if len(sys.argv) != 3:
+        sys.exit(f"usage: {sys.argv[0]} audio_samples.json output_dir")
+    manifest_path, output_dir = sys.argv[1], sys.argv[2]
+    samples_dir = os.path.dirname(os.path.abspath(manifest_path))
+    with open(manifest_path) as f:
+        manifest = json.load(f)
+
+    prompts_clips = [get_clips(manifest, samples_dir, prompt) for prompt in manifest["prompts"]]
+    os.makedirs(os.path.join(output_dir, "audio"), exist_ok=True)
+    write_enum(os.path.join(output_dir, "audio", "audio_samples.h"), manifest_path, manifest, max(len(clips) for clips in prompts_clips))
+    write_table(os.path.join(output_dir, "audio", "audio_sample_table.h"), manifest_path, manifest, prompts_clips)
+
+if __name__ == "__main__":
+    main()
@@ -13,6 +13,27 @@ out geom;
     with urllib.request.urlopen(req) as response:
         return json.loads(response.read())['elements']
 
+CARDINAL_DIRECTIONS = {
+    'N': 0.0, 'NNE': 22.5, 'NE': 45.0, 'ENE': 67.5,
+    'E': 90.0, 'ESE': 112.5, 'SE': 135.0, 'SSE': 157.5,
+    'S': 180.0, 'SSW': 202.5, 'SW': 225.0, 'WSW': 247.5,
+    'W': 270.0, 'WNW': 292.5, 'NW': 315.0, 'NNW': 337.5,
+}
+
+# Parse the OSM 'direction' tag, the bearing of the traffic the camera monitors.
+# Returns None for cameras without a single known direction (missing tag, ranges,
+# multiple directions or forward/backward which is relative to a way we don't have).
+def parse_direction(direction):
+    if direction is None:
+        return None
+    direction = direction.strip().upper()
+    if direction in CARDINAL_DIRECTIONS:
+        return CARDINAL_DIRECTIONS[direction]
+    try:
+        return float(direction) % 360.0
+    except ValueError:
+        return None
+
 def get_cameras():
     overpass = get_speed_cameras_from_overpass_api()
     cameras = []
@@ -30,39 +51,158 @@ def get_cameras():
             print(f"Warning: {node} has invalid 'maxspeed' tag")
             limit = 0
 
-        cameras.append({'id': node['id'], 'lat': lat, 'lon': lon, 'limit': limit})
+        direction = parse_direction(node.get('tags', {}).get('direction'))
+
+        cameras.append({'id': node['id'], 'lat': lat, 'lon': lon, 'limit': limit, 'direction': direction})
     return cameras
 
-def generate_c_file(output_file, data_list):
-    from datetime import datetime
-    with open(output_file, 'w') as f:
-        current_date = datetime.now().strftime("%d-%m-%Y %H:%M:%S")
-        cams_list = ""
-        for c in data_list:
-            lat = c["lat"]
-            lon = c["lon"]
-            limit = c["limit"]
-            id = c["id"]
-            osv_url = f"https://www.openstreetmap.org/node/{id}"
-            gmaps_url = f"https://maps.google.com/maps?q=&layer=c&cbll={lat},{lon}"
-            line = f'    {{ {lat:.7f}f, {lon:.7f}f, {limit} }}, // {osv_url} // {gmaps_url}\n'
-            cams_list += line
-
-        f.write(f"""\
-// This file was generated by a script on {current_date}
-// Do not edit this file manually
-
-#pragma once
-
-#include <pico/platform/sections.h>
-#include "cams.h"
-
-static const struct cams_camera_info __in_flash("cams_list") cams_list[] = {{
-{cams_list}
-}};
-
-static const size_t cams_list_length = sizeof(cams_list) / sizeof(cams_list[0]);
-""")
+# Uniform lat/lon grid used by the firmware to only search cameras around the current position.
+# The camera cache is refilled from the cells overlapping its radius, a few cells of this size.
+GRID_CELLS_PER_DEG = 10
+GRID_COLUMNS = 360 * GRID_CELLS_PER_DEG
+GRID_ROWS = 180 * GRID_CELLS_PER_DEG
+GRID_CELL_SIZE_E6 = 1000000 // GRID_CELLS_PER_DEG
+
+# Camera directions are stored in 2 degree steps, DIRECTION_UNKNOWN for cameras valid in any direction
+DIRECTION_UNKNOWN = 255
+
+def encode_direction(direction):
+    if direction is None:
+        return DIRECTION_UNKNOWN
+    return int(round(direction / 2.0)) % 180
+
+# Coordinates are stored as integer microdegrees
+def to_e6(deg):
+    return int(round(deg * 1000000))
+
+def get_grid_cell_key(lat_e6, lon_e6):
+    row = min(max((lat_e6 + 90000000) // GRID_CELL_SIZE_E6, 0), GRID_ROWS - 1)
+    col = min(max((lon_e6 + 180000000) // GRID_CELL_SIZE_E6, 0), GRID_COLUMNS - 1)
+    return row * GRID_COLUMNS + col
+
+def build_grid(cameras):
+    cameras = sorted(cameras, key=lambda c: (get_grid_cell_key(c['lat_e6'], c['lon_e6']), c['lat_e6'], c['lon_e6']))
+    cell_keys = []
+    cell_offsets = []
+    for i, c in enumerate(cameras):
+        key = get_grid_cell_key(c['lat_e6'], c['lon_e6'])
+        if len(cell_keys) == 0 or cell_keys[-1] != key:
+            cell_keys.append(key)
+            cell_offsets.append(i)
+    # Sentinel so that the cameras of cell i are [cell_offsets[i], cell_offsets[i + 1])
+    cell_offsets.append(len(cameras))
+    return cameras, cell_keys, cell_offsets
+
+# Implicit k-d tree over the (grid sorted) camera list. The array holds camera indices, the node of the
+# index range [lo, hi) is at mid = (lo + hi) // 2 and its children are the ranges [lo, mid) and [mid + 1, hi).
+# Even depths split on latitude, odd depths on longitude.
+def build_kdtree(cameras):
+    tree = list(range(len(cameras)))
+
+    def build(lo, hi, depth):
+        if hi - lo <= 1:
+            return
+        axis = 'lat_e6' if depth % 2 == 0 else 'lon_e6'
+        tree[lo:hi] = sorted(tree[lo:hi], key=lambda i: cameras[i][axis])
+        mid = (lo + hi) // 2
+        build(lo, mid, depth + 1)
+        build(mid + 1, hi, depth + 1)
+
+    build(0, len(tree), 0)
+    return tree
+
+# Binary database layout, must match src/cams/cams_db.h
+DB_MAGIC = 0x42444343
+DB_VERSION = 1
+DB_HEADER_FORMAT = '<15I'
+
+# Flash slots, must match boards/include/boards/custom_catchcam.h
+DB_FLASH_OFFSET = 8 * 1024 * 1024
+DB_SLOT_SIZE = 4 * 1024 * 1024
+DB_SLOT_COUNT = 2
+XIP_BASE = 0x10000000
+
+def align4(data):
+    return data + bytes(-len(data) % 4)
+
+def pack_db(cameras, sequence):
+    import struct
+    import zlib
+    cameras = [dict(c, lat_e6=to_e6(c['lat']), lon_e6=to_e6(c['lon'])) for c in cameras]
+    cameras, cell_keys, cell_offsets = build_grid(cameras)
+    kdtree = build_kdtree(cameras)
+    n = len(cameras)
+
+    sections = [
+        align4(struct.pack(f'<{n}i', *[c['lat_e6'] for c in cameras])),
+        align4(struct.pack(f'<{n}i', *[c['lon_e6'] for c in cameras])),
+        align4(bytes(min(max(c['limit'], 0), 255) for c in cameras)),
+        align4(bytes(encode_direction(c.get('direction')) for c in cameras)),
+        align4(struct.pack(f'<{len(cell_keys)}I', *cell_keys)),
+        align4(struct.pack(f'<{len(cell_offsets)}I', *cell_offsets)),
+        align4(struct.pack(f'<{n}I', *kdtree)),
+    ]
+
+    offsets = []
+    offset = struct.calcsize(DB_HEADER_FORMAT)
+    for section in sections:
+        offsets.append(offset)
+        offset += len(section)
+    total_size = offset
+    if total_size > DB_SLOT_SIZE:
+        raise ValueError(f"Database of {total_size} bytes doesn't fit in a {DB_SLOT_SIZE} bytes slot")
+
+    def header(crc32):
+        return struct.pack(DB_HEADER_FORMAT, DB_MAGIC, crc32, DB_VERSION, total_size, sequence, n,
+                           GRID_CELLS_PER_DEG, len(cell_keys), *offsets)
+
+    image = header(0) + b''.join(sections)
+    # The CRC covers everything after the magic and the CRC itself
+    crc32 = zlib.crc32(image[8:]) & 0xFFFFFFFF
+    return header(crc32) + image[len(header(0)):]
+
+# UF2 image that the bootloader writes straight into the database slot
+def pack_uf2(image, slot):
+    import struct
+    UF2_MAGIC_START0 = 0x0A324655
+    UF2_MAGIC_START1 = 0x9E5D5157
+    UF2_MAGIC_END = 0x0AB16F30
+    UF2_FLAG_FAMILY_ID_PRESENT = 0x00002000
+    RP2040_FAMILY_ID = 0xE48BFF56
+    PAGE_SIZE = 256
+
+    address = XIP_BASE + DB_FLASH_OFFSET + slot * DB_SLOT_SIZE
+    pages = [image[i:i + PAGE_SIZE] for i in range(0, len(image), PAGE_SIZE)]
+    # Write the header page last so an interrupted copy never leaves a valid looking header behind
+    order = list(range(1, len(pages))) + [0]
+
+    blocks = []
+    for block_no, page_no in enumerate(order):
+        data = pages[page_no].ljust(476, b'\x00')
+        blocks.append(struct.pack('<8I', UF2_MAGIC_START0, UF2_MAGIC_START1, UF2_FLAG_FAMILY_ID_PRESENT,
+                                  address + page_no * PAGE_SIZE, PAGE_SIZE, block_no, len(pages), RP2040_FAMILY_ID)
+                      + data + struct.pack('<I', UF2_MAGIC_END))
+    return b''.join(blocks)
+
+def generate_db_files(output_file, cameras):
+    import os
+    import time
+    sequence = int(time.time())
+
+    image = pack_db(cameras, sequence)
+    with open(output_file, 'wb') as f:
+        f.write(image)
+
+    # One UF2 per slot, the slot to write is the one not holding the database in use so an interrupted
+    # update only ever destroys the older copy. The device logs which one that is at boot.
+    uf2_files = []
+    for slot in range(DB_SLOT_COUNT):
+        uf2_file = os.path.splitext(output_file)[0] + '_' + 'ab'[slot] + '.uf2'
+        with open(uf2_file, 'wb') as f:
+            f.write(pack_uf2(image, slot))
+        uf2_files.append(uf2_file)
+
+    print(f"Database: {len(image)} bytes, sequence {sequence}, UF2: {', '.join(uf2_files)}")
 
 import sys
 
@@ -72,15 +212,14 @@ def main(output_file):
     if len(cameras) == 0:
         print("No cameras found")
         sys.exit(1)
-    cameras_sorted = sorted(cameras, key=lambda x: (x['lat'], x['lon']))
-    print(f"Found {len(cameras_sorted)} cameras")
-    print(f"Generating C file: {output_file}")
-    generate_c_file(output_file, cameras_sorted)
+    print(f"Found {len(cameras)} cameras")
+    print(f"Generating database: {output_file}")
+    generate_db_files(output_file, cameras)
     print("Done")
 
 if __name__ == "__main__":
     if len(sys.argv) != 2:
-        print("Usage: python3 fetch.py <output_h_file>")
+        print("Usage: python3 fetch.py <output_bin_file>")
         sys.exit(1)
 
     output_file = sys.argv[1]
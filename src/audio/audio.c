@@ -1,29 +1,14 @@
 #include "audio.h"
 #include "i2s_lsbj.pio.h"
 
-#include "samples/audio_beep_sample_data.h"
-#include "samples/audio_startup_sample_data.h"
-#include "samples/audio_searching_for_a_gps_signal_sample_data.h"
-#include "samples/audio_warning_speed_camera_ahead_limit_sample_data.h"
-#include "samples/audio_unknown_sample_data.h"
-#include "samples/audio_five_sample_data.h"
-#include "samples/audio_ten_sample_data.h"
-#include "samples/audio_twenty_sample_data.h"
-#include "samples/audio_thirty_sample_data.h"
-#include "samples/audio_forty_sample_data.h"
-#include "samples/audio_fifty_sample_data.h"
-#include "samples/audio_sixty_sample_data.h"
-#include "samples/audio_seventy_sample_data.h"
-#include "samples/audio_eighty_sample_data.h"
-#include "samples/audio_ninety_sample_data.h"
-#include "samples/audio_one_hundred_sample_data.h"
-#include "samples/audio_gps_signal_sample_data.h"
-#include "samples/audio_acquired_sample_data.h"
-#include "samples/audio_lost_sample_data.h"
+// Prompt table generated from samples/audio_samples.json
+#include "audio/audio_sample_table.h"
 
 #include <stdbool.h>
 #include <assert.h>
+#include <inttypes.h>
 #include <stdio.h>
+#include <string.h>
 
 #include <hardware/gpio.h>
 #include <hardware/pio.h>
@@ -32,33 +17,152 @@
 #include <pico/stdlib.h>
 
 #include <FreeRTOS.h>
-#include <queue.h>
+#include <task.h>
 #include <semphr.h>
+#include <queue.h>
+
+#include "audio_adpcm.h"
+#include "audio_tone.h"
+#include "trace/trace.h"
 
 #define AUDIO_SAMPLE_RATE     44100
 #define AUDIO_BITS_PER_SAMPLE 16
+// Ping-pong, one playing while the other one is mixed
+#define AUDIO_BUFFERS_LENGTH  2
+// About 23 ms, a new request is heard two buffers later at most
+#define AUDIO_BUFFER_SAMPLES  1024
+
+// The amplifier needs this long after unmuting before it plays cleanly
+#define AUDIO_AMP_WARMUP_MS   250
+// Longest hold, a hold that looks longer is left over from before the tick count wrapped
+#define AUDIO_AMP_MAX_HOLD_MS 60000
+
+// How long a producer waits before retrying a push to a full sample ring
+#define AUDIO_RING_FULL_RETRY_TICKS 1
+
+// Most clips a playlist expands to, every beep is a tone and a pause
+#define AUDIO_PLAYLIST_MAX_CLIPS (AUDIO_PLAYLIST_MAX_SEGMENTS * AUDIO_PROMPT_MAX_CLIPS + 2 * AUDIO_BEEPS_MAX_COUNT)
+
+// Voice gains in Q15
+#define AUDIO_GAIN_SHIFT 15
+#define AUDIO_GAIN_UNITY (1 << AUDIO_GAIN_SHIFT)
+// The prompt is turned down while an alert plays over it, the sum still saturates
+#define AUDIO_GAIN_DUCKED (AUDIO_GAIN_UNITY / 2)
+
+// Mixer voices, each plays one request at a time
+enum audio_voice {
+    // Spoken prompts and announcements
+    AUDIO_VOICE_PROMPT,
+    // Urgent beeps, heard over the prompt
+    AUDIO_VOICE_ALERT,
+    AUDIO_VOICES_LENGTH
+};
+
+// A request only cuts off requests of its own voice
+static const enum audio_voice audio_priority_voices[AUDIO_PRIORITIES_LENGTH] = {
+    [AUDIO_PRIORITY_URGENT]  = AUDIO_VOICE_ALERT,
+    [AUDIO_PRIORITY_WARNING] = AUDIO_VOICE_PROMPT,
+    [AUDIO_PRIORITY_INFO]    = AUDIO_VOICE_PROMPT,
+};
+
+struct audio_voice_state {
+    // Request being played, an idle voice has no segments
+    struct audio_sample_data request;
+    const struct audio_clip *clips[AUDIO_PLAYLIST_MAX_CLIPS];
+    // Segment of the request each clip belongs to, the beeps come after the last one
+    size_t clip_segments[AUDIO_PLAYLIST_MAX_CLIPS];
+    size_t clips_length;
+    // Tone and pause every beep of the request plays
+    struct audio_clip beep_clips[2];
+    // Next block to decode
+    size_t clip;
+    size_t block;
+    // Decoded block being mixed and the clip it came from
+    int16_t pcm[AUDIO_ADPCM_BLOCK_SAMPLES];
+    size_t pcm_length;
+    size_t pcm_position;
+    size_t pcm_clip;
+    // Fix of the warning until its first samples were mixed
+    uint32_t trace_id;
+    // The first audible sample of the request is still to be timed
+    bool timed;
+};
+
+// What a buffer holds besides its samples
+struct audio_buffer_info {
+    // Fix whose warning starts in the buffer
+    uint32_t trace_id;
+    // Warnings starting in the buffer, by voice
+    bool timed[AUDIO_VOICES_LENGTH];
+    uint32_t requested_us[AUDIO_VOICES_LENGTH];
+    // Requests whose last samples are in the buffer
+    SemaphoreHandle_t done_playing[AUDIO_VOICES_LENGTH];
+};
+
+// One DMA chain, from the first request until every voice is idle
+struct audio_stream {
+    // The last armed buffer chains to the other one
+    bool chains;
+    uint32_t samples;
+    uint32_t buffers;
+    uint32_t mix_us;
+    uint32_t max_mix_us;
+    uint32_t underruns;
+};
 
 // Global variables for PIO and DMA management
 static PIO pio = pio0;
 static uint pio_sm = 0;
-static int dma_chan;
-static dma_channel_config dma_chan_cfg;
-
-static SemaphoreHandle_t playback_complete_semaphore;
+static int dma_chans[AUDIO_BUFFERS_LENGTH];
+static dma_channel_config dma_chan_cfgs[AUDIO_BUFFERS_LENGTH];
+
+// Mixed PCM, one buffer per DMA channel. Each channel chains to the other one,
+// the audio task refills a buffer while the other one plays.
+static int16_t audio_buffers[AUDIO_BUFFERS_LENGTH][AUDIO_BUFFER_SAMPLES];
+static struct audio_buffer_info audio_buffer_infos[AUDIO_BUFFERS_LENGTH];
+// Indexes of the buffers whose transfer finished
+static QueueHandle_t audio_buffer_done_queue;
+
+// Mixer state, only used by the audio task
+static struct audio_voice_state audio_voices[AUDIO_VOICES_LENGTH];
+static int32_t audio_mix[AUDIO_BUFFER_SAMPLES];
+
+// Request rings, only used by the audio task
+static struct ring *audio_sample_rings;
+static size_t audio_sample_rings_length;
+// Requests cut off by a more urgent one, a class only preempts lower ones so
+// at most one per class waits. Empty slots have no segments.
+static struct audio_sample_data audio_suspended[AUDIO_PRIORITIES_LENGTH];
+static struct audio_scheduler_stats audio_scheduler_stats;
+
+// Amplifier power state, only changed by the audio task
+static volatile bool audio_amp_on;
+static TickType_t audio_amp_unmuted_at;
+static TickType_t audio_amp_idle_since;
+static TickType_t audio_amp_idle_timeout;
+// Set from any task by audio_amp_hold(), which wakes the audio task to unmute
+static volatile TickType_t audio_amp_hold_until;
+static TaskHandle_t volatile audio_task_handle;
+static struct audio_amp_stats audio_amp_stats;
 
 // DMA completion handler
 static void __isr dma_handler(void) {
     BaseType_t higher_priority_task_woken = pdFALSE;
 
-    // Clear the interrupt
-    dma_channel_acknowledge_irq0(dma_chan);
-
-    // Stop PIO state machine
-    pio_sm_set_enabled(pio, pio_sm, false);
-
-    // Signal completion
-    assert(playback_complete_semaphore);
-    xSemaphoreGiveFromISR(playback_complete_semaphore, &higher_priority_task_woken);
+    for (uint8_t buffer=0; buffer<AUDIO_BUFFERS_LENGTH; buffer++) {
+        if (dma_channel_get_irq0_status(dma_chans[buffer]) == false) {
+            continue;
+        }
+        // Clear the interrupt
+        dma_channel_acknowledge_irq0(dma_chans[buffer]);
+        // The read address moved past the buffer, point it back before the other channel can chain to it
+        dma_channel_set_read_addr(dma_chans[buffer], audio_buffers[buffer], false);
+
+        // Signal completion
+        assert(audio_buffer_done_queue);
+        BaseType_t ret = xQueueSendFromISR(audio_buffer_done_queue, &buffer, &higher_priority_task_woken);
+        assert(ret == pdTRUE);
+    }
 
     portYIELD_FROM_ISR(higher_priority_task_woken);
 }
@@ -76,36 +180,479 @@ static void i2s_pio_init(void) {
 
 static void i2s_dma_init(void) {
     // Initialize DMA
-    dma_chan = dma_claim_unused_channel(true);
-    assert(dma_chan >= 0);
-
-    dma_chan_cfg = dma_channel_get_default_config(dma_chan);
-    channel_config_set_transfer_data_size(&dma_chan_cfg, DMA_SIZE_16);
-    channel_config_set_read_increment(&dma_chan_cfg, true);
-    channel_config_set_write_increment(&dma_chan_cfg, false);
-    channel_config_set_dreq(&dma_chan_cfg, pio_get_dreq(pio, pio_sm, true));
+    for (size_t i=0; i<AUDIO_BUFFERS_LENGTH; i++) {
+        dma_chans[i] = dma_claim_unused_channel(true);
+        assert(dma_chans[i] >= 0);
+
+        dma_chan_cfgs[i] = dma_channel_get_default_config(dma_chans[i]);
+        channel_config_set_transfer_data_size(&dma_chan_cfgs[i], DMA_SIZE_16);
+        channel_config_set_read_increment(&dma_chan_cfgs[i], true);
+        channel_config_set_write_increment(&dma_chan_cfgs[i], false);
+        channel_config_set_dreq(&dma_chan_cfgs[i], pio_get_dreq(pio, pio_sm, true));
+    }
 
     irq_set_exclusive_handler(DMA_IRQ_0, dma_handler);
     irq_set_enabled(DMA_IRQ_0, true);
 
     // Enable DMA completion interrupt
-    dma_channel_set_irq0_enabled(dma_chan, true);
+    for (size_t i=0; i<AUDIO_BUFFERS_LENGTH; i++) {
+        dma_channel_set_irq0_enabled(dma_chans[i], true);
+    }
 }
 
-static void audio_start_dma_transfer(const int16_t *sample, size_t sample_count) {
-    assert(sample);
+static bool audio_request_is_empty(const struct audio_sample_data *sample_data)
+{
+    return sample_data->segments_length == 0 && sample_data->beeps.count == 0;
+}
+
+static void audio_request_clear(struct audio_sample_data *sample_data)
+{
+    sample_data->segments_length = 0;
+    sample_data->beeps.count = 0;
+}
+
+static bool audio_voice_is_active(const struct audio_voice_state *voice)
+{
+    return audio_request_is_empty(&voice->request) == false;
+}
+
+static bool audio_mixer_is_active(void)
+{
+    for (size_t i=0; i<AUDIO_VOICES_LENGTH; i++) {
+        if (audio_voice_is_active(&audio_voices[i])) {
+            return true;
+        }
+    }
+    return false;
+}
 
+// Decode the next block of the voice's playlist, silence is written out as zeros
+static void audio_voice_decode_next_block(struct audio_voice_state *voice)
+{
+    assert(voice->clip < voice->clips_length);
+    const struct audio_clip *clip = voice->clips[voice->clip];
+    // Silence and tones are cut into blocks of the same size
+    const struct audio_adpcm_sample sample = { .data = clip->data, .length = clip->length };
+
+    size_t count;
+    switch (clip->codec) {
+        case AUDIO_CODEC_SILENCE:
+            count = clip->length - voice->block * AUDIO_ADPCM_BLOCK_SAMPLES;
+            if (count > AUDIO_ADPCM_BLOCK_SAMPLES) {
+                count = AUDIO_ADPCM_BLOCK_SAMPLES;
+            }
+            memset(voice->pcm, 0, count * sizeof(voice->pcm[0]));
+            break;
+        case AUDIO_CODEC_IMA_ADPCM:
+            count = audio_adpcm_decode_block(&sample, voice->block, voice->pcm);
+            break;
+        case AUDIO_CODEC_TONE: {
+            const struct audio_tone tone = {
+                .frequency_hz = clip->frequency_hz,
+                .sample_rate = AUDIO_SAMPLE_RATE,
+                .length = clip->length,
+            };
+            const uint32_t first = voice->block * AUDIO_ADPCM_BLOCK_SAMPLES;
+            count = clip->length - first;
+            if (count > AUDIO_ADPCM_BLOCK_SAMPLES) {
+                count = AUDIO_ADPCM_BLOCK_SAMPLES;
+            }
+            audio_tone_render(&tone, first, count, voice->pcm);
+            break;
+        }
+        default:
+            printf("ERROR: Unknown audio codec %d\n", clip->codec);
+            assert(0);
+            count = 0;
+    }
+    voice->pcm_length = count;
+    voice->pcm_position = 0;
+    voice->pcm_clip = voice->clip;
+
+    // The next clip continues right after the short last block of this one
+    voice->block++;
+    if (voice->block == audio_adpcm_get_blocks(&sample)) {
+        voice->clip++;
+        voice->block = 0;
+    }
+}
+
+// Add the voice's next samples to the mix, returns how many it had left up to a buffer
+static size_t audio_voice_mix(struct audio_voice_state *voice, int32_t gain)
+{
+    size_t mixed = 0;
+    while (mixed < AUDIO_BUFFER_SAMPLES) {
+        if (voice->pcm_position == voice->pcm_length) {
+            if (voice->clip == voice->clips_length) {
+                break;
+            }
+            audio_voice_decode_next_block(voice);
+        }
+
+        size_t count = voice->pcm_length - voice->pcm_position;
+        if (count > AUDIO_BUFFER_SAMPLES - mixed) {
+            count = AUDIO_BUFFER_SAMPLES - mixed;
+        }
+        const int16_t *pcm = &voice->pcm[voice->pcm_position];
+        int32_t *mix = &audio_mix[mixed];
+        for (size_t i=0; i<count; i++) {
+            mix[i] += (pcm[i] * gain) >> AUDIO_GAIN_SHIFT;
+        }
+        voice->pcm_position += count;
+        mixed += count;
+    }
+    return mixed;
+}
+
+// Mix every active voice into the buffer and saturate, returns the number of samples written
+static size_t audio_mix_buffer(uint8_t buffer)
+{
+    struct audio_buffer_info *info = &audio_buffer_infos[buffer];
+    *info = (struct audio_buffer_info){ .trace_id = TRACE_NO_ID };
+    memset(audio_mix, 0, sizeof(audio_mix));
+
+    const bool ducked = audio_voice_is_active(&audio_voices[AUDIO_VOICE_ALERT]);
+    size_t count = 0;
+    for (size_t i=0; i<AUDIO_VOICES_LENGTH; i++) {
+        struct audio_voice_state *voice = &audio_voices[i];
+        if (audio_voice_is_active(voice) == false) {
+            continue;
+        }
+
+        const int32_t gain = (i == AUDIO_VOICE_PROMPT && ducked) ? AUDIO_GAIN_DUCKED : AUDIO_GAIN_UNITY;
+        const size_t mixed = audio_voice_mix(voice, gain);
+        if (mixed > count) {
+            count = mixed;
+        }
+
+        if (info->trace_id == TRACE_NO_ID) {
+            info->trace_id = voice->trace_id;
+            voice->trace_id = TRACE_NO_ID;
+        }
+        if (voice->timed) {
+            info->timed[i] = true;
+            info->requested_us[i] = voice->request.requested_us;
+            voice->timed = false;
+        }
+        // Its last samples are in this buffer, it's done once the buffer played
+        if (voice->clip == voice->clips_length && voice->pcm_position == voice->pcm_length) {
+            info->done_playing[i] = voice->request.done_playing;
+            audio_request_clear(&voice->request);
+        }
+    }
+    assert(count > 0);
+
+    int16_t *pcm = audio_buffers[buffer];
+    for (size_t i=0; i<count; i++) {
+        const int32_t sample = audio_mix[i];
+        pcm[i] = sample > INT16_MAX ? INT16_MAX : (sample < INT16_MIN ? INT16_MIN : (int16_t)sample);
+    }
+    return count;
+}
+
+// Mix the next samples into the buffer and arm its channel
+static void audio_fill_buffer(struct audio_stream *stream, uint8_t buffer)
+{
+    const uint32_t start_us = time_us_32();
+    const size_t count = audio_mix_buffer(buffer);
+    const uint32_t mix_us = time_us_32() - start_us;
+
+    stream->samples += count;
+    stream->buffers++;
+    stream->mix_us += mix_us;
+    if (mix_us > stream->max_mix_us) {
+        stream->max_mix_us = mix_us;
+    }
+    stream->chains = audio_mixer_is_active();
+
+    const uint chan = dma_chans[buffer];
+    if (dma_channel_is_busy(chan)) {
+        // The other buffer ran out first and chained to this one, it replays its old samples
+        stream->underruns++;
+        return;
+    }
+
+    // The last buffer chains to itself, which stops the chain
+    channel_config_set_chain_to(&dma_chan_cfgs[buffer], stream->chains ? (uint)dma_chans[buffer ^ 1] : chan);
     dma_channel_configure(
-        dma_chan,
-        &dma_chan_cfg,    // Channel configuration
-        &pio->txf[pio_sm],    // Write to PIO TX FIFO
-        sample,           // Read from specified sample
-        sample_count,     // Transfer count
-        true              // Start immediately
+        chan,
+        &dma_chan_cfgs[buffer],    // Channel configuration
+        &pio->txf[pio_sm],         // Write to PIO TX FIFO
+        audio_buffers[buffer],     // Read from the mixed samples
+        count,                     // Transfer count
+        false                      // Started by the caller or by the other channel
     );
+}
+
+// The buffer started playing, time the warnings that start in it
+static void audio_buffer_started(uint8_t buffer)
+{
+    struct audio_buffer_info *info = &audio_buffer_infos[buffer];
+    trace_stage(TRACE_STAGE_DMA_START, info->trace_id);
+    info->trace_id = TRACE_NO_ID;
+
+    const uint32_t now_us = time_us_32();
+    for (size_t i=0; i<AUDIO_VOICES_LENGTH; i++) {
+        if (info->timed[i] == false) {
+            continue;
+        }
+        info->timed[i] = false;
+
+        const uint32_t latency_us = now_us - info->requested_us[i];
+        audio_amp_stats.latencies++;
+        audio_amp_stats.latency_last_us = latency_us;
+        audio_amp_stats.latency_sum_us += latency_us;
+        if (latency_us > audio_amp_stats.latency_max_us) {
+            audio_amp_stats.latency_max_us = latency_us;
+        }
+    }
+}
+
+static void audio_buffer_played(uint8_t buffer)
+{
+    for (size_t i=0; i<AUDIO_VOICES_LENGTH; i++) {
+        // Signal completion if required
+        if (audio_buffer_infos[buffer].done_playing[i] != NULL) {
+            xSemaphoreGive(audio_buffer_infos[buffer].done_playing[i]);
+            audio_buffer_infos[buffer].done_playing[i] = NULL;
+        }
+    }
+}
+
+// Fill the buffers up front and start a new chain, returns the number of buffers in flight
+static size_t audio_start_chain(struct audio_stream *stream)
+{
+    size_t in_flight = 0;
+    for (uint8_t buffer=0; buffer<AUDIO_BUFFERS_LENGTH && audio_mixer_is_active(); buffer++) {
+        audio_fill_buffer(stream, buffer);
+        in_flight++;
+    }
+
+    dma_channel_start(dma_chans[0]);
+    audio_buffer_started(0);
+    return in_flight;
+}
+
+static void audio_stop_dma(void)
+{
+    for (size_t i=0; i<AUDIO_BUFFERS_LENGTH; i++) {
+        if (dma_channel_is_busy(dma_chans[i]) == false) {
+            continue;
+        }
+        // An abort raises the completion interrupt as well (RP2040-E13)
+        dma_channel_set_irq0_enabled(dma_chans[i], false);
+        dma_channel_abort(dma_chans[i]);
+        dma_channel_acknowledge_irq0(dma_chans[i]);
+        dma_channel_set_irq0_enabled(dma_chans[i], true);
+    }
+}
+
+// Priority of the most urgent request for the voice waiting in the rings, AUDIO_PRIORITIES_LENGTH if there is none
+static enum audio_priority audio_get_waiting_priority(enum audio_voice voice, size_t *ring_index)
+{
+    enum audio_priority priority = AUDIO_PRIORITIES_LENGTH;
+    for (size_t i=0; i<audio_sample_rings_length; i++) {
+        struct audio_sample_data sample_data;
+        if (ring_peek(&audio_sample_rings[i], &sample_data) && sample_data.priority < priority &&
+            audio_priority_voices[sample_data.priority] == voice) {
+            priority = sample_data.priority;
+            *ring_index = i;
+        }
+    }
+    return priority;
+}
+
+// Take the most urgent request for the voice if it's more urgent than limit,
+// a suspended one goes before the rings of its class
+static bool audio_receive_sample(enum audio_voice voice, enum audio_priority limit, struct audio_sample_data *sample_data)
+{
+    size_t ring_index = 0;
+    const enum audio_priority ring_priority = audio_get_waiting_priority(voice, &ring_index);
+
+    for (size_t priority=0; priority<limit && priority<=ring_priority; priority++) {
+        if (audio_request_is_empty(&audio_suspended[priority]) == false && audio_priority_voices[priority] == voice) {
+            *sample_data = audio_suspended[priority];
+            audio_request_clear(&audio_suspended[priority]);
+            return true;
+        }
+    }
+
+    if (ring_priority >= limit) {
+        return false;
+    }
+    const bool popped = ring_pop(&audio_sample_rings[ring_index], sample_data);
+    assert(popped);
+    trace_stage(TRACE_STAGE_AUDIO_DEQUEUE, sample_data->trace_id);
+    return true;
+}
+
+// Append the clips of a request's segment to the voice's playlist
+static void audio_voice_add_prompt_clips(struct audio_voice_state *voice, enum audio_samples sample, size_t segment)
+{
+    assert(sample < AUDIO_SAMPLES_LENGTH);
+    const struct audio_prompt *prompt = &audio_prompts[sample];
+    // The I2S clock is set up for one rate only
+    assert(prompt->sample_rate == AUDIO_SAMPLE_RATE);
+
+    for (size_t i=0; i<prompt->clips_length; i++) {
+        assert(voice->clips_length < AUDIO_PLAYLIST_MAX_CLIPS);
+        voice->clips[voice->clips_length] = &prompt->clips[i];
+        voice->clip_segments[voice->clips_length] = segment;
+        voice->clips_length++;
+    }
+}
+
+// Append the beeps of the request to the voice's playlist, all of them play the same two clips
+static void audio_voice_add_beep_clips(struct audio_voice_state *voice, const struct audio_beeps *beeps, size_t segment)
+{
+    assert(beeps->count <= AUDIO_BEEPS_MAX_COUNT);
+    assert(beeps->beep_ms > 0 && beeps->period_ms > beeps->beep_ms);
+
+    voice->beep_clips[0] = (struct audio_clip){
+        .codec = AUDIO_CODEC_TONE,
+        .length = beeps->beep_ms * AUDIO_SAMPLE_RATE / 1000u,
+        .frequency_hz = beeps->frequency_hz,
+    };
+    voice->beep_clips[1] = (struct audio_clip){
+        .codec = AUDIO_CODEC_SILENCE,
+        .length = (beeps->period_ms - beeps->beep_ms) * AUDIO_SAMPLE_RATE / 1000u,
+    };
+
+    for (size_t i=0; i<2 * beeps->count; i++) {
+        assert(voice->clips_length < AUDIO_PLAYLIST_MAX_CLIPS);
+        voice->clips[voice->clips_length] = &voice->beep_clips[i % 2];
+        voice->clip_segments[voice->clips_length] = segment;
+        voice->clips_length++;
+    }
+}
+
+static void audio_voice_start(struct audio_voice_state *voice, const struct audio_sample_data *sample_data)
+{
+    assert(audio_request_is_empty(sample_data) == false);
+    assert(sample_data->segments_length <= AUDIO_PLAYLIST_MAX_SEGMENTS);
+
+    *voice = (struct audio_voice_state){
+        .request = *sample_data,
+        .trace_id = sample_data->trace_id,
+        // Only warnings raised by a fix, a resumed one lost its ID
+        .timed = sample_data->trace_id != TRACE_NO_ID,
+    };
+    for (size_t i=0; i<sample_data->segments_length; i++) {
+        printf("Playing audio sample %d\n", sample_data->segments[i]);
+        audio_voice_add_prompt_clips(voice, sample_data->segments[i], i);
+    }
+    if (sample_data->beeps.count > 0) {
+        printf("Playing audio beeps: frequency=%" PRIu32 " Hz, period=%" PRIu32 " ms, count=%" PRIu32 "\n",
+               sample_data->beeps.frequency_hz, sample_data->beeps.period_ms, sample_data->beeps.count);
+        audio_voice_add_beep_clips(voice, &sample_data->beeps, sample_data->segments_length);
+    }
+}
+
+// Stop the voice at the next buffer, its request resumes from the start of the cut segment
+// once the more urgent requests are done
+static void audio_voice_suspend(struct audio_voice_state *voice)
+{
+    const struct audio_sample_data *sample_data = &voice->request;
+    const size_t segment = voice->clip_segments[voice->pcm_clip];
+    audio_scheduler_stats.preempted++;
+    printf("Audio request preempted: segment=%zu, priority=%d, preempted=%" PRIu32 "\n",
+           segment, sample_data->priority, audio_scheduler_stats.preempted);
+
+    struct audio_sample_data *suspended = &audio_suspended[sample_data->priority];
+    assert(audio_request_is_empty(suspended));
+    *suspended = *sample_data;
+    suspended->segments_length -= segment;
+    memmove(suspended->segments, &sample_data->segments[segment], suspended->segments_length * sizeof(suspended->segments[0]));
+    suspended->trace_id = TRACE_NO_ID;
+
+    audio_request_clear(&voice->request);
+}
 
+// Start the most urgent request of each voice, cutting off a less urgent one it plays
+static void audio_schedule_voices(void)
+{
+    for (size_t i=0; i<AUDIO_VOICES_LENGTH; i++) {
+        struct audio_voice_state *voice = &audio_voices[i];
+        const enum audio_priority limit = audio_voice_is_active(voice) ? voice->request.priority : AUDIO_PRIORITIES_LENGTH;
+
+        struct audio_sample_data sample_data;
+        while (audio_receive_sample(i, limit, &sample_data)) {
+            // A late warning is worse than none
+            if (sample_data.expires && (int32_t)(xTaskGetTickCount() - sample_data.deadline) >= 0) {
+                audio_scheduler_stats.dropped++;
+                printf("Audio request dropped: segments=%zu, beeps=%" PRIu32 ", priority=%d, dropped=%" PRIu32 "\n",
+                       sample_data.segments_length, sample_data.beeps.count, sample_data.priority, audio_scheduler_stats.dropped);
+                if (sample_data.done_playing != NULL) {
+                    xSemaphoreGive(sample_data.done_playing);
+                }
+                continue;
+            }
+
+            if (audio_voice_is_active(voice)) {
+                audio_voice_suspend(voice);
+            }
+            audio_voice_start(voice, &sample_data);
+            break;
+        }
+    }
+}
+
+// Stream the mix of the voices as one DMA chain and return once every voice is idle. The CPU only
+// mixes the next buffer while the other one plays. Requests are taken between buffers, so a new one
+// starts, or cuts off a less urgent one of its voice, without a gap.
+static void audio_play_stream(void)
+{
+    struct audio_stream stream = { 0 };
+    xQueueReset(audio_buffer_done_queue);
+
+    size_t in_flight = audio_start_chain(&stream);
     // Start PIO state machine
     pio_sm_set_enabled(pio, pio_sm, true);
+
+    while (in_flight > 0) {
+        uint8_t buffer;
+        xQueueReceive(audio_buffer_done_queue, &buffer, portMAX_DELAY);
+        in_flight--;
+        audio_buffer_played(buffer);
+        if (in_flight > 0) {
+            audio_buffer_started(buffer ^ 1);
+        }
+
+        audio_schedule_voices();
+        if (audio_mixer_is_active() == false) {
+            continue;
+        }
+
+        if (in_flight == 0) {
+            // The chain ended before the request came in
+            in_flight = audio_start_chain(&stream);
+        } else if (stream.chains) {
+            audio_fill_buffer(&stream, buffer);
+            in_flight++;
+        }
+        // Otherwise the playing buffer ends the chain, a new one starts after it
+    }
+
+    // Only left running after an underrun
+    audio_stop_dma();
+    // Stop PIO state machine
+    pio_sm_set_enabled(pio, pio_sm, false);
+
+    // Share of the playback time spent mixing, in hundredths of a percent, and the worst buffer
+    // against the time it plays for
+    const uint64_t playback_us = (uint64_t)stream.samples * 1000000u / AUDIO_SAMPLE_RATE;
+    const uint32_t load = (uint32_t)((uint64_t)stream.mix_us * 10000u / playback_us);
+    const uint32_t buffer_us = (uint32_t)((uint64_t)AUDIO_BUFFER_SAMPLES * 1000000u / AUDIO_SAMPLE_RATE);
+    printf("Audio playback: length=%" PRIu32 " ms, buffers=%" PRIu32 ", mix=%" PRIu32 " us, load=%" PRIu32 ".%02" PRIu32
+           "%%, max=%" PRIu32 "/%" PRIu32 " us, underruns=%" PRIu32 "\n",
+           (uint32_t)(playback_us / 1000u), stream.buffers, stream.mix_us, load / 100, load % 100,
+           stream.max_mix_us, buffer_us, stream.underruns);
+
+    if (audio_amp_stats.latencies > 0) {
+        printf("Audio latency: warm=%" PRIu32 ", cold=%" PRIu32 ", n=%" PRIu32 ", last=%" PRIu32 " us, max=%" PRIu32 " us, mean=%" PRIu32 " us\n",
+               audio_amp_stats.warm_starts, audio_amp_stats.cold_starts, audio_amp_stats.latencies, audio_amp_stats.latency_last_us,
+               audio_amp_stats.latency_max_us, (uint32_t)(audio_amp_stats.latency_sum_us / audio_amp_stats.latencies));
+    }
 }
 
 static void audio_set_mute(bool mute)
@@ -113,6 +660,69 @@ static void audio_set_mute(bool mute)
     gpio_put(AUDIO_MUTE_PIN, !mute);
 }
 
+static void audio_amp_set_on(bool on)
+{
+    audio_set_mute(!on);
+    audio_amp_on = on;
+    if (on) {
+        audio_amp_unmuted_at = xTaskGetTickCount();
+        audio_amp_idle_since = audio_amp_unmuted_at;
+        audio_amp_stats.unmutes++;
+    }
+    printf("Audio amp: on=%d, unmutes=%" PRIu32 ", pre_unmutes=%" PRIu32 "\n",
+           on, audio_amp_stats.unmutes, audio_amp_stats.pre_unmutes);
+}
+
+// Turn the amplifier on if it isn't and wait for whatever is left of its warm-up
+static void audio_amp_warm_up(void)
+{
+    if (audio_amp_on == false) {
+        audio_amp_set_on(true);
+        for (size_t i=0; i<AUDIO_VOICES_LENGTH; i++) {
+            trace_stage(TRACE_STAGE_AMP_UNMUTE, audio_voices[i].trace_id);
+        }
+    }
+
+    const TickType_t warm_at = audio_amp_unmuted_at + pdMS_TO_TICKS(AUDIO_AMP_WARMUP_MS);
+    const TickType_t now = xTaskGetTickCount();
+    if ((int32_t)(warm_at - now) > 0) {
+        audio_amp_stats.cold_starts++;
+        vTaskDelay(warm_at - now);
+    } else {
+        audio_amp_stats.warm_starts++;
+    }
+}
+
+// With nothing to play, turn the amplifier on while it's held and off once it was idle for the timeout
+// and the hold ran out. Returns how long it stays as it is.
+static TickType_t audio_amp_update(void)
+{
+    const TickType_t now = xTaskGetTickCount();
+    TickType_t hold = audio_amp_hold_until - now;
+    if ((int32_t)hold <= 0 || hold > pdMS_TO_TICKS(AUDIO_AMP_MAX_HOLD_MS)) {
+        hold = 0;
+    }
+
+    if (audio_amp_on == false) {
+        if (hold == 0) {
+            return portMAX_DELAY;
+        }
+        audio_amp_stats.pre_unmutes++;
+        audio_amp_set_on(true);
+    }
+
+    TickType_t idle = audio_amp_idle_since + audio_amp_idle_timeout - now;
+    if ((int32_t)idle < 0) {
+        idle = 0;
+    }
+    const TickType_t remaining = hold > idle ? hold : idle;
+    if (remaining == 0) {
+        audio_amp_set_on(false);
+        return portMAX_DELAY;
+    }
+    return remaining;
+}
+
 static void audio_init(void)
 {
     // Initialize audio mute pin
@@ -127,167 +737,131 @@ static void audio_init(void)
     i2s_dma_init();
 }
 
-static void audio_send_sample_to_dma_and_wait(SemaphoreHandle_t semaphore, enum audio_samples sample)
+static void audio_push_sample(struct ring *samples, const struct audio_sample_data *sample_data)
 {
-    static_assert(AUDIO_SAMPLES_LENGTH == 20 && "Add new audio sample handling code.");
-    assert(semaphore);
-    assert(sample < AUDIO_SAMPLES_LENGTH);
-
-    if (sample == AUDIO_SAMPLES_ONE_SECOND_PAUSE) {
-        sleep_ms(1000);
-        return;
+    // Callers used to block on a full queue, keep that behaviour without taking a lock
+    while (ring_push(samples, sample_data) == false) {
+        vTaskDelay(AUDIO_RING_FULL_RETRY_TICKS);
     }
+}
 
-    switch (sample) {
-        case AUDIO_SAMPLES_ONE_BEEP:
-            audio_start_dma_transfer(audio_beep_sample_data, audio_beep_sample_data_length);
-            xSemaphoreTake(semaphore, portMAX_DELAY);
-            break;
-        case AUDIO_SAMPLES_THREE_BEEPS:
-            for (size_t i=0; i<3; i++) {
-                audio_start_dma_transfer(audio_beep_sample_data, audio_beep_sample_data_length);
-                xSemaphoreTake(semaphore, portMAX_DELAY);
-                sleep_ms(100);
-            }
-            break;
-        case AUDIO_SAMPLES_STARTUP:
-            audio_start_dma_transfer(audio_startup_sample_data, audio_startup_sample_data_length);
-            xSemaphoreTake(semaphore, portMAX_DELAY);
-            break;
-        case AUDIO_SAMPLES_SEARCHING_FOR_A_GPS_SIGNAL:
-            audio_start_dma_transfer(audio_searching_for_a_gps_signal_sample_data, audio_searching_for_a_gps_signal_sample_data_length);
-            xSemaphoreTake(semaphore, portMAX_DELAY);
-            break;
-        case AUDIO_SAMPLES_WARNING_SPEED_CAMERA_AHEAD_LIMIT:
-            audio_start_dma_transfer(audio_warning_speed_camera_ahead_limit_sample_data, audio_warning_speed_camera_ahead_limit_sample_data_length);
-            xSemaphoreTake(semaphore, portMAX_DELAY);
-            break;
-        case AUDIO_SAMPLES_UNKNOWN:
-            audio_start_dma_transfer(audio_unknown_sample_data, audio_unknown_sample_data_length);
-            xSemaphoreTake(semaphore, portMAX_DELAY);
-            break;
-        case AUDIO_SAMPLES_FIVE:
-            audio_start_dma_transfer(audio_five_sample_data, audio_five_sample_data_length);
-            xSemaphoreTake(semaphore, portMAX_DELAY);
-            break;
-        case AUDIO_SAMPLES_TEN:
-            audio_start_dma_transfer(audio_ten_sample_data, audio_ten_sample_data_length);
-            xSemaphoreTake(semaphore, portMAX_DELAY);
-            break;
-        case AUDIO_SAMPLES_TWENTY:
-            audio_start_dma_transfer(audio_twenty_sample_data, audio_twenty_sample_data_length);
-            xSemaphoreTake(semaphore, portMAX_DELAY);
-            break;
-        case AUDIO_SAMPLES_THIRTY:
-            audio_start_dma_transfer(audio_thirty_sample_data, audio_thirty_sample_data_length);
-            xSemaphoreTake(semaphore, portMAX_DELAY);
-            break;
-        case AUDIO_SAMPLES_FORTY:
-            audio_start_dma_transfer(audio_forty_sample_data, audio_forty_sample_data_length);
-            xSemaphoreTake(semaphore, portMAX_DELAY);
-            break;
-        case AUDIO_SAMPLES_FIFTY:
-            audio_start_dma_transfer(audio_fifty_sample_data, audio_fifty_sample_data_length);
-            xSemaphoreTake(semaphore, portMAX_DELAY);
-            break;
-        case AUDIO_SAMPLES_SIXTY:
-            audio_start_dma_transfer(audio_sixty_sample_data, audio_sixty_sample_data_length);
-            xSemaphoreTake(semaphore, portMAX_DELAY);
-            break;
-        case AUDIO_SAMPLES_SEVENTY:
-            audio_start_dma_transfer(audio_seventy_sample_data, audio_seventy_sample_data_length);
-            xSemaphoreTake(semaphore, portMAX_DELAY);
-            break;
-        case AUDIO_SAMPLES_EIGHTY:
-            audio_start_dma_transfer(audio_eighty_sample_data, audio_eighty_sample_data_length);
-            xSemaphoreTake(semaphore, portMAX_DELAY);
-            break;
-        case AUDIO_SAMPLES_NINETY:
-            audio_start_dma_transfer(audio_ninety_sample_data, audio_ninety_sample_data_length);
-            xSemaphoreTake(semaphore, portMAX_DELAY);
-            break;
-        case AUDIO_SAMPLES_ONE_HUNDRED:
-            audio_start_dma_transfer(audio_one_hundred_sample_data, audio_one_hundred_sample_data_length);
-            xSemaphoreTake(semaphore, portMAX_DELAY);
-            break;
-        case AUDIO_SAMPLES_GPS_SIGNAL_ACQUIRED:
-            audio_start_dma_transfer(audio_gps_signal_sample_data, audio_gps_signal_sample_data_length);
-            xSemaphoreTake(semaphore, portMAX_DELAY);
-            audio_start_dma_transfer(audio_acquired_sample_data, audio_acquired_sample_data_length);
-            xSemaphoreTake(semaphore, portMAX_DELAY);
-            break;
-        case AUDIO_SAMPLES_GPS_SIGNAL_LOST:
-            audio_start_dma_transfer(audio_gps_signal_sample_data, audio_gps_signal_sample_data_length);
-            xSemaphoreTake(semaphore, portMAX_DELAY);
-            audio_start_dma_transfer(audio_lost_sample_data, audio_lost_sample_data_length);
-            xSemaphoreTake(semaphore, portMAX_DELAY);
-            break;
-        default:
-            printf("ERROR: Unknown audio sample %d\n", sample);
-            assert(0);
-    };
+static void audio_set_deadline(struct audio_sample_data *sample_data, uint32_t max_delay_ms)
+{
+    sample_data->expires = max_delay_ms != AUDIO_NO_DEADLINE;
+    sample_data->deadline = xTaskGetTickCount() + pdMS_TO_TICKS(max_delay_ms);
 }
 
-void audio_play_sample_async(QueueHandle_t samples, enum audio_samples sample)
+void audio_play_sample_async(struct ring *samples, enum audio_samples sample)
+{
+    audio_play_playlist_async(samples, &sample, 1, AUDIO_PRIORITY_INFO, AUDIO_NO_DEADLINE, TRACE_NO_ID);
+}
+
+void audio_play_playlist_async(struct ring *samples, const enum audio_samples *segments, size_t segments_length,
+                               enum audio_priority priority, uint32_t max_delay_ms, uint32_t trace_id)
 {
     assert(samples);
-    assert(sample < AUDIO_SAMPLES_LENGTH);
+    assert(segments);
+    assert(segments_length > 0 && segments_length <= AUDIO_PLAYLIST_MAX_SEGMENTS);
+    assert(priority < AUDIO_PRIORITIES_LENGTH);
 
     struct audio_sample_data sample_data = {
-        .sample = sample,
-        .done_playing = NULL
+        .segments_length = segments_length,
+        .priority = priority,
+        .done_playing = NULL,
+        .trace_id = trace_id,
+        .requested_us = time_us_32()
     };
-    xQueueSend(samples, &sample_data, portMAX_DELAY);
+    for (size_t i=0; i<segments_length; i++) {
+        assert(segments[i] < AUDIO_SAMPLES_LENGTH);
+        sample_data.segments[i] = segments[i];
+    }
+    audio_set_deadline(&sample_data, max_delay_ms);
+    audio_push_sample(samples, &sample_data);
 }
 
-void audio_play_sample_blocking(QueueHandle_t samples, enum audio_samples sample, SemaphoreHandle_t done_playing)
+void audio_play_beeps_blocking(struct ring *samples, const struct audio_beeps *beeps, enum audio_priority priority,
+                               uint32_t max_delay_ms, SemaphoreHandle_t done_playing, uint32_t trace_id)
 {
     assert(samples);
-    assert(sample < AUDIO_SAMPLES_LENGTH);
+    assert(beeps);
+    assert(beeps->count > 0 && beeps->count <= AUDIO_BEEPS_MAX_COUNT);
+    assert(beeps->beep_ms > 0 && beeps->period_ms > beeps->beep_ms);
+    assert(priority < AUDIO_PRIORITIES_LENGTH);
     assert(done_playing);
 
     struct audio_sample_data sample_data = {
-        .sample = sample,
-        .done_playing = done_playing
+        .segments_length = 0,
+        .beeps = *beeps,
+        .priority = priority,
+        .done_playing = done_playing,
+        .trace_id = trace_id,
+        .requested_us = time_us_32()
     };
-    xQueueSend(samples, &sample_data, portMAX_DELAY);
+    audio_set_deadline(&sample_data, max_delay_ms);
+    audio_push_sample(samples, &sample_data);
 
     xSemaphoreTake(done_playing, portMAX_DELAY);
 }
 
+void audio_get_scheduler_stats(struct audio_scheduler_stats *stats)
+{
+    assert(stats);
+    // Only written by the audio task, a torn read of a counter pair is harmless
+    *stats = audio_scheduler_stats;
+}
+
+void audio_amp_hold(uint32_t hold_ms)
+{
+    assert(hold_ms <= AUDIO_AMP_MAX_HOLD_MS);
+    audio_amp_hold_until = xTaskGetTickCount() + pdMS_TO_TICKS(hold_ms);
+
+    // The audio task only has to be woken to unmute, it sees a longer hold once it wakes up anyway
+    TaskHandle_t task = audio_task_handle;
+    if (audio_amp_on == false && task != NULL) {
+        xTaskNotifyGive(task);
+    }
+}
+
+void audio_get_amp_stats(struct audio_amp_stats *stats)
+{
+    assert(stats);
+    // Only written by the audio task, a torn read is harmless
+    *stats = audio_amp_stats;
+}
+
 void audio_task(void *params)
 {
     assert(params);
     struct audio_task_params *task_params = (struct audio_task_params *)params;
 
-    playback_complete_semaphore = xSemaphoreCreateBinary();
-    assert(playback_complete_semaphore);
+    audio_buffer_done_queue = xQueueCreate(AUDIO_BUFFERS_LENGTH, sizeof(uint8_t));
+    assert(audio_buffer_done_queue);
 
     audio_init();
 
-    QueueHandle_t audio_samples = task_params->audio_sample_data_queue;
-    assert(audio_samples);
-
-    while (true) {
-        // Wait for a request to play a sample
-        struct audio_sample_data sample_data;
-        xQueueReceive(audio_samples, &sample_data, portMAX_DELAY);
-
-        audio_set_mute(false);
-        // Wait for the audio amplifier to turn on
-        sleep_ms(250);
-        // Play the samples until the queue is empty
-        do {
-            printf("Playing audio sample %d\n", sample_data.sample);
+    audio_sample_rings = task_params->audio_sample_rings;
+    audio_sample_rings_length = task_params->audio_sample_rings_length;
+    assert(audio_sample_rings);
+    assert(audio_sample_rings_length > 0);
+    audio_amp_idle_timeout = pdMS_TO_TICKS(task_params->amp_idle_timeout_ms);
+    audio_task_handle = xTaskGetCurrentTaskHandle();
 
-            // Play the sample and wait for completion
-            audio_send_sample_to_dma_and_wait(playback_complete_semaphore, sample_data.sample);
+    // Samples pushed before this are picked up by the first schedule below
+    for (size_t i=0; i<audio_sample_rings_length; i++) {
+        ring_set_consumer(&audio_sample_rings[i], xTaskGetCurrentTaskHandle());
+    }
 
-            // Signal completion if required
-            if (sample_data.done_playing != NULL) {
-                xSemaphoreGive(sample_data.done_playing);
-            }
-        } while (xQueueReceive(audio_samples, &sample_data, 0) == pdTRUE);
-        audio_set_mute(true);
+    while (true) {
+        audio_schedule_voices();
+        if (audio_mixer_is_active()) {
+            audio_amp_warm_up();
+            // Play until every voice is idle and the rings are empty
+            audio_play_stream();
+            audio_amp_idle_since = xTaskGetTickCount();
+            continue;
+        }
+
+        // Wait for a request to play a sample, a hold, or the time to turn the amplifier off
+        ulTaskNotifyTake(pdTRUE, audio_amp_update());
     }
 }
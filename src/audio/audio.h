@@ -1,44 +1,104 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
 
 #include <FreeRTOS.h>
-#include <queue.h>
 #include <semphr.h>
 
-enum audio_samples {
-    AUDIO_SAMPLES_ONE_SECOND_PAUSE,
-    AUDIO_SAMPLES_ONE_BEEP,
-    AUDIO_SAMPLES_THREE_BEEPS,
-    AUDIO_SAMPLES_STARTUP,
-    AUDIO_SAMPLES_SEARCHING_FOR_A_GPS_SIGNAL,
-    AUDIO_SAMPLES_WARNING_SPEED_CAMERA_AHEAD_LIMIT,
-    AUDIO_SAMPLES_UNKNOWN,
-    AUDIO_SAMPLES_FIVE,
-    AUDIO_SAMPLES_TEN,
-    AUDIO_SAMPLES_TWENTY,
-    AUDIO_SAMPLES_THIRTY,
-    AUDIO_SAMPLES_FORTY,
-    AUDIO_SAMPLES_FIFTY,
-    AUDIO_SAMPLES_SIXTY,
-    AUDIO_SAMPLES_SEVENTY,
-    AUDIO_SAMPLES_EIGHTY,
-    AUDIO_SAMPLES_NINETY,
-    AUDIO_SAMPLES_ONE_HUNDRED,
-    AUDIO_SAMPLES_GPS_SIGNAL_ACQUIRED,
-    AUDIO_SAMPLES_GPS_SIGNAL_LOST,
-    AUDIO_SAMPLES_LENGTH
+#include "ring/ring.h"
+// enum audio_samples, generated at build time from samples/audio_samples.json
+#include "audio/audio_samples.h"
+
+// Urgent requests are mixed over whatever else plays. Otherwise a request cuts off a playing request
+// of a lower class at the next DMA buffer, which resumes from the cut segment afterwards. Requests of
+// the same class play in order.
+enum audio_priority {
+    // Overspeed beeps
+    AUDIO_PRIORITY_URGENT,
+    // Camera announcements and beeps
+    AUDIO_PRIORITY_WARNING,
+    // Startup and GNSS status prompts
+    AUDIO_PRIORITY_INFO,
+    AUDIO_PRIORITIES_LENGTH
+};
+
+// Requests are played however late they start
+#define AUDIO_NO_DEADLINE 0
+
+// Most segments an announcement is made of, e.g. beeps, "warning speed camera ahead limit", "one hundred", "ten", "five"
+#define AUDIO_PLAYLIST_MAX_SEGMENTS 6
+#define AUDIO_BEEPS_MAX_COUNT       16
+
+// Synthesized beeps at a steady rate, each beep is followed by a pause up to the next one
+struct audio_beeps {
+    uint32_t frequency_hz;
+    uint32_t beep_ms;
+    // From the start of a beep to the start of the next one, longer than a beep
+    uint32_t period_ms;
+    uint32_t count;
 };
 
 struct audio_sample_data {
-    enum audio_samples sample;
+    // Played back to back without a gap, followed by the beeps if there are any
+    enum audio_samples segments[AUDIO_PLAYLIST_MAX_SEGMENTS];
+    size_t segments_length;
+    struct audio_beeps beeps;
+    enum audio_priority priority;
+    // Dropped if not started by then, or resumed by then after a preemption
+    bool expires;
+    TickType_t deadline;
+    // Given once played or dropped
     SemaphoreHandle_t done_playing;
+    // Fix that raised the warning for the latency trace, TRACE_NO_ID for other samples
+    uint32_t trace_id;
+    // When the request was made, the first audible sample of a warning is timed from it
+    uint32_t requested_us;
+};
+
+struct audio_scheduler_stats {
+    // Requests cut off by a more urgent one
+    uint32_t preempted;
+    // Requests whose deadline passed before they could start or resume
+    uint32_t dropped;
+};
+
+struct audio_amp_stats {
+    // The amplifier was turned on for a request, or ahead of one by audio_amp_hold()
+    uint32_t unmutes;
+    uint32_t pre_unmutes;
+    // Playbacks that found the amplifier warmed up, or had to wait for it
+    uint32_t warm_starts;
+    uint32_t cold_starts;
+    // From a fix's warning request to its first audible sample
+    uint32_t latencies;
+    uint32_t latency_last_us;
+    uint32_t latency_max_us;
+    uint64_t latency_sum_us;
 };
 
 struct audio_task_params {
-    QueueHandle_t audio_sample_data_queue;
+    // One ring of struct audio_sample_data per producer task, the most urgent head is played first
+    // and on a tie the earlier ring
+    struct ring *audio_sample_rings;
+    size_t audio_sample_rings_length;
+    // The amplifier is turned off once nothing played for this long and no hold is left
+    uint32_t amp_idle_timeout_ms;
 };
 
-void audio_play_sample_async(QueueHandle_t samples, enum audio_samples sample);
-void audio_play_sample_blocking(QueueHandle_t samples, enum audio_samples sample, SemaphoreHandle_t done_playing);
+// Informational sample without a deadline
+void audio_play_sample_async(struct ring *samples, enum audio_samples sample);
+// Play the segments as one announcement, max_delay_ms is its deadline or AUDIO_NO_DEADLINE.
+// The playback of a warning is traced as a stage of the fix that raised it.
+void audio_play_playlist_async(struct ring *samples, const enum audio_samples *segments, size_t segments_length,
+                               enum audio_priority priority, uint32_t max_delay_ms, uint32_t trace_id);
+// Returns once the beeps were played or dropped, they stream as one DMA chain
+void audio_play_beeps_blocking(struct ring *samples, const struct audio_beeps *beeps, enum audio_priority priority,
+                               uint32_t max_delay_ms, SemaphoreHandle_t done_playing, uint32_t trace_id);
+void audio_get_scheduler_stats(struct audio_scheduler_stats *stats);
+// Keep the amplifier on for at least hold_ms from now, e.g. while a camera is coming up,
+// so the next warning doesn't wait for it to warm up. Callable from any task.
+void audio_amp_hold(uint32_t hold_ms);
+void audio_get_amp_stats(struct audio_amp_stats *stats);
 void audio_task(void *params);
@@ -0,0 +1,74 @@
+#include "audio_adpcm.h"
+
+#include <assert.h>
+
+#define AUDIO_ADPCM_STEPS_LENGTH 89
+
+static const uint16_t audio_adpcm_steps[AUDIO_ADPCM_STEPS_LENGTH] = {
+    7, 8, 9, 10, 11, 12, 13, 14, 16, 17, 19, 21, 23, 25, 28, 31, 34, 37, 41, 45, 50, 55, 60, 66,
+    73, 80, 88, 97, 107, 118, 130, 143, 157, 173, 190, 209, 230, 253, 279, 307, 337, 371, 408,
+    449, 494, 544, 598, 658, 724, 796, 876, 963, 1060, 1166, 1282, 1411, 1552, 1707, 1878, 2066,
+    2272, 2499, 2749, 3024, 3327, 3660, 4026, 4428, 4871, 5358, 5894, 6484, 7132, 7845, 8630,
+    9493, 10442, 11487, 12635, 13899, 15289, 16818, 18500, 20350, 22385, 24623, 27086, 29794, 32767
+};
+
+// Step index change by the magnitude bits of a code
+static const int8_t audio_adpcm_index_changes[8] = { -1, -1, -1, -1, 2, 4, 6, 8 };
+
+size_t audio_adpcm_get_blocks(const struct audio_adpcm_sample *sample)
+{
+    assert(sample);
+    return (sample->length + AUDIO_ADPCM_BLOCK_SAMPLES - 1) / AUDIO_ADPCM_BLOCK_SAMPLES;
+}
+
+size_t audio_adpcm_decode_block(const struct audio_adpcm_sample *sample, size_t block, int16_t *pcm)
+{
+    assert(sample && sample->data);
+    assert(pcm);
+    assert(block < audio_adpcm_get_blocks(sample));
+
+    const size_t first = block * AUDIO_ADPCM_BLOCK_SAMPLES;
+    size_t count = sample->length - first;
+    if (count > AUDIO_ADPCM_BLOCK_SAMPLES) {
+        count = AUDIO_ADPCM_BLOCK_SAMPLES;
+    }
+
+    const uint8_t *data = &sample->data[block * AUDIO_ADPCM_BLOCK_SIZE];
+    int32_t predicted = (int16_t)(data[0] | (data[1] << 8));
+    int32_t index = data[2];
+    assert(index < AUDIO_ADPCM_STEPS_LENGTH);
+    data += AUDIO_ADPCM_BLOCK_HEADER_SIZE;
+
+    for (size_t i=0; i<count; i++) {
+        const uint8_t code = (i & 1) ? data[i / 2] >> 4 : data[i / 2] & 0x0f;
+        const int32_t step = audio_adpcm_steps[index];
+
+        int32_t difference = step >> 3;
+        if (code & 4) {
+            difference += step;
+        }
+        if (code & 2) {
+            difference += step >> 1;
+        }
+        if (code & 1) {
+            difference += step >> 2;
+        }
+        predicted += (code & 8) ? -difference : difference;
+        if (predicted > INT16_MAX) {
+            predicted = INT16_MAX;
+        } else if (predicted < INT16_MIN) {
+            predicted = INT16_MIN;
+        }
+
+        index += audio_adpcm_index_changes[code & 7];
+        if (index < 0) {
+            index = 0;
+        } else if (index >= AUDIO_ADPCM_STEPS_LENGTH) {
+            index = AUDIO_ADPCM_STEPS_LENGTH - 1;
+        }
+
+        pcm[i] = (int16_t)predicted;
+    }
+
+    return count;
+}
@@ -0,0 +1,22 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// IMA ADPCM, 4 bits per sample, in blocks that decode on their own. A block starts with the
+// decoder state before its first sample, the predicted sample (int16, little endian) and the
+// step index followed by a zero byte, then two samples per byte, low nibble first. Only the
+// last block of a prompt may be shorter.
+#define AUDIO_ADPCM_BLOCK_SAMPLES     1024
+#define AUDIO_ADPCM_BLOCK_HEADER_SIZE 4
+#define AUDIO_ADPCM_BLOCK_SIZE        (AUDIO_ADPCM_BLOCK_HEADER_SIZE + AUDIO_ADPCM_BLOCK_SAMPLES / 2)
+
+// A prompt as written by scripts/convert_audio_samples, length is in samples
+struct audio_adpcm_sample {
+    const uint8_t *data;
+    size_t length;
+};
+
+size_t audio_adpcm_get_blocks(const struct audio_adpcm_sample *sample);
+// Decode a block into pcm, which holds AUDIO_ADPCM_BLOCK_SAMPLES. Returns the number of samples written.
+size_t audio_adpcm_decode_block(const struct audio_adpcm_sample *sample, size_t block, int16_t *pcm);
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+enum audio_codec {
+    // No data, length samples of silence
+    AUDIO_CODEC_SILENCE,
+    // See audio_adpcm.h
+    AUDIO_CODEC_IMA_ADPCM,
+    // No data, a sine of frequency_hz synthesized while playing, see audio_tone.h
+    AUDIO_CODEC_TONE,
+};
+
+struct audio_clip {
+    enum audio_codec codec;
+    const uint8_t *data;
+    // In samples
+    uint32_t length;
+    // Pitch of a tone
+    uint32_t frequency_hz;
+};
+
+// What an enum audio_samples value plays. The table of them is generated at build time from
+// src/audio/samples/audio_samples.json, see scripts/convert_audio_samples.
+struct audio_prompt {
+    const struct audio_clip *clips;
+    uint32_t clips_length;
+    uint32_t sample_rate;
+    // In samples, of all clips
+    uint32_t length;
+};
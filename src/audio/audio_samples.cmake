@@ -0,0 +1,24 @@
+# enum audio_samples and the prompt table of the audio task are generated at build time
+# from samples/audio_samples.json, the prompt data itself is converted offline
+
+find_package(Python3 REQUIRED COMPONENTS Interpreter)
+
+set(CATCHCAM_AUDIO_DIR ${CMAKE_CURRENT_LIST_DIR})
+
+function(catchcam_generate_audio_samples TARGET)
+    set(manifest ${CATCHCAM_AUDIO_DIR}/samples/audio_samples.json)
+    set(script ${CATCHCAM_AUDIO_DIR}/../../scripts/convert_audio_samples/generate_sample_table.py)
+    set(output_dir ${CMAKE_CURRENT_BINARY_DIR}/generated)
+    # The table is written with the lengths from the sample headers
+    file(GLOB sample_headers ${CATCHCAM_AUDIO_DIR}/samples/*.h)
+
+    add_custom_command(
+        OUTPUT ${output_dir}/audio/audio_samples.h ${output_dir}/audio/audio_sample_table.h
+        COMMAND Python3::Interpreter ${script} ${manifest} ${output_dir}
+        DEPENDS ${script} ${manifest} ${sample_headers}
+        COMMENT "Generating the audio prompt table"
+    )
+    add_custom_target(${TARGET}_audio_samples DEPENDS ${output_dir}/audio/audio_samples.h ${output_dir}/audio/audio_sample_table.h)
+    add_dependencies(${TARGET} ${TARGET}_audio_samples)
+    target_include_directories(${TARGET} PRIVATE ${output_dir})
+endfunction()
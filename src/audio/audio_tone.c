@@ -0,0 +1,53 @@
+#include "audio_tone.h"
+
+#include <assert.h>
+
+#define AUDIO_TONE_TABLE_BITS   8
+#define AUDIO_TONE_TABLE_LENGTH (1u << AUDIO_TONE_TABLE_BITS)
+
+// One period at 0.9 of full scale, leaves some room for the prompt it's mixed with
+static const int16_t audio_tone_sine[AUDIO_TONE_TABLE_LENGTH] = {
+    0, 724, 1447, 2169, 2891, 3610, 4327, 5042, 5753, 6462, 7166, 7866, 8561, 9251, 9935, 10614,
+    11286, 11951, 12609, 13259, 13902, 14536, 15161, 15778, 16384, 16981, 17568, 18144, 18709, 19263, 19805, 20335,
+    20853, 21359, 21851, 22331, 22797, 23249, 23687, 24111, 24521, 24916, 25295, 25660, 26009, 26342, 26660, 26961,
+    27246, 27515, 27767, 28003, 28221, 28423, 28607, 28774, 28924, 29057, 29172, 29269, 29349, 29411, 29455, 29482,
+    29491, 29482, 29455, 29411, 29349, 29269, 29172, 29057, 28924, 28774, 28607, 28423, 28221, 28003, 27767, 27515,
+    27246, 26961, 26660, 26342, 26009, 25660, 25295, 24916, 24521, 24111, 23687, 23249, 22797, 22331, 21851, 21359,
+    20853, 20335, 19805, 19263, 18709, 18144, 17568, 16981, 16384, 15778, 15161, 14536, 13902, 13259, 12609, 11951,
+    11286, 10614, 9935, 9251, 8561, 7866, 7166, 6462, 5753, 5042, 4327, 3610, 2891, 2169, 1447, 724,
+    0, -724, -1447, -2169, -2891, -3610, -4327, -5042, -5753, -6462, -7166, -7866, -8561, -9251, -9935, -10614,
+    -11286, -11951, -12609, -13259, -13902, -14536, -15161, -15778, -16384, -16981, -17568, -18144, -18709, -19263, -19805, -20335,
+    -20853, -21359, -21851, -22331, -22797, -23249, -23687, -24111, -24521, -24916, -25295, -25660, -26009, -26342, -26660, -26961,
+    -27246, -27515, -27767, -28003, -28221, -28423, -28607, -28774, -28924, -29057, -29172, -29269, -29349, -29411, -29455, -29482,
+    -29491, -29482, -29455, -29411, -29349, -29269, -29172, -29057, -28924, -28774, -28607, -28423, -28221, -28003, -27767, -27515,
+    -27246, -26961, -26660, -26342, -26009, -25660, -25295, -24916, -24521, -24111, -23687, -23249, -22797, -22331, -21851, -21359,
+    -20853, -20335, -19805, -19263, -18709, -18144, -17568, -16981, -16384, -15778, -15161, -14536, -13902, -13259, -12609, -11951,
+    -11286, -10614, -9935, -9251, -8561, -7866, -7166, -6462, -5753, -5042, -4327, -3610, -2891, -2169, -1447, -724,
+};
+
+void audio_tone_render(const struct audio_tone *tone, uint32_t first, size_t count, int16_t *pcm)
+{
+    assert(tone);
+    assert(tone->sample_rate > 0 && tone->frequency_hz < tone->sample_rate / 2);
+    assert(first + count <= tone->length);
+    assert(pcm);
+
+    // Phase advance per sample, a full period is 2^32
+    const uint32_t phase_step = (uint32_t)(((uint64_t)tone->frequency_hz << 32) / tone->sample_rate);
+    uint32_t phase = first * phase_step;
+    const uint32_t ramp = tone->sample_rate * AUDIO_TONE_RAMP_MS / 1000u;
+
+    for (size_t i=0; i<count; i++) {
+        int32_t sample = audio_tone_sine[phase >> (32 - AUDIO_TONE_TABLE_BITS)];
+        phase += phase_step;
+
+        // Linear fades, a tone starting or stopping at full level clicks
+        const uint32_t position = first + (uint32_t)i;
+        const uint32_t remaining = tone->length - 1 - position;
+        const uint32_t edge = position < remaining ? position : remaining;
+        if (edge < ramp) {
+            sample = sample * (int32_t)edge / (int32_t)ramp;
+        }
+        pcm[i] = (int16_t)sample;
+    }
+}
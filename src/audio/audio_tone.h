@@ -0,0 +1,19 @@
+#pragma once
+
+#include <stddef.h>
+#include <stdint.h>
+
+// Sine tones by direct digital synthesis, a 32 bit phase accumulator indexes a sine table.
+// Any stretch of a tone can be rendered without the samples before it, so tones stream in
+// blocks like the ADPCM prompts. The first and last AUDIO_TONE_RAMP_MS fade in and out.
+#define AUDIO_TONE_RAMP_MS 2
+
+struct audio_tone {
+    uint32_t frequency_hz;
+    uint32_t sample_rate;
+    // In samples
+    uint32_t length;
+};
+
+// Render count samples of the tone starting at sample first into pcm
+void audio_tone_render(const struct audio_tone *tone, uint32_t first, size_t count, int16_t *pcm);
@@ -1,4 +1,4 @@
-// This file was generated by a script on 20-11-2024 08:37:37
+// This file was generated by a script on 17-10-2026 14:18:52
 
 #pragma once
 
@@ -6,6 +6,7 @@
 #include <stdint.h>
 #include <pico/platform/sections.h>
 
-static const int16_t __in_flash("audio_acquired_sample_data") audio_acquired_sample_data[] = { 0, -4, -12, -9, 0, 5, 0, -3, 0, 3, 2, -1, -2, -1, -1, -1, 1, 1, -1, -2, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 0, 0, 1, 2, 2, 1, 2, 5, 5, 5, 7, 10, 11, 10, 9, 9, 9, 9, 10, 11, 11, 10, 10, 10, 10, 11, 11, 11, 9, 9, 10, 11, 10, 8, 8, 8, 8, 8, 5, 1, 0, 0, 3, 3, 2, 3, 6, 7, 6, 5, 5, 3, 3, 2, 1, 2, 3, 1, -1, 0, 5, 7, 5, 2, 5, 5, 2, 2, 3, 5, 2, 2, 5, 7, 6, 2, 0, 0, 1, 7, 11, 9, 0, -4, -3, 0, 1, 1, 0, -1, 0, 5, 6, 0, -3, -1, 5, 7, 5, 1, 0, 0, 0, 2, 7, 6, 1, 0, 0, 1, 1, 0, -2, -7, -3, 1, 0, -9, -10, -3, 0, -2, -6, -6, -4, -3, 1, 6, 5, 0, -1, 3, 9, 10, 7, 3, 5, 7, 5, -2, -10, -13, -11, -10, -13, -18, -16, -9, -4, -9, -17, -21, -19, -11, -2, 0, -2, -6, -6, -6, -11, -17, -16, -12, -15, -16, -11, -7, -9, -12, -15, -20, -30, -29, -19, -12, -13, -12, -9, -10, -13, -9, 0, 2, -1, -8, -9, -6, -2, -4, -11, -13, -9, -4, -6, -10, -16, -22, -21, -12, -7, -12, -18, -11, 0, 2, -6, -16, -18, -15, -10, -10, -10, -6, 1, 0, -8, -13, -11, -13, -20, -24, -19, -17, -19, -19, -12, -7, -6, -3, 2, 7, 2, -6, -8, -3, 0, -3, -16, -31, -37, -24, -1, 6, -7, -21, -19, -8, -11, -26, -30, -20, -11, -11, -7, 7, 17, 14, 2, -6, -7, 0, 2, -10, -28, -29, -13, -1, -1, -2, 0, 2, 3, 5, 3, -4, -15, -12, -4, -2, -9, -11, -7, -10, -20, -19, -3, 5, 0, -1, 7, 16, 12, 3, -2, -9, -11, -3, 3, -8, -36, -44, -20, -7, -25, -43, -38, -33, -36, -28, -12, -10, -15, -2, 5, -15, -34, -16, 18, 25, 7, -6, -4, 0, 3, 0, -13, -29, -33, -25, -17, -13, -13, -17, -25, -31, -31, -26, -19, -20, -31, -45, -46, -28, -2, 9, 0, -13, -17, -10, -7, -7, 0, 10, 8, -10, -25, -16, 5, 11, 3, -8, -20, -28, -21, -7, -7, -16, -16, -3, 1, -3, -7, -6, -3, -2, -2, -7, -15, -21, -24, -24, -19, -13, -11, -13, -11, -4, -7, -15, -16, -15, -24, -35, -30, -13, 0, 1, -6, -18, -30, -35, -31, -29, -28, -28, -33, -43, -43, -26, -9, -7, -12, -16, -21, -34, -45, -42, -28, -16, -9, -1, 3, -7, -37, -57, -45, -21, -20, -35, -30, -10, -13, -38, -39, -9, 9, -6, -27, -30, -29, -33, -21, 14, 39, 27, 0, -2, 12, 7, -21, -36, -16, 15, 26, 16, 0, -9, -10, -7, -1, 1, 2, 2, 7, 15, 17, 14, 10, 11, 10, 5, 3, 7, 5, -2, 1, 19, 32, 32, 30, 33, 27, 16, 16, 26, 25, 2, -12, 0, 19, 19, 3, -4, -13, -29, -33, -15, -3, -12, -11, 11, 26, 15, 3, 14, 28, 26, 8, -7, -3, 17, 26, 8, -7, 3, 15, -2, -19, -6, 8, -2, -19, -18, -17, -22, -12, 5, 1, -20, -25, -8, 1, -1, 0, 11, 25, 29, 21, 15, 20, 26, 9, -10, 0, 30, 37, 16, 7, 20, 24, 5, -10, -11, -17, -33, -38, -24, -11, -16, -19, -6, 8, 2, -7, 0, 9, 0, -15, -9, 12, 27, 17, 0, 3, 33, 59, 53, 28, 14, 3, -21, -42, -28, 1, 0, -33, -48, -35, -22, -30, -45, -54, -62, -53, -7, 53, 62, 18, 0, 35, 61, 27, -17, -18, 0, 0, -8, 6, 25, 17, 3, 9, 3, -45, -85, -54, -3, -26, -83, -75, -2, 43, 36, 33, 55, 61, 28, -11, -20, 0, 20, 24, 14, 5, 0, 6, 27, 47, 41, 11, 5, 39, 69, 55, 20, -6, -18, -7, 18, 9, -30, -18, 48, 44, -53, -79, 34, 108, 21, -78, -22, 93, 85, -16, -38, 42, 64, -38, -122, -61, 64, 93, 8, -73, -71, -13, 6, -42, -86, -56, -7, -25, -64, -20, 63, 64, -8, -19, 62, 119, 84, 36, 39, 45, 8, -6, 46, 77, 3, -74, -39, 47, 46, -28, -38, 38, 88, 38, -22, 3, 82, 100, 41, -4, 20, 77, 98, 87, 78, 74, 62, 59, 94, 145, 135, 56, 1, 36, 103, 101, 43, 20, 51, 51, -4, -29, 33, 91, 56, -4, 11, 68, 72, 45, 60, 85, 66, 42, 68, 99, 70, 27, 47, 97, 79, 15, 5, 48, 54, 36, 71, 110, 56, -10, 61, 184, 146, -20, -57, 85, 150, -7, -168, -109, 28, -18, -184, -203, -53, 26, -61, -148, -101, -3, 24, 9, 26, 45, 19, -3, 23, 51, 26, -15, -36, -54, -69, -67, -73, -81, -43, -11, -91, -179, -82, 80, 26, -179, -210, -54, 3, -90, -115, -24, -11, -98, -53, 164, 287, 200, 166, 337, 446, 324, 233, 347, 374, 83, -265, -413, -552, -917, -1338, -1491, -1349, -1131, -949, -713, -349, 42, 318, 494, 718, 1040, 1342, 1491, 1502, 1481, 1461, 1397, 1318, 1338, 1450, 1456, 1251, 1032, 1018, 1104, 1022, 757, 557, 526, 472, 248, -6, -124, -203, -434, -738, -867, -810, -818, -1017, -1215, -1201, -1048, -988, -1039, -945, -599, -308, -346, -461, -274, 1, -145, -636, -895, -824, -958, -1523, -2031, -2042, -1820, -1867, -2161, -2270, -2050, -1797, -1735, -1711, -1528, -1282, -1183, -1240, -1266, -1143, -932, -758, -672, -611, -456, -173, 91, 197, 255, 483, 811, 954, 894, 909, 1083, 1149, 959, 762, 776, 818, 627, 356, 307, 383, 281, 72, 88, 316, 453, 471, 602, 873, 1076, 1180, 1351, 1590, 1692, 1619, 1576, 1646, 1636, 1452, 1280, 1232, 1147, 932, 776, 800, 814, 667, 557, 689, 843, 701, 429, 429, 629, 595, 317, 212, 378, 454, 314, 249, 416, 584, 590, 607, 786, 974, 1027, 1086, 1242, 1296, 1181, 1166, 1323, 1313, 1039, 846, 845, 744, 472, 276, 170, -57, -317, -365, -311, -443, -685, -724, -537, -419, -511, -594, -438, -174, -139, -323, -303, 72, 322, 90, -200, -51, 256, 212, -27, -57, -10, -201, -513, -707, -845, -1038, -1216, -1407, -1753, -2136, -2251, -2172, -2341, -2809, -3008, -2619, -2163, -2188, -2325, -1921, -1185, -855, -951, -794, -207, 182, -33, -384, -227, 319, 555, 192, -298, -440, -397, -532, -719, -635, -458, -625, -1058, -1323, -1356, -1420, -1531, -1532, -1544, -1811, -2261, -2623, -2799, -2870, -2874, -2769, -2527, -2248, -2152, -2331, -2512, -2391, -2098, -1962, -1981, -1956, -1952, -2144, -2380, -2409, -2303, -2259, -2280, -2318, -2463, -2712, -2862, -2820, -2761, -2835, -2946, -2945, -2880, -2868, -2851, -2706, -2504, -2408, -2376, -2222, -1953, -1762, -1717, -1671, -1524, -1347, -1214, -1091, -951, -875, -911, -963, -936, -893, -946, -1081, -1206, -1309, -1432, -1550, -1598, -1591, -1602, -1622, -1588, -1546, -1546, -1462, -1209, -1022, -1123, -1228, -930, -366, 24, 182, 334, 547, 804, 1162, 1539, 1714, 1681, 1619, 1560, 1491, 1511, 1547, 1303, 803, 396, 109, -282, -653, -794, -1042, -1717, -2355, -2416, -2218, -2353, -2692, -2755, -2535, -2344, -2297, -2416, -2856, -3685, -4636, -5308, -5568, -5671, -5978, -6467, -6693, -6345, -5411, -3729, -1149, 1637, 3477, 4366, 5471, 7198, 8702, 9547, 10294, 11161, 11628, 11621, 11764, 12335, 12964, 13411, 13778, 14078, 14177, 14189, 14374, 14696, 14819, 14670, 14575, 14761, 15015, 15140, 15291, 15586, 15750, 15476, 14942, 14536, 14245, 13839, 13512, 13648, 14027, 14045, 13748, 13751, 14164, 14520, 14668, 14797, 14665, 13748, 12164, 10605, 9329, 7928, 6221, 4676, 3630, 2714, 1525, 404, -84, -28, 53, -21, -121, -282, -650, -1124, -1398, -1334, -1075, -882, -896, -1066, -1285, -1547, -1825, -1987, -2008, -2079, -2269, -2373, -2342, -2453, -2805, -3077, -3090, -3100, -3316, -3605, -3908, -4438, -5278, -6127, -6562, -6414, -5899, -5474, -5388, -5366, -4921, -4015, -3080, -2391, -1717, -782, 212, 838, 1036, 1089, 1062, 718, 57, -509, -735, -942, -1591, -2641, -3570, -3994, -4084, -4256, -4538, -4585, -4358, -4320, -4667, -4901, -4577, -3977, -3602, -3491, -3432, -3408, -3458, -3426, -3172, -2767, -2306, -1781, -1220, -748, -431, -174, 147, 470, 500, 23, -762, -1466, -2052, -2733, -3373, -3672, -3885, -4572, -5585, -6240, -6416, -6614, -6996, -7269, -7322, -7269, -7163, -7093, -7138, -7035, -6507, -5935, -5958, -6470, -6807, -6775, -6786, -7062, -7380, -7504, -7495, -7610, -7991, -8440, -8669, -8780, -9106, -9547, -9671, -9585, -9882, -10583, -10940, -10593, -10118, -10051, -10103, -9773, -9166, -8670, -8196, -7339, -6173, -5265, -4827, -4369, -3479, -2482, -1889, -1576, -1170, -883, -1082, -1311, -814, 112, 428, -11, -288, 43, 372, 240, 114, 430, 737, 437, -140, -240, 97, 134, -353, -772, -701, -443, -420, -575, -643, -605, -602, -608, -505, -401, -569, -1059, -1570, -1897, -2206, -2632, -2935, -2965, -3092, -3645, -4348, -4833, -5216, -5675, -6041, -6268, -6632, -7098, -7187, -6816, -6558, -6727, -6857, -6550, -6188, -6296, -6646, -6726, -6653, -6778, -6800, -6259, -5543, -5333, -5350, -4801, -3825, -3350, -3514, -3419, -2709, -2207, -2435, -2683, -2346, -2014, -2204, -2264, -1642, -1055, -1227, -1548, -1157, -443, -280, -491, -248, 411, 716, 643, 998, 1852, 2233, 1770, 1396, 1860, 2611, 2793, 2470, 2197, 2031, 1686, 1310, 1395, 1967, 2423, 2347, 2016, 1875, 1884, 1785, 1637, 1585, 1390, 792, 138, -67, -20, -249, -632, -574, 59, 872, 1524, 1843, 1720, 1372, 1259, 1479, 1658, 1559, 1339, 1171, 1076, 1128, 1427, 1886, 2237, 2259, 2019, 1905, 2207, 2573, 2406, 1848, 1646, 1921, 2022, 1777, 1767, 2113, 2150, 1603, 1093, 1107, 1294, 1146, 753, 551, 702, 1073, 1549, 2046, 2413, 2651, 3036, 3716, 4374, 4634, 4501, 4160, 3653, 3067, 2676, 2607, 2577, 2250, 1718, 1410, 1590, 2088, 2527, 2667, 2511, 2216, 1957, 1803, 1714, 1655, 1618, 1552, 1486, 1673, 2315, 3126, 3556, 3534, 3566, 3998, 4503, 4600, 4336, 4117, 4122, 4326, 4849, 5669, 6250, 6158, 5755, 5612, 5589, 5229, 4635, 4195, 3789, 3050, 2184, 1783, 1903, 2031, 1993, 2167, 2609, 2769, 2433, 2185, 2436, 2713, 2435, 1785, 1339, 1311, 1585, 2146, 3024, 4091, 5257, 6726, 8736, 11030, 13011, 14407, 15502, 16604, 17614, 18262, 18445, 18241, 17761, 17275, 17135, 17366, 17473, 17101, 16546, 16315, 16385, 16366, 16137, 15899, 15771, 15695, 15648, 15656, 15708, 15772, 15833, 15868, 15849, 15742, 15537, 15246, 14958, 14760, 14615, 14404, 14106, 13866, 13789, 13735, 13523, 13230, 13019, 12728, 11993, 10802, 9503, 8289, 6999, 5497, 3887, 2332, 916, -285, -1176, -1781, -2257, -2669, -2910, -2915, -2803, -2713, -2632, -2550, -2558, -2681, -2817, -2927, -3080, -3300, -3561, -3891, -4290, -4637, -4897, -5230, -5714, -6221, -6613, -6888, -7071, -7194, -7357, -7585, -7735, -7704, -7592, -7502, -7402, -7284, -7220, -7167, -6957, -6536, -6024, -5494, -4875, -4105, -3252, -2434, -1703, -1028, -411, 54, 265, 238, 84, -133, -455, -901, -1368, -1743, -2056, -2439, -2916, -3355, -3674, -3936, -4191, -4389, -4526, -4682, -4838, -4892, -4860, -4828, -4746, -4549, -4359, -4319, -4354, -4332, -4283, -4277, -4302, -4365, -4514, -4704, -4839, -4950, -5146, -5441, -5804, -6236, -6683, -7061, -7401, -7858, -8456, -9037, -9470, -9787, -10100, -10470, -10823, -10981, -10894, -10753, -10763, -10843, -10784, -10595, -10471, -10445, -10349, -10112, -9909, -9871, -9867, -9748, -9611, -9646, -9822, -9960, -10009, -10063, -10170, -10324, -10514, -10706, -10870, -11020, -11138, -11120, -11008, -11048, -11313, -11479, -11216, -10681, -10287, -10129, -9925, -9453, -8825, -8238, -7723, -7234, -6797, -6426, -6030, -5538, -5038, -4642, -4362, -4175, -4128, -4201, -4187, -3934, -3618, -3564, -3799, -4035, -4092, -4038, -3965, -3945, -4099, -4437, -4703, -4673, -4466, -4373, -4475, -4629, -4672, -4536, -4286, -4122, -4205, -4456, -4618, -4537, -4322, -4223, -4368, -4617, -4727, -4653, -4610, -4774, -5040, -5193, -5214, -5287, -5517, -5778, -5848, -5707, -5602, -5731, -5893, -5742, -5358, -5169, -5248, -5153, -4677, -4180, -3990, -3938, -3729, -3402, -3202, -3228, -3271, -3004, -2446, -2089, -2184, -2284, -1993, -1648, -1582, -1497, -1230, -1205, -1431, -1236, -577, -312, -648, -731, -116, 662, 1221, 1818, 2620, 3475, 4423, 5723, 7427, 9198, 10495, 11043, 11294, 11945, 12804, 13011, 12524, 12209, 12232, 11854, 11000, 10508, 10553, 10394, 9792, 9330, 9211, 8965, 8436, 8018, 7820, 7428, 6781, 6440, 6621, 6657, 5984, 5064, 4639, 4627, 4497, 4200, 4029, 3933, 3650, 3278, 3138, 3206, 3104, 2672, 2169, 1829, 1534, 1078, 481, -116, -701, -1314, -1898, -2372, -2769, -3116, -3308, -3284, -3215, -3220, -3069, -2484, -1657, -1024, -665, -293, 270, 946, 1561, 1969, 2178, 2432, 2903, 3364, 3481, 3333, 3306, 3517, 3716, 3717, 3591, 3397, 3055, 2636, 2421, 2436, 2284, 1719, 1058, 672, 475, 232, -42, -255, -450, -608, -587, -413, -288, -233, -25, 385, 695, 726, 758, 1056, 1305, 1021, 279, -434, -871, -1099, -1254, -1570, -2229, -2972, -3361, -3436, -3573, -3802, -3950, -4139, -4509, -4737, -4501, -4061, -3868, -3895, -3775, -3387, -2937, -2617, -2371, -2002, -1448, -929, -718, -804, -924, -909, -855, -956, -1305, -1816, -2224, -2343, -2389, -2768, -3475, -4111, -4468, -4675, -4870, -5192, -5695, -5939, -5448, -4793, -4945, -5458, -4997, -3676, -2847, -2703, -2261, -1438, -972, -702, 151, 1420, 2250, 2417, 2342, 2372, 2638, 3052, 3270, 3149, 3034, 3179, 3297, 3130, 2941, 3021, 3217, 3241, 3059, 2768, 2422, 2133, 2051, 2128, 2119, 1965, 1911, 2078, 2234, 2274, 2539, 3237, 3911, 4044, 3887, 4092, 4742, 5299, 5455, 5474, 5587, 5575, 5228, 4803, 4632, 4614, 4367, 3577, 2099, 269, -1082, -1569, -1863, -2539, -2999, -2424, -915, 1242, 4288, 8066, 11698, 14705, 17385, 19772, 21481, 22601, 23502, 23976, 23643, 22939, 22658, 22832, 22923, 22877, 23247, 24170, 24948, 24919, 24313, 23811, 23613, 23335, 22634, 21579, 20496, 19659, 19029, 18368, 17600, 16994, 16701, 16455, 15996, 15534, 15498, 15874, 16273, 16658, 17384, 18354, 18992, 19291, 19824, 20447, 20203, 18940, 17524, 16243, 14446, 11969, 9501, 7342, 5081, 2670, 735, -384, -1079, -1778, -2367, -2577, -2540, -2592, -2768, -2889, -2996, -3283, -3763, -4280, -4745, -5157, -5532, -5867, -6040, -5869, -5458, -5171, -5074, -4878, -4556, -4447, -4623, -4792, -4892, -5221, -5904, -6793, -7775, -8741, -9479, -9973, -10517, -11252, -11903, -12196, -12204, -12110, -11899, -11384, -10455, -9233, -8011, -6883, -5629, -4184, -2968, -2330, -2001, -1592, -1285, -1464, -2009, -2500, -2844, -3217, -3644, -3988, -4196, -4374, -4673, -5149, -5636, -5920, -6060, -6334, -6779, -7132, -7271, -7425, -7807, -8324, -8733, -8889, -8818, -8616, -8378, -8104, -7713, -7136, -6394, -5599, -4916, -4456, -4223, -4167, -4311, -4736, -5408, -6185, -6982, -7873, -8913, -9963, -10860, -11658, -12573, -13651, -14701, -15540, -16174, -16678, -17060, -17326, -17509, -17610, -17586, -17446, -17260, -17082, -16904, -16675, -16343, -15920, -15509, -15189, -14929, -14612, -14209, -13788, -13434, -13196, -13059, -12979, -12925, -12931, -13047, -13262, -13534, -13850, -14225, -14596, -14839, -14930, -14991, -15057, -14952, -14501, -13799, -13047, -12252, -11284, -10162, -9087, -8180, -7365, -6525, -5644, -4777, -3983, -3336, -2824, -2267, -1525, -808, -430, -280, 42, 586, 1008, 1165, 1244, 1313, 1240, 1019, 792, 571, 230, -240, -702, -997, -1064, -960, -826, -712, -558, -335, -65, 276, 704, 1037, 1078, 946, 938, 1075, 1057, 750, 387, 164, -86, -596, -1222, -1673, -2021, -2607, -3447, -4114, -4312, -4269, -4398, -4774, -5152, -5335, -5324, -5197, -5032, -4930, -4939, -4963, -4883, -4718, -4551, -4389, -4175, -3901, -3557, -3102, -2546, -2008, -1592, -1250, -876, -480, -174, -8, 99, 198, 203, 50, -145, -198, -97, -16, -57, -106, 12, 343, 799, 1296, 1770, 2131, 2366, 2649, 3165, 3818, 4334, 4650, 4947, 5301, 5610, 5878, 6226, 6616, 6868, 6937, 6926, 6890, 6827, 6769, 6718, 6609, 6414, 6169, 5916, 5687, 5506, 5283, 4864, 4273, 3701, 3256, 2912, 2678, 2527, 2294, 1934, 1727, 1895, 2261, 2543, 2737, 2986, 3305, 3638, 3917, 4044, 4026, 4038, 4135, 4079, 3708, 3231, 2910, 2661, 2197, 1465, 693, 96, -355, -831, -1425, -2041, -2473, -2604, -2533, -2471, -2445, -2252, -1789, -1264, -863, -437, 245, 1110, 1858, 2323, 2567, 2751, 2998, 3290, 3461, 3398, 3190, 3015, 2950, 2980, 3019, 2898, 2485, 1887, 1410, 1256, 1345, 1368, 1029, 322, -329, -409, 118, 693, 795, 586, 653, 1208, 1877, 2348, 2813, 3548, 4364, 4850, 5042, 5428, 6218, 7038, 7483, 7580, 7461, 7044, 6307, 5437, 4536, 3637, 2896, 2249, 1249, -91, -885, -585, 60, 146, -6, 393, 1138, 1357, 1021, 1031, 1766, 2479, 2506, 2285, 2634, 3568, 4457, 4991, 5410, 6044, 6958, 7922, 8706, 9419, 10318, 11205, 11513, 11196, 10904, 10992, 10917, 10036, 8573, 7280, 6421, 5609, 4612, 3800, 3565, 3728, 3801, 3610, 3492, 3924, 4982, 6088, 6543, 6427, 6597, 7565, 8740, 9174, 8732, 8109, 7824, 7662, 7131, 6086, 4709, 3196, 1727, 567, 27, 524, 2358, 5102, 7744, 10016, 12847, 16759, 20731, 23467, 24807, 25226, 24989, 24358, 23649, 22807, 21782, 21088, 21158, 21643, 22145, 22891, 23927, 24685, 24779, 24470, 24020, 23444, 22884, 22457, 21956, 21292, 20814, 20692, 20496, 19805, 18742, 17618, 16596, 15734, 15022, 14329, 13614, 13222, 13586, 14596, 15612, 16251, 16700, 17095, 17185, 16893, 16546, 16050, 14677, 12219, 9464, 7092, 4947, 2739, 635, -1169, -2708, -3889, -4519, -4799, -5237, -5984, -6610, -6768, -6714, -6983, -7722, -8647, -9451, -9991, -10308, -10638, -11183, -11760, -12112, -12404, -12907, -13363, -13382, -13191, -13264, -13506, -13446, -13042, -12713, -12768, -13173, -13713, -14095, -14095, -13817, -13725, -14114, -14700, -14990, -14989, -15130, -15517, -15669, -15228, -14478, -13877, -13330, -12401, -11101, -9852, -8776, -7683, -6724, -6288, -6310, -6381, -6434, -6655, -6972, -7219, -7454, -7654, -7653, -7625, -7935, -8411, -8464, -8032, -7645, -7603, -7700, -7776, -7964, -8277, -8476, -8508, -8647, -8973, -9135, -8955, -8730, -8636, -8364, -7793, -7342, -7261, -7236, -7048, -6992, -7298, -7707, -7913, -8011, -8217, -8496, -8743, -9096, -9746, -10595, -11430, -12297, -13330, -14402, -15327, -16112, -16750, -17157, -17452, -17893, -18329, -18375, -18073, -17816, -17669, -17389, -16980, -16658, -16443, -16207, -16032, -16107, -16358, -16529, -16671, -17045, -17536, -17724, -17675, -17871, -18264, -18321, -18048, -17951, -17993, -17792, -17560, -17680, -17819, -17490, -16894, -16364, -15692, -14751, -13946, -13459, -12820, -11709, -10514, -9685, -9032, -8130, -6997, -5884, -4746, -3482, -2345, -1357, 148, 2524, 4931, 6382, 7027, 7556, 8057, 8218, 7998, 7392, 6197, 4559, 3265, 2884, 2964, 2735, 2265, 2143, 2350, 2509, 2824, 3455, 3655, 2972, 2349, 2549, 2836, 2603, 2522, 2877, 2761, 1997, 1677, 2061, 2005, 972, -195, -820, -1194, -1726, -2348, -2893, -3379, -3758, -3915, -3938, -4119, -4526, -4939, -5323, -5857, -6443, -6828, -7226, -8001, -8815, -9024, -8749, -8582, -8529, -8139, -7360, -6453, -5435, -4260, -3171, -2393, -1787, -1085, -234, 571, 1040, 1056, 861, 835, 1028, 1203, 1256, 1281, 1304, 1306, 1393, 1640, 1895, 2001, 2061, 2267, 2625, 3034, 3454, 3884, 4303, 4719, 5196, 5755, 6325, 6826, 7213, 7489, 7694, 7901, 8162, 8440, 8632, 8696, 8751, 8948, 9278, 9542, 9571, 9389, 9160, 8998, 8914, 8848, 8686, 8303, 7669, 6877, 6062, 5364, 4929, 4783, 4726, 4594, 4536, 4789, 5352, 6042, 6696, 7179, 7420, 7571, 7839, 8137, 8191, 7974, 7717, 7541, 7389, 7265, 7216, 7093, 6631, 5821, 5012, 4484, 4109, 3587, 2890, 2261, 1897, 1789, 1798, 1754, 1584, 1402, 1339, 1323, 1217, 1056, 974, 992, 1067, 1239, 1560, 2004, 2502, 3007, 3489, 3980, 4557, 5158, 5549, 5621, 5538, 5465, 5331, 5001, 4511, 4020, 3638, 3374, 3168, 2970, 2846, 2899, 3096, 3314, 3542, 3844, 4170, 4413, 4603, 4818, 5038, 5254, 5555, 5960, 6370, 6770, 7239, 7711, 7963, 7938, 7818, 7722, 7563, 7338, 7326, 7726, 8299, 8648, 8761, 8946, 9293, 9549, 9477, 9083, 8508, 7919, 7428, 6998, 6509, 5994, 5633, 5484, 5403, 5292, 5249, 5370, 5531, 5514, 5318, 5167, 5213, 5349, 5373, 5232, 5056, 5015, 5167, 5387, 5485, 5410, 5340, 5482, 5814, 6088, 6099, 5886, 5630, 5441, 5313, 5265, 5369, 5603, 5786, 5801, 5779, 5954, 6299, 6454, 6116, 5397, 4682, 4179, 3785, 3373, 3036, 2951, 3110, 3322, 3410, 3427, 3614, 4100, 4676, 4993, 4997, 4965, 5132, 5471, 5837, 6123, 6308, 6455, 6658, 6864, 6888, 6634, 6196, 5686, 5101, 4436, 3789, 3287, 2977, 2844, 2872, 3061, 3398, 3887, 4532, 5292, 6054, 6744, 7366, 7882, 8216, 8385, 8518, 8631, 8620, 8505, 8473, 8593, 8704, 8629, 8383, 8100, 7854, 7599, 7248, 6817, 6432, 6172, 5961, 5687, 5396, 5206, 5067, 4800, 4410, 4161, 4163, 4129, 3771, 3305, 3171, 3380, 3497, 3325, 3185, 3415, 3876, 4202, 4326, 4476, 4757, 4999, 5035, 4878, 4604, 4227, 3714, 3027, 2195, 1351, 573, -249, -1186, -2051, -2671, -3179, -3776, -4408, -4909, -5262, -5511, -5668, -5809, -6013, -6187, -6201, -6131, -6136, -6200, -6216, -6225, -6327, -6442, -6407, -6276, -6285, -6510, -6750, -6872, -7018, -7315, -7632, -7784, -7825, -7929, -8166, -8451, -8659, -8738, -8807, -9064, -9491, -9896, -10190, -10450, -10670, -10817, -11001, -11283, -11405, -11146, -10718, -10474, -10399, -10245, -9960, -9658, -9379, -9102, -8902, -8876, -8948, -8928, -8792, -8729, -8855, -9039, -9102, -9059, -9061, -9194, -9395, -9532, -9571, -9646, -9883, -10144, -10216, -10161, -10222, -10407, -10477, -10358, -10202, -10107, -10008, -9891, -9804, -9732, -9603, -9417, -9239, -9111, -9022, -8953, -8868, -8675, -8337, -7981, -7809, -7847, -7912, -7859, -7740, -7692, -7793, -8004, -8187, -8244, -8277, -8456, -8705, -8828, -8852, -8968, -9153, -9213, -9175, -9252, -9466, -9607, -9577, -9494, -9451, -9407, -9298, -9162, -9042, -8910, -8742, -8595, -8524, -8520, -8575, -8710, -8883, -9019, -9143, -9326, -9538, -9666, -9703, -9715, -9730, -9750, -9791, -9826, -9770, -9624, -9514, -9532, -9590, -9509, -9236, -8885, -8586, -8319, -7963, -7494, -7032, -6647, -6259, -5809, -5395, -5085, -4785, -4427, -4130, -4021, -4012, -3921, -3725, -3557, -3526, -3562, -3475, -3211, -2992, -3038, -3207, -3206, -3066, -3046, -3147, -3156, -3025, -2851, -2646, -2433, -2281, -2097, -1710, -1270, -1085, -1059, -832, -401, -104, -64, -104, -120, -134, -126, -88, -126, -306, -484, -470, -255, -21, 93, 106, 105, 143, 232, 347, 415, 343, 155, 28, 94, 260, 337, 324, 345, 376, 299, 142, 23, -49, -61, 103, 376, 469, 354, 385, 698, 973, 990, 947, 1044, 1206, 1356, 1584, 1915, 2162, 2171, 2048, 2039, 2228, 2450, 2524, 2474, 2485, 2669, 2921, 3043, 2995, 2946, 3033, 3159, 3207, 3280, 3519, 3820, 3957, 3926, 3918, 4056, 4294, 4503, 4558, 4470, 4426, 4578, 4814, 4912, 4877, 4929, 5181, 5501, 5716, 5802, 5857, 5985, 6215, 6522, 6807, 6985, 7072, 7177, 7320, 7379, 7246, 6976, 6696, 6477, 6329, 6269, 6304, 6379, 6418, 6431, 6478, 6558, 6584, 6522, 6449, 6462, 6596, 6792, 6955, 7047, 7157, 7334, 7459, 7464, 7555, 7920, 8343, 8455, 8299, 8268, 8486, 8621, 8445, 8180, 8127, 8194, 8152, 8038, 7992, 7925, 7755, 7698, 7935, 8284, 8508, 8685, 8965, 9261, 9422, 9475, 9461, 9280, 8869, 8418, 8158, 8058, 7877, 7561, 7344, 7397, 7565, 7652, 7754, 8093, 8581, 8809, 8574, 8135, 7864, 7811, 7753, 7560, 7332, 7209, 7215, 7271, 7333, 7384, 7359, 7160, 6853, 6671, 6680, 6660, 6488, 6376, 6482, 6621, 6597, 6551, 6670, 6849, 6890, 6787, 6635, 6451, 6183, 5782, 5302, 4938, 4836, 4867, 4799, 4657, 4625, 4678, 4665, 4618, 4692, 4856, 4958, 5001, 5113, 5286, 5374, 5315, 5202, 5102, 5003, 4913, 4866, 4802, 4595, 4299, 4136, 4186, 4272, 4222, 4069, 3927, 3845, 3821, 3818, 3755, 3581, 3390, 3362, 3546, 3770, 3815, 3671, 3539, 3551, 3559, 3326, 2870, 2472, 2323, 2308, 2215, 2046, 1960, 1980, 1937, 1746, 1560, 1559, 1668, 1672, 1533, 1409, 1328, 1117, 730, 401, 283, 221, 62, -67, -28, 45, -52, -274, -432, -509, -659, -960, -1274, -1420, -1396, -1367, -1443, -1575, -1676, -1759, -1871, -2013, -2185, -2419, -2687, -2864, -2887, -2849, -2870, -2959, -3047, -3097, -3116, -3143, -3237, -3432, -3649, -3746, -3653, -3464, -3335, -3309, -3293, -3219, -3172, -3289, -3567, -3828, -3917, -3868, -3826, -3837, -3804, -3629, -3378, -3247, -3343, -3536, -3633, -3625, -3649, -3744, -3821, -3853, -3847, -3755, -3605, -3581, -3761, -3941, -3936, -3859, -3901, -4018, -4071, -4098, -4222, -4405, -4472, -4390, -4346, -4483, -4714, -4863, -4861, -4785, -4758, -4854, -4988, -5004, -4920, -4941, -5110, -5220, -5177, -5146, -5220, -5262, -5176, -5043, -4961, -4934, -4941, -4947, -4909, -4876, -4940, -5055, -5079, -5016, -4998, -5067, -5139, -5180, -5228, -5285, -5325, -5359, -5399, -5399, -5320, -5196, -5109, -5078, -5075, -5087, -5119, -5124, -5047, -4930, -4869, -4861, -4823, -4733, -4638, -4549, -4458, -4395, -4362, -4295, -4172, -4059, -4006, -3955, -3838, -3665, -3512, -3439, -3425, -3381, -3288, -3263, -3394, -3574, -3631, -3591, -3616, -3728, -3781, -3709, -3628, -3624, -3600, -3490, -3401, -3419, -3400, -3195, -2926, -2801, -2772, -2633, -2376, -2186, -2129, -2074, -1951, -1853, -1834, -1794, -1679, -1607, -1655, -1728, -1757, -1814, -1949, -2099, -2229, -2359, -2453, -2482, -2516, -2594, -2632, -2587, -2548, -2560, -2544, -2477, -2449, -2492, -2521, -2501, -2518, -2607, -2670, -2636, -2583, -2585, -2569, -2470, -2371, -2326, -2223, -2012, -1905, -2069, -2315, -2358, -2239, -2242, -2459, -2682, -2747, -2751, -2850, -3002, -3066, -3042, -3053, -3127, -3162, -3110, -3063, -3098, -3137, -3054, -2886, -2823, -2920, -2968, -2796, -2558, -2491, -2548, -2499, -2340, -2253, -2281, -2291, -2247, -2268, -2382, -2461, -2441, -2437, -2518, -2564, -2472, -2355, -2351, -2388, -2325, -2215, -2216, -2321, -2349, -2229, -2093, -2063, -2086, -2051, -1957, -1867, -1795, -1723, -1641, -1528, -1357, -1170, -1044, -979, -935, -876, -801, -726, -695, -701, -647, -518, -463, -562, -655, -594, -501, -558, -696, -713, -613, -582, -671, -719, -626, -513, -520, -580, -538, -397, -293, -295, -338, -345, -311, -277, -253, -215, -153, -106, -99, -101, -69, -31, -46, -94, -117, -102, -90, -85, -72, -58, -53, -44, -28, -25, -30, -17, 16, 47, 72, 120, 214, 347, 490, 613, 727, 866, 1049, 1224, 1326, 1354, 1379, 1458, 1568, 1665, 1740, 1806, 1860, 1896, 1934, 1987, 2032, 2051, 2070, 2107, 2135, 2140, 2156, 2198, 2235, 2246, 2266, 2336, 2433, 2498, 2536, 2616, 2779, 2963, 3070, 3070, 3039, 3069, 3178, 3313, 3424, 3517, 3627, 3762, 3879, 3936, 3956, 3997, 4040, 4014, 3923, 3871, 3898, 3914, 3867, 3818, 3810, 3806, 3793, 3809, 3843, 3838, 3799, 3783, 3812, 3856, 3898, 3938, 3961, 3960, 3970, 4036, 4121, 4146, 4108, 4085, 4113, 4131, 4099, 4046, 3994, 3932, 3880, 3867, 3866, 3829, 3778, 3757, 3760, 3750, 3735, 3746, 3768, 3761, 3721, 3684, 3659, 3619, 3565, 3517, 3478, 3434, 3415, 3462, 3548, 3598, 3591, 3579, 3591, 3621, 3660, 3696, 3712, 3698, 3663, 3633, 3626, 3641, 3632, 3569, 3508, 3520, 3557, 3495, 3323, 3179, 3143, 3152, 3122, 3064, 3027, 3014, 2992, 2958, 2927, 2903, 2872, 2850, 2869, 2928, 2968, 2941, 2887, 2872, 2881, 2859, 2819, 2822, 2845, 2821, 2766, 2757, 2785, 2763, 2663, 2535, 2434, 2363, 2319, 2296, 2285, 2265, 2216, 2146, 2089, 2076, 2089, 2096, 2086, 2059, 1994, 1886, 1786, 1751, 1759, 1738, 1684, 1670, 1730, 1791, 1786, 1764, 1789, 1824, 1798, 1736, 1712, 1718, 1691, 1640, 1625, 1659, 1689, 1689, 1679, 1679, 1684, 1674, 1648, 1618, 1599, 1585, 1565, 1534, 1515, 1543, 1614, 1676, 1696, 1692, 1684, 1668, 1648, 1655, 1686, 1697, 1674, 1651, 1660, 1677, 1672, 1648, 1623, 1595, 1559, 1532, 1532, 1547, 1548, 1522, 1497, 1499, 1515, 1514, 1478, 1420, 1351, 1301, 1292, 1304, 1278, 1203, 1146, 1141, 1131, 1086, 1066, 1104, 1123, 1054, 941, 883, 889, 882, 809, 691, 600, 570, 565, 530, 456, 375, 307, 249, 201, 164, 125, 70, 3, -67, -140, -202, -249, -306, -377, -441, -490, -556, -651, -727, -748, -757, -804, -875, -928, -959, -990, -1029, -1063, -1086, -1104, -1119, -1119, -1101, -1090, -1110, -1167, -1233, -1283, -1320, -1363, -1420, -1468, -1485, -1482, -1486, -1504, -1516, -1516, -1535, -1596, -1680, -1737, -1735, -1707, -1714, -1769, -1814, -1802, -1756, -1712, -1671, -1642, -1664, -1714, -1708, -1623, -1535, -1498, -1489, -1489, -1511, -1524, -1489, -1419, -1363, -1338, -1329, -1336, -1365, -1409, -1457, -1511, -1565, -1607, -1629, -1640, -1656, -1680, -1704, -1719, -1728, -1733, -1735, -1732, -1733, -1741, -1731, -1688, -1656, -1676, -1719, -1723, -1708, -1732, -1786, -1820, -1837, -1870, -1919, -1957, -1978, -1976, -1945, -1925, -1948, -1977, -1968, -1952, -1977, -2021, -2043, -2056, -2084, -2108, -2104, -2091, -2105, -2133, -2149, -2160, -2191, -2238, -2268, -2280, -2296, -2317, -2325, -2321, -2326, -2340, -2342, -2336, -2342, -2364, -2380, -2376, -2355, -2330, -2312, -2314, -2333, -2335, -2296, -2255, -2262, -2289, -2276, -2234, -2232, -2267, -2279, -2260, -2247, -2240, -2226, -2222, -2242, -2251, -2233, -2227, -2258, -2280, -2248, -2185, -2145, -2130, -2099, -2049, -2013, -1997, -1966, -1899, -1831, -1793, -1776, -1743, -1687, -1631, -1602, -1597, -1591, -1565, -1531, -1515, -1518, -1524, -1526, -1521, -1518, -1541, -1585, -1580, -1488, -1383, -1360, -1395, -1384, -1314, -1265, -1272, -1270, -1212, -1138, -1111, -1117, -1104, -1058, -1004, -960, -935, -945, -975, -974, -928, -871, -830, -814, -836, -877, -880, -829, -802, -838, -859, -805, -745, -764, -830, -847, -787, -712, -672, -663, -659, -654, -644, -632, -627, -619, -589, -548, -543, -574, -574, -516, -467, -474, -479, -425, -358, -349, -371, -348, -297, -298, -357, -380, -321, -254, -245, -266, -259, -234, -227, -240, -252, -257, -265, -263, -241, -222, -239, -283, -315, -316, -294, -265, -240, -235, -243, -229, -180, -134, -127, -142, -122, -69, -29, -28, -31, -15, -3, -19, -38, -27, 0, 16, 20, 32, 39, 23, -9, -27, -22, -12, -3, 9, 19, 6, -22, -35, -27, -29, -55, -66, -39, -9, -15, -33, -19, 12, 27, 30, 39, 42, 38, 61, 107, 126, 103, 88, 109, 133, 128, 110, 105, 110, 123, 156, 200, 210, 173, 139, 137, 133, 123, 147, 182, 135, 21, -31, 10, 64, 102, 182, 283, 291, 190, 103, 106, 112, 35, -61, -57, 27, 90, 102, 121, 171, 226, 263, 267, 225, 175, 189, 251, 274, 230, 192, 227, 312, 376, 364, 279, 183, 143, 156, 161, 119, 69, 73, 135, 192, 212, 225, 265, 309, 315, 290, 289, 340, 417, 482, 520, 519, 478, 436, 453, 522, 581, 600, 620, 673, 723, 709, 607, 458, 334, 269, 243, 223, 226, 301, 449, 590, 644, 628, 644, 745, 857, 854, 715, 567, 534, 615, 734, 855, 983, 1099, 1146, 1113, 1051, 996, 926, 844, 819, 883, 998, 1149, 1338, 1461, 1396, 1222, 1160, 1247, 1301, 1215, 1086, 1001, 919, 811, 753, 821, 969, 1059, 1014, 881, 774, 785, 927, 1128, 1285, 1353, 1372, 1405, 1464, 1509, 1494, 1415, 1337, 1331, 1370, 1379, 1387, 1479, 1585, 1541, 1348, 1185, 1132, 1116, 1090, 1098, 1155, 1238, 1344, 1447, 1491, 1455, 1385, 1322, 1272, 1239, 1229, 1229, 1251, 1323, 1419, 1467, 1464, 1465, 1477, 1458, 1411, 1395, 1435, 1493, 1529, 1533, 1524, 1543, 1591, 1590, 1485, 1337, 1239, 1201, 1173, 1156, 1191, 1258, 1285, 1235, 1141, 1059, 1016, 995, 977, 953, 937, 963, 1035, 1112, 1144, 1122, 1080, 1032, 986, 959, 982, 1047, 1104, 1120, 1114, 1123, 1142, 1146, 1129, 1090, 1027, 965, 950, 976, 982, 949, 919, 907, 877, 822, 776, 743, 682, 597, 549, 568, 595, 580, 552, 555, 556, 499, 409, 354, 336, 312, 283, 279, 310, 360, 408, 427, 406, 372, 361, 372, 381, 376, 352, 319, 312, 360, 420, 416, 335, 256, 234, 230, 187, 120, 101, 137, 160, 116, 47, 26, 66, 116, 123, 84, 39, 16, 8, 2, 5, 28, 69, 89, 72, 53, 74, 116, 124, 87, 54, 54, 77, 116, 167, 201, 189, 154, 139, 133, 93, 19, -43, -63, -65, -93, -158, -224, -255, -262, -274, -291, -293, -284, -290, -310, -317, -302, -291, -304, -331, -349, -347, -330, -310, -292, -275, -261, -257, -268, -280, -282, -283, -299, -327, -355, -368, -367, -364, -374, -397, -419, -437, -466, -508, -546, -574, -603, -634, -660, -683, -698, -683, -638, -604, -605, -614, -593, -552, -521, -518, -522, -514, -492, -473, -473, -484, -484, -467, -463, -495, -546, -571, -564, -571, -610, -654, -678, -699, -722, -726, -704, -695, -716, -735, -728, -716, -728, -756, -765, -750, -741, -757, -783, -796, -801, -813, -832, -846, -845, -832, -827, -829, -822, -804, -804, -832, -850, -838, -832, -857, -872, -860, -857, -878, -888, -885, -900, -937, -965, -985, -1006, -1014, -1001, -1003, -1036, -1059, -1042, -1009, -994, -1010, -1042, -1070, -1081, -1075, -1074, -1090, -1108, -1114, -1111, -1104, -1093, -1087, -1099, -1124, -1143, -1140, -1130, -1132, -1130, -1103, -1064, -1049, -1065, -1085, -1092, -1090, -1083, -1072, -1065, -1065, -1057, -1030, -999, -990, -999, -995, -968, -944, -939, -939, -928, -909, -891, -877, -878, -886, -877, -864, -876, -897, -884, -856, -860, -878, -856, -810, -792, -792, -775, -765, -778, -772, -726, -690, -703, -721, -700, -668, -671, -682, -657, -626, -647, -685, -666, -605, -587, -612, -608, -558, -511, -489, -482, -491, -502, -485, -454, -456, -484, -485, -458, -445, -453, -443, -405, -372, -364, -376, -385, -381, -365, -352, -345, -354, -386, -427, -432, -384, -331, -328, -354, -357, -338, -329, -330, -320, -302, -283, -252, -208, -175, -158, -145, -135, -134, -121, -80, -35, -15, -18, -28, -38, -42, -42, -63, -102, -122, -112, -107, -119, -120, -111, -126, -158, -166, -153, -149, -154, -143, -126, -122, -113, -84, -54, -29, 10, 71, 119, 132, 124, 127, 155, 198, 220, 214, 208, 228, 251, 244, 225, 215, 201, 170, 147, 151, 151, 132, 125, 156, 190, 185, 162, 176, 233, 281, 300, 314, 337, 348, 340, 336, 343, 340, 326, 315, 318, 337, 357, 357, 347, 371, 428, 458, 440, 437, 483, 520, 510, 504, 539, 558, 518, 467, 472, 504, 509, 490, 499, 543, 575, 589, 610, 637, 646, 654, 688, 728, 745, 755, 776, 790, 785, 786, 794, 785, 773, 790, 817, 809, 779, 772, 788, 790, 775, 774, 789, 775, 727, 695, 715, 747, 758, 758, 755, 729, 697, 702, 736, 747, 730, 727, 745, 762, 772, 785, 792, 781, 762, 745, 728, 717, 716, 718, 703, 670, 639, 630, 636, 635, 617, 584, 542, 508, 499, 490, 452, 411, 425, 475, 493, 467, 445, 438, 424, 416, 444, 480, 466, 412, 385, 406, 421, 406, 389, 396, 398, 378, 370, 396, 420, 415, 399, 388, 366, 343, 331, 314, 278, 254, 253, 234, 182, 152, 164, 171, 142, 107, 98, 109, 125, 130, 121, 116, 127, 128, 96, 65, 80, 115, 119, 107, 121, 159, 176, 171, 167, 157, 120, 74, 65, 90, 93, 61, 43, 69, 94, 81, 53, 47, 56, 60, 50, 37, 38, 66, 97, 96, 72, 68, 81, 80, 64, 63, 70, 60, 50, 75, 124, 150, 135, 116, 120, 139, 157, 178, 196, 183, 146, 125, 129, 119, 70, 17, -2, 6, 23, 28, 18, 10, 26, 52, 60, 61, 77, 91, 82, 77, 101, 119, 96, 65, 68, 81, 69, 53, 65, 90, 87, 61, 51, 65, 69, 45, 27, 46, 79, 88, 69, 47, 48, 64, 61, 29, 11, 42, 79, 61, 12, -3, 1, -20, -58, -64, -42, -36, -56, -73, -76, -74, -74, -79, -91, -103, -101, -91, -90, -104, -122, -126, -116, -110, -121, -138, -146, -140, -130, -125, -124, -129, -142, -153, -153, -152, -166, -198, -224, -227, -221, -230, -249, -259, -263, -268, -270, -257, -252, -266, -286, -290, -289, -300, -311, -297, -271, -266, -281, -286, -273, -267, -283, -295, -283, -265, -263, -265, -250, -222, -211, -222, -230, -218, -201, -197, -204, -216, -226, -229, -228, -235, -253, -263, -249, -226, -217, -220, -220, -209, -194, -185, -191, -206, -213, -203, -189, -192, -216, -238, -238, -226, -221, -224, -221, -212, -206, -198, -188, -179, -175, -171, -164, -157, -156, -156, -161, -167, -172, -165, -154, -156, -175, -193, -195, -184, -177, -185, -195, -198, -194, -198, -208, -216, -215, -212, -215, -217, -213, -203, -193, -188, -185, -182, -179, -180, -189, -200, -203, -197, -185, -186, -203, -222, -231, -228, -222, -227, -246, -268, -274, -263, -261, -277, -293, -290, -276, -271, -273, -272, -264, -249, -231, -218, -218, -224, -216, -192, -177, -184, -189, -171, -148, -144, -148, -139, -125, -126, -135, -135, -133, -138, -146, -145, -137, -135, -136, -135, -130, -128, -127, -127, -130, -133, -131, -125, -119, -115, -107, -91, -75, -64, -57, -54, -61, -71, -70, -57, -47, -46, -47, -45, -45, -54, -62, -56, -39, -26, -28, -37, -39, -22, 6, 26, 24, 3, -13, -15, -4, 1, 0, -1, 9, 30, 43, 33, 19, 28, 51, 60, 59, 73, 105, 125, 119, 116, 135, 153, 146, 132, 135, 145, 146, 152, 164, 148, 108, 98, 127, 138, 116, 115, 153, 198, 249, 325, 387, 390, 362, 355, 367, 363, 328, 269, 218, 240, 344, 451, 495, 501, 502, 531, 656, 885, 1113, 1328, 1706, 2276, 2745, 2942, 3056, 3199, 3156, 2817, 2394, 2056, 1791, 1597, 1397, 939, 235, -268, -402, -698, -1626, -2808, -3467, -3406, -3138, -3214, -3627, -3911, -3720, -3238, -2962, -3098, -3354, -3356, -3102, -2822, -2509, -1934, -1125, -437, -10, 385, 854, 1187, 1337, 1524, 1804, 1970, 1988, 2087, 2353, 2598, 2666, 2557, 2281, 1827, 1296, 861, 519, 79, -547, -1170, -1571, -1779, -1975, -2216, -2449, -2681, -2968, -3255, -3437, -3530, -3600, -3514, -3054, -2321, -1665, -1177, -603, 148, 795, 1083, 1095, 1091, 1264, 1663, 2178, 2633, 2982, 3371, 3861, 4209, 4118, 3692, 3313, 3043, 2618, 2098, 1893, 2056, 2232, 2323, 2436, 2317, 1673, 816, 179, -366, -991, -1373, -1314, -1143, -1056, -856, -589, -600, -935, -1361, -1812, -2187, -2152, -1644, -1112, -840, -577, -104, 342, 438, 169, -270, -647, -731, -407, 216, 913, 1556, 2130, 2587, 2818, 2794, 2648, 2547, 2525, 2542, 2640, 2923, 3325, 3545, 3328, 2680, 1723, 608, -330, -732, -676, -556, -437, -119, 275, 457, 446, 176, -739, -2106, -2932, -2851, -2667, -2865, -2965, -2759, -2695, -2911, -3245, -3957, -5137, -5993, -5914, -5323, -4656, -3719, -2598, -1820, -1395, -987, -802, -1044, -1152, -713, -180, 200, 998, 2397, 3613, 4066, 4040, 3847, 3413, 2844, 2540, 2606, 2757, 2826, 2915, 3010, 2834, 2214, 1288, 209, -1058, -2389, -3329, -3598, -3458, -3332, -3345, -3461, -3688, -4035, -4468, -4934, -5252, -5168, -4659, -3940, -3146, -2326, -1706, -1486, -1413, -1024, -308, 351, 875, 1692, 3121, 4875, 6351, 7218, 7563, 7594, 7445, 7207, 6936, 6639, 6346, 6199, 6250, 6282, 5986, 5292, 4386, 3402, 2278, 1018, -47, -495, -404, -392, -831, -1359, -1577, -1816, -2599, -3756, -4729, -5364, -5780, -5868, -5495, -4822, -4026, -3147, -2350, -1856, -1570, -1259, -988, -944, -904, -411, 584, 1627, 2350, 2852, 3350, 3790, 4026, 4082, 4012, 3821, 3666, 3692, 3642, 3218, 2664, 2261, 1641, 455, -841, -1759, -2643, -3906, -5188, -6023, -6516, -6872, -7007, -6941, -6832, -6595, -6087, -5512, -5091, -4664, -4039, -3381, -2867, -2326, -1556, -710, -56, 474, 1162, 2000, 2675, 3067, 3397, 3820, 4247, 4589, 4840, 4945, 4883, 4784, 4696, 4482, 4113, 3733, 3345, 2826, 2226, 1639, 911, -81, -1079, -1796, -2370, -3043, -3625, -3777, -3621, -3600, -3775, -3762, -3443, -3229, -3359, -3416, -2914, -1985, -1079, -282, 676, 1882, 3052, 3873, 4302, 4516, 4618, 4554, 4355, 4281, 4465, 4632, 4440, 3951, 3442, 2905, 2070, 850, -525, -1812, -2882, -3575, -3781, -3788, -4088, -4630, -4865, -4755, -4986, -5778, -6395, -6287, -5814, -5387, -4786, -3797, -2751, -2021, -1530, -1084, -737, -558, -355, 123, 839, 1581, 2289, 3063, 3837, 4352, 4466, 4290, 3970, 3557, 3145, 2948, 3095, 3422, 3575, 3384, 3010, 2639, 2123, 1172, -133, -1276, -1850, -1948, -1952, -2097, -2323, -2466, -2442, -2331, -2330, -2569, -2864, -2805, -2233, -1494, -977, -641, -257, 145, 420, 598, 711, 676, 612, 921, 1769, 2787, 3498, 3769, 3755, 3616, 3365, 2934, 2368, 1914, 1765, 1818, 1860, 1932, 2226, 2605, 2521, 1684, 547, -281, -799, -1206, -1195, -517, 248, 479, 478, 649, 529, -277, -1131, -1330, -1085, -727, 28, 1330, 2608, 3228, 3101, 2512, 1794, 1118, 360, -509, -987, -544, 545, 1524, 2090, 2378, 2298, 1619, 544, -386, -935, -1250, -1373, -1122, -572, -37, 499, 1146, 1238, -48, -2052, -3205, -3387, -3811, -4630, -4877, -4612, -4827, -5579, -6187, -6581, -6965, -7176, -7353, -7744, -7582, -6011, -3928, -2881, -2668, -2100, -1164, -580, -330, -102, -20, 112, 1017, 2689, 4192, 5027, 5610, 6297, 6841, 6886, 6490, 6156, 6314, 6576, 6029, 4728, 3878, 3864, 3391, 1586, -438, -1352, -1633, -2544, -4035, -4946, -4782, -4287, -4339, -4885, -5203, -5001, -4883, -5523, -6605, -7080, -6478, -5529, -5109, -4949, -4023, -2163, -462, 210, 388, 1149, 2608, 3928, 4591, 4978, 5639, 6536, 7219, 7393, 7101, 6619, 6303, 6307, 6338, 5951, 5191, 4655, 4757, 5122, 5063, 4435, 3532, 2409, 1099, 68, -535, -1364, -2533, -3078, -2889, -3225, -4252, -4722, -4795, -5834, -7132, -6711, -5162, -4594, -4614, -3383, -1313, -72, 393, 866, 862, -31, -737, -413, 81, -121, -192, 887, 2229, 2263, 1341, 899, 802, 164, -361, -130, -476, -1904, -2200, -555, 310, -939, -1921, -1457, -1498, -2504, -2432, -1168, -803, -1494, -1519, -686, -110, 27, -57, -754, -1856, -2261, -1685, -967, -637, -658, -1013, -1375, -1209, -781, -678, -493, 289, 973, 1173, 1925, 3290, 3445, 2071, 1359, 2094, 2590, 2396, 2812, 3450, 2724, 1440, 1649, 2686, 2203, 180, -1303, -1393, -1068, -1141, -1339, -1072, -298, 351, 239, -485, -1096, -1320, -1651, -2409, -2919, -2249, -618, 652, 799, 445, 415, 607, 547, 251, -30, -256, -380, -282, -139, -279, -561, -518, -158, 15, -103, 30, 677, 1146, 676, -174, 87, 1705, 2818, 1922, 294, 210, 1368, 1411, -256, -1659, -1460, -549, -7, 399, 1007, 1249, 717, 121, 282, 719, 242, -1170, -2151, -1963, -1641, -2213, -2770, -1621, 887, 2185, 810, -1206, -1100, 184, -654, -3420, -4229, -2108, -634, -1425, -1683, -49, 821, -682, -2685, -3365, -2791, -1598, -899, -1579, -1938, 389, 3550, 3583, 1098, 79, 1108, 1621, 1121, 826, 469, -341, -493, 93, -256, -1737, -2927, -4193, -7043, -10324, -11095, -9101, -7075, -6804, -7206, -6251, -3610, -1215, -1054, -2448, -2710, -744, 1867, 3870, 6162, 9541, 12759, 14353, 14880, 15763, 16952, 17396, 17189, 17568, 18922, 20550, 22199, 23949, 24607, 22656, 19094, 16832, 16747, 16509, 13998, 10194, 7921, 8395, 9522, 8211, 4434, 1171, -280, -2079, -5343, -7553, -6991, -6098, -7437, -9504, -9658, -8629, -8996, -10914, -12313, -12456, -12424, -12415, -11362, -9486, -8339, -8013, -7252, -6287, -6368, -6857, -6168, -4745, -4010, -3647, -2618, -1272, -436, -201, -572, -1447, -1975, -1753, -1708, -2135, -1774, -386, 96, -1281, -2701, -2676, -2652, -4432, -6810, -7399, -6679, -7160, -8933, -9636, -8887, -8787, -9764, -9927, -8877, -8159, -7966, -6974, -5156, -3764, -3197, -2935, -2568, -1693, -142, 1237, 1521, 1402, 2385, 4464, 6089, 6506, 6625, 7168, 7511, 7325, 7583, 8485, 8514, 7408, 7199, 8409, 8677, 7038, 5494, 4953, 4093, 2845, 2365, 1800, -283, -2346, -2121, -745, -845, -2378, -3500, -3715, -3870, -4454, -5293, -5929, -5843, -5056, -4345, -4205, -4010, -2947, -1453, -738, -958, -954, -149, 549, 444, 315, 1045, 2167, 2828, 3128, 3477, 3583, 3049, 2265, 1891, 1833, 1539, 1017, 835, 1126, 1297, 883, 41, -1011, -2443, -4268, -5851, -6583, -6734, -6959, -7251, -7208, -7008, -7098, -7282, -7235, -7345, -7903, -8215, -7638, -6616, -5789, -5170, -4741, -4601, -4292, -3306, -2213, -1920, -2105, -1705, -592, 449, 1155, 2010, 3083, 3663, 3382, 2839, 2682, 2879, 3283, 3973, 4607, 4649, 4498, 5040, 5928, 5838, 4576, 3333, 2768, 2351, 1660, 1099, 1154, 1713, 2216, 2233, 1914, 1749, 1815, 1691, 1322, 1281, 1792, 2270, 2241, 1956, 1765, 1628, 1413, 1043, 490, 127, 539, 1570, 2427, 2914, 3299, 3226, 2352, 1536, 1537, 1463, 398, -748, -910, -741, -1165, -1792, -2141, -2604, -3207, -3137, -2167, -1183, -974, -1530, -2425, -3193, -3605, -3991, -4831, -5879, -6342, -5961, -5261, -4749, -4398, -3907, -3142, -2348, -1896, -1666, -1021, 165, 1133, 1428, 1647, 2296, 2878, 2892, 2742, 2879, 3042, 2954, 2936, 3218, 3438, 3352, 3361, 3700, 3732, 2930, 2028, 2041, 2561, 2409, 1585, 1062, 1003, 683, -154, -1056, -1573, -1434, -673, 74, 215, 109, 389, 735, 430, -429, -1275, -1878, -2053, -1418, -118, 1045, 1655, 2025, 2429, 2689, 2553, 1952, 1177, 945, 1643, 2567, 2750, 2374, 2293, 2597, 2759, 2702, 2645, 2408, 1788, 1131, 844, 887, 1145, 1629, 2038, 1754, 692, -337, -501, 143, 937, 1513, 1953, 2272, 2302, 2112, 1978, 1797, 1053, -293, -1360, -1315, -448, 363, 828, 1084, 943, 293, -316, -473, -535, -732, -731, -540, -459, -57, 1075, 1912, 1318, 39, -604, -805, -1246, -1631, -1588, -1216, -207, 1452, 2365, 1706, 1003, 1346, 1077, -1018, -2967, -2746, -1403, -719, -420, 442, 1569, 2235, 2374, 2186, 1780, 1388, 1239, 1315, 1581, 2093, 2653, 2760, 2295, 1877, 1920, 1714, 567, -598, -401, 619, 859, 347, 258, 500, 249, -106, 50, -110, -1363, -2651, -2712, -2079, -1974, -2422, -2603, -2130, -1288, -590, -386, -629, -894, -815, -393, 178, 786, 1358, 1679, 1669, 1727, 2215, 2624, 2130, 961, 161, 55, 154, 374, 991, 1615, 1592, 1168, 1080, 1227, 876, -46, -793, -873, -680, -912, -1588, -1954, -1556, -1056, -1389, -2337, -2785, -2378, -1951, -2169, -2609, -2532, -1898, -1259, -1008, -1075, -1190, -1201, -1155, -1124, -1026, -668, 27, 884, 1574, 1904, 1966, 1966, 2013, 2079, 2090, 2037, 2052, 2267, 2563, 2752, 3008, 3607, 4188, 4025, 3168, 2453, 2203, 1813, 874, -127, -477, -67, 485, 382, -418, -976, -727, -585, -1604, -3147, -3838, -3638, -3474, -3437, -2882, -1837, -1048, -983, -1458, -1910, -1876, -1578, -1659, -1939, -1324, 380, 1751, 1670, 861, 593, 837, 584, -594, -1996, -2518, -1699, -125, 1194, 1800, 1907, 1752, 1313, 580, -382, -1548, -2676, -3155, -2585, -1389, -457, -185, -330, -718, -1502, -2559, -3376, -3858, -4447, -4995, -4521, -2718, -772, 41, -220, -693, -891, -883, -888, -1103, -1550, -1825, -1407, -472, 114, -18, -203, -7, -144, -1137, -2048, -1871, -1369, -2027, -3763, -4972, -4545, -2978, -1722, -1860, -3160, -4285, -4154, -2992, -1874, -1466, -1575, -1674, -1494, -1069, -504, 90, 585, 958, 1281, 1551, 1827, 2411, 3362, 4139, 4536, 5312, 6797, 7862, 7647, 7053, 7070, 7109, 6362, 5211, 4262, 3646, 3671, 4398, 4795, 4095, 3227, 3204, 3389, 2886, 2066, 1405, 513, -636, -1128, -561, 256, 571, 537, 486, 280, -216, -681, -830, -893, -1105, -1181, -865, -531, -529, -547, -297, -156, -456, -819, -694, 56, 1221, 2219, 2356, 1754, 1393, 1664, 1897, 1754, 1754, 2092, 2326, 2367, 2411, 2202, 1578, 1078, 922, 456, -502, -1174, -1332, -1733, -2554, -2972, -2586, -1931, -1587, -1734, -2260, -2645, -2363, -1733, -1532, -1785, -1905, -1808, -1787, -1678, -1203, -769, -951, -1528, -1829, -1697, -1509, -1391, -967, 66, 1357, 2066, 1715, 743, 90, 271, 922, 1269, 912, 61, -795, -1163, -609, 838, 2293, 2644, 1843, 939, 688, 741, 406, -417, -1197, -1294, -544, 461, 907, 644, 105, -490, -1119, -1405, -978, -82, 872, 1754, 2184, 1637, 520, -125, -275, -736, -1388, -1316, -313, 1210, 2899, 3850, 2995, 1034, -117, -281, -894, -2040, -2462, -1993, -1231, 37, 1664, 2160, 973, -417, -1087, -1829, -2819, -2886, -1747, -578, -108, -34, -177, -640, -1185, -1606, -2291, -3556, -4800, -5062, -4223, -3019, -2001, -1229, -940, -1498, -2460, -2745, -2045, -1136, -603, -168, 692, 2093, 3575, 4247, 3565, 2278, 1877, 2762, 3710, 3682, 3346, 3891, 4932, 5063, 4194, 3554, 3383, 2733, 1569, 868, 688, 320, 8, 409, 1002, 873, 123, -849, -2150, -3473, -3926, -3484, -3088, -2944, -2245, -776, 476, 446, -964, -2765, -3605, -3052, -2002, -1255, -530, 439, 1148, 1457, 1869, 2040, 1053, -474, -944, -434, -247, -167, 1072, 2999, 3796, 3227, 2735, 2667, 1731, -359, -1871, -1695, -1048, -1166, -1393, -1155, -1442, -2674, -3740, -4423, -5771, -7321, -7343, -6076, -5358, -5402, -5150, -5004, -6114, -7892, -8765, -8552, -8103, -7378, -5575, -2777, -156, 1468, 2334, 2810, 2770, 2308, 2265, 3331, 5204, 7164, 8937, 10517, 11666, 12086, 11887, 11413, 10708, 9495, 7760, 6101, 5273, 5478, 6196, 6589, 6114, 4821, 3127, 1326, -591, -2599, -4329, -5246, -5124, -4366, -3789, -3977, -4794, -5634, -6191, -6811, -7873, -8920, -8902, -7483, -5501, -3793, -2362, -1130, -482, -501, -764, -1222, -1999, -2395, -1683, -544, -74, -45, 245, 444, 29, -505, -682, -921, -1488, -1848, -1682, -1311, -790, 201, 1336, 1594, 581, -905, -1970, -2696, -3698, -4991, -5907, -6046, -5687, -5151, -4358, -3338, -2635, -2627, -2900, -2888, -2691, -2553, -2140, -1179, -154, 426, 725, 948, 893, 691, 1030, 2068, 3006, 3320, 3607, 4471, 5303, 5087, 3957, 2839, 1882, 629, -562, -815, -203, 493, 1105, 1791, 2056, 1357, 42, -1187, -2038, -2412, -2332, -2096, -1695, -594, 1108, 2289, 2350, 1969, 1714, 1315, 777, 702, 1169, 1657, 2140, 3012, 4015, 4435, 4211, 3932, 3885, 3824, 3586, 3497, 3999, 4871, 5122, 4230, 3106, 2778, 2579, 1176, -985, -2222, -2268, -2385, -2990, -3207, -2678, -2161, -2221, -2659, -3227, -3999, -4991, -6013, -6897, -7451, -7245, -5987, -4253, -3230, -3425, -4105, -4348, -4002, -3475, -3179, -3213, -3123, -2258, -708, 839, 2267, 3830, 4921, 4833, 4409, 4898, 5773, 5828, 5437, 5622, 6196, 6630, 7156, 7640, 7233, 5979, 4836, 3964, 2982, 2404, 2779, 3331, 3195, 2889, 3117, 3391, 2937, 1758, 189, -1506, -2797, -3144, -2826, -2761, -3364, -4147, -4542, -4495, -4053, -3170, -2355, -2410, -2913, -2325, -368, 1414, 2105, 2487, 3128, 3534, 3659, 4170, 4947, 5156, 4821, 4742, 4966, 4790, 4142, 3602, 3046, 1675, -247, -1181, -537, 376, 553, 713, 1513, 2070, 1518, 434, -455, -1569, -3329, -4919, -5417, -5287, -5484, -5732, -5142, -4055, -3560, -3547, -3077, -2393, -2594, -3524, -3877, -3238, -2430, -2008, -1680, -1141, -481, 198, 868, 1266, 1169, 1001, 1435, 2295, 2696, 2424, 2156, 2204, 2159, 1976, 2206, 2861, 3067, 2366, 1475, 1146, 972, 233, -717, -1004, -556, 238, 1314, 2214, 1943, 673, -173, -371, -1147, -2500, -3029, -2665, -2651, -3001, -2792, -2239, -2054, -1885, -1287, -692, -117, 1158, 2908, 3979, 4182, 4288, 4410, 4145, 3755, 3693, 3635, 3160, 2685, 2716, 2833, 2333, 1394, 781, 591, 82, -1093, -2150, -2232, -1786, -1913, -2507, -2359, -1393, -1168, -2437, -3865, -4199, -4044, -4339, -4640, -4173, -3320, -2946, -3138, -3428, -3611, -3752, -3769, -3390, -2542, -1665, -1377, -1623, -1661, -1206, -903, -1183, -1515, -1434, -1285, -1304, -984, 20, 1244, 1986, 1896, 1150, 647, 1269, 2522, 3078, 2980, 3557, 4810, 4968, 3402, 1944, 2164, 2997, 2716, 1904, 2345, 3771, 4284, 3633, 3281, 3426, 2794, 1296, 172, -288, -744, -990, -299, 908, 1524, 1403, 1195, 998, 374, -520, -867, -384, 212, 346, 517, 1414, 2543, 2689, 1670, 602, 288, 379, 448, 761, 1430, 1830, 1587, 1297, 1484, 1586, 868, -220, -573, -22, 635, 1068, 1711, 2570, 2943, 2517, 1646, 472, -1073, -2370, -2475, -1576, -959, -1201, -1492, -1220, -1183, -2381, -4386, -5993, -6871, -7448, -7656, -7020, -5748, -4619, -3906, -3305, -2868, -3042, -3694, -4008, -3652, -3146, -2642, -1434, 664, 2553, 3186, 2802, 2171, 1497, 619, -309, -833, -586, 412, 1659, 2487, 2715, 2733, 2837, 2802, 2317, 1565, 1066, 1073, 1318, 1446, 1532, 1869, 2256, 2025, 1104, 399, 594, 1208, 1437, 1230, 904, 510, 150, 96, 171, -116, -548, -283, 855, 2025, 2511, 2490, 2487, 2563, 2296, 1354, -43, -1283, -1980, -2243, -2306, -2196, -1920, -1656, -1562, -1664, -1948, -2272, -2280, -1778, -1015, -225, 621, 1245, 993, -124, -1155, -1469, -1446, -1542, -1595, -1251, -393, 756, 1528, 1520, 1476, 2034, 2074, 500, -1269, -1441, -920, -1152, -1212, -261, 160, -757, -1385, -1245, -1971, -3419, -3527, -2425, -1940, -1703, -285, 1294, 1233, 148, -537, -1111, -2130, -2769, -2304, -1284, -327, 593, 1308, 1286, 560, -175, -459, -482, -537, -476, 72, 1054, 1889, 2226, 2347, 2370, 1715, 226, -956, -910, -471, -765, -1176, -562, 469, 437, -539, -1022, -587, -198, -348, -315, 445, 1373, 1838, 1965, 1849, 1163, 100, -618, -1017, -1561, -1739, -821, 411, 792, 747, 1183, 1604, 1219, 504, 110, -252, -751, -835, -352, 144, 444, 797, 1132, 1160, 791, -18, -1156, -2014, -2172, -2003, -1667, -562, 1111, 1833, 1076, 265, 271, 38, -1234, -2614, -2958, -2208, -969, -119, -402, -1304, -1352, -363, 107, -747, -1772, -1811, -1249, -944, -911, -754, -456, -161, 225, 700, 849, 384, -275, -509, -455, -823, -1732, -2430, -2396, -2071, -2061, -2259, -2343, -2564, -3205, -3775, -3653, -3153, -3040, -3262, -3086, -2303, -1497, -1090, -856, -513, -112, 349, 1010, 1579, 1497, 927, 746, 1208, 1612, 1645, 1976, 3010, 4061, 4477, 4781, 5759, 6999, 7351, 6628, 5831, 5604, 5528, 5154, 4807, 4854, 4976, 4753, 4406, 4289, 4063, 3197, 1996, 1258, 1110, 1051, 886, 721, 370, -353, -1058, -1269, -1149, -1202, -1617, -2213, -2628, -2578, -2235, -2097, -2208, -2103, -1686, -1348, -1149, -890, -822, -1202, -1457, -975, -190, 189, 328, 661, 968, 937, 867, 1051, 1138, 788, 480, 954, 2075, 2961, 3085, 2534, 1472, 301, -118, 320, 390, -525, -1218, -865, -540, -1056, -1584, -1698, -2227, -3113, -3095, -2089, -1313, -1008, -480, -43, -617, -1759, -2067, -1274, -504, -585, -1077, -1040, -304, 356, 353, 97, 166, 229, -272, -871, -728, -119, 28, -295, -399, -263, -407, -668, -335, 580, 1132, 659, -386, -983, -616, 349, 1173, 1369, 965, 345, -186, -662, -1066, -1120, -857, -693, -427, 573, 1620, 1111, -709, -1807, -1661, -1724, -2380, -2467, -1761, -1008, -2, 1622, 2703, 2025, 383, -748, -1274, -1780, -2129, -1925, -1377, -801, -52, 903, 1466, 1175, 542, 261, 45, -732, -1660, -1806, -1193, -513, 88, 759, 1096, 661, -183, -754, -848, -585, -57, 582, 1096, 1374, 1385, 1030, 296, -572, -1232, -1502, -1394, -1033, -600, -248, -16, 143, 144, -275, -1160, -2084, -2595, -2677, -2421, -1679, -573, 185, 146, -180, -85, 327, 419, -136, -1110, -1910, -1906, -999, 212, 1066, 1401, 1275, 702, -18, -308, -11, 369, 402, 284, 476, 1069, 1609, 1482, 561, -600, -1424, -1905, -2197, -2003, -997, 491, 1814, 2717, 3243, 3286, 2814, 2183, 1706, 1130, 129, -793, -694, 429, 1496, 1800, 1657, 1409, 974, 586, 667, 902, 681, 210, -12, -211, -636, -849, -659, -594, -762, -612, -165, -2, -52, 206, 706, 1145, 1615, 2037, 2029, 1849, 2080, 2379, 2141, 2003, 2882, 4210, 4827, 4792, 4776, 4664, 3984, 2785, 1350, -64, -964, -1020, -703, -662, -750, -547, -403, -1030, -2200, -2919, -2978, -3296, -4296, -5105, -5055, -4847, -5277, -5875, -5861, -5538, -5693, -6313, -6734, -6610, -6153, -5698, -5361, -5024, -4547, -3992, -3547, -3291, -3170, -3108, -2964, -2503, -1633, -553, 482, 1295, 1739, 1795, 1728, 1770, 1719, 1299, 847, 1110, 2332, 3964, 5316, 6121, 6398, 6175, 5601, 5050, 4780, 4618, 4320, 3989, 3865, 3947, 4064, 4101, 3940, 3479, 2863, 2380, 2161, 2193, 2365, 2287, 1575, 527, -31, 133, 324, -8, -441, -280, 374, 929, 1318, 1816, 2098, 1695, 1147, 1155, 1091, 147, -826, -735, -291, -508, -720, -164, 435, 512, 638, 834, 391, -295, -306, -241, -1178, -2470, -2929, -2902, -3245, -3718, -3865, -3959, -4185, -4284, -4357, -4739, -5157, -5131, -4905, -5041, -5489, -5721, -5414, -4688, -3958, -3690, -3957, -4291, -4204, -3751, -3292, -2867, -2208, -1373, -804, -594, -266, 344, 676, 427, 170, 461, 1065, 1612, 2263, 3195, 4101, 4672, 5005, 5250, 5275, 4960, 4526, 4345, 4566, 5046, 5566, 5986, 6141, 5812, 4968, 3991, 3413, 3388, 3516, 3316, 2837, 2630, 3040, 3656, 3673, 2788, 1566, 808, 719, 828, 700, 520, 752, 1297, 1449, 832, -74, -728, -1252, -1966, -2664, -2928, -2736, -2386, -2127, -2039, -1965, -1687, -1396, -1577, -2150, -2361, -1911, -1402, -1328, -1421, -1354, -1292, -1452, -1737, -2007, -2248, -2397, -2355, -2169, -1965, -1770, -1546, -1325, -1246, -1409, -1708, -1852, -1702, -1498, -1529, -1653, -1510, -1131, -978, -1281, -1734, -1987, -2097, -2280, -2452, -2354, -1998, -1629, -1315, -940, -539, -306, -282, -334, -405, -503, -483, -153, 435, 1013, 1423, 1727, 2010, 2247, 2390, 2508, 2690, 2843, 2787, 2642, 2789, 3179, 3196, 2643, 2221, 2412, 2711, 2616, 2429, 2430, 2403, 2395, 2722, 3089, 3004, 2723, 2529, 1974, 1003, 469, 542, 384, 10, 306, 1020, 1056, 625, 758, 1174, 835, -6, -335, -218, -417, -809, -613, 183, 758, 694, 384, 123, -339, -1082, -1699, -2034, -2359, -2645, -2563, -2230, -2045, -1975, -1831, -1759, -1722, -1284, -514, -138, -363, -578, -422, -137, 97, 242, 97, -300, -476, -288, -233, -605, -1063, -1250, -1156, -835, -421, -303, -704, -1330, -1772, -1929, -1787, -1254, -463, 137, 310, 357, 601, 823, 690, 443, 547, 854, 913, 893, 1266, 1842, 2052, 1894, 1749, 1629, 1369, 1147, 1163, 1294, 1436, 1684, 1992, 2130, 2030, 1807, 1549, 1354, 1312, 1293, 1069, 716, 504, 458, 415, 329, 160, -259, -891, -1363, -1491, -1525, -1644, -1639, -1360, -1111, -1242, -1650, -1960, -2069, -2169, -2303, -2249, -1936, -1666, -1697, -1843, -1777, -1589, -1637, -1925, -2129, -2184, -2369, -2701, -2795, -2444, -1923, -1541, -1297, -1117, -1078, -1183, -1199, -1031, -970, -1200, -1402, -1286, -1108, -1140, -1136, -869, -646, -720, -808, -664, -486, -449, -453, -503, -742, -1022, -1027, -845, -905, -1305, -1610, -1419, -847, -310, -18, 136, 281, 366, 300, 101, -153, -393, -510, -401, -157, -25, -57, -56, 71, 192, 311, 627, 1064, 1232, 1014, 776, 772, 789, 640, 588, 883, 1210, 1039, 449, 83, 280, 709, 936, 917, 793, 575, 260, -7, -134, -230, -349, -322, -104, -11, -245, -482, -373, -170, -352, -800, -937, -614, -313, -353, -436, -249, -4, 11, -10, 219, 564, 726, 671, 470, 180, -42, -155, -393, -729, -696, -255, -61, -345, -492, -197, 41, -46, -81, 79, 53, -294, -676, -977, -1324, -1625, -1606, -1265, -920, -824, -929, -1029, -1009, -911, -845, -847, -832, -656, -248, 271, 712, 1010, 1262, 1577, 1962, 2338, 2565, 2535, 2308, 2125, 2201, 2515, 2869, 3116, 3290, 3491, 3747, 4026, 4304, 4556, 4709, 4689, 4498, 4233, 4022, 3929, 3858, 3629, 3200, 2777, 2589, 2648, 2739, 2620, 2266, 2012, 2217, 2681, 2785, 2380, 1934, 1677, 1420, 1253, 1440, 1669, 1490, 1280, 1642, 2228, 2271, 1805, 1323, 898, 460, 292, 545, 852, 847, 567, 179, -236, -586, -813, -978, -1134, -1245, -1324, -1421, -1451, -1318, -1131, -1100, -1264, -1528, -1821, -2096, -2342, -2617, -2885, -2928, -2700, -2481, -2453, -2442, -2384, -2515, -2881, -3196, -3398, -3700, -3976, -3819, -3282, -2909, -2896, -2807, -2323, -1758, -1524, -1500, -1336, -1061, -893, -763, -572, -525, -690, -738, -521, -327, -253, -49, 249, 357, 317, 319, 207, -140, -414, -474, -719, -1289, -1662, -1519, -1337, -1580, -1945, -1924, -1688, -1803, -2305, -2670, -2677, -2721, -3119, -3596, -3757, -3669, -3557, -3301, -2701, -2029, -1705, -1585, -1157, -438, 27, 117, 345, 1032, 1851, 2429, 2873, 3532, 4486, 5588, 6721, 7833, 8820, 9597, 10297, 11191, 12266, 13123, 13476, 13600, 13980, 14668, 15372, 16012, 16711, 17421, 17923, 18174, 18242, 18115, 17870, 17696, 17569, 17238, 16640, 15964, 15335, 14784, 14359, 13928, 13178, 12092, 11033, 10168, 9228, 8072, 6925, 5933, 4919, 3733, 2441, 1208, 161, -700, -1589, -2719, -4010, -5238, -6345, -7322, -8086, -8764, -9689, -10818, -11649, -11967, -12190, -12637, -13050, -13149, -13188, -13555, -14153, -14608, -14879, -15253, -15776, -16102, -15983, -15608, -15262, -14995, -14746, -14594, -14591, -14539, -14215, -13733, -13418, -13322, -13175, -12811, -12379, -12079, -11886, -11708, -11604, -11622, -11601, -11336, -10876, -10406, -9962, -9536, -9281, -9270, -9252, -8969, -8572, -8366, -8344, -8250, -7969, -7603, -7225, -6824, -6432, -6144, -5958, -5766, -5524, -5294, -5073, -4793, -4468, -4149, -3789, -3337, -2911, -2624, -2434, -2296, -2248, -2209, -1967, -1506, -1117, -985, -935, -727, -445, -320, -327, -261, -153, -241, -530, -749, -753, -643, -527, -467, -573, -873, -1148, -1183, -1129, -1341, -1880, -2439, -2824, -3157, -3499, -3687, -3722, -3843, -4062, -4205, -4411, -4934, -5507, -5631, -5479, -5663, -6210, -6499, -6243, -5816, -5588, -5486, -5351, -5264, -5291, -5197, -4763, -4217, -4008, -4129, -4079, -3584, -3006, -2785, -2787, -2516, -1862, -1248, -965, -737, -246, 257, 363, 267, 539, 1214, 1787, 2059, 2345, 2841, 3353, 3728, 4069, 4468, 4854, 5143, 5333, 5429, 5451, 5520, 5798, 6257, 6617, 6636, 6421, 6308, 6473, 6746, 6849, 6709, 6532, 6495, 6503, 6381, 6233, 6233, 6178, 5726, 5055, 4685, 4653, 4447, 3836, 3138, 2680, 2421, 2152, 1755, 1273, 884, 674, 521, 403, 500, 738, 716, 383, 166, 132, -152, -676, -853, -568, -458, -835, -1215, -1167, -871, -609, -268, 360, 1132, 1674, 1877, 2053, 2451, 2795, 2686, 2332, 2274, 2490, 2512, 2389, 2631, 3153, 3313, 3049, 3016, 3447, 3781, 3582, 3131, 2916, 3003, 3068, 2862, 2529, 2447, 2740, 3123, 3323, 3372, 3409, 3472, 3610, 3837, 3970, 3844, 3659, 3689, 3828, 3830, 3819, 4087, 4543, 4824, 4871, 4977, 5303, 5673, 5907, 6063, 6198, 6197, 5999, 5869, 6122, 6658, 7051, 7122, 7163, 7499, 8039, 8419, 8464, 8325, 8202, 8118, 7983, 7747, 7401, 6983, 6686, 6716, 6962, 7069, 6983, 7038, 7297, 7293, 6701, 5847, 5232, 4902, 4516, 3825, 2886, 1970, 1328, 959, 638, 160, -454, -1078, -1650, -2144, -2484, -2674, -2971, -3635, -4514, -5162, -5407, -5502, -5623, -5549, -5064, -4398, -3918, -3563, -3017, -2312, -1755, -1285, -567, 353, 1229, 2237, 3675, 5215, 6376, 7381, 8803, 10574, 12138, 13360, 14608, 16059, 17478, 18626, 19589, 20650, 21955, 23326, 24467, 25217, 25671, 26011, 26376, 26805, 27196, 27398, 27369, 27229, 27084, 26905, 26598, 26104, 25383, 24429, 23359, 22373, 21512, 20548, 19293, 17819, 16367, 14966, 13457, 11820, 10251, 8848, 7455, 5902, 4225, 2584, 1051, -402, -1854, -3363, -4855, -6217, -7421, -8582, -9806, -11045, -12184, -13209, -14187, -15065, -15765, -16371, -17055, -17770, -18284, -18556, -18780, -19076, -19399, -19673, -19846, -19841, -19648, -19429, -19349, -19376, -19359, -19237, -19091, -18939, -18727, -18460, -18247, -18136, -18035, -17882, -17708, -17529, -17323, -17142, -17087, -17144, -17209, -17212, -17145, -17021, -16907, -16924, -17110, -17325, -17364, -17197, -17008, -16975, -17071, -17115, -16934, -16539, -16149, -16006, -16039, -15894, -15444, -14972, -14698, -14435, -14002, -13572, -13284, -12966, -12431, -11776, -11147, -10521, -9898, -9414, -9071, -8561, -7683, -6756, -6206, -5925, -5521, -4968, -4522, -4181, -3810, -3507, -3342, -3136, -2844, -2696, -2701, -2632, -2523, -2613, -2783, -2732, -2599, -2832, -3458, -4053, -4368, -4620, -5069, -5697, -6364, -7025, -7646, -8187, -8758, -9496, -10189, -10539, -10775, -11438, -12498, -13332, -13674, -13919, -14446, -15150, -15757, -16128, -16271, -16277, -16310, -16449, -16585, -16558, -16397, -16276, -16203, -16002, -15583, -15073, -14590, -14098, -13557, -12952, -12191, -11189, -10087, -9143, -8405, -7645, -6619, -5352, -4054, -2958, -2185, -1616, -854, 397, 1850, 2981, 3839, 4968, 6391, 7509, 8136, 8776, 9722, 10650, 11242, 11583, 11853, 12164, 12608, 13096, 13334, 13203, 13017, 13112, 13356, 13405, 13219, 13021, 12779, 12271, 11619, 11150, 10732, 9990, 9055, 8323, 7707, 6910, 6154, 5761, 5416, 4658, 3665, 2927, 2471, 1989, 1401, 838, 283, -397, -1149, -1685, -1833, -1789, -1888, -2195, -2461, -2460, -2266, -2145, -2217, -2281, -2126, -1858, -1687, -1511, -1120, -663, -435, -289, 175, 913, 1456, 1666, 1905, 2404, 2889, 3052, 3051, 3282, 3798, 4251, 4417, 4511, 4814, 5241, 5546, 5758, 6043, 6278, 6222, 5980, 5874, 5907, 5816, 5532, 5215, 4900, 4516, 4170, 4065, 4156, 4151, 3915, 3643, 3555, 3569, 3410, 2995, 2516, 2210, 2103, 2022, 1820, 1582, 1545, 1766, 2025, 2155, 2305, 2703, 3271, 3688, 3827, 3894, 4122, 4467, 4755, 4951, 5161, 5478, 5912, 6394, 6778, 6991, 7159, 7428, 7711, 7811, 7753, 7762, 7883, 7922, 7808, 7772, 7971, 8166, 8058, 7722, 7415, 7155, 6817, 6433, 6069, 5600, 4929, 4242, 3789, 3591, 3519, 3496, 3488, 3427, 3256, 2978, 2667, 2411, 2212, 1962, 1576, 1159, 941, 995, 1118, 1119, 1117, 1349, 1776, 2104, 2219, 2292, 2415, 2432, 2289, 2249, 2544, 2982, 3200, 3188, 3298, 3723, 4302, 4849, 5350, 5788, 6059, 6172, 6324, 6643, 7002, 7182, 7125, 6985, 6955, 7133, 7490, 7903, 8199, 8263, 8171, 8126, 8209, 8220, 7890, 7236, 6618, 6307, 6074, 5500, 4657, 4109, 4100, 4167, 3811, 3142, 2595, 2270, 1884, 1224, 381, -465, -1282, -2179, -3192, -4164, -4876, -5285, -5531, -5766, -5987, -6055, -5804, -5198, -4402, -3673, -3173, -2825, -2406, -1808, -1078, -235, 832, 2174, 3625, 5023, 6496, 8283, 10385, 12474, 14258, 15773, 17272, 18901, 20562, 22102, 23482, 24750, 25890, 26849, 27648, 28404, 29125, 29658, 29852, 29789, 29711, 29691, 29616, 29417, 29198, 29035, 28771, 28222, 27412, 26519, 25570, 24423, 23038, 21538, 19978, 18247, 16383, 14571, 12862, 11057, 9056, 7032, 5181, 3496, 1856, 267, -1222, -2658, -4201, -5923, -7624, -9035, -10232, -11540, -13030, -14353, -15345, -16239, -17153, -17842, -18163, -18352, -18595, -18755, -18689, -18462, -18224, -18062, -18002, -17977, -17830, -17511, -17142, -16834, -16495, -16005, -15449, -14948, -14354, -13475, -12531, -11895, -11458, -10834, -10116, -9734, -9649, -9433, -9071, -8921, -8989, -8902, -8548, -8245, -8196, -8215, -8057, -7776, -7607, -7604, -7609, -7533, -7500, -7594, -7668, -7626, -7640, -7891, -8181, -8183, -7960, -7901, -8123, -8265, -8000, -7508, -7247, -7348, -7464, -7249, -6828, -6578, -6558, -6455, -6097, -5702, -5501, -5393, -5159, -4850, -4674, -4646, -4583, -4435, -4377, -4532, -4764, -4874, -4837, -4774, -4777, -4912, -5233, -5744, -6370, -7016, -7602, -8168, -8858, -9745, -10662, -11436, -12163, -12986, -13791, -14429, -15059, -15886, -16780, -17482, -18074, -18848, -19861, -20858, -21656, -22322, -22973, -23587, -24056, -24360, -24522, -24517, -24307, -23952, -23605, -23339, -23114, -22857, -22537, -22157, -21699, -21136, -20450, -19649, -18723, -17672, -16570, -15524, -14497, -13341, -12073, -10887, -9916, -9067, -8259, -7516, -6800, -6027, -5224, -4429, -3539, -2485, -1489, -778, -227, 461, 1300, 2020, 2495, 2853, 3187, 3417, 3513, 3562, 3543, 3373, 3253, 3490, 3928, 4066, 3834, 3684, 3846, 3994, 3814, 3406, 2997, 2604, 2162, 1742, 1446, 1235, 1030, 867, 779, 646, 373, 97, 7, 27, -97, -441, -791, -883, -705, -523, -601, -864, -975, -764, -427, -253, -281, -328, -203, 126, 491, 693, 767, 925, 1193, 1368, 1399, 1509, 1830, 2216, 2508, 2740, 2968, 3138, 3226, 3346, 3550, 3708, 3759, 3891, 4249, 4664, 4985, 5373, 5926, 6370, 6525, 6671, 7034, 7346, 7330, 7222, 7394, 7775, 8011, 8044, 8134, 8393, 8690, 8949, 9264, 9596, 9777, 9841, 9997, 10225, 10236, 9968, 9740, 9795, 9938, 9889, 9712, 9656, 9702, 9641, 9485, 9473, 9635, 9665, 9366, 8931, 8637, 8467, 8232, 7929, 7709, 7575, 7356, 6991, 6632, 6411, 6252, 5966, 5491, 5001, 4737, 4671, 4490, 4029, 3511, 3195, 2999, 2729, 2414, 2174, 1904, 1440, 941, 728, 716, 472, -78, -466, -425, -288, -372, -441, -171, 255, 460, 467, 615, 994, 1379, 1629, 1855, 2186, 2587, 3025, 3551, 4145, 4694, 5175, 5682, 6253, 6829, 7354, 7795, 8111, 8308, 8482, 8672, 8772, 8687, 8513, 8438, 8502, 8530, 8375, 8149, 8067, 8057, 7798, 7243, 6753, 6487, 6061, 5181, 4199, 3597, 3278, 2806, 2121, 1545, 1224, 954, 534, 39, -337, -577, -853, -1325, -1948, -2427, -2452, -2075, -1775, -1919, -2248, -2202, -1635, -965, -665, -822, -1118, -1175, -1039, -1097, -1360, -1230, -385, 621, 1136, 1241, 1377, 1657, 1923, 1985, 1647, 1005, 618, 840, 1239, 1235, 1011, 1155, 1665, 1953, 1723, 1293, 1020, 858, 645, 393, 123, -216, -481, -477, -456, -886, -1683, -2315, -2637, -2919, -3179, -3202, -3090, -3127, -3289, -3326, -3160, -2934, -2835, -2995, -3341, -3592, -3582, -3489, -3574, -3839, -4145, -4395, -4539, -4538, -4400, -4083, -3379, -2133, -476, 1282, 3005, 4707, 6317, 7660, 8669, 9537, 10510, 11648, 12834, 13985, 15231, 16826, 18890, 21268, 23595, 25550, 27069, 28278, 29308, 30101, 30564, 30717, 30691, 30604, 30478, 30332, 30240, 30261, 30280, 30097, 29657, 29082, 28435, 27588, 26447, 25012, 23329, 21488, 19668, 17846, 15754, 13390, 11214, 9362, 7344, 4891, 2479, 535, -1232, -3250, -5397, -7340, -9071, -10756, -12361, -13733, -14864, -15864, -16731, -17431, -18068, -18727, -19269, -19559, -19723, -19896, -19950, -19732, -19296, -18650, -17677, -16457, -15264, -14128, -12879, -11562, -10438, -9547, -8661, -7703, -6806, -5994, -5068, -3940, -2822, -1888, -990, 137, 1432, 2570, 3364, 3908, 4418, 4957, 5300, 5137, 4562, 4071, 3896, 3645, 2983, 2276, 2088, 2328, 2381, 2012, 1615, 1537, 1541, 1187, 448, -337, -995, -1674, -2499, -3344, -4025, -4555, -5084, -5645, -6102, -6331, -6387, -6428, -6532, -6670, -6816, -7005, -7269, -7606, -8020, -8530, -9099, -9642, -10074, -10396, -10682, -10984, -11293, -11562, -11789, -12026, -12302, -12615, -12983, -13426, -13897, -14300, -14634, -15006, -15489, -15987, -16393, -16771, -17270, -17846, -18310, -18628, -18929, -19173, -19185, -19023, -18955, -19035, -19014, -18812, -18626, -18603, -18599, -18475, -18354, -18315, -18157, -17699, -17131, -16703, -16282, -15611, -14770, -13977, -13213, -12406, -11667, -11074, -10470, -9760, -9090, -8593, -8168, -7685, -7134, -6532, -5843, -5093, -4401, -3780, -3083, -2317, -1752, -1492, -1251, -867, -611, -667, -781, -727, -719, -978, -1349, -1586, -1707, -1828, -1931, -1990, -2084, -2273, -2482, -2653, -2887, -3299, -3815, -4312, -4831, -5442, -6062, -6597, -7055, -7406, -7607, -7792, -8111, -8395, -8419, -8346, -8483, -8751, -8866, -8834, -8887, -9029, -9061, -8961, -8888, -8867, -8719, -8386, -8026, -7691, -7247, -6688, -6185, -5741, -5175, -4504, -3915, -3393, -2785, -2154, -1689, -1328, -858, -271, 293, 832, 1451, 2098, 2604, 2989, 3438, 3966, 4373, 4614, 4898, 5276, 5520, 5525, 5539, 5778, 6093, 6213, 6150, 6109, 6166, 6251, 6339, 6417, 6359, 6136, 6013, 6193, 6466, 6518, 6431, 6475, 6635, 6697, 6668, 6739, 6879, 6858, 6654, 6536, 6659, 6872, 7058, 7326, 7699, 7922, 7833, 7625, 7556, 7569, 7438, 7129, 6843, 6732, 6742, 6700, 6493, 6170, 5914, 5870, 5985, 6038, 5913, 5713, 5552, 5425, 5316, 5231, 5057, 4671, 4230, 4055, 4171, 4283, 4279, 4421, 4885, 5385, 5568, 5558, 5714, 6016, 6118, 5957, 5850, 5985, 6218, 6403, 6588, 6838, 7092, 7293, 7481, 7693, 7866, 7903, 7794, 7636, 7539, 7514, 7468, 7305, 7036, 6797, 6713, 6728, 6657, 6423, 6202, 6145, 6089, 5789, 5356, 5086, 4928, 4580, 4070, 3747, 3708, 3666, 3445, 3176, 3000, 2884, 2724, 2487, 2216, 1978, 1795, 1610, 1375, 1172, 1148, 1338, 1591, 1700, 1613, 1483, 1500, 1674, 1830, 1796, 1610, 1467, 1456, 1438, 1321, 1308, 1620, 2105, 2435, 2565, 2668, 2784, 2843, 2844, 2757, 2508, 2246, 2235, 2418, 2465, 2330, 2311, 2516, 2703, 2648, 2395, 2107, 1909, 1820, 1734, 1499, 1107, 762, 628, 592, 415, 98, -124, -171, -243, -465, -659, -651, -591, -750, -1100, -1300, -1147, -865, -818, -992, -979, -561, -40, 167, 116, 175, 465, 715, 673, 430, 267, 367, 699, 1109, 1467, 1769, 2111, 2506, 2763, 2690, 2403, 2221, 2222, 2125, 1687, 1036, 526, 388, 586, 874, 956, 713, 371, 269, 398, 333, -191, -928, -1569, -2229, -3069, -3818, -4102, -4056, -4136, -4480, -4788, -4774, -4492, -4248, -4265, -4449, -4517, -4359, -4221, -4403, -4828, -5103, -5066, -5018, -5242, -5515, -5401, -4881, -4321, -3888, -3251, -1985, -54, 2187, 4348, 6329, 8255, 10237, 12135, 13691, 14836, 15781, 16839, 18140, 19605, 21152, 22806, 24595, 26457, 28243, 29775, 30951, 31749, 32210, 32333, 32107, 31632, 31075, 30502, 29825, 29009, 28189, 27470, 26659, 25417, 23713, 21920, 20321, 18711, 16658, 14051, 11309, 8869, 6635, 4063, 1014, -1842, -3901, -5542, -7546, -9825, -11504, -12273, -12881, -14033, -15444, -16370, -16638, -16769, -17149, -17553, -17565, -17144, -16569, -16029, -15427, -14608, -13612, -12667, -11888, -11081, -9926, -8382, -6754, -5339, -4093, -2782, -1331, 50, 1129, 1901, 2509, 3039, 3445, 3678, 3780, 3873, 4049, 4308, 4582, 4827, 5073, 5350, 5618, 5788, 5803, 5665, 5396, 4948, 4212, 3199, 2153, 1297, 581, -100, -596, -727, -625, -521, -383, -157, -89, -412, -975, -1510, -2079, -2906, -3937, -4902, -5715, -6497, -7244, -7789, -8144, -8548, -9057, -9488, -9794, -10171, -10710, -11302, -11935, -12732, -13691, -14629, -15462, -16282, -17131, -17864, -18329, -18522, -18533, -18395, -18141, -17834, -17491, -17094, -16733, -16523, -16340, -15952, -15373, -14809, -14288, -13627, -12802, -12005, -11300, -10504, -9502, -8475, -7620, -6855, -6021, -5188, -4513, -3956, -3412, -2971, -2756, -2732, -2813, -2977, -3196, -3436, -3748, -4114, -4384, -4572, -4909, -5410, -5823, -6125, -6589, -7231, -7773, -8156, -8615, -9214, -9781, -10289, -10848, -11428, -11854, -12052, -12082, -11955, -11651, -11245, -10871, -10552, -10192, -9781, -9427, -9165, -8925, -8716, -8579, -8439, -8197, -7910, -7598, -7121, -6498, -6009, -5790, -5603, -5268, -4940, -4802, -4784, -4783, -4882, -5182, -5588, -5930, -6190, -6510, -6972, -7434, -7695, -7754, -7783, -7844, -7840, -7741, -7658, -7622, -7516, -7318, -7164, -7112, -7061, -6926, -6716, -6396, -5900, -5293, -4743, -4274, -3709, -2956, -2186, -1591, -1109, -559, 28, 456, 674, 856, 1135, 1403, 1477, 1363, 1262, 1326, 1470, 1477, 1275, 1063, 1094, 1331, 1430, 1187, 832, 679, 686, 622, 442, 232, -13, -255, -286, -29, 273, 417, 581, 1036, 1670, 2149, 2445, 2849, 3420, 3865, 4056, 4265, 4686, 5121, 5306, 5261, 5173, 5203, 5451, 5890, 6315, 6506, 6426, 6205, 6013, 5971, 6030, 5957, 5601, 5087, 4655, 4379, 4171, 3936, 3675, 3526, 3659, 3994, 4229, 4295, 4503, 4965, 5291, 5200, 5081, 5448, 6153, 6590, 6588, 6628, 7136, 7920, 8514, 8804, 9036, 9389, 9787, 10076, 10224, 10332, 10514, 10722, 10760, 10553, 10264, 10071, 9922, 9662, 9244, 8737, 8240, 7833, 7456, 6956, 6326, 5779, 5471, 5295, 5066, 4707, 4210, 3636, 3124, 2693, 2196, 1675, 1478, 1734, 2048, 2033, 1855, 1920, 2258, 2581, 2750, 2903, 3156, 3478, 3819, 4173, 4467, 4640, 4833, 5215, 5642, 5795, 5686, 5682, 5958, 6267, 6348, 6285, 6284, 6306, 6135, 5747, 5379, 5199, 5063, 4777, 4443, 4297, 4318, 4259, 4048, 3832, 3641, 3382, 3091, 2899, 2775, 2622, 2484, 2433, 2427, 2460, 2650, 2977, 3194, 3130, 2913, 2793, 2870, 3089, 3331, 3457, 3387, 3220, 3212, 3420, 3555, 3322, 2855, 2552, 2513, 2430, 2065, 1565, 1208, 974, 579, -75, -699, -987, -1085, -1466, -2297, -3119, -3366, -3153, -3184, -3771, -4314, -4165, -3621, -3542, -4088, -4493, -4128, -3307, -2769, -2661, -2421, -1616, -548, 125, 191, 161, 671, 1656, 2319, 2183, 1871, 2349, 3595, 4705, 5135, 5154, 5136, 5058, 4771, 4285, 3760, 3416, 3359, 3328, 2871, 1932, 1067, 780, 829, 570, -110, -692, -913, -1220, -2005, -2870, -3147, -2936, -3054, -3929, -5016, -5526, -5444, -5423, -5811, -6187, -5980, -5256, -4613, -4417, -4441, -4287, -3948, -3824, -4167, -4578, -4359, -3527, -3032, -3588, -4750, -5685, -6280, -6843, -7224, -6996, -6168, -5120, -4034, -2804, -1322, 403, 2249, 3869, 4855, 5233, 5623, 6630, 8144, 9690, 11237, 13174, 15541, 17911, 19990, 21911, 23802, 25486, 26705, 27429, 27850, 28183, 28509, 28726, 28660, 28266, 27679, 27048, 26361, 25534, 24548, 23441, 22109, 20361, 18222, 15986, 13889, 11811, 9537, 7165, 4938, 2832, 655, -1511, -3426, -5143, -6884, -8561, -9939, -11097, -12313, -13475, -14164, -14291, -14234, -14262, -14178, -13718, -13020, -12411, -11920, -11298, -10413, -9387, -8323, -7149, -5791, -4280, -2705, -1145, 281, 1444, 2375, 3267, 4200, 5018, 5528, 5755, 5887, 6076, 6307, 6436, 6372, 6236, 6204, 6195, 5951, 5464, 5022, 4754, 4391, 3684, 2780, 1992, 1335, 584, -293, -1074, -1643, -2133, -2614, -2937, -3017, -2993, -3026, -3101, -3156, -3247, -3489, -3856, -4187, -4371, -4502, -4763, -5144, -5478, -5725, -6053, -6533, -6984, -7247, -7451, -7823, -8339, -8774, -9039, -9288, -9668, -10141, -10643, -11209, -11846, -12427, -12828, -13054, -13152, -13098, -12899, -12628, -12328, -11918, -11339, -10733, -10283, -9951, -9484, -8762, -7948, -7253, -6674, -6064, -5361, -4621, -3894, -3159, -2432, -1835, -1479, -1272, -995, -598, -282, -249, -496, -930, -1526, -2281, -3119, -3956, -4784, -5622, -6467, -7318, -8208, -9149, -10104, -11037, -11919, -12723, -13405, -13972, -14516, -15120, -15775, -16380, -16817, -16981, -16872, -16634, -16385, -16050, -15514, -14843, -14190, -13498, -12582, -11486, -10489, -9679, -8830, -7843, -7010, -6560, -6157, -5329, -4198, -3337, -3002, -2907, -2723, -2449, -2238, -2152, -2147, -2170, -2225, -2376, -2669, -3059, -3436, -3756, -4095, -4539, -5024, -5419, -5711, -6012, -6356, -6631, -6699, -6538, -6264, -6057, -5979, -5882, -5617, -5274, -5020, -4799, -4468, -4100, -3840, -3643, -3343, -2910, -2434, -2014, -1737, -1583, -1384, -1049, -783, -823, -1027, -1013, -711, -490, -631, -968, -1229, -1479, -1907, -2375, -2553, -2407, -2222, -2168, -2157, -2054, -1858, -1641, -1445, -1239, -982, -712, -490, -234, 194, 746, 1286, 1851, 2509, 3114, 3563, 4101, 4912, 5715, 6205, 6584, 7162, 7719, 7789, 7429, 7210, 7399, 7571, 7241, 6585, 6241, 6459, 6783, 6619, 5940, 5301, 5138, 5174, 4781, 3944, 3301, 3096, 2832, 2258, 1839, 1901, 2151, 2331, 2518, 2703, 2814, 3074, 3656, 4251, 4572, 4864, 5385, 5958, 6382, 6840, 7493, 8145, 8608, 9065, 9668, 10105, 10118, 10105, 10506, 10937, 10818, 10442, 10419, 10516, 10193, 9674, 9420, 9200, 8650, 8046, 7712, 7387, 6767, 6074, 5562, 5013, 4190, 3410, 3141, 3229, 3053, 2406, 1752, 1532, 1665, 1815, 1732, 1388, 1073, 1178, 1670, 2085, 2219, 2420, 2996, 3750, 4303, 4555, 4672, 4845, 5157, 5558, 5908, 6132, 6320, 6594, 6906, 7056, 6968, 6789, 6651, 6522, 6357, 6212, 6057, 5731, 5193, 4643, 4258, 3965, 3562, 2972, 2362, 1988, 1883, 1749, 1331, 822, 629, 743, 698, 232, -315, -437, -111, 210, 209, 99, 319, 925, 1501, 1688, 1581, 1477, 1494, 1552, 1614, 1729, 1949, 2287, 2661, 2870, 2781, 2542, 2440, 2521, 2515, 2216, 1767, 1427, 1239, 1128, 1121, 1176, 1027, 564, 145, 136, 354, 353, 39, -300, -467, -530, -660, -955, -1375, -1734, -1843, -1725, -1619, -1680, -1781, -1701, -1507, -1532, -1902, -2277, -2275, -2017, -1970, -2250, -2461, -2268, -1812, -1448, -1339, -1416, -1550, -1619, -1587, -1560, -1640, -1742, -1683, -1440, -1188, -1010, -785, -463, -213, -155, -163, -133, -160, -267, -244, 9, 226, 156, -6, 116, 506, 736, 551, 182, -7, 15, 17, -135, -359, -539, -663, -793, -969, -1166, -1295, -1304, -1341, -1655, -2184, -2442, -2123, -1665, -1817, -2681, -3567, -3867, -3709, -3647, -3936, -4340, -4624, -5021, -5976, -7482, -9002, -10159, -11211, -12569, -14129, -15316, -15620, -14979, -13716, -12283, -10924, -9630, -8397, -7427, -6838, -6295, -5249, -3546, -1571, 361, 2504, 5302, 8724, 12226, 15344, 18009, 20370, 22517, 24450, 26171, 27666, 28914, 29864, 30458, 30710, 30745, 30701, 30613, 30356, 29747, 28692, 27314, 25814, 24159, 22170, 19917, 17712, 15512, 12925, 9967, 7207, 4903, 2654, 114, -2527, -4925, -6937, -8568, -9941, -11252, -12451, -13220, -13419, -13320, -13145, -12756, -11949, -10878, -9898, -9167, -8496, -7615, -6459, -5185, -3986, -2860, -1561, 123, 1959, 3437, 4422, 5288, 6236, 6972, 7277, 7325, 7298, 7155, 6899, 6589, 6171, 5688, 5378, 5206, 4738, 3809, 2846, 2202, 1691, 1068, 476, 112, -161, -586, -1125, -1549, -1789, -1941, -2011, -1944, -1803, -1614, -1211, -522, 191, 707, 1154, 1685, 2185, 2512, 2685, 2686, 2483, 2196, 1925, 1514, 854, 142, -465, -1168, -2151, -3209, -4046, -4684, -5358, -6140, -6947, -7811, -8850, -9992, -11003, -11801, -12498, -13121, -13585, -13872, -13938, -13649, -13053, -12446, -11877, -11089, -10079, -9183, -8436, -7474, -6200, -4959, -3933, -2908, -1738, -581, 415, 1329, 2232, 2976, 3440, 3736, 3998, 4163, 4193, 4193, 4066, 3451, 2280, 968, -190, -1358, -2741, -4257, -5750, -7170, -8524, -9870, -11262, -12577, -13606, -14424, -15337, -16392, -17228, -17596, -17672, -17819, -18129, -18355, -18214, -17682, -16990, -16305, -15538, -14508, -13216, -11837, -10483, -9135, -7774, -6477, -5304, -4231, -3278, -2554, -2054, -1568, -985, -499, -281, -254, -340, -613, -1030, -1395, -1708, -2170, -2778, -3323, -3800, -4417, -5237, -6106, -6895, -7595, -8305, -9105, -9866, -10258, -10181, -10000, -10036, -10090, -9780, -9169, -8673, -8447, -8206, -7706, -7054, -6458, -5913, -5361, -4852, -4365, -3812, -3311, -3026, -2756, -2251, -1772, -1699, -1805, -1644, -1322, -1193, -1225, -1265, -1437, -1824, -2205, -2481, -2906, -3570, -4104, -4212, -4153, -4289, -4440, -4248, -3903, -3858, -4020, -3970, -3748, -3639, -3505, -3108, -2679, -2446, -2103, -1366, -600, -255, -113, 399, 1391, 2411, 3088, 3502, 3940, 4563, 5303, 5871, 5907, 5449, 5112, 5403, 6006, 6233, 5981, 5775, 5968, 6296, 6215, 5475, 4421, 3708, 3561, 3471, 2846, 1798, 1002, 832, 962, 819, 225, -485, -868, -795, -501, -311, -381, -607, -713, -487, -9, 418, 673, 1072, 1980, 3229, 4179, 4517, 4725, 5462, 6649, 7519, 7618, 7310, 7269, 7776, 8591, 9246, 9494, 9574, 9905, 10433, 10604, 10126, 9382, 8876, 8626, 8299, 7735, 7161, 6934, 7096, 7216, 6835, 6039, 5369, 5115, 4978, 4567, 3967, 3568, 3493, 3536, 3570, 3675, 3814, 3838, 3825, 4043, 4502, 4910, 5145, 5396, 5767, 6076, 6177, 6212, 6369, 6592, 6724, 6828, 7124, 7596, 7922, 7869, 7549, 7204, 6871, 6467, 6042, 5777, 5679, 5523, 5151, 4718, 4471, 4397, 4233, 3825, 3300, 2861, 2553, 2322, 2188, 2214, 2358, 2494, 2585, 2741, 3037, 3361, 3544, 3633, 3835, 4156, 4357, 4376, 4504, 4921, 5354, 5471, 5410, 5534, 5858, 6023, 5858, 5598, 5475, 5382, 5106, 4705, 4399, 4222, 3997, 3601, 3094, 2587, 2148, 1815, 1561, 1240, 721, 87, -393, -590, -720, -1061, -1516, -1716, -1617, -1598, -1835, -1997, -1810, -1514, -1448, -1555, -1568, -1383, -1030, -590, -190, 100, 420, 945, 1575, 2041, 2283, 2515, 2851, 3100, 3113, 3023, 2978, 2917, 2827, 2836, 2873, 2699, 2385, 2222, 2134, 1783, 1218, 790, 503, 53, -595, -1195, -1695, -2289, -3032, -3745, -4303, -4785, -5285, -5720, -5954, -5998, -5982, -6044, -6237, -6418, -6347, -6103, -6122, -6519, -6765, -6480, -6013, -5774, -5566, -5046, -4330, -3713, -3288, -3018, -2792, -2351, -1608, -912, -601, -492, -180, 356, 750, 731, 402, 57, -95, -58, -7, -133, -390, -473, -222, 69, 51, -208, -528, -1029, -1749, -2332, -2583, -2833, -3300, -3718, -3904, -4029, -4127, -4003, -3746, -3664, -3697, -3501, -3142, -3079, -3382, -3554, -3356, -3226, -3470, -3633, -3273, -2756, -2599, -2590, -2258, -1692, -1259, -1018, -871, -883, -1074, -1315, -1615, -2188, -3153, -4396, -5821, -7512, -9568, -11918, -14318, -16466, -18007, -18650, -18413, -17636, -16611, -15355, -13945, -12677, -11768, -11086, -10287, -9061, -7335, -5358, -3306, -810, 2668, 6852, 10837, 14295, 17632, 21020, 24062, 26482, 28373, 29778, 30684, 31355, 32063, 32654, 32767, 32456, 32106, 31758, 31029, 29748, 28262, 26799, 25100, 22919, 20379, 17625, 14692, 11782, 9050, 6229, 3063, -64, -2615, -4711, -6833, -9010, -10839, -12110, -12984, -13708, -14295, -14441, -13809, -12569, -11300, -10262, -9128, -7589, -5838, -4296, -3207, -2475, -1680, -326, 1581, 3466, 4930, 6248, 7790, 9269, 10075, 10171, 10108, 10112, 9835, 9118, 8298, 7503, 6446, 5174, 4211, 3624, 2804, 1474, 127, -819, -1576, -2417, -3150, -3502, -3601, -3730, -3882, -3902, -3868, -3919, -3884, -3493, -2823, -2150, -1498, -689, 326, 1417, 2440, 3276, 3881, 4380, 4912, 5365, 5439, 5030, 4375, 3733, 3049, 2067, 701, -845, -2349, -3785, -5205, -6527, -7637, -8604, -9599, -10617, -11476, -12121, -12701, -13323, -13909, -14352, -14640, -14762, -14575, -13940, -12915, -11717, -10478, -9110, -7471, -5607, -3748, -2080, -622, 701, 1965, 3208, 4406, 5409, 6048, 6349, 6568, 6851, 6973, 6636, 5942, 5246, 4584, 3630, 2297, 966, -97, -1166, -2667, -4590, -6542, -8277, -9887, -11494, -12984, -14164, -15068, -15901, -16716, -17350, -17646, -17709, -17752, -17813, -17702, -17234, -16449, -15559, -14740, -13978, -13144, -12174, -11129, -10116, -9137, -8068, -6832, -5560, -4496, -3738, -3136, -2469, -1692, -1021, -755, -948, -1311, -1539, -1702, -2060, -2601, -3056, -3378, -3838, -4541, -5144, -5375, -5510, -5969, -6595, -6874, -6760, -6714, -6942, -7129, -7054, -6912, -6911, -6908, -6706, -6377, -6108, -5862, -5456, -4873, -4311, -3874, -3467, -3031, -2699, -2624, -2746, -2850, -2823, -2803, -2981, -3324, -3625, -3834, -4135, -4629, -5134, -5465, -5734, -6168, -6687, -6978, -6969, -6944, -7084, -7202, -7130, -7071, -7248, -7444, -7253, -6677, -6125, -5784, -5341, -4439, -3199, -2053, -1172, -325, 634, 1484, 2011, 2402, 2951, 3607, 4144, 4546, 4906, 5185, 5372, 5659, 6133, 6504, 6470, 6156, 5922, 5853, 5695, 5272, 4710, 4180, 3648, 3014, 2335, 1775, 1394, 1100, 715, 171, -346, -587, -600, -691, -960, -1179, -1186, -1068, -878, -526, -44, 336, 533, 774, 1285, 1979, 2618, 3158, 3725, 4333, 4817, 5123, 5434, 5906, 6389, 6613, 6543, 6361, 6145, 5834, 5461, 5152, 4921, 4672, 4368, 4049, 3785, 3726, 3975, 4331, 4425, 4213, 4058, 4237, 4636, 4969, 5104, 5099, 5122, 5379, 5970, 6718, 7289, 7615, 7988, 8594, 9187, 9480, 9565, 9669, 9741, 9581, 9240, 8963, 8876, 8888, 8815, 8517, 7961, 7271, 6627, 6101, 5586, 4949, 4201, 3496, 2933, 2472, 2029, 1616, 1304, 1062, 777, 431, 150, 45, 88, 161, 219, 336, 606, 1023, 1485, 1900, 2280, 2687, 3122, 3541, 3954, 4409, 4898, 5343, 5719, 6074, 6437, 6754, 6985, 7202, 7501, 7842, 8048, 8008, 7798, 7581, 7420, 7268, 7062, 6759, 6314, 5787, 5374, 5214, 5160, 4910, 4400, 3892, 3593, 3342, 2886, 2296, 1849, 1600, 1377, 1117, 917, 781, 599, 357, 153, 10, -92, -112, -31, 5, -164, -445, -566, -458, -349, -391, -462, -464, -564, -910, -1274, -1292, -1000, -817, -963, -1165, -1079, -754, -485, -374, -257, -1, 360, 755, 1171, 1555, 1815, 1964, 2105, 2266, 2385, 2489, 2671, 2873, 2933, 2852, 2787, 2777, 2679, 2417, 2090, 1807, 1528, 1119, 535, -111, -644, -974, -1195, -1519, -2049, -2641, -3099, -3435, -3795, -4190, -4523, -4838, -5243, -5649, -5812, -5701, -5581, -5634, -5718, -5685, -5650, -5732, -5751, -5526, -5239, -5122, -5040, -4720, -4202, -3734, -3400, -3120, -2836, -2521, -2178, -1908, -1806, -1726, -1373, -781, -434, -602, -800, -368, 560, 1226, 1264, 1030, 910, 822, 520, 0, -556, -1033, -1476, -1987, -2552, -3010, -3197, -3119, -2970, -3034, -3455, -3971, -4061, -3631, -3278, -3494, -3988, -4220, -4220, -4290, -4350, -4170, -3864, -3658, -3462, -3082, -2591, -2136, -1625, -938, -283, -33, -238, -610, -917, -1118, -1132, -887, -564, -436, -500, -596, -709, -869, -986, -1039, -1215, -1641, -2222, -2870, -3636, -4568, -5662, -6978, -8645, -10694, -12950, -15011, -16408, -16863, -16559, -15995, -15404, -14361, -12305, -9393, -6467, -4102, -2191, -448, 1241, 3042, 5142, 7523, 10084, 12925, 16032, 19000, 21500, 23738, 26071, 28331, 30002, 30875, 31218, 31309, 31184, 30866, 30428, 29778, 28657, 27039, 25159, 23126, 20820, 18266, 15755, 13383, 10842, 8018, 5437, 3526, 1874, -78, -2014, -3406, -4565, -5914, -6961, -7181, -7171, -7654, -8204, -8042, -7298, -6532, -5702, -4431, -2805, -1261, -9, 1101, 2252, 3468, 4637, 5560, 6001, 5907, 5550, 5238, 5032, 4900, 4948, 5213, 5402, 5196, 4663, 4101, 3617, 3094, 2488, 1892, 1331, 703, -12, -647, -1012, -1125, -1114, -978, -626, -90, 491, 1127, 1933, 2818, 3508, 3969, 4479, 5131, 5615, 5675, 5483, 5333, 5222, 4977, 4641, 4426, 4326, 4039, 3364, 2459, 1587, 732, -313, -1605, -2956, -4232, -5528, -6962, -8441, -9755, -10846, -11839, -12790, -13561, -13987, -14096, -14056, -13889, -13411, -12561, -11610, -10793, -9935, -8757, -7391, -6205, -5203, -4027, -2524, -966, 409, 1685, 2934, 3960, 4647, 5241, 5920, 6403, 6421, 6198, 6047, 5815, 5202, 4274, 3255, 2155, 857, -596, -2066, -3415, -4579, -5630, -6719, -7885, -8951, -9801, -10563, -11389, -12149, -12591, -12751, -12938, -13233, -13371, -13208, -12981, -12888, -12761, -12371, -11798, -11274, -10864, -10447, -9944, -9400, -8914, -8543, -8282, -8032, -7692, -7322, -7132, -7172, -7210, -7028, -6687, -6323, -5953, -5612, -5499, -5713, -6048, -6214, -6142, -5962, -5798, -5674, -5561, -5460, -5385, -5288, -5068, -4713, -4327, -3961, -3543, -3059, -2655, -2437, -2341, -2314, -2425, -2668, -2883, -2977, -3097, -3400, -3782, -4055, -4296, -4742, -5368, -5930, -6410, -7029, -7795, -8439, -8844, -9186, -9585, -9946, -10200, -10408, -10595, -10644, -10468, -10162, -9892, -9686, -9413, -8984, -8443, -7864, -7221, -6460, -5612, -4805, -4140, -3600, -3091, -2548, -1976, -1409, -878, -408, 43, 565, 1113, 1477, 1557, 1593, 1852, 2224, 2367, 2167, 1798, 1404, 983, 563, 248, 27, -253, -627, -871, -767, -446, -273, -401, -608, -681, -708, -811, -884, -865, -942, -1188, -1329, -1223, -1188, -1468, -1772, -1751, -1548, -1496, -1539, -1376, -1004, -781, -915, -1128, -990, -550, -284, -332, -263, 162, 528, 522, 558, 1068, 1705, 1921, 1950, 2434, 3341, 3960, 3971, 3821, 3925, 4047, 3832, 3474, 3414, 3568, 3472, 3078, 2846, 2957, 2991, 2669, 2334, 2359, 2527, 2517, 2572, 3098, 3929, 4545, 4906, 5529, 6688, 7916, 8499, 8304, 7864, 7679, 7762, 8010, 8564, 9439, 10141, 10188, 9802, 9589, 9665, 9605, 9187, 8657, 8210, 7644, 6763, 5761, 4960, 4361, 3742, 3116, 2773, 2815, 2961, 2932, 2782, 2652, 2484, 2262, 2233, 2500, 2770, 2802, 2822, 3112, 3608, 4179, 4882, 5684, 6304, 6600, 6756, 6985, 7275, 7515, 7635, 7652, 7614, 7514, 7273, 6928, 6653, 6477, 6206, 5779, 5425, 5246, 5024, 4630, 4248, 4037, 3902, 3790, 3839, 4087, 4306, 4327, 4335, 4614, 5141, 5531, 5500, 5215, 5051, 5035, 4926, 4804, 5048, 5643, 6071, 6090, 6007, 6005, 5834, 5341, 4703, 4046, 3324, 2590, 1950, 1349, 725, 188, -182, -507, -892, -1258, -1511, -1699, -1951, -2341, -2814, -3224, -3476, -3644, -3812, -3892, -3728, -3355, -2953, -2579, -2120, -1529, -942, -501, -156, 266, 861, 1540, 2132, 2522, 2722, 2870, 3121, 3506, 3906, 4194, 4368, 4495, 4571, 4504, 4253, 3920, 3682, 3602, 3566, 3431, 3163, 2779, 2216, 1467, 744, 293, 84, -136, -531, -1050, -1562, -1962, -2232, -2440, -2591, -2610, -2580, -2732, -2991, -2982, -2688, -2514, -2539, -2430, -2220, -2298, -2569, -2530, -2165, -1944, -2009, -2097, -2068, -1976, -1857, -1823, -2034, -2367, -2514, -2542, -2893, -3709, -4512, -4820, -4747, -4754, -4934, -4913, -4460, -3899, -3674, -3736, -3671, -3332, -2943, -2618, -2226, -1744, -1349, -1068, -755, -432, -309, -416, -575, -707, -857, -930, -714, -248, 94, 73, -102, -104, 71, 236, 327, 348, 243, -19, -464, -1157, -1893, -2206, -2167, -2572, -3681, -4541, -4384, -3824, -3812, -4181, -4102, -3436, -2855, -2924, -3563, -4257, -4547, -4357, -3948, -3526, -2978, -2121, -1174, -668, -750, -911, -658, -144, 211, 281, 55, -660, -2001, -3776, -5749, -7872, -10100, -12256, -14215, -15989, -17441, -18192, -18017, -17214, -16257, -15228, -13888, -12246, -10655, -9311, -7922, -6098, -3790, -1246, 1351, 4007, 6723, 9373, 11810, 14001, 16074, 18207, 20432, 22536, 24324, 25862, 27267, 28369, 28943, 29133, 29223, 29118, 28476, 27294, 25902, 24424, 22673, 20647, 18674, 16939, 15173, 13203, 11369, 10096, 9278, 8478, 7594, 6849, 6277, 5613, 4732, 3802, 2945, 2044, 1003, 33, -572, -763, -678, -461, -212, -31, 57, 81, 28, -103, -271, -479, -780, -1101, -1300, -1424, -1674, -2036, -2272, -2335, -2500, -2854, -2989, -2498, -1596, -802, -173, 628, 1621, 2453, 3059, 3773, 4734, 5651, 6285, 6718, 7124, 7512, 7800, 7970, 8074, 8153, 8158, 8045, 7882, 7774, 7661, 7344, 6767, 6076, 5366, 4509, 3365, 2051, 791, -400, -1708, -3139, -4419, -5314, -5944, -6561, -7135, -7470, -7650, -7981, -8391, -8427, -7995, -7555, -7339, -7055, -6565, -6214, -6180, -6123, -5790, -5433, -5359, -5428, -5300, -4933, -4577, -4363, -4122, -3692, -3219, -2972, -2947, -2893, -2728, -2658, -2823, -3051, -3120, -3114, -3244, -3435, -3373, -3010, -2671, -2541, -2412, -2100, -1781, -1642, -1515, -1175, -798, -737, -962, -1129, -1221, -1611, -2421, -3292, -3961, -4655, -5596, -6563, -7281, -7968, -9007, -10245, -11157, -11651, -12177, -12961, -13698, -14160, -14565, -15111, -15600, -15760, -15641, -15444, -15209, -14815, -14168, -13299, -12311, -11281, -10200, -9008, -7710, -6462, -5456, -4682, -3965, -3244, -2588, -2012, -1511, -1203, -1134, -1105, -990, -983, -1213, -1430, -1427, -1455, -1807, -2304, -2604, -2788, -3202, -3830, -4269, -4368, -4496, -4965, -5541, -5813, -5811, -5872, -6034, -6003, -5757, -5686, -5953, -6201, -6115, -5902, -5911, -6100, -6242, -6377, -6690, -7088, -7310, -7412, -7686, -8122, -8377, -8378, -8460, -8756, -8920, -8713, -8405, -8296, -8184, -7713, -7014, -6545, -6376, -6034, -5211, -4241, -3585, -3061, -2178, -1051, -267, 187, 940, 2069, 2931, 3315, 3720, 4276, 4492, 4253, 4084, 4211, 4191, 3688, 2957, 2348, 1819, 1160, 463, 41, -64, -225, -714, -1278, -1507, -1495, -1731, -2359, -2933, -3038, -2825, -2725, -2876, -3050, -3061, -3002, -3032, -3082, -2970, -2738, -2644, -2715, -2632, -2227, -1810, -1698, -1720, -1513, -1178, -1143, -1380, -1307, -691, -52, 207, 409, 871, 1313, 1551, 1962, 2704, 3300, 3508, 3770, 4379, 4982, 5282, 5544, 6035, 6507, 6594, 6398, 6324, 6463, 6467, 6083, 5551, 5254, 5176, 5045, 4840, 4684, 4358, 3527, 2448, 1775, 1657, 1605, 1186, 288, -1021, -2352, -3072, -3026, -2673, -2268, -1515, -289, 1034, 2130, 3055, 3936, 4783, 5583, 6241, 6622, 6822, 7174, 7792, 8408, 8840, 9298, 9967, 10540, 10604, 10304, 10185, 10369, 10391, 9978, 9468, 9228, 9047, 8520, 7763, 7260, 7119, 6938, 6428, 5748, 5123, 4557, 3991, 3419, 2849, 2381, 2219, 2377, 2604, 2761, 2991, 3355, 3639, 3730, 3821, 4065, 4290, 4295, 4191, 4206, 4300, 4283, 4231, 4416, 4853, 5236, 5423, 5623, 5981, 6267, 6231, 6019, 5905, 5815, 5494, 5049, 4867, 5053, 5339, 5547, 5740, 5943, 6032, 5925, 5713, 5546, 5518, 5584, 5592, 5438, 5221, 5130, 5191, 5220, 5063, 4778, 4505, 4211, 3721, 3006, 2295, 1795, 1411, 980, 633, 593, 718, 680, 495, 374, 225, -129, -472, -491, -371, -512, -866, -1050, -963, -836, -784, -678, -450, -225, -73, 110, 392, 667, 863, 1051, 1265, 1440, 1567, 1659, 1678, 1703, 1920, 2231, 2256, 1912, 1537, 1254, 811, 182, -245, -258, -85, 55, 224, 470, 655, 710, 843, 1293, 1920, 2199, 1830, 1189, 864, 839, 586, -13, -474, -532, -582, -979, -1491, -1769, -1959, -2426, -3162, -3802, -4131, -4285, -4433, -4520, -4487, -4548, -4895, -5241, -5102, -4597, -4393, -4717, -5025, -4894, -4635, -4646, -4709, -4395, -3816, -3415, -3225, -2841, -2134, -1505, -1278, -1248, -1094, -895, -937, -1204, -1405, -1404, -1359, -1431, -1500, -1339, -1027, -908, -1054, -1130, -1022, -1157, -1794, -2492, -2759, -2849, -3326, -4122, -4650, -4699, -4658, -4848, -5056, -4938, -4650, -4733, -5323, -5814, -5625, -4956, -4309, -3688, -2876, -2098, -1692, -1458, -1057, -604, -299, 14, 349, 267, -377, -945, -823, -341, -325, -956, -1529, -1433, -1033, -1232, -2209, -3155, -3451, -3470, -3754, -4084, -4047, -3904, -4114, -4403, -4095, -3062, -1817, -864, -253, 324, 1127, 1966, 2408, 2462, 2621, 3092, 3496, 3523, 3367, 3313, 3347, 3334, 3219, 2985, 2672, 2429, 2324, 2181, 1776, 1173, 720, 771, 1306, 1879, 2068, 1988, 2048, 2297, 2506, 2809, 3555, 4449, 4586, 3487, 1534, -744, -3271, -6110, -8991, -11438, -13299, -14945, -16752, -18387, -18934, -17920, -15961, -14081, -12602, -11047, -9023, -6707, -4322, -1697, 1258, 4125, 6505, 8602, 10761, 12792, 14382, 15731, 17191, 18671, 19828, 20649, 21391, 22121, 22676, 22969, 23099, 23087, 22746, 21866, 20506, 18949, 17347, 15649, 13897, 12308, 10961, 9657, 8281, 7095, 6421, 6268, 6413, 6659, 6968, 7474, 8267, 9012, 9140, 8571, 7822, 7184, 6280, 4828, 3242, 2050, 1144, 89, -1086, -1948, -2373, -2767, -3456, -4311, -5087, -5803, -6491, -6911, -6859, -6599, -6555, -6709, -6701, -6476, -6292, -6086, -5415, -4201, -2932, -1902, -811, 697, 2470, 4124, 5551, 6905, 8164, 8979, 9142, 9041, 9260, 9665, 9468, 8389, 7106, 6229, 5462, 4283, 2857, 1733, 1025, 451, -3, -89, 154, 333, 287, 228, 217, 45, -290, -564, -805, -1216, -1706, -2071, -2382, -2735, -2974, -3080, -3339, -3801, -4128, -4223, -4412, -4824, -5189, -5384, -5705, -6405, -7305, -8085, -8677, -9214, -9695, -9916, -9796, -9532, -9239, -8612, -7418, -6061, -5036, -4079, -2740, -1401, -662, -135, 938, 2276, 3010, 3114, 3235, 3504, 3484, 2979, 2192, 1326, 476, -329, -1192, -2269, -3545, -4810, -5834, -6555, -7176, -7999, -9065, -10050, -10661, -11000, -11324, -11651, -11815, -11756, -11550, -11301, -11112, -10991, -10783, -10364, -9823, -9277, -8712, -8194, -7935, -7957, -8060, -8230, -8658, -9292, -9782, -10047, -10390, -11000, -11593, -11766, -11508, -11166, -11024, -10976, -10700, -10056, -9267, -8646, -8221, -7691, -6760, -5485, -4226, -3275, -2587, -1884, -964, 118, 1166, 2037, 2732, 3279, 3593, 3524, 3059, 2452, 1977, 1533, 718, -605, -2093, -3363, -4391, -5282, -6032, -6709, -7583, -8703, -9631, -9962, -9948, -10151, -10545, -10554, -10013, -9445, -9204, -9005, -8559, -8012, -7522, -6983, -6347, -5793, -5403, -5068, -4752, -4560, -4473, -4287, -3948, -3709, -3828, -4208, -4491, -4492, -4337, -4196, -4086, -3952, -3809, -3664, -3419, -2997, -2445, -1819, -1097, -303, 474, 1262, 2135, 2967, 3561, 3993, 4427, 4738, 4760, 4685, 4748, 4768, 4454, 3909, 3437, 3103, 2737, 2208, 1510, 761, 99, -503, -1192, -1894, -2378, -2676, -3088, -3684, -4166, -4318, -4209, -3966, -3637, -3278, -2886, -2320, -1491, -578, 165, 788, 1564, 2578, 3528, 4094, 4365, 4698, 5173, 5440, 5246, 4854, 4671, 4649, 4392, 3757, 3010, 2390, 1843, 1204, 455, -259, -765, -1027, -1195, -1442, -1778, -2091, -2203, -1888, -1077, -89, 606, 973, 1472, 2449, 3801, 5297, 6914, 8618, 10070, 10800, 10689, 10115, 9597, 9330, 9127, 8713, 7975, 6993, 5996, 5314, 5142, 5297, 5347, 5075, 4716, 4629, 4863, 5211, 5609, 6184, 6906, 7528, 7946, 8303, 8658, 8946, 9238, 9657, 10024, 10039, 9796, 9662, 9680, 9504, 8946, 8217, 7557, 6917, 6138, 5245, 4423, 3729, 2996, 2093, 1136, 326, -261, -599, -605, -352, -175, -252, -224, 390, 1550, 2782, 3759, 4466, 4936, 5179, 5347, 5639, 6041, 6308, 6281, 6103, 6020, 6015, 5821, 5424, 5195, 5270, 5217, 4711, 4184, 4193, 4504, 4463, 4061, 3903, 4184, 4388, 4181, 3940, 4073, 4337, 4330, 4280, 4709, 5496, 5937, 5840, 5872, 6503, 7234, 7417, 7271, 7407, 7736, 7640, 6989, 6249, 5675, 5014, 3993, 2706, 1441, 396, -427, -1138, -1796, -2332, -2598, -2559, -2351, -2151, -2013, -1894, -1743, -1501, -1073, -492, 3, 238, 403, 840, 1501, 1931, 1924, 1852, 2089, 2395, 2290, 1832, 1545, 1601, 1587, 1260, 975, 998, 952, 476, -89, -330, -532, -1109, -1751, -1925, -1810, -1958, -2295, -2235, -1701, -1266, -1212, -1087, -537, 21, 23, -350, -467, -213, -131, -631, -1471, -2113, -2308, -2230, -2220, -2497, -2972, -3309, -3335, -3338, -3756, -4575, -5342, -5759, -5977, -6282, -6734, -7170, -7402, -7346, -7076, -6783, -6572, -6309, -5790, -5073, -4446, -4022, -3584, -2958, -2263, -1648, -1042, -407, 33, 43, -231, -422, -483, -831, -1775, -2959, -3731, -4044, -4522, -5440, -6140, -5939, -5189, -4817, -4994, -4966, -4245, -3347, -3059, -3411, -3799, -3868, -3835, -3930, -4009, -3857, -3558, -3282, -2927, -2334, -1684, -1331, -1346, -1520, -1744, -2034, -2382, -2804, -3348, -3955, -4520, -5103, -5720, -6045, -5788, -5261, -5103, -5435, -5726, -5545, -5045, -4528, -4021, -3493, -2996, -2226, -694, 1278, 2572, 2862, 3190, 4273, 5286, 5209, 4436, 4043, 4113, 3848, 3076, 2599, 2951, 3628, 3916, 3800, 3613, 3345, 2817, 2162, 1664, 1291, 765, 5, -763, -1242, -1275, -859, -157, 495, 802, 858, 1141, 1907, 2773, 3244, 3459, 3900, 4494, 4613, 4054, 3373, 3046, 2823, 2140, 776, -1105, -3332, -5893, -8798, -11921, -14975, -17736, -20094, -21907, -22884, -22755, -21496, -19300, -16358, -12793, -8766, -4564, -467, 3400, 7083, 10585, 13739, 16355, 18384, 19933, 21112, 22017, 22736, 23224, 23203, 22415, 21077, 19894, 19295, 18962, 18379, 17666, 17243, 16980, 16448, 15841, 15799, 16222, 16194, 15339, 14514, 14511, 14854, 14611, 13922, 13639, 13826, 13823, 13542, 13561, 13979, 14231, 13981, 13421, 12732, 11865, 10687, 9039, 6770, 4001, 1185, -1340, -3709, -6150, -8430, -10113, -11242, -12197, -12951, -13079, -12502, -11545, -10387, -9010, -7477, -5805, -3844, -1698, 162, 1464, 2401, 3237, 4055, 4792, 5237, 5160, 4727, 4399, 4242, 3841, 3064, 2353, 1989, 1614, 858, 21, -337, -237, -183, -361, -484, -414, -383, -459, -353, 96, 662, 1169, 1804, 2766, 3871, 4803, 5546, 6252, 6853, 7122, 6988, 6487, 5592, 4376, 3053, 1613, -175, -2268, -4295, -6113, -7866, -9504, -10752, -11591, -12250, -12687, -12550, -11794, -10898, -10222, -9539, -8509, -7281, -6204, -5243, -4182, -3133, -2359, -1788, -1164, -526, -158, -124, -215, -346, -667, -1234, -1838, -2327, -2865, -3636, -4517, -5225, -5726, -6201, -6696, -7082, -7365, -7730, -8173, -8405, -8245, -7870, -7495, -7065, -6432, -5685, -5051, -4575, -4072, -3429, -2790, -2439, -2496, -2856, -3389, -4075, -4952, -6007, -7198, -8513, -9912, -11245, -12339, -13195, -13970, -14684, -15125, -15166, -14953, -14597, -13973, -13051, -12137, -11453, -10759, -9684, -8292, -6991, -5989, -5162, -4411, -3815, -3376, -2943, -2506, -2314, -2462, -2667, -2624, -2409, -2344, -2589, -2979, -3175, -3063, -2918, -3064, -3385, -3491, -3303, -3120, -3113, -3165, -3180, -3204, -3228, -3169, -3037, -2907, -2733, -2405, -2013, -1840, -1997, -2305, -2599, -2967, -3521, -4180, -4855, -5668, -6709, -7732, -8400, -8737, -9106, -9688, -10234, -10433, -10319, -10142, -9983, -9703, -9195, -8538, -7856, -7183, -6478, -5742, -5042, -4451, -3971, -3526, -3051, -2581, -2239, -2070, -1981, -1898, -1861, -1899, -1888, -1692, -1360, -1063, -814, -479, -16, 429, 781, 1108, 1404, 1538, 1533, 1622, 1857, 1998, 1925, 1878, 2056, 2244, 2161, 1975, 2084, 2452, 2654, 2563, 2474, 2504, 2451, 2268, 2143, 2111, 2006, 1785, 1522, 1275, 1142, 1217, 1342, 1247, 982, 883, 994, 949, 628, 481, 802, 1062, 588, -325, -704, -257, 308, 328, -113, -585, -821, -787, -610, -489, -482, -443, -268, -102, -58, 50, 429, 832, 814, 489, 591, 1499, 2615, 3074, 2842, 2703, 3247, 4242, 5047, 5376, 5446, 5600, 5997, 6555, 7091, 7551, 8044, 8568, 8903, 8948, 8933, 9041, 9178, 9201, 9000, 8447, 7708, 7330, 7481, 7571, 7217, 6878, 6914, 6870, 6368, 5850, 5738, 5622, 5014, 4238, 3869, 3714, 3156, 2290, 1850, 2005, 2080, 1702, 1391, 1607, 1895, 1618, 1051, 1026, 1654, 2165, 2014, 1564, 1472, 1910, 2595, 3178, 3481, 3638, 3973, 4516, 4904, 4964, 4978, 5181, 5368, 5296, 5066, 4889, 4769, 4612, 4467, 4429, 4432, 4330, 4130, 3969, 3865, 3690, 3375, 3006, 2688, 2488, 2467, 2666, 3037, 3489, 3964, 4434, 4836, 5124, 5354, 5579, 5693, 5557, 5287, 5138, 5100, 5021, 4971, 5058, 5031, 4625, 4058, 3665, 3364, 2960, 2526, 2067, 1354, 417, -344, -778, -1146, -1597, -2003, -2244, -2290, -2085, -1668, -1232, -867, -474, 30, 648, 1345, 1960, 2285, 2393, 2642, 3125, 3482, 3516, 3573, 3908, 4035, 3363, 2268, 1700, 1691, 1258, 60, -908, -840, -392, -576, -1134, -1030, -173, 464, 410, 344, 867, 1474, 1411, 947, 911, 1222, 1005, 200, -210, 92, 264, -66, -239, -163, -719, -2060, -3248, -3880, -4462, -5147, -5567, -5596, -5243, -4513, -3937, -4072, -4302, -3673, -2731, -2762, -3537, -3642, -2759, -1926, -1777, -1935, -1986, -1888, -1447, -444, 555, 520, -534, -1345, -1220, -1048, -1742, -2712, -2836, -2158, -1603, -1495, -1268, -505, 391, 784, 652, 560, 855, 1133, 698, -559, -1944, -2804, -3375, -4337, -5580, -6121, -5499, -4568, -4304, -4353, -3585, -1901, -464, 5, 153, 744, 1477, 1746, 1716, 1957, 2615, 3488, 4309, 4705, 4448, 3891, 3596, 3500, 2991, 1814, 439, -617, -1375, -2076, -2609, -2635, -2127, -1442, -847, -297, 233, 509, 263, -564, -1940, -3892, -6350, -9058, -11855, -14738, -17468, -19467, -20362, -20305, -19547, -18080, -15919, -13345, -10614, -7691, -4604, -1780, 321, 1805, 3226, 4837, 6306, 7236, 7608, 7665, 7630, 7653, 7755, 7781, 7543, 7136, 6923, 7192, 7893, 8736, 9589, 10676, 12177, 13775, 14994, 15904, 16930, 18001, 18560, 18444, 18159, 18058, 17879, 17352, 16685, 16184, 15758, 15271, 14994, 15174, 15399, 15054, 14270, 13711, 13471, 12861, 11370, 9297, 7306, 5710, 4302, 2768, 1151, -134, -824, -1110, -1279, -1318, -1041, -565, -225, -103, 130, 768, 1587, 2050, 1948, 1616, 1464, 1418, 1047, 182, -814, -1534, -2106, -2964, -4109, -4959, -5144, -5060, -5273, -5594, -5291, -4222, -3123, -2434, -1617, -165, 1375, 2230, 2664, 3446, 4400, 4620, 4038, 3682, 4101, 4532, 4154, 3395, 3192, 3465, 3319, 2561, 1965, 1928, 1791, 957, -100, -611, -707, -1061, -1720, -2131, -2151, -2202, -2423, -2405, -1898, -1281, -1038, -1073, -853, -216, 293, 111, -577, -1131, -1361, -1694, -2421, -3281, -3944, -4485, -5138, -5829, -6264, -6373, -6372, -6418, -6391, -6096, -5539, -4882, -4205, -3480, -2721, -2050, -1573, -1276, -1092, -976, -966, -1201, -1811, -2694, -3552, -4285, -5130, -6213, -7266, -8007, -8563, -9199, -9872, -10315, -10431, -10371, -10273, -10110, -9812, -9488, -9372, -9504, -9616, -9522, -9402, -9484, -9629, -9559, -9348, -9265, -9320, -9257, -9006, -8804, -8840, -9025, -9171, -9234, -9312, -9493, -9795, -10135, -10304, -10123, -9675, -9194, -8762, -8304, -7836, -7427, -6954, -6182, -5157, -4262, -3752, -3466, -3119, -2700, -2363, -2130, -1914, -1781, -1849, -2051, -2231, -2407, -2734, -3235, -3780, -4268, -4703, -5069, -5303, -5367, -5288, -5068, -4715, -4362, -4135, -3997, -3897, -3971, -4316, -4711, -4943, -5184, -5669, -6241, -6587, -6768, -7084, -7535, -7786, -7699, -7565, -7727, -8137, -8460, -8522, -8465, -8508, -8666, -8747, -8578, -8226, -7896, -7607, -7136, -6421, -5705, -5161, -4623, -3925, -3237, -2822, -2650, -2446, -2033, -1474, -960, -580, -248, 105, 371, 435, 438, 612, 876, 896, 573, 217, 169, 436, 795, 1118, 1456, 1845, 2188, 2412, 2652, 3065, 3474, 3491, 3091, 2702, 2607, 2605, 2431, 2164, 2019, 2021, 1992, 1733, 1249, 828, 707, 638, 252, -253, -352, -79, 26, -189, -349, -283, -235, -289, -167, 265, 715, 879, 876, 1019, 1338, 1603, 1673, 1592, 1429, 1233, 1104, 1120, 1233, 1359, 1504, 1659, 1689, 1513, 1344, 1422, 1577, 1430, 1026, 767, 730, 617, 373, 238, 211, 73, -36, 398, 1590, 3128, 4419, 5297, 6085, 7077, 8039, 8491, 8444, 8448, 8749, 8838, 8221, 7286, 6895, 7222, 7542, 7295, 6806, 6646, 6776, 6758, 6500, 6308, 6373, 6615, 6931, 7310, 7725, 8106, 8411, 8619, 8726, 8805, 8982, 9174, 9025, 8334, 7416, 6727, 6251, 5670, 4940, 4309, 3882, 3572, 3363, 3336, 3442, 3513, 3465, 3340, 3170, 2946, 2694, 2444, 2161, 1856, 1728, 1959, 2397, 2746, 2962, 3168, 3307, 3256, 3138, 3172, 3283, 3219, 2992, 2861, 2900, 2917, 2877, 3056, 3575, 4074, 4175, 4031, 4066, 4318, 4422, 4235, 4081, 4280, 4707, 5019, 5172, 5418, 5842, 6181, 6211, 6085, 6085, 6167, 6031, 5573, 5024, 4586, 4160, 3584, 2952, 2483, 2190, 1864, 1413, 1029, 866, 741, 418, 54, -26, 74, -3, -198, -111, 224, 426, 508, 834, 1366, 1657, 1493, 1050, 564, 171, -128, -500, -982, -1319, -1419, -1578, -1841, -1707, -1020, -441, -500, -783, -650, -163, 192, 263, 301, 527, 879, 1149, 1349, 1746, 2372, 2767, 2618, 2320, 2334, 2433, 2187, 1752, 1476, 1190, 544, -322, -981, -1279, -1376, -1484, -1795, -2400, -3193, -3997, -4760, -5515, -6240, -6864, -7260, -7276, -6947, -6558, -6294, -5976, -5347, -4455, -3552, -2807, -2294, -2071, -2072, -2049, -1858, -1732, -2021, -2664, -3187, -3273, -3117, -3137, -3581, -4389, -5205, -5619, -5651, -5765, -6151, -6361, -5996, -5320, -4732, -4046, -2798, -1121, 263, 911, 1120, 1420, 1901, 2225, 2055, 1341, 390, -375, -877, -1501, -2453, -3230, -3214, -2692, -2614, -3241, -3792, -3784, -3906, -4797, -5660, -5215, -3707, -2676, -2765, -2914, -1983, -276, 1063, 1573, 1797, 2330, 3062, 3481, 3352, 2900, 2485, 2297, 2270, 2181, 1891, 1486, 1058, 415, -630, -1685, -1916, -1052, 41, 269, -238, -249, 823, 2175, 3076, 3940, 5111, 5887, 5906, 6134, 7216, 8161, 7924, 7067, 6662, 6577, 5995, 4827, 3560, 2274, 876, -74, 91, 886, 1092, 480, -47, -72, -143, -512, -677, -577, -1123, -2941, -5348, -7219, -8372, -9443, -10754, -11995, -12838, -13118, -12502, -10678, -7993, -5274, -2876, -402, 2441, 5206, 7226, 8402, 9064, 9364, 9279, 8916, 8387, 7566, 6342, 4903, 3596, 2668, 2134, 1721, 1260, 1237, 2358, 4465, 6691, 8759, 11148, 13869, 16197, 17781, 19031, 20214, 21020, 21146, 20714, 19891, 18667, 17123, 15536, 14026, 12395, 10578, 8938, 7818, 7124, 6630, 6346, 6260, 6199, 6097, 6044, 5976, 5750, 5451, 5221, 4966, 4632, 4479, 4692, 4967, 4911, 4649, 4567, 4574, 4209, 3475, 2928, 2727, 2330, 1399, 331, -501, -1389, -2667, -4017, -4973, -5706, -6646, -7580, -7866, -7493, -7123, -6982, -6492, -5247, -3681, -2416, -1497, -593, 475, 1697, 3006, 4138, 4609, 4198, 3337, 2651, 2128, 1150, -535, -2314, -3437, -3937, -4365, -4868, -5065, -4747, -4134, -3419, -2580, -1650, -781, 27, 903, 1853, 2708, 3254, 3375, 3207, 3024, 2805, 2158, 961, -239, -897, -1251, -1983, -3257, -4503, -5156, -5339, -5661, -6433, -7255, -7525, -7182, -6714, -6431, -6161, -5667, -5010, -4375, -3840, -3401, -3029, -2663, -2289, -1967, -1716, -1523, -1466, -1629, -1958, -2395, -3066, -4009, -4993, -5861, -6804, -8001, -9244, -10210, -10837, -11274, -11644, -11970, -12166, -12004, -11322, -10271, -9213, -8313, -7409, -6380, -5459, -4995, -5032, -5341, -5822, -6601, -7677, -8740, -9556, -10288, -11183, -12134, -12888, -13449, -13923, -14163, -13995, -13604, -13312, -13056, -12446, -11348, -10061, -8955, -8132, -7466, -6783, -5951, -5052, -4457, -4473, -4887, -5210, -5326, -5489, -5740, -5897, -5991, -6186, -6358, -6233, -5831, -5379, -4975, -4578, -4198, -3863, -3584, -3391, -3274, -3165, -3062, -3004, -2892, -2600, -2273, -2140, -2122, -2020, -1933, -2054, -2277, -2433, -2678, -3200, -3848, -4371, -4757, -5118, -5468, -5811, -6173, -6519, -6765, -6884, -6898, -6855, -6862, -6957, -6986, -6811, -6546, -6352, -6160, -5832, -5460, -5212, -5064, -4890, -4667, -4457, -4322, -4338, -4500, -4664, -4714, -4675, -4578, -4376, -4085, -3761, -3291, -2505, -1507, -637, -65, 312, 619, 872, 1118, 1449, 1864, 2232, 2434, 2522, 2699, 3122, 3693, 4169, 4459, 4669, 4865, 5038, 5245, 5500, 5582, 5279, 4838, 4751, 5095, 5394, 5248, 4828, 4574, 4603, 4622, 4392, 4028, 3719, 3374, 2818, 2226, 2010, 2235, 2489, 2429, 2208, 2168, 2320, 2439, 2484, 2514, 2307, 1673, 1072, 1181, 1767, 1846, 1094, 307, 253, 845, 1604, 2274, 2720, 2826, 2779, 3053, 3825, 4636, 4941, 4757, 4455, 4215, 4029, 4000, 4191, 4389, 4382, 4328, 4484, 4762, 4932, 5128, 5589, 6015, 5860, 5378, 5468, 6263, 6814, 6533, 6027, 6033, 6366, 6435, 6145, 5797, 5488, 5037, 4399, 3887, 3807, 3943, 3735, 3116, 2743, 3094, 3765, 4091, 4031, 4025, 4289, 4685, 5028, 5239, 5318, 5242, 4871, 4120, 3329, 3022, 3130, 2990, 2334, 1751, 1823, 2306, 2558, 2397, 2195, 2277, 2556, 2767, 2901, 3176, 3597, 3878, 3971, 4238, 4796, 5199, 5170, 5109, 5358, 5568, 5292, 4758, 4458, 4358, 4066, 3546, 3159, 3035, 2892, 2538, 2192, 2117, 2231, 2288, 2222, 2113, 2001, 1921, 1949, 2108, 2284, 2325, 2207, 2090, 2192, 2498, 2734, 2713, 2581, 2526, 2440, 2093, 1515, 961, 606, 421, 219, -170, -617, -771, -590, -487, -696, -920, -853, -581, -277, -7, 74, -89, -137, 276, 837, 978, 777, 823, 1305, 1782, 1858, 1645, 1446, 1323, 1149, 921, 772, 675, 415, -6, -201, 100, 561, 609, 188, -229, -295, -129, -69, -300, -700, -904, -722, -377, -110, 219, 730, 1032, 709, 18, -461, -618, -795, -1266, -2061, -3066, -3979, -4405, -4202, -3656, -3301, -3511, -4041, -4096, -3246, -2156, -1862, -2419, -2901, -2764, -2480, -2610, -2895, -2753, -2250, -1979, -2198, -2644, -3065, -3371, -3368, -2950, -2505, -2530, -2792, -2452, -1211, 181, 928, 1201, 1682, 2523, 3386, 4042, 4386, 4336, 4117, 4046, 3820, 2910, 1714, 1187, 1328, 1223, 608, 214, 508, 1111, 1625, 2151, 2690, 2802, 2325, 1856, 1904, 2079, 1771, 1175, 953, 1195, 1440, 1437, 1271, 930, 353, -222, -503, -718, -1318, -2107, -2322, -1781, -1260, -1374, -1710, -1652, -1532, -2116, -3256, -4086, -4529, -5461, -7193, -8995, -10371, -11559, -12546, -12806, -12237, -11245, -9843, -7617, -4587, -1277, 2030, 5349, 8417, 10700, 12081, 12967, 13562, 13483, 12497, 11103, 9929, 8919, 7654, 6162, 4918, 4184, 3805, 3602, 3742, 4550, 6056, 7883, 9744, 11759, 14117, 16513, 18390, 19618, 20546, 21376, 21842, 21637, 20802, 19519, 17816, 15719, 13477, 11325, 9173, 6922, 4902, 3599, 2968, 2483, 1993, 1988, 2720, 3578, 3919, 3989, 4349, 4850, 4938, 4619, 4288, 3980, 3508, 2971, 2554, 2094, 1317, 278, -712, -1451, -2031, -2747, -3774, -4905, -5794, -6385, -6916, -7486, -7928, -8123, -8155, -8056, -7693, -7020, -6270, -5692, -5216, -4588, -3790, -3104, -2694, -2366, -1878, -1301, -899, -731, -621, -503, -585, -1066, -1858, -2687, -3390, -3981, -4492, -4892, -5111, -5049, -4575, -3666, -2551, -1512, -586, 372, 1411, 2436, 3310, 3843, 3911, 3675, 3386, 2981, 2259, 1320, 391, -565, -1607, -2516, -3184, -3866, -4656, -5253, -5534, -5740, -5930, -5836, -5434, -5036, -4749, -4337, -3690, -3035, -2598, -2354, -2186, -2112, -2226, -2512, -2820, -3133, -3651, -4414, -5039, -5240, -5377, -5949, -6760, -7256, -7420, -7631, -7938, -8167, -8408, -8766, -8988, -8860, -8628, -8566, -8495, -8122, -7573, -7172, -6921, -6526, -5933, -5495, -5463, -5645, -5735, -5847, -6356, -7328, -8387, -9203, -9814, -10362, -10815, -11116, -11350, -11549, -11512, -11025, -10189, -9387, -8914, -8618, -7990, -6798, -5516, -4781, -4553, -4316, -3912, -3608, -3497, -3463, -3606, -4129, -4933, -5717, -6273, -6537, -6591, -6681, -6887, -6870, -6321, -5455, -4637, -3856, -2952, -2093, -1567, -1330, -1095, -741, -504, -748, -1494, -2190, -2330, -2178, -2382, -2937, -3259, -3214, -3257, -3485, -3443, -3051, -2918, -3361, -3774, -3547, -3064, -3117, -3666, -3980, -3853, -3825, -4158, -4409, -4277, -4162, -4475, -4938, -5030, -4806, -4724, -4890, -5007, -4991, -5039, -5115, -4913, -4451, -4207, -4419, -4670, -4468, -3957, -3683, -3817, -4013, -4007, -3882, -3689, -3234, -2512, -1942, -1780, -1674, -1231, -693, -483, -450, -162, 298, 471, 335, 370, 799, 1287, 1511, 1640, 2006, 2587, 3099, 3455, 3783, 4056, 4051, 3737, 3416, 3307, 3255, 3046, 2755, 2575, 2515, 2484, 2404, 2157, 1715, 1374, 1421, 1654, 1654, 1382, 1092, 962, 1119, 1624, 2155, 2267, 2082, 2106, 2397, 2588, 2618, 2744, 2949, 2945, 2666, 2285, 1940, 1716, 1697, 1777, 1668, 1341, 1248, 1769, 2599, 3060, 3014, 2991, 3338, 3747, 3858, 3889, 4255, 4830, 5112, 5023, 4992, 5210, 5360, 5177, 4757, 4262, 3771, 3433, 3298, 3143, 2826, 2621, 2776, 3101, 3308, 3491, 3901, 4470, 4919, 5196, 5507, 5930, 6256, 6273, 6032, 5722, 5424, 5110, 4792, 4544, 4403, 4358, 4382, 4406, 4317, 4134, 4072, 4251, 4431, 4318, 3992, 3770, 3763, 3901, 4149, 4446, 4631, 4678, 4755, 4899, 4928, 4771, 4572, 4436, 4299, 4116, 3930, 3756, 3544, 3301, 3142, 3160, 3329, 3537, 3698, 3788, 3823, 3820, 3778, 3679, 3569, 3545, 3595, 3545, 3316, 3123, 3216, 3518, 3725, 3720, 3643, 3555, 3326, 2890, 2423, 2083, 1764, 1275, 698, 330, 278, 336, 339, 417, 723, 1087, 1164, 914, 698, 812, 1138, 1356, 1388, 1460, 1767, 2216, 2576, 2788, 2982, 3187, 3262, 3168, 3064, 3037, 2963, 2751, 2487, 2266, 2128, 2122, 2189, 2152, 2028, 2104, 2452, 2749, 2803, 2857, 3099, 3320, 3285, 3086, 2897, 2653, 2240, 1760, 1383, 1054, 646, 228, -134, -698, -1686, -2691, -2998, -2563, -2214, -2627, -3443, -3685, -3002, -2166, -2134, -2809, -3179, -2734, -2196, -2433, -3091, -2981, -1812, -753, -826, -1502, -1594, -1010, -668, -1031, -1615, -1776, -1323, -513, 185, 560, 941, 1682, 2438, 2606, 2317, 2267, 2526, 2274, 982, -696, -1689, -1812, -1780, -2114, -2571, -2656, -2191, -1361, -482, 262, 953, 1705, 2328, 2518, 2413, 2540, 3016, 3237, 2727, 1970, 1732, 1867, 1601, 812, 71, -477, -1232, -2165, -2735, -2832, -2940, -3250, -3355, -3007, -2531, -2214, -1830, -1191, -729, -962, -1719, -2473, -3175, -4198, -5648, -7208, -8506, -9350, -9704, -9604, -9031, -7898, -6259, -4389, -2505, -574, 1460, 3414, 4994, 6122, 6896, 7345, 7374, 7042, 6599, 6176, 5603, 4750, 3869, 3335, 3125, 2916, 2739, 3062, 4044, 5205, 6143, 7141, 8606, 10381, 11920, 12965, 13699, 14427, 15169, 15535, 15174, 14306, 13429, 12543, 11238, 9537, 7964, 6776, 5796, 5000, 4590, 4521, 4521, 4582, 4937, 5555, 6063, 6239, 6244, 6307, 6351, 6121, 5613, 5099, 4668, 4082, 3250, 2524, 2116, 1632, 699, -275, -666, -655, -990, -1850, -2643, -2940, -3024, -3339, -3835, -4140, -4162, -4168, -4302, -4344, -4102, -3762, -3622, -3648, -3551, -3256, -3032, -3061, -3128, -2947, -2606, -2403, -2351, -2259, -2186, -2350, -2649, -2800, -2899, -3242, -3712, -3889, -3722, -3558, -3520, -3319, -2716, -1844, -1003, -303, 379, 1156, 1943, 2557, 2912, 3040, 2972, 2732, 2360, 1832, 1041, 36, -882, -1487, -1907, -2369, -2834, -3102, -3129, -3046, -2954, -2825, -2544, -2051, -1456, -972, -672, -408, -78, 156, 75, -230, -490, -732, -1309, -2285, -3208, -3746, -4148, -4768, -5504, -6040, -6346, -6596, -6823, -6941, -6972, -7002, -7025, -6966, -6836, -6716, -6631, -6547, -6497, -6572, -6726, -6718, -6470, -6334, -6650, -7134, -7251, -7042, -7025, -7320, -7635, -7985, -8657, -9487, -9949, -9961, -9953, -10136, -10247, -10054, -9651, -9211, -8713, -8094, -7480, -7069, -6793, -6346, -5648, -5039, -4790, -4699, -4511, -4389, -4559, -4768, -4624, -4353, -4584, -5351, -5912, -5797, -5475, -5537, -5750, -5540, -4957, -4447, -4002, -3289, -2359, -1575, -1032, -565, -131, 157, 262, 191, -60, -481, -1024, -1634, -2226, -2743, -3190, -3527, -3635, -3579, -3643, -3883, -3935, -3588, -3220, -3264, -3533, -3524, -3155, -2800, -2697, -2710, -2678, -2655, -2714, -2756, -2737, -2834, -3213, -3771, -4280, -4644, -4916, -5189, -5467, -5615, -5552, -5483, -5606, -5640, -5166, -4381, -3874, -3727, -3492, -3009, -2564, -2299, -2066, -1839, -1752, -1776, -1715, -1511, -1294, -1183, -1158, -1143, -1156, -1289, -1465, -1389, -1017, -754, -840, -849, -349, 383, 930, 1482, 2295, 2968, 3060, 2992, 3502, 4491, 5093, 4765, 3893, 3318, 3402, 3692, 3572, 3079, 2732, 2732, 2825, 2894, 3098, 3407, 3514, 3310, 3071, 3018, 3036, 2948, 2791, 2682, 2593, 2502, 2522, 2645, 2609, 2281, 1937, 1852, 1856, 1623, 1209, 892, 658, 255, -230, -337, 84, 552, 566, 265, 169, 539, 1178, 1650, 1603, 1128, 775, 964, 1458, 1714, 1595, 1451, 1579, 1912, 2193, 2306, 2365, 2496, 2594, 2449, 2140, 2031, 2284, 2618, 2703, 2553, 2451, 2598, 2970, 3367, 3598, 3663, 3717, 3838, 3982, 4115, 4222, 4191, 3956, 3732, 3833, 4244, 4612, 4741, 4826, 5123, 5559, 5842, 5851, 5728, 5615, 5489, 5255, 4901, 4520, 4254, 4181, 4207, 4119, 3834, 3559, 3547, 3743, 3827, 3659, 3435, 3363, 3411, 3464, 3497, 3478, 3336, 3147, 3145, 3388, 3582, 3441, 3070, 2775, 2591, 2307, 1865, 1400, 943, 442, 10, -199, -273, -354, -348, -124, 185, 371, 494, 786, 1284, 1766, 2031, 2120, 2266, 2632, 3138, 3572, 3806, 3874, 3871, 3882, 3963, 4075, 4063, 3803, 3328, 2784, 2306, 1971, 1742, 1472, 1059, 613, 329, 271, 372, 551, 712, 822, 992, 1326, 1714, 2056, 2512, 3199, 3827, 4046, 4002, 4104, 4402, 4541, 4239, 3547, 2720, 2012, 1521, 1110, 542, -229, -951, -1315, -1281, -1083, -915, -704, -273, 329, 861, 1239, 1620, 2071, 2440, 2622, 2677, 2608, 2321, 1850, 1344, 793, 83, -723, -1418, -1920, -2320, -2714, -3114, -3445, -3585, -3505, -3350, -3250, -3120, -2820, -2367, -1858, -1331, -827, -463, -284, -153, 91, 417, 613, 538, 299, 127, 68, -82, -446, -855, -1141, -1413, -1808, -2103, -1930, -1423, -1197, -1441, -1515, -926, -119, 344, 762, 1522, 2126, 2059, 1938, 2617, 3725, 4204, 3870, 3350, 2884, 2155, 1224, 688, 691, 527, -358, -1437, -1786, -1400, -1104, -1292, -1469, -1218, -857, -796, -772, -284, 525, 1068, 1269, 1663, 2393, 2884, 2804, 2593, 2547, 2221, 1385, 744, 892, 1223, 800, -183, -742, -618, -564, -1114, -1920, -2594, -3383, -4605, -6073, -7494, -8792, -9817, -10419, -10762, -10891, -10284, -8598, -6301, -3934, -1449, 1215, 3818, 6315, 8683, 10305, 10626, 10171, 9789, 9322, 8057, 6042, 3953, 2125, 437, -1148, -2476, -3408, -3881, -3838, -3293, -2268, -656, 1683, 4463, 6971, 8963, 11033, 13508, 15655, 16765, 17133, 17184, 16689, 15594, 14350, 12896, 10695, 8020, 5760, 3930, 1887, -161, -1346, -1528, -1358, -1163, -705, 230, 1613, 3259, 4813, 5868, 6390, 6859, 7678, 8567, 8879, 8455, 7716, 6986, 6229, 5350, 4251, 2761, 1022, -449, -1486, -2485, -3624, -4568, -5132, -5448, -5494, -5232, -4964, -4799, -4305, -3315, -2360, -1774, -1259, -672, -286, -106, 123, 243, -63, -546, -738, -750, -1017, -1522, -1925, -2218, -2722, -3503, -4256, -4770, -5161, -5496, -5599, -5371, -4954, -4385, -3496, -2287, -1072, -71, 822, 1738, 2577, 3172, 3526, 3723, 3738, 3447, 2809, 1959, 1085, 254, -603, -1562, -2571, -3438, -3995, -4249, -4341, -4364, -4276, -4010, -3555, -2896, -2013, -1002, -117, 483, 928, 1390, 1750, 1730, 1285, 601, -235, -1277, -2458, -3547, -4471, -5365, -6267, -6951, -7302, -7502, -7650, -7550, -7164, -6841, -6740, -6552, -6084, -5648, -5485, -5362, -5074, -4897, -5134, -5538, -5645, -5494, -5532, -5927, -6394, -6714, -7008, -7404, -7862, -8382, -9028, -9684, -10103, -10259, -10360, -10445, -10291, -9827, -9334, -8975, -8503, -7739, -6941, -6352, -5856, -5360, -5031, -4823, -4416, -3846, -3579, -3800, -4178, -4432, -4612, -4837, -5141, -5589, -6203, -6783, -7034, -6851, -6432, -6066, -5818, -5457, -4763, -3827, -2913, -2114, -1377, -785, -487, -418, -385, -394, -614, -1109, -1794, -2559, -3273, -3812, -4200, -4557, -4894, -5104, -5167, -5153, -5086, -4952, -4769, -4533, -4214, -3862, -3555, -3278, -2970, -2698, -2557, -2518, -2530, -2630, -2853, -3148, -3480, -3835, -4145, -4363, -4606, -4972, -5311, -5388, -5213, -4991, -4785, -4457, -3940, -3389, -2954, -2569, -2059, -1434, -914, -657, -580, -480, -256, 45, 309, 411, 290, 54, -72, 16, 179, 214, 93, -46, -65, 105, 466, 950, 1455, 1915, 2348, 2782, 3231, 3712, 4236, 4684, 4848, 4738, 4660, 4777, 4872, 4787, 4686, 4627, 4385, 3954, 3693, 3736, 3810, 3747, 3659, 3565, 3415, 3359, 3568, 3879, 4003, 3936, 3864, 3890, 3991, 4088, 4074, 3930, 3748, 3588, 3415, 3260, 3172, 3055, 2793, 2472, 2213, 1898, 1450, 1099, 1040, 1038, 761, 324, 139, 336, 667, 914, 1117, 1375, 1695, 2080, 2569, 3083, 3453, 3641, 3727, 3714, 3620, 3655, 3939, 4194, 4072, 3681, 3429, 3483, 3686, 3878, 4028, 4099, 4061, 4043, 4234, 4607, 4905, 4991, 5035, 5237, 5511, 5631, 5613, 5674, 5814, 5768, 5442, 5103, 4976, 4954, 4865, 4699, 4481, 4219, 4051, 4101, 4226, 4183, 4009, 3906, 3897, 3836, 3680, 3500, 3297, 3024, 2754, 2591, 2441, 2128, 1741, 1577, 1668, 1705, 1532, 1337, 1267, 1220, 1120, 1063, 1071, 981, 750, 607, 695, 822, 761, 638, 708, 896, 940, 832, 784, 822, 780, 615, 462, 394, 366, 382, 509, 702, 807, 798, 837, 1004, 1169, 1213, 1202, 1203, 1142, 980, 855, 932, 1155, 1306, 1268, 1162, 1196, 1405, 1597, 1624, 1569, 1593, 1696, 1770, 1763, 1679, 1519, 1304, 1080, 837, 546, 255, 24, -190, -426, -569, -508, -376, -405, -517, -352, 200, 764, 972, 959, 1121, 1521, 1866, 1974, 1935, 1805, 1463, 974, 644, 476, 87, -538, -866, -777, -822, -1118, -1008, -309, 214, 101, -146, -54, 137, 116, 20, -7, -135, -419, -568, -449, -446, -942, -1638, -1868, -1622, -1688, -2462, -3172, -2887, -1908, -1350, -1549, -1804, -1553, -933, -306, 0, -254, -826, -1145, -1220, -1649, -2519, -3219, -3481, -3622, -3808, -3929, -4015, -3997, -3516, -2581, -1810, -1522, -1248, -530, 391, 981, 1009, 599, 47, -379, -646, -897, -1179, -1432, -1653, -1772, -1548, -924, -280, 54, 263, 694, 1308, 1806, 2104, 2349, 2617, 2845, 2990, 3065, 3054, 2860, 2417, 1778, 1081, 417, -157, -496, -483, -329, -399, -598, -390, 396, 1238, 1629, 1638, 1592, 1675, 1977, 2474, 2819, 2567, 1765, 1002, 672, 499, 43, -629, -1121, -1307, -1322, -1210, -985, -758, -503, -69, 314, 100, -684, -1281, -1285, -1337, -2258, -3898, -5365, -6176, -6624, -7048, -7328, -7223, -6743, -5951, -4759, -3126, -1179, 900, 2922, 4677, 6062, 7108, 7794, 8086, 8117, 7998, 7556, 6610, 5340, 4052, 2871, 1885, 1130, 407, -311, -504, 141, 1073, 1851, 3006, 4915, 6889, 8325, 9639, 11165, 12391, 13000, 13410, 13743, 13421, 12246, 10859, 9726, 8509, 6810, 4950, 3474, 2375, 1336, 466, 143, 331, 676, 1116, 1853, 2799, 3593, 4130, 4623, 5172, 5586, 5669, 5439, 5002, 4412, 3720, 2992, 2186, 1185, 41, -1037, -1934, -2714, -3394, -3892, -4217, -4496, -4766, -4896, -4775, -4476, -4176, -3975, -3847, -3716, -3519, -3287, -3152, -3247, -3526, -3780, -3889, -3967, -4167, -4402, -4451, -4334, -4281, -4320, -4246, -4048, -3926, -3862, -3703, -3612, -3821, -4074, -3975, -3688, -3618, -3700, -3609, -3352, -3111, -2842, -2440, -2050, -1820, -1596, -1183, -707, -431, -323, -135, 127, 191, 1, -193, -276, -412, -714, -1086, -1455, -1874, -2324, -2669, -2876, -3069, -3284, -3352, -3168, -2862, -2555, -2159, -1629, -1140, -814, -517, -155, 83, 14, -247, -477, -714, -1164, -1828, -2479, -3009, -3543, -4175, -4833, -5441, -5936, -6204, -6223, -6199, -6278, -6308, -6113, -5753, -5347, -4923, -4562, -4351, -4207, -4022, -3907, -3971, -4136, -4359, -4777, -5392, -5996, -6531, -7133, -7779, -8247, -8481, -8642, -8743, -8591, -8144, -7652, -7288, -6901, -6328, -5712, -5237, -4817, -4308, -3817, -3506, -3265, -2947, -2678, -2659, -2782, -2797, -2734, -2869, -3242, -3572, -3675, -3694, -3783, -3842, -3738, -3540, -3321, -2943, -2303, -1638, -1221, -867, -239, 449, 709, 616, 661, 845, 738, 343, 53, -82, -316, -611, -759, -837, -1015, -1177, -1133, -987, -984, -1147, -1282, -1248, -1099, -986, -997, -1100, -1210, -1266, -1266, -1278, -1389, -1608, -1849, -2023, -2109, -2166, -2266, -2437, -2626, -2750, -2777, -2700, -2537, -2382, -2318, -2258, -2066, -1835, -1761, -1774, -1671, -1518, -1522, -1640, -1688, -1642, -1528, -1294, -1036, -920, -804, -418, 85, 308, 275, 353, 590, 718, 706, 791, 996, 1072, 989, 1049, 1374, 1667, 1716, 1745, 1961, 2164, 2133, 2071, 2240, 2495, 2538, 2396, 2334, 2445, 2573, 2565, 2442, 2311, 2176, 1965, 1760, 1740, 1809, 1620, 1175, 974, 1254, 1577, 1510, 1283, 1338, 1627, 1827, 1947, 2226, 2603, 2740, 2566, 2404, 2458, 2487, 2215, 1807, 1623, 1621, 1413, 925, 555, 558, 670, 581, 418, 474, 737, 1001, 1250, 1596, 1940, 2086, 2133, 2369, 2757, 2944, 2851, 2766, 2802, 2742, 2534, 2415, 2449, 2393, 2149, 1941, 1953, 2070, 2113, 2107, 2201, 2416, 2634, 2775, 2884, 3031, 3214, 3362, 3396, 3350, 3391, 3575, 3706, 3635, 3523, 3551, 3601, 3513, 3391, 3379, 3384, 3320, 3344, 3561, 3747, 3655, 3450, 3459, 3628, 3607, 3371, 3291, 3493, 3643, 3516, 3360, 3444, 3617, 3599, 3427, 3351, 3413, 3449, 3405, 3371, 3338, 3251, 3191, 3229, 3237, 3141, 3094, 3122, 3004, 2736, 2608, 2643, 2535, 2235, 2002, 1870, 1658, 1417, 1349, 1417, 1448, 1472, 1592, 1740, 1795, 1813, 1937, 2153, 2261, 2068, 1660, 1360, 1338, 1362, 1153, 819, 643, 624, 572, 501, 570, 743, 835, 840, 922, 1133, 1354, 1491, 1576, 1657, 1710, 1709, 1739, 1910, 2148, 2195, 1918, 1517, 1274, 1220, 1167, 1008, 802, 638, 579, 717, 1096, 1564, 1885, 2015, 2140, 2371, 2568, 2531, 2305, 2098, 1921, 1569, 1069, 794, 879, 898, 518, 119, 243, 664, 654, 90, -328, -111, 347, 426, 184, 178, 581, 991, 1055, 880, 761, 784, 801, 648, 289, -165, -537, -763, -987, -1348, -1686, -1733, -1564, -1520, -1673, -1750, -1606, -1371, -1165, -1042, -1084, -1214, -1157, -860, -693, -892, -1131, -1030, -808, -900, -1123, -922, -439, -501, -1288, -1907, -1725, -1296, -1407, -1930, -2177, -1910, -1510, -1354, -1367, -1160, -540, 169, 470, 322, 228, 574, 1111, 1284, 971, 618, 615, 799, 766, 460, 238, 428, 916, 1210, 980, 517, 461, 962, 1437, 1354, 941, 820, 1150, 1500, 1481, 1195, 964, 844, 589, -17, -922, -1902, -2780, -3570, -4422, -5446, -6514, -7302, -7584, -7457, -7166, -6774, -6179, -5360, -4351, -3089, -1617, -288, 633, 1340, 2122, 2860, 3260, 3304, 3136, 2766, 2172, 1470, 743, -81, -1029, -1917, -2530, -2850, -3007, -3038, -2791, -2123, -1097, 68, 1230, 2425, 3755, 5176, 6461, 7453, 8259, 9041, 9680, 9887, 9612, 9083, 8481, 7793, 6961, 5988, 4899, 3779, 2858, 2333, 2119, 1919, 1605, 1421, 1642, 2168, 2616, 2863, 3228, 3940, 4717, 5168, 5389, 5751, 6211, 6329, 5953, 5438, 5065, 4637, 3869, 2897, 2041, 1302, 448, -500, -1305, -1908, -2446, -2915, -3162, -3166, -3087, -3035, -2967, -2758, -2395, -2084, -2035, -2133, -2074, -1874, -1842, -2002, -1995, -1701, -1477, -1586, -1756, -1650, -1446, -1542, -1896, -2104, -2080, -2159, -2488, -2796, -2871, -2844, -2887, -2987, -3105, -3261, -3396, -3366, -3169, -2995, -2995, -3051, -2885, -2385, -1751, -1247, -885, -441, 232, 965, 1444, 1627, 1756, 1875, 1687, 1081, 401, -91, -648, -1550, -2544, -3186, -3470, -3715, -3993, -4054, -3775, -3328, -2843, -2236, -1480, -723, -30, 720, 1540, 2206, 2552, 2657, 2629, 2433, 1973, 1229, 262, -830, -1962, -3093, -4208, -5252, -6126, -6762, -7182, -7430, -7481, -7251, -6719, -5991, -5201, -4417, -3682, -3061, -2597, -2268, -2086, -2199, -2743, -3589, -4374, -4937, -5570, -6617, -7850, -8673, -8982, -9286, -9810, -10136, -9985, -9681, -9525, -9287, -8706, -7945, -7273, -6665, -6012, -5373, -4840, -4360, -3957, -3852, -4054, -4135, -3848, -3609, -3839, -4267, -4435, -4372, -4280, -4077, -3743, -3507, -3389, -3105, -2613, -2180, -1862, -1453, -1011, -872, -1072, -1174, -894, -563, -681, -1195, -1562, -1462, -1140, -993, -1106, -1276, -1283, -1072, -767, -591, -667, -883, -960, -750, -440, -388, -676, -993, -1081, -1112, -1377, -1821, -2245, -2670, -3136, -3466, -3588, -3722, -3958, -4028, -3794, -3503, -3324, -3052, -2518, -1914, -1519, -1332, -1122, -751, -364, -255, -526, -937, -1149, -1095, -1042, -1238, -1584, -1730, -1482, -997, -577, -352, -222, 9, 401, 736, 800, 793, 1105, 1654, 1942, 1864, 1870, 2234, 2687, 2928, 2997, 3001, 2925, 2802, 2760, 2781, 2682, 2462, 2380, 2500, 2529, 2357, 2324, 2596, 2782, 2603, 2369, 2401, 2509, 2433, 2257, 2130, 2032, 2000, 2158, 2394, 2395, 2195, 2281, 2869, 3477, 3620, 3541, 3680, 3914, 3929, 3842, 3794, 3533, 2981, 2621, 2718, 2808, 2441, 1898, 1720, 1911, 2039, 1857, 1550, 1421, 1563, 1841, 2057, 2106, 2108, 2294, 2664, 2918, 2879, 2734, 2678, 2623, 2451, 2198, 1885, 1472, 1071, 874, 820, 642, 300, 88, 227, 573, 844, 981, 1132, 1379, 1647, 1877, 2087, 2219, 2124, 1833, 1629, 1692, 1802, 1638, 1266, 1041, 1074, 1092, 900, 684, 717, 939, 1056, 976, 971, 1309, 1871, 2283, 2374, 2359, 2512, 2805, 2987, 2926, 2743, 2595, 2491, 2389, 2305, 2233, 2116, 2002, 2080, 2414, 2773, 2931, 2997, 3245, 3657, 3917, 3897, 3844, 3940, 3994, 3773, 3414, 3207, 3134, 2910, 2441, 1947, 1602, 1312, 959, 655, 556, 577, 494, 287, 180, 348, 691, 959, 1029, 998, 1027, 1149, 1249, 1214, 1060, 895, 780, 668, 510, 349, 293, 370, 493, 568, 588, 644, 814, 1062, 1246, 1282, 1242, 1248, 1299, 1286, 1180, 1101, 1177, 1356, 1439, 1341, 1221, 1257, 1362, 1313, 1136, 1093, 1276, 1479, 1565, 1659, 1875, 2083, 2150, 2193, 2331, 2361, 2052, 1622, 1445, 1396, 1057, 479, 117, 87, 106, 43, -7, 3, 146, 527, 986, 1196, 1210, 1413, 1857, 2141, 2069, 1911, 1900, 1880, 1672, 1435, 1350, 1244, 899, 504, 330, 205, -179, -700, -1027, -1165, -1355, -1640, -1830, -1696, -1181, -583, -359, -485, -359, 308, 993, 1072, 656, 339, 438, 737, 794, 424, -54, -161, 69, 46, -527, -1103, -997, -462, -398, -956, -1215, -577, 319, 643, 528, 583, 918, 1255, 1419, 1327, 964, 576, 426, 406, 261, 39, -81, -194, -428, -474, 66, 889, 1184, 861, 777, 1418, 2194, 2512, 2559, 2617, 2569, 2429, 2403, 2241, 1468, 267, -748, -1564, -2706, -4267, -5705, -6674, -7438, -8244, -8848, -8932, -8549, -7832, -6761, -5494, -4286, -2918, -1000, 1084, 2559, 3498, 4600, 5860, 6582, 6579, 6309, 5997, 5386, 4341, 3073, 1811, 621, -501, -1561, -2553, -3396, -3868, -3810, -3328, -2640, -1735, -503, 972, 2568, 4367, 6352, 8140, 9458, 10522, 11564, 12363, 12629, 12428, 11958, 11239, 10240, 9024, 7642, 6086, 4435, 2896, 1629, 627, -181, -812, -1255, -1460, -1281, -587, 431, 1403, 2262, 3281, 4528, 5705, 6632, 7416, 8046, 8271, 8019, 7580, 7142, 6488, 5347, 3837, 2316, 931, -426, -1792, -3060, -4186, -5180, -5921, -6237, -6194, -6036, -5869, -5524, -4808, -3775, -2731, -1936, -1360, -773, -90, 515, 836, 840, 628, 319, -36, -505, -1187, -2012, -2749, -3315, -3886, -4559, -5119, -5314, -5233, -5157, -5110, -4854, -4341, -3817, -3400, -2981, -2576, -2337, -2157, -1786, -1368, -1247, -1339, -1284, -1090, -1031, -1070, -938, -692, -654, -828, -869, -683, -602, -819, -1073, -1169, -1328, -1704, -2080, -2296, -2503, -2770, -2970, -3108, -3280, -3342, -3129, -2858, -2808, -2827, -2546, -1983, -1489, -1202, -936, -636, -500, -554, -566, -576, -950, -1734, -2508, -3069, -3658, -4426, -5246, -6062, -6864, -7433, -7620, -7662, -7794, -7832, -7498, -6900, -6351, -5879, -5322, -4748, -4391, -4184, -3911, -3749, -4025, -4515, -4778, -5022, -5714, -6609, -7156, -7498, -8108, -8841, -9232, -9284, -9274, -9233, -9079, -8827, -8412, -7693, -6779, -5984, -5380, -4714, -3912, -3298, -3017, -2727, -2284, -2161, -2579, -2949, -2904, -2946, -3380, -3707, -3681, -3717, -3845, -3621, -3182, -3040, -2972, -2455, -1795, -1612, -1676, -1361, -786, -563, -772, -932, -830, -749, -894, -1139, -1406, -1733, -1932, -1830, -1794, -2169, -2501, -2275, -1892, -1856, -1765, -1221, -742, -751, -766, -419, -127, -188, -359, -587, -1099, -1710, -1987, -2067, -2487, -3252, -3765, -3752, -3603, -3626, -3554, -3180, -2786, -2522, -2086, -1450, -1011, -765, -366, -25, -166, -411, -190, 71, -288, -867, -883, -539, -556, -906, -1004, -728, -473, -388, -226, 105, 449, 849, 1418, 1862, 1941, 2142, 2891, 3526, 3278, 2689, 2704, 3067, 2955, 2451, 2168, 2139, 2071, 2057, 2286, 2559, 2667, 2857, 3379, 3917, 4070, 4092, 4416, 4719, 4474, 4000, 3882, 3845, 3387, 2821, 2542, 2194, 1575, 1267, 1504, 1619, 1299, 1224, 1850, 2603, 2900, 3104, 3783, 4691, 5176, 5263, 5452, 5769, 5849, 5683, 5414, 4848, 3983, 3377, 3209, 2797, 1784, 853, 636, 782, 703, 488, 535, 877, 1286, 1703, 2170, 2554, 2739, 2905, 3241, 3536, 3509, 3304, 3191, 3079, 2771, 2396, 2132, 1837, 1347, 857, 630, 600, 535, 461, 571, 840, 1075, 1287, 1627, 1988, 2166, 2272, 2508, 2706, 2635, 2481, 2486, 2460, 2164, 1789, 1640, 1643, 1556, 1368, 1245, 1262, 1375, 1519, 1597, 1511, 1323, 1259, 1391, 1476, 1344, 1204, 1278, 1401, 1344, 1254, 1355, 1515, 1474, 1263, 1118, 1171, 1373, 1579, 1665, 1686, 1821, 2075, 2266, 2352, 2459, 2553, 2443, 2147, 1913, 1857, 1840, 1693, 1377, 1010, 811, 861, 929, 801, 636, 684, 848, 886, 864, 992, 1175, 1136, 885, 740, 862, 1034, 975, 728, 583, 692, 908, 994, 912, 856, 996, 1191, 1154, 971, 1062, 1445, 1629, 1493, 1537, 1949, 2260, 2240, 2238, 2388, 2392, 2196, 2080, 2064, 1937, 1741, 1655, 1629, 1560, 1510, 1508, 1435, 1265, 1107, 954, 682, 357, 226, 283, 163, -282, -622, -447, -57, -45, -367, -445, -73, 306, 314, 127, 128, 339, 435, 243, 19, 83, 311, 299, -9, -221, -104, 103, 114, -29, -119, -55, 100, 209, 203, 239, 475, 730, 732, 616, 666, 718, 409, -120, -439, -558, -839, -1321, -1682, -1737, -1574, -1312, -991, -625, -213, 229, 653, 996, 1253, 1418, 1465, 1378, 1166, 850, 497, 192, -78, -434, -891, -1281, -1482, -1558, -1612, -1629, -1552, -1333, -908, -283, 372, 880, 1305, 1889, 2668, 3342, 3659, 3737, 3808, 3821, 3587, 3114, 2524, 1858, 1184, 593, -18, -772, -1406, -1598, -1577, -1811, -2180, -2141, -1622, -1139, -1056, -1190, -1150, -839, -574, -793, -1555, -2425, -3027, -3540, -4413, -5678, -6839, -7498, -7786, -8076, -8385, -8329, -7672, -6689, -5795, -4959, -3838, -2404, -1015, 100, 1035, 1873, 2597, 3227, 3679, 3712, 3362, 3060, 2987, 2745, 2020, 1184, 801, 856, 891, 722, 644, 952, 1610, 2432, 3315, 4207, 5130, 6205, 7387, 8373, 9084, 9817, 10592, 10920, 10661, 10372, 10339, 10094, 9280, 8265, 7492, 6873, 6176, 5465, 4892, 4407, 3974, 3773, 3880, 4024, 4010, 4074, 4439, 4856, 5056, 5236, 5569, 5762, 5561, 5231, 5053, 4807, 4173, 3295, 2507, 1759, 830, -115, -775, -1323, -2077, -2737, -2845, -2694, -2779, -2829, -2457, -2095, -2175, -2209, -1755, -1378, -1683, -2267, -2495, -2507, -2776, -3277, -3693, -4028, -4458, -4848, -4943, -4906, -5075, -5314, -5249, -4936, -4651, -4318, -3780, -3270, -2969, -2605, -2018, -1533, -1396, -1414, -1441, -1617, -1988, -2362, -2662, -3008, -3432, -3794, -3956, -3893, -3675, -3381, -3000, -2501, -1963, -1477, -939, -274, 233, 271, 96, 203, 497, 404, -188, -773, -988, -1028, -1256, -1744, -2245, -2457, -2352, -2227, -2304, -2388, -2135, -1585, -1139, -957, -721, -204, 263, 278, 6, -151, -265, -698, -1453, -2272, -3071, -3868, -4565, -5148, -5765, -6373, -6697, -6664, -6528, -6440, -6268, -5909, -5489, -5157, -4897, -4649, -4480, -4491, -4649, -4881, -5195, -5617, -6088, -6590, -7197, -7861, -8381, -8676, -8928, -9270, -9521, -9434, -9093, -8746, -8363, -7759, -7065, -6540, -6045, -5307, -4537, -4146, -4030, -3812, -3549, -3539, -3707, -3773, -3801, -4035, -4390, -4542, -4450, -4373, -4386, -4277, -3976, -3629, -3207, -2561, -1876, -1443, -1075, -422, 292, 598, 590, 698, 901, 857, 571, 337, 208, -6, -304, -499, -600, -803, -1058, -1091, -923, -864, -906, -735, -348, -73, 61, 301, 601, 702, 647, 671, 722, 576, 247, -60, -322, -714, -1283, -1822, -2143, -2324, -2561, -2888, -3125, -3064, -2694, -2296, -2166, -2144, -1774, -1068, -629, -713, -829, -587, -289, -294, -440, -449, -407, -501, -664, -744, -775, -876, -1023, -1108, -1096, -1028, -908, -765, -668, -571, -311, 87, 376, 475, 600, 859, 1040, 1001, 928, 989, 1023, 843, 610, 626, 852, 975, 935, 1023, 1395, 1798, 1975, 2051, 2292, 2644, 2822, 2754, 2667, 2706, 2742, 2623, 2386, 2152, 1953, 1749, 1509, 1227, 926, 668, 502, 391, 294, 322, 615, 1039, 1323, 1529, 1991, 2675, 3112, 3151, 3192, 3447, 3559, 3235, 2743, 2431, 2181, 1675, 947, 300, -163, -569, -927, -1151, -1316, -1470, -1367, -846, -185, 311, 776, 1423, 2187, 2940, 3626, 4080, 4190, 4238, 4521, 4798, 4623, 4078, 3628, 3393, 3042, 2396, 1737, 1358, 1162, 885, 547, 404, 566, 873, 1137, 1329, 1567, 1991, 2573, 3121, 3511, 3854, 4242, 4576, 4760, 4865, 4946, 4914, 4711, 4421, 4122, 3803, 3453, 3076, 2690, 2374, 2185, 2014, 1756, 1561, 1622, 1787, 1776, 1669, 1773, 2080, 2279, 2234, 2159, 2289, 2577, 2757, 2671, 2495, 2534, 2797, 2950, 2802, 2606, 2704, 3009, 3144, 3015, 2949, 3165, 3436, 3464, 3315, 3198, 3105, 2906, 2594, 2226, 1847, 1551, 1411, 1337, 1236, 1205, 1342, 1525, 1625, 1738, 1989, 2299, 2527, 2705, 2942, 3192, 3317, 3320, 3340, 3392, 3309, 3004, 2609, 2298, 2061, 1752, 1269, 665, 123, -211, -402, -649, -995, -1193, -1019, -596, -220, 112, 652, 1365, 1874, 2067, 2286, 2696, 2940, 2709, 2247, 1966, 1913, 1832, 1558, 1184, 921, 866, 904, 847, 688, 606, 704, 834, 828, 838, 1136, 1627, 1951, 2077, 2315, 2716, 3024, 3190, 3344, 3358, 3043, 2605, 2352, 2198, 1901, 1474, 1047, 684, 509, 595, 738, 707, 650, 817, 1040, 954, 626, 484, 574, 409, -233, -875, -1085, -1133, -1441, -1892, -2165, -2236, -2176, -2023, -1987, -2131, -1983, -1232, -421, -139, -46, 456, 1196, 1640, 1758, 1802, 1748, 1464, 1056, 658, 160, -553, -1295, -1805, -2144, -2559, -3008, -3195, -3037, -2746, -2448, -2056, -1486, -728, 144, 901, 1391, 1841, 2529, 3226, 3488, 3395, 3411, 3601, 3557, 3103, 2543, 2178, 1884, 1308, 400, -373, -580, -525, -902, -1667, -1954, -1391, -757, -875, -1462, -1658, -1269, -965, -1375, -2339, -3152, -3445, -3642, -4337, -5417, -6207, -6425, -6519, -6901, -7305, -7209, -6642, -6104, -5811, -5448, -4735, -3842, -3080, -2519, -2043, -1547, -1009, -536, -328, -435, -646, -772, -905, -1247, -1774, -2257, -2541, -2669, -2737, -2736, -2552, -2145, -1602, -1005, -320, 509, 1421, 2288, 3059, 3745, 4368, 4984, 5585, 5993, 6081, 6054, 6126, 6120, 5813, 5392, 5076, 4693, 4118, 3634, 3393, 3098, 2603, 2243, 2224, 2288, 2260, 2369, 2761, 3173, 3391, 3659, 4228, 4832, 5094, 5169, 5404, 5641, 5539, 5236, 5015, 4713, 4081, 3323, 2713, 2138, 1415, 644, -30, -609, -1074, -1366, -1571, -1834, -2030, -1866, -1410, -1121, -1128, -960, -370, 148, 185, 126, 400, 680, 474, -42, -423, -684, -1110, -1713, -2293, -2776, -3220, -3615, -3882, -4036, -4148, -4174, -3998, -3645, -3268, -2931, -2574, -2126, -1544, -903, -447, -268, -51, 454, 887, 819, 519, 512, 671, 479, -40, -402, -476, -619, -1041, -1513, -1749, -1770, -1774, -1830, -1830, -1666, -1343, -972, -660, -394, -29, 476, 925, 1157, 1317, 1581, 1846, 1920, 1868, 1885, 1933, 1797, 1440, 1065, 802, 539, 139, -353, -815, -1256, -1740, -2225, -2614, -2932, -3283, -3635, -3836, -3879, -3918, -4002, -3990, -3846, -3738, -3764, -3822, -3824, -3844, -3956, -4128, -4320, -4569, -4859, -5097, -5298, -5625, -6094, -6459, -6606, -6796, -7263, -7793, -8051, -8112, -8284, -8601, -8812, -8802, -8727, -8709, -8676, -8532, -8308, -8050, -7786, -7590, -7485, -7273, -6817, -6363, -6176, -6042, -5631, -5051, -4559, -4111, -3620, -3242, -2995, -2617, -2091, -1794, -1869, -1976, -1866, -1790, -2032, -2397, -2540, -2551, -2762, -3144, -3360, -3337, -3290, -3294, -3263, -3182, -3005, -2597, -2042, -1623, -1329, -885, -297, 170, 506, 903, 1281, 1382, 1219, 1003, 805, 513, 20, -675, -1404, -1936, -2311, -2822, -3503, -3957, -3962, -3883, -4125, -4414, -4185, -3542, -3211, -3426, -3498, -2888, -2058, -1753, -1916, -1896, -1441, -938, -814, -1017, -1111, -866, -626, -832, -1282, -1400, -1205, -1287, -1797, -2235, -2308, -2300, -2469, -2660, -2661, -2514, -2351, -2185, -1938, -1574, -1165, -828, -598, -355, 48, 567, 961, 1160, 1444, 1992, 2496, 2611, 2550, 2731, 3049, 3074, 2775, 2508, 2431, 2367, 2187, 1948, 1701, 1456, 1303, 1302, 1287, 1093, 940, 1183, 1685, 1985, 2068, 2341, 2845, 3173, 3232, 3390, 3789, 4089, 4069, 3971, 4067, 4246, 4280, 4206, 4137, 3969, 3608, 3240, 3018, 2806, 2478, 2171, 1971, 1768, 1588, 1638, 1893, 2075, 2101, 2165, 2380, 2650, 2912, 3198, 3428, 3435, 3282, 3297, 3606, 3858, 3702, 3331, 3249, 3542, 3774, 3639, 3367, 3308, 3402, 3318, 3001, 2729, 2671, 2669, 2489, 2170, 2017, 2248, 2634, 2720, 2454, 2343, 2709, 3163, 3172, 2881, 2894, 3352, 3768, 3824, 3852, 4235, 4784, 5087, 5145, 5213, 5327, 5346, 5250, 5069, 4751, 4311, 3880, 3519, 3156, 2757, 2379, 2056, 1803, 1673, 1693, 1788, 1905, 2135, 2571, 3063, 3375, 3562, 3919, 4475, 4865, 4877, 4786, 4887, 4982, 4693, 4115, 3683, 3453, 2999, 2166, 1375, 974, 771, 471, 152, 73, 305, 710, 1114, 1428, 1732, 2211, 2860, 3381, 3537, 3510, 3646, 3891, 3845, 3414, 2961, 2651, 2212, 1540, 939, 567, 226, -147, -353, -368, -398, -414, -177, 287, 655, 803, 975, 1359, 1769, 1942, 1929, 1949, 2019, 1974, 1757, 1441, 1092, 750, 456, 183, -113, -380, -527, -559, -505, -321, -2, 336, 625, 946, 1370, 1793, 2053, 2133, 2124, 2050, 1841, 1479, 1050, 626, 182, -292, -692, -905, -993, -1079, -1111, -909, -487, -86, 170, 430, 823, 1217, 1420, 1483, 1577, 1700, 1668, 1408, 1048, 713, 363, -85, -612, -1169, -1765, -2367, -2804, -2947, -2938, -3015, -3116, -2942, -2410, -1798, -1347, -997, -584, -90, 335, 530, 502, 465, 548, 562, 298, -70, -229, -238, -404, -728, -900, -827, -774, -912, -1074, -1075, -1015, -1026, -994, -823, -693, -764, -847, -709, -462, -380, -529, -778, -977, -1061, -1147, -1401, -1704, -1753, -1605, -1635, -1841, -1777, -1325, -930, -862, -839, -581, -258, -148, -195, -184, -122, -189, -390, -559, -629, -674, -736, -831, -1019, -1283, -1494, -1630, -1831, -2143, -2436, -2628, -2745, -2756, -2610, -2395, -2223, -2005, -1569, -973, -466, -115, 256, 699, 1017, 1158, 1362, 1702, 1862, 1646, 1339, 1255, 1215, 876, 287, -227, -595, -1056, -1697, -2285, -2623, -2799, -2962, -3077, -3023, -2747, -2255, -1635, -1068, -636, -200, 364, 935, 1300, 1423, 1423, 1382, 1282, 1076, 748, 334, -111, -593, -1150, -1741, -2247, -2627, -2970, -3346, -3689, -3830, -3649, -3237, -2861, -2639, -2304, -1579, -658, 25, 422, 835, 1344, 1701, 1776, 1733, 1704, 1600, 1323, 949, 593, 265, -31, -240, -397, -654, -990, -1157, -1059, -922, -927, -964, -881, -665, -350, 33, 382, 620, 793, 941, 1021, 1039, 1060, 1011, 722, 220, -277, -644, -936, -1287, -1776, -2302, -2604, -2578, -2485, -2569, -2637, -2366, -1874, -1553, -1404, -1019, -279, 383, 612, 652, 936, 1427, 1732, 1685, 1441, 1145, 858, 624, 371, -40, -557, -965, -1231, -1492, -1742, -1856, -1854, -1863, -1896, -1870, -1733, -1452, -1060, -720, -547, -389, -16, 501, 847, 870, 735, 656, 622, 480, 162, -244, -626, -959, -1276, -1597, -1895, -2116, -2231, -2268, -2286, -2293, -2232, -2070, -1859, -1692, -1595, -1529, -1449, -1320, -1122, -949, -953, -1087, -1083, -847, -673, -803, -1047, -1100, -1061, -1256, -1631, -1796, -1695, -1724, -2004, -2108, -1822, -1526, -1478, -1386, -1063, -777, -646, -416, -66, 80, 2, 72, 358, 465, 234, 64, 253, 448, 203, -290, -546, -544, -616, -885, -1276, -1741, -2107, -2132, -1976, -2061, -2339, -2315, -1868, -1418, -1222, -1066, -740, -376, -177, -107, -12, 114, 175, 138, 24, -129, -197, -93, -36, -282, -629, -648, -412, -380, -601, -650, -346, 46, 291, 454, 755, 1336, 2067, 2557, 2598, 2551, 2892, 3484, 3690, 3261, 2695, 2526, 2596, 2397, 1868, 1420, 1282, 1272, 1186, 1034, 931, 1012, 1348, 1783, 2047, 2137, 2322, 2724, 3165, 3453, 3552, 3496, 3344, 3189, 3045, 2773, 2257, 1584, 967, 513, 129, -353, -979, -1591, -1921, -1847, -1586, -1534, -1769, -1892, -1574, -1048, -772, -818, -930, -959, -953, -1031, -1332, -1869, -2395, -2682, -2918, -3454, -4212, -4692, -4633, -4322, -4118, -3964, -3535, -2700, -1574, -284, 1067, 2352, 3562, 4848, 6227, 7454, 8352, 9025, 9594, 9953, 9997, 9812, 9514, 9083, 8463, 7753, 7105, 6518, 5923, 5377, 5066, 5058, 5228, 5483, 5910, 6615, 7541, 8528, 9499, 10453, 11384, 12277, 13140, 13868, 14270, 14334, 14267, 14132, 13736, 13021, 12224, 11473, 10562, 9351, 8071, 7036, 6230, 5413, 4493, 3635, 3025, 2667, 2421, 2207, 2080, 2133, 2353, 2586, 2699, 2769, 2962, 3260, 3413, 3286, 3009, 2760, 2523, 2153, 1556, 788, 6, -672, -1328, -2152, -3168, -4153, -4902, -5461, -6031, -6710, -7398, -7907, -8148, -8206, -8217, -8183, -8020, -7701, -7280, -6792, -6254, -5702, -5161, -4639, -4190, -3894, -3720, -3561, -3442, -3506, -3756, -4027, -4256, -4600, -5142, -5677, -5973, -6151, -6477, -6897, -7124, -7083, -6938, -6757, -6505, -6214, -5867, -5326, -4613, -3980, -3520, -3040, -2448, -1936, -1643, -1439, -1204, -1057, -1129, -1305, -1421, -1537, -1769, -2026, -2197, -2408, -2727, -2929, -2901, -2899, -3062, -3171, -3129, -3131, -3179, -3045, -2789, -2714, -2818, -2816, -2654, -2533, -2521, -2524, -2544, -2664, -2817, -2864, -2900, -3145, -3544, -3786, -3837, -4009, -4403, -4749, -4919, -5111, -5424, -5694, -5856, -6042, -6282, -6453, -6527, -6600, -6686, -6692, -6583, -6446, -6374, -6356, -6307, -6167, -5950, -5770, -5758, -5876, -5898, -5707, -5531, -5603, -5789, -5802, -5670, -5633, -5733, -5799, -5747, -5638, -5533, -5429, -5305, -5146, -4928, -4644, -4318, -3988, -3679, -3359, -2969, -2519, -2134, -1884, -1671, -1349, -963, -714, -669, -622, -399, -147, -108, -219, -238, -128, -19, 46, 79, 52, 81, 353, 735, 905, 911, 1098, 1494, 1802, 1940, 2083, 2260, 2352, 2376, 2405, 2381, 2256, 2152, 2152, 2078, 1723, 1238, 1004, 1104, 1151, 798, 216, -104, 34, 334, 370, 87, -131, 70, 557, 857, 758, 504, 409, 515, 668, 700, 494, 107, -206, -274, -238, -350, -660, -1011, -1250, -1342, -1375, -1475, -1638, -1717, -1653, -1542, -1423, -1213, -917, -649, -418, -139, 155, 385, 608, 868, 1018, 937, 780, 777, 925, 1036, 1001, 875, 803, 896, 1116, 1265, 1185, 985, 935, 1076, 1146, 1023, 977, 1221, 1528, 1622, 1659, 1930, 2333, 2571, 2654, 2828, 3121, 3285, 3189, 3013, 3010, 3173, 3254, 3101, 2862, 2795, 2939, 3062, 2959, 2726, 2634, 2717, 2742, 2585, 2421, 2438, 2602, 2819, 3094, 3408, 3666, 3861, 4147, 4583, 4975, 5124, 5109, 5104, 5075, 4872, 4559, 4307, 4051, 3613, 3070, 2689, 2494, 2252, 1879, 1583, 1549, 1686, 1792, 1851, 2023, 2394, 2875, 3333, 3719, 4076, 4445, 4795, 5019, 5059, 4966, 4778, 4447, 3947, 3355, 2689, 1886, 1016, 306, -163, -580, -1090, -1519, -1600, -1338, -984, -676, -300, 273, 974, 1640, 2224, 2777, 3286, 3653, 3816, 3834, 3814, 3739, 3464, 2912, 2242, 1661, 1162, 615, 37, -431, -754, -972, -1040, -850, -432, 36, 464, 950, 1606, 2369, 3056, 3577, 3978, 4319, 4576, 4704, 4707, 4607, 4392, 4042, 3597, 3165, 2810, 2467, 2070, 1696, 1482, 1410, 1357, 1319, 1418, 1668, 1929, 2114, 2322, 2634, 2958, 3128, 3144, 3125, 3115, 3049, 2896, 2703, 2486, 2213, 1880, 1532, 1233, 1041, 936, 803, 581, 387, 339, 378, 385, 396, 476, 555, 547, 526, 597, 718, 777, 756, 712, 664, 582, 475, 394, 346, 276, 151, 5, -116, -195, -239, -281, -349, -397, -347, -246, -225, -299, -347, -320, -306, -358, -437, -516, -628, -775, -895, -964, -1027, -1115, -1194, -1260, -1365, -1476, -1458, -1309, -1223, -1298, -1348, -1183, -880, -641, -525, -435, -280, -64, 120, 182, 137, 93, 81, 3, -198, -435, -602, -729, -904, -1111, -1229, -1192, -1075, -975, -866, -657, -380, -158, -8, 201, 484, 646, 581, 492, 628, 902, 983, 773, 555, 603, 823, 918, 770, 517, 393, 538, 808, 847, 586, 478, 856, 1342, 1369, 1068, 1023, 1314, 1418, 1016, 392, -91, -505, -1142, -2065, -3118, -4162, -5096, -5844, -6463, -7094, -7652, -7858, -7644, -7202, -6636, -5857, -4881, -3853, -2772, -1493, -79, 1119, 1905, 2486, 3099, 3606, 3715, 3407, 2857, 2124, 1191, 176, -813, -1861, -3027, -4093, -4772, -5071, -5224, -5277, -5006, -4265, -3204, -2020, -710, 813, 2503, 4190, 5719, 7017, 8134, 9151, 9979, 10372, 10240, 9786, 9233, 8533, 7530, 6267, 4985, 3816, 2685, 1551, 554, -144, -531, -672, -584, -268, 272, 1054, 2066, 3222, 4419, 5583, 6608, 7411, 8065, 8699, 9200, 9257, 8761, 7975, 7183, 6358, 5275, 3892, 2425, 1093, -75, -1173, -2236, -3204, -3944, -4342, -4403, -4264, -4058, -3790, -3373, -2750, -1954, -1124, -432, 54, 427, 759, 977, 958, 719, 361, -120, -803, -1638, -2417, -3031, -3600, -4272, -4959, -5447, -5669, -5740, -5754, -5707, -5562, -5323, -5009, -4639, -4255, -3924, -3688, -3481, -3171, -2769, -2498, -2519, -2677, -2658, -2432, -2307, -2494, -2792, -2879, -2758, -2708, -2860, -3038, -3073, -3010, -2968, -2956, -2927, -2858, -2735, -2541, -2311, -2139, -2059, -1976, -1790, -1557, -1414, -1396, -1395, -1314, -1182, -1081, -1051, -1069, -1099, -1138, -1211, -1315, -1445, -1631, -1914, -2234, -2482, -2668, -2917, -3277, -3615, -3819, -3964, -4177, -4420, -4526, -4460, -4385, -4414, -4471, -4419, -4244, -4050, -3977, -4091, -4258, -4276, -4165, -4173, -4411, -4700, -4885, -5043, -5270, -5515, -5742, -6040, -6421, -6689, -6695, -6593, -6652, -6853, -6908, -6687, -6374, -6171, -6053, -5881, -5604, -5292, -5058, -4940, -4863, -4740, -4613, -4567, -4566, -4489, -4309, -4107, -3920, -3694, -3418, -3144, -2887, -2571, -2203, -1930, -1839, -1789, -1617, -1409, -1382, -1550, -1692, -1649, -1525, -1514, -1644, -1759, -1730, -1600, -1478, -1357, -1148, -860, -581, -291, 88, 528, 952, 1347, 1683, 1880, 2023, 2261, 2436, 2246, 1821, 1592, 1543, 1246, 618, 74, -147, -272, -528, -806, -886, -729, -483, -283, -127, 108, 530, 1064, 1455, 1586, 1702, 2038, 2374, 2388, 2259, 2319, 2401, 2168, 1786, 1591, 1491, 1276, 1049, 884, 592, 180, 26, 270, 544, 540, 455, 615, 996, 1365, 1664, 1968, 2216, 2306, 2338, 2424, 2465, 2390, 2361, 2426, 2353, 2093, 1980, 2187, 2411, 2379, 2277, 2380, 2606, 2716, 2731, 2854, 3087, 3226, 3235, 3313, 3559, 3825, 3969, 4019, 4080, 4217, 4439, 4674, 4798, 4793, 4795, 4894, 4987, 4951, 4869, 4926, 5105, 5199, 5140, 5099, 5192, 5329, 5405, 5418, 5365, 5229, 5079, 5011, 4984, 4880, 4689, 4512, 4390, 4255, 4088, 3956, 3870, 3733, 3516, 3314, 3165, 2988, 2761, 2580, 2463, 2316, 2137, 2025, 1993, 1933, 1814, 1703, 1634, 1585, 1527, 1441, 1295, 1074, 832, 631, 438, 175, -156, -473, -744, -1020, -1302, -1523, -1683, -1868, -2109, -2316, -2406, -2402, -2367, -2316, -2227, -2103, -1960, -1788, -1549, -1258, -994, -829, -744, -672, -591, -553, -609, -735, -853, -933, -1027, -1178, -1361, -1511, -1598, -1649, -1694, -1730, -1738, -1694, -1578, -1373, -1064, -668, -238, 170, 545, 922, 1319, 1670, 1869, 1892, 1834, 1796, 1750, 1597, 1315, 992, 720, 504, 298, 88, -78, -161, -192, -219, -219, -102, 151, 445, 670, 837, 1036, 1282, 1506, 1679, 1824, 1891, 1764, 1484, 1264, 1187, 1040, 620, 74, -264, -321, -350, -546, -773, -765, -492, -164, 60, 227, 436, 686, 904, 1062, 1154, 1142, 989, 749, 540, 376, 142, -229, -627, -899, -1066, -1252, -1467, -1566, -1485, -1349, -1281, -1201, -935, -475, -1, 356, 648, 969, 1304, 1556, 1670, 1705, 1751, 1778, 1637, 1266, 848, 633, 619, 572, 354, 135, 157, 412, 667, 792, 890, 1100, 1405, 1688, 1867, 1956, 2039, 2164, 2265, 2257, 2159, 2023, 1824, 1573, 1399, 1348, 1239, 935, 615, 538, 670, 768, 780, 880, 1148, 1419, 1538, 1600, 1789, 2087, 2288, 2271, 2116, 1966, 1862, 1718, 1445, 1089, 782, 565, 353, 119, -28, -24, 26, -15, -133, -219, -263, -344, -473, -564, -599, -666, -809, -958, -1075, -1223, -1446, -1686, -1874, -2021, -2196, -2425, -2603, -2544, -2185, -1711, -1348, -1076, -674, -63, 563, 981, 1175, 1286, 1391, 1426, 1303, 1031, 701, 370, 1, -463, -995, -1448, -1692, -1756, -1765, -1733, -1528, -1057, -416, 194, 645, 966, 1290, 1655, 1902, 1825, 1437, 937, 457, -35, -608, -1270, -2009, -2781, -3488, -4040, -4441, -4733, -4913, -4945, -4810, -4503, -4003, -3306, -2503, -1744, -1136, -680, -341, -85, 92, 103, -208, -862, -1653, -2386, -3077, -3818, -4558, -5168, -5631, -5989, -6196, -6121, -5709, -5073, -4392, -3751, -3072, -2233, -1260, -381, 180, 458, 699, 995, 1150, 987, 624, 279, 8, -234, -443, -605, -753, -842, -763, -510, -218, 29, 333, 802, 1372, 1879, 2292, 2737, 3295, 3838, 4190, 4348, 4495, 4756, 5035, 5129, 5018, 4914, 4962, 5045, 5044, 5054, 5139, 5160, 5063, 5036, 5149, 5179, 5019, 4875, 4876, 4868, 4716, 4488, 4275, 4076, 3905, 3778, 3651, 3506, 3437, 3507, 3604, 3596, 3569, 3706, 3917, 3883, 3531, 3146, 2925, 2707, 2304, 1747, 1132, 518, -4, -388, -730, -1101, -1413, -1598, -1714, -1764, -1674, -1494, -1361, -1276, -1148, -1004, -936, -926, -938, -1056, -1357, -1750, -2086, -2377, -2768, -3287, -3766, -4049, -4159, -4216, -4240, -4156, -3927, -3605, -3264, -2943, -2636, -2373, -2252, -2309, -2422, -2445, -2460, -2651, -3008, -3341, -3557, -3724, -3870, -3950, -3986, -4029, -4006, -3785, -3410, -3084, -2877, -2610, -2172, -1749, -1593, -1629, -1551, -1300, -1164, -1331, -1591, -1694, -1749, -1977, -2298, -2491, -2578, -2732, -2923, -2979, -2889, -2792, -2724, -2580, -2329, -2081, -1922, -1804, -1688, -1651, -1779, -2053, -2386, -2705, -2991, -3298, -3692, -4085, -4272, -4239, -4211, -4281, -4237, -3915, -3483, -3179, -2949, -2586, -2107, -1755, -1648, -1647, -1598, -1567, -1698, -2002, -2379, -2745, -3081, -3402, -3735, -4066, -4325, -4441, -4428, -4347, -4247, -4120, -3907, -3535, -2992, -2384, -1844, -1401, -962, -487, -103, 33, -72, -282, -519, -806, -1134, -1419, -1597, -1693, -1761, -1832, -1875, -1832, -1708, -1585, -1522, -1452, -1256, -931, -629, -448, -319, -156, -38, -75, -191, -225, -202, -280, -447, -491, -289, 12, 199, 262, 389, 681, 999, 1133, 1071, 998, 1048, 1135, 1100, 948, 822, 759, 619, 324, 25, -104, -122, -177, -238, -130, 209, 664, 1103, 1514, 1937, 2341, 2634, 2802, 2970, 3226, 3435, 3371, 3051, 2754, 2639, 2513, 2113, 1504, 990, 689, 438, 151, -6, 93, 294, 393, 462, 731, 1239, 1736, 1960, 1942, 1959, 2167, 2377, 2325, 2064, 1857, 1759, 1563, 1166, 729, 422, 208, -51, -364, -541, -402, -44, 225, 293, 378, 612, 780, 666, 420, 283, 205, -3, -307, -485, -468, -417, -491, -630, -637, -462, -310, -325, -330, -111, 199, 312, 236, 210, 270, 218, 2, -185, -241, -291, -437, -544, -435, -170, 39, 129, 232, 424, 597, 618, 530, 510, 664, 905, 1073, 1150, 1265, 1444, 1527, 1394, 1122, 837, 563, 285, 36, -155, -293, -352, -283, -78, 214, 518, 761, 928, 1120, 1442, 1832, 2075, 2056, 1909, 1833, 1820, 1677, 1317, 882, 568, 433, 404, 382, 315, 260, 339, 557, 781, 931, 1027, 1034, 910, 785, 821, 961, 1049, 1110, 1259, 1483, 1711, 1948, 2175, 2301, 2297, 2181, 1930, 1607, 1461, 1623, 1845, 1812, 1622, 1651, 1998, 2369, 2566, 2726, 2953, 3012, 2695, 2206, 1883, 1710, 1414, 937, 476, 174, 16, 25, 288, 746, 1187, 1513, 1836, 2211, 2463, 2439, 2290, 2248, 2205, 1893, 1429, 1233, 1348, 1409, 1362, 1547, 1965, 2198, 2150, 2138, 2222, 2121, 1787, 1478, 1309, 1169, 1002, 858, 807, 947, 1362, 1957, 2499, 2882, 3213, 3574, 3836, 3857, 3715, 3514, 3149, 2535, 1902, 1488, 1185, 809, 513, 553, 874, 1277, 1741, 2305, 2806, 3027, 2967, 2809, 2676, 2491, 2119, 1646, 1363, 1314, 1184, 908, 941, 1483, 1975, 1947, 1743, 1809, 1901, 1640, 1205, 932, 762, 525, 305, 269, 444, 748, 1019, 1099, 1025, 921, 746, 424, 97, -128, -454, -995, -1451, -1550, -1458, -1359, -1051, -355, 447, 1011, 1468, 2134, 2826, 3050, 2779, 2470, 2259, 1834, 1168, 637, 319, -98, -613, -819, -610, -343, -282, -347, -404, -462, -549, -648, -721, -735, -648, -434, -91, 363, 909, 1496, 2042, 2495, 2861, 3095, 3083, 2845, 2547, 2219, 1676, 887, 117, -467, -1057, -1813, -2540, -2953, -3068, -3096, -3092, -2893, -2394, -1735, -1174, -782, -417, 18, 463, 882, 1356, 1860, 2239, 2483, 2736, 2916, 2761, 2298, 1824, 1360, 621, -419, -1410, -2148, -2807, -3546, -4198, -4480, -4337, -3957, -3529, -3073, -2524, -1886, -1201, -453, 366, 1135, 1691, 2044, 2349, 2635, 2716, 2445, 1964, 1464, 857, 16, -812, -1324, -1743, -2436, -3123, -3227, -2869, -2678, -2707, -2397, -1613, -904, -583, -241, 478, 1226, 1491, 1397, 1423, 1552, 1324, 661, 38, -292, -667, -1320, -1862, -1881, -1605, -1468, -1387, -1042, -554, -286, -225, -86, 120, 123, -151, -507, -820, -1166, -1591, -2006, -2351, -2653, -2877, -2897, -2689, -2395, -2106, -1780, -1394, -983, -566, -174, 110, 258, 362, 499, 611, 619, 546, 428, 179, -310, -974, -1607, -2098, -2532, -2986, -3357, -3497, -3441, -3333, -3159, -2773, -2213, -1693, -1248, -692, -16, 533, 848, 1122, 1461, 1672, 1577, 1303, 1043, 746, 270, -311, -800, -1182, -1578, -1948, -2102, -2030, -1938, -1933, -1901, -1772, -1660, -1615, -1476, -1143, -780, -517, -217, 233, 642, 818, 902, 1080, 1235, 1176, 1000, 910, 854, 619, 216, -131, -365, -664, -1120, -1591, -1962, -2290, -2601, -2779, -2768, -2673, -2577, -2405, -2109, -1777, -1450, -1006, -395, 181, 565, 910, 1377, 1786, 1892, 1770, 1610, 1354, 853, 167, -544, -1260, -2016, -2733, -3312, -3795, -4245, -4553, -4559, -4323, -4045, -3739, -3242, -2536, -1811, -1190, -635, -121, 279, 530, 664, 667, 486, 161, -170, -452, -762, -1120, -1418, -1642, -1980, -2555, -3184, -3615, -3854, -4098, -4363, -4439, -4221, -3852, -3473, -3023, -2404, -1707, -1119, -678, -292, 112, 501, 797, 955, 1002, 1016, 1048, 1018, 744, 155, -585, -1260, -1819, -2317, -2744, -3028, -3155, -3134, -2974, -2759, -2594, -2441, -2166, -1734, -1236, -735, -255, 202, 691, 1253, 1757, 1987, 1930, 1763, 1549, 1171, 599, 21, -421, -827, -1367, -2030, -2632, -3032, -3244, -3351, -3397, -3397, -3345, -3135, -2580, -1666, -681, 119, 834, 1618, 2279, 2511, 2371, 2115, 1736, 1060, 165, -701, -1482, -2271, -3013, -3499, -3679, -3687, -3551, -3142, -2490, -1857, -1357, -801, -62, 656, 1112, 1327, 1457, 1533, 1468, 1210, 823, 455, 174, -98, -437, -729, -800, -644, -403, -138, 219, 686, 1163, 1585, 1997, 2390, 2625, 2641, 2612, 2723, 2891, 2884, 2676, 2461, 2338, 2183, 1905, 1625, 1472, 1411, 1423, 1642, 2132, 2718, 3245, 3781, 4373, 4857, 5100, 5203, 5306, 5356, 5215, 4871, 4441, 4076, 3842, 3686, 3525, 3332, 3099, 2822, 2590, 2578, 2804, 3026, 3033, 2958, 3097, 3451, 3708, 3718, 3729, 3983, 4347, 4578, 4713, 4891, 5027, 4945, 4665, 4325, 3927, 3384, 2739, 2157, 1760, 1569, 1588, 1842, 2322, 2931, 3529, 3987, 4199, 4116, 3763, 3238, 2635, 2015, 1436, 963, 613, 352, 192, 214, 364, 455, 483, 667, 999, 1137, 959, 771, 725, 546, 73, -402, -608, -676, -829, -988, -937, -668, -370, -147, 23, 153, 210, 175, -24, -481, -1093, -1565, -1832, -2153, -2645, -3092, -3351, -3536, -3701, -3730, -3603, -3432, -3160, -2572, -1655, -683, 139, 884, 1642, 2315, 2830, 3219, 3296, 2664, 1364, -78, -1453, -3062, -4854, -6198, -6760, -6842, -6693, -6185, -5276, -4202, -3122, -2057, -1134, -548, -319, -319, -466, -771, -1186, -1519, -1520, -1130, -591, -290, -435, -899, -1431, -2042, -2975, -4240, -5423, -6141, -6398, -6318, -5845, -4965, -3946, -3072, -2320, -1578, -988, -792, -901, -948, -783, -667, -875, -1303, -1668, -1947, -2404, -3214, -4247, -5230, -5907, -6044, -5525, -4518, -3302, -1988, -634, 467, 1032, 1128, 895, 216, -906, -1986, -2553, -2744, -2974, -3284, -3341, -2896, -2121, -1533, -1504, -1793, -1826, -1510, -1245, -1136, -733, 235, 1466, 2476, 3005, 3005, 2621, 2101, 1461, 463, -901, -2229, -3150, -3637, -3798, -3700, -3363, -2719, -1738, -714, -106, 66, 238, 644, 1109, 1527, 2010, 2488, 2643, 2348, 1855, 1439, 1082, 575, -165, -978, -1631, -2118, -2621, -3154, -3542, -3737, -3839, -3757, -3261, -2379, -1304, -44, 1391, 2630, 3353, 3820, 4399, 4748, 4152, 2626, 1054, 39, -677, -1428, -1875, -1646, -1063, -620, -225, 387, 990, 1208, 1128, 1067, 1072, 1065, 1196, 1645, 2226, 2507, 2319, 1983, 1910, 2073, 2084, 1786, 1457, 1390, 1593, 2014, 2717, 3620, 4394, 4828, 5013, 5061, 4906, 4525, 4052, 3564, 2976, 2250, 1524, 929, 467, 176, 214, 571, 984, 1340, 1880, 2696, 3416, 3748, 3923, 4224, 4490, 4456, 4217, 4019, 3888, 3745, 3677, 3756, 3770, 3455, 2928, 2484, 2075, 1446, 642, -103, -793, -1462, -1871, -1907, -1860, -1844, -1539, -832, -81, 508, 1084, 1683, 2197, 2653, 3032, 3132, 3018, 3053, 3224, 3104, 2607, 2053, 1512, 852, 243, -97, -376, -826, -1237, -1364, -1323, -1258, -1061, -675, -236, 128, 367, 463, 544, 819, 1227, 1477, 1527, 1676, 2070, 2460, 2597, 2572, 2548, 2426, 2035, 1491, 1025, 608, 110, -318, -455, -429, -493, -576, -450, -131, 234, 597, 908, 1092, 1237, 1468, 1666, 1645, 1527, 1594, 1837, 1980, 1905, 1776, 1731, 1705, 1620, 1546, 1534, 1481, 1297, 1062, 843, 620, 422, 267, 45, -256, -384, -246, -160, -286, -288, 48, 383, 408, 310, 346, 464, 601, 852, 1174, 1328, 1209, 972, 771, 572, 264, -167, -594, -877, -1047, -1221, -1367, -1339, -1158, -984, -811, -544, -308, -268, -256, -18, 320, 509, 650, 953, 1268, 1304, 1051, 699, 351, 19, -300, -654, -1044, -1313, -1278, -930, -420, 105, 517, 679, 544, 301, 223, 331, 370, 162, -144, -273, -119, 239, 627, 839, 786, 612, 531, 526, 398, 153, 97, 416, 852, 1032, 989, 1028, 1199, 1203, 795, -7, -1035, -2059, -2892, -3517, -3990, -4201, -3952, -3247, -2254, -1087, 129, 1162, 1860, 2231, 2237, 1851, 1318, 875, 351, -492, -1395, -1928, -2120, -2275, -2476, -2660, -2813, -2828, -2583, -2206, -1868, -1469, -972, -659, -658, -701, -714, -1000, -1562, -1986, -2112, -2143, -2098, -1848, -1575, -1550, -1653, -1594, -1355, -1092, -908, -903, -1106, -1281, -1158, -878, -862, -1219, -1585, -1594, -1319, -1175, -1428, -1881, -2163, -2218, -2340, -2661, -2885, -2652, -2004, -1337, -1015, -1104, -1370, -1477, -1291, -1039, -1066, -1405, -1726, -1755, -1600, -1567, -1764, -2066, -2393, -2774, -3110, -3127, -2692, -2048, -1578, -1412, -1334, -1118, -832, -723, -835, -981, -1112, -1409, -1906, -2318, -2422, -2363, -2400, -2509, -2498, -2340, -2195, -2143, -2083, -1904, -1625, -1314, -1024, -840, -860, -1067, -1310, -1470, -1541, -1577, -1623, -1670, -1650, -1546, -1483, -1571, -1717, -1781, -1813, -1888, -1902, -1740, -1443, -1051, -553, -116, 21, -70, -118, -81, -99, -177, -321, -712, -1354, -1871, -1958, -1713, -1392, -1193, -1298, -1679, -1974, -1921, -1692, -1488, -1229, -848, -430, 62, 662, 1044, 885, 420, 51, -253, -644, -922, -878, -644, -389, -154, -107, -449, -1018, -1423, -1551, -1511, -1337, -1027, -641, -160, 478, 1139, 1609, 1841, 1827, 1411, 594, -250, -794, -1088, -1288, -1314, -1028, -484, 156, 794, 1329, 1622, 1630, 1492, 1376, 1294, 1169, 1021, 917, 809, 588, 253, -118, -474, -744, -840, -793, -705, -565, -301, 24, 345, 802, 1551, 2468, 3251, 3733, 3920, 3863, 3589, 3037, 2112, 959, 9, -479, -713, -942, -1051, -809, -273, 283, 684, 950, 1249, 1711, 2186, 2398, 2415, 2578, 2867, 2846, 2399, 1938, 1758, 1678, 1383, 756, -65, -698, -775, -397, 45, 502, 1185, 1967, 2490, 2769, 3039, 3261, 3292, 3201, 2991, 2461, 1681, 1045, 686, 406, 206, 301, 619, 854, 918, 948, 1005, 1063, 1057, 853, 439, 82, 2, 126, 419, 991, 1623, 1862, 1757, 1793, 2011, 2021, 1787, 1540, 1154, 493, -75, -228, -179, -85, 294, 981, 1543, 1766, 1788, 1646, 1293, 853, 361, -315, -941, -981, -421, 146, 467, 868, 1508, 2083, 2378, 2532, 2675, 2704, 2488, 2037, 1435, 741, 2, -636, -919, -693, -143, 353, 633, 875, 1264, 1672, 1789, 1464, 861, 310, -12, -255, -599, -915, -920, -626, -285, 23, 365, 629, 649, 530, 447, 315, -28, -479, -814, -956, -858, -404, 374, 1157, 1603, 1711, 1743, 1827, 1754, 1231, 256, -862, -1793, -2354, -2421, -1932, -1105, -405, -129, -113, 0, 339, 738, 966, 892, 470, -198, -802, -1100, -1220, -1413, -1564, -1430, -1195, -1174, -1179, -859, -410, -220, -179, -21, 96, -31, -207, -264, -438, -888, -1318, -1341, -919, -280, 279, 494, 256, -302, -975, -1720, -2597, -3478, -4007, -3963, -3447, -2592, -1325, 358, 2088, 3341, 3878, 3782, 3170, 2076, 589, -1037, -2431, -3248, -3335, -2832, -2121, -1560, -1194, -751, -85, 472, 433, -188, -858, -1227, -1361, -1295, -900, -306, 91, 183, 218, 276, 132, -318, -860, -1248, -1393, -1221, -683, 29, 524, 640, 654, 857, 1177, 1400, 1522, 1605, 1470, 914, 108, -535, -909, -1291, -1828, -2178, -1895, -990, 53, 786, 1146, 1341, 1591, 1968, 2353, 2498, 2308, 2041, 1991, 1988, 1566, 663, -209, -636, -774, -951, -1115, -977, -510, -2, 361, 698, 1132, 1554, 1757, 1713, 1595, 1595, 1737, 1823, 1639, 1206, 767, 426, -12, -713, -1462, -1849, -1760, -1431, -1009, -394, 375, 917, 893, 415, -119, -403, -349, -66, 244, 508, 826, 1208, 1379, 1050, 280, -596, -1323, -1858, -2196, -2198, -1656, -558, 756, 1796, 2270, 2181, 1650, 807, -163, -1054, -1725, -2075, -2029, -1646, -1099, -493, 141, 675, 964, 1060, 1076, 882, 321, -374, -740, -665, -518, -645, -978, -1246, -1350, -1392, -1449, -1534, -1576, -1329, -583, 420, 1153, 1428, 1427, 1175, 624, 120, 112, 524, 1003, 1502, 2057, 2451, 2513, 2347, 1985, 1282, 345, -440, -920, -1248, -1442, -1255, -584, 281, 955, 1296, 1344, 1137, 761, 403, 178, 8, -131, -103, 121, 345, 449, 562, 784, 1045, 1285, 1523, 1676, 1561, 1160, 699, 397, 210, -101, -676, -1364, -1876, -2086, -2075, -1929, -1642, -1218, -696, -84, 565, 983, 825, 106, -677, -940, -479, 428, 1330, 2000, 2526, 3018, 3299, 3068, 2289, 1258, 255, -673, -1548, -2224, -2484, -2289, -1804, -1200, -580, -36, 407, 819, 1198, 1368, 1215, 926, 805, 905, 1012, 957, 811, 754, 834, 892, 763, 464, 130, -161, -337, -261, 46, 281, 224, 27, -153, -480, -1020, -1394, -1219, -622, -1, 428, 619, 545, 271, -54, -414, -956, -1720, -2433, -2627, -2027, -865, 293, 1110, 1633, 1812, 1301, 11, -1535, -2743, -3456, -3783, -3788, -3546, -3136, -2478, -1519, -587, -161, -215, -216, 116, 435, 420, 355, 601, 821, 370, -773, -2001, -2867, -3352, -3514, -3310, -2732, -1847, -775, 214, 736, 635, 225, -33, -38, -35, -98, 51, 646, 1558, 2390, 2695, 2207, 1144, 45, -842, -1719, -2632, -3241, -3293, -2859, -2007, -778, 484, 1319, 1706, 2008, 2265, 2012, 1047, -74, -647, -626, -449, -379, -436, -659, -923, -832, -230, 493, 926, 1080, 1050, 685, -86, -903, -1276, -1134, -845, -760, -885, -954, -721, -167, 495, 959, 1046, 830, 501, 152, -217, -539, -689, -680, -674, -681, -432, 273, 1193, 1794, 1748, 1145, 293, -509, -1105, -1528, -1950, -2444, -2794, -2709, -2225, -1714, -1403, -1067, -389, 506, 1102, 1086, 692, 376, 302, 225, -130, -742, -1360, -1776, -1880, -1585, -896, -20, 773, 1322, 1495, 1194, 581, 47, -225, -389, -485, -255, 440, 1319, 1957, 2141, 1893, 1358, 679, -104, -1004, -1886, -2463, -2552, -2214, -1614, -857, -43, 631, 1021, 1221, 1433, 1668, 1797, 1795, 1665, 1287, 645, 44, -257, -443, -801, -1160, -1031, -247, 792, 1534, 1743, 1566, 1290, 1063, 793, 307, -279, -445, 217, 1440, 2530, 3042, 2941, 2325, 1438, 683, 228, -160, -622, -888, -762, -504, -454, -558, -575, -502, -539, -736, -877, -741, -321, 234, 770, 1159, 1331, 1295, 1059, 553, -286, -1337, -2199, -2245, -1013, 1124, 2960, 3573, 3240, 2750, 2180, 992, -837, -2516, -3341, -3320, -2783, -1838, -539, 757, 1615, 1912, 1764, 1204, 266, -723, -1334, -1560, -1755, -1904, -1482, -313, 1001, 1902, 2418, 2568, 2077, 1058, 50, -867, -1981, -3008, -3330, -3031, -2597, -1983, -935, 218, 968, 1304, 1421, 1291, 908, 462, 78, -199, -185, 229, 744, 904, 704, 547, 634, 656, 248, -467, -1032, -1275, -1541, -2229, -3220, -3893, -3682, -2630, -1397, -664, -455, -126, 849, 2160, 2988, 2979, 2462, 1782, 958, 50, -740, -1389, -1984, -2366, -2236, -1530, -409, 843, 1775, 2055, 1836, 1442, 846, 29, -532, -437, 15, 308, 324, 110, -306, -612, -439, 72, 619, 1309, 2166, 2663, 2452, 1864, 1154, 226, -627, -851, -603, -452, -306, 245, 918, 1141, 920, 492, -198, -1102, -1916, -2495, -2735, -2340, -1464, -909, -866, -413, 943, 2351, 2915, 2808, 2487, 1918, 1121, 560, 519, 672, 483, -230, -1192, -1928, -2199, -2170, -2079, -1969, -1883, -1960, -2085, -1829, -1065, -291, 0, -71, -65, 170, 479, 773, 1120, 1469, 1514, 973, -65, -1143, -1775, -1776, -1322, -772, -429, -403, -594, -792, -840, -790, -848, -1084, -1233, -969, -337, 255, 495, 452, 307, 7, -593, -1342, -1826, -1799, -1324, -511, 577, 1816, 3014, 3908, 4082, 3298, 1957, 700, -430, -1734, -2914, -3269, -2771, -2100, -1640, -1178, -528, 163, 675, 955, 1159, 1530, 2117, 2653, 2942, 3250, 3967, 4875, 5199, 4581, 3571, 2734, 1841, 571, -561, -890, -695, -705, -975, -1086, -953, -722, -356, 215, 943, 1809, 2678, 3083, 2657, 1581, 253, -1172, -2550, -3485, -3642, -2979, -1577, 408, 2469, 3800, 3912, 3018, 1676, 232, -1200, -2446, -3264, -3570, -3376, -2608, -1328, -80, 452, 317, 354, 1096, 2012, 2261, 1857, 1495, 1483, 1504, 1376, 1340, 1512, 1601, 1377, 1026, 770, 453, -211, -1181, -2134, -2895, -3473, -3733, -3420, -2665, -2013, -1596, -830, 611, 2056, 2712, 2711, 2575, 2287, 1620, 766, 69, -331, -254, 451, 1376, 1797, 1536, 1028, 568, 44, -608, -1173, -1505, -1685, -1697, -1313, -559, 19, -27, -413, -456, 115, 1001, 1773, 2241, 2570, 3022, 3443, 3278, 2343, 1177, 327, -175, -399, -219, 278, 767, 1186, 1646, 1887, 1473, 479, -574, -1400, -2013, -2280, -1876, -776, 555, 1575, 2096, 2206, 1935, 1209, 151, -793, -1185, -935, -261, 590, 1432, 1987, 1868, 856, -776, -2333, -3171, -3189, -2803, -2441, -2130, -1637, -957, -459, -472, -872, -1219, -1225, -947, -536, -25, 586, 1191, 1638, 1820, 1596, 765, -680, -2273, -3264, -3187, -2259, -1092, -67, 797, 1439, 1543, 977, 68, -759, -1325, -1509, -1097, -7, 1610, 3398, 4675, 4641, 3243, 1463, 301, -117, -73, 406, 1297, 2222, 2744, 2669, 1933, 593, -1005, -2381, -3243, -3448, -2824, -1385, 264, 1182, 946, 11, -976, -1868, -2744, -3447, -3709, -3392, -2410, -851, 702, 1521, 1485, 1075, 659, 239, -243, -790, -1422, -2017, -2191, -1620, -456, 643, 973, 366, -617, -1268, -1497, -1706, -1954, -1777, -908, 325, 1421, 2114, 2339, 2161, 1758, 1269, 784, 534, 744, 1251, 1627, 1733, 1765, 1825, 1785, 1419, 504, -913, -2216, -2672, -2336, -1944, -1869, -1778, -1396, -999, -946, -1205, -1531, -1842, -2225, -2658, -2898, -2716, -2179, -1601, -1201, -938, -720, -629, -784, -1039, -977, -316, 732, 1594, 1897, 1824, 1741, 1576, 857, -539, -2035, -2928, -3096, -2898, -2561, -1933, -868, 376, 1283, 1624, 1688, 1820, 1921, 1689, 1200, 881, 919, 1063, 1107, 1246, 1768, 2577, 3290, 3623, 3473, 2831, 1942, 1365, 1392, 1621, 1519, 1183, 1127, 1497, 1950, 2132, 1986, 1669, 1355, 1056, 619, -65, -936, -1881, -2756, -3255, -3062, -2280, -1409, -758, -131, 716, 1529, 1788, 1409, 790, 210, -413, -1128, -1734, -2079, -2157, -1950, -1504, -1093, -962, -972, -805, -427, -48, 243, 543, 854, 1034, 1028, 938, 789, 489, 136, 101, 582, 1231, 1484, 1165, 546, -125, -838, -1548, -2067, -2359, -2578, -2676, -2323, -1414, -325, 400, 401, -272, -1066, -1441, -1642, -2336, -3403, -3985, -3752, -3120, -2349, -1471, -939, -1178, -1728, -1766, -1239, -771, -778, -1193, -1641, -1594, -755, 519, 1557, 2042, 2095, 1861, 1359, 581, -327, -885, -543, 556, 1609, 2320, 3213, 4309, 4616, 3650, 2380, 1855, 1852, 1678, 1421, 1668, 2497, 3399, 3925, 4002, 3738, 3150, 2216, 1118, 162, -517, -949, -1012, -556, 91, 312, 51, -89, 171, 322, -45, -466, -271, 340, 548, 90, -455, -632, -768, -1357, -2233, -2735, -2492, -1713, -830, -191, -2, -213, -494, -658, -1023, -1884, -2814, -3144, -2965, -2898, -2998, -2683, -1715, -589, 29, -134, -785, -1278, -1255, -1018, -937, -814, -322, 361, 975, 1712, 2703, 3446, 3342, 2517, 1704, 1451, 1655, 1798, 1663, 1713, 2415, 3256, 3187, 2111, 1162, 1288, 2231, 3073, 3206, 2603, 1647, 770, 109, -436, -814, -863, -732, -790, -977, -778, -10, 752, 834, 357, 196, 920, 1964, 2155, 1117, -334, -1379, -2173, -3189, -4177, -4475, -4012, -3387, -3062, -2915, -2507, -1675, -835, -605, -1020, -1416, -1295, -888, -628, -427, 127, 1092, 2026, 2405, 1944, 644, -1131, -2681, -3415, -3376, -3059, -2679, -1981, -818, 467, 1440, 2032, 2313, 2123, 1415, 717, 625, 966, 1077, 814, 555, 307, -363, -1512, -2579, -3062, -2911, -2277, -1313, -293, 435, 703, 565, 60, -802, -1738, -2200, -1929, -1242, -527, 301, 1492, 2812, 3599, 3472, 2686, 1741, 849, 11, -544, -425, 289, 918, 999, 876, 1058, 1337, 1094, 240, -680, -1212, -1373, -1359, -1263, -1090, -805, -331, 256, 586, 351, -137, -162, 455, 998, 721, -215, -1008, -1154, -820, -397, -51, 251, 515, 707, 884, 1128, 1332, 1313, 1204, 1344, 1647, 1605, 1117, 723, 757, 928, 975, 958, 776, 220, -411, -543, -161, 221, 331, 300, 267, 258, 223, 34, -313, -571, -601, -669, -1000, -1305, -1205, -817, -559, -572, -630, -549, -417, -468, -758, -975, -716, -4, 631, 761, 542, 482, 792, 1198, 1349, 1191, 844, 374, -163, -586, -748, -780, -946, -1196, -1139, -580, 174, 708, 982, 1168, 1213, 883, 227, -352, -572, -541, -423, -89, 646, 1602, 2326, 2514, 2190, 1636, 1158, 799, 281, -491, -1120, -1220, -967, -764, -644, -438, -300, -598, -1407, -2389, -3128, -3401, -3196, -2665, -2058, -1534, -1013, -339, 387, 826, 786, 412, -51, -489, -864, -1110, -1143, -959, -701, -609, -767, -973, -1017, -957, -906, -763, -407, 18, 314, 489, 622, 647, 503, 305, 153, -12, -200, -155, 344, 1072, 1538, 1592, 1574, 1783, 2105, 2307, 2424, 2602, 2726, 2533, 1996, 1342, 670, -115, -926, -1392, -1300, -869, -482, -283, -147, 96, 417, 556, 360, 61, -19, 62, 54, -27, 9, 148, 232, 237, 188, 14, -271, -520, -710, -954, -1206, -1258, -1021, -590, -51, 554, 1147, 1629, 1871, 1731, 1240, 755, 639, 789, 741, 329, -60, 9, 438, 722, 591, 242, -78, -434, -985, -1586, -1846, -1573, -1038, -704, -741, -956, -1178, -1497, -1994, -2494, -2780, -2797, -2487, -1741, -717, 110, 469, 555, 625, 607, 317, -175, -562, -609, -367, -118, -154, -541, -1059, -1363, -1252, -803, -235, 257, 564, 707, 855, 1168, 1560, 1795, 1773, 1570, 1262, 930, 764, 894, 1209, 1492, 1649, 1687, 1563, 1257, 898, 602, 249, -317, -884, -1004, -608, -107, 191, 315, 233, -202, -845, -1264, -1277, -1099, -981, -976, -949, -651, -46, 436, 339, -164, -507, -519, -527, -720, -887, -767, -362, 81, 315, 369, 494, 700, 565, -184, -1159, -1701, -1630, -1252, -787, -161, 666, 1459, 1893, 1885, 1645, 1387, 1108, 700, 226, -131, -326, -465, -581, -567, -361, -18, 397, 854, 1267, 1458, 1256, 638, -175, -820, -1049, -933, -759, -721, -778, -808, -776, -705, -569, -349, -98, 181, 577, 1011, 1140, 790, 302, 181, 533, 1050, 1362, 1281, 896, 507, 318, 238, 98, -93, -273, -463, -587, -428, 75, 667, 1063, 1250, 1386, 1550, 1648, 1514, 1100, 565, 129, -183, -510, -871, -1074, -969, -686, -536, -691, -1008, -1215, -1283, -1462, -1866, -2159, -1917, -1236, -680, -598, -718, -608, -294, -184, -435, -703, -593, -144, 275, 457, 518, 629, 792, 911, 912, 744, 410, 23, -291, -492, -521, -280, 155, 482, 547, 545, 631, 570, 92, -519, -635, -61, 715, 1205, 1451, 1678, 1836, 1740, 1386, 894, 417, 176, 309, 631, 852, 947, 1050, 1108, 913, 436, -134, -590, -846, -900, -772, -507, -263, -298, -713, -1225, -1404, -1166, -830, -644, -479, -79, 553, 1151, 1466, 1458, 1242, 921, 499, -42, -628, -1084, -1204, -876, -244, 254, 270, -62, -368, -593, -905, -1194, -1168, -896, -683, -473, 74, 941, 1642, 1833, 1640, 1347, 1019, 537, -85, -583, -699, -523, -411, -568, -865, -1072, -1115, -1075, -1088, -1256, -1529, -1735, -1808, -1878, -2013, -2056, -1862, -1530, -1252, -1094, -996, -887, -717, -493, -266, -44, 240, 574, 762, 619, 265, 52, 139, 297, 225, -56, -274, -216, 128, 574, 818, 688, 352, 115, 88, 223, 492, 802, 962, 938, 920, 965, 881, 591, 289, 112, -48, -277, -417, -298, -11, 206, 301, 428, 654, 812, 699, 314, -127, -370, -345, -237, -258, -380, -399, -275, -208, -310, -428, -395, -315, -394, -580, -582, -245, 318, 955, 1565, 2021, 2256, 2396, 2568, 2669, 2544, 2253, 1960, 1729, 1552, 1432, 1331, 1215, 1110, 998, 794, 563, 546, 818, 1113, 1190, 1146, 1186, 1269, 1199, 963, 784, 821, 971, 1018, 863, 574, 312, 225, 331, 476, 489, 380, 281, 263, 299, 346, 324, 83, -473, -1247, -1983, -2510, -2900, -3305, -3647, -3587, -2944, -2040, -1377, -1077, -876, -613, -434, -450, -507, -413, -224, -81, 60, 288, 483, 483, 345, 157, -200, -765, -1223, -1305, -1172, -1100, -1040, -814, -456, -124, 137, 339, 385, 180, -193, -529, -692, -684, -563, -434, -447, -612, -723, -662, -645, -919, -1349, -1600, -1591, -1550, -1679, -1885, -1858, -1422, -832, -546, -657, -792, -669, -440, -347, -341, -220, 97, 600, 1268, 1958, 2374, 2356, 2108, 1902, 1669, 1165, 480, 43, 54, 211, 144, -130, -328, -298, -100, 182, 535, 895, 1151, 1278, 1364, 1457, 1503, 1454, 1357, 1267, 1150, 962, 755, 659, 711, 774, 664, 326, -130, -585, -1008, -1421, -1798, -2039, -2034, -1760, -1321, -891, -610, -519, -603, -848, -1191, -1438, -1345, -859, -207, 378, 884, 1364, 1670, 1574, 1047, 315, -365, -860, -1169, -1340, -1354, -1136, -724, -363, -272, -384, -452, -408, -453, -700, -913, -762, -235, 400, 950, 1424, 1840, 2108, 2128, 1901, 1554, 1238, 1000, 754, 466, 270, 306, 495, 620, 594, 537, 574, 691, 809, 921, 1053, 1121, 986, 626, 214, -19, 21, 236, 455, 672, 1043, 1591, 2064, 2229, 2126, 1870, 1466, 945, 430, -45, -516, -856, -900, -717, -485, -261, -124, -289, -766, -1199, -1279, -1075, -795, -518, -259, -40, 191, 495, 741, 665, 199, -399, -808, -975, -1083, -1256, -1421, -1468, -1439, -1455, -1537, -1587, -1547, -1485, -1523, -1683, -1852, -1895, -1801, -1699, -1666, -1549, -1132, -457, 173, 558, 785, 986, 1096, 974, 674, 425, 338, 300, 161, -46, -173, -122, 48, 178, 132, -38, -168, -216, -263, -254, 26, 629, 1335, 1922, 2334, 2584, 2688, 2680, 2551, 2276, 1994, 1951, 2165, 2330, 2190, 1838, 1521, 1294, 1001, 512, -79, -555, -789, -842, -860, -921, -1048, -1258, -1496, -1628, -1564, -1338, -1009, -603, -185, 147, 372, 506, 519, 400, 239, 111, -58, -338, -602, -676, -581, -529, -717, -1163, -1694, -2093, -2302, -2398, -2367, -2090, -1586, -1059, -680, -490, -512, -717, -938, -1024, -979, -822, -482, 12, 443, 655, 730, 753, 626, 227, -332, -747, -782, -491, -160, -8, -12, -30, -72, -307, -820, -1476, -2020, -2272, -2171, -1725, -1017, -226, 454, 950, 1295, 1530, 1685, 1796, 1874, 1865, 1757, 1685, 1814, 2101, 2258, 2046, 1570, 1201, 1151, 1233, 1127, 814, 583, 599, 708, 717, 685, 786, 993, 1104, 1043, 950, 937, 928, 840, 739, 712, 698, 551, 233, -97, -186, 43, 345, 396, 199, 19, -80, -321, -819, -1365, -1694, -1731, -1567, -1351, -1184, -1048, -910, -863, -1026, -1329, -1587, -1725, -1759, -1658, -1438, -1234, -1134, -1077, -1008, -972, -1002, -1103, -1328, -1683, -2034, -2269, -2435, -2585, -2648, -2585, -2445, -2232, -1868, -1403, -1006, -724, -419, -33, 280, 394, 458, 715, 1124, 1358, 1257, 1130, 1321, 1634, 1590, 1175, 863, 819, 675, 220, -204, -238, 21, 251, 299, 216, 97, 1, -57, -76, -52, -64, -216, -343, -104, 500, 1039, 1290, 1523, 1928, 2216, 2099, 1728, 1411, 1204, 1050, 1020, 1126, 1098, 672, 6, -519, -826, -1091, -1309, -1319, -1168, -1018, -821, -486, -171, -72, -138, -233, -355, -517, -668, -831, -1085, -1359, -1448, -1270, -946, -592, -202, 207, 504, 603, 576, 518, 387, 159, -22, -29, 29, -46, -255, -416, -468, -499, -481, -250, 167, 537, 807, 1218, 1849, 2390, 2569, 2515, 2483, 2445, 2216, 1810, 1390, 973, 440, -145, -547, -680, -677, -611, -407, -69, 290, 606, 858, 1000, 1059, 1171, 1375, 1532, 1522, 1391, 1265, 1226, 1280, 1337, 1309, 1249, 1273, 1332, 1272, 1086, 931, 898, 966, 1074, 1072, 818, 411, 96, -138, -510, -1002, -1361, -1503, -1540, -1501, -1343, -1160, -1033, -840, -475, -128, -62, -203, -228, -22, 159, 64, -241, -535, -768, -1054, -1365, -1529, -1576, -1748, -2041, -2142, -1993, -1919, -1985, -1871, -1557, -1376, -1279, -868, -175, 369, 697, 1030, 1308, 1335, 1283, 1364, 1347, 952, 464, 397, 658, 698, 431, 371, 684, 887, 695, 449, 388, 236, -152, -437, -404, -340, -463, -498, -162, 287, 403, 232, 208, 495, 826, 1002, 1140, 1332, 1469, 1466, 1413, 1385, 1303, 1092, 804, 525, 234, -98, -427, -726, -1065, -1474, -1825, -1979, -1931, -1738, -1410, -958, -446, 56, 504, 832, 966, 932, 859, 795, 645, 396, 224, 203, 150, -43, -170, -78, 46, -16, -163, -208, -193, -248, -316, -289, -288, -487, -755, -823, -772, -904, -1186, -1282, -1139, -1039, -1090, -1148, -1146, -1092, -923, -665, -486, -389, -180, 141, 322, 238, -15, -348, -703, -974, -1133, -1284, -1432, -1415, -1158, -776, -395, -42, 272, 536, 777, 1008, 1198, 1362, 1551, 1715, 1721, 1536, 1280, 1056, 859, 649, 426, 228, 103, 71, 102, 156, 228, 355, 558, 814, 1068, 1271, 1390, 1428, 1422, 1412, 1375, 1255, 1080, 957, 895, 765, 507, 257, 153, 120, 6, -181, -300, -322, -376, -522, -649, -659, -603, -564, -558, -609, -754, -941, -1075, -1157, -1228, -1248, -1178, -1059, -905, -655, -343, -126, -72, -97, -140, -241, -384, -450, -395, -355, -483, -781, -1115, -1384, -1570, -1668, -1637, -1475, -1250, -1011, -727, -379, -49, 185, 388, 642, 894, 1032, 1071, 1114, 1183, 1208, 1169, 1107, 1022, 875, 652, 394, 166, 1, -119, -240, -384, -507, -541, -510, -520, -595, -629, -591, -620, -750, -782, -603, -420, -452, -589, -567, -335, -63, 92, 130, 152, 263, 476, 652, 613, 376, 171, 136, 112, -117, -464, -622, -483, -256, -154, -152, -143, -135, -155, -127, -30, 3, -52, -6, 240, 497, 606, 658, 709, 631, 427, 326, 408, 444, 253, -36, -220, -300, -385, -463, -417, -236, -31, 137, 298, 437, 485, 434, 379, 415, 554, 741, 890, 926, 844, 718, 611, 498, 315, 65, -161, -295, -341, -336, -319, -346, -429, -508, -523, -504, -496, -502, -520, -554, -534, -344, 6, 334, 497, 561, 690, 916, 1107, 1173, 1167, 1180, 1221, 1248, 1220, 1104, 890, 631, 430, 321, 229, 69, -161, -394, -594, -776, -940, -1056, -1114, -1136, -1119, -1019, -814, -567, -382, -317, -331, -336, -289, -219, -167, -160, -221, -316, -304, -92, 215, 413, 452, 417, 334, 153, -98, -298, -382, -407, -463, -582, -682, -638, -466, -341, -354, -381, -289, -90, 175, 485, 727, 808, 854, 1025, 1227, 1271, 1180, 1069, 912, 682, 513, 502, 529, 431, 202, -76, -347, -571, -747, -904, -1037, -1099, -1104, -1152, -1275, -1358, -1304, -1209, -1229, -1314, -1263, -1051, -845, -684, -448, -124, 178, 439, 671, 734, 524, 233, 123, 155, 105, -60, -145, -52, 103, 187, 196, 174, 94, -51, -154, -89, 119, 322, 440, 511, 572, 593, 571, 539, 492, 387, 254, 174, 129, 52, -19, -3, 54, 68, 57, 72, 56, -33, -117, -144, -208, -386, -596, -722, -787, -894, -1032, -1087, -1009, -876, -777, -703, -603, -462, -290, -98, 81, 209, 284, 343, 418, 508, 598, 680, 761, 834, 859, 797, 668, 562, 531, 528, 467, 367, 353, 471, 606, 638, 599, 556, 490, 364, 237, 173, 173, 214, 288, 364, 422, 506, 643, 755, 744, 630, 512, 411, 284, 145, 65, 38, -38, -206, -354, -382, -346, -347, -389, -408, -413, -440, -429, -284, -61, 83, 125, 209, 389, 527, 526, 489, 522, 540, 419, 233, 144, 133, 47, -102, -155, -100, -116, -253, -338, -266, -170, -204, -352, -480, -513, -492, -502, -558, -574, -484, -349, -268, -253, -265, -313, -413, -520, -567, -565, -574, -605, -611, -576, -549, -569, -605, -614, -618, -668, -755, -815, -840, -882, -929, -897, -785, -692, -621, -446, -144, 109, 197, 229, 343, 480, 500, 408, 324, 289, 230, 109, -13, -95, -171, -270, -365, -435, -495, -552, -585, -594, -585, -537, -438, -317, -224, -162, -71, 120, 394, 609, 668, 675, 790, 969, 1029, 923, 800, 727, 593, 331, 78, -22, -36, -142, -371, -592, -702, -718, -694, -668, -674, -676, -568, -315, -8, 266, 555, 905, 1260, 1552, 1823, 2125, 2360, 2386, 2243, 2088, 1938, 1665, 1278, 955, 762, 565, 293, 75, 29, 81, 88, 26, -37, -85, -143, -188, -166, -83, 17, 142, 318, 507, 627, 676, 721, 763, 720, 595, 511, 493, 411, 209, 14, -94, -192, -316, -404, -492, -687, -940, -1077, -1066, -1010, -938, -805, -653, -554, -464, -273, 6, 223, 300, 336, 452, 615, 690, 633, 525, 437, 345, 221, 106, 27, -42, -115, -158, -171, -179, -142, 0, 169, 221, 171, 151, 201, 252, 278, 303, 324, 335, 383, 469, 493, 392, 236, 135, 117, 106, 12, -157, -300, -336, -320, -364, -481, -584, -620, -607, -578, -547, -525, -507, -462, -361, -218, -71, 74, 228, 361, 428, 444, 449, 434, 338, 163, -18, -170, -309, -440, -539, -608, -674, -727, -733, -704, -682, -663, -600, -499, -421, -372, -277, -125, -22, -29, -62, -55, -81, -229, -452, -636, -771, -917, -1065, -1127, -1073, -968, -865, -758, -650, -562, -465, -334, -216, -161, -117, 0, 167, 299, 390, 508, 656, 752, 770, 782, 825, 820, 697, 486, 262, 46, -152, -319, -477, -654, -804, -871, -878, -895, -897, -792, -576, -365, -208, -34, 175, 315, 362, 458, 633, 721, 694, 727, 852, 876, 753, 663, 647, 528, 267, 62, 14, -10, -102, -137, 14, 234, 305, 203, 116, 142, 183, 144, 97, 142, 246, 324, 399, 543, 711, 794, 793, 823, 920, 971, 879, 683, 474, 263, 28, -201, -404, -619, -849, -1011, -1069, -1097, -1138, -1139, -1092, -1054, -1012, -917, -813, -784, -787, -735, -638, -531, -385, -201, -63, -11, 26, 107, 178, 180, 148, 154, 197, 221, 227, 260, 334, 391, 394, 376, 378, 367, 306, 225, 201, 251, 316, 363, 421, 510, 593, 629, 643, 673, 711, 712, 657, 565, 446, 297, 128, -35, -190, -353, -499, -573, -581, -605, -692, -765, -753, -720, -758, -824, -821, -756, -700, -644, -539, -407, -309, -244, -174, -104, -67, -52, -19, 23, 26, -9, -28, -7, 16, 28, 51, 78, 63, -1, -73, -133, -206, -290, -334, -318, -291, -282, -247, -174, -146, -200, -254, -253, -261, -331, -438, -565, -745, -947, -1078, -1130, -1196, -1314, -1403, -1369, -1222, -1040, -885, -774, -702, -650, -571, -426, -224, -10, 178, 315, 397, 463, 564, 698, 814, 893, 973, 1089, 1226, 1330, 1366, 1348, 1318, 1285, 1231, 1168, 1140, 1136, 1082, 957, 840, 790, 765, 710, 638, 583, 535, 469, 376, 270, 176, 128, 120, 91, -13, -160, -261, -294, -335, -437, -562, -635, -639, -601, -543, -491, -479, -500, -509, -479, -444, -425, -379, -265, -142, -81, -46, 48, 187, 282, 345, 435, 535, 591, 627, 677, 694, 618, 490, 387, 315, 238, 142, 30, -84, -172, -175, -101, -55, -127, -284, -414, -473, -499, -509, -481, -412, -350, -316, -288, -265, -294, -381, -450, -432, -341, -220, -83, 39, 93, 85, 103, 182, 244, 224, 174, 187, 270, 375, 469, 543, 584, 579, 543, 502, 454, 387, 326, 306, 324, 365, 425, 479, 470, 383, 273, 184, 110, 44, 6, 6, 19, 32, 55, 97, 125, 93, -9, -145, -258, -332, -386, -444, -500, -530, -517, -465, -394, -313, -234, -170, -131, -103, -51, 42, 145, 216, 257, 300, 348, 369, 349, 319, 307, 302, 269, 185, 84, 25, 37, 88, 120, 133, 169, 245, 324, 357, 351, 324, 278, 198, 101, 28, -11, -43, -74, -88, -75, -60, -74, -130, -208, -267, -289, -301, -343, -413, -471, -486, -480, -490, -529, -573, -589, -559, -484, -374, -244, -99, 55, 200, 315, 416, 542, 690, 793, 803, 762, 761, 802, 801, 718, 620, 566, 511, 400, 266, 185, 166, 142, 60, -64, -176, -236, -259, -283, -316, -339, -353, -357, -317, -216, -106, -47, -13, 62, 181, 272, 306, 317, 339, 363, 381, 409, 433, 399, 303, 210, 146, 71, -26, -91, -101, -86, -58, -2, 52, 70, 77, 109, 156, 193, 239, 312, 381, 416, 449, 537, 681, 828, 947, 1040, 1089, 1069, 996, 893, 736, 504, 257, 68, -75, -230, -395, -523, -605, -664, -703, -707, -686, -666, -639, -562, -423, -289, -221, -203, -154, -51, 33, 37, -10, -79, -183, -320, -427, -471, -487, -493, -453, -374, -315, -291, -277, -283, -332, -407, -466, -510, -556, -586, -576, -525, -453, -380, -315, -241, -147, -56, -7, 10, 45, 107, 159, 175, 155, 102, 43, 20, 37, 51, 37, 18, -6, -52, -93, -98, -78, -64, -42, 11, 70, 94, 107, 138, 183, 208, 205, 187, 159, 115, 61, 19, 11, 21, 12, -8, 9, 74, 121, 116, 105, 119, 123, 100, 100, 136, 169, 188, 224, 263, 267, 260, 285, 318, 278, 169, 77, 38, -12, -121, -220, -246, -245, -283, -331, -338, -329, -357, -408, -439, -446, -452, -447, -414, -363, -320, -286, -236, -152, -62, -15, -26, -73, -134, -206, -281, -340, -384, -432, -492, -537, -546, -532, -517, -505, -489, -463, -423, -367, -292, -209, -124, -30, 75, 182, 280, 374, 455, 502, 517, 518, 495, 427, 339, 276, 219, 133, 54, 43, 75, 84, 68, 77, 116, 134, 111, 89, 88, 79, 45, 24, 42, 69, 72, 69, 84, 101, 91, 56, 10, -33, -67, -101, -144, -174, -165, -131, -120, -138, -164, -201, -250, -282, -285, -307, -364, -400, -377, -326, -267, -182, -73, 21, 84, 129, 157, 170, 180, 187, 164, 98, 26, -11, -26, -48, -76, -80, -65, -69, -95, -111, -103, -89, -72, -40, 0, 35, 77, 141, 209, 265, 310, 338, 336, 315, 298, 276, 228, 159, 97, 48, -4, -62, -103, -130, -160, -190, -195, -180, -175, -200, -222, -218, -201, -190, -168, -124, -67, -13, 41, 94, 144, 189, 228, 255, 271, 283, 290, 283, 270, 261, 254, 243, 223, 189, 135, 71, 20, -19, -72, -134, -180, -197, -189, -164, -128, -98, -81, -73, -75, -97, -128, -147, -155, -170, -194, -213, -220, -224, -236, -257, -281, -302, -318, -328, -334, -336, -332, -317, -295, -282, -271, -246, -208, -161, -101, -38, 0, 0, -7, 14, 48, 70, 80, 105, 141, 161, 159, 153, 156, 159, 155, 152, 138, 99, 44, 12, 19, 34, 25, 7, 10, 44, 87, 123, 152, 169, 172, 181, 218, 274, 319, 337, 333, 316, 291, 269, 260, 255, 235, 193, 148, 111, 75, 34, -2, -27, -42, -40, -16, 16, 37, 48, 57, 55, 44, 43, 53, 50, 26, 3, -7, -21, -37, -36, -20, -15, -29, -54, -76, -98, -124, -157, -192, -208, -198, -176, -157, -137, -103, -55, -10, 18, 28, 33, 44, 63, 73, 69, 64, 78, 109, 141, 156, 152, 137, 129, 132, 129, 112, 84, 55, 30, 10, -1, -7, -16, -34, -52, -58, -60, -65, -67, -60, -42, -29, -19, 0, 38, 87, 137, 182, 215, 235, 253, 275, 284, 264, 220, 172, 129, 82, 28, -16, -44, -64, -88, -112, -126, -125, -113, -94, -80, -74, -69, -56, -39, -22, -2, 17, 32, 42, 54, 68, 71, 65, 61, 63, 64, 57, 42, 25, 9, -8, -30, -52, -73, -94, -112, -122, -125, -128, -129, -119, -97, -80, -78, -67, -34, 6, 35, 54, 78, 105, 127, 143, 147, 134, 107, 78, 55, 37, 25, 24, 30, 32, 16, -8, -28, -39, -49, -61, -69, -73, -75, -74, -65, -51, -35, -19, -3, 15, 37, 57, 74, 87, 99, 109, 114, 109, 100, 89, 77, 62, 43, 20, -1, -21, -38, -49, -54, -52, -47, -42, -35, -24, -8, 6, 15, 19, 21, 27, 34, 41, 44, 42, 38, 37, 37, 35, 29, 24, 23, 23, 21, 16, 9, 6, 3, -1, -7, -11, -11, -11, -12, -16, -17, -17, -16, -12, -4, 3, 12, 18, 24, 29, 34, 35, 32, 26, 21, 18, 15, 9, 3, 0, -2, -3, -4, -3, -1, 0, 2, 3, 7, 10, 11, 14, 15, 15, 16, 18, 20, 20, 19, 17, 17, 17, 17, 17, 14, 11, 11, 11, 10, 9, 8, 8, 7, 7, 8, 10, 11, 9, 7, 6, 6, 6, 6, 7, 8, 8, 7, 7, 8, 8, 7, 6, 5, 5, 5, 5, 3, 2, 2, 3, 3, 2, 2, 2, 2, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -2, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, -1, 0, 2, 0, -1, -1, 1, 2, 1, 0, -2, -1 };
+// IMA ADPCM blocks, see audio_adpcm.h
+static const uint8_t __in_flash("audio_acquired_sample_data") audio_acquired_sample_data[] = { 0, 0, 0, 0, 176, 29, 35, 185, 34, 169, 25, 0, 17, 153, 1, 9, 1, 144, 16, 0, 0, 0, 0, 0, 0, 0, 0, 144, 1, 144, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 144, 0, 16, 144, 16, 1, 25, 2, 16, 19, 153, 0, 16, 1, 9, 0, 1, 144, 25, 145, 153, 0, 160, 155, 32, 144, 33, 145, 9, 153, 153, 17, 169, 49, 146, 43, 160, 16, 145, 41, 1, 155, 25, 20, 232, 9, 1, 128, 9, 19, 187, 65, 128, 155, 0, 65, 168, 153, 1, 153, 44, 1, 141, 18, 184, 25, 49, 132, 154, 66, 144, 27, 145, 188, 25, 161, 27, 36, 218, 9, 67, 129, 10, 176, 12, 145, 57, 147, 171, 251, 32, 2, 0, 144, 82, 145, 139, 50, 217, 24, 130, 203, 10, 37, 170, 114, 160, 139, 33, 8, 66, 184, 28, 216, 25, 129, 73, 2, 50, 164, 140, 17, 249, 156, 83, 161, 11, 130, 141, 18, 16, 37, 200, 137, 2, 220, 48, 2, 8, 0, 129, 251, 32, 160, 24, 216, 96, 129, 40, 146, 171, 154, 37, 252, 74, 161, 27, 128, 81, 144, 19, 189, 115, 161, 137, 16, 184, 155, 34, 1, 201, 10, 50, 249, 139, 85, 129, 139, 1, 32, 147, 190, 66, 145, 186, 43, 5, 11, 20, 153, 0, 0, 219, 154, 40, 4, 24, 148, 155, 208, 28, 38, 144, 187, 26, 1, 160, 15, 68, 144, 137, 172, 64, 18, 19, 251, 29, 131, 26, 131, 141, 37, 170, 136, 40, 55, 201, 16, 200, 41, 20, 169, 137, 16, 0, 16, 3, 153, 144, 140, 145, 28, 55, 128, 144, 12, 131, 191, 66, 184, 169, 141, 51, 10, 39, 154, 49, 200, 11, 21, 187, 50, 189, 50, 217, 128, 24, 133, 156, 35, 8, 66, 161, 26, 226, 44, 6, 154, 17, 187, 152, 141, 50, 137, 83, 169, 50, 219, 81, 163, 11, 71, 169, 154, 203, 66, 208, 25, 129, 154, 25, 119, 160, 24, 161, 11, 1, 41, 146, 26, 249, 30, 147, 12, 37, 136, 1, 186, 24, 18, 153, 25, 52, 233, 72, 147, 173, 8, 147, 29, 134, 142, 36, 187, 82, 184, 57, 209, 43, 6, 170, 16, 161, 26, 147, 58, 7, 139, 36, 170, 0, 154, 36, 205, 65, 168, 73, 162, 27, 5, 170, 49, 129, 136, 137, 84, 232, 26, 3, 140, 129, 171, 53, 186, 80, 160, 33, 170, 51, 235, 65, 217, 40, 144, 51, 205, 84, 217, 56, 193, 28, 147, 140, 35, 186, 65, 128, 1, 137, 17, 185, 154, 137, 152, 38, 191, 100, 201, 73, 144, 40, 168, 113, 146, 56, 162, 75, 240, 157, 201, 140, 32, 49, 68, 18, 50, 20, 8, 152, 9, 2, 189, 24, 233, 11, 201, 171, 201, 157, 0, 187, 32, 145, 115, 133, 41, 147, 175, 128, 189, 40, 184, 40, 18, 48, 20, 137, 82, 18, 49, 54, 1, 68, 129, 32, 193, 138, 193, 140, 144, 139, 37, 32, 37, 34, 71, 5, 35, 0, 20, 137, 129, 188, 153, 174, 0, 171, 67, 235, 56, 216, 41, 161, 57, 132, 64, 19, 64, 177, 48, 240, 12, 201, 154, 203, 8, 202, 56, 145, 74, 5, 138, 39, 186, 50, 184, 8, 251, 154, 170, 234, 155, 144, 159, 51, 152, 100, 129, 49, 163, 26, 21, 202, 136, 168, 17, 233, 138, 136, 8, 220, 154, 9, 33, 20, 170, 81, 129, 128, 202, 24, 128, 184, 159, 0, 153, 24, 0, 84, 1, 99, 2, 32, 51, 50, 146, 9, 162, 175, 186, 140, 136, 24, 1, 115, 135, 57, 55, 17, 49, 52, 129, 136, 9, 208, 190, 186, 156, 234, 12, 128, 138, 33, 136, 237, 172, 137, 169, 41, 87, 54, 18, 34, 35, 33, 129, 32, 19, 18, 129, 49, 144, 24, 20, 65, 177, 175, 186, 26, 3, 139, 54, 17, 249, 239, 154, 187, 170, 187, 9, 128, 152, 170, 10, 34, 168, 186, 172, 144, 155, 160, 207, 128, 186, 236, 189, 10, 35, 0, 115, 21, 50, 36, 0, 152, 172, 152, 204, 156, 144, 9, 129, 154, 82, 2, 0, 8, 66, 68, 51, 34, 51, 224, 189, 203, 170, 216, 172, 136, 154, 8, 16, 8, 69, 184, 10, 176, 139, 152, 190, 154, 219, 9, 250, 42, 2, 56, 53, 115, 36, 17, 52, 17, 17, 152, 99, 161, 41, 129, 40, 178, 141, 2, 173, 16, 144, 8, 8, 17, 250, 158, 170, 138, 216, 172, 186, 154, 203, 40, 146, 73, 147, 140, 144, 120, 21, 56, 22, 8, 51, 169, 50, 138, 39, 168, 67, 145, 81, 129, 98, 161, 41, 20, 154, 184, 10, 53, 184, 136, 152, 169, 223, 9, 169, 80, 36, 129, 153, 18, 169, 137, 64, 37, 160, 57, 148, 158, 2, 10, 3, 191, 16, 185, 25, 68, 36, 33, 54, 145, 201, 171, 136, 218, 9, 52, 144, 170, 153, 136, 152, 115, 55, 8, 50, 144, 10, 97, 37, 152, 9, 203, 186, 221, 9, 0, 32, 161, 25, 179, 175, 40, 115, 83, 68, 52, 33, 34, 1, 152, 138, 1, 186, 25, 168, 138, 137, 0, 1, 0, 219, 189, 155, 204, 138, 185, 188, 252, 191, 188, 219, 187, 170, 154, 137, 8, 0, 0, 137, 153, 186, 204, 187, 235, 187, 154, 153, 171, 17, 33, 18, 97, 71, 67, 68, 51, 50, 19, 152, 185, 204, 170, 203, 187, 170, 154, 170, 8, 16, 53, 128, 0, 128, 218, 188, 202, 206, 188, 171, 205, 171, 170, 187, 9, 130, 25, 35, 32, 54, 0, 34, 216, 138, 169, 204, 187, 187, 48, 249, 75, 55, 17, 84, 50, 51, 50, 53, 34, 1, 9, 67, 160, 155, 17, 184, 191, 32, 145, 154, 99, 146, 172, 49, 178, 157, 16, 235, 137, 201, 155, 34, 186, 115, 131, 113, 20, 40, 34, 136, 115, 130, 57, 18, 48, 176, 115, 164, 88, 52, 82, 67, 84, 51, 1, 49, 144, 137, 217, 10, 184, 154, 201, 154, 219, 26, 208, 157, 128, 153, 152, 139, 144, 32, 12, 41, 0, 204, 170, 204, 187, 188, 171, 155, 0, 16, 103, 18, 33, 67, 17, 49, 18, 137, 34, 152, 234, 156, 144, 190, 139, 170, 154, 10, 34, 64, 38, 0, 51, 252, 172, 136, 202, 156, 136, 137, 185, 25, 21, 24, 67, 19, 68, 4, 136, 0, 185, 174, 136, 251, 170, 152, 186, 73, 132, 43, 71, 16, 19, 65, 37, 128, 24, 2, 136, 16, 169, 17, 160, 219, 139, 128, 153, 35, 97, 87, 128, 49, 19, 0, 192, 155, 168, 255, 174, 136, 153, 65, 69, 53, 34, 35, 17, 128, 153, 0, 0, 51, 176, 154, 217, 189, 171, 202, 154, 184, 138, 51, 114, 36, 33, 146, 191, 204, 189, 187, 173, 153, 152, 8, 136, 136, 168, 154, 170, 138, 64, 17, 49, 144, 154, 253, 188, 188, 169, 203, 136, 16, 99, 53, 51, 53, 17, 1, 168, 154, 170, 170, 169, 189, 138, 203, 139, 202, 188, 9, 34, 83, 85, 51, 18, 144, 219, 204, 203, 172, 186, 188, 171, 154, 153, 136, 17, 33, 66, 52, 35, 83, 51, 19, 0, 160, 235, 203, 172, 136, 24, 117, 51, 69, 35, 51, 67, 51, 34, 52, 2, 50, 19, 1, 169, 187, 221, 187, 24, 17, 50, 84, 51, 161, 16, 224, 187, 250, 172, 201, 188, 8, 169, 154, 16, 1, 128, 33, 51, 84, 68, 53, 34, 50, 19, 17, 160, 155, 18, 152, 115, 71, 34, 33, 84, 18, 33, 34, 66, 1, 128, 152, 152, 203, 172, 186, 207, 172, 153, 153, 171, 50, 20, 67, 35, 130, 16, 249, 172, 202, 190, 170, 187, 172, 9, 0, 66, 52, 83, 37, 18, 16, 18, 168, 137, 0, 234, 173, 25, 168, 175, 40, 3, 9, 53, 51, 54, 2, 82, 35, 128, 218, 188, 172, 218, 187, 33, 128, 66, 144, 88, 131, 24, 54, 18, 67, 36, 67, 18, 153, 129, 222, 171, 186, 154, 129, 136, 114, 35, 8, 84, 128, 154, 168, 236, 187, 155, 113, 52, 52, 69, 17, 128, 136, 153, 9, 16, 49, 130, 168, 170, 186, 172, 152, 236, 172, 170, 186, 25, 69, 17, 1, 153, 250, 191, 187, 203, 186, 153, 152, 154, 136, 184, 188, 154, 185, 156, 170, 139, 129, 10, 37, 184, 174, 40, 176, 158, 136, 155, 100, 34, 69, 36, 35, 1, 136, 153, 153, 9, 168, 141, 51, 128, 169, 172, 152, 157, 34, 65, 39, 0, 1, 203, 137, 186, 203, 207, 172, 188, 187, 155, 185, 138, 34, 33, 37, 33, 146, 171, 233, 141, 152, 139, 3, 56, 163, 122, 53, 69, 35, 98, 51, 65, 67, 67, 35, 85, 35, 17, 0, 152, 204, 154, 128, 10, 0, 49, 193, 27, 145, 40, 248, 42, 232, 156, 169, 170, 154, 137, 184, 203, 188, 186, 191, 24, 0, 82, 68, 36, 34, 50, 35, 136, 24, 1, 128, 16, 51, 2, 100, 67, 36, 67, 52, 35, 18, 49, 50, 0, 99, 2, 170, 154, 185, 255, 188, 170, 136, 136, 81, 67, 3, 17, 159, 30, 44, 0, 2, 170, 154, 153, 249, 191, 154, 203, 170, 8, 152, 153, 144, 138, 0, 115, 52, 52, 52, 36, 128, 152, 203, 188, 153, 154, 32, 51, 53, 35, 67, 82, 52, 83, 19, 144, 168, 138, 70, 18, 49, 130, 205, 188, 186, 172, 136, 137, 17, 176, 26, 2, 203, 56, 21, 153, 115, 3, 187, 171, 41, 38, 128, 99, 194, 191, 171, 170, 24, 2, 32, 70, 130, 16, 66, 18, 33, 131, 251, 188, 189, 154, 9, 49, 84, 52, 35, 35, 1, 129, 9, 17, 201, 172, 203, 189, 169, 186, 170, 204, 11, 216, 140, 17, 154, 99, 18, 48, 2, 201, 205, 220, 187, 188, 156, 170, 171, 154, 137, 154, 24, 136, 136, 169, 48, 232, 156, 218, 171, 152, 219, 154, 201, 205, 154, 154, 186, 74, 37, 16, 67, 50, 2, 9, 18, 202, 9, 176, 174, 152, 205, 8, 169, 41, 35, 50, 35, 85, 35, 33, 82, 55, 129, 8, 2, 217, 138, 184, 157, 168, 155, 161, 173, 16, 17, 82, 50, 52, 1, 201, 173, 202, 187, 136, 136, 137, 97, 131, 58, 119, 34, 67, 36, 51, 36, 50, 19, 24, 35, 128, 113, 130, 138, 2, 137, 67, 68, 34, 71, 129, 50, 3, 8, 136, 145, 219, 64, 19, 0, 32, 19, 234, 26, 20, 8, 160, 188, 138, 86, 145, 80, 3, 24, 35, 85, 2, 10, 66, 128, 48, 21, 152, 34, 32, 70, 130, 40, 52, 144, 73, 20, 8, 69, 18, 32, 83, 51, 32, 18, 235, 172, 153, 1, 129, 17, 161, 10, 70, 34, 66, 2, 114, 6, 136, 33, 186, 8, 168, 152, 156, 85, 34, 51, 3, 184, 223, 138, 185, 26, 17, 97, 20, 201, 138, 152, 154, 8, 17, 201, 173, 128, 155, 49, 152, 68, 160, 219, 205, 173, 9, 152, 8, 128, 48, 2, 67, 145, 186, 187, 169, 255, 10, 129, 170, 137, 152, 204, 56, 5, 170, 0, 238, 155, 144, 153, 128, 187, 40, 176, 156, 222, 155, 153, 10, 161, 188, 185, 191, 10, 144, 154, 170, 219, 189, 11, 128, 154, 153, 184, 207, 25, 51, 128, 18, 251, 142, 0, 8, 66, 146, 171, 128, 170, 8, 83, 208, 11, 145, 155, 201, 158, 17, 235, 10, 1, 186, 40, 232, 26, 160, 40, 21, 129, 24, 161, 142, 17, 171, 169, 171, 170, 120, 37, 0, 152, 72, 36, 24, 52, 67, 18, 98, 19, 65, 53, 1, 48, 192, 157, 145, 154, 49, 0, 53, 8, 103, 1, 65, 2, 17, 2, 32, 146, 138, 234, 203, 170, 137, 154, 17, 24, 35, 171, 162, 191, 49, 24, 55, 66, 39, 219, 24, 192, 155, 160, 155, 0, 139, 33, 169, 101, 161, 89, 5, 8, 19, 136, 129, 156, 128, 170, 68, 136, 66, 184, 89, 4, 8, 51, 50, 68, 69, 18, 32, 33, 129, 97, 161, 43, 163, 142, 18, 155, 83, 152, 81, 131, 137, 17, 33, 35, 129, 66, 201, 9, 1, 17, 17, 2, 57, 55, 99, 120, 0, 21, 0, 86, 36, 51, 53, 2, 33, 51, 35, 34, 50, 19, 49, 3, 82, 19, 114, 38, 49, 55, 2, 25, 83, 34, 67, 19, 17, 145, 172, 17, 171, 136, 25, 131, 156, 83, 51, 130, 113, 21, 138, 1, 201, 202, 154, 176, 171, 144, 25, 147, 175, 202, 172, 187, 73, 38, 136, 32, 34, 146, 172, 24, 249, 12, 178, 239, 8, 137, 137, 152, 152, 137, 48, 163, 140, 160, 11, 162, 143, 145, 207, 171, 153, 136, 202, 154, 1, 153, 222, 155, 128, 154, 36, 136, 33, 218, 9, 201, 41, 2, 136, 144, 219, 169, 202, 74, 55, 128, 136, 9, 18, 186, 33, 216, 187, 174, 16, 192, 10, 130, 237, 172, 8, 217, 138, 184, 57, 225, 158, 8, 219, 154, 144, 203, 170, 170, 186, 204, 187, 202, 203, 186, 189, 136, 202, 154, 170, 170, 153, 32, 177, 223, 170, 186, 155, 128, 154, 160, 255, 137, 129, 170, 32, 51, 146, 14, 69, 1, 152, 40, 52, 1, 168, 188, 188, 155, 152, 171, 154, 136, 0, 42, 103, 185, 24, 234, 154, 202, 154, 56, 162, 28, 177, 158, 169, 10, 161, 156, 202, 174, 152, 138, 144, 137, 145, 188, 65, 36, 184, 120, 132, 26, 132, 139, 33, 32, 193, 57, 225, 74, 38, 32, 36, 33, 69, 17, 49, 20, 0, 50, 129, 9, 0, 236, 112, 20, 9, 34, 8, 83, 129, 33, 36, 129, 10, 68, 18, 201, 48, 178, 106, 148, 155, 68, 1, 0, 16, 0, 83, 176, 96, 130, 48, 6, 25, 3, 157, 36, 145, 16, 144, 136, 9, 35, 250, 139, 50, 19, 41, 87, 144, 65, 2, 24, 161, 25, 35, 33, 193, 173, 16, 49, 161, 159, 129, 156, 83, 168, 81, 1, 0, 56, 39, 154, 34, 168, 25, 114, 4, 187, 128, 57, 213, 175, 33, 65, 4, 172, 128, 202, 56, 3, 48, 51, 192, 11, 6, 169, 82, 131, 189, 10, 160, 11, 37, 17, 50, 160, 80, 38, 130, 170, 81, 3, 65, 130, 223, 154, 137, 32, 54, 129, 32, 4, 189, 40, 51, 37, 129, 154, 187, 57, 71, 20, 200, 41, 144, 187, 186, 42, 39, 185, 11, 69, 19, 16, 17, 184, 139, 2, 112, 147, 191, 9, 9, 49, 67, 145, 170, 155, 8, 81, 21, 128, 128, 139, 66, 2, 24, 4, 255, 153, 136, 33, 160, 187, 138, 153, 41, 54, 129, 187, 171, 98, 19, 8, 1, 201, 190, 24, 160, 139, 235, 171, 220, 26, 128, 137, 208, 173, 152, 9, 49, 20, 185, 8, 129, 203, 105, 132, 189, 136, 202, 41, 177, 157, 50, 160, 156, 152, 32, 21, 153, 81, 176, 11, 82, 36, 184, 137, 221, 155, 160, 189, 10, 153, 0, 168, 41, 161, 173, 32, 36, 34, 161, 139, 208, 190, 9, 160, 188, 219, 189, 186, 172, 154, 113, 130, 24, 36, 8, 32, 2, 10, 3, 223, 9, 185, 172, 170, 56, 177, 27, 178, 158, 18, 234, 137, 185, 138, 3, 16, 134, 220, 252, 11, 0, 173, 17, 172, 2, 156, 160, 191, 170, 24, 224, 42, 35, 218, 139, 0, 186, 9, 33, 194, 189, 16, 0, 87, 145, 154, 16, 17, 16, 70, 128, 48, 4, 16, 51, 131, 41, 180, 45, 133, 58, 39, 16, 161, 113, 130, 42, 131, 57, 165, 28, 7, 9, 51, 17, 137, 65, 184, 48, 146, 113, 19, 153, 32, 18, 250, 140, 68, 160, 16, 0, 32, 67, 53, 17, 129, 98, 35, 136, 153, 192, 157, 0, 9, 177, 142, 1, 24, 3, 98, 36, 100, 2, 8, 50, 130, 57, 147, 171, 251, 10, 176, 88, 131, 43, 87, 16, 1, 136, 0, 169, 48, 3, 106, 23, 136, 51, 152, 20, 204, 32, 144, 80, 18, 34, 17, 68, 17, 34, 9, 145, 58, 134, 141, 1, 10, 162, 207, 49, 0, 184, 13, 4, 137, 34, 17, 161, 203, 171, 8, 252, 155, 129, 234, 172, 152, 219, 65, 161, 153, 137, 83, 217, 26, 145, 9, 160, 73, 131, 171, 204, 169, 174, 152, 159, 0, 186, 24, 17, 137, 1, 190, 81, 144, 81, 129, 152, 220, 24, 160, 58, 163, 140, 1, 170, 96, 132, 154, 130, 138, 161, 122, 22, 152, 40, 34, 146, 159, 144, 189, 9, 1, 152, 50, 1, 67, 138, 37, 235, 16, 169, 65, 200, 41, 192, 58, 21, 186, 32, 232, 74, 147, 158, 144, 140, 2, 154, 9, 144, 170, 32, 192, 140, 17, 218, 26, 34, 160, 188, 8, 253, 140, 128, 155, 152, 56, 193, 156, 160, 58, 23, 154, 3, 171, 83, 128, 115, 162, 24, 19, 169, 155, 160, 175, 83, 129, 40, 35, 217, 41, 147, 191, 32, 128, 32, 49, 51, 18, 67, 0, 172, 74, 132, 191, 40, 161, 155, 162, 172, 0, 168, 99, 19, 17, 1, 190, 41, 4, 206, 9, 145, 204, 41, 192, 10, 3, 0, 82, 52, 152, 114, 146, 56, 20, 41, 131, 10, 160, 10, 19, 16, 35, 1, 170, 65, 34, 101, 35, 17, 186, 80, 3, 8, 192, 42, 39, 160, 89, 38, 184, 138, 18, 136, 99, 146, 27, 22, 40, 38, 152, 35, 169, 32, 16, 196, 159, 19, 139, 70, 99, 2, 137, 128, 218, 27, 55, 130, 16, 118, 51, 86, 3, 17, 184, 173, 170, 217, 173, 153, 191, 138, 129, 154, 49, 146, 138, 51, 116, 36, 34, 34, 1, 19, 24, 51, 161, 221, 188, 202, 188, 154, 154, 170, 187, 154, 25, 119, 35, 82, 18, 8, 32, 36, 34, 36, 169, 187, 204, 25, 1, 145, 223, 170, 155, 24, 16, 2, 219, 187, 80, 35, 66, 3, 202, 139, 115, 67, 34, 1, 137, 136, 49, 21, 249, 204, 155, 0, 16, 18, 168, 223, 10, 128, 8, 144, 217, 173, 32, 50, 38, 16, 128, 40, 34, 101, 18, 128, 154, 137, 1, 0, 217, 205, 188, 139, 0, 136, 168, 186, 10, 100, 51, 19, 48, 53, 83, 70, 19, 129, 136, 137, 153, 0, 202, 205, 203, 155, 128, 185, 152, 221, 170, 137, 20, 233, 50, 0, 49, 68, 34, 32, 129, 48, 71, 18, 17, 1, 152, 8, 200, 187, 253, 187, 202, 156, 153, 8, 0, 50, 50, 52, 67, 68, 34, 67, 34, 33, 35, 17, 152, 184, 189, 204, 188, 220, 187, 186, 139, 129, 9, 34, 137, 103, 51, 99, 35, 1, 128, 136, 16, 185, 204, 236, 203, 170, 8, 169, 8, 201, 11, 35, 84, 36, 33, 1, 33, 53, 67, 35, 144, 185, 155, 49, 161, 189, 237, 189, 137, 136, 136, 8, 144, 10, 69, 19, 50, 18, 128, 72, 87, 18, 136, 169, 171, 9, 0, 67, 248, 174, 153, 32, 19, 24, 217, 140, 32, 115, 35, 168, 186, 203, 42, 53, 18, 184, 190, 153, 24, 50, 67, 240, 174, 144, 137, 128, 155, 154, 152, 26, 119, 2, 32, 1, 0, 48, 54, 18, 33, 152, 25, 177, 191, 160, 191, 138, 186, 11, 130, 154, 16, 236, 41, 19, 80, 54, 0, 66, 18, 33, 34, 145, 170, 0, 219, 11, 2, 221, 219, 155, 202, 26, 201, 137, 204, 65, 1, 115, 17, 0, 154, 16, 136, 68, 176, 137, 170, 145, 159, 21, 170, 0, 11, 20, 138, 20, 0, 235, 41, 18, 152, 26, 18, 112, 18, 115, 176, 42, 129, 49, 220, 48, 249, 139, 129, 8, 19, 176, 155, 217, 58, 71, 144, 0, 152, 152, 8, 145, 9, 18, 25, 39, 218, 113, 162, 12, 2, 189, 32, 17, 2, 185, 33, 251, 11, 144, 107, 38, 202, 32, 233, 40, 146, 40, 178, 157, 33, 145, 104, 5, 155, 1, 136, 153, 24, 216, 187, 223, 24, 2, 24, 37, 160, 56, 37, 83, 19, 1, 2, 8, 67, 51, 210, 159, 136, 218, 137, 145, 188, 154, 157, 0, 185, 16, 200, 138, 128, 67, 3, 34, 152, 98, 2, 67, 2, 185, 9, 160, 114, 194, 12, 200, 157, 129, 140, 0, 10, 34, 48, 39, 1, 33, 52, 128, 115, 3, 0, 129, 48, 200, 72, 208, 155, 186, 169, 207, 32, 184, 138, 152, 170, 72, 2, 80, 21, 136, 34, 144, 99, 17, 0, 186, 137, 185, 41, 193, 206, 205, 155, 136, 9, 128, 136, 168, 74, 53, 19, 17, 70, 128, 65, 35, 83, 129, 138, 32, 67, 144, 83, 216, 156, 169, 137, 34, 144, 9, 169, 88, 131, 154, 170, 220, 42, 71, 17, 184, 12, 216, 155, 161, 170, 202, 96, 3, 202, 154, 186, 173, 34, 34, 82, 35, 49, 55, 16, 34, 136, 16, 136, 34, 136, 4, 223, 40, 200, 10, 202, 171, 64, 3, 40, 162, 191, 154, 115, 19, 17, 129, 187, 73, 20, 138, 2, 136, 233, 155, 16, 51, 250, 142, 49, 33, 0, 152, 216, 175, 32, 18, 128, 186, 136, 9, 1, 115, 150, 156, 152, 9, 65, 22, 153, 145, 190, 56, 17, 50, 18, 153, 154, 32, 52, 176, 11, 250, 143, 3, 10, 128, 26, 249, 140, 2, 138, 50, 19, 153, 48, 68, 35, 8, 36, 251, 140, 0, 35, 176, 24, 250, 139, 128, 112, 252, 47, 0, 156, 34, 234, 25, 146, 10, 52, 1, 137, 0, 65, 71, 18, 0, 8, 128, 16, 35, 115, 148, 188, 169, 190, 25, 130, 172, 1, 238, 9, 0, 49, 131, 169, 16, 168, 117, 132, 137, 144, 219, 41, 37, 1, 152, 186, 189, 24, 36, 129, 185, 189, 169, 42, 103, 129, 137, 128, 136, 25, 35, 136, 128, 190, 32, 251, 11, 37, 184, 138, 52, 0, 8, 49, 50, 34, 33, 86, 18, 115, 130, 9, 168, 173, 137, 19, 203, 24, 202, 203, 156, 49, 1, 152, 187, 136, 138, 67, 8, 34, 204, 112, 39, 160, 8, 129, 24, 1, 144, 189, 184, 175, 168, 171, 50, 147, 188, 82, 145, 25, 24, 68, 201, 26, 1, 116, 21, 184, 26, 18, 217, 139, 98, 4, 185, 8, 185, 139, 68, 129, 186, 155, 98, 36, 145, 157, 153, 10, 100, 20, 201, 138, 169, 25, 66, 5, 186, 169, 139, 68, 129, 152, 169, 235, 140, 50, 51, 160, 156, 67, 18, 100, 19, 201, 41, 131, 24, 5, 171, 168, 158, 152, 25, 130, 235, 188, 25, 1, 115, 2, 204, 25, 18, 34, 18, 17, 221, 8, 0, 84, 145, 136, 234, 10, 0, 8, 185, 172, 204, 32, 130, 1, 236, 9, 32, 100, 35, 1, 144, 32, 53, 67, 17, 152, 201, 188, 9, 17, 201, 189, 173, 155, 40, 129, 186, 169, 189, 80, 68, 18, 1, 152, 154, 82, 129, 1, 169, 153, 171, 49, 116, 19, 220, 154, 202, 138, 17, 67, 130, 9, 16, 98, 35, 17, 152, 114, 3, 49, 132, 189, 203, 155, 50, 50, 193, 190, 154, 0, 82, 37, 128, 153, 137, 34, 66, 21, 152, 136, 137, 99, 193, 140, 216, 173, 128, 137, 17, 152, 186, 204, 155, 80, 37, 152, 25, 17, 8, 100, 51, 36, 144, 33, 144, 48, 34, 163, 223, 170, 26, 130, 25, 177, 207, 172, 25, 152, 154, 40, 52, 168, 114, 7, 16, 0, 17, 144, 0, 168, 186, 207, 26, 2, 32, 162, 188, 236, 154, 128, 24, 19, 32, 147, 157, 66, 17, 66, 50, 130, 57, 38, 153, 8, 25, 21, 220, 152, 203, 41, 68, 130, 173, 168, 157, 129, 8, 2, 48, 67, 86, 2, 128, 152, 128, 170, 0, 235, 138, 219, 140, 1, 10, 4, 205, 8, 137, 49, 129, 153, 136, 114, 19, 136, 34, 170, 16, 56, 119, 131, 154, 82, 129, 82, 208, 10, 129, 26, 21, 138, 160, 174, 153, 40, 36, 152, 168, 156, 49, 16, 85, 176, 140, 128, 49, 145, 25, 208, 142, 33, 49, 35, 218, 205, 139, 34, 152, 129, 238, 154, 137, 49, 35, 18, 184, 25, 67, 87, 19, 152, 170, 155, 80, 35, 129, 0, 218, 137, 1, 32, 146, 191, 33, 145, 185, 138, 176, 44, 119, 129, 0, 185, 189, 138, 8, 1, 145, 169, 48, 55, 36, 232, 154, 128, 24, 84, 1, 40, 232, 140, 129, 40, 177, 26, 220, 56, 17, 69, 168, 169, 171, 66, 51, 3, 188, 81, 255, 49, 0, 137, 0, 115, 19, 128, 251, 139, 129, 58, 4, 172, 18, 136, 53, 2, 200, 173, 169, 72, 5, 16, 145, 155, 186, 72, 34, 34, 192, 222, 138, 16, 85, 161, 137, 200, 155, 82, 129, 138, 35, 219, 40, 129, 17, 33, 19, 204, 9, 250, 138, 1, 137, 201, 11, 4, 25, 54, 17, 34, 83, 131, 140, 34, 32, 87, 16, 67, 161, 139, 168, 9, 144, 139, 250, 174, 8, 137, 185, 155, 128, 218, 10, 2, 8, 52, 33, 209, 90, 21, 16, 130, 24, 160, 91, 71, 152, 219, 25, 176, 26, 161, 139, 220, 64, 18, 34, 235, 57, 2, 138, 52, 160, 0, 219, 64, 144, 8, 168, 114, 164, 172, 65, 3, 185, 186, 138, 18, 114, 150, 173, 128, 137, 50, 115, 146, 172, 137, 9, 18, 67, 129, 155, 200, 156, 51, 51, 178, 174, 24, 66, 19, 168, 221, 138, 16, 34, 1, 192, 190, 138, 65, 37, 144, 16, 176, 174, 72, 36, 129, 186, 25, 2, 25, 53, 248, 187, 138, 80, 53, 18, 144, 170, 219, 11, 53, 128, 168, 9, 145, 171, 201, 25, 144, 97, 129, 81, 50, 3, 25, 164, 121, 39, 136, 176, 204, 156, 8, 128, 0, 218, 138, 201, 138, 161, 11, 146, 173, 33, 35, 67, 52, 1, 1, 101, 52, 19, 128, 8, 187, 114, 55, 1, 152, 138, 152, 137, 0, 144, 219, 154, 24, 248, 172, 1, 169, 64, 35, 34, 203, 136, 207, 16, 152, 35, 16, 177, 142, 208, 157, 144, 137, 152, 136, 170, 16, 201, 58, 55, 145, 26, 51, 84, 36, 17, 35, 169, 98, 66, 52, 34, 0, 170, 25, 53, 18, 250, 157, 8, 168, 40, 3, 222, 10, 128, 25, 2, 219, 171, 203, 25, 33, 0, 34, 249, 57, 3, 9, 161, 202, 154, 32, 51, 52, 177, 158, 49, 168, 114, 161, 173, 152, 26, 52, 52, 20, 128, 152, 64, 55, 19, 34, 1, 34, 169, 114, 208, 26, 129, 137, 8, 68, 184, 250, 173, 128, 26, 133, 9, 162, 157, 144, 26, 38, 152, 185, 173, 154, 10, 19, 16, 16, 117, 129, 9, 18, 145, 171, 2, 205, 25, 66, 193, 188, 8, 100, 2, 16, 128, 9, 18, 72, 21, 153, 168, 10, 17, 52, 146, 188, 154, 200, 173, 152, 184, 223, 139, 136, 56, 146, 173, 153, 25, 36, 160, 48, 232, 138, 218, 56, 54, 17, 144, 16, 177, 27, 132, 88, 147, 57, 3, 144, 207, 32, 233, 26, 54, 17, 1, 168, 171, 25, 35, 8, 51, 115, 23, 169, 128, 137, 52, 250, 26, 19, 136, 202, 170, 152, 72, 193, 26, 162, 159, 50, 136, 50, 128, 100, 129, 186, 155, 204, 80, 161, 57, 130, 57, 248, 187, 172, 72, 3, 152, 16, 0, 48, 119, 18, 18, 51, 130, 155, 80, 51, 49, 83, 35, 130, 203, 155, 201, 191, 9, 144, 172, 98, 176, 171, 155, 50, 187, 87, 168, 187, 140, 33, 176, 188, 156, 169, 152, 137, 50, 149, 251, 34, 0, 176, 206, 171, 188, 56, 3, 16, 251, 172, 186, 113, 2, 64, 20, 24, 18, 32, 144, 57, 19, 84, 145, 144, 174, 184, 175, 17, 170, 40, 233, 10, 200, 155, 16, 114, 20, 32, 21, 16, 68, 18, 83, 83, 50, 34, 52, 19, 16, 67, 51, 36, 1, 153, 137, 235, 172, 171, 203, 175, 171, 188, 187, 189, 203, 170, 219, 186, 171, 186, 173, 152, 169, 8, 202, 154, 186, 10, 36, 34, 129, 65, 37, 16, 52, 19, 18, 8, 100, 67, 19, 128, 67, 130, 49, 53, 52, 34, 34, 51, 53, 52, 53, 18, 17, 48, 54, 1, 50, 1, 17, 233, 11, 33, 144, 175, 8, 251, 172, 170, 9, 169, 169, 207, 24, 201, 25, 19, 17, 128, 97, 20, 9, 68, 129, 66, 20, 49, 3, 40, 39, 33, 66, 18, 35, 34, 0, 49, 39, 160, 24, 19, 170, 136, 186, 144, 255, 140, 185, 173, 153, 186, 155, 153, 33, 208, 138, 251, 41, 176, 11, 51, 85, 37, 16, 34, 169, 40, 152, 115, 161, 72, 146, 156, 0, 185, 57, 22, 0, 16, 34, 170, 32, 128, 87, 2, 49, 21, 17, 160, 74, 39, 128, 67, 2, 137, 153, 218, 187, 32, 145, 65, 240, 175, 153, 219, 171, 169, 186, 172, 171, 168, 206, 154, 136, 48, 52, 50, 53, 66, 53, 115, 35, 50, 53, 50, 52, 34, 67, 36, 17, 1, 18, 128, 136, 169, 235, 204, 187, 235, 203, 187, 188, 203, 203, 187, 203, 187, 172, 202, 170, 171, 171, 186, 171, 153, 170, 154, 40, 18, 8, 34, 83, 52, 17, 51, 52, 19, 153, 40, 52, 232, 140, 66, 144, 73, 55, 129, 97, 19, 66, 35, 83, 68, 50, 35, 99, 36, 32, 34, 33, 18, 49, 129, 32, 185, 33, 253, 157, 169, 188, 172, 187, 204, 137, 204, 155, 168, 172, 153, 128, 137, 16, 16, 82, 53, 67, 83, 53, 51, 67, 53, 35, 50, 69, 34, 83, 18, 49, 19, 17, 33, 19, 153, 17, 144, 186, 223, 154, 189, 187, 219, 153, 219, 170, 170, 171, 204, 138, 144, 169, 16, 129, 41, 35, 115, 20, 64, 37, 17, 51, 129, 82, 19, 32, 52, 49, 130, 155, 160, 205, 219, 139, 0, 187, 9, 251, 157, 137, 169, 40, 35, 98, 37, 1, 49, 35, 66, 53, 35, 49, 19, 136, 2, 138, 53, 250, 171, 204, 203, 189, 154, 136, 136, 185, 203, 185, 205, 9, 129, 56, 38, 1, 0, 137, 84, 130, 65, 53, 36, 1, 49, 19, 168, 32, 54, 3, 152, 1, 238, 156, 184, 158, 8, 201, 154, 201, 188, 203, 188, 154, 137, 137, 65, 37, 18, 50, 53, 69, 52, 67, 53, 50, 66, 35, 51, 50, 50, 34, 129, 136, 152, 154, 234, 205, 203, 204, 203, 172, 203, 187, 203, 171, 172, 187, 188, 186, 203, 170, 170, 137, 137, 24, 17, 0, 49, 36, 99, 51, 69, 36, 33, 20, 0, 2, 8, 35, 128, 50, 130, 16, 160, 9, 54, 226, 30, 0, 248, 13, 2, 155, 100, 146, 40, 36, 16, 52, 18, 83, 1, 32, 177, 156, 16, 168, 239, 188, 187, 205, 187, 203, 172, 186, 172, 187, 189, 187, 186, 155, 9, 49, 51, 66, 67, 69, 83, 52, 52, 52, 52, 50, 50, 51, 52, 68, 35, 34, 52, 33, 17, 0, 152, 57, 20, 154, 33, 250, 187, 188, 154, 154, 169, 219, 136, 217, 155, 34, 201, 57, 37, 136, 97, 35, 16, 20, 16, 69, 34, 18, 17, 35, 48, 71, 51, 53, 1, 36, 152, 66, 2, 48, 36, 52, 2, 50, 208, 10, 146, 139, 144, 140, 4, 222, 170, 186, 154, 235, 171, 186, 190, 154, 217, 156, 169, 170, 219, 171, 176, 174, 16, 137, 67, 130, 81, 35, 50, 53, 53, 36, 67, 51, 35, 17, 18, 169, 25, 176, 156, 232, 190, 186, 223, 153, 169, 155, 169, 186, 169, 220, 138, 34, 169, 96, 35, 169, 24, 168, 113, 39, 0, 16, 160, 171, 49, 168, 97, 145, 171, 153, 187, 188, 128, 238, 155, 169, 0, 152, 40, 18, 234, 10, 145, 219, 154, 40, 116, 87, 51, 67, 34, 34, 67, 51, 69, 68, 18, 18, 17, 128, 136, 8, 8, 169, 187, 206, 189, 173, 203, 188, 186, 204, 170, 187, 187, 172, 171, 170, 170, 169, 137, 137, 49, 85, 52, 52, 67, 34, 51, 66, 52, 35, 53, 35, 18, 34, 185, 154, 218, 140, 0, 170, 136, 251, 172, 202, 187, 170, 187, 137, 136, 169, 186, 205, 204, 186, 154, 171, 171, 202, 203, 189, 186, 219, 187, 203, 188, 170, 137, 17, 9, 35, 0, 50, 65, 119, 50, 68, 51, 52, 35, 52, 34, 67, 67, 36, 51, 37, 16, 18, 152, 0, 202, 153, 137, 153, 186, 219, 221, 187, 204, 186, 138, 170, 138, 144, 155, 144, 154, 34, 80, 55, 68, 52, 82, 51, 67, 51, 50, 53, 67, 36, 49, 35, 34, 35, 8, 83, 145, 24, 32, 145, 157, 82, 144, 33, 145, 50, 217, 42, 53, 100, 129, 138, 160, 188, 10, 184, 175, 24, 144, 171, 170, 201, 207, 9, 129, 82, 20, 24, 3, 153, 65, 34, 67, 35, 51, 160, 171, 153, 253, 154, 144, 203, 152, 221, 154, 235, 10, 168, 154, 169, 203, 170, 203, 138, 67, 145, 10, 36, 200, 138, 176, 120, 39, 16, 0, 144, 202, 32, 160, 72, 130, 189, 154, 201, 190, 136, 202, 138, 184, 138, 177, 175, 65, 160, 80, 21, 8, 34, 168, 26, 84, 35, 52, 146, 155, 152, 223, 154, 33, 160, 154, 129, 223, 186, 188, 9, 168, 10, 34, 168, 40, 161, 175, 8, 186, 113, 36, 116, 84, 50, 51, 36, 18, 50, 52, 52, 52, 35, 2, 128, 169, 186, 204, 186, 221, 187, 204, 204, 170, 188, 187, 186, 172, 153, 185, 154, 144, 137, 34, 66, 83, 51, 99, 52, 51, 52, 36, 17, 17, 1, 0, 17, 33, 33, 1, 185, 222, 205, 170, 170, 24, 0, 1, 218, 187, 206, 186, 187, 180, 227, 49, 0, 170, 186, 170, 219, 219, 219, 187, 203, 155, 9, 16, 34, 67, 17, 99, 51, 84, 35, 68, 35, 51, 36, 35, 2, 128, 153, 186, 172, 186, 190, 186, 174, 186, 188, 187, 173, 136, 17, 36, 50, 67, 33, 18, 50, 52, 71, 18, 32, 3, 128, 200, 172, 186, 189, 138, 136, 24, 1, 65, 18, 48, 85, 85, 50, 83, 51, 51, 36, 17, 33, 128, 9, 2, 203, 64, 193, 156, 136, 186, 219, 72, 19, 114, 36, 34, 37, 16, 51, 129, 136, 99, 19, 168, 138, 145, 206, 171, 170, 155, 81, 18, 98, 130, 73, 37, 0, 115, 18, 32, 18, 1, 33, 160, 156, 185, 206, 171, 187, 190, 153, 169, 204, 186, 203, 41, 130, 9, 36, 18, 67, 52, 34, 82, 4, 136, 51, 145, 0, 251, 156, 184, 155, 128, 203, 202, 171, 170, 154, 0, 101, 146, 154, 49, 36, 185, 88, 177, 191, 136, 204, 155, 220, 155, 168, 175, 9, 176, 27, 19, 173, 98, 130, 65, 21, 128, 66, 130, 41, 54, 1, 136, 169, 170, 136, 251, 156, 144, 187, 168, 205, 25, 216, 171, 128, 169, 81, 3, 24, 2, 202, 114, 161, 189, 169, 26, 68, 52, 69, 51, 17, 48, 53, 52, 69, 34, 35, 18, 16, 16, 152, 186, 203, 188, 221, 219, 186, 188, 187, 188, 171, 172, 170, 171, 138, 0, 40, 51, 66, 84, 51, 53, 52, 51, 35, 51, 18, 16, 1, 152, 128, 234, 171, 250, 172, 186, 188, 170, 170, 8, 136, 136, 203, 171, 185, 174, 186, 174, 154, 203, 171, 202, 188, 204, 170, 153, 32, 34, 69, 36, 49, 53, 36, 66, 51, 67, 19, 17, 35, 160, 220, 204, 187, 188, 203, 172, 172, 170, 170, 187, 171, 9, 34, 99, 52, 68, 52, 66, 35, 18, 99, 18, 0, 1, 0, 8, 169, 172, 187, 204, 170, 186, 139, 50, 19, 81, 37, 50, 52, 65, 68, 34, 33, 35, 168, 64, 163, 189, 234, 155, 32, 0, 33, 36, 67, 51, 100, 52, 52, 36, 67, 36, 49, 3, 154, 17, 251, 26, 146, 189, 136, 234, 139, 185, 10, 17, 33, 49, 71, 17, 67, 50, 68, 49, 35, 128, 67, 169, 8, 235, 154, 204, 154, 204, 186, 188, 26, 201, 140, 0, 168, 10, 37, 17, 84, 3, 1, 50, 34, 34, 20, 168, 154, 171, 251, 205, 154, 218, 171, 136, 203, 9, 192, 156, 34, 144, 114, 3, 136, 0, 0, 66, 20, 168, 25, 200, 174, 137, 8, 217, 12, 1, 187, 138, 217, 188, 24, 128, 25, 131, 191, 56, 192, 42, 54, 128, 153, 0, 168, 81, 35, 68, 18, 8, 168, 81, 147, 59, 55, 218, 9, 152, 186, 169, 187, 11, 249, 175, 50, 248, 156, 0, 169, 169, 238, 187, 202, 187, 41, 68, 51, 36, 17, 99, 52, 99, 52, 35, 35, 51, 34, 18, 0, 136, 184, 205, 188, 189, 188, 204, 171, 203, 187, 186, 170, 155, 8, 16, 67, 51, 66, 68, 51, 212, 244, 53, 0, 68, 36, 34, 33, 129, 144, 152, 186, 153, 251, 172, 169, 170, 169, 187, 153, 8, 33, 86, 51, 51, 20, 1, 170, 218, 189, 219, 188, 187, 187, 189, 204, 171, 170, 154, 40, 67, 83, 52, 51, 54, 51, 52, 51, 51, 18, 17, 8, 217, 207, 186, 188, 188, 187, 188, 186, 202, 154, 128, 153, 48, 52, 53, 54, 67, 51, 67, 34, 17, 34, 129, 152, 171, 203, 188, 219, 188, 172, 203, 170, 16, 136, 66, 19, 66, 52, 67, 35, 36, 18, 52, 144, 49, 129, 168, 190, 202, 189, 8, 153, 50, 160, 64, 17, 54, 50, 71, 17, 98, 35, 17, 67, 2, 155, 65, 145, 25, 147, 223, 138, 168, 173, 8, 169, 171, 16, 129, 153, 98, 19, 115, 38, 16, 50, 4, 137, 66, 18, 40, 18, 219, 155, 201, 155, 1, 251, 139, 169, 171, 9, 16, 1, 56, 55, 34, 51, 1, 66, 17, 85, 130, 202, 202, 155, 153, 204, 153, 185, 190, 169, 136, 33, 32, 68, 17, 66, 2, 97, 4, 24, 34, 186, 153, 236, 154, 186, 190, 171, 185, 205, 139, 169, 156, 129, 154, 50, 161, 48, 71, 35, 82, 52, 17, 34, 136, 136, 137, 177, 174, 216, 173, 186, 189, 203, 188, 171, 187, 137, 136, 169, 64, 216, 42, 37, 81, 52, 18, 50, 54, 1, 50, 131, 202, 9, 128, 155, 83, 184, 220, 189, 153, 187, 153, 25, 19, 56, 6, 171, 19, 187, 87, 0, 82, 18, 129, 169, 235, 206, 204, 204, 171, 139, 40, 50, 52, 18, 67, 53, 53, 70, 35, 51, 51, 34, 17, 17, 128, 153, 218, 188, 235, 188, 188, 187, 189, 186, 186, 171, 169, 137, 66, 51, 83, 52, 18, 66, 68, 34, 51, 1, 8, 169, 203, 204, 154, 203, 172, 185, 138, 136, 9, 8, 56, 54, 67, 53, 51, 35, 34, 160, 189, 204, 205, 187, 172, 171, 187, 186, 170, 171, 138, 81, 54, 53, 68, 51, 51, 51, 36, 2, 1, 144, 203, 203, 190, 186, 205, 203, 186, 170, 170, 170, 9, 136, 48, 84, 50, 83, 51, 52, 68, 34, 33, 34, 129, 154, 168, 188, 186, 205, 152, 186, 10, 144, 10, 130, 48, 38, 83, 68, 34, 35, 128, 9, 160, 189, 186, 191, 154, 188, 138, 144, 25, 160, 59, 119, 33, 84, 51, 51, 51, 49, 52, 33, 18, 66, 131, 171, 168, 221, 203, 203, 155, 170, 188, 137, 168, 138, 33, 85, 18, 82, 52, 51, 36, 34, 67, 129, 169, 187, 172, 187, 188, 56, 21, 170, 98, 3, 0, 114, 37, 33, 67, 1, 0, 169, 154, 144, 236, 188, 187, 204, 187, 170, 171, 170, 187, 9, 17, 97, 68, 51, 83, 50, 52, 51, 51, 20, 50, 36, 168, 171, 186, 222, 172, 137, 217, 171, 201, 203, 153, 154, 153, 171, 153, 24, 176, 159, 17, 152, 152, 207, 32, 145, 26, 52, 33, 84, 67, 35, 17, 18, 49, 4, 153, 160, 206, 187, 206, 172, 154, 202, 255, 247, 46, 0, 187, 171, 172, 202, 155, 17, 152, 0, 137, 53, 18, 117, 34, 33, 35, 19, 80, 37, 153, 115, 132, 136, 152, 187, 203, 187, 171, 17, 201, 141, 50, 217, 137, 136, 49, 35, 85, 67, 52, 145, 170, 10, 50, 146, 153, 171, 201, 239, 203, 204, 204, 189, 171, 25, 32, 114, 68, 18, 34, 51, 68, 67, 51, 51, 51, 17, 8, 153, 202, 205, 219, 203, 202, 171, 171, 187, 171, 171, 136, 169, 64, 66, 84, 35, 50, 67, 18, 152, 137, 8, 1, 200, 172, 202, 187, 219, 155, 9, 33, 68, 83, 36, 33, 35, 144, 152, 170, 154, 251, 175, 187, 189, 188, 203, 187, 186, 170, 8, 48, 69, 66, 83, 50, 83, 51, 51, 20, 33, 130, 152, 200, 204, 203, 204, 170, 186, 187, 187, 187, 154, 153, 25, 2, 81, 68, 34, 67, 35, 18, 67, 129, 40, 52, 52, 161, 156, 32, 18, 18, 33, 101, 67, 67, 19, 1, 185, 155, 233, 187, 235, 204, 186, 173, 154, 170, 169, 137, 50, 35, 84, 68, 83, 67, 34, 50, 51, 36, 51, 36, 0, 65, 144, 203, 203, 154, 202, 26, 19, 169, 137, 169, 144, 174, 17, 190, 32, 128, 115, 146, 26, 38, 8, 52, 8, 85, 129, 99, 2, 8, 144, 138, 128, 156, 0, 203, 16, 0, 103, 18, 99, 35, 153, 8, 33, 38, 160, 8, 168, 172, 235, 172, 170, 170, 16, 152, 152, 138, 51, 0, 116, 83, 51, 2, 33, 18, 8, 185, 189, 185, 174, 154, 188, 153, 9, 51, 128, 102, 130, 154, 144, 57, 55, 136, 144, 205, 188, 172, 171, 171, 186, 171, 185, 220, 170, 153, 24, 68, 67, 68, 18, 51, 53, 18, 32, 51, 35, 1, 200, 188, 136, 202, 221, 189, 153, 169, 203, 170, 153, 0, 186, 64, 130, 65, 201, 80, 146, 8, 17, 192, 172, 216, 207, 9, 144, 32, 20, 8, 50, 66, 36, 50, 18, 153, 170, 56, 71, 152, 16, 2, 144, 236, 205, 9, 234, 10, 130, 9, 67, 200, 155, 33, 67, 69, 129, 24, 34, 144, 253, 204, 203, 187, 171, 10, 50, 67, 53, 50, 69, 52, 67, 51, 51, 52, 51, 35, 19, 0, 168, 205, 219, 203, 171, 188, 154, 169, 154, 186, 187, 189, 171, 8, 16, 1, 128, 153, 202, 155, 186, 173, 168, 156, 117, 51, 83, 35, 82, 34, 18, 18, 0, 0, 168, 152, 236, 219, 235, 187, 188, 188, 154, 170, 137, 169, 56, 34, 66, 2, 48, 4, 24, 37, 34, 53, 2, 16, 161, 155, 168, 28, 55, 17, 67, 33, 68, 160, 153, 253, 172, 202, 187, 218, 172, 153, 171, 154, 171, 9, 33, 68, 54, 52, 68, 50, 34, 34, 34, 1, 0, 160, 137, 208, 156, 201, 172, 152, 219, 9, 152, 16, 177, 27, 131, 171, 251, 172, 169, 158, 136, 170, 66, 1, 86, 2, 82, 36, 65, 36, 33, 52, 17, 2, 152, 0, 204, 187, 188, 138, 201, 155, 152, 190, 24, 247, 244, 45, 0, 128, 10, 128, 24, 19, 24, 87, 0, 49, 176, 113, 20, 33, 35, 115, 18, 64, 34, 33, 19, 138, 1, 205, 138, 153, 201, 223, 137, 152, 204, 156, 24, 33, 53, 51, 66, 34, 1, 50, 35, 83, 131, 137, 129, 219, 138, 205, 138, 185, 188, 172, 172, 154, 17, 33, 35, 1, 36, 152, 16, 136, 116, 35, 65, 130, 154, 216, 156, 49, 49, 18, 186, 139, 1, 205, 25, 176, 191, 251, 204, 169, 154, 8, 152, 152, 188, 24, 217, 9, 17, 49, 35, 68, 36, 49, 34, 1, 81, 5, 204, 202, 188, 16, 16, 19, 17, 71, 161, 156, 168, 172, 136, 188, 154, 220, 171, 152, 8, 200, 10, 21, 170, 33, 136, 116, 17, 82, 3, 16, 129, 170, 0, 137, 82, 161, 24, 250, 159, 168, 172, 128, 152, 32, 232, 26, 52, 83, 35, 32, 35, 34, 248, 10, 2, 188, 48, 250, 140, 152, 9, 128, 42, 87, 18, 33, 35, 24, 34, 152, 128, 144, 202, 154, 217, 174, 48, 4, 8, 18, 115, 4, 252, 188, 188, 187, 186, 155, 82, 51, 83, 83, 67, 35, 51, 35, 51, 51, 34, 34, 16, 168, 237, 203, 188, 171, 203, 154, 8, 16, 50, 3, 219, 202, 190, 171, 202, 154, 169, 187, 187, 10, 1, 9, 18, 115, 71, 50, 68, 51, 51, 2, 24, 129, 190, 171, 189, 171, 170, 0, 129, 136, 184, 170, 189, 187, 171, 185, 175, 152, 172, 170, 207, 171, 186, 8, 33, 117, 51, 67, 20, 49, 36, 0, 0, 202, 187, 188, 220, 186, 154, 203, 171, 152, 138, 16, 17, 17, 84, 51, 35, 152, 201, 174, 169, 188, 25, 3, 48, 71, 34, 98, 52, 34, 66, 51, 51, 19, 184, 172, 219, 206, 186, 154, 186, 188, 9, 168, 56, 20, 48, 67, 67, 35, 34, 17, 65, 146, 188, 16, 18, 49, 66, 71, 52, 37, 36, 20, 33, 0, 8, 160, 188, 170, 220, 187, 219, 170, 170, 187, 25, 65, 66, 84, 36, 50, 53, 17, 33, 145, 154, 152, 206, 170, 219, 170, 137, 169, 138, 114, 36, 33, 69, 52, 52, 129, 153, 137, 185, 189, 138, 0, 169, 24, 51, 69, 35, 34, 34, 36, 160, 9, 250, 173, 203, 203, 186, 204, 170, 9, 1, 8, 100, 36, 18, 16, 32, 129, 136, 152, 156, 128, 189, 56, 200, 41, 162, 43, 3, 121, 39, 8, 67, 145, 33, 217, 172, 235, 188, 171, 186, 138, 24, 1, 17, 66, 68, 1, 83, 130, 24, 130, 172, 0, 172, 128, 205, 153, 204, 25, 169, 64, 3, 65, 4, 154, 2, 221, 155, 0, 186, 138, 200, 191, 154, 169, 171, 48, 34, 115, 52, 50, 68, 50, 20, 144, 137, 250, 173, 152, 187, 49, 146, 64, 21, 169, 8, 136, 33, 50, 55, 130, 153, 186, 204, 188, 188, 25, 4, 154, 65, 67, 51, 102, 37, 0, 34, 168, 9, 184, 26, 20, 152, 201, 187, 202, 189, 10, 66, 19, 32, 85, 1, 131, 13, 50, 0, 34, 176, 156, 201, 207, 189, 204, 171, 171, 137, 82, 52, 53, 52, 51, 50, 34, 33, 16, 160, 203, 137, 169, 138, 186, 32, 232, 11, 145, 156, 129, 9, 34, 218, 205, 220, 205, 187, 172, 187, 153, 137, 33, 67, 52, 53, 51, 33, 34, 129, 138, 169, 188, 169, 189, 9, 136, 9, 128, 65, 53, 100, 51, 35, 19, 184, 222, 203, 204, 187, 203, 154, 153, 32, 35, 66, 52, 51, 36, 34, 19, 128, 169, 188, 172, 205, 154, 170, 154, 186, 25, 67, 99, 36, 34, 36, 130, 186, 221, 219, 203, 171, 171, 154, 24, 49, 54, 50, 69, 51, 50, 18, 34, 128, 9, 1, 202, 9, 162, 156, 34, 128, 136, 24, 51, 102, 20, 185, 219, 204, 204, 219, 153, 169, 138, 0, 17, 68, 67, 51, 52, 34, 51, 18, 16, 144, 48, 53, 67, 53, 51, 18, 16, 35, 153, 52, 201, 114, 129, 9, 168, 138, 218, 203, 26, 146, 142, 128, 172, 37, 237, 25, 131, 170, 10, 17, 8, 34, 32, 55, 184, 113, 23, 136, 50, 4, 16, 49, 50, 67, 130, 0, 1, 250, 156, 0, 170, 128, 204, 152, 220, 137, 219, 9, 160, 25, 162, 13, 67, 169, 56, 53, 2, 67, 2, 16, 130, 171, 170, 138, 168, 189, 201, 221, 170, 32, 68, 52, 35, 33, 145, 171, 152, 25, 248, 191, 185, 187, 207, 154, 154, 154, 24, 51, 36, 68, 52, 1, 49, 131, 49, 241, 159, 152, 172, 16, 169, 80, 130, 40, 131, 138, 146, 175, 17, 138, 192, 207, 153, 154, 24, 51, 137, 115, 168, 56, 4, 136, 48, 54, 208, 10, 160, 140, 34, 16, 68, 129, 24, 178, 223, 153, 187, 25, 4, 56, 55, 0, 33, 129, 33, 52, 145, 154, 185, 239, 169, 153, 40, 34, 34, 145, 237, 205, 203, 203, 138, 24, 66, 83, 51, 36, 33, 34, 2, 8, 8, 144, 137, 49, 53, 84, 36, 34, 34, 152, 136, 202, 154, 170, 17, 234, 139, 252, 204, 170, 186, 170, 136, 24, 17, 16, 52, 130, 153, 184, 207, 170, 204, 138, 144, 41, 69, 49, 53, 18, 50, 161, 42, 162, 141, 145, 173, 136, 220, 137, 185, 137, 152, 64, 35, 24, 38, 200, 155, 202, 173, 186, 187, 8, 8, 82, 53, 67, 35, 2, 129, 233, 204, 186, 204, 154, 170, 138, 0, 17, 18, 137, 16, 153, 64, 145, 81, 130, 186, 153, 236, 171, 98, 52, 67, 50, 71, 34, 32, 33, 16, 129, 169, 185, 191, 186, 155, 8, 66, 20, 17, 201, 156, 218, 156, 169, 171, 17, 218, 138, 128, 154, 83, 36, 69, 36, 67, 19, 17, 82, 34, 34, 1, 16, 3, 204, 40, 52, 67, 35, 82, 3, 188, 136, 201, 9, 184, 191, 136, 188, 41, 161, 26, 128, 114, 20, 16, 50, 145, 186, 10, 50, 67, 209, 43, 195, 175, 152, 155, 168, 122, 119, 35, 49, 18, 8, 1, 219, 25, 145, 139, 128, 169, 48, 83, 36, 170, 31, 43, 0, 34, 16, 34, 250, 191, 170, 187, 154, 137, 0, 136, 186, 172, 188, 41, 39, 33, 145, 136, 146, 171, 0, 89, 87, 128, 40, 144, 41, 37, 33, 37, 144, 0, 233, 172, 203, 172, 169, 187, 152, 203, 8, 168, 80, 2, 84, 146, 219, 170, 202, 138, 169, 113, 131, 9, 51, 0, 67, 34, 85, 146, 137, 161, 157, 218, 173, 137, 168, 235, 187, 187, 156, 40, 18, 98, 52, 35, 129, 16, 160, 174, 8, 176, 191, 137, 168, 41, 53, 84, 38, 1, 16, 128, 186, 171, 235, 10, 1, 171, 144, 190, 114, 130, 40, 38, 1, 32, 129, 169, 136, 152, 186, 252, 139, 67, 144, 88, 51, 67, 2, 80, 130, 155, 168, 190, 204, 10, 2, 169, 128, 138, 176, 255, 156, 169, 169, 24, 100, 35, 67, 51, 17, 128, 152, 201, 187, 155, 169, 80, 55, 67, 52, 33, 18, 136, 186, 204, 202, 187, 154, 153, 128, 136, 136, 154, 169, 25, 131, 155, 216, 191, 169, 206, 171, 189, 171, 187, 25, 2, 115, 53, 34, 66, 51, 146, 172, 185, 207, 153, 152, 24, 33, 51, 36, 67, 35, 144, 152, 236, 171, 169, 190, 137, 169, 155, 34, 17, 83, 51, 35, 50, 35, 2, 218, 236, 204, 186, 189, 170, 153, 153, 49, 55, 50, 52, 129, 153, 220, 171, 186, 188, 169, 25, 18, 81, 85, 34, 18, 51, 131, 154, 137, 154, 168, 25, 69, 51, 51, 35, 17, 2, 98, 20, 0, 145, 156, 236, 188, 170, 171, 187, 155, 24, 168, 72, 37, 82, 51, 33, 67, 129, 186, 8, 82, 69, 85, 37, 18, 17, 32, 34, 2, 65, 37, 18, 17, 33, 177, 142, 50, 202, 10, 176, 173, 204, 156, 33, 168, 24, 1, 160, 239, 32, 192, 139, 83, 34, 128, 82, 4, 152, 137, 24, 129, 40, 34, 114, 147, 12, 38, 169, 16, 160, 186, 220, 139, 145, 158, 65, 129, 16, 50, 1, 200, 191, 9, 200, 11, 19, 153, 48, 18, 68, 18, 99, 131, 40, 178, 159, 168, 172, 152, 187, 24, 128, 169, 9, 67, 161, 43, 71, 152, 152, 222, 171, 169, 203, 25, 161, 27, 83, 19, 154, 71, 161, 64, 3, 153, 169, 170, 201, 158, 66, 176, 140, 1, 202, 25, 36, 83, 162, 174, 153, 234, 188, 26, 34, 185, 104, 5, 169, 1, 152, 48, 146, 188, 137, 52, 168, 115, 55, 16, 51, 18, 152, 160, 206, 26, 184, 25, 51, 67, 176, 11, 161, 159, 17, 144, 234, 170, 201, 156, 51, 169, 16, 253, 154, 251, 171, 171, 24, 83, 85, 67, 67, 2, 1, 144, 170, 170, 203, 137, 136, 83, 68, 67, 51, 18, 2, 168, 204, 204, 187, 188, 138, 153, 16, 3, 16, 2, 169, 186, 203, 219, 205, 169, 202, 187, 170, 155, 137, 48, 69, 35, 83, 19, 49, 51, 1, 145, 237, 187, 187, 154, 64, 70, 51, 52, 51, 2, 153, 218, 188, 204, 170, 186, 154, 137, 32, 35, 84, 35, 218, 245, 46, 0, 17, 144, 186, 235, 189, 152, 219, 154, 153, 169, 170, 33, 16, 101, 18, 82, 130, 152, 200, 191, 171, 169, 153, 137, 84, 35, 65, 69, 2, 16, 1, 136, 218, 187, 9, 137, 88, 68, 51, 36, 16, 18, 218, 139, 128, 156, 136, 9, 19, 204, 65, 200, 9, 176, 9, 177, 142, 1, 153, 128, 57, 39, 185, 114, 129, 137, 17, 85, 2, 33, 4, 32, 19, 9, 53, 18, 99, 35, 34, 176, 155, 169, 173, 136, 185, 191, 32, 184, 171, 114, 5, 136, 18, 16, 2, 204, 171, 0, 217, 88, 38, 8, 33, 129, 83, 146, 16, 145, 189, 172, 153, 170, 65, 18, 85, 18, 50, 131, 186, 203, 172, 137, 0, 169, 57, 164, 174, 40, 83, 2, 32, 176, 187, 219, 187, 204, 138, 67, 34, 128, 184, 139, 162, 223, 65, 2, 153, 236, 172, 202, 156, 8, 8, 51, 177, 43, 37, 0, 69, 19, 34, 145, 10, 201, 173, 137, 129, 26, 55, 0, 51, 184, 235, 205, 170, 203, 218, 205, 41, 161, 155, 83, 176, 58, 147, 13, 54, 176, 56, 145, 140, 82, 19, 66, 3, 137, 162, 255, 138, 144, 136, 49, 51, 51, 19, 24, 35, 221, 25, 202, 172, 219, 10, 168, 40, 35, 82, 146, 189, 235, 189, 171, 8, 81, 68, 67, 51, 35, 17, 144, 153, 202, 171, 137, 41, 86, 34, 69, 34, 33, 17, 185, 187, 222, 170, 170, 136, 8, 33, 3, 128, 144, 188, 219, 173, 170, 204, 137, 185, 156, 152, 155, 136, 136, 66, 0, 64, 130, 57, 52, 16, 160, 158, 217, 156, 17, 32, 87, 51, 51, 37, 1, 152, 186, 206, 171, 169, 170, 0, 16, 82, 36, 18, 34, 184, 171, 255, 170, 184, 186, 153, 137, 136, 0, 17, 16, 145, 11, 37, 237, 24, 168, 203, 206, 10, 136, 24, 66, 67, 36, 33, 53, 16, 16, 169, 49, 250, 12, 129, 25, 37, 82, 67, 18, 18, 128, 185, 204, 187, 171, 9, 168, 72, 132, 138, 68, 0, 8, 136, 160, 238, 170, 170, 154, 1, 137, 87, 18, 48, 35, 33, 0, 32, 35, 128, 176, 29, 39, 136, 86, 50, 52, 128, 115, 146, 187, 32, 169, 11, 16, 49, 161, 155, 144, 187, 170, 64, 248, 143, 152, 172, 201, 155, 52, 176, 72, 38, 184, 26, 36, 153, 49, 19, 17, 161, 158, 67, 161, 41, 70, 1, 16, 17, 146, 203, 113, 18, 48, 37, 136, 153, 203, 172, 9, 200, 11, 18, 203, 8, 16, 184, 141, 37, 233, 155, 219, 188, 203, 137, 8, 65, 17, 99, 35, 16, 99, 18, 129, 0, 129, 251, 172, 154, 186, 172, 0, 33, 33, 84, 51, 55, 129, 32, 160, 206, 171, 186, 204, 9, 16, 49, 52, 50, 51, 2, 200, 205, 219, 203, 169, 170, 153, 16, 17, 83, 52, 36, 1, 50, 129, 171, 168, 191, 186, 172, 97, 161, 88, 21, 50, 131, 89, 21, 153, 186, 157, 136, 204, 25, 129, 25, 2, 228, 252, 45, 0, 48, 39, 32, 51, 153, 176, 191, 17, 234, 10, 160, 188, 235, 188, 172, 137, 40, 101, 51, 68, 50, 2, 137, 184, 204, 187, 171, 154, 16, 115, 68, 35, 67, 34, 128, 168, 203, 220, 186, 202, 137, 0, 17, 83, 34, 1, 50, 144, 171, 188, 220, 188, 170, 171, 153, 24, 1, 99, 35, 34, 2, 17, 202, 9, 218, 170, 251, 155, 154, 24, 66, 70, 51, 51, 36, 16, 152, 219, 172, 203, 172, 153, 8, 16, 66, 68, 35, 18, 130, 218, 235, 187, 203, 170, 153, 8, 34, 16, 67, 17, 18, 218, 24, 200, 172, 187, 204, 189, 153, 136, 49, 37, 83, 36, 50, 17, 82, 145, 170, 153, 203, 189, 25, 35, 66, 101, 50, 50, 1, 8, 201, 204, 171, 169, 154, 8, 16, 49, 68, 50, 51, 2, 152, 205, 203, 171, 219, 139, 34, 67, 70, 34, 83, 18, 1, 33, 18, 185, 25, 18, 171, 72, 87, 67, 50, 67, 51, 129, 25, 145, 153, 236, 10, 128, 152, 154, 68, 129, 9, 18, 184, 204, 186, 170, 207, 186, 174, 8, 203, 25, 51, 50, 69, 52, 34, 128, 8, 67, 217, 10, 34, 17, 136, 115, 19, 48, 35, 24, 147, 223, 136, 153, 202, 9, 129, 155, 152, 219, 235, 170, 202, 157, 129, 169, 137, 153, 160, 173, 33, 184, 97, 144, 9, 200, 171, 8, 84, 1, 64, 3, 128, 217, 43, 38, 168, 80, 2, 8, 18, 168, 205, 188, 189, 186, 171, 32, 168, 116, 23, 0, 34, 129, 185, 174, 184, 157, 128, 10, 39, 152, 0, 128, 152, 155, 1, 223, 25, 200, 28, 21, 152, 49, 19, 201, 153, 250, 154, 136, 136, 56, 55, 16, 83, 130, 185, 169, 153, 154, 41, 55, 2, 83, 18, 18, 17, 0, 218, 205, 187, 9, 128, 25, 71, 1, 8, 34, 146, 191, 152, 186, 155, 24, 33, 83, 163, 191, 128, 238, 170, 152, 9, 34, 85, 52, 51, 35, 2, 128, 201, 204, 186, 170, 138, 82, 66, 69, 34, 35, 17, 128, 204, 186, 205, 154, 170, 8, 17, 50, 51, 50, 2, 201, 188, 189, 189, 172, 170, 154, 153, 8, 34, 17, 33, 34, 202, 155, 201, 139, 2, 24, 37, 49, 226, 27, 5, 24, 52, 115, 19, 66, 20, 17, 2, 170, 153, 205, 203, 172, 153, 138, 50, 68, 53, 34, 34, 184, 186, 207, 172, 202, 171, 155, 8, 136, 65, 52, 34, 33, 145, 186, 223, 203, 202, 154, 136, 64, 50, 82, 51, 66, 35, 33, 131, 9, 160, 174, 137, 137, 49, 84, 55, 18, 52, 129, 16, 200, 138, 186, 153, 170, 48, 184, 11, 37, 168, 155, 136, 252, 187, 153, 201, 172, 16, 51, 18, 70, 129, 49, 176, 25, 115, 21, 81, 36, 8, 18, 24, 19, 9, 55, 0, 50, 136, 83, 160, 24, 131, 187, 236, 11, 176, 191, 51, 184, 80, 34, 68, 161, 9, 192, 173, 160, 174, 24, 153, 48, 36, 52, 2, 83, 146, 8, 242, 10, 37, 0, 200, 9, 216, 10, 1, 16, 53, 18, 67, 2, 8, 37, 169, 16, 202, 8, 26, 71, 185, 56, 224, 57, 162, 43, 132, 171, 17, 153, 185, 43, 224, 9, 253, 26, 218, 155, 203, 8, 0, 51, 0, 84, 177, 191, 8, 202, 138, 136, 48, 130, 82, 36, 17, 0, 64, 5, 220, 138, 168, 170, 41, 71, 18, 33, 130, 187, 235, 157, 128, 203, 65, 200, 27, 4, 137, 67, 144, 9, 160, 205, 171, 186, 140, 1, 153, 66, 19, 168, 112, 162, 27, 147, 60, 7, 191, 33, 185, 41, 19, 40, 71, 129, 40, 19, 186, 40, 200, 42, 38, 217, 72, 130, 154, 50, 176, 155, 251, 207, 170, 203, 187, 8, 17, 52, 85, 51, 35, 50, 129, 168, 219, 203, 188, 154, 136, 65, 54, 67, 52, 51, 50, 2, 169, 203, 204, 188, 170, 152, 137, 48, 35, 114, 35, 17, 3, 218, 185, 205, 187, 204, 170, 169, 9, 0, 40, 50, 144, 33, 160, 104, 146, 42, 163, 159, 136, 188, 8, 168, 185, 10, 37, 144, 116, 38, 34, 52, 3, 1, 217, 172, 235, 171, 153, 137, 34, 52, 69, 50, 36, 1, 136, 219, 204, 172, 187, 187, 153, 0, 52, 37, 51, 34, 128, 220, 187, 234, 172, 152, 153, 16, 16, 68, 50, 51, 51, 19, 138, 35, 250, 9, 17, 51, 49, 55, 50, 20, 138, 66, 217, 10, 19, 169, 32, 21, 184, 56, 5, 219, 136, 219, 203, 187, 152, 139, 67, 50, 87, 17, 32, 3, 186, 10, 160, 157, 98, 19, 33, 67, 128, 68, 130, 48, 21, 129, 152, 136, 185, 41, 192, 104, 162, 11, 145, 172, 137, 99, 176, 113, 7, 0, 129, 136, 217, 10, 176, 156, 17, 186, 25, 52, 128, 115, 130, 153, 168, 219, 173, 138, 201, 25, 51, 34, 83, 35, 146, 158, 16, 234, 137, 160, 10, 35, 137, 103, 2, 24, 34, 153, 154, 153, 169, 42, 87, 1, 82, 1, 8, 160, 157, 169, 205, 170, 171, 9, 169, 41, 54, 128, 16, 146, 202, 169, 172, 25, 35, 16, 86, 2, 8, 128, 170, 98, 161, 26, 146, 142, 83, 17, 67, 1, 3, 223, 137, 219, 138, 136, 8, 81, 20, 32, 36, 152, 136, 202, 152, 205, 153, 235, 138, 169, 26, 54, 146, 97, 3, 170, 32, 176, 157, 130, 205, 48, 192, 73, 21, 8, 33, 128, 171, 137, 185, 153, 140, 103, 145, 56, 20, 0, 152, 144, 223, 171, 204, 187, 170, 10, 49, 69, 52, 53, 35, 50, 130, 152, 218, 188, 203, 186, 170, 32, 67, 54, 68, 51, 35, 35, 128, 185, 205, 203, 188, 170, 170, 137, 48, 53, 66, 52, 34, 18, 169, 186, 207, 172, 187, 187, 171, 9, 0, 66, 69, 18, 34, 34, 152, 169, 204, 188, 186, 203, 8, 128, 66, 51, 36, 18, 67, 128, 32, 128, 66, 160, 57, 210, 140, 234, 155, 186, 154, 139, 99, 128, 100, 19, 34, 129, 8, 253, 171, 203, 188, 171, 247, 226, 48, 0, 9, 9, 82, 35, 52, 18, 17, 218, 169, 221, 154, 202, 137, 8, 17, 99, 52, 50, 36, 17, 18, 171, 128, 173, 128, 24, 21, 64, 21, 24, 20, 153, 1, 169, 203, 9, 192, 44, 3, 113, 131, 32, 131, 170, 207, 137, 218, 138, 129, 48, 35, 84, 18, 35, 153, 49, 236, 40, 176, 40, 18, 66, 52, 38, 16, 38, 169, 40, 200, 137, 8, 49, 32, 55, 1, 50, 219, 136, 204, 170, 172, 2, 154, 55, 17, 84, 1, 16, 128, 201, 173, 168, 189, 8, 152, 32, 50, 36, 17, 51, 168, 153, 205, 186, 205, 9, 137, 33, 35, 68, 17, 34, 168, 128, 206, 9, 169, 137, 34, 145, 156, 34, 203, 49, 169, 99, 216, 10, 52, 1, 99, 18, 33, 234, 139, 168, 221, 9, 144, 9, 2, 40, 132, 173, 34, 216, 42, 19, 153, 83, 200, 113, 129, 88, 130, 16, 168, 137, 185, 138, 153, 168, 190, 235, 156, 144, 175, 49, 176, 73, 4, 10, 2, 186, 65, 216, 26, 131, 154, 49, 2, 112, 132, 25, 208, 159, 153, 172, 0, 50, 83, 51, 35, 2, 185, 189, 172, 204, 155, 136, 8, 99, 69, 34, 67, 35, 0, 160, 204, 188, 172, 172, 9, 169, 48, 4, 136, 35, 250, 158, 186, 189, 154, 152, 72, 52, 82, 52, 35, 35, 18, 144, 138, 217, 156, 8, 152, 82, 68, 51, 68, 35, 50, 145, 137, 233, 172, 170, 171, 186, 8, 129, 48, 21, 49, 162, 172, 250, 189, 203, 187, 202, 154, 129, 40, 147, 64, 179, 157, 168, 188, 187, 156, 144, 10, 52, 84, 35, 83, 19, 136, 201, 171, 219, 154, 32, 67, 53, 52, 52, 144, 32, 232, 155, 152, 188, 9, 145, 56, 55, 32, 52, 152, 153, 237, 203, 186, 171, 156, 0, 16, 66, 18, 18, 160, 202, 189, 204, 172, 153, 154, 48, 51, 55, 51, 53, 2, 17, 144, 136, 202, 9, 129, 81, 52, 55, 18, 68, 129, 16, 152, 138, 186, 138, 187, 57, 145, 116, 19, 50, 129, 0, 250, 187, 236, 155, 169, 170, 64, 4, 48, 39, 136, 17, 144, 128, 168, 136, 170, 137, 34, 36, 115, 53, 16, 35, 152, 1, 204, 48, 130, 114, 21, 32, 35, 152, 0, 202, 172, 203, 219, 154, 153, 88, 37, 65, 37, 128, 2, 218, 169, 235, 171, 170, 153, 25, 69, 35, 53, 36, 2, 32, 145, 188, 185, 190, 154, 169, 25, 35, 50, 71, 35, 34, 19, 1, 168, 204, 187, 189, 170, 170, 27, 130, 41, 39, 152, 66, 146, 10, 37, 186, 97, 145, 56, 4, 170, 201, 205, 187, 137, 137, 50, 33, 70, 34, 67, 129, 16, 233, 188, 186, 206, 155, 169, 155, 81, 35, 69, 18, 49, 145, 172, 136, 203, 138, 128, 154, 33, 8, 87, 18, 66, 18, 1, 235, 154, 202, 187, 26, 129, 40, 148, 157, 160, 223, 9, 170, 138, 16, 144, 113, 7, 16, 35, 128, 152, 186, 220, 171, 170, 155, 133, 243, 43, 0, 33, 67, 85, 67, 33, 51, 129, 16, 200, 172, 202, 189, 9, 218, 57, 131, 140, 33, 251, 139, 185, 173, 137, 169, 48, 20, 82, 52, 18, 51, 18, 168, 152, 204, 156, 137, 16, 68, 68, 83, 51, 50, 51, 2, 24, 184, 188, 204, 171, 202, 11, 128, 81, 19, 99, 20, 16, 145, 154, 251, 172, 202, 187, 171, 153, 154, 65, 2, 97, 3, 40, 162, 189, 201, 173, 171, 155, 153, 40, 68, 50, 84, 51, 17, 52, 168, 24, 234, 138, 201, 171, 128, 136, 82, 67, 50, 38, 2, 50, 128, 24, 234, 171, 219, 188, 203, 171, 187, 171, 136, 9, 34, 152, 136, 235, 188, 174, 186, 175, 152, 204, 137, 168, 10, 0, 16, 67, 20, 49, 55, 1, 68, 51, 51, 66, 36, 137, 1, 203, 9, 219, 137, 0, 0, 115, 37, 49, 52, 50, 18, 169, 187, 223, 187, 185, 173, 0, 169, 97, 145, 72, 20, 136, 35, 145, 41, 162, 157, 130, 174, 9, 153, 24, 34, 99, 36, 18, 68, 19, 82, 3, 24, 131, 187, 152, 202, 188, 137, 192, 74, 23, 17, 36, 16, 51, 144, 33, 144, 185, 223, 169, 186, 170, 10, 36, 16, 83, 36, 3, 138, 38, 217, 40, 163, 139, 145, 174, 136, 218, 41, 5, 154, 68, 160, 88, 2, 48, 22, 0, 129, 168, 219, 187, 188, 187, 155, 16, 65, 55, 18, 99, 130, 8, 161, 174, 185, 175, 153, 153, 24, 50, 50, 69, 3, 0, 130, 204, 186, 189, 170, 155, 136, 32, 54, 17, 83, 129, 0, 168, 204, 187, 202, 154, 8, 98, 35, 99, 34, 0, 169, 204, 203, 203, 137, 136, 66, 20, 50, 20, 1, 129, 219, 203, 204, 203, 171, 137, 136, 97, 36, 49, 51, 129, 24, 184, 157, 168, 156, 0, 185, 0, 0, 52, 154, 115, 161, 188, 153, 220, 24, 168, 112, 4, 40, 19, 9, 145, 187, 137, 185, 221, 155, 235, 155, 137, 50, 67, 71, 35, 51, 19, 66, 161, 140, 200, 190, 185, 189, 153, 137, 32, 69, 35, 67, 51, 0, 152, 202, 188, 189, 172, 186, 186, 24, 52, 66, 71, 18, 33, 2, 136, 168, 203, 186, 169, 203, 9, 130, 24, 84, 52, 34, 17, 128, 232, 205, 154, 203, 171, 0, 152, 68, 19, 115, 4, 16, 19, 160, 170, 171, 205, 170, 170, 9, 136, 32, 85, 18, 66, 52, 152, 136, 201, 173, 171, 203, 153, 136, 0, 51, 35, 33, 115, 2, 11, 37, 217, 8, 235, 25, 184, 73, 3, 81, 19, 83, 129, 64, 177, 58, 195, 175, 128, 202, 172, 24, 184, 80, 20, 33, 35, 16, 1, 152, 155, 18, 207, 40, 160, 89, 37, 33, 55, 3, 40, 21, 187, 9, 218, 139, 136, 153, 65, 21, 17, 52, 3, 168, 169, 252, 188, 170, 219, 155, 16, 160, 40, 22, 144, 128, 184, 191, 153, 220, 10, 2, 33, 71, 67, 67, 51, 51, 34, 1, 153, 218, 187, 187, 156, 24, 65, 84, 117, 29, 51, 0, 52, 51, 67, 19, 128, 168, 205, 202, 204, 170, 170, 171, 153, 137, 16, 2, 32, 19, 201, 171, 222, 188, 172, 204, 171, 170, 187, 155, 128, 16, 67, 68, 67, 35, 18, 16, 168, 172, 251, 155, 169, 171, 16, 50, 68, 70, 34, 51, 20, 17, 129, 138, 185, 171, 204, 10, 160, 26, 152, 115, 161, 32, 2, 144, 218, 152, 253, 137, 186, 156, 186, 171, 202, 154, 152, 40, 19, 17, 116, 2, 138, 36, 185, 56, 177, 42, 52, 83, 84, 52, 37, 83, 51, 34, 67, 18, 32, 4, 137, 33, 1, 8, 103, 129, 65, 18, 33, 1, 128, 170, 160, 255, 9, 160, 157, 32, 168, 41, 37, 169, 24, 1, 235, 154, 144, 188, 155, 152, 155, 33, 99, 53, 66, 35, 51, 147, 139, 51, 185, 75, 39, 185, 57, 177, 121, 5, 48, 22, 17, 34, 169, 56, 177, 141, 33, 217, 25, 176, 11, 68, 69, 34, 99, 3, 128, 168, 172, 235, 172, 153, 187, 40, 16, 98, 52, 51, 52, 1, 168, 205, 204, 204, 154, 170, 138, 34, 50, 69, 51, 67, 2, 128, 168, 206, 170, 203, 154, 137, 49, 52, 68, 52, 35, 33, 0, 153, 204, 187, 202, 171, 136, 24, 67, 35, 69, 129, 128, 168, 203, 204, 187, 154, 186, 155, 129, 32, 130, 56, 37, 153, 201, 172, 170, 205, 155, 153, 155, 66, 177, 26, 176, 205, 204, 171, 185, 187, 204, 80, 162, 89, 39, 1, 50, 19, 153, 160, 190, 171, 204, 9, 34, 66, 38, 49, 36, 153, 82, 160, 11, 20, 202, 42, 5, 171, 55, 160, 40, 209, 174, 202, 220, 186, 171, 170, 25, 66, 84, 51, 69, 34, 17, 1, 169, 203, 204, 202, 170, 137, 0, 68, 83, 67, 36, 35, 34, 128, 169, 218, 188, 187, 188, 154, 8, 49, 84, 67, 67, 33, 18, 160, 172, 188, 190, 171, 203, 170, 9, 0, 33, 83, 51, 19, 18, 160, 219, 220, 171, 202, 170, 137, 8, 33, 66, 35, 19, 68, 130, 9, 18, 218, 24, 160, 139, 1, 16, 65, 69, 18, 65, 51, 8, 50, 18, 152, 185, 190, 222, 172, 170, 189, 154, 186, 9, 129, 8, 53, 161, 140, 2, 206, 170, 203, 203, 188, 16, 185, 72, 36, 34, 68, 18, 33, 17, 40, 52, 68, 52, 83, 51, 1, 50, 193, 26, 2, 187, 64, 51, 71, 67, 68, 51, 19, 49, 162, 175, 176, 190, 137, 170, 24, 50, 65, 69, 18, 33, 3, 9, 177, 159, 169, 154, 220, 24, 2, 41, 53, 51, 3, 17, 144, 41, 250, 41, 132, 25, 20, 32, 36, 16, 69, 1, 33, 52, 130, 16, 130, 26, 38, 153, 66, 130, 201, 156, 168, 190, 185, 187, 202, 189, 186, 189, 169, 156, 152, 171, 153, 186, 237, 187, 188, 174, 187, 171, 171, 188, 137, 1, 50, 68, 53, 36, 16, 1, 184, 170, 203, 173, 138, 153, 16, 100, 69, 52, 66, 50, 1, 136, 168, 204, 171, 187, 154, 95, 255, 34, 0, 136, 56, 71, 34, 66, 34, 18, 234, 154, 233, 157, 136, 169, 48, 35, 50, 52, 18, 184, 189, 202, 205, 154, 170, 8, 18, 81, 54, 35, 67, 18, 24, 160, 206, 137, 152, 11, 67, 17, 83, 35, 16, 18, 160, 219, 157, 153, 189, 41, 129, 82, 35, 49, 53, 168, 155, 251, 172, 170, 155, 24, 169, 153, 186, 155, 234, 187, 220, 172, 186, 203, 97, 37, 50, 69, 2, 1, 144, 186, 188, 220, 154, 136, 32, 84, 51, 34, 35, 201, 204, 202, 188, 188, 154, 138, 8, 67, 69, 51, 18, 17, 176, 221, 187, 219, 154, 138, 32, 68, 51, 84, 34, 1, 1, 168, 170, 169, 153, 25, 83, 66, 84, 35, 82, 34, 16, 34, 144, 8, 0, 16, 160, 57, 209, 139, 192, 174, 187, 170, 155, 34, 144, 85, 248, 171, 218, 204, 172, 169, 170, 137, 8, 18, 17, 18, 128, 250, 189, 202, 188, 138, 136, 33, 68, 50, 19, 168, 8, 236, 155, 154, 137, 8, 100, 19, 83, 19, 0, 19, 202, 137, 204, 138, 186, 24, 18, 99, 20, 18, 160, 205, 172, 203, 171, 0, 25, 69, 35, 68, 18, 8, 144, 204, 187, 172, 156, 9, 16, 49, 86, 67, 50, 35, 145, 185, 203, 171, 137, 153, 33, 19, 98, 54, 33, 33, 168, 8, 202, 89, 37, 16, 68, 129, 9, 129, 170, 185, 207, 137, 136, 81, 53, 67, 35, 17, 35, 216, 139, 218, 189, 154, 155, 33, 1, 100, 35, 8, 33, 184, 155, 251, 172, 170, 155, 81, 2, 33, 146, 156, 185, 158, 24, 169, 48, 130, 80, 22, 137, 145, 187, 137, 156, 98, 18, 50, 3, 138, 69, 19, 50, 178, 207, 187, 187, 138, 65, 53, 20, 66, 36, 152, 136, 218, 173, 9, 152, 24, 51, 19, 176, 27, 36, 81, 53, 36, 130, 217, 156, 49, 184, 112, 35, 49, 208, 173, 184, 188, 154, 56, 69, 34, 19, 160, 136, 236, 25, 128, 81, 129, 0, 185, 172, 169, 138, 114, 38, 34, 34, 144, 202, 205, 154, 170, 32, 52, 37, 129, 152, 201, 156, 152, 10, 54, 152, 0, 218, 154, 169, 24, 52, 145, 185, 205, 186, 175, 8, 32, 55, 34, 52, 161, 153, 235, 154, 186, 25, 2, 136, 153, 137, 24, 85, 84, 51, 35, 130, 186, 220, 205, 170, 203, 137, 8, 49, 68, 33, 35, 67, 51, 33, 146, 190, 235, 189, 170, 187, 9, 50, 67, 53, 83, 35, 17, 1, 201, 187, 191, 169, 187, 40, 129, 114, 19, 50, 21, 136, 145, 189, 169, 203, 40, 16, 66, 2, 33, 184, 173, 188, 203, 170, 32, 67, 67, 68, 34, 1, 17, 136, 201, 207, 171, 187, 154, 16, 81, 37, 51, 53, 33, 18, 169, 186, 206, 170, 171, 9, 129, 16, 2, 114, 35, 99, 18, 17, 129, 154, 200, 189, 186, 190, 186, 170, 16, 33, 53, 68, 53, 34, 36, 128, 169, 221, 187, 188, 187, 170, 16, 50, 70, 67, 34, 34, 18, 2, 45, 0, 0, 185, 187, 219, 170, 220, 172, 153, 137, 49, 68, 52, 36, 34, 34, 1, 0, 200, 222, 186, 170, 153, 16, 33, 49, 54, 52, 36, 52, 129, 169, 219, 172, 202, 172, 154, 136, 0, 97, 69, 34, 35, 129, 169, 205, 187, 172, 138, 8, 67, 51, 68, 35, 1, 128, 186, 187, 219, 138, 49, 83, 53, 51, 35, 128, 33, 192, 155, 219, 156, 136, 115, 37, 67, 18, 0, 144, 218, 154, 153, 170, 187, 56, 4, 41, 39, 128, 83, 18, 33, 201, 204, 204, 187, 136, 66, 37, 19, 184, 204, 203, 154, 138, 24, 129, 66, 161, 138, 250, 156, 136, 9, 50, 50, 17, 185, 255, 154, 170, 171, 153, 24, 50, 119, 51, 50, 35, 2, 252, 188, 219, 154, 0, 48, 67, 35, 2, 128, 170, 137, 67, 146, 188, 236, 188, 154, 16, 68, 35, 50, 128, 24, 144, 187, 219, 206, 187, 40, 69, 52, 19, 144, 218, 155, 152, 137, 82, 130, 9, 17, 49, 87, 18, 144, 170, 236, 170, 137, 0, 67, 35, 16, 49, 50, 19, 218, 186, 220, 203, 169, 171, 137, 64, 70, 52, 20, 17, 161, 205, 154, 154, 32, 33, 50, 129, 8, 24, 84, 145, 138, 1, 187, 40, 102, 52, 17, 136, 186, 188, 189, 171, 10, 66, 66, 53, 1, 18, 152, 154, 137, 129, 236, 187, 205, 172, 155, 8, 16, 54, 50, 51, 35, 145, 32, 234, 188, 173, 154, 186, 136, 17, 68, 19, 1, 67, 3, 81, 35, 136, 233, 188, 203, 139, 136, 24, 83, 51, 18, 51, 168, 81, 146, 138, 153, 138, 233, 173, 172, 201, 155, 17, 10, 55, 144, 32, 66, 36, 201, 170, 205, 171, 154, 10, 50, 83, 3, 64, 21, 50, 4, 203, 188, 187, 173, 48, 54, 18, 168, 25, 160, 157, 66, 20, 152, 9, 186, 105, 20, 8, 130, 253, 204, 154, 138, 64, 83, 51, 19, 152, 171, 235, 171, 152, 137, 9, 49, 52, 36, 128, 184, 175, 136, 16, 131, 8, 67, 130, 171, 82, 208, 12, 18, 219, 138, 185, 59, 103, 129, 137, 32, 168, 11, 1, 187, 205, 138, 84, 3, 32, 2, 168, 201, 189, 8, 152, 40, 18, 64, 68, 35, 184, 156, 137, 137, 32, 161, 172, 168, 104, 86, 52, 128, 8, 152, 233, 189, 40, 18, 185, 11, 35, 84, 52, 37, 169, 171, 156, 40, 35, 208, 173, 9, 49, 68, 52, 19, 192, 205, 138, 137, 50, 52, 35, 144, 137, 153, 169, 235, 172, 154, 16, 65, 52, 85, 37, 2, 152, 234, 172, 138, 136, 48, 35, 33, 52, 1, 33, 216, 171, 184, 223, 138, 33, 67, 36, 1, 1, 152, 205, 155, 153, 32, 2, 0, 128, 250, 154, 49, 70, 145, 16, 160, 186, 191, 8, 32, 38, 1, 169, 203, 204, 32, 35, 82, 19, 16, 160, 204, 204, 154, 33, 35, 49, 4, 218, 156, 169, 137, 50, 51, 3, 153, 250, 172, 25, 100, 20, 0, 128, 251, 187, 138, 139, 246, 49, 0, 66, 19, 8, 50, 129, 220, 155, 152, 25, 1, 48, 22, 16, 145, 138, 251, 139, 84, 18, 185, 205, 203, 10, 66, 85, 51, 0, 186, 205, 170, 0, 34, 17, 50, 184, 172, 8, 82, 17, 8, 185, 173, 25, 69, 2, 24, 34, 0, 233, 173, 154, 171, 114, 51, 1, 33, 18, 169, 136, 252, 156, 152, 8, 51, 34, 67, 129, 136, 17, 250, 171, 251, 155, 16, 67, 36, 168, 171, 48, 34, 52, 177, 239, 170, 136, 98, 36, 129, 170, 172, 154, 40, 50, 52, 1, 144, 205, 9, 128, 170, 136, 152, 56, 119, 3, 144, 170, 56, 51, 52, 144, 251, 188, 154, 25, 68, 19, 144, 170, 153, 9, 34, 17, 52, 67, 146, 191, 170, 235, 172, 137, 33, 83, 83, 129, 188, 41, 54, 34, 18, 217, 188, 172, 154, 32, 51, 36, 34, 128, 154, 16, 168, 24, 160, 206, 155, 64, 147, 170, 222, 26, 68, 18, 153, 186, 205, 140, 98, 51, 1, 218, 173, 138, 24, 33, 52, 129, 16, 130, 24, 194, 223, 154, 24, 65, 51, 130, 154, 128, 24, 85, 19, 234, 171, 187, 11, 66, 54, 18, 1, 201, 172, 0, 128, 152, 64, 20, 129, 218, 156, 16, 128, 24, 68, 2, 153, 187, 154, 8, 72, 103, 1, 202, 170, 154, 155, 48, 20, 82, 37, 152, 10, 168, 204, 137, 65, 52, 3, 201, 154, 137, 97, 36, 128, 203, 219, 170, 24, 67, 67, 1, 17, 0, 169, 190, 153, 186, 113, 52, 128, 153, 185, 140, 115, 20, 152, 187, 169, 154, 32, 144, 24, 168, 42, 71, 35, 129, 217, 206, 138, 85, 19, 152, 185, 190, 9, 48, 67, 2, 152, 188, 153, 136, 113, 51, 1, 202, 187, 189, 8, 34, 53, 18, 145, 185, 154, 48, 20, 153, 0, 237, 154, 201, 173, 64, 36, 16, 68, 130, 169, 203, 186, 154, 64, 69, 2, 152, 186, 10, 18, 144, 187, 97, 83, 20, 184, 219, 155, 1, 49, 20, 169, 221, 170, 25, 21, 32, 70, 0, 153, 170, 0, 185, 174, 136, 0, 128, 24, 54, 129, 16, 18, 51, 224, 206, 137, 33, 1, 137, 8, 168, 57, 70, 129, 153, 189, 11, 99, 68, 20, 161, 173, 187, 155, 34, 18, 36, 18, 33, 52, 33, 85, 177, 172, 204, 154, 0, 137, 16, 50, 69, 19, 233, 219, 171, 16, 84, 20, 144, 186, 203, 137, 32, 83, 129, 40, 19, 169, 128, 136, 1, 201, 185, 207, 172, 138, 49, 35, 101, 35, 136, 184, 187, 10, 84, 145, 169, 187, 171, 137, 115, 131, 10, 115, 34, 33, 129, 206, 154, 25, 33, 50, 177, 207, 154, 25, 69, 18, 144, 202, 155, 33, 52, 130, 237, 155, 24, 1, 34, 130, 154, 40, 82, 51, 19, 249, 206, 10, 50, 35, 2, 202, 171, 41, 86, 36, 184, 172, 8, 48, 34, 184, 206, 155, 41, 68, 130, 186, 186, 139, 81, 69, 129, 152, 153, 185, 138, 114, 3, 201, 153, 136, 94, 248, 50, 0, 64, 37, 2, 152, 154, 9, 51, 0, 128, 252, 175, 25, 0, 16, 1, 153, 170, 155, 81, 51, 33, 144, 27, 119, 18, 136, 184, 191, 139, 1, 67, 36, 1, 0, 169, 137, 1, 65, 54, 129, 204, 10, 145, 137, 66, 128, 186, 202, 206, 203, 9, 67, 50, 67, 145, 187, 204, 154, 24, 50, 0, 49, 52, 66, 129, 168, 235, 88, 20, 202, 203, 171, 153, 57, 71, 2, 187, 153, 251, 9, 34, 20, 168, 56, 2, 187, 112, 38, 129, 152, 203, 25, 68, 49, 4, 203, 137, 136, 64, 35, 144, 235, 203, 154, 40, 3, 137, 17, 187, 113, 177, 155, 216, 157, 64, 35, 145, 153, 234, 156, 129, 40, 69, 130, 155, 24, 0, 99, 50, 53, 200, 154, 16, 9, 84, 200, 11, 36, 160, 188, 170, 137, 0, 25, 54, 160, 89, 5, 235, 154, 171, 25, 18, 17, 53, 161, 10, 19, 81, 69, 144, 205, 171, 0, 33, 53, 34, 145, 202, 40, 144, 169, 252, 154, 16, 52, 18, 168, 189, 25, 66, 99, 35, 168, 172, 171, 48, 3, 24, 162, 207, 138, 0, 32, 66, 145, 11, 53, 234, 139, 33, 18, 18, 17, 130, 24, 132, 190, 16, 0, 250, 140, 49, 128, 8, 168, 172, 152, 188, 81, 130, 24, 129, 173, 115, 5, 9, 33, 145, 218, 171, 137, 169, 96, 37, 17, 160, 189, 136, 33, 70, 3, 185, 170, 235, 138, 16, 17, 160, 207, 154, 32, 51, 83, 35, 168, 187, 171, 16, 19, 186, 25, 49, 103, 18, 0, 169, 169, 27, 119, 1, 0, 2, 17, 144, 205, 188, 172, 32, 18, 16, 19, 186, 25, 144, 32, 130, 217, 189, 203, 139, 84, 69, 50, 145, 203, 24, 200, 11, 36, 185, 202, 205, 41, 35, 168, 185, 190, 137, 114, 52, 1, 8, 185, 11, 33, 200, 172, 64, 52, 2, 49, 20, 152, 203, 25, 67, 1, 217, 187, 236, 139, 66, 17, 200, 172, 24, 129, 48, 54, 200, 10, 152, 25, 68, 1, 33, 250, 174, 16, 50, 52, 130, 153, 186, 187, 154, 9, 98, 52, 19, 249, 172, 9, 0, 8, 24, 33, 66, 68, 177, 156, 67, 130, 203, 137, 169, 170, 42, 103, 17, 16, 128, 188, 171, 203, 25, 18, 201, 138, 219, 43, 71, 144, 17, 161, 26, 52, 2, 17, 1, 234, 172, 138, 83, 18, 24, 233, 156, 68, 18, 17, 169, 188, 9, 35, 16, 177, 223, 154, 24, 18, 200, 156, 34, 18, 100, 19, 144, 187, 189, 155, 99, 2, 170, 185, 10, 35, 115, 54, 144, 153, 203, 139, 1, 184, 138, 129, 218, 138, 153, 73, 52, 18, 50, 52, 68, 20, 201, 26, 146, 172, 80, 36, 185, 138, 65, 35, 128, 144, 191, 169, 155, 81, 3, 50, 163, 223, 9, 128, 9, 1, 153, 16, 217, 96, 69, 20, 17, 16, 169, 155, 154, 169, 169, 219, 72, 4, 24, 128, 188, 48, 176, 175, 25, 130, 169, 24, 145, 255, 174, 170, 172, 244, 48, 0, 154, 64, 37, 17, 16, 8, 16, 17, 34, 160, 235, 174, 8, 0, 66, 34, 2, 218, 155, 40, 129, 170, 1, 207, 138, 144, 10, 71, 146, 8, 2, 16, 100, 52, 2, 154, 202, 173, 0, 168, 9, 50, 52, 19, 32, 144, 169, 218, 156, 1, 249, 189, 187, 171, 48, 69, 2, 168, 172, 81, 37, 51, 146, 220, 171, 153, 40, 51, 144, 8, 200, 26, 103, 34, 33, 152, 186, 185, 186, 48, 130, 9, 51, 67, 193, 223, 137, 34, 66, 38, 129, 186, 189, 187, 139, 34, 19, 250, 155, 34, 51, 51, 37, 232, 157, 137, 153, 8, 136, 8, 128, 202, 24, 2, 115, 87, 17, 0, 168, 137, 152, 138, 32, 129, 171, 153, 112, 87, 34, 1, 136, 170, 40, 145, 204, 185, 221, 154, 8, 152, 185, 25, 82, 52, 35, 1, 185, 185, 205, 24, 176, 207, 154, 136, 83, 51, 129, 170, 8, 82, 38, 1, 144, 251, 10, 33, 129, 128, 235, 188, 9, 99, 67, 18, 1, 0, 144, 24, 19, 250, 138, 144, 186, 16, 128, 65, 146, 10, 168, 139, 232, 191, 57, 4, 170, 201, 191, 138, 33, 17, 2, 218, 155, 24, 67, 17, 16, 169, 253, 170, 154, 8, 50, 71, 34, 50, 19, 64, 36, 153, 66, 216, 138, 217, 139, 34, 128, 153, 137, 0, 172, 117, 20, 49, 146, 187, 154, 24, 248, 174, 153, 137, 17, 49, 19, 152, 170, 203, 204, 57, 68, 52, 3, 136, 201, 10, 128, 172, 152, 80, 54, 66, 53, 129, 136, 202, 187, 190, 154, 0, 50, 67, 18, 17, 35, 168, 139, 17, 168, 33, 251, 141, 33, 232, 189, 202, 172, 137, 16, 18, 99, 3, 137, 50, 233, 186, 203, 153, 202, 41, 145, 98, 2, 86, 19, 18, 128, 0, 189, 40, 176, 72, 162, 140, 217, 11, 161, 88, 5, 137, 51, 33, 34, 136, 168, 205, 188, 188, 203, 172, 9, 65, 53, 67, 18, 152, 152, 171, 144, 171, 49, 201, 9, 169, 0, 239, 8, 186, 58, 129, 10, 97, 52, 49, 38, 185, 189, 155, 170, 64, 54, 51, 50, 35, 51, 131, 220, 171, 203, 171, 24, 32, 83, 53, 35, 128, 144, 219, 154, 235, 156, 152, 155, 152, 203, 16, 0, 233, 187, 169, 40, 68, 70, 2, 136, 169, 25, 176, 223, 170, 136, 50, 68, 67, 34, 51, 2, 16, 145, 169, 221, 203, 154, 170, 154, 129, 138, 128, 142, 68, 168, 80, 36, 0, 81, 130, 188, 8, 220, 25, 18, 128, 128, 32, 145, 113, 21, 0, 185, 25, 192, 174, 152, 25, 67, 50, 18, 153, 80, 36, 144, 171, 235, 188, 154, 0, 168, 138, 0, 136, 26, 119, 23, 24, 18, 0, 8, 128, 201, 188, 153, 203, 172, 186, 138, 8, 98, 36, 0, 24, 17, 152, 11, 103, 2, 152, 187, 156, 136, 170, 65, 2, 57, 70, 37, 16, 34, 161, 186, 189, 0, 218, 173, 171, 170, 136, 169, 26, 147, 43, 103, 34, 64, 254, 37, 0, 53, 50, 176, 156, 144, 155, 50, 2, 184, 189, 114, 19, 17, 128, 153, 203, 154, 171, 32, 128, 145, 206, 168, 207, 154, 170, 41, 51, 66, 84, 51, 19, 33, 51, 51, 19, 236, 154, 160, 140, 68, 144, 168, 204, 9, 32, 35, 99, 131, 203, 203, 171, 169, 190, 8, 144, 9, 9, 87, 18, 49, 132, 8, 176, 158, 152, 140, 128, 171, 50, 233, 139, 128, 138, 68, 2, 152, 204, 9, 152, 16, 145, 138, 200, 174, 168, 26, 39, 114, 37, 1, 33, 144, 138, 186, 187, 203, 171, 171, 137, 48, 71, 34, 115, 37, 129, 50, 161, 171, 251, 156, 152, 172, 10, 0, 136, 115, 52, 83, 35, 67, 130, 169, 217, 188, 169, 187, 8, 144, 137, 138, 32, 68, 68, 2, 17, 185, 139, 251, 172, 169, 170, 236, 137, 17, 34, 34, 85, 18, 16, 19, 169, 170, 188, 154, 155, 136, 114, 5, 136, 16, 1, 129, 66, 192, 173, 136, 235, 154, 128, 172, 8, 16, 0, 82, 53, 52, 19, 0, 184, 207, 170, 170, 154, 137, 1, 33, 53, 65, 37, 144, 144, 237, 170, 171, 25, 50, 67, 50, 52, 18, 84, 35, 82, 1, 16, 200, 205, 187, 186, 172, 137, 136, 115, 35, 67, 2, 50, 130, 64, 176, 154, 252, 155, 152, 73, 20, 154, 16, 153, 65, 34, 84, 1, 32, 161, 191, 188, 172, 187, 155, 152, 16, 17, 67, 129, 82, 83, 52, 16, 33, 144, 16, 1, 81, 2, 9, 201, 156, 51, 67, 68, 1, 33, 184, 206, 189, 188, 187, 138, 184, 11, 162, 139, 52, 84, 52, 34, 18, 17, 2, 155, 34, 48, 163, 239, 186, 171, 16, 33, 22, 171, 136, 237, 235, 187, 168, 186, 81, 52, 18, 18, 69, 36, 18, 33, 51, 34, 68, 2, 136, 169, 154, 168, 207, 137, 169, 169, 203, 172, 138, 216, 173, 152, 202, 10, 17, 2, 136, 33, 49, 103, 1, 66, 18, 51, 17, 18, 220, 171, 202, 203, 138, 34, 251, 155, 136, 33, 18, 17, 233, 10, 68, 36, 1, 32, 130, 10, 69, 35, 129, 169, 202, 155, 49, 52, 248, 172, 170, 9, 0, 33, 162, 239, 170, 153, 153, 32, 67, 51, 33, 114, 35, 33, 2, 168, 136, 251, 172, 32, 1, 66, 20, 152, 218, 172, 153, 137, 0, 200, 173, 137, 202, 139, 144, 202, 41, 71, 52, 37, 35, 67, 2, 137, 130, 219, 169, 204, 138, 184, 204, 137, 137, 137, 40, 54, 18, 83, 19, 24, 1, 33, 251, 171, 203, 138, 16, 51, 1, 66, 51, 55, 17, 101, 35, 18, 168, 220, 189, 171, 187, 171, 153, 8, 17, 115, 20, 16, 35, 160, 203, 189, 137, 16, 35, 1, 192, 172, 170, 10, 68, 36, 83, 35, 16, 51, 144, 188, 9, 129, 186, 189, 24, 49, 71, 16, 49, 130, 185, 220, 154, 145, 25, 39, 144, 1, 10, 67, 49, 5, 41, 180, 223, 153, 172, 9, 169, 8, 185, 138, 8, 83, 149, 254, 20, 0, 51, 100, 20, 152, 203, 171, 170, 172, 24, 16, 33, 68, 69, 67, 67, 51, 35, 128, 201, 172, 203, 139, 1, 8, 34, 170, 152, 172, 50, 128, 51, 250, 189, 187, 172, 48, 161, 219, 173, 152, 173, 65, 99, 52, 18, 1, 0, 217, 171, 152, 10, 129, 155, 32, 82, 37, 99, 51, 35, 168, 169, 221, 171, 203, 170, 169, 24, 176, 10, 34, 115, 54, 66, 34, 34, 1, 145, 153, 168, 235, 190, 187, 235, 138, 16, 19, 2, 168, 156, 153, 156, 137, 186, 173, 154, 137, 64, 51, 98, 69, 68, 130, 24, 19, 33, 20, 144, 0, 136, 250, 173, 16, 153, 64, 67, 18, 16, 100, 18, 152, 154, 137, 234, 187, 203, 171, 9, 67, 18, 129, 10, 129, 205, 169, 10, 3, 250, 187, 235, 155, 48, 50, 70, 35, 1, 33, 129, 57, 54, 130, 154, 128, 220, 203, 154, 152, 187, 137, 153, 98, 34, 116, 52, 51, 33, 18, 250, 187, 188, 156, 169, 153, 24, 19, 1, 66, 66, 50, 34, 3, 169, 1, 235, 188, 204, 187, 172, 138, 136, 98, 2, 114, 51, 50, 51, 19, 235, 187, 171, 0, 176, 175, 153, 170, 136, 32, 52, 53, 83, 51, 34, 18, 185, 203, 189, 174, 171, 138, 0, 33, 83, 35, 1, 34, 19, 184, 153, 201, 138, 144, 172, 185, 203, 9, 153, 155, 16, 83, 66, 33, 34, 160, 156, 185, 172, 153, 153, 16, 33, 49, 18, 18, 16, 33, 144, 153, 0, 160, 10, 144, 153, 144, 16, 17, 153, 153, 0, 17, 144, 16, 144, 153, 0, 144, 153, 1, 9, 0, 153, 16, 9, 0, 0, 0, 0, 0, 0, 16, 0, 9, 1, 144, 0, 0, 0, 0, 144, 16, 0, 9, 1, 9, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 0, 1, 9, 0, 0, 1, 0, 0, 0, 144, 0, 16, 0, 0, 0, 9, 1, 144, 0, 0, 16, 0, 9, 0, 9, 1, 0, 0, 0, 144, 16, 0, 16, 144, 0, 1, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 144, 0, 0, 1, 0, 0, 0, 0, 0, 144, 16, 0, 0, 0, 0, 0, 0, 0, 0, 144, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
-static const size_t audio_acquired_sample_data_length = sizeof(audio_acquired_sample_data) / sizeof(audio_acquired_sample_data[0]);
+static const size_t audio_acquired_sample_data_length = 31258;
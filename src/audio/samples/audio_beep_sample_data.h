@@ -1,11 +0,0 @@
-// This file was generated by a script on 28-11-2024 09:14:01
-
-#pragma once
-
-#include <stddef.h>
-#include <stdint.h>
-#include <pico/platform/sections.h>
-
-static const int16_t __in_flash("audio_beep_sample_data") audio_beep_sample_data[] = { 0, 4652, 9211, 13583, 17680, 21417, 24722, 27525, 29771, 31413, 32419, 32767, 32451, 31478, 29867, 27651, 24875, 21594, 17875, 13795, 9435, 4882, 232, -4422, -8987, -13370, -17483, -21242, -24569, -27399, -29673, -31346, -32384, -32766, -32485, -31544, -29963, -27777, -25027, -21769, -18071, -14006, -9659, -5115, -467, 4189, 8762, 13157, 17284, 21062, 24413, 27269, 29573, 31277, 32348, 32762, 32513, 31605, 30057, 27899, 25176, 21942, 18265, 14216, 9880, 5343, 699, -3958, -8538, -12943, -17087, -20884, -24258, -27140, -29472, -31208, -32311, -32758, -32543, -31667, -30150, -28021, -25326, -22117, -18458, -14428, -10103, -5575, -933, 3725, 8310, 12727, 16886, 20702, 24099, 27008, 29368, 31134, 32270, 32751, 32567, 31726, 30239, 28141, 25472, 22287, 18650, 14636, 10324, 5804, 1166, -3495, -8087, -12513, -16686, -20522, -23941, -26876, -29266, -31062, -32229, -32743, -32594, -31783, -30329, -28260, -25619, -22459, -18843, -14845, -10547, -6034, -1400, 3262, 7858, 12296, 16485, 20338, 23781, 26741, 29159, 30986, 32185, 32733, 32615, 31839, 30416, 28377, 25763, 22627, 19033, 15052, 10767, 6263, 1632, -3031, -7633, -12080, -16283, -20155, -23620, -26606, -29052, -30911, -32141, -32722, -32639, -31894, -30503, -28494, -25907, -22796, -19224, -15259, -10987, -6493, -1867, 2796, 7404, 11861, 16079, 19971, 23457, 26468, 28942, 30830, 32095, 32707, 32658, 31946, 30587, 28607, 26049, 22963, 19411, 15465, 11207, 6721, 2099, -2565, -7177, -11645, -15876, -19785, -23294, -26330, -28833, -30752, -32048, -32694, -32677, -31998, -30670, -28721, -26191, -23130, -19600, -15671, -11427, -6949, -2332, 2331, 6948, 11426, 15670, 19599, 23129, 26190, 28720, 30669, 31997, 32676, 32693, 32047, 30751, 28832, 26329, 23293, 19784, 15875, 11644, 7176, 2564, -2100, -6722, -11208, -15466, -19412, -22964, -26050, -28608, -30588, -31947, -32659, -32708, -32096, -30831, -28943, -26469, -23458, -19972, -16080, -11862, -7405, -2797, 1866, 6492, 10986, 15258, 19223, 22795, 25906, 28493, 30502, 31893, 32638, 32721, 32140, 30910, 29051, 26605, 23619, 20154, 16282, 12079, 7632, 3030, -1633, -6264, -10768, -15053, -19034, -22628, -25764, -28378, -30417, -31840, -32616, -32734, -32186, -30987, -29160, -26742, -23782, -20339, -16486, -12297, -7859, -3263, 1399, 6033, 10546, 14844, 18842, 22458, 25618, 28259, 30328, 31782, 32593, 32742, 32228, 31061, 29265, 26875, 23940, 20521, 16685, 12512, 8086, 3494, -1167, -5805, -10325, -14637, -18651, -22288, -25473, -28142, -30240, -31727, -32568, -32752, -32271, -31135, -29369, -27009, -24100, -20703, -16887, -12728, -8311, -3726, 932, 5574, 10102, 14427, 18457, 22116, 25325, 28020, 30149, 31666, 32542, 32757, 32310, 31207, 29471, 27139, 24257, 20883, 17086, 12942, 8537, 3957, -700, -5344, -9881, -14217, -18266, -21943, -25177, -27900, -30058, -31606, -32514, -32763, -32349, -31278, -29574, -27270, -24414, -21063, -17285, -13158, -8763, -4190, 466, 5114, 9658, 14005, 18070, 21768, 25026, 27776, 29962, 31543, 32484, 32765, 32383, 31345, 29672, 27398, 24568, 21241, 17482, 13369, 8986, 4421, -233, -4883, -9436, -13796, -17876, -21595, -24876, -27652, -29868, -31479, -32452, -32768, -32420, -31414, -29772, -27526, -24723, -21418, -17681, -13584, -9212, -4653, 0, 4652, 9211, 13583, 17680, 21417, 24722, 27525, 29771, 31413, 32419, 32767, 32451, 31478, 29867, 27651, 24875, 21594, 17875, 13795, 9435, 4882, 232, -4422, -8987, -13370, -17483, -21242, -24569, -27399, -29673, -31346, -32384, -32766, -32485, -31544, -29963, -27777, -25027, -21769, -18071, -14006, -9659, -5115, -467, 4189, 8762, 13157, 17284, 21062, 24413, 27269, 29573, 31277, 32348, 32762, 32513, 31605, 30057, 27899, 25176, 21942, 18265, 14216, 9880, 5343, 699, -3958, -8538, -12943, -17087, -20884, -24258, -27140, -29472, -31208, -32311, -32758, -32543, -31667, -30150, -28021, -25326, -22117, -18458, -14428, -10103, -5575, -933, 3725, 8310, 12727, 16886, 20702, 24099, 27008, 29368, 31134, 32270, 32751, 32567, 31726, 30239, 28141, 25472, 22287, 18650, 14636, 10324, 5804, 1166, -3495, -8087, -12513, -16686, -20522, -23941, -26876, -29266, -31062, -32229, -32743, -32594, -31783, -30329, -28260, -25619, -22459, -18843, -14845, -10547, -6034, -1400, 3262, 7858, 12296, 16485, 20338, 23781, 26741, 29159, 30986, 32185, 32733, 32615, 31839, 30416, 28377, 25763, 22627, 19033, 15052, 10767, 6263, 1632, -3031, -7633, -12080, -16283, -20155, -23620, -26606, -29052, -30911, -32141, -32722, -32639, -31894, -30503, -28494, -25907, -22796, -19224, -15259, -10987, -6493, -1867, 2796, 7404, 11861, 16079, 19971, 23457, 26468, 28942, 30830, 32095, 32707, 32658, 31946, 30587, 28607, 26049, 22963, 19411, 15465, 11207, 6721, 2099, -2565, -7177, -11645, -15876, -19785, -23294, -26330, -28833, -30752, -32048, -32694, -32677, -31998, -30670, -28721, -26191, -23130, -19600, -15671, -11427, -6949, -2332, 2331, 6948, 11426, 15670, 19599, 23129, 26190, 28720, 30669, 31997, 32676, 32693, 32047, 30751, 28832, 26329, 23293, 19784, 15875, 11644, 7176, 2564, -2100, -6722, -11208, -15466, -19412, -22964, -26050, -28608, -30588, -31947, -32659, -32708, -32096, -30831, -28943, -26469, -23458, -19972, -16080, -11862, -7405, -2797, 1866, 6492, 10986, 15258, 19223, 22795, 25906, 28493, 30502, 31893, 32638, 32721, 32140, 30910, 29051, 26605, 23619, 20154, 16282, 12079, 7632, 3030, -1633, -6264, -10768, -15053, -19034, -22628, -25764, -28378, -30417, -31840, -32616, -32734, -32186, -30987, -29160, -26742, -23782, -20339, -16486, -12297, -7859, -3263, 1399, 6033, 10546, 14844, 18842, 22458, 25618, 28259, 30328, 31782, 32593, 32742, 32228, 31061, 29265, 26875, 23940, 20521, 16685, 12512, 8086, 3494, -1167, -5805, -10325, -14637, -18651, -22288, -25473, -28142, -30240, -31727, -32568, -32752, -32271, -31135, -29369, -27009, -24100, -20703, -16887, -12728, -8311, -3726, 932, 5574, 10102, 14427, 18457, 22116, 25325, 28020, 30149, 31666, 32542, 32757, 32310, 31207, 29471, 27139, 24257, 20883, 17086, 12942, 8537, 3957, -700, -5344, -9881, -14217, -18266, -21943, -25177, -27900, -30058, -31606, -32514, -32763, -32349, -31278, -29574, -27270, -24414, -21063, -17285, -13158, -8763, -4190, 466, 5114, 9658, 14005, 18070, 21768, 25026, 27776, 29962, 31543, 32484, 32765, 32383, 31345, 29672, 27398, 24568, 21241, 17482, 13369, 8986, 4421, -233, -4883, -9436, -13796, -17876, -21595, -24876, -27652, -29868, -31479, -32452, -32768, -32420, -31414, -29772, -27526, -24723, -21418, -17681, -13584, -9212, -4653, 0, 4652, 9211, 13583, 17680, 21417, 24722, 27525, 29771, 31413, 32419, 32767, 32451, 31478, 29867, 27651, 24875, 21594, 17875, 13795, 9435, 4882, 232, -4422, -8987, -13370, -17483, -21242, -24569, -27399, -29673, -31346, -32384, -32766, -32485, -31544, -29963, -27777, -25027, -21769, -18071, -14006, -9659, -5115, -467, 4189, 8762, 13157, 17284, 21062, 24413, 27269, 29573, 31277, 32348, 32762, 32513, 31605, 30057, 27899, 25176, 21942, 18265, 14216, 9880, 5343, 699, -3958, -8538, -12943, -17087, -20884, -24258, -27140, -29472, -31208, -32311, -32758, -32543, -31667, -30150, -28021, -25326, -22117, -18458, -14428, -10103, -5575, -933, 3725, 8310, 12727, 16886, 20702, 24099, 27008, 29368, 31134, 32270, 32751, 32567, 31726, 30239, 28141, 25472, 22287, 18650, 14636, 10324, 5804, 1166, -3495, -8087, -12513, -16686, -20522, -23941, -26876, -29266, -31062, -32229, -32743, -32594, -31783, -30329, -28260, -25619, -22459, -18843, -14845, -10547, -6034, -1400, 3262, 7858, 12296, 16485, 20338, 23781, 26741, 29159, 30986, 32185, 32733, 32615, 31839, 30416, 28377, 25763, 22627, 19033, 15052, 10767, 6263, 1632, -3031, -7633, -12080, -16283, -20155, -23620, -26606, -29052, -30911, -32141, -32722, -32639, -31894, -30503, -28494, -25907, -22796, -19224, -15259, -10987, -6493, -1867, 2796, 7404, 11861, 16079, 19971, 23457, 26468, 28942, 30830, 32095, 32707, 32658, 31946, 30587, 28607, 26049, 22963, 19411, 15465, 11207, 6721, 2099, -2565, -7177, -11645, -15876, -19785, -23294, -26330, -28833, -30752, -32048, -32694, -32677, -31998, -30670, -28721, -26191, -23130, -19600, -15671, -11427, -6949, -2332, 2331, 6948, 11426, 15670, 19599, 23129, 26190, 28720, 30669, 31997, 32676, 32693, 32047, 30751, 28832, 26329, 23293, 19784, 15875, 11644, 7176, 2564, -2100, -6722, -11208, -15466, -19412, -22964, -26050, -28608, -30588, -31947, -32659, -32708, -32096, -30831, -28943, -26469, -23458, -19972, -16080, -11862, -7405, -2797, 1866, 6492, 10986, 15258, 19223, 22795, 25906, 28493, 30502, 31893, 32638, 32721, 32140, 30910, 29051, 26605, 23619, 20154, 16282, 12079, 7632, 3030, -1633, -6264, -10768, -15053, -19034, -22628, -25764, -28378, -30417, -31840, -32616, -32734, -32186, -30987, -29160, -26742, -23782, -20339, -16486, -12297, -7859, -3263, 1399, 6033, 10546, 14844, 18842, 22458, 25618, 28259, 30328, 31782, 32593, 32742, 32228, 31061, 29265, 26875, 23940, 20521, 16685, 12512, 8086, 3494, -1167, -5805, -10325, -14637, -18651, -22288, -25473, -28142, -30240, -31727, -32568, -32752, -32271, -31135, -29369, -27009, -24100, -20703, -16887, -12728, -8311, -3726, 932, 5574, 10102, 14427, 18457, 22116, 25325, 28020, 30149, 31666, 32542, 32757, 32310, 31207, 29471, 27139, 24257, 20883, 17086, 12942, 8537, 3957, -700, -5344, -9881, -14217, -18266, -21943, -25177, -27900, -30058, -31606, -32514, -32763, -32349, -31278, -29574, -27270, -24414, -21063, -17285, -13158, -8763, -4190, 466, 5114, 9658, 14005, 18070, 21768, 25026, 27776, 29962, 31543, 32484, 32765, 32383, 31345, 29672, 27398, 24568, 21241, 17482, 13369, 8986, 4421, -233, -4883, -9436, -13796, -17876, -21595, -24876, -27652, -29868, -31479, -32452, -32768, -32420, -31414, -29772, -27526, -24723, -21418, -17681, -13584, -9212, -4653, 0, 4652, 9211, 13583, 17680, 21417, 24722, 27525, 29771, 31413, 32419, 32767, 32451, 31478, 29867, 27651, 24875, 21594, 17875, 13795, 9435, 4882, 232, -4422, -8987, -13370, -17483, -21242, -24569, -27399, -29673, -31346, -32384, -32766, -32485, -31544, -29963, -27777, -25027, -21769, -18071, -14006, -9659, -5115, -467, 4189, 8762, 13157, 17284, 21062, 24413, 27269, 29573, 31277, 32348, 32762, 32513, 31605, 30057, 27899, 25176, 21942, 18265, 14216, 9880, 5343, 699, -3958, -8538, -12943, -17087, -20884, -24258, -27140, -29472, -31208, -32311, -32758, -32543, -31667, -30150, -28021, -25326, -22117, -18458, -14428, -10103, -5575, -933, 3725, 8310, 12727, 16886, 20702, 24099, 27008, 29368, 31134, 32270, 32751, 32567, 31726, 30239, 28141, 25472, 22287, 18650, 14636, 10324, 5804, 1166, -3495, -8087, -12513, -16686, -20522, -23941, -26876, -29266, -31062, -32229, -32743, -32594, -31783, -30329, -28260, -25619, -22459, -18843, -14845, -10547, -6034, -1400, 3262, 7858, 12296, 16485, 20338, 23781, 26741, 29159, 30986, 32185, 32733, 32615, 31839, 30416, 28377, 25763, 22627, 19033, 15052, 10767, 6263, 1632, -3031, -7633, -12080, -16283, -20155, -23620, -26606, -29052, -30911, -32141, -32722, -32639, -31894, -30503, -28494, -25907, -22796, -19224, -15259, -10987, -6493, -1867, 2796, 7404, 11861, 16079, 19971, 23457, 26468, 28942, 30830, 32095, 32707, 32658, 31946, 30587, 28607, 26049, 22963, 19411, 15465, 11207, 6721, 2099, -2565, -7177, -11645, -15876, -19785, -23294, -26330, -28833, -30752, -32048, -32694, -32677, -31998, -30670, -28721, -26191, -23130, -19600, -15671, -11427, -6949, -2332, 2331, 6948, 11426, 15670, 19599, 23129, 26190, 28720, 30669, 31997, 32676, 32693, 32047, 30751, 28832, 26329, 23293, 19784, 15875, 11644, 7176, 2564, -2100, -6722, -11208, -15466, -19412, -22964, -26050, -28608, -30588, -31947, -32659, -32708, -32096, -30831, -28943, -26469, -23458, -19972, -16080, -11862, -7405, -2797, 1866, 6492, 10986, 15258, 19223, 22795, 25906, 28493, 30502, 31893, 32638, 32721, 32140, 30910, 29051, 26605, 23619, 20154, 16282, 12079, 7632, 3030, -1633, -6264, -10768, -15053, -19034, -22628, -25764, -28378, -30417, -31840, -32616, -32734, -32186, -30987, -29160, -26742, -23782, -20339, -16486, -12297, -7859, -3263, 1399, 6033, 10546, 14844, 18842, 22458, 25618, 28259, 30328, 31782, 32593, 32742, 32228, 31061, 29265, 26875, 23940, 20521, 16685, 12512, 8086, 3494, -1167, -5805, -10325, -14637, -18651, -22288, -25473, -28142, -30240, -31727, -32568, -32752, -32271, -31135, -29369, -27009, -24100, -20703, -16887, -12728, -8311, -3726, 932, 5574, 10102, 14427, 18457, 22116, 25325, 28020, 30149, 31666, 32542, 32757, 32310, 31207, 29471, 27139, 24257, 20883, 17086, 12942, 8537, 3957, -700, -5344, -9881, -14217, -18266, -21943, -25177, -27900, -30058, -31606, -32514, -32763, -32349, -31278, -29574, -27270, -24414, -21063, -17285, -13158, -8763, -4190, 466, 5114, 9658, 14005, 18070, 21768, 25026, 27776, 29962, 31543, 32484, 32765, 32383, 31345, 29672, 27398, 24568, 21241, 17482, 13369, 8986, 4421, -233, -4883, -9436, -13796, -17876, -21595, -24876, -27652, -29868, -31479, -32452, -32768, -32420, -31414, -29772, -27526, -24723, -21418, -17681, -13584, -9212, -4653, 0, 4652, 9211, 13583, 17680, 21417, 24722, 27525, 29771, 31413, 32419, 32767, 32451, 31478, 29867, 27651, 24875, 21594, 17875, 13795, 9435, 4882, 232, -4422, -8987, -13370, -17483, -21242, -24569, -27399, -29673, -31346, -32384, -32766, -32485, -31544, -29963, -27777, -25027, -21769, -18071, -14006, -9659, -5115, -467, 4189, 8762, 13157, 17284, 21062, 24413, 27269, 29573, 31277, 32348, 32762, 32513, 31605, 30057, 27899, 25176, 21942, 18265, 14216, 9880, 5343, 699, -3958, -8538, -12943, -17087, -20884, -24258, -27140, -29472, -31208, -32311, -32758, -32543, -31667, -30150, -28021, -25326, -22117, -18458, -14428, -10103, -5575, -933, 3725, 8310, 12727, 16886, 20702, 24099, 27008, 29368, 31134, 32270, 32751, 32567, 31726, 30239, 28141, 25472, 22287, 18650, 14636, 10324, 5804, 1166, -3495, -8087, -12513, -16686, -20522, -23941, -26876, -29266, -31062, -32229, -32743, -32594, -31783, -30329, -28260, -25619, -22459, -18843, -14845, -10547, -6034, -1400, 3262, 7858, 12296, 16485, 20338, 23781, 26741, 29159, 30986, 32185, 32733, 32615, 31839, 30416, 28377, 25763, 22627, 19033, 15052, 10767, 6263, 1632, -3031, -7633, -12080, -16283, -20155, -23620, -26606, -29052, -30911, -32141, -32722, -32639, -31894, -30503, -28494, -25907, -22796, -19224, -15259, -10987, -6493, -1867, 2796, 7404, 11861, 16079, 19971, 23457, 26468, 28942, 30830, 32095, 32707, 32658, 31946, 30587, 28607, 26049, 22963, 19411, 15465, 11207, 6721, 2099, -2565, -7177, -11645, -15876, -19785, -23294, -26330, -28833, -30752, -32048, -32694, -32677, -31998, -30670, -28721, -26191, -23130, -19600, -15671, -11427, -6949, -2332, 2331, 6948, 11426, 15670, 19599, 23129, 26190, 28720, 30669, 31997, 32676, 32693, 32047, 30751, 28832, 26329, 23293, 19784, 15875, 11644, 7176, 2564, -2100, -6722, -11208, -15466, -19412, -22964, -26050, -28608, -30588, -31947, -32659, -32708, -32096, -30831, -28943, -26469, -23458, -19972, -16080, -11862, -7405, -2797, 1866, 6492, 10986, 15258, 19223, 22795, 25906, 28493, 30502, 31893, 32638, 32721, 32140, 30910, 29051, 26605, 23619, 20154, 16282, 12079, 7632, 3030, -1633, -6264, -10768, -15053, -19034, -22628, -25764, -28378, -30417, -31840, -32616, -32734, -32186, -30987, -29160, -26742, -23782, -20339, -16486, -12297, -7859, -3263, 1399, 6033, 10546, 14844, 18842, 22458, 25618, 28259, 30328, 31782, 32593, 32742, 32228, 31061, 29265, 26875, 23940, 20521, 16685, 12512, 8086, 3494, -1167, -5805, -10325, -14637, -18651, -22288, -25473, -28142, -30240, -31727, -32568, -32752, -32271, -31135, -29369, -27009, -24100, -20703, -16887, -12728, -8311, -3726, 932, 5574, 10102, 14427, 18457, 22116, 25325, 28020, 30149, 31666, 32542, 32757, 32310, 31207, 29471, 27139, 24257, 20883, 17086, 12942, 8537, 3957, -700, -5344, -9881, -14217, -18266, -21943, -25177, -27900, -30058, -31606, -32514, -32763, -32349, -31278, -29574, -27270, -24414, -21063, -17285, -13158, -8763, -4190, 466, 5114, 9658, 14005, 18070, 21768, 25026, 27776, 29962, 31543, 32484, 32765, 32383, 31345, 29672, 27398, 24568, 21241, 17482, 13369, 8986, 4421, -233, -4883, -9436, -13796, -17876, -21595, -24876, -27652, -29868, -31479, -32452, -32768, -32420, -31414, -29772, -27526, -24723, -21418, -17681, -13584, -9212, -4653, 0, 4652, 9211, 13583, 17680, 21417, 24722, 27525, 29771, 31413, 32419, 32767, 32451, 31478, 29867, 27651, 24875, 21594, 17875, 13795, 9435, 4882, 232, -4422, -8987, -13370, -17483, -21242, -24569, -27399, -29673, -31346, -32384, -32766, -32485, -31544, -29963, -27777, -25027, -21769, -18071, -14006, -9659, -5115, -467, 4189, 8762, 13157, 17284, 21062, 24413, 27269, 29573, 31277, 32348, 32762, 32513, 31605, 30057, 27899, 25176, 21942, 18265, 14216, 9880, 5343, 699, -3958, -8538, -12943, -17087, -20884, -24258, -27140, -29472, -31208, -32311, -32758, -32543, -31667, -30150, -28021, -25326, -22117, -18458, -14428, -10103, -5575, -933, 3725, 8310, 12727, 16886, 20702, 24099, 27008, 29368, 31134, 32270, 32751, 32567, 31726, 30239, 28141, 25472, 22287, 18650, 14636, 10324, 5804, 1166, -3495, -8087, -12513, -16686, -20522, -23941, -26876, -29266, -31062, -32229, -32743, -32594, -31783, -30329, -28260, -25619, -22459, -18843, -14845, -10547, -6034, -1400, 3262, 7858, 12296, 16485, 20338, 23781, 26741, 29159, 30986, 32185, 32733, 32615, 31839, 30416, 28377, 25763, 22627, 19033, 15052, 10767, 6263, 1632, -3031, -7633, -12080, -16283, -20155, -23620, -26606, -29052, -30911, -32141, -32722, -32639, -31894, -30503, -28494, -25907, -22796, -19224, -15259, -10987, -6493, -1867, 2796, 7404, 11861, 16079, 19971, 23457, 26468, 28942, 30830, 32095, 32707, 32658, 31946, 30587, 28607, 26049, 22963, 19411, 15465, 11207, 6721, 2099, -2565, -7177, -11645, -15876, -19785, -23294, -26330, -28833, -30752, -32048, -32694, -32677, -31998, -30670, -28721, -26191, -23130, -19600, -15671, -11427, -6949, -2332, 2331, 6948, 11426, 15670, 19599, 23129, 26190, 28720, 30669, 31997, 32676, 32693, 32047, 30751, 28832, 26329, 23293, 19784, 15875, 11644, 7176, 2564, -2100, -6722, -11208, -15466, -19412, -22964, -26050, -28608, -30588, -31947, -32659, -32708, -32096, -30831, -28943, -26469, -23458, -19972, -16080, -11862, -7405, -2797, 1866, 6492, 10986, 15258, 19223, 22795, 25906, 28493, 30502, 31893, 32638, 32721, 32140, 30910, 29051, 26605, 23619, 20154, 16282, 12079, 7632, 3030, -1633, -6264, -10768, -15053, -19034, -22628, -25764, -28378, -30417, -31840, -32616, -32734, -32186, -30987, -29160, -26742, -23782, -20339, -16486, -12297, -7859, -3263, 1399, 6033, 10546, 14844, 18842, 22458, 25618, 28259, 30328, 31782, 32593, 32742, 32228, 31061, 29265, 26875, 23940, 20521, 16685, 12512, 8086, 3494, -1167, -5805, -10325, -14637, -18651, -22288, -25473, -28142, -30240, -31727, -32568, -32752, -32271, -31135, -29369, -27009, -24100, -20703, -16887, -12728, -8311, -3726, 932, 5574, 10102, 14427, 18457, 22116, 25325, 28020, 30149, 31666, 32542, 32757, 32310, 31207, 29471, 27139, 24257, 20883, 17086, 12942, 8537, 3957, -700, -5344, -9881, -14217, -18266, -21943, -25177, -27900, -30058, -31606, -32514, -32763, -32349, -31278, -29574, -27270, -24414, -21063, -17285, -13158, -8763, -4190, 466, 5114, 9658, 14005, 18070, 21768, 25026, 27776, 29962, 31543, 32484, 32765, 32383, 31345, 29672, 27398, 24568, 21241, 17482, 13369, 8986, 4421, -233, -4883, -9436, -13796, -17876, -21595, -24876, -27652, -29868, -31479, -32452, -32768, -32420, -31414, -29772, -27526, -24723, -21418, -17681, -13584, -9212, -4653, 0, 4652, 9211, 13583, 17680, 21417, 24722, 27525, 29771, 31413, 32419, 32767, 32451, 31478, 29867, 27651, 24875, 21594, 17875, 13795, 9435, 4882, 232, -4422, -8987, -13370, -17483, -21242, -24569, -27399, -29673, -31346, -32384, -32766, -32485, -31544, -29963, -27777, -25027, -21769, -18071, -14006, -9659, -5115, -467, 4189, 8762, 13157, 17284, 21062, 24413, 27269, 29573, 31277, 32348, 32762, 32513, 31605, 30057, 27899, 25176, 21942, 18265, 14216, 9880, 5343, 699, -3958, -8538, -12943, -17087, -20884, -24258, -27140, -29472, -31208, -32311, -32758, -32543, -31667, -30150, -28021, -25326, -22117, -18458, -14428, -10103, -5575, -933, 3725, 8310, 12727, 16886, 20702, 24099, 27008, 29368, 31134, 32270, 32751, 32567, 31726, 30239, 28141, 25472, 22287, 18650, 14636, 10324, 5804, 1166, -3495, -8087, -12513, -16686, -20522, -23941, -26876, -29266, -31062, -32229, -32743, -32594, -31783, -30329, -28260, -25619, -22459, -18843, -14845, -10547, -6034, -1400, 3262, 7858, 12296, 16485, 20338, 23781, 26741, 29159, 30986, 32185, 32733, 32615, 31839, 30416, 28377, 25763, 22627, 19033, 15052, 10767, 6263, 1632, -3031, -7633, -12080, -16283, -20155, -23620, -26606, -29052, -30911, -32141, -32722, -32639, -31894, -30503, -28494, -25907, -22796, -19224, -15259, -10987, -6493, -1867, 2796, 7404, 11861, 16079, 19971, 23457, 26468, 28942, 30830, 32095, 32707, 32658, 31946, 30587, 28607, 26049, 22963, 19411, 15465, 11207, 6721, 2099, -2565, -7177, -11645, -15876, -19785, -23294, -26330, -28833, -30752, -32048, -32694, -32677, -31998, -30670, -28721, -26191, -23130, -19600, -15671, -11427, -6949, -2332, 2331, 6948, 11426, 15670, 19599, 23129, 26190, 28720, 30669, 31997, 32676, 32693, 32047, 30751, 28832, 26329, 23293, 19784, 15875, 11644, 7176, 2564, -2100, -6722, -11208, -15466, -19412, -22964, -26050, -28608, -30588, -31947, -32659, -32708, -32096, -30831, -28943, -26469, -23458, -19972, -16080, -11862, -7405, -2797, 1866, 6492, 10986, 15258, 19223, 22795, 25906, 28493, 30502, 31893, 32638, 32721, 32140, 30910, 29051, 26605, 23619, 20154, 16282, 12079, 7632, 3030, -1633, -6264, -10768, -15053, -19034, -22628, -25764, -28378, -30417, -31840, -32616, -32734, -32186, -30987, -29160, -26742, -23782, -20339, -16486, -12297, -7859, -3263, 1399, 6033, 10546, 14844, 18842, 22458, 25618, 28259, 30328, 31782, 32593, 32742, 32228, 31061, 29265, 26875, 23940, 20521, 16685, 12512, 8086, 3494, -1167, -5805, -10325, -14637, -18651, -22288, -25473, -28142, -30240, -31727, -32568, -32752, -32271, -31135, -29369, -27009, -24100, -20703, -16887, -12728, -8311, -3726, 932, 5574, 10102, 14427, 18457, 22116, 25325, 28020, 30149, 31666, 32542, 32757, 32310, 31207, 29471, 27139, 24257, 20883, 17086, 12942, 8537, 3957, -700, -5344, -9881, -14217, -18266, -21943, -25177, -27900, -30058, -31606, -32514, -32763, -32349, -31278, -29574, -27270, -24414, -21063, -17285, -13158, -8763, -4190, 466, 5114, 9658, 14005, 18070, 21768, 25026, 27776, 29962, 31543, 32484, 32765, 32383, 31345, 29672, 27398, 24568, 21241, 17482, 13369, 8986, 4421, -233, -4883, -9436, -13796, -17876, -21595, -24876, -27652, -29868, -31479, -32452, -32768, -32420, -31414, -29772, -27526, -24723, -21418, -17681, -13584, -9212, -4653, 0, 4652, 9211, 13583, 17680, 21417, 24722, 27525, 29771, 31413, 32419, 32767, 32451, 31478, 29867, 27651, 24875, 21594, 17875, 13795, 9435, 4882, 232, -4422, -8987, -13370, -17483, -21242, -24569, -27399, -29673, -31346, -32384, -32766, -32485, -31544, -29963, -27777, -25027, -21769, -18071, -14006, -9659, -5115, -467, 4189, 8762, 13157, 17284, 21062, 24413, 27269, 29573, 31277, 32348, 32762, 32513, 31605, 30057, 27899, 25176, 21942, 18265, 14216, 9880, 5343, 699, -3958, -8538, -12943, -17087, -20884, -24258, -27140, -29472, -31208, -32311, -32758, -32543, -31667, -30150, -28021, -25326, -22117, -18458, -14428, -10103, -5575, -933, 3725, 8310, 12727, 16886, 20702, 24099, 27008, 29368, 31134, 32270, 32751, 32567, 31726, 30239, 28141, 25472, 22287, 18650, 14636, 10324, 5804, 1166, -3495, -8087, -12513, -16686, -20522, -23941, -26876, -29266, -31062, -32229, -32743, -32594, -31783, -30329, -28260, -25619, -22459, -18843, -14845, -10547, -6034, -1400, 3262, 7858, 12296, 16485, 20338, 23781, 26741, 29159, 30986, 32185, 32733, 32615, 31839, 30416, 28377, 25763, 22627, 19033, 15052, 10767, 6263, 1632, -3031, -7633, -12080, -16283, -20155, -23620, -26606, -29052, -30911, -32141, -32722, -32639, -31894, -30503, -28494, -25907, -22796, -19224, -15259, -10987, -6493, -1867, 2796, 7404, 11861, 16079, 19971, 23457, 26468, 28942, 30830, 32095, 32707, 32658, 31946, 30587, 28607, 26049, 22963, 19411, 15465, 11207, 6721, 2099, -2565, -7177, -11645, -15876, -19785, -23294, -26330, -28833, -30752, -32048, -32694, -32677, -31998, -30670, -28721, -26191, -23130, -19600, -15671, -11427, -6949, -2332, 2331, 6948, 11426, 15670, 19599, 23129, 26190, 28720, 30669, 31997, 32676, 32693, 32047, 30751, 28832, 26329, 23293, 19784, 15875, 11644, 7176, 2564, -2100, -6722, -11208, -15466, -19412, -22964, -26050, -28608, -30588, -31947, -32659, -32708, -32096, -30831, -28943, -26469, -23458, -19972, -16080, -11862, -7405, -2797, 1866, 6492, 10986, 15258, 19223, 22795, 25906, 28493, 30502, 31893, 32638, 32721, 32140, 30910, 29051, 26605, 23619, 20154, 16282, 12079, 7632, 3030, -1633, -6264, -10768, -15053, -19034, -22628, -25764, -28378, -30417, -31840, -32616, -32734, -32186, -30987, -29160, -26742, -23782, -20339, -16486, -12297, -7859, -3263, 1399, 6033, 10546, 14844, 18842, 22458, 25618, 28259, 30328, 31782, 32593, 32742, 32228, 31061, 29265, 26875, 23940, 20521, 16685, 12512, 8086, 3494, -1167, -5805, -10325, -14637, -18651, -22288, -25473, -28142, -30240, -31727, -32568, -32752, -32271, -31135, -29369, -27009, -24100, -20703, -16887, -12728, -8311, -3726, 932, 5574, 10102, 14427, 18457, 22116, 25325, 28020, 30149, 31666, 32542, 32757, 32310, 31207, 29471, 27139, 24257, 20883, 17086, 12942, 8537, 3957, -700, -5344, -9881, -14217, -18266, -21943, -25177, -27900, -30058, -31606, -32514, -32763, -32349, -31278, -29574, -27270, -24414, -21063, -17285, -13158, -8763, -4190, 466, 5114, 9658, 14005, 18070, 21768, 25026, 27776, 29962, 31543, 32484, 32765, 32383, 31345, 29672, 27398, 24568, 21241, 17482, 13369, 8986, 4421, -233, -4883, -9436, -13796, -17876, -21595, -24876, -27652, -29868, -31479, -32452, -32768, -32420, -31414, -29772, -27526, -24723, -21418, -17681, -13584, -9212, -4653, 0, 4652, 9211, 13583, 17680, 21417, 24722, 27525, 29771, 31413, 32419, 32767, 32451, 31478, 29867, 27651, 24875, 21594, 17875, 13795, 9435, 4882, 232, -4422, -8987, -13370, -17483, -21242, -24569, -27399, -29673, -31346, -32384, -32766, -32485, -31544, -29963, -27777, -25027, -21769, -18071, -14006, -9659, -5115, -467, 4189, 8762, 13157, 17284, 21062, 24413, 27269, 29573, 31277, 32348, 32762, 32513, 31605, 30057, 27899, 25176, 21942, 18265, 14216, 9880, 5343, 699, -3958, -8538, -12943, -17087, -20884, -24258, -27140, -29472, -31208, -32311, -32758, -32543, -31667, -30150, -28021, -25326, -22117, -18458, -14428, -10103, -5575, -933, 3725, 8310, 12727, 16886, 20702, 24099, 27008, 29368, 31134, 32270, 32751, 32567, 31726, 30239, 28141, 25472, 22287, 18650, 14636, 10324, 5804, 1166, -3495, -8087, -12513, -16686, -20522, -23941, -26876, -29266, -31062, -32229, -32743, -32594, -31783, -30329, -28260, -25619, -22459, -18843, -14845, -10547, -6034, -1400, 3262, 7858, 12296, 16485, 20338, 23781, 26741, 29159, 30986, 32185, 32733, 32615, 31839, 30416, 28377, 25763, 22627, 19033, 15052, 10767, 6263, 1632, -3031, -7633, -12080, -16283, -20155, -23620, -26606, -29052, -30911, -32141, -32722, -32639, -31894, -30503, -28494, -25907, -22796, -19224, -15259, -10987, -6493, -1867, 2796, 7404, 11861, 16079, 19971, 23457, 26468, 28942, 30830, 32095, 32707, 32658, 31946, 30587, 28607, 26049, 22963, 19411, 15465, 11207, 6721, 2099, -2565, -7177, -11645, -15876, -19785, -23294, -26330, -28833, -30752, -32048, -32694, -32677, -31998, -30670, -28721, -26191, -23130, -19600, -15671, -11427, -6949, -2332, 2331, 6948, 11426, 15670, 19599, 23129, 26190, 28720, 30669, 31997, 32676, 32693, 32047, 30751, 28832, 26329, 23293, 19784, 15875, 11644, 7176, 2564, -2100, -6722, -11208, -15466, -19412, -22964, -26050, -28608, -30588, -31947, -32659, -32708, -32096, -30831, -28943, -26469, -23458, -19972, -16080, -11862, -7405, -2797, 1866, 6492, 10986, 15258, 19223, 22795, 25906, 28493, 30502, 31893, 32638, 32721, 32140, 30910, 29051, 26605, 23619, 20154, 16282, 12079, 7632, 3030, -1633, -6264, -10768, -15053, -19034, -22628, -25764, -28378, -30417, -31840, -32616, -32734, -32186, -30987, -29160, -26742, -23782, -20339, -16486, -12297, -7859, -3263, 1399, 6033, 10546, 14844, 18842, 22458, 25618, 28259, 30328, 31782, 32593, 32742, 32228, 31061, 29265, 26875, 23940, 20521, 16685, 12512, 8086, 3494, -1167, -5805, -10325, -14637, -18651, -22288, -25473, -28142, -30240, -31727, -32568, -32752, -32271, -31135, -29369, -27009, -24100, -20703, -16887, -12728, -8311, -3726, 932, 5574, 10102, 14427, 18457, 22116, 25325, 28020, 30149, 31666, 32542, 32757, 32310, 31207, 29471, 27139, 24257, 20883, 17086, 12942, 8537, 3957, -700, -5344, -9881, -14217, -18266, -21943, -25177, -27900, -30058, -31606, -32514, -32763, -32349, -31278, -29574, -27270, -24414, -21063, -17285, -13158, -8763, -4190, 466, 5114, 9658, 14005, 18070, 21768, 25026, 27776, 29962, 31543, 32484, 32765, 32383, 31345, 29672, 27398, 24568, 21241, 17482, 13369, 8986, 4421, -233, -4883, -9436, -13796, -17876, -21595, -24876, -27652, -29868, -31479, -32452, -32768, -32420, -31414, -29772, -27526, -24723, -21418, -17681, -13584, -9212, -4653, 0, 4642, 9169, 13491, 17518, 21174, 24386, 27088, 29231, 30772, 31683, 31949, 31569, 30550, 28920, 26711, 23971, 20761, 17145, 13201, 9006, 4650, 221, -4192, -8498, -12613, -16453, -19941, -23009, -25597, -27655, -29143, -30035, -30314, -29980, -29040, -27518, -25446, -22871, -19844, -16432, -12705, -8738, -4616, -420, 3762, 7848, 11754, 15403, 18722, 21645, 24116, 26086, 27518, 28387, 28677, 28384, 27520, 26103, 24167, 21750, 18907, 15697, 12185, 8446, 4556, 594, -3357, -7221, -10918, -14374, -17521, -20297, -22647, -24527, -25900, -26742, -27038, -26787, -25993, -24681, -22875, -20617, -17954, -14943, -11646, -8133, -4476, -747, 2973, 6615, 10101, 13363, 16336, 18962, 21190, 22976, 24285, 25099, 25398, 25182, 24459, 23245, 21569, 19464, 16981, 14167, 11085, 7796, 4369, 874, -2615, -6032, -9307, -12373, -15170, -17644, -19745, -21435, -22680, -23459, -23759, -23576, -22919, -21802, -20250, -18300, -15991, -13374, -10503, -7437, -4243, -981, 2277, 5471, 8531, 11400, 14020, 16339, 18312, 19901, 21078, 21822, 22117, 21966, 21369, 20345, 18918, 17117, 14981, 12559, 9897, 7056, 4090, 1062, -1966, -4933, -7780, -10450, -12889, -15050, -16893, -18381, -19485, -20188, -20479, -20353, -19816, -18883, -17575, -15921, -13957, -11725, -9273, -6652, -3916, -1121, 1673, 4416, 7047, 9515, 11774, 13776, 15485, 16866, 17897, 18558, 18838, 18735, 18254, 17408, 16217, 14707, 12912, 10872, 8626, 6226, 3718, 1156, -1407, -3923, -6337, -8604, -10677, -12519, -14091, -15364, -16317, -16932, -17200, -17116, -16688, -15927, -14849, -13482, -11853, -10000, -7961, -5779, -3499, -1168, 1163, 3450, 5647, 7711, 9599, 11275, 12709, 13871, 14744, 15308, 15560, 15493, 15114, 14434, 13468, 12239, 10774, 9107, 7271, 5307, 3255, 1156, -943, -3002, -4981, -6839, -8539, -10049, -11342, -12390, -13178, -13691, -13923, -13869, -13537, -12934, -12076, -10984, -9680, -8197, -6563, -4815, -2990, -1123, 744, 2576, 4335, 5985, 7496, 8838, 9986, 10918, 11620, 12076, 12284, 12242, 11952, 11424, 10671, 9712, 8569, 7267, 5833, 4300, 2699, 1064, -570, -2174, -3711, -5155, -6474, -7645, -8647, -9460, -10071, -10469, -10650, -10614, -10363, -9908, -9257, -8429, -7442, -6319, -5084, -3765, -2389, -984, 418, 1792, 3107, 4342, 5468, 6466, 7319, 8009, 8527, 8863, 9016, 8984, 8769, 8381, 7830, 7130, 6297, 5350, 4312, 3205, 2052, 879, -291, -1435, -2529, -3551, -4483, -5306, -6008, -6573, -6995, -7266, -7385, -7353, -7172, -6849, -6394, -5818, -5136, -4366, -3523, -2626, -1696, -752, 186, 1099, 1969, 2779, 3515, 4161, 4708, 5145, 5468, 5671, 5755, 5718, 5567, 5307, 4945, 4492, 3959, 3361, 2711, 2024, 1316, 600, -105, -788, -1434, -2031, -2568, -3035, -3425, -3732, -3953, -4086, -4128, -4086, -3961, -3759, -3487, -3154, -2768, -2341, -1881, -1403, -914, -427, 46, 498, 918, 1301, 1638, 1924, 2156, 2330, 2446, 2502, 2504, 2451, 2349, 2202, 2017, 1801, 1559, 1300, 1030, 757, 488, 230, -11, -232, -429, -594, -730, -833, -902, -940, -948, -928, -882, -817, -735, -641, -540, -437, -337, -243, -160, -92, -42, -10, 0 };
-
-static const size_t audio_beep_sample_data_length = sizeof(audio_beep_sample_data) / sizeof(audio_beep_sample_data[0]);
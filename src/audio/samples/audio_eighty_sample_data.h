@@ -1,4 +1,4 @@
-// This file was generated by a script on 20-11-2024 08:37:39
+// This file was generated by a script on 17-10-2026 14:18:53
 
 #pragma once
 
@@ -6,6 +6,7 @@
 #include <stdint.h>
 #include <pico/platform/sections.h>
 
-static const int16_t __in_flash("audio_eighty_sample_data") audio_eighty_sample_data[] = { -5, -9, -16, -14, -3, 1, 0, -2, 0, 2, 1, -1, -2, -2, -1, -1, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 4, 4, 4, 5, 7, 9, 9, 9, 9, 9, 8, 8, 7, 6, 6, 7, 9, 9, 8, 6, 5, 6, 8, 9, 8, 6, 4, 6, 8, 9, 9, 8, 5, 2, 2, 4, 5, 4, 0, -2, -2, 0, 2, 4, 4, 4, 1, 1, 2, 4, 2, 1, 2, 5, 5, 1, 0, 1, 4, 4, 1, 0, 0, 1, 4, 4, 1, 0, 0, 1, 1, 1, 2, 4, 5, 5, 2, 1, 0, 2, 4, 2, 0, 0, 1, 1, 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 4, 4, 2, 4, 8, 8, 5, 5, 7, 5, 0, 0, 4, 2, -1, -1, 4, 8, 8, 6, 1, 0, 0, 2, 4, 4, 4, 2, 0, 0, 1, 1, 0, -1, -2, -3, -3, 0, 4, 0, -8, -11, -8, -1, 0, 0, -2, -5, -6, -6, -3, -2, -2, -5, -6, -3, 0, -1, -5, -7, -6, -1, 1, 0, -8, -16, -16, -11, -6, -6, -7, -7, -6, -8, -14, -15, -9, -5, -3, -7, -9, -9, -7, -5, -6, -10, -14, -15, -12, -9, -7, -7, -9, -9, -9, -12, -17, -16, -10, -8, -11, -14, -10, -7, -7, -8, -8, -8, -8, -9, -11, -11, -11, -15, -20, -21, -16, -11, -14, -16, -11, -5, -3, -9, -12, -11, -7, -6, -9, -12, -10, -6, -9, -17, -19, -15, -9, -10, -14, -17, -18, -17, -15, -14, -14, -11, -6, -2, -2, -6, -9, -14, -16, -18, -16, -15, -15, -16, -17, -18, -19, -17, -11, -8, -6, -5, -3, -5, -8, -8, -6, -8, -17, -25, -27, -24, -17, -14, -15, -21, -27, -26, -20, -16, -15, -12, -10, -12, -18, -19, -16, -15, -18, -20, -17, -15, -17, -23, -21, -17, -14, -15, -17, -19, -23, -25, -27, -29, -30, -27, -21, -18, -17, -14, -12, -19, -28, -26, -19, -15, -14, -9, -6, -5, -5, -7, -14, -24, -28, -26, -25, -26, -25, -16, -11, -16, -21, -17, -7, -3, -6, -9, -14, -19, -17, -8, -2, -8, -14, -14, -8, -5, -5, -9, -12, -10, -2, -2, -10, -15, -7, 2, 0, -9, -14, -8, -6, -9, -8, -5, -8, -17, -18, -10, -6, -12, -16, -9, -2, -7, -16, -18, -14, -9, -8, -6, -3, -2, -3, -3, -1, 0, -1, -7, -15, -15, -9, -8, -15, -17, -11, -8, -14, -17, -16, -14, -11, -6, 0, 2, 8, 14, 11, 2, 0, 8, 16, 16, 9, 4, -1, -6, -1, 13, 20, 13, 1, 2, 9, 9, 4, 5, 10, 11, 9, 6, -2, -11, -12, -6, 1, 8, 15, 18, 13, 5, 5, 11, 14, 10, 8, 13, 13, 6, -1, -3, -3, -1, 6, 15, 15, 9, 7, 7, 1, -2, 1, 8, 9, 6, 9, 14, 13, 5, -1, -7, -11, -12, -1, 14, 20, 15, 9, 5, 1, 1, 10, 14, 4, -8, -5, 6, 8, 0, -3, 1, 6, 2, -1, -1, -2, -7, -6, 0, -1, -5, 4, 14, 9, 0, -2, -2, -6, -6, 0, -1, -14, -18, -11, -8, -14, -16, -11, -8, -8, 0, 11, 10, -5, -11, 1, 13, 0, -24, -29, -16, -6, -8, -12, -15, -18, -21, -19, -14, -15, -19, -20, -16, -17, -18, -15, -12, -21, -32, -25, -8, -1, -10, -26, -42, -51, -48, -41, -34, -25, -14, -15, -32, -41, -29, -18, -25, -37, -44, -45, -42, -28, -11, -8, -15, -21, -26, -32, -35, -32, -28, -38, -52, -48, -25, -5, -6, -16, -21, -24, -25, -17, 5, 14, -10, -50, -61, -34, 1, 23, 31, 24, 0, -26, -23, 4, 19, 8, -9, -16, -17, -17, -3, 27, 47, 34, 4, -6, 7, 18, 11, 5, 16, 32, 35, 27, 22, 17, 14, 23, 40, 45, 36, 32, 33, 23, 9, 10, 24, 23, 10, 9, 23, 29, 26, 23, 26, 29, 31, 27, 27, 32, 28, 10, -7, -3, 13, 14, 0, -1, 8, 6, -9, -14, 1, 14, 6, -1, 5, 11, 0, -16, -14, -3, -8, -17, -17, -14, -18, -20, -12, -9, -24, -44, -52, -45, -29, -14, 0, 4, 6, 11, 14, -1, -34, -55, -51, -36, -24, -11, -2, -12, -33, -29, -1, 16, 11, 5, 7, 4, -9, -10, 10, 26, 16, -5, -7, 4, 4, -5, -9, -9, -7, 4, 23, 27, 6, -15, -12, -1, 0, 0, 20, 50, 54, 40, 38, 59, 61, 23, -23, -37, -29, -27, -41, -44, -26, -3, 0, -14, -25, -17, 0, 15, 19, 15, 9, 15, 27, 18, -21, -56, -47, -15, -2, -9, -19, -41, -81, -103, -71, -15, 10, -12, -46, -36, 15, 33, -21, -62, 0, 80, 47, -39, -35, 32, 19, -55, -43, 61, 99, 18, -51, -6, 81, 80, -8, -61, -16, 54, 63, 34, 36, 54, 38, 19, 47, 82, 62, 27, 49, 99, 106, 80, 76, 84, 65, 40, 51, 80, 81, 65, 76, 93, 62, 17, 32, 86, 88, 51, 65, 129, 134, 64, 29, 81, 118, 56, -17, 15, 111, 138, 80, 47, 85, 120, 102, 60, 46, 69, 86, 58, 0, -10, 59, 131, 100, -7, -55, 13, 82, 43, -36, -11, 103, 158, 100, 37, 64, 133, 140, 71, 10, 24, 73, 77, 14, -39, -12, 59, 65, -6, -25, 75, 159, 91, -16, 42, 211, 215, 4, -122, 22, 178, 60, -147, -88, 144, 176, -10, -69, 94, 194, 71, -59, 2, 130, 108, -20, -53, 43, 114, 73, 10, 17, 67, 90, 76, 67, 94, 138, 146, 108, 88, 129, 177, 167, 109, 59, 18, -36, -114, -183, -186, -133, -142, -212, -60, 437, 873, 911, 941, 1347, 1681, 1486, 1210, 1281, 1150, 335, -495, -557, -224, -302, -747, -913, -564, -34, 308, 401, 415, 525, 727, 834, 705, 448, 303, 285, 131, -272, -620, -596, -370, -354, -567, -619, -378, -212, -389, -618, -516, -264, -332, -700, -835, -541, -281, -433, -699, -632, -376, -369, -586, -650, -504, -473, -684, -868, -819, -695, -737, -937, -1117, -1176, -1112, -977, -885, -908, -921, -729, -413, -257, -298, -231, 51, 196, -72, -443, -473, -343, -574, -1120, -1376, -1141, -937, -1124, -1291, -958, -418, -241, -303, -66, 399, 557, 373, 277, 317, 210, 4, -73, -123, -321, -548, -679, -823, -986, -961, -711, -467, -327, -134, 189, 483, 599, 614, 655, 665, 539, 331, 165, 35, -112, -221, -224, -204, -273, -369, -336, -159, 53, 274, 540, 746, 726, 558, 511, 613, 582, 276, -76, -248, -326, -463, -586, -557, -487, -570, -709, -639, -382, -274, -461, -709, -772, -688, -561, -327, 56, 398, 504, 504, 717, 1205, 1700, 2004, 2200, 2392, 2473, 2414, 2411, 2354, 1609, -28, -1562, -1846, -1088, -484, -674, -1340, -1910, -1974, -1345, -302, 572, 1060, 1436, 1958, 2645, 3398, 3922, 3750, 2683, 1004, -877, -2674, -4132, -5172, -6055, -6942, -7327, -6467, -4459, -2327, -748, 754, 2783, 4808, 5732, 5339, 4355, 3301, 2128, 805, -462, -1589, -2632, -3524, -4130, -4463, -4474, -3797, -2268, -588, 304, 537, 1040, 2011, 2749, 3111, 3789, 4841, 5220, 4290, 2785, 1693, 1048, 441, -73, -360, -879, -2000, -2954, -2584, -1129, -175, -434, -704, 88, 1031, 839, 118, 2, -260, -1850, -3772, -4334, -3820, -3376, -2885, -2019, -1415, -1224, -556, 703, 1583, 1827, 1922, 1559, 103, -1812, -2959, -3381, -4115, -5346, -6241, -6517, -6836, -7325, -7070, -5671, -3980, -2632, -1212, 416, 1545, 2029, 2721, 3873, 4486, 3853, 2558, 1367, 140, -1511, -3201, -4176, -4435, -4604, -4826, -4526, -3277, -1273, 1033, 3268, 5153, 6555, 7566, 8291, 8707, 8802, 8641, 8172, 7236, 6025, 5186, 5065, 5112, 4672, 4061, 4018, 4411, 4475, 4201, 4381, 5219, 5933, 6041, 6081, 6594, 7164, 7242, 7256, 7942, 8965, 9246, 8497, 7455, 6722, 6212, 5672, 5096, 4523, 3847, 2939, 1896, 1078, 711, 510, 32, -618, -954, -881, -725, -550, -174, 232, 317, 346, 972, 2091, 2632, 1822, 150, -1333, -2370, -3623, -5412, -6989, -7589, -7707, -8320, -9161, -9092, -8095, -7326, -7059, -6236, -4485, -3013, -2884, -3567, -3855, -3438, -3020, -3203, -3722, -3988, -4149, -4870, -5985, -6419, -5938, -5731, -6488, -7077, -6233, -4584, -3682, -3650, -3210, -1894, -702, -238, 374, 1861, 3225, 2995, 1364, -39, -159, 590, 1219, 1243, 796, 81, -897, -2012, -2722, -2552, -1780, -1244, -1426, -1992, -2282, -1957, -1106, -33, 849, 1193, 1125, 1166, 1357, 958, -374, -1744, -2182, -2082, -2432, -3180, -3502, -3405, -3767, -4734, -5222, -4519, -3440, -3193, -3761, -4280, -4380, -4335, -4362, -4466, -4602, -4632, -4584, -4856, -5566, -6076, -5944, -5709, -5957, -6356, -6367, -6145, -6086, -6181, -6305, -6508, -6712, -6648, -6312, -6036, -6008, -6031, -5871, -5588, -5368, -5178, -4807, -4227, -3642, -3235, -2991, -2829, -2761, -2855, -3009, -2866, -2242, -1678, -2022, -3207, -3994, -3467, -2377, -2220, -3065, -3396, -2500, -1578, -1580, -1586, -741, -9, -342, -859, -598, -249, -587, -970, -807, -868, -1737, -2380, -1806, -968, -1274, -2041, -1690, -722, -871, -1824, -1839, -1046, -952, -1424, -1223, -639, -710, -933, -223, 983, 1549, 1504, 1459, 1118, -96, -1524, -1936, -1586, -2086, -3962, -5811, -6360, -5941, -5454, -5242, -5433, -6100, -6684, -6207, -4343, -1639, 1314, 4504, 8287, 12759, 17240, 20701, 22698, 23284, 22090, 18722, 14079, 9867, 6464, 2913, -720, -2680, -1776, 1217, 5028, 9364, 14286, 19052, 22637, 24984, 27000, 29094, 30315, 29588, 27444, 25326, 23372, 20756, 17962, 16324, 15345, 13280, 10345, 8344, 7539, 6919, 6963, 8958, 12113, 14335, 15479, 17212, 19748, 21233, 20701, 19331, 17933, 15480, 11489, 7528, 4803, 2438, -178, -1826, -1673, -787, -252, 76, 235, -425, -1792, -2729, -2721, -2520, -2678, -2655, -2081, -1630, -1644, -1207, 111, 913, -97, -2246, -4310, -6263, -8325, -9896, -10610, -11047, -11529, -11417, -10332, -9039, -8353, -7979, -7174, -6023, -5119, -4406, -3370, -2100, -1041, -64, 1179, 2358, 2881, 2724, 2169, 1329, 290, -932, -2477, -4016, -4568, -3742, -2391, -1233, 208, 2469, 4949, 6764, 7999, 9230, 10375, 10926, 10944, 10946, 10911, 10372, 9505, 9157, 9467, 9433, 8300, 6623, 5348, 4539, 3655, 2714, 2356, 2905, 4037, 5406, 6940, 8413, 9374, 9736, 9895, 10075, 9921, 8858, 6741, 4076, 1631, -252, -1853, -3401, -4662, -5507, -6361, -7538, -8569, -8803, -8434, -8266, -8584, -8857, -8602, -8033, -7632, -7562, -7796, -8495, -9769, -11311, -12653, -13787, -15095, -16700, -18178, -19062, -19351, -19324, -19146, -18805, -18272, -17573, -16845, -16335, -16072, -15736, -15134, -14515, -14045, -13371, -12216, -11014, -10417, -10390, -10333, -9942, -9549, -9583, -10055, -10647, -11050, -11085, -10580, -9460, -7938, -6459, -5291, -4233, -2812, -919, 877, 1873, 2109, 2284, 2801, 3358, 3602, 3682, 3842, 3886, 3477, 2736, 2150, 1918, 1765, 1438, 1080, 1008, 1420, 2301, 3363, 4192, 4705, 5249, 5959, 6366, 6037, 5185, 4247, 3166, 1648, -99, -1456, -2240, -2935, -3917, -4856, -5258, -5226, -5301, -5674, -6014, -6056, -5961, -5979, -6013, -5796, -5339, -4987, -5090, -5684, -6480, -7171, -7865, -8885, -10071, -10837, -11172, -11791, -12820, -13264, -12452, -11219, -10764, -10993, -10881, -10124, -9452, -9354, -9325, -8788, -8090, -7939, -8160, -7844, -6776, -5891, -5947, -6469, -6561, -6193, -5987, -6074, -5985, -5565, -5308, -5544, -5749, -5063, -3387, -1639, -853, -1111, -1440, -822, 688, 2054, 2590, 2748, 3216, 3808, 3955, 3828, 4068, 4617, 4708, 4053, 3269, 2926, 2878, 2837, 3011, 3642, 4398, 4822, 5150, 5969, 7155, 7846, 7633, 7065, 6623, 6040, 5136, 4356, 3840, 3059, 2028, 1576, 1807, 1716, 968, 508, 841, 1133, 625, -261, -771, -842, -828, -822, -787, -897, -1192, -1294, -1047, -951, -1355, -1821, -1966, -2145, -2679, -3260, -3661, -4130, -4673, -4918, -4834, -4731, -4529, -3878, -2862, -1922, -1262, -762, -266, 242, 599, 603, 391, 298, 316, 259, 452, 1380, 2588, 3048, 2768, 2927, 4041, 5078, 4974, 4152, 3679, 3661, 3579, 3633, 4355, 5257, 5434, 5247, 5853, 7236, 8240, 8360, 8159, 8105, 8023, 7681, 7179, 6770, 6631, 6744, 6847, 6687, 6385, 6301, 6403, 6061, 4824, 3158, 1957, 1536, 1685, 2419, 4075, 6665, 9825, 13359, 17262, 21023, 23606, 24619, 24722, 24348, 22851, 19788, 15961, 12409, 9388, 7165, 6415, 7130, 8410, 9797, 11608, 13829, 16016, 18236, 20820, 23410, 25152, 25822, 25870, 25547, 24801, 23878, 23122, 21986, 19444, 15725, 12340, 9949, 7770, 5504, 4122, 4187, 5140, 6622, 8894, 11691, 14077, 15699, 16898, 17581, 17060, 15193, 12764, 10355, 7583, 4055, 486, -1952, -3077, -3698, -4395, -4971, -5167, -5184, -5317, -5468, -5301, -4675, -3741, -2741, -1853, -1196, -832, -843, -1360, -2375, -3645, -5057, -6862, -9211, -11658, -13520, -14512, -14702, -14175, -13041, -11625, -10360, -9507, -8996, -8445, -7580, -6626, -6044, -5813, -5485, -4948, -4560, -4401, -4043, -3335, -2854, -3208, -4238, -5238, -5851, -6385, -7229, -8161, -8475, -7715, -6144, -4448, -3078, -1914, -584, 935, 2231, 2937, 3070, 2865, 2547, 2178, 1568, 616, -194, -321, -189, -690, -1696, -2419, -2963, -3938, -4860, -4754, -3923, -3380, -3034, -2058, -603, 395, 746, 1071, 1467, 1238, 62, -1543, -3189, -4973, -6651, -7633, -8160, -8999, -9851, -9796, -9188, -9196, -9725, -9775, -9355, -9287, -9718, -10240, -10719, -11058, -11064, -11041, -11538, -12363, -12917, -13303, -14096, -15199, -15924, -16179, -16575, -17267, -17600, -17294, -17027, -17209, -17209, -16578, -16022, -16143, -16313, -15769, -14881, -14406, -14357, -14188, -13521, -12481, -11623, -11427, -11626, -11687, -11796, -12438, -13192, -13174, -12522, -12148, -12132, -11633, -10391, -9097, -8042, -6620, -4619, -3030, -2604, -2574, -1872, -840, -504, -881, -1240, -1291, -1183, -1029, -1097, -1648, -2215, -1947, -869, 105, 483, 723, 1347, 2212, 2873, 3170, 3173, 2980, 2856, 3035, 3117, 2418, 1261, 787, 1128, 1135, 308, -479, -641, -753, -1330, -2082, -2741, -3535, -4388, -4621, -4050, -3572, -3934, -4510, -4253, -3280, -2548, -2541, -3217, -4443, -5690, -6339, -6768, -7847, -9200, -9558, -8860, -8289, -8249, -8019, -7388, -7079, -7316, -7327, -6757, -6393, -6792, -7166, -6598, -5530, -4895, -4576, -3930, -3129, -2866, -3219, -3694, -3943, -3909, -3727, -3689, -3884, -3857, -3036, -1535, -100, 721, 1123, 1658, 2559, 3557, 4213, 4290, 3891, 3404, 3203, 3298, 3413, 3430, 3517, 3784, 4083, 4291, 4546, 4955, 5344, 5642, 6214, 7280, 8244, 8291, 7624, 7291, 7706, 8100, 7716, 6871, 6318, 6108, 5823, 5547, 5778, 6469, 7057, 7341, 7575, 7845, 8068, 8327, 8570, 8514, 8215, 8091, 8290, 8725, 9391, 9932, 9679, 8973, 9174, 10439, 11005, 9796, 8158, 7699, 7843, 7145, 5968, 5946, 7236, 8334, 8668, 9304, 10663, 11576, 11407, 11120, 11317, 10950, 9218, 7270, 6496, 6171, 4589, 1885, -178, -924, -1259, -1651, -1807, -2121, -3268, -4327, -3234, 1000, 7608, 14945, 21274, 25537, 27946, 29257, 29594, 28706, 26568, 22829, 16713, 8695, 1297, -3016, -4028, -2962, -215, 4857, 12093, 19684, 25626, 29328, 31364, 32301, 32299, 31407, 29698, 27378, 24931, 22841, 21173, 19799, 18737, 18043, 17754, 17949, 18405, 18301, 17230, 16091, 16011, 16776, 17425, 17921, 19066, 21059, 23068, 24005, 23237, 20830, 17487, 14089, 11094, 8484, 6204, 4354, 3043, 2259, 1968, 2075, 2277, 2314, 2372, 2627, 2358, 531, -2408, -4354, -3961, -2468, -1978, -2500, -2331, -1221, -975, -2450, -4327, -5877, -8258, -11738, -14429, -15308, -15913, -17482, -18741, -18135, -16320, -14834, -13795, -12585, -11719, -12054, -12739, -12116, -10377, -9222, -9141, -9218, -9218, -9732, -10747, -11792, -12954, -14445, -15966, -17220, -18103, -18139, -16901, -14952, -13255, -11770, -9721, -7050, -4797, -3914, -4352, -5301, -6006, -6193, -6082, -6126, -6523, -6839, -6396, -5219, -4226, -4245, -5098, -5941, -6277, -6342, -6550, -6811, -6511, -5126, -2818, -391, 1391, 2500, 3363, 3938, 3597, 2187, 407, -1204, -2784, -4288, -5136, -5164, -4877, -4436, -3461, -2165, -1598, -2214, -3094, -3274, -3172, -3837, -5228, -6222, -6212, -5745, -5585, -5999, -6852, -7767, -8283, -8496, -9214, -10969, -13155, -14702, -15352, -15643, -15890, -15870, -15598, -15560, -15945, -16348, -16486, -16646, -17008, -17275, -17280, -17342, -17616, -17609, -16875, -15824, -15312, -15571, -16095, -16492, -16893, -17551, -18577, -19837, -20734, -20509, -19173, -17557, -16104, -14412, -12251, -10124, -8393, -6753, -5130, -4209, -4445, -5099, -5140, -4772, -5012, -5964, -6615, -6421, -6006, -6035, -6299, -6208, -5454, -4062, -2287, -552, 860, 2130, 3638, 5348, 6588, 6630, 5493, 4008, 2928, 2125, 928, -823, -2394, -2951, -2446, -1522, -730, -181, 173, 361, 513, 755, 866, 412, -482, -928, -388, 321, 19, -1003, -1276, -464, -60, -1214, -3144, -4442, -4948, -5394, -6004, -6438, -6650, -6828, -6703, -5787, -4381, -3544, -3707, -4015, -3644, -3137, -3502, -4437, -4737, -4307, -4251, -4782, -4625, -3116, -1411, -783, -941, -994, -1084, -1888, -3135, -3934, -4266, -4791, -5250, -4514, -2444, -294, 1153, 2581, 4633, 6519, 7005, 6121, 4994, 4218, 3314, 1810, 99, -999, -1044, -205, 976, 2017, 2931, 4113, 5632, 6977, 7677, 7835, 7837, 7881, 7980, 8192, 8565, 8955, 9091, 8886, 8602, 8492, 8373, 7758, 6484, 5029, 4054, 3758, 3888, 4342, 5381, 7060, 8859, 10287, 11471, 12682, 13536, 13262, 11670, 9378, 7153, 5382, 4154, 3423, 3019, 2897, 3502, 5187, 7217, 8440, 8992, 9816, 10530, 9764, 7774, 6340, 5764, 4450, 2092, 818, 1968, 3855, 4408, 4352, 5645, 7907, 8936, 8308, 7745, 7925, 7534, 5930, 4424, 4040, 3791, 2316, -24, -1864, -2863, -3781, -5135, -6789, -8413, -9313, -8448, -5544, -1420, 3465, 9602, 16765, 23035, 26599, 27707, 27722, 26814, 23755, 17925, 10434, 3021, -3245, -7711, -9508, -8057, -3841, 2120, 9264, 17182, 24590, 29741, 32087, 32697, 32767, 32364, 30939, 28248, 24624, 20872, 17892, 16033, 14952, 14361, 14528, 15669, 17275, 18593, 19486, 20481, 21893, 23471, 24832, 25946, 26980, 27834, 28127, 27507, 25889, 23444, 20518, 17454, 14390, 11377, 8812, 7451, 7560, 8432, 9273, 10234, 11810, 13521, 14172, 13380, 11829, 10025, 7713, 4930, 2659, 1666, 1370, 805, 165, 333, 1216, 1700, 1066, -441, -2382, -4621, -7145, -9809, -12313, -14239, -15306, -15522, -15049, -14068, -12846, -11739, -10891, -10187, -9604, -9420, -9782, -10344, -10746, -11350, -12723, -14498, -15629, -15984, -16588, -17975, -19391, -20015, -20043, -19967, -19594, -18446, -16691, -14987, -13576, -12012, -10019, -8204, -7469, -7850, -8489, -8837, -9247, -10116, -11135, -11765, -11973, -11976, -11667, -10855, -9765, -8927, -8537, -8230, -7519, -6408, -5415, -4909, -4574, -3814, -2560, -1353, -690, -613, -888, -1277, -1701, -2296, -3225, -4334, -5225, -5662, -5672, -5317, -4676, -3917, -3139, -2337, -1695, -1528, -1773, -2041, -2291, -2915, -4009, -5125, -5891, -6425, -7002, -7681, -8376, -9012, -9560, -10018, -10448, -10980, -11649, -12290, -12652, -12663, -12589, -12802, -13384, -14019, -14322, -14302, -14415, -15065, -16148, -17125, -17713, -18198, -18951, -19802, -20244, -20251, -20413, -21098, -21825, -21869, -21253, -20666, -20477, -20333, -19850, -19147, -18505, -17923, -17336, -16866, -16580, -16265, -15765, -15325, -15297, -15572, -15604, -15079, -14295, -13782, -13700, -13690, -13226, -12104, -10685, -9528, -8710, -7734, -6183, -4299, -2670, -1593, -880, -212, 417, 662, 289, -401, -817, -801, -779, -1063, -1271, -778, 409, 1647, 2569, 3443, 4524, 5560, 6301, 6897, 7494, 7876, 7845, 7610, 7495, 7442, 7030, 5998, 4684, 3824, 3752, 3893, 3393, 2268, 1578, 2101, 3214, 3759, 3700, 3945, 4637, 4934, 4559, 4214, 4111, 3476, 2001, 597, 70, -72, -694, -1569, -1810, -1382, -1074, -1222, -1491, -1675, -1767, -1744, -1992, -2976, -3993, -3790, -2834, -2910, -4116, -4521, -3362, -2233, -2402, -2985, -2757, -2160, -2278, -2879, -2862, -2189, -1942, -2519, -3084, -2994, -2661, -2649, -2819, -2720, -2277, -1798, -1536, -1375, -930, -3, 1133, 2031, 2527, 2767, 2905, 2916, 2670, 2182, 1787, 1746, 1647, 876, -90, 166, 2035, 4058, 4804, 4612, 4751, 5615, 6612, 7238, 7409, 7013, 6067, 5259, 5397, 6356, 7474, 8605, 9599, 9545, 8243, 7455, 8603, 10250, 10095, 8388, 7179, 7138, 7333, 7449, 8172, 9442, 10065, 9454, 8508, 8185, 8247, 8075, 7758, 7569, 7365, 7101, 7143, 7651, 8469, 9604, 10962, 11931, 11934, 11063, 9761, 8439, 7442, 6596, 5053, 2618, 688, 706, 2104, 3167, 3723, 5277, 8230, 10709, 11251, 11036, 11846, 13004, 12389, 9701, 6668, 4346, 2165, -384, -2738, -4335, -5639, -7343, -9080, -9620, -8389, -6164, -3921, -1555, 1776, 6300, 11147, 15353, 18743, 21434, 22873, 22310, 20039, 16852, 12505, 6449, -21, -4442, -6181, -6625, -6330, -4058, 975, 7742, 14652, 20769, 25581, 28665, 30085, 30360, 29651, 27718, 24934, 22324, 20148, 17707, 15168, 13877, 14206, 14920, 15342, 16249, 18036, 19836, 21084, 22313, 23904, 25333, 26087, 26473, 27063, 27818, 28073, 27335, 25723, 23742, 21777, 19806, 17536, 15061, 13117, 12176, 11686, 11029, 10780, 11767, 13402, 14280, 14285, 14540, 15294, 15330, 13906, 12004, 10739, 9657, 7796, 5566, 4085, 3243, 1951, -7, -1711, -2612, -3253, -4487, -6435, -8300, -9162, -9079, -9029, -9567, -9986, -9365, -7994, -7094, -7274, -7966, -8523, -9193, -10570, -12555, -14489, -16069, -17554, -19136, -20534, -21314, -21330, -20866, -20367, -20002, -19584, -18948, -18213, -17511, -16788, -16057, -15574, -15518, -15666, -15632, -15399, -15379, -15961, -16955, -17683, -17746, -17524, -17575, -17727, -17308, -16177, -14943, -14063, -13281, -12226, -11085, -10316, -9920, -9429, -8666, -8067, -8042, -8299, -8196, -7656, -7260, -7360, -7601, -7520, -7239, -7129, -7030, -6402, -5203, -4104, -3572, -3244, -2578, -1738, -1305, -1403, -1648, -1878, -2356, -3191, -3933, -4099, -3957, -4300, -5237, -5733, -5060, -4096, -4169, -5066, -5491, -5193, -5155, -5725, -6055, -5731, -5641, -6545, -7748, -8099, -7741, -7863, -8941, -10205, -10949, -11464, -12324, -13421, -14204, -14542, -14879, -15526, -16091, -15924, -15045, -14367, -14746, -15900, -16655, -16410, -15896, -16100, -16886, -17441, -17645, -17992, -18418, -18232, -17408, -16835, -17035, -17390, -17071, -16236, -15666, -15581, -15482, -15015, -14370, -13813, -13374, -12898, -12187, -11245, -10433, -9999, -9574, -8702, -7726, -7394, -7728, -7947, -7547, -6822, -6307, -6122, -5938, -5338, -4173, -2674, -1292, -332, 257, 736, 1252, 1736, 2093, 2339, 2506, 2561, 2602, 2977, 3857, 4794, 5216, 5291, 5647, 6233, 6353, 5917, 5733, 6178, 6527, 6064, 5233, 5072, 5857, 6845, 7284, 7211, 7116, 7178, 7202, 7123, 7128, 7164, 6775, 5746, 4680, 4471, 5121, 5580, 5079, 4183, 4050, 4806, 5343, 4832, 3792, 3158, 2896, 2328, 1492, 1113, 1303, 1338, 850, 347, 346, 698, 931, 778, 299, -281, -831, -1387, -1895, -2163, -2316, -2754, -3354, -3410, -2747, -2152, -2181, -2331, -1995, -1554, -1720, -2250, -2276, -1758, -1597, -2130, -2541, -2126, -1263, -679, -527, -631, -938, -1330, -1480, -1226, -818, -571, -476, -260, 354, 1530, 3085, 4333, 4604, 4188, 4137, 4839, 5409, 4999, 4095, 3821, 4356, 4870, 4901, 4885, 5203, 5772, 6693, 8065, 9085, 8847, 8057, 8160, 8942, 8934, 7976, 7270, 7085, 6561, 5736, 5777, 6844, 7621, 7581, 7899, 9025, 9369, 8020, 6790, 7429, 8601, 8086, 6386, 5752, 6734, 7927, 8406, 8528, 8620, 8371, 7782, 7606, 8219, 8692, 7902, 6328, 5654, 6478, 7433, 7119, 6055, 5836, 6772, 7450, 6854, 5868, 5950, 7003, 7598, 7039, 6150, 5908, 6190, 6180, 5479, 4397, 3387, 2446, 1161, -715, -2946, -5088, -6744, -7419, -6638, -4574, -2031, 625, 4016, 8673, 13789, 17683, 19373, 19238, 18079, 15942, 12269, 7214, 2100, -1889, -4883, -7247, -8083, -6092, -1579, 3760, 8768, 13387, 17729, 21543, 24410, 25855, 25639, 24162, 22110, 19655, 16737, 14006, 12502, 12268, 12083, 11195, 10523, 11399, 13612, 15693, 16931, 18038, 19845, 22284, 24748, 26751, 28008, 28411, 28106, 27290, 25866, 23597, 20651, 17629, 14929, 12666, 11295, 11383, 12660, 14207, 15836, 18103, 20907, 23150, 24114, 24064, 23284, 21496, 18769, 16060, 14188, 12776, 10968, 8866, 7367, 6792, 6543, 6199, 5960, 5825, 5158, 3654, 2109, 1482, 1559, 1315, 432, -366, -497, -301, -462, -1160, -2100, -3053, -4166, -5689, -7557, -9365, -10812, -11976, -13067, -14049, -14720, -15053, -15262, -15487, -15606, -15511, -15354, -15332, -15368, -15266, -15070, -15038, -15314, -15747, -16159, -16600, -17387, -18717, -20269, -21412, -21915, -22124, -22268, -22064, -21213, -19878, -18395, -16934, -15607, -14681, -14353, -14523, -14939, -15446, -15948, -16314, -16555, -16849, -17149, -17005, -16172, -15053, -14095, -13245, -12423, -11921, -11800, -11426, -10350, -9165, -8735, -8900, -8725, -7955, -7315, -7227, -7227, -6968, -6880, -7286, -7680, -7535, -7123, -6981, -7025, -6802, -6257, -5714, -5251, -4648, -3928, -3411, -3146, -2850, -2450, -2244, -2470, -3039, -3697, -4160, -4328, -4524, -5195, -6258, -7121, -7362, -7078, -6624, -6354, -6388, -6419, -6021, -5321, -4958, -5259, -5906, -6572, -7376, -8439, -9432, -10011, -10391, -10966, -11579, -11822, -11864, -12192, -12673, -12710, -12328, -12270, -12810, -13272, -13010, -12296, -11843, -11881, -12126, -12386, -12681, -13033, -13490, -14206, -15067, -15586, -15529, -15286, -15230, -15047, -14237, -13019, -12107, -11636, -11121, -10496, -10208, -10234, -10090, -9967, -10536, -11507, -11745, -11038, -10377, -10264, -9990, -9006, -7867, -7229, -6793, -5982, -5056, -4671, -4669, -4295, -3373, -2428, -1763, -1200, -636, -195, 157, 607, 1021, 1066, 836, 760, 852, 816, 947, 1861, 3200, 3911, 3984, 4501, 5677, 6380, 6050, 5697, 6180, 6762, 6409, 5670, 5861, 6873, 7312, 6755, 6341, 6807, 7335, 6927, 5888, 5234, 5272, 5420, 5251, 5086, 5431, 6174, 6753, 6960, 7147, 7519, 7742, 7403, 6519, 5420, 4396, 3549, 2754, 1833, 975, 681, 1031, 1457, 1556, 1641, 2109, 2706, 2909, 2624, 2117, 1492, 634, -436, -1418, -2019, -2235, -2244, -2078, -1643, -1058, -719, -808, -1021, -1012, -931, -1235, -2095, -3092, -3447, -2734, -1550, -1044, -1454, -1679, -852, 320, 575, -52, -435, -172, -37, -384, -424, 292, 919, 776, 516, 794, 1029, 610, 125, 322, 913, 1319, 1703, 2514, 3676, 4863, 5976, 6859, 7069, 6527, 5930, 5839, 5762, 5003, 4068, 4076, 4917, 5265, 4691, 4568, 6223, 9010, 11057, 11393, 10554, 9520, 8961, 9199, 9889, 9902, 8511, 6659, 6145, 7441, 9096, 9565, 8988, 8644, 9037, 9421, 9255, 9118, 9428, 9274, 7844, 6324, 6765, 9123, 11062, 11022, 10026, 9750, 10127, 10042, 9437, 9177, 9212, 8555, 7135, 6260, 6766, 7832, 8173, 7508, 6288, 4785, 3223, 2137, 1576, 437, -2217, -5468, -7254, -6516, -3836, -418, 2815, 5640, 8612, 12190, 15720, 17942, 18404, 17440, 15055, 10929, 5541, 316, -3565, -5959, -7153, -7010, -5124, -1566, 3017, 7991, 13031, 17772, 21495, 23466, 23590, 22535, 21074, 19411, 17230, 14462, 11886, 10577, 10597, 10719, 10237, 10224, 11795, 13992, 15171, 15737, 17332, 19997, 22337, 23892, 25364, 26825, 27453, 26847, 25387, 23419, 21008, 18392, 16072, 14300, 12884, 11745, 11383, 12422, 14665, 17193, 19394, 21317, 22758, 23034, 22132, 21075, 20395, 19304, 17092, 14436, 12462, 11276, 10320, 9408, 8719, 8084, 7108, 5834, 4828, 4422, 4231, 3617, 2469, 1452, 1488, 2797, 4355, 4702, 3540, 2076, 1418, 1111, -53, -2279, -4578, -6288, -7730, -9192, -10271, -10794, -11321, -12101, -12474, -12056, -11599, -11894, -12552, -12673, -12185, -11738, -11637, -11572, -11379, -11504, -12377, -13764, -15073, -16168, -17420, -19014, -20631, -21849, -22466, -22294, -21175, -19351, -17450, -15837, -14389, -13014, -12084, -12035, -12866, -14176, -15599, -17010, -18417, -19737, -20692, -20977, -20494, -19422, -18088, -16782, -15589, -14402, -13194, -12221, -11666, -11307, -10897, -10585, -10508, -10387, -10081, -10008, -10413, -10896, -11172, -11562, -12169, -12442, -12058, -11450, -11051, -10635, -9817, -8681, -7592, -6714, -6044, -5637, -5499, -5377, -5048, -4731, -4864, -5472, -6081, -6370, -6520, -6777, -7056, -7198, -7336, -7620, -7809, -7560, -6948, -6310, -5678, -4844, -3894, -3265, -3158, -3310, -3515, -4015, -5058, -6349, -7319, -7859, -8397, -9222, -10082, -10516, -10397, -9938, -9390, -8841, -8320, -7898, -7592, -7280, -6842, -6360, -6097, -6235, -6727, -7393, -8098, -8895, -9964, -11382, -12860, -13858, -14040, -13521, -12630, -11565, -10365, -9059, -7700, -6322, -5075, -4360, -4566, -5628, -7042, -8389, -9627, -10828, -11874, -12539, -12697, -12331, -11453, -10163, -8715, -7410, -6437, -5760, -5179, -4543, -3919, -3565, -3698, -4231, -4681, -4539, -3996, -3966, -4939, -6075, -6166, -5220, -4298, -4032, -4061, -3765, -2878, -1486, -9, 968, 1230, 1186, 1327, 1611, 1650, 1334, 893, 495, 111, -117, 179, 1063, 1974, 2354, 2402, 2741, 3424, 3906, 3974, 3915, 3732, 3180, 2639, 2889, 3873, 4710, 5015, 5255, 5770, 6323, 6642, 6649, 6173, 5091, 3845, 3192, 3238, 3309, 3057, 3022, 3659, 4587, 5348, 6146, 7156, 7838, 7613, 6735, 5929, 5508, 5227, 4736, 3960, 3114, 2556, 2518, 2932, 3434, 3644, 3485, 3253, 3282, 3585, 3873, 3880, 3608, 3265, 3056, 3060, 3192, 3166, 2639, 1568, 437, -99, 96, 440, 311, -81, 103, 1189, 2525, 3456, 4159, 4990, 5584, 5313, 4285, 3156, 2161, 981, -463, -1696, -2303, -2318, -1835, -761, 740, 2172, 3327, 4364, 5160, 5355, 5077, 4798, 4518, 3916, 3148, 2693, 2616, 2718, 3073, 3751, 4306, 4174, 3482, 2917, 2842, 2935, 2868, 2866, 3349, 4200, 4932, 5469, 6249, 7376, 8185, 8024, 7064, 5948, 4977, 4052, 3123, 2317, 1889, 2154, 3174, 4477, 5542, 6475, 7761, 9434, 10855, 11269, 10456, 9027, 8041, 7960, 8021, 7142, 5380, 3998, 3987, 4997, 5947, 6222, 5992, 5675, 5602, 6063, 7135, 8297, 8721, 8227, 7648, 7745, 8066, 7456, 5575, 3243, 1219, -591, -2535, -4378, -5390, -5046, -3382, -770, 2667, 7158, 12535, 17596, 20722, 21281, 20022, 17946, 15076, 10616, 4289, -2635, -7926, -10112, -9619, -7979, -5878, -2240, 4152, 12339, 19479, 23570, 24927, 24824, 23840, 21914, 18922, 14919, 10497, 6863, 4775, 3741, 3121, 3401, 5456, 8980, 12481, 14812, 16178, 17634, 19837, 22301, 23937, 24226, 23544, 22514, 21589, 20937, 19979, 17646, 13964, 10676, 9231, 9133, 9282, 9778, 11200, 13324, 15637, 18102, 20668, 22808, 24019, 24025, 22610, 19928, 16855, 14345, 12495, 10799, 9112, 7887, 7468, 7636, 7959, 8260, 8492, 8421, 7813, 6771, 5651, 4700, 3990, 3578, 3499, 3645, 3881, 4164, 4461, 4530, 4027, 2827, 1031, -1227, -3713, -5925, -7459, -8497, -9576, -10767, -11463, -11134, -10019, -8908, -8320, -8151, -8025, -7797, -7596, -7576, -7838, -8471, -9539, -10916, -12339, -13648, -14984, -16588, -18445, -20143, -21166, -21305, -20759, -19792, -18454, -16690, -14666, -12801, -11444, -10703, -10577, -11083, -12228, -13935, -15973, -17996, -19651, -20805, -21537, -21896, -21761, -20969, -19585, -17925, -16330, -14965, -13790, -12729, -11803, -11154, -10912, -10969, -11083, -11243, -11750, -12745, -13926, -14866, -15436, -15718, -15790, -15697, -15418, -14747, -13495, -11854, -10340, -9323, -8711, -8186, -7637, -7296, -7443, -8068, -8839, -9434, -9794, -10045, -10253, -10345, -10279, -10189, -10205, -10252, -10126, -9760, -9248, -8702, -8147, -7536, -6793, -5907, -5060, -4515, -4375, -4537, -4924, -5579, -6529, -7669, -8810, -9751, -10311, -10407, -10168, -9788, -9159, -7981, -6436, -5221, -4566, -4020, -3462, -3373, -3740, -3934, -4047, -4937, -6600, -7913, -8296, -8373, -8732, -9149, -9313, -9348, -9321, -8883, -7750, -6233, -4953, -4196, -3787, -3513, -3375, -3375, -3484, -3962, -5266, -7218, -8799, -9340, -9364, -9612, -9863, -9539, -8732, -7815, -6709, -5328, -4156, -3597, -3359, -3000, -2630, -2670, -3245, -4105, -4925, -5523, -5890, -6097, -6198, -6249, -6201, -5814, -4944, -3973, -3420, -3101, -2393, -1378, -825, -922, -992, -658, -319, -289, -285, 1, 471, 863, 1028, 937, 703, 542, 513, 393, -2, -450, -469, 99, 902, 1552, 2137, 2990, 4105, 5052, 5469, 5402, 5099, 4710, 4279, 3853, 3447, 3047, 2756, 2803, 3233, 3730, 3981, 4133, 4573, 5281, 5778, 5806, 5682, 5797, 6137, 6477, 6732, 6908, 6925, 6718, 6371, 6013, 5666, 5219, 4558, 3714, 2939, 2638, 3090, 4115, 5192, 5981, 6628, 7420, 8330, 8993, 8943, 7882, 6009, 4022, 2491, 1361, 364, -371, -524, -25, 1010, 2427, 3880, 4911, 5392, 5507, 5314, 4679, 3625, 2400, 1252, 378, -109, -282, -295, -108, 459, 1308, 1984, 2155, 1961, 1726, 1490, 1051, 413, -69, -97, 223, 578, 862, 1199, 1630, 1989, 2094, 1909, 1491, 874, 98, -710, -1398, -1826, -1791, -1072, 159, 1216, 1708, 2206, 3415, 4850, 5252, 4326, 3100, 2444, 2117, 1593, 999, 679, 454, 55, -24, 1066, 3158, 4803, 4822, 3731, 3079, 3622, 4621, 4922, 4159, 2970, 2474, 3331, 4899, 5738, 5357, 4773, 4867, 5156, 4915, 4487, 4493, 4629, 4326, 4023, 4642, 6027, 7029, 7205, 7362, 8023, 8364, 7453, 5814, 4752, 4491, 4090, 3157, 2447, 2556, 3170, 4027, 5522, 7628, 9244, 9386, 8415, 7342, 6394, 4921, 2445, -729, -3837, -6097, -6900, -5984, -3567, -50, 4326, 9261, 14078, 18114, 21085, 22639, 22000, 18619, 12935, 6258, 114, -4400, -7146, -8671, -9087, -7631, -3705, 2266, 9295, 16282, 21830, 24705, 24948, 23710, 21951, 19838, 17095, 13377, 8868, 4890, 3065, 3625, 5432, 7547, 9635, 11425, 13005, 15153, 18093, 20697, 21991, 22497, 23130, 23653, 23259, 21947, 20457, 19202, 17875, 16049, 13781, 11615, 10140, 9671, 10223, 11621, 13595, 15924, 18448, 20945, 23016, 24140, 23937, 22429, 20086, 17506, 15097, 13116, 11729, 10801, 9982, 9281, 9191, 9915, 10842, 11117, 10490, 9282, 7911, 6630, 5490, 4470, 3744, 3671, 4336, 5323, 6111, 6437, 6267, 5684, 4842, 3723, 2001, -542, -3459, -5912, -7493, -8513, -9352, -9895, -9840, -9252, -8466, -7608, -6673, -5889, -5657, -6010, -6524, -6880, -7288, -8184, -9679, -11458, -13165, -14707, -16183, -17638, -18965, -19924, -20323, -20071, -19128, -17522, -15537, -13692, -12290, -11240, -10523, -10522, -11535, -13332, -15386, -17371, -19144, -20599, -21680, -22370, -22583, -22153, -21052, -19474, -17825, -16524, -15682, -14991, -14131, -13249, -12832, -13072, -13649, -14135, -14451, -14791, -15292, -15919, -16599, -17252, -17711, -17733, -17219, -16345, -15413, -14638, -14036, -13471, -12786, -11981, -11255, -10871, -10899, -11142, -11293, -11223, -11050, -11019, -11264, -11683, -12017, -12089, -11981, -11905, -11970, -12080, -12084, -11862, -11339, -10491, -9416, -8356, -7528, -6948, -6465, -6008, -5723, -5832, -6372, -7121, -7780, -8228, -8592, -9027, -9491, -9760, -9631, -9071, -8239, -7410, -6740, -6066, -5133, -4013, -3053, -2449, -2162, -2171, -2472, -2923, -3467, -4375, -5871, -7607, -8830, -9131, -8776, -8280, -7785, -6936, -5396, -3362, -1474, -203, 437, 597, 258, -682, -2145, -3813, -5312, -6457, -7329, -8041, -8420, -8085, -6971, -5571, -4454, -3667, -2869, -2000, -1455, -1502, -1857, -2084, -2199, -2543, -3127, -3530, -3544, -3528, -3871, -4419, -4778, -4839, -4719, -4481, -4203, -3973, -3632, -2933, -2024, -1302, -816, -346, 51, 95, -194, -517, -787, -1164, -1597, -1713, -1310, -711, -417, -478, -437, 24, 622, 800, 399, -170, -406, -171, 316, 817, 1283, 1822, 2537, 3406, 4255, 4838, 4956, 4553, 3769, 2908, 2267, 1907, 1605, 1149, 698, 702, 1407, 2571, 3740, 4662, 5376, 5993, 6540, 6968, 7157, 6939, 6259, 5340, 4556, 4080, 3756, 3370, 2960, 2793, 3067, 3711, 4438, 4982, 5320, 5690, 6289, 6913, 7084, 6681, 6153, 5872, 5606, 4989, 4105, 3296, 2712, 2377, 2290, 2314, 2294, 2341, 2617, 2986, 3247, 3447, 3645, 3707, 3590, 3418, 3148, 2622, 1978, 1522, 1238, 865, 331, -218, -611, -674, -365, -5, 25, -179, -170, 175, 511, 579, 551, 662, 823, 800, 564, 245, -26, -104, 16, -117, -979, -2085, -2205, -1011, 220, 184, -752, -1176, -549, 408, 1034, 1292, 1018, -53, -1240, -1278, -188, 585, 259, -344, -243, 504, 1327, 1876, 2050, 1935, 1858, 2000, 1979, 1352, 556, 552, 1322, 1694, 1149, 709, 1355, 2629, 3504, 3676, 3344, 2713, 2189, 2255, 2698, 2709, 2091, 1675, 2068, 2715, 2890, 2986, 3833, 5099, 5587, 5064, 4615, 4904, 5223, 4771, 3965, 3660, 3741, 3465, 2868, 2791, 3481, 4145, 4226, 4238, 4780, 5456, 5575, 5390, 5624, 6161, 6244, 5754, 5280, 5064, 4717, 3804, 2136, -177, -2502, -3967, -4334, -4171, -3892, -3008, -660, 3343, 8194, 12700, 16098, 18272, 19250, 18812, 16743, 13204, 8572, 3257, -2007, -6067, -7947, -7445, -5083, -1719, 1997, 6235, 11577, 17441, 21871, 23628, 23327, 21900, 19509, 16606, 14153, 12235, 10141, 8047, 6904, 6882, 7537, 8871, 10852, 12844, 14517, 16357, 18476, 20248, 21431, 22503, 23664, 24571, 24883, 24336, 22755, 20553, 18560, 16971, 15221, 13128, 11425, 10895, 11684, 13480, 15835, 18276, 20488, 22341, 23688, 24417, 24486, 23683, 21775, 19226, 17031, 15489, 14107, 12964, 12716, 13125, 13154, 12634, 12278, 12075, 11280, 9859, 8475, 7347, 6295, 5631, 5889, 6873, 7866, 8660, 9557, 10361, 10310, 9245, 7805, 6146, 3616, 206, -2908, -4843, -5918, -6748, -7378, -7570, -7154, -6100, -4763, -3775, -3350, -3172, -3105, -3375, -3982, -4626, -5255, -6209, -7695, -9542, -11427, -13068, -14407, -15660, -17049, -18342, -18880, -18265, -16811, -15155, -13586, -12004, -10469, -9420, -9247, -9859, -10966, -12517, -14578, -16848, -18747, -20028, -20899, -21454, -21447, -20748, -19581, -18223, -16849, -15692, -14885, -14361, -14081, -14126, -14344, -14376, -14257, -14368, -14719, -14895, -14806, -14868, -15337, -15994, -16502, -16733, -16717, -16570, -16386, -16137, -15697, -14986, -14016, -12894, -11852, -11129, -10764, -10604, -10582, -10768, -11139, -11564, -11997, -12470, -12855, -12885, -12529, -12156, -12131, -12319, -12290, -11809, -10935, -9863, -8965, -8612, -8582, -8142, -7108, -6207, -6071, -6517, -7117, -7722, -8207, -8435, -8629, -9112, -9680, -9727, -9001, -7814, -6660, -5829, -5258, -4627, -3762, -2903, -2388, -2325, -2695, -3424, -4209, -4649, -4777, -5008, -5533, -6109, -6436, -6365, -5846, -5035, -4317, -3868, -3382, -2537, -1591, -1112, -1215, -1488, -1684, -2059, -2813, -3620, -4068, -4316, -4826, -5540, -5822, -5343, -4533, -3946, -3603, -3275, -3000, -2907, -2867, -2717, -2569, -2633, -2920, -3270, -3482, -3416, -3177, -3157, -3642, -4393, -4835, -4659, -4156, -3908, -4187, -4639, -4648, -4011, -3133, -2528, -2286, -2155, -2013, -1981, -2067, -2028, -1809, -1791, -2277, -2942, -3151, -2712, -2048, -1706, -1878, -2296, -2513, -2322, -1896, -1514, -1287, -1216, -1236, -1073, -387, 726, 1629, 1817, 1517, 1366, 1604, 1845, 1623, 927, 95, -577, -956, -892, -302, 563, 1229, 1531, 1850, 2616, 3712, 4590, 4863, 4607, 4159, 3813, 3666, 3617, 3510, 3256, 2895, 2615, 2686, 3162, 3695, 3953, 4057, 4276, 4541, 4699, 4931, 5376, 5746, 5769, 5580, 5326, 4944, 4564, 4447, 4443, 4183, 3753, 3544, 3578, 3622, 3750, 4154, 4581, 4567, 4168, 3992, 4390, 4893, 4680, 3645, 2682, 2623, 3175, 3374, 2889, 2249, 1927, 1923, 2072, 2164, 1942, 1470, 1137, 990, 637, 112, 13, 507, 959, 816, 223, -316, -425, -74, 295, 137, -507, -1021, -1000, -618, -254, -167, -423, -775, -863, -744, -860, -1265, -1420, -1078, -821, -1240, -1939, -2006, -1320, -672, -608, -874, -1093, -1186, -1053, -676, -487, -850, -1298, -1110, -423, 8, -59, -201, -127, 65, 345, 706, 689, -205, -1424, -1685, -768, 78, 6, -281, 159, 1131, 1932, 2410, 2665, 2465, 1753, 1176, 1270, 1524, 1129, 365, 180, 659, 1063, 1264, 1873, 2914, 3574, 3526, 3416, 3723, 4010, 3848, 3615, 3666, 3514, 2768, 2156, 2526, 3340, 3361, 2501, 1889, 2217, 2939, 3237, 3062, 2937, 3179, 3666, 4133, 4342, 4105, 3404, 2430, 1375, 357, -523, -1239, -1862, -2215, -1715, 58, 2777, 5681, 8302, 10612, 12544, 13629, 13264, 11436, 9011, 6802, 4515, 1518, -1478, -2795, -1948, -65, 1989, 4639, 8355, 12565, 16065, 17960, 18191, 17503, 16637, 15488, 13599, 11328, 9645, 8940, 8877, 9209, 9942, 11015, 12348, 13963, 15617, 16829, 17493, 17933, 18390, 18930, 19632, 20356, 20739, 20755, 20667, 20345, 19533, 18583, 17871, 16909, 15368, 14280, 14771, 16377, 17838, 18867, 19983, 21387, 22830, 23854, 23905, 22833, 21179, 19424, 17573, 15933, 15137, 15027, 14782, 14459, 14878, 15959, 16660, 16538, 15945, 15003, 13663, 12287, 11213, 10185, 9024, 8247, 8449, 9436, 10504, 11181, 11392, 11097, 10259, 9081, 7811, 6337, 4372, 2066, -21, -1470, -2148, -2091, -1664, -1430, -1483, -1375, -932, -561, -583, -912, -1461, -2264, -3165, -3914, -4596, -5523, -6795, -8203, -9507, -10620, -11566, -12402, -13122, -13546, -13407, -12696, -11825, -11153, -10525, -9682, -8955, -8992, -9878, -11127, -12472, -14065, -15895, -17523, -18562, -18984, -18996, -18751, -18299, -17637, -16743, -15664, -14625, -13948, -13751, -13873, -14111, -14410, -14744, -15067, -15398, -15839, -16394, -16909, -17256, -17447, -17514, -17432, -17219, -16971, -16667, -16077, -15099, -14040, -13302, -12938, -12777, -12749, -12889, -13134, -13422, -13772, -14152, -14396, -14384, -14176, -13860, -13406, -12791, -12144, -11689, -11492, -11395, -11253, -11120, -11116, -11158, -11014, -10590, -10025, -9437, -8851, -8341, -8009, -7823, -7732, -7832, -8142, -8453, -8636, -8782, -8792, -8352, -7569, -6975, -6715, -6316, -5479, -4549, -3992, -3880, -4027, -4301, -4579, -4698, -4618, -4502, -4462, -4419, -4359, -4393, -4396, -4047, -3505, -3325, -3509, -3425, -2865, -2305, -1984, -1630, -1202, -1053, -1310, -1719, -2099, -2472, -2891, -3444, -4223, -5006, -5228, -4623, -3668, -3032, -2692, -2051, -976, -170, -246, -860, -1270, -1487, -2135, -3216, -3937, -3982, -3929, -4130, -4235, -4105, -4018, -3857, -3296, -2737, -2807, -3169, -3056, -2605, -2518, -2774, -2749, -2316, -1995, -2153, -2605, -2976, -3155, -3315, -3593, -3877, -3951, -3740, -3311, -2737, -2111, -1562, -1124, -752, -560, -747, -1206, -1569, -1756, -2049, -2498, -2740, -2542, -2060, -1463, -699, 198, 949, 1277, 1217, 1054, 1001, 1007, 858, 501, 165, 138, 421, 761, 1060, 1534, 2299, 2995, 3174, 2954, 2844, 3023, 3224, 3244, 3190, 3233, 3418, 3732, 4139, 4576, 4966, 5206, 5178, 4892, 4621, 4680, 5012, 5186, 4959, 4688, 4903, 5600, 6226, 6372, 6167, 5940, 5760, 5502, 5158, 4886, 4806, 4928, 5206, 5522, 5720, 5842, 6090, 6411, 6426, 5984, 5382, 4872, 4370, 3849, 3494, 3349, 3242, 3171, 3340, 3738, 4046, 4019, 3749, 3439, 3131, 2745, 2269, 1772, 1330, 1033, 898, 726, 363, 62, 71, 67, -352, -836, -819, -559, -727, -1258, -1532, -1430, -1374, -1510, -1606, -1648, -1926, -2475, -2885, -2857, -2622, -2623, -2965, -3343, -3339, -2760, -1900, -1464, -1880, -2692, -3035, -2715, -2400, -2730, -3580, -4319, -4492, -4098, -3426, -2838, -2593, -2665, -2736, -2556, -2246, -2134, -2351, -2755, -3207, -3605, -3617, -2906, -1817, -1221, -1305, -1209, -331, 720, 1030, 550, -156, -717, -1076, -1226, -1186, -997, -657, -218, 112, 272, 632, 1565, 2679, 3066, 2556, 2104, 2471, 3189, 3443, 3289, 3285, 3526, 3713, 3755, 3748, 3689, 3539, 3403, 3460, 3806, 4398, 4990, 5252, 5149, 5190, 5927, 7090, 7696, 7252, 6368, 5850, 5710, 5552, 5396, 5470, 5559, 5294, 4988, 5397, 6533, 7404, 7254, 6457, 5789, 5479, 5292, 4921, 4035, 2606, 1339, 1158, 2226, 4063, 6302, 8757, 11065, 12821, 13902, 14388, 14427, 14148, 13305, 11301, 8032, 4421, 1668, 327, 360, 1574, 3650, 6211, 9096, 12208, 15163, 17520, 19130, 19885, 19512, 18004, 15900, 13846, 12198, 11124, 10563, 10226, 10009, 10329, 11532, 13270, 14830, 15832, 16352, 16619, 16917, 17571, 18637, 19656, 20037, 19731, 19162, 18589, 17979, 17355, 16615, 15331, 13571, 12445, 12815, 13987, 14751, 15102, 15877, 17341, 19001, 20180, 20294, 19233, 17628, 16157, 14817, 13479, 12480, 12007, 11706, 11426, 11586, 12265, 12845, 12841, 12358, 11531, 10248, 8651, 7241, 6227, 5322, 4454, 4235, 5126, 6557, 7528, 7774, 7687, 7431, 6779, 5580, 3856, 1780, -199, -1694, -2838, -3890, -4579, -4581, -4182, -3883, -3674, -3354, -3153, -3396, -3919, -4292, -4434, -4631, -5091, -5692, -6182, -6545, -7061, -8061, -9568, -11225, -12580, -13431, -13922, -14269, -14486, -14396, -13802, -12633, -11122, -9823, -9224, -9327, -9839, -10643, -11807, -13261, -14774, -16190, -17368, -18123, -18366, -18202, -17742, -17036, -16223, -15518, -14992, -14565, -14225, -14102, -14225, -14403, -14444, -14400, -14462, -14682, -14918, -15062, -15143, -15277, -15621, -16217, -16829, -17041, -16679, -15973, -15297, -14816, -14459, -14073, -13590, -13095, -12771, -12697, -12766, -12836, -12902, -13047, -13175, -13080, -12775, -12554, -12549, -12593, -12605, -12682, -12794, -12814, -12822, -12867, -12632, -11864, -10819, -9803, -8720, -7605, -6966, -7083, -7458, -7535, -7496, -7913, -8860, -9830, -10336, -10275, -9792, -9106, -8475, -7969, -7300, -6197, -4929, -4122, -4000, -4183, -4205, -3951, -3581, -3326, -3390, -3806, -4300, -4440, -4114, -3751, -3874, -4472, -4960, -4752, -3802, -2642, -1854, -1444, -904, -25, 774, 1110, 1058, 636, -389, -1774, -2704, -2882, -3020, -3716, -4502, -4432, -3264, -1687, -566, -144, 31, 432, 929, 981, 347, -639, -1488, -1980, -2151, -2073, -1921, -2009, -2415, -2677, -2313, -1585, -1261, -1687, -2511, -3180, -3283, -2723, -1910, -1465, -1453, -1340, -792, -9, 621, 697, -64, -1296, -2147, -2382, -2599, -3115, -3558, -3726, -3753, -3433, -2486, -1377, -837, -793, -659, -316, -64, -2, -33, -179, -447, -609, -477, -211, -117, -257, -454, -614, -747, -791, -717, -710, -867, -871, -352, 584, 1542, 2297, 2800, 3042, 3172, 3390, 3601, 3467, 2910, 2206, 1556, 922, 406, 392, 1070, 2030, 2746, 3243, 3937, 4926, 5851, 6346, 6287, 5783, 5181, 4810, 4569, 4134, 3556, 3232, 3281, 3484, 3806, 4452, 5328, 5931, 5983, 5815, 5885, 6143, 6188, 5867, 5381, 4976, 4806, 4914, 5097, 5044, 4789, 4709, 4938, 5180, 5178, 4954, 4574, 4062, 3575, 3330, 3314, 3304, 3156, 2980, 2986, 3241, 3582, 3751, 3618, 3290, 2964, 2706, 2396, 1951, 1471, 1096, 825, 623, 563, 631, 619, 382, 69, -124, -240, -417, -659, -877, -1022, -1061, -946, -738, -615, -653, -707, -638, -576, -778, -1261, -1770, -2139, -2479, -2839, -2944, -2545, -1919, -1595, -1641, -1655, -1449, -1287, -1392, -1668, -1974, -2316, -2716, -3088, -3286, -3171, -2746, -2253, -1942, -1748, -1400, -870, -496, -585, -1043, -1478, -1619, -1527, -1452, -1507, -1570, -1413, -968, -441, -94, 34, 91, 132, 104, 69, 142, 231, 140, -60, -45, 344, 894, 1243, 1212, 940, 778, 980, 1437, 1751, 1687, 1496, 1634, 2191, 2811, 3176, 3309, 3370, 3428, 3459, 3323, 2824, 2048, 1492, 1523, 1873, 2020, 1943, 2106, 2723, 3441, 3838, 3957, 4114, 4369, 4509, 4426, 4245, 4042, 3726, 3201, 2549, 1932, 1375, 735, -54, -770, -1085, -947, -512, 240, 1588, 3673, 6266, 8903, 11091, 12397, 12642, 12035, 10912, 9317, 7042, 4141, 1178, -1125, -2388, -2564, -1675, 224, 2887, 5972, 9218, 12368, 14992, 16613, 17059, 16570, 15560, 14283, 12783, 11177, 9857, 9123, 8783, 8502, 8475, 9194, 10552, 11756, 12324, 12698, 13558, 14857, 16004, 16742, 17401, 18244, 19082, 19561, 19442, 18699, 17624, 16646, 15768, 14632, 13363, 12703, 12974, 13690, 14399, 15224, 16307, 17443, 18368, 18868, 18759, 18061, 17121, 16241, 15471, 14849, 14455, 14258, 14219, 14411, 14721, 14712, 14166, 13414, 12776, 11941, 10456, 8639, 7386, 7039, 7069, 7086, 7447, 8504, 9831, 10733, 10957, 10605, 9825, 8818, 7640, 6048, 3965, 1873, 271, -826, -1533, -1794, -1732, -1697, -1711, -1448, -892, -468, -462, -742, -1084, -1427, -1736, -1987, -2350, -3131, -4377, -5720, -6810, -7732, -8785, -9991, -11060, -11739, -11963, -11779, -11267, -10515, -9631, -8811, -8255, -7999, -7952, -8211, -9029, -10381, -11841, -13022, -13886, -14586, -15222, -15762, -16057, -15921, -15381, -14743, -14260, -13953, -13735, -13609, -13563, -13476, -13266, -13047, -13060, -13382, -13823, -14106, -14181, -14283, -14678, -15347, -15982, -16263, -16137, -15795, -15443, -15111, -14740, -14323, -13914, -13542, -13185, -12877, -12723, -12723, -12726, -12639, -12543, -12531, -12543, -12483, -12395, -12408, -12592, -12872, -13071, -13076, -12962, -12884, -12779, -12424, -11750, -10903, -10001, -9064, -8221, -7685, -7487, -7436, -7403, -7475, -7800, -8361, -8967, -9395, -9556, -9498, -9265, -8860, -8300, -7632, -6822, -5855, -4911, -4258, -3938, -3736, -3488, -3228, -3054, -3041, -3254, -3654, -4027, -4173, -4126, -4106, -4253, -4451, -4397, -3886, -3050, -2196, -1444, -690, 68, 638, 913, 984, 910, 634, 122, -582, -1380, -2040, -2290, -2129, -1842, -1601, -1302, -835, -250, 343, 809, 971, 797, 557, 533, 639, 534, 124, -283, -381, -263, -267, -531, -869, -1059, -1089, -1125, -1292, -1507, -1578, -1457, -1318, -1263, -1143, -799, -389, -231, -396, -639, -766, -830, -956, -1163, -1435, -1794, -2161, -2317, -2185, -2013, -2082, -2323, -2433, -2316, -2139, -1972, -1697, -1351, -1185, -1211, -1080, -640, -230, -190, -444, -719, -914, -1106, -1418, -1872, -2269, -2397, -2364, -2393, -2341, -1862, -1035, -334, 59, 432, 983, 1521, 1800, 1850, 1815, 1720, 1526, 1287, 1106, 956, 742, 515, 479, 715, 1046, 1248, 1341, 1612, 2258, 3086, 3688, 3946, 4151, 4515, 4864, 4937, 4767, 4540, 4308, 4021, 3706, 3449, 3267, 3140, 3118, 3280, 3613, 4018, 4433, 4835, 5172, 5387, 5488, 5491, 5349, 5072, 4795, 4595, 4403, 4172, 3993, 3936, 3966, 4069, 4228, 4349, 4354, 4305, 4248, 4098, 3812, 3519, 3347, 3237, 3061, 2821, 2654, 2686, 2862, 2953, 2816, 2614, 2607, 2741, 2659, 2191, 1603, 1229, 1061, 847, 477, 100, -110, -145, -70, 43, 97, 19, -115, -140, -10, 127, 103, -107, -346, -419, -330, -344, -725, -1411, -2076, -2464, -2587, -2565, -2436, -2148, -1683, -1076, -397, 240, 693, 922, 1000, 904, 479, -317, -1316, -2335, -3251, -3847, -3899, -3473, -2878, -2260, -1499, -538, 413, 1074, 1358, 1353, 1136, 706, 72, -649, -1297, -1758, -2020, -2120, -2045, -1715, -1159, -614, -308, -199, -117, -30, 0, -6, -33, -132, -254, -241, -106, -34, -65, -71, -55, -176, -454, -724, -836, -756, -518, -218, 72, 408, 862, 1320, 1542, 1424, 1046, 558, 81, -337, -742, -1091, -1161, -800, -189, 409, 1006, 1692, 2288, 2467, 2172, 1658, 1202, 868, 525, 75, -269, -97, 690, 1667, 2387, 2842, 3228, 3564, 3700, 3557, 3193, 2763, 2425, 2189, 1980, 1885, 2099, 2562, 2944, 3095, 3191, 3362, 3485, 3447, 3347, 3314, 3344, 3425, 3652, 4058, 4441, 4530, 4273, 3787, 3119, 2232, 1223, 329, -247, -417, -149, 565, 1756, 3447, 5468, 7408, 8942, 9995, 10477, 10181, 9150, 7715, 6061, 4194, 2396, 1164, 682, 796, 1354, 2195, 3130, 4283, 5893, 7598, 8628, 8864, 8967, 9350, 9791, 10022, 10018, 9796, 9454, 9178, 8907, 8428, 7844, 7447, 7163, 6739, 6349, 6421, 7040, 7988, 9146, 10390, 11419, 12053, 12499, 12952, 13183, 12820, 11958, 11085, 10443, 9853, 9292, 9129, 9576, 10295, 10811, 11081, 11370, 11763, 11995, 11769, 11108, 10357, 9822, 9520, 9350, 9362, 9676, 10214, 10721, 11047, 11214, 11249, 11074, 10652, 10034, 9175, 7996, 6740, 5978, 5902, 5998, 5761, 5393, 5380, 5716, 5987, 5951, 5698, 5409, 5189, 5032, 4882, 4719, 4563, 4326, 3873, 3250, 2656, 2113, 1385, 316, -889, -1871, -2456, -2706, -2710, -2535, -2285, -2025, -1657, -1089, -558, -511, -1099, -1988, -2756, -3333, -3992, -4940, -6010, -6808, -7144, -7227, -7338, -7487, -7549, -7554, -7656, -7871, -8046, -8119, -8191, -8333, -8451, -8425, -8315, -8263, -8345, -8549, -8842, -9174, -9523, -10000, -10705, -11492, -12060, -12271, -12203, -11974, -11713, -11503, -11249, -10820, -10400, -10305, -10526, -10816, -11131, -11523, -11812, -11852, -11794, -11754, -11583, -11269, -11048, -10986, -10976, -11129, -11615, -12215, -12619, -12852, -12985, -12850, -12376, -11799, -11226, -10552, -9855, -9409, -9277, -9339, -9595, -10010, -10339, -10429, -10429, -10468, -10440, -10221, -9825, -9300, -8745, -8386, -8370, -8606, -8875, -8993, -8793, -8228, -7520, -6971, -6607, -6172, -5533, -4869, -4471, -4468, -4754, -5118, -5391, -5525, -5577, -5585, -5469, -5120, -4556, -3892, -3182, -2479, -1997, -1923, -2098, -2180, -2134, -2211, -2501, -2763, -2711, -2268, -1593, -959, -500, -79, 444, 907, 1022, 783, 457, 192, -81, -401, -624, -597, -365, -115, 41, 171, 389, 673, 862, 845, 707, 661, 822, 1093, 1323, 1504, 1711, 1903, 1911, 1646, 1222, 813, 467, 91, -361, -733, -774, -458, -37, 266, 499, 768, 983, 974, 719, 335, -59, -397, -670, -913, -1115, -1209, -1218, -1234, -1220, -1035, -746, -635, -840, -1240, -1646, -1925, -2028, -2090, -2318, -2636, -2726, -2519, -2300, -2225, -2135, -1928, -1759, -1772, -1919, -2083, -2193, -2261, -2380, -2605, -2837, -2965, -3056, -3212, -3354, -3343, -3222, -3148, -3168, -3195, -3135, -2919, -2521, -2007, -1533, -1221, -1084, -1073, -1132, -1225, -1374, -1639, -2055, -2529, -2850, -2827, -2472, -2022, -1702, -1465, -1081, -478, 144, 565, 758, 831, 866, 835, 639, 253, -112, -172, 44, 217, 165, 70, 185, 536, 992, 1461, 1887, 2206, 2392, 2485, 2553, 2612, 2609, 2483, 2241, 1988, 1855, 1900, 2070, 2258, 2395, 2489, 2589, 2747, 2953, 3103, 3067, 2858, 2675, 2679, 2816, 2895, 2851, 2807, 2919, 3207, 3547, 3775, 3783, 3598, 3363, 3195, 3033, 2754, 2405, 2170, 2110, 2143, 2244, 2479, 2780, 2923, 2775, 2473, 2316, 2471, 2781, 2882, 2616, 2276, 2296, 2728, 3175, 3253, 2958, 2569, 2248, 1850, 1164, 300, -320, -441, -224, 96, 604, 1465, 2516, 3365, 3827, 4014, 4040, 3841, 3295, 2403, 1321, 280, -493, -850, -789, -447, 31, 607, 1292, 2018, 2583, 2755, 2490, 2044, 1712, 1517, 1293, 1069, 1086, 1407, 1796, 2073, 2360, 2758, 2976, 2624, 1802, 1002, 476, 129, -64, -44, 84, 306, 911, 1929, 2802, 3136, 3181, 3179, 2939, 2375, 1725, 1080, 437, 135, 492, 1144, 1481, 1508, 1692, 2126, 2427, 2319, 1905, 1361, 738, 159, -121, 0, 355, 825, 1461, 2224, 2924, 3427, 3598, 3219, 2333, 1411, 753, 112, -702, -1346, -1433, -1070, -571, -74, 379, 717, 916, 976, 818, 430, 35, -69, 186, 636, 1088, 1452, 1689, 1766, 1680, 1435, 969, 148, -1038, -2275, -3109, -3368, -3260, -2946, -2273, -1106, 259, 1334, 1933, 2234, 2422, 2434, 2008, 1053, 15, -491, -531, -718, -1102, -1046, -443, 2, -30, -92, 59, 133, 13, -133, -285, -373, -33, 830, 1775, 2469, 2966, 3250, 3210, 3067, 3046, 2879, 2281, 1559, 1172, 1136, 1304, 1726, 2394, 3057, 3511, 3762, 3838, 3738, 3499, 3148, 2730, 2459, 2586, 3030, 3459, 3769, 4203, 4949, 5826, 6410, 6350, 5592, 4474, 3560, 3208, 3237, 3118, 2567, 1884, 1610, 1871, 2213, 2170, 1769, 1270, 729, 255, 308, 1181, 2501, 3767, 4917, 5967, 6779, 7453, 8086, 8032, 6554, 4126, 1974, 475, -805, -1896, -2356, -2073, -1227, 151, 1943, 3670, 4961, 5922, 6727, 7187, 7045, 6421, 5650, 4867, 4102, 3585, 3490, 3517, 3253, 2809, 2616, 2744, 2913, 3067, 3384, 3837, 4236, 4759, 5807, 7163, 8036, 8262, 8485, 8797, 8437, 7303, 6305, 5735, 4943, 3957, 3691, 4270, 4878, 5342, 6280, 7714, 8804, 9068, 8836, 8479, 7954, 7213, 6501, 6030, 5764, 5772, 6273, 7135, 7900, 8493, 9175, 9732, 9572, 8676, 7561, 6431, 5196, 4034, 3215, 2665, 2341, 2512, 3236, 4079, 4734, 5384, 6159, 6675, 6546, 5993, 5535, 5234, 4727, 3916, 3053, 2251, 1429, 685, 153, -328, -969, -1616, -2005, -2152, -2154, -1895, -1285, -556, 0, 384, 701, 768, 307, -566, -1558, -2740, -4289, -5840, -6848, -7386, -7836, -8066, -7730, -6993, -6278, -5702, -5250, -5038, -5060, -5182, -5545, -6413, -7591, -8510, -8989, -9409, -9972, -10270, -10004, -9569, -9426, -9348, -8981, -8609, -8626, -8826, -8905, -9019, -9249, -9321, -9259, -9504, -10054, -10377, -10320, -10311, -10567, -10771, -10657, -10378, -10146, -9895, -9505, -9063, -8711, -8474, -8412, -8651, -9092, -9509, -10029, -10870, -11630, -11641, -11015, -10459, -10105, -9443, -8353, -7339, -6764, -6506, -6437, -6648, -7143, -7741, -8380, -9153, -9892, -10164, -9895, -9484, -9088, -8414, -7409, -6481, -5814, -5213, -4672, -4414, -4413, -4465, -4626, -4994, -5367, -5534, -5648, -5921, -6223, -6295, -6142, -5922, -5601, -5020, -4264, -3612, -3136, -2660, -2172, -1874, -1857, -2022, -2346, -2852, -3403, -3822, -4109, -4306, -4297, -3957, -3361, -2694, -2048, -1452, -964, -640, -470, -447, -642, -1071, -1552, -1850, -1975, -2139, -2386, -2457, -2187, -1825, -1713, -1757, -1596, -1195, -862, -733, -681, -671, -743, -782, -702, -694, -949, -1374, -1784, -2087, -2207, -2145, -2123, -2282, -2374, -2120, -1633, -1165, -783, -557, -662, -1087, -1553, -1853, -2011, -2157, -2465, -2977, -3322, -2996, -2101, -1327, -1049, -978, -774, -522, -460, -676, -1127, -1685, -2157, -2423, -2489, -2401, -2246, -2164, -2157, -1968, -1425, -848, -763, -1164, -1445, -1234, -932, -1066, -1428, -1390, -942, -781, -1251, -1781, -1659, -1028, -688, -1013, -1447, -1218, -345, 435, 632, 529, 643, 1024, 1341, 1414, 1322, 1142, 831, 423, 135, 176, 452, 608, 498, 474, 925, 1671, 2170, 2268, 2258, 2316, 2349, 2350, 2425, 2516, 2454, 2260, 2141, 2216, 2398, 2475, 2321, 2071, 2018, 2231, 2428, 2393, 2322, 2529, 2931, 3153, 3146, 3304, 3784, 4138, 3954, 3485, 3255, 3291, 3217, 2906, 2671, 2793, 3161, 3398, 3331, 3194, 3294, 3501, 3386, 2849, 2336, 2235, 2382, 2408, 2369, 2605, 3041, 3217, 3052, 2999, 3216, 3215, 2652, 1895, 1476, 1423, 1445, 1409, 1391, 1489, 1721, 2029, 2271, 2294, 2026, 1532, 995, 619, 484, 457, 304, 26, -57, 262, 705, 893, 965, 1326, 1873, 2038, 1601, 981, 599, 378, 65, -289, -402, -176, 201, 542, 849, 1177, 1447, 1483, 1189, 669, 168, -144, -329, -496, -564, -355, 76, 430, 542, 595, 800, 1022, 911, 398, -163, -451, -541, -660, -702, -342, 365, 895, 922, 741, 831, 1275, 1678, 1517, 635, -409, -790, -388, 112, 257, 371, 829, 1470, 2015, 2438, 2705, 2636, 2195, 1538, 777, -20, -610, -655, -125, 582, 1036, 1223, 1508, 2138, 2880, 3157, 2604, 1551, 785, 625, 546, 90, -285, 108, 1075, 1798, 1965, 1948, 2055, 2195, 2177, 1922, 1447, 887, 503, 458, 630, 842, 1159, 1652, 2031, 1992, 1765, 1729, 1671, 1169, 435, 29, 65, 337, 816, 1425, 1831, 1926, 2065, 2438, 2692, 2470, 1941, 1488, 1184, 933, 848, 1063, 1380, 1572, 1827, 2310, 2605, 2266, 1579, 1135, 1001, 947, 1044, 1463, 2029, 2469, 2824, 3272, 3767, 4083, 4084, 3742, 3056, 2165, 1448, 1196, 1261, 1352, 1510, 1946, 2587, 3214, 3699, 3855, 3513, 2923, 2497, 2142, 1545, 929, 702, 700, 603, 716, 1380, 2064, 1951, 1215, 825, 1137, 1428, 1001, 146, -398, -460, -484, -874, -1669, -2615, -3337, -3713, -4037, -4487, -4649, -4089, -3039, -1918, -540, 1499, 3820, 5333, 5409, 4513, 3527, 2660, 1320, -894, -3380, -5074, -5603, -5411, -4808, -3556, -1501, 914, 3064, 4697, 5911, 6774, 7130, 6752, 5718, 4537, 3676, 3127, 2713, 2553, 2838, 3407, 3962, 4462, 4967, 5425, 5890, 6584, 7455, 8078, 8317, 8699, 9708, 10958, 11590, 11402, 10931, 10488, 9854, 9001, 8362, 8183, 8227, 8389, 8971, 10180, 11748, 13194, 14178, 14553, 14362, 13813, 13175, 12536, 11730, 10651, 9672, 9495, 10372, 11645, 12480, 12830, 13214, 13719, 13839, 13260, 12164, 10845, 9459, 8229, 7459, 7253, 7442, 7778, 8151, 8654, 9401, 10223, 10633, 10276, 9301, 8208, 7351, 6720, 6081, 5251, 4231, 3235, 2596, 2440, 2401, 1952, 1086, 316, -7, 5, 153, 350, 484, 516, 631, 882, 911, 374, -620, -1794, -3115, -4605, -6012, -7035, -7731, -8297, -8586, -8270, -7474, -6769, -6418, -6164, -5867, -5799, -6214, -7061, -8187, -9387, -10339, -10892, -11245, -11601, -11864, -11852, -11571, -11128, -10676, -10443, -10550, -10781, -10851, -10782, -10836, -11101, -11390, -11516, -11489, -11440, -11433, -11441, -11459, -11516, -11597, -11603, -11506, -11410, -11405, -11405, -11213, -10807, -10433, -10349, -10537, -10791, -10986, -11118, -11110, -10872, -10489, -10137, -9777, -9218, -8493, -7885, -7597, -7544, -7578, -7730, -8117, -8704, -9265, -9613, -9734, -9667, -9347, -8655, -7622, -6485, -5543, -4900, -4454, -4108, -3907, -3918, -4131, -4529, -5038, -5405, -5415, -5261, -5267, -5309, -5026, -4461, -3904, -3339, -2641, -2084, -1972, -2032, -1747, -1151, -771, -874, -1227, -1554, -1833, -2073, -2171, -2151, -2204, -2334, -2268, -1881, -1392, -1008, -702, -428, -213, -21, 179, 249, 14, -465, -938, -1234, -1387, -1517, -1661, -1737, -1639, -1407, -1206, -1135, -1092, -933, -708, -638, -831, -1134, -1363, -1531, -1727, -1934, -2109, -2282, -2460, -2604, -2706, -2752, -2641, -2397, -2272, -2401, -2551, -2494, -2417, -2626, -3035, -3283, -3305, -3391, -3670, -3849, -3678, -3323, -3113, -3140, -3307, -3508, -3612, -3572, -3589, -3911, -4413, -4673, -4468, -3965, -3474, -3215, -3200, -3229, -3106, -2897, -2823, -2956, -3199, -3473, -3744, -3948, -4055, -4114, -4160, -4159, -4069, -3883, -3615, -3327, -3168, -3210, -3236, -2907, -2302, -1976, -2189, -2437, -2226, -1841, -1756, -1818, -1703, -1644, -1923, -2182, -1981, -1563, -1469, -1728, -1895, -1675, -1220, -914, -949, -1114, -1083, -898, -906, -1212, -1435, -1253, -915, -916, -1217, -1191, -493, 360, 581, 123, -305, -254, -95, -406, -1136, -1715, -1757, -1336, -797, -467, -339, -7, 798, 1673, 2006, 1832, 1700, 1814, 1842, 1551, 1133, 834, 647, 498, 458, 576, 721, 788, 933, 1366, 1993, 2528, 2874, 3165, 3502, 3800, 3867, 3656, 3395, 3276, 3078, 2507, 1877, 1855, 2445, 2913, 2886, 2785, 3067, 3668, 4297, 4748, 4892, 4761, 4594, 4563, 4629, 4714, 4760, 4615, 4205, 3832, 3920, 4441, 4856, 4725, 4223, 3959, 4294, 4920, 5188, 4912, 4544, 4530, 4779, 4931, 4859, 4631, 4238, 3685, 3246, 3218, 3443, 3446, 3121, 2907, 3124, 3589, 4006, 4276, 4267, 3840, 3267, 3093, 3358, 3439, 2898, 2102, 1779, 2141, 2702, 2910, 2764, 2676, 2847, 2955, 2583, 1841, 1313, 1293, 1347, 998, 555, 702, 1386, 1823, 1648, 1370, 1476, 1674, 1357, 505, -273, -516, -416, -422, -579, -505, 22, 661, 884, 636, 380, 391, 291, -396, -1435, -2093, -2051, -1656, -1304, -1035, -741, -404, -36, 357, 672, 684, 266, -462, -1206, -1686, -1765, -1537, -1307, -1273, -1224, -816, -116, 454, 671, 637, 471, 254, 117, 64, -92, -345, -378, -66, 295, 458, 514, 608, 672, 634, 597, 672, 777, 753, 608, 561, 809, 1272, 1658, 1747, 1554, 1239, 939, 727, 596, 464, 253, 25, -6, 322, 946, 1620, 2115, 2342, 2336, 2207, 2073, 1925, 1581, 893, 27, -555, -529, -39, 490, 880, 1356, 2178, 3237, 4112, 4457, 4284, 3910, 3613, 3334, 2813, 2006, 1168, 524, 137, 103, 554, 1341, 2063, 2498, 2838, 3383, 4156, 4859, 5116, 4794, 4147, 3608, 3398, 3349, 3156, 2750, 2369, 2268, 2464, 2778, 3031, 3163, 3277, 3549, 3998, 4395, 4520, 4430, 4334, 4345, 4430, 4429, 4112, 3457, 2811, 2508, 2439, 2367, 2413, 2834, 3503, 4095, 4672, 5571, 6661, 7246, 6940, 6207, 5675, 5257, 4440, 3174, 1994, 1366, 1296, 1491, 1727, 2085, 2839, 3948, 4863, 5098, 4844, 4669, 4719, 4613, 4103, 3493, 3232, 3332, 3464, 3496, 3658, 4128, 4697, 4934, 4583, 3764, 2877, 2317, 2207, 2339, 2413, 2352, 2420, 2918, 3715, 4226, 4045, 3448, 2990, 2750, 2366, 1749, 1265, 1118, 1034, 764, 618, 1056, 1849, 2005, 868, -924, -2028, -2006, -1782, -2252, -3043, -3088, -1939, -56, 1827, 3230, 4050, 4448, 4560, 4320, 3650, 2572, 1058, -889, -2825, -3928, -3820, -2994, -2184, -1472, -358, 1402, 3398, 4982, 5775, 5764, 5307, 5010, 5149, 5238, 4691, 3693, 2944, 2811, 3159, 3666, 3922, 3688, 3289, 3379, 4102, 4952, 5534, 5987, 6535, 7173, 7944, 8999, 9999, 10049, 8916, 7694, 7429, 7643, 7278, 6421, 5968, 6182, 6663, 7288, 8183, 9109, 9617, 9578, 9232, 8829, 8476, 8142, 7737, 7253, 6921, 7048, 7648, 8349, 8855, 9193, 9327, 9000, 8257, 7512, 6781, 5662, 4298, 3405, 3156, 3066, 3035, 3441, 4193, 4718, 4844, 4873, 4885, 4669, 4178, 3623, 3131, 2639, 2039, 1335, 653, 138, -205, -609, -1333, -2314, -3139, -3554, -3787, -4112, -4329, -4102, -3512, -2940, -2550, -2299, -2245, -2530, -3193, -4160, -5283, -6407, -7501, -8638, -9706, -10373, -10499, -10293, -9977, -9593, -9168, -8771, -8414, -8176, -8298, -8864, -9561, -10044, -10332, -10660, -11135, -11676, -12103, -12238, -12109, -11986, -12054, -12184, -12193, -12132, -12129, -12114, -11965, -11795, -11805, -11905, -11811, -11581, -11569, -11808, -11967, -11969, -12132, -12467, -12584, -12337, -11987, -11684, -11341, -10984, -10753, -10734, -10960, -11315, -11458, -11316, -11405, -12050, -12608, -12240, -11128, -10149, -9665, -9320, -8776, -8108, -7596, -7455, -7738, -8349, -9141, -9932, -10430, -10384, -9942, -9580, -9517, -9387, -8682, -7437, -6224, -5544, -5348, -5240, -4997, -4740, -4699, -4923, -5273, -5596, -5846, -5994, -5918, -5590, -5285, -5292, -5370, -4942, -3929, -2941, -2480, -2355, -2120, -1721, -1443, -1430, -1543, -1620, -1706, -1939, -2263, -2439, -2350, -2155, -2014, -1833, -1456, -949, -505, -216, -64, 20, 126, 262, 292, 159, -17, -179, -400, -574, -444, -91, 124, 200, 471, 895, 981, 565, 87, -78, -96, -358, -913, -1319, -1106, -409, 104, 165, 345, 1191, 2290, 2748, 2317, 1517, 795, 108, -709, -1558, -2175, -2448, -2476, -2302, -1758, -774, 299, 959, 1122, 1089, 989, 601, -224, -1291, -2271, -2983, -3380, -3462, -3237, -2725, -2037, -1382, -923, -613, -343, -175, -277, -681, -1221, -1699, -2024, -2256, -2490, -2681, -2669, -2457, -2316, -2408, -2491, -2238, -1720, -1305, -1111, -860, -340, 231, 503, 442, 303, 204, -3, -441, -961, -1322, -1420, -1300, -995, -507, 121, 789, 1409, 1925, 2280, 2430, 2408, 2292, 2121, 1896, 1671, 1584, 1726, 2019, 2302, 2533, 2829, 3252, 3651, 3832, 3811, 3738, 3675, 3566, 3410, 3256, 3126, 2995, 2875, 2808, 2863, 3109, 3500, 3858, 4088, 4337, 4737, 5103, 5094, 4695, 4275, 4098, 3965, 3531, 2835, 2265, 2094, 2254, 2528, 2782, 3002, 3242, 3536, 3815, 3975, 4006, 3944, 3777, 3498, 3157, 2801, 2419, 2059, 1833, 1758, 1723, 1641, 1517, 1393, 1338, 1465, 1804, 2181, 2383, 2417, 2478, 2643, 2735, 2547, 2108, 1579, 1043, 511, 59, -204, -233, -63, 202, 452, 743, 1261, 1966, 2444, 2375, 1951, 1577, 1305, 886, 274, -213, -303, -73, 242, 557, 892, 1238, 1598, 1960, 2173, 2072, 1748, 1401, 1030, 610, 354, 427, 621, 691, 754, 1033, 1505, 2014, 2434, 2627, 2563, 2427, 2398, 2430, 2461, 2591, 2839, 2972, 2824, 2536, 2308, 2121, 1844, 1479, 1167, 1012, 998, 1095, 1397, 2064, 3110, 4264, 5133, 5518, 5534, 5376, 5051, 4360, 3200, 1819, 706, 147, 31, 174, 611, 1385, 2330, 3278, 4231, 5110, 5682, 5837, 5609, 4957, 3961, 3030, 2410, 1837, 1154, 802, 1110, 1674, 1951, 2011, 2234, 2677, 3078, 3185, 2962, 2648, 2561, 2687, 2676, 2377, 2063, 1983, 2006, 1861, 1518, 1187, 1044, 1100, 1278, 1524, 1849, 2265, 2715, 3062, 3179, 3059, 2792, 2388, 1747, 841, -130, -862, -1178, -1085, -713, -181, 483, 1332, 2342, 3288, 3847, 3885, 3543, 2984, 2218, 1279, 418, -140, -470, -706, -745, -434, 152, 844, 1543, 2104, 2341, 2279, 2142, 2039, 1915, 1737, 1482, 1131, 811, 730, 847, 914, 886, 891, 888, 765, 652, 752, 982, 1119, 1135, 1118, 1052, 879, 616, 315, 59, -38, 25, 137, 273, 545, 954, 1377, 1806, 2294, 2697, 2803, 2650, 2418, 2141, 1774, 1381, 1019, 690, 476, 498, 676, 838, 1020, 1383, 1886, 2338, 2674, 2954, 3207, 3430, 3666, 3907, 4031, 3922, 3617, 3285, 3091, 3008, 2856, 2588, 2430, 2581, 2907, 3170, 3414, 3839, 4371, 4698, 4769, 4888, 5206, 5402, 5204, 4876, 4816, 4938, 4912, 4760, 4740, 4876, 5024, 5169, 5334, 5409, 5345, 5254, 5195, 5095, 4935, 4805, 4782, 4866, 5011, 5148, 5246, 5370, 5574, 5764, 5806, 5720, 5628, 5505, 5201, 4705, 4257, 4051, 3969, 3794, 3546, 3414, 3428, 3432, 3330, 3175, 3047, 2975, 2932, 2858, 2753, 2725, 2811, 2861, 2764, 2622, 2512, 2292, 1827, 1214, 614, 52, -472, -863, -1031, -1018, -929, -836, -746, -611, -408, -239, -273, -585, -1061, -1510, -1837, -2087, -2362, -2693, -2998, -3199, -3308, -3417, -3595, -3828, -4068, -4316, -4584, -4843, -5025, -5093, -5087, -5044, -4974, -4880, -4780, -4708, -4715, -4840, -5061, -5311, -5585, -5944, -6374, -6750, -6984, -7103, -7153, -7119, -6995, -6856, -6810, -6881, -7008, -7128, -7250, -7420, -7631, -7775, -7740, -7530, -7292, -7158, -7105, -7008, -6861, -6830, -7052, -7460, -7849, -8092, -8230, -8372, -8516, -8527, -8300, -7925, -7613, -7478, -7455, -7424, -7379, -7383, -7442, -7492, -7496, -7478, -7424, -7285, -7078, -6915, -6877, -6931, -7020, -7122, -7229, -7309, -7345, -7350, -7317, -7172, -6839, -6364, -5940, -5742, -5722, -5683, -5538, -5426, -5472, -5623, -5765, -5836, -5808, -5683, -5532, -5402, -5226, -4973, -4754, -4652, -4582, -4457, -4324, -4245, -4195, -4135, -4036, -3867, -3665, -3552, -3538, -3464, -3231, -2964, -2832, -2840, -2878, -2846, -2721, -2577, -2535, -2600, -2617, -2479, -2296, -2236, -2270, -2218, -2033, -1872, -1834, -1810, -1665, -1455, -1311, -1227, -1092, -884, -694, -580, -520, -512, -597, -752, -881, -978, -1124, -1314, -1427, -1399, -1276, -1096, -864, -628, -437, -269, -109, -23, -56, -142, -186, -209, -276, -361, -364, -268, -174, -161, -195, -194, -133, -55, -44, -150, -292, -301, -161, -50, -60, -54, 73, 231, 282, 212, 62, -101, -154, -29, 144, 191, 117, 80, 149, 249, 290, 264, 197, 109, 38, 38, 100, 158, 182, 211, 272, 361, 492, 649, 752, 774, 823, 959, 1081, 1096, 1062, 1040, 966, 788, 602, 526, 551, 574, 532, 483, 551, 802, 1145, 1433, 1613, 1758, 1916, 2029, 2027, 1946, 1886, 1868, 1810, 1667, 1500, 1397, 1368, 1368, 1358, 1347, 1390, 1528, 1721, 1887, 2023, 2200, 2420, 2570, 2577, 2535, 2570, 2615, 2499, 2253, 2102, 2120, 2116, 1952, 1738, 1645, 1704, 1844, 1959, 1989, 2009, 2132, 2303, 2376, 2411, 2596, 2883, 3032, 2986, 2893, 2815, 2653, 2364, 2004, 1655, 1428, 1442, 1694, 2014, 2235, 2348, 2427, 2491, 2517, 2541, 2620, 2696, 2602, 2275, 1889, 1693, 1749, 1921, 2066, 2166, 2248, 2290, 2263, 2181, 2076, 1949, 1776, 1559, 1373, 1374, 1624, 1937, 2074, 2082, 2183, 2351, 2334, 2053, 1675, 1363, 1196, 1221, 1352, 1418, 1451, 1636, 1927, 2083, 2093, 2195, 2407, 2452, 2187, 1805, 1554, 1491, 1506, 1480, 1382, 1284, 1314, 1542, 1904, 2218, 2325, 2221, 2065, 2021, 2084, 2092, 1900, 1565, 1291, 1226, 1327, 1439, 1514, 1628, 1816, 1942, 1851, 1572, 1290, 1155, 1216, 1417, 1587, 1588, 1544, 1717, 2108, 2447, 2588, 2600, 2514, 2314, 2109, 1975, 1787, 1427, 999, 646, 407, 344, 523, 844, 1125, 1366, 1651, 1884, 1898, 1781, 1798, 1989, 2095, 1949, 1734, 1713, 1850, 1882, 1694, 1418, 1219, 1098, 927, 593, 153, -145, -70, 324, 720, 916, 1061, 1399, 1864, 2141, 2082, 1818, 1490, 1139, 841, 700, 684, 678, 646, 628, 634, 652, 667, 641, 583, 585, 667, 679, 507, 285, 214, 286, 335, 297, 279, 393, 618, 833, 922, 816, 542, 246, 68, -3, -71, -130, -94, 20, 86, 61, 51, 135, 280, 413, 510, 537, 443, 258, 100, 11, -97, -248, -298, -178, -47, -57, -133, -123, -41, -12, -80, -187, -310, -488, -755, -1078, -1391, -1634, -1753, -1693, -1449, -1074, -658, -295, -19, 218, 409, 387, 65, -299, -385, -274, -290, -475, -574, -480, -335, -259, -263, -352, -529, -718, -822, -796, -640, -387, -91, 236, 634, 1068, 1397, 1516, 1461, 1314, 1110, 842, 534, 258, 96, 79, 171, 335, 592, 965, 1370, 1621, 1642, 1585, 1623, 1693, 1639, 1580, 1743, 2014, 2135, 2224, 2517, 2791, 2711, 2484, 2475, 2542, 2370, 2082, 1930, 1869, 1845, 1993, 2304, 2556, 2697, 2860, 3031, 3077, 3003, 2906, 2818, 2754, 2753, 2769, 2713, 2641, 2701, 2879, 2961, 2833, 2645, 2570, 2529, 2349, 2073, 1887, 1850, 1902, 2029, 2196, 2296, 2338, 2475, 2725, 2877, 2812, 2643, 2467, 2243, 1943, 1634, 1352, 1086, 865, 772, 824, 935, 1036, 1123, 1193, 1206, 1188, 1211, 1251, 1211, 1099, 1027, 982, 849, 649, 517, 442, 253, -91, -420, -585, -639, -736, -919, -1082, -1107, -978, -797, -702, -764, -925, -1050, -1096, -1142, -1274, -1482, -1696, -1867, -1988, -2105, -2263, -2435, -2527, -2504, -2441, -2433, -2500, -2609, -2703, -2747, -2817, -3023, -3323, -3528, -3573, -3585, -3641, -3676, -3661, -3653, -3650, -3606, -3590, -3724, -4004, -4312, -4554, -4688, -4720, -4726, -4773, -4830, -4826, -4780, -4752, -4752, -4772, -4833, -4915, -4956, -4964, -5020, -5137, -5222, -5216, -5185, -5217, -5318, -5427, -5519, -5620, -5729, -5805, -5819, -5824, -5873, -5905, -5795, -5533, -5283, -5179, -5160, -5074, -4911, -4839, -4966, -5208, -5419, -5566, -5686, -5770, -5760, -5633, -5408, -5126, -4853, -4625, -4413, -4210, -4102, -4167, -4368, -4593, -4741, -4746, -4646, -4566, -4543, -4443, -4210, -4011, -3990, -4041, -4041, -4037, -4069, -4029, -3875, -3728, -3661, -3571, -3375, -3155, -3027, -2979, -2937, -2911, -2949, -2998, -2952, -2804, -2658, -2564, -2485, -2397, -2341, -2331, -2315, -2260, -2208, -2214, -2255, -2260, -2200, -2128, -2085, -2043, -1953, -1830, -1732, -1669, -1581, -1418, -1224, -1085, -1010, -951, -923, -966, -1029, -1029, -1000, -1002, -955, -782, -608, -566, -548, -361, -55, 155, 248, 386, 596, 716, 703, 710, 736, 545, 75, -363, -521, -518, -523, -432, -122, 268, 546, 756, 1007, 1160, 968, 484, 111, 179, 648, 1268, 1849, 2244, 2241, 1713, 841, -50, -825, -1492, -1871, -1638, -756, 448, 1682, 2856, 3864, 4496, 4621, 4265, 3544, 2600, 1547, 476, -353, -541, -33, 763, 1566, 2508, 3540, 4181, 4221, 4080, 4081, 3966, 3451, 2762, 2306, 2207, 2338, 2568, 2829, 3099, 3386, 3676, 3853, 3793, 3514, 3214, 3039, 2955, 2860, 2733, 2643, 2673, 2893, 3235, 3433, 3325, 3092, 2977, 2940, 2847, 2767, 2843, 3053, 3318, 3582, 3695, 3463, 2936, 2428, 2146, 2001, 1813, 1561, 1375, 1347, 1436, 1539, 1640, 1820, 2125, 2496, 2888, 3305, 3681, 3849, 3691, 3282, 2756, 2132, 1381, 643, 184, 97, 222, 421, 754, 1294, 1890, 2296, 2431, 2408, 2360, 2326, 2243, 2030, 1694, 1363, 1204, 1266, 1444, 1588, 1647, 1664, 1645, 1500, 1150, 650, 187, -79, -156, -172, -221, -245, -105, 253, 737, 1190, 1519, 1748, 1943, 2083, 2027, 1676, 1110, 466, -230, -985, -1695, -2172, -2263, -1907, -1207, -496, -59, 200, 602, 1202, 1718, 1946, 1960, 1916, 1845, 1704, 1470, 1135, 691, 162, -363, -775, -1000, -1008, -822, -526, -202, 178, 709, 1383, 2067, 2626, 2980, 3067, 2849, 2363, 1676, 858, 18, -680, -1133, -1360, -1421, -1332, -1081, -679, -168, 391, 914, 1302, 1478, 1435, 1217, 885, 484, 73, -249, -365, -181, 267, 791, 1178, 1383, 1512, 1609, 1551, 1195, 543, -196, -738, -926, -864, -791, -814, -819, -671, -354, 54, 484, 893, 1260, 1579, 1828, 1977, 2021, 1941, 1675, 1181, 543, -92, -647, -1118, -1514, -1810, -1910, -1637, -886, 177, 1212, 2008, 2603, 3084, 3402, 3405, 2985, 2189, 1238, 393, -232, -707, -1101, -1340, -1274, -859, -225, 437, 1004, 1420, 1657, 1726, 1707, 1667, 1549, 1251, 844, 543, 399, 219, -125, -477, -627, -614, -592, -500, -170, 292, 517, 374, 161, 149, 194, -1, -504, -1153, -1752, -2143, -2262, -2175, -1958, -1590, -1049, -396, 302, 983, 1512, 1763, 1757, 1568, 1193, 667, 140, -300, -676, -907, -813, -423, 16, 381, 795, 1366, 2057, 2762, 3350, 3698, 3822, 3919, 4134, 4376, 4423, 4174, 3769, 3491, 3490, 3610, 3602, 3500, 3605, 4095, 4806, 5479, 6031, 6545, 7094, 7666, 8156, 8393, 8254, 7884, 7601, 7490, 7307, 6966, 6806, 7040, 7356, 7438, 7522, 7973, 8627, 9024, 9035, 8929, 8946, 9043, 8998, 8705, 8372, 8315, 8540, 8741, 8729, 8642, 8646, 8669, 8540, 8233, 7845, 7453, 7068, 6691, 6322, 5976, 5709, 5603, 5656, 5722, 5646, 5458, 5344, 5353, 5275, 4936, 4491, 4217, 4079, 3774, 3188, 2541, 2041, 1624, 1088, 373, -365, -905, -1199, -1431, -1727, -1944, -1903, -1692, -1553, -1526, -1497, -1489, -1697, -2233, -2972, -3734, -4452, -5184, -5951, -6675, -7229, -7574, -7766, -7867, -7909, -7911, -7895, -7866, -7849, -7907, -8087, -8351, -8599, -8812, -9050, -9349, -9646, -9897, -10179, -10535, -10851, -10998, -11058, -11196, -11400, -11477, -11332, -11076, -10887, -10786, -10643, -10356, -10034, -9907, -10047, -10298, -10498, -10679, -10952, -11264, -11428, -11361, -11173, -10974, -10726, -10372, -9973, -9648, -9452, -9389, -9436, -9517, -9556, -9593, -9709, -9816, -9676, -9195, -8608, -8211, -8000, -7735, -7347, -7060, -7117, -7486, -7901, -8080, -7980, -7863, -7948, -8022, -7698, -7037, -6462, -6103, -5672, -5053, -4534, -4388, -4513, -4599, -4465, -4232, -4211, -4524, -4886, -4888, -4526, -4219, -4238, -4350, -4192, -3829, -3590, -3496, -3247, -2751, -2254, -1918, -1660, -1424, -1289, -1288, -1354, -1470, -1664, -1876, -1994, -2016, -2029, -2007, -1818, -1446, -1048, -702, -291, 227, 643, 756, 676, 649, 692, 573, 183, -272, -509, -458, -261, -106, -64, 27, 415, 1018, 1428, 1506, 1572, 1778, 1807, 1504, 1212, 1202, 1308, 1335, 1340, 1386, 1468, 1638, 1897, 2032, 1916, 1782, 1902, 2177, 2307, 2268, 2270, 2334, 2234, 1959, 1853, 2090, 2376, 2398, 2280, 2363, 2732, 3135, 3232, 2932, 2542, 2447, 2604, 2616, 2342, 2104, 2174, 2423, 2634, 2860, 3205, 3474, 3387, 3043, 2840, 2917, 3017, 2925, 2702, 2490, 2404, 2535, 2827, 3049, 3103, 3144, 3225, 3153, 2870, 2664, 2730, 2817, 2591, 2183, 2046, 2323, 2683, 2839, 2920, 3173, 3552, 3768, 3606, 3167, 2848, 2952, 3236, 3147, 2590, 2121, 2219, 2725, 3165, 3287, 3168, 3026, 3028, 3135, 3194, 3210, 3347, 3619, 3818, 3838, 3838, 3974, 4154, 4140, 3815, 3351, 3088, 3166, 3328, 3255, 3040, 3070, 3481, 3990, 4301, 4412, 4418, 4282, 3987, 3731, 3661, 3588, 3278, 2911, 2843, 3075, 3321, 3402, 3321, 3148, 3055, 3183, 3352, 3239, 2872, 2571, 2453, 2382, 2321, 2360, 2488, 2585, 2576, 2454, 2298, 2251, 2337, 2375, 2250, 2119, 2133, 2118, 1802, 1262, 869, 798, 826, 696, 466, 368, 452, 567, 609, 613, 648, 709, 726, 623, 409, 197, 62, -76, -340, -709, -1035, -1215, -1248, -1172, -1004, -751, -453, -209, -64, 95, 371, 590, 458, -10, -527, -960, -1382, -1756, -1921, -1853, -1659, -1409, -1161, -892, -361, 596, 1611, 2089, 1977, 1722, 1580, 1436, 1148, 641, -141, -1063, -1749, -1934, -1653, -1056, -284, 458, 1001, 1406, 1845, 2343, 2728, 2815, 2552, 2081, 1682, 1566, 1674, 1792, 1854, 1996, 2258, 2400, 2208, 1882, 1832, 2107, 2280, 2037, 1630, 1618, 2208, 3011, 3440, 3305, 2934, 2735, 2754, 2745, 2510, 2077, 1630, 1423, 1621, 2111, 2573, 2804, 2799, 2596, 2281, 2063, 2035, 1968, 1638, 1188, 962, 1118, 1585, 2135, 2465, 2459, 2315, 2169, 1802, 1058, 224, -347, -684, -939, -1003, -708, -152, 404, 802, 1045, 1199, 1305, 1283, 954, 263, -527, -1020, -1099, -1005, -920, -729, -376, -72, 38, 67, 38, -219, -684, -1088, -1316, -1462, -1507, -1428, -1409, -1508, -1395, -857, -290, -251, -725, -1158, -1119, -759, -632, -1036, -1582, -1732, -1637, -1910, -2634, -3256, -3581, -4064, -4976, -5840, -5960, -5153, -3842, -2615, -1661, -635, 777, 2249, 3114, 3111, 2452, 1347, -95, -1607, -2838, -3697, -4345, -4760, -4608, -3628, -1978, -68, 1707, 3024, 3734, 4088, 4541, 5124, 5399, 5121, 4568, 4107, 3850, 3801, 3922, 4046, 4001, 3814, 3638, 3641, 3987, 4640, 5309, 5912, 6756, 7909, 8980, 9838, 10675, 11173, 10792, 9957, 9548, 9366, 8633, 7692, 7504, 8009, 8484, 8894, 9556, 10228, 10580, 10749, 10853, 10746, 10421, 9962, 9312, 8767, 8971, 9897, 10662, 10835, 10958, 11398, 11700, 11399, 10613, 9577, 8297, 6900, 5775, 5095, 4648, 4349, 4485, 5110, 5727, 6048, 6447, 7060, 7260, 6665, 5804, 5156, 4489, 3589, 2664, 1772, 751, -206, -790, -1206, -1841, -2615, -3202, -3521, -3603, -3450, -3227, -3176, -3217, -3084, -2813, -2777, -3239, -4164, -5302, -6390, -7412, -8586, -9925, -11019, -11560, -11701, -11669, -11375, -10764, -10134, -9763, -9567, -9387, -9319, -9558, -10156, -11011, -11910, -12621, -13047, -13338, -13690, -14092, -14376, -14412, -14242, -14013, -13847, -13754, -13680, -13542, -13256, -12780, -12271, -12006, -12065, -12193, -12183, -12189, -12433, -12831, -13106, -13215, -13323, -13406, -13220, -12669, -12007, -11529, -11262, -11098, -10991, -10899, -10744, -10610, -10674, -10838, -10722, -10163, -9443, -8947, -8759, -8630, -8305, -7889, -7833, -8294, -8757, -8714, -8480, -8659, -9070, -8920, -7956, -6778, -6014, -5663, -5285, -4576, -3730, -3277, -3466, -3953, -4245, -4279, -4300, -4477, -4841, -5276, -5467, -5148, -4468, -3788, -3201, -2598, -1978, -1331, -544, 262, 708, 689, 495, 267, -151, -783, -1429, -2015, -2564, -2900, -2770, -2181, -1358, -480, 359, 1091, 1709, 2260, 2688, 2790, 2410, 1645, 798, 133, -291, -553, -704, -726, -608, -372, -52, 307, 636, 866, 1000, 1129, 1337, 1543, 1598, 1553, 1615, 1738, 1627, 1250, 851, 437, -122, -573, -626, -573, -708, -588, 193, 1083, 1427, 1604, 2223, 2825, 2496, 1374, 499, 342, 379, 185, 58, 336, 792, 1190, 1824, 2870, 3646, 3359, 2369, 1709, 1399, 561, -686, -1076, -336, 279, 267, 844, 2772, 4904, 5852, 5759, 5570, 5500, 5009, 3740, 1974, 316, -814, -1371, -1465, -1230, -854, -330, 813, 2806, 4764, 5555, 5427, 5579, 6204, 6461, 6114, 5640, 5054, 4105, 3209, 2835, 2579, 1962, 1445, 1615, 2077, 2104, 1868, 2200, 3376, 4791, 5830, 6507, 7117, 7669, 7998, 8086, 7903, 7171, 5781, 4282, 3372, 2960, 2408, 1703, 1600, 2427, 3604, 4583, 5524, 6666, 7698, 8189, 8157, 7908, 7541, 6891, 5879, 4746, 3864, 3342, 3053, 3020, 3312, 3596, 3540, 3605, 4442, 5574, 5881, 5331, 4900, 4910, 4835, 4572, 4511, 4477, 3877, 2925, 2574, 3108, 3668, 3503, 2906, 2526, 2419, 2321, 2296, 2465, 2545, 2299, 2066, 2223, 2474, 2333, 2046, 2183, 2503, 2212, 1414, 1109, 1512, 1607, 894, 298, 658, 1367, 1410, 932, 777, 990, 876, 322, 1, 149, 151, -325, -664, -276, 425, 773, 949, 1443, 1894, 1676, 1179, 1161, 1232, 497, -746, -1550, -1940, -2462, -2688, -1887, -666, -290, -575, -54, 1621, 2926, 2649, 1550, 959, 808, 185, -899, -1633, -1860, -2138, -2466, -2171, -1233, -527, -375, -53, 777, 1328, 1054, 613, 689, 860, 530, 117, 275, 575, 143, -765, -1119, -855, -925, -1502, -1635, -977, -423, -436, -66, 1445, 3140, 3591, 3001, 2689, 2908, 2607, 1317, -186, -1191, -1801, -2192, -2204, -1791, -1127, -141, 1337, 2911, 3806, 3933, 4012, 4301, 4023, 2651, 925, -132, -468, -598, -709, -700, -512, -2, 948, 2033, 2689, 2765, 2644, 2644, 2661, 2493, 2172, 1814, 1427, 1113, 1169, 1659, 2072, 1850, 1151, 664, 745, 1024, 942, 462, 95, 233, 653, 879, 918, 1197, 1791, 2147, 1845, 1264, 1108, 1450, 1633, 1175, 381, -38, 281, 1128, 1909, 2011, 1309, 401, 36, 251, 362, -195, -1260, -2118, -2118, -1227, -77, 669, 938, 1134, 1514, 1946, 2110, 1742, 823, -269, -1085, -1674, -2524, -3752, -4717, -4840, -4498, -4566, -5123, -5203, -4076, -2299, -1052, -666, -388, 428, 1480, 2089, 2020, 1377, 270, -1031, -2172, -3208, -4406, -5498, -5888, -5533, -4806, -3778, -2414, -1029, 212, 1624, 3214, 4347, 4653, 4432, 4008, 3450, 2881, 2319, 1545, 682, 265, 360, 479, 574, 1038, 1787, 2441, 3194, 4365, 5582, 6415, 7152, 8070, 8726, 8727, 8446, 8305, 8054, 7341, 6391, 5707, 5398, 5249, 5225, 5514, 6149, 6890, 7583, 8315, 9106, 9698, 9878, 9838, 9869, 9921, 9857, 9871, 10026, 9848, 9134, 8614, 8855, 9209, 8820, 7892, 7028, 6250, 5515, 5174, 5262, 5280, 5094, 5170, 5733, 6468, 7068, 7467, 7621, 7493, 7161, 6633, 5791, 4655, 3468, 2434, 1489, 504, -436, -1106, -1412, -1462, -1378, -1244, -1129, -1010, -765, -443, -313, -516, -810, -966, -1217, -1970, -3125, -4167, -4975, -5948, -7141, -8031, -8465, -8909, -9417, -9441, -8917, -8423, -8094, -7544, -6896, -6709, -6979, -7243, -7492, -8069, -8966, -9871, -10710, -11579, -12330, -12701, -12729, -12695, -12709, -12633, -12420, -12216, -12026, -11697, -11266, -11005, -11015, -11127, -11213, -11264, -11257, -11216, -11371, -11920, -12636, -13040, -12997, -12874, -12982, -13139, -13013, -12623, -12228, -11864, -11382, -10827, -10481, -10448, -10490, -10359, -10137, -10061, -10151, -10236, -10206, -10107, -10036, -10062, -10141, -10172, -10185, -10301, -10408, -10240, -9872, -9638, -9441, -8847, -7918, -7177, -6723, -6169, -5513, -5204, -5347, -5527, -5584, -5868, -6534, -7136, -7233, -6996, -6817, -6638, -6144, -5399, -4788, -4390, -3903, -3175, -2463, -2085, -2047, -2078, -1949, -1675, -1487, -1569, -1856, -2090, -2156, -2234, -2446, -2582, -2457, -2246, -2100, -1744, -931, 45, 751, 1186, 1579, 1927, 2099, 2113, 1979, 1523, 712, -51, -325, -214, -161, -249, -147, 265, 756, 1240, 1878, 2556, 2808, 2511, 2246, 2509, 2975, 3029, 2714, 2483, 2363, 2146, 2026, 2206, 2288, 1866, 1242, 942, 1044, 1434, 2026, 2493, 2555, 2542, 2977, 3697, 4090, 3968, 3578, 3100, 2597, 2221, 2065, 2027, 1984, 1967, 2089, 2450, 3026, 3571, 3811, 3746, 3575, 3377, 3144, 2991, 3016, 3081, 3040, 3025, 3216, 3575, 3987, 4350, 4431, 3977, 3141, 2453, 2263, 2409, 2430, 2033, 1468, 1426, 2324, 3699, 4665, 4896, 4789, 4755, 4771, 4607, 4151, 3415, 2536, 1880, 1835, 2278, 2643, 2735, 2987, 3615, 4168, 4343, 4476, 4753, 4731, 4157, 3508, 3232, 3150, 3037, 3113, 3545, 3912, 3771, 3401, 3447, 3916, 4112, 3652, 3033, 2937, 3404, 3968, 4341, 4582, 4785, 4954, 5127, 5308, 5326, 5034, 4538, 3990, 3326, 2570, 2126, 2364, 3048, 3581, 3756, 3921, 4404, 5061, 5520, 5595, 5302, 4710, 3998, 3414, 3040, 2795, 2665, 2640, 2597, 2595, 2941, 3578, 3970, 3960, 3971, 4060, 3732, 2989, 2533, 2613, 2671, 2347, 1962, 1895, 2116, 2417, 2631, 2644, 2475, 2258, 2062, 1897, 1776, 1605, 1258, 931, 1034, 1552, 1999, 2088, 1984, 1884, 1884, 2074, 2257, 1946, 1139, 526, 485, 585, 498, 551, 981, 1441, 1579, 1503, 1421, 1374, 1347, 1302, 1087, 599, 31, -250, -61, 397, 735, 778, 735, 875, 1132, 1223, 1097, 1016, 1111, 1115, 751, 255, 150, 525, 942, 1100, 1144, 1234, 1287, 1272, 1290, 1281, 1044, 609, 241, 56, -35, -34, 184, 566, 901, 1182, 1579, 1932, 1810, 1291, 1070, 1406, 1560, 854, -179, -417, 345, 1239, 1606, 1656, 1686, 1624, 1559, 1779, 1975, 1490, 555, 54, 75, -41, -251, 123, 986, 1476, 1457, 1735, 2546, 3070, 2844, 2526, 2542, 2139, 856, -275, -266, 147, -216, -1027, -1102, -267, 672, 1216, 1481, 1600, 1620, 1788, 2253, 2588, 2218, 1339, 745, 735, 849, 741, 564, 418, 134, -257, -440, -347, -298, -388, -266, 233, 720, 911, 1164, 1820, 2461, 2482, 2017, 1665, 1566, 1323, 690, -174, -1003, -1577, -1648, -1135, -458, -214, -375, -258, 492, 1376, 1704, 1401, 919, 675, 688, 612, 209, -259, -408, -373, -521, -739, -697, -505, -427, -357, -240, -399, -823, -872, -269, 368, 481, 276, 173, 222, 354, 583, 778, 635, 43, -710, -1187, -1198, -1003, -995, -1163, -1094, -636, -113, 219, 478, 734, 825, 711, 451, -71, -876, -1608, -2061, -2499, -3009, -3235, -3135, -3178, -3429, -3346, -2798, -2330, -2245, -2243, -2176, -2399, -3015, -3470, -3364, -3144, -3388, -3846, -3914, -3644, -3459, -3361, -3182, -3190, -3669, -4276, -4494, -4386, -4378, -4603, -4867, -5031, -5038, -4737, -4105, -3520, -3323, -3265, -2943, -2574, -2642, -2982, -3053, -2894, -2992, -3360, -3522, -3361, -3264, -3379, -3353, -2976, -2534, -2253, -1923, -1433, -1091, -1012, -786, -188, 406, 643, 626, 557, 520, 645, 938, 1040, 690, 257, 318, 886, 1460, 1746, 1984, 2527, 3328, 4003, 4335, 4537, 4888, 5301, 5378, 4938, 4342, 4107, 4275, 4435, 4402, 4431, 4683, 4963, 5204, 5664, 6358, 6830, 6773, 6501, 6466, 6606, 6534, 6164, 5819, 5757, 5933, 6180, 6330, 6249, 6036, 6054, 6398, 6616, 6316, 5756, 5399, 5237, 4983, 4639, 4441, 4406, 4326, 4150, 4076, 4199, 4371, 4418, 4324, 4097, 3694, 3155, 2626, 2197, 1842, 1509, 1120, 614, 126, -39, 205, 463, 282, -222, -539, -571, -765, -1292, -1752, -1936, -2184, -2639, -2919, -2881, -2978, -3487, -3999, -4125, -4165, -4567, -5166, -5474, -5497, -5636, -5922, -6006, -5858, -5843, -6071, -6239, -6234, -6329, -6660, -7023, -7300, -7698, -8272, -8645, -8573, -8382, -8447, -8585, -8456, -8147, -7934, -7811, -7706, -7787, -8145, -8494, -8560, -8511, -8674, -9005, -9166, -9082, -8983, -8959, -8857, -8654, -8548, -8591, -8607, -8523, -8474, -8515, -8526, -8442, -8327, -8194, -7948, -7622, -7418, -7411, -7415, -7312, -7269, -7428, -7605, -7573, -7449, -7475, -7570, -7410, -6958, -6528, -6293, -6085, -5792, -5568, -5478, -5373, -5242, -5306, -5578, -5763, -5674, -5419, -5163, -4990, -4896, -4753, -4435, -4063, -3857, -3786, -3694, -3643, -3743, -3843, -3759, -3575, -3411, -3246, -3118, -3061, -2894, -2506, -2207, -2250, -2364, -2263, -2174, -2303, -2349, -2058, -1711, -1611, -1573, -1307, -914, -667, -588, -532, -502, -593, -731, -720, -551, -453, -516, -511, -236, 138, 339, 422, 570, 682, 608, 581, 860, 1153, 1046, 779, 925, 1426, 1658, 1464, 1390, 1733, 2053, 1976, 1831, 1947, 2039, 1891, 1913, 2315, 2559, 2304, 2070, 2304, 2670, 2767, 2760, 2886, 3007, 3004, 3023, 3147, 3198, 3066, 2936, 3003, 3153, 3145, 3039, 3163, 3553, 3774, 3574, 3384, 3664, 4110, 4132, 3839, 3757, 3859, 3718, 3413, 3437, 3762, 3830, 3493, 3295, 3605, 4083, 4266, 4222, 4231, 4246, 4125, 4026, 4090, 4110, 3874, 3547, 3378, 3387, 3527, 3782, 4040, 4166, 4216, 4315, 4394, 4288, 4032, 3830, 3778, 3762, 3664, 3551, 3598, 3837, 4051, 4016, 3773, 3544, 3456, 3465, 3471, 3366, 3092, 2798, 2786, 3144, 3583, 3823, 3874, 3846, 3731, 3518, 3278, 3062, 2879, 2741, 2606, 2388, 2147, 2106, 2366, 2787, 3171, 3372, 3306, 3044, 2836, 2804, 2724, 2304, 1612, 1027, 794, 850, 1089, 1479, 1855, 1995, 2012, 2217, 2481, 2354, 1899, 1683, 1758, 1515, 772, 264, 600, 1365, 1733, 1575, 1373, 1357, 1390, 1456, 1589, 1497, 975, 485, 576, 1033, 1270, 1270, 1439, 1792, 1975, 1922, 1895, 1878, 1542, 909, 483, 501, 620, 592, 656, 978, 1312, 1512, 1832, 2391, 2791, 2631, 2070, 1560, 1262, 1078, 1006, 1062, 1046, 891, 968, 1557, 2269, 2569, 2492, 2382, 2276, 2071, 1904, 1917, 1904, 1625, 1288, 1313, 1725, 2165, 2472, 2810, 3189, 3323, 3111, 2829, 2653, 2398, 1899, 1358, 1110, 1261, 1605, 1878, 2071, 2418, 2970, 3412, 3482, 3313, 3121, 2846, 2400, 1966, 1748, 1661, 1541, 1451, 1534, 1763, 2019, 2287, 2577, 2762, 2677, 2377, 2135, 2130, 2235, 2223, 2129, 2139, 2192, 2085, 1970, 2161, 2459, 2350, 1873, 1512, 1329, 1101, 1003, 1264, 1536, 1476, 1453, 1888, 2503, 2853, 2991, 3026, 2687, 1890, 1199, 1114, 1274, 966, 226, -181, 115, 671, 1030, 1344, 1816, 2133, 1975, 1692, 1817, 2125, 1943, 1269, 805, 834, 901, 684, 469, 506, 583, 497, 434, 552, 622, 415, 131, 59, 62, -122, -310, -125, 344, 638, 575, 365, 189, 33, -127, -256, -364, -585, -1048, -1598, -1768, -1332, -762, -654, -867, -810, -425, -183, -267, -451, -665, -1036, -1449, -1624, -1601, -1679, -1915, -2039, -1926, -1754, -1620, -1389, -1074, -990, -1293, -1710, -1952, -2073, -2185, -2170, -1949, -1785, -1901, -2002, -1703, -1243, -1156, -1385, -1465, -1430, -1678, -2102, -2253, -2240, -2538, -3009, -2985, -2385, -1903, -1907, -1926, -1584, -1254, -1284, -1331, -1147, -1196, -1745, -2166, -1943, -1591, -1779, -2179, -2051, -1453, -1035, -946, -792, -562, -713, -1235, -1484, -1205, -937, -1099, -1389, -1396, -1168, -833, -275, 390, 579, 38, -546, -434, 61, 111, -305, -489, -247, -73, -76, 258, 954, 1186, 621, 159, 479, 818, 272, -613, -815, -508, -444, -434, 205, 1273, 1889, 1775, 1508, 1592, 1826, 1649, 910, 65, -463, -795, -1067, -949, -212, 663, 1177, 1586, 2298, 3043, 3314, 3100, 2568, 1643, 444, -450, -707, -730, -967, -1127, -646, 375, 1297, 1869, 2356, 2786, 2818, 2395, 1885, 1477, 1048, 649, 538, 640, 550, 249, 257, 743, 1099, 865, 444, 327, 333, 240, 368, 852, 1161, 1036, 1107, 1814, 2418, 2032, 1102, 738, 882, 534, -321, -682, -409, -390, -668, -321, 646, 1110, 736, 436, 718, 969, 674, 206, 31, -23, -229, -336, -34, 384, 440, 219, 114, 64, -245, -612, -555, -302, -617, -1416, -1612, -766, 167, 375, 310, 581, 858, 703, 488, 614, 630, -42, -1035, -1445, -1074, -644, -744, -1070, -974, -399, 158, 443, 639, 808, 685, 226, -107, 60, 423, 372, -159, -641, -717, -596, -587, -668, -735, -892, -1185, -1385, -1285, -987, -773, -853, -1307, -1963, -2375, -2226, -1780, -1628, -1953, -2318, -2269, -1855, -1407, -1049, -751, -621, -809, -1164, -1353, -1357, -1508, -1913, -2240, -2304, -2380, -2590, -2538, -1997, -1389, -1078, -805, -313, 102, 142, 41, 109, 210, 52, -294, -575, -753, -876, -779, -388, -47, -10, 73, 539, 1012, 1086, 1131, 1611, 2133, 2068, 1678, 1718, 2207, 2458, 2219, 2011, 2193, 2383, 2136, 1743, 1797, 2297, 2724, 2858, 2982, 3260, 3490, 3599, 3826, 4187, 4305, 4028, 3751, 3779, 3892, 3815, 3697, 3752, 3851, 3765, 3565, 3504, 3622, 3718, 3684, 3614, 3583, 3522, 3409, 3402, 3616, 3870, 3845, 3513, 3207, 3219, 3438, 3460, 3073, 2499, 2145, 2130, 2162, 1915, 1464, 1167, 1185, 1321, 1349, 1261, 1134, 976, 812, 728, 718, 586, 201, -274, -564, -656, -821, -1202, -1589, -1753, -1837, -2112, -2462, -2521, -2299, -2194, -2370, -2581, -2669, -2759, -2907, -3023, -3189, -3618, -4229, -4635, -4689, -4703, -4997, -5428, -5614, -5472, -5315, -5355, -5385, -5205, -5047, -5181, -5385, -5379, -5438, -5896, -6387, -6419, -6250, -6366, -6634, -6691, -6624, -6623, -6555, -6375, -6326, -6472, -6577, -6579, -6635, -6711, -6630, -6448, -6400, -6493, -6496, -6290, -6060, -6044, -6237, -6417, -6435, -6394, -6379, -6263, -6013, -5925, -6153, -6321, -6056, -5616, -5427, -5390, -5188, -4941, -4957, -5123, -5081, -4817, -4648, -4692, -4745, -4622, -4404, -4231, -4107, -3991, -3933, -3949, -3908, -3685, -3379, -3237, -3353, -3532, -3459, -3024, -2470, -2121, -2038, -2037, -1979, -1836, -1581, -1269, -1123, -1289, -1626, -1865, -1878, -1693, -1440, -1319, -1385, -1372, -975, -294, 259, 455, 418, 396, 506, 688, 776, 680, 463, 191, -140, -408, -367, 1, 406, 629, 754, 904, 1070, 1246, 1461, 1624, 1594, 1427, 1327, 1367, 1432, 1417, 1344, 1264, 1222, 1312, 1561, 1731, 1522, 1055, 862, 1181, 1593, 1590, 1303, 1273, 1678, 2157, 2368, 2358, 2281, 2160, 2039, 2056, 2153, 2041, 1632, 1251, 1191, 1329, 1441, 1643, 2081, 2403, 2195, 1764, 1820, 2398, 2828, 2756, 2448, 2164, 1930, 1916, 2350, 2948, 3050, 2502, 1944, 1960, 2348, 2535, 2343, 1970, 1584, 1380, 1664, 2432, 3139, 3312, 3148, 3141, 3350, 3448, 3340, 3232, 3126, 2722, 2011, 1545, 1797, 2507, 3002, 2997, 2809, 2827, 3124, 3544, 3855, 3810, 3374, 2913, 2825, 3020, 3105, 2973, 2815, 2738, 2775, 3022, 3394, 3475, 3008, 2333, 2046, 2338, 2834, 3011, 2759, 2533, 2799, 3407, 3768, 3631, 3300, 3075, 2873, 2542, 2173, 1933, 1790, 1624, 1485, 1547, 1863, 2321, 2784, 3094, 3074, 2759, 2449, 2312, 2225, 2106, 1973, 1649, 1048, 670, 1040, 1788, 2080, 1855, 1748, 1971, 2112, 1949, 1700, 1495, 1162, 678, 371, 506, 873, 1047, 969, 983, 1269, 1562, 1627, 1631, 1707, 1545, 938, 291, 88, 209, 300, 353, 445, 407, 230, 318, 862, 1394, 1353, 813, 317, 180, 286, 413, 454, 326, -1, -292, -167, 365, 785, 650, 149, -195, -193, -53, 64, 223, 405, 430, 279, 182, 299, 508, 600, 492, 228, -114, -409, -511, -381, -179, -95, -139, -147, 61, 520, 981, 1026, 537, -1, -42, 254, 193, -484, -1218, -1344, -849, -311, -181, -305, -174, 391, 964, 1021, 559, 14, -295, -425, -598, -893, -1130, -1047, -619, -195, -127, -317, -311, 115, 649, 751, 197, -684, -1305, -1338, -996, -774, -919, -1206, -1186, -621, 205, 688, 554, 209, 149, 257, 102, -332, -727, -987, -1220, -1340, -1204, -925, -682, -415, -43, 249, 233, 31, -16, 177, 321, 140, -287, -674, -810, -698, -514, -515, -791, -1064, -911, -304, 253, 335, 137, 140, 431, 726, 886, 958, 825, 336, -301, -692, -748, -721, -783, -861, -793, -508, -63, 416, 858, 1234, 1443, 1329, 914, 457, 180, 35, -171, -504, -797, -807, -431, 196, 782, 1087, 1069, 870, 674, 573, 504, 310, -104, -627, -984, -958, -588, -172, 31, 113, 375, 803, 1000, 817, 628, 679, 605, 38, -682, -899, -544, -183, -221, -461, -484, -147, 387, 843, 940, 570, 40, -142, 146, 463, 334, -215, -760, -929, -715, -440, -424, -633, -717, -419, 117, 560, 760, 842, 935, 990, 911, 717, 478, 192, -179, -617, -1014, -1188, -1000, -550, -131, 105, 267, 458, 636, 808, 1022, 1137, 911, 400, -25, -122, -16, 44, -14, -99, -126, -87, -11, 6, -163, -568, -1140, -1797, -2340, -2335, -1572, -564, -24, 99, 434, 1155, 1844, 2203, 2189, 1641, 475, -859, -1696, -1869, -1773, -1803, -1954, -1894, -1322, -303, 779, 1556, 1885, 1805, 1505, 1292, 1301, 1327, 1153, 868, 644, 488, 453, 705, 1144, 1348, 1175, 1033, 1272, 1669, 1826, 1782, 1890, 2258, 2661, 2986, 3334, 3689, 3856, 3774, 3583, 3369, 3145, 2982, 2877, 2680, 2399, 2337, 2679, 3192, 3580, 3879, 4267, 4663, 4810, 4697, 4629, 4786, 4928, 4733, 4319, 4159, 4430, 4731, 4577, 4019, 3542, 3418, 3405, 3214, 2958, 2896, 2986, 3086, 3324, 3833, 4387, 4706, 4852, 4921, 4698, 4049, 3263, 2659, 2142, 1480, 787, 392, 400, 607, 827, 1063, 1359, 1667, 1912, 2035, 1951, 1615, 1117, 581, 26, -532, -984, -1271, -1493, -1738, -1948, -2040, -2052, -2071, -2108, -2158, -2268, -2479, -2729, -2876, -2880, -2884, -3061, -3368, -3591, -3641, -3706, -4037, -4616, -5137, -5375, -5424, -5489, -5601, -5686, -5780, -5923, -6018, -5997, -5961, -5988, -6013, -6022, -6106, -6237, -6278, -6257, -6334, -6505, -6611, -6657, -6833, -7201, -7578, -7808, -7946, -8092, -8150, -7948, -7517, -7111, -6906, -6792, -6594, -6361, -6311, -6519, -6840, -7100, -7267, -7407, -7579, -7751, -7808, -7661, -7381, -7104, -6824, -6502, -6257, -6224, -6304, -6277, -6136, -6055, -6081, -6081, -5947, -5723, -5540, -5462, -5398, -5224, -5016, -4983, -5116, -5141, -4932, -4716, -4691, -4697, -4479, -4097, -3819, -3716, -3608, -3380, -3155, -3048, -2991, -2874, -2729, -2640, -2586, -2477, -2279, -2041, -1860, -1803, -1835, -1860, -1852, -1839, -1774, -1577, -1282, -979, -692, -410, -144, 143, 466, 638, 498, 239, 152, 153, -11, -268, -336, -198, -26, 202, 608, 1093, 1439, 1581, 1616, 1610, 1569, 1522, 1479, 1407, 1306, 1295, 1447, 1632, 1695, 1714, 1841, 1994, 1958, 1761, 1654, 1714, 1754, 1671, 1641, 1808, 2039, 2184, 2359, 2698, 3017, 3025, 2757, 2518, 2472, 2515, 2471, 2250, 1904, 1637, 1687, 2085, 2555, 2767, 2682, 2571, 2707, 3074, 3412, 3489, 3283, 2970, 2776, 2821, 3013, 3134, 3051, 2844, 2693, 2688, 2792, 2933, 3046, 3075, 3030, 3024, 3161, 3409, 3651, 3811, 3864, 3792, 3620, 3482, 3507, 3617, 3567, 3253, 2916, 2905, 3247, 3632, 3808, 3849, 3926, 4019, 4019, 3978, 4036, 4150, 4099, 3802, 3467, 3348, 3475, 3721, 3944, 4009, 3841, 3600, 3604, 3900, 4173, 4151, 3928, 3746, 3721, 3848, 4055, 4200, 4174, 4033, 3917, 3866, 3819, 3762, 3730, 3649, 3385, 3035, 2907, 3074, 3269, 3319, 3331, 3347, 3283, 3252, 3436, 3652, 3564, 3237, 3012, 2954, 2897, 2799, 2705, 2543, 2272, 2037, 1974, 2030, 2073, 2049, 1979, 1930, 1982, 2152, 2329, 2361, 2232, 2075, 1995, 1931, 1748, 1418, 1027, 679, 460, 435, 578, 728, 740, 693, 799, 1074, 1294, 1313, 1195, 989, 670, 347, 218, 237, 151, -94, -284, -272, -126, 49, 204, 241, 73, -212, -398, -396, -357, -455, -632, -692, -574, -413, -318, -245, -135, -63, -128, -310, -521, -751, -1026, -1288, -1445, -1516, -1591, -1647, -1536, -1212, -849, -659, -649, -650, -577, -520, -602, -819, -1074, -1314, -1562, -1807, -1918, -1798, -1589, -1560, -1730, -1818, -1635, -1316, -1090, -1053, -1183, -1383, -1455, -1277, -985, -844, -958, -1224, -1453, -1508, -1443, -1487, -1734, -1972, -2002, -1907, -1830, -1720, -1517, -1327, -1202, -1029, -797, -722, -906, -1092, -1011, -837, -978, -1468, -1873, -1868, -1591, -1398, -1462, -1681, -1772, -1514, -1038, -768, -886, -1084, -1003, -739, -641, -753, -791, -657, -577, -688, -840, -910, -950, -942, -821, -798, -1177, -1736, -1812, -1215, -600, -559, -773, -578, -52, 231, 202, 178, 71, -357, -782, -805, -726, -957, -1224, -1144, -964, -988, -916, -428, 117, 161, -236, -512, -374, -90, -44, -267, -515, -629, -587, -357, -14, 80, -358, -981, -1110, -683, -313, -357, -517, -491, -364, -214, 85, 511, 782, 709, 361, -88, -468, -629, -597, -623, -901, -1227, -1165, -602, 38, 301, 226, 217, 521, 963, 1111, 698, -44, -576, -679, -650, -762, -905, -916, -815, -579, -148, 318, 572, 645, 685, 662, 548, 493, 497, 335, 0, -192, -117, -5, 11, 79, 247, 284, 84, -87, 45, 339, 452, 354, 338, 538, 737, 738, 675, 788, 1068, 1295, 1315, 1086, 658, 309, 378, 732, 788, 365, 41, 280, 730, 842, 688, 700, 913, 1019, 959, 968, 1084, 1105, 1040, 1140, 1362, 1349, 1026, 711, 540, 236, -394, -1160, -1728, -1919, -1750, -1415, -1169, -1036, -674, 257, 1588, 2711, 3173, 2984, 2329, 1370, 359, -453, -1174, -2131, -3225, -3820, -3474, -2448, -1312, -317, 621, 1549, 2324, 2810, 2923, 2572, 1762, 736, -169, -826, -1268, -1443, -1231, -706, -135, 317, 734, 1194, 1604, 1856, 1970, 1944, 1731, 1456, 1410, 1651, 1914, 2020, 2110, 2333, 2579, 2632, 2428, 2072, 1735, 1583, 1675, 1873, 1968, 1979, 2200, 2834, 3661, 4232, 4341, 4157, 3944, 3783, 3624, 3434, 3246, 3102, 3046, 3090, 3170, 3225, 3304, 3447, 3474, 3173, 2689, 2431, 2565, 2904, 3200, 3331, 3327, 3459, 3973, 4603, 4737, 4193, 3402, 2754, 2222, 1680, 1135, 643, 313, 342, 767, 1308, 1674, 1896, 2160, 2446, 2532, 2314, 1907, 1432, 874, 248, -301, -648, -813, -883, -936, -1035, -1178, -1265, -1253, -1244, -1313, -1424, -1562, -1736, -1824, -1715, -1537, -1495, -1607, -1821, -2190, -2704, -3193, -3565, -3908, -4233, -4427, -4501, -4570, -4579, -4351, -3958, -3748, -3873, -4077, -4096, -4037, -4146, -4383, -4542, -4628, -4797, -5025, -5157, -5216, -5381, -5674, -5953, -6137, -6293, -6464, -6550, -6422, -6102, -5749, -5485, -5291, -5149, -5124, -5231, -5361, -5474, -5710, -6111, -6479, -6640, -6677, -6695, -6606, -6356, -6143, -6166, -6312, -6307, -6083, -5850, -5813, -5917, -5917, -5685, -5372, -5193, -5146, -5079, -4946, -4877, -4978, -5201, -5415, -5547, -5620, -5695, -5708, -5497, -5078, -4693, -4448, -4146, -3706, -3387, -3343, -3357, -3239, -3155, -3237, -3297, -3131, -2879, -2811, -2962, -3114, -3067, -2830, -2604, -2563, -2677, -2720, -2480, -1954, -1347, -862, -542, -299, -80, 54, 41, -105, -346, -693, -1106, -1400, -1394, -1120, -759, -434, -117, 297, 858, 1407, 1660, 1542, 1291, 1113, 982, 909, 1019, 1204, 1140, 870, 916, 1499, 2090, 2074, 1587, 1257, 1327, 1477, 1447, 1372, 1406, 1489, 1633, 2039, 2712, 3282, 3431, 3260, 3050, 2846, 2514, 2080, 1752, 1606, 1505, 1367, 1358, 1683, 2304, 2928, 3265, 3281, 3221, 3325, 3530, 3533, 3188, 2714, 2439, 2429, 2521, 2631, 2780, 2880, 2784, 2572, 2505, 2627, 2702, 2585, 2437, 2479, 2711, 3013, 3332, 3631, 3773, 3663, 3441, 3338, 3356, 3260, 2893, 2347, 1904, 1845, 2188, 2586, 2687, 2602, 2759, 3314, 3952, 4235, 3987, 3424, 3023, 3047, 3198, 3032, 2603, 2314, 2301, 2410, 2579, 2778, 2829, 2688, 2677, 3017, 3406, 3416, 3110, 2905, 2961, 3061, 3072, 3119, 3233, 3159, 2742, 2260, 2100, 2245, 2351, 2241, 2050, 1937, 1951, 2195, 2701, 3161, 3152, 2755, 2520, 2718, 3003, 2935, 2500, 2003, 1671, 1509, 1402, 1274, 1194, 1343, 1756, 2141, 2178, 2023, 2152, 2612, 2888, 2668, 2246, 1974, 1807, 1624, 1487, 1411, 1260, 1057, 1047, 1311, 1574, 1590, 1508, 1630, 1941, 2097, 1903, 1559, 1367, 1386, 1477, 1526, 1485, 1323, 1144, 1171, 1434, 1600, 1403, 1042, 847, 809, 702, 498, 351, 359, 512, 723, 861, 935, 1107, 1388, 1488, 1235, 831, 528, 333, 180, 82, -29, -273, -564, -630, -352, 69, 274, 64, -330, -410, -25, 333, 164, -337, -620, -555, -444, -478, -571, -664, -784, -886, -894, -897, -1050, -1287, -1362, -1220, -1105, -1171, -1200, -923, -498, -383, -717, -1155, -1383, -1453, -1511, -1586, -1737, -1975, -1988, -1533, -996, -928, -1163, -1152, -901, -844, -1072, -1367, -1678, -1997, -2117, -1919, -1608, -1406, -1318, -1244, -1099, -890, -809, -993, -1200, -1146, -1036, -1231, -1589, -1728, -1659, -1594, -1466, -1195, -1013, -1053, -1056, -859, -717, -804, -877, -771, -797, -1190, -1500, -1155, -405, -42, -273, -592, -697, -770, -817, -541, -68, -65, -719, -1232, -915, -197, 124, 84, 109, 37, -398, -699, -313, 304, 366, -117, -598, -775, -602, -116, 374, 471, 170, -187, -344, -229, 71, 266, 143, -63, 10, 267, 333, 200, 186, 338, 362, 162, -20, -74, -181, -391, -420, -158, 29, -153, -367, -92, 489, 681, 351, 160, 443, 626, 247, -199, -142, 134, 156, 77, 133, 56, -318, -593, -451, -156, -94, -311, -591, -630, -303, 102, 192, 69, 169, 478, 505, 91, -292, -275, -126, -281, -684, -979, -1098, -1169, -1069, -626, -133, -51, -316, -455, -240, 159, 442, 359, -98, -575, -756, -807, -1035, -1315, -1336, -1171, -1151, -1285, -1267, -928, -434, -70, 5, -145, -316, -325, -163, 0, -14, -268, -667, -1018, -1161, -1102, -1017, -1055, -1136, -1012, -584, -165, -170, -511, -618, -325, -172, -454, -671, -496, -477, -1048, -1649, -1644, -1362, -1426, -1672, -1525, -1057, -823, -870, -691, -171, 180, 105, -32, 38, 96, -55, -291, -508, -698, -683, -336, 24, 5, -174, 77, 791, 1292, 1119, 681, 632, 975, 1211, 1180, 1205, 1454, 1665, 1629, 1570, 1842, 2390, 2767, 2687, 2365, 2179, 2199, 2274, 2411, 2661, 2808, 2634, 2395, 2559, 3147, 3759, 4080, 4087, 3933, 3863, 4007, 4119, 3854, 3360, 3159, 3404, 3671, 3642, 3537, 3690, 3987, 4069, 3955, 4061, 4487, 4664, 4150, 3480, 3525, 4131, 4297, 3738, 3271, 3394, 3556, 3262, 2935, 3110, 3475, 3357, 2740, 2302, 2490, 2967, 3092, 2764, 2419, 2304, 2191, 1941, 1814, 1923, 1851, 1257, 559, 474, 976, 1294, 962, 404, 241, 424, 432, 111, -193, -328, -604, -1147, -1518, -1415, -1250, -1501, -1895, -1892, -1614, -1606, -1957, -2267, -2368, -2507, -2866, -3274, -3484, -3511, -3583, -3810, -4006, -3955, -3716, -3546, -3582, -3778, -4059, -4355, -4591, -4794, -5082, -5419, -5568, -5444, -5229, -5056, -4903, -4800, -4856, -5010, -5105, -5142, -5253, -5494, -5805, -6022, -5933, -5596, -5441, -5673, -5864, -5620, -5272, -5334, -5680, -5822, -5693, -5610, -5713, -5850, -5807, -5522, -5148, -4930, -4884, -4811, -4689, -4725, -4941, -5123, -5194, -5269, -5339, -5304, -5219, -5149, -4987, -4671, -4333, -4059, -3806, -3664, -3809, -4090, -4122, -3861, -3725, -3936, -4139, -3911, -3390, -3026, -2935, -2903, -2873, -2951, -3047, -2943, -2694, -2559, -2587, -2590, -2482, -2346, -2196, -1950, -1651, -1490, -1529, -1586, -1501, -1385, -1407, -1483, -1398, -1165, -1013, -978, -857, -622, -520, -578, -495, -186, 14, -62, -125, 59, 313, 386, 308, 255, 325, 472, 543, 453, 350, 443, 689, 891, 1022, 1178, 1317, 1358, 1385, 1495, 1560, 1407, 1158, 1123, 1335, 1497, 1473, 1482, 1663, 1827, 1866, 1935, 2076, 2056, 1816, 1646, 1717, 1847, 1854, 1810, 1858, 2001, 2173, 2326, 2408, 2384, 2343, 2417, 2549, 2512, 2263, 2038, 1984, 1996, 2022, 2160, 2357, 2430, 2431, 2564, 2794, 2914, 2909, 2864, 2727, 2475, 2284, 2277, 2379, 2520, 2733, 2948, 2991, 2855, 2720, 2712, 2764, 2698, 2408, 2057, 2000, 2322, 2694, 2853, 2939, 3081, 3135, 3065, 3087, 3165, 2934, 2343, 1855, 1804, 2033, 2276, 2469, 2660, 2880, 3147, 3415, 3526, 3378, 3114, 2941, 2808, 2507, 2122, 1989, 2156, 2303, 2330, 2502, 2897, 3235, 3354, 3362, 3290, 3070, 2793, 2600, 2470, 2349, 2330, 2469, 2665, 2839, 2994, 3104, 3140, 3177, 3256, 3200, 2784, 2130, 1702, 1791, 2187, 2464, 2497, 2494, 2647, 2906, 3109, 3139, 2945, 2585, 2241, 2093, 2110, 2085, 1913, 1738, 1775, 2006, 2212, 2269, 2275, 2274, 2120, 1780, 1509, 1487, 1506, 1327, 1087, 1047, 1186, 1318, 1391, 1425, 1390, 1253, 1009, 680, 405, 304, 215, -74, -345, -204, 224, 489, 552, 701, 850, 661, 229, -21, -87, -402, -1082, -1670, -1806, -1688, -1632, -1527, -1137, -628, -367, -364, -326, -229, -391, -936, -1553, -1923, -2118, -2378, -2683, -2799, -2622, -2275, -1954, -1783, -1702, -1548, -1369, -1466, -1915, -2340, -2459, -2489, -2689, -2855, -2671, -2262, -2019, -2033, -2052, -1940, -1855, -1969, -2210, -2423, -2588, -2739, -2792, -2642, -2352, -2107, -1981, -1887, -1732, -1573, -1552, -1715, -1965, -2207, -2439, -2603, -2552, -2294, -2016, -1752, -1324, -778, -469, -529, -648, -633, -757, -1273, -1896, -2131, -1909, -1557, -1271, -958, -571, -258, -76, 99, 279, 247, -127, -675, -1102, -1256, -1173, -975, -734, -383, 209, 999, 1638, 1792, 1563, 1330, 1173, 779, 32, -704, -1081, -1174, -1179, -986, -402, 390, 1007, 1408, 1841, 2274, 2393, 2171, 1850, 1455, 863, 263, -68, -216, -313, -143, 408, 929, 1055, 1066, 1388, 1870, 2050, 1889, 1718, 1612, 1331, 879, 629, 717, 776, 542, 355, 627, 1117, 1306, 1273, 1477, 1770, 1557, 964, 770, 1096, 1259, 999, 751, 687, 538, 355, 515, 993, 1337, 1332, 1160, 993, 841, 745, 774, 796, 556, 99, -184, -87, 173, 350, 468, 603, 711, 783, 876, 930, 825, 590, 366, 240, 196, 141, -30, -264, -314, -92, 168, 258, 263, 291, 265, 159, 118, 179, 200, 100, -74, -283, -426, -406, -387, -664, -1141, -1390, -1322, -1277, -1386, -1383, -1168, -1048, -1224, -1422, -1286, -898, -668, -770, -959, -976, -897, -942, -1103, -1182, -1130, -1153, -1395, -1628, -1495, -1088, -914, -1105, -1156, -775, -399, -453, -667, -622, -408, -307, -301, -256, -167, -78, -27, -78, -147, -52, 130, 113, -53, 26, 437, 779, 817, 839, 1129, 1499, 1589, 1428, 1345, 1418, 1374, 1092, 911, 1153, 1558, 1593, 1284, 1244, 1770, 2391, 2551, 2347, 2293, 2599, 2968, 2986, 2588, 2127, 1967, 2049, 2033, 1840, 1773, 2024, 2354, 2480, 2517, 2720, 2945, 2840, 2489, 2369, 2572, 2605, 2173, 1668, 1578, 1811, 1943, 1850, 1767, 1842, 1927, 1844, 1629, 1453, 1406, 1426, 1380, 1173, 867, 688, 800, 1031, 1006, 656, 373, 444, 602, 439, 25, -281, -458, -766, -1167, -1284, -1052, -906, -1115, -1327, -1107, -672, -618, -1052, -1475, -1578, -1656, -2041, -2530, -2715, -2653, -2770, -3144, -3328, -3083, -2829, -3015, -3349, -3243, -2828, -2795, -3277, -3621, -3456, -3240, -3478, -3931, -4046, -3822, -3750, -4035, -4343, -4366, -4273, -4359, -4550, -4536, -4258, -4007, -4011, -4153, -4170, -4033, -3955, -4080, -4280, -4332, -4240, -4226, -4383, -4486, -4312, -4042, -4031, -4253, -4288, -3973, -3672, -3749, -4031, -4089, -3850, -3639, -3643, -3661, -3515, -3388, -3515, -3727, -3636, -3244, -3008, -3185, -3422, -3254, -2807, -2621, -2817, -2906, -2572, -2213, -2315, -2654, -2608, -2138, -1891, -2213, -2614, -2521, -2109, -1914, -1966, -1847, -1500, -1330, -1470, -1491, -1115, -717, -755, -1047, -1073, -798, -635, -729, -796, -677, -591, -700, -830, -704, -340, -45, -33, -121, 49, 495, 859, 916, 812, 706, 558, 368, 292, 353, 326, 120, 4, 248, 706, 1000, 1039, 1074, 1251, 1379, 1255, 1019, 956, 1074, 1151, 1132, 1171, 1282, 1314, 1300, 1446, 1709, 1760, 1469, 1079, 848, 798, 791, 684, 498, 486, 829, 1345, 1778, 2161, 2549, 2709, 2485, 2089, 1678, 1167, 650, 437, 457, 302, 0, 55, 626, 1282, 1689, 1971, 2314, 2590, 2541, 2152, 1735, 1547, 1409, 1028, 620, 667, 1020, 1024, 691, 831, 1722, 2558, 2583, 2042, 1654, 1714, 1979, 2065, 1894, 1758, 1838, 1856, 1667, 1744, 2395, 2951, 2595, 1660, 1179, 1461, 1931, 2128, 2147, 2184, 2219, 2210, 2297, 2624, 3033, 3102, 2627, 1962, 1637, 1739, 1977, 2196, 2476, 2772, 2871, 2774, 2755, 2969, 3218, 3193, 2818, 2317, 1969, 1855, 1862, 1894, 1964, 2106, 2332, 2711, 3292, 3875, 4053, 3658, 3047, 2719, 2678, 2481, 1925, 1346, 1109, 1234, 1624, 2221, 2819, 3149, 3253, 3374, 3502, 3385, 2959, 2385, 1779, 1206, 844, 829, 1025, 1164, 1173, 1226, 1478, 1829, 2040, 2053, 2047, 2046, 1739, 1020, 352, 194, 338, 302, 68, -63, -24, 72, 204, 308, 237, 37, -73, -91, -218, -495, -781, -1004, -1133, -1062, -792, -615, -801, -1205, -1399, -1232, -1039, -1209, -1656, -1912, -1776, -1567, -1572, -1632, -1553, -1541, -1764, -1906, -1665, -1328, -1345, -1643, -1862, -1975, -2140, -2204, -1913, -1560, -1739, -2392, -2740, -2394, -1851, -1642, -1673, -1694, -1757, -1852, -1686, -1198, -830, -941, -1293, -1454, -1428, -1473, -1598, -1735, -2056, -2541, -2640, -2051, -1347, -1121, -1106, -816, -458, -423, -481, -193, 254, 249, -371, -1092, -1347, -1138, -930, -1034, -1306, -1442, -1320, -945, -344, 273, 601, 661, 822, 1215, 1506, 1445, 1203, 966, 646, 222, -61, -99, -183, -538, -857, -650, 33, 595, 694, 726, 1215, 1999, 2452, 2437, 2436, 2683, 2772, 2350, 1669, 1128, 725, 265, -213, -522, -594, -494, -220, 330, 1172, 2044, 2550, 2568, 2452, 2644, 3043, 2997, 2154, 1072, 537, 479, 247, -211, -281, 182, 541, 418, 256, 499, 850, 795, 448, 342, 611, 896, 992, 1113, 1424, 1714, 1731, 1509, 1181, 691, -35, -843, -1533, -2084, -2440, -2349, -1773, -1093, -542, 213, 1436, 2645, 3112, 2763, 2104, 1441, 674, -218, -1035, -1746, -2550, -3325, -3453, -2575, -1256, -420, -242, -80, 454, 1017, 1249, 1331, 1454, 1390, 991, 556, 327, 135, -181, -527, -845, -1248, -1740, -2123, -2162, -1718, -913, -168, 263, 716, 1669, 2910, 3620, 3325, 2401, 1545, 1018, 516, -310, -1367, -2117, -2098, -1445, -813, -608, -431, 360, 1618, 2457, 2419, 1991, 1820, 1909, 1855, 1497, 993, 529, 195, -15, -320, -1018, -1990, -2578, -2323, -1660, -1389, -1573, -1474, -613, 591, 1425, 1680, 1580, 1295, 914, 575, 179, -623, -1785, -2632, -2738, -2512, -2460, -2412, -1966, -1216, -559, -149, 81, 137, 31, -43, 20, -26, -442, -960, -1064, -756, -578, -819, -1145, -1163, -945, -781, -727, -686, -674, -631, -293, 327, 736, 716, 733, 1100, 1405, 1290, 1038, 897, 659, 282, 106, 195, 220, 120, 229, 681, 1223, 1628, 1920, 2236, 2618, 2925, 2950, 2713, 2470, 2352, 2239, 2059, 1950, 1961, 1943, 1844, 1825, 1978, 2166, 2266, 2354, 2533, 2754, 2952, 3197, 3508, 3694, 3605, 3420, 3366, 3312, 2970, 2411, 2015, 1918, 1870, 1698, 1613, 1869, 2345, 2697, 2817, 2904, 3094, 3239, 3156, 2872, 2516, 2124, 1740, 1501, 1424, 1270, 907, 625, 779, 1233, 1473, 1274, 947, 871, 1019, 1078, 891, 599, 410, 389, 446, 433, 244, -85, -401, -606, -755, -985, -1362, -1780, -2010, -1922, -1667, -1545, -1640, -1705, -1527, -1260, -1240, -1518, -1834, -2038, -2285, -2692, -3142, -3512, -3822, -4037, -4052, -3918, -3816, -3774, -3665, -3501, -3438, -3537, -3677, -3743, -3770, -3894, -4177, -4496, -4644, -4592, -4564, -4772, -5139, -5379, -5359, -5232, -5213, -5317, -5411, -5403, -5256, -4959, -4619, -4434, -4492, -4688, -4924, -5197, -5478, -5711, -5915, -6101, -6180, -6101, -5952, -5760, -5399, -4861, -4409, -4277, -4373, -4418, -4318, -4274, -4507, -4972, -5353, -5384, -5114, -4886, -4942, -5089, -4909, -4362, -3866, -3656, -3529, -3332, -3221, -3236, -3142, -2929, -2898, -3088, -3121, -2836, -2596, -2724, -2978, -2867, -2387, -2076, -2289, -2645, -2477, -1743, -1116, -1092, -1332, -1167, -527, -17, -47, -367, -592, -735, -904, -917, -677, -511, -645, -735, -399, 120, 321, 230, 313, 753, 1207, 1341, 1255, 1261, 1446, 1625, 1627, 1454, 1241, 1102, 1011, 848, 635, 576, 759, 1054, 1388, 1817, 2257, 2507, 2607, 2777, 3001, 3046, 2855, 2568, 2249, 1900, 1618, 1507, 1570, 1728, 1842, 1800, 1770, 2122, 2852, 3400, 3345, 2987, 2866, 3057, 3202, 3057, 2674, 2227, 1889, 1800, 1962, 2172, 2191, 2053, 2062, 2385, 2730, 2700, 2423, 2427, 2802, 3007, 2695, 2210, 2005, 2058, 2171, 2301, 2361, 2162, 1775, 1570, 1734, 2030, 2116, 1915, 1677, 1674, 1835, 1815, 1543, 1425, 1722, 2080, 2024, 1678, 1539, 1772, 2054, 2026, 1663, 1228, 990, 972, 1015, 1038, 1109, 1232, 1332, 1467, 1797, 2241, 2429, 2180, 1790, 1631, 1622, 1399, 922, 594, 679, 906, 897, 744, 883, 1432, 2010, 2244, 2159, 1969, 1783, 1613, 1445, 1173, 719, 303, 342, 883, 1409, 1457, 1241, 1303, 1702, 1965, 1828, 1535, 1363, 1292, 1205, 1083, 931, 774, 753, 974, 1311, 1496, 1424, 1253, 1186, 1295, 1557, 1850, 1935, 1661, 1258, 1125, 1309, 1507, 1552, 1509, 1395, 1215, 1142, 1287, 1452, 1437, 1350, 1336, 1294, 1128, 1019, 1169, 1444, 1494, 1202, 868, 876, 1248, 1614, 1643, 1367, 1051, 870, 852, 964, 1097, 1048, 709, 258, 23, 120, 335, 415, 333, 226, 195, 267, 444, 644, 667, 378, -65, -316, -250, -136, -284, -667, -1019, -1136, -1004, -768, -682, -866, -1075, -985, -651, -410, -399, -514, -689, -899, -1037, -1056, -1108, -1313, -1572, -1740, -1805, -1802, -1731, -1594, -1427, -1295, -1253, -1257, -1132, -803, -495, -514, -855, -1233, -1424, -1410, -1275, -1138, -1152, -1364, -1597, -1597, -1306, -925, -710, -777, -1050, -1342, -1430, -1203, -788, -478, -445, -559, -546, -304, 8, 170, 102, -143, -500, -910, -1227, -1261, -978, -622, -507, -629, -588, -73, 661, 1061, 955, 666, 484, 422, 430, 425, 212, -230, -533, -378, 64, 446, 728, 1044, 1357, 1513, 1469, 1319, 1159, 994, 740, 331, -116, -349, -241, 40, 257, 437, 768, 1185, 1394, 1384, 1509, 1877, 2102, 1870, 1337, 818, 451, 264, 221, 147, -76, -246, -77, 368, 735, 836, 851, 1051, 1379, 1446, 1031, 497, 370, 579, 556, 104, -326, -311, 88, 596, 994, 1074, 749, 285, 80, 118, -25, -571, -1171, -1327, -993, -544, -223, 105, 636, 1277, 1696, 1637, 1163, 591, 122, -343, -947, -1568, -1969, -2060, -1851, -1344, -648, 14, 561, 1087, 1584, 1895, 1943, 1776, 1432, 945, 392, -186, -729, -1014, -914, -721, -833, -1158, -1238, -852, -193, 445, 825, 823, 658, 870, 1719, 2692, 2960, 2334, 1436, 851, 471, -109, -893, -1491, -1687, -1593, -1331, -878, -249, 450, 1187, 1917, 2356, 2189, 1621, 1308, 1501, 1633, 1091, 130, -451, -404, -271, -537, -1102, -1670, -2087, -2209, -1951, -1616, -1637, -1848, -1569, -576, 464, 925, 1066, 1421, 1774, 1467, 442, -759, -1811, -2676, -3221, -3448, -3689, -3969, -3644, -2332, -736, 150, 348, 653, 1248, 1442, 882, 95, -444, -881, -1303, -1416, -1233, -1160, -1205, -942, -387, -103, -311, -568, -459, -112, 125, 209, 400, 858, 1386, 1703, 1802, 1879, 1986, 1965, 1703, 1267, 776, 318, 36, 116, 554, 1034, 1314, 1596, 2178, 2875, 3273, 3398, 3555, 3627, 3267, 2629, 2274, 2402, 2711, 2852, 2686, 2326, 2151, 2420, 2812, 2757, 2235, 1809, 1886, 2340, 2819, 3108, 3219, 3360, 3734, 4263, 4539, 4193, 3272, 2227, 1518, 1168, 814, 302, 7, 294, 946, 1524, 1992, 2510, 2932, 3017, 2830, 2471, 1814, 888, 100, -277, -473, -763, -1007, -895, -460, -91, -107, -420, -675, -690, -673, -938, -1466, -1889, -1891, -1560, -1273, -1301, -1568, -1818, -1974, -2205, -2621, -3083, -3460, -3821, -4186, -4356, -4192, -3859, -3573, -3342, -3155, -3139, -3360, -3670, -3872, -3926, -3985, -4272, -4804, -5238, -5215, -4852, -4627, -4756, -5004, -5118, -5139, -5232, -5434, -5676, -5873, -5876, -5542, -5001, -4644, -4631, -4678, -4554, -4508, -4851, -5409, -5801, -5986, -6172, -6368, -6377, -6134, -5770, -5389, -4993, -4649, -4511, -4603, -4754, -4833, -4906, -5086, -5335, -5501, -5455, -5173, -4791, -4503, -4352, -4211, -4007, -3858, -3889, -4042, -4162, -4160, -4037, -3841, -3652, -3547, -3506, -3394, -3100, -2724, -2538, -2654, -2803, -2644, -2262, -2045, -2043, -1932, -1604, -1353, -1291, -1156, -866, -763, -1079, -1528, -1697, -1551, -1331, -1152, -890, -445, 102, 623, 1108, 1510, 1587, 1175, 590, 338, 409, 315, -117, -460, -327, 166, 710, 1182, 1578, 1873, 2047, 2085, 1979, 1779, 1551, 1290, 1053, 1038, 1308, 1633, 1831, 1976, 2085, 1982, 1680, 1503, 1581, 1646, 1448, 1091, 887, 1111, 1748, 2370, 2518, 2317, 2296, 2559, 2669, 2388, 1986, 1721, 1492, 1141, 756, 609, 888, 1522, 2148, 2361, 2106, 1761, 1776, 2217, 2673, 2664, 2132, 1527, 1344, 1621, 1993, 2142, 2054, 1885, 1744, 1666, 1659, 1719, 1837, 1961, 2004, 1948, 1922, 2066, 2348, 2590, 2639, 2456, 2165, 2013, 2115, 2230, 2040, 1658, 1541, 1888, 2398, 2671, 2639, 2521, 2551, 2776, 3050, 3189, 3131, 2959, 2778, 2650, 2586, 2527, 2365, 2072, 1784, 1700, 1913, 2339, 2762, 3015, 3180, 3471, 3884, 4143, 4089, 3860, 3605, 3262, 2771, 2214, 1695, 1305, 1198, 1485, 2001, 2429, 2664, 2871, 3192, 3529, 3679, 3587, 3362, 3086, 2702, 2170, 1666, 1461, 1607, 1855, 1905, 1660, 1290, 1114, 1321, 1672, 1681, 1231, 787, 806, 1164, 1423, 1459, 1513, 1689, 1748, 1496, 1082, 763, 516, 112, -531, -1200, -1589, -1546, -1156, -675, -342, -172, 18, 350, 665, 718, 483, 116, -308, -813, -1337, -1755, -2038, -2180, -2072, -1686, -1285, -1194, -1376, -1462, -1245, -952, -913, -1169, -1537, -1812, -1806, -1434, -924, -690, -831, -1016, -972, -861, -1009, -1456, -1966, -2335, -2537, -2592, -2497, -2255, -1888, -1391, -799, -249, 157, 468, 736, 822, 531, -105, -831, -1412, -1777, -1952, -1987, -1970, -1976, -1930, -1605, -877, 34, 689, 885, 853, 938, 1180, 1328, 1167, 718, 174, -266, -491, -559, -638, -796, -869, -646, -192, 176, 292, 343, 590, 1035, 1472, 1709, 1693, 1543, 1485, 1619, 1757, 1628, 1208, 734, 387, 146, -46, -138, -97, -6, 100, 315, 663, 1007, 1270, 1567, 1913, 2088, 1955, 1723, 1684, 1822, 1856, 1592, 1066, 436, -136, -508, -628, -596, -506, -285, 139, 647, 1117, 1619, 2199, 2709, 3016, 3115, 2884, 2161, 1161, 433, 184, 0, -561, -1327, -1684, -1286, -402, 422, 916, 1255, 1726, 2339, 2757, 2673, 2186, 1695, 1370, 972, 273, -560, -1165, -1374, -1307, -1146, -914, -476, 241, 1045, 1603, 1793, 1806, 1842, 1840, 1576, 959, 153, -556, -921, -833, -450, -144, -100, -32, 426, 1154, 1665, 1667, 1201, 418, -418, -889, -741, -198, 266, 449, 507, 649, 935, 1327, 1677, 1645, 994, 8, -782, -1258, -1638, -1860, -1619, -985, -358, 140, 718, 1442, 2113, 2427, 2108, 1187, 209, -268, -361, -640, -1278, -1826, -1814, -1254, -558, -126, -59, -91, 130, 609, 891, 628, 157, 96, 406, 444, -34, -655, -1180, -1688, -2091, -2261, -2409, -2636, -2544, -1947, -1386, -1279, -1243, -846, -414, -512, -1114, -1775, -2293, -2739, -3059, -3113, -3016, -2992, -2926, -2570, -2080, -1802, -1687, -1484, -1288, -1349, -1616, -1908, -2210, -2475, -2532, -2393, -2271, -2170, -1856, -1316, -852, -633, -490, -296, -258, -552, -947, -1075, -945, -803, -710, -587, -445, -268, 86, 611, 1056, 1269, 1345, 1364, 1313, 1264, 1323, 1434, 1452, 1364, 1272, 1286, 1492, 1852, 2173, 2337, 2479, 2780, 3157, 3402, 3495, 3583, 3688, 3654, 3429, 3195, 3137, 3200, 3236, 3252, 3361, 3597, 3874, 4044, 3997, 3801, 3721, 3881, 4071, 4051, 3885, 3768, 3744, 3778, 3876, 3955, 3824, 3502, 3303, 3406, 3518, 3279, 2844, 2680, 2848, 2905, 2599, 2258, 2278, 2577, 2782, 2719, 2471, 2143, 1816, 1628, 1594, 1468, 1063, 621, 490, 573, 502, 229, -2, -88, -126, -207, -391, -698, -991, -1091, -1070, -1180, -1453, -1653, -1693, -1788, -2091, -2430, -2667, -3005, -3580, -4037, -4006, -3713, -3636, -3744, -3624, -3236, -2991, -3154, -3545, -3912, -4260, -4737, -5353, -5935, -6290, -6336, -6130, -5853, -5641, -5435, -5084, -4618, -4282, -4302, -4687, -5252, -5787, -6183, -6514, -6893, -7247, -7298, -6890, -6254, -5787, -5595, -5451, -5199, -5017, -5109, -5394, -5639, -5781, -5943, -6168, -6320, -6262, -6021, -5749, -5547, -5366, -5152, -4967, -4896, -4886, -4861, -4876, -4995, -5092, -4954, -4576, -4195, -4040, -4102, -4118, -3822, -3310, -3059, -3366, -3894, -4043, -3670, -3198, -3033, -3116, -3086, -2736, -2205, -1782, -1630, -1714, -1909, -2083, -2135, -2039, -1887, -1814, -1820, -1695, -1261, -682, -305, -156, 52, 303, 174, -424, -910, -768, -242, 24, -207, -534, -348, 496, 1437, 1773, 1483, 1179, 1214, 1284, 1040, 655, 437, 288, -26, -242, 170, 1127, 1863, 1949, 1818, 2015, 2374, 2346, 1820, 1249, 998, 905, 595, 132, 65, 688, 1518, 1845, 1647, 1562, 1941, 2346, 2230, 1708, 1261, 984, 657, 406, 626, 1207, 1483, 1223, 1088, 1661, 2458, 2554, 1896, 1261, 1030, 856, 545, 450, 782, 1224, 1464, 1612, 1880, 2204, 2363, 2294, 2098, 1829, 1460, 1064, 876, 1054, 1448, 1726, 1738, 1733, 2058, 2643, 2968, 2740, 2302, 2128, 2201, 2219, 2112, 2002, 1920, 1852, 1863, 1980, 2144, 2341, 2594, 2820, 2888, 2815, 2727, 2662, 2574, 2479, 2459, 2499, 2464, 2352, 2386, 2723, 3135, 3199, 2856, 2534, 2616, 2942, 3019, 2687, 2351, 2420, 2745, 2889, 2790, 2747, 2844, 2888, 2890, 3039, 3216, 3090, 2703, 2465, 2518, 2583, 2421, 2141, 2000, 2104, 2341, 2541, 2674, 2863, 3136, 3262, 2984, 2417, 2003, 1964, 1968, 1615, 1066, 853, 1176, 1711, 2126, 2384, 2542, 2519, 2246, 1841, 1499, 1287, 1127, 942, 735, 556, 497, 666, 1058, 1447, 1558, 1354, 1078, 933, 847, 623, 263, -29, -66, 146, 415, 534, 501, 543, 803, 1060, 991, 593, 170, -70, -178, -290, -444, -584, -598, -399, -8, 399, 623, 600, 455, 387, 468, 566, 459, 76, -398, -667, -595, -349, -247, -367, -429, -180, 198, 354, 289, 264, 306, 253, 171, 251, 381, 267, -89, -401, -517, -549, -560, -459, -230, -65, -107, -196, -65, 298, 629, 661, 354, -85, -383, -481, -558, -708, -809, -828, -902, -972, -763, -287, 80, 129, -9, -205, -402, -464, -351, -272, -346, -379, -265, -264, -568, -930, -1035, -1004, -1167, -1488, -1594, -1335, -964, -689, -443, -190, -76, -145, -246, -322, -526, -973, -1564, -2047, -2174, -1909, -1514, -1253, -1078, -779, -404, -230, -371, -653, -907, -1155, -1468, -1780, -1915, -1784, -1488, -1180, -851, -398, 104, 414, 423, 215, -176, -805, -1515, -1957, -1981, -1797, -1655, -1531, -1185, -508, 227, 559, 372, 96, 133, 237, -157, -1022, -1588, -1310, -610, -290, -442, -453, 19, 596, 796, 637, 427, 302, 200, 118, 137, 263, 425, 599, 786, 931, 990, 1015, 1034, 916, 542, 44, -273, -218, 143, 532, 716, 792, 1070, 1570, 1939, 1958, 1807, 1629, 1259, 627, 76, -57, 59, 82, 108, 523, 1301, 1959, 2259, 2427, 2572, 2454, 1988, 1501, 1219, 927, 397, -171, -442, -381, -139, 317, 1039, 1772, 2209, 2448, 2728, 2888, 2583, 1887, 1211, 734, 319, -97, -348, -276, 42, 393, 682, 1010, 1455, 1832, 1845, 1474, 1024, 730, 486, 91, -347, -511, -290, 47, 228, 339, 648, 1071, 1179, 863, 546, 455, 247, -272, -677, -670, -595, -731, -733, -292, 299, 643, 708, 614, 413, 155, -144, -533, -932, -1162, -1200, -1083, -656, 117, 780, 856, 566, 514, 750, 690, 7, -904, -1470, -1580, -1466, -1217, -778, -275, 36, 174, 414, 768, 812, 263, -537, -1034, -1154, -1262, -1516, -1638, -1347, -747, -186, 120, 242, 354, 453, 311, -268, -1156, -1932, -2304, -2373, -2365, -2260, -1967, -1617, -1302, -792, -29, 504, 423, -8, -444, -979, -1664, -2176, -2377, -2517, -2641, -2418, -1770, -1079, -635, -361, -144, -56, -175, -444, -777, -1158, -1558, -1854, -1908, -1734, -1447, -1052, -440, 257, 622, 510, 345, 460, 533, 178, -363, -655, -695, -660, -482, -134, 214, 563, 1074, 1640, 1941, 1931, 1794, 1534, 1069, 628, 551, 724, 680, 380, 379, 996, 1783, 2172, 2225, 2298, 2399, 2338, 2164, 2012, 1780, 1350, 931, 854, 1136, 1497, 1754, 1946, 2104, 2138, 2056, 2064, 2235, 2255, 1811, 1128, 762, 885, 1161, 1323, 1414, 1460, 1364, 1212, 1226, 1359, 1293, 948, 605, 432, 258, 44, 86, 401, 462, 70, -154, 166, 400, -30, -639, -784, -736, -993, -1312, -1214, -848, -720, -960, -1200, -1069, -706, -727, -1453, -2355, -2736, -2693, -2774, -3006, -3005, -2759, -2562, -2418, -2156, -1888, -1870, -2123, -2535, -3085, -3708, -4162, -4288, -4270, -4372, -4498, -4303, -3712, -3060, -2681, -2649, -2874, -3206, -3506, -3858, -4443, -5060, -5176, -4696, -4188, -4080, -4100, -3801, -3247, -2864, -2875, -3175, -3589, -3961, -4117, -4050, -4026, -4196, -4237, -3792, -3112, -2763, -2832, -2902, -2720, -2474, -2388, -2462, -2626, -2843, -2934, -2674, -2187, -1961, -2208, -2568, -2634, -2437, -2174, -1845, -1428, -1087, -916, -700, -238, 260, 423, 229, -32, -265, -610, -997, -1118, -896, -598, -415, -220, 229, 1034, 2030, 2797, 2945, 2534, 2049, 1847, 1765, 1437, 861, 419, 409, 805, 1438, 2145, 2707, 2975, 3073, 3237, 3430, 3398, 3086, 2707, 2426, 2222, 2135, 2331, 2783, 3145, 3180, 3099, 3184, 3327, 3234, 2909, 2596, 2399, 2244, 2139, 2232, 2635, 3211, 3564, 3396, 2913, 2640, 2737, 2765, 2311, 1563, 1062, 1015, 1182, 1321, 1454, 1636, 1775, 1800, 1775, 1733, 1584, 1324, 1078, 894, 687, 469, 408, 577, 802, 856, 721, 575, 519, 431, 147, -261, -564, -699, -789, -817, -613, -203, 129, 253, 354, 568, 715, 546, 72, -447, -781, -916, -1034, -1260, -1466, -1368, -887, -347, -140, -214, -180, 70, 198, -39, -472, -805, -908, -782, -589, -619, -871, -916, -529, -154, -309, -821, -1090, -905, -583, -424, -400, -360, -233, 24, 401, 661, 536, 133, -188, -367, -650, -1052, -1243, -1065, -754, -535, -302, 133, 712, 1233, 1603, 1764, 1584, 1078, 572, 338, 219, -94, -570, -893, -840, -443, 113, 625, 986, 1232, 1393, 1424, 1340, 1279, 1288, 1181, 778, 205, -186, -210, -16, 127, 116, 51, 52, 158, 353, 585, 737, 703, 560, 532, 703, 884, 839, 566, 253, 60, 31, 124, 209, 112, -183, -440, -436, -278, -236, -308, -258, -54, 68, 19, -15, 63, 115, 36, -74, -126, -184, -310, -440, -521, -633, -828, -956, -831, -532, -332, -307, -229, 44, 320, 357, 239, 215, 285, 213, -74, -391, -568, -623, -619, -553, -450, -380, -338, -214, 17, 187, 126, -57, -72, 167, 410, 421, 300, 294, 450, 655, 818, 807, 494, 72, -62, 97, 130, -127, -347, -272, -7, 303, 636, 904, 1024, 1100, 1278, 1504, 1622, 1598, 1488, 1328, 1153, 1012, 875, 648, 381, 318, 556, 823, 867, 904, 1285, 1868, 2186, 2137, 2064, 2165, 2251, 2102, 1752, 1321, 861, 459, 307, 506, 854, 1036, 1055, 1242, 1726, 2136, 2110, 1792, 1526, 1308, 969, 654, 607, 707, 661, 542, 693, 1129, 1463, 1443, 1234, 1079, 984, 877, 780, 645, 338, -28, -114, 166, 485, 591, 585, 643, 758, 843, 825, 675, 457, 264, 76, -165, -366, -420, -423, -506, -569, -432, -130, 127, 201, 63, -206, -407, -351, -98, 88, 35, -207, -446, -504, -431, -521, -917, -1336, -1439, -1338, -1325, -1351, -1158, -782, -500, -409, -373, -278, -162, -145, -338, -716, -1128, -1487, -1782, -1915, -1763, -1468, -1338, -1359, -1156, -576, -5, 133, -48, -150, -122, -300, -804, -1335, -1598, -1588, -1410, -1182, -1059, -1037, -849, -365, 104, 189, -65, -356, -527, -627, -729, -803, -684, -295, 111, 201, 63, 87, 300, 321, -7, -433, -728, -852, -796, -620, -479, -329, 46, 575, 857, 767, 637, 738, 935, 956, 711, 281, -153, -349, -189, 84, 82, -192, -282, 81, 576, 781, 709, 587, 514, 572, 871, 1229, 1224, 771, 255, 4, -32, -26, -19, 7, 36, 68, 173, 451, 858, 1129, 1052, 827, 838, 1030, 1009, 699, 390, 98, -388, -862, -816, -261, 231, 321, 205, 211, 468, 836, 974, 675, 185, -96, -107, -43, 24, 86, 40, -113, -174, -71, 7, -55, -144, -181, -263, -393, -357, -26, 396, 628, 694, 833, 1055, 1042, 599, -19, -425, -592, -764, -961, -899, -433, 204, 691, 940, 1036, 1056, 1031, 969, 783, 360, -178, -475, -396, -259, -310, -303, -5, 295, 283, 193, 362, 610, 600, 410, 307, 288, 222, 165, 242, 422, 569, 623, 600, 492, 295, 75, -109, -287, -497, -627, -520, -187, 221, 626, 1045, 1450, 1699, 1629, 1226, 733, 434, 280, -54, -619, -1000, -874, -410, 38, 352, 583, 816, 1084, 1242, 1096, 824, 835, 1068, 1018, 627, 391, 492, 585, 489, 346, 167, -101, -255, -115, 103, 157, 178, 395, 758, 1074, 1250, 1250, 1052, 743, 492, 331, 113, -246, -585, -684, -544, -318, -77, 192, 466, 720, 977, 1176, 1142, 827, 434, 144, -158, -677, -1292, -1590, -1358, -866, -530, -435, -336, -89, 175, 318, 351, 239, -153, -753, -1206, -1325, -1327, -1438, -1549, -1444, -1147, -814, -488, -165, 27, -108, -585, -1144, -1509, -1673, -1825, -2013, -2072, -1934, -1771, -1696, -1563, -1236, -867, -673, -613, -521, -449, -612, -991, -1287, -1358, -1412, -1644, -1941, -2117, -2214, -2316, -2281, -1898, -1247, -668, -407, -332, -139, 211, 383, 158, -227, -520, -846, -1297, -1566, -1486, -1447, -1722, -1899, -1528, -835, -283, 82, 417, 628, 554, 317, 169, 103, -148, -720, -1354, -1647, -1532, -1295, -1094, -761, -207, 301, 523, 542, 512, 404, 187, -57, -325, -672, -967, -982, -790, -738, -928, -1012, -689, -147, 159, 77, -163, -337, -423, -486, -576, -726, -901, -983, -937, -849, -764, -670, -579, -495, -348, -168, -148, -379, -690, -910, -1054, -1164, -1189, -1135, -1101, -1090, -988, -787, -632, -627, -689, -670, -557, -515, -668, -862, -843, -656, -619, -806, -933, -840, -709, -692, -724, -760, -825, -803, -564, -271, -205, -354, -447, -323, -29, 303, 524, 496, 212, -168, -425, -436, -321, -360, -591, -642, -201, 469, 823, 773, 729, 920, 1080, 959, 753, 724, 709, 418, -30, -302, -336, -234, 34, 384, 466, 232, 198, 671, 1217, 1315, 1090, 962, 947, 787, 530, 453, 503, 347, 4, -140, 19, 180, 197, 245, 361, 389, 371, 539, 862, 1016, 849, 568, 389, 268, 133, 75, 139, 162, 40, -42, 93, 324, 426, 363, 221, 54, -97, -195, -263, -346, -397, -321, -152, -34, -25, -23, 44, 78, -26, -202, -336, -452, -622, -801, -886, -844, -731, -647, -673, -769, -780, -670, -573, -558, -507, -344, -190, -185, -310, -497, -737, -1009, -1212, -1289, -1319, -1338, -1221, -912, -629, -556, -530, -346, -160, -178, -276, -274, -319, -593, -913, -1013, -956, -954, -968, -798, -461, -196, -107, -59, 20, -2, -213, -470, -629, -701, -741, -712, -588, -410, -205, 43, 280, 359, 221, 11, -97, -136, -256, -447, -534, -445, -323, -284, -220, 7, 284, 324, 70, -176, -126, 117, 241, 166, 98, 155, 214, 191, 156, 131, -14, -318, -555, -470, -101, 263, 428, 467, 565, 751, 880, 831, 626, 360, 103, -95, -221, -322, -429, -447, -271, 45, 360, 625, 861, 1006, 954, 732, 480, 309, 198, 28, -302, -711, -932, -798, -470, -236, -127, 95, 550, 1002, 1154, 1022, 847, 708, 466, 58, -346, -569, -629, -647, -667, -638, -508, -268, 81, 521, 882, 896, 554, 253, 290, 375, 69, -473, -728, -588, -364, -170, 112, 395, 461, 401, 488, 643, 487, -20, -444, -524, -512, -628, -649, -378, -30, 151, 286, 508, 708, 796, 875, 946, 821, 444, 44, -177, -299, -493, -751, -936, -954, -730, -195, 514, 1077, 1386, 1666, 1989, 2098, 1832, 1374, 889, 310, -357, -877, -1093, -1128, -1074, -753, -24, 869, 1562, 2033, 2479, 2813, 2680, 2011, 1206, 609, 129, -396, -782, -791, -561, -349, -41, 600, 1405, 1973, 2201, 2231, 2089, 1747, 1334, 1006, 768, 550, 336, 164, 108, 226, 428, 546, 567, 665, 935, 1281, 1598, 1879, 2075, 2059, 1813, 1527, 1380, 1279, 995, 489, 10, -187, -65, 262, 670, 1038, 1252, 1335, 1455, 1692, 1853, 1722, 1398, 1166, 1093, 996, 800, 697, 829, 1060, 1176, 1166, 1137, 1070, 869, 586, 378, 289, 253, 282, 464, 770, 1037, 1195, 1335, 1463, 1430, 1204, 977, 845, 683, 463, 342, 302, 176, 42, 153, 427, 503, 336, 277, 478, 673, 676, 698, 930, 1190, 1268, 1281, 1313, 1099, 510, -57, -258, -362, -721, -1091, -995, -469, 40, 313, 539, 905, 1321, 1578, 1603, 1435, 1092, 602, 97, -292, -624, -1007, -1311, -1274, -910, -531, -303, -63, 291, 551, 531, 413, 485, 669, 646, 379, 142, 55, -54, -268, -468, -627, -848, -1056, -1052, -837, -610, -433, -231, 0, 182, 267, 267, 206, 118, 6, -174, -415, -612, -677, -664, -672, -667, -550, -400, -432, -621, -677, -541, -509, -702, -839, -731, -520, -293, -10, 187, 137, 7, 22, 20, -223, -600, -922, -1218, -1482, -1561, -1446, -1279, -1027, -547, 41, 439, 577, 641, 728, 719, 504, 167, -90, -199, -320, -610, -970, -1178, -1206, -1182, -1087, -816, -456, -180, 62, 421, 807, 998, 962, 826, 609, 241, -221, -632, -930, -1171, -1383, -1470, -1285, -817, -264, 140, 337, 410, 404, 297, 97, -186, -556, -908, -1085, -1105, -1108, -1064, -852, -602, -522, -511, -373, -248, -372, -622, -746, -788, -902, -1028, -1028, -917, -764, -568, -380, -320, -425, -600, -752, -868, -961, -1025, -1030, -979, -917, -889, -867, -787, -650, -526, -440, -364, -304, -309, -381, -487, -623, -774, -859, -808, -668, -526, -419, -352, -318, -282, -211, -150, -165, -248, -344, -409, -413, -346, -278, -319, -468, -585, -555, -417, -263, -86, 150, 365, 434, 396, 405, 462, 374, 28, -435, -759, -784, -586, -408, -383, -323, 33, 584, 916, 860, 719, 818, 1037, 1010, 647, 223, -19, -136, -293, -511, -699, -804, -778, -520, -20, 483, 738, 809, 912, 1018, 939, 710, 519, 348, 80, -170, -204, -119, -196, -460, -659, -635, -471, -289, -60, 286, 685, 962, 1015, 902, 728, 511, 192, -233, -632, -830, -796, -684, -624, -564, -375, -55, 271, 490, 577, 569, 507, 410, 266, 58, -198, -461, -709, -943, -1098, -1039, -737, -374, -143, 5, 257, 588, 708, 442, 0, -289, -374, -445, -577, -653, -604, -514, -460, -424, -391, -376, -331, -150, 168, 453, 556, 517, 461, 372, 141, -230, -597, -850, -1012, -1125, -1126, -928, -576, -250, -74, 20, 174, 364, 427, 255, -99, -503, -810, -907, -796, -598, -396, -166, 53, 133, 56, -48, -119, -206, -334, -496, -684, -777, -594, -228, -17, -57, -79, 112, 386, 559, 558, 344, -43, -401, -570, -619, -646, -606, -442, -216, 7, 270, 587, 845, 878, 618, 189, -152, -251, -180, -98, -54, -30, -72, -216, -367, -409, -392, -463, -613, -655, -473, -179, 69, 246, 391, 497, 552, 550, 390, -39, -604, -978, -1019, -892, -765, -595, -273, 159, 551, 781, 812, 667, 403, 100, -143, -278, -346, -418, -484, -463, -339, -161, 49, 277, 431, 432, 355, 300, 240, 132, 61, 112, 224, 315, 395, 468, 463, 344, 149, -90, -365, -609, -743, -747, -642, -429, -110, 276, 648, 887, 901, 721, 501, 348, 237, 79, -128, -310, -394, -356, -219, -53, 50, 67, 72, 123, 143, 32, -149, -204, -52, 184, 364, 495, 639, 744, 675, 404, 38, -302, -570, -725, -707, -513, -213, 104, 374, 556, 657, 708, 700, 586, 362, 94, -144, -312, -364, -272, -86, 77, 139, 137, 165, 245, 299, 244, 93, -53, -95, 10, 249, 530, 701, 663, 463, 230, 24, -186, -393, -503, -440, -239, -5, 197, 348, 445, 506, 574, 634, 579, 345, 20, -232, -354, -401, -437, -456, -382, -157, 150, 364, 406, 386, 410, 423, 311, 84, -158, -345, -445, -428, -284, -56, 179, 363, 457, 453, 363, 196, -14, -212, -349, -408, -355, -163, 86, 229, 191, 76, 25, 67, 153, 241, 295, 291, 257, 260, 309, 304, 182, 9, -115, -215, -335, -397, -322, -183, -73, 41, 208, 344, 375, 342, 260, 76, -193, -429, -573, -649, -662, -578, -390, -112, 210, 461, 554, 548, 551, 546, 452, 290, 127, -48, -278, -472, -479, -289, -55, 112, 270, 504, 764, 909, 862, 656, 351, 11, -261, -364, -277, -90, 99, 270, 440, 595, 667, 591, 372, 117, -43, -87, -110, -176, -198, -77, 148, 351, 461, 475, 377, 160, -130, -408, -600, -666, -612, -475, -281, -37, 244, 515, 714, 821, 849, 797, 638, 392, 164, 61, 85, 135, 124, 60, -1, -30, -14, 49, 113, 116, 88, 122, 240, 361, 448, 549, 667, 712, 632, 476, 302, 100, -126, -304, -382, -418, -459, -429, -264, -56, 62, 122, 211, 294, 283, 168, 8, -138, -193, -107, 40, 129, 153, 193, 253, 254, 153, -10, -167, -260, -289, -291, -278, -210, -66, 109, 292, 486, 657, 723, 664, 543, 404, 242, 75, -65, -165, -205, -152, -16, 109, 153, 144, 152, 186, 208, 206, 222, 270, 303, 264, 168, 78, 17, -52, -163, -263, -265, -176, -112, -135, -152, -38, 144, 220, 144, 72, 124, 223, 223, 102, -38, -114, -108, -32, 72, 124, 102, 98, 198, 337, 388, 341, 299, 316, 360, 416, 505, 595, 601, 497, 361, 248, 126, -14, -104, -78, 62, 304, 632, 955, 1152, 1205, 1184, 1107, 918, 600, 230, -119, -437, -681, -734, -514, -90, 396, 866, 1262, 1519, 1603, 1522, 1250, 792, 293, -80, -316, -490, -593, -560, -399, -149, 187, 554, 809, 882, 845, 806, 764, 620, 288, -179, -574, -726, -697, -673, -710, -712, -619, -442, -195, 86, 312, 446, 542, 617, 612, 490, 263, -64, -452, -777, -960, -1058, -1114, -1067, -878, -609, -311, 33, 397, 666, 760, 683, 470, 166, -151, -396, -542, -640, -743, -843, -858, -712, -450, -199, -41, 47, 96, 100, 71, 23, -64, -188, -266, -248, -203, -223, -280, -289, -239, -166, -88, -20, -8, -70, -184, -295, -363, -390, -441, -533, -568, -486, -385, -351, -289, -121, 36, 82, 104, 174, 187, 64, -123, -313, -520, -683, -695, -603, -565, -591, -517, -272, -9, 129, 209, 354, 504, 512, 362, 151, -87, -357, -594, -722, -780, -825, -808, -633, -326, -39, 115, 179, 246, 329, 353, 263, 87, -109, -289, -415, -467, -469, -468, -465, -413, -302, -176, -54, 72, 169, 171, 85, -2, -46, -98, -201, -313, -374, -387, -373, -313, -218, -162, -178, -178, -105, -28, -19, -43, -57, -87, -130, -124, -62, -25, -62, -130, -163, -162, -154, -139, -124, -150, -210, -227, -193, -209, -303, -365, -339, -328, -391, -458, -484, -495, -471, -379, -286, -259, -236, -167, -128, -174, -241, -294, -371, -469, -535, -576, -615, -601, -490, -343, -223, -124, -41, -3, -10, -36, -101, -222, -340, -419, -511, -637, -717, -692, -603, -514, -436, -363, -292, -211, -133, -99, -118, -142, -144, -157, -199, -258, -327, -410, -490, -550, -595, -619, -587, -500, -414, -367, -348, -317, -251, -152, -53, -3, -2, -18, -62, -154, -266, -357, -462, -589, -662, -626, -555, -504, -431, -308, -192, -104, -11, 59, 47, -12, -35, -17, -27, -99, -224, -373, -479, -477, -387, -295, -250, -246, -268, -299, -298, -247, -170, -85, 15, 117, 187, 214, 198, 133, 19, -103, -198, -248, -230, -140, -28, 55, 130, 230, 330, 384, 399, 399, 381, 333, 271, 204, 118, 19, -41, -14, 81, 184, 253, 279, 260, 204, 143, 109, 85, 25, -54, -78, -2, 125, 218, 229, 188, 171, 206, 246, 226, 152, 103, 127, 183, 179, 103, 43, 88, 202, 266, 221, 118, 31, -30, -62, -47, -14, 2, 45, 184, 383, 538, 604, 608, 557, 468, 409, 426, 453, 409, 292, 161, 53, -18, -39, 1, 103, 251, 430, 611, 749, 807, 787, 712, 612, 517, 462, 436, 374, 235, 75, -11, -3, 25, 33, 67, 194, 400, 608, 755, 820, 799, 716, 590, 424, 218, 19, -107, -157, -156, -107, 17, 198, 360, 450, 496, 549, 602, 608, 554, 495, 476, 474, 441, 369, 293, 249, 249, 293, 357, 397, 392, 377, 384, 401, 399, 384, 380, 383, 362, 299, 212, 137, 84, 24, -61, -125, -110, -37, 19, 31, 5, -57, -130, -135, -36, 100, 195, 231, 213, 127, -12, -149, -247, -323, -389, -433, -434, -365, -215, -41, 68, 76, 44, 50, 96, 132, 118, 54, -38, -143, -234, -291, -312, -321, -329, -303, -204, -38, 129, 231, 239, 161, 37, -76, -150, -206, -276, -351, -392, -393, -370, -307, -175, -17, 44, -35, -156, -215, -257, -354, -454, -460, -366, -241, -124, -52, -61, -121, -136, -86, -55, -105, -174, -158, -50, 65, 135, 186, 247, 292, 284, 239, 188, 123, 17, -88, -123, -78, -8, 63, 135, 184, 187, 177, 180, 162, 91, 7, -36, -51, -68, -89, -97, -87, -46, 29, 117, 175, 180, 147, 91, 20, -64, -136, -159, -126, -68, -14, 32, 88, 161, 218, 209, 140, 77, 55, 35, -6, -15, 53, 153, 209, 205, 169, 111, 36, -34, -94, -161, -232, -247, -160, -16, 105, 184, 248, 283, 245, 140, 8, -127, -258, -340, -342, -271, -149, 6, 139, 175, 107, 16, -43, -107, -210, -292, -275, -193, -140, -116, -38, 112, 265, 375, 453, 484, 426, 303, 192, 116, 31, -55, -51, 77, 223, 316, 414, 558, 646, 570, 374, 169, 0, -127, -172, -117, -12, 84, 184, 327, 485, 585, 592, 526, 408, 251, 105, 15, -24, -30, 2, 78, 157, 211, 255, 299, 320, 308, 288, 283, 282, 271, 264, 270, 254, 180, 81, 33, 56, 91, 78, 41, 38, 79, 117, 138, 150, 157, 155, 168, 214, 251, 229, 164, 114, 96, 80, 52, 33, 25, 0, -59, -117, -143, -144, -156, -190, -243, -299, -331, -337, -332, -321, -271, -167, -60, 0, 6, -38, -133, -242, -331, -418, -500, -502, -376, -218, -135, -113, -71, -16, -17, -78, -119, -90, -29, 1, -6, -14, 2, 26, 18, -37, -123, -196, -224, -215, -187, -139, -66, 0, 16, -15, -45, -29, 17, 63, 89, 91, 59, 1, -45, -66, -96, -161, -225, -218, -115, 32, 158, 229, 254, 242, 191, 93, -20, -101, -121, -89, -42, -5, 24, 70, 129, 134, 41, -90, -166, -180, -184, -171, -127, -103, -106, -53, 72, 146, 82, -14, -25, 11, 0, -81, -187, -300, -414, -502, -538, -537, -514, -455, -361, -280, -239, -192, -100, -18, -6, -36, -50, -59, -108, -176, -199, -178, -158, -139, -72, 17, 40, -26, -92, -99, -77, -60, -42, -35, -66, -109, -115, -104, -134, -211, -266, -251, -185, -123, -104, -132, -185, -238, -280, -314, -351, -372, -360, -311, -245, -180, -138, -131, -142, -133, -92, -46, -11, 27, 63, 63, 19, -36, -90, -151, -216, -252, -229, -144, -30, 72, 139, 170, 196, 238, 273, 265, 197, 96, -12, -114, -190, -237, -271, -291, -254, -135, 11, 103, 115, 86, 44, -12, -87, -175, -269, -354, -384, -339, -247, -161, -99, -44, 0, 1, -37, -69, -64, -57, -82, -123, -140, -130, -113, -90, -43, 15, 43, 34, 10, -12, -50, -104, -145, -140, -73, 29, 115, 141, 108, 64, 46, 51, 47, 25, -3, -33, -52, -41, 1, 29, 10, -16, -8, 19, 36, 47, 56, 40, -3, -25, -2, 19, 2, -29, -37, -24, -26, -48, -64, -71, -87, -103, -94, -57, -25, -5, 23, 65, 103, 113, 90, 49, -2, -56, -108, -142, -147, -142, -148, -134, -61, 47, 132, 187, 236, 256, 228, 191, 189, 204, 213, 235, 268, 289, 319, 396, 464, 454, 400, 372, 344, 274, 208, 193, 188, 146, 105, 127, 195, 239, 239, 220, 182, 104, 10, -35, -14, 27, 53, 84, 142, 212, 256, 276, 297, 325, 327, 260, 120, -48, -181, -256, -298, -330, -335, -268, -128, 29, 155, 248, 337, 407, 403, 307, 171, 61, -16, -89, -180, -277, -349, -360, -301, -211, -134, -68, 10, 103, 189, 258, 306, 322, 311, 288, 260, 212, 125, 9, -113, -218, -286, -304, -277, -233, -190, -136, -51, 42, 100, 114, 125, 162, 198, 183, 102, -7, -105, -186, -255, -292, -269, -205, -152, -139, -145, -154, -165, -179, -193, -204, -203, -165, -92, -35, -28, -59, -91, -118, -151, -193, -234, -263, -276, -287, -300, -292, -249, -202, -188, -180, -122, -18, 59, 73, 59, 64, 97, 123, 112, 65, 22, 6, 1, -36, -122, -216, -272, -269, -230, -185, -147, -105, -46, 24, 84, 115, 116, 91, 45, -19, -99, -193, -295, -383, -416, -371, -267, -144, -27, 78, 166, 217, 226, 211, 191, 161, 124, 90, 64, 29, -20, -62, -79, -87, -98, -90, -34, 56, 143, 200, 232, 254, 258, 228, 168, 111, 77, 49, 7, -32, -45, -39, -34, -16, 38, 121, 188, 222, 239, 257, 273, 281, 289, 290, 255, 177, 104, 94, 137, 168, 158, 146, 159, 180, 192, 219, 266, 298, 298, 290, 273, 220, 135, 64, 18, -25, -69, -92, -92, -62, 4, 93, 162, 189, 183, 155, 102, 28, -55, -144, -239, -322, -366, -356, -300, -214, -104, 11, 97, 133, 140, 149, 151, 115, 43, -14, -33, -45, -88, -143, -175, -180, -177, -169, -154, -142, -123, -81, -23, 20, 42, 54, 65, 62, 36, -5, -46, -83, -131, -198, -265, -285, -242, -168, -106, -63, -20, 29, 72, 90, 79, 46, 8, -29, -63, -81, -66, -19, 33, 68, 79, 76, 67, 54, 25, -29, -90, -118, -95, -37, 32, 97, 143, 167, 189, 229, 268, 273, 240, 202, 189, 205, 224, 219, 183, 141, 115, 97, 88, 105, 151, 204, 236, 254, 279, 301, 301, 282, 275, 294, 313, 313, 297, 265, 210, 142, 98, 94, 107, 113, 122, 158, 215, 267, 297, 306, 294, 258, 197, 126, 55, -20, -98, -151, -152, -108, -57, -32, -26, -20, -15, -21, -44, -69, -90, -113, -130, -124, -92, -52, -14, 20, 41, 34, 7, -24, -52, -80, -114, -153, -187, -199, -185, -163, -152, -143, -133, -133, -148, -157, -158, -180, -241, -307, -338, -345, -365, -397, -402, -373, -352, -360, -374, -373, -362, -348, -330, -312, -300, -283, -250, -213, -193, -186, -171, -138, -103, -77, -61, -55, -61, -73, -77, -78, -81, -65, -14, 46, 70, 52, 25, 7, -8, -19, -19, -8, 4, 18, 33, 43, 44, 45, 60, 87, 109, 116, 114, 115, 130, 152, 166, 160, 137, 108, 91, 80, 62, 40, 26, 34, 52, 70, 88, 112, 135, 143, 130, 100, 67, 43, 38, 44, 49, 62, 85, 100, 97, 86, 72, 45, 8, -7, 11, 42, 58, 58, 52, 38, 17, 1, 4, 15, 13, -5, -17, -15, -15, -41, -89, -136, -159, -152, -124, -86, -46, -14, 6, 10, 5, -8, -32, -63, -92, -108, -108, -98, -86, -70, -53, -34, -10, 18, 40, 37, 19, 5, -2, -15, -28, -28, -9, 13, 29, 37, 37, 24, -1, -30, -54, -62, -51, -29, -9, 10, 26, 32, 27, 22, 25, 33, 37, 33, 19, 6, 1, 7, 7, -5, -25, -37, -35, -20, -2, 5, -8, -38, -70, -90, -96, -87, -64, -42, -44, -68, -87, -79, -65, -79, -116, -141, -135, -112, -95, -94, -100, -103, -100, -98, -99, -99, -99, -112, -130, -140, -141, -143, -148, -140, -118, -98, -91, -94, -96, -83, -56, -27, -10, -6, -6, -8, -14, -19, -28, -46, -70, -73, -54, -39, -45, -56, -48, -27, -18, -29, -37, -23, 2, 10, -6, -25, -28, -23, -29, -50, -68, -73, -68, -57, -45, -35, -29, -21, -9, 9, 27, 35, 28, 14, 7, 13, 23, 32, 35, 27, 16, 17, 33, 51, 60, 65, 80, 95, 98, 90, 80, 73, 73, 73, 71, 73, 89, 107, 107, 94, 86, 84, 70, 45, 25, 17, 20, 32, 45, 51, 50, 50, 55, 58, 52, 36, 8, -24, -47, -57, -61, -60, -50, -33, -21, -15, 0, 20, 32, 24, 4, -15, -25, -21, -15, -16, -26, -32, -21, -6, 1, 2, 6, 9, 5, -2, 0, 9, 9, 2, 4, 10, 11, 8, 10, 20, 27, 23, 9, -2, -7, -1, 8, 13, 8, 5, 15, 26, 24, 14, 8, 10, 10, 9, 15, 20, 20, 18, 17, 14, 10, 10, 15, 15, 11, 11, 20, 27, 22, 14, 17, 27, 29, 22, 17, 22, 29, 32, 31, 25, 19, 18, 22, 23, 17, 10, 10, 16, 16, 9, 4, 8, 15, 22, 25, 28, 28, 27, 25, 20, 14, 9, 7, 1, -6, -9, -2, 4, 7, 7, 5, 0, -2, -2, 0, 0, 0, -3, -8, -8, -7, -8, -11, -9, -2, -1, -8, -15, -15, -11, -11, -12, -11, -8, -5, -2, -2, -3, -6, -6, -6, -8, -10, -10, -8, -3, 0, 2, 2, 2, 2, 5, 7, 7, 4, 1, 1, 4, 4, 1, 0, 0, 2, 5, 6, 7, 7, 7, 7, 7, 8, 8, 8, 8, 8, 8, 9, 9, 9, 8, 8, 7, 7, 6, 6, 6, 7, 7, 6, 4, 1, 1, 2, 4, 5, 5, 5, 5, 6, 6, 5, 4, 4, 4, 4, 4, 4, 5, 5, 5, 2, 1, 1, 2, 4, 4, 2, 2, 2, 2, 1, 1, 2, 4, 4, 2, 2, 4, 4, 2, 2, 2, 2, 1, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 0, 0, 0, 1, 2, 2, 2, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, -2, -1, 1, 2, 0, -1, 0, 1, 2, 1, -1, -2 };
+// IMA ADPCM blocks, see audio_adpcm.h
+static const uint8_t __in_flash("audio_eighty_sample_data") audio_eighty_sample_data[] = { 0, 0, 0, 0, 187, 13, 20, 144, 16, 153, 153, 1, 1, 9, 1, 9, 1, 144, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 144, 0, 0, 16, 144, 16, 144, 16, 2, 16, 33, 0, 0, 9, 153, 16, 17, 153, 9, 17, 144, 26, 18, 144, 170, 16, 1, 155, 25, 18, 1, 10, 17, 153, 33, 176, 25, 2, 154, 16, 2, 154, 16, 0, 17, 17, 154, 25, 146, 10, 1, 9, 17, 0, 153, 0, 0, 16, 0, 9, 48, 144, 49, 160, 16, 185, 57, 185, 48, 19, 201, 128, 33, 0, 169, 16, 144, 153, 9, 50, 219, 25, 3, 144, 155, 32, 1, 154, 34, 185, 9, 35, 217, 11, 33, 145, 16, 201, 40, 35, 155, 25, 146, 187, 41, 18, 145, 9, 186, 64, 144, 58, 2, 9, 0, 153, 9, 187, 57, 147, 58, 4, 170, 49, 161, 26, 147, 157, 49, 184, 154, 17, 17, 50, 19, 171, 171, 25, 1, 153, 153, 65, 1, 33, 185, 16, 217, 155, 49, 146, 172, 64, 1, 18, 201, 0, 145, 42, 145, 28, 49, 153, 186, 169, 153, 65, 1, 18, 188, 64, 1, 4, 16, 217, 171, 0, 16, 37, 154, 97, 145, 168, 10, 38, 170, 32, 1, 171, 81, 176, 58, 134, 171, 18, 25, 162, 141, 34, 186, 36, 233, 24, 1, 17, 145, 16, 1, 188, 48, 193, 40, 195, 8, 33, 67, 48, 148, 156, 67, 176, 202, 25, 39, 201, 16, 144, 32, 144, 218, 139, 50, 52, 177, 141, 18, 169, 19, 188, 152, 81, 3, 154, 192, 8, 5, 25, 146, 173, 154, 104, 20, 169, 153, 48, 226, 11, 4, 154, 33, 185, 144, 11, 132, 90, 164, 154, 160, 48, 240, 41, 144, 41, 0, 69, 216, 41, 180, 157, 34, 136, 153, 25, 130, 154, 147, 41, 210, 44, 21, 217, 155, 16, 50, 131, 174, 50, 201, 10, 80, 4, 153, 169, 25, 194, 13, 39, 160, 136, 24, 21, 236, 40, 35, 129, 188, 64, 145, 154, 128, 115, 146, 156, 17, 152, 50, 144, 169, 57, 23, 138, 176, 12, 3, 140, 20, 153, 17, 144, 48, 251, 13, 3, 139, 130, 157, 67, 169, 18, 235, 32, 184, 16, 138, 19, 223, 25, 51, 19, 32, 208, 207, 32, 17, 145, 12, 37, 137, 144, 10, 52, 218, 40, 160, 136, 48, 7, 203, 16, 0, 100, 144, 40, 224, 156, 0, 137, 50, 160, 42, 51, 129, 42, 164, 255, 40, 129, 169, 158, 82, 145, 26, 20, 188, 69, 201, 32, 200, 80, 177, 26, 4, 156, 49, 160, 16, 153, 50, 186, 114, 160, 0, 185, 49, 160, 50, 222, 65, 176, 97, 192, 41, 194, 27, 6, 153, 17, 184, 24, 161, 142, 68, 217, 41, 146, 28, 21, 154, 48, 192, 10, 2, 172, 65, 192, 88, 179, 44, 6, 173, 50, 218, 65, 176, 57, 178, 43, 131, 141, 34, 169, 32, 145, 76, 0, 22, 0, 24, 4, 155, 83, 200, 171, 204, 11, 130, 125, 103, 0, 34, 169, 144, 239, 24, 152, 41, 34, 129, 17, 145, 171, 168, 191, 32, 160, 73, 161, 27, 133, 157, 35, 201, 33, 176, 57, 192, 11, 147, 189, 25, 35, 136, 87, 129, 65, 177, 142, 161, 158, 17, 153, 99, 129, 65, 145, 9, 153, 137, 187, 186, 11, 54, 66, 68, 0, 0, 186, 186, 171, 0, 186, 113, 52, 37, 168, 24, 232, 172, 152, 10, 145, 26, 22, 202, 25, 66, 38, 129, 98, 35, 18, 128, 144, 255, 143, 16, 152, 9, 49, 35, 33, 67, 130, 222, 188, 171, 169, 41, 55, 51, 52, 130, 171, 203, 187, 187, 170, 48, 87, 1, 33, 2, 66, 160, 189, 153, 138, 202, 27, 38, 152, 50, 184, 136, 239, 25, 16, 17, 17, 36, 0, 217, 173, 152, 171, 137, 26, 70, 50, 36, 32, 34, 202, 203, 204, 137, 136, 64, 84, 35, 18, 17, 128, 185, 172, 8, 170, 40, 160, 113, 2, 32, 2, 80, 20, 219, 154, 170, 187, 205, 154, 168, 155, 0, 49, 3, 112, 22, 234, 171, 218, 154, 152, 10, 50, 49, 55, 144, 25, 146, 138, 201, 157, 17, 187, 85, 2, 65, 3, 82, 131, 173, 24, 130, 169, 219, 10, 35, 169, 25, 85, 18, 8, 160, 206, 9, 184, 8, 217, 41, 4, 169, 8, 136, 136, 160, 175, 1, 169, 16, 144, 168, 10, 37, 128, 66, 35, 101, 35, 2, 128, 25, 55, 249, 27, 5, 139, 51, 128, 52, 185, 18, 170, 129, 207, 50, 185, 97, 184, 72, 152, 48, 152, 101, 129, 144, 189, 9, 249, 155, 1, 128, 169, 113, 54, 52, 53, 35, 144, 220, 171, 202, 25, 66, 83, 50, 17, 18, 169, 186, 204, 153, 203, 154, 136, 68, 19, 66, 146, 185, 252, 171, 185, 137, 17, 128, 184, 138, 145, 32, 130, 114, 178, 191, 202, 154, 152, 32, 20, 32, 51, 66, 36, 67, 34, 168, 203, 220, 139, 65, 50, 70, 18, 33, 0, 8, 185, 24, 216, 173, 169, 154, 65, 52, 36, 0, 128, 251, 189, 170, 155, 154, 171, 25, 128, 25, 34, 144, 253, 203, 186, 188, 138, 0, 17, 51, 19, 65, 36, 99, 20, 128, 17, 160, 171, 72, 86, 35, 67, 52, 2, 17, 1, 16, 168, 203, 137, 170, 56, 87, 18, 34, 146, 189, 220, 187, 170, 187, 9, 168, 137, 0, 40, 52, 233, 188, 204, 172, 168, 156, 67, 129, 48, 3, 56, 5, 41, 39, 152, 24, 129, 32, 162, 105, 87, 129, 8, 36, 1, 17, 128, 33, 192, 155, 8, 64, 36, 81, 36, 168, 170, 188, 187, 158, 128, 155, 17, 235, 137, 8, 144, 153, 18, 204, 137, 189, 186, 156, 0, 98, 53, 34, 34, 2, 138, 128, 113, 23, 8, 67, 168, 10, 136, 68, 128, 98, 2, 8, 152, 170, 25, 144, 138, 176, 255, 142, 24, 68, 68, 67, 2, 128, 202, 188, 171, 8, 34, 67, 67, 60, 71, 61, 0, 52, 2, 128, 154, 170, 223, 171, 186, 137, 49, 84, 34, 17, 185, 189, 204, 187, 137, 137, 136, 8, 16, 51, 51, 129, 250, 219, 235, 187, 137, 33, 51, 19, 65, 34, 17, 18, 33, 52, 250, 171, 186, 156, 115, 36, 50, 51, 2, 137, 170, 173, 25, 234, 154, 187, 48, 19, 86, 18, 16, 216, 188, 188, 154, 170, 16, 160, 40, 176, 187, 11, 216, 174, 186, 159, 153, 138, 16, 136, 52, 137, 115, 1, 48, 53, 128, 136, 219, 32, 2, 114, 37, 83, 3, 16, 18, 153, 0, 128, 187, 113, 20, 32, 35, 1, 137, 1, 222, 9, 176, 140, 168, 188, 203, 57, 162, 27, 39, 176, 205, 153, 219, 24, 1, 48, 128, 56, 162, 91, 38, 32, 4, 153, 137, 1, 9, 118, 35, 16, 51, 131, 169, 9, 0, 48, 34, 99, 50, 101, 3, 170, 34, 234, 138, 153, 65, 19, 33, 33, 129, 155, 99, 53, 217, 97, 177, 142, 152, 11, 36, 17, 37, 136, 144, 191, 153, 251, 154, 136, 136, 171, 115, 119, 17, 1, 128, 169, 204, 155, 25, 49, 54, 34, 1, 144, 153, 171, 169, 153, 8, 129, 202, 16, 18, 100, 19, 217, 189, 187, 187, 153, 9, 0, 0, 249, 173, 32, 128, 56, 192, 172, 221, 138, 153, 9, 35, 34, 146, 25, 38, 128, 144, 172, 219, 187, 10, 115, 35, 68, 19, 153, 137, 128, 152, 81, 2, 187, 136, 153, 114, 55, 19, 17, 200, 187, 188, 137, 17, 82, 145, 139, 160, 174, 0, 161, 187, 154, 252, 173, 137, 8, 128, 152, 136, 153, 136, 137, 70, 146, 154, 202, 220, 10, 68, 67, 52, 51, 20, 152, 24, 184, 10, 1, 9, 116, 52, 51, 52, 3, 219, 154, 219, 155, 33, 18, 1, 1, 177, 173, 51, 249, 40, 193, 174, 137, 153, 152, 64, 36, 152, 33, 201, 25, 160, 112, 22, 136, 160, 171, 153, 58, 103, 33, 51, 144, 155, 202, 172, 40, 51, 66, 37, 1, 128, 16, 17, 144, 137, 201, 223, 137, 24, 83, 36, 50, 129, 205, 187, 155, 136, 81, 21, 17, 161, 188, 169, 159, 49, 0, 82, 145, 136, 184, 156, 184, 175, 169, 186, 171, 114, 70, 83, 19, 129, 168, 205, 187, 139, 48, 69, 36, 18, 0, 136, 186, 187, 138, 9, 49, 34, 66, 51, 35, 3, 250, 189, 189, 187, 137, 18, 49, 20, 201, 219, 188, 136, 153, 32, 161, 220, 219, 187, 170, 24, 34, 35, 34, 144, 155, 251, 174, 136, 187, 10, 24, 69, 36, 67, 19, 152, 153, 202, 137, 24, 83, 18, 49, 53, 17, 99, 35, 136, 169, 218, 172, 137, 34, 67, 51, 144, 153, 221, 172, 169, 186, 171, 186, 219, 171, 0, 202, 172, 128, 237, 170, 185, 171, 136, 204, 32, 19, 48, 53, 67, 18, 50, 3, 138, 101, 2, 56, 71, 34, 83, 36, 18, 18, 144, 154, 128, 153, 115, 36, 51, 51, 50, 1, 153, 184, 255, 137, 144, 65, 13, 54, 0, 171, 66, 129, 49, 161, 138, 252, 156, 152, 154, 2, 152, 136, 160, 191, 64, 216, 56, 131, 26, 130, 139, 21, 187, 32, 136, 64, 20, 65, 70, 19, 1, 152, 170, 136, 191, 112, 21, 8, 33, 1, 169, 11, 68, 51, 216, 58, 134, 171, 8, 32, 20, 185, 9, 153, 137, 10, 84, 54, 131, 219, 187, 218, 174, 40, 2, 84, 3, 24, 146, 190, 187, 188, 170, 187, 57, 54, 99, 53, 35, 19, 169, 220, 204, 154, 128, 66, 68, 35, 17, 136, 169, 171, 187, 9, 1, 66, 51, 66, 19, 33, 2, 235, 189, 219, 171, 138, 137, 66, 130, 17, 208, 172, 203, 172, 185, 188, 153, 219, 155, 128, 153, 82, 130, 170, 218, 189, 187, 172, 10, 17, 17, 34, 36, 35, 144, 16, 208, 189, 24, 136, 114, 36, 50, 36, 17, 35, 144, 48, 130, 9, 18, 113, 71, 16, 34, 129, 137, 218, 139, 144, 173, 67, 192, 9, 160, 25, 224, 141, 0, 204, 153, 186, 155, 185, 10, 38, 217, 26, 129, 156, 153, 9, 37, 153, 81, 2, 32, 51, 51, 70, 35, 81, 19, 153, 66, 2, 65, 70, 35, 18, 33, 17, 0, 32, 70, 1, 33, 177, 56, 194, 157, 68, 1, 136, 128, 128, 250, 141, 18, 186, 56, 179, 159, 153, 171, 1, 187, 32, 146, 205, 187, 171, 201, 140, 37, 144, 50, 217, 48, 192, 58, 38, 145, 169, 41, 35, 48, 119, 36, 128, 40, 162, 155, 50, 128, 82, 85, 147, 10, 131, 188, 168, 12, 37, 24, 5, 188, 50, 249, 41, 18, 0, 153, 57, 194, 159, 18, 184, 56, 162, 12, 36, 202, 8, 176, 174, 219, 204, 172, 24, 83, 52, 54, 19, 136, 218, 188, 171, 154, 98, 67, 35, 35, 129, 169, 203, 171, 136, 153, 82, 35, 50, 54, 35, 128, 186, 206, 172, 170, 32, 34, 53, 35, 152, 220, 171, 170, 172, 136, 137, 152, 204, 136, 168, 138, 128, 218, 187, 206, 187, 170, 170, 137, 136, 0, 128, 16, 160, 188, 236, 190, 155, 136, 48, 70, 51, 2, 152, 169, 153, 154, 112, 36, 35, 2, 97, 19, 8, 51, 128, 2, 187, 65, 0, 97, 51, 53, 19, 50, 161, 221, 138, 201, 189, 24, 17, 128, 82, 162, 219, 235, 170, 169, 154, 152, 11, 2, 173, 81, 130, 153, 186, 251, 172, 16, 24, 85, 34, 33, 129, 1, 204, 57, 3, 114, 35, 65, 19, 40, 68, 34, 34, 33, 3, 138, 128, 114, 55, 40, 20, 152, 49, 186, 112, 161, 41, 162, 173, 0, 137, 81, 18, 32, 161, 207, 186, 202, 154, 33, 0, 66, 144, 203, 205, 155, 9, 32, 35, 153, 0, 251, 158, 66, 145, 56, 5, 153, 0, 9, 67, 152, 17, 187, 97, 34, 101, 51, 2, 185, 8, 189, 72, 161, 120, 39, 144, 137, 16, 184, 141, 50, 145, 25, 129, 24, 248, 12, 38, 160, 24, 152, 136, 202, 43, 19, 234, 188, 154, 251, 158, 48, 4, 241, 64, 0, 36, 51, 68, 1, 184, 205, 172, 137, 16, 67, 68, 34, 1, 153, 169, 203, 9, 136, 32, 36, 48, 54, 33, 18, 169, 205, 187, 171, 154, 83, 37, 19, 144, 154, 234, 172, 153, 153, 169, 186, 137, 217, 138, 68, 177, 156, 184, 206, 170, 154, 137, 154, 17, 168, 41, 3, 24, 248, 189, 203, 204, 153, 32, 53, 51, 35, 168, 204, 203, 170, 25, 83, 51, 67, 18, 17, 1, 16, 176, 155, 235, 41, 51, 115, 52, 35, 2, 32, 129, 189, 137, 154, 153, 155, 114, 52, 53, 3, 152, 251, 172, 154, 202, 9, 34, 34, 19, 50, 20, 200, 189, 204, 189, 139, 34, 68, 67, 51, 130, 204, 187, 187, 138, 65, 84, 50, 17, 34, 129, 171, 49, 240, 140, 51, 0, 65, 54, 3, 8, 1, 169, 186, 41, 71, 0, 49, 2, 152, 188, 98, 19, 33, 35, 184, 239, 9, 136, 16, 36, 66, 130, 172, 153, 201, 171, 40, 19, 153, 56, 131, 203, 138, 130, 255, 157, 16, 152, 80, 36, 33, 146, 188, 219, 172, 137, 65, 36, 35, 18, 153, 184, 156, 8, 81, 130, 172, 8, 8, 99, 35, 84, 130, 219, 170, 187, 25, 84, 35, 68, 19, 202, 138, 176, 174, 40, 18, 137, 40, 84, 144, 9, 177, 239, 170, 171, 10, 68, 85, 67, 130, 152, 203, 205, 154, 0, 34, 85, 34, 128, 152, 185, 172, 137, 9, 66, 20, 17, 35, 2, 153, 169, 249, 188, 10, 0, 50, 53, 36, 1, 218, 203, 169, 170, 8, 0, 0, 186, 203, 154, 24, 16, 130, 251, 207, 187, 154, 186, 25, 51, 17, 0, 1, 202, 206, 172, 203, 188, 10, 33, 99, 67, 18, 144, 203, 204, 154, 153, 32, 83, 51, 50, 34, 128, 136, 234, 172, 153, 0, 48, 71, 34, 17, 2, 168, 171, 154, 137, 16, 136, 65, 69, 51, 69, 35, 128, 202, 205, 171, 138, 17, 115, 36, 17, 130, 152, 200, 190, 136, 152, 9, 40, 70, 35, 16, 128, 168, 238, 154, 128, 8, 50, 83, 19, 17, 129, 203, 187, 153, 136, 48, 71, 18, 82, 130, 24, 1, 40, 50, 129, 170, 152, 190, 104, 52, 67, 53, 129, 153, 170, 186, 137, 68, 17, 83, 131, 24, 50, 34, 168, 189, 204, 205, 155, 98, 35, 51, 36, 200, 207, 154, 154, 0, 67, 35, 130, 168, 204, 187, 137, 8, 83, 2, 152, 169, 188, 16, 35, 67, 18, 217, 189, 173, 10, 115, 19, 65, 4, 186, 138, 170, 153, 138, 119, 2, 154, 33, 160, 171, 68, 130, 10, 145, 10, 144, 74, 71, 0, 17, 251, 137, 169, 9, 49, 101, 2, 154, 202, 220, 156, 25, 67, 53, 52, 18, 185, 206, 171, 138, 24, 99, 52, 19, 136, 153, 187, 189, 9, 34, 34, 50, 38, 1, 1, 168, 171, 219, 188, 138, 48, 69, 51, 35, 184, 205, 187, 154, 169, 16, 3, 202, 188, 172, 137, 50, 19, 169, 205, 206, 188, 154, 137, 24, 220, 219, 56, 0, 18, 35, 128, 170, 217, 206, 171, 203, 170, 8, 82, 52, 35, 1, 219, 173, 171, 154, 8, 83, 51, 34, 50, 129, 186, 169, 219, 203, 137, 83, 36, 34, 67, 19, 144, 9, 1, 202, 154, 17, 153, 72, 87, 37, 35, 33, 128, 218, 170, 170, 170, 65, 54, 50, 69, 34, 0, 169, 218, 206, 153, 1, 49, 100, 34, 1, 169, 219, 171, 154, 25, 68, 34, 34, 130, 153, 152, 172, 128, 202, 10, 32, 34, 115, 38, 33, 1, 169, 169, 155, 99, 130, 72, 19, 203, 25, 52, 83, 52, 37, 152, 219, 154, 168, 138, 100, 51, 34, 34, 145, 220, 170, 153, 154, 66, 36, 18, 52, 160, 171, 234, 188, 155, 8, 8, 50, 34, 2, 169, 237, 188, 169, 188, 139, 51, 168, 80, 18, 24, 130, 204, 139, 161, 255, 74, 132, 154, 50, 19, 234, 139, 36, 153, 72, 35, 128, 8, 208, 12, 35, 187, 116, 2, 168, 10, 130, 171, 82, 0, 70, 145, 9, 161, 171, 144, 141, 52, 128, 52, 144, 50, 209, 170, 250, 207, 171, 136, 17, 87, 52, 18, 129, 218, 219, 187, 9, 50, 68, 52, 19, 136, 187, 186, 202, 9, 32, 52, 51, 37, 18, 34, 144, 220, 187, 219, 138, 49, 53, 36, 2, 144, 204, 187, 170, 24, 152, 152, 250, 170, 155, 48, 51, 52, 216, 204, 205, 171, 138, 137, 17, 51, 1, 136, 186, 235, 220, 187, 187, 203, 24, 68, 66, 34, 144, 203, 189, 156, 153, 16, 50, 52, 18, 128, 136, 128, 153, 128, 235, 139, 24, 17, 100, 52, 36, 1, 128, 170, 171, 139, 67, 152, 80, 55, 4, 16, 37, 144, 170, 154, 185, 139, 86, 36, 33, 50, 2, 201, 156, 152, 186, 10, 84, 34, 67, 36, 152, 153, 189, 154, 218, 41, 36, 18, 1, 16, 129, 203, 9, 2, 207, 10, 35, 202, 64, 38, 0, 0, 8, 129, 235, 41, 36, 169, 25, 51, 2, 32, 119, 4, 137, 1, 184, 173, 9, 82, 18, 49, 53, 145, 154, 9, 153, 171, 80, 20, 17, 18, 66, 3, 170, 189, 137, 219, 10, 16, 54, 184, 74, 149, 191, 40, 161, 171, 0, 144, 172, 185, 141, 67, 201, 155, 51, 234, 11, 50, 160, 155, 145, 158, 51, 221, 72, 131, 153, 24, 19, 188, 113, 130, 9, 33, 131, 239, 40, 130, 24, 37, 17, 200, 10, 145, 141, 18, 49, 38, 128, 17, 153, 144, 190, 66, 192, 43, 19, 152, 66, 19, 234, 189, 188, 170, 41, 119, 51, 51, 129, 235, 186, 204, 25, 34, 68, 52, 1, 152, 169, 172, 9, 16, 50, 52, 35, 16, 34, 35, 136, 233, 187, 205, 27, 53, 50, 52, 2, 235, 203, 155, 136, 24, 35, 168, 220, 172, 186, 26, 67, 2, 185, 190, 220, 203, 138, 24, 128, 16, 0, 169, 219, 186, 235, 172, 171, 170, 9, 67, 34, 52, 200, 189, 189, 187, 136, 32, 66, 67, 2, 136, 154, 169, 203, 171, 137, 150, 187, 42, 0, 32, 51, 119, 35, 16, 136, 153, 170, 10, 49, 85, 35, 1, 17, 136, 81, 53, 67, 17, 128, 186, 169, 96, 38, 17, 53, 3, 153, 153, 16, 0, 128, 80, 21, 9, 53, 50, 19, 218, 186, 204, 189, 40, 22, 49, 36, 176, 153, 251, 10, 136, 8, 16, 51, 168, 80, 160, 64, 146, 172, 154, 186, 40, 86, 51, 51, 161, 188, 185, 172, 97, 83, 52, 129, 136, 136, 171, 56, 67, 116, 18, 137, 16, 128, 16, 67, 52, 1, 187, 80, 161, 59, 87, 144, 152, 169, 138, 33, 51, 49, 5, 221, 187, 171, 153, 40, 52, 184, 188, 220, 187, 154, 186, 12, 216, 12, 162, 172, 1, 153, 200, 174, 16, 168, 12, 85, 145, 156, 17, 217, 155, 66, 18, 136, 33, 161, 188, 140, 86, 130, 48, 21, 170, 170, 8, 33, 35, 49, 119, 145, 25, 2, 8, 16, 128, 136, 9, 115, 35, 9, 102, 145, 170, 136, 9, 144, 41, 71, 168, 154, 153, 237, 138, 98, 67, 20, 2, 136, 201, 190, 171, 32, 67, 68, 35, 17, 168, 188, 170, 152, 24, 99, 34, 1, 32, 51, 145, 186, 187, 237, 157, 32, 2, 66, 37, 168, 203, 187, 154, 152, 48, 2, 219, 221, 170, 170, 40, 37, 0, 169, 236, 203, 170, 154, 0, 1, 1, 168, 138, 185, 173, 186, 238, 187, 154, 153, 48, 85, 18, 144, 203, 188, 172, 153, 16, 35, 35, 34, 128, 137, 128, 186, 138, 234, 190, 41, 53, 35, 50, 36, 128, 136, 154, 81, 130, 136, 168, 8, 105, 119, 51, 36, 152, 8, 218, 171, 32, 67, 50, 70, 2, 9, 17, 0, 186, 41, 147, 174, 97, 52, 17, 36, 1, 218, 173, 136, 170, 80, 36, 1, 33, 168, 173, 138, 16, 153, 42, 22, 202, 138, 82, 1, 32, 52, 192, 174, 136, 154, 136, 97, 35, 8, 2, 0, 169, 8, 3, 169, 170, 41, 184, 120, 119, 35, 0, 1, 184, 188, 187, 88, 37, 34, 37, 130, 170, 154, 202, 137, 34, 85, 2, 9, 1, 186, 140, 16, 168, 57, 131, 251, 188, 10, 152, 137, 83, 145, 219, 186, 204, 171, 137, 128, 203, 154, 187, 172, 40, 51, 153, 34, 255, 172, 186, 56, 23, 8, 1, 168, 187, 188, 26, 69, 18, 82, 130, 203, 8, 128, 24, 54, 3, 0, 136, 17, 201, 96, 37, 152, 25, 52, 153, 113, 35, 1, 128, 217, 174, 16, 129, 80, 35, 1, 2, 152, 202, 205, 172, 203, 171, 33, 101, 54, 37, 1, 168, 203, 189, 170, 16, 83, 52, 36, 2, 152, 186, 186, 153, 136, 82, 19, 49, 53, 18, 51, 146, 235, 187, 204, 9, 34, 83, 51, 129, 203, 187, 171, 136, 33, 200, 174, 236, 172, 8, 24, 67, 2, 169, 188, 206, 187, 154, 8, 8, 32, 130, 153, 170, 185, 223, 172, 186, 172, 138, 16, 67, 35, 1, 217, 190, 171, 170, 154, 48, 51, 18, 1, 32, 131, 205, 138, 201, 190, 146, 193, 47, 0, 9, 50, 50, 52, 67, 18, 128, 17, 136, 33, 216, 172, 24, 33, 119, 52, 52, 17, 128, 152, 188, 139, 16, 68, 68, 52, 18, 1, 17, 144, 172, 9, 144, 10, 87, 36, 51, 18, 128, 186, 206, 154, 17, 17, 83, 50, 128, 138, 145, 188, 25, 184, 157, 136, 186, 41, 18, 115, 6, 168, 137, 169, 188, 157, 17, 168, 42, 50, 54, 130, 114, 3, 186, 170, 220, 154, 128, 96, 53, 34, 51, 2, 136, 186, 170, 203, 72, 36, 49, 119, 2, 32, 1, 153, 169, 170, 154, 40, 69, 67, 18, 129, 185, 156, 171, 139, 32, 35, 144, 218, 191, 154, 202, 26, 18, 202, 56, 250, 175, 153, 186, 137, 17, 144, 138, 50, 216, 140, 129, 239, 155, 9, 17, 68, 36, 3, 128, 235, 189, 171, 16, 51, 69, 35, 1, 169, 204, 170, 137, 32, 52, 2, 16, 128, 152, 9, 18, 9, 176, 223, 25, 66, 67, 68, 129, 219, 186, 171, 73, 53, 83, 3, 185, 171, 203, 26, 71, 34, 17, 128, 186, 154, 154, 98, 18, 32, 0, 137, 16, 115, 4, 202, 205, 188, 138, 64, 85, 52, 34, 128, 202, 188, 172, 9, 33, 51, 69, 2, 0, 1, 128, 138, 185, 187, 186, 11, 87, 52, 35, 33, 161, 204, 186, 138, 66, 34, 33, 162, 190, 171, 136, 82, 35, 1, 202, 221, 204, 10, 144, 9, 17, 152, 154, 153, 169, 250, 203, 219, 204, 155, 9, 16, 33, 51, 192, 190, 186, 189, 155, 136, 9, 136, 154, 152, 153, 16, 144, 220, 188, 221, 172, 9, 17, 33, 67, 144, 187, 172, 8, 32, 37, 0, 250, 172, 153, 65, 52, 52, 18, 168, 187, 136, 8, 99, 53, 2, 170, 41, 71, 34, 66, 35, 152, 171, 137, 16, 116, 67, 35, 144, 8, 168, 11, 70, 20, 50, 3, 185, 170, 172, 48, 34, 50, 37, 168, 56, 53, 50, 132, 220, 172, 203, 11, 66, 34, 35, 184, 190, 171, 186, 136, 8, 99, 161, 190, 154, 184, 140, 34, 17, 36, 168, 171, 170, 191, 153, 187, 48, 146, 40, 119, 52, 18, 128, 169, 235, 172, 48, 36, 65, 68, 2, 0, 152, 187, 57, 146, 41, 71, 51, 35, 16, 128, 201, 156, 32, 35, 18, 68, 130, 188, 32, 146, 57, 103, 130, 185, 169, 204, 154, 16, 52, 162, 157, 65, 177, 140, 54, 176, 187, 236, 188, 24, 49, 70, 34, 0, 169, 205, 187, 9, 33, 83, 35, 144, 170, 169, 10, 52, 50, 37, 251, 172, 153, 0, 65, 38, 1, 144, 187, 188, 42, 21, 0, 19, 184, 205, 170, 33, 83, 52, 3, 234, 187, 203, 138, 49, 51, 18, 144, 188, 57, 53, 20, 128, 218, 222, 187, 8, 48, 70, 18, 1, 160, 219, 137, 168, 48, 2, 8, 128, 169, 72, 103, 18, 0, 136, 200, 155, 8, 83, 35, 2, 153, 203, 26, 52, 67, 70, 130, 235, 154, 128, 171, 25, 1, 203, 172, 96, 53, 51, 35, 29, 29, 50, 0, 2, 239, 171, 169, 8, 65, 67, 19, 18, 168, 186, 171, 136, 185, 25, 17, 68, 67, 71, 2, 1, 201, 156, 186, 41, 35, 85, 3, 152, 186, 171, 9, 115, 34, 35, 216, 204, 187, 170, 25, 67, 35, 36, 184, 170, 235, 203, 187, 170, 203, 138, 40, 68, 35, 1, 251, 188, 190, 153, 137, 32, 35, 18, 136, 235, 173, 154, 153, 17, 1, 50, 168, 152, 154, 193, 175, 0, 170, 49, 50, 70, 18, 160, 188, 221, 11, 50, 82, 53, 17, 144, 186, 204, 139, 33, 66, 54, 49, 17, 128, 169, 154, 169, 155, 50, 101, 37, 34, 19, 144, 218, 187, 169, 48, 55, 36, 34, 0, 185, 157, 137, 138, 66, 0, 81, 18, 0, 137, 1, 221, 187, 8, 160, 73, 54, 35, 216, 187, 153, 235, 42, 55, 1, 16, 144, 203, 171, 8, 17, 32, 71, 160, 42, 146, 139, 22, 188, 65, 162, 43, 55, 129, 32, 2, 168, 203, 10, 34, 137, 103, 2, 8, 128, 0, 152, 9, 18, 202, 56, 131, 90, 23, 16, 52, 217, 9, 169, 26, 36, 168, 49, 249, 141, 0, 24, 20, 137, 2, 207, 138, 128, 0, 34, 2, 251, 171, 137, 184, 73, 36, 48, 22, 219, 153, 170, 24, 51, 36, 3, 251, 171, 153, 40, 52, 1, 50, 249, 157, 136, 40, 38, 144, 48, 147, 223, 25, 2, 32, 35, 19, 184, 206, 171, 56, 36, 32, 68, 177, 174, 136, 169, 82, 3, 8, 129, 185, 173, 24, 49, 52, 168, 136, 222, 10, 49, 36, 16, 34, 218, 171, 153, 66, 33, 37, 250, 153, 0, 66, 34, 51, 2, 251, 173, 9, 16, 50, 37, 160, 187, 218, 155, 136, 81, 132, 156, 17, 234, 10, 168, 204, 155, 169, 73, 69, 68, 37, 152, 169, 234, 171, 9, 49, 84, 35, 33, 144, 186, 154, 137, 48, 50, 51, 99, 36, 32, 69, 146, 153, 187, 155, 0, 101, 68, 17, 168, 169, 202, 139, 83, 18, 33, 176, 221, 187, 138, 16, 33, 52, 146, 190, 171, 187, 189, 139, 168, 204, 136, 16, 0, 32, 208, 206, 188, 172, 153, 8, 35, 17, 1, 234, 204, 154, 153, 136, 33, 34, 153, 8, 184, 171, 16, 128, 152, 138, 51, 0, 119, 5, 169, 153, 56, 53, 115, 67, 129, 144, 218, 170, 8, 82, 54, 20, 17, 0, 153, 171, 24, 128, 98, 36, 36, 0, 65, 146, 170, 154, 9, 153, 97, 52, 34, 34, 2, 251, 156, 137, 137, 32, 3, 48, 19, 220, 170, 187, 187, 172, 154, 99, 162, 27, 210, 159, 152, 170, 82, 1, 170, 9, 216, 174, 66, 19, 128, 33, 161, 219, 186, 137, 136, 65, 53, 130, 104, 22, 168, 49, 129, 16, 172, 82, 160, 41, 38, 152, 32, 200, 42, 4, 12, 87, 144, 10, 144, 188, 40, 36, 32, 54, 146, 8, 160, 187, 169, 24, 18, 114, 39, 17, 18, 144, 154, 233, 140, 20, 128, 65, 51, 128, 137, 16, 160, 190, 248, 14, 42, 0, 96, 146, 155, 98, 145, 138, 17, 168, 220, 138, 1, 171, 98, 19, 192, 156, 2, 205, 25, 19, 152, 17, 251, 139, 160, 27, 38, 153, 16, 250, 140, 128, 8, 51, 162, 10, 249, 173, 40, 17, 33, 50, 2, 236, 171, 24, 129, 64, 53, 129, 153, 137, 185, 72, 20, 16, 128, 24, 130, 155, 118, 18, 170, 171, 169, 202, 88, 70, 2, 128, 153, 250, 187, 32, 20, 83, 52, 129, 154, 185, 190, 170, 32, 53, 33, 82, 19, 186, 155, 168, 203, 24, 51, 17, 84, 19, 137, 24, 208, 191, 138, 8, 68, 67, 84, 145, 154, 186, 191, 9, 0, 49, 53, 144, 8, 184, 171, 1, 16, 69, 161, 190, 139, 16, 8, 115, 130, 171, 185, 188, 137, 138, 100, 208, 174, 24, 169, 72, 69, 18, 0, 168, 203, 189, 138, 34, 50, 70, 18, 144, 8, 152, 187, 24, 19, 185, 96, 36, 34, 67, 53, 200, 140, 128, 171, 33, 83, 35, 152, 170, 186, 187, 97, 52, 17, 234, 187, 206, 153, 128, 33, 18, 8, 185, 188, 219, 203, 154, 218, 172, 138, 153, 49, 36, 1, 218, 190, 188, 203, 137, 16, 33, 33, 129, 189, 155, 186, 188, 25, 129, 10, 0, 32, 131, 42, 7, 156, 168, 157, 67, 67, 20, 160, 156, 129, 191, 113, 35, 33, 35, 144, 220, 170, 40, 2, 81, 54, 18, 24, 1, 169, 170, 8, 51, 136, 118, 20, 16, 17, 144, 144, 169, 26, 18, 82, 53, 18, 16, 1, 170, 187, 43, 55, 64, 20, 204, 9, 218, 26, 37, 16, 85, 145, 171, 203, 172, 136, 33, 69, 2, 8, 202, 188, 155, 8, 67, 51, 33, 145, 235, 170, 169, 9, 18, 153, 100, 19, 81, 35, 152, 168, 205, 138, 33, 84, 51, 35, 1, 153, 171, 41, 68, 66, 52, 129, 136, 169, 171, 170, 25, 87, 35, 82, 131, 219, 153, 251, 139, 17, 17, 50, 18, 128, 202, 189, 203, 138, 152, 169, 40, 55, 2, 32, 177, 223, 187, 170, 24, 35, 84, 52, 184, 170, 204, 139, 33, 51, 52, 35, 216, 187, 157, 16, 16, 99, 36, 129, 137, 0, 65, 161, 187, 219, 188, 10, 65, 103, 36, 0, 152, 219, 188, 137, 16, 83, 51, 35, 144, 235, 171, 186, 42, 19, 32, 52, 160, 139, 129, 188, 9, 234, 171, 33, 83, 53, 18, 169, 221, 205, 138, 40, 50, 53, 36, 160, 202, 203, 154, 9, 49, 53, 3, 144, 152, 169, 188, 24, 128, 128, 154, 97, 1, 136, 204, 172, 9, 34, 100, 67, 36, 144, 169, 188, 187, 10, 34, 114, 52, 34, 34, 50, 145, 189, 154, 202, 42, 53, 98, 20, 1, 34, 186, 41, 168, 40, 51, 36, 170, 185, 189, 40, 52, 67, 53, 161, 186, 255, 155, 152, 154, 0, 169, 154, 153, 138, 18, 219, 235, 223, 187, 171, 9, 16, 32, 34, 216, 190, 170, 186, 171, 153, 203, 203, 172, 154, 0, 33, 18, 184, 207, 203, 189, 162, 229, 43, 0, 138, 8, 17, 128, 170, 203, 172, 49, 22, 16, 18, 221, 187, 153, 10, 115, 18, 0, 128, 152, 0, 64, 67, 144, 169, 171, 136, 97, 103, 18, 0, 16, 152, 154, 17, 51, 84, 34, 32, 34, 17, 98, 35, 16, 70, 1, 25, 49, 161, 72, 20, 24, 52, 1, 84, 18, 67, 35, 129, 217, 170, 219, 26, 66, 68, 34, 19, 168, 137, 185, 48, 4, 9, 66, 208, 140, 36, 8, 68, 161, 219, 57, 4, 137, 49, 145, 202, 138, 35, 17, 68, 54, 3, 81, 131, 136, 251, 155, 0, 168, 114, 39, 17, 17, 152, 136, 184, 187, 8, 136, 97, 52, 67, 36, 144, 1, 250, 10, 168, 156, 48, 2, 48, 22, 64, 21, 152, 169, 206, 171, 48, 36, 17, 0, 32, 161, 223, 9, 17, 17, 128, 169, 203, 188, 80, 20, 16, 130, 205, 171, 16, 1, 99, 1, 49, 192, 174, 8, 152, 9, 84, 18, 153, 8, 176, 175, 8, 17, 49, 162, 190, 9, 51, 136, 116, 19, 144, 186, 186, 207, 170, 40, 51, 67, 131, 9, 19, 218, 40, 192, 173, 169, 206, 26, 67, 17, 83, 130, 186, 188, 136, 136, 8, 0, 152, 40, 224, 156, 17, 137, 99, 35, 234, 171, 153, 8, 18, 136, 67, 36, 160, 174, 170, 155, 67, 168, 48, 160, 205, 236, 188, 154, 64, 68, 35, 34, 200, 140, 0, 154, 33, 129, 201, 156, 48, 69, 68, 51, 129, 170, 204, 170, 0, 67, 84, 1, 8, 128, 40, 20, 81, 147, 11, 160, 158, 137, 82, 19, 34, 128, 170, 9, 160, 42, 39, 203, 153, 220, 138, 32, 35, 64, 37, 169, 188, 205, 186, 139, 16, 18, 1, 24, 144, 172, 217, 173, 201, 190, 138, 169, 138, 50, 146, 188, 153, 220, 172, 154, 203, 9, 1, 186, 154, 251, 159, 136, 136, 8, 0, 176, 207, 154, 8, 137, 24, 128, 152, 154, 168, 174, 16, 201, 187, 188, 139, 160, 122, 55, 129, 49, 161, 190, 169, 9, 82, 53, 50, 34, 201, 187, 16, 2, 115, 3, 9, 136, 65, 19, 99, 20, 1, 128, 25, 52, 34, 19, 0, 35, 168, 72, 21, 66, 53, 49, 55, 34, 1, 153, 24, 40, 87, 0, 115, 2, 34, 130, 0, 252, 156, 128, 33, 52, 49, 161, 175, 48, 54, 130, 251, 187, 154, 80, 53, 51, 2, 201, 203, 172, 24, 51, 53, 130, 8, 169, 172, 8, 33, 34, 19, 200, 155, 153, 154, 64, 38, 169, 138, 153, 81, 83, 177, 191, 153, 169, 138, 17, 49, 69, 52, 35, 202, 190, 189, 137, 16, 50, 37, 129, 136, 168, 203, 9, 18, 0, 176, 223, 171, 136, 8, 81, 52, 19, 18, 216, 205, 203, 171, 24, 53, 18, 66, 19, 128, 137, 202, 204, 171, 10, 49, 83, 68, 36, 2, 185, 205, 172, 153, 0, 33, 67, 35, 129, 185, 189, 154, 82, 36, 1, 129, 220, 172, 9, 128, 16, 66, 67, 35, 18, 144, 251, 204, 170, 162, 251, 47, 0, 154, 41, 86, 51, 18, 1, 218, 188, 154, 154, 48, 52, 20, 17, 136, 169, 172, 153, 188, 9, 24, 69, 146, 138, 177, 207, 187, 8, 50, 69, 52, 18, 144, 218, 186, 170, 49, 52, 68, 52, 35, 1, 33, 160, 173, 0, 144, 113, 53, 50, 67, 34, 185, 138, 186, 58, 5, 81, 37, 144, 16, 184, 140, 34, 144, 8, 234, 188, 188, 187, 155, 16, 185, 10, 250, 174, 168, 190, 186, 219, 172, 153, 153, 16, 1, 128, 250, 189, 187, 173, 170, 136, 8, 8, 144, 185, 187, 204, 187, 219, 155, 153, 155, 67, 35, 98, 20, 185, 171, 204, 26, 50, 115, 51, 1, 136, 152, 169, 115, 39, 33, 34, 200, 170, 17, 137, 116, 19, 67, 3, 152, 33, 192, 11, 36, 136, 81, 2, 99, 35, 34, 129, 152, 187, 138, 24, 116, 52, 99, 2, 136, 128, 204, 9, 17, 16, 100, 2, 16, 160, 139, 1, 0, 49, 22, 169, 82, 129, 0, 233, 40, 4, 26, 54, 160, 141, 129, 170, 48, 67, 52, 201, 10, 145, 203, 24, 53, 0, 145, 189, 17, 236, 57, 19, 49, 22, 201, 10, 147, 175, 48, 19, 153, 0, 1, 81, 2, 16, 3, 223, 9, 129, 10, 84, 2, 144, 186, 137, 220, 40, 18, 169, 41, 162, 191, 137, 9, 34, 184, 155, 18, 204, 128, 255, 139, 144, 153, 17, 128, 16, 160, 189, 186, 237, 154, 8, 50, 52, 33, 37, 249, 171, 187, 9, 34, 67, 87, 20, 136, 137, 185, 220, 138, 33, 52, 34, 50, 2, 202, 139, 16, 17, 35, 235, 56, 178, 142, 85, 146, 153, 128, 201, 170, 66, 35, 168, 171, 152, 221, 25, 68, 130, 137, 220, 172, 138, 24, 52, 18, 1, 192, 221, 137, 0, 32, 18, 8, 219, 155, 137, 0, 25, 87, 176, 10, 18, 235, 8, 218, 171, 234, 139, 115, 35, 82, 35, 168, 219, 187, 170, 9, 100, 67, 18, 16, 17, 153, 154, 0, 128, 152, 56, 55, 82, 52, 51, 146, 172, 200, 140, 18, 50, 20, 1, 153, 204, 10, 54, 0, 33, 202, 190, 173, 153, 8, 49, 32, 19, 204, 171, 189, 203, 171, 170, 172, 10, 16, 128, 33, 208, 207, 187, 188, 156, 8, 48, 18, 1, 144, 220, 172, 153, 169, 10, 17, 1, 17, 99, 20, 136, 8, 203, 154, 152, 114, 37, 1, 1, 16, 152, 97, 37, 1, 49, 192, 11, 146, 28, 103, 17, 32, 35, 169, 137, 144, 202, 41, 54, 51, 83, 67, 130, 152, 203, 203, 170, 64, 53, 67, 34, 1, 217, 187, 154, 9, 32, 66, 34, 17, 34, 145, 33, 250, 189, 188, 8, 25, 87, 1, 50, 249, 138, 128, 8, 34, 115, 146, 171, 201, 141, 33, 16, 87, 129, 8, 169, 188, 139, 8, 17, 116, 3, 128, 17, 153, 185, 156, 168, 10, 131, 41, 103, 18, 17, 0, 184, 190, 154, 185, 48, 53, 67, 35, 152, 185, 190, 171, 9, 17, 8, 71, 144, 211, 20, 52, 0, 137, 144, 136, 251, 41, 146, 170, 136, 24, 161, 26, 163, 28, 181, 159, 1, 188, 66, 160, 25, 216, 9, 192, 58, 21, 49, 163, 12, 224, 174, 168, 56, 21, 25, 39, 168, 137, 186, 138, 153, 81, 18, 65, 146, 10, 144, 27, 194, 159, 0, 155, 52, 40, 119, 128, 8, 169, 172, 153, 16, 50, 70, 1, 0, 216, 171, 137, 8, 32, 68, 2, 136, 144, 169, 171, 65, 163, 174, 16, 184, 11, 21, 32, 37, 202, 41, 177, 175, 66, 3, 188, 26, 176, 191, 48, 37, 0, 18, 144, 205, 155, 219, 139, 129, 10, 101, 18, 32, 19, 168, 220, 186, 187, 25, 67, 69, 50, 36, 129, 169, 169, 203, 9, 0, 82, 50, 39, 34, 35, 152, 152, 235, 154, 136, 65, 51, 68, 2, 8, 128, 24, 233, 27, 162, 191, 186, 10, 144, 80, 51, 3, 184, 252, 188, 187, 172, 154, 8, 0, 17, 18, 170, 186, 255, 156, 202, 138, 153, 40, 33, 50, 145, 170, 221, 188, 171, 138, 0, 16, 33, 67, 2, 153, 136, 177, 255, 10, 128, 25, 50, 83, 20, 128, 17, 145, 136, 17, 152, 136, 186, 117, 18, 87, 18, 35, 146, 9, 234, 138, 16, 65, 52, 50, 68, 130, 0, 17, 168, 138, 169, 26, 36, 118, 36, 18, 17, 136, 235, 155, 0, 8, 67, 67, 20, 153, 49, 160, 154, 155, 19, 239, 9, 66, 2, 56, 37, 169, 187, 155, 136, 40, 101, 19, 152, 154, 137, 129, 56, 70, 3, 252, 139, 0, 186, 120, 37, 128, 8, 168, 203, 11, 33, 32, 52, 17, 130, 190, 138, 8, 36, 184, 104, 177, 141, 66, 17, 17, 17, 176, 205, 204, 9, 36, 0, 67, 2, 202, 203, 138, 137, 128, 99, 2, 8, 250, 10, 144, 138, 33, 130, 169, 171, 185, 191, 81, 19, 137, 40, 194, 223, 128, 128, 50, 145, 136, 128, 235, 172, 65, 1, 24, 18, 153, 1, 206, 57, 20, 24, 128, 128, 251, 155, 8, 66, 51, 37, 216, 41, 241, 140, 66, 129, 128, 24, 177, 159, 136, 24, 21, 16, 36, 153, 168, 207, 24, 169, 56, 21, 1, 24, 18, 234, 10, 128, 153, 185, 9, 145, 113, 3, 82, 132, 154, 168, 236, 170, 40, 19, 25, 85, 145, 154, 128, 186, 9, 169, 32, 1, 178, 159, 70, 144, 8, 32, 145, 206, 138, 1, 9, 52, 34, 18, 185, 223, 171, 185, 9, 152, 80, 3, 0, 250, 10, 145, 139, 18, 33, 248, 156, 0, 169, 137, 115, 4, 16, 130, 138, 129, 156, 17, 10, 54, 51, 37, 17, 54, 1, 136, 48, 193, 12, 53, 18, 69, 19, 33, 3, 204, 25, 129, 16, 35, 86, 130, 137, 128, 171, 41, 19, 200, 80, 178, 175, 168, 154, 136, 154, 34, 144, 252, 188, 186, 202, 203, 41, 145, 173, 160, 204, 168, 171, 144, 205, 136, 203, 138, 169, 24, 176, 138, 233, 172, 220, 10, 129, 8, 35, 18, 233, 139, 160, 156, 50, 220, 39, 0, 17, 40, 35, 137, 18, 9, 82, 100, 36, 8, 1, 186, 48, 169, 117, 37, 33, 17, 17, 185, 27, 53, 34, 98, 20, 1, 145, 42, 66, 34, 49, 71, 136, 16, 138, 69, 0, 67, 18, 0, 169, 48, 146, 120, 22, 16, 145, 48, 148, 43, 39, 153, 36, 152, 16, 137, 23, 169, 66, 0, 17, 8, 2, 186, 50, 192, 115, 149, 58, 5, 139, 161, 12, 4, 171, 115, 129, 0, 153, 0, 219, 10, 65, 19, 32, 161, 189, 136, 170, 97, 131, 204, 136, 144, 189, 88, 36, 128, 169, 187, 171, 218, 155, 85, 19, 168, 139, 248, 189, 9, 49, 19, 16, 147, 159, 144, 175, 65, 129, 9, 8, 129, 189, 64, 129, 49, 129, 8, 221, 11, 0, 48, 35, 85, 146, 188, 153, 25, 168, 113, 21, 136, 137, 137, 160, 12, 52, 50, 19, 186, 203, 206, 9, 35, 49, 54, 144, 170, 188, 138, 153, 49, 52, 36, 201, 11, 129, 9, 160, 107, 149, 174, 169, 40, 131, 104, 37, 0, 250, 138, 144, 172, 49, 34, 51, 185, 65, 250, 10, 152, 9, 128, 24, 176, 156, 176, 75, 39, 168, 153, 154, 186, 223, 57, 4, 9, 34, 168, 202, 156, 144, 154, 33, 66, 5, 219, 138, 9, 34, 169, 101, 144, 9, 202, 137, 219, 80, 131, 56, 131, 40, 249, 27, 147, 28, 37, 16, 146, 173, 34, 185, 32, 85, 4, 202, 48, 176, 41, 129, 100, 177, 43, 194, 142, 129, 48, 23, 144, 0, 184, 173, 153, 65, 51, 66, 20, 185, 205, 139, 136, 41, 54, 33, 1, 170, 171, 139, 128, 139, 39, 170, 9, 25, 38, 9, 39, 217, 9, 201, 25, 144, 97, 145, 8, 145, 139, 168, 56, 4, 154, 200, 12, 195, 143, 83, 0, 16, 152, 0, 221, 25, 146, 9, 36, 2, 129, 172, 49, 232, 138, 0, 137, 185, 26, 52, 249, 172, 48, 177, 11, 53, 35, 161, 156, 152, 174, 136, 10, 70, 18, 51, 144, 16, 217, 170, 25, 53, 16, 69, 0, 83, 168, 48, 162, 42, 195, 12, 53, 1, 35, 49, 21, 187, 16, 153, 32, 233, 24, 146, 137, 185, 120, 132, 204, 32, 224, 172, 128, 201, 10, 0, 168, 185, 136, 251, 173, 152, 203, 137, 187, 40, 161, 156, 169, 186, 255, 138, 168, 155, 17, 8, 34, 202, 144, 207, 24, 169, 24, 8, 3, 170, 144, 42, 6, 137, 69, 168, 139, 1, 98, 177, 91, 22, 16, 2, 10, 36, 137, 66, 18, 18, 24, 70, 145, 26, 87, 17, 8, 33, 19, 202, 11, 50, 146, 112, 55, 128, 0, 1, 168, 202, 11, 53, 2, 18, 50, 131, 171, 32, 168, 155, 115, 166, 159, 50, 176, 64, 20, 144, 152, 24, 249, 138, 16, 82, 163, 12, 37, 168, 154, 88, 4, 203, 56, 145, 172, 58, 55, 145, 16, 144, 152, 252, 9, 36, 152, 32, 34, 184, 141, 1, 153, 8, 83, 209, 157, 49, 161, 58, 38, 169, 169, 57, 11, 42, 0, 187, 155, 170, 97, 68, 130, 186, 137, 154, 237, 42, 21, 152, 17, 169, 185, 173, 64, 145, 48, 18, 24, 250, 143, 128, 0, 144, 64, 132, 187, 25, 0, 201, 26, 54, 201, 10, 16, 33, 160, 25, 20, 217, 188, 24, 18, 136, 116, 3, 204, 40, 216, 140, 50, 128, 80, 3, 203, 138, 169, 10, 53, 144, 88, 4, 220, 10, 1, 152, 72, 37, 168, 24, 185, 171, 154, 65, 50, 53, 168, 40, 178, 191, 25, 1, 172, 113, 4, 9, 33, 1, 217, 157, 136, 136, 48, 68, 35, 146, 204, 153, 185, 11, 100, 35, 152, 153, 168, 205, 10, 66, 1, 67, 145, 10, 248, 141, 17, 144, 40, 52, 160, 157, 34, 217, 155, 34, 168, 56, 55, 1, 0, 168, 202, 204, 155, 66, 35, 33, 34, 35, 252, 139, 0, 136, 8, 0, 250, 190, 11, 69, 2, 65, 19, 184, 207, 137, 8, 8, 66, 36, 129, 137, 8, 153, 138, 40, 21, 153, 66, 129, 65, 52, 66, 129, 170, 155, 186, 156, 70, 35, 67, 145, 40, 161, 158, 50, 234, 155, 160, 138, 16, 100, 51, 16, 250, 172, 202, 170, 0, 33, 49, 2, 200, 189, 204, 154, 153, 153, 128, 136, 185, 156, 136, 235, 138, 216, 190, 137, 136, 152, 153, 0, 136, 160, 155, 161, 174, 201, 191, 154, 138, 115, 19, 17, 18, 219, 154, 170, 154, 83, 52, 51, 144, 48, 129, 48, 55, 1, 83, 160, 72, 3, 64, 39, 1, 50, 1, 34, 2, 83, 36, 129, 136, 16, 86, 51, 36, 52, 145, 155, 168, 157, 50, 115, 37, 0, 128, 136, 153, 56, 3, 48, 132, 157, 16, 138, 84, 34, 54, 176, 139, 144, 220, 11, 54, 129, 41, 52, 160, 172, 33, 145, 187, 32, 51, 145, 88, 55, 18, 185, 11, 147, 255, 32, 19, 0, 1, 25, 146, 206, 25, 51, 160, 140, 53, 184, 138, 66, 130, 171, 153, 153, 250, 159, 33, 128, 128, 56, 148, 174, 152, 152, 203, 140, 16, 152, 25, 52, 176, 156, 217, 206, 170, 40, 1, 41, 37, 160, 219, 156, 144, 171, 32, 51, 209, 173, 0, 185, 41, 20, 34, 145, 190, 189, 172, 152, 24, 55, 130, 0, 145, 204, 186, 156, 49, 160, 74, 53, 160, 155, 68, 162, 172, 25, 201, 140, 17, 50, 36, 83, 177, 27, 164, 223, 16, 129, 138, 83, 146, 9, 19, 137, 18, 186, 154, 64, 240, 175, 53, 152, 65, 130, 136, 188, 24, 186, 32, 0, 87, 160, 26, 2, 170, 9, 83, 209, 157, 35, 152, 16, 65, 36, 200, 187, 10, 184, 13, 70, 129, 40, 19, 251, 139, 128, 9, 32, 68, 1, 128, 136, 168, 157, 16, 0, 3, 172, 98, 145, 56, 131, 41, 39, 176, 190, 49, 208, 26, 5, 9, 2, 8, 1, 41, 132, 190, 201, 206, 139, 32, 2, 115, 54, 128, 201, 186, 186, 157, 64, 51, 51, 35, 144, 205, 171, 138, 48, 51, 67, 34, 0, 186, 176, 5, 39, 0, 56, 4, 49, 20, 235, 155, 33, 129, 116, 22, 128, 152, 152, 153, 8, 1, 32, 208, 173, 49, 19, 24, 87, 176, 188, 186, 187, 138, 68, 18, 34, 160, 204, 204, 170, 137, 136, 137, 8, 168, 170, 42, 20, 219, 206, 172, 170, 137, 9, 82, 146, 138, 161, 187, 185, 158, 169, 189, 171, 154, 114, 51, 34, 152, 170, 237, 155, 128, 64, 130, 10, 67, 144, 88, 36, 0, 2, 201, 187, 153, 104, 54, 50, 52, 128, 17, 137, 82, 161, 10, 68, 144, 73, 71, 19, 18, 129, 169, 204, 138, 51, 52, 69, 19, 168, 153, 24, 146, 12, 87, 168, 137, 129, 8, 17, 116, 18, 153, 169, 187, 153, 137, 101, 35, 128, 32, 184, 158, 8, 17, 145, 139, 17, 186, 97, 68, 19, 185, 9, 249, 189, 56, 3, 24, 55, 146, 157, 24, 185, 138, 17, 3, 138, 70, 176, 10, 1, 32, 249, 157, 1, 152, 9, 114, 131, 155, 49, 217, 172, 137, 137, 81, 3, 25, 37, 202, 154, 153, 153, 139, 53, 136, 97, 161, 156, 24, 128, 186, 80, 162, 159, 152, 154, 16, 20, 33, 21, 235, 170, 137, 185, 141, 83, 145, 140, 51, 233, 10, 129, 152, 153, 8, 203, 41, 146, 120, 21, 203, 138, 152, 185, 120, 4, 137, 2, 186, 203, 41, 36, 16, 50, 177, 29, 177, 159, 16, 49, 130, 48, 147, 58, 249, 47, 22, 168, 136, 40, 4, 174, 65, 1, 136, 155, 98, 176, 154, 65, 3, 186, 25, 35, 185, 65, 161, 56, 208, 139, 203, 88, 179, 76, 23, 154, 18, 219, 32, 144, 145, 188, 65, 160, 139, 84, 128, 48, 208, 139, 162, 189, 152, 97, 4, 138, 49, 131, 190, 137, 170, 40, 160, 96, 37, 144, 137, 34, 200, 173, 9, 128, 24, 55, 168, 57, 177, 59, 248, 143, 129, 8, 19, 40, 37, 152, 0, 169, 187, 96, 132, 41, 55, 169, 40, 130, 32, 130, 72, 39, 168, 9, 16, 19, 186, 114, 23, 128, 8, 144, 156, 33, 144, 65, 144, 97, 193, 13, 3, 187, 17, 187, 66, 249, 26, 3, 186, 152, 155, 129, 255, 40, 145, 139, 0, 170, 185, 174, 16, 201, 32, 184, 155, 218, 156, 136, 186, 49, 130, 235, 172, 186, 156, 33, 35, 145, 171, 184, 223, 26, 20, 170, 83, 200, 25, 128, 10, 69, 130, 17, 184, 139, 154, 33, 81, 55, 51, 145, 141, 35, 187, 115, 5, 0, 137, 48, 129, 16, 50, 69, 130, 8, 130, 41, 38, 32, 20, 24, 39, 137, 50, 145, 24, 35, 187, 115, 21, 34, 0, 18, 220, 56, 2, 72, 3, 49, 248, 26, 1, 8, 83, 34, 152, 50, 249, 140, 8, 66, 129, 83, 1, 169, 174, 16, 50, 20, 171, 24, 249, 141, 67, 1, 17, 9, 193, 207, 24, 18, 17, 35, 145, 172, 201, 157, 18, 40, 53, 1, 185, 172, 153, 40, 67, 19, 1, 146, 255, 13, 17, 0, 32, 2, 202, 140, 136, 37, 8, 40, 0, 154, 48, 19, 8, 252, 138, 160, 139, 34, 17, 185, 207, 155, 201, 43, 38, 16, 161, 173, 200, 190, 8, 16, 67, 130, 16, 234, 172, 153, 154, 65, 18, 17, 146, 175, 137, 153, 81, 130, 24, 145, 172, 170, 40, 38, 17, 50, 176, 190, 170, 64, 52, 70, 1, 9, 217, 156, 33, 34, 51, 34, 130, 222, 154, 16, 66, 100, 2, 152, 169, 189, 138, 16, 84, 34, 49, 144, 186, 190, 153, 24, 68, 0, 65, 145, 137, 203, 26, 176, 74, 21, 40, 163, 159, 2, 169, 152, 42, 38, 144, 154, 9, 192, 174, 33, 17, 17, 17, 161, 189, 138, 185, 142, 67, 129, 128, 153, 1, 234, 187, 0, 239, 9, 144, 32, 161, 43, 23, 168, 0, 168, 25, 216, 27, 23, 137, 52, 168, 48, 129, 17, 18, 169, 99, 184, 113, 6, 56, 3, 153, 145, 172, 115, 176, 80, 4, 136, 34, 192, 171, 129, 138, 83, 1, 51, 249, 24, 208, 155, 18, 137, 16, 185, 140, 144, 220, 26, 131, 174, 16, 249, 138, 187, 41, 178, 75, 6, 172, 137, 219, 9, 200, 41, 146, 28, 132, 172, 17, 202, 41, 176, 140, 145, 10, 68, 152, 40, 161, 156, 130, 187, 85, 176, 88, 148, 154, 51, 128, 50, 235, 113, 145, 42, 36, 138, 83, 200, 64, 178, 11, 21, 24, 19, 137, 54, 184, 48, 146, 41, 161, 59, 103, 136, 81, 2, 137, 169, 8, 184, 90, 38, 128, 18, 185, 41, 129, 48, 128, 101, 192, 172, 8, 169, 88, 38, 35, 145, 188, 189, 9, 185, 112, 35, 33, 130, 203, 153, 188, 48, 192, 113, 134, 153, 16, 136, 8, 152, 81, 163, 159, 17, 129, 0, 8, 51, 225, 156, 16, 33, 18, 137, 51, 232, 173, 8, 0, 33, 100, 19, 203, 138, 201, 156, 33, 68, 1, 1, 200, 188, 171, 24, 1, 48, 36, 128, 208, 207, 8, 144, 9, 16, 128, 154, 160, 204, 154, 64, 162, 158, 17, 217, 26, 1, 8, 176, 91, 4, 172, 153, 89, 163, 175, 50, 130, 136, 41, 39, 169, 9, 152, 217, 140, 84, 129, 18, 128, 66, 208, 156, 1, 152, 25, 99, 35, 16, 35, 184, 202, 173, 144, 187, 114, 4, 48, 37, 8, 1, 235, 170, 186, 153, 33, 70, 36, 136, 33, 232, 156, 136, 138, 34, 137, 49, 184, 57, 19, 98, 2, 202, 206, 188, 154, 48, 52, 85, 19, 184, 202, 187, 203, 139, 84, 18, 16, 18, 0, 176, 171, 185, 203, 204, 138, 115, 35, 82, 21, 184, 170, 186, 174, 32, 2, 65, 37, 152, 8, 152, 171, 154, 235, 173, 33, 129, 80, 37, 129, 153, 169, 205, 138, 0, 40, 37, 17, 128, 8, 200, 139, 18, 186, 40, 3, 0, 113, 39, 8, 34, 184, 184, 172, 1, 25, 71, 34, 50, 2, 186, 153, 155, 136, 138, 84, 17, 52, 83, 36, 169, 137, 238, 138, 136, 41, 37, 1, 17, 200, 203, 171, 153, 173, 81, 145, 250, 4, 42, 0, 139, 17, 203, 138, 129, 235, 156, 169, 189, 10, 19, 137, 82, 192, 171, 235, 172, 154, 24, 1, 33, 144, 155, 184, 223, 9, 160, 173, 16, 144, 9, 98, 35, 184, 219, 187, 187, 24, 67, 87, 18, 136, 0, 234, 138, 34, 168, 114, 19, 17, 129, 48, 176, 88, 163, 27, 55, 201, 113, 2, 25, 67, 168, 137, 137, 34, 154, 85, 129, 64, 19, 136, 34, 168, 171, 186, 157, 99, 52, 21, 16, 2, 186, 204, 154, 17, 129, 120, 38, 152, 25, 145, 203, 139, 33, 160, 80, 132, 138, 36, 235, 9, 16, 144, 157, 33, 161, 139, 131, 173, 53, 200, 41, 3, 190, 138, 0, 17, 49, 86, 161, 155, 168, 175, 32, 152, 97, 4, 144, 153, 169, 173, 88, 131, 9, 35, 184, 154, 153, 187, 104, 36, 169, 24, 53, 193, 141, 17, 145, 169, 41, 3, 138, 217, 58, 7, 219, 48, 5, 187, 137, 33, 248, 171, 32, 145, 137, 49, 5, 221, 9, 144, 188, 41, 18, 187, 113, 2, 169, 155, 152, 204, 138, 24, 51, 19, 72, 71, 184, 157, 16, 129, 202, 48, 22, 168, 155, 99, 2, 136, 67, 129, 219, 172, 40, 20, 9, 86, 129, 153, 8, 160, 188, 66, 35, 51, 146, 185, 218, 190, 9, 35, 81, 35, 16, 21, 218, 172, 137, 152, 42, 53, 0, 66, 208, 140, 129, 203, 48, 52, 160, 157, 144, 189, 41, 20, 67, 36, 184, 172, 219, 171, 24, 68, 51, 51, 2, 185, 205, 172, 9, 145, 154, 100, 34, 144, 97, 20, 187, 155, 219, 154, 32, 66, 52, 20, 184, 25, 192, 174, 0, 184, 171, 41, 130, 57, 119, 1, 17, 201, 188, 170, 152, 25, 71, 2, 32, 160, 186, 169, 24, 128, 81, 146, 10, 35, 33, 70, 2, 0, 176, 189, 156, 48, 36, 82, 36, 16, 176, 157, 32, 144, 155, 67, 232, 10, 67, 17, 49, 37, 251, 172, 153, 154, 50, 51, 36, 145, 235, 173, 153, 153, 33, 2, 171, 128, 251, 138, 35, 184, 170, 235, 203, 186, 25, 36, 34, 168, 157, 137, 251, 139, 35, 185, 9, 185, 173, 64, 39, 136, 1, 235, 138, 153, 40, 67, 36, 145, 137, 169, 187, 81, 37, 18, 34, 169, 137, 82, 19, 33, 71, 129, 42, 21, 16, 36, 16, 20, 204, 25, 18, 99, 52, 51, 192, 156, 128, 172, 65, 67, 18, 1, 168, 186, 139, 53, 34, 145, 158, 16, 219, 42, 71, 128, 24, 144, 171, 187, 157, 99, 19, 169, 72, 3, 205, 24, 18, 153, 137, 0, 33, 144, 56, 39, 160, 156, 17, 251, 40, 22, 136, 16, 18, 168, 154, 153, 235, 155, 115, 35, 33, 21, 160, 187, 206, 170, 41, 52, 33, 50, 146, 203, 236, 154, 32, 160, 156, 50, 224, 11, 35, 0, 2, 204, 187, 221, 156, 16, 35, 17, 51, 160, 205, 219, 154, 25, 51, 144, 57, 4, 235, 10, 99, 129, 137, 145, 205, 154, 0, 50, 54, 36, 157, 0, 46, 0, 18, 160, 190, 171, 137, 128, 64, 86, 2, 8, 17, 185, 172, 137, 153, 40, 38, 0, 82, 19, 152, 24, 162, 206, 154, 153, 16, 33, 53, 51, 21, 169, 40, 208, 221, 155, 9, 32, 83, 67, 67, 1, 217, 173, 137, 187, 42, 54, 18, 50, 147, 203, 186, 221, 138, 0, 33, 69, 17, 8, 160, 204, 171, 32, 2, 64, 38, 168, 204, 9, 34, 1, 32, 51, 248, 189, 153, 25, 67, 50, 37, 145, 189, 138, 201, 10, 67, 130, 16, 35, 202, 40, 208, 173, 171, 137, 26, 54, 0, 66, 201, 172, 170, 8, 0, 99, 17, 17, 168, 172, 154, 18, 81, 54, 1, 130, 202, 25, 17, 33, 98, 53, 17, 136, 8, 1, 153, 64, 39, 17, 83, 2, 16, 168, 140, 16, 40, 84, 129, 154, 66, 184, 137, 32, 194, 175, 17, 251, 25, 176, 139, 36, 184, 189, 138, 233, 140, 128, 170, 137, 184, 189, 9, 201, 139, 217, 172, 220, 138, 2, 24, 36, 202, 187, 221, 155, 24, 18, 50, 37, 192, 188, 186, 186, 89, 37, 16, 17, 168, 170, 185, 10, 53, 50, 51, 1, 128, 187, 116, 23, 136, 82, 161, 140, 50, 129, 64, 52, 129, 154, 25, 18, 56, 119, 17, 32, 201, 27, 35, 186, 114, 7, 136, 8, 153, 137, 154, 115, 3, 8, 130, 203, 137, 187, 104, 36, 137, 34, 200, 171, 170, 98, 145, 72, 5, 187, 153, 138, 82, 17, 34, 129, 186, 190, 25, 52, 8, 115, 146, 155, 0, 153, 152, 16, 83, 67, 128, 153, 154, 8, 200, 113, 7, 170, 32, 193, 10, 19, 152, 2, 56, 164, 191, 16, 202, 25, 51, 66, 20, 252, 138, 160, 157, 50, 35, 1, 219, 155, 169, 170, 57, 70, 144, 170, 184, 189, 40, 20, 8, 52, 233, 171, 153, 169, 48, 55, 130, 153, 17, 249, 156, 16, 145, 56, 21, 9, 144, 24, 145, 191, 137, 24, 36, 153, 114, 3, 235, 153, 152, 9, 137, 115, 3, 169, 138, 17, 137, 130, 207, 136, 201, 40, 52, 50, 129, 138, 252, 173, 24, 19, 49, 35, 186, 172, 173, 25, 67, 68, 35, 160, 220, 157, 24, 0, 82, 20, 153, 0, 234, 26, 19, 136, 52, 145, 153, 152, 16, 50, 35, 1, 193, 239, 10, 51, 1, 99, 2, 153, 220, 139, 0, 48, 55, 17, 145, 203, 154, 189, 9, 65, 53, 18, 17, 234, 171, 170, 9, 50, 66, 36, 176, 157, 186, 156, 50, 17, 68, 160, 155, 250, 138, 128, 72, 37, 144, 169, 202, 155, 8, 86, 3, 10, 129, 206, 138, 16, 50, 18, 49, 224, 173, 136, 137, 66, 35, 1, 144, 222, 171, 8, 32, 50, 100, 130, 170, 219, 154, 136, 81, 35, 18, 144, 186, 188, 139, 50, 86, 20, 152, 1, 203, 10, 40, 67, 83, 35, 144, 218, 155, 130, 12, 70, 130, 16, 152, 169, 188, 57, 36, 33, 144, 32, 240, 159, 16, 16, 136, 9, 129, 204, 153, 10, 86, 0, 39, 0, 4, 172, 35, 221, 8, 170, 64, 144, 26, 3, 255, 9, 136, 24, 16, 33, 168, 219, 188, 8, 137, 97, 20, 144, 170, 218, 139, 51, 129, 99, 130, 186, 155, 0, 138, 87, 130, 8, 2, 152, 154, 115, 145, 139, 34, 68, 19, 97, 3, 169, 201, 139, 50, 49, 118, 36, 144, 154, 152, 187, 56, 54, 35, 16, 129, 203, 170, 40, 38, 128, 16, 200, 156, 153, 81, 37, 185, 10, 208, 189, 0, 1, 2, 128, 152, 188, 186, 139, 67, 177, 154, 251, 174, 152, 40, 53, 16, 18, 250, 171, 153, 170, 113, 19, 8, 2, 218, 154, 33, 184, 121, 146, 172, 34, 1, 32, 99, 146, 188, 185, 157, 49, 50, 70, 35, 145, 204, 137, 187, 11, 84, 35, 18, 136, 8, 218, 174, 24, 1, 9, 33, 19, 168, 72, 147, 190, 139, 33, 234, 11, 17, 9, 21, 136, 17, 186, 153, 204, 185, 174, 98, 2, 64, 3, 137, 145, 206, 137, 24, 1, 33, 37, 169, 88, 3, 138, 52, 131, 223, 24, 168, 10, 52, 36, 17, 50, 1, 202, 186, 219, 156, 52, 0, 86, 130, 8, 161, 219, 172, 25, 35, 40, 39, 168, 169, 203, 24, 152, 98, 2, 154, 153, 169, 221, 40, 19, 24, 17, 168, 173, 203, 155, 144, 57, 55, 161, 188, 65, 130, 188, 8, 249, 140, 0, 40, 52, 0, 17, 176, 207, 170, 25, 19, 56, 87, 145, 136, 201, 171, 16, 18, 32, 55, 144, 155, 153, 24, 55, 144, 32, 208, 156, 9, 17, 82, 21, 152, 17, 160, 174, 26, 131, 139, 100, 129, 137, 48, 132, 204, 10, 8, 8, 16, 84, 130, 138, 2, 189, 235, 11, 37, 128, 16, 4, 202, 138, 1, 128, 138, 17, 153, 169, 27, 119, 2, 33, 224, 172, 152, 9, 68, 19, 129, 144, 217, 172, 16, 136, 67, 136, 65, 168, 137, 152, 65, 18, 184, 189, 188, 171, 114, 53, 51, 130, 205, 153, 219, 26, 51, 35, 50, 162, 12, 147, 159, 16, 169, 186, 59, 4, 64, 54, 1, 203, 170, 234, 154, 33, 67, 50, 20, 208, 187, 235, 156, 49, 2, 33, 19, 144, 207, 139, 136, 25, 67, 51, 146, 207, 153, 153, 24, 17, 65, 36, 0, 161, 174, 136, 187, 154, 9, 103, 19, 16, 18, 186, 203, 172, 0, 171, 101, 19, 18, 152, 153, 250, 171, 17, 49, 69, 0, 136, 169, 187, 12, 17, 139, 101, 129, 153, 137, 168, 138, 16, 33, 34, 68, 208, 188, 169, 0, 0, 82, 131, 9, 19, 205, 48, 193, 43, 3, 152, 10, 119, 144, 24, 83, 130, 219, 138, 129, 154, 87, 130, 24, 145, 10, 184, 174, 24, 66, 160, 104, 19, 138, 168, 154, 160, 158, 33, 0, 17, 56, 39, 202, 153, 138, 0, 154, 99, 145, 186, 171, 169, 58, 38, 0, 17, 251, 170, 188, 25, 34, 184, 72, 3, 113, 131, 218, 204, 154, 8, 97, 19, 56, 131, 10, 249, 140, 128, 56, 53, 60, 255, 39, 0, 1, 129, 204, 153, 8, 50, 53, 20, 186, 138, 203, 25, 3, 114, 4, 203, 64, 145, 8, 0, 137, 251, 27, 53, 2, 33, 130, 204, 156, 154, 137, 115, 50, 34, 185, 172, 169, 206, 26, 51, 33, 55, 145, 153, 219, 171, 8, 8, 65, 69, 2, 187, 16, 236, 9, 33, 50, 144, 33, 250, 140, 136, 40, 20, 49, 2, 17, 250, 156, 153, 170, 56, 87, 34, 33, 160, 219, 219, 154, 0, 97, 36, 33, 129, 204, 154, 170, 24, 34, 69, 18, 128, 186, 171, 154, 154, 50, 130, 114, 67, 19, 176, 172, 201, 190, 25, 66, 35, 16, 34, 217, 139, 185, 41, 21, 136, 200, 173, 136, 56, 38, 18, 129, 203, 170, 156, 168, 43, 7, 153, 51, 24, 84, 0, 176, 239, 137, 169, 48, 21, 33, 35, 152, 235, 187, 187, 11, 53, 33, 36, 144, 32, 200, 155, 201, 186, 203, 72, 51, 67, 19, 144, 186, 221, 154, 0, 40, 132, 156, 3, 173, 66, 83, 130, 137, 208, 189, 186, 24, 66, 70, 18, 0, 160, 172, 152, 188, 138, 16, 84, 34, 52, 130, 185, 221, 170, 170, 40, 85, 18, 128, 153, 187, 157, 128, 32, 19, 32, 162, 158, 168, 10, 50, 53, 161, 188, 170, 137, 33, 17, 115, 35, 18, 168, 220, 171, 65, 51, 18, 49, 130, 189, 11, 51, 250, 13, 67, 68, 3, 8, 161, 255, 137, 17, 0, 99, 130, 25, 129, 219, 154, 169, 154, 64, 55, 1, 1, 168, 170, 188, 24, 217, 10, 50, 84, 36, 144, 170, 220, 170, 16, 0, 67, 36, 0, 153, 186, 189, 188, 9, 69, 18, 66, 177, 173, 137, 137, 16, 0, 1, 80, 69, 128, 152, 235, 171, 154, 48, 53, 18, 50, 177, 207, 139, 33, 34, 19, 168, 169, 219, 171, 116, 130, 40, 51, 200, 205, 137, 0, 49, 67, 52, 192, 188, 25, 0, 128, 186, 8, 202, 89, 53, 34, 17, 184, 255, 138, 1, 33, 52, 1, 185, 187, 138, 153, 32, 53, 37, 152, 152, 154, 48, 51, 2, 222, 204, 155, 40, 115, 67, 1, 185, 153, 186, 171, 49, 36, 128, 17, 220, 57, 38, 34, 145, 206, 187, 10, 83, 51, 18, 129, 218, 203, 138, 49, 19, 8, 34, 234, 139, 114, 20, 168, 203, 186, 9, 68, 34, 17, 17, 233, 173, 137, 136, 65, 36, 0, 128, 202, 188, 9, 82, 51, 1, 186, 190, 153, 64, 21, 152, 25, 33, 0, 9, 1, 221, 170, 155, 66, 51, 53, 144, 218, 190, 153, 40, 99, 36, 129, 8, 185, 187, 174, 56, 36, 66, 20, 184, 220, 154, 33, 34, 35, 162, 205, 138, 136, 57, 53, 2, 218, 189, 138, 32, 83, 36, 19, 136, 218, 155, 0, 144, 138, 32, 130, 24, 54, 51, 20, 234, 188, 188, 137, 25, 68, 18, 33, 184, 189, 41, 36, 16, 1, 220, 171, 136, 32, 54, 53, 18, 184, 188, 172, 154, 65, 19, 8, 16, 24, 18, 234, 187, 17, 0, 25, 0, 235, 138, 35, 152, 86, 145, 25, 2, 189, 137, 66, 129, 72, 20, 153, 16, 66, 132, 219, 187, 172, 64, 86, 35, 128, 169, 190, 188, 138, 98, 67, 19, 128, 218, 172, 153, 136, 34, 68, 17, 136, 168, 205, 155, 8, 8, 33, 53, 19, 2, 176, 221, 188, 153, 8, 82, 67, 51, 145, 219, 187, 153, 154, 56, 54, 18, 129, 136, 202, 9, 128, 137, 50, 67, 176, 190, 154, 202, 57, 21, 113, 18, 16, 176, 190, 172, 24, 129, 113, 35, 33, 3, 204, 219, 155, 152, 48, 55, 1, 17, 152, 203, 171, 9, 8, 65, 67, 35, 176, 155, 219, 187, 24, 98, 129, 32, 4, 137, 169, 64, 161, 172, 0, 17, 234, 41, 249, 26, 176, 155, 24, 55, 1, 35, 203, 202, 157, 154, 96, 67, 34, 0, 169, 189, 171, 173, 48, 51, 50, 52, 146, 137, 184, 205, 203, 170, 25, 54, 1, 65, 52, 130, 168, 205, 187, 173, 33, 49, 53, 51, 130, 154, 128, 237, 187, 56, 35, 144, 137, 99, 83, 35, 129, 235, 187, 9, 83, 35, 52, 1, 144, 186, 204, 172, 49, 37, 128, 170, 154, 235, 56, 53, 144, 41, 129, 173, 49, 216, 42, 37, 201, 171, 9, 2, 114, 39, 1, 169, 9, 145, 204, 154, 25, 68, 52, 19, 168, 187, 138, 251, 156, 0, 24, 84, 36, 128, 169, 204, 171, 9, 49, 53, 17, 17, 144, 154, 160, 188, 10, 66, 130, 8, 129, 137, 176, 255, 170, 186, 27, 36, 144, 219, 88, 37, 128, 218, 171, 170, 137, 115, 51, 144, 16, 129, 203, 173, 138, 8, 80, 54, 2, 202, 170, 169, 154, 24, 115, 20, 185, 154, 203, 48, 68, 1, 138, 2, 186, 97, 36, 33, 129, 185, 251, 139, 33, 51, 2, 136, 233, 171, 153, 137, 49, 71, 2, 185, 188, 140, 33, 51, 68, 130, 172, 153, 154, 85, 130, 169, 188, 186, 140, 100, 19, 2, 200, 204, 170, 16, 68, 3, 170, 169, 172, 48, 2, 100, 20, 2, 185, 156, 186, 64, 37, 50, 162, 191, 171, 24, 34, 83, 20, 144, 203, 187, 136, 33, 20, 18, 145, 136, 136, 25, 250, 173, 17, 168, 32, 18, 1, 16, 53, 249, 154, 152, 153, 218, 171, 144, 219, 156, 8, 64, 55, 2, 202, 172, 187, 104, 20, 16, 1, 154, 33, 130, 25, 146, 252, 154, 16, 66, 3, 169, 49, 36, 168, 189, 169, 205, 80, 53, 17, 168, 219, 138, 17, 17, 50, 224, 173, 128, 16, 129, 114, 162, 138, 129, 204, 203, 154, 0, 66, 35, 81, 3, 153, 168, 156, 17, 81, 20, 187, 24, 1, 177, 140, 160, 207, 33, 19, 201, 171, 170, 26, 69, 20, 128, 48, 51, 51, 208, 189, 203, 26, 70, 35, 17, 33, 216, 188, 172, 138, 25, 55, 2, 168, 185, 204, 154, 50, 36, 34, 160, 10, 160, 171, 33, 115, 20, 168, 185, 173, 80, 53, 144, 153, 128, 169, 154, 80, 162, 26, 34, 36, 0, 14, 0, 17, 250, 42, 145, 140, 129, 171, 185, 43, 71, 34, 37, 161, 204, 172, 138, 128, 113, 37, 34, 144, 137, 16, 33, 50, 71, 168, 153, 173, 9, 186, 97, 1, 169, 220, 9, 2, 50, 36, 16, 2, 238, 188, 153, 9, 82, 36, 34, 130, 219, 155, 186, 172, 40, 36, 66, 51, 34, 145, 153, 220, 189, 171, 25, 34, 98, 35, 0, 33, 232, 188, 186, 25, 51, 128, 152, 153, 9, 117, 2, 169, 169, 187, 155, 153, 112, 19, 80, 39, 128, 24, 129, 186, 9, 251, 172, 16, 18, 66, 51, 2, 186, 206, 188, 155, 81, 52, 36, 1, 137, 153, 169, 201, 138, 137, 80, 54, 17, 1, 201, 155, 170, 155, 0, 114, 52, 2, 17, 0, 192, 190, 40, 129, 8, 18, 98, 2, 153, 237, 170, 170, 9, 82, 52, 129, 186, 189, 189, 155, 32, 69, 51, 1, 0, 202, 155, 184, 156, 136, 17, 32, 85, 18, 1, 168, 188, 219, 189, 40, 52, 50, 51, 129, 219, 186, 25, 69, 2, 136, 185, 190, 26, 69, 35, 17, 50, 176, 156, 33, 200, 172, 153, 82, 36, 33, 130, 138, 50, 176, 223, 172, 24, 0, 83, 35, 144, 235, 188, 188, 10, 50, 1, 0, 168, 187, 187, 113, 67, 19, 184, 203, 203, 172, 25, 18, 17, 176, 137, 253, 158, 152, 137, 18, 152, 24, 34, 34, 115, 35, 32, 68, 18, 128, 137, 136, 115, 23, 152, 153, 136, 17, 17, 1, 48, 53, 0, 56, 37, 201, 172, 185, 187, 50, 68, 52, 160, 205, 138, 0, 66, 130, 186, 221, 41, 35, 136, 187, 28, 1, 172, 128, 238, 171, 48, 52, 35, 128, 201, 188, 10, 17, 67, 67, 52, 184, 154, 171, 88, 36, 1, 234, 203, 24, 35, 20, 145, 8, 17, 201, 155, 130, 236, 10, 67, 161, 191, 154, 65, 130, 187, 33, 250, 12, 19, 128, 8, 128, 8, 204, 137, 152, 114, 18, 136, 98, 20, 0, 152, 168, 219, 56, 130, 43, 37, 170, 115, 161, 139, 145, 173, 25, 34, 18, 67, 53, 145, 155, 49, 19, 219, 96, 35, 65, 3, 185, 11, 144, 112, 5, 170, 176, 191, 8, 49, 129, 16, 144, 238, 187, 137, 16, 20, 49, 21, 185, 156, 16, 168, 57, 36, 16, 145, 11, 5, 10, 18, 25, 38, 217, 154, 49, 145, 73, 132, 156, 0, 40, 2, 153, 187, 48, 177, 80, 163, 27, 6, 154, 49, 1, 172, 56, 193, 138, 132, 187, 66, 19, 2, 153, 172, 154, 188, 73, 18, 145, 140, 16, 0, 186, 25, 169, 81, 160, 139, 3, 25, 34, 2, 169, 0, 169, 16, 4, 1, 0, 18, 161, 10, 2, 154, 16, 19, 1, 0, 16, 0, 0, 16, 0, 9, 9, 9, 16, 144, 185, 16, 17, 1, 16, 144, 9, 0, 0, 1, 160, 9, 17, 145, 9, 144, 16, 17, 153, 17, 153, 0, 153, 0, 16, 0, 0, 0, 0, 1, 0, 153, 16, 1, 144, 9, 16, 144, 0, 0, 0, 0, 0, 0, 0, 17, 153, 0, 145, 0, 0, 0, 0, 16, 144, 16, 9, 1, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 16, 0, 0, 0, 0, 9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
-static const size_t audio_eighty_sample_data_length = sizeof(audio_eighty_sample_data) / sizeof(audio_eighty_sample_data[0]);
+static const size_t audio_eighty_sample_data_length = 24323;
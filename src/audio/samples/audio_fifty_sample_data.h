@@ -1,4 +1,4 @@
-// This file was generated by a script on 20-11-2024 08:37:37
+// This file was generated by a script on 17-10-2026 14:18:53
 
 #pragma once
 
@@ -6,6 +6,7 @@
 #include <stdint.h>
 #include <pico/platform/sections.h>
 
-static const int16_t __in_flash("audio_fifty_sample_data") audio_fifty_sample_data[] = { 230, 96, -89, -101, -93, -205, -272, -228, -253, -369, -368, -201, -26, 89, 192, 267, 284, 296, 333, 367, 394, 386, 232, -79, -333, -320, -104, 80, 85, -46, -104, 80, 373, 365, -112, -664, -775, -443, -123, -92, -166, -94, 57, 118, 94, 13, -165, -294, -95, 342, 603, 571, 462, 301, 8, -188, -104, -52, -311, -560, -451, -234, -240, -264, 13, 409, 482, 193, -40, 88, 375, 374, -24, -439, -435, -54, 205, 20, -310, -298, -58, -110, -449, -508, -142, 149, 136, 155, 351, 382, 84, -219, -217, 7, 179, 129, -101, -304, -297, -120, 41, 94, 99, 137, 224, 320, 361, 316, 216, 123, 67, 66, 114, 142, 63, -92, -176, -128, -126, -344, -609, -519, -15, 448, 479, 194, -66, -141, 13, 316, 449, 237, 7, 35, 10, -297, -432, -68, 257, 4, -502, -697, -576, -383, -105, 233, 336, 71, -228, -245, -157, -260, -379, -148, 320, 613, 672, 703, 690, 549, 403, 258, -99, -585, -769, -611, -562, -735, -673, -187, 236, 214, 86, 267, 468, 194, -316, -444, -221, -168, -311, -222, 119, 320, 289, 308, 461, 521, 377, 209, 191, 217, 64, -250, -410, -208, 117, 150, -136, -272, 39, 358, 61, -582, -606, 183, 813, 543, -137, -424, -289, -143, -94, 15, 219, 375, 338, 128, 8, 137, 227, -9, -273, -135, 189, 199, -82, -317, -359, -145, 304, 520, 102, -397, -166, 468, 536, 14, -303, -166, -3, -54, -222, -418, -502, -285, 129, 392, 377, 254, 166, 139, 141, 81, -65, -140, -79, -163, -566, -874, -565, 153, 512, 237, -104, -7, 269, 282, 138, 88, -13, -216, -119, 305, 398, -72, -396, -119, 276, 303, 135, 37, -11, -51, -108, -264, -383, -214, 38, -72, -379, -227, 453, 969, 815, 194, -401, -667, -562, -277, -102, -122, -101, 191, 617, 819, 703, 521, 433, 282, -73, -498, -739, -638, -238, 126, 53, -341, -424, 73, 646, 753, 501, 288, 239, 243, 185, 9, -202, -222, -17, 76, -209, -576, -469, 153, 719, 789, 594, 586, 703, 462, -209, -757, -829, -772, -852, -635, 157, 847, 717, 161, -2, 152, -7, -452, -534, -59, 454, 599, 497, 334, 17, -477, -865, -904, -685, -333, 206, 815, 1023, 647, 276, 507, 883, 493, -521, -1108, -937, -660, -522, -80, 630, 954, 730, 471, 417, 307, 8, -335, -661, -933, -882, -293, 461, 716, 439, 269, 468, 549, 165, -443, -960, -1151, -695, 225, 698, 365, 85, 386, 479, -210, -846, -567, 114, 305, 109, 179, 564, 790, 696, 496, 216, -226, -529, -354, -17, -49, -280, -229, 40, 221, 306, 226, -169, -467, -108, 438, 279, -346, -448, 73, 480, 425, 71, -450, -866, -708, -37, 448, 367, 65, -102, -257, -489, -481, -16, 459, 282, -498, -1052, -833, -285, -80, -64, 371, 1093, 1282, 747, 253, 260, 148, -679, -1554, -1366, -266, 498, 395, 102, 78, -113, -710, -1110, -844, -279, 65, 193, 341, 586, 929, 1273, 1196, 340, -808, -1144, -347, 462, 127, -906, -1140, -151, 835, 806, 307, 203, 245, -35, -191, 48, -157, -1170, -1734, -916, 272, 558, 264, 249, 324, -39, -452, -139, 768, 1280, 828, -31, -366, -69, 78, -464, -1279, -1549, -1023, -156, 505, 795, 818, 660, 371, 111, 55, 152, 135, -159, -575, -718, -355, 155, 103, -503, -674, 85, 751, 285, -697, -974, -597, -398, -429, -170, 296, 469, 343, 332, 513, 553, 240, -307, -850, -1103, -776, 37, 638, 496, 27, -40, 206, 185, -80, -52, 314, 492, 230, -149, -296, -237, -165, -139, -72, 105, 346, 455, 233, -123, -40, 596, 962, 332, -679, -795, 90, 696, 129, -931, -1226, -481, 475, 793, 335, -447, -934, -738, -88, 265, -65, -472, -126, 685, 792, -56, -672, -234, 434, 348, -1, 331, 978, 834, -126, -845, -730, -329, -414, -944, -1133, -456, 620, 1101, 589, -304, -735, -563, -288, -212, -113, 198, 493, 559, 584, 723, 669, 155, -422, -375, 334, 928, 710, -46, -435, -153, 29, -588, -1482, -1548, -643, 298, 572, 364, 94, -141, -241, 90, 723, 881, 236, -370, -110, 523, 594, 225, 106, 169, -79, -503, -583, -214, 287, 483, 62, -624, -655, 115, 557, -102, -1037, -1074, -284, 416, 511, 132, -330, -502, -279, 110, 441, 668, 688, 394, 121, 404, 1075, 1164, 102, -1354, -1861, -1008, 232, 659, 193, -181, 236, 1052, 1471, 1246, 623, -90, -538, -488, -281, -392, -532, -118, 466, 307, -443, -702, -163, 324, 163, -245, -339, -180, -93, -67, 87, 306, 378, 321, 307, 317, 230, 132, 208, 336, 183, -246, -507, -320, 13, 74, -137, -334, -308, -18, 335, 367, 24, -167, 104, 374, 230, 46, 199, 267, -181, -698, -656, -312, -345, -700, -666, -11, 658, 757, 416, 77, -120, -272, -270, 25, 302, 148, -122, 84, 408, 94, -361, 0, 534, 49, -744, -574, -115, -336, -242, 822, 1188, -72, -1029, -292, 613, 220, -558, -512, 64, 534, 838, 919, 639, 222, -81, -393, -748, -793, -349, 190, 435, 546, 716, 527, -366, -1182, -749, 718, 1759, 1593, 822, 182, -280, -615, -591, -231, -39, -319, -712, -713, -270, 383, 1046, 1337, 809, -278, -968, -861, -617, -744, -754, -81, 882, 1212, 530, -577, -1103, -635, 183, 525, 458, 556, 789, 666, 202, -167, -386, -691, -947, -796, -303, 163, 513, 870, 999, 458, -610, -1393, -1389, -922, -446, 35, 521, 663, 360, 142, 472, 1037, 1080, 314, -681, -1029, -516, 152, 292, 87, 96, 262, 75, -458, -699, -292, 308, 436, -20, -641, -960, -711, 28, 671, 568, -43, -182, 446, 982, 761, 201, -51, 45, 224, 236, -146, -750, -855, -138, 601, 397, -474, -859, -396, 78, -74, -429, -462, -324, -142, 326, 814, 633, 22, -12, 549, 692, 158, -250, -159, 1, 55, 277, 545, 348, -240, -514, -286, -261, -818, -1280, -1040, -564, -491, -545, -158, 509, 920, 889, 530, 14, -393, -521, -491, -447, -363, -241, 16, 694, 1540, 1600, 698, -61, -205, -585, -1242, -937, 264, 675, -93, -764, -948, -1129, -770, 565, 1489, 913, 148, 530, 1107, 663, -149, -299, -49, -42, -234, -306, -156, 165, 385, 122, -574, -1167, -1252, -847, -176, 371, 321, -291, -701, -280, 647, 1235, 1066, 483, 243, 638, 846, -21, -1231, -1328, -622, -526, -718, 137, 1325, 1112, 132, 255, 1000, 540, -728, -933, -124, 57, -498, -357, 519, 475, -739, -1198, -140, 517, -464, -1412, -679, 668, 964, 523, 511, 985, 1315, 1265, 896, 287, -301, -579, -631, -806, -1225, -1608, -1594, -1151, -553, -31, 373, 615, 592, 392, 336, 598, 884, 738, 276, 288, 1084, 1692, 1110, -1, -220, 295, 33, -1270, -2038, -1341, -342, -382, -962, -815, -72, 113, -383, -565, -68, 485, 766, 962, 1030, 911, 1028, 1442, 1323, 212, -975, -1117, -335, 403, 599, 575, 728, 835, 271, -1107, -2437, -2482, -1012, 616, 858, 35, -99, 906, 1478, 675, -409, -670, -353, 186, 916, 1252, 830, 538, 872, 811, -10, -371, -110, -641, -1856, -1938, -869, -559, -1269, -1354, -536, -276, -873, -925, 97, 935, 728, 460, 1273, 2562, 2901, 2056, 941, 262, 169, 486, 551, -281, -1554, -2089, -1687, -1277, -1270, -997, -89, 686, 536, -82, -23, 896, 1505, 856, -350, -648, 167, 882, 730, 264, 140, 240, 277, 227, 64, -47, 279, 744, 490, -268, -431, -158, -554, -1274, -1195, -858, -1210, -1219, 187, 1635, 1604, 932, 698, 322, -409, -437, 237, 202, -644, -748, 347, 1248, 1043, 501, 538, 806, 418, -545, -1011, -490, 51, -480, -1609, -1792, -487, 1161, 1799, 1284, 302, -723, -1551, -1547, -436, 610, 285, -586, -53, 1707, 2402, 1170, -230, -252, 549, 1019, 975, 604, -218, -1208, -1426, -631, -39, -730, -1919, -1968, -819, -54, -499, -1128, -784, 200, 850, 1072, 1367, 1641, 1440, 1001, 955, 1138, 779, -169, -869, -877, -746, -1081, -1572, -1472, -795, -384, -561, -442, 628, 1718, 1571, 660, 438, 999, 1159, 576, 43, -226, -893, -1915, -2161, -1042, 506, 1212, 1022, 826, 974, 837, -13, -938, -1086, -584, -162, 41, 457, 999, 948, 46, -950, -1098, -269, 799, 1227, 702, -266, -735, -292, 305, -43, -1190, -1783, -1166, -123, 575, 972, 973, 228, -700, -706, 105, 599, 404, 50, -294, -746, -790, 157, 1550, 2127, 1380, 34, -812, -751, -335, -222, -296, -188, -222, -686, -848, -278, -69, -887, -1389, -684, -116, -498, -425, 739, 1521, 1298, 1026, 563, -879, -2051, -1315, 177, 481, 118, 364, 608, 57, -350, 183, 681, 177, -613, -650, -233, -174, -251, 287, 1198, 1497, 979, 307, -154, -373, -3, 939, 1327, 250, -1428, -2032, -1209, -128, 110, -427, -914, -794, -299, 42, 180, 507, 1175, 1867, 2237, 2176, 1639, 643, -451, -1055, -919, -440, -260, -611, -1048, -944, -339, 81, 137, 482, 1237, 1460, 728, -195, -791, -1100, -686, 432, 700, -471, -1171, -593, -611, -1307, -170, 2128, 1773, -840, -1366, 317, 271, -1459, -1180, 929, 1210, -634, -1509, -668, -233, -856, -965, -66, 343, -379, -664, 663, 2193, 1909, 89, -1345, -1434, -688, 154, 671, 575, -49, -590, -539, -170, -178, -710, -1211, -1179, -648, -51, 62, -398, -549, 484, 1929, 2101, 922, 11, 103, 397, 614, 1496, 2648, 2096, -697, -3195, -3035, -1415, -910, -1265, -387, 1522, 2323, 1777, 1584, 1940, 1229, -896, -2684, -2697, -1333, 192, 1120, 1276, 927, 673, 804, 731, -126, -1004, -606, 669, 926, -339, -1177, -159, 1161, 538, -1336, -1939, -1004, -474, -650, 129, 1824, 2372, 1312, 358, 317, 323, -189, -942, -1453, -1063, 278, 1150, 518, -423, -483, -601, -1389, -1342, 13, 476, -925, -1843, -634, 880, 780, 166, 763, 1799, 1517, 264, -195, 278, 170, -819, -1180, -301, 360, -295, -1273, -1273, -784, -1065, -1958, -2122, -1093, 161, 846, 1361, 2223, 2925, 2674, 1724, 969, 568, 27, -557, -575, -43, 483, 822, 896, 333, -677, -1263, -1294, -1345, -1085, 26, 847, 154, -768, -168, 1018, 1092, 616, 737, 942, 686, 518, 449, 83, 212, 1272, 1668, 551, -496, -816, -1631, -2297, -928, 875, 73, -1832, -1369, 460, 723, 266, 1052, 1834, 1258, 715, 867, 212, -1185, -1414, -498, -52, -31, 408, 547, -304, -1002, -682, -395, -916, -1175, -266, 788, 548, -670, -1189, -237, 922, 662, -609, -925, 237, 1186, 878, 490, 1022, 1464, 814, -140, -524, -959, -1998, -2624, -1640, 481, 1992, 1658, -8, -1208, -891, -76, -255, -1107, -1162, -82, 1282, 2373, 2979, 2677, 1472, 221, -500, -981, -1352, -1196, -564, -194, -306, -228, 367, 764, 303, -538, -859, -542, 17, 714, 1314, 1066, -173, -1218, -1112, -567, -718, -1261, -1064, -44, 865, 1277, 1598, 1738, 1008, -324, -857, -104, 583, -54, -1435, -2005, -1063, 635, 1598, 934, -513, -756, 933, 2686, 2190, -80, -1369, -572, 346, -295, -1389, -1385, -936, -1167, -1212, 213, 2101, 2332, 882, -243, -90, 166, -482, -1304, -1267, -591, 53, 648, 1189, 1035, -78, -1139, -1045, -176, 284, 178, 227, 456, 345, 177, 457, 592, 1, -511, -320, -295, -868, -932, -122, 321, -9, -130, 26, -418, -1072, -762, 112, 165, -630, -1126, -779, 81, 987, 1517, 1435, 909, 213, -403, -444, 178, 273, -1219, -3040, -2817, -562, 1188, 965, 59, 112, 849, 1100, 787, 662, 789, 518, -153, -397, 111, 616, 272, -830, -1735, -1460, -108, 952, 659, -322, -682, -314, 76, 308, 424, 73, -622, -695, 148, 795, 410, -242, -47, 765, 1004, 115, -1301, -2255, -2035, -587, 1058, 1361, 168, -752, -148, 862, 723, 77, 558, 1735, 1552, -207, -1317, -664, 215, 407, 1263, 2934, 2963, 737, -752, -76, 46, -2195, -4432, -4131, -2061, -119, 1079, 1481, 1019, 255, -72, -46, -61, 128, 954, 2086, 2642, 2212, 1325, 725, 373, -333, -1304, -1602, -1014, -702, -1458, -2232, -1576, 32, 757, 200, -71, 632, 765, -546, -1612, -1354, -1600, -3217, -3235, 375, 4370, 4739, 2401, 719, 403, 81, -724, -1467, -1530, -702, 90, -345, -1090, -255, 1234, 913, -527, -558, 302, 73, -314, 672, 1493, 798, 378, 1154, 981, -805, -1898, -1602, -1614, -1848, -574, 1634, 2457, 1445, -78, -1265, -1753, -1202, -204, 1, -454, 17, 1861, 3229, 2536, 811, -86, -333, -1049, -1720, -1409, -890, -756, 326, 2620, 3511, 1569, -826, -1419, -1102, -1050, -473, 947, 1595, 503, -988, -1339, -745, -221, -75, -125, -545, -1486, -2035, -776, 1877, 3175, 1577, -471, -16, 1548, 970, -1042, -1321, -116, -176, -1582, -2472, -2706, -2621, -1272, 846, 1299, 20, -404, 548, 1147, 1297, 1863, 1825, 362, -833, -553, -16, 237, 1317, 2727, 2411, 469, -1034, -1481, -1686, -1766, -1547, -1414, -1231, -509, 89, -165, -169, 1069, 2060, 1230, -242, -510, 193, 792, 1047, 900, 348, 187, 773, 895, -200, -1259, -1219, -848, -817, -572, -62, -42, -190, 505, 1322, 413, -1981, -3271, -1849, 893, 2360, 1719, 500, 226, 221, -800, -1715, -416, 2015, 2386, 722, 40, 774, 313, -1787, -3091, -2705, -2059, -1675, -844, 187, 669, 1023, 1771, 1933, 463, -1543, -1944, -506, 1017, 1665, 2139, 2669, 2402, 1375, 747, 672, 277, -327, -319, 62, 119, 81, 255, 164, -379, -925, -1503, -2212, -2028, -136, 2127, 2749, 1706, 457, -204, -490, -757, -1162, -1421, -803, 726, 1804, 1202, -507, -1813, -2142, -1990, -1792, -1520, -1027, -281, 570, 1150, 1191, 960, 1043, 1568, 1919, 1421, 341, -145, 537, 1222, 384, -1398, -1918, -524, 858, 517, -921, -1936, -2172, -1965, -1096, 479, 1501, 741, -860, -1334, -596, 11, 492, 1688, 2731, 2162, 690, -196, -872, -2043, -2649, -1849, -752, -200, 648, 2024, 2497, 1467, 333, 147, 118, -546, -1050, -383, 825, 1125, 373, -231, -201, -464, -1312, -1189, 592, 1630, -9, -1856, -897, 1088, 1192, 987, 2472, 2942, 292, -2017, -1336, -720, -2320, -3073, -1123, 713, 736, 870, 1963, 2362, 1535, 635, 88, -254, 70, 1003, 1236, 151, -965, -843, -191, -443, -1330, -1290, 23, 1394, 2056, 2145, 1434, -231, -1685, -1714, -877, -358, -307, -557, -1187, -1443, -227, 1747, 2429, 1289, -319, -1410, -2032, -2041, -1065, 371, 1147, 994, 675, 667, 562, 52, -356, -152, 273, 258, 63, 464, 1190, 929, -680, -2336, -3017, -3126, -2879, -1591, 489, 1950, 2548, 3131, 3256, 2031, 544, 122, -132, -935, -905, 99, -213, -2057, -2702, -1677, -1478, -2389, -2094, -284, 1281, 2170, 2715, 2285, 1082, 665, 1028, 625, -386, -730, -827, -1349, -1128, 180, 500, -835, -1508, -548, 28, -612, -631, 761, 1912, 1654, 737, 232, 510, 1427, 2231, 1919, 471, -981, -1547, -1441, -1339, -1498, -1639, -1397, -840, -507, -719, -992, -551, 671, 1967, 2617, 2390, 1597, 866, 523, 317, 226, 705, 1313, 520, -1687, -2856, -1505, 463, 817, 323, 847, 1975, 1882, 367, -1073, -1622, -1856, -2155, -1980, -1137, -375, -173, -190, -273, -655, -1113, -1292, -1330, -1084, -130, 736, 476, 400, 2204, 3839, 2108, -1407, -2397, -758, 28, -819, -1024, 20, 564, -369, -1978, -2786, -1709, 612, 1973, 1614, 1278, 1873, 2129, 1752, 1851, 1556, -879, -3705, -3758, -1911, -1085, -999, 3, 1033, 910, 508, 84, -1073, -1558, 172, 1777, 793, -349, 1097, 2678, 1433, -535, -353, 493, -401, -1971, -2072, -973, -84, 348, 705, 805, 396, -22, 268, 1124, 1713, 1821, 2112, 2772, 2834, 1550, -298, -1277, -1196, -1392, -2648, -3454, -1829, 1186, 2260, 602, -916, -569, -152, -1025, -1535, -340, 1082, 1158, 627, 693, 1041, 909, 416, -89, -712, -1371, -1405, -510, 509, 701, 255, 27, 80, -250, -993, -1433, -1443, -1655, -1957, -1221, 760, 2270, 1831, 551, 698, 2139, 2248, 103, -1645, -912, 361, -301, -1621, -1255, -133, -260, -861, -400, 260, -85, -561, -290, -143, -606, -532, 664, 1723, 1365, 21, -737, 27, 1424, 1723, 950, 1122, 2856, 3845, 2420, 307, -266, 65, -456, -1803, -2823, -2988, -2313, -1196, -542, -589, -319, 655, 1349, 1412, 1456, 1197, 246, -42, 1101, 1743, 868, 742, 2186, 2263, -43, -1416, -431, -266, -2477, -3932, -2470, -516, -575, -1328, -797, -145, -1179, -2374, -1050, 1918, 3447, 3061, 2562, 2446, 2290, 2555, 2910, 1694, -716, -1761, -1186, -1308, -2397, -2436, -1214, -373, -296, -314, -358, -280, 220, 214, -1001, -1671, -219, 1560, 1502, 691, 729, 579, -728, -1668, -1040, 0, 475, 1049, 1951, 2129, 1132, -189, -1095, -1690, -2248, -2693, -2789, -2407, -1617, -729, -144, 172, 789, 1769, 2050, 1048, 60, 336, 935, 669, 545, 1619, 2366, 1138, -583, -435, 909, 1058, -40, -360, 355, 104, -1638, -2705, -1770, -260, 459, 902, 1322, 866, -63, 308, 1902, 2325, 659, -943, -744, -99, -795, -1892, -1710, -883, -447, 610, 2480, 2515, -68, -1567, 139, 1677, 275, -1479, -801, 419, -422, -2014, -1646, 426, 1699, 991, -414, -800, -85, 513, 361, 182, 882, 2115, 2476, 1282, -368, -1182, -1643, -2773, -3687, -2759, -642, 515, 342, 193, 546, 740, 605, 449, 166, -178, 260, 1753, 2782, 1715, -677, -2094, -1916, -1481, -1291, -675, -51, -320, -465, 693, 1495, 26, -2027, -2054, -770, -110, 398, 1690, 2281, 469, -2437, -3460, -1490, 1598, 2838, 1031, -1869, -2513, 91, 3052, 2893, 97, -1588, -646, 344, -567, -1613, -870, 629, 1381, 1540, 983, -1140, -3585, -3428, -726, 792, -668, -1930, 259, 3919, 4649, 2135, 105, 321, 500, -1112, -2657, -1972, -225, 249, -315, -388, -350, -1069, -1174, 460, 1734, 793, -240, 915, 2380, 1582, -334, -1078, -1004, -1338, -1503, -750, -101, -342, -20, 1901, 3129, 1284, -1580, -2102, -1285, -1765, -2153, -229, 1709, 1073, 195, 1483, 2594, 1362, -226, -501, -599, -663, 583, 2156, 1891, 291, -746, -942, -548, 664, 1493, -130, -3359, -4670, -2760, -173, 732, 676, 1277, 2226, 2267, 1425, 477, -485, -1236, -659, 1201, 2119, 882, -324, 717, 2267, 1172, -1576, -1855, 766, 1912, -350, -2364, -1468, -69, -281, -604, -397, -1260, -2616, -2330, -1388, -1661, -1385, 1068, 2894, 1749, 0, -76, 300, 295, 926, 1604, 720, -634, -385, 528, 162, -515, 308, 1239, -226, -2693, -2307, 774, 2020, -227, -2168, -1200, 275, 75, -271, 405, 758, 462, 914, 1847, 1664, 651, 106, -294, -1268, -2083, -2045, -1592, -914, 181, 1099, 1309, 1441, 1829, 1847, 1651, 1864, 1603, 310, 24, 1634, 1963, -717, -2723, -1390, 253, -298, -787, 211, 528, -171, 664, 2811, 3023, 673, -1681, -2511, -2066, -642, 997, 1394, 443, -251, -194, -950, -2803, -3003, -165, 2115, 639, -1142, 1288, 4780, 3498, -794, -2456, -1916, -2854, -4224, -3376, -1931, -1862, -1412, 344, 921, -545, -1495, -850, -496, -1175, -1277, -71, 1081, 950, 13, -363, 381, 1299, 1335, 1100, 1657, 2050, 778, -937, -986, -366, -1034, -1621, -251, 1038, 4, -1123, 121, 1578, 692, -737, -289, 824, 765, 577, 1638, 2626, 1775, 76, -412, -74, -730, -1980, -1773, -42, 1545, 2595, 3429, 3119, 1318, -204, -506, -940, -1925, -2011, -1106, -554, -120, 1039, 1567, 74, -1650, -1339, -41, 12, -633, 189, 2460, 3892, 3188, 1240, -847, -2702, -3559, -2961, -2284, -2348, -1024, 2460, 4033, 1202, -1745, -1121, 14, -929, -906, 1312, 1809, -242, -743, 884, 1088, -20, 576, 2054, 1715, 564, 590, 492, -1023, -1975, -823, 468, -91, -1257, -1260, -1077, -2193, -3127, -1746, 577, 1178, 842, 1708, 2468, 902, -1071, -378, 1394, 552, -2257, -3017, -601, 1955, 2148, 921, 416, 923, 1204, 526, -831, -2192, -2702, -1893, -458, 550, 907, 541, -794, -1977, -1182, 739, 1015, -113, 396, 2780, 3957, 2904, 1708, 1336, 685, -566, -1587, -2119, -2106, -925, 1051, 1706, -66, -2157, -1927, -79, 615, -125, 63, 1749, 2580, 1405, 102, 26, -228, -1875, -3413, -3090, -1815, -1257, -685, 1420, 3804, 3851, 1826, 290, -3, -269, -657, -376, -7, -755, -2044, -2125, -644, 1023, 1667, 1288, 577, 347, 1194, 2517, 2452, 434, -1239, -819, -396, -2392, -4805, -4187, -1510, -405, -979, -149, 2503, 3726, 1964, -152, -183, 680, 625, 361, 784, 873, 285, 301, 483, -1119, -3444, -3269, -933, 196, -229, 501, 2620, 3360, 1807, 96, -305, -380, -1200, -2053, -1835, -931, -524, -695, -489, 370, 1055, 995, 623, 499, 607, 771, 971, 944, 408, -136, 61, 531, 88, -1024, -1248, -234, 614, 617, 824, 1685, 1578, -828, -3896, -4550, -2237, 367, 958, 339, 585, 1748, 2080, 1039, 90, 195, 343, -653, -2255, -2920, -1883, 38, 974, -86, -1583, -1121, 824, 1322, -431, -1880, -1172, 469, 1351, 1630, 1924, 1793, 929, 203, 182, -131, -1435, -2304, -1280, 439, 770, -75, -495, -161, 354, 959, 1280, 330, -1490, -1943, -102, 1798, 1581, 575, 1043, 1733, 183, -1882, -1004, 1511, 2042, 1631, 3162, 4375, 1763, -2035, -2653, -1791, -3371, -6037, -5821, -2607, 744, 2627, 3085, 2503, 1523, 704, -3, -578, -498, 324, 1248, 1788, 1840, 1281, 285, -612, -1349, -2140, -2351, -1344, -388, -1350, -3305, -3185, -547, 1132, -412, -2413, -1247, 1600, 1899, -348, -1414, -482, -20, -174, 1199, 3672, 4807, 4134, 2514, 371, -925, -178, 351, -1752, -3837, -2731, -993, -1640, -2034, 138, 1647, 397, -542, 195, 27, -894, 359, 2659, 2493, 893, 1089, 2234, 1672, -306, -2167, -3370, -2892, -106, 2609, 2530, 718, -366, -1009, -2290, -2888, -1394, 596, 937, 628, 2084, 4789, 5601, 3284, 75, -1728, -2244, -2443, -2486, -2407, -2386, -1707, 492, 2868, 2533, -676, -2968, -1801, 252, 57, -872, -247, -194, -2723, -4442, -2187, 876, 894, -420, -427, -408, -1357, -1001, 1380, 2646, 1051, -735, -28, 1941, 2444, 1214, -20, -510, -863, -1352, -1895, -2583, -2501, -225, 2916, 3584, 1859, 1338, 2923, 3968, 3659, 3328, 2430, 87, -1588, -1019, -491, -1524, -1663, 509, 2472, 2309, 1066, -301, -1604, -1945, -1380, -1562, -2149, -842, 1574, 1931, 820, 1502, 3228, 2490, -299, -1668, -813, 515, 1448, 1657, 461, -1384, -2053, -1714, -2140, -3207, -3038, -1421, -55, 509, 1360, 2453, 2012, -414, -2558, -2621, -1979, -2621, -3318, -1237, 2940, 4989, 3295, 1284, 1421, 1322, -703, -1474, 885, 2455, 453, -1568, -592, 409, -1510, -4295, -5240, -4500, -2707, -194, 1664, 2371, 3539, 5307, 5113, 2282, -399, -1147, -1037, -899, -250, 648, 888, 626, 416, -200, -1509, -2251, -1290, 191, 157, -992, -928, 693, 1568, 480, -1383, -3259, -5277, -6089, -4151, -1053, 477, 725, 1358, 1909, 1354, 398, -391, -1350, -1417, 800, 3574, 4001, 2505, 1391, 927, 319, -241, -1034, -2820, -4092, -2466, 757, 1856, 365, -726, 83, 1450, 2128, 2173, 1703, 789, 264, 903, 1867, 1580, 217, -474, -108, -154, -1084, -1607, -1133, -318, 676, 1751, 1682, 231, -261, 1502, 2810, 964, -1863, -1563, 1510, 3057, 1362, -625, -586, -354, -2118, -4373, -4361, -2136, 329, 2143, 3385, 3672, 2931, 2395, 2840, 2759, 447, -2757, -4007, -3098, -2018, -1193, 165, 1116, 339, -993, -1213, -910, -766, 205, 1801, 1728, -201, -915, 711, 1390, -1212, -4031, -3083, 64, 846, -817, -914, 1444, 2985, 2420, 1910, 2367, 2402, 1645, 959, 271, -752, -1474, -1771, -2611, -3937, -4284, -3216, -1923, -1102, -88, 1620, 3294, 3763, 2689, 936, -81, 425, 1770, 2186, 722, -1341, -1855, -601, 621, 692, 255, -25, -407, -1060, -1707, -2244, -2512, -1977, -567, 1111, 2727, 3951, 3667, 1535, -559, -989, -795, -1310, -1698, -1085, -312, 130, 814, 1145, -64, -1896, -2580, -2394, -2079, -559, 2408, 3977, 2057, -1014, -1777, -587, -207, -949, -577, 1378, 2664, 2187, 1543, 1624, 1102, -474, -1382, -698, 314, 408, -414, -1669, -2407, -1527, 441, 1392, 560, -625, -1078, -1302, -1823, -2360, -2622, -2394, -1102, 1339, 3571, 3866, 2180, 268, -372, 3, 227, -311, -1381, -2148, -1557, 203, 997, -472, -2237, -2046, -947, -788, -795, -60, 84, -703, -333, 1316, 1399, -714, -2274, -1992, -1215, -561, 313, 882, 1097, 2236, 3960, 3715, 987, -1321, -1268, -367, -475, -1007, -614, 398, 842, 545, 4, -819, -1748, -1561, 110, 1485, 1280, 832, 1536, 2568, 2984, 3233, 3200, 1941, 215, -55, 991, 1519, 1004, 214, -555, -1193, -1357, -1580, -2698, -3960, -4092, -3612, -3511, -3051, -1401, 374, 1243, 1937, 2955, 3290, 2548, 1930, 2067, 2013, 975, -609, -1750, -1658, -427, 648, 569, 63, 6, -333, -1524, -2474, -2644, -2895, -2661, -282, 2878, 3512, 2016, 1646, 2412, 1657, -149, -81, 1674, 2106, 461, -1111, -1359, -1148, -1283, -1500, -1530, -1315, -278, 1751, 3065, 1976, 22, 208, 1894, 1190, -2747, -5649, -4161, -612, 945, 718, 1481, 2927, 2533, 825, 503, 1299, 965, -113, -476, -1246, -3325, -4364, -2828, -1157, -1330, -1694, -799, 22, -101, 260, 1754, 2552, 1249, -851, -1808, -1583, -918, 476, 2418, 2942, 1220, -456, -353, -26, -808, -1318, -830, -912, -1996, -2494, -1964, -1144, 360, 2579, 3382, 1643, -507, -1195, -1222, -1300, -662, 557, 1093, 903, 764, 340, -753, -1364, -617, 258, -176, -1274, -1413, -356, 693, 749, -131, -1295, -2029, -1867, -1069, -548, -634, -435, 647, 1555, 1000, -387, -863, -75, 764, 1110, 1762, 2971, 3615, 3153, 2571, 2225, 831, -1890, -3839, -3487, -1938, -630, 548, 1650, 1747, 804, 270, 903, 1715, 1667, 1128, 1286, 2613, 4117, 4313, 3104, 1892, 1403, 828, -284, -1186, -1733, -2831, -4182, -3973, -1736, 610, 1435, 1148, 678, 81, -616, -780, -261, -33, -771, -1572, -1164, 73, 521, -452, -1848, -2610, -2629, -1923, -168, 2286, 3948, 3708, 2227, 932, 226, -344, -727, -381, 560, 1266, 1409, 1326, 860, -634, -2693, -3627, -2810, -1484, -396, 1395, 4210, 6259, 5986, 4161, 2335, 756, -878, -1957, -1789, -1080, -1060, -1547, -1363, -477, -61, -420, -591, -118, 385, 632, 1115, 1978, 2612, 2633, 2372, 2197, 2044, 1757, 1486, 1414, 1241, 383, -1177, -2537, -2786, -2038, -1107, -451, 24, 451, 906, 1447, 1769, 1411, 675, 361, 438, 168, -362, -398, -177, -721, -1851, -2111, -1038, 8, -107, -684, -506, 154, 113, -725, -1304, -1073, -476, -17, 148, 11, -245, -480, -1017, -2003, -2567, -1903, -801, -631, -1285, -1551, -1035, -392, -208, -577, -1289, -1881, -2009, -1885, -1918, -2205, -2733, -3377, -3492, -2564, -1310, -759, -471, 669, 2203, 2540, 1432, 167, -482, -841, -963, -301, 980, 1579, 615, -1052, -1823, -1356, -831, -1158, -1748, -1472, -229, 1045, 1636, 1744, 1978, 2663, 3679, 4595, 4788, 3811, 1872, -231, -1766, -2567, -2838, -2718, -2177, -1293, -355, 487, 1378, 2117, 1907, 627, -276, 512, 2234, 3239, 3228, 2787, 1901, 655, 53, 493, 818, 209, -462, -260, 264, 67, -965, -2211, -3108, -3374, -2936, -1894, -512, 724, 1267, 1068, 704, 650, 786, 897, 1107, 1484, 1804, 1996, 2210, 2262, 1667, 541, -240, -215, -65, -675, -1869, -2750, -2992, -3017, -2986, -2467, -1319, -131, 582, 1055, 1714, 2444, 2949, 3359, 3791, 3723, 2709, 1373, 705, 597, 98, -982, -1815, -1901, -1727, -1862, -2089, -1845, -1052, -124, 591, 983, 921, 359, -231, -46, 1105, 2426, 3081, 3148, 3190, 3283, 3026, 2268, 1249, 208, -691, -1237, -1381, -1425, -1662, -1984, -2118, -2059, -1939, -1589, -733, 386, 1074, 1062, 895, 1099, 1366, 1034, 175, -397, -190, 433, 879, 969, 782, 379, -87, -447, -889, -1819, -3196, -4412, -4935, -4756, -4240, -3661, -2882, -1651, -386, -39, -708, -1289, -1102, -765, -771, -661, -239, -2, 130, 809, 1677, 1592, 496, -604, -1378, -2316, -3427, -4121, -4199, -3971, -3602, -2992, -2184, -1500, -1229, -1188, -778, 225, 1184, 1414, 1183, 1184, 1337, 1004, 285, 106, 815, 1542, 1465, 948, 635, 195, -835, -1828, -2132, -2360, -2951, -2869, -1457, 209, 1343, 2520, 3666, 3767, 3212, 3354, 3809, 3347, 2580, 2709, 3072, 2680, 2200, 2274, 2259, 1951, 1966, 1944, 1032, -149, -520, -586, -1255, -1994, -1979, -1485, -831, 357, 1976, 3158, 3674, 4155, 4729, 4701, 3833, 2900, 2646, 2877, 2957, 2820, 2952, 3455, 3673, 2984, 1598, 216, -834, -1722, -2543, -3096, -3184, -2751, -1810, -533, 792, 2135, 3566, 4669, 4903, 4544, 4250, 3921, 3167, 2395, 2080, 1732, 890, 147, -13, -118, -554, -907, -1042, -1340, -1640, -1423, -976, -1014, -1444, -1640, -1426, -890, 118, 1547, 2781, 3283, 3184, 2888, 2466, 1745, 774, -30, -288, -124, -34, -218, -347, -136, 157, 66, -500, -1279, -2039, -2669, -3067, -3176, -3045, -2717, -2144, -1366, -617, -92, 280, 630, 778, 370, -577, -1578, -2173, -2302, -2183, -2091, -2258, -2747, -3411, -4057, -4517, -4626, -4393, -4095, -3877, -3454, -2618, -1735, -1285, -1198, -1060, -697, -218, 138, 88, -452, -1175, -1779, -2321, -2870, -3266, -3494, -3684, -3527, -2479, -831, 284, 213, -560, -1155, -1159, -787, -584, -806, -991, -512, 466, 1224, 1514, 1683, 1904, 2004, 1932, 1833, 1780, 1813, 1927, 1938, 1721, 1559, 1763, 2109, 2173, 1945, 1660, 1397, 1200, 1151, 1115, 936, 872, 1278, 2029, 2820, 3653, 4462, 4742, 4170, 3038, 1613, -399, -3277, -6586, -9556, -11815, -13348, -13910, -13019, -10602, -7229, -3558, 45, 3298, 5828, 7244, 7236, 5993, 4595, 3974, 3480, 1829, -528, -1887, -2073, -2622, -4131, -5516, -5964, -5824, -5638, -5582, -5493, -4720, -2651, 205, 2629, 4251, 5714, 7390, 8935, 9871, 9852, 8762, 7079, 5613, 4555, 3444, 2245, 1689, 2268, 3493, 4627, 5656, 7062, 8856, 10413, 11228, 11327, 10936, 10189, 9192, 8060, 6953, 6263, 6398, 7225, 8242, 9458, 11397, 13976, 16056, 16637, 15985, 15221, 14938, 14636, 13584, 11915, 10548, 9951, 9516, 8433, 6834, 5546, 4915, 4459, 3737, 3038, 2919, 3445, 4269, 5249, 6500, 7933, 9129, 9683, 9415, 8369, 6835, 5164, 3399, 1250, -1306, -3657, -5131, -5800, -6293, -6834, -6943, -6235, -5097, -4211, -3779, -3495, -3067, -2543, -2250, -2513, -3349, -4482, -5662, -6898, -8224, -9495, -10570, -11573, -12778, -14262, -15750, -16841, -17298, -17164, -16544, -15460, -13933, -12159, -10436, -9014, -8165, -8204, -9103, -10313, -11263, -11866, -12398, -13045, -13702, -13964, -13415, -12250, -11285, -10989, -10895, -10443, -9910, -9864, -10188, -10238, -9676, -8671, -7428, -5885, -3848, -1400, 894, 2409, 3151, 3691, 4307, 4570, 4005, 2836, 1774, 1233, 1021, 798, 607, 815, 1469, 2056, 2144, 1971, 1965, 2046, 1905, 1610, 1445, 1519, 1991, 3162, 4903, 6529, 7616, 8439, 9269, 9750, 9338, 8031, 6344, 4737, 3328, 2063, 929, -39, -756, -1166, -1443, -1856, -2282, -2310, -2068, -2204, -2850, -3448, -3734, -3918, -3875, -3247, -2350, -1902, -2023, -2302, -2575, -2926, -3387, -4135, -5502, -7403, -9263, -10685, -11747, -12571, -13075, -13199, -13029, -12594, -11827, -10838, -9945, -9258, -8539, -7718, -7138, -6979, -6917, -6669, -6434, -6427, -6483, -6429, -6423, -6598, -6811, -6984, -7345, -8083, -8972, -9617, -9893, -9972, -9944, -9720, -9222, -8414, -7227, -5723, -4273, -3239, -2558, -1893, -1154, -641, -630, -963, -1190, -1082, -899, -1012, -1375, -1631, -1690, -1843, -2244, -2616, -2672, -2554, -2565, -2591, -2227, -1430, -636, -115, 334, 931, 1566, 2061, 2385, 2527, 2507, 2459, 2472, 2481, 2454, 2437, 2325, 1954, 1455, 1094, 804, 304, -409, -1078, -1548, -1806, -1843, -1738, -1689, -1748, -1698, -1357, -840, -388, -80, 163, 388, 575, 740, 845, 687, 124, -648, -1323, -1899, -2622, -3577, -4584, -5403, -5867, -5947, -5790, -5580, -5308, -4861, -4300, -3854, -3598, -3342, -2993, -2817, -3064, -3521, -3777, -3807, -3911, -4286, -4954, -5771, -6258, -6030, -5534, -5560, -5932, -5699, -4662, -3650, -3208, -3039, -2819, -2642, -2608, -2633, -2719, -2952, -3190, -3145, -2808, -2444, -2136, -1707, -1196, -961, -1090, -1196, -1056, -969, -1192, -1456, -1387, -1073, -810, -566, -175, 118, -84, -615, -937, -949, -918, -863, -724, -752, -991, -922, -331, 192, 188, -54, -261, -676, -1385, -1970, -2207, -2469, -3087, -3766, -4037, -3925, -3805, -3795, -3766, -3701, -3619, -3408, -3158, -3243, -3673, -3978, -4064, -4347, -4828, -4972, -4746, -4765, -5228, -5586, -5449, -5118, -5071, -5391, -5802, -6008, -5950, -5845, -5949, -6222, -6306, -5968, -5454, -5147, -4993, -4696, -4335, -4216, -4242, -4102, -3904, -3932, -4051, -3972, -3802, -3725, -3541, -3023, -2379, -1923, -1592, -1174, -751, -626, -904, -1421, -1995, -2498, -2781, -2830, -2871, -2946, -2659, -1800, -780, 21, 765, 1557, 2122, 2476, 3057, 3822, 4122, 3801, 3497, 3551, 3453, 2786, 1965, 1520, 1191, 424, -562, -1017, -799, -493, -471, -548, -423, 85, 970, 1809, 2053, 1758, 1463, 1280, 788, -218, -1624, -3407, -5496, -7384, -8439, -8506, -7838, -6642, -4841, -2068, 2080, 7460, 12943, 17024, 19128, 20066, 20798, 21053, 19791, 16775, 12946, 9445, 6985, 5644, 4805, 3871, 3413, 4594, 7202, 9654, 11298, 13215, 16197, 19380, 21653, 23339, 25466, 28021, 30024, 30936, 31205, 31287, 31166, 30724, 29845, 28331, 26404, 24874, 24105, 23611, 23104, 23024, 23576, 24380, 25212, 26184, 27062, 27496, 27640, 27765, 27647, 27102, 26612, 26689, 27131, 27387, 27394, 27551, 27989, 28332, 28183, 27488, 26371, 24804, 22754, 20363, 17815, 15164, 12459, 9874, 7648, 5944, 4818, 4198, 3972, 4047, 4277, 4575, 5126, 6180, 7379, 7934, 7731, 7564, 7830, 7781, 6607, 4485, 2046, -573, -3601, -7017, -10485, -13664, -16356, -18447, -19834, -20388, -20058, -18997, -17535, -15991, -14501, -13037, -11600, -10359, -9584, -9454, -9887, -10574, -11203, -11766, -12527, -13576, -14636, -15445, -16103, -16844, -17657, -18383, -18957, -19370, -19496, -19195, -18438, -17354, -16152, -14970, -13707, -12179, -10450, -8869, -7685, -6813, -6062, -5348, -4701, -4151, -3715, -3365, -3063, -2833, -2738, -2764, -2864, -3128, -3740, -4670, -5560, -6032, -6050, -5870, -5648, -5203, -4246, -2755, -1018, 666, 2193, 3535, 4626, 5452, 6071, 6439, 6326, 5601, 4465, 3259, 2071, 689, -1017, -2848, -4475, -5742, -6667, -7284, -7567, -7492, -7094, -6522, -5913, -5199, -4240, -3268, -2802, -2948, -3266, -3508, -3990, -4982, -6282, -7603, -8951, -10356, -11673, -12730, -13508, -14135, -14798, -15477, -15827, -15609, -15110, -14841, -14902, -15017, -14989, -14826, -14549, -14219, -14004, -13983, -13975, -13743, -13284, -12757, -12226, -11711, -11389, -11436, -11653, -11698, -11630, -11798, -12250, -12719, -13092, -13347, -13281, -12794, -12167, -11601, -10858, -9709, -8341, -6987, -5614, -4223, -3077, -2349, -1792, -1123, -490, -297, -605, -1081, -1441, -1640, -1699, -1733, -1944, -2272, -2333, -2000, -1610, -1352, -918, -114, 749, 1391, 2043, 2990, 3981, 4511, 4530, 4443, 4462, 4393, 4069, 3568, 2967, 2295, 1767, 1629, 1771, 1839, 1657, 1316, 1005, 858, 811, 583, 27, -618, -1067, -1323, -1454, -1336, -933, -544, -426, -431, -266, 13, 83, -208, -749, -1465, -2360, -3233, -3791, -4095, -4488, -5071, -5668, -6186, -6580, -6668, -6472, -6399, -6653, -6860, -6650, -6149, -5615, -5015, -4301, -3699, -3457, -3529, -3688, -3839, -4141, -4835, -5980, -7282, -8218, -8456, -8191, -7942, -7908, -7664, -6673, -5048, -3507, -2503, -1776, -962, -253, 2, -4, 174, 480, 438, -100, -738, -1021, -938, -973, -1587, -2538, -3035, -2810, -2516, -2674, -2870, -2432, -1391, -280, 487, 811, 824, 829, 919, 621, -657, -2753, -4715, -5812, -6149, -6051, -5286, -3415, -476, 3215, 7511, 12056, 15936, 18386, 19568, 20076, 20005, 18958, 16782, 13873, 10976, 8855, 7957, 8124, 8701, 9205, 9811, 10973, 12691, 14530, 16299, 18223, 20360, 22396, 24105, 25755, 27635, 29467, 30647, 30982, 30845, 30611, 30260, 29568, 28384, 26872, 25608, 25114, 25226, 25401, 25612, 26186, 26990, 27537, 27805, 28104, 28331, 28081, 27376, 26619, 26039, 25623, 25411, 25490, 25778, 26159, 26635, 27244, 27717, 27560, 26537, 24885, 22977, 20828, 18271, 15488, 12958, 10793, 8666, 6571, 5027, 4299, 3972, 3649, 3392, 3308, 3264, 3278, 3592, 4236, 4831, 5085, 5026, 4679, 3845, 2364, 391, -1887, -4530, -7550, -10564, -13097, -15064, -16600, -17664, -18072, -17749, -16783, -15447, -14151, -13087, -12078, -10998, -10118, -9693, -9559, -9472, -9534, -9935, -10493, -10864, -11113, -11593, -12303, -12813, -12923, -12951, -13158, -13357, -13292, -13013, -12608, -11977, -11032, -9844, -8559, -7356, -6377, -5542, -4554, -3315, -2136, -1346, -852, -244, 702, 1790, 2629, 3041, 3156, 3139, 2951, 2462, 1667, 685, -372, -1382, -2123, -2371, -2045, -1210, -18, 1323, 2716, 4223, 5826, 7198, 7952, 8097, 7970, 7747, 7269, 6362, 5121, 3747, 2322, 860, -550, -1880, -3218, -4556, -5711, -6625, -7374, -7833, -7824, -7560, -7419, -7324, -6982, -6586, -6616, -7122, -7749, -8392, -9223, -10240, -11256, -12228, -13291, -14431, -15437, -16206, -16892, -17668, -18513, -19332, -20134, -20952, -21698, -22276, -22692, -22962, -22950, -22559, -21906, -21197, -20439, -19488, -18366, -17274, -16306, -15408, -14637, -14141, -13927, -13870, -13853, -13842, -13874, -14097, -14538, -14916, -14908, -14581, -14220, -13853, -13214, -12167, -10829, -9290, -7538, -5687, -4045, -2751, -1609, -455, 554, 1240, 1670, 1925, 1932, 1769, 1744, 1990, 2281, 2411, 2412, 2340, 2175, 1978, 1901, 2016, 2274, 2639, 3101, 3586, 3994, 4376, 4917, 5672, 6403, 6801, 6782, 6516, 6246, 6108, 5989, 5608, 4861, 4020, 3395, 2914, 2263, 1356, 417, -442, -1387, -2511, -3575, -4286, -4675, -4948, -5120, -5024, -4600, -3931, -3106, -2233, -1537, -1234, -1275, -1472, -1876, -2718, -3924, -5148, -6312, -7576, -8757, -9477, -9837, -10189, -10392, -10102, -9614, -9515, -9700, -9489, -8667, -7732, -7107, -6693, -6280, -5910, -5625, -5348, -5202, -5496, -6168, -6738, -6989, -7107, -7077, -6636, -5964, -5654, -5618, -4878, -3204, -2141, -2953, -4350, -4174, -2751, -2147, -2672, -2768, -1796, -422, 1019, 2508, 3690, 4747, 6372, 8004, 8219, 7373, 7424, 8693, 9169, 7611, 5334, 4390, 5179, 6321, 6339, 5274, 4595, 5430, 7283, 8808, 9286, 8986, 8757, 9449, 10890, 11595, 10598, 9101, 8682, 8593, 6772, 2979, -955, -3590, -4897, -5244, -4766, -3500, -1162, 2952, 9094, 16178, 22321, 26317, 28226, 28675, 27946, 25787, 21837, 16066, 9222, 2980, -840, -1812, -1295, -570, 864, 4028, 8151, 11517, 14130, 17307, 20762, 22630, 22493, 22273, 23669, 26296, 28598, 29568, 29264, 28363, 27490, 26496, 24435, 20868, 17052, 14740, 13855, 12981, 12205, 13074, 15686, 18376, 20307, 21799, 22566, 22281, 21876, 21871, 20949, 18393, 16125, 16173, 17904, 19533, 20698, 22024, 23361, 23830, 23033, 21305, 18941, 15891, 12242, 8440, 4838, 1512, -1261, -2913, -3209, -2661, -2036, -1662, -1152, 70, 1847, 3272, 4009, 4887, 6477, 7868, 7892, 6848, 5799, 4756, 2804, -400, -4153, -7717, -10986, -14090, -16786, -18544, -19104, -18678, -17527, -15672, -13342, -11241, -9788, -8536, -6972, -5459, -4684, -4587, -4607, -4569, -4654, -4831, -4929, -5063, -5488, -6174, -6943, -7807, -8908, -10127, -11126, -11801, -12286, -12510, -12148, -11119, -9765, -8414, -7060, -5590, -4037, -2547, -1278, -315, 411, 1102, 1914, 2843, 3743, 4394, 4599, 4347, 3738, 2746, 1261, -605, -2534, -4307, -5863, -7085, -7803, -7908, -7280, -5840, -3888, -2008, -454, 950, 2255, 3239, 3862, 4290, 4436, 3994, 3001, 1965, 1174, 302, -1110, -3009, -4981, -6837, -8661, -10408, -11851, -12829, -13329, -13425, -13296, -13003, -12301, -11119, -10035, -9695, -9911, -10017, -9907, -10096, -10833, -11752, -12426, -12861, -13373, -14126, -14901, -15387, -15698, -16323, -17447, -18650, -19425, -19812, -20184, -20601, -20768, -20566, -20190, -19615, -18524, -16952, -15490, -14495, -13618, -12439, -11081, -9882, -8966, -8332, -8023, -8013, -8154, -8363, -8630, -8931, -9310, -9965, -10956, -11775, -11691, -10709, -9608, -8769, -7692, -6042, -4233, -2615, -945, 850, 2357, 3334, 3908, 4083, 3834, 3475, 3223, 2862, 2261, 1726, 1428, 1125, 694, 358, 205, 59, -86, 15, 388, 698, 795, 1032, 1729, 2671, 3478, 4126, 4689, 4977, 4883, 4659, 4393, 3740, 2581, 1406, 645, 94, -625, -1467, -2094, -2405, -2628, -2996, -3500, -3989, -4407, -4802, -5132, -5208, -4906, -4339, -3721, -3082, -2255, -1244, -421, -144, -357, -800, -1453, -2413, -3498, -4380, -5084, -5934, -6964, -7706, -7732, -7178, -6550, -6159, -5921, -5632, -5204, -4648, -4021, -3408, -2860, -2378, -1964, -1596, -1214, -843, -623, -590, -663, -890, -1379, -1904, -2099, -2093, -2389, -3038, -3498, -3385, -2841, -2164, -1492, -909, -469, -23, 678, 1638, 2490, 2870, 2791, 2552, 2410, 2442, 2531, 2414, 2057, 1872, 2124, 2440, 2471, 2493, 2660, 2463, 1789, 1485, 1959, 2314, 1766, 875, 578, 975, 1583, 2014, 2068, 1790, 1586, 1826, 2333, 2551, 2170, 1422, 845, 803, 1166, 1326, 720, -442, -1247, -1298, -1515, -2891, -4879, -6160, -6602, -7136, -8035, -8633, -8407, -7222, -4896, -1503, 2340, 6075, 9658, 13151, 16301, 18663, 19712, 19034, 16875, 14257, 11978, 9699, 6706, 3508, 1743, 2107, 3540, 4989, 6982, 10301, 14204, 17271, 19370, 21531, 24195, 26639, 28106, 28757, 29283, 29953, 30453, 30481, 30167, 29776, 29263, 28366, 27086, 25822, 24849, 23888, 22693, 21909, 22343, 23502, 24138, 24262, 25025, 26526, 27477, 27266, 26744, 26684, 26796, 26526, 25811, 24858, 23845, 23084, 22776, 22512, 21499, 19563, 17420, 15603, 13716, 11229, 8325, 5564, 3240, 1456, 147, -1036, -2138, -2549, -1938, -923, -163, 470, 1127, 1514, 1562, 1517, 1112, -176, -2071, -3835, -5479, -7624, -10308, -12879, -14981, -16836, -18582, -19939, -20693, -20971, -20874, -20259, -19132, -17763, -16167, -14119, -11842, -10013, -8877, -8023, -7226, -6800, -7046, -7835, -8889, -10001, -10994, -11753, -12375, -12973, -13358, -13185, -12495, -11754, -11165, -10448, -9414, -8262, -7071, -5603, -3844, -2157, -694, 804, 2448, 3922, 4917, 5493, 5841, 5976, 5899, 5733, 5481, 4920, 4070, 3399, 3159, 2953, 2380, 1646, 1108, 715, 329, 152, 443, 1109, 1869, 2599, 3386, 4381, 5603, 6797, 7504, 7418, 6708, 5821, 4934, 3765, 2019, -200, -2563, -4800, -6718, -8241, -9571, -10931, -12114, -12686, -12617, -12309, -12044, -11798, -11469, -11027, -10585, -10433, -10820, -11589, -12329, -12930, -13694, -14874, -16385, -17935, -19264, -20277, -21087, -21880, -22670, -23282, -23565, -23526, -23261, -22891, -22489, -22030, -21478, -20857, -20269, -19720, -19143, -18519, -17899, -17279, -16567, -15735, -14891, -14160, -13569, -13043, -12508, -11954, -11436, -11105, -11083, -11249, -11275, -10958, -10471, -10090, -9834, -9415, -8486, -6976, -5272, -3841, -2547, -878, 1083, 2643, 3598, 4470, 5419, 5947, 5894, 5732, 5666, 5369, 4756, 4227, 3988, 3739, 3227, 2676, 2490, 2743, 3145, 3417, 3549, 3750, 4266, 5181, 6246, 7006, 7216, 7072, 6936, 6958, 6927, 6448, 5388, 4173, 3348, 2792, 1871, 446, -878, -1640, -2102, -2719, -3552, -4334, -4833, -5004, -5050, -5270, -5679, -5957, -5887, -5726, -5887, -6328, -6552, -6258, -5753, -5551, -5745, -6007, -6106, -6197, -6556, -7238, -8051, -8783, -9355, -9835, -10332, -10833, -11099, -10861, -10165, -9347, -8659, -8013, -7180, -6105, -5010, -4184, -3644, -3096, -2308, -1479, -997, -938, -1074, -1266, -1520, -1722, -1681, -1508, -1575, -1872, -1793, -908, 354, 1238, 1629, 2027, 2735, 3573, 4248, 4612, 4651, 4562, 4710, 5203, 5674, 5744, 5593, 5714, 6156, 6487, 6537, 6605, 6789, 6712, 6144, 5394, 4867, 4601, 4390, 4057, 3601, 3286, 3510, 4315, 5122, 5323, 5075, 5071, 5452, 5515, 4768, 3689, 2974, 2578, 2053, 1429, 1138, 1234, 1304, 1171, 1137, 1381, 1623, 1590, 1314, 840, 236, -130, -118, -340, -1225, -2060, -2052, -1594, -1426, -1455, -1355, -1223, -991, -424, 9, -354, -974, -716, 134, 88, -1159, -2126, -1928, -1875, -3552, -6281, -7880, -7613, -6821, -6697, -6694, -5355, -1924, 3078, 8432, 13352, 17957, 22402, 25896, 27334, 26823, 25658, 24369, 21870, 17421, 12524, 9424, 8344, 7925, 7825, 8905, 11365, 14560, 18230, 22228, 25649, 27628, 28530, 29361, 30471, 31550, 32285, 32606, 32657, 32684, 32767, 32643, 31981, 30831, 29534, 28145, 26414, 24453, 22929, 22101, 21670, 21727, 22781, 24431, 25451, 25617, 25847, 26352, 26315, 25420, 24148, 22744, 21305, 20350, 20137, 19955, 19198, 18340, 18082, 18072, 17288, 15335, 12711, 9870, 6791, 3487, 200, -2996, -6044, -8468, -9970, -10936, -11462, -10871, -9281, -7947, -7072, -5420, -3020, -1683, -2086, -2997, -3729, -4836, -6448, -8335, -10957, -14422, -17482, -19223, -20542, -22510, -24663, -25914, -26057, -25492, -24420, -22867, -21041, -19198, -17301, -14970, -12054, -9244, -7698, -7736, -8348, -8393, -8057, -8522, -10206, -12074, -12966, -12999, -13023, -13222, -13197, -12987, -12980, -13014, -12471, -11253, -9901, -8876, -8099, -7078, -5425, -3382, -1699, -646, 322, 1582, 2703, 3278, 3565, 3857, 3954, 3694, 3303, 2894, 2183, 971, -555, -2172, -3821, -5318, -6266, -6603, -6791, -7017, -6691, -5341, -3496, -1972, -818, 327, 1382, 2048, 2329, 2286, 1718, 512, -1074, -2736, -4392, -6125, -8031, -10113, -12119, -13682, -14709, -15444, -16060, -16361, -16117, -15524, -14956, -14419, -13670, -12853, -12520, -12831, -13234, -13261, -13188, -13632, -14651, -15786, -16729, -17488, -18013, -18272, -18676, -19669, -20863, -21341, -20893, -20300, -20265, -20649, -20836, -20472, -19716, -18978, -18427, -17842, -16997, -16015, -15089, -13942, -12035, -9589, -7786, -7293, -7158, -6169, -4810, -4520, -5475, -6587, -7304, -7932, -8563, -8950, -9052, -8829, -8018, -6601, -4913, -3119, -1230, 548, 2133, 3801, 5504, 6576, 6697, 6518, 6699, 6938, 6599, 5815, 5288, 5188, 4955, 4230, 3332, 2630, 2033, 1393, 884, 681, 688, 812, 1153, 1793, 2644, 3541, 4343, 4929, 5248, 5286, 4992, 4369, 3563, 2725, 1873, 1022, 326, -94, -308, -462, -664, -994, -1468, -2043, -2774, -3773, -4869, -5658, -6051, -6310, -6430, -6082, -5196, -4035, -2744, -1419, -401, 83, 243, 238, -93, -732, -1389, -2098, -3095, -4066, -4365, -3982, -3540, -3377, -3293, -3122, -2988, -2987, -3040, -3068, -3058, -2919, -2465, -1633, -563, 581, 1765, 2944, 3977, 4719, 5043, 4813, 4042, 3019, 2065, 1249, 565, 150, 139, 537, 1328, 2473, 3691, 4516, 4740, 4613, 4493, 4448, 4326, 4068, 3770, 3586, 3743, 4464, 5578, 6522, 7039, 7483, 8061, 8315, 7798, 6742, 5635, 4646, 3797, 3231, 3001, 2985, 3141, 3552, 4174, 4773, 5160, 5260, 4943, 4125, 3153, 2602, 2447, 2058, 1363, 1152, 1798, 2699, 3387, 4078, 4786, 5098, 5008, 4838, 4452, 3561, 2441, 1441, 371, -873, -1830, -2192, -2255, -2252, -1940, -1200, -412, 75, 397, 832, 1328, 1684, 1881, 1926, 1643, 1075, 720, 877, 1177, 1221, 1128, 1081, 945, 774, 929, 1367, 1485, 1090, 852, 1386, 2339, 2871, 2745, 2523, 2698, 3149, 3509, 3707, 3981, 4515, 5232, 5840, 6181, 6506, 7245, 8313, 8926, 8480, 7486, 7032, 7228, 7012, 5739, 4055, 2760, 1875, 1267, 1120, 1338, 1585, 2133, 3663, 6290, 9680, 13628, 17740, 21236, 23750, 25598, 26939, 27597, 27542, 26500, 23743, 19417, 15129, 12118, 9996, 8201, 7208, 7475, 8629, 10454, 13272, 16898, 20366, 22955, 24683, 25861, 26764, 27583, 28276, 28673, 28758, 28542, 27888, 26750, 25476, 24293, 22865, 20775, 18296, 16173, 14583, 13069, 11670, 11225, 11984, 12934, 13292, 13632, 14714, 16103, 16897, 16900, 16433, 15702, 14856, 14026, 13160, 12214, 11401, 10852, 10320, 9566, 8693, 7806, 6679, 5009, 2818, 399, -1998, -4317, -6519, -8477, -9978, -10803, -10881, -10473, -9924, -9101, -7579, -5644, -4271, -3802, -3592, -3334, -3626, -4803, -6363, -7903, -9630, -11672, -13789, -15800, -17666, -19159, -20076, -20594, -20969, -21049, -20482, -19275, -17802, -16239, -14410, -12331, -10465, -9211, -8480, -8044, -7929, -8280, -9132, -10387, -11801, -13052, -14031, -14870, -15535, -15799, -15685, -15476, -15206, -14607, -13666, -12731, -11988, -11214, -10192, -9023, -7911, -6875, -5877, -5036, -4485, -4136, -3842, -3683, -3816, -4210, -4720, -5291, -5908, -6532, -7175, -7842, -8402, -8751, -8995, -9268, -9484, -9492, -9275, -8828, -8089, -7116, -6140, -5288, -4446, -3550, -2838, -2596, -2788, -3241, -4023, -5254, -6668, -7890, -8984, -10188, -11370, -12314, -13090, -13691, -13853, -13683, -13733, -14050, -13959, -13137, -12105, -11417, -10962, -10394, -9665, -8976, -8514, -8392, -8662, -9276, -10116, -11090, -12119, -13044, -13719, -14223, -14745, -15217, -15277, -14777, -14085, -13633, -13288, -12599, -11624, -10822, -10151, -9225, -8394, -8305, -8479, -7915, -6925, -6522, -6471, -5970, -5459, -5710, -6159, -5998, -5746, -6143, -6841, -7281, -7599, -7838, -7550, -6709, -5936, -5520, -5023, -4074, -2932, -1977, -1214, -596, -314, -325, -170, 226, 287, -142, -427, -340, -468, -983, -1257, -1106, -1182, -1784, -2337, -2366, -2120, -2001, -1996, -1862, -1476, -891, -255, 224, 468, 728, 1273, 1810, 1722, 1016, 378, 125, -159, -763, -1354, -1612, -1685, -1826, -2038, -2201, -2271, -2251, -2199, -2251, -2449, -2546, -2275, -1826, -1657, -1734, -1583, -1177, -1016, -1179, -1235, -1173, -1460, -2104, -2572, -2718, -2914, -3313, -3671, -3885, -4072, -4051, -3462, -2587, -2221, -2359, -2087, -1313, -1037, -1333, -1049, -154, 33, -577, -674, -47, 385, 576, 883, 744, 51, -20, 711, 724, -334, -838, -187, 227, -221, -339, 671, 2020, 2818, 3194, 3610, 4120, 4672, 5365, 6033, 6217, 5964, 5852, 5875, 5392, 4604, 4625, 5548, 6051, 5518, 4993, 5420, 6335, 6838, 6807, 6628, 6535, 6618, 6970, 7428, 7600, 7521, 7719, 8219, 8251, 7602, 7155, 7411, 7653, 7287, 6832, 6916, 7434, 8073, 8623, 8751, 8428, 8373, 9078, 9767, 9339, 8134, 7584, 8083, 8430, 7870, 7357, 7918, 8915, 9139, 8698, 8566, 8853, 8797, 8111, 7313, 6854, 6684, 6654, 6767, 6964, 7099, 7305, 7971, 9095, 10033, 10297, 10286, 10674, 11276, 11300, 10671, 10246, 10474, 10796, 10643, 10187, 9828, 9650, 9592, 9507, 9093, 8309, 7713, 7772, 8149, 8225, 8081, 8350, 9231, 10166, 10614, 10745, 11070, 11601, 11784, 11336, 10685, 10311, 10027, 9357, 8363, 7580, 7274, 7257, 7334, 7533, 7926, 8505, 9172, 9741, 10062, 10135, 9936, 9363, 8531, 7807, 7316, 6687, 5643, 4486, 3718, 3423, 3341, 3327, 3487, 3902, 4483, 5125, 5843, 6625, 7248, 7408, 7073, 6543, 6084, 5570, 4637, 3284, 2074, 1510, 1365, 1028, 443, 180, 513, 977, 1035, 789, 740, 1061, 1369, 1216, 664, 254, 371, 756, 780, 201, -533, -836, -690, -576, -807, -1206, -1442, -1341, -861, -91, 678, 1209, 1659, 2397, 3422, 4250, 4405, 3840, 2839, 1690, 546, -483, -1289, -1836, -2144, -2119, -1518, -215, 1484, 2989, 3977, 4736, 5694, 6707, 7134, 6738, 6092, 5794, 5658, 5138, 4294, 3774, 3831, 3931, 3572, 3053, 2986, 3351, 3538, 3285, 3046, 3254, 3669, 3798, 3627, 3535, 3657, 3763, 3642, 3293, 2779, 2199, 1660, 1151, 565, -52, -531, -825, -1036, -1168, -1112, -907, -788, -930, -1274, -1658, -2049, -2580, -3333, -4206, -4999, -5602, -6026, -6292, -6385, -6326, -6183, -5977, -5654, -5270, -5096, -5372, -5991, -6623, -7190, -7906, -8780, -9456, -9671, -9640, -9717, -9876, -9842, -9597, -9475, -9687, -10042, -10238, -10296, -10463, -10741, -10823, -10545, -10141, -9914, -9835, -9700, -9540, -9593, -9921, -10253, -10320, -10194, -10151, -10294, -10379, -10177, -9811, -9587, -9563, -9527, -9400, -9326, -9382, -9456, -9506, -9649, -9961, -10351, -10665, -10767, -10520, -9860, -8953, -8131, -7572, -7160, -6755, -6486, -6596, -7131, -7908, -8708, -9388, -9865, -10061, -9857, -9188, -8290, -7658, -7549, -7599, -7246, -6529, -6085, -6294, -6724, -6766, -6440, -6222, -6328, -6619, -6990, -7407, -7741, -7914, -8086, -8410, -8758, -8884, -8759, -8535, -8320, -8133, -8022, -8024, -8044, -7987, -7981, -8247, -8765, -9324, -9859, -10463, -11068, -11420, -11410, -11213, -11020, -10793, -10341, -9575, -8654, -7862, -7382, -7196, -7167, -7245, -7515, -8070, -8805, -9431, -9720, -9660, -9390, -9018, -8545, -7914, -7157, -6438, -5858, -5302, -4702, -4265, -4203, -4359, -4444, -4476, -4641, -4892, -5014, -4953, -4799, -4562, -4207, -3785, -3362, -2914, -2394, -1861, -1435, -1170, -971, -738, -522, -467, -573, -682, -741, -909, -1280, -1653, -1800, -1826, -2019, -2310, -2265, -1724, -1097, -751, -446, 209, 1052, 1580, 1662, 1605, 1600, 1503, 1122, 520, -7, -240, -284, -375, -469, -294, 149, 522, 660, 804, 1119, 1336, 1161, 782, 623, 697, 605, 194, -158, -54, 455, 1026, 1429, 1649, 1822, 2115, 2540, 2904, 3044, 3005, 2920, 2850, 2824, 2835, 2813, 2722, 2643, 2637, 2621, 2516, 2397, 2359, 2391, 2478, 2720, 3188, 3752, 4227, 4662, 5303, 6199, 7019, 7353, 7147, 6677, 6191, 5697, 5166, 4701, 4445, 4436, 4670, 5142, 5787, 6478, 7157, 7856, 8531, 9059, 9379, 9509, 9456, 9294, 9156, 9086, 8968, 8730, 8498, 8408, 8360, 8150, 7792, 7540, 7557, 7753, 7967, 8190, 8513, 9018, 9731, 10476, 10914, 10869, 10550, 10213, 9867, 9478, 9224, 9297, 9673, 10177, 10622, 10855, 10896, 10954, 11098, 11101, 10775, 10315, 10059, 10008, 9885, 9608, 9371, 9246, 9049, 8745, 8568, 8591, 8581, 8511, 8723, 9382, 10173, 10758, 11135, 11417, 11598, 11661, 11665, 11594, 11304, 10726, 10043, 9536, 9249, 8890, 8247, 7583, 7313, 7315, 7036, 6370, 5958, 6367, 7327, 8157, 8628, 9073, 9701, 10264, 10420, 10137, 9624, 9055, 8573, 8325, 8298, 8228, 7900, 7458, 7221, 7218, 7146, 6848, 6574, 6607, 6773, 6641, 6184, 5827, 5729, 5594, 5400, 5643, 6522, 7497, 8070, 8395, 8776, 9127, 9162, 8699, 7751, 6669, 5955, 5637, 5188, 4350, 3586, 3332, 3283, 2873, 2170, 1780, 1949, 2267, 2348, 2339, 2557, 3006, 3508, 3989, 4405, 4594, 4402, 3829, 3059, 2365, 1885, 1447, 881, 393, 249, 192, -318, -1312, -2210, -2587, -2629, -2746, -3027, -3233, -3113, -2584, -1750, -868, -212, 169, 486, 869, 1109, 901, 219, -681, -1589, -2432, -3133, -3589, -3872, -4218, -4698, -5088, -5165, -4994, -4786, -4638, -4518, -4389, -4224, -4001, -3773, -3639, -3581, -3394, -2946, -2438, -2209, -2338, -2642, -3042, -3676, -4568, -5440, -5947, -6025, -5903, -5823, -5829, -5794, -5619, -5444, -5610, -6314, -7267, -7846, -7754, -7417, -7481, -7929, -8037, -7353, -6360, -5845, -5886, -5928, -5635, -5251, -5180, -5547, -6158, -6714, -7134, -7661, -8499, -9442, -10066, -10230, -10090, -9719, -9016, -8023, -7094, -6607, -6590, -6741, -6804, -6810, -6893, -6996, -6884, -6454, -5917, -5590, -5553, -5633, -5727, -5977, -6504, -7105, -7365, -7055, -6310, -5434, -4692, -4204, -3969, -3949, -4130, -4504, -5029, -5617, -6080, -6149, -5709, -5014, -4514, -4350, -4185, -3678, -2959, -2400, -2031, -1546, -876, -343, -166, -223, -443, -983, -1840, -2656, -3102, -3206, -3133, -2851, -2209, -1238, -230, 469, 709, 587, 357, 297, 545, 937, 1101, 849, 457, 382, 672, 860, 522, -221, -854, -1027, -918, -995, -1418, -1751, -1457, -626, 59, 124, -180, -283, 20, 351, 193, -507, -1251, -1610, -1778, -2193, -2781, -3030, -2747, -2298, -2044, -1918, -1699, -1370, -1052, -815, -736, -945, -1362, -1662, -1789, -2130, -2864, -3495, -3514, -3166, -3052, -3307, -3567, -3531, -3255, -3039, -3089, -3230, -3178, -3049, -3128, -3247, -3155, -3279, -4135, -5208, -5532, -5186, -5068, -5394, -5494, -4976, -4198, -3601, -3248, -3041, -2955, -3007, -3182, -3443, -3768, -4141, -4507, -4794, -4974, -5017, -4803, -4290, -3769, -3673, -3971, -4173, -4100, -4216, -4861, -5583, -5726, -5334, -4986, -4865, -4478, -3446, -2164, -1407, -1417, -1708, -1804, -1876, -2385, -3317, -4086, -4257, -4060, -4002, -4133, -3956, -3164, -2247, -2036, -2619, -3106, -2801, -2232, -2469, -3594, -4479, -4277, -3511, -3311, -3878, -4223, -3513, -2222, -1476, -1511, -1507, -1030, -721, -1146, -1821, -2054, -1996, -2222, -2766, -3067, -2670, -1835, -1545, -2491, -3950, -4437, -3697, -3000, -3142, -3284, -2334, -507, 1101, 1859, 1946, 1751, 1364, 664, -298, -1174, -1631, -1638, -1339, -823, -234, 142, 179, 132, 321, 673, 828, 635, 355, 348, 652, 930, 967, 1076, 1699, 2655, 3261, 3183, 2660, 1939, 1103, 392, 32, -201, -650, -1033, -628, 697, 2165, 2959, 3089, 3133, 3366, 3466, 3003, 1958, 884, 586, 1350, 2437, 2823, 2452, 2186, 2550, 3166, 3450, 3263, 2954, 3099, 3928, 4838, 4931, 4174, 3391, 3010, 2571, 1696, 838, 685, 1259, 2016, 2558, 2856, 2979, 3044, 3359, 4117, 4877, 4858, 3951, 2992, 2754, 2974, 2801, 2066, 1638, 2263, 3389, 3767, 3137, 2550, 2838, 3649, 4299, 4644, 4702, 4273, 3475, 2891, 2698, 2328, 1459, 795, 1258, 2686, 3960, 4273, 3815, 3165, 2626, 2336, 2537, 3318, 4351, 5170, 5646, 5989, 6276, 6134, 5117, 3469, 2198, 2057, 2640, 2884, 2384, 1802, 1953, 2831, 3742, 4256, 4692, 5457, 6180, 6120, 5365, 4804, 4707, 4286, 3154, 2302, 2773, 3932, 4151, 3042, 1878, 1620, 1823, 1911, 2142, 2659, 2967, 2937, 3016, 3204, 3163, 3155, 3465, 3529, 3025, 2859, 3650, 4418, 4055, 2975, 2259, 2162, 2214, 2019, 1563, 1255, 1706, 3024, 4474, 5231, 5297, 5292, 5439, 5301, 4573, 3593, 2786, 2060, 1246, 722, 1075, 2261, 3490, 3943, 3485, 2772, 2616, 3095, 3369, 2672, 1439, 1011, 2085, 3780, 4611, 4186, 3450, 3305, 3494, 3153, 2106, 1111, 865, 1266, 1740, 1919, 1933, 2261, 3134, 3979, 4038, 3578, 3496, 3677, 3118, 1823, 974, 1037, 1266, 1241, 1364, 1735, 1906, 1836, 1983, 2369, 2505, 2374, 2553, 3050, 2988, 2041, 1249, 1549, 2314, 2373, 1747, 1362, 1568, 1817, 1539, 824, 357, 751, 1769, 2477, 2389, 2038, 2074, 2288, 2012, 1199, 623, 929, 1747, 2028, 1422, 894, 1380, 2267, 2128, 779, -462, -584, 90, 842, 1546, 2239, 2494, 2068, 1558, 1422, 999, -231, -1288, -1149, -465, -168, 85, 540, 447, -124, -34, 469, -89, -1358, -1393, -60, 841, 700, 514, 601, 355, -56, 178, 893, 1008, 251, -375, -169, 139, -546, -1988, -2900, -2768, -2347, -2163, -1696, -572, 500, 864, 1066, 1863, 2770, 2678, 1499, 212, -503, -694, -314, 822, 2071, 2244, 1390, 812, 882, 683, 64, -183, -286, -1016, -1576, -765, 455, 356, -585, -653, 412, 1760, 2925, 3493, 2895, 1675, 1314, 2060, 2413, 1292, -407, -922, 355, 2338, 3555, 3753, 3806, 4140, 4098, 3189, 2027, 1381, 1136, 853, 624, 688, 831, 778, 696, 829, 996, 802, 132, -742, -1407, -1597, -1314, -693, 80, 605, 483, -37, -274, -190, -240, -135, 703, 1545, 1203, 218, -26, 255, 40, -361, -335, -650, -1847, -2622, -1861, -571, -146, -360, -419, -464, -817, -889, -55, 1081, 1357, 628, -297, -1038, -1837, -2538, -2589, -2140, -2005, -2391, -2621, -2274, -1714, -1277, -791, -278, -261, -806, -1100, -704, -370, -759, -1248, -1026, -598, -972, -1886, -2080, -1203, -293, -217, -652, -941, -1033, -1122, -1228, -1627, -2768, -4230, -4695, -3598, -2038, -1349, -1340, -759, 731, 1872, 1430, -23, -765, -245, 234, -518, -1989, -2983, -3264, -3229, -2814, -1712, -264, 557, -64, -1894, -3386, -3068, -1522, -819, -1650, -2556, -2475, -2154, -2166, -1443, 762, 2945, 3319, 2638, 2703, 2812, 808, -2635, -4359, -3664, -3210, -4361, -5222, -4338, -3092, -3020, -3303, -2598, -1447, -966, -584, 783, 2424, 2924, 2477, 1860, 564, -1704, -3407, -3271, -2264, -1675, -1314, -858, -794, -1178, -1354, -1172, -1051, -1259, -1972, -2983, -3209, -2225, -1600, -2495, -3320, -2456, -1192, -1139, -1301, -445, 464, 437, 112, -254, -1350, -2492, -1940, -130, 451, -712, -1214, 216, 1366, -10, -2514, -3293, -2475, -2542, -4000, -4684, -3504, -2025, -1490, -855, 724, 1769, 982, -194, -114, 140, -881, -2103, -2141, -1710, -1499, -809, 64, -356, -1669, -1968, -1238, -910, -1030, -1014, -1476, -2559, -2699, -1250, -51, -675, -2236, -3102, -2949, -2351, -1697, -1186, -1097, -1601, -2465, -3074, -2803, -1538, 33, 808, 354, -456, -510, -48, -179, -971, -1459, -1460, -1720, -2368, -2887, -3250, -3657, -3819, -3646, -3499, -3104, -1915, -630, -344, -752, -1259, -2246, -3198, -2339, -158, 385, -1107, -1706, -534, -1, -1065, -2137, -2619, -3150, -3252, -2389, -1642, -1648, -1280, -260, -234, -1809, -3298, -3428, -2909, -2669, -2521, -2143, -1841, -1688, -1046, 251, 1204, 1074, 573, 563, 485, -506, -1642, -1482, -380, -230, -1610, -2890, -2807, -2211, -2256, -2596, -2644, -2788, -3140, -2945, -2200, -1811, -1670, -898, 85, 154, -246, 221, 1391, 1927, 1465, 761, 262, -189, -609, -833, -979, -1158, -932, -91, 409, -290, -1244, -1228, -1145, -2389, -3899, -3828, -2861, -2780, -3130, -2368, -944, -381, -422, 304, 1539, 1811, 1324, 1814, 3287, 3726, 2648, 1787, 1499, 141, -2301, -3897, -4457, -5502, -6623, -5956, -3865, -2461, -2090, -1329, 283, 1859, 2744, 2964, 2743, 2412, 2283, 2260, 1988, 1386, 778, 539, 610, 366, -629, -1649, -1393, 156, 1485, 1689, 1689, 2367, 2621, 870, -2071, -3547, -2665, -1418, -1492, -1923, -1135, 493, 1647, 2252, 2954, 3453, 3097, 2510, 2813, 3523, 3263, 2441, 2641, 3378, 2656, 837, 194, 553, -417, -2444, -2659, -701, 455, -596, -1737, -1274, -536, -947, -1191, 341, 2411, 3086, 3287, 4960, 7255, 7657, 5548, 2310, -482, -1691, -1570, -2080, -3891, -4616, -2933, -1415, -1916, -2034, 222, 2588, 2615, 1514, 1443, 2551, 3784, 3765, 1569, -1088, -973, 1587, 2717, 1320, 372, 1167, 1790, 1451, 1176, 955, 545, 1166, 2883, 3408, 2040, 859, 592, -323, -2039, -3010, -2962, -2448, -922, 1577, 3183, 3148, 3289, 4560, 5149, 3765, 2006, 1681, 1954, 1043, -702, -1451, -855, -301, -368, -192, 564, 1110, 1122, 1110, 995, 15, -1724, -2963, -2741, -1355, 151, 994, 1135, 917, 450, -18, 382, 1833, 2507, 897, -1218, -1077, 691, 1331, 442, -241, 110, 1456, 3529, 4407, 2043, -1534, -2128, -12, 648, -1043, -1834, -348, 1289, 1645, 1606, 2236, 3494, 4341, 3577, 1876, 1713, 3319, 3605, 1457, -173, 227, 448, -359, -389, -30, -1468, -3388, -2661, -251, 766, 922, 2372, 4081, 4032, 3279, 3794, 4967, 4977, 3552, 1807, 835, 889, 1021, 89, -1459, -1983, -988, 408, 1315, 1820, 2175, 2540, 3009, 3028, 1825, 24, -689, -50, 410, -66, -347, 546, 1782, 1927, 973, 327, 1071, 2784, 3904, 2912, -56, -2376, -1513, 913, 891, -1432, -1901, 84, 659, -931, -1345, -152, -3, -460, 592, 1439, -151, -1453, 517, 3033, 2329, -69, -429, 1655, 3826, 4095, 2157, -264, -919, -98, -17, -804, -646, 243, 202, -233, 242, 522, -301, -225, 1758, 3157, 2566, 1826, 1725, 1030, 152, 188, -155, -1431, -937, 1842, 2812, 518, -852, 741, 1623, -438, -2503, -2180, -1104, -876, -342, 1547, 3560, 4078, 3191, 1895, 548, -935, -2223, -2941, -3244, -3065, -1784, 338, 1603, 908, -735, -1677, -1562, -1016, -478, -144, -269, -735, -699, 553, 2515, 3800, 3704, 2839, 1994, 1044, -407, -1851, -2349, -1926, -1434, -1123, -550, 137, 212, -288, -535, -207, 333, 769, 769, -49, -1337, -2240, -2594, -2545, -1734, -470, 53, 279, 1795, 3255, 1872, -491, 436, 3132, 2528, -572, -1243, 485, 1085, 762, 1325, 1204, -893, -2570, -2496, -2692, -3360, -1925, 1215, 2293, 599, -234, 1661, 3496, 2335, -614, -2032, -1075, 140, 86, -308, 264, 1323, 1510, 578, -497, -940, -1011, -1397, -2131, -2491, -2006, -1036, -140, 623, 1442, 2247, 2743, 2588, 1567, 36, -1078, -1261, -979, -866, -1019, -1441, -2106, -2290, -1209, 480, 1258, 898, 437, 150, -701, -2069, -2700, -1851, -434, -29, -965, -1690, -547, 1835, 2998, 1916, 310, -88, 43, -730, -1976, -2054, -753, 278, -285, -1853, -2763, -2246, -1101, -580, -1020, -1730, -1910, -1369, -487, 256, 612, 656, 702, 945, 1070, 507, -725, -1684, -1359, 76, 1218, 1086, 493, 720, 1319, 1019, 262, 152, -328, -2600, -4943, -4708, -3004, -2901, -3965, -3145, -470, 681, -704, -1619, -383, 475, -845, -1803, -309, 1150, 205, -1264, -1525, -2154, -3485, -2966, -648, 104, -1063, -950, 794, 1025, -911, -2146, -1443, -792, -1516, -2336, -2069, -1575, -1831, -1958, -805, 672, 576, -859, -1478, -602, -21, -780, -1447, -928, -325, -266, 285, 834, -695, -3309, -3514, -1617, -1266, -2450, -1837, 335, 838, -190, -63, 880, 203, -2001, -3469, -2754, 20, 3021, 3349, 521, -2225, -2589, -2156, -2465, -2337, -1318, -1184, -2297, -2807, -2205, -1700, -1413, -815, -684, -1469, -1585, 27, 1725, 1713, 732, 288, 71, -866, -1773, -1374, -536, -1070, -2301, -1966, -289, 333, -472, -793, -75, 421, 347, 459, 749, 726, 601, 592, 255, -394, -429, 523, 1511, 1555, 909, 656, 1389, 2392, 2227, 445, -1649, -2477, -1781, -306, 844, 300, -1984, -3259, -1173, 2058, 2554, 652, -743, -1585, -3083, -3329, -255, 3707, 5003, 4071, 3199, 2588, 1566, 498, -391, -1377, -1924, -1358, -165, 997, 1917, 1893, 770, 387, 1739, 2437, 710, -1018, -502, 282, -617, -1375, -454, 202, -638, -584, 1893, 3943, 2844, 903, 1490, 2871, 1726, 214, 1932, 3727, 895, -3062, -2473, -309, -1811, -3888, -1924, 756, 106, -672, 1529, 3445, 2336, 715, 798, 1508, 2006, 2382, 1803, 153, -884, -858, -1364, -2686, -3328, -3017, -2674, -2039, -493, 959, 1110, 560, 392, 383, -20, -433, -416, -445, -972, -1412, -1034, -195, 369, 855, 1618, 1811, 602, -909, -1037, -86, 512, 674, 1208, 1891, 1809, 783, -542, -1197, -554, 466, 187, -897, -578, 753, 188, -2335, -3600, -2718, -1791, -1031, 1131, 3852, 5109, 5297, 5285, 4172, 2191, 1294, 1073, -493, -2291, -2179, -1786, -3002, -3499, -1690, -612, -1697, -1484, 1472, 3808, 3957, 4099, 4708, 4170, 3021, 2613, 1886, 26, -1274, -1370, -1972, -3176, -3104, -1998, -1796, -2062, -932, 1024, 1809, 1573, 1996, 3283, 3984, 3040, 1134, 339, 1752, 3305, 1937, -1712, -3814, -2981, -1799, -2068, -2372, -1247, 546, 1701, 1836, 1056, -85, -569, -59, 680, 1105, 1469, 1834, 1803, 1418, 1222, 1526, 2181, 2642, 2014, 6, -1989, -2026, -77, 1769, 1971, 1280, 1239, 1869, 1818, 451, -1316, -2364, -2563, -2404, -2244, -2069, -1455, -118, 1222, 1646, 1708, 2443, 3221, 3127, 3167, 3962, 3649, 1665, 959, 2586, 2986, 443, -1568, -841, 144, -213, -152, 867, 1042, -40, -1243, -2010, -1439, 1435, 4541, 4634, 2821, 2654, 3730, 3299, 1917, 1394, 413, -2239, -4154, -3484, -2161, -1814, -1210, 417, 1951, 2750, 2865, 1951, 650, 647, 1465, 634, -1662, -2244, -352, 885, -216, -1113, 433, 2337, 1482, -1067, -1532, 764, 2494, 1518, -278, -343, 1046, 2069, 2140, 1854, 1430, 589, -534, -1435, -2100, -3024, -4019, -3901, -2343, -1067, -1317, -1319, 960, 3712, 3707, 1671, 862, 1560, 1519, 514, 90, 225, -38, -353, -178, -117, -412, -325, 25, -476, -1786, -2457, -1785, -622, 7, 21, -66, 116, 587, 1098, 1160, 369, -887, -1563, -1142, -40, 1163, 1873, 1495, 766, 1467, 3012, 2222, -1244, -3415, -2558, -2023, -3805, -5132, -4038, -2452, -1734, -733, 661, 1063, 792, 1309, 2214, 2195, 1657, 1886, 2878, 3363, 2040, -1021, -3472, -2938, -757, -426, -1854, -1513, 1025, 1878, -606, -3122, -2820, -1189, -1004, -2490, -3727, -3048, -705, 1278, 1437, 613, 229, 284, 654, 1782, 2433, 482, -2636, -3107, -1150, -444, -1286, -980, -14, -821, -2235, -1861, -1255, -2613, -3713, -1811, 880, 707, -1312, -1524, 140, 375, -1597, -2466, -133, 2937, 3564, 2214, 1468, 2247, 3354, 3210, 1145, -1870, -3814, -3948, -3691, -4146, -4350, -3118, -1080, 236, 283, -71, 500, 2001, 2335, 79, -2397, -1650, 1490, 3166, 2147, 74, -2162, -3911, -3448, -1170, -257, -1075, -247, 2459, 2939, 190, -1987, -1829, -1629, -2633, -3516, -3529, -2992, -1840, -399, 226, -9, -61, 174, 121, 206, 965, 1469, 748, -465, -1097, -1421, -1998, -2279, -1576, -392, 247, 252, 535, 1593, 2325, 1086, -1632, -3002, -1527, 819, 1732, 1618, 1519, 714, -1111, -2011, -775, 590, -130, -1855, -2086, -834, -221, -975, -1725, -1502, -586, 900, 2641, 2944, 1001, -642, 524, 2532, 1847, -869, -2243, -1847, -2027, -3117, -3018, -1310, -234, -941, -1563, -410, 1056, 474, -1476, -1866, 156, 2308, 2681, 2002, 1532, 939, -353, -1463, -1460, -1202, -1959, -3111, -3091, -2089, -1650, -1709, -490, 2005, 3206, 1951, 498, 897, 2019, 1880, 343, -1706, -3356, -3336, -1238, 959, 1150, 375, 1164, 3252, 3813, 1788, -605, -1184, -621, -854, -1746, -1210, 946, 1609, -1082, -3842, -2624, 1013, 2544, 1386, 79, -642, -826, 697, 2645, 1220, -2669, -3383, -303, 1116, -573, -1039, 1167, 2932, 2758, 1448, -947, -3405, -3129, -526, 57, -2513, -3680, -465, 3806, 4657, 2454, 619, 408, 382, -174, -257, 370, 338, -841, -1571, -695, 410, -170, -1947, -2782, -2005, -878, -285, 127, 865, 2090, 3309, 2791, -375, -3332, -2489, 435, 610, -1844, -2218, 424, 1873, 331, -947, 121, 1039, -252, -1534, -613, 549, 75, 301, 2732, 3807, 1363, -601, 576, 1207, -759, -1211, 1639, 3117, 614, -2115, -1812, 196, 1598, 1352, -574, -2279, -1491, 436, 359, -827, 321, 3184, 3897, 2032, 839, 1415, 1494, -64, -1481, -1179, -39, 353, 61, 243, 1039, 1387, 1038, 1349, 3023, 4281, 2964, -276, -2737, -2894, -1246, 710, 1037, -801, -2089, -471, 1355, 58, -1467, 876, 3828, 2171, -1457, -1492, 660, 571, -596, 439, 2027, 864, -1826, -2691, -1561, -512, -101, 307, 262, -650, -753, 1249, 2980, 1612, -1026, -1198, 532, 924, 30, 264, 1273, 729, -1023, -1357, 278, 1658, 1266, -26, -869, -950, -283, 1018, 1791, 820, -716, -270, 1901, 2448, 62, -1970, -401, 3129, 4499, 2883, 1086, 698, 78, -2145, -4359, -4384, -2671, -934, 885, 3501, 5440, 4957, 3540, 3202, 2105, -1840, -5525, -4884, -1778, -380, -118, 1693, 3809, 3351, 1133, 11, 378, 763, 840, 921, 232, -1398, -1685, 779, 2878, 1245, -1651, -1400, 585, 135, -1383, 341, 3918, 4060, 482, -1876, -610, 1501, 1390, -385, -1151, 241, 2196, 2546, 1094, -587, -1354, -1631, -2195, -2488, -1398, 231, 281, -792, -265, 1738, 2169, 1033, 1369, 2607, 1083, -2417, -3288, -1304, -649, -2000, -1850, 446, 1486, 41, -1151, -781, -1243, -3731, -5430, -4384, -3056, -3554, -3230, 673, 5537, 7049, 5534, 4237, 3584, 1561, -1499, -2758, -1520, -370, -810, -1056, 399, 2024, 1887, 564, -436, -1070, -1773, -1883, -816, 454, 834, 948, 1771, 2388, 1243, -918, -1729, -845, -460, -1392, -1222, 1648, 4513, 4097, 1514, -352, -1638, -3149, -2989, -748, -217, -2655, -3243, 481, 3476, 1699, -1147, -443, 1889, 1607, -817, -1976, -1366, -1179, -1746, -1368, -8, 882, 1407, 1954, 894, -1971, -3147, -1166, 503, 255, 960, 2631, 1229, -2597, -3099, 384, 1980, -907, -4393, -4948, -3016, -263, 2109, 3009, 2348, 1422, 965, 52, -1974, -3799, -3760, -2133, -54, 2466, 4853, 4424, 565, -2222, -534, 1825, -168, -4134, -4099, 177, 3869, 4601, 3936, 3088, 1496, -943, -3091, -4038, -3922, -3227, -2106, -754, 189, 341, 403, 1262, 2249, 1668, -569, -2333, -1913, 204, 2492, 3572, 2389, -481, -2272, -1377, -247, -1869, -4721, -4735, -1289, 2118, 2715, 1166, -451, -983, -201, 1147, 800, -2655, -6155, -4773, 934, 4971, 4438, 2525, 2091, 2258, 2017, 1516, 46, -2460, -3514, -1737, 311, 336, -201, 361, 691, -306, -656, 1088, 2329, 170, -3192, -3134, 158, 1796, -320, -2738, -2303, -399, 499, 786, 1502, 1301, -730, -1868, 34, 1866, 439, -1192, 552, 2482, 794, -1280, -10, 1601, 453, -639, 272, -46, -2682, -3344, -207, 2511, 1521, -965, -1532, -69, 1536, 2216, 1750, 93, -1714, -1896, -825, -978, -2348, -1852, 904, 2618, 2434, 2650, 2928, 1146, -909, -448, 226, -1880, -3990, -2507, 545, 1893, 2259, 2898, 2576, 1045, 351, 920, 837, -218, -356, 546, 63, -2308, -3445, -1642, 135, -708, -1837, -531, 1258, 941, 30, 525, 1035, 161, -669, -240, 633, 1331, 1836, 1258, -565, -1337, 475, 2300, 569, -3870, -6294, -3947, 595, 2565, 461, -2719, -3408, -1298, 1081, 1603, 616, 9, 766, 2045, 2429, 1139, -1668, -4264, -3816, -73, 2696, 1123, -1468, 347, 4979, 5342, -368, -5666, -5356, -2614, -2980, -5571, -5293, -1455, 1417, 788, -918, -896, 590, 1932, 2213, 1154, -642, -1340, 173, 2038, 1426, -1116, -2042, -176, 1482, 768, -337, 357, 1285, -124, -3114, -4710, -3623, -1057, 1201, 1903, 591, -1652, -2463, -890, 871, 443, -956, -353, 1944, 2472, 19, -2215, -1091, 2103, 3425, 1327, -1640, -2078, 510, 3475, 3890, 1369, -1722, -2869, -1966, -684, 187, 1202, 2326, 2622, 2112, 1932, 2165, 1278, -1509, -4423, -4619, -1621, 1369, 1051, -1039, 78, 5230, 8442, 4869, -1918, -4539, -1495, 1961, 1647, -802, -1524, 148, 1573, 898, -579, -597, 716, 954, -1083, -3246, -2467, 1133, 3948, 3294, 1131, 1753, 5512, 7304, 3602, -1551, -1883, 1795, 3305, 705, -2117, -2384, -1014, 453, 842, -703, -2629, -2186, -237, -58, -996, 654, 4393, 5496, 2607, -251, 102, 2147, 2831, 1450, -741, -2598, -3418, -2760, -1349, -830, -1599, -2545, -3402, -4590, -4582, -1466, 2577, 2974, -418, -2719, -1096, 1638, 1740, -318, -1101, 1032, 3968, 4292, 936, -3528, -5197, -3004, -230, -349, -2001, -993, 2763, 4340, 1018, -3539, -4712, -3196, -2659, -3502, -3007, -748, 517, -151, -145, 1913, 3362, 1645, -1549, -2669, -1009, 1031, 1440, 770, 830, 2112, 3201, 2722, 994, -692, -1470, -1126, -183, -108, -1742, -3271, -1985, 1476, 3183, 1074, -2205, -2693, 245, 3780, 4954, 3076, -454, -3292, -3683, -2302, -1609, -2042, -1272, 1058, 2167, 1864, 3234, 5373, 3623, -864, -1531, 1936, 2797, -940, -4039, -3443, -1187, 959, 2436, 1719, -1082, -2419, -347, 1981, 1197, -1067, -1122, 923, 1782, 409, -766, -75, 1425, 2572, 3369, 3414, 2348, 1553, 2198, 2514, 327, -2897, -3973, -2934, -2653, -3853, -3739, -438, 3768, 5317, 3797, 1611, 343, -445, -1348, -2068, -2342, -2403, -2137, -895, 1262, 2951, 2920, 1543, 222, -101, 381, 402, -1223, -3491, -3884, -2356, -1653, -2227, -1464, 412, -220, -3164, -3511, 185, 3639, 3777, 1850, -193, -1209, -176, 1802, 1415, -1768, -3603, -1531, 1320, 1263, -100, 943, 3470, 3346, 374, -1737, -2069, -2588, -2541, -199, 1655, 32, -1703, 284, 2723, 1554, -292, 1008, 2832, 1510, -1039, -1422, -296, 127, -66, -48, -404, -1467, -1786, -425, 999, 898, 787, 2820, 5308, 4371, 19, -3282, -3118, -2379, -3765, -4918, -2783, 699, 2068, 2131, 3031, 3290, 1194, -868, -545, 297, -406, -1299, -1060, -860, -1094, -115, 1986, 2455, 621, -153, 2094, 3845, 1311, -3028, -3950, -1264, 1167, 1721, 1156, -550, -2646, -2310, 922, 3264, 2372, 843, 1447, 2908, 2685, 841, -853, -1670, -2187, -2739, -2751, -1508, 889, 3231, 3835, 2154, -80, -532, 500, 191, -2413, -4058, -1600, 2672, 3471, 190, -1938, 191, 2857, 1546, -2311, -4086, -2266, 978, 3078, 2922, 1517, 1431, 3546, 4963, 2626, -1896, -4088, -2453, -199, -660, -3125, -4233, -2253, 1303, 3614, 3118, 868, -311, 873, 2031, 257, -3226, -4487, -2442, 199, 1174, 837, 217, -368, -559, 117, 1121, 1234, 349, -593, -1600, -3338, -4514, -2680, 1185, 2532, -427, -3801, -3613, -995, 738, 1166, 2010, 3238, 3010, 1019, -656, -692, -758, -2962, -5919, -5797, -1623, 2960, 4346, 2872, 824, -689, -1452, -1413, -1379, -2077, -2480, -1582, -565, -357, 732, 3495, 4780, 1992, -1900, -2147, 683, 1546, -1675, -5340, -5318, -2224, 346, 888, 867, 1357, 1481, 575, -513, -1276, -2564, -4415, -4947, -3018, -80, 2072, 3329, 3864, 3119, 1419, 300, 215, -116, -1451, -2910, -3551, -3426, -2704, -1204, 565, 1286, 697, 451, 1813, 3645, 4121, 3163, 1692, -95, -2107, -3395, -3309, -2518, -1906, -1392, -440, 968, 2232, 2613, 1875, 689, 127, 368, 244, -1165, -2751, -2551, -725, 679, 1140, 2055, 3329, 2996, 1071, 101, 819, 809, -1320, -3523, -3388, -1263, 929, 2229, 2765, 2707, 2393, 2482, 2722, 1751, -524, -2028, -1651, -1255, -2376, -3184, -1324, 1988, 3406, 2024, 246, 305, 1472, 1416, -335, -1560, -571, 1072, 768, -1166, -1942, -462, 1178, 838, -784, -1246, 496, 2804, 3085, 544, -2763, -3837, -1914, 604, 1019, -271, -452, 1574, 3405, 2433, -411, -1912, -910, 498, 348, -463, 42, 1698, 2345, 839, -1427, -2111, -545, 1366, 1302, -269, -424, 1877, 3784, 2477, -868, -2990, -2773, -1582, -615, 208, 1260, 2373, 3083, 3130, 2583, 1630, 375, -1053, -2176, -2106, -589, 846, 313, -1416, -1568, 96, 612, -1125, -2416, -1377, 403, 1161, 1154, 694, -392, -953, 510, 2826, 3189, 1389, 204, 1032, 1827, 621, -1307, -1803, -1337, -1620, -2298, -1746, -46, 1264, 1613, 1651, 1820, 2057, 2288, 2247, 1340, -544, -2396, -2850, -1659, -87, 411, -228, -815, -474, 616, 1943, 2992, 2799, 751, -1798, -2517, -1200, -137, -1023, -3117, -4468, -3613, -740, 1727, 1213, -1383, -2303, -145, 2168, 1710, -808, -2861, -3358, -2999, -2764, -2773, -2279, -914, 348, 422, -162, -177, 188, -182, -1232, -1830, -1627, -1321, -1268, -986, -64, 1195, 2077, 2029, 1047, -207, -843, -688, -587, -1234, -2040, -2015, -1405, -1286, -1663, -1416, -252, 673, 581, 282, 761, 1552, 1577, 935, 590, 623, 188, -784, -1221, -606, 132, 94, -243, 50, 758, 870, 277, 1, 643, 1526, 1780, 1516, 1337, 1304, 1102, 832, 791, 729, 226, -435, -585, -174, 284, 512, 572, 492, 310, 218, 321, 540, 815, 1109, 1144, 602, -184, -333, 303, 652, 111, -227, 638, 1739, 1763, 1218, 1077, 804, -298, -1340, -1314, -778, -580, -373, 431, 1427, 1801, 1315, 327, -555, -720, 20, 1096, 1572, 1058, 16, -860, -1200, -823, 166, 957, 675, -232, -404, 479, 1421, 1751, 1574, 889, -247, -1106, -1150, -857, -666, -163, 879, 1812, 2098, 1942, 1644, 1313, 1161, 1285, 1397, 1324, 1293, 1363, 1171, 632, 245, 260, 103, -661, -1280, -736, 581, 1407, 1583, 1866, 2176, 1886, 1361, 1289, 1263, 838, 716, 1224, 1310, 565, 269, 1125, 1968, 1714, 817, 219, 244, 649, 821, 321, -332, -265, 349, 706, 849, 1300, 1833, 1983, 1959, 1828, 1010, -342, -901, -157, 564, 195, -322, 395, 1835, 2238, 1210, 219, 404, 1122, 1169, 416, -344, -468, 84, 821, 1007, 362, -389, -255, 689, 1282, 854, 158, 218, 814, 920, 386, 164, 688, 1086, 613, 9, 382, 1333, 1434, 335, -815, -968, -218, 627, 852, 370, -138, -44, 331, 288, -76, -180, -98, -328, -736, -710, -158, 403, 603, 477, 152, -259, -558, -554, -322, -133, -102, 3, 396, 825, 791, 245, -291, -447, -500, -838, -1232, -1133, -565, -226, -541, -1065, -1059, -437, 167, 245, -21, -151, -38, 71, 60, -41, -335, -789, -948, -540, -46, -12, -229, -256, -225, -447, -803, -1029, -1045, -780, -294, -23, -207, -373, -78, 292, 206, -103, -128, -1, -217, -728, -963, -677, -283, -248, -500, -617, -392, 15, 308, 285, -42, -446, -680, -730, -741, -783, -805, -736, -551, -332, -257, -374, -458, -293, -28, 1, -265, -550, -608, -472, -328, -306, -426, -576, -502, -106, 253, 131, -290, -425, -265, -411, -971, -1262, -909, -461, -503, -799, -772, -436, -290, -511, -731, -624, -320, -103, -42, -37, 6, 80, 23, -315, -751, -938, -866, -783, -720, -601, -606, -819, -884, -605, -353, -386, -467, -495, -695, -931, -766, -327, -154, -261, -226, -63, -149, -452, -579, -426, -274, -295, -352, -276, -186, -406, -975, -1417, -1312, -935, -827, -927, -762, -311, -8, -4, -118, -307, -614, -840, -762, -484, -244, -105, -46, -67, -88, 10, 117, -47, -519, -956, -1006, -737, -560, -698, -840, -583, -80, 144, 19, -69, -75, -368, -853, -868, -233, 374, 397, 80, -68, 11, 42, -140, -404, -516, -489, -569, -748, -651, -195, 150, 109, -4, 23, -9, -79, 114, 417, 359, 72, 60, 267, 273, 130, 107, 84, -120, -272, -153, 33, 72, 89, 207, 284, 202, 122, 228, 415, 429, 244, 80, 58, 36, -93, -184, -64, 150, 221, 168, 203, 331, 351, 244, 217, 345, 455, 369, 84, -232, -310, -58, 218, 186, -46, -192, -309, -557, -694, -375, 225, 603, 604, 513, 517, 495, 344, 161, 7, -205, -433, -454, -252, -85, -38, 76, 307, 479, 540, 540, 369, -13, -325, -342, -229, -187, -110, 107, 352, 520, 637, 662, 506, 249, 48, -38, -21, 62, 91, 3, -52, 22, 92, 118, 282, 524, 475, 135, -17, 178, 331, 231, 130, 177, 207, 167, 207, 346, 418, 329, 155, 79, 228, 457, 415, 47, -229, -95, 202, 267, 138, 139, 340, 507, 506, 446, 435, 426, 384, 344, 278, 131, 30, 149, 354, 340, 124, 48, 238, 430, 396, 252, 231, 360, 456, 367, 164, 48, 96, 203, 260, 269, 255, 233, 252, 300, 228, -13, -167, -7, 269, 323, 187, 140, 268, 438, 536, 538, 483, 449, 429, 298, 87, 19, 106, 59, -190, -266, 71, 526, 710, 628, 541, 553, 521, 266, -162, -460, -410, -166, -28, -33, -22, 19, 23, 94, 369, 661, 627, 334, 245, 499, 615, 260, -141, -44, 353, 463, 191, -69, -98, 1, 110, 178, 141, 24, -8, 128, 262, 201, 43, 81, 372, 586, 436, 117, 77, 388, 653, 604, 453, 468, 532, 371, 21, -210, -132, 151, 372, 366, 233, 216, 356, 429, 283, 80, 53, 164, 190, 68, -16, 91, 314, 439, 410, 354, 328, 214, 13, -40, 118, 213, 129, 162, 420, 541, 352, 179, 198, 129, -114, -188, 37, 215, 92, -151, -217, -30, 245, 357, 206, -10, -74, -37, -36, -27, 30, 11, -108, -122, 52, 185, 109, -54, -148, -154, -86, 43, 122, 34, -123, -146, -17, 80, 13, -124, -138, -17, 7, -195, -389, -282, -9, 34, -193, -321, -153, 65, 73, -37, -34, 81, 131, 39, -119, -268, -344, -250, 4, 206, 176, 14, -63, -18, 52, 90, 65, -44, -170, -186, -99, -41, -69, -111, -118, -126, -148, -130, -61, -16, -40, -50, 22, 85, -13, -269, -514, -587, -450, -200, 22, 143, 216, 293, 318, 198, -49, -318, -561, -799, -932, -771, -368, -71, -56, -74, 75, 176, 2, -266, -389, -423, -497, -557, -526, -414, -238, -63, -60, -252, -399, -341, -225, -220, -256, -225, -195, -273, -401, -454, -434, -457, -557, -623, -546, -365, -209, -127, -63, -7, -24, -143, -315, -508, -701, -779, -630, -360, -204, -215, -230, -139, -20, -8, -158, -394, -557, -557, -485, -486, -535, -468, -257, -86, -89, -146, -100, -34, -131, -327, -396, -323, -289, -337, -355, -303, -240, -188, -146, -139, -168, -230, -357, -483, -442, -269, -238, -392, -416, -169, 52, 14, -140, -226, -270, -332, -381, -387, -337, -214, -103, -128, -220, -227, -214, -361, -608, -712, -587, -318, 20, 302, 300, -37, -374, -348, -97, -99, -486, -818, -713, -349, -141, -161, -184, -80, 57, 62, -127, -352, -358, -149, -20, -143, -343, -392, -291, -141, -8, 16, -123, -311, -389, -368, -352, -352, -312, -239, -164, -86, -13, 20, 4, -43, -128, -231, -299, -298, -227, -90, 66, 145, 112, 51, 8, -90, -248, -319, -240, -166, -209, -240, -117, 14, -62, -259, -276, -66, 80, 19, -55, 15, 80, -36, -210, -213, -53, 48, -15, -128, -128, -13, 87, 72, -37, -122, -108, -61, -95, -193, -203, -79, 36, 39, 27, 125, 260, 255, 83, -89, -126, -60, 3, 3, -59, -128, -95, 78, 252, 232, 45, -75, -5, 106, 74, -65, -123, -44, 21, -24, -73, 13, 157, 174, 61, -14, -7, -20, -65, -52, -3, -16, -48, 11, 109, 104, 19, -5, 58, 117, 109, 52, -28, -114, -166, -136, -31, 59, 46, -43, -77, 2, 88, 72, 8, 1, 45, 83, 109, 109, 54, 15, 61, 102, 30, -39, 37, 162, 170, 122, 137, 157, 100, 29, 29, 70, 106, 139, 140, 98, 83, 139, 193, 183, 154, 158, 161, 128, 97, 107, 145, 169, 158, 118, 77, 76, 132, 201, 205, 139, 74, 58, 55, 42, 65, 165, 272, 282, 193, 106, 93, 129, 160, 168, 151, 106, 71, 92, 141, 148, 119, 132, 188, 203, 154, 107, 119, 170, 204, 185, 147, 162, 211, 195, 129, 150, 266, 304, 209, 156, 227, 285, 254, 229, 253, 233, 150, 115, 176, 228, 193, 134, 136, 191, 250, 296, 303, 236, 173, 253, 413, 428, 267, 170, 250, 349, 355, 321, 294, 249, 207, 204, 200, 185, 225, 319, 355, 296, 255, 300, 354, 336, 280, 263, 289, 310, 324, 365, 409, 387, 291, 207, 214, 266, 271, 219, 187, 217, 276, 314, 308, 266, 230, 266, 360, 411, 371, 310, 296, 301, 287, 282, 310, 341, 339, 300, 258, 255, 291, 297, 219, 115, 84, 131, 187, 211, 199, 147, 94, 121, 221, 290, 260, 195, 169, 174, 166, 135, 99, 75, 68, 83, 122, 187, 229, 186, 85, 49, 121, 179, 128, 46, 49, 112, 140, 117, 105, 130, 157, 161, 139, 100, 57, 37, 54, 73, 53, 21, 29, 74, 103, 102, 96, 93, 84, 63, 43, 27, 14, 0, -24, -38, -12, 24, 19, -1, 34, 94, 88, 30, 16, 36, 6, -46, -33, 21, 12, -62, -105, -72, -21, -26, -90, -150, -143, -77, -29, -58, -125, -144, -98, -61, -82, -106, -86, -69, -112, -168, -176, -166, -186, -204, -183, -161, -190, -250, -270, -237, -179, -125, -87, -100, -179, -258, -257, -203, -195, -257, -318, -324, -295, -260, -225, -201, -218, -270, -309, -304, -283, -283, -295, -286, -264, -255, -265, -277, -285, -299, -319, -333, -325, -298, -268, -252, -250, -254, -266, -289, -304, -294, -273, -271, -283, -288, -274, -267, -279, -307, -335, -340, -296, -213, -156, -191, -261, -263, -208, -209, -263, -257, -199, -206, -277, -276, -183, -125, -164, -228, -243, -212, -180, -195, -253, -283, -261, -244, -248, -205, -119, -122, -245, -333, -269, -151, -111, -137, -152, -154, -181, -217, -219, -209, -245, -308, -321, -253, -174, -154, -183, -204, -190, -161, -151, -167, -182, -179, -178, -201, -216, -194, -164, -164, -180, -178, -162, -151, -148, -152, -168, -182, -188, -202, -231, -244, -216, -174, -155, -142, -108, -91, -139, -205, -193, -127, -127, -193, -191, -108, -78, -128, -140, -91, -80, -117, -115, -72, -65, -100, -128, -132, -112, -78, -95, -188, -243, -171, -58, -29, -60, -43, 20, 48, 19, -33, -85, -129, -145, -117, -74, -51, -39, -10, 9, -14, -47, -37, -17, -50, -101, -82, 3, 64, 62, 52, 72, 84, 37, -46, -105, -115, -90, -44, 15, 64, 61, 24, 19, 47, 32, -52, -112, -80, -26, -34, -71, -74, -64, -81, -108, -111, -84, -39, -7, -14, -28, 10, 63, 28, -74, -116, -65, -16, -16, -10, 26, 35, -12, -51, -41, -43, -103, -143, -88, 0, 32, 40, 66, 65, 25, 14, 39, 34, 17, 62, 106, 52, -38, -43, 11, 24, 4, 10, 26, 34, 55, 90, 72, -15, -100, -114, -75, -41, -36, -44, -55, -69, -69, -28, 41, 77, 34, -48, -93, -75, -29, 0, 9, -1, -15, -10, 13, 9, -37, -73, -46, 12, 23, -30, -85, -77, -23, -2, -46, -78, -27, 59, 63, -21, -84, -63, -23, -30, -61, -60, -31, -11, 12, 57, 85, 50, -12, -27, 8, 13, -51, -120, -120, -62, -13, -4, -9, 0, 17, 21, 1, -29, -53, -56, -59, -76, -67, -8, 46, 34, 6, 29, 63, 28, -39, -54, -14, 22, 26, 2, -34, -48, -25, -11, -24, -17, 26, 47, 13, -11, 14, 45, 34, 9, 11, 32, 47, 57, 73, 84, 71, 34, -4, -13, 13, 52, 59, 22, -9, 17, 84, 119, 106, 83, 65, 45, 38, 61, 76, 57, 46, 99, 175, 180, 107, 54, 80, 134, 137, 94, 62, 67, 99, 138, 157, 151, 152, 177, 178, 128, 92, 123, 162, 151, 128, 139, 148, 117, 88, 102, 140, 157, 148, 125, 99, 85, 88, 93, 80, 58, 55, 92, 149, 182, 179, 172, 185, 189, 157, 123, 129, 150, 130, 92, 94, 129, 143, 128, 113, 115, 129, 144, 139, 112, 100, 123, 148, 144, 125, 105, 84, 78, 97, 91, 35, 2, 62, 151, 176, 150, 132, 114, 73, 42, 57, 89, 106, 113, 121, 116, 104, 106, 126, 130, 111, 111, 140, 141, 89, 50, 77, 106, 63, -13, -34, 11, 63, 98, 137, 178, 182, 143, 105, 107, 132, 147, 142, 130, 118, 113, 115, 107, 83, 61, 55, 50, 39, 34, 27, 7, 2, 41, 86, 96, 100, 132, 164, 162, 147, 136, 117, 102, 113, 114, 60, -8, -14, 24, 33, 7, 30, 138, 242, 246, 172, 104, 81, 84, 99, 127, 140, 117, 84, 81, 102, 105, 72, 32, 35, 91, 140, 138, 115, 114, 101, 30, -49, -58, -14, 0, -18, -15, 20, 60, 99, 141, 154, 103, 24, -10, 22, 66, 61, 17, 3, 42, 86, 92, 93, 114, 115, 63, -1, -26, -28, -41, -44, -2, 52, 55, 10, -16, 7, 36, 34, 19, 20, 26, 20, 12, 23, 32, 16, -12, -27, -23, -7, 16, 46, 58, 40, 23, 36, 54, 28, -39, -91, -91, -73, -65, -46, 0, 24, -4, -28, -3, 21, 0, -17, 1, 2, -44, -77, -53, -25, -34, -49, -48, -54, -76, -88, -81, -80, -100, -120, -112, -62, 4, 43, 24, -40, -98, -111, -89, -64, -47, -37, -56, -104, -135, -117, -91, -95, -113, -111, -94, -75, -55, -59, -89, -101, -77, -77, -127, -155, -123, -98, -127, -159, -144, -104, -67, -36, -27, -53, -89, -124, -176, -223, -210, -144, -90, -62, -24, 11, -3, -62, -91, -74, -63, -88, -105, -84, -63, -72, -69, -36, -13, -15, 6, 26, -40, -167, -213, -143, -77, -85, -116, -117, -111, -112, -104, -82, -80, -115, -154, -158, -129, -103, -106, -133, -161, -159, -116, -49, -11, -26, -52, -24, 47, 84, 53, -4, -61, -130, -199, -232, -238, -244, -218, -120, -8, 32, 24, 66, 160, 185, 76, -82, -171, -176, -167, -174, -158, -107, -61, -48, -40, -15, 2, -10, -18, 11, 43, 9, -85, -154, -148, -106, -89, -97, -115, -142, -154, -99, 0, 26, -61, -146, -126, -58, -60, -123, -144, -91, -29, 1, 28, 59, 51, -4, -59, -103, -182, -294, -359, -321, -204, -60, 53, 96, 81, 62, 52, 30, -7, -62, -156, -267, -295, -190, -51, 1, -9, 9, 79, 136, 139, 116, 90, 43, -41, -131, -165, -125, -63, -48, -88, -126, -97, -11, 38, -11, -114, -166, -114, -8, 52, 22, -37, -22, 65, 106, 28, -99, -181, -194, -136, -13, 86, 71, -7, -11, 72, 125, 94, 53, 49, 30, -15, -1, 100, 142, 38, -68, -35, 46, 35, -33, -74, -94, -87, -25, 7, -66, -124, -30, 92, 63, -41, -31, 68, 92, 10, -56, -69, -106, -187, -220, -162, -77, -5, 89, 187, 206, 151, 94, 32, -79, -180, -193, -175, -206, -212, -58, 215, 413, 408, 256, 110, 41, -10, -114, -219, -207, -62, 102, 187, 181, 127, 53, 0, 1, 41, 46, -18, -90, -72, 54, 245, 420, 425, 134, -332, -630, -589, -376, -186, -9, 180, 282, 249, 176, 136, 92, 32, 12, 67, 172, 300, 423, 466, 357, 144, -4, 42, 228, 353, 305, 195, 201, 340, 485, 539, 494, 359, 191, 97, 128, 207, 254, 258, 202, 70, -47, -31, 55, 67, 3, -11, 61, 143, 161, 70, -111, -264, -284, -227, -203, -175, -20, 229, 397, 388, 282, 166, 45, -62, -48, 122, 307, 353, 289, 240, 221, 157, 37, -71, -136, -177, -170, -30, 240, 500, 570, 338, -204, -874, -1305, -1294, -996, -547, 177, 1080, 1588, 1309, 457, -668, -2025, -3280, -3692, -2932, -1456, 183, 1818, 3185, 3577, 2436, 102, -2319, -3789, -3913, -2836, -927, 1267, 3011, 3741, 3484, 2693, 1709, 622, -406, -1064, -1232, -1119, -902, -511, 43, 382, 147, -440, -819, -790, -590, -344, 25, 382, 396, 50, -317, -476, -442, -190, 342, 941, 1135, 728, 110, -132, 179, 760, 1261, 1540, 1581, 1440, 1207, 955, 743, 620, 551, 569, 1033, 2268, 3761, 4462, 4061, 3145, 2030, 476, -1311, -2499, -2566, -1619, 50, 1927, 3106, 3059, 2324, 1777, 1492, 946, 89, -447, -221, 419, 850, 1021, 1443, 2333, 3242, 3721, 3840, 3695, 2989, 1632, 236, -603, -1056, -1517, -1877, -1831, -1422, -859, -247, 208, 199, -231, -629, -800, -1125, -1873, -2547, -2470, -1704, -816, 1, 868, 1522, 1383, 144, -2128, -5029, -7445, -7811, -5586, -2182, 372, 1482, 1933, 2059, 1123, -1126, -3418, -4250, -3558, -2298, -1005, 292, 1076, 581, -905, -2211, -2978, -3773, -4286, -3277, -870, 934, 768, -717, -2356, -3792, -4936, -5403, -4825, -3138, -745, 1382, 2296, 1797, 142, -2434, -5085, -6029, -4214, -912, 1646, 3038, 4544, 6178, 5722, 1906, -3039, -5723, -5385, -3642, -1530, 1148, 4073, 6000, 6253, 5307, 3701, 1412, -1361, -3667, -4551, -3823, -1880, 556, 2376, 2762, 2091, 1188, -141, -2501, -5008, -5557, -3158, 1021, 4844, 6560, 5362, 1889, -1706, -3246, -2660, -2084, -3186, -4815, -4284, -1053, 2203, 2983, 2134, 2224, 3622, 4173, 2597, 390, -235, 868, 1797, 890, -1525, -3456, -3053, -625, 1123, 55, -2093, -1586, 1689, 3676, 2211, -203, -1057, -1173, -1861, -2538, -2549, -2164, -1298, 137, 959, 225, -960, -1162, -951, -1900, -4259, -6413, -6006, -2236, 2431, 4508, 3719, 2272, 339, -3330, -6923, -7042, -4169, -1470, 455, 2638, 3935, 2972, 1165, -25, -1575, -3744, -4230, -1951, 786, 1807, 1766, 1863, 1428, -482, -2807, -3632, -2767, -1481, -234, 1517, 3493, 4512, 4355, 3880, 3123, 1103, -1940, -3913, -3431, -1536, 329, 2464, 5212, 6498, 3672, -2288, -6796, -6543, -2793, 973, 3024, 3802, 3966, 3800, 3551, 2974, 1590, 60, -489, -692, -1914, -3050, -1559, 2111, 4613, 4682, 4636, 5741, 5470, 1741, -2802, -4052, -2201, -442, 619, 2837, 5836, 6790, 4492, 521, -2758, -3454, -1278, 1558, 2814, 3431, 5361, 7304, 6261, 2436, -910, -1844, -1153, -8, 1226, 2060, 1880, 1285, 1751, 3286, 3937, 2518, 276, -989, -697, 1103, 3785, 5460, 4687, 2553, 783, -816, -2784, -4173, -4419, -4227, -3369, -1027, 1501, 2354, 2348, 2666, 1733, -1305, -3324, -1842, 666, 895, -399, -623, 769, 2652, 3794, 3060, 271, -2729, -3671, -2439, -637, 1041, 3382, 6465, 8575, 8098, 5326, 1478, -2815, -6912, -9331, -8959, -6246, -2210, 2591, 6955, 8326, 5287, 304, -2198, -905, 1157, 1152, 170, 875, 2922, 3042, -509, -5516, -8492, -8501, -7371, -6927, -6937, -5642, -2011, 2447, 4929, 4976, 5250, 7269, 8514, 5943, 384, -4780, -7448, -7531, -5745, -3207, -951, 754, 1736, 1267, -588, -2112, -1915, -769, -155, -24, 709, 2148, 3141, 2787, 1280, -649, -2223, -2732, -2275, -2119, -2900, -2985, -575, 3101, 4950, 4000, 2000, 457, -702, -1615, -1614, -401, 987, 1044, -643, -2981, -4512, -4751, -4278, -3585, -1993, 1685, 7004, 11144, 11394, 7775, 2245, -3450, -7914, -9858, -9453, -8319, -6911, -3930, 523, 3662, 3304, 545, -1983, -3042, -3141, -3070, -2770, -1425, 1337, 4492, 6314, 5852, 3233, -903, -5474, -8949, -10170, -9056, -6172, -2142, 2145, 5304, 6252, 5166, 3063, 532, -2183, -4133, -4361, -3600, -3182, -2564, -535, 1723, 2067, 1070, 803, 1073, 301, -1228, -2020, -1702, -448, 1893, 4358, 4721, 2199, -1529, -4757, -7397, -9528, -9898, -6986, -1071, 5475, 9895, 10720, 8130, 3398, -1881, -6363, -8751, -7562, -2407, 4264, 8308, 7663, 3986, 20, -3307, -6422, -8944, -9370, -6844, -2414, 1928, 5082, 7179, 8264, 7489, 4124, -988, -5579, -7713, -7091, -4488, -729, 3008, 4946, 4345, 2632, 1279, -337, -3092, -5642, -5969, -4029, -1016, 2267, 4760, 4900, 2642, 68, -1153, -1528, -2328, -3673, -4389, -3201, -82, 3430, 5687, 6351, 5665, 3358, -370, -3935, -5892, -6260, -5309, -2815, 498, 2812, 3329, 2797, 1711, 4, -1516, -1579, -348, 790, 1316, 1860, 2436, 1999, 271, -1431, -2016, -1917, -1659, -738, 876, 1958, 2038, 2283, 3191, 3391, 1874, -397, -1963, -2506, -2511, -2303, -1637, 114, 2959, 5430, 5742, 3878, 1540, -51, -1177, -2401, -3352, -3088, -1225, 1458, 3529, 4103, 3366, 1763, -561, -3115, -4875, -5476, -5444, -4637, -1957, 2447, 6211, 7106, 5302, 2552, 116, -1770, -3067, -3356, -2201, -18, 1821, 2246, 1571, 742, 26, -738, -1218, -995, -452, -333, -685, -989, -1024, -1019, -1177, -1468, -1739, -1751, -1211, -31, 1510, 3012, 4099, 4122, 2288, -1168, -4415, -5633, -4968, -3913, -3157, -2059, 0, 2714, 5093, 6054, 5036, 2309, -1428, -5324, -8008, -7990, -5199, -1146, 2834, 6152, 7810, 6732, 3480, -247, -3582, -6212, -7036, -5163, -1515, 2097, 4455, 4741, 2618, -641, -2777, -3002, -2451, -2043, -1375, -20, 1399, 1977, 1588, 756, -133, -1018, -1709, -1726, -782, 791, 2287, 3137, 3025, 1897, 198, -1278, -2268, -3217, -4092, -3858, -1942, 645, 2552, 3512, 3705, 2788, 653, -1657, -2813, -2652, -2144, -2151, -2540, -2442, -1260, 642, 2336, 3260, 3469, 3138, 2302, 1090, -173, -1076, -1232, -620, 190, 696, 1099, 1508, 1220, 43, -774, -422, 162, 287, 800, 1989, 2627, 2322, 2206, 2511, 2171, 1139, 426, -56, -1210, -2706, -3344, -2909, -2061, -1001, 461, 2041, 3189, 3882, 4387, 4438, 3477, 1764, 371, -131, -142, -137, -229, -589, -1300, -1927, -2079, -2003, -1918, -1426, -382, 432, 364, -18, 176, 641, 309, -813, -1428, -815, 244, 776, 729, 349, -393, -1259, -1612, -1287, -806, -573, -477, -345, -203, -115, -150, -450, -1103, -1972, -2744, -3120, -3006, -2478, -1457, 316, 2644, 4529, 5173, 5105, 5466, 6305, 6503, 5461, 3988, 3254, 3370, 3316, 2214, 579, -102, 731, 1962, 2463, 2588, 3183, 4252, 5422, 6648, 7728, 8254, 8455, 8860, 9164, 8705, 7732, 6939, 6298, 5598, 5248, 5507, 5775, 5553, 5263, 5488, 6075, 6499, 6566, 6518, 6748, 7416, 8185, 8503, 8173, 7450, 6680, 6086, 5774, 5672, 5622, 5711, 6193, 6914, 7201, 6640, 5643, 4869, 4345, 3636, 2752, 2293, 2532, 2947, 2927, 2526, 2158, 1967, 1833, 1729, 1751, 1917, 2121, 2242, 2237, 2119, 1808, 1109, -35, -1316, -2299, -2926, -3566, -4448, -5275, -5563, -5264, -4821, -4582, -4412, -4026, -3460, -3038, -2930, -3007, -3147, -3464, -4116, -5047, -6052, -7039, -8020, -8885, -9361, -9297, -8859, -8382, -8068, -7920, -7924, -8127, -8518, -8932, -9179, -9172, -8940, -8533, -8059, -7737, -7791, -8176, -8573, -8772, -8926, -9270, -9705, -9970, -10053, -10126, -10147, -9897, -9307, -8624, -8248, -8471, -9132, -9613, -9449, -8802, -8100, -7511, -7090, -7011, -7232, -7352, -7110, -6723, -6480, -6340, -6155, -5975, -5970, -6245, -6775, -7386, -7747, -7557, -6866, -6079, -5546, -5228, -4864, -4318, -3623, -2928, -2543, -2774, -3523, -4276, -4611, -4488, -4058, -3518, -3104, -2929, -2889, -2861, -2818, -2683, -2350, -1918, -1601, -1316, -738, 77, 507, 110, -698, -1114, -953, -719, -792, -1029, -1108, -745, 245, 1594, 2489, 2406, 1778, 1377, 1333, 1214, 829, 492, 569, 1075, 1735, 2308, 2750, 3031, 2985, 2559, 2114, 2130, 2639, 3181, 3369, 3235, 3064, 3063, 3213, 3331, 3356, 3463, 3690, 3716, 3366, 3031, 3113, 3383, 3455, 3411, 3502, 3640, 3695, 3871, 4313, 4743, 4864, 4839, 4970, 5115, 4793, 3913, 3001, 2584, 2650, 2829, 2913, 2987, 3194, 3478, 3557, 3292, 3041, 3256, 3762, 3925, 3541, 2983, 2558, 2355, 2520, 3061, 3501, 3357, 2778, 2300, 2170, 2232, 2273, 2170, 1916, 1643, 1496, 1444, 1339, 1161, 1094, 1296, 1706, 2099, 2294, 2255, 2056, 1802, 1545, 1253, 906, 623, 578, 744, 867, 800, 718, 865, 1139, 1175, 816, 258, -277, -714, -937, -795, -385, 4, 270, 549, 965, 1524, 2123, 2437, 2094, 1156, 145, -541, -965, -1283, -1445, -1315, -932, -484, -145, 33, 123, 200, 201, -88, -701, -1202, -1109, -641, -471, -641, -539, -62, 190, 7, -217, -417, -895, -1545, -2016, -2347, -2618, -2551, -2111, -1741, -1510, -976, -143, 422, 536, 535, 533, 347, -31, -512, -1115, -1685, -1791, -1235, -302, 546, 944, 732, 127, -452, -943, -1581, -2266, -2606, -2595, -2558, -2454, -1936, -945, 284, 1453, 2052, 1728, 1016, 803, 1036, 991, 622, 459, 521, 486, 398, 277, -178, -834, -1090, -982, -1141, -1527, -1456, -792, 43, 888, 1714, 2307, 2667, 3005, 3031, 2257, 1051, 285, 62, -138, -350, -173, 403, 1056, 1680, 2267, 2599, 2521, 2250, 2067, 1941, 1688, 1363, 1191, 1211, 1252, 1276, 1414, 1630, 1660, 1329, 727, 125, -140, 106, 624, 934, 900, 839, 987, 1110, 881, 359, -294, -1304, -2834, -4279, -4838, -4623, -4207, -3420, -1817, 126, 1690, 3167, 5042, 6561, 6548, 5139, 3484, 2152, 837, -660, -2031, -2953, -3292, -2869, -1676, -319, 526, 1097, 2112, 3394, 4077, 4138, 4444, 5313, 6154, 6515, 6551, 6560, 6679, 6842, 6713, 6032, 5096, 4429, 4077, 3747, 3527, 3873, 4860, 6012, 7041, 8197, 9558, 10578, 10851, 10765, 10717, 10407, 9576, 8732, 8383, 8252, 7972, 7865, 8409, 9474, 10575, 11446, 11992, 12056, 11575, 10802, 10029, 9255, 8386, 7648, 7389, 7599, 8032, 8635, 9442, 10228, 10677, 10677, 10269, 9630, 9078, 8697, 8108, 7101, 6164, 5799, 5750, 5506, 5099, 4824, 4593, 4104, 3402, 2814, 2502, 2351, 2240, 2231, 2466, 2926, 3348, 3374, 2829, 1871, 817, -207, -1341, -2632, -3822, -4655, -5109, -5248, -5117, -4838, -4526, -4112, -3612, -3344, -3505, -3856, -4239, -4921, -6015, -7105, -7828, -8271, -8622, -8939, -9297, -9681, -9853, -9753, -9734, -10024, -10431, -10752, -10989, -11058, -10867, -10660, -10666, -10657, -10384, -10101, -10115, -10290, -10412, -10594, -10942, -11294, -11504, -11605, -11622, -11521, -11367, -11232, -11089, -10929, -10788, -10658, -10574, -10701, -11036, -11210, -10930, -10360, -9802, -9285, -8759, -8320, -8052, -7922, -7962, -8228, -8611, -8958, -9278, -9607, -9779, -9607, -9181, -8727, -8267, -7684, -7048, -6587, -6272, -5844, -5327, -5089, -5207, -5257, -4966, -4596, -4472, -4529, -4536, -4445, -4346, -4317, -4409, -4633, -4852, -4836, -4471, -3886, -3311, -2851, -2442, -2009, -1592, -1294, -1173, -1196, -1275, -1306, -1255, -1242, -1416, -1677, -1760, -1620, -1476, -1378, -1132, -740, -519, -613, -800, -890, -971, -1113, -1151, -967, -733, -585, -322, 163, 508, 406, 156, 99, 1, -378, -735, -866, -1116, -1591, -1772, -1477, -1350, -1800, -2252, -2030, -1394, -1134, -1464, -1822, -1703, -1287, -1047, -1043, -967, -803, -927, -1467, -2057, -2404, -2649, -2952, -3158, -3130, -3018, -2911, -2595, -1985, -1495, -1610, -2187, -2522, -2179, -1523, -1294, -1738, -2381, -2626, -2349, -1875, -1580, -1618, -1840, -1882, -1500, -876, -459, -465, -704, -907, -1001, -973, -738, -381, -264, -552, -848, -686, -252, -88, -194, -35, 560, 1141, 1433, 1800, 2601, 3490, 3810, 3509, 3233, 3421, 3690, 3447, 2758, 2185, 1953, 1859, 1928, 2510, 3563, 4435, 4724, 4907, 5616, 6592, 7039, 6828, 6566, 6509, 6292, 5851, 5675, 5940, 6205, 6183, 6070, 6069, 6154, 6317, 6576, 6747, 6617, 6298, 6167, 6449, 7003, 7482, 7680, 7729, 7876, 8157, 8382, 8364, 8013, 7346, 6582, 6121, 6147, 6359, 6326, 6053, 5905, 6055, 6300, 6448, 6595, 6897, 7189, 7099, 6566, 6013, 5813, 5779, 5531, 5151, 5048, 5244, 5376, 5326, 5328, 5389, 5154, 4508, 3856, 3551, 3391, 2974, 2361, 2008, 2137, 2525, 2881, 3126, 3260, 3239, 3070, 2856, 2677, 2503, 2217, 1739, 1203, 888, 896, 1048, 1159, 1223, 1239, 1135, 960, 878, 903, 864, 627, 185, -389, -887, -968, -533, -49, -89, -480, -425, 273, 784, 445, -316, -847, -1295, -2029, -2724, -2837, -2476, -2131, -1901, -1549, -1056, -647, -392, -199, -131, -341, -692, -863, -846, -919, -1081, -987, -535, -105, -76, -391, -740, -967, -1115, -1255, -1425, -1612, -1664, -1407, -970, -670, -487, -136, 279, 311, 0, -112, 42, -176, -1082, -2009, -2109, -1406, -754, -830, -1429, -1755, -1327, -485, 9, -157, -494, -340, 247, 594, 374, 13, -5, 240, 417, 413, 309, 144, -138, -602, -1100, -1232, -812, -267, -100, -148, 37, 381, 549, 690, 1143, 1705, 1890, 1708, 1563, 1568, 1480, 1246, 1051, 849, 336, -417, -891, -880, -833, -1128, -1504, -1497, -1016, -302, 316, 581, 548, 620, 974, 1079, 218, -1512, -3224, -4365, -5287, -6398, -7320, -7411, -6644, -5420, -3946, -2321, -838, 292, 1205, 1955, 2137, 1392, 58, -1182, -2186, -3317, -4567, -5412, -5611, -5474, -5217, -4753, -4111, -3467, -2748, -1783, -732, 105, 743, 1392, 2145, 2895, 3385, 3348, 2848, 2336, 2107, 1923, 1404, 579, -181, -552, -358, 467, 1745, 3043, 4108, 5175, 6490, 7663, 8080, 7876, 7772, 7908, 7639, 6708, 5859, 5871, 6537, 7070, 7221, 7484, 8265, 9314, 10035, 10082, 9592, 8990, 8643, 8534, 8400, 8235, 8369, 8915, 9532, 9969, 10430, 11119, 11698, 11645, 10959, 10126, 9407, 8625, 7690, 6871, 6389, 6142, 6030, 6196, 6690, 7160, 7206, 6869, 6535, 6438, 6445, 6288, 5806, 5060, 4429, 4344, 4688, 4714, 3925, 2712, 1772, 1161, 424, -559, -1421, -1974, -2396, -2627, -2261, -1369, -681, -564, -582, -423, -471, -1061, -1969, -2966, -4175, -5567, -6731, -7359, -7594, -7743, -7898, -7909, -7616, -7094, -6616, -6409, -6518, -6917, -7500, -7997, -8177, -8207, -8491, -9051, -9443, -9370, -9067, -8936, -9060, -9246, -9373, -9561, -9975, -10478, -10636, -10257, -9686, -9316, -9073, -8725, -8343, -8118, -8077, -8269, -8729, -9169, -9263, -9182, -9210, -9131, -8693, -8210, -7999, -7817, -7493, -7428, -7828, -8213, -8238, -8278, -8680, -8991, -8581, -7603, -6782, -6388, -6058, -5549, -5126, -5016, -5045, -5045, -5184, -5583, -5950, -6000, -5917, -6013, -6110, -5790, -5110, -4565, -4354, -4200, -3910, -3624, -3448, -3281, -3068, -2939, -2947, -2939, -2777, -2552, -2419, -2396, -2424, -2502, -2617, -2698, -2771, -2912, -3036, -2978, -2768, -2526, -2211, -1808, -1500, -1375, -1242, -1035, -974, -1149, -1352, -1461, -1555, -1624, -1579, -1476, -1405, -1304, -1147, -1117, -1340, -1672, -1949, -2211, -2524, -2761, -2738, -2465, -2151, -1997, -2033, -2133, -2134, -1969, -1734, -1648, -1885, -2341, -2668, -2693, -2660, -2785, -2851, -2681, -2614, -2928, -3191, -2945, -2618, -2887, -3412, -3248, -2447, -2141, -2735, -3144, -2512, -1591, -1445, -1809, -1870, -1712, -1767, -1770, -1429, -1299, -1879, -2529, -2359, -1640, -1279, -1277, -932, -341, -365, -974, -1051, -241, 307, -278, -1236, -1441, -1027, -661, -79, 1156, 2136, 1714, 709, 942, 2359, 3238, 2967, 2465, 2168, 1706, 1317, 1676, 2430, 2540, 2103, 2340, 3530, 4444, 4418, 4440, 5253, 5920, 5521, 4943, 5441, 6518, 6731, 5960, 5427, 5785, 6426, 6699, 6716, 6675, 6384, 5904, 5824, 6373, 6961, 7083, 7044, 7350, 7930, 8361, 8509, 8556, 8566, 8386, 7991, 7667, 7620, 7571, 7134, 6500, 6271, 6582, 6899, 6854, 6750, 6977, 7356, 7441, 7187, 6959, 6996, 7137, 7068, 6717, 6282, 5935, 5646, 5377, 5260, 5352, 5412, 5195, 4835, 4604, 4528, 4453, 4255, 3931, 3700, 3845, 4120, 3858, 3120, 2830, 3257, 3502, 3094, 2722, 2797, 2753, 2332, 2094, 2203, 2039, 1402, 936, 1048, 1311, 1240, 977, 896, 1015, 1132, 1276, 1595, 1929, 1925, 1620, 1434, 1441, 1200, 643, 413, 778, 934, 234, -576, -380, 602, 1175, 885, 360, 114, 51, 127, 532, 967, 699, -204, -557, 351, 1625, 1986, 1443, 941, 850, 742, 400, 149, 125, -33, -516, -912, -780, -222, 446, 1194, 2048, 2687, 2680, 2089, 1507, 1425, 1650, 1476, 447, -934, -1427, -391, 1098, 1307, 257, -59, 1434, 3081, 2750, 882, -191, 585, 1874, 1935, 796, 73, 914, 2592, 3482, 3026, 2015, 1199, 663, 320, -52, -855, -1774, -1700, -524, 255, -146, -368, 928, 2906, 3851, 3407, 2420, 1547, 972, 778, 764, 333, -731, -1625, -1329, -9, 1080, 1167, 773, 673, 799, 655, 233, -193, -748, -1580, -2182, -1971, -1282, -833, -497, 367, 1544, 2078, 1751, 1413, 1562, 1634, 1086, 271, -411, -1222, -2157, -2418, -1791, -1436, -2159, -2972, -2598, -1498, -1049, -1362, -1319, -497, 369, 882, 1565, 2568, 3059, 2464, 1200, -368, -2573, -5400, -7890, -9400, -10597, -12201, -13451, -12934, -10549, -7432, -4136, -370, 3443, 5926, 6483, 6043, 5539, 4526, 1919, -2362, -6978, -10362, -12065, -12786, -13209, -13147, -11953, -9459, -6248, -3156, -687, 1127, 2482, 3456, 3900, 3720, 3108, 2414, 1800, 1179, 374, -678, -1747, -2427, -2683, -2962, -3398, -3401, -2543, -1240, 3, 1370, 3131, 5051, 6833, 8425, 9501, 9481, 8426, 7170, 6293, 5545, 4530, 3435, 2819, 2940, 3588, 4473, 5548, 6791, 7907, 8555, 8752, 8777, 8683, 8328, 7850, 7649, 7844, 8175, 8538, 9183, 10150, 10911, 10933, 10356, 9715, 9117, 8152, 6633, 4977, 3730, 3042, 2762, 2804, 3292, 4400, 5962, 7363, 8016, 8007, 7917, 7998, 7833, 7002, 5732, 4539, 3494, 2374, 1314, 579, -73, -998, -1830, -1994, -1758, -1809, -2091, -2009, -1466, -823, -162, 642, 1300, 1294, 601, -310, -1204, -2349, -3956, -5729, -7217, -8325, -9138, -9507, -9220, -8473, -7698, -6970, -6026, -4938, -4198, -4048, -4248, -4676, -5551, -6784, -7766, -8166, -8501, -9311, -10221, -10456, -10065, -9829, -9966, -9920, -9428, -8980, -8889, -8762, -8229, -7554, -7152, -6966, -6743, -6562, -6704, -7149, -7623, -8056, -8605, -9213, -9549, -9422, -8997, -8548, -8195, -7888, -7495, -6991, -6552, -6377, -6442, -6535, -6515, -6399, -6258, -6144, -5996, -5680, -5248, -4994, -5030, -5089, -5050, -5216, -5738, -6258, -6464, -6497, -6461, -6167, -5599, -5062, -4642, -4060, -3233, -2503, -2158, -2084, -2059, -2117, -2427, -2954, -3464, -3811, -4053, -4258, -4392, -4422, -4364, -4161, -3719, -3135, -2715, -2559, -2355, -1797, -1067, -627, -613, -727, -721, -725, -1035, -1739, -2613, -3334, -3758, -3982, -4128, -4151, -3871, -3193, -2244, -1338, -758, -509, -350, -175, -196, -680, -1572, -2551, -3330, -3797, -4016, -4153, -4284, -4257, -3887, -3292, -2801, -2590, -2550, -2487, -2316, -2104, -2021, -2186, -2489, -2699, -2728, -2703, -2796, -3047, -3326, -3461, -3448, -3500, -3728, -3896, -3706, -3243, -2874, -2710, -2457, -1869, -1141, -702, -742, -1070, -1332, -1288, -993, -852, -1231, -1877, -2035, -1379, -481, -108, -309, -482, -176, 523, 1265, 1719, 1676, 1327, 1328, 2026, 2772, 2824, 2620, 3123, 4140, 4572, 4177, 3834, 4017, 4179, 3858, 3398, 3228, 3213, 3214, 3567, 4416, 5170, 5415, 5722, 6765, 8145, 8945, 8943, 8611, 8339, 8170, 7949, 7491, 6852, 6402, 6349, 6411, 6266, 6073, 6217, 6768, 7461, 8037, 8439, 8743, 9054, 9417, 9762, 9938, 9828, 9453, 8998, 8658, 8466, 8281, 7985, 7581, 7111, 6717, 6672, 7054, 7436, 7360, 7036, 7059, 7489, 7782, 7672, 7527, 7626, 7631, 7161, 6491, 6160, 6138, 5908, 5307, 4691, 4353, 4226, 4188, 4247, 4347, 4327, 4117, 3828, 3602, 3516, 3579, 3663, 3455, 2788, 2010, 1713, 1969, 2214, 1978, 1354, 730, 409, 514, 850, 919, 422, -332, -784, -739, -439, -195, -154, -283, -427, -392, -107, 280, 500, 368, -76, -608, -989, -1173, -1381, -1847, -2431, -2793, -2922, -3025, -2897, -2183, -1256, -902, -1043, -792, 112, 877, 853, 329, -146, -537, -1056, -1634, -2061, -2359, -2617, -2728, -2610, -2407, -2094, -1393, -435, 88, -104, -401, -201, 280, 510, 419, 281, 215, 199, 300, 539, 681, 489, 116, -138, -318, -628, -957, -1037, -917, -819, -738, -500, -38, 641, 1476, 2166, 2339, 2025, 1681, 1588, 1501, 1101, 525, 91, -231, -630, -887, -597, 109, 605, 586, 370, 393, 710, 1039, 1095, 877, 690, 809, 1140, 1345, 1351, 1473, 1878, 2156, 1855, 1185, 614, 74, -742, -1578, -1934, -1901, -1907, -1968, -1817, -1430, -866, -16, 945, 1319, 750, 4, 0, 315, -131, -1134, -1452, -1024, -1069, -1774, -1898, -1090, -665, -1405, -2329, -2489, -2493, -3116, -3651, -3126, -2202, -2126, -2462, -1788, -197, 864, 926, 776, 675, 30, -1144, -1967, -2107, -2327, -3234, -4289, -4573, -3999, -3169, -2373, -1474, -663, -405, -490, -87, 838, 1169, 371, -522, -545, -290, -710, -1461, -1643, -1342, -1352, -1867, -2308, -2147, -1521, -1078, -1213, -1446, -1070, -252, 247, 243, 6, -583, -1652, -2780, -3797, -5101, -6369, -6531, -5678, -4963, -4339, -2656, 74, 2826, 5396, 7714, 8477, 6821, 4147, 2220, 744, -1538, -4621, -7411, -9072, -9192, -7533, -4548, -1507, 766, 2889, 5770, 8838, 10560, 10482, 9499, 8202, 6378, 4170, 2447, 1760, 1748, 1749, 1479, 1137, 1199, 2010, 3367, 4601, 5248, 5550, 6232, 7666, 9334, 10361, 10649, 10937, 11510, 11611, 10702, 9373, 8249, 6994, 5241, 3583, 2768, 2822, 3567, 5060, 7051, 8854, 10109, 11012, 11700, 11964, 11542, 10447, 9108, 8084, 7307, 6161, 4799, 4454, 5617, 6997, 7296, 6804, 6361, 5930, 5145, 4151, 3159, 2048, 940, 408, 784, 1735, 2756, 3645, 4380, 4843, 4869, 4448, 3712, 2738, 1486, -105, -1992, -3812, -4904, -4939, -4498, -4486, -5001, -5355, -5161, -4739, -4501, -4510, -4641, -4756, -4729, -4559, -4396, -4359, -4503, -4901, -5595, -6525, -7696, -9143, -10638, -11768, -12425, -12789, -12835, -12315, -11261, -10000, -8764, -7693, -7014, -6838, -7037, -7535, -8415, -9527, -10498, -11188, -11782, -12361, -12752, -12746, -12210, -11260, -10420, -10236, -10596, -10832, -10516, -9792, -9006, -8448, -8271, -8280, -8023, -7375, -6830, -6919, -7598, -8399, -8967, -9265, -9377, -9342, -9154, -8829, -8416, -7890, -7181, -6352, -5673, -5377, -5408, -5498, -5472, -5356, -5231, -5092, -4916, -4713, -4463, -4133, -3841, -3863, -4293, -4830, -5093, -5027, -4853, -4737, -4642, -4416, -3879, -2951, -1815, -889, -476, -450, -480, -482, -646, -1043, -1543, -2062, -2569, -2859, -2704, -2243, -1879, -1761, -1619, -1212, -666, -252, -39, 97, 244, 398, 538, 625, 612, 559, 594, 647, 416, -243, -1048, -1581, -1747, -1751, -1740, -1651, -1401, -1008, -487, 183, 889, 1350, 1404, 1178, 878, 505, -64, -808, -1505, -1963, -2177, -2256, -2247, -2171, -2123, -2169, -2149, -1860, -1433, -1236, -1315, -1348, -1147, -834, -516, -263, -333, -882, -1536, -1781, -1698, -1847, -2485, -3250, -3597, -3330, -2736, -2269, -2080, -1900, -1422, -731, -213, -126, -382, -672, -742, -592, -426, -398, -463, -497, -361, 74, 692, 981, 632, 97, -14, 163, 135, -58, -63, 94, 310, 889, 2026, 3216, 3853, 4036, 4277, 4651, 4773, 4451, 3919, 3448, 3106, 2921, 2898, 2821, 2495, 2248, 2694, 3851, 4955, 5310, 5039, 4907, 5558, 6929, 8296, 8936, 8792, 8417, 8334, 8569, 8736, 8390, 7352, 5879, 4593, 4050, 4265, 4701, 4876, 4929, 5469, 6845, 8688, 10267, 11106, 11219, 10903, 10476, 10130, 9767, 9047, 7820, 6447, 5518, 5216, 5220, 5228, 5329, 5697, 6198, 6572, 6818, 7110, 7411, 7482, 7272, 7044, 7028, 7148, 7106, 6731, 6151, 5683, 5465, 5269, 4776, 4018, 3379, 3161, 3236, 3233, 2998, 2759, 2804, 3104, 3396, 3548, 3601, 3494, 3148, 2798, 2744, 2811, 2592, 2147, 1860, 1725, 1460, 1140, 1067, 1160, 1039, 574, -27, -502, -643, -393, 2, 124, -116, -302, 25, 796, 1460, 1585, 1281, 952, 739, 455, 4, -468, -923, -1513, -2176, -2537, -2399, -1984, -1561, -1179, -843, -574, -263, 189, 605, 680, 352, -174, -688, -1112, -1442, -1717, -1996, -2239, -2291, -2060, -1712, -1530, -1568, -1580, -1361, -1031, -897, -1097, -1447, -1609, -1390, -944, -661, -793, -1170, -1366, -1199, -954, -1040, -1492, -1950, -2109, -2028, -1934, -1902, -1842, -1723, -1583, -1414, -1189, -979, -851, -774, -740, -848, -1116, -1370, -1466, -1447, -1389, -1300, -1255, -1403, -1686, -1757, -1362, -732, -403, -620, -1036, -1104, -724, -324, -306, -599, -859, -865, -602, -256, -170, -484, -855, -918, -844, -954, -1138, -1165, -1104, -963, -510, 114, 365, 176, 98, 373, 654, 678, 448, -153, -1180, -2146, -2397, -1933, -1408, -1382, -1773, -1943, -1315, -30, 1145, 1629, 1455, 973, 623, 802, 1279, 1092, -182, -1593, -2138, -2073, -1968, -1605, -847, -410, -679, -853, -195, 768, 1082, 633, 71, -79, 170, 460, 428, 50, -229, 60, 745, 1070, 643, -9, -203, -16, 8, -226, -360, -373, -614, -927, -655, 142, 562, 387, 457, 960, 953, 237, -52, 494, 709, -97, -882, -624, 20, -214, -1380, -2506, -3095, -3534, -4138, -4595, -4641, -4573, -4531, -3830, -1802, 972, 3184, 4440, 5457, 6597, 7164, 6437, 4524, 1944, -883, -3513, -5455, -6545, -6973, -6836, -5937, -4034, -1180, 2139, 5337, 8121, 10238, 11006, 10017, 8206, 7045, 6610, 5696, 3844, 1885, 511, -235, -150, 1073, 2836, 3905, 4017, 4255, 5490, 7213, 8434, 8992, 9322, 9608, 9907, 10413, 10919, 10740, 9756, 8655, 7760, 6640, 5244, 4340, 4401, 4912, 5261, 5634, 6529, 7878, 9193, 10250, 10981, 11115, 10583, 9867, 9261, 8388, 7119, 6166, 5992, 6060, 5798, 5424, 5264, 5119, 4778, 4406, 4078, 3493, 2519, 1597, 1289, 1609, 2046, 2293, 2665, 3519, 4491, 4786, 4201, 3281, 2416, 1362, -137, -1801, -3213, -4331, -5274, -5934, -6130, -5974, -5723, -5411, -4932, -4431, -4184, -4152, -4070, -3927, -3987, -4335, -4805, -5291, -5830, -6499, -7370, -8475, -9638, -10590, -11258, -11780, -12184, -12297, -11993, -11340, -10462, -9442, -8453, -7783, -7594, -7710, -7883, -8170, -8855, -9986, -11204, -12107, -12610, -12840, -12829, -12569, -12194, -11879, -11587, -11114, -10413, -9715, -9302, -9269, -9411, -9377, -9000, -8506, -8322, -8586, -9010, -9256, -9322, -9442, -9680, -9903, -10027, -10026, -9804, -9327, -8812, -8429, -8047, -7522, -7026, -6757, -6629, -6493, -6398, -6384, -6336, -6202, -6108, -6128, -6122, -6002, -5915, -6029, -6217, -6186, -5893, -5644, -5671, -5778, -5570, -4951, -4184, -3510, -2985, -2649, -2502, -2368, -2141, -2039, -2275, -2671, -2978, -3257, -3561, -3660, -3450, -3184, -3014, -2736, -2238, -1721, -1312, -878, -359, 36, 139, 79, 92, 203, 243, 103, -181, -538, -879, -1090, -1150, -1190, -1304, -1327, -999, -325, 388, 881, 1176, 1450, 1758, 1980, 1961, 1645, 1073, 381, -162, -341, -320, -491, -830, -883, -542, -215, -26, 351, 871, 1044, 845, 773, 924, 935, 778, 766, 813, 543, 63, -106, 87, 93, -378, -889, -945, -687, -516, -437, -207, 145, 431, 690, 1039, 1318, 1298, 1112, 1086, 1184, 997, 396, -136, -94, 345, 579, 466, 473, 870, 1296, 1391, 1343, 1454, 1613, 1607, 1568, 1702, 1872, 1889, 1980, 2427, 2897, 2780, 2219, 2107, 2833, 3675, 3746, 3019, 2145, 1738, 2053, 2888, 3599, 3593, 3050, 2830, 3502, 4678, 5525, 5668, 5371, 4990, 4689, 4635, 4982, 5462, 5420, 4676, 3972, 4055, 4646, 4981, 4967, 5042, 5189, 5061, 4852, 5198, 6203, 7193, 7475, 7022, 6472, 6478, 6940, 7106, 6528, 5580, 4838, 4484, 4517, 4964, 5562, 5776, 5538, 5489, 6164, 7199, 7718, 7353, 6572, 6023, 5838, 5721, 5512, 5321, 5150, 4819, 4371, 4241, 4698, 5397, 5746, 5546, 5071, 4683, 4561, 4666, 4799, 4735, 4411, 4008, 3819, 4028, 4492, 4764, 4475, 3738, 3088, 2950, 3218, 3414, 3221, 2769, 2416, 2378, 2613, 2949, 3239, 3383, 3306, 2985, 2553, 2276, 2270, 2296, 2030, 1547, 1301, 1539, 1978, 2210, 2212, 2199, 2152, 1892, 1547, 1457, 1559, 1343, 633, -8, 40, 668, 1240, 1400, 1340, 1360, 1507, 1674, 1754, 1603, 1100, 366, -270, -577, -587, -463, -342, -279, -209, -18, 301, 625, 845, 903, 691, 153, -522, -955, -937, -684, -644, -1013, -1400, -1224, -518, 15, -63, -438, -711, -995, -1431, -1712, -1584, -1376, -1507, -1788, -1704, -1204, -738, -596, -680, -901, -1272, -1607, -1674, -1662, -1929, -2332, -2425, -2200, -2001, -1855, -1536, -1172, -1159, -1511, -1776, -1703, -1608, -1892, -2450, -2809, -2724, -2387, -2073, -1848, -1660, -1499, -1344, -1141, -960, -1009, -1361, -1762, -1916, -1883, -2003, -2379, -2669, -2467, -1835, -1269, -1138, -1264, -1186, -772, -412, -522, -985, -1280, -1158, -909, -867, -934, -860, -707, -664, -609, -263, 273, 557, 384, 42, -117, -108, -142, -223, -145, 84, 139, -102, -257, -23, 285, 304, 254, 415, 481, 160, -161, -55, 249, 378, 362, 323, 234, 201, 334, 392, 152, -67, 81, 282, -11, -633, -880, -555, -231, -343, -560, -356, 166, 484, 450, 394, 471, 446, 176, -90, -114, -46, -179, -493, -710, -723, -678, -624, -419, -78, 119, 86, 124, 434, 799, 998, 1120, 1166, 890, 319, -54, 3, 65, -308, -876, -1051, -715, -295, -166, -278, -385, -380, -286, -154, -103, -329, -822, -1273, -1531, -1934, -2722, -3395, -3298, -2728, -2622, -3099, -3077, -1732, 332, 1817, 2243, 2185, 2261, 2435, 2300, 1517, 20, -1777, -3132, -3705, -3852, -3879, -3504, -2468, -1082, 304, 1826, 3597, 5104, 5606, 5011, 4070, 3608, 3571, 3099, 1782, 450, 158, 806, 1522, 2007, 2582, 3259, 3707, 3972, 4446, 5208, 5862, 5985, 5592, 5290, 5732, 6708, 7267, 7024, 6607, 6506, 6380, 5911, 5403, 5080, 4701, 4252, 4253, 5008, 6102, 6929, 7354, 7639, 7989, 8321, 8434, 8245, 7747, 6895, 5769, 4820, 4530, 4768, 4944, 4806, 4669, 4765, 4975, 5132, 5104, 4675, 3849, 3066, 2690, 2548, 2351, 2140, 2084, 2220, 2521, 2883, 3023, 2757, 2268, 1760, 1110, 138, -972, -1869, -2485, -3013, -3514, -3790, -3707, -3375, -3004, -2746, -2716, -2917, -3126, -3147, -3166, -3500, -4122, -4739, -5235, -5664, -6014, -6267, -6624, -7280, -8082, -8675, -8944, -9037, -8997, -8731, -8322, -8050, -7923, -7592, -6939, -6397, -6427, -6976, -7682, -8392, -9141, -9812, -10242, -10546, -10932, -11210, -10980, -10295, -9631, -9194, -8771, -8275, -7949, -7903, -7906, -7779, -7680, -7824, -8129, -8379, -8532, -8665, -8772, -8812, -8805, -8733, -8521, -8269, -8173, -8154, -7915, -7409, -6908, -6574, -6330, -6141, -6063, -6040, -5914, -5712, -5656, -5822, -6021, -6091, -6121, -6217, -6283, -6219, -6102, -5993, -5795, -5480, -5196, -4993, -4706, -4252, -3795, -3522, -3388, -3250, -3096, -3028, -3088, -3232, -3435, -3686, -3901, -3976, -3896, -3712, -3460, -3189, -2953, -2726, -2394, -1937, -1508, -1253, -1148, -1090, -1064, -1071, -1012, -821, -666, -768, -1040, -1164, -1025, -845, -845, -993, -1119, -1089, -819, -305, 266, 623, 756, 959, 1366, 1707, 1715, 1512, 1316, 1031, 492, -58, -174, 112, 293, 158, 98, 410, 885, 1303, 1736, 2083, 2018, 1659, 1532, 1719, 1779, 1583, 1433, 1400, 1235, 970, 917, 1057, 1023, 756, 674, 957, 1171, 947, 637, 790, 1263, 1453, 1281, 1287, 1678, 1944, 1661, 1209, 1218, 1618, 1725, 1266, 740, 637, 784, 816, 818, 1039, 1323, 1405, 1414, 1572, 1767, 1874, 2026, 2193, 2044, 1594, 1406, 1763, 2161, 2063, 1693, 1632, 1916, 2099, 2068, 2139, 2385, 2492, 2320, 2069, 1893, 1833, 2051, 2632, 3201, 3244, 2789, 2403, 2503, 2970, 3427, 3600, 3348, 2783, 2383, 2578, 3101, 3216, 2770, 2472, 2836, 3408, 3535, 3456, 3833, 4492, 4657, 4331, 4201, 4265, 3921, 3337, 3247, 3464, 3156, 2467, 2425, 3265, 4164, 4630, 5021, 5584, 5918, 5742, 5458, 5503, 5616, 5302, 4633, 4043, 3649, 3351, 3397, 4073, 4956, 5194, 4737, 4550, 5250, 6218, 6502, 6016, 5325, 4812, 4571, 4636, 4844, 4816, 4411, 4009, 4064, 4550, 4977, 4928, 4460, 3984, 3832, 3974, 4108, 4018, 3816, 3742, 3805, 3845, 3900, 4121, 4328, 4130, 3525, 2951, 2684, 2583, 2448, 2264, 2059, 1812, 1607, 1650, 2039, 2557, 2776, 2453, 1835, 1445, 1507, 1692, 1539, 1004, 456, 258, 436, 706, 800, 737, 696, 647, 422, 116, -8, -23, -246, -638, -825, -724, -590, -496, -283, 23, 215, 238, 194, 71, -237, -676, -1038, -1230, -1351, -1478, -1575, -1626, -1625, -1422, -899, -297, -26, -126, -277, -307, -341, -487, -726, -1074, -1548, -1932, -1916, -1527, -1147, -975, -785, -411, -124, -220, -507, -571, -405, -360, -564, -769, -792, -699, -487, -51, 396, 436, 124, -27, 96, 65, -266, -526, -541, -579, -740, -718, -392, -75, 38, 209, 597, 811, 527, 114, 72, 232, 130, -221, -503, -628, -628, -449, -209, -212, -437, -489, -243, -73, -266, -566, -540, -135, 327, 608, 756, 879, 943, 952, 1056, 1211, 964, 23, -1131, -1739, -1765, -1798, -2035, -2038, -1561, -954, -526, -61, 691, 1465, 1783, 1579, 1121, 551, -93, -625, -916, -1234, -1844, -2438, -2414, -1732, -994, -652, -565, -454, -378, -480, -605, -531, -372, -398, -578, -640, -512, -397, -393, -381, -347, -462, -732, -943, -1067, -1266, -1442, -1333, -1045, -825, -529, 27, 506, 549, 454, 604, 704, 288, -432, -907, -1111, -1408, -1774, -1823, -1568, -1418, -1340, -796, 233, 973, 970, 755, 946, 1341, 1401, 1140, 985, 997, 804, 260, -257, -349, -73, 201, 193, -89, -358, -257, 259, 833, 1089, 1003, 788, 715, 1015, 1661, 2210, 2163, 1510, 751, 448, 794, 1395, 1505, 807, -92, -327, 229, 985, 1476, 1680, 1658, 1432, 1243, 1417, 1798, 1783, 1187, 579, 420, 404, 153, -56, 153, 571, 803, 873, 953, 973, 854, 699, 531, 186, -421, -1171, -1895, -2477, -2803, -2772, -2372, -1725, -1017, -333, 428, 1437, 2647, 3641, 3858, 3066, 1585, 17, -1168, -1834, -2183, -2668, -3562, -4427, -4237, -2437, 174, 2103, 2830, 3189, 3855, 4340, 4061, 3385, 2801, 2064, 982, 135, -37, 60, 33, 230, 994, 1926, 2508, 2876, 3364, 3715, 3481, 2976, 3031, 3749, 4293, 4137, 3817, 4025, 4542, 4697, 4441, 4196, 3937, 3337, 2652, 2503, 2880, 3206, 3286, 3379, 3602, 3974, 4636, 5440, 5793, 5374, 4588, 4006, 3783, 3788, 3830, 3728, 3443, 3166, 3072, 3087, 3024, 2791, 2423, 2010, 1614, 1182, 707, 445, 679, 1281, 1824, 2176, 2544, 2925, 2989, 2603, 2033, 1469, 735, -336, -1508, -2401, -2955, -3351, -3587, -3446, -2940, -2451, -2228, -2042, -1624, -1253, -1392, -1930, -2347, -2517, -2798, -3351, -3961, -4480, -4972, -5414, -5699, -5953, -6414, -6979, -7238, -7083, -6885, -6871, -6762, -6319, -5772, -5388, -5097, -4855, -4921, -5417, -6103, -6779, -7500, -8248, -8796, -9076, -9274, -9467, -9429, -8982, -8318, -7807, -7557, -7372, -7132, -6983, -7013, -7019, -6871, -6870, -7215, -7496, -7353, -7195, -7496, -7917, -8003, -8063, -8444, -8676, -8298, -7735, -7558, -7551, -7222, -6629, -6157, -5924, -5806, -5723, -5688, -5685, -5673, -5655, -5697, -5844, -6011, -6098, -6170, -6335, -6474, -6343, -5988, -5761, -5804, -5809, -5405, -4603, -3760, -3257, -3188, -3235, -3004, -2543, -2372, -2818, -3589, -4134, -4249, -4153, -4120, -4218, -4358, -4330, -3903, -3100, -2348, -2002, -1830, -1378, -739, -448, -677, -1009, -1036, -796, -657, -925, -1478, -1788, -1585, -1294, -1440, -1851, -1964, -1637, -1177, -780, -400, 27, 545, 1141, 1614, 1693, 1408, 1099, 965, 828, 384, -413, -1212, -1508, -1153, -535, -126, -1, 83, 354, 929, 1687, 2134, 1877, 1278, 1066, 1310, 1454, 1246, 947, 701, 402, 114, 50, 209, 424, 614, 741, 730, 640, 729, 1151, 1700, 2007, 1942, 1748, 1738, 1942, 2125, 2144, 2048, 1833, 1427, 1044, 1026, 1252, 1268, 1094, 1162, 1485, 1686, 1812, 2211, 2728, 2895, 2782, 2839, 3064, 3092, 2964, 3057, 3310, 3201, 2638, 2242, 2449, 2863, 2924, 2728, 2666, 2673, 2457, 2222, 2455, 3068, 3432, 3381, 3468, 3999, 4559, 4789, 4946, 5248, 5373, 5075, 4692, 4526, 4224, 3397, 2489, 2282, 2718, 3001, 2869, 2950, 3685, 4675, 5406, 5937, 6493, 6908, 6892, 6522, 6071, 5553, 4797, 3877, 3079, 2526, 2181, 2171, 2702, 3576, 4240, 4442, 4563, 5052, 5780, 6231, 6142, 5665, 5082, 4626, 4404, 4260, 3881, 3270, 2849, 2896, 3129, 3116, 2856, 2683, 2745, 2896, 3041, 3252, 3491, 3600, 3577, 3600, 3677, 3595, 3296, 2967, 2659, 2136, 1350, 732, 681, 975, 1097, 982, 1009, 1338, 1756, 2102, 2387, 2476, 2118, 1396, 784, 564, 488, 230, -115, -237, -140, -104, -127, 134, 715, 1060, 750, 132, -199, -219, -247, -322, -360, -532, -892, -1014, -542, 204, 613, 484, 66, -327, -536, -604, -697, -890, -1116, -1278, -1280, -1024, -602, -312, -253, -159, 72, 113, -214, -532, -507, -438, -735, -1144, -1087, -576, -216, -280, -383, -216, -25, -68, -143, -31, -8, -386, -854, -817, -319, 21, -17, -24, 230, 479, 566, 645, 665, 409, 22, -175, -268, -490, -625, -348, 79, 152, 6, 272, 1037, 1608, 1499, 1026, 642, 351, 113, 154, 390, 249, -403, -766, -205, 703, 930, 477, 277, 688, 1007, 673, 176, 221, 585, 572, 260, 362, 948, 1303, 1149, 960, 889, 505, -120, -253, 237, 528, 170, -205, 84, 826, 1460, 1917, 2334, 2427, 1872, 1036, 608, 616, 477, -80, -755, -1170, -1108, -456, 588, 1420, 1623, 1555, 1886, 2608, 2942, 2326, 1144, 204, -226, -498, -805, -919, -765, -591, -342, 352, 1251, 1599, 1426, 1530, 1922, 1732, 888, 314, 298, 192, -180, -281, -26, 46, -178, -207, 174, 530, 444, 134, 136, 506, 677, 326, 3, 372, 1098, 1245, 653, 127, 219, 577, 619, 220, -334, -694, -676, -413, -167, 34, 301, 520, 511, 407, 435, 495, 365, 115, -40, -63, 1, 157, 413, 804, 1305, 1566, 1207, 571, 448, 794, 671, -261, -1150, -1251, -868, -572, -329, 52, 329, 355, 640, 1530, 2277, 1925, 843, 260, 412, 346, -401, -1147, -1355, -1505, -2078, -2603, -2443, -1907, -1698, -1734, -1473, -995, -756, -578, 103, 1133, 1675, 1392, 808, 409, 25, -654, -1518, -2304, -2986, -3501, -3543, -3012, -2285, -1679, -1001, 15, 1162, 1958, 2193, 2010, 1622, 1162, 731, 324, -194, -825, -1239, -1178, -827, -489, -155, 265, 621, 824, 1115, 1642, 2094, 2124, 1844, 1678, 1893, 2374, 2756, 2807, 2671, 2607, 2593, 2488, 2369, 2313, 2117, 1714, 1541, 1938, 2533, 2798, 2830, 3094, 3673, 4218, 4433, 4317, 4090, 3977, 3985, 3968, 3916, 3925, 3905, 3752, 3657, 3751, 3699, 3240, 2741, 2594, 2550, 2271, 2027, 2194, 2602, 2907, 3156, 3564, 4107, 4551, 4648, 4274, 3580, 2894, 2335, 1759, 1113, 575, 240, -9, -225, -231, 77, 512, 837, 1093, 1358, 1420, 1075, 610, 461, 535, 355, -213, -839, -1248, -1466, -1622, -1817, -2131, -2538, -2886, -3057, -3106, -3131, -3113, -2977, -2773, -2628, -2545, -2437, -2336, -2416, -2763, -3308, -3946, -4570, -5038, -5295, -5472, -5720, -5941, -5895, -5561, -5246, -5209, -5353, -5399, -5265, -5138, -5191, -5407, -5670, -5891, -5991, -5921, -5778, -5800, -6105, -6523, -6800, -6877, -6892, -6998, -7233, -7435, -7367, -7020, -6715, -6702, -6821, -6747, -6475, -6280, -6308, -6445, -6548, -6632, -6740, -6845, -6923, -7046, -7256, -7450, -7503, -7437, -7374, -7336, -7245, -7118, -7060, -7014, -6739, -6162, -5566, -5280, -5348, -5584, -5798, -5858, -5763, -5734, -6027, -6561, -6894, -6735, -6309, -6043, -6019, -5930, -5573, -5109, -4751, -4439, -4046, -3740, -3766, -3951, -3892, -3572, -3380, -3467, -3645, -3814, -4015, -4134, -4023, -3854, -3859, -3914, -3713, -3204, -2601, -2113, -1818, -1645, -1419, -1068, -792, -885, -1346, -1816, -1988, -1914, -1824, -1809, -1860, -1960, -1934, -1510, -792, -323, -384, -576, -434, -66, 114, 24, -65, 14, 163, 241, 254, 259, 278, 317, 354, 290, 119, 63, 284, 592, 673, 511, 366, 447, 788, 1263, 1655, 1826, 1831, 1746, 1581, 1489, 1675, 1956, 1867, 1395, 1097, 1307, 1736, 1988, 2018, 1949, 1860, 1876, 2133, 2511, 2668, 2523, 2424, 2678, 3095, 3285, 3199, 3090, 3117, 3241, 3368, 3337, 3003, 2514, 2295, 2550, 2968, 3120, 2989, 2891, 3016, 3296, 3619, 3869, 3833, 3447, 3059, 3079, 3404, 3559, 3420, 3332, 3488, 3643, 3624, 3698, 4077, 4423, 4319, 3908, 3558, 3260, 2897, 2665, 2745, 2941, 3080, 3292, 3654, 4006, 4260, 4480, 4622, 4600, 4470, 4265, 3852, 3266, 2898, 3021, 3315, 3242, 2788, 2541, 2935, 3664, 4034, 3802, 3393, 3295, 3501, 3698, 3732, 3651, 3495, 3316, 3233, 3244, 3156, 2886, 2608, 2466, 2352, 2163, 2042, 2181, 2506, 2715, 2600, 2307, 2190, 2392, 2644, 2586, 2184, 1707, 1431, 1510, 1901, 2277, 2217, 1716, 1299, 1408, 1848, 2017, 1607, 863, 231, -44, 9, 219, 367, 348, 292, 381, 623, 928, 1281, 1586, 1578, 1167, 668, 383, 217, -44, -376, -649, -893, -1151, -1243, -954, -386, 38, 34, -206, -214, 203, 724, 876, 558, 96, -125, -35, 101, -33, -490, -994, -1227, -1160, -1031, -1018, -1019, -839, -512, -253, -132, -41, 67, 167, 293, 386, 207, -216, -416, -192, -42, -356, -742, -690, -359, -187, -196, -156, -50, 12, 75, 212, 298, 190, 9, -24, 26, -58, -216, -163, 158, 551, 853, 965, 825, 595, 568, 706, 681, 443, 279, 288, 288, 246, 328, 547, 731, 758, 654, 568, 702, 1063, 1338, 1251, 914, 623, 484, 436, 473, 559, 476, 96, -232, -8, 622, 996, 972, 1063, 1358, 1336, 1000, 1020, 1437, 1441, 749, 51, -167, -200, -309, -270, 49, 342, 316, 145, 237, 671, 1058, 1025, 704, 519, 575, 575, 331, 45, -43, 7, 26, 21, 115, 311, 471, 473, 355, 253, 225, 211, 233, 392, 532, 316, -136, -226, 185, 446, 144, -209, -18, 535, 939, 1119, 1271, 1316, 1082, 754, 680, 783, 653, 213, -159, -235, -190, -174, -60, 275, 761, 1223, 1479, 1478, 1433, 1565, 1693, 1446, 869, 398, 229, 126, -62, -115, 125, 396, 431, 453, 850, 1496, 1867, 1795, 1646, 1703, 1774, 1599, 1300, 1146, 1119, 969, 633, 324, 263, 469, 812, 1086, 1131, 1024, 1074, 1465, 2000, 2321, 2300, 2096, 1875, 1658, 1433, 1177, 818, 386, 147, 288, 554, 574, 445, 576, 1007, 1357, 1477, 1648, 2024, 2262, 2007, 1448, 1054, 910, 713, 314, -68, -197, -89, 97, 249, 355, 453, 541, 572, 570, 666, 888, 991, 744, 342, 287, 737, 1176, 973, 212, -348, -238, 93, -110, -877, -1522, -1627, -1445, -1287, -1076, -712, -380, -271, -304, -280, -144, -85, -391, -1042, -1592, -1774, -1902, -2208, -2278, -1821, -1362, -1384, -1392, -688, 417, 954, 507, -420, -1035, -993, -685, -759, -1265, -1543, -1154, -470, -49, 157, 499, 838, 698, 140, -135, 191, 507, 155, -503, -535, 256, 1072, 1265, 1145, 1313, 1720, 1886, 1695, 1464, 1433, 1524, 1468, 1090, 654, 715, 1312, 1772, 1727, 1660, 1953, 2223, 2159, 2153, 2469, 2582, 2086, 1604, 1927, 2691, 2850, 2309, 2043, 2498, 2931, 2708, 2247, 2137, 2145, 1787, 1281, 1227, 1636, 1964, 1992, 2058, 2367, 2610, 2504, 2255, 2185, 2211, 2005, 1501, 999, 809, 898, 968, 830, 633, 635, 872, 1139, 1235, 1122, 878, 592, 320, 64, -197, -451, -621, -648, -587, -553, -595, -669, -737, -785, -814, -886, -1157, -1682, -2199, -2327, -2065, -1887, -2129, -2474, -2398, -1987, -1840, -2189, -2623, -2782, -2839, -3103, -3512, -3766, -3737, -3575, -3462, -3382, -3207, -3017, -3079, -3414, -3688, -3720, -3819, -4274, -4819, -4984, -4795, -4692, -4786, -4664, -4095, -3498, -3420, -3779, -4024, -3927, -3844, -4171, -4832, -5400, -5577, -5416, -5144, -4881, -4653, -4527, -4551, -4567, -4373, -4071, -3973, -4169, -4430, -4578, -4695, -4842, -4871, -4700, -4527, -4562, -4664, -4591, -4430, -4436, -4584, -4624, -4531, -4484, -4495, -4427, -4353, -4482, -4688, -4568, -4127, -3931, -4246, -4555, -4330, -3862, -3763, -4013, -4121, -3968, -3890, -3986, -3977, -3796, -3767, -3954, -3959, -3642, -3449, -3646, -3873, -3790, -3576, -3505, -3549, -3581, -3524, -3306, -3020, -2916, -2998, -2987, -2833, -2756, -2756, -2656, -2560, -2708, -2964, -3003, -2820, -2639, -2492, -2263, -1975, -1758, -1661, -1649, -1703, -1775, -1751, -1634, -1645, -1904, -2137, -2032, -1738, -1562, -1429, -1136, -869, -879, -962, -828, -615, -609, -802, -1042, -1234, -1278, -1144, -968, -796, -465, -22, 169, 37, -3, 271, 538, 455, 123, -161, -235, -122, 45, 138, 212, 358, 497, 591, 835, 1243, 1377, 994, 566, 611, 926, 1025, 928, 979, 1212, 1384, 1468, 1647, 1903, 2004, 1930, 1925, 2047, 2095, 2035, 2056, 2169, 2221, 2274, 2492, 2775, 2929, 2974, 2932, 2669, 2243, 1995, 2058, 2199, 2271, 2409, 2741, 3190, 3596, 3797, 3767, 3726, 3889, 4059, 3802, 3098, 2474, 2386, 2730, 3063, 3137, 3089, 3199, 3544, 3935, 4160, 4166, 3973, 3615, 3252, 3129, 3278, 3420, 3337, 3167, 3182, 3405, 3640, 3775, 3818, 3706, 3343, 2878, 2667, 2796, 2896, 2629, 2185, 2047, 2366, 2846, 3185, 3369, 3449, 3318, 2895, 2434, 2281, 2305, 2002, 1352, 1012, 1351, 1874, 2056, 2104, 2376, 2616, 2424, 2044, 1981, 2105, 1820, 1039, 353, 137, 144, 153, 369, 882, 1323, 1422, 1432, 1626, 1821, 1688, 1253, 802, 501, 260, -37, -281, -248, 25, 234, 246, 300, 545, 717, 539, 168, -62, -116, -193, -335, -365, -148, 208, 459, 530, 637, 884, 944, 562, 112, 48, 124, -115, -454, -413, -153, -94, -92, 255, 809, 1080, 897, 511, 246, 233, 281, 123, -116, -85, 180, 392, 713, 1492, 2352, 2488, 1899, 1399, 1371, 1337, 853, 160, -252, -240, 15, 372, 844, 1401, 1829, 1963, 1929, 1954, 1949, 1606, 922, 319, 124, 200, 233, 180, 293, 768, 1463, 2003, 2209, 2272, 2371, 2294, 1729, 830, 109, -209, -381, -600, -638, -277, 244, 624, 1036, 1745, 2473, 2772, 2703, 2563, 2285, 1735, 1157, 790, 461, 46, -142, 160, 679, 993, 1096, 1297, 1714, 2170, 2472, 2590, 2551, 2347, 2038, 1774, 1622, 1488, 1325, 1269, 1380, 1437, 1280, 1186, 1458, 1858, 1926, 1710, 1618, 1748, 1871, 1864, 1737, 1496, 1300, 1425, 1850, 2237, 2391, 2386, 2247, 1951, 1703, 1782, 2029, 1909, 1227, 509, 368, 718, 949, 815, 723, 1052, 1583, 1906, 2050, 2257, 2412, 2199, 1739, 1515, 1659, 1770, 1526, 1087, 738, 517, 422, 597, 948, 991, 533, 164, 500, 1307, 1913, 2071, 1965, 1744, 1522, 1458, 1484, 1291, 771, 186, -200, -361, -340, -132, 148, 266, 195, 275, 764, 1390, 1623, 1357, 955, 673, 390, -18, -401, -600, -758, -1100, -1449, -1278, -471, 276, 281, -120, -136, 192, 168, -290, -644, -838, -1257, -1763, -1799, -1370, -1016, -989, -1126, -1286, -1420, -1455, -1418, -1503, -1792, -2116, -2272, -2258, -2204, -2184, -2179, -2172, -2199, -2279, -2353, -2351, -2287, -2194, -2049, -1872, -1803, -1928, -2087, -2080, -1969, -1943, -2031, -2158, -2311, -2404, -2289, -2071, -2047, -2189, -2079, -1604, -1264, -1448, -1775, -1631, -1138, -965, -1274, -1568, -1576, -1564, -1645, -1541, -1217, -1073, -1286, -1496, -1370, -1047, -828, -771, -766, -817, -981, -1136, -1055, -744, -501, -518, -653, -726, -765, -796, -649, -353, -339, -809, -1213, -925, -193, 188, -30, -352, -332, -101, 1, -97, -255, -397, -520, -527, -319, -22, 74, -107, -308, -261, -31, 104, 32, -101, -137, -94, -49, 37, 230, 436, 463, 300, 179, 265, 391, 260, -131, -493, -631, -659, -698, -611, -239, 206, 331, 167, 208, 673, 1095, 926, 229, -477, -840, -896, -891, -993, -1100, -965, -571, -178, 94, 370, 627, 641, 398, 134, -78, -391, -791, -1048, -1091, -1097, -1115, -938, -491, -60, 88, 64, 84, 78, -101, -370, -596, -846, -1126, -1168, -816, -346, -120, -105, 0, 294, 512, 330, -215, -726, -945, -1068, -1339, -1610, -1624, -1430, -1147, -736, -333, -241, -316, -88, 327, 271, -347, -894, -1036, -1085, -1297, -1567, -1814, -2045, -2087, -1754, -1251, -1021, -1144, -1248, -1121, -1004, -1124, -1361, -1567, -1802, -2019, -2042, -1953, -2006, -2134, -2099, -2017, -2160, -2402, -2399, -2143, -1914, -1896, -2078, -2310, -2350, -2091, -1770, -1727, -2031, -2487, -2826, -2823, -2507, -2257, -2335, -2483, -2384, -2170, -2062, -1917, -1649, -1579, -1883, -2231, -2349, -2423, -2640, -2864, -2966, -3007, -2996, -2809, -2406, -1896, -1445, -1211, -1255, -1451, -1607, -1724, -1989, -2506, -3132, -3593, -3709, -3502, -3147, -2814, -2554, -2337, -2129, -1921, -1746, -1685, -1793, -1974, -2054, -2025, -2052, -2210, -2361, -2327, -2097, -1831, -1709, -1759, -1823, -1765, -1695, -1783, -1947, -1947, -1755, -1574, -1470, -1287, -950, -648, -549, -578, -608, -705, -947, -1158, -1128, -989, -1042, -1304, -1486, -1366, -987, -570, -349, -411, -569, -507, -136, 294, 506, 535, 613, 792, 900, 840, 706, 578, 402, 126, -205, -499, -628, -487, -156, 118, 214, 333, 751, 1446, 2093, 2410, 2403, 2245, 2039, 1784, 1492, 1203, 908, 571, 271, 203, 450, 855, 1185, 1380, 1548, 1770, 2014, 2216, 2350, 2416, 2415, 2345, 2222, 2099, 2024, 1976, 1888, 1718, 1491, 1278, 1182, 1281, 1530, 1756, 1858, 1920, 2064, 2298, 2568, 2805, 2914, 2862, 2758, 2716, 2665, 2469, 2175, 1939, 1772, 1558, 1307, 1209, 1379, 1681, 1891, 1968, 2040, 2218, 2501, 2797, 2950, 2827, 2492, 2195, 2119, 2171, 2099, 1778, 1341, 1051, 1034, 1145, 1178, 1132, 1179, 1404, 1694, 1917, 2076, 2226, 2351, 2360, 2212, 1988, 1813, 1721, 1604, 1352, 1028, 826, 851, 995, 1082, 1087, 1118, 1222, 1337, 1417, 1485, 1534, 1502, 1369, 1217, 1143, 1175, 1267, 1319, 1240, 1042, 866, 862, 1011, 1113, 994, 743, 660, 904, 1269, 1408, 1239, 999, 906, 922, 906, 850, 832, 829, 761, 692, 762, 914, 936, 783, 645, 664, 789, 907, 968, 978, 990, 1076, 1239, 1403, 1496, 1458, 1243, 939, 751, 747, 743, 589, 379, 284, 362, 597, 918, 1163, 1228, 1213, 1256, 1353, 1437, 1480, 1419, 1213, 985, 854, 737, 590, 629, 964, 1285, 1285, 1153, 1262, 1558, 1621, 1269, 757, 396, 245, 245, 382, 602, 782, 914, 1126, 1431, 1656, 1677, 1523, 1228, 811, 396, 144, 48, -41, -175, -227, -66, 279, 663, 958, 1120, 1171, 1164, 1149, 1130, 1087, 1021, 960, 885, 707, 390, 76, -79, -158, -320, -464, -396, -221, -117, 116, 697, 1312, 1544, 1545, 1656, 1754, 1569, 1227, 970, 701, 259, -178, -367, -372, -384, -327, -20, 408, 668, 790, 1020, 1293, 1293, 998, 674, 421, 191, 112, 316, 613, 710, 630, 637, 859, 1187, 1379, 1236, 790, 321, 83, 49, 10, -137, -279, -225, 93, 553, 978, 1329, 1661, 1909, 1909, 1658, 1344, 1089, 852, 570, 219, -201, -542, -545, -197, 155, 291, 419, 809, 1358, 1749, 1853, 1776, 1624, 1431, 1220, 1038, 882, 655, 272, -171, -468, -563, -597, -601, -405, 23, 469, 841, 1301, 1859, 2206, 2134, 1780, 1345, 890, 461, 134, -132, -452, -810, -1029, -944, -573, -102, 233, 342, 330, 370, 500, 609, 582, 429, 231, 19, -216, -445, -604, -664, -650, -634, -715, -929, -1123, -1070, -770, -522, -573, -780, -789, -504, -217, -193, -392, -634, -841, -1017, -1177, -1371, -1610, -1771, -1733, -1541, -1276, -916, -465, -85, 67, 4, -164, -331, -427, -501, -695, -1007, -1215, -1174, -1022, -975, -1038, -1062, -966, -776, -560, -374, -252, -196, -197, -246, -341, -455, -561, -669, -829, -1055, -1270, -1367, -1313, -1179, -1060, -995, -947, -857, -740, -667, -629, -536, -421, -455, -659, -823, -808, -728, -741, -847, -984, -1128, -1242, -1265, -1228, -1251, -1377, -1513, -1572, -1574, -1546, -1427, -1182, -898, -655, -424, -225, -153, -192, -244, -400, -850, -1483, -1947, -2115, -2185, -2288, -2312, -2145, -1829, -1448, -1037, -659, -397, -235, -55, 117, 42, -427, -1068, -1490, -1579, -1569, -1741, -2119, -2442, -2414, -2030, -1599, -1382, -1341, -1300, -1146, -836, -460, -264, -384, -604, -688, -766, -1077, -1511, -1787, -1894, -2023, -2185, -2206, -2010, -1696, -1366, -1052, -782, -580, -397, -205, -132, -303, -576, -719, -765, -898, -1090, -1192, -1236, -1320, -1381, -1326, -1222, -1137, -1017, -843, -699, -590, -419, -180, 4, 72, 83, 97, 64, -104, -400, -687, -866, -1029, -1313, -1615, -1649, -1346, -1009, -915, -921, -684, -181, 205, 193, -74, -312, -457, -608, -802, -1021, -1274, -1520, -1637, -1584, -1492, -1498, -1561, -1524, -1327, -1083, -932, -873, -783, -613, -460, -410, -417, -418, -489, -753, -1176, -1582, -1839, -1971, -2042, -2039, -1912, -1675, -1403, -1141, -887, -674, -578, -612, -670, -684, -737, -950, -1259, -1463, -1509, -1575, -1766, -1879, -1679, -1297, -1089, -1149, -1218, -1094, -882, -788, -860, -1002, -1090, -1090, -1084, -1151, -1263, -1352, -1422, -1479, -1460, -1372, -1337, -1383, -1374, -1232, -1069, -980, -946, -927, -908, -848, -745, -699, -781, -930, -1045, -1077, -1001, -859, -807, -927, -1078, -1127, -1133, -1153, -1077, -842, -604, -502, -447, -292, -54, 125, 144, 17, -130, -189, -197, -248, -306, -281, -225, -232, -234, -106, 101, 240, 271, 245, 195, 168, 211, 272, 263, 201, 165, 157, 163, 243, 425, 583, 588, 501, 487, 597, 712, 684, 498, 304, 269, 422, 627, 744, 753, 753, 855, 1038, 1139, 1047, 916, 999, 1253, 1358, 1188, 987, 995, 1116, 1128, 994, 841, 751, 744, 871, 1146, 1451, 1657, 1808, 1994, 2159, 2207, 2192, 2157, 1980, 1606, 1245, 1098, 1059, 928, 750, 718, 866, 1063, 1271, 1567, 1923, 2161, 2196, 2119, 2022, 1890, 1724, 1558, 1368, 1115, 897, 845, 930, 1016, 1072, 1196, 1415, 1623, 1708, 1680, 1608, 1510, 1360, 1174, 1022, 946, 928, 918, 889, 849, 841, 917, 1063, 1188, 1213, 1184, 1198, 1249, 1235, 1115, 968, 866, 814, 800, 829, 900, 983, 1046, 1057, 1010, 961, 1004, 1171, 1369, 1479, 1475, 1430, 1379, 1284, 1134, 974, 816, 615, 390, 266, 343, 557, 748, 827, 845, 900, 1028, 1185, 1312, 1349, 1239, 975, 677, 513, 521, 603, 691, 761, 725, 527, 329, 332, 488, 581, 524, 380, 207, 101, 193, 449, 649, 664, 609, 638, 776, 952, 1056, 968, 654, 245, -66, -175, -99, 46, 143, 193, 316, 595, 936, 1144, 1106, 872, 589, 394, 345, 397, 450, 425, 314, 155, 8, -68, -47, 10, -14, -149, -256, -196, -4, 188, 323, 438, 565, 707, 829, 830, 628, 298, 39, -50, -78, -170, -260, -187, 61, 321, 488, 612, 747, 820, 754, 608, 489, 397, 253, 78, 1, 80, 259, 457, 602, 612, 483, 359, 364, 438, 468, 453, 467, 530, 632, 788, 980, 1113, 1122, 1047, 949, 777, 454, 64, -204, -302, -327, -307, -122, 257, 630, 801, 846, 983, 1218, 1344, 1237, 1007, 794, 592, 361, 161, 51, -11, -64, -18, 165, 302, 213, 32, 42, 252, 403, 386, 377, 521, 720, 817, 791, 685, 470, 156, -125, -305, -468, -641, -679, -507, -243, 15, 292, 520, 546, 392, 257, 213, 128, -47, -178, -179, -180, -311, -481, -494, -344, -190, -118, -79, -60, -113, -190, -128, 67, 145, -36, -280, -369, -394, -521, -660, -651, -584, -636, -735, -669, -434, -217, -91, 42, 195, 205, 4, -242, -382, -477, -662, -931, -1184, -1325, -1293, -1100, -854, -660, -514, -374, -255, -200, -212, -281, -426, -643, -851, -950, -934, -873, -828, -809, -820, -872, -931, -923, -825, -700, -614, -550, -482, -437, -423, -348, -174, -38, -55, -112, -58, 17, -64, -252, -320, -239, -197, -283, -340, -274, -227, -286, -297, -137, 45, 97, 107, 191, 302, 387, 468, 503, 435, 351, 374, 442, 406, 253, 57, -130, -254, -271, -233, -183, -53, 212, 492, 624, 629, 628, 637, 569, 417, 288, 251, 246, 185, 64, -56, -136, -166, -166, -183, -241, -286, -268, -200, -92, 90, 307, 402, 319, 221, 260, 356, 323, 98, -228, -528, -720, -777, -701, -522, -331, -253, -273, -197, 78, 393, 525, 468, 318, 96, -170, -361, -440, -526, -676, -775, -731, -633, -563, -436, -190, -9, -99, -335, -421, -334, -308, -406, -484, -491, -488, -463, -400, -411, -553, -690, -687, -595, -516, -447, -359, -327, -419, -566, -625, -570, -509, -527, -602, -670, -702, -688, -638, -590, -570, -525, -393, -217, -130, -181, -280, -375, -525, -714, -820, -858, -995, -1229, -1348, -1290, -1221, -1180, -1023, -750, -564, -538, -527, -465, -488, -681, -923, -1069, -1148, -1260, -1375, -1418, -1421, -1453, -1470, -1400, -1283, -1205, -1146, -1024, -845, -705, -700, -831, -983, -1050, -1081, -1188, -1341, -1398, -1343, -1302, -1338, -1375, -1353, -1291, -1199, -1045, -846, -690, -625, -630, -686, -807, -987, -1160, -1281, -1367, -1408, -1353, -1225, -1127, -1101, -1084, -1026, -930, -785, -604, -485, -524, -689, -872, -1034, -1190, -1301, -1294, -1195, -1093, -972, -728, -400, -189, -169, -204, -214, -306, -528, -727, -779, -779, -855, -938, -885, -725, -587, -470, -268, -21, 97, 46, -48, -115, -206, -340, -449, -471, -397, -242, -50, 98, 142, 114, 98, 136, 196, 238, 244, 203, 140, 123, 158, 140, 25, -50, 12, 116, 154, 188, 290, 371, 347, 327, 445, 594, 577, 460, 483, 629, 629, 418, 253, 256, 246, 113, 2, 24, 70, 55, 76, 194, 307, 320, 313, 405, 550, 590, 497, 411, 411, 395, 269, 134, 128, 211, 258, 300, 407, 492, 445, 349, 336, 368, 364, 358, 377, 385, 422, 541, 634, 586, 494, 469, 417, 255, 132, 165, 217, 140, 25, 29, 121, 176, 182, 215, 287, 333, 344, 374, 431, 441, 375, 335, 396, 468, 410, 270, 221, 289, 308, 179, -22, -190, -283, -271, -154, -12, 87, 201, 396, 620, 762, 821, 877, 948, 953, 803, 524, 243, 62, -39, -136, -232, -257, -167, 12, 234, 463, 659, 799, 897, 974, 1029, 1046, 1020, 943, 813, 654, 501, 355, 211, 88, 15, 21, 122, 300, 475, 581, 652, 788, 998, 1169, 1207, 1158, 1109, 1051, 913, 700, 498, 347, 216, 110, 113, 272, 524, 750, 879, 937, 994, 1088, 1197, 1264, 1262, 1209, 1132, 1039, 916, 745, 550, 383, 296, 304, 372, 470, 586, 723, 859, 980, 1099, 1228, 1320, 1316, 1227, 1135, 1083, 1024, 900, 729, 586, 517, 509, 531, 564, 614, 698, 819, 943, 1015, 1038, 1077, 1151, 1185, 1102, 939, 795, 717, 673, 628, 597, 601, 646, 725, 834, 943, 1000, 994, 971, 992, 1061, 1137, 1174, 1152, 1085, 994, 891, 792, 724, 712, 753, 828, 914, 977, 982, 934, 883, 857, 830, 768, 694, 653, 655, 667, 667, 658, 638, 585, 494, 399, 342, 329, 352, 397, 445, 475, 484, 482, 480, 490, 500, 466, 374, 279, 232, 215, 196, 203, 249, 265, 187, 66, 13, 52, 109, 121, 98, 75, 63, 54, 50, 49, 34, 0, -40, -79, -135, -203, -245, -233, -190, -168, -175, -163, -99, 1, 90, 123, 81, -10, -102, -180, -274, -388, -475, -503, -490, -449, -371, -263, -156, -56, 49, 141, 167, 124, 77, 58, 7, -115, -244, -299, -319, -385, -486, -548, -546, -508, -449, -381, -315, -226, -89, 52, 129, 127, 73, -20, -139, -253, -357, -481, -613, -710, -750, -751, -705, -598, -467, -373, -327, -280, -202, -129, -117, -175, -251, -305, -354, -424, -495, -511, -475, -456, -502, -589, -668, -717, -742, -762, -778, -758, -663, -499, -330, -212, -150, -131, -163, -248, -348, -417, -465, -548, -653, -716, -706, -677, -677, -699, -714, -718, -710, -679, -617, -523, -422, -368, -381, -405, -389, -371, -418, -513, -588, -624, -656, -711, -778, -842, -879, -857, -762, -627, -506, -411, -323, -235, -175, -173, -229, -325, -444, -552, -622, -656, -690, -732, -743, -668, -507, -327, -209, -180, -193, -200, -192, -190, -196, -196, -183, -166, -155, -143, -117, -85, -69, -90, -126, -145, -142, -128, -104, -61, -16, 12, 47, 111, 177, 199, 183, 175, 179, 165, 123, 75, 29, -30, -88, -89, -27, 28, 36, 39, 83, 136, 150, 140, 149, 183, 218, 239, 244, 241, 239, 242, 239, 209, 163, 136, 142, 151, 125, 78, 47, 25, -2, -26, -18, 15, 53, 92, 142, 189, 198, 162, 124, 113, 118, 113, 99, 89, 75, 43, 0, -33, -50, -61, -55, -24, 17, 37, 32, 37, 67, 92, 78, 25, -43, -106, -162, -218, -277, -315, -303, -250, -191, -148, -116, -92, -82, -88, -111, -145, -187, -219, -237, -245, -254, -267, -286, -308, -328, -343, -353, -347, -322, -283, -242, -196, -149, -119, -126, -151, -162, -152, -146, -165, -199, -230, -248, -264, -279, -289, -282, -254, -210, -156, -97, -44, -18, -20, -35, -53, -71, -88, -112, -140, -161, -155, -124, -84, -51, -29, -10, 3, 7, 2, -2, -14, -37, -67, -88, -90, -81, -69, -60, -58, -66, -78, -80, -75, -72, -72, -65, -48, -31, -27, -25, -20, -21, -35, -48, -47, -36, -27, -26, -29, -35, -37, -29, -17, -10, -11, -14, -8, 11, 34, 41, 34, 20, 8, -5, -26, -41, -40, -33, -36, -48, -48, -24, 2, 13, 13, 16, 25, 28, 23, 10, -3, -14, -16, -12, -9, -7, -3, 0, 1, 2, 4, 6, 8, 12, 16, 14, 7, -1, -10, -13, -10, -2, 3, 7, 8, 11, 15, 19, 20, 16, 13, 12, 15, 19, 19, 19, 21, 23, 22, 19, 19, 22, 23, 20, 15, 14, 16, 21, 22, 20, 16, 15, 17, 21, 24, 25, 25, 25, 26, 29, 32, 30, 29, 28, 28, 27, 27, 28, 27, 25, 24, 24, 23, 23, 24, 27, 27, 27, 27, 28, 28, 28, 27, 27, 27, 26, 26, 25, 23, 21, 20, 21, 21, 21, 21, 21, 20, 19, 19, 19, 20, 20, 20, 19, 17, 16, 16, 15, 15, 15, 15, 14, 14, 13, 13, 14, 14, 14, 13, 13, 12, 12, 12, 12, 13, 13, 12, 12, 12, 11, 11, 11, 11, 10, 10, 10, 10, 9, 9, 10, 10, 9, 7, 6, 7, 8, 8, 7, 7, 8, 8, 8, 7, 7, 7, 7, 7, 7, 7, 7, 7, 6, 4, 4, 6, 7, 6, 6, 6, 6, 4, 3, 3, 3, 4, 6, 4, 2, 2, 4, 4, 3, 3, 3, 3, 3, 3, 3, 3, 3, 2, 2, 2, 2, 2, 3, 2, 1, 1, 2, 1, 0, 1, 4, 3, 1, 2, 3, 2, 0, 1, 2, 2, 2, 2, 2, 1, 1, 2, 3, 2, 1, 1, 2, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 1, 0, -1, -1, 0, 1, 0, 0, -1 };
+// IMA ADPCM blocks, see audio_adpcm.h
+static const uint8_t __in_flash("audio_fifty_sample_data") audio_fifty_sample_data[] = { 0, 0, 0, 0, 119, 207, 208, 26, 216, 80, 51, 34, 0, 17, 129, 255, 12, 34, 152, 57, 134, 221, 40, 130, 24, 1, 152, 170, 100, 130, 153, 187, 17, 189, 49, 128, 85, 160, 26, 3, 191, 48, 146, 12, 130, 141, 36, 8, 130, 219, 32, 146, 187, 48, 19, 16, 50, 162, 204, 137, 2, 251, 26, 248, 28, 55, 168, 153, 50, 177, 11, 232, 73, 163, 158, 32, 50, 177, 140, 145, 74, 38, 0, 152, 169, 221, 25, 144, 80, 131, 24, 178, 143, 1, 9, 35, 8, 18, 202, 0, 251, 41, 3, 156, 52, 251, 105, 146, 155, 1, 0, 18, 168, 25, 193, 43, 5, 172, 56, 22, 219, 65, 176, 9, 129, 169, 57, 38, 152, 136, 144, 154, 161, 207, 114, 146, 10, 130, 137, 168, 81, 209, 42, 3, 138, 137, 168, 58, 149, 29, 71, 185, 155, 32, 1, 56, 37, 169, 168, 220, 9, 36, 184, 105, 3, 153, 9, 168, 138, 19, 206, 97, 3, 137, 161, 175, 8, 24, 54, 169, 25, 185, 72, 4, 152, 218, 138, 34, 69, 144, 26, 178, 191, 16, 33, 21, 153, 136, 170, 171, 112, 20, 153, 1, 203, 140, 98, 146, 25, 192, 27, 20, 9, 18, 152, 219, 26, 131, 10, 36, 144, 189, 84, 201, 56, 131, 219, 10, 53, 153, 137, 138, 53, 233, 10, 19, 32, 22, 171, 136, 206, 65, 130, 137, 184, 42, 51, 16, 66, 131, 255, 41, 130, 140, 51, 160, 136, 137, 145, 191, 68, 128, 8, 169, 81, 162, 156, 17, 203, 41, 37, 1, 153, 137, 0, 203, 57, 134, 140, 52, 234, 24, 128, 33, 145, 16, 168, 205, 41, 53, 169, 24, 160, 48, 178, 157, 0, 16, 66, 177, 14, 23, 219, 56, 179, 142, 50, 145, 172, 49, 145, 43, 7, 187, 66, 168, 66, 217, 10, 129, 139, 100, 145, 171, 16, 16, 33, 0, 129, 206, 64, 147, 172, 17, 220, 72, 19, 153, 137, 66, 193, 27, 4, 138, 160, 139, 99, 177, 141, 36, 219, 56, 3, 185, 41, 35, 2, 203, 115, 241, 156, 50, 145, 41, 35, 185, 173, 16, 137, 67, 232, 57, 146, 138, 1, 16, 2, 136, 144, 26, 195, 191, 65, 160, 10, 68, 176, 58, 164, 42, 241, 13, 130, 138, 54, 161, 154, 137, 51, 186, 83, 235, 66, 219, 32, 8, 23, 173, 34, 169, 32, 18, 144, 171, 186, 72, 21, 1, 249, 28, 38, 168, 153, 9, 1, 169, 32, 53, 178, 175, 0, 136, 68, 160, 172, 50, 129, 16, 184, 171, 171, 113, 35, 18, 253, 10, 17, 34, 144, 41, 4, 221, 24, 2, 136, 145, 171, 68, 176, 156, 81, 131, 140, 51, 201, 9, 1, 235, 72, 131, 157, 33, 168, 0, 65, 147, 141, 19, 172, 16, 32, 162, 159, 129, 172, 49, 129, 115, 130, 201, 138, 128, 1, 115, 4, 188, 152, 27, 23, 170, 152, 113, 146, 26, 162, 139, 129, 137, 33, 162, 191, 40, 52, 200, 58, 38, 211, 4, 50, 0, 184, 41, 209, 142, 2, 56, 132, 11, 163, 143, 2, 10, 132, 156, 35, 188, 83, 145, 40, 0, 186, 171, 152, 172, 72, 37, 18, 160, 40, 147, 14, 38, 234, 24, 216, 42, 131, 10, 4, 138, 50, 17, 128, 64, 248, 143, 18, 0, 128, 233, 139, 68, 144, 40, 161, 155, 33, 20, 154, 130, 158, 177, 142, 4, 10, 18, 138, 53, 153, 84, 160, 171, 24, 192, 158, 17, 24, 51, 184, 96, 178, 141, 34, 152, 25, 136, 152, 67, 234, 24, 218, 16, 137, 87, 152, 136, 138, 131, 155, 38, 152, 24, 217, 25, 162, 142, 68, 145, 186, 10, 52, 185, 114, 178, 139, 18, 144, 204, 56, 161, 14, 35, 170, 66, 18, 17, 185, 16, 251, 12, 144, 10, 51, 9, 87, 168, 24, 160, 154, 204, 89, 36, 137, 128, 187, 40, 18, 66, 232, 140, 67, 161, 171, 50, 250, 25, 20, 1, 187, 72, 146, 169, 138, 87, 161, 187, 16, 128, 0, 155, 20, 173, 51, 10, 55, 152, 249, 43, 4, 8, 160, 41, 162, 140, 2, 56, 23, 186, 153, 82, 210, 142, 33, 144, 9, 17, 16, 36, 130, 235, 156, 16, 144, 9, 35, 32, 7, 203, 154, 98, 176, 43, 176, 102, 200, 57, 184, 80, 176, 25, 161, 32, 161, 105, 132, 188, 40, 18, 168, 10, 130, 187, 64, 19, 155, 119, 160, 10, 0, 67, 249, 141, 2, 24, 4, 136, 144, 173, 40, 20, 144, 8, 176, 27, 6, 171, 67, 233, 41, 0, 81, 161, 138, 160, 170, 98, 162, 138, 184, 112, 176, 58, 134, 25, 147, 140, 0, 140, 34, 202, 40, 201, 72, 36, 49, 147, 188, 185, 138, 51, 3, 237, 138, 16, 53, 187, 98, 144, 0, 137, 168, 113, 193, 139, 171, 70, 201, 64, 144, 33, 153, 160, 141, 18, 16, 192, 26, 161, 89, 148, 156, 67, 200, 57, 131, 42, 178, 157, 202, 58, 87, 184, 9, 129, 10, 67, 35, 201, 172, 137, 32, 129, 48, 178, 158, 49, 67, 249, 138, 130, 10, 53, 1, 193, 157, 34, 218, 41, 37, 201, 72, 131, 158, 32, 169, 0, 136, 69, 176, 10, 144, 11, 50, 50, 249, 11, 19, 8, 129, 41, 192, 28, 192, 88, 162, 24, 203, 97, 176, 26, 68, 1, 186, 139, 4, 239, 64, 130, 137, 17, 137, 128, 154, 34, 233, 27, 37, 184, 25, 2, 144, 140, 52, 201, 80, 176, 174, 64, 4, 170, 49, 168, 81, 232, 9, 2, 82, 200, 27, 208, 12, 51, 2, 168, 136, 0, 83, 145, 171, 185, 141, 2, 203, 115, 145, 40, 208, 10, 216, 120, 5, 154, 128, 153, 16, 145, 41, 148, 11, 146, 73, 162, 57, 248, 11, 136, 116, 161, 170, 24, 2, 25, 54, 186, 154, 170, 33, 96, 22, 219, 8, 0, 19, 187, 41, 1, 152, 173, 117, 145, 11, 130, 140, 130, 171, 9, 85, 160, 40, 1, 129, 189, 17, 64, 132, 189, 136, 8, 0, 35, 137, 39, 12, 8, 55, 0, 202, 24, 2, 168, 56, 240, 138, 1, 32, 144, 68, 252, 42, 37, 153, 136, 154, 99, 160, 25, 217, 26, 1, 34, 17, 2, 222, 40, 19, 17, 185, 137, 170, 40, 0, 128, 189, 204, 113, 7, 153, 137, 136, 24, 36, 217, 138, 0, 16, 50, 2, 9, 35, 251, 42, 195, 143, 50, 185, 139, 48, 39, 186, 41, 17, 37, 201, 170, 171, 67, 50, 21, 203, 8, 170, 83, 177, 10, 201, 112, 195, 44, 3, 56, 241, 11, 177, 73, 3, 56, 160, 170, 25, 5, 188, 32, 200, 80, 35, 176, 190, 16, 130, 168, 105, 21, 202, 153, 40, 20, 136, 128, 154, 17, 144, 82, 249, 156, 8, 99, 18, 129, 202, 152, 137, 147, 159, 2, 26, 53, 17, 185, 25, 201, 137, 26, 7, 171, 35, 138, 39, 168, 9, 51, 249, 155, 0, 136, 32, 129, 41, 87, 129, 170, 137, 40, 195, 191, 82, 128, 32, 192, 155, 136, 32, 3, 128, 186, 136, 113, 149, 96, 195, 158, 2, 136, 17, 186, 41, 23, 136, 1, 136, 248, 12, 2, 16, 130, 152, 155, 38, 169, 67, 203, 16, 186, 56, 19, 1, 170, 98, 2, 49, 240, 158, 8, 155, 100, 161, 10, 161, 40, 132, 136, 129, 169, 186, 88, 4, 153, 144, 156, 152, 89, 55, 184, 64, 224, 10, 147, 11, 131, 25, 146, 26, 160, 112, 149, 171, 82, 144, 80, 178, 142, 144, 170, 24, 35, 0, 36, 0, 217, 89, 161, 88, 224, 26, 192, 42, 132, 25, 161, 75, 23, 136, 8, 0, 234, 9, 160, 56, 1, 128, 16, 224, 73, 132, 137, 192, 26, 19, 50, 192, 173, 169, 137, 65, 35, 49, 6, 203, 33, 137, 37, 220, 32, 160, 41, 248, 42, 19, 17, 185, 113, 176, 12, 145, 11, 19, 100, 216, 41, 162, 28, 146, 28, 51, 201, 24, 129, 40, 5, 219, 153, 171, 115, 130, 8, 128, 136, 25, 39, 234, 10, 0, 17, 136, 51, 206, 32, 1, 19, 237, 40, 20, 202, 56, 3, 157, 16, 153, 49, 1, 249, 11, 36, 170, 84, 177, 10, 168, 26, 19, 137, 176, 120, 146, 42, 148, 157, 144, 40, 129, 113, 178, 143, 145, 56, 147, 41, 179, 141, 8, 67, 200, 138, 49, 210, 175, 66, 0, 16, 144, 170, 25, 22, 170, 50, 250, 73, 177, 26, 130, 8, 202, 32, 24, 55, 201, 0, 24, 162, 12, 146, 41, 212, 13, 21, 171, 33, 144, 17, 25, 131, 156, 201, 10, 33, 38, 0, 129, 24, 249, 89, 224, 42, 146, 24, 144, 98, 192, 155, 48, 3, 154, 168, 143, 38, 185, 68, 217, 9, 152, 17, 0, 18, 155, 1, 137, 52, 184, 57, 4, 41, 242, 140, 145, 90, 162, 75, 163, 28, 2, 56, 180, 142, 144, 11, 53, 19, 232, 138, 169, 56, 17, 36, 190, 48, 160, 115, 130, 188, 171, 17, 48, 71, 203, 16, 136, 4, 139, 2, 26, 132, 11, 216, 58, 147, 12, 192, 74, 6, 154, 4, 61, 0, 24, 177, 28, 147, 143, 50, 144, 25, 144, 188, 24, 36, 145, 188, 114, 160, 65, 162, 138, 185, 155, 88, 21, 188, 48, 162, 80, 161, 11, 217, 11, 35, 113, 4, 171, 137, 8, 161, 140, 68, 129, 138, 66, 224, 27, 192, 12, 21, 25, 20, 186, 40, 136, 0, 137, 241, 12, 35, 24, 21, 187, 136, 170, 48, 129, 65, 131, 138, 16, 129, 204, 49, 252, 56, 131, 49, 248, 175, 66, 128, 16, 161, 10, 176, 157, 82, 162, 11, 21, 172, 49, 2, 0, 171, 152, 174, 83, 144, 25, 33, 176, 159, 52, 168, 33, 205, 81, 128, 34, 221, 8, 185, 64, 36, 144, 152, 153, 16, 18, 144, 172, 186, 72, 179, 143, 38, 186, 82, 176, 25, 128, 99, 145, 202, 25, 192, 43, 147, 105, 162, 25, 168, 115, 168, 32, 201, 171, 112, 131, 154, 169, 57, 5, 56, 21, 235, 138, 128, 128, 65, 132, 173, 33, 160, 1, 173, 83, 152, 128, 9, 21, 170, 64, 161, 139, 137, 154, 120, 7, 137, 17, 136, 201, 10, 161, 88, 131, 186, 154, 129, 73, 23, 26, 147, 159, 17, 1, 186, 26, 185, 96, 18, 50, 249, 139, 145, 73, 39, 169, 128, 139, 36, 203, 17, 219, 25, 82, 2, 34, 216, 155, 128, 33, 128, 153, 157, 66, 176, 104, 161, 188, 156, 68, 130, 1, 168, 169, 120, 19, 170, 153, 168, 173, 115, 145, 9, 18, 144, 154, 50, 217, 26, 184, 25, 68, 131, 157, 37, 220, 64, 145, 11, 176, 140, 52, 35, 144, 25, 248, 157, 17, 17, 145, 138, 0, 83, 200, 57, 241, 27, 20, 138, 36, 137, 0, 169, 185, 138, 235, 40, 20, 67, 20, 202, 26, 3, 220, 40, 130, 136, 169, 170, 40, 71, 35, 232, 139, 144, 24, 18, 2, 236, 9, 64, 22, 202, 24, 144, 64, 129, 9, 185, 26, 3, 219, 58, 23, 169, 137, 153, 8, 101, 3, 202, 25, 144, 155, 97, 177, 11, 2, 32, 176, 113, 225, 10, 17, 17, 49, 133, 175, 24, 144, 17, 145, 169, 10, 54, 152, 50, 1, 224, 156, 19, 185, 170, 152, 190, 24, 16, 71, 17, 18, 154, 128, 220, 10, 35, 160, 160, 189, 136, 112, 23, 137, 128, 11, 3, 203, 8, 136, 8, 116, 145, 11, 147, 223, 49, 129, 17, 168, 41, 169, 168, 159, 50, 152, 34, 24, 37, 204, 9, 49, 5, 187, 24, 154, 129, 172, 50, 87, 177, 171, 128, 50, 129, 168, 172, 66, 201, 56, 5, 203, 10, 35, 8, 38, 217, 41, 18, 66, 146, 154, 239, 10, 34, 18, 160, 41, 130, 9, 70, 176, 155, 201, 170, 235, 96, 3, 136, 153, 24, 161, 27, 21, 203, 138, 114, 36, 176, 154, 153, 33, 3, 168, 223, 25, 34, 100, 130, 186, 186, 137, 130, 25, 34, 138, 50, 49, 39, 136, 137, 169, 152, 239, 139, 34, 18, 18, 19, 202, 10, 185, 24, 252, 73, 131, 10, 131, 188, 49, 19, 148, 0, 44, 0, 153, 234, 173, 83, 160, 41, 3, 217, 138, 128, 201, 139, 86, 1, 68, 160, 156, 136, 66, 177, 157, 16, 168, 81, 19, 16, 66, 3, 252, 171, 138, 16, 50, 51, 147, 190, 99, 1, 169, 171, 18, 187, 49, 249, 172, 24, 83, 19, 152, 0, 16, 33, 17, 208, 175, 0, 218, 139, 128, 82, 20, 33, 34, 33, 216, 173, 160, 187, 8, 152, 97, 51, 1, 203, 97, 20, 0, 144, 203, 188, 137, 152, 137, 24, 114, 36, 144, 17, 202, 27, 51, 144, 203, 187, 255, 154, 16, 34, 52, 161, 26, 129, 48, 17, 85, 200, 172, 187, 139, 33, 83, 3, 32, 54, 145, 0, 217, 56, 131, 155, 251, 141, 168, 80, 52, 50, 160, 32, 186, 16, 186, 0, 11, 248, 159, 168, 138, 50, 86, 2, 17, 176, 139, 0, 8, 19, 253, 171, 171, 138, 66, 53, 52, 3, 137, 185, 140, 186, 140, 168, 138, 170, 50, 208, 25, 101, 53, 129, 153, 202, 139, 0, 137, 33, 201, 205, 154, 8, 50, 53, 35, 17, 251, 172, 24, 136, 202, 186, 24, 18, 84, 36, 24, 49, 1, 220, 170, 171, 153, 113, 39, 152, 137, 1, 136, 81, 2, 1, 128, 136, 16, 152, 42, 4, 186, 187, 136, 140, 103, 52, 19, 235, 205, 205, 171, 153, 65, 68, 51, 19, 160, 138, 185, 158, 152, 186, 8, 0, 56, 87, 35, 34, 19, 168, 188, 186, 171, 82, 35, 53, 20, 128, 186, 203, 10, 67, 84, 52, 145, 153, 168, 173, 153, 203, 155, 169, 138, 50, 69, 52, 145, 219, 188, 189, 172, 152, 136, 49, 18, 16, 18, 201, 189, 188, 203, 186, 189, 154, 16, 68, 52, 35, 168, 172, 169, 185, 40, 38, 1, 33, 144, 56, 71, 68, 52, 3, 17, 144, 187, 138, 152, 49, 4, 9, 144, 154, 80, 119, 34, 33, 128, 204, 171, 187, 186, 137, 154, 24, 200, 171, 9, 85, 129, 168, 185, 237, 189, 171, 153, 8, 49, 52, 50, 36, 0, 16, 128, 0, 170, 201, 207, 154, 8, 48, 70, 53, 18, 34, 1, 153, 1, 168, 138, 201, 139, 1, 72, 87, 33, 50, 18, 129, 8, 128, 152, 205, 171, 220, 187, 137, 1, 25, 99, 35, 18, 18, 161, 239, 170, 219, 187, 138, 16, 34, 52, 33, 34, 203, 138, 201, 207, 9, 2, 26, 55, 1, 1, 128, 152, 9, 66, 66, 20, 137, 1, 186, 65, 35, 53, 234, 10, 0, 0, 27, 55, 160, 201, 189, 153, 188, 10, 1, 24, 32, 131, 175, 184, 156, 130, 189, 49, 176, 157, 0, 185, 72, 23, 17, 3, 16, 130, 26, 19, 115, 55, 33, 18, 202, 188, 137, 136, 115, 37, 51, 18, 67, 161, 9, 216, 172, 201, 156, 1, 128, 48, 54, 145, 153, 251, 220, 203, 137, 33, 100, 84, 51, 1, 1, 186, 189, 154, 153, 40, 52, 51, 54, 35, 67, 18, 0, 152, 201, 188, 137, 137, 49, 66, 34, 0, 169, 138, 35, 251, 106, 43, 0, 16, 36, 249, 221, 204, 188, 203, 170, 138, 136, 16, 49, 35, 137, 129, 254, 219, 203, 203, 170, 137, 16, 50, 51, 51, 2, 170, 186, 235, 187, 186, 172, 170, 24, 69, 52, 68, 36, 34, 33, 33, 17, 1, 0, 168, 236, 155, 8, 33, 86, 52, 51, 35, 18, 184, 190, 203, 204, 171, 154, 8, 17, 50, 53, 129, 153, 234, 188, 188, 187, 170, 186, 9, 19, 136, 16, 66, 1, 32, 70, 51, 2, 138, 160, 190, 171, 96, 36, 100, 67, 51, 51, 33, 3, 169, 154, 136, 186, 72, 20, 100, 36, 66, 35, 136, 128, 186, 204, 139, 16, 185, 155, 168, 207, 154, 25, 51, 0, 49, 193, 207, 188, 154, 186, 203, 138, 1, 169, 82, 68, 51, 129, 152, 251, 205, 138, 0, 16, 100, 35, 34, 18, 8, 1, 203, 9, 200, 173, 17, 137, 114, 20, 129, 0, 233, 205, 137, 16, 84, 68, 36, 2, 129, 169, 188, 154, 0, 1, 67, 67, 67, 51, 67, 35, 128, 136, 202, 188, 9, 0, 50, 19, 17, 218, 172, 153, 16, 51, 37, 248, 205, 188, 173, 171, 187, 152, 136, 8, 24, 34, 129, 218, 222, 219, 203, 171, 154, 8, 34, 51, 66, 2, 0, 160, 170, 169, 173, 136, 153, 32, 84, 84, 36, 35, 67, 35, 34, 83, 19, 128, 169, 204, 188, 154, 65, 68, 52, 67, 1, 136, 185, 189, 204, 186, 187, 187, 154, 24, 0, 50, 200, 204, 235, 186, 188, 171, 187, 203, 172, 171, 138, 40, 68, 83, 52, 51, 34, 129, 128, 160, 187, 72, 51, 103, 83, 52, 35, 51, 34, 17, 136, 0, 2, 128, 169, 24, 83, 68, 35, 69, 35, 152, 138, 185, 207, 170, 203, 188, 219, 155, 138, 8, 65, 52, 34, 152, 234, 204, 187, 156, 153, 24, 1, 24, 69, 33, 17, 18, 144, 189, 137, 72, 20, 64, 55, 202, 64, 145, 56, 68, 35, 67, 4, 10, 19, 221, 25, 130, 154, 82, 19, 137, 66, 178, 141, 216, 191, 154, 8, 50, 71, 37, 2, 128, 185, 189, 172, 8, 16, 66, 34, 66, 129, 16, 51, 145, 153, 218, 190, 154, 152, 65, 51, 18, 136, 168, 191, 32, 35, 50, 161, 221, 189, 188, 187, 138, 16, 16, 66, 19, 66, 131, 186, 251, 205, 187, 172, 137, 16, 66, 34, 50, 34, 8, 8, 9, 153, 219, 203, 188, 154, 41, 84, 36, 52, 50, 19, 50, 67, 2, 169, 221, 204, 171, 154, 24, 84, 35, 50, 18, 1, 185, 173, 218, 204, 187, 187, 154, 8, 33, 53, 145, 0, 201, 187, 186, 204, 154, 235, 156, 153, 137, 32, 98, 53, 34, 67, 51, 17, 144, 152, 170, 220, 11, 68, 51, 70, 51, 67, 17, 128, 137, 169, 154, 169, 138, 153, 49, 4, 114, 53, 34, 129, 153, 221, 156, 170, 170, 153, 185, 171, 187, 56, 70, 67, 37, 145, 185, 189, 172, 202, 138, 50, 17, 33, 52, 36, 35, 50, 35, 136, 250, 157, 250, 46, 0, 155, 176, 189, 64, 68, 18, 66, 37, 129, 152, 0, 168, 41, 2, 16, 250, 59, 211, 157, 49, 2, 169, 82, 177, 189, 16, 193, 175, 136, 206, 138, 169, 9, 100, 69, 51, 51, 19, 185, 173, 219, 155, 16, 50, 70, 34, 34, 35, 0, 17, 136, 152, 203, 172, 186, 43, 36, 32, 23, 136, 8, 169, 219, 138, 185, 223, 186, 235, 186, 169, 169, 24, 18, 33, 129, 160, 237, 187, 205, 171, 171, 154, 136, 65, 67, 68, 34, 17, 129, 186, 203, 154, 154, 48, 36, 99, 51, 69, 51, 52, 35, 1, 129, 137, 203, 154, 185, 172, 186, 40, 69, 67, 68, 35, 176, 203, 205, 189, 172, 170, 170, 9, 16, 16, 17, 161, 188, 203, 206, 187, 170, 186, 154, 16, 34, 67, 36, 67, 51, 52, 53, 35, 50, 67, 1, 9, 66, 35, 115, 71, 50, 83, 18, 18, 1, 136, 169, 138, 185, 155, 50, 18, 98, 70, 2, 136, 128, 250, 187, 185, 190, 154, 185, 171, 136, 184, 9, 145, 157, 66, 145, 154, 200, 206, 171, 186, 155, 97, 36, 66, 52, 35, 50, 36, 144, 152, 137, 129, 10, 119, 19, 33, 35, 130, 24, 51, 144, 81, 2, 32, 249, 172, 153, 170, 26, 55, 145, 32, 216, 189, 169, 154, 0, 9, 33, 168, 206, 10, 249, 11, 17, 8, 17, 36, 202, 97, 216, 10, 232, 174, 16, 128, 115, 69, 50, 35, 129, 153, 235, 187, 136, 24, 83, 83, 18, 1, 17, 16, 0, 128, 185, 219, 219, 154, 9, 66, 2, 32, 184, 189, 172, 152, 170, 9, 252, 189, 204, 186, 172, 137, 25, 34, 49, 37, 153, 169, 188, 206, 155, 170, 171, 24, 66, 67, 83, 52, 129, 136, 145, 219, 9, 136, 0, 8, 81, 51, 50, 55, 35, 66, 18, 0, 128, 169, 235, 204, 187, 138, 152, 81, 37, 50, 18, 129, 202, 205, 202, 202, 171, 169, 152, 32, 33, 66, 128, 10, 176, 206, 170, 138, 202, 157, 33, 152, 24, 52, 50, 53, 68, 85, 2, 32, 2, 170, 170, 154, 24, 100, 52, 52, 51, 36, 128, 0, 169, 138, 200, 172, 170, 154, 0, 82, 68, 34, 1, 201, 219, 186, 171, 152, 169, 219, 204, 172, 138, 24, 69, 67, 19, 128, 169, 203, 188, 41, 17, 0, 129, 128, 24, 102, 52, 52, 51, 145, 235, 186, 154, 16, 84, 35, 129, 136, 152, 154, 97, 53, 33, 18, 235, 187, 187, 136, 33, 52, 2, 234, 157, 152, 155, 83, 35, 35, 152, 250, 172, 188, 154, 8, 49, 36, 17, 35, 1, 218, 10, 2, 136, 169, 98, 193, 73, 23, 136, 32, 17, 65, 36, 18, 69, 146, 157, 145, 205, 170, 10, 0, 98, 86, 67, 35, 17, 129, 201, 190, 170, 153, 16, 82, 52, 34, 17, 16, 0, 152, 187, 204, 204, 171, 171, 25, 3, 65, 51, 152, 203, 187, 188, 186, 219, 219, 205, 188, 187, 172, 136, 16, 50, 38, 0, 128, 203, 219, 98, 218, 59, 0, 219, 186, 154, 137, 40, 67, 68, 36, 18, 0, 153, 188, 187, 170, 9, 17, 99, 51, 67, 37, 51, 35, 1, 129, 187, 204, 187, 188, 153, 154, 40, 100, 53, 50, 36, 145, 186, 207, 170, 203, 154, 138, 0, 9, 68, 34, 50, 35, 161, 220, 204, 170, 169, 10, 66, 33, 68, 35, 37, 128, 66, 1, 50, 170, 17, 235, 154, 42, 54, 34, 85, 34, 17, 24, 1, 170, 145, 172, 129, 189, 24, 129, 81, 68, 18, 65, 130, 204, 168, 187, 153, 168, 153, 0, 184, 89, 22, 24, 35, 138, 209, 175, 137, 171, 154, 96, 22, 8, 4, 8, 5, 138, 35, 32, 217, 72, 224, 41, 145, 72, 37, 1, 34, 50, 145, 9, 251, 48, 162, 59, 38, 152, 8, 50, 129, 81, 208, 26, 161, 11, 69, 18, 138, 69, 218, 42, 161, 59, 6, 137, 129, 219, 153, 0, 1, 81, 38, 129, 33, 176, 26, 146, 187, 138, 217, 175, 40, 128, 113, 19, 32, 18, 203, 154, 205, 155, 8, 33, 68, 18, 144, 235, 171, 235, 187, 9, 8, 66, 67, 51, 161, 203, 235, 189, 137, 169, 25, 131, 137, 35, 233, 10, 131, 220, 9, 144, 154, 64, 54, 34, 84, 2, 202, 219, 170, 138, 40, 55, 20, 34, 18, 169, 137, 202, 10, 160, 139, 19, 170, 66, 145, 25, 162, 222, 188, 187, 173, 153, 9, 17, 185, 189, 205, 173, 170, 9, 24, 33, 19, 250, 187, 220, 138, 8, 9, 1, 169, 138, 186, 72, 36, 17, 146, 189, 41, 160, 57, 55, 8, 2, 152, 169, 223, 138, 98, 53, 34, 33, 185, 190, 171, 25, 84, 2, 16, 36, 169, 40, 129, 202, 187, 169, 188, 25, 51, 19, 128, 0, 255, 203, 203, 137, 17, 50, 71, 34, 0, 152, 219, 155, 16, 66, 52, 52, 50, 3, 137, 168, 154, 32, 68, 53, 83, 51, 33, 33, 128, 138, 250, 155, 152, 12, 70, 33, 68, 2, 136, 168, 173, 137, 136, 49, 20, 49, 162, 157, 128, 189, 81, 51, 18, 67, 19, 136, 137, 128, 154, 8, 203, 8, 114, 87, 34, 68, 4, 168, 185, 186, 137, 66, 68, 36, 51, 17, 152, 137, 169, 155, 184, 174, 40, 51, 101, 68, 1, 154, 186, 9, 83, 19, 0, 1, 204, 138, 185, 154, 219, 10, 144, 115, 55, 17, 129, 128, 218, 187, 170, 190, 9, 217, 25, 38, 33, 34, 145, 203, 170, 128, 203, 137, 184, 10, 145, 191, 152, 41, 119, 17, 1, 160, 204, 154, 185, 155, 184, 172, 17, 129, 66, 52, 19, 233, 188, 186, 187, 137, 252, 155, 136, 153, 64, 53, 34, 33, 145, 221, 187, 170, 169, 171, 24, 18, 17, 50, 35, 65, 71, 146, 202, 236, 155, 8, 128, 16, 145, 207, 137, 130, 154, 69, 1, 24, 1, 186, 173, 218, 172, 8, 65, 52, 130, 136, 136, 24, 83, 1, 136, 218, 156, 81, 52, 17, 144, 186, 173, 56, 52, 16, 68, 19, 83, 2, 90, 255, 47, 0, 152, 251, 170, 8, 65, 68, 2, 152, 16, 17, 185, 40, 194, 175, 25, 169, 42, 39, 144, 40, 129, 190, 137, 202, 25, 19, 17, 51, 18, 235, 154, 251, 12, 1, 153, 16, 130, 9, 145, 25, 250, 223, 1, 137, 50, 35, 1, 152, 186, 188, 171, 56, 71, 160, 9, 232, 155, 34, 49, 119, 129, 136, 160, 171, 25, 128, 96, 19, 171, 65, 249, 10, 3, 154, 99, 130, 16, 145, 155, 152, 156, 114, 176, 158, 18, 136, 100, 34, 136, 168, 187, 9, 33, 35, 128, 49, 161, 11, 52, 16, 119, 131, 186, 188, 153, 170, 114, 23, 8, 0, 185, 155, 83, 145, 25, 3, 168, 97, 3, 203, 169, 204, 40, 35, 17, 40, 54, 200, 140, 128, 171, 115, 161, 26, 51, 1, 234, 138, 217, 42, 54, 144, 154, 9, 68, 18, 17, 216, 174, 24, 144, 9, 67, 17, 67, 184, 138, 251, 26, 4, 203, 8, 0, 18, 8, 129, 32, 192, 121, 147, 174, 128, 168, 41, 71, 1, 8, 176, 203, 186, 42, 54, 145, 154, 18, 251, 57, 22, 168, 8, 200, 154, 33, 0, 81, 3, 138, 176, 191, 24, 8, 18, 25, 3, 24, 134, 175, 33, 176, 9, 162, 173, 98, 130, 9, 161, 173, 65, 177, 58, 133, 190, 40, 34, 19, 186, 184, 207, 16, 17, 129, 10, 178, 159, 37, 136, 144, 25, 3, 188, 32, 252, 11, 1, 66, 4, 33, 3, 190, 138, 65, 4, 170, 128, 139, 200, 75, 133, 138, 68, 19, 217, 24, 177, 158, 67, 2, 16, 184, 156, 152, 9, 0, 8, 145, 206, 138, 48, 21, 168, 8, 8, 54, 217, 8, 152, 152, 175, 66, 129, 136, 137, 84, 160, 171, 187, 40, 177, 41, 53, 51, 208, 41, 178, 28, 164, 143, 51, 160, 137, 136, 252, 141, 66, 129, 66, 146, 187, 18, 235, 139, 16, 68, 146, 174, 48, 161, 10, 0, 115, 6, 136, 192, 157, 0, 153, 33, 128, 49, 17, 84, 145, 185, 175, 16, 1, 0, 152, 1, 185, 156, 36, 187, 68, 128, 67, 152, 217, 27, 23, 154, 51, 236, 25, 176, 40, 19, 66, 163, 12, 176, 12, 16, 66, 217, 41, 129, 152, 141, 53, 202, 10, 33, 2, 202, 26, 85, 129, 138, 129, 170, 136, 172, 154, 25, 48, 119, 128, 169, 59, 23, 139, 18, 187, 153, 56, 3, 113, 200, 140, 1, 16, 1, 98, 130, 9, 200, 12, 3, 189, 16, 144, 136, 26, 21, 64, 4, 25, 22, 169, 154, 153, 152, 97, 178, 13, 208, 12, 2, 41, 21, 40, 4, 25, 21, 171, 216, 174, 152, 26, 36, 17, 36, 2, 136, 136, 169, 154, 160, 206, 96, 2, 16, 208, 174, 33, 136, 49, 19, 33, 169, 49, 217, 48, 251, 10, 250, 56, 162, 26, 129, 105, 4, 64, 3, 220, 155, 128, 155, 51, 137, 55, 160, 40, 131, 206, 48, 162, 26, 129, 136, 41, 22, 187, 184, 174, 16, 84, 2, 56, 176, 140, 145, 6, 56, 0, 160, 157, 17, 8, 34, 8, 216, 174, 48, 20, 128, 153, 81, 210, 12, 19, 154, 64, 21, 220, 40, 160, 41, 3, 16, 35, 234, 56, 225, 10, 144, 24, 204, 81, 129, 50, 160, 49, 208, 171, 8, 219, 57, 51, 33, 17, 240, 172, 2, 137, 83, 176, 58, 38, 250, 27, 3, 140, 3, 139, 2, 57, 227, 74, 149, 139, 52, 192, 155, 1, 137, 2, 25, 177, 120, 149, 136, 169, 136, 28, 23, 171, 19, 188, 32, 16, 69, 144, 186, 187, 154, 65, 39, 185, 137, 17, 129, 137, 70, 131, 170, 218, 155, 17, 33, 2, 154, 49, 3, 223, 154, 48, 36, 96, 179, 31, 131, 141, 17, 8, 208, 10, 152, 115, 161, 57, 146, 158, 17, 136, 17, 144, 139, 152, 154, 81, 50, 51, 146, 237, 138, 0, 152, 154, 101, 145, 136, 202, 41, 4, 170, 100, 145, 139, 160, 11, 36, 217, 26, 19, 169, 40, 36, 1, 16, 176, 207, 80, 130, 9, 146, 139, 250, 143, 2, 25, 36, 170, 34, 171, 52, 202, 152, 28, 22, 10, 3, 157, 16, 153, 16, 152, 69, 184, 58, 161, 26, 3, 51, 255, 41, 161, 96, 144, 16, 217, 26, 53, 192, 139, 128, 32, 176, 24, 17, 2, 140, 55, 160, 137, 187, 49, 234, 96, 161, 24, 1, 0, 144, 144, 140, 53, 160, 57, 134, 206, 25, 50, 233, 58, 6, 154, 153, 88, 5, 136, 137, 138, 138, 33, 34, 192, 56, 226, 27, 161, 58, 178, 112, 151, 26, 145, 42, 212, 12, 146, 59, 131, 73, 163, 11, 17, 161, 173, 152, 156, 16, 98, 3, 138, 144, 137, 176, 42, 38, 65, 208, 140, 34, 16, 131, 205, 25, 131, 29, 147, 191, 18, 81, 21, 8, 185, 138, 203, 0, 154, 37, 10, 55, 128, 145, 138, 202, 11, 186, 48, 145, 101, 129, 49, 161, 158, 50, 251, 11, 130, 24, 36, 160, 154, 33, 17, 1, 154, 66, 195, 239, 56, 131, 136, 129, 235, 10, 8, 32, 52, 1, 50, 8, 147, 207, 19, 191, 17, 8, 2, 187, 26, 119, 144, 24, 168, 168, 188, 33, 16, 52, 1, 202, 16, 250, 40, 146, 58, 149, 141, 51, 186, 56, 131, 152, 219, 170, 203, 96, 130, 104, 4, 155, 1, 154, 128, 8, 136, 40, 251, 25, 20, 128, 16, 2, 220, 26, 52, 146, 42, 151, 191, 1, 170, 34, 34, 19, 41, 3, 27, 22, 253, 10, 2, 26, 20, 188, 32, 176, 43, 39, 144, 136, 33, 226, 141, 18, 9, 145, 11, 194, 74, 134, 138, 131, 171, 70, 144, 25, 1, 220, 10, 136, 40, 36, 144, 49, 241, 27, 21, 184, 187, 65, 145, 97, 176, 11, 152, 10, 49, 20, 8, 128, 48, 195, 158, 153, 57, 21, 0, 36, 252, 42, 4, 128, 185, 58, 163, 141, 19, 170, 64, 84, 192, 42, 147, 174, 129, 10, 35, 153, 83, 217, 72, 3, 137, 201, 10, 160, 139, 20, 88, 38, 170, 32, 200, 87, 1, 57, 0, 188, 64, 4, 25, 4, 219, 8, 152, 65, 209, 28, 21, 153, 136, 49, 250, 40, 162, 56, 130, 218, 11, 20, 156, 84, 160, 137, 128, 24, 168, 41, 146, 157, 33, 2, 82, 146, 223, 33, 176, 72, 145, 26, 178, 42, 147, 112, 194, 43, 193, 88, 177, 12, 34, 184, 27, 133, 42, 7, 154, 129, 170, 32, 145, 33, 145, 112, 179, 191, 40, 3, 187, 52, 202, 69, 202, 40, 144, 33, 218, 41, 1, 129, 138, 54, 219, 56, 144, 32, 217, 56, 147, 171, 40, 37, 219, 81, 192, 59, 22, 169, 152, 203, 56, 51, 38, 168, 168, 207, 48, 129, 34, 184, 9, 0, 160, 140, 54, 219, 32, 168, 115, 192, 9, 2, 154, 50, 176, 171, 152, 73, 4, 43, 6, 26, 178, 191, 19, 10, 36, 171, 128, 175, 33, 9, 103, 128, 137, 185, 24, 145, 32, 130, 170, 154, 56, 21, 32, 210, 157, 1, 137, 87, 184, 153, 10, 3, 156, 39, 185, 33, 184, 9, 144, 49, 34, 193, 175, 35, 40, 179, 175, 21, 203, 40, 51, 145, 153, 202, 12, 51, 54, 217, 43, 162, 14, 67, 128, 168, 171, 137, 33, 35, 0, 50, 250, 12, 52, 161, 173, 17, 219, 104, 2, 153, 8, 130, 206, 81, 2, 10, 8, 153, 155, 66, 136, 16, 154, 37, 236, 48, 161, 11, 19, 32, 232, 57, 179, 75, 179, 45, 146, 43, 248, 89, 130, 155, 50, 128, 219, 40, 168, 112, 130, 0, 203, 1, 219, 82, 1, 128, 154, 129, 138, 147, 175, 51, 170, 83, 168, 17, 170, 49, 50, 251, 91, 179, 207, 81, 145, 139, 34, 145, 25, 2, 250, 11, 53, 170, 98, 208, 11, 1, 10, 51, 168, 32, 2, 202, 57, 148, 157, 35, 169, 49, 252, 26, 36, 144, 155, 66, 184, 81, 176, 28, 21, 202, 56, 4, 203, 25, 17, 33, 128, 8, 251, 141, 67, 168, 113, 162, 142, 17, 152, 24, 129, 10, 1, 187, 113, 130, 10, 37, 204, 56, 160, 138, 33, 160, 11, 4, 74, 7, 186, 48, 160, 187, 25, 19, 186, 203, 120, 23, 171, 34, 160, 57, 5, 220, 25, 131, 9, 21, 219, 24, 144, 48, 129, 72, 161, 158, 34, 128, 40, 130, 188, 26, 130, 189, 115, 179, 156, 68, 161, 172, 24, 145, 65, 129, 66, 251, 56, 192, 10, 34, 146, 156, 50, 200, 56, 161, 26, 36, 130, 171, 18, 255, 25, 160, 80, 20, 169, 137, 153, 136, 48, 37, 160, 139, 0, 221, 40, 145, 66, 233, 88, 131, 185, 41, 147, 174, 51, 160, 81, 200, 138, 9, 52, 187, 68, 185, 50, 234, 24, 0, 136, 138, 67, 136, 70, 233, 11, 144, 57, 21, 24, 176, 11, 162, 9, 128, 115, 193, 56, 196, 142, 18, 145, 185, 80, 147, 26, 130, 172, 153, 9, 115, 3, 202, 24, 216, 58, 7, 170, 50, 233, 25, 35, 152, 56, 194, 174, 33, 168, 41, 38, 168, 42, 177, 158, 50, 129, 69, 3, 60, 0, 137, 24, 2, 186, 251, 74, 22, 203, 32, 2, 17, 184, 11, 232, 12, 69, 145, 154, 136, 144, 24, 2, 114, 194, 140, 3, 188, 72, 2, 0, 144, 154, 218, 56, 38, 1, 184, 10, 184, 156, 16, 68, 129, 73, 4, 185, 189, 10, 17, 49, 52, 161, 156, 128, 205, 64, 3, 50, 248, 25, 200, 11, 52, 18, 136, 0, 251, 27, 160, 90, 22, 169, 40, 184, 42, 132, 156, 66, 184, 73, 5, 204, 41, 3, 137, 67, 233, 25, 129, 8, 19, 235, 40, 2, 139, 38, 218, 10, 17, 33, 33, 152, 202, 172, 64, 147, 141, 19, 172, 66, 1, 185, 89, 5, 171, 18, 219, 8, 152, 81, 2, 0, 16, 184, 207, 24, 19, 153, 48, 37, 232, 140, 33, 202, 42, 53, 200, 57, 148, 187, 25, 128, 65, 131, 9, 144, 172, 17, 24, 85, 130, 218, 9, 160, 138, 18, 26, 39, 144, 50, 184, 137, 250, 58, 2, 42, 4, 155, 84, 128, 9, 169, 128, 220, 40, 18, 128, 153, 33, 67, 240, 140, 19, 171, 55, 160, 152, 190, 40, 16, 68, 161, 172, 57, 21, 201, 139, 65, 130, 140, 67, 145, 234, 10, 0, 66, 19, 152, 138, 16, 136, 160, 189, 144, 191, 114, 2, 17, 169, 136, 138, 3, 158, 68, 185, 138, 18, 203, 48, 18, 52, 129, 249, 159, 18, 168, 83, 177, 11, 131, 203, 56, 19, 204, 80, 145, 10, 2, 155, 36, 203, 98, 192, 140, 50, 160, 9, 129, 138, 144, 12, 68, 145, 170, 11, 34, 16, 69, 208, 155, 168, 12, 37, 186, 88, 3, 153, 1, 144, 235, 57, 133, 9, 152, 156, 56, 37, 154, 67, 184, 24, 251, 25, 132, 153, 66, 130, 203, 138, 128, 8, 67, 144, 57, 5, 188, 41, 2, 186, 113, 135, 155, 145, 173, 51, 168, 72, 161, 26, 52, 0, 16, 249, 172, 1, 16, 176, 89, 131, 137, 219, 114, 145, 16, 184, 42, 130, 24, 209, 207, 32, 145, 66, 2, 169, 187, 80, 34, 128, 40, 177, 255, 24, 129, 41, 36, 137, 184, 142, 53, 160, 9, 144, 154, 144, 26, 55, 152, 128, 56, 132, 140, 131, 138, 200, 42, 4, 32, 145, 58, 6, 188, 144, 170, 115, 128, 32, 160, 56, 164, 223, 40, 131, 171, 201, 90, 23, 128, 8, 153, 170, 138, 35, 17, 53, 0, 236, 138, 1, 48, 36, 1, 218, 139, 40, 160, 41, 17, 101, 216, 41, 145, 9, 128, 49, 161, 158, 83, 232, 26, 3, 10, 51, 152, 128, 153, 218, 75, 132, 156, 36, 168, 56, 162, 159, 32, 0, 136, 16, 250, 44, 5, 153, 50, 129, 152, 184, 159, 129, 141, 100, 129, 9, 184, 173, 32, 1, 0, 24, 69, 184, 57, 226, 12, 4, 170, 0, 17, 168, 40, 147, 12, 39, 201, 56, 132, 10, 160, 174, 48, 3, 138, 34, 188, 57, 176, 75, 38, 152, 184, 141, 34, 9, 23, 170, 152, 141, 51, 218, 57, 21, 186, 246, 255, 36, 0, 25, 8, 129, 12, 52, 202, 10, 65, 161, 140, 35, 217, 56, 224, 27, 6, 170, 66, 160, 32, 144, 188, 42, 55, 184, 25, 17, 169, 140, 18, 152, 136, 25, 36, 137, 68, 253, 140, 65, 18, 17, 160, 205, 187, 41, 39, 128, 2, 186, 138, 153, 48, 53, 208, 26, 130, 8, 160, 156, 128, 172, 115, 34, 17, 185, 205, 155, 99, 130, 24, 131, 235, 138, 1, 25, 38, 144, 16, 202, 42, 144, 40, 34, 1, 201, 190, 96, 176, 120, 130, 154, 152, 136, 49, 131, 139, 240, 158, 81, 51, 208, 11, 131, 174, 64, 129, 0, 130, 202, 32, 162, 155, 66, 3, 204, 9, 0, 32, 50, 18, 168, 205, 10, 98, 20, 168, 184, 157, 18, 137, 52, 234, 72, 130, 42, 177, 141, 20, 184, 48, 147, 172, 16, 216, 72, 3, 72, 132, 189, 24, 1, 170, 113, 131, 172, 49, 201, 41, 162, 57, 6, 155, 136, 9, 130, 74, 133, 155, 51, 184, 190, 26, 53, 184, 74, 132, 11, 33, 1, 172, 35, 189, 100, 136, 24, 186, 16, 34, 168, 73, 132, 10, 176, 27, 21, 200, 139, 70, 184, 155, 136, 113, 6, 186, 24, 1, 168, 26, 3, 26, 21, 172, 64, 146, 27, 148, 29, 23, 171, 35, 153, 145, 173, 51, 202, 48, 36, 192, 75, 23, 172, 49, 144, 153, 10, 136, 98, 161, 42, 131, 156, 18, 64, 163, 191, 40, 160, 42, 36, 184, 59, 71, 185, 8, 9, 33, 192, 11, 3, 239, 41, 17, 168, 27, 38, 184, 9, 152, 155, 24, 115, 162, 158, 35, 202, 56, 145, 24, 2, 202, 171, 18, 202, 96, 130, 136, 168, 171, 169, 157, 83, 168, 100, 184, 41, 203, 80, 216, 25, 130, 203, 48, 164, 140, 34, 169, 18, 220, 8, 137, 33, 251, 41, 67, 146, 189, 56, 192, 139, 49, 34, 233, 10, 1, 25, 18, 169, 185, 203, 82, 20, 128, 201, 26, 4, 138, 18, 250, 139, 102, 146, 139, 131, 11, 133, 13, 36, 185, 41, 146, 157, 17, 56, 7, 174, 50, 129, 9, 169, 0, 219, 72, 4, 137, 16, 145, 9, 168, 41, 4, 10, 19, 145, 203, 185, 175, 68, 18, 35, 222, 64, 184, 80, 161, 57, 160, 48, 176, 139, 82, 249, 60, 5, 8, 18, 185, 187, 40, 51, 49, 178, 13, 195, 30, 38, 136, 1, 219, 139, 34, 36, 176, 32, 249, 27, 2, 139, 145, 139, 115, 1, 57, 164, 175, 34, 8, 2, 187, 0, 175, 99, 129, 1, 138, 129, 57, 196, 141, 18, 9, 16, 49, 250, 141, 17, 128, 137, 32, 22, 217, 9, 18, 128, 9, 1, 173, 81, 176, 11, 20, 171, 116, 168, 27, 129, 137, 34, 81, 178, 141, 1, 204, 56, 3, 0, 1, 186, 139, 185, 114, 7, 26, 162, 141, 34, 152, 155, 34, 26, 38, 187, 67, 185, 48, 18, 35, 251, 141, 50, 193, 59, 23, 152, 153, 40, 161, 121, 5, 156, 32, 160, 10, 67, 0, 20, 0, 50, 146, 48, 240, 43, 131, 26, 192, 43, 21, 184, 155, 0, 202, 121, 21, 128, 0, 187, 48, 219, 48, 162, 10, 35, 232, 74, 131, 187, 156, 131, 223, 68, 145, 137, 155, 48, 1, 145, 9, 19, 12, 5, 175, 33, 251, 41, 19, 50, 176, 139, 19, 152, 154, 144, 190, 152, 138, 217, 121, 4, 32, 3, 154, 170, 1, 255, 24, 144, 113, 3, 186, 9, 32, 144, 11, 1, 204, 80, 131, 137, 249, 139, 2, 9, 51, 52, 209, 157, 33, 184, 56, 4, 40, 216, 157, 144, 56, 133, 170, 34, 152, 0, 152, 33, 235, 10, 66, 20, 170, 50, 253, 139, 1, 65, 162, 42, 162, 58, 248, 43, 130, 10, 185, 26, 208, 27, 119, 129, 187, 24, 17, 161, 173, 33, 160, 32, 66, 201, 57, 248, 42, 178, 43, 53, 19, 219, 219, 11, 38, 33, 146, 172, 17, 154, 34, 9, 52, 56, 244, 175, 34, 152, 0, 8, 1, 187, 56, 131, 188, 120, 36, 168, 98, 145, 187, 189, 137, 24, 71, 129, 65, 192, 172, 128, 0, 33, 0, 17, 137, 50, 251, 13, 1, 136, 138, 84, 193, 10, 2, 155, 67, 18, 146, 204, 218, 172, 81, 36, 129, 136, 153, 218, 155, 84, 129, 32, 1, 152, 218, 155, 49, 177, 42, 39, 218, 25, 36, 169, 64, 177, 174, 16, 52, 184, 72, 129, 10, 169, 112, 177, 12, 131, 155, 9, 20, 172, 84, 184, 48, 193, 138, 201, 41, 52, 68, 160, 170, 189, 8, 136, 119, 130, 154, 153, 169, 48, 21, 144, 154, 24, 160, 11, 87, 131, 222, 138, 34, 34, 129, 137, 153, 24, 52, 19, 251, 11, 36, 169, 64, 3, 200, 156, 16, 1, 202, 11, 3, 139, 52, 192, 191, 24, 0, 85, 2, 170, 170, 64, 5, 137, 152, 187, 154, 96, 54, 193, 207, 10, 49, 85, 129, 204, 203, 41, 53, 36, 177, 190, 138, 50, 38, 129, 154, 170, 138, 16, 33, 145, 171, 40, 49, 4, 203, 9, 98, 4, 186, 42, 53, 1, 169, 169, 153, 112, 87, 129, 186, 205, 10, 50, 37, 152, 137, 185, 9, 34, 33, 69, 1, 184, 191, 154, 153, 16, 50, 131, 171, 185, 191, 64, 52, 51, 248, 206, 139, 99, 18, 128, 185, 155, 33, 51, 146, 189, 170, 57, 71, 168, 186, 154, 66, 54, 128, 219, 155, 83, 35, 34, 248, 157, 24, 34, 35, 152, 186, 173, 9, 83, 2, 153, 218, 139, 115, 35, 201, 155, 0, 169, 81, 4, 136, 2, 202, 24, 162, 189, 65, 146, 12, 22, 169, 9, 153, 0, 50, 162, 140, 176, 207, 96, 20, 152, 186, 140, 51, 34, 146, 171, 219, 73, 20, 8, 184, 157, 33, 50, 36, 152, 217, 158, 32, 50, 20, 252, 138, 35, 2, 8, 136, 170, 137, 186, 116, 131, 16, 232, 156, 18, 48, 19, 251, 138, 49, 17, 34, 249, 154, 16, 17, 136, 48, 177, 158, 72, 51, 201, 171, 172, 8, 97, 19, 50, 9, 60, 0, 24, 234, 26, 4, 138, 50, 146, 206, 25, 35, 99, 130, 188, 189, 10, 67, 52, 161, 173, 17, 144, 33, 224, 172, 0, 0, 65, 21, 128, 18, 251, 155, 16, 33, 2, 168, 10, 17, 32, 51, 217, 173, 8, 160, 112, 21, 168, 154, 137, 50, 184, 159, 8, 33, 87, 2, 218, 171, 137, 17, 82, 2, 171, 9, 8, 82, 20, 184, 205, 139, 48, 53, 2, 168, 203, 137, 0, 65, 3, 138, 161, 156, 48, 55, 192, 189, 170, 72, 70, 2, 185, 172, 26, 68, 130, 186, 186, 138, 99, 35, 18, 201, 189, 9, 66, 19, 168, 169, 188, 56, 53, 3, 203, 138, 184, 57, 71, 2, 169, 189, 138, 49, 37, 128, 169, 138, 34, 17, 162, 205, 9, 32, 37, 8, 18, 221, 138, 8, 65, 38, 160, 187, 169, 10, 85, 2, 184, 188, 155, 16, 87, 18, 170, 186, 137, 50, 4, 153, 153, 9, 1, 153, 128, 168, 137, 116, 53, 131, 253, 139, 16, 32, 67, 4, 185, 206, 137, 66, 51, 146, 204, 170, 41, 68, 1, 186, 138, 0, 49, 18, 168, 187, 138, 85, 19, 176, 174, 170, 9, 85, 34, 152, 204, 9, 0, 136, 83, 19, 128, 202, 170, 41, 19, 18, 249, 26, 130, 82, 146, 24, 217, 154, 189, 26, 67, 68, 34, 0, 235, 154, 128, 136, 171, 8, 32, 39, 152, 17, 217, 42, 36, 152, 188, 25, 3, 1, 1, 184, 207, 171, 33, 87, 52, 129, 17, 160, 157, 128, 219, 25, 19, 32, 68, 51, 1, 17, 202, 172, 154, 17, 169, 66, 2, 40, 70, 145, 188, 170, 136, 49, 22, 219, 171, 203, 26, 130, 170, 153, 9, 34, 129, 233, 223, 172, 154, 187, 25, 18, 48, 36, 128, 184, 207, 188, 187, 10, 50, 17, 152, 203, 10, 66, 36, 184, 156, 185, 173, 136, 56, 71, 145, 187, 65, 37, 130, 152, 34, 18, 33, 184, 207, 26, 84, 17, 34, 52, 146, 189, 9, 50, 19, 0, 40, 99, 34, 85, 162, 156, 16, 152, 40, 103, 1, 138, 136, 153, 32, 36, 18, 176, 139, 53, 145, 9, 17, 16, 3, 190, 48, 129, 33, 64, 71, 0, 16, 251, 158, 0, 0, 32, 160, 25, 20, 203, 155, 81, 130, 188, 25, 136, 186, 138, 185, 56, 87, 129, 169, 187, 203, 40, 145, 57, 5, 237, 171, 25, 51, 50, 85, 19, 250, 187, 153, 8, 50, 18, 16, 184, 191, 48, 145, 96, 145, 169, 220, 154, 10, 36, 65, 37, 128, 144, 186, 189, 56, 55, 145, 186, 202, 171, 128, 65, 71, 34, 169, 8, 160, 9, 144, 200, 157, 128, 27, 85, 51, 34, 130, 237, 153, 136, 32, 51, 35, 168, 153, 186, 10, 0, 66, 224, 190, 25, 51, 136, 17, 251, 205, 190, 9, 33, 70, 34, 36, 168, 187, 188, 171, 24, 52, 19, 68, 130, 33, 4, 0, 0, 200, 188, 153, 24, 70, 51, 37, 0, 152, 187, 153, 137, 115, 52, 1, 186, 50, 42, 49, 0, 203, 172, 25, 34, 53, 1, 186, 156, 251, 154, 136, 154, 184, 188, 153, 8, 65, 3, 237, 203, 188, 171, 138, 16, 34, 34, 185, 251, 189, 170, 153, 169, 9, 160, 172, 153, 34, 8, 52, 176, 185, 191, 154, 16, 18, 51, 50, 178, 207, 115, 36, 35, 2, 168, 203, 187, 25, 54, 68, 51, 49, 21, 9, 49, 129, 24, 1, 201, 11, 102, 51, 50, 51, 0, 137, 129, 219, 24, 34, 116, 129, 138, 168, 56, 51, 101, 130, 138, 201, 171, 250, 41, 193, 43, 21, 170, 49, 130, 32, 249, 172, 169, 9, 16, 115, 131, 172, 66, 161, 156, 49, 130, 138, 69, 2, 169, 8, 66, 177, 44, 20, 24, 55, 34, 54, 162, 25, 162, 174, 137, 64, 38, 1, 67, 146, 9, 185, 41, 130, 136, 17, 36, 202, 57, 71, 0, 33, 1, 220, 172, 0, 160, 25, 18, 50, 148, 206, 136, 170, 41, 129, 24, 252, 156, 168, 156, 32, 34, 0, 170, 170, 220, 157, 24, 16, 136, 154, 128, 251, 189, 56, 3, 12, 38, 217, 169, 203, 40, 17, 50, 35, 1, 202, 137, 168, 113, 3, 187, 154, 170, 155, 101, 18, 67, 176, 24, 251, 143, 34, 184, 41, 21, 152, 48, 146, 138, 34, 152, 202, 205, 57, 5, 0, 19, 65, 20, 153, 128, 171, 250, 173, 8, 185, 64, 37, 1, 32, 240, 191, 154, 171, 32, 68, 36, 19, 2, 218, 186, 203, 138, 16, 49, 51, 69, 34, 51, 35, 184, 155, 217, 189, 9, 85, 51, 67, 19, 136, 128, 189, 32, 3, 81, 36, 160, 170, 136, 25, 68, 50, 52, 208, 172, 219, 154, 137, 48, 2, 170, 9, 233, 188, 24, 224, 173, 170, 172, 154, 41, 52, 128, 0, 220, 188, 189, 137, 136, 24, 34, 129, 203, 139, 168, 173, 32, 128, 154, 234, 155, 99, 18, 34, 2, 218, 139, 128, 96, 19, 49, 192, 139, 216, 58, 87, 17, 33, 128, 144, 186, 24, 153, 116, 18, 32, 17, 33, 129, 32, 35, 128, 170, 170, 188, 113, 83, 37, 16, 2, 170, 169, 8, 18, 67, 208, 190, 202, 10, 67, 129, 9, 66, 177, 191, 8, 137, 17, 189, 67, 250, 65, 194, 57, 5, 137, 0, 40, 209, 28, 35, 40, 133, 139, 53, 235, 24, 33, 38, 184, 80, 130, 153, 169, 50, 160, 113, 132, 48, 146, 43, 6, 170, 34, 1, 152, 140, 52, 128, 82, 18, 8, 185, 140, 208, 156, 34, 152, 50, 177, 27, 129, 207, 170, 154, 16, 219, 154, 168, 173, 49, 251, 44, 178, 10, 200, 26, 250, 10, 130, 138, 16, 65, 131, 171, 184, 191, 19, 207, 80, 129, 154, 8, 50, 234, 73, 5, 153, 136, 153, 144, 171, 65, 68, 36, 176, 154, 146, 223, 41, 5, 154, 68, 185, 42, 131, 171, 115, 129, 170, 153, 185, 12, 52, 138, 70, 146, 170, 137, 152, 188, 81, 3, 137, 128, 170, 204, 10, 20, 66, 21, 137, 128, 202, 202, 58, 251, 51, 0, 155, 19, 204, 81, 145, 48, 35, 68, 161, 205, 221, 170, 169, 26, 84, 52, 20, 128, 136, 204, 188, 137, 8, 49, 53, 34, 33, 128, 153, 153, 186, 172, 152, 9, 115, 51, 69, 50, 130, 186, 170, 188, 9, 50, 69, 19, 0, 152, 154, 33, 82, 37, 160, 187, 237, 187, 138, 16, 84, 19, 8, 136, 219, 187, 188, 170, 187, 25, 152, 64, 52, 52, 184, 190, 220, 172, 154, 9, 50, 50, 37, 144, 201, 172, 153, 203, 24, 145, 48, 2, 65, 21, 17, 128, 203, 203, 171, 48, 52, 50, 53, 129, 9, 17, 33, 85, 1, 8, 234, 140, 8, 81, 35, 68, 20, 8, 152, 187, 155, 154, 8, 99, 37, 17, 115, 1, 136, 160, 205, 170, 152, 16, 69, 35, 17, 0, 220, 187, 154, 152, 48, 52, 130, 17, 2, 217, 10, 136, 188, 10, 200, 58, 55, 49, 70, 2, 170, 32, 177, 159, 68, 129, 25, 52, 2, 138, 54, 136, 114, 145, 9, 161, 138, 8, 114, 3, 97, 20, 144, 136, 153, 171, 8, 153, 81, 52, 18, 50, 18, 200, 172, 154, 203, 188, 72, 130, 138, 37, 153, 1, 206, 138, 201, 156, 136, 0, 152, 171, 25, 193, 239, 8, 145, 187, 26, 2, 205, 10, 17, 128, 137, 83, 129, 189, 155, 217, 172, 136, 96, 20, 24, 52, 176, 170, 219, 154, 153, 17, 115, 36, 168, 49, 145, 136, 24, 18, 218, 155, 188, 24, 17, 115, 70, 18, 154, 136, 203, 170, 171, 115, 130, 136, 34, 144, 26, 36, 24, 38, 235, 171, 189, 10, 136, 49, 100, 35, 187, 40, 251, 25, 176, 89, 177, 140, 168, 59, 6, 41, 39, 128, 152, 172, 152, 203, 41, 67, 51, 129, 98, 177, 12, 144, 155, 1, 172, 65, 130, 58, 39, 152, 250, 186, 188, 40, 34, 103, 35, 19, 218, 170, 219, 155, 40, 53, 35, 68, 1, 169, 186, 155, 8, 137, 32, 53, 2, 98, 51, 0, 130, 219, 203, 173, 10, 65, 52, 34, 17, 185, 173, 186, 156, 52, 144, 153, 203, 203, 156, 49, 51, 35, 160, 205, 204, 189, 137, 129, 137, 16, 129, 136, 24, 1, 201, 221, 204, 187, 153, 40, 68, 36, 17, 153, 219, 170, 170, 137, 83, 3, 153, 66, 36, 0, 65, 130, 204, 154, 8, 32, 67, 69, 18, 136, 0, 1, 33, 66, 130, 220, 9, 1, 32, 102, 36, 1, 8, 153, 187, 171, 65, 18, 65, 52, 1, 33, 1, 144, 16, 252, 175, 136, 0, 33, 83, 20, 144, 169, 204, 171, 137, 0, 128, 48, 21, 136, 66, 35, 248, 156, 144, 204, 25, 35, 17, 84, 2, 169, 24, 1, 136, 97, 36, 202, 8, 160, 16, 114, 55, 1, 17, 144, 171, 154, 136, 186, 117, 5, 136, 66, 20, 136, 8, 144, 236, 154, 16, 128, 98, 52, 1, 152, 137, 219, 172, 136, 0, 33, 17, 33, 160, 137, 129, 236, 154, 201, 188, 9, 152, 10, 51, 17, 218, 140, 184, 10, 41, 0, 160, 173, 169, 140, 145, 206, 154, 34, 161, 74, 39, 161, 153, 186, 203, 189, 26, 50, 51, 51, 53, 177, 190, 171, 170, 138, 82, 129, 32, 20, 202, 58, 38, 185, 26, 147, 206, 8, 0, 16, 33, 51, 19, 160, 191, 9, 32, 176, 143, 116, 145, 138, 35, 160, 11, 67, 193, 155, 145, 139, 33, 119, 129, 24, 130, 233, 189, 41, 2, 154, 116, 19, 152, 9, 146, 191, 10, 16, 35, 153, 84, 144, 138, 17, 168, 42, 23, 186, 25, 160, 136, 186, 115, 132, 56, 208, 41, 209, 11, 148, 190, 169, 154, 8, 64, 119, 19, 17, 145, 204, 203, 154, 9, 65, 53, 36, 3, 169, 138, 186, 173, 9, 66, 2, 48, 37, 1, 16, 17, 200, 203, 219, 10, 17, 49, 69, 34, 160, 170, 235, 138, 136, 153, 152, 170, 251, 155, 17, 33, 69, 161, 188, 204, 188, 171, 137, 0, 33, 18, 0, 129, 219, 203, 204, 189, 171, 169, 24, 68, 52, 2, 152, 185, 191, 171, 8, 32, 33, 83, 35, 128, 56, 21, 186, 138, 184, 154, 56, 87, 34, 67, 17, 16, 8, 17, 8, 33, 202, 96, 130, 57, 119, 34, 1, 16, 161, 186, 186, 40, 51, 116, 35, 67, 3, 8, 0, 185, 174, 138, 152, 88, 55, 18, 34, 129, 234, 172, 9, 153, 40, 19, 84, 145, 25, 144, 8, 251, 25, 192, 140, 2, 17, 36, 50, 131, 138, 177, 255, 16, 129, 32, 3, 24, 1, 24, 3, 113, 134, 155, 54, 192, 171, 66, 3, 155, 116, 2, 153, 136, 33, 200, 11, 35, 24, 128, 74, 103, 144, 137, 2, 218, 154, 40, 19, 137, 85, 129, 156, 137, 152, 168, 139, 115, 129, 171, 24, 128, 203, 41, 36, 250, 139, 17, 201, 10, 49, 18, 200, 172, 8, 219, 42, 36, 136, 168, 141, 160, 207, 48, 3, 8, 17, 144, 222, 155, 24, 0, 32, 51, 3, 251, 158, 24, 160, 27, 38, 152, 154, 171, 32, 185, 113, 19, 153, 172, 9, 203, 57, 18, 53, 192, 27, 193, 174, 32, 19, 18, 34, 147, 206, 9, 185, 44, 55, 144, 33, 131, 173, 33, 136, 17, 16, 101, 129, 139, 136, 8, 3, 187, 69, 144, 18, 205, 49, 129, 152, 40, 209, 43, 227, 159, 18, 152, 81, 130, 8, 168, 139, 161, 173, 24, 48, 38, 8, 68, 17, 176, 175, 24, 219, 41, 19, 153, 0, 2, 251, 157, 218, 11, 3, 11, 119, 4, 8, 128, 201, 172, 9, 8, 83, 66, 51, 145, 155, 160, 205, 24, 18, 34, 18, 66, 3, 170, 115, 146, 137, 184, 155, 203, 96, 52, 17, 17, 145, 251, 172, 25, 128, 8, 16, 184, 206, 137, 152, 8, 50, 160, 189, 221, 203, 169, 138, 16, 18, 160, 137, 192, 205, 170, 154, 219, 173, 136, 24, 19, 33, 54, 184, 189, 172, 154, 170, 82, 35, 51, 2, 24, 161, 172, 154, 153, 16, 53, 1, 117, 35, 17, 129, 33, 161, 155, 168, 183, 231, 32, 0, 25, 51, 87, 35, 84, 35, 17, 17, 169, 203, 155, 65, 52, 67, 84, 35, 16, 8, 48, 162, 157, 49, 176, 10, 103, 20, 17, 35, 160, 186, 191, 41, 129, 73, 52, 51, 200, 41, 160, 138, 218, 40, 201, 72, 178, 28, 23, 137, 51, 219, 48, 192, 156, 1, 40, 19, 32, 34, 51, 251, 60, 132, 140, 34, 8, 4, 185, 139, 115, 7, 170, 33, 19, 218, 26, 4, 171, 83, 145, 83, 161, 8, 219, 24, 234, 88, 19, 49, 145, 9, 160, 190, 154, 80, 20, 154, 68, 161, 171, 9, 129, 187, 80, 131, 188, 25, 145, 154, 1, 65, 179, 255, 137, 152, 153, 137, 52, 178, 174, 16, 201, 171, 34, 128, 136, 188, 137, 220, 9, 17, 67, 2, 168, 221, 155, 153, 137, 56, 103, 129, 9, 152, 185, 173, 56, 20, 49, 147, 155, 18, 188, 40, 116, 3, 155, 129, 172, 136, 10, 69, 17, 21, 202, 24, 200, 154, 40, 131, 139, 52, 204, 80, 36, 1, 129, 33, 252, 175, 8, 9, 34, 34, 53, 129, 187, 188, 169, 189, 64, 20, 0, 128, 9, 129, 137, 17, 128, 144, 174, 170, 43, 53, 116, 2, 24, 192, 173, 153, 11, 17, 97, 38, 144, 33, 152, 136, 217, 139, 34, 184, 10, 71, 145, 136, 97, 130, 219, 41, 18, 189, 41, 21, 129, 137, 48, 216, 155, 160, 41, 20, 16, 152, 169, 222, 189, 154, 40, 53, 67, 69, 2, 218, 172, 137, 169, 11, 87, 2, 1, 145, 153, 185, 154, 0, 64, 36, 17, 129, 11, 37, 168, 65, 144, 169, 205, 40, 1, 32, 98, 20, 201, 154, 128, 152, 154, 128, 218, 187, 189, 25, 38, 34, 2, 219, 219, 189, 171, 138, 48, 34, 49, 147, 174, 169, 204, 187, 170, 202, 156, 16, 16, 68, 19, 130, 205, 188, 172, 137, 9, 67, 35, 17, 129, 16, 208, 43, 193, 156, 200, 57, 22, 56, 52, 2, 129, 0, 136, 186, 153, 172, 114, 131, 104, 55, 2, 24, 18, 251, 138, 0, 136, 56, 55, 1, 50, 146, 138, 18, 251, 9, 130, 140, 66, 50, 83, 51, 160, 154, 233, 205, 24, 34, 0, 66, 21, 184, 25, 161, 170, 186, 41, 51, 130, 42, 119, 130, 9, 33, 136, 219, 139, 2, 10, 22, 65, 21, 9, 130, 8, 147, 191, 49, 144, 9, 187, 116, 131, 64, 20, 32, 160, 155, 251, 143, 1, 8, 83, 18, 18, 160, 186, 205, 171, 137, 83, 3, 33, 36, 168, 172, 153, 219, 10, 1, 154, 16, 34, 35, 8, 161, 207, 235, 188, 24, 145, 48, 36, 3, 236, 155, 152, 139, 0, 56, 39, 217, 137, 136, 144, 155, 85, 130, 171, 137, 153, 170, 72, 37, 16, 2, 204, 0, 203, 80, 131, 25, 130, 41, 240, 12, 20, 128, 34, 16, 184, 173, 184, 57, 7, 40, 55, 169, 170, 9, 162, 159, 98, 144, 24, 145, 11, 2, 27, 38, 168, 184, 142, 34, 186, 114, 35, 2, 123, 9, 45, 0, 204, 10, 185, 172, 64, 38, 0, 49, 177, 191, 137, 137, 16, 65, 5, 8, 146, 188, 128, 154, 2, 10, 52, 185, 88, 177, 75, 7, 186, 32, 176, 173, 16, 34, 34, 144, 24, 218, 10, 48, 85, 36, 235, 40, 233, 139, 17, 33, 2, 114, 147, 173, 128, 187, 153, 203, 64, 129, 65, 17, 85, 146, 170, 186, 189, 187, 48, 52, 69, 36, 128, 169, 154, 203, 10, 34, 51, 19, 115, 2, 154, 66, 3, 137, 152, 153, 251, 57, 22, 32, 52, 129, 154, 128, 8, 168, 42, 249, 143, 168, 25, 51, 66, 37, 177, 190, 186, 188, 153, 137, 66, 34, 2, 235, 25, 218, 187, 153, 186, 188, 137, 8, 49, 19, 34, 250, 223, 170, 137, 154, 48, 2, 137, 33, 200, 172, 9, 131, 222, 138, 144, 170, 80, 131, 25, 36, 168, 153, 170, 185, 190, 25, 17, 50, 18, 119, 23, 152, 136, 0, 218, 9, 35, 24, 83, 50, 51, 168, 65, 146, 170, 156, 49, 136, 116, 39, 1, 33, 129, 219, 8, 128, 136, 80, 38, 152, 33, 145, 8, 2, 0, 24, 144, 156, 69, 161, 26, 86, 18, 144, 153, 66, 217, 26, 36, 128, 9, 83, 162, 73, 20, 152, 32, 129, 222, 41, 19, 153, 65, 51, 232, 11, 19, 153, 50, 24, 71, 185, 203, 171, 33, 49, 54, 34, 130, 186, 223, 26, 129, 171, 100, 145, 153, 17, 128, 169, 136, 201, 171, 186, 58, 39, 185, 58, 133, 190, 10, 52, 216, 27, 19, 236, 155, 16, 129, 8, 51, 52, 216, 172, 168, 171, 187, 89, 53, 152, 72, 20, 202, 9, 145, 204, 9, 0, 40, 36, 17, 17, 33, 251, 43, 194, 12, 19, 0, 1, 49, 161, 141, 161, 11, 119, 17, 169, 16, 184, 10, 144, 81, 131, 153, 114, 148, 187, 137, 16, 249, 43, 23, 0, 130, 11, 4, 191, 136, 8, 34, 152, 80, 2, 155, 128, 203, 25, 8, 65, 2, 170, 136, 80, 227, 142, 35, 187, 114, 18, 1, 186, 25, 233, 139, 128, 81, 52, 2, 24, 177, 207, 152, 9, 33, 0, 85, 130, 9, 144, 155, 152, 189, 40, 52, 144, 112, 20, 144, 154, 186, 204, 26, 2, 25, 39, 16, 20, 202, 155, 201, 155, 33, 17, 17, 0, 82, 193, 142, 52, 249, 10, 145, 188, 8, 17, 51, 0, 40, 208, 175, 153, 137, 67, 128, 102, 145, 171, 16, 184, 41, 37, 17, 130, 157, 34, 219, 88, 19, 8, 18, 169, 0, 216, 11, 38, 8, 33, 8, 19, 191, 98, 160, 41, 147, 140, 176, 140, 51, 24, 35, 185, 9, 252, 156, 0, 168, 32, 19, 201, 172, 203, 170, 24, 144, 153, 152, 249, 207, 24, 161, 10, 4, 218, 136, 202, 137, 17, 17, 147, 189, 152, 222, 24, 144, 81, 4, 154, 0, 234, 139, 32, 33, 129, 40, 20, 187, 154, 154, 52, 153, 65, 184, 57, 129, 50, 222, 114, 178, 59, 6, 138, 1, 136, 3, 139, 137, 240, 33, 0, 39, 186, 49, 128, 24, 69, 129, 56, 129, 50, 236, 40, 35, 84, 18, 136, 9, 2, 175, 65, 17, 52, 136, 49, 192, 203, 40, 51, 71, 146, 40, 131, 189, 24, 18, 33, 19, 86, 193, 11, 19, 9, 51, 49, 22, 137, 2, 8, 18, 113, 36, 144, 220, 10, 17, 81, 52, 130, 40, 194, 207, 24, 2, 24, 50, 2, 218, 155, 18, 169, 64, 35, 160, 223, 25, 160, 156, 82, 18, 128, 204, 9, 234, 25, 19, 32, 162, 140, 177, 223, 136, 0, 35, 129, 18, 217, 171, 186, 10, 51, 0, 37, 234, 138, 168, 56, 38, 16, 3, 190, 8, 202, 32, 0, 85, 146, 171, 8, 185, 64, 82, 71, 160, 138, 176, 157, 24, 50, 52, 128, 128, 251, 155, 0, 24, 84, 3, 0, 200, 190, 137, 9, 50, 66, 68, 129, 152, 188, 170, 155, 83, 2, 65, 35, 129, 186, 156, 169, 41, 177, 106, 5, 153, 33, 168, 188, 114, 19, 144, 172, 33, 249, 142, 1, 136, 50, 3, 18, 234, 25, 160, 172, 154, 66, 208, 59, 39, 129, 153, 8, 202, 172, 137, 34, 145, 113, 4, 169, 169, 203, 153, 187, 114, 5, 10, 129, 170, 185, 141, 35, 144, 153, 8, 201, 172, 0, 0, 136, 169, 32, 82, 20, 202, 32, 160, 219, 58, 5, 42, 103, 169, 65, 144, 11, 136, 65, 161, 43, 37, 0, 184, 26, 39, 152, 152, 56, 5, 175, 97, 146, 10, 17, 153, 153, 32, 5, 185, 49, 146, 139, 1, 99, 3, 187, 66, 251, 142, 136, 64, 19, 9, 53, 249, 155, 136, 136, 64, 34, 35, 176, 187, 205, 138, 136, 114, 3, 128, 160, 187, 219, 72, 21, 0, 19, 249, 139, 169, 10, 49, 53, 145, 83, 232, 154, 152, 169, 138, 68, 129, 25, 145, 187, 203, 24, 168, 32, 220, 48, 4, 187, 105, 19, 205, 11, 35, 168, 49, 50, 21, 205, 152, 170, 137, 56, 87, 19, 152, 153, 235, 172, 25, 35, 34, 34, 18, 201, 8, 184, 11, 70, 129, 25, 144, 139, 53, 50, 71, 0, 152, 187, 32, 232, 26, 54, 130, 26, 84, 1, 32, 128, 169, 218, 188, 41, 52, 32, 102, 19, 136, 169, 186, 202, 138, 82, 34, 33, 35, 18, 152, 186, 154, 234, 188, 42, 53, 17, 83, 36, 129, 153, 200, 189, 186, 171, 115, 2, 48, 52, 162, 189, 25, 217, 173, 0, 128, 48, 36, 34, 2, 219, 154, 218, 172, 16, 1, 32, 34, 17, 201, 172, 33, 178, 191, 56, 178, 159, 68, 145, 155, 128, 9, 152, 42, 5, 172, 32, 35, 0, 99, 20, 216, 173, 128, 186, 25, 85, 2, 0, 17, 144, 204, 154, 10, 55, 160, 81, 192, 188, 9, 33, 18, 83, 2, 202, 189, 154, 152, 41, 54, 19, 129, 136, 152, 153, 221, 156, 168, 26, 34, 116, 6, 0, 128, 170, 202, 155, 8, 48, 38, 32, 2, 219, 170, 40, 20, 9, 83, 162, 190, 138, 160, 9, 31, 255, 37, 0, 69, 51, 20, 160, 172, 186, 204, 138, 67, 17, 84, 2, 152, 169, 169, 219, 157, 9, 40, 68, 66, 20, 168, 187, 172, 186, 171, 65, 53, 128, 16, 1, 186, 188, 172, 8, 152, 188, 112, 130, 138, 52, 160, 188, 170, 219, 10, 83, 68, 19, 152, 154, 185, 173, 32, 144, 40, 68, 35, 129, 169, 187, 204, 189, 26, 50, 17, 67, 2, 83, 217, 11, 129, 203, 187, 25, 216, 156, 24, 115, 53, 50, 128, 184, 255, 154, 136, 0, 51, 52, 18, 34, 249, 172, 136, 185, 10, 52, 2, 32, 84, 145, 153, 200, 173, 152, 137, 66, 67, 19, 50, 160, 157, 153, 155, 153, 42, 50, 84, 34, 84, 18, 8, 200, 189, 170, 189, 72, 19, 48, 55, 176, 154, 185, 187, 157, 32, 152, 80, 35, 17, 36, 129, 160, 239, 155, 153, 16, 67, 51, 19, 152, 152, 221, 154, 184, 74, 38, 137, 49, 145, 154, 8, 186, 170, 10, 20, 10, 71, 17, 0, 49, 177, 174, 41, 20, 219, 136, 40, 55, 2, 83, 2, 170, 137, 153, 32, 8, 117, 2, 152, 8, 130, 154, 128, 116, 131, 137, 50, 248, 139, 67, 2, 40, 21, 185, 114, 161, 11, 1, 202, 137, 115, 51, 50, 18, 136, 253, 139, 168, 137, 34, 68, 36, 128, 169, 186, 235, 154, 17, 33, 53, 129, 154, 188, 171, 8, 153, 56, 39, 145, 16, 200, 173, 136, 32, 35, 160, 42, 119, 1, 137, 186, 203, 204, 26, 52, 0, 33, 36, 177, 191, 138, 33, 145, 204, 32, 146, 188, 42, 39, 144, 48, 35, 250, 189, 8, 17, 32, 84, 129, 186, 154, 1, 168, 203, 9, 129, 188, 113, 34, 34, 51, 232, 189, 136, 153, 65, 36, 18, 129, 187, 202, 156, 65, 36, 176, 10, 17, 8, 66, 85, 130, 169, 236, 172, 137, 32, 54, 1, 49, 145, 172, 203, 154, 153, 65, 146, 140, 52, 136, 67, 130, 219, 174, 170, 138, 67, 52, 3, 186, 152, 188, 128, 219, 32, 20, 0, 168, 113, 177, 157, 160, 138, 145, 42, 55, 34, 131, 220, 154, 218, 155, 48, 36, 50, 2, 160, 220, 155, 24, 1, 152, 10, 68, 34, 34, 48, 71, 152, 33, 234, 25, 161, 41, 161, 120, 19, 32, 50, 18, 202, 33, 249, 189, 10, 16, 115, 20, 8, 144, 171, 136, 185, 172, 136, 168, 9, 68, 70, 145, 9, 130, 207, 171, 8, 51, 129, 114, 20, 153, 187, 155, 186, 26, 34, 101, 146, 140, 0, 153, 8, 16, 208, 139, 35, 50, 193, 158, 33, 184, 138, 32, 2, 115, 23, 153, 186, 172, 184, 158, 16, 48, 39, 8, 129, 219, 138, 170, 136, 136, 50, 35, 85, 2, 203, 137, 203, 25, 145, 25, 66, 70, 19, 152, 219, 187, 153, 65, 18, 16, 68, 37, 185, 188, 187, 48, 67, 71, 2, 136, 201, 154, 144, 26, 52, 82, 36, 153, 153, 187, 40, 69, 19, 137, 33, 129, 185, 40, 249, 43, 20, 154, 0, 28, 0, 65, 146, 88, 132, 27, 4, 175, 128, 170, 16, 8, 52, 128, 83, 177, 10, 217, 12, 2, 65, 146, 139, 129, 24, 32, 71, 185, 168, 190, 17, 187, 72, 130, 49, 18, 65, 192, 74, 179, 159, 1, 236, 170, 48, 35, 99, 36, 16, 129, 251, 187, 153, 137, 81, 67, 35, 17, 1, 153, 204, 203, 186, 9, 98, 35, 49, 53, 144, 152, 220, 187, 170, 64, 53, 18, 32, 34, 152, 187, 221, 203, 9, 33, 66, 51, 67, 2, 187, 170, 237, 154, 8, 17, 66, 20, 16, 18, 251, 155, 152, 9, 49, 68, 129, 8, 51, 146, 204, 204, 137, 33, 36, 160, 154, 201, 156, 24, 136, 201, 205, 138, 17, 19, 0, 8, 177, 255, 9, 9, 2, 235, 25, 1, 152, 136, 8, 169, 203, 204, 10, 19, 24, 101, 19, 201, 172, 203, 139, 16, 68, 51, 52, 144, 138, 235, 156, 168, 187, 16, 67, 67, 54, 130, 185, 189, 202, 187, 9, 81, 51, 33, 51, 176, 173, 186, 140, 17, 234, 171, 152, 25, 87, 51, 1, 184, 187, 202, 172, 0, 144, 136, 32, 85, 20, 136, 16, 219, 170, 169, 188, 25, 70, 36, 49, 1, 202, 188, 153, 169, 72, 55, 18, 136, 128, 128, 16, 0, 34, 161, 171, 32, 115, 51, 114, 19, 137, 144, 203, 188, 12, 67, 128, 67, 145, 48, 35, 128, 8, 216, 158, 0, 218, 154, 170, 64, 67, 52, 176, 155, 145, 153, 235, 188, 137, 48, 22, 8, 51, 250, 188, 187, 172, 64, 35, 34, 128, 186, 174, 137, 152, 186, 170, 26, 85, 52, 36, 153, 25, 160, 173, 154, 154, 80, 69, 67, 129, 152, 154, 186, 10, 84, 19, 18, 128, 168, 204, 11, 17, 2, 185, 24, 129, 114, 4, 16, 184, 139, 51, 145, 170, 69, 130, 41, 87, 145, 170, 203, 11, 129, 139, 71, 1, 16, 128, 187, 139, 1, 17, 17, 33, 33, 51, 217, 187, 9, 37, 1, 49, 19, 170, 41, 3, 16, 146, 10, 18, 186, 25, 19, 185, 25, 51, 1, 16, 34, 153, 153, 9, 145, 153, 153, 16, 2, 0, 1, 144, 0, 9, 153, 154, 1, 0, 144, 9, 16, 0, 153, 153, 9, 0, 9, 9, 1, 144, 144, 0, 16, 144, 0, 9, 0, 9, 0, 9, 1, 153, 9, 1, 9, 1, 144, 0, 0, 0, 0, 153, 25, 1, 0, 144, 153, 16, 145, 153, 17, 9, 0, 0, 0, 144, 0, 0, 145, 9, 145, 25, 146, 9, 145, 9, 1, 0, 144, 16, 145, 9, 1, 0, 9, 0, 0, 0, 0, 0, 144, 16, 0, 9, 0, 16, 0, 9, 0, 16, 0, 0, 144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
-static const size_t audio_fifty_sample_data_length = sizeof(audio_fifty_sample_data) / sizeof(audio_fifty_sample_data[0]);
+static const size_t audio_fifty_sample_data_length = 24397;
@@ -1,4 +1,4 @@
-// This file was generated by a script on 03-12-2024 08:35:22
+// This file was generated by a script on 17-10-2026 14:18:54
 
 #pragma once
 
@@ -6,6 +6,7 @@
 #include <stdint.h>
 #include <pico/platform/sections.h>
 
-static const int16_t __in_flash("audio_five_sample_data") audio_five_sample_data[] = { 40, -4, -168, -368, -333, 49, 487, 583, 304, -10, -29, 235, 441, 306, -21, -121, 165, 489, 438, 104, -55, 110, 255, 120, -89, -121, -42, 7, 9, -88, -301, -386, -179, 37, -15, -152, -134, -54, 36, 252, 446, 348, 169, 300, 549, 459, 138, 27, 185, 382, 517, 528, 302, -19, -96, 116, 323, 339, 270, 228, 200, 170, 170, 147, -20, -340, -596, -542, -203, 121, 208, 164, 207, 313, 271, 40, -166, -186, -97, -43, -15, 65, 169, 229, 280, 366, 387, 249, 70, 0, -24, -105, -150, -57, 51, 6, -131, -171, -80, 41, 146, 261, 328, 228, -28, -275, -398, -420, -375, -282, -207, -154, -24, 160, 216, 116, 55, 67, -46, -274, -321, -130, -24, -173, -288, -103, 157, 154, 4, 29, 165, 158, 104, 197, 231, 2, -172, 0, 203, 74, -148, -107, 59, 71, 38, 168, 279, 75, -284, -361, -97, 102, 29, -80, -17, 106, 137, 122, 129, 149, 168, 140, 3, -181, -309, -420, -537, -489, -207, 43, 78, 124, 371, 572, 448, 165, 12, -53, -190, -282, -116, 192, 322, 230, 210, 380, 423, 78, -334, -318, -7, 19, -249, -200, 280, 545, 319, 151, 353, 448, 86, -319, -324, -143, -164, -282, -187, 48, 132, 76, 77, 77, -14, 42, 391, 662, 554, 348, 340, 383, 368, 433, 472, 223, -105, -61, 250, 334, 136, -15, -98, -378, -739, -693, -167, 268, 212, -11, 41, 204, 38, -365, -504, -305, -210, -363, -329, 132, 604, 678, 511, 350, 108, -206, -284, -86, 0, -144, -142, 175, 421, 259, -99, -237, -69, 168, 322, 473, 683, 770, 587, 362, 424, 644, 576, 169, -173, -281, -392, -613, -740, -705, -691, -738, -672, -463, -305, -351, -545, -679, -589, -349, -228, -325, -463, -532, -607, -635, -471, -275, -341, -515, -401, -72, 33, -154, -296, -242, -149, -93, 3, 128, 168, 145, 156, 124, -119, -487, -679, -655, -635, -620, -411, -111, -7, -25, 112, 319, 321, 169, 53, -98, -337, -385, -77, 210, 70, -223, -106, 307, 344, -83, -303, -24, 273, 315, 418, 716, 893, 849, 812, 827, 762, 661, 563, 343, 53, 14, 280, 488, 406, 225, 109, -118, -571, -954, -1018, -1028, -1308, -1589, -1411, -941, -701, -679, -435, 4, 96, -260, -469, -264, -222, -694, -1022, -613, 22, 222, 204, 314, 320, 186, 319, 593, 462, 74, -71, -180, -555, -716, -345, -19, -42, 147, 714, 1024, 974, 1274, 2018, 2339, 1863, 1362, 1479, 1739, 1443, 829, 551, 576, 506, 491, 824, 1114, 846, 299, 55, 98, 117, 130, 244, 302, 191, 84, 127, 191, 71, -244, -510, -487, -320, -432, -826, -958, -636, -404, -621, -916, -1011, -1168, -1427, -1357, -907, -499, -224, 111, 331, 185, -72, -138, -210, -483, -767, -974, -1272, -1545, -1429, -940, -467, -211, -102, -62, 13, 236, 465, 410, 93, -125, 2, 444, 996, 1357, 1370, 1293, 1416, 1510, 1197, 702, 525, 597, 531, 382, 438, 599, 578, 432, 365, 355, 301, 204, 62, -156, -430, -758, -1093, -1195, -1042, -1136, -1674, -1955, -1556, -1229, -1498, -1566, -888, -316, -420, -397, 228, 606, 248, -67, 198, 493, 310, -89, -283, -173, 104, 284, 243, 236, 442, 522, 238, -8, 94, 212, 109, 116, 339, 324, -27, -200, 14, 247, 264, 156, 8, -28, 200, 442, 350, 220, 453, 661, 415, 236, 616, 948, 663, 313, 410, 434, -49, -508, -415, -48, 172, 212, 111, -136, -371, -414, -291, -106, 21, -106, -522, -868, -829, -630, -702, -980, -997, -600, -148, 66, 186, 374, 448, 217, -87, -116, 61, 131, 83, 191, 467, 576, 365, 99, 9, -62, -316, -590, -632, -564, -690, -913, -818, -368, -46, -117, -221, -4, 295, 311, 162, 164, 271, 222, 41, -41, -19, -95, -305, -461, -499, -594, -828, -980, -844, -581, -505, -629, -716, -723, -859, -1181, -1492, -1723, -2032, -2409, -2572, -2419, -2232, -2279, -2489, -2655, -2758, -2950, -3304, -3693, -3917, -3928, -3862, -3840, -3816, -3725, -3658, -3755, -3943, -3967, -3728, -3429, -3256, -3102, -2796, -2435, -2247, -2217, -2141, -2048, -2220, -2659, -2916, -2692, -2260, -1902, -1391, -507, 359, 755, 951, 1506, 2371, 3019, 3293, 3529, 3945, 4395, 4744, 5071, 5384, 5510, 5409, 5317, 5354, 5332, 5141, 5057, 5363, 5907, 6340, 6621, 6952, 7312, 7449, 7336, 7197, 7067, 6778, 6363, 6052, 5846, 5539, 5128, 4822, 4700, 4672, 4673, 4714, 4828, 5064, 5416, 5753, 5933, 5951, 5849, 5565, 5052, 4465, 4057, 3837, 3577, 3212, 2946, 2836, 2632, 2251, 2025, 2146, 2306, 2198, 2006, 2045, 2247, 2310, 2154, 1942, 1766, 1557, 1281, 1075, 1077, 1207, 1281, 1281, 1360, 1522, 1567, 1429, 1338, 1469, 1667, 1710, 1636, 1601, 1582, 1423, 1075, 649, 246, -162, -659, -1213, -1644, -1857, -1969, -2076, -2081, -1937, -1829, -1884, -1946, -1916, -2016, -2423, -2906, -3177, -3363, -3791, -4383, -4706, -4609, -4435, -4466, -4510, -4287, -3887, -3577, -3393, -3188, -2934, -2744, -2674, -2614, -2426, -2164, -2089, -2293, -2471, -2318, -2001, -1885, -1966, -1968, -1838, -1738, -1655, -1431, -1122, -963, -957, -860, -640, -606, -907, -1264, -1455, -1664, -2077, -2509, -2739, -2885, -3123, -3361, -3437, -3412, -3456, -3618, -3815, -3943, -4000, -4101, -4350, -4677, -4943, -5123, -5253, -5317, -5322, -5321, -5263, -5050, -4787, -4679, -4650, -4452, -4133, -3963, -3947, -3840, -3584, -3359, -3247, -3171, -3075, -2968, -2847, -2683, -2448, -2118, -1747, -1444, -1251, -1093, -940, -880, -957, -1022, -934, -815, -884, -1045, -989, -735, -630, -729, -710, -492, -372, -415, -326, -52, 83, -27, -72, 128, 321, 255, 70, 22, 51, -76, -337, -460, -391, -390, -576, -680, -471, -163, -97, -210, -180, 22, 116, 3, -118, -131, -145, -229, -259, -142, 0, -5, -149, -245, -187, -80, -72, -154, -215, -231, -276, -390, -505, -564, -622, -742, -856, -868, -847, -932, -1069, -1056, -877, -747, -762, -766, -638, -483, -431, -418, -329, -203, -175, -248, -273, -178, -120, -245, -399, -324, -75, 32, -53, -54, 145, 311, 304, 316, 478, 575, 383, 59, -77, 0, 23, -135, -298, -284, -186, -200, -315, -378, -376, -414, -465, -392, -235, -183, -256, -309, -324, -372, -414, -400, -425, -520, -525, -392, -334, -462, -602, -609, -546, -469, -330, -154, -112, -304, -611, -849, -951, -951, -917, -995, -1295, -1616, -1604, -1340, -1300, -1586, -1767, -1641, -1515, -1588, -1705, -1782, -1884, -1963, -2001, -2191, -2528, -2627, -2307, -1974, -2035, -2287, -2252, -1864, -1534, -1616, -1997, -2243, -2077, -1660, -1338, -1182, -905, -265, 537, 1039, 1095, 1075, 1346, 1789, 2029, 1951, 1789, 1790, 1947, 2031, 1989, 2192, 2836, 3292, 2861, 2043, 1895, 2312, 2337, 1878, 1622, 1568, 1187, 621, 327, 121, -327, -710, -696, -650, -980, -1449, -1652, -1648, -1746, -2037, -2273, -2188, -1975, -2247, -3154, -4101, -4859, -6025, -7705, -9157, -10558, -13141, -16757, -19460, -20336, -20179, -19082, -16155, -11876, -7994, -5170, -2856, -958, 429, 2069, 4673, 7749, 10488, 12932, 15551, 18403, 21266, 23993, 26471, 28530, 30053, 31033, 31564, 31810, 31999, 32304, 32642, 32767, 32593, 32246, 31682, 30722, 29491, 28211, 26667, 24517, 21877, 18970, 15625, 11988, 8991, 7134, 5649, 3646, 1349, -646, -2445, -4453, -6528, -8142, -9142, -9861, -10687, -11593, -12142, -12015, -11368, -10509, -9382, -7736, -5625, -3473, -1699, -537, -39, 0, 19, 413, 1291, 2510, 3789, 4774, 5222, 5150, 4757, 4320, 4158, 4487, 5145, 5667, 5780, 5682, 5693, 5760, 5576, 5076, 4519, 4070, 3630, 3163, 2850, 2818, 2973, 3259, 3769, 4499, 5216, 5691, 5931, 6083, 6222, 6317, 6369, 6470, 6666, 6813, 6717, 6383, 5977, 5575, 5092, 4522, 3937, 3244, 2198, 773, -704, -1950, -3078, -4405, -6030, -7707, -9143, -10291, -11298, -12208, -12913, -13379, -13756, -14122, -14354, -14349, -14196, -13948, -13488, -12709, -11673, -10480, -9156, -7780, -6502, -5385, -4343, -3288, -2234, -1213, -187, 882, 1949, 2901, 3700, 4403, 5021, 5416, 5448, 5171, 4730, 4125, 3288, 2321, 1390, 476, -507, -1514, -2518, -3624, -4813, -5878, -6796, -7822, -9024, -10145, -10989, -11609, -12078, -12414, -12688, -12942, -13119, -13215, -13321, -13405, -13293, -12945, -12543, -12219, -11908, -11498, -10993, -10464, -9977, -9547, -9127, -8655, -8079, -7382, -6624, -5971, -5607, -5536, -5528, -5352, -5013, -4707, -4539, -4421, -4272, -4188, -4270, -4450, -4564, -4567, -4530, -4515, -4526, -4516, -4403, -4161, -3910, -3813, -3886, -3991, -4036, -4055, -4129, -4268, -4409, -4475, -4432, -4302, -4151, -4075, -4140, -4331, -4539, -4698, -4877, -5155, -5478, -5752, -6010, -6338, -6687, -6952, -7126, -7266, -7392, -7523, -7707, -7935, -8102, -8161, -8184, -8224, -8202, -8005, -7671, -7368, -7190, -7059, -6856, -6561, -6234, -5904, -5556, -5188, -4815, -4416, -3940, -3378, -2795, -2281, -1895, -1641, -1453, -1256, -1063, -967, -979, -992, -935, -858, -796, -705, -559, -406, -280, -168, -71, -30, -67, -170, -329, -518, -677, -750, -759, -773, -810, -803, -699, -532, -363, -224, -126, -82, -70, -47, 4, 75, 160, 259, 363, 449, 507, 510, 450, 386, 410, 527, 618, 572, 424, 320, 339, 397, 350, 154, -102, -330, -514, -652, -710, -701, -744, -934, -1201, -1373, -1385, -1329, -1284, -1215, -1097, -981, -832, -506, 22, 568, 992, 1371, 1808, 2263, 2680, 3104, 3564, 3999, 4384, 4830, 5424, 6074, 6638, 7102, 7481, 7663, 7595, 7494, 7601, 7873, 8114, 8258, 8264, 8021, 7549, 7086, 6800, 6611, 6382, 6060, 5624, 5069, 4509, 4095, 3878, 3784, 3700, 3514, 3194, 2819, 2500, 2270, 2104, 1983, 1873, 1713, 1498, 1307, 1231, 1292, 1484, 1820, 2276, 2742, 3099, 3334, 3527, 3704, 3821, 3885, 3989, 4190, 4410, 4550, 4635, 4791, 5081, 5441, 5759, 5985, 6139, 6262, 6378, 6466, 6480, 6402, 6280, 6157, 6021, 5855, 5664, 5426, 5092, 4674, 4328, 4222, 4350, 4485, 4401, 4106, 3832, 3732, 3695, 3557, 3360, 3190, 2957, 2584, 2220, 2014, 1872, 1667, 1467, 1356, 1252, 1103, 1031, 1127, 1277, 1344, 1369, 1436, 1468, 1338, 1092, 873, 658, 353, 64, 10, 186, 364, 448, 555, 726, 820, 741, 611, 597, 645, 537, 192, -186, -362, -355, -357, -424, -458, -421, -379, -326, -180, 42, 195, 218, 180, 87, -187, -644, -1014, -1081, -993, -1003, -1076, -1022, -888, -899, -1117, -1417, -1705, -1939, -2090, -2199, -2385, -2678, -2931, -2949, -2671, -2231, -1893, -1879, -2215, -2704, -3114, -3348, -3448, -3475, -3434, -3323, -3161, -2947, -2681, -2433, -2295, -2233, -2150, -2075, -2142, -2364, -2588, -2666, -2587, -2482, -2509, -2617, -2557, -2307, -2207, -2425, -2645, -2647, -2735, -3164, -3595, -3669, -3691, -4188, -5009, -5526, -5577, -5725, -6448, -7595, -8809, -10072, -11461, -12702, -13345, -13235, -12516, -11298, -9510, -7132, -4379, -1642, 737, 2729, 4687, 7037, 9737, 12267, 14335, 16320, 18673, 21256, 23669, 25818, 27725, 29204, 30105, 30513, 30545, 30349, 30191, 30100, 29731, 29028, 28305, 27394, 25660, 23168, 20688, 18373, 15690, 12597, 9592, 6728, 3823, 1180, -871, -2621, -4399, -5974, -7183, -8338, -9659, -10900, -11788, -12308, -12538, -12566, -12471, -12130, -11315, -10110, -8854, -7637, -6212, -4445, -2555, -898, 302, 1046, 1555, 2068, 2664, 3383, 4378, 5672, 6925, 7802, 8416, 9114, 9882, 10331, 10293, 10065, 9996, 10058, 10026, 9866, 9768, 9858, 10090, 10340, 10454, 10355, 10147, 10001, 9928, 9862, 9878, 10059, 10293, 10444, 10563, 10688, 10664, 10325, 9685, 8845, 7911, 7018, 6168, 5207, 4102, 3091, 2289, 1459, 399, -786, -1994, -3363, -5041, -6903, -8683, -10260, -11676, -13041, -14401, -15669, -16684, -17312, -17529, -17394, -17022, -16506, -15883, -15172, -14438, -13697, -12804, -11572, -10049, -8470, -6936, -5326, -3546, -1710, -20, 1455, 2804, 4148, 5509, 6765, 7772, 8475, 8945, 9248, 9371, 9240, 8822, 8137, 7226, 6115, 4826, 3420, 1983, 565, -852, -2330, -3862, -5328, -6574, -7553, -8395, -9288, -10332, -11482, -12595, -13537, -14262, -14786, -15147, -15333, -15321, -15134, -14851, -14537, -14185, -13768, -13295, -12838, -12447, -12119, -11823, -11558, -11327, -11074, -10742, -10327, -9886, -9429, -8926, -8386, -7883, -7519, -7335, -7241, -7041, -6596, -5983, -5416, -5003, -4731, -4556, -4398, -4146, -3771, -3376, -3027, -2695, -2376, -2067, -1671, -1123, -580, -235, -62, 54, 84, -61, -342, -694, -1145, -1712, -2299, -2805, -3215, -3591, -4027, -4589, -5219, -5808, -6338, -6904, -7557, -8224, -8836, -9403, -9938, -10381, -10662, -10797, -10862, -10884, -10834, -10697, -10481, -10179, -9798, -9391, -8981, -8518, -7974, -7402, -6838, -6258, -5668, -5140, -4712, -4340, -3974, -3576, -3114, -2578, -2014, -1490, -1011, -537, -67, 338, 622, 763, 769, 685, 594, 594, 697, 843, 1009, 1231, 1527, 1843, 2117, 2331, 2492, 2615, 2704, 2728, 2657, 2521, 2404, 2336, 2245, 2058, 1822, 1640, 1505, 1304, 994, 644, 287, -106, -528, -927, -1315, -1752, -2234, -2715, -3161, -3519, -3735, -3871, -4065, -4333, -4509, -4466, -4259, -3999, -3698, -3312, -2855, -2386, -1927, -1461, -1003, -606, -267, 88, 521, 1001, 1463, 1900, 2362, 2881, 3435, 3965, 4386, 4634, 4747, 4844, 4971, 5023, 4910, 4728, 4652, 4695, 4696, 4557, 4365, 4234, 4147, 4058, 4003, 4026, 4060, 4016, 3893, 3759, 3706, 3819, 4100, 4399, 4535, 4518, 4552, 4782, 5151, 5515, 5822, 6086, 6268, 6322, 6286, 6233, 6181, 6146, 6184, 6263, 6223, 5957, 5574, 5259, 5056, 4857, 4563, 4167, 3700, 3210, 2769, 2434, 2164, 1885, 1617, 1451, 1385, 1318, 1212, 1134, 1143, 1222, 1320, 1429, 1595, 1863, 2198, 2481, 2655, 2813, 3093, 3507, 3960, 4339, 4591, 4739, 4882, 5108, 5363, 5483, 5395, 5224, 5137, 5141, 5104, 4954, 4761, 4627, 4560, 4501, 4395, 4206, 3924, 3610, 3373, 3265, 3213, 3113, 2965, 2815, 2637, 2353, 1972, 1604, 1357, 1245, 1196, 1098, 920, 766, 745, 773, 630, 256, -141, -369, -490, -664, -836, -862, -816, -908, -1103, -1143, -1001, -960, -1159, -1342, -1229, -928, -798, -948, -1085, -926, -611, -524, -726, -848, -619, -265, -173, -334, -385, -145, 143, 193, 66, 53, 253, 442, 430, 319, 283, 263, 84, -202, -388, -458, -615, -912, -1126, -1105, -1040, -1153, -1360, -1512, -1752, -2244, -2762, -3004, -3115, -3416, -3829, -4069, -4159, -4316, -4546, -4713, -4841, -5047, -5351, -5678, -5938, -6014, -5796, -5328, -4819, -4471, -4284, -4105, -3823, -3450, -3082, -2832, -2700, -2462, -1922, -1224, -645, -112, 587, 1251, 1478, 1417, 1658, 2252, 2533, 2110, 1496, 1287, 1212, 632, -265, -575, 22, 722, 618, -297, -1292, -1768, -1812, -1992, -2694, -3731, -4713, -5557, -6315, -6847, -7017, -7004, -7006, -6908, -6555, -6144, -6019, -6189, -6332, -6188, -5806, -5423, -5240, -5311, -5550, -5825, -6217, -7004, -8170, -9283, -10244, -11487, -12923, -13528, -12664, -10804, -8359, -5067, -1132, 2374, 4791, 6428, 7712, 8937, 10548, 12676, 14807, 16727, 19003, 21888, 24698, 26814, 28381, 29684, 30634, 31124, 31291, 31215, 30820, 30119, 29225, 28129, 26728, 25118, 23497, 21711, 19249, 16011, 12610, 9612, 6915, 4165, 1390, -1183, -3476, -5550, -7479, -9258, -10610, -11240, -11415, -11812, -12541, -12992, -12781, -12125, -11176, -9771, -7912, -5894, -3897, -1940, -98, 1581, 3143, 4511, 5540, 6292, 6929, 7436, 7836, 8406, 9293, 10237, 10998, 11703, 12457, 13019, 13101, 12672, 11904, 11092, 10513, 10098, 9550, 8880, 8452, 8331, 8196, 7984, 7988, 8256, 8421, 8251, 7902, 7650, 7640, 7834, 8025, 8063, 8044, 8064, 7897, 7287, 6397, 5572, 4847, 4029, 3112, 2285, 1599, 897, 31, -984, -2046, -3110, -4299, -5723, -7289, -8781, -10140, -11451, -12664, -13550, -13993, -14102, -14014, -13745, -13291, -12720, -12090, -11356, -10443, -9382, -8294, -7247, -6194, -5023, -3610, -1932, -145, 1531, 3043, 4450, 5707, 6709, 7501, 8197, 8727, 8964, 8956, 8789, 8409, 7769, 6981, 6124, 5170, 4142, 3038, 1710, 59, -1695, -3275, -4650, -5870, -6910, -7809, -8713, -9619, -10395, -11053, -11706, -12305, -12759, -13127, -13465, -13682, -13729, -13688, -13548, -13172, -12548, -11841, -11175, -10624, -10300, -10232, -10262, -10188, -9981, -9692, -9331, -8916, -8557, -8358, -8261, -8102, -7793, -7406, -7060, -6781, -6504, -6171, -5790, -5440, -5180, -4938, -4570, -4054, -3537, -3154, -2947, -2921, -2991, -2911, -2520, -1979, -1538, -1235, -1057, -1105, -1372, -1616, -1713, -1840, -2200, -2788, -3518, -4318, -5095, -5791, -6455, -7091, -7637, -8109, -8632, -9248, -9895, -10542, -11143, -11575, -11805, -11983, -12205, -12379, -12424, -12366, -12167, -11774, -11288, -10846, -10401, -9845, -9250, -8711, -8157, -7514, -6850, -6223, -5582, -4920, -4330, -3872, -3515, -3207, -2904, -2573, -2266, -2074, -1978, -1835, -1546, -1158, -783, -487, -280, -153, -48, 100, 266, 311, 195, 89, 181, 443, 744, 1057, 1419, 1784, 2066, 2251, 2340, 2323, 2242, 2170, 2080, 1875, 1548, 1217, 996, 883, 748, 435, -63, -579, -990, -1386, -1897, -2441, -2833, -3057, -3283, -3618, -3984, -4222, -4260, -4169, -4084, -4055, -3992, -3775, -3370, -2837, -2239, -1618, -1023, -495, -18, 490, 1088, 1719, 2229, 2514, 2637, 2769, 3013, 3371, 3775, 4092, 4171, 4059, 4010, 4137, 4232, 4060, 3635, 3070, 2474, 2067, 2107, 2544, 3054, 3376, 3465, 3407, 3426, 3753, 4342, 4905, 5304, 5631, 5904, 6054, 6171, 6426, 6831, 7324, 7906, 8451, 8652, 8394, 7974, 7747, 7773, 7829, 7645, 7098, 6325, 5619, 5110, 4661, 4130, 3592, 3189, 2865, 2418, 1790, 1143, 638, 269, -21, -209, -248, -142, 69, 321, 492, 528, 577, 854, 1404, 2059, 2617, 2981, 3225, 3549, 4083, 4728, 5253, 5538, 5645, 5700, 5786, 5904, 5988, 5979, 5930, 5967, 6106, 6170, 5968, 5525, 5042, 4657, 4337, 4022, 3743, 3536, 3329, 3014, 2600, 2226, 2010, 1929, 1851, 1653, 1356, 1133, 1163, 1383, 1503, 1368, 1181, 1211, 1415, 1529, 1431, 1250, 1181, 1333, 1653, 1953, 2086, 2088, 2070, 2055, 2030, 2025, 2018, 1962, 1937, 2030, 2091, 1892, 1495, 1176, 1028, 946, 900, 948, 1032, 1016, 862, 668, 588, 740, 1080, 1440, 1747, 2052, 2305, 2362, 2276, 2296, 2492, 2685, 2769, 2788, 2773, 2739, 2773, 2879, 2931, 2894, 2873, 2838, 2625, 2221, 1749, 1243, 689, 178, -229, -606, -943, -1070, -1015, -1121, -1578, -2055, -2175, -2168, -2582, -3411, -4033, -4128, -4093, -4315, -4573, -4480, -4140, -3957, -4062, -4267, -4433, -4510, -4332, -3849, -3418, -3387, -3499, -3269, -2806, -2623, -2751, -2720, -2356, -1993, -1933, -2064, -2028, -1578, -841, -242, -57, -120, -98, 67, 169, 4, -417, -785, -687, -143, 246, 60, -328, -306, 98, 350, 131, -419, -991, -1380, -1683, -2187, -2891, -3373, -3454, -3601, -4232, -4953, -5073, -4650, -4417, -4642, -4808, -4604, -4511, -4940, -5483, -5595, -5457, -5469, -5439, -4953, -4229, -3886, -3988, -3960, -3435, -2728, -2279, -2126, -2079, -1997, -1771, -1445, -1397, -1948, -2942, -4203, -6142, -9207, -12910, -16045, -17812, -18332, -18029, -17045, -15379, -13188, -10709, -8200, -6045, -4485, -3130, -1346, 827, 2880, 4938, 7749, 11555, 15816, 19989, 23751, 26687, 28518, 29597, 30489, 31263, 31594, 31488, 31337, 31248, 30916, 30219, 29439, 28584, 27111, 24663, 21559, 18285, 15047, 11961, 9197, 6652, 4023, 1299, -1224, -3374, -5275, -7111, -8900, -10435, -11543, -12432, -13360, -13936, -13425, -11944, -10419, -9122, -7359, -4872, -2424, -557, 1105, 2894, 4347, 5073, 5549, 6316, 7041, 7300, 7682, 8944, 10563, 11452, 11680, 12044, 12394, 11910, 10731, 9844, 9513, 9026, 8046, 7140, 6796, 6683, 6294, 5772, 5572, 5718, 5876, 5936, 6065, 6330, 6688, 7165, 7745, 8174, 8241, 8092, 7952, 7663, 6934, 5999, 5388, 5087, 4514, 3471, 2493, 1944, 1365, 171, -1412, -2788, -4004, -5600, -7607, -9466, -10952, -12383, -13808, -14793, -15149, -15286, -15528, -15605, -15149, -14310, -13478, -12654, -11554, -10145, -8682, -7302, -5957, -4627, -3272, -1736, 35, 1766, 3166, 4334, 5568, 6846, 7827, 8391, 8785, 9150, 9258, 8905, 8238, 7461, 6536, 5387, 4171, 3077, 1996, 677, -841, -2256, -3419, -4470, -5530, -6552, -7524, -8520, -9524, -10418, -11126, -11643, -11984, -12223, -12480, -12771, -12980, -13032, -12964, -12836, -12674, -12516, -12388, -12255, -12072, -11885, -11796, -11790, -11690, -11388, -10979, -10643, -10418, -10199, -9893, -9461, -8880, -8149, -7348, -6574, -5818, -5036, -4282, -3650, -3045, -2285, -1411, -625, 65, 788, 1427, 1744, 1795, 1840, 1898, 1784, 1487, 1163, 827, 347, -300, -990, -1611, -2178, -2800, -3583, -4555, -5617, -6601, -7439, -8243, -9104, -9912, -10537, -11064, -11614, -12052, -12146, -11945, -11706, -11558, -11402, -11118, -10695, -10206, -9711, -9150, -8440, -7698, -7138, -6710, -6140, -5412, -4780, -4299, -3756, -3121, -2588, -2234, -1989, -1826, -1707, -1515, -1296, -1245, -1360, -1463, -1557, -1728, -1856, -1834, -1821, -1887, -1809, -1522, -1298, -1229, -1047, -669, -345, -193, -82, 26, 49, 1, -51, -73, 28, 285, 490, 492, 493, 660, 745, 529, 234, 99, -64, -496, -1110, -1743, -2384, -2974, -3365, -3562, -3735, -4000, -4350, -4694, -4866, -4815, -4749, -4839, -4912, -4764, -4536, -4421, -4260, -3845, -3368, -3129, -3018, -2653, -1942, -1183, -617, -135, 471, 1187, 1819, 2317, 2826, 3368, 3702, 3659, 3457, 3442, 3636, 3767, 3651, 3380, 3172, 3180, 3362, 3504, 3484, 3420, 3385, 3199, 2748, 2247, 1900, 1596, 1218, 878, 663, 503, 449, 652, 1000, 1158, 990, 664, 407, 364, 558, 829, 953, 884, 720, 529, 393, 492, 843, 1082, 793, 1, -875, -1450, -1602, -1372, -847, -136, 566, 1033, 1212, 1312, 1450, 1434, 1221, 1288, 1993, 2934, 3542, 3936, 4517, 5167, 5592, 5996, 6736, 7653, 8292, 8513, 8481, 8271, 7874, 7455, 7267, 7307, 7283, 6972, 6439, 5869, 5374, 4981, 4638, 4215, 3669, 3119, 2621, 2108, 1614, 1318, 1233, 1160, 1057, 1134, 1452, 1706, 1657, 1517, 1645, 2048, 2481, 2948, 3659, 4520, 5111, 5281, 5403, 5810, 6316, 6542, 6477, 6357, 6209, 5864, 5414, 5213, 5371, 5569, 5517, 5294, 5079, 4815, 4336, 3729, 3284, 3107, 2973, 2640, 2173, 1793, 1557, 1389, 1341, 1531, 1834, 1970, 1895, 1853, 1951, 2006, 1914, 1876, 2061, 2273, 2244, 2088, 2104, 2245, 2186, 1884, 1677, 1737, 1797, 1606, 1311, 1155, 1060, 828, 571, 553, 702, 693, 481, 362, 483, 652, 675, 622, 669, 853, 1049, 1136, 1151, 1251, 1539, 1945, 2292, 2465, 2471, 2372, 2232, 2127, 2135, 2256, 2408, 2561, 2743, 2889, 2830, 2555, 2298, 2228, 2215, 2058, 1826, 1701, 1619, 1378, 1094, 1095, 1294, 1189, 629, 96, -13, 42, -145, -444, -444, -206, -169, -418, -618, -687, -917, -1343, -1641, -1717, -1824, -2039, -2205, -2348, -2666, -3099, -3340, -3276, -3114, -3040, -3005, -2880, -2685, -2538, -2448, -2279, -1964, -1645, -1524, -1608, -1673, -1504, -1104, -665, -345, -143, 14, 79, -67, -295, -205, 287, 680, 557, 175, -75, -322, -770, -1167, -1274, -1372, -1767, -2246, -2448, -2373, -2186, -1873, -1430, -1121, -1256, -1825, -2523, -3074, -3329, -3193, -2701, -2162, -1940, -2014, -2022, -1745, -1345, -1066, -905, -720, -514, -444, -559, -699, -719, -687, -756, -898, -925, -777, -670, -859, -1284, -1605, -1598, -1406, -1325, -1466, -1734, -2032, -2355, -2694, -2970, -3058, -2896, -2573, -2285, -2172, -2224, -2346, -2495, -2689, -2868, -2871, -2662, -2383, -2061, -1568, -1033, -816, -853, -652, -144, 237, 427, 781, 1190, 1160, 786, 718, 1054, 1204, 946, 766, 938, 1046, 790, 583, 770, 881, 354, -478, -937, -1096, -1523, -2264, -2857, -3113, -3248, -3352, -3282, -3100, -3117, -3445, -3845, -4150, -4416, -4547, -4265, -3638, -3256, -3645, -4860, -6666, -8771, -10785, -12334, -13283, -13729, -13761, -13337, -12276, -10379, -7622, -4304, -934, 1983, 4153, 5554, 6481, 7497, 9154, 11627, 14616, 17632, 20337, 22568, 24319, 25700, 26862, 27818, 28426, 28595, 28372, 27817, 26876, 25605, 24317, 23145, 21633, 19374, 16859, 14712, 12539, 9741, 6980, 5229, 3942, 1964, -358, -1852, -2632, -3772, -5327, -6297, -6407, -6495, -7140, -7875, -8070, -7851, -7661, -7369, -6438, -4839, -3164, -1759, -366, 1184, 2506, 3237, 3616, 4035, 4375, 4294, 3948, 3868, 4259, 4850, 5419, 6068, 6897, 7664, 8007, 7881, 7608, 7384, 7061, 6511, 5997, 5858, 5994, 5999, 5780, 5682, 5912, 6156, 6049, 5752, 5613, 5500, 4985, 4075, 3201, 2537, 1860, 1013, 27, -1081, -2298, -3555, -4825, -6096, -7205, -8059, -8865, -9745, -10444, -10799, -11135, -11735, -12342, -12592, -12594, -12679, -12864, -12925, -12789, -12528, -12035, -11122, -9876, -8588, -7303, -5825, -4174, -2673, -1490, -489, 446, 1270, 1977, 2678, 3397, 4012, 4468, 4826, 5097, 5204, 5198, 5242, 5279, 5055, 4576, 4133, 3760, 3118, 2098, 1036, 116, -919, -2238, -3514, -4412, -5132, -6046, -7047, -7750, -8173, -8654, -9182, -9423, -9362, -9328, -9468, -9680, -10018, -10654, -11442, -11954, -11989, -11762, -11544, -11369, -11157, -10936, -10762, -10518, -10051, -9403, -8784, -8290, -7851, -7459, -7229, -7163, -7021, -6543, -5705, -4652, -3512, -2358, -1230, -132, 924, 1889, 2794, 3766, 4754, 5493, 5857, 6013, 6074, 5880, 5323, 4611, 3998, 3432, 2718, 1863, 1038, 272, -562, -1470, -2297, -3024, -3863, -4944, -6107, -7129, -8014, -8862, -9629, -10168, -10485, -10751, -11011, -11009, -10474, -9518, -8544, -7770, -7092, -6421, -5859, -5416, -4828, -3898, -2829, -1977, -1393, -859, -325, 26, 190, 478, 1096, 1799, 2175, 2155, 1989, 1835, 1612, 1263, 900, 615, 340, 13, -306, -586, -900, -1276, -1638, -1904, -2012, -1885, -1545, -1175, -928, -778, -658, -607, -661, -792, -959, -1115, -1203, -1247, -1329, -1397, -1321, -1194, -1311, -1718, -2071, -2127, -2106, -2365, -2898, -3427, -3875, -4420, -5066, -5494, -5519, -5461, -5719, -6091, -6033, -5566, -5287, -5344, -5185, -4545, -3904, -3600, -3303, -2708, -2108, -1834, -1673, -1253, -615, -68, 292, 635, 1025, 1301, 1388, 1502, 1823, 2122, 2051, 1717, 1561, 1659, 1592, 1105, 458, -25, -338, -571, -675, -602, -455, -398, -514, -718, -812, -720, -615, -648, -689, -564, -384, -354, -440, -477, -447, -425, -376, -234, -67, -4, -72, -222, -443, -719, -939, -1028, -1122, -1390, -1736, -1908, -1928, -2108, -2582, -3081, -3311, -3318, -3296, -3213, -2892, -2397, -2001, -1764, -1394, -682, 175, 870, 1455, 2226, 3214, 4125, 4795, 5381, 6024, 6606, 7016, 7448, 8186, 9174, 9984, 10231, 9887, 9223, 8622, 8365, 8424, 8461, 8167, 7505, 6569, 5412, 4223, 3431, 3292, 3484, 3395, 2803, 1992, 1194, 330, -580, -1176, -1204, -940, -821, -896, -918, -805, -665, -459, 6, 736, 1432, 1863, 2130, 2451, 2872, 3335, 3872, 4548, 5255, 5761, 5967, 5986, 5985, 6061, 6283, 6684, 7150, 7477, 7555, 7429, 7213, 7070, 7144, 7353, 7360, 6901, 6067, 5180, 4523, 4219, 4192, 4239, 4208, 4059, 3728, 3111, 2324, 1709, 1454, 1380, 1210, 892, 505, 53, -495, -1006, -1197, -940, -473, -185, -205, -342, -433, -515, -557, -281, 467, 1342, 1792, 1761, 1739, 2034, 2365, 2436, 2459, 2700, 2888, 2633, 2141, 1974, 2250, 2571, 2644, 2572, 2556, 2562, 2354, 1851, 1333, 1084, 907, 365, -484, -1049, -1030, -811, -815, -882, -593, 16, 409, 210, -320, -645, -666, -782, -1142, -1294, -883, -310, -169, -311, -72, 689, 1363, 1472, 1286, 1325, 1573, 1574, 1231, 1085, 1561, 2305, 2666, 2647, 2817, 3329, 3646, 3452, 3253, 3629, 4266, 4379, 3906, 3582, 3723, 3682, 2903, 1893, 1512, 1631, 1275, 102, -1000, -1156, -775, -998, -2071, -3024, -3082, -2749, -2992, -3773, -4069, -3398, -2628, -2827, -3797, -4466, -4453, -4384, -4672, -4859, -4420, -3531, -2718, -2192, -1836, -1550, -1334, -1211, -1197, -1258, -1223, -991, -907, -1493, -2503, -2827, -1783, -51, 1141, 1314, 810, 86, -636, -1255, -1641, -1592, -1055, -440, -411, -1122, -1965, -2312, -2254, -2284, -2518, -2716, -2955, -3664, -4862, -5899, -6237, -5995, -5516, -4979, -4652, -4951, -5861, -6725, -6948, -6639, -6222, -5786, -5282, -5128, -5945, -7689, -9666, -11397, -12935, -14329, -15297, -15639, -15502, -15093, -14330, -12888, -10549, -7543, -4494, -1869, 394, 2658, 5142, 7847, 10762, 13850, 16929, 19717, 22028, 23854, 25308, 26510, 27565, 28508, 29287, 29712, 29566, 28834, 27778, 26708, 25665, 24412, 22648, 20144, 16848, 13055, 9318, 6119, 3517, 1267, -865, -2957, -4922, -6611, -7904, -8753, -9152, -9182, -9074, -9061, -9122, -9013, -8541, -7681, -6393, -4584, -2407, -380, 1150, 2496, 4193, 6166, 7828, 8914, 9662, 10204, 10402, 10332, 10375, 10695, 11033, 11139, 11093, 11075, 11056, 10880, 10517, 10058, 9535, 8941, 8408, 8143, 8113, 8020, 7665, 7199, 6872, 6665, 6385, 6049, 5916, 6049, 6130, 5838, 5277, 4760, 4345, 3819, 3110, 2376, 1650, 663, -757, -2360, -3737, -4816, -5829, -6875, -7809, -8555, -9245, -9962, -10569, -10925, -11066, -11081, -10947, -10661, -10393, -10256, -10071, -9578, -8776, -7770, -6481, -4808, -2997, -1474, -324, 738, 1927, 3098, 3992, 4601, 5139, 5679, 5996, 5891, 5537, 5272, 5113, 4774, 4150, 3495, 3005, 2515, 1751, 737, -250, -1055, -1824, -2779, -3915, -5021, -5944, -6691, -7255, -7581, -7752, -7960, -8197, -8281, -8213, -8199, -8252, -8157, -7902, -7802, -8025, -8370, -8659, -9055, -9686, -10264, -10405, -10205, -10115, -10298, -10527, -10649, -10703, -10656, -10372, -9906, -9518, -9369, -9381, -9375, -9171, -8632, -7702, -6477, -5148, -3851, -2551, -1152, 233, 1326, 2122, 2974, 4040, 4923, 5235, 5218, 5314, 5403, 5025, 4214, 3521, 3111, 2457, 1193, -239, -1252, -2017, -3133, -4632, -5937, -6805, -7657, -8828, -10003, -10716, -11065, -11497, -12067, -12379, -12258, -12023, -11943, -11767, -11129, -10133, -9213, -8518, -7813, -6953, -6089, -5318, -4481, -3452, -2436, -1789, -1588, -1534, -1350, -1142, -1150, -1231, -1032, -626, -500, -796, -1141, -1340, -1623, -2080, -2407, -2489, -2682, -3210, -3712, -3797, -3691, -3816, -4007, -3774, -3198, -2859, -2912, -2900, -2561, -2174, -1992, -1848, -1569, -1353, -1432, -1643, -1707, -1677, -1777, -1949, -1965, -1863, -1918, -2183, -2439, -2562, -2690, -2965, -3311, -3571, -3745, -3961, -4273, -4553, -4605, -4312, -3745, -3128, -2696, -2541, -2586, -2642, -2450, -1825, -893, -70, 323, 385, 455, 689, 956, 1125, 1273, 1533, 1881, 2198, 2367, 2319, 2131, 2039, 2124, 2089, 1649, 988, 508, 248, -32, -300, -253, 52, 84, -381, -838, -815, -622, -807, -1325, -1763, -1968, -1928, -1496, -669, 206, 758, 772, 102, -1112, -2165, -2336, -1816, -1563, -2069, -2761, -2909, -2599, -2342, -2257, -2288, -2753, -3868, -5082, -5610, -5358, -4790, -4197, -3639, -3279, -3243, -3228, -2687, -1443, 102, 1461, 2473, 3215, 3785, 4306, 4942, 5792, 6835, 7945, 8847, 9268, 9313, 9456, 9955, 10537, 10848, 10908, 10846, 10470, 9518, 8254, 7295, 6792, 6294, 5517, 4762, 4293, 3830, 3035, 2144, 1653, 1557, 1393, 978, 601, 439, 271, -50, -285, -191, 129, 448, 726, 1035, 1388, 1741, 2070, 2441, 2972, 3646, 4235, 4540, 4651, 4771, 4890, 4845, 4648, 4507, 4493, 4425, 4232, 4144, 4345, 4635, 4749, 4742, 4769, 4712, 4388, 3970, 3786, 3828, 3761, 3427, 3024, 2781, 2664, 2532, 2421, 2483, 2739, 3044, 3283, 3436, 3486, 3394, 3239, 3216, 3410, 3611, 3503, 3066, 2641, 2509, 2566, 2556, 2468, 2444, 2440, 2264, 1929, 1699, 1674, 1620, 1352, 1055, 982, 1083, 1166, 1277, 1535, 1786, 1785, 1653, 1750, 2151, 2552, 2709, 2743, 2922, 3271, 3558, 3629, 3603, 3636, 3661, 3553, 3417, 3426, 3479, 3326, 3020, 2917, 3108, 3208, 2890, 2379, 2104, 2076, 1951, 1649, 1453, 1483, 1473, 1219, 923, 859, 948, 892, 632, 438, 489, 587, 420, -5, -449, -882, -1472, -2116, -2448, -2426, -2494, -2951, -3555, -3917, -3963, -3791, -3381, -2698, -1930, -1410, -1285, -1387, -1433, -1308, -1084, -838, -578, -303, -46, 195, 467, 740, 877, 817, 743, 897, 1181, 1198, 763, 145, -330, -662, -958, -1179, -1311, -1577, -2116, -2613, -2599, -2118, -1701, -1635, -1641, -1428, -1167, -1168, -1395, -1590, -1643, -1623, -1571, -1489, -1438, -1518, -1763, -2113, -2445, -2627, -2600, -2463, -2474, -2820, -3396, -3860, -3956, -3723, -3439, -3349, -3388, -3305, -3078, -3007, -3183, -3189, -2657, -1864, -1333, -1044, -580, 40, 254, -130, -433, 58, 1012, 1360, 640, -449, -1040, -1132, -1267, -1538, -1531, -1088, -574, -321, -301, -379, -510, -592, -437, 6, 571, 1071, 1427, 1575, 1497, 1392, 1651, 2427, 3337, 3814, 3758, 3589, 3584, 3559, 3337, 3122, 3042, 2812, 2226, 1657, 1537, 1667, 1490, 910, 365, 156, 162, 205, 183, -189, -1044, -1808, -1831, -1560, -2003, -3161, -4340, -5816, -8625, -12655, -16433, -18945, -20422, -21142, -20677, -18742, -15975, -13206, -10515, -7568, -4472, -1585, 1143, 3964, 6633, 8688, 10265, 12085, 14610, 17637, 20652, 23279, 25314, 26679, 27484, 28059, 28662, 29213, 29436, 29159, 28436, 27338, 25734, 23276, 19962, 16554, 13913, 11878, 9503, 6517, 3701, 1684, 209, -1109, -2102, -2517, -2694, -3175, -3939, -4515, -4675, -4586, -4357, -3978, -3591, -3368, -3141, -2604, -1694, -453, 1091, 2708, 4090, 5236, 6215, 6678, 6276, 5331, 4421, 3570, 2524, 1541, 1154, 1309, 1415, 1297, 1391, 1861, 2235, 2285, 2447, 2942, 3280, 3173, 3112, 3511, 4061, 4444, 4909, 5666, 6296, 6355, 6122, 6234, 6782, 7255, 7364, 7394, 7591, 7629, 6975, 5531, 3736, 2120, 832, -403, -1937, -3759, -5577, -7166, -8463, -9415, -10015, -10407, -10748, -11035, -11242, -11490, -11863, -12168, -12090, -11592, -10966, -10474, -10088, -9600, -8873, -7847, -6424, -4569, -2534, -742, 674, 1935, 3098, 3873, 4177, 4425, 4914, 5291, 5043, 4221, 3328, 2691, 2250, 1784, 1187, 566, 74, -349, -977, -1896, -2817, -3381, -3578, -3762, -4299, -5267, -6449, -7508, -8207, -8484, -8415, -8136, -7788, -7496, -7352, -7389, -7546, -7654, -7624, -7628, -8034, -9042, -10448, -11797, -12751, -13292, -13624, -13942, -14266, -14458, -14407, -14217, -14147, -14226, -14113, -13504, -12566, -11686, -10979, -10328, -9703, -9054, -8133, -6764, -5130, -3521, -1962, -392, 1019, 2064, 2894, 3870, 4961, 5693, 5780, 5452, 5000, 4331, 3272, 1994, 812, -286, -1545, -2951, -4221, -5251, -6212, -7112, -7718, -8016, -8383, -9112, -10091, -11035, -11786, -12281, -12489, -12420, -12109, -11600, -10979, -10342, -9681, -8879, -7858, -6668, -5480, -4522, -3896, -3461, -2962, -2316, -1662, -1117, -675, -357, -293, -520, -843, -1001, -963, -917, -1003, -1157, -1256, -1297, -1377, -1560, -1802, -1982, -2055, -2162, -2469, -2906, -3221, -3280, -3170, -2981, -2672, -2179, -1516, -788, -150, 256, 409, 373, 193, -132, -547, -911, -1164, -1413, -1751, -2067, -2213, -2247, -2291, -2277, -2154, -2169, -2544, -3043, -3279, -3296, -3434, -3688, -3682, -3237, -2620, -2142, -1806, -1456, -1079, -752, -453, -115, 231, 564, 1012, 1697, 2514, 3174, 3476, 3477, 3429, 3490, 3506, 3266, 2885, 2672, 2655, 2585, 2403, 2288, 2294, 2317, 2332, 2360, 2302, 2104, 1932, 1937, 1990, 1869, 1579, 1333, 1295, 1476, 1812, 2244, 2688, 3038, 3228, 3271, 3240, 3290, 3647, 4393, 5248, 5727, 5563, 4951, 4384, 4240, 4440, 4542, 4249, 3700, 3197, 2868, 2735, 2830, 3012, 2954, 2566, 2178, 2076, 2081, 1879, 1546, 1350, 1191, 744, 169, 48, 500, 956, 1036, 1052, 1379, 1889, 2299, 2629, 3005, 3343, 3488, 3517, 3698, 4105, 4471, 4517, 4357, 4352, 4581, 4755, 4707, 4676, 4908, 5265, 5446, 5438, 5464, 5557, 5487, 5149, 4743, 4438, 4138, 3705, 3215, 2809, 2485, 2216, 2107, 2255, 2531, 2681, 2607, 2485, 2531, 2737, 2881, 2777, 2487, 2253, 2195, 2144, 1892, 1561, 1478, 1686, 1861, 1811, 1762, 1971, 2324, 2547, 2606, 2641, 2639, 2461, 2164, 1948, 1784, 1459, 1022, 843, 1067, 1360, 1393, 1287, 1338, 1537, 1680, 1796, 2078, 2432, 2524, 2309, 2136, 2238, 2441, 2481, 2325, 2146, 2138, 2377, 2740, 2993, 3014, 2913, 2884, 2991, 3062, 2844, 2320, 1846, 1750, 1906, 1938, 1737, 1459, 1180, 915, 790, 828, 807, 654, 607, 779, 944, 982, 1067, 1296, 1519, 1614, 1591, 1431, 1104, 730, 476, 349, 202, -97, -499, -735, -620, -386, -464, -860, -1104, -967, -828, -1046, -1354, -1235, -708, -322, -395, -648, -692, -566, -546, -641, -609, -393, -214, -196, -185, -82, -46, -191, -369, -444, -549, -830, -1177, -1389, -1466, -1612, -1998, -2573, -3031, -3084, -2790, -2511, -2491, -2604, -2581, -2338, -1971, -1547, -1171, -1102, -1375, -1488, -1014, -377, -272, -455, -65, 933, 1634, 1649, 1717, 2428, 3213, 3249, 2757, 2569, 2784, 2768, 2300, 1807, 1458, 927, 156, -397, -440, -261, -311, -668, -1056, -1224, -1174, -1082, -1126, -1439, -2084, -2924, -3599, -3853, -3781, -3542, -3053, -2256, -1501, -1227, -1373, -1453, -1103, -384, 307, 465, -182, -1532, -3434, -5990, -9243, -12812, -16154, -19020, -21318, -22717, -22848, -21789, -19963, -17532, -14296, -10334, -6344, -3027, -420, 1885, 4216, 6717, 9535, 12663, 15794, 18625, 21226, 23826, 26364, 28421, 29699, 30385, 30855, 31140, 30946, 30246, 29273, 27903, 25575, 22234, 18685, 15566, 12512, 8920, 5233, 2487, 733, -1085, -3349, -5101, -5705, -5918, -6504, -7025, -6879, -6437, -6250, -6085, -5472, -4438, -3275, -2208, -1319, -412, 957, 2920, 4997, 6653, 7836, 8701, 9126, 8870, 8033, 6967, 5790, 4457, 3222, 2461, 2078, 1737, 1590, 2001, 2716, 3114, 3181, 3437, 4032, 4590, 4927, 5273, 5792, 6323, 6726, 7154, 7755, 8407, 8931, 9345, 9726, 10049, 10337, 10663, 10878, 10639, 9797, 8477, 6813, 4864, 2786, 771, -1177, -3187, -5230, -7068, -8498, -9549, -10371, -11007, -11401, -11547, -11558, -11561, -11565, -11443, -11056, -10453, -9856, -9374, -8868, -8213, -7429, -6484, -5198, -3580, -1955, -564, 771, 2276, 3685, 4460, 4501, 4249, 4047, 3784, 3297, 2728, 2231, 1714, 1078, 501, 198, 72, -137, -488, -812, -1028, -1264, -1605, -1935, -2121, -2272, -2608, -3118, -3552, -3760, -3809, -3777, -3664, -3540, -3565, -3746, -3895, -3932, -4033, -4387, -4985, -5730, -6667, -7892, -9312, -10648, -11707, -12574, -13404, -14153, -14616, -14721, -14623, -14503, -14388, -14209, -13960, -13651, -13212, -12552, -11748, -10994, -10304, -9481, -8396, -7099, -5624, -3937, -2184, -687, 435, 1372, 2310, 3179, 3795, 4060, 3958, 3492, 2761, 1974, 1243, 446, -561, -1695, -2714, -3532, -4263, -5003, -5700, -6258, -6669, -7033, -7493, -8100, -8746, -9250, -9519, -9581, -9543, -9489, -9421, -9260, -8951, -8542, -8095, -7591, -6995, -6415, -6047, -5937, -5899, -5761, -5581, -5491, -5452, -5362, -5307, -5463, -5758, -5855, -5611, -5289, -5191, -5237, -5126, -4781, -4400, -4098, -3786, -3412, -3076, -2817, -2497, -2056, -1698, -1607, -1621, -1433, -1014, -550, -83, 506, 1165, 1627, 1763, 1718, 1607, 1324, 781, 147, -383, -891, -1545, -2224, -2622, -2644, -2505, -2440, -2496, -2565, -2556, -2495, -2480, -2536, -2590, -2603, -2668, -2839, -2935, -2682, -2110, -1586, -1321, -1118, -792, -482, -314, -144, 85, 130, -135, -479, -700, -914, -1251, -1609, -1887, -2171, -2525, -2802, -2836, -2661, -2344, -1850, -1313, -1142, -1472, -1731, -1252, -153, 826, 1244, 1307, 1384, 1600, 1973, 2567, 3347, 4091, 4650, 5120, 5620, 6089, 6430, 6623, 6586, 6177, 5499, 4969, 4836, 4874, 4673, 4151, 3596, 3238, 3029, 2827, 2604, 2358, 2011, 1554, 1137, 908, 810, 597, 112, -474, -810, -816, -796, -931, -1004, -859, -692, -604, -361, 84, 392, 459, 638, 1115, 1624, 1998, 2426, 2972, 3355, 3411, 3419, 3710, 4207, 4562, 4641, 4638, 4715, 4784, 4756, 4743, 4792, 4655, 4179, 3743, 3790, 4109, 4136, 3791, 3442, 3253, 3156, 3174, 3271, 3195, 2895, 2711, 2809, 2877, 2678, 2455, 2504, 2662, 2560, 2184, 1849, 1706, 1601, 1421, 1274, 1232, 1179, 1021, 859, 794, 735, 559, 334, 233, 278, 373, 505, 716, 964, 1179, 1374, 1544, 1639, 1726, 1919, 2123, 2173, 2232, 2634, 3356, 4070, 4586, 4918, 5054, 5011, 4937, 4930, 4938, 4943, 4985, 4962, 4716, 4298, 3904, 3607, 3324, 2937, 2370, 1693, 1155, 890, 700, 357, -44, -303, -411, -416, -284, -126, -205, -537, -782, -693, -398, -77, 325, 796, 982, 678, 327, 446, 803, 863, 767, 1020, 1473, 1558, 1264, 1060, 1095, 1157, 1128, 1035, 965, 1112, 1556, 2041, 2349, 2615, 2923, 3069, 3016, 3031, 3150, 3185, 3229, 3457, 3558, 3213, 2788, 2753, 2853, 2568, 1908, 1271, 967, 1046, 1106, 526, -556, -1207, -1204, -1516, -2603, -3481, -3316, -2697, -2534, -2752, -2855, -2921, -3247, -3600, -3541, -3155, -2784, -2286, -1331, -244, 370, 640, 1191, 2090, 2916, 3589, 4289, 4853, 4970, 4692, 4311, 4075, 4152, 4478, 4684, 4558, 4331, 4173, 3828, 3139, 2413, 1958, 1649, 1179, 383, -704, -1783, -2441, -2656, -2789, -2979, -3037, -3014, -3172, -3385, -3235, -2615, -1619, -255, 1136, 1719, 1046, -414, -2145, -4337, -7372, -11103, -14936, -18206, -20415, -21436, -21427, -20465, -18558, -16092, -13644, -11398, -9270, -7445, -6134, -5059, -3763, -2152, -253, 2106, 4992, 8141, 11341, 14597, 17790, 20607, 22960, 25022, 26758, 27816, 28031, 27637, 26828, 25444, 23416, 21178, 19177, 17228, 14862, 12116, 9470, 7137, 4993, 3118, 1835, 1056, 186, -990, -1929, -2211, -2274, -2731, -3419, -3773, -3753, -3763, -3841, -3564, -2716, -1578, -485, 626, 1990, 3536, 4845, 5574, 5681, 5243, 4329, 3160, 2076, 1165, 254, -584, -875, -343, 693, 1778, 2805, 3831, 4737, 5369, 5771, 6075, 6333, 6567, 6872, 7369, 8033, 8634, 8912, 8840, 8620, 8444, 8385, 8521, 8855, 9078, 8788, 8006, 7064, 6008, 4567, 2739, 881, -812, -2480, -4202, -5816, -7080, -7830, -8113, -8148, -8014, -7539, -6752, -6091, -5785, -5512, -5027, -4590, -4393, -4172, -3797, -3594, -3742, -3852, -3464, -2567, -1433, -246, 942, 2040, 2827, 3100, 2938, 2627, 2236, 1541, 540, -381, -1014, -1563, -2103, -2324, -2107, -1777, -1543, -1184, -564, 26, 279, 297, 420, 766, 1060, 942, 408, -176, -561, -876, -1250, -1554, -1742, -2078, -2711, -3366, -3755, -4006, -4414, -5027, -5748, -6609, -7720, -9036, -10338, -11437, -12327, -13078, -13635, -13820, -13590, -13143, -12666, -12129, -11442, -10652, -9831, -8966, -8091, -7372, -6919, -6652, -6416, -6109, -5674, -5097, -4443, -3775, -3081, -2347, -1646, -1072, -662, -406, -286, -319, -574, -1092, -1766, -2436, -3090, -3762, -4329, -4664, -4916, -5278, -5627, -5725, -5626, -5513, -5329, -4950, -4613, -4711, -5183, -5546, -5612, -5773, -6372, -7185, -7803, -8222, -8642, -8969, -8945, -8651, -8478, -8617, -8866, -8990, -9008, -9030, -9055, -9033, -8996, -8967, -8864, -8621, -8266, -7813, -7206, -6430, -5584, -4758, -3921, -3014, -2112, -1350, -742, -155, 482, 1051, 1355, 1305, 1010, 640, 264, -164, -592, -794, -712, -654, -891, -1232, -1312, -1169, -1189, -1572, -2177, -2843, -3548, -4221, -4656, -4757, -4676, -4555, -4345, -3988, -3592, -3247, -2915, -2584, -2315, -2092, -1899, -1891, -2174, -2550, -2760, -2789, -2723, -2567, -2403, -2386, -2466, -2418, -2211, -2052, -2010, -1900, -1622, -1348, -1233, -1162, -968, -703, -457, -118, 389, 880, 1182, 1437, 1814, 2190, 2377, 2441, 2525, 2568, 2491, 2441, 2546, 2545, 2102, 1356, 658, -89, -1139, -2107, -2353, -2043, -1915, -2083, -2019, -1579, -1224, -1256, -1507, -1731, -1806, -1592, -1003, -250, 319, 662, 1072, 1711, 2400, 2971, 3473, 3898, 4068, 3978, 3923, 4068, 4149, 3895, 3481, 3260, 3179, 2931, 2518, 2214, 2030, 1772, 1510, 1483, 1629, 1686, 1564, 1279, 830, 408, 372, 747, 1110, 1160, 1027, 946, 935, 932, 966, 1104, 1334, 1574, 1755, 1825, 1744, 1547, 1385, 1411, 1595, 1735, 1710, 1612, 1572, 1567, 1541, 1605, 1923, 2481, 3131, 3746, 4212, 4409, 4341, 4194, 4152, 4229, 4348, 4444, 4449, 4291, 4034, 3920, 4097, 4377, 4463, 4304, 3983, 3460, 2763, 2202, 1966, 1810, 1499, 1164, 920, 619, 269, 122, 214, 338, 511, 907, 1363, 1521, 1388, 1290, 1358, 1475, 1629, 1948, 2352, 2518, 2315, 2012, 1927, 2076, 2332, 2705, 3208, 3630, 3728, 3576, 3463, 3482, 3507, 3547, 3789, 4188, 4414, 4302, 4037, 3765, 3431, 3067, 2848, 2836, 2969, 3208, 3480, 3635, 3654, 3677, 3736, 3747, 3711, 3642, 3363, 2781, 2184, 1912, 1878, 1759, 1491, 1286, 1208, 1103, 913, 816, 898, 979, 922, 865, 980, 1202, 1388, 1537, 1715, 1935, 2189, 2457, 2709, 2975, 3328, 3720, 4058, 4418, 4970, 5646, 6134, 6282, 6223, 6030, 5529, 4692, 3936, 3672, 3693, 3459, 2830, 2111, 1455, 757, 120, -131, -6, 35, -279, -656, -711, -508, -358, -321, -277, -276, -416, -496, -244, 142, 140, -305, -602, -351, 112, 360, 515, 740, 619, -263, -1518, -2330, -2395, -2013, -1568, -1245, -1058, -1015, -1265, -1811, -2092, -1473, -216, 777, 1251, 1752, 2522, 3158, 3479, 3835, 4370, 4714, 4662, 4562, 4672, 4718, 4460, 4197, 4138, 3864, 3079, 2341, 2225, 2299, 1803, 901, 395, 471, 528, 187, -247, -444, -579, -955, -1440, -1640, -1427, -1033, -754, -770, -1141, -1814, -2732, -4051, -6044, -8650, -11305, -13508, -15313, -16891, -17923, -18092, -17780, -17471, -16972, -15908, -14474, -12941, -11127, -9009, -6999, -5180, -3080, -516, 2166, 4787, 7445, 9998, 12181, 14060, 15863, 17551, 18918, 19822, 20206, 20185, 20004, 19690, 19014, 18008, 16915, 15539, 13421, 10831, 8667, 7181, 5722, 3917, 2270, 1259, 609, -103, -694, -706, -234, 138, 136, 0, -50, -118, -312, -563, -802, -1047, -1285, -1456, -1533, -1530, -1495, -1479, -1399, -1172, -1030, -1335, -1959, -2451, -2766, -3147, -3354, -2914, -1996, -1164, -456, 470, 1566, 2579, 3646, 4999, 6448, 7685, 8750, 9827, 10833, 11552, 11996, 12356, 12669, 12695, 12209, 11277, 10169, 9048, 7858, 6538, 5202, 4042, 3071, 2058, 823, -518, -1720, -2761, -3813, -4870, -5693, -6190, -6604, -7110, -7432, -7169, -6394, -5596, -5010, -4340, -3342, -2340, -1804, -1573, -1103, -417, -123, -377, -610, -470, -263, -253, -272, -223, -288, -488, -601, -592, -656, -864, -1072, -1153, -1107, -1045, -1025, -878, -385, 288, 779, 1161, 1835, 2739, 3410, 3815, 4301, 4782, 4828, 4516, 4354, 4404, 4215, 3528, 2520, 1459, 466, -530, -1708, -3088, -4434, -5599, -6701, -7813, -8758, -9475, -10179, -10983, -11706, -12193, -12508, -12689, -12625, -12253, -11695, -11069, -10364, -9555, -8707, -7883, -7027, -6089, -5152, -4338, -3663, -3101, -2668, -2326, -1963, -1577, -1315, -1264, -1328, -1428, -1619, -1921, -2192, -2358, -2615, -3161, -3796, -4094, -3978, -3850, -4048, -4466, -4817, -5017, -5114, -5016, -4581, -3945, -3467, -3338, -3444, -3593, -3712, -3828, -4079, -4581, -5230, -5814, -6363, -7102, -7979, -8644, -8983, -9297, -9812, -10315, -10532, -10566, -10702, -10924, -10954, -10732, -10478, -10303, -10028, -9495, -8795, -8091, -7393, -6619, -5718, -4680, -3522, -2334, -1272, -407, 327, 1011, 1583, 1936, 2078, 2107, 2030, 1750, 1282, 803, 396, -41, -563, -1036, -1397, -1791, -2265, -2611, -2706, -2747, -2964, -3311, -3597, -3752, -3824, -3860, -3882, -3914, -3918, -3789, -3506, -3225, -3051, -2851, -2475, -2032, -1757, -1746, -1972, -2342, -2647, -2750, -2834, -3176, -3686, -4078, -4365, -4747, -5167, -5381, -5330, -5120, -4788, -4330, -3828, -3338, -2773, -1989, -964, 110, 955, 1507, 2054, 2880, 3857, 4600, 5024, 5430, 5992, 6446, 6517, 6354, 6231, 6014, 5354, 4338, 3448, 2871, 2317, 1533, 568, -536, -1877, -3338, -4488, -5068, -5361, -5832, -6529, -7128, -7422, -7490, -7335, -6708, -5501, -4040, -2711, -1473, -93, 1353, 2648, 3835, 5011, 5913, 6235, 6157, 6120, 6292, 6538, 6655, 6481, 6058, 5706, 5582, 5363, 4735, 3897, 3179, 2537, 1813, 1165, 814, 654, 411, 22, -317, -403, -214, 107, 432, 761, 1091, 1309, 1422, 1713, 2349, 3082, 3561, 3752, 3757, 3515, 2990, 2411, 2004, 1689, 1261, 696, 140, -269, -460, -419, -218, -2, 113, 151, 243, 478, 790, 1019, 1095, 1164, 1500, 2221, 3122, 3881, 4406, 4832, 5255, 5674, 6135, 6694, 7197, 7341, 7052, 6617, 6313, 6071, 5645, 4985, 4259, 3545, 2775, 1966, 1303, 864, 486, 51, -277, -287, -76, 94, 171, 296, 484, 628, 762, 1049, 1494, 1894, 2107, 2197, 2294, 2441, 2630, 2858, 3078, 3148, 2969, 2667, 2486, 2467, 2366, 2039, 1689, 1567, 1614, 1625, 1575, 1567, 1676, 1984, 2446, 2763, 2742, 2696, 3008, 3468, 3594, 3415, 3359, 3533, 3660, 3655, 3716, 3855, 3813, 3588, 3556, 3824, 4038, 4058, 4170, 4370, 4246, 3818, 3617, 3677, 3365, 2500, 1708, 1415, 1259, 884, 604, 780, 1066, 952, 678, 877, 1539, 2077, 2212, 2138, 2004, 1871, 1951, 2314, 2588, 2418, 1971, 1615, 1388, 1139, 998, 1219, 1617, 1675, 1320, 1109, 1427, 1908, 1992, 1647, 1237, 903, 494, -2, -361, -491, -597, -836, -1052, -1016, -725, -327, 123, 629, 1092, 1371, 1485, 1598, 1796, 1932, 1833, 1546, 1234, 895, 503, 378, 877, 1683, 2017, 1716, 1512, 1986, 2786, 3201, 3047, 2635, 2179, 1650, 1107, 760, 663, 609, 409, 53, -364, -680, -659, -248, 290, 674, 885, 1032, 1189, 1443, 1793, 1985, 1754, 1148, 325, -748, -2132, -3757, -5643, -7847, -10129, -12134, -13845, -15339, -16374, -16806, -16909, -16751, -15999, -14649, -13109, -11368, -9201, -7040, -5397, -3848, -1805, 317, 1965, 3580, 5637, 7578, 8746, 9558, 10790, 12339, 13473, 13885, 13905, 13897, 13872, 13634, 13093, 12270, 11178, 9865, 8488, 7173, 5859, 4448, 3038, 1898, 1178, 747, 376, 48, -33, 193, 518, 757, 950, 1114, 1154, 1110, 1109, 965, 372, -492, -1131, -1488, -1931, -2567, -3137, -3494, -3675, -3728, -3752, -3840, -3845, -3590, -3267, -3176, -3167, -2832, -2087, -1172, -258, 601, 1425, 2391, 3726, 5317, 6739, 7787, 8720, 9837, 11024, 11945, 12482, 12751, 12793, 12538, 12015, 11276, 10265, 8995, 7708, 6565, 5377, 3955, 2540, 1534, 947, 414, -258, -902, -1352, -1617, -1653, -1424, -1235, -1459, -1857, -1825, -1360, -1078, -1228, -1409, -1314, -1129, -1040, -914, -665, -492, -560, -739, -917, -1223, -1664, -1926, -1902, -1990, -2449, -2925, -3009, -2809, -2595, -2297, -1745, -1057, -420, 269, 1232, 2386, 3429, 4267, 5053, 5813, 6356, 6596, 6634, 6505, 6118, 5496, 4799, 4116, 3399, 2614, 1784, 878, -158, -1226, -2116, -2826, -3614, -4638, -5732, -6662, -7414, -8066, -8566, -8846, -8982, -9095, -9159, -9044, -8683, -8122, -7433, -6699, -6033, -5496, -5010, -4503, -4086, -3932, -4055, -4340, -4698, -5072, -5445, -5886, -6420, -6882, -7127, -7270, -7422, -7388, -6930, -6190, -5481, -4875, -4254, -3577, -2896, -2220, -1565, -1028, -680, -472, -306, -158, -101, -201, -395, -554, -680, -918, -1283, -1607, -1875, -2337, -3118, -4020, -4851, -5614, -6303, -6888, -7528, -8361, -9175, -9669, -9886, -10025, -10075, -9942, -9676, -9319, -8834, -8300, -7890, -7611, -7319, -7021, -6848, -6803, -6737, -6575, -6398, -6291, -6257, -6281, -6342, -6330, -6087, -5622, -5169, -4921, -4797, -4581, -4155, -3559, -2914, -2404, -2170, -2167, -2162, -1946, -1521, -1071, -767, -581, -352, -2, 400, 829, 1300, 1635, 1533, 1026, 523, 266, 30, -432, -1028, -1563, -2065, -2637, -3201, -3575, -3725, -3826, -4056, -4370, -4581, -4624, -4586, -4472, -4204, -3928, -3955, -4250, -4308, -3804, -3078, -2664, -2588, -2468, -2160, -1838, -1497, -934, -288, 33, 85, 400, 1122, 1715, 1803, 1670, 1671, 1688, 1517, 1350, 1467, 1704, 1691, 1440, 1257, 1234, 1281, 1431, 1650, 1654, 1361, 1152, 1269, 1441, 1451, 1499, 1688, 1734, 1559, 1622, 2180, 2686, 2562, 2182, 2289, 2723, 2734, 2358, 2318, 2645, 2598, 2016, 1603, 1686, 1671, 1092, 353, 20, -38, -246, -539, -601, -523, -571, -552, -90, 626, 1045, 1098, 1303, 1952, 2693, 3018, 2922, 2815, 2921, 3040, 2922, 2654, 2506, 2498, 2301, 1704, 1012, 760, 972, 1142, 997, 855, 1025, 1325, 1503, 1713, 2176, 2661, 2798, 2726, 2925, 3446, 3794, 3709, 3553, 3679, 3891, 3871, 3783, 3976, 4341, 4428, 4145, 3887, 3932, 4081, 4100, 4117, 4281, 4337, 3971, 3422, 3201, 3263, 3027, 2333, 1767, 1723, 1731, 1218, 547, 548, 1181, 1541, 1268, 1062, 1457, 1996, 2101, 1969, 2022, 2137, 1996, 1711, 1608, 1711, 1761, 1626, 1436, 1382, 1512, 1752, 2010, 2238, 2413, 2548, 2706, 2969, 3351, 3726, 3882, 3741, 3471, 3272, 3113, 2869, 2591, 2427, 2316, 2041, 1605, 1293, 1267, 1334, 1250, 1073, 992, 982, 879, 744, 828, 1132, 1320, 1241, 1206, 1441, 1646, 1547, 1481, 1863, 2391, 2456, 2118, 1997, 2343, 2758, 2799, 2445, 1974, 1650, 1566, 1627, 1639, 1472, 1205, 1056, 1119, 1240, 1224, 1138, 1218, 1490, 1718, 1768, 1815, 2036, 2321, 2457, 2400, 2208, 1880, 1413, 942, 634, 482, 253, -274, -966, -1371, -1294, -1136, -1326, -1637, -1506, -923, -439, -348, -330, -43, 343, 439, 198, -90, -203, -156, -86, -176, -508, -818, -695, -171, 252, 297, 185, 153, 172, 221, 349, 466, 407, 225, 87, -78, -465, -927, -1080, -974, -1129, -1662, -1993, -1770, -1416, -1312, -1176, -749, -404, -431, -332, 383, 1179, 1138, 433, 134, 546, 834, 479, -63, -393, -703, -1027, -1068, -925, -1044, -1426, -1709, -1909, -2327, -2827, -2923, -2562, -2265, -2401, -2695, -2663, -2280, -1953, -1910, -2002, -2106, -2325, -2593, -2525, -2016, -1524, -1387, -1321, -997, -571, -240, 79, 318, 187, -217, -477, -534, -636, -680, -353, 213, 602, 771, 1060, 1613, 2175, 2406, 2232, 1930, 1845, 1981, 2070, 1996, 1899, 1876, 1938, 2226, 2830, 3478, 3807, 3837, 3824, 3862, 3973, 4298, 4815, 5117, 4821, 4013, 3052, 2097, 1000, -434, -2226, -4233, -6337, -8521, -10686, -12560, -13919, -14843, -15515, -15901, -15832, -15303, -14492, -13545, -12492, -11320, -9975, -8401, -6655, -4917, -3341, -1939, -592, 849, 2387, 3823, 5010, 6087, 7170, 8021, 8400, 8531, 8803, 9217, 9537, 9687, 9640, 9306, 8801, 8455, 8358, 8282, 8133, 8084, 8214, 8421, 8670, 9040, 9520, 10012, 10491, 10976, 11389, 11592, 11608, 11578, 11482, 11108, 10373, 9458, 8476, 7351, 6068, 4767, 3505, 2198, 859, -311, -1192, -1852, -2377, -2735, -2912, -3002, -3015, -2779, -2211, -1544, -1032, -641, -211, 304, 945, 1801, 2780, 3597, 4120, 4490, 4885, 5380, 5960, 6465, 6681, 6603, 6417, 6180, 5799, 5341, 5010, 4786, 4429, 3900, 3452, 3235, 3106, 2983, 3067, 3451, 3800, 3823, 3778, 4076, 4615, 4961, 4987, 4870, 4639, 4184, 3583, 3033, 2486, 1687, 589, -511, -1361, -2063, -2881, -3820, -4631, -5203, -5684, -6164, -6478, -6471, -6282, -6164, -6167, -6145, -5971, -5604, -5076, -4494, -3981, -3553, -3115, -2598, -2030, -1435, -815, -234, 182, 484, 882, 1335, 1483, 1273, 1157, 1312, 1240, 656, 51, -155, -318, -876, -1560, -1893, -1950, -2127, -2442, -2594, -2512, -2426, -2435, -2409, -2332, -2316, -2315, -2239, -2297, -2784, -3571, -4276, -4771, -5204, -5743, -6497, -7444, -8331, -8942, -9425, -9998, -10518, -10767, -10905, -11228, -11648, -11793, -11551, -11198, -11049, -11057, -10856, -10136, -9036, -8025, -7362, -6802, -5916, -4640, -3335, -2364, -1758, -1347, -1007, -681, -372, -224, -378, -699, -900, -993, -1272, -1796, -2258, -2416, -2346, -2225, -2123, -2058, -2052, -2040, -1918, -1755, -1805, -2176, -2659, -3048, -3429, -3986, -4654, -5204, -5536, -5723, -5892, -6114, -6315, -6305, -6063, -5871, -5982, -6244, -6278, -5997, -5716, -5753, -6103, -6497, -6747, -6894, -7011, -6993, -6734, -6402, -6264, -6258, -6061, -5563, -4978, -4478, -4052, -3705, -3488, -3335, -3102, -2784, -2517, -2386, -2334, -2228, -1971, -1562, -1112, -767, -559, -342, 45, 547, 972, 1244, 1403, 1472, 1481, 1528, 1617, 1579, 1333, 1046, 870, 687, 342, -39, -218, -219, -272, -413, -456, -380, -414, -602, -648, -389, -141, -281, -695, -930, -824, -726, -1026, -1627, -2045, -2008, -1741, -1608, -1631, -1566, -1324, -1094, -1036, -1095, -1154, -1205, -1283, -1359, -1433, -1607, -1885, -2025, -1809, -1421, -1274, -1398, -1321, -699, 176, 800, 1134, 1532, 2118, 2666, 3074, 3491, 3880, 3901, 3500, 3190, 3367, 3644, 3375, 2607, 1958, 1653, 1332, 835, 545, 655, 691, 218, -339, -189, 735, 1719, 2202, 2235, 2060, 1766, 1422, 1173, 1085, 1075, 1055, 1032, 1086, 1276, 1610, 2074, 2671, 3366, 3990, 4262, 4030, 3531, 3217, 3191, 3075, 2587, 1969, 1587, 1453, 1450, 1664, 2166, 2703, 2974, 3020, 3112, 3382, 3766, 4213, 4715, 5127, 5180, 4816, 4405, 4387, 4717, 4896, 4612, 4050, 3482, 2919, 2344, 1988, 2030, 2244, 2218, 1838, 1348, 1027, 961, 1086, 1270, 1304, 998, 395, -185, -425, -294, -41, 53, -52, -152, -59, 144, 275, 373, 607, 902, 976, 791, 605, 550, 453, 220, 77, 230, 496, 576, 538, 738, 1276, 1863, 2282, 2669, 3187, 3660, 3862, 3921, 4092, 4226, 3953, 3298, 2682, 2307, 1991, 1571, 1098, 711, 548, 668, 903, 1026, 1070, 1231, 1485, 1634, 1630, 1562, 1409, 1120, 871, 877, 995, 842, 432, 272, 638, 1150, 1373, 1419, 1581, 1784, 1815, 1775, 1889, 2123, 2238, 2070, 1613, 994, 449, 171, 122, 74, -136, -403, -431, -72, 427, 695, 739, 943, 1472, 1997, 2185, 2171, 2289, 2538, 2613, 2411, 2207, 2239, 2330, 2099, 1501, 955, 883, 1212, 1481, 1403, 1197, 1244, 1543, 1727, 1581, 1292, 1075, 848, 454, 35, -126, -94, -231, -609, -788, -387, 421, 1167, 1579, 1716, 1849, 2276, 2974, 3454, 3285, 2668, 2136, 1782, 1196, 208, -733, -1146, -1146, -1177, -1370, -1507, -1420, -1088, -588, -170, 36, 380, 1153, 1822, 1668, 991, 696, 896, 918, 464, -172, -835, -1638, -2519, -3181, -3372, -3052, -2453, -1995, -1890, -1848, -1388, -450, 524, 1156, 1491, 1735, 1913, 2048, 2324, 2718, 2862, 2604, 2307, 2249, 2241, 2109, 2027, 2120, 2229, 2256, 2285, 2294, 2155, 1916, 1788, 1834, 1884, 1767, 1486, 1184, 1033, 1124, 1373, 1547, 1453, 1152, 913, 931, 1141, 1375, 1622, 1942, 2221, 2284, 2252, 2368, 2434, 1981, 1021, 25, -911, -2210, -3999, -5856, -7477, -8970, -10400, -11541, -12305, -12971, -13739, -14330, -14271, -13461, -12185, -10719, -9157, -7512, -5738, -3798, -1821, -20, 1605, 3251, 4868, 6102, 6764, 7114, 7458, 7759, 7838, 7780, 7851, 8079, 8187, 8002, 7699, 7548, 7628, 7870, 8189, 8490, 8654, 8747, 9016, 9538, 10033, 10282, 10501, 10955, 11496, 11832, 11996, 12153, 12197, 11909, 11340, 10705, 10029, 9144, 7969, 6609, 5149, 3592, 1987, 440, -1012, -2359, -3492, -4330, -4968, -5440, -5550, -5239, -4771, -4299, -3599, -2542, -1449, -654, -55, 593, 1231, 1685, 2081, 2658, 3221, 3298, 2851, 2376, 2223, 2282, 2312, 2128, 1605, 959, 700, 912, 1061, 853, 695, 951, 1378, 1626, 1751, 1917, 2083, 2252, 2641, 3266, 3730, 3818, 3948, 4424, 4751, 4455, 3967, 3790, 3496, 2569, 1422, 616, -117, -1202, -2413, -3386, -4191, -4942, -5483, -5756, -5986, -6255, -6333, -6113, -5812, -5521, -4985, -4210, -3744, -3794, -3751, -3235, -2777, -2807, -2959, -2951, -3079, -3395, -3585, -3768, -4289, -4834, -4878, -4685, -4813, -5100, -5056, -4770, -4666, -4753, -4685, -4354, -3958, -3613, -3294, -3053, -2910, -2614, -2016, -1503, -1461, -1560, -1375, -1208, -1438, -1763, -1952, -2420, -3299, -4004, -4319, -4766, -5528, -6222, -6791, -7480, -8049, -8106, -7948, -8154, -8646, -8895, -8781, -8620, -8519, -8298, -8015, -7949, -8017, -7847, -7509, -7415, -7455, -7205, -6867, -6912, -7049, -6740, -6298, -6277, -6380, -6061, -5558, -5380, -5397, -5245, -5032, -5017, -5070, -4939, -4693, -4485, -4175, -3664, -3295, -3266, -3031, -2142, -1229, -1076, -1329, -1195, -814, -819, -1168, -1462, -1764, -2268, -2720, -2855, -2903, -3172, -3490, -3538, -3444, -3564, -3850, -4002, -4060, -4200, -4212, -3931, -3778, -4052, -4308, -4213, -4179, -4449, -4545, -4293, -4277, -4735, -5067, -4871, -4563, -4536, -4510, -4142, -3704, -3620, -3746, -3654, -3340, -3058, -2805, -2576, -2627, -2870, -2681, -1919, -1296, -1196, -1067, -451, 332, 909, 1342, 1701, 1867, 1923, 2160, 2538, 2642, 2311, 1905, 1773, 1775, 1645, 1465, 1430, 1445, 1352, 1266, 1322, 1384, 1290, 1141, 1103, 1138, 1145, 1160, 1226, 1241, 1111, 940, 817, 598, 201, -112, -157, -226, -580, -918, -853, -555, -397, -337, -115, 216, 424, 494, 597, 762, 864, 867, 849, 810, 698, 596, 628, 725, 783, 934, 1321, 1755, 1964, 1995, 2047, 2141, 2202, 2230, 2204, 2086, 1981, 2045, 2272, 2600, 3075, 3683, 4240, 4595, 4717, 4536, 4042, 3517, 3312, 3454, 3721, 3895, 3761, 3213, 2568, 2349, 2619, 2941, 3043, 3005, 2902, 2755, 2763, 3137, 3726, 4170, 4397, 4635, 4965, 5132, 4907, 4414, 3925, 3564, 3305, 3019, 2444, 1513, 678, 394, 481, 562, 744, 1180, 1539, 1637, 1882, 2479, 2938, 2941, 2869, 3013, 3125, 3054, 3110, 3476, 3855, 3960, 3884, 3774, 3493, 2910, 2242, 1757, 1328, 681, -84, -626, -861, -967, -1034, -1000, -817, -486, -59, 297, 411, 361, 445, 815, 1288, 1627, 1853, 2132, 2491, 2845, 3241, 3789, 4365, 4631, 4418, 3915, 3451, 3181, 3049, 2894, 2576, 2089, 1651, 1551, 1832, 2242, 2557, 2761, 2851, 2764, 2578, 2520, 2664, 2869, 3054, 3312, 3706, 4154, 4512, 4659, 4559, 4286, 3925, 3415, 2609, 1474, 141, -1163, -2168, -2727, -3013, -3326, -3701, -3963, -4059, -4004, -3676, -3085, -2627, -2623, -2808, -2671, -2121, -1444, -782, 6, 998, 2052, 3030, 3889, 4509, 4727, 4612, 4368, 3928, 3012, 1616, 29, -1538, -2933, -3813, -3992, -3805, -3689, -3615, -3270, -2514, -1415, -133, 1044, 1854, 2408, 3134, 4234, 5391, 6151, 6477, 6713, 7045, 7201, 6783, 5752, 4451, 3175, 1897, 445, -1090, -2327, -3050, -3485, -3882, -4058, -3768, -3223, -2860, -2740, -2600, -2336, -2057, -1860, -1815, -2023, -2384, -2455, -1871, -851, 13, 477, 801, 1154, 1301, 1092, 807, 761, 814, 507, -456, -1866, -3067, -3505, -3300, -3057, -3065, -3034, -2684, -2164, -1680, -1061, -70, 1096, 1965, 2384, 2649, 2988, 3239, 3196, 2982, 2853, 2780, 2486, 1852, 1043, 261, -420, -990, -1449, -1863, -2228, -2346, -2064, -1552, -1113, -780, -338, 273, 859, 1333, 1854, 2424, 2678, 2417, 1987, 1776, 1805, 2050, 2504, 2750, 2359, 1787, 1796, 2161, 2156, 1877, 1775, 1490, 506, -677, -1290, -1543, -2021, -2420, -2010, -981, -256, -36, 344, 1065, 1553, 1777, 2369, 3166, 3178, 2293, 1452, 1049, 668, 193, -217, -858, -1941, -2946, -3466, -3961, -4925, -6017, -6721, -7186, -7766, -8219, -8092, -7592, -7251, -6903, -5848, -4057, -2303, -1040, -15, 906, 1459, 1705, 2199, 3139, 3934, 4073, 3888, 3975, 4265, 4312, 4102, 3950, 3875, 3732, 3549, 3336, 2984, 2676, 2829, 3451, 4143, 4761, 5457, 6147, 6565, 6814, 7289, 7938, 8181, 7807, 7359, 7223, 6995, 6326, 5624, 5273, 5002, 4645, 4515, 4554, 4175, 3371, 2781, 2532, 2106, 1396, 827, 490, 83, -430, -740, -717, -548, -433, -410, -409, -346, -205, -91, -155, -389, -574, -526, -349, -273, -308, -288, -195, -193, -323, -434, -467, -585, -907, -1290, -1498, -1516, -1553, -1686, -1677, -1317, -787, -426, -253, -109, -85, -315, -535, -451, -306, -497, -926, -1254, -1467, -1680, -1778, -1692, -1614, -1666, -1722, -1731, -1859, -2175, -2473, -2596, -2659, -2809, -2966, -3024, -3104, -3306, -3419, -3249, -3003, -2962, -3070, -3148, -3228, -3361, -3413, -3325, -3251, -3300, -3390, -3430, -3412, -3345, -3275, -3325, -3529, -3733, -3759, -3639, -3575, -3673, -3791, -3698, -3338, -2890, -2525, -2205, -1800, -1354, -1118, -1205, -1349, -1225, -954, -969, -1367, -1807, -2089, -2384, -2761, -2992, -2991, -3013, -3239, -3508, -3644, -3738, -3980, -4306, -4416, -4123, -3639, -3418, -3669, -4105, -4238, -3956, -3662, -3774, -4217, -4585, -4701, -4752, -4874, -4935, -4842, -4770, -4859, -4870, -4453, -3711, -3158, -3057, -3064, -2760, -2278, -2103, -2345, -2592, -2514, -2329, -2412, -2674, -2668, -2296, -1984, -2028, -2127, -1903, -1529, -1450, -1677, -1824, -1737, -1678, -1857, -2080, -1997, -1605, -1342, -1506, -1755, -1568, -1092, -965, -1273, -1419, -1158, -1021, -1403, -1866, -1847, -1566, -1634, -2035, -2215, -2066, -2068, -2408, -2748, -2934, -3210, -3599, -3768, -3587, -3330, -3235, -3230, -3058, -2546, -1882, -1546, -1758, -2115, -2115, -1840, -1755, -1970, -2145, -2089, -2024, -2121, -2167, -1945, -1640, -1533, -1548, -1426, -1191, -1074, -1131, -1222, -1228, -1098, -802, -376, 73, 488, 877, 1216, 1438, 1531, 1542, 1472, 1255, 898, 554, 348, 223, 64, -110, -199, -142, 77, 413, 690, 714, 480, 145, -161, -373, -450, -450, -531, -705, -731, -388, 203, 747, 1178, 1642, 2085, 2220, 2016, 1818, 1824, 1825, 1621, 1335, 1161, 1176, 1421, 1860, 2275, 2461, 2429, 2259, 1946, 1587, 1452, 1657, 1938, 1986, 1861, 1867, 2091, 2340, 2494, 2612, 2669, 2510, 2131, 1709, 1333, 968, 689, 629, 718, 712, 530, 366, 422, 689, 1018, 1276, 1349, 1163, 796, 480, 366, 401, 507, 771, 1325, 2121, 2979, 3806, 4565, 5094, 5256, 5224, 5296, 5377, 5072, 4316, 3505, 2945, 2619, 2481, 2576, 2843, 3128, 3358, 3516, 3559, 3524, 3588, 3854, 4208, 4496, 4753, 5063, 5313, 5373, 5426, 5760, 6258, 6552, 6545, 6360, 5912, 5109, 4246, 3706, 3452, 3222, 2935, 2625, 2348, 2291, 2583, 2988, 3157, 3093, 2989, 2803, 2387, 1872, 1541, 1412, 1269, 1068, 1026, 1244, 1517, 1649, 1692, 1710, 1606, 1302, 806, 146, -465, -631, -354, -190, -373, -370, 167, 779, 1034, 1206, 1588, 1886, 1819, 1668, 1825, 2197, 2412, 2355, 2259, 2349, 2560, 2635, 2435, 2068, 1727, 1435, 1021, 435, -34, -153, -172, -442, -696, -369, 442, 1043, 1180, 1345, 1888, 2439, 2453, 1927, 1286, 768, 231, -423, -888, -812, -407, -288, -627, -874, -569, -67, -62, -574, -898, -571, 12, 184, -26, 83, 898, 1918, 2463, 2555, 2649, 2768, 2531, 1906, 1282, 838, 351, -312, -957, -1361, -1523, -1563, -1543, -1434, -1208, -911, -682, -656, -856, -1172, -1459, -1622, -1611, -1419, -1155, -968, -823, -516, -60, 261, 321, 286, 176, -230, -886, -1392, -1575, -1708, -1975, -2144, -1953, -1510, -1129, -970, -965, -1006, -1098, -1284, -1503, -1659, -1798, -2018, -2191, -2031, -1485, -791, -93, 687, 1527, 2129, 2276, 2107, 1840, 1410, 667, -189, -760, -999, -1217, -1530, -1714, -1621, -1371, -1105, -845, -583, -297, 21, 269, 322, 260, 264, 320, 286, 187, 137, 48, -292, -836, -1273, -1530, -1913, -2548, -3076, -3220, -3214, -3266, -3081, -2409, -1551, -852, -178, 637, 1310, 1490, 1270, 954, 614, 127, -470, -934, -1105, -1056, -919, -678, -258, 287, 763, 983, 970, 941, 944, 654, -132, -995, -1416, -1573, -1953, -2449, -2566, -2290, -1976, -1637, -1006, -149, 568, 994, 1295, 1659, 2094, 2455, 2606, 2572, 2479, 2348, 2041, 1467, 742, 32, -687, -1540, -2423, -3060, -3424, -3707, -3835, -3491, -2721, -1955, -1334, -594, 317, 1106, 1630, 2016, 2248, 2152, 1802, 1525, 1450, 1372, 1168, 1021, 1086, 1201, 1178, 1115, 1161, 1176, 948, 578, 331, 204, -30, -387, -583, -461, -190, 52, 388, 976, 1657, 2106, 2303, 2519, 2834, 2992, 2821, 2513, 2285, 2023, 1527, 886, 351, -68, -579, -1218, -1757, -2056, -2273, -2593, -2914, -2980, -2709, -2226, -1668, -1079, -450, 192, 741, 1124, 1448, 1776, 1827, 1337, 625, 235, 94, -301, -945, -1299, -1206, -1086, -1167, -1174, -923, -710, -806, -983, -885, -612, -547, -759, -964, -936, -656, -202, 240, 448, 423, 366, 341, 241, 39, -238, -669, -1291, -1945, -2451, -2785, -3003, -3228, -3624, -4090, -4225, -3928, -3662, -3773, -3947, -3787, -3446, -3225, -2956, -2317, -1499, -1020, -939, -735, -87, 627, 832, 457, -120, -616, -1047, -1526, -2017, -2334, -2362, -2266, -2255, -2200, -1815, -1241, -937, -983, -981, -719, -445, -395, -477, -482, -329, -73, 164, 305, 376, 371, 178, -215, -618, -926, -1275, -1711, -2022, -2099, -2165, -2405, -2626, -2556, -2268, -2029, -1875, -1650, -1396, -1302, -1313, -1229, -1144, -1274, -1441, -1287, -917, -756, -826, -726, -338, 3, 59, -26, -125, -397, -901, -1327, -1429, -1415, -1565, -1728, -1597, -1205, -787, -380, 106, 587, 875, 973, 1083, 1284, 1444, 1433, 1268, 1023, 805, 765, 918, 1006, 822, 511, 327, 292, 339, 494, 691, 697, 473, 311, 444, 776, 1063, 1205, 1270, 1399, 1691, 2078, 2301, 2149, 1747, 1445, 1355, 1234, 938, 663, 587, 553, 402, 345, 634, 1048, 1096, 723, 401, 440, 586, 491, 244, 137, 206, 282, 348, 558, 983, 1460, 1722, 1672, 1522, 1577, 1839, 1972, 1732, 1291, 995, 912, 848, 734, 730, 856, 906, 811, 774, 901, 1043, 1114, 1222, 1382, 1434, 1329, 1241, 1336, 1592, 1849, 1938, 1808, 1570, 1340, 1084, 721, 321, 22, -183, -416, -657, -695, -365, 209, 689, 864, 901, 1038, 1163, 1009, 705, 656, 819, 723, 306, 140, 559, 1112, 1267, 1178, 1280, 1438, 1163, 526, 121, 132, 128, -118, -315, -241, -25, 255, 721, 1358, 1907, 2175, 2222, 2247, 2346, 2430, 2365, 2205, 2168, 2315, 2445, 2383, 2287, 2447, 2813, 3001, 2801, 2440, 2190, 2032, 1925, 2023, 2356, 2624, 2664, 2794, 3374, 4209, 4753, 4791, 4576, 4298, 3813, 3015, 2173, 1658, 1517, 1536, 1575, 1659, 1837, 2124, 2539, 3086, 3640, 3907, 3641, 2949, 2252, 1848, 1607, 1234, 721, 364, 316, 396, 421, 494, 737, 943, 843, 532, 296, 179, 66, -18, -61, -253, -688, -1084, -1136, -937, -814, -929, -1226, -1611, -2038, -2451, -2705, -2623, -2207, -1704, -1290, -851, -263, 325, 780, 1245, 1806, 2147, 1928, 1251, 500, -38, -270, -289, -326, -472, -564, -500, -399, -296, -86, 59, -245, -958, -1550, -1715, -1681, -1721, -1811, -1821, -1710, -1457, -1004, -338, 412, 952, 1056, 889, 887, 1166, 1399, 1381, 1233, 955, 367, -380, -862, -1042, -1304, -1826, -2456, -3102, -3726, -4115, -4108, -3882, -3698, -3539, -3154, -2364, -1255, -200, 410, 572, 677, 1010, 1407, 1521, 1224, 621, -146, -930, -1493, -1664, -1571, -1581, -1908, -2411, -2803, -2959, -2942, -2890, -2920, -3063, -3243, -3355, -3306, -2994, -2419, -1789, -1351, -1091, -806, -410, 25, 417, 640, 499, -30, -666, -1129, -1497, -2033, -2757, -3445, -4023, -4632, -5237, -5521, -5336, -4925, -4518, -4007, -3227, -2251, -1224, -107, 1218, 2706, 4046, 4812, 4862, 4576, 4521, 4740, 4579, 3465, 1700, 172, -705, -1318, -2086, -2919, -3551, -3897, -3873, -3369, -2580, -1952, -1629, -1325, -863, -433, -65, 608, 1552, 1953, 1479, 1136, 1789, 2650, 2550, 1772, 1228, 837, 107, -624, -870, -1118, -2076, -3384, -4082, -3945, -3540, -3218, -2929, -2850, -3205, -3461, -2769, -1333, -317, -199, -271, 76, 634, 1216, 2187, 3590, 4537, 4291, 3422, 3009, 3098, 2829, 1800, 339, -1287, -3018, -4486, -5183, -5173, -5010, -4974, -4804, -4200, -3195, -1948, -514, 983, 2168, 2727, 2825, 2912, 3144, 3286, 3145, 2792, 2296, 1521, 407, -674, -1197, -1174, -1223, -1768, -2480, -2788, -2593, -2125, -1481, -711, -54, 333, 663, 1154, 1653, 1898, 1942, 1989, 1961, 1670, 1328, 1409, 1962, 2600, 3153, 3782, 4457, 4983, 5497, 6269, 7070, 7365, 7070, 6584, 6179, 5818, 5411, 4905, 4219, 3366, 2549, 1992, 1736, 1679, 1797, 2210, 2955, 3759, 4299, 4696, 5363, 6206, 6554, 6128, 5403, 4714, 3777, 2515, 1408, 623, -366, -1822, -3178, -3841, -3975, -4128, -4517, -4906, -4987, -4658, -4064, -3504, -3218, -3163, -3061, -2773, -2504, -2498, -2678, -2769, -2632, -2326, -1980, -1672, -1330, -765, 72, 943, 1584, 2029, 2484, 3007, 3440, 3631, 3547, 3233, 2781, 2351, 2045, 1779, 1420, 1103, 1160, 1698, 2429, 3055, 3649, 4476, 5576, 6662, 7436, 7841, 8037, 8214, 8381, 8293, 7659, 6582, 5595, 5026, 4579, 3791, 2707, 1761, 1230, 1074, 1131, 1231, 1304, 1463, 1840, 2292, 2502, 2453, 2496, 2811, 3034, 2684, 1853, 1155, 961, 961, 660, 32, -579, -1017, -1312, -1353, -1108, -1018, -1540, -2363, -2742, -2592, -2530, -2892, -3322, -3483, -3503, -3531, -3357, -2816, -2198, -1817, -1545, -1165, -824, -658, -425, 24, 282, -74, -801, -1323, -1530, -1755, -2162, -2622, -3100, -3676, -4150, -4172, -3862, -3709, -3810, -3779, -3457, -3087, -2777, -2399, -2022, -1908, -2087, -2316, -2457, -2587, -2783, -3027, -3299, -3631, -3990, -4207, -4121, -3830, -3640, -3697, -3831, -3872, -3899, -4012, -4125, -4222, -4524, -5097, -5584, -5631, -5324, -4971, -4682, -4392, -4059, -3636, -3007, -2220, -1617, -1475, -1618, -1651, -1534, -1593, -1956, -2372, -2668, -3032, -3600, -4107, -4213, -4029, -3968, -4150, -4300, -4198, -3912, -3559, -3207, -2986, -3004, -3123, -3083, -2883, -2835, -3182, -3802, -4333, -4570, -4642, -4768, -4928, -4934, -4779, -4679, -4707, -4664, -4362, -3928, -3651, -3678, -3935, -4273, -4571, -4736, -4740, -4666, -4646, -4667, -4535, -4051, -3259, -2422, -1759, -1284, -876, -460, -60, 252, 426, 453, 355, 161, -115, -415, -626, -669, -583, -489, -466, -471, -381, -112, 299, 708, 989, 1151, 1316, 1518, 1624, 1570, 1497, 1449, 1168, 515, -175, -537, -693, -922, -1155, -1229, -1308, -1544, -1571, -957, -23, 395, 91, -265, -204, -76, -295, -646, -843, -1135, -1790, -2462, -2643, -2423, -2283, -2321, -2221, -1881, -1530, -1203, -650, 74, 495, 426, 340, 689, 1232, 1441, 1269, 1090, 1034, 878, 601, 534, 817, 1096, 1065, 979, 1284, 1949, 2568, 3009, 3474, 3980, 4274, 4298, 4275, 4329, 4355, 4209, 3762, 3021, 2367, 2278, 2634, 2749, 2354, 1999, 2250, 2891, 3287, 3211, 2959, 2799, 2645, 2347, 2015, 1807, 1553, 1015, 453, 370, 663, 747, 588, 756, 1296, 1536, 1286, 1254, 1856, 2477, 2487, 2263, 2492, 2992, 3012, 2454, 1969, 1849, 1638, 1054, 530, 445, 447, 128, -134, 269, 1110, 1680, 1985, 2640, 3643, 4291, 4347, 4390, 4820, 5257, 5138, 4426, 3585, 3099, 3059, 3127, 2921, 2440, 2020, 1937, 2143, 2319, 2177, 1764, 1437, 1376, 1355, 1185, 1085, 1270, 1573, 1796, 2044, 2374, 2612, 2784, 3141, 3574, 3606, 3107, 2517, 2228, 2204, 2218, 2096, 1757, 1259, 811, 594, 606, 681, 611, 338, 71, 72, 295, 504, 721, 1200, 1919, 2483, 2671, 2737, 3007, 3400, 3545, 3244, 2638, 1985, 1427, 988, 696, 548, 425, 228, 89, 247, 670, 1054, 1229, 1302, 1351, 1318, 1220, 1183, 1218, 1207, 1097, 907, 660, 465, 549, 974, 1435, 1517, 1168, 742, 528, 477, 385, 139, -274, -718, -888, -679, -436, -468, -523, -228, 192, 263, 85, 178, 641, 994, 890, 570, 491, 768, 1102, 1237, 1268, 1324, 1245, 906, 658, 866, 1257, 1343, 1166, 1024, 881, 728, 928, 1503, 1783, 1386, 869, 813, 931, 652, 13, -541, -889, -1291, -1845, -2284, -2343, -2122, -1909, -1829, -1731, -1401, -823, -240, 70, 138, 214, 357, 385, 245, 108, 26, -178, -590, -1051, -1432, -1814, -2275, -2686, -2883, -2908, -2870, -2751, -2543, -2393, -2327, -2052, -1360, -576, -212, -344, -564, -482, -83, 287, 248, -242, -860, -1301, -1553, -1717, -1815, -1908, -2167, -2631, -3016, -2968, -2473, -1884, -1555, -1521, -1560, -1465, -1180, -743, -255, 81, 30, -416, -894, -946, -520, -85, -166, -814, -1535, -1802, -1606, -1375, -1360, -1453, -1640, -2056, -2438, -2236, -1467, -754, -368, -64, 213, 375, 754, 1649, 2548, 2679, 2061, 1348, 997, 1031, 1184, 1039, 420, -298, -684, -755, -678, -401, 0, 78, -355, -777, -564, 174, 804, 993, 926, 829, 755, 837, 1257, 1781, 1793, 1074, 189, -214, -224, -362, -723, -973, -1058, -1252, -1479, -1281, -594, 107, 480, 576, 492, 319, 280, 445, 496, 149, -427, -914, -1240, -1450, -1437, -1112, -675, -446, -454, -439, -240, 68, 389, 650, 700, 452, 143, 148, 504, 878, 1045, 1089, 1101, 1016, 912, 1085, 1513, 1672, 1255, 702, 570, 768, 899, 935, 1066, 1162, 956, 581, 456, 654, 776, 536, 168, 40, 142, 248, 395, 846, 1584, 2216, 2438, 2429, 2533, 2740, 2676, 2140, 1352, 563, -270, -1198, -1961, -2298, -2368, -2488, -2611, -2439, -1951, -1412, -940, -403, 198, 592, 612, 513, 656, 989, 1086, 777, 393, 203, -5, -436, -815, -922, -1098, -1658, -2218, -2285, -2042, -1982, -2106, -2041, -1630, -1070, -667, -556, -537, -286, 132, 282, 18, -285, -329, -281, -385, -552, -607, -607, -668, -705, -599, -484, -621, -993, -1306, -1403, -1445, -1586, -1685, -1597, -1478, -1444, -1200, -515, 151, 189, -166, -164, 250, 362, -114, -597, -611, -499, -784, -1327, -1568, -1370, -1139, -1205, -1500, -1792, -1901, -1734, -1405, -1220, -1317, -1450, -1324, -982, -671, -473, -275, -47, 31, -167, -470, -550, -311, -61, -207, -760, -1196, -1028, -483, -213, -364, -462, -311, -317, -672, -921, -674, -254, -180, -393, -439, -179, 170, 533, 972, 1296, 1233, 942, 781, 712, 468, 152, 43, -2, -350, -874, -1021, -621, -114, 138, 304, 598, 847, 886, 955, 1271, 1612, 1691, 1577, 1498, 1554, 1781, 2128, 2357, 2262, 1935, 1585, 1278, 991, 710, 333, -255, -935, -1370, -1369, -1037, -546, 44, 667, 1170, 1538, 1993, 2641, 3180, 3258, 2978, 2757, 2742, 2718, 2527, 2320, 2344, 2618, 2863, 2762, 2328, 1929, 1847, 1852, 1450, 573, -209, -376, -91, 130, 181, 385, 887, 1458, 1874, 2145, 2329, 2403, 2368, 2239, 1879, 1201, 589, 607, 1084, 1200, 773, 580, 1009, 1378, 1151, 827, 979, 1279, 1085, 409, -190, -295, 38, 460, 736, 981, 1418, 2027, 2656, 3267, 3802, 4039, 3888, 3556, 3213, 2812, 2368, 1987, 1560, 898, 223, 4, 230, 375, 174, -39, 76, 350, 432, 386, 606, 1190, 1718, 1851, 1872, 2269, 2952, 3401, 3443, 3311, 3050, 2546, 2009, 1710, 1454, 951, 420, 169, -7, -368, -570, -195, 389, 435, -29, -252, -5, 63, -392, -847, -934, -1095, -1672, -2227, -2272, -1952, -1680, -1689, -2026, -2471, -2589, -2270, -1946, -1967, -2145, -2171, -2065, -1949, -1729, -1320, -952, -930, -1166, -1248, -980, -628, -510, -575, -563, -408, -217, 35, 473, 996, 1370, 1615, 1916, 2240, 2460, 2707, 3057, 3148, 2691, 2117, 2063, 2402, 2447, 1979, 1543, 1631, 2051, 2260, 2112, 1982, 2195, 2586, 2709, 2384, 1975, 2004, 2436, 2630, 2219, 1662, 1506, 1578, 1393, 940, 541, 318, 172, 3, -256, -512, -485, -179, -52, -331, -582, -397, -40, 32, -195, -486, -731, -917, -1019, -1102, -1294, -1585, -1837, -1960, -1980, -1974, -1985, -1989, -1951, -1948, -2080, -2247, -2267, -2233, -2395, -2658, -2692, -2521, -2492, -2659, -2733, -2643, -2626, -2746, -2770, -2590, -2410, -2446, -2637, -2764, -2732, -2646, -2632, -2663, -2648, -2608, -2671, -2888, -3098, -3105, -2957, -2900, -3006, -3074, -2999, -2953, -3038, -3076, -2957, -2882, -3027, -3234, -3281, -3229, -3274, -3432, -3584, -3721, -3888, -3965, -3787, -3464, -3307, -3379, -3392, -3168, -2928, -2920, -2993, -2840, -2523, -2422, -2638, -2820, -2664, -2314, -2081, -2013, -1942, -1817, -1775, -1877, -1969, -1872, -1678, -1676, -1925, -2169, -2268, -2346, -2397, -2244, -2056, -2279, -2833, -3029, -2582, -2062, -2022, -2290, -2403, -2303, -2200, -2110, -1924, -1731, -1713, -1825, -1875, -1878, -1956, -2019, -1892, -1735, -1910, -2402, -2758, -2718, -2543, -2512, -2528, -2476, -2543, -2771, -2763, -2301, -1800, -1697, -1846, -1883, -1761, -1558, -1226, -834, -689, -883, -1045, -834, -449, -276, -261, -132, -5, -145, -337, -165, 209, 285, 32, -116, 6, 137, 63, -88, -49, 243, 516, 472, 237, 224, 523, 796, 844, 822, 870, 976, 1158, 1369, 1367, 1085, 874, 983, 1131, 963, 621, 442, 401, 240, -15, -89, 75, 239, 299, 417, 672, 936, 1161, 1408, 1617, 1713, 1795, 1859, 1630, 1070, 725, 1005, 1419, 1181, 452, 203, 747, 1257, 1113, 807, 929, 1186, 1116, 954, 1083, 1374, 1574, 1693, 1759, 1761, 1941, 2535, 3228, 3430, 3128, 2958, 3310, 3812, 3927, 3676, 3406, 3224, 3055, 2922, 2807, 2568, 2254, 2088, 2010, 1761, 1471, 1542, 1923, 2105, 1924, 1837, 2217, 2797, 3060, 2923, 2740, 2758, 2868, 2853, 2627, 2248, 1875, 1647, 1499, 1252, 925, 702, 595, 415, 130, -62, -38, 69, 58, -113, -296, -309, -162, -26, 26, 149, 430, 694, 778, 812, 1016, 1323, 1466, 1357, 1176, 1109, 1080, 850, 377, -44, -167, -188, -487, -1018, -1322, -1172, -868, -788, -896, -856, -460, 182, 796, 1175, 1324, 1481, 1847, 2228, 2214, 1850, 1669, 1835, 1860, 1481, 1103, 1039, 1048, 908, 764, 707, 651, 696, 992, 1279, 1161, 806, 791, 1160, 1269, 837, 441, 504, 572, 232, -66, 138, 514, 648, 715, 875, 880, 718, 760, 945, 654, -264, -1099, -1282, -1229, -1627, -2359, -2766, -2678, -2424, -2132, -1719, -1296, -911, -273, 687, 1458, 1680, 1688, 1934, 2317, 2407, 1952, 1061, 130, -411, -536, -687, -1192, -1774, -1895, -1523, -1146, -999, -751, -176, 413, 691, 796, 957, 1091, 1089, 1034, 939, 674, 293, 89, 237, 604, 928, 1028, 935, 923, 1280, 1939, 2396, 2167, 1290, 338, -165, -320, -700, -1595, -2577, -3014, -2847, -2564, -2441, -2140, -1204, 240, 1556, 2322, 2785, 3438, 4280, 4693, 4142, 2822, 1455, 457, -478, -1820, -3443, -4740, -5365, -5473, -5299, -4866, -4145, -3148, -1841, -246, 1353, 2572, 3362, 4022, 4666, 5001, 4835, 4396, 3887, 3136, 2112, 1261, 910, 770, 473, 164, 149, 368, 616, 998, 1741, 2671, 3294, 3365, 3075, 2692, 2379, 2257, 2253, 1968, 1196, 411, 237, 647, 1138, 1460, 1710, 1958, 2156, 2277, 2293, 2125, 1723, 1080, 182, -931, -2081, -3015, -3615, -3965, -4223, -4419, -4405, -4006, -3197, -2118, -963, 135, 1071, 1723, 2020, 2110, 2236, 2321, 1967, 1061, 46, -672, -1196, -1745, -2240, -2504, -2503, -2195, -1566, -832, -224, 390, 1276, 2323, 3133, 3559, 3793, 3951, 3903, 3628, 3349, 3163, 2900, 2547, 2361, 2367, 2282, 2130, 2328, 2957, 3576, 3910, 4122, 4357, 4557, 4755, 5059, 5301, 5140, 4619, 4236, 4289, 4496, 4476, 4300, 4240, 4302, 4362, 4491, 4778, 5114, 5358, 5455, 5301, 4862, 4408, 4259, 4302, 4108, 3531, 2890, 2579, 2657, 2836, 2851, 2758, 2841, 3169, 3433, 3327, 2997, 2880, 3032, 2972, 2410, 1747, 1477, 1419, 1083, 455, -88, -355, -397, -307, -267, -426, -596, -455, -73, 186, 207, 124, -42, -350, -636, -696, -736, -1191, -2020, -2623, -2696, -2622, -2749, -2904, -2938, -3005, -3020, -2670, -2139, -1970, -2125, -2067, -1760, -1680, -1917, -2070, -1987, -1937, -2089, -2279, -2350, -2353, -2327, -2254, -2287, -2581, -2841, -2644, -2284, -2432, -2967, -3122, -2783, -2569, -2690, -2781, -2716, -2694, -2712, -2658, -2609, -2598, -2492, -2331, -2365, -2599, -2750, -2721, -2731, -2932, -3215, -3474, -3759, -4057, -4195, -4168, -4279, -4656, -4965, -4905, -4652, -4495, -4432, -4366, -4284, -4079, -3674, -3323, -3345, -3609, -3747, -3731, -3799, -4015, -4273, -4576, -4960, -5275, -5348, -5322, -5490, -5805, -5909, -5719, -5549, -5557, -5504, -5249, -5007, -4928, -4794, -4429, -4039, -3930, -4075, -4190, -4123, -3984, -3948, -4088, -4396, -4792, -5081, -5090, -4898, -4802, -4984, -5285, -5356, -5011, -4445, -4040, -3935, -3889, -3667, -3376, -3245, -3259, -3192, -2914, -2546, -2359, -2501, -2782, -2810, -2466, -2099, -2057, -2238, -2290, -2128, -1976, -1966, -1982, -1927, -1872, -1853, -1782, -1672, -1653, -1660, -1452, -1064, -832, -874, -927, -798, -576, -356, -133, 14, -59, -274, -331, -120, 97, 63, -140, -302, -439, -655, -870, -936, -880, -804, -762, -808, -932, -946, -709, -417, -367, -520, -597, -503, -386, -339, -310, -306, -400, -480, -314, 2, 70, -189, -364, -207, 37, 112, 24, -222, -575, -729, -516, -305, -476, -768, -696, -288, 41, 156, 255, 435, 597, 760, 1021, 1217, 1158, 1142, 1530, 1924, 1696, 1164, 1133, 1520, 1596, 1303, 1175, 1301, 1359, 1303, 1266, 1191, 1087, 1180, 1476, 1603, 1399, 1241, 1450, 1759, 1806, 1829, 2213, 2664, 2693, 2565, 2838, 3345, 3580, 3577, 3605, 3596, 3570, 3778, 4025, 3789, 3197, 2898, 2947, 2844, 2531, 2430, 2587, 2625, 2464, 2453, 2761, 3133, 3320, 3401, 3504, 3630, 3863, 4318, 4716, 4627, 4235, 4112, 4288, 4353, 4266, 4196, 3950, 3405, 2992, 3010, 3118, 3010, 2848, 2686, 2330, 1969, 2110, 2699, 3047, 2811, 2461, 2555, 3029, 3487, 3803, 4047, 4137, 4058, 4063, 4251, 4339, 4232, 4179, 4162, 3870, 3440, 3328, 3442, 3302, 2986, 2996, 3307, 3404, 3189, 3095, 3304, 3480, 3385, 3235, 3228, 3228, 3162, 3230, 3419, 3411, 3260, 3380, 3713, 3752, 3487, 3423, 3637, 3700, 3491, 3333, 3355, 3388, 3381, 3440, 3488, 3349, 3145, 3192, 3435, 3459, 3202, 3074, 3210, 3291, 3236, 3299, 3440, 3413, 3389, 3633, 3862, 3722, 3469, 3451, 3456, 3203, 2915, 2859, 2827, 2535, 2170, 2067, 2146, 2064, 1795, 1597, 1515, 1363, 1149, 1009, 831, 476, 160, 77, -25, -400, -809, -940, -935, -1076, -1323, -1492, -1596, -1725, -1828, -1859, -1965, -2274, -2628, -2814, -2955, -3282, -3700, -3933, -4017, -4193, -4464, -4654, -4739, -4776, -4703, -4471, -4222, -4090, -3953, -3646, -3269, -3054, -2992, -2925, -2923, -3148, -3429, -3514, -3572, -3877, -4211, -4248, -4187, -4318, -4409, -4145, -3725, -3476, -3331, -3103, -2845, -2672, -2572, -2555, -2692, -2935, -3131, -3231, -3335, -3469, -3516, -3408, -3238, -3048, -2756, -2430, -2285, -2293, -2203, -2041, -2071, -2242, -2314, -2406, -2741, -3084, -3121, -3073, -3238, -3401, -3268, -3015, -2904, -2795, -2411, -1770, -1115, -658, -447, -305, -17, 331, 401, 62, -454, -908, -1307, -1736, -2186, -2605, -2961, -3180, -3138, -2783, -2248, -1756, -1390, -1023, -527, 10, 342, 326, 99, -85, -210, -504, -984, -1305, -1305, -1300, -1459, -1419, -975, -536, -420, -331, 3, 329, 382, 304, 233, 45, -276, -493, -509, -534, -746, -1003, -1040, -831, -622, -583, -556, -277, 234, 663, 818, 899, 1203, 1687, 1954, 1734, 1244, 957, 1012, 1006, 536, -218, -675, -584, -304, -226, -212, 142, 859, 1489, 1736, 1804, 2014, 2359, 2588, 2505, 2084, 1524, 1155, 1032, 828, 427, 238, 515, 884, 940, 839, 925, 1221, 1581, 1900, 2043, 1978, 1914, 2006, 2087, 2000, 1922, 2045, 2172, 1977, 1510, 1128, 1010, 992, 899, 773, 709, 664, 609, 661, 911, 1264, 1519, 1561, 1416, 1216, 1117, 1161, 1218, 1145, 980, 876, 907, 1008, 1104, 1241, 1489, 1763, 1823, 1582, 1267, 1081, 897, 535, 136, -86, -257, -599, -983, -1112, -924, -560, -171, 25, -143, -500, -639, -468, -340, -555, -984, -1261, -1210, -1001, -916, -982, -931, -582, -167, -115, -507, -931, -1006, -871, -923, -1211, -1397, -1284, -1052, -922, -872, -741, -430, 0, 324, 345, 171, 162, 486, 877, 976, 791, 655, 759, 909, 841, 634, 648, 1025, 1445, 1496, 1201, 990, 1159, 1551, 1786, 1717, 1568, 1612, 1795, 1836, 1758, 1940, 2450, 2772, 2545, 2143, 2076, 2242, 2247, 2096, 2070, 2141, 2023, 1727, 1614, 1826, 2074, 2099, 2008, 1977, 1967, 1908, 1888, 1962, 2054, 2111, 2112, 2018, 1880, 1869, 2020, 2130, 2056, 1884, 1727, 1573, 1433, 1378, 1364, 1225, 958, 826, 957, 1091, 1009, 965, 1254, 1604, 1549, 1190, 1022, 1135, 1145, 822, 362, 65, -16, -94, -374, -768, -972, -880, -735, -751, -830, -785, -648, -557, -493, -354, -194, -164, -237, -234, -146, -166, -343, -519, -650, -878, -1226, -1511, -1632, -1685, -1760, -1831, -1832, -1723, -1491, -1184, -913, -756, -664, -555, -439, -408, -510, -706, -933, -1135, -1259, -1323, -1421, -1531, -1469, -1194, -959, -955, -1001, -868, -728, -921, -1387, -1707, -1744, -1839, -2206, -2548, -2531, -2302, -2192, -2180, -2003, -1602, -1172, -904, -850, -958, -1113, -1198, -1238, -1408, -1798, -2244, -2527, -2662, -2821, -3052, -3252, -3361, -3391, -3365, -3341, -3364, -3320, -3082, -2805, -2784, -2975, -2995, -2724, -2542, -2761, -3125, -3234, -3204, -3413, -3784, -3901, -3749, -3704, -3825, -3753, -3380, -3080, -3104, -3216, -3165, -3121, -3306, -3561, -3679, -3818, -4132, -4362, -4256, -4037, -3994, -3949, -3609, -3074, -2638, -2346, -2077, -1815, -1631, -1495, -1369, -1370, -1592, -1868, -1966, -1972, -2149, -2500, -2799, -2964, -3065, -3091, -2982, -2758, -2453, -2066, -1684, -1413, -1174, -800, -376, -194, -299, -373, -240, -180, -479, -921, -1121, -1146, -1334, -1643, -1717, -1523, -1397, -1459, -1411, -1070, -702, -647, -812, -815, -557, -372, -515, -758, -734, -494, -388, -494, -587, -552, -462, -331, -145, -28, -67, -125, -78, -5, 14, 41, 87, 76, 19, -38, -164, -381, -502, -378, -134, 29, 71, 104, 321, 839, 1449, 1763, 1775, 1876, 2163, 2237, 1916, 1548, 1355, 1065, 477, -135, -391, -292, -141, -159, -190, 128, 822, 1410, 1554, 1566, 1829, 2133, 2086, 1809, 1656, 1615, 1464, 1214, 1022, 945, 976, 1084, 1154, 1138, 1173, 1361, 1556, 1577, 1500, 1528, 1672, 1762, 1743, 1732, 1754, 1696, 1561, 1480, 1411, 1185, 882, 777, 887, 997, 1084, 1313, 1648, 1872, 1970, 2132, 2386, 2530, 2426, 2167, 1950, 1830, 1651, 1290, 892, 702, 698, 700, 742, 952, 1205, 1339, 1515, 1894, 2230, 2289, 2255, 2324, 2311, 2073, 1816, 1693, 1564, 1380, 1301, 1358, 1380, 1334, 1374, 1554, 1734, 1808, 1844, 1947, 2129, 2358, 2611, 2805, 2846, 2809, 2858, 2928, 2813, 2549, 2352, 2237, 2113, 2057, 2086, 1977, 1681, 1529, 1682, 1847, 1822, 1767, 1773, 1687, 1512, 1454, 1522, 1486, 1257, 993, 865, 905, 1018, 1100, 1175, 1334, 1521, 1568, 1520, 1636, 1925, 2014, 1672, 1213, 1073, 1187, 1177, 1006, 1008, 1221, 1257, 968, 744, 895, 1187, 1289, 1276, 1372, 1535, 1617, 1695, 1921, 2174, 2179, 1943, 1785, 1859, 1898, 1640, 1301, 1253, 1392, 1320, 1092, 1117, 1365, 1407, 1240, 1274, 1509, 1539, 1340, 1257, 1302, 1160, 822, 614, 627, 617, 444, 294, 370, 627, 908, 1180, 1481, 1739, 1829, 1710, 1437, 1111, 830, 571, 218, -161, -344, -351, -445, -599, -489, -142, 46, 13, 101, 395, 594, 566, 487, 462, 439, 356, 186, 39, 146, 418, 399, 75, 67, 528, 726, 308, -82, -1, 71, -251, -582, -577, -510, -669, -891, -933, -805, -654, -604, -692, -829, -900, -906, -901, -882, -844, -810, -723, -518, -308, -257, -263, -79, 218, 249, -94, -383, -268, -48, -214, -655, -851, -711, -627, -732, -737, -531, -340, -281, -222, -72, 111, 227, 169, -50, -228, -214, -163, -257, -387, -375, -285, -228, -131, 66, 232, 294, 422, 739, 1018, 973, 719, 606, 655, 557, 240, -10, -92, -270, -655, -925, -820, -602, -658, -882, -813, -326, 186, 367, 318, 322, 410, 455, 522, 733, 928, 869, 708, 745, 841, 628, 217, 46, 122, 54, -211, -314, -135, -3, -142, -325, -263, -61, -37, -234, -362, -255, -106, -129, -241, -190, 71, 297, 294, 257, 475, 750, 661, 347, 313, 440, 206, -204, -164, 149, 64, -269, -183, 152, 39, -397, -406, 16, 106, -346, -639, -326, 62, -107, -582, -695, -439, -395, -697, -826, -547, -314, -421, -459, -95, 278, 247, 110, 290, 532, 378, -7, -149, -57, -121, -380, -499, -406, -401, -563, -612, -507, -550, -773, -826, -599, -375, -297, -240, -155, -96, -43, -5, -86, -232, -250, -128, -33, -11, -4, -76, -284, -467, -472, -437, -586, -872, -1040, -993, -917, -1025, -1285, -1459, -1441, -1396, -1427, -1334, -972, -606, -518, -515, -251, 140, 232, 8, -101, 71, 200, 28, -236, -354, -455, -710, -954, -998, -1002, -1159, -1296, -1203, -1081, -1227, -1454, -1350, -1019, -962, -1207, -1247, -956, -805, -923, -817, -326, -28, -284, -603, -496, -343, -740, -1445, -1727, -1543, -1543, -1942, -2219, -2076, -1871, -1910, -1985, -1863, -1707, -1745, -1909, -2015, -2041, -2042, -1964, -1755, -1523, -1364, -1168, -805, -407, -235, -309, -407, -408, -423, -553, -742, -954, -1226, -1453, -1477, -1437, -1581, -1746, -1594, -1278, -1204, -1283, -1177, -947, -798, -610, -328, -209, -247, -45, 413, 633, 419, 83, -206, -581, -1006, -1235, -1259, -1319, -1497, -1618, -1570, -1454, -1374, -1244, -945, -584, -414, -519, -748, -941, -1098, -1256, -1354, -1349, -1322, -1357, -1381, -1246, -945, -633, -464, -445, -480, -522, -672, -1037, -1497, -1740, -1635, -1441, -1488, -1655, -1492, -943, -545, -644, -885, -901, -951, -1356, -1809, -1827, -1426, -920, -506, -311, -413, -612, -607, -479, -582, -974, -1308, -1367, -1326, -1418, -1576, -1605, -1511, -1422, -1320, -1082, -748, -490, -338, -192, -92, -235, -647, -1037, -1134, -1000, -878, -864, -887, -904, -930, -946, -941, -998, -1186, -1385, -1401, -1251, -1131, -1107, -1022, -781, -518, -377, -278, -100, 49, -8, -196, -263, -187, -207, -409, -560, -471, -239, -49, 39, -4, -241, -582, -750, -631, -487, -621, -936, -1114, -1105, -1148, -1293, -1290, -1026, -719, -515, -231, 268, 671, 569, 124, -16, 397, 808, 637, 145, -2, 193, 121, -385, -800, -817, -812, -1063, -1154, -688, -120, -159, -602, -633, -130, 295, 417, 515, 556, 340, 189, 458, 780, 714, 548, 726, 1143, 1521, 1757, 1669, 1144, 598, 551, 828, 858, 580, 408, 421, 259, -139, -320, -67, 162, -14, -235, 41, 705, 1218, 1295, 1040, 745, 727, 1006, 1183, 1042, 985, 1368, 1804, 1661, 939, 186, -185, -153, 120, 454, 739, 956, 1098, 1150, 1186, 1300, 1390, 1280, 1034, 899, 964, 1108, 1186, 1069, 739, 503, 737, 1317, 1754, 1881, 1879, 1814, 1740, 1898, 2222, 2187, 1684, 1347, 1543, 1798, 1665, 1374, 1205, 979, 660, 738, 1473, 2209, 2143, 1442, 924, 817, 688, 420, 394, 730, 1142, 1544, 2062, 2464, 2284, 1663, 1341, 1481, 1372, 767, 467, 832, 982, 439, 139, 760, 1510, 1580, 1323, 1270, 1355, 1506, 1758, 1836, 1597, 1346, 1077, 394, -374, -347, 390, 809, 591, 378, 445, 417, 291, 528, 1064, 1229, 850, 594, 894, 1263, 1189, 983, 1107, 1348, 1361, 1338, 1423, 1156, 236, -719, -886, -282, 399, 717, 826, 1018, 1237, 1204, 927, 719, 608, 271, -183, -157, 342, 579, 470, 772, 1479, 1620, 1049, 700, 795, 546, -210, -748, -736, -483, -260, -255, -537, -604, 66, 995, 1384, 1440, 1706, 1768, 1059, 94, -303, -180, 26, 142, 45, -221, -159, 353, 536, -17, -540, -460, -229, -144, 110, 394, 247, 53, 427, 874, 654, 216, 259, 429, 154, -286, -441, -380, -260, -150, -259, -524, -448, -18, 118, -144, -135, 304, 604, 614, 679, 754, 608, 473, 457, 120, -582, -973, -780, -493, -355, -122, 198, 446, 788, 1226, 1296, 954, 882, 1297, 1448, 852, 123, 30, 463, 757, 571, 136, -149, -177, -118, -80, 37, 247, 331, 250, 346, 851, 1381, 1316, 631, -18, -89, 243, 397, 163, -86, 66, 515, 746, 465, -5, -59, 461, 1040, 1105, 688, 275, 107, -36, -327, -539, -416, -172, -242, -592, -665, -137, 608, 911, 606, 192, 231, 670, 902, 532, -97, -369, -201, -65, -259, -540, -578, -442, -424, -542, -559, -386, -171, 0, 197, 459, 783, 1151, 1409, 1385, 1224, 1212, 1253, 1036, 599, 151, -340, -787, -769, -294, -69, -413, -669, -308, 247, 476, 639, 1119, 1534, 1362, 1021, 1259, 1741, 1515, 748, 518, 920, 921, 166, -570, -758, -639, -503, -423, -478, -550, -343, 17, -16, -491, -716, -282, 261, 232, -148, -138, 353, 667, 482, 267, 414, 609, 431, 71, 26, 324, 490, 220, -221, -406, -330, -334, -555, -785, -878, -959, -1102, -1116, -878, -638, -667, -756, -489, -11, 55, -378, -575, -20, 748, 888, 407, -22, -129, -239, -490, -570, -419, -482, -903, -1144, -823, -332, -180, -190, 79, 547, 750, 568, 278, 41, -198, -350, -306, -352, -830, -1398, -1372, -755, -214, -88, -116, -46, 90, 171, 79, -178, -341, -244, -190, -501, -898, -924, -657, -510, -611, -802, -917, -853, -672, -655, -875, -924, -501, 19, 96, -203, -412, -360, -245, -193, -180, -270, -535, -757, -627, -310, -298, -626, -809, -658, -546, -691, -839, -791, -708, -780, -979, -1150, -1086, -712, -264, -43, 24, 190, 413, 463, 305, -10, -525, -1070, -1209, -812, -371, -385, -742, -946, -756, -390, -175, -181, -246, -277, -406, -764, -1171, -1179, -673, -276, -627, -1312, -1333, -666, -236, -307, -229, 102, 37, -448, -602, -301, -254, -688, -1009, -906, -810, -1014, -1137, -810, -331, -146, -93, 254, 736, 763, 234, -297, -431, -407, -666, -1182, -1466, -1191, -649, -360, -362, -236, 183, 598, 784, 858, 896, 714, 223, -339, -680, -794, -912, -1196, -1457, -1276, -516, 329, 592, 200, -257, -316, -202, -431, -1044, -1506, -1363, -740, -137, 97, 27, -54, 13, 67, -152, -601, -918, -904, -837, -1032, -1227, -849, 53, 698, 641, 376, 466, 655, 387, -289, -812, -806, -445, -291, -699, -1257, -1154, -349, 227, -38, -584, -580, -112, 60, -384, -972, -1092, -650, -27, 292, 81, -383, -511, -178, -49, -623, -1351, -1393, -811, -306, -209, -365, -526, -436, -38, 229, -24, -415, -319, 158, 458, 382, 41, -449, -765, -508, 113, 399, 119, -283, -438, -385, -245, -48, 231, 621, 901, 593, -310, -993, -819, -221, 99, 216, 503, 757, 623, 370, 417, 471, -31, -814, -976, -373, 144, 63, -218, -386, -736, -1280, -1397, -839, -203, 18, 96, 438, 910, 1136, 1017, 665, 155, -320, -415, -122, -13, -502, -1165, -1273, -763, -160, 282, 687, 932, 670, 85, -136, 108, 51, -653, -1134, -502, 707, 1239, 908, 668, 952, 1089, 694, 469, 939, 1368, 865, -216, -817, -563, 33, 321, 63, -400, -426, 182, 825, 850, 401, 102, 176, 277, 76, -328, -605, -621, -550, -504, -285, 208, 614, 609, 536, 857, 1270, 1139, 532, 62, 3, 243, 674, 1086, 1126, 757, 309, 10, -65, 146, 327, -163, -1183, -1481, -311, 1278, 1695, 872, 175, 431, 968, 822, 118, -283, -54, 319, 311, -64, -402, -380, -93, 115, 167, 294, 457, 269, -244, -431, 43, 576, 439, -196, -530, -187, 346, 362, -195, -622, -242, 779, 1593, 1526, 714, -72, -128, 526, 1129, 978, 267, -132, 155, 407, -160, -1059, -1028, 69, 906, 669, 233, 573, 1095, 622, -693, -1514, -1074, 5, 583, 254, -306, -178, 711, 1403, 1011, -132, -805, -486, 50, 101, 61, 386, 632, 459, 399, 707, 756, 310, -36, -39, -4, 13, -69, -630, -1242, -874, -15, -318, -1514, -1470, 168, 1369, 1130, 648, 784, 954, 824, 959, 1453, 1528, 931, 509, 819, 1118, 486, -668, -1202, -972, -882, -1298, -1491, -885, -21, 197, -229, -396, 271, 1205, 1389, 602, -395, -777, -286, 781, 1697, 1656, 664, -251, -269, 346, 970, 1301, 1015, -31, -1005, -940, -392, -731, -2003, -3003, -2960, -1929, -368, 687, 296, -847, -1025, 39, 939, 772, -1, -628, -644, 58, 822, 757, 136, 33, 442, 311, -486, -876, -367, 300, 456, 305, 269, 346, 369, 388, 579, 889, 981, 661, 223, 62, 105, 97, 163, 384, 254, -505, -1148, -957, -391, -93, 181, 668, 882, 665, 545, 546, 195, -179, 136, 727, 602, -62, -260, 123, 325, 90, -85, 28, 131, 198, 624, 1339, 1666, 1408, 1114, 975, 570, -17, -74, 470, 862, 745, 492, 247, -241, -687, -335, 615, 861, 28, -492, 171, 847, 533, 278, 983, 1444, 592, -381, -106, 694, 702, 93, -171, 156, 657, 926, 843, 579, 284, -205, -950, -1374, -895, 23, 292, -193, -289, 535, 1080, 270, -795, -394, 981, 1432, 641, -164, -628, -1302, -1804, -1176, 195, 839, 224, -724, -970, -392, 440, 957, 930, 416, -371, -1062, -1269, -949, -485, -207, 33, 549, 1151, 1223, 592, -62, -33, 443, 560, 130, -163, 124, 378, -181, -1162, -1545, -1338, -1327, -1342, -533, 709, 1189, 1013, 1066, 989, 5, -1057, -929, -72, 337, 344, 481, 509, 191, 6, 250, 542, 499, 75, -501, -654, -39, 658, 562, 64, 74, 334, 72, -348, -111, 426, 345, -269, -712, -966, -1354, -1433, -552, 693, 999, 417, 370, 1270, 1810, 1208, 365, 142, 176, 4, -177, -292, -560, -736, -322, 351, 351, -432, -993, -701, -171, -106, -246, -207, -160, 41, 865, 1688, 1302, 167, -155, 283, 218, -247, -126, 154, -357, -937, -340, 705, 507, -729, -1201, -453, 59, -389, -643, 42, 585, 124, -415, -91, 489, 525, 298, 208, -3, -441, -679, -502, -119, 305, 764, 1220, 1623, 1778, 1400, 733, 445, 503, 199, -302, -70, 649, 610, -231, -854, -1158, -1514, -1265, -53, 791, 417, 66, 654, 1058, 412, -326, -369, -342, -688, -806, -322, 301, 658, 813, 800, 480, -101, -610, -716, -407, -36, -39, -478, -889, -749, -114, 380, 276, -137, -221, 79, 102, -422, -680, -38, 622, 274, -272, 237, 1073, 881, 307, 575, 924, 212, -654, -518, -279, -1002, -1631, -911, 109, -230, -1243, -973, 367, 563, -893, -1855, -978, 372, 657, 357, 573, 1335, 2019, 2112, 1453, 601, 389, 610, 293, -533, -889, -680, -773, -1282, -1408, -956, -617, -673, -617, -209, 111, 185, 482, 1010, 1066, 694, 865, 1519, 1344, 284, -84, 517, 372, -1078, -1995, -1173, -17, -246, -1341, -1593, -636, 293, 269, -280, -496, -244, 2, -111, -494, -703, -347, 367, 700, 278, -358, -399, 328, 1275, 1816, 1831, 1652, 1459, 930, -252, -1635, -2201, -1575, -693, -771, -1697, -2184, -1626, -818, -556, -690, -870, -937, -449, 728, 1639, 1523, 1133, 1259, 1384, 1149, 1184, 1303, 325, -1393, -1966, -1117, -590, -1093, -1486, -1250, -1277, -1803, -1682, -460, 599, 598, 578, 1638, 2858, 2799, 1829, 1188, 886, 302, -310, -476, -573, -1027, -1361, -1069, -588, -532, -636, -347, 31, -250, -965, -974, -5, 661, -87, -1527, -1974, -956, 334, 692, 175, -392, -487, -184, 120, 130, 83, 506, 1225, 1382, 778, 137, -254, -809, -1455, -1719, -1810, -2053, -1885, -948, -108, 10, 67, 443, 465, 87, 341, 1343, 1808, 1164, 405, 363, 654, 780, 1018, 1635, 2014, 1370, 79, -506, 87, 553, -422, -2058, -2426, -1168, 230, 727, 586, 61, -958, -1875, -1687, -610, -7, -467, -1085, -808, 243, 996, 681, -218, -406, 678, 2096, 2476, 1446, -225, -1368, -1282, -456, -235, -1133, -2052, -1971, -1481, -1529, -1700, -1099, -77, 379, 383, 829, 1648, 1792, 1077, 660, 1212, 1843, 1582, 774, 162, -320, -979, -1542, -1659, -1510, -1407, -1325, -1088, -622, 15, 610, 925, 947, 842, 708, 589, 611, 733, 545, -282, -1351, -1747, -1074, 4, 549, 431, 274, 459, 658, 391, -310, -901, -859, -281, 156, 70, -132, -93, -274, -1052, -1692, -1226, 190, 1570, 2019, 1228, 53, 86, 1247, 1373, -103, -711, 704, 1704, 726, -269, 94, 283, -536, -918, -446, -518, -1226, -1155, -338, -204, -774, -561, 833, 2009, 1795, 678, -109, -117, 201, 435, 552, 464, -15, -641, -771, -231, 300, 155, -424, -672, -248, 504, 870, 323, -628, -726, -9, -268, -1983, -2814, -1204, 903, 1300, 873, 1237, 1648, 886, -37, 286, 898, 216, -726, 180, 2060, 2050, 228, -444, 657, 995, -269, -1032, -412, 71, -50, 552, 1885, 2073, 504, -1001, -918, -36, 111, -491, -826, -668, -598, -695, -507, -43, 280, 472, 841, 1226, 1100, 429, -212, -392, -118, 525, 1246, 1250, 230, -631, -114, 1055, 1324, 705, 233, -46, -702, -1551, -2106, -2270, -1831, -755, -38, -513, -1339, -1359, -819, -269, 421, 820, 105, -865, -361, 1101, 1445, 688, 741, 1738, 1715, 217, -726, -30, 658, -28, -796, -303, 146, -898, -2069, -1578, -459, -566, -1357, -1287, -532, -3, 629, 1860, 2626, 1626, -319, -986, 261, 1729, 1852, 981, 212, -217, -633, -1035, -1136, -745, 123, 1087, 1446, 922, 169, 96, 766, 1438, 1587, 1325, 796, -146, -1330, -2022, -1796, -1091, -470, 158, 1012, 1619, 1329, 464, 27, 190, 50, -803, -1491, -1111, 97, 1167, 1318, 530, -282, -256, 72, -371, -1017, -375, 1025, 1016, -636, -1724, -1103, -205, -416, -1076, -1038, -530, -337, -281, 161, 593, 411, 62, 121, 25, -745, -1368, -1048, -384, -129, -90, -36, -112, -159, -54, -138, -159, 586, 1300, 443, -1014, -551, 1414, 1914, 468, -305, 705, 1718, 1477, 855, 718, 649, 261, 32, 273, 391, -149, -860, -942, -539, -477, -942, -1264, -950, -288, 220, 435, 467, 523, 938, 1745, 2226, 1723, 802, 508, 689, 415, -146, 39, 812, 759, -395, -1105, -582, -291, -1346, -2219, -1261, 188, 148, -335, 761, 2422, 2266, 702, -55, 333, 539, 97, -340, -201, 484, 910, 275, -668, -519, 26, -667, -1571, -600, 920, 324, -1254, -1070, 29, -138, -489, 733, 2035, 1542, 361, -18, -181, -668, -725, -259, -187, -520, -422, -21, -175, -695, -532, 298, 511, -346, -1013, -505, 291, 101, -785, -1238, -1010, -583, -89, 516, 744, 218, -318, 107, 1010, 1119, 519, 241, 60, -925, -1951, -1529, -132, 669, 757, 756, 306, -687, -977, -61, 627, 115, -494, 44, 1310, 2100, 1893, 1097, 540, 620, 806, 482, -51, -304, -585, -1161, -1459, -1200, -1020, -1028, -460, 481, 464, -540, -852, 20, 246, -1333, -2972, -2462, -457, 587, 97, -157, 834, 1909, 1844, 1012, 268, -322, -749, -416, 688, 1211, 194, -1256, -1535, -868, -431, -295, -103, -385, -1233, -1253, 275, 1799, 1729, 678, 125, 303, 490, 254, -327, -968, -1288, -1051, -430, 152, 373, 168, -298, -711, -755, -390, 48, 174, 53, 202, 817, 1225, 570, -917, -1959, -1743, -874, -407, -439, -262, 303, 599, 287, -93, -187, -396, -769, -600, 65, 86, -687, -805, 292, 1162, 787, 127, 275, 829, 1000, 938, 1172, 1614, 1657, 996, 165, 0, 403, 314, -600, -1163, -440, 731, 956, 149, -850, -1684, -2352, -2315, -973, 1074, 2267, 1813, 587, -27, 266, 676, 586, 161, -272, -633, -684, -107, 634, 518, -465, -997, -326, 573, 519, -179, -496, -352, -298, -101, 833, 1839, 1544, 239, -224, 625, 1048, -135, -1789, -2187, -1126, 262, 781, 78, -949, -772, 1011, 2720, 2376, 424, -671, 112, 1110, 848, 58, -286, -587, -1045, -912, -367, -627, -1417, -919, 1088, 2401, 1403, -899, -2393, -2211, -1194, -547, -398, 55, 1037, 1679, 1395, 744, 316, -124, -708, -758, 75, 926, 829, 109, -133, 396, 763, 2, -1529, -2456, -2138, -1469, -1421, -1628, -1301, -717, -584, -574, 162, 1264, 1396, 387, -328, -13, 232, -254, -202, 1165, 2336, 2100, 1559, 1628, 1296, 130, -515, -135, 115, -125, -139, -71, -462, -721, -318, 58, 60, 339, 776, 501, -74, 189, 856, 641, -111, -54, 635, 552, -468, -1108, -767, -275, -101, 403, 1357, 1653, 837, 13, -79, -255, -983, -980, 653, 2186, 1411, -706, -1395, -653, -758, -1550, -909, 424, 13, -1034, 66, 2092, 2091, 1032, 1311, 1660, -7, -2068, -2128, -1156, -1060, -1321, -802, -216, -550, -1009, -455, 433, 195, -835, -879, 398, 1168, 256, -990, -789, 419, 908, 344, -178, -200, -85, 293, 1022, 1036, -305, -1590, -1442, -666, -351, 6, 734, 869, 252, 73, 529, 544, 18, -110, 194, 203, -148, -431, -404, 160, 1105, 1297, -18, -1659, -1913, -919, -112, -27, -96, 15, 139, 257, 369, 27, -949, -1547, -653, 979, 1521, 866, 639, 1207, 1119, -85, -948, -608, -46, -238, -791, -919, -572, -281, -525, -1308, -2025, -1886, -737, 657, 1307, 953, 268, 97, 601, 1176, 1104, 215, -936, -1521, -1176, -341, 270, 413, 343, 313, 214, -316, -1396, -2411, -2487, -1696, -995, -708, -185, 598, 607, -361, -883, 8, 1274, 1484, 925, 881, 1546, 1953, 1662, 1226, 974, 579, 75, 109, 710, 896, 123, -770, -801, -280, -194, -641, -894, -748, -706, -854, -607, 243, 1057, 1147, 511, -309, -714, -356, 502, 934, 228, -959, -1213, -397, 221, 176, 238, 264, -794, -2301, -2356, -1120, -546, -848, -537, 488, 1020, 963, 1024, 1071, 741, 331, -39, -596, -951, -696, -471, -755, -670, 379, 1460, 1746, 1646, 1464, 925, 349, 356, 563, 348, 100, 190, -4, -699, -949, -368, 73, -224, -641, -715, -891, -1455, -1905, -1653, -640, 747, 1927, 2437, 2255, 1686, 1088, 856, 1119, 1322, 920, 395, 373, 237, -652, -1349, -1071, -1137, -2572, -3604, -2404, -396, 42, -740, -884, -137, 509, 901, 1518, 2129, 2085, 1501, 1081, 904, 311, -820, -1539, -1090, -71, 354, 10, -257, 67, 427, 66, -648, -497, 769, 1781, 1438, 568, 573, 1183, 956, -340, -1357, -1247, -771, -848, -1080, -531, 764, 1950, 2539, 2575, 2032, 943, -64, -259, 175, 343, -72, -422, -207, 154, 74, -362, -735, -796, -332, 665, 1477, 1267, 300, -456, -823, -1357, -1992, -1951, -1036, 31, 676, 1031, 1228, 940, 45, -848, -1122, -897, -546, -78, 478, 756, 719, 961, 1715, 2259, 1850, 738, -160, -247, 228, 463, 66, -497, -889, -1535, -2349, -2181, -956, -430, -1188, -1516, -748, -389, -574, 508, 2598, 3156, 1840, 896, 1013, 863, 253, 124, 212, -360, -1107, -1024, -386, -88, -68, 321, 919, 851, -119, -1195, -1576, -1179, -232, 977, 1790, 1511, 386, -524, -597, -171, 189, 263, -3, -570, -1036, -851, -53, 531, 231, -468, -425, 538, 1250, 919, 424, 932, 2006, 2383, 1909, 1279, 545, -566, -1376, -947, 249, 732, 13, -911, -1061, -549, -38, 225, 457, 679, 589, 267, 270, 476, -75, -1248, -1377, -156, 398, -479, -777, 373, 954, 95, -283, 500, 523, -838, -1778, -1532, -1275, -1421, -1242, -932, -1367, -2138, -1977, -900, -249, -629, -1156, -1018, -552, -179, 489, 1591, 2159, 1417, 93, -494, -85, 518, 594, 99, -600, -1165, -1434, -1417, -1259, -1130, -1113, -1175, -1070, -373, 906, 1800, 1375, 308, 221, 1231, 1634, 421, -1246, -1662, -536, 1057, 1840, 1198, -436, -1813, -1980, -1257, -749, -877, -850, 165, 1752, 2624, 2175, 1081, 258, -216, -749, -1311, -1457, -974, -51, 919, 1413, 1095, 369, 91, 401, 438, -292, -883, -395, 279, -350, -1501, -1005, 696, 726, -1387, -2737, -1824, -423, 202, 1026, 2417, 3086, 2453, 1434, 874, 898, 1177, 935, -114, -756, 152, 1465, 1148, -657, -1891, -1484, -304, 485, 612, 293, -205, -461, -240, -102, -670, -1249, -601, 790, 1161, 353, -44, 341, 188, -809, -1318, -731, 26, 194, -61, -486, -1033, -1519, -1846, -2228, -2670, -2637, -1694, -139, 1275, 2007, 1992, 1435, 532, -378, -548, 463, 1653, 1638, 1067, 1726, 3002, 2520, 555, -302, 50, -505, -1508, -593, 1422, 1444, -395, -996, 462, 1706, 1386, 571, 349, 302, -309, -1087, -895, 424, 1484, 1155, 250, 194, 681, 263, -1090, -1903, -1561, -1038, -1115, -1326, -875, 266, 1293, 1319, 480, 17, 586, 1147, 569, -642, -1385, -1533, -1325, -528, 662, 1231, 770, 89, -139, -139, -87, 316, 916, 869, -55, -808, -406, 594, 829, 87, -467, -121, 390, 293, 142, 680, 1176, 459, -969, -1611, -1406, -1590, -2268, -2070, -420, 1443, 2080, 1390, 214, -733, -1172, -1176, -1229, -1775, -2296, -1617, 352, 2117, 2424, 1585, 545, -249, -705, -959, -1397, -1884, -1472, 113, 1559, 1675, 1006, 667, 547, -117, -1129, -1401, -434, 1059, 2032, 2143, 1743, 1164, 441, -303, -761, -952, -1272, -1693, -1518, -459, 624, 743, 65, -413, -143, 429, 344, -798, -2036, -1891, -367, 910, 1031, 815, 1011, 1165, 918, 717, 754, 681, 559, 749, 1108, 1335, 1519, 1554, 1025, 158, -321, -469, -936, -1559, -1523, -689, 306, 811, 323, -1191, -2634, -2534, -908, 714, 1132, 433, -551, -858, -59, 991, 904, -280, -1009, -433, 534, 760, 309, -26, 159, 511, 348, -409, -918, -552, 49, -1, -329, -59, 406, -106, -1486, -2206, -1305, 419, 1388, 961, 60, -52, 537, 715, 285, 220, 745, 948, 634, 699, 1235, 1133, 71, -818, -882, -918, -1370, -1181, 82, 695, -428, -1280, -60, 1281, 501, -625, 298, 1538, 510, -1291, -1138, 56, -125, -1202, -1090, 95, 455, -542, -1411, -904, 286, 619, 84, 270, 1593, 2233, 1039, -526, -955, -877, -919, -277, 826, 576, -976, -1439, -166, 836, 498, -321, -1001, -1217, -146, 1807, 2554, 1505, 586, 816, 878, -26, -865, -845, -420, -76, 158, 305, 569, 1198, 1658, 964, -703, -1783, -1293, -166, -27, -1141, -2293, -2408, -1578, -622, -291, -742, -1204, -620, 774, 1366, 416, -632, -203, 1040, 1223, 69, -861, -594, 92, 279, 322, 854, 1426, 1188, 303, -263, -38, 616, 1120, 1031, 84, -1306, -1900, -979, 364, 509, -362, -736, -401, -712, -2048, -2908, -1992, 104, 1750, 1962, 1077, 281, 513, 1507, 2080, 1520, 398, -221, -47, 356, 569, 781, 1118, 1093, 367, -368, -230, 322, 0, -1149, -1539, -588, 124, -701, -1815, -1186, 736, 1505, 321, -830, -261, 1094, 1547, 1200, 1176, 1483, 1231, 306, -451, -474, -44, 183, -234, -1254, -2277, -2492, -1639, -420, 207, 206, 475, 1422, 2101, 1426, -66, -662, 299, 1589, 1816, 1186, 895, 1378, 1884, 1618, 629, -512, -1395, -1821, -1605, -728, 431, 1221, 1112, 228, -439, 45, 1235, 1798, 1429, 956, 566, -258, -1060, -768, 260, 532, -358, -1495, -2158, -2147, -1308, -44, 485, -256, -1289, -1408, -775, -424, -594, -446, 535, 1716, 2062, 1159, -513, -1740, -1442, -95, 566, 33, -186, 741, 1311, 121, -1722, -2377, -2006, -1962, -2216, -1642, -441, -134, -931, -1205, -260, 405, -402, -1654, -1836, -1060, -343, 27, 413, 863, 1045, 879, 689, 740, 909, 995, 1089, 1367, 1638, 1403, 502, -417, -479, 44, -321, -1996, -3012, -1567, 1126, 2469, 1813, 260, -1307, -2184, -1706, -534, -31, -16, 398, 556, -203, -574, 108, 59, -1274, -1451, 415, 1621, 618, -565, -311, 288, 178, -173, -479, -1002, -1276, -643, 259, 230, -635, -1082, -535, 134, -64, -763, -619, 847, 2525, 3126, 2661, 1940, 1310, 727, 369, 291, 143, -136, -253, -509, -1426, -2226, -1542, 213, 1121, 565, -147, -73, 292, 339, 217, 72, -392, -1089, -1215, -426, 366, 205, -534, -839, -418, 368, 1021, 930, 63, -502, -177, -67, -827, -1199, -716, -1078, -2655, -2979, -877, 1451, 2069, 1485, 494, -656, -1043, -200, 346, -555, -1296, -97, 1787, 2061, 1127, 1255, 2668, 3103, 1461, -537, -1131, -693, -182, 275, 475, 96, -111, 604, 1216, 582, -275, 18, 699, 516, 99, 527, 1185, 944, 140, -179, -71, -360, -1029, -1187, -468, 596, 1555, 2295, 2333, 1145, -608, -1467, -1196, -1199, -2224, -2925, -1903, -37, 887, 874, 1038, 1164, 264, -1096, -1380, -504, 252, 385, 477, 770, 802, 285, -575, -1479, -2024, -1602, -112, 1317, 1357, 363, 138, 1367, 2403, 1505, -632, -1872, -1580, -1078, -1212, -1161, -124, 1275, 2033, 2038, 1689, 1165, 539, -109, -885, -1790, -2275, -1733, -412, 671, 854, 511, 448, 774, 724, -296, -1706, -2083, -726, 1225, 1802, 626, -499, -98, 839, 440, -1153, -1989, -1087, 445, 1163, 988, 826, 1218, 1858, 2154, 1813, 1012, 288, 145, 511, 824, 732, 389, 68, -69, -25, -166, -825, -1375, -783, 535, 841, -335, -1334, -813, 407, 822, 268, -436, -894, -1133, -831, 264, 1393, 1419, 302, -1047, -1956, -2011, -797, 1045, 1671, 334, -1371, -1857, -1634, -1753, -1733, -620, 1033, 1861, 1751, 1714, 1923, 1362, -293, -1766, -1832, -847, 130, 871, 1665, 2121, 1492, 24, -1098, -1250, -873, -496, -183, 65, 313, 959, 1974, 2178, 570, -1799, -2639, -1255, 557, 814, -328, -1048, -238, 1287, 2022, 1547, 585, -124, -277, 207, 784, 295, -1390, -2564, -1912, -510, -57, -414, -593, -752, -1376, -1722, -788, 1010, 2274, 2166, 1037, -28, -286, -199, -783, -1983, -2588, -1909, -513, 782, 1604, 1787, 1366, 691, -8, -692, -982, -540, 42, -43, -387, -115, 284, -344, -1604, -1826, -601, 536, 231, -978, -1519, -835, -27, -240, -952, -737, 499, 1380, 1251, 954, 1060, 867, -237, -1706, -2589, -2459, -1350, 296, 1526, 1554, 723, 134, 232, 394, 134, -1, 656, 1636, 1831, 1070, 325, 318, 641, 484, -196, -607, -204, 479, 617, 419, 758, 1495, 1419, 252, -617, -113, 808, 446, -1206, -2358, -1663, 232, 1570, 1342, 69, -852, -545, 299, 132, -1255, -2058, -916, 918, 1227, -83, -1085, -695, 83, 4, -523, -166, 1201, 2068, 1244, -471, -1300, -837, -509, -1415, -2548, -2011, 251, 2108, 1938, 525, -444, -686, -1014, -1542, -1487, -520, 673, 1265, 1234, 1219, 1429, 1152, -53, -1109, -590, 993, 1627, 629, -530, -607, -269, -738, -1912, -2578, -1985, -641, 276, 91, -790, -1434, -1266, -397, 536, 704, -178, -1222, -1244, -314, 538, 942, 1204, 1120, 383, -308, -136, 467, 657, 421, 27, -389, -225, 893, 1745, 902, -792, -1242, -196, 716, 539, -224, -916, -1346, -1387, -935, -246, 244, 402, 531, 1087, 2326, 3877, 4511, 2975, -234, -2588, -2063, 365, 1954, 1552, 521, 461, 1332, 2113, 2227, 1677, 617, -519, -1072, -1038, -1138, -1485, -1273, -435, -156, -928, -1573, -1110, -239, -11, -239, -259, -312, -925, -1544, -1175, -87, 606, 736, 887, 867, 206, -370, 97, 973, 971, 246, -105, 99, 102, -519, -1454, -2072, -1871, -906, 91, 440, 246, 99, 277, 555, 661, 609, 579, 526, 83, -895, -1822, -1983, -1528, -1157, -930, -319, 657, 1300, 1249, 787, 171, -553, -1073, -920, -279, 60, -11, 362, 1330, 1706, 1059, 625, 881, 627, -342, -702, -509, -935, -1096, 484, 2080, 1276, -355, -26, 1201, 812, -515, -711, 99, 851, 1575, 2208, 1966, 973, 308, 96, -494, -1335, -1237, 45, 1241, 1408, 1052, 716, -83, -1346, -1578, 140, 2316, 2864, 1673, 85, -1047, -1570, -1313, -394, 296, -120, -1380, -2339, -2208, -978, 921, 2535, 2557, 804, -1030, -1409, -978, -1165, -1723, -1359, -33, 910, 524, -832, -1974, -1939, -856, 304, 991, 1419, 1616, 1292, 773, 655, 555, -256, -1245, -1246, -362, 382, 831, 1566, 2322, 2084, 712, -680, -1161, -933, -605, -310, -18, -16, -373, -488, 142, 1104, 1482, 795, -581, -1557, -1217, 37, 876, 924, 1093, 1688, 1663, 507, -609, -508, 285, 415, -428, -1386, -1698, -1323, -533, 252, 355, -531, -1603, -1695, -807, -36, -93, -595, -738, -133, 820, 1201, 560, -302, -185, 849, 1411, 648, -531, -746, -56, 387, 148, -252, -510, -623, -346, 144, -64, -1011, -1271, -261, 562, 72, -764, -704, -131, 90, 167, 603, 965, 639, 67, 7, 82, -571, -1578, -1791, -1217, -843, -755, -118, 989, 1394, 594, -603, -1338, -1621, -1812, -1895, -1613, -973, -264, 434, 1355, 2316, 2479, 1611, 795, 763, 671, 56, 218, 1736, 2784, 2040, 685, -212, -1131, -1691, -597, 1198, 1248, -239, -895, -366, -307, -1047, -1514, -1512, -1602, -1714, -1450, -834, -106, 367, 148, -484, -523, 291, 1049, 1255, 1389, 1511, 946, -242, -1004, -780, -48, 439, 255, -239, 32, 1058, 947, -987, -2387, -1762, -1153, -1825, -1522, 708, 2052, 1358, 1323, 2773, 2805, 635, -646, 293, 1021, 155, -465, 353, 912, -185, -1450, -1116, -248, -821, -2215, -2335, -1155, -351, -249, 315, 1667, 2831, 2989, 2203, 1137, 546, 546, 424, -362, -1365, -1836, -1743, -1528, -1257, -642, 214, 671, 347, -326, -644, -376, 238, 900, 1420, 1836, 2310, 2623, 2209, 1143, 332, 81, -488, -1768, -2626, -2058, -819, -325, -694, -911, -472, 61, 50, -391, -708, -585, -140, 244, 260, 158, 591, 1525, 1916, 1156, 78, -263, 43, 402, 761, 1266, 1658, 1566, 875, -349, -1714, -2300, -1371, 438, 1397, 664, -650, -1166, -1114, -1389, -1816, -1794, -1390, -522, 1185, 2815, 2799, 1656, 1207, 1295, 565, -406, -377, -258, -1168, -1809, -956, -119, -845, -1926, -1745, -1067, -1258, -1631, -710, 1045, 1869, 1556, 1685, 2910, 3986, 3825, 2802, 1680, 799, 435, 563, 414, -485, -1307, -1057, -98, 485, 545, 760, 1177, 936, -302, -1601, -1889, -1343, -967, -1185, -1521, -1498, -1224, -971, -754, -571, -502, -366, 39, 352, 237, 243, 728, 813, 44, -371, 61, -176, -1574, -2312, -1768, -1580, -1924, -1037, 846, 1589, 1115, 981, 958, 66, -663, -23, 815, 553, 294, 1442, 3105, 3544, 2720, 1915, 1728, 1579, 926, 157, -95, -82, -649, -1857, -2580, -1785, 65, 1324, 986, -262, -1287, -1978, -2525, -2262, -887, 304, 275, 136, 1179, 2318, 1741, 45, -569, 431, 1507, 1608, 1167, 462, -978, -2774, -3477, -2855, -2442, -2875, -2748, -1225, 313, 476, -95, -94, 488, 906, 1130, 1631, 2249, 2341, 1821, 1117, 305, -696, -1365, -1131, -402, -28, -210, -635, -941, -701, 35, 336, -240, -533, 456, 1685, 1674, 842, 504, 645, 325, -618, -1568, -2152, -2285, -1738, -421, 1135, 2080, 2030, 1368, 671, 20, -823, -1660, -1854, -1280, -587, -219, 56, 349, 243, -362, -887, -845, -234, 820, 1917, 2137, 986, -629, -1314, -963, -718, -1197, -1690, -1327, -239, 857, 1553, 1666, 1034, 7, -525, -249, 153, 107, -130, -167, -9, 346, 1017, 1768, 2066, 1575, 364, -1047, -1760, -1283, -235, 427, 530, 307, -270, -988, -1319, -1474, -2018, -2368, -1674, -758, -699, -647, 276, 873, 307, -102, 148, -377, -1483, -870, 1422, 2632, 2020, 1578, 1879, 1467, 290, 19, 930, 1404, 751, 221, 735, 1441, 1327, 793, 534, 194, -632, -1283, -1088, -386, 423, 1476, 2405, 2149, 518, -1210, -1837, -1513, -1105, -982, -900, -685, -508, -424, -108, 647, 1434, 1689, 1454, 1198, 975, 414, -457, -1028, -876, -225, 370, 401, -334, -1398, -1953, -1716, -1154, -630, -150, 43, -343, -1038, -1652, -2174, -2299, -1539, -508, -328, -629, -386, -107, -436, -97, 1592, 2442, 1024, -370, 341, 1536, 1310, 756, 1176, 1421, 412, -630, -499, -228, -1082, -2071, -1539, -93, 320, -308, -130, 1292, 2203, 1411, -228, -1357, -1479, -642, 802, 1902, 1785, 915, 645, 1173, 1156, -65, -1333, -1555, -1153, -750, -178, 501, 760, 801, 1198, 1361, 273, -1422, -1916, -663, 1151, 2378, 2761, 2180, 459, -1707, -2889, -2651, -2037, -1687, -875, 781, 2187, 2339, 1672, 1000, 353, -481, -1291, -1718, -1490, -368, 1395, 2679, 2493, 1388, 846, 1065, 645, -951, -2144, -1609, -522, -759, -1919, -2009, -664, 259, -472, -1816, -2336, -2077, -1586, -705, 470, 1034, 728, 334, 7, -807, -1743, -1944, -1621, -1242, -372, 877, 1224, 487, 84, 414, 489, 279, 493, 601, -6, -124, 1194, 2346, 1677, 480, 897, 2385, 2761, 1775, 1226, 1809, 2080, 1016, -301, -570, -263, -526, -1254, -1557, -1304, -1093, -1143, -1089, -645, 115, 996, 1732, 2008, 1868, 1845, 2137, 2122, 1307, 229, -380, -635, -884, -744, 188, 1119, 757, -827, -2215, -2661, -2724, -2619, -1769, -527, -217, -747, -489, 848, 1755, 1601, 1217, 873, 168, -557, -771, -701, -450, 206, 714, 554, 514, 748, -258, -2177, -2088, 69, 566, -1259, -1668, 195, 968, -20, 46, 1328, 1403, 366, -99, -460, -1359, -1227, 480, 1467, 597, -191, 306, 530, -659, -1862, -1543, -392, 27, -295, -128, 753, 1037, 0, -1120, -954, -170, -162, -458, 320, 1636, 1843, 1263, 1502, 2270, 1920, 516, -525, -1014, -1592, -1811, -842, 873, 2156, 2357, 1496, 190, -552, -457, -363, -705, -689, 303, 1686, 2596, 2691, 1860, 314, -1129, -1833, -2025, -1935, -1122, 403, 1378, 737, -731, -1383, -1036, -1041, -1993, -2759, -2271, -993, -1, 246, -246, -1211, -1893, -1760, -1377, -1422, -1371, -414, 938, 1523, 1268, 1023, 1001, 558, -459, -1200, -996, -316, -76, -517, -1166, -1442, -1056, -315, -123, -936, -1752, -1069, 926, 2222, 1507, -69, -547, 183, 552, -222, -1233, -1474, -1026, -344, 568, 1664, 2323, 2016, 1107, 382, 84, -9, 45, 315, 679, 1174, 2008, 2763, 2497, 1185, 26, -202, -48, -194, -473, -546, -636, -963, -1095, -581, 181, 409, 29, -422, -676, -712, -370, 180, 333, 124, 283, 666, 266, -703, -722, 561, 1739, 1784, 1027, 129, -417, -246, 291, 325, -196, -549, -567, -527, -271, -28, -924, -2926, -3815, -2107, 495, 1473, 871, 514, 939, 1009, 161, -665, -589, -16, 302, 461, 907, 1398, 1272, 392, -723, -1433, -1384, -749, -153, -88, -495, -919, -805, 68, 966, 741, -308, -455, 714, 1484, 1003, 643, 1203, 1476, 730, -86, -404, -706, -825, -39, 1221, 1822, 1606, 1135, 631, 266, 373, 703, 583, 44, -287, -315, -451, -800, -1083, -1006, -372, 528, 792, 4, -1047, -1638, -2099, -2607, -2443, -1456, -609, -263, 340, 1294, 1646, 1144, 614, 473, 436, 524, 993, 1432, 1125, 245, -337, -450, -832, -1699, -2172, -1692, -969, -771, -890, -902, -709, -36, 1241, 2254, 2115, 1309, 745, 366, -61, -170, -41, -240, -214, 1220, 3497, 4634, 3978, 2558, 1168, -67, -871, -1030, -786, -305, 257, 254, -561, -1101, -432, 509, 275, -872, -1571, -1374, -860, -457, -188, -95, -261, -655, -1192, -1736, -2123, -2224, -1773, -459, 1304, 2329, 2109, 1502, 1118, 256, -1474, -2786, -2425, -1148, -522, -486, 148, 1171, 1008, -455, -1414, -1161, -926, -1015, -252, 1095, 1441, 1243, 2271, 3628, 2799, 285, -1009, -476, -91, -671, -1076, -713, -322, -442, -718, -763, -669, -529, -192, 264, 369, -48, -418, -206, 225, 203, -88, 124, 841, 1278, 1243, 1190, 886, -287, -1725, -2186, -1719, -1085, -117, 1239, 1679, 602, -282, 437, 1596, 1600, 849, 399, 105, -520, -1041, -766, 162, 949, 965, 228, -728, -1423, -1740, -1640, -1043, -245, 188, 237, 414, 717, 556, -46, -270, 134, 369, -32, -369, 55, 698, 573, -207, -701, -620, -476, -481, -472, -644, -1146, -1449, -1230, -1117, -1467, -1545, -870, -99, 195, 297, 394, 295, 274, 878, 1791, 2033, 1278, 149, -649, -863, -553, 66, 647, 795, 253, -820, -1813, -2232, -2258, -2284, -2115, -1328, -160, 751, 1284, 1670, 1832, 1654, 1457, 1509, 1602, 1541, 1382, 1105, 761, 730, 1027, 889, -77, -1071, -1298, -1197, -1522, -2009, -1946, -1539, -1617, -2199, -2418, -1946, -1485, -1552, -1728, -1506, -1007, -503, -28, 251, 92, -235, -119, 440, 772, 675, 871, 1827, 2896, 3368, 3486, 3479, 2779, 1306, 233, 199, 291, -53, 75, 1148, 1977, 1566, 566, -10, -251, -714, -1350, -1689, -1623, -1552, -1747, -1832, -1259, -253, 340, 230, -66, -311, -862, -1552, -1385, 37, 1659, 2287, 2084, 1974, 2108, 1852, 1062, 291, -249, -865, -1406, -1213, -263, 678, 1160, 1362, 1365, 1032, 596, 525, 784, 879, 656, 426, 287, -4, -316, -92, 635, 1094, 975, 833, 900, 618, -142, -554, -169, 245, 6, -230, 419, 1441, 1657, 1105, 670, 237, -967, -2455, -2901, -2365, -2108, -2256, -1589, 175, 1579, 1413, 276, -432, -454, -775, -1738, -2043, -654, 1111, 1103, -434, -1217, -456, 198, -419, -1344, -1460, -1232, -1430, -1593, -1011, -219, -140, -410, -31, 782, 926, 225, -527, -1036, -1523, -1575, -532, 1056, 1734, 1132, 461, 664, 1166, 1119, 814, 941, 1279, 1177, 627, 41, -407, -618, -410, 96, 542, 851, 1101, 992, 128, -1224, -2265, -2610, -2501, -2015, -842, 812, 1965, 2046, 1592, 1148, 377, -946, -2002, -1964, -1310, -1048, -1108, -693, 0, -115, -1051, -1363, -260, 1240, 2007, 2368, 3042, 3590, 3178, 2182, 1716, 1838, 1508, 326, -927, -1665, -2101, -2254, -1634, -381, 422, 180, -388, -350, 149, 323, -34, -420, -541, -651, -878, -814, -34, 1259, 2279, 2267, 1154, -318, -1297, -1632, -1800, -2097, -2299, -2210, -2077, -2018, -1537, -333, 833, 1097, 842, 903, 957, 167, -1098, -1746, -1750, -1977, -2556, -2769, -2413, -1996, -1567, -562, 881, 1652, 1250, 594, 513, 499, -129, -802, -577, 318, 927, 1042, 1198, 1403, 902, -595, -2220, -2915, -2599, -1881, -1002, 225, 1603, 2473, 2604, 2472, 2401, 2150, 1642, 1397, 1770, 2368, 2638, 2568, 2482, 2521, 2501, 2077, 1085, -86, -724, -584, -163, -10, -99, -96, 58, 71, -317, -1048, -1841, -2521, -3038, -3120, -2342, -841, 560, 1385, 1976, 2494, 2323, 1225, 149, 70, 715, 1237, 1484, 1785, 1994, 1603, 609, -524, -1674, -3002, -4035, -3775, -2086, -211, 559, 197, -474, -890, -1026, -960, -656, -64, 865, 2146, 3436, 3950, 3136, 1413, -225, -1262, -1879, -2172, -1775, -504, 993, 1654, 1092, 0, -729, -1055, -1565, -2320, -2525, -1591, -39, 1117, 1603, 1913, 2219, 1974, 919, -191, -417, 235, 1014, 1380, 1299, 943, 440, -223, -1144, -2169, -2862, -3086, -3110, -2886, -1977, -541, 464, 465, -53, -281, 69, 694, 1019, 730, 277, 535, 1623, 2587, 2681, 2487, 2992, 3906, 3968, 2938, 1923, 1453, 742, -586, -1710, -2074, -2130, -2177, -1956, -1581, -1501, -1628, -1654, -1768, -2032, -1690, -187, 1696, 2692, 2587, 2164, 1886, 1342, 153, -1016, -994, 155, 864, 301, -367, -165, -102, -1090, -2100, -2276, -2407, -2663, -1924, -608, -582, -1565, -1496, -397, 60, -77, 102, -167, -1575, -2508, -1584, -147, 61, -401, -159, 669, 1129, 1074, 910, 619, 181, 221, 1008, 1551, 1147, 892, 1837, 2733, 1840, -24, -673, 47, 408, -150, -379, 334, 873, 326, -538, -702, -577, -1066, -1871, -2010, -1393, -724, -300, 134, 629, 836, 535, -8, -285, -101, 224, 305, 232, 434, 1027, 1531, 1444, 946, 610, 539, 388, 137, 20, -142, -451, -116, 1518, 3429, 3888, 2754, 1399, 616, -24, -804, -1184, -778, 35, 811, 1551, 2074, 1722, 374, -942, -1245, -882, -751, -734, -6, 1256, 1821, 1254, 576, 476, 136, -1250, -2956, -3772, -3705, -3606, -3777, -3793, -3274, -2365, -1605, -1437, -1733, -2049, -2331, -2831, -3323, -3115, -2056, -871, -185, 233, 840, 1358, 1106, 123, -715, -725, -9, 1003, 2030, 2825, 3141, 2990, 2612, 2061, 1204, 224, -293, -120, 200, 146, -29, 140, 492, 571, 376, 183, 68, 69, 301, 620, 710, 588, 507, 424, 195, 122, 699, 1837, 2816, 3037, 2575, 1967, 1652, 1649, 1605, 1173, 440, -49, 50, 361, 253, -259, -626, -662, -731, -1055, -1469, -2018, -3072, -4449, -5000, -3829, -1677, -223, -96, -398, -143, 667, 1379, 1461, 1045, 833, 1041, 847, -185, -1051, -1029, -1035, -1682, -1886, -1173, -1010, -1997, -2255, -579, 1222, 1197, 352, 757, 2105, 2538, 1917, 1687, 1969, 1624, 997, 1471, 2370, 1658, -347, -1318, -837, -688, -1445, -1774, -1095, -485, -714, -1137, -870, -125, 86, -585, -1270, -1223, -1051, -1482, -1723, -780, 475, 699, 467, 818, 844, -546, -2076, -1950, -554, 747, 1482, 1474, 766, 502, 1456, 2385, 2244, 2173, 2899, 3033, 2027, 1386, 1515, 1189, 643, 1160, 2087, 2160, 2231, 3070, 3044, 1203, -456, -356, 356, 551, 761, 1272, 1626, 2033, 2746, 2823, 1613, 132, -522, -595, -653, -792, -1127, -1597, -1632, -1235, -1379, -2231, -2529, -1715, -937, -981, -996, -139, 993, 1248, 311, -995, -1474, -951, -740, -1739, -2710, -2034, -318, 695, 794, 840, 790, 181, -504, -667, -699, -1001, -1030, -353, 391, 403, -143, -438, -96, 413, 360, -317, -876, -721, -109, 407, 700, 832, 658, 262, 233, 878, 1592, 1597, 1033, 769, 1291, 2147, 2562, 2368, 2163, 2472, 2988, 2986, 2337, 1630, 1320, 1225, 909, 129, -1120, -2637, -4029, -4894, -4984, -4263, -3102, -2267, -2257, -2671, -2667, -2019, -1312, -1175, -1567, -1734, -901, 724, 1882, 1645, 525, -428, -1113, -2070, -3154, -3557, -3075, -2430, -2180, -2053, -1601, -1009, -754, -837, -830, -539, -153, 231, 760, 1477, 2153, 2522, 2547, 2352, 1903, 944, -463, -1513, -1386, -357, 470, 568, 402, 489, 770, 1037, 1279, 1389, 1128, 702, 776, 1428, 1768, 1275, 724, 793, 746, -251, -1533, -2040, -1967, -1985, -1893, -1282, -526, -95, 227, 666, 804, 310, -305, -370, -17, 158, 192, 701, 1742, 2534, 2562, 2233, 2043, 1708, 757, -439, -920, -373, 471, 809, 634, 414, 301, 70, -373, -831, -1092, -1165, -1114, -851, -316, 211, 352, 217, 249, 383, 85, -549, -559, 478, 1567, 1501, 469, -349, -465, -415, -563, -601, -425, -476, -797, -765, -178, 255, 82, -73, 425, 1005, 707, -227, -774, -816, -966, -1071, -619, -255, -939, -1972, -1908, -914, -314, -425, -543, -345, -7, 336, 467, 159, -260, -253, -13, -198, -764, -965, -523, -70, -183, -554, -529, -114, 97, -56, 6, 759, 1830, 2451, 2344, 1905, 1602, 1491, 1350, 1057, 600, -74, -863, -1302, -1091, -716, -893, -1475, -1665, -1245, -774, -605, -493, -231, 17, 111, 142, 168, 83, -168, -466, -671, -754, -719, -543, -292, -191, -444, -934, -1303, -1344, -1208, -1173, -1368, -1728, -2020, -1924, -1370, -791, -688, -940, -978, -678, -550, -806, -837, -119, 812, 1101, 951, 1248, 1969, 2180, 1630, 1086, 953, 786, 324, -14, 94, 401, 584, 655, 766, 957, 1188, 1422, 1595, 1627, 1543, 1489, 1541, 1539, 1313, 973, 812, 849, 757, 349, -68, -62, 360, 776, 889, 815, 826, 996, 1137, 1092, 981, 1008, 1043, 808, 422, 239, 104, -548, -1678, -2454, -2346, -1821, -1551, -1523, -1361, -1122, -1149, -1353, -1339, -1112, -1023, -1048, -805, -281, 133, 340, 610, 952, 997, 629, 224, 86, 63, -50, -90, 158, 515, 669, 675, 784, 898, 647, -14, -701, -1143, -1465, -1812, -2064, -2130, -2163, -2219, -2041, -1491, -896, -640, -654, -632, -564, -705, -1061, -1256, -1005, -434, 127, 438, 384, 20, -380, -593, -708, -876, -923, -541, 294, 1301, 2101, 2357, 2041, 1525, 1111, 672, 100, -267, -121, 326, 716, 922, 863, 528, 264, 450, 877, 1062, 988, 948, 966, 905, 834, 859, 902, 893, 848, 688, 322, -85, -277, -221, -45, 155, 272, 137, -285, -849, -1414, -1942, -2325, -2358, -1979, -1421, -974, -717, -632, -825, -1346, -1915, -2113, -1824, -1231, -511, 229, 864, 1295, 1512, 1481, 1147, 639, 255, 140, 158, 118, 33, 102, 475, 1002, 1345, 1383, 1342, 1323, 1069, 471, -75, -165, 136, 599, 1241, 2046, 2661, 2736, 2413, 2089, 1844, 1498, 1132, 1045, 1211, 1310, 1283, 1287, 1172, 707, 133, -180, -372, -698, -905, -696, -399, -525, -1007, -1404, -1539, -1586, -1674, -1708, -1472, -830, 134, 1135, 1876, 2212, 2179, 1924, 1525, 887, -52, -1007, -1518, -1496, -1228, -868, -447, -305, -823, -1763, -2511, -2810, -2748, -2396, -1956, -1733, -1561, -926, 71, 628, 389, -98, -276, -225, -255, -376, -428, -385, -329, -328, -431, -647, -827, -790, -687, -886, -1362, -1645, -1594, -1646, -2031, -2311, -2032, -1348, -671, -107, 417, 788, 852, 762, 833, 1118, 1421, 1660, 1848, 1859, 1622, 1437, 1656, 2098, 2207, 1774, 1139, 675, 391, 171, 129, 467, 1102, 1640, 1785, 1602, 1336, 1110, 883, 622, 446, 556, 983, 1457, 1611, 1346, 931, 675, 565, 296, -314, -1010, -1360, -1330, -1313, -1529, -1774, -1884, -2021, -2290, -2514, -2566, -2516, -2370, -2085, -1768, -1510, -1207, -884, -786, -901, -902, -763, -797, -936, -654, 176, 973, 1171, 814, 306, -95, -383, -617, -784, -812, -662, -408, -230, -307, -675, -1164, -1532, -1625, -1422, -968, -339, 347, 952, 1365, 1614, 1871, 2176, 2240, 1819, 1237, 1151, 1736, 2499, 2928, 2975, 2784, 2342, 1589, 610, -443, -1490, -2402, -2868, -2608, -1775, -971, -684, -827, -988, -971, -829, -505, 124, 863, 1267, 1295, 1478, 2170, 2916, 3004, 2474, 2066, 2174, 2405, 2275, 1784, 1182, 623, 180, -158, -454, -607, -420, -50, 51, -211, -499, -652, -834, -1016, -936, -606, -355, -363, -456, -381, -62, 351, 592, 529, 320, 204, 181, 42, -286, -606, -689, -530, -264, 2, 154, 31, -335, -680, -865, -1024, -1152, -953, -339, 319, 650, 703, 707, 705, 660, 683, 877, 1068, 1001, 730, 446, 138, -187, -303, -271, -566, -1149, -1269, -810, -664, -1138, -1315, -681, -47, -107, -315, 70, 765, 1014, 748, 587, 881, 1253, 1177, 677, 244, 153, 171, -69, -532, -764, -512, -163, -256, -767, -1298, -1733, -2121, -2211, -1815, -1319, -1165, -1162, -886, -438, -219, -253, -230, -34, 162, 237, 218, 151, 113, 338, 1009, 1886, 2388, 2159, 1385, 482, -297, -849, -1087, -1084, -1133, -1333, -1328, -886, -446, -525, -865, -891, -608, -345, -72, 302, 476, 230, -126, -241, -131, 152, 673, 1290, 1669, 1770, 1862, 1967, 1753, 1221, 948, 1247, 1591, 1454, 1115, 949, 663, 39, -354, -77, 356, 349, 149, 306, 831, 1335, 1513, 1336, 1074, 1032, 1084, 890, 546, 414, 384, 58, -477, -812, -937, -1097, -1222, -1115, -922, -870, -891, -833, -706, -495, -79, 475, 827, 748, 420, 271, 527, 933, 1049, 892, 943, 1330, 1533, 1267, 989, 1113, 1404, 1579, 1715, 1767, 1526, 1161, 998, 896, 623, 370, 225, -49, -278, -43, 290, 108, -123, 313, 846, 578, -48, -196, -109, -246, -259, 59, 172, -109, -236, -29, 55, -149, -402, -644, -946, -1121, -1024, -868, -877, -958, -968, -935, -941, -957, -888, -678, -415, -261, -193, 25, 448, 712, 486, 24, -86, 227, 387, 157, 154, 757, 1269, 1059, 702, 817, 820, 157, -454, -319, -68, -373, -674, -306, 261, 323, 62, 15, 162, 231, 341, 692, 976, 770, 311, 177, 325, 226, -196, -528, -671, -931, -1331, -1531, -1439, -1391, -1629, -1974, -2161, -2232, -2393, -2615, -2618, -2214, -1515, -873, -559, -409, 20, 722, 1082, 796, 419, 466, 610, 369, 36, 199, 709, 905, 647, 422, 438, 326, -98, -445, -441, -443, -789, -1105, -842, -238, -28, -307, -435, -154, 75, 32, 85, 342, 399, 193, 105, 117, -156, -595, -668, -356, -169, -376, -821, -1284, -1625, -1794, -1910, -2106, -2261, -2144, -1783, -1451, -1280, -1139, -886, -608, -489, -557, -657, -601, -261, 310, 810, 932, 779, 701, 748, 649, 327, -11, -264, -464, -557, -505, -426, -358, -125, 293, 597, 571, 392, 361, 533, 748, 849, 825, 812, 946, 1166, 1263, 1113, 808, 535, 396, 323, 156, -145, -392, -394, -279, -372, -761, -1197, -1460, -1605, -1767, -1918, -1959, -1920, -1894, -1853, -1729, -1576, -1442, -1182, -676, -87, 356, 678, 991, 1222, 1261, 1229, 1325, 1504, 1547, 1404, 1234, 1119, 978, 788, 595, 299, -218, -744, -902, -701, -505, -468, -409, -211, 36, 288, 583, 850, 932, 809, 651, 644, 846, 1191, 1544, 1760, 1755, 1554, 1307, 1162, 1026, 697, 310, 261, 504, 486, 64, -306, -527, -1029, -1729, -1927, -1536, -1242, -1266, -1098, -576, -180, -149, -132, 166, 616, 1023, 1415, 1819, 2082, 2078, 1919, 1770, 1574, 1176, 634, 172, -147, -463, -830, -1113, -1199, -1166, -1199, -1354, -1512, -1563, -1519, -1363, -999, -508, -182, -57, 227, 807, 1270, 1307, 1197, 1232, 1228, 992, 754, 745, 755, 476, -6, -367, -484, -500, -564, -731, -1019, -1394, -1674, -1654, -1367, -1043, -775, -416, 86, 490, 595, 592, 786, 1117, 1284, 1247, 1239, 1296, 1161, 731, 286, 133, 205, 198, -24, -322, -546, -723, -946, -1188, -1340, -1342, -1210, -975, -636, -258, -40, -128, -303, -150, 369, 830, 955, 923, 931, 910, 841, 904, 1087, 1060, 713, 454, 596, 786, 487, -153, -531, -531, -586, -823, -857, -549, -294, -373, -542, -469, -214, -55, -71, -109, -56, 53, 206, 492, 942, 1408, 1727, 1899, 2017, 2093, 2085, 2035, 2015, 1938, 1594, 997, 502, 383, 420, 164, -417, -881, -909, -696, -571, -540, -434, -281, -217, -126, 204, 610, 639, 204, -195, -166, 40, -27, -303, -413, -417, -731, -1336, -1733, -1750, -1708, -1722, -1501, -948, -387, -71, 55, 105, 97, 102, 228, 454, 617, 587, 438, 412, 610, 791, 693, 478, 487, 648, 594, 339, 284, 589, 1017, 1329, 1451, 1367, 1180, 1010, 751, 322, 3, 12, 29, -204, -379, -299, -312, -511, -473, -223, -296, -645, -703, -511, -512, -573, -389, -274, -512, -646, -314, 63, 72, -83, -164, -273, -432, -464, -353, -238, -138, -9, 105, 211, 430, 784, 1110, 1224, 1084, 811, 609, 571, 545, 341, 28, -157, -190, -302, -564, -709, -541, -326, -387, -566, -526, -393, -546, -888, -1021, -988, -1166, -1503, -1547, -1223, -974, -1070, -1250, -1154, -807, -490, -311, -117, 140, 220, -28, -316, -310, -181, -302, -605, -726, -643, -615, -666, -642, -645, -884, -1236, -1368, -1240, -1102, -1029, -804, -324, 152, 355, 373, 467, 696, 881, 839, 548, 211, 100, 190, 172, -16, -43, 220, 407, 249, -10, -97, -160, -418, -702, -759, -747, -963, -1213, -1072, -670, -560, -792, -840, -516, -216, -198, -279, -288, -264, -248, -254, -318, -362, -230, 52, 305, 445, 449, 269, 8, -72, 15, -31, -268, -352, -100, 250, 445, 499, 528, 574, 615, 573, 400, 236, 296, 554, 745, 716, 565, 416, 244, -3, -288, -524, -662, -696, -633, -495, -352, -261, -191, -60, 127, 241, 209, 157, 270, 525, 672, 559, 379, 407, 554, 485, 148, -140, -198, -171, -171, -117, -16, -16, -84, -2, 235, 341, 167, -42, -50, 9, -99, -297, -343, -260, -239, -278, -248, -150, -39, 116, 306, 433, 495, 588, 668, 602, 438, 359, 394, 387, 207, -125, -505, -815, -995, -1073, -1123, -1177, -1213, -1171, -969, -624, -282, -47, 163, 424, 607, 606, 559, 612, 677, 662, 671, 782, 878, 867, 820, 764, 620, 406, 280, 288, 283, 186, 123, 186, 217, 64, -168, -307, -397, -531, -561, -325, -23, -19, -297, -459, -299, -71, -23, -5, 231, 610, 879, 993, 1078, 1150, 1125, 985, 763, 444, 48, -260, -344, -305, -377, -582, -711, -647, -487, -354, -314, -403, -526, -433, -57, 329, 494, 539, 639, 753, 789, 822, 922, 965, 807, 542, 356, 209, -62, -385, -545, -550, -551, -493, -274, -84, -170, -437, -634, -724, -751, -677, -542, -497, -546, -541, -470, -448, -482, -488, -461, -426, -350, -219, -138, -172, -209, -93, 147, 369, 555, 787, 1002, 1021, 864, 768, 824, 857, 744, 618, 646, 782, 877, 920, 1013, 1172, 1297, 1317, 1232, 1048, 791, 576, 517, 552, 492, 248, -66, -282, -367, -432, -580, -779, -920, -974, -994, -990, -931, -859, -852, -879, -835, -708, -572, -436, -252, -54, 54, 58, 55, 139, 309, 513, 714, 899, 1036, 1080, 1019, 910, 822, 756, 676, 581, 486, 387, 309, 316, 390, 426, 417, 488, 694, 942, 1159, 1341, 1410, 1264, 974, 733, 596, 485, 402, 448, 611, 720, 656, 488, 315, 130, -71, -201, -213, -235, -379, -567, -665, -721, -882, -1093, -1158, -1096, -1128, -1253, -1196, -894, -619, -501, -328, 15, 362, 584, 756, 883, 854, 672, 494, 375, 220, 24, -52, 61, 208, 223, 146, 68, -52, -253, -427, -493, -509, -514, -416, -159, 152, 393, 557, 664, 669, 559, 433, 405, 448, 436, 331, 227, 191, 165, 74, -32, -84, -109, -157, -168, -95, -55, -165, -329, -427, -537, -767, -988, -994, -812, -635, -532, -426, -300, -214, -144, 8, 225, 353, 373, 449, 655, 831, 840, 782, 805, 864, 807, 609, 398, 251, 115, -60, -210, -242, -187, -145, -110, 15, 177, 185, -9, -256, -456, -621, -700, -612, -443, -326, -214, -32, 70, -75, -342, -449, -369, -309, -338, -293, -83, 147, 249, 264, 293, 325, 349, 440, 606, 694, 598, 439, 397, 440, 420, 349, 379, 521, 617, 609, 592, 564, 398, 71, -259, -480, -610, -682, -656, -519, -350, -231, -145, -15, 197, 443, 638, 712, 674, 620, 614, 603, 523, 439, 448, 480, 385, 165, -64, -275, -530, -826, -1079, -1242, -1327, -1340, -1262, -1127, -1013, -965, -922, -767, -474, -152, 76, 190, 240, 272, 333, 461, 580, 557, 434, 418, 565, 661, 528, 278, 105, -7, -199, -453, -617, -684, -821, -1102, -1376, -1503, -1492, -1412, -1322, -1284, -1261, -1120, -863, -667, -563, -369, -22, 309, 521, 646, 687, 650, 637, 645, 518, 301, 268, 441, 507, 337, 156, 97, 19, -143, -235, -156, -10, 68, 96, 163, 291, 397, 395, 303, 218, 178, 115, -13, -125, -107, 17, 79, -17, -164, -177, -25, 146, 200, 125, 6, -79, -113, -108, -56, 49, 134, 73, -110, -236, -229, -213, -297, -442, -599, -774, -935, -1017, -1052, -1120, -1187, -1162, -1064, -968, -832, -554, -234, -124, -251, -326, -180, -10, 0, -9, 127, 302, 371, 394, 435, 386, 171, -68, -163, -121, -77, -121, -260, -464, -674, -809, -820, -772, -791, -912, -1020, -1013, -941, -912, -919, -853, -679, -462, -251, -60, 77, 128, 134, 165, 243, 350, 488, 637, 725, 699, 580, 430, 266, 56, -200, -447, -609, -655, -621, -597, -650, -710, -643, -473, -375, -394, -368, -226, -122, -150, -164, -26, 143, 178, 144, 244, 463, 571, 448, 263, 223, 279, 246, 113, 53, 123, 176, 107, -10, -120, -259, -408, -447, -371, -305, -285, -207, -54, 14, -91, -233, -231, -107, -26, -54, -103, -99, -93, -183, -400, -658, -791, -704, -496, -367, -385, -434, -406, -326, -269, -234, -193, -162, -142, -76, 51, 140, 128, 124, 226, 320, 269, 152, 128, 181, 210, 225, 295, 392, 449, 488, 572, 686, 749, 744, 730, 740, 719, 611, 471, 411, 461, 546, 575, 532, 460, 389, 323, 279, 285, 326, 318, 212, 75, 19, 41, 9, -144, -300, -318, -246, -205, -179, -118, -116, -241, -340, -248, -84, -57, -131, -109, 38, 160, 192, 211, 239, 190, 60, -26, -26, -53, -164, -236, -193, -143, -194, -291, -339, -371, -466, -593, -630, -540, -436, -439, -505, -474, -311, -152, -76, -10, 98, 172, 177, 195, 255, 271, 214, 152, 120, 125, 205, 324, 350, 250, 147, 113, 83, 54, 102, 198, 246, 253, 274, 273, 218, 182, 202, 190, 83, -53, -134, -139, -99, -70, -72, -16, 178, 405, 515, 581, 750, 951, 1008, 936, 847, 711, 495, 301, 187, 64, -89, -154, -113, -113, -213, -281, -216, -92, -19, 6, 59, 158, 263, 349, 408, 419, 372, 325, 357, 458, 505, 440, 355, 347, 361, 297, 176, 82, 17, -56, -114, -120, -119, -168, -261, -357, -416, -418, -417, -506, -649, -674, -525, -366, -348, -396, -340, -172, -41, -43, -135, -223, -270, -299, -319, -308, -267, -231, -234, -273, -323, -366, -385, -378, -384, -426, -453, -391, -279, -242, -329, -458, -536, -559, -555, -504, -377, -206, -49, 85, 250, 459, 643, 724, 733, 766, 875, 1025, 1183, 1348, 1504, 1607, 1634, 1592, 1480, 1279, 1021, 793, 647, 524, 344, 121, -54, -153, -245, -404, -611, -781, -863, -885, -886, -862, -785, -663, -549, -464, -383, -297, -245, -213, -140, -15, 90, 147, 215, 318, 379, 347, 282, 275, 310, 323, 313, 329, 368, 379, 370, 364, 319, 201, 83, 43, 44, 39, 76, 197, 329, 398, 429, 470, 505, 498, 471, 462, 448, 393, 318, 263, 214, 114, -29, -163, -272, -408, -597, -795, -925, -934, -872, -865, -971, -1070, -1002, -782, -575, -481, -446, -394, -322, -241, -109, 90, 286, 430, 565, 716, 796, 767, 730, 757, 779, 724, 642, 580, 492, 354, 223, 143, 79, -1, -69, -70, -6, 65, 98, 99, 93, 88, 72, 44, 24, 38, 93, 169, 214, 190, 136, 132, 177, 186, 139, 121, 167, 182, 104, 0, -55, -91, -147, -227, -315, -389, -398, -331, -255, -239, -269, -283, -264, -227, -188, -152, -90, 20, 138, 191, 194, 234, 327, 385, 352, 279, 232, 218, 211, 194, 171, 156, 147, 113, 50, 33, 116, 226, 253, 201, 168, 205, 270, 309, 308, 301, 341, 442, 554, 640, 730, 843, 940, 985, 1026, 1108, 1183, 1173, 1084, 990, 934, 881, 789, 666, 546, 432, 299, 159, 55, 3, -39, -120, -222, -284, -298, -333, -439, -546, -555, -472, -380, -316, -267, -252, -276, -271, -182, -70, -27, -34, -8, 65, 115, 104, 72, 63, 47, -10, -107, -212, -340, -508, -692, -831, -896, -905, -896, -888, -874, -832, -762, -692, -648, -631, -623, -594, -526, -433, -343, -255, -144, -21, 64, 92, 95, 97, 82, 19, -92, -232, -385, -534, -676, -821, -978, -1135, -1265, -1354, -1409, -1430, -1418, -1403, -1416, -1432, -1392, -1295, -1195, -1103, -983, -835, -694, -557, -395, -218, -50, 110, 252, 326, 322, 300, 316, 341, 321, 269, 251, 287, 333, 349, 336, 288, 185, 31, -113, -199, -240, -268, -262, -201, -112, -59, -51, -44, -9, 36, 82, 143, 224, 291, 326, 352, 384, 403, 411, 439, 483, 476, 396, 330, 330, 321, 231, 101, 0, -76, -147, -204, -247, -293, -319, -294, -247, -226, -224, -196, -138, -75, -27, 10, 61, 146, 273, 412, 524, 596, 643, 680, 699, 676, 599, 492, 396, 346, 345, 367, 376, 349, 275, 158, 30, -51, -67, -51, -44, -44, -33, -15, 3, 33, 81, 143, 229, 345, 466, 550, 593, 631, 679, 691, 627, 508, 384, 274, 161, 45, -45, -103, -160, -240, -330, -406, -466, -530, -598, -655, -701, -751, -812, -867, -899, -901, -879, -844, -810, -777, -738, -690, -642, -599, -555, -496, -420, -337, -255, -186, -145, -136, -137, -132, -134, -155, -179, -200, -238, -302, -356, -377, -375, -371, -365, -346, -310, -264, -230, -232, -261, -287, -304, -315, -302, -244, -157, -90, -57, -33, 0, 31, 38, 0, -71, -126, -121, -73, -49, -83, -139, -173, -182, -196, -238, -294, -339, -363, -368, -367, -367, -358, -324, -269, -218, -189, -165, -125, -65, 22, 137, 258, 356, 430, 495, 565, 618, 628, 599, 555, 522, 510, 503, 467, 387, 281, 190, 112, 18, -86, -167, -209, -230, -248, -269, -297, -332, -354, -360, -371, -399, -418, -397, -343, -277, -211, -140, -63, 22, 109, 194, 273, 337, 387, 437, 498, 556, 589, 587, 563, 532, 490, 435, 382, 355, 359, 379, 412, 455, 491, 488, 434, 361, 314, 307, 321, 325, 315, 305, 316, 350, 388, 403, 387, 362, 354, 371, 392, 408, 434, 480, 517, 510, 458, 405, 377, 373, 376, 374, 345, 291, 247, 243, 254, 234, 178, 127, 108, 115, 127, 128, 130, 163, 225, 276, 291, 291, 319, 370, 402, 398, 384, 385, 382, 341, 269, 195, 141, 106, 76, 43, -2, -43, -56, -39, -10, 6, -2, -42, -92, -120, -120, -110, -95, -74, -54, -33, 5, 58, 69, 14, -73, -141, -183, -216, -249, -284, -316, -329, -331, -348, -372, -362, -311, -275, -276, -281, -259, -221, -188, -163, -142, -111, -53, 28, 117, 203, 284, 345, 365, 362, 367, 379, 370, 328, 271, 222, 191, 174, 145, 85, -11, -122, -223, -308, -379, -422, -436, -453, -493, -531, -526, -492, -463, -428, -367, -288, -219, -163, -125, -122, -133, -109, -39, 35, 74, 87, 93, 89, 63, 9, -63, -149, -234, -302, -349, -395, -463, -546, -603, -601, -545, -477, -432, -410, -379, -321, -246, -166, -84, 4, 88, 159, 223, 276, 296, 277, 234, 180, 122, 69, 28, -4, -42, -95, -166, -253, -344, -419, -467, -488, -490, -468, -420, -363, -316, -272, -223, -171, -111, -18, 98, 185, 234, 306, 426, 523, 546, 533, 535, 539, 518, 483, 450, 408, 341, 268, 210, 159, 91, 16, -36, -67, -112, -188, -275, -349, -403, -428, -406, -332, -240, -154, -66, 24, 90, 118, 136, 169, 206, 229, 255, 297, 333, 342, 328, 311, 293, 264, 230, 201, 166, 112, 40, -28, -80, -124, -165, -199, -222, -240, -270, -322, -383, -406, -361, -275, -201, -152, -103, -46, 6, 45, 74, 90, 78, 42, 17, 25, 42, 30, -14, -69, -120, -172, -221, -257, -276, -274, -255, -232, -226, -245, -277, -304, -308, -285, -245, -194, -134, -62, 8, 56, 75, 83, 92, 89, 58, 21, 6, -4, -53, -139, -221, -279, -324, -365, -399, -428, -453, -462, -455, -450, -470, -497, -497, -464, -418, -373, -323, -271, -237, -225, -206, -158, -94, -45, -19, -3, 8, 12, 4, -3, -2, 14, 40, 58, 50, 23, -4, -27, -61, -105, -132, -122, -96, -86, -96, -106, -97, -75, -51, -36, -36, -50, -61, -41, 13, 73, 112, 121, 115, 104, 98, 111, 142, 179, 197, 183, 151, 123, 113, 112, 110, 110, 116, 127, 133, 135, 130, 117, 105, 99, 104, 118, 144, 179, 199, 188, 163, 158, 179, 195, 188, 174, 171, 168, 146, 118, 112, 129, 145, 142, 116, 79, 54, 45, 29, -14, -68, -95, -82, -54, -41, -30, -5, 27, 52, 67, 77, 84, 93, 117, 138, 128, 102, 105, 139, 169, 174, 165, 157, 145, 132, 117, 96, 62, 24, 0, -6, -14, -25, -39, -53, -74, -79, -53, -21, -21, -49, -66, -63, -55, -44, -23, -4, 3, 14, 38, 59, 60, 50, 52, 72, 101, 132, 158, 165, 153, 148, 179, 226, 252, 256, 259, 264, 266, 274, 295, 310, 306, 293, 282, 269, 246, 218, 191, 161, 128, 106, 96, 79, 38, -5, -27, -39, -66, -100, -123, -140, -160, -172, -164, -154, -160, -172, -170, -157, -150, -152, -146, -135, -137, -148, -143, -108, -59, -14, 17, 29, 23, 17, 27, 48, 65, 73, 83, 94, 105, 114, 124, 137, 145, 147, 147, 148, 148, 148, 152, 159, 170, 178, 178, 174, 165, 158, 155, 157, 159, 153, 143, 137, 131, 120, 111, 114, 125, 129, 113, 92, 84, 93, 108, 117, 113, 95, 76, 66, 62, 47, 23, 7, 0, -15, -44, -65, -62, -46, -43, -62, -85, -88, -62, -26, -4, -7, -15, -4, 15, 18, 6, 7, 25, 36, 27, 20, 25, 35, 40, 41, 35, 16, 2, 10, 36, 51, 46, 30, 27, 44, 67, 74, 63, 50, 52, 64, 70, 67, 68, 78, 86, 82, 71, 64, 52, 35, 19, 13, 6, -6, -19, -24, -23, -21, -20, -17, -14, -6, 3, 13, 16, 14, 15, 21, 24, 20, 17, 23, 31, 32, 28, 25, 26, 25, 23, 19, 14, 8, 7, 14, 18, 14, 5, 4, 6, 4, 4, 14, 25, 27, 26, 30, 36, 38, 39, 41, 42, 43, 44, 42, 35, 26, 20, 15, 9, 10, 14, 13, 9, 6, 2, -5, -11, -15, -17, -20, -23, -22, -18, -17, -17, -17, -16, -17, -19, -15, -8, -6, -9, -11, -10, -7, -3, 1, 2, -2, -9, -15, -17, -18, -19, -19, -19, -20, -20, -17, -13, -11, -13, -11, -8, -5, -2, 0, 0, 0, 2, 6, 8, 7, 5, 5, 2, 0, -1, 0, 0, -1, 0, 3, 4, 2, 0, 0, 0, 0, 0, 0, -1, -2, -2, 0, 0, 0, -1, -1, 0, 0, -1, -3, -2, 0, 1, 0, -2, -3, -3, -3, -1, 0, 0, -1, -3, -5, -6, -7, -7, -5, -4, -4, -4, -3, -3, -2, -1, 0, 0, 0, 0, -1, 0, 0, 1, 0, 0, 3, 4, 3, 2, 3, 5, 5, 4, 2, 2, 2, 2, 2, 1, 1, 2, 1, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -2, 0, 0, -1, -3, -3, -3, -3, -3, -2, -1, -1, -3, -3, -1, -1, -2, -2, -1, -1, -2, -2, -2, -2, -2, -2, -1, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, -2, -1, 1, 2, 0, -1, 0, 1, 2, 0, -2, -3 };
+// IMA ADPCM blocks, see audio_adpcm.h
+static const uint8_t __in_flash("audio_five_sample_data") audio_five_sample_data[] = { 0, 0, 0, 0, 183, 255, 127, 5, 186, 48, 162, 157, 52, 200, 25, 145, 139, 17, 168, 157, 52, 169, 16, 99, 163, 59, 149, 157, 34, 2, 205, 40, 2, 152, 136, 136, 252, 11, 37, 129, 16, 200, 138, 1, 17, 18, 49, 208, 157, 160, 57, 146, 156, 67, 51, 194, 207, 137, 32, 16, 67, 161, 137, 251, 56, 161, 91, 132, 10, 131, 41, 224, 59, 164, 11, 3, 56, 243, 142, 34, 152, 32, 128, 0, 144, 220, 154, 27, 55, 0, 36, 201, 154, 169, 115, 145, 16, 225, 139, 3, 11, 39, 153, 17, 204, 40, 152, 33, 129, 8, 26, 71, 168, 8, 24, 208, 12, 4, 154, 201, 12, 38, 152, 16, 201, 25, 145, 96, 4, 153, 186, 40, 161, 80, 163, 157, 49, 34, 19, 188, 65, 249, 139, 169, 9, 144, 65, 130, 172, 66, 162, 154, 138, 53, 201, 114, 161, 9, 1, 34, 128, 128, 239, 9, 8, 66, 129, 34, 176, 170, 142, 52, 201, 81, 192, 58, 2, 65, 130, 136, 168, 217, 140, 51, 185, 218, 190, 136, 187, 114, 1, 50, 193, 25, 208, 75, 5, 0, 144, 33, 201, 153, 156, 36, 40, 38, 40, 22, 186, 17, 218, 9, 9, 50, 235, 9, 128, 1, 153, 16, 218, 11, 162, 159, 35, 186, 169, 12, 39, 50, 145, 154, 200, 187, 188, 113, 35, 0, 33, 130, 173, 97, 51, 136, 17, 220, 25, 153, 17, 152, 137, 168, 219, 204, 140, 145, 174, 51, 139, 55, 136, 21, 169, 18, 185, 9, 35, 136, 4, 172, 17, 137, 4, 159, 34, 152, 137, 67, 153, 67, 187, 55, 187, 0, 191, 48, 2, 185, 139, 50, 162, 223, 16, 184, 64, 21, 16, 161, 12, 1, 24, 20, 202, 137, 188, 8, 201, 113, 130, 40, 131, 137, 129, 171, 144, 174, 153, 173, 66, 161, 9, 251, 156, 203, 25, 129, 170, 186, 191, 138, 129, 16, 145, 140, 84, 18, 68, 1, 16, 234, 42, 52, 116, 19, 32, 37, 16, 34, 33, 2, 152, 0, 154, 116, 18, 50, 145, 153, 204, 154, 219, 138, 136, 16, 83, 35, 144, 236, 172, 153, 171, 168, 172, 33, 185, 48, 177, 188, 204, 11, 18, 40, 19, 172, 68, 144, 136, 252, 173, 203, 203, 137, 136, 17, 152, 144, 206, 154, 204, 10, 1, 40, 36, 34, 35, 16, 83, 177, 59, 22, 9, 33, 65, 21, 16, 3, 190, 170, 190, 153, 186, 8, 169, 171, 169, 207, 170, 137, 136, 65, 20, 48, 22, 16, 51, 18, 33, 67, 85, 51, 34, 18, 153, 49, 217, 81, 145, 64, 146, 82, 146, 73, 147, 155, 176, 175, 1, 171, 84, 145, 56, 162, 138, 168, 73, 132, 187, 50, 176, 139, 250, 171, 202, 139, 176, 15, 36, 8, 67, 1, 66, 144, 57, 210, 28, 23, 9, 35, 128, 20, 251, 26, 160, 11, 130, 155, 144, 58, 22, 154, 152, 9, 217, 80, 193, 11, 33, 69, 192, 189, 9, 144, 190, 72, 176, 43, 151, 249, 36, 0, 146, 170, 154, 233, 158, 52, 169, 80, 147, 172, 66, 19, 115, 21, 0, 48, 129, 137, 17, 40, 55, 234, 24, 176, 137, 218, 153, 171, 8, 219, 137, 184, 26, 178, 255, 188, 174, 219, 189, 136, 66, 53, 34, 18, 66, 36, 51, 67, 67, 18, 1, 0, 16, 128, 153, 219, 203, 205, 204, 171, 170, 186, 187, 188, 171, 153, 170, 32, 83, 69, 51, 18, 8, 33, 68, 2, 144, 153, 34, 3, 136, 144, 204, 171, 156, 24, 66, 54, 17, 1, 0, 17, 129, 204, 203, 173, 220, 204, 186, 219, 187, 170, 171, 153, 153, 0, 49, 70, 68, 51, 51, 67, 67, 51, 51, 50, 130, 185, 220, 188, 203, 172, 188, 186, 219, 171, 169, 137, 153, 136, 8, 67, 34, 52, 52, 67, 67, 68, 34, 128, 33, 18, 16, 145, 154, 24, 8, 56, 55, 145, 137, 168, 203, 9, 52, 162, 190, 203, 205, 186, 219, 154, 154, 185, 187, 137, 8, 86, 35, 49, 53, 52, 52, 68, 52, 35, 33, 33, 0, 8, 17, 49, 36, 34, 145, 219, 188, 137, 152, 48, 55, 34, 0, 17, 50, 68, 18, 160, 27, 38, 217, 10, 145, 207, 171, 138, 136, 205, 138, 1, 33, 67, 87, 36, 34, 36, 51, 67, 67, 37, 34, 129, 25, 34, 1, 251, 171, 169, 203, 189, 155, 137, 201, 187, 170, 153, 187, 156, 65, 85, 51, 18, 18, 17, 51, 19, 84, 53, 18, 17, 1, 169, 187, 204, 220, 172, 25, 145, 203, 137, 186, 218, 189, 154, 170, 154, 154, 65, 1, 1, 251, 203, 188, 40, 3, 50, 162, 139, 177, 255, 138, 144, 8, 1, 82, 1, 152, 237, 139, 129, 8, 1, 204, 171, 154, 219, 139, 100, 130, 202, 171, 136, 16, 50, 52, 17, 17, 217, 155, 33, 169, 113, 194, 138, 249, 140, 192, 174, 144, 235, 188, 188, 9, 66, 85, 67, 35, 51, 53, 35, 52, 67, 34, 1, 128, 136, 168, 202, 237, 171, 204, 171, 172, 170, 170, 170, 170, 154, 136, 16, 99, 51, 53, 37, 18, 17, 33, 82, 35, 33, 34, 152, 8, 144, 8, 34, 145, 155, 153, 64, 36, 33, 248, 207, 203, 202, 203, 170, 219, 203, 188, 172, 187, 187, 170, 8, 33, 67, 67, 99, 52, 52, 67, 51, 67, 35, 19, 17, 128, 201, 188, 205, 187, 203, 172, 171, 170, 203, 187, 154, 138, 0, 18, 51, 52, 51, 35, 51, 69, 67, 52, 51, 1, 82, 52, 35, 17, 66, 67, 50, 67, 53, 18, 0, 185, 204, 189, 171, 187, 205, 171, 188, 203, 171, 155, 137, 8, 49, 68, 67, 52, 68, 66, 34, 33, 51, 68, 35, 67, 34, 0, 137, 24, 34, 99, 35, 35, 17, 144, 171, 170, 206, 170, 204, 188, 189, 187, 204, 187, 155, 169, 171, 48, 68, 69, 51, 67, 51, 67, 83, 50, 52, 51, 18, 16, 161, 154, 0, 203, 170, 154, 1, 217, 155, 115, 22, 8, 83, 51, 34, 128, 152, 37, 24, 34, 0, 8, 146, 223, 171, 201, 188, 173, 170, 170, 153, 152, 9, 33, 50, 71, 19, 50, 70, 34, 16, 50, 145, 154, 144, 203, 155, 169, 237, 187, 137, 185, 202, 205, 172, 136, 169, 137, 176, 191, 154, 170, 8, 201, 40, 193, 43, 22, 169, 98, 160, 57, 21, 138, 67, 144, 56, 3, 154, 216, 158, 169, 172, 0, 201, 186, 223, 137, 186, 138, 185, 169, 218, 187, 57, 71, 18, 48, 51, 19, 115, 37, 67, 3, 40, 35, 235, 136, 204, 41, 132, 204, 137, 184, 204, 186, 153, 128, 17, 3, 137, 65, 19, 184, 235, 238, 186, 188, 58, 86, 68, 35, 18, 49, 51, 68, 67, 19, 18, 129, 144, 185, 219, 203, 204, 189, 187, 188, 171, 187, 187, 137, 168, 9, 51, 71, 67, 51, 51, 51, 18, 18, 66, 67, 34, 2, 217, 171, 185, 187, 152, 137, 19, 217, 138, 34, 0, 168, 255, 173, 186, 187, 203, 204, 202, 188, 203, 186, 154, 8, 33, 50, 68, 52, 36, 52, 69, 34, 35, 19, 18, 129, 152, 188, 219, 188, 204, 172, 171, 170, 186, 171, 186, 170, 153, 8, 64, 69, 35, 2, 8, 49, 83, 18, 17, 83, 50, 66, 51, 51, 100, 35, 1, 8, 69, 34, 129, 170, 153, 221, 189, 203, 186, 186, 203, 203, 171, 153, 153, 8, 66, 53, 67, 52, 67, 36, 67, 19, 34, 34, 18, 17, 83, 51, 18, 33, 3, 170, 114, 67, 52, 19, 1, 153, 201, 205, 153, 201, 189, 187, 189, 170, 185, 187, 24, 1, 65, 71, 67, 51, 67, 52, 34, 16, 49, 36, 145, 24, 161, 207, 156, 56, 35, 128, 48, 55, 34, 18, 33, 84, 67, 144, 170, 0, 249, 172, 170, 187, 171, 235, 187, 154, 137, 32, 19, 16, 116, 52, 17, 66, 36, 2, 0, 1, 136, 32, 176, 207, 171, 170, 170, 235, 170, 152, 201, 10, 19, 186, 64, 162, 155, 115, 20, 128, 136, 128, 137, 34, 238, 155, 152, 1, 176, 171, 100, 36, 51, 144, 48, 35, 128, 25, 19, 137, 249, 255, 186, 187, 186, 9, 232, 139, 184, 207, 128, 152, 16, 129, 154, 40, 69, 136, 66, 145, 48, 4, 9, 86, 18, 8, 16, 201, 10, 37, 185, 64, 145, 189, 171, 204, 139, 216, 140, 18, 153, 17, 188, 25, 8, 101, 129, 32, 36, 1, 16, 2, 253, 220, 221, 154, 136, 33, 67, 51, 50, 83, 66, 99, 67, 35, 17, 16, 128, 8, 153, 169, 236, 204, 186, 187, 203, 187, 186, 187, 154, 170, 97, 35, 84, 35, 51, 34, 32, 2, 81, 36, 0, 145, 188, 168, 203, 9, 170, 8, 0, 33, 67, 37, 128, 169, 207, 138, 218, 171, 217, 173, 187, 189, 187, 171, 137, 9, 65, 51, 85, 51, 67, 51, 38, 19, 51, 18, 17, 144, 203, 204, 187, 188, 189, 186, 187, 203, 171, 171, 153, 153, 137, 16, 17, 33, 50, 1, 114, 52, 34, 68, 69, 67, 51, 36, 67, 67, 50, 20, 3, 49, 0, 19, 0, 136, 186, 219, 189, 172, 203, 204, 187, 187, 172, 170, 138, 17, 17, 66, 52, 68, 36, 34, 52, 50, 36, 18, 1, 33, 144, 153, 154, 8, 41, 55, 32, 39, 1, 1, 152, 16, 52, 8, 35, 221, 169, 237, 187, 156, 153, 185, 154, 0, 153, 66, 33, 55, 18, 115, 36, 50, 52, 34, 20, 152, 16, 128, 155, 40, 130, 137, 252, 172, 186, 171, 153, 83, 145, 172, 40, 19, 184, 187, 114, 180, 223, 138, 33, 67, 2, 16, 152, 112, 20, 34, 19, 82, 36, 128, 168, 154, 128, 218, 187, 187, 235, 171, 172, 138, 136, 48, 130, 25, 55, 68, 37, 0, 50, 129, 153, 218, 25, 129, 170, 235, 188, 137, 203, 170, 137, 50, 146, 24, 161, 89, 132, 138, 147, 175, 16, 219, 153, 187, 40, 200, 42, 4, 25, 68, 129, 98, 53, 129, 168, 9, 34, 51, 148, 190, 136, 202, 154, 204, 32, 249, 141, 144, 10, 1, 170, 184, 174, 137, 170, 217, 172, 32, 0, 49, 18, 115, 19, 137, 98, 36, 33, 160, 26, 39, 184, 170, 189, 136, 204, 9, 49, 36, 232, 172, 9, 67, 145, 32, 35, 33, 18, 170, 0, 201, 56, 194, 207, 40, 144, 203, 203, 139, 66, 19, 153, 186, 12, 83, 100, 19, 40, 52, 49, 132, 155, 20, 170, 18, 172, 18, 255, 137, 186, 155, 152, 17, 184, 188, 154, 115, 179, 255, 203, 154, 136, 33, 85, 52, 35, 18, 49, 69, 51, 35, 18, 18, 128, 170, 189, 218, 204, 187, 188, 171, 203, 154, 202, 137, 160, 137, 0, 65, 69, 50, 36, 17, 1, 136, 24, 50, 52, 20, 152, 169, 203, 8, 160, 40, 146, 171, 250, 207, 170, 203, 219, 203, 186, 186, 186, 153, 187, 137, 152, 24, 98, 86, 67, 67, 51, 34, 35, 50, 35, 18, 0, 8, 218, 187, 253, 171, 188, 172, 186, 171, 170, 154, 128, 168, 250, 187, 16, 17, 33, 33, 70, 51, 51, 1, 82, 70, 52, 36, 51, 51, 52, 1, 144, 203, 187, 204, 172, 203, 186, 219, 172, 186, 170, 153, 9, 99, 36, 34, 34, 83, 36, 34, 18, 17, 83, 1, 137, 185, 186, 202, 186, 203, 172, 24, 67, 19, 1, 168, 187, 153, 154, 66, 251, 143, 168, 204, 202, 187, 8, 185, 80, 146, 98, 35, 66, 35, 49, 38, 34, 34, 16, 51, 216, 25, 217, 174, 153, 8, 1, 169, 24, 145, 40, 4, 138, 16, 64, 20, 201, 204, 155, 201, 173, 160, 191, 9, 24, 83, 19, 115, 52, 50, 53, 34, 51, 34, 85, 2, 184, 139, 8, 217, 205, 171, 8, 168, 173, 203, 10, 0, 128, 16, 65, 68, 18, 33, 67, 68, 2, 128, 16, 67, 2, 153, 26, 2, 239, 187, 9, 128, 169, 205, 155, 136, 186, 219, 155, 50, 131, 153, 152, 117, 21, 128, 17, 0, 17, 202, 41, 3, 136, 176, 207, 138, 220, 138, 129, 16, 21, 184, 138, 185, 89, 4, 24, 184, 255, 43, 0, 54, 128, 40, 168, 73, 22, 0, 35, 153, 115, 160, 26, 232, 156, 144, 174, 8, 200, 11, 128, 140, 66, 201, 10, 144, 41, 38, 18, 17, 0, 8, 17, 238, 56, 39, 136, 154, 153, 40, 2, 219, 9, 152, 152, 237, 154, 32, 18, 202, 155, 33, 51, 224, 223, 170, 155, 136, 33, 100, 53, 50, 66, 67, 67, 50, 33, 33, 17, 129, 170, 203, 235, 220, 188, 186, 170, 171, 171, 137, 8, 8, 40, 99, 69, 50, 50, 52, 33, 1, 136, 17, 128, 128, 184, 203, 188, 9, 169, 157, 169, 155, 17, 251, 187, 204, 188, 220, 188, 186, 186, 186, 171, 138, 24, 34, 32, 101, 84, 52, 35, 51, 36, 33, 17, 152, 153, 217, 171, 218, 188, 187, 220, 186, 154, 153, 152, 8, 128, 32, 160, 172, 205, 140, 1, 153, 137, 48, 53, 1, 40, 103, 68, 51, 52, 34, 51, 4, 0, 152, 188, 185, 207, 154, 203, 171, 186, 172, 153, 154, 16, 16, 100, 35, 50, 52, 83, 35, 0, 16, 128, 48, 161, 156, 218, 138, 217, 139, 145, 58, 38, 136, 51, 18, 51, 185, 9, 202, 40, 249, 155, 217, 187, 186, 189, 56, 87, 2, 136, 81, 37, 1, 16, 17, 32, 35, 129, 153, 128, 239, 154, 153, 32, 200, 11, 145, 174, 137, 84, 36, 168, 175, 24, 161, 154, 2, 129, 251, 157, 32, 33, 1, 56, 71, 50, 17, 34, 67, 36, 1, 16, 19, 128, 250, 188, 169, 186, 170, 204, 138, 168, 138, 169, 26, 51, 67, 52, 67, 84, 19, 1, 0, 154, 144, 154, 83, 129, 128, 206, 9, 200, 187, 168, 25, 68, 18, 145, 138, 67, 249, 141, 128, 136, 160, 172, 136, 203, 25, 17, 53, 152, 113, 19, 32, 36, 129, 0, 170, 16, 236, 41, 193, 174, 144, 170, 128, 203, 25, 200, 10, 177, 207, 219, 156, 128, 203, 137, 33, 54, 3, 136, 32, 34, 51, 67, 19, 152, 83, 240, 172, 170, 153, 218, 139, 52, 128, 34, 176, 154, 16, 17, 234, 189, 10, 1, 222, 139, 34, 128, 33, 177, 112, 39, 33, 3, 154, 115, 161, 173, 136, 136, 50, 1, 137, 24, 84, 35, 129, 41, 103, 129, 136, 144, 9, 186, 156, 145, 189, 9, 128, 251, 140, 161, 190, 252, 189, 154, 25, 66, 51, 53, 51, 67, 34, 66, 52, 51, 2, 17, 1, 153, 204, 221, 187, 186, 188, 171, 154, 136, 169, 137, 0, 18, 17, 99, 69, 51, 35, 145, 203, 202, 155, 0, 8, 34, 16, 36, 152, 68, 50, 38, 144, 64, 2, 0, 208, 223, 171, 202, 203, 171, 154, 152, 136, 153, 9, 66, 34, 67, 70, 69, 34, 34, 1, 17, 145, 187, 171, 187, 188, 202, 189, 154, 169, 206, 171, 136, 33, 1, 136, 9, 184, 255, 172, 152, 152, 8, 0, 8, 99, 35, 35, 52, 55, 52, 51, 35, 66, 2, 169, 218, 188, 187, 189, 186, 170, 153, 219, 187, 138, 16, 67, 67, 47, 218, 48, 0, 68, 52, 35, 33, 51, 35, 2, 185, 9, 144, 154, 153, 204, 154, 234, 188, 24, 66, 85, 67, 17, 152, 185, 171, 202, 155, 144, 32, 248, 156, 152, 137, 69, 35, 50, 51, 67, 83, 69, 19, 136, 0, 170, 138, 168, 137, 0, 144, 188, 24, 251, 140, 82, 52, 34, 128, 80, 86, 129, 171, 24, 160, 188, 138, 16, 200, 155, 160, 157, 217, 156, 51, 129, 99, 34, 35, 1, 82, 2, 9, 34, 136, 84, 130, 16, 233, 187, 219, 188, 154, 25, 19, 168, 49, 163, 175, 137, 188, 57, 130, 73, 23, 0, 160, 172, 202, 172, 50, 144, 49, 34, 70, 177, 25, 18, 187, 104, 37, 136, 24, 176, 223, 24, 152, 170, 154, 128, 154, 51, 17, 54, 1, 251, 172, 152, 188, 26, 130, 174, 17, 186, 113, 147, 137, 129, 8, 50, 0, 2, 188, 170, 223, 138, 217, 188, 40, 2, 9, 83, 52, 160, 89, 6, 41, 38, 0, 67, 168, 24, 184, 187, 221, 10, 128, 170, 9, 129, 236, 172, 9, 48, 38, 129, 40, 52, 193, 207, 205, 188, 171, 137, 49, 84, 52, 35, 50, 67, 52, 51, 51, 35, 17, 128, 185, 221, 190, 187, 204, 154, 185, 153, 136, 9, 1, 16, 67, 35, 83, 69, 34, 1, 168, 186, 188, 154, 137, 49, 2, 65, 35, 66, 35, 83, 67, 33, 34, 18, 250, 191, 189, 203, 203, 170, 154, 137, 136, 8, 16, 51, 50, 68, 69, 52, 67, 51, 1, 136, 169, 186, 202, 155, 152, 171, 170, 203, 154, 220, 170, 8, 17, 168, 138, 249, 190, 190, 189, 171, 186, 137, 0, 16, 49, 99, 52, 67, 84, 67, 36, 34, 34, 17, 168, 187, 219, 188, 187, 187, 172, 154, 202, 187, 137, 0, 32, 67, 53, 68, 1, 16, 1, 0, 161, 140, 66, 129, 81, 36, 66, 50, 82, 3, 40, 68, 83, 36, 128, 168, 204, 186, 188, 10, 0, 136, 0, 136, 136, 185, 105, 55, 18, 50, 33, 2, 235, 154, 188, 171, 173, 16, 99, 4, 154, 115, 21, 8, 16, 51, 36, 34, 34, 129, 235, 154, 144, 188, 154, 154, 187, 174, 138, 202, 173, 0, 137, 17, 48, 38, 16, 53, 51, 37, 0, 66, 18, 8, 129, 24, 250, 12, 130, 187, 153, 24, 232, 9, 177, 27, 146, 207, 137, 154, 136, 170, 153, 204, 25, 33, 53, 67, 18, 65, 3, 113, 71, 17, 129, 136, 0, 8, 218, 171, 202, 220, 154, 153, 171, 136, 33, 201, 10, 52, 69, 161, 27, 3, 56, 6, 170, 16, 152, 41, 87, 18, 18, 8, 129, 49, 225, 140, 177, 191, 10, 192, 174, 152, 173, 32, 128, 9, 170, 48, 83, 70, 2, 66, 50, 50, 144, 170, 48, 129, 155, 237, 156, 169, 205, 171, 152, 136, 144, 25, 85, 69, 161, 219, 220, 188, 187, 136, 49, 68, 50, 34, 34, 67, 69, 67, 51, 51, 51, 1, 168, 235, 203, 187, 189, 187, 171, 153, 171, 136, 169, 165, 242, 50, 0, 137, 128, 97, 52, 68, 67, 1, 169, 188, 170, 155, 82, 51, 52, 18, 17, 32, 82, 34, 168, 136, 48, 178, 239, 219, 204, 186, 203, 154, 8, 40, 34, 16, 34, 17, 18, 137, 115, 55, 51, 2, 152, 201, 188, 170, 154, 33, 33, 53, 1, 33, 147, 190, 171, 171, 186, 207, 153, 202, 188, 205, 187, 171, 138, 32, 51, 84, 51, 36, 18, 17, 51, 53, 52, 36, 17, 0, 186, 190, 187, 156, 169, 154, 17, 65, 147, 173, 153, 237, 154, 154, 40, 145, 154, 128, 8, 0, 66, 70, 84, 67, 67, 35, 35, 51, 1, 186, 203, 156, 0, 185, 25, 224, 189, 173, 138, 0, 49, 35, 67, 34, 130, 235, 137, 32, 1, 25, 51, 48, 55, 17, 83, 82, 68, 33, 50, 2, 0, 152, 130, 255, 187, 174, 25, 128, 32, 129, 153, 24, 70, 34, 66, 51, 35, 129, 24, 177, 158, 168, 172, 170, 11, 17, 218, 205, 32, 3, 153, 128, 32, 52, 19, 201, 11, 36, 168, 136, 40, 119, 39, 1, 144, 0, 0, 144, 139, 65, 144, 236, 188, 137, 170, 170, 140, 16, 81, 4, 152, 1, 50, 22, 170, 41, 67, 38, 128, 9, 0, 98, 129, 171, 219, 137, 33, 20, 8, 129, 152, 253, 156, 136, 169, 136, 138, 16, 137, 66, 35, 83, 83, 50, 53, 67, 69, 18, 152, 220, 155, 144, 188, 188, 155, 129, 170, 41, 17, 128, 154, 85, 208, 42, 20, 17, 248, 159, 8, 17, 0, 169, 57, 55, 33, 50, 33, 34, 136, 0, 170, 185, 255, 8, 186, 11, 160, 154, 185, 157, 49, 131, 236, 205, 206, 187, 187, 137, 0, 65, 67, 53, 67, 67, 52, 67, 50, 50, 18, 129, 152, 201, 203, 221, 170, 170, 171, 153, 137, 17, 128, 136, 153, 169, 153, 9, 128, 65, 193, 191, 185, 57, 71, 66, 51, 68, 36, 35, 35, 17, 1, 219, 188, 204, 187, 186, 204, 171, 187, 170, 185, 25, 53, 51, 69, 17, 49, 145, 9, 1, 8, 168, 9, 185, 171, 17, 64, 119, 20, 67, 19, 35, 160, 9, 249, 189, 203, 219, 187, 187, 187, 202, 155, 153, 32, 52, 68, 36, 67, 51, 35, 18, 50, 1, 136, 202, 170, 250, 156, 0, 185, 170, 24, 85, 18, 152, 137, 219, 189, 218, 187, 154, 187, 10, 169, 40, 51, 116, 68, 66, 67, 52, 36, 33, 18, 0, 168, 186, 187, 189, 186, 187, 137, 202, 171, 152, 128, 40, 55, 34, 85, 1, 186, 139, 201, 174, 170, 171, 32, 68, 52, 84, 68, 18, 50, 36, 33, 34, 128, 153, 206, 156, 170, 204, 188, 155, 153, 170, 137, 64, 70, 51, 52, 51, 36, 129, 8, 1, 168, 154, 217, 173, 187, 171, 152, 187, 40, 67, 51, 19, 116, 36, 129, 185, 157, 170, 188, 154, 16, 18, 24, 83, 2, 80, 86, 34, 33, 34, 67, 144, 171, 186, 191, 188, 203, 169, 169, 16, 16, 32, 17, 84, 19, 16, 33, 70, 10, 38, 0, 51, 160, 174, 136, 189, 9, 136, 40, 86, 130, 56, 21, 137, 17, 24, 129, 140, 37, 16, 146, 175, 176, 223, 137, 153, 17, 168, 97, 2, 136, 8, 50, 218, 170, 154, 67, 176, 75, 6, 186, 187, 173, 137, 170, 64, 83, 36, 2, 17, 146, 219, 202, 89, 21, 153, 82, 146, 185, 187, 139, 168, 219, 138, 68, 19, 17, 50, 179, 255, 219, 188, 189, 187, 155, 137, 32, 53, 69, 35, 66, 36, 50, 35, 49, 36, 129, 128, 153, 235, 203, 187, 188, 155, 153, 137, 32, 1, 1, 8, 249, 188, 169, 203, 153, 8, 136, 50, 129, 117, 83, 50, 99, 36, 34, 51, 19, 129, 184, 204, 189, 203, 203, 170, 169, 154, 9, 1, 169, 48, 146, 9, 19, 81, 129, 186, 221, 10, 217, 155, 34, 99, 53, 83, 52, 51, 35, 1, 169, 189, 188, 188, 204, 187, 202, 203, 171, 170, 137, 136, 32, 69, 51, 35, 36, 128, 170, 172, 188, 171, 153, 80, 54, 51, 68, 50, 34, 17, 16, 169, 153, 219, 187, 253, 187, 172, 186, 188, 139, 9, 32, 82, 35, 34, 19, 16, 49, 1, 152, 112, 69, 17, 65, 68, 18, 128, 50, 36, 33, 67, 52, 147, 189, 154, 220, 186, 203, 138, 168, 154, 136, 65, 131, 140, 86, 1, 17, 34, 53, 2, 98, 2, 8, 136, 26, 2, 171, 8, 82, 200, 26, 2, 64, 160, 112, 135, 9, 2, 139, 131, 190, 129, 205, 137, 153, 8, 8, 100, 2, 64, 20, 136, 0, 168, 137, 249, 155, 1, 152, 49, 49, 54, 129, 82, 130, 25, 130, 40, 6, 186, 32, 0, 18, 239, 9, 217, 11, 184, 141, 20, 153, 51, 128, 0, 185, 25, 177, 155, 99, 36, 34, 82, 68, 145, 155, 186, 172, 185, 175, 8, 168, 9, 169, 97, 146, 56, 147, 121, 6, 138, 50, 176, 173, 9, 144, 171, 32, 152, 113, 2, 33, 21, 168, 221, 171, 153, 221, 137, 145, 26, 37, 0, 50, 160, 155, 16, 233, 27, 39, 144, 128, 16, 129, 170, 250, 140, 144, 173, 34, 16, 52, 24, 71, 184, 41, 162, 172, 170, 24, 200, 155, 189, 57, 147, 11, 53, 144, 185, 28, 55, 1, 67, 50, 146, 173, 136, 56, 55, 32, 53, 145, 138, 16, 152, 8, 117, 19, 0, 24, 98, 145, 190, 204, 204, 188, 188, 171, 153, 9, 49, 51, 69, 83, 51, 50, 52, 51, 51, 19, 16, 34, 128, 202, 138, 152, 41, 50, 85, 51, 52, 129, 144, 252, 219, 219, 187, 203, 171, 170, 137, 8, 64, 51, 34, 68, 68, 19, 33, 50, 19, 152, 186, 173, 186, 189, 153, 8, 52, 128, 115, 2, 153, 220, 186, 221, 171, 186, 188, 169, 154, 24, 0, 16, 99, 67, 34, 52, 67, 51, 49, 4, 153, 146, 206, 152, 219, 137, 168, 25, 128, 0, 0, 145, 255, 155, 186, 204, 171, 186, 155, 184, 155, 66, 129, 114, 55, 17, 83, 51, 33, 16, 2, 153, 69, 253, 45, 0, 137, 218, 139, 0, 1, 128, 34, 233, 173, 203, 173, 153, 153, 9, 18, 185, 72, 3, 190, 154, 9, 83, 1, 98, 52, 35, 18, 50, 19, 17, 100, 36, 17, 52, 20, 1, 0, 128, 203, 170, 189, 138, 168, 24, 200, 88, 163, 159, 16, 251, 10, 17, 8, 34, 128, 152, 152, 201, 157, 98, 145, 112, 37, 32, 50, 34, 2, 187, 34, 250, 158, 168, 9, 176, 28, 69, 130, 152, 169, 8, 136, 17, 68, 68, 19, 185, 138, 216, 172, 136, 65, 20, 0, 50, 83, 3, 203, 32, 161, 206, 186, 10, 129, 219, 138, 17, 176, 191, 9, 2, 137, 48, 17, 99, 160, 153, 185, 59, 6, 56, 87, 34, 51, 1, 17, 251, 156, 169, 171, 9, 18, 16, 20, 136, 218, 138, 162, 159, 67, 2, 17, 128, 65, 161, 207, 155, 136, 185, 48, 23, 16, 83, 0, 32, 160, 9, 176, 207, 40, 129, 137, 35, 201, 186, 205, 136, 200, 57, 71, 1, 17, 36, 200, 154, 204, 171, 128, 137, 32, 52, 33, 55, 185, 25, 184, 189, 205, 138, 33, 18, 56, 55, 19, 16, 16, 19, 186, 8, 138, 17, 0, 176, 159, 0, 217, 171, 65, 146, 173, 56, 67, 52, 128, 2, 255, 188, 220, 172, 171, 170, 169, 10, 83, 68, 67, 67, 50, 51, 19, 17, 0, 8, 1, 168, 9, 50, 35, 65, 54, 18, 68, 2, 1, 234, 203, 205, 188, 188, 172, 171, 170, 137, 33, 50, 54, 35, 50, 34, 67, 176, 155, 0, 233, 156, 17, 138, 65, 2, 33, 81, 37, 16, 51, 203, 185, 239, 170, 203, 171, 170, 137, 137, 17, 82, 36, 8, 51, 152, 136, 156, 218, 140, 145, 10, 19, 25, 84, 35, 34, 115, 3, 24, 161, 171, 254, 154, 201, 170, 187, 24, 201, 9, 17, 49, 128, 66, 129, 99, 152, 83, 144, 99, 129, 17, 128, 33, 67, 39, 24, 55, 128, 16, 160, 170, 188, 136, 186, 8, 201, 153, 137, 21, 203, 1, 156, 132, 189, 50, 128, 69, 128, 48, 35, 131, 44, 103, 0, 67, 34, 1, 32, 18, 203, 9, 169, 8, 153, 17, 186, 9, 0, 3, 206, 219, 190, 136, 188, 48, 18, 99, 2, 33, 129, 144, 170, 48, 97, 71, 1, 0, 1, 168, 25, 84, 85, 34, 128, 188, 25, 33, 233, 156, 33, 0, 153, 64, 53, 17, 19, 234, 171, 169, 206, 140, 128, 33, 17, 65, 131, 24, 145, 80, 3, 152, 251, 188, 186, 174, 136, 8, 32, 51, 129, 80, 51, 50, 68, 83, 35, 202, 155, 153, 219, 155, 51, 20, 145, 138, 50, 83, 69, 18, 184, 251, 220, 188, 171, 152, 153, 8, 65, 131, 25, 84, 51, 54, 51, 3, 152, 234, 190, 203, 10, 128, 16, 67, 52, 19, 67, 36, 1, 1, 233, 203, 203, 172, 153, 152, 33, 1, 16, 17, 152, 154, 102, 34, 32, 144, 137, 160, 239, 154, 0, 0, 17, 50, 54, 35, 16, 1, 153, 168, 182, 9, 42, 0, 206, 187, 186, 170, 41, 37, 50, 53, 51, 21, 170, 9, 50, 195, 14, 130, 138, 250, 158, 152, 25, 36, 16, 35, 49, 4, 189, 169, 170, 220, 171, 202, 172, 169, 10, 34, 114, 54, 34, 18, 16, 51, 128, 16, 144, 137, 169, 202, 43, 71, 51, 51, 65, 35, 187, 169, 207, 153, 137, 168, 174, 169, 172, 169, 171, 40, 0, 24, 33, 201, 10, 19, 25, 130, 172, 201, 223, 137, 152, 64, 38, 1, 160, 26, 161, 190, 169, 25, 145, 136, 250, 155, 152, 154, 201, 41, 5, 153, 169, 41, 145, 154, 32, 163, 255, 24, 145, 26, 87, 34, 67, 146, 25, 131, 205, 170, 171, 128, 203, 153, 219, 57, 23, 201, 40, 129, 172, 137, 137, 1, 9, 103, 2, 32, 18, 169, 32, 185, 96, 130, 40, 5, 154, 1, 186, 113, 146, 26, 7, 153, 2, 219, 16, 184, 26, 208, 171, 219, 25, 3, 32, 103, 145, 137, 2, 169, 1, 137, 67, 129, 65, 129, 137, 114, 68, 50, 34, 129, 184, 189, 154, 186, 25, 100, 2, 187, 172, 9, 185, 120, 53, 51, 4, 153, 128, 186, 138, 100, 19, 152, 219, 24, 3, 137, 67, 18, 177, 207, 186, 139, 129, 170, 65, 37, 161, 189, 136, 65, 86, 67, 19, 129, 0, 218, 172, 153, 17, 33, 1, 8, 67, 51, 52, 0, 85, 130, 201, 206, 153, 152, 169, 40, 19, 152, 217, 172, 153, 137, 50, 2, 160, 222, 189, 24, 145, 88, 35, 49, 130, 25, 37, 137, 48, 177, 175, 203, 173, 136, 170, 115, 19, 48, 132, 203, 187, 172, 32, 177, 58, 134, 171, 98, 144, 81, 21, 0, 144, 187, 186, 189, 154, 8, 32, 35, 160, 173, 10, 66, 18, 69, 18, 152, 221, 155, 168, 41, 52, 1, 152, 186, 171, 172, 114, 55, 52, 2, 152, 219, 172, 152, 153, 17, 18, 50, 51, 145, 0, 168, 169, 255, 171, 218, 139, 136, 97, 37, 50, 19, 169, 186, 173, 9, 17, 68, 34, 136, 176, 223, 137, 170, 40, 33, 69, 19, 18, 35, 129, 137, 220, 204, 202, 187, 153, 41, 69, 50, 52, 33, 129, 170, 136, 154, 16, 144, 0, 236, 154, 202, 26, 51, 101, 20, 17, 2, 169, 170, 221, 186, 218, 154, 169, 153, 82, 67, 67, 19, 34, 192, 157, 153, 172, 16, 136, 18, 168, 49, 177, 12, 85, 19, 144, 144, 203, 221, 187, 170, 185, 157, 34, 168, 66, 34, 87, 130, 49, 4, 185, 187, 203, 10, 128, 65, 21, 128, 34, 128, 40, 67, 2, 192, 205, 186, 157, 137, 154, 48, 35, 52, 129, 17, 202, 115, 146, 81, 3, 152, 220, 139, 152, 25, 53, 68, 35, 16, 18, 152, 172, 40, 177, 159, 8, 34, 192, 42, 53, 17, 81, 36, 217, 138, 169, 155, 168, 88, 5, 187, 16, 185, 26, 17, 117, 35, 152, 48, 178, 175, 152, 136, 1, 137, 50, 33, 20, 170, 114, 20, 201, 202, 219, 170, 170, 72, 147, 254, 40, 0, 54, 129, 17, 185, 41, 233, 73, 20, 25, 161, 175, 128, 153, 16, 83, 37, 1, 0, 128, 137, 18, 168, 115, 145, 172, 153, 65, 3, 113, 23, 144, 168, 204, 137, 8, 16, 49, 52, 145, 190, 154, 186, 138, 0, 48, 146, 173, 153, 137, 236, 139, 2, 185, 190, 156, 48, 53, 67, 36, 67, 145, 204, 154, 8, 137, 0, 33, 193, 191, 9, 136, 0, 82, 69, 2, 9, 17, 144, 234, 172, 168, 203, 203, 10, 17, 49, 71, 20, 0, 33, 160, 203, 172, 136, 160, 187, 136, 128, 169, 9, 86, 52, 17, 51, 20, 201, 173, 186, 189, 202, 154, 48, 66, 69, 67, 68, 19, 144, 0, 216, 189, 153, 170, 154, 32, 51, 18, 51, 99, 21, 154, 67, 184, 155, 189, 152, 206, 9, 16, 1, 138, 115, 4, 8, 34, 99, 130, 139, 136, 220, 188, 155, 8, 0, 66, 68, 51, 130, 16, 128, 170, 221, 155, 128, 186, 9, 67, 52, 18, 51, 2, 128, 203, 96, 52, 67, 50, 53, 145, 171, 186, 204, 189, 154, 24, 82, 51, 66, 20, 201, 203, 173, 186, 189, 138, 160, 9, 33, 35, 0, 34, 160, 24, 68, 67, 85, 51, 50, 50, 129, 203, 187, 202, 10, 101, 50, 68, 36, 1, 0, 168, 175, 153, 203, 155, 136, 0, 33, 19, 8, 35, 252, 140, 152, 187, 170, 40, 208, 173, 1, 186, 137, 16, 70, 17, 35, 32, 20, 250, 138, 169, 187, 188, 32, 145, 48, 37, 67, 144, 154, 169, 188, 204, 26, 35, 168, 136, 186, 249, 191, 40, 35, 50, 69, 37, 145, 24, 184, 171, 204, 155, 1, 153, 49, 69, 129, 8, 2, 237, 155, 152, 136, 17, 8, 84, 2, 187, 156, 24, 128, 114, 55, 19, 34, 19, 1, 168, 187, 139, 17, 0, 114, 53, 18, 34, 129, 137, 254, 171, 153, 137, 169, 120, 22, 153, 0, 153, 169, 189, 25, 129, 33, 36, 69, 130, 40, 20, 153, 160, 138, 51, 152, 118, 34, 51, 1, 8, 144, 237, 139, 2, 171, 98, 130, 138, 169, 171, 250, 139, 2, 25, 37, 138, 54, 152, 65, 192, 154, 201, 139, 168, 74, 39, 33, 22, 0, 17, 184, 157, 8, 169, 139, 33, 201, 139, 160, 41, 37, 66, 34, 68, 208, 171, 8, 185, 189, 10, 128, 187, 56, 52, 103, 2, 16, 3, 218, 203, 154, 152, 137, 65, 19, 0, 152, 8, 160, 204, 27, 71, 160, 156, 136, 202, 155, 49, 152, 69, 144, 80, 130, 139, 67, 1, 144, 173, 82, 144, 153, 42, 39, 202, 8, 218, 187, 218, 138, 17, 1, 115, 19, 0, 129, 153, 168, 190, 187, 173, 137, 0, 34, 64, 87, 129, 9, 34, 192, 172, 137, 152, 217, 10, 52, 2, 8, 83, 51, 200, 140, 51, 232, 156, 17, 136, 185, 28, 39, 18, 1, 98, 19, 203, 9, 128, 188, 138, 32, 3, 188, 113, 19, 152, 24, 67, 224, 156, 136, 153, 137, 26, 55, 1, 152, 63, 1, 45, 0, 24, 176, 174, 154, 32, 20, 128, 50, 36, 160, 140, 68, 1, 136, 41, 22, 235, 24, 0, 16, 202, 41, 177, 156, 32, 113, 38, 129, 1, 184, 191, 203, 155, 136, 24, 51, 68, 35, 144, 49, 176, 172, 218, 139, 234, 139, 1, 8, 84, 18, 40, 4, 185, 8, 153, 9, 137, 34, 251, 142, 152, 25, 1, 115, 7, 137, 2, 171, 24, 203, 42, 129, 187, 41, 37, 169, 82, 20, 34, 160, 156, 67, 250, 10, 20, 136, 0, 187, 83, 144, 40, 53, 52, 169, 138, 203, 137, 206, 57, 36, 48, 130, 49, 5, 137, 48, 37, 185, 173, 187, 236, 156, 40, 66, 51, 51, 53, 160, 137, 160, 10, 67, 233, 139, 192, 191, 24, 0, 49, 52, 17, 128, 200, 190, 32, 177, 74, 163, 27, 164, 175, 24, 34, 65, 52, 36, 129, 170, 172, 187, 190, 25, 144, 9, 3, 56, 71, 0, 83, 130, 152, 188, 154, 204, 137, 155, 83, 176, 41, 208, 139, 217, 139, 34, 184, 156, 51, 168, 16, 66, 54, 160, 73, 19, 8, 50, 101, 36, 33, 34, 66, 192, 141, 2, 203, 48, 146, 41, 20, 219, 48, 194, 157, 144, 203, 153, 169, 11, 20, 187, 98, 160, 171, 155, 185, 189, 138, 128, 0, 192, 140, 193, 141, 2, 155, 2, 139, 69, 200, 26, 1, 9, 145, 207, 16, 161, 24, 144, 57, 227, 156, 129, 188, 202, 57, 39, 9, 67, 136, 82, 177, 42, 38, 1, 17, 154, 50, 224, 140, 137, 50, 253, 57, 132, 137, 0, 33, 130, 137, 152, 57, 196, 191, 40, 128, 128, 12, 70, 128, 24, 65, 19, 154, 98, 1, 17, 170, 98, 160, 25, 129, 10, 69, 184, 64, 3, 24, 49, 133, 188, 34, 251, 137, 170, 41, 3, 98, 35, 36, 17, 193, 191, 50, 250, 57, 130, 26, 129, 25, 51, 17, 48, 119, 146, 41, 19, 170, 154, 154, 219, 138, 203, 80, 145, 72, 22, 137, 24, 168, 188, 154, 203, 154, 202, 10, 129, 187, 56, 4, 115, 19, 48, 37, 185, 137, 252, 155, 168, 174, 33, 128, 64, 54, 17, 33, 131, 171, 2, 190, 8, 169, 136, 80, 147, 141, 20, 188, 0, 172, 50, 2, 2, 27, 212, 255, 8, 169, 10, 17, 50, 82, 52, 1, 33, 176, 207, 137, 168, 139, 34, 17, 53, 17, 16, 144, 184, 173, 50, 20, 137, 101, 146, 205, 153, 201, 171, 32, 16, 71, 35, 18, 35, 250, 171, 203, 188, 9, 0, 51, 70, 35, 33, 17, 168, 201, 203, 137, 153, 16, 33, 54, 3, 169, 154, 160, 207, 24, 18, 33, 1, 160, 251, 205, 171, 154, 137, 40, 85, 51, 35, 1, 0, 249, 171, 170, 154, 32, 68, 50, 69, 18, 1, 152, 153, 169, 137, 168, 114, 21, 16, 17, 33, 217, 10, 1, 138, 16, 65, 36, 161, 190, 9, 249, 155, 0, 128, 48, 147, 156, 129, 223, 137, 201, 170, 0, 144, 26, 21, 128, 186, 139, 249, 89, 251, 44, 0, 174, 8, 137, 136, 56, 6, 8, 2, 154, 0, 185, 9, 16, 248, 43, 149, 142, 33, 137, 0, 8, 129, 50, 217, 10, 200, 189, 219, 9, 217, 10, 34, 16, 49, 55, 176, 137, 184, 189, 189, 8, 202, 41, 130, 65, 4, 82, 4, 137, 16, 160, 220, 11, 2, 202, 89, 37, 129, 34, 1, 48, 22, 169, 72, 3, 138, 34, 128, 17, 32, 3, 112, 39, 144, 34, 67, 129, 140, 51, 200, 170, 204, 8, 1, 168, 104, 4, 153, 33, 0, 160, 90, 7, 170, 65, 128, 204, 41, 162, 28, 53, 16, 34, 66, 130, 120, 163, 141, 3, 154, 1, 136, 169, 98, 161, 58, 5, 96, 3, 57, 22, 0, 136, 50, 251, 138, 184, 24, 160, 80, 20, 16, 49, 39, 184, 24, 128, 185, 207, 0, 152, 186, 28, 38, 185, 49, 36, 18, 9, 2, 137, 232, 156, 145, 12, 3, 154, 51, 186, 128, 25, 135, 42, 7, 139, 3, 171, 0, 24, 193, 13, 5, 156, 17, 24, 130, 104, 163, 140, 208, 139, 216, 140, 144, 171, 169, 187, 251, 140, 201, 140, 152, 154, 153, 138, 233, 156, 201, 171, 169, 187, 137, 81, 20, 81, 51, 0, 192, 155, 217, 140, 161, 73, 37, 33, 34, 1, 202, 155, 170, 57, 68, 69, 129, 33, 184, 153, 191, 8, 170, 66, 33, 118, 35, 16, 49, 176, 189, 187, 188, 170, 64, 68, 34, 52, 130, 154, 185, 189, 0, 10, 54, 1, 51, 145, 169, 174, 8, 187, 73, 3, 80, 39, 1, 82, 145, 187, 129, 237, 137, 130, 32, 38, 1, 17, 146, 219, 138, 186, 57, 4, 25, 83, 18, 136, 1, 153, 35, 252, 156, 136, 137, 136, 64, 52, 160, 170, 1, 185, 11, 67, 115, 5, 187, 186, 190, 170, 188, 41, 68, 162, 171, 34, 251, 11, 18, 25, 69, 192, 139, 129, 171, 65, 1, 82, 52, 160, 64, 4, 153, 17, 200, 96, 3, 171, 82, 130, 26, 2, 57, 71, 185, 41, 152, 24, 218, 41, 4, 137, 136, 24, 18, 168, 141, 36, 217, 186, 155, 200, 158, 33, 153, 55, 200, 9, 192, 173, 136, 203, 26, 129, 8, 18, 49, 19, 138, 131, 207, 201, 189, 137, 152, 40, 84, 19, 33, 1, 202, 203, 154, 169, 113, 131, 40, 194, 175, 152, 203, 32, 129, 83, 36, 128, 138, 184, 206, 138, 185, 153, 8, 8, 80, 4, 11, 36, 235, 136, 202, 41, 160, 97, 2, 9, 160, 156, 218, 26, 2, 97, 53, 18, 19, 17, 176, 141, 168, 189, 153, 24, 68, 52, 35, 68, 129, 41, 192, 157, 152, 139, 18, 8, 70, 160, 48, 145, 12, 19, 153, 32, 67, 130, 25, 2, 32, 184, 251, 174, 82, 2, 64, 71, 130, 32, 160, 156, 234, 171, 1, 128, 115, 3, 16, 2, 155, 152, 187, 9, 18, 24, 69, 144, 48, 129, 24, 218, 154, 223, 8, 17, 99, 2, 49, 146, 188, 185, 206, 137, 0, 50, 34, 55, 128, 207, 8, 40, 0, 0, 203, 153, 155, 1, 25, 68, 1, 66, 53, 18, 25, 161, 175, 169, 8, 250, 25, 130, 136, 185, 41, 249, 171, 17, 33, 83, 128, 114, 193, 141, 128, 9, 2, 172, 65, 129, 33, 17, 53, 184, 27, 225, 141, 129, 138, 4, 10, 4, 155, 160, 175, 128, 170, 65, 52, 52, 144, 188, 188, 188, 138, 153, 97, 130, 64, 130, 9, 168, 187, 115, 200, 104, 177, 11, 193, 138, 144, 139, 34, 161, 171, 0, 16, 65, 71, 0, 83, 208, 10, 163, 159, 1, 136, 34, 16, 50, 146, 189, 16, 186, 32, 50, 55, 33, 55, 184, 9, 249, 138, 202, 27, 147, 27, 87, 129, 8, 0, 34, 168, 16, 251, 26, 185, 57, 161, 27, 5, 156, 33, 168, 113, 131, 56, 149, 140, 178, 14, 130, 28, 147, 141, 4, 156, 50, 217, 24, 160, 41, 147, 104, 131, 41, 163, 158, 128, 155, 1, 155, 130, 142, 67, 1, 17, 1, 201, 56, 2, 160, 223, 0, 218, 10, 145, 173, 0, 40, 55, 0, 83, 144, 25, 162, 157, 200, 138, 168, 42, 178, 29, 6, 138, 35, 25, 71, 170, 17, 221, 25, 168, 26, 129, 24, 146, 154, 9, 97, 35, 84, 20, 152, 128, 170, 219, 11, 160, 59, 7, 24, 34, 83, 129, 115, 145, 171, 204, 137, 168, 25, 17, 97, 35, 185, 171, 170, 0, 137, 116, 20, 128, 168, 206, 9, 146, 41, 39, 152, 136, 204, 32, 52, 129, 10, 145, 189, 8, 169, 40, 17, 85, 34, 17, 234, 140, 1, 128, 128, 8, 185, 141, 19, 32, 54, 18, 51, 201, 25, 216, 43, 37, 129, 236, 25, 145, 172, 128, 138, 53, 67, 38, 184, 73, 147, 157, 129, 188, 8, 154, 70, 184, 48, 4, 0, 153, 66, 168, 98, 34, 232, 11, 1, 154, 152, 157, 34, 170, 115, 5, 153, 24, 129, 56, 149, 190, 10, 33, 34, 1, 16, 144, 156, 32, 145, 175, 114, 2, 128, 24, 131, 174, 33, 185, 185, 28, 87, 184, 138, 152, 40, 67, 36, 201, 10, 216, 41, 192, 73, 4, 137, 16, 17, 186, 250, 13, 34, 137, 128, 41, 5, 154, 50, 168, 49, 136, 209, 255, 41, 18, 0, 129, 153, 169, 12, 20, 40, 6, 155, 160, 174, 24, 1, 138, 86, 1, 0, 235, 9, 1, 152, 56, 193, 11, 2, 50, 170, 69, 201, 16, 202, 9, 17, 185, 97, 161, 88, 2, 0, 169, 208, 175, 17, 17, 34, 67, 176, 72, 225, 140, 18, 184, 138, 129, 49, 144, 114, 133, 188, 40, 144, 26, 21, 186, 105, 3, 187, 153, 170, 49, 217, 121, 20, 169, 32, 178, 158, 1, 169, 24, 144, 40, 51, 83, 68, 130, 137, 177, 191, 188, 48, 178, 75, 22, 48, 147, 42, 149, 143, 129, 203, 25, 0, 136, 49, 216, 57, 133, 10, 20, 153, 33, 202, 56, 194, 157, 0, 170, 153, 137, 52, 152, 117, 176, 73, 21, 171, 136, 138, 129, 157, 66, 129, 67, 35, 2, 43, 0, 145, 171, 170, 128, 239, 48, 3, 8, 1, 184, 25, 208, 140, 34, 169, 26, 3, 141, 71, 160, 9, 0, 144, 187, 82, 192, 26, 162, 10, 145, 188, 112, 22, 16, 1, 185, 206, 40, 131, 170, 50, 131, 152, 249, 12, 36, 234, 72, 129, 32, 184, 41, 192, 10, 161, 73, 21, 48, 133, 219, 8, 186, 59, 37, 24, 67, 17, 160, 206, 153, 168, 42, 71, 161, 10, 144, 172, 64, 19, 136, 0, 202, 11, 160, 90, 71, 152, 16, 201, 11, 18, 219, 80, 146, 10, 18, 219, 40, 36, 185, 57, 225, 140, 51, 144, 9, 36, 202, 49, 131, 204, 26, 22, 169, 9, 17, 67, 178, 223, 32, 17, 17, 153, 0, 221, 56, 130, 138, 203, 72, 4, 32, 19, 184, 189, 40, 192, 142, 66, 33, 145, 156, 130, 174, 99, 129, 25, 144, 41, 179, 191, 33, 145, 138, 68, 168, 9, 144, 171, 24, 32, 55, 136, 67, 217, 139, 50, 132, 202, 138, 33, 238, 89, 4, 169, 17, 184, 25, 1, 170, 40, 2, 33, 251, 57, 149, 171, 66, 192, 59, 55, 184, 12, 50, 201, 25, 177, 15, 51, 168, 34, 250, 28, 19, 168, 64, 146, 173, 33, 8, 17, 137, 2, 172, 8, 128, 191, 82, 233, 80, 130, 9, 128, 32, 176, 42, 210, 158, 0, 153, 67, 161, 56, 6, 203, 41, 52, 208, 138, 34, 145, 189, 32, 249, 10, 82, 130, 139, 51, 185, 138, 52, 184, 56, 249, 41, 3, 136, 0, 40, 18, 204, 9, 24, 146, 239, 32, 17, 19, 138, 176, 44, 134, 156, 18, 153, 16, 64, 22, 153, 184, 140, 51, 168, 219, 59, 23, 187, 52, 154, 21, 219, 48, 176, 41, 19, 168, 218, 173, 98, 144, 56, 178, 30, 20, 186, 185, 58, 39, 185, 41, 51, 184, 204, 24, 18, 65, 3, 204, 32, 160, 42, 210, 158, 0, 72, 21, 8, 200, 11, 19, 0, 160, 41, 2, 205, 73, 132, 138, 162, 43, 133, 172, 170, 120, 5, 137, 35, 202, 9, 152, 152, 57, 5, 173, 33, 128, 128, 114, 147, 142, 129, 10, 161, 75, 133, 157, 18, 137, 34, 170, 65, 144, 168, 171, 66, 83, 35, 177, 174, 144, 28, 133, 172, 169, 113, 147, 41, 177, 139, 160, 73, 36, 0, 218, 139, 34, 192, 27, 38, 168, 24, 192, 90, 148, 59, 149, 26, 210, 11, 193, 75, 148, 28, 4, 172, 66, 128, 48, 2, 203, 25, 217, 25, 184, 40, 131, 72, 2, 83, 176, 97, 232, 41, 232, 42, 131, 140, 50, 160, 25, 129, 155, 115, 161, 139, 69, 1, 152, 250, 171, 50, 200, 41, 3, 136, 56, 71, 152, 0, 136, 208, 143, 17, 153, 0, 10, 53, 128, 68, 184, 153, 170, 152, 154, 65, 136, 50, 250, 88, 178, 142, 50, 145, 138, 17, 128, 83, 176, 156, 203, 137, 9, 55, 0, 1, 26, 23, 186, 16, 16, 20, 251, 42, 193, 141, 66, 129, 185, 27, 51, 186, 195, 251, 47, 0, 113, 146, 139, 84, 177, 173, 32, 160, 11, 129, 56, 22, 40, 3, 171, 67, 217, 170, 187, 25, 0, 82, 52, 2, 153, 8, 144, 255, 42, 20, 136, 16, 185, 12, 35, 152, 160, 175, 114, 19, 202, 48, 208, 57, 179, 27, 192, 41, 184, 64, 177, 112, 133, 170, 24, 0, 160, 155, 67, 200, 41, 21, 218, 56, 249, 74, 4, 8, 144, 10, 162, 60, 6, 156, 2, 170, 17, 32, 5, 189, 32, 160, 8, 136, 33, 18, 50, 248, 139, 65, 3, 175, 65, 161, 153, 187, 139, 114, 146, 139, 35, 20, 235, 97, 144, 56, 216, 25, 145, 43, 193, 28, 3, 11, 35, 84, 178, 159, 50, 160, 154, 153, 24, 53, 161, 139, 67, 145, 204, 173, 48, 34, 36, 201, 9, 200, 43, 54, 176, 11, 161, 59, 23, 174, 33, 152, 40, 0, 33, 168, 144, 190, 50, 1, 128, 24, 137, 103, 219, 81, 177, 58, 130, 138, 152, 25, 176, 141, 2, 171, 98, 18, 0, 114, 162, 156, 144, 10, 133, 173, 2, 188, 68, 144, 99, 184, 26, 144, 9, 34, 219, 32, 203, 84, 201, 32, 136, 83, 185, 152, 137, 2, 9, 146, 11, 23, 172, 50, 216, 26, 34, 19, 203, 98, 160, 137, 190, 81, 2, 152, 140, 35, 170, 114, 130, 170, 0, 169, 154, 156, 17, 64, 6, 156, 19, 207, 49, 130, 57, 3, 187, 171, 114, 177, 141, 17, 0, 200, 80, 132, 154, 16, 169, 154, 64, 18, 169, 139, 67, 128, 97, 194, 191, 33, 129, 48, 161, 153, 169, 97, 208, 88, 146, 10, 18, 24, 2, 205, 24, 216, 58, 6, 186, 171, 96, 37, 184, 9, 129, 153, 137, 67, 216, 58, 3, 156, 129, 97, 147, 157, 19, 205, 57, 19, 186, 112, 132, 156, 17, 152, 137, 9, 146, 43, 87, 186, 11, 18, 16, 51, 185, 170, 139, 54, 184, 57, 210, 175, 16, 128, 33, 0, 84, 192, 9, 161, 96, 131, 10, 217, 25, 144, 0, 154, 34, 32, 164, 29, 132, 140, 132, 157, 32, 32, 21, 203, 136, 11, 71, 201, 25, 152, 49, 200, 99, 160, 16, 189, 40, 144, 33, 153, 66, 201, 88, 162, 12, 19, 169, 8, 66, 240, 11, 2, 49, 176, 40, 192, 40, 168, 138, 86, 225, 140, 34, 8, 8, 129, 217, 57, 7, 137, 130, 172, 17, 168, 24, 129, 189, 96, 20, 168, 24, 130, 204, 9, 51, 128, 136, 251, 140, 50, 32, 132, 156, 83, 144, 56, 145, 154, 186, 88, 209, 12, 1, 153, 0, 41, 55, 176, 156, 65, 194, 140, 34, 128, 224, 13, 18, 24, 35, 8, 152, 186, 172, 18, 10, 119, 128, 152, 137, 145, 25, 201, 57, 146, 139, 218, 27, 103, 18, 152, 138, 1, 185, 144, 174, 0, 191, 99, 144, 16, 17, 33, 168, 153, 235, 26, 20, 137, 32, 186, 112, 148, 10, 129, 189, 16, 144, 114, 34, 152, 172, 41, 160, 25, 1, 187, 72, 55, 200, 155, 201, 252, 50, 0, 186, 80, 36, 1, 201, 155, 17, 66, 129, 81, 146, 175, 40, 144, 170, 203, 96, 161, 40, 129, 117, 161, 10, 152, 8, 186, 48, 1, 66, 232, 140, 49, 36, 200, 139, 18, 144, 187, 97, 146, 139, 38, 168, 82, 145, 187, 174, 65, 161, 139, 34, 17, 129, 138, 226, 143, 20, 154, 20, 154, 2, 174, 16, 8, 161, 11, 38, 169, 32, 50, 23, 202, 9, 2, 186, 154, 24, 0, 24, 119, 146, 139, 4, 235, 40, 35, 233, 138, 17, 8, 99, 129, 171, 153, 153, 66, 20, 169, 25, 192, 59, 179, 31, 5, 158, 33, 17, 19, 185, 10, 145, 173, 99, 216, 10, 19, 128, 138, 16, 187, 100, 161, 25, 200, 42, 3, 168, 172, 185, 10, 103, 19, 160, 186, 72, 132, 41, 149, 158, 128, 42, 133, 155, 67, 153, 136, 170, 96, 130, 11, 145, 174, 17, 136, 81, 131, 170, 50, 251, 10, 32, 21, 169, 136, 32, 2, 174, 65, 160, 26, 130, 73, 194, 159, 128, 10, 70, 145, 170, 137, 160, 58, 87, 144, 154, 152, 152, 96, 131, 137, 168, 155, 84, 2, 153, 171, 138, 170, 113, 3, 170, 49, 248, 11, 53, 136, 1, 137, 136, 24, 18, 130, 237, 153, 185, 88, 36, 234, 139, 53, 144, 154, 51, 216, 42, 19, 154, 32, 217, 42, 131, 42, 195, 207, 98, 129, 10, 1, 137, 2, 9, 130, 191, 128, 26, 38, 172, 52, 186, 67, 235, 32, 168, 48, 193, 26, 20, 26, 21, 219, 9, 16, 131, 158, 51, 169, 154, 85, 161, 9, 168, 11, 17, 1, 66, 194, 191, 49, 192, 139, 51, 161, 74, 22, 186, 65, 176, 28, 2, 32, 146, 173, 49, 130, 222, 41, 4, 154, 145, 174, 114, 130, 153, 17, 145, 155, 16, 16, 1, 189, 33, 249, 57, 178, 28, 23, 170, 65, 128, 24, 200, 137, 1, 217, 139, 83, 130, 49, 179, 175, 51, 144, 41, 146, 190, 171, 65, 36, 184, 42, 22, 153, 185, 28, 20, 188, 138, 68, 161, 139, 18, 8, 55, 177, 175, 48, 145, 56, 210, 157, 129, 24, 4, 138, 35, 219, 40, 18, 33, 145, 9, 1, 33, 179, 255, 24, 233, 58, 23, 168, 154, 32, 1, 16, 155, 131, 143, 37, 170, 16, 136, 169, 40, 133, 155, 50, 201, 112, 21, 153, 153, 137, 136, 152, 173, 114, 146, 10, 1, 152, 185, 72, 131, 156, 66, 131, 173, 1, 171, 162, 191, 87, 128, 169, 24, 161, 74, 4, 10, 4, 219, 9, 17, 144, 40, 162, 28, 130, 42, 148, 156, 144, 140, 115, 50, 200, 158, 0, 155, 83, 130, 0, 218, 40, 2, 0, 160, 189, 25, 55, 168, 72, 162, 159, 0, 8, 50, 2, 169, 186, 235, 41, 37, 128, 24, 200, 142, 83, 160, 26, 146, 157, 50, 130, 24, 19, 202, 155, 34, 184, 154, 144, 191, 115, 194, 27, 20, 169, 138, 81, 132, 203, 11, 84, 177, 140, 128, 56, 22, 8, 160, 188, 26, 249, 55, 0, 56, 35, 19, 250, 139, 17, 16, 33, 6, 221, 41, 3, 154, 81, 145, 154, 24, 145, 175, 49, 145, 136, 154, 116, 130, 170, 136, 201, 42, 53, 2, 169, 171, 41, 147, 42, 211, 159, 52, 185, 42, 148, 10, 38, 136, 144, 220, 10, 83, 2, 154, 0, 137, 83, 176, 11, 129, 172, 66, 128, 81, 232, 26, 147, 175, 81, 130, 155, 32, 200, 58, 6, 170, 32, 152, 81, 162, 173, 1, 186, 113, 132, 154, 136, 9, 66, 129, 0, 217, 43, 21, 186, 24, 202, 42, 37, 168, 27, 83, 176, 140, 36, 17, 184, 28, 18, 185, 26, 71, 234, 41, 130, 154, 10, 49, 3, 64, 71, 193, 174, 48, 130, 10, 33, 152, 203, 9, 152, 64, 177, 43, 5, 136, 184, 44, 38, 0, 168, 43, 5, 171, 129, 220, 10, 53, 145, 24, 1, 136, 184, 223, 24, 17, 66, 2, 186, 172, 48, 130, 115, 178, 26, 233, 25, 138, 71, 185, 48, 201, 40, 34, 147, 173, 168, 11, 39, 128, 169, 141, 69, 144, 187, 8, 34, 217, 10, 84, 2, 188, 8, 152, 65, 130, 173, 32, 35, 17, 169, 137, 205, 48, 35, 67, 249, 155, 16, 1, 144, 56, 22, 219, 27, 36, 0, 130, 189, 32, 193, 140, 33, 19, 189, 56, 3, 139, 84, 161, 12, 36, 219, 40, 145, 153, 24, 147, 159, 52, 186, 32, 1, 50, 218, 8, 236, 40, 129, 99, 177, 156, 137, 24, 66, 67, 3, 203, 136, 27, 71, 186, 186, 73, 5, 140, 0, 154, 128, 24, 66, 146, 139, 53, 1, 176, 191, 33, 146, 26, 135, 174, 1, 25, 38, 137, 3, 158, 17, 154, 18, 203, 33, 202, 56, 3, 98, 3, 202, 137, 168, 172, 16, 33, 37, 185, 26, 52, 35, 35, 251, 141, 217, 42, 19, 137, 49, 168, 26, 35, 128, 116, 178, 142, 16, 33, 129, 251, 156, 82, 162, 139, 136, 137, 65, 55, 168, 9, 186, 0, 172, 67, 202, 32, 153, 116, 129, 32, 131, 203, 154, 128, 203, 49, 3, 48, 250, 141, 1, 152, 0, 17, 1, 48, 146, 80, 224, 42, 248, 27, 145, 115, 130, 136, 186, 66, 137, 69, 161, 138, 168, 155, 184, 175, 114, 130, 171, 153, 80, 2, 40, 148, 157, 34, 144, 218, 156, 17, 9, 68, 144, 16, 1, 34, 160, 204, 187, 49, 146, 170, 113, 177, 105, 132, 154, 145, 188, 138, 114, 51, 168, 170, 172, 41, 35, 33, 201, 11, 116, 3, 204, 26, 144, 25, 68, 130, 201, 26, 129, 136, 17, 53, 161, 207, 26, 35, 144, 186, 137, 156, 68, 128, 36, 154, 177, 31, 39, 137, 128, 139, 18, 170, 50, 168, 170, 174, 48, 69, 147, 206, 8, 0, 0, 0, 33, 4, 152, 169, 174, 33, 131, 220, 9, 34, 2, 217, 170, 72, 5, 25, 144, 114, 195, 43, 147, 25, 209, 11, 193, 43, 6, 9, 21, 201, 138, 66, 130, 138, 129, 189, 41, 33, 19, 40, 241, 17, 1, 52, 0, 142, 66, 18, 217, 156, 16, 16, 36, 144, 169, 186, 9, 70, 131, 155, 144, 174, 33, 200, 48, 163, 142, 16, 50, 146, 153, 204, 8, 66, 20, 154, 0, 24, 192, 120, 147, 28, 20, 155, 17, 220, 8, 168, 25, 0, 32, 84, 18, 9, 129, 236, 153, 8, 52, 249, 154, 8, 66, 144, 65, 147, 152, 187, 9, 65, 147, 40, 255, 72, 193, 56, 161, 48, 176, 153, 11, 39, 154, 1, 188, 64, 145, 49, 192, 12, 2, 57, 7, 9, 130, 174, 153, 56, 38, 144, 156, 128, 8, 83, 2, 219, 171, 8, 99, 162, 171, 129, 187, 98, 3, 201, 10, 130, 64, 22, 152, 144, 172, 48, 160, 155, 82, 193, 44, 55, 201, 24, 144, 139, 33, 52, 146, 203, 136, 24, 50, 69, 217, 155, 128, 136, 168, 56, 6, 169, 137, 66, 145, 48, 251, 121, 2, 170, 10, 2, 155, 8, 18, 255, 58, 22, 152, 129, 169, 16, 1, 18, 200, 173, 32, 2, 154, 80, 148, 140, 36, 153, 18, 219, 152, 56, 23, 152, 153, 0, 168, 10, 169, 10, 71, 176, 172, 170, 81, 19, 67, 161, 138, 8, 67, 250, 153, 201, 41, 3, 136, 81, 39, 168, 153, 10, 144, 112, 23, 168, 186, 137, 16, 130, 170, 82, 216, 9, 17, 1, 153, 187, 139, 116, 38, 152, 169, 173, 48, 1, 50, 232, 10, 0, 82, 145, 83, 234, 26, 144, 8, 129, 136, 0, 33, 160, 26, 3, 43, 55, 136, 249, 143, 16, 50, 177, 59, 133, 154, 169, 26, 53, 184, 173, 9, 67, 1, 32, 201, 57, 177, 58, 135, 172, 0, 128, 200, 25, 176, 120, 19, 1, 136, 85, 176, 173, 8, 35, 177, 191, 136, 24, 99, 34, 1, 137, 0, 152, 170, 56, 249, 159, 128, 10, 129, 154, 35, 152, 82, 67, 145, 26, 37, 25, 87, 129, 160, 174, 8, 8, 51, 217, 153, 185, 9, 144, 72, 23, 136, 169, 27, 71, 129, 128, 168, 171, 171, 96, 35, 0, 170, 40, 144, 154, 203, 114, 147, 8, 234, 42, 146, 73, 7, 169, 217, 156, 17, 40, 54, 184, 137, 185, 121, 3, 156, 33, 186, 0, 152, 67, 144, 82, 176, 172, 137, 86, 145, 26, 129, 9, 130, 203, 154, 65, 18, 146, 223, 154, 16, 100, 1, 152, 186, 139, 18, 40, 132, 157, 53, 18, 34, 217, 9, 217, 171, 138, 83, 147, 10, 2, 169, 137, 26, 103, 131, 219, 154, 136, 9, 0, 114, 3, 8, 184, 158, 136, 138, 33, 82, 22, 168, 8, 170, 64, 2, 1, 250, 158, 17, 49, 35, 128, 144, 154, 50, 146, 8, 200, 239, 9, 1, 136, 0, 202, 187, 139, 117, 19, 18, 200, 139, 34, 17, 160, 206, 203, 10, 69, 129, 153, 8, 17, 68, 19, 234, 171, 153, 65, 20, 185, 138, 170, 89, 37, 1, 128, 203, 41, 19, 152, 202, 189, 139, 24, 85, 131, 153, 49, 145, 26, 55, 144, 66, 192, 171, 235, 139, 230, 247, 53, 0, 8, 16, 128, 136, 41, 119, 131, 152, 185, 139, 21, 169, 0, 188, 136, 57, 7, 11, 20, 8, 233, 42, 5, 9, 18, 136, 153, 48, 163, 121, 179, 175, 2, 137, 18, 186, 8, 203, 73, 19, 35, 161, 156, 33, 128, 114, 147, 171, 152, 154, 202, 116, 55, 186, 170, 154, 50, 67, 162, 191, 24, 128, 83, 145, 138, 249, 171, 128, 8, 65, 18, 153, 185, 27, 87, 17, 17, 200, 138, 67, 51, 129, 170, 190, 26, 129, 25, 2, 169, 136, 67, 144, 152, 140, 119, 4, 169, 136, 152, 172, 32, 185, 10, 169, 220, 206, 57, 39, 144, 32, 1, 137, 128, 188, 128, 139, 4, 141, 70, 152, 48, 145, 25, 169, 66, 251, 27, 160, 41, 130, 26, 20, 203, 0, 154, 86, 128, 129, 205, 48, 35, 168, 56, 133, 56, 208, 10, 153, 66, 0, 132, 207, 16, 0, 16, 33, 208, 156, 136, 136, 10, 129, 157, 67, 8, 68, 176, 157, 17, 172, 98, 1, 128, 169, 136, 9, 67, 176, 25, 132, 188, 49, 20, 128, 139, 54, 176, 74, 37, 153, 50, 200, 157, 152, 236, 188, 137, 50, 131, 9, 51, 161, 121, 38, 184, 170, 203, 41, 2, 48, 19, 136, 66, 82, 52, 1, 185, 223, 10, 50, 144, 16, 17, 144, 11, 38, 187, 128, 239, 136, 128, 34, 18, 17, 187, 40, 1, 117, 2, 137, 202, 157, 49, 145, 136, 185, 155, 8, 98, 3, 8, 177, 143, 54, 192, 11, 136, 24, 152, 72, 147, 73, 148, 174, 144, 16, 194, 13, 51, 137, 33, 2, 186, 56, 250, 41, 148, 10, 35, 26, 119, 129, 137, 136, 169, 188, 10, 130, 141, 34, 17, 33, 1, 144, 188, 139, 48, 36, 237, 138, 1, 202, 10, 70, 144, 40, 160, 112, 20, 8, 4, 170, 137, 171, 48, 17, 48, 51, 19, 154, 1, 223, 9, 233, 11, 52, 128, 40, 129, 9, 208, 157, 249, 174, 16, 1, 16, 152, 16, 129, 98, 18, 50, 184, 156, 152, 56, 22, 24, 177, 223, 154, 153, 136, 24, 69, 129, 0, 185, 41, 70, 129, 170, 138, 137, 116, 52, 144, 154, 187, 10, 36, 130, 187, 82, 129, 8, 152, 0, 136, 251, 157, 16, 2, 217, 189, 172, 32, 36, 2, 217, 155, 66, 53, 35, 1, 187, 140, 136, 8, 69, 2, 136, 234, 155, 66, 84, 2, 154, 169, 138, 17, 136, 233, 172, 169, 41, 146, 189, 137, 137, 115, 55, 19, 152, 186, 190, 10, 17, 18, 251, 139, 16, 2, 65, 22, 168, 8, 136, 8, 0, 169, 137, 161, 175, 128, 172, 114, 51, 34, 128, 32, 51, 130, 187, 100, 193, 173, 153, 40, 38, 128, 154, 169, 25, 68, 161, 156, 169, 206, 9, 152, 137, 169, 138, 16, 53, 66, 3, 9, 146, 106, 87, 144, 154, 153, 9, 32, 129, 204, 139, 66, 69, 34, 17, 2, 219, 72, 20, 128, 219, 204, 187, 26, 52, 128, 136, 33, 84, 1, 64, 3, 188, 11, 47, 0, 171, 32, 201, 173, 155, 154, 50, 160, 156, 154, 80, 2, 9, 69, 146, 153, 168, 204, 24, 51, 146, 175, 154, 41, 87, 129, 0, 136, 33, 169, 187, 141, 192, 141, 3, 171, 55, 152, 82, 128, 25, 131, 188, 136, 217, 25, 131, 205, 170, 56, 19, 48, 37, 136, 34, 129, 137, 117, 38, 185, 188, 138, 136, 9, 51, 184, 72, 50, 20, 202, 25, 115, 20, 1, 144, 157, 34, 185, 169, 175, 49, 152, 81, 3, 168, 8, 202, 137, 220, 138, 153, 17, 129, 32, 115, 22, 152, 41, 3, 9, 21, 170, 49, 18, 193, 173, 184, 156, 187, 52, 186, 71, 201, 9, 136, 3, 154, 18, 203, 203, 26, 130, 137, 0, 24, 71, 17, 115, 145, 140, 18, 138, 55, 169, 0, 190, 32, 170, 83, 160, 24, 16, 36, 217, 25, 201, 154, 218, 9, 160, 171, 169, 139, 119, 34, 32, 36, 170, 16, 170, 81, 145, 138, 216, 11, 200, 42, 23, 138, 18, 8, 18, 139, 200, 142, 34, 218, 187, 153, 154, 81, 35, 65, 18, 152, 112, 52, 145, 8, 185, 173, 138, 16, 64, 53, 168, 40, 35, 136, 83, 161, 190, 153, 218, 138, 145, 206, 153, 169, 0, 24, 49, 82, 71, 34, 18, 128, 33, 160, 170, 202, 219, 190, 25, 130, 33, 51, 53, 144, 138, 84, 35, 176, 171, 235, 140, 130, 189, 217, 141, 33, 24, 51, 0, 83, 67, 19, 144, 170, 221, 170, 186, 154, 128, 170, 8, 115, 37, 33, 37, 128, 128, 170, 8, 236, 154, 128, 186, 172, 72, 35, 69, 18, 24, 35, 136, 161, 207, 8, 168, 186, 185, 187, 32, 85, 51, 169, 114, 4, 128, 136, 32, 200, 43, 194, 175, 136, 137, 35, 153, 64, 1, 25, 34, 102, 35, 1, 129, 136, 232, 189, 136, 233, 138, 17, 0, 1, 65, 132, 203, 16, 184, 9, 237, 10, 8, 81, 35, 1, 8, 33, 130, 138, 67, 201, 56, 217, 89, 37, 128, 169, 219, 11, 168, 26, 184, 80, 217, 40, 136, 34, 172, 54, 160, 152, 139, 34, 66, 34, 86, 19, 186, 139, 200, 157, 168, 171, 82, 169, 32, 250, 9, 218, 56, 147, 26, 69, 17, 19, 219, 16, 201, 25, 136, 0, 221, 25, 2, 115, 19, 0, 34, 200, 155, 0, 139, 37, 202, 137, 204, 8, 203, 82, 161, 73, 3, 137, 0, 136, 57, 55, 130, 203, 25, 216, 56, 22, 0, 0, 168, 27, 53, 184, 202, 204, 155, 8, 35, 18, 99, 129, 40, 22, 169, 32, 249, 155, 0, 32, 152, 113, 161, 139, 161, 140, 1, 25, 50, 54, 19, 34, 218, 26, 216, 207, 154, 137, 136, 48, 54, 35, 51, 136, 16, 8, 51, 152, 235, 158, 8, 154, 17, 236, 153, 138, 84, 184, 25, 4, 64, 37, 1, 129, 186, 206, 138, 136, 154, 32, 18, 170, 114, 23, 24, 0, 16, 160, 172, 186, 173, 128, 49, 147, 174, 137, 33, 145, 40, 128, 8, 65, 37, 118, 255, 30, 0, 137, 100, 36, 51, 176, 25, 176, 28, 51, 65, 37, 160, 221, 139, 128, 205, 154, 168, 171, 137, 16, 130, 24, 69, 83, 35, 8, 66, 53, 51, 144, 171, 170, 172, 172, 48, 129, 115, 39, 18, 218, 154, 138, 32, 146, 219, 203, 10, 184, 172, 185, 142, 128, 26, 55, 33, 53, 34, 129, 186, 186, 157, 34, 144, 186, 190, 137, 56, 71, 34, 1, 170, 24, 168, 155, 200, 155, 169, 72, 209, 173, 234, 139, 67, 33, 18, 50, 23, 16, 67, 136, 0, 232, 171, 186, 139, 17, 80, 3, 221, 186, 24, 35, 82, 178, 158, 1, 24, 52, 2, 0, 48, 21, 202, 24, 153, 80, 130, 136, 238, 156, 153, 32, 18, 34, 68, 19, 152, 136, 185, 16, 251, 174, 187, 172, 136, 33, 2, 65, 70, 18, 0, 32, 130, 139, 36, 251, 154, 202, 154, 217, 171, 16, 1, 49, 54, 49, 55, 18, 144, 128, 217, 56, 176, 155, 201, 42, 35, 33, 37, 176, 155, 234, 11, 20, 218, 72, 19, 186, 138, 40, 52, 250, 11, 160, 188, 173, 138, 169, 33, 52, 103, 128, 25, 2, 40, 19, 16, 233, 156, 16, 169, 204, 137, 128, 170, 40, 129, 114, 52, 20, 129, 17, 66, 19, 184, 189, 205, 171, 8, 144, 25, 37, 8, 51, 9, 69, 128, 114, 161, 154, 129, 155, 33, 218, 202, 140, 33, 32, 36, 219, 48, 129, 137, 176, 255, 9, 19, 136, 16, 1, 17, 32, 37, 136, 36, 201, 24, 16, 82, 17, 83, 1, 8, 217, 156, 33, 145, 187, 156, 16, 240, 156, 128, 189, 40, 16, 130, 189, 99, 144, 48, 4, 16, 202, 138, 200, 26, 145, 157, 185, 157, 51, 168, 113, 20, 49, 1, 32, 160, 170, 80, 5, 187, 153, 41, 22, 0, 176, 25, 249, 172, 24, 129, 114, 22, 48, 3, 153, 235, 155, 186, 25, 168, 42, 36, 33, 52, 35, 177, 42, 23, 186, 8, 235, 171, 186, 128, 234, 171, 8, 221, 72, 3, 25, 38, 152, 154, 137, 16, 130, 170, 155, 145, 187, 103, 160, 172, 136, 82, 53, 66, 52, 129, 33, 52, 36, 18, 185, 222, 170, 185, 172, 169, 203, 155, 8, 32, 67, 50, 34, 49, 39, 33, 35, 185, 40, 128, 33, 129, 217, 223, 136, 24, 68, 17, 16, 136, 136, 203, 186, 237, 186, 219, 172, 0, 160, 26, 55, 1, 17, 50, 69, 34, 19, 152, 1, 186, 202, 189, 170, 186, 32, 20, 8, 152, 154, 81, 21, 184, 56, 176, 73, 224, 157, 169, 203, 139, 67, 144, 24, 34, 83, 54, 2, 65, 146, 171, 137, 168, 137, 251, 89, 4, 153, 49, 130, 56, 71, 50, 67, 17, 51, 200, 172, 201, 188, 188, 172, 153, 202, 137, 201, 139, 67, 18, 128, 64, 21, 0, 35, 168, 136, 221, 219, 204, 154, 8, 0, 33, 34, 0, 65, 53, 67, 52, 0, 136, 219, 189, 188, 203, 187, 154, 9, 128, 40, 69, 67, 52, 83, 51, 206, 255, 32, 0, 36, 1, 8, 128, 138, 33, 145, 251, 174, 138, 9, 49, 2, 16, 35, 84, 18, 17, 1, 50, 248, 11, 216, 189, 169, 154, 154, 49, 129, 82, 51, 66, 85, 36, 18, 1, 185, 204, 137, 1, 201, 189, 154, 129, 0, 1, 50, 70, 68, 2, 33, 176, 205, 187, 187, 170, 219, 170, 187, 186, 203, 170, 24, 51, 83, 67, 51, 69, 52, 34, 128, 128, 169, 201, 189, 9, 0, 49, 38, 168, 154, 25, 87, 18, 17, 2, 219, 138, 19, 202, 154, 200, 188, 137, 128, 65, 68, 33, 67, 70, 36, 34, 34, 144, 170, 136, 251, 172, 187, 173, 137, 152, 168, 137, 168, 25, 70, 66, 67, 51, 36, 34, 50, 2, 170, 204, 155, 40, 67, 131, 206, 10, 0, 137, 48, 20, 169, 41, 50, 100, 130, 204, 137, 128, 219, 139, 161, 205, 8, 0, 56, 39, 0, 49, 131, 137, 216, 190, 155, 170, 187, 41, 34, 232, 172, 0, 33, 34, 85, 176, 175, 153, 154, 153, 144, 10, 53, 136, 50, 36, 50, 71, 52, 20, 129, 0, 168, 172, 154, 218, 205, 187, 170, 136, 170, 56, 50, 70, 51, 130, 24, 54, 2, 0, 202, 205, 187, 169, 204, 10, 50, 19, 66, 68, 67, 51, 35, 145, 203, 187, 187, 235, 188, 173, 138, 24, 50, 36, 51, 100, 36, 33, 37, 0, 8, 153, 169, 204, 170, 203, 170, 202, 173, 138, 64, 67, 67, 18, 16, 18, 49, 2, 153, 186, 173, 235, 173, 170, 170, 154, 202, 157, 83, 35, 50, 35, 18, 200, 26, 145, 221, 186, 156, 137, 33, 144, 172, 40, 69, 68, 35, 1, 128, 186, 153, 238, 171, 170, 169, 137, 0, 186, 64, 53, 68, 17, 49, 53, 17, 0, 152, 32, 35, 201, 188, 220, 26, 18, 153, 49, 20, 160, 74, 87, 2, 136, 8, 51, 146, 173, 9, 136, 17, 1, 184, 171, 81, 86, 129, 139, 34, 184, 136, 221, 40, 130, 205, 138, 218, 172, 33, 1, 67, 18, 17, 65, 146, 12, 53, 144, 168, 186, 220, 172, 152, 169, 201, 72, 132, 171, 16, 50, 20, 82, 2, 9, 115, 51, 144, 88, 37, 8, 0, 33, 130, 170, 219, 173, 188, 154, 250, 155, 169, 171, 186, 25, 146, 11, 20, 24, 132, 27, 119, 20, 129, 8, 18, 17, 17, 33, 19, 0, 0, 24, 83, 131, 201, 154, 0, 251, 153, 156, 48, 209, 157, 49, 130, 205, 137, 203, 155, 235, 11, 18, 219, 72, 36, 152, 49, 160, 64, 162, 25, 34, 160, 191, 82, 130, 139, 83, 145, 11, 34, 9, 36, 201, 186, 190, 169, 203, 136, 0, 17, 52, 4, 8, 18, 170, 52, 176, 26, 153, 203, 138, 20, 217, 8, 136, 54, 129, 33, 17, 17, 17, 201, 172, 185, 48, 185, 186, 172, 154, 171, 49, 1, 16, 153, 66, 128, 26, 50, 19, 203, 154, 153, 0, 9, 50, 145, 49, 34, 17, 16, 35, 153, 169, 153, 0, 25, 18, 169, 0, 0, 0, 0, 0, 0, 144, 9, 17, 144, 16, 144, 9, 17, 144, 153, 16, 17, 153, 154, 9, 17, 1, 1, 17, 1, 0, 25, 16, 9, 18, 153, 17, 145, 153, 0, 144, 16, 153, 25, 0, 0, 9, 1, 0, 0, 9, 1, 144, 0, 0, 0, 0, 9, 1, 0, 0, 0, 9, 16, 145, 153, 0, 16, 1, 153, 17, 9, 1, 9, 0, 0, 1, 144, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 1, 9, 0, 0, 0, 0, 16, 0, 0, 0, 0, 9, 0, 0, 1, 9, 0, 0, 0, 0, 0, 0, 0, 0, 1, 9, 0, 1, 144, 0, 16, 0, 144, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
-static const size_t audio_five_sample_data_length = sizeof(audio_five_sample_data) / sizeof(audio_five_sample_data[0]);
+static const size_t audio_five_sample_data_length = 24439;
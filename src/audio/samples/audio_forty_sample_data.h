@@ -1,4 +1,4 @@
-// This file was generated by a script on 20-11-2024 08:37:39
+// This file was generated by a script on 17-10-2026 14:18:54
 
 #pragma once
 
@@ -6,6 +6,7 @@
 #include <stdint.h>
 #include <pico/platform/sections.h>
 
-static const int16_t __in_flash("audio_forty_sample_data") audio_forty_sample_data[] = { 205, 108, -45, -94, -76, -47, 22, 35, -149, -385, -378, -163, -69, -193, -285, -151, 80, 187, 159, 168, 299, 417, 334, 59, -189, -208, 19, 314, 423, 250, 49, 197, 630, 769, 257, -482, -756, -458, -89, -67, -299, -448, -357, -149, -61, -235, -550, -642, -310, 161, 386, 410, 458, 413, 138, -43, 139, 331, 157, -102, -42, 150, 131, 46, 192, 440, 426, 109, -155, -52, 272, 328, -95, -583, -593, -205, -19, -303, -620, -510, -215, -249, -517, -482, -110, 107, 53, 147, 491, 631, 335, -19, -5, 296, 481, 320, -43, -278, -237, -90, -34, -35, 22, 118, 170, 196, 247, 307, 324, 261, 119, 16, 81, 201, 104, -168, -251, -46, 43, -257, -614, -515, -5, 386, 318, -43, -349, -398, -133, 305, 546, 411, 213, 196, 88, -261, -398, -57, 249, 56, -345, -521, -498, -359, -23, 302, 188, -316, -635, -475, -193, -184, -308, -176, 253, 665, 819, 736, 557, 433, 414, 320, -29, -432, -510, -323, -281, -423, -334, 92, 380, 219, -3, 143, 364, 113, -444, -649, -397, -205, -288, -298, -53, 139, 73, -7, 152, 382, 384, 226, 235, 423, 423, 94, -170, 4, 377, 395, 18, -178, 125, 408, 20, -703, -774, -14, 596, 320, -358, -600, -352, -104, -34, 77, 328, 496, 337, -9, -89, 212, 365, 14, -313, -38, 432, 386, -51, -300, -247, -52, 230, 335, -32, -464, -299, 205, 254, -163, -405, -292, -123, -31, -30, -218, -427, -257, 267, 626, 524, 201, 0, 9, 66, -39, -251, -225, 96, 197, -269, -760, -511, 280, 645, 185, -410, -417, -29, 147, 24, -118, -214, -225, 85, 597, 707, 274, -94, -57, 40, -21, -81, -137, -277, -308, -184, -202, -295, -43, 320, 95, -504, -498, 238, 777, 574, -8, -489, -695, -551, -145, 158, 119, -24, 104, 489, 746, 655, 424, 369, 443, 299, -207, -730, -727, -131, 403, 204, -454, -627, -16, 628, 631, 201, -107, -86, 153, 370, 284, -69, -221, 81, 365, 84, -499, -623, -79, 528, 602, 284, 152, 343, 353, -111, -571, -539, -328, -390, -392, 130, 697, 554, -49, -273, -45, 12, -258, -359, -38, 350, 440, 283, 65, -199, -522, -746, -732, -515, -146, 380, 841, 782, 161, -284, 67, 678, 506, -381, -917, -700, -354, -196, 153, 688, 830, 457, 101, 52, 70, -59, -307, -623, -871, -696, 36, 757, 707, 51, -239, 191, 585, 276, -464, -1014, -1025, -417, 426, 709, 228, -185, 7, 209, -134, -507, -286, 176, 241, 26, 52, 323, 424, 299, 252, 293, 173, 16, 143, 363, 255, -64, -227, -247, -180, 72, 167, -325, -802, -342, 513, 472, -284, -474, 123, 623, 574, 128, -580, -1173, -1015, -182, 438, 401, 135, 0, -159, -402, -390, 24, 415, 212, -579, -1297, -1336, -809, -264, 103, 499, 901, 980, 732, 571, 593, 323, -452, -1070, -800, 40, 489, 300, 70, 42, -188, -694, -930, -639, -190, 80, 159, 55, -104, 60, 605, 845, 207, -759, -929, -83, 710, 421, -583, -961, -195, 713, 738, 265, 170, 350, 299, 253, 443, 234, -659, -1235, -752, -30, -20, -317, -222, -71, -420, -781, -255, 953, 1592, 958, -173, -577, -116, 233, -225, -1052, -1317, -746, 84, 556, 663, 704, 663, 340, -61, -68, 299, 439, -24, -693, -854, -327, 243, 114, -482, -473, 421, 996, 298, -835, -1058, -489, -182, -347, -351, 21, 337, 326, 196, 236, 444, 495, 58, -756, -1317, -1068, -233, 364, 306, 65, 225, 609, 652, 346, 223, 465, 640, 377, -118, -405, -371, -208, -72, 33, 117, 159, 108, -79, -250, -37, 578, 897, 293, -674, -748, 298, 1134, 613, -594, -930, -87, 768, 730, 48, -603, -826, -497, 86, 252, -220, -616, -280, 308, 231, -427, -670, -125, 424, 338, 108, 425, 941, 766, -71, -602, -325, 108, -101, -746, -902, -211, 635, 794, 277, -236, -361, -337, -461, -573, -378, 6, 161, 37, 59, 435, 688, 320, -293, -231, 652, 1338, 944, -23, -346, 168, 422, -310, -1242, -1221, -351, 367, 476, 240, -155, -629, -737, -151, 567, 518, -233, -688, -314, 290, 395, 155, 135, 307, 220, -115, -164, 297, 785, 669, -38, -610, -407, 321, 684, 261, -420, -637, -269, 254, 440, 65, -653, -1184, -1175, -762, -281, 36, 59, -130, -38, 743, 1727, 1794, 582, -879, -1296, -566, 331, 628, 393, 73, 50, 546, 1346, 1674, 1015, -27, -403, -51, 87, -461, -993, -716, 13, 163, -462, -884, -371, 429, 431, -286, -718, -492, -208, -253, -291, -74, 132, 143, 159, 294, 343, 275, 417, 784, 792, 169, -379, -155, 422, 470, -60, -526, -490, 8, 528, 448, -208, -485, 115, 689, 411, -85, 6, 180, -321, -997, -961, -525, -616, -1100, -974, -123, 448, 261, -69, -131, -208, -264, 129, 659, 519, -98, -166, 413, 604, 97, -69, 605, 1026, 364, -419, -376, -279, -786, -813, 220, 765, -149, -990, -397, 667, 897, 416, -159, -427, 21, 904, 1051, 194, -462, -353, -373, -885, -921, -101, 523, 323, 143, 609, 799, -137, -1119, -547, 1082, 1804, 1094, 256, 128, 231, 146, 107, 141, -114, -616, -839, -612, -295, -32, 441, 992, 926, 111, -573, -484, -108, -123, -360, -288, 116, 381, 96, -605, -1019, -672, -93, -61, -295, 28, 731, 885, 407, 82, 115, -90, -609, -660, 43, 662, 557, 296, 491, 622, 56, -693, -888, -756, -695, -456, -21, -38, -591, -749, -35, 785, 798, 42, -700, -717, -23, 609, 545, 87, -41, 199, 294, 118, 45, 257, 521, 597, 430, 24, -485, -692, -317, 187, 74, -529, -692, -132, 341, 183, -192, -359, -396, -330, -96, -7, -288, -431, 46, 628, 513, -94, -303, 129, 565, 520, 204, -52, -205, -133, 257, 492, 57, -525, -349, 262, 231, -420, -697, -359, -81, -79, 82, 458, 577, 348, 192, 206, -17, -512, -672, -291, -35, -342, -644, -321, 292, 516, 323, 106, -57, -330, -653, -798, -742, -700, -734, -556, 57, 663, 618, 198, 280, 743, 602, 1, 175, 1087, 1272, 402, -266, -229, -199, -303, 23, 526, 425, -95, -259, -74, -145, -573, -915, -919, -745, -632, -588, -409, 1, 417, 520, 284, -57, -256, -105, 435, 927, 719, -130, -692, -341, 417, 710, 386, -1, 56, 467, 550, -141, -1000, -1056, -499, -328, -568, -308, 507, 926, 677, 510, 731, 794, 461, 214, 277, 250, 51, 161, 439, -35, -1144, -1378, -390, 86, -844, -1644, -1052, -69, 106, -89, 81, 459, 803, 1207, 1420, 1051, 407, 140, 315, 463, 279, -144, -482, -486, -270, -182, -334, -521, -628, -676, -558, -206, 28, -233, -641, -433, 409, 989, 728, 182, 173, 553, 507, -92, -434, -17, 535, 409, -155, -286, 118, 302, -97, -592, -698, -471, -148, 80, 41, -125, 18, 453, 506, -131, -758, -577, 233, 868, 996, 988, 1150, 1264, 952, 135, -881, -1361, -641, 689, 988, -116, -886, -183, 671, 239, -761, -1056, -734, -343, 71, 330, 217, 152, 372, 330, 57, 386, 1006, 620, -449, -547, 258, 280, -632, -925, -320, -242, -1078, -1425, -644, -58, -558, -878, 243, 1750, 1941, 1135, 732, 857, 816, 708, 849, 646, -411, -1469, -1354, -361, 180, -183, -579, -293, 261, 416, 272, 267, 315, 43, -461, -700, -467, -68, 130, 44, -234, -486, -407, 4, 333, 448, 717, 1081, 971, 543, 561, 783, 336, -380, -375, -127, -536, -821, 0, 938, 724, -56, -433, -717, -1178, -1161, -627, -581, -1203, -1360, -566, 192, 176, 73, 729, 1604, 1578, 777, 415, 870, 1134, 422, -645, -942, -242, 692, 1080, 806, 246, -286, -663, -725, -458, -288, -610, -1011, -747, 18, 346, -64, -477, -234, 511, 1275, 1721, 1571, 780, 0, 115, 938, 1112, -80, -1491, -1583, -581, -38, -591, -1307, -1256, -673, -266, -155, 2, 235, 197, -108, -132, 395, 900, 709, 52, -278, -88, 46, -203, -405, -218, -82, -374, -429, 435, 1403, 1193, 236, 80, 840, 1161, 578, -19, -212, -583, -1331, -1742, -1256, -228, 463, 362, -51, 18, 482, 499, -65, -396, -182, -42, -193, -82, 362, 407, -199, -775, -751, -301, 199, 563, 561, 44, -539, -444, 270, 591, -24, -788, -727, 7, 658, 870, 646, 66, -449, -379, 125, 394, 202, -134, -433, -693, -679, -158, 578, 904, 520, -227, -654, -426, 24, 82, -140, -136, -31, -225, -320, 194, 680, 321, -330, -383, -145, -174, -112, 287, 545, 565, 635, 249, -1018, -2024, -1556, -445, -114, -266, 53, 495, 294, -27, 363, 846, 289, -775, -774, 241, 602, -71, -251, 691, 1384, 911, 153, -17, 59, 99, 542, 1348, 1527, 589, -483, -486, 379, 842, 258, -781, -1458, -1588, -1360, -894, -353, 4, 183, 510, 1000, 1097, 439, -485, -916, -658, -10, 618, 766, 301, -105, 223, 864, 970, 666, 634, 840, 823, 491, -97, -747, -755, 22, 338, -515, -1297, -1121, -939, -1016, -193, 952, 319, -1406, -1323, 369, 673, -660, -987, 140, 491, -446, -755, 137, 489, -427, -952, -71, 662, -109, -1078, -608, 482, 583, -97, -529, -649, -583, 128, 1296, 1644, 629, -534, -507, 395, 806, 131, -916, -1442, -1295, -908, -774, -996, -1046, -312, 832, 1263, 674, -6, -6, 503, 1187, 1980, 2460, 1895, 455, -537, -288, 282, -46, -863, -810, 205, 891, 607, 151, 242, 394, -136, -1071, -1477, -953, 111, 1075, 1323, 672, -80, 87, 757, 536, -475, -619, 440, 897, -224, -1366, -925, 246, 336, -614, -1092, -671, -314, -343, -46, 627, 893, 682, 598, 570, 154, -359, -474, -292, 11, 392, 395, -206, -606, -298, -191, -851, -1257, -825, -675, -1371, -1563, -395, 769, 587, -45, 360, 1338, 1288, 190, -385, 155, 671, 378, 0, 218, 495, 185, -337, -483, -474, -835, -1370, -1398, -778, -56, 327, 401, 365, 388, 572, 765, 685, 454, 532, 989, 1416, 1674, 2064, 2466, 2083, 703, -519, -599, -291, -724, -1270, -762, 12, -436, -1347, -818, 731, 1080, -137, -964, -298, 680, 513, -546, -1019, -219, 748, 587, -124, -105, 68, -716, -1228, -27, 963, -358, -1768, -586, 1111, 587, -376, 468, 1490, 1186, 1089, 1617, 839, -997, -1398, -347, 95, -117, 124, 60, -1188, -2035, -920, 643, 366, -1064, -1241, -61, 305, -710, -1228, -418, 135, -471, -920, -328, 236, 12, -60, 773, 1651, 1565, 902, 542, 387, -105, -616, -376, 502, 1236, 1447, 1114, 253, -601, -687, -344, -639, -1444, -1575, -785, 89, 660, 1067, 1149, 796, 373, 19, -476, -733, -105, 883, 899, -204, -1066, -723, 219, 609, 211, -249, -102, 576, 1162, 1101, 396, -381, -733, -832, -1153, -1573, -1457, -716, -72, 24, 56, 517, 956, 658, -69, -280, 121, 286, -191, -820, -1099, -913, -235, 619, 812, 53, -549, 176, 1615, 2052, 1127, 264, 391, 638, 1, -937, -1105, -811, -1051, -1437, -616, 1138, 1705, 275, -1173, -883, 116, 50, -763, -963, -420, 150, 511, 601, 165, -555, -856, -607, -270, 56, 618, 1102, 808, -108, -529, 19, 615, 428, -80, -284, -532, -1109, -1344, -780, -9, 344, 277, -200, -993, -1354, -729, 151, 209, -425, -805, -547, 40, 692, 1248, 1396, 1029, 663, 906, 1471, 1324, 58, -1362, -1678, -827, 212, 790, 1068, 1186, 803, -123, -731, -177, 1018, 1357, 282, -1041, -1341, -824, -492, -717, -1197, -1542, -1267, -192, 824, 763, 40, -185, 136, 308, 355, 541, 489, 135, 258, 970, 1230, 667, 221, 499, 1007, 1113, 587, -570, -1764, -1919, -847, 235, 210, -631, -1251, -1137, -559, -27, 247, 472, 817, 986, 677, 248, 299, 806, 1382, 1950, 2465, 2492, 1783, 767, -136, -1004, -1845, -2305, -2231, -1834, -1220, -455, 48, -118, -745, -1221, -1205, -775, -139, 549, 1172, 1662, 1997, 2010, 1360, 117, -869, -1025, -1005, -1431, -1642, -1285, -1417, -2152, -1666, 323, 1375, 592, 55, 463, 49, -1260, -1624, -1360, -2123, -2707, -732, 2599, 3956, 2742, 1085, 460, 723, 1123, 1083, 897, 1275, 1597, 546, -924, -383, 1697, 2173, 438, -745, -96, 627, 337, 100, 574, 977, 671, -134, -960, -1389, -1521, -1924, -2295, -1404, 517, 1485, 962, 563, 677, -188, -1814, -1851, -32, 842, -553, -1809, -870, 523, 38, -1127, -848, -344, -1395, -2029, -270, 1237, 177, -247, 2656, 5012, 2753, -1248, -2244, -737, 160, -1, -69, -8, -103, 56, 431, 221, -576, -791, 60, 699, -149, -1623, -1668, 81, 1764, 1875, 1002, 333, -87, -436, -41, 1001, 907, -965, -2495, -2190, -1395, -1059, -87, 1295, 1048, -422, -375, 1319, 2258, 2033, 1990, 1807, 650, -346, -146, 233, 123, 498, 1445, 1469, 126, -1344, -2053, -2055, -1520, -844, -694, -947, -768, -162, -59, -522, -417, 612, 1231, 438, -621, -271, 1028, 1384, 433, -341, -32, 708, 988, 519, -537, -1498, -1515, -798, -593, -1322, -1729, -617, 1366, 2472, 1921, 535, -446, -448, 344, 1094, 794, -455, -1238, -796, -122, -36, 256, 1306, 1893, 982, -423, -902, -754, -1074, -1740, -1687, -700, 280, 538, 271, -46, -101, 437, 1452, 1967, 1365, 550, 685, 1447, 1768, 1438, 886, 392, 241, 575, 751, 75, -863, -922, -218, 89, -470, -1257, -1517, -1146, -741, -1014, -1728, -1727, -698, 55, -440, -1398, -1776, -1661, -1470, -1422, -1905, -2599, -2183, -742, -229, -818, -425, 708, 21, -1721, -982, 1748, 2531, 1286, 1548, 3598, 4438, 3511, 2767, 2554, 1836, 803, 241, 50, -43, 8, -22, -239, -127, 397, 638, 400, 29, -837, -2500, -3638, -2870, -1178, -558, -1100, -1483, -1424, -1571, -1684, -1002, -93, -263, -1032, -554, 1033, 1534, 695, 850, 2557, 3545, 3056, 2989, 3784, 3472, 1628, 327, 424, 394, -537, -1092, -531, -98, -814, -1732, -1742, -1530, -2071, -2490, -1441, 327, 928, 292, 85, 846, 1302, 788, 253, 212, -175, -1026, -1049, -152, -132, -1392, -1706, 198, 2455, 2940, 2061, 1381, 1227, 737, -528, -1690, -1466, -164, 234, -1042, -2071, -1178, 283, 182, -990, -1294, -575, -185, -403, -254, 501, 975, 692, 175, -118, -484, -1183, -1742, -1631, -1186, -1010, -674, 612, 1967, 1508, -396, -1212, -374, -25, -766, -776, 74, -145, -1272, -1264, -325, -244, -687, -270, 548, 1066, 2133, 3782, 4156, 2696, 1285, 1017, 803, -35, -524, -158, 40, -511, -701, 333, 1449, 1223, 258, -8, 198, -244, -1017, -946, -337, -631, -2000, -3013, -2757, -1892, -1320, -865, 57, 1131, 1446, 957, 644, 1025, 1436, 1253, 896, 919, 979, 637, 431, 1094, 2196, 2568, 1769, 448, -513, -755, -521, -286, -334, -717, -1453, -2403, -2934, -2197, -265, 1340, 1136, -309, -1141, -1053, -1367, -2026, -1375, 321, 539, -1185, -2066, -576, 1136, 935, -73, 269, 1787, 2523, 1636, 299, -94, 384, 688, 348, -195, -566, -892, -1186, -1206, -1025, -937, -833, -597, -766, -1580, -1999, -1135, 115, 441, 111, 81, 320, 329, 130, -237, -902, -1469, -1396, -923, -478, 43, 496, 280, -341, -423, -127, -392, -841, -277, 1028, 1690, 1537, 1629, 2372, 3217, 3776, 3934, 3283, 1726, 344, 367, 1316, 1498, 604, 296, 1547, 2892, 2447, 527, -1026, -1461, -1560, -1850, -1976, -1948, -2222, -2339, -1462, -341, -454, -1403, -1640, -1126, -680, -53, 904, 1169, 761, 1341, 2864, 2898, 746, -1100, -817, 490, 1215, 1252, 839, -346, -2046, -3010, -2686, -2090, -2018, -1597, 141, 2371, 3581, 3601, 3021, 1639, -734, -2764, -2818, -1470, -744, -885, -277, 1118, 1267, -169, -978, -476, -786, -2666, -3817, -2874, -1619, -1605, -1610, -218, 1420, 1441, 286, -254, 48, 212, 296, 740, 645, -634, -1682, -1339, -709, -724, -594, -137, -192, -130, 1205, 2552, 2127, 937, 638, 692, 518, 1002, 1784, 1202, 106, 1133, 3669, 4299, 2667, 2157, 4037, 5269, 3681, 1591, 1764, 2832, 2068, 257, -180, 209, -632, -2176, -2569, -2048, -1875, -1929, -1712, -1530, -1257, -241, 1038, 1391, 736, -192, -950, -1155, -871, -1239, -2479, -2627, -1075, -416, -1668, -2189, -1405, -2353, -4854, -4823, -2247, -1293, -1873, -291, 2412, 2020, -553, -944, 988, 2083, 1632, 953, 184, -767, -878, 45, 487, -339, -1096, -454, 842, 1187, 489, 26, 378, 930, 1189, 1213, 1050, 871, 1054, 1230, 385, -1325, -2341, -1987, -1384, -1443, -1513, -795, 180, 231, -932, -2325, -2760, -2227, -1750, -1713, -1281, -34, 1193, 1885, 2550, 3069, 2480, 1185, 979, 2138, 3006, 2982, 3289, 4284, 4553, 3374, 1986, 1614, 1708, 1058, -189, -707, -25, 673, 285, -527, -154, 1730, 3464, 3236, 1348, -246, -837, -1805, -3722, -4885, -4288, -3470, -3521, -3207, -1993, -1678, -2992, -3789, -2599, -1008, -718, -871, -35, 1139, 1158, 299, 92, 753, 1022, 443, 41, 496, 1223, 1499, 1260, 697, 4, -558, -922, -1219, -1261, -623, 504, 1235, 1163, 923, 1006, 733, -496, -1675, -1462, -515, -635, -1835, -2293, -1164, 389, 1041, 715, 65, -341, -265, 45, -21, -656, -1113, -688, 51, 97, -118, 715, 2327, 3000, 2412, 2114, 2810, 3416, 3234, 2968, 3132, 3152, 2457, 1332, 431, 88, 181, 435, 801, 1365, 1858, 1800, 1313, 1070, 1158, 772, -513, -1915, -2524, -2570, -2913, -3623, -3898, -3353, -2671, -2632, -2999, -3015, -2789, -3196, -4178, -4330, -2925, -1179, -471, -496, -265, 338, 1004, 1674, 2093, 1963, 1626, 1373, 789, -58, -288, -47, -416, -954, -298, 777, 502, -184, 951, 3075, 3470, 2295, 2150, 3413, 3719, 2178, 787, 906, 1196, 451, -185, 250, 431, -617, -1417, -836, -202, -587, -937, -442, 19, -182, -559, -745, -700, -307, -1, -337, -550, 280, 1125, 791, 455, 1289, 1756, 503, -888, -1012, -1118, -2018, -2255, -1159, -13, 569, 982, 838, -39, -407, 111, 132, -502, -345, 353, 33, -782, -654, -424, -1235, -1823, -1264, -1088, -1917, -2065, -1342, -1731, -3234, -3586, -2376, -1369, -1143, -842, -345, -6, 495, 1222, 1366, 651, -42, -95, 80, -17, -275, -402, -397, -354, -241, -60, 26, -103, -352, -571, -708, -658, -309, 102, 63, -471, -785, -353, 209, -68, -899, -1054, -335, 144, -76, -200, 94, 59, -500, -723, -219, 367, 618, 814, 1085, 1139, 893, 629, 568, 669, 738, 609, 375, 289, 373, 461, 651, 1130, 1553, 1417, 987, 1001, 1409, 1359, 526, -405, -764, -717, -855, -1355, -1729, -1381, -375, 501, 649, 314, 128, 301, 587, 703, 482, -88, -758, -1177, -1244, -1047, -636, -159, 29, -196, -430, -246, 227, 520, 372, -61, -402, -371, -93, -35, -467, -1092, -1402, -1301, -1095, -872, -370, 386, 848, 765, 643, 922, 1306, 1408, 1398, 1552, 1815, 2125, 2478, 2579, 2116, 1346, 757, 404, 49, -431, -1070, -1762, -2078, -1757, -1278, -1239, -1459, -1388, -1071, -956, -1051, -1014, -825, -795, -1017, -1237, -1236, -1067, -892, -778, -707, -671, -652, -535, -212, 201, 443, 476, 576, 906, 1260, 1343, 1085, 623, 216, 190, 604, 1061, 1264, 1464, 1881, 2121, 1780, 1138, 666, 311, -220, -833, -1131, -872, -185, 455, 575, 206, -154, -277, -444, -811, -1016, -739, -246, 14, 74, 291, 652, 739, 403, 24, -57, 41, 131, 359, 877, 1363, 1281, 565, -225, -492, -176, 365, 909, 1573, 2452, 3379, 4168, 4771, 5043, 4736, 3933, 3095, 2449, 1694, 651, -176, -155, 607, 1360, 1600, 1497, 1384, 1234, 835, 245, -261, -577, -809, -1004, -1125, -1303, -1729, -2239, -2464, -2486, -2816, -3553, -4132, -4078, -3543, -2944, -2562, -2478, -2588, -2770, -3110, -3644, -3971, -3717, -3200, -2870, -2511, -1805, -1154, -1011, -1019, -678, -241, -164, -247, 8, 655, 1350, 1769, 1777, 1475, 1154, 1014, 979, 926, 906, 1059, 1412, 1843, 2130, 2076, 1686, 1197, 846, 630, 389, 78, -153, -160, 9, 216, 400, 574, 674, 557, 159, -367, -694, -584, -151, 212, 272, 258, 578, 1212, 1660, 1625, 1454, 1553, 1677, 1324, 633, 205, 173, 107, -224, -586, -732, -668, -544, -486, -447, -253, 20, -39, -546, -971, -886, -671, -960, -1742, -2445, -2702, -2644, -2571, -2612, -2661, -2563, -2375, -2319, -2487, -2717, -2840, -2839, -2785, -2789, -2958, -3184, -3182, -2899, -2625, -2525, -2466, -2428, -2577, -2807, -2781, -2539, -2489, -2783, -3125, -3133, -2604, -1684, -934, -758, -806, -514, -53, 5, -297, -447, -279, 37, 440, 834, 969, 863, 894, 1196, 1490, 1592, 1630, 1692, 1689, 1592, 1493, 1392, 1170, 839, 618, 652, 871, 1216, 1730, 2255, 2438, 2202, 1887, 1718, 1608, 1507, 1445, 1306, 1087, 1135, 1644, 2257, 2609, 2791, 2985, 3203, 3509, 3886, 4004, 3777, 3777, 4390, 5104, 5316, 5211, 5204, 5198, 4939, 4515, 4091, 3672, 3293, 3060, 2979, 3021, 3130, 3118, 2908, 2801, 3008, 3152, 2882, 2550, 2597, 2772, 2686, 2519, 2525, 2455, 2068, 1600, 1322, 1160, 955, 699, 481, 459, 678, 808, 538, 175, 214, 480, 474, 291, 341, 536, 557, 527, 740, 1124, 1487, 1822, 2098, 2258, 2460, 2855, 3276, 3569, 3864, 4165, 4171, 3850, 3656, 3817, 3938, 3631, 3137, 2963, 3161, 3338, 3242, 2976, 2679, 2376, 2113, 1896, 1535, 908, 261, -105, -287, -571, -995, -1414, -1793, -2167, -2512, -2817, -3105, -3343, -3451, -3416, -3288, -3140, -3068, -3148, -3337, -3525, -3672, -3804, -3887, -3872, -3760, -3556, -3240, -2881, -2664, -2707, -2932, -3173, -3306, -3270, -3071, -2792, -2527, -2309, -2102, -1852, -1524, -1158, -895, -895, -1137, -1332, -1217, -920, -745, -671, -468, -224, -191, -265, -214, -189, -360, -474, -380, -423, -751, -964, -909, -986, -1323, -1512, -1411, -1371, -1545, -1651, -1525, -1336, -1202, -1074, -950, -945, -1062, -1159, -1214, -1366, -1624, -1797, -1831, -1887, -1956, -1854, -1636, -1564, -1632, -1572, -1370, -1282, -1347, -1340, -1194, -1098, -1154, -1231, -1220, -1191, -1223, -1238, -1132, -1007, -1080, -1281, -1219, -780, -426, -491, -650, -579, -571, -840, -989, -833, -839, -1154, -1253, -1044, -1111, -1541, -1706, -1471, -1407, -1654, -1680, -1285, -963, -1078, -1364, -1463, -1491, -1785, -2321, -2757, -2920, -2973, -3104, -3310, -3497, -3592, -3577, -3517, -3524, -3613, -3676, -3693, -3844, -4188, -4399, -4209, -3906, -3886, -3912, -3517, -2915, -2728, -2969, -3087, -2900, -2753, -2815, -2880, -2841, -2837, -2871, -2716, -2326, -2012, -1995, -2042, -1842, -1488, -1310, -1360, -1418, -1364, -1272, -1151, -938, -708, -682, -890, -1069, -1023, -900, -943, -1111, -1149, -963, -690, -449, -217, 13, 140, 131, 111, 191, 320, 387, 372, 276, 62, -211, -320, -119, 194, 250, -5, -155, 170, 744, 978, 726, 433, 416, 476, 404, 315, 279, 124, -152, -290, -228, -234, -462, -792, -1104, -1386, -1575, -1573, -1419, -1280, -1282, -1395, -1463, -1359, -1132, -973, -975, -1002, -855, -520, -176, 13, 53, 110, 313, 601, 828, 991, 1201, 1457, 1703, 2033, 2528, 2965, 3074, 2945, 2819, 2733, 2646, 2604, 2503, 2165, 1805, 1894, 2392, 2728, 2645, 2493, 2591, 2811, 2916, 2912, 2938, 3001, 2986, 2839, 2639, 2449, 2185, 1718, 1087, 511, 166, -29, -298, -707, -1100, -1389, -1642, -1831, -1806, -1729, -2063, -2844, -3489, -3637, -3712, -4260, -5141, -5786, -5964, -5932, -5949, -5957, -5732, -5212, -4566, -3932, -3278, -2522, -1690, -851, -36, 704, 1324, 1991, 2958, 4198, 5342, 6195, 7064, 8332, 9896, 11282, 12301, 13207, 14297, 15552, 16784, 17903, 18881, 19672, 20329, 21069, 21990, 22843, 23301, 23389, 23449, 23617, 23755, 23783, 23757, 23616, 23214, 22635, 22065, 21500, 20850, 20198, 19618, 18947, 17998, 16881, 15851, 14995, 14188, 13227, 11998, 10559, 9159, 7974, 6944, 5882, 4752, 3707, 2877, 2172, 1395, 518, -262, -820, -1339, -2056, -2855, -3460, -3857, -4241, -4617, -4871, -5077, -5355, -5584, -5588, -5474, -5435, -5410, -5249, -5035, -4984, -5108, -5194, -5114, -5006, -5097, -5387, -5617, -5571, -5332, -5175, -5269, -5515, -5712, -5778, -5796, -5855, -6000, -6298, -6731, -7110, -7297, -7468, -7848, -8342, -8733, -9046, -9445, -9897, -10281, -10619, -10973, -11307, -11618, -11962, -12285, -12448, -12465, -12528, -12745, -12990, -13092, -13052, -13024, -13092, -13158, -13061, -12798, -12514, -12319, -12148, -11887, -11528, -11136, -10748, -10311, -9765, -9118, -8461, -7890, -7418, -6961, -6429, -5785, -5075, -4397, -3848, -3414, -2955, -2375, -1757, -1242, -825, -371, 167, 672, 1003, 1186, 1387, 1703, 2009, 2108, 2026, 1984, 2067, 2078, 1857, 1518, 1245, 1030, 736, 362, 21, -276, -644, -1114, -1629, -2214, -2947, -3703, -4245, -4603, -5085, -5841, -6637, -7188, -7492, -7750, -8112, -8578, -9067, -9500, -9824, -10008, -10103, -10263, -10567, -10831, -10811, -10566, -10377, -10289, -10100, -9785, -9555, -9447, -9219, -8764, -8313, -8077, -7918, -7552, -6944, -6270, -5644, -5076, -4574, -4068, -3388, -2548, -1823, -1355, -953, -483, -79, 199, 516, 949, 1399, 1829, 2276, 2664, 2916, 3146, 3482, 3827, 3999, 3977, 3864, 3737, 3628, 3563, 3497, 3298, 2908, 2507, 2333, 2363, 2316, 2019, 1586, 1243, 1098, 1041, 795, 235, -347, -639, -809, -1202, -1680, -1851, -1817, -1987, -2339, -2509, -2452, -2453, -2559, -2551, -2423, -2413, -2555, -2591, -2426, -2305, -2372, -2380, -2117, -1814, -1786, -1920, -1863, -1597, -1426, -1437, -1389, -1164, -975, -959, -914, -668, -398, -314, -272, -15, 349, 465, 271, 93, 148, 257, 172, -81, -303, -375, -295, -153, -101, -182, -255, -202, -132, -197, -370, -542, -716, -941, -1198, -1432, -1639, -1836, -1991, -2063, -2080, -2120, -2194, -2224, -2163, -2103, -2166, -2307, -2354, -2244, -2117, -2106, -2171, -2174, -2006, -1639, -1195, -917, -888, -871, -599, -147, 182, 227, 103, 68, 309, 713, 967, 1028, 1206, 1635, 1982, 1984, 1848, 1859, 2023, 2235, 2420, 2414, 2148, 1941, 2172, 2677, 2908, 2697, 2486, 2669, 3101, 3444, 3634, 3711, 3606, 3422, 3524, 3945, 4172, 3919, 3627, 3795, 4257, 4555, 4632, 4739, 4907, 4946, 4822, 4674, 4538, 4357, 4227, 4260, 4271, 3989, 3591, 3531, 3828, 3969, 3649, 3206, 3080, 3173, 3056, 2583, 1954, 1347, 832, 473, 198, -258, -945, -1470, -1454, -1010, -544, -312, -302, -339, -235, 34, 270, 305, 282, 499, 1044, 1699, 2305, 2989, 3953, 5175, 6473, 7721, 8847, 9878, 10987, 12305, 13611, 14600, 15363, 16265, 17374, 18481, 19517, 20609, 21719, 22685, 23516, 24364, 25248, 26001, 26567, 27093, 27647, 28044, 28156, 28153, 28271, 28470, 28529, 28382, 28121, 27789, 27326, 26744, 26171, 25632, 25002, 24146, 23137, 22131, 21150, 20129, 19069, 18065, 17141, 16183, 15071, 13874, 12775, 11817, 10800, 9541, 8123, 6783, 5631, 4618, 3702, 2831, 1943, 1062, 364, -49, -370, -899, -1668, -2414, -2947, -3380, -3914, -4512, -4973, -5276, -5605, -6038, -6382, -6474, -6433, -6448, -6516, -6576, -6727, -7052, -7370, -7464, -7470, -7743, -8287, -8697, -8758, -8742, -8904, -9083, -9085, -9102, -9403, -9857, -10161, -10322, -10580, -10952, -11259, -11479, -11794, -12178, -12359, -12293, -12306, -12616, -13022, -13249, -13304, -13341, -13424, -13526, -13636, -13729, -13786, -13779, -13672, -13446, -13167, -12929, -12732, -12474, -12092, -11628, -11157, -10727, -10362, -10059, -9733, -9253, -8612, -7984, -7517, -7133, -6641, -5995, -5309, -4660, -4034, -3467, -3059, -2802, -2523, -2102, -1645, -1322, -1132, -960, -803, -752, -792, -771, -664, -645, -825, -1088, -1305, -1544, -1911, -2342, -2750, -3224, -3885, -4644, -5296, -5848, -6487, -7258, -7991, -8632, -9313, -10053, -10711, -11331, -12137, -13118, -13969, -14558, -15090, -15740, -16389, -16867, -17172, -17429, -17694, -17918, -18055, -18159, -18314, -18451, -18439, -18328, -18292, -18277, -18057, -17617, -17160, -16709, -16117, -15407, -14700, -13954, -13083, -12225, -11479, -10725, -9884, -9061, -8294, -7497, -6707, -6015, -5296, -4360, -3291, -2325, -1483, -653, 148, 820, 1441, 2175, 2924, 3393, 3576, 3819, 4247, 4631, 4901, 5252, 5650, 5801, 5715, 5738, 5965, 6177, 6257, 6241, 6084, 5760, 5430, 5228, 5081, 4895, 4675, 4410, 4040, 3616, 3282, 3093, 2967, 2795, 2550, 2258, 1950, 1650, 1391, 1201, 1030, 765, 393, 88, -15, -32, -141, -280, -310, -310, -429, -561, -519, -370, -337, -448, -544, -553, -526, -473, -344, -173, -72, -76, -95, -60, -29, -56, -66, 27, 159, 181, 95, 50, 117, 213, 275, 330, 366, 316, 231, 230, 308, 346, 329, 346, 395, 386, 341, 410, 619, 796, 831, 846, 989, 1228, 1490, 1787, 2056, 2133, 2054, 2096, 2346, 2572, 2614, 2584, 2597, 2616, 2633, 2738, 2958, 3196, 3323, 3283, 3151, 3089, 3124, 3084, 2872, 2611, 2397, 2164, 1918, 1801, 1806, 1742, 1601, 1618, 1829, 1884, 1575, 1262, 1354, 1630, 1569, 1216, 1037, 1081, 1047, 977, 1094, 1205, 1053, 919, 1147, 1484, 1509, 1319, 1256, 1385, 1557, 1639, 1559, 1390, 1337, 1438, 1499, 1455, 1463, 1566, 1610, 1557, 1506, 1456, 1387, 1434, 1650, 1784, 1615, 1314, 1231, 1457, 1776, 1914, 1778, 1526, 1405, 1450, 1470, 1373, 1286, 1300, 1304, 1190, 1003, 876, 901, 1054, 1140, 969, 646, 479, 534, 569, 400, 58, -388, -890, -1278, -1411, -1458, -1768, -2368, -2876, -3010, -2935, -2932, -2949, -2764, -2380, -1922, -1355, -642, 41, 479, 763, 1136, 1653, 2211, 2848, 3737, 4903, 6143, 7277, 8457, 9963, 11755, 13440, 14818, 16091, 17391, 18478, 19280, 20171, 21410, 22676, 23647, 24494, 25473, 26508, 27422, 28221, 28920, 29412, 29647, 29748, 29823, 29888, 29908, 29845, 29670, 29351, 28882, 28286, 27648, 27027, 26322, 25383, 24211, 22949, 21656, 20287, 18889, 17528, 16118, 14522, 12804, 11144, 9614, 8174, 6788, 5374, 3824, 2184, 650, -680, -1964, -3350, -4753, -5972, -6994, -7959, -8899, -9683, -10255, -10685, -11024, -11261, -11455, -11698, -11971, -12188, -12326, -12389, -12399, -12393, -12338, -12088, -11618, -11127, -10734, -10289, -9719, -9182, -8743, -8258, -7749, -7422, -7273, -7069, -6773, -6549, -6405, -6171, -5843, -5584, -5448, -5309, -5066, -4792, -4629, -4665, -4841, -5050, -5246, -5431, -5589, -5698, -5823, -6031, -6278, -6478, -6636, -6767, -6812, -6771, -6785, -6949, -7136, -7170, -7051, -6905, -6807, -6752, -6692, -6575, -6353, -6023, -5639, -5267, -4933, -4592, -4163, -3637, -3081, -2545, -2010, -1459, -936, -474, -8, 553, 1164, 1654, 1969, 2268, 2656, 3040, 3328, 3562, 3731, 3722, 3589, 3549, 3616, 3549, 3246, 2845, 2421, 1910, 1319, 735, 144, -555, -1376, -2241, -3125, -4071, -5102, -6167, -7216, -8246, -9301, -10399, -11472, -12455, -13374, -14275, -15158, -16010, -16869, -17747, -18578, -19288, -19929, -20573, -21204, -21715, -22064, -22300, -22419, -22353, -22117, -21860, -21649, -21386, -20990, -20530, -20063, -19529, -18884, -18231, -17638, -16976, -16094, -15038, -14010, -13045, -12031, -10958, -9916, -8906, -7852, -6807, -5905, -5091, -4169, -3146, -2262, -1587, -903, -58, 755, 1363, 1933, 2656, 3343, 3729, 3947, 4272, 4683, 4983, 5173, 5364, 5515, 5529, 5488, 5550, 5700, 5765, 5657, 5473, 5325, 5184, 4966, 4732, 4617, 4565, 4368, 4022, 3758, 3623, 3417, 3124, 2942, 2826, 2513, 2030, 1686, 1530, 1370, 1174, 1014, 808, 510, 299, 268, 212, -15, -264, -380, -468, -679, -943, -1093, -1136, -1230, -1448, -1676, -1786, -1813, -1868, -1956, -2003, -2044, -2173, -2325, -2344, -2256, -2238, -2333, -2467, -2651, -2885, -2998, -2909, -2852, -3020, -3235, -3249, -3127, -3070, -3075, -3024, -2928, -2868, -2831, -2739, -2592, -2474, -2409, -2305, -2080, -1807, -1610, -1453, -1197, -870, -629, -409, 12, 585, 1015, 1266, 1603, 2092, 2513, 2808, 3165, 3603, 3913, 4057, 4266, 4666, 5053, 5224, 5284, 5427, 5617, 5708, 5723, 5749, 5731, 5599, 5436, 5321, 5195, 4990, 4716, 4366, 3925, 3473, 3088, 2738, 2386, 2024, 1580, 1009, 483, 179, -34, -361, -726, -990, -1250, -1575, -1793, -1821, -1836, -1953, -2108, -2280, -2421, -2361, -2159, -2172, -2415, -2419, -2046, -1755, -1759, -1690, -1314, -901, -693, -607, -551, -514, -412, -203, -43, -64, -134, -46, 197, 417, 480, 474, 619, 931, 1103, 931, 692, 747, 967, 960, 733, 620, 669, 608, 397, 316, 447, 476, 189, -169, -262, -144, -118, -231, -262, -170, -196, -405, -508, -356, -259, -503, -863, -1027, -1127, -1391, -1652, -1661, -1582, -1704, -1851, -1617, -1014, -414, 122, 883, 1859, 2654, 3209, 3937, 4906, 5672, 6101, 6626, 7484, 8444, 9382, 10499, 11837, 13214, 14560, 15993, 17483, 18838, 20012, 21136, 22285, 23342, 24196, 24882, 25525, 26156, 26734, 27249, 27735, 28170, 28495, 28700, 28810, 28842, 28796, 28675, 28476, 28114, 27534, 26807, 26053, 25301, 24439, 23395, 22212, 20970, 19645, 18208, 16747, 15341, 13886, 12288, 10667, 9145, 7604, 5956, 4411, 3093, 1791, 338, -1089, -2344, -3584, -4925, -6233, -7427, -8616, -9811, -10856, -11682, -12421, -13128, -13610, -13755, -13753, -13822, -13889, -13800, -13633, -13520, -13373, -13103, -12834, -12651, -12390, -11938, -11402, -10871, -10268, -9561, -8834, -8123, -7361, -6547, -5777, -5109, -4501, -3890, -3287, -2749, -2293, -1901, -1559, -1245, -939, -653, -386, -79, 242, 414, 399, 430, 626, 753, 628, 437, 372, 338, 238, 144, 59, -115, -325, -452, -583, -840, -1095, -1184, -1193, -1263, -1337, -1325, -1288, -1282, -1219, -1038, -872, -850, -849, -672, -367, -145, -16, 180, 458, 666, 808, 1038, 1360, 1591, 1690, 1850, 2143, 2362, 2361, 2319, 2421, 2525, 2423, 2207, 2047, 1881, 1579, 1215, 898, 540, 19, -617, -1245, -1881, -2590, -3346, -4095, -4873, -5738, -6621, -7422, -8205, -9079, -9989, -10850, -11749, -12769, -13790, -14635, -15345, -16046, -16745, -17385, -17948, -18433, -18841, -19218, -19593, -19937, -20215, -20438, -20579, -20575, -20429, -20230, -20002, -19662, -19168, -18584, -18013, -17443, -16780, -16001, -15206, -14495, -13819, -13056, -12192, -11325, -10486, -9571, -8517, -7441, -6519, -5700, -4766, -3665, -2615, -1786, -1068, -305, 444, 1021, 1477, 1981, 2522, 2934, 3195, 3489, 3922, 4338, 4567, 4690, 4901, 5166, 5235, 4995, 4658, 4501, 4526, 4479, 4199, 3805, 3516, 3360, 3198, 2964, 2736, 2543, 2284, 1892, 1439, 1036, 691, 353, 16, -307, -650, -1052, -1454, -1740, -1881, -1977, -2139, -2388, -2649, -2823, -2863, -2846, -2920, -3153, -3430, -3584, -3590, -3579, -3663, -3791, -3832, -3747, -3628, -3562, -3532, -3493, -3478, -3531, -3586, -3536, -3404, -3337, -3407, -3482, -3405, -3214, -3107, -3182, -3309, -3316, -3242, -3257, -3364, -3376, -3224, -3109, -3209, -3357, -3256, -2925, -2684, -2663, -2609, -2315, -1954, -1761, -1620, -1281, -812, -514, -419, -207, 299, 860, 1190, 1395, 1770, 2332, 2815, 3139, 3536, 4127, 4669, 4940, 5108, 5465, 5959, 6297, 6418, 6535, 6738, 6867, 6834, 6805, 6918, 7013, 6869, 6560, 6351, 6313, 6226, 5892, 5376, 4891, 4545, 4225, 3759, 3184, 2697, 2330, 1882, 1271, 718, 443, 305, 15, -471, -939, -1253, -1512, -1834, -2167, -2402, -2602, -2913, -3320, -3600, -3598, -3431, -3346, -3408, -3432, -3262, -3002, -2875, -2889, -2874, -2751, -2592, -2430, -2255, -2142, -2127, -2033, -1662, -1111, -685, -507, -400, -153, 205, 473, 545, 554, 667, 831, 869, 805, 860, 1096, 1307, 1306, 1154, 1017, 953, 934, 928, 868, 655, 338, 170, 279, 424, 309, 20, -141, -178, -379, -815, -1210, -1405, -1630, -2061, -2445, -2459, -2240, -2139, -2141, -1887, -1227, -359, 501, 1292, 2008, 2645, 3265, 3936, 4625, 5261, 5884, 6606, 7484, 8492, 9674, 11090, 12610, 14028, 15325, 16640, 17991, 19256, 20355, 21313, 22144, 22866, 23552, 24232, 24847, 25356, 25825, 26327, 26848, 27287, 27533, 27569, 27472, 27361, 27245, 26997, 26517, 25828, 25032, 24163, 23185, 22096, 20968, 19857, 18736, 17535, 16263, 14979, 13684, 12311, 10819, 9281, 7747, 6210, 4659, 3158, 1768, 460, -841, -2127, -3322, -4397, -5419, -6482, -7587, -8651, -9608, -10432, -11139, -11744, -12236, -12604, -12846, -12966, -12957, -12824, -12626, -12431, -12241, -11998, -11698, -11391, -11071, -10662, -10133, -9555, -9008, -8473, -7875, -7194, -6461, -5705, -4961, -4298, -3712, -3095, -2410, -1793, -1345, -988, -613, -243, 75, 388, 733, 1061, 1318, 1522, 1709, 1865, 1967, 2006, 1999, 1953, 1877, 1777, 1676, 1599, 1563, 1543, 1470, 1318, 1176, 1120, 1075, 924, 731, 634, 616, 564, 490, 472, 484, 467, 457, 503, 575, 640, 721, 827, 938, 1070, 1220, 1318, 1345, 1395, 1544, 1701, 1739, 1704, 1748, 1874, 1925, 1840, 1753, 1750, 1720, 1555, 1316, 1103, 875, 563, 203, -136, -497, -966, -1551, -2179, -2795, -3420, -4090, -4795, -5507, -6222, -6949, -7684, -8420, -9154, -9902, -10651, -11399, -12156, -12908, -13603, -14216, -14782, -15328, -15814, -16200, -16523, -16837, -17133, -17363, -17514, -17587, -17608, -17603, -17577, -17486, -17255, -16894, -16450, -15959, -15429, -14870, -14301, -13698, -13022, -12277, -11540, -10884, -10277, -9611, -8824, -7988, -7171, -6348, -5481, -4645, -3894, -3139, -2273, -1360, -594, -23, 476, 1014, 1545, 1968, 2265, 2526, 2825, 3136, 3370, 3516, 3650, 3826, 4002, 4091, 4076, 4007, 3900, 3735, 3524, 3328, 3151, 2928, 2654, 2406, 2213, 2013, 1780, 1557, 1343, 1065, 697, 320, 6, -272, -580, -894, -1155, -1376, -1639, -1946, -2207, -2373, -2537, -2797, -3110, -3321, -3385, -3451, -3667, -3960, -4128, -4146, -4204, -4417, -4639, -4697, -4667, -4736, -4892, -4943, -4863, -4857, -5005, -5123, -5102, -5094, -5196, -5253, -5153, -5020, -4940, -4806, -4565, -4354, -4244, -4110, -3871, -3632, -3483, -3315, -3014, -2686, -2490, -2347, -2053, -1618, -1217, -914, -635, -317, 71, 527, 949, 1280, 1657, 2175, 2635, 2853, 3013, 3362, 3788, 4032, 4149, 4375, 4713, 4960, 5071, 5209, 5420, 5548, 5515, 5463, 5500, 5501, 5342, 5136, 5047, 5019, 4879, 4621, 4392, 4213, 3943, 3547, 3160, 2864, 2547, 2128, 1701, 1372, 1077, 701, 258, -127, -439, -789, -1236, -1663, -1924, -2068, -2320, -2804, -3368, -3727, -3802, -3814, -4016, -4371, -4682, -4863, -4930, -4859, -4712, -4691, -4837, -4876, -4649, -4382, -4257, -4081, -3659, -3187, -2948, -2873, -2657, -2210, -1770, -1604, -1668, -1641, -1337, -943, -753, -753, -705, -519, -316, -185, -100, -42, -35, -65, -88, -82, -78, -155, -390, -705, -906, -954, -1071, -1418, -1876, -2253, -2501, -2665, -2793, -2918, -3012, -2990, -2829, -2580, -2190, -1523, -679, 44, 585, 1264, 2274, 3347, 4126, 4733, 5554, 6596, 7569, 8478, 9655, 11108, 12503, 13752, 15083, 16526, 17883, 19132, 20422, 21693, 22781, 23700, 24578, 25420, 26135, 26690, 27134, 27537, 27917, 28235, 28421, 28468, 28407, 28239, 27963, 27612, 27209, 26674, 25937, 25041, 24040, 22920, 21650, 20312, 18999, 17674, 16248, 14735, 13267, 11897, 10514, 8976, 7280, 5553, 3927, 2433, 1001, -473, -1999, -3443, -4677, -5726, -6726, -7740, -8721, -9613, -10420, -11165, -11846, -12426, -12876, -13186, -13360, -13417, -13361, -13204, -12953, -12627, -12255, -11861, -11411, -10850, -10209, -9604, -9075, -8511, -7815, -7011, -6171, -5342, -4592, -3949, -3298, -2482, -1543, -668, 22, 582, 1095, 1607, 2121, 2591, 2940, 3154, 3315, 3526, 3805, 4087, 4299, 4425, 4491, 4518, 4497, 4423, 4303, 4143, 3927, 3650, 3369, 3172, 3059, 2912, 2652, 2380, 2229, 2136, 1959, 1706, 1502, 1358, 1182, 988, 889, 892, 882, 789, 678, 615, 597, 633, 774, 965, 1044, 974, 940, 1082, 1294, 1394, 1380, 1373, 1388, 1357, 1302, 1315, 1353, 1275, 1089, 929, 809, 585, 235, -95, -359, -700, -1197, -1741, -2216, -2676, -3226, -3841, -4455, -5095, -5826, -6587, -7289, -7953, -8670, -9424, -10129, -10780, -11452, -12161, -12845, -13448, -13982, -14482, -14964, -15407, -15781, -16040, -16201, -16341, -16507, -16637, -16640, -16546, -16448, -16345, -16133, -15783, -15371, -14938, -14405, -13727, -12997, -12321, -11647, -10872, -10047, -9282, -8566, -7775, -6878, -5995, -5212, -4473, -3679, -2817, -1958, -1158, -424, 271, 988, 1772, 2555, 3218, 3744, 4242, 4784, 5295, 5642, 5784, 5832, 5970, 6246, 6479, 6468, 6285, 6180, 6227, 6247, 6073, 5744, 5378, 5023, 4672, 4324, 3942, 3451, 2852, 2277, 1845, 1475, 979, 326, -322, -847, -1336, -1936, -2633, -3277, -3810, -4338, -4969, -5640, -6202, -6621, -7025, -7538, -8126, -8624, -8954, -9203, -9476, -9753, -9983, -10177, -10348, -10441, -10440, -10446, -10538, -10629, -10566, -10373, -10192, -10038, -9767, -9373, -9017, -8719, -8312, -7772, -7296, -6937, -6510, -5943, -5380, -4896, -4389, -3788, -3161, -2578, -2044, -1525, -995, -477, -41, 316, 714, 1227, 1733, 2079, 2286, 2502, 2804, 3128, 3371, 3494, 3547, 3611, 3714, 3819, 3920, 4013, 4028, 3899, 3711, 3601, 3536, 3400, 3216, 3096, 3012, 2825, 2538, 2296, 2180, 2119, 1988, 1726, 1372, 1045, 838, 731, 605, 345, -43, -419, -630, -708, -865, -1231, -1655, -1910, -2020, -2234, -2603, -2846, -2809, -2793, -3112, -3536, -3605, -3363, -3295, -3562, -3782, -3644, -3326, -3148, -3141, -3167, -3195, -3218, -3118, -2889, -2798, -3001, -3213, -3093, -2750, -2539, -2562, -2647, -2666, -2640, -2605, -2569, -2538, -2505, -2441, -2341, -2249, -2196, -2151, -2075, -2003, -2029, -2200, -2456, -2683, -2770, -2699, -2592, -2631, -2803, -2773, -2218, -1301, -535, -54, 636, 1944, 3562, 4879, 5802, 6718, 7864, 9062, 10115, 11098, 12180, 13337, 14499, 15732, 17155, 18701, 20180, 21537, 22866, 24195, 25390, 26366, 27175, 27887, 28458, 28855, 29206, 29600, 29968, 30142, 30107, 29988, 29820, 29541, 29156, 28749, 28239, 27434, 26390, 25352, 24344, 23158, 21710, 20129, 18479, 16791, 15218, 13790, 12288, 10549, 8773, 7187, 5674, 3975, 2133, 430, -1111, -2734, -4494, -6105, -7358, -8408, -9438, -10378, -11139, -11814, -12492, -13116, -13595, -13940, -14221, -14466, -14642, -14640, -14441, -14163, -13867, -13424, -12751, -12021, -11404, -10815, -10092, -9255, -8407, -7542, -6642, -5804, -5084, -4304, -3291, -2197, -1352, -762, -105, 761, 1604, 2240, 2795, 3419, 4007, 4399, 4667, 4947, 5211, 5350, 5397, 5466, 5532, 5485, 5377, 5381, 5493, 5504, 5324, 5107, 4976, 4805, 4481, 4157, 3985, 3812, 3483, 3155, 3000, 2864, 2576, 2302, 2223, 2166, 1908, 1588, 1484, 1527, 1447, 1264, 1242, 1360, 1325, 1134, 1090, 1223, 1255, 1160, 1184, 1297, 1240, 1067, 1088, 1285, 1309, 1044, 760, 664, 629, 453, 157, -116, -338, -592, -900, -1239, -1655, -2201, -2788, -3281, -3733, -4332, -5098, -5805, -6329, -6835, -7512, -8295, -8990, -9577, -10171, -10806, -11406, -11931, -12415, -12857, -13230, -13555, -13918, -14335, -14686, -14884, -15020, -15225, -15455, -15499, -15267, -14914, -14642, -14440, -14131, -13634, -13047, -12518, -12070, -11617, -11067, -10340, -9470, -8631, -7925, -7180, -6166, -5012, -4080, -3416, -2731, -1878, -995, -228, 411, 972, 1550, 2270, 3075, 3725, 4105, 4405, 4862, 5462, 5993, 6289, 6402, 6545, 6824, 7090, 7128, 6930, 6630, 6304, 5996, 5755, 5487, 5017, 4417, 3974, 3707, 3294, 2618, 1918, 1340, 713, -89, -938, -1698, -2420, -3187, -3932, -4587, -5216, -5913, -6620, -7204, -7694, -8261, -8951, -9594, -10062, -10441, -10846, -11234, -11508, -11719, -11960, -12173, -12242, -12191, -12118, -12012, -11795, -11490, -11177, -10851, -10461, -10025, -9626, -9264, -8875, -8441, -8004, -7558, -7011, -6346, -5677, -5093, -4531, -3898, -3233, -2650, -2175, -1742, -1332, -965, -602, -171, 272, 584, 737, 904, 1204, 1523, 1677, 1675, 1655, 1655, 1603, 1508, 1455, 1421, 1289, 1061, 870, 738, 526, 212, -7, -63, -213, -635, -1056, -1158, -1100, -1242, -1570, -1794, -1864, -1945, -2069, -2121, -2120, -2203, -2344, -2368, -2260, -2256, -2480, -2701, -2642, -2399, -2309, -2476, -2636, -2538, -2276, -2117, -2112, -2037, -1761, -1464, -1393, -1502, -1575, -1560, -1579, -1673, -1801, -1990, -2254, -2465, -2508, -2458, -2479, -2626, -2858, -3086, -3249, -3407, -3681, -4011, -4209, -4311, -4551, -4910, -5109, -5082, -5080, -5248, -5464, -5656, -5900, -6184, -6371, -6446, -6583, -6842, -7033, -6952, -6643, -6266, -5832, -5179, -4213, -3008, -1724, -522, 607, 1873, 3394, 4979, 6369, 7611, 8916, 10322, 11742, 13249, 14949, 16700, 18229, 19514, 20835, 22334, 23802, 25019, 25994, 26820, 27514, 28147, 28885, 29680, 30245, 30460, 30534, 30705, 30884, 30894, 30701, 30351, 29813, 29095, 28394, 27770, 26944, 25707, 24324, 23086, 21783, 20119, 18292, 16710, 15341, 13885, 12239, 10520, 8803, 7102, 5449, 3882, 2343, 755, -877, -2438, -3762, -4788, -5635, -6489, -7407, -8262, -8889, -9291, -9629, -10018, -10409, -10675, -10740, -10609, -10388, -10200, -9987, -9540, -8862, -8221, -7724, -7179, -6496, -5807, -5135, -4382, -3642, -3110, -2669, -2040, -1287, -723, -387, 4, 543, 1002, 1271, 1584, 2071, 2464, 2544, 2522, 2658, 2824, 2799, 2687, 2674, 2656, 2457, 2180, 2055, 2078, 2021, 1763, 1446, 1267, 1200, 1045, 754, 540, 542, 609, 557, 455, 475, 649, 906, 1211, 1504, 1698, 1851, 2163, 2678, 3151, 3385, 3542, 3894, 4373, 4687, 4816, 5001, 5306, 5584, 5826, 6138, 6423, 6511, 6491, 6598, 6809, 6911, 6831, 6679, 6513, 6286, 5998, 5720, 5448, 5060, 4497, 3828, 3118, 2320, 1416, 512, -321, -1216, -2342, -3628, -4775, -5604, -6302, -7205, -8348, -9402, -10134, -10734, -11470, -12291, -12971, -13493, -13992, -14487, -14934, -15381, -15847, -16183, -16271, -16253, -16361, -16550, -16535, -16184, -15645, -15093, -14544, -14009, -13518, -12970, -12185, -11209, -10308, -9599, -8875, -7938, -6893, -5943, -5069, -4125, -3154, -2339, -1699, -1095, -460, 159, 768, 1372, 1872, 2204, 2514, 2997, 3600, 4082, 4354, 4599, 4976, 5370, 5551, 5528, 5546, 5706, 5807, 5646, 5289, 4900, 4484, 4018, 3613, 3320, 2965, 2380, 1650, 992, 506, 133, -300, -951, -1757, -2436, -2860, -3246, -3797, -4407, -4868, -5188, -5532, -5997, -6541, -7056, -7450, -7727, -8025, -8460, -8990, -9422, -9616, -9626, -9622, -9709, -9831, -9858, -9718, -9441, -9108, -8772, -8435, -8120, -7870, -7641, -7322, -6960, -6767, -6741, -6615, -6282, -5997, -5943, -5929, -5713, -5348, -5029, -4814, -4639, -4463, -4270, -4053, -3800, -3503, -3191, -2953, -2805, -2650, -2420, -2211, -2120, -2097, -2097, -2193, -2417, -2643, -2763, -2846, -2997, -3166, -3240, -3217, -3214, -3308, -3416, -3392, -3235, -3122, -3149, -3202, -3149, -3072, -3095, -3174, -3181, -3154, -3227, -3348, -3310, -3111, -3000, -3067, -3059, -2789, -2432, -2201, -2051, -1914, -1861, -1839, -1639, -1311, -1210, -1442, -1646, -1530, -1309, -1327, -1527, -1600, -1544, -1642, -1969, -2304, -2525, -2713, -2943, -3285, -3809, -4378, -4696, -4737, -4841, -5168, -5499, -5678, -5902, -6367, -6935, -7358, -7647, -8065, -8811, -9812, -10764, -11297, -11256, -10930, -10782, -10843, -10592, -9616, -8159, -6716, -5424, -4107, -2679, -1192, 406, 2182, 3995, 5581, 7022, 8706, 10737, 12743, 14403, 15878, 17509, 19292, 20918, 22205, 23282, 24390, 25649, 26930, 28021, 28784, 29304, 29821, 30472, 31140, 31587, 31704, 31562, 31305, 31055, 30846, 30541, 29963, 29106, 28140, 27187, 26179, 24984, 23491, 21797, 20173, 18826, 17590, 16052, 14099, 12146, 10644, 9486, 8149, 6379, 4483, 2888, 1668, 670, -279, -1308, -2443, -3487, -4186, -4599, -5071, -5782, -6481, -6848, -6936, -7059, -7323, -7480, -7271, -6755, -6211, -5831, -5578, -5276, -4784, -4122, -3467, -2979, -2665, -2383, -1990, -1503, -1075, -824, -695, -502, -140, 238, 377, 256, 168, 327, 574, 607, 418, 242, 181, 102, -59, -170, -160, -174, -312, -412, -321, -193, -258, -439, -462, -302, -202, -281, -363, -254, 19, 349, 741, 1224, 1739, 2258, 2858, 3539, 4206, 4842, 5506, 6154, 6714, 7237, 7750, 8162, 8471, 8835, 9226, 9418, 9421, 9525, 9808, 9987, 9875, 9626, 9443, 9306, 9095, 8758, 8313, 7777, 7197, 6662, 6182, 5657, 4990, 4212, 3387, 2511, 1588, 628, -420, -1590, -2771, -3844, -4900, -6068, -7255, -8246, -9065, -9899, -10800, -11609, -12204, -12642, -13048, -13453, -13775, -13989, -14200, -14480, -14711, -14787, -14832, -14968, -15027, -14841, -14601, -14523, -14418, -13951, -13245, -12681, -12306, -11860, -11312, -10911, -10630, -10078, -9155, -8325, -7924, -7631, -6992, -6072, -5244, -4627, -4139, -3753, -3438, -3073, -2656, -2388, -2350, -2287, -1866, -1139, -541, -390, -456, -197, 578, 1464, 1959, 2021, 2041, 2325, 2810, 3205, 3304, 3188, 3115, 3205, 3327, 3351, 3303, 3205, 3055, 2978, 3031, 2901, 2319, 1638, 1360, 1306, 943, 256, -373, -836, -1243, -1587, -1880, -2290, -2825, -3288, -3668, -4202, -4938, -5627, -6087, -6417, -6828, -7419, -8119, -8741, -9143, -9343, -9474, -9626, -9781, -9872, -9870, -9806, -9704, -9569, -9407, -9251, -9136, -9068, -9009, -8844, -8493, -8046, -7670, -7376, -7025, -6560, -6021, -5436, -4925, -4700, -4710, -4590, -4205, -3818, -3562, -3269, -2925, -2708, -2519, -2127, -1728, -1706, -1926, -1931, -1739, -1822, -2277, -2625, -2539, -2337, -2442, -2757, -2936, -2965, -3041, -3132, -3078, -2995, -3167, -3584, -3901, -3859, -3599, -3522, -3862, -4375, -4601, -4405, -4132, -4146, -4380, -4471, -4245, -3904, -3732, -3748, -3696, -3392, -2946, -2606, -2448, -2369, -2275, -2120, -1859, -1539, -1337, -1347, -1450, -1481, -1402, -1224, -1027, -1049, -1492, -2101, -2280, -1929, -1793, -2541, -3707, -4221, -3917, -3760, -4447, -5511, -6154, -6305, -6451, -6839, -7375, -8036, -8865, -9651, -10117, -10409, -10940, -11717, -12295, -12407, -12217, -11969, -11682, -11185, -10205, -8572, -6553, -4762, -3489, -2242, -305, 2348, 4999, 7088, 8770, 10490, 12494, 14824, 17420, 19958, 22002, 23471, 24737, 26104, 27536, 28813, 29779, 30366, 30631, 30812, 31191, 31825, 32454, 32767, 32733, 32607, 32571, 32500, 32180, 31561, 30799, 29987, 29118, 28121, 26836, 25119, 23129, 21349, 20022, 18686, 16686, 14061, 11611, 9908, 8619, 7096, 5209, 3265, 1514, 36, -1107, -2061, -3096, -4182, -4978, -5421, -5845, -6414, -6886, -7023, -6937, -6901, -7025, -7222, -7314, -7178, -6822, -6372, -5977, -5729, -5555, -5231, -4622, -3906, -3431, -3288, -3202, -2889, -2402, -2009, -1820, -1715, -1564, -1363, -1170, -1041, -1059, -1232, -1391, -1349, -1224, -1347, -1785, -2165, -2176, -2034, -2163, -2559, -2822, -2763, -2577, -2443, -2321, -2182, -2063, -1875, -1444, -818, -278, 73, 483, 1155, 1915, 2496, 2983, 3671, 4604, 5514, 6189, 6680, 7177, 7837, 8655, 9443, 9971, 10212, 10371, 10635, 10974, 11227, 11289, 11199, 11022, 10770, 10450, 10116, 9811, 9466, 8968, 8282, 7482, 6645, 5820, 5037, 4288, 3481, 2509, 1436, 491, -219, -885, -1724, -2636, -3390, -4022, -4798, -5765, -6665, -7326, -7877, -8459, -9052, -9598, -10128, -10625, -10936, -11005, -11024, -11187, -11412, -11515, -11490, -11439, -11353, -11206, -11094, -11062, -10984, -10760, -10519, -10389, -10249, -9922, -9525, -9326, -9291, -9114, -8729, -8419, -8313, -8197, -7918, -7646, -7561, -7555, -7394, -7016, -6565, -6218, -6030, -5905, -5693, -5348, -4984, -4747, -4595, -4362, -4005, -3689, -3540, -3394, -2984, -2282, -1554, -1081, -849, -562, 43, 887, 1631, 2053, 2277, 2579, 3094, 3731, 4285, 4618, 4787, 4987, 5321, 5674, 5847, 5793, 5611, 5401, 5169, 4860, 4446, 3922, 3341, 2795, 2332, 1850, 1229, 528, -76, -573, -1126, -1828, -2584, -3287, -3948, -4619, -5305, -5971, -6575, -7111, -7631, -8183, -8738, -9180, -9445, -9611, -9827, -10145, -10471, -10685, -10719, -10590, -10414, -10334, -10323, -10190, -9876, -9542, -9262, -8892, -8395, -7965, -7682, -7339, -6817, -6332, -6094, -5906, -5481, -4948, -4705, -4794, -4805, -4480, -4054, -3835, -3820, -3848, -3854, -3866, -3916, -3988, -4005, -3935, -3920, -4107, -4384, -4495, -4387, -4187, -4005, -3938, -4082, -4329, -4363, -4099, -3834, -3843, -4055, -4227, -4222, -4100, -4058, -4239, -4500, -4516, -4217, -3923, -3916, -4091, -4127, -3858, -3395, -2979, -2811, -2896, -2971, -2702, -2069, -1480, -1332, -1514, -1589, -1389, -1176, -1209, -1424, -1611, -1746, -1955, -2273, -2563, -2707, -2775, -2902, -3078, -3275, -3680, -4429, -5163, -5354, -5144, -5298, -6185, -7293, -7900, -7873, -7666, -7802, -8450, -9286, -9802, -9849, -9854, -10310, -11136, -11757, -11809, -11591, -11640, -11919, -11746, -10705, -9249, -7991, -6834, -5313, -3405, -1275, 1152, 3759, 6043, 7974, 10201, 12899, 15395, 17384, 19409, 21787, 24004, 25584, 26773, 27953, 29087, 29983, 30649, 31162, 31412, 31361, 31305, 31490, 31730, 31715, 31500, 31333, 31147, 30693, 29948, 29138, 28350, 27471, 26351, 24957, 23363, 21725, 20177, 18695, 17096, 15295, 13514, 11984, 10588, 9029, 7314, 5734, 4506, 3591, 2792, 1877, 797, -118, -513, -520, -591, -892, -1224, -1440, -1549, -1515, -1325, -1179, -1305, -1619, -1803, -1740, -1652, -1769, -2029, -2239, -2347, -2449, -2626, -2900, -3221, -3483, -3653, -3886, -4305, -4790, -5136, -5371, -5687, -6146, -6612, -6929, -7066, -7140, -7316, -7577, -7695, -7506, -7147, -6900, -6817, -6671, -6271, -5693, -5126, -4640, -4205, -3722, -2979, -1853, -608, 328, 1025, 1999, 3411, 4811, 5823, 6649, 7637, 8779, 9850, 10799, 11675, 12408, 12970, 13565, 14331, 14967, 15112, 14903, 14767, 14784, 14661, 14236, 13571, 12750, 11836, 10969, 10200, 9307, 8086, 6739, 5678, 4907, 4022, 2877, 1749, 799, -92, -941, -1690, -2518, -3527, -4347, -4673, -4853, -5355, -6007, -6350, -6392, -6518, -6886, -7312, -7603, -7751, -7865, -8049, -8348, -8675, -8830, -8741, -8606, -8653, -8819, -8880, -8789, -8670, -8580, -8510, -8527, -8668, -8795, -8785, -8755, -8922, -9231, -9388, -9321, -9304, -9524, -9816, -9957, -9950, -9887, -9833, -9882, -10022, -10029, -9775, -9483, -9328, -9124, -8663, -8038, -7409, -6767, -6101, -5449, -4715, -3769, -2783, -2127, -1806, -1361, -481, 521, 1153, 1421, 1740, 2314, 3005, 3633, 4090, 4329, 4515, 4904, 5408, 5677, 5675, 5714, 5905, 6043, 6023, 5904, 5679, 5374, 5164, 5113, 4952, 4424, 3693, 3128, 2748, 2224, 1389, 457, -335, -1031, -1753, -2503, -3257, -3988, -4558, -4872, -5135, -5644, -6342, -6877, -7071, -7132, -7377, -7910, -8523, -8882, -8868, -8714, -8758, -9075, -9443, -9593, -9467, -9235, -9144, -9273, -9440, -9377, -9063, -8809, -8877, -9063, -8927, -8407, -7940, -7846, -7875, -7578, -6908, -6262, -5954, -5897, -5785, -5493, -5178, -5034, -5069, -5136, -5137, -5121, -5148, -5160, -5086, -5015, -5091, -5219, -5201, -5101, -5166, -5343, -5303, -4976, -4709, -4726, -4791, -4563, -4082, -3658, -3438, -3280, -3054, -2826, -2714, -2715, -2773, -2862, -2983, -3141, -3321, -3470, -3583, -3733, -3878, -3822, -3580, -3481, -3652, -3745, -3482, -3118, -2987, -2976, -2826, -2615, -2575, -2633, -2559, -2402, -2446, -2729, -2984, -3111, -3316, -3697, -4037, -4166, -4251, -4531, -5036, -5593, -5985, -6095, -6066, -6224, -6726, -7373, -7828, -7966, -7947, -8041, -8347, -8679, -8777, -8643, -8574, -8782, -9123, -9292, -9232, -9200, -9430, -9844, -10131, -10045, -9615, -9065, -8565, -7973, -6923, -5288, -3416, -1697, -46, 1930, 4350, 6859, 9111, 11119, 13176, 15482, 17954, 20290, 22246, 23830, 25316, 26914, 28514, 29747, 30416, 30686, 30854, 31071, 31282, 31368, 31291, 31145, 31037, 30956, 30744, 30335, 29823, 29315, 28761, 28022, 27073, 25982, 24790, 23528, 22305, 21197, 20034, 18644, 17206, 15998, 14923, 13639, 12183, 10939, 10015, 9074, 7893, 6680, 5727, 5009, 4324, 3628, 3031, 2566, 2136, 1764, 1589, 1607, 1537, 1221, 876, 702, 468, -101, -791, -1225, -1506, -2020, -2789, -3506, -4037, -4488, -4946, -5432, -6014, -6688, -7266, -7623, -7961, -8523, -9134, -9395, -9308, -9270, -9431, -9533, -9392, -9058, -8544, -7855, -7216, -6795, -6355, -5553, -4471, -3506, -2823, -2196, -1333, -215, 924, 1907, 2816, 3849, 5014, 6121, 7069, 7979, 8974, 9957, 10747, 11370, 12040, 12808, 13460, 13822, 14012, 14257, 14579, 14783, 14689, 14288, 13726, 13174, 12672, 12078, 11216, 10101, 8952, 7955, 7039, 5964, 4650, 3342, 2347, 1661, 971, 66, -893, -1600, -1955, -2161, -2458, -2888, -3302, -3531, -3543, -3474, -3481, -3622, -3785, -3804, -3645, -3511, -3649, -4038, -4377, -4519, -4666, -5065, -5638, -6133, -6459, -6714, -7036, -7483, -7990, -8398, -8633, -8824, -9176, -9696, -10182, -10486, -10700, -11019, -11489, -11986, -12379, -12642, -12862, -13149, -13514, -13776, -13815, -13779, -13858, -13931, -13745, -13344, -12960, -12595, -12058, -11345, -10624, -9882, -8909, -7674, -6417, -5303, -4190, -2918, -1615, -502, 475, 1571, 2787, 3790, 4364, 4716, 5189, 5839, 6431, 6774, 6871, 6803, 6680, 6676, 6868, 7017, 6760, 6143, 5679, 5641, 5582, 4947, 3906, 3158, 2950, 2769, 2093, 1076, 260, -147, -417, -858, -1524, -2317, -3140, -3850, -4321, -4655, -5148, -5859, -6437, -6564, -6446, -6543, -6905, -7094, -6834, -6437, -6367, -6613, -6762, -6602, -6351, -6278, -6350, -6363, -6257, -6149, -6145, -6236, -6368, -6499, -6608, -6702, -6843, -7125, -7524, -7857, -7958, -7911, -7965, -8208, -8458, -8504, -8377, -8243, -8139, -7978, -7785, -7685, -7652, -7507, -7230, -7024, -6968, -6880, -6643, -6444, -6434, -6385, -5983, -5383, -5072, -5168, -5203, -4802, -4257, -4068, -4177, -4059, -3547, -3070, -2953, -2924, -2584, -2049, -1711, -1616, -1488, -1305, -1347, -1604, -1670, -1428, -1371, -1890, -2624, -2958, -2911, -3027, -3506, -3975, -4168, -4307, -4634, -4996, -5166, -5209, -5227, -5129, -4925, -4894, -5146, -5287, -4905, -4235, -3974, -4398, -4976, -5060, -4765, -4751, -5244, -5735, -5811, -5753, -5977, -6288, -6209, -5856, -5878, -6419, -6804, -6564, -6197, -6387, -6965, -7283, -7209, -7135, -7236, -7359, -7407, -7407, -7295, -7018, -6785, -6895, -7311, -7604, -7451, -7003, -6705, -6756, -6908, -6727, -5993, -4831, -3522, -2164, -625, 1216, 3286, 5437, 7626, 9905, 12310, 14800, 17206, 19342, 21193, 22995, 24934, 26865, 28478, 29629, 30458, 31170, 31819, 32277, 32402, 32204, 31891, 31707, 31657, 31483, 30971, 30240, 29545, 28916, 28182, 27262, 26221, 25067, 23737, 22292, 20932, 19724, 18546, 17330, 16181, 15156, 14117, 13029, 12071, 11304, 10466, 9387, 8327, 7557, 6980, 6328, 5580, 4888, 4292, 3760, 3359, 3142, 2931, 2479, 1892, 1559, 1600, 1610, 1150, 311, -393, -635, -676, -1118, -2131, -3189, -3725, -3926, -4456, -5481, -6467, -6994, -7312, -7868, -8668, -9371, -9804, -10065, -10233, -10274, -10235, -10267, -10322, -10081, -9375, -8490, -7824, -7347, -6657, -5547, -4239, -3028, -1917, -770, 415, 1564, 2711, 3916, 5083, 6048, 6872, 7798, 8846, 9706, 10177, 10563, 11277, 12183, 12735, 12784, 12774, 13007, 13218, 13095, 12794, 12623, 12494, 12086, 11428, 10841, 10384, 9773, 8905, 8020, 7252, 6425, 5398, 4278, 3190, 2147, 1160, 289, -510, -1315, -2059, -2573, -2820, -2972, -3175, -3394, -3539, -3555, -3400, -3088, -2822, -2811, -2904, -2700, -2149, -1713, -1753, -1998, -1992, -1814, -1930, -2449, -3035, -3529, -4078, -4697, -5248, -5848, -6710, -7621, -8152, -8357, -8750, -9563, -10425, -10922, -11146, -11482, -12059, -12651, -13023, -13163, -13220, -13361, -13628, -13838, -13761, -13419, -13125, -13088, -13157, -13009, -12502, -11793, -11157, -10696, -10222, -9481, -8438, -7324, -6345, -5448, -4405, -3131, -1792, -628, 286, 1075, 1955, 3019, 4021, 4556, 4582, 4592, 4994, 5522, 5592, 5090, 4482, 4183, 4089, 3824, 3226, 2460, 1822, 1501, 1390, 1090, 358, -430, -702, -543, -634, -1286, -2069, -2495, -2597, -2678, -2896, -3259, -3726, -4157, -4376, -4472, -4792, -5435, -5997, -6095, -5958, -6118, -6624, -6965, -6774, -6271, -5880, -5726, -5684, -5615, -5343, -4771, -4195, -4098, -4388, -4414, -3968, -3635, -3890, -4428, -4744, -4879, -5186, -5749, -6393, -7052, -7707, -8192, -8474, -8936, -9811, -10624, -10787, -10526, -10506, -10794, -10885, -10564, -10092, -9634, -9088, -8470, -7963, -7515, -6840, -5971, -5348, -5102, -4778, -4038, -3205, -2735, -2610, -2536, -2369, -2119, -1824, -1624, -1674, -1925, -2121, -2079, -1894, -1817, -1959, -2146, -2136, -1934, -1812, -1975, -2297, -2468, -2407, -2369, -2585, -2978, -3363, -3732, -4111, -4380, -4507, -4717, -5143, -5561, -5729, -5751, -5863, -6071, -6146, -5917, -5483, -5190, -5215, -5231, -4778, -3960, -3380, -3285, -3244, -2836, -2247, -1959, -2057, -2188, -2076, -1816, -1660, -1727, -1964, -2211, -2274, -2127, -1988, -2051, -2282, -2553, -2772, -2837, -2786, -2963, -3597, -4287, -4454, -4261, -4461, -5291, -6111, -6297, -6080, -6205, -6970, -7901, -8350, -8215, -7962, -8075, -8552, -8914, -8620, -7533, -5983, -4449, -3112, -1713, 216, 2872, 5880, 8626, 10929, 13206, 15833, 18605, 21013, 22932, 24699, 26604, 28478, 29936, 30827, 31331, 31703, 32022, 32213, 32160, 31804, 31209, 30509, 29832, 29199, 28475, 27464, 26098, 24607, 23281, 22127, 20895, 19463, 17997, 16711, 15634, 14711, 13905, 13135, 12369, 11706, 11325, 11187, 10989, 10484, 9843, 9472, 9508, 9613, 9403, 8891, 8430, 8257, 8243, 8150, 7915, 7635, 7329, 6937, 6521, 6209, 5869, 5230, 4337, 3518, 2816, 1926, 735, -522, -1663, -2729, -3789, -4900, -6125, -7362, -8384, -9190, -10017, -10904, -11591, -11967, -12277, -12657, -12820, -12523, -12035, -11712, -11332, -10498, -9402, -8515, -7712, -6538, -5075, -3780, -2619, -1169, 509, 1871, 2770, 3714, 5057, 6454, 7389, 7894, 8357, 8902, 9342, 9614, 9821, 9963, 9922, 9713, 9464, 9215, 8844, 8286, 7658, 7148, 6736, 6186, 5370, 4486, 3831, 3426, 3048, 2553, 2041, 1643, 1333, 1015, 696, 468, 352, 257, 115, -31, -92, -46, 57, 212, 475, 860, 1202, 1289, 1168, 1206, 1628, 2153, 2318, 2049, 1717, 1645, 1790, 1845, 1550, 905, 183, -365, -835, -1601, -2818, -4134, -5075, -5660, -6366, -7465, -8706, -9708, -10352, -10778, -11239, -11923, -12726, -13286, -13451, -13477, -13611, -13773, -13771, -13548, -13170, -12798, -12613, -12539, -12206, -11487, -10735, -10294, -10010, -9522, -8764, -7944, -7215, -6550, -5848, -5056, -4191, -3348, -2618, -1985, -1330, -540, 319, 1015, 1388, 1562, 1787, 2118, 2364, 2398, 2289, 2093, 1756, 1275, 762, 305, -119, -547, -974, -1421, -1902, -2358, -2691, -2871, -2977, -3086, -3198, -3278, -3283, -3159, -2905, -2658, -2545, -2460, -2215, -1864, -1647, -1639, -1722, -1830, -1970, -2084, -2135, -2283, -2685, -3205, -3528, -3595, -3679, -4002, -4455, -4793, -4981, -5180, -5487, -5838, -6152, -6401, -6555, -6612, -6726, -7065, -7486, -7634, -7479, -7434, -7801, -8386, -8817, -8963, -8924, -8868, -8965, -9216, -9373, -9213, -8854, -8587, -8430, -8115, -7504, -6809, -6283, -5883, -5391, -4719, -3939, -3129, -2376, -1816, -1480, -1178, -715, -160, 221, 290, 141, -65, -264, -462, -714, -1128, -1751, -2409, -2858, -3132, -3556, -4270, -4947, -5246, -5318, -5588, -6088, -6459, -6568, -6638, -6755, -6710, -6414, -6079, -5898, -5795, -5549, -5050, -4446, -4037, -3901, -3763, -3389, -2963, -2790, -2810, -2702, -2376, -2046, -1885, -1864, -1931, -2072, -2117, -1863, -1487, -1465, -1861, -2166, -2050, -1834, -1871, -1971, -1848, -1734, -2037, -2584, -2773, -2456, -2200, -2472, -2953, -3009, -2633, -2405, -2570, -2742, -2649, -2542, -2624, -2730, -2861, -3316, -3982, -4229, -3906, -3785, -4514, -5658, -6304, -6229, -6008, -6118, -6539, -7104, -7687, -8003, -7842, -7458, -7239, -7081, -6578, -5654, -4497, -3167, -1619, 218, 2499, 5199, 7838, 10021, 12073, 14603, 17587, 20392, 22605, 24325, 25873, 27463, 29073, 30437, 31293, 31633, 31716, 31770, 31826, 31726, 31299, 30511, 29522, 28547, 27590, 26447, 24986, 23369, 21863, 20538, 19207, 17773, 16362, 15176, 14272, 13564, 12951, 12388, 11918, 11670, 11705, 11913, 12079, 12111, 12100, 12152, 12257, 12297, 12233, 12167, 12172, 12117, 11836, 11379, 10983, 10720, 10394, 9819, 9044, 8215, 7342, 6372, 5342, 4294, 3111, 1692, 196, -1177, -2547, -4136, -5819, -7272, -8507, -9840, -11305, -12573, -13448, -14111, -14759, -15296, -15580, -15673, -15609, -15223, -14481, -13683, -12999, -12109, -10683, -8911, -7223, -5676, -3986, -2057, -111, 1681, 3367, 4979, 6423, 7682, 8823, 9744, 10238, 10369, 10477, 10696, 10772, 10437, 9724, 8866, 8033, 7292, 6601, 5822, 4814, 3630, 2535, 1706, 1044, 358, -314, -780, -992, -1110, -1250, -1329, -1206, -886, -490, -100, 269, 599, 870, 1146, 1565, 2160, 2770, 3199, 3444, 3656, 3975, 4401, 4813, 5067, 5091, 4986, 4931, 4958, 4874, 4522, 4008, 3571, 3220, 2669, 1708, 482, -679, -1664, -2671, -3946, -5511, -7142, -8568, -9716, -10725, -11767, -12842, -13822, -14577, -15075, -15428, -15763, -16033, -16032, -15723, -15334, -15024, -14658, -14063, -13265, -12382, -11499, -10714, -10095, -9497, -8731, -7867, -7169, -6724, -6338, -5822, -5236, -4779, -4543, -4376, -4092, -3716, -3467, -3445, -3500, -3438, -3251, -3074, -3010, -3072, -3199, -3280, -3234, -3117, -3079, -3220, -3489, -3746, -3890, -3907, -3848, -3789, -3782, -3774, -3634, -3295, -2859, -2456, -2071, -1585, -947, -276, 246, 597, 1015, 1734, 2584, 3145, 3321, 3436, 3673, 3836, 3767, 3560, 3270, 2788, 2092, 1307, 492, -373, -1236, -2019, -2793, -3688, -4683, -5612, -6338, -6897, -7442, -8087, -8774, -9334, -9671, -9851, -10007, -10165, -10239, -10160, -9972, -9763, -9570, -9385, -9155, -8777, -8238, -7749, -7514, -7384, -7025, -6368, -5672, -5142, -4734, -4305, -3775, -3188, -2697, -2387, -2134, -1770, -1391, -1278, -1492, -1780, -1920, -1985, -2174, -2534, -3022, -3652, -4403, -5054, -5421, -5685, -6214, -7051, -7804, -8155, -8219, -8324, -8554, -8714, -8628, -8344, -7999, -7651, -7272, -6827, -6284, -5619, -4896, -4249, -3695, -3051, -2197, -1326, -701, -294, 148, 760, 1388, 1741, 1682, 1458, 1472, 1661, 1477, 759, 117, 7, -25, -628, -1573, -2110, -2122, -2208, -2662, -3104, -3294, -3507, -3810, -3788, -3390, -3198, -3416, -3476, -3056, -2650, -2680, -2779, -2429, -1768, -1351, -1392, -1575, -1465, -928, -189, 342, 406, 173, 96, 314, 451, 160, -405, -915, -1332, -1834, -2467, -3160, -3876, -4571, -5131, -5509, -5888, -6490, -7260, -7852, -8022, -7896, -7764, -7688, -7453, -6835, -5810, -4444, -2773, -812, 1344, 3582, 5920, 8493, 11267, 14024, 16592, 19030, 21373, 23481, 25276, 26876, 28393, 29683, 30558, 31050, 31344, 31496, 31403, 31038, 30482, 29778, 28891, 27848, 26690, 25348, 23815, 22339, 21193, 20263, 19214, 17978, 16866, 16133, 15724, 15428, 15158, 14993, 15014, 15215, 15522, 15869, 16220, 16585, 16938, 17155, 17201, 17190, 17123, 16791, 16164, 15592, 15201, 14573, 13408, 12025, 10843, 9772, 8510, 7023, 5427, 3774, 2122, 541, -1000, -2634, -4337, -5955, -7418, -8812, -10190, -11460, -12561, -13527, -14332, -14859, -15175, -15479, -15695, -15532, -15004, -14441, -13894, -13083, -11923, -10653, -9424, -8135, -6708, -5173, -3565, -1944, -445, 845, 2005, 3137, 4175, 4933, 5328, 5472, 5515, 5464, 5203, 4695, 4029, 3307, 2551, 1770, 1016, 297, -427, -1115, -1622, -1883, -2005, -2073, -2009, -1677, -1084, -358, 403, 1215, 2153, 3219, 4296, 5268, 6130, 6949, 7735, 8414, 8917, 9248, 9444, 9535, 9570, 9591, 9518, 9196, 8639, 8101, 7728, 7289, 6498, 5469, 4528, 3761, 2940, 1907, 743, -405, -1521, -2651, -3804, -4945, -6068, -7190, -8292, -9330, -10279, -11138, -11880, -12461, -12862, -13111, -13240, -13218, -12973, -12492, -11887, -11275, -10618, -9821, -8920, -8060, -7308, -6667, -6166, -5807, -5519, -5315, -5357, -5749, -6332, -6880, -7392, -8065, -8997, -10043, -11007, -11833, -12570, -13240, -13811, -14290, -14684, -14924, -14890, -14546, -13981, -13293, -12474, -11442, -10206, -8906, -7629, -6291, -4826, -3360, -2071, -956, 99, 1125, 2091, 2957, 3637, 4068, 4381, 4775, 5207, 5429, 5363, 5188, 5048, 4881, 4609, 4284, 3952, 3545, 3035, 2565, 2248, 1969, 1567, 1109, 754, 455, 29, -527, -1033, -1426, -1841, -2370, -2898, -3259, -3490, -3768, -4114, -4316, -4253, -4114, -4114, -4156, -4036, -3809, -3663, -3565, -3349, -3073, -2972, -3079, -3167, -3107, -3060, -3228, -3604, -4067, -4594, -5232, -5947, -6657, -7343, -8032, -8751, -9510, -10249, -10816, -11115, -11248, -11350, -11379, -11234, -10947, -10611, -10201, -9636, -8916, -8131, -7372, -6664, -5955, -5166, -4286, -3414, -2669, -2113, -1744, -1497, -1276, -1062, -979, -1159, -1532, -1842, -1990, -2208, -2687, -3232, -3498, -3533, -3732, -4234, -4715, -4889, -4918, -5117, -5445, -5593, -5474, -5311, -5273, -5289, -5224, -5004, -4580, -4011, -3526, -3288, -3119, -2701, -2053, -1534, -1302, -1070, -615, -199, -160, -312, -155, 381, 823, 769, 404, 275, 608, 995, 897, 426, 241, 621, 1063, 1017, 624, 430, 599, 773, 600, 131, -330, -623, -880, -1319, -1966, -2592, -2966, -3146, -3431, -3960, -4475, -4669, -4644, -4782, -5224, -5673, -5800, -5653, -5578, -5759, -5961, -5825, -5355, -4905, -4705, -4617, -4443, -4190, -3952, -3811, -3858, -4084, -4271, -4215, -3976, -3672, -3241, -2600, -1776, -700, 806, 2677, 4572, 6315, 8136, 10282, 12626, 14846, 16828, 18714, 20612, 22454, 24146, 25638, 26872, 27796, 28429, 28822, 28946, 28773, 28357, 27748, 26953, 26002, 24964, 23878, 22763, 21753, 20998, 20442, 19901, 19342, 18966, 18889, 18963, 18999, 19072, 19342, 19757, 20134, 20457, 20845, 21275, 21571, 21690, 21759, 21739, 21365, 20560, 19629, 18769, 17777, 16418, 14840, 13285, 11697, 9963, 8204, 6583, 5042, 3476, 1953, 606, -573, -1713, -2856, -3917, -4793, -5525, -6240, -6975, -7619, -8082, -8412, -8748, -9108, -9349, -9378, -9309, -9313, -9357, -9295, -9094, -8814, -8458, -8031, -7595, -7150, -6575, -5814, -5013, -4296, -3595, -2802, -1962, -1235, -729, -416, -178, 68, 264, 265, 14, -381, -778, -1129, -1471, -1820, -2136, -2368, -2518, -2606, -2595, -2397, -1993, -1465, -858, -114, 813, 1847, 2889, 3965, 5135, 6357, 7509, 8533, 9435, 10161, 10614, 10833, 10955, 10953, 10631, 9952, 9110, 8222, 7254, 6254, 5308, 4333, 3238, 2160, 1273, 506, -250, -932, -1495, -2027, -2536, -2897, -3110, -3320, -3529, -3598, -3542, -3578, -3783, -3968, -4031, -4180, -4589, -5078, -5435, -5816, -6458, -7205, -7747, -8115, -8578, -9178, -9710, -10104, -10513, -11009, -11459, -11780, -12114, -12636, -13278, -13809, -14156, -14473, -14873, -15271, -15539, -15685, -15779, -15810, -15714, -15503, -15233, -14909, -14496, -13999, -13470, -12940, -12371, -11653, -10761, -9856, -9082, -8306, -7307, -6187, -5260, -4559, -3842, -3072, -2504, -2231, -2024, -1729, -1539, -1616, -1763, -1704, -1515, -1426, -1361, -1080, -631, -262, 0, 351, 886, 1513, 2122, 2656, 3128, 3627, 4228, 4865, 5387, 5780, 6166, 6535, 6656, 6413, 6033, 5697, 5226, 4438, 3513, 2636, 1653, 491, -553, -1298, -2007, -2863, -3612, -4037, -4366, -4863, -5342, -5474, -5378, -5441, -5692, -5793, -5631, -5445, -5336, -5156, -4904, -4772, -4798, -4859, -4901, -4934, -5018, -5314, -5875, -6417, -6717, -6999, -7492, -7945, -8041, -7976, -8079, -8219, -8080, -7733, -7488, -7362, -7117, -6751, -6531, -6495, -6358, -6006, -5693, -5571, -5401, -4980, -4524, -4314, -4205, -3909, -3513, -3351, -3403, -3314, -3015, -2853, -2963, -3006, -2729, -2385, -2314, -2415, -2329, -2009, -1783, -1882, -2127, -2205, -2084, -2011, -2210, -2596, -2810, -2647, -2371, -2354, -2464, -2267, -1737, -1235, -862, -431, 49, 423, 773, 1235, 1610, 1638, 1499, 1560, 1749, 1644, 1168, 732, 591, 425, -136, -875, -1256, -1257, -1441, -2049, -2595, -2646, -2413, -2167, -1741, -1100, -664, -493, -1, 1044, 2009, 2374, 2435, 2631, 2873, 2867, 2574, 2159, 1758, 1360, 805, 13, -820, -1464, -1993, -2653, -3489, -4370, -5173, -5793, -6188, -6526, -7022, -7538, -7683, -7355, -6853, -6400, -5899, -5240, -4550, -3949, -3341, -2621, -1990, -1719, -1741, -1713, -1451, -1053, -659, -277, 151, 773, 1758, 3136, 4754, 6411, 7967, 9395, 10939, 12854, 14964, 16778, 18165, 19496, 20989, 22431, 23646, 24702, 25554, 26008, 26066, 25905, 25612, 25119, 24394, 23435, 22293, 21166, 20253, 19549, 18951, 18503, 18279, 18207, 18188, 18352, 18868, 19610, 20246, 20698, 21240, 22049, 22910, 23502, 23836, 24101, 24289, 24197, 23739, 23025, 22114, 20931, 19467, 17835, 16081, 14127, 11978, 9818, 7807, 5846, 3827, 1933, 473, -606, -1649, -2708, -3466, -3782, -3926, -4053, -4053, -3992, -4115, -4343, -4315, -4017, -3822, -3901, -4100, -4270, -4385, -4478, -4641, -4969, -5402, -5838, -6313, -6826, -7230, -7491, -7772, -8076, -8165, -8002, -7813, -7652, -7319, -6807, -6365, -6052, -5648, -5094, -4683, -4587, -4543, -4250, -3839, -3591, -3433, -3103, -2631, -2207, -1790, -1208, -512, 125, 704, 1311, 1910, 2413, 2875, 3417, 4009, 4482, 4760, 4964, 5226, 5492, 5602, 5498, 5251, 4920, 4498, 3980, 3424, 2891, 2361, 1783, 1220, 854, 766, 820, 899, 1065, 1372, 1705, 1972, 2255, 2606, 2911, 3072, 3099, 2977, 2701, 2378, 2045, 1549, 788, -95, -982, -1982, -3192, -4506, -5804, -7103, -8420, -9688, -10865, -11958, -12921, -13636, -14096, -14414, -14638, -14654, -14390, -13989, -13626, -13271, -12789, -12225, -11750, -11413, -11097, -10768, -10536, -10470, -10477, -10468, -10515, -10700, -10960, -11163, -11360, -11743, -12337, -12919, -13325, -13659, -14051, -14406, -14566, -14545, -14411, -14093, -13541, -12817, -11973, -10997, -9938, -8874, -7804, -6743, -5743, -4729, -3573, -2429, -1551, -799, 199, 1406, 2433, 3182, 3875, 4543, 5032, 5354, 5626, 5785, 5662, 5276, 4825, 4494, 4313, 4117, 3733, 3247, 2919, 2787, 2613, 2276, 1936, 1717, 1493, 1133, 724, 450, 352, 321, 254, 166, 148, 250, 423, 583, 665, 627, 465, 234, 6, -246, -646, -1260, -1958, -2560, -3104, -3788, -4576, -5200, -5615, -6109, -6777, -7354, -7718, -8105, -8618, -9037, -9248, -9417, -9639, -9775, -9704, -9430, -9001, -8492, -7952, -7331, -6612, -5955, -5495, -5080, -4542, -4032, -3818, -3869, -3923, -3843, -3709, -3689, -3870, -4139, -4287, -4298, -4371, -4542, -4652, -4727, -4938, -5160, -5092, -4788, -4552, -4352, -3927, -3322, -2776, -2251, -1535, -682, 51, 594, 1046, 1446, 1741, 1944, 2125, 2239, 2126, 1727, 1242, 913, 736, 487, 33, -499, -885, -1056, -1149, -1278, -1381, -1390, -1406, -1519, -1574, -1399, -1125, -997, -992, -886, -635, -366, -145, 36, 106, -2, -177, -240, -222, -360, -740, -1135, -1254, -1096, -899, -837, -858, -812, -617, -300, 52, 338, 496, 546, 593, 726, 861, 773, 417, 30, -205, -442, -858, -1312, -1575, -1735, -2069, -2590, -3000, -3056, -2862, -2792, -3120, -3698, -4014, -3711, -3002, -2438, -2273, -2211, -1769, -843, 168, 826, 1128, 1360, 1594, 1695, 1753, 1998, 2302, 2325, 2189, 2399, 3183, 4432, 6045, 7808, 9323, 10603, 12267, 14605, 17032, 18827, 20032, 21109, 22214, 23186, 23988, 24664, 24988, 24714, 24066, 23537, 23156, 22548, 21574, 20428, 19181, 17862, 16799, 16300, 16154, 15986, 15860, 16105, 16782, 17666, 18693, 19996, 21483, 22747, 23545, 24103, 24744, 25345, 25478, 25002, 24151, 23082, 21669, 19881, 17973, 16069, 13979, 11598, 9204, 7070, 5138, 3292, 1600, 177, -967, -1844, -2446, -2753, -2695, -2252, -1609, -956, -229, 618, 1335, 1752, 2104, 2522, 2624, 2069, 1121, 187, -783, -2024, -3430, -4740, -5973, -7331, -8771, -10001, -10880, -11532, -12050, -12379, -12506, -12466, -12173, -11507, -10578, -9600, -8583, -7413, -6137, -4919, -3792, -2706, -1748, -1092, -723, -452, -241, -246, -471, -705, -871, -1122, -1473, -1705, -1737, -1757, -1852, -1853, -1687, -1559, -1609, -1632, -1426, -1171, -1102, -1051, -749, -349, -127, 59, 542, 1215, 1692, 1926, 2206, 2665, 3114, 3350, 3408, 3484, 3686, 3912, 3997, 3931, 3823, 3707, 3536, 3279, 2890, 2250, 1341, 365, -497, -1342, -2364, -3532, -4616, -5486, -6193, -6825, -7382, -7807, -8064, -8189, -8260, -8298, -8269, -8141, -7917, -7619, -7325, -7141, -7067, -6949, -6707, -6470, -6433, -6599, -6868, -7192, -7597, -8128, -8822, -9678, -10597, -11448, -12216, -13018, -13874, -14588, -14972, -15116, -15238, -15348, -15268, -14919, -14416, -13870, -13275, -12621, -11894, -11046, -10069, -9081, -8233, -7468, -6580, -5547, -4638, -4081, -3780, -3474, -3118, -2895, -2931, -3162, -3500, -3878, -4098, -4000, -3796, -3858, -4039, -3802, -3074, -2353, -1845, -1225, -334, 572, 1344, 2136, 3015, 3860, 4632, 5398, 6089, 6560, 6828, 7068, 7314, 7353, 6978, 6267, 5502, 4814, 4073, 3140, 2100, 1113, 231, -522, -1062, -1413, -1755, -2142, -2381, -2370, -2276, -2242, -2198, -2071, -1914, -1772, -1632, -1523, -1484, -1459, -1415, -1435, -1604, -1912, -2313, -2780, -3276, -3811, -4457, -5218, -5988, -6693, -7356, -7968, -8477, -8909, -9298, -9534, -9511, -9330, -9163, -9013, -8793, -8499, -8155, -7778, -7458, -7266, -7097, -6821, -6491, -6224, -5976, -5678, -5394, -5176, -4985, -4819, -4725, -4662, -4553, -4473, -4528, -4632, -4600, -4385, -4099, -3813, -3520, -3189, -2779, -2253, -1647, -1070, -617, -279, 30, 386, 747, 999, 1102, 1168, 1318, 1531, 1714, 1845, 1977, 2145, 2333, 2477, 2482, 2339, 2164, 2032, 1820, 1406, 905, 516, 298, 207, 201, 206, 207, 342, 686, 1046, 1242, 1375, 1528, 1564, 1462, 1417, 1414, 1236, 953, 836, 821, 659, 416, 283, 137, -196, -563, -788, -1015, -1384, -1680, -1666, -1549, -1633, -1726, -1415, -842, -518, -448, -224, 88, 63, -196, -240, -210, -630, -1413, -1985, -2239, -2580, -3152, -3675, -3988, -4235, -4470, -4463, -4061, -3521, -3211, -3007, -2368, -1139, 130, 996, 1734, 2692, 3599, 4088, 4423, 4959, 5346, 5046, 4320, 3922, 3973, 3855, 3282, 2844, 3211, 4264, 5425, 6584, 8170, 10364, 12751, 14946, 17083, 19393, 21639, 23376, 24544, 25446, 26185, 26537, 26346, 25766, 24976, 23975, 22756, 21429, 20056, 18573, 17075, 15881, 15144, 14655, 14230, 14171, 14831, 15981, 17037, 17955, 19284, 21138, 22851, 23923, 24625, 25328, 25831, 25810, 25331, 24505, 23188, 21313, 19151, 16946, 14594, 11997, 9428, 7194, 5180, 3157, 1326, 50, -737, -1369, -1874, -2080, -2020, -1765, -1220, -390, 437, 1063, 1603, 2169, 2623, 2792, 2683, 2362, 1752, 644, -1000, -2871, -4535, -5917, -7382, -9216, -11168, -12689, -13549, -14032, -14479, -14852, -14924, -14632, -14007, -13030, -11859, -10824, -9902, -8687, -7166, -5876, -5050, -4325, -3534, -2963, -2729, -2636, -2679, -3024, -3551, -4001, -4395, -4900, -5457, -5885, -6119, -6182, -6123, -6017, -5853, -5492, -4925, -4366, -3961, -3599, -3131, -2614, -2205, -1932, -1692, -1374, -920, -325, 343, 994, 1596, 2233, 2998, 3830, 4513, 4881, 4983, 4986, 4933, 4718, 4243, 3550, 2728, 1814, 826, -196, -1205, -2165, -3063, -3922, -4743, -5410, -5780, -5847, -5726, -5466, -5043, -4480, -3833, -3071, -2194, -1380, -866, -681, -665, -756, -1105, -1858, -2958, -4239, -5618, -7090, -8591, -9992, -11263, -12453, -13521, -14279, -14641, -14734, -14661, -14355, -13792, -13147, -12517, -11778, -10857, -9934, -9192, -8589, -8035, -7616, -7409, -7287, -7124, -7071, -7363, -7905, -8380, -8714, -9109, -9619, -10069, -10389, -10645, -10787, -10687, -10390, -10077, -9739, -9194, -8398, -7544, -6797, -6112, -5385, -4616, -3828, -2995, -2173, -1493, -941, -305, 491, 1247, 1768, 2163, 2645, 3187, 3575, 3743, 3828, 3913, 3901, 3731, 3520, 3369, 3188, 2852, 2435, 2144, 2041, 1992, 1888, 1768, 1731, 1829, 2093, 2499, 2946, 3345, 3700, 4039, 4340, 4599, 4815, 4903, 4733, 4315, 3799, 3280, 2719, 2036, 1209, 282, -619, -1405, -2129, -2870, -3570, -4119, -4549, -4933, -5205, -5256, -5105, -4839, -4545, -4316, -4163, -3930, -3503, -3082, -2955, -3116, -3345, -3546, -3789, -4133, -4580, -5139, -5805, -6538, -7277, -7923, -8376, -8678, -8972, -9264, -9381, -9236, -8914, -8490, -7965, -7385, -6834, -6294, -5713, -5117, -4544, -3974, -3444, -3063, -2847, -2681, -2497, -2350, -2268, -2196, -2123, -2141, -2292, -2439, -2439, -2333, -2283, -2341, -2445, -2542, -2574, -2478, -2309, -2167, -1964, -1507, -843, -204, 384, 1074, 1829, 2480, 2996, 3433, 3736, 3847, 3861, 3852, 3765, 3556, 3249, 2851, 2433, 2147, 2019, 1866, 1588, 1352, 1335, 1527, 1843, 2221, 2596, 2983, 3494, 4118, 4662, 5023, 5301, 5542, 5656, 5664, 5697, 5721, 5572, 5224, 4789, 4314, 3792, 3234, 2609, 1887, 1175, 634, 261, -36, -186, -52, 323, 755, 1160, 1552, 1904, 2100, 2058, 1802, 1419, 906, 102, -1100, -2495, -3690, -4545, -5239, -5861, -6200, -6017, -5295, -4134, -2580, -636, 1611, 3982, 6249, 8277, 10091, 11762, 13229, 14319, 14890, 14924, 14506, 13832, 13112, 12378, 11484, 10314, 8926, 7542, 6481, 6004, 5999, 6124, 6331, 6978, 8258, 9905, 11631, 13446, 15381, 17298, 19093, 20769, 22222, 23282, 23910, 24194, 24170, 23794, 22996, 21739, 20171, 18584, 17100, 15564, 13972, 12621, 11681, 10949, 10291, 9867, 9791, 9954, 10220, 10492, 10636, 10687, 10877, 11213, 11360, 11142, 10818, 10550, 10120, 9385, 8620, 8114, 7645, 6776, 5506, 4278, 3391, 2690, 1904, 965, -74, -1121, -2024, -2713, -3327, -4033, -4784, -5450, -6001, -6445, -6753, -6963, -7184, -7403, -7465, -7272, -6951, -6708, -6607, -6512, -6282, -5976, -5816, -5914, -6143, -6341, -6527, -6811, -7205, -7622, -8022, -8427, -8827, -9174, -9431, -9609, -9724, -9802, -9879, -9956, -9937, -9732, -9402, -9102, -8868, -8574, -8119, -7521, -6846, -6109, -5339, -4587, -3872, -3169, -2485, -1903, -1527, -1348, -1258, -1183, -1200, -1417, -1769, -2063, -2223, -2354, -2548, -2745, -2820, -2721, -2492, -2242, -2029, -1769, -1338, -791, -337, -57, 196, 562, 959, 1190, 1164, 956, 688, 435, 179, -186, -784, -1583, -2370, -2962, -3410, -3865, -4356, -4779, -5043, -5114, -5020, -4897, -4909, -5049, -5139, -5083, -5012, -5119, -5416, -5736, -5935, -6031, -6123, -6264, -6422, -6509, -6487, -6439, -6471, -6529, -6460, -6307, -6302, -6518, -6736, -6755, -6624, -6505, -6512, -6668, -6865, -6888, -6643, -6324, -6205, -6328, -6470, -6429, -6188, -5870, -5599, -5423, -5307, -5130, -4793, -4362, -3998, -3736, -3453, -3087, -2780, -2677, -2700, -2629, -2409, -2230, -2271, -2479, -2626, -2561, -2335, -2164, -2209, -2375, -2398, -2194, -1946, -1828, -1813, -1814, -1783, -1661, -1465, -1371, -1475, -1576, -1458, -1235, -1181, -1356, -1596, -1765, -1865, -1964, -2131, -2351, -2545, -2671, -2750, -2764, -2691, -2619, -2629, -2593, -2343, -1980, -1748, -1682, -1602, -1410, -1168, -975, -914, -1015, -1199, -1355, -1506, -1770, -2143, -2474, -2687, -2881, -3139, -3353, -3341, -3089, -2782, -2578, -2448, -2284, -2064, -1835, -1625, -1449, -1389, -1527, -1803, -2034, -2103, -2072, -2095, -2276, -2568, -2768, -2688, -2349, -1923, -1501, -1048, -557, -49, 536, 1257, 1990, 2525, 2785, 2857, 2828, 2731, 2601, 2441, 2152, 1641, 1038, 621, 457, 329, 116, -32, 14, 161, 302, 526, 953, 1551, 2175, 2730, 3248, 3848, 4549, 5140, 5383, 5321, 5194, 5050, 4672, 3900, 2898, 1915, 1008, 140, -586, -959, -912, -515, 212, 1343, 2854, 4620, 6572, 8679, 10750, 12477, 13753, 14763, 15635, 16166, 16120, 15599, 14884, 14068, 13083, 11992, 10954, 9962, 8886, 7813, 7054, 6733, 6644, 6626, 6809, 7332, 8048, 8802, 9723, 10972, 12347, 13452, 14194, 14849, 15614, 16324, 16671, 16614, 16352, 15966, 15291, 14252, 13058, 11844, 10444, 8773, 7148, 5886, 4918, 4066, 3423, 3145, 3164, 3347, 3728, 4332, 4990, 5504, 5851, 6121, 6323, 6386, 6281, 6035, 5639, 5059, 4348, 3644, 2965, 2144, 1072, -92, -1086, -1872, -2640, -3498, -4307, -4903, -5329, -5724, -6065, -6220, -6191, -6138, -6124, -6052, -5868, -5648, -5427, -5124, -4717, -4346, -4150, -4087, -4018, -3923, -3927, -4139, -4529, -4997, -5503, -6088, -6749, -7429, -8090, -8721, -9282, -9679, -9890, -9953, -9886, -9653, -9266, -8790, -8256, -7655, -7017, -6452, -6021, -5683, -5399, -5210, -5142, -5107, -5018, -4931, -4937, -4966, -4875, -4665, -4491, -4451, -4458, -4395, -4288, -4260, -4362, -4516, -4617, -4625, -4558, -4434, -4267, -4066, -3821, -3497, -3051, -2505, -1980, -1604, -1392, -1228, -1010, -798, -745, -897, -1132, -1330, -1525, -1824, -2217, -2569, -2798, -2955, -3122, -3295, -3407, -3403, -3287, -3090, -2845, -2582, -2321, -2081, -1875, -1691, -1500, -1326, -1276, -1411, -1612, -1715, -1734, -1836, -2094, -2361, -2471, -2466, -2514, -2656, -2758, -2706, -2568, -2504, -2567, -2653, -2629, -2503, -2415, -2464, -2563, -2548, -2391, -2227, -2174, -2171, -2070, -1820, -1544, -1403, -1375, -1276, -1024, -785, -747, -839, -870, -826, -862, -1040, -1258, -1398, -1466, -1544, -1656, -1710, -1608, -1405, -1237, -1100, -853, -470, -140, -8, 13, 99, 274, 425, 480, 461, 423, 373, 300, 209, 122, 46, -38, -170, -361, -550, -646, -643, -617, -614, -593, -526, -430, -307, -163, -44, 19, 60, 94, 56, -65, -193, -310, -503, -783, -1042, -1215, -1373, -1585, -1797, -1888, -1830, -1734, -1739, -1828, -1816, -1615, -1383, -1332, -1442, -1549, -1580, -1586, -1656, -1874, -2218, -2489, -2526, -2448, -2486, -2646, -2738, -2685, -2556, -2430, -2358, -2366, -2398, -2392, -2401, -2503, -2609, -2588, -2498, -2522, -2716, -2978, -3185, -3277, -3265, -3235, -3273, -3364, -3389, -3273, -3063, -2854, -2684, -2483, -2187, -1866, -1663, -1574, -1426, -1144, -888, -800, -826, -876, -956, -1048, -1089, -1129, -1283, -1487, -1548, -1433, -1286, -1183, -1063, -864, -580, -257, 21, 213, 365, 526, 669, 754, 797, 794, 719, 644, 696, 862, 972, 964, 1000, 1237, 1600, 1872, 1976, 2041, 2203, 2435, 2597, 2619, 2567, 2543, 2596, 2708, 2835, 2940, 3026, 3128, 3267, 3417, 3524, 3581, 3640, 3738, 3850, 3936, 3994, 4059, 4132, 4193, 4248, 4309, 4350, 4326, 4272, 4259, 4308, 4347, 4330, 4308, 4372, 4552, 4787, 4995, 5159, 5327, 5548, 5801, 6018, 6143, 6187, 6205, 6237, 6248, 6186, 6049, 5899, 5781, 5672, 5540, 5412, 5342, 5345, 5382, 5426, 5480, 5564, 5672, 5793, 5892, 5948, 5957, 5953, 5948, 5894, 5745, 5544, 5364, 5198, 4966, 4646, 4304, 4035, 3890, 3876, 3944, 4045, 4211, 4526, 4990, 5472, 5847, 6135, 6425, 6718, 6908, 6949, 6915, 6875, 6782, 6569, 6315, 6173, 6135, 6012, 5708, 5343, 5065, 4891, 4789, 4761, 4765, 4738, 4711, 4809, 5063, 5355, 5567, 5693, 5814, 5981, 6147, 6232, 6228, 6231, 6292, 6322, 6204, 5991, 5870, 5879, 5788, 5460, 5104, 4965, 4943, 4797, 4555, 4384, 4280, 4145, 4021, 3969, 3918, 3812, 3711, 3645, 3558, 3455, 3404, 3399, 3345, 3205, 3052, 2943, 2846, 2694, 2478, 2241, 2017, 1805, 1587, 1332, 1030, 731, 474, 202, -115, -383, -535, -674, -900, -1121, -1238, -1331, -1503, -1704, -1848, -1977, -2164, -2383, -2593, -2795, -2994, -3189, -3385, -3565, -3702, -3804, -3915, -4046, -4165, -4276, -4412, -4568, -4707, -4817, -4931, -5073, -5233, -5388, -5536, -5666, -5768, -5863, -5993, -6166, -6328, -6441, -6521, -6597, -6663, -6712, -6754, -6784, -6788, -6766, -6752, -6765, -6799, -6868, -6983, -7149, -7330, -7484, -7599, -7697, -7794, -7870, -7889, -7851, -7791, -7724, -7626, -7478, -7301, -7140, -7008, -6880, -6737, -6590, -6475, -6411, -6393, -6405, -6438, -6492, -6573, -6692, -6843, -7015, -7182, -7337, -7484, -7629, -7751, -7827, -7846, -7814, -7740, -7625, -7482, -7325, -7148, -6936, -6696, -6460, -6239, -6015, -5789, -5577, -5387, -5208, -5048, -4939, -4902, -4914, -4943, -4978, -5041, -5144, -5267, -5363, -5407, -5417, -5419, -5413, -5382, -5303, -5173, -5015, -4868, -4737, -4587, -4384, -4156, -3954, -3784, -3612, -3429, -3279, -3185, -3101, -2985, -2871, -2810, -2792, -2754, -2671, -2568, -2473, -2397, -2329, -2254, -2168, -2093, -2037, -1975, -1879, -1766, -1666, -1568, -1446, -1298, -1156, -1025, -884, -715, -534, -370, -226, -88, 58, 214, 362, 472, 543, 613, 691, 741, 757, 789, 861, 920, 933, 941, 980, 1021, 1041, 1076, 1147, 1222, 1267, 1281, 1291, 1321, 1383, 1465, 1535, 1573, 1594, 1623, 1682, 1775, 1885, 1982, 2035, 2055, 2080, 2141, 2208, 2239, 2231, 2209, 2177, 2122, 2053, 1991, 1939, 1879, 1809, 1762, 1754, 1770, 1784, 1785, 1789, 1813, 1867, 1939, 1996, 2016, 2014, 2019, 2027, 2011, 1972, 1945, 1944, 1932, 1881, 1820, 1797, 1813, 1816, 1785, 1756, 1771, 1805, 1806, 1764, 1726, 1724, 1734, 1723, 1689, 1662, 1661, 1679, 1704, 1733, 1760, 1785, 1818, 1870, 1925, 1962, 1986, 2019, 2074, 2130, 2180, 2219, 2245, 2261, 2280, 2303, 2310, 2276, 2221, 2178, 2160, 2150, 2142, 2158, 2221, 2308, 2386, 2457, 2550, 2683, 2837, 2972, 3075, 3170, 3278, 3375, 3433, 3476, 3535, 3569, 3523, 3439, 3418, 3472, 3511, 3480, 3417, 3389, 3417, 3457, 3447, 3374, 3292, 3262, 3275, 3265, 3219, 3183, 3183, 3183, 3152, 3132, 3189, 3308, 3415, 3480, 3532, 3591, 3645, 3684, 3710, 3732, 3740, 3722, 3664, 3571, 3476, 3409, 3356, 3277, 3172, 3073, 3007, 2957, 2913, 2896, 2904, 2883, 2810, 2748, 2752, 2792, 2799, 2766, 2721, 2670, 2623, 2606, 2614, 2582, 2466, 2318, 2232, 2231, 2239, 2181, 2085, 2035, 2062, 2092, 2052, 1961, 1903, 1908, 1909, 1837, 1719, 1632, 1595, 1569, 1534, 1511, 1498, 1458, 1380, 1304, 1266, 1247, 1207, 1150, 1104, 1077, 1072, 1084, 1099, 1082, 1031, 989, 964, 908, 811, 725, 693, 685, 649, 577, 495, 444, 450, 481, 475, 410, 331, 283, 255, 216, 158, 96, 48, 5, -56, -144, -221, -259, -285, -337, -402, -440, -467, -519, -580, -614, -620, -643, -695, -748, -785, -825, -879, -930, -938, -885, -777, -639, -503, -380, -247, -83, 92, 246, 378, 498, 599, 682, 783, 906, 1009, 1065, 1109, 1175, 1256, 1328, 1397, 1493, 1632, 1793, 1931, 2032, 2147, 2313, 2500, 2640, 2738, 2845, 2969, 3078, 3161, 3245, 3330, 3395, 3423, 3440, 3481, 3545, 3585, 3563, 3517, 3508, 3521, 3494, 3428, 3395, 3406, 3384, 3293, 3194, 3143, 3135, 3122, 3052, 2923, 2794, 2729, 2699, 2639, 2555, 2506, 2475, 2402, 2268, 2112, 1952, 1778, 1578, 1346, 1089, 838, 620, 432, 258, 110, 0, -92, -196, -316, -427, -524, -629, -753, -872, -968, -1049, -1128, -1207, -1311, -1462, -1634, -1786, -1932, -2108, -2283, -2408, -2504, -2618, -2739, -2833, -2897, -2946, -2979, -3019, -3088, -3163, -3199, -3205, -3228, -3283, -3345, -3408, -3477, -3557, -3638, -3718, -3806, -3895, -3976, -4049, -4122, -4185, -4221, -4252, -4312, -4402, -4497, -4595, -4711, -4827, -4930, -5038, -5163, -5277, -5364, -5436, -5492, -5508, -5494, -5480, -5473, -5439, -5378, -5336, -5339, -5350, -5336, -5334, -5382, -5431, -5417, -5360, -5315, -5289, -5239, -5178, -5144, -5150, -5197, -5292, -5429, -5598, -5797, -5977, -6063, -6059, -6042, -6019, -5909, -5714, -5531, -5387, -5229, -5085, -5055, -5160, -5343, -5563, -5802, -6024, -6227, -6419, -6538, -6497, -6313, -6060, -5759, -5434, -5199, -5166, -5270, -5335, -5280, -5173, -5076, -4925, -4601, -4046, -3315, -2549, -1971, -1823, -2200, -2950, -3760, -4388, -4739, -4762, -4397, -3667, -2707, -1636, -500, 557, 1248, 1331, 814, -97, -1163, -2185, -3030, -3613, -3840, -3619, -2969, -2087, -1252, -675, -436, -489, -729, -1049, -1362, -1550, -1501, -1208, -762, -263, 185, 437, 407, 185, -89, -385, -690, -923, -1030, -1051, -987, -774, -423, -51, 262, 498, 596, 516, 372, 336, 447, 622, 826, 1105, 1464, 1789, 1950, 1933, 1833, 1709, 1537, 1317, 1160, 1204, 1454, 1761, 1970, 2033, 2002, 1977, 2030, 2136, 2252, 2408, 2634, 2860, 3077, 3489, 4270, 5270, 6166, 6784, 7083, 6992, 6467, 5574, 4401, 3028, 1681, 699, 255, 254, 562, 1200, 2192, 3331, 4296, 4903, 5140, 5016, 4582, 4047, 3625, 3286, 2848, 2313, 1933, 1923, 2219, 2548, 2689, 2657, 2573, 2375, 1899, 1220, 648, 320, 125, 106, 502, 1316, 2209, 2896, 3362, 3630, 3636, 3365, 2892, 2228, 1345, 399, -284, -522, -426, -94, 579, 1616, 2686, 3375, 3535, 3225, 2548, 1655, 696, -306, -1312, -2042, -2167, -1718, -1039, -353, 399, 1284, 2138, 2699, 2875, 2784, 2547, 2145, 1522, 769, 102, -325, -474, -344, 24, 526, 1055, 1511, 1651, 1177, 123, -1055, -1929, -2336, -2210, -1522, -463, 694, 1941, 3344, 4589, 5118, 4709, 3655, 2348, 972, -404, -1610, -2363, -2454, -1892, -831, 556, 2109, 3569, 4528, 4625, 3823, 2463, 993, -280, -1141, -1390, -1009, -246, 623, 1468, 2177, 2610, 2733, 2597, 2200, 1573, 999, 833, 1098, 1484, 1738, 1903, 2130, 2397, 2484, 2196, 1556, 748, -83, -893, -1583, -1941, -1816, -1311, -686, -66, 622, 1410, 2106, 2486, 2548, 2441, 2221, 1805, 1171, 439, -268, -949, -1636, -2232, -2523, -2313, -1566, -485, 540, 1247, 1717, 2127, 2369, 2179, 1570, 821, 165, -294, -481, -414, -242, -67, 89, 143, -14, -261, -364, -335, -425, -745, -1093, -1231, -1146, -976, -785, -524, -167, 220, 553, 754, 743, 479, 51, -351, -590, -663, -657, -609, -437, -36, 548, 1130, 1549, 1754, 1708, 1344, 666, -204, -1104, -1861, -2276, -2173, -1560, -639, 360, 1296, 2039, 2405, 2312, 1914, 1454, 1019, 564, 116, -197, -309, -291, -254, -256, -281, -278, -228, -175, -138, -32, 254, 665, 952, 952, 805, 766, 879, 1010, 1095, 1176, 1263, 1350, 1441, 1432, 1119, 499, -134, -522, -678, -711, -591, -191, 475, 1185, 1660, 1796, 1691, 1427, 905, 21, -1064, -2006, -2581, -2798, -2728, -2375, -1786, -1133, -588, -159, 248, 644, 942, 1112, 1250, 1461, 1719, 1880, 1793, 1454, 1032, 694, 459, 277, 163, 146, 192, 314, 605, 1059, 1487, 1721, 1802, 1903, 2123, 2443, 2788, 3103, 3394, 3722, 4116, 4435, 4475, 4231, 3955, 3790, 3557, 3094, 2614, 2466, 2662, 2932, 3151, 3442, 3849, 4199, 4357, 4396, 4389, 4264, 4013, 3828, 3858, 4032, 4280, 4668, 5186, 5646, 5912, 6031, 6063, 5977, 5701, 5198, 4519, 3853, 3385, 3096, 2851, 2654, 2645, 2840, 3070, 3188, 3199, 3154, 3042, 2826, 2528, 2213, 1926, 1684, 1505, 1402, 1348, 1269, 1106, 846, 485, 18, -547, -1150, -1718, -2217, -2679, -3094, -3375, -3454, -3398, -3345, -3336, -3330, -3354, -3493, -3749, -4038, -4305, -4552, -4761, -4879, -4911, -4922, -4944, -4966, -4993, -5094, -5322, -5671, -6111, -6599, -7026, -7305, -7479, -7624, -7659, -7479, -7187, -6960, -6796, -6606, -6422, -6309, -6288, -6418, -6687, -6844, -6712, -6532, -6579, -6635, -6338, -5796, -5385, -5179, -4995, -4741, -4458, -4208, -4087, -4129, -4188, -4105, -3953, -3914, -3980, -3995, -3927, -3906, -3993, -4067, -4010, -3868, -3754, -3681, -3562, -3320, -2926, -2443, -2063, -1951, -2069, -2248, -2443, -2705, -2998, -3195, -3265, -3306, -3346, -3270, -2962, -2492, -2058, -1808, -1739, -1765, -1819, -1896, -2050, -2300, -2571, -2793, -2969, -3068, -2968, -2669, -2399, -2290, -2192, -1974, -1771, -1731, -1781, -1814, -1867, -1976, -2024, -1897, -1685, -1594, -1727, -1999, -2231, -2343, -2430, -2632, -2934, -3136, -3042, -2669, -2232, -1909, -1645, -1280, -847, -619, -777, -1166, -1523, -1803, -2098, -2366, -2461, -2320, -1998, -1602, -1257, -1054, -957, -866, -799, -869, -1069, -1215, -1194, -1131, -1161, -1187, -1064, -877, -777, -710, -566, -441, -429, -383, -164, 93, 198, 205, 296, 494, 680, 760, 724, 598, 444, 344, 296, 196, 57, 68, 302, 539, 646, 824, 1180, 1454, 1455, 1391, 1452, 1480, 1315, 1052, 813, 614, 530, 648, 872, 1024, 1103, 1233, 1419, 1544, 1535, 1416, 1222, 1006, 891, 988, 1235, 1482, 1704, 1932, 2052, 1998, 2031, 2405, 2881, 2984, 2700, 2487, 2642, 2975, 3132, 3008, 2771, 2639, 2671, 2752, 2734, 2605, 2491, 2469, 2469, 2457, 2589, 2941, 3272, 3357, 3338, 3432, 3523, 3440, 3292, 3182, 2935, 2459, 2036, 1930, 1981, 1899, 1726, 1724, 1908, 2030, 1979, 1929, 2012, 2086, 1957, 1645, 1317, 1075, 929, 861, 852, 882, 926, 949, 945, 971, 1063, 1146, 1094, 902, 716, 657, 693, 722, 713, 694, 665, 636, 677, 799, 858, 715, 467, 360, 469, 626, 697, 783, 1018, 1333, 1562, 1670, 1732, 1730, 1566, 1247, 909, 680, 577, 546, 530, 554, 714, 1045, 1439, 1743, 1929, 2076, 2223, 2305, 2264, 2135, 1970, 1762, 1498, 1258, 1126, 1075, 1018, 934, 884, 930, 1068, 1206, 1238, 1176, 1140, 1170, 1145, 987, 823, 817, 956, 1105, 1209, 1325, 1499, 1680, 1779, 1785, 1746, 1676, 1533, 1333, 1209, 1215, 1207, 1035, 814, 791, 946, 959, 626, 170, -16, 113, 224, 86, -66, 144, 664, 1024, 978, 806, 840, 966, 839, 413, -46, -401, -799, -1333, -1749, -1725, -1370, -1146, -1197, -1077, -438, 320, 523, 160, -148, -97, -46, -344, -751, -806, -484, -146, 34, 254, 657, 1057, 1204, 1118, 985, 827, 492, -38, -489, -591, -469, -477, -637, -546, -1, 578, 648, 304, 146, 395, 597, 416, 231, 513, 1075, 1434, 1586, 1850, 2235, 2436, 2283, 1851, 1330, 906, 598, 305, 135, 323, 696, 795, 699, 995, 1710, 2067, 1618, 901, 572, 489, 137, -427, -667, -394, 55, 452, 891, 1383, 1799, 2136, 2387, 2357, 2035, 1702, 1374, 796, 146, -108, -102, -335, -628, -393, 243, 593, 460, 233, 188, 246, 169, -239, -802, -981, -656, -442, -739, -1051, -910, -797, -1413, -2571, -3527, -4032, -4472, -5039, -5222, -4261, -2028, 782, 3440, 5892, 8369, 10493, 11408, 10789, 9195, 7335, 5389, 3240, 1098, -367, -580, 323, 1667, 3081, 4845, 7070, 8986, 9642, 9153, 8595, 8656, 8978, 9038, 9102, 9837, 11295, 12845, 13984, 14627, 14683, 13923, 12408, 10607, 8974, 7603, 6354, 5365, 5325, 6694, 8664, 9882, 10331, 11105, 12103, 11827, 9912, 7874, 6757, 5965, 4972, 4426, 4987, 6331, 7759, 8887, 9608, 9876, 9566, 8426, 6331, 3612, 872, -1464, -3241, -4371, -4794, -4588, -3919, -2885, -1641, -661, -463, -920, -1378, -1704, -2415, -3515, -4254, -4352, -4343, -4437, -4333, -4222, -4722, -5796, -6959, -8262, -10018, -11917, -13340, -14036, -13975, -13176, -11918, -10548, -9086, -7586, -6493, -6096, -6100, -6329, -7163, -8729, -10281, -10976, -10873, -10636, -10511, -10110, -9134, -7944, -7178, -7104, -7485, -7991, -8534, -9195, -9898, -10238, -9851, -8948, -8090, -7372, -6346, -4924, -3763, -3441, -3707, -3926, -3953, -4128, -4549, -4817, -4549, -3853, -3122, -2561, -2148, -1924, -2058, -2600, -3312, -3865, -4216, -4608, -5034, -4975, -4014, -2522, -1234, -328, 509, 1296, 1688, 1571, 1164, 526, -497, -1790, -2819, -3138, -2911, -2771, -3088, -3500, -3437, -2998, -2870, -3322, -3814, -3817, -3537, -3500, -3715, -3694, -3191, -2607, -2530, -3032, -3649, -4033, -4402, -5123, -6107, -6916, -7338, -7494, -7455, -7134, -6628, -6306, -6381, -6594, -6597, -6483, -6668, -7267, -7916, -8243, -8259, -8183, -8078, -7822, -7373, -6901, -6594, -6396, -6125, -5859, -5910, -6310, -6670, -6696, -6556, -6488, -6460, -6348, -6158, -5914, -5580, -5192, -4836, -4522, -4245, -4059, -3959, -3822, -3565, -3197, -2767, -2421, -2297, -2188, -1744, -1144, -964, -1195, -1216, -856, -597, -646, -729, -744, -763, -598, -127, 323, 531, 728, 1070, 1424, 1785, 2165, 2250, 1982, 1960, 2497, 3022, 3086, 3097, 3430, 3812, 4044, 4346, 4736, 4888, 4712, 4390, 4008, 3641, 3480, 3496, 3417, 3223, 3172, 3305, 3433, 3561, 3804, 3980, 3770, 3246, 2862, 2887, 3086, 3049, 2723, 2539, 2882, 3534, 3893, 3747, 3490, 3450, 3350, 2719, 1629, 666, 203, 21, -257, -624, -762, -536, -116, 342, 842, 1309, 1480, 1245, 886, 723, 688, 488, 88, -250, -387, -452, -561, -580, -358, -41, 37, -213, -490, -476, -243, -134, -299, -502, -442, -130, 192, 407, 638, 987, 1309, 1409, 1304, 1198, 1242, 1408, 1553, 1592, 1615, 1799, 2160, 2543, 2866, 3196, 3511, 3634, 3480, 3175, 2896, 2749, 2766, 2866, 2908, 2928, 3168, 3721, 4383, 4922, 5299, 5536, 5574, 5372, 5018, 4683, 4474, 4344, 4161, 3898, 3757, 3967, 4464, 4892, 4995, 4891, 4809, 4724, 4441, 4024, 3767, 3748, 3736, 3616, 3600, 3886, 4346, 4682, 4752, 4617, 4367, 3959, 3336, 2630, 2118, 1889, 1712, 1388, 1145, 1392, 2113, 2767, 2945, 2821, 2745, 2641, 2178, 1390, 666, 174, -287, -782, -1008, -754, -268, 109, 440, 987, 1595, 1743, 1242, 532, 96, -153, -653, -1466, -2069, -1987, -1443, -1060, -961, -664, 38, 623, 640, 393, 418, 684, 759, 501, 264, 539, 1395, 2265, 2528, 2357, 2433, 2804, 2787, 2050, 1033, 234, -159, -45, 431, 710, 541, 670, 1979, 4073, 5469, 5324, 4438, 4204, 4840, 5138, 4067, 2159, 915, 1043, 1767, 1944, 1445, 1097, 1468, 2230, 2788, 2984, 2939, 2713, 2416, 2228, 2097, 1870, 1709, 1853, 2097, 2111, 2074, 2310, 2625, 2603, 2229, 1801, 1578, 1663, 1836, 1616, 991, 655, 996, 1406, 1205, 618, 196, -49, -350, -541, -380, -89, -24, 4, 543, 1619, 2497, 2544, 1986, 1483, 1189, 649, -417, -1709, -2848, -3960, -5390, -6961, -7973, -8066, -7646, -7105, -6134, -4314, -1916, 562, 3277, 6596, 9929, 11895, 11832, 10499, 8961, 7282, 4782, 1289, -2379, -5248, -6922, -7331, -6334, -4084, -1413, 933, 3217, 6099, 9300, 11650, 12471, 12205, 11713, 11441, 11308, 11038, 10621, 10344, 10221, 9737, 8659, 7558, 6948, 6501, 5743, 4896, 4485, 4770, 5791, 7287, 8706, 9923, 11362, 12808, 13234, 12542, 11882, 11618, 10744, 8938, 7289, 6530, 6329, 6469, 7057, 7703, 7863, 7602, 7164, 6382, 5173, 3799, 2358, 763, -709, -1603, -1812, -1420, -365, 1186, 2575, 3301, 3578, 3819, 3882, 3299, 2071, 641, -853, -2610, -4422, -5668, -6240, -6734, -7556, -8534, -9390, -9933, -9938, -9495, -9107, -8949, -8526, -7464, -6096, -4914, -4052, -3540, -3509, -4021, -5032, -6459, -8076, -9548, -10769, -11883, -12820, -13194, -12814, -11995, -11150, -10326, -9359, -8333, -7609, -7346, -7288, -7109, -6805, -6580, -6490, -6378, -6125, -5801, -5533, -5364, -5313, -5485, -5994, -6727, -7332, -7566, -7515, -7390, -7237, -6944, -6399, -5546, -4469, -3449, -2795, -2501, -2290, -2013, -1812, -1837, -1998, -2024, -1783, -1472, -1439, -1733, -2015, -2091, -2267, -2906, -3861, -4670, -5129, -5311, -5277, -5031, -4617, -4082, -3416, -2680, -2040, -1617, -1429, -1472, -1769, -2326, -3056, -3744, -4184, -4457, -4902, -5651, -6417, -6907, -7217, -7597, -8086, -8575, -8931, -8976, -8641, -8136, -7670, -7154, -6499, -5934, -5688, -5690, -5823, -6165, -6726, -7375, -8077, -8845, -9498, -9839, -9927, -9887, -9701, -9415, -9226, -9158, -8998, -8656, -8230, -7809, -7515, -7477, -7465, -7045, -6283, -5742, -5626, -5621, -5609, -5765, -6038, -6221, -6403, -6693, -6863, -6751, -6529, -6229, -5560, -4515, -3539, -2914, -2490, -2051, -1546, -1061, -847, -1063, -1443, -1605, -1578, -1494, -1200, -751, -656, -953, -927, -359, -45, -367, -510, 170, 1023, 1213, 1119, 1670, 2822, 3667, 3848, 3846, 3900, 3685, 3169, 2808, 2677, 2333, 1755, 1545, 1953, 2451, 2581, 2586, 2814, 3033, 2870, 2545, 2543, 2817, 2942, 2855, 2864, 3053, 3278, 3644, 4381, 5195, 5334, 4542, 3486, 2899, 2728, 2450, 1857, 1136, 533, 284, 567, 1207, 1740, 1965, 2162, 2582, 3004, 3078, 2875, 2755, 2793, 2738, 2487, 2211, 2077, 2114, 2282, 2374, 2076, 1390, 784, 628, 731, 733, 697, 902, 1248, 1425, 1617, 2340, 3443, 4055, 3794, 3299, 3227, 3371, 3189, 2677, 2239, 2068, 2046, 2068, 2144, 2248, 2348, 2511, 2745, 2861, 2763, 2686, 2836, 3048, 3132, 3248, 3583, 3991, 4277, 4567, 5045, 5525, 5652, 5398, 5089, 4929, 4789, 4514, 4178, 3905, 3674, 3457, 3378, 3572, 3963, 4369, 4748, 5123, 5401, 5515, 5664, 6015, 6345, 6367, 6195, 6037, 5788, 5396, 5159, 5202, 5109, 4570, 3860, 3373, 3130, 2972, 2833, 2684, 2540, 2529, 2708, 2967, 3233, 3581, 3984, 4247, 4215, 3893, 3439, 3160, 3167, 3013, 2236, 1206, 684, 644, 485, 154, 24, 2, -225, -478, -477, -395, -357, -130, 225, 241, -54, 2, 657, 1314, 1413, 1099, 814, 677, 430, -87, -616, -812, -872, -1273, -1841, -1859, -1256, -732, -526, -116, 572, 828, 490, 458, 1171, 1591, 781, -350, -312, 547, 656, -112, -389, 155, 359, -191, -452, 126, 677, 553, 370, 640, 744, 342, 430, 1575, 2436, 1785, 736, 973, 1966, 2023, 1139, 733, 1171, 1438, 1022, 530, 388, 346, 445, 1053, 1655, 1202, 107, 95, 1453, 2280, 1360, 13, 28, 1127, 1694, 1190, 577, 653, 1096, 1247, 964, 488, 147, 278, 827, 1147, 776, 176, 126, 719, 1409, 1723, 1630, 1433, 1337, 1076, 316, -555, -741, -279, -151, -833, -1558, -1462, -759, -134, 418, 1172, 1567, 986, 252, 531, 1121, 552, -639, -798, -203, -396, -1192, -1154, -370, -215, -1016, -1845, -2054, -1788, -1616, -2041, -2810, -2939, -2072, -1125, -884, -982, -916, -1015, -1702, -2714, -3619, -4426, -5263, -5932, -6107, -5654, -4602, -3034, -1122, 849, 2617, 3992, 4764, 4765, 4131, 3219, 2131, 697, -893, -2009, -2306, -2069, -1600, -810, 447, 2071, 3722, 4957, 5546, 5771, 6063, 6378, 6502, 6674, 7149, 7548, 7555, 7652, 8250, 8802, 8634, 7940, 7243, 6718, 6417, 6337, 6263, 6248, 6804, 7938, 8921, 9553, 10382, 11297, 11513, 11093, 10769, 10374, 9290, 8048, 7639, 7789, 7508, 6840, 6631, 7095, 7655, 7836, 7622, 7205, 6732, 6204, 5568, 4940, 4492, 4182, 3894, 3753, 3878, 4033, 3952, 3736, 3491, 2991, 2118, 1175, 391, -407, -1294, -1962, -2234, -2378, -2595, -2646, -2380, -2244, -2697, -3405, -3761, -3894, -4353, -5055, -5514, -5772, -6083, -6246, -6133, -6249, -6870, -7453, -7603, -7791, -8457, -9240, -9623, -9653, -9614, -9502, -9162, -8663, -8248, -8020, -7821, -7535, -7368, -7594, -8072, -8400, -8545, -8817, -9176, -9221, -8944, -8794, -8883, -8878, -8686, -8551, -8509, -8395, -8253, -8188, -8003, -7439, -6649, -5994, -5584, -5236, -4779, -4292, -4038, -4185, -4558, -4844, -4970, -5069, -5137, -5051, -4842, -4634, -4380, -3959, -3491, -3198, -3080, -2956, -2774, -2643, -2603, -2526, -2265, -1846, -1495, -1391, -1444, -1441, -1392, -1499, -1819, -2230, -2650, -3016, -3184, -3168, -3240, -3514, -3690, -3512, -3175, -3006, -3029, -3104, -3214, -3364, -3433, -3356, -3284, -3386, -3556, -3561, -3423, -3469, -3899, -4501, -4961, -5288, -5706, -6185, -6463, -6505, -6557, -6692, -6682, -6432, -6109, -5811, -5493, -5236, -5230, -5478, -5779, -5933, -5867, -5744, -5882, -6317, -6612, -6440, -6124, -6140, -6417, -6582, -6590, -6632, -6630, -6352, -5931, -5737, -5684, -5267, -4425, -3745, -3526, -3409, -3185, -3149, -3372, -3500, -3482, -3616, -3862, -3892, -3752, -3688, -3548, -3068, -2501, -2327, -2519, -2556, -2087, -1349, -912, -986, -1102, -690, 104, 691, 901, 1025, 1104, 972, 832, 1023, 1335, 1279, 878, 600, 685, 1006, 1399, 1807, 2257, 2787, 3261, 3437, 3409, 3563, 3900, 3986, 3708, 3482, 3540, 3716, 3955, 4350, 4724, 4796, 4659, 4586, 4604, 4589, 4491, 4193, 3567, 2854, 2617, 3020, 3546, 3663, 3523, 3700, 4362, 5043, 5248, 5018, 4720, 4545, 4387, 4083, 3630, 3173, 2896, 2882, 2997, 2991, 2807, 2714, 2965, 3399, 3579, 3321, 2888, 2721, 3020, 3503, 3655, 3384, 3219, 3535, 3918, 3767, 3186, 2719, 2535, 2380, 2126, 1873, 1698, 1645, 1851, 2353, 2857, 3055, 3089, 3296, 3567, 3550, 3362, 3391, 3487, 3210, 2750, 2697, 3026, 3210, 3176, 3299, 3591, 3656, 3432, 3323, 3508, 3651, 3459, 3132, 3016, 3106, 3192, 3321, 3673, 4118, 4321, 4326, 4533, 4932, 5019, 4688, 4490, 4648, 4650, 4228, 3877, 3945, 4123, 4163, 4242, 4410, 4436, 4335, 4366, 4521, 4541, 4348, 4114, 3995, 4022, 4145, 4280, 4412, 4571, 4701, 4706, 4666, 4690, 4636, 4291, 3787, 3426, 3203, 2909, 2614, 2589, 2795, 2903, 2809, 2775, 2957, 3125, 3040, 2806, 2596, 2327, 1907, 1492, 1233, 1043, 833, 634, 401, 97, -83, -30, -50, -419, -831, -833, -590, -622, -963, -1098, -753, -292, -183, -381, -478, -342, -316, -724, -1435, -2091, -2523, -2758, -2814, -2771, -2789, -2804, -2517, -1933, -1469, -1304, -1193, -1068, -1191, -1557, -1829, -1883, -1857, -1757, -1563, -1411, -1304, -1062, -768, -689, -748, -738, -906, -1556, -2260, -2313, -1810, -1545, -1896, -2335, -2076, -957, 301, 762, 268, -351, -294, 179, 155, -603, -1273, -1103, -504, -471, -1083, -1216, -130, 1259, 1464, 462, -392, -368, -63, -88, -295, -390, -287, 197, 1080, 1862, 2170, 2362, 2786, 3020, 2567, 1825, 1527, 1519, 952, -290, -1214, -1039, -214, 341, 436, 494, 697, 870, 977, 1178, 1430, 1446, 1162, 907, 986, 1313, 1571, 1560, 1313, 1046, 987, 1066, 913, 343, -350, -774, -903, -953, -959, -818, -629, -612, -676, -561, -405, -588, -916, -809, -368, -363, -990, -1651, -2051, -2563, -3343, -4011, -4359, -4675, -5243, -5881, -6056, -5346, -3872, -2241, -912, 154, 1102, 1851, 2343, 2606, 2372, 1247, -528, -2044, -2745, -2971, -3277, -3621, -3511, -2663, -1369, -181, 725, 1690, 2895, 3868, 4114, 3931, 4055, 4708, 5487, 5937, 5884, 5565, 5470, 5671, 5566, 4870, 4218, 4042, 3840, 3369, 3338, 4068, 4864, 5448, 6490, 8061, 9095, 9080, 8876, 9208, 9498, 8952, 7873, 7134, 6835, 6437, 5905, 5813, 6227, 6461, 6225, 6152, 6669, 7075, 6575, 5609, 5224, 5485, 5561, 5220, 5108, 5489, 5757, 5532, 5281, 5328, 5108, 4074, 2766, 2040, 1710, 955, -227, -1014, -1044, -762, -577, -454, -339, -360, -543, -733, -866, -1111, -1649, -2346, -2829, -2953, -3050, -3489, -4180, -4776, -5189, -5599, -6102, -6657, -7237, -7738, -7915, -7706, -7397, -7227, -7018, -6499, -5852, -5552, -5709, -5975, -6145, -6446, -7056, -7777, -8355, -8796, -9134, -9233, -9027, -8722, -8478, -8160, -7700, -7424, -7545, -7672, -7372, -6964, -7005, -7279, -7134, -6608, -6297, -6242, -5876, -5179, -4910, -5366, -5741, -5397, -4914, -5049, -5485, -5532, -5293, -5142, -4837, -4142, -3529, -3446, -3536, -3284, -2844, -2610, -2465, -2095, -1705, -1718, -1966, -1863, -1373, -1107, -1369, -1773, -2009, -2263, -2583, -2507, -1917, -1594, -2084, -2621, -2198, -1163, -594, -588, -480, -307, -652, -1289, -1382, -1025, -1235, -2200, -2832, -2585, -2377, -2877, -3247, -2715, -2128, -2512, -3243, -3110, -2326, -2053, -2549, -3002, -2929, -2739, -2863, -3072, -2988, -2861, -3243, -3980, -4308, -4096, -4103, -4636, -4966, -4678, -4457, -4798, -5051, -4629, -4143, -4373, -4911, -4912, -4537, -4614, -5127, -5188, -4527, -3975, -4128, -4441, -4205, -3682, -3600, -4007, -4345, -4385, -4441, -4698, -4946, -5012, -4960, -4795, -4442, -4005, -3626, -3249, -2919, -2912, -3171, -3123, -2549, -2078, -2227, -2496, -2164, -1598, -1731, -2375, -2381, -1607, -1172, -1487, -1668, -1341, -1148, -1168, -689, 181, 507, 253, 381, 1114, 1607, 1494, 1453, 1858, 2062, 1602, 1213, 1756, 2815, 3331, 3145, 2919, 2941, 3020, 3325, 4205, 5184, 5114, 3759, 2463, 2668, 4194, 5573, 5771, 5018, 4214, 4072, 4708, 5635, 6190, 6072, 5503, 4960, 4827, 5060, 5213, 5047, 4900, 4996, 4908, 4401, 4131, 4608, 5251, 5376, 5276, 5456, 5693, 5687, 5766, 6192, 6491, 6152, 5456, 5056, 5072, 5074, 4739, 4152, 3541, 3139, 3186, 3642, 4017, 3906, 3674, 4011, 4785, 5025, 4335, 3599, 3704, 4183, 4001, 3187, 2685, 2890, 3278, 3371, 3212, 2946, 2635, 2460, 2559, 2655, 2346, 1765, 1499, 1724, 1953, 1823, 1661, 1878, 2241, 2238, 1904, 1705, 1727, 1666, 1552, 1708, 1940, 1687, 1145, 1240, 2134, 2777, 2406, 1604, 1329, 1577, 1645, 1231, 646, 189, -44, 74, 527, 907, 971, 1141, 1806, 2477, 2447, 1944, 1787, 2116, 2274, 1884, 1333, 1069, 1054, 1145, 1405, 1727, 1694, 1240, 975, 1355, 1921, 1929, 1442, 1175, 1413, 1774, 2011, 2291, 2560, 2488, 2215, 2229, 2433, 2258, 1725, 1396, 1343, 1120, 687, 483, 703, 1089, 1348, 1384, 1278, 1252, 1446, 1725, 1845, 1732, 1455, 1153, 1038, 1233, 1528, 1580, 1322, 953, 626, 401, 370, 462, 342, -197, -831, -1015, -674, -258, -134, -141, 106, 619, 996, 1043, 1083, 1382, 1589, 1266, 627, 174, -59, -316, -576, -813, -1246, -1771, -1798, -1155, -535, -558, -957, -1060, -631, 40, 516, 556, 296, 115, 223, 433, 401, -24, -654, -1118, -1246, -1296, -1570, -1893, -1871, -1587, -1459, -1481, -1214, -542, 159, 579, 713, 637, 505, 601, 973, 1110, 482, -635, -1364, -1341, -1118, -1243, -1532, -1579, -1393, -1124, -740, -321, -104, -66, 12, 68, -78, -224, -44, 301, 355, -37, -568, -712, -219, 413, 356, -341, -767, -647, -636, -848, -594, 30, -20, -847, -1133, -226, 774, 752, 176, 52, 275, 172, -37, 294, 787, 513, -279, -445, 154, 440, -68, -660, -954, -1673, -3195, -4529, -4728, -4370, -4447, -4530, -3483, -1468, 233, 1184, 2178, 3622, 4747, 4757, 3921, 2945, 1859, 223, -1809, -3370, -3979, -4105, -4270, -4186, -3299, -1744, -192, 1033, 2130, 3256, 4321, 5194, 5772, 5927, 5685, 5313, 4988, 4545, 3790, 2940, 2409, 2237, 2040, 1613, 1240, 1308, 1862, 2725, 3768, 4875, 5850, 6613, 7324, 8062, 8517, 8353, 7732, 7143, 6708, 6081, 5152, 4369, 4127, 4171, 4069, 3975, 4340, 5050, 5555, 5700, 5751, 5733, 5494, 5284, 5477, 5868, 5912, 5581, 5374, 5478, 5511, 5169, 4644, 4175, 3564, 2533, 1310, 446, 132, 53, -125, -374, -407, 0, 766, 1494, 1762, 1483, 1010, 744, 677, 399, -402, -1516, -2461, -3118, -3769, -4510, -5098, -5478, -5884, -6271, -6339, -6195, -6209, -6247, -5856, -5179, -4784, -4755, -4695, -4514, -4530, -4918, -5575, -6395, -7323, -8233, -8980, -9532, -9913, -10097, -9988, -9551, -8934, -8378, -7956, -7524, -7010, -6629, -6641, -6982, -7323, -7441, -7424, -7488, -7743, -8080, -8289, -8287, -8179, -8077, -7976, -7912, -7956, -7973, -7721, -7236, -6798, -6453, -6031, -5551, -5170, -4866, -4573, -4420, -4479, -4580, -4643, -4805, -5026, -5043, -4853, -4772, -4879, -4864, -4554, -4187, -4018, -3954, -3753, -3393, -3065, -2846, -2604, -2271, -1981, -1826, -1663, -1419, -1355, -1695, -2176, -2417, -2516, -2797, -3158, -3231, -3020, -2809, -2596, -2148, -1554, -1192, -1118, -973, -610, -396, -636, -1107, -1440, -1633, -1852, -2072, -2220, -2351, -2453, -2408, -2259, -2193, -2232, -2207, -2034, -1807, -1625, -1530, -1546, -1626, -1610, -1446, -1399, -1755, -2317, -2589, -2527, -2571, -2878, -3090, -3004, -2839, -2705, -2400, -1944, -1722, -1894, -2080, -1920, -1620, -1632, -2014, -2430, -2654, -2744, -2736, -2542, -2255, -2181, -2387, -2495, -2192, -1722, -1550, -1690, -1773, -1604, -1303, -1014, -812, -807, -979, -1059, -833, -448, -243, -385, -725, -935, -780, -374, -38, 123, 289, 577, 936, 1332, 1718, 1923, 1916, 1908, 1973, 1933, 1858, 2062, 2462, 2619, 2525, 2632, 3048, 3446, 3755, 4192, 4579, 4403, 3768, 3533, 4120, 4847, 5024, 4987, 5275, 5592, 5548, 5657, 6454, 7313, 7226, 6292, 5492, 5339, 5526, 5649, 5663, 5655, 5632, 5643, 5901, 6526, 7281, 7739, 7741, 7503, 7309, 7252, 7255, 7200, 6998, 6638, 6270, 6116, 6231, 6356, 6181, 5755, 5438, 5428, 5511, 5413, 5211, 5191, 5408, 5623, 5667, 5662, 5757, 5866, 5796, 5523, 5157, 4752, 4289, 3813, 3410, 3088, 2788, 2529, 2412, 2479, 2638, 2779, 2888, 2954, 2921, 2763, 2515, 2228, 1967, 1801, 1669, 1394, 964, 640, 602, 718, 783, 779, 732, 545, 204, -29, 78, 340, 333, -14, -350, -412, -309, -215, -123, -49, -176, -547, -846, -789, -569, -563, -746, -782, -622, -534, -550, -395, -21, 245, 188, -15, -139, -198, -284, -351, -334, -331, -486, -715, -720, -386, 34, 224, 189, 152, 194, 246, 324, 475, 570, 477, 312, 268, 356, 520, 748, 916, 850, 630, 492, 473, 506, 623, 703, 446, -31, -167, 206, 624, 779, 810, 794, 709, 746, 974, 1050, 817, 592, 492, 267, 0, 7, 88, -138, -392, -242, -43, -324, -738, -591, -30, 184, -142, -475, -429, -206, -92, -71, -152, -456, -819, -859, -656, -739, -1214, -1534, -1373, -1122, -1222, -1486, -1457, -1076, -664, -458, -490, -710, -897, -729, -327, -327, -1004, -1731, -1817, -1513, -1537, -1919, -2037, -1750, -1614, -1797, -1776, -1417, -1270, -1397, -1210, -795, -917, -1476, -1531, -1069, -1074, -1749, -2237, -2152, -2059, -2356, -2720, -2727, -2371, -1936, -1641, -1461, -1249, -978, -652, -185, 240, 8, -1038, -1933, -1748, -1066, -1172, -2071, -2529, -2043, -1484, -1506, -1517, -890, -240, -499, -1310, -1509, -841, -115, 38, -316, -827, -996, -411, 602, 1133, 811, 202, -67, 57, 268, 205, -231, -613, -468, -83, -78, -324, -218, 232, 578, 795, 1046, 1146, 1044, 1128, 1476, 1626, 1441, 1270, 1207, 1058, 880, 704, 101, -1157, -2468, -3146, -3295, -3345, -3173, -2394, -1183, -100, 839, 2289, 4511, 6701, 7679, 6965, 5025, 2810, 1118, 13, -1181, -2973, -4809, -5518, -4653, -2924, -1216, 365, 2193, 4200, 5793, 6598, 6849, 6887, 6666, 5971, 4879, 3750, 2869, 2324, 2119, 2172, 2241, 2119, 1903, 1904, 2269, 2860, 3482, 4072, 4660, 5289, 6001, 6798, 7535, 7943, 7878, 7497, 7076, 6664, 6016, 4965, 3748, 2882, 2678, 3000, 3476, 3877, 4258, 4743, 5303, 5744, 5910, 5794, 5488, 5107, 4808, 4699, 4694, 4602, 4465, 4528, 4820, 4977, 4662, 3936, 3075, 2182, 1161, 18, -1005, -1603, -1652, -1254, -667, -107, 446, 1170, 2006, 2559, 2567, 2164, 1492, 505, -683, -1783, -2782, -3882, -4903, -5412, -5451, -5504, -5726, -5786, -5470, -4976, -4572, -4314, -4120, -3956, -3883, -3970, -4155, -4354, -4680, -5280, -6010, -6616, -7172, -7881, -8548, -8804, -8737, -8715, -8700, -8338, -7615, -6931, -6583, -6529, -6599, -6657, -6702, -6848, -7144, -7479, -7776, -8083, -8360, -8452, -8331, -8129, -7867, -7507, -7209, -7184, -7316, -7318, -7140, -6942, -6821, -6780, -6785, -6734, -6542, -6301, -6151, -6016, -5746, -5405, -5193, -5151, -5142, -5120, -5170, -5326, -5487, -5597, -5715, -5824, -5766, -5481, -5105, -4744, -4325, -3818, -3357, -3046, -2824, -2627, -2541, -2676, -3009, -3418, -3761, -3937, -3929, -3832, -3763, -3701, -3487, -3071, -2609, -2242, -1954, -1712, -1588, -1595, -1601, -1541, -1530, -1661, -1819, -1865, -1866, -1951, -2042, -1966, -1763, -1647, -1623, -1468, -1113, -767, -566, -404, -167, 23, -6, -233, -486, -707, -972, -1282, -1473, -1428, -1249, -1054, -747, -173, 534, 996, 1048, 938, 958, 1039, 884, 394, -195, -619, -805, -802, -659, -459, -262, -16, 298, 562, 706, 808, 868, 772, 626, 669, 816, 820, 811, 1046, 1288, 1141, 792, 743, 977, 1038, 716, 230, -74, 46, 558, 1080, 1255, 1194, 1295, 1726, 2292, 2647, 2553, 2118, 1761, 1727, 1804, 1767, 1742, 1826, 1805, 1670, 1815, 2357, 2822, 2825, 2559, 2358, 2332, 2509, 2892, 3312, 3552, 3597, 3597, 3765, 4257, 4855, 4981, 4455, 3869, 3755, 3828, 3584, 3117, 2843, 2879, 3161, 3695, 4321, 4664, 4646, 4708, 5206, 5873, 6159, 5959, 5690, 5659, 5668, 5387, 4896, 4578, 4580, 4682, 4661, 4520, 4331, 4199, 4303, 4651, 4904, 4838, 4785, 5123, 5617, 5771, 5592, 5434, 5357, 5173, 4896, 4723, 4650, 4447, 3997, 3516, 3334, 3486, 3620, 3511, 3413, 3578, 3755, 3636, 3450, 3496, 3540, 3296, 3052, 3129, 3213, 2874, 2297, 1975, 2014, 2165, 2221, 2096, 1754, 1366, 1317, 1767, 2302, 2289, 1654, 1048, 1066, 1482, 1585, 1125, 509, 121, -21, 51, 346, 580, 385, -44, -61, 496, 1033, 1031, 688, 444, 307, 81, -109, -60, -5, -305, -793, -996, -846, -644, -508, -358, -279, -397, -520, -338, 51, 206, -71, -460, -546, -334, -170, -233, -357, -373, -372, -466, -569, -621, -701, -752, -636, -550, -786, -1034, -756, -199, -68, -336, -403, -193, -65, -14, 102, 31, -394, -759, -697, -507, -615, -913, -996, -767, -512, -528, -752, -820, -572, -310, -315, -411, -360, -280, -275, -117, 223, 282, -178, -682, -739, -547, -606, -1014, -1472, -1683, -1563, -1244, -924, -645, -346, -107, -68, -168, -220, -210, -229, -294, -456, -839, -1323, -1548, -1382, -1068, -865, -900, -1217, -1565, -1433, -776, -291, -497, -981, -1033, -660, -404, -437, -460, -390, -474, -678, -700, -658, -1007, -1601, -1719, -1256, -982, -1309, -1615, -1264, -575, -246, -329, -412, -429, -562, -668, -606, -705, -1089, -1147, -627, -383, -989, -1570, -1142, -217, 73, -376, -856, -1061, -1200, -1249, -976, -588, -638, -1140, -1393, -989, -452, -430, -680, -539, -82, -32, -537, -899, -695, -405, -559, -950, -1107, -1075, -1165, -1338, -1332, -1227, -1300, -1470, -1437, -1279, -1229, -1064, -453, 261, 452, 158, -116, -226, -331, -415, -488, -870, -1676, -2386, -2427, -1924, -1440, -1172, -865, -423, -86, 64, 280, 650, 877, 747, 403, 62, -206, -350, -317, -233, -328, -617, -846, -817, -653, -598, -688, -780, -729, -464, -56, 228, 189, 28, 102, 351, 374, 19, -467, -831, -1036, -1133, -1170, -1176, -1024, -403, 757, 1855, 2191, 1998, 2181, 2822, 2965, 2179, 1194, 613, 219, -80, 91, 678, 1111, 1332, 1908, 2990, 4001, 4440, 4413, 4306, 4256, 4055, 3523, 2899, 2694, 3057, 3563, 3783, 3798, 3970, 4388, 4813, 5052, 5157, 5211, 5157, 4946, 4739, 4759, 4983, 5171, 5216, 5308, 5616, 5957, 5928, 5450, 4984, 4957, 5142, 5041, 4711, 4620, 4809, 4898, 4845, 4970, 5248, 5313, 5085, 4772, 4445, 4065, 3739, 3556, 3404, 3196, 3034, 2987, 2961, 2892, 2850, 2791, 2477, 1819, 1155, 870, 855, 642, 118, -263, -170, 79, 68, -3, 223, 421, -19, -910, -1503, -1705, -2139, -2997, -3730, -3990, -4084, -4307, -4436, -4215, -3878, -3842, -4077, -4182, -4031, -3988, -4373, -4995, -5430, -5544, -5569, -5758, -6167, -6667, -7033, -7113, -7066, -7223, -7622, -7889, -7793, -7555, -7427, -7290, -6942, -6529, -6387, -6555, -6743, -6768, -6820, -7164, -7714, -8119, -8247, -8304, -8365, -8183, -7682, -7245, -7156, -7146, -6825, -6282, -5913, -5919, -6177, -6387, -6294, -5982, -5848, -6058, -6255, -6072, -5666, -5428, -5428, -5442, -5322, -5134, -5000, -4917, -4719, -4366, -4106, -4109, -4070, -3660, -3159, -3053, -3210, -3138, -2842, -2716, -2818, -2875, -2765, -2588, -2468, -2515, -2653, -2534, -2022, -1553, -1553, -1758, -1656, -1266, -973, -849, -661, -420, -385, -553, -559, -244, 18, -170, -605, -719, -407, -162, -290, -456, -327, -107, -92, -92, 170, 523, 650, 644, 776, 979, 1021, 969, 1075, 1259, 1174, 788, 489, 483, 536, 425, 252, 181, 253, 512, 949, 1346, 1519, 1580, 1691, 1760, 1659, 1464, 1294, 1117, 885, 652, 492, 422, 441, 532, 637, 728, 828, 948, 1022, 1021, 1022, 1084, 1105, 963, 782, 817, 1043, 1113, 845, 524, 512, 709, 702, 385, 102, 124, 327, 499, 649, 831, 952, 946, 943, 1080, 1286, 1363, 1226, 992, 840, 811, 798, 741, 766, 1002, 1325, 1440, 1275, 1133, 1324, 1742, 1938, 1679, 1287, 1272, 1662, 2016, 2099, 2140, 2301, 2383, 2288, 2312, 2631, 2910, 2785, 2409, 2204, 2265, 2357, 2375, 2438, 2592, 2747, 2924, 3206, 3462, 3514, 3490, 3621, 3791, 3733, 3534, 3496, 3598, 3546, 3321, 3265, 3526, 3777, 3657, 3296, 3139, 3319, 3497, 3403, 3231, 3309, 3619, 3874, 3975, 4066, 4203, 4259, 4154, 3944, 3686, 3352, 2946, 2580, 2418, 2507, 2671, 2705, 2697, 2957, 3511, 3935, 3893, 3525, 3183, 3022, 2955, 2781, 2357, 1802, 1463, 1502, 1714, 1899, 2087, 2308, 2415, 2343, 2226, 2121, 1894, 1535, 1310, 1359, 1375, 1058, 692, 753, 1150, 1420, 1465, 1470, 1358, 994, 628, 538, 547, 366, 71, -93, -49, 170, 458, 607, 547, 488, 567, 574, 292, -95, -270, -249, -310, -529, -643, -440, -75, 126, 106, 82, 146, 96, -178, -436, -449, -411, -617, -942, -986, -645, -229, -49, -107, -188, -138, -53, -158, -466, -720, -727, -636, -693, -837, -776, -464, -212, -204, -224, -66, 70, -85, -422, -658, -771, -921, -1076, -1038, -792, -558, -486, -468, -347, -174, -145, -331, -575, -656, -553, -531, -826, -1207, -1164, -671, -299, -392, -621, -622, -513, -522, -623, -746, -912, -1027, -949, -745, -616, -600, -598, -585, -584, -577, -573, -645, -857, -1207, -1553, -1642, -1395, -1120, -1118, -1173, -912, -475, -306, -411, -454, -414, -557, -921, -1285, -1500, -1553, -1515, -1520, -1560, -1397, -961, -571, -449, -426, -381, -470, -692, -776, -719, -853, -1235, -1503, -1456, -1295, -1206, -1076, -793, -513, -420, -425, -305, -82, -50, -343, -704, -793, -613, -436, -418, -475, -491, -425, -269, -104, -80, -168, -183, -138, -240, -449, -489, -378, -392, -502, -409, -131, 19, -28, -63, 1, 68, 113, 180, 234, 188, 49, -67, -42, 116, 228, 99, -243, -512, -466, -202, -58, -206, -460, -541, -387, -122, 138, 335, 444, 496, 514, 433, 207, -23, -90, -94, -335, -842, -1201, -1044, -524, -119, -21, 12, 196, 424, 546, 662, 871, 940, 585, 16, -263, -167, -92, -276, -502, -504, -305, -83, 42, 51, -7, -52, -56, -67, -123, -208, -317, -453, -592, -696, -780, -902, -1102, -1314, -1383, -1208, -871, -573, -398, -188, 263, 880, 1338, 1467, 1435, 1390, 1140, 498, -251, -631, -580, -447, -402, -240, 242, 936, 1580, 2079, 2554, 3045, 3289, 3064, 2663, 2532, 2535, 2225, 1765, 1749, 2167, 2447, 2486, 2753, 3351, 3821, 3914, 3871, 3934, 4048, 4077, 4004, 3925, 3921, 3982, 4046, 4153, 4388, 4653, 4752, 4676, 4584, 4468, 4245, 4037, 4021, 4105, 4111, 4092, 4165, 4281, 4374, 4443, 4396, 4189, 4035, 4064, 3986, 3579, 3166, 3113, 3232, 3159, 2962, 2899, 2879, 2608, 2118, 1735, 1580, 1450, 1205, 941, 753, 618, 587, 751, 958, 942, 714, 504, 321, -52, -632, -1168, -1565, -2027, -2642, -3117, -3174, -2987, -2924, -2999, -2950, -2750, -2666, -2837, -3074, -3188, -3275, -3597, -4179, -4684, -4829, -4827, -5090, -5561, -5821, -5816, -5912, -6200, -6361, -6271, -6168, -6166, -6114, -5927, -5698, -5534, -5512, -5664, -5873, -6013, -6195, -6591, -7092, -7407, -7463, -7434, -7406, -7267, -6929, -6500, -6169, -5997, -5866, -5682, -5540, -5585, -5743, -5793, -5710, -5708, -5871, -5969, -5795, -5503, -5416, -5546, -5589, -5378, -5092, -4939, -4904, -4863, -4714, -4397, -4021, -3843, -3854, -3703, -3316, -3071, -3126, -3161, -3036, -3019, -3155, -3120, -2867, -2764, -2939, -3052, -2851, -2490, -2217, -2041, -1838, -1573, -1322, -1137, -996, -855, -718, -607, -537, -557, -690, -818, -761, -590, -598, -817, -877, -597, -290, -231, -207, 30, 309, 375, 373, 575, 875, 938, 753, 666, 838, 1003, 892, 619, 461, 460, 443, 307, 150, 141, 307, 460, 506, 673, 1124, 1533, 1537, 1382, 1501, 1718, 1552, 1084, 781, 692, 484, 118, -68, 88, 377, 532, 552, 627, 841, 1029, 1016, 891, 841, 830, 723, 618, 659, 733, 693, 658, 741, 783, 684, 600, 580, 460, 276, 274, 418, 432, 338, 452, 821, 1143, 1233, 1230, 1316, 1448, 1475, 1373, 1266, 1226, 1162, 1019, 952, 1139, 1480, 1683, 1684, 1754, 2062, 2347, 2281, 2035, 2071, 2397, 2513, 2229, 2045, 2411, 3029, 3299, 3190, 3192, 3468, 3642, 3467, 3216, 3170, 3145, 2884, 2632, 2811, 3305, 3597, 3649, 3935, 4513, 4823, 4670, 4551, 4713, 4735, 4361, 3947, 3809, 3816, 3776, 3710, 3669, 3715, 3967, 4395, 4750, 4851, 4731, 4501, 4313, 4322, 4453, 4392, 4037, 3700, 3653, 3789, 3869, 3861, 3827, 3744, 3575, 3364, 3198, 3136, 3140, 3089, 2962, 2911, 2962, 2898, 2720, 2811, 3250, 3440, 2920, 2100, 1650, 1618, 1595, 1361, 1031, 830, 901, 1141, 1299, 1359, 1518, 1708, 1614, 1240, 906, 665, 307, -92, -232, -180, -315, -656, -747, -342, 220, 459, 319, 123, 43, -111, -488, -833, -878, -829, -1015, -1242, -1118, -806, -780, -938, -766, -266, -15, -300, -795, -1064, -1016, -884, -935, -1131, -1151, -891, -660, -635, -532, -171, 67, -203, -722, -910, -666, -419, -499, -746, -818, -667, -536, -500, -315, 89, 320, 78, -295, -324, -109, -34, -94, -38, 66, -21, -221, -234, -22, 158, 128, -45, -212, -298, -273, -142, -8, -12, -127, -129, 117, 451, 585, 416, 107, -72, -39, 0, -145, -374, -529, -667, -797, -664, -241, 20, -124, -271, -96, 92, -47, -324, -463, -549, -711, -844, -883, -938, -1047, -1077, -963, -826, -819, -930, -981, -868, -780, -982, -1371, -1546, -1410, -1263, -1259, -1248, -1190, -1203, -1227, -1143, -1110, -1278, -1437, -1393, -1340, -1477, -1666, -1785, -1954, -2142, -2022, -1541, -1175, -1303, -1624, -1594, -1239, -1051, -1198, -1356, -1337, -1355, -1537, -1637, -1517, -1468, -1712, -1922, -1695, -1243, -1090, -1243, -1263, -1062, -993, -1121, -1060, -682, -470, -805, -1309, -1334, -841, -357, -255, -475, -784, -928, -734, -358, -199, -361, -503, -416, -337, -415, -306, 179, 453, -32, -665, -422, 408, 621, 93, -127, 250, 382, -24, -158, 416, 965, 718, -30, -412, -116, 343, 396, 122, -45, -30, -54, -32, 302, 732, 754, 462, 459, 848, 1077, 863, 562, 439, 254, -116, -285, -38, 137, -142, -386, 5, 660, 839, 659, 775, 1185, 1321, 1084, 929, 994, 909, 534, 231, 234, 272, 78, -133, -56, 182, 263, 216, 314, 593, 826, 893, 816, 492, -110, -632, -797, -1014, -1667, -2143, -1666, -710, -263, -195, 323, 1277, 1969, 2229, 2308, 2077, 1263, 147, -671, -1026, -1209, -1409, -1501, -1320, -865, -176, 736, 1724, 2453, 2726, 2680, 2555, 2374, 2071, 1746, 1523, 1282, 843, 388, 365, 898, 1611, 2097, 2298, 2389, 2506, 2705, 2965, 3196, 3290, 3240, 3164, 3199, 3345, 3417, 3289, 3122, 3197, 3486, 3636, 3447, 3142, 3035, 3153, 3306, 3396, 3499, 3682, 3865, 3912, 3798, 3653, 3614, 3682, 3748, 3739, 3693, 3659, 3604, 3519, 3530, 3660, 3616, 3115, 2409, 2072, 2191, 2172, 1587, 853, 707, 1235, 1800, 1943, 1904, 2137, 2602, 2841, 2574, 1963, 1345, 872, 450, -98, -829, -1580, -2059, -2087, -1791, -1505, -1432, -1441, -1267, -871, -542, -603, -1029, -1447, -1609, -1693, -2011, -2583, -3188, -3651, -3908, -3989, -4074, -4336, -4626, -4658, -4463, -4340, -4332, -4216, -3938, -3697, -3604, -3599, -3689, -3961, -4336, -4602, -4784, -5139, -5691, -6064, -6048, -5935, -6032, -6182, -6058, -5692, -5341, -5101, -4918, -4819, -4836, -4820, -4632, -4453, -4544, -4788, -4852, -4765, -4866, -5188, -5444, -5533, -5599, -5640, -5514, -5266, -5075, -4945, -4739, -4428, -4129, -3913, -3743, -3554, -3367, -3277, -3332, -3462, -3543, -3553, -3584, -3712, -3883, -3968, -3952, -3930, -3942, -3891, -3690, -3393, -3090, -2767, -2365, -1933, -1622, -1483, -1422, -1377, -1409, -1559, -1781, -2025, -2253, -2391, -2432, -2495, -2563, -2419, -2013, -1647, -1492, -1318, -931, -524, -332, -272, -158, -16, 35, 27, 30, -36, -298, -659, -873, -891, -947, -1210, -1471, -1381, -897, -297, 190, 567, 896, 1205, 1526, 1804, 1813, 1446, 948, 608, 341, -92, -579, -771, -602, -366, -224, 9, 468, 941, 1170, 1204, 1209, 1172, 1039, 966, 1112, 1299, 1211, 880, 663, 716, 824, 801, 707, 582, 329, 18, -60, 166, 392, 410, 450, 777, 1229, 1491, 1632, 1885, 2084, 1882, 1406, 1105, 1050, 981, 855, 753, 565, 297, 309, 791, 1373, 1654, 1690, 1687, 1673, 1651, 1717, 1902, 2090, 2148, 2067, 2013, 2178, 2460, 2514, 2279, 2118, 2193, 2129, 1673, 1222, 1265, 1625, 1799, 1790, 2053, 2663, 3174, 3381, 3583, 3889, 3948, 3648, 3395, 3373, 3186, 2604, 2053, 1962, 2159, 2257, 2270, 2487, 2916, 3301, 3523, 3663, 3751, 3751, 3751, 3808, 3751, 3466, 3194, 3186, 3284, 3175, 2887, 2729, 2874, 3169, 3315, 3160, 2847, 2682, 2791, 3028, 3181, 3147, 2969, 2843, 2952, 3148, 3055, 2654, 2402, 2519, 2599, 2270, 1819, 1747, 1981, 2033, 1805, 1704, 1940, 2222, 2283, 2217, 2109, 1872, 1589, 1507, 1551, 1388, 984, 636, 512, 561, 737, 960, 1050, 959, 853, 834, 847, 850, 834, 680, 283, -192, -395, -200, 106, 138, -149, -417, -331, 56, 356, 223, -257, -634, -659, -608, -768, -928, -824, -683, -763, -804, -576, -402, -553, -722, -639, -591, -840, -1156, -1250, -1186, -1140, -1157, -1210, -1245, -1191, -1091, -1053, -1049, -996, -943, -938, -892, -821, -923, -1153, -1159, -898, -796, -1095, -1459, -1500, -1261, -1037, -1005, -1129, -1217, -1127, -970, -907, -839, -598, -342, -346, -520, -570, -499, -522, -651, -734, -790, -953, -1147, -1104, -748, -359, -243, -365, -395, -131, 264, 459, 313, 5, -184, -182, -155, -256, -449, -603, -624, -471, -186, 57, 92, 1, 53, 315, 518, 438, 247, 240, 373, 348, 117, -36, 27, 110, 52, 8, 124, 198, 34, -109, 119, 518, 587, 360, 304, 513, 652, 635, 697, 847, 814, 584, 452, 512, 495, 247, 6, 13, 124, 79, -74, -101, 93, 417, 702, 745, 558, 509, 840, 1209, 1133, 697, 358, 292, 363, 470, 554, 474, 192, -93, -152, 50, 321, 379, 152, -60, 45, 338, 526, 660, 898, 1028, 832, 626, 794, 1097, 1019, 531, 12, -293, -402, -409, -414, -448, -403, -168, 197, 568, 862, 1001, 982, 973, 1037, 943, 536, 93, -76, -122, -335, -621, -679, -476, -242, -158, -211, -215, 23, 435, 701, 672, 541, 495, 501, 532, 638, 708, 504, 21, -469, -747, -791, -688, -566, -577, -732, -827, -621, -115, 404, 627, 511, 321, 287, 321, 181, -148, -480, -758, -1113, -1574, -1977, -2170, -2158, -2048, -1964, -1969, -1980, -1839, -1525, -1172, -876, -597, -297, -72, -53, -254, -562, -877, -1198, -1559, -1954, -2322, -2617, -2775, -2698, -2343, -1848, -1402, -1029, -621, -185, 161, 385, 517, 485, 189, -266, -610, -686, -600, -572, -714, -899, -879, -581, -218, -20, 67, 268, 626, 937, 1060, 1104, 1250, 1489, 1667, 1724, 1738, 1755, 1713, 1573, 1406, 1302, 1262, 1251, 1279, 1353, 1421, 1468, 1597, 1913, 2324, 2606, 2650, 2569, 2570, 2737, 2935, 2954, 2747, 2487, 2376, 2401, 2371, 2163, 1858, 1633, 1544, 1486, 1372, 1273, 1340, 1584, 1822, 1909, 1951, 2165, 2528, 2705, 2472, 2023, 1691, 1504, 1229, 776, 300, -51, -279, -396, -364, -226, -140, -162, -134, 82, 372, 475, 319, 60, -139, -277, -442, -705, -1058, -1429, -1754, -2002, -2182, -2335, -2493, -2624, -2642, -2544, -2460, -2467, -2441, -2248, -2005, -1948, -2113, -2295, -2356, -2414, -2663, -3111, -3566, -3850, -3941, -3951, -4009, -4133, -4206, -4107, -3880, -3686, -3595, -3547, -3493, -3471, -3493, -3492, -3423, -3346, -3374, -3542, -3745, -3836, -3807, -3810, -3944, -4133, -4263, -4323, -4323, -4204, -3959, -3743, -3683, -3682, -3527, -3215, -2977, -2942, -2959, -2848, -2665, -2598, -2705, -2899, -3073, -3175, -3235, -3336, -3490, -3585, -3521, -3323, -3080, -2833, -2595, -2357, -2072, -1709, -1354, -1170, -1192, -1288, -1345, -1407, -1565, -1773, -1896, -1909, -1933, -2034, -2092, -1949, -1636, -1327, -1140, -997, -769, -456, -183, -41, -13, -53, -117, -123, 0, 147, 102, -177, -445, -468, -352, -385, -603, -720, -511, -109, 192, 340, 518, 828, 1133, 1245, 1165, 1035, 948, 884, 768, 545, 228, -52, -129, 29, 240, 297, 234, 294, 598, 949, 1046, 867, 704, 811, 1081, 1214, 1075, 802, 615, 626, 763, 808, 597, 255, 96, 227, 407, 377, 188, 82, 177, 386, 589, 767, 936, 1067, 1121, 1076, 927, 755, 708, 805, 871, 765, 553, 377, 315, 439, 741, 985, 890, 565, 463, 812, 1307, 1496, 1322, 1125, 1200, 1509, 1806, 1904, 1801, 1647, 1609, 1689, 1694, 1467, 1116, 913, 1000, 1250, 1428, 1463, 1558, 1939, 2484, 2804, 2744, 2554, 2493, 2523, 2499, 2369, 2170, 2023, 2086, 2323, 2451, 2356, 2304, 2530, 2862, 2975, 2809, 2557, 2386, 2380, 2554, 2814, 2948, 2865, 2769, 2888, 3118, 3195, 3114, 3056, 3037, 2980, 2945, 2956, 2861, 2625, 2484, 2551, 2634, 2610, 2628, 2767, 2865, 2803, 2722, 2763, 2846, 2808, 2653, 2530, 2507, 2523, 2508, 2429, 2250, 1981, 1748, 1666, 1684, 1646, 1500, 1347, 1303, 1382, 1506, 1609, 1668, 1667, 1564, 1355, 1141, 1023, 958, 810, 530, 219, 6, -66, -34, 37, 93, 118, 113, 64, -3, -28, -31, -151, -415, -636, -674, -656, -766, -958, -1037, -964, -883, -887, -921, -936, -973, -1062, -1164, -1270, -1422, -1574, -1585, -1447, -1361, -1459, -1583, -1490, -1224, -1085, -1210, -1397, -1403, -1266, -1191, -1261, -1378, -1436, -1444, -1472, -1531, -1558, -1517, -1457, -1421, -1375, -1274, -1157, -1078, -978, -748, -461, -345, -468, -590, -529, -475, -665, -959, -1074, -1060, -1139, -1227, -1047, -644, -359, -309, -214, 148, 592, 780, 677, 540, 511, 455, 234, -52, -205, -197, -180, -254, -324, -218, 95, 463, 708, 779, 746, 747, 890, 1121, 1240, 1126, 896, 703, 553, 417, 342, 326, 309, 351, 548, 782, 835, 769, 834, 1017, 1050, 879, 789, 915, 987, 768, 472, 425, 543, 501, 289, 191, 293, 388, 363, 334, 399, 463, 424, 335, 319, 392, 470, 455, 283, 21, -97, 58, 257, 146, -241, -506, -427, -204, -124, -236, -397, -476, -404, -177, 86, 187, 59, -132, -221, -220, -205, -204, -294, -576, -942, -1137, -1074, -872, -642, -495, -590, -865, -908, -429, 307, 736, 585, 79, -335, -382, -213, -240, -632, -1106, -1295, -1209, -1121, -1114, -1025, -807, -657, -657, -601, -374, -258, -556, -1074, -1331, -1235, -1168, -1342, -1476, -1295, -1004, -909, -887, -621, -163, 88, -78, -459, -695, -641, -486, -520, -762, -935, -826, -525, -224, 60, 366, 562, 503, 359, 480, 847, 1024, 795, 504, 531, 774, 926, 975, 1114, 1341, 1468, 1450, 1462, 1607, 1761, 1807, 1856, 2080, 2385, 2485, 2338, 2254, 2450, 2729, 2800, 2698, 2669, 2740, 2697, 2487, 2363, 2546, 2914, 3162, 3195, 3198, 3336, 3538, 3635, 3599, 3519, 3440, 3344, 3227, 3114, 3004, 2905, 2847, 2833, 2845, 2909, 3057, 3189, 3137, 2921, 2773, 2813, 2850, 2662, 2355, 2230, 2332, 2374, 2157, 1865, 1770, 1845, 1835, 1625, 1366, 1213, 1145, 1048, 900, 750, 604, 431, 241, 79, -54, -211, -404, -590, -731, -843, -949, -1031, -1073, -1102, -1171, -1329, -1573, -1841, -2057, -2231, -2476, -2866, -3301, -3588, -3644, -3578, -3541, -3551, -3509, -3368, -3213, -3145, -3162, -3235, -3394, -3670, -4007, -4333, -4651, -4952, -5172, -5287, -5349, -5360, -5233, -4981, -4755, -4643, -4545, -4360, -4173, -4142, -4268, -4410, -4491, -4586, -4756, -4939, -5064, -5181, -5353, -5456, -5326, -5054, -4893, -4865, -4728, -4398, -4083, -3943, -3901, -3862, -3840, -3843, -3840, -3853, -3944, -4110, -4259, -4264, -4084, -3871, -3837, -3905, -3775, -3420, -3163, -3136, -3080, -2846, -2643, -2624, -2626, -2502, -2366, -2356, -2413, -2400, -2303, -2214, -2201, -2219, -2172, -2033, -1895, -1853, -1858, -1754, -1498, -1272, -1253, -1355, -1345, -1180, -1038, -1010, -1005, -945, -870, -809, -709, -555, -425, -395, -427, -448, -459, -510, -602, -653, -600, -484, -373, -253, -90, 85, 265, 491, 659, 574, 320, 231, 320, 227, -94, -271, -202, -180, -244, -116, 187, 328, 256, 254, 426, 592, 626, 580, 525, 487, 489, 523, 499, 373, 253, 234, 191, -14, -213, -146, 73, 140, 84, 199, 516, 777, 870, 880, 847, 732, 606, 574, 591, 505, 294, 145, 234, 485, 638, 607, 615, 872, 1220, 1313, 1096, 872, 893, 1072, 1147, 1011, 846, 904, 1196, 1464, 1530, 1513, 1573, 1638, 1592, 1518, 1538, 1545, 1391, 1213, 1284, 1589, 1833, 1911, 2031, 2262, 2374, 2282, 2239, 2339, 2335, 2136, 1990, 2028, 2109, 2169, 2281, 2426, 2515, 2565, 2572, 2467, 2335, 2340, 2401, 2318, 2182, 2269, 2562, 2781, 2839, 2916, 3079, 3166, 3099, 3020, 2980, 2791, 2376, 2008, 1926, 1986, 1968, 1990, 2265, 2674, 2921, 2994, 3110, 3283, 3246, 2908, 2545, 2398, 2325, 2072, 1703, 1497, 1557, 1713, 1800, 1842, 1940, 2093, 2185, 2129, 1957, 1789, 1710, 1654, 1502, 1310, 1285, 1446, 1528, 1370, 1163, 1125, 1163, 1066, 857, 722, 692, 640, 527, 474, 549, 651, 667, 624, 598, 576, 494, 337, 148, -24, -137, -160, -137, -151, -192, -131, 77, 256, 221, 57, -1, 60, 11, -259, -536, -577, -447, -410, -540, -613, -448, -200, -124, -173, -120, -20, -130, -403, -512, -409, -382, -533, -638, -540, -303, -41, 150, 182, 119, 144, 242, 177, -116, -370, -383, -345, -500, -682, -559, -214, -17, 16, 221, 628, 880, 836, 765, 842, 872, 657, 323, 121, 87, 94, 74, 72, 133, 293, 570, 878, 1079, 1184, 1336, 1524, 1544, 1344, 1180, 1227, 1278, 1103, 909, 1011, 1223, 1142, 921, 1050, 1453, 1566, 1310, 1207, 1471, 1716, 1663, 1548, 1626, 1763, 1731, 1616, 1657, 1818, 1805, 1513, 1214, 1175, 1288, 1315, 1260, 1271, 1304, 1250, 1216, 1370, 1591, 1644, 1551, 1472, 1423, 1340, 1223, 1065, 865, 760, 839, 923, 823, 673, 716, 898, 975, 907, 847, 861, 839, 707, 554, 510, 574, 629, 584, 467, 401, 473, 577, 491, 187, -75, -119, -115, -272, -485, -526, -405, -306, -302, -308, -231, -74, 24, -63, -287, -490, -673, -964, -1309, -1519, -1634, -1886, -2236, -2335, -2069, -1799, -1870, -2095, -2070, -1807, -1739, -2054, -2434, -2530, -2419, -2402, -2561, -2685, -2581, -2346, -2255, -2384, -2489, -2406, -2344, -2538, -2834, -2915, -2783, -2694, -2722, -2705, -2539, -2317, -2151, -2044, -1945, -1854, -1819, -1835, -1834, -1787, -1776, -1866, -1961, -1890, -1658, -1484, -1529, -1653, -1578, -1261, -965, -905, -982, -938, -707, -463, -376, -407, -388, -244, -38, 122, 184, 158, 70, -30, -72, 7, 172, 287, 261, 203, 330, 671, 1004, 1148, 1176, 1266, 1430, 1509, 1433, 1302, 1248, 1247, 1190, 1058, 957, 984, 1102, 1192, 1202, 1212, 1316, 1485, 1609, 1647, 1651, 1623, 1504, 1321, 1214, 1249, 1291, 1184, 980, 882, 982, 1119, 1069, 846, 673, 666, 660, 491, 276, 234, 334, 327, 154, 52, 163, 280, 168, -57, -141, -139, -327, -720, -1014, -1048, -1036, -1212, -1476, -1553, -1404, -1281, -1359, -1488, -1464, -1373, -1457, -1704, -1851, -1815, -1814, -1983, -2161, -2172, -2106, -2172, -2383, -2567, -2620, -2624, -2695, -2804, -2815, -2693, -2565, -2533, -2530, -2422, -2226, -2110, -2175, -2326, -2413, -2437, -2520, -2713, -2920, -3051, -3120, -3158, -3107, -2914, -2669, -2532, -2511, -2409, -2119, -1843, -1865, -2123, -2252, -2098, -1959, -2142, -2482, -2558, -2282, -2020, -2070, -2280, -2304, -2093, -1914, -1922, -1961, -1839, -1616, -1455, -1352, -1187, -986, -906, -985, -1077, -1078, -1056, -1109, -1202, -1254, -1263, -1259, -1198, -1007, -745, -573, -543, -521, -382, -189, -92, -124, -188, -220, -254, -303, -295, -192, -87, -81, -118, -53, 124, 253, 216, 101, 60, 103, 133, 135, 198, 355, 506, 567, 570, 601, 679, 753, 768, 686, 506, 296, 154, 108, 68, -46, -171, -142, 79, 338, 474, 520, 615, 754, 803, 719, 589, 436, 204, -68, -241, -270, -272, -339, -404, -337, -122, 111, 235, 284, 370, 448, 372, 190, 128, 199, 185, 48, -10, 30, -38, -212, -188, 132, 436, 429, 224, 172, 404, 695, 776, 716, 775, 924, 878, 684, 767, 1190, 1391, 1015, 494, 437, 828, 1167, 1155, 969, 949, 1184, 1423, 1467, 1497, 1724, 1935, 1830, 1601, 1611, 1765, 1761, 1689, 1814, 2028, 2034, 1869, 1809, 1969, 2221, 2371, 2319, 2157, 2101, 2208, 2289, 2213, 2086, 2062, 2120, 2193, 2308, 2475, 2545, 2422, 2321, 2488, 2743, 2719, 2469, 2349, 2383, 2318, 2208, 2316, 2538, 2530, 2336, 2349, 2628, 2787, 2605, 2347, 2292, 2333, 2240, 2079, 2043, 2084, 2023, 1919, 1986, 2189, 2280, 2235, 2279, 2389, 2224, 1752, 1431, 1520, 1679, 1574, 1376, 1354, 1455, 1537, 1621, 1726, 1777, 1762, 1742, 1697, 1565, 1377, 1205, 1051, 922, 901, 1031, 1172, 1134, 946, 882, 1094, 1359, 1335, 1055, 890, 973, 1036, 901, 782, 830, 836, 665, 554, 701, 908, 902, 738, 591, 436, 218, 103, 235, 378, 198, -171, -292, -80, 139, 188, 170, 111, -96, -380, -517, -500, -547, -754, -994, -1149, -1242, -1301, -1290, -1236, -1260, -1376, -1419, -1312, -1250, -1419, -1673, -1748, -1697, -1787, -1995, -2005, -1801, -1786, -2139, -2448, -2318, -2028, -2126, -2570, -2826, -2705, -2577, -2647, -2636, -2398, -2236, -2326, -2381, -2183, -1977, -2061, -2356, -2614, -2754, -2845, -2925, -2946, -2870, -2759, -2701, -2619, -2348, -1967, -1777, -1846, -1902, -1814, -1793, -1962, -2119, -2085, -1954, -1859, -1793, -1740, -1715, -1669, -1537, -1374, -1293, -1315, -1341, -1287, -1158, -1048, -1012, -978, -798, -471, -211, -214, -392, -439, -239, -14, 4, -108, -144, -73, 7, 99, 240, 353, 335, 235, 225, 388, 651, 887, 1043, 1150, 1258, 1375, 1526, 1733, 1889, 1777, 1366, 916, 645, 507, 450, 548, 757, 878, 952, 1303, 2004, 2665, 2912, 2788, 2569, 2391, 2175, 1791, 1253, 751, 436, 296, 306, 536, 930, 1243, 1394, 1591, 1921, 2150, 2130, 2025, 1958, 1780, 1406, 1039, 911, 964, 960, 779, 543, 468, 563, 624, 564, 543, 638, 670, 577, 646, 1033, 1395, 1316, 880, 533, 512, 621, 483, -54, -708, -1004, -813, -510, -470, -581, -439, 34, 459, 524, 366, 299, 346, 301, 82, -168, -324, -371, -316, -198, -164, -336, -554, -505, -183, 18, -180, -557, -698, -513, -253, -110, -73, -93, -105, 77, 536, 930, 854, 498, 406, 590, 532, 58, -388, -466, -366, -386, -486, -467, -272, 53, 485, 889, 1037, 962, 1011, 1321, 1513, 1250, 738, 386, 246, 109, -72, -225, -404, -651, -712, -334, 235, 499, 482, 679, 1219, 1692, 1849, 1841, 1760, 1499, 1098, 743, 437, 43, -409, -749, -914, -954, -866, -554, -2, 597, 986, 1084, 1076, 1176, 1355, 1373, 1057, 499, -56, -475, -790, -1040, -1206, -1311, -1447, -1611, -1655, -1470, -1162, -939, -853, -782, -664, -553, -473, -411, -424, -542, -653, -711, -913, -1327, -1641, -1609, -1508, -1709, -2044, -2051, -1674, -1311, -1195, -1120, -858, -493, -197, 2, 86, -17, -199, -170, 84, 198, -58, -415, -466, -210, 21, 28, -63, -39, 163, 490, 832, 1079, 1218, 1377, 1630, 1863, 1975, 2040, 2131, 2195, 2199, 2207, 2221, 2169, 2089, 2094, 2194, 2289, 2323, 2318, 2368, 2595, 2954, 3181, 3176, 3208, 3461, 3710, 3743, 3714, 3772, 3751, 3554, 3401, 3424, 3410, 3197, 2980, 2957, 2990, 2884, 2787, 2926, 3148, 3150, 3020, 3086, 3308, 3356, 3201, 3101, 3085, 2926, 2599, 2340, 2270, 2236, 2040, 1683, 1350, 1197, 1179, 1149, 1079, 1039, 1018, 977, 980, 1055, 1032, 810, 579, 498, 374, 0, -436, -634, -705, -980, -1409, -1592, -1443, -1371, -1624, -1908, -1911, -1802, -1872, -2046, -2113, -2143, -2332, -2627, -2810, -2845, -2925, -3170, -3453, -3562, -3519, -3565, -3828, -4118, -4193, -4110, -4156, -4435, -4691, -4665, -4464, -4410, -4573, -4720, -4677, -4514, -4383, -4402, -4617, -4895, -5017, -4980, -5011, -5182, -5325, -5366, -5398, -5414, -5346, -5282, -5338, -5376, -5208, -4960, -4899, -4987, -4927, -4654, -4469, -4558, -4697, -4622, -4451, -4482, -4710, -4873, -4844, -4749, -4700, -4653, -4524, -4353, -4235, -4156, -3976, -3649, -3358, -3271, -3275, -3170, -3019, -3001, -3067, -3013, -2875, -2900, -3110, -3189, -2931, -2555, -2410, -2500, -2503, -2232, -1831, -1556, -1494, -1548, -1557, -1431, -1214, -1042, -1010, -1084, -1149, -1099, -939, -811, -831, -906, -843, -634, -470, -445, -433, -317, -137, 24, 153, 267, 366, 439, 469, 485, 543, 627, 628, 525, 444, 437, 382, 241, 213, 433, 708, 779, 710, 797, 1127, 1447, 1490, 1325, 1247, 1344, 1377, 1187, 987, 1030, 1172, 1119, 930, 927, 1152, 1318, 1285, 1255, 1402, 1588, 1586, 1446, 1436, 1639, 1794, 1680, 1464, 1478, 1713, 1848, 1730, 1572, 1582, 1675, 1659, 1507, 1350, 1302, 1396, 1579, 1749, 1827, 1823, 1838, 1957, 2135, 2213, 2105, 1932, 1878, 1914, 1851, 1653, 1524, 1604, 1754, 1771, 1689, 1691, 1799, 1842, 1747, 1668, 1769, 1976, 2089, 2035, 1936, 1925, 2008, 2092, 2083, 1961, 1789, 1658, 1618, 1629, 1588, 1471, 1390, 1454, 1574, 1586, 1538, 1633, 1858, 1944, 1790, 1668, 1812, 2041, 2013, 1714, 1462, 1450, 1516, 1433, 1258, 1213, 1324, 1381, 1272, 1168, 1262, 1461, 1509, 1361, 1255, 1380, 1623, 1738, 1658, 1504, 1383, 1343, 1404, 1498, 1446, 1176, 891, 860, 1074, 1262, 1226, 1054, 974, 1070, 1236, 1343, 1374, 1388, 1399, 1385, 1351, 1333, 1344, 1347, 1302, 1208, 1087, 956, 860, 856, 937, 985, 897, 745, 748, 1000, 1302, 1382, 1228, 1082, 1103, 1206, 1258, 1245, 1197, 1089, 904, 681, 506, 482, 631, 801, 784, 594, 460, 533, 743, 921, 956, 824, 614, 506, 598, 763, 777, 598, 409, 370, 413, 406, 351, 331, 328, 254, 108, -9, -16, 66, 126, 60, -85, -139, -24, 133, 180, 103, -10, -98, -117, -63, -15, -92, -284, -451, -502, -508, -565, -636, -631, -581, -581, -617, -592, -502, -449, -468, -471, -414, -376, -459, -627, -749, -756, -723, -768, -897, -997, -985, -898, -833, -831, -848, -834, -784, -716, -643, -585, -555, -536, -493, -442, -430, -448, -448, -431, -468, -591, -730, -783, -701, -531, -385, -358, -423, -425, -264, -36, 55, -42, -154, -100, 60, 117, 13, -63, 58, 285, 385, 289, 155, 141, 220, 255, 181, 58, -3, 48, 192, 367, 514, 621, 718, 853, 1024, 1164, 1206, 1149, 1055, 944, 766, 519, 338, 370, 547, 656, 621, 589, 685, 868, 1061, 1245, 1352, 1277, 1085, 1055, 1314, 1593, 1543, 1206, 955, 971, 1039, 915, 663, 501, 495, 530, 512, 452, 416, 497, 747, 1063, 1206, 1080, 912, 987, 1241, 1314, 1016, 556, 269, 241, 298, 257, 79, -140, -237, -97, 212, 472, 553, 549, 580, 582, 432, 210, 146, 304, 441, 293, -93, -390, -342, -42, 103, -211, -774, -1018, -737, -390, -460, -759, -747, -364, -97, -240, -496, -499, -352, -378, -613, -846, -961, -963, -863, -783, -925, -1225, -1312, -1032, -761, -909, -1311, -1434, -1112, -751, -737, -936, -967, -760, -577, -591, -730, -914, -1178, -1477, -1605, -1471, -1282, -1283, -1381, -1270, -931, -682, -671, -646, -419, -225, -368, -755, -1032, -1045, -944, -960, -1173, -1441, -1493, -1242, -923, -822, -925, -950, -711, -332, -100, -152, -334, -366, -193, -74, -298, -866, -1505, -1934, -2131, -2343, -2761, -3165, -3079, -2409, -1636, -1186, -915, -440, 255, 809, 897, 490, -205, -906, -1449, -1882, -2313, -2722, -2970, -2913, -2524, -1970, -1502, -1149, -692, -89, 322, 313, 139, 185, 444, 601, 462, 103, -244, -373, -283, -199, -293, -452, -461, -291, -83, 99, 342, 723, 1189, 1626, 1972, 2202, 2314, 2360, 2408, 2452, 2396, 2186, 1899, 1665, 1585, 1683, 1867, 2003, 2090, 2274, 2610, 2919, 3000, 2913, 2910, 3094, 3312, 3381, 3318, 3271, 3349, 3543, 3781, 3934, 3877, 3613, 3311, 3121, 2990, 2738, 2326, 1944, 1798, 1915, 2179, 2462, 2709, 2946, 3239, 3578, 3809, 3757, 3438, 3050, 2748, 2473, 2055, 1463, 923, 696, 732, 732, 552, 381, 432, 634, 783, 808, 767, 711, 675, 715, 821, 835, 593, 165, -195, -366, -524, -908, -1507, -2062, -2347, -2371, -2336, -2380, -2421, -2307, -2063, -1839, -1696, -1601, -1581, -1670, -1819, -2018, -2346, -2741, -3006, -3167, -3474, -3929, -4170, -3989, -3676, -3621, -3841, -4037, -3997, -3802, -3683, -3752, -3884, -3892, -3741, -3546, -3427, -3430, -3521, -3617, -3666, -3729, -3905, -4185, -4450, -4626, -4733, -4791, -4807, -4784, -4669, -4429, -4180, -4061, -3996, -3813, -3583, -3509, -3554, -3519, -3411, -3417, -3550, -3649, -3685, -3820, -4122, -4421, -4510, -4402, -4279, -4252, -4232, -4075, -3759, -3376, -2999, -2644, -2349, -2170, -2120, -2141, -2175, -2229, -2342, -2537, -2778, -2994, -3100, -3053, -2899, -2745, -2654, -2578, -2421, -2143, -1803, -1516, -1349, -1229, -1002, -650, -370, -330, -437, -474, -427, -473, -696, -990, -1238, -1429, -1545, -1497, -1280, -1036, -815, -478, 50, 568, 854, 971, 1096, 1189, 1065, 728, 419, 301, 250, 64, -195, -258, -59, 118, 58, -32, 167, 571, 783, 674, 557, 722, 1070, 1319, 1379, 1373, 1390, 1363, 1231, 1068, 941, 762, 458, 190, 166, 277, 274, 231, 457, 951, 1348, 1412, 1278, 1214, 1355, 1609, 1684, 1392, 962, 818, 1017, 1208, 1156, 994, 951, 1047, 1112, 1007, 797, 703, 813, 948, 946, 963, 1244, 1711, 2031, 2091, 2140, 2362, 2572, 2471, 2091, 1745, 1584, 1447, 1197, 963, 904, 923, 865, 882, 1272, 1981, 2568, 2751, 2731, 2868, 3217, 3513, 3506, 3195, 2777, 2437, 2229, 2112, 2021, 1862, 1609, 1427, 1522, 1820, 2039, 2127, 2343, 2815, 3269, 3406, 3319, 3344, 3581, 3744, 3528, 3005, 2560, 2433, 2447, 2270, 1879, 1599, 1690, 2017, 2231, 2231, 2233, 2412, 2653, 2756, 2716, 2689, 2738, 2765, 2648, 2418, 2226, 2164, 2151, 2040, 1809, 1570, 1427, 1394, 1430, 1476, 1436, 1248, 1019, 1009, 1297, 1588, 1538, 1231, 1094, 1325, 1654, 1708, 1431, 1065, 850, 798, 747, 575, 322, 102, -28, -47, 36, 131, 125, 91, 216, 490, 662, 591, 433, 375, 389, 350, 248, 174, 140, 40, -200, -484, -610, -508, -336, -298, -400, -461, -338, -74, 175, 308, 313, 235, 175, 232, 370, 401, 212, -43, -138, -83, -105, -273, -374, -222, 43, 158, 89, 56, 185, 377, 470, 440, 373, 362, 443, 570, 631, 552, 424, 432, 609, 743, 635, 381, 268, 404, 591, 584, 389, 214, 223, 419, 711, 974, 1099, 1085, 1075, 1204, 1409, 1461, 1247, 913, 669, 536, 395, 213, 119, 211, 419, 600, 721, 879, 1132, 1367, 1397, 1163, 836, 669, 733, 855, 846, 715, 584, 528, 582, 757, 922, 825, 409, 1, -22, 282, 488, 341, 74, 85, 440, 838, 992, 905, 785, 792, 848, 733, 359, -94, -380, -448, -440, -480, -553, -532, -294, 101, 375, 304, 8, -154, -53, 62, -78, -395, -561, -422, -176, -101, -235, -389, -414, -360, -390, -594, -919, -1223, -1378, -1308, -1026, -670, -422, -346, -306, -142, 95, 185, -12, -385, -679, -769, -782, -910, -1161, -1330, -1272, -1076, -942, -924, -925, -877, -835, -849, -861, -809, -738, -714, -696, -614, -474, -347, -292, -352, -556, -840, -1070, -1166, -1163, -1136, -1140, -1181, -1221, -1155, -906, -541, -276, -281, -512, -773, -893, -814, -619, -510, -666, -1014, -1261, -1212, -953, -738, -727, -905, -1139, -1286, -1283, -1199, -1164, -1237, -1349, -1420, -1455, -1492, -1531, -1572, -1636, -1702, -1728, -1758, -1854, -1929, -1844, -1666, -1607, -1710, -1786, -1718, -1630, -1682, -1828, -1900, -1844, -1763, -1757, -1835, -1915, -1856, -1580, -1244, -1128, -1280, -1446, -1431, -1312, -1236, -1200, -1162, -1168, -1235, -1242, -1077, -826, -644, -540, -416, -288, -262, -303, -251, -72, 88, 137, 160, 242, 313, 327, 422, 701, 997, 1068, 953, 918, 1101, 1394, 1610, 1648, 1571, 1567, 1756, 2013, 2118, 2072, 2109, 2343, 2587, 2603, 2440, 2384, 2586, 2879, 3008, 2939, 2851, 2890, 3027, 3142, 3186, 3181, 3143, 3063, 2976, 2949, 2976, 2985, 2991, 3099, 3312, 3453, 3400, 3282, 3293, 3407, 3410, 3225, 2996, 2838, 2699, 2532, 2431, 2457, 2484, 2384, 2257, 2284, 2426, 2457, 2310, 2165, 2141, 2089, 1848, 1508, 1281, 1244, 1285, 1214, 963, 721, 739, 933, 912, 550, 174, 55, 46, -98, -356, -556, -667, -760, -817, -792, -761, -826, -939, -1001, -1054, -1199, -1378, -1517, -1707, -2033, -2350, -2503, -2558, -2629, -2702, -2761, -2862, -2969, -2954, -2808, -2679, -2687, -2825, -2997, -3089, -3073, -3065, -3200, -3454, -3675, -3809, -3929, -4074, -4180, -4236, -4327, -4464, -4475, -4229, -3892, -3754, -3839, -3882, -3727, -3554, -3606, -3864, -4100, -4213, -4348, -4629, -4899, -4914, -4718, -4595, -4617, -4541, -4242, -3920, -3767, -3714, -3646, -3597, -3615, -3660, -3687, -3712, -3758, -3822, -3870, -3827, -3680, -3534, -3484, -3466, -3385, -3294, -3263, -3195, -2969, -2706, -2640, -2736, -2677, -2328, -1985, -1955, -2110, -2084, -1807, -1585, -1648, -1879, -1998, -1896, -1706, -1602, -1585, -1507, -1305, -1083, -946, -844, -678, -453, -275, -182, -124, -66, -36, -41, -22, 42, 84, 53, 27, 97, 221, 265, 221, 249, 466, 774, 995, 1080, 1112, 1189, 1330, 1458, 1462, 1351, 1281, 1340, 1399, 1313, 1148, 1079, 1131, 1189, 1198, 1223, 1323, 1489, 1691, 1918, 2119, 2222, 2228, 2210, 2175, 2057, 1850, 1648, 1518, 1431, 1359, 1330, 1384, 1528, 1753, 2030, 2251, 2288, 2173, 2087, 2098, 2036, 1792, 1516, 1402, 1411, 1428, 1483, 1653, 1875, 1989, 1917, 1753, 1665, 1705, 1710, 1462, 1017, 747, 912, 1281, 1404, 1240, 1229, 1607, 2009, 1981, 1600, 1271, 1145, 1036, 809, 577, 530, 703, 941, 1058, 1031, 1009, 1114, 1274, 1287, 1082, 802, 591, 439, 305, 245, 287, 356, 417, 517, 622, 646, 672, 870, 1141, 1133, 746, 345, 300, 494, 519, 267, 53, 155, 426, 563, 538, 564, 719, 814, 716, 579, 618, 759, 745, 547, 457, 645, 868, 803, 539, 458, 692, 936, 891, 664, 594, 783, 1022, 1126, 1154, 1226, 1315, 1313, 1227, 1160, 1134, 1050, 856, 681, 672, 783, 861, 897, 1022, 1235, 1384, 1425, 1480, 1600, 1673, 1629, 1526, 1398, 1198, 959, 839, 879, 900, 785, 703, 845, 1090, 1191, 1133, 1072, 1048, 1019, 1006, 1015, 944, 750, 550, 484, 531, 582, 583, 561, 548, 563, 609, 622, 503, 312, 232, 254, 141, -116, -203, -28, 74, -56, -134, 24, 187, 137, 5, -52, -115, -287, -497, -613, -638, -681, -799, -912, -905, -817, -789, -825, -746, -475, -236, -300, -576, -689, -517, -382, -575, -908, -1030, -943, -909, -1003, -1067, -1029, -976, -946, -853, -643, -407, -287, -305, -323, -235, -134, -162, -280, -381, -515, -742, -921, -921, -865, -878, -820, -565, -249, -12, 196, 424, 605, 700, 695, 519, 210, -12, -73, -163, -351, -398, -164, 146, 323, 466, 750, 1104, 1332, 1412, 1452, 1426, 1222, 899, 666, 574, 484, 370, 391, 616, 894, 1094, 1293, 1570, 1789, 1809, 1742, 1774, 1843, 1750, 1509, 1319, 1257, 1219, 1150, 1128, 1206, 1322, 1404, 1427, 1372, 1242, 1147, 1190, 1275, 1259, 1236, 1396, 1629, 1658, 1514, 1475, 1580, 1584, 1383, 1157, 1038, 948, 826, 775, 857, 928, 847, 721, 762, 953, 1062, 958, 763, 633, 569, 506, 439, 384, 337, 350, 484, 648, 650, 525, 514, 677, 750, 552, 247, 96, 136, 210, 210, 173, 188, 258, 312, 359, 487, 633, 570, 267, -12, -94, -129, -265, -393, -367, -228, -61, 92, 192, 262, 422, 670, 755, 513, 154, -14, -59, -297, -729, -988, -934, -854, -915, -863, -519, -136, 42, 163, 410, 621, 554, 285, 51, -112, -322, -569, -745, -868, -997, -1024, -829, -563, -449, -423, -280, -88, -65, -167, -154, -52, -138, -412, -518, -354, -297, -534, -718, -619, -580, -899, -1234, -1155, -855, -822, -1070, -1183, -1014, -850, -886, -946, -891, -902, -1158, -1493, -1641, -1633, -1683, -1820, -1878, -1810, -1722, -1634, -1453, -1214, -1091, -1129, -1200, -1231, -1267, -1353, -1516, -1754, -1912, -1822, -1597, -1519, -1585, -1506, -1197, -931, -912, -972, -902, -795, -847, -981, -964, -788, -649, -603, -555, -481, -408, -298, -160, -124, -204, -218, -87, 27, 24, 50, 241, 481, 594, 640, 802, 1061, 1211, 1180, 1132, 1165, 1177, 1089, 1006, 1055, 1199, 1294, 1292, 1343, 1611, 1982, 2133, 2008, 1945, 2135, 2281, 2084, 1747, 1650, 1793, 1892, 1841, 1808, 1929, 2127, 2231, 2193, 2131, 2150, 2178, 2071, 1858, 1723, 1748, 1811, 1785, 1732, 1772, 1881, 1917, 1829, 1728, 1698, 1638, 1420, 1150, 1051, 1096, 1022, 767, 626, 789, 999, 908, 597, 436, 533, 609, 452, 188, 20, -46, -89, -122, -192, -360, -540, -595, -597, -712, -915, -1068, -1200, -1400, -1559, -1513, -1371, -1397, -1597, -1696, -1575, -1465, -1585, -1821, -1966, -2051, -2239, -2496, -2649, -2701, -2816, -2980, -2986, -2814, -2693, -2712, -2685, -2577, -2607, -2823, -2990, -3012, -3059, -3203, -3330, -3412, -3489, -3492, -3354, -3206, -3213, -3335, -3407, -3358, -3270, -3266, -3393, -3542, -3587, -3550, -3543, -3547, -3447, -3280, -3231, -3324, -3346, -3187, -3034, -3097, -3254, -3237, -3085, -3094, -3336, -3524, -3458, -3313, -3327, -3422, -3350, -3072, -2814, -2743, -2734, -2580, -2344, -2292, -2443, -2525, -2456, -2474, -2671, -2781, -2659, -2532, -2563, -2585, -2441, -2239, -2117, -2040, -1929, -1792, -1673, -1598, -1589, -1618, -1614, -1550, -1472, -1427, -1382, -1294, -1198, -1153, -1129, -1073, -1034, -1106, -1225, -1224, -1080, -934, -880, -859, -754, -522, -259, -142, -213, -273, -146, 21, -71, -412, -636, -517, -279, -266, -448, -505, -313, -96, -52, -74, 22, 175, 210, 180, 276, 475, 557, 480, 422, 463, 501, 480, 454, 410, 261, 44, -74, -3, 174, 328, 419, 512, 689, 966, 1255, 1411, 1368, 1212, 1044, 845, 599, 430, 414, 417, 337, 343, 624, 1045, 1328, 1445, 1567, 1718, 1746, 1641, 1567, 1544, 1390, 1080, 864, 882, 986, 1085, 1297, 1626, 1857, 1899, 1917, 2024, 2084, 1957, 1711, 1515, 1434, 1423, 1455, 1555, 1709, 1847, 1935, 2018, 2129, 2187, 2097, 1886, 1695, 1604, 1569, 1516, 1457, 1470, 1603, 1813, 1986, 2070, 2143, 2247, 2267, 2106, 1878, 1740, 1654, 1515, 1375, 1323, 1301, 1244, 1258, 1464, 1758, 1919, 1869, 1733, 1662, 1677, 1688, 1630, 1537, 1457, 1391, 1365, 1469, 1702, 1874, 1811, 1585, 1411, 1375, 1380, 1303, 1117, 926, 889, 1033, 1219, 1338, 1448, 1587, 1653, 1591, 1499, 1436, 1308, 1073, 867, 804, 799, 724, 628, 665, 867, 1087, 1200, 1233, 1271, 1313, 1271, 1080, 781, 509, 372, 328, 274, 206, 198, 242, 315, 479, 738, 924, 942, 916, 927, 856, 665, 517, 473, 380, 198, 131, 279, 440, 428, 353, 423, 593, 671, 638, 640, 679, 621, 462, 373, 417, 467, 458, 498, 624, 657, 495, 345, 421, 583, 574, 421, 344, 393, 455, 491, 535, 576, 606, 659, 732, 745, 667, 569, 491, 396, 296, 312, 473, 582, 483, 348, 426, 652, 752, 660, 550, 511, 463, 377, 340, 363, 323, 192, 143, 309, 571, 731, 781, 840, 905, 877, 801, 814, 855, 684, 304, 38, 66, 190, 231, 279, 413, 507, 506, 545, 674, 733, 612, 432, 359, 381, 382, 330, 283, 270, 262, 278, 389, 555, 596, 415, 174, 74, 78, 12, -123, -161, -75, -41, -96, -12, 321, 596, 497, 221, 189, 359, 342, 58, -167, -174, -137, -178, -177, -37, 139, 211, 152, 42, -41, -72, -73, -88, -133, -161, -88, 108, 331, 462, 482, 465, 429, 306, 74, -182, -385, -520, -580, -537, -424, -295, -133, 95, 315, 426, 451, 485, 521, 467, 292, 67, -154, -351, -452, -405, -343, -440, -580, -459, -89, 148, 85, -24, 36, 135, 107, 62, 126, 135, -125, -507, -664, -535, -389, -383, -402, -351, -295, -259, -134, 79, 183, 63, -107, -137, -105, -183, -321, -402, -495, -679, -793, -664, -416, -308, -370, -430, -359, -174, 8, 52, -61, -206, -258, -224, -180, -176, -247, -392, -546, -624, -639, -663, -695, -656, -529, -407, -307, -114, 207, 455, 451, 307, 232, 175, -58, -451, -775, -922, -996, -1048, -945, -600, -158, 159, 302, 374, 448, 503, 487, 342, 49, -298, -519, -541, -493, -519, -561, -470, -261, -90, -19, 45, 135, 176, 152, 135, 143, 128, 78, 27, -19, -61, -76, -68, -97, -198, -305, -334, -301, -295, -337, -351, -291, -189, -92, 4, 97, 157, 147, 57, -98, -268, -370, -386, -417, -557, -725, -727, -529, -336, -315, -376, -341, -241, -271, -458, -585, -542, -500, -619, -756, -710, -540, -461, -533, -666, -776, -807, -753, -725, -834, -1001, -1046, -942, -813, -732, -671, -627, -632, -659, -638, -599, -658, -829, -982, -1025, -1005, -967, -873, -734, -621, -498, -284, -51, 36, -2, 12, 123, 152, -6, -198, -212, -63, 57, 55, 22, 79, 238, 439, 620, 741, 806, 846, 884, 922, 965, 1009, 1024, 1015, 1029, 1085, 1139, 1167, 1211, 1291, 1347, 1326, 1288, 1324, 1410, 1448, 1447, 1482, 1523, 1484, 1427, 1493, 1651, 1732, 1725, 1753, 1816, 1780, 1635, 1531, 1530, 1508, 1376, 1238, 1213, 1229, 1154, 1029, 1023, 1174, 1339, 1383, 1308, 1220, 1207, 1249, 1242, 1147, 1026, 900, 719, 535, 463, 448, 311, 62, -87, -58, 19, 55, 79, 94, 60, 1, -10, 15, -8, -168, -454, -751, -945, -1060, -1206, -1362, -1392, -1276, -1171, -1166, -1187, -1171, -1154, -1183, -1285, -1486, -1749, -1951, -2042, -2141, -2341, -2549, -2584, -2413, -2182, -2044, -2027, -2072, -2124, -2166, -2216, -2313, -2482, -2678, -2838, -2950, -3034, -3066, -3023, -2933, -2833, -2717, -2583, -2487, -2495, -2595, -2712, -2798, -2869, -2939, -3001, -3059, -3108, -3108, -3031, -2939, -2899, -2871, -2764, -2617, -2593, -2730, -2832, -2741, -2589, -2597, -2730, -2773, -2673, -2574, -2548, -2559, -2578, -2587, -2516, -2356, -2229, -2226, -2277, -2271, -2202, -2117, -2018, -1902, -1852, -1936, -2058, -2037, -1866, -1732, -1749, -1806, -1741, -1558, -1392, -1326, -1312, -1267, -1200, -1193, -1241, -1216, -1068, -941, -967, -1078, -1128, -1061, -887, -665, -549, -650, -818, -783, -543, -351, -344, -409, -417, -390, -374, -341, -273, -235, -258, -251, -132, 24, 85, 38, -10, -9, 9, 38, 110, 198, 214, 159, 139, 202, 265, 289, 338, 436, 477, 426, 404, 507, 645, 671, 578, 490, 495, 564, 609, 591, 546, 553, 648, 772, 825, 801, 797, 862, 911, 865, 782, 755, 773, 754, 694, 677, 760, 887, 946, 915, 887, 934, 986, 952, 864, 813, 809, 804, 796, 795, 780, 762, 802, 884, 927, 931, 992, 1116, 1169, 1074, 941, 902, 926, 906, 865, 883, 909, 872, 855, 987, 1189, 1275, 1241, 1220, 1260, 1289, 1263, 1200, 1110, 992, 879, 831, 871, 966, 1059, 1125, 1182, 1245, 1297, 1338, 1391, 1433, 1383, 1222, 1054, 977, 975, 989, 1002, 1014, 1013, 1019, 1095, 1241, 1362, 1362, 1240, 1088, 1021, 1048, 1079, 1030, 953, 958, 1065, 1185, 1244, 1241, 1201, 1128, 1015, 886, 799, 801, 848, 857, 825, 863, 1025, 1212, 1294, 1278, 1240, 1198, 1111, 960, 795, 678, 630, 616, 607, 648, 801, 1023, 1156, 1097, 936, 841, 848, 823, 637, 338, 87, 0, 68, 224, 394, 558, 737, 940, 1113, 1165, 1058, 856, 641, 413, 138, -131, -291, -309, -266, -239, -200, -83, 138, 409, 629, 711, 645, 510, 403, 360, 321, 190, -38, -254, -325, -232, -93, -37, -61, -57, 40, 155, 179, 102, 19, -3, 11, 14, 4, 23, 101, 211, 287, 263, 153, 72, 108, 175, 104, -118, -319, -354, -268, -188, -186, -248, -297, -236, -38, 196, 329, 341, 348, 424, 491, 465, 379, 292, 177, 4, -166, -280, -360, -415, -397, -294, -163, -28, 154, 407, 678, 890, 977, 943, 870, 823, 752, 585, 349, 125, -44, -137, -111, 23, 199, 387, 607, 832, 996, 1102, 1179, 1213, 1177, 1094, 957, 744, 520, 391, 345, 316, 334, 474, 691, 902, 1116, 1335, 1453, 1396, 1264, 1187, 1150, 1032, 782, 494, 337, 410, 642, 858, 967, 1024, 1121, 1256, 1333, 1285, 1145, 1021, 971, 942, 858, 750, 704, 744, 805, 864, 953, 1072, 1152, 1148, 1095, 1050, 1033, 1028, 1018, 1006, 981, 926, 836, 766, 763, 788, 761, 689, 650, 674, 750, 883, 1016, 1011, 855, 751, 824, 912, 821, 605, 440, 382, 386, 448, 587, 758, 904, 1035, 1156, 1194, 1101, 957, 827, 606, 209, -191, -360, -332, -307, -306, -180, 103, 430, 736, 1052, 1329, 1405, 1219, 905, 630, 392, 78, -302, -607, -745, -771, -762, -698, -533, -309, -131, -30, 55, 191, 350, 445, 430, 324, 188, 65, -38, -167, -370, -647, -950, -1216, -1404, -1470, -1391, -1206, -994, -796, -592, -358, -111, 72, 108, -19, -234, -454, -682, -965, -1280, -1521, -1636, -1692, -1758, -1770, -1644, -1442, -1312, -1273, -1224, -1104, -917, -698, -559, -637, -859, -993, -975, -1014, -1239, -1537, -1766, -1933, -2070, -2142, -2116, -1995, -1807, -1600, -1382, -1095, -730, -427, -339, -427, -529, -590, -693, -899, -1162, -1420, -1645, -1762, -1669, -1399, -1144, -1010, -879, -642, -402, -310, -329, -314, -263, -298, -440, -557, -556, -502, -498, -547, -588, -581, -507, -375, -271, -272, -336, -335, -236, -123, -68, -56, -45, -37, -32, -8, 28, 27, -24, -66, -60, -53, -95, -147, -156, -140, -139, -126, -61, 6, -6, -75, -85, -3, 72, 74, 36, 0, -42, -78, -82, -82, -119, -193, -288, -395, -460, -440, -405, -429, -439, -344, -225, -186, -176, -98, -10, -17, -122, -263, -389, -434, -385, -361, -478, -660, -733, -656, -540, -510, -584, -668, -638, -496, -392, -429, -503, -460, -323, -244, -271, -298, -273, -308, -492, -722, -812, -764, -754, -876, -1009, -978, -783, -587, -499, -460, -358, -205, -124, -181, -280, -294, -247, -291, -495, -716, -788, -730, -707, -781, -853, -825, -742, -688, -644, -544, -405, -283, -183, -92, -51, -92, -174, -275, -438, -647, -800, -858, -913, -1014, -1069, -988, -820, -678, -592, -512, -424, -382, -423, -515, -615, -705, -791, -868, -925, -947, -917, -859, -825, -829, -819, -746, -657, -644, -738, -866, -964, -1041, -1146, -1252, -1280, -1193, -1048, -924, -834, -727, -583, -445, -389, -440, -546, -635, -709, -826, -1000, -1146, -1193, -1175, -1155, -1111, -974, -755, -548, -424, -378, -357, -314, -241, -170, -166, -276, -476, -689, -855, -966, -1049, -1104, -1117, -1082, -985, -790, -497, -207, -41, 5, 45, 123, 141, 15, -193, -358, -455, -583, -791, -994, -1048, -923, -719, -554, -456, -375, -257, -112, 4, 56, 57, 33, -16, -110, -224, -286, -270, -236, -266, -335, -332, -205, -34, 46, -5, -103, -133, -85, -41, -71, -146, -186, -158, -88, -12, 65, 123, 124, 94, 123, 242, 350, 348, 254, 129, -25, -197, -312, -332, -299, -251, -193, -120, -10, 150, 300, 355, 352, 414, 526, 548, 431, 270, 151, 81, 58, 58, 24, -42, -59, 9, 97, 137, 138, 147, 195, 287, 392, 470, 545, 655, 765, 792, 737, 682, 656, 584, 432, 277, 218, 256, 315, 343, 371, 452, 574, 667, 695, 688, 687, 696, 691, 655, 594, 549, 580, 708, 857, 937, 943, 945, 971, 956, 840, 662, 514, 445, 428, 430, 453, 516, 631, 774, 875, 884, 853, 870, 920, 891, 748, 591, 532, 572, 641, 691, 721, 738, 735, 708, 677, 658, 648, 644, 658, 706, 789, 896, 1007, 1106, 1169, 1175, 1118, 1019, 898, 752, 574, 387, 262, 257, 369, 530, 680, 816, 949, 1076, 1185, 1279, 1357, 1380, 1299, 1125, 937, 816, 770, 754, 714, 622, 504, 423, 437, 527, 620, 681, 735, 804, 882, 963, 1046, 1112, 1152, 1177, 1184, 1128, 989, 809, 646, 521, 428, 352, 298, 301, 392, 516, 589, 624, 711, 861, 980, 1016, 1016, 1032, 1044, 1013, 931, 826, 730, 659, 584, 472, 343, 243, 183, 155, 168, 226, 312, 418, 549, 678, 775, 863, 969, 1051, 1067, 1036, 978, 852, 635, 408, 260, 182, 109, 29, -20, -8, 57, 161, 294, 448, 590, 684, 735, 792, 876, 931, 897, 785, 666, 574, 474, 321, 124, -47, -118, -61, 70, 194, 275, 343, 458, 626, 791, 886, 892, 845, 769, 660, 530, 422, 373, 348, 287, 201, 154, 187, 261, 291, 230, 125, 79, 129, 212, 269, 315, 384, 469, 552, 609, 623, 594, 554, 499, 357, 109, -122, -191, -129, -88, -137, -160, -50, 130, 236, 243, 249, 302, 313, 185, -28, -178, -177, -95, -50, -58, -25, 87, 198, 207, 116, -2, -96, -161, -221, -294, -368, -403, -388, -341, -251, -108, 23, 40, -56, -146, -164, -166, -215, -302, -371, -383, -341, -271, -205, -154, -130, -146, -185, -199, -176, -185, -281, -415, -483, -449, -358, -258, -175, -131, -155, -234, -295, -286, -242, -240, -290, -325, -301, -241, -169, -74, 29, 74, 36, -30, -92, -192, -349, -477, -499, -442, -386, -341, -258, -132, -14, 66, 119, 136, 93, 21, -29, -81, -191, -339, -431, -415, -329, -227, -115, 5, 100, 126, 85, 21, -37, -122, -264, -418, -488, -440, -338, -254, -189, -103, -2, 52, 28, -56, -162, -272, -373, -453, -507, -536, -527, -464, -373, -301, -266, -246, -215, -175, -120, -34, 64, 117, 102, 75, 95, 117, 41, -161, -405, -601, -725, -788, -774, -671, -512, -339, -144, 89, 315, 454, 482, 422, 296, 117, -87, -292, -489, -679, -836, -891, -790, -570, -353, -228, -166, -71, 80, 190, 169, 53, -44, -78, -101, -154, -205, -210, -176, -139, -125, -148, -191, -221, -234, -256, -292, -310, -306, -301, -307, -303, -293, -287, -278, -254, -222, -184, -120, -24, 72, 148, 217, 293, 337, 299, 187, 46, -120, -357, -625, -809, -841, -771, -670, -519, -276, 38, 343, 580, 751, 852, 835, 671, 404, 136, -98, -337, -591, -792, -884, -868, -775, -614, -403, -177, 27, 181, 260, 269, 271, 318, 353, 268, 29, -249, -444, -549, -652, -780, -870, -876, -834, -789, -722, -588, -408, -258, -183, -158, -149, -167, -235, -359, -511, -659, -778, -854, -886, -887, -853, -775, -679, -609, -577, -554, -544, -593, -704, -807, -841, -834, -854, -905, -917, -843, -711, -591, -514, -470, -446, -453, -511, -617, -739, -837, -902, -957, -1026, -1096, -1121, -1080, -997, -909, -817, -715, -619, -539, -456, -365, -292, -268, -285, -323, -380, -449, -513, -563, -614, -685, -767, -810, -770, -667, -573, -521, -459, -341, -210, -133, -109, -93, -86, -129, -212, -270, -275, -280, -332, -388, -389, -347, -313, -294, -262, -211, -154, -97, -39, 7, 29, 31, 36, 62, 93, 96, 57, 6, -8, 12, 14, -41, -126, -176, -156, -108, -96, -126, -140, -109, -79, -83, -83, -42, -5, -28, -79, -86, -50, -35, -72, -138, -190, -205, -206, -234, -288, -329, -341, -361, -398, -403, -347, -279, -255, -253, -214, -154, -140, -180, -210, -204, -225, -310, -410, -459, -471, -498, -534, -533, -499, -480, -474, -439, -364, -292, -244, -204, -160, -127, -100, -68, -46, -44, -58, -90, -154, -233, -299, -351, -405, -456, -476, -459, -417, -358, -293, -234, -175, -101, -6, 108, 238, 338, 365, 344, 345, 363, 335, 249, 148, 40, -85, -183, -222, -241, -272, -279, -217, -97, 56, 236, 411, 543, 637, 711, 747, 729, 681, 619, 526, 408, 284, 160, 56, 30, 100, 184, 227, 267, 348, 450, 534, 605, 656, 677, 689, 725, 766, 769, 754, 774, 831, 864, 838, 775, 707, 624, 514, 424, 409, 450, 460, 410, 374, 433, 568, 697, 782, 848, 907, 938, 920, 865, 809, 775, 747, 681, 555, 414, 331, 321, 323, 284, 231, 225, 285, 377, 473, 548, 577, 567, 574, 621, 663, 669, 662, 631, 520, 333, 162, 71, 19, -50, -130, -173, -148, -64, 55, 177, 283, 363, 415, 435, 424, 386, 322, 230, 118, 19, -39, -65, -92, -141, -182, -167, -98, -24, 9, 6, -16, -43, -56, -46, -23, -9, -15, -21, -1, 55, 129, 183, 195, 191, 212, 257, 272, 224, 153, 122, 130, 129, 117, 141, 206, 255, 248, 209, 174, 163, 191, 255, 333, 395, 436, 454, 452, 439, 430, 408, 345, 241, 129, 34, -25, -39, -8, 48, 109, 185, 305, 454, 584, 672, 733, 765, 732, 624, 492, 386, 299, 203, 92, -10, -85, -116, -97, -35, 53, 154, 247, 311, 329, 319, 311, 305, 270, 198, 122, 73, 40, 1, -38, -80, -125, -163, -188, -199, -191, -144, -63, 9, 56, 94, 128, 126, 72, -2, -59, -97, -146, -213, -276, -320, -341, -324, -265, -190, -134, -101, -79, -76, -101, -134, -162, -191, -227, -244, -218, -162, -118, -101, -90, -64, -20, 15, 34, 44, 52, 46, 18, -20, -47, -64, -69, -57, -24, 15, 67, 126, 176, 203, 231, 277, 314, 302, 254, 224, 231, 248, 254, 264, 294, 328, 336, 323, 324, 350, 382, 404, 414, 409, 381, 343, 330, 345, 350, 319, 285, 286, 319, 363, 397, 404, 382, 364, 370, 369, 331, 289, 275, 267, 217, 138, 87, 82, 72, 19, -51, -100, -125, -140, -136, -97, -43, 7, 53, 94, 121, 132, 128, 99, 40, -38, -114, -181, -242, -285, -297, -287, -284, -294, -299, -290, -281, -280, -265, -233, -203, -184, -168, -151, -141, -142, -148, -156, -166, -176, -198, -241, -295, -336, -356, -371, -389, -383, -327, -232, -148, -107, -89, -61, -42, -79, -174, -261, -298, -313, -343, -373, -376, -357, -329, -291, -239, -190, -163, -155, -148, -134, -117, -104, -100, -104, -112, -120, -127, -137, -154, -186, -228, -256, -248, -205, -151, -107, -74, -41, -3, 19, 19, 11, 16, 29, 23, -6, -32, -37, -24, -10, 2, 16, 28, 38, 59, 87, 101, 94, 89, 101, 101, 75, 51, 55, 63, 45, 13, -3, -5, -13, -30, -42, -44, -46, -59, -74, -75, -54, -24, -7, -6, -10, -12, -7, 5, 20, 28, 35, 51, 77, 94, 93, 77, 55, 41, 43, 51, 43, 20, 13, 30, 41, 20, -9, -15, -6, -8, -20, -14, 9, 28, 36, 56, 88, 100, 71, 27, 1, -1, 2, -2, -25, -56, -72, -60, -28, 8, 34, 42, 37, 35, 43, 52, 45, 15, -22, -53, -79, -103, -122, -125, -119, -115, -111, -96, -64, -25, -5, -9, -32, -60, -86, -108, -124, -132, -137, -140, -136, -120, -103, -97, -102, -101, -80, -49, -28, -24, -29, -42, -69, -101, -119, -129, -140, -155, -161, -151, -132, -111, -95, -83, -72, -54, -35, -22, -20, -24, -34, -47, -57, -54, -43, -38, -46, -51, -43, -32, -25, -17, -5, 2, 5, 13, 28, 31, 21, 12, 8, 0, -16, -27, -21, -15, -23, -35, -36, -31, -36, -46, -45, -28, -7, 9, 22, 34, 43, 48, 40, 18, -5, -19, -28, -39, -45, -39, -29, -24, -19, -6, 9, 21, 28, 33, 33, 28, 24, 22, 16, 0, -16, -23, -25, -29, -34, -29, -19, -7, 2, 18, 31, 38, 37, 33, 28, 21, 12, 1, -5, -7, -7, -5, -3, -1, 2, 8, 11, 8, 7, 11, 15, 16, 13, 9, 9, 9, 6, 1, 0, 1, 2, 1, 0, 0, 0, 1, 2, 4, 5, 6, 8, 9, 8, 6, 5, 6, 6, 2, 0, -1, -1, -1, -2, -3, -2, 0, 0, 0, 1, 2, 4, 4, 2, 1, 1, 0, 0, -1, -1, -1, -1, -2, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -2, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, 2, 1, 0, 1, 2, 2, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 1, 2, 0, 0, 0, 1, 1, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 1, 0, -1, 0, 2, 2, 0, 0, -1 };
+// IMA ADPCM blocks, see audio_adpcm.h
+static const uint8_t __in_flash("audio_forty_sample_data") audio_forty_sample_data[] = { 0, 0, 0, 0, 119, 191, 32, 4, 255, 56, 161, 58, 37, 136, 35, 249, 140, 67, 161, 43, 23, 220, 25, 2, 138, 16, 161, 155, 69, 130, 145, 171, 51, 219, 48, 152, 98, 200, 27, 20, 190, 48, 177, 27, 132, 11, 37, 24, 20, 219, 32, 146, 173, 16, 129, 32, 0, 17, 160, 172, 65, 250, 41, 209, 28, 53, 184, 139, 83, 146, 10, 218, 73, 146, 172, 16, 52, 233, 26, 2, 25, 53, 129, 154, 144, 190, 41, 160, 113, 146, 26, 179, 159, 17, 136, 19, 152, 66, 168, 48, 240, 43, 4, 156, 50, 252, 72, 146, 155, 17, 16, 18, 201, 73, 193, 42, 133, 171, 32, 3, 220, 65, 176, 26, 17, 168, 59, 71, 184, 9, 144, 10, 20, 206, 82, 161, 11, 18, 153, 136, 84, 176, 11, 129, 137, 138, 130, 106, 165, 14, 52, 201, 154, 33, 2, 25, 36, 169, 8, 250, 140, 52, 201, 73, 3, 171, 32, 129, 156, 51, 251, 73, 3, 154, 130, 204, 16, 8, 53, 216, 25, 160, 56, 19, 170, 204, 10, 82, 37, 208, 42, 147, 174, 17, 32, 4, 170, 8, 169, 187, 114, 135, 154, 18, 201, 138, 52, 178, 26, 177, 43, 5, 137, 19, 138, 144, 59, 148, 159, 24, 18, 191, 115, 176, 57, 2, 235, 10, 52, 152, 152, 137, 36, 249, 138, 50, 49, 2, 154, 176, 207, 65, 129, 9, 186, 41, 36, 144, 25, 23, 220, 56, 147, 157, 67, 152, 8, 128, 128, 175, 34, 144, 16, 171, 116, 146, 141, 16, 185, 57, 36, 128, 152, 11, 3, 220, 57, 132, 12, 37, 219, 24, 129, 40, 1, 9, 1, 252, 26, 36, 152, 17, 160, 40, 177, 173, 16, 17, 1, 169, 75, 55, 252, 72, 146, 156, 50, 176, 155, 50, 177, 59, 133, 157, 51, 152, 82, 217, 26, 146, 141, 83, 160, 138, 144, 24, 19, 9, 37, 204, 96, 146, 156, 2, 219, 72, 2, 168, 138, 83, 184, 43, 4, 9, 128, 139, 38, 216, 27, 36, 202, 41, 19, 235, 138, 35, 2, 9, 87, 192, 156, 34, 128, 9, 50, 194, 157, 1, 186, 66, 176, 58, 134, 171, 33, 136, 18, 128, 2, 41, 7, 190, 65, 176, 11, 83, 200, 57, 147, 12, 177, 14, 146, 10, 23, 152, 8, 40, 131, 141, 19, 140, 36, 204, 0, 138, 38, 172, 66, 144, 154, 66, 176, 12, 176, 80, 130, 41, 225, 44, 37, 170, 8, 136, 144, 154, 33, 66, 132, 174, 16, 136, 32, 162, 159, 49, 152, 82, 177, 10, 201, 88, 131, 25, 192, 157, 129, 34, 208, 72, 132, 187, 72, 131, 154, 2, 153, 35, 161, 191, 58, 133, 141, 35, 184, 137, 33, 193, 105, 148, 155, 51, 184, 170, 97, 177, 30, 131, 172, 34, 16, 19, 170, 192, 158, 35, 187, 100, 145, 153, 186, 25, 144, 115, 134, 9, 146, 28, 21, 172, 8, 24, 131, 140, 128, 187, 16, 1, 99, 4, 185, 26, 39, 232, 26, 35, 198, 2, 47, 0, 185, 48, 224, 140, 18, 25, 22, 137, 1, 154, 128, 9, 227, 159, 20, 171, 65, 145, 17, 33, 161, 157, 1, 169, 139, 18, 170, 137, 113, 162, 29, 39, 169, 32, 200, 42, 132, 155, 19, 188, 41, 35, 152, 113, 208, 11, 38, 0, 0, 233, 156, 82, 177, 59, 163, 156, 17, 18, 136, 1, 75, 165, 143, 131, 155, 131, 156, 67, 170, 71, 160, 9, 128, 144, 204, 48, 162, 25, 19, 137, 160, 157, 49, 146, 186, 81, 19, 83, 216, 16, 251, 0, 169, 69, 184, 153, 138, 3, 156, 38, 128, 83, 184, 41, 193, 142, 50, 145, 186, 138, 18, 187, 114, 162, 26, 54, 146, 188, 64, 224, 12, 18, 185, 32, 2, 32, 168, 88, 147, 157, 16, 154, 17, 139, 119, 168, 57, 161, 155, 217, 41, 37, 152, 56, 184, 26, 145, 65, 224, 11, 51, 131, 205, 80, 177, 139, 37, 145, 187, 64, 145, 170, 10, 101, 161, 171, 33, 144, 24, 138, 70, 202, 24, 8, 35, 0, 252, 15, 3, 24, 129, 25, 178, 142, 20, 138, 51, 202, 8, 56, 21, 205, 32, 162, 157, 8, 33, 2, 34, 209, 157, 33, 3, 186, 82, 144, 24, 168, 205, 88, 193, 10, 128, 84, 233, 48, 176, 56, 176, 56, 193, 74, 178, 44, 4, 170, 8, 84, 193, 11, 19, 203, 10, 2, 137, 85, 161, 10, 50, 36, 251, 27, 145, 11, 37, 153, 0, 234, 41, 52, 160, 11, 147, 142, 20, 188, 65, 176, 25, 1, 49, 146, 9, 204, 24, 50, 232, 42, 208, 58, 208, 104, 131, 26, 132, 156, 33, 153, 17, 186, 9, 188, 88, 21, 128, 0, 129, 9, 68, 49, 179, 255, 25, 153, 33, 201, 98, 176, 25, 131, 156, 66, 168, 24, 172, 53, 204, 51, 169, 66, 9, 177, 159, 18, 8, 208, 41, 133, 139, 3, 155, 35, 171, 51, 137, 55, 184, 137, 203, 97, 18, 186, 141, 129, 140, 67, 18, 144, 170, 171, 101, 184, 27, 20, 169, 64, 130, 219, 137, 170, 81, 3, 56, 146, 158, 2, 202, 26, 69, 176, 58, 23, 170, 24, 218, 24, 153, 116, 160, 11, 131, 139, 34, 17, 203, 25, 18, 37, 233, 41, 146, 154, 185, 90, 20, 168, 157, 67, 176, 26, 52, 3, 170, 82, 249, 141, 49, 17, 152, 187, 99, 193, 155, 2, 168, 25, 70, 168, 8, 129, 129, 26, 21, 171, 65, 176, 223, 56, 2, 171, 48, 18, 33, 161, 12, 68, 51, 216, 189, 187, 10, 50, 37, 200, 137, 66, 67, 18, 192, 175, 8, 153, 129, 43, 87, 153, 145, 155, 177, 122, 23, 153, 9, 129, 8, 177, 27, 7, 170, 17, 137, 17, 184, 156, 152, 73, 39, 137, 160, 14, 35, 172, 50, 185, 32, 172, 54, 154, 55, 219, 25, 129, 128, 0, 128, 138, 34, 235, 88, 131, 153, 153, 65, 232, 10, 1, 51, 216, 64, 130, 136, 172, 16, 24, 132, 189, 138, 34, 128, 48, 177, 112, 100, 2, 51, 0, 178, 29, 20, 171, 48, 161, 190, 32, 193, 89, 22, 184, 10, 18, 200, 26, 2, 80, 178, 142, 136, 137, 67, 128, 137, 83, 161, 11, 20, 185, 154, 18, 237, 32, 160, 155, 34, 233, 64, 163, 156, 0, 176, 44, 39, 26, 164, 29, 7, 9, 19, 154, 160, 170, 136, 0, 9, 19, 185, 239, 26, 20, 137, 136, 32, 148, 26, 23, 137, 37, 137, 130, 174, 128, 154, 17, 186, 24, 171, 87, 145, 24, 145, 137, 201, 72, 200, 121, 19, 169, 144, 172, 48, 193, 59, 133, 139, 18, 9, 20, 184, 153, 173, 32, 33, 87, 201, 25, 161, 56, 216, 32, 144, 49, 98, 20, 188, 136, 154, 1, 138, 69, 169, 9, 185, 72, 249, 10, 34, 49, 20, 153, 33, 169, 0, 155, 102, 161, 158, 25, 128, 169, 172, 115, 3, 156, 144, 25, 6, 171, 83, 168, 49, 178, 140, 1, 169, 153, 9, 0, 17, 249, 74, 21, 137, 1, 153, 172, 56, 66, 146, 140, 145, 75, 55, 8, 51, 3, 251, 142, 2, 138, 67, 217, 139, 152, 128, 136, 83, 184, 40, 49, 6, 41, 135, 188, 32, 130, 200, 172, 32, 24, 70, 2, 185, 174, 40, 129, 49, 192, 9, 232, 42, 2, 72, 132, 154, 1, 16, 232, 26, 129, 32, 8, 55, 185, 9, 40, 179, 62, 39, 155, 36, 203, 32, 202, 8, 202, 24, 128, 16, 64, 5, 185, 138, 161, 141, 21, 155, 178, 159, 21, 40, 133, 155, 35, 168, 169, 56, 177, 43, 7, 153, 17, 1, 137, 16, 238, 10, 1, 40, 4, 204, 25, 1, 81, 35, 33, 234, 56, 2, 64, 192, 140, 160, 156, 34, 185, 113, 133, 187, 168, 172, 32, 24, 4, 187, 84, 128, 50, 168, 57, 160, 42, 21, 185, 203, 169, 64, 38, 136, 144, 190, 48, 216, 57, 22, 153, 136, 129, 170, 66, 144, 116, 145, 24, 146, 8, 176, 174, 9, 16, 35, 168, 10, 250, 175, 128, 138, 33, 160, 16, 234, 88, 36, 8, 33, 34, 168, 185, 141, 144, 75, 133, 91, 6, 137, 2, 203, 0, 170, 17, 173, 34, 169, 50, 169, 9, 35, 171, 103, 137, 19, 221, 8, 154, 36, 18, 184, 42, 176, 80, 201, 16, 188, 3, 140, 163, 175, 36, 1, 17, 50, 193, 139, 145, 137, 8, 17, 145, 172, 26, 85, 200, 58, 148, 143, 19, 136, 129, 156, 67, 17, 130, 169, 25, 161, 155, 33, 115, 135, 138, 131, 191, 10, 184, 42, 55, 144, 24, 1, 201, 172, 24, 66, 161, 25, 36, 185, 139, 4, 221, 9, 17, 68, 130, 40, 18, 24, 67, 19, 222, 155, 170, 204, 25, 131, 9, 3, 8, 1, 202, 32, 34, 1, 48, 119, 1, 48, 18, 219, 139, 52, 34, 36, 251, 170, 203, 25, 68, 160, 153, 184, 41, 21, 32, 3, 219, 8, 33, 54, 232, 155, 49, 52, 54, 35, 161, 204, 186, 173, 32, 19, 136, 169, 173, 154, 152, 201, 171, 184, 191, 220, 239, 47, 0, 48, 36, 144, 169, 173, 50, 51, 55, 0, 49, 128, 98, 36, 152, 138, 136, 24, 68, 130, 188, 171, 186, 138, 50, 67, 161, 223, 26, 35, 0, 115, 131, 9, 177, 175, 128, 170, 9, 1, 32, 132, 190, 32, 251, 155, 0, 136, 16, 161, 170, 0, 176, 141, 53, 16, 160, 12, 4, 204, 104, 38, 0, 33, 160, 25, 51, 20, 9, 51, 1, 129, 169, 234, 173, 48, 100, 19, 170, 153, 137, 185, 112, 22, 1, 33, 3, 137, 55, 129, 128, 202, 187, 171, 8, 129, 171, 36, 205, 32, 169, 144, 191, 155, 186, 138, 35, 221, 32, 160, 48, 144, 85, 51, 19, 99, 35, 51, 192, 42, 209, 157, 18, 169, 203, 170, 252, 155, 153, 187, 202, 170, 186, 8, 33, 144, 203, 186, 9, 83, 70, 130, 171, 10, 52, 36, 51, 69, 2, 171, 81, 17, 50, 144, 0, 171, 146, 223, 128, 172, 1, 154, 50, 50, 131, 187, 233, 174, 144, 41, 20, 25, 20, 9, 35, 169, 16, 153, 54, 250, 113, 131, 9, 184, 42, 224, 41, 232, 41, 176, 80, 130, 155, 200, 175, 9, 153, 138, 24, 152, 136, 251, 42, 3, 120, 20, 153, 17, 136, 128, 56, 39, 128, 66, 129, 8, 33, 83, 176, 27, 146, 140, 68, 36, 35, 136, 49, 129, 250, 156, 67, 176, 90, 23, 169, 8, 136, 152, 171, 129, 220, 171, 11, 34, 152, 58, 53, 136, 100, 20, 0, 66, 34, 66, 67, 53, 145, 137, 137, 233, 27, 37, 152, 33, 129, 0, 176, 188, 237, 189, 153, 185, 187, 170, 16, 253, 155, 192, 188, 8, 8, 49, 54, 67, 83, 50, 50, 69, 51, 82, 52, 34, 67, 51, 35, 50, 52, 2, 0, 129, 144, 204, 203, 203, 203, 204, 187, 203, 204, 187, 202, 186, 171, 202, 170, 186, 172, 170, 169, 153, 138, 1, 32, 3, 154, 49, 250, 12, 35, 201, 154, 136, 235, 189, 154, 204, 171, 188, 171, 172, 187, 156, 144, 186, 9, 144, 41, 55, 35, 84, 67, 83, 52, 51, 66, 68, 34, 50, 67, 35, 67, 35, 17, 50, 145, 24, 192, 173, 202, 203, 202, 188, 220, 171, 185, 204, 154, 169, 202, 154, 153, 169, 138, 35, 49, 38, 33, 54, 18, 115, 67, 34, 67, 52, 18, 35, 34, 67, 51, 20, 50, 19, 160, 153, 153, 252, 155, 136, 235, 154, 168, 206, 137, 202, 8, 185, 9, 144, 16, 160, 56, 146, 120, 4, 9, 36, 8, 67, 24, 68, 16, 99, 161, 26, 145, 188, 8, 3, 153, 32, 218, 188, 205, 186, 186, 9, 153, 41, 145, 158, 51, 160, 120, 86, 1, 32, 52, 136, 40, 22, 32, 52, 152, 16, 35, 208, 58, 23, 153, 65, 19, 128, 26, 22, 170, 97, 2, 16, 144, 169, 170, 0, 222, 56, 193, 140, 128, 205, 187, 155, 204, 11, 66, 129, 0, 34, 128, 115, 37, 68, 52, 52, 51, 68, 34, 50, 52, 67, 34, 51, 51, 50, 18, 252, 109, 44, 0, 24, 2, 186, 220, 188, 188, 190, 188, 203, 187, 219, 187, 172, 204, 186, 186, 186, 187, 169, 218, 171, 186, 187, 186, 203, 8, 136, 168, 189, 136, 251, 139, 152, 137, 192, 173, 169, 172, 185, 157, 0, 203, 138, 152, 153, 137, 40, 85, 34, 99, 52, 35, 51, 85, 35, 50, 53, 52, 34, 33, 51, 35, 33, 128, 16, 176, 175, 203, 189, 235, 172, 187, 188, 203, 187, 188, 189, 170, 186, 155, 170, 153, 168, 137, 2, 64, 55, 68, 52, 83, 51, 83, 50, 67, 50, 68, 35, 67, 34, 51, 18, 33, 35, 67, 145, 32, 18, 168, 190, 154, 186, 205, 187, 154, 202, 203, 187, 186, 220, 154, 152, 137, 160, 27, 19, 187, 24, 82, 22, 128, 16, 137, 83, 160, 41, 20, 18, 186, 72, 146, 33, 184, 118, 5, 32, 53, 52, 145, 80, 2, 8, 0, 82, 20, 168, 25, 217, 172, 172, 10, 169, 64, 225, 11, 132, 172, 128, 24, 178, 90, 133, 153, 34, 145, 155, 18, 136, 20, 154, 170, 114, 181, 141, 82, 145, 155, 0, 154, 128, 234, 10, 35, 236, 26, 176, 221, 172, 136, 234, 138, 8, 40, 67, 69, 35, 33, 67, 68, 53, 52, 68, 51, 51, 35, 67, 36, 35, 36, 50, 17, 0, 8, 152, 202, 189, 203, 205, 203, 172, 203, 203, 187, 172, 187, 173, 171, 203, 170, 186, 170, 153, 137, 169, 137, 136, 24, 114, 35, 83, 35, 67, 17, 33, 18, 66, 19, 49, 20, 176, 187, 172, 170, 204, 171, 154, 129, 204, 40, 35, 17, 100, 84, 35, 52, 53, 36, 36, 50, 52, 19, 50, 36, 17, 144, 8, 216, 204, 188, 188, 204, 188, 203, 172, 172, 187, 172, 171, 203, 187, 186, 203, 154, 137, 16, 18, 67, 52, 84, 35, 68, 52, 67, 51, 52, 36, 50, 52, 34, 67, 34, 51, 18, 50, 34, 33, 136, 33, 144, 172, 203, 172, 184, 175, 169, 187, 217, 173, 153, 170, 186, 139, 201, 156, 185, 173, 152, 203, 137, 153, 152, 203, 40, 176, 205, 172, 17, 219, 40, 129, 33, 17, 99, 18, 99, 52, 66, 36, 83, 53, 33, 52, 49, 36, 17, 52, 1, 34, 0, 128, 186, 187, 206, 205, 187, 187, 204, 188, 154, 186, 171, 172, 8, 154, 171, 65, 216, 80, 131, 65, 21, 0, 16, 34, 136, 65, 4, 32, 37, 202, 33, 192, 9, 200, 41, 208, 141, 0, 137, 129, 171, 35, 222, 153, 187, 24, 186, 117, 37, 68, 34, 67, 35, 66, 52, 68, 67, 67, 35, 51, 51, 50, 50, 51, 34, 2, 128, 169, 237, 188, 188, 205, 187, 189, 203, 203, 202, 186, 187, 203, 187, 219, 186, 186, 171, 170, 136, 8, 16, 16, 50, 50, 55, 68, 67, 67, 67, 34, 51, 50, 50, 34, 51, 67, 130, 48, 161, 155, 184, 186, 206, 154, 205, 136, 152, 0, 0, 37, 0, 115, 34, 66, 34, 83, 18, 66, 2, 24, 145, 173, 234, 203, 219, 19, 0, 45, 0, 188, 204, 187, 188, 188, 203, 203, 187, 173, 170, 186, 170, 170, 171, 154, 137, 49, 83, 54, 52, 68, 51, 67, 52, 52, 83, 50, 67, 35, 51, 51, 50, 36, 33, 51, 17, 50, 177, 158, 128, 235, 154, 169, 170, 235, 203, 186, 186, 204, 170, 153, 185, 156, 8, 201, 171, 8, 170, 41, 20, 16, 144, 26, 23, 169, 98, 145, 138, 130, 139, 53, 203, 114, 4, 64, 20, 65, 36, 32, 53, 19, 99, 34, 82, 34, 32, 36, 0, 2, 128, 17, 218, 138, 217, 189, 186, 204, 171, 219, 155, 153, 188, 170, 187, 170, 220, 10, 17, 9, 65, 1, 40, 35, 36, 16, 119, 2, 17, 34, 129, 33, 144, 65, 131, 186, 137, 152, 207, 26, 162, 157, 184, 191, 169, 188, 16, 1, 115, 55, 34, 35, 36, 51, 68, 52, 69, 50, 51, 67, 34, 34, 50, 34, 50, 35, 136, 153, 250, 204, 219, 203, 187, 204, 187, 219, 203, 187, 187, 188, 187, 203, 187, 203, 186, 169, 138, 9, 16, 18, 50, 52, 84, 67, 51, 53, 52, 50, 67, 51, 49, 50, 50, 36, 18, 18, 128, 152, 170, 154, 168, 190, 137, 189, 138, 169, 8, 136, 65, 66, 52, 53, 18, 81, 4, 8, 19, 186, 144, 223, 203, 204, 202, 188, 189, 203, 172, 172, 187, 188, 203, 187, 203, 170, 171, 170, 170, 137, 136, 16, 84, 53, 52, 52, 68, 50, 67, 67, 36, 67, 50, 67, 35, 50, 50, 33, 50, 18, 33, 34, 152, 202, 188, 203, 188, 187, 188, 219, 204, 170, 203, 170, 202, 170, 185, 173, 136, 203, 138, 184, 140, 144, 155, 130, 172, 0, 171, 68, 65, 38, 34, 52, 50, 54, 34, 84, 51, 50, 69, 50, 82, 19, 48, 20, 33, 35, 17, 35, 152, 129, 204, 137, 235, 171, 236, 186, 202, 187, 203, 172, 187, 188, 154, 235, 156, 136, 185, 170, 8, 2, 154, 53, 34, 71, 17, 65, 19, 136, 52, 130, 32, 35, 17, 144, 8, 168, 255, 137, 185, 174, 154, 152, 9, 50, 102, 52, 66, 52, 35, 68, 51, 68, 36, 67, 35, 67, 34, 35, 34, 18, 18, 1, 152, 187, 220, 220, 203, 188, 188, 219, 186, 203, 188, 186, 172, 172, 170, 170, 187, 186, 186, 154, 137, 16, 50, 68, 67, 68, 34, 68, 51, 51, 52, 53, 34, 50, 50, 34, 32, 35, 19, 1, 168, 186, 206, 171, 170, 204, 138, 203, 170, 202, 9, 152, 155, 24, 84, 145, 56, 37, 136, 128, 10, 161, 191, 219, 190, 186, 206, 186, 219, 187, 189, 187, 188, 203, 187, 172, 171, 187, 155, 153, 154, 24, 33, 100, 83, 83, 36, 67, 67, 50, 52, 36, 51, 52, 51, 67, 36, 34, 50, 2, 16, 34, 160, 9, 176, 206, 187, 188, 205, 171, 187, 205, 170, 203, 187, 203, 172, 170, 203, 170, 154, 170, 154, 9, 152, 25, 83, 82, 68, 50, 38, 50, 52, 67, 83, 50, 50, 36, 34, 52, 18, 238, 8, 43, 0, 49, 35, 17, 32, 33, 1, 219, 154, 219, 169, 220, 170, 168, 220, 171, 169, 251, 170, 152, 204, 153, 201, 10, 176, 141, 17, 171, 81, 1, 136, 24, 20, 187, 114, 130, 9, 0, 0, 16, 35, 33, 50, 249, 175, 25, 129, 11, 119, 22, 65, 52, 34, 51, 52, 67, 67, 67, 36, 51, 35, 50, 33, 33, 17, 136, 169, 188, 221, 188, 204, 219, 187, 188, 187, 189, 202, 187, 203, 187, 187, 186, 186, 186, 170, 169, 136, 49, 83, 54, 51, 68, 52, 51, 67, 68, 18, 66, 34, 34, 19, 33, 17, 0, 128, 9, 1, 203, 186, 206, 153, 172, 154, 187, 153, 220, 8, 169, 40, 185, 57, 177, 49, 249, 64, 224, 139, 184, 204, 186, 188, 205, 188, 202, 188, 171, 204, 171, 187, 172, 171, 186, 202, 170, 168, 154, 83, 35, 115, 67, 50, 83, 37, 51, 84, 18, 50, 51, 51, 67, 36, 18, 66, 34, 0, 34, 160, 203, 186, 235, 188, 185, 190, 187, 189, 203, 187, 203, 187, 187, 204, 170, 186, 170, 169, 138, 16, 49, 54, 83, 67, 50, 52, 83, 52, 67, 51, 36, 34, 35, 67, 18, 49, 35, 8, 152, 153, 184, 175, 186, 174, 152, 190, 8, 201, 153, 152, 9, 169, 40, 216, 12, 20, 170, 81, 130, 81, 19, 153, 128, 186, 205, 139, 128, 219, 172, 202, 172, 185, 173, 0, 186, 203, 172, 153, 172, 80, 68, 85, 52, 52, 83, 51, 67, 67, 51, 37, 35, 36, 35, 18, 34, 35, 1, 16, 152, 218, 204, 202, 220, 186, 204, 171, 203, 187, 188, 203, 187, 172, 170, 185, 170, 153, 170, 137, 17, 33, 100, 35, 67, 67, 67, 18, 67, 19, 50, 19, 67, 3, 24, 130, 137, 184, 158, 128, 204, 137, 202, 10, 128, 137, 68, 52, 18, 85, 19, 49, 37, 32, 34, 51, 20, 24, 19, 185, 219, 189, 219, 205, 219, 203, 202, 203, 187, 186, 189, 170, 186, 187, 186, 187, 187, 9, 169, 104, 53, 36, 67, 84, 34, 67, 67, 50, 36, 34, 35, 51, 35, 66, 36, 18, 51, 129, 16, 161, 205, 188, 187, 235, 173, 170, 202, 172, 170, 187, 171, 203, 188, 170, 202, 172, 137, 128, 137, 65, 67, 67, 34, 67, 130, 66, 3, 48, 69, 33, 33, 51, 53, 35, 50, 20, 128, 202, 156, 185, 155, 128, 186, 96, 130, 25, 130, 11, 176, 31, 37, 9, 71, 18, 2, 48, 21, 171, 65, 184, 25, 250, 172, 169, 220, 156, 136, 171, 169, 205, 155, 235, 189, 9, 1, 24, 86, 51, 52, 52, 68, 34, 83, 50, 50, 52, 34, 50, 36, 18, 33, 19, 128, 153, 169, 221, 203, 188, 220, 186, 202, 219, 154, 186, 188, 170, 170, 187, 155, 201, 154, 136, 138, 65, 35, 34, 84, 51, 33, 66, 19, 33, 67, 145, 41, 3, 187, 168, 187, 128, 173, 50, 249, 56, 145, 41, 87, 83, 67, 83, 51, 67, 51, 50, 50, 35, 24, 20, 3, 39, 39, 0, 185, 170, 220, 204, 188, 187, 205, 203, 203, 188, 203, 187, 188, 186, 187, 171, 185, 154, 169, 154, 152, 57, 20, 113, 54, 33, 20, 50, 54, 17, 99, 34, 33, 17, 34, 8, 84, 18, 24, 69, 130, 16, 50, 144, 24, 129, 152, 138, 160, 255, 138, 202, 171, 170, 202, 187, 219, 204, 169, 185, 173, 138, 152, 137, 0, 16, 34, 17, 49, 71, 51, 83, 52, 4, 0, 51, 50, 51, 82, 4, 10, 129, 190, 17, 200, 137, 152, 16, 250, 11, 3, 220, 25, 130, 138, 66, 130, 65, 53, 1, 17, 83, 130, 137, 49, 131, 255, 41, 192, 158, 0, 202, 138, 168, 202, 172, 154, 203, 138, 16, 66, 102, 36, 34, 53, 37, 49, 66, 67, 34, 33, 50, 17, 1, 32, 34, 128, 136, 218, 219, 203, 220, 188, 170, 220, 186, 169, 203, 171, 170, 170, 154, 154, 138, 128, 152, 24, 67, 35, 65, 69, 18, 32, 51, 2, 34, 18, 176, 11, 179, 255, 24, 185, 10, 18, 33, 50, 103, 19, 67, 36, 51, 54, 34, 50, 53, 2, 17, 33, 144, 169, 203, 203, 220, 188, 188, 187, 205, 170, 186, 172, 186, 173, 170, 186, 171, 171, 136, 169, 8, 16, 18, 17, 69, 33, 69, 2, 81, 18, 48, 19, 32, 55, 35, 33, 53, 18, 67, 35, 98, 69, 18, 65, 52, 17, 34, 37, 17, 33, 18, 152, 186, 204, 189, 172, 203, 172, 171, 189, 187, 219, 186, 186, 203, 154, 153, 171, 138, 33, 1, 98, 67, 99, 34, 66, 35, 49, 22, 136, 66, 129, 128, 136, 136, 1, 204, 41, 50, 177, 141, 52, 192, 10, 2, 235, 72, 3, 154, 85, 19, 137, 115, 19, 137, 33, 168, 170, 218, 171, 168, 202, 238, 155, 129, 206, 10, 128, 203, 138, 160, 189, 0, 160, 113, 53, 67, 68, 52, 36, 66, 35, 67, 35, 33, 34, 17, 128, 0, 0, 137, 185, 190, 219, 204, 203, 203, 187, 173, 186, 203, 170, 185, 186, 137, 144, 154, 8, 17, 185, 9, 161, 172, 154, 219, 188, 185, 206, 170, 202, 171, 153, 185, 41, 38, 16, 85, 51, 66, 100, 51, 66, 68, 18, 66, 34, 34, 34, 51, 144, 136, 184, 206, 188, 202, 204, 170, 186, 188, 186, 202, 187, 153, 186, 138, 184, 172, 137, 186, 171, 33, 185, 41, 35, 130, 189, 0, 238, 9, 176, 157, 0, 128, 138, 69, 34, 71, 67, 67, 83, 35, 33, 53, 18, 49, 67, 18, 33, 20, 128, 2, 144, 203, 138, 250, 173, 186, 205, 186, 202, 186, 155, 185, 188, 137, 217, 171, 0, 176, 140, 32, 145, 10, 53, 169, 114, 4, 40, 54, 1, 16, 3, 144, 128, 128, 1, 169, 32, 233, 112, 130, 56, 54, 17, 50, 129, 152, 186, 172, 186, 27, 23, 170, 69, 1, 49, 144, 49, 248, 155, 234, 154, 169, 191, 138, 144, 205, 138, 144, 170, 8, 161, 157, 0, 219, 10, 69, 51, 103, 36, 67, 52, 51, 111, 43, 59, 0, 83, 51, 51, 51, 51, 2, 1, 0, 144, 136, 201, 203, 219, 204, 188, 187, 204, 187, 203, 172, 170, 172, 170, 170, 170, 154, 9, 168, 155, 234, 172, 185, 189, 171, 187, 204, 155, 202, 155, 0, 153, 65, 84, 35, 83, 53, 34, 52, 37, 50, 52, 51, 52, 34, 51, 35, 17, 18, 200, 189, 202, 205, 172, 202, 187, 171, 203, 171, 153, 169, 170, 0, 152, 137, 34, 250, 139, 202, 189, 154, 187, 189, 153, 235, 170, 169, 188, 155, 186, 187, 8, 153, 115, 37, 68, 36, 69, 51, 67, 36, 35, 36, 18, 33, 18, 0, 9, 17, 235, 138, 200, 175, 136, 218, 154, 168, 202, 171, 154, 203, 139, 128, 155, 66, 160, 41, 18, 9, 33, 160, 203, 170, 252, 188, 25, 185, 139, 49, 50, 37, 48, 54, 16, 52, 24, 103, 129, 56, 4, 24, 52, 0, 83, 2, 17, 168, 57, 241, 158, 144, 186, 152, 187, 137, 24, 3, 172, 102, 161, 155, 2, 204, 8, 169, 48, 232, 26, 163, 173, 0, 152, 136, 65, 147, 174, 65, 130, 41, 119, 67, 52, 68, 67, 51, 36, 51, 51, 36, 17, 17, 128, 137, 152, 202, 187, 204, 188, 189, 203, 186, 203, 186, 171, 219, 186, 185, 186, 187, 154, 186, 173, 128, 251, 155, 168, 206, 137, 201, 171, 168, 172, 154, 136, 128, 40, 70, 35, 99, 52, 67, 66, 50, 51, 51, 52, 33, 67, 2, 0, 129, 154, 201, 189, 203, 204, 187, 189, 188, 171, 187, 156, 137, 153, 136, 33, 2, 57, 39, 160, 16, 233, 187, 204, 202, 188, 138, 218, 171, 152, 172, 138, 136, 154, 48, 3, 41, 103, 34, 66, 53, 36, 67, 52, 18, 67, 34, 8, 33, 160, 156, 168, 235, 170, 152, 204, 9, 184, 157, 136, 169, 187, 138, 251, 139, 145, 187, 81, 3, 0, 99, 19, 138, 36, 202, 154, 219, 204, 171, 185, 205, 24, 152, 40, 51, 68, 35, 69, 2, 50, 21, 0, 17, 17, 152, 10, 2, 185, 48, 178, 175, 16, 251, 171, 156, 169, 188, 137, 169, 56, 39, 136, 85, 3, 56, 35, 152, 49, 129, 172, 41, 146, 204, 155, 177, 255, 9, 216, 139, 128, 204, 9, 128, 170, 114, 54, 50, 85, 67, 50, 67, 35, 50, 51, 2, 1, 129, 169, 172, 186, 206, 187, 203, 188, 186, 186, 186, 170, 152, 203, 10, 161, 188, 9, 169, 202, 188, 202, 221, 187, 251, 171, 187, 188, 172, 171, 171, 153, 138, 49, 50, 87, 50, 99, 35, 52, 35, 67, 51, 17, 18, 17, 0, 169, 186, 205, 171, 204, 172, 154, 186, 170, 170, 154, 168, 153, 32, 83, 38, 145, 80, 20, 170, 41, 192, 206, 170, 205, 172, 170, 219, 170, 153, 202, 137, 136, 9, 33, 19, 48, 71, 2, 67, 67, 51, 83, 51, 51, 68, 34, 16, 17, 128, 170, 189, 172, 187, 203, 187, 153, 153, 136, 66, 35, 81, 36, 144, 169, 153, 251, 159, 136, 186, 153, 238, 43, 0, 155, 201, 187, 154, 153, 190, 42, 208, 173, 9, 144, 154, 81, 18, 84, 52, 49, 53, 52, 19, 49, 51, 144, 154, 187, 222, 187, 185, 190, 137, 186, 154, 152, 64, 35, 64, 69, 3, 49, 35, 24, 52, 2, 169, 88, 133, 187, 33, 152, 34, 223, 41, 178, 140, 35, 169, 17, 169, 250, 159, 1, 236, 137, 129, 170, 155, 32, 18, 116, 68, 83, 68, 35, 67, 52, 34, 50, 50, 17, 8, 128, 186, 204, 187, 190, 172, 187, 203, 169, 169, 153, 16, 0, 8, 0, 136, 136, 251, 155, 219, 204, 188, 188, 204, 203, 202, 187, 187, 188, 154, 170, 136, 16, 68, 66, 69, 51, 68, 35, 36, 50, 18, 1, 16, 152, 203, 187, 188, 220, 186, 169, 155, 137, 137, 33, 51, 36, 35, 100, 35, 17, 50, 36, 136, 136, 216, 188, 219, 206, 187, 219, 188, 172, 185, 186, 154, 153, 137, 34, 34, 69, 52, 51, 67, 36, 18, 51, 18, 33, 20, 128, 32, 2, 153, 9, 18, 220, 156, 8, 1, 56, 87, 51, 84, 51, 34, 69, 18, 16, 129, 170, 220, 188, 188, 203, 203, 171, 171, 187, 156, 137, 137, 16, 34, 50, 101, 18, 33, 54, 34, 51, 52, 18, 51, 161, 171, 184, 207, 204, 155, 201, 188, 137, 152, 25, 34, 52, 52, 54, 51, 68, 36, 17, 51, 129, 9, 145, 191, 136, 251, 137, 152, 138, 169, 48, 161, 88, 2, 73, 37, 152, 65, 37, 144, 24, 161, 189, 187, 205, 187, 171, 203, 173, 8, 0, 81, 85, 52, 53, 52, 52, 67, 50, 50, 34, 18, 0, 152, 185, 204, 219, 203, 170, 187, 187, 153, 137, 0, 50, 50, 20, 128, 200, 190, 202, 191, 172, 203, 188, 203, 187, 188, 187, 187, 172, 154, 153, 8, 50, 99, 68, 67, 67, 67, 50, 50, 35, 1, 128, 169, 204, 187, 188, 187, 155, 136, 32, 70, 67, 68, 35, 51, 51, 34, 1, 128, 184, 190, 186, 207, 171, 203, 188, 203, 203, 186, 172, 171, 170, 138, 9, 49, 68, 67, 52, 51, 34, 18, 184, 174, 203, 189, 172, 186, 170, 153, 40, 53, 53, 54, 51, 53, 35, 51, 67, 33, 32, 17, 136, 153, 170, 219, 172, 170, 203, 186, 235, 186, 202, 171, 185, 170, 16, 128, 65, 18, 68, 145, 9, 177, 223, 188, 204, 186, 188, 187, 137, 9, 48, 67, 69, 52, 67, 67, 51, 34, 17, 1, 201, 154, 217, 171, 152, 189, 137, 185, 26, 2, 0, 116, 52, 17, 99, 18, 34, 3, 25, 54, 184, 40, 132, 141, 50, 184, 26, 162, 191, 154, 220, 171, 168, 188, 9, 185, 141, 16, 154, 81, 20, 16, 34, 129, 171, 80, 99, 69, 84, 53, 66, 67, 51, 67, 35, 51, 33, 0, 152, 202, 203, 188, 171, 170, 170, 8, 0, 50, 36, 52, 18, 128, 252, 173, 188, 189, 188, 188, 202, 170, 171, 187, 170, 187, 171, 169, 154, 8, 136, 33, 68, 68, 67, 68, 107, 236, 50, 0, 51, 52, 51, 17, 17, 160, 188, 187, 172, 170, 136, 115, 52, 69, 52, 52, 36, 51, 18, 1, 160, 204, 188, 172, 188, 187, 186, 187, 186, 155, 169, 8, 168, 139, 251, 173, 218, 187, 186, 188, 187, 172, 171, 205, 170, 185, 155, 153, 24, 51, 54, 69, 66, 83, 51, 68, 51, 50, 36, 16, 17, 137, 16, 16, 83, 35, 99, 52, 50, 83, 35, 35, 18, 202, 202, 206, 187, 189, 170, 187, 154, 186, 25, 168, 25, 18, 67, 129, 136, 153, 239, 171, 202, 139, 128, 25, 36, 49, 21, 16, 37, 17, 68, 2, 66, 129, 49, 145, 72, 5, 25, 36, 185, 41, 193, 173, 65, 136, 114, 35, 67, 34, 36, 144, 32, 217, 140, 217, 156, 136, 188, 16, 49, 37, 49, 71, 0, 16, 152, 169, 187, 190, 171, 204, 187, 155, 186, 155, 67, 67, 53, 66, 51, 129, 32, 51, 52, 86, 53, 37, 51, 68, 35, 50, 36, 34, 0, 152, 185, 220, 186, 154, 138, 136, 49, 68, 34, 68, 18, 17, 169, 205, 220, 203, 188, 188, 187, 187, 171, 171, 137, 8, 136, 9, 18, 168, 138, 185, 205, 188, 173, 153, 154, 33, 65, 53, 50, 37, 0, 66, 2, 83, 50, 69, 35, 67, 50, 67, 18, 33, 18, 185, 235, 188, 203, 172, 138, 0, 33, 20, 51, 35, 160, 204, 204, 190, 204, 188, 203, 172, 171, 171, 153, 136, 33, 34, 52, 35, 50, 2, 0, 169, 173, 234, 189, 170, 171, 10, 65, 85, 52, 53, 51, 52, 52, 50, 99, 34, 33, 17, 1, 168, 170, 169, 219, 138, 185, 171, 203, 173, 136, 136, 24, 34, 129, 235, 187, 238, 187, 188, 188, 170, 188, 185, 187, 153, 154, 64, 84, 67, 52, 34, 51, 129, 24, 1, 187, 11, 201, 169, 204, 81, 34, 70, 67, 68, 34, 34, 17, 1, 185, 173, 153, 204, 154, 152, 136, 136, 41, 21, 40, 67, 35, 161, 155, 176, 255, 8, 1, 0, 50, 37, 1, 17, 146, 191, 170, 204, 154, 218, 139, 2, 251, 25, 52, 0, 115, 51, 1, 1, 16, 2, 41, 119, 52, 51, 84, 51, 34, 34, 18, 145, 170, 185, 221, 187, 156, 144, 0, 67, 99, 51, 34, 34, 160, 220, 204, 203, 188, 188, 186, 171, 170, 153, 16, 50, 67, 19, 34, 192, 189, 204, 188, 203, 187, 170, 138, 9, 65, 68, 67, 67, 35, 35, 17, 129, 153, 153, 155, 136, 9, 34, 137, 84, 0, 69, 33, 100, 2, 34, 35, 0, 49, 128, 154, 219, 237, 204, 187, 204, 171, 171, 154, 153, 128, 24, 34, 20, 16, 51, 176, 220, 204, 205, 187, 188, 187, 138, 152, 48, 53, 52, 53, 53, 50, 52, 35, 33, 17, 160, 202, 9, 130, 58, 103, 33, 52, 66, 51, 66, 34, 17, 129, 218, 188, 203, 173, 171, 154, 169, 9, 0, 0, 18, 17, 0, 129, 220, 205, 203, 188, 173, 171, 171, 154, 16, 17, 66, 67, 19, 50, 52, 176, 231, 39, 0, 67, 50, 34, 17, 18, 184, 97, 53, 68, 83, 52, 35, 34, 51, 16, 49, 35, 66, 35, 176, 188, 253, 187, 154, 128, 32, 69, 17, 2, 153, 176, 158, 160, 156, 202, 157, 186, 139, 129, 106, 22, 16, 131, 138, 200, 191, 153, 172, 154, 9, 67, 34, 117, 36, 49, 34, 17, 146, 172, 128, 187, 114, 53, 69, 36, 67, 35, 33, 1, 152, 186, 204, 187, 173, 153, 136, 50, 52, 100, 34, 17, 129, 169, 236, 203, 203, 203, 170, 155, 138, 137, 0, 49, 35, 50, 18, 184, 252, 190, 187, 219, 187, 153, 137, 8, 82, 51, 67, 53, 33, 18, 0, 160, 170, 202, 171, 137, 0, 66, 53, 35, 52, 35, 34, 85, 51, 52, 68, 18, 0, 152, 219, 204, 203, 187, 187, 172, 10, 16, 66, 83, 67, 2, 128, 218, 220, 187, 173, 171, 171, 136, 24, 51, 83, 83, 34, 33, 0, 1, 202, 170, 203, 171, 154, 49, 83, 85, 51, 52, 67, 67, 34, 67, 35, 34, 35, 17, 128, 169, 186, 205, 139, 152, 138, 66, 70, 34, 35, 35, 161, 191, 188, 189, 189, 187, 187, 171, 155, 24, 50, 19, 115, 19, 169, 186, 220, 204, 188, 170, 154, 138, 33, 68, 52, 67, 51, 52, 18, 17, 1, 16, 168, 10, 2, 169, 139, 99, 83, 87, 51, 68, 50, 33, 0, 136, 186, 204, 153, 185, 138, 67, 53, 83, 52, 18, 2, 0, 152, 205, 203, 188, 204, 154, 153, 33, 51, 67, 129, 202, 221, 205, 170, 170, 8, 83, 69, 52, 36, 35, 34, 1, 169, 170, 219, 188, 154, 8, 48, 70, 52, 67, 51, 35, 2, 144, 235, 203, 203, 171, 170, 153, 8, 1, 1, 32, 145, 171, 237, 171, 218, 204, 170, 186, 188, 171, 187, 203, 170, 153, 154, 40, 35, 17, 83, 145, 186, 219, 189, 203, 187, 155, 153, 152, 72, 38, 50, 70, 83, 51, 36, 51, 18, 0, 152, 172, 153, 170, 24, 83, 50, 55, 20, 49, 35, 168, 187, 204, 206, 172, 169, 170, 138, 1, 152, 8, 145, 189, 139, 185, 154, 0, 152, 97, 200, 140, 34, 184, 140, 85, 145, 10, 52, 20, 49, 84, 35, 51, 20, 8, 35, 184, 27, 53, 185, 88, 20, 128, 48, 20, 170, 99, 160, 188, 153, 219, 170, 137, 17, 0, 103, 2, 32, 50, 144, 187, 235, 189, 154, 187, 64, 36, 33, 51, 36, 177, 189, 8, 200, 188, 97, 83, 51, 68, 52, 34, 8, 137, 185, 221, 138, 168, 8, 17, 82, 53, 67, 67, 19, 152, 184, 207, 203, 170, 10, 50, 71, 83, 67, 34, 33, 0, 169, 202, 187, 203, 187, 136, 24, 82, 67, 53, 35, 50, 34, 152, 218, 189, 204, 188, 170, 170, 136, 32, 50, 35, 33, 144, 202, 190, 188, 204, 188, 170, 203, 169, 153, 9, 0, 16, 33, 83, 19, 1, 129, 235, 204, 219, 187, 187, 155, 8, 66, 68, 52, 35, 34, 1, 0, 1, 24, 51, 129, 150, 238, 31, 0, 49, 193, 172, 40, 99, 68, 84, 52, 18, 33, 2, 186, 186, 221, 155, 169, 154, 16, 52, 52, 36, 50, 18, 203, 137, 234, 140, 136, 154, 48, 145, 10, 51, 201, 96, 19, 32, 87, 1, 48, 4, 137, 128, 219, 138, 169, 41, 53, 98, 52, 1, 33, 3, 136, 169, 170, 187, 237, 155, 0, 24, 49, 68, 19, 1, 201, 188, 237, 170, 186, 155, 32, 160, 120, 3, 169, 136, 233, 174, 24, 153, 9, 34, 1, 9, 184, 12, 131, 239, 154, 0, 152, 40, 53, 67, 68, 18, 50, 20, 136, 169, 152, 235, 41, 35, 82, 69, 34, 18, 18, 129, 169, 81, 130, 97, 37, 17, 65, 1, 136, 17, 35, 50, 68, 18, 33, 36, 33, 34, 34, 146, 139, 51, 169, 119, 39, 33, 67, 35, 0, 128, 185, 188, 202, 155, 0, 33, 52, 37, 1, 128, 250, 188, 219, 189, 155, 24, 49, 86, 51, 35, 35, 128, 152, 204, 153, 233, 187, 154, 8, 136, 113, 35, 33, 50, 1, 24, 193, 173, 160, 207, 137, 185, 169, 169, 153, 170, 170, 156, 152, 205, 170, 204, 188, 172, 188, 188, 203, 155, 186, 171, 201, 187, 202, 188, 188, 202, 170, 154, 187, 202, 203, 170, 188, 172, 171, 202, 188, 154, 170, 153, 9, 16, 153, 221, 205, 170, 170, 138, 33, 66, 69, 35, 67, 35, 2, 152, 186, 206, 203, 187, 187, 138, 49, 84, 52, 68, 36, 51, 51, 67, 17, 136, 153, 219, 138, 136, 16, 99, 52, 51, 70, 34, 51, 34, 50, 19, 16, 52, 36, 50, 51, 51, 70, 50, 68, 67, 51, 53, 50, 67, 35, 34, 18, 16, 51, 0, 51, 49, 55, 3, 32, 84, 19, 17, 68, 37, 2, 48, 19, 152, 202, 188, 187, 173, 24, 0, 16, 69, 19, 8, 144, 187, 160, 222, 25, 160, 26, 131, 188, 8, 201, 11, 50, 53, 67, 54, 34, 82, 36, 18, 17, 17, 204, 155, 152, 114, 52, 83, 84, 34, 50, 18, 34, 161, 156, 34, 201, 25, 130, 205, 9, 168, 138, 176, 105, 39, 18, 34, 17, 0, 200, 205, 169, 203, 187, 169, 136, 216, 11, 2, 186, 173, 9, 250, 159, 8, 169, 9, 145, 172, 0, 235, 154, 153, 136, 202, 156, 168, 186, 137, 1, 217, 155, 221, 155, 168, 235, 9, 0, 219, 153, 170, 172, 201, 172, 138, 187, 155, 188, 11, 218, 171, 203, 140, 115, 37, 51, 53, 51, 51, 66, 51, 18, 66, 50, 100, 51, 51, 69, 18, 50, 35, 50, 18, 32, 20, 184, 24, 234, 9, 217, 172, 128, 204, 172, 168, 170, 185, 191, 204, 219, 187, 172, 170, 170, 185, 171, 219, 186, 185, 202, 189, 172, 188, 170, 186, 170, 138, 186, 171, 152, 204, 203, 203, 203, 203, 170, 155, 201, 188, 204, 187, 188, 187, 171, 8, 0, 67, 2, 25, 208, 11, 37, 50, 36, 184, 239, 219, 155, 0, 32, 54, 50, 3, 219, 204, 186, 171, 49, 70, 51, 177, 235, 38, 0, 144, 25, 33, 100, 70, 36, 161, 204, 154, 40, 68, 68, 34, 160, 219, 186, 138, 33, 37, 18, 152, 169, 136, 51, 53, 130, 170, 203, 154, 24, 83, 52, 2, 168, 40, 51, 70, 35, 152, 185, 172, 65, 36, 129, 8, 34, 68, 36, 118, 36, 18, 168, 205, 188, 154, 0, 67, 67, 2, 168, 170, 169, 172, 16, 3, 136, 218, 174, 138, 40, 55, 34, 0, 185, 220, 187, 9, 66, 69, 1, 184, 203, 188, 138, 49, 83, 51, 3, 152, 203, 173, 138, 32, 67, 3, 251, 173, 9, 66, 83, 51, 145, 219, 172, 171, 40, 99, 51, 131, 218, 187, 154, 49, 67, 19, 128, 202, 154, 49, 17, 34, 177, 239, 171, 155, 32, 52, 52, 20, 128, 185, 204, 187, 172, 9, 69, 20, 18, 128, 203, 170, 9, 17, 1, 185, 8, 217, 155, 32, 67, 68, 35, 184, 205, 137, 8, 66, 54, 18, 176, 206, 172, 10, 83, 51, 35, 168, 187, 187, 139, 8, 128, 24, 16, 114, 37, 144, 8, 18, 17, 33, 248, 207, 153, 0, 82, 20, 128, 185, 206, 155, 9, 34, 36, 34, 34, 1, 34, 146, 220, 170, 153, 0, 65, 69, 1, 32, 67, 50, 52, 3, 187, 202, 206, 24, 18, 66, 19, 128, 185, 11, 83, 85, 34, 0, 184, 221, 187, 153, 137, 33, 1, 168, 219, 172, 171, 152, 169, 221, 204, 172, 187, 170, 8, 0, 8, 202, 188, 186, 137, 136, 136, 235, 206, 187, 155, 137, 66, 34, 51, 1, 250, 25, 130, 89, 39, 17, 33, 18, 136, 32, 145, 24, 160, 42, 37, 50, 103, 36, 145, 169, 202, 153, 136, 81, 53, 2, 136, 153, 188, 171, 25, 54, 17, 66, 144, 136, 154, 99, 161, 173, 138, 235, 26, 84, 18, 67, 145, 187, 203, 154, 66, 52, 2, 1, 184, 11, 129, 56, 22, 49, 3, 113, 35, 40, 52, 129, 203, 153, 187, 120, 20, 99, 130, 24, 168, 188, 154, 81, 17, 50, 2, 219, 156, 65, 36, 19, 8, 71, 161, 26, 20, 169, 10, 129, 170, 8, 72, 71, 0, 16, 169, 201, 191, 8, 168, 32, 145, 24, 161, 207, 154, 136, 16, 128, 32, 145, 189, 9, 0, 137, 25, 22, 236, 25, 19, 81, 52, 1, 176, 206, 153, 136, 32, 54, 35, 33, 145, 186, 220, 170, 152, 137, 48, 4, 137, 128, 190, 72, 34, 67, 20, 144, 185, 174, 128, 219, 40, 240, 172, 17, 169, 115, 2, 137, 145, 189, 203, 173, 32, 1, 112, 19, 170, 0, 186, 56, 20, 82, 19, 152, 202, 190, 24, 152, 97, 3, 154, 34, 170, 100, 2, 50, 162, 220, 170, 154, 65, 128, 115, 162, 157, 152, 155, 49, 67, 36, 34, 184, 187, 207, 9, 153, 81, 129, 137, 128, 204, 41, 178, 26, 241, 175, 153, 138, 116, 53, 50, 19, 184, 188, 204, 137, 33, 66, 52, 128, 9, 0, 40, 69, 18, 152, 189, 203, 170, 48, 38, 16, 130, 205, 153, 77, 23, 59, 0, 153, 49, 51, 18, 217, 206, 172, 154, 8, 32, 19, 145, 153, 203, 138, 136, 0, 250, 188, 205, 154, 32, 66, 51, 3, 144, 235, 156, 0, 16, 67, 130, 168, 186, 171, 98, 51, 69, 3, 136, 136, 154, 81, 35, 2, 184, 174, 169, 10, 71, 51, 50, 129, 186, 221, 139, 0, 168, 32, 160, 12, 1, 137, 53, 176, 173, 218, 188, 153, 16, 35, 152, 24, 250, 171, 8, 33, 68, 18, 49, 216, 138, 1, 16, 66, 99, 34, 19, 17, 99, 51, 17, 85, 161, 32, 130, 136, 40, 55, 17, 67, 66, 160, 104, 2, 32, 35, 67, 145, 188, 156, 128, 138, 33, 81, 178, 191, 16, 184, 73, 38, 153, 136, 222, 171, 152, 138, 49, 67, 19, 186, 137, 219, 155, 152, 48, 20, 219, 32, 161, 27, 54, 51, 53, 128, 26, 34, 1, 116, 51, 36, 145, 172, 137, 1, 80, 86, 34, 0, 169, 155, 169, 155, 115, 19, 137, 185, 173, 136, 9, 84, 3, 185, 252, 171, 153, 154, 98, 19, 137, 184, 191, 170, 155, 50, 51, 69, 160, 173, 169, 173, 32, 2, 82, 131, 9, 17, 171, 115, 7, 8, 129, 203, 155, 32, 145, 113, 55, 152, 41, 176, 174, 16, 144, 8, 35, 128, 153, 137, 153, 48, 136, 83, 200, 156, 32, 250, 42, 146, 172, 169, 26, 3, 112, 39, 160, 153, 234, 203, 187, 173, 24, 49, 86, 67, 52, 130, 169, 203, 205, 154, 24, 66, 50, 83, 18, 152, 8, 152, 136, 184, 156, 169, 155, 81, 68, 50, 20, 154, 184, 190, 153, 32, 17, 169, 235, 188, 188, 138, 49, 53, 2, 129, 218, 188, 189, 154, 153, 171, 10, 33, 32, 71, 34, 1, 186, 206, 186, 170, 25, 50, 52, 36, 0, 16, 1, 32, 18, 2, 234, 173, 137, 1, 82, 69, 35, 16, 1, 144, 40, 2, 187, 168, 255, 155, 8, 32, 67, 67, 2, 152, 204, 171, 169, 205, 153, 170, 170, 40, 52, 68, 18, 128, 203, 204, 203, 137, 16, 17, 16, 67, 51, 8, 101, 18, 8, 169, 153, 155, 33, 117, 53, 33, 33, 18, 169, 9, 48, 5, 10, 37, 154, 70, 129, 114, 2, 8, 168, 138, 201, 40, 18, 40, 162, 139, 20, 9, 66, 101, 4, 219, 138, 185, 187, 25, 37, 17, 51, 160, 136, 184, 156, 32, 209, 207, 8, 8, 33, 17, 87, 146, 137, 128, 171, 137, 0, 17, 49, 145, 57, 20, 114, 36, 67, 4, 169, 169, 202, 171, 154, 99, 36, 35, 17, 52, 144, 202, 172, 144, 207, 155, 152, 152, 40, 50, 53, 131, 204, 138, 249, 158, 136, 137, 144, 137, 0, 50, 176, 112, 5, 169, 152, 203, 137, 203, 88, 18, 82, 161, 64, 210, 12, 2, 155, 19, 171, 52, 152, 2, 11, 119, 169, 48, 192, 25, 145, 139, 24, 52, 250, 88, 178, 12, 19, 169, 40, 144, 170, 64, 162, 141, 52, 129, 137, 250, 155, 18, 204, 48, 51, 36, 203, 252, 0, 48, 0, 49, 251, 41, 184, 72, 176, 156, 17, 218, 72, 19, 8, 201, 189, 187, 139, 114, 84, 51, 18, 160, 186, 205, 138, 16, 66, 68, 2, 16, 0, 16, 1, 48, 147, 189, 170, 144, 64, 55, 50, 4, 153, 233, 155, 144, 154, 50, 145, 203, 219, 171, 170, 8, 129, 186, 254, 187, 203, 154, 152, 40, 176, 158, 184, 172, 169, 8, 232, 139, 201, 172, 128, 17, 36, 18, 18, 218, 154, 202, 40, 146, 32, 17, 49, 65, 119, 20, 17, 18, 168, 154, 136, 32, 51, 70, 17, 32, 1, 48, 39, 128, 0, 201, 188, 155, 136, 187, 99, 129, 152, 154, 17, 186, 72, 249, 191, 186, 171, 136, 137, 83, 51, 3, 188, 10, 162, 191, 49, 192, 137, 8, 84, 2, 116, 19, 16, 152, 136, 169, 16, 32, 87, 144, 48, 37, 136, 98, 18, 0, 152, 49, 185, 11, 53, 68, 51, 1, 49, 177, 28, 50, 54, 161, 8, 152, 253, 156, 34, 145, 97, 3, 153, 153, 202, 171, 0, 160, 57, 23, 186, 58, 22, 154, 51, 249, 154, 153, 154, 24, 39, 1, 33, 152, 16, 220, 56, 129, 49, 177, 58, 195, 158, 1, 82, 36, 40, 4, 171, 2, 175, 16, 16, 1, 9, 2, 188, 10, 50, 52, 131, 8, 250, 223, 153, 138, 2, 136, 33, 200, 187, 191, 154, 170, 202, 10, 224, 11, 130, 156, 99, 144, 24, 200, 190, 155, 128, 128, 99, 3, 1, 200, 138, 16, 18, 50, 6, 8, 250, 142, 18, 170, 113, 20, 153, 40, 184, 28, 2, 155, 87, 160, 138, 129, 136, 32, 53, 16, 18, 219, 9, 251, 11, 35, 8, 17, 16, 1, 186, 49, 132, 187, 8, 250, 175, 136, 24, 129, 24, 145, 12, 5, 205, 185, 188, 169, 203, 89, 70, 34, 34, 1, 216, 188, 138, 152, 48, 38, 50, 36, 128, 32, 35, 160, 24, 217, 140, 169, 88, 36, 84, 2, 8, 161, 172, 169, 138, 18, 137, 52, 236, 25, 160, 40, 145, 9, 250, 175, 168, 171, 0, 1, 128, 153, 168, 205, 138, 169, 189, 170, 172, 172, 25, 18, 81, 20, 153, 153, 205, 155, 138, 33, 49, 36, 152, 83, 168, 81, 2, 115, 161, 42, 131, 140, 18, 114, 3, 41, 34, 49, 3, 27, 39, 186, 170, 28, 37, 219, 114, 1, 0, 185, 40, 249, 26, 160, 57, 179, 12, 21, 186, 16, 152, 16, 236, 9, 176, 42, 177, 90, 147, 141, 131, 141, 52, 153, 65, 176, 138, 168, 154, 33, 85, 35, 3, 11, 55, 168, 82, 200, 88, 145, 24, 1, 115, 145, 64, 130, 40, 177, 75, 39, 137, 128, 66, 133, 204, 64, 3, 170, 40, 35, 168, 155, 17, 153, 145, 158, 83, 128, 33, 8, 52, 251, 10, 152, 188, 11, 36, 153, 115, 176, 11, 147, 174, 17, 128, 170, 25, 176, 159, 17, 152, 65, 184, 9, 153, 66, 236, 112, 129, 155, 1, 202, 154, 48, 3, 113, 131, 154, 18, 219, 10, 30, 4, 44, 0, 32, 131, 173, 83, 176, 42, 35, 50, 200, 32, 250, 139, 202, 25, 36, 144, 40, 20, 201, 155, 67, 176, 174, 138, 145, 207, 41, 18, 40, 37, 128, 19, 251, 154, 169, 185, 141, 37, 160, 40, 37, 144, 9, 130, 220, 139, 168, 10, 34, 56, 103, 1, 144, 48, 208, 189, 16, 153, 0, 50, 19, 16, 160, 41, 6, 220, 56, 133, 172, 129, 41, 132, 157, 68, 160, 8, 136, 49, 249, 40, 161, 171, 253, 139, 129, 72, 38, 18, 51, 168, 187, 191, 155, 136, 32, 54, 34, 51, 34, 128, 154, 218, 171, 137, 171, 64, 70, 51, 51, 35, 200, 171, 204, 155, 128, 57, 37, 129, 160, 25, 4, 171, 1, 236, 203, 221, 138, 136, 137, 66, 19, 170, 137, 250, 188, 170, 171, 170, 138, 129, 72, 22, 0, 129, 219, 220, 186, 169, 8, 66, 34, 51, 131, 187, 9, 200, 172, 16, 17, 145, 104, 54, 50, 52, 34, 146, 137, 186, 56, 178, 112, 22, 16, 36, 34, 36, 33, 18, 221, 153, 201, 40, 33, 69, 2, 49, 161, 173, 169, 154, 138, 32, 128, 64, 37, 129, 9, 19, 255, 10, 152, 10, 18, 99, 162, 25, 132, 188, 138, 32, 19, 171, 86, 145, 24, 67, 1, 138, 99, 145, 171, 97, 19, 49, 68, 19, 128, 129, 57, 23, 25, 37, 67, 146, 157, 99, 0, 17, 8, 70, 184, 140, 16, 8, 136, 66, 37, 152, 136, 136, 185, 156, 17, 218, 138, 145, 138, 51, 129, 34, 249, 205, 203, 170, 171, 8, 33, 17, 184, 205, 171, 202, 174, 24, 0, 169, 173, 49, 216, 139, 17, 16, 250, 10, 130, 138, 34, 56, 71, 168, 137, 153, 0, 219, 104, 35, 136, 16, 33, 145, 140, 65, 52, 201, 138, 32, 242, 142, 50, 1, 144, 48, 193, 155, 204, 0, 187, 66, 205, 81, 161, 10, 17, 128, 189, 40, 249, 26, 146, 10, 68, 1, 170, 82, 232, 140, 1, 139, 18, 10, 20, 41, 149, 141, 3, 174, 0, 185, 48, 51, 34, 83, 37, 249, 12, 130, 171, 50, 8, 68, 201, 57, 20, 186, 72, 37, 185, 8, 129, 187, 64, 160, 80, 34, 2, 8, 21, 154, 168, 186, 255, 159, 136, 32, 36, 66, 69, 145, 203, 170, 201, 154, 49, 52, 52, 35, 0, 169, 203, 155, 9, 128, 137, 82, 51, 67, 68, 34, 168, 170, 236, 172, 24, 17, 33, 35, 129, 171, 139, 152, 9, 21, 251, 175, 203, 155, 24, 50, 66, 36, 152, 204, 188, 187, 156, 136, 136, 49, 18, 18, 144, 185, 236, 173, 202, 154, 128, 32, 69, 129, 128, 152, 170, 186, 155, 34, 84, 2, 9, 34, 2, 0, 53, 35, 70, 2, 8, 168, 171, 170, 113, 53, 68, 35, 18, 161, 235, 154, 24, 16, 98, 36, 18, 1, 8, 160, 138, 152, 42, 37, 64, 55, 33, 35, 200, 187, 204, 10, 50, 101, 36, 128, 0, 201, 173, 136, 17, 33, 51, 17, 161, 26, 157, 2, 33, 0, 3, 104, 164, 141, 3, 236, 9, 52, 145, 65, 36, 185, 138, 128, 0, 160, 114, 134, 137, 24, 51, 2, 32, 71, 176, 140, 144, 171, 56, 70, 129, 64, 35, 169, 8, 219, 138, 129, 169, 25, 53, 137, 85, 145, 153, 185, 138, 251, 140, 16, 137, 33, 185, 1, 204, 17, 237, 137, 1, 185, 139, 69, 208, 11, 2, 219, 138, 32, 145, 140, 53, 176, 153, 170, 0, 236, 25, 17, 17, 169, 99, 177, 140, 18, 152, 136, 169, 168, 57, 243, 61, 7, 137, 17, 0, 216, 11, 146, 155, 67, 176, 73, 132, 25, 0, 115, 208, 139, 129, 189, 9, 67, 50, 2, 137, 8, 201, 207, 25, 34, 184, 28, 39, 169, 40, 130, 0, 169, 8, 238, 40, 162, 42, 23, 136, 144, 8, 200, 88, 193, 43, 7, 153, 137, 24, 131, 156, 66, 160, 65, 192, 26, 146, 171, 128, 138, 146, 11, 19, 117, 23, 153, 136, 136, 251, 139, 35, 33, 51, 33, 51, 217, 187, 10, 145, 173, 56, 144, 26, 102, 130, 9, 2, 205, 170, 136, 40, 119, 19, 8, 18, 204, 154, 25, 34, 65, 54, 1, 136, 169, 156, 50, 1, 49, 36, 16, 169, 138, 36, 32, 69, 216, 139, 129, 140, 17, 24, 4, 203, 188, 156, 169, 138, 152, 152, 239, 156, 144, 187, 17, 128, 34, 254, 138, 201, 139, 152, 8, 2, 153, 1, 236, 154, 144, 188, 138, 152, 172, 33, 17, 54, 161, 137, 216, 174, 136, 24, 52, 129, 99, 2, 154, 48, 161, 59, 38, 128, 33, 18, 115, 130, 80, 4, 8, 18, 137, 49, 129, 42, 119, 144, 48, 17, 49, 152, 88, 162, 141, 34, 153, 49, 128, 85, 129, 33, 128, 65, 249, 10, 144, 138, 49, 55, 1, 1, 169, 186, 188, 154, 16, 50, 66, 1, 40, 225, 12, 5, 204, 56, 216, 138, 35, 49, 130, 48, 21, 218, 138, 152, 81, 21, 154, 114, 161, 139, 37, 0, 2, 9, 37, 201, 26, 0, 48, 50, 39, 128, 34, 185, 40, 233, 72, 163, 173, 34, 169, 97, 3, 33, 144, 204, 220, 154, 16, 0, 115, 131, 186, 153, 218, 173, 16, 33, 2, 152, 201, 157, 128, 219, 64, 2, 152, 188, 9, 203, 9, 67, 146, 24, 232, 172, 128, 155, 99, 130, 24, 201, 139, 176, 142, 68, 129, 25, 144, 188, 24, 168, 112, 2, 40, 178, 174, 153, 10, 52, 129, 50, 209, 171, 2, 207, 80, 130, 10, 0, 153, 170, 65, 130, 0, 8, 160, 239, 139, 50, 144, 100, 129, 136, 201, 171, 9, 128, 114, 20, 8, 168, 9, 233, 10, 17, 65, 19, 16, 4, 205, 24, 2, 9, 48, 3, 138, 177, 143, 1, 26, 39, 152, 17, 32, 128, 188, 65, 178, 223, 48, 161, 155, 67, 36, 1, 144, 204, 136, 236, 27, 37, 0, 33, 17, 18, 206, 10, 161, 10, 50, 1, 137, 8, 170, 203, 172, 202, 204, 57, 39, 34, 85, 18, 136, 218, 157, 137, 253, 49, 0, 0, 0, 99, 34, 50, 145, 155, 176, 13, 35, 32, 55, 128, 16, 136, 136, 16, 65, 20, 153, 201, 139, 130, 40, 50, 162, 191, 144, 239, 24, 168, 136, 234, 154, 169, 170, 137, 50, 200, 187, 223, 187, 219, 138, 16, 9, 2, 185, 169, 253, 139, 152, 156, 136, 155, 17, 24, 66, 2, 202, 186, 223, 10, 8, 49, 37, 17, 33, 153, 25, 176, 74, 6, 137, 67, 2, 48, 70, 1, 65, 130, 40, 160, 80, 177, 57, 39, 34, 51, 34, 50, 18, 184, 28, 133, 141, 68, 0, 67, 0, 67, 177, 57, 163, 159, 8, 170, 56, 19, 116, 5, 9, 146, 173, 168, 171, 65, 1, 49, 2, 139, 184, 26, 146, 57, 226, 138, 221, 32, 160, 115, 6, 0, 1, 153, 152, 154, 100, 130, 64, 131, 11, 21, 187, 86, 129, 40, 145, 138, 184, 44, 38, 32, 38, 137, 0, 203, 9, 136, 25, 115, 18, 169, 10, 146, 190, 40, 128, 136, 203, 139, 136, 155, 161, 30, 55, 222, 137, 152, 153, 16, 17, 33, 217, 187, 204, 25, 201, 56, 23, 153, 136, 187, 8, 186, 82, 160, 114, 162, 172, 16, 168, 32, 3, 98, 178, 158, 18, 168, 24, 17, 114, 162, 12, 1, 8, 146, 139, 36, 184, 171, 64, 131, 11, 103, 161, 155, 24, 202, 170, 42, 55, 153, 34, 202, 154, 171, 152, 139, 83, 176, 57, 243, 159, 17, 8, 128, 16, 192, 10, 177, 173, 203, 114, 132, 11, 20, 153, 8, 155, 2, 188, 100, 145, 40, 161, 97, 177, 141, 52, 161, 170, 82, 145, 9, 145, 113, 194, 28, 21, 139, 2, 139, 68, 217, 25, 2, 153, 8, 56, 5, 138, 20, 185, 169, 157, 34, 187, 117, 128, 32, 161, 25, 201, 138, 160, 10, 20, 41, 37, 145, 253, 154, 201, 42, 23, 16, 36, 1, 201, 173, 152, 136, 33, 99, 51, 0, 137, 170, 153, 188, 88, 36, 1, 32, 33, 145, 8, 18, 186, 113, 161, 156, 18, 33, 66, 144, 139, 17, 152, 168, 12, 149, 255, 13, 176, 140, 50, 129, 65, 161, 204, 171, 204, 171, 40, 1, 16, 36, 200, 155, 185, 191, 155, 152, 170, 40, 1, 66, 4, 144, 220, 170, 251, 10, 128, 25, 67, 18, 129, 32, 147, 141, 161, 189, 153, 40, 37, 50, 69, 18, 34, 129, 170, 144, 203, 10, 128, 114, 69, 67, 36, 1, 128, 186, 187, 139, 153, 115, 23, 48, 35, 16, 1, 128, 217, 172, 152, 203, 113, 36, 34, 50, 2, 220, 154, 203, 25, 18, 82, 35, 8, 152, 41, 147, 175, 16, 144, 202, 140, 50, 0, 70, 18, 34, 234, 138, 152, 169, 139, 87, 1, 136, 0, 33, 144, 40, 5, 171, 129, 207, 32, 129, 115, 18, 17, 160, 10, 250, 139, 1, 16, 37, 17, 129, 0, 201, 11, 161, 157, 65, 162, 157, 33, 130, 170, 65, 249, 10, 193, 140, 1, 154, 67, 145, 201, 155, 176, 191, 9, 50, 144, 191, 3, 35, 0, 10, 8, 200, 239, 25, 2, 171, 80, 146, 188, 8, 169, 33, 137, 52, 187, 17, 222, 8, 128, 136, 32, 0, 17, 16, 195, 143, 20, 220, 40, 2, 153, 49, 17, 69, 176, 24, 184, 169, 220, 97, 4, 136, 82, 145, 170, 8, 185, 138, 115, 2, 25, 36, 169, 40, 216, 10, 146, 57, 210, 91, 7, 138, 18, 0, 130, 172, 129, 189, 16, 184, 88, 53, 160, 105, 131, 173, 8, 16, 185, 156, 67, 176, 43, 37, 65, 177, 42, 133, 191, 138, 128, 8, 67, 52, 129, 24, 249, 155, 168, 139, 66, 128, 72, 37, 144, 9, 16, 177, 255, 137, 1, 136, 41, 53, 129, 137, 160, 188, 188, 189, 9, 16, 8, 81, 36, 51, 2, 218, 203, 188, 171, 26, 100, 50, 66, 18, 129, 219, 138, 0, 169, 64, 36, 32, 53, 0, 50, 18, 8, 184, 157, 9, 16, 18, 117, 21, 128, 16, 2, 203, 9, 184, 174, 153, 153, 65, 20, 48, 23, 202, 155, 218, 172, 137, 16, 128, 48, 20, 202, 154, 203, 204, 171, 154, 154, 24, 1, 80, 4, 186, 153, 253, 187, 8, 153, 24, 51, 2, 17, 9, 50, 249, 157, 0, 187, 171, 64, 54, 129, 99, 3, 40, 3, 202, 171, 169, 157, 65, 53, 67, 99, 19, 152, 136, 186, 138, 168, 57, 103, 17, 50, 35, 128, 137, 51, 249, 140, 146, 170, 115, 19, 50, 20, 168, 137, 202, 189, 24, 19, 25, 70, 161, 42, 35, 218, 138, 18, 236, 25, 130, 155, 65, 35, 35, 129, 204, 24, 178, 189, 57, 39, 216, 56, 21, 153, 48, 4, 168, 24, 184, 175, 33, 2, 97, 37, 152, 136, 160, 154, 64, 145, 72, 5, 185, 10, 82, 145, 41, 20, 153, 152, 8, 251, 26, 129, 48, 146, 43, 146, 175, 136, 168, 222, 155, 128, 187, 24, 36, 1, 220, 156, 169, 205, 154, 16, 0, 144, 137, 184, 223, 8, 185, 25, 130, 136, 185, 203, 204, 56, 162, 44, 39, 170, 40, 162, 155, 136, 154, 50, 49, 55, 67, 71, 145, 26, 176, 158, 144, 57, 55, 0, 84, 145, 136, 184, 171, 0, 153, 114, 36, 128, 32, 19, 217, 170, 154, 136, 81, 4, 8, 4, 155, 34, 206, 24, 200, 41, 129, 8, 146, 138, 50, 249, 158, 34, 249, 10, 18, 169, 25, 68, 161, 154, 8, 152, 223, 9, 34, 129, 140, 86, 130, 187, 40, 200, 156, 1, 24, 18, 0, 20, 236, 26, 144, 25, 19, 64, 38, 185, 27, 129, 187, 98, 51, 36, 168, 97, 161, 138, 35, 33, 36, 8, 51, 17, 71, 145, 57, 20, 137, 145, 173, 115, 2, 16, 34, 153, 169, 186, 171, 138, 32, 55, 233, 10, 193, 158, 1, 218, 8, 176, 156, 153, 170, 187, 173, 186, 188, 171, 170, 137, 234, 205, 170, 204, 172, 25, 128, 32, 18, 152, 220, 173, 187, 155, 9, 82, 34, 49, 19, 203, 169, 204, 170, 171, 115, 2, 98, 19, 0, 128, 253, 240, 35, 0, 128, 202, 138, 68, 144, 115, 2, 33, 3, 32, 2, 9, 35, 128, 114, 19, 56, 87, 136, 40, 18, 24, 33, 82, 3, 137, 152, 171, 98, 51, 54, 68, 146, 156, 145, 159, 0, 24, 20, 136, 51, 144, 137, 24, 216, 139, 249, 27, 4, 40, 39, 129, 152, 138, 144, 173, 81, 130, 88, 4, 170, 32, 161, 11, 55, 0, 16, 153, 0, 204, 97, 18, 49, 146, 41, 224, 26, 1, 51, 18, 192, 12, 161, 44, 55, 17, 34, 169, 217, 207, 8, 128, 83, 2, 32, 200, 156, 184, 172, 32, 1, 49, 145, 188, 153, 204, 56, 194, 140, 144, 157, 137, 154, 34, 144, 152, 251, 188, 138, 0, 25, 55, 184, 25, 249, 140, 1, 153, 83, 128, 17, 234, 25, 160, 25, 69, 2, 9, 146, 175, 8, 170, 98, 130, 83, 130, 8, 176, 173, 8, 136, 49, 54, 19, 50, 192, 27, 193, 28, 148, 43, 23, 154, 51, 168, 33, 168, 80, 232, 155, 2, 9, 144, 72, 21, 154, 153, 203, 157, 17, 186, 81, 145, 9, 201, 140, 17, 185, 42, 164, 255, 8, 170, 40, 129, 16, 35, 234, 187, 206, 153, 203, 40, 148, 10, 19, 205, 8, 160, 25, 20, 154, 17, 236, 24, 129, 56, 36, 33, 1, 8, 1, 203, 114, 131, 26, 55, 145, 64, 19, 136, 67, 19, 168, 139, 82, 147, 73, 87, 129, 17, 145, 153, 144, 186, 49, 2, 64, 38, 129, 184, 174, 1, 218, 42, 147, 174, 8, 219, 24, 184, 58, 179, 159, 184, 191, 128, 186, 57, 145, 10, 162, 175, 128, 187, 24, 249, 139, 160, 10, 51, 129, 100, 146, 171, 168, 190, 155, 24, 85, 1, 97, 2, 171, 34, 251, 40, 131, 11, 51, 152, 99, 18, 67, 145, 10, 144, 155, 8, 114, 23, 0, 49, 129, 137, 152, 56, 4, 41, 39, 169, 24, 128, 98, 19, 0, 35, 176, 223, 138, 168, 11, 70, 1, 33, 161, 202, 204, 138, 152, 24, 53, 18, 33, 218, 25, 192, 25, 202, 112, 132, 153, 67, 145, 33, 200, 113, 194, 139, 51, 168, 48, 4, 48, 148, 12, 130, 41, 133, 154, 99, 129, 138, 17, 185, 24, 51, 23, 170, 115, 184, 9, 169, 98, 168, 88, 178, 155, 161, 139, 144, 43, 39, 25, 194, 223, 16, 168, 0, 17, 1, 8, 185, 189, 186, 56, 132, 157, 68, 200, 9, 161, 26, 184, 75, 133, 171, 219, 42, 195, 158, 34, 129, 185, 158, 128, 203, 154, 136, 129, 154, 19, 222, 8, 201, 48, 248, 26, 130, 174, 17, 9, 35, 153, 67, 217, 155, 153, 24, 18, 114, 37, 137, 1, 171, 48, 17, 2, 65, 21, 136, 49, 4, 97, 53, 176, 56, 5, 138, 17, 50, 131, 139, 102, 34, 33, 34, 37, 250, 156, 137, 17, 17, 116, 4, 136, 153, 202, 171, 136, 66, 18, 50, 2, 153, 251, 155, 128, 186, 25, 145, 56, 176, 115, 7, 203, 0, 233, 156, 17, 128, 80, 34, 0, 46, 0, 2, 152, 0, 171, 138, 32, 176, 14, 37, 218, 24, 18, 0, 40, 71, 184, 24, 216, 139, 0, 9, 82, 52, 129, 48, 195, 174, 153, 153, 170, 105, 36, 24, 53, 0, 168, 188, 202, 172, 9, 48, 54, 3, 0, 1, 251, 172, 153, 137, 153, 40, 51, 17, 33, 18, 184, 156, 238, 11, 161, 13, 67, 1, 82, 18, 145, 10, 20, 235, 40, 2, 9, 83, 36, 17, 51, 1, 18, 8, 144, 11, 52, 0, 113, 55, 0, 51, 128, 129, 173, 128, 204, 8, 169, 83, 160, 65, 177, 138, 252, 154, 168, 189, 137, 152, 136, 136, 146, 190, 170, 223, 137, 186, 26, 177, 140, 129, 139, 201, 173, 136, 204, 9, 184, 141, 128, 188, 48, 160, 27, 51, 232, 157, 128, 171, 136, 24, 162, 121, 20, 26, 37, 168, 64, 200, 10, 17, 48, 36, 82, 38, 129, 33, 128, 48, 232, 73, 21, 136, 83, 18, 136, 49, 3, 153, 64, 131, 42, 54, 0, 82, 50, 34, 17, 16, 3, 173, 168, 157, 71, 128, 81, 19, 154, 1, 219, 48, 201, 64, 130, 40, 132, 138, 37, 217, 48, 162, 138, 130, 188, 41, 54, 129, 48, 21, 202, 25, 217, 26, 3, 10, 19, 172, 115, 130, 138, 34, 200, 173, 136, 184, 43, 5, 41, 39, 171, 83, 216, 11, 144, 139, 18, 187, 115, 160, 58, 22, 169, 138, 33, 249, 140, 50, 169, 25, 20, 129, 128, 136, 128, 217, 219, 138, 34, 235, 80, 21, 170, 32, 128, 184, 220, 138, 50, 200, 26, 37, 177, 172, 50, 192, 140, 128, 137, 160, 189, 32, 161, 157, 83, 144, 171, 24, 178, 207, 9, 169, 16, 144, 64, 129, 56, 193, 191, 0, 201, 10, 34, 144, 33, 83, 18, 33, 3, 9, 193, 255, 24, 51, 161, 80, 22, 154, 33, 161, 57, 23, 169, 24, 161, 171, 82, 52, 35, 99, 18, 169, 219, 173, 48, 129, 40, 68, 35, 217, 88, 131, 173, 24, 186, 138, 128, 137, 114, 21, 169, 49, 209, 173, 8, 168, 155, 98, 18, 8, 160, 156, 35, 251, 11, 35, 237, 41, 130, 11, 36, 185, 16, 184, 171, 40, 194, 158, 52, 218, 57, 4, 138, 34, 160, 219, 156, 33, 144, 113, 2, 56, 162, 174, 24, 168, 140, 67, 145, 72, 37, 168, 40, 177, 255, 153, 168, 10, 53, 18, 83, 2, 202, 187, 171, 171, 64, 52, 51, 53, 152, 32, 145, 188, 9, 145, 138, 67, 83, 69, 51, 17, 0, 145, 219, 139, 49, 18, 100, 3, 136, 66, 128, 25, 68, 129, 204, 154, 235, 155, 49, 51, 83, 51, 216, 172, 202, 189, 9, 160, 9, 34, 128, 137, 32, 224, 190, 153, 236, 170, 128, 128, 32, 19, 1, 185, 251, 172, 185, 157, 33, 177, 10, 35, 185, 48, 37, 152, 154, 218, 190, 154, 137, 48, 69, 17, 51, 129, 48, 200, 154, 252, 140, 32, 128, 83, 53, 50, 2, 136, 168, 188, 156, 48, 34, 65, 70, 245, 248, 41, 0, 19, 49, 53, 136, 8, 185, 174, 155, 49, 52, 101, 35, 16, 144, 203, 137, 186, 56, 130, 90, 38, 153, 66, 3, 8, 168, 171, 236, 139, 130, 72, 39, 128, 24, 18, 220, 24, 129, 137, 16, 201, 41, 130, 112, 37, 0, 34, 217, 155, 185, 139, 136, 112, 55, 0, 32, 2, 203, 155, 137, 186, 43, 37, 49, 55, 129, 32, 178, 191, 9, 201, 10, 51, 136, 67, 145, 0, 160, 174, 9, 202, 156, 25, 128, 204, 88, 131, 156, 66, 176, 172, 137, 202, 155, 24, 130, 73, 53, 185, 9, 184, 153, 251, 158, 17, 161, 40, 53, 130, 153, 49, 225, 156, 129, 171, 115, 145, 40, 19, 152, 40, 35, 218, 64, 163, 159, 49, 184, 12, 115, 18, 128, 65, 176, 189, 153, 155, 65, 35, 83, 3, 220, 9, 1, 170, 24, 67, 250, 13, 33, 185, 64, 20, 152, 8, 217, 172, 9, 136, 72, 52, 185, 26, 162, 159, 49, 144, 138, 128, 236, 155, 64, 36, 0, 34, 177, 190, 136, 201, 26, 34, 0, 16, 136, 33, 1, 84, 35, 250, 173, 9, 128, 136, 81, 38, 176, 155, 49, 178, 191, 33, 3, 203, 10, 1, 169, 154, 152, 170, 155, 233, 58, 23, 170, 34, 217, 25, 130, 186, 114, 39, 169, 16, 17, 128, 137, 85, 18, 34, 144, 81, 18, 32, 1, 115, 6, 9, 65, 2, 136, 67, 129, 80, 3, 139, 68, 146, 9, 50, 0, 169, 155, 1, 96, 39, 169, 32, 208, 172, 170, 10, 160, 11, 5, 172, 153, 238, 10, 144, 187, 72, 232, 155, 152, 187, 169, 8, 144, 171, 218, 173, 251, 171, 136, 137, 170, 48, 132, 203, 10, 192, 190, 169, 170, 169, 139, 87, 129, 24, 147, 188, 170, 205, 32, 129, 81, 20, 0, 129, 136, 137, 153, 65, 4, 32, 3, 114, 6, 25, 68, 160, 48, 131, 156, 49, 1, 81, 51, 65, 67, 17, 0, 0, 17, 152, 99, 145, 112, 37, 1, 33, 1, 154, 17, 234, 25, 1, 48, 85, 67, 1, 152, 218, 171, 153, 41, 115, 52, 160, 9, 217, 156, 128, 49, 20, 184, 26, 248, 174, 65, 144, 48, 4, 188, 152, 186, 40, 20, 8, 49, 208, 188, 170, 8, 17, 35, 1, 87, 224, 11, 1, 171, 65, 129, 32, 162, 27, 132, 157, 67, 216, 57, 132, 155, 67, 1, 33, 168, 137, 235, 139, 34, 49, 39, 1, 19, 169, 220, 172, 1, 170, 115, 145, 136, 136, 160, 189, 25, 0, 136, 16, 208, 158, 160, 158, 34, 170, 36, 184, 153, 205, 137, 169, 11, 18, 57, 119, 184, 41, 178, 157, 129, 152, 16, 32, 69, 130, 24, 130, 187, 236, 138, 129, 97, 36, 35, 19, 184, 175, 152, 138, 68, 33, 83, 18, 128, 219, 154, 153, 48, 38, 50, 3, 8, 161, 190, 152, 9, 49, 2, 217, 10, 131, 121, 4, 138, 130, 205, 153, 154, 18, 186, 97, 162, 188, 153, 153, 9, 84, 176, 88, 193, 40, 2, 35, 0, 173, 16, 144, 16, 17, 52, 249, 141, 152, 9, 49, 34, 65, 5, 235, 137, 218, 10, 128, 80, 35, 48, 147, 188, 186, 188, 169, 72, 36, 56, 3, 10, 179, 175, 18, 189, 2, 206, 33, 176, 57, 130, 25, 248, 156, 144, 137, 16, 66, 20, 152, 136, 202, 173, 65, 145, 97, 131, 24, 145, 10, 36, 17, 33, 52, 177, 88, 131, 113, 35, 49, 38, 152, 0, 169, 65, 130, 113, 22, 137, 18, 218, 24, 145, 40, 35, 168, 16, 251, 10, 145, 8, 19, 203, 168, 223, 9, 201, 41, 147, 174, 17, 202, 154, 136, 185, 141, 168, 172, 203, 10, 131, 173, 34, 234, 154, 219, 138, 170, 72, 130, 32, 248, 138, 168, 170, 137, 52, 192, 25, 2, 189, 25, 128, 115, 161, 72, 147, 12, 3, 175, 32, 152, 113, 18, 32, 19, 171, 130, 158, 49, 137, 68, 18, 50, 35, 144, 32, 20, 66, 35, 48, 194, 142, 53, 1, 114, 20, 152, 34, 249, 26, 2, 154, 83, 128, 49, 128, 82, 145, 9, 129, 153, 237, 9, 51, 34, 100, 35, 168, 203, 172, 128, 9, 86, 18, 32, 160, 136, 235, 10, 17, 99, 2, 16, 144, 173, 9, 16, 51, 18, 35, 251, 156, 136, 9, 83, 19, 33, 209, 172, 185, 154, 153, 112, 21, 152, 9, 144, 154, 138, 115, 147, 172, 9, 217, 139, 67, 33, 19, 169, 202, 175, 137, 153, 80, 35, 16, 128, 222, 170, 136, 137, 17, 84, 2, 136, 200, 139, 202, 57, 132, 25, 36, 9, 144, 158, 16, 24, 20, 189, 50, 208, 25, 1, 17, 17, 3, 235, 186, 12, 38, 186, 98, 145, 138, 169, 25, 217, 89, 37, 0, 129, 9, 192, 207, 16, 0, 17, 0, 18, 218, 9, 144, 137, 8, 84, 193, 157, 144, 138, 1, 41, 103, 184, 40, 184, 139, 128, 56, 21, 169, 138, 144, 137, 114, 22, 128, 168, 204, 170, 25, 49, 68, 35, 0, 145, 205, 172, 9, 161, 42, 71, 152, 16, 136, 1, 222, 25, 1, 8, 1, 66, 145, 140, 144, 170, 218, 42, 22, 152, 49, 4, 185, 9, 1, 234, 171, 144, 24, 68, 98, 37, 160, 152, 236, 154, 152, 81, 36, 1, 0, 160, 204, 138, 128, 24, 36, 17, 17, 137, 128, 169, 169, 8, 250, 155, 1, 138, 115, 50, 35, 200, 190, 138, 201, 140, 53, 144, 32, 232, 26, 160, 27, 36, 186, 155, 17, 221, 57, 35, 33, 152, 17, 251, 142, 0, 50, 66, 53, 146, 32, 209, 139, 51, 144, 98, 52, 18, 1, 17, 1, 8, 51, 49, 38, 168, 82, 1, 33, 202, 116, 1, 32, 217, 138, 200, 140, 144, 12, 83, 144, 10, 0, 219, 219, 171, 184, 175, 16, 0, 128, 137, 128, 238, 156, 169, 137, 33, 136, 0, 184, 207, 154, 186, 140, 67, 2, 137, 153, 219, 172, 170, 8, 51, 52, 131, 219, 170, 186, 170, 64, 20, 81, 5, 187, 67, 192, 57, 18, 152, 72, 44, 246, 27, 0, 54, 152, 32, 66, 35, 219, 80, 131, 25, 54, 129, 17, 144, 81, 131, 171, 114, 21, 185, 65, 3, 137, 0, 17, 129, 80, 21, 153, 0, 33, 4, 138, 50, 49, 23, 138, 84, 160, 138, 19, 168, 80, 21, 9, 18, 201, 8, 169, 89, 21, 152, 34, 217, 137, 136, 144, 40, 38, 56, 23, 202, 9, 152, 16, 153, 103, 145, 0, 128, 185, 203, 25, 51, 35, 51, 66, 178, 255, 9, 8, 128, 32, 37, 176, 157, 16, 169, 48, 21, 152, 202, 172, 16, 144, 113, 20, 136, 153, 189, 154, 8, 96, 36, 185, 137, 216, 174, 9, 50, 51, 52, 160, 204, 188, 172, 0, 0, 82, 36, 145, 154, 137, 235, 155, 34, 129, 32, 19, 187, 25, 136, 97, 52, 201, 27, 179, 255, 24, 0, 137, 65, 20, 0, 17, 168, 202, 204, 169, 8, 66, 67, 54, 18, 152, 152, 220, 186, 9, 51, 84, 50, 17, 128, 186, 206, 137, 136, 67, 52, 35, 169, 138, 236, 171, 64, 35, 32, 34, 201, 139, 169, 156, 33, 50, 38, 152, 138, 128, 153, 235, 138, 145, 172, 65, 54, 208, 42, 161, 175, 136, 49, 67, 35, 161, 189, 237, 140, 8, 0, 52, 67, 18, 218, 170, 219, 154, 8, 32, 51, 18, 66, 130, 187, 187, 205, 190, 171, 25, 67, 67, 67, 2, 186, 173, 189, 154, 152, 16, 36, 16, 66, 36, 201, 10, 216, 188, 154, 9, 66, 83, 99, 2, 152, 152, 203, 187, 42, 53, 18, 68, 0, 24, 184, 10, 129, 153, 32, 39, 152, 56, 20, 0, 0, 32, 184, 10, 192, 155, 1, 113, 132, 139, 53, 152, 186, 10, 184, 223, 171, 32, 137, 69, 1, 51, 224, 188, 24, 192, 157, 49, 160, 26, 37, 168, 81, 146, 8, 248, 157, 0, 170, 80, 19, 32, 20, 169, 24, 249, 155, 16, 154, 32, 18, 84, 35, 18, 185, 236, 172, 137, 154, 66, 20, 33, 145, 187, 187, 172, 24, 34, 24, 69, 192, 173, 186, 155, 115, 34, 67, 19, 185, 187, 221, 154, 0, 65, 54, 17, 0, 18, 192, 189, 156, 153, 24, 82, 54, 2, 16, 176, 188, 185, 204, 41, 52, 17, 66, 2, 128, 185, 156, 0, 184, 96, 21, 169, 24, 129, 155, 64, 51, 3, 42, 71, 176, 204, 172, 8, 17, 66, 37, 1, 49, 192, 188, 137, 152, 138, 82, 129, 32, 53, 51, 53, 161, 154, 251, 141, 16, 0, 66, 2, 128, 128, 185, 42, 87, 130, 0, 200, 189, 9, 8, 66, 36, 144, 32, 233, 140, 16, 17, 128, 152, 137, 24, 99, 68, 19, 160, 204, 204, 187, 56, 37, 51, 51, 35, 177, 223, 153, 144, 185, 10, 51, 34, 67, 51, 20, 1, 251, 174, 170, 153, 32, 20, 33, 38, 0, 128, 184, 172, 171, 189, 171, 9, 67, 68, 36, 50, 2, 169, 222, 172, 153, 153, 32, 66, 52, 18, 49, 145, 204, 171, 206, 154, 33, 35, 65, 52, 2, 169, 219, 18, 2, 31, 0, 155, 168, 155, 49, 194, 157, 49, 35, 52, 36, 145, 202, 239, 139, 16, 137, 82, 1, 16, 184, 175, 16, 0, 48, 2, 203, 171, 170, 156, 17, 85, 3, 171, 9, 202, 138, 65, 34, 129, 154, 129, 239, 26, 50, 19, 200, 10, 130, 170, 81, 99, 19, 169, 219, 174, 24, 17, 82, 34, 1, 169, 170, 206, 10, 50, 52, 19, 185, 202, 206, 25, 34, 49, 35, 200, 188, 172, 153, 48, 36, 17, 33, 99, 20, 152, 1, 251, 191, 153, 32, 66, 83, 19, 128, 187, 189, 203, 154, 66, 36, 16, 35, 184, 154, 168, 10, 33, 144, 171, 169, 156, 0, 25, 1, 66, 54, 71, 36, 34, 146, 206, 204, 172, 25, 34, 54, 52, 17, 176, 204, 187, 187, 137, 66, 52, 36, 129, 0, 161, 207, 153, 169, 137, 1, 50, 53, 1, 128, 202, 173, 155, 9, 33, 36, 16, 160, 190, 136, 168, 72, 53, 19, 128, 218, 188, 169, 186, 41, 68, 83, 50, 50, 19, 168, 188, 187, 204, 171, 98, 35, 98, 35, 0, 144, 172, 8, 187, 32, 19, 83, 52, 51, 1, 48, 3, 221, 24, 200, 158, 32, 144, 41, 130, 72, 163, 141, 3, 235, 139, 168, 188, 168, 139, 70, 1, 66, 160, 10, 249, 157, 136, 137, 17, 32, 53, 34, 35, 49, 1, 201, 206, 187, 186, 9, 68, 67, 67, 68, 36, 145, 0, 200, 188, 188, 137, 9, 98, 68, 20, 18, 128, 153, 203, 203, 154, 50, 33, 83, 35, 18, 32, 2, 25, 37, 217, 219, 188, 40, 176, 57, 71, 18, 2, 168, 154, 201, 221, 137, 144, 137, 50, 37, 0, 40, 2, 168, 255, 155, 168, 153, 48, 52, 51, 2, 168, 235, 172, 138, 169, 9, 52, 130, 169, 8, 18, 152, 115, 22, 129, 48, 176, 157, 128, 24, 38, 168, 138, 97, 51, 18, 136, 153, 223, 187, 138, 33, 52, 70, 35, 17, 201, 172, 171, 188, 138, 32, 68, 19, 129, 136, 202, 156, 154, 186, 186, 138, 80, 54, 18, 130, 235, 154, 187, 172, 25, 68, 18, 1, 169, 171, 171, 115, 19, 32, 36, 17, 128, 219, 170, 24, 53, 69, 19, 50, 147, 173, 32, 0, 67, 145, 56, 37, 129, 204, 25, 193, 139, 68, 3, 154, 128, 205, 137, 206, 138, 184, 173, 137, 32, 52, 51, 2, 184, 207, 172, 170, 8, 128, 8, 0, 65, 35, 49, 129, 153, 170, 223, 188, 153, 9, 102, 19, 16, 144, 190, 137, 153, 24, 49, 52, 2, 17, 33, 128, 169, 169, 236, 173, 65, 67, 34, 35, 136, 32, 217, 154, 18, 50, 34, 100, 129, 41, 208, 11, 177, 158, 152, 154, 136, 202, 64, 21, 128, 24, 50, 33, 100, 130, 202, 9, 161, 156, 35, 236, 24, 168, 65, 18, 99, 177, 173, 8, 184, 156, 65, 36, 128, 0, 145, 205, 187, 171, 24, 0, 84, 21, 176, 202, 154, 137, 8, 51, 146, 96, 37, 128, 217, 171, 169, 154, 66, 67, 161, 255, 12, 0, 34, 67, 2, 168, 187, 64, 161, 58, 52, 83, 18, 98, 160, 154, 234, 26, 161, 155, 162, 12, 71, 34, 18, 145, 190, 155, 154, 33, 18, 84, 18, 1, 154, 168, 191, 137, 169, 65, 51, 38, 1, 169, 186, 172, 8, 0, 34, 4, 152, 50, 161, 11, 160, 155, 16, 153, 0, 17, 17, 33, 145, 153, 0, 155, 153, 144, 25, 17, 16, 17, 145, 153, 9, 9, 0, 9, 17, 0, 0, 0, 0, 9, 0, 9, 17, 0, 0, 0, 0, 144, 25, 17, 144, 17, 144, 9, 0, 9, 1, 0, 0, 17, 153, 16, 144, 16, 9, 0, 0, 0, 0, 16, 144, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 9, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 9, 16, 0, 0, 144, 0, 0, 0, 0, 0, 1, 9, 0, 0, 0, 16, 0, 9, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
-static const size_t audio_forty_sample_data_length = sizeof(audio_forty_sample_data) / sizeof(audio_forty_sample_data[0]);
+static const size_t audio_forty_sample_data_length = 27780;
@@ -1,4 +1,4 @@
-// This file was generated by a script on 20-11-2024 08:37:38
+// This file was generated by a script on 17-10-2026 14:18:55
 
 #pragma once
 
@@ -6,6 +6,7 @@
 #include <stdint.h>
 #include <pico/platform/sections.h>
 
-static const int16_t __in_flash("audio_gps_signal_sample_data") audio_gps_signal_sample_data[] = { 0, -7, -16, -13, -1, 4, 0, -4, -1, 3, 2, -1, -1, -1, -3, -3, 0, 0, -1, -3, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 2, 2, 0, 0, 0, 0, 2, 3, 6, 8, 10, 8, 8, 10, 10, 11, 11, 12, 12, 10, 8, 10, 11, 11, 10, 10, 10, 10, 11, 11, 10, 10, 10, 11, 11, 10, 6, 3, 3, 6, 6, 4, 3, 0, -1, 0, 3, 6, 4, 2, 0, 0, 0, 0, 3, 4, 4, 4, 6, 6, 3, 2, 2, 2, -1, -5, -4, 0, 0, -1, -3, 0, 3, 2, 0, 0, -3, -7, -8, -5, -3, -4, -7, -3, 3, 3, -3, -7, -4, 0, 0, -5, -8, -7, -1, 2, 2, -1, -4, -3, -3, -8, -11, -9, -7, -5, -4, -1, -1, -4, -3, 2, 3, 0, -3, -3, -1, -3, -4, -4, -4, -5, -7, -7, -5, -4, -1, 4, 10, 7, 0, 0, 6, 8, 3, -3, -3, -1, -1, 0, 3, 4, 2, 3, 7, 4, 0, -1, 3, 8, 10, 7, 7, 7, 4, 0, -7, -9, -5, 0, 0, 0, -1, -4, -4, -4, -4, -5, -5, -7, -12, -16, -14, -9, -7, -8, -11, -9, -11, -13, -16, -16, -14, -17, -21, -22, -21, -14, -9, -8, -7, -4, -3, -4, -5, -8, -8, -7, -4, -5, -11, -12, -7, -4, -8, -12, -9, -3, 2, 2, 0, -3, -4, -1, 0, -3, -11, -14, -11, -1, 4, 4, 0, -3, 0, 2, -1, -9, -13, -8, -4, -3, -1, 6, 13, 13, 6, 0, 2, 8, 13, 16, 17, 16, 12, 11, 13, 12, 4, -1, 0, 8, 13, 13, 16, 19, 16, 8, 3, 3, 0, -7, -14, -17, -14, -9, 0, 11, 15, 13, 13, 15, 12, 4, -1, -7, -13, -16, -11, 0, 7, 8, 6, 3, 0, -5, -9, -11, -7, -4, -4, -4, -4, -5, -9, -12, -12, -11, -13, -16, -20, -21, -22, -21, -17, -13, -12, -11, -7, 0, 4, 3, -3, -9, -13, -13, -13, -18, -25, -29, -26, -20, -9, 0, 3, 2, 0, -3, -4, -5, -5, -5, -9, -14, -16, -14, -14, -14, -13, -12, -17, -26, -29, -26, -24, -24, -22, -14, -3, 2, -3, -12, -24, -37, -49, -53, -45, -29, -17, -17, -18, -12, -4, -7, -20, -29, -32, -33, -37, -36, -30, -29, -29, -28, -25, -22, -20, -16, -16, -18, -18, -17, -18, -20, -14, -7, -8, -14, -17, -13, -11, -8, -3, 4, 8, 6, 0, -4, -12, -14, -7, 3, 8, 10, 15, 23, 27, 28, 28, 28, 29, 36, 37, 25, 11, 13, 31, 41, 37, 29, 21, 13, 6, 3, 2, -4, -13, -16, -9, -3, 0, 2, 7, 12, 15, 16, 21, 25, 25, 21, 19, 15, 6, -3, -9, -14, -24, -29, -22, -5, 11, 20, 28, 35, 32, 19, 6, 2, -1, -14, -33, -41, -30, -13, -1, 3, 3, 3, 6, 4, -3, -13, -16, -9, 0, 2, -3, -14, -25, -30, -29, -29, -38, -57, -67, -57, -30, -8, -1, -5, -8, -7, -11, -33, -68, -97, -112, -113, -100, -70, -36, -16, -7, 7, 17, 4, -30, -65, -84, -91, -88, -79, -70, -53, -22, 7, 23, 21, 13, -9, -47, -72, -65, -42, -33, -36, -26, -5, 12, 15, 8, -5, -32, -68, -96, -87, -40, 16, 54, 64, 52, 36, 21, -1, -37, -76, -96, -82, -33, 29, 74, 86, 79, 73, 54, 11, -50, -96, -100, -61, -1, 57, 103, 140, 160, 147, 93, 12, -68, -138, -187, -196, -153, -59, 58, 170, 251, 276, 232, 136, 28, -59, -116, -141, -137, -112, -66, 2, 74, 120, 131, 118, 89, 42, -8, -47, -72, -95, -107, -83, -29, 25, 66, 103, 132, 129, 85, 32, -1, -28, -61, -82, -86, -96, -116, -108, -58, 0, 36, 46, 42, 31, 19, 6, -14, -45, -68, -74, -68, -63, -53, -30, -11, -12, -13, 11, 53, 70, 48, 10, -25, -63, -101, -117, -111, -101, -100, -101, -96, -94, -100, -119, -144, -163, -159, -116, -46, 10, 21, 0, -24, -42, -83, -174, -296, -381, -348, -166, 112, 373, 519, 550, 529, 486, 374, 133, -190, -358, -21, 983, 2388, 3683, 4487, 4609, 3903, 2403, 536, -1122, -2295, -2949, -3002, -2341, -1097, 348, 1593, 2303, 2230, 1354, 6, -1274, -2079, -2313, -2088, -1552, -875, -238, 204, 384, 262, -108, -564, -908, -1046, -980, -715, -288, 133, 336, 247, -9, -281, -539, -792, -950, -883, -599, -266, -32, 87, 140, 128, 41, -74, -138, -119, -14, 125, 197, 136, 23, -46, -112, -196, -165, 40, 281, 504, 837, 1162, 996, 125, -958, -1485, -1059, 255, 2186, 4352, 6261, 7399, 7391, 6074, 3542, 202, -3255, -6034, -7427, -6935, -4500, -771, 2986, 5525, 6255, 5330, 3275, 694, -1814, -3779, -4966, -5206, -4210, -1955, 774, 2778, 3541, 3417, 2752, 1466, -324, -1997, -2893, -2777, -1864, -701, 161, 600, 792, 701, 131, -714, -1308, -1427, -1236, -871, -349, 207, 601, 722, 539, 79, -497, -989, -1344, -1596, -1672, -1428, -922, -444, -234, -283, -437, -623, -844, -1070, -1229, -1254, -1070, -684, -311, -208, -337, -473, -587, -829, -1135, -1224, -988, -609, -233, 168, 534, 598, 268, -151, -349, -402, -483, -472, -178, 212, 365, 257, 123, 65, 7, -80, -123, -68, 49, 190, 345, 497, 571, 467, 170, -180, -360, -237, 79, 388, 640, 920, 1145, 1070, 677, 315, 251, 305, 144, -212, -436, -350, -108, 110, 301, 472, 534, 468, 436, 527, 581, 426, 158, 12, -4, -100, -323, -470, -391, -170, 67, 294, 461, 465, 269, -45, -342, -485, -462, -440, -466, -304, 141, 506, 468, 252, 177, 122, -100, -281, -162, 133, 348, 397, 272, 0, -250, -299, -169, 49, 381, 804, 1090, 1011, 550, -137, -831, -1328, -1545, -1537, -1308, -776, 21, 803, 1213, 1050, 347, -587, -1288, -1488, -1309, -1002, -651, -225, 218, 561, 712, 619, 319, -21, -241, -356, -458, -491, -288, 98, 340, 232, -30, -140, -116, -227, -497, -632, -448, -138, 15, 28, 119, 339, 482, 382, 112, -128, -219, -175, -90, -28, 24, 67, 8, -216, -503, -692, -705, -493, -54, 411, 655, 737, 866, 929, 647, 154, -146, -199, -267, -444, -577, -501, -112, 476, 838, 730, 554, 758, 1084, 1022, 635, 330, 226, 255, 385, 459, 289, 40, 3, 79, 45, 44, 278, 590, 787, 951, 1098, 943, 403, -150, -340, -217, -47, 79, 231, 413, 573, 718, 805, 660, 258, -78, -88, 65, 137, 257, 646, 1104, 1146, 540, -452, -1272, -1466, -1066, -531, -200, 23, 336, 685, 916, 1012, 988, 775, 390, 48, -74, -40, 2, 83, 323, 618, 615, 107, -641, -1101, -1006, -511, 119, 654, 821, 546, 243, 278, 318, -107, -674, -768, -506, -320, -32, 697, 1518, 1844, 1565, 813, -317, -1574, -2665, -3388, -3190, -1532, 803, 2140, 2150, 1912, 1590, 336, -1387, -1894, -873, 319, 914, 1344, 1893, 2262, 2137, 1348, 50, -1051, -1507, -1824, -2357, -2288, -892, 1141, 2678, 3395, 3338, 2444, 1069, -130, -1188, -2575, -3858, -3784, -1910, 726, 2777, 3708, 3562, 2359, 310, -1801, -3072, -3138, -2052, -65, 2018, 2965, 2237, 538, -1072, -2090, -2380, -1910, -1004, -287, 120, 917, 2627, 4537, 5189, 3886, 1275, -1488, -3626, -4867, -5290, -5131, -4464, -3111, -1112, 905, 2172, 2499, 2286, 1900, 1299, 276, -1189, -2841, -4210, -4829, -4635, -4122, -3705, -3038, -1417, 1058, 3217, 3884, 2903, 932, -1282, -2924, -3121, -1843, -223, 1075, 2871, 5564, 7466, 6677, 3519, -228, -3211, -4738, -4766, -4319, -4230, -3470, -462, 4346, 8967, 12102, 13175, 11247, 5982, -761, -6003, -8389, -8985, -9235, -8893, -6436, -1240, 5106, 9677, 10441, 7879, 4395, 1855, 99, -1715, -3296, -3788, -3258, -2422, -1593, -656, 588, 2385, 4355, 5160, 4073, 2375, 1653, 1378, -115, -2686, -4269, -3707, -2238, -1666, -2114, -2318, -1440, 190, 1660, 2149, 1486, 469, 28, -42, -609, -1570, -1930, -1374, -444, 684, 2138, 3147, 2324, -535, -3798, -5528, -5299, -4169, -3041, -1629, 509, 2478, 2723, 1134, -692, -1492, -1562, -1718, -2101, -2471, -2725, -2391, -486, 2968, 5948, 6345, 4497, 2222, 20, -2711, -5333, -6321, -5658, -4547, -3085, -403, 3133, 5729, 6137, 4702, 2574, 556, -1419, -3711, -5787, -6237, -4247, -333, 4287, 7951, 8792, 6501, 3191, 615, -2172, -6241, -9630, -9492, -5932, -1441, 2062, 3960, 4350, 4193, 4651, 5473, 5242, 3492, 1339, -117, -897, -1471, -1865, -1780, -1336, -1205, -1710, -2046, -1124, 917, 2922, 4244, 4858, 4219, 1784, -1357, -3286, -3861, -4704, -6368, -7139, -5146, -669, 3862, 5866, 4812, 2544, 1076, 518, -258, -1631, -2947, -3700, -3942, -3811, -3446, -3115, -2658, -1046, 2429, 6397, 8026, 6004, 1852, -2118, -4811, -5978, -5692, -4721, -3725, -1924, 1651, 5751, 7709, 6492, 3404, 273, -1708, -2048, -1191, -319, -116, -104, 398, 1119, 974, -748, -3460, -5569, -5809, -4173, -1454, 1681, 4621, 6239, 5393, 2261, -1367, -3528, -3633, -2504, -1151, 94, 1260, 1981, 1552, -187, -2445, -4064, -4136, -2193, 1318, 4670, 5977, 4954, 2847, 755, -1109, -2824, -4376, -5632, -6043, -4799, -1790, 2009, 5426, 7705, 8084, 5804, 1325, -3198, -5795, -6523, -6295, -4650, -717, 3930, 5953, 4298, 1507, 251, 297, -169, -1722, -3430, -4363, -3933, -1581, 2234, 5392, 6154, 5153, 3843, 2192, -231, -2376, -2949, -2357, -1784, -1404, -615, 928, 3102, 5277, 6305, 5369, 2811, -298, -2970, -4390, -3996, -2094, 71, 1410, 1989, 2795, 4524, 6568, 7217, 5190, 940, -3863, -7636, -9151, -7583, -3524, 854, 3686, 4590, 3596, 822, -2166, -2978, -1280, 835, 1771, 1739, 1253, 413, -195, 210, 1055, 667, -1456, -3675, -4110, -2773, -1212, -541, -603, -576, 236, 1810, 3080, 2819, 1233, -155, -631, -1299, -3327, -5899, -6660, -4174, 389, 4097, 4829, 2975, 569, -577, 206, 2199, 3280, 1605, -1851, -3937, -3177, -1154, 374, 1391, 2030, 1553, -159, -1952, -2870, -2868, -1830, 713, 4474, 7925, 9363, 8232, 5264, 1619, -1931, -4955, -7014, -7851, -7645, -6416, -3612, 764, 5022, 6967, 6081, 3495, 368, -2567, -4481, -4750, -3537, -1420, 1025, 3063, 4078, 4179, 3714, 2276, -764, -4766, -7830, -8587, -7280, -4837, -1657, 2087, 5641, 7960, 8428, 6731, 2884, -1976, -5852, -7662, -7834, -6854, -4579, -1245, 2216, 5259, 7862, 9357, 8522, 5380, 1771, -692, -2324, -4118, -5681, -5818, -4689, -3766, -3597, -3142, -1765, -361, 297, 1076, 3118, 5733, 6937, 5701, 2641, -1167, -4704, -6335, -4523, -244, 3051, 3496, 3043, 3715, 4154, 2618, 530, -281, -923, -2590, -3366, -1433, 1248, 1801, 775, 655, 1739, 2232, 1510, 754, 501, -112, -1305, -1847, -1163, -497, -739, -690, 843, 2590, 2726, 2133, 2867, 4193, 3667, 1527, 21, -1064, -3802, -7175, -7330, -3364, 1096, 3084, 3641, 4551, 4774, 2610, -792, -2915, -3447, -3684, -3825, -3423, -2910, -2389, -793, 1798, 3188, 2246, 883, 1128, 2006, 1004, -2326, -5542, -6058, -4028, -1928, -1467, -1898, -1654, -424, 1113, 2311, 2392, 561, -2468, -4076, -2426, 822, 2155, 586, -1160, -420, 2162, 4009, 3533, 770, -3022, -5513, -5087, -2930, -1265, -24, 2120, 4457, 5041, 3736, 1785, -209, -1857, -2312, -1593, -732, -20, 946, 1627, 1074, -427, -1860, -2575, -1878, 576, 3195, 3458, 1182, -1258, -2002, -1158, 290, 1187, 627, -863, -1661, -1263, -734, -802, -1254, -1905, -2380, -1769, 2, 1847, 3470, 5368, 6413, 4505, 170, -3535, -4932, -4774, -3982, -3132, -3391, -5066, -5798, -2737, 3569, 9260, 11172, 9386, 5874, 2138, -1013, -2602, -2195, -1462, -3134, -7427, -10888, -10093, -5459, -107, 3794, 5967, 6629, 6064, 4965, 3873, 2776, 1729, 814, -664, -3528, -6956, -8727, -7607, -4504, -1052, 1885, 3923, 4393, 2944, 633, -573, 211, 1764, 2103, 575, -1813, -3570, -3571, -1537, 1229, 2435, 1410, -33, -615, -1424, -3164, -4086, -2745, -391, 1336, 2755, 4445, 5331, 3978, 449, -3813, -6923, -7405, -5160, -1527, 2020, 4891, 6934, 7746, 6858, 4362, 1213, -1126, -1760, -1193, -659, -594, -315, 689, 1769, 1723, -1, -2865, -5476, -5986, -3155, 2078, 6718, 8570, 8407, 8055, 7111, 3566, -2438, -7739, -9762, -9136, -7432, -4184, 1610, 8271, 12421, 12675, 10103, 5797, 455, -4344, -6980, -7542, -6979, -5183, -1689, 2428, 5124, 5672, 4933, 3504, 1200, -1316, -2195, -769, 1094, 1358, 542, 618, 1818, 2240, 619, -2069, -4118, -4774, -4036, -2162, -12, 1308, 1696, 1889, 1938, 1221, 245, 646, 2549, 3465, 1293, -2529, -4732, -4689, -5120, -7666, -9812, -7752, -1286, 5994, 10875, 12930, 12785, 10188, 4766, -2546, -9738, -14774, -16206, -13657, -8213, -1874, 3731, 7881, 10169, 10218, 8317, 5440, 2103, -1653, -4696, -5214, -3554, -2332, -2567, -2318, -250, 2154, 3033, 2377, 1148, 70, -489, -792, -1407, -1735, -165, 3531, 7364, 9237, 8581, 5924, 2308, -910, -2976, -4473, -6391, -8673, -10131, -9438, -5967, -316, 5745, 10391, 13115, 14549, 14639, 11842, 5144, -3589, -10651, -13985, -14503, -13745, -11578, -6861, 314, 7805, 12763, 13826, 12024, 9320, 6409, 2436, -3082, -8706, -11654, -10085, -5066, -1, 2532, 3125, 3814, 4733, 4109, 1282, -2166, -4566, -5718, -5701, -3809, -42, 3565, 4875, 4192, 3104, 1711, -765, -3427, -4380, -3543, -2545, -2252, -2090, -1192, 683, 2620, 3120, 2216, 1672, 1747, 382, -2802, -5125, -5253, -5034, -5378, -4580, -2141, -65, 714, 1531, 2942, 3750, 3448, 3006, 2964, 2474, 563, -2779, -6769, -10199, -11460, -9080, -3178, 3831, 8853, 10683, 10335, 8826, 5738, 629, -5099, -8908, -9513, -7747, -5225, -2756, -9, 3716, 8428, 12768, 14521, 12249, 6493, -863, -8160, -14163, -17198, -15811, -10461, -3101, 4734, 11689, 15461, 14543, 10426, 5741, 1308, -3013, -6487, -8430, -9047, -8039, -4597, 494, 4920, 7112, 6759, 4040, 212, -2499, -3327, -3674, -4214, -3518, -710, 2494, 3778, 2865, 1254, 211, -287, -843, -1434, -1492, -1290, -2214, -4814, -7437, -8036, -6688, -4917, -2885, 1103, 7686, 14385, 17575, 15885, 10574, 3313, -4841, -12598, -18079, -19610, -16531, -9923, -2517, 3363, 7598, 10695, 11788, 10264, 7548, 4810, 1059, -4107, -8480, -9996, -8868, -5814, -1396, 2532, 4148, 4281, 4792, 5442, 4999, 3611, 1813, -591, -3134, -4564, -4706, -4024, -1973, 1668, 5041, 6206, 5335, 3262, 148, -3072, -4630, -4321, -3744, -3832, -4102, -3871, -2266, 1808, 7476, 10717, 7977, 859, -4753, -4780, -1025, 1501, 432, -2001, -2706, -1674, -1158, -2046, -2790, -1827, 353, 1892, 1539, -134, -1145, -37, 2419, 4155, 4377, 4023, 3703, 2723, 634, -1664, -3057, -3538, -3724, -3715, -3097, -1699, 345, 2903, 5414, 6608, 5671, 3311, 795, -1296, -2561, -2195, -67, 2593, 4144, 3363, -191, -5207, -8873, -9614, -8234, -5384, -428, 5957, 11041, 13076, 12286, 8615, 1858, -5812, -10670, -11011, -7986, -3825, -736, 108, -66, 1071, 3693, 5664, 5859, 5343, 5012, 4121, 1783, -1353, -3520, -3645, -2455, -1325, -107, 2331, 5131, 5494, 2893, 439, 386, 1036, -167, -3113, -5982, -7311, -5983, -1537, 4604, 9691, 11678, 9999, 5221, -1212, -7694, -13251, -16717, -16050, -10292, -1506, 6812, 12482, 14819, 13846, 10673, 6984, 3034, -2376, -9305, -15516, -18277, -16302, -10244, -2497, 4003, 7888, 9955, 11280, 11512, 9498, 4823, -1453, -7205, -10633, -11490, -10364, -7209, -2191, 2637, 4943, 4920, 4244, 3359, 2118, 1252, 654, -1413, -5100, -7533, -6502, -2858, 1590, 5622, 7858, 7673, 6485, 5550, 3714, -391, -5568, -9351, -10440, -8947, -5934, -2732, 760, 5832, 11550, 14050, 11170, 5290, -104, -3950, -6464, -7625, -8222, -9678, -11377, -10107, -3516, 6559, 14828, 16682, 12061, 5205, 202, -2609, -5303, -8795, -11866, -12593, -9701, -3667, 2826, 6895, 8034, 7187, 4105, -1748, -8189, -11203, -9110, -3919, 1256, 4637, 6093, 6365, 6021, 4844, 2436, -807, -3911, -6236, -7610, -7753, -6078, -2185, 3432, 8977, 11659, 9326, 2817, -3663, -6041, -4488, -2599, -2449, -2520, -968, 1511, 3226, 3934, 4333, 4493, 4078, 3326, 2677, 1817, 56, -2392, -4334, -5012, -4990, -5153, -5302, -4343, -1686, 2222, 6497, 10071, 11692, 10715, 7776, 3874, -511, -4392, -5810, -4231, -2081, -2025, -3732, -4824, -3863, -1212, 1942, 4242, 4649, 3137, 735, -1147, -1351, 493, 3466, 5725, 5879, 3934, 731, -3076, -6977, -9881, -10465, -8602, -5694, -3060, -486, 3019, 7387, 10987, 11990, 9960, 6189, 2632, 236, -2004, -5910, -11451, -15608, -14861, -8814, -623, 6135, 10202, 12143, 12378, 10724, 7231, 2295, -3505, -8486, -10006, -7524, -4230, -3367, -4417, -4999, -4305, -2591, 73, 2727, 3974, 4500, 6111, 8121, 8070, 5641, 2668, -24, -2969, -6202, -8980, -10344, -9135, -5074, -186, 2776, 3312, 3026, 3054, 3284, 3544, 3995, 4547, 4725, 4076, 2660, 1357, 1127, 1465, 513, -2649, -6731, -9853, -11274, -10929, -8508, -3957, 1855, 7622, 12307, 15067, 15063, 11845, 6057, -304, -4866, -6660, -6771, -6752, -7005, -7096, -6711, -5456, -2812, 762, 3598, 4630, 4690, 5462, 7677, 10320, 11028, 7789, 1186, -5527, -9397, -10247, -9729, -8895, -7485, -4903, -1106, 3283, 7369, 10375, 11529, 9947, 5566, 147, -3773, -5075, -4427, -2873, -1158, 52, 546, 742, 737, -120, -1940, -3472, -3433, -1909, 290, 2985, 6430, 10056, 12273, 11713, 8151, 2278, -4737, -11314, -15800, -16999, -14304, -8063, -285, 6067, 9525, 11074, 11884, 11182, 7639, 2158, -2306, -3779, -2948, -1658, -1013, -1304, -2233, -2594, -1353, 496, 825, -904, -3491, -5814, -6859, -5241, -991, 3641, 6863, 8902, 9714, 7838, 2948, -2837, -7228, -9489, -9784, -8561, -6635, -4580, -2310, 94, 1975, 3042, 3830, 4844, 5921, 6447, 5732, 3524, 521, -2143, -4156, -6142, -8417, -10452, -11550, -11112, -8254, -2372, 5307, 11592, 13661, 11405, 6941, 2143, -2559, -7162, -10854, -12128, -9773, -3969, 3134, 8359, 9682, 7435, 3353, -1033, -4907, -7790, -9085, -8017, -4352, 698, 4970, 7124, 7468, 6772, 5132, 2378, -1034, -3975, -5260, -4389, -1982, 821, 3448, 5753, 6980, 5967, 2491, -2408, -7071, -9518, -8285, -4186, -119, 2026, 3054, 4478, 6471, 8354, 9416, 8691, 5479, 527, -4338, -7828, -9576, -9308, -6827, -2878, 900, 3353, 4720, 5946, 7344, 8224, 7580, 4836, 313, -4601, -8097, -9234, -8559, -7079, -4854, -1178, 3812, 8348, 10227, 8673, 4810, 658, -2210, -3510, -4032, -4450, -4418, -3135, -607, 2113, 3769, 3799, 2781, 1909, 1588, 1013, -250, -1255, -1193, -635, -169, 623, 1831, 2624, 2809, 3055, 3087, 1727, -910, -3225, -4273, -4558, -4714, -4712, -4194, -2744, -70, 3317, 5896, 6448, 5480, 4417, 3499, 1740, -875, -2849, -3265, -2810, -2297, -1845, -1703, -2183, -2609, -1868, -9, 1785, 2633, 2523, 1884, 1169, 485, -403, -1324, -1416, -299, 1141, 1801, 1515, 712, -207, -842, -1128, -1809, -3550, -5655, -6586, -5495, -2631, 1048, 4154, 5736, 6211, 6434, 6004, 3798, -79, -4244, -7498, -9192, -8779, -6396, -3460, -1578, -917, -262, 1383, 3627, 5028, 4525, 2469, 328, -710, -831, -1088, -1843, -2375, -2320, -2441, -3189, -3709, -3402, -3219, -4079, -5019, -4184, -942, 3600, 7357, 8340, 6007, 1821, -2106, -4732, -6034, -6068, -4974, -3492, -2503, -2035, -1176, 842, 3615, 5728, 6021, 4509, 1974, -1022, -4152, -6502, -6576, -3770, 364, 3006, 2491, -348, -3252, -4450, -3475, -879, 2172, 4292, 4513, 2921, 721, -489, -17, 1249, 1879, 1573, 1199, 1262, 1274, 704, -454, -2212, -4642, -7051, -7843, -5868, -1737, 2498, 5136, 6260, 7127, 8093, 7927, 5610, 1950, -1309, -3169, -3513, -2515, -457, 2507, 6363, 10052, 10950, 7150, -22, -7023, -11070, -11351, -8530, -4224, -17, 3706, 7231, 10006, 10929, 9935, 8101, 6473, 5500, 4906, 3529, 244, -4392, -8227, -9554, -8404, -5953, -3495, -1782, -516, 1465, 4852, 8714, 11163, 11095, 8797, 5007, 280, -4559, -8353, -10490, -10973, -9230, -4185, 3667, 11235, 14865, 13134, 7466, 704, -4534, -6914, -6801, -5651, -4460, -2789, 290, 4505, 8232, 9793, 8404, 4522, -16, -2943, -3445, -2515, -1241, 172, 1626, 2799, 3632, 4121, 3969, 3297, 2699, 1813, -746, -5074, -9015, -10267, -8376, -4523, -511, 2220, 3803, 5853, 9192, 12310, 12867, 10096, 5172, -49, -4269, -7257, -9397, -10558, -9750, -6356, -1321, 3537, 7207, 9648, 10428, 8341, 3133, -3226, -7903, -9433, -8102, -4955, -1275, 1574, 2851, 2901, 2437, 1602, 284, -1043, -1556, -1237, -1062, -1785, -3041, -3958, -4182, -3900, -3275, -2432, -1772, -1678, -1903, -1815, -1323, -969, -1130, -1757, -2782, -3985, -4643, -4164, -2891, -1633, -807, -576, -1091, -2079, -2922, -3520, -4315, -5369, -6140, -6082, -4949, -2944, -927, 257, 913, 1922, 3001, 2728, 507, -2602, -5178, -6616, -7060, -6935, -6566, -5702, -3541, 211, 4331, 6779, 6654, 5074, 3793, 3375, 3133, 2406, 1249, 19, -1121, -2159, -2991, -3384, -3130, -2126, -257, 2590, 6016, 8855, 9990, 9505, 8456, 7478, 6178, 4036, 1399, -788, -1872, -1693, -286, 2009, 4341, 5952, 6994, 8118, 9422, 10350, 10372, 9257, 7220, 5256, 4651, 5572, 6746, 6847, 5630, 3669, 1730, 457, 81, 480, 1717, 4109, 7534, 11177, 14117, 15640, 15088, 12185, 7711, 3260, 182, -1134, -1104, -436, 327, 1022, 1739, 2623, 3887, 5634, 7448, 8565, 8648, 8037, 7011, 5340, 2956, 601, -750, -963, -842, -1186, -2036, -2848, -3027, -2180, -182, 2628, 5348, 6862, 6424, 4135, 988, -1648, -2977, -3312, -3630, -4539, -5688, -6163, -5401, -3751, -2081, -905, -219, -96, -876, -2487, -4102, -4821, -4512, -3887, -4031, -5552, -7795, -9151, -8591, -6614, -4427, -2782, -1914, -1895, -2478, -3028, -3232, -3559, -4601, -6113, -7159, -7234, -6834, -6757, -7129, -7491, -7661, -7877, -8080, -7753, -6772, -5635, -4522, -2964, -968, 290, -362, -2715, -5278, -6551, -6270, -5768, -6681, -8936, -10579, -9877, -6943, -3289, -668, -258, -1876, -3985, -5235, -5712, -6065, -6186, -5594, -4493, -3625, -3452, -3914, -4614, -5009, -4764, -4147, -3770, -3837, -3820, -3044, -1495, 120, 982, 675, -688, -2573, -4410, -5979, -7106, -7153, -5585, -3006, -623, 1149, 2533, 3043, 1671, -1499, -4967, -7228, -7740, -6566, -3882, -149, 3612, 6115, 6565, 5180, 2851, 374, -1857, -3562, -4425, -4435, -4010, -3447, -2350, -174, 2606, 4641, 5215, 4786, 3802, 2194, 310, -1035, -1835, -2818, -3977, -4508, -4097, -3026, -1323, 1016, 3480, 5479, 6656, 6511, 4754, 2093, -498, -3030, -5812, -8083, -8559, -6897, -3763, -166, 2678, 3727, 2972, 1401, -54, -1025, -1539, -1952, -2591, -2987, -2126, 206, 3019, 5105, 5626, 3976, 162, -4622, -8691, -11066, -11690, -10903, -9225, -7085, -4446, -1042, 2948, 6867, 9909, 11144, 9897, 6488, 2012, -2828, -7756, -11938, -14297, -14778, -14119, -12279, -8380, -2310, 4543, 10292, 13722, 14623, 13350, 10190, 5327, -609, -6533, -11694, -15777, -17842, -16274, -10573, -2504, 5082, 10067, 11612, 9965, 6160, 1553, -2463, -4564, -4232, -2480, -756, 892, 3330, 6286, 8263, 8273, 6253, 2292, -3085, -8204, -11092, -10934, -8171, -3866, 701, 4521, 7406, 9703, 11481, 12359, 11857, 9658, 5903, 1468, -2408, -4971, -6116, -5914, -4438, -1942, 1295, 5256, 9806, 14033, 16485, 16345, 14006, 10335, 5612, -221, -6374, -10938, -12192, -9990, -5664, -739, 4003, 8342, 11953, 14344, 15224, 14441, 11643, 6828, 1366, -2461, -3500, -2703, -1714, -1162, -628, 368, 1706, 2691, 2732, 2018, 1169, 262, -1050, -2549, -3464, -3425, -2503, -555, 2515, 5982, 8720, 10288, 10890, 10493, 8718, 5559, 1693, -2043, -5119, -7200, -7853, -6753, -4137, -773, 2637, 5734, 8132, 9249, 8868, 7501, 5826, 4068, 2305, 1055, 889, 1623, 2514, 3376, 4759, 6742, 8341, 8658, 8004, 7235, 6521, 5588, 4728, 4629, 5296, 5970, 6282, 6800, 8134, 10028, 11725, 12789, 13212, 13108, 12639, 12012, 11177, 9927, 8499, 7671, 7923, 8857, 9840, 10923, 12552, 14482, 15681, 15483, 14352, 13153, 12202, 11352, 10662, 10421, 10684, 11231, 11996, 13099, 14365, 15235, 15363, 14980, 14383, 13348, 11570, 9479, 7972, 7368, 7233, 7311, 7859, 8900, 9882, 10455, 10945, 11650, 12081, 11526, 10118, 8760, 7935, 7102, 5583, 3658, 2307, 2012, 2312, 2569, 2715, 3025, 3516, 3843, 3646, 2824, 1585, 318, -653, -1246, -1529, -1562, -1438, -1390, -1608, -1964, -2201, -2487, -3384, -5031, -6786, -8029, -8764, -9164, -9119, -8623, -8056, -7687, -7470, -7471, -7922, -8753, -9596, -10295, -10975, -11717, -12441, -13059, -13466, -13492, -13112, -12597, -12337, -12483, -12869, -13278, -13649, -13992, -14276, -14524, -14845, -15321, -15844, -16168, -16025, -15373, -14512, -13901, -13743, -13848, -14029, -14420, -15279, -16531, -17709, -18358, -18350, -17839, -17049, -16137, -15117, -13878, -12504, -11488, -11405, -12313, -13741, -15202, -16484, -17436, -17833, -17544, -16729, -15704, -14642, -13465, -12162, -11135, -10930, -11573, -12456, -13030, -13294, -13405, -13366, -13159, -12886, -12506, -11760, -10554, -9204, -8229, -7940, -8225, -8691, -9067, -9414, -9853, -10223, -10274, -10022, -9572, -8731, -7188, -5222, -3704, -3140, -3030, -2616, -2050, -2264, -3634, -5301, -6182, -6170, -5806, -5177, -3878, -2034, -469, 269, 457, 575, 721, 810, 834, 671, 60, -885, -1427, -886, 546, 2057, 3060, 3523, 3628, 3607, 3695, 3856, 3657, 2774, 1540, 664, 523, 949, 1660, 2602, 3781, 5024, 6046, 6634, 6693, 6241, 5459, 4641, 3969, 3432, 3014, 2856, 3054, 3467, 3918, 4480, 5246, 5896, 5929, 5259, 4242, 3271, 2651, 2608, 3055, 3588, 3988, 4346, 4713, 5074, 5591, 6243, 6442, 5675, 4316, 3172, 2523, 2120, 1855, 1858, 2117, 2499, 3021, 3830, 4857, 5720, 6017, 5612, 4630, 3378, 2236, 1395, 701, 21, -344, 39, 1170, 2662, 4118, 5207, 5692, 5635, 5275, 4619, 3488, 1916, 119, -1610, -2685, -2421, -856, 1148, 2853, 4105, 4813, 4875, 4576, 4275, 3727, 2508, 974, 52, 147, 821, 1509, 1977, 2101, 1711, 961, 409, 410, 683, 759, 615, 554, 779, 1358, 2312, 3428, 4181, 4101, 3234, 2187, 1704, 2084, 2992, 3822, 4210, 4077, 3347, 1962, 289, -817, -794, -107, 311, 293, 505, 1366, 2626, 3837, 4507, 4100, 2745, 1374, 485, -341, -1154, -1114, 123, 1846, 3500, 5099, 6290, 6327, 5091, 3033, 380, -2633, -5083, -5834, -4600, -2048, 958, 3886, 6447, 8320, 9067, 8334, 6176, 3154, 46, -2611, -4597, -5630, -5281, -3526, -1074, 1212, 2971, 4165, 4617, 4192, 3218, 2248, 1470, 772, 276, 451, 1515, 3055, 4424, 5267, 5496, 4998, 3732, 1988, 198, -1491, -3114, -4342, -4538, -3546, -1935, -252, 1494, 3359, 4987, 5849, 5641, 4379, 2382, 120, -2172, -4583, -6981, -8766, -9367, -8685, -6947, -4442, -1482, 1630, 4534, 6643, 7443, 7079, 6108, 4557, 1908, -1772, -5339, -7494, -7803, -6772, -5268, -3858, -2404, -352, 2323, 4683, 5626, 5062, 3905, 2930, 2136, 1369, 922, 1138, 1851, 2711, 3699, 4898, 6052, 6692, 6556, 5718, 4533, 3578, 3420, 4252, 5704, 7116, 8170, 9272, 10937, 12767, 13646, 13266, 12560, 12252, 11888, 10954, 9945, 9619, 9989, 10591, 11238, 12149, 13715, 16018, 18399, 19809, 19900, 19260, 18448, 17497, 16439, 15570, 15023, 14703, 14662, 15077, 15981, 17265, 18799, 20187, 20781, 20303, 19252, 18356, 17708, 16877, 15795, 15022, 14948, 15333, 15812, 16388, 17132, 17854, 18247, 18090, 17350, 16284, 15384, 14814, 14180, 13115, 11900, 11186, 11199, 11498, 11491, 11023, 10408, 9986, 9802, 9624, 9222, 8502, 7532, 6472, 5518, 4839, 4478, 4306, 4172, 4121, 4161, 3993, 3289, 2171, 918, -544, -2299, -3854, -4655, -4849, -4980, -5161, -5135, -4850, -4537, -4465, -4854, -5723, -6810, -7826, -8847, -10124, -11604, -12868, -13517, -13500, -13138, -12918, -13141, -13704, -14252, -14555, -14732, -15005, -15398, -15837, -16350, -16938, -17374, -17514, -17654, -18170, -18951, -19633, -20180, -20825, -21559, -22050, -22024, -21567, -21156, -21277, -21828, -22099, -21616, -20690, -19951, -19749, -20088, -20811, -21530, -21931, -22199, -22830, -23908, -24925, -25350, -25004, -24025, -22787, -21871, -21717, -22128, -22339, -21887, -21184, -20993, -21509, -22187, -22356, -21773, -20724, -19761, -19261, -19080, -18790, -18234, -17673, -17460, -17712, -18231, -18653, -18677, -18324, -17889, -17568, -17224, -16535, -15360, -13956, -12811, -12227, -11984, -11614, -10940, -10220, -9819, -9834, -10093, -10276, -10177, -9902, -9697, -9503, -8990, -8117, -7271, -6724, -6292, -5676, -4868, -4090, -3488, -3003, -2432, -1722, -1121, -859, -793, -638, -428, -399, -515, -479, -178, 233, 668, 1228, 1975, 2761, 3432, 4035, 4713, 5444, 6006, 6174, 5903, 5412, 5081, 5122, 5356, 5510, 5630, 5919, 6370, 6871, 7448, 8101, 8657, 9010, 9254, 9404, 9350, 9152, 8997, 8815, 8316, 7567, 7092, 7210, 7573, 7680, 7605, 7826, 8487, 9259, 9853, 10225, 10352, 10230, 10007, 9790, 9382, 8540, 7428, 6564, 6272, 6363, 6432, 6339, 6307, 6576, 7084, 7573, 7868, 7975, 7939, 7765, 7480, 7165, 6821, 6302, 5546, 4817, 4466, 4458, 4471, 4406, 4479, 4762, 5032, 5102, 5033, 4986, 5039, 5127, 5107, 4933, 4765, 4688, 4479, 3953, 3403, 3308, 3645, 3858, 3594, 3154, 3121, 3645, 4272, 4462, 4180, 3877, 3902, 4144, 4271, 4160, 3961, 3803, 3682, 3625, 3724, 3906, 3882, 3516, 3077, 2910, 3006, 3094, 3012, 2844, 2822, 3135, 3696, 4105, 4021, 3538, 3038, 2734, 2552, 2369, 2184, 2088, 2170, 2499, 3079, 3753, 4246, 4333, 3972, 3297, 2601, 2186, 1995, 1551, 644, -141, -80, 702, 1418, 1652, 1727, 2079, 2680, 3092, 2922, 2225, 1443, 885, 471, 75, -180, -238, -316, -524, -541, -14, 885, 1543, 1468, 721, -169, -627, -511, -227, -288, -743, -1109, -981, -474, 50, 413, 498, 19, -1147, -2486, -3157, -2937, -2445, -2267, -2213, -1702, -626, 555, 1374, 1652, 1445, 988, 500, -87, -935, -1851, -2418, -2562, -2520, -2304, -1686, -768, -99, -7, -158, -29, 352, 449, -7, -599, -690, -123, 689, 1242, 1324, 1019, 525, -40, -846, -2335, -4797, -7865, -10601, -12196, -12487, -11696, -9850, -6726, -2326, 2786, 7776, 11941, 14711, 15436, 13644, 9567, 4080, -1947, -7882, -12972, -16327, -17432, -16321, -13224, -8484, -2815, 2786, 7489, 10832, 12640, 12888, 11629, 9122, 6107, 3534, 1802, 648, 65, 530, 2042, 3797, 5177, 6278, 7182, 7556, 7254, 6592, 6019, 5985, 6929, 8810, 10887, 12471, 13686, 15091, 16753, 18061, 18402, 17713, 16347, 14715, 13188, 12153, 11846, 12177, 12883, 13846, 15217, 17232, 19742, 21974, 23003, 22657, 21657, 20768, 20116, 19422, 18573, 17813, 17587, 18314, 20004, 22003, 23412, 23857, 23691, 23252, 22326, 20603, 18405, 16358, 14714, 13487, 12995, 13599, 15108, 16899, 18542, 19950, 21106, 21849, 21791, 20573, 18312, 15735, 13480, 11593, 9880, 8429, 7553, 7360, 7634, 8012, 8199, 8159, 8108, 8221, 8353, 8158, 7497, 6615, 5826, 5198, 4632, 4053, 3357, 2356, 1009, -458, -1876, -3292, -4739, -6051, -7026, -7507, -7349, -6622, -5742, -5119, -4791, -4658, -4838, -5543, -6852, -8742, -11042, -13288, -14986, -16022, -16620, -16934, -16884, -16421, -15691, -15024, -14741, -14948, -15491, -16228, -17181, -18336, -19429, -20189, -20625, -20953, -21248, -21392, -21359, -21304, -21375, -21580, -21903, -22342, -22829, -23203, -23441, -23684, -23989, -24227, -24291, -24291, -24354, -24448, -24462, -24366, -24266, -24213, -24163, -24041, -23880, -23849, -24037, -24316, -24390, -24146, -23842, -23812, -24016, -24151, -24095, -24000, -23897, -23640, -23190, -22683, -22178, -21563, -20847, -20181, -19658, -19205, -18755, -18378, -18190, -18184, -18240, -18259, -18275, -18341, -18394, -18291, -17974, -17445, -16663, -15595, -14386, -13282, -12374, -11509, -10518, -9521, -8828, -8625, -8793, -9063, -9254, -9359, -9451, -9563, -9609, -9379, -8631, -7317, -5713, -4260, -3217, -2425, -1537, -462, 489, 957, 860, 415, -53, -215, 69, 567, 883, 941, 1082, 1619, 2495, 3401, 4102, 4567, 4900, 5253, 5700, 6193, 6637, 7026, 7453, 7967, 8439, 8668, 8612, 8449, 8349, 8296, 8188, 8025, 7912, 7901, 8016, 8334, 8935, 9720, 10450, 10957, 11246, 11455, 11658, 11718, 11406, 10759, 10131, 9779, 9619, 9524, 9623, 10027, 10516, 10744, 10640, 10403, 10209, 10011, 9625, 9002, 8365, 8006, 7966, 8100, 8390, 8958, 9741, 10430, 10795, 10865, 10717, 10287, 9483, 8388, 7187, 5996, 4907, 4080, 3639, 3533, 3678, 4132, 4923, 5879, 6783, 7539, 8105, 8423, 8524, 8452, 8095, 7322, 6241, 5143, 4201, 3407, 2732, 2178, 1700, 1281, 1082, 1324, 1951, 2637, 3196, 3754, 4421, 5052, 5518, 5851, 6000, 5733, 4965, 3967, 3081, 2408, 1792, 1062, 258, -327, -419, -53, 453, 851, 1162, 1505, 1815, 1947, 1958, 2034, 2126, 1999, 1643, 1325, 1225, 1323, 1485, 1415, 887, 228, 27, 166, -61, -740, -1159, -1002, -781, -912, -1178, -1290, -1271, -1162, -865, -456, -236, -300, -342, -75, 353, 559, 373, -126, -850, -1701, -2499, -3142, -3740, -4388, -4901, -4959, -4477, -3616, -2497, -1195, -14, 625, 669, 447, 197, -54, -328, -800, -1753, -3016, -3885, -4015, -3870, -3875, -3862, -3663, -3545, -3646, -3618, -3197, -2667, -2458, -2517, -2378, -1740, -840, -188, -26, -132, -170, -169, -548, -1568, -2841, -3676, -3879, -3881, -3975, -3854, -3102, -1845, -627, 226, 853, 1472, 1923, 1796, 1044, 227, -107, -84, -237, -701, -1005, -655, 334, 1441, 1995, 1573, 295, -1275, -2696, -4106, -5900, -7976, -9599, -10132, -9492, -7751, -4787, -694, 3831, 7892, 10965, 12907, 13592, 12776, 10277, 6265, 1404, -3352, -7240, -9888, -11189, -11062, -9462, -6443, -2363, 2028, 5953, 9145, 11717, 13526, 14196, 13755, 12694, 11396, 9998, 8760, 7951, 7478, 7086, 6805, 6797, 6945, 7004, 6995, 7195, 7792, 8734, 9911, 11410, 13468, 15997, 18363, 20038, 21230, 22346, 23119, 22882, 21559, 19631, 17527, 15562, 14143, 13468, 13290, 13449, 14215, 15819, 18062, 20498, 22670, 24103, 24522, 24119, 23448, 22976, 22746, 22375, 21469, 20233, 19468, 19694, 20423, 20664, 20054, 19113, 18367, 17678, 16699, 15561, 14731, 14366, 14284, 14441, 15031, 16046, 17114, 17879, 18233, 18214, 17768, 16837, 15465, 13759, 11858, 9994, 8453, 7315, 6389, 5552, 4962, 4815, 4998, 5160, 5057, 4715, 4284, 3901, 3598, 3299, 2853, 2244, 1675, 1295, 908, 186, -919, -2259, -3751, -5374, -7013, -8538, -9892, -10928, -11411, -11291, -10774, -10040, -9172, -8362, -7950, -8110, -8670, -9485, -10742, -12638, -14841, -16645, -17705, -18320, -18931, -19554, -19852, -19590, -18951, -18418, -18364, -18738, -19182, -19395, -19377, -19291, -19201, -19135, -19208, -19529, -19953, -20234, -20455, -21027, -22149, -23510, -24581, -25112, -25211, -25135, -25005, -24731, -24213, -23510, -22737, -21933, -21150, -20566, -20267, -20109, -20019, -20142, -20567, -21140, -21707, -22222, -22641, -22903, -23071, -23161, -22970, -22328, -21417, -20567, -19922, -19412, -18896, -18262, -17493, -16788, -16359, -16194, -16032, -15713, -15372, -15161, -14993, -14753, -14607, -14770, -15072, -15095, -14648, -13873, -13052, -12460, -12109, -11619, -10631, -9388, -8434, -7894, -7491, -7108, -6771, -6333, -5692, -5083, -4799, -4757, -4666, -4406, -4073, -3823, -3716, -3625, -3306, -2649, -1745, -711, 331, 1175, 1702, 2088, 2550, 2979, 3089, 2869, 2558, 2323, 2174, 2180, 2482, 3088, 3795, 4375, 4791, 5205, 5730, 6264, 6536, 6417, 6127, 6102, 6542, 7159, 7468, 7304, 6975, 6889, 7179, 7626, 7892, 7789, 7402, 6943, 6592, 6446, 6543, 6781, 6943, 6934, 6984, 7393, 8097, 8661, 8777, 8577, 8291, 7880, 7233, 6540, 6094, 5836, 5444, 4903, 4628, 4914, 5521, 5986, 6141, 6133, 6066, 5913, 5684, 5400, 4958, 4243, 3416, 2857, 2740, 2844, 2881, 2856, 2944, 3123, 3172, 3008, 2832, 2802, 2781, 2549, 2120, 1664, 1273, 966, 813, 839, 924, 967, 1076, 1398, 1831, 2078, 1984, 1675, 1370, 1171, 1049, 892, 548, 23, -379, -296, 231, 754, 940, 903, 991, 1348, 1763, 1916, 1719, 1415, 1273, 1282, 1245, 1131, 1162, 1466, 1827, 1972, 1984, 2180, 2599, 2903, 2811, 2387, 1912, 1671, 1789, 2076, 2182, 2067, 2087, 2473, 3019, 3407, 3552, 3484, 3192, 2706, 2209, 1939, 2012, 2311, 2556, 2614, 2711, 3158, 3882, 4446, 4503, 4082, 3508, 3126, 3017, 2948, 2735, 2558, 2653, 2867, 2921, 2927, 3192, 3602, 3673, 3191, 2470, 1917, 1651, 1598, 1651, 1628, 1418, 1302, 1673, 2315, 2568, 2375, 2359, 2645, 2562, 1812, 1071, 1046, 1551, 1837, 1437, 608, 77, 310, 917, 1045, 411, -370, -572, -136, 439, 727, 693, 521, 376, 341, 384, 303, -136, -951, -1851, -2437, -2499, -2126, -1619, -1249, -1025, -684, -29, 714, 1074, 965, 808, 874, 878, 496, -134, -661, -905, -830, -537, -340, -410, -486, -298, -7, 147, 236, 330, 233, -88, -288, -71, 460, 961, 1051, 496, -562, -1693, -2710, -3898, -5509, -7265, -8557, -8943, -8300, -6661, -4219, -1340, 1693, 4856, 7966, 10246, 10802, 9578, 7299, 4501, 1145, -2694, -6310, -8845, -9964, -9716, -8125, -5289, -1735, 1847, 5201, 8398, 11202, 12941, 13096, 11821, 9816, 7892, 6581, 5923, 5529, 5114, 4956, 5533, 6717, 7784, 8328, 8643, 9008, 9313, 9617, 10467, 12102, 13884, 15054, 15824, 17064, 18938, 20626, 21303, 20807, 19354, 17460, 15936, 15166, 14562, 13590, 12845, 13308, 14993, 17193, 19487, 21747, 23645, 24788, 25166, 25105, 24883, 24370, 23141, 21091, 18992, 17959, 18284, 19130, 19588, 19613, 19754, 20225, 20622, 20440, 19607, 18413, 17236, 16371, 15911, 15774, 15880, 16300, 17012, 17734, 18169, 18289, 18077, 17280, 15711, 13703, 11891, 10568, 9475, 8284, 7107, 6339, 6223, 6569, 6926, 6888, 6388, 5729, 5257, 4945, 4424, 3476, 2333, 1403, 822, 423, 56, -395, -1113, -2196, -3459, -4680, -5941, -7398, -8903, -10122, -10977, -11580, -11837, -11514, -10712, -9925, -9463, -9189, -9074, -9504, -10739, -12481, -14280, -16036, -17779, -19398, -20756, -21708, -22056, -21729, -21101, -20629, -20364, -20090, -19785, -19652, -19780, -20042, -20280, -20455, -20608, -20765, -20960, -21258, -21726, -22384, -23195, -24094, -24991, -25806, -26490, -27005, -27247, -27084, -26497, -25672, -24804, -23933, -22988, -22011, -21217, -20785, -20721, -20930, -21369, -22037, -22836, -23609, -24198, -24555, -24665, -24553, -24269, -23838, -23214, -22332, -21260, -20200, -19353, -18765, -18291, -17725, -17042, -16423, -16045, -15871, -15763, -15674, -15616, -15578, -15547, -15555, -15582, -15526, -15281, -14800, -14083, -13129, -12001, -10814, -9658, -8582, -7637, -6897, -6357, -5924, -5576, -5438, -5572, -5762, -5677, -5319, -5059, -5106, -5144, -4788, -4136, -3492, -2832, -1948, -935, -40, 747, 1572, 2381, 3021, 3438, 3579, 3408, 3071, 2798, 2591, 2290, 1893, 1630, 1706, 2154, 2828, 3516, 4118, 4683, 5186, 5509, 5778, 6345, 7207, 7848, 7893, 7544, 7186, 6980, 6928, 6897, 6667, 6208, 5759, 5384, 4918, 4507, 4566, 5068, 5563, 5937, 6414, 6982, 7501, 8025, 8453, 8435, 8046, 7796, 7652, 7008, 5851, 4948, 4686, 4630, 4351, 3967, 3815, 4063, 4637, 5231, 5488, 5376, 5265, 5431, 5663, 5581, 5239, 4997, 4890, 4578, 4015, 3621, 3641, 3799, 3741, 3455, 3079, 2647, 2233, 2037, 2142, 2363, 2504, 2626, 2839, 3064, 3238, 3505, 3895, 4065, 3724, 3139, 2802, 2759, 2664, 2423, 2352, 2615, 2921, 2984, 2931, 2996, 3122, 3146, 3091, 3064, 3097, 3229, 3559, 4063, 4565, 4919, 5106, 5153, 5128, 5151, 5252, 5259, 4976, 4517, 4254, 4363, 4645, 4873, 5061, 5249, 5282, 5066, 4850, 4949, 5282, 5492, 5462, 5438, 5563, 5674, 5639, 5580, 5564, 5434, 5130, 4874, 4835, 4835, 4641, 4355, 4306, 4575, 4848, 4815, 4592, 4526, 4645, 4628, 4380, 4218, 4306, 4374, 4225, 4130, 4289, 4318, 3737, 2764, 2132, 2126, 2254, 1992, 1506, 1352, 1664, 2005, 1972, 1660, 1416, 1366, 1333, 1133, 784, 431, 179, 75, 173, 493, 892, 1087, 926, 623, 555, 764, 784, 128, -1075, -2151, -2613, -2637, -2675, -2824, -2824, -2500, -1894, -1071, -128, 613, 749, 198, -657, -1359, -1822, -2372, -3258, -4182, -4486, -3849, -2613, -1400, -560, -82, 170, 314, 381, 281, -153, -950, -1855, -2521, -2754, -2467, -1596, -361, 642, 1044, 1215, 1711, 2365, 2470, 1813, 921, 305, -61, -369, -499, -244, 190, 298, -57, -462, -624, -944, -2061, -3954, -5845, -7079, -7730, -8018, -7427, -5073, -1066, 3288, 6892, 9631, 11605, 12585, 12496, 11422, 9040, 5031, -21, -4977, -8889, -10851, -10184, -7552, -4595, -1819, 1758, 6523, 11277, 14606, 15945, 15411, 13740, 12191, 11435, 10925, 9849, 8333, 7261, 7349, 8491, 9740, 10106, 9640, 9326, 9657, 10068, 10078, 10231, 11271, 13053, 15004, 17236, 20166, 23118, 24565, 24042, 22823, 22113, 21445, 19649, 16687, 13713, 11666, 10690, 10783, 12037, 14122, 16287, 18251, 20467, 23134, 25512, 26564, 25847, 23783, 21372, 19584, 18668, 18053, 17123, 15905, 14900, 14519, 14868, 15685, 16296, 15891, 14323, 12490, 11559, 11709, 12085, 12021, 11804, 12099, 13067, 14245, 14926, 14660, 13514, 11888, 10036, 8016, 6021, 4264, 2661, 1171, 224, 195, 734, 1188, 1361, 1376, 1187, 725, 66, -794, -1968, -3248, -4081, -4149, -3786, -3586, -3795, -4202, -4546, -4932, -5808, -7554, -10062, -12686, -14769, -16223, -17316, -17942, -17659, -16426, -14839, -13399, -12192, -11310, -11058, -11563, -12618, -14056, -15879, -17987, -19977, -21417, -22103, -22119, -21740, -21426, -21521, -21845, -21845, -21417, -21186, -21740, -22811, -23528, -23294, -22197, -20847, -19873, -19436, -19258, -19171, -19336, -19911, -20824, -22025, -23550, -25170, -26360, -26789, -26596, -26052, -25176, -23949, -22580, -21358, -20271, -19154, -18155, -17638, -17692, -18017, -18391, -18867, -19529, -20229, -20740, -20998, -21148, -21319, -21368, -20955, -19961, -18750, -17779, -17146, -16535, -15659, -14578, -13585, -12908, -12555, -12370, -12150, -11820, -11560, -11621, -11957, -12265, -12429, -12478, -12288, -11777, -11211, -10737, -9995, -8769, -7424, -6285, -5219, -4285, -3759, -3358, -2536, -1653, -1578, -2223, -2631, -2422, -2065, -1942, -2009, -2202, -2436, -2360, -1670, -602, 306, 953, 1783, 3096, 4566, 5634, 6056, 5912, 5418, 4898, 4549, 4181, 3498, 2615, 2045, 2183, 2996, 4064, 4858, 5226, 5567, 6230, 6937, 7179, 6950, 6660, 6476, 6301, 6309, 6859, 7730, 8042, 7374, 6478, 6301, 6652, 6515, 5479, 4226, 3610, 3761, 4210, 4567, 4922, 5604, 6646, 7664, 8300, 8520, 8350, 7686, 6568, 5396, 4529, 3820, 2898, 1873, 1370, 1746, 2608, 3334, 3769, 4152, 4588, 4911, 4976, 4771, 4305, 3602, 2852, 2370, 2323, 2531, 2674, 2632, 2536, 2477, 2373, 2183, 1981, 1688, 1111, 409, 107, 399, 900, 1299, 1764, 2469, 3164, 3523, 3575, 3520, 3330, 2842, 2100, 1394, 942, 762, 799, 997, 1273, 1610, 2096, 2698, 3163, 3324, 3296, 3233, 3156, 3096, 3141, 3274, 3415, 3628, 4044, 4566, 4935, 5077, 5132, 5099, 4759, 4146, 3703, 3682, 3749, 3583, 3483, 3897, 4724, 5534, 6110, 6488, 6758, 7013, 7166, 6942, 6328, 5699, 5228, 4691, 4090, 3845, 4038, 4177, 4039, 4051, 4571, 5275, 5646, 5663, 5668, 5790, 5829, 5658, 5373, 5066, 4690, 4231, 3819, 3587, 3546, 3517, 3228, 2649, 2211, 2337, 2765, 2789, 2276, 1981, 2518, 3425, 3789, 3523, 3384, 3711, 3884, 3300, 2237, 1329, 652, -179, -1228, -2018, -2166, -1913, -1776, -1781, -1436, -543, 368, 741, 726, 825, 1080, 1096, 702, 157, -385, -1116, -2080, -2886, -3261, -3517, -4045, -4680, -4958, -4685, -3978, -3107, -2441, -2059, -1561, -793, -331, -595, -1133, -1467, -1864, -2550, -3102, -3258, -3442, -3865, -3983, -3355, -2384, -1757, -1594, -1478, -1095, -587, -336, -497, -819, -922, -689, -366, -277, -422, -481, -224, 178, 392, 373, 363, 463, 432, 77, -329, -249, 403, 1067, 1261, 1199, 1291, 1337, 759, -505, -1976, -3449, -5171, -7084, -8495, -8840, -8284, -7108, -4895, -948, 4475, 9939, 14141, 16960, 18671, 18673, 16118, 11464, 6214, 1116, -4062, -9039, -12598, -13802, -12495, -8858, -3414, 2707, 8412, 13343, 17471, 20437, 21754, 21367, 19711, 17371, 14877, 12637, 10932, 9916, 9470, 9204, 8784, 8324, 8271, 8765, 9278, 9264, 9060, 9578, 11176, 13595, 16757, 20569, 24195, 26765, 28431, 29563, 29473, 27395, 23917, 20240, 16715, 13213, 10067, 7852, 6941, 7632, 10001, 13515, 17352, 20926, 23832, 25880, 27282, 28222, 28055, 25951, 22449, 19362, 17740, 16732, 15083, 12990, 11620, 11269, 11177, 10914, 10688, 10412, 9806, 9226, 9235, 9727, 10325, 10986, 11556, 11804, 12083, 12681, 12640, 10920, 8299, 6315, 5010, 3325, 1042, -1072, -2358, -2529, -1752, -925, -929, -1508, -1810, -1798, -2220, -3392, -4920, -6453, -7852, -8698, -8503, -7590, -7033, -7255, -7470, -7018, -6545, -7134, -8993, -11518, -14023, -15965, -17206, -18174, -19232, -19988, -19826, -18806, -17449, -16124, -15157, -14998, -15708, -16626, -17104, -17324, -17942, -19088, -20123, -20483, -20308, -20110, -20239, -20785, -21641, -22569, -23444, -24382, -25351, -25986, -26096, -25824, -25117, -23685, -21742, -20007, -18855, -18070, -17552, -17586, -18321, -19528, -20948, -22455, -23851, -24875, -25503, -25976, -26271, -26027, -25088, -23871, -22762, -21697, -20613, -19679, -18890, -17984, -16988, -16213, -15765, -15595, -15754, -16119, -16388, -16774, -17876, -19561, -20820, -21069, -20681, -20097, -19317, -18304, -17059, -15341, -12983, -10479, -8696, -7975, -7865, -7805, -7730, -7973, -8708, -9712, -10614, -11152, -11160, -10543, -9497, -8495, -7797, -7063, -5767, -3986, -2453, -1720, -1524, -1142, -277, 660, 1100, 1007, 829, 831, 870, 834, 777, 576, 69, -281, 256, 1532, 2586, 2997, 3368, 4322, 5774, 7200, 8103, 8216, 7723, 7142, 6780, 6500, 6061, 5422, 4675, 4060, 3984, 4666, 5687, 6261, 6269, 6550, 7697, 9063, 9615, 9289, 8672, 8071, 7705, 7906, 8328, 8038, 6975, 6108, 5908, 6028, 6299, 6589, 6282, 5327, 4856, 5473, 6247, 6338, 6098, 5950, 5846, 6066, 6878, 7485, 6959, 5757, 4972, 4688, 4284, 3631, 3055, 2640, 2295, 2095, 2150, 2406, 2716, 3002, 3271, 3583, 3885, 3934, 3520, 2798, 2167, 1858, 1717, 1484, 1105, 735, 515, 486, 662, 997, 1310, 1349, 1087, 787, 639, 460, 2, -526, -664, -365, -40, 103, 323, 876, 1643, 2292, 2583, 2496, 2236, 2026, 1839, 1484, 959, 485, 199, 86, 226, 804, 1738, 2533, 2811, 2805, 3017, 3494, 3793, 3640, 3241, 2968, 3031, 3387, 3783, 4047, 4346, 4883, 5421, 5581, 5430, 5243, 4911, 4197, 3357, 2885, 2846, 2931, 3059, 3459, 4268, 5314, 6318, 7073, 7448, 7387, 6946, 6257, 5401, 4395, 3361, 2585, 2294, 2466, 2929, 3550, 4294, 5089, 5761, 6111, 6052, 5635, 4977, 4198, 3437, 2849, 2540, 2470, 2536, 2785, 3401, 4276, 4837, 4648, 3994, 3433, 2947, 2078, 851, -103, -385, -266, -113, 186, 917, 1898, 2579, 2765, 2823, 2977, 2761, 1675, 116, -988, -1413, -1789, -2462, -2962, -2786, -2052, -1200, -489, 25, 335, 409, 198, -233, -698, -1213, -2051, -3107, -3700, -3443, -2849, -2532, -2341, -1816, -1001, -324, -55, -249, -889, -1785, -2563, -3045, -3454, -4003, -4464, -4427, -3816, -2802, -1462, -40, 878, 1059, 1104, 1545, 1935, 1491, 198, -1218, -2018, -1988, -1715, -2032, -2798, -2827, -1644, -325, 119, 157, 660, 1432, 1693, 1350, 1030, 1185, 1617, 1825, 1661, 1548, 1790, 1938, 1300, -30, -1374, -2551, -4068, -6108, -8026, -9010, -8836, -7683, -5575, -2325, 2030, 7044, 12053, 16417, 19501, 20736, 19954, 17492, 13810, 9100, 3579, -1996, -6526, -9285, -10207, -9422, -6910, -2822, 2236, 7476, 12403, 16690, 19864, 21631, 22327, 22578, 22470, 21669, 20232, 18821, 17915, 17219, 16038, 14084, 11853, 10011, 8540, 6988, 5689, 5729, 7373, 9778, 12576, 16405, 21284, 25985, 29493, 31721, 32767, 32660, 31621, 29516, 25783, 20772, 16075, 12660, 9995, 7622, 6282, 6780, 8860, 11709, 14753, 17786, 20685, 23165, 24731, 25107, 24598, 23637, 22184, 20089, 17711, 15594, 13742, 11811, 9868, 8371, 7310, 6099, 4571, 3386, 2988, 2909, 2726, 2906, 3974, 5476, 6627, 7290, 7717, 7883, 7582, 6663, 5036, 2810, 398, -1874, -3933, -5607, -6652, -7214, -7656, -7903, -7678, -7243, -7186, -7608, -8197, -8908, -9929, -11067, -11841, -12184, -12545, -13088, -13348, -12955, -12295, -12016, -12232, -12640, -13170, -14006, -15142, -16321, -17381, -18366, -19299, -20017, -20343, -20314, -20185, -20162, -20247, -20337, -20378, -20379, -20338, -20252, -20138, -20013, -19785, -19329, -18738, -18304, -18244, -18436, -18778, -19412, -20411, -21476, -22328, -23086, -23858, -24357, -24250, -23630, -22797, -21935, -21068, -20189, -19266, -18390, -17763, -17419, -17148, -16874, -16816, -17073, -17390, -17530, -17660, -18068, -18605, -18864, -18855, -18934, -19114, -18998, -18519, -18041, -17638, -16973, -15968, -14998, -14308, -13739, -13132, -12543, -12078, -11739, -11497, -11366, -11348, -11407, -11488, -11524, -11426, -11191, -10959, -10764, -10372, -9690, -9061, -8721, -8293, -7416, -6476, -6021, -5889, -5535, -4930, -4465, -4245, -4052, -3836, -3728, -3617, -3180, -2421, -1776, -1471, -1222, -738, -105, 449, 796, 817, 568, 363, 326, 233, 86, 233, 648, 975, 1378, 2284, 3425, 4231, 4807, 5435, 5801, 5728, 5753, 6074, 6020, 5318, 4719, 4749, 4962, 4875, 4641, 4529, 4476, 4403, 4428, 4595, 4749, 4840, 5073, 5583, 6211, 6806, 7412, 7970, 8270, 8371, 8500, 8440, 7746, 6609, 5717, 5201, 4558, 3629, 2902, 2738, 2925, 3158, 3463, 3915, 4392, 4887, 5583, 6311, 6518, 6176, 5940, 6017, 5794, 5010, 4259, 3858, 3379, 2602, 1941, 1657, 1516, 1295, 1025, 800, 784, 1145, 1714, 2062, 2075, 2133, 2510, 2956, 3066, 2819, 2502, 2209, 1801, 1273, 818, 477, 71, -431, -806, -867, -661, -377, -171, -54, 131, 534, 1057, 1441, 1565, 1541, 1528, 1582, 1624, 1494, 1127, 685, 410, 340, 374, 480, 650, 817, 1009, 1395, 1972, 2474, 2745, 2922, 3129, 3282, 3287, 3172, 2976, 2699, 2365, 1991, 1601, 1319, 1293, 1453, 1548, 1505, 1590, 2028, 2619, 2964, 2992, 3021, 3263, 3544, 3599, 3437, 3253, 3163, 3142, 3108, 3008, 2861, 2739, 2660, 2561, 2395, 2228, 2154, 2154, 2108, 1979, 1909, 2046, 2345, 2593, 2665, 2660, 2726, 2834, 2773, 2408, 1842, 1308, 909, 527, 24, -506, -777, -656, -328, 2, 406, 1022, 1681, 2029, 1970, 1765, 1665, 1590, 1267, 600, -151, -602, -663, -610, -685, -798, -731, -464, -173, -16, -16, -66, -55, -28, -125, -304, -325, -107, 154, 331, 522, 781, 972, 988, 842, 559, 199, -96, -283, -482, -724, -797, -507, 31, 565, 1005, 1445, 1967, 2475, 2752, 2689, 2413, 2136, 1887, 1570, 1203, 967, 974, 1138, 1320, 1509, 1781, 2117, 2373, 2437, 2363, 2300, 2354, 2519, 2735, 2969, 3276, 3772, 4500, 5347, 6090, 6592, 6911, 7167, 7349, 7304, 6968, 6507, 6174, 6039, 5959, 5809, 5649, 5621, 5742, 5886, 5942, 5941, 5975, 6049, 6057, 5979, 5978, 6191, 6515, 6760, 6945, 7216, 7589, 7967, 8276, 8433, 8307, 7893, 7374, 6879, 6393, 5919, 5526, 5273, 5219, 5480, 6108, 6984, 7933, 8834, 9617, 10246, 10741, 11076, 11087, 10679, 10009, 9325, 8739, 8245, 7854, 7559, 7324, 7196, 7266, 7510, 7768, 7962, 8171, 8482, 8830, 9089, 9263, 9498, 9848, 10147, 10212, 10147, 10221, 10434, 10449, 10069, 9507, 9071, 8814, 8594, 8298, 7905, 7476, 7169, 7129, 7320, 7570, 7792, 8053, 8421, 8826, 9134, 9307, 9388, 9375, 9206, 8871, 8440, 7977, 7468, 6858, 6136, 5385, 4734, 4255, 3911, 3611, 3330, 3137, 3112, 3262, 3478, 3617, 3637, 3624, 3667, 3691, 3498, 3026, 2475, 2058, 1710, 1217, 598, 73, -278, -606, -1000, -1379, -1647, -1802, -1915, -2083, -2357, -2657, -2869, -3036, -3296, -3650, -4003, -4331, -4675, -5032, -5366, -5676, -5945, -6125, -6229, -6333, -6454, -6533, -6556, -6603, -6747, -6952, -7157, -7369, -7653, -8036, -8482, -8936, -9359, -9724, -10023, -10306, -10600, -10854, -10973, -10932, -10805, -10687, -10612, -10568, -10529, -10501, -10512, -10588, -10742, -10950, -11150, -11286, -11372, -11488, -11652, -11802, -11893, -11959, -12037, -12104, -12153, -12216, -12298, -12323, -12259, -12169, -12124, -12103, -12045, -11955, -11904, -11935, -12032, -12157, -12271, -12342, -12362, -12390, -12437, -12437, -12319, -12121, -11947, -11822, -11683, -11460, -11168, -10890, -10701, -10569, -10404, -10238, -10216, -10363, -10521, -10585, -10654, -10838, -11075, -11218, -11231, -11183, -11086, -10874, -10542, -10164, -9771, -9334, -8874, -8491, -8218, -7978, -7726, -7553, -7539, -7589, -7557, -7457, -7445, -7571, -7710, -7744, -7714, -7697, -7678, -7599, -7466, -7326, -7176, -6968, -6705, -6458, -6257, -6053, -5800, -5527, -5293, -5114, -4949, -4760, -4577, -4465, -4432, -4392, -4303, -4245, -4276, -4315, -4286, -4205, -4099, -3956, -3807, -3708, -3608, -3417, -3178, -3003, -2887, -2777, -2707, -2720, -2749, -2719, -2659, -2633, -2611, -2524, -2370, -2193, -2013, -1814, -1589, -1346, -1101, -869, -686, -599, -611, -651, -652, -649, -714, -831, -908, -910, -894, -885, -850, -773, -667, -520, -337, -173, -38, 129, 349, 531, 619, 681, 792, 922, 988, 966, 907, 872, 868, 845, 770, 669, 605, 602, 651, 741, 849, 943, 1028, 1141, 1300, 1476, 1631, 1760, 1852, 1910, 1962, 2026, 2071, 2055, 1977, 1871, 1759, 1661, 1589, 1526, 1465, 1451, 1524, 1664, 1825, 1997, 2187, 2366, 2515, 2668, 2859, 3047, 3146, 3156, 3159, 3188, 3193, 3145, 3089, 3048, 2988, 2903, 2847, 2834, 2838, 2860, 2931, 3052, 3201, 3384, 3591, 3778, 3924, 4065, 4227, 4381, 4464, 4433, 4321, 4229, 4231, 4260, 4184, 3982, 3802, 3774, 3878, 4009, 4111, 4221, 4400, 4638, 4858, 5011, 5126, 5231, 5268, 5215, 5160, 5156, 5119, 5023, 4969, 5003, 5043, 5080, 5193, 5332, 5361, 5306, 5313, 5393, 5438, 5440, 5462, 5502, 5531, 5579, 5687, 5840, 5996, 6111, 6150, 6127, 6098, 6085, 6042, 5937, 5805, 5700, 5637, 5622, 5671, 5784, 5913, 6032, 6170, 6381, 6637, 6837, 6913, 6905, 6880, 6828, 6687, 6501, 6381, 6331, 6244, 6112, 6037, 6035, 6008, 5950, 5931, 5944, 5921, 5880, 5886, 5927, 5969, 6023, 6098, 6173, 6255, 6351, 6406, 6378, 6318, 6270, 6185, 6002, 5774, 5587, 5433, 5260, 5089, 4997, 4979, 4958, 4898, 4862, 4895, 4947, 4962, 4965, 4995, 5027, 5007, 4943, 4882, 4845, 4800, 4729, 4646, 4561, 4455, 4326, 4201, 4094, 3964, 3777, 3578, 3442, 3362, 3275, 3196, 3197, 3275, 3354, 3401, 3457, 3523, 3553, 3536, 3509, 3476, 3371, 3164, 2909, 2695, 2550, 2425, 2279, 2150, 2089, 2067, 2022, 1981, 1992, 2004, 1933, 1814, 1747, 1723, 1659, 1561, 1486, 1431, 1358, 1283, 1239, 1212, 1175, 1103, 976, 820, 694, 600, 455, 243, 53, -55, -136, -244, -356, -437, -499, -564, -634, -705, -769, -827, -893, -969, -1026, -1042, -1059, -1116, -1179, -1216, -1262, -1359, -1473, -1549, -1595, -1660, -1747, -1813, -1828, -1814, -1798, -1789, -1785, -1777, -1751, -1707, -1679, -1686, -1699, -1693, -1691, -1714, -1745, -1777, -1838, -1923, -1982, -1994, -2006, -2052, -2101, -2121, -2126, -2129, -2114, -2077, -2058, -2080, -2101, -2072, -2017, -1986, -1968, -1924, -1876, -1861, -1868, -1860, -1843, -1836, -1848, -1886, -1956, -2034, -2100, -2163, -2218, -2237, -2222, -2209, -2189, -2122, -2026, -1960, -1921, -1851, -1740, -1650, -1604, -1566, -1528, -1548, -1636, -1712, -1743, -1820, -1977, -2092, -2104, -2122, -2209, -2243, -2147, -2025, -1963, -1913, -1823, -1715, -1602, -1487, -1413, -1390, -1366, -1337, -1369, -1444, -1466, -1437, -1471, -1599, -1710, -1719, -1681, -1678, -1701, -1683, -1624, -1566, -1523, -1469, -1395, -1311, -1207, -1083, -977, -919, -879, -814, -747, -735, -790, -859, -900, -927, -987, -1074, -1139, -1149, -1125, -1104, -1083, -1046, -996, -931, -831, -703, -603, -560, -523, -445, -364, -350, -394, -416, -399, -420, -527, -653, -717, -731, -775, -858, -918, -914, -877, -854, -846, -830, -811, -818, -844, -844, -811, -798, -836, -884, -901, -927, -1005, -1093, -1142, -1179, -1261, -1375, -1463, -1512, -1557, -1611, -1657, -1673, -1664, -1653, -1652, -1645, -1629, -1629, -1658, -1698, -1737, -1795, -1877, -1956, -2038, -2158, -2306, -2425, -2503, -2599, -2725, -2808, -2808, -2761, -2727, -2733, -2760, -2770, -2750, -2739, -2782, -2858, -2910, -2943, -3024, -3171, -3310, -3387, -3437, -3512, -3588, -3626, -3654, -3708, -3740, -3711, -3680, -3696, -3703, -3659, -3628, -3640, -3630, -3574, -3539, -3568, -3614, -3636, -3665, -3717, -3762, -3783, -3791, -3805, -3808, -3775, -3715, -3659, -3634, -3618, -3579, -3505, -3426, -3384, -3387, -3396, -3373, -3315, -3258, -3225, -3207, -3190, -3161, -3122, -3078, -3041, -3015, -3001, -2984, -2959, -2932, -2901, -2854, -2803, -2761, -2724, -2674, -2613, -2566, -2520, -2445, -2347, -2279, -2270, -2289, -2289, -2249, -2184, -2117, -2059, -2002, -1934, -1851, -1765, -1695, -1639, -1583, -1540, -1519, -1504, -1459, -1383, -1308, -1246, -1188, -1126, -1049, -944, -843, -780, -740, -678, -603, -557, -518, -443, -349, -291, -253, -180, -76, 0, 32, 45, 70, 112, 154, 185, 203, 232, 291, 377, 463, 540, 629, 734, 831, 899, 949, 1007, 1065, 1099, 1102, 1090, 1080, 1076, 1076, 1083, 1100, 1148, 1231, 1336, 1431, 1497, 1551, 1611, 1664, 1692, 1714, 1751, 1776, 1775, 1775, 1797, 1819, 1834, 1860, 1877, 1842, 1783, 1777, 1819, 1826, 1780, 1750, 1773, 1819, 1863, 1912, 1976, 2037, 2064, 2060, 2050, 2057, 2083, 2104, 2101, 2075, 2045, 2024, 2010, 2008, 2024, 2047, 2047, 2016, 1991, 1999, 2022, 2034, 2038, 2051, 2068, 2072, 2079, 2116, 2176, 2225, 2257, 2291, 2317, 2308, 2278, 2270, 2276, 2258, 2216, 2182, 2153, 2121, 2118, 2170, 2240, 2288, 2324, 2373, 2431, 2486, 2537, 2578, 2583, 2550, 2499, 2465, 2456, 2457, 2458, 2462, 2483, 2520, 2560, 2587, 2604, 2622, 2652, 2687, 2715, 2732, 2752, 2776, 2788, 2792, 2810, 2859, 2903, 2910, 2888, 2878, 2885, 2880, 2859, 2855, 2881, 2910, 2921, 2921, 2927, 2944, 2964, 2979, 2981, 2972, 2951, 2922, 2897, 2881, 2878, 2882, 2892, 2897, 2889, 2863, 2830, 2798, 2773, 2756, 2752, 2736, 2689, 2631, 2607, 2611, 2594, 2544, 2503, 2493, 2474, 2423, 2362, 2325, 2308, 2278, 2221, 2159, 2124, 2113, 2096, 2058, 2008, 1966, 1920, 1866, 1817, 1784, 1761, 1729, 1672, 1595, 1527, 1490, 1476, 1441, 1381, 1324, 1285, 1240, 1186, 1148, 1134, 1124, 1100, 1073, 1042, 999, 954, 925, 911, 880, 826, 770, 737, 716, 688, 659, 644, 639, 627, 613, 614, 642, 684, 713, 709, 672, 634, 621, 619, 598, 540, 469, 422, 407, 401, 380, 353, 340, 344, 360, 380, 401, 417, 410, 384, 365, 380, 407, 406, 372, 347, 341, 326, 293, 277, 289, 286, 251, 207, 183, 172, 150, 123, 110, 119, 143, 160, 161, 156, 157, 176, 195, 199, 182, 153, 124, 102, 90, 89, 83, 57, 15, -20, -36, -41, -50, -62, -70, -72, -72, -59, -32, -3, 7, 0, -7, -12, -14, -20, -37, -67, -94, -96, -88, -97, -124, -140, -136, -142, -175, -212, -229, -236, -254, -275, -270, -245, -229, -232, -229, -215, -207, -221, -249, -263, -259, -265, -291, -323, -332, -331, -350, -389, -411, -412, -425, -466, -511, -528, -522, -515, -524, -545, -559, -557, -555, -565, -587, -602, -602, -611, -647, -693, -719, -728, -751, -790, -819, -825, -825, -839, -863, -880, -877, -865, -868, -894, -912, -902, -902, -944, -991, -996, -981, -998, -1042, -1068, -1072, -1075, -1088, -1108, -1122, -1114, -1087, -1070, -1083, -1103, -1103, -1092, -1096, -1112, -1110, -1092, -1075, -1074, -1081, -1084, -1084, -1079, -1067, -1052, -1056, -1080, -1097, -1080, -1041, -1014, -1022, -1041, -1031, -993, -968, -980, -992, -958, -898, -872, -897, -926, -914, -871, -834, -821, -826, -842, -855, -851, -829, -806, -793, -777, -755, -736, -724, -703, -668, -636, -623, -610, -587, -577, -595, -610, -586, -551, -555, -590, -601, -569, -541, -536, -526, -493, -465, -460, -454, -425, -398, -398, -396, -366, -335, -344, -378, -393, -387, -379, -374, -374, -391, -407, -395, -366, -364, -387, -400, -383, -360, -354, -366, -383, -393, -402, -420, -440, -440, -427, -425, -447, -468, -481, -499, -527, -544, -545, -547, -557, -573, -587, -599, -599, -594, -602, -628, -651, -639, -609, -603, -640, -681, -699, -703, -710, -719, -736, -765, -792, -798, -797, -814, -843, -856, -852, -856, -879, -905, -917, -917, -910, -901, -906, -939, -975, -980, -967, -979, -1008, -1018, -1026, -1067, -1121, -1138, -1130, -1143, -1179, -1195, -1192, -1203, -1229, -1237, -1228, -1242, -1283, -1305, -1287, -1267, -1271, -1271, -1254, -1249, -1254, -1241, -1216, -1220, -1249, -1257, -1242, -1246, -1279, -1296, -1271, -1241, -1236, -1240, -1225, -1209, -1213, -1214, -1192, -1164, -1143, -1120, -1093, -1087, -1091, -1072, -1031, -1001, -989, -979, -963, -947, -925, -893, -860, -831, -801, -771, -742, -714, -685, -656, -627, -593, -568, -560, -548, -515, -470, -439, -419, -396, -369, -340, -307, -267, -232, -208, -178, -126, -63, -11, 19, 33, 53, 93, 136, 170, 206, 253, 286, 293, 303, 336, 368, 380, 398, 430, 455, 481, 522, 555, 559, 577, 642, 716, 770, 828, 879, 863, 796, 755, 754, 734, 693, 675, 675, 656, 647, 689, 766, 828, 866, 903, 943, 978, 1008, 1037, 1054, 1042, 1005, 971, 958, 963, 979, 992, 979, 932, 876, 842, 824, 801, 780, 775, 792, 814, 831, 851, 878, 904, 918, 917, 909, 899, 876, 835, 789, 751, 714, 677, 655, 647, 631, 606, 598, 619, 644, 651, 648, 647, 647, 650, 656, 654, 622, 575, 531, 502, 477, 459, 453, 457, 448, 421, 398, 393, 390, 377, 367, 370, 382, 397, 413, 423, 422, 414, 403, 381, 349, 330, 335, 355, 373, 382, 378, 372, 382, 402, 409, 397, 394, 413, 438, 459, 471, 475, 476, 493, 529, 555, 559, 564, 589, 615, 622, 613, 610, 626, 659, 689, 689, 671, 666, 681, 693, 691, 687, 696, 718, 756, 799, 821, 816, 816, 846, 889, 909, 893, 850, 816, 828, 876, 903, 871, 826, 825, 857, 867, 839, 813, 821, 850, 863, 853, 838, 841, 858, 884, 917, 941, 933, 893, 855, 854, 875, 888, 878, 857, 841, 833, 834, 833, 812, 772, 731, 712, 723, 750, 762, 749, 735, 750, 772, 764, 735, 721, 730, 730, 704, 671, 651, 637, 614, 596, 598, 610, 610, 597, 583, 573, 569, 572, 573, 551, 509, 473, 460, 456, 444, 431, 422, 414, 393, 367, 348, 338, 322, 289, 251, 220, 207, 207, 208, 202, 187, 181, 187, 189, 169, 133, 106, 93, 75, 40, -4, -34, -46, -55, -74, -100, -116, -116, -113, -125, -146, -154, -146, -144, -163, -184, -190, -180, -184, -216, -262, -296, -304, -307, -332, -368, -391, -407, -424, -425, -398, -375, -386, -403, -395, -385, -404, -432, -433, -415, -420, -458, -494, -497, -479, -485, -520, -561, -580, -577, -576, -581, -581, -580, -586, -598, -599, -587, -576, -580, -591, -589, -566, -540, -523, -515, -506, -499, -507, -528, -548, -547, -531, -527, -545, -564, -556, -524, -487, -460, -448, -454, -460, -447, -425, -419, -425, -433, -439, -436, -414, -389, -394, -424, -439, -419, -400, -416, -441, -436, -402, -375, -373, -377, -366, -348, -341, -345, -341, -331, -327, -332, -332, -328, -340, -360, -361, -344, -336, -344, -352, -352, -354, -365, -375, -378, -375, -369, -370, -382, -383, -364, -342, -344, -360, -370, -371, -371, -371, -373, -378, -387, -393, -394, -402, -418, -432, -437, -447, -458, -454, -436, -441, -479, -494, -453, -407, -415, -449, -453, -427, -414, -419, -423, -420, -429, -449, -457, -450, -453, -476, -497, -495, -481, -470, -473, -482, -491, -495, -499, -510, -519, -510, -482, -468, -491, -523, -508, -458, -439, -462, -479, -466, -466, -495, -512, -498, -486, -493, -493, -474, -464, -465, -456, -431, -411, -406, -399, -385, -377, -389, -403, -403, -399, -404, -411, -407, -399, -398, -395, -378, -358, -353, -354, -341, -310, -286, -279, -279, -279, -285, -285, -265, -240, -237, -248, -241, -209, -183, -179, -188, -190, -177, -157, -145, -144, -140, -132, -128, -125, -117, -105, -99, -103, -108, -104, -97, -97, -99, -90, -79, -82, -87, -74, -45, -22, -9, -1, -12, -40, -53, -41, -38, -65, -91, -86, -65, -59, -72, -83, -72, -42, -18, -17, -13, 16, 45, 37, 12, 12, 24, 6, -38, -62, -57, -54, -68, -72, -61, -58, -78, -88, -75, -63, -65, -54, -26, -14, -17, -1, 23, 20, -3, -12, -7, -12, -22, -29, -40, -55, -51, -21, -3, -22, -42, -24, 8, 6, -18, -16, 16, 29, 17, 17, 29, 25, 12, 19, 36, 28, 0, -11, 0, 16, 23, 25, 31, 41, 44, 35, 27, 37, 56, 61, 53, 53, 61, 67, 81, 102, 106, 86, 69, 78, 89, 74, 54, 64, 96, 124, 136, 145, 143, 115, 99, 135, 185, 179, 131, 114, 147, 170, 160, 157, 185, 211, 208, 204, 228, 268, 295, 310, 320, 314, 289, 278, 291, 301, 295, 295, 299, 284, 264, 276, 309, 323, 315, 315, 339, 374, 405, 417, 406, 388, 380, 380, 378, 381, 390, 398, 405, 421, 442, 452, 453, 457, 460, 449, 432, 431, 444, 455, 451, 446, 446, 443, 436, 436, 440, 432, 415, 415, 427, 423, 411, 422, 440, 434, 413, 406, 410, 406, 407, 419, 413, 382, 361, 372, 388, 384, 372, 364, 359, 353, 359, 377, 382, 363, 339, 332, 331, 313, 289, 281, 284, 281, 278, 278, 276, 265, 262, 273, 293, 314, 323, 306, 282, 281, 294, 285, 257, 248, 258, 256, 243, 247, 268, 277, 264, 244, 232, 228, 232, 240, 247, 255, 268, 281, 277, 257, 243, 245, 241, 223, 222, 253, 281, 272, 261, 274, 277, 253, 240, 262, 278, 260, 233, 228, 237, 241, 240, 241, 244, 243, 245, 255, 262, 265, 276, 297, 310, 305, 299, 302, 299, 289, 285, 291, 287, 266, 258, 280, 311, 319, 302, 287, 303, 336, 347, 327, 306, 302, 303, 305, 322, 349, 353, 331, 315, 315, 294, 240, 206, 232, 276, 269, 226, 210, 226, 220, 185, 166, 182, 193, 182, 173, 179, 185, 187, 195, 203, 206, 203, 202, 201, 198, 194, 182, 164, 148, 139, 135, 132, 127, 119, 114, 123, 143, 150, 144, 143, 157, 168, 162, 152, 140, 120, 95, 86, 93, 99, 95, 86, 81, 82, 87, 94, 103, 118, 129, 131, 127, 122, 106, 71, 40, 42, 65, 70, 53, 36, 27, 19, 17, 25, 27, 13, 2, -1, -13, -34, -38, -13, 2, -25, -71, -82, -61, -58, -80, -87, -67, -59, -87, -115, -115, -96, -84, -94, -117, -144, -161, -161, -154, -155, -171, -191, -195, -179, -163, -167, -183, -198, -207, -209, -205, -203, -221, -246, -242, -213, -209, -246, -274, -256, -224, -231, -263, -274, -261, -263, -288, -298, -277, -258, -259, -259, -252, -254, -277, -294, -291, -279, -278, -286, -294, -288, -273, -261, -265, -273, -270, -257, -254, -273, -298, -304, -287, -262, -242, -232, -237, -254, -266, -266, -258, -248, -233, -229, -246, -270, -279, -282, -285, -274, -252, -254, -287, -306, -275, -220, -188, -199, -241, -281, -278, -249, -246, -283, -311, -299, -277, -281, -296, -290, -261, -237, -232, -244, -262, -277, -278, -266, -257, -262, -277, -283, -270, -246, -225, -221, -232, -245, -254, -265, -279, -283, -266, -253, -267, -295, -307, -294, -277, -267, -265, -263, -258, -258, -273, -298, -315, -312, -304, -308, -321, -325, -317, -315, -321, -324, -319, -316, -315, -298, -274, -271, -290, -295, -281, -274, -288, -299, -282, -257, -256, -283, -316, -324, -304, -286, -296, -324, -332, -302, -252, -217, -221, -252, -263, -236, -203, -212, -256, -287, -291, -292, -303, -304, -283, -256, -236, -223, -213, -216, -231, -231, -203, -177, -188, -225, -233, -200, -170, -173, -187, -183, -166, -159, -154, -144, -136, -128, -109, -95, -100, -101, -70, -36, -34, -51, -66, -96, -132, -116, -41, 17, 12, -13, -9, 11, 6, -25, -46, -45, -37, -33, -26, -17, -13, -9, 6, 35, 58, 67, 64, 50, 33, 24, 35, 52, 54, 50, 64, 81, 62, 28, 35, 75, 89, 78, 87, 100, 69, 16, 0, 15, 27, 37, 46, 50, 73, 128, 154, 100, 39, 58, 124, 140, 95, 53, 40, 40, 50, 75, 99, 102, 90, 82, 74, 58, 49, 64, 77, 54, 25, 45, 112, 160, 158, 141, 135, 122, 87, 66, 83, 99, 79, 57, 66, 77, 57, 31, 11, -13, -14, 40, 95, 86, 65, 104, 160, 165, 156, 157, 124, 56, 28, 49, 50, 33, 50, 78, 74, 74, 107, 123, 94, 66, 56, 39, 41, 91, 124, 104, 98, 127, 110, 33, 2, 37, 44, 3, -7, 13, -3, -54, -79, -65, -32, 11, 39, 21, 0, 46, 158, 253, 277, 243, 172, 74, -1, -1, 45, 48, -14, -49, -8, 40, 56, 103, 203, 252, 182, 86, 74, 123, 154, 168, 206, 245, 230, 191, 206, 261, 273, 240, 239, 280, 303, 305, 323, 339, 295, 204, 140, 131, 141, 122, 74, 69, 157, 266, 301, 295, 353, 439, 431, 361, 351, 370, 316, 243, 276, 370, 381, 294, 211, 170, 145, 119, 99, 93, 110, 158, 206, 215, 190, 157, 136, 128, 132, 141, 133, 103, 78, 85, 106, 95, 56, 37, 62, 66, -21, -159, -236, -225, -211, -234, -227, -137, -45, -50, -94, -51, 52, 58, -55, -124, -53, 33, 20, -8, 71, 207, 257, 214, 185, 186, 129, 12, -54, 0, 190, 602, 1281, 2005, 2436, 2525, 2544, 2744, 3138, 3466, 3317, 2531, 1518, 829, 453, -21, -585, -684, -145, 374, 298, 31, 294, 922, 1138, 864, 789, 1244, 1884, 2502, 3242, 3986, 4306, 4136, 3845, 3545, 2868, 1668, 481, -33, 145, 521, 741, 825, 868, 888, 896, 828, 455, -277, -886, -785, -130, 293, 197, 118, 442, 821, 863, 673, 424, 57, -324, -410, -208, -144, -444, -834, -980, -951, -1062, -1400, -1714, -1744, -1508, -1240, -1135, -1192, -1225, -1100, -925, -885, -962, -992, -919, -753, -447, -58, 122, -108, -593, -1051, -1429, -1830, -2238, -2503, -2507, -2266, -1903, -1604, -1495, -1506, -1424, -1182, -1010, -1147, -1427, -1399, -877, -180, 269, 392, 398, 386, 162, -472, -1342, -1971, -2058, -1673, -954, 29, 983, 1364, 953, 133, -594, -1076, -1346, -1388, -1192, -775, -105, 787, 1760, 2669, 3282, 3208, 2385, 1379, 637, -87, -898, -1175, -628, -9, 29, -208, -414, -925, -1838, -2540, -2628, -2351, -1820, -686, 1048, 2618, 3275, 3089, 2694, 2448, 2215, 1902, 1804, 2200, 2896, 3429, 3562, 3291, 2561, 1365, 58, -789, -988, -886, -792, -518, 206, 1142, 1797, 2062, 2059, 1586, 402, -1033, -1895, -2036, -1992, -2036, -1915, -1449, -871, -526, -510, -581, -402, -25, 118, -96, -256, -128, -46, -270, -628, -1037, -1665, -2420, -2978, -3325, -3637, -3762, -3517, -3207, -3259, -3555, -3691, -3592, -3496, -3497, -3391, -2879, -1981, -1184, -868, -698, -191, 261, -216, -1618, -3011, -3865, -4447, -4805, -4323, -2644, -429, 1146, 1451, 770, -252, -1429, -2978, -4646, -5505, -4991, -3649, -2413, -1568, -863, -216, 140, 15, -433, -643, -46, 1258, 2568, 3430, 4034, 4480, 4283, 3027, 1158, -419, -1313, -1701, -1611, -880, 183, 966, 1456, 2046, 2425, 1898, 694, -286, -814, -1126, -948, -33, 1058, 1780, 2356, 2956, 3220, 2977, 2403, 1536, 745, 1007, 2537, 4117, 4779, 4935, 5144, 5305, 5415, 5526, 4968, 3251, 1295, 208, -379, -1341, -2417, -2858, -2727, -2500, -2159, -1449, -432, 704, 1898, 2917, 3303, 3030, 2763, 2886, 2807, 1964, 880, 262, -219, -1072, -1769, -1656, -1229, -1262, -1471, -1109, -212, 588, 954, 990, 917, 914, 1017, 1198, 1482, 1702, 1397, 597, 102, 145, -166, -1080, -1411, -626, 281, 853, 1548, 1702, 222, -1794, -2509, -2494, -3044, -3272, -2255, -1378, -1424, -590, 1977, 4200, 4609, 4395, 4482, 3899, 2116, 286, -591, -922, -1431, -2046, -2245, -1943, -1740, -2287, -3509, -4560, -4602, -3613, -2349, -1373, -395, 992, 2454, 3461, 4090, 4304, 3300, 763, -2144, -4214, -5643, -7029, -8006, -7972, -7236, -6469, -5748, -4805, -3765, -3065, -2800, -2447, -1437, -113, 386, -328, -1205, -1312, -1243, -1950, -3081, -3620, -3312, -2598, -1921, -1643, -1731, -1398, -121, 1239, 1549, 1179, 1269, 1677, 1146, -601, -2295, -2864, -2662, -2432, -1998, -884, 430, 942, 615, 471, 1323, 2996, 4630, 5576, 6123, 6965, 7678, 6820, 4127, 1054, -1566, -4409, -7587, -10007, -11202, -11476, -10357, -7373, -3754, -995, 1254, 3861, 6471, 8533, 10040, 10412, 8969, 6627, 4741, 2973, 640, -1324, -2164, -3076, -4871, -5892, -4429, -1469, 785, 1869, 3160, 5684, 8670, 10254, 9523, 7581, 6178, 5587, 4670, 2989, 1726, 2004, 3160, 3687, 3394, 3357, 3905, 4177, 3886, 3936, 4817, 5765, 6044, 5866, 5554, 4820, 3409, 1725, 294, -1033, -2782, -4630, -5067, -2974, 692, 3870, 5938, 7996, 10468, 12052, 11758, 10493, 9473, 8187, 5491, 1987, -616, -2364, -5003, -8748, -11472, -11883, -11174, -10593, -9534, -7059, -3521, 77, 3076, 5210, 6548, 7349, 7468, 6369, 4154, 1871, 315, -879, -2374, -3888, -4676, -4887, -5306, -5835, -5560, -4447, -3597, -3483, -3258, -2125, -370, 1150, 1805, 1473, 590, -203, -826, -1839, -3500, -5107, -5709, -5247, -4405, -3559, -2591, -1624, -968, -449, 90, -61, -1469, -3084, -3373, -2584, -2292, -3045, -3865, -3769, -2706, -1253, -57, 655, 1196, 1805, 2292, 2607, 2901, 2795, 1856, 763, 276, -474, -2520, -4789, -5739, -5767, -5679, -4977, -3759, -3388, -3499, -1869, 1511, 4110, 5099, 6023, 7175, 7149, 5747, 4131, 2556, 481, -1726, -3178, -3935, -4674, -5343, -5287, -4471, -3495, -2383, -477, 2089, 4010, 4478, 4202, 4198, 4537, 4566, 3646, 1730, -310, -1485, -2018, -2778, -3578, -3614, -3180, -3002, -2559, -1103, 490, 963, 825, 1389, 2591, 3421, 3596, 3465, 2944, 1688, -42, -1503, -2332, -2748, -2916, -2620, -1672, -273, 1213, 2466, 3064, 2677, 1611, 729, 515, 526, 10, -1101, -2112, -2407, -2101, -1686, -1266, -623, 66, 204, -366, -1097, -1488, -1500, -1207, -740, -436, -320, 91, 787, 917, 216, -379, -332, -432, -1295, -2169, -2054, -1022, 119, 781, 920, 929, 1190, 1462, 1128, 170, -663, -967, -1283, -2372, -4272, -6111, -6740, -5917, -4688, -3779, -2283, 621, 3724, 5539, 6548, 7453, 7200, 5190, 3076, 2034, 863, -1294, -3240, -4203, -5074, -6092, -6061, -4675, -3186, -2151, -562, 2055, 4354, 4844, 3957, 3292, 3378, 3291, 2323, 885, -296, -1074, -1805, -2841, -4019, -4534, -3697, -1902, -345, 405, 1000, 2159, 3463, 3938, 3390, 2300, 783, -1319, -3433, -4508, -4307, -3543, -2791, -2076, -1515, -1366, -1291, -582, 456, 552, -400, -688, 602, 1872, 1485, 340, 223, 1015, 1203, 116, -1515, -2432, -1973, -968, -1005, -2246, -3151, -2974, -2719, -3032, -3186, -2648, -1681, -282, 1628, 3228, 3714, 3606, 3740, 3868, 3371, 2298, 968, -352, -1145, -1126, -977, -1508, -2513, -3265, -3435, -2907, -1691, -379, 322, 535, 755, 972, 1163, 1736, 2536, 2593, 1675, 677, 32, -647, -1088, -394, 1149, 1992, 1373, 132, -632, -789, -960, -1561, -2101, -1716, -562, 212, 281, 486, 928, 646, -227, -307, 459, 525, -495, -1266, -1134, -831, -807, -861, -1113, -1648, -1695, -599, 853, 1278, 575, 11, 506, 1530, 1983, 1664, 1225, 845, -101, -1730, -2981, -2993, -2347, -2086, -2047, -1233, 473, 2087, 3077, 4031, 5277, 5956, 5302, 3849, 2315, 461, -1813, -3516, -3894, -3433, -2623, -1307, 183, 1001, 1291, 1930, 2756, 2761, 1884, 1051, 738, 666, 538, 253, -246, -790, -988, -644, 66, 814, 1302, 1416, 1328, 1246, 987, 115, -1351, -2615, -2771, -1689, -28, 1495, 2579, 3150, 3134, 2578, 1705, 668, -564, -1880, -2770, -2731, -1853, -723, 203, 747, 808, 530, 353, 287, -360, -1784, -2907, -2760, -1944, -1582, -1388, -125, 2197, 3998, 4275, 3840, 3745, 3603, 2523, 838, -317, -649, -801, -1201, -1631, -1731, -1440, -1018, -723, -400, 248, 1021, 1461, 1680, 2071, 2457, 2595, 3035, 4158, 4991, 4442, 3100, 2287, 1891, 731, -1114, -2108, -1616, -1010, -1575, -2575, -2603, -1830, -1494, -1772, -1590, -267, 1648, 3035, 3288, 2944, 2964, 3187, 2495, 849, -345, -412, -136, 61, 588, 1069, 423, -1209, -2549, -3204, -3836, -4485, -4339, -3186, -1730, -395, 1019, 2313, 2698, 2158, 1846, 2367, 2761, 2128, 1186, 1145, 1917, 2441, 2103, 1102, -55, -863, -1081, -1088, -1583, -2604, -3214, -2615, -1254, -207, 204, 473, 833, 1049, 1239, 1938, 3143, 4031, 4043, 3612, 3326, 2876, 1460, -985, -3637, -5758, -7163, -7581, -6444, -3939, -1409, 176, 1416, 3102, 4597, 4891, 4231, 3357, 2196, 585, -954, -2167, -3560, -5265, -6573, -6873, -6037, -4224, -2262, -1338, -1445, -1216, -7, 1192, 1461, 1187, 1179, 1717, 2684, 3716, 4267, 4105, 3517, 2709, 1576, 220, -1002, -1965, -2712, -3067, -2947, -2749, -2802, -2729, -1968, -648, 493, 937, 750, 315, -59, -223, -16, 750, 1930, 2939, 3444, 3830, 4408, 4630, 3889, 2539, 1266, 79, -1214, -2293, -2795, -2810, -2434, -1678, -954, -689, -479, 373, 1582, 2141, 1804, 1358, 1411, 1764, 2191, 3052, 4574, 6046, 6469, 5728, 4499, 3151, 1439, -797, -3142, -4894, -5646, -5532, -4855, -3496, -1199, 1535, 3619, 4673, 5231, 5505, 5022, 3662, 1945, 206, -1503, -2886, -3638, -3871, -3611, -2600, -1141, -196, -179, -519, -685, -752, -890, -1114, -1445, -1727, -1633, -1197, -840, -798, -1117, -1968, -3193, -4077, -4350, -4513, -4542, -3557, -1523, 208, 774, 768, 871, 961, 1001, 1415, 2083, 2034, 619, -1544, -3109, -3310, -2615, -2098, -2283, -2756, -2878, -2565, -2176, -1810, -1079, 231, 1660, 2587, 2851, 2450, 1216, -561, -1882, -2144, -1848, -1581, -1135, -217, 799, 1427, 1680, 1668, 1260, 638, 601, 1676, 3220, 4051, 3712, 2461, 434, -2185, -4515, -5580, -5365, -4401, -2804, -580, 1794, 3811, 5346, 6181, 5876, 4487, 2694, 1037, -408, -1619, -2490, -3048, -3421, -3600, -3451, -2891, -1951, -769, 501, 1779, 2942, 3675, 3715, 3297, 3085, 3329, 3329, 2254, 427, -901, -1180, -1074, -1116, -960, -414, -61, -231, -353, 49, 583, 855, 1312, 2371, 3363, 3301, 2402, 1667, 1171, 37, -1831, -3317, -3588, -2976, -2166, -1415, -649, 307, 1560, 2799, 3382, 3008, 2085, 1202, 571, 231, 356, 937, 1430, 1295, 776, 471, 247, -632, -2177, -3344, -3456, -3144, -3146, -2941, -1687, -1, 644, 156, -71, 626, 1315, 1156, 666, 677, 980, 775, -95, -1110, -1895, -2374, -2455, -2274, -2262, -2341, -1762, -428, 602, 558, -202, -1172, -2213, -2882, -2695, -2092, -1805, -1466, -171, 1843, 3312, 3577, 3062, 2204, 896, -802, -2249, -2984, -3360, -3898, -4475, -4656, -4392, -3823, -2761, -1062, 638, 1436, 1494, 1933, 3149, 4251, 4532, 4263, 3749, 2917, 1954, 975, -599, -2872, -4612, -5069, -5179, -5540, -5106, -3276, -1162, 344, 1623, 2807, 3316, 3167, 3009, 2923, 2614, 2196, 1786, 1142, 419, 326, 1053, 1921, 2334, 2344, 2265, 2288, 2350, 2060, 999, -648, -2169, -3211, -4169, -5393, -6412, -6412, -5274, -3617, -1834, 276, 2768, 5004, 6291, 6664, 6568, 6027, 4725, 2842, 1107, -14, -665, -1110, -1525, -2233, -3451, -4733, -5291, -5094, -4921, -5002, -4381, -2436, -138, 1265, 1984, 2685, 2853, 1947, 1016, 1220, 1821, 1499, 556, 119, 214, 60, -543, -1122, -1246, -764, 139, 830, 650, -304, -1186, -1444, -1504, -2025, -2768, -2882, -2235, -1652, -1561, -1168, 436, 2890, 4973, 6082, 6432, 6086, 4749, 2664, 714, -703, -2115, -3745, -4664, -3986, -2411, -1508, -1618, -1532, -404, 1090, 1904, 2060, 2280, 2740, 2961, 2714, 2229, 1491, 62, -2042, -3836, -4220, -3127, -1412, 170, 1430, 2273, 2386, 1615, 313, -975, -2011, -2825, -3323, -3210, -2296, -772, 897, 2334, 3408, 4056, 4121, 3529, 2445, 1119, -244, -1348, -1886, -1839, -1375, -580, 347, 968, 1204, 1466, 1725, 1319, 243, -510, -483, -341, -336, 377, 2108, 3600, 3588, 2518, 1796, 1748, 1223, -676, -3135, -4459, -4040, -2869, -2009, -1246, 284, 2511, 4208, 4482, 3862, 3357, 2975, 1962, 268, -1158, -1652, -1599, -1612, -1622, -1333, -1045, -1251, -1677, -1496, -511, 654, 1495, 2064, 2547, 2986, 3395, 3708, 3776, 3573, 3143, 2350, 1163, -12, -826, -1549, -2546, -3455, -3572, -2903, -2122, -1399, -49, 2298, 4864, 6613, 7283, 7000, 5738, 3837, 2138, 997, 49, -772, -1103, -1089, -1287, -1706, -2075, -2699, -3949, -5219, -5393, -4097, -1791, 990, 3826, 6073, 7082, 6838, 5902, 4587, 2644, 31, -2465, -3885, -4199, -4251, -4642, -5178, -5376, -4959, -3787, -1849, 406, 2336, 3822, 5168, 6153, 5932, 4225, 1968, 311, -603, -1432, -2526, -3582, -4253, -4589, -4656, -4216, -3122, -1805, -865, -299, 370, 1290, 2138, 2755, 3254, 3512, 3185, 2325, 1331, 202, -1552, -4048, -6501, -7822, -7477, -5604, -2729, 323, 2661, 3956, 4482, 4288, 2992, 808, -1072, -1666, -1063, 218, 1793, 3009, 2955, 1422, -764, -2706, -4216, -5381, -5928, -5523, -4346, -2850, -1112, 1029, 3156, 4318, 4215, 3710, 3595, 3420, 2338, 658, -523, -996, -1604, -2704, -3518, -3265, -2130, -785, 335, 933, 693, -175, -834, -935, -1261, -2554, -4376, -5835, -6570, -6344, -4757, -2176, 78, 1307, 2212, 3415, 4121, 3226, 1141, -568, -1077, -858, -448, 203, 1024, 1460, 1194, 434, -773, -2702, -5048, -6653, -6735, -5746, -4313, -2139, 1001, 4077, 5886, 6555, 6608, 5576, 3022, 12, -1940, -2708, -3098, -3298, -2915, -2081, -1394, -925, -329, 158, -46, -574, -306, 828, 1577, 1196, 313, -395, -1121, -2166, -3152, -3406, -2600, -881, 1216, 2905, 3546, 3122, 2188, 1287, 531, -103, -352, 108, 1096, 1943, 2132, 1656, 706, -710, -2570, -4353, -5135, -4380, -2468, -217, 1963, 4130, 6129, 7361, 7382, 6448, 5111, 3474, 1245, -1470, -3933, -5405, -5705, -5110, -4027, -2699, -917, 1581, 4169, 5431, 4766, 3213, 2129, 1714, 1395, 1069, 1223, 2063, 3034, 3289, 2402, 677, -1010, -1878, -2023, -2225, -2565, -1972, 50, 2211, 3023, 2640, 1954, 1070, -150, -1195, -1656, -1847, -2000, -1855, -1419, -1120, -1039, -764, 66, 1510, 3249, 4505, 4625, 3841, 2840, 1685, -22, -2167, -4110, -5436, -6150, -6418, -6353, -5582, -3347, 190, 3466, 5257, 5898, 5811, 4483, 2012, -220, -1535, -2694, -3896, -4087, -3036, -2130, -2341, -2995, -3225, -3330, -3945, -4688, -4486, -2918, -536, 1887, 3786, 4723, 4607, 3790, 2560, 1048, -265, -918, -1344, -2221, -3115, -3167, -2786, -3134, -4127, -4429, -3368, -1647, -53, 1445, 3022, 4298, 4856, 4800, 4301, 3268, 1984, 1202, 1128, 1202, 1202, 1410, 1576, 1050, 42, -586, -825, -1485, -2596, -2987, -1777, 546, 2864, 4600, 5703, 5932, 4954, 3156, 1638, 1127, 1299, 1376, 1076, 774, 828, 1033, 928, 501, 144, -74, -327, -282, 556, 1780, 2477, 2652, 2918, 3046, 2320, 1133, 708, 1306, 2033, 2348, 2633, 3134, 3326, 2678, 1374, -108, -1549, -2645, -2775, -1691, 91, 1946, 3455, 4059, 3358, 1879, 482, -765, -2172, -3350, -3658, -3165, -2274, -1039, 415, 1444, 1561, 1113, 750, 594, 363, -11, -295, -348, -182, 178, 435, -170, -2036, -4284, -5391, -4834, -3437, -2072, -777, 573, 1523, 1568, 991, 435, -86, -1020, -2168, -2580, -1838, -724, -144, 13, 220, 224, -425, -1295, -1568, -1299, -1116, -958, -221, 1011, 1881, 1893, 1319, 392, -987, -2479, -3094, -2357, -1093, -336, 70, 957, 2240, 2819, 2154, 982, 202, -134, -308, -228, 116, 245, -104, -482, -503, -540, -979, -1336, -876, 191, 983, 1253, 1573, 2141, 2382, 2005, 1499, 1261, 1049, 589, 27, -403, -664, -877, -1261, -1831, -2097, -1566, -499, 449, 1140, 1831, 2427, 2558, 2240, 1796, 1285, 563, -229, -806, -1362, -2370, -3596, -4098, -3545, -2673, -2048, -1354, -369, 419, 638, 492, 197, -154, -265, 0, 206, 42, -84, 156, 258, -393, -1549, -2507, -3171, -3910, -4564, -4469, -3530, -2321, -1031, 563, 2058, 2627, 2324, 1893, 1440, 547, -669, -1741, -2561, -3048, -2870, -2158, -1625, -1516, -1291, -657, -74, 37, -159, -350, -487, -539, -292, 261, 640, 394, -290, -879, -1208, -1436, -1427, -785, 438, 1607, 2242, 2487, 2660, 2709, 2444, 2029, 1758, 1509, 908, 106, -200, 214, 626, 361, -256, -543, -497, -493, -439, 6, 755, 1499, 2224, 3015, 3700, 3977, 3691, 2917, 1993, 1347, 1025, 663, 71, -457, -591, -345, 39, 278, 147, -265, -439, 90, 1157, 2111, 2485, 2344, 2046, 1847, 1715, 1452, 958, 348, -123, -99, 702, 2014, 2977, 3060, 2715, 2554, 2328, 1482, 319, -324, -340, -381, -753, -1022, -815, -307, 306, 1175, 2278, 3092, 3222, 2867, 2270, 1260, -153, -1326, -1714, -1637, -1769, -2108, -2027, -1250, -267, 285, 330, 198, 33, -278, -736, -1133, -1392, -1668, -2006, -2171, -1951, -1488, -1114, -964, -979, -1179, -1632, -2146, -2288, -1855, -1095, -356, 237, 608, 514, -208, -1362, -2570, -3687, -4701, -5368, -5330, -4670, -3917, -3385, -2833, -1969, -906, 35, 671, 883, 529, -287, -1089, -1539, -1885, -2520, -3263, -3614, -3534, -3383, -3175, -2559, -1615, -1017, -1179, -1753, -2254, -2728, -3400, -4014, -4048, -3388, -2370, -1313, -445, -75, -306, -678, -641, -400, -744, -1863, -2961, -3347, -3259, -3189, -3043, -2573, -2001, -1632, -1317, -842, -352, -49, 169, 438, 617, 548, 345, 153, -158, -722, -1325, -1723, -2009, -2201, -1885, -879, 148, 472, 365, 708, 1854, 3345, 4503, 4918, 4608, 3882, 2931, 1664, 100, -1304, -2060, -2208, -2152, -1976, -1320, -59, 1282, 2076, 2315, 2490, 2910, 3467, 4046, 4733, 5505, 6010, 5917, 5290, 4408, 3454, 2579, 1856, 1098, 197, -353, 6, 965, 1773, 2391, 3274, 4293, 4891, 5040, 5193, 5484, 5695, 5790, 5911, 6010, 5873, 5425, 4803, 4190, 3707, 3379, 3093, 2623, 1914, 1271, 1065, 1240, 1395, 1391, 1603, 2456, 3881, 5398, 6564, 7224, 7370, 7012, 6233, 5234, 4167, 2997, 1652, 326, -493, -411, 443, 1506, 2321, 2913, 3502, 4049, 4240, 3844, 2938, 1851, 1011, 787, 1291, 2275, 3316, 4103, 4434, 4069, 2964, 1627, 700, 123, -668, -1643, -2029, -1454, -516, 56, 230, 385, 714, 1174, 1693, 2108, 2130, 1693, 1119, 654, 91, -797, -1770, -2468, -2907, -3167, -2957, -2022, -719, 258, 609, 484, 8, -856, -1981, -3048, -3917, -4643, -5046, -4799, -3998, -3150, -2505, -1907, -1329, -1014, -1103, -1528, -2195, -2955, -3547, -3784, -3670, -3321, -2982, -2962, -3251, -3429, -3252, -3041, -3184, -3546, -3709, -3520, -3172, -2920, -2848, -2812, -2638, -2384, -2254, -2214, -2051, -1790, -1677, -1760, -1936, -2292, -2916, -3546, -3836, -3758, -3381, -2608, -1511, -553, -161, -286, -557, -663, -611, -784, -1528, -2558, -3063, -2656, -1906, -1589, -1687, -1525, -778, 65, 352, 95, -107, 133, 565, 737, 625, 627, 1028, 1661, 2111, 2122, 1833, 1623, 1648, 1613, 1212, 679, 530, 880, 1393, 1815, 2155, 2473, 2867, 3469, 4184, 4641, 4628, 4325, 3977, 3632, 3289, 3022, 2863, 2802, 2921, 3325, 3968, 4611, 4991, 5033, 4882, 4686, 4359, 3737, 2994, 2586, 2674, 2951, 3139, 3320, 3636, 4047, 4462, 4845, 5109, 5132, 4894, 4416, 3743, 3056, 2614, 2487, 2543, 2627, 2576, 2259, 1877, 1854, 2194, 2365, 2047, 1535, 1211, 1134, 1267, 1592, 1943, 2097, 2038, 1875, 1594, 1179, 752, 385, -41, -624, -1261, -1737, -1926, -1839, -1599, -1311, -968, -555, -208, -128, -358, -813, -1436, -2181, -2895, -3429, -3838, -4278, -4666, -4714, -4413, -4206, -4448, -4903, -5077, -4882, -4634, -4512, -4369, -4101, -3856, -3862, -4166, -4623, -5075, -5474, -5880, -6396, -7043, -7693, -8112, -8164, -7911, -7504, -7047, -6561, -6057, -5623, -5443, -5617, -6017, -6437, -6829, -7226, -7492, -7469, -7272, -7164, -7147, -7027, -6782, -6589, -6540, -6590, -6751, -7088, -7507, -7773, -7806, -7743, -7625, -7290, -6706, -6183, -5986, -5958, -5776, -5444, -5295, -5524, -5978, -6403, -6680, -6773, -6698, -6610, -6652, -6692, -6490, -6097, -5763, -5522, -5227, -4858, -4504, -4240, -4210, -4506, -4818, -4662, -4116, -3823, -4122, -4623, -4771, -4481, -4093, -3907, -3953, -4045, -3964, -3584, -2960, -2314, -1913, -1844, -1938, -1969, -1952, -2114, -2570, -3081, -3275, -3052, -2646, -2247, -1769, -1117, -494, -216, -295, -461, -572, -794, -1279, -1813, -1977, -1644, -1130, -786, -586, -345, -169, -328, -707, -802, -340, 372, 801, 709, 340, 235, 710, 1493, 2057, 2292, 2516, 2801, 2760, 2145, 1235, 501, 69, -300, -809, -1319, -1495, -1180, -531, 256, 1185, 2317, 3473, 4264, 4524, 4470, 4341, 4052, 3473, 2835, 2454, 2232, 1821, 1127, 345, -291, -524, -124, 720, 1378, 1530, 1677, 2533, 4085, 5704, 7096, 8481, 9764, 10152, 9008, 6691, 4105, 1734, -427, -2201, -3136, -3086, -2354, -1108, 813, 3358, 5990, 8232, 10011, 11234, 11494, 10487, 8473, 6096, 3901, 2146, 983, 601, 1140, 2499, 4231, 5708, 6567, 7020, 7474, 7815, 7444, 6161, 4576, 3436, 2963, 2975, 3270, 3808, 4763, 6264, 7889, 8802, 8670, 8059, 7651, 7469, 7098, 6247, 4947, 3519, 2473, 2146, 2404, 2860, 3361, 4090, 5218, 6569, 7678, 8179, 8143, 7949, 7759, 7360, 6518, 5350, 4177, 3226, 2556, 2143, 1987, 2200, 2855, 3635, 3968, 3745, 3553, 4032, 5296, 6941, 8236, 8475, 7698, 6752, 6208, 5668, 4649, 3379, 2255, 1232, 338, 58, 569, 1165, 1175, 1080, 1855, 3390, 4501, 4592, 4258, 4077, 3807, 3069, 1958, 789, -94, -448, -545, -956, -1492, -1191, 211, 1701, 2286, 2035, 1536, 1076, 619, 32, -794, -1716, -2285, -2198, -1723, -1357, -1141, -623, 370, 1312, 1559, 1113, 484, -1, -429, -967, -1573, -2025, -2134, -1938, -1639, -1308, -863, -342, 53, 315, 667, 1159, 1489, 1385, 934, 451, 215, 272, 415, 500, 700, 1190, 1682, 1758, 1507, 1343, 1324, 1245, 1150, 1273, 1682, 2348, 3197, 3960, 4351, 4492, 4712, 4987, 5061, 4869, 4453, 3812, 3195, 3072, 3540, 4161, 4620, 5002, 5450, 5952, 6393, 6513, 6108, 5444, 5045, 4925, 4648, 4234, 4287, 5035, 5905, 6372, 6662, 7204, 7761, 7725, 7034, 6232, 5651, 5148, 4576, 3988, 3453, 3143, 3404, 4275, 5170, 5476, 5230, 4924, 4817, 4719, 4320, 3552, 2668, 2062, 1949, 2142, 2262, 2241, 2383, 2697, 2635, 1933, 1156, 809, 529, -170, -1050, -1636, -1922, -2073, -2083, -2018, -2029, -2027, -1898, -1848, -2106, -2596, -3246, -4207, -5381, -6221, -6427, -6387, -6613, -6979, -7013, -6706, -6535, -6738, -7072, -7386, -7857, -8511, -9055, -9347, -9599, -9968, -10302, -10340, -10014, -9634, -9716, -10339, -10925, -11054, -11113, -11598, -12233, -12470, -12366, -12313, -12329, -12211, -12008, -11860, -11709, -11521, -11539, -11916, -12357, -12476, -12391, -12576, -13095, -13506, -13473, -13167, -12909, -12796, -12771, -12739, -12560, -12179, -11870, -12026, -12562, -12879, -12686, -12369, -12231, -11920, -11185, -10518, -10397, -10484, -10280, -10060, -10406, -11186, -11665, -11542, -11177, -10828, -10343, -9742, -9366, -9259, -9082, -8762, -8465, -8105, -7691, -7699, -8151, -8069, -6926, -5809, -5883, -6522, -6279, -5098, -4303, -4610, -5318, -5564, -5492, -5632, -5785, -5291, -4224, -3479, -3483, -3560, -2932, -1841, -1154, -1197, -1533, -1748, -1872, -2014, -2067, -1953, -1881, -2059, -2266, -1943, -909, 216, 606, 215, -154, 125, 775, 1091, 884, 576, 509, 592, 685, 893, 1245, 1449, 1266, 888, 716, 912, 1290, 1464, 1213, 816, 804, 1240, 1648, 1751, 1748, 1730, 1510, 1166, 1084, 1354, 1631, 1639, 1407, 1158, 1219, 1743, 2362, 2481, 2012, 1415, 1048, 899, 879, 920, 855, 600, 395, 592, 1173, 1719, 1837, 1513, 1051, 741, 648, 679, 701, 608, 373, 87, -74, 32, 345, 593, 586, 502, 635, 882, 853, 513, 281, 359, 414, 177, -67, 106, 560, 716, 336, -130, -121, 364, 813, 821, 494, 270, 397, 675, 813, 907, 1219, 1599, 1623, 1328, 1221, 1451, 1514, 1034, 359, 112, 457, 1033, 1502, 1892, 2358, 2824, 3060, 3051, 3015, 2986, 2685, 2009, 1424, 1528, 2283, 2994, 3150, 2936, 2793, 2827, 2961, 3313, 3957, 4453, 4159, 3196, 2533, 2767, 3382, 3732, 4009, 4507, 4819, 4665, 4651, 5248, 5899, 5883, 5215, 4242, 3292, 2875, 3205, 3574, 3217, 2628, 3009, 4528, 6123, 7059, 7636, 8109, 7910, 6676, 5272, 4782, 4908, 4422, 3012, 1768, 1773, 2942, 4393, 5473, 6170, 6774, 7404, 7905, 8035, 7693, 7004, 6252, 5628, 5066, 4463, 4010, 4064, 4619, 5182, 5334, 5251, 5385, 5695, 5662, 5186, 4865, 5074, 5434, 5659, 6208, 7419, 8678, 9192, 8956, 8410, 7690, 6857, 6233, 5900, 5252, 3870, 2547, 2520, 3765, 5032, 5625, 6010, 6560, 6874, 6584, 5863, 4893, 3671, 2408, 1445, 843, 477, 456, 986, 1967, 3116, 4367, 5743, 6831, 7009, 6237, 5052, 3682, 1945, 104, -1063, -1299, -1150, -1018, -619, 357, 1657, 2861, 3841, 4474, 4375, 3503, 2532, 2010, 1578, 750, -41, -26, 718, 1489, 1985, 2448, 3008, 3500, 3762, 3724, 3309, 2590, 1955, 1776, 1918, 2013, 2133, 2727, 3815, 4817, 5318, 5496, 5639, 5693, 5497, 5159, 4952, 4972, 5090, 5263, 5662, 6406, 7279, 7909, 8161, 8246, 8358, 8345, 7926, 7274, 7003, 7381, 8001, 8544, 9288, 10413, 11414, 11808, 11811, 11778, 11534, 10816, 9874, 9134, 8589, 8037, 7671, 7966, 9046, 10455, 11631, 12349, 12717, 12970, 13192, 13029, 11994, 10330, 9030, 8561, 8284, 7607, 7044, 7414, 8511, 9342, 9419, 9195, 9167, 9196, 8859, 8047, 6996, 6037, 5487, 5397, 5455, 5439, 5551, 5859, 5919, 5489, 5031, 4862, 4464, 3297, 1748, 639, 190, -20, -311, -586, -670, -623, -622, -719, -868, -1105, -1583, -2404, -3438, -4377, -4970, -5295, -5694, -6361, -7021, -7211, -6963, -6884, -7409, -8280, -9040, -9653, -10257, -10705, -10814, -10824, -11062, -11403, -11452, -11215, -11133, -11510, -12196, -12954, -13736, -14520, -15147, -15597, -16040, -16494, -16768, -16745, -16465, -16011, -15612, -15596, -15940, -16194, -16151, -16143, -16461, -16955, -17386, -17706, -17884, -17875, -17837, -17970, -18237, -18416, -18458, -18474, -18474, -18368, -18153, -17957, -17777, -17465, -16977, -16480, -16085, -15766, -15558, -15579, -15771, -15913, -15962, -16107, -16385, -16484, -16218, -15838, -15603, -15314, -14757, -14277, -14280, -14463, -14291, -13876, -13674, -13629, -13379, -12901, -12365, -11652, -10593, -9404, -8524, -8163, -8234, -8566, -9035, -9616, -10321, -11058, -11506, -11314, -10472, -9344, -8152, -6789, -5290, -4066, -3335, -2829, -2404, -2430, -3206, -4348, -5185, -5447, -5336, -5069, -4700, -4214, -3545, -2603, -1574, -942, -806, -631, -183, -32, -415, -537, 125, 800, 726, 576, 1320, 2485, 2778, 2071, 1486, 1622, 1837, 1561, 1202, 1262, 1548, 1805, 2245, 2942, 3492, 3714, 3944, 4330, 4488, 4198, 3845, 3801, 3848, 3694, 3620, 4022, 4607, 4757, 4422, 4010, 3658, 3253, 2922, 2877, 2972, 2903, 2743, 2849, 3390, 4184, 5002, 5657, 5920, 5737, 5451, 5355, 5114, 4239, 2988, 2130, 1905, 1912, 1975, 2344, 3014, 3558, 3836, 4247, 4935, 5314, 4906, 4158, 3773, 3685, 3378, 2905, 2794, 3172, 3599, 3715, 3644, 3728, 4056, 4291, 4043, 3397, 2901, 2906, 3130, 3126, 3033, 3397, 4225, 4804, 4779, 4678, 4916, 5040, 4591, 4007, 3938, 4219, 4235, 3886, 3665, 3941, 4500, 4791, 4612, 4404, 4592, 4833, 4464, 3612, 3138, 3392, 3756, 3669, 3486, 3832, 4576, 5023, 4933, 4762, 4816, 4711, 4069, 3326, 3163, 3333, 2996, 2212, 2001, 2722, 3615, 4163, 4645, 5172, 5386, 5222, 4916, 4454, 3811, 3295, 2959, 2338, 1399, 988, 1675, 2851, 3602, 3869, 4093, 4168, 3699, 3034, 2936, 3251, 3080, 2356, 2051, 2623, 3384, 3677, 3698, 3853, 4027, 3840, 3209, 2387, 1732, 1569, 1877, 2063, 1572, 912, 1303, 2923, 4358, 4370, 3490, 3031, 3179, 3055, 2382, 1858, 1786, 1607, 1175, 1257, 2163, 3084, 3317, 3126, 3060, 3375, 4067, 4654, 4355, 3246, 2471, 2643, 3012, 2901, 2835, 3429, 4158, 4176, 3724, 3741, 4370, 4762, 4445, 4013, 4163, 4765, 5240, 5302, 4924, 4061, 2865, 1822, 1265, 843, -78, -1529, -2754, -2959, -1997, -406, 1030, 1985, 2985, 4675, 6634, 7648, 7212, 5861, 4034, 1752, -501, -1809, -2069, -2276, -3035, -3574, -2778, -732, 1433, 2929, 3798, 4255, 4263, 3849, 3268, 2716, 2221, 1792, 1458, 1278, 1498, 2437, 3935, 5111, 5236, 4666, 4322, 4314, 3982, 3228, 2738, 2786, 2942, 3146, 3907, 5267, 6618, 7746, 9044, 10468, 11147, 10571, 9461, 8811, 8615, 8254, 7739, 7606, 7906, 8186, 8391, 8996, 10150, 11311, 11875, 11830, 11680, 11887, 12481, 13123, 13494, 13640, 13897, 14378, 14739, 14720, 14552, 14328, 13534, 11958, 10482, 10086, 10530, 10874, 10878, 11127, 12099, 13652, 15179, 16051, 16106, 15721, 15226, 14435, 13079, 11459, 10161, 9367, 8788, 8392, 8568, 9382, 10154, 10210, 9781, 9596, 9749, 9567, 8626, 7337, 6340, 5740, 5334, 5177, 5446, 5916, 6046, 5624, 4960, 4417, 3956, 3203, 1881, 150, -1386, -2144, -2083, -1803, -1950, -2492, -2799, -2436, -1707, -1338, -1801, -2977, -4363, -5501, -6287, -6912, -7529, -8175, -8876, -9609, -10189, -10429, -10508, -10838, -11553, -12303, -12705, -12769, -12753, -12767, -12773, -12804, -12943, -13081, -13035, -12962, -13357, -14499, -16022, -17299, -18096, -18577, -18892, -19049, -19081, -18975, -18572, -17905, -17357, -17220, -17304, -17314, -17355, -17723, -18357, -18914, -19287, -19669, -20051, -20118, -19807, -19477, -19348, -19221, -18967, -18773, -18793, -18890, -18909, -18802, -18541, -18140, -17735, -17398, -17027, -16572, -16141, -15829, -15587, -15422, -15435, -15676, -15983, -16139, -16090, -15863, -15463, -14964, -14544, -14150, -13440, -12353, -11405, -11058, -11107, -11066, -10797, -10427, -9991, -9512, -9147, -8960, -8723, -8218, -7594, -7224, -7259, -7519, -7785, -7892, -7629, -6918, -5989, -5100, -4290, -3586, -3002, -2206, -963, 57, -142, -1332, -2201, -2180, -2032, -2418, -2927, -2941, -2559, -2069, -1242, 141, 1480, 1933, 1599, 1360, 1684, 2276, 2709, 2777, 2367, 1619, 1124, 1353, 1925, 2054, 1756, 1763, 2140, 2133, 1681, 1697, 2336, 2578, 2066, 1760, 2242, 2863, 3035, 3026, 3105, 3054, 2740, 2420, 2319, 2406, 2533, 2531, 2279, 1904, 1752, 1956, 2132, 1825, 1235, 1078, 1569, 1971, 1549, 704, 532, 1369, 2391, 2798, 2702, 2562, 2471, 2356, 2266, 2107, 1603, 771, -26, -533, -730, -595, -155, 376, 803, 1182, 1651, 2170, 2645, 3075, 3367, 3192, 2394, 1447, 1036, 1183, 1265, 963, 642, 680, 972, 1329, 1846, 2570, 3180, 3338, 3205, 3200, 3378, 3405, 3134, 2827, 2723, 2670, 2466, 2279, 2416, 2806, 3117, 3285, 3474, 3685, 3890, 4234, 4613, 4584, 4156, 3924, 3993, 3753, 3116, 2838, 3250, 3756, 3880, 3810, 3812, 3960, 4387, 5110, 5671, 5533, 4749, 3907, 3517, 3653, 4013, 4060, 3338, 2095, 1423, 2158, 3645, 4408, 4002, 3372, 3378, 3874, 4380, 4757, 4948, 4719, 3985, 3089, 2467, 2225, 2187, 2154, 1966, 1568, 1246, 1407, 1960, 2407, 2590, 2739, 2763, 2385, 1946, 2117, 2707, 2759, 2034, 1481, 1815, 2440, 2415, 1916, 1862, 2403, 2732, 2373, 1738, 1319, 1046, 656, 186, -88, -67, -55, -404, -784, -307, 1227, 2761, 3230, 2932, 2954, 3639, 4280, 4158, 3333, 2413, 1773, 1207, 461, -107, 104, 958, 1626, 1735, 1786, 2270, 3029, 3740, 4362, 4716, 4285, 3021, 1926, 2078, 3168, 3773, 3205, 2383, 2535, 3599, 4460, 4341, 3285, 1568, -536, -2428, -3546, -4156, -4955, -5783, -5550, -3546, -132, 3776, 7311, 9953, 11663, 12467, 11940, 9687, 6232, 2633, -655, -3762, -6453, -7998, -7876, -6104, -3135, 305, 3640, 6837, 9967, 12348, 12831, 11246, 8996, 7649, 7173, 6268, 4397, 2764, 2902, 4828, 7033, 8128, 8109, 8058, 8785, 9905, 10334, 9541, 8070, 6990, 7150, 8685, 10817, 12485, 13515, 14630, 16105, 17289, 17647, 17350, 16520, 15076, 13440, 12377, 12027, 11941, 11985, 12381, 13185, 14258, 15491, 16597, 17193, 17219, 17018, 16965, 17336, 18187, 19074, 19387, 19223, 19286, 19694, 19594, 18241, 15951, 13628, 11799, 10475, 9606, 9201, 9239, 9845, 11440, 14116, 17022, 19005, 19644, 19170, 17805, 15789, 13568, 11338, 8948, 6583, 4813, 3860, 3519, 3811, 4824, 6086, 6880, 7026, 6712, 5979, 4858, 3629, 2531, 1538, 626, -43, -285, -65, 435, 772, 485, -493, -1836, -3254, -4696, -6129, -7450, -8650, -9802, -10672, -10730, -9862, -8777, -8256, -8223, -8164, -8152, -8675, -9732, -10865, -11866, -12817, -13699, -14459, -15150, -15719, -16004, -16162, -16602, -17398, -18138, -18494, -18565, -18593, -18577, -18358, -17879, -17202, -16435, -15798, -15641, -16073, -16862, -17823, -19035, -20462, -21705, -22421, -22620, -22448, -22018, -21467, -20878, -20123, -19168, -18341, -18040, -18281, -18739, -19101, -19243, -19207, -19122, -19093, -19023, -18672, -18009, -17399, -17158, -17164, -17210, -17464, -18067, -18587, -18548, -18140, -17783, -17357, -16514, -15343, -14113, -12868, -11639, -10775, -10543, -10716, -10909, -11119, -11592, -12281, -12869, -13233, -13404, -13203, -12462, -11480, -10634, -9742, -8432, -6905, -5684, -4900, -4334, -3874, -3510, -3214, -3085, -3364, -4091, -4949, -5544, -5722, -5658, -5685, -5852, -5692, -4662, -2853, -1009, 261, 1021, 1655, 2233, 2572, 2693, 2735, 2450, 1374, -339, -1741, -2021, -1365, -655, -486, -627, -424, 421, 1526, 2245, 2323, 2078, 1960, 2072, 2317, 2761, 3322, 3346, 2379, 1235, 1195, 2140, 2626, 1884, 583, -390, -796, -752, -437, -63, 295, 681, 968, 1076, 1320, 1933, 2461, 2309, 1664, 1228, 1264, 1416, 1302, 871, 314, -112, -246, -236, -493, -1175, -1809, -1834, -1386, -1008, -747, -220, 610, 1481, 2358, 3175, 3401, 2730, 1752, 1235, 1036, 493, -491, -1392, -1897, -2086, -1872, -995, 256, 1103, 1325, 1523, 2063, 2616, 2915, 3134, 3296, 3147, 2734, 2462, 2511, 2674, 2713, 2532, 2170, 1800, 1586, 1486, 1373, 1300, 1441, 1813, 2303, 2939, 3876, 5045, 5990, 6262, 5892, 5275, 4782, 4549, 4389, 3840, 2752, 1804, 1756, 2366, 2838, 3096, 3607, 4251, 4475, 4287, 4117, 3997, 3679, 3262, 3058, 3135, 3322, 3458, 3487, 3532, 3789, 4171, 4264, 3831, 3116, 2448, 1843, 1195, 673, 630, 1137, 1772, 2016, 1925, 2187, 3222, 4347, 4306, 2745, 787, -96, 384, 1120, 826, -595, -1894, -1711, 57, 2175, 3188, 2533, 867, -441, -474, 301, 544, -311, -1380, -1507, -634, 431, 1127, 1465, 1532, 1366, 1231, 1265, 871, -598, -2524, -3483, -3142, -2533, -2288, -1843, -711, 573, 1256, 1352, 1449, 1821, 2074, 1632, 493, -598, -880, -404, 40, -124, -586, -482, 588, 2012, 2735, 2317, 1291, 481, 290, 643, 1245, 1652, 1491, 946, 809, 1610, 2827, 3375, 2907, 2167, 1937, 2147, 2305, 2269, 2194, 2054, 1710, 1260, 905, 514, -379, -2036, -4079, -5673, -6124, -5362, -3949, -2484, -796, 1981, 6122, 10443, 13335, 14157, 13233, 11185, 8740, 6223, 3013, -1303, -5440, -7548, -7452, -6058, -3410, 731, 5207, 8456, 10687, 13233, 16110, 17720, 17007, 14648, 11994, 9827, 8529, 8323, 8786, 9068, 9167, 9940, 11552, 13142, 14099, 14423, 14082, 13333, 13141, 14026, 15203, 15884, 16474, 17643, 19287, 20983, 22504, 23438, 23252, 22081, 20722, 19642, 18534, 17194, 16125, 15810, 16006, 16331, 17061, 18486, 20041, 20902, 21158, 21444, 21865, 22017, 21874, 21861, 22107, 22240, 22010, 21563, 20905, 19833, 18475, 17153, 15633, 13481, 11163, 9631, 9079, 9204, 10138, 11886, 13630, 14817, 15928, 17275, 18045, 17448, 15710, 13358, 10511, 7386, 4662, 2799, 1594, 696, 150, 32, 78, 228, 870, 1817, 1923, 671, -782, -1241, -1055, -1129, -1527, -1957, -2513, -3181, -3662, -4153, -5373, -7544, -10047, -12186, -13748, -14785, -15344, -15525, -15423, -14876, -13619, -11947, -10743, -10564, -11085, -11766, -12561, -13649, -15005, -16535, -18165, -19570, -20312, -20341, -20067, -19864, -19824, -19942, -20216, -20470, -20428, -20154, -20098, -20450, -20688, -20208, -19095, -17993, -17394, -17301, -17550, -17974, -18489, -19103, -19897, -20862, -21817, -22505, -22716, -22394, -21694, -20882, -20112, -19309, -18337, -17306, -16544, -16240, -16198, -16054, -15690, -15313, -15167, -15247, -15383, -15421, -15360, -15368, -15661, -16259, -16811, -16814, -16137, -15177, -14395, -13747, -12778, -11261, -9526, -8098, -7218, -6831, -6843, -7151, -7595, -8083, -8654, -9331, -9877, -9948, -9431, -8580, -7739, -7033, -6321, -5441, -4405, -3375, -2523, -1964, -1716, -1633, -1461, -1088, -685, -487, -618, -1052, -1589, -1946, -2217, -2820, -3641, -3823, -2985, -1855, -1121, -543, 313, 1445, 2786, 4146, 4761, 4081, 2801, 1976, 1495, 525, -991, -2317, -3059, -3356, -3193, -2422, -1440, -1030, -1278, -1336, -624, 384, 953, 913, 472, -53, -195, 211, 536, 102, -838, -1579, -2001, -2443, -3031, -3712, -4502, -5198, -5266, -4434, -3139, -2148, -1828, -1881, -1705, -1002, -137, 100, -784, -2405, -3721, -4028, -3629, -3396, -3759, -4353, -4529, -4018, -3142, -2505, -2488, -2941, -3362, -3310, -2710, -1888, -1374, -1395, -1533, -1151, -183, 743, 997, 498, -385, -1218, -1768, -2093, -2389, -2703, -2897, -2829, -2370, -1348, 176, 1665, 2508, 2731, 3009, 3776, 4594, 4719, 4032, 3081, 2352, 1974, 1923, 2067, 2158, 2166, 2307, 2589, 2794, 3022, 3606, 4422, 4948, 5078, 5267, 5741, 6193, 6361, 6410, 6569, 6706, 6513, 5954, 5315, 4900, 4833, 4981, 4974, 4572, 4126, 4289, 5123, 5896, 5994, 5603, 5292, 5294, 5433, 5484, 5360, 5047, 4595, 4160, 3881, 3719, 3556, 3362, 3164, 2930, 2711, 2709, 2997, 3320, 3355, 3069, 2719, 2626, 2913, 3274, 3189, 2561, 1887, 1573, 1404, 995, 448, 195, 368, 637, 622, 332, 187, 579, 1352, 1898, 1785, 1166, 547, 272, 249, 57, -614, -1504, -1890, -1367, -406, 141, 79, 66, 643, 1435, 1648, 1109, 326, -285, -786, -1392, -2079, -2490, -2272, -1636, -1271, -1282, -843, 432, 1572, 1532, 689, 152, 243, 482, 482, 169, -423, -987, -922, -86, 755, 820, 426, 414, 763, 905, 1034, 1678, 2390, 2412, 2140, 2424, 3134, 3652, 3827, 3482, 2324, 974, 568, 965, 899, 0, -784, -645, 399, 1862, 2951, 2972, 2190, 1672, 1784, 1536, -87, -2690, -4925, -6016, -6088, -5281, -3488, -951, 1815, 4790, 8182, 11559, 13985, 14892, 14166, 11873, 8536, 5173, 2367, -170, -2592, -4027, -3414, -876, 2429, 5660, 8777, 11768, 14331, 16362, 17944, 18662, 17953, 16217, 14690, 14072, 13999, 13947, 13902, 14035, 14325, 14738, 15337, 15952, 16143, 15894, 15899, 16771, 18332, 20049, 21566, 22645, 23356, 24298, 25698, 26583, 25956, 24281, 22613, 21123, 19668, 18729, 18626, 18822, 19028, 19859, 21686, 23695, 24804, 24820, 24277, 23584, 22692, 21404, 19838, 18471, 17668, 17377, 17332, 17466, 17819, 18251, 18407, 18093, 17410, 16362, 14672, 12328, 10014, 8456, 7644, 7182, 7000, 7211, 7678, 8286, 9056, 9706, 9624, 8593, 6883, 4788, 2669, 1015, -258, -1806, -3647, -4975, -5513, -5764, -5874, -5701, -5805, -6751, -7869, -8233, -8175, -8478, -8977, -9150, -9205, -9533, -9974, -10350, -11077, -12576, -14586, -16525, -18163, -19566, -20600, -21056, -21039, -20754, -20030, -18723, -17285, -16332, -15919, -15841, -16215, -17189, -18465, -19644, -20686, -21679, -22517, -23007, -23032, -22579, -21838, -21143, -20669, -20263, -19761, -19297, -19103, -19135, -19084, -18731, -18158, -17542, -16990, -16577, -16429, -16563, -16795, -16930, -16957, -16991, -17070, -17123, -17053, -16787, -16230, -15339, -14289, -13445, -13039, -12912, -12667, -12126, -11553, -11291, -11333, -11244, -10667, -9726, -8827, -8204, -7890, -7906, -8175, -8420, -8455, -8428, -8520, -8640, -8602, -8328, -7731, -6702, -5362, -4041, -2987, -2260, -1843, -1678, -1657, -1761, -2123, -2783, -3466, -3792, -3690, -3404, -3138, -2874, -2578, -2292, -1956, -1433, -829, -490, -590, -917, -1120, -992, -566, -121, -18, -346, -792, -1041, -1213, -1665, -2383, -2981, -3334, -3672, -3931, -3721, -3159, -2832, -2775, -2475, -1956, -1822, -2216, -2779, -3464, -4389, -5240, -5663, -5845, -6103, -6366, -6457, -6360, -6036, -5535, -5298, -5793, -6757, -7342, -7146, -6670, -6616, -7001, -7272, -7052, -6433, -5708, -5204, -5239, -5867, -6757, -7502, -7913, -8009, -7968, -8039, -8234, -8152, -7452, -6312, -5177, -4231, -3477, -3086, -3229, -3675, -3960, -4004, -4166, -4515, -4605, -4164, -3509, -2998, -2529, -1951, -1437, -1167, -1029, -879, -759, -721, -682, -528, -163, 522, 1541, 2652, 3471, 3848, 3994, 4169, 4342, 4291, 3918, 3336, 2786, 2553, 2768, 3297, 3963, 4754, 5646, 6431, 7020, 7644, 8406, 8927, 8770, 8016, 7192, 6813, 7051, 7655, 8105, 8078, 7763, 7652, 8013, 8631, 9008, 8792, 8093, 7382, 7053, 7121, 7385, 7747, 8220, 8647, 8724, 8440, 8217, 8284, 8190, 7319, 5840, 4625, 4248, 4396, 4416, 4101, 3789, 3815, 4106, 4339, 4345, 4212, 3986, 3532, 2765, 1931, 1422, 1329, 1357, 1213, 987, 987, 1262, 1464, 1267, 792, 401, 190, -97, -632, -1246, -1666, -1809, -1739, -1540, -1279, -992, -659, -253, 103, 179, -88, -458, -674, -763, -902, -1141, -1416, -1681, -1843, -1731, -1320, -823, -479, -369, -448, -577, -468, 104, 868, 1131, 644, 122, 374, 1198, 1764, 1812, 1652, 1415, 1148, 1185, 1631, 2041, 2182, 2366, 2689, 2851, 2843, 2859, 2691, 2141, 1624, 1531, 1541, 1341, 1267, 1627, 2132, 2548, 3187, 4176, 4869, 4648, 3911, 3520, 3502, 3200, 2579, 2320, 2624, 3001, 3176, 3301, 3499, 3899, 4590, 5064, 4717, 4126, 4468, 5483, 5600, 4460, 3616, 4209, 5343, 5609, 5086, 4763, 4686, 4049, 2900, 2324, 2745, 3208, 2732, 1580, 841, 1210, 2176, 2406, 1212, -482, -1296, -1151, -1097, -1683, -2475, -2968, -2957, -1965, 704, 4832, 8871, 11318, 12156, 12401, 12777, 13335, 13503, 12086, 8338, 3587, 305, -719, -680, -327, 738, 2744, 5584, 9448, 13902, 17448, 19300, 20209, 20745, 20535, 19734, 19204, 18951, 18241, 17163, 16534, 16640, 17176, 17761, 17853, 17155, 16441, 16791, 17929, 18544, 18320, 18432, 19829, 22111, 24405, 26373, 27768, 27934, 26760, 25331, 24542, 23709, 21787, 19148, 17041, 16023, 15903, 16533, 17616, 18515, 18847, 18845, 18946, 19312, 19578, 18893, 16811, 14298, 12949, 13078, 13437, 12988, 12050, 11367, 10961, 10467, 9836, 9017, 7457, 4895, 2241, 613, -166, -977, -1740, -1726, -1038, -541, -512, -520, -549, -1137, -2387, -3708, -4743, -5916, -7682, -9680, -11133, -11812, -12141, -12648, -13527, -14559, -15304, -15629, -15960, -16672, -17485, -17846, -17638, -17086, -16390, -15753, -15483, -15658, -16049, -16513, -17250, -18449, -19892, -21209, -22276, -23181, -23813, -23798, -22966, -21633, -20305, -19214, -18344, -17781, -17676, -17904, -18080, -18057, -18078, -18362, -18771, -18964, -18689, -17970, -17148, -16579, -16236, -15837, -15398, -15217, -15272, -15147, -14659, -14043, -13466, -12798, -11983, -11179, -10463, -9724, -9041, -8815, -9205, -9709, -9654, -9034, -8437, -8288, -8426, -8463, -8195, -7629, -6922, -6306, -5997, -6020, -6128, -5972, -5407, -4668, -4143, -3953, -3823, -3447, -2868, -2407, -2306, -2526, -2902, -3379, -3978, -4563, -4820, -4677, -4514, -4637, -4821, -4766, -4592, -4369, -3755, -2741, -2089, -2334, -2956, -3167, -2937, -2702, -2731, -3182, -4169, -5377, -6117, -6100, -5854, -6121, -6951, -7586, -7332, -6439, -5817, -5905, -6237, -6296, -6175, -6149, -6221, -6448, -7059, -7973, -8766, -9213, -9322, -9067, -8698, -8773, -9252, -9348, -8832, -8495, -8876, -9589, -10101, -10106, -9505, -9005, -9761, -11393, -11876, -10429, -8657, -7935, -7844, -7855, -8283, -9123, -9787, -9957, -9414, -8009, -6755, -7195, -8850, -9480, -8320, -6744, -5694, -4932, -4506, -4664, -4871, -4568, -4024, -3452, -2715, -2279, -2650, -2984, -2227, -1085, -875, -1313, -1278, -731, -261, 274, 1228, 2158, 2416, 2174, 2195, 2921, 4096, 5073, 5388, 5098, 4600, 4256, 4263, 4646, 5134, 5321, 5211, 5255, 5687, 6243, 6718, 7298, 8054, 8653, 8844, 8802, 8740, 8529, 7993, 7318, 6889, 6783, 6618, 6036, 5227, 4808, 5157, 5971, 6581, 6677, 6610, 6862, 7433, 8003, 8424, 8595, 8180, 7145, 6190, 5929, 5896, 5160, 3653, 2221, 1539, 1590, 2016, 2441, 2564, 2367, 2284, 2763, 3623, 4196, 4167, 3831, 3453, 2967, 2429, 2109, 1996, 1793, 1415, 1029, 743, 589, 453, 3, -730, -968, -323, 203, -366, -1249, -993, 286, 1242, 1265, 868, 631, 685, 882, 905, 539, -62, -623, -975, -823, 94, 1300, 1793, 1378, 1073, 1734, 2902, 3467, 3044, 2265, 1889, 2014, 2192, 2159, 2150, 2469, 3029, 3546, 4057, 4842, 5795, 6235, 5740, 4898, 4727, 5302, 5574, 4766, 3498, 3019, 3689, 4711, 5302, 5610, 6186, 6962, 7277, 6896, 6357, 6049, 5562, 4470, 3260, 2767, 2973, 3147, 2986, 2984, 3623, 4666, 5410, 5529, 5464, 5766, 6186, 6041, 5426, 5118, 5285, 5379, 5338, 5595, 5876, 5359, 4122, 3213, 3121, 3203, 2710, 1719, 976, 1112, 1970, 2752, 3050, 3445, 4612, 6127, 6814, 6265, 5332, 4912, 4815, 4284, 3230, 2244, 1622, 1104, 594, 488, 1034, 1863, 2404, 2578, 2770, 3214, 3664, 3779, 3654, 3656, 3856, 3940, 3804, 3779, 4073, 4260, 3733, 2502, 1244, 480, -124, -1379, -3449, -5439, -6522, -6997, -7421, -7153, -4899, -744, 3645, 6971, 9557, 12475, 15999, 19079, 20147, 18630, 15478, 11945, 8327, 4571, 1282, -886, -2210, -3093, -2865, -530, 3462, 7362, 10227, 12796, 15968, 19386, 22214, 24265, 25593, 25809, 24829, 23498, 22630, 22038, 21002, 19108, 16497, 13900, 12230, 11604, 11380, 11340, 11999, 13498, 15478, 17938, 20856, 23401, 24907, 25885, 26776, 26859, 25632, 23829, 21992, 19615, 16674, 14381, 13503, 13250, 12604, 11649, 11064, 10887, 10524, 9718, 8958, 8728, 8699, 8178, 7183, 6526, 6694, 7171, 7165, 6735, 6597, 6588, 5539, 3212, 1063, -61, -1432, -4139, -7008, -8484, -9035, -9892, -11049, -11888, -12365, -12602, -12531, -12381, -12483, -12622, -12510, -12425, -12628, -12815, -12767, -12839, -13370, -14184, -15098, -16299, -17988, -19917, -21597, -22825, -23726, -24454, -24985, -25137, -24559, -23057, -21106, -19539, -18479, -17297, -15895, -15045, -15090, -15387, -15489, -15808, -16660, -17555, -17921, -17905, -18030, -18436, -18753, -18609, -18046, -17411, -16925, -16447, -15674, -14476, -13020, -11509, -9968, -8426, -7128, -6271, -5646, -5016, -4647, -4961, -5806, -6593, -7009, -7174, -7240, -7241, -7147, -6830, -6128, -5117, -4162, -3518, -3041, -2453, -1705, -979, -366, 181, 597, 687, 469, 290, 356, 376, -136, -1225, -2360, -3024, -3305, -3716, -4422, -4982, -5000, -4666, -4382, -4195, -3962, -3829, -4007, -4280, -4189, -3782, -3699, -4373, -5445, -6228, -6568, -6934, -7728, -8833, -9911, -10828, -11650, -12349, -12827, -13096, -13271, -13340, -13118, -12561, -11905, -11451, -11243, -11104, -10940, -10872, -11057, -11453, -11912, -12447, -13138, -13861, -14420, -14886, -15391, -15722, -15665, -15541, -15757, -16011, -15658, -14657, -13550, -12664, -11888, -11082, -10321, -9745, -9391, -9114, -8873, -9027, -9939, -11136, -11567, -10948, -10236, -10301, -10601, -9888, -7930, -5808, -4489, -3989, -3949, -4016, -3514, -2059, -616, -497, -1283, -1349, -225, 1198, 2340, 3212, 3687, 3774, 3849, 3903, 3656, 3450, 3652, 3725, 3454, 3860, 5339, 6506, 6590, 6918, 8458, 10002, 10189, 9417, 8720, 8375, 8244, 8209, 8009, 7514, 7088, 7167, 7848, 8955, 9974, 10078, 9013, 7759, 7482, 8071, 8365, 7635, 6257, 5122, 4808, 5236, 5871, 6307, 6564, 6739, 6651, 6089, 5199, 4325, 3613, 3030, 2590, 2342, 2219, 2099, 2058, 2436, 3419, 4474, 4600, 3533, 2340, 2113, 2441, 2022, 573, -868, -1445, -1309, -806, 179, 1603, 2615, 2328, 1138, 554, 1353, 2454, 2273, 854, -219, -17, 705, 999, 1215, 2180, 3527, 4039, 3550, 3238, 3707, 3977, 3035, 1516, 830, 1220, 1710, 1750, 1921, 2859, 4247, 5301, 5801, 6176, 6706, 7177, 7293, 7037, 6534, 5928, 5539, 5763, 6542, 7249, 7370, 7065, 6800, 6659, 6424, 6115, 5954, 5819, 5306, 4533, 4273, 4978, 6152, 7119, 7976, 9145, 10298, 10617, 10059, 9515, 9349, 8740, 7037, 5019, 3940, 3803, 3583, 2930, 2572, 2932, 3321, 3064, 2676, 3069, 3999, 4267, 3492, 2747, 3033, 3956, 4518, 4628, 4922, 5392, 5197, 4035, 2761, 2105, 1509, 24, -2038, -3323, -3334, -3147, -3724, -4324, -3570, -1662, -312, -457, -1158, -1075, -84, 983, 1451, 1165, 376, -246, 45, 1113, 1664, 648, -1329, -2752, -3057, -2964, -3182, -3779, -4558, -5137, -4872, -3495, -1644, -259, 378, 826, 1831, 3311, 3984, 2942, 1484, 1717, 3272, 3661, 2171, 858, 1163, 2024, 2039, 1369, 812, 540, 276, -144, -482, -234, 648, 1418, 1631, 2117, 3790, 6002, 7207, 6862, 5758, 4875, 4576, 4566, 4183, 3047, 1528, 278, -494, -984, -1400, -1992, -2937, -3937, -4385, -4230, -4029, -3970, -3413, -1647, 1391, 5173, 9071, 12781, 16294, 19391, 21396, 21862, 21096, 19502, 16973, 13474, 9619, 6075, 3097, 1050, 502, 1354, 2811, 4753, 8059, 12822, 17230, 19428, 20033, 21372, 24261, 27015, 27998, 27623, 27133, 26681, 25686, 24154, 22766, 21699, 20124, 17260, 13914, 12012, 11979, 11962, 10839, 10276, 11982, 14784, 16650, 17746, 19265, 20853, 21397, 20910, 20096, 19069, 17560, 15588, 13394, 11286, 9516, 7931, 6158, 4395, 3267, 2706, 1730, -283, -2720, -4384, -4764, -4454, -4427, -5011, -5621, -5559, -4884, -4213, -3832, -3503, -3255, -3838, -5741, -8141, -9773, -10656, -11983, -14237, -16577, -18211, -19297, -20227, -20947, -21292, -21377, -21346, -21143, -20615, -19658, -18319, -16825, -15489, -14491, -13752, -13031, -12213, -11540, -11518, -12364, -13690, -14922, -15912, -16876, -17826, -18456, -18647, -18632, -18483, -17748, -16072, -13898, -12041, -10667, -9204, -7329, -5481, -4160, -3230, -2324, -1566, -1363, -1611, -1752, -1650, -1849, -2728, -3882, -4608, -4680, -4417, -4151, -3924, -3608, -3106, -2304, -1051, 592, 2104, 2892, 2993, 3079, 3598, 4264, 4572, 4442, 4085, 3534, 2690, 1669, 767, 44, -806, -2056, -3574, -4948, -5932, -6581, -6976, -7095, -6996, -6880, -6815, -6586, -6061, -5472, -5169, -5285, -5759, -6460, -7208, -7881, -8633, -9745, -11282, -12989, -14562, -15869, -16919, -17791, -18565, -19296, -19981, -20494, -20596, -20127, -19255, -18362, -17673, -17133, -16659, -16301, -16104, -16018, -16047, -16332, -16932, -17643, -18225, -18673, -19066, -19278, -19151, -18817, -18494, -18068, -17319, -16352, -15433, -14534, -13487, -12336, -11225, -10252, -9474, -8825, -8056, -7155, -6523, -6295, -6047, -5534, -4994, -4479, -3737, -2970, -2662, -2566, -1964, -863, 77, 642, 1177, 1758, 2111, 2209, 2381, 2897, 3664, 4271, 4388, 4233, 4356, 4893, 5410, 5626, 5772, 5991, 5953, 5505, 5282, 5899, 6759, 6597, 5331, 4317, 4442, 5109, 5514, 5711, 5890, 5732, 5026, 4193, 3981, 4866, 6239, 6331, 4263, 1868, 1584, 2931, 3420, 2395, 1394, 1191, 1103, 862, 959, 1414, 1705, 1584, 1187, 855, 951, 1277, 1103, 373, -104, -207, -838, -2084, -2686, -2086, -1465, -1919, -2933, -3392, -3103, -2616, -2209, -1782, -1421, -1425, -1739, -1822, -1326, -593, -199, -269, -495, -655, -732, -678, -410, -101, -124, -461, -506, 208, 1254, 1814, 1840, 2129, 3084, 4063, 4318, 4101, 4223, 4785, 5111, 4944, 4820, 5073, 5368, 5564, 6106, 7083, 7855, 8025, 8013, 8286, 8739, 9030, 9040, 8901, 8896, 9185, 9540, 9682, 9777, 10063, 10271, 10097, 9857, 9981, 10218, 10060, 9621, 9399, 9519, 9690, 9757, 9823, 9905, 9855, 9628, 9371, 9151, 8806, 8230, 7603, 7181, 6974, 6735, 6237, 5555, 5095, 5123, 5277, 4990, 4333, 3876, 3703, 3320, 2583, 1979, 1800, 1690, 1279, 747, 548, 800, 1066, 808, 44, -597, -652, -447, -657, -1438, -2277, -2656, -2513, -2094, -1598, -1130, -780, -564, -374, -146, 17, 16, -111, -306, -548, -738, -772, -730, -711, -620, -350, 15, 463, 1124, 1818, 2057, 1810, 1759, 2344, 3037, 3040, 2392, 1883, 2000, 2406, 2537, 2327, 2158, 2408, 3154, 4075, 4601, 4422, 3840, 3415, 3416, 3810, 4426, 4916, 4878, 4360, 3952, 4205, 5118, 6162, 6642, 6202, 5227, 4528, 4433, 4474, 4144, 3690, 3764, 4453, 5076, 5012, 4355, 3588, 3033, 2780, 2718, 2500, 1912, 1253, 930, 922, 1142, 1721, 2387, 2485, 2120, 2157, 2647, 2615, 1659, 392, -647, -1225, -1088, -641, -1020, -2360, -3247, -2816, -1936, -1662, -1972, -2442, -2765, -2636, -2249, -2454, -3464, -4267, -4120, -3621, -3650, -4371, -5636, -7337, -9040, -10122, -10357, -9974, -9330, -8710, -7789, -5366, -530, 5849, 11707, 15853, 18659, 20827, 22327, 22511, 20892, 17763, 13993, 10064, 5836, 1830, -166, 1050, 4163, 6626, 7763, 9330, 12835, 17516, 21581, 24312, 26006, 26736, 26608, 26614, 27757, 29501, 30235, 29257, 27366, 25628, 24183, 22294, 19557, 16737, 14826, 13453, 11616, 9823, 9619, 10860, 11720, 11577, 11625, 12401, 12938, 12610, 11870, 11107, 10138, 8885, 7599, 6584, 6140, 6313, 6490, 5826, 4125, 1868, -387, -2413, -4410, -6869, -10044, -13421, -16205, -18133, -19328, -19690, -19117, -18122, -17409, -16942, -16010, -14301, -12443, -11253, -10928, -11141, -11618, -12285, -13049, -13864, -14951, -16568, -18591, -20504, -21881, -22728, -23333, -23883, -24200, -23951, -22969, -21362, -19348, -17031, -14465, -11769, -9172, -6908, -5150, -3948, -3164, -2554, -2023, -1835, -2324, -3412, -4535, -5145, -5144, -4875, -4800, -5144, -5644, -5743, -5125, -4007, -2840, -1852, -993, -125, 895, 2228, 3823, 5224, 5994, 6330, 6835, 7624, 8140, 7993, 7436, 6867, 6299, 5512, 4345, 2739, 760, -1330, -3168, -4547, -5543, -6406, -7272, -7947, -8014, -7275, -6009, -4753, -3853, -3330, -3010, -2744, -2604, -2847, -3666, -5016, -6752, -8723, -10709, -12478, -14047, -15687, -17514, -19278, -20627, -21368, -21534, -21391, -21298, -21314, -21140, -20540, -19672, -18819, -18117, -17665, -17553, -17679, -17739, -17577, -17316, -17168, -17168, -17173, -17025, -16778, -16583, -16376, -15891, -15167, -14690, -14690, -14791, -14577, -14126, -13661, -13060, -12148, -11046, -9970, -8839, -7358, -5378, -3160, -1266, -5, 897, 1893, 2938, 3660, 3932, 3840, 3311, 2366, 1519, 1296, 1547, 1618, 1165, 502, 286, 928, 2215, 3498, 4364, 4972, 5608, 6240, 6749, 7254, 7846, 8175, 7735, 6576, 5437, 4939, 4828, 4268, 2967, 1610, 961, 808, 310, -797, -1885, -2375, -2483, -2728, -3128, -3323, -3248, -3243, -3456, -3609, -3501, -3425, -3703, -4069, -3968, -3430, -3114, -3362, -3761, -3840, -3667, -3620, -4024, -5029, -6345, -7270, -7463, -7399, -7627, -8086, -8341, -7960, -6635, -4728, -3377, -3127, -3052, -2162, -785, 353, 1235, 1831, 1758, 1325, 1563, 2672, 3757, 4175, 4022, 3571, 3226, 3365, 3666, 3542, 3383, 4007, 5027, 5404, 5314, 5829, 7125, 8531, 9719, 10621, 10874, 10405, 9967, 10318, 11340, 12226, 12187, 11087, 9752, 9429, 10474, 11904, 12513, 12075, 11249, 10655, 10446, 10475, 10504, 10215, 9469, 8586, 8122, 8257, 8728, 9293, 9870, 10314, 10512, 10604, 10698, 10609, 10192, 9658, 9201, 8595, 7563, 6295, 5331, 5019, 5195, 5354, 5058, 4294, 3444, 2930, 2838, 2864, 2614, 1925, 1003, 297, 207, 689, 1191, 1173, 746, 515, 760, 1083, 984, 480, -63, -476, -865, -1258, -1479, -1448, -1315, -1211, -1087, -886, -701, -641, -713, -834, -906, -884, -842, -851, -796, -489, 58, 692, 1312, 1827, 2105, 2204, 2400, 2768, 2984, 2778, 2284, 1833, 1635, 1744, 2041, 2265, 2294, 2354, 2739, 3367, 3858, 3973, 3848, 3798, 3944, 4100, 4055, 3899, 3886, 4007, 3999, 3807, 3764, 4102, 4517, 4518, 4135, 3965, 4384, 4976, 5004, 4359, 3729, 3728, 4093, 3990, 3066, 1926, 1402, 1552, 1705, 1423, 1045, 1107, 1588, 2009, 2109, 2064, 2062, 1962, 1536, 878, 340, 108, -18, -373, -991, -1548, -1698, -1452, -1159, -1145, -1378, -1585, -1693, -1956, -2486, -2940, -3052, -3136, -3520, -3833, -3529, -2741, -1968, -1366, -923, -789, -896, -854, -530, -248, -345, -984, -2023, -2659, -2006, -524, 165, -577, -1632, -1810, -1157, -349, 58, -232, -950, -1220, -595, 348, 938, 1228, 1470, 1577, 1527, 1621, 1950, 2145, 1902, 1439, 1248, 1489, 1731, 1419, 627, 71, 203, 514, 135, -1041, -2262, -3095, -4110, -5900, -7939, -9180, -9396, -9073, -8292, -6655, -3998, -362, 4383, 10117, 15970, 20851, 24160, 25862, 26309, 25954, 24723, 21853, 17019, 11380, 6875, 4550, 3866, 3511, 2799, 2494, 3953, 7293, 11116, 14334, 17020, 19217, 20558, 21550, 23409, 26083, 28242, 29195, 29198, 28252, 26394, 24385, 22651, 20568, 17720, 14561, 11339, 8142, 5829, 5040, 4873, 4304, 3785, 3864, 3891, 3519, 3474, 3852, 3646, 2652, 1875, 1804, 2072, 2709, 3932, 5156, 5431, 4653, 3484, 2516, 1763, 490, -2291, -6644, -11349, -15213, -18012, -19886, -20827, -21155, -21492, -21763, -21099, -19043, -16168, -13280, -10714, -8615, -7211, -6444, -5748, -4750, -3906, -3923, -4813, -6017, -7276, -8749, -10389, -11839, -12996, -14122, -15279, -16002, -15773, -14611, -12988, -11264, -9395, -7187, -4625, -2026, 148, 1734, 2971, 3948, 4355, 4150, 3949, 4177, 4377, 3986, 3199, 2512, 1975, 1412, 875, 403, -257, -1291, -2413, -3177, -3508, -3662, -3749, -3655, -3326, -2800, -2010, -898, 297, 1231, 1912, 2607, 3349, 3822, 3765, 3206, 2228, 783, -1058, -3043, -5031, -7142, -9373, -11452, -13208, -14649, -15583, -15720, -15226, -14596, -13965, -13091, -11984, -11005, -10263, -9505, -8760, -8544, -9157, -10155, -10941, -11552, -12360, -13404, -14521, -15668, -16705, -17341, -17632, -17924, -18194, -18179, -17991, -17831, -17387, -16369, -15222, -14517, -14076, -13359, -12353, -11397, -10576, -9751, -8947, -8289, -7702, -6984, -6190, -5560, -5153, -4838, -4655, -4743, -5016, -5328, -5739, -6188, -6323, -6033, -5671, -5339, -4652, -3468, -2126, -792, 717, 2323, 3658, 4654, 5564, 6352, 6633, 6318, 5800, 5310, 4550, 3292, 1900, 842, 36, -821, -1587, -1880, -1727, -1533, -1508, -1507, -1386, -1207, -1076, -1079, -1361, -1969, -2605, -2964, -3252, -3823, -4475, -4822, -5052, -5538, -6076, -6341, -6594, -7168, -7857, -8362, -8721, -8990, -9182, -9621, -10543, -11430, -11540, -10990, -10552, -10539, -10513, -10032, -9160, -8171, -7138, -6024, -4969, -4249, -3957, -3856, -3475, -2546, -1536, -1452, -2532, -3611, -3518, -2617, -2069, -2180, -2382, -2329, -2052, -1437, -340, 1079, 2496, 3665, 4425, 4869, 5541, 6982, 8843, 9893, 9255, 7501, 6112, 5986, 6735, 7323, 6999, 5767, 4367, 3732, 4196, 5252, 6183, 6685, 6793, 6600, 6381, 6691, 7681, 8537, 8354, 7534, 7307, 7906, 8313, 7939, 7343, 7073, 6970, 6860, 6966, 7281, 7299, 6705, 5811, 5094, 4679, 4491, 4520, 4608, 4322, 3486, 2682, 2703, 3527, 4326, 4540, 4412, 4325, 4235, 4140, 4409, 5101, 5624, 5622, 5521, 5671, 5754, 5504, 5243, 5219, 5123, 4641, 3941, 3340, 2931, 2684, 2574, 2527, 2449, 2423, 2686, 3292, 3945, 4343, 4540, 4778, 5141, 5563, 6082, 6747, 7370, 7631, 7499, 7327, 7419, 7652, 7621, 7109, 6273, 5410, 4699, 4158, 3748, 3436, 3187, 2990, 2914, 3073, 3498, 3998, 4267, 4192, 4022, 4119, 4478, 4679, 4442, 4007, 3835, 4052, 4437, 4750, 4908, 4924, 4845, 4699, 4449, 4055, 3553, 2965, 2203, 1235, 280, -346, -622, -842, -1188, -1457, -1361, -942, -493, -186, 2, 74, 12, 3, 357, 1011, 1420, 1211, 676, 347, 338, 388, 277, -97, -757, -1487, -1923, -1972, -1884, -1865, -1907, -1969, -2000, -1794, -1153, -292, 236, 239, 189, 568, 1211, 1677, 1943, 2237, 2467, 2394, 2159, 2208, 2685, 3189, 3142, 2410, 1581, 1389, 1775, 1926, 1389, 619, 220, 210, 339, 576, 908, 1091, 1024, 1119, 1864, 3083, 3984, 4053, 3603, 3296, 3361, 3469, 3235, 2594, 1704, 697, -353, -1262, -1705, -1552, -1163, -1100, -1487, -1836, -1606, -892, -450, -985, -2391, -3796, -4443, -4409, -4357, -4747, -5439, -5996, -6053, -5318, -3658, -1639, -498, -807, -1552, -1520, -1020, -1030, -1452, -1710, -2270, -3809, -5546, -6022, -5185, -4384, -4564, -5410, -6026, -5864, -4980, -3846, -2930, -2313, -1668, -711, 447, 1548, 2367, 2378, 845, -2025, -4658, -5722, -5762, -6202, -7142, -7120, -4845, -407, 5300, 11494, 17527, 22666, 26387, 28698, 29807, 29757, 28503, 26060, 22532, 18377, 14727, 12710, 12359, 12677, 12922, 13357, 14539, 16395, 18386, 20134, 21383, 21793, 21390, 20985, 21353, 22283, 22973, 23143, 23070, 22704, 21635, 19938, 18305, 16970, 15293, 12828, 10184, 8199, 6854, 5685, 4597, 3748, 3002, 2120, 1075, -123, -1627, -3463, -5393, -7117, -8475, -9297, -9364, -8707, -7777, -6984, -6238, -5311, -4377, -3840, -3966, -4938, -6806, -9173, -11573, -14035, -16579, -18552, -19486, -19990, -20704, -21061, -20196, -18371, -16458, -14667, -12739, -10768, -9067, -7554, -5975, -4494, -3488, -2852, -2172, -1521, -1367, -1714, -2148, -2591, -3148, -3492, -3290, -2897, -2737, -2537, -1868, -813, 428, 1872, 3333, 4388, 5016, 5616, 6289, 6684, 6673, 6627, 6830, 7073, 7109, 7133, 7362, 7580, 7567, 7506, 7469, 7099, 6264, 5325, 4360, 2975, 1141, -628, -2113, -3528, -4855, -5830, -6469, -6943, -7118, -6757, -6072, -5539, -5254, -4915, -4468, -4336, -4875, -5895, -7013, -8135, -9350, -10681, -12111, -13615, -15032, -16108, -16784, -17195, -17452, -17597, -17705, -17806, -17791, -17559, -17173, -16786, -16471, -16209, -15974, -15779, -15614, -15450, -15248, -14991, -14662, -14254, -13810, -13359, -12883, -12331, -11744, -11214, -10732, -10220, -9717, -9455, -9563, -9805, -9829, -9567, -9211, -8862, -8412, -7724, -6769, -5606, -4365, -3140, -1922, -698, 364, 1015, 1231, 1258, 1240, 979, 260, -723, -1466, -1714, -1681, -1691, -1798, -1820, -1578, -1034, -299, 435, 1005, 1293, 1244, 934, 589, 340, 32, -598, -1610, -2769, -3728, -4236, -4402, -4623, -5037, -5276, -5112, -4926, -5091, -5399, -5623, -6000, -6717, -7500, -8146, -8824, -9621, -10357, -10934, -11316, -11324, -10953, -10581, -10461, -10375, -10076, -9642, -9182, -8694, -8259, -8006, -7838, -7566, -7250, -7091, -7121, -7220, -7308, -7369, -7274, -6876, -6228, -5553, -4928, -4236, -3414, -2471, -1329, -63, 862, 1146, 1241, 1765, 2543, 2884, 2644, 2353, 2386, 2579, 2680, 2757, 3062, 3670, 4384, 4957, 5360, 5803, 6484, 7294, 7834, 7875, 7655, 7540, 7530, 7331, 6839, 6252, 5751, 5377, 5193, 5280, 5506, 5567, 5384, 5251, 5383, 5650, 5937, 6295, 6539, 6318, 5787, 5500, 5516, 5413, 5221, 5385, 5807, 5878, 5516, 5288, 5456, 5622, 5423, 5069, 4925, 4958, 4842, 4446, 3960, 3599, 3424, 3386, 3397, 3387, 3380, 3455, 3596, 3754, 4019, 4499, 5066, 5460, 5637, 5832, 6220, 6666, 6857, 6629, 6129, 5659, 5361, 5134, 4846, 4489, 4115, 3807, 3694, 3833, 4094, 4331, 4601, 4969, 5296, 5462, 5587, 5794, 5958, 5975, 6016, 6265, 6600, 6762, 6730, 6692, 6716, 6676, 6473, 6127, 5675, 5149, 4663, 4318, 4024, 3653, 3307, 3172, 3233, 3362, 3567, 3906, 4233, 4316, 4148, 3951, 3870, 3833, 3695, 3407, 2990, 2495, 2029, 1685, 1402, 1021, 513, -41, -609, -1154, -1523, -1619, -1593, -1645, -1736, -1653, -1274, -688, -132, 148, 93, -123, -285, -399, -645, -1108, -1665, -2155, -2542, -2815, -2865, -2620, -2230, -1951, -1880, -1909, -1860, -1648, -1365, -1218, -1268, -1286, -1051, -663, -329, 33, 697, 1665, 2578, 3129, 3376, 3569, 3774, 3818, 3588, 3231, 2919, 2576, 2028, 1403, 1076, 1169, 1329, 1204, 941, 943, 1227, 1394, 1303, 1260, 1393, 1337, 858, 334, 313, 822, 1315, 1159, 320, -416, -335, 158, 86, -615, -1228, -1635, -2239, -2791, -2663, -1980, -1377, -1186, -1570, -2515, -3238, -2922, -2213, -2483, -3630, -4305, -4127, -3958, -4002, -3302, -1411, 648, 1559, 1178, 401, 24, 185, 463, 147, -1150, -2781, -3517, -2985, -1914, -839, 461, 1999, 3093, 3336, 3217, 3296, 3392, 3081, 2458, 1796, 972, 32, -254, 630, 1852, 2195, 1793, 1784, 2437, 2803, 2329, 1657, 1422, 1358, 1219, 1441, 2001, 1783, 227, -1564, -2433, -2540, -2441, -2223, -2106, -2295, -1886, 560, 5231, 10918, 16335, 20640, 23417, 24972, 25997, 26606, 26410, 25210, 22791, 18907, 14400, 11252, 10343, 10482, 10425, 10455, 11211, 12447, 13781, 15399, 17307, 18829, 19431, 19461, 19540, 19735, 19742, 19589, 19494, 19283, 18571, 17396, 16064, 14611, 12986, 11294, 9587, 7896, 6573, 5788, 4935, 3475, 2017, 1393, 1207, 378, -1308, -3206, -4901, -6437, -7807, -8737, -8857, -8042, -6718, -5627, -5005, -4336, -3207, -2022, -1521, -1988, -3214, -4926, -6930, -9020, -10962, -12615, -13965, -15024, -15734, -16015, -15863, -15367, -14583, -13466, -11964, -10195, -8445, -6879, -5376, -3799, -2380, -1473, -1012, -581, -3, 464, 540, 219, -328, -884, -1213, -1179, -851, -479, -371, -610, -802, -436, 384, 965, 994, 958, 1306, 1732, 1764, 1563, 1644, 2063, 2392, 2478, 2668, 3197, 3781, 4030, 3914, 3636, 3329, 3021, 2599, 1813, 514, -1122, -2860, -4627, -6303, -7608, -8468, -9184, -9978, -10620, -10681, -10056, -9076, -8196, -7628, -7236, -6836, -6493, -6395, -6591, -7016, -7661, -8500, -9364, -10122, -10824, -11526, -12200, -12869, -13561, -14106, -14355, -14503, -14839, -15261, -15396, -15192, -14943, -14807, -14638, -14321, -13973, -13674, -13259, -12585, -11797, -11120, -10548, -9965, -9341, -8695, -8007, -7355, -6922, -6776, -6788, -6854, -7001, -7258, -7585, -7939, -8296, -8550, -8549, -8251, -7787, -7237, -6514, -5548, -4456, -3376, -2351, -1444, -743, -231, 168, 364, 272, 69, 0, -22, -246, -651, -973, -1088, -1113, -1182, -1291, -1382, -1452, -1583, -1853, -2242, -2640, -2972, -3284, -3667, -4128, -4572, -4890, -5037, -5053, -4942, -4664, -4267, -3989, -3993, -4115, -4133, -4170, -4512, -5124, -5744, -6366, -7209, -8238, -9070, -9462, -9571, -9692, -9885, -9977, -9841, -9528, -9160, -8777, -8359, -7917, -7496, -7091, -6655, -6194, -5823, -5661, -5713, -5780, -5607, -5187, -4862, -4894, -5016, -4730, -4011, -3294, -2777, -2189, -1395, -703, -369, -141, 331, 892, 1088, 882, 764, 1017, 1239, 978, 588, 818, 1668, 2377, 2608, 2849, 3466, 4196, 4779, 5355, 5970, 6347, 6368, 6287, 6252, 6041, 5527, 4994, 4666, 4337, 3886, 3677, 3909, 4088, 3765, 3307, 3267, 3550, 3776, 3885, 3935, 3776, 3357, 2929, 2678, 2528, 2417, 2460, 2589, 2474, 2024, 1721, 2020, 2623, 2843, 2573, 2373, 2573, 2840, 2768, 2458, 2207, 2000, 1700, 1395, 1156, 780, 245, -63, 0, 40, -132, -66, 569, 1420, 2067, 2627, 3359, 4130, 4613, 4752, 4769, 4853, 4952, 4877, 4542, 4102, 3849, 3965, 4325, 4616, 4702, 4744, 4911, 5115, 5182, 5143, 5168, 5303, 5398, 5340, 5232, 5284, 5531, 5800, 5954, 6099, 6382, 6685, 6731, 6488, 6244, 6201, 6212, 6029, 5678, 5414, 5314, 5135, 4678, 4175, 4009, 4089, 3880, 3193, 2491, 2203, 2186, 2147, 2122, 2265, 2518, 2765, 3017, 3289, 3504, 3557, 3358, 2889, 2305, 1837, 1477, 1016, 403, -120, -294, -95, 268, 530, 577, 576, 712, 874, 829, 605, 430, 368, 343, 361, 432, 467, 486, 689, 1102, 1420, 1419, 1242, 1194, 1376, 1626, 1702, 1532, 1320, 1352, 1605, 1722, 1465, 1104, 1086, 1369, 1513, 1422, 1485, 1827, 2128, 2309, 2686, 3264, 3662, 3822, 4081, 4507, 4815, 4922, 5020, 5160, 5215, 5197, 5224, 5275, 5176, 4828, 4352, 4019, 4011, 4260, 4524, 4600, 4397, 3913, 3296, 2871, 2871, 3131, 3160, 2623, 1669, 851, 714, 1331, 2190, 2636, 2493, 2153, 2041, 2104, 1842, 846, -649, -1898, -2565, -3188, -4288, -5410, -5784, -5563, -5517, -5718, -5493, -4689, -4123, -4459, -5229, -5414, -4709, -3865, -3748, -4406, -5208, -5689, -5983, -6425, -7037, -7637, -8342, -9487, -10879, -11374, -9787, -6266, -2387, 548, 2939, 6098, 10296, 14456, 17543, 19304, 19767, 19057, 17688, 16284, 15122, 14329, 14038, 13955, 13605, 13245, 13742, 15210, 16744, 17629, 18061, 18435, 18737, 18825, 18917, 19406, 20304, 21108, 21289, 20943, 20611, 20478, 20216, 19657, 18966, 18107, 16821, 15333, 14259, 13689, 13084, 12182, 11240, 10285, 8867, 6804, 4582, 2694, 1017, -802, -2621, -3942, -4623, -4961, -5094, -4799, -3921, -2717, -1666, -1100, -996, -1100, -1315, -1824, -2721, -3750, -4677, -5656, -6938, -8380, -9558, -10269, -10666, -10900, -10961, -10867, -10708, -10386, -9646, -8534, -7458, -6647, -5888, -4974, -4022, -3244, -2741, -2534, -2497, -2276, -1633, -806, -263, -165, -220, -50, 423, 918, 1107, 972, 767, 647, 536, 381, 255, 174, 35, -142, -133, 164, 527, 716, 872, 1348, 2171, 2977, 3517, 3930, 4389, 4738, 4678, 4193, 3574, 3017, 2338, 1188, -464, -2175, -3510, -4496, -5381, -6175, -6724, -7017, -7116, -6981, -6635, -6263, -5984, -5708, -5419, -5331, -5561, -5909, -6097, -6121, -6150, -6220, -6254, -6291, -6518, -7012, -7668, -8379, -9140, -9966, -10878, -11896, -12925, -13785, -14420, -14915, -15248, -15314, -15151, -14936, -14720, -14425, -14005, -13449, -12727, -11889, -11031, -10132, -9192, -8428, -8086, -8079, -8113, -8130, -8314, -8737, -9300, -9931, -10630, -11295, -11686, -11640, -11240, -10745, -10327, -9925, -9425, -8861, -8328, -7784, -7167, -6602, -6204, -5809, -5160, -4323, -3599, -3119, -2744, -2306, -1786, -1257, -884, -927, -1506, -2322, -2891, -3111, -3369, -3953, -4746, -5559, -6306, -6789, -6772, -6396, -6067, -5896, -5644, -5124, -4372, -3557, -2922, -2632, -2580, -2537, -2505, -2652, -3011, -3537, -4285, -5227, -6033, -6370, -6386, -6627, -7391, -8417, -9232, -9614, -9595, -9321, -9045, -9018, -9193, -9293, -9205, -9003, -8641, -8052, -7496, -7284, -7315, -7208, -6767, -6037, -5196, -4533, -4170, -3853, -3364, -3013, -3164, -3510, -3479, -3213, -3445, -4334, -5057, -4800, -3837, -3248, -3589, -4184, -3978, -2823, -1478, -507, 233, 986, 1607, 1945, 2199, 2674, 3409, 4097, 4271, 3732, 2963, 2786, 3408, 4175, 4401, 4052, 3519, 3170, 3214, 3604, 3947, 3781, 3056, 2234, 1902, 2248, 2826, 2943, 2419, 1772, 1572, 1837, 2259, 2662, 2973, 3080, 3009, 3029, 3355, 3891, 4352, 4495, 4231, 3693, 3183, 2963, 3027, 3084, 2777, 2018, 1175, 784, 980, 1352, 1470, 1387, 1402, 1577, 1761, 2020, 2608, 3429, 3963, 3976, 3907, 4209, 4748, 5177, 5485, 5800, 6066, 6190, 6193, 6100, 6000, 6082, 6320, 6319, 5828, 5180, 4886, 4949, 4954, 4684, 4339, 4160, 4138, 4193, 4377, 4737, 5131, 5388, 5504, 5616, 5873, 6306, 6712, 6758, 6398, 5988, 5805, 5657, 5232, 4617, 4139, 3848, 3445, 2744, 2006, 1644, 1653, 1534, 990, 446, 461, 843, 870, 373, -17, 165, 561, 573, 206, -13, 204, 564, 666, 560, 580, 771, 868, 846, 1050, 1551, 1786, 1265, 395, 98, 561, 905, 309, -864, -1516, -1184, -505, -229, -238, 190, 1341, 2668, 3495, 3808, 4084, 4508, 4741, 4499, 4010, 3678, 3495, 3133, 2554, 2111, 1976, 1927, 1896, 2197, 2885, 3340, 3081, 2562, 2566, 3022, 3098, 2437, 1694, 1617, 1999, 2013, 1403, 864, 1137, 2064, 2832, 2964, 2807, 2963, 3469, 3828, 3747, 3380, 2838, 1933, 593, -1041, -3078, -5842, -9151, -12183, -14306, -15628, -16502, -16782, -15766, -12954, -8824, -4597, -908, 2901, 7568, 12340, 15458, 16158, 15455, 14830, 14728, 14635, 14067, 13087, 11979, 10898, 9980, 9559, 9877, 10657, 11336, 11675, 11858, 12102, 12600, 13661, 15245, 16638, 17205, 17282, 17664, 18403, 18889, 18838, 18650, 18880, 19722, 20896, 21939, 22683, 23334, 23884, 23896, 23136, 21877, 20323, 18265, 15540, 12272, 8736, 5456, 3217, 2323, 2070, 1601, 1062, 1240, 2274, 3496, 4471, 5493, 6756, 7788, 8158, 8165, 8201, 8049, 7370, 6328, 5210, 3890, 2180, 264, -1520, -3041, -4335, -5459, -6348, -6748, -6553, -6123, -5916, -5959, -6107, -6489, -7116, -7478, -7237, -6864, -6918, -7081, -6597, -5374, -4019, -2916, -1881, -763, 91, 237, -257, -912, -1453, -2038, -2910, -4014, -5092, -5984, -6742, -7436, -7965, -8177, -8110, -7915, -7548, -6789, -5619, -4318, -3082, -1791, -292, 1228, 2381, 2988, 3193, 3154, 2848, 2220, 1352, 389, -599, -1594, -2517, -3259, -3777, -4124, -4393, -4645, -4907, -5179, -5418, -5526, -5465, -5349, -5349, -5480, -5480, -5041, -4236, -3532, -3201, -2985, -2587, -2167, -1978, -1957, -2064, -2580, -3604, -4742, -5706, -6742, -8108, -9649, -11135, -12619, -14096, -15177, -15567, -15570, -15666, -15751, -15373, -14545, -13677, -12871, -12004, -11268, -10929, -10780, -10514, -10288, -10393, -10751, -11119, -11398, -11547, -11530, -11522, -11767, -12199, -12531, -12584, -12402, -12200, -12242, -12524, -12714, -12616, -12449, -12369, -12151, -11679, -11229, -10895, -10253, -9035, -7593, -6374, -5301, -4101, -2853, -1882, -1280, -958, -1020, -1636, -2619, -3554, -4372, -5337, -6445, -7329, -7816, -8159, -8515, -8603, -8126, -7292, -6605, -6236, -5899, -5302, -4489, -3716, -3204, -2984, -2879, -2731, -2645, -2811, -3165, -3558, -4083, -4821, -5489, -5830, -6061, -6501, -7092, -7561, -7730, -7564, -7370, -7681, -8457, -8924, -8781, -8771, -9348, -9748, -9189, -8105, -7332, -6856, -6090, -4858, -3554, -2598, -2130, -2065, -2192, -2324, -2470, -2791, -3306, -3751, -3923, -4022, -4368, -4849, -4994, -4605, -4029, -3690, -3586, -3397, -2883, -2055, -1074, -166, 469, 875, 1343, 2046, 2753, 3093, 3060, 3029, 3266, 3588, 3613, 3246, 2809, 2714, 3048, 3448, 3419, 2878, 2294, 2149, 2346, 2361, 1956, 1468, 1341, 1601, 1885, 1916, 1839, 2017, 2548, 3106, 3367, 3413, 3598, 4030, 4439, 4521, 4291, 4022, 3927, 3972, 3980, 3836, 3529, 3076, 2589, 2337, 2477, 2727, 2680, 2385, 2248, 2400, 2570, 2585, 2554, 2610, 2774, 3054, 3413, 3769, 4110, 4451, 4700, 4787, 4854, 5033, 5272, 5535, 5884, 6181, 6139, 5853, 5811, 6193, 6581, 6585, 6393, 6386, 6580, 6774, 7020, 7419, 7692, 7577, 7455, 7823, 8406, 8557, 8298, 8179, 8382, 8655, 8832, 8897, 8819, 8693, 8685, 8703, 8507, 8166, 7995, 8014, 7880, 7404, 6834, 6554, 6588, 6563, 6176, 5625, 5342, 5343, 5221, 4786, 4317, 4067, 3995, 4046, 4217, 4327, 4193, 4031, 4230, 4732, 5052, 4943, 4670, 4594, 4741, 4879, 4811, 4542, 4256, 4208, 4524, 5041, 5419, 5504, 5404, 5234, 4973, 4632, 4329, 4113, 3889, 3567, 3212, 2980, 2965, 3098, 3179, 3056, 2868, 2996, 3625, 4371, 4676, 4570, 4587, 4933, 5330, 5717, 6320, 6938, 6951, 6266, 5542, 5309, 5379, 5288, 4862, 4239, 3623, 3125, 2755, 2494, 2369, 2402, 2519, 2564, 2456, 2296, 2276, 2440, 2607, 2565, 2320, 2111, 2154, 2432, 2719, 2838, 2844, 2861, 2818, 2572, 2192, 1844, 1494, 1004, 423, -133, -670, -1157, -1419, -1470, -1604, -1959, -2312, -2403, -2176, -1720, -1257, -1027, -951, -639, 16, 618, 839, 816, 777, 680, 434, 179, 57, -65, -348, -640, -702, -631, -689, -805, -684, -362, -213, -302, -231, 172, 468, 324, 124, 306, 561, 428, 204, 423, 824, 816, 584, 775, 1333, 1577, 1350, 1274, 1710, 2205, 2275, 2100, 2028, 1997, 1863, 1640, 1103, -95, -1656, -2861, -3564, -4085, -4371, -4215, -3882, -3646, -3288, -2727, -2387, -2404, -2318, -1951, -1784, -2138, -2690, -3031, -3198, -3431, -3792, -4189, -4585, -5081, -5758, -6544, -7241, -7685, -7893, -8029, -8141, -8007, -7473, -6815, -6414, -6195, -5876, -5509, -5224, -4837, -4201, -3537, -3009, -2515, -2089, -1733, -975, 476, 1884, 2410, 2423, 2803, 3419, 3488, 3039, 2863, 3208, 3451, 3073, 2344, 1909, 2096, 2781, 3579, 4036, 3949, 3729, 4098, 5198, 6395, 7109, 7453, 7852, 8391, 8788, 8856, 8794, 8932, 9177, 8993, 8118, 7049, 6385, 6127, 6000, 5931, 5765, 5190, 4326, 3687, 3372, 3080, 2836, 2756, 2407, 1470, 621, 658, 1212, 1339, 925, 627, 731, 857, 679, 338, 91, -79, -354, -775, -1222, -1608, -1923, -2229, -2657, -3268, -3899, -4334, -4598, -4903, -5331, -5759, -6022, -6087, -6116, -6319, -6632, -6740, -6595, -6590, -6959, -7326, -7247, -6871, -6647, -6632, -6453, -5908, -5266, -4929, -4963, -5091, -5032, -4779, -4576, -4623, -4832, -4912, -4774, -4639, -4647, -4649, -4589, -4674, -4872, -4780, -4273, -3823, -3749, -3679, -3081, -2005, -997, -485, -476, -681, -768, -609, -411, -519, -1001, -1502, -1652, -1556, -1658, -2065, -2308, -2097, -1943, -2465, -3381, -3940, -4095, -4393, -4920, -5254, -5227, -4977, -4601, -4286, -4317, -4496, -4218, -3477, -3126, -3662, -4448, -4651, -4446, -4613, -5224, -5577, -5406, -5297, -5714, -6371, -6832, -7150, -7579, -8159, -8704, -9016, -9061, -9065, -9279, -9572, -9496, -8912, -8291, -8191, -8582, -8923, -8870, -8594, -8386, -8304, -8304, -8379, -8508, -8634, -8778, -8981, -9181, -9341, -9564, -9923, -10256, -10380, -10332, -10311, -10378, -10367, -10049, -9404, -8636, -7985, -7499, -6992, -6278, -5405, -4627, -4137, -3879, -3643, -3283, -2819, -2429, -2339, -2554, -2719, -2411, -1658, -987, -822, -996, -1030, -751, -340, 96, 593, 1015, 1158, 1120, 1104, 1021, 797, 792, 1303, 1942, 2120, 1956, 2083, 2616, 2944, 2587, 1814, 1198, 921, 781, 573, 177, -396, -869, -912, -628, -449, -537, -730, -927, -1089, -1005, -568, -111, -45, -285, -396, -190, 141, 402, 589, 708, 680, 539, 430, 341, 129, -104, 7, 597, 1336, 1909, 2412, 3044, 3642, 3922, 3984, 4183, 4508, 4590, 4342, 4110, 4159, 4403, 4678, 4932, 5144, 5325, 5552, 5822, 5948, 5786, 5448, 5151, 4918, 4657, 4450, 4507, 4827, 5190, 5522, 5867, 6066, 5875, 5389, 4923, 4557, 4219, 4010, 4035, 4155, 4193, 4176, 4176, 4210, 4343, 4597, 4756, 4590, 4201, 3840, 3546, 3199, 2801, 2523, 2561, 2969, 3507, 3873, 4217, 4965, 5982, 6525, 6270, 5737, 5460, 5464, 5658, 6024, 6360, 6468, 6518, 6673, 6700, 6436, 6210, 6353, 6651, 6652, 6232, 5667, 5401, 5757, 6650, 7609, 8211, 8379, 8205, 7731, 7071, 6486, 6172, 6061, 5979, 5934, 6189, 6945, 8005, 8815, 8956, 8524, 7927, 7414, 6974, 6606, 6421, 6399, 6285, 5825, 5076, 4437, 4244, 4362, 4304, 3887, 3444, 3299, 3416, 3739, 4425, 5447, 6423, 7059, 7395, 7497, 7350, 6997, 6438, 5517, 4284, 3255, 2940, 3246, 3674, 3995, 4417, 5148, 5991, 6449, 6224, 5526, 4802, 4243, 3724, 3156, 2627, 2216, 1955, 1991, 2545, 3650, 5012, 6185, 6810, 6759, 6150, 5257, 4294, 3264, 2146, 1177, 783, 1134, 1970, 2902, 3608, 3722, 2946, 1455, -136, -1319, -2007, -2277, -2114, -1461, -393, 828, 1822, 2369, 2579, 2668, 2536, 1822, 418, -1241, -2479, -2943, -2808, -2397, -1719, -543, 1001, 2209, 2407, 1671, 608, -466, -1778, -3443, -4953, -5573, -5103, -3969, -2661, -1338, -68, 878, 1265, 1250, 1181, 1078, 698, 39, -607, -1039, -1250, -1199, -888, -595, -644, -935, -1109, -1126, -1382, -2106, -2957, -3384, -3232, -2773, -2260, -1719, -1089, -425, 41, 15, -562, -1342, -1936, -2374, -2964, -3833, -4799, -5455, -5206, -3632, -1164, 913, 1555, 884, -137, -846, -1452, -2538, -4195, -5789, -6613, -6536, -5932, -5107, -4114, -3041, -2183, -1774, -1776, -2017, -2400, -2810, -2927, -2412, -1358, -350, 65, -119, -512, -892, -1399, -2176, -2922, -3085, -2562, -1890, -1511, -1180, -498, 343, 842, 858, 548, 33, -485, -746, -815, -995, -1261, -1384, -1503, -1917, -2425, -2474, -1836, -722, 552, 1655, 2304, 2529, 2610, 2558, 2020, 899, -208, -639, -540, -665, -1251, -1641, -1276, -618, -591, -1384, -2333, -2866, -2945, -2495, -1130, 1108, 3237, 4130, 3677, 2656, 1574, 219, -1495, -2843, -2914, -1701, -123, 900, 1136, 889, 497, 46, -398, -545, -195, 256, 214, -282, -767, -1251, -2027, -2764, -2787, -2168, -1591, -1382, -1490, -2085, -3271, -4405, -4460, -3128, -1233, 17, 147, -250, -412, -443, -939, -1687, -1607, -349, 801, 361, -1442, -3057, -3757, -4328, -5356, -5930, -4795, -2090, 784, 2498, 2479, 875, -1533, -3589, -4481, -4247, -3452, -2521, -1508, -491, 95, -134, -880, -1341, -1268, -1332, -2155, -3388, -4123, -3894, -2853, -1354, 201, 1271, 1455, 859, 53, -514, -1034, -2117, -3779, -5003, -4829, -3572, -2226, -1124, -80, 598, 341, -747, -2015, -2972, -3256, -2491, -972, -18, -776, -2790, -4447, -4868, -4801, -5315, -6043, -5426, -2795, 374, 1756, 493, -2125, -4224, -5108, -5273, -5162, -4563, -3198, -1358, 240, 879, 49, -2252, -5204, -7387, -7676, -5972, -3226, -864, -59, -981, -2515, -3102, -2364, -1589, -2217, -4126, -5860, -6252, -5343, -4010, -3119, -2886, -2769, -2169, -1340, -1270, -2414, -3931, -4587, -4173, -3372, -2532, -1482, -572, -802, -2497, -4563, -5632, -5522, -5102, -4975, -4780, -3866, -2360, -1220, -1240, -2160, -2923, -2964, -2930, -3496, -3912, -3035, -1481, -930, -1440, -1570, -1168, -1650, -3234, -4156, -3232, -1478, -593, -871, -1055, 114, 2325, 3785, 3163, 1024, -1080, -2353, -2966, -3242, -3258, -2798, -1479, 488, 1963, 2157, 1684, 1293, 538, -909, -1782, -652, 1904, 3926, 4301, 3495, 2569, 2149, 1950, 1051, -993, -3164, -3514, -1080, 2903, 5965, 6559, 5143, 3167, 1418, -365, -2403, -3780, -2915, 572, 4754, 6837, 5845, 3337, 1389, 504, -179, -1241, -2241, -2371, -1186, 1366, 4912, 8201, 9268, 6908, 2146, -2291, -4181, -3193, -244, 3599, 7112, 8680, 7223, 3484, -274, -2130, -1824, -348, 1239, 2331, 2715, 2726, 3337, 5217, 7403, 7802, 5700, 3015, 2042, 2471, 1999, -144, -1669, 40, 4503, 8332, 8731, 6079, 2913, 1105, 834, 1680, 3318, 4962, 5622, 5347, 5052, 4890, 4060, 2331, 453, -884, -1370, -613, 1551, 4572, 7419, 8798, 7628, 4505, 1867, 1032, 262, -2173, -4450, -3081, 2403, 8562, 11109, 8140, 1547, -4176, -5638, -3217, 563, 4160, 7208, 8910, 8222, 5240, 1300, -2080, -4101, -4818, -4222, -1246, 4782, 11199, 12739, 6955, -2458, -9227, -10324, -7271, -2941, 1370, 5861, 10209, 12501, 10754, 5363, -969, -5780, -8320, -8520, -6016, -996, 4694, 8004, 6806, 2150, -2183, -3557, -3198, -3412, -3347, -501, 4068, 5771, 2682, -1434, -2159, -95, 949, -273, -1670, -1982, -2223, -2761, -2105, 469, 3505, 5498, 6463, 6430, 4341, 79, -3769, -4276, -1789, 672, 1372, 1397, 2319, 3861, 4115, 1466, -3323, -6827, -5747, -341, 5743, 8877, 7929, 4214, 369, -1276, -533, 634, 514, -339, -5, 2294, 4903, 5163, 2511, -275, -266, 1544, 1435, -1562, -3853, -1886, 3419, 8012, 8983, 6440, 2162, -2202, -5521, -6657, -4796, -717, 3022, 4322, 3773, 3592, 4310, 3781, 348, -3969, -4999, -1254, 4052, 6563, 5392, 3092, 1689, 504, -1644, -3716, -3501, -786, 2066, 3002, 2640, 3002, 4345, 4457, 1709, -2088, -3343, -1076, 1877, 2643, 1876, 2446, 5342, 8275, 8195, 4017, -2864, -9193, -10980, -6232, 2412, 9322, 11080, 8909, 5729, 2740, -146, -2392, -3106, -2504, -1421, 276, 3253, 6668, 8201, 6633, 3200, -68, -2339, -3838, -4616, -4133, -1926, 1631, 5203, 7165, 6685, 4239, 824, -3072, -6760, -8163, -5407, 144, 4763, 6593, 6652, 5703, 3216, -207, -2499, -2981, -3102, -3588, -2957, 85, 4226, 6675, 5921, 2532, -1822, -5028, -5344, -3085, -688, 154, 323, 1125, 1817, 801, -1751, -3812, -3707, -1790, -41, 45, -797, -431, 1876, 4136, 3719, 330, -3728, -5979, -5526, -2785, 879, 3179, 2561, 496, 186, 2107, 2876, -18, -4128, -4789, -1182, 2739, 3367, 1244, -709, -594, 1306, 2763, 1032, -3837, -7813, -7261, -3234, 849, 3610, 5271, 5272, 3121, -116, -2966, -4745, -4988, -3517, -1366, 24, 534, 987, 1348, 609, -1508, -3663, -4174, -3022, -2001, -2418, -3063, -1437, 2817, 6660, 6619, 2582, -2304, -5337, -6349, -5982, -4145, -1348, 698, 1390, 2159, 3521, 3353, 93, -4062, -5340, -2886, 568, 2116, 1368, -191, -1303, -1711, -1604, -1348, -1633, -2955, -4448, -4000, -365, 4738, 7406, 5102, -578, -5194, -5675, -3006, -508, 4, -503, -516, 170, 1149, 2302, 3076, 2224, -796, -4909, -8280, -9231, -6638, -938, 4950, 7452, 5948, 3231, 1424, -689, -4402, -7304, -6029, -1581, 1729, 2216, 2224, 3448, 4156, 2117, -2014, -5611, -6912, -5802, -2998, 281, 2768, 4430, 6261, 7856, 6720, 1513, -5198, -9202, -8953, -5986, -1809, 3051, 7059, 8029, 6190, 3658, 585, -4004, -7736, -6580, -1282, 3106, 4114, 3502, 2884, 2124, 1061, -586, -3553, -6871, -7448, -3852, 1314, 4399, 4654, 3940, 3563, 2713, -150, -5094, -9904, -11136, -6616, 1984, 9313, 10457, 5447, -1172, -5302, -6635, -6827, -6270, -4220, -1014, 1835, 3531, 4358, 4194, 2240, -1270, -4422, -5623, -5183, -3912, -1600, 1585, 4068, 4965, 4928, 3421, -1122, -6656, -7917, -3946, -184, -439, -1799, -286, 2915, 3832, 1299, -2368, -4547, -4364, -2578, -785, -258, -528, 356, 2927, 4293, 1133, -5266, -9281, -7246, -1760, 1804, 1835, 1357, 2532, 3010, -522, -6677, -9791, -6348, 725, 5264, 4550, 1159, -1531, -2876, -3109, -1490, 1265, 1819, -1461, -5488, -6345, -3811, 102, 4215, 7117, 5896, -298, -6835, -7707, -2870, 2138, 3779, 3515, 3091, 1730, -688, -2271, -2686, -4093, -6530, -6142, -855, 5211, 6594, 3470, -245, -3416, -7033, -9049, -6079, 534, 5662, 6596, 4417, 1055, -1616, -2050, -1218, -2104, -4886, -5546, -1645, 3171, 3549, -283, -3118, -2260, -605, -1153, -2237, -1001, 1198, 979, -1018, -1186, 310, -657, -4533, -5871, -1211, 5529, 8324, 6073, 1884, -1608, -3626, -3929, -2714, -1183, -390, 158, 1376, 2623, 2424, 493, -2393, -5261, -6182, -2906, 3715, 9056, 9279, 4744, -1708, -7280, -9633, -7727, -3119, 1282, 3963, 5094, 4671, 2226, -1440, -3939, -3676, -1521, 581, 1336, 44, -2847, -4552, -2345, 2172, 4542, 3498, 1743, 853, -182, -1316, -977, 141, -896, -4143, -5183, -902, 5593, 8415, 5828, 1166, -2156, -3549, -3604, -2580, -1088, -162, 54, 331, 772, 618, -72, -83, 828, 1012, -552, -2246, -1943, -119, 983, 671, 452, 1385, 2280, 1311, -1258, -3072, -2685, -1533, -1823, -3090, -2508, 1090, 4985, 5404, 1950, -1898, -2778, -1013, 468, 240, -38, 1357, 3116, 2457, -680, -3048, -2251, 211, 1349, 914, 1211, 2971, 3743, 1402, -2436, -4130, -2400, 424, 1516, 768, 364, 1603, 3193, 3147, 1223, -1456, -3777, -4375, -1897, 2610, 5576, 5007, 2637, 768, -428, -1514, -2503, -3567, -4348, -2795, 2168, 7173, 7194, 2274, -2056, -2255, -1243, -3032, -5823, -4357, 2216, 8699, 9865, 5140, -2341, -8234, -8584, -2470, 5709, 9421, 7036, 3197, 1605, -1, -4592, -9038, -7440, 178, 7116, 8037, 4376, 966, -182, -856, -2332, -2704, 104, 4215, 5281, 2063, -1793, -2299, 332, 2676, 2439, 708, 143, 1636, 3222, 2552, -208, -2850, -3723, -2438, 926, 5159, 7145, 4291, -2233, -7942, -8645, -3601, 3499, 6879, 4110, -884, -2397, 40, 1804, -163, -3711, -4853, -2536, 879, 2769, 2752, 1914, 473, -2317, -5810, -7330, -5069, -481, 3345, 4924, 4877, 3927, 1934, -875, -2993, -2808, -395, 2382, 3365, 1784, -984, -2475, -1604, 129, 755, 523, 1150, 2601, 2564, -120, -3093, -3122, -128, 3149, 4607, 3918, 1468, -1516, -3010, -2441, -1359, -373, 1941, 5421, 6808, 3899, -1315, -5173, -5895, -3791, 10, 3972, 6558, 7059, 5504, 1900, -3076, -6638, -5455, 15, 4866, 5253, 2685, 839, 282, -800, -2223, -1847, 316, 1677, 1477, 1991, 3889, 4268, 1570, -1296, -1542, -589, -713, -929, 590, 2586, 2313, -199, -1924, -545, 3093, 6240, 6774, 4204, -653, -5889, -8844, -7527, -2249, 4123, 7834, 6951, 2720, -2084, -5540, -6379, -3101, 3955, 10433, 10852, 3926, -6265, -13457, -12798, -3929, 7576, 13773, 11130, 2871, -5208, -9300, -8512, -4186, 970, 4438, 5192, 3544, 590, -2069, -3142, -2628, -1462, -159, 1323, 2460, 2132, 459, -590, 264, 1524, 1096, -533, -1295, -618, 492, 1349, 1540, 266, -2179, -3367, -1448, 1767, 2890, 1701, 774, 393, -1981, -5996, -6893, -2169, 4359, 7592, 6500, 2778, -1724, -4360, -2523, 2487, 5206, 1997, -4143, -6688, -3156, 1979, 2785, -950, -4058, -3098, -41, 1830, 2386, 3034, 3250, 1119, -3726, -8887, -10347, -5474, 3515, 10130, 9791, 4661, 208, -1770, -3695, -6411, -6846, -2862, 2582, 4827, 3404, 1622, 976, -530, -3832, -6113, -4978, -2335, -931, 157, 2702, 4804, 3723, 793, -819, -843, -938, -1645, -2570, -2883, -923, 3470, 6712, 5091, -387, -5646, -8036, -6746, -1633, 5259, 9279, 7306, 1266, -4468, -7923, -9449, -8283, -3018, 4346, 8784, 8070, 5020, 2635, 251, -3774, -8241, -9960, -7029, -287, 7198, 11292, 9067, 1609, -5785, -7718, -3691, 1531, 2967, 144, -3620, -5208, -3525, 1011, 6089, 7660, 3639, -3229, -8399, -9708, -6623, 1009, 10129, 14153, 9619, 677, -5899, -7653, -6429, -4278, -1745, 1111, 3621, 4466, 2876, -211, -2931, -4324, -4486, -3489, -1351, 1433, 4176, 5807, 4272, -1531, -8292, -9661, -3240, 5845, 10302, 8121, 3199, -211, -1818, -3910, -6736, -7191, -3194, 2608, 6012, 6211, 4754, 1958, -2052, -5161, -5820, -5424, -5116, -3084, 1854, 6774, 7858, 5089, 1266, -1963, -4475, -5319, -3121, 1078, 4184, 4774, 3914, 2312, -295, -3016, -4219, -3869, -2773, -657, 2595, 5346, 5630, 2718, -2845, -8317, -9144, -3844, 2911, 5591, 4354, 3085, 3212, 3023, 1530, -337, -1739, -2669, -2882, -1973, -394, 1271, 3498, 5950, 5617, 532, -5606, -7296, -4949, -3467, -3724, -1593, 3905, 7431, 4613, -1739, -5518, -4555, -1080, 2770, 6166, 7315, 4196, -1736, -5708, -4725, -598, 2942, 4021, 2691, -360, -3450, -4203, -2382, -743, -947, -661, 2403, 5493, 3764, -2436, -6946, -5332, -354, 1927, 195, -776, 2471, 6397, 5285, -435, -5031, -5216, -2475, 975, 3747, 3981, 1037, -2561, -4032, -3472, -2031, 37, 1603, 405, -3142, -4818, -1820, 3006, 4731, 2723, 572, 486, 1192, 1154, 377, -793, -1419, 475, 4796, 7573, 5546, 563, -3373, -4867, -4605, -2998, -698, 723, 547, -65, 168, 1062, 1842, 2215, 1690, -531, -3355, -3201, 1594, 6943, 6901, 1125, -4556, -5227, -1943, 770, 494, -1157, -1407, 211, 1709, 1456, 125, -566, -497, -1287, -3405, -4589, -2757, 693, 2533, 1718, -291, -1882, -1885, 440, 3770, 4798, 2161, -1209, -1615, 801, 2661, 1632, -1458, -4248, -4983, -3182, 223, 3071, 3641, 2311, 392, -1840, -4187, -4845, -2366, 1435, 3046, 1319, -1531, -2233, 940, 6409, 9608, 6694, -1353, -9235, -11909, -8296, -1405, 4283, 6310, 5714, 4686, 3272, -96, -5021, -8031, -6108, -354, 4779, 5646, 2232, -2520, -5252, -4413, -1175, 1678, 2406, 1607, 805, 747, 1462, 2502, 2568, 529, -2486, -3608, -1652, 1298, 2612, 2219, 1814, 1898, 1198, -1016, -3516, -4467, -3252, -735, 1532, 2307, 1595, 629, 276, -68, -1174, -1981, -420, 3462, 6573, 5952, 2071, -2036, -4297, -5007, -5079, -4353, -2208, 1148, 4669, 7069, 7050, 4146, -83, -3240, -4990, -6714, -7877, -5792, 11, 6190, 9478, 9521, 7098, 2195, -4770, -11214, -13088, -7876, 2328, 11028, 12303, 6438, -466, -3312, -3020, -3322, -4421, -3368, 172, 3069, 3890, 4310, 4645, 2691, -1558, -4421, -3604, -1427, -873, -1221, -5, 2601, 4217, 4150, 3753, 3002, -45, -5166, -8185, -5614, 501, 4816, 5008, 3488, 3046, 3363, 2461, -560, -4847, -8284, -8457, -4488, 1970, 7859, 10341, 8290, 3693, -155, -3283, -8158, -12557, -9715, 924, 10185, 10812, 6070, 2726, 1981, 1609, 1153, 453, -2596, -8130, -11046, -6454, 3133, 10529, 12552, 11123, 7213, -24, -8367, -12736, -10804, -4347, 4040, 11539, 13993, 8918, -373, -7099, -7989, -5573, -3319, -1496, 845, 2798, 3092, 2719, 3380, 4409, 3586, 432, -3036, -4614, -3802, -1498, 1187, 3500, 4947, 5022, 3138, -747, -5000, -6786, -4874, -1200, 1527, 2678, 2932, 2396, 1237, 720, 1776, 3351, 3014, -846, -6584, -9153, -5218, 1606, 4727, 3462, 2464, 3201, 2922, 1221, 190, -1122, -4957, -8234, -5120, 3416, 9042, 6584, -113, -4805, -6184, -5546, -2515, 2204, 4717, 3710, 3467, 6190, 6683, 129, -9431, -13371, -8251, 1746, 9587, 10588, 5206, -1437, -3902, -1494, 1548, 1439, -1055, -2940, -3226, -2529, -576, 2830, 5826, 6233, 4111, 791, -2903, -5997, -6759, -4419, -331, 3561, 6319, 7352, 5621, 1088, -3986, -6989, -7590, -6652, -3709, 1889, 8076, 11169, 9758, 5247, -1064, -8625, -14952, -15362, -7716, 3887, 12293, 13523, 8778, 1910, -3443, -5796, -6187, -5669, -3204, 1432, 4484, 2471, -1438, -639, 5066, 7991, 2752, -6254, -10567, -7793, -2346, 1804, 4401, 5782, 5261, 3154, 1025, -448, -1860, -3759, -5943, -6947, -4588, 920, 5539, 5705, 2423, -1089, -3143, -3135, -963, 1457, 1732, 652, 485, 215, -2577, -5706, -3816, 3432, 9322, 7993, 1145, -5063, -7141, -5805, -2848, 197, 1743, 1681, 2124, 4103, 5135, 2442, -2914, -7147, -7662, -4550, 344, 4576, 6407, 6140, 5452, 4567, 1531, -4168, -8932, -8616, -3537, 2681, 7598, 10136, 8295, 1119, -7527, -11324, -8397, -2865, 1086, 3378, 5008, 4782, 2038, -594, -831, -482, -1996, -3834, -2876, 637, 3454, 3242, 529, -2206, -3038, -2483, -1766, -270, 2013, 1707, -2748, -6011, -2941, 2818, 4904, 3866, 2943, 625, -4277, -6786, -2915, 3069, 4649, 1437, -2317, -3414, -1835, -58, -449, -1978, -1454, 1275, 2736, 1246, -881, -1604, -1851, -2332, -1109, 2730, 5542, 3245, -2212, -4870, -2783, 414, 1676, 1518, 712, -1164, -3074, -2338, 1568, 5558, 6270, 3305, -1470, -6283, -9780, -9844, -4429, 5074, 12654, 12152, 3624, -5885, -8999, -5190, -398, 363, -1711, -2004, 1281, 5462, 6997, 5010, 1401, -1350, -2395, -2832, -3836, -4809, -4098, -1344, 1744, 3184, 2614, 1036, -731, -2497, -3790, -3509, -1054, 2453, 4333, 2381, -2345, -5527, -4143, -375, 1395, 723, 940, 3241, 4678, 2842, -698, -3132, -4052, -4393, -3683, -1002, 2254, 3470, 2453, 1556, 2125, 2846, 1568, -2382, -7051, -8503, -4314, 2863, 7300, 6435, 3141, 1228, 1000, 513, -832, -2034, -2878, -4247, -5644, -4539, 323, 6071, 8153, 5433, 1034, -1973, -3622, -5153, -6215, -5239, -1506, 3789, 7748, 7489, 2992, -2316, -4979, -4720, -3392, -2205, -1207, -266, 903, 2954, 5634, 6797, 4406, -578, -5187, -7939, -8824, -6719, -825, 5725, 8170, 5842, 1710, -2436, -6146, -7525, -4891, 4, 3735, 4943, 4505, 3649, 2907, 1639, -1096, -4202, -4871, -2421, 601, 2217, 2927, 2890, 751, -2968, -4469, -1179, 4142, 6039, 2519, -3065, -6021, -4758, -1182, 1842, 2711, 1925, 1503, 2763, 4097, 2161, -3654, -8960, -8276, -1203, 6658, 9365, 6108, 401, -4464, -7059, -6432, -2644, 1462, 2709, 2076, 3108, 5517, 4712, -1129, -7441, -8789, -5312, -1442, 177, 1121, 3981, 8545, 11373, 8473, -810, -11509, -15962, -10745, 108, 9633, 13943, 12825, 7156, -1582, -10317, -15315, -14349, -7369, 3706, 14242, 17608, 10358, -2865, -12707, -14106, -9533, -3625, 1657, 6147, 9250, 10126, 8215, 3077, -4667, -11797, -13587, -7953, 1848, 9718, 11762, 8379, 2349, -3622, -7870, -9593, -8077, -2949, 3856, 8224, 7939, 4497, -614, -7311, -12574, -10584, -750, 9541, 13584, 11832, 7082, -863, -11193, -17403, -12906, 6, 11917, 16511, 14350, 7548, -2586, -12011, -14873, -10189, -2940, 2433, 5509, 7051, 6986, 5595, 3868, 2168, -198, -3940, -8159, -9745, -5871, 2215, 9542, 12262, 10375, 5358, -2127, -10530, -15600, -13344, -4577, 5626, 12808, 15055, 11354, 2440, -6985, -11606, -11028, -7870, -2068, 7057, 14424, 12365, 1649, -7291, -7428, -3335, -1662, -602, 3400, 5995, 2572, -1653, -437, 2423, 1613, 575, 2761, 2768, -3690, -10328, -9522, -3197, 2137, 4721, 6451, 7181, 5165, 1008, -2765, -5229, -6934, -6786, -2786, 3723, 8161, 8068, 5376, 2485, -917, -5569, -9580, -9823, -5359, 2008, 9147, 12228, 8598, 451, -5846, -6449, -3483, -591, 1116, 1592, 705, -149, 887, 2960, 3532, 2182, 612, -182, -647, -1417, -2363, -2072, 1094, 5829, 7192, 1883, -6494, -10284, -6123, 1678, 6515, 6215, 3342, 857, -371, -950, -1946, -3680, -4596, -2969, 102, 2292, 4127, 7248, 9183, 5317, -3499, -10243, -9782, -4111, 1235, 3276, 3226, 3669, 5066, 5001, 1207, -4450, -6412, -1765, 4662, 4762, -2638, -9352, -7452, 1433, 8699, 8528, 2677, -3169, -5291, -4094, -2135, -1076, -531, 646, 2410, 3130, 1269, -2501, -5395, -5410, -3437, -1255, 1312, 4781, 6835, 4648, -148, -2912, -2494, -2113, -3346, -3529, -541, 3372, 4781, 3552, 1827, 405, -1205, -2397, -2176, -1666, -2654, -3671, -998, 5307, 9673, 7551, 1213, -3728, -5285, -5070, -3377, 990, 6298, 7721, 2959, -4359, -8098, -5485, 749, 5350, 5298, 1963, -988, -1491, -535, 177, 572, 864, -249, -3244, -5236, -3422, 345, 2225, 1914, 1819, 2690, 3529, 3762, 2690, -775, -5594, -8126, -5841, -70, 5161, 6006, 1842, -3391, -4786, -1947, 1466, 2861, 2005, -1113, -5362, -7166, -4318, 875, 5093, 7455, 7491, 4192, -805, -3520, -2972, -2262, -3140, -3542, -1973, -495, -904, -1096, 1530, 5340, 6677, 4969, 1991, -1882, -6362, -8135, -4294, 1905, 4072, 1747, 875, 3752, 4794, -20, -5694, -5839, -2355, -886, -1151, 962, 4839, 5608, 1788, -2862, -4592, -3094, -33, 2867, 3866, 1759, -2268, -4830, -4015, -1774, -850, -587, 1519, 4883, 5859, 3152, -186, -1562, -2475, -4749, -5764, -1831, 4648, 6743, 2782, -855, 801, 4317, 3876, -477, -4766, -7312, -8584, -7695, -3379, 2847, 7681, 9537, 8810, 5526, -573, -7461, -10996, -9092, -4048, 745, 4812, 9025, 11542, 9068, 2085, -4891, -8578, -8831, -5787, 173, 5776, 7094, 4501, 1314, -1516, -4966, -7660, -6722, -2417, 1754, 3613, 4364, 5660, 6239, 3033, -3945, -9574, -8796, -2993, 1876, 2886, 2402, 3039, 4169, 3781, 953, -3483, -6793, -5932, -1085, 3718, 5097, 3715, 1929, 136, -2271, -3928, -2762, 15, 692, -1648, -4010, -3879, -1114, 3822, 8947, 9437, 2760, -6040, -9435, -6398, -1757, 1207, 2745, 2989, 1246, -1254, -1705, 501, 2790, 2979, 1648, -150, -3184, -7624, -10108, -6586, 1914, 9231, 10493, 6501, 1163, -2907, -4882, -4239, -1495, 614, -511, -3589, -4351, -1012, 3196, 4100, 1253, -2573, -4448, -2997, 555, 2666, 1484, -113, 1239, 3827, 3728, 1278, -95, 173, -377, -2461, -3961, -3289, -1050, 1468, 3432, 4003, 2421, -818, -3780, -4625, -2976, 244, 3521, 5078, 3735, 704, -586, 1228, 2452, -690, -5382, -6036, -3240, -1654, -678, 3674, 9027, 8540, 1759, -5136, -8549, -9172, -6603, 125, 7685, 10248, 6336, 256, -3535, -4990, -6572, -8476, -7793, -2525, 5361, 11659, 13162, 8689, -831, -11339, -16364, -11989, -1720, 5925, 6149, 2527, 1376, 3486, 4293, 907, -4459, -7801, -7047, -2474, 3754, 7855, 6821, 1912, -1961, -1712, 439, 290, -2953, -6266, -6487, -2779, 3159, 7628, 7229, 2500, -2086, -3446, -3609, -5978, -9196, -7868, 331, 10904, 17008, 15740, 8712, -1321, -11594, -18066, -16741, -7678, 4014, 12214, 13852, 9466, 2132, -3762, -5312, -3787, -2833, -3362, -2712, -117, 642, -2329, -3574, 2172, 9451, 7829, -2438, -9970, -7984, -1278, 3453, 5385, 5929, 4756, 1987, -182, -145, 650, -847, -5117, -7793, -3939, 4665, 9899, 6843, -332, -4269, -3146, -778, -223, -549, 472, 2996, 5030, 4443, 895, -2936, -2911, 1439, 4890, 3131, -950, -2299, -1619, -2218, -2740, -161, 3417, 3789, 1549, 444, 1390, 2035, 87, -4681, -9609, -10328, -5136, 2728, 8756, 11002, 9333, 4264, -2100, -6968, -9153, -8391, -4216, 1898, 6295, 7485, 7071, 5118, 25, -6112, -8378, -5909, -2131, 1163, 4152, 5143, 2390, -1774, -3326, -1523, 1584, 4363, 5772, 4482, 257, -4533, -6229, -3164, 2236, 5302, 4007, 1054, -43, 540, 405, -782, -1329, -1026, -1400, -2289, -1361, 1744, 3658, 1904, -904, -469, 2889, 4463, 1361, -4276, -8420, -8998, -5987, -304, 5788, 9141, 8449, 4986, -179, -6468, -10288, -6698, 2552, 8230, 4833, -2189, -4180, 108, 5147, 6291, 3434, -926, -4512, -6186, -5258, -1395, 3791, 6739, 5616, 2387, -703, -4019, -7363, -7542, -2675, 3902, 7223, 5959, 2288, -996, -1990, -890, -445, -2887, -6079, -5248, 666, 6895, 8632, 6497, 3906, 1602, -1755, -5916, -9483, -11415, -9483, -1520, 9062, 14385, 11637, 6079, 2245, -1811, -8612, -14741, -14021, -4901, 7418, 15138, 13646, 4968, -3545, -5435, -1459, 1278, -2177, -8345, -9503, -3297, 4609, 7677, 5472, 2192, 859, 1067, 409, -3603, -10247, -13201, -6536, 5368, 10648, 5294, -1677, -1760, 1949, 1727, -2972, -6066, -3908, 771, 3386, 3230, 3307, 5169, 6294, 3928, -601, -3857, -4946, -5360, -5152, -2279, 3890, 10031, 10632, 3280, -7039, -11142, -5506, 3239, 6351, 2652, -2424, -3840, -469, 4592, 5491, -498, -7830, -8104, -823, 6228, 7376, 4626, 2143, 158, -3121, -6686, -7249, -3732, 1387, 5230, 6913, 6648, 4337, -55, -5464, -9389, -8940, -3313, 4262, 8359, 6459, 1567, -1502, -1669, -1504, -2392, -2850, -1712, 173, 2033, 3941, 4810, 2428, -3113, -8092, -8716, -4786, 1315, 7296, 10782, 9126, 2834, -3421, -6512, -7791, -7383, -2198, 6150, 9511, 4504, -2156, -4155, -3414, -3696, -4157, -2952, -1124, -68, 721, 1793, 2271, 1116, -1291, -2961, -1793, 1896, 4690, 3047, -2970, -9093, -9726, -2538, 8068, 13178, 7884, -2837, -9398, -7869, -2346, 1509, 1935, 922, 1373, 4039, 6237, 4887, 867, -1984, -2050, -1424, -2201, -3485, -2492, 2026, 7227, 7999, 3164, -1757, -1192, 2475, 1930, -4104, -8021, -3936, 3317, 4628, -777, -5232, -3816, 666, 3278, 1920, -2183, -4745, -1832, 3849, 4895, 214, -2559, 996, 4932, 2192, -4901, -8551, -5918, -688, 3528, 6289, 7316, 5207, 211, -5069, -8283, -8080, -3372, 4335, 9129, 6067, -1600, -5249, -1719, 2936, 2319, -1989, -4410, -4061, -4385, -5957, -4899, 1250, 9428, 13424, 9262, -1033, -10079, -11098, -4680, 1672, 2283, -240, 114, 3666, 5617, 4268, 2457, 1099, -1851, -5469, -5613, -1815, 1293, 904, -207, 1541, 4995, 5574, 1594, -2615, -2022, 1507, 1079, -4853, -9016, -5036, 3736, 8960, 7693, 3856, 1253, -321, -1989, -2815, -1715, 67, 330, -1457, -3854, -4568, -1978, 2641, 5048, 2803, -667, -88, 4073, 5755, 1576, -4530, -6746, -4650, -2280, -1585, -320, 3682, 8951, 11529, 8357, -53, -9347, -14503, -13714, -8346, -155, 8863, 14628, 12949, 4853, -2904, -4919, -2802, -1490, -2193, -2653, -2189, -1578, 535, 5560, 9985, 7779, -1715, -11741, -14305, -7027, 4860, 12214, 9586, 369, -6765, -6943, -3124, -817, -856, 669, 5876, 10840, 9372, 356, -9933, -13379, -7930, 555, 4927, 4341, 3498, 5089, 6131, 2769, -4010, -9439, -10118, -6137, 363, 6083, 7219, 2853, -2450, -3165, -91, 721, -3113, -6789, -5523, -1287, 855, 99, -589, -296, -530, -794, 880, 3257, 2967, 266, -1254, -702, -759, -2264, -2524, -183, 1790, 7, -4359, -6368, -2736, 4658, 10625, 10989, 5095, -4156, -11385, -11739, -5505, 1610, 5010, 5568, 5358, 3806, 1235, 60, -620, -4197, -8109, -5635, 2145, 6359, 3649, -270, -676, 1279, 2989, 2716, -690, -5290, -6022, -1270, 3723, 3417, -811, -3429, -2616, -1552, -2389, -2949, -407, 4762, 9581, 10919, 6854, -1420, -8757, -10126, -6057, -1344, 1858, 5641, 9710, 8586, -42, -8916, -9609, -3857, 319, 527, 884, 3556, 6120, 6044, 2959, -2256, -7348, -8898, -5273, 1021, 5471, 5886, 3736, 1678, 1129, 1693, 1215, -2357, -6993, -7142, -1251, 5219, 7402, 6010, 1966, -5862, -13901, -13855, -3882, 7592, 11966, 8387, 1578, -2795, -2121, 66, -1785, -6240, -5918, 751, 6169, 4762, 878, 1398, 5338, 5857, 315, -6746, -9970, -7921, -2147, 3862, 6025, 4393, 3826, 5817, 5030, -1213, -6910, -6427, -2516, -68, 1348, 3938, 6460, 6551, 4117, -100, -5672, -10202, -9501, -2824, 4678, 7806, 7505, 7701, 7901, 3941, -4072, -10070, -10211, -7656, -5731, -1910, 5639, 11321, 9823, 5032, 2597, -13, -6568, -12079, -9667, -1574, 4849, 6876, 6289, 4633, 2701, 709, -2835, -8478, -11722, -6727, 4347, 10912, 6590, -1714, -2728, 4003, 8407, 4101, -4477, -9586, -8891, -5078, -1038, 2107, 4196, 5310, 5483, 4375, 1831, -1039, -2666, -3334, -4734, -6457, -5320, 443, 8045, 12406, 10592, 3750, -4054, -8754, -9205, -7573, -5912, -2604, 5007, 13798, 15453, 7127, -3657, -9204, -10742, -12141, -11411, -5049, 4836, 13111, 16518, 13315, 3794, -6881, -11855, -9977, -5871, -2554, 1686, 8279, 13829, 12932, 4424, -6711, -13186, -10782, -1835, 5962, 6990, 4084, 3450, 4395, 1082, -6129, -9601, -5320, 2498, 7840, 7955, 3193, -2843, -4692, -809, 3930, 4208, 173, -4513, -7350, -7330, -3427, 3889, 10293, 9860, 1481, -8251, -11121, -6149, 339, 3478, 4349, 4887, 4061, 1644, 93, -494, -3804, -10110, -12759, -6292, 5496, 13734, 14242, 9270, 1678, -7288, -14667, -15750, -9255, 828, 9130, 12031, 8652, 2524, -180, 1707, 1696, -4825, -12074, -10685, -689, 8064, 8118, 2506, -632, 1489, 4035, 2072, -3009, -6294, -5705, -2611, 1161, 3382, 1557, -2850, -3965, 564, 5583, 6021, 2903, -1203, -5893, -9261, -7521, -686, 6824, 11489, 11999, 7439, -822, -8059, -11194, -11996, -12483, -10677, -3748, 7146, 17085, 20994, 16645, 5724, -7301, -17485, -20955, -15993, -4732, 7136, 14524, 16273, 13296, 6050, -3666, -11156, -12498, -8588, -3617, -760, 162, 1879, 5654, 7718, 3409, -4435, -7353, -3019, 1920, 2676, 1913, 2142, 596, -4485, -8811, -7469, -1512, 4140, 6604, 6020, 3152, -528, -2077, -317, 1242, -1294, -5976, -7221, -3451, 1689, 5177, 7401, 8604, 6287, -1466, -11233, -15481, -10091, 712, 8983, 11502, 10700, 8366, 3311, -3937, -8869, -8059, -3846, -1491, -2642, -3186, 1779, 10810, 15550, 9545, -3445, -13089, -13733, -8521, -2915, 1564, 5985, 9641, 9619, 4462, -2922, -7361, -6796, -4222, -3015, -1950, 2479, 9429, 12747, 8062, -1384, -8092, -8561, -5941, -4456, -3754, -669, 4918, 8956, 8074, 2865, -3915, -9431, -10796, -6713, 247, 5845, 8369, 8320, 6148, 2843, -250, -3927, -8969, -11111, -4950, 6139, 11703, 7499, 174, -2926, -2367, -2854, -5443, -6337, -2139, 5209, 9282, 5579, -3271, -9666, -8249, -652, 6158, 6253, 643, -3587, -1660, 2852, 3289, -786, -3827, -2438, 1188, 3217, 2029, -1001, -2852, -2283, -1604, -2391, -1666, 3050, 7564, 5863, -730, -5164, -4286, -1715, -1390, -2637, -2468, 144, 3624, 5633, 4437, 61, -4784, -6454, -3946, 709, 5277, 7926, 6131, -674, -7564, -7919, -1678, 3955, 3296, -1139, -2271, 2892, 9911, 11768, 5840, -4043, -11465, -12769, -8810, -2333, 4949, 11741, 15087, 11819, 2943, -5704, -9261, -9002, -9131, -9588, -6286, 1440, 8693, 11442, 10352, 7314, 2965, -1668, -5424, -8450, -10143, -7898, -1423, 4882, 7349, 7532, 7958, 6799, 864, -8064, -13793, -12263, -4799, 4594, 11799, 12934, 6764, -2395, -8043, -8277, -5845, -2420, 2508, 7453, 8553, 4380, -2113, -7266, -9788, -9459, -5690, 673, 6435, 8988, 8254, 4632, -1524, -7154, -7818, -3694, 149, 845, 687, 1725, 2186, 419, -1593, -1654, -1149, -1857, -2004, 100, 1706, 485, -149, 2774, 4915, 1464, -3840, -4357, -865, 926, -601, -2296, -1774, 742, 4218, 7445, 8735, 6601, 1017, -6104, -11488, -12003, -6842, 1091, 7026, 8562, 6938, 3710, -813, -4581, -3508, 2910, 8849, 7880, -312, -9761, -12888, -6129, 6186, 14199, 11512, 1502, -6985, -8782, -5224, 195, 5348, 8415, 6880, 211, -7731, -11476, -9111, -3261, 2512, 6486, 8182, 6980, 2518, -3626, -7693, -6796, -2229, 2003, 3791, 3858, 2981, 1509, 671, 784, -328, -3513, -5166, -2156, 2589, 3936, 1939, 669, 1022, -186, -3825, -6080, -4140, -57, 3185, 5246, 5658, 2259, -3828, -6117, -606, 7156, 7971, 793, -6003, -5415, 137, 3203, 797, -3236, -4079, -1089, 2940, 5289, 5090, 3072, 356, -2916, -7275, -11128, -10014, -1773, 8524, 12879, 9544, 3978, 449, -2540, -6860, -9488, -6495, 434, 5844, 7630, 7975, 7668, 4329, -2711, -9778, -12826, -11384, -7071, -773, 6481, 11497, 10850, 4990, -1625, -4788, -3892, -1722, -1639, -3705, -3700, 1311, 7320, 7578, 1800, -3948, -5831, -5206, -3429, 306, 5064, 7132, 4829, 770, -2490, -5665, -9148, -9788, -5144, 1628, 5497, 6231, 6990, 7661, 4649, -2621, -9406, -11120, -7768, -1828, 4563, 8624, 7329, 1912, -1545, 507, 3952, 2626, -3276, -8175, -8638, -5673, -530, 6478, 12226, 11288, 2681, -7843, -13826, -12847, -5430, 5488, 13685, 13676, 6737, -663, -4319, -5020, -4809, -3946, -1816, 1144, 3208, 3104, 1646, 522, -285, -1769, -3015, -2167, 122, 1746, 2548, 2678, 24, -5530, -8382, -3833, 4385, 8684, 6791, 2399, -166, 432, 1340, -1735, -7643, -9352, -3958, 2884, 6241, 7805, 8959, 6941, 1402, -3684, -6757, -9456, -10426, -6217, 1692, 7498, 8467, 6615, 3776, -182, -4184, -5295, -2810, 40, 551, 83, 895, 2224, 2146, 768, -537, -699, 1030, 3968, 5469, 3980, 833, -2765, -6839, -9410, -7466, -2586, 201, 177, 1570, 5821, 9047, 8062, 4052, -627, -5237, -8961, -9632, -6092, 165, 7053, 13082, 15416, 10878, 1171, -7325, -11405, -13521, -14405, -9831, 1352, 11894, 13848, 7871, 584, -4268, -7378, -8561, -5632, 710, 5707, 6214, 4215, 3023, 3058, 3050, 2544, 1277, -1544, -5202, -6581, -3745, 878, 3536, 4363, 6145, 8100, 5380, -3360, -11684, -12167, -5507, 680, 1659, 617, 2732, 7175, 8496, 4588, -1226, -5539, -7029, -4194, 2392, 6735, 4142, -778, -1106, 1289, 706, -1741, -2092, -2188, -4978, -6894, -3418, 2487, 4512, 1991, -731, -1291, -842, -165, 1050, 1510, -250, -1757, 749, 5477, 6642, 2782, -1956, -4057, -3109, 81, 3289, 3147, -784, -4804, -5829, -4203, -1167, 2619, 5516, 5493, 2917, 536, 406, 1656, 1132, -3280, -9038, -10151, -4033, 4472, 8591, 7639, 6289, 6647, 5327, -494, -7641, -10371, -7548, -3380, -1228, 164, 2989, 5758, 5257, 1341, -3412, -7168, -8501, -5117, 2403, 8046, 6726, 1265, -1650, -242, 1991, 2278, 659, -2197, -5203, -5751, -2029, 3521, 6201, 4891, 2661, 1063, -1822, -6271, -8516, -5960, -1196, 1370, 596, -561, 1920, 8234, 12477, 8344, -2536, -11876, -14073, -9886, -2476, 4848, 8786, 8867, 7918, 6700, 2362, -5024, -9994, -8659, -3314, 1619, 3732, 2283, -1835, -5422, -5510, -2566, 718, 2668, 3000, 1636, -664, -1542, 654, 3872, 4030, 402, -2904, -2303, 481, 1390, 269, 608, 3191, 4035, 313, -5019, -7085, -5174, -2231, -148, 1561, 3233, 3770, 2104, -1189, -3828, -3268, 954, 5953, 7589, 4736, 727, -634, -32, -1686, -6802, -10332, -7014, 934, 6372, 6556, 4852, 3686, 2068, -107, -1714, -4000, -8301, -11239, -8217, -275, 7431, 11683, 11966, 8215, 1124, -7010, -12859, -12722, -5219, 4850, 9396, 6475, 2387, 1941, 2034, -1693, -7006, -8428, -5175, -1046, 1872, 4655, 7044, 6344, 2171, -1743, -2586, -2112, -3180, -5277, -5646, -2953, 1933, 7340, 11180, 10896, 5159, -3846, -10911, -11793, -6823, -101, 4551, 6191, 5895, 4941, 3903, 2033, -2242, -8545, -13076, -12249, -6619, 914, 8311, 13595, 14425, 10611, 3507, -6793, -18091, -22231, -13180, 2773, 13337, 14519, 11261, 7808, 4763, 2057, -1276, -7005, -13715, -16415, -12228, -3243, 6826, 15216, 19125, 16048, 6594, -4787, -12992, -15445, -12083, -4043, 5833, 12392, 11355, 4256, -2144, -3142, -1163, -1660, -5291, -7221, -4216, 842, 3349, 3257, 3878, 5850, 6268, 3861, 984, -665, -2619, -5820, -7307, -3740, 3158, 7563, 6006, 930, -2836, -3629, -3433, -3555, -2525, 485, 2777, 1422, -1973, -2712, 1318, 7011, 8478, 2499, -6825, -11186, -8267, -4018, -1776, 2576, 9804, 12442, 6987, -3, -3611, -6724, -10116, -8501, -827, 5878, 6272, 2337, -2052, -5322, -6173, -3398, 803, 1945, -137, 314, 6573, 12503, 8942, -4118, -16219, -17415, -7743, 4132, 9711, 7929, 4397, 3914, 4968, 2892, -2843, -7413, -7266, -4613, -2911, -1307, 2398, 6402, 7613, 6669, 5140, 1211, -6216, -12519, -12024, -5270, 2658, 8553, 12016, 12210, 7752, -320, -8400, -13363, -13869, -9214, -90, 9615, 15246, 15778, 12714, 5754, -5957, -18569, -24244, -18394, -4054, 10981, 19676, 19256, 11805, 2222, -5322, -9571, -10897, -8864, -3015, 3978, 6974, 4206, 415, 1433, 6427, 8176, 1765, -8774, -14255, -10363, -1728, 4691, 7324, 8702, 9212, 6525, 760, -4186, -6117, -7524, -9946, -9124, -1503, 7547, 9708, 5492, 1618, -304, -2957, -4840, -2741, 826, 1418, -244, -1711, -3730, -6088, -4613, 2581, 10622, 12986, 7829, -1504, -9366, -11455, -7856, -2247, 2059, 4013, 4017, 3588, 4323, 5012, 2240, -3927, -8163, -6499, -1412, 2208, 3085, 3264, 4409, 6270, 7181, 5219, 240, -5075, -7330, -5432, -881, 4146, 7854, 8507, 4849, -2039, -7911, -8249, -3090, 2290, 3015, -33, -2148, -1049, 1200, 2222, 2556, 3577, 4198, 2124, -2334, -6377, -7961, -6138, -279, 6958, 9458, 5523, 817, -1348, -4338, -8176, -6863, -537, 3012, 2253, 2910, 4583, 1894, -2835, -3045, -58, 868, 2, -963, -3526, -6137, -3624, 3025, 6569, 4651, 1599, -125, -1670, -2775, -2222, -1402, -2042, -2367, 135, 3681, 3972, 662, -1884, -1049, 594, -58, -2283, -3732, -3574, -1790, 1470, 4870, 6735, 6766, 4798, -311, -8000, -13985, -13504, -5777, 5489, 14489, 16006, 8714, -2357, -8836, -7446, -3998, -5444, -9636, -8188, 1451, 12758, 18481, 16434, 7794, -4311, -14550, -18145, -14133, -4754, 5991, 12775, 12104, 6313, 1108, -1371, -3811, -7874, -10738, -8715, -1876, 6386, 12532, 13888, 8690, -1737, -11758, -15547, -12584, -6883, -1425, 4103, 10252, 15026, 15087, 8939, -1370, -11497, -17463, -17049, -10022, 767, 9525, 12326, 11227, 9874, 6851, -1214, -11850, -17852, -14970, -4668, 7487, 13863, 10659, 3462, 622, 1606, -238, -5482, -8615, -8073, -6726, -4195, 2353, 10574, 13626, 9071, 1763, -3157, -5825, -8436, -10290, -8904, -3711, 3662, 10410, 12609, 7896, -506, -6149, -6634, -5045, -4049, -2862, -639, 1257, 2030, 3387, 6423, 8655, 6779, 1049, -5469, -10284, -11675, -8052, -414, 6720, 9519, 7964, 3615, -2279, -7301, -8411, -5463, -1577, 414, 293, 103, 2363, 6803, 9162, 6083, -22, -4392, -5820, -5480, -3422, -479, 390, -1046, -288, 4890, 9496, 7743, 1163, -3985, -5211, -5096, -5079, -3161, 1196, 4695, 4933, 3616, 3039, 2732, 1030, -2541, -6460, -7220, -2442, 4570, 7304, 4269, 37, -2192, -3211, -3318, -1503, 1166, 2519, 2500, 1748, -416, -3476, -4573, -2627, -285, 195, -167, 277, 1245, 1979, 2785, 3473, 2045, -2850, -8520, -9375, -2815, 6980, 12870, 11849, 6314, -585, -6966, -10238, -8305, -3078, 1834, 5938, 9499, 9326, 3226, -4700, -9226, -10386, -9871, -6531, 52, 6818, 10969, 11696, 8039, 361, -7083, -9946, -8429, -4813, 161, 5342, 7609, 5595, 2109, 351, -116, -1520, -3773, -4721, -3676, -2017, -743, -211, -1060, -2234, -750, 2901, 3782, 1005, 322, 3722, 4972, 187, -6366, -10336, -11293, -7329, 3706, 16657, 22001, 16260, 3619, -9500, -17148, -16508, -10932, -5344, 521, 8132, 13538, 12743, 8662, 5109, -38, -8665, -15999, -16240, -9067, 2091, 12517, 16848, 13278, 5971, -938, -7802, -14212, -15549, -9164, 1142, 9629, 13224, 11430, 6002, 25, -5403, -10675, -12827, -7253, 3704, 10592, 8370, 2382, -282, -97, -1511, -4313, -4598, -2044, 284, 1968, 4243, 5106, 3027, 2284, 5878, 7490, 243, -10913, -15173, -10216, -2461, 3139, 6583, 8694, 8763, 5749, 60, -5614, -7757, -5453, -1507, 787, 1055, 1169, 2234, 3334, 2902, 517, -2641, -4654, -4128, -997, 3133, 5317, 3496, -605, -3007, -2960, -3243, -3725, -773, 4504, 5326, 153, -3711, -1187, 3998, 6550, 5654, 2238, -2758, -6726, -7209, -4550, 187, 6453, 11230, 9776, 1891, -6607, -10143, -7952, -2537, 2935, 5670, 4611, 1480, -902, -1469, -1238, -1209, -1294, -1299, -1129, 290, 3745, 6825, 5574, 110, -4766, -5594, -3642, -1774, -1074, -756, 783, 4032, 6224, 3615, -2578, -5891, -2540, 3085, 3379, -3433, -11071, -11602, -3115, 8527, 14743, 11405, 2017, -6192, -9446, -9305, -7491, -2756, 4785, 10445, 10038, 5123, -256, -4933, -9360, -11704, -8926, -1017, 7989, 13152, 12328, 7279, 1618, -2455, -5376, -8156, -9770, -7873, -2350, 3776, 7863, 9722, 9234, 5161, -1743, -7566, -9329, -7615, -3912, 1445, 7333, 10725, 9359, 4114, -1873, -5708, -6506, -5340, -3355, -627, 2315, 3438, 1573, -1488, -3102, -2604, -956, 399, -228, -3065, -5154, -3402, 884, 3679, 3740, 3096, 2810, 1643, -1205, -4587, -6631, -5893, -1743, 4624, 9773, 10362, 6335, 697, -3998, -7452, -9449, -8083, -2557, 3434, 4803, 1916, 276, 2220, 3708, 1207, -3645, -8208, -11721, -11849, -4944, 7203, 16443, 17049, 11286, 4349, -1948, -7948, -12169, -12228, -8310, -2717, 3330, 9491, 13484, 11940, 4720, -4010, -9672, -10567, -7462, -2195, 2703, 5118, 5160, 4337, 2544, -1532, -6250, -6844, -1718, 4262, 5830, 4135, 3678, 4301, 1482, -5328, -10344, -9425, -5119, -1150, 2802, 7584, 10824, 9986, 5509, -746, -6846, -10398, -10356, -8586, -6577, -2217, 6468, 15721, 18473, 12605, 3361, -3529, -7860, -11843, -13915, -9871, 301, 10399, 13912, 10272, 4441, 1212, 644, -913, -5762, -11577, -13475, -8836, 177, 8425, 11891, 10302, 6189, 1897, -2032, -5872, -8901, -9277, -5837, 530, 7651, 12978, 13102, 5555, -6306, -13969, -12906, -7068, -1204, 4940, 11032, 12415, 6788, -1992, -9704, -14885, -15599, -10297, -1691, 6176, 12637, 17462, 17419, 10289, -1457, -13362, -21157, -20645, -11102, 1643, 10464, 13916, 14478, 12975, 8493, 1123, -7686, -15061, -16568, -9834, 1432, 10152, 12394, 9068, 2802, -4081, -9629, -12186, -10294, -3638, 4682, 9366, 8698, 6208, 4684, 2738, -751, -3935, -5826, -7573, -8438, -5636, 730, 6929, 9935, 9102, 4648, -2034, -7571, -8806, -5467, -120, 3432, 2323, -2596, -6424, -4612, 2267, 9191, 11398, 7718, 521, -6238, -9454, -8350, -4191, 647, 3567, 3632, 2847, 3441, 4204, 2407, -1508, -4637, -5696, -4865, -1695, 2997, 5862, 5285, 3935, 3881, 2884, -1166, -5668, -6753, -4779, -2864, -1542, 1449, 6227, 8946, 6572, 1244, -2538, -3908, -5609, -8102, -7620, -1787, 6222, 11206, 10720, 5263, -2496, -8083, -8941, -7395, -6086, -3383, 1963, 6363, 6934, 6029, 5300, 1917, -4677, -9171, -7892, -3908, -1338, 372, 3735, 8170, 9744, 5236, -3667, -10721, -11139, -6731, -2990, -1693, 722, 6991, 13817, 14774, 7262, -4946, -15167, -18221, -13029, -3338, 4976, 9330, 11813, 13661, 11414, 2140, -9646, -15190, -11642, -4451, 1107, 5410, 9308, 9858, 5696, 1009, -1012, -3464, -9268, -14287, -12266, -3197, 7273, 14043, 15287, 11360, 4051, -3854, -10008, -13504, -13815, -9586, -166, 11608, 20034, 20872, 14154, 2770, -9827, -19755, -22635, -15962, -2189, 11530, 18224, 16338, 9650, 2402, -3641, -7752, -9192, -8264, -5705, -1249, 4093, 6403, 4018, 1729, 4034, 6962, 3342, -5655, -10984, -7246, 1559, 7958, 8744, 6017, 3133, 1385, 261, -1000, -3283, -7089, -9974, -7072, 2037, 9695, 8558, 1347, -3223, -1988, 831, 1387, 110, -1257, -1996, -1878, -1230, -1203, -1803, -519, 4055, 8091, 6422, 369, -3888, -4691, -5690, -7174, -4962, 971, 5061, 4604, 2769, 2361, 2211, 122, -4147, -8349, -8858, -4193, 2410, 6581, 8095, 9295, 9814, 6787, -425, -8342, -11718, -7845, -312, 3442, 1307, -474, 2674, 6402, 5167, 505, -3364, -5054, -3765, 497, 3076, -283, -5185, -4157, 2084, 7195, 8736, 7603, 3229, -3654, -8206, -7035, -2828, 102, 1283, 2215, 2398, 784, -839, 8, 1943, 1469, -1359, -3452, -3701, -3027, -1398, 763, 1273, 266, 1372, 5076, 5975, 496, -7240, -10613, -7880, -1880, 4231, 8404, 9212, 6684, 2788, -769, -4301, -7781, -8318, -3334, 4343, 8276, 5726, 301, -3024, -2937, -1307, -12, 363, -200, -1589, -2948, -2662, -71, 3112, 4374, 3069, 208, -3420, -6673, -7167, -3965, 414, 3391, 5234, 6218, 4890, 1577, -1058, -2901, -6281, -9700, -7931, -198, 7348, 9177, 6082, 2088, -578, -1932, -2491, -3051, -4432, -5659, -4118, 622, 5111, 6330, 5476, 4893, 3747, 112, -4501, -6203, -3775, -36, 1855, 1485, 464, 369, 1788, 3893, 4483, 1962, -2254, -4722, -3904, -1737, -652, -585, -80, 1138, 2458, 3545, 2997, -1394, -7494, -7915, 78, 7981, 6399, -1832, -6381, -3697, 826, 2407, 2034, 2840, 5173, 5790, 1851, -4244, -6622, -3655, -51, 517, 218, 1856, 3499, 1962, -1425, -2332, 389, 2792, 642, -5088, -8657, -5715, 1789, 7664, 7710, 3073, -1797, -3384, -1760, -21, -867, -3264, -3272, 975, 5971, 6377, 1661, -3200, -4203, -2521, -995, 140, 1514, 1664, -752, -3526, -2997, 806, 3625, 1918, -3243, -7433, -6817, -1189, 5235, 6729, 2211, -2512, -1874, 1709, 1555, -3260, -6750, -4589, 805, 4414, 4298, 1975, -457, -1951, -2671, -3663, -4933, -3618, 2560, 9606, 10293, 3887, -3373, -7590, -9372, -7845, -1694, 4974, 6720, 4823, 3631, 2561, -980, -5011, -5933, -4361, -2795, -868, 2773, 6490, 7358, 5518, 3557, 2132, -602, -4925, -8135, -8255, -6191, -2791, 3224, 11704, 17525, 14336, 2121, -11488, -17870, -13977, -3518, 5790, 7951, 4734, 3541, 6752, 8043, 2732, -4523, -6988, -4854, -2575, -2109, -2221, -987, 2411, 6002, 6278, 3104, 496, 286, -1106, -6195, -10332, -7135, 1568, 6810, 4086, -1579, -3762, -2154, 274, 1923, 2070, 831, 630, 2744, 3336, -1247, -6902, -6263, 219, 4545, 2697, -466, 269, 2888, 2815, 590, -246, 258, -703, -3446, -5563, -5116, -1268, 5342, 10620, 9029, 459, -7849, -9105, -4560, -551, 219, 688, 3209, 5485, 4343, 609, -2101, -1947, -278, 610, -466, -2899, -4068, -1124, 4823, 8053, 4820, -1431, -4934, -4845, -3576, -1657, 1013, 2507, 1916, 1422, 2066, 1506, -1599, -4721, -4550, -523, 4417, 5552, 1419, -2804, -1546, 2386, 1780, -3388, -6055, -2984, 1967, 4823, 5164, 3554, 583, -2043, -2739, -1635, 116, 1057, -328, -3647, -5489, -2897, 2514, 6041, 5087, 1640, -72, 1842, 4396, 2985, -2243, -6040, -5291, -2785, -1780, -1163, 1445, 5601, 9018, 9405, 4978, -3354, -10829, -13054, -10099, -4365, 2489, 8349, 10300, 7860, 3661, -16, -2603, -3587, -2895, -2376, -3721, -5276, -3506, 2305, 8309, 9201, 2977, -6753, -13075, -11319, -3168, 4907, 7555, 4914, 1262, -208, -406, -1847, -4245, -4335, -316, 5097, 7183, 4059, -1657, -5544, -5266, -2250, 94, -11, -851, 504, 3913, 5496, 2554, -2325, -4571, -3560, -2056, -1342, -867, -867, -1135, 689, 5159, 7706, 3941, -3547, -7950, -6520, -2454, 623, 2319, 3483, 4034, 3944, 3702, 2628, -499, -4106, -4442, -1039, 1847, 1194, -573, 326, 3052, 3196, -993, -5825, -6177, -1076, 5466, 8585, 6612, 1460, -3505, -5735, -5133, -3874, -3319, -1890, 1734, 5247, 6081, 5405, 4505, 1343, -4068, -6302, -2636, 1314, 156, -2924, -1982, 2817, 6687, 6369, 1922, -4177, -8081, -7280, -3040, 1319, 4126, 5938, 7062, 6239, 2370, -3259, -7296, -6983, -2497, 3002, 5757, 4528, 1516, -449, -1216, -2458, -4028, -3559, -553, 1631, 139, -2592, -1473, 4049, 8590, 7478, 2162, -2677, -5102, -6394, -7039, -5812, -2753, 467, 3419, 6554, 7977, 4829, -1625, -6273, -5967, -2233, 1175, 1387, -1213, -2594, 272, 4526, 4965, 1368, -2526, -5470, -8368, -9086, -3936, 5712, 12970, 12484, 5808, -714, -2719, -2063, -3433, -7145, -8123, -3076, 4322, 7877, 6439, 3952, 2814, 1017, -3143, -7344, -8507, -6429, -2118, 3519, 7751, 7732, 5113, 3486, 1846, -2786, -7787, -7701, -3020, 996, 2508, 3733, 5221, 4999, 2333, -1562, -5631, -8887, -9184, -5095, 1239, 6050, 8496, 9939, 9271, 3820, -4818, -10946, -11804, -9813, -6802, -1037, 7628, 14145, 13744, 8108, 1854, -4040, -10056, -12727, -8453, -360, 5235, 6810, 6696, 5668, 3374, 395, -3259, -7664, -9741, -5771, 2150, 7235, 6199, 2344, 367, 1270, 2572, 1482, -2391, -6524, -7533, -4294, 870, 4404, 4823, 3272, 1289, -540, -1836, -2233, -2141, -2096, -1682, -576, 442, 1015, 2024, 3403, 3511, 1883, 46, -1158, -2318, -3438, -3699, -2591, 395, 5068, 8348, 6493, 739, -3607, -4480, -4645, -5492, -4518, -86, 5358, 7942, 6046, 1353, -2451, -2745, -603, 634, -287, -1134, 282, 2643, 2573, -955, -5212, -6699, -4335, 231, 4105, 5236, 4196, 3017, 1614, -2288, -8325, -11762, -8908, -1737, 4931, 8490, 8927, 6694, 2682, -1088, -3176, -4562, -6821, -8858, -7635, -2275, 4543, 9645, 11747, 10267, 4341, -4780, -12132, -12892, -7411, 74, 6550, 10896, 11414, 7285, 1216, -3592, -7387, -10870, -11252, -5858, 2626, 8620, 9670, 7032, 2286, -3458, -7986, -8806, -5834, -1254, 3142, 6352, 6768, 3810, 413, -137, 521, -1739, -6062, -6736, -1705, 3732, 3760, -601, -3522, -2110, 726, 1320, 426, 1005, 2714, 2424, -342, -2959, -4501, -6020, -5983, -1174, 7115, 12955, 12456, 6688, -1154, -7698, -9977, -7589, -3256, 407, 2865, 4113, 4069, 3745, 4055, 3482, -324, -6433, -10257, -7956, -483, 6879, 9193, 6252, 1786, -1596, -4559, -7488, -8010, -4238, 1804, 6137, 6727, 4480, 1846, 444, -865, -3919, -6723, -4992, 681, 4408, 3354, 1009, 588, 967, 551, -177, -939, -2115, -2615, -960, 1756, 2958, 2288, 2064, 4024, 6617, 6089, 980, -4979, -6715, -4140, -1380, -148, 1474, 3682, 3711, 789, -2202, -2761, -1021, 1545, 2915, 1188, -2935, -5800, -4825, -1378, 1584, 3043, 3812, 4240, 3525, 1099, -2200, -4551, -4450, -1969, 868, 1941, 1734, 2325, 2950, 125, -5825, -8587, -3655, 5032, 9753, 7740, 2348, -2337, -5085, -6533, -6750, -4563, 490, 6202, 8979, 7426, 3523, 45, -1996, -3134, -3896, -4263, -4122, -3545, -2404, -119, 3482, 6858, 7211, 3289, -2538, -6033, -5222, -2073, 261, 887, 912, 953, 749, 586, 870, 708, -900, -2922, -3341, -1731, 789, 3054, 4026, 2998, 509, -2198, -4560, -5937, -4444, 880, 7325, 10206, 7286, 397, -6490, -9696, -7554, -1457, 4895, 8385, 8772, 7464, 4587, -865, -7769, -12046, -10419, -3780, 3612, 7390, 6231, 3100, 2145, 3411, 2981, -809, -4859, -6377, -6416, -6364, -4584, 835, 8220, 13190, 12493, 6385, -1868, -8401, -11044, -9709, -5585, -743, 2499, 3401, 3359, 3619, 3354, 1016, -3442, -8171, -10251, -7525, -1485, 2724, 1879, -951, -544, 3197, 5269, 2155, -4149, -8437, -7130, -1180, 5265, 8983, 9591, 7414, 2109, -4996, -9759, -8928, -3824, 1548, 4940, 6702, 7158, 5364, 933, -4319, -7611, -7665, -5480, -2956, -1155, 399, 2893, 6380, 8830, 7568, 2085, -4923, -9649, -9917, -5737, 1474, 8847, 12617, 10953, 5740, 154, -4169, -6483, -6100, -4064, -2948, -3048, -1373, 3583, 8478, 8714, 3823, -2536, -6717, -7416, -4916, -387, 4021, 6339, 6443, 5306, 3014, -561, -3547, -3144, 446, 3437, 2951, 381, -1175, -1093, -917, -1425, -2316, -3427, -4010, -2249, 2042, 5684, 5513, 2404, -266, -1162, -1619, -2416, -2739, -2401, -2179, -1405, 1490, 5348, 6741, 4958, 2601, 443, -3692, -9433, -11789, -7274, 750, 5543, 4588, 1590, 849, 1609, -33, -4425, -7014, -4637, 327, 3658, 3760, 972, -3512, -6321, -3603, 3795, 9903, 9851, 4200, -3024, -7938, -8462, -5152, -1134, 590, 426, 1233, 3671, 4870, 3029, 299, -969, -1618, -2933, -3971, -3703, -2407, 107, 3857, 6291, 4976, 2071, 1647, 3411, 3424, 222, -3654, -5792, -6183, -5278, -2580, 1700, 5435, 6551, 5172, 2620, -606, -4338, -7083, -6735, -2952, 2132, 5570, 5634, 2781, -632, -2000, -804, 803, 743, -63, 932, 3749, 5095, 2417, -2716, -6138, -5418, -2230, -420, -1573, -2956, -786, 4857, 9743, 9982, 5451, -1159, -7066, -10546, -10569, -6677, 198, 7195, 10923, 10219, 6936, 3394, -76, -4276, -8850, -11959, -11686, -7346, -254, 6585, 10430, 10607, 7887, 2911, -3421, -8641, -9817, -6523, -1324, 3220, 6506, 8199, 6912, 2554, -1924, -3560, -2931, -2609, -3265, -3584, -3031, -2133, -485, 2640, 5488, 4813, 738, -2729, -3343, -3038, -3190, -1865, 1930, 5354, 5696, 4042, 2799, 2137, 608, -2296, -5402, -6724, -4680, 644, 6788, 10135, 8839, 4497, 293, -2353, -4344, -6290, -6694, -3596, 2471, 8005, 9571, 7073, 3206, -217, -3878, -8159, -10548, -7706, 169, 8442, 11825, 8731, 2053, -3762, -6249, -5920, -4315, -1811, 2034, 6156, 7572, 4637, -236, -3105, -3331, -3802, -6310, -8694, -7135, -555, 7387, 10940, 7933, 2208, -1186, -1822, -2548, -4133, -4620, -2930, -63, 2574, 3947, 3553, 2117, 867, -217, -1938, -4077, -5809, -6922, -7009, -4955, -739, 3820, 6929, 7669, 5307, 245, -4929, -7860, -8764, -8225, -4876, 2004, 9578, 13432, 11239, 3956, -4591, -9676, -9537, -6628, -3562, -54, 4389, 7785, 7859, 4458, -1193, -7037, -9968, -8259, -4023, -566, 1675, 4139, 6605, 7091, 4408, -232, -3439, -2538, 529, 900, -1986, -2955, 889, 5559, 6235, 3010, -1707, -6618, -9971, -9063, -3769, 2336, 6028, 7136, 6280, 2923, -2171, -5141, -2953, 2105, 5010, 4152, 1894, -28, -2027, -3902, -4091, -2403, -759, -188, 521, 1956, 2458, 1038, -682, -1417, -2196, -3277, -2330, 1590, 5116, 4650, 1253, -1363, -2238, -3495, -5747, -6227, -2575, 3528, 8005, 8499, 5937, 2994, 1622, 1347, 56, -2944, -5478, -5204, -2756, -838, -813, -1371, -518, 1763, 3175, 1769, -1423, -3526, -3406, -2441, -1517, 509, 4325, 7997, 8896, 6692, 3163, -278, -3563, -6528, -7649, -5461, -1230, 1659, 1939, 1783, 2416, 1648, -1768, -4863, -4637, -2144, 380, 2865, 5327, 5949, 3649, -83, -3277, -5212, -5642, -4343, -1753, 1345, 4671, 7734, 8774, 6179, 1128, -3098, -5040, -6049, -6568, -4476, 855, 5740, 6228, 3112, 191, -1089, -2546, -5248, -7179, -5615, -465, 5650, 9808, 10474, 7640, 2819, -1353, -3132, -3550, -4647, -5917, -4973, -2044, -485, -1780, -3356, -2702, -644, 664, 507, -495, -1323, -1112, -24, 816, 866, 584, 147, -649, -1132, -263, 1404, 1921, 365, -2035, -3414, -3118, -1902, -805, -120, 551, 1404, 1788, 780, -1380, -2924, -2284, -57, 1671, 1810, 990, -34, -1212, -2250, -2143, -186, 3077, 6011, 6980, 5825, 4160, 3370, 2703, 585, -2619, -4791, -4730, -3238, -1712, -773, -111, 796, 1595, 1116, -714, -2046, -1477, 104, 1428, 2755, 4360, 5181, 4470, 3004, 1819, 1445, 2126, 2864, 1382, -2674, -6065, -5759, -2710, 112, 1487, 1951, 1893, 1221, -111, -1968, -3780, -4631, -4182, -2866, -947, 1506, 3632, 4231, 3338, 2049, 941, -205, -1552, -2998, -4156, -3841, -846, 3830, 6749, 5240, 285, -4418, -6004, -4924, -3928, -4425, -4666, -2627, 459, 1664, 685, -30, 787, 1751, 1275, -419, -1863, -1529, 1223, 5157, 7407, 6003, 2199, -746, -1291, -1091, -2281, -4500, -5575, -4355, -1724, 758, 2321, 3149, 3507, 2922, 716, -2479, -4656, -4430, -2262, 640, 3498, 5685, 6494, 5638, 3355, 143, -3036, -4901, -4868, -3289, -540, 2867, 5360, 5282, 2901, -117, -3019, -6025, -8376, -8171, -4406, 1607, 6853, 8603, 6600, 3155, 504, -1189, -2451, -2725, -1411, 745, 2611, 3777, 3944, 2740, 593, -1542, -3213, -4065, -3503, -2055, -1585, -2699, -3618, -2812, -1050, 137, 395, 224, 83, 203, 405, 102, -827, -1561, -1333, -476, 45, -159, -616, -698, -319, 153, 515, 947, 1470, 1445, 119, -2280, -4413, -5075, -4380, -3372, -2634, -1732, -138, 1727, 2795, 2519, 1329, -87, -1382, -2217, -2058, -785, 1019, 2765, 4252, 5074, 4533, 2586, 164, -1787, -2962, -3359, -2968, -1835, -37, 2163, 3911, 4129, 2602, 216, -1856, -2741, -2101, -573, 627, 1136, 1653, 2381, 2511, 1689, 556, -418, -1276, -1747, -1367, -271, 1138, 2682, 3772, 3403, 1559, -428, -1461, -1648, -1477, -1120, -872, -1213, -2047, -2441, -1516, 518, 2357, 2689, 1373, -468, -1517, -1379, -645, -41, 309, 714, 1333, 1984, 2346, 2020, 722, -1162, -2607, -2968, -2557, -1828, -694, 864, 2219, 2698, 2309, 1478, 505, -578, -1870, -3231, -3929, -3186, -1253, 660, 1743, 2226, 2508, 2315, 1059, -1297, -3875, -5247, -4467, -1973, 714, 2356, 2773, 2323, 1141, -750, -2862, -4264, -4289, -3094, -1413, 136, 1386, 2283, 2489, 1536, -505, -2691, -3804, -3356, -1876, -190, 1370, 2842, 3960, 4082, 2936, 1024, -915, -2474, -3351, -3094, -1533, 810, 3073, 4532, 4725, 3627, 1783, -112, -1740, -2955, -3352, -2523, -553, 1970, 4230, 5421, 5170, 3860, 2219, 693, -491, -943, -304, 1237, 2992, 4280, 4709, 4092, 2465, 224, -1957, -3468, -3993, -3420, -1685, 942, 3390, 4193, 2890, 683, -788, -1016, -569, 131, 1212, 2653, 3948, 4667, 4782, 4223, 2786, 834, -639, -1205, -1532, -2104, -2332, -1641, -591, -74, -121, -227, -213, -228, -299, -369, -461, -557, -473, -83, 430, 716, 642, 405, 244, 194, 172, 152, 160, 203, 309, 532, 806, 875, 505, -253, -1134, -1856, -2183, -1993, -1465, -1025, -929, -1025, -1042, -890, -640, -348, 17, 583, 1509, 2751, 3916, 4492, 4229, 3263, 1921, 488, -846, -1864, -2285, -2025, -1384, -769, -223, 440, 1107, 1379, 1191, 995, 1219, 1800, 2323, 2399, 1947, 1224, 558, 57, -269, -317, -134, -101, -465, -909, -1002, -830, -778, -966, -1171, -1096, -544, 359, 1140, 1420, 1261, 828, 6, -1255, -2500, -3118, -3080, -2886, -2812, -2562, -1840, -906, -304, -209, -370, -643, -1159, -1910, -2497, -2600, -2482, -2721, -3463, -4211, -4422, -4097, -3703, -3617, -3769, -3827, -3658, -3455, -3371, -3267, -2965, -2550, -2235, -2115, -2202, -2505, -2918, -3209, -3298, -3389, -3705, -4172, -4481, -4423, -4016, -3397, -2744, -2255, -2009, -1799, -1295, -473, 253, 451, 143, -249, -398, -346, -277, -167, 210, 1005, 2058, 2988, 3534, 3786, 3999, 4233, 4385, 4493, 4680, 4883, 4968, 5032, 5251, 5512, 5575, 5467, 5397, 5455, 5613, 5886, 6262, 6589, 6742, 6824, 7042, 7418, 7813, 8183, 8528, 8662, 8416, 7996, 7747, 7659, 7515, 7372, 7381, 7430, 7393, 7412, 7555, 7564, 7316, 7086, 7083, 7094, 6835, 6411, 6120, 5999, 5807, 5400, 4914, 4538, 4287, 4109, 4043, 4138, 4298, 4347, 4209, 3995, 3864, 3768, 3475, 2907, 2307, 1873, 1451, 837, 145, -420, -909, -1436, -1938, -2324, -2628, -2841, -2866, -2725, -2590, -2524, -2445, -2321, -2249, -2300, -2466, -2719, -3057, -3476, -3915, -4297, -4575, -4751, -4870, -4988, -5169, -5406, -5642, -5798, -5816, -5688, -5510, -5434, -5498, -5580, -5559, -5472, -5415, -5373, -5244, -5033, -4849, -4709, -4504, -4215, -3981, -3852, -3737, -3661, -3807, -4207, -4631, -4901, -5082, -5269, -5420, -5473, -5463, -5439, -5387, -5260, -5065, -4843, -4597, -4247, -3745, -3201, -2789, -2517, -2285, -2115, -2130, -2300, -2442, -2526, -2694, -2972, -3229, -3434, -3716, -4128, -4534, -4796, -4940, -5041, -5059, -4924, -4695, -4514, -4435, -4375, -4259, -4101, -3989, -4007, -4118, -4153, -4053, -3971, -3982, -3906, -3687, -3601, -3854, -4230, -4448, -4577, -4834, -5198, -5490, -5654, -5762, -5866, -5962, -6045, -6097, -6042, -5715, -5062, -4343, -3940, -3832, -3570, -2956, -2338, -2030, -1913, -1831, -1868, -2013, -2042, -1969, -2090, -2442, -2667, -2605, -2559, -2773, -3032, -3031, -2852, -2723, -2501, -1869, -954, -286, -41, 203, 750, 1244, 1266, 1061, 1161, 1518, 1640, 1455, 1447, 1869, 2396, 2697, 2885, 3171, 3426, 3448, 3332, 3257, 3159, 2996, 2967, 3087, 2977, 2519, 2163, 2225, 2462, 2599, 2677, 2751, 2822, 3034, 3383, 3413, 2755, 1764, 1138, 1117, 1447, 1893, 2370, 2690, 2653, 2436, 2511, 3030, 3603, 3849, 3802, 3607, 3204, 2561, 1929, 1559, 1369, 1153, 996, 1188, 1746, 2309, 2569, 2579, 2557, 2569, 2508, 2286, 1955, 1738, 1888, 2428, 2969, 3023, 2627, 2375, 2593, 2839, 2565, 1847, 1058, 345, -155, -165, 319, 942, 1473, 1835, 1780, 1261, 901, 1277, 1959, 2051, 1480, 1067, 1386, 2089, 2465, 2321, 2121, 2265, 2512, 2350, 1798, 1458, 1705, 2213, 2462, 2392, 2363, 2637, 3077, 3316, 3163, 2809, 2593, 2633, 2822, 3048, 3220, 3166, 2861, 2618, 2738, 3046, 3055, 2593, 1943, 1426, 1049, 706, 455, 421, 500, 349, -242, -1139, -2069, -2970, -4006, -5302, -6781, -8299, -9762, -10905, -11100, -9859, -7596, -5418, -3848, -2196, 380, 3541, 5966, 6804, 6502, 6124, 6124, 6110, 5703, 5202, 5099, 5301, 5354, 5252, 5410, 5862, 6120, 5898, 5546, 5601, 6245, 7312, 8603, 10134, 12004, 14096, 15955, 17170, 17751, 17995, 18166, 18365, 18586, 18733, 18725, 18669, 18795, 19158, 19628, 20045, 20257, 20005, 19065, 17571, 16048, 14972, 14321, 13678, 12750, 11734, 11156, 11310, 11979, 12694, 13242, 13819, 14612, 15411, 15776, 15534, 14911, 14171, 13327, 12258, 10965, 9642, 8486, 7457, 6262, 4638, 2697, 847, -619, -1832, -3064, -4298, -5257, -5800, -5966, -5737, -5153, -4577, -4376, -4407, -4369, -4476, -5265, -6740, -8223, -9111, -9468, -9823, -10563, -11553, -12345, -12753, -13089, -13753, -14736, -15728, -16541, -17244, -17968, -18664, -19074, -18939, -18270, -17387, -16601, -15923, -15189, -14362, -13599, -13045, -12709, -12499, -12316, -12068, -11744, -11477, -11415, -11486, -11485, -11410, -11474, -11777, -12205, -12656, -13030, -13153, -12939, -12532, -11972, -11038, -9678, -8252, -7080, -6000, -4712, -3285, -2097, -1404, -1135, -1045, -929, -739, -532, -390, -394, -576, -830, -969, -934, -881, -984, -1299, -1828, -2476, -2923, -2856, -2368, -1855, -1515, -1246, -939, -606, -283, -84, -187, -615, -1184, -1730, -2209, -2546, -2675, -2728, -2941, -3339, -3724, -4035, -4502, -5365, -6555, -7799, -8903, -9794, -10410, -10741, -10858, -10793, -10490, -10002, -9534, -9193, -8874, -8520, -8296, -8363, -8621, -8831, -8908, -8919, -8885, -8796, -8798, -9074, -9545, -9924, -10120, -10323, -10670, -11029, -11168, -10959, -10443, -9740, -8936, -8071, -7207, -6479, -5932, -5467, -5020, -4674, -4483, -4401, -4390, -4375, -4132, -3539, -2804, -2188, -1664, -1149, -761, -572, -447, -386, -568, -926, -1097, -944, -703, -473, 21, 925, 1900, 2576, 3058, 3621, 4173, 4524, 4849, 5317, 5601, 5417, 5151, 5335, 5874, 6369, 6777, 7179, 7300, 6804, 5862, 5015, 4575, 4368, 4065, 3623, 3300, 3314, 3623, 4113, 4733, 5301, 5471, 5127, 4592, 4197, 3858, 3321, 2615, 1987, 1499, 1037, 634, 468, 485, 345, -99, -581, -838, -1005, -1351, -1805, -2065, -2079, -2052, -2034, -1830, -1432, -1141, -1130, -1240, -1361, -1645, -2167, -2733, -3171, -3510, -3762, -3820, -3642, -3341, -3030, -2703, -2266, -1687, -1176, -1056, -1342, -1689, -1878, -2007, -2059, -1815, -1342, -966, -677, -188, 447, 947, 1362, 1875, 2255, 2191, 1900, 1847, 2082, 2315, 2453, 2633, 2903, 3167, 3395, 3639, 3857, 3916, 3818, 3750, 3836, 3968, 4035, 4151, 4497, 5053, 5628, 6103, 6525, 6936, 7250, 7352, 7253, 7075, 6862, 6559, 6165, 5797, 5576, 5533, 5634, 5816, 5970, 6015, 6012, 6118, 6302, 6240, 5721, 5049, 4666, 4464, 4036, 3509, 3365, 3545, 3552, 3355, 3340, 3476, 3388, 3073, 2827, 2608, 2122, 1356, 614, 145, -20, -20, -50, -207, -429, -634, -814, -988, -1238, -1727, -2465, -3155, -3542, -3765, -4062, -4265, -3974, -3252, -2670, -2549, -2528, -2191, -1761, -1764, -2202, -2598, -2732, -2858, -3128, -3254, -2922, -2246, -1614, -1184, -767, -195, 322, 388, -113, -872, -1516, -1923, -2172, -2303, -2277, -2046, -1596, -952, -83, 1088, 2374, 3172, 3104, 2653, 2574, 2814, 2757, 2332, 2084, 2340, 3014, 4036, 5240, 6090, 6174, 5873, 5869, 6122, 5940, 5111, 4254, 3810, 3451, 2921, 2715, 3311, 4205, 4534, 4314, 4256, 4514, 4460, 3828, 3216, 3080, 3040, 2651, 2217, 2241, 2581, 2694, 2374, 1798, 1102, 194, -1054, -2641, -4413, -6132, -7507, -8229, -8110, -7233, -5812, -3844, -1077, 2504, 6301, 9415, 11396, 12488, 13123, 13365, 12968, 11842, 10260, 8585, 7020, 5784, 5236, 5471, 5969, 6158, 6179, 6639, 7635, 8633, 9289, 9878, 10877, 12403, 14204, 15944, 17466, 18876, 20356, 21785, 22678, 22680, 22114, 21611, 21279, 20698, 19771, 18953, 18527, 18289, 18093, 18048, 18089, 17861, 17156, 16155, 15162, 14349, 13649, 12876, 12015, 11412, 11425, 11992, 12770, 13627, 14664, 15806, 16648, 16873, 16578, 16013, 15174, 13863, 12028, 9818, 7435, 5080, 2976, 1198, -436, -2114, -3701, -4901, -5696, -6324, -6817, -6918, -6605, -6262, -6095, -5821, -5162, -4344, -3831, -3882, -4506, -5553, -6743, -7902, -9131, -10598, -12209, -13665, -14781, -15595, -16222, -16663, -16838, -16741, -16527, -16389, -16357, -16282, -16007, -15593, -15235, -14943, -14479, -13716, -12822, -11934, -11002, -10089, -9420, -8955, -8413, -7832, -7581, -7736, -8015, -8255, -8483, -8662, -8750, -8869, -9038, -9036, -8735, -8275, -7753, -7062, -6141, -5050, -3804, -2367, -825, 637, 1958, 3193, 4302, 5070, 5332, 5156, 4765, 4256, 3541, 2573, 1518, 588, -188, -875, -1412, -1661, -1643, -1546, -1474, -1338, -1056, -693, -378, -162, -40, -30, -191, -528, -981, -1512, -2156, -2973, -3964, -5063, -6174, -7204, -8133, -9051, -10081, -11190, -12171, -12921, -13558, -14262, -15034, -15742, -16334, -16850, -17281, -17544, -17597, -17526, -17443, -17368, -17252, -17069, -16845, -16666, -16671, -16933, -17368, -17823, -18282, -18861, -19594, -20310, -20839, -21163, -21344, -21331, -21005, -20388, -19610, -18744, -17747, -16646, -15541, -14483, -13445, -12443, -11602, -11037, -10692, -10367, -9929, -9493, -9242, -9119, -8877, -8441, -7931, -7379, -6717, -6025, -5384, -4650, -3755, -2965, -2418, -1843, -1081, -410, -14, 349, 897, 1489, 2003, 2549, 3151, 3620, 3897, 4186, 4636, 5095, 5363, 5450, 5452, 5356, 5195, 5169, 5335, 5361, 4941, 4292, 3910, 3924, 4001, 3877, 3675, 3631, 3745, 3886, 4015, 4177, 4375, 4563, 4667, 4541, 4092, 3458, 2886, 2387, 1721, 775, -227, -964, -1341, -1470, -1494, -1566, -1814, -2104, -2080, -1641, -1145, -896, -814, -789, -906, -1080, -988, -601, -360, -560, -952, -1213, -1442, -1857, -2300, -2490, -2546, -2758, -2985, -2890, -2562, -2301, -1996, -1349, -519, 91, 515, 1091, 1825, 2350, 2528, 2632, 2893, 3195, 3376, 3516, 3745, 4034, 4308, 4622, 4990, 5272, 5425, 5637, 6027, 6359, 6405, 6390, 6708, 7261, 7639, 7843, 8246, 8873, 9357, 9575, 9752, 9974, 10123, 10192, 10250, 10252, 10150, 10030, 9998, 10065, 10193, 10271, 10183, 9968, 9814, 9753, 9566, 9149, 8731, 8557, 8504, 8294, 7947, 7689, 7481, 7078, 6561, 6256, 6087, 5591, 4707, 3951, 3608, 3305, 2684, 1993, 1656, 1563, 1246, 605, 13, -287, -501, -889, -1396, -1823, -2158, -2504, -2844, -3107, -3371, -3723, -4050, -4255, -4465, -4724, -4849, -4944, -5369, -5939, -6036, -5750, -5817, -6253, -6328, -5904, -5523, -5282, -4857, -4385, -4190, -3996, -3426, -2869, -2935, -3375, -3376, -2835, -2492, -2717, -2939, -2600, -2011, -1769, -1843, -1785, -1458, -1047, -686, -474, -597, -960, -983, -282, 593, 770, 360, 451, 1574, 2930, 3484, 3301, 3243, 3731, 4333, 4492, 4210, 3965, 4186, 4856, 5458, 5356, 4449, 3488, 3384, 3959, 3945, 2759, 1555, 1627, 2483, 2842, 2847, 3631, 5118, 6044, 6004, 5898, 6274, 6572, 6202, 5412, 4737, 4235, 3700, 3367, 3803, 4933, 5770, 5664, 5318, 5699, 6521, 6847, 6564, 6040, 5114, 3740, 2755, 2685, 2826, 2597, 2651, 3517, 4345, 4193, 3620, 3806, 4666, 4885, 3710, 1875, 577, 140, 44, -177, -594, -1182, -1998, -3068, -4302, -5606, -6977, -8458, -9865, -10610, -9887, -7294, -3225, 1560, 6745, 12368, 17942, 22305, 24688, 25327, 24625, 22349, 18203, 12805, 7551, 3656, 1469, 631, 743, 1860, 4291, 7898, 11924, 15490, 18154, 19935, 21116, 22014, 22854, 23795, 24972, 26323, 27422, 27943, 28131, 28400, 28539, 27972, 26547, 24600, 22380, 20041, 18036, 16954, 16883, 17302, 17683, 17895, 18070, 18257, 18287, 17896, 16895, 15295, 13389, 11596, 10213, 9314, 8935, 9201, 10122, 11360, 12463, 13265, 13831, 13975, 13170, 11122, 8118, 4708, 1192, -2375, -5909, -9175, -11892, -13886, -15132, -15699, -15641, -15014, -13981, -12835, -11845, -11066, -10344, -9520, -8731, -8376, -8675, -9380, -10190, -11264, -12927, -15044, -17081, -18784, -20396, -22083, -23582, -24514, -24822, -24643, -23975, -22751, -21121, -19355, -17617, -15987, -14558, -13319, -12194, -11322, -10882, -10677, -10340, -9931, -9736, -9640, -9283, -8691, -8148, -7664, -7070, -6481, -6209, -6310, -6532, -6641, -6607, -6522, -6449, -6358, -6162, -5767, -5069, -4012, -2694, -1319, -3, 1310, 2669, 3980, 5110, 6010, 6623, 6800, 6431, 5585, 4420, 3006, 1362, -383, -2044, -3551, -4911, -5979, -6512, -6501, -6194, -5777, -5243, -4596, -3937, -3325, -2800, -2483, -2500, -2868, -3538, -4484, -5639, -6944, -8401, -9994, -11578, -13027, -14332, -15425, -16209, -16775, -17353, -17934, -18308, -18469, -18667, -19006, -19391, -19806, -20364, -21002, -21474, -21675, -21740, -21775, -21650, -21221, -20595, -19994, -19433, -18792, -18137, -17768, -17808, -18038, -18263, -18587, -19108, -19624, -19947, -20154, -20254, -19965, -19121, -17946, -16675, -15260, -13683, -12088, -10501, -8775, -6989, -5522, -4575, -3892, -3214, -2687, -2534, -2602, -2633, -2754, -3150, -3533, -3431, -2873, -2227, -1582, -719, 395, 1540, 2574, 3562, 4500, 5218, 5629, 5869, 6083, 6206, 6112, 5923, 5876, 5956, 5915, 5700, 5531, 5487, 5369, 5120, 4937, 4833, 4497, 3882, 3441, 3491, 3635, 3303, 2590, 2072, 1894, 1718, 1518, 1685, 2207, 2495, 2302, 2114, 2428, 3100, 3581, 3438, 2719, 1992, 1796, 1902, 1522, 361, -969, -1711, -1760, -1694, -2169, -3138, -3729, -3330, -2532, -2220, -2125, -1362, 27, 1257, 2070, 2730, 3246, 3567, 3907, 4189, 3943, 3162, 2436, 2031, 1697, 1324, 1021, 727, 414, 374, 791, 1435, 2064, 2714, 3413, 4067, 4711, 5504, 6407, 7202, 7813, 8334, 8748, 8876, 8736, 8691, 9073, 9682, 9931, 9545, 8935, 8693, 8884, 9052, 8855, 8436, 8137, 8104, 8274, 8557, 8910, 9303, 9674, 9976, 10239, 10574, 10964, 11211, 11189, 11039, 10933, 10848, 10732, 10700, 10787, 10770, 10434, 9876, 9329, 8821, 8171, 7250, 6132, 5040, 4192, 3666, 3392, 3231, 3113, 3072, 3179, 3433, 3739, 3947, 3881, 3453, 2753, 2046, 1531, 1179, 824, 377, -111, -560, -971, -1416, -1928, -2468, -3076, -3891, -4917, -5839, -6371, -6595, -6703, -6632, -6279, -5788, -5274, -4618, -3812, -3190, -3022, -3190, -3438, -3634, -3759, -3925, -4292, -4758, -4971, -4805, -4505, -4244, -3920, -3522, -3271, -3293, -3450, -3514, -3359, -3067, -2906, -2928, -2703, -1917, -1017, -626, -519, 10, 926, 1403, 1017, 361, 293, 897, 1399, 1069, 198, -97, 768, 2103, 2813, 2645, 2190, 2047, 2354, 2830, 3076, 3018, 2944, 2929, 2653, 2155, 2080, 2710, 3412, 3590, 3528, 3770, 4252, 4559, 4653, 4820, 5094, 5138, 4708, 4011, 3449, 3160, 2921, 2473, 1929, 1789, 2321, 2988, 3002, 2524, 2570, 3507, 4460, 4563, 4052, 3760, 4107, 4729, 4770, 3736, 2323, 1900, 2741, 3440, 2723, 1266, 837, 1879, 2923, 2589, 1296, 446, 538, 851, 666, 85, -366, -474, -515, -876, -1571, -2262, -2756, -3331, -4389, -5881, -7220, -7678, -6843, -4751, -1772, 1710, 5492, 9517, 13663, 17535, 20489, 21906, 21570, 19779, 17070, 13830, 10214, 6494, 3330, 1408, 929, 1632, 3284, 5853, 9125, 12593, 15849, 18791, 21388, 23518, 25137, 26436, 27675, 28860, 29655, 29759, 29313, 28744, 28046, 26648, 24264, 21470, 19069, 17211, 15579, 14232, 13685, 14141, 15217, 16530, 18102, 19813, 21138, 21710, 21712, 21351, 20420, 18830, 17002, 15370, 13908, 12464, 11177, 10310, 9909, 9724, 9429, 8786, 7764, 6390, 4671, 2674, 576, -1558, -3800, -6090, -8093, -9541, -10458, -10962, -11034, -10693, -10169, -9691, -9242, -8710, -8241, -8129, -8411, -8873, -9438, -10290, -11522, -13029, -14727, -16634, -18636, -20504, -22159, -23668, -25009, -25971, -26310, -25917, -24856, -23289, -21376, -19220, -16942, -14756, -12890, -11457, -10464, -9956, -10029, -10646, -11527, -12429, -13334, -14217, -14883, -15225, -15372, -15389, -15059, -14260, -13263, -12420, -11744, -10942, -9759, -8231, -6640, -5266, -4118, -2978, -1747, -581, 287, 830, 1169, 1378, 1445, 1393, 1302, 1194, 1025, 833, 697, 572, 313, -128, -667, -1218, -1703, -2025, -2175, -2255, -2275, -2051, -1438, -569, 285, 986, 1577, 2095, 2431, 2415, 1980, 1212, 154, -1251, -2993, -4843, -6559, -8117, -9591, -10933, -12014, -12802, -13307, -13533, -13548, -13458, -13305, -13064, -12778, -12533, -12336, -12175, -12154, -12385, -12839, -13400, -14042, -14860, -15878, -16986, -18014, -18896, -19636, -20227, -20657, -20893, -20879, -20613, -20217, -19801, -19348, -18861, -18429, -18045, -17552, -16949, -16400, -15916, -15326, -14640, -14040, -13525, -12935, -12307, -11806, -11427, -11074, -10770, -10564, -10397, -10198, -9978, -9742, -9532, -9385, -9147, -8536, -7570, -6556, -5547, -4328, -2919, -1586, -370, 854, 1954, 2697, 3159, 3521, 3728, 3687, 3544, 3422, 3234, 2967, 2826, 2915, 3031, 2948, 2797, 2915, 3424, 4031, 4404, 4636, 5131, 6033, 6967, 7498, 7649, 7800, 8122, 8383, 8329, 8031, 7660, 7191, 6629, 6107, 5504, 4501, 3332, 2698, 2643, 2502, 2128, 2042, 2279, 2327, 2207, 2396, 2764, 2734, 2331, 2042, 1867, 1423, 837, 706, 1154, 1559, 1428, 1098, 1175, 1615, 1756, 1269, 544, 11, -422, -976, -1532, -1940, -2343, -2771, -2883, -2540, -2119, -1889, -1603, -1072, -541, -196, 161, 708, 1258, 1509, 1379, 1095, 1025, 1336, 1744, 1797, 1393, 878, 623, 693, 914, 1092, 1113, 992, 946, 1281, 2047, 2948, 3714, 4403, 5123, 5758, 6220, 6713, 7398, 7999, 8087, 7672, 7231, 7138, 7316, 7470, 7481, 7458, 7532, 7746, 8051, 8337, 8601, 8946, 9284, 9304, 9026, 8964, 9350, 9731, 9731, 9631, 9810, 10223, 10691, 11105, 11261, 11081, 10898, 11001, 11101, 10770, 10125, 9559, 9163, 8780, 8457, 8353, 8349, 8158, 7764, 7476, 7440, 7428, 7227, 6912, 6586, 6173, 5625, 5151, 4964, 4991, 4954, 4671, 4183, 3653, 3218, 2894, 2524, 1889, 942, -57, -777, -1138, -1345, -1578, -1790, -1867, -1823, -1752, -1681, -1649, -1759, -2035, -2376, -2791, -3421, -4151, -4572, -4496, -4203, -4047, -4074, -4112, -3949, -3491, -2947, -2725, -2952, -3319, -3517, -3512, -3395, -3272, -3323, -3570, -3616, -3031, -2055, -1483, -1712, -2222, -2254, -1776, -1449, -1635, -1856, -1466, -544, 284, 781, 1304, 2058, 2761, 3131, 3222, 3188, 3088, 2939, 2662, 2143, 1568, 1332, 1458, 1617, 1798, 2309, 3047, 3499, 3575, 3774, 4351, 4879, 4877, 4472, 4143, 4052, 4021, 3965, 3976, 4088, 4320, 4750, 5263, 5520, 5414, 5173, 4889, 4441, 3901, 3467, 3038, 2433, 1905, 1871, 2238, 2541, 2636, 2792, 3121, 3366, 3324, 3110, 2836, 2385, 1752, 1228, 991, 824, 519, 198, 35, 8, 91, 359, 712, 792, 407, -138, -375, -244, -123, -335, -835, -1340, -1550, -1341, -952, -880, -1345, -1976, -2245, -2106, -1982, -2151, -2440, -2559, -2508, -2486, -2513, -2372, -1914, -1309, -1000, -1299, -1947, -2326, -2333, -2623, -3628, -4911, -5880, -6443, -6548, -5859, -4315, -2274, 169, 3246, 6813, 10285, 13254, 15550, 16908, 17093, 16263, 14699, 12423, 9502, 6546, 4406, 3324, 2849, 2719, 3346, 5153, 7848, 10737, 13510, 16217, 18671, 20441, 21538, 22530, 23733, 24763, 25123, 24863, 24299, 23455, 22201, 20644, 19049, 17496, 15840, 14024, 12351, 11406, 11488, 12260, 13217, 14334, 15826, 17517, 18987, 20108, 20905, 21108, 20466, 19166, 17580, 15849, 14008, 12118, 10202, 8363, 6909, 5937, 5167, 4445, 3986, 3810, 3575, 3159, 2670, 1967, 891, -221, -1080, -2017, -3294, -4436, -5000, -5368, -6038, -6755, -7006, -6859, -6823, -7193, -7905, -8807, -9765, -10604, -11307, -12151, -13383, -14820, -16101, -17186, -18236, -19149, -19723, -20026, -20241, -20301, -20011, -19309, -18246, -16937, -15637, -14637, -13972, -13477, -13122, -13109, -13582, -14388, -15346, -16423, -17588, -18564, -19080, -19209, -19213, -19109, -18664, -17767, -16583, -15306, -13981, -12598, -11207, -9899, -8744, -7803, -7141, -6746, -6547, -6528, -6776, -7333, -8088, -8831, -9389, -9665, -9587, -9185, -8621, -8001, -7222, -6159, -4962, -3888, -2973, -2155, -1557, -1292, -1168, -944, -693, -627, -786, -1110, -1554, -1997, -2268, -2421, -2725, -3252, -3709, -3859, -3871, -3946, -3878, -3450, -2976, -2857, -2887, -2685, -2412, -2391, -2490, -2525, -2702, -3153, -3622, -3986, -4440, -5009, -5465, -5825, -6333, -6935, -7332, -7498, -7731, -8177, -8641, -8918, -9055, -9165, -9221, -9172, -9081, -8969, -8746, -8418, -8114, -7863, -7612, -7511, -7761, -8254, -8691, -9023, -9431, -9970, -10486, -10847, -11045, -11103, -11052, -10923, -10732, -10419, -9979, -9514, -9121, -8729, -8223, -7677, -7266, -7002, -6757, -6523, -6403, -6394, -6391, -6396, -6491, -6589, -6473, -6097, -5672, -5362, -5077, -4704, -4350, -4116, -3898, -3584, -3268, -3073, -2952, -2789, -2478, -1946, -1297, -822, -607, -410, -91, 189, 353, 500, 573, 475, 427, 694, 1080, 1267, 1385, 1688, 2008, 2053, 1947, 2035, 2329, 2525, 2454, 2259, 2208, 2411, 2756, 3014, 3075, 3088, 3305, 3696, 3901, 3722, 3459, 3470, 3645, 3669, 3523, 3425, 3445, 3490, 3542, 3675, 3873, 4018, 4028, 3935, 3831, 3801, 3845, 3853, 3689, 3378, 3149, 3159, 3274, 3253, 3096, 2992, 2992, 2925, 2697, 2473, 2465, 2648, 2786, 2736, 2610, 2639, 2907, 3251, 3396, 3243, 2997, 2910, 2938, 2784, 2338, 1897, 1804, 1976, 2017, 1771, 1531, 1617, 1918, 2055, 1896, 1690, 1653, 1688, 1636, 1543, 1502, 1465, 1353, 1185, 1007, 879, 859, 820, 484, -103, -460, -333, -108, -204, -478, -553, -391, -199, -58, 95, 274, 421, 522, 596, 629, 623, 630, 586, 323, -80, -249, -79, 21, -186, -366, -202, 131, 409, 735, 1161, 1455, 1523, 1630, 1964, 2346, 2570, 2744, 3035, 3309, 3401, 3457, 3595, 3566, 3224, 2901, 2821, 2706, 2471, 2508, 2880, 3112, 3133, 3495, 4333, 5037, 5226, 5228, 5409, 5622, 5620, 5489, 5421, 5352, 5167, 4977, 4932, 4939, 4912, 4997, 5238, 5364, 5257, 5228, 5527, 5945, 6174, 6239, 6330, 6467, 6551, 6583, 6623, 6639, 6577, 6502, 6460, 6331, 6081, 5933, 6000, 6048, 5920, 5840, 5952, 6073, 6098, 6177, 6297, 6203, 5882, 5617, 5517, 5381, 5091, 4767, 4524, 4339, 4243, 4346, 4624, 4857, 4948, 5065, 5300, 5458, 5371, 5163, 4991, 4788, 4453, 4044, 3639, 3179, 2644, 2178, 1909, 1780, 1640, 1466, 1376, 1466, 1692, 1935, 2140, 2308, 2428, 2469, 2444, 2333, 2026, 1490, 920, 509, 160, -327, -902, -1367, -1676, -1878, -1931, -1791, -1570, -1358, -1068, -609, -88, 286, 456, 500, 475, 357, 131, -203, -664, -1218, -1706, -1975, -2065, -2098, -2054, -1840, -1527, -1282, -1139, -958, -638, -256, 40, 189, 256, 338, 459, 558, 543, 394, 194, 23, -132, -312, -460, -487, -424, -346, -217, 81, 558, 1038, 1329, 1394, 1385, 1458, 1576, 1563, 1389, 1232, 1191, 1138, 963, 777, 771, 958, 1196, 1377, 1507, 1661, 1891, 2176, 2406, 2457, 2354, 2262, 2242, 2142, 1847, 1510, 1322, 1244, 1161, 1120, 1207, 1343, 1415, 1458, 1578, 1814, 2104, 2298, 2279, 2141, 2100, 2162, 2082, 1732, 1302, 1001, 803, 567, 310, 157, 116, 86, 45, 89, 273, 608, 1050, 1337, 1142, 651, 540, 965, 1188, 635, -286, -902, -1141, -1271, -1361, -1378, -1399, -1403, -1200, -730, -215, 93, 141, 6, -225, -436, -514, -553, -830, -1373, -1802, -1813, -1573, -1438, -1516, -1711, -1956, -2177, -2245, -2131, -1993, -1975, -2034, -2013, -1834, -1573, -1383, -1382, -1594, -1926, -2222, -2401, -2520, -2669, -2845, -2997, -3086, -3061, -2864, -2530, -2225, -2104, -2163, -2237, -2146, -1898, -1714, -1798, -2096, -2355, -2478, -2681, -3172, -3742, -3987, -3895, -3840, -3920, -3791, -3294, -2760, -2483, -2382, -2285, -2206, -2196, -2266, -2479, -2881, -3360, -3699, -3758, -3543, -3256, -3206, -3501, -3849, -3870, -3549, -3219, -3193, -3477, -3800, -3841, -3534, -3130, -2897, -2822, -2712, -2490, -2242, -2061, -2002, -2148, -2561, -3114, -3546, -3737, -3834, -4033, -4343, -4634, -4714, -4385, -3658, -2955, -2724, -2873, -2895, -2565, -2150, -1952, -1978, -2067, -2046, -1752, -1114, -344, 128, 17, -582, -1341, -1990, -2438, -2777, -3258, -4006, -4668, -4606, -3537, -1760, 265, 2305, 4268, 6025, 7453, 8528, 9293, 9743, 9723, 9055, 7843, 6538, 5526, 4773, 4096, 3573, 3470, 3857, 4518, 5267, 6112, 7156, 8419, 9781, 11093, 12298, 13370, 14215, 14802, 15301, 15818, 16076, 15686, 14715, 13626, 12737, 11996, 11224, 10297, 9280, 8545, 8561, 9333, 10293, 10972, 11535, 12442, 13630, 14523, 14756, 14552, 14258, 13877, 13249, 12348, 11269, 10152, 9181, 8425, 7763, 7157, 6766, 6608, 6380, 5911, 5477, 5409, 5564, 5527, 5177, 4799, 4580, 4380, 4038, 3611, 3174, 2624, 1875, 1034, 268, -387, -1000, -1636, -2304, -2914, -3314, -3463, -3528, -3738, -4151, -4623, -5029, -5381, -5742, -6155, -6656, -7249, -7782, -8065, -8123, -8169, -8292, -8408, -8476, -8548, -8646, -8794, -9061, -9476, -9981, -10512, -11019, -11405, -11648, -11883, -12170, -12342, -12286, -12120, -11949, -11708, -11403, -11214, -11173, -11062, -10742, -10375, -10189, -10199, -10230, -10132, -9965, -9931, -10141, -10484, -10755, -10904, -11034, -11203, -11294, -11187, -10912, -10576, -10164, -9587, -8885, -8239, -7755, -7359, -6977, -6648, -6468, -6431, -6448, -6469, -6531, -6667, -6804, -6815, -6651, -6412, -6258, -6212, -6116, -5820, -5399, -5067, -4901, -4778, -4579, -4306, -4028, -3805, -3645, -3489, -3277, -3060, -2919, -2819, -2646, -2438, -2353, -2414, -2465, -2386, -2251, -2175, -2143, -2084, -2005, -1938, -1836, -1670, -1541, -1531, -1539, -1431, -1243, -1103, -1037, -997, -930, -782, -573, -414, -357, -290, -136, 6, 52, 73, 145, 206, 179, 90, -29, -209, -429, -566, -581, -630, -807, -930, -805, -577, -493, -474, -323, -115, -25, 8, 93, 139, 100, 70, 27, -138, -302, -270, -190, -353, -690, -880, -840, -777, -835, -950, -1002, -939, -778, -610, -552, -618, -652, -518, -299, -200, -263, -353, -391, -441, -535, -622, -692, -767, -836, -871, -873, -859, -835, -835, -871, -880, -790, -660, -611, -656, -681, -615, -520, -456, -374, -261, -212, -258, -263, -158, -104, -245, -470, -594, -601, -593, -630, -709, -763, -702, -528, -379, -337, -315, -225, -115, -65, -62, -57, -40, -28, -36, -62, -79, -54, -13, -37, -150, -267, -271, -154, -29, -3, -62, -86, 31, 265, 464, 478, 340, 232, 244, 266, 207, 141, 136, 115, 44, 29, 120, 220, 274, 335, 428, 529, 634, 746, 801, 774, 727, 696, 644, 572, 506, 414, 272, 165, 190, 301, 373, 392, 423, 517, 663, 825, 954, 1034, 1103, 1183, 1244, 1267, 1278, 1291, 1273, 1182, 996, 733, 534, 568, 788, 924, 853, 768, 872, 1128, 1382, 1543, 1568, 1498, 1474, 1549, 1588, 1477, 1308, 1192, 1100, 1001, 984, 1080, 1144, 1042, 891, 920, 1167, 1422, 1510, 1480, 1480, 1580, 1743, 1880, 1902, 1814, 1715, 1680, 1657, 1592, 1505, 1435, 1366, 1291, 1245, 1253, 1308, 1401, 1516, 1619, 1686, 1767, 1918, 2087, 2140, 2043, 1942, 1946, 1979, 1920, 1806, 1758, 1779, 1777, 1730, 1715, 1785, 1889, 1950, 1956, 1962, 2004, 2053, 2049, 1984, 1914, 1901, 1918, 1888, 1783, 1671, 1638, 1684, 1743, 1775, 1788, 1768, 1689, 1631, 1742, 1974, 2066, 1913, 1732, 1711, 1738, 1656, 1516, 1412, 1337, 1285, 1262, 1217, 1148, 1192, 1402, 1589, 1614, 1598, 1697, 1847, 1900, 1825, 1698, 1598, 1553, 1506, 1358, 1127, 958, 955, 1046, 1094, 1066, 1044, 1102, 1239, 1406, 1567, 1717, 1846, 1921, 1922, 1877, 1850, 1851, 1831, 1734, 1576, 1448, 1423, 1466, 1477, 1424, 1399, 1455, 1523, 1559, 1634, 1808, 1984, 2055, 2050, 2049, 2064, 2092, 2137, 2165, 2128, 2053, 2000, 1971, 1946, 1956, 2021, 2095, 2145, 2196, 2276, 2375, 2464, 2518, 2520, 2490, 2475, 2479, 2457, 2392, 2331, 2296, 2278, 2262, 2259, 2270, 2290, 2329, 2402, 2487, 2553, 2585, 2577, 2543, 2506, 2496, 2502, 2479, 2408, 2333, 2291, 2253, 2167, 2060, 1989, 1960, 1941, 1942, 1991, 2079, 2179, 2282, 2358, 2365, 2315, 2288, 2308, 2286, 2140, 1925, 1775, 1721, 1664, 1531, 1373, 1294, 1328, 1414, 1457, 1419, 1368, 1390, 1470, 1507, 1484, 1480, 1518, 1516, 1439, 1344, 1275, 1194, 1059, 893, 749, 660, 627, 606, 560, 501, 475, 505, 564, 618, 654, 673, 687, 697, 701, 667, 568, 430, 322, 272, 224, 110, -50, -159, -177, -155, -150, -138, -72, 29, 124, 189, 207, 169, 131, 157, 186, 106, -45, -119, -83, -53, -92, -161, -213, -238, -220, -155, -90, -70, -84, -88, -62, -12, 48, 95, 102, 70, 58, 98, 133, 99, 42, 41, 82, 108, 127, 174, 233, 289, 364, 453, 515, 550, 604, 668, 683, 633, 576, 559, 568, 559, 506, 434, 394, 419, 490, 571, 652, 750, 850, 918, 963, 1036, 1153, 1245, 1240, 1150, 1058, 1009, 979, 925, 841, 751, 689, 667, 668, 675, 697, 762, 851, 918, 949, 994, 1099, 1223, 1287, 1285, 1270, 1270, 1260, 1227, 1174, 1099, 1007, 916, 828, 735, 675, 675, 689, 666, 637, 663, 733, 805, 868, 909, 901, 876, 888, 918, 912, 888, 904, 929, 895, 808, 733, 680, 613, 517, 415, 340, 287, 240, 181, 122, 93, 114, 160, 193, 199, 199, 218, 255, 281, 285, 276, 261, 227, 156, 65, -26, -134, -281, -439, -569, -669, -748, -802, -836, -872, -890, -858, -804, -772, -736, -674, -647, -699, -761, -768, -772, -839, -950, -1076, -1214, -1346, -1445, -1546, -1690, -1824, -1882, -1872, -1843, -1813, -1776, -1736, -1683, -1610, -1544, -1512, -1500, -1485, -1474, -1478, -1462, -1398, -1317, -1275, -1278, -1291, -1284, -1268, -1266, -1265, -1232, -1168, -1128, -1130, -1125, -1047, -914, -786, -695, -627, -559, -464, -327, -170, -49, 15, 65, 145, 245, 327, 381, 427, 475, 526, 585, 648, 691, 701, 716, 780, 884, 972, 1037, 1131, 1265, 1376, 1422, 1466, 1574, 1697, 1756, 1772, 1802, 1839, 1846, 1840, 1838, 1812, 1773, 1765, 1781, 1780, 1760, 1744, 1727, 1721, 1763, 1831, 1844, 1804, 1796, 1843, 1866, 1817, 1763, 1765, 1784, 1755, 1698, 1659, 1613, 1523, 1430, 1376, 1314, 1210, 1131, 1109, 1071, 980, 921, 933, 930, 862, 788, 760, 754, 739, 713, 651, 554, 465, 415, 361, 253, 111, -8, -97, -188, -287, -360, -395, -431, -486, -536, -556, -564, -589, -649, -736, -829, -904, -976, -1076, -1203, -1321, -1417, -1517, -1635, -1745, -1819, -1863, -1901, -1956, -2023, -2076, -2100, -2115, -2167, -2266, -2376, -2462, -2526, -2605, -2700, -2791, -2860, -2922, -2987, -3047, -3093, -3142, -3206, -3272, -3317, -3341, -3363, -3395, -3431, -3463, -3504, -3570, -3651, -3717, -3758, -3800, -3870, -3958, -4033, -4078, -4101, -4115, -4132, -4149, -4147, -4128, -4128, -4149, -4161, -4151, -4148, -4169, -4189, -4191, -4203, -4243, -4294, -4344, -4393, -4435, -4447, -4419, -4382, -4365, -4355, -4317, -4244, -4164, -4097, -4040, -3995, -3969, -3953, -3917, -3859, -3827, -3846, -3887, -3898, -3875, -3858, -3853, -3841, -3808, -3763, -3708, -3634, -3557, -3497, -3437, -3341, -3211, -3097, -3010, -2915, -2807, -2724, -2679, -2625, -2536, -2458, -2438, -2450, -2436, -2383, -2334, -2317, -2303, -2238, -2117, -1986, -1882, -1791, -1691, -1589, -1503, -1424, -1326, -1217, -1138, -1097, -1050, -962, -869, -821, -807, -780, -730, -692, -678, -668, -632, -578, -519, -452, -373, -288, -207, -117, -7, 114, 212, 273, 319, 373, 424, 446, 432, 407, 395, 403, 424, 443, 451, 464, 502, 568, 646, 721, 787, 850, 925, 1011, 1079, 1104, 1104, 1108, 1108, 1082, 1046, 1030, 1029, 1015, 992, 980, 979, 994, 1033, 1079, 1103, 1115, 1141, 1182, 1210, 1210, 1199, 1192, 1192, 1198, 1195, 1182, 1159, 1136, 1105, 1074, 1057, 1062, 1078, 1094, 1105, 1124, 1154, 1200, 1253, 1287, 1298, 1299, 1291, 1266, 1228, 1195, 1163, 1123, 1088, 1086, 1103, 1108, 1104, 1121, 1169, 1231, 1283, 1318, 1339, 1365, 1401, 1418, 1406, 1387, 1381, 1369, 1331, 1282, 1257, 1256, 1256, 1252, 1267, 1318, 1377, 1416, 1448, 1497, 1565, 1627, 1660, 1673, 1688, 1711, 1726, 1715, 1685, 1665, 1668, 1677, 1671, 1651, 1642, 1659, 1697, 1736, 1772, 1819, 1897, 1999, 2088, 2134, 2147, 2167, 2212, 2248, 2236, 2190, 2151, 2129, 2101, 2055, 2014, 1993, 1980, 1966, 1968, 2001, 2038, 2062, 2089, 2122, 2138, 2141, 2166, 2201, 2201, 2170, 2136, 2093, 2028, 1958, 1906, 1848, 1765, 1690, 1644, 1615, 1597, 1595, 1601, 1590, 1577, 1593, 1631, 1649, 1631, 1598, 1574, 1547, 1490, 1395, 1290, 1204, 1134, 1061, 979, 901, 826, 763, 735, 750, 776, 777, 772, 789, 818, 830, 817, 797, 772, 737, 689, 629, 548, 447, 349, 278, 224, 162, 90, 33, 7, -3, -16, -32, -40, -28, 16, 78, 119, 123, 108, 100, 96, 70, 10, -72, -161, -241, -307, -362, -416, -461, -476, -457, -428, -412, -396, -358, -303, -258, -228, -191, -141, -104, -96, -103, -108, -121, -161, -215, -262, -302, -331, -344, -339, -325, -307, -273, -219, -159, -109, -54, 10, 65, 95, 115, 149, 181, 174, 135, 98, 82, 75, 69, 62, 61, 69, 91, 125, 160, 195, 243, 301, 344, 364, 380, 415, 460, 482, 485, 489, 500, 504, 504, 501, 486, 475, 493, 529, 536, 517, 513, 539, 567, 584, 600, 619, 640, 673, 716, 743, 746, 745, 754, 762, 762, 755, 743, 730, 725, 726, 718, 701, 692, 697, 706, 706, 692, 672, 664, 680, 704, 706, 689, 685, 713, 751, 763, 737, 697, 676, 683, 697, 688, 662, 643, 639, 635, 619, 598, 585, 580, 577, 575, 579, 590, 606, 612, 609, 612, 623, 633, 633, 633, 639, 639, 622, 598, 579, 565, 552, 535, 511, 484, 468, 464, 461, 451, 447, 460, 489, 519, 538, 544, 556, 588, 617, 613, 581, 551, 522, 481, 440, 406, 347, 248, 154, 95, 40, -25, -66, -65, -58, -74, -95, -104, -104, -88, -53, -18, -3, 12, 32, 29, 0, -47, -104, -169, -228, -277, -329, -389, -433, -450, -458, -466, -462, -447, -431, -414, -385, -344, -298, -253, -224, -215, -208, -183, -157, -157, -177, -200, -229, -259, -269, -258, -256, -269, -257, -204, -148, -115, -75, 2, 93, 148, 176, 226, 307, 369, 386, 392, 413, 435, 440, 432, 432, 449, 475, 496, 515, 556, 617, 663, 692, 745, 829, 895, 921, 954, 1017, 1078, 1104, 1124, 1163, 1199, 1196, 1183, 1191, 1196, 1165, 1138, 1170, 1212, 1198, 1166, 1199, 1278, 1324, 1329, 1343, 1372, 1401, 1436, 1481, 1507, 1501, 1481, 1468, 1462, 1453, 1428, 1377, 1318, 1275, 1250, 1225, 1196, 1181, 1175, 1165, 1152, 1148, 1158, 1166, 1163, 1152, 1137, 1119, 1086, 1036, 980, 930, 880, 821, 751, 679, 600, 514, 438, 392, 367, 324, 248, 169, 123, 103, 71, 21, -25, -63, -109, -169, -233, -300, -379, -466, -555, -645, -739, -829, -908, -987, -1074, -1158, -1228, -1291, -1374, -1462, -1524, -1564, -1614, -1681, -1739, -1790, -1859, -1944, -2029, -2112, -2195, -2274, -2353, -2446, -2544, -2619, -2679, -2752, -2832, -2895, -2940, -2984, -3032, -3082, -3132, -3182, -3227, -3268, -3318, -3369, -3414, -3450, -3487, -3537, -3601, -3670, -3723, -3758, -3786, -3816, -3838, -3848, -3865, -3906, -3954, -3985, -3994, -4006, -4031, -4060, -4086, -4111, -4131, -4144, -4155, -4166, -4173, -4159, -4135, -4122, -4120, -4112, -4099, -4093, -4081, -4050, -4010, -3979, -3957, -3939, -3923, -3908, -3892, -3875, -3858, -3840, -3809, -3773, -3736, -3699, -3657, -3608, -3551, -3492, -3447, -3418, -3380, -3312, -3232, -3178, -3155, -3130, -3078, -3013, -2961, -2937, -2911, -2857, -2786, -2736, -2703, -2653, -2582, -2512, -2458, -2400, -2326, -2246, -2164, -2080, -2004, -1948, -1898, -1834, -1757, -1685, -1625, -1575, -1524, -1463, -1400, -1348, -1303, -1250, -1180, -1105, -1031, -952, -871, -792, -719, -660, -618, -576, -501, -403, -321, -265, -207, -146, -104, -68, -11, 60, 102, 116, 149, 219, 302, 360, 386, 413, 468, 547, 618, 658, 684, 716, 751, 780, 803, 824, 854, 896, 940, 971, 991, 1015, 1040, 1049, 1055, 1083, 1117, 1137, 1158, 1208, 1258, 1273, 1269, 1287, 1314, 1315, 1307, 1325, 1362, 1378, 1366, 1362, 1390, 1419, 1419, 1399, 1390, 1398, 1399, 1381, 1352, 1332, 1329, 1331, 1329, 1339, 1378, 1432, 1465, 1466, 1469, 1493, 1518, 1515, 1486, 1457, 1445, 1437, 1419, 1390, 1362, 1349, 1358, 1381, 1397, 1402, 1416, 1444, 1466, 1469, 1472, 1491, 1515, 1520, 1510, 1507, 1522, 1535, 1527, 1498, 1470, 1465, 1480, 1502, 1522, 1534, 1532, 1522, 1520, 1536, 1560, 1585, 1615, 1647, 1668, 1684, 1714, 1756, 1786, 1802, 1812, 1818, 1821, 1821, 1813, 1797, 1798, 1837, 1880, 1896, 1900, 1921, 1946, 1963, 1992, 2039, 2068, 2066, 2062, 2078, 2089, 2093, 2112, 2151, 2176, 2166, 2137, 2121, 2128, 2143, 2158, 2167, 2159, 2133, 2113, 2125, 2161, 2182, 2166, 2133, 2117, 2124, 2128, 2105, 2062, 2024, 2001, 1988, 1977, 1972, 1974, 1975, 1974, 1970, 1959, 1941, 1921, 1904, 1884, 1856, 1823, 1792, 1765, 1747, 1738, 1717, 1673, 1623, 1597, 1589, 1567, 1511, 1449, 1414, 1401, 1378, 1325, 1274, 1264, 1277, 1258, 1206, 1166, 1153, 1127, 1071, 1022, 999, 978, 946, 918, 899, 868, 826, 788, 750, 698, 638, 583, 544, 518, 500, 489, 481, 463, 431, 401, 377, 356, 332, 305, 272, 228, 181, 150, 135, 110, 66, 41, 52, 62, 29, -22, -38, -9, 13, 0, -40, -84, -105, -100, -90, -96, -109, -108, -101, -119, -151, -162, -134, -90, -62, -62, -75, -76, -58, -37, -25, -22, -28, -38, -40, -18, -1, -22, -61, -71, -47, -20, -1, 13, 20, 3, -16, -8, 33, 83, 103, 86, 70, 98, 150, 174, 156, 145, 168, 187, 173, 149, 161, 206, 240, 236, 206, 187, 193, 208, 226, 251, 290, 330, 349, 345, 340, 355, 386, 406, 393, 356, 326, 323, 339, 343, 322, 299, 305, 331, 353, 369, 392, 414, 413, 390, 377, 384, 398, 399, 372, 320, 284, 297, 336, 340, 301, 266, 268, 280, 266, 235, 219, 236, 260, 262, 241, 222, 224, 239, 243, 220, 190, 172, 168, 158, 137, 112, 96, 87, 78, 65, 50, 33, 17, 11, 16, 19, 7, -8, -14, -12, -18, -38, -55, -58, -66, -91, -105, -83, -51, -41, -32, -8, -9, -51, -83, -74, -70, -105, -141, -151, -162, -186, -190, -154, -117, -115, -134, -149, -150, -145, -130, -113, -112, -132, -148, -140, -133, -151, -186, -212, -225, -219, -195, -180, -200, -236, -238, -207, -191, -216, -248, -250, -242, -261, -295, -311, -306, -303, -310, -325, -356, -393, -414, -419, -437, -470, -487, -481, -476, -482, -490, -491, -494, -502, -511, -519, -528, -537, -549, -560, -572, -585, -605, -630, -653, -672, -685, -699, -715, -724, -724, -723, -736, -764, -780, -759, -722, -709, -731, -759, -763, -750, -748, -772, -806, -822, -810, -796, -810, -843, -860, -852, -842, -840, -839, -829, -802, -768, -748, -757, -768, -751, -724, -722, -732, -731, -734, -756, -777, -767, -747, -756, -785, -797, -784, -765, -760, -764, -780, -806, -821, -797, -760, -752, -775, -785, -767, -744, -736, -732, -723, -719, -727, -736, -735, -726, -722, -730, -742, -747, -740, -726, -714, -715, -724, -731, -735, -744, -752, -748, -740, -736, -731, -726, -730, -743, -753, -760, -767, -763, -744, -739, -759, -771, -748, -717, -706, -709, -709, -707, -711, -711, -714, -722, -727, -721, -713, -718, -728, -734, -743, -765, -788, -790, -773, -759, -759, -772, -786, -796, -797, -789, -781, -785, -796, -798, -794, -797, -805, -796, -769, -753, -765, -778, -768, -746, -746, -764, -773, -771, -775, -785, -782, -764, -765, -797, -830, -842, -839, -836, -825, -815, -830, -855, -856, -839, -836, -846, -843, -835, -844, -858, -856, -860, -876, -879, -873, -888, -910, -901, -871, -858, -861, -851, -822, -792, -771, -756, -752, -748, -739, -730, -735, -744, -739, -723, -715, -717, -721, -727, -738, -735, -706, -664, -641, -628, -593, -549, -537, -539, -511, -474, -464, -454, -422, -424, -493, -543, -503, -436, -425, -450, -443, -408, -394, -396, -381, -339, -304, -300, -308, -295, -258, -220, -199, -190, -182, -169, -153, -133, -104, -74, -58, -58, -50, -16, 20, 31, 17, 12, 31, 65, 104, 144, 174, 195, 215, 243, 273, 307, 348, 388, 398, 365, 332, 345, 389, 405, 390, 393, 430, 472, 497, 517, 546, 586, 635, 677, 696, 693, 691, 701, 713, 718, 726, 738, 741, 731, 730, 755, 785, 793, 787, 789, 801, 808, 813, 830, 842, 833, 824, 838, 863, 857, 822, 812, 837, 847, 808, 764, 772, 814, 829, 806, 791, 806, 824, 816, 803, 812, 831, 826, 799, 783, 795, 803, 784, 754, 742, 751, 771, 787, 788, 772, 758, 760, 760, 737, 714, 726, 755, 758, 729, 710, 722, 745, 749, 730, 702, 692, 710, 745, 754, 709, 648, 627, 644, 648, 622, 601, 614, 642, 654, 642, 613, 584, 576, 586, 583, 548, 501, 467, 457, 461, 463, 456, 449, 453, 459, 456, 444, 432, 417, 401, 410, 452, 488, 482, 451, 436, 444, 434, 389, 344, 328, 322, 306, 295, 299, 299, 293, 302, 315, 305, 274, 264, 274, 280, 272, 264, 249, 231, 233, 264, 291, 295, 290, 294, 302, 303, 309, 324, 338, 332, 323, 319, 313, 297, 297, 331, 372, 393, 402, 413, 410, 386, 361, 351, 340, 320, 306, 298, 285, 262, 244, 247, 274, 309, 328, 332, 331, 331, 322, 309, 309, 311, 290, 245, 219, 231, 257, 268, 255, 226, 195, 181, 185, 193, 199, 215, 228, 231, 233, 244, 243, 222, 216, 236, 237, 195, 152, 152, 164, 137, 87, 69, 94, 112, 90, 52, 37, 46, 57, 56, 33, -1, -21, -13, -1, 0, 7, 20, 7, -30, -49, -41, -34, -37, -45, -79, -124, -123, -72, -47, -84, -123, -121, -108, -112, -121, -132, -149, -162, -165, -166, -165, -144, -115, -113, -144, -159, -137, -96, -72, -70, -78, -86, -82, -58, -21, 6, 12, 7, 4, 10, 28, 57, 73, 54, 27, 27, 44, 41, 28, 24, 20, -3, -25, -18, 6, 27, 45, 62, 67, 61, 60, 73, 79, 65, 39, 25, 33, 41, 33, 15, 7, 15, 25, 27, 17, 3, -11, -21, -24, -14, 2, 12, 0, -24, -40, -40, -53, -104, -161, -175, -150, -141, -175, -221, -241, -233, -217, -190, -145, -92, -58, -53, -62, -71, -68, -57, -58, -95, -165, -223, -241, -244, -275, -329, -348, -300, -223, -155, -104, -58, -18, 16, 69, 137, 187, 195, 166, 124, 116, 176, 264, 293, 247, 193, 168, 154, 144, 143, 125, 82, 66, 110, 164, 189, 220, 281, 327, 332, 332, 351, 384, 421, 443, 426, 382, 363, 365, 347, 319, 336, 390, 418, 409, 403, 414, 415, 402, 398, 409, 411, 398, 385, 377, 356, 306, 245, 201, 177, 165, 150, 116, 62, 13, -7, -13, -34, -78, -125, -158, -169, -166, -182, -221, -242, -216, -182, -186, -207, -202, -178, -179, -212, -254, -290, -320, -348, -370, -390, -407, -422, -437, -464, -499, -528, -537, -533, -522, -493, -450, -418, -396, -369, -340, -331, -319, -274, -232, -254, -317, -335, -292, -253, -245, -240, -211, -173, -142, -111, -72, -33, 2, 31, 37, 10, -33, -57, -59, -67, -76, -63, -33, -17, -9, 29, 87, 100, 42, -38, -88, -119, -173, -256, -307, -283, -220, -183, -180, -191, -233, -337, -462, -540, -569, -587, -584, -540, -491, -456, -389, -277, -187, -153, -104, 16, 165, 265, 313, 355, 410, 464, 511, 554, 575, 573, 594, 671, 763, 806, 812, 834, 880, 891, 847, 810, 838, 904, 946, 943, 912, 878, 870, 908, 957, 954, 911, 901, 953, 1000, 997, 983, 999, 1016, 999, 988, 1026, 1063, 1024, 933, 864, 803, 693, 573, 515, 486, 415, 307, 206, 112, 21, -33, -57, -108, -219, -349, -457, -551, -659, -784, -892, -951, -973, -1006, -1075, -1159, -1230, -1280, -1313, -1332, -1346, -1362, -1357, -1328, -1319, -1353, -1386, -1379, -1367, -1391, -1424, -1432, -1432, -1423, -1374, -1300, -1267, -1283, -1272, -1187, -1081, -1031, -1043, -1076, -1112, -1134, -1110, -1037, -977, -1000, -1070, -1099, -1062, -1017, -998, -967, -898, -840, -827, -811, -753, -688, -651, -593, -478, -345, -225, -109, -8, 40, 66, 127, 204, 248, 280, 349, 431, 477, 514, 586, 671, 708, 705, 721, 772, 810, 820, 834, 858, 849, 813, 797, 808, 804, 795, 814, 849, 849, 824, 817, 822, 804, 767, 746, 738, 706, 635, 555, 486, 405, 284, 150, 50, -16, -88, -177, -233, -224, -173, -125, -88, -40, 23, 65, 83, 127, 216, 293, 286, 207, 116, 49, 7, 0, 27, 54, 40, 8, 20, 95, 189, 265, 340, 440, 547, 629, 685, 738, 777, 764, 709, 676, 693, 714, 698, 664, 644, 618, 568, 529, 543, 602, 656, 664, 625, 568, 521, 496, 481, 465, 424, 343, 235, 149, 116, 108, 71, 0, -63, -105, -159, -232, -271, -253, -253, -340, -469, -539, -547, -577, -660, -736, -775, -821, -918, -1017, -1049, -1022, -1014, -1056, -1124, -1193, -1254, -1287, -1274, -1224, -1178, -1174, -1212, -1241, -1214, -1157, -1128, -1135, -1126, -1074, -1012, -967, -919, -856, -800, -756, -686, -581, -522, -577, -690, -756, -776, -814, -858, -838, -771, -739, -753, -739, -655, -541, -454, -390, -328, -282, -270, -274, -266, -266, -312, -404, -501, -565, -603, -655, -739, -823, -851, -829, -813, -822, -809, -739, -652, -594, -555, -512, -486, -508, -559, -597, -632, -701, -784, -822, -825, -864, -954, -1009, -975, -912, -890, -880, -819, -744, -726, -732, -685, -609, -589, -624, -660, -705, -797, -893, -933, -927, -921, -902, -844, -767, -710, -676, -631, -560, -487, -450, -456, -465, -452, -436, -457, -515, -578, -622, -640, -640, -636, -630, -602, -547, -494, -462, -422, -352, -288, -246, -204, -161, -161, -199, -213, -207, -244, -329, -378, -342, -270, -215, -173, -112, -36, 39, 124, 251, 414, 550, 610, 626, 658, 696, 693, 654, 615, 559, 444, 323, 284, 326, 382, 432, 493, 551, 590, 635, 709, 785, 813, 796, 767, 729, 668, 612, 604, 625, 608, 535, 455, 407, 398, 448, 572, 722, 814, 843, 885, 984, 1084, 1111, 1071, 1030, 1022, 1033, 1046, 1069, 1096, 1103, 1090, 1094, 1127, 1153, 1153, 1153, 1171, 1188, 1188, 1206, 1257, 1299, 1287, 1256, 1282, 1358, 1403, 1381, 1344, 1335, 1331, 1312, 1304, 1308, 1296, 1271, 1274, 1302, 1319, 1339, 1394, 1468, 1519, 1545, 1568, 1581, 1572, 1556, 1557, 1570, 1572, 1561, 1549, 1526, 1482, 1435, 1401, 1344, 1242, 1153, 1134, 1150, 1132, 1094, 1096, 1150, 1224, 1291, 1320, 1307, 1315, 1382, 1456, 1470, 1452, 1431, 1374, 1279, 1225, 1240, 1249, 1210, 1185, 1228, 1286, 1286, 1237, 1208, 1232, 1275, 1298, 1302, 1312, 1314, 1253, 1125, 988, 880, 796, 733, 709, 702, 666, 619, 634, 721, 812, 870, 922, 988, 1037, 1050, 1061, 1092, 1104, 1053, 961, 884, 841, 813, 791, 762, 717, 675, 688, 762, 825, 825, 812, 846, 867, 776, 619, 538, 531, 472, 344, 257, 218, 137, 39, 25, 75, 60, -62, -205, -299, -337, -348, -368, -444, -602, -813, -1014, -1166, -1274, -1378, -1525, -1724, -1930, -2073, -2138, -2177, -2247, -2339, -2425, -2499, -2557, -2575, -2554, -2554, -2636, -2764, -2852, -2902, -2981, -3084, -3119, -3084, -3088, -3176, -3240, -3196, -3109, -3077, -3090, -3070, -2998, -2920, -2865, -2828, -2799, -2777, -2744, -2677, -2582, -2492, -2420, -2346, -2260, -2158, -2029, -1873, -1719, -1598, -1494, -1369, -1213, -1058, -926, -809, -693, -574, -450, -316, -199, -107, 8, 191, 390, 519, 596, 726, 941, 1133, 1220, 1266, 1368, 1486, 1553, 1619, 1755, 1908, 1996, 2053, 2143, 2251, 2342, 2446, 2583, 2701, 2763, 2805, 2857, 2906, 2934, 2973, 3042, 3097, 3094, 3063, 3069, 3125, 3175, 3181, 3163, 3159, 3205, 3308, 3419, 3474, 3457, 3413, 3392, 3413, 3479, 3550, 3561, 3487, 3386, 3308, 3260, 3216, 3155, 3066, 2954, 2860, 2807, 2764, 2697, 2628, 2585, 2557, 2520, 2485, 2461, 2429, 2373, 2312, 2273, 2242, 2182, 2074, 1951, 1846, 1765, 1704, 1648, 1574, 1444, 1264, 1090, 972, 891, 792, 673, 560, 452, 334, 227, 162, 106, -7, -174, -331, -435, -491, -531, -582, -677, -818, -968, -1083, -1155, -1217, -1292, -1380, -1491, -1632, -1770, -1853, -1881, -1909, -1980, -2083, -2192, -2313, -2438, -2516, -2529, -2562, -2687, -2858, -2978, -3044, -3105, -3159, -3180, -3209, -3297, -3418, -3488, -3479, -3449, -3464, -3543, -3640, -3703, -3725, -3748, -3796, -3856, -3895, -3910, -3921, -3942, -3964, -4003, -4089, -4184, -4215, -4177, -4136, -4112, -4074, -4044, -4081, -4170, -4203, -4140, -4072, -4074, -4108, -4093, -4036, -4015, -4044, -4053, -4010, -3969, -3981, -4012, -4007, -3974, -3945, -3902, -3812, -3736, -3736, -3757, -3670, -3466, -3269, -3182, -3189, -3222, -3231, -3192, -3097, -2976, -2887, -2882, -2926, -2920, -2811, -2659, -2566, -2534, -2484, -2384, -2284, -2213, -2147, -2079, -2036, -2030, -2015, -1961, -1881, -1815, -1786, -1782, -1765, -1727, -1689, -1648, -1579, -1488, -1421, -1399, -1382, -1334, -1270, -1205, -1153, -1128, -1139, -1164, -1174, -1164, -1134, -1079, -1031, -1039, -1083, -1079, -980, -832, -728, -718, -797, -909, -973, -934, -822, -752, -815, -985, -1125, -1130, -1022, -910, -877, -910, -946, -933, -861, -751, -641, -590, -622, -682, -701, -682, -694, -739, -757, -730, -714, -727, -699, -591, -472, -420, -396, -304, -153, -32, 29, 79, 122, 111, 70, 77, 143, 189, 169, 128, 116, 122, 137, 212, 368, 534, 629, 671, 725, 808, 903, 1021, 1165, 1287, 1340, 1348, 1383, 1485, 1610, 1671, 1636, 1597, 1657, 1800, 1909, 1942, 1967, 2059, 2216, 2374, 2473, 2498, 2511, 2578, 2669, 2724, 2764, 2832, 2894, 2907, 2935, 3047, 3176, 3226, 3246, 3349, 3517, 3621, 3613, 3575, 3571, 3565, 3537, 3538, 3592, 3613, 3534, 3422, 3380, 3379, 3330, 3266, 3289, 3383, 3409, 3345, 3333, 3429, 3491, 3424, 3345, 3384, 3471, 3450, 3329, 3250, 3259, 3251, 3149, 3015, 2954, 2972, 3012, 3031, 3019, 2969, 2903, 2859, 2834, 2772, 2657, 2552, 2490, 2394, 2195, 1958, 1805, 1740, 1681, 1598, 1523, 1473, 1443, 1444, 1487, 1543, 1557, 1511, 1435, 1382, 1385, 1403, 1361, 1236, 1071, 936, 858, 824, 777, 660, 480, 323, 253, 257, 307, 414, 567, 664, 627, 548, 608, 813, 958, 901, 755, 705, 777, 864, 901, 903, 892, 884, 905, 959, 990, 932, 801, 672, 580, 513, 460, 411, 327, 193, 67, 0, -34, -63, -30, 104, 274, 372, 411, 496, 633, 717, 700, 647, 594, 517, 444, 426, 392, 235, 29, -43, 21, 65, 40, 81, 269, 476, 544, 494, 464, 517, 608, 689, 716, 621, 403, 194, 132, 207, 290, 299, 258, 239, 298, 464, 704, 908, 976, 947, 928, 936, 908, 843, 791, 731, 583, 351, 150, 78, 128, 236, 327, 335, 258, 203, 282, 451, 522, 384, 112, -178, -461, -719, -929, -1129, -1384, -1674, -1914, -2075, -2154, -2129, -2015, -1913, -1868, -1822, -1727, -1639, -1633, -1706, -1797, -1869, -1927, -1993, -2097, -2242, -2382, -2440, -2378, -2250, -2137, -2050, -1921, -1706, -1452, -1222, -1008, -775, -564, -404, -242, -41, 128, 215, 303, 453, 614, 758, 965, 1260, 1536, 1725, 1912, 2197, 2564, 2921, 3229, 3488, 3671, 3787, 3928, 4186, 4517, 4787, 4950, 5060, 5161, 5276, 5458, 5745, 6090, 6390, 6584, 6693, 6797, 6976, 7237, 7495, 7644, 7668, 7660, 7715, 7844, 7984, 8082, 8118, 8103, 8064, 8068, 8138, 8228, 8282, 8282, 8225, 8121, 8024, 7988, 7991, 7931, 7758, 7531, 7337, 7192, 7061, 6943, 6846, 6726, 6559, 6401, 6310, 6249, 6165, 6066, 5959, 5788, 5545, 5318, 5163, 4997, 4728, 4395, 4097, 3848, 3578, 3259, 2947, 2682, 2439, 2179, 1917, 1675, 1437, 1191, 946, 705, 431, 91, -277, -614, -913, -1226, -1582, -1973, -2383, -2783, -3115, -3359, -3567, -3809, -4083, -4324, -4504, -4649, -4804, -4986, -5206, -5467, -5754, -6024, -6250, -6450, -6663, -6902, -7153, -7387, -7581, -7719, -7811, -7874, -7935, -7993, -8060, -8155, -8280, -8405, -8484, -8533, -8629, -8832, -9073, -9244, -9333, -9429, -9567, -9695, -9771, -9819, -9849, -9837, -9788, -9751, -9766, -9802, -9817, -9796, -9742, -9672, -9629, -9666, -9794, -9925, -9941, -9816, -9655, -9576, -9591, -9608, -9550, -9398, -9189, -8970, -8810, -8741, -8704, -8613, -8459, -8310, -8226, -8197, -8176, -8134, -8061, -7963, -7849, -7739, -7620, -7474, -7299, -7104, -6885, -6647, -6445, -6324, -6245, -6115, -5924, -5741, -5621, -5564, -5526, -5457, -5323, -5127, -4908, -4708, -4530, -4363, -4215, -4082, -3931, -3724, -3501, -3339, -3261, -3209, -3128, -3022, -2916, -2807, -2690, -2600, -2561, -2516, -2396, -2229, -2110, -2071, -2048, -1996, -1934, -1885, -1830, -1753, -1689, -1682, -1726, -1768, -1760, -1685, -1570, -1473, -1444, -1452, -1400, -1247, -1075, -981, -975, -980, -956, -918, -884, -854, -836, -842, -839, -805, -778, -789, -761, -627, -462, -368, -310, -224, -140, -87, -1, 143, 252, 233, 140, 74, 70, 99, 132, 161, 181, 195, 218, 265, 340, 449, 590, 712, 737, 669, 618, 668, 764, 791, 717, 617, 555, 535, 554, 619, 710, 771, 805, 860, 940, 1013, 1108, 1246, 1348, 1343, 1311, 1362, 1462, 1526, 1556, 1586, 1588, 1559, 1584, 1697, 1813, 1854, 1872, 1954, 2080, 2180, 2258, 2367, 2493, 2573, 2614, 2664, 2718, 2744, 2784, 2900, 3054, 3159, 3229, 3365, 3577, 3761, 3852, 3923, 4032, 4138, 4200, 4266, 4363, 4442, 4488, 4554, 4624, 4619, 4565, 4584, 4702, 4800, 4816, 4835, 4920, 4982, 4956, 4970, 5132, 5288, 5224, 5008, 4893, 4958, 5072, 5130, 5143, 5143, 5136, 5161, 5248, 5363, 5422, 5402, 5351, 5306, 5256, 5176, 5087, 5020, 4956, 4853, 4720, 4597, 4513, 4462, 4424, 4397, 4392, 4391, 4360, 4304, 4273, 4309, 4376, 4421, 4413, 4331, 4169, 3998, 3927, 3961, 3980, 3868, 3644, 3425, 3307, 3304, 3346, 3320, 3170, 2936, 2715, 2553, 2433, 2327, 2236, 2171, 2105, 1992, 1850, 1764, 1768, 1767, 1640, 1418, 1235, 1177, 1194, 1191, 1111, 954, 787, 696, 713, 770, 768, 680, 556, 456, 405, 399, 431, 473, 478, 417, 305, 199, 168, 237, 343, 370, 298, 215, 198, 245, 351, 509, 637, 623, 498, 428, 504, 648, 754, 800, 806, 749, 610, 464, 402, 414, 411, 357, 280, 210, 169, 158, 139, 67, 7, 49, 169, 281, 368, 424, 402, 339, 401, 643, 882, 955, 949, 1009, 1113, 1131, 1041, 929, 845, 758, 651, 539, 422, 282, 161, 150, 258, 364, 364, 322, 360, 468, 536, 552, 594, 671, 710, 716, 755, 822, 847, 812, 764, 710, 618, 517, 476, 484, 438, 302, 152, 17, -141, -294, -329, -286, -345, -539, -703, -756, -790, -856, -877, -827, -806, -913, -1135, -1407, -1649, -1818, -1909, -1963, -2035, -2171, -2364, -2542, -2632, -2640, -2634, -2637, -2636, -2644, -2679, -2695, -2650, -2586, -2550, -2512, -2436, -2376, -2396, -2445, -2430, -2371, -2364, -2413, -2412, -2312, -2179, -2047, -1864, -1629, -1425, -1263, -1070, -839, -673, -595, -497, -316, -162, -124, -91, 91, 374, 583, 691, 821, 1033, 1266, 1494, 1751, 2017, 2213, 2341, 2495, 2702, 2878, 2972, 3059, 3228, 3444, 3624, 3758, 3877, 3998, 4154, 4385, 4649, 4837, 4919, 4989, 5116, 5256, 5340, 5389, 5473, 5604, 5729, 5819, 5884, 5949, 6015, 6111, 6243, 6356, 6403, 6415, 6461, 6538, 6573, 6536, 6478, 6446, 6405, 6307, 6173, 6058, 5974, 5903, 5846, 5821, 5805, 5757, 5670, 5583, 5512, 5430, 5311, 5163, 5012, 4866, 4709, 4518, 4289, 4051, 3848, 3689, 3523, 3308, 3064, 2832, 2626, 2435, 2257, 2088, 1887, 1613, 1296, 1020, 810, 601, 334, 36, -223, -437, -656, -896, -1124, -1336, -1583, -1893, -2200, -2421, -2567, -2725, -2948, -3207, -3462, -3703, -3920, -4091, -4253, -4480, -4757, -4970, -5082, -5196, -5395, -5623, -5769, -5830, -5895, -6017, -6173, -6311, -6415, -6495, -6573, -6689, -6848, -6996, -7074, -7113, -7188, -7325, -7488, -7639, -7752, -7831, -7894, -7967, -8040, -8094, -8138, -8179, -8216, -8239, -8270, -8320, -8378, -8429, -8462, -8466, -8454, -8463, -8512, -8562, -8575, -8548, -8482, -8379, -8274, -8209, -8181, -8138, -8046, -7923, -7790, -7674, -7604, -7587, -7582, -7553, -7507, -7461, -7396, -7292, -7174, -7093, -7037, -6935, -6753, -6532, -6321, -6153, -6046, -5968, -5837, -5621, -5420, -5335, -5327, -5312, -5257, -5170, -5045, -4887, -4714, -4543, -4380, -4243, -4127, -3983, -3796, -3621, -3512, -3437, -3335, -3211, -3128, -3113, -3123, -3098, -3011, -2881, -2739, -2624, -2562, -2541, -2497, -2378, -2204, -2059, -1992, -1975, -1950, -1919, -1930, -1984, -2009, -1947, -1840, -1785, -1809, -1844, -1806, -1668, -1473, -1316, -1268, -1307, -1338, -1296, -1199, -1106, -1075, -1128, -1242, -1353, -1382, -1299, -1153, -1041, -1041, -1129, -1195, -1130, -918, -635, -400, -335, -457, -644, -711, -597, -416, -340, -444, -659, -819, -793, -609, -419, -321, -271, -179, -20, 170, 367, 547, 663, 691, 692, 741, 820, 860, 874, 922, 1001, 1044, 1053, 1111, 1261, 1456, 1648, 1822, 1938, 1951, 1913, 1964, 2133, 2267, 2246, 2140, 2072, 2055, 2042, 2055, 2116, 2170, 2168, 2151, 2188, 2275, 2359, 2420, 2464, 2486, 2496, 2558, 2673, 2732, 2678, 2632, 2716, 2855, 2915, 2927, 3004, 3121, 3184, 3213, 3322, 3504, 3623, 3610, 3561, 3557, 3565, 3565, 3612, 3703, 3736, 3679, 3636, 3683, 3794, 3923, 4065, 4181, 4202, 4139, 4094, 4150, 4250, 4271, 4155, 3969, 3822, 3766, 3786, 3826, 3836, 3808, 3769, 3747, 3744, 3758, 3818, 3927, 3990, 3894, 3689, 3537, 3483, 3446, 3401, 3380, 3325, 3162, 2997, 2998, 3137, 3231, 3203, 3117, 3046, 3006, 3004, 3014, 2984, 2880, 2745, 2643, 2576, 2510, 2461, 2458, 2458, 2394, 2291, 2234, 2249, 2298, 2359, 2419, 2412, 2307, 2178, 2125, 2134, 2109, 2024, 1937, 1883, 1834, 1784, 1786, 1856, 1906, 1867, 1796, 1797, 1856, 1869, 1798, 1702, 1592, 1418, 1211, 1090, 1071, 1040, 928, 780, 637, 539, 563, 710, 822, 775, 647, 584, 580, 534, 426, 314, 227, 139, 45, -25, -74, -128, -166, -134, -33, 62, 112, 172, 286, 384, 365, 256, 178, 186, 223, 231, 197, 107, -32, -132, -104, 21, 133, 189, 244, 324, 382, 392, 407, 472, 531, 506, 410, 324, 289, 281, 280, 303, 341, 352, 336, 364, 488, 648, 741, 726, 659, 608, 604, 637, 673, 662, 567, 399, 223, 133, 187, 344, 489, 526, 460, 390, 436, 650, 942, 1109, 1009, 730, 532, 576, 727, 755, 617, 465, 406, 418, 467, 544, 608, 601, 542, 502, 515, 556, 581, 543, 407, 206, 25, -74, -140, -233, -315, -329, -348, -437, -499, -436, -350, -354, -354, -253, -173, -245, -375, -429, -462, -562, -639, -565, -416, -366, -425, -423, -283, -125, -53, -1, 125, 286, 377, 398, 413, 410, 353, 297, 332, 414, 426, 390, 446, 614, 775, 847, 860, 863, 893, 1003, 1159, 1207, 1008, 643, 328, 150, 0, -199, -370, -456, -540, -695, -819, -765, -561, -377, -310, -308, -267, -161, -50, -28, -133, -314, -454, -472, -391, -327, -378, -549, -761, -892, -855, -672, -454, -312, -294, -369, -436, -377, -195, -32, 8, -21, -21, 17, 52, 87, 186, 378, 648, 970, 1294, 1532, 1661, 1804, 2068, 2342, 2456, 2465, 2527, 2603, 2594, 2573, 2639, 2693, 2656, 2677, 2897, 3191, 3370, 3450, 3549, 3679, 3795, 3922, 4105, 4283, 4347, 4296, 4246, 4264, 4327, 4416, 4532, 4633, 4680, 4725, 4852, 5031, 5144, 5135, 5073, 5065, 5139, 5231, 5236, 5069, 4750, 4437, 4259, 4158, 4009, 3857, 3822, 3836, 3736, 3559, 3492, 3575, 3673, 3686, 3615, 3465, 3253, 3060, 2956, 2885, 2736, 2496, 2263, 2107, 1996, 1887, 1765, 1611, 1404, 1185, 1019, 885, 708, 465, 202, -68, -375, -710, -1017, -1282, -1540, -1805, -2036, -2226, -2407, -2574, -2675, -2720, -2806, -2964, -3111, -3197, -3290, -3449, -3614, -3725, -3849, -4074, -4348, -4544, -4655, -4786, -4963, -5110, -5200, -5298, -5409, -5478, -5506, -5564, -5681, -5814, -5935, -6076, -6228, -6320, -6333, -6361, -6458, -6547, -6544, -6489, -6452, -6445, -6472, -6543, -6627, -6648, -6619, -6632, -6748, -6919, -7056, -7099, -7052, -7018, -7088, -7245, -7394, -7470, -7458, -7365, -7274, -7304, -7436, -7524, -7498, -7427, -7361, -7295, -7272, -7346, -7425, -7346, -7103, -6854, -6722, -6685, -6648, -6549, -6412, -6291, -6198, -6101, -6026, -6024, -6061, -6042, -5950, -5864, -5798, -5714, -5635, -5606, -5559, -5390, -5149, -4979, -4932, -4936, -4912, -4837, -4725, -4612, -4539, -4498, -4442, -4346, -4231, -4115, -3974, -3784, -3570, -3400, -3306, -3247, -3171, -3069, -2959, -2833, -2702, -2631, -2657, -2706, -2674, -2579, -2494, -2403, -2280, -2184, -2160, -2133, -2014, -1841, -1693, -1578, -1491, -1459, -1483, -1492, -1429, -1324, -1254, -1247, -1251, -1189, -1033, -834, -670, -574, -505, -399, -249, -101, 3, 62, 79, 56, 17, 11, 53, 124, 208, 307, 427, 556, 694, 854, 1026, 1185, 1328, 1486, 1661, 1783, 1785, 1694, 1618, 1624, 1689, 1747, 1777, 1804, 1871, 2012, 2230, 2471, 2655, 2765, 2876, 3038, 3203, 3280, 3260, 3214, 3192, 3181, 3167, 3163, 3145, 3091, 3069, 3183, 3388, 3544, 3617, 3703, 3840, 3978, 4094, 4202, 4254, 4177, 4003, 3837, 3743, 3698, 3670, 3645, 3620, 3598, 3621, 3744, 3947, 4140, 4266, 4342, 4399, 4413, 4359, 4273, 4208, 4142, 4002, 3778, 3562, 3436, 3394, 3376, 3365, 3387, 3457, 3542, 3604, 3633, 3648, 3658, 3665, 3633, 3513, 3287, 3013, 2806, 2734, 2755, 2760, 2668, 2514, 2439, 2545, 2774, 2959, 3009, 2975, 2944, 2931, 2898, 2848, 2794, 2698, 2519, 2298, 2133, 2051, 2013, 2013, 2085, 2204, 2295, 2346, 2432, 2594, 2767, 2839, 2798, 2724, 2701, 2724, 2736, 2691, 2615, 2587, 2649, 2761, 2859, 2947, 3059, 3168, 3245, 3334, 3471, 3600, 3646, 3620, 3570, 3502, 3401, 3289, 3196, 3137, 3120, 3131, 3152, 3196, 3305, 3463, 3571, 3563, 3504, 3509, 3571, 3570, 3438, 3257, 3139, 3098, 3072, 3019, 2947, 2878, 2843, 2855, 2889, 2907, 2903, 2892, 2876, 2856, 2821, 2740, 2601, 2441, 2311, 2203, 2066, 1885, 1701, 1549, 1439, 1373, 1350, 1350, 1337, 1296, 1242, 1174, 1065, 911, 762, 658, 567, 432, 257, 99, -7, -84, -190, -321, -418, -436, -428, -474, -574, -644, -657, -706, -859, -1045, -1132, -1133, -1191, -1367, -1545, -1604, -1586, -1610, -1708, -1799, -1795, -1703, -1624, -1658, -1780, -1870, -1865, -1823, -1828, -1893, -1959, -1976, -1938, -1888, -1882, -1921, -1946, -1926, -1898, -1902, -1928, -1932, -1905, -1870, -1852, -1843, -1828, -1816, -1835, -1884, -1919, -1913, -1905, -1931, -1942, -1868, -1748, -1702, -1755, -1780, -1672, -1507, -1469, -1608, -1744, -1683, -1463, -1301, -1292, -1319, -1263, -1154, -1055, -960, -880, -908, -1085, -1271, -1279, -1124, -1012, -1081, -1247, -1342, -1315, -1234, -1170, -1121, -1045, -912, -765, -698, -727, -768, -757, -727, -748, -856, -1025, -1150, -1133, -1026, -1002, -1100, -1155, -1071, -979, -1022, -1129, -1130, -1021, -962, -1084, -1324, -1492, -1481, -1379, -1334, -1348, -1341, -1330, -1361, -1362, -1258, -1110, -1034, -1035, -1092, -1189, -1246, -1199, -1149, -1200, -1243, -1149, -1026, -1030, -1067, -980, -815, -709, -678, -669, -636, -536, -375, -299, -431, -659, -744, -655, -610, -760, -950, -927, -694, -466, -393, -418, -414, -300, -107, 29, 3, -108, -151, -108, -51, 20, 137, 233, 265, 328, 519, 793, 1044, 1190, 1166, 975, 750, 609, 531, 460, 434, 492, 571, 612, 688, 913, 1274, 1647, 1909, 1984, 1821, 1432, 938, 465, 21, -433, -852, -1162, -1382, -1520, -1465, -1172, -851, -738, -817, -877, -780, -589, -490, -619, -892, -1050, -958, -746, -594, -507, -386, -213, -61, 32, 77, 87, 57, -18, -137, -281, -383, -350, -184, -36, -21, -67, -63, -22, 11, 71, 143, 165, 216, 468, 868, 1190, 1398, 1688, 2107, 2446, 2583, 2649, 2755, 2785, 2666, 2604, 2764, 2947, 2923, 2846, 2954, 3141, 3191, 3164, 3205, 3263, 3283, 3326, 3363, 3241, 2996, 2849, 2886, 2950, 2922, 2864, 2868, 2940, 3079, 3301, 3565, 3750, 3830, 3913, 4051, 4131, 4068, 3943, 3847, 3724, 3490, 3189, 2921, 2687, 2456, 2265, 2175, 2129, 2037, 1938, 1929, 1950, 1852, 1639, 1439, 1285, 1128, 974, 849, 720, 581, 517, 547, 564, 515, 498, 604, 741, 755, 658, 596, 610, 581, 402, 115, -196, -518, -846, -1143, -1400, -1668, -1967, -2221, -2335, -2324, -2281, -2264, -2263, -2279, -2324, -2374, -2392, -2375, -2353, -2342, -2351, -2378, -2396, -2366, -2284, -2191, -2122, -2079, -2046, -2004, -1930, -1827, -1744, -1739, -1791, -1818, -1805, -1853, -2019, -2230, -2400, -2546, -2694, -2811, -2883, -2952, -3028, -3072, -3056, -2990, -2894, -2808, -2771, -2761, -2720, -2670, -2688, -2777, -2854, -2878, -2898, -2959, -3039, -3110, -3178, -3260, -3339, -3391, -3437, -3524, -3667, -3827, -3969, -4118, -4305, -4506, -4666, -4792, -4921, -5034, -5078, -5052, -5017, -5003, -4984, -4932, -4846, -4749, -4662, -4595, -4543, -4500, -4469, -4440, -4392, -4326, -4286, -4282, -4253, -4149, -4023, -3965, -3973, -3958, -3906, -3899, -3977, -4047, -4041, -4019, -4052, -4095, -4072, -3999, -3939, -3895, -3821, -3705, -3586, -3492, -3414, -3337, -3259, -3178, -3072, -2927, -2779, -2679, -2631, -2598, -2548, -2491, -2445, -2416, -2392, -2378, -2374, -2368, -2333, -2274, -2229, -2218, -2233, -2259, -2293, -2313, -2293, -2241, -2160, -2035, -1873, -1739, -1654, -1560, -1402, -1220, -1075, -972, -890, -793, -638, -424, -219, -57, 85, 193, 240, 280, 384, 494, 509, 468, 472, 502, 504, 538, 673, 810, 793, 662, 605, 681, 764, 780, 816, 930, 1024, 1016, 1017, 1174, 1418, 1559, 1581, 1653, 1858, 2071, 2194, 2298, 2450, 2586, 2636, 2640, 2631, 2581, 2507, 2510, 2616, 2724, 2759, 2794, 2909, 3031, 3037, 2930, 2813, 2713, 2606, 2525, 2499, 2448, 2333, 2257, 2319, 2479, 2668, 2855, 3005, 3063, 3071, 3159, 3365, 3575, 3673, 3649, 3578, 3519, 3490, 3498, 3527, 3536, 3503, 3458, 3440, 3454, 3496, 3546, 3558, 3500, 3424, 3400, 3411, 3390, 3349, 3371, 3480, 3602, 3670, 3719, 3819, 3990, 4180, 4329, 4412, 4445, 4478, 4540, 4587, 4583, 4591, 4645, 4634, 4484, 4343, 4371, 4467, 4441, 4308, 4201, 4129, 4024, 3936, 3923, 3891, 3719, 3523, 3521, 3677, 3736, 3662, 3674, 3824, 3882, 3773, 3743, 3924, 4092, 4039, 3944, 4076, 4345, 4460, 4405, 4404, 4501, 4549, 4542, 4587, 4605, 4442, 4184, 4039, 4005, 3944, 3843, 3754, 3628, 3420, 3271, 3326, 3436, 3338, 3096, 3008, 3079, 3025, 2803, 2697, 2764, 2728, 2491, 2290, 2275, 2292, 2192, 2024, 1850, 1643, 1419, 1299, 1287, 1199, 943, 694, 622, 586, 344, -34, -253, -224, -196, -370, -635, -773, -759, -714, -703, -736, -835, -977, -1092, -1172, -1274, -1370, -1402, -1417, -1515, -1654, -1724, -1723, -1759, -1882, -2054, -2197, -2270, -2297, -2347, -2458, -2595, -2728, -2852, -2955, -3027, -3107, -3254, -3430, -3513, -3467, -3410, -3451, -3509, -3470, -3414, -3474, -3562, -3526, -3472, -3582, -3746, -3734, -3613, -3613, -3724, -3751, -3699, -3732, -3844, -3853, -3720, -3634, -3708, -3802, -3770, -3672, -3618, -3558, -3397, -3226, -3209, -3331, -3408, -3341, -3222, -3157, -3146, -3134, -3080, -2918, -2658, -2466, -2449, -2466, -2360, -2259, -2345, -2511, -2525, -2389, -2291, -2324, -2438, -2545, -2546, -2414, -2274, -2281, -2400, -2433, -2335, -2316, -2482, -2584, -2338, -1890, -1673, -1802, -1935, -1793, -1492, -1286, -1192, -1054, -834, -726, -861, -984, -740, -303, -192, -435, -615, -735, -1049, -1200, -740, -302, -797, -1747, -1905, -1241, -818, -983, -1093, -829, -610, -730, -901, -738, -295, 10, -113, -508, -767, -664, -281, 208, 627, 791, 726, 713, 912, 1200, 1536, 1987, 2255, 1925, 1307, 1225, 1748, 2076, 1790, 1333, 1146, 1150, 1204, 1350, 1453, 1208, 720, 559, 953, 1389, 1397, 1206, 1175, 1185, 1127, 1353, 1962, 2341, 2059, 1634, 1783, 2369, 2666, 2363, 1898, 1834, 2122, 2163, 1665, 1098, 972, 1079, 920, 505, 131, -88, -24, 465, 957, 781, 193, 157, 795, 1181, 899, 601, 759, 940, 709, 417, 555, 936, 1128, 1239, 1597, 2009, 2063, 1851, 1752, 1830, 1970, 2145, 2100, 1399, 277, -223, 403, 1198, 968, 56, -203, 452, 978, 879, 839, 1240, 1531, 1408, 1348, 1643, 1985, 2180, 2381, 2541, 2433, 2254, 2466, 2918, 2877, 2248, 1922, 2404, 2942, 2757, 2271, 2254, 2511, 2325, 1602, 797, 108, -670, -1716, -2927, -4016, -4757, -5165, -5416, -5557, -5432, -4899, -4016, -3089, -2534, -2455, -2371, -1780, -1006, -864, -1412, -1719, -1110, 33, 928, 1307, 1461, 1780, 2377, 3002, 3300, 3217, 2969, 2677, 2329, 2038, 1935, 1966, 2042, 2150, 2128, 1785, 1376, 1401, 1840, 2163, 2175, 2232, 2573, 3052, 3554, 4159, 4808, 5248, 5386, 5427, 5505, 5469, 5189, 4864, 4798, 4915, 4779, 4222, 3627, 3417, 3482, 3404, 2998, 2303, 1404, 571, 120, -144, -800, -1806, -2413, -2349, -2231, -2472, -2615, -2201, -1556, -1237, -1221, -1147, -972, -894, -860, -714, -659, -983, -1420, -1429, -1025, -764, -886, -1049, -996, -948, -1121, -1332, -1416, -1595, -2047, -2516, -2783, -3064, -3521, -3919, -4094, -4269, -4544, -4655, -4472, -4235, -4077, -3807, -3331, -2904, -2698, -2499, -2112, -1765, -1740, -1877, -1926, -2002, -2235, -2347, -2159, -2017, -2234, -2509, -2433, -2142, -2035, -2173, -2349, -2511, -2766, -3081, -3335, -3591, -3965, -4280, -4269, -4041, -3916, -3870, -3620, -3144, -2662, -2243, -1831, -1463, -1179, -876, -505, -191, -51, -32, -16, 40, 100, 86, -45, -233, -399, -553, -715, -846, -962, -1183, -1514, -1815, -2069, -2422, -2861, -3171, -3318, -3521, -3823, -3970, -3790, -3454, -3211, -3093, -2956, -2729, -2480, -2297, -2175, -2065, -1994, -2035, -2163, -2268, -2335, -2430, -2536, -2573, -2599, -2733, -2916, -2999, -3001, -3048, -3164, -3305, -3492, -3701, -3829, -3858, -3898, -3968, -3942, -3777, -3570, -3376, -3106, -2698, -2238, -1840, -1490, -1121, -751, -433, -144, 148, 376, 442, 390, 347, 349, 332, 262, 177, 95, -12, -145, -248, -300, -360, -483, -653, -827, -1006, -1186, -1323, -1391, -1400, -1373, -1311, -1212, -1074, -883, -634, -364, -134, 28, 161, 287, 386, 451, 506, 551, 538, 476, 438, 446, 434, 369, 289, 222, 153, 75, 11, -24, -33, -28, -34, -63, -88, -86, -62, -12, 98, 258, 389, 459, 544, 727, 986, 1241, 1435, 1561, 1659, 1772, 1893, 1955, 1920, 1815, 1678, 1513, 1333, 1167, 1020, 876, 751, 667, 598, 501, 384, 295, 249, 189, 81, -20, -37, 17, 65, 62, 66, 176, 436, 775, 1045, 1199, 1343, 1589, 1900, 2149, 2287, 2352, 2391, 2431, 2481, 2514, 2508, 2495, 2507, 2503, 2419, 2296, 2262, 2317, 2294, 2088, 1842, 1756, 1817, 1846, 1779, 1704, 1676, 1657, 1655, 1743, 1889, 1923, 1785, 1673, 1821, 2150, 2336, 2224, 2022, 2026, 2253, 2471, 2507, 2379, 2188, 2025, 1962, 1991, 1989, 1851, 1638, 1494, 1436, 1340, 1150, 995, 1004, 1112, 1123, 980, 858, 949, 1211, 1401, 1357, 1210, 1228, 1466, 1686, 1710, 1649, 1685, 1800, 1885, 1943, 2020, 2104, 2175, 2208, 2154, 2024, 1958, 2018, 2038, 1850, 1564, 1408, 1402, 1357, 1173, 946, 830, 862, 976, 1071, 1041, 858, 662, 644, 803, 908, 783, 513, 332, 364, 531, 687, 762, 793, 847, 941, 1058, 1182, 1302, 1366, 1319, 1185, 1103, 1163, 1252, 1200, 1059, 1032, 1169, 1296, 1285, 1202, 1174, 1206, 1231, 1220, 1202, 1196, 1203, 1208, 1211, 1211, 1216, 1241, 1290, 1339, 1358, 1360, 1391, 1480, 1576, 1611, 1588, 1585, 1652, 1736, 1746, 1676, 1624, 1646, 1659, 1543, 1339, 1233, 1287, 1324, 1170, 887, 666, 555, 456, 301, 115, -42, -155, -240, -332, -445, -537, -545, -465, -383, -365, -365, -279, -83, 148, 331, 414, 417, 448, 621, 879, 1057, 1115, 1167, 1285, 1426, 1580, 1756, 1887, 1875, 1765, 1692, 1681, 1627, 1451, 1194, 950, 772, 655, 583, 539, 494, 413, 280, 104, -41, -67, 3, 13, -137, -344, -452, -452, -419, -364, -281, -249, -336, -444, -396, -190, -28, -72, -261, -411, -437, -399, -399, -481, -601, -649, -569, -443, -425, -544, -639, -581, -454, -452, -595, -714, -690, -620, -664, -826, -976, -1037, -1043, -1039, -1030, -1021, -991, -885, -744, -724, -852, -905, -719, -461, -398, -515, -586, -526, -448, -403, -299, -163, -170, -335, -454, -473, -566, -761, -856, -793, -755, -807, -827, -792, -794, -829, -807, -752, -738, -743, -713, -668, -660, -667, -639, -610, -667, -823, -985, -1058, -1030, -972, -993, -1171, -1433, -1570, -1485, -1336, -1321, -1420, -1466, -1399, -1291, -1186, -1045, -843, -668, -674, -877, -1050, -967, -721, -606, -715, -867, -918, -912, -893, -818, -689, -593, -599, -702, -851, -964, -983, -941, -933, -1008, -1118, -1207, -1249, -1246, -1189, -1088, -959, -786, -564, -373, -317, -315, -157, 145, 285, 104, -74, 153, 667, 938, 791, 640, 841, 1161, 1204, 1029, 971, 1075, 1050, 725, 248, -162, -435, -601, -739, -979, -1363, -1677, -1676, -1500, -1532, -1845, -2171, -2359, -2496, -2633, -2765, -2989, -3341, -3638, -3740, -3754, -3791, -3753, -3564, -3379, -3310, -3176, -2789, -2366, -2262, -2368, -2233, -1784, -1444, -1421, -1392, -1039, -495, -65, 201, 472, 866, 1327, 1690, 1842, 1833, 1856, 2068, 2412, 2669, 2710, 2670, 2802, 3149, 3480, 3606, 3604, 3631, 3661, 3600, 3495, 3436, 3396, 3317, 3226, 3150, 3046, 2923, 2856, 2827, 2723, 2531, 2392, 2379, 2367, 2238, 2058, 1925, 1773, 1535, 1347, 1347, 1412, 1347, 1210, 1199, 1274, 1216, 991, 801, 759, 734, 584, 378, 265, 261, 287, 303, 298, 231, 108, 49, 141, 281, 277, 110, -51, -76, -4, 79, 131, 129, 91, 112, 230, 320, 309, 322, 449, 546, 459, 295, 236, 295, 372, 380, 252, -4, -228, -240, -87, -17, -194, -505, -714, -734, -710, -818, -1049, -1241, -1301, -1307, -1370, -1459, -1462, -1421, -1521, -1757, -1843, -1648, -1466, -1569, -1777, -1768, -1571, -1449, -1492, -1577, -1602, -1566, -1525, -1533, -1594, -1627, -1571, -1511, -1574, -1687, -1616, -1337, -1154, -1258, -1420, -1375, -1257, -1326, -1512, -1556, -1478, -1511, -1653, -1652, -1440, -1296, -1425, -1639, -1635, -1461, -1409, -1581, -1789, -1897, -1998, -2181, -2347, -2380, -2374, -2483, -2669, -2753, -2732, -2790, -3001, -3182, -3205, -3214, -3398, -3657, -3720, -3587, -3554, -3773, -3999, -3956, -3732, -3633, -3723, -3782, -3690, -3595, -3638, -3721, -3667, -3488, -3327, -3217, -3077, -2899, -2765, -2685, -2579, -2421, -2293, -2271, -2343, -2433, -2479, -2458, -2397, -2333, -2281, -2230, -2154, -2011, -1809, -1633, -1568, -1577, -1569, -1540, -1564, -1658, -1756, -1798, -1777, -1698, -1583, -1474, -1384, -1268, -1097, -922, -830, -832, -865, -898, -967, -1087, -1191, -1209, -1150, -1081, -1068, -1097, -1068, -886, -622, -468, -514, -634, -657, -576, -485, -454, -478, -518, -530, -494, -403, -242, 3, 290, 505, 585, 613, 727, 940, 1104, 1136, 1112, 1133, 1186, 1211, 1210, 1220, 1264, 1348, 1441, 1466, 1395, 1319, 1347, 1441, 1468, 1397, 1340, 1343, 1312, 1212, 1156, 1185, 1146, 970, 838, 899, 1046, 1134, 1208, 1356, 1526, 1655, 1801, 2001, 2136, 2088, 1967, 1975, 2109, 2163, 2075, 2038, 2211, 2467, 2615, 2681, 2803, 2929, 2918, 2838, 2863, 2897, 2685, 2253, 1902, 1785, 1760, 1704, 1655, 1684, 1771, 1847, 1862, 1838, 1879, 2025, 2155, 2096, 1860, 1690, 1750, 1933, 2091, 2284, 2552, 2705, 2676, 2751, 3075, 3355, 3380, 3353, 3378, 3224, 2903, 2834, 3152, 3424, 3334, 3156, 3225, 3379, 3296, 3068, 3015, 3067, 2861, 2382, 1996, 1900, 1939, 1946, 1877, 1718, 1543, 1531, 1711, 1862, 1809, 1614, 1407, 1245, 1175, 1245, 1394, 1480, 1482, 1545, 1751, 1985, 2116, 2180, 2240, 2222, 2080, 1937, 1892, 1843, 1693, 1551, 1563, 1672, 1710, 1668, 1663, 1696, 1630, 1423, 1223, 1136, 1086, 959, 759, 576, 513, 588, 648, 538, 414, 560, 862, 896, 597, 363, 434, 660, 857, 958, 947, 930, 1095, 1387, 1540, 1522, 1555, 1647, 1581, 1381, 1290, 1323, 1246, 1008, 826, 843, 954, 1005, 974, 885, 713, 475, 278, 157, -3, -265, -528, -718, -842, -864, -761, -643, -595, -536, -443, -447, -539, -512, -377, -382, -545, -570, -336, -58, 118, 284, 490, 638, 735, 954, 1298, 1474, 1296, 992, 872, 891, 822, 694, 704, 806, 767, 567, 456, 550, 652, 579, 409, 298, 222, 119, 41, 19, -42, -174, -261, -242, -200, -188, -159, -111, -115, -199, -291, -302, -205, -50, 77, 136, 172, 252, 349, 351, 227, 120, 156, 235, 154, -76, -236, -207, -130, -186, -349, -445, -385, -279, -317, -506, -651, -674, -734, -913, -1041, -991, -910, -922, -896, -724, -545, -468, -369, -133, 86, 90, -46, -72, 86, 261, 319, 315, 332, 359, 394, 497, 642, 677, 509, 240, 61, 31, 16, -126, -358, -512, -516, -468, -447, -406, -320, -296, -420, -601, -705, -736, -804, -946, -1074, -1060, -910, -797, -842, -898, -756, -482, -319, -321, -377, -468, -631, -772, -804, -825, -913, -925, -744, -515, -425, -404, -261, -8, 152, 118, 7, -30, -22, -78, -179, -219, -196, -200, -195, -41, 210, 323, 260, 240, 324, 290, 50, -138, -91, -3, -144, -440, -587, -479, -316, -295, -358, -352, -324, -461, -734, -886, -843, -855, -1093, -1404, -1573, -1624, -1662, -1670, -1639, -1697, -1922, -2163, -2223, -2160, -2238, -2605, -3082, -3377, -3443, -3495, -3670, -3883, -4033, -4170, -4315, -4332, -4162, -4002, -4078, -4313, -4418, -4286, -4082, -3953, -3852, -3700, -3538, -3387, -3147, -2768, -2382, -2148, -2030, -1857, -1558, -1225, -972, -811, -674, -501, -288, -57, 178, 393, 555, 655, 709, 727, 716, 693, 688, 671, 561, 356, 218, 297, 442, 339, -17, -256, -162, -3, -119, -440, -657, -678, -681, -793, -947, -1033, -1052, -1096, -1205, -1324, -1373, -1334, -1291, -1332, -1432, -1446, -1295, -1087, -993, -1047, -1145, -1155, -1037, -921, -995, -1189, -1179, -842, -508, -503, -667, -627, -354, -138, -129, -195, -209, -213, -231, -187, -91, -65, -99, -18, 190, 299, 210, 147, 322, 602, 708, 604, 480, 447, 446, 434, 447, 468, 432, 367, 355, 381, 407, 481, 627, 706, 586, 357, 223, 222, 211, 95, -59, -179, -279, -375, -393, -277, -104, -7, -46, -174, -244, -124, 111, 204, 36, -229, -377, -375, -292, -177, -75, -14, 91, 341, 654, 829, 838, 859, 970, 990, 795, 584, 577, 644, 534, 330, 334, 577, 781, 784, 729, 785, 871, 784, 493, 168, -32, -108, -196, -399, -628, -661, -481, -386, -555, -713, -566, -327, -399, -738, -956, -938, -933, -1079, -1201, -1154, -1049, -1020, -993, -881, -760, -701, -630, -519, -489, -559, -545, -358, -191, -221, -315, -209, 107, 365, 365, 233, 230, 395, 531, 509, 428, 427, 481, 505, 518, 586, 714, 854, 947, 959, 949, 1034, 1178, 1185, 1028, 949, 1080, 1229, 1202, 1138, 1267, 1491, 1527, 1368, 1286, 1381, 1462, 1437, 1431, 1439, 1310, 1113, 1100, 1240, 1257, 1091, 955, 951, 975, 938, 851, 722, 571, 469, 436, 373, 197, 4, -38, 61, 128, 79, 21, 58, 169, 301, 430, 515, 532, 547, 654, 862, 1102, 1320, 1495, 1622, 1719, 1821, 1927, 2025, 2142, 2332, 2568, 2726, 2736, 2702, 2782, 2983, 3168, 3235, 3184, 3067, 2944, 2872, 2842, 2755, 2545, 2283, 2091, 1971, 1834, 1661, 1541, 1518, 1478, 1314, 1076, 926, 921, 957, 907, 741, 527, 360, 297, 330, 397, 430, 409, 349, 269, 185, 129, 116, 108, 77, 44, 12, -62, -182, -287, -342, -357, -349, -371, -502, -724, -886, -884, -844, -966, -1218, -1384, -1386, -1394, -1523, -1639, -1619, -1593, -1712, -1874, -1893, -1789, -1714, -1732, -1795, -1828, -1782, -1689, -1610, -1520, -1370, -1278, -1370, -1488, -1402, -1214, -1175, -1218, -1157, -1084, -1174, -1296, -1251, -1124, -1103, -1184, -1284, -1405, -1536, -1600, -1600, -1654, -1824, -2014, -2108, -2104, -2063, -2025, -2031, -2137, -2288, -2324, -2189, -2042, -2009, -2006, -1932, -1827, -1730, -1574, -1328, -1085, -939, -842, -680, -404, -111, 41, 65, 176, 440, 606, 515, 409, 519, 694, 721, 692, 738, 759, 692, 671, 738, 708, 501, 285, 208, 215, 173, 54, -70, -134, -155, -207, -317, -419, -454, -456, -473, -514, -561, -598, -564, -410, -188, -11, 85, 158, 281, 490, 755, 961, 1030, 1055, 1188, 1397, 1510, 1516, 1610, 1862, 2050, 1991, 1867, 1954, 2145, 2096, 1784, 1559, 1602, 1677, 1520, 1198, 941, 820, 767, 743, 697, 497, 153, -82, -70, -46, -248, -522, -623, -641, -781, -964, -950, -726, -520, -519, -668, -724, -501, -108, 133, 71, -115, -173, -24, 233, 484, 668, 799, 926, 1086, 1229, 1294, 1318, 1416, 1586, 1669, 1621, 1601, 1688, 1717, 1605, 1513, 1528, 1498, 1350, 1245, 1254, 1225, 1083, 933, 854, 797, 722, 631, 526, 434, 415, 443, 367, 135, -33, 87, 345, 361, 104, -20, 232, 589, 671, 526, 485, 673, 889, 945, 853, 722, 655, 720, 847, 808, 555, 440, 755, 1240, 1420, 1310, 1349, 1676, 1926, 1830, 1607, 1556, 1611, 1597, 1578, 1653, 1709, 1727, 1959, 2464, 2848, 2818, 2628, 2628, 2668, 2369, 1801, 1358, 1053, 535, -180, -672, -846, -1060, -1454, -1831, -2173, -2632, -3068, -3248, -3381, -3871, -4639, -5216, -5445, -5636, -5989, -6281, -6275, -6051, -5748, -5352, -4953, -4762, -4677, -4322, -3679, -3190, -3069, -2986, -2588, -1939, -1282, -694, -108, 522, 1220, 1984, 2684, 3133, 3412, 3841, 4459, 4902, 4998, 5051, 5293, 5577, 5771, 5925, 5961, 5761, 5533, 5591, 5804, 5774, 5409, 4958, 4603, 4317, 4034, 3702, 3274, 2790, 2382, 2124, 1921, 1639, 1324, 1131, 1062, 943, 676, 357, 133, 61, 85, 74, -41, -138, -25, 239, 381, 315, 281, 478, 779, 929, 891, 850, 942, 1113, 1235, 1249, 1174, 1071, 1029, 1100, 1216, 1236, 1107, 930, 849, 868, 867, 742, 531, 344, 206, 45, -149, -290, -324, -344, -464, -660, -813, -869, -876, -883, -896, -954, -1105, -1275, -1301, -1157, -992, -934, -959, -1005, -1037, -1000, -876, -746, -702, -734, -776, -794, -759, -664, -585, -598, -672, -740, -805, -858, -822, -697, -631, -742, -933, -1018, -973, -929, -969, -1051, -1104, -1132, -1151, -1134, -1067, -1001, -1001, -1076, -1171, -1207, -1133, -1004, -939, -997, -1113, -1187, -1180, -1108, -1012, -963, -1013, -1132, -1233, -1280, -1317, -1387, -1485, -1591, -1732, -1935, -2156, -2322, -2426, -2545, -2733, -2960, -3150, -3279, -3379, -3492, -3637, -3802, -3975, -4133, -4241, -4292, -4326, -4386, -4452, -4460, -4388, -4289, -4206, -4112, -3971, -3812, -3691, -3579, -3393, -3135, -2908, -2777, -2685, -2553, -2367, -2158, -1960, -1810, -1702, -1589, -1431, -1255, -1122, -1045, -993, -939, -894, -893, -947, -1022, -1077, -1114, -1172, -1262, -1330, -1324, -1304, -1388, -1560, -1661, -1632, -1620, -1736, -1893, -1967, -1971, -1965, -1951, -1911, -1873, -1841, -1781, -1679, -1566, -1469, -1398, -1359, -1353, -1330, -1245, -1121, -1034, -975, -859, -693, -568, -486, -375, -279, -275, -292, -229, -183, -275, -386, -342, -231, -248, -366, -395, -292, -208, -249, -352, -403, -381, -339, -339, -415, -527, -564, -476, -377, -382, -412, -353, -265, -250, -261, -207, -109, -21, 39, 28, -71, -137, -42, 131, 207, 176, 162, 223, 323, 446, 583, 646, 550, 376, 320, 428, 530, 488, 384, 359, 426, 514, 579, 598, 559, 486, 421, 359, 305, 285, 290, 273, 232, 206, 189, 176, 223, 353, 452, 422, 324, 293, 328, 343, 332, 388, 517, 601, 567, 521, 617, 849, 1061, 1134, 1105, 1088, 1148, 1253, 1333, 1361, 1357, 1332, 1302, 1329, 1455, 1601, 1646, 1618, 1671, 1833, 1930, 1831, 1668, 1655, 1781, 1844, 1758, 1659, 1669, 1731, 1744, 1715, 1704, 1709, 1709, 1719, 1755, 1755, 1656, 1506, 1423, 1435, 1460, 1433, 1376, 1347, 1379, 1455, 1502, 1478, 1443, 1474, 1548, 1585, 1577, 1577, 1599, 1647, 1742, 1869, 1950, 1950, 1943, 1993, 2039, 1989, 1872, 1825, 1914, 2062, 2151, 2167, 2176, 2225, 2280, 2244, 2082, 1918, 1925, 2059, 2092, 1934, 1767, 1773, 1892, 1967, 1967, 1938, 1864, 1717, 1586, 1589, 1668, 1635, 1439, 1235, 1175, 1257, 1386, 1465, 1456, 1445, 1589, 1891, 2143, 2196, 2142, 2155, 2253, 2316, 2307, 2319, 2448, 2670, 2881, 2984, 2950, 2875, 2929, 3129, 3276, 3254, 3203, 3247, 3255, 3101, 2921, 2885, 2927, 2902, 2827, 2781, 2738, 2632, 2498, 2413, 2365, 2258, 2046, 1761, 1449, 1165, 983, 874, 696, 421, 228, 218, 245, 193, 107, 7, -174, -387, -499, -533, -601, -678, -710, -784, -960, -1096, -1049, -912, -861, -912, -950, -933, -918, -938, -976, -1037, -1134, -1211, -1203, -1157, -1162, -1205, -1238, -1288, -1336, -1282, -1150, -1142, -1338, -1589, -1751, -1824, -1822, -1759, -1756, -1921, -2133, -2183, -2050, -1906, -1869, -1915, -1993, -2077, -2113, -2044, -1935, -1914, -1973, -1976, -1903, -1867, -1864, -1781, -1633, -1550, -1531, -1461, -1325, -1189, -1052, -898, -814, -869, -966, -930, -744, -569, -531, -606, -698, -732, -655, -486, -371, -436, -602, -715, -767, -810, -796, -703, -665, -782, -942, -1006, -998, -985, -952, -914, -971, -1149, -1296, -1271, -1160, -1145, -1221, -1243, -1187, -1146, -1126, -1049, -934, -877, -877, -863, -811, -730, -623, -552, -561, -559, -420, -202, -72, -58, -24, 86, 153, 86, -11, 3, 102, 140, 61, -75, -178, -150, 37, 222, 191, -25, -190, -199, -154, -130, -99, -84, -186, -386, -531, -527, -445, -399, -404, -424, -458, -503, -514, -482, -473, -502, -503, -444, -378, -316, -182, 25, 176, 162, 62, 48, 176, 334, 393, 343, 268, 244, 277, 323, 352, 405, 514, 608, 573, 447, 407, 538, 687, 655, 456, 262, 181, 174, 202, 272, 345, 340, 273, 272, 377, 468, 440, 364, 356, 407, 424, 418, 513, 737, 912, 874, 706, 656, 808, 987, 1008, 870, 677, 514, 452, 550, 747, 860, 771, 563, 381, 241, 50, -229, -524, -773, -1038, -1391, -1770, -2040, -2189, -2358, -2625, -2902, -3086, -3210, -3352, -3505, -3618, -3734, -3945, -4244, -4471, -4468, -4259, -4028, -3919, -3885, -3769, -3500, -3181, -2937, -2731, -2445, -2109, -1868, -1720, -1463, -989, -441, 2, 334, 639, 953, 1286, 1676, 2109, 2478, 2693, 2786, 2902, 3130, 3428, 3695, 3890, 4032, 4151, 4239, 4308, 4380, 4450, 4464, 4377, 4234, 4127, 4057, 3939, 3758, 3604, 3500, 3340, 3088, 2888, 2843, 2849, 2732, 2479, 2216, 2024, 1866, 1677, 1456, 1252, 1087, 943, 820, 747, 713, 656, 572, 542, 598, 638, 548, 382, 295, 323, 347, 276, 178, 162, 240, 347, 443, 518, 551, 554, 579, 644, 694, 677, 614, 556, 506, 448, 407, 434, 509, 530, 428, 276, 208, 241, 236, 75, -187, -404, -520, -599, -702, -811, -914, -1042, -1191, -1284, -1309, -1357, -1490, -1629, -1701, -1756, -1877, -2018, -2065, -2013, -1961, -1981, -2038, -2059, -1990, -1814, -1587, -1445, -1463, -1517, -1411, -1145, -914, -836, -810, -670, -406, -155, -32, 21, 162, 421, 640, 689, 652, 712, 891, 1029, 1001, 859, 743, 722, 751, 749, 660, 498, 330, 199, 65, -142, -398, -594, -722, -917, -1265, -1660, -1946, -2123, -2318, -2563, -2774, -2939, -3156, -3449, -3699, -3821, -3914, -4093, -4315, -4465, -4571, -4710, -4813, -4787, -4742, -4814, -4862, -4696, -4469, -4455, -4550, -4430, -4077, -3813, -3804, -3854, -3716, -3392, -3055, -2843, -2802, -2866, -2823, -2492, -2009, -1702, -1666, -1682, -1577, -1361, -1087, -855, -854, -1079, -1205, -1012, -739, -734, -913, -914, -672, -508, -643, -897, -995, -931, -888, -950, -1091, -1274, -1429, -1440, -1303, -1203, -1295, -1502, -1595, -1488, -1351, -1399, -1610, -1753, -1669, -1463, -1374, -1461, -1540, -1429, -1193, -1034, -1002, -963, -817, -632, -508, -440, -375, -306, -228, -103, 69, 216, 297, 402, 626, 883, 1009, 1012, 1065, 1260, 1493, 1607, 1569, 1487, 1520, 1705, 1906, 1975, 1916, 1860, 1901, 2037, 2212, 2342, 2350, 2250, 2159, 2170, 2219, 2182, 2055, 1947, 1897, 1852, 1822, 1885, 2009, 2026, 1880, 1707, 1635, 1602, 1507, 1391, 1333, 1277, 1115, 913, 880, 1084, 1339, 1431, 1348, 1235, 1219, 1314, 1439, 1510, 1522, 1524, 1552, 1622, 1773, 2005, 2233, 2400, 2529, 2623, 2648, 2664, 2806, 3050, 3164, 3026, 2839, 2882, 3137, 3320, 3272, 3142, 3133, 3212, 3196, 3021, 2790, 2597, 2415, 2184, 1933, 1734, 1613, 1530, 1441, 1329, 1163, 936, 698, 523, 384, 160, -183, -523, -735, -864, -1029, -1240, -1399, -1482, -1579, -1748, -1906, -1947, -1918, -1972, -2146, -2292, -2285, -2196, -2177, -2250, -2296, -2247, -2130, -1990, -1852, -1757, -1737, -1739, -1654, -1454, -1246, -1146, -1141, -1106, -981, -827, -711, -578, -353, -94, 78, 154, 233, 351, 456, 525, 596, 681, 739, 755, 763, 793, 814, 793, 759, 776, 841, 867, 800, 683, 609, 592, 560, 469, 374, 340, 290, 115, -100, -163, -96, -121, -282, -385, -345, -282, -256, -213, -180, -252, -383, -407, -274, -119, -70, -119, -159, -92, 102, 360, 563, 650, 700, 833, 1026, 1187, 1315, 1436, 1477, 1430, 1476, 1690, 1881, 1920, 1972, 2163, 2328, 2323, 2299, 2420, 2582, 2587, 2442, 2319, 2307, 2349, 2348, 2278, 2172, 2099, 2109, 2162, 2130, 1974, 1793, 1651, 1469, 1208, 991, 926, 957, 959, 883, 760, 673, 701, 806, 853, 760, 613, 511, 461, 438, 457, 500, 465, 319, 211, 318, 583, 752, 718, 647, 746, 983, 1157, 1128, 943, 768, 749, 903, 1112, 1244, 1256, 1227, 1260, 1370, 1445, 1389, 1281, 1265, 1298, 1200, 972, 828, 868, 924, 847, 747, 789, 918, 932, 762, 527, 340, 204, 112, 69, 32, -67, -186, -211, -136, -87, -140, -205, -170, -49, 12, -71, -212, -244, -142, -66, -149, -307, -316, -83, 226, 365, 286, 189, 256, 406, 402, 168, -119, -287, -362, -449, -594, -784, -983, -1132, -1222, -1359, -1641, -2019, -2372, -2662, -2949, -3290, -3687, -4083, -4400, -4596, -4705, -4783, -4875, -5023, -5227, -5378, -5382, -5315, -5335, -5426, -5416, -5256, -5083, -4990, -4878, -4613, -4238, -3879, -3551, -3164, -2688, -2200, -1756, -1365, -1025, -678, -231, 331, 899, 1387, 1826, 2266, 2710, 3162, 3653, 4150, 4550, 4836, 5135, 5535, 5925, 6128, 6170, 6223, 6357, 6511, 6631, 6698, 6692, 6635, 6610, 6612, 6526, 6313, 6056, 5816, 5537, 5180, 4817, 4542, 4334, 4098, 3785, 3421, 3056, 2735, 2482, 2250, 1947, 1565, 1213, 947, 684, 368, 83, -91, -209, -361, -522, -615, -660, -753, -915, -1043, -1042, -956, -914, -967, -1035, -1021, -914, -792, -734, -734, -711, -597, -420, -290, -259, -269, -225, -138, -116, -188, -229, -146, -58, -136, -323, -432, -447, -502, -634, -768, -909, -1091, -1259, -1369, -1492, -1689, -1897, -2043, -2163, -2309, -2461, -2600, -2785, -3011, -3136, -3068, -2974, -3074, -3318, -3487, -3516, -3460, -3310, -3114, -3064, -3201, -3264, -3061, -2737, -2513, -2386, -2259, -2130, -2013, -1848, -1591, -1319, -1109, -929, -723, -540, -411, -252, -8, 199, 287, 345, 421, 434, 415, 525, 716, 733, 539, 381, 378, 373, 232, 31, -130, -278, -457, -645, -831, -1066, -1359, -1624, -1840, -2102, -2426, -2677, -2798, -2932, -3184, -3471, -3688, -3825, -3895, -3925, -4020, -4251, -4504, -4589, -4508, -4434, -4469, -4527, -4488, -4369, -4245, -4104, -3896, -3683, -3580, -3568, -3470, -3178, -2819, -2611, -2592, -2563, -2332, -1940, -1598, -1394, -1251, -1095, -900, -639, -352, -182, -154, -72, 145, 286, 195, 104, 281, 590, 697, 577, 511, 608, 667, 590, 531, 551, 484, 290, 143, 79, -45, -198, -204, -121, -177, -369, -520, -597, -688, -793, -861, -935, -1062, -1167, -1157, -1081, -1067, -1114, -1147, -1189, -1275, -1263, -1070, -913, -991, -1087, -944, -738, -732, -788, -655, -439, -361, -373, -296, -133, 23, 158, 284, 381, 447, 507, 561, 576, 576, 634, 759, 857, 885, 911, 954, 945, 904, 940, 1009, 953, 804, 742, 755, 673, 515, 444, 453, 401, 293, 260, 306, 291, 154, -1, -55, -26, -25, -103, -191, -199, -125, -61, -79, -130, -104, 2, 66, 40, 21, 85, 156, 173, 224, 394, 600, 713, 755, 843, 1001, 1144, 1224, 1291, 1387, 1470, 1498, 1495, 1522, 1602, 1729, 1871, 1991, 2078, 2143, 2174, 2149, 2113, 2133, 2167, 2109, 1938, 1759, 1665, 1649, 1663, 1667, 1638, 1578, 1534, 1540, 1532, 1389, 1109, 853, 741, 687, 538, 324, 239, 343, 465, 467, 451, 568, 741, 766, 596, 377, 240, 206, 239, 295, 349, 419, 551, 743, 933, 1088, 1244, 1416, 1531, 1506, 1394, 1339, 1393, 1477, 1526, 1559, 1638, 1818, 2071, 2276, 2340, 2336, 2370, 2387, 2283, 2128, 2049, 2001, 1872, 1714, 1668, 1744, 1852, 1938, 1993, 2004, 1972, 1909, 1796, 1615, 1398, 1196, 1028, 896, 814, 781, 781, 801, 821, 805, 741, 651, 542, 373, 133, -101, -254, -336, -412, -493, -520, -490, -460, -466, -479, -491, -556, -689, -838, -958, -1046, -1114, -1197, -1317, -1400, -1320, -1096, -896, -817, -802, -796, -781, -732, -657, -655, -777, -892, -850, -698, -587, -539, -449, -267, -78, 24, 49, 50, 50, 40, 13, -36, -83, -50, 95, 257, 313, 282, 302, 414, 515, 509, 422, 334, 262, 201, 164, 140, 77, -5, -18, 45, 98, 147, 309, 548, 627, 426, 148, 65, 162, 219, 158, 114, 166, 244, 307, 419, 592, 731, 781, 756, 691, 631, 625, 626, 563, 492, 540, 679, 752, 750, 817, 987, 1091, 1003, 822, 700, 609, 455, 293, 243, 268, 251, 210, 249, 374, 500, 575, 563, 430, 216, 49, -22, -86, -231, -419, -544, -547, -479, -431, -406, -332, -207, -159, -296, -527, -659, -652, -670, -835, -1023, -1029, -842, -643, -551, -519, -472, -415, -399, -431, -497, -581, -673, -763, -829, -844, -782, -635, -431, -236, -104, -40, 6, 78, 150, 164, 100, 23, -3, 17, 32, 40, 93, 198, 287, 314, 326, 377, 411, 334, 161, 29, 0, -30, -162, -306, -295, -165, -126, -246, -329, -241, -149, -270, -544, -756, -852, -935, -1055, -1149, -1163, -1117, -1052, -993, -942, -898, -868, -859, -868, -867, -823, -798, -892, -1062, -1116, -989, -834, -753, -677, -566, -483, -398, -241, -121, -182, -311, -296, -182, -170, -258, -258, -115, 37, 111, 174, 316, 511, 662, 722, 713, 669, 615, 575, 550, 536, 558, 634, 741, 825, 889, 971, 1046, 1041, 936, 804, 704, 594, 430, 261, 165, 111, -3, -213, -450, -640, -776, -875, -960, -1087, -1321, -1648, -1969, -2222, -2443, -2669, -2857, -2956, -2985, -3001, -3052, -3175, -3350, -3485, -3522, -3510, -3525, -3535, -3464, -3309, -3164, -3082, -3001, -2818, -2520, -2191, -1905, -1652, -1380, -1079, -775, -472, -159, 150, 460, 806, 1202, 1590, 1917, 2229, 2599, 3009, 3355, 3600, 3828, 4121, 4442, 4708, 4904, 5093, 5315, 5564, 5792, 5950, 6040, 6124, 6248, 6365, 6399, 6343, 6241, 6137, 6061, 6036, 6039, 5996, 5871, 5718, 5592, 5439, 5173, 4824, 4537, 4381, 4256, 4044, 3748, 3461, 3237, 3051, 2832, 2545, 2232, 1972, 1781, 1588, 1348, 1112, 922, 737, 492, 220, 24, -70, -149, -292, -473, -611, -686, -757, -890, -1083, -1255, -1337, -1382, -1492, -1648, -1728, -1723, -1760, -1881, -1971, -1951, -1906, -1939, -2027, -2102, -2160, -2243, -2335, -2389, -2411, -2440, -2478, -2482, -2442, -2389, -2349, -2338, -2374, -2422, -2447, -2468, -2519, -2542, -2474, -2374, -2335, -2322, -2230, -2072, -1952, -1898, -1840, -1756, -1707, -1702, -1660, -1541, -1433, -1396, -1346, -1196, -998, -856, -773, -680, -548, -414, -325, -300, -295, -253, -188, -166, -186, -169, -84, 13, 74, 106, 125, 123, 94, 40, -42, -162, -308, -454, -585, -692, -775, -834, -890, -969, -1085, -1229, -1382, -1537, -1699, -1880, -2086, -2296, -2466, -2591, -2698, -2795, -2861, -2901, -2949, -3016, -3098, -3204, -3326, -3409, -3437, -3480, -3574, -3637, -3601, -3516, -3447, -3375, -3247, -3088, -2965, -2919, -2919, -2882, -2745, -2553, -2436, -2445, -2470, -2363, -2106, -1818, -1598, -1442, -1297, -1150, -1012, -884, -753, -611, -461, -356, -356, -399, -331, -113, 93, 177, 214, 305, 409, 451, 451, 459, 473, 485, 492, 477, 423, 367, 373, 440, 494, 489, 457, 439, 424, 397, 363, 305, 189, 50, -17, -11, -21, -94, -173, -208, -205, -167, -86, -20, -71, -245, -400, -423, -366, -370, -457, -530, -522, -458, -393, -344, -323, -327, -324, -291, -249, -248, -306, -385, -435, -443, -419, -370, -282, -159, -54, -43, -137, -212, -134, 24, 52, -116, -304, -349, -279, -199, -144, -117, -124, -134, -124, -104, -82, -34, 0, -63, -212, -319, -314, -265, -254, -238, -148, -24, 29, 20, 33, 81, 99, 86, 85, 93, 112, 198, 340, 426, 424, 435, 496, 534, 539, 561, 563, 492, 421, 444, 513, 544, 560, 597, 619, 613, 617, 627, 594, 518, 453, 427, 413, 377, 311, 224, 156, 141, 164, 169, 149, 148, 191, 222, 177, 99, 83, 133, 165, 144, 122, 161, 268, 388, 426, 368, 357, 529, 774, 851, 727, 629, 731, 970, 1167, 1248, 1275, 1356, 1507, 1651, 1730, 1798, 1927, 2074, 2142, 2130, 2136, 2199, 2238, 2184, 2099, 2080, 2128, 2174, 2195, 2199, 2157, 2053, 1943, 1879, 1802, 1646, 1431, 1246, 1134, 1066, 992, 901, 806, 705, 571, 389, 197, 40, -96, -263, -461, -626, -707, -738, -780, -863, -951, -988, -969, -943, -943, -969, -1026, -1137, -1272, -1361, -1377, -1366, -1350, -1303, -1245, -1222, -1207, -1130, -1012, -941, -935, -930, -880, -805, -732, -670, -626, -599, -576, -523, -452, -402, -385, -368, -333, -315, -333, -354, -337, -292, -263, -259, -252, -215, -180, -198, -261, -299, -258, -174, -129, -157, -195, -186, -155, -158, -182, -165, -108, -72, -82, -83, -37, 40, 115, 172, 202, 210, 245, 363, 561, 760, 885, 949, 1020, 1134, 1256, 1336, 1376, 1420, 1507, 1626, 1746, 1879, 2049, 2209, 2269, 2228, 2201, 2244, 2275, 2225, 2168, 2205, 2278, 2242, 2091, 1972, 1979, 2020, 1970, 1844, 1742, 1686, 1605, 1441, 1220, 1007, 839, 705, 565, 423, 291, 152, -29, -231, -369, -410, -404, -423, -501, -622, -732, -782, -776, -765, -775, -763, -684, -559, -443, -342, -221, -62, 95, 216, 310, 407, 511, 604, 689, 795, 938, 1102, 1257, 1381, 1449, 1465, 1476, 1523, 1586, 1595, 1532, 1458, 1428, 1419, 1376, 1307, 1267, 1271, 1257, 1185, 1100, 1048, 959, 730, 415, 197, 133, 85, -71, -278, -433, -528, -599, -661, -728, -822, -931, -1034, -1126, -1204, -1268, -1350, -1475, -1591, -1614, -1536, -1437, -1382, -1370, -1358, -1300, -1170, -989, -842, -805, -863, -922, -906, -800, -613, -370, -163, -74, -46, 58, 261, 448, 544, 586, 626, 694, 803, 901, 933, 925, 978, 1099, 1217, 1298, 1352, 1361, 1322, 1279, 1241, 1167, 1075, 1017, 942, 751, 513, 410, 451, 414, 156, -183, -373, -385, -406, -585, -883, -1186, -1456, -1712, -1932, -2065, -2131, -2249, -2509, -2848, -3093, -3176, -3215, -3325, -3472, -3584, -3653, -3676, -3618, -3517, -3495, -3574, -3607, -3497, -3326, -3201, -3081, -2872, -2595, -2363, -2205, -2035, -1789, -1499, -1225, -975, -730, -482, -209, 120, 482, 801, 1041, 1269, 1549, 1839, 2058, 2215, 2394, 2631, 2888, 3116, 3291, 3409, 3505, 3628, 3777, 3910, 4010, 4090, 4140, 4135, 4103, 4118, 4181, 4208, 4125, 3984, 3876, 3819, 3774, 3725, 3657, 3534, 3367, 3209, 3058, 2878, 2724, 2655, 2570, 2332, 2008, 1825, 1844, 1892, 1790, 1564, 1345, 1216, 1157, 1109, 1032, 922, 813, 743, 697, 633, 555, 505, 472, 415, 356, 348, 370, 361, 316, 278, 256, 252, 274, 306, 290, 219, 169, 187, 216, 178, 98, 53, 35, -25, -109, -121, -62, -59, -192, -379, -486, -462, -386, -383, -497, -632, -686, -686, -726, -801, -840, -854, -915, -1020, -1079, -1060, -1034, -1050, -1079, -1087, -1109, -1162, -1178, -1124, -1071, -1076, -1092, -1046, -956, -873, -810, -767, -742, -706, -638, -562, -520, -508, -505, -490, -435, -311, -158, -72, -88, -119, -86, -43, -78, -133, -96, -7, -17, -144, -245, -258, -262, -320, -391, -445, -510, -607, -710, -806, -930, -1104, -1284, -1421, -1532, -1661, -1813, -1950, -2051, -2123, -2193, -2288, -2418, -2561, -2691, -2818, -2951, -3073, -3169, -3242, -3283, -3284, -3267, -3259, -3235, -3159, -3074, -3082, -3181, -3219, -3085, -2858, -2737, -2769, -2803, -2690, -2451, -2220, -2058, -1936, -1832, -1744, -1644, -1482, -1275, -1095, -971, -864, -752, -668, -615, -515, -327, -142, -79, -111, -109, -21, 75, 115, 99, 52, -24, -115, -196, -246, -256, -256, -304, -406, -481, -494, -532, -667, -831, -923, -966, -1056, -1205, -1330, -1395, -1442, -1502, -1541, -1546, -1562, -1607, -1629, -1594, -1562, -1596, -1645, -1608, -1500, -1438, -1457, -1450, -1349, -1225, -1168, -1145, -1055, -888, -718, -598, -518, -450, -389, -319, -228, -136, -61, 23, 116, 164, 161, 212, 373, 526, 554, 497, 447, 418, 406, 407, 368, 247, 129, 122, 176, 179, 132, 106, 79, -22, -171, -246, -231, -263, -429, -628, -723, -724, -719, -747, -806, -880, -915, -888, -860, -879, -889, -861, -871, -946, -993, -963, -906, -844, -740, -632, -593, -580, -507, -406, -364, -364, -323, -238, -184, -175, -137, -25, 103, 177, 212, 278, 395, 510, 554, 519, 481, 529, 630, 667, 634, 655, 735, 738, 640, 594, 664, 752, 808, 866, 887, 808, 722, 785, 940, 967, 813, 681, 730, 864, 895, 810, 750, 770, 805, 800, 752, 692, 647, 629, 598, 530, 472, 478, 507, 493, 446, 419, 411, 377, 327, 307, 303, 258, 189, 172, 186, 131, 15, -40, -13, -14, -54, -24, 83, 137, 90, 56, 112, 185, 179, 129, 123, 177, 240, 289, 332, 374, 417, 492, 598, 694, 766, 841, 916, 955, 988, 1057, 1123, 1127, 1108, 1154, 1266, 1369, 1436, 1499, 1560, 1569, 1535, 1532, 1585, 1614, 1577, 1540, 1551, 1563, 1526, 1480, 1470, 1464, 1419, 1368, 1374, 1426, 1449, 1410, 1328, 1228, 1138, 1105, 1137, 1154, 1092, 1003, 984, 1036, 1080, 1091, 1103, 1123, 1115, 1069, 1024, 1011, 1008, 1005, 1016, 1026, 1012, 1003, 1062, 1165, 1223, 1212, 1190, 1179, 1149, 1094, 1046, 1021, 996, 957, 905, 853, 816, 809, 812, 777, 702, 667, 735, 850, 871, 749, 589, 518, 523, 505, 423, 339, 306, 298, 284, 270, 268, 248, 201, 139, 87, 64, 73, 75, 25, -46, -59, -17, -13, -78, -112, -45, 32, -7, -129, -195, -175, -184, -270, -349, -349, -291, -219, -159, -151, -186, -195, -162, -155, -202, -221, -165, -111, -158, -275, -348, -333, -286, -248, -207, -165, -136, -105, -72, -97, -183, -215, -150, -113, -182, -231, -150, -42, -50, -142, -190, -157, -113, -117, -166, -219, -242, -244, -244, -249, -236, -198, -158, -144, -150, -154, -158, -177, -200, -200, -183, -188, -224, -258, -277, -303, -348, -381, -371, -335, -316, -336, -369, -374, -348, -323, -336, -391, -449, -461, -411, -357, -379, -466, -510, -441, -350, -369, -481, -549, -507, -425, -403, -443, -460, -398, -298, -249, -258, -250, -184, -119, -109, -104, -30, 77, 107, 37, -26, 6, 112, 207, 261, 286, 285, 276, 295, 353, 399, 386, 326, 257, 220, 237, 293, 341, 356, 341, 302, 249, 226, 251, 281, 258, 199, 161, 164, 174, 164, 124, 70, 39, 50, 87, 98, 48, -58, -187, -286, -329, -354, -404, -453, -458, -453, -505, -613, -705, -738, -738, -739, -736, -710, -668, -651, -682, -740, -771, -746, -688, -634, -585, -508, -400, -308, -265, -228, -140, -5, 125, 231, 330, 446, 586, 735, 857, 943, 1058, 1252, 1485, 1672, 1786, 1884, 2009, 2154, 2279, 2373, 2461, 2573, 2695, 2788, 2851, 2940, 3075, 3187, 3208, 3154, 3104, 3114, 3187, 3268, 3297, 3247, 3166, 3116, 3113, 3114, 3071, 2975, 2865, 2797, 2763, 2701, 2574, 2428, 2302, 2184, 2060, 1938, 1809, 1647, 1477, 1337, 1199, 1022, 849, 716, 594, 448, 307, 194, 58, -125, -315, -479, -651, -848, -1008, -1088, -1155, -1299, -1494, -1643, -1736, -1844, -1973, -2067, -2109, -2148, -2201, -2255, -2317, -2389, -2445, -2471, -2496, -2521, -2504, -2421, -2314, -2247, -2229, -2217, -2158, -2054, -1950, -1890, -1861, -1820, -1753, -1678, -1607, -1532, -1429, -1291, -1157, -1080, -1060, -1020, -905, -775, -713, -699, -651, -551, -457, -403, -348, -240, -86, 41, 85, 74, 79, 106, 95, 50, 49, 107, 149, 131, 98, 93, 111, 133, 139, 104, 49, 39, 75, 94, 56, -3, -58, -123, -196, -234, -219, -178, -158, -179, -237, -288, -291, -256, -261, -378, -560, -690, -734, -746, -752, -731, -723, -809, -956, -1064, -1117, -1183, -1272, -1349, -1409, -1478, -1552, -1624, -1703, -1773, -1818, -1867, -1931, -1968, -1968, -1990, -2060, -2122, -2158, -2201, -2237, -2217, -2180, -2220, -2303, -2287, -2150, -2069, -2154, -2256, -2187, -2010, -1923, -1940, -1915, -1809, -1710, -1637, -1529, -1382, -1246, -1130, -1014, -901, -805, -717, -619, -506, -387, -269, -133, 57, 281, 432, 465, 482, 593, 747, 835, 875, 962, 1115, 1261, 1354, 1408, 1452, 1509, 1580, 1634, 1653, 1671, 1725, 1802, 1854, 1848, 1792, 1727, 1698, 1709, 1714, 1677, 1610, 1544, 1490, 1447, 1410, 1350, 1237, 1090, 978, 937, 916, 843, 712, 565, 440, 339, 269, 224, 170, 67, -58, -159, -231, -296, -362, -423, -489, -557, -616, -674, -731, -755, -753, -798, -919, -1025, -1026, -971, -964, -1020, -1077, -1105, -1117, -1128, -1132, -1128, -1125, -1122, -1106, -1076, -1046, -1031, -1038, -1070, -1116, -1141, -1129, -1112, -1126, -1167, -1192, -1174, -1114, -1047, -1022, -1047, -1070, -1041, -985, -966, -988, -1014, -1023, -1033, -1035, -995, -901, -813, -809, -890, -960, -931, -831, -763, -780, -831, -850, -825, -785, -755, -731, -699, -663, -635, -626, -618, -594, -564, -555, -572, -585, -569, -533, -501, -483, -479, -485, -490, -478, -444, -410, -407, -436, -458, -444, -412, -410, -464, -540, -572, -531, -464, -424, -412, -394, -357, -304, -252, -245, -314, -407, -448, -441, -448, -473, -478, -462, -453, -464, -499, -555, -586, -564, -541, -591, -688, -744, -746, -739, -753, -782, -822, -856, -856, -819, -785, -776, -775, -760, -738, -723, -717, -714, -702, -669, -615, -568, -547, -519, -435, -319, -261, -282, -291, -211, -76, 27, 75, 107, 164, 258, 365, 449, 502, 531, 532, 517, 546, 652, 768, 821, 841, 895, 966, 1004, 1030, 1090, 1146, 1134, 1070, 1030, 1041, 1053, 1024, 982, 970, 974, 933, 846, 791, 801, 809, 750, 675, 677, 750, 800, 772, 684, 585, 530, 554, 627, 684, 677, 623, 565, 534, 527, 521, 514, 554, 644, 709, 688, 643, 673, 768, 838, 858, 876, 920, 976, 1022, 1051, 1071, 1104, 1158, 1210, 1235, 1249, 1269, 1275, 1248, 1203, 1177, 1178, 1191, 1196, 1190, 1204, 1264, 1328, 1322, 1244, 1192, 1232, 1296, 1275, 1173, 1104, 1133, 1204, 1237, 1252, 1299, 1374, 1424, 1431, 1427, 1453, 1506, 1534, 1497, 1426, 1397, 1436, 1486, 1491, 1461, 1432, 1437, 1486, 1541, 1548, 1498, 1449, 1441, 1441, 1415, 1393, 1418, 1460, 1449, 1379, 1323, 1333, 1372, 1354, 1277, 1210, 1213, 1264, 1274, 1207, 1127, 1115, 1140, 1113, 1049, 1042, 1095, 1112, 1080, 1080, 1120, 1136, 1136, 1183, 1260, 1287, 1265, 1267, 1327, 1395, 1424, 1412, 1406, 1436, 1472, 1464, 1428, 1414, 1418, 1381, 1295, 1221, 1202, 1196, 1153, 1083, 1019, 943, 845, 772, 764, 751, 639, 476, 392, 401, 397, 307, 156, -7, -145, -238, -315, -414, -516, -573, -590, -623, -677, -719, -748, -813, -933, -1062, -1139, -1166, -1179, -1218, -1304, -1405, -1449, -1382, -1262, -1193, -1182, -1147, -1084, -1052, -1043, -979, -851, -734, -663, -605, -520, -396, -250, -119, -29, 46, 145, 261, 360, 435, 493, 546, 621, 735, 847, 885, 868, 885, 980, 1083, 1121, 1120, 1144, 1186, 1191, 1163, 1152, 1149, 1099, 996, 900, 839, 792, 734, 663, 589, 542, 535, 531, 498, 435, 338, 190, 39, -17, 15, 20, -55, -134, -159, -163, -171, -170, -163, -187, -221, -208, -133, -43, 13, 41, 69, 104, 114, 89, 108, 245, 427, 492, 419, 370, 457, 606, 679, 647, 585, 559, 569, 575, 554, 527, 521, 523, 513, 506, 518, 515, 449, 330, 215, 148, 125, 106, 41, -65, -163, -205, -209, -227, -278, -344, -408, -470, -531, -591, -635, -634, -598, -587, -640, -697, -670, -570, -512, -549, -601, -569, -487, -456, -485, -495, -454, -414, -410, -410, -370, -296, -233, -211, -220, -228, -211, -182, -171, -205, -261, -296, -306, -319, -357, -399, -418, -416, -429, -478, -548, -602, -627, -661, -734, -817, -876, -933, -1016, -1091, -1110, -1103, -1120, -1171, -1220, -1257, -1304, -1379, -1474, -1566, -1633, -1679, -1728, -1785, -1826, -1841, -1847, -1863, -1889, -1913, -1918, -1894, -1853, -1834, -1855, -1885, -1881, -1827, -1745, -1661, -1586, -1519, -1454, -1402, -1373, -1350, -1291, -1179, -1055, -958, -902, -881, -881, -875, -830, -761, -706, -692, -706, -701, -636, -535, -485, -524, -591, -615, -610, -615, -609, -568, -540, -593, -722, -871, -976, -998, -951, -925, -1002, -1174, -1337, -1412, -1411, -1400, -1438, -1535, -1660, -1765, -1819, -1827, -1815, -1810, -1827, -1878, -1936, -1931, -1838, -1739, -1726, -1776, -1805, -1785, -1739, -1670, -1578, -1498, -1448, -1388, -1286, -1175, -1116, -1112, -1116, -1089, -1039, -975, -888, -782, -685, -634, -639, -672, -672, -605, -526, -520, -591, -639, -613, -577, -603, -673, -727, -755, -786, -843, -913, -985, -1047, -1072, -1063, -1070, -1132, -1193, -1180, -1109, -1064, -1084, -1126, -1142, -1129, -1089, -1014, -910, -813, -752, -724, -695, -644, -576, -505, -445, -391, -321, -225, -134, -55, 32, 119, 152, 145, 182, 282, 372, 424, 494, 584, 618, 579, 546, 581, 644, 666, 642, 618, 618, 626, 615, 577, 522, 473, 461, 481, 497, 489, 459, 399, 309, 226, 198, 214, 230, 235, 228, 187, 115, 79, 131, 218, 256, 235, 218, 244, 286, 313, 339, 377, 401, 393, 385, 406, 452, 505, 548, 575, 604, 673, 775, 859, 926, 1004, 1063, 1069, 1091, 1212, 1365, 1408, 1327, 1244, 1262, 1378, 1524, 1621, 1623, 1560, 1495, 1464, 1472, 1518, 1564, 1551, 1445, 1281, 1115, 992, 937, 936, 920, 826, 687, 596, 586, 579, 488, 340, 222, 154, 90, 13, -13, 53, 161, 222, 220, 223, 264, 293, 248, 153, 89, 94, 144, 215, 318, 430, 493, 492, 478, 489, 513, 538, 583, 640, 688, 722, 772, 854, 949, 1025, 1075, 1113, 1157, 1198, 1208, 1191, 1174, 1159, 1129, 1098, 1100, 1132, 1137, 1098, 1057, 1062, 1095, 1107, 1055, 947, 835, 781, 801, 853, 874, 826, 722, 629, 618, 705, 804, 808, 698, 560, 475, 424, 357, 278, 244, 280, 369, 478, 561, 594, 605, 621, 613, 555, 498, 510, 561, 581, 579, 617, 702, 772, 785, 763, 739, 738, 774, 833, 859, 813, 742, 739, 826, 911, 920, 887, 880, 897, 896, 884, 900, 914, 874, 804, 762, 709, 592, 484, 492, 560, 529, 394, 316, 365, 427, 389, 294, 226, 158, 42, -78, -130, -146, -195, -263, -286, -279, -310, -369, -385, -357, -368, -424, -424, -328, -236, -219, -219, -173, -92, 0, 116, 226, 274, 270, 270, 305, 365, 440, 506, 539, 563, 622, 702, 754, 767, 776, 793, 805, 804, 783, 739, 693, 663, 634, 588, 543, 515, 480, 415, 335, 249, 161, 89, 44, -9, -104, -207, -279, -342, -407, -431, -414, -418, -456, -478, -470, -472, -490, -502, -506, -505, -477, -433, -420, -439, -424, -353, -288, -281, -294, -265, -187, -112, -68, -46, -33, -32, -33, -20, 8, 29, 40, 48, 57, 71, 104, 147, 178, 187, 174, 135, 78, 44, 48, 58, 41, 6, -11, -18, -53, -123, -199, -267, -339, -408, -444, -452, -477, -532, -577, -591, -615, -670, -719, -726, -739, -811, -897, -905, -846, -804, -804, -793, -759, -738, -724, -676, -605, -564, -543, -485, -385, -302, -258, -211, -125, -34, 24, 87, 191, 299, 356, 359, 355, 381, 443, 515, 564, 581, 597, 626, 644, 633, 614, 618, 615, 569, 514, 509, 526, 486, 407, 386, 414, 377, 273, 220, 232, 194, 77, 0, 11, 7, -88, -203, -244, -244, -278, -323, -300, -240, -258, -381, -497, -524, -522, -570, -635, -631, -582, -561, -556, -499, -404, -345, -321, -281, -217, -170, -146, -124, -94, -68, -51, -33, -14, -1, 17, 61, 104, 114, 91, 67, 50, 39, 57, 103, 116, 57, -25, -71, -84, -97, -97, -63, -33, -59, -121, -154, -151, -163, -207, -237, -237, -246, -283, -294, -241, -179, -184, -237, -253, -216, -184, -191, -194, -166, -138, -134, -130, -107, -83, -76, -78, -67, -47, -28, -11, 10, 29, 32, 15, -1, 0, 10, 16, 27, 48, 62, 56, 44, 53, 70, 69, 57, 50, 42, 25, 15, 23, 33, 31, 24, 31, 40, 25, -3, -20, -29, -58, -111, -144, -140, -123, -125, -149, -178, -202, -220, -234, -253, -274, -288, -288, -275, -261, -266, -294, -316, -310, -299, -316, -335, -316, -285, -287, -306, -295, -261, -241, -229, -202, -178, -178, -179, -145, -97, -79, -82, -58, -11, 15, 7, 10, 44, 70, 73, 75, 96, 115, 118, 122, 140, 156, 153, 137, 123, 119, 114, 100, 93, 123, 174, 189, 136, 44, -45, -95, -74, 6, 70, 60, 20, 7, -3, -49, -94, -90, -61, -54, -71, -86, -94, -91, -68, -41, -43, -75, -94, -78, -55, -61, -76, -71, -58, -61, -66, -49, -21, -9, -12, -12, -13, -18, -18, -9, -5, -5, -1, 7, 12, 13, 15, 15, 15, 15, 15, 12, 6, 0, -1, -3, -4, -4, -1, 3, 6, 4, 0, -4, -4, -4, -5, -9, -9, -7, -3, -4, -5, -4, -1, -1, -3, -5, -9, -12, -13, -13, -12, -12, -12, -11, -9, -9, -11, -11, -9, -9, -12, -12, -11, -9, -9, -8, -7, -5, -5, -5, -3, -1, -1, -1, -1, 0, 0, 0, 0, 3, 6, 6, 6, 6, 6, 6, 6, 6, 6, 4, 3, 4, 6, 6, 6, 6, 6, 4, 3, 2, 2, 3, 4, 4, 3, 3, 2, 2, 2, 3, 4, 6, 4, 3, 2, 2, 3, 4, 4, 4, 4, 4, 4, 3, 3, 3, 3, 3, 3, 3, 4, 4, 3, 2, 2, 3, 4, 4, 3, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 0, 2, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 2, 0, 0, 0, 0, 2, 2, 0, 0, 0 };
+// IMA ADPCM blocks, see audio_adpcm.h
+static const uint8_t __in_flash("audio_gps_signal_sample_data") audio_gps_signal_sample_data[] = { 0, 0, 0, 0, 192, 28, 21, 153, 33, 152, 9, 153, 2, 153, 17, 9, 1, 0, 144, 16, 0, 0, 0, 0, 0, 0, 9, 17, 145, 9, 16, 49, 33, 153, 17, 1, 1, 169, 17, 145, 0, 16, 144, 0, 1, 185, 10, 2, 153, 155, 33, 146, 154, 9, 32, 1, 16, 161, 9, 160, 27, 3, 153, 49, 153, 169, 155, 18, 160, 67, 168, 27, 19, 187, 65, 0, 170, 1, 187, 33, 17, 3, 26, 19, 185, 16, 153, 0, 153, 25, 49, 67, 185, 64, 160, 12, 16, 33, 145, 48, 186, 57, 35, 10, 160, 203, 24, 19, 144, 10, 0, 9, 201, 9, 4, 168, 145, 185, 16, 185, 9, 36, 16, 18, 153, 10, 33, 201, 16, 179, 43, 20, 144, 155, 18, 218, 25, 36, 152, 25, 162, 157, 33, 16, 37, 176, 26, 20, 17, 176, 25, 208, 10, 20, 16, 161, 173, 144, 203, 25, 99, 19, 8, 144, 173, 170, 57, 23, 145, 152, 154, 57, 2, 0, 185, 10, 145, 187, 153, 49, 19, 49, 20, 192, 170, 0, 219, 9, 83, 3, 144, 153, 9, 176, 171, 17, 16, 177, 158, 1, 0, 68, 145, 188, 173, 41, 37, 128, 49, 217, 139, 168, 48, 0, 33, 18, 19, 153, 145, 57, 133, 154, 33, 50, 21, 168, 218, 40, 36, 32, 51, 17, 16, 4, 221, 64, 130, 170, 170, 137, 203, 57, 50, 65, 17, 65, 1, 171, 219, 187, 202, 58, 71, 33, 129, 188, 152, 204, 41, 67, 0, 24, 169, 140, 50, 161, 175, 137, 176, 175, 82, 19, 136, 144, 222, 155, 40, 68, 2, 18, 234, 155, 9, 17, 83, 20, 136, 235, 10, 3, 24, 51, 144, 250, 172, 81, 36, 128, 153, 202, 156, 65, 37, 128, 152, 235, 138, 66, 51, 18, 216, 189, 171, 40, 86, 34, 145, 188, 171, 136, 33, 37, 2, 152, 203, 154, 138, 97, 35, 34, 184, 158, 170, 137, 168, 96, 36, 128, 152, 169, 187, 8, 33, 52, 128, 101, 145, 188, 203, 9, 1, 8, 144, 219, 10, 87, 3, 153, 201, 222, 26, 86, 19, 128, 168, 205, 74, 119, 20, 144, 204, 171, 9, 49, 37, 130, 202, 171, 25, 49, 19, 129, 202, 138, 32, 52, 145, 170, 203, 9, 52, 19, 129, 169, 9, 66, 145, 171, 186, 113, 39, 67, 249, 159, 49, 55, 19, 176, 206, 172, 9, 67, 36, 145, 186, 172, 137, 65, 36, 129, 169, 203, 9, 49, 18, 128, 186, 139, 33, 67, 18, 201, 172, 154, 24, 37, 130, 169, 170, 137, 114, 18, 153, 185, 155, 115, 51, 4, 203, 137, 9, 99, 145, 137, 152, 24, 33, 51, 178, 223, 9, 36, 50, 147, 174, 9, 201, 26, 50, 50, 145, 41, 193, 174, 160, 187, 81, 52, 130, 235, 155, 8, 56, 71, 152, 137, 170, 66, 2, 201, 155, 66, 69, 130, 205, 172, 9, 49, 54, 146, 235, 154, 17, 33, 35, 128, 186, 155, 137, 84, 146, 155, 144, 172, 83, 1, 28, 0, 38, 0, 49, 162, 189, 25, 1, 17, 249, 156, 40, 55, 17, 16, 235, 138, 152, 9, 85, 146, 41, 130, 172, 9, 17, 186, 25, 8, 85, 18, 162, 223, 8, 16, 17, 17, 144, 189, 40, 16, 70, 208, 189, 40, 18, 17, 34, 0, 202, 155, 0, 49, 133, 222, 10, 51, 4, 169, 0, 235, 24, 33, 70, 128, 204, 172, 10, 70, 2, 152, 218, 24, 19, 32, 128, 234, 154, 153, 80, 53, 129, 186, 187, 189, 80, 53, 129, 202, 171, 40, 53, 145, 203, 153, 33, 18, 114, 19, 250, 171, 153, 16, 67, 35, 129, 153, 188, 173, 9, 1, 98, 37, 145, 188, 138, 66, 50, 38, 201, 173, 137, 129, 65, 54, 2, 217, 173, 137, 128, 66, 52, 160, 170, 169, 137, 16, 17, 66, 35, 202, 153, 251, 9, 2, 136, 65, 3, 169, 137, 201, 41, 83, 36, 250, 157, 16, 32, 51, 176, 156, 128, 137, 25, 87, 3, 186, 219, 155, 17, 98, 36, 160, 170, 203, 138, 115, 67, 160, 186, 203, 12, 67, 19, 0, 0, 176, 172, 152, 136, 1, 153, 115, 36, 144, 220, 138, 169, 57, 87, 129, 154, 136, 153, 137, 0, 16, 116, 35, 218, 187, 136, 17, 83, 21, 169, 171, 24, 129, 16, 129, 205, 139, 98, 67, 145, 219, 10, 17, 17, 129, 219, 138, 84, 19, 169, 187, 187, 154, 115, 38, 2, 218, 171, 136, 82, 35, 185, 137, 168, 171, 81, 54, 128, 170, 187, 25, 1, 66, 69, 145, 189, 155, 32, 36, 16, 52, 176, 239, 138, 48, 20, 145, 186, 24, 19, 136, 153, 32, 233, 140, 34, 129, 32, 52, 216, 154, 217, 141, 115, 2, 169, 25, 18, 234, 9, 18, 17, 169, 156, 16, 70, 4, 184, 188, 171, 8, 81, 53, 145, 186, 187, 40, 52, 35, 136, 251, 174, 24, 50, 52, 2, 218, 188, 9, 32, 52, 36, 145, 219, 154, 154, 24, 1, 33, 35, 98, 21, 217, 172, 25, 37, 128, 0, 185, 137, 155, 68, 161, 16, 145, 138, 202, 41, 146, 112, 4, 25, 147, 174, 218, 13, 83, 1, 1, 203, 153, 128, 0, 49, 37, 169, 16, 250, 141, 34, 128, 40, 34, 192, 158, 65, 145, 26, 51, 217, 173, 32, 18, 67, 144, 203, 138, 17, 33, 145, 204, 25, 55, 176, 156, 33, 129, 171, 17, 152, 170, 114, 38, 18, 251, 156, 0, 129, 138, 116, 4, 168, 170, 9, 144, 173, 64, 36, 1, 136, 153, 152, 218, 156, 49, 52, 2, 186, 9, 19, 204, 11, 99, 145, 153, 185, 58, 38, 50, 178, 223, 138, 65, 35, 2, 185, 188, 8, 129, 32, 131, 237, 154, 100, 3, 128, 200, 189, 136, 49, 69, 2, 170, 188, 10, 16, 83, 1, 152, 186, 41, 3, 137, 19, 221, 139, 49, 36, 0, 152, 26, 22, 236, 10, 184, 59, 119, 17, 136, 203, 187, 24, 52, 36, 0, 169, 202, 138, 2, 0, 50, 129, 186, 152, 153, 118, 35, 184, 189, 114, 252, 65, 0, 154, 186, 26, 102, 51, 17, 176, 207, 154, 8, 33, 53, 3, 153, 186, 205, 25, 51, 1, 1, 184, 173, 9, 82, 19, 152, 186, 141, 16, 0, 65, 3, 153, 192, 175, 8, 24, 36, 17, 34, 137, 152, 238, 172, 41, 86, 17, 136, 186, 172, 24, 33, 67, 52, 145, 206, 187, 26, 99, 51, 130, 187, 187, 171, 24, 100, 34, 168, 156, 9, 25, 67, 145, 169, 136, 137, 160, 207, 24, 35, 87, 35, 201, 188, 172, 41, 83, 34, 1, 168, 170, 189, 8, 51, 20, 0, 128, 185, 188, 10, 64, 54, 145, 202, 156, 0, 128, 32, 87, 145, 173, 40, 129, 153, 1, 152, 49, 130, 171, 114, 2, 137, 201, 187, 136, 40, 115, 36, 146, 188, 171, 65, 36, 233, 188, 24, 98, 36, 129, 218, 172, 16, 18, 0, 32, 2, 136, 201, 172, 24, 18, 53, 192, 138, 144, 189, 42, 87, 18, 185, 189, 171, 80, 52, 19, 168, 186, 189, 156, 64, 36, 18, 0, 201, 172, 138, 32, 52, 130, 136, 153, 169, 174, 49, 38, 130, 137, 218, 172, 25, 51, 115, 19, 202, 187, 153, 152, 25, 119, 2, 169, 154, 169, 137, 82, 35, 129, 219, 156, 49, 35, 1, 152, 218, 170, 10, 82, 54, 145, 189, 9, 1, 16, 18, 1, 144, 153, 201, 173, 9, 136, 98, 69, 18, 184, 204, 139, 33, 168, 25, 53, 3, 202, 138, 83, 2, 234, 203, 138, 49, 36, 68, 2, 201, 170, 218, 172, 64, 53, 17, 144, 202, 187, 41, 18, 137, 48, 52, 2, 67, 200, 188, 204, 154, 81, 36, 128, 8, 0, 0, 169, 138, 160, 255, 153, 16, 84, 35, 1, 218, 156, 137, 128, 0, 48, 67, 0, 33, 4, 252, 171, 136, 1, 51, 53, 18, 202, 173, 9, 17, 1, 0, 185, 138, 83, 53, 21, 184, 191, 172, 24, 68, 34, 0, 168, 188, 8, 1, 152, 40, 2, 234, 154, 98, 36, 1, 217, 172, 137, 17, 33, 35, 17, 17, 145, 221, 171, 186, 156, 65, 87, 3, 169, 187, 187, 40, 70, 3, 185, 187, 154, 65, 53, 1, 168, 202, 155, 49, 83, 18, 217, 189, 9, 52, 17, 33, 18, 217, 190, 154, 32, 52, 18, 17, 145, 236, 172, 8, 33, 99, 3, 184, 172, 137, 128, 49, 36, 160, 137, 184, 10, 17, 82, 2, 0, 253, 155, 8, 24, 99, 52, 144, 153, 219, 154, 1, 1, 153, 98, 19, 152, 169, 171, 72, 21, 168, 171, 184, 223, 25, 54, 20, 128, 168, 190, 155, 32, 36, 16, 50, 130, 189, 137, 152, 9, 168, 26, 193, 60, 119, 4, 185, 171, 137, 33, 1, 65, 52, 160, 189, 188, 48, 38, 168, 171, 65, 20, 144, 155, 32, 145, 136, 144, 220, 189, 57, 71, 17, 0, 176, 188, 138, 49, 69, 19, 252, 155, 24, 35, 51, 2, 168, 154, 169, 222, 139, 32, 35, 49, 69, 130, 202, 189, 155, 24, 86, 19, 184, 188, 9, 16, 33, 34, 1, 65, 0, 52, 145, 204, 138, 16, 18, 17, 0, 153, 250, 189, 41, 52, 19, 82, 18, 235, 172, 153, 9, 83, 51, 2, 234, 172, 8, 34, 3, 128, 153, 138, 0, 185, 154, 33, 35, 128, 32, 147, 237, 156, 65, 35, 144, 172, 186, 188, 80, 54, 18, 49, 233, 189, 137, 0, 65, 70, 1, 153, 136, 153, 170, 169, 8, 98, 69, 19, 153, 153, 204, 154, 56, 83, 18, 33, 2, 219, 155, 49, 192, 204, 138, 33, 70, 52, 145, 235, 171, 137, 1, 1, 33, 36, 2, 169, 205, 171, 8, 153, 138, 114, 37, 130, 219, 155, 136, 169, 41, 83, 18, 152, 204, 8, 129, 220, 26, 67, 19, 136, 137, 185, 173, 24, 152, 137, 152, 97, 52, 69, 146, 205, 9, 144, 187, 113, 36, 160, 154, 152, 0, 34, 144, 138, 32, 130, 88, 55, 129, 235, 171, 138, 84, 35, 18, 251, 171, 41, 68, 20, 144, 186, 170, 10, 16, 83, 37, 145, 169, 172, 153, 155, 49, 85, 36, 129, 218, 187, 188, 40, 54, 18, 168, 154, 137, 153, 114, 36, 160, 206, 170, 24, 33, 67, 37, 19, 201, 188, 188, 137, 16, 100, 51, 2, 184, 204, 172, 154, 65, 53, 2, 168, 187, 10, 18, 50, 36, 176, 222, 171, 32, 52, 35, 34, 129, 204, 188, 154, 16, 83, 52, 36, 168, 235, 203, 139, 49, 52, 51, 2, 184, 191, 154, 16, 0, 17, 130, 153, 170, 172, 32, 101, 36, 17, 184, 220, 171, 138, 49, 53, 51, 129, 186, 187, 139, 34, 83, 53, 144, 154, 171, 40, 19, 115, 53, 17, 152, 169, 189, 26, 50, 100, 35, 168, 187, 170, 25, 66, 84, 1, 168, 251, 172, 136, 16, 34, 17, 19, 250, 155, 202, 173, 8, 129, 17, 145, 219, 187, 154, 0, 144, 154, 250, 191, 154, 9, 33, 16, 152, 173, 171, 172, 155, 40, 19, 184, 172, 171, 202, 204, 9, 69, 18, 152, 234, 189, 137, 50, 83, 52, 3, 235, 187, 138, 48, 83, 67, 2, 185, 154, 8, 17, 83, 70, 2, 152, 153, 154, 24, 83, 71, 3, 16, 129, 189, 10, 32, 100, 18, 0, 8, 128, 202, 41, 69, 2, 0, 8, 184, 174, 24, 66, 67, 35, 152, 203, 170, 138, 33, 67, 52, 192, 189, 138, 34, 34, 50, 68, 209, 174, 138, 9, 32, 66, 52, 144, 220, 171, 170, 41, 69, 36, 129, 168, 204, 173, 10, 83, 19, 130, 136, 186, 158, 40, 17, 144, 171, 16, 144, 16, 116, 51, 200, 171, 66, 19, 200, 206, 10, 17, 24, 82, 35, 217, 171, 170, 88, 68, 34, 176, 221, 187, 41, 68, 36, 2, 184, 189, 187, 9, 83, 35, 2, 153, 170, 154, 64, 53, 17, 186, 206, 186, 138, 66, 52, 51, 130, 251, 203, 187, 139, 49, 70, 67, 17, 152, 202, 189, 138, 33, 34, 83, 19, 168, 154, 153, 32, 51, 53, 130, 219, 154, 99, 35, 82, 20, 153, 136, 186, 25, 50, 100, 53, 223, 71, 60, 0, 2, 169, 170, 170, 136, 65, 69, 19, 185, 155, 219, 138, 33, 50, 20, 200, 188, 170, 205, 137, 129, 185, 153, 184, 236, 187, 170, 136, 8, 217, 190, 189, 156, 136, 136, 17, 152, 204, 187, 205, 154, 24, 128, 170, 153, 169, 187, 173, 137, 220, 186, 203, 10, 50, 201, 57, 39, 145, 172, 138, 235, 155, 80, 51, 160, 40, 19, 219, 56, 54, 1, 33, 19, 186, 11, 67, 50, 87, 37, 1, 33, 18, 152, 8, 17, 66, 54, 18, 83, 35, 34, 52, 1, 16, 144, 48, 68, 84, 51, 66, 51, 144, 171, 16, 18, 99, 83, 36, 17, 129, 153, 217, 173, 32, 128, 97, 51, 2, 152, 186, 239, 138, 8, 8, 33, 34, 128, 169, 203, 236, 155, 8, 8, 34, 128, 8, 129, 171, 217, 207, 40, 161, 139, 69, 161, 137, 18, 169, 169, 24, 131, 223, 8, 128, 10, 115, 147, 203, 154, 153, 8, 100, 51, 160, 190, 138, 235, 11, 36, 1, 49, 130, 205, 170, 153, 152, 9, 116, 130, 203, 9, 129, 170, 64, 35, 192, 207, 10, 2, 16, 69, 2, 168, 169, 188, 154, 16, 68, 3, 25, 2, 219, 56, 53, 160, 187, 254, 205, 170, 24, 98, 68, 36, 1, 185, 205, 171, 138, 48, 68, 51, 19, 152, 202, 154, 138, 48, 50, 34, 128, 154, 72, 70, 34, 51, 19, 202, 188, 139, 17, 52, 71, 18, 152, 138, 154, 138, 98, 36, 128, 168, 205, 186, 138, 49, 37, 35, 130, 251, 172, 171, 154, 8, 16, 136, 0, 184, 188, 187, 203, 221, 187, 204, 170, 136, 50, 2, 145, 251, 205, 187, 153, 136, 33, 2, 168, 219, 188, 154, 153, 8, 128, 169, 188, 170, 186, 138, 136, 10, 33, 17, 83, 192, 157, 52, 176, 9, 18, 87, 67, 68, 35, 35, 18, 128, 8, 137, 81, 86, 68, 51, 51, 36, 145, 137, 136, 137, 114, 85, 34, 34, 51, 129, 169, 25, 35, 16, 85, 36, 17, 34, 50, 50, 52, 129, 137, 152, 170, 16, 87, 53, 18, 17, 168, 189, 154, 8, 52, 146, 154, 219, 205, 137, 32, 84, 34, 144, 234, 188, 173, 154, 24, 49, 68, 18, 1, 152, 220, 203, 154, 154, 138, 64, 35, 67, 35, 18, 234, 173, 170, 203, 138, 34, 18, 50, 0, 16, 202, 155, 33, 249, 143, 144, 171, 17, 169, 136, 65, 20, 136, 83, 145, 221, 188, 170, 156, 40, 69, 52, 1, 137, 153, 218, 173, 8, 0, 0, 8, 50, 129, 113, 36, 128, 128, 250, 172, 8, 8, 99, 35, 18, 130, 188, 9, 184, 41, 71, 145, 220, 186, 204, 154, 49, 87, 51, 19, 145, 235, 188, 155, 137, 50, 54, 51, 34, 128, 169, 171, 153, 152, 0, 128, 33, 54, 85, 52, 34, 33, 184, 205, 171, 136, 16, 84, 67, 17, 137, 137, 169, 171, 48, 177, 173, 203, 187, 10, 48, 70, 2, 160, 251, 219, 171, 170, 169, 0, 128, 169, 154, 170, 173, 170, 140, 3, 45, 0, 221, 204, 203, 171, 154, 40, 50, 35, 184, 237, 204, 155, 153, 153, 17, 130, 153, 137, 1, 144, 202, 170, 238, 188, 137, 0, 33, 83, 51, 18, 1, 169, 189, 187, 153, 41, 87, 50, 49, 67, 35, 16, 34, 17, 34, 202, 104, 69, 18, 82, 36, 18, 17, 50, 19, 0, 50, 18, 65, 87, 67, 34, 33, 1, 153, 153, 32, 70, 34, 50, 20, 153, 72, 20, 168, 41, 36, 200, 187, 25, 34, 24, 118, 2, 153, 202, 172, 169, 155, 82, 18, 136, 169, 218, 205, 138, 128, 0, 1, 169, 8, 251, 171, 155, 16, 16, 100, 129, 171, 154, 201, 174, 64, 3, 0, 67, 161, 170, 128, 9, 69, 1, 98, 146, 219, 9, 18, 9, 100, 2, 168, 219, 9, 18, 16, 85, 3, 187, 155, 152, 26, 18, 88, 5, 236, 154, 128, 144, 57, 22, 9, 129, 190, 40, 162, 159, 32, 160, 141, 49, 129, 137, 8, 216, 205, 138, 34, 33, 66, 21, 136, 8, 218, 154, 40, 129, 40, 34, 17, 233, 42, 39, 193, 190, 188, 205, 138, 65, 53, 53, 51, 160, 219, 204, 171, 8, 65, 52, 51, 51, 152, 188, 153, 152, 24, 36, 1, 17, 49, 71, 18, 82, 18, 169, 173, 153, 154, 81, 52, 52, 17, 136, 185, 190, 26, 17, 8, 33, 185, 190, 154, 8, 50, 35, 161, 253, 189, 170, 186, 137, 16, 160, 171, 185, 191, 171, 154, 202, 205, 187, 189, 170, 138, 48, 20, 16, 250, 188, 188, 171, 154, 17, 2, 17, 128, 153, 153, 169, 219, 190, 189, 171, 154, 64, 52, 68, 50, 1, 168, 188, 172, 138, 32, 82, 84, 35, 18, 50, 35, 1, 0, 0, 8, 48, 103, 68, 51, 36, 34, 17, 145, 8, 34, 136, 115, 67, 52, 52, 66, 18, 128, 154, 153, 171, 64, 54, 51, 34, 82, 52, 160, 154, 128, 218, 186, 172, 64, 35, 68, 66, 1, 170, 216, 175, 136, 153, 24, 51, 129, 25, 146, 187, 201, 175, 0, 168, 203, 155, 32, 18, 51, 83, 21, 235, 138, 168, 56, 3, 8, 2, 137, 64, 87, 51, 1, 8, 0, 236, 9, 34, 18, 160, 27, 38, 136, 17, 136, 184, 191, 128, 203, 56, 133, 154, 1, 157, 16, 154, 18, 255, 15, 144, 137, 17, 152, 137, 152, 171, 139, 64, 21, 185, 40, 240, 207, 136, 8, 24, 66, 51, 160, 173, 170, 189, 57, 54, 18, 16, 136, 202, 172, 25, 100, 2, 17, 2, 203, 154, 153, 49, 160, 155, 251, 255, 137, 8, 84, 36, 34, 0, 185, 206, 187, 9, 50, 52, 69, 17, 152, 137, 152, 154, 40, 2, 152, 17, 8, 85, 52, 69, 129, 138, 169, 174, 154, 40, 67, 66, 67, 145, 203, 154, 168, 170, 24, 18, 233, 156, 0, 136, 49, 51, 217, 205, 203, 171, 171, 16, 1, 136, 170, 205, 187, 16, 144, 169, 234, 207, 172, 154, 9, 51, 51, 18, 202, 220, 172, 154, 24, 128, 136, 17, 62, 173, 50, 0, 218, 10, 53, 19, 0, 169, 205, 204, 138, 16, 66, 51, 36, 19, 144, 154, 172, 139, 137, 40, 87, 19, 34, 52, 18, 1, 18, 168, 154, 24, 54, 99, 69, 50, 18, 49, 4, 170, 17, 128, 168, 112, 52, 66, 68, 18, 152, 153, 186, 172, 64, 37, 16, 35, 145, 153, 9, 100, 177, 140, 129, 205, 10, 18, 33, 54, 17, 169, 205, 154, 203, 25, 35, 18, 34, 144, 204, 156, 24, 128, 136, 153, 186, 207, 41, 34, 83, 20, 128, 185, 189, 138, 24, 50, 68, 3, 128, 137, 32, 49, 71, 2, 128, 250, 10, 144, 56, 55, 18, 17, 145, 189, 186, 156, 1, 9, 69, 130, 0, 144, 171, 204, 171, 8, 251, 10, 131, 156, 115, 129, 24, 176, 191, 186, 172, 25, 0, 97, 19, 8, 1, 202, 203, 173, 138, 186, 42, 84, 34, 50, 163, 171, 251, 138, 169, 72, 22, 1, 33, 145, 138, 34, 144, 56, 37, 8, 128, 205, 96, 19, 8, 192, 223, 203, 172, 24, 82, 71, 51, 33, 168, 205, 187, 172, 8, 83, 36, 35, 18, 168, 170, 186, 137, 136, 9, 32, 136, 113, 69, 52, 34, 129, 234, 203, 186, 154, 49, 69, 50, 18, 129, 235, 170, 168, 155, 9, 136, 153, 137, 34, 50, 32, 131, 255, 157, 186, 171, 16, 1, 138, 160, 220, 187, 10, 35, 137, 49, 252, 190, 170, 153, 10, 51, 51, 160, 156, 184, 189, 9, 129, 219, 203, 187, 139, 65, 71, 35, 17, 152, 204, 187, 170, 137, 64, 52, 67, 34, 67, 18, 145, 153, 250, 173, 24, 33, 67, 69, 36, 1, 8, 168, 170, 10, 66, 51, 99, 52, 2, 48, 19, 136, 128, 128, 217, 57, 71, 1, 83, 35, 144, 154, 153, 203, 139, 84, 1, 80, 20, 153, 138, 16, 217, 139, 16, 161, 173, 51, 161, 152, 114, 162, 174, 152, 171, 169, 8, 33, 34, 51, 208, 175, 153, 169, 154, 40, 51, 192, 155, 250, 155, 50, 33, 71, 19, 152, 138, 219, 155, 25, 101, 3, 0, 34, 169, 10, 67, 34, 69, 128, 169, 206, 137, 0, 82, 52, 19, 160, 204, 188, 154, 32, 67, 36, 129, 201, 203, 154, 8, 65, 37, 185, 186, 221, 154, 0, 49, 37, 0, 128, 222, 154, 168, 9, 51, 35, 2, 185, 188, 191, 10, 19, 49, 53, 145, 235, 171, 185, 10, 84, 69, 1, 16, 145, 205, 137, 145, 10, 68, 129, 34, 145, 26, 18, 137, 17, 254, 172, 235, 170, 32, 69, 54, 36, 18, 169, 219, 188, 171, 25, 66, 53, 51, 19, 0, 152, 169, 154, 202, 173, 170, 10, 99, 99, 52, 34, 1, 169, 221, 170, 170, 9, 66, 51, 51, 2, 168, 203, 189, 186, 187, 170, 172, 137, 8, 68, 19, 1, 185, 207, 188, 171, 138, 137, 16, 144, 186, 220, 153, 153, 25, 19, 169, 235, 189, 203, 170, 9, 0, 136, 136, 0, 17, 82, 37, 144, 218, 190, 171, 171, 48, 53, 52, 35, 177, 50, 0, 52, 18, 1, 144, 138, 185, 158, 128, 9, 68, 66, 54, 34, 34, 34, 17, 136, 136, 33, 51, 102, 35, 98, 35, 32, 35, 18, 17, 80, 38, 17, 51, 36, 152, 137, 153, 66, 83, 71, 18, 18, 8, 129, 188, 16, 152, 137, 136, 34, 49, 103, 35, 35, 16, 248, 188, 170, 173, 8, 17, 50, 82, 19, 154, 144, 175, 170, 203, 137, 153, 10, 83, 130, 48, 4, 185, 203, 173, 186, 172, 41, 34, 33, 85, 2, 128, 0, 217, 171, 9, 33, 50, 87, 34, 32, 129, 153, 188, 188, 11, 17, 24, 87, 130, 32, 17, 154, 137, 152, 171, 169, 204, 9, 169, 74, 39, 129, 17, 248, 189, 171, 204, 9, 50, 83, 20, 144, 137, 234, 156, 8, 152, 32, 18, 128, 8, 169, 72, 36, 67, 2, 218, 188, 170, 155, 101, 51, 67, 35, 168, 171, 188, 11, 34, 83, 36, 128, 25, 66, 83, 101, 51, 19, 17, 168, 172, 137, 154, 40, 17, 24, 129, 137, 87, 34, 67, 52, 145, 205, 203, 186, 137, 98, 53, 36, 19, 1, 202, 187, 171, 170, 9, 51, 50, 69, 18, 66, 3, 24, 2, 238, 154, 169, 203, 138, 49, 50, 84, 18, 128, 201, 204, 203, 189, 186, 169, 153, 24, 18, 8, 0, 251, 174, 170, 188, 170, 186, 155, 168, 188, 170, 204, 203, 187, 203, 170, 153, 153, 152, 203, 188, 221, 203, 187, 186, 187, 9, 34, 1, 1, 168, 221, 171, 169, 188, 169, 169, 169, 155, 67, 2, 83, 146, 220, 155, 137, 10, 101, 35, 83, 53, 18, 34, 160, 171, 217, 157, 8, 66, 69, 83, 35, 34, 34, 136, 32, 168, 139, 0, 33, 69, 67, 53, 51, 53, 35, 50, 20, 1, 17, 152, 49, 99, 20, 82, 51, 34, 130, 25, 2, 65, 85, 67, 67, 36, 18, 144, 128, 185, 137, 0, 49, 70, 52, 51, 38, 2, 50, 129, 138, 152, 218, 10, 65, 67, 66, 68, 51, 33, 17, 130, 188, 188, 186, 138, 84, 53, 52, 51, 52, 2, 0, 160, 169, 202, 154, 16, 100, 68, 52, 50, 51, 130, 187, 24, 251, 142, 33, 18, 68, 35, 34, 144, 9, 185, 26, 33, 70, 161, 48, 1, 32, 49, 87, 51, 128, 152, 201, 188, 138, 66, 37, 68, 37, 0, 152, 202, 138, 186, 137, 168, 25, 169, 32, 67, 68, 67, 146, 170, 253, 172, 171, 156, 8, 153, 17, 128, 17, 200, 154, 202, 188, 204, 172, 235, 171, 169, 9, 49, 33, 18, 152, 250, 191, 156, 170, 154, 136, 9, 176, 172, 168, 188, 185, 171, 170, 252, 188, 201, 204, 153, 169, 154, 169, 154, 186, 187, 152, 188, 186, 207, 154, 186, 139, 16, 0, 32, 36, 152, 0, 203, 251, 173, 136, 186, 137, 0, 20, 154, 98, 18, 67, 128, 17, 144, 237, 187, 172, 25, 16, 85, 18, 83, 19, 17, 216, 154, 251, 138, 184, 56, 36, 65, 67, 35, 16, 144, 155, 161, 223, 24, 144, 91, 249, 28, 0, 32, 34, 82, 67, 52, 17, 35, 160, 156, 186, 173, 8, 17, 66, 84, 52, 17, 66, 160, 8, 248, 155, 168, 171, 32, 16, 16, 168, 48, 193, 142, 234, 171, 202, 189, 169, 154, 9, 129, 16, 176, 204, 220, 203, 220, 170, 186, 138, 33, 152, 8, 177, 159, 186, 191, 154, 186, 137, 155, 33, 137, 20, 24, 52, 202, 170, 188, 138, 137, 100, 19, 33, 55, 129, 24, 36, 18, 17, 67, 35, 17, 66, 83, 67, 66, 51, 68, 37, 128, 40, 67, 51, 68, 36, 34, 17, 48, 53, 51, 68, 52, 19, 66, 18, 52, 35, 115, 2, 16, 33, 17, 50, 55, 66, 67, 18, 34, 130, 136, 136, 17, 85, 53, 18, 35, 17, 18, 128, 34, 49, 210, 142, 18, 156, 49, 52, 53, 129, 8, 18, 176, 172, 9, 65, 200, 10, 35, 32, 19, 113, 71, 17, 129, 138, 144, 188, 186, 104, 37, 49, 67, 50, 160, 157, 9, 0, 65, 35, 18, 52, 35, 51, 2, 116, 4, 138, 128, 10, 51, 130, 49, 52, 160, 236, 155, 8, 17, 218, 189, 155, 169, 223, 9, 200, 138, 185, 158, 153, 203, 138, 185, 172, 188, 171, 170, 206, 171, 168, 188, 186, 172, 152, 170, 203, 172, 169, 190, 154, 185, 137, 153, 64, 37, 184, 141, 168, 206, 153, 152, 153, 16, 34, 146, 172, 66, 200, 139, 218, 25, 216, 156, 153, 155, 49, 2, 9, 52, 193, 189, 171, 144, 237, 154, 152, 137, 136, 82, 35, 153, 137, 185, 207, 24, 201, 9, 216, 156, 168, 26, 35, 8, 19, 251, 10, 200, 156, 160, 174, 144, 189, 9, 128, 155, 128, 217, 10, 249, 156, 168, 156, 9, 185, 137, 130, 173, 1, 207, 0, 185, 138, 168, 170, 81, 162, 138, 146, 11, 53, 160, 8, 65, 148, 189, 115, 147, 26, 22, 152, 115, 145, 26, 51, 145, 153, 48, 20, 66, 18, 68, 4, 34, 161, 58, 135, 155, 36, 16, 36, 1, 36, 0, 68, 185, 26, 16, 192, 42, 6, 171, 51, 161, 171, 219, 12, 2, 189, 186, 158, 136, 185, 186, 0, 249, 28, 4, 188, 138, 137, 219, 154, 176, 172, 128, 204, 9, 32, 249, 139, 145, 156, 232, 140, 144, 155, 144, 155, 161, 175, 18, 8, 2, 40, 133, 156, 130, 158, 50, 145, 50, 136, 69, 50, 4, 56, 39, 1, 33, 66, 36, 51, 36, 67, 51, 19, 97, 36, 33, 35, 68, 35, 83, 37, 2, 49, 51, 68, 2, 48, 19, 66, 51, 53, 32, 71, 50, 147, 172, 152, 155, 160, 88, 54, 33, 34, 50, 145, 188, 9, 18, 249, 157, 153, 137, 33, 33, 36, 1, 153, 220, 188, 187, 138, 186, 57, 21, 136, 8, 1, 239, 170, 169, 8, 200, 138, 152, 9, 50, 35, 176, 251, 158, 32, 2, 136, 65, 161, 72, 52, 2, 64, 54, 0, 67, 144, 32, 54, 168, 40, 130, 24, 117, 19, 8, 83, 146, 173, 49, 179, 141, 3, 171, 49, 82, 3, 13, 0, 162, 10, 99, 37, 201, 139, 18, 185, 154, 8, 253, 155, 48, 145, 42, 148, 172, 1, 220, 153, 171, 32, 168, 171, 8, 240, 190, 137, 153, 153, 219, 154, 234, 187, 137, 144, 154, 1, 252, 170, 201, 173, 136, 170, 10, 144, 156, 1, 203, 41, 249, 173, 136, 186, 170, 138, 52, 185, 33, 220, 40, 232, 139, 146, 189, 10, 144, 0, 169, 40, 147, 11, 103, 17, 1, 200, 138, 3, 203, 97, 36, 129, 24, 19, 153, 9, 70, 201, 41, 179, 28, 68, 136, 49, 128, 32, 128, 24, 220, 56, 146, 11, 200, 155, 33, 224, 104, 3, 171, 136, 144, 201, 137, 251, 155, 186, 97, 249, 73, 131, 139, 35, 137, 160, 156, 129, 205, 32, 130, 170, 152, 187, 115, 180, 29, 22, 153, 0, 171, 18, 9, 35, 32, 55, 16, 34, 187, 16, 185, 65, 0, 71, 129, 114, 18, 8, 9, 99, 144, 80, 2, 9, 65, 1, 16, 16, 49, 146, 25, 3, 90, 148, 73, 71, 17, 201, 42, 208, 27, 18, 170, 114, 2, 64, 147, 139, 178, 191, 0, 153, 2, 156, 34, 40, 23, 40, 131, 156, 145, 154, 202, 112, 162, 59, 133, 138, 21, 9, 129, 26, 147, 159, 33, 1, 17, 161, 58, 22, 10, 33, 68, 193, 27, 179, 30, 53, 17, 208, 73, 133, 140, 18, 136, 50, 136, 115, 18, 128, 170, 18, 9, 176, 44, 23, 136, 83, 19, 169, 9, 8, 18, 82, 20, 16, 160, 141, 35, 168, 144, 10, 177, 159, 147, 60, 150, 140, 128, 56, 249, 27, 146, 154, 153, 82, 193, 156, 184, 157, 0, 9, 168, 57, 55, 177, 140, 162, 158, 1, 27, 20, 202, 138, 32, 33, 52, 233, 10, 201, 96, 147, 25, 209, 57, 178, 141, 16, 8, 128, 48, 2, 100, 130, 9, 184, 25, 249, 74, 21, 170, 98, 161, 138, 8, 83, 176, 10, 252, 43, 131, 156, 129, 156, 17, 153, 1, 32, 1, 136, 152, 217, 174, 138, 152, 170, 115, 145, 48, 146, 203, 190, 26, 129, 154, 16, 66, 52, 145, 234, 191, 56, 160, 155, 10, 1, 172, 185, 143, 36, 236, 24, 160, 40, 176, 140, 34, 202, 156, 8, 176, 140, 51, 200, 171, 24, 225, 12, 5, 173, 49, 200, 24, 184, 57, 3, 24, 240, 10, 130, 169, 65, 147, 26, 20, 206, 40, 36, 129, 171, 40, 82, 176, 158, 136, 66, 232, 74, 36, 200, 138, 3, 188, 33, 160, 80, 18, 185, 138, 34, 201, 57, 54, 161, 155, 187, 106, 178, 158, 33, 2, 16, 200, 173, 16, 169, 41, 144, 25, 1, 119, 160, 24, 161, 74, 4, 189, 41, 163, 141, 115, 131, 139, 66, 216, 138, 144, 32, 35, 34, 169, 104, 148, 141, 51, 168, 48, 1, 18, 82, 147, 120, 132, 153, 188, 113, 132, 136, 129, 154, 24, 0, 1, 49, 53, 129, 202, 41, 3, 56, 182, 15, 4, 8, 177, 158, 1, 17, 32, 39, 188, 65, 160, 139, 40, 0, 19, 0, 0, 50, 160, 152, 171, 51, 206, 114, 132, 136, 169, 26, 162, 27, 194, 187, 12, 71, 152, 67, 136, 176, 158, 129, 8, 131, 56, 178, 156, 138, 55, 137, 146, 191, 2, 139, 145, 173, 49, 36, 169, 117, 4, 169, 187, 40, 192, 41, 18, 100, 161, 140, 2, 17, 130, 27, 20, 138, 20, 16, 193, 191, 8, 185, 96, 5, 16, 3, 155, 177, 29, 5, 203, 137, 137, 8, 51, 144, 171, 25, 128, 189, 33, 233, 58, 240, 191, 0, 9, 52, 152, 81, 192, 42, 131, 73, 22, 137, 168, 172, 114, 103, 35, 0, 48, 147, 223, 154, 185, 32, 131, 42, 21, 138, 52, 68, 4, 152, 185, 207, 9, 1, 0, 128, 152, 173, 48, 130, 40, 3, 186, 188, 41, 209, 171, 144, 189, 56, 35, 137, 66, 144, 24, 116, 20, 218, 171, 203, 10, 50, 19, 0, 36, 202, 112, 37, 128, 144, 205, 11, 65, 68, 145, 187, 154, 24, 82, 53, 51, 200, 188, 186, 41, 3, 153, 236, 139, 49, 102, 18, 136, 152, 136, 49, 2, 201, 206, 138, 0, 33, 36, 129, 234, 172, 128, 8, 34, 1, 24, 18, 154, 1, 218, 235, 188, 153, 41, 130, 155, 17, 24, 119, 19, 32, 178, 223, 153, 24, 84, 3, 169, 203, 171, 65, 34, 34, 129, 154, 115, 20, 17, 200, 173, 138, 16, 35, 33, 178, 174, 138, 64, 51, 34, 145, 235, 27, 55, 130, 1, 0, 251, 172, 153, 139, 24, 33, 68, 51, 145, 8, 216, 156, 186, 27, 1, 41, 39, 1, 8, 16, 33, 251, 10, 217, 57, 36, 3, 223, 9, 137, 34, 56, 71, 0, 136, 188, 137, 153, 24, 144, 189, 48, 52, 82, 51, 1, 251, 174, 169, 136, 17, 33, 18, 16, 52, 161, 139, 176, 159, 17, 3, 40, 70, 128, 24, 249, 139, 24, 48, 20, 136, 114, 19, 33, 161, 223, 171, 172, 137, 65, 52, 50, 51, 18, 219, 171, 188, 153, 171, 115, 19, 50, 22, 168, 138, 185, 27, 18, 136, 2, 9, 53, 128, 185, 223, 186, 203, 89, 53, 34, 35, 160, 186, 222, 154, 203, 139, 1, 65, 53, 35, 17, 152, 188, 170, 187, 138, 153, 65, 2, 65, 54, 129, 170, 186, 191, 8, 34, 50, 34, 130, 207, 24, 161, 10, 99, 18, 33, 17, 145, 204, 169, 223, 136, 0, 18, 56, 71, 1, 1, 170, 203, 187, 153, 9, 34, 100, 36, 128, 0, 160, 189, 139, 154, 24, 16, 55, 128, 50, 2, 168, 237, 154, 137, 48, 68, 18, 184, 154, 160, 189, 25, 33, 67, 176, 187, 32, 51, 65, 6, 203, 128, 190, 80, 35, 128, 17, 218, 155, 217, 191, 24, 34, 100, 20, 17, 184, 171, 202, 171, 170, 64, 51, 100, 3, 153, 128, 201, 170, 185, 156, 98, 19, 48, 19, 201, 220, 171, 16, 18, 2, 56, 4, 155, 54, 185, 56, 208, 173, 33, 192, 10, 128, 41, 69, 53, 128, 0, 185, 189, 137, 144, 28, 250, 51, 0, 172, 40, 53, 18, 16, 48, 4, 189, 186, 74, 38, 201, 137, 168, 25, 52, 24, 146, 141, 3, 189, 16, 128, 185, 120, 6, 153, 49, 145, 153, 221, 138, 17, 56, 39, 34, 19, 202, 204, 172, 8, 49, 35, 17, 3, 188, 136, 152, 187, 41, 54, 18, 152, 249, 174, 40, 53, 18, 152, 187, 189, 138, 67, 35, 136, 137, 251, 12, 2, 80, 53, 144, 128, 203, 139, 152, 137, 17, 33, 52, 19, 50, 64, 55, 233, 138, 235, 26, 145, 138, 18, 25, 86, 2, 136, 161, 173, 8, 32, 161, 191, 153, 9, 99, 50, 3, 137, 17, 202, 56, 146, 190, 139, 168, 173, 98, 18, 16, 0, 99, 130, 137, 233, 190, 171, 41, 54, 33, 50, 144, 186, 204, 170, 188, 40, 53, 1, 48, 3, 136, 82, 19, 168, 235, 188, 170, 8, 128, 64, 53, 129, 153, 25, 100, 18, 33, 176, 190, 203, 155, 16, 50, 17, 100, 145, 9, 33, 115, 4, 185, 219, 204, 138, 24, 82, 36, 17, 144, 186, 173, 170, 24, 66, 2, 137, 136, 168, 9, 35, 176, 223, 154, 136, 116, 3, 0, 8, 17, 224, 188, 24, 129, 9, 16, 50, 70, 2, 200, 173, 8, 16, 51, 17, 160, 139, 71, 146, 235, 173, 10, 34, 68, 34, 129, 202, 186, 170, 153, 8, 50, 54, 36, 130, 137, 129, 237, 138, 128, 16, 129, 24, 19, 98, 3, 172, 202, 175, 24, 33, 49, 83, 145, 186, 138, 32, 130, 171, 249, 174, 8, 0, 84, 145, 40, 129, 137, 129, 189, 171, 0, 128, 115, 133, 185, 171, 33, 17, 87, 3, 169, 219, 170, 152, 138, 33, 100, 19, 16, 67, 128, 170, 188, 221, 139, 136, 80, 36, 33, 129, 136, 152, 185, 138, 83, 1, 136, 144, 223, 187, 186, 139, 69, 52, 53, 17, 152, 218, 170, 137, 169, 203, 9, 0, 114, 21, 17, 160, 9, 145, 155, 128, 186, 40, 54, 201, 155, 168, 140, 51, 48, 119, 21, 128, 186, 187, 187, 26, 37, 8, 67, 2, 16, 145, 186, 239, 154, 50, 51, 2, 218, 171, 154, 48, 70, 35, 129, 185, 189, 170, 16, 67, 2, 17, 234, 138, 129, 115, 4, 170, 144, 222, 9, 18, 48, 37, 128, 137, 203, 139, 8, 24, 128, 26, 69, 19, 18, 18, 144, 234, 189, 186, 203, 40, 67, 101, 20, 129, 186, 171, 170, 136, 152, 170, 191, 72, 85, 35, 129, 169, 204, 171, 8, 137, 8, 115, 51, 50, 129, 220, 154, 169, 154, 9, 49, 37, 18, 51, 35, 161, 205, 220, 189, 26, 83, 36, 2, 168, 203, 8, 66, 130, 219, 187, 138, 48, 68, 52, 2, 137, 184, 173, 153, 187, 65, 52, 129, 171, 152, 207, 155, 64, 38, 18, 17, 217, 154, 16, 17, 129, 202, 190, 139, 50, 70, 20, 129, 185, 173, 136, 8, 17, 32, 128, 9, 21, 184, 170, 173, 57, 86, 18, 153, 154, 138, 49, 4, 186, 206, 140, 64, 36, 51, 241, 23, 59, 0, 130, 185, 220, 188, 137, 32, 66, 68, 129, 170, 136, 9, 50, 176, 206, 137, 136, 97, 19, 152, 186, 170, 136, 32, 1, 82, 71, 130, 169, 219, 188, 154, 8, 113, 37, 2, 160, 203, 169, 137, 18, 152, 136, 186, 113, 53, 35, 152, 203, 155, 184, 138, 145, 156, 100, 51, 36, 129, 185, 187, 8, 0, 177, 175, 168, 157, 100, 51, 1, 201, 155, 0, 137, 0, 168, 153, 9, 86, 2, 0, 219, 41, 18, 49, 192, 206, 187, 56, 70, 18, 201, 170, 171, 25, 67, 36, 144, 152, 152, 137, 17, 194, 255, 10, 34, 35, 2, 169, 185, 157, 66, 1, 129, 202, 25, 16, 84, 131, 186, 191, 41, 35, 49, 22, 186, 154, 8, 17, 170, 8, 172, 115, 4, 33, 144, 154, 185, 172, 154, 219, 57, 71, 33, 2, 169, 202, 187, 235, 156, 49, 50, 52, 128, 169, 40, 145, 41, 241, 175, 170, 10, 68, 52, 20, 152, 185, 188, 154, 48, 2, 49, 4, 152, 137, 82, 163, 174, 138, 72, 55, 17, 0, 169, 153, 235, 41, 129, 156, 0, 56, 54, 67, 18, 201, 172, 169, 186, 24, 34, 201, 89, 39, 129, 137, 152, 187, 11, 102, 2, 137, 184, 158, 8, 153, 48, 82, 36, 145, 203, 174, 9, 136, 56, 36, 136, 152, 186, 169, 154, 66, 4, 160, 204, 57, 39, 19, 200, 205, 186, 10, 50, 34, 69, 35, 144, 188, 153, 203, 10, 17, 84, 130, 171, 202, 139, 84, 36, 145, 9, 161, 190, 137, 16, 50, 18, 52, 33, 33, 153, 187, 223, 169, 24, 55, 129, 81, 37, 145, 185, 189, 156, 8, 16, 53, 2, 16, 34, 51, 131, 220, 203, 186, 156, 65, 34, 52, 18, 16, 1, 0, 200, 189, 170, 201, 188, 25, 0, 113, 55, 18, 144, 186, 204, 203, 137, 51, 34, 50, 160, 221, 138, 65, 35, 145, 205, 154, 187, 41, 36, 1, 33, 51, 192, 203, 235, 172, 137, 64, 37, 129, 185, 189, 170, 26, 52, 50, 34, 169, 205, 154, 17, 2, 170, 34, 202, 41, 36, 0, 66, 1, 66, 129, 235, 206, 9, 82, 52, 130, 137, 136, 221, 25, 18, 24, 68, 128, 25, 18, 136, 99, 2, 154, 128, 204, 40, 36, 34, 99, 35, 160, 186, 186, 153, 82, 55, 1, 137, 219, 156, 16, 16, 66, 50, 130, 218, 189, 154, 0, 168, 12, 34, 204, 138, 48, 20, 168, 219, 172, 188, 173, 9, 33, 51, 4, 202, 205, 187, 170, 138, 18, 218, 41, 17, 50, 131, 221, 187, 188, 190, 137, 33, 36, 36, 145, 187, 172, 138, 18, 16, 51, 145, 251, 173, 24, 64, 53, 1, 49, 177, 189, 139, 16, 136, 115, 34, 67, 35, 176, 28, 23, 185, 41, 35, 152, 96, 53, 3, 9, 152, 205, 24, 66, 67, 20, 152, 152, 188, 41, 37, 17, 145, 140, 84, 130, 138, 115, 2, 17, 184, 175, 153, 170, 24, 68, 52, 37, 128, 152, 170, 154, 218, 187, 221, 254, 47, 0, 41, 38, 16, 116, 35, 36, 160, 206, 186, 170, 16, 82, 52, 51, 2, 218, 203, 170, 8, 67, 19, 17, 144, 204, 155, 16, 49, 55, 130, 138, 137, 235, 187, 8, 18, 83, 52, 129, 136, 186, 190, 171, 153, 49, 20, 152, 115, 38, 144, 154, 186, 188, 187, 41, 131, 88, 39, 136, 136, 202, 187, 9, 170, 113, 20, 152, 153, 186, 187, 48, 18, 115, 20, 170, 169, 187, 154, 34, 82, 51, 50, 52, 201, 156, 16, 16, 54, 160, 9, 137, 81, 70, 35, 16, 1, 185, 190, 40, 37, 33, 51, 176, 158, 153, 11, 55, 2, 51, 200, 173, 170, 171, 42, 70, 128, 137, 168, 189, 139, 1, 24, 130, 191, 154, 220, 153, 136, 128, 0, 160, 220, 205, 138, 144, 137, 2, 169, 186, 190, 153, 186, 32, 132, 190, 136, 219, 25, 8, 32, 17, 1, 205, 8, 218, 138, 35, 0, 32, 38, 217, 26, 3, 115, 4, 24, 144, 158, 16, 34, 51, 16, 51, 83, 192, 112, 5, 10, 36, 184, 8, 152, 99, 131, 56, 37, 144, 137, 9, 0, 169, 115, 23, 137, 32, 129, 137, 0, 33, 145, 156, 50, 178, 141, 37, 129, 152, 140, 50, 168, 12, 71, 160, 156, 9, 136, 169, 98, 19, 187, 139, 128, 185, 172, 81, 131, 41, 132, 173, 16, 203, 98, 177, 140, 52, 176, 26, 19, 81, 132, 154, 3, 207, 41, 51, 67, 19, 8, 184, 207, 64, 3, 137, 24, 98, 146, 174, 33, 17, 18, 136, 53, 200, 189, 25, 145, 43, 119, 1, 129, 187, 9, 217, 138, 83, 18, 33, 1, 169, 172, 186, 137, 36, 129, 32, 200, 26, 35, 118, 20, 153, 170, 154, 251, 139, 52, 1, 2, 184, 220, 187, 153, 16, 53, 53, 2, 202, 235, 171, 8, 0, 83, 50, 129, 202, 153, 203, 32, 51, 34, 35, 184, 175, 9, 1, 100, 19, 1, 136, 154, 16, 49, 71, 18, 0, 168, 156, 66, 67, 38, 1, 136, 188, 171, 155, 113, 37, 17, 0, 184, 191, 136, 154, 49, 3, 136, 160, 206, 170, 8, 8, 2, 187, 201, 239, 154, 136, 136, 128, 136, 169, 205, 171, 169, 203, 24, 176, 190, 186, 138, 144, 139, 18, 252, 187, 172, 170, 170, 32, 67, 168, 10, 184, 175, 154, 8, 169, 138, 136, 66, 51, 86, 36, 18, 152, 137, 186, 90, 36, 98, 131, 41, 35, 32, 55, 85, 51, 129, 169, 203, 156, 64, 53, 68, 34, 17, 168, 173, 8, 32, 49, 53, 18, 32, 160, 88, 131, 88, 21, 171, 1, 169, 32, 50, 54, 17, 18, 202, 128, 137, 100, 144, 171, 171, 24, 153, 113, 54, 18, 168, 152, 207, 154, 0, 49, 34, 66, 162, 173, 152, 139, 51, 145, 65, 178, 191, 16, 136, 115, 3, 41, 176, 141, 1, 170, 83, 146, 42, 194, 175, 17, 152, 98, 130, 9, 216, 139, 160, 141, 83, 18, 3, 168, 203, 171, 221, 57, 52, 16, 160, 140, 129, 157, 3, 8, 49, 0, 66, 1, 0, 200, 173, 24, 160, 28, 87, 152, 136, 160, 137, 153, 64, 4, 136, 50, 163, 175, 16, 136, 67, 168, 64, 145, 10, 37, 160, 222, 154, 185, 174, 40, 52, 35, 54, 146, 219, 188, 138, 160, 41, 54, 19, 129, 168, 169, 153, 24, 101, 2, 153, 144, 171, 16, 80, 54, 66, 35, 186, 138, 185, 40, 17, 116, 35, 136, 33, 35, 32, 51, 152, 251, 223, 8, 0, 48, 68, 130, 152, 203, 173, 153, 9, 50, 152, 25, 233, 188, 153, 25, 2, 202, 170, 237, 188, 9, 128, 153, 49, 178, 206, 171, 154, 171, 172, 136, 201, 171, 136, 128, 144, 9, 208, 255, 155, 137, 136, 16, 35, 128, 128, 219, 171, 186, 56, 19, 49, 131, 137, 98, 69, 50, 52, 34, 1, 203, 9, 98, 52, 98, 53, 129, 0, 34, 35, 33, 84, 1, 154, 41, 71, 35, 51, 115, 131, 172, 128, 168, 40, 66, 55, 128, 25, 18, 160, 187, 65, 144, 32, 184, 120, 177, 57, 20, 24, 184, 155, 17, 192, 157, 18, 251, 57, 179, 159, 68, 129, 136, 137, 184, 205, 153, 32, 35, 51, 52, 35, 249, 157, 0, 153, 16, 66, 36, 145, 0, 160, 154, 168, 26, 39, 17, 34, 68, 200, 9, 234, 41, 19, 9, 81, 53, 201, 157, 32, 184, 159, 81, 129, 10, 33, 1, 185, 173, 137, 144, 170, 65, 19, 1, 188, 97, 208, 26, 3, 139, 20, 202, 155, 187, 11, 192, 76, 119, 128, 0, 130, 186, 169, 171, 65, 3, 32, 68, 34, 250, 11, 35, 186, 96, 130, 251, 172, 138, 154, 80, 70, 35, 17, 169, 205, 186, 170, 32, 68, 67, 50, 160, 155, 153, 172, 48, 21, 128, 33, 161, 172, 64, 53, 33, 35, 145, 218, 156, 9, 24, 66, 51, 2, 9, 81, 19, 136, 130, 255, 172, 153, 136, 49, 55, 2, 168, 203, 188, 187, 137, 32, 35, 128, 219, 187, 172, 138, 32, 145, 221, 188, 187, 203, 10, 66, 129, 0, 218, 203, 186, 186, 154, 168, 189, 137, 8, 49, 54, 19, 234, 219, 188, 153, 17, 49, 83, 18, 168, 138, 0, 8, 115, 3, 128, 217, 10, 34, 115, 68, 51, 3, 136, 169, 172, 138, 80, 37, 83, 36, 18, 17, 0, 185, 172, 9, 144, 113, 55, 33, 17, 0, 136, 220, 139, 33, 128, 48, 22, 128, 8, 32, 131, 206, 32, 178, 189, 9, 17, 33, 17, 65, 131, 173, 0, 184, 188, 9, 250, 11, 34, 65, 69, 35, 177, 157, 169, 188, 154, 81, 37, 0, 18, 17, 128, 170, 16, 160, 219, 153, 137, 66, 70, 84, 3, 169, 154, 184, 190, 40, 18, 51, 146, 153, 219, 9, 18, 24, 83, 209, 189, 172, 139, 83, 128, 98, 132, 205, 9, 146, 203, 80, 35, 201, 138, 2, 186, 56, 36, 1, 136, 168, 255, 9, 0, 33, 20, 128, 1, 201, 155, 18, 168, 112, 20, 169, 154, 49, 129, 155, 70, 162, 154, 1, 128, 146, 8, 45, 0, 169, 187, 252, 191, 155, 50, 68, 101, 35, 128, 186, 219, 188, 10, 49, 54, 34, 50, 130, 188, 170, 8, 129, 66, 35, 128, 138, 83, 33, 84, 51, 130, 188, 186, 188, 8, 33, 70, 1, 16, 128, 0, 128, 202, 205, 219, 188, 155, 32, 53, 34, 19, 217, 205, 172, 154, 137, 136, 16, 2, 219, 9, 144, 169, 154, 250, 205, 155, 138, 136, 49, 37, 144, 169, 219, 219, 154, 24, 128, 136, 9, 1, 154, 115, 36, 136, 169, 203, 188, 154, 50, 68, 67, 51, 129, 32, 18, 152, 8, 192, 190, 64, 38, 50, 55, 35, 0, 153, 185, 186, 56, 54, 51, 68, 36, 17, 0, 33, 145, 187, 171, 222, 56, 22, 34, 68, 19, 202, 154, 234, 154, 9, 50, 129, 56, 37, 152, 139, 34, 251, 170, 185, 203, 139, 85, 18, 8, 66, 176, 175, 8, 128, 138, 50, 131, 170, 64, 37, 136, 98, 3, 201, 171, 154, 153, 48, 119, 34, 0, 49, 168, 187, 137, 0, 16, 18, 114, 36, 0, 35, 1, 17, 234, 172, 0, 176, 28, 54, 160, 9, 0, 169, 204, 153, 169, 185, 10, 52, 209, 155, 52, 248, 156, 169, 155, 33, 184, 89, 38, 184, 156, 144, 220, 41, 36, 136, 67, 177, 188, 186, 172, 65, 1, 114, 4, 170, 16, 152, 187, 96, 3, 10, 17, 80, 3, 25, 38, 144, 191, 25, 184, 11, 85, 2, 154, 144, 223, 155, 24, 68, 83, 67, 2, 184, 204, 170, 155, 64, 52, 51, 36, 17, 169, 155, 128, 8, 17, 34, 145, 104, 69, 35, 33, 36, 217, 187, 187, 0, 48, 71, 130, 153, 201, 187, 138, 8, 33, 144, 220, 221, 171, 138, 8, 17, 34, 208, 205, 187, 186, 172, 137, 8, 184, 156, 144, 138, 168, 186, 253, 189, 171, 154, 0, 82, 35, 1, 201, 172, 187, 155, 40, 67, 34, 50, 129, 48, 54, 51, 128, 154, 136, 152, 81, 102, 36, 130, 33, 19, 24, 100, 35, 129, 153, 8, 152, 48, 102, 53, 34, 1, 128, 186, 171, 32, 34, 35, 84, 36, 168, 26, 52, 160, 157, 201, 188, 170, 26, 37, 32, 4, 218, 204, 155, 153, 137, 48, 20, 236, 26, 130, 169, 81, 35, 184, 190, 137, 128, 9, 101, 51, 18, 168, 137, 168, 56, 38, 51, 35, 17, 0, 32, 86, 54, 19, 16, 128, 202, 155, 50, 54, 37, 50, 35, 216, 155, 64, 1, 138, 82, 146, 173, 10, 33, 51, 177, 26, 249, 239, 8, 136, 8, 0, 128, 169, 219, 138, 128, 9, 17, 201, 155, 219, 172, 8, 17, 51, 52, 160, 157, 137, 187, 171, 113, 36, 145, 8, 86, 161, 27, 37, 128, 169, 48, 4, 49, 129, 160, 191, 136, 137, 99, 66, 38, 169, 137, 201, 24, 17, 17, 99, 162, 43, 7, 172, 81, 144, 9, 203, 26, 162, 174, 49, 209, 157, 128, 169, 137, 116, 39, 2, 0, 0, 218, 173, 136, 16, 50, 69, 34, 0, 136, 136, 7, 74, 60, 0, 153, 9, 32, 168, 26, 21, 8, 101, 51, 131, 186, 170, 222, 154, 24, 18, 0, 0, 177, 223, 9, 144, 153, 152, 185, 252, 171, 153, 136, 17, 8, 152, 189, 203, 204, 139, 153, 170, 154, 185, 171, 49, 53, 145, 186, 222, 188, 186, 137, 99, 35, 19, 128, 9, 152, 154, 82, 37, 17, 18, 8, 68, 66, 36, 67, 2, 169, 48, 4, 136, 82, 36, 1, 8, 84, 2, 32, 36, 144, 202, 203, 9, 145, 9, 34, 103, 146, 138, 16, 168, 207, 137, 145, 171, 65, 130, 137, 129, 152, 206, 156, 24, 129, 138, 35, 250, 10, 50, 252, 74, 20, 8, 169, 137, 81, 131, 158, 66, 17, 129, 8, 34, 34, 154, 84, 144, 32, 34, 69, 128, 56, 38, 128, 153, 40, 2, 8, 83, 50, 38, 128, 144, 219, 138, 184, 158, 49, 3, 16, 52, 19, 251, 157, 160, 190, 137, 17, 128, 40, 36, 160, 185, 156, 152, 187, 170, 217, 158, 51, 235, 96, 130, 152, 0, 144, 187, 26, 71, 145, 57, 36, 185, 10, 129, 32, 68, 82, 20, 201, 40, 193, 157, 50, 2, 51, 161, 155, 252, 155, 0, 136, 99, 2, 24, 130, 156, 1, 24, 194, 191, 8, 218, 10, 51, 33, 71, 145, 154, 152, 188, 170, 153, 83, 17, 32, 18, 9, 17, 137, 35, 255, 157, 185, 190, 138, 9, 102, 36, 33, 36, 144, 203, 187, 172, 152, 48, 54, 34, 52, 34, 130, 169, 137, 218, 188, 154, 136, 65, 52, 38, 17, 1, 186, 219, 173, 136, 137, 137, 168, 137, 152, 187, 33, 168, 9, 255, 156, 202, 156, 152, 138, 137, 0, 136, 128, 136, 8, 219, 204, 189, 172, 153, 137, 81, 36, 50, 19, 144, 144, 188, 9, 168, 9, 52, 51, 86, 52, 52, 35, 18, 145, 203, 137, 8, 16, 69, 36, 33, 51, 35, 3, 153, 128, 253, 172, 168, 170, 40, 17, 17, 170, 65, 224, 174, 153, 219, 187, 187, 154, 137, 66, 36, 16, 1, 186, 220, 219, 170, 170, 16, 169, 115, 38, 34, 35, 17, 145, 221, 41, 130, 57, 119, 1, 128, 48, 2, 137, 67, 35, 1, 0, 153, 1, 58, 119, 0, 51, 161, 154, 136, 184, 10, 85, 3, 204, 24, 177, 189, 24, 18, 1, 184, 205, 170, 153, 136, 40, 71, 192, 139, 145, 190, 9, 49, 37, 184, 58, 132, 173, 16, 1, 68, 145, 41, 192, 157, 16, 0, 68, 34, 32, 1, 184, 171, 97, 3, 153, 153, 154, 217, 157, 115, 50, 67, 144, 138, 250, 157, 136, 137, 1, 152, 49, 177, 28, 36, 16, 146, 207, 153, 220, 10, 144, 25, 38, 152, 32, 18, 184, 26, 21, 251, 139, 128, 169, 26, 85, 18, 48, 35, 219, 64, 176, 11, 131, 170, 153, 170, 98, 19, 114, 23, 152, 137, 136, 203, 170, 152, 186, 156, 16, 32, 119, 37, 51, 35, 128, 202, 189, 172, 137, 16, 83, 68, 1, 33, 3, 136, 152, 171, 202, 190, 90, 54, 63, 0, 138, 160, 56, 38, 33, 18, 153, 202, 204, 171, 187, 156, 169, 205, 138, 0, 153, 16, 18, 1, 250, 174, 168, 188, 154, 153, 9, 8, 50, 69, 34, 34, 34, 192, 204, 170, 170, 136, 64, 86, 34, 51, 36, 33, 2, 137, 128, 204, 137, 16, 32, 66, 70, 35, 8, 34, 128, 185, 220, 186, 219, 188, 155, 137, 0, 16, 66, 129, 203, 188, 204, 190, 187, 171, 170, 170, 40, 53, 35, 18, 1, 160, 190, 187, 154, 48, 67, 71, 51, 53, 51, 35, 52, 3, 49, 51, 54, 1, 115, 34, 33, 1, 49, 52, 128, 64, 19, 17, 200, 106, 132, 174, 16, 17, 128, 188, 89, 133, 205, 40, 144, 138, 136, 40, 128, 153, 16, 217, 138, 236, 42, 162, 156, 33, 33, 130, 138, 84, 1, 153, 8, 34, 184, 120, 39, 24, 67, 145, 48, 145, 24, 34, 116, 3, 24, 34, 136, 40, 19, 49, 179, 43, 164, 175, 17, 16, 128, 219, 218, 205, 138, 201, 187, 0, 218, 155, 234, 139, 184, 155, 34, 251, 12, 144, 204, 9, 34, 35, 17, 17, 144, 186, 139, 0, 98, 69, 53, 145, 72, 4, 172, 32, 145, 41, 86, 129, 170, 32, 67, 184, 43, 71, 145, 187, 8, 170, 80, 131, 204, 154, 136, 188, 137, 65, 4, 10, 3, 223, 155, 16, 233, 26, 3, 153, 9, 146, 190, 32, 192, 221, 171, 8, 18, 115, 119, 18, 17, 0, 169, 187, 188, 26, 36, 32, 68, 20, 1, 128, 33, 144, 171, 203, 189, 170, 187, 56, 1, 40, 146, 187, 205, 172, 9, 161, 207, 187, 219, 204, 170, 137, 17, 1, 65, 35, 128, 168, 186, 220, 188, 155, 153, 9, 68, 69, 67, 35, 19, 17, 1, 185, 171, 0, 144, 139, 100, 36, 50, 83, 52, 17, 33, 146, 170, 218, 220, 204, 170, 154, 169, 16, 52, 19, 1, 128, 205, 205, 187, 187, 188, 155, 136, 0, 32, 52, 35, 144, 0, 18, 8, 49, 50, 103, 1, 24, 50, 69, 53, 83, 53, 51, 33, 35, 128, 186, 156, 1, 202, 56, 55, 34, 34, 34, 19, 250, 156, 152, 189, 137, 201, 155, 136, 138, 128, 137, 0, 202, 65, 146, 140, 1, 252, 158, 136, 152, 41, 85, 3, 56, 67, 18, 152, 65, 20, 168, 25, 145, 72, 21, 40, 54, 36, 144, 9, 52, 200, 140, 82, 145, 154, 136, 144, 219, 9, 34, 35, 1, 128, 204, 202, 206, 154, 1, 185, 172, 128, 185, 174, 40, 1, 154, 33, 216, 171, 187, 10, 17, 49, 3, 169, 9, 129, 113, 119, 34, 1, 33, 145, 188, 25, 34, 0, 101, 2, 136, 17, 168, 16, 168, 105, 4, 156, 68, 184, 13, 129, 221, 9, 144, 9, 34, 128, 128, 220, 154, 169, 204, 24, 1, 169, 184, 189, 137, 172, 114, 36, 2, 136, 18, 216, 174, 98, 145, 139, 50, 145, 155, 99, 2, 1, 8, 18, 201, 25, 162, 191, 32, 250, 172, 235, 171, 8, 66, 1, 230, 56, 0, 86, 68, 36, 2, 128, 184, 220, 154, 136, 136, 49, 37, 19, 2, 51, 20, 152, 203, 187, 190, 188, 154, 144, 136, 128, 24, 185, 138, 49, 54, 177, 188, 218, 223, 172, 154, 137, 136, 49, 68, 35, 17, 17, 130, 186, 219, 187, 187, 156, 48, 54, 68, 83, 18, 18, 128, 8, 128, 170, 170, 154, 204, 172, 136, 8, 33, 69, 36, 33, 19, 168, 221, 204, 187, 173, 171, 137, 17, 49, 51, 35, 4, 218, 170, 203, 188, 171, 152, 9, 16, 114, 36, 33, 52, 50, 36, 49, 36, 17, 129, 169, 203, 40, 50, 103, 67, 67, 35, 34, 128, 170, 235, 172, 170, 154, 0, 0, 0, 129, 218, 156, 186, 172, 185, 156, 217, 187, 169, 185, 223, 40, 1, 40, 68, 52, 35, 1, 81, 3, 204, 32, 130, 136, 50, 71, 51, 18, 82, 21, 200, 138, 17, 200, 155, 49, 35, 144, 41, 54, 185, 40, 162, 171, 137, 64, 224, 189, 137, 8, 233, 11, 36, 129, 136, 24, 37, 128, 16, 170, 152, 237, 155, 153, 144, 32, 54, 19, 49, 83, 37, 129, 25, 129, 236, 172, 154, 153, 137, 49, 20, 152, 49, 162, 158, 65, 18, 136, 185, 221, 219, 173, 154, 153, 9, 35, 19, 128, 72, 23, 184, 10, 144, 251, 171, 8, 128, 136, 114, 36, 128, 66, 18, 33, 153, 64, 132, 205, 24, 160, 157, 8, 33, 129, 112, 37, 144, 9, 144, 235, 203, 155, 32, 152, 26, 37, 251, 156, 128, 168, 138, 115, 21, 152, 0, 144, 152, 190, 41, 130, 171, 49, 53, 34, 68, 35, 216, 191, 137, 168, 80, 86, 67, 34, 1, 144, 186, 188, 138, 0, 16, 36, 35, 128, 25, 34, 128, 217, 189, 219, 204, 154, 154, 153, 170, 203, 189, 186, 137, 49, 34, 52, 129, 236, 189, 203, 155, 152, 24, 53, 51, 52, 51, 51, 33, 2, 169, 170, 26, 18, 98, 70, 83, 17, 18, 129, 24, 0, 16, 129, 136, 251, 189, 236, 186, 186, 154, 137, 48, 18, 33, 193, 190, 188, 204, 187, 155, 137, 137, 8, 33, 50, 33, 18, 34, 68, 52, 52, 53, 51, 52, 129, 138, 51, 84, 100, 67, 36, 51, 2, 128, 200, 172, 9, 136, 16, 99, 35, 129, 169, 170, 222, 172, 138, 152, 9, 145, 154, 235, 172, 203, 187, 137, 50, 0, 67, 52, 35, 33, 35, 152, 153, 114, 55, 67, 83, 52, 19, 40, 20, 153, 16, 0, 82, 36, 34, 68, 2, 137, 152, 219, 171, 8, 1, 153, 49, 53, 162, 159, 136, 25, 4, 171, 33, 234, 9, 216, 187, 137, 128, 24, 50, 101, 36, 17, 67, 145, 189, 169, 186, 187, 25, 52, 83, 35, 33, 2, 65, 22, 136, 128, 235, 188, 172, 186, 155, 16, 83, 3, 185, 152, 218, 190, 172, 186, 204, 203, 138, 128, 8, 115, 19, 152, 153, 202, 188, 171, 40, 36, 129, 32, 21, 136, 83, 67, 86, 35, 16, 0, 169, 170, 205, 9, 145, 4, 46, 0, 145, 10, 34, 137, 129, 207, 72, 130, 190, 32, 184, 172, 187, 80, 19, 250, 26, 130, 158, 0, 56, 71, 129, 137, 24, 201, 156, 33, 67, 36, 128, 0, 169, 202, 155, 68, 145, 56, 161, 140, 152, 65, 249, 158, 8, 0, 25, 119, 52, 34, 1, 128, 184, 205, 154, 128, 16, 17, 51, 19, 8, 128, 8, 185, 206, 203, 172, 156, 154, 187, 137, 219, 173, 171, 138, 66, 18, 50, 20, 201, 205, 187, 187, 154, 9, 34, 69, 52, 36, 51, 2, 33, 1, 169, 171, 32, 3, 154, 116, 2, 40, 2, 9, 36, 16, 54, 129, 170, 203, 238, 204, 187, 170, 170, 137, 66, 35, 17, 2, 169, 205, 172, 171, 187, 172, 153, 185, 41, 18, 65, 51, 101, 51, 36, 51, 37, 2, 128, 169, 186, 187, 64, 69, 84, 52, 50, 35, 17, 152, 136, 201, 138, 152, 152, 153, 220, 172, 186, 189, 154, 0, 83, 130, 136, 216, 205, 203, 173, 137, 152, 8, 34, 51, 52, 67, 51, 129, 24, 38, 136, 114, 36, 66, 19, 33, 19, 137, 34, 219, 114, 19, 64, 51, 51, 131, 136, 218, 172, 186, 41, 177, 142, 34, 0, 217, 171, 153, 16, 249, 42, 21, 153, 33, 200, 154, 203, 202, 157, 128, 25, 86, 34, 67, 2, 8, 129, 187, 26, 67, 0, 34, 129, 32, 146, 27, 71, 18, 68, 176, 138, 168, 175, 168, 189, 9, 250, 140, 136, 0, 33, 34, 17, 250, 187, 187, 174, 25, 34, 128, 33, 169, 139, 8, 1, 96, 39, 152, 40, 3, 186, 80, 177, 142, 19, 25, 37, 82, 52, 17, 36, 16, 1, 8, 161, 206, 11, 34, 177, 207, 138, 2, 221, 139, 67, 129, 137, 152, 223, 155, 186, 156, 129, 24, 51, 202, 73, 4, 187, 155, 202, 219, 220, 73, 71, 34, 83, 35, 1, 152, 154, 137, 136, 25, 68, 17, 0, 0, 65, 2, 153, 152, 203, 236, 187, 153, 203, 203, 206, 170, 187, 154, 9, 32, 37, 1, 136, 202, 187, 220, 187, 138, 137, 16, 65, 53, 35, 52, 35, 0, 65, 36, 128, 33, 19, 168, 152, 154, 169, 11, 70, 18, 86, 36, 33, 129, 202, 203, 222, 187, 170, 169, 9, 16, 33, 33, 160, 155, 136, 136, 185, 255, 187, 204, 203, 155, 154, 24, 16, 50, 84, 52, 83, 18, 8, 152, 186, 204, 155, 32, 51, 67, 52, 52, 51, 98, 36, 18, 50, 35, 200, 174, 152, 203, 172, 10, 33, 32, 99, 36, 1, 8, 184, 251, 187, 10, 217, 188, 9, 17, 136, 8, 49, 54, 129, 64, 69, 18, 33, 146, 10, 162, 207, 65, 145, 26, 70, 18, 34, 16, 50, 19, 235, 40, 4, 169, 137, 34, 232, 156, 49, 176, 140, 33, 35, 128, 48, 54, 161, 189, 9, 160, 207, 9, 17, 136, 17, 82, 37, 8, 49, 35, 34, 129, 152, 64, 240, 157, 0, 170, 9, 16, 52, 19, 49, 54, 176, 157, 200, 173, 169, 189, 10, 117, 6, 46, 0, 200, 11, 2, 172, 49, 184, 42, 5, 136, 18, 48, 39, 252, 24, 177, 158, 32, 1, 97, 20, 1, 17, 169, 137, 202, 138, 8, 82, 146, 139, 4, 189, 40, 200, 27, 39, 145, 33, 1, 203, 237, 188, 191, 171, 154, 40, 101, 51, 67, 36, 128, 136, 144, 153, 169, 8, 18, 1, 17, 100, 18, 16, 17, 128, 64, 52, 35, 130, 251, 204, 205, 203, 138, 136, 8, 33, 33, 35, 1, 136, 218, 219, 204, 186, 170, 138, 16, 128, 168, 170, 33, 152, 117, 36, 51, 2, 185, 186, 205, 187, 171, 154, 16, 82, 70, 66, 51, 19, 0, 169, 204, 187, 187, 170, 153, 169, 138, 16, 152, 120, 54, 17, 34, 129, 200, 207, 187, 220, 186, 172, 136, 128, 33, 67, 50, 1, 17, 168, 170, 137, 176, 174, 24, 130, 171, 33, 65, 71, 81, 85, 34, 67, 18, 129, 202, 186, 188, 155, 169, 56, 53, 17, 83, 35, 1, 1, 185, 219, 189, 153, 187, 140, 16, 250, 26, 184, 74, 38, 49, 69, 2, 128, 136, 169, 138, 168, 140, 66, 2, 65, 54, 36, 33, 51, 130, 40, 2, 219, 40, 132, 204, 25, 176, 140, 49, 136, 98, 20, 0, 67, 160, 153, 0, 202, 189, 26, 130, 171, 50, 136, 65, 85, 51, 36, 0, 50, 68, 131, 140, 68, 152, 16, 50, 37, 153, 85, 144, 41, 18, 128, 10, 176, 159, 144, 205, 10, 168, 173, 144, 203, 138, 32, 161, 58, 55, 169, 24, 129, 188, 72, 38, 145, 169, 172, 170, 188, 11, 17, 186, 114, 55, 136, 50, 82, 3, 204, 9, 168, 173, 155, 138, 0, 128, 138, 50, 201, 27, 68, 1, 144, 220, 203, 220, 186, 155, 152, 187, 57, 54, 2, 115, 19, 136, 168, 154, 200, 154, 145, 41, 37, 9, 39, 153, 49, 170, 99, 152, 113, 145, 56, 4, 137, 152, 250, 207, 154, 153, 16, 32, 18, 0, 18, 219, 138, 186, 203, 204, 188, 154, 137, 65, 36, 33, 50, 99, 36, 34, 82, 55, 129, 17, 144, 24, 161, 157, 48, 21, 136, 113, 19, 17, 18, 128, 17, 249, 187, 152, 144, 235, 154, 153, 168, 190, 56, 160, 26, 144, 171, 201, 188, 172, 202, 204, 154, 185, 171, 136, 186, 25, 240, 27, 51, 40, 87, 129, 8, 33, 168, 24, 1, 24, 186, 113, 7, 64, 53, 2, 137, 1, 184, 156, 128, 187, 34, 239, 153, 184, 9, 33, 2, 58, 39, 219, 8, 184, 26, 176, 174, 170, 188, 137, 152, 10, 70, 160, 10, 18, 129, 152, 170, 187, 203, 175, 9, 144, 80, 70, 35, 67, 52, 18, 33, 51, 144, 58, 87, 128, 24, 50, 51, 0, 152, 138, 87, 128, 48, 162, 175, 137, 153, 172, 40, 128, 153, 26, 69, 160, 24, 51, 18, 168, 169, 204, 113, 39, 49, 18, 16, 2, 170, 48, 51, 51, 52, 162, 175, 186, 10, 84, 50, 162, 190, 186, 137, 1, 128, 32, 37, 250, 170, 203, 10, 1, 10, 41, 0, 68, 50, 86, 129, 154, 0, 34, 0, 129, 170, 65, 200, 158, 98, 51, 128, 203, 155, 136, 24, 87, 2, 185, 169, 138, 136, 251, 138, 128, 186, 8, 99, 53, 18, 128, 201, 220, 155, 17, 33, 52, 146, 188, 186, 203, 154, 64, 71, 18, 160, 187, 204, 139, 48, 36, 176, 191, 155, 8, 66, 67, 1, 128, 235, 188, 136, 33, 68, 3, 186, 188, 189, 9, 67, 36, 18, 136, 160, 186, 138, 40, 130, 170, 176, 255, 9, 18, 50, 35, 192, 188, 186, 205, 26, 102, 3, 153, 153, 218, 170, 16, 50, 51, 129, 168, 138, 115, 20, 153, 153, 172, 41, 20, 49, 37, 152, 186, 137, 169, 153, 204, 88, 70, 19, 0, 160, 174, 137, 160, 42, 131, 220, 10, 113, 53, 145, 185, 218, 138, 51, 3, 137, 154, 41, 130, 187, 220, 139, 51, 146, 237, 12, 99, 2, 9, 152, 10, 68, 217, 155, 185, 57, 103, 1, 170, 155, 16, 34, 18, 169, 9, 184, 159, 48, 68, 2, 169, 154, 220, 11, 36, 35, 146, 219, 154, 83, 162, 174, 9, 153, 113, 21, 185, 154, 8, 33, 36, 145, 206, 138, 66, 19, 170, 24, 145, 189, 24, 51, 0, 49, 208, 157, 17, 51, 147, 207, 137, 1, 56, 36, 176, 10, 168, 73, 22, 137, 145, 174, 82, 129, 40, 38, 185, 172, 137, 16, 83, 3, 137, 218, 41, 39, 144, 137, 168, 204, 89, 37, 144, 170, 170, 26, 55, 130, 187, 152, 154, 40, 71, 19, 250, 139, 32, 67, 145, 188, 9, 33, 1, 24, 83, 176, 157, 145, 171, 115, 5, 170, 10, 32, 2, 136, 152, 204, 138, 81, 52, 146, 189, 137, 172, 113, 21, 201, 139, 33, 19, 146, 218, 154, 25, 115, 19, 220, 138, 17, 35, 19, 217, 172, 9, 49, 37, 185, 139, 8, 72, 20, 202, 41, 145, 138, 144, 81, 36, 129, 251, 139, 50, 0, 32, 192, 175, 64, 36, 184, 154, 16, 152, 64, 131, 219, 32, 200, 43, 71, 144, 187, 139, 65, 4, 8, 128, 220, 56, 20, 168, 137, 186, 64, 19, 8, 2, 206, 41, 19, 25, 53, 240, 204, 40, 37, 145, 169, 153, 8, 16, 52, 161, 188, 170, 8, 115, 19, 168, 204, 155, 99, 3, 128, 202, 137, 136, 64, 21, 184, 172, 40, 18, 24, 145, 189, 48, 131, 9, 54, 232, 156, 56, 36, 153, 40, 209, 141, 51, 161, 138, 35, 251, 13, 50, 34, 168, 172, 138, 50, 17, 16, 218, 140, 33, 152, 115, 135, 186, 138, 40, 35, 1, 130, 206, 41, 20, 153, 137, 0, 184, 27, 119, 145, 203, 40, 130, 8, 16, 17, 217, 189, 40, 55, 145, 153, 186, 27, 38, 128, 1, 218, 154, 48, 36, 34, 162, 239, 137, 34, 50, 144, 186, 173, 80, 18, 136, 137, 186, 141, 68, 130, 136, 184, 190, 73, 54, 176, 171, 136, 32, 50, 17, 168, 190, 8, 49, 52, 129, 250, 141, 34, 136, 49, 176, 188, 61, 238, 63, 0, 32, 18, 24, 37, 253, 26, 35, 128, 1, 236, 25, 21, 160, 137, 24, 2, 219, 40, 67, 130, 191, 56, 3, 128, 169, 138, 201, 112, 4, 169, 186, 57, 54, 144, 155, 8, 185, 104, 132, 170, 16, 152, 50, 184, 56, 250, 107, 21, 169, 154, 24, 1, 32, 129, 235, 139, 116, 131, 218, 154, 33, 35, 0, 203, 10, 50, 144, 173, 99, 129, 153, 152, 16, 218, 105, 21, 185, 154, 0, 2, 0, 128, 9, 130, 219, 64, 129, 40, 162, 191, 32, 184, 113, 6, 171, 41, 129, 40, 130, 175, 33, 129, 48, 209, 157, 49, 145, 40, 131, 220, 154, 84, 130, 154, 154, 153, 57, 119, 168, 138, 145, 26, 70, 160, 173, 32, 36, 169, 152, 187, 113, 3, 170, 136, 136, 66, 160, 140, 34, 152, 41, 147, 174, 25, 69, 161, 190, 56, 37, 186, 24, 162, 155, 82, 1, 153, 204, 41, 53, 129, 168, 187, 64, 19, 218, 9, 3, 24, 3, 207, 48, 20, 169, 156, 16, 49, 23, 219, 138, 49, 36, 144, 220, 26, 52, 152, 138, 152, 32, 130, 64, 192, 140, 129, 40, 132, 172, 98, 3, 235, 156, 64, 20, 168, 187, 56, 55, 192, 173, 48, 21, 184, 170, 32, 19, 128, 171, 8, 17, 34, 200, 25, 130, 156, 33, 18, 252, 41, 21, 153, 184, 143, 68, 146, 186, 26, 37, 219, 41, 4, 170, 32, 2, 0, 251, 155, 100, 2, 171, 152, 10, 83, 145, 137, 185, 26, 35, 81, 146, 172, 128, 153, 72, 55, 233, 155, 65, 36, 201, 155, 25, 68, 130, 169, 185, 156, 98, 20, 200, 155, 50, 161, 155, 66, 20, 235, 138, 81, 20, 186, 155, 1, 34, 17, 201, 154, 24, 67, 35, 250, 142, 82, 129, 154, 137, 138, 83, 130, 168, 187, 8, 56, 55, 161, 172, 138, 82, 2, 153, 186, 10, 50, 39, 176, 191, 72, 35, 137, 8, 154, 138, 24, 50, 53, 248, 142, 16, 24, 36, 217, 10, 50, 18, 235, 10, 35, 145, 187, 41, 131, 96, 163, 191, 49, 162, 56, 149, 173, 40, 50, 184, 156, 16, 35, 234, 57, 22, 154, 24, 136, 138, 115, 146, 189, 8, 33, 129, 136, 33, 144, 221, 96, 3, 189, 40, 130, 137, 18, 152, 9, 202, 58, 39, 184, 137, 68, 177, 141, 34, 201, 154, 82, 3, 185, 187, 89, 21, 185, 73, 38, 234, 155, 65, 3, 136, 184, 187, 98, 3, 202, 26, 34, 145, 136, 17, 192, 157, 66, 129, 8, 201, 171, 82, 19, 153, 137, 170, 116, 132, 219, 137, 8, 66, 20, 176, 188, 169, 41, 87, 1, 185, 189, 56, 54, 160, 171, 128, 24, 50, 0, 160, 175, 17, 128, 49, 2, 153, 222, 42, 37, 144, 128, 184, 189, 72, 38, 145, 186, 186, 44, 71, 144, 137, 136, 152, 156, 114, 2, 152, 203, 26, 67, 4, 202, 138, 1, 17, 1, 8, 145, 219, 9, 51, 19, 176, 207, 25, 51, 1, 153, 41, 131, 198, 11, 56, 0, 255, 41, 20, 136, 128, 153, 201, 42, 71, 169, 139, 32, 35, 9, 3, 255, 25, 36, 160, 154, 17, 160, 9, 16, 36, 160, 188, 139, 98, 35, 144, 205, 137, 32, 69, 129, 203, 188, 88, 36, 161, 171, 9, 40, 35, 201, 80, 194, 157, 33, 18, 128, 153, 153, 186, 73, 39, 160, 155, 16, 3, 137, 216, 44, 55, 200, 155, 32, 18, 0, 17, 251, 139, 82, 18, 136, 184, 190, 48, 38, 145, 220, 25, 34, 16, 152, 138, 144, 26, 37, 168, 155, 16, 82, 248, 42, 21, 152, 201, 41, 21, 170, 25, 129, 9, 20, 185, 137, 40, 55, 250, 25, 2, 144, 169, 81, 19, 235, 187, 80, 38, 192, 155, 33, 128, 40, 19, 186, 155, 168, 25, 54, 129, 186, 186, 81, 22, 233, 9, 19, 136, 19, 218, 154, 8, 68, 145, 25, 144, 207, 57, 23, 152, 136, 136, 137, 153, 81, 21, 170, 154, 153, 65, 53, 200, 171, 16, 16, 17, 67, 177, 207, 137, 65, 21, 169, 171, 41, 37, 128, 136, 185, 155, 52, 18, 184, 159, 99, 177, 156, 48, 2, 136, 17, 250, 13, 52, 145, 172, 9, 50, 145, 49, 249, 140, 33, 1, 66, 162, 223, 25, 36, 130, 202, 155, 72, 52, 177, 189, 24, 34, 34, 144, 204, 155, 115, 2, 169, 170, 8, 83, 130, 186, 188, 113, 19, 168, 235, 25, 52, 129, 202, 155, 50, 34, 0, 153, 185, 188, 90, 54, 145, 218, 187, 81, 36, 144, 219, 9, 33, 52, 217, 11, 1, 17, 145, 11, 130, 40, 248, 13, 35, 17, 144, 203, 153, 72, 38, 152, 170, 187, 72, 39, 145, 188, 16, 17, 144, 24, 17, 170, 152, 153, 112, 6, 251, 25, 20, 136, 137, 136, 153, 49, 34, 51, 254, 11, 35, 129, 16, 184, 158, 67, 208, 10, 37, 168, 154, 16, 0, 17, 161, 173, 16, 50, 21, 233, 9, 136, 56, 20, 153, 170, 9, 144, 106, 55, 201, 155, 16, 68, 176, 173, 65, 130, 169, 24, 0, 152, 187, 99, 130, 24, 1, 250, 172, 82, 3, 203, 24, 19, 185, 157, 98, 18, 168, 156, 0, 137, 18, 136, 69, 161, 203, 157, 83, 145, 40, 192, 140, 18, 40, 19, 189, 26, 36, 161, 173, 32, 1, 82, 177, 156, 169, 105, 21, 170, 48, 200, 187, 8, 85, 3, 168, 205, 25, 50, 35, 162, 191, 137, 65, 19, 170, 186, 10, 69, 1, 0, 251, 11, 36, 128, 16, 184, 172, 80, 3, 168, 169, 26, 4, 202, 48, 71, 192, 157, 33, 1, 144, 137, 33, 144, 202, 173, 115, 19, 186, 154, 32, 129, 140, 83, 160, 171, 81, 129, 26, 3, 156, 144, 171, 81, 51, 177, 191, 24, 37, 146, 156, 18, 220, 40, 1, 69, 200, 156, 24, 68, 144, 171, 152, 9, 85, 18, 234, 171, 66, 2, 137, 1, 202, 9, 82, 130, 187, 32, 184, 12, 115, 130, 171, 137, 186, 114, 23, 160, 188, 9, 83, 2, 185, 84, 8, 74, 0, 154, 1, 8, 2, 139, 70, 232, 10, 19, 129, 152, 137, 161, 172, 100, 146, 171, 16, 128, 33, 130, 189, 88, 146, 155, 128, 73, 4, 154, 1, 250, 141, 83, 19, 185, 188, 25, 98, 17, 152, 219, 25, 19, 18, 202, 25, 51, 145, 191, 57, 36, 184, 8, 152, 9, 152, 113, 146, 12, 20, 251, 138, 66, 20, 168, 219, 25, 38, 185, 41, 3, 185, 155, 64, 21, 168, 186, 139, 70, 146, 170, 8, 160, 12, 55, 145, 154, 187, 156, 113, 22, 153, 153, 171, 104, 20, 168, 139, 17, 201, 56, 21, 153, 136, 168, 157, 115, 162, 138, 130, 154, 64, 129, 16, 160, 188, 136, 48, 71, 192, 157, 50, 145, 139, 50, 208, 12, 67, 144, 153, 170, 56, 37, 129, 217, 187, 80, 21, 184, 137, 128, 24, 33, 18, 252, 138, 82, 19, 216, 170, 8, 99, 161, 155, 0, 8, 2, 17, 144, 172, 97, 146, 191, 88, 36, 218, 9, 33, 136, 16, 129, 171, 8, 152, 112, 4, 187, 56, 232, 58, 20, 172, 33, 146, 171, 99, 176, 58, 164, 158, 33, 19, 144, 204, 10, 115, 129, 156, 33, 168, 9, 152, 112, 20, 202, 140, 50, 136, 40, 145, 152, 187, 88, 130, 24, 4, 204, 48, 232, 42, 38, 168, 137, 137, 17, 152, 154, 115, 145, 27, 20, 204, 25, 1, 65, 20, 250, 171, 32, 53, 130, 188, 25, 128, 0, 16, 53, 249, 156, 67, 130, 172, 16, 0, 48, 147, 191, 41, 35, 136, 17, 235, 139, 67, 3, 202, 24, 177, 11, 21, 136, 128, 40, 131, 172, 0, 139, 53, 251, 58, 71, 168, 173, 56, 19, 128, 168, 137, 203, 114, 146, 138, 17, 168, 141, 67, 176, 10, 145, 56, 55, 177, 191, 24, 19, 35, 248, 140, 34, 8, 17, 160, 173, 41, 37, 144, 137, 128, 204, 64, 20, 169, 205, 64, 20, 169, 10, 145, 10, 52, 184, 48, 208, 157, 64, 18, 9, 145, 189, 32, 18, 34, 176, 206, 27, 53, 130, 128, 251, 138, 17, 82, 130, 170, 217, 43, 52, 129, 152, 186, 173, 115, 148, 139, 19, 217, 10, 33, 18, 128, 168, 155, 168, 26, 119, 130, 172, 138, 1, 82, 4, 219, 138, 8, 83, 19, 217, 171, 17, 33, 36, 200, 158, 48, 2, 9, 160, 172, 82, 2, 202, 24, 3, 187, 138, 100, 131, 189, 41, 19, 0, 152, 138, 251, 74, 38, 144, 203, 138, 82, 18, 169, 25, 200, 28, 52, 176, 25, 145, 187, 48, 36, 202, 89, 3, 202, 187, 113, 51, 168, 174, 10, 8, 69, 4, 185, 189, 24, 52, 2, 184, 173, 24, 18, 16, 18, 251, 41, 2, 136, 200, 10, 37, 1, 186, 41, 177, 157, 99, 17, 145, 207, 41, 36, 129, 169, 187, 48, 129, 88, 38, 235, 138, 33, 18, 1, 203, 10, 1, 49, 38, 235, 138, 1, 32, 51, 201, 188, 57, 53, 129, 169, 202, 171, 102, 145, 154, 128, 137, 82, 162, 173, 62, 218, 74, 0, 64, 2, 171, 49, 168, 27, 20, 169, 10, 128, 113, 148, 173, 32, 136, 32, 35, 233, 140, 49, 20, 232, 139, 36, 168, 56, 21, 251, 138, 49, 66, 161, 188, 9, 136, 82, 4, 152, 170, 170, 41, 54, 1, 136, 221, 10, 52, 3, 219, 10, 32, 50, 160, 174, 9, 66, 19, 168, 189, 40, 3, 0, 144, 139, 145, 88, 162, 105, 194, 141, 34, 154, 48, 53, 160, 207, 138, 83, 2, 152, 171, 80, 131, 221, 40, 52, 201, 138, 33, 18, 201, 156, 49, 35, 128, 235, 10, 35, 130, 168, 8, 217, 57, 21, 153, 152, 172, 82, 19, 192, 158, 99, 176, 11, 19, 185, 40, 36, 168, 202, 188, 112, 22, 169, 152, 138, 49, 4, 128, 218, 171, 33, 69, 1, 203, 9, 1, 10, 68, 192, 139, 16, 66, 145, 172, 170, 89, 21, 0, 160, 189, 41, 52, 130, 172, 49, 217, 139, 66, 37, 200, 173, 48, 52, 168, 156, 128, 16, 17, 144, 137, 153, 64, 17, 192, 175, 99, 146, 154, 0, 218, 56, 36, 1, 217, 155, 138, 115, 3, 153, 171, 24, 3, 8, 130, 170, 72, 21, 217, 219, 25, 36, 24, 37, 185, 188, 139, 115, 67, 160, 189, 138, 40, 55, 160, 170, 137, 65, 2, 137, 8, 152, 203, 57, 37, 17, 178, 255, 40, 2, 8, 2, 202, 138, 81, 146, 139, 130, 138, 184, 90, 22, 169, 8, 16, 160, 74, 6, 202, 9, 50, 200, 155, 50, 37, 176, 138, 129, 223, 56, 22, 136, 128, 188, 42, 19, 48, 130, 220, 154, 115, 130, 155, 32, 152, 186, 72, 22, 152, 169, 172, 66, 130, 41, 39, 250, 154, 49, 35, 136, 184, 174, 33, 3, 184, 11, 66, 1, 169, 57, 5, 173, 32, 145, 48, 242, 156, 33, 33, 1, 217, 27, 69, 161, 155, 160, 174, 114, 130, 136, 153, 168, 187, 115, 21, 160, 203, 10, 99, 145, 9, 152, 155, 50, 50, 146, 189, 8, 169, 56, 87, 1, 204, 139, 66, 2, 144, 152, 235, 10, 99, 34, 144, 220, 171, 84, 2, 137, 137, 169, 171, 83, 52, 145, 204, 139, 49, 21, 176, 138, 128, 138, 81, 129, 16, 160, 170, 202, 73, 39, 169, 138, 8, 48, 146, 141, 84, 176, 159, 17, 32, 4, 186, 154, 27, 39, 160, 154, 40, 18, 10, 55, 250, 140, 51, 129, 9, 144, 187, 16, 18, 67, 129, 218, 190, 64, 51, 2, 251, 170, 40, 53, 2, 201, 189, 42, 69, 130, 170, 154, 8, 66, 145, 10, 19, 221, 26, 36, 1, 152, 171, 153, 10, 87, 144, 153, 152, 33, 144, 169, 42, 87, 161, 173, 24, 34, 0, 8, 160, 174, 49, 2, 0, 2, 234, 156, 49, 36, 160, 175, 56, 2, 169, 33, 0, 17, 251, 155, 97, 20, 170, 169, 27, 22, 8, 145, 140, 2, 136, 187, 115, 148, 138, 153, 1, 136, 83, 192, 26, 129, 171, 48, 70, 1, 250, 188, 80, 52, 176, 157, 0, 152, 92, 218, 73, 0, 80, 20, 184, 188, 25, 52, 131, 186, 153, 155, 97, 52, 176, 190, 25, 34, 51, 3, 221, 187, 48, 38, 129, 152, 204, 26, 68, 129, 154, 144, 154, 0, 82, 20, 202, 153, 153, 64, 52, 177, 173, 8, 1, 17, 16, 35, 250, 172, 41, 53, 146, 202, 139, 34, 130, 40, 22, 218, 154, 16, 3, 9, 39, 216, 138, 8, 49, 2, 137, 168, 205, 72, 21, 169, 138, 16, 18, 144, 203, 58, 4, 8, 18, 17, 251, 175, 100, 1, 186, 155, 49, 35, 3, 191, 154, 32, 53, 18, 235, 155, 17, 67, 145, 154, 152, 154, 33, 2, 169, 115, 177, 88, 225, 172, 56, 71, 145, 188, 138, 34, 66, 1, 154, 235, 138, 83, 35, 185, 203, 154, 68, 19, 169, 187, 155, 116, 130, 154, 144, 9, 17, 33, 160, 72, 241, 158, 49, 18, 0, 186, 156, 34, 1, 0, 129, 203, 10, 84, 162, 156, 136, 72, 5, 172, 50, 130, 235, 138, 50, 38, 216, 171, 49, 35, 169, 138, 8, 8, 32, 55, 249, 138, 17, 128, 50, 178, 191, 82, 184, 141, 68, 146, 187, 10, 33, 53, 184, 187, 155, 114, 21, 152, 155, 169, 24, 52, 19, 184, 191, 8, 66, 35, 185, 173, 8, 33, 19, 202, 9, 18, 216, 42, 38, 136, 152, 203, 10, 86, 2, 202, 170, 9, 53, 161, 25, 161, 189, 139, 103, 2, 170, 170, 138, 66, 51, 146, 205, 138, 49, 34, 136, 201, 140, 52, 145, 8, 250, 11, 35, 67, 130, 204, 171, 24, 65, 55, 177, 172, 154, 41, 70, 128, 154, 136, 186, 57, 70, 128, 169, 169, 138, 83, 36, 192, 174, 32, 49, 2, 203, 172, 32, 52, 35, 208, 189, 138, 68, 18, 136, 185, 188, 56, 38, 145, 186, 139, 64, 36, 152, 152, 170, 154, 56, 71, 129, 203, 154, 66, 146, 187, 98, 19, 218, 155, 48, 35, 136, 0, 218, 154, 64, 21, 144, 136, 189, 41, 18, 99, 162, 188, 153, 10, 87, 1, 203, 138, 1, 65, 2, 136, 235, 10, 19, 33, 20, 251, 12, 17, 16, 52, 192, 174, 25, 36, 1, 128, 220, 25, 18, 18, 160, 139, 202, 27, 71, 1, 169, 187, 10, 114, 51, 176, 205, 154, 82, 35, 153, 171, 137, 16, 66, 145, 42, 178, 191, 81, 2, 153, 152, 152, 187, 115, 133, 170, 16, 128, 137, 0, 144, 98, 147, 174, 136, 41, 37, 152, 8, 202, 155, 85, 17, 0, 218, 156, 65, 129, 25, 147, 187, 9, 37, 203, 80, 3, 184, 174, 33, 1, 129, 153, 33, 201, 138, 33, 4, 41, 7, 221, 25, 51, 3, 186, 203, 139, 101, 129, 171, 16, 0, 152, 9, 83, 145, 188, 140, 83, 18, 145, 172, 186, 28, 87, 144, 153, 136, 152, 24, 52, 129, 137, 205, 24, 19, 136, 40, 3, 252, 9, 17, 0, 17, 146, 223, 88, 131, 172, 33, 0, 16, 176, 158, 49, 128, 17, 201, 57, 179, 191, 98, 131, 186, 25, 32, 249, 67, 0, 129, 138, 69, 176, 156, 17, 17, 176, 12, 37, 217, 11, 53, 177, 11, 131, 189, 82, 130, 169, 137, 153, 113, 6, 187, 138, 64, 4, 152, 168, 139, 17, 82, 3, 154, 186, 175, 16, 99, 37, 233, 171, 49, 4, 137, 17, 203, 25, 1, 24, 50, 176, 139, 249, 44, 38, 185, 8, 17, 144, 40, 208, 13, 36, 153, 16, 160, 8, 201, 10, 86, 130, 174, 24, 2, 24, 146, 171, 16, 145, 171, 117, 162, 172, 0, 33, 129, 24, 201, 12, 84, 176, 27, 132, 157, 50, 2, 170, 139, 33, 161, 159, 98, 130, 155, 34, 249, 10, 2, 32, 52, 208, 205, 24, 66, 2, 169, 154, 8, 144, 25, 71, 176, 174, 48, 20, 153, 9, 153, 56, 21, 202, 10, 18, 144, 65, 177, 173, 17, 0, 128, 115, 178, 175, 32, 18, 0, 8, 201, 139, 36, 168, 65, 224, 139, 84, 129, 203, 9, 1, 49, 3, 152, 252, 41, 147, 10, 37, 192, 172, 48, 35, 17, 216, 173, 48, 20, 168, 153, 168, 64, 146, 28, 39, 184, 156, 137, 49, 51, 35, 237, 11, 50, 168, 57, 6, 187, 186, 104, 39, 168, 139, 144, 138, 68, 146, 137, 185, 140, 65, 36, 160, 153, 189, 48, 20, 16, 168, 189, 139, 85, 18, 128, 220, 138, 32, 99, 2, 187, 203, 57, 37, 0, 153, 185, 171, 116, 129, 153, 1, 184, 155, 99, 2, 169, 153, 8, 0, 33, 32, 3, 189, 186, 139, 115, 55, 217, 154, 128, 64, 21, 185, 11, 17, 152, 50, 232, 156, 66, 19, 153, 217, 158, 65, 20, 144, 170, 153, 154, 81, 53, 128, 220, 11, 50, 36, 168, 187, 187, 80, 38, 144, 186, 139, 66, 35, 176, 139, 176, 142, 68, 176, 26, 2, 8, 130, 204, 169, 112, 38, 168, 188, 8, 35, 1, 128, 128, 221, 26, 53, 145, 186, 185, 72, 37, 144, 138, 185, 43, 39, 152, 136, 144, 168, 40, 21, 136, 67, 248, 157, 18, 16, 130, 202, 40, 34, 250, 9, 50, 1, 145, 235, 10, 66, 0, 0, 252, 57, 22, 168, 155, 136, 65, 20, 184, 154, 137, 136, 17, 68, 4, 220, 9, 33, 128, 128, 8, 176, 155, 68, 35, 218, 203, 41, 87, 145, 188, 26, 52, 130, 168, 220, 26, 83, 129, 137, 128, 186, 137, 16, 87, 130, 219, 154, 32, 35, 128, 128, 218, 171, 99, 130, 10, 19, 250, 10, 52, 130, 185, 174, 32, 20, 129, 184, 157, 24, 18, 33, 36, 233, 172, 40, 53, 146, 187, 171, 32, 0, 114, 3, 204, 138, 49, 20, 144, 186, 11, 37, 168, 10, 136, 169, 73, 71, 168, 154, 136, 8, 16, 85, 145, 171, 221, 41, 23, 152, 128, 184, 25, 21, 160, 171, 114, 131, 218, 10, 33, 0, 32, 144, 155, 168, 9, 82, 22, 184, 40, 200, 157, 8, 83, 19, 185, 188, 11, 69, 131, 202, 8, 130, 25, 36, 220, 27, 34, 169, 115, 4, 203, 156, 16, 53, 27, 28, 73, 0, 1, 170, 186, 156, 72, 68, 130, 185, 188, 40, 36, 18, 185, 157, 129, 136, 16, 82, 130, 173, 9, 16, 53, 160, 153, 217, 171, 115, 21, 184, 154, 154, 56, 55, 144, 186, 187, 42, 103, 145, 170, 137, 17, 50, 161, 173, 128, 170, 113, 21, 169, 138, 136, 24, 50, 129, 170, 185, 172, 138, 101, 20, 161, 189, 153, 48, 55, 146, 204, 138, 18, 50, 130, 234, 171, 49, 19, 35, 176, 175, 48, 176, 89, 4, 187, 173, 49, 22, 128, 186, 42, 36, 168, 169, 138, 34, 17, 19, 188, 170, 42, 119, 160, 139, 169, 105, 37, 144, 154, 152, 187, 64, 130, 24, 36, 234, 10, 16, 99, 19, 202, 172, 139, 82, 2, 8, 216, 138, 51, 51, 193, 189, 138, 65, 83, 18, 235, 170, 136, 98, 131, 170, 168, 170, 113, 21, 144, 171, 137, 153, 49, 146, 27, 36, 168, 9, 35, 136, 186, 90, 6, 219, 10, 34, 33, 18, 236, 26, 36, 144, 186, 10, 102, 3, 169, 152, 204, 11, 34, 17, 18, 232, 26, 35, 83, 145, 187, 24, 210, 223, 32, 18, 129, 153, 187, 9, 83, 52, 161, 170, 202, 171, 112, 39, 201, 154, 16, 136, 50, 146, 25, 146, 188, 97, 37, 201, 139, 144, 155, 82, 34, 1, 216, 172, 32, 37, 3, 185, 189, 138, 82, 51, 192, 203, 187, 96, 53, 144, 170, 153, 24, 35, 2, 218, 171, 9, 19, 171, 114, 1, 128, 24, 185, 26, 35, 184, 56, 51, 83, 240, 223, 8, 17, 49, 35, 184, 188, 10, 84, 35, 146, 205, 155, 25, 66, 52, 176, 189, 25, 50, 1, 2, 218, 170, 25, 68, 36, 216, 156, 8, 1, 169, 40, 55, 160, 172, 32, 1, 17, 18, 248, 172, 8, 49, 37, 145, 170, 219, 155, 98, 35, 16, 200, 205, 26, 52, 18, 169, 188, 11, 82, 34, 2, 234, 171, 48, 52, 35, 176, 190, 155, 64, 53, 2, 202, 187, 154, 82, 53, 129, 186, 171, 41, 84, 2, 185, 190, 154, 49, 39, 145, 156, 8, 33, 50, 1, 217, 172, 137, 137, 49, 130, 8, 136, 136, 8, 83, 130, 154, 136, 8, 32, 99, 192, 207, 155, 33, 2, 8, 17, 67, 101, 52, 146, 235, 203, 153, 32, 33, 50, 128, 25, 52, 176, 174, 170, 0, 160, 140, 1, 154, 112, 53, 128, 202, 190, 137, 0, 49, 37, 136, 169, 188, 24, 217, 140, 17, 128, 24, 1, 49, 52, 128, 235, 138, 169, 173, 48, 70, 2, 49, 38, 145, 138, 128, 49, 71, 35, 1, 17, 16, 1, 32, 3, 153, 33, 85, 19, 48, 53, 36, 161, 172, 153, 137, 145, 48, 216, 12, 200, 189, 168, 205, 170, 137, 17, 144, 171, 233, 206, 170, 219, 170, 187, 170, 138, 33, 0, 18, 185, 221, 188, 156, 138, 169, 186, 138, 50, 145, 9, 34, 81, 54, 66, 52, 18, 161, 223, 138, 154, 8, 0, 50, 83, 69, 36, 18, 1, 154, 169, 203, 203, 124, 241, 39, 0, 189, 154, 137, 50, 19, 48, 51, 200, 40, 131, 114, 227, 172, 185, 173, 153, 153, 137, 112, 54, 18, 65, 20, 16, 152, 8, 200, 10, 177, 11, 34, 116, 55, 16, 34, 144, 33, 144, 64, 21, 33, 2, 153, 168, 24, 249, 12, 2, 1, 48, 5, 223, 138, 33, 34, 152, 64, 20, 152, 234, 155, 153, 24, 68, 1, 136, 152, 171, 113, 3, 155, 49, 251, 189, 137, 50, 20, 184, 58, 5, 171, 82, 146, 8, 146, 158, 49, 129, 32, 21, 200, 9, 33, 130, 188, 50, 240, 173, 170, 137, 144, 222, 203, 219, 188, 187, 72, 54, 50, 69, 18, 136, 8, 152, 8, 128, 16, 129, 10, 84, 84, 83, 34, 1, 8, 1, 136, 16, 34, 145, 207, 172, 169, 186, 10, 51, 51, 68, 129, 203, 204, 188, 187, 220, 172, 171, 186, 154, 8, 34, 0, 136, 253, 171, 152, 186, 155, 201, 188, 187, 187, 10, 69, 35, 67, 51, 17, 17, 34, 128, 24, 201, 205, 138, 49, 86, 69, 34, 67, 19, 1, 0, 0, 144, 137, 8, 184, 206, 10, 51, 19, 51, 35, 248, 172, 171, 137, 201, 187, 252, 189, 171, 154, 8, 49, 34, 50, 146, 170, 137, 16, 224, 174, 153, 203, 41, 85, 83, 35, 34, 18, 1, 0, 97, 52, 50, 18, 0, 185, 42, 51, 119, 51, 49, 34, 49, 146, 42, 69, 50, 192, 190, 138, 170, 137, 66, 52, 161, 172, 202, 188, 171, 155, 144, 204, 153, 203, 137, 128, 82, 2, 153, 251, 187, 170, 24, 67, 83, 52, 160, 154, 153, 115, 18, 68, 34, 35, 168, 40, 19, 66, 35, 36, 145, 25, 18, 115, 55, 51, 50, 128, 170, 204, 171, 24, 34, 128, 66, 249, 175, 168, 139, 129, 137, 146, 172, 234, 189, 154, 128, 153, 154, 186, 238, 170, 153, 41, 53, 0, 50, 200, 139, 169, 57, 87, 33, 35, 176, 189, 170, 8, 65, 69, 69, 1, 137, 128, 153, 65, 84, 2, 137, 129, 188, 154, 154, 115, 128, 24, 184, 139, 184, 11, 19, 236, 235, 220, 203, 154, 32, 99, 84, 51, 18, 0, 152, 203, 186, 8, 1, 40, 67, 34, 84, 68, 34, 51, 1, 169, 153, 188, 153, 136, 144, 205, 172, 186, 156, 40, 52, 68, 2, 168, 204, 205, 188, 171, 187, 156, 154, 136, 16, 16, 66, 130, 219, 188, 204, 187, 171, 154, 8, 1, 0, 49, 35, 85, 52, 52, 34, 50, 145, 154, 169, 152, 10, 84, 84, 68, 52, 53, 50, 34, 129, 154, 188, 173, 170, 154, 0, 0, 34, 19, 1, 202, 205, 204, 204, 187, 187, 204, 170, 186, 187, 171, 155, 8, 16, 17, 51, 216, 189, 189, 189, 155, 9, 82, 68, 52, 52, 51, 35, 17, 35, 17, 50, 69, 83, 50, 37, 34, 36, 33, 50, 67, 51, 33, 52, 1, 144, 137, 2, 223, 137, 128, 137, 16, 33, 35, 161, 239, 171, 220, 187, 137, 136, 169, 48, 21, 0, 153, 65, 167, 253, 42, 0, 162, 172, 202, 156, 168, 26, 36, 115, 37, 34, 51, 1, 34, 17, 51, 83, 51, 34, 38, 0, 115, 18, 82, 18, 32, 0, 0, 153, 24, 18, 202, 155, 251, 158, 152, 170, 218, 187, 217, 174, 154, 202, 137, 202, 155, 169, 172, 170, 171, 202, 155, 171, 154, 207, 24, 192, 56, 35, 68, 17, 68, 184, 64, 162, 57, 21, 8, 66, 34, 185, 120, 6, 9, 84, 129, 24, 2, 137, 64, 147, 220, 40, 200, 140, 19, 56, 39, 136, 17, 185, 171, 170, 115, 131, 25, 20, 169, 221, 138, 128, 48, 131, 27, 21, 222, 138, 136, 153, 202, 203, 219, 170, 114, 69, 67, 51, 2, 168, 205, 171, 138, 0, 67, 52, 18, 17, 17, 33, 18, 0, 160, 236, 203, 155, 8, 1, 0, 152, 251, 172, 155, 8, 50, 20, 2, 251, 190, 188, 203, 170, 137, 0, 18, 18, 18, 18, 184, 219, 221, 186, 187, 171, 8, 66, 53, 36, 35, 35, 1, 17, 0, 65, 34, 67, 129, 153, 0, 1, 66, 87, 52, 52, 67, 34, 2, 185, 205, 188, 203, 170, 9, 16, 49, 50, 34, 168, 221, 188, 189, 172, 171, 154, 170, 137, 168, 170, 219, 154, 136, 49, 54, 51, 21, 144, 169, 188, 154, 57, 103, 67, 52, 67, 51, 18, 18, 0, 136, 170, 49, 53, 69, 67, 35, 34, 16, 128, 137, 129, 154, 168, 171, 233, 174, 24, 234, 154, 152, 49, 163, 57, 55, 201, 156, 161, 207, 137, 160, 171, 50, 2, 116, 35, 17, 17, 145, 188, 153, 170, 169, 56, 55, 51, 52, 53, 51, 34, 128, 56, 21, 202, 25, 144, 187, 40, 83, 52, 34, 52, 131, 154, 153, 24, 248, 175, 203, 220, 171, 138, 137, 0, 33, 129, 220, 172, 153, 186, 187, 219, 203, 189, 172, 136, 16, 51, 68, 3, 152, 153, 185, 172, 49, 67, 51, 168, 40, 37, 56, 119, 2, 66, 162, 138, 51, 250, 73, 20, 152, 24, 2, 128, 152, 140, 68, 128, 34, 2, 33, 192, 190, 153, 203, 56, 5, 11, 70, 160, 25, 3, 206, 41, 162, 142, 34, 200, 10, 128, 154, 136, 202, 187, 251, 189, 40, 86, 83, 67, 50, 129, 186, 204, 187, 138, 32, 84, 51, 51, 34, 34, 18, 144, 169, 221, 173, 170, 138, 32, 51, 37, 129, 184, 204, 187, 203, 153, 136, 186, 221, 203, 203, 187, 155, 137, 17, 17, 34, 144, 187, 206, 189, 189, 187, 187, 154, 49, 70, 52, 67, 33, 128, 168, 186, 170, 137, 24, 69, 34, 83, 68, 34, 51, 35, 18, 0, 144, 136, 138, 169, 205, 187, 154, 9, 114, 53, 35, 19, 176, 206, 205, 203, 171, 171, 154, 136, 0, 17, 17, 129, 201, 204, 204, 172, 171, 170, 9, 33, 51, 52, 66, 52, 51, 38, 50, 51, 50, 18, 34, 50, 35, 116, 55, 52, 68, 50, 34, 17, 0, 137, 168, 8, 145, 25, 70, 18, 115, 35, 0, 17, 160, 187, 189, 236, 171, 138, 10, 51, 0, 136, 137, 1, 25, 131, 172, 201, 141, 50, 169, 64, 193, 174, 185, 171, 187, 56, 20, 83, 51, 82, 35, 169, 56, 4, 204, 9, 33, 152, 88, 55, 36, 51, 34, 52, 160, 139, 17, 128, 48, 52, 52, 4, 139, 53, 144, 82, 52, 145, 26, 193, 191, 170, 138, 160, 172, 8, 202, 203, 189, 9, 168, 189, 187, 235, 205, 154, 152, 136, 0, 128, 168, 219, 189, 10, 17, 8, 81, 20, 185, 137, 17, 184, 121, 55, 169, 32, 145, 57, 55, 34, 52, 1, 136, 168, 204, 9, 17, 84, 2, 64, 2, 170, 9, 9, 33, 70, 129, 170, 204, 186, 188, 56, 2, 65, 130, 186, 222, 154, 169, 154, 0, 67, 192, 157, 1, 217, 155, 49, 209, 156, 16, 169, 9, 128, 113, 20, 201, 138, 249, 173, 137, 82, 69, 68, 35, 19, 144, 202, 204, 138, 9, 48, 53, 36, 35, 18, 18, 145, 169, 235, 187, 188, 156, 16, 50, 68, 50, 1, 201, 204, 187, 188, 171, 169, 137, 168, 185, 190, 186, 189, 153, 170, 9, 160, 220, 187, 187, 191, 187, 187, 154, 9, 65, 85, 35, 18, 129, 186, 205, 187, 137, 24, 81, 53, 52, 67, 34, 18, 0, 169, 188, 154, 32, 52, 69, 52, 35, 18, 16, 1, 169, 172, 154, 219, 139, 136, 80, 19, 24, 3, 137, 250, 188, 203, 171, 189, 154, 201, 155, 153, 8, 17, 99, 50, 18, 251, 171, 219, 171, 137, 0, 66, 68, 50, 52, 35, 34, 1, 8, 154, 114, 37, 49, 35, 66, 35, 33, 100, 37, 16, 18, 17, 144, 56, 37, 48, 4, 25, 36, 169, 56, 38, 0, 83, 162, 11, 2, 154, 0, 65, 52, 160, 139, 1, 223, 11, 129, 170, 144, 190, 56, 130, 11, 87, 145, 139, 160, 191, 25, 160, 27, 36, 186, 8, 153, 137, 235, 171, 136, 255, 10, 129, 138, 33, 33, 34, 18, 0, 152, 239, 25, 144, 26, 53, 83, 2, 65, 35, 65, 18, 32, 232, 139, 169, 80, 2, 116, 4, 0, 129, 136, 168, 137, 128, 49, 162, 104, 37, 0, 17, 0, 144, 137, 251, 9, 144, 42, 3, 50, 251, 158, 169, 172, 154, 65, 3, 50, 147, 173, 235, 188, 204, 155, 137, 153, 33, 51, 34, 128, 250, 191, 170, 188, 171, 153, 34, 66, 53, 35, 8, 185, 205, 173, 138, 8, 50, 34, 66, 37, 1, 17, 129, 202, 170, 187, 24, 50, 119, 20, 128, 1, 152, 137, 169, 11, 83, 19, 67, 37, 144, 137, 233, 171, 153, 24, 19, 48, 71, 130, 138, 145, 207, 154, 170, 10, 152, 49, 86, 162, 140, 35, 222, 154, 136, 128, 40, 83, 1, 168, 153, 184, 175, 24, 129, 170, 154, 33, 144, 65, 37, 192, 188, 154, 186, 154, 64, 39, 129, 8, 36, 201, 155, 251, 157, 0, 24, 52, 2, 1, 128, 235, 172, 40, 2, 203, 72, 2, 187, 72, 21, 1, 50, 18, 250, 173, 137, 169, 139, 115, 5, 8, 177, 244, 48, 0, 33, 1, 9, 114, 35, 184, 189, 154, 219, 11, 86, 37, 51, 35, 2, 160, 204, 170, 153, 24, 66, 67, 68, 51, 35, 18, 18, 218, 188, 186, 219, 138, 67, 34, 68, 2, 152, 169, 205, 171, 171, 170, 152, 171, 8, 192, 155, 202, 219, 235, 203, 170, 187, 187, 136, 186, 173, 171, 204, 187, 138, 152, 153, 152, 218, 205, 203, 154, 170, 9, 18, 83, 1, 65, 36, 136, 33, 192, 188, 169, 154, 82, 84, 68, 51, 34, 18, 0, 136, 170, 32, 37, 16, 85, 19, 32, 67, 34, 34, 20, 49, 35, 153, 50, 3, 50, 83, 38, 128, 83, 19, 32, 84, 18, 64, 2, 32, 129, 203, 205, 138, 200, 42, 21, 32, 20, 32, 128, 153, 189, 32, 252, 10, 144, 153, 65, 18, 137, 99, 129, 138, 169, 170, 186, 9, 16, 168, 120, 21, 137, 50, 66, 20, 137, 21, 236, 10, 144, 153, 81, 3, 32, 35, 8, 0, 152, 24, 163, 239, 56, 19, 138, 116, 132, 169, 0, 153, 144, 138, 52, 33, 52, 52, 130, 154, 187, 220, 173, 48, 2, 65, 69, 18, 18, 2, 0, 216, 206, 11, 36, 153, 97, 35, 136, 24, 160, 188, 185, 56, 194, 12, 55, 129, 16, 36, 160, 138, 153, 187, 186, 11, 68, 53, 49, 54, 161, 11, 161, 157, 0, 138, 99, 1, 16, 130, 203, 8, 249, 139, 33, 1, 201, 107, 23, 186, 8, 185, 171, 137, 170, 114, 6, 24, 3, 185, 154, 217, 189, 16, 129, 41, 68, 67, 18, 144, 136, 200, 173, 8, 144, 41, 19, 116, 19, 128, 16, 17, 201, 138, 9, 83, 34, 68, 19, 144, 136, 201, 171, 153, 24, 66, 55, 19, 152, 139, 160, 191, 170, 221, 153, 136, 66, 52, 2, 154, 145, 255, 138, 169, 170, 17, 129, 10, 20, 9, 129, 204, 187, 206, 171, 136, 169, 25, 50, 2, 1, 160, 255, 139, 185, 173, 8, 128, 66, 35, 144, 26, 210, 174, 1, 169, 153, 49, 19, 9, 81, 51, 177, 56, 180, 14, 18, 50, 38, 68, 18, 51, 176, 155, 128, 206, 9, 68, 67, 35, 50, 38, 176, 156, 168, 188, 138, 128, 65, 52, 33, 70, 1, 9, 152, 202, 219, 186, 138, 128, 42, 68, 19, 160, 33, 168, 33, 252, 172, 218, 171, 154, 187, 25, 35, 0, 66, 2, 169, 252, 189, 204, 188, 170, 137, 153, 49, 33, 35, 204, 128, 236, 219, 170, 203, 155, 0, 17, 34, 67, 1, 16, 24, 69, 130, 8, 129, 48, 38, 128, 102, 35, 33, 83, 36, 18, 34, 35, 33, 51, 51, 17, 117, 34, 83, 3, 50, 21, 16, 0, 8, 169, 24, 152, 169, 88, 6, 138, 19, 219, 16, 202, 186, 191, 170, 173, 168, 187, 129, 204, 9, 153, 251, 155, 202, 189, 170, 171, 153, 170, 137, 202, 205, 186, 204, 187, 219, 155, 153, 186, 154, 184, 191, 171, 219, 186, 170, 171, 202, 171, 169, 170, 203, 190, 156, 186, 173, 63, 240, 26, 0, 138, 152, 9, 1, 154, 1, 171, 169, 223, 187, 155, 51, 18, 117, 51, 50, 17, 82, 129, 139, 17, 17, 68, 84, 36, 66, 53, 50, 51, 34, 52, 129, 48, 19, 97, 70, 34, 35, 51, 68, 18, 49, 20, 16, 18, 1, 66, 52, 68, 51, 69, 34, 17, 2, 152, 8, 17, 17, 115, 52, 51, 68, 18, 8, 152, 154, 144, 139, 24, 70, 17, 50, 131, 137, 24, 184, 189, 189, 10, 50, 65, 85, 36, 0, 169, 203, 203, 138, 1, 32, 71, 35, 17, 19, 153, 153, 206, 137, 128, 81, 21, 50, 52, 18, 32, 145, 171, 16, 185, 74, 55, 83, 85, 34, 0, 18, 184, 154, 202, 171, 168, 64, 20, 51, 1, 99, 168, 188, 190, 203, 188, 169, 136, 128, 25, 20, 185, 187, 239, 172, 170, 187, 187, 9, 130, 24, 19, 185, 235, 204, 205, 187, 186, 187, 153, 152, 8, 85, 1, 136, 168, 206, 203, 170, 170, 25, 2, 65, 36, 34, 21, 145, 144, 204, 186, 138, 16, 65, 54, 67, 51, 18, 35, 200, 155, 137, 9, 49, 55, 68, 67, 16, 51, 2, 16, 0, 169, 74, 6, 153, 52, 33, 67, 68, 131, 16, 0, 169, 139, 168, 157, 32, 192, 157, 67, 176, 104, 5, 186, 27, 146, 173, 136, 186, 139, 137, 49, 22, 9, 35, 0, 130, 223, 170, 186, 189, 139, 168, 40, 71, 2, 65, 131, 188, 235, 171, 222, 171, 186, 137, 144, 137, 40, 83, 17, 1, 220, 219, 171, 172, 139, 137, 16, 18, 68, 67, 18, 32, 131, 202, 203, 25, 144, 113, 22, 66, 36, 33, 36, 0, 17, 128, 24, 35, 82, 38, 49, 38, 17, 51, 18, 50, 160, 1, 172, 99, 169, 115, 2, 32, 34, 51, 169, 137, 201, 207, 169, 153, 137, 153, 24, 129, 170, 220, 190, 203, 219, 203, 203, 153, 186, 157, 153, 170, 186, 189, 219, 188, 187, 173, 202, 170, 202, 186, 169, 187, 219, 188, 203, 202, 187, 187, 219, 154, 170, 187, 187, 219, 187, 186, 220, 187, 170, 154, 153, 204, 154, 184, 187, 187, 170, 154, 115, 1, 33, 33, 71, 34, 18, 18, 51, 99, 52, 52, 68, 36, 33, 53, 19, 49, 37, 18, 99, 33, 66, 35, 83, 67, 51, 34, 52, 67, 34, 67, 50, 67, 68, 66, 50, 18, 66, 37, 34, 34, 49, 36, 32, 69, 2, 49, 52, 18, 49, 18, 50, 68, 18, 34, 17, 83, 34, 54, 129, 49, 144, 98, 145, 56, 3, 155, 1, 220, 138, 144, 114, 37, 128, 34, 184, 171, 184, 190, 25, 35, 33, 38, 0, 67, 144, 40, 163, 206, 40, 50, 130, 138, 68, 68, 51, 66, 37, 2, 16, 152, 138, 71, 1, 34, 65, 21, 128, 17, 32, 37, 185, 9, 50, 145, 174, 81, 146, 172, 1, 235, 171, 153, 8, 8, 169, 188, 219, 204, 187, 138, 251, 156, 168, 204, 138, 186, 156, 145, 173, 153, 173, 154, 170, 185, 173, 219, 172, 154, 6, 2, 21, 0, 137, 153, 187, 187, 203, 205, 171, 185, 172, 16, 220, 41, 146, 188, 10, 145, 9, 176, 158, 99, 130, 136, 34, 1, 153, 72, 195, 158, 35, 19, 177, 27, 103, 145, 41, 36, 153, 18, 185, 98, 131, 171, 33, 66, 69, 129, 24, 35, 217, 139, 2, 203, 64, 35, 51, 192, 26, 2, 254, 26, 2, 203, 16, 201, 41, 2, 171, 32, 209, 172, 153, 219, 153, 185, 186, 156, 1, 202, 9, 234, 139, 233, 41, 21, 48, 240, 10, 176, 155, 185, 104, 3, 154, 8, 50, 192, 43, 193, 175, 9, 19, 234, 56, 178, 13, 160, 156, 0, 169, 205, 153, 201, 26, 128, 137, 168, 169, 186, 188, 203, 190, 172, 170, 171, 0, 236, 58, 21, 186, 41, 192, 157, 17, 217, 26, 1, 40, 69, 146, 41, 132, 9, 200, 27, 148, 157, 49, 128, 219, 74, 4, 154, 66, 16, 16, 169, 32, 177, 171, 98, 131, 171, 201, 26, 35, 50, 250, 170, 26, 22, 172, 84, 129, 0, 9, 153, 25, 147, 156, 251, 140, 50, 168, 171, 57, 146, 156, 146, 60, 87, 169, 65, 168, 137, 168, 80, 232, 140, 128, 33, 218, 16, 161, 17, 186, 144, 140, 193, 29, 22, 24, 52, 34, 0, 18, 168, 81, 1, 153, 12, 103, 17, 51, 1, 83, 16, 3, 207, 50, 161, 48, 129, 81, 3, 24, 68, 17, 16, 34, 68, 1, 80, 19, 153, 82, 52, 35, 50, 52, 53, 177, 28, 20, 9, 68, 33, 66, 52, 129, 24, 1, 17, 161, 104, 19, 8, 18, 49, 164, 74, 133, 142, 2, 204, 64, 144, 25, 146, 26, 131, 173, 17, 235, 25, 50, 184, 10, 232, 27, 6, 171, 49, 193, 156, 98, 192, 156, 1, 170, 49, 145, 204, 24, 216, 172, 9, 128, 9, 0, 186, 187, 114, 135, 138, 144, 204, 136, 153, 128, 24, 145, 142, 16, 153, 186, 96, 19, 25, 1, 49, 148, 154, 218, 112, 21, 16, 168, 155, 201, 153, 202, 27, 84, 2, 8, 169, 8, 252, 27, 3, 201, 155, 0, 49, 18, 48, 248, 56, 240, 13, 160, 171, 34, 218, 9, 1, 219, 10, 130, 33, 250, 26, 128, 217, 140, 21, 186, 16, 152, 169, 138, 8, 100, 192, 41, 21, 128, 9, 83, 18, 9, 32, 37, 187, 32, 168, 137, 191, 49, 36, 18, 9, 18, 251, 10, 162, 171, 34, 177, 189, 155, 99, 178, 189, 176, 255, 25, 144, 171, 17, 82, 36, 144, 8, 129, 252, 139, 152, 156, 83, 35, 35, 66, 36, 144, 139, 85, 161, 154, 137, 144, 140, 67, 33, 53, 8, 49, 35, 218, 137, 185, 114, 129, 24, 152, 16, 152, 170, 252, 173, 137, 169, 173, 137, 201, 171, 9, 201, 58, 131, 27, 132, 205, 171, 171, 170, 186, 205, 139, 16, 84, 19, 51, 17, 55, 218, 40, 2, 33, 36, 51, 37, 2, 218, 137, 152, 65, 1, 85, 176, 158, 185, 156, 48, 2, 185, 223, 138, 9, 33, 50, 54, 69, 255, 28, 0, 17, 69, 18, 17, 34, 17, 24, 84, 1, 32, 160, 42, 52, 168, 139, 68, 184, 89, 131, 25, 145, 89, 195, 190, 234, 171, 184, 188, 188, 153, 217, 188, 186, 173, 137, 169, 187, 154, 153, 8, 2, 203, 16, 202, 136, 113, 36, 9, 70, 129, 153, 24, 67, 185, 42, 35, 114, 3, 64, 35, 115, 37, 50, 1, 50, 17, 52, 18, 68, 129, 33, 2, 17, 184, 26, 152, 99, 168, 8, 234, 153, 251, 188, 235, 172, 169, 155, 16, 34, 66, 2, 99, 131, 188, 155, 24, 146, 10, 71, 50, 68, 18, 18, 184, 9, 129, 155, 218, 10, 53, 176, 172, 154, 185, 239, 138, 152, 186, 185, 156, 0, 206, 138, 184, 171, 218, 140, 0, 185, 172, 9, 35, 160, 59, 37, 8, 69, 34, 36, 67, 37, 218, 153, 168, 33, 146, 97, 36, 50, 1, 128, 176, 191, 170, 202, 155, 1, 24, 69, 34, 18, 201, 154, 205, 9, 202, 26, 19, 64, 4, 32, 20, 170, 250, 155, 8, 49, 52, 49, 53, 130, 8, 161, 205, 138, 8, 32, 53, 50, 54, 33, 131, 154, 192, 159, 49, 34, 68, 51, 71, 18, 0, 129, 153, 218, 140, 17, 33, 19, 66, 19, 168, 202, 140, 129, 205, 137, 98, 36, 16, 51, 145, 138, 1, 33, 144, 64, 130, 32, 130, 115, 133, 26, 38, 169, 8, 153, 128, 11, 51, 114, 23, 1, 129, 9, 0, 137, 218, 187, 253, 138, 128, 10, 82, 18, 8, 83, 144, 184, 174, 129, 153, 66, 168, 42, 19, 16, 240, 207, 154, 138, 152, 9, 52, 50, 35, 1, 18, 237, 170, 152, 169, 27, 53, 144, 19, 239, 10, 201, 138, 186, 24, 216, 173, 136, 168, 221, 187, 169, 188, 173, 136, 169, 170, 137, 0, 235, 154, 202, 8, 192, 25, 19, 8, 68, 33, 1, 66, 68, 50, 83, 68, 35, 51, 53, 51, 67, 51, 36, 99, 51, 49, 53, 2, 50, 34, 68, 18, 66, 50, 52, 17, 33, 17, 36, 152, 48, 3, 137, 116, 21, 152, 8, 51, 192, 173, 169, 202, 188, 169, 186, 154, 170, 170, 205, 169, 251, 188, 154, 170, 206, 171, 170, 172, 187, 171, 202, 190, 154, 152, 219, 187, 170, 186, 205, 171, 136, 187, 189, 172, 144, 220, 154, 153, 137, 203, 10, 128, 219, 138, 169, 171, 136, 154, 251, 157, 17, 17, 162, 158, 35, 160, 64, 161, 56, 147, 10, 51, 118, 2, 73, 71, 129, 136, 33, 35, 152, 64, 22, 1, 35, 34, 34, 0, 83, 18, 16, 34, 99, 36, 1, 66, 50, 129, 138, 48, 53, 184, 112, 55, 168, 170, 65, 162, 175, 40, 3, 152, 32, 53, 129, 139, 145, 154, 18, 41, 119, 1, 66, 19, 17, 160, 48, 146, 138, 0, 119, 35, 16, 50, 68, 19, 24, 83, 129, 41, 53, 16, 114, 34, 0, 49, 17, 50, 16, 70, 1, 99, 130, 9, 136, 40, 176, 158, 144, 27, 20, 139, 37, 202, 49, 216, 1, 13, 29, 0, 10, 200, 157, 16, 128, 170, 154, 251, 155, 220, 173, 152, 153, 152, 16, 1, 185, 138, 161, 239, 154, 137, 219, 155, 24, 83, 146, 25, 38, 184, 41, 18, 136, 24, 34, 236, 172, 153, 185, 189, 138, 25, 85, 2, 50, 130, 154, 187, 169, 255, 25, 128, 65, 19, 137, 49, 2, 251, 141, 16, 144, 16, 84, 3, 136, 128, 169, 217, 174, 25, 17, 144, 41, 21, 251, 203, 171, 202, 187, 154, 32, 2, 49, 2, 202, 170, 219, 204, 24, 51, 66, 70, 51, 67, 34, 36, 17, 51, 99, 52, 50, 84, 51, 19, 18, 84, 18, 17, 33, 53, 36, 16, 66, 19, 0, 48, 34, 129, 9, 66, 1, 218, 139, 168, 223, 171, 170, 170, 188, 170, 186, 251, 188, 186, 205, 187, 188, 172, 186, 172, 187, 203, 219, 172, 187, 219, 187, 156, 170, 171, 155, 187, 204, 203, 171, 203, 187, 171, 138, 154, 185, 204, 153, 235, 172, 169, 186, 153, 136, 18, 168, 24, 67, 146, 223, 56, 20, 136, 66, 54, 18, 32, 67, 17, 16, 50, 52, 68, 68, 67, 19, 49, 52, 18, 32, 99, 52, 50, 35, 99, 35, 17, 49, 50, 51, 18, 70, 18, 16, 18, 50, 131, 170, 96, 68, 128, 98, 35, 128, 17, 16, 129, 16, 130, 114, 55, 32, 18, 83, 130, 170, 24, 17, 16, 49, 70, 53, 160, 25, 4, 202, 153, 33, 36, 49, 67, 69, 2, 41, 51, 32, 152, 113, 5, 48, 67, 50, 36, 17, 18, 97, 36, 66, 53, 17, 34, 33, 35, 49, 131, 27, 71, 0, 34, 9, 71, 201, 26, 18, 128, 0, 67, 129, 169, 202, 187, 235, 188, 154, 153, 8, 186, 41, 37, 216, 191, 9, 176, 191, 137, 128, 235, 171, 170, 154, 185, 157, 8, 220, 139, 128, 186, 173, 16, 160, 172, 10, 17, 176, 190, 40, 4, 186, 40, 85, 131, 171, 98, 18, 152, 204, 9, 152, 170, 137, 185, 44, 54, 19, 184, 115, 23, 24, 1, 169, 170, 186, 188, 139, 67, 160, 66, 2, 50, 130, 67, 161, 203, 205, 137, 233, 188, 203, 8, 217, 155, 168, 24, 193, 207, 171, 152, 169, 188, 10, 128, 8, 137, 49, 33, 37, 184, 49, 176, 120, 39, 68, 35, 83, 2, 50, 18, 80, 37, 33, 67, 67, 51, 34, 52, 17, 52, 36, 33, 68, 51, 17, 51, 18, 82, 50, 33, 50, 38, 1, 49, 144, 154, 234, 173, 170, 153, 168, 188, 202, 189, 173, 219, 219, 170, 186, 188, 203, 186, 219, 188, 186, 219, 171, 187, 203, 219, 187, 169, 188, 172, 171, 203, 172, 153, 203, 154, 168, 172, 154, 185, 173, 138, 202, 203, 170, 169, 154, 154, 153, 186, 203, 10, 128, 189, 40, 101, 35, 17, 84, 51, 2, 16, 49, 115, 35, 66, 85, 35, 18, 98, 18, 128, 33, 66, 52, 35, 51, 38, 18, 50, 1, 0, 99, 51, 1, 66, 53, 1, 1, 152, 57, 37, 153, 113, 37, 128, 229, 250, 33, 0, 8, 35, 161, 188, 57, 38, 160, 42, 87, 3, 185, 41, 20, 202, 11, 52, 18, 65, 52, 20, 0, 17, 1, 33, 2, 114, 53, 35, 136, 65, 131, 155, 137, 33, 131, 57, 54, 35, 1, 100, 162, 57, 23, 16, 35, 65, 53, 152, 8, 40, 35, 171, 114, 68, 2, 153, 65, 192, 188, 9, 129, 152, 9, 48, 23, 250, 154, 152, 152, 189, 48, 130, 171, 137, 144, 206, 170, 154, 8, 219, 10, 50, 131, 191, 10, 200, 155, 170, 72, 162, 139, 4, 220, 251, 156, 136, 186, 171, 64, 147, 156, 152, 219, 170, 171, 169, 42, 69, 33, 52, 200, 11, 1, 201, 174, 64, 18, 49, 1, 48, 147, 190, 137, 16, 2, 41, 119, 130, 153, 24, 0, 220, 156, 49, 19, 170, 113, 22, 200, 9, 1, 170, 136, 33, 129, 153, 16, 161, 239, 154, 169, 137, 168, 42, 131, 80, 162, 157, 185, 59, 7, 9, 52, 18, 68, 2, 128, 169, 49, 144, 114, 22, 128, 33, 4, 252, 155, 185, 138, 185, 26, 68, 0, 32, 3, 219, 139, 18, 233, 172, 64, 35, 144, 25, 53, 145, 16, 16, 100, 53, 37, 32, 51, 1, 17, 136, 33, 9, 103, 17, 17, 33, 67, 128, 9, 33, 51, 18, 85, 130, 9, 49, 240, 205, 153, 154, 136, 185, 25, 3, 234, 188, 153, 235, 171, 169, 186, 189, 171, 204, 188, 188, 172, 187, 186, 171, 154, 201, 171, 202, 172, 234, 187, 169, 172, 169, 154, 152, 188, 219, 171, 136, 187, 32, 1, 201, 156, 129, 238, 138, 16, 202, 171, 32, 131, 174, 17, 34, 160, 60, 103, 1, 16, 34, 34, 129, 8, 51, 51, 20, 114, 38, 0, 16, 50, 17, 49, 53, 99, 36, 17, 33, 50, 20, 152, 49, 51, 38, 1, 84, 50, 17, 136, 50, 3, 72, 71, 19, 49, 83, 17, 128, 9, 33, 52, 68, 52, 52, 51, 52, 168, 10, 34, 17, 115, 54, 35, 50, 20, 152, 136, 136, 168, 88, 39, 33, 66, 34, 144, 189, 154, 136, 152, 81, 54, 18, 0, 169, 170, 237, 155, 137, 0, 33, 18, 0, 152, 239, 172, 136, 144, 155, 98, 18, 152, 144, 153, 235, 188, 137, 16, 35, 49, 55, 145, 137, 0, 170, 57, 53, 52, 20, 83, 3, 152, 202, 187, 138, 0, 114, 52, 152, 40, 216, 173, 137, 153, 154, 16, 0, 137, 185, 223, 188, 186, 205, 154, 137, 136, 153, 202, 189, 170, 204, 171, 185, 187, 8, 202, 139, 250, 157, 144, 188, 8, 169, 138, 51, 217, 11, 1, 187, 41, 3, 171, 50, 200, 72, 35, 32, 178, 207, 0, 138, 103, 161, 72, 20, 172, 81, 3, 25, 51, 50, 249, 12, 34, 201, 9, 33, 33, 68, 129, 9, 145, 236, 10, 2, 170, 67, 201, 48, 193, 191, 32, 128, 0, 9, 99, 1, 185, 25, 145, 90, 132, 40, 23, 129, 33, 36, 251, 25, 160, 11, 69, 128, 32, 51, 184, 25, 34, 37, 233, 0, 29, 0, 17, 87, 35, 184, 172, 153, 24, 18, 113, 54, 2, 202, 189, 203, 170, 154, 33, 20, 137, 49, 161, 173, 49, 19, 66, 19, 1, 184, 235, 10, 37, 144, 16, 32, 2, 114, 87, 33, 51, 1, 1, 153, 51, 168, 83, 129, 16, 1, 193, 175, 16, 137, 40, 84, 36, 17, 18, 169, 187, 207, 187, 172, 152, 153, 8, 218, 172, 170, 186, 155, 0, 137, 84, 176, 9, 249, 189, 173, 187, 203, 154, 24, 8, 136, 137, 0, 128, 137, 65, 52, 17, 66, 37, 160, 8, 251, 174, 171, 154, 169, 9, 66, 18, 32, 129, 189, 152, 203, 187, 189, 169, 221, 203, 203, 172, 170, 139, 16, 0, 65, 51, 35, 18, 50, 21, 32, 71, 129, 32, 176, 12, 161, 9, 37, 50, 55, 50, 50, 83, 68, 2, 17, 33, 16, 0, 32, 36, 144, 185, 25, 86, 85, 34, 65, 36, 18, 51, 39, 34, 2, 33, 3, 137, 1, 113, 131, 156, 34, 16, 52, 8, 102, 130, 65, 19, 34, 19, 8, 170, 64, 4, 65, 3, 188, 187, 155, 234, 42, 54, 36, 1, 82, 20, 152, 137, 0, 144, 153, 17, 18, 188, 9, 185, 113, 23, 48, 68, 18, 1, 17, 0, 129, 191, 33, 216, 154, 186, 136, 191, 56, 145, 64, 177, 104, 147, 57, 23, 8, 1, 16, 200, 174, 136, 154, 203, 27, 162, 159, 145, 171, 129, 175, 8, 185, 203, 172, 144, 189, 137, 236, 137, 144, 171, 0, 128, 186, 171, 187, 137, 236, 9, 185, 174, 137, 185, 188, 186, 186, 221, 25, 128, 9, 162, 27, 210, 14, 2, 139, 145, 140, 37, 186, 49, 34, 71, 160, 42, 34, 0, 98, 38, 0, 33, 202, 32, 130, 187, 88, 3, 140, 2, 173, 118, 145, 24, 34, 33, 34, 170, 101, 161, 154, 171, 55, 236, 40, 146, 24, 146, 25, 36, 185, 10, 69, 18, 8, 49, 84, 161, 141, 35, 186, 10, 16, 177, 159, 51, 160, 8, 56, 87, 185, 65, 162, 155, 3, 190, 25, 201, 170, 80, 147, 140, 21, 153, 16, 185, 81, 1, 67, 144, 9, 34, 248, 191, 50, 201, 57, 130, 32, 146, 56, 35, 35, 185, 115, 241, 41, 147, 139, 146, 223, 186, 204, 171, 137, 25, 82, 35, 0, 83, 160, 57, 39, 1, 33, 19, 152, 170, 138, 24, 129, 205, 48, 3, 80, 68, 83, 17, 24, 168, 154, 145, 191, 9, 184, 191, 156, 185, 173, 0, 137, 66, 1, 0, 129, 1, 219, 72, 146, 9, 160, 154, 251, 172, 201, 154, 185, 24, 35, 115, 4, 34, 131, 137, 184, 57, 194, 29, 19, 170, 219, 172, 219, 11, 18, 49, 71, 50, 34, 51, 35, 8, 1, 176, 188, 203, 170, 206, 187, 205, 138, 186, 41, 52, 17, 67, 34, 17, 184, 170, 186, 153, 221, 137, 185, 235, 156, 152, 25, 99, 82, 68, 35, 36, 50, 35, 128, 136, 152, 169, 202, 154, 186, 190, 188, 154, 8, 49, 85, 52, 51, 28, 0, 35, 0, 34, 18, 17, 152, 10, 184, 188, 219, 154, 8, 168, 9, 81, 71, 35, 82, 54, 34, 17, 18, 168, 204, 203, 170, 171, 185, 187, 185, 204, 24, 130, 96, 87, 18, 49, 36, 2, 16, 0, 128, 8, 203, 24, 248, 141, 0, 153, 136, 32, 4, 187, 116, 147, 139, 52, 160, 187, 26, 200, 189, 168, 188, 32, 192, 43, 55, 169, 80, 131, 8, 18, 18, 34, 161, 173, 2, 223, 10, 184, 156, 16, 130, 204, 56, 161, 174, 32, 19, 16, 50, 52, 145, 172, 49, 218, 89, 130, 153, 1, 136, 8, 0, 8, 66, 35, 32, 103, 129, 40, 3, 171, 16, 255, 26, 176, 175, 153, 186, 170, 154, 187, 32, 19, 72, 87, 18, 0, 83, 3, 17, 67, 51, 184, 10, 250, 204, 154, 152, 152, 203, 154, 2, 205, 137, 1, 18, 187, 114, 147, 203, 8, 160, 155, 82, 176, 43, 133, 172, 32, 233, 155, 128, 0, 49, 6, 155, 70, 161, 25, 2, 51, 224, 138, 218, 25, 144, 24, 152, 48, 128, 49, 128, 34, 253, 159, 16, 200, 172, 49, 152, 25, 51, 85, 2, 188, 66, 162, 139, 8, 66, 2, 219, 139, 1, 218, 154, 32, 99, 68, 3, 48, 23, 185, 100, 129, 25, 3, 153, 1, 222, 170, 153, 202, 11, 1, 204, 153, 169, 218, 155, 128, 32, 4, 114, 19, 25, 38, 8, 99, 18, 34, 36, 129, 32, 36, 128, 65, 4, 0, 144, 153, 152, 154, 202, 137, 235, 138, 184, 188, 235, 11, 145, 139, 162, 175, 137, 218, 137, 0, 144, 140, 65, 184, 141, 33, 129, 25, 36, 8, 37, 218, 25, 130, 251, 13, 17, 219, 10, 152, 203, 136, 168, 0, 250, 57, 146, 12, 35, 168, 8, 1, 155, 51, 220, 114, 148, 10, 146, 140, 129, 139, 38, 202, 32, 177, 173, 185, 140, 160, 157, 128, 173, 136, 235, 24, 176, 12, 20, 153, 33, 153, 81, 35, 67, 35, 66, 3, 185, 9, 50, 50, 101, 37, 129, 0, 168, 155, 48, 69, 50, 69, 129, 136, 186, 139, 34, 161, 114, 55, 168, 24, 2, 136, 8, 84, 69, 18, 32, 51, 128, 32, 128, 32, 83, 177, 27, 5, 170, 152, 173, 161, 207, 49, 18, 68, 50, 37, 169, 48, 161, 105, 37, 32, 130, 9, 224, 175, 137, 136, 16, 129, 24, 35, 233, 27, 67, 83, 130, 81, 3, 8, 234, 73, 147, 26, 129, 156, 193, 175, 9, 128, 154, 40, 130, 188, 155, 50, 130, 114, 20, 1, 168, 155, 216, 10, 2, 136, 177, 207, 153, 202, 155, 17, 202, 115, 193, 10, 35, 130, 56, 39, 8, 145, 171, 144, 190, 32, 145, 217, 188, 185, 189, 155, 24, 3, 34, 184, 81, 208, 88, 36, 51, 18, 85, 145, 140, 136, 10, 129, 187, 50, 218, 170, 170, 168, 173, 16, 16, 1, 189, 72, 38, 1, 34, 192, 27, 162, 207, 16, 185, 26, 130, 175, 152, 187, 33, 8, 55, 33, 69, 168, 32, 86, 0, 34, 0, 19, 128, 17, 83, 209, 173, 136, 218, 137, 0, 17, 176, 173, 152, 172, 48, 147, 89, 39, 136, 185, 154, 168, 80, 21, 32, 37, 168, 8, 169, 9, 128, 86, 146, 24, 232, 10, 161, 158, 33, 144, 0, 251, 9, 184, 173, 136, 0, 201, 140, 144, 222, 153, 160, 154, 169, 32, 147, 157, 65, 33, 50, 99, 53, 18, 66, 51, 18, 67, 51, 36, 17, 128, 136, 184, 175, 49, 250, 11, 146, 173, 8, 170, 137, 169, 155, 17, 201, 104, 36, 169, 56, 163, 15, 54, 160, 64, 2, 9, 136, 17, 145, 114, 146, 57, 23, 153, 9, 8, 128, 138, 1, 99, 178, 159, 136, 185, 171, 138, 68, 146, 155, 115, 178, 173, 16, 18, 33, 71, 1, 40, 184, 139, 161, 141, 53, 136, 16, 249, 187, 152, 203, 56, 177, 59, 150, 173, 128, 154, 32, 0, 51, 34, 20, 11, 71, 168, 114, 2, 137, 34, 152, 24, 0, 82, 35, 128, 83, 208, 57, 131, 74, 6, 154, 33, 9, 184, 143, 2, 187, 8, 184, 205, 138, 217, 140, 17, 152, 48, 52, 18, 64, 70, 51, 18, 34, 51, 70, 2, 41, 52, 145, 171, 154, 251, 173, 169, 170, 152, 251, 137, 128, 203, 154, 16, 145, 169, 171, 136, 153, 218, 174, 153, 128, 222, 138, 177, 174, 128, 170, 0, 218, 40, 1, 154, 50, 67, 38, 186, 98, 128, 17, 186, 65, 160, 188, 156, 152, 190, 138, 17, 200, 140, 67, 0, 50, 99, 69, 17, 66, 20, 16, 36, 153, 49, 128, 16, 138, 146, 223, 9, 168, 154, 152, 187, 137, 152, 170, 113, 55, 2, 67, 52, 1, 66, 2, 97, 130, 42, 147, 175, 0, 218, 154, 137, 184, 175, 0, 187, 137, 186, 104, 2, 154, 116, 129, 137, 49, 35, 34, 51, 1, 83, 146, 40, 193, 27, 233, 10, 200, 156, 153, 186, 139, 177, 223, 65, 192, 57, 21, 138, 51, 144, 170, 50, 249, 90, 21, 8, 35, 169, 25, 136, 17, 112, 39, 152, 0, 235, 155, 204, 139, 169, 187, 188, 153, 252, 138, 153, 137, 33, 67, 1, 99, 3, 48, 69, 50, 67, 52, 33, 50, 3, 32, 35, 1, 187, 65, 248, 187, 187, 204, 172, 154, 171, 154, 201, 187, 9, 168, 41, 23, 136, 83, 146, 24, 35, 144, 154, 50, 225, 156, 128, 235, 171, 203, 138, 184, 173, 137, 128, 217, 140, 51, 129, 137, 65, 20, 153, 24, 52, 169, 187, 43, 39, 251, 9, 128, 154, 152, 48, 131, 204, 57, 22, 185, 11, 67, 162, 174, 153, 202, 219, 189, 155, 203, 188, 170, 186, 204, 170, 137, 169, 56, 51, 69, 36, 67, 38, 18, 50, 83, 18, 50, 51, 18, 17, 160, 187, 186, 174, 24, 252, 10, 176, 156, 8, 16, 17, 82, 36, 18, 16, 115, 18, 83, 34, 35, 128, 18, 204, 65, 200, 56, 146, 156, 16, 176, 158, 51, 144, 66, 128, 83, 51, 216, 58, 23, 136, 34, 52, 178, 38, 2, 28, 0, 158, 34, 184, 40, 35, 161, 188, 186, 9, 201, 153, 73, 87, 184, 8, 129, 82, 147, 74, 71, 0, 8, 34, 128, 152, 65, 5, 24, 21, 201, 56, 161, 11, 2, 137, 128, 33, 248, 174, 16, 153, 25, 35, 169, 82, 129, 16, 115, 36, 128, 18, 234, 57, 37, 128, 18, 249, 11, 3, 204, 32, 1, 184, 189, 32, 233, 156, 49, 129, 64, 39, 145, 16, 129, 48, 54, 129, 25, 52, 152, 129, 189, 25, 184, 153, 220, 138, 251, 204, 170, 169, 172, 128, 152, 186, 173, 152, 137, 218, 10, 19, 153, 1, 153, 235, 10, 1, 154, 187, 116, 224, 172, 136, 1, 188, 57, 3, 184, 154, 82, 144, 56, 1, 116, 17, 65, 51, 36, 185, 113, 18, 169, 41, 37, 201, 154, 8, 18, 204, 137, 16, 161, 191, 48, 152, 41, 1, 68, 130, 32, 68, 130, 104, 37, 0, 18, 185, 48, 177, 174, 96, 131, 173, 24, 0, 160, 174, 40, 0, 152, 137, 1, 137, 67, 115, 38, 152, 40, 4, 168, 24, 1, 82, 130, 141, 67, 232, 154, 8, 33, 168, 48, 148, 138, 2, 80, 71, 184, 40, 4, 187, 156, 66, 146, 189, 202, 204, 186, 189, 155, 186, 172, 169, 154, 218, 188, 48, 35, 32, 55, 35, 68, 34, 114, 51, 34, 51, 68, 34, 16, 66, 34, 17, 17, 17, 160, 187, 202, 189, 186, 175, 136, 217, 171, 186, 203, 171, 154, 153, 138, 17, 251, 10, 161, 139, 67, 51, 129, 65, 146, 203, 186, 26, 6, 236, 9, 208, 189, 153, 169, 186, 187, 168, 189, 154, 204, 25, 129, 153, 115, 37, 136, 97, 3, 32, 37, 2, 82, 2, 24, 35, 184, 139, 0, 251, 187, 219, 188, 186, 191, 155, 187, 186, 235, 155, 184, 187, 185, 10, 161, 122, 4, 42, 39, 128, 65, 20, 128, 64, 37, 0, 32, 51, 192, 41, 133, 137, 51, 218, 9, 145, 202, 11, 34, 234, 41, 146, 188, 66, 162, 41, 39, 0, 66, 17, 17, 50, 37, 34, 70, 129, 49, 35, 168, 81, 20, 153, 49, 52, 168, 138, 146, 174, 153, 24, 5, 204, 137, 186, 169, 221, 56, 21, 153, 24, 19, 0, 32, 86, 51, 33, 0, 84, 161, 27, 37, 168, 16, 216, 172, 203, 187, 170, 185, 204, 188, 186, 191, 154, 185, 154, 185, 140, 128, 188, 16, 161, 25, 84, 34, 129, 114, 35, 24, 66, 50, 70, 2, 17, 18, 33, 1, 0, 145, 25, 19, 252, 153, 184, 140, 234, 141, 128, 170, 16, 17, 160, 157, 68, 145, 41, 86, 18, 32, 51, 50, 128, 113, 3, 65, 2, 40, 4, 187, 24, 168, 188, 32, 249, 173, 219, 154, 0, 170, 26, 19, 235, 154, 8, 145, 189, 115, 131, 41, 37, 184, 139, 99, 1, 8, 34, 185, 24, 252, 10, 145, 10, 4, 220, 170, 137, 168, 139, 18, 170, 97, 161, 156, 35, 234, 88, 21, 152, 48, 200, 157, 153, 170, 172, 169, 221, 187, 154, 245, 40, 0, 203, 188, 170, 137, 169, 187, 16, 168, 80, 35, 115, 53, 67, 68, 50, 50, 99, 51, 66, 50, 67, 35, 50, 20, 0, 33, 17, 152, 8, 218, 173, 204, 171, 186, 204, 187, 186, 204, 171, 187, 172, 153, 170, 152, 172, 16, 145, 10, 52, 130, 65, 54, 128, 33, 160, 57, 180, 175, 152, 203, 219, 155, 203, 172, 186, 187, 220, 9, 145, 173, 8, 67, 160, 89, 37, 33, 33, 82, 36, 34, 34, 67, 35, 32, 144, 99, 192, 10, 184, 173, 202, 202, 219, 186, 219, 154, 185, 188, 153, 152, 204, 25, 145, 8, 51, 68, 36, 40, 70, 2, 32, 54, 17, 34, 67, 130, 65, 145, 57, 22, 153, 17, 153, 144, 173, 185, 139, 146, 175, 169, 169, 201, 10, 2, 154, 201, 112, 147, 74, 4, 57, 21, 24, 67, 50, 18, 33, 128, 98, 18, 16, 152, 65, 250, 9, 202, 10, 185, 25, 232, 156, 129, 170, 40, 147, 26, 23, 136, 50, 32, 119, 1, 33, 34, 33, 2, 24, 83, 36, 34, 145, 9, 178, 239, 137, 0, 153, 136, 208, 175, 138, 186, 41, 2, 56, 5, 204, 138, 16, 33, 99, 51, 67, 130, 154, 33, 17, 115, 38, 129, 0, 201, 137, 187, 41, 51, 1, 185, 238, 203, 171, 137, 8, 145, 201, 235, 204, 138, 153, 25, 128, 136, 233, 171, 170, 202, 42, 55, 1, 0, 33, 200, 27, 37, 49, 69, 2, 8, 152, 153, 97, 4, 8, 35, 176, 187, 170, 201, 140, 35, 115, 23, 218, 8, 145, 8, 18, 66, 19, 168, 10, 168, 43, 39, 16, 38, 202, 170, 203, 9, 144, 65, 35, 216, 189, 153, 219, 10, 1, 17, 20, 220, 10, 200, 11, 83, 1, 17, 144, 185, 187, 139, 115, 54, 17, 17, 1, 185, 8, 129, 99, 18, 32, 193, 175, 137, 203, 48, 193, 42, 195, 191, 153, 154, 24, 17, 33, 0, 128, 18, 254, 40, 35, 49, 50, 38, 185, 64, 176, 80, 35, 81, 36, 129, 152, 137, 25, 83, 34, 51, 216, 173, 218, 171, 169, 206, 170, 153, 218, 189, 186, 171, 137, 152, 203, 139, 128, 40, 54, 33, 101, 67, 50, 67, 67, 51, 68, 35, 67, 36, 18, 51, 51, 66, 51, 34, 33, 3, 185, 156, 9, 218, 188, 220, 189, 153, 203, 187, 187, 189, 172, 170, 172, 186, 173, 152, 170, 155, 185, 204, 137, 187, 10, 201, 10, 145, 187, 219, 171, 153, 10, 66, 2, 202, 153, 157, 84, 1, 84, 19, 49, 1, 97, 18, 81, 37, 17, 51, 2, 16, 18, 25, 53, 19, 0, 186, 207, 188, 187, 155, 186, 190, 189, 203, 188, 171, 170, 153, 169, 203, 172, 153, 156, 49, 50, 55, 4, 0, 68, 2, 57, 71, 34, 33, 34, 50, 51, 152, 114, 20, 32, 17, 8, 0, 144, 185, 64, 130, 153, 169, 218, 207, 137, 160, 155, 16, 52, 251, 140, 129, 170, 32, 34, 129, 40, 3, 205, 138, 33, 86, 2, 186, 44, 255, 27, 0, 99, 192, 140, 17, 17, 136, 0, 17, 178, 207, 0, 0, 83, 129, 32, 128, 8, 81, 38, 8, 33, 24, 184, 28, 19, 33, 146, 16, 251, 141, 153, 219, 138, 0, 9, 34, 251, 24, 146, 41, 87, 144, 104, 20, 154, 81, 19, 16, 51, 34, 52, 130, 32, 161, 156, 34, 1, 250, 172, 218, 189, 153, 170, 170, 220, 187, 187, 174, 137, 168, 153, 0, 144, 218, 172, 8, 32, 2, 65, 37, 0, 49, 36, 18, 49, 37, 16, 18, 169, 81, 2, 48, 147, 175, 82, 146, 10, 2, 26, 38, 9, 99, 51, 2, 114, 55, 18, 49, 35, 17, 83, 67, 52, 146, 8, 145, 26, 147, 223, 0, 184, 171, 234, 189, 170, 187, 202, 188, 154, 128, 202, 155, 0, 8, 68, 36, 83, 51, 50, 51, 67, 69, 35, 1, 16, 2, 202, 136, 186, 138, 232, 171, 253, 173, 137, 186, 155, 153, 170, 203, 170, 186, 189, 57, 35, 16, 115, 38, 144, 9, 83, 37, 1, 66, 34, 16, 33, 19, 40, 68, 34, 152, 153, 204, 185, 223, 9, 216, 156, 136, 202, 203, 186, 153, 217, 172, 137, 153, 154, 24, 18, 154, 68, 51, 70, 35, 67, 52, 67, 66, 67, 51, 66, 35, 34, 52, 51, 18, 66, 34, 18, 152, 32, 177, 191, 153, 169, 236, 186, 172, 169, 221, 10, 144, 172, 138, 153, 170, 154, 185, 154, 186, 24, 184, 171, 32, 147, 223, 16, 217, 138, 219, 40, 240, 172, 32, 184, 156, 144, 155, 184, 173, 1, 152, 152, 155, 52, 144, 100, 51, 18, 82, 35, 0, 65, 71, 130, 8, 129, 43, 132, 174, 136, 185, 186, 204, 188, 205, 170, 202, 170, 154, 202, 172, 203, 170, 153, 8, 16, 67, 200, 89, 23, 136, 66, 36, 17, 18, 83, 35, 49, 17, 99, 19, 136, 50, 128, 185, 188, 138, 176, 174, 168, 206, 138, 202, 155, 154, 137, 168, 24, 162, 44, 39, 8, 68, 1, 115, 35, 17, 18, 51, 51, 20, 32, 71, 144, 152, 8, 217, 11, 1, 154, 216, 173, 128, 205, 10, 136, 169, 8, 145, 0, 200, 26, 52, 69, 1, 67, 129, 50, 3, 114, 36, 32, 52, 145, 41, 21, 9, 3, 157, 66, 33, 193, 43, 23, 172, 48, 161, 10, 1, 186, 154, 218, 11, 146, 187, 184, 158, 176, 142, 176, 159, 128, 25, 21, 153, 50, 176, 72, 51, 51, 115, 52, 51, 35, 65, 3, 40, 71, 18, 2, 9, 18, 170, 16, 219, 136, 188, 64, 161, 207, 154, 1, 203, 40, 2, 16, 200, 139, 136, 17, 154, 119, 130, 136, 185, 154, 186, 188, 139, 176, 175, 115, 176, 158, 128, 170, 137, 136, 144, 187, 156, 129, 235, 24, 192, 73, 163, 159, 128, 171, 40, 36, 144, 41, 176, 89, 179, 191, 16, 34, 18, 34, 250, 41, 194, 74, 133, 155, 17, 160, 155, 8, 25, 52, 129, 136, 187, 48, 249, 156, 218, 26, 34, 186, 57, 148, 207, 56, 163, 133, 254, 20, 0, 174, 83, 216, 25, 2, 137, 82, 130, 32, 19, 64, 22, 186, 81, 19, 1, 8, 51, 201, 172, 49, 19, 185, 158, 33, 217, 10, 128, 219, 26, 18, 252, 173, 137, 169, 128, 218, 155, 8, 16, 18, 218, 25, 36, 83, 53, 17, 115, 50, 50, 68, 34, 83, 37, 33, 49, 34, 50, 36, 34, 37, 144, 9, 51, 177, 172, 8, 235, 172, 169, 205, 187, 203, 203, 188, 202, 187, 187, 188, 219, 172, 187, 156, 185, 188, 185, 171, 153, 170, 202, 154, 168, 97, 36, 0, 82, 35, 32, 66, 51, 85, 35, 0, 68, 1, 49, 19, 82, 53, 128, 0, 160, 32, 146, 10, 17, 176, 142, 18, 219, 219, 171, 33, 145, 173, 40, 248, 191, 136, 24, 168, 173, 169, 171, 186, 187, 173, 170, 155, 152, 189, 170, 43, 178, 15, 23, 185, 98, 129, 33, 19, 68, 51, 51, 36, 51, 53, 99, 36, 0, 50, 2, 82, 35, 17, 33, 18, 32, 21, 176, 155, 0, 234, 171, 170, 252, 187, 153, 234, 187, 171, 169, 204, 171, 170, 186, 187, 172, 137, 251, 140, 1, 185, 152, 136, 0, 16, 51, 146, 205, 26, 145, 173, 97, 20, 153, 65, 128, 138, 9, 115, 6, 186, 65, 130, 138, 17, 18, 35, 3, 49, 19, 170, 115, 35, 128, 24, 55, 168, 43, 4, 207, 41, 35, 17, 67, 4, 205, 9, 152, 24, 144, 218, 26, 194, 159, 8, 152, 170, 32, 18, 40, 18, 1, 98, 53, 49, 87, 129, 56, 38, 1, 50, 36, 2, 128, 97, 35, 32, 35, 65, 130, 156, 0, 186, 8, 252, 10, 176, 140, 36, 201, 172, 33, 131, 187, 138, 137, 116, 147, 42, 37, 1, 50, 19, 49, 53, 17, 17, 219, 10, 1, 24, 87, 184, 43, 148, 174, 49, 16, 66, 2, 24, 20, 218, 41, 2, 169, 64, 4, 203, 8, 170, 82, 217, 10, 146, 174, 40, 193, 140, 128, 140, 3, 137, 19, 88, 21, 9, 83, 129, 24, 131, 155, 192, 191, 137, 202, 203, 173, 144, 236, 9, 168, 204, 170, 170, 170, 152, 170, 185, 207, 153, 144, 203, 41, 21, 16, 2, 48, 39, 18, 67, 52, 34, 66, 35, 18, 83, 4, 8, 67, 1, 16, 144, 136, 251, 187, 185, 203, 138, 160, 236, 204, 9, 160, 138, 136, 0, 169, 96, 51, 17, 2, 25, 119, 163, 24, 21, 168, 8, 144, 136, 128, 8, 216, 190, 138, 184, 189, 9, 169, 187, 188, 187, 32, 209, 27, 39, 169, 65, 145, 40, 131, 48, 39, 129, 24, 17, 219, 138, 185, 171, 160, 222, 155, 217, 172, 202, 154, 128, 187, 186, 191, 172, 169, 155, 137, 168, 138, 82, 145, 11, 86, 67, 34, 34, 49, 71, 34, 128, 32, 50, 128, 80, 21, 169, 9, 8, 34, 252, 158, 8, 161, 189, 137, 144, 218, 154, 8, 128, 170, 88, 4, 138, 32, 83, 35, 98, 19, 128, 33, 83, 52, 129, 9, 67, 176, 43, 162, 174, 153, 238, 252, 22, 0, 219, 187, 9, 216, 27, 36, 169, 25, 115, 52, 18, 33, 52, 51, 84, 51, 67, 129, 81, 35, 66, 145, 25, 4, 152, 8, 184, 189, 24, 145, 250, 204, 8, 0, 168, 172, 83, 129, 25, 19, 50, 130, 41, 55, 19, 99, 53, 50, 2, 113, 5, 169, 48, 37, 152, 138, 16, 129, 237, 171, 137, 168, 173, 8, 219, 155, 185, 40, 36, 128, 18, 234, 10, 49, 54, 1, 8, 1, 51, 35, 69, 52, 18, 34, 128, 153, 187, 64, 192, 12, 3, 253, 156, 32, 144, 173, 56, 3, 205, 154, 170, 25, 68, 18, 0, 184, 10, 19, 48, 71, 144, 136, 50, 178, 142, 68, 144, 8, 144, 17, 235, 170, 175, 40, 232, 25, 145, 171, 218, 155, 168, 139, 160, 155, 146, 13, 54, 129, 82, 83, 19, 8, 49, 67, 17, 83, 2, 0, 129, 201, 171, 202, 171, 251, 219, 171, 170, 220, 169, 154, 129, 154, 129, 153, 8, 83, 161, 114, 3, 40, 69, 17, 0, 24, 18, 1, 17, 53, 19, 217, 173, 0, 185, 153, 252, 203, 186, 138, 201, 154, 201, 139, 232, 140, 34, 0, 18, 64, 21, 49, 54, 33, 52, 50, 69, 1, 8, 51, 18, 32, 145, 9, 216, 141, 177, 157, 161, 159, 144, 173, 128, 219, 9, 169, 49, 249, 139, 152, 10, 17, 48, 39, 16, 34, 17, 18, 17, 18, 97, 3, 170, 153, 98, 209, 157, 136, 40, 145, 157, 136, 171, 128, 156, 69, 184, 40, 130, 56, 18, 48, 20, 24, 36, 67, 3, 187, 40, 50, 39, 169, 65, 168, 169, 172, 49, 168, 50, 238, 154, 237, 10, 1, 186, 171, 185, 187, 32, 147, 191, 32, 203, 99, 168, 66, 18, 36, 128, 85, 129, 66, 129, 48, 3, 48, 3, 65, 130, 187, 169, 172, 119, 177, 191, 26, 51, 168, 152, 203, 56, 160, 153, 64, 131, 157, 49, 169, 33, 152, 100, 129, 8, 137, 2, 16, 18, 16, 128, 0, 202, 138, 153, 41, 35, 185, 155, 144, 11, 49, 144, 33, 144, 186, 154, 16, 0, 17, 145, 25, 161, 16, 17, 17, 17, 16, 2, 0, 1, 0, 34, 0, 0, 0, 0, 153, 16, 1, 0, 153, 153, 17, 144, 144, 0, 17, 145, 153, 16, 1, 0, 0, 9, 0, 0, 16, 144, 9, 17, 144, 9, 0, 0, 0, 0, 0, 144, 9, 0, 0, 0, 0, 17, 153, 0, 0, 17, 144, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
-static const size_t audio_gps_signal_sample_data_length = sizeof(audio_gps_signal_sample_data) / sizeof(audio_gps_signal_sample_data[0]);
+static const size_t audio_gps_signal_sample_data_length = 47985;
@@ -1,4 +1,4 @@
-// This file was generated by a script on 20-11-2024 08:37:37
+// This file was generated by a script on 17-10-2026 14:18:55
 
 #pragma once
 
@@ -6,6 +6,7 @@
 #include <stdint.h>
 #include <pico/platform/sections.h>
 
-static const int16_t __in_flash("audio_lost_sample_data") audio_lost_sample_data[] = { 14, 7, 0, 5, 18, 25, 18, 13, 17, 25, 24, 17, 14, 16, 16, 16, 18, 18, 16, 14, 17, 17, 14, 13, 14, 14, 14, 16, 16, 16, 16, 17, 21, 24, 25, 27, 28, 29, 32, 32, 32, 32, 31, 31, 32, 35, 35, 33, 33, 36, 36, 35, 33, 32, 31, 28, 28, 29, 31, 31, 28, 28, 29, 29, 29, 29, 28, 27, 24, 22, 22, 22, 22, 21, 21, 20, 18, 17, 18, 21, 21, 18, 16, 14, 16, 16, 17, 16, 13, 9, 9, 10, 10, 7, 5, 3, 3, 3, 3, 3, 0, -3, -4, -3, -3, -4, -7, -7, -8, -11, -14, -15, -15, -15, -14, -15, -18, -19, -18, -15, -14, -19, -26, -28, -23, -21, -22, -23, -25, -25, -26, -25, -22, -22, -26, -29, -29, -25, -23, -25, -26, -25, -22, -23, -29, -32, -30, -28, -28, -28, -26, -28, -30, -32, -29, -29, -32, -32, -29, -25, -22, -23, -26, -28, -28, -26, -28, -26, -23, -22, -25, -29, -29, -26, -25, -26, -28, -28, -29, -28, -25, -22, -23, -29, -34, -37, -34, -29, -25, -28, -34, -37, -33, -29, -30, -34, -33, -28, -22, -23, -30, -37, -36, -32, -29, -30, -32, -30, -26, -23, -25, -32, -36, -32, -22, -21, -29, -33, -29, -23, -25, -26, -26, -28, -29, -26, -21, -19, -21, -22, -25, -30, -30, -23, -17, -11, -10, -12, -19, -22, -17, -10, -12, -22, -29, -26, -18, -14, -17, -22, -23, -17, -10, -4, -1, 0, -1, -7, -11, -10, -6, -1, 0, -6, -12, -11, -6, -6, -7, -6, -6, -12, -17, -6, 9, 9, 0, -12, -19, -18, -8, 0, 0, -4, -6, -4, -7, -11, -14, -15, -14, -7, 0, 2, -6, -11, -4, 7, 11, 7, 2, 0, -3, -3, 0, 9, 10, 2, -3, 0, 11, 18, 17, 13, 9, 9, 9, 9, 9, 9, 11, 17, 18, 11, 5, 3, 9, 13, 13, 13, 11, 7, 0, -1, 5, 11, 7, -3, -4, 9, 22, 24, 16, 11, 17, 18, 13, 2, 0, 2, 7, 10, 11, 17, 22, 22, 20, 22, 25, 21, 13, 10, 14, 18, 21, 22, 17, 9, 10, 28, 46, 40, 20, 10, 17, 17, 5, 0, 11, 21, 16, 13, 17, 16, 9, 9, 14, 14, 10, 13, 18, 18, 14, 11, 13, 16, 20, 22, 20, 9, -1, -3, 2, 5, 2, 0, 0, -1, 0, 5, 6, 0, 0, 6, 9, -1, -14, -11, 5, 18, 13, -6, -12, 0, 7, -6, -17, -7, -1, -19, -33, -22, -12, -21, -26, -18, -21, -40, -44, -32, -26, -37, -45, -45, -48, -52, -54, -52, -48, -44, -47, -62, -70, -62, -54, -59, -67, -63, -54, -54, -63, -73, -74, -65, -54, -52, -59, -62, -55, -52, -56, -63, -67, -67, -61, -48, -45, -55, -63, -59, -55, -58, -58, -48, -40, -41, -47, -48, -45, -45, -48, -47, -44, -47, -54, -55, -43, -33, -40, -52, -47, -34, -36, -41, -30, -14, -22, -43, -41, -19, -10, -18, -22, -15, -12, -17, -7, 16, 25, 14, 10, 27, 40, 39, 47, 71, 80, 69, 66, 86, 101, 104, 109, 123, 127, 117, 116, 135, 154, 152, 134, 119, 105, 83, 62, 61, 68, 58, 32, 2, -25, -62, -98, -109, -91, -89, -142, -230, -307, -358, -402, -453, -490, -497, -487, -489, -501, -512, -517, -522, -528, -539, -550, -552, -533, -508, -494, -484, -460, -416, -356, -288, -226, -194, -183, -151, -80, 0, 54, 90, 142, 211, 265, 304, 360, 439, 523, 598, 657, 693, 709, 745, 811, 884, 953, 1027, 1096, 1121, 1114, 1130, 1187, 1243, 1273, 1293, 1323, 1345, 1343, 1339, 1365, 1407, 1423, 1416, 1422, 1447, 1456, 1430, 1403, 1407, 1423, 1422, 1418, 1437, 1452, 1425, 1375, 1363, 1393, 1412, 1396, 1376, 1374, 1360, 1319, 1286, 1293, 1302, 1269, 1215, 1189, 1191, 1174, 1132, 1094, 1078, 1063, 1034, 1004, 969, 914, 849, 811, 785, 727, 646, 598, 582, 548, 481, 415, 362, 304, 236, 178, 132, 79, 7, -66, -129, -187, -249, -308, -359, -413, -484, -560, -614, -648, -688, -746, -812, -867, -912, -961, -1003, -1032, -1060, -1115, -1190, -1240, -1241, -1233, -1266, -1324, -1360, -1364, -1372, -1397, -1408, -1393, -1390, -1423, -1457, -1461, -1453, -1466, -1481, -1472, -1455, -1452, -1446, -1417, -1382, -1376, -1390, -1388, -1361, -1332, -1307, -1281, -1262, -1266, -1269, -1234, -1185, -1160, -1157, -1145, -1120, -1095, -1060, -1011, -978, -978, -974, -934, -877, -845, -834, -802, -747, -714, -717, -709, -645, -561, -520, -516, -495, -450, -422, -417, -381, -305, -248, -238, -237, -206, -162, -129, -100, -61, -26, -8, 0, 10, 29, 50, 76, 105, 119, 108, 87, 88, 115, 139, 135, 106, 82, 82, 105, 130, 141, 131, 102, 57, 22, 14, 17, 0, -39, -73, -91, -106, -120, -138, -169, -211, -241, -257, -279, -310, -339, -370, -413, -454, -480, -502, -533, -563, -579, -590, -608, -636, -680, -732, -760, -751, -740, -750, -773, -794, -824, -863, -878, -860, -842, -853, -881, -893, -874, -844, -838, -868, -904, -919, -914, -897, -860, -806, -780, -806, -848, -853, -817, -766, -720, -689, -689, -714, -738, -735, -681, -588, -515, -513, -553, -571, -552, -519, -458, -370, -325, -373, -450, -457, -388, -312, -255, -206, -178, -190, -215, -189, -98, -11, 3, -32, -40, 14, 91, 139, 159, 183, 232, 281, 314, 346, 388, 409, 393, 384, 431, 503, 549, 592, 661, 716, 713, 701, 745, 829, 884, 891, 889, 906, 939, 973, 1008, 1045, 1074, 1079, 1064, 1063, 1097, 1155, 1206, 1233, 1240, 1233, 1221, 1218, 1244, 1290, 1323, 1313, 1275, 1250, 1276, 1332, 1378, 1394, 1390, 1363, 1316, 1299, 1341, 1381, 1349, 1275, 1243, 1261, 1277, 1272, 1262, 1250, 1221, 1187, 1165, 1151, 1136, 1108, 1061, 998, 939, 903, 887, 876, 854, 807, 741, 686, 654, 626, 585, 547, 522, 478, 401, 327, 293, 289, 273, 215, 123, 31, -29, -43, -36, -56, -121, -204, -282, -359, -417, -420, -405, -457, -582, -677, -700, -711, -738, -743, -751, -817, -903, -930, -923, -944, -977, -996, -1028, -1084, -1115, -1098, -1077, -1080, -1086, -1086, -1099, -1119, -1112, -1087, -1080, -1091, -1084, -1053, -1038, -1051, -1043, -996, -961, -970, -978, -947, -908, -899, -897, -870, -831, -809, -798, -775, -735, -696, -676, -670, -665, -643, -599, -539, -484, -455, -460, -475, -460, -405, -336, -290, -277, -274, -250, -200, -146, -121, -120, -109, -77, -41, -15, 6, 20, 18, 22, 58, 119, 153, 149, 143, 167, 193, 196, 210, 262, 310, 302, 260, 255, 289, 314, 307, 292, 300, 342, 404, 449, 457, 442, 437, 454, 489, 523, 533, 496, 423, 372, 379, 416, 428, 391, 325, 255, 200, 185, 205, 183, 57, -124, -222, -191, -153, -256, -502, -782, -1010, -1172, -1270, -1362, -1554, -1838, -2043, -2070, -2035, -2064, -2122, -2195, -2359, -2587, -2737, -2773, -2795, -2818, -2785, -2727, -2707, -2664, -2513, -2305, -2158, -2085, -2017, -1913, -1771, -1580, -1343, -1117, -958, -828, -630, -343, -40, 244, 567, 933, 1218, 1327, 1370, 1550, 1901, 2287, 2615, 2893, 3097, 3201, 3302, 3518, 3818, 4078, 4284, 4489, 4674, 4771, 4837, 5005, 5296, 5564, 5699, 5743, 5795, 5887, 5996, 6110, 6202, 6246, 6285, 6380, 6509, 6608, 6679, 6729, 6720, 6658, 6648, 6728, 6802, 6790, 6728, 6670, 6601, 6533, 6513, 6533, 6507, 6401, 6289, 6233, 6178, 6051, 5896, 5794, 5729, 5611, 5424, 5227, 5044, 4839, 4616, 4436, 4305, 4156, 3944, 3723, 3540, 3358, 3114, 2828, 2564, 2337, 2118, 1895, 1667, 1421, 1152, 893, 662, 442, 210, -22, -237, -454, -709, -985, -1223, -1398, -1549, -1723, -1944, -2198, -2430, -2598, -2725, -2877, -3078, -3289, -3471, -3592, -3634, -3660, -3776, -3989, -4190, -4291, -4329, -4361, -4405, -4479, -4595, -4695, -4721, -4705, -4703, -4721, -4739, -4781, -4853, -4896, -4851, -4752, -4687, -4698, -4734, -4724, -4655, -4582, -4542, -4505, -4452, -4410, -4388, -4335, -4227, -4127, -4072, -4007, -3900, -3805, -3748, -3681, -3575, -3483, -3431, -3388, -3333, -3271, -3198, -3091, -2953, -2809, -2672, -2566, -2498, -2449, -2385, -2282, -2149, -2015, -1899, -1811, -1734, -1642, -1518, -1368, -1205, -1062, -967, -914, -856, -761, -641, -516, -402, -308, -244, -182, -96, 2, 94, 166, 203, 196, 171, 181, 223, 255, 267, 280, 278, 234, 170, 141, 138, 101, 11, -76, -132, -197, -299, -399, -469, -552, -684, -817, -903, -967, -1065, -1193, -1316, -1434, -1565, -1695, -1805, -1895, -1990, -2105, -2225, -2326, -2405, -2485, -2575, -2656, -2722, -2787, -2866, -2946, -2999, -3026, -3062, -3128, -3202, -3254, -3283, -3303, -3314, -3321, -3345, -3392, -3429, -3436, -3426, -3418, -3421, -3439, -3461, -3459, -3440, -3437, -3458, -3461, -3435, -3415, -3402, -3359, -3290, -3253, -3268, -3282, -3256, -3205, -3155, -3102, -3033, -2972, -2935, -2895, -2814, -2704, -2615, -2562, -2506, -2416, -2328, -2265, -2196, -2085, -1961, -1877, -1815, -1712, -1560, -1424, -1342, -1287, -1208, -1102, -994, -890, -789, -689, -590, -479, -356, -257, -215, -200, -160, -73, 28, 98, 127, 143, 178, 238, 307, 371, 420, 445, 441, 423, 427, 468, 512, 514, 488, 483, 508, 514, 490, 481, 503, 516, 494, 470, 475, 482, 443, 379, 344, 355, 377, 380, 365, 328, 277, 252, 276, 303, 280, 212, 143, 80, 3, -65, -80, -52, -54, -121, -201, -237, -242, -261, -304, -359, -427, -502, -560, -590, -600, -618, -667, -746, -800, -790, -765, -797, -864, -897, -893, -886, -870, -838, -833, -856, -839, -761, -692, -673, -641, -552, -450, -391, -341, -242, -99, 36, 153, 273, 393, 488, 570, 687, 848, 1013, 1154, 1293, 1438, 1554, 1639, 1770, 1971, 2143, 2221, 2286, 2417, 2552, 2616, 2681, 2820, 2960, 3003, 3009, 3101, 3270, 3384, 3405, 3420, 3485, 3538, 3542, 3567, 3664, 3772, 3816, 3811, 3814, 3837, 3858, 3884, 3930, 3977, 3988, 3980, 3998, 4034, 4039, 4010, 4001, 4042, 4083, 4068, 4019, 3999, 4019, 4031, 4014, 3994, 3984, 3959, 3906, 3845, 3800, 3760, 3708, 3651, 3607, 3577, 3545, 3497, 3423, 3326, 3226, 3147, 3087, 3006, 2882, 2751, 2670, 2640, 2609, 2554, 2499, 2448, 2356, 2212, 2078, 2011, 1986, 1956, 1906, 1846, 1785, 1745, 1743, 1751, 1731, 1681, 1627, 1588, 1555, 1536, 1548, 1568, 1529, 1441, 1392, 1421, 1454, 1422, 1364, 1354, 1376, 1364, 1312, 1283, 1293, 1291, 1257, 1211, 1177, 1137, 1100, 1094, 1100, 1065, 997, 955, 966, 995, 1002, 980, 951, 946, 955, 931, 885, 907, 1010, 1060, 988, 903, 895, 889, 829, 794, 848, 910, 888, 827, 826, 906, 990, 968, 815, 620, 463, 299, 93, -50, -30, 49, 13, -140, -278, -339, -347, -322, -293, -347, -544, -820, -1049, -1167, -1196, -1155, -1046, -919, -886, -995, -1168, -1280, -1277, -1207, -1156, -1196, -1347, -1549, -1687, -1666, -1504, -1313, -1211, -1249, -1388, -1530, -1576, -1508, -1412, -1394, -1482, -1607, -1658, -1580, -1428, -1324, -1321, -1365, -1388, -1393, -1383, -1343, -1294, -1287, -1307, -1274, -1168, -1073, -1055, -1060, -999, -860, -727, -681, -688, -630, -472, -312, -231, -175, -87, -1, 73, 211, 415, 582, 682, 792, 933, 1042, 1115, 1226, 1372, 1473, 1515, 1586, 1719, 1844, 1906, 1957, 2054, 2158, 2212, 2242, 2294, 2336, 2307, 2224, 2166, 2168, 2195, 2212, 2203, 2186, 2177, 2172, 2142, 2084, 2019, 1949, 1851, 1734, 1621, 1518, 1404, 1284, 1188, 1125, 1065, 973, 848, 719, 610, 511, 391, 232, 55, -98, -212, -310, -431, -585, -746, -881, -987, -1102, -1259, -1452, -1638, -1781, -1874, -1960, -2094, -2282, -2445, -2553, -2661, -2820, -2975, -3078, -3183, -3334, -3482, -3574, -3662, -3793, -3914, -3966, -3999, -4090, -4197, -4216, -4185, -4231, -4373, -4498, -4574, -4665, -4746, -4734, -4668, -4650, -4664, -4629, -4599, -4680, -4820, -4856, -4767, -4720, -4807, -4907, -4898, -4834, -4831, -4873, -4870, -4826, -4798, -4772, -4706, -4642, -4647, -4694, -4687, -4600, -4508, -4459, -4403, -4303, -4200, -4135, -4079, -3977, -3850, -3766, -3729, -3684, -3596, -3483, -3356, -3213, -3087, -3029, -3025, -2983, -2846, -2681, -2590, -2577, -2558, -2476, -2352, -2238, -2148, -2079, -2041, -2020, -1955, -1819, -1701, -1691, -1737, -1720, -1655, -1636, -1643, -1594, -1515, -1496, -1510, -1470, -1413, -1435, -1510, -1529, -1492, -1496, -1566, -1609, -1574, -1551, -1616, -1691, -1673, -1592, -1571, -1642, -1726, -1777, -1827, -1899, -1951, -1964, -1993, -2077, -2159, -2159, -2107, -2112, -2203, -2301, -2349, -2388, -2460, -2522, -2527, -2511, -2528, -2561, -2572, -2571, -2583, -2609, -2630, -2619, -2588, -2593, -2653, -2681, -2604, -2499, -2477, -2488, -2414, -2290, -2258, -2321, -2334, -2242, -2151, -2136, -2129, -2066, -1998, -1995, -1999, -1924, -1812, -1775, -1796, -1752, -1636, -1600, -1699, -1790, -1763, -1730, -1816, -1920, -1863, -1658, -1419, -1174, -907, -705, -685, -830, -987, -1039, -970, -812, -593, -347, -105, 141, 419, 699, 918, 1076, 1235, 1433, 1649, 1850, 2020, 2181, 2400, 2687, 2945, 3134, 3343, 3606, 3794, 3859, 3964, 4204, 4447, 4584, 4704, 4854, 4924, 4891, 4903, 5030, 5143, 5129, 5070, 5108, 5234, 5313, 5272, 5173, 5108, 5042, 4913, 4796, 4811, 4888, 4829, 4621, 4448, 4375, 4291, 4159, 4057, 3984, 3851, 3665, 3515, 3408, 3284, 3153, 3062, 2971, 2813, 2618, 2479, 2389, 2242, 2019, 1835, 1737, 1643, 1506, 1385, 1306, 1196, 1021, 845, 731, 687, 699, 738, 719, 598, 460, 445, 551, 609, 505, 327, 227, 230, 260, 281, 317, 358, 376, 387, 443, 514, 516, 448, 404, 435, 481, 490, 489, 494, 488, 500, 582, 710, 807, 862, 925, 988, 977, 882, 805, 851, 1002, 1152, 1233, 1313, 1470, 1659, 1782, 1857, 1952, 2022, 1981, 1893, 1893, 1953, 1952, 1905, 1934, 2047, 2143, 2206, 2322, 2501, 2627, 2616, 2524, 2442, 2380, 2318, 2290, 2325, 2370, 2359, 2347, 2440, 2605, 2675, 2586, 2457, 2369, 2272, 2153, 2096, 2100, 2059, 1967, 1927, 1945, 1938, 1902, 1877, 1799, 1572, 1288, 1143, 1130, 1068, 918, 873, 1006, 1093, 961, 764, 688, 639, 467, 258, 182, 208, 199, 152, 160, 225, 271, 295, 339, 357, 259, 80, -36, -55, -83, -149, -158, -59, 53, 83, 69, 116, 247, 394, 481, 481, 383, 199, -14, -164, -178, -34, 215, 471, 636, 693, 675, 602, 497, 421, 405, 409, 386, 354, 357, 408, 504, 646, 818, 968, 1064, 1127, 1180, 1206, 1207, 1258, 1409, 1591, 1726, 1844, 1986, 2067, 2019, 1920, 1861, 1825, 1799, 1846, 1949, 1941, 1727, 1443, 1265, 1178, 1037, 793, 494, 123, -392, -981, -1438, -1669, -1768, -1844, -1914, -2012, -2253, -2671, -3115, -3426, -3636, -3853, -4070, -4209, -4300, -4408, -4479, -4439, -4318, -4164, -3980, -3815, -3766, -3798, -3753, -3593, -3429, -3311, -3132, -2798, -2353, -1898, -1485, -1131, -837, -563, -235, 128, 443, 732, 1147, 1709, 2220, 2548, 2835, 3264, 3794, 4248, 4573, 4872, 5227, 5598, 5918, 6213, 6585, 7036, 7446, 7730, 7945, 8196, 8481, 8751, 9007, 9288, 9546, 9696, 9784, 9973, 10277, 10501, 10545, 10576, 10745, 10927, 10951, 10910, 10977, 11108, 11147, 11101, 11116, 11178, 11144, 11023, 10984, 11031, 10955, 10693, 10438, 10317, 10227, 10073, 9882, 9659, 9356, 9032, 8778, 8572, 8339, 8084, 7817, 7490, 7093, 6695, 6339, 5974, 5546, 5084, 4638, 4224, 3812, 3394, 2969, 2517, 2029, 1540, 1093, 662, 160, -443, -1049, -1555, -1983, -2414, -2860, -3281, -3684, -4109, -4541, -4959, -5394, -5872, -6338, -6717, -7025, -7326, -7615, -7846, -8072, -8396, -8789, -9096, -9243, -9338, -9470, -9613, -9756, -9935, -10098, -10153, -10128, -10161, -10285, -10409, -10456, -10438, -10398, -10362, -10350, -10351, -10337, -10293, -10220, -10147, -10149, -10245, -10332, -10303, -10237, -10256, -10288, -10190, -10021, -9956, -10010, -10036, -10006, -9990, -10004, -9982, -9927, -9935, -10021, -10080, -10021, -9882, -9748, -9646, -9562, -9510, -9490, -9452, -9353, -9232, -9146, -9074, -8954, -8766, -8573, -8401, -8214, -8012, -7826, -7648, -7449, -7237, -7033, -6817, -6618, -6497, -6373, -6059, -5570, -5151, -4936, -4812, -4672, -4548, -4438, -4236, -3911, -3619, -3477, -3398, -3234, -3014, -2851, -2748, -2617, -2470, -2375, -2310, -2199, -2060, -1982, -1982, -2019, -2045, -2032, -1976, -1921, -1907, -1929, -1960, -2006, -2090, -2185, -2261, -2341, -2455, -2550, -2539, -2495, -2573, -2740, -2796, -2723, -2721, -2825, -2836, -2700, -2645, -2810, -3015, -3049, -2956, -2875, -2807, -2700, -2628, -2692, -2804, -2795, -2685, -2656, -2741, -2766, -2646, -2527, -2532, -2568, -2515, -2445, -2462, -2463, -2321, -2133, -2072, -2122, -2173, -2211, -2235, -2156, -1971, -1838, -1865, -1928, -1881, -1788, -1772, -1785, -1708, -1605, -1602, -1585, -1376, -1087, -961, -974, -945, -878, -849, -742, -464, -227, -271, -429, -304, 167, 624, 771, 701, 646, 682, 808, 1070, 1423, 1711, 1877, 2023, 2199, 2333, 2410, 2516, 2689, 2865, 2980, 3039, 3099, 3231, 3460, 3717, 3878, 3897, 3900, 4034, 4250, 4378, 4386, 4398, 4469, 4528, 4539, 4522, 4459, 4354, 4354, 4581, 4872, 4903, 4631, 4398, 4495, 4775, 4862, 4641, 4361, 4243, 4225, 4155, 4065, 4093, 4240, 4376, 4414, 4320, 4075, 3757, 3559, 3551, 3586, 3563, 3563, 3653, 3730, 3681, 3519, 3321, 3161, 3146, 3292, 3412, 3269, 2926, 2747, 2909, 3150, 3164, 3002, 2839, 2675, 2545, 2607, 2791, 2765, 2509, 2417, 2623, 2753, 2548, 2281, 2265, 2359, 2270, 2080, 2076, 2237, 2315, 2297, 2367, 2492, 2491, 2424, 2488, 2601, 2509, 2252, 2147, 2304, 2484, 2477, 2360, 2259, 2162, 2103, 2239, 2550, 2729, 2590, 2327, 2209, 2271, 2448, 2722, 3028, 3260, 3362, 3317, 3161, 3072, 3204, 3414, 3430, 3266, 3212, 3405, 3710, 3953, 4014, 3863, 3655, 3610, 3694, 3695, 3573, 3428, 3245, 3036, 3020, 3309, 3673, 3875, 3940, 3904, 3713, 3486, 3443, 3518, 3421, 3132, 2911, 2905, 3026, 3127, 3109, 2985, 2871, 2821, 2717, 2505, 2370, 2426, 2470, 2286, 2003, 1883, 1938, 1975, 1913, 1818, 1734, 1621, 1473, 1337, 1240, 1165, 1148, 1261, 1458, 1548, 1412, 1129, 873, 724, 626, 499, 340, 251, 295, 405, 474, 477, 445, 366, 218, 47, -96, -231, -384, -491, -486, -399, -329, -315, -314, -300, -312, -402, -563, -753, -918, -998, -958, -831, -707, -627, -563, -500, -498, -623, -834, -1010, -1094, -1133, -1160, -1123, -955, -722, -583, -592, -633, -579, -461, -424, -538, -733, -874, -864, -676, -354, -33, 131, 113, 80, 229, 523, 706, 624, 394, 219, 171, 276, 569, 906, 966, 639, 203, -11, 20, 106, 127, 25, -307, -923, -1653, -2258, -2737, -3194, -3550, -3689, -3798, -4137, -4602, -4906, -4999, -4987, -4882, -4764, -4867, -5257, -5689, -5945, -6005, -5840, -5418, -4935, -4695, -4680, -4511, -3974, -3326, -2901, -2646, -2327, -1949, -1668, -1398, -923, -282, 258, 570, 785, 1130, 1740, 2542, 3281, 3771, 4067, 4328, 4642, 5078, 5689, 6350, 6819, 7049, 7229, 7478, 7720, 7917, 8214, 8718, 9290, 9717, 9967, 10170, 10387, 10599, 10829, 11078, 11250, 11320, 11427, 11639, 11813, 11858, 11920, 12146, 12466, 12748, 12923, 12951, 12824, 12638, 12502, 12425, 12358, 12300, 12252, 12139, 11904, 11593, 11355, 11258, 11199, 10957, 10478, 9999, 9736, 9553, 9111, 8377, 7705, 7382, 7237, 6892, 6245, 5503, 4840, 4266, 3804, 3408, 2850, 2015, 1163, 559, 42, -698, -1574, -2277, -2773, -3268, -3856, -4471, -5108, -5810, -6527, -7153, -7702, -8284, -8920, -9502, -9934, -10275, -10614, -10963, -11294, -11622, -11984, -12377, -12770, -13113, -13351, -13498, -13656, -13897, -14137, -14164, -13914, -13572, -13427, -13561, -13826, -14035, -14128, -14126, -14020, -13802, -13531, -13314, -13195, -13071, -12814, -12465, -12170, -11979, -11799, -11588, -11417, -11310, -11172, -10952, -10723, -10549, -10345, -9993, -9512, -9064, -8762, -8554, -8342, -8089, -7844, -7683, -7643, -7637, -7513, -7201, -6790, -6392, -6034, -5692, -5349, -5017, -4737, -4582, -4564, -4593, -4555, -4441, -4298, -4109, -3815, -3458, -3190, -3066, -2965, -2796, -2657, -2682, -2806, -2839, -2741, -2654, -2681, -2734, -2659, -2456, -2283, -2253, -2306, -2348, -2407, -2583, -2854, -3044, -3012, -2822, -2689, -2763, -3016, -3304, -3479, -3499, -3480, -3601, -3846, -3985, -3955, -4010, -4291, -4559, -4617, -4657, -4895, -5151, -5162, -5043, -5101, -5346, -5518, -5513, -5506, -5636, -5811, -5901, -5909, -5890, -5831, -5751, -5760, -5883, -5956, -5842, -5625, -5506, -5513, -5513, -5431, -5321, -5211, -5057, -4871, -4735, -4647, -4508, -4288, -4106, -4083, -4164, -4175, -3998, -3688, -3407, -3259, -3204, -3147, -3038, -2883, -2732, -2653, -2660, -2688, -2657, -2532, -2276, -1874, -1471, -1311, -1422, -1510, -1313, -943, -659, -461, -161, 168, 204, -76, -217, 150, 855, 1470, 1777, 1767, 1564, 1476, 1828, 2538, 3123, 3238, 3035, 2897, 3032, 3409, 3918, 4445, 4815, 4884, 4722, 4625, 4810, 5154, 5367, 5340, 5206, 5111, 5093, 5168, 5333, 5492, 5536, 5496, 5470, 5448, 5334, 5085, 4769, 4500, 4390, 4447, 4529, 4482, 4335, 4261, 4317, 4335, 4160, 3892, 3713, 3625, 3542, 3518, 3581, 3538, 3241, 2874, 2714, 2773, 2883, 2905, 2746, 2407, 2128, 2166, 2418, 2538, 2426, 2320, 2388, 2457, 2279, 1866, 1456, 1255, 1321, 1570, 1796, 1802, 1649, 1602, 1741, 1814, 1634, 1339, 1130, 961, 702, 449, 439, 730, 1101, 1331, 1386, 1357, 1320, 1316, 1321, 1228, 960, 643, 543, 775, 1184, 1535, 1760, 1968, 2239, 2492, 2576, 2484, 2360, 2305, 2311, 2400, 2645, 2995, 3297, 3489, 3614, 3688, 3730, 3859, 4184, 4563, 4731, 4663, 4621, 4785, 5013, 5130, 5208, 5360, 5507, 5534, 5465, 5304, 4985, 4690, 4804, 5366, 5945, 6176, 6090, 5847, 5520, 5216, 5082, 5078, 4982, 4745, 4612, 4740, 4923, 4919, 4851, 5001, 5348, 5605, 5583, 5257, 4675, 3983, 3403, 3088, 3123, 3570, 4244, 4661, 4497, 3972, 3509, 3284, 3248, 3332, 3380, 3159, 2607, 1972, 1626, 1787, 2369, 2978, 3172, 2875, 2444, 2261, 2309, 2286, 2049, 1793, 1760, 1965, 2250, 2410, 2256, 1809, 1415, 1398, 1634, 1784, 1806, 1890, 2031, 2048, 1846, 1466, 1019, 737, 788, 1023, 1136, 1038, 845, 640, 526, 706, 1225, 1734, 1828, 1492, 1050, 735, 567, 574, 804, 1053, 969, 581, 384, 705, 1298, 1697, 1703, 1415, 1041, 767, 649, 595, 537, 514, 558, 650, 826, 1158, 1562, 1796, 1755, 1601, 1476, 1247, 786, 375, 456, 1012, 1548, 1682, 1432, 1009, 631, 430, 304, -1, -517, -996, -1316, -1609, -1916, -2075, -2136, -2562, -3764, -5532, -7212, -8340, -8866, -8898, -8579, -8120, -7611, -6907, -6008, -5297, -5074, -5215, -5492, -5818, -5996, -5679, -4805, -3616, -2180, -289, 2009, 4261, 6083, 7543, 8843, 9896, 10500, 10710, 10744, 10781, 11181, 12442, 14499, 16520, 17757, 18260, 18403, 18316, 18093, 17998, 18115, 18128, 17726, 16990, 16222, 15614, 15278, 15327, 15603, 15495, 14507, 12879, 11317, 10259, 9670, 9345, 8999, 8414, 7762, 7382, 7181, 6683, 5711, 4559, 3511, 2658, 2113, 1956, 2030, 2106, 2143, 2181, 2062, 1617, 1089, 892, 896, 492, -462, -1428, -2046, -2445, -2604, -2291, -1755, -1606, -2002, -2650, -3450, -4439, -5309, -5709, -5877, -6364, -7238, -8042, -8506, -8815, -9067, -9136, -9198, -9729, -10705, -11507, -11873, -12180, -12612, -12868, -12828, -12759, -12789, -12800, -12783, -12840, -12930, -12967, -12999, -13022, -12831, -12300, -11654, -11200, -10868, -10365, -9722, -9267, -9057, -8817, -8444, -8100, -7802, -7441, -7065, -6715, -6161, -5259, -4321, -3728, -3512, -3497, -3575, -3614, -3422, -3004, -2617, -2466, -2458, -2353, -2045, -1618, -1212, -955, -936, -1097, -1266, -1387, -1566, -1789, -1871, -1778, -1677, -1587, -1361, -1075, -1049, -1361, -1688, -1766, -1757, -2002, -2579, -3248, -3735, -3898, -3775, -3632, -3806, -4291, -4703, -4874, -5153, -5868, -6894, -7896, -8660, -9093, -9286, -9525, -9917, -10198, -10270, -10562, -11376, -12286, -12648, -12524, -12539, -12978, -13534, -13962, -14344, -14555, -14165, -13180, -12251, -11845, -11833, -12061, -12546, -13003, -12898, -12044, -10667, -9096, -7798, -7306, -7617, -8005, -7794, -6962, -5837, -4672, -3743, -3407, -3616, -3713, -3117, -2078, -1214, -603, 36, 503, 360, -164, -326, 90, 642, 969, 1136, 1286, 1419, 1458, 1310, 969, 600, 456, 606, 837, 827, 421, -227, -738, -773, -358, 54, -33, -644, -1347, -1827, -2185, -2543, -2699, -2421, -1856, -1433, -1446, -1899, -2572, -3176, -3505, -3512, -3308, -3056, -2894, -2879, -2987, -3171, -3395, -3626, -3772, -3729, -3559, -3537, -3819, -4154, -4231, -4126, -4104, -4115, -3908, -3585, -3561, -3991, -4548, -4798, -4538, -3853, -3054, -2546, -2536, -2833, -3059, -3069, -3025, -3033, -2938, -2553, -1884, -1058, -278, 199, 291, 248, 361, 607, 838, 1064, 1310, 1454, 1440, 1451, 1687, 2151, 2698, 3109, 3192, 2993, 2881, 3163, 3723, 4129, 4075, 3681, 3365, 3456, 3877, 4214, 4152, 3827, 3688, 4035, 4740, 5406, 5688, 5446, 4791, 4109, 3867, 4166, 4635, 4895, 4982, 5155, 5428, 5517, 5239, 4751, 4371, 4207, 4098, 3892, 3686, 3659, 3756, 3724, 3509, 3434, 3776, 4266, 4319, 3764, 3006, 2414, 2019, 1893, 2246, 2931, 3310, 3037, 2572, 2517, 2744, 2631, 2049, 1606, 1840, 2537, 3114, 3337, 3328, 3128, 2693, 2254, 2248, 2725, 3240, 3438, 3428, 3416, 3346, 3181, 3219, 3698, 4277, 4382, 4050, 3935, 4363, 4861, 4839, 4372, 4003, 4036, 4394, 4931, 5520, 5887, 5769, 5301, 4975, 5080, 5436, 5759, 6015, 6255, 6383, 6324, 6281, 6516, 6936, 7189, 7122, 6954, 6950, 7189, 7656, 8284, 8879, 9175, 9132, 8949, 8776, 8549, 8205, 7858, 7639, 7530, 7550, 7814, 8247, 8472, 8261, 7841, 7459, 6990, 6274, 5535, 5126, 5052, 5009, 4792, 4507, 4380, 4433, 4478, 4408, 4339, 4369, 4365, 4184, 3943, 3858, 3910, 3926, 3866, 3783, 3536, 2934, 2270, 2241, 3011, 3830, 3943, 3454, 2816, 2082, 1221, 632, 690, 1072, 1093, 525, -363, -1347, -2372, -3243, -3658, -3643, -3491, -3221, -2532, -1398, -205, 800, 1747, 2709, 3503, 4023, 4481, 5088, 5827, 6724, 8044, 9936, 12111, 14177, 16080, 17841, 19145, 19636, 19476, 19201, 19200, 19559, 20109, 20503, 20434, 19923, 19289, 18828, 18630, 18547, 18205, 17225, 15575, 13635, 11800, 10153, 8637, 7336, 6304, 5202, 3602, 1634, -120, -1445, -2648, -3912, -5028, -5919, -6869, -8027, -9074, -9711, -10102, -10585, -11138, -11519, -11745, -12033, -12349, -12443, -12262, -12031, -11845, -11566, -11071, -10417, -9785, -9341, -9125, -9038, -8983, -8932, -8826, -8528, -8029, -7538, -7222, -7017, -6752, -6406, -6063, -5756, -5482, -5350, -5492, -5815, -6074, -6208, -6308, -6320, -6128, -5864, -5784, -5831, -5709, -5374, -5094, -5064, -5207, -5361, -5436, -5403, -5265, -5072, -4910, -4833, -4770, -4558, -4116, -3616, -3352, -3436, -3671, -3757, -3557, -3179, -2835, -2646, -2555, -2489, -2535, -2795, -3135, -3330, -3392, -3458, -3497, -3415, -3304, -3264, -3245, -3267, -3473, -3793, -3965, -4029, -4332, -4958, -5594, -5961, -6020, -5855, -5617, -5448, -5286, -5017, -4816, -4988, -5445, -5777, -5803, -5730, -5760, -5875, -5956, -5903, -5722, -5535, -5438, -5378, -5314, -5371, -5587, -5804, -5978, -6282, -6725, -7030, -7079, -7069, -7153, -7262, -7383, -7644, -8053, -8402, -8507, -8382, -8193, -8133, -8283, -8521, -8584, -8325, -7866, -7445, -7130, -6828, -6536, -6320, -6097, -5708, -5162, -4552, -3824, -2939, -2125, -1632, -1353, -988, -506, -102, 223, 675, 1239, 1593, 1595, 1524, 1657, 1866, 1908, 1880, 2014, 2179, 1996, 1423, 834, 461, 128, -321, -720, -951, -1254, -1819, -2427, -2765, -2902, -3155, -3651, -4227, -4676, -4976, -5259, -5603, -5925, -6132, -6242, -6275, -6165, -5967, -5946, -6220, -6459, -6257, -5749, -5506, -5690, -5795, -5466, -5078, -5045, -5079, -4763, -4332, -4230, -4306, -4135, -3775, -3568, -3528, -3380, -3021, -2653, -2521, -2612, -2621, -2342, -2010, -1954, -2002, -1750, -1296, -1097, -1196, -1178, -878, -542, -347, -180, 80, 398, 632, 682, 644, 715, 863, 860, 774, 940, 1309, 1469, 1433, 1678, 2243, 2622, 2618, 2550, 2546, 2356, 1943, 1650, 1694, 1916, 2082, 2177, 2312, 2514, 2711, 2848, 2926, 2948, 2865, 2574, 2007, 1357, 1068, 1335, 1818, 2126, 2276, 2356, 2187, 1769, 1551, 1782, 2047, 1924, 1645, 1670, 1952, 2103, 2038, 1976, 1935, 1734, 1499, 1619, 2095, 2406, 2243, 1959, 2011, 2374, 2754, 3073, 3300, 3110, 2329, 1510, 1447, 2148, 2958, 3520, 3969, 4264, 4122, 3610, 3192, 3123, 3222, 3258, 3237, 3229, 3201, 3146, 3136, 3159, 3121, 3130, 3392, 3775, 3895, 3681, 3423, 3249, 3095, 3079, 3424, 4019, 4502, 4722, 4780, 4742, 4647, 4683, 5053, 5667, 6128, 6132, 5780, 5470, 5472, 5737, 6187, 6823, 7342, 7130, 6124, 5165, 4957, 5307, 5806, 6403, 6831, 6478, 5435, 4701, 4822, 5232, 5278, 5051, 4906, 4852, 4734, 4554, 4418, 4343, 4292, 4310, 4500, 4824, 5013, 4847, 4433, 4056, 3836, 3790, 4080, 4824, 5633, 5814, 5150, 4248, 3871, 4126, 4647, 5223, 5769, 5949, 5519, 4925, 4854, 5250, 5507, 5426, 5267, 5121, 4894, 4679, 4586, 4418, 3948, 3307, 2794, 2524, 2417, 2344, 2238, 2113, 1998, 1862, 1692, 1569, 1452, 1043, 154, -877, -1455, -1261, -399, 770, 1733, 2058, 1726, 1045, 293, -288, -425, -96, 320, 529, 651, 793, 679, 154, -277, -32, 617, 859, 592, 489, 683, 415, -619, -1643, -2013, -2048, -2224, -2521, -2857, -3242, -3271, -2232, 51, 2959, 5576, 7226, 7742, 7522, 7156, 7069, 7592, 8966, 10935, 12779, 14152, 15476, 17225, 19340, 21451, 23157, 23987, 23684, 22746, 22103, 22083, 22061, 21350, 20106, 19059, 18596, 18381, 17910, 17108, 16109, 14745, 12757, 10390, 8271, 6556, 4799, 2685, 368, -1958, -4219, -6146, -7452, -8272, -9064, -10083, -11239, -12400, -13471, -14304, -14794, -15030, -15228, -15559, -16003, -16344, -16342, -15899, -15132, -14204, -13183, -12086, -11005, -10048, -9168, -8153, -6909, -5704, -4920, -4481, -3849, -2817, -1891, -1438, -1010, -98, 969, 1661, 2170, 2962, 3849, 4269, 4101, 3695, 3373, 3270, 3354, 3424, 3289, 2975, 2629, 2351, 2221, 2282, 2424, 2492, 2444, 2223, 1694, 964, 408, 171, -19, -330, -597, -786, -1117, -1576, -1789, -1580, -1215, -1046, -1221, -1693, -2275, -2725, -2959, -3114, -3351, -3689, -4040, -4273, -4347, -4423, -4675, -5001, -5210, -5415, -5843, -6359, -6655, -6769, -6922, -7077, -7152, -7341, -7760, -8085, -7998, -7673, -7522, -7687, -7988, -8151, -7999, -7599, -7187, -6934, -6772, -6589, -6403, -6275, -6151, -5920, -5590, -5292, -5129, -5054, -4951, -4750, -4456, -4185, -4113, -4322, -4653, -4833, -4797, -4783, -5048, -5573, -6104, -6436, -6571, -6647, -6784, -7028, -7374, -7767, -8120, -8422, -8764, -9202, -9619, -9861, -9956, -10065, -10175, -10063, -9644, -9168, -8942, -8939, -8855, -8535, -8151, -7930, -7805, -7502, -6966, -6399, -5908, -5381, -4811, -4344, -3933, -3385, -2817, -2571, -2620, -2553, -2262, -2114, -2293, -2434, -2165, -1661, -1384, -1489, -1819, -2287, -2890, -3446, -3759, -3936, -4185, -4492, -4741, -4946, -5148, -5376, -5753, -6275, -6629, -6671, -6802, -7336, -7907, -8023, -7763, -7460, -7160, -6827, -6645, -6780, -7106, -7405, -7551, -7486, -7226, -6832, -6338, -5828, -5526, -5515, -5517, -5294, -4999, -4790, -4483, -3977, -3582, -3532, -3618, -3600, -3498, -3293, -2821, -2129, -1501, -1075, -751, -484, -351, -326, -224, 93, 558, 962, 1127, 1035, 885, 995, 1515, 2212, 2671, 2750, 2662, 2603, 2519, 2331, 2184, 2243, 2437, 2586, 2721, 3017, 3387, 3439, 2955, 2237, 1784, 1725, 1815, 1886, 1942, 1888, 1630, 1422, 1619, 2071, 2341, 2398, 2521, 2638, 2404, 1888, 1580, 1738, 2187, 2733, 3346, 3877, 4027, 3778, 3494, 3399, 3335, 3247, 3405, 3881, 4266, 4230, 3999, 3932, 4023, 4078, 4094, 4111, 3973, 3654, 3563, 3973, 4408, 4261, 3775, 3654, 3929, 4083, 4035, 4131, 4350, 4295, 3980, 3870, 4108, 4324, 4310, 4320, 4430, 4287, 3833, 3640, 4056, 4658, 4979, 5104, 5191, 5052, 4641, 4371, 4568, 4971, 5174, 5219, 5395, 5681, 5809, 5779, 5843, 6035, 6129, 6054, 5963, 5944, 5977, 6074, 6227, 6326, 6332, 6413, 6718, 7126, 7368, 7343, 7146, 6910, 6738, 6779, 7069, 7371, 7407, 7229, 7068, 6973, 6897, 6930, 7109, 7266, 7262, 7104, 6739, 6131, 5534, 5220, 5031, 4661, 4218, 4003, 3946, 3731, 3346, 3057, 2937, 2762, 2400, 1967, 1542, 1070, 639, 445, 405, 222, -29, 64, 552, 933, 851, 510, 271, 227, 362, 723, 1171, 1328, 1076, 838, 987, 1299, 1437, 1587, 2051, 2553, 2601, 2311, 2257, 2601, 2930, 2940, 2812, 2762, 2702, 2516, 2297, 2058, 1668, 1247, 1132, 1299, 1324, 1012, 578, 153, -372, -944, -1313, -1457, -1671, -2107, -2553, -2767, -2792, -2774, -2751, -2815, -3157, -3711, -4061, -3982, -3791, -3839, -3970, -3815, -3402, -3076, -2965, -2901, -2817, -2861, -3019, -3051, -2880, -2708, -2587, -2239, -1620, -1310, -1836, -2765, -3155, -2846, -2562, -2737, -3054, -3241, -3472, -3984, -4998, -6784, -9055, -10789, -11318, -10995, -10385, -9567, -8576, -7602, -6583, -5398, -4346, -3687, -3140, -2476, -2005, -1849, -1294, 500, 3626, 7519, 11397, 14627, 17082, 19178, 21203, 22992, 24381, 25542, 26659, 27682, 28626, 29625, 30656, 31573, 32311, 32767, 32735, 32231, 31590, 30980, 30113, 28585, 26262, 23416, 20605, 18302, 16369, 14258, 11865, 9650, 7799, 5938, 3797, 1559, -520, -2381, -4072, -5778, -7735, -9766, -11276, -11944, -12129, -12330, -12628, -12806, -12708, -12302, -11639, -10820, -9923, -8920, -7741, -6443, -5215, -4231, -3506, -2912, -2246, -1309, -65, 1276, 2509, 3720, 5095, 6465, 7409, 7801, 7923, 7983, 7874, 7445, 6789, 6176, 5810, 5714, 5776, 5904, 6088, 6279, 6290, 5919, 5152, 4171, 3192, 2337, 1654, 1134, 734, 416, 186, 105, 219, 493, 794, 988, 1038, 943, 671, 249, -153, -385, -508, -676, -881, -976, -922, -853, -929, -1190, -1569, -1968, -2356, -2806, -3415, -4186, -5030, -5866, -6684, -7509, -8328, -9084, -9717, -10271, -10863, -11523, -12134, -12550, -12785, -12999, -13359, -13905, -14471, -14768, -14671, -14365, -14115, -13940, -13678, -13234, -12630, -11910, -11126, -10363, -9674, -9018, -8379, -7823, -7387, -6947, -6359, -5715, -5240, -4965, -4738, -4542, -4507, -4622, -4721, -4763, -4863, -5094, -5452, -6004, -6812, -7746, -8572, -9228, -9880, -10625, -11350, -11900, -12334, -12821, -13400, -13948, -14326, -14515, -14559, -14518, -14468, -14471, -14508, -14511, -14460, -14313, -13918, -13215, -12473, -12027, -11807, -11446, -10779, -9912, -8962, -8060, -7456, -7288, -7296, -7120, -6770, -6564, -6608, -6674, -6598, -6509, -6519, -6536, -6527, -6647, -6920, -7180, -7391, -7745, -8270, -8733, -9052, -9458, -10070, -10603, -10727, -10516, -10314, -10260, -10208, -10036, -9824, -9620, -9318, -8880, -8496, -8316, -8193, -7946, -7624, -7258, -6582, -5477, -4381, -3732, -3344, -2824, -2221, -1814, -1566, -1285, -988, -771, -549, -227, 112, 346, 519, 724, 884, 888, 843, 968, 1236, 1375, 1192, 698, 42, -462, -504, -200, -66, -362, -798, -988, -806, -366, -11, -116, -552, -808, -816, -1016, -1406, -1450, -1065, -764, -709, -517, -54, 417, 760, 1017, 1064, 808, 599, 881, 1568, 2135, 2342, 2466, 2773, 3123, 3297, 3457, 3895, 4491, 4810, 4745, 4675, 4908, 5326, 5751, 6202, 6610, 6699, 6463, 6355, 6670, 7062, 7047, 6707, 6586, 6969, 7559, 7850, 7638, 7178, 6926, 7141, 7609, 7829, 7572, 7126, 6842, 6639, 6275, 5904, 5945, 6434, 6874, 6868, 6590, 6429, 6467, 6507, 6421, 6176, 5729, 5209, 4969, 5205, 5653, 5907, 5902, 5912, 6149, 6534, 6829, 6852, 6596, 6191, 5823, 5667, 5798, 6109, 6402, 6575, 6641, 6568, 6310, 6015, 6054, 6586, 7229, 7402, 7039, 6668, 6712, 6962, 6959, 6629, 6303, 6278, 6593, 7069, 7431, 7545, 7566, 7720, 7936, 7920, 7606, 7302, 7239, 7269, 7152, 6959, 6921, 7021, 7079, 7096, 7201, 7316, 7210, 6904, 6665, 6600, 6507, 6194, 5783, 5514, 5424, 5320, 5053, 4664, 4328, 4204, 4244, 4171, 3786, 3267, 2940, 2825, 2696, 2476, 2259, 2069, 1854, 1628, 1456, 1394, 1511, 1792, 2048, 2120, 2074, 2026, 1971, 1978, 2198, 2549, 2739, 2729, 2748, 2870, 2995, 3130, 3248, 3189, 3013, 2992, 3059, 2909, 2681, 2758, 2947, 2766, 2308, 1938, 1543, 895, 256, -109, -432, -910, -1284, -1379, -1433, -1664, -1988, -2330, -2781, -3384, -4031, -4564, -4851, -4840, -4653, -4472, -4354, -4240, -4097, -3925, -3695, -3393, -3007, -2557, -2272, -2459, -2927, -2895, -1982, -824, -220, -117, 20, 404, 968, 1631, 2164, 2311, 2128, 1802, 1367, 1024, 1176, 1712, 1920, 1562, 1301, 1630, 2084, 1994, 1372, 624, -176, -1171, -2137, -2654, -2736, -2751, -2908, -3356, -4343, -5495, -5729, -4818, -4106, -4713, -6069, -7153, -7864, -8336, -8236, -7513, -6816, -6596, -6706, -6952, -7308, -7545, -7363, -6874, -6503, -6414, -6355, -6099, -5850, -6103, -7076, -8420, -9635, -10553, -11233, -11558, -11353, -10734, -9935, -8898, -7414, -5639, -4058, -2983, -2393, -2238, -2478, -2704, -2177, -539, 1862, 4668, 7997, 11866, 15660, 18688, 20852, 22383, 23360, 23939, 24506, 25312, 26181, 26893, 27579, 28469, 29566, 30698, 31755, 32553, 32623, 31546, 29474, 26984, 24477, 22027, 19641, 17401, 15312, 13359, 11511, 9656, 7701, 5737, 3885, 2023, -114, -2498, -4811, -6832, -8625, -10290, -11737, -12814, -13469, -13667, -13391, -12887, -12628, -12772, -12915, -12582, -11686, -10374, -8825, -7341, -6267, -5595, -4939, -4013, -2898, -1731, -440, 995, 2282, 3197, 4019, 5132, 6416, 7419, 7993, 8316, 8418, 8137, 7507, 6776, 6087, 5440, 5009, 5097, 5680, 6306, 6643, 6707, 6467, 5713, 4532, 3405, 2583, 1862, 1092, 421, -15, -219, -88, 529, 1462, 2249, 2563, 2443, 2067, 1513, 845, 230, -211, -522, -746, -787, -604, -374, -285, -312, -341, -384, -581, -1065, -1862, -2880, -3982, -5054, -5958, -6524, -6775, -7019, -7464, -7941, -8295, -8678, -9161, -9542, -9785, -10143, -10621, -10937, -11087, -11228, -11189, -10805, -10417, -10293, -10070, -9386, -8515, -7815, -7215, -6626, -6210, -5969, -5636, -5114, -4522, -3929, -3359, -2932, -2705, -2579, -2488, -2451, -2414, -2349, -2389, -2646, -2987, -3272, -3609, -4164, -4874, -5583, -6276, -7019, -7712, -8190, -8503, -8880, -9411, -9948, -10376, -10742, -11078, -11266, -11284, -11333, -11585, -11911, -12004, -11704, -11122, -10469, -9901, -9490, -9284, -9235, -9104, -8672, -8021, -7442, -7015, -6586, -6162, -5916, -5775, -5475, -5056, -4864, -5003, -5218, -5353, -5540, -5872, -6236, -6539, -6854, -7229, -7545, -7698, -7798, -8053, -8513, -9057, -9589, -10087, -10508, -10782, -10897, -10903, -10845, -10728, -10534, -10255, -9904, -9496, -9051, -8632, -8320, -8124, -7926, -7604, -7171, -6735, -6312, -5786, -5083, -4310, -3627, -3081, -2624, -2275, -2116, -2133, -2187, -2163, -2078, -1968, -1779, -1527, -1408, -1503, -1555, -1355, -1145, -1265, -1610, -1855, -1999, -2204, -2360, -2249, -1965, -1812, -1894, -2071, -2218, -2283, -2206, -1966, -1686, -1511, -1394, -1179, -860, -531, -198, 94, 131, -136, -328, -87, 364, 515, 240, -155, -395, -422, -211, 273, 856, 1176, 1049, 651, 291, 166, 332, 574, 383, -498, -1570, -2021, -1596, -643, 442, 1403, 2003, 2158, 2144, 2290, 2594, 2792, 2740, 2592, 2642, 3070, 3820, 4737, 5718, 6665, 7404, 7832, 8126, 8583, 9250, 9833, 9977, 9593, 8946, 8474, 8484, 8927, 9483, 9848, 9939, 9859, 9731, 9628, 9538, 9361, 8963, 8300, 7485, 6723, 6160, 5832, 5695, 5653, 5553, 5282, 4912, 4700, 4784, 4976, 4960, 4645, 4193, 3774, 3497, 3465, 3672, 3904, 3964, 3914, 3977, 4240, 4583, 4851, 5015, 5180, 5443, 5726, 5907, 6044, 6297, 6585, 6679, 6586, 6553, 6651, 6735, 6746, 6750, 6791, 6908, 7141, 7383, 7488, 7534, 7649, 7651, 7320, 6830, 6491, 6267, 5962, 5646, 5512, 5550, 5666, 5864, 6094, 6153, 5951, 5659, 5454, 5269, 4965, 4605, 4299, 3979, 3607, 3470, 3840, 4460, 4796, 4705, 4471, 4297, 4133, 3977, 3935, 3962, 3844, 3501, 3131, 2927, 2852, 2797, 2798, 2914, 3086, 3242, 3383, 3461, 3381, 3103, 2633, 2003, 1419, 1251, 1620, 2164, 2421, 2301, 2059, 1942, 2026, 2260, 2484, 2486, 2168, 1676, 1250, 993, 892, 986, 1277, 1561, 1569, 1310, 1042, 920, 866, 727, 419, -33, -483, -775, -894, -962, -1113, -1439, -1925, -2379, -2608, -2710, -2930, -3256, -3487, -3619, -3762, -3812, -3643, -3429, -3415, -3622, -4011, -4536, -4858, -4582, -3868, -3254, -2924, -2672, -2414, -2193, -1916, -1523, -1181, -1000, -900, -844, -811, -581, -14, 606, 937, 1086, 1324, 1515, 1312, 770, 340, 249, 245, 71, -143, -173, -124, -328, -922, -1734, -2444, -2776, -2705, -2564, -2758, -3371, -4171, -4869, -5247, -5228, -4984, -4765, -4618, -4574, -4859, -5496, -5946, -5700, -4932, -4186, -3721, -3571, -3768, -4167, -4471, -4549, -4383, -3816, -2862, -2016, -1797, -2228, -3150, -4589, -6435, -8179, -9304, -9695, -9655, -9717, -10195, -10685, -10423, -9273, -7774, -6304, -5104, -4884, -6141, -8007, -8880, -8097, -6115, -3464, -442, 2627, 5565, 8436, 11110, 13270, 14930, 16445, 17949, 19300, 20503, 21729, 23054, 24469, 25986, 27597, 29208, 30712, 31908, 32475, 32231, 31256, 29705, 27712, 25601, 23825, 22516, 21326, 19833, 17925, 15757, 13538, 11444, 9605, 7912, 6036, 3783, 1337, -1051, -3347, -5492, -7178, -8266, -9093, -9997, -10809, -11229, -11373, -11525, -11649, -11512, -11117, -10637, -10037, -9106, -7886, -6791, -6128, -5689, -4965, -3783, -2421, -1105, 212, 1487, 2513, 3428, 4608, 5912, 6789, 7218, 7657, 8033, 7844, 7197, 6713, 6538, 6446, 6541, 7006, 7555, 7796, 7711, 7383, 6802, 6087, 5382, 4591, 3651, 2802, 2210, 1762, 1460, 1491, 1769, 2052, 2402, 2870, 3022, 2512, 1741, 1261, 966, 530, 109, 49, 248, 333, 211, 126, 276, 577, 737, 505, -139, -977, -1724, -2295, -2862, -3607, -4471, -5248, -5788, -6038, -6135, -6436, -7152, -7951, -8430, -8737, -9198, -9673, -9941, -10222, -10670, -10989, -11071, -11233, -11416, -11119, -10367, -9718, -9256, -8598, -7783, -7189, -6831, -6465, -6066, -5661, -5130, -4526, -4137, -3982, -3711, -3093, -2272, -1515, -984, -753, -828, -1159, -1691, -2382, -3131, -3790, -4270, -4626, -5010, -5561, -6269, -6977, -7564, -8089, -8628, -9150, -9641, -10267, -11146, -12115, -12891, -13354, -13538, -13513, -13407, -13344, -13274, -12985, -12407, -11768, -11331, -11079, -10808, -10435, -10045, -9690, -9331, -8972, -8591, -8038, -7168, -6130, -5244, -4666, -4325, -4161, -4204, -4373, -4443, -4369, -4375, -4615, -4958, -5277, -5610, -5886, -5890, -5698, -5720, -6140, -6666, -7050, -7461, -8071, -8609, -8784, -8859, -9243, -9714, -9722, -9324, -9073, -9063, -8862, -8347, -7885, -7652, -7439, -7147, -6951, -6886, -6704, -6311, -5939, -5720, -5389, -4727, -3985, -3526, -3294, -3021, -2678, -2465, -2485, -2656, -2804, -2782, -2602, -2441, -2426, -2502, -2594, -2704, -2773, -2639, -2309, -2078, -2203, -2533, -2681, -2536, -2427, -2665, -3023, -3012, -2642, -2421, -2451, -2195, -1500, -1039, -1185, -1299, -811, -187, -76, -212, 7, 453, 497, 55, -301, -202, 44, -7, -253, -246, -26, -106, -535, -702, -457, -560, -1426, -2327, -2553, -2473, -2748, -3292, -3660, -3765, -3673, -3287, -2521, -1457, -362, 313, 254, -204, -315, 186, 920, 1609, 2451, 3569, 4639, 5392, 6070, 7043, 8189, 9118, 9805, 10485, 11075, 11265, 11148, 11184, 11469, 11597, 11341, 11046, 11111, 11421, 11551, 11348, 10977, 10533, 9874, 8968, 8057, 7356, 6746, 5952, 4949, 4042, 3498, 3233, 2933, 2424, 1800, 1237, 794, 459, 243, 132, -28, -387, -779, -842, -516, -138, 109, 461, 1074, 1667, 1975, 2186, 2616, 3220, 3735, 4118, 4548, 5071, 5503, 5747, 5966, 6344, 6818, 7166, 7284, 7274, 7298, 7418, 7554, 7572, 7435, 7268, 7217, 7288, 7340, 7204, 6833, 6358, 5988, 5828, 5780, 5668, 5433, 5173, 5016, 4957, 4866, 4650, 4372, 4169, 4045, 3895, 3710, 3611, 3646, 3680, 3588, 3403, 3241, 3156, 3163, 3267, 3397, 3417, 3306, 3223, 3293, 3390, 3306, 3086, 2969, 3035, 3113, 3079, 3029, 3080, 3149, 3099, 2977, 2936, 2973, 2923, 2709, 2450, 2290, 2220, 2181, 2195, 2287, 2373, 2344, 2237, 2136, 2019, 1821, 1602, 1488, 1481, 1517, 1573, 1642, 1653, 1584, 1521, 1537, 1564, 1437, 1085, 657, 460, 611, 836, 770, 456, 278, 404, 533, 329, -136, -539, -746, -857, -936, -988, -1152, -1569, -2115, -2533, -2778, -2917, -2855, -2536, -2283, -2511, -3110, -3495, -3349, -2994, -2891, -3066, -3256, -3437, -3806, -4231, -4179, -3435, -2561, -2261, -2470, -2499, -1990, -1306, -963, -1053, -1267, -1265, -919, -414, -117, -231, -542, -619, -285, 247, 717, 1103, 1438, 1580, 1368, 910, 534, 449, 536, 471, 28, -698, -1371, -1699, -1672, -1460, -1185, -896, -750, -977, -1547, -2107, -2436, -2699, -3132, -3667, -4130, -4508, -4796, -4752, -4214, -3578, -3448, -3805, -4047, -3992, -4054, -4365, -4615, -4931, -5897, -7519, -9070, -10114, -10853, -11438, -11724, -11719, -11592, -11280, -10560, -9586, -8844, -8529, -8430, -8540, -9136, -9951, -10001, -8708, -6501, -3981, -1193, 1858, 4775, 7225, 9361, 11448, 13525, 15486, 17221, 18634, 19776, 20929, 22396, 24170, 25978, 27575, 28919, 30082, 30998, 31494, 31473, 31002, 30175, 29002, 27503, 25787, 23917, 21866, 19709, 17668, 15952, 14509, 13179, 11875, 10522, 8904, 6802, 4286, 1681, -789, -3063, -5005, -6370, -7180, -7771, -8336, -8735, -8795, -8580, -8197, -7639, -6958, -6402, -6143, -5975, -5548, -4757, -3739, -2590, -1373, -281, 555, 1364, 2532, 4107, 5732, 7056, 7990, 8623, 9058, 9332, 9403, 9226, 8824, 8346, 7973, 7788, 7741, 7752, 7771, 7744, 7617, 7360, 6925, 6270, 5492, 4704, 3785, 2611, 1467, 757, 387, 66, -56, 258, 704, 829, 774, 904, 1100, 1041, 790, 570, 304, -154, -585, -632, -325, 38, 410, 907, 1302, 1275, 1052, 1072, 1126, 668, -213, -983, -1544, -2167, -2798, -3165, -3340, -3594, -3973, -4348, -4690, -5013, -5269, -5470, -5795, -6360, -7002, -7487, -7818, -8075, -8133, -7827, -7304, -6817, -6366, -5884, -5510, -5314, -5071, -4618, -4145, -3865, -3718, -3568, -3414, -3261, -3007, -2593, -2121, -1767, -1622, -1660, -1808, -2074, -2511, -3102, -3707, -4244, -4775, -5422, -6190, -6984, -7716, -8352, -8879, -9284, -9575, -9868, -10380, -11204, -12111, -12774, -13168, -13524, -13911, -14127, -14073, -13893, -13688, -13363, -12853, -12266, -11745, -11284, -10833, -10443, -10193, -10008, -9692, -9169, -8540, -7907, -7223, -6422, -5631, -5094, -4900, -4783, -4415, -3890, -3684, -3977, -4439, -4833, -5286, -5770, -5976, -5903, -5897, -6005, -5998, -5997, -6333, -6941, -7520, -8056, -8632, -9097, -9356, -9586, -9839, -9883, -9619, -9267, -8967, -8573, -8064, -7774, -7871, -7959, -7680, -7347, -7361, -7391, -6929, -6236, -5877, -5729, -5281, -4576, -4073, -3901, -3823, -3710, -3612, -3601, -3722, -3965, -4174, -4153, -3898, -3633, -3587, -3798, -4116, -4336, -4342, -4172, -4032, -4138, -4485, -4812, -4900, -4816, -4760, -4727, -4525, -4132, -3790, -3660, -3611, -3465, -3290, -3201, -3041, -2562, -1838, -1227, -878, -579, -187, 76, -6, -212, -117, 310, 679, 783, 871, 1140, 1375, 1343, 1213, 1226, 1251, 1021, 607, 282, 102, -89, -362, -674, -1055, -1512, -1807, -1599, -929, -294, -132, -432, -934, -1461, -1971, -2458, -2798, -2653, -1760, -418, 710, 1385, 1880, 2315, 2458, 2336, 2366, 2779, 3344, 3741, 3860, 3797, 3862, 4471, 5766, 7343, 8558, 9059, 9000, 8743, 8489, 8165, 7639, 6995, 6553, 6614, 7135, 7751, 8125, 8180, 7947, 7456, 6917, 6651, 6624, 6355, 5546, 4493, 3679, 3220, 2923, 2678, 2589, 2751, 3055, 3259, 3236, 3102, 2984, 2776, 2285, 1626, 1258, 1465, 1952, 2237, 2303, 2521, 2969, 3354, 3593, 3961, 4493, 4810, 4722, 4577, 4752, 5082, 5119, 4777, 4474, 4570, 4902, 5107, 5279, 5758, 6346, 6421, 5956, 5600, 5576, 5393, 4863, 4496, 4533, 4502, 4093, 3706, 3745, 3948, 3848, 3515, 3421, 3709, 3936, 3666, 3029, 2479, 2166, 1912, 1664, 1573, 1599, 1498, 1257, 1138, 1232, 1343, 1387, 1491, 1657, 1689, 1520, 1338, 1262, 1158, 918, 698, 675, 778, 870, 1026, 1349, 1692, 1810, 1754, 1759, 1822, 1703, 1353, 1060, 1020, 1067, 995, 907, 990, 1154, 1193, 1192, 1400, 1749, 1858, 1554, 1159, 1049, 1152, 1114, 851, 642, 631, 614, 464, 417, 646, 885, 800, 461, 124, -222, -683, -1076, -1181, -1229, -1621, -2129, -2057, -1346, -815, -951, -1241, -1152, -1032, -1408, -1997, -2140, -1849, -1717, -1940, -2061, -1713, -1077, -497, -98, 38, -182, -615, -967, -1193, -1412, -1485, -1177, -674, -486, -772, -1152, -1197, -914, -645, -639, -841, -1134, -1595, -2363, -3296, -3936, -3943, -3484, -3010, -2714, -2403, -1953, -1625, -1698, -1950, -1830, -1159, -413, -205, -634, -1249, -1521, -1182, -242, 1093, 2521, 3758, 4555, 4687, 4170, 3431, 3009, 3044, 3314, 3567, 3570, 3094, 2249, 1613, 1686, 2348, 3084, 3520, 3487, 2830, 1547, 69, -1038, -1693, -2257, -2876, -3414, -3966, -4765, -5586, -5910, -5703, -5368, -5138, -5094, -5484, -6426, -7610, -8696, -9717, -10754, -11618, -12136, -12393, -12476, -12180, -11338, -10146, -8872, -7474, -5925, -4675, -4150, -4059, -3797, -3327, -2916, -2269, -691, 1935, 4931, 7724, 10328, 12875, 15159, 16940, 18357, 19637, 20716, 21445, 21955, 22462, 23005, 23625, 24471, 25549, 26610, 27422, 27910, 27983, 27481, 26417, 25058, 23650, 22186, 20554, 18781, 16943, 15037, 13123, 11437, 10106, 9003, 8016, 7148, 6193, 4782, 2892, 962, -683, -2193, -3772, -5163, -5943, -6135, -6213, -6468, -6662, -6437, -5840, -5224, -4827, -4530, -4072, -3437, -2932, -2733, -2527, -1887, -914, -78, 496, 1144, 2076, 3109, 4058, 5007, 6054, 7024, 7606, 7698, 7490, 7211, 6922, 6614, 6384, 6361, 6522, 6731, 6933, 7184, 7446, 7547, 7360, 6969, 6505, 5937, 5165, 4262, 3467, 2929, 2589, 2365, 2312, 2477, 2703, 2777, 2704, 2642, 2579, 2305, 1747, 1093, 499, -77, -652, -1043, -1113, -1013, -965, -929, -760, -583, -721, -1210, -1766, -2238, -2770, -3437, -4061, -4475, -4735, -4943, -5067, -5046, -4951, -4936, -5056, -5224, -5323, -5339, -5343, -5392, -5480, -5555, -5559, -5467, -5277, -4972, -4518, -3918, -3272, -2715, -2293, -1965, -1695, -1463, -1204, -904, -695, -685, -762, -755, -705, -725, -760, -714, -710, -941, -1408, -1979, -2599, -3318, -4138, -4961, -5671, -6261, -6868, -7615, -8429, -9139, -9718, -10248, -10720, -11049, -11309, -11678, -12185, -12631, -12862, -12934, -12930, -12765, -12323, -11698, -11128, -10709, -10300, -9773, -9185, -8590, -7884, -7052, -6377, -6060, -5836, -5341, -4657, -4065, -3508, -2785, -2071, -1717, -1687, -1655, -1562, -1671, -2060, -2451, -2661, -2875, -3279, -3721, -3987, -4159, -4432, -4838, -5310, -5837, -6403, -6991, -7599, -8129, -8440, -8618, -8914, -9291, -9447, -9326, -9196, -9137, -8943, -8577, -8307, -8251, -8204, -8031, -7904, -7911, -7778, -7277, -6645, -6253, -6040, -5683, -5215, -4977, -4969, -4776, -4307, -4062, -4314, -4587, -4450, -4273, -4494, -4790, -4668, -4398, -4490, -4778, -4761, -4515, -4534, -4885, -5141, -5083, -5009, -5206, -5521, -5649, -5587, -5507, -5398, -5116, -4741, -4516, -4463, -4303, -3860, -3348, -3098, -3102, -3058, -2825, -2598, -2528, -2449, -2173, -1807, -1560, -1368, -1011, -516, -157, -59, -52, 49, 177, 116, -191, -557, -797, -943, -1061, -1035, -789, -574, -662, -901, -974, -933, -1065, -1413, -1807, -2188, -2575, -2876, -3041, -3204, -3461, -3695, -3746, -3615, -3404, -3147, -2820, -2458, -2184, -2066, -1944, -1594, -1055, -627, -418, -154, 416, 1173, 1855, 2420, 2948, 3431, 3877, 4471, 5358, 6332, 7002, 7240, 7204, 7002, 6695, 6570, 6928, 7554, 7888, 7764, 7561, 7495, 7325, 6911, 6629, 6826, 7170, 7067, 6457, 5740, 5060, 4266, 3434, 2872, 2669, 2678, 2861, 3216, 3511, 3467, 3164, 2934, 2872, 2729, 2326, 1868, 1674, 1744, 1829, 1881, 2133, 2666, 3198, 3496, 3665, 3826, 3862, 3760, 3801, 4100, 4350, 4308, 4087, 3900, 3862, 4090, 4572, 5005, 5144, 5114, 5096, 5062, 4997, 5024, 5115, 5084, 4924, 4784, 4660, 4437, 4152, 3928, 3812, 3833, 4017, 4272, 4474, 4608, 4609, 4320, 3856, 3644, 3811, 3975, 3869, 3680, 3591, 3520, 3468, 3621, 3951, 4147, 4086, 4028, 4213, 4514, 4617, 4430, 4133, 3866, 3563, 3145, 2724, 2481, 2442, 2431, 2340, 2307, 2519, 2780, 2647, 2106, 1687, 1621, 1469, 937, 434, 340, 364, 143, -61, 203, 859, 1433, 1664, 1650, 1547, 1375, 1127, 909, 851, 955, 1136, 1437, 1946, 2465, 2615, 2382, 2175, 2206, 2275, 2261, 2367, 2682, 2967, 3000, 2792, 2439, 2045, 1743, 1496, 1129, 669, 408, 457, 577, 569, 567, 727, 873, 666, 82, -487, -673, -550, -509, -775, -1141, -1238, -1038, -936, -1157, -1287, -827, -96, 62, -491, -988, -892, -623, -802, -1357, -1763, -1899, -2138, -2711, -3315, -3505, -3230, -2784, -2357, -1933, -1606, -1632, -2110, -2894, -3859, -4878, -5573, -5605, -5192, -4836, -4580, -4062, -3221, -2399, -1805, -1314, -750, -194, -6, -539, -1618, -2514, -2697, -2315, -1684, -772, 420, 1447, 1909, 2047, 2356, 2845, 3044, 2648, 1825, 920, 24, -943, -1790, -1998, -1335, -238, 694, 1310, 1649, 1573, 1134, 856, 1065, 1273, 788, -376, -1629, -2602, -3356, -3919, -3959, -3066, -1353, 379, 1298, 1222, 371, -1243, -3572, -5987, -7696, -8569, -9004, -9223, -9268, -9351, -9568, -9549, -8912, -7922, -7302, -7479, -8237, -9008, -9426, -9520, -9287, -8372, -6587, -4474, -2689, -1133, 662, 2590, 4262, 5838, 7729, 9790, 11550, 12982, 14370, 15737, 16917, 17963, 19136, 20550, 22008, 23229, 24108, 24776, 25263, 25347, 24927, 24350, 23984, 23632, 22820, 21476, 19932, 18390, 16815, 15216, 13713, 12449, 11436, 10401, 8906, 6946, 5070, 3606, 2239, 727, -641, -1653, -2628, -3834, -5017, -5858, -6367, -6604, -6492, -6066, -5584, -5200, -4779, -4225, -3731, -3504, -3388, -3043, -2437, -1840, -1365, -815, 14, 1094, 2257, 3373, 4394, 5243, 5699, 5602, 5209, 5034, 5203, 5333, 5194, 5056, 5177, 5374, 5411, 5393, 5512, 5652, 5565, 5243, 4848, 4387, 3747, 3002, 2420, 2128, 1996, 1938, 2074, 2385, 2488, 2124, 1637, 1547, 1773, 1795, 1499, 1226, 1059, 708, 131, -310, -406, -350, -363, -425, -527, -826, -1364, -1911, -2330, -2776, -3323, -3790, -4160, -4716, -5462, -5953, -6004, -6000, -6264, -6583, -6664, -6625, -6739, -6986, -7150, -7147, -7069, -6931, -6638, -6186, -5715, -5301, -4822, -4212, -3623, -3169, -2676, -2059, -1617, -1534, -1388, -786, -83, 210, 263, 437, 522, 225, -131, -132, -33, -370, -1155, -1975, -2632, -3274, -3999, -4681, -5243, -5850, -6693, -7655, -8438, -9013, -9624, -10328, -10921, -11411, -12055, -12784, -13164, -13080, -12945, -12957, -12791, -12225, -11573, -11148, -10771, -10169, -9499, -9056, -8707, -8052, -7081, -6176, -5486, -4793, -3998, -3282, -2690, -1982, -1069, -261, 123, 160, 109, 31, -176, -443, -552, -550, -813, -1497, -2216, -2564, -2741, -3226, -4029, -4746, -5242, -5800, -6598, -7452, -8142, -8669, -9118, -9485, -9722, -9846, -9915, -9968, -10021, -10021, -9814, -9360, -8912, -8707, -8565, -8226, -7860, -7701, -7442, -6699, -5751, -5105, -4679, -4068, -3312, -2754, -2426, -2116, -1785, -1541, -1373, -1152, -863, -641, -586, -627, -647, -669, -801, -937, -850, -656, -800, -1361, -1882, -2114, -2345, -2744, -3012, -3015, -3120, -3532, -3864, -3715, -3289, -3096, -3321, -3671, -3784, -3640, -3505, -3512, -3490, -3322, -3162, -3106, -2979, -2685, -2454, -2481, -2612, -2616, -2502, -2364, -2193, -1984, -1816, -1745, -1735, -1731, -1679, -1510, -1216, -908, -714, -662, -652, -524, -226, 64, 171, 226, 504, 965, 1315, 1458, 1528, 1564, 1535, 1524, 1535, 1360, 966, 653, 556, 427, 135, -17, 215, 603, 712, 343, -392, -1234, -1899, -2200, -2132, -1865, -1606, -1461, -1387, -1299, -1196, -1043, -641, 83, 793, 1052, 944, 994, 1480, 2224, 2978, 3651, 4153, 4451, 4791, 5520, 6527, 7237, 7357, 7307, 7609, 8137, 8378, 8201, 7950, 7865, 7823, 7735, 7722, 7815, 7785, 7446, 6889, 6231, 5468, 4751, 4386, 4314, 4072, 3464, 2850, 2520, 2300, 1968, 1605, 1308, 943, 459, 120, 183, 483, 665, 683, 756, 939, 1097, 1231, 1481, 1842, 2158, 2387, 2603, 2837, 3083, 3417, 3906, 4440, 4841, 5130, 5494, 5942, 6234, 6233, 6140, 6207, 6412, 6586, 6695, 6815, 6904, 6835, 6625, 6467, 6471, 6535, 6519, 6380, 6127, 5785, 5447, 5169, 4920, 4667, 4448, 4255, 4023, 3782, 3617, 3479, 3281, 3084, 2951, 2769, 2465, 2209, 2146, 2135, 2012, 1887, 1950, 2148, 2248, 2142, 1938, 1809, 1848, 2055, 2319, 2433, 2261, 1919, 1672, 1657, 1780, 1899, 1965, 1981, 1967, 1946, 1905, 1813, 1686, 1608, 1624, 1694, 1755, 1792, 1811, 1760, 1624, 1526, 1608, 1822, 2049, 2275, 2490, 2545, 2387, 2238, 2283, 2410, 2457, 2447, 2426, 2404, 2464, 2612, 2649, 2476, 2286, 2154, 1858, 1374, 1032, 932, 760, 379, 44, -105, -260, -520, -711, -795, -1022, -1486, -1866, -1933, -1962, -2269, -2626, -2613, -2306, -2085, -1991, -1796, -1530, -1433, -1475, -1354, -959, -538, -351, -354, -318, -190, -125, -128, 50, 463, 741, 651, 501, 587, 660, 421, 91, -47, -266, -933, -1755, -2129, -2089, -2214, -2619, -2776, -2502, -2353, -2678, -3091, -3274, -3530, -4080, -4501, -4381, -3978, -3732, -3579, -3224, -2762, -2467, -2207, -1647, -934, -528, -431, -271, 6, 221, 449, 810, 1132, 1356, 1687, 2070, 2165, 2020, 1975, 2047, 2143, 2422, 2761, 2608, 1994, 1617, 1551, 1129, 306, -238, -362, -494, -636, -534, -431, -633, -950, -1251, -1837, -2674, -3098, -2824, -2504, -2821, -3611, -4354, -5086, -6241, -7793, -9174, -10026, -10478, -10674, -10562, -10233, -9984, -9922, -9913, -9944, -10216, -10767, -11303, -11503, -11342, -10974, -10355, -9195, -7326, -4990, -2725, -937, 384, 1583, 2969, 4521, 5974, 7196, 8389, 9812, 11460, 13048, 14348, 15510, 16867, 18392, 19626, 20325, 20753, 21123, 21232, 20951, 20543, 20101, 19350, 18272, 17288, 16553, 15695, 14510, 13282, 12267, 11315, 10171, 8776, 7185, 5441, 3629, 1898, 361, -970, -2136, -3089, -3742, -4117, -4416, -4807, -5239, -5555, -5711, -5752, -5672, -5418, -4992, -4423, -3761, -3157, -2732, -2327, -1683, -838, -32, 739, 1649, 2655, 3574, 4401, 5184, 5827, 6259, 6544, 6674, 6570, 6354, 6270, 6328, 6359, 6346, 6396, 6471, 6427, 6290, 6185, 6044, 5640, 4935, 4184, 3582, 3048, 2470, 1938, 1573, 1345, 1189, 1126, 1115, 1016, 799, 622, 556, 426, 105, -200, -275, -297, -582, -1036, -1258, -1160, -1071, -1157, -1185, -995, -846, -1016, -1357, -1570, -1716, -2066, -2599, -3038, -3289, -3476, -3649, -3754, -3834, -3958, -4061, -4059, -4022, -4057, -4098, -4013, -3853, -3805, -3886, -3876, -3629, -3239, -2846, -2463, -2096, -1804, -1566, -1208, -629, 28, 519, 765, 903, 1082, 1280, 1363, 1271, 1061, 757, 340, -113, -494, -853, -1332, -1903, -2449, -3027, -3731, -4452, -5081, -5796, -6768, -7830, -8712, -9433, -10128, -10718, -11061, -11245, -11514, -11922, -12276, -12356, -12143, -11777, -11384, -11000, -10639, -10306, -9959, -9507, -8907, -8224, -7524, -6831, -6140, -5447, -4712, -3965, -3344, -2906, -2493, -1972, -1475, -1189, -1080, -1058, -1192, -1529, -1889, -2074, -2152, -2352, -2755, -3265, -3773, -4254, -4727, -5169, -5544, -5923, -6458, -7147, -7767, -8170, -8463, -8724, -8858, -8877, -8983, -9161, -9112, -8738, -8268, -7842, -7381, -6926, -6673, -6619, -6502, -6166, -5734, -5370, -5060, -4675, -4121, -3422, -2727, -2253, -2075, -1997, -1781, -1530, -1519, -1709, -1819, -1841, -1983, -2199, -2272, -2202, -2116, -1999, -1866, -1899, -2122, -2277, -2260, -2288, -2504, -2784, -3010, -3187, -3282, -3171, -2835, -2423, -2099, -1917, -1830, -1734, -1512, -1142, -758, -546, -524, -530, -439, -267, -65, 154, 349, 450, 507, 686, 1027, 1321, 1367, 1251, 1185, 1192, 1163, 1129, 1184, 1206, 983, 587, 354, 465, 768, 1002, 1048, 917, 683, 475, 421, 485, 467, 251, -55, -296, -457, -582, -627, -526, -332, -193, -187, -293, -462, -647, -787, -879, -1006, -1171, -1170, -802, -173, 417, 840, 1181, 1559, 2022, 2619, 3322, 3896, 4052, 3836, 3647, 3776, 4195, 4873, 5842, 6811, 7240, 7061, 6813, 6897, 7197, 7500, 7665, 7477, 6862, 6196, 5911, 5970, 6070, 6018, 5758, 5355, 5026, 4821, 4462, 3841, 3306, 3050, 2750, 2199, 1731, 1620, 1599, 1339, 924, 563, 219, -136, -250, 66, 501, 566, 280, 121, 318, 610, 749, 799, 849, 826, 728, 779, 1114, 1542, 1842, 2054, 2260, 2342, 2304, 2486, 3090, 3743, 3947, 3714, 3438, 3350, 3425, 3592, 3763, 3801, 3713, 3756, 4118, 4581, 4803, 4824, 4943, 5130, 5013, 4502, 3977, 3771, 3789, 3814, 3840, 3936, 4034, 4082, 4177, 4305, 4178, 3681, 3182, 3037, 3024, 2677, 2051, 1617, 1520, 1400, 1065, 830, 960, 1178, 1087, 694, 225, -233, -596, -724, -710, -846, -1133, -1274, -1210, -1157, -1160, -1033, -717, -373, -167, -114, -74, 171, 653, 1090, 1226, 1209, 1408, 1960, 2644, 3154, 3365, 3381, 3436, 3709, 4147, 4485, 4551, 4488, 4504, 4495, 4290, 4097, 4173, 4236, 3884, 3315, 2923, 2582, 2095, 1776, 1811, 1747, 1246, 662, 361, 215, 49, -160, -520, -1020, -1329, -1313, -1335, -1607, -1847, -1870, -1858, -1871, -1770, -1580, -1415, -1178, -866, -787, -1049, -1241, -1009, -538, -209, -151, -301, -537, -706, -727, -634, -416, -14, 408, 510, 212, -110, -107, 88, 43, -400, -959, -1310, -1401, -1328, -1149, -930, -772, -695, -625, -475, -190, 161, 306, 7, -533, -826, -698, -442, -333, -307, -144, 245, 782, 1261, 1436, 1243, 889, 569, 128, -637, -1427, -1657, -1377, -1347, -1882, -2290, -1907, -1164, -932, -1190, -1232, -1022, -1325, -2240, -2788, -2400, -1781, -1664, -1738, -1404, -707, 55, 882, 1740, 2360, 2695, 3053, 3566, 3913, 3782, 3285, 2634, 1722, 437, -899, -1848, -2426, -2945, -3521, -4102, -4710, -5324, -5862, -6481, -7527, -9103, -10978, -12884, -14560, -15752, -16415, -16695, -16603, -16103, -15393, -14599, -13499, -12096, -10912, -10091, -9064, -7655, -6441, -5575, -4439, -2840, -1175, 664, 3185, 6145, 8798, 10987, 13035, 14927, 16457, 17726, 18825, 19604, 19996, 20128, 20029, 19696, 19374, 19341, 19533, 19669, 19511, 18909, 17815, 16413, 14974, 13534, 11924, 10104, 8212, 6343, 4478, 2698, 1260, 332, -245, -835, -1606, -2405, -3003, -3362, -3632, -3930, -4259, -4552, -4690, -4571, -4254, -3934, -3637, -3154, -2404, -1552, -669, 386, 1576, 2601, 3291, 3739, 4019, 4180, 4419, 4899, 5433, 5713, 5722, 5677, 5703, 5792, 5957, 6230, 6512, 6596, 6362, 5874, 5274, 4696, 4240, 3895, 3483, 2905, 2323, 1923, 1659, 1449, 1365, 1379, 1310, 1165, 1112, 1074, 794, 358, 53, -161, -520, -932, -1133, -1148, -1189, -1272, -1277, -1241, -1283, -1393, -1478, -1548, -1727, -2107, -2638, -3168, -3608, -3965, -4227, -4332, -4344, -4431, -4558, -4463, -4110, -3843, -3883, -4002, -3900, -3616, -3354, -3150, -2941, -2741, -2572, -2337, -1940, -1448, -973, -489, 50, 505, 731, 881, 1240, 1788, 2197, 2238, 1956, 1474, 888, 324, -91, -388, -746, -1232, -1694, -2002, -2261, -2681, -3276, -3903, -4552, -5400, -6450, -7409, -8047, -8517, -9079, -9712, -10184, -10394, -10399, -10253, -9986, -9649, -9290, -8934, -8638, -8479, -8418, -8285, -7973, -7551, -7102, -6567, -5862, -5057, -4238, -3395, -2590, -2055, -1837, -1636, -1225, -789, -607, -670, -797, -922, -1046, -1106, -1080, -1108, -1325, -1654, -1928, -2178, -2594, -3177, -3651, -3852, -4004, -4401, -4954, -5393, -5766, -6315, -6927, -7224, -7167, -7065, -7032, -6937, -6808, -6770, -6706, -6411, -6007, -5775, -5764, -5807, -5840, -5895, -5883, -5620, -5090, -4531, -4178, -3959, -3620, -3136, -2791, -2763, -2860, -2844, -2765, -2725, -2650, -2511, -2480, -2608, -2645, -2393, -2013, -1745, -1588, -1452, -1405, -1523, -1653, -1588, -1416, -1371, -1423, -1375, -1247, -1210, -1185, -926, -464, -92, 43, 65, 82, 83, 102, 230, 417, 489, 408, 306, 205, -4, -237, -223, 7, 65, -224, -581, -733, -791, -941, -1108, -1152, -1170, -1353, -1660, -1881, -1982, -2116, -2315, -2381, -2214, -1980, -1841, -1676, -1314, -883, -684, -765, -907, -911, -678, -183, 358, 591, 543, 646, 1057, 1456, 1656, 1809, 1960, 2004, 2063, 2326, 2633, 2722, 2648, 2561, 2404, 2180, 2132, 2406, 2838, 3171, 3227, 2975, 2645, 2527, 2560, 2442, 2169, 1967, 1822, 1667, 1770, 2303, 2830, 2907, 2795, 2949, 3167, 2872, 1998, 1002, 233, -257, -387, -17, 640, 1008, 742, 142, -264, -352, -362, -402, -418, -581, -1196, -2111, -2701, -2621, -2155, -1669, -1182, -629, -77, 499, 1239, 1981, 2261, 1998, 1796, 2192, 2904, 3288, 3285, 3343, 3651, 4141, 4924, 6048, 7038, 7384, 7239, 7079, 6981, 6754, 6508, 6519, 6674, 6504, 5831, 5049, 4639, 4645, 4791, 4919, 5051, 5113, 4908, 4423, 3906, 3551, 3317, 3124, 3007, 2945, 2776, 2437, 2129, 2084, 2308, 2640, 2942, 3167, 3310, 3332, 3125, 2636, 2041, 1704, 1824, 2194, 2442, 2431, 2289, 2066, 1689, 1295, 1253, 1685, 2272, 2645, 2737, 2641, 2376, 1970, 1599, 1400, 1290, 1176, 1184, 1396, 1535, 1343, 1031, 920, 925, 838, 779, 852, 792, 419, 33, -43, 119, 331, 554, 739, 783, 668, 438, 168, 32, 156, 355, 373, 296, 320, 327, 152, -7, 62, 143, -67, -447, -688, -820, -1060, -1321, -1278, -908, -581, -533, -604, -614, -588, -546, -440, -374, -450, -541, -611, -888, -1300, -1353, -929, -457, -47, 573, 1154, 1098, 567, 273, 256, -55, -652, -860, -486, -142, -266, -549, -594, -561, -740, -926, -736, -351, -333, -775, -1182, -1322, -1529, -1954, -2115, -1675, -1087, -904, -969, -870, -661, -556, -416, -48, 388, 661, 785, 849, 849, 818, 876, 1023, 1116, 1189, 1474, 1942, 2195, 2158, 2323, 2879, 3258, 3097, 2850, 2853, 2691, 2066, 1404, 1097, 954, 760, 635, 585, 343, -120, -417, -252, 181, 413, 175, -425, -1150, -1917, -2667, -3111, -2954, -2353, -1750, -1305, -910, -666, -755, -991, -1021, -859, -684, -436, -50, 218, 179, 87, 240, 532, 748, 987, 1438, 1952, 2169, 2033, 1832, 1738, 1597, 1306, 1132, 1321, 1590, 1422, 827, 311, 86, -113, -366, -389, -162, -56, -162, -155, 69, 229, 226, 353, 750, 1092, 951, 306, -447, -885, -901, -650, -208, 467, 1262, 1853, 2056, 1983, 1811, 1642, 1528, 1332, 749, -164, -817, -784, -340, 86, 504, 1059, 1635, 2107, 2552, 2944, 3042, 2761, 2365, 2190, 2340, 2618, 2684, 2432, 2147, 2114, 2263, 2443, 2728, 3068, 3167, 2992, 2802, 2440, 1426, -95, -1420, -2323, -3117, -3886, -4551, -5314, -6267, -7044, -7472, -7813, -8069, -7981, -7833, -8255, -9172, -9911, -10231, -10401, -10447, -10158, -9602, -9045, -8490, -7677, -6505, -5166, -3923, -2842, -1779, -640, 457, 1409, 2322, 3297, 4210, 4974, 5776, 6736, 7642, 8339, 9055, 9940, 10691, 11017, 11192, 11637, 12176, 12261, 11840, 11444, 11297, 11005, 10332, 9629, 9198, 8814, 8232, 7581, 7014, 6442, 5776, 5051, 4312, 3611, 2991, 2347, 1536, 679, -21, -651, -1387, -2049, -2327, -2323, -2390, -2582, -2643, -2493, -2326, -2260, -2176, -2005, -1892, -1947, -2002, -1838, -1483, -1115, -775, -369, 138, 677, 1170, 1587, 1942, 2272, 2568, 2784, 2903, 2940, 2896, 2777, 2663, 2615, 2611, 2648, 2809, 3090, 3278, 3164, 2786, 2352, 1959, 1542, 1061, 585, 146, -286, -688, -974, -1160, -1310, -1357, -1211, -1051, -1212, -1727, -2291, -2711, -3095, -3499, -3700, -3574, -3431, -3587, -3839, -3773, -3402, -2990, -2582, -2156, -1998, -2331, -2871, -3186, -3248, -3235, -3056, -2511, -1767, -1215, -908, -559, -128, 104, 108, 205, 464, 558, 368, 188, 211, 299, 386, 657, 1206, 1788, 2069, 1930, 1443, 742, 90, -208, -164, -149, -399, -794, -1247, -1841, -2452, -2802, -2968, -3285, -3762, -4168, -4563, -5155, -5791, -6119, -6117, -6042, -6067, -6213, -6524, -7013, -7516, -7793, -7736, -7456, -7139, -6871, -6609, -6320, -6026, -5690, -5210, -4626, -4179, -4028, -4081, -4152, -4110, -3828, -3223, -2445, -1771, -1273, -820, -392, -125, -41, -32, -88, -347, -811, -1237, -1412, -1399, -1335, -1186, -915, -683, -661, -863, -1283, -1882, -2445, -2822, -3205, -3644, -3766, -3513, -3515, -4070, -4599, -4679, -4651, -4743, -4694, -4555, -4763, -5246, -5463, -5332, -5214, -5147, -4915, -4650, -4651, -4805, -4743, -4487, -4408, -4512, -4366, -3834, -3347, -3197, -3098, -2784, -2426, -2193, -1928, -1541, -1233, -1178, -1344, -1595, -1683, -1365, -702, -41, 417, 719, 863, 799, 621, 449, 278, 164, 251, 416, 324, -50, -362, -417, -267, 61, 501, 788, 781, 650, 488, 156, -301, -610, -727, -857, -999, -963, -801, -751, -835, -863, -780, -725, -790, -973, -1311, -1830, -2335, -2536, -2434, -2335, -2403, -2532, -2675, -2843, -2815, -2377, -1761, -1361, -1174, -1016, -918, -921, -864, -705, -593, -460, -22, 657, 1173, 1387, 1602, 2009, 2451, 2868, 3519, 4423, 5029, 4905, 4391, 4035, 3785, 3355, 2980, 3077, 3481, 3669, 3559, 3494, 3545, 3419, 3058, 2794, 2765, 2675, 2362, 2045, 1828, 1437, 752, 57, -413, -696, -775, -535, -151, -63, -414, -830, -930, -750, -508, -228, 126, 371, 285, -59, -429, -683, -684, -279, 420, 1027, 1363, 1674, 2197, 2775, 3117, 3220, 3281, 3315, 3149, 2769, 2464, 2487, 2721, 2907, 3069, 3408, 3816, 4005, 4057, 4325, 4741, 4848, 4559, 4218, 3897, 3331, 2560, 2038, 2008, 2296, 2678, 3076, 3392, 3493, 3386, 3253, 3223, 3190, 2931, 2420, 1921, 1682, 1641, 1628, 1674, 1858, 2062, 2148, 2237, 2488, 2750, 2746, 2480, 2180, 1906, 1535, 1083, 781, 706, 679, 578, 472, 328, 33, -213, -92, 274, 515, 646, 862, 924, 544, 97, 167, 675, 1159, 1597, 2259, 2989, 3336, 3317, 3450, 3930, 4383, 4592, 4880, 5436, 5821, 5609, 5084, 4793, 4723, 4496, 4191, 4210, 4383, 4057, 3181, 2446, 2173, 1927, 1488, 1246, 1334, 1254, 676, -66, -570, -871, -1144, -1314, -1261, -1145, -1266, -1640, -1960, -1955, -1638, -1145, -586, -125, 20, -144, -285, -117, 222, 391, 317, 221, 233, 281, 336, 518, 907, 1385, 1736, 1875, 1901, 1950, 2049, 2142, 2249, 2488, 2897, 3223, 3124, 2627, 2192, 2140, 2301, 2472, 2765, 3197, 3391, 3125, 2689, 2355, 1967, 1378, 859, 706, 760, 632, 196, -332, -728, -988, -1199, -1329, -1303, -1259, -1499, -2071, -2660, -2979, -3095, -3206, -3287, -3190, -2990, -2927, -2972, -2844, -2551, -2454, -2608, -2571, -2154, -1732, -1523, -1230, -676, -131, 192, 405, 598, 789, 1111, 1594, 1924, 1836, 1521, 1306, 1202, 1076, 1043, 1378, 2099, 2810, 3048, 2764, 2336, 2055, 1758, 1177, 415, -250, -735, -1010, -929, -506, -44, 288, 562, 640, 203, -623, -1249, -1406, -1435, -1640, -1830, -1781, -1675, -1744, -1797, -1581, -1292, -1196, -1057, -583, -92, -62, -367, -574, -531, -250, 282, 837, 993, 691, 237, -176, -479, -475, -92, 406, 797, 1101, 1269, 1101, 610, 31, -516, -994, -1287, -1417, -1613, -1957, -2348, -2813, -3345, -3561, -3182, -2594, -2343, -2403, -2522, -2795, -3268, -3590, -3571, -3572, -3887, -4204, -4076, -3550, -3008, -2601, -2171, -1654, -1278, -1259, -1479, -1636, -1617, -1558, -1563, -1518, -1247, -823, -560, -603, -676, -436, 47, 453, 684, 893, 1126, 1286, 1343, 1353, 1335, 1337, 1411, 1445, 1226, 761, 344, 222, 369, 563, 603, 545, 653, 921, 926, 475, 14, -121, -351, -1084, -1866, -2035, -1727, -1537, -1560, -1442, -1093, -812, -804, -955, -1079, -1130, -1137, -1106, -1062, -1040, -1010, -973, -1051, -1292, -1453, -1267, -809, -343, 10, 260, 421, 519, 525, 329, 27, -3, 342, 602, 426, 131, 159, 428, 622, 716, 859, 1081, 1308, 1465, 1484, 1414, 1394, 1414, 1265, 909, 574, 428, 393, 340, 266, 243, 373, 679, 955, 929, 642, 428, 456, 563, 577, 515, 405, 179, -133, -318, -206, 117, 475, 808, 1057, 1064, 800, 488, 267, 40, -133, 80, 735, 1310, 1345, 1023, 775, 646, 450, 307, 505, 915, 1049, 752, 349, 44, -286, -611, -616, -272, -6, -95, -289, -253, -102, -180, -516, -773, -743, -585, -482, -317, 58, 417, 329, -270, -966, -1365, -1433, -1313, -1093, -867, -775, -860, -1016, -1117, -1137, -1170, -1342, -1594, -1694, -1598, -1560, -1669, -1607, -1210, -839, -820, -915, -777, -494, -319, -220, -51, 108, 66, -168, -311, -52, 533, 975, 1008, 943, 1048, 1035, 702, 483, 702, 914, 704, 386, 256, 0, -600, -1152, -1351, -1445, -1642, -1750, -1636, -1536, -1731, -2202, -2682, -2952, -3036, -3088, -3103, -2904, -2533, -2326, -2432, -2631, -2740, -2833, -2924, -2800, -2389, -1931, -1653, -1530, -1538, -1826, -2405, -2888, -2908, -2616, -2407, -2327, -2178, -2013, -1994, -1994, -1849, -1701, -1710, -1794, -1929, -2247, -2613, -2637, -2279, -1907, -1679, -1357, -872, -563, -674, -943, -954, -695, -487, -502, -612, -698, -824, -1069, -1355, -1540, -1536, -1335, -1065, -1060, -1574, -2319, -2653, -2438, -2187, -2189, -2140, -1867, -1717, -1874, -2057, -2104, -2149, -2147, -1881, -1486, -1318, -1384, -1365, -1080, -559, 177, 1068, 1887, 2338, 2358, 2226, 2337, 2725, 2988, 2908, 2893, 3412, 4217, 4653, 4601, 4537, 4702, 4810, 4667, 4550, 4650, 4609, 4028, 3102, 2298, 1736, 1385, 1331, 1346, 825, -275, -1127, -1179, -861, -775, -966, -1361, -2110, -3102, -3769, -3791, -3538, -3451, -3371, -2930, -2290, -1927, -1869, -1712, -1320, -929, -571, 25, 841, 1426, 1577, 1687, 2095, 2559, 2769, 2919, 3263, 3567, 3578, 3624, 4104, 4712, 4817, 4409, 4074, 4101, 4196, 4101, 3936, 3764, 3368, 2717, 2118, 1667, 1098, 402, -3, 80, 322, 399, 387, 424, 382, 79, -362, -601, -535, -524, -932, -1496, -1599, -1179, -773, -578, -194, 544, 1286, 1802, 2187, 2363, 2168, 1828, 1683, 1649, 1568, 1701, 2307, 3039, 3370, 3357, 3457, 3746, 3895, 3864, 3994, 4283, 4331, 4149, 4254, 4720, 4909, 4467, 3860, 3614, 3602, 3470, 3203, 2949, 2612, 2055, 1477, 1182, 1092, 854, 406, -11, -366, -912, -1676, -2297, -2601, -2935, -3564, -4145, -4203, -3813, -3340, -2862, -2386, -2227, -2593, -3048, -2996, -2515, -2227, -2396, -2613, -2372, -1682, -929, -351, 156, 728, 1298, 1734, 2029, 2205, 2224, 2114, 2026, 2040, 2074, 2114, 2259, 2487, 2634, 2696, 2794, 2860, 2671, 2237, 1791, 1489, 1327, 1218, 1024, 690, 383, 251, 108, -272, -762, -1167, -1620, -2275, -2866, -3012, -2740, -2433, -2411, -2737, -3232, -3636, -3881, -4189, -4702, -5181, -5255, -4869, -4277, -3717, -3213, -2715, -2251, -1910, -1699, -1494, -1207, -930, -812, -828, -823, -683, -348, 226, 936, 1470, 1639, 1613, 1646, 1715, 1593, 1159, 494, -216, -740, -897, -740, -557, -594, -801, -886, -699, -533, -867, -1712, -2542, -3060, -3548, -4159, -4518, -4399, -4113, -3900, -3659, -3439, -3388, -3250, -2765, -2350, -2496, -2840, -2733, -2240, -1876, -1774, -1749, -1712, -1583, -1171, -480, 185, 595, 896, 1328, 1854, 2265, 2541, 2797, 3009, 3076, 3059, 3044, 2907, 2539, 2133, 1910, 1788, 1626, 1597, 1990, 2696, 3203, 3119, 2594, 2118, 1928, 1755, 1264, 511, -305, -1207, -2112, -2547, -2247, -1636, -1208, -934, -724, -750, -938, -921, -747, -846, -1247, -1654, -2059, -2466, -2518, -2101, -1724, -1671, -1530, -966, -211, 479, 1096, 1524, 1597, 1553, 1824, 2420, 2904, 2926, 2537, 2110, 2089, 2660, 3586, 4433, 4873, 4806, 4387, 3983, 3808, 3701, 3514, 3432, 3493, 3225, 2353, 1401, 953, 847, 697, 611, 849, 1236, 1440, 1414, 1298, 1156, 977, 721, 347, -69, -380, -596, -886, -1276, -1559, -1536, -1146, -512, 60, 371, 604, 913, 929, 375, -169, -23, 401, 203, -564, -1043, -878, -425, 94, 803, 1645, 2347, 2893, 3476, 3969, 4014, 3706, 3536, 3519, 3171, 2517, 2272, 2699, 3157, 3146, 2970, 3069, 3339, 3474, 3458, 3373, 3097, 2553, 2005, 1744, 1646, 1397, 997, 669, 412, 39, -403, -702, -844, -1024, -1291, -1482, -1488, -1412, -1455, -1638, -1800, -1918, -2220, -2674, -2740, -2125, -1393, -1190, -1302, -1211, -1020, -1014, -890, -257, 540, 896, 898, 1081, 1471, 1624, 1515, 1590, 1833, 1758, 1426, 1427, 1661, 1430, 810, 537, 620, 490, 230, 269, 361, 65, -439, -866, -1232, -1350, -1024, -766, -1102, -1540, -1387, -958, -830, -835, -702, -680, -839, -804, -561, -520, -681, -688, -561, -542, -513, -252, 90, 247, 277, 401, 701, 1127, 1558, 1748, 1518, 1101, 1008, 1367, 1708, 1708, 1743, 2188, 2647, 2568, 2191, 2110, 2278, 2179, 1767, 1507, 1615, 1802, 1777, 1593, 1456, 1411, 1367, 1301, 1250, 1119, 745, 225, -81, -40, 18, -242, -670, -831, -687, -663, -932, -1058, -762, -505, -743, -1141, -1262, -1388, -1852, -2284, -2337, -2287, -2302, -2064, -1595, -1344, -1300, -1055, -705, -663, -878, -1084, -1324, -1543, -1393, -944, -800, -1137, -1410, -1237, -888, -724, -736, -766, -805, -962, -1244, -1442, -1298, -888, -578, -516, -523, -582, -874, -1233, -1254, -1042, -1101, -1402, -1350, -754, -128, 90, -30, -317, -746, -1218, -1511, -1697, -2127, -2755, -2996, -2620, -2207, -2242, -2419, -2361, -2279, -2383, -2399, -2136, -1939, -2149, -2634, -3069, -3297, -3220, -2766, -2130, -1694, -1507, -1215, -753, -563, -761, -750, -204, 280, 192, 38, 456, 1013, 837, 9, -590, -687, -859, -1354, -1664, -1552, -1488, -1680, -1737, -1570, -1622, -1878, -1713, -1082, -831, -1417, -2196, -2495, -2624, -3092, -3494, -3169, -2396, -1825, -1321, -560, -30, -241, -769, -1135, -1534, -1994, -2043, -1719, -1541, -1518, -1394, -1439, -1749, -1684, -1042, -553, -468, -136, 515, 753, 467, 266, 244, 51, -245, -447, -663, -722, -154, 797, 1261, 1042, 752, 723, 823, 973, 1004, 533, -348, -980, -1069, -1000, -1011, -893, -610, -501, -812, -1503, -2357, -2989, -3056, -2712, -2491, -2638, -2923, -3104, -3205, -3282, -3338, -3459, -3773, -4183, -4317, -3839, -2840, -1851, -1379, -1422, -1570, -1533, -1340, -1043, -574, 22, 503, 709, 712, 611, 428, 245, 211, 316, 354, 225, 87, 105, 172, 126, 44, 77, 105, -107, -493, -735, -713, -630, -636, -544, -33, 926, 1963, 2593, 2581, 2063, 1387, 793, 256, -301, -740, -773, -288, 522, 1288, 1595, 1187, 237, -747, -1424, -1788, -1894, -1727, -1409, -1194, -1193, -1316, -1426, -1417, -1274, -1148, -1137, -998, -444, 332, 830, 873, 713, 580, 500, 483, 560, 632, 609, 647, 972, 1394, 1419, 995, 743, 1156, 1908, 2298, 2117, 1667, 1226, 804, 358, 9, 14, 525, 1349, 2051, 2385, 2512, 2681, 2825, 2658, 2113, 1506, 1182, 1180, 1295, 1310, 1083, 580, -19, -358, -178, 442, 1239, 2041, 2671, 2753, 2120, 1299, 971, 976, 611, -133, -487, -100, 464, 688, 745, 889, 947, 867, 1188, 2195, 3153, 3214, 2666, 2316, 2169, 1784, 1378, 1433, 1696, 1576, 1093, 715, 723, 1154, 1869, 2513, 2806, 2832, 2715, 2388, 1939, 1602, 1203, 321, -892, -1763, -1944, -1587, -871, 44, 950, 1824, 2659, 2955, 2177, 728, -442, -1017, -1200, -839, 322, 1848, 2970, 3503, 3676, 3406, 2501, 1401, 893, 1043, 1213, 1242, 1685, 2572, 3039, 2619, 1876, 1302, 672, -96, -468, -61, 829, 1679, 2155, 2172, 1913, 1653, 1485, 1447, 1672, 2009, 1894, 1177, 571, 680, 1129, 1224, 946, 719, 721, 810, 764, 461, 57, -131, -132, -372, -1031, -1873, -2712, -3455, -3731, -3217, -2264, -1499, -1024, -583, -242, -252, -505, -676, -706, -725, -599, -39, 845, 1559, 1883, 2037, 2074, 1740, 1060, 408, -102, -604, -1011, -1256, -1544, -1720, -1229, -279, 127, -278, -882, -1684, -3237, -5093, -6103, -6069, -5627, -4951, -3937, -3069, -2853, -2994, -2981, -2800, -2543, -1946, -890, 139, 599, 595, 702, 1151, 1590, 1726, 1833, 2391, 3439, 4492, 4928, 4353, 2735, 445, -1763, -2930, -2489, -972, 265, 417, 36, 22, 351, 362, -125, -691, -1029, -1241, -1552, -2013, -2426, -2460, -2004, -1305, -593, 306, 1657, 3150, 3885, 3189, 1327, -684, -1900, -2049, -1442, -553, 215, 600, 596, 470, 415, 298, 0, -255, -277, -336, -806, -1755, -3048, -4339, -4914, -4326, -3184, -2379, -1697, -272, 1652, 2631, 1921, 454, -527, -932, -1216, -1144, -191, 1407, 3028, 4376, 4956, 3860, 1224, -1225, -2070, -1554, -398, 1237, 2952, 3741, 3307, 2652, 2631, 2744, 2018, 508, -848, -1493, -1571, -1276, -753, -418, -465, -319, 540, 1510, 1470, 188, -1468, -2433, -2119, -621, 1348, 2879, 3401, 2843, 1580, 230, -882, -2012, -3209, -3625, -2481, -403, 1189, 1630, 1144, 124, -944, -1537, -1643, -1559, -1075, 76, 1293, 1851, 2102, 2608, 2837, 2098, 1132, 1338, 2849, 4471, 5256, 5279, 4996, 4488, 3531, 2117, 649, -370, -622, 117, 1826, 3724, 4621, 4291, 3646, 3087, 1891, -23, -1207, -611, 843, 1740, 2077, 2652, 3388, 3358, 2117, 327, -925, -1094, -494, 62, 43, -161, 366, 1683, 2659, 2541, 1817, 900, -572, -2438, -3612, -3634, -2959, -1567, 792, 3057, 3593, 2501, 1290, 508, -548, -1811, -2086, -1177, -566, -966, -860, 990, 3150, 3435, 1809, -271, -1885, -2649, -2357, -1633, -1373, -1309, -795, -487, -1280, -2447, -2712, -2258, -2083, -2363, -2663, -2792, -2426, -811, 2062, 4601, 5040, 3526, 1810, 906, 186, -988, -2005, -1848, -347, 1813, 3596, 4005, 2780, 746, -973, -1949, -2451, -2927, -3447, -3315, -1826, 247, 1220, 944, 770, 821, -1, -1221, -1236, -411, -235, -118, 1310, 2890, 2549, 837, -350, -848, -1357, -1353, -59, 1916, 3260, 3196, 1798, 49, -703, -122, 940, 1848, 2512, 2469, 1294, -396, -1876, -3332, -4621, -4604, -3104, -1478, -283, 1087, 2037, 1043, -1526, -3867, -5539, -6960, -7120, -4759, -857, 2378, 4071, 4555, 3948, 2210, -140, -2386, -4123, -4885, -3931, -1318, 1365, 2537, 2560, 2802, 3172, 2371, 229, -1874, -2594, -1511, 746, 2435, 2100, 640, 340, 1449, 1758, 38, -2074, -2471, -1216, 232, 1320, 2706, 4635, 6158, 6241, 4894, 2828, 642, -1175, -1993, -1525, -405, 327, 394, 492, 1078, 1390, 344, -1724, -3169, -3120, -2553, -2766, -3575, -3742, -2659, -908, 446, 624, -497, -2220, -3297, -2683, -332, 2543, 4279, 4269, 3402, 2490, 1030, -1562, -4304, -5484, -4475, -1916, 940, 2418, 1398, -1238, -3411, -4161, -3908, -2982, -1571, -513, -416, -611, -272, 211, 73, -409, -388, 263, 1061, 1862, 2662, 2731, 1229, -1141, -2432, -1727, 3, 1484, 2300, 2553, 2608, 3101, 4039, 4171, 2303, -998, -3828, -4820, -4064, -2591, -1501, -1273, -1360, -629, 1152, 2446, 1386, -1785, -4628, -5169, -3799, -2050, -406, 1598, 3655, 4497, 3604, 1913, 530, -233, -279, 664, 2443, 4316, 5638, 6077, 5353, 3450, 859, -1720, -3590, -3912, -2202, 661, 2678, 2634, 1357, 488, 343, -191, -1815, -3787, -4840, -4209, -1931, 961, 2746, 2521, 1046, -552, -2103, -3711, -4867, -5074, -4476, -3259, -1332, 867, 2194, 2019, 977, -84, -1317, -3227, -5166, -5515, -3607, -625, 1782, 3069, 3494, 2949, 987, -2081, -4809, -5671, -4306, -1584, 1313, 3446, 4067, 2882, 598, -1536, -2939, -3806, -4050, -3268, -1679, 99, 2015, 4030, 4906, 3150, -780, -4391, -5430, -3658, -600, 1890, 2970, 3094, 2969, 2477, 969, -1621, -4386, -6004, -5543, -3078, 265, 3068, 4358, 3585, 672, -3250, -5997, -6143, -4198, -1544, 876, 2514, 3088, 2814, 1928, 289, -1631, -2327, -1042, 1030, 2330, 2466, 1548, -321, -2258, -2926, -2115, -762, 529, 1774, 2820, 3286, 2835, 1123, -1617, -3874, -3998, -2261, -665, -676, -2004, -3351, -3579, -2449, -872, -149, -559, -1053, -644, 293, 556, -270, -1251, -1148, 362, 2586, 4412, 4954, 4063, 2316, 342, -1511, -2627, -2118, -45, 2088, 2722, 1620, -416, -2444, -3586, -3133, -1211, 958, 2095, 1974, 1021, -627, -2697, -4086, -4029, -3322, -2915, -2374, -1327, -914, -1801, -2348, -947, 1229, 1970, 1353, 1187, 1847, 1844, 603, -222, 867, 2805, 3322, 2106, 1118, 1776, 2991, 2542, 13, -2301, -1921, 764, 2861, 2330, -128, -2480, -3283, -2137, 313, 2399, 2673, 1557, 814, 1107, 1165, -3, -1227, -779, 906, 1631, 156, -2773, -5514, -6278, -3607, 2041, 7522, 9172, 5846, -395, -5989, -8218, -6860, -3794, -813, 1667, 3438, 3307, 432, -3772, -6403, -5829, -2814, 982, 4320, 5974, 4697, 739, -3531, -5727, -5572, -4227, -2260, 482, 3388, 5122, 5287, 4568, 3080, 522, -1827, -1748, 726, 3113, 3734, 2750, 454, -2569, -4154, -2469, 1039, 2995, 1970, -490, -1874, -868, 1606, 3307, 3198, 2224, 1067, -739, -2701, -3143, -1971, -870, -294, 721, 1811, 1584, 424, -69, -36, -1027, -3085, -4443, -3936, -1980, 589, 3120, 4546, 3939, 2070, 951, 1173, 1260, 327, -420, 182, 1268, 1331, 397, -479, -896, -822, 482, 3159, 5092, 4287, 2226, 1634, 2015, 1159, -578, -1455, -1494, -1016, 664, 2410, 1727, -288, 11, 2148, 2049, -864, -3300, -3832, -3425, -1889, 1204, 3914, 4069, 2338, 631, -601, -1779, -2621, -2628, -2126, -1811, -1720, -1230, 50, 1751, 2988, 2878, 1098, -1492, -3066, -2500, -758, 332, 622, 1674, 3944, 5418, 4093, 765, -1999, -3221, -4112, -5104, -4354, -853, 2867, 3753, 2219, 190, -2262, -4756, -4536, -1043, 1341, -268, -2397, -1123, 1751, 2469, 917, -915, -2310, -2970, -1792, 1389, 4729, 6324, 6014, 4508, 1923, -1675, -4847, -5511, -3471, -987, -146, -476, 13, 1974, 3830, 3679, 1341, -1600, -3293, -3169, -2304, -1914, -1526, 156, 2681, 4147, 4009, 3146, 1670, -476, -1851, -1573, -1254, -2001, -2166, -758, 393, 252, 376, 1266, 1086, -471, -969, 885, 3270, 3987, 2926, 1337, 248, -15, 243, 398, 310, 764, 2162, 2986, 1404, -1570, -3016, -2438, -2100, -2656, -2046, 496, 2747, 2816, 1404, -26, -1123, -1950, -2209, -1944, -1814, -1881, -1161, 775, 2750, 3498, 3142, 2091, -58, -3208, -5792, -6402, -5233, -3087, -297, 2576, 4272, 3930, 2128, 292, -603, -537, -70, 117, -365, -1262, -1899, -2016, -1786, -817, 1616, 4753, 6224, 4667, 1297, -1624, -2748, -1909, 238, 2630, 4522, 5477, 4536, 822, -4359, -7600, -6854, -3794, -1394, -109, 1718, 4131, 4806, 2556, -797, -2902, -3011, -1168, 2220, 5407, 6314, 4987, 3245, 2151, 1459, 799, -12, -1010, -1541, -702, 1257, 2967, 3252, 1621, -1699, -5156, -6258, -3878, 478, 4460, 7120, 8556, 8291, 5517, 748, -4108, -7504, -8844, -7524, -3296, 2100, 5626, 5896, 4012, 1401, -1412, -3868, -5070, -4981, -4483, -3634, -1267, 2680, 5656, 4869, 713, -3528, -5039, -3537, -728, 1316, 1879, 2195, 3522, 4793, 3864, 1060, -652, 183, 1375, 636, -545, 710, 3555, 4122, 1166, -2287, -3202, -1514, 1154, 3134, 3208, 1587, 79, -169, -180, -1124, -2081, -1307, 980, 2641, 2338, 1195, 1323, 3399, 6015, 6933, 4818, 477, -3499, -5013, -4365, -3337, -2850, -2306, -771, 1917, 4639, 5198, 1932, -4289, -10178, -12426, -9962, -4310, 1643, 5655, 7519, 8341, 8312, 6014, 808, -4724, -6355, -2719, 2885, 5986, 5195, 2360, -230, -1554, -1629, -932, -51, 621, 999, 1199, 1544, 2382, 3537, 4169, 3536, 1854, 126, -819, -888, -421, 211, 737, 1232, 2074, 2885, 2060, -1262, -5207, -6784, -5308, -2533, 316, 3482, 6242, 6238, 2989, -173, -377, 585, -366, -2056, -1166, 1745, 3011, 1588, -220, -925, -956, -305, 1678, 4301, 5630, 4796, 2714, 441, -1914, -4097, -4646, -2171, 2502, 6610, 7989, 6502, 2914, -2169, -7253, -9273, -5992, 939, 6630, 7020, 2422, -2493, -3239, -790, 14, -1826, -2154, 218, 852, -1859, -3256, -896, 1316, 650, -344, 214, 449, -665, -1594, -2167, -3938, -5777, -3777, 2682, 8205, 7189, 527, -5880, -7877, -5752, -1654, 2575, 5519, 6540, 5989, 4251, 1312, -2480, -6239, -8951, -9139, -5163, 2442, 9654, 12076, 9442, 4862, -344, -7408, -14476, -15151, -6448, 5503, 12146, 12010, 9615, 7595, 4755, 613, -3165, -5976, -8352, -8346, -3204, 4266, 7440, 5530, 4170, 4897, 2642, -4313, -10522, -11632, -8931, -4324, 2120, 8319, 9969, 6121, 818, -2484, -4790, -7970, -10380, -9187, -5017, -911, 1957, 4317, 5856, 5250, 2464, -1172, -4456, -6491, -6263, -3413, 893, 4722, 6732, 6246, 2835, -2689, -7330, -8025, -4898, -853, 1843, 2984, 2962, 1840, -328, -3216, -5806, -6421, -4534, -1998, -702, -3, 1576, 3621, 4580, 3653, 643, -3835, -7150, -6225, -1299, 4133, 7555, 9058, 8287, 3241, -5496, -12242, -11832, -6126, -860, 2110, 4641, 6665, 6366, 4258, 1926, -1299, -5936, -9035, -7346, -1825, 3823, 7116, 7430, 4921, 966, -1778, -1744, -307, 281, 43, 402, 1049, 340, -1505, -2400, -1508, -21, 997, 1356, 688, -1223, -2993, -2572, -106, 1931, 2054, 1119, -362, -3410, -7522, -9462, -7248, -2861, 833, 3346, 5150, 5545, 3714, 353, -3076, -5806, -7639, -7962, -5848, -1324, 3875, 7270, 7462, 5139, 2290, 212, -1446, -3100, -3620, -2019, 20, -116, -1844, -1796, 1258, 4453, 4605, 1920, -1142, -3015, -3614, -3007, -1339, 445, 1504, 2290, 3402, 4078, 3377, 1770, 80, -1710, -3330, -3550, -1823, 904, 3384, 4813, 4854, 4042, 3069, 1247, -2039, -4527, -3268, 364, 1975, 664, -32, 1960, 4387, 4463, 2446, 402, -550, -809, -1205, -2154, -3482, -4522, -4442, -2904, -571, 1243, 1565, 486, -965, -1694, -1559, -1551, -2515, -3548, -2447, 1403, 5346, 6033, 3284, -206, -2433, -3265, -2661, -483, 1751, 1627, -879, -2912, -2471, -838, -206, -667, -1171, -1808, -2778, -2400, 899, 5169, 6527, 4138, 986, -398, -650, -1603, -3282, -3746, -1854, 774, 1994, 2420, 3252, 2348, -2072, -5636, -3371, 1195, 1429, -1299, -1676, -801, -2163, -3093, -114, 3379, 3013, 416, -1424, -2846, -3791, -2242, 1429, 4103, 4540, 3977, 2803, 519, -1807, -2507, -2287, -3080, -3901, -1500, 3772, 6815, 4690, 712, -1003, -1000, -1627, -2566, -2236, -742, 969, 2744, 4352, 4628, 2824, -235, -3263, -5941, -8126, -8252, -4380, 2627, 8388, 8667, 3468, -3030, -6477, -6122, -4624, -4340, -4500, -2682, 1540, 5624, 6663, 4074, -409, -4573, -7112, -7588, -5789, -1907, 2546, 4953, 3664, -288, -4087, -5598, -4712, -2719, -875, 611, 2439, 4792, 6065, 3838, -2081, -8177, -9949, -6308, -388, 4230, 6988, 9228, 10708, 9228, 4082, -2008, -5489, -5294, -2726, 508, 3064, 4108, 3812, 2907, 1656, 130, -1109, -1838, -2762, -3860, -3424, -363, 3591, 5697, 5428, 4303, 3102, 944, -2620, -6118, -7534, -6358, -3391, 738, 5543, 9384, 9831, 6147, 493, -4110, -6267, -6195, -4607, -2284, 347, 3527, 6731, 7635, 4599, -508, -4265, -5584, -5474, -4227, -1523, 1582, 3285, 3392, 3165, 2922, 1630, -874, -3164, -4248, -4281, -2763, 1152, 5847, 7869, 6163, 2724, -857, -4042, -5195, -2721, 1941, 5454, 6172, 4713, 2395, 371, -1105, -2956, -5330, -6210, -3903, 222, 3342, 4115, 2557, -1054, -5220, -6861, -4149, 909, 4239, 3841, 1169, -1244, -2266, -2196, -1744, -1699, -2562, -3542, -2782, 342, 3692, 4325, 1905, -846, -1387, -216, 154, -1390, -3388, -3999, -2857, -380, 2905, 5546, 5773, 3990, 2530, 2063, 665, -2547, -5349, -5255, -2580, 339, 1774, 1881, 2117, 3533, 5243, 4919, 1379, -3530, -6424, -5635, -2221, 1971, 5695, 7649, 6472, 2389, -2637, -6997, -10076, -10464, -5994, 2757, 10647, 11941, 5957, -2719, -9276, -12166, -11812, -8314, -1876, 5801, 11928, 14206, 11621, 4731, -3837, -9849, -10095, -5129, 1317, 5703, 6818, 5301, 2510, -336, -2824, -4668, -4664, -2170, 862, 2033, 1681, 1028, -632, -3274, -3707, -70, 4469, 6270, 5864, 4767, 1862, -3480, -8091, -8052, -3016, 4376, 11371, 15601, 14504, 6923, -4343, -13341, -15393, -10391, -1900, 5813, 9932, 9914, 7054, 3092, -749, -3709, -5533, -6510, -6557, -4618, -195, 4792, 7122, 5604, 2157, -1097, -4128, -6997, -7670, -4578, 629, 5568, 9533, 10906, 6769, -1580, -7831, -8642, -7066, -5546, -1925, 4192, 7434, 3885, -2123, -3971, -2255, -2002, -2985, -1006, 2942, 4065, 2751, 2645, 2406, -771, -3355, -1181, 1729, -557, -5619, -6889, -3695, -336, 1182, 2008, 2455, 1648, 90, -746, -1069, -2067, -2782, -1044, 2298, 3742, 2175, 110, -692, -1426, -3198, -4702, -4152, -1419, 2810, 7654, 10305, 6950, -1717, -9027, -9663, -5246, -52, 4169, 6464, 5265, 1762, -261, 112, 183, -1088, -1792, -1112, -523, -859, -1109, -73, 2259, 4314, 3619, -855, -6686, -9531, -7136, -1335, 3919, 5909, 4533, 1342, -1863, -3860, -4428, -3951, -2460, 0, 2137, 2557, 2243, 3156, 4170, 1904, -3662, -7896, -7037, -2397, 1899, 3351, 2568, 1683, 1788, 1708, -369, -3876, -5581, -3301, 825, 2297, -359, -3713, -3535, 533, 5166, 6929, 4782, 164, -4234, -6242, -5528, -3228, -399, 2554, 4912, 5169, 2462, -1976, -5718, -7237, -6381, -3290, 1674, 6906, 9845, 9073, 5596, 1763, -916, -2617, -3861, -3929, -1624, 2384, 5463, 5748, 3690, 639, -2407, -4274, -3782, -1322, 1170, 2543, 3370, 4017, 3275, 207, -3626, -5451, -4493, -2415, -747, 467, 1342, 1067, -1042, -4143, -6029, -4809, -769, 3263, 3979, 825, -3011, -3856, -1594, 1005, 2453, 3219, 2677, -444, -4306, -5254, -3217, -1116, 677, 4197, 8569, 10102, 7562, 3185, -1186, -5386, -8643, -8949, -5365, 194, 4202, 4884, 4010, 4074, 4500, 2973, -389, -3502, -6081, -8808, -9531, -4954, 3816, 11350, 13670, 11112, 5959, 190, -4509, -7057, -7764, -7424, -5464, -816, 5110, 8605, 7807, 4586, 1540, -478, -1276, -662, 324, 181, -517, 68, 1290, 181, -3484, -5518, -3026, 995, 2095, 906, 1016, 2347, 1723, -998, -2474, -1426, -209, -359, -260, 1599, 3981, 4931, 4247, 2420, -771, -4713, -7090, -6666, -5070, -3665, -842, 4841, 10522, 11349, 6458, -215, -5167, -8383, -10246, -8612, -1892, 6557, 10695, 8653, 4489, 2425, 2040, 570, -2400, -4920, -5895, -5773, -4497, -1291, 3251, 6818, 7775, 6491, 3741, -568, -5979, -10066, -10202, -6446, -1153, 4032, 8696, 11101, 8513, 1586, -4786, -7057, -6318, -4538, -1618, 1990, 3889, 2915, 401, -2532, -5625, -7522, -6441, -2725, 1652, 5331, 7690, 7839, 5064, -161, -5961, -9488, -8521, -3783, 1133, 3343, 3423, 3833, 5484, 6734, 5323, 1027, -3480, -4900, -2643, 946, 3530, 4309, 2747, -1618, -7157, -10162, -8495, -4112, -705, 282, 14, -201, 280, 2113, 4844, 5803, 3014, -1483, -4080, -4160, -3292, -1697, 928, 2718, 1550, -1226, -2055, 152, 2944, 3768, 2424, -212, -3945, -8280, -10734, -8318, -1163, 6725, 10984, 10238, 5816, -151, -5330, -7390, -5632, -2143, 115, 474, 825, 2607, 4713, 4935, 2528, -1254, -4242, -4496, -1738, 1815, 3537, 3465, 3454, 3659, 2537, 97, -1741, -2100, -2023, -2418, -2982, -3032, -2089, -41, 2338, 3580, 2938, 1122, -824, -2558, -3823, -3656, -1291, 2181, 4012, 2707, 276, -377, -11, -1657, -4522, -4476, -1475, -29, -987, -266, 2671, 3024, -916, -4961, -6091, -5592, -4288, -853, 3867, 5953, 3551, -392, -2324, -2638, -3937, -6265, -6717, -3355, 2698, 8756, 12133, 10694, 4182, -4448, -10317, -10208, -5184, 459, 3220, 3408, 3595, 4569, 4306, 1229, -3109, -5524, -4482, -1105, 2420, 4419, 4206, 2298, 439, 288, 1480, 1703, -599, -4002, -5215, -2419, 2655, 6068, 5261, 1432, -1916, -2787, -2455, -3107, -4476, -3871, 441, 6677, 10872, 10449, 6021, -118, -6118, -10556, -11622, -8064, -926, 6593, 10995, 10296, 5444, 291, -1646, -1002, -1409, -4009, -5564, -3655, -974, -1013, -1555, 2018, 7568, 7343, -292, -7396, -7289, -2309, 1998, 4253, 5667, 6136, 5091, 3383, 2172, 1206, -755, -3879, -5775, -3322, 2931, 7764, 6663, 1149, -3204, -3177, -589, 924, 83, -1366, -1210, 655, 2030, 822, -2041, -2858, 274, 4164, 4398, 1467, -632, -844, -1383, -2440, -1738, 866, 2922, 3291, 2922, 2363, 1138, -1193, -4646, -8166, -9198, -5914, 227, 5940, 9228, 9651, 7162, 2545, -2345, -5747, -6369, -3487, 1414, 4886, 5536, 5272, 4908, 2670, -1197, -3388, -2756, -1504, -367, 1853, 3797, 2380, -1494, -3132, -457, 3659, 5644, 4848, 2582, -230, -3219, -5087, -3725, 873, 5020, 4985, 1731, -607, -534, -363, -1638, -2886, -2765, -2326, -2627, -2602, -1237, 0, -684, -1997, -954, 2476, 4634, 2648, -2265, -6799, -8936, -8074, -3769, 3135, 9242, 11136, 8700, 3944, -1766, -6673, -7489, -3304, 1493, 2281, 303, 212, 3275, 6307, 6092, 2560, -1852, -4764, -5678, -5130, -2851, 1189, 4623, 4694, 2144, -250, -2180, -4984, -7212, -5423, 410, 5885, 7034, 4068, 171, -1767, -1307, -590, -2206, -5836, -7368, -3052, 5267, 11063, 10054, 4342, -1150, -4171, -5808, -7447, -8517, -6893, -1507, 5308, 9257, 8613, 5850, 3677, 1126, -4196, -10844, -13336, -8199, 1555, 9274, 10888, 7437, 2739, -120, -806, -1481, -4161, -7730, -8360, -4058, 2051, 4862, 3320, 1023, 947, 2212, 2147, -948, -6565, -11098, -9880, -2924, 3603, 4731, 2843, 3065, 5369, 5452, 1833, -2099, -3121, -2004, -1104, -272, 2556, 7120, 9732, 7599, 2435, -1927, -4065, -5109, -5608, -4697, -1825, 2221, 5232, 4301, -1040, -6410, -6543, -1859, 2226, 2217, -435, -2388, -1555, 1569, 3680, 1672, -2832, -4727, -2046, 1884, 3644, 3640, 3604, 3178, 907, -2773, -5350, -4958, -2345, 393, 2330, 3842, 4488, 2559, -2288, -7213, -8471, -5213, -178, 3160, 3509, 2076, 650, -206, -978, -1716, -1800, -1036, 240, 2054, 4292, 5352, 3117, -2137, -7103, -8482, -5810, -802, 4713, 8789, 8977, 4697, -1108, -5320, -7745, -8213, -4475, 2802, 7449, 5382, 507, -1699, -1778, -2858, -4348, -3685, -1138, 811, 1030, 532, 629, 1232, 1074, -73, -319, 1652, 3812, 3002, -855, -4709, -5576, -2462, 2933, 6233, 3864, -2094, -5393, -2996, 1806, 4163, 2670, -515, -2077, -261, 3208, 4848, 3736, 2201, 1840, 1511, -212, -2821, -4361, -3044, 827, 4169, 4290, 2750, 2890, 3798, 1093, -5442, -9633, -6788, -457, 2063, -923, -4381, -4035, -1106, 797, 177, -1731, -2416, -348, 2563, 2336, -1412, -3841, -1494, 2355, 2294, -1551, -4182, -2931, -189, 1254, 1832, 2777, 3123, 1400, -1644, -3878, -3887, -1371, 2664, 5271, 3468, -1699, -5103, -3442, 430, 1489, -572, -1789, -672, -416, -3220, -5887, -3696, 3000, 8565, 8231, 2846, -2551, -3748, -940, 1824, 1061, -1946, -2741, 218, 3727, 4892, 4449, 3527, 1193, -2437, -4346, -2690, -65, 146, -1201, -483, 2865, 4771, 2103, -2101, -2148, 1884, 3489, -802, -5782, -4831, 899, 4952, 4616, 2870, 2484, 2472, 855, -1826, -3109, -1843, 97, -340, -3776, -7002, -6026, -787, 4192, 4895, 2663, 2172, 4736, 6125, 2396, -4216, -7778, -6097, -2590, -700, 340, 3061, 7416, 10317, 8494, 1693, -6389, -11013, -10628, -7098, -2148, 3803, 9081, 10349, 6596, 1320, -1350, -1360, -1453, -2498, -2968, -2388, -1746, -619, 2400, 5930, 5989, 944, -6022, -9817, -7600, -881, 5249, 6092, 1868, -2565, -3341, -1684, -1141, -1954, -720, 4111, 8924, 8573, 2055, -6293, -10438, -7712, -1333, 2839, 2941, 2550, 4422, 5838, 2775, -3724, -8635, -9082, -6311, -2361, 1693, 4104, 2926, -438, -1749, 95, 1010, -2180, -6776, -8043, -5416, -2061, -76, 1035, 1888, 1953, 1145, 653, 1162, 1683, 1221, 461, 494, 863, 383, -636, -706, 222, 17, -2697, -5613, -4468, 1773, 8922, 11601, 7971, 43, -8115, -11794, -8767, -2200, 2709, 4767, 5766, 5692, 3878, 1696, -685, -5221, -9679, -7846, -25, 5366, 4147, 1295, 1260, 2311, 2029, 547, -2008, -5126, -5942, -2656, 1665, 2655, 391, -1530, -1431, -1171, -2484, -3912, -2463, 2634, 8639, 11360, 8458, 1604, -4560, -6608, -5321, -3458, -1347, 2726, 7508, 7829, 1459, -5994, -7293, -2862, 823, 730, -106, 1214, 3551, 4317, 2494, -1157, -4716, -6041, -4354, -806, 2623, 4385, 3935, 2099, 815, 1315, 2048, 72, -4176, -6005, -2866, 1650, 3505, 3299, 1879, -2740, -9179, -10579, -4026, 4477, 8201, 6529, 2177, -1844, -2659, -662, -272, -3010, -4123, -479, 3680, 3589, 1526, 2497, 5831, 6238, 1756, -3896, -6746, -6208, -3234, 765, 3143, 2762, 2696, 5319, 7060, 3794, -1749, -4165, -3421, -2796, -2287, 309, 4273, 6541, 5852, 3198, -454, -4197, -6041, -4573, -1274, 1418, 3826, 7570, 10706, 8517, 526, -7204, -9393, -7859, -6841, -5371, -162, 6518, 9267, 8011, 6266, 3384, -2913, -9029, -9265, -4606, -409, 1593, 3031, 4091, 3822, 2322, -286, -4131, -7004, -5101, 1284, 5915, 3997, -784, -1094, 3578, 6563, 3743, -1917, -5950, -7233, -6429, -3806, -11, 3505, 5776, 6808, 6604, 4850, 1773, -1715, -4959, -7478, -7823, -4398, 1901, 7672, 10149, 8829, 4475, -1190, -5507, -7061, -7145, -6836, -4072, 3088, 11034, 12714, 6362, -1812, -5858, -6909, -8430, -9119, -5484, 1708, 8256, 11280, 9952, 4522, -2473, -6792, -6554, -3787, -972, 1826, 5446, 8871, 9403, 5446, -1382, -6949, -7574, -3345, 1419, 2792, 2249, 3797, 6266, 3966, -3799, -10041, -8947, -2240, 4610, 7700, 5874, 1198, -1704, -336, 2289, 1705, -2078, -5518, -6666, -6059, -3519, 1982, 8366, 9970, 3831, -5359, -9759, -7237, -2547, 83, 1526, 3750, 5513, 4910, 2982, 1335, -1256, -6126, -10340, -9096, -2202, 5231, 8799, 8469, 5707, 752, -5349, -9203, -8305, -3875, 955, 3838, 4013, 3066, 4186, 7422, 7331, -340, -10793, -13989, -6669, 3614, 7749, 5102, 2121, 2967, 4928, 3377, -1752, -6392, -7453, -5115, -1178, 2209, 2955, 971, -978, -707, 500, 600, -58, -732, -2313, -4629, -4823, -1044, 4638, 8611, 8913, 5626, 343, -4591, -7955, -10381, -12083, -11078, -5342, 3888, 12356, 16222, 14320, 7500, -2328, -11840, -16864, -15200, -8389, 86, 7554, 12651, 14277, 11227, 3387, -6241, -12015, -10699, -5705, -3066, -3257, -1105, 5231, 9910, 7075, -615, -5500, -5016, -3256, -2943, -1620, 2436, 5554, 3343, -2994, -8133, -8636, -5123, 57, 4730, 7184, 6937, 5202, 2920, -824, -6141, -9452, -6874, -69, 5049, 5608, 4471, 5051, 6101, 3344, -4299, -11680, -12327, -6049, 1213, 5474, 8469, 11793, 12169, 6279, -2908, -8895, -9261, -7055, -5192, -2809, 1981, 8111, 11941, 10547, 3964, -4646, -10782, -12006, -9517, -5361, 238, 6658, 10428, 8620, 3297, -811, -2370, -3991, -6821, -7644, -2983, 5378, 11064, 9495, 2497, -3845, -5400, -3770, -3458, -5394, -5324, -168, 6508, 8426, 4076, -2777, -8079, -9905, -7867, -3142, 1924, 5722, 7883, 7960, 5448, 818, -4742, -9400, -10067, -4728, 3496, 8044, 6201, 1817, -256, 464, 1052, -711, -3808, -4764, -1521, 3189, 4162, 55, -4599, -4680, -233, 3928, 3542, -742, -4108, -2660, 2304, 5692, 4197, -428, -4047, -4745, -3520, -1388, 1649, 4530, 4769, 1722, -1684, -2297, -519, 666, -339, -2010, -1660, 1222, 3775, 2528, -2425, -6908, -6725, -1556, 5026, 8363, 6014, -315, -6205, -8347, -6443, -1826, 3493, 6640, 5733, 2486, 321, -303, -1873, -4898, -6166, -3182, 2040, 5436, 5790, 5191, 5069, 3892, -464, -7124, -11872, -10489, -2718, 6801, 11981, 10478, 5326, 966, -1614, -4384, -7619, -8697, -6074, -1390, 3533, 8262, 10933, 8005, -358, -7907, -8485, -2932, 2520, 3549, 1379, -277, 247, 1709, 2219, 1074, -1283, -4145, -6728, -7436, -4058, 3402, 10289, 10559, 3666, -4094, -6715, -4778, -2641, -1529, 873, 4687, 6264, 3648, -234, -1900, -1624, -1571, -2432, -3535, -3944, -2359, 1628, 5319, 4652, -303, -4183, -3022, 382, 1148, -336, -398, 1126, 1731, 1709, 3039, 4631, 3604, -429, -5475, -9093, -8698, -3537, 2881, 5992, 5732, 5399, 5937, 5077, 1441, -3524, -7370, -8581, -7072, -3827, 10, 3575, 5908, 6289, 5373, 4474, 3182, -417, -6124, -10085, -8453, -1865, 4723, 6699, 4222, 1579, 1532, 1672, -1470, -6093, -6660, -1578, 4482, 6646, 5042, 2886, 1941, 1558, 565, -1621, -4863, -7677, -7467, -3115, 3200, 8158, 10254, 9435, 5692, -219, -6177, -10190, -11163, -8166, -1377, 6069, 10020, 9698, 7751, 5521, 1189, -5949, -11939, -11649, -5003, 2786, 7268, 8445, 7695, 4386, -1505, -6130, -5796, -3018, -3257, -6036, -4951, 2543, 10683, 12662, 8355, 2596, -1227, -3265, -4665, -5664, -5531, -2707, 3658, 10636, 12454, 7082, -808, -6005, -8307, -9229, -7575, -1914, 5674, 11149, 11722, 6749, -1966, -10048, -12937, -9367, -1920, 5436, 9560, 8993, 4910, 1152, 547, 669, -3293, -10438, -13409, -7753, 2388, 10007, 12226, 9451, 2528, -5782, -10172, -7851, -2389, 1160, 3009, 5996, 8388, 5714, -1075, -6086, -6947, -6276, -5109, -1327, 4917, 9574, 9290, 4335, -2910, -9556, -12507, -9992, -3615, 2776, 6944, 9498, 11004, 10183, 6011, -480, -7441, -13049, -14394, -8675, 2206, 10858, 11388, 5924, 1165, -330, -1466, -3920, -5144, -3270, -648, 112, 159, 1063, 503, -3798, -7684, -4408, 5196, 12455, 11254, 3438, -5634, -11435, -11161, -5506, 1203, 5520, 7305, 6731, 3478, -369, -1940, -2440, -5277, -9634, -10628, -5535, 3492, 11831, 15437, 13062, 6809, -557, -8007, -14276, -15996, -11134, -2429, 5545, 10922, 13746, 12971, 7162, -2557, -11800, -15394, -11274, -2773, 4019, 5871, 4309, 2166, 653, 0, 271, 665, 5, -1339, -1775, -1410, -2392, -4840, -4944, 33, 6746, 9394, 6882, 2674, -786, -3254, -3927, -2182, -314, -1287, -3878, -3695, 748, 6030, 8422, 7449, 3924, -2235, -9612, -13277, -9176, -61, 6808, 8404, 8262, 8860, 7014, 395, -6649, -8724, -6664, -4648, -3909, -2842, 179, 5624, 10726, 9714, 1053, -8023, -9733, -5334, -1423, -515, -283, 1158, 3271, 4299, 2630, -1210, -4007, -3307, -497, 1548, 2371, 3353, 4559, 4320, 1557, -2697, -6096, -6911, -5200, -2200, 1158, 4491, 6813, 6340, 2188, -4029, -8713, -8620, -3497, 3190, 7126, 7116, 5249, 3458, 1806, -244, -3038, -6576, -8983, -6671, 1009, 8758, 10427, 6274, 1503, -1649, -5785, -11360, -12949, -6137, 5051, 11895, 10460, 3796, -3429, -8347, -8953, -4577, 1769, 5286, 5169, 5086, 6245, 4448, -2838, -10899, -13155, -8654, -1258, 4994, 7646, 6596, 4257, 2322, -392, -4237, -6089, -4120, -1555, -1793, -3026, -1321, 3317, 6886, 6120, 1682, -2704, -3813, -1789, 644, 1535, 1204, 783, 893, 1894, 3811, 5391, 4383, -226, -6230, -8965, -5275, 2528, 7814, 6457, 1632, -282, 2170, 4158, 1272, -5001, -9553, -9470, -6016, -1503, 3658, 9444, 13073, 10347, 1141, -8775, -13221, -11566, -7698, -4386, -901, 4034, 9165, 11638, 9950, 5119, -457, -4688, -6980, -8024, -7835, -4845, 1319, 7262, 8690, 5469, 1162, -2020, -4954, -8018, -8877, -5420, 997, 7097, 10741, 10662, 5700, -2741, -9810, -11847, -9606, -4946, 1737, 8637, 11699, 9065, 2798, -4562, -11189, -13971, -10084, -1196, 7285, 11493, 11198, 7276, 549, -6334, -9260, -6853, -2255, 1063, 3043, 4716, 4701, 1364, -2899, -3740, -1305, -33, -1124, -849, 1767, 2732, 1341, 2243, 5641, 4927, -1738, -7000, -5579, -1272, 676, 551, 859, 2048, 3558, 5208, 6275, 5217, 999, -5452, -10846, -11229, -5495, 2809, 8287, 8690, 6198, 3377, -40, -4370, -6410, -2681, 4649, 8999, 6373, -1332, -8872, -11138, -6026, 3317, 10130, 9866, 3870, -3037, -7057, -7051, -3826, 660, 3903, 4064, 1310, -2222, -4299, -4377, -3301, -1639, 848, 3907, 5710, 4243, 148, -3118, -3148, -1310, -30, 805, 2454, 4038, 3658, 1591, -310, -1477, -2408, -2363, -157, 2787, 3403, 1591, 186, -567, -3493, -7677, -7537, -1477, 4866, 6849, 5779, 3618, -149, -4098, -3999, 966, 5835, 5730, 1291, -2699, -2838, -786, -907, -3890, -5145, -1358, 4485, 7321, 6136, 3171, 61, -2832, -5700, -8840, -10714, -7691, 877, 9405, 11954, 9139, 5302, 1642, -3330, -8468, -9872, -5994, 347, 5483, 8110, 8426, 6281, 1756, -3704, -8218, -10795, -10835, -7487, -1104, 5323, 8210, 7064, 4480, 2470, 829, -1028, -3210, -5799, -7336, -4592, 2559, 8465, 8067, 3168, -1547, -4896, -7167, -5928, 449, 7581, 8886, 3831, -2165, -5613, -7731, -8968, -6631, -362, 5257, 6740, 5986, 5616, 4233, -334, -6265, -9535, -8581, -4827, 54, 4938, 7954, 7097, 2995, -733, -1474, -732, -1479, -3528, -4164, -2462, 311, 3781, 7803, 9237, 4339, -5253, -13019, -14061, -8151, 1931, 11493, 15333, 11792, 4398, -2119, -5745, -6832, -6523, -5701, -3848, 38, 4543, 6585, 5556, 3220, -169, -4948, -8295, -6787, -1716, 2890, 5463, 5860, 2607, -3824, -8229, -6075, 358, 4897, 4890, 3014, 2564, 3046, 1246, -3515, -7266, -6392, -2415, 1367, 4920, 8776, 9921, 5871, -516, -5317, -8690, -11237, -10047, -3354, 4850, 9282, 9271, 6914, 2655, -3413, -8113, -7611, -2970, 734, 1308, 1488, 3354, 4887, 3544, -91, -3360, -3954, -1284, 2781, 5301, 5114, 2925, -804, -5361, -8215, -7390, -4437, -2035, -56, 3109, 6808, 8615, 7592, 4592, 79, -5625, -10063, -9792, -4650, 2106, 8196, 12905, 13658, 7945, -1161, -7714, -10776, -13083, -13230, -7117, 3278, 10150, 9545, 5056, 1287, -1338, -3838, -5010, -3283, -14, 2029, 2465, 3021, 4170, 4709, 4367, 3907, 2592, -1222, -6080, -7469, -3748, 1151, 3413, 4383, 6567, 7680, 3514, -4664, -10211, -9016, -4070, -985, -888, 88, 4294, 8295, 7440, 2293, -2953, -6027, -6353, -2882, 2720, 4976, 2100, -564, 719, 2495, 1465, -238, -985, -3008, -6338, -6680, -2476, 1868, 2443, 832, 267, 687, 499, 221, 719, 467, -1361, -1744, 1686, 5828, 6428, 4053, 1791, 493, -366, -695, -1051, -2650, -4737, -5014, -3088, -662, 1562, 4107, 5746, 3793, -1152, -3861, -852, 3847, 3238, -2952, -7297, -4284, 2670, 5964, 3207, -991, -1772, 492, 2217, 1700, 372, -44, 66, -930, -3257, -4863, -3909, -1035, 1840, 3453, 2849, -144, -2798, -1616, 1877, 2276, -1305, -3483, -908, 3357, 5335, 4702, 2380, -1580, -5916, -7557, -4943, 131, 4957, 8272, 9204, 6213, -513, -7030, -8986, -6667, -4222, -3954, -3667, 32, 7193, 13544, 13737, 6004, -5887, -15233, -17010, -10827, -872, 7018, 9857, 9321, 8250, 6328, 1379, -5671, -10125, -8539, -2649, 2582, 3793, 1462, -1632, -3084, -2366, -720, 223, 66, -439, -804, -925, -100, 2040, 3753, 2857, 223, -1208, -830, -784, -1716, -1280, 1946, 5535, 5920, 2586, -2048, -5687, -7253, -6064, -2386, 1526, 3120, 2212, 581, -489, -798, -120, 1692, 3725, 4470, 3410, 1433, -453, -2262, -4413, -6141, -5569, -2121, 2151, 4753, 5141, 3860, 1272, -1391, -2297, -2064, -3411, -6205, -6651, -2976, 2059, 5542, 7204, 7050, 4012, -1826, -7866, -10451, -7369, -160, 5901, 6292, 2338, -367, 571, 1287, -1807, -5507, -4405, 254, 2570, 1664, 1930, 4067, 3915, 697, -1318, -414, 20, -2222, -4772, -4889, -2908, -139, 3446, 7382, 8606, 4250, -3510, -8210, -6135, -652, 2388, 1719, 558, 1038, 2159, 2630, 2209, 299, -3539, -7483, -8405, -5063, 865, 6204, 8557, 8220, 6603, 2235, -7024, -16297, -15928, -4946, 6118, 9575, 8623, 7892, 6091, 2102, -860, -1471, -3347, -8141, -11328, -8401, -1090, 5890, 10728, 13350, 11671, 4324, -4745, -9678, -9445, -6751, -2410, 3862, 8788, 7668, 1396, -3462, -2904, -168, -332, -3304, -5142, -4276, -2672, -1459, 898, 5228, 9244, 9996, 7144, 2465, -2550, -7052, -9626, -8591, -3793, 2642, 7453, 8326, 5505, 1440, -1721, -3925, -5808, -6604, -5129, -2147, 437, 2603, 6107, 10660, 11985, 5825, -5828, -14765, -15218, -10127, -4789, 1569, 10618, 16339, 12308, 3310, -1895, -4472, -9856, -13980, -8734, 2790, 9118, 6324, 1015, -1327, -2187, -3729, -4276, -2587, -757, 512, 4127, 9984, 11429, 3454, -9147, -16142, -12305, -1510, 7526, 8767, 3937, 109, 1346, 4288, 3503, -965, -4450, -4853, -4672, -5211, -3656, 1609, 7049, 8641, 6952, 4386, 815, -4507, -9221, -9637, -5250, 1092, 6635, 9816, 8989, 3668, -3176, -7608, -9059, -8669, -5275, 2136, 10007, 13453, 11979, 7693, 713, -8972, -17413, -18991, -12119, -190, 11756, 18926, 17466, 7760, -3426, -8795, -8418, -7114, -5482, -655, 5170, 5927, 1963, 635, 4803, 7854, 3028, -7128, -13769, -11742, -3925, 3626, 7913, 9385, 8617, 5418, 774, -2847, -4160, -4944, -7333, -9286, -6085, 2058, 8298, 7983, 4096, 752, -2141, -4340, -3087, 823, 2391, 349, -1713, -2736, -4600, -5371, -575, 8272, 13344, 9656, 112, -8806, -12809, -11016, -4842, 2426, 6867, 7062, 5419, 4733, 4361, 1482, -4588, -10760, -12565, -7962, 538, 7841, 11021, 11264, 10445, 7673, 1254, -7224, -13109, -12952, -7226, 1048, 8850, 13838, 13792, 7552, -2462, -10439, -12077, -8442, -3197, 1765, 5366, 5587, 2678, 662, 1645, 2527, 841, -1252, -1885, -2641, -4145, -4025, -1006, 3403, 7006, 7460, 3688, -1269, -3658, -4979, -7534, -7366, -1241, 4799, 4873, 3559, 5607, 5554, -959, -6761, -4871, 185, 1584, 423, 75, -511, -2551, -3407, -789, 3160, 4294, 1280, -2861, -3958, -1442, 1271, 1686, 1081, 1301, 1634, 743, -888, -2034, -2015, -447, 1821, 2096, -835, -3967, -3753, -817, 2041, 4163, 6037, 6293, 3025, -3099, -9312, -13022, -12033, -4621, 7518, 17230, 16652, 5739, -6210, -10008, -6366, -3453, -5486, -7974, -5097, 2786, 11141, 16224, 15630, 8437, -2368, -11179, -14902, -13842, -8486, 120, 8093, 11445, 10317, 7175, 2687, -3418, -9223, -11724, -10118, -5405, 1993, 10730, 15545, 10955, -833, -10592, -12462, -9136, -5255, -1117, 4486, 9813, 11725, 9180, 3295, -4055, -10193, -11812, -7395, 295, 5624, 5407, 2426, 1931, 4546, 4996, -883, -9755, -13509, -7932, 2649, 9608, 8652, 3735, 1466, 2645, 2465, -1325, -5221, -6158, -5811, -5938, -4026, 2231, 9113, 10393, 5693, 530, -1955, -4165, -7758, -9565, -6327, 489, 6833, 9842, 8521, 3812, -1401, -4643, -5923, -6117, -4914, -1965, 1553, 4232, 6021, 7109, 6453, 3225, -1167, -4731, -7691, -10531, -10394, -4033, 5981, 12820, 12938, 7834, -83, -8456, -13473, -12533, -7615, -2533, 1765, 6531, 11419, 13584, 10216, 1624, -7900, -13245, -12772, -8087, -830, 7005, 11141, 8520, 2226, -1775, -2090, -1826, -2663, -3352, -2890, -1494, 571, 2750, 3789, 3125, 1758, 918, 719, 442, -592, -2705, -5265, -5837, -1832, 5221, 9304, 6589, 161, -4706, -6505, -5859, -2732, 1345, 3061, 2297, 2410, 3823, 2837, -1598, -5272, -4863, -2313, -1091, -1368, -1016, 1020, 4414, 8136, 9223, 3847, -6896, -14884, -12897, -2981, 6699, 11408, 12195, 10309, 4791, -3376, -9795, -11653, -9809, -4443, 4913, 13267, 12769, 4197, -3314, -5899, -8112, -11581, -11386, -4752, 5320, 14286, 17552, 11521, -1031, -10961, -12393, -7954, -2568, 2319, 6504, 8338, 6921, 3859, 814, -2564, -6367, -8265, -6440, -2838, -288, 1404, 3193, 3911, 2945, 1606, -326, -3828, -5543, -1221, 5375, 5619, -1686, -9169, -11152, -7529, 643, 11466, 19080, 16984, 5469, -7668, -14507, -13812, -10248, -7383, -3448, 3997, 11733, 14030, 10664, 5940, 900, -6594, -14525, -16583, -10189, 671, 10521, 16138, 16172, 10847, 1923, -8153, -16111, -18054, -12716, -3311, 6026, 13119, 15865, 12201, 3705, -5177, -11914, -15361, -12483, -2332, 8384, 11192, 6819, 3498, 4290, 3449, -2521, -8082, -7769, -4734, -3380, -1007, 5020, 9687, 8620, 5838, 4925, 1548, -7130, -14274, -12423, -3831, 4239, 8767, 10422, 8381, 1407, -7350, -11313, -7339, 811, 6818, 7555, 3950, -1204, -4690, -4237, -658, 2224, 1544, -1251, -2520, -1032, 1421, 2732, 1645, -1749, -4705, -4068, -1082, 650, 1715, 4482, 5732, 965, -5978, -7456, -3216, 1831, 6000, 8740, 6868, 172, -5881, -7567, -6037, -1955, 4577, 9113, 6540, -852, -5957, -6067, -4026, -2326, -699, 1634, 4363, 6224, 5557, 1608, -3980, -7804, -7574, -3954, 946, 5957, 10303, 11440, 6340, -3780, -12221, -12627, -5657, 1983, 5073, 4533, 4101, 4473, 2937, -1666, -5873, -4782, 1855, 7953, 6874, -1142, -8924, -9873, -4024, 3101, 5854, 3335, 218, 997, 3275, 1144, -4655, -6912, -3310, 467, 494, -720, -703, -534, -900, -746, 29, 796, 1740, 2530, 1894, 332, 13, 826, 3, -3180, -5385, -3426, 1580, 5816, 6900, 4897, 852, -3318, -4954, -3458, -1779, -2306, -2950, -427, 4276, 7028, 5951, 2717, -629, -3537, -5612, -5280, -1153, 5015, 8203, 5128, -1265, -5053, -4464, -2492, -1355, -442, 895, 2286, 3344, 3113, 545, -2802, -3930, -3091, -2931, -3190, -1625, 859, 1738, 1627, 2264, 2660, 1787, 1310, 1983, 1588, -899, -3400, -4054, -2701, 197, 2732, 2172, -662, -1409, 1320, 4054, 3944, 1094, -3976, -9562, -11105, -5946, 2202, 7804, 9444, 8203, 4491, -387, -3568, -4156, -4236, -4705, -3440, 424, 3699, 3549, 1906, 1760, 1921, 196, -1285, 216, 1840, -673, -4710, -3956, 1199, 3866, 1749, 266, 2082, 1840, -3541, -7449, -3878, 2250, 3431, 1323, 1568, 3186, 1561, -2781, -5447, -4731, -1867, 2340, 6976, 9063, 5984, -504, -5543, -6940, -6940, -7274, -5562, 661, 8597, 12279, 9429, 3384, -1862, -5793, -9101, -9686, -4661, 3804, 8959, 7563, 3723, 2360, 2724, 1268, -2554, -6483, -8540, -7458, -2692, 3753, 7859, 7777, 5586, 3675, 1499, -2389, -6688, -8107, -5584, -1653, 1284, 4058, 7863, 9977, 6442, -1408, -7753, -9436, -7443, -2500, 4387, 8498, 5978, 514, -1627, -1017, -2522, -5996, -6597, -2672, 2432, 5457, 6098, 5205, 2845, -1071, -4892, -5448, -1699, 2714, 2989, -926, -4320, -3627, -50, 2984, 3687, 2382, -11, -2286, -2712, -535, 2457, 3615, 2371, -30, -2443, -3618, -2470, -511, -718, -2485, -2306, -84, 1409, 2720, 5770, 7362, 3159, -3980, -7758, -7372, -5595, -2478, 2472, 6405, 6617, 4174, 1356, -732, -1444, -1105, -1558, -3575, -5656, -6580, -5848, -1748, 6146, 13127, 13387, 7218, -403, -6452, -10399, -10641, -5736, 1763, 6681, 6443, 2953, -317, -1621, -1548, -1708, -2992, -4274, -3267, 182, 2942, 2922, 2564, 4592, 6658, 4793, 3, -3349, -3852, -3490, -3480, -3110, -1510, 1535, 5223, 7342, 5812, 1060, -4276, -7673, -7785, -4501, 465, 4151, 4916, 3891, 3375, 4236, 4470, 672, -6898, -12068, -10014, -4315, -286, 4104, 11244, 14390, 7402, -2989, -7438, -8274, -11007, -11116, -2368, 9861, 14844, 10055, 1215, -5919, -9111, -8943, -7269, -4924, -1119, 4294, 9702, 12977, 11784, 3970, -8810, -18748, -17688, -6521, 4813, 8496, 6901, 6798, 8699, 6970, -370, -7695, -9454, -7164, -5251, -3504, 1134, 7345, 10087, 8005, 4372, 789, -4170, -9597, -11217, -7059, -63, 5915, 9326, 9568, 6090, 412, -4277, -7362, -10837, -13054, -8141, 4532, 16314, 19310, 14608, 6670, -3374, -14223, -20566, -17910, -7658, 5000, 14997, 18337, 13409, 3325, -5515, -9033, -8448, -6762, -4134, 716, 5476, 5136, -66, -2220, 3657, 10221, 6358, -6620, -15685, -12740, -2514, 6467, 10821, 11092, 8306, 3925, -164, -2737, -3904, -5363, -8429, -10018, -4669, 6275, 13277, 10556, 3059, -2206, -4306, -4610, -2970, -670, -198, -692, 328, 1520, 221, -1379, 924, 5587, 6439, 1529, -4241, -6269, -5434, -4165, -1734, 2750, 6142, 4745, 117, -2663, -1423, 1110, 946, -2972, -7432, -7746, -2747, 3964, 8470, 10082, 9440, 6091, -195, -7580, -12459, -11050, -2789, 6731, 10311, 7759, 4477, 1864, -2485, -6329, -5144, -1351, -350, -684, 1308, 2768, 475, -1457, 838, 3703, 3244, 1495, 618, -846, -3327, -4702, -3714, -259, 5084, 8646, 5893, -1500, -6590, -6186, -3104, -201, 1682, 1587, -29, -7, 2614, 3805, 629, -3645, -4070, -473, 3120, 3288, 304, -2492, -2769, -2074, -2236, -1183, 2703, 5340, 2817, -1318, -2129, -1503, -2503, -2023, 2604, 6267, 3486, -2511, -4818, -2182, 1394, 2597, 1115, -1364, -2762, -2315, -813, 1038, 3116, 4475, 3432, -233, -4501, -7013, -6762, -3881, 1067, 6786, 10477, 8652, 742, -8014, -10308, -5204, 164, -142, -3226, -2265, 3849, 9811, 10918, 7014, 465, -6137, -10195, -9937, -6155, -1477, 2642, 6461, 9118, 8005, 2488, -3742, -6290, -4976, -3204, -2902, -2210, 1348, 6952, 10536, 8167, -72, -8537, -10312, -5119, -122, -55, -760, 3234, 9191, 9823, 3340, -5125, -9992, -9301, -4276, 1697, 4687, 3659, 1967, 2995, 4733, 2008, -5499, -11255, -9348, -907, 7746, 10873, 7495, 1836, -1516, -3067, -5540, -6882, -2908, 3723, 5626, 2049, -297, 1449, 2348, -1069, -4763, -3904, -410, 615, -1313, -2476, -1016, 1770, 4440, 5579, 3159, -2188, -5704, -4165, -513, 728, -55, 452, 2235, 2283, 423, -230, 915, 936, -815, -1644, -1164, -1664, -2392, -244, 3831, 5693, 4290, 1474, -2034, -5464, -6172, -3476, -762, -493, -662, 1394, 4767, 6296, 4262, -110, -3967, -5499, -5235, -4274, -2257, 1324, 4471, 3838, -546, -3936, -2498, 1436, 3161, 2638, 2812, 2923, 38, -4324, -5870, -4178, -1620, 1474, 4946, 5908, 2887, -1099, -3217, -4066, -4190, -2381, 993, 3285, 2948, 940, -494, 562, 3081, 2761, -1924, -5561, -2950, 2747, 4925, 2754, -241, -2249, -2744, -1021, 968, -231, -3059, -1759, 4251, 7967, 3925, -4790, -10345, -8334, -1464, 4006, 5341, 5348, 6344, 5747, 891, -5685, -9465, -8748, -3860, 3394, 8183, 6769, 2739, 2242, 3694, 295, -7633, -11507, -6726, 1158, 4641, 3196, 1253, 1094, 1323, 519, -875, -1782, -1373, 507, 2212, 1180, -2031, -2765, 1637, 6524, 5195, -1340, -5347, -3643, -1364, -2288, -2533, 1798, 6826, 6435, 1416, -2378, -2375, -839, 134, 199, -1613, -5452, -7204, -2498, 5512, 8745, 5272, 1176, 287, -894, -5441, -9262, -6433, 2107, 9312, 10149, 5659, -173, -4238, -5243, -3982, -2803, -2755, -2127, 628, 4272, 6480, 6044, 2691, -2504, -6198, -5469, -1764, 600, -94, -1256, 321, 4192, 5927, 2093, -4015, -5115, -208, 3112, 39, -4153, -2950, 1577, 3456, 1920, 401, 373, 723, 669, 285, -428, -1379, -2185, -2635, -2601, -1508, 1064, 3981, 4898, 2931, 175, -700, 225, 620, -645, -2063, -1778, -102, 1030, 486, -903, -1207, 845, 4151, 5346, 2265, -2946, -6294, -6590, -4794, -571, 5985, 10782, 9135, 2261, -3929, -6067, -5588, -4408, -2324, 552, 2455, 2714, 2859, 3141, 1484, -2209, -5031, -5964, -6342, -4695, 1554, 8627, 9028, 2590, -3146, -4018, -3169, -3630, -3724, -954, 3913, 7645, 7464, 3186, -2496, -6170, -6552, -4920, -2880, -439, 3311, 7634, 9095, 4712, -3563, -9652, -9703, -5440, -308, 4269, 7255, 6751, 3176, 192, -294, -984, -4285, -7430, -5803, 328, 5761, 6701, 4316, 1661, -87, -1397, -2645, -3735, -3889, -1766, 2481, 5781, 5008, 966, -2432, -2715, -1167, -716, -2341, -3732, -1826, 3159, 7228, 6837, 2542, -2357, -5471, -6444, -5590, -3027, 796, 4486, 6114, 4839, 1996, -418, -2132, -3881, -4805, -3122, 591, 3408, 3629, 2155, 438, -848, -1318, -966, -592, -901, -1459, -1372, -446, 1008, 2769, 4225, 3921, 950, -3198, -5478, -4452, -1671, 596, 1943, 3181, 4021, 3084, 181, -2861, -4047, -2908, -363, 1831, 1814, -484, -2396, -1313, 1708, 3099, 1496, -811, -1537, -1280, -1573, -2034, -1449, -157, 911, 2041, 3179, 2448, -983, -4381, -4523, -1724, 1240, 2542, 2169, 1034, 210, 2, -345, -1185, -1569, -994, -826, -2093, -2747, 146, 5289, 7285, 3439, -2327, -4655, -3376, -2055, -1994, -1230, 1313, 3849, 4251, 2564, 362, -1274, -2407, -3392, -4066, -3744, -1757, 1793, 5396, 6632, 4331, 192, -2800, -3619, -3565, -3388, -2019, 1006, 3830, 4426, 3164, 1810, 860, -658, -3077, -5050, -4931, -2584, 563, 3009, 4287, 4679, 4261, 2644, -294, -3677, -5775, -5250, -2536, 415, 2301, 3611, 4742, 4448, 1904, -1179, -2765, -3275, -3839, -3586, -1212, 2300, 4696, 4897, 3281, 899, -995, -1922, -2667, -3700, -3846, -1805, 1758, 4753, 5633, 4200, 1343, -1457, -3007, -3281, -3106, -2793, -1616, 911, 3724, 4969, 3925, 1429, -1274, -3267, -3995, -3506, -2313, -508, 2054, 4400, 4818, 3043, 562, -1431, -2822, -3568, -3444, -2379, -102, 3291, 5893, 5199, 1504, -2118, -3543, -3197, -2246, -1417, -1084, -637, 1174, 3908, 5026, 3131, -116, -2253, -2573, -1848, -1021, -632, -546, -139, 724, 1275, 910, 120, -209, 62, 349, 199, -275, -680, -689, -103, 991, 1899, 1595, -167, -2167, -2616, -978, 1257, 1961, 712, -566, 80, 2008, 2633, 636, -2503, -4208, -3172, -257, 2298, 2871, 2058, 1616, 1722, 680, -2189, -4882, -4829, -1755, 2261, 4865, 4964, 2912, 46, -2143, -3144, -3648, -4109, -3576, -973, 2831, 5380, 5045, 2345, -780, -2471, -2251, -1328, -1108, -1419, -911, 808, 2453, 2678, 1554, 18, -1302, -2072, -1852, -738, 156, 36, -274, 365, 1451, 1551, 552, -314, -443, -524, -1167, -1838, -1518, -7, 1759, 2707, 2608, 1791, 382, -1445, -2751, -2489, -945, 412, 698, 446, 536, 1019, 1323, 1081, 449, -219, -786, -1354, -1900, -2006, -1199, 423, 2091, 2999, 2893, 1950, 293, -1986, -4212, -5002, -3420, -234, 2645, 4101, 4420, 3871, 1844, -1727, -4977, -5431, -2758, 760, 2703, 2733, 2067, 1610, 1273, 522, -959, -2689, -3363, -2195, -89, 1473, 2245, 2747, 2842, 2044, 358, -1936, -4087, -4386, -1902, 1452, 2933, 2534, 2132, 1897, 421, -2092, -3491, -2586, -450, 1354, 2259, 2132, 906, -578, -875, -14, 243, -820, -1639, -938, 430, 1272, 1686, 1927, 1408, -253, -2330, -3469, -2657, -144, 2287, 2901, 1919, 832, 205, -403, -933, -877, -509, -556, -888, -659, 423, 1738, 2437, 1994, 432, -1504, -2621, -2225, -845, 362, 873, 1020, 1041, 644, -266, -1113, -1249, -678, 57, 470, 516, 544, 788, 933, 412, -779, -1801, -1767, -694, 477, 845, 465, 172, 420, 599, -48, -1168, -1606, -789, 710, 1725, 1309, -351, -1661, -1199, 303, 796, -200, -1060, -640, 219, 353, 29, 183, 745, 794, 11, -974, -1533, -1514, -918, 64, 833, 939, 618, 247, -149, -424, -191, 368, 437, -297, -1178, -1412, -757, 505, 1674, 1938, 1137, -36, -827, -1135, -1244, -1277, -1113, -659, 50, 870, 1514, 1602, 993, -55, -1200, -2214, -2575, -1624, 284, 1681, 1754, 1222, 843, 376, -378, -1009, -1357, -1563, -1248, -94, 1111, 1368, 825, 160, -413, -738, -466, 153, 382, 137, -29, -43, -305, -681, -589, -36, 316, 193, 88, 388, 775, 805, 522, 71, -605, -1204, -936, 332, 1470, 1324, 101, -973, -1020, -253, 366, 148, -589, -991, -749, -208, 401, 1032, 1319, 902, 148, -300, -482, -870, -1410, -1489, -728, 571, 1664, 1861, 1103, 98, -385, -355, -392, -762, -1099, -983, -486, -36, 160, 390, 863, 1111, 563, -312, -526, -198, -388, -1144, -1299, -381, 805, 1522, 1616, 986, -150, -926, -857, -560, -603, -578, -61, 468, 420, 80, 62, 320, 292, -136, -438, -212, 274, 457, 143, -341, -458, 98, 1019, 1425, 677, -711, -1426, -919, -94, 83, -52, 274, 832, 865, 410, 28, -206, -497, -696, -608, -340, 17, 464, 720, 471, -110, -578, -687, -369, 226, 596, 428, 175, 274, 265, -384, -1160, -1256, -760, -167, 512, 1312, 1668, 1105, 31, -722, -848, -684, -605, -585, -365, 69, 398, 413, 322, 399, 494, 227, -396, -861, -764, -286, 193, 639, 1060, 1079, 467, -264, -539, -548, -702, -812, -556, -92, 413, 1114, 1837, 1935, 1107, -261, -1589, -2316, -1958, -658, 716, 1471, 1692, 1643, 1272, 573, -160, -740, -1262, -1698, -1704, -962, 399, 1767, 2425, 2124, 1214, 137, -948, -1858, -2130, -1492, -318, 706, 1213, 1231, 988, 748, 626, 430, -118, -872, -1269, -992, -384, 71, 394, 856, 1327, 1392, 998, 424, -230, -970, -1456, -1218, -332, 582, 1015, 1005, 915, 898, 666, -33, -826, -1029, -597, -114, 145, 464, 915, 1167, 1092, 837, 358, -436, -1182, -1320, -728, 233, 1090, 1419, 1071, 431, 126, 248, 241, -228, -661, -431, 214, 534, 432, 393, 522, 515, 333, 110, -238, -600, -410, 439, 1085, 808, 101, -109, 214, 344, -12, -361, -220, 271, 710, 913, 845, 507, 65, -215, -315, -398, -438, -246, 139, 479, 657, 724, 635, 252, -300, -593, -366, 141, 518, 643, 613, 446, 108, -275, -495, -464, -191, 307, 936, 1414, 1411, 865, 104, -443, -750, -1091, -1309, -787, 439, 1334, 1214, 675, 459, 331, -157, -674, -689, -341, -62, 65, 190, 331, 419, 386, 146, -292, -688, -728, -340, 225, 657, 819, 745, 490, 128, -244, -582, -885, -1035, -798, -116, 710, 1209, 1103, 548, 35, -136, -215, -531, -863, -768, -339, -3, 172, 346, 382, 159, 10, 214, 391, 73, -468, -596, -330, -272, -511, -455, 44, 391, 329, 318, 457, 218, -424, -811, -711, -486, -220, 210, 538, 511, 377, 287, -83, -746, -1066, -705, -155, 42, 33, 178, 376, 277, -85, -374, -490, -574, -586, -416, -217, -143, -17, 262, 448, 416, 329, 105, -497, -1174, -1324, -925, -391, 163, 738, 961, 588, 32, -226, -289, -486, -822, -1047, -954, -487, 124, 511, 571, 522, 441, 145, -385, -882, -1119, -1072, -740, -168, 401, 683, 638, 413, 86, -351, -827, -1144, -1090, -650, -80, 300, 443, 515, 534, 351, -67, -574, -1009, -1170, -841, -157, 349, 391, 289, 361, 409, 113, -418, -819, -901, -707, -323, 154, 582, 742, 449, -191, -733, -823, -599, -436, -387, -184, 267, 717, 830, 446, -294, -1000, -1305, -1130, -588, 179, 860, 1002, 519, -144, -599, -868, -1009, -845, -361, 115, 391, 665, 998, 911, 27, -1139, -1636, -1263, -655, -220, 241, 838, 1200, 1004, 368, -363, -890, -1064, -938, -643, -167, 461, 900, 790, 288, -84, -184, -396, -868, -1076, -570, 240, 620, 514, 347, 171, -234, -681, -753, -444, -66, 201, 327, 313, 258, 185, -89, -571, -842, -639, -234, 66, 316, 527, 490, 205, -45, -172, -356, -575, -542, -143, 366, 639, 512, 68, -418, -640, -489, -150, 109, 215, 302, 450, 529, 353, -37, -378, -475, -373, -245, -165, -61, 157, 457, 647, 515, 72, -399, -627, -614, -501, -305, 51, 479, 735, 717, 549, 307, -105, -637, -921, -707, -230, 149, 402, 636, 735, 536, 106, -359, -718, -827, -596, -157, 243, 521, 723, 752, 390, -257, -720, -764, -702, -743, -560, 47, 638, 790, 675, 471, -1, -659, -945, -665, -252, 3, 267, 582, 646, 299, -231, -626, -714, -486, -76, 304, 497, 459, 232, -87, -366, -482, -352, 20, 435, 573, 360, 84, -7, -14, -83, -136, -95, -56, -15, 203, 536, 589, 189, -314, -491, -339, -132, -17, 62, 124, 119, 87, 138, 225, 174, -59, -333, -479, -384, -36, 384, 606, 552, 390, 243, 71, -183, -471, -618, -387, 219, 737, 688, 252, 9, 66, 10, -297, -462, -217, 182, 366, 298, 179, 141, 132, 50, -116, -272, -297, -106, 287, 676, 741, 393, -30, -150, -28, -15, -198, -318, -197, 54, 260, 365, 365, 249, 82, 7, 68, 131, 68, -72, -138, -44, 179, 384, 358, 112, 5, 226, 391, 102, -352, -396, -7, 355, 426, 291, 102, -29, -40, 9, 22, 35, 94, 108, 0, -84, 21, 203, 205, 24, -94, -25, 77, 88, 101, 194, 230, 84, -114, -171, -102, -50, -44, -18, 44, 121, 227, 354, 371, 152, -180, -308, -107, 156, 166, -3, 5, 300, 552, 398, -55, -361, -285, -55, 50, 66, 131, 205, 219, 241, 265, 152, -62, -139, -40, 35, 31, 93, 218, 237, 153, 137, 178, 64, -230, -399, -228, 84, 212, 138, 75, 94, 88, -8, -149, -245, -208, -21, 181, 232, 145, 75, 65, 16, -103, -179, -135, -56, -34, -15, 60, 104, 43, -37, -66, -96, -128, -74, 5, -50, -176, -138, 61, 160, 62, -55, -62, -36, -88, -202, -290, -297, -216, -65, 91, 153, 73, -99, -250, -289, -184, -21, 46, -23, -88, -30, 43, -8, -140, -212, -184, -105, -17, 11, -77, -204, -201, -69, -15, -147, -275, -179, 51, 160, 112, 86, 113, 53, -117, -244, -245, -179, -103, -45, -28, -34, -39, -73, -158, -198, -113, 17, 72, 47, -18, -107, -153, -63, 95, 149, 62, -36, -65, -69, -83, -78, -50, -43, -77, -107, -76, 5, 64, 47, -12, -47, -28, 20, 68, 97, 79, -21, -165, -215, -76, 141, 229, 168, 137, 216, 266, 137, -132, -378, -431, -220, 116, 316, 265, 126, 73, 28, -150, -352, -336, -128, -17, -67, -22, 222, 387, 278, 84, 13, -15, -118, -193, -117, 40, 145, 149, 101, 80, 120, 157, 119, 35, -37, -120, -233, -279, -161, 53, 196, 210, 174, 143, 76, -69, -223, -260, -147, 16, 108, 88, 27, 25, 110, 186, 148, 16, -87, -76, 25, 124, 135, 43, -63, -77, 5, 53, -25, -124, -73, 79, 142, 116, 163, 241, 146, -77, -173, -113, -65, -37, 51, 115, 73, 36, 35, -66, -235, -255, -120, -45, -40, 68, 245, 260, 71, -132, -202, -165, -98, -33, 18, 61, 86, 68, -21, -160, -250, -231, -150, -81, -12, 75, 102, 32, -26, 13, 47, -48, -198, -234, -114, 55, 171, 178, 99, 14, -29, -74, -178, -311, -372, -278, -37, 237, 404, 408, 304, 134, -111, -373, -493, -407, -217, -18, 190, 383, 430, 262, 16, -117, -129, -155, -231, -244, -118, 71, 215, 259, 208, 127, 104, 115, 27, -173, -292, -167, 97, 259, 245, 163, 77, -45, -208, -321, -363, -406, -450, -351, -50, 284, 405, 259, 7, -158, -169, -72, 14, -6, -78, -23, 208, 408, 375, 182, 5, -121, -223, -266, -245, -223, -180, -12, 223, 313, 178, -8, -85, -110, -204, -299, -223, 18, 218, 229, 127, 49, 5, -72, -184, -234, -125, 115, 340, 467, 508, 424, 99, -366, -615, -476, -186, -28, -15, -39, -45, 13, 132, 152, -23, -215, -213, -99, -74, -131, -114, -3, 98, 160, 223, 241, 102, -153, -337, -358, -314, -267, -140, 106, 357, 474, 415, 175, -219, -639, -864, -760, -402, -1, 260, 309, 183, 25, -55, -116, -264, -396, -300, -12, 200, 241, 234, 189, -14, -305, -435, -321, -127, -15, 5, 22, 124, 277, 307, 127, -129, -279, -290, -212, -78, 27, 25, 5, 121, 299, 306, 108, -78, -98, -4, 94, 172, 234, 260, 266, 271, 215, 16, -227, -288, -136, 9, 33, 66, 175, 223, 142, 62, 61, 33, -85, -173, -103, 69, 181, 161, 83, 28, 0, -43, -110, -154, -109, 42, 226, 327, 291, 166, 32, -88, -213, -317, -337, -267, -164, -70, 3, 21, -48, -155, -205, -182, -116, -25, 46, 18, -85, -106, 38, 201, 210, 97, 6, -72, -250, -466, -500, -319, -121, 28, 263, 560, 669, 474, 145, -114, -230, -176, 0, 161, 260, 393, 558, 544, 197, -323, -683, -687, -392, -4, 317, 527, 635, 609, 397, 33, -355, -612, -615, -344, 71, 415, 527, 386, 29, -469, -934, -1062, -669, 42, 618, 819, 768, 638, 405, 58, -200, -176, -3, 28, -88, -39, 350, 808, 913, 547, -45, -545, -780, -744, -539, -259, 79, 488, 854, 946, 664, 214, -87, -154, -139, -143, -84, 123, 409, 589, 510, 192, -132, -230, -125, -25, 5, 109, 386, 712, 858, 658, 79, -727, -1406, -1585, -1134, -259, 687, 1447, 1887, 1913, 1462, 660, -173, -802, -1221, -1393, -1057, -80, 1154, 2020, 2181, 1617, 404, -1164, -2426, -2741, -2061, -901, 193, 1004, 1535, 1784, 1692, 1185, 245, -977, -2059, -2507, -2122, -1102, 161, 1290, 1961, 2034, 1624, 951, 134, -713, -1272, -1170, -429, 415, 803, 666, 342, 80, -151, -498, -965, -1325, -1270, -773, -213, 53, 90, 123, 141, 27, -183, -411, -622, -652, -347, 124, 424, 488, 423, 160, -392, -1033, -1463, -1571, -1305, -583, 448, 1306, 1521, 987, 3, -874, -1090, -435, 781, 2026, 2938, 3329, 2904, 1378, -973, -3139, -4098, -3709, -2650, -1548, -469, 691, 1674, 1976, 1381, 149, -1230, -2287, -2634, -2134, -1069, 53, 990, 1931, 3037, 3913, 3794, 2351, 166, -1684, -2481, -2174, -1084, 412, 1894, 2871, 2937, 1956, 134, -1935, -3391, -3542, -2372, -537, 1170, 2289, 2648, 2161, 873, -845, -2379, -3213, -3106, -1968, 93, 2437, 4013, 4233, 3471, 2298, 661, -1558, -3620, -4391, -3571, -1895, -321, 565, 632, 132, -548, -1196, -1735, -1965, -1635, -687, 643, 1843, 2265, 1676, 631, -103, -337, -305, -62, 465, 1121, 1696, 2096, 2063, 1272, -6, -910, -907, -303, 225, 266, -33, -67, 578, 1466, 1748, 1346, 1035, 1293, 1664, 1364, 76, -1781, -3256, -3504, -2509, -1020, 340, 1517, 2422, 2396, 814, -1910, -4355, -5210, -4117, -1618, 1220, 3123, 3248, 1908, 366, -339, -178, 416, 1365, 2762, 4169, 4767, 4109, 2304, -216, -2476, -3036, -1354, 1111, 2146, 1133, -611, -1805, -2451, -2861, -2610, -1295, 486, 1956, 3394, 5395, 7203, 7005, 3990, -626, -4728, -6883, -6841, -5096, -2288, 962, 3746, 4632, 2402, -2518, -7570, -9743, -8276, -5325, -3204, -1547, 1207, 3986, 3611, -211, -3627, -3765, -2178, -1632, -2163, -2104, -872, 782, 1974, 2197, 1485, 344, -808, -1826, -2469, -2593, -2455, -2045, -789, 1155, 2323, 1760, 215, -1291, -2599, -3560, -3658, -2959, -1951, -542, 1290, 2400, 1616, -662, -3201, -5367, -6682, -6119, -3294, 263, 2403, 2713, 2470, 2333, 1462, -702, -3124, -4369, -4106, -2707, -293, 2956, 6065, 7529, 6351, 2758, -1710, -4745, -4486, -904, 4046, 7979, 9480, 8017, 3763, -1672, -5703, -7028, -6450, -4968, -2700, -91, 1733, 2352, 2248, 1529, 10, -1563, -1991, -1360, -918, -1039, -506, 1654, 4537, 6253, 5955, 4277, 2241, 446, -981, -2250, -3377, -3458, -1142, 3646, 8924, 12063, 11711, 8269, 3172, -1785, -4812, -4695, -1605, 2614, 5532, 5891, 4133, 1331, -1598, -3648, -4013, -2926, -1047, 1800, 5616, 8327, 7222, 2426, -3078, -6980, -9236, -10158, -9117, -5985, -2295, 222, 1321, 1393, -21, -3382, -7413, -9779, -9293, -6418, -2176, 2254, 5358, 5940, 4012, 562, -3308, -6759, -8979, -8971, -5965, -356, 5817, 9888, 10366, 7657, 3208, -1556, -5520, -7683, -7160, -3603, 2128, 7825, 11121, 10942, 7711, 2633, -2558, -5890, -6356, -4659, -2148, 410, 2407, 2765, 877, -2275, -4844, -5800, -5467, -4596, -3424, -1770, 154, 1452, 1313, -56, -1526, -1968, -1090, 293, 712, -753, -3162, -3944, -1373, 2962, 5220, 3569, 278, -1515, -1759, -2432, -3912, -4614, -3548, -1284, 1199, 3080, 3619, 2658, 856, -991, -2434, -3114, -2704, -1060, 1627, 4305, 5053, 3020, 84, -1095, -355, 442, 419, 371, 1213, 3237, 5846, 7156, 5550, 2170, -135, -384, 222, 965, 2087, 3167, 3386, 2900, 2261, 1211, -575, -2371, -3014, -2123, -172, 2014, 3355, 2914, 926, -1066, -2021, -2737, -4233, -5352, -3827, 192, 3475, 3197, 0, -2992, -3428, -1488, 882, 1782, 775, -835, -1358, -626, 82, 211, 628, 1700, 2436, 2201, 1536, 626, -1093, -3175, -3898, -2491, -200, 1279, 1491, 1170, 1110, 1085, 143, -1629, -2515, -1343, 863, 2495, 2982, 1963, -842, -3985, -5169, -4292, -2820, -731, 2444, 4734, 3742, 240, -3341, -5877, -6623, -4540, -662, 2137, 2872, 2784, 2413, 1601, 1075, 1059, 504, -228, 719, 2909, 3765, 2860, 1722, 112, -2879, -5334, -4604, -1338, 2158, 5360, 8170, 8535, 4818, -848, -4326, -4057, -1931, -84, 1094, 1798, 1915, 1857, 2276, 2470, 1082, -1272, -2277, -1105, 712, 1915, 2901, 3873, 3577, 1260, -1420, -1979, -118, 2230, 3545, 3765, 2670, -616, -5276, -7776, -5398, 109, 4459, 5671, 4975, 3841, 2487, 834, -1018, -2877, -3834, -2517, 882, 3957, 4660, 3695, 2982, 2575, 950, -1933, -4110, -4287, -2822, -58, 3670, 6383, 5796, 2477, -894, -2946, -3977, -3832, -1907, 1310, 4500, 6701, 7234, 5385, 1198, -3740, -6867, -6308, -2515, 1888, 4540, 5366, 5480, 4803, 2316, -1460, -4046, -3751, -1607, 563, 2604, 4689, 5114, 2517, -883, -1954, -1387, -1979, -3623, -3897, -2024, 862, 3271, 3450, 955, -1328, -574, 1206, 207, -2787, -4006, -3136, -2976, -3740, -2723, 409, 2508, 2055, 1349, 1776, 936, -2617, -5753, -5389, -3124, -1866, -1416, -413, 837, 1663, 1993, 998, -2063, -5353, -5704, -2476, 1908, 4819, 5404, 4354, 2787, 1097, -1161, -3943, -5953, -5881, -3725, -553, 2161, 2992, 1590, -779, -2727, -4165, -5076, -4137, -537, 3646, 5119, 3365, 1038, 207, 146, -418, -989, -647, 68, 464, 1203, 2659, 3500, 2664, 1169, 402, 123, -665, -2056, -3091, -2638, -564, 1550, 1829, 468, -614, -504, -28, 68, -92, -304, -278, 724, 2777, 4297, 3669, 1615, 430, 776, 789, -1014, -3548, -4924, -4764, -3625, -1896, -277, 606, 1444, 2942, 3683, 2065, -611, -2026, -2405, -3070, -3209, -1430, 960, 1443, 156, -669, -699, -1991, -4936, -6430, -3724, 1716, 6029, 7314, 6534, 5115, 3401, 1098, -1781, -4340, -4909, -2370, 2226, 5953, 6641, 4830, 2404, 142, -2145, -3995, -4520, -3524, -1214, 1824, 3628, 2186, -1291, -3164, -2181, -694, -571, -1113, -1683, -3187, -5562, -6312, -3625, 655, 3234, 3370, 2462, 904, -1697, -4145, -4571, -3257, -1994, -1393, -760, 395, 1948, 2982, 2040, -808, -2959, -2448, -610, 529, 1302, 2698, 3943, 3650, 1467, -2079, -5463, -6393, -4342, -1677, -289, 928, 3055, 4098, 1796, -2293, -4505, -3951, -2831, -2287, -1046, 1262, 2656, 2037, 899, 322, -780, -2886, -4120, -2846, 171, 3002, 4269, 3573, 1656, 49, -296, 463, 1774, 2850, 2651, 1136, -226, -541, -783, -1716, -2207, -1145, 603, 1480, 1089, -66, -1401, -2411, -2923, -2938, -1891, 563, 2874, 2864, 859, -856, -1371, -1468, -1527, -1655, -2487, -3600, -3210, -1295, -389, -1602, -2770, -2115, -925, -1016, -1905, -2101, -1565, -1251, -1200, -662, 285, 778, 675, 688, 1195, 2029, 2882, 2995, 1650, -91, 117, 2561, 4455, 3633, 1469, 603, 1162, 1028, -798, -2895, -3575, -2953, -2191, -1658, -845, 362, 1309, 1449, 881, -29, -885, -1126, -556, 150, 489, 1046, 2074, 2283, 994, -3, 991, 2856, 3582, 3022, 1943, 693, 55, 866, 2045, 1718, 430, 541, 2465, 3992, 3258, 754, -1269, -801, 1782, 3705, 2885, 171, -2587, -4809, -6042, -4966, -1676, 1143, 1273, -387, -1534, -1277, -417, -87, -623, -1218, -915, -114, -99, -919, -1145, -173, 655, 77, -1088, -1225, -389, 149, 353, 1158, 2115, 1905, 947, 675, 760, -7, -1098, -1287, -755, 43, 1405, 2662, 2325, 918, 386, 566, -209, -1467, -1314, -131, -26, -1185, -1622, -189, 2044, 3058, 1948, 38, -544, 161, 88, -1294, -2140, -1416, 200, 2360, 4230, 2916, -2630, -7951, -8067, -3747, 1126, 4680, 6047, 4064, 181, -1965, -1770, -1741, -2083, -396, 3238, 5699, 5311, 3377, 1621, 454, -575, -1708, -2057, -255, 3154, 5148, 3560, -77, -2504, -2635, -1973, -1775, -1438, 121, 2753, 5242, 6384, 5523, 2944, 142, -1285, -1354, -1342, -1609, -1164, 189, 924, -19, -1439, -1744, -1526, -2302, -3420, -2738, -355, 975, -300, -2452, -3011, -1631, 349, 1712, 1868, 717, -929, -1530, -384, 1338, 1956, 1266, 298, -444, -1313, -2216, -2315, -1445, -754, -1181, -2222, -2985, -3272, -2871, -1409, 153, 119, -1094, -1291, -168, 470, 241, 394, 779, 295, -234, 794, 2358, 1854, -872, -3114, -2689, -230, 1859, 2188, 1875, 2616, 3556, 2066, -2085, -5811, -6521, -4461, -1025, 2523, 4401, 3119, -552, -4130, -5682, -4697, -2002, 259, 351, -643, -11, 2490, 3880, 1927, -1922, -4398, -4006, -2089, -838, -886, -1164, -877, -709, -1551, -2873, -3301, -2319, -655, 624, 898, 353, -135, 7, 321, 185, -127, -127, -106, -512, -1031, -1042, -224, 1547, 3804, 4828, 2929, -1134, -4282, -4274, -1891, 443, 1313, 961, 159, -523, -615, 33, 774, 734, 97, 40, 932, 1606, 1332, 1248, 2311, 3103, 1825, -716, -2407, -2915, -3155, -2989, -1821, -373, 252, 332, 644, 727, -318, -1867, -2335, -1505, -505, 437, 2049, 3782, 4054, 2996, 2254, 1960, 665, -1628, -3055, -2476, -473, 1880, 3635, 3966, 2813, 1076, -440, -1676, -2628, -2785, -1699, 218, 1935, 2652, 2190, 865, -550, -1245, -1339, -1671, -1973, -662, 2477, 5002, 4581, 1709, -1387, -3067, -2910, -1580, -429, -28, 481, 1606, 2377, 1985, 924, -191, -1072, -914, 650, 2162, 2179, 1476, 1350, 1350, 719, -1, -473, -1344, -2444, -2544, -1489, -359, 432, 1209, 1791, 1850, 1558, 827, -773, -2583, -2957, -1529, 163, 877, 1056, 1423, 1470, 386, -1196, -1666, -747, -135, -1137, -2539, -1987, 847, 3651, 4196, 2772, 1288, 621, -18, -1098, -1757, -1409, -755, -215, 898, 2466, 2802, 1185, -717, -1274, -937, -808, -859, -526, 258, 1221, 2089, 2501, 2170, 1134, -446, -2386, -4000, -4040, -1867, 1342, 3353, 3120, 1719, 712, 342, -125, -952, -1605, -1554, -787, 343, 1360, 1765, 1231, -138, -1788, -3082, -3715, -3612, -2604, -632, 1649, 3076, 3098, 2238, 1165, -67, -1446, -2334, -2125, -1244, -680, -577, -106, 1083, 2040, 1638, 60, -1466, -2162, -2231, -1958, -1044, 739, 2640, 3314, 2180, 91, -1430, -1569, -888, -524, -641, -242, 1110, 2307, 2227, 1323, 699, 523, 390, 394, 849, 1604, 2296, 2737, 2786, 2367, 1615, 614, -622, -1628, -1607, -494, 822, 1609, 1916, 2045, 2084, 1901, 1151, -285, -1686, -2118, -1737, -1382, -1068, -244, 749, 1006, 514, -65, -542, -1005, -1177, -934, -749, -813, -583, 185, 649, 0, -1124, -1269, -147, 928, 694, -750, -2317, -2803, -1675, 183, 1065, 606, 269, 880, 1315, 618, -361, -651, -790, -1574, -2539, -2736, -2083, -1043, 230, 1542, 2001, 869, -1108, -2299, -2193, -1822, -2004, -2253, -1755, -612, 327, 521, 314, 453, 980, 1017, 10, -1289, -1686, -994, -62, 364, 214, -195, -402, 101, 1302, 2192, 1586, -321, -1993, -2390, -1840, -794, 944, 3112, 4356, 3668, 1613, -457, -1705, -1869, -877, 878, 2369, 2658, 1792, 574, -462, -1446, -2419, -2795, -2104, -919, -201, 51, 490, 895, 327, -1091, -1917, -1273, 104, 947, 764, 35, -282, 256, 788, -1, -1891, -3022, -2235, -511, 397, 50, -484, -190, 526, 355, -899, -1683, -950, 102, -59, -894, -1002, -526, -403, -391, 292, 1317, 1843, 1901, 1965, 1858, 1177, 324, 88, 416, 434, -248, -1065, -1372, -1027, -204, 574, 592, 39, 236, 1685, 2814, 2001, -109, -1571, -1559, -702, 197, 774, 855, 353, -582, -1450, -1677, -1294, -965, -808, 76, 1877, 2854, 1429, -1203, -2326, -1126, 749, 1683, 1599, 1067, 285, -674, -1317, -996, 190, 1130, 797, -457, -1340, -1247, -707, -274, 53, 386, 760, 1254, 1573, 1067, -138, -912, -769, -699, -1538, -2566, -2538, -1320, 124, 843, 662, 148, -179, -524, -1322, -2177, -2088, -892, 318, 559, 119, -100, 58, -7, -574, -1327, -2012, -2458, -2176, -983, 304, 849, 921, 1071, 1053, 606, 225, 185, -99, -822, -1058, -100, 1414, 2428, 2791, 2985, 3048, 2444, 889, -1171, -2935, -3718, -3166, -1428, 748, 2466, 3346, 3468, 2666, 589, -2159, -3815, -3243, -1303, 490, 1887, 3344, 4451, 4353, 3192, 1798, 391, -1267, -2781, -3143, -1943, 17, 1396, 1496, 746, 13, -394, -830, -1578, -2352, -2577, -1973, -811, 247, 661, 536, 521, 947, 1248, 565, -1007, -2163, -1592, 534, 2527, 2846, 1612, 39, -1182, -2060, -2268, -1333, 181, 1107, 1290, 1548, 2041, 1971, 1015, -87, -564, -458, -263, -241, -289, -125, 507, 1448, 1833, 865, -977, -2209, -2096, -1259, -350, 732, 1989, 2725, 2301, 838, -916, -2048, -2071, -1413, -890, -648, -283, 61, -289, -1314, -1991, -1545, -421, 296, 145, -308, -193, 735, 1839, 2166, 1371, 105, -633, -538, -40, 492, 918, 866, 65, -839, -850, -69, 398, 105, -131, 398, 1211, 1445, 1133, 950, 998, 693, -191, -1083, -1365, -1038, -522, -106, 361, 1251, 2420, 2922, 2027, 343, -786, -894, -667, -773, -1086, -1120, -670, 71, 786, 1348, 1736, 1638, 536, -1500, -3502, -4424, -3920, -2235, 29, 1963, 2952, 3236, 3238, 2706, 1301, -370, -1296, -1251, -639, 397, 1880, 3270, 3661, 2731, 1078, -461, -1485, -1968, -1845, -988, 445, 1926, 2923, 3218, 2808, 1879, 953, 519, 366, -120, -833, -948, -186, 867, 1766, 2465, 2681, 2150, 1357, 982, 940, 770, 368, -204, -932, -1499, -1584, -1565, -1972, -2437, -2147, -1122, -144, 343, 532, 649, 649, 366, -290, -1175, -1796, -1603, -579, 654, 1484, 1930, 2344, 2652, 2272, 902, -969, -2525, -3323, -3330, -2588, -1227, 318, 1533, 2217, 2374, 1832, 454, -1322, -2645, -2978, -2363, -1064, 560, 1872, 2168, 1359, 175, -572, -864, -1281, -1949, -2092, -1128, 219, 653, -23, -744, -711, -270, -144, -512, -1133, -1782, -2250, -2324, -2149, -2176, -2348, -1834, -209, 1617, 2440, 2248, 1818, 1305, 260, -1241, -2388, -2489, -1534, -15, 1411, 2235, 2369, 2107, 1755, 1299, 503, -716, -2037, -2884, -2796, -1717, -59, 1514, 2451, 2510, 1687, 194, -1427, -2456, -2471, -1596, -300, 895, 1619, 1788, 1533, 889, -260, -1763, -2928, -3010, -1949, -449, 709, 1123, 622, -710, -2178, -2784, -2253, -1229, -322, 402, 924, 1050, 808, 401, -190, -932, -1273, -707, 344, 865, 419, -398, -764, -528, -180, -48, 69, 335, 329, -388, -1441, -1984, -1757, -1149, -312, 964, 2433, 3150, 2516, 1067, -213, -966, -1325, -1193, -450, 445, 926, 1064, 1110, 826, 20, -861, -1355, -1510, -1349, -645, 383, 1004, 819, 112, -707, -1387, -1761, -1811, -1625, -1139, -230, 877, 1736, 2215, 2497, 2620, 2415, 1858, 1143, 424, -195, -476, -129, 743, 1555, 1718, 1140, 139, -900, -1614, -1639, -938, -100, 152, -125, -87, 770, 1813, 2015, 1198, 97, -577, -736, -625, -416, -206, -132, -252, -475, -674, -813, -871, -857, -907, -1164, -1500, -1603, -1391, -1086, -848, -575, -168, 216, 328, 102, -329, -783, -1009, -747, -69, 581, 880, 866, 559, -153, -969, -1133, -345, 748, 1315, 1177, 624, -167, -1157, -2107, -2495, -1903, -469, 1149, 2308, 2779, 2587, 1765, 511, -669, -1298, -1237, -583, 463, 1542, 2320, 2823, 3229, 3300, 2483, 785, -833, -1354, -747, 263, 1182, 1930, 2275, 1891, 902, -241, -1299, -2097, -2220, -1448, -140, 1158, 2067, 2250, 1659, 836, 309, -56, -429, -301, 760, 2142, 2754, 2254, 1123, -73, -989, -1354, -1038, -272, 464, 834, 788, 338, -594, -1938, -3186, -3692, -3308, -2496, -1771, -1201, -582, 95, 628, 943, 1155, 1126, 431, -932, -2105, -2122, -914, 756, 2098, 2728, 2631, 2015, 1008, -486, -2374, -3999, -4636, -4179, -2985, -1460, -157, 248, -394, -1475, -2253, -2396, -1961, -1277, -820, -692, -391, 538, 1765, 2469, 2270, 1572, 1079, 1152, 1615, 2042, 2197, 2099, 1813, 1308, 638, 106, 62, 475, 949, 1173, 1213, 1198, 1050, 705, 309, -10, -355, -815, -1167, -1055, -334, 792, 1864, 2437, 2374, 1832, 986, -23, -908, -1252, -850, 163, 1473, 2667, 3266, 2923, 1679, -85, -1898, -3310, -3949, -3626, -2447, -826, 636, 1407, 1309, 595, -274, -892, -1040, -805, -504, -308, -96, 164, 236, 13, -271, -506, -859, -1287, -1488, -1468, -1580, -1827, -1783, -1331, -910, -822, -780, -410, 116, 306, 60, -176, -73, 109, -43, -417, -542, -355, -283, -487, -528, -33, 720, 1116, 833, 35, -864, -1478, -1594, -1175, -343, 511, 841, 549, 211, 277, 463, 390, 369, 837, 1443, 1443, 783, 204, 353, 1226, 2366, 3286, 3636, 3178, 1880, 121, -1355, -1936, -1635, -1020, -567, -172, 464, 1116, 1170, 552, -121, -457, -637, -761, -654, -462, -610, -1014, -1141, -834, -418, -73, 277, 516, 327, -365, -1276, -2053, -2456, -2271, -1371, 24, 1308, 1876, 1478, 259, -1327, -2590, -2997, -2560, -1646, -557, 501, 1308, 1811, 2120, 2121, 1615, 849, 340, 194, 205, 376, 706, 833, 549, 218, 152, 102, -201, -578, -760, -750, -652, -552, -560, -590, -275, 540, 1353, 1507, 1075, 814, 1167, 1762, 2041, 1998, 1934, 1799, 1276, 401, -322, -512, -195, 508, 1536, 2480, 2681, 2031, 1126, 343, -472, -1222, -1391, -901, -239, 321, 810, 1019, 748, 375, 394, 613, 516, 172, 112, 483, 891, 1054, 1111, 1137, 888, 281, -286, -451, -416, -589, -951, -1144, -1058, -921, -846, -706, -497, -446, -639, -867, -987, -1102, -1309, -1497, -1501, -1207, -572, 230, 781, 776, 474, 397, 545, 380, -173, -418, -4, 468, 499, 395, 399, 171, -356, -716, -866, -1261, -1794, -1793, -1167, -557, -336, -268, -113, 109, 408, 869, 1437, 1883, 2045, 1952, 1704, 1348, 965, 759, 858, 1028, 891, 494, 309, 475, 501, 22, -663, -1152, -1424, -1514, -1324, -998, -801, -608, -197, 181, 226, 204, 445, 738, 804, 788, 811, 706, 449, 254, 164, 83, 87, 251, 372, 273, 90, -18, -103, -238, -402, -588, -716, -596, -224, 64, 16, -212, -387, -578, -967, -1427, -1585, -1280, -731, -242, 102, 394, 662, 811, 717, 366, -36, -222, -215, -315, -585, -724, -608, -520, -654, -855, -996, -1161, -1346, -1433, -1441, -1422, -1230, -750, -147, 327, 576, 573, 361, 171, 236, 465, 580, 485, 273, -3, -347, -694, -932, -950, -677, -228, 72, -15, -366, -659, -713, -546, -259, 51, 310, 479, 500, 295, -56, -239, -15, 485, 910, 1063, 1024, 961, 900, 702, 281, -157, -256, 71, 521, 754, 650, 207, -473, -1076, -1241, -991, -724, -666, -593, -249, 175, 262, -66, -471, -661, -629, -447, -95, 368, 704, 739, 578, 410, 238, -36, -363, -612, -780, -894, -846, -581, -300, -239, -358, -464, -489, -476, -486, -567, -700, -743, -564, -226, 95, 296, 360, 316, 276, 354, 538, 713, 811, 827, 774, 701, 650, 534, 273, 0, -113, -144, -239, -292, -195, -165, -422, -789, -926, -786, -535, -303, -139, -22, 161, 432, 615, 602, 580, 750, 1021, 1167, 1119, 965, 811, 734, 742, 732, 585, 353, 204, 174, 61, -288, -729, -969, -914, -691, -424, -178, -59, -180, -468, -702, -755, -685, -537, -250, 159, 501, 607, 512, 306, 14, -282, -389, -222, 25, 104, -17, -208, -389, -549, -619, -516, -303, -100, 91, 327, 488, 417, 192, 14, -48, -40, 32, 132, 141, 44, -26, -29, -58, -128, -111, 3, 17, -190, -438, -453, -241, -55, -28, -22, 98, 236, 225, 87, -10, -10, 25, 91, 230, 393, 489, 560, 694, 818, 779, 588, 395, 263, 134, -18, -118, -63, 130, 274, 189, -37, -140, -58, -21, -164, -303, -206, 99, 427, 617, 596, 384, 115, -45, -39, 61, 168, 252, 339, 426, 419, 222, -95, -355, -493, -593, -662, -578, -343, -149, -140, -244, -333, -394, -460, -504, -491, -433, -341, -167, 117, 405, 541, 501, 394, 293, 175, 32, -51, -8, 94, 145, 128, 110, 101, 44, -78, -234, -372, -442, -405, -261, -70, 104, 227, 269, 203, 72, -19, -23, -4, -33, -55, 32, 218, 395, 490, 475, 321, 75, -125, -216, -271, -308, -228, -18, 178, 243, 185, 57, -84, -164, -154, -139, -179, -212, -155, -23, 116, 212, 248, 225, 174, 124, 76, 24, -22, -36, -6, 71, 171, 248, 254, 188, 91, -8, -106, -182, -183, -99, -1, 20, -28, -55, -15, 39, 49, 28, 24, 25, 10, 16, 87, 167, 150, 36, -62, -74, -44, -45, -74, -78, -34, 25, 61, 58, 17, -54, -133, -195, -212, -157, -39, 80, 152, 179, 177, 119, 21, -34, -26, -28, -78, -96, -6, 123, 175, 145, 108, 84, 35, -44, -95, -103, -99, -84, -36, 9, 9, 2, 36, 60, 24, -7, 29, 79, 58, -3, -32, -18, 0, 13, 39, 73, 87, 76, 60, 46, 27, 2, -15, -28, -34, -25, 7, 36, 35, 10, -10, -15, -10, 0, 6, 10, 21, 32, 21, -12, -37, -25, 2, 11, 5, 5, 16, 24, 20, 11, 3, -11, -29, -33, -23, -14, -7, 0, 3, 0, -1, 2, 5, -4, -12, -11, -8, -7, -6, -3, -4, -7, -7, -1, 0, -3, -4, -3, -3, -6, -10, -7, 3, 13, 11, 2, -4, 0, 0, -3, -8, -4, 3, 2, -8, -12, -6, -1, -7, -14, -14, -8, -7, -11, -15, -15, -11, -8, -11, -14, -12, -7, -4, -4, -8, -10, -8, -7, -7, -8, -8, -8, -7, -4, -3, -6, -11, -14, -12, -7, -4, -3, -4, -6, -6, -8, -11, -10, -6, -3, -6, -7, -3, 0, -3, -6, -6, -3, -4, -7, -7, -4, -1, -1, -4, -4, -4, -4, -6, -4, -3, -1, -3, -4, -1, 2, 2, 0, -1, -1, 0, 0, 2, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 2, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 3, 2, -1, -3, -1, 0, -1, -1, 0, 0, 0, 2, 2, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -3, -3, -3, -3, -3, -1, -1, -1, 0, 0, -1, -3, 0, 2, 2, 0, -3, -3, -1, 0, -1, -3, -3, 0, 0, 0, -1, -1, -1, -1, -3, -1, 0, 2, 0, -3, -3, -1, 0, 0, 0, 0, 0, 0, 0, -1, -3, -3, -1, 0, 0, 0, -1, -3, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 3, 3, 0, 0, 2, 2, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, -3, -1, 2, 3, 0, -1, 0, 2, 3, 2, -1, -3 };
+// IMA ADPCM blocks, see audio_adpcm.h
+static const uint8_t __in_flash("audio_lost_sample_data") audio_lost_sample_data[] = { 0, 0, 0, 0, 135, 26, 36, 170, 34, 176, 27, 1, 17, 169, 2, 154, 1, 16, 1, 16, 35, 17, 17, 3, 0, 9, 33, 144, 41, 144, 153, 185, 16, 17, 10, 1, 0, 153, 154, 9, 144, 144, 153, 32, 160, 169, 17, 145, 186, 16, 160, 169, 0, 0, 170, 25, 144, 10, 169, 154, 0, 145, 154, 33, 177, 141, 17, 152, 153, 25, 2, 171, 48, 145, 25, 146, 140, 16, 1, 145, 169, 2, 10, 50, 146, 154, 25, 25, 19, 186, 32, 145, 153, 25, 34, 201, 153, 65, 145, 140, 49, 185, 49, 132, 203, 16, 147, 25, 35, 217, 25, 4, 155, 65, 137, 144, 25, 4, 152, 187, 73, 50, 145, 157, 34, 232, 26, 34, 169, 57, 37, 1, 200, 9, 51, 177, 12, 2, 25, 192, 73, 6, 186, 11, 36, 160, 8, 184, 155, 65, 3, 172, 115, 128, 138, 9, 64, 176, 42, 23, 144, 137, 128, 144, 65, 176, 140, 50, 1, 185, 141, 34, 233, 72, 19, 170, 2, 250, 8, 2, 32, 2, 25, 178, 157, 33, 17, 219, 96, 148, 156, 129, 154, 51, 153, 129, 11, 19, 43, 19, 171, 49, 19, 249, 138, 17, 153, 128, 48, 177, 73, 192, 29, 52, 233, 41, 161, 42, 226, 42, 145, 41, 249, 40, 160, 137, 153, 8, 18, 249, 43, 163, 26, 132, 203, 56, 20, 154, 50, 203, 137, 84, 177, 27, 129, 105, 2, 138, 0, 26, 162, 140, 53, 202, 65, 152, 115, 201, 64, 145, 25, 128, 114, 145, 57, 131, 113, 145, 56, 3, 49, 177, 104, 132, 187, 219, 12, 144, 189, 204, 155, 2, 239, 170, 169, 138, 0, 137, 152, 152, 137, 83, 17, 84, 69, 34, 16, 69, 33, 50, 35, 68, 36, 19, 32, 52, 52, 4, 0, 51, 18, 34, 136, 99, 129, 32, 177, 12, 130, 56, 227, 157, 19, 169, 168, 174, 0, 251, 9, 185, 155, 186, 219, 205, 169, 219, 154, 201, 187, 188, 187, 219, 172, 171, 172, 202, 187, 185, 219, 171, 187, 185, 236, 10, 160, 171, 152, 138, 1, 204, 24, 169, 33, 16, 70, 144, 72, 50, 35, 136, 86, 1, 33, 66, 36, 0, 68, 18, 82, 130, 80, 21, 0, 34, 32, 53, 0, 65, 33, 35, 2, 33, 51, 21, 169, 64, 131, 173, 56, 35, 218, 174, 9, 217, 154, 153, 202, 172, 169, 203, 203, 172, 185, 170, 169, 220, 157, 16, 153, 186, 156, 18, 185, 58, 6, 203, 26, 81, 21, 185, 56, 53, 2, 186, 112, 53, 152, 25, 66, 21, 186, 72, 51, 34, 153, 114, 4, 137, 66, 2, 49, 19, 51, 162, 88, 38, 66, 130, 40, 38, 128, 32, 34, 50, 160, 64, 38, 2, 152, 56, 37, 200, 41, 37, 129, 202, 73, 162, 158, 16, 136, 169, 171, 169, 251, 188, 154, 153, 220, 155, 185, 155, 236, 155, 136, 204, 172, 8, 184, 189, 171, 24, 251, 140, 136, 136, 202, 9, 168, 168, 156, 16, 128, 152, 26, 19, 200, 251, 12, 0, 26, 23, 9, 38, 136, 66, 0, 67, 2, 67, 20, 1, 82, 53, 1, 25, 84, 18, 40, 83, 129, 33, 35, 18, 8, 117, 129, 40, 1, 65, 132, 139, 34, 152, 81, 38, 144, 24, 51, 193, 175, 32, 160, 189, 154, 145, 255, 9, 160, 190, 156, 153, 219, 138, 128, 153, 235, 153, 128, 16, 0, 69, 18, 17, 52, 53, 19, 84, 51, 68, 18, 32, 53, 51, 18, 49, 38, 34, 34, 48, 38, 2, 16, 34, 2, 33, 36, 18, 176, 48, 132, 187, 219, 8, 217, 172, 217, 172, 185, 205, 187, 188, 170, 189, 187, 220, 186, 187, 203, 188, 187, 203, 187, 189, 171, 186, 204, 171, 170, 188, 171, 137, 235, 155, 137, 153, 187, 9, 144, 168, 157, 66, 131, 10, 37, 34, 50, 65, 54, 50, 53, 33, 37, 18, 49, 83, 53, 36, 17, 49, 53, 35, 50, 84, 51, 19, 49, 53, 51, 34, 83, 50, 129, 9, 34, 16, 200, 172, 176, 191, 186, 205, 185, 204, 169, 202, 187, 188, 187, 203, 172, 186, 186, 187, 219, 138, 186, 172, 153, 136, 186, 140, 1, 152, 11, 18, 140, 52, 113, 37, 137, 65, 51, 53, 34, 70, 34, 50, 36, 83, 36, 49, 53, 18, 51, 52, 67, 67, 51, 1, 50, 37, 1, 50, 67, 18, 144, 48, 132, 10, 2, 155, 51, 204, 1, 253, 9, 129, 184, 156, 33, 250, 187, 188, 24, 208, 171, 152, 202, 204, 154, 152, 219, 10, 161, 172, 0, 49, 160, 113, 5, 65, 36, 49, 39, 50, 35, 67, 68, 50, 51, 66, 53, 17, 67, 17, 67, 129, 83, 2, 32, 1, 64, 4, 0, 0, 33, 3, 24, 3, 155, 53, 217, 25, 145, 154, 251, 187, 203, 172, 170, 235, 204, 170, 219, 156, 137, 169, 186, 191, 137, 153, 154, 10, 136, 203, 154, 9, 194, 174, 17, 201, 24, 184, 10, 184, 173, 203, 8, 250, 10, 2, 170, 0, 218, 113, 162, 140, 168, 41, 148, 139, 54, 249, 172, 219, 10, 129, 187, 137, 16, 250, 174, 137, 16, 18, 202, 138, 18, 217, 172, 48, 36, 185, 155, 50, 176, 158, 82, 130, 137, 0, 17, 128, 113, 2, 32, 54, 129, 97, 19, 33, 34, 85, 34, 49, 19, 83, 2, 50, 20, 34, 20, 17, 145, 187, 16, 129, 138, 184, 207, 219, 188, 187, 173, 154, 219, 187, 203, 204, 171, 186, 204, 170, 203, 188, 170, 186, 189, 186, 188, 170, 173, 170, 187, 138, 188, 24, 234, 171, 171, 32, 145, 18, 253, 40, 160, 11, 2, 137, 34, 81, 131, 10, 70, 33, 68, 33, 83, 2, 49, 68, 36, 1, 65, 36, 8, 51, 36, 18, 33, 54, 144, 32, 0, 66, 128, 66, 201, 41, 200, 42, 193, 12, 4, 218, 169, 171, 152, 189, 40, 224, 171, 185, 139, 145, 154, 144, 171, 65, 248, 90, 5, 56, 21, 138, 67, 0, 50, 128, 100, 145, 66, 193, 10, 177, 44, 71, 52, 2, 186, 24, 54, 252, 32, 0, 68, 52, 67, 36, 18, 51, 36, 66, 52, 50, 36, 17, 68, 17, 18, 136, 35, 152, 65, 146, 171, 235, 11, 146, 207, 152, 170, 185, 173, 186, 186, 218, 172, 185, 174, 153, 170, 170, 189, 153, 0, 184, 141, 19, 235, 10, 0, 17, 0, 50, 184, 43, 19, 8, 24, 119, 20, 33, 184, 27, 55, 34, 68, 34, 18, 169, 40, 160, 97, 35, 100, 130, 154, 154, 8, 130, 72, 23, 170, 186, 171, 160, 156, 128, 153, 253, 159, 144, 137, 17, 186, 138, 189, 26, 152, 16, 2, 2, 237, 138, 168, 48, 19, 40, 70, 130, 234, 187, 56, 55, 2, 152, 154, 8, 152, 16, 84, 52, 33, 16, 40, 54, 51, 36, 185, 153, 41, 133, 223, 153, 186, 205, 220, 154, 136, 136, 202, 187, 170, 170, 153, 9, 51, 53, 128, 80, 34, 100, 68, 50, 34, 67, 35, 69, 35, 65, 51, 35, 36, 51, 68, 35, 33, 51, 52, 34, 49, 53, 0, 50, 128, 49, 145, 32, 233, 25, 250, 157, 153, 187, 190, 170, 203, 203, 204, 186, 188, 203, 187, 188, 188, 187, 189, 188, 186, 187, 188, 203, 203, 171, 186, 171, 202, 188, 153, 153, 186, 154, 128, 203, 9, 17, 128, 17, 52, 216, 27, 147, 89, 23, 137, 0, 8, 130, 187, 115, 36, 17, 1, 52, 50, 100, 51, 68, 50, 67, 67, 34, 98, 53, 2, 17, 49, 68, 1, 34, 19, 34, 18, 67, 1, 137, 32, 2, 153, 219, 173, 218, 10, 161, 159, 130, 138, 20, 220, 24, 17, 34, 185, 72, 160, 72, 3, 41, 147, 112, 22, 137, 137, 82, 130, 25, 2, 56, 4, 112, 23, 8, 0, 81, 130, 42, 55, 129, 8, 49, 53, 33, 18, 33, 67, 17, 49, 70, 1, 32, 35, 0, 33, 128, 203, 112, 6, 187, 65, 177, 156, 136, 9, 50, 177, 207, 10, 128, 24, 146, 204, 138, 35, 251, 43, 3, 186, 172, 65, 216, 57, 194, 12, 128, 139, 19, 40, 3, 42, 181, 175, 51, 168, 186, 73, 39, 201, 25, 66, 36, 129, 154, 66, 176, 73, 38, 144, 139, 1, 171, 189, 104, 20, 129, 171, 8, 233, 10, 17, 168, 138, 219, 10, 193, 158, 1, 153, 169, 187, 170, 56, 39, 235, 155, 169, 155, 48, 1, 169, 206, 170, 187, 32, 2, 0, 200, 207, 154, 48, 34, 18, 208, 189, 153, 24, 100, 1, 25, 2, 218, 10, 115, 20, 136, 66, 129, 171, 41, 54, 209, 156, 0, 144, 236, 172, 171, 138, 169, 172, 136, 17, 217, 172, 40, 68, 129, 66, 37, 17, 35, 81, 36, 2, 67, 53, 18, 17, 83, 35, 17, 18, 50, 69, 34, 17, 34, 19, 17, 51, 1, 70, 35, 152, 171, 153, 153, 251, 173, 152, 251, 171, 185, 191, 138, 202, 188, 171, 202, 204, 170, 203, 171, 186, 188, 188, 187, 203, 187, 170, 171, 203, 203, 171, 153, 187, 48, 22, 185, 154, 40, 68, 19, 66, 53, 34, 34, 103, 211, 36, 0, 49, 52, 67, 70, 35, 34, 50, 2, 40, 86, 50, 51, 36, 1, 8, 18, 68, 36, 17, 34, 168, 40, 146, 41, 55, 144, 152, 221, 10, 35, 217, 156, 8, 202, 9, 217, 139, 200, 139, 146, 173, 0, 187, 137, 16, 131, 157, 114, 130, 40, 34, 68, 18, 83, 3, 10, 100, 19, 1, 49, 34, 136, 64, 87, 19, 137, 82, 34, 51, 176, 106, 55, 129, 137, 83, 19, 153, 49, 53, 3, 153, 66, 130, 153, 24, 50, 145, 136, 251, 174, 9, 129, 154, 129, 251, 153, 137, 129, 206, 9, 1, 218, 11, 35, 154, 17, 252, 171, 48, 2, 138, 18, 220, 170, 188, 64, 36, 128, 8, 160, 205, 57, 53, 34, 51, 145, 154, 32, 86, 35, 1, 17, 70, 129, 24, 34, 48, 2, 201, 190, 113, 4, 152, 185, 136, 184, 41, 130, 40, 55, 200, 206, 154, 56, 36, 200, 154, 8, 144, 190, 26, 52, 145, 156, 0, 186, 32, 35, 250, 139, 18, 16, 1, 251, 172, 32, 145, 186, 57, 87, 160, 170, 10, 50, 217, 58, 39, 152, 170, 137, 136, 16, 83, 36, 152, 185, 191, 65, 19, 186, 156, 185, 205, 169, 154, 200, 255, 171, 137, 17, 33, 51, 145, 153, 41, 71, 69, 52, 35, 34, 1, 0, 65, 55, 17, 128, 136, 128, 169, 187, 9, 129, 239, 171, 137, 153, 154, 169, 205, 171, 153, 0, 0, 185, 171, 192, 207, 154, 24, 3, 202, 204, 155, 168, 204, 153, 136, 184, 174, 153, 154, 0, 136, 128, 9, 136, 114, 22, 34, 51, 17, 51, 67, 51, 102, 35, 0, 136, 49, 18, 0, 83, 35, 144, 154, 202, 25, 18, 84, 192, 155, 176, 223, 138, 0, 185, 155, 251, 174, 155, 136, 154, 152, 190, 9, 168, 187, 155, 115, 22, 136, 154, 64, 69, 3, 152, 48, 68, 2, 136, 82, 34, 33, 168, 41, 20, 16, 0, 184, 156, 33, 208, 189, 56, 131, 190, 171, 154, 67, 3, 220, 155, 24, 2, 144, 185, 170, 48, 224, 140, 0, 56, 5, 205, 42, 85, 1, 153, 128, 0, 99, 52, 2, 24, 17, 34, 129, 48, 55, 19, 154, 115, 130, 170, 64, 130, 155, 100, 35, 202, 140, 33, 1, 33, 177, 189, 152, 170, 24, 184, 121, 4, 220, 155, 41, 21, 169, 24, 216, 26, 37, 129, 184, 139, 68, 129, 128, 10, 54, 160, 56, 5, 172, 32, 53, 146, 171, 64, 34, 18, 136, 115, 146, 9, 98, 52, 130, 153, 186, 172, 136, 99, 145, 172, 220, 171, 8, 154, 9, 128, 9, 176, 156, 0, 153, 254, 140, 68, 160, 187, 173, 16, 176, 190, 172, 137, 16, 68, 52, 51, 19, 50, 68, 85, 52, 50, 3, 136, 0, 18, 168, 171, 137, 251, 191, 172, 186, 170, 204, 171, 171, 171, 203, 171, 168, 154, 169, 137, 17, 49, 85, 35, 1, 0, 49, 69, 17, 50, 50, 19, 217, 154, 137, 67, 128, 98, 2, 169, 8, 50, 20, 80, 50, 238, 37, 0, 55, 146, 153, 66, 35, 17, 201, 172, 152, 24, 2, 128, 237, 153, 251, 172, 24, 17, 33, 162, 189, 0, 152, 25, 50, 18, 145, 190, 235, 173, 8, 137, 186, 174, 25, 2, 186, 89, 53, 51, 35, 83, 54, 84, 34, 17, 34, 50, 36, 136, 17, 0, 33, 251, 173, 185, 170, 218, 171, 169, 204, 171, 185, 155, 137, 49, 208, 59, 23, 137, 51, 128, 53, 129, 81, 130, 66, 35, 137, 68, 128, 99, 129, 56, 20, 49, 36, 128, 32, 160, 115, 130, 115, 2, 136, 201, 10, 33, 17, 51, 18, 160, 255, 171, 65, 2, 144, 171, 50, 201, 48, 146, 152, 204, 114, 146, 10, 52, 35, 250, 15, 49, 18, 129, 186, 8, 0, 136, 136, 128, 80, 21, 186, 154, 88, 39, 1, 136, 48, 38, 160, 138, 82, 52, 249, 139, 17, 35, 234, 10, 1, 153, 144, 153, 136, 32, 36, 218, 171, 56, 103, 160, 171, 49, 67, 160, 140, 34, 137, 169, 154, 250, 188, 137, 137, 137, 154, 154, 255, 171, 64, 52, 145, 187, 154, 34, 2, 145, 189, 97, 145, 24, 250, 141, 136, 153, 9, 117, 53, 17, 136, 24, 82, 35, 66, 67, 19, 168, 137, 160, 173, 137, 169, 204, 205, 187, 203, 203, 187, 170, 169, 187, 187, 153, 168, 170, 48, 70, 52, 36, 51, 53, 18, 50, 20, 50, 37, 49, 20, 168, 137, 0, 168, 171, 9, 2, 184, 255, 154, 152, 153, 186, 42, 35, 234, 188, 153, 185, 156, 137, 202, 170, 205, 138, 153, 168, 173, 48, 145, 172, 82, 20, 33, 17, 49, 53, 1, 49, 53, 160, 173, 0, 251, 156, 137, 153, 203, 171, 219, 155, 153, 24, 69, 130, 48, 36, 49, 70, 50, 52, 50, 20, 0, 18, 154, 115, 129, 202, 188, 153, 170, 154, 186, 221, 10, 201, 140, 33, 34, 146, 172, 9, 83, 68, 1, 40, 34, 115, 2, 9, 32, 69, 20, 18, 0, 32, 52, 129, 9, 71, 1, 8, 168, 8, 33, 65, 4, 221, 10, 128, 128, 169, 82, 17, 16, 250, 9, 67, 36, 161, 137, 137, 97, 130, 137, 0, 128, 217, 72, 148, 140, 2, 0, 130, 156, 35, 128, 178, 191, 69, 2, 128, 172, 50, 2, 50, 130, 64, 145, 137, 48, 36, 32, 119, 1, 154, 10, 67, 160, 153, 9, 51, 192, 255, 170, 168, 155, 168, 172, 168, 188, 189, 155, 152, 27, 39, 184, 137, 65, 4, 169, 49, 18, 55, 160, 56, 132, 152, 168, 203, 205, 24, 176, 189, 204, 138, 185, 156, 128, 128, 220, 10, 130, 25, 52, 1, 128, 138, 51, 115, 23, 234, 25, 145, 153, 185, 255, 187, 9, 18, 51, 83, 34, 33, 2, 114, 87, 35, 34, 34, 17, 18, 34, 34, 18, 160, 186, 236, 190, 173, 170, 187, 202, 187, 172, 171, 188, 139, 136, 137, 16, 50, 53, 52, 36, 34, 50, 69, 50, 52, 18, 0, 168, 186, 138, 0, 18, 192, 207, 187, 171, 154, 160, 1, 46, 0, 137, 32, 19, 128, 204, 156, 153, 138, 16, 201, 205, 202, 204, 188, 203, 187, 186, 203, 171, 153, 218, 155, 32, 18, 82, 53, 68, 50, 50, 50, 83, 18, 17, 128, 137, 184, 221, 205, 170, 187, 172, 170, 187, 154, 8, 128, 8, 32, 103, 35, 33, 84, 36, 2, 0, 2, 136, 1, 8, 152, 203, 218, 204, 185, 188, 25, 2, 16, 35, 100, 18, 33, 66, 102, 35, 32, 34, 17, 18, 33, 35, 34, 130, 40, 37, 251, 173, 24, 161, 156, 65, 130, 156, 152, 139, 36, 32, 54, 34, 160, 58, 71, 1, 34, 1, 84, 129, 24, 67, 50, 161, 57, 133, 154, 84, 162, 155, 81, 161, 171, 202, 11, 53, 176, 9, 144, 251, 156, 49, 2, 56, 52, 168, 174, 9, 51, 18, 201, 12, 55, 161, 11, 2, 188, 48, 38, 0, 33, 184, 140, 152, 138, 17, 32, 162, 223, 152, 235, 138, 184, 188, 8, 217, 157, 137, 154, 170, 171, 40, 68, 128, 152, 64, 22, 128, 18, 33, 185, 40, 220, 49, 251, 188, 205, 153, 171, 136, 185, 219, 204, 155, 16, 1, 17, 49, 68, 36, 202, 112, 21, 0, 17, 35, 145, 186, 26, 21, 170, 66, 216, 188, 174, 10, 136, 218, 140, 35, 234, 170, 9, 50, 128, 153, 9, 36, 0, 34, 251, 191, 155, 25, 50, 100, 36, 18, 128, 41, 101, 52, 53, 34, 2, 1, 17, 17, 50, 51, 2, 252, 188, 172, 187, 187, 188, 187, 204, 203, 186, 170, 154, 8, 17, 137, 81, 68, 35, 33, 51, 53, 52, 34, 67, 19, 1, 169, 172, 171, 48, 36, 144, 222, 171, 171, 155, 9, 68, 35, 153, 188, 187, 169, 16, 2, 8, 185, 255, 188, 172, 138, 168, 154, 186, 170, 218, 153, 9, 67, 17, 71, 50, 34, 33, 67, 36, 19, 0, 0, 128, 203, 203, 221, 187, 188, 155, 186, 188, 170, 137, 168, 156, 84, 36, 18, 16, 99, 35, 50, 17, 67, 145, 154, 202, 172, 203, 155, 185, 206, 187, 171, 136, 16, 51, 70, 51, 19, 66, 52, 68, 68, 50, 18, 129, 8, 16, 50, 145, 56, 164, 174, 169, 26, 36, 169, 155, 82, 21, 49, 53, 67, 176, 58, 22, 202, 10, 82, 36, 185, 154, 49, 250, 175, 49, 52, 2, 8, 2, 144, 48, 71, 51, 35, 33, 52, 160, 172, 56, 36, 128, 152, 153, 221, 173, 155, 136, 152, 155, 32, 200, 188, 138, 34, 128, 65, 53, 33, 67, 18, 52, 145, 24, 130, 16, 115, 35, 32, 240, 174, 169, 154, 16, 50, 176, 173, 218, 187, 204, 56, 22, 152, 153, 9, 152, 204, 138, 8, 33, 34, 162, 238, 189, 40, 35, 153, 9, 35, 208, 189, 138, 48, 3, 188, 153, 233, 204, 153, 152, 219, 171, 153, 172, 168, 40, 3, 220, 173, 82, 35, 18, 34, 36, 17, 0, 115, 21, 16, 145, 172, 136, 153, 8, 250, 174, 9, 128, 188, 156, 16, 16, 160, 189, 82, 35, 119, 241, 47, 0, 128, 171, 24, 86, 19, 218, 205, 171, 9, 152, 26, 69, 51, 176, 159, 65, 68, 51, 52, 34, 34, 50, 50, 83, 51, 51, 129, 235, 204, 170, 170, 204, 187, 203, 202, 172, 187, 155, 154, 138, 152, 0, 33, 83, 68, 17, 66, 52, 51, 51, 53, 18, 17, 184, 138, 8, 67, 146, 218, 204, 203, 171, 154, 40, 49, 19, 221, 154, 170, 24, 144, 24, 35, 251, 191, 170, 203, 171, 137, 218, 187, 169, 156, 185, 138, 169, 115, 21, 51, 35, 34, 67, 36, 32, 84, 35, 129, 201, 188, 171, 186, 204, 203, 170, 187, 220, 187, 154, 0, 0, 82, 36, 17, 35, 51, 67, 85, 37, 17, 129, 9, 8, 185, 186, 138, 2, 191, 187, 189, 137, 219, 32, 130, 82, 19, 34, 2, 82, 35, 115, 21, 17, 17, 152, 136, 18, 144, 153, 41, 39, 201, 25, 161, 13, 35, 72, 39, 136, 67, 128, 65, 192, 26, 129, 10, 130, 158, 146, 223, 8, 169, 137, 32, 85, 35, 152, 40, 52, 84, 35, 50, 37, 34, 18, 136, 17, 169, 32, 161, 204, 206, 187, 187, 190, 153, 169, 171, 171, 153, 185, 140, 67, 50, 55, 17, 67, 35, 67, 19, 50, 37, 0, 0, 130, 169, 25, 177, 239, 154, 136, 170, 138, 185, 172, 170, 171, 1, 218, 155, 56, 3, 187, 82, 251, 26, 129, 25, 146, 141, 144, 191, 155, 8, 34, 185, 203, 191, 137, 16, 1, 169, 16, 253, 159, 17, 184, 25, 177, 190, 154, 136, 234, 188, 153, 48, 162, 191, 33, 145, 170, 204, 112, 19, 136, 83, 129, 9, 50, 130, 155, 84, 51, 18, 217, 139, 128, 221, 171, 16, 34, 161, 175, 154, 203, 186, 10, 69, 160, 9, 168, 186, 255, 157, 153, 136, 16, 50, 18, 128, 219, 104, 54, 53, 36, 34, 35, 35, 34, 83, 51, 35, 18, 160, 203, 190, 188, 188, 187, 171, 188, 205, 203, 186, 153, 153, 136, 1, 34, 17, 17, 69, 67, 35, 67, 53, 51, 17, 129, 152, 155, 137, 128, 136, 219, 221, 202, 188, 154, 137, 33, 0, 16, 168, 170, 190, 32, 51, 38, 152, 0, 237, 171, 186, 154, 185, 186, 187, 202, 206, 170, 137, 66, 67, 50, 17, 68, 17, 16, 49, 68, 18, 152, 234, 188, 187, 205, 187, 187, 170, 202, 205, 170, 169, 136, 17, 67, 52, 67, 18, 33, 69, 51, 53, 3, 32, 20, 186, 187, 156, 128, 136, 208, 205, 186, 155, 154, 40, 36, 68, 146, 40, 3, 104, 37, 32, 37, 1, 0, 144, 170, 48, 19, 204, 10, 33, 233, 155, 1, 48, 55, 16, 17, 33, 103, 34, 33, 129, 26, 67, 16, 50, 168, 0, 236, 170, 185, 188, 173, 97, 19, 186, 188, 171, 113, 38, 18, 1, 8, 49, 2, 8, 117, 36, 1, 137, 153, 171, 48, 20, 144, 203, 137, 234, 173, 138, 137, 17, 129, 137, 202, 158, 48, 1, 50, 51, 115, 129, 24, 2, 187, 80, 33, 159, 20, 40, 0, 69, 176, 138, 217, 10, 200, 138, 146, 155, 36, 251, 156, 169, 8, 168, 25, 1, 33, 176, 171, 250, 139, 18, 115, 19, 136, 161, 190, 8, 152, 49, 0, 116, 177, 156, 129, 187, 128, 139, 53, 233, 203, 188, 136, 204, 96, 146, 9, 161, 141, 17, 138, 98, 35, 144, 187, 169, 73, 21, 186, 56, 2, 202, 222, 172, 40, 18, 50, 130, 10, 71, 144, 155, 98, 69, 34, 152, 154, 16, 0, 234, 10, 51, 130, 236, 188, 153, 154, 186, 156, 17, 0, 234, 173, 187, 155, 137, 81, 68, 83, 18, 0, 17, 113, 84, 50, 51, 34, 34, 17, 17, 49, 52, 19, 160, 221, 203, 203, 172, 172, 154, 170, 186, 205, 186, 171, 138, 136, 8, 35, 18, 67, 18, 81, 53, 49, 68, 51, 36, 2, 152, 169, 137, 33, 33, 19, 234, 188, 206, 170, 153, 24, 1, 136, 184, 206, 187, 171, 8, 0, 33, 249, 172, 219, 170, 153, 9, 0, 153, 137, 144, 153, 40, 85, 70, 51, 35, 34, 50, 131, 136, 129, 25, 240, 206, 188, 189, 171, 203, 203, 170, 170, 169, 188, 137, 16, 84, 35, 67, 67, 68, 18, 33, 67, 66, 35, 128, 128, 187, 170, 189, 170, 203, 189, 204, 171, 154, 186, 8, 17, 82, 3, 32, 1, 114, 23, 17, 19, 24, 20, 169, 17, 186, 65, 201, 48, 216, 10, 160, 172, 17, 81, 36, 32, 70, 129, 32, 17, 48, 37, 50, 38, 129, 17, 185, 173, 153, 48, 147, 156, 177, 206, 172, 170, 169, 139, 49, 69, 51, 17, 101, 18, 65, 53, 34, 35, 84, 51, 129, 153, 57, 21, 152, 152, 187, 66, 233, 173, 188, 138, 24, 18, 168, 153, 217, 171, 16, 48, 71, 17, 1, 9, 35, 184, 138, 116, 3, 8, 136, 24, 168, 170, 205, 170, 48, 52, 130, 237, 25, 145, 138, 137, 98, 129, 40, 20, 202, 203, 204, 10, 136, 40, 147, 207, 152, 203, 9, 169, 115, 19, 136, 169, 138, 33, 84, 4, 153, 0, 24, 36, 160, 220, 154, 219, 137, 129, 16, 178, 207, 9, 144, 155, 18, 155, 87, 160, 11, 146, 173, 152, 189, 24, 51, 51, 216, 206, 187, 16, 18, 83, 36, 34, 3, 251, 139, 49, 68, 19, 1, 18, 218, 188, 187, 57, 54, 18, 168, 25, 177, 223, 170, 137, 115, 19, 152, 220, 187, 153, 8, 136, 40, 36, 169, 171, 24, 102, 52, 50, 37, 50, 52, 34, 51, 50, 53, 34, 18, 144, 170, 201, 191, 203, 172, 170, 202, 188, 187, 187, 187, 188, 155, 25, 33, 50, 67, 1, 82, 51, 68, 69, 50, 34, 168, 24, 144, 8, 130, 16, 145, 220, 204, 172, 138, 24, 2, 203, 41, 176, 171, 237, 138, 128, 152, 234, 187, 219, 170, 204, 10, 152, 138, 144, 170, 0, 82, 53, 83, 67, 50, 36, 1, 84, 129, 1, 170, 0, 251, 172, 187, 187, 204, 172, 170, 172, 185, 156, 0, 0, 68, 33, 67, 34, 253, 221, 46, 0, 84, 35, 51, 36, 83, 18, 128, 136, 138, 160, 206, 137, 218, 170, 202, 172, 154, 153, 137, 128, 40, 52, 18, 52, 49, 103, 18, 50, 18, 34, 17, 33, 18, 136, 168, 26, 164, 255, 152, 154, 144, 171, 65, 145, 140, 1, 0, 34, 32, 38, 152, 40, 50, 52, 1, 24, 101, 35, 0, 82, 19, 65, 54, 0, 0, 8, 235, 139, 201, 57, 20, 252, 187, 9, 17, 1, 16, 81, 54, 129, 48, 69, 50, 17, 69, 2, 24, 19, 153, 9, 9, 128, 236, 204, 155, 152, 203, 154, 170, 186, 173, 32, 130, 17, 34, 84, 34, 50, 83, 53, 35, 83, 1, 8, 33, 17, 145, 187, 40, 200, 206, 172, 186, 186, 187, 187, 188, 202, 189, 9, 170, 65, 162, 172, 64, 21, 218, 138, 17, 1, 136, 168, 171, 32, 18, 160, 191, 99, 52, 19, 187, 49, 129, 152, 114, 193, 172, 237, 138, 185, 140, 170, 138, 251, 138, 184, 11, 51, 49, 20, 40, 71, 1, 24, 129, 98, 130, 9, 160, 157, 250, 157, 136, 153, 2, 186, 170, 174, 48, 18, 83, 34, 69, 2, 32, 33, 51, 66, 19, 153, 17, 69, 249, 10, 219, 154, 136, 0, 185, 235, 157, 32, 218, 187, 206, 171, 137, 16, 0, 128, 186, 156, 33, 117, 69, 51, 34, 66, 35, 66, 67, 50, 66, 19, 1, 128, 154, 235, 186, 218, 171, 203, 204, 203, 186, 171, 155, 153, 153, 153, 0, 49, 84, 34, 66, 52, 52, 52, 51, 35, 1, 152, 8, 8, 16, 169, 169, 255, 172, 170, 155, 153, 136, 168, 138, 217, 139, 200, 157, 16, 9, 33, 218, 170, 236, 155, 153, 152, 153, 0, 136, 49, 161, 112, 54, 67, 34, 115, 35, 2, 17, 145, 186, 190, 187, 189, 204, 203, 187, 190, 171, 171, 138, 170, 139, 50, 68, 50, 82, 68, 51, 52, 67, 35, 50, 35, 0, 201, 155, 169, 221, 187, 187, 172, 220, 155, 154, 136, 168, 64, 52, 52, 1, 49, 37, 51, 85, 35, 1, 17, 160, 136, 185, 25, 33, 147, 189, 128, 205, 171, 42, 55, 35, 17, 99, 35, 128, 33, 67, 34, 48, 55, 144, 136, 136, 1, 253, 9, 35, 144, 187, 25, 200, 174, 153, 25, 51, 168, 188, 171, 203, 120, 71, 18, 34, 68, 18, 153, 49, 85, 20, 152, 16, 17, 201, 156, 0, 160, 171, 186, 175, 169, 172, 136, 186, 187, 140, 67, 160, 42, 20, 1, 152, 112, 51, 50, 128, 115, 7, 152, 8, 1, 128, 48, 21, 16, 129, 191, 136, 0, 16, 0, 162, 207, 136, 234, 153, 152, 26, 129, 188, 173, 8, 169, 26, 128, 82, 20, 0, 99, 19, 40, 70, 18, 0, 65, 2, 8, 168, 26, 224, 173, 186, 11, 232, 171, 153, 201, 156, 136, 170, 128, 40, 50, 69, 176, 58, 55, 144, 170, 24, 115, 3, 186, 40, 232, 157, 9, 33, 1, 17, 68, 177, 174, 17, 1, 65, 53, 144, 186, 252, 139, 135, 249, 49, 0, 1, 171, 82, 145, 24, 250, 26, 3, 40, 53, 52, 35, 49, 130, 220, 220, 187, 153, 186, 186, 187, 223, 188, 187, 137, 16, 50, 84, 19, 83, 34, 82, 67, 68, 51, 51, 34, 34, 1, 152, 137, 1, 200, 221, 203, 203, 188, 187, 171, 153, 186, 154, 153, 154, 25, 50, 83, 85, 51, 53, 18, 1, 33, 34, 136, 16, 49, 3, 251, 173, 171, 202, 156, 138, 9, 152, 136, 235, 154, 203, 10, 152, 0, 168, 153, 252, 188, 172, 137, 136, 25, 36, 152, 65, 35, 51, 83, 69, 36, 36, 17, 82, 130, 185, 189, 170, 187, 172, 202, 204, 219, 172, 170, 186, 138, 24, 49, 51, 35, 32, 100, 67, 69, 51, 51, 1, 51, 129, 153, 137, 128, 220, 186, 205, 171, 200, 172, 187, 173, 16, 24, 0, 49, 37, 128, 152, 64, 55, 34, 82, 130, 8, 0, 16, 144, 72, 38, 17, 144, 26, 2, 24, 18, 112, 39, 1, 8, 16, 18, 169, 217, 11, 4, 220, 137, 169, 136, 219, 154, 186, 57, 37, 114, 35, 153, 56, 71, 129, 48, 35, 17, 0, 68, 128, 169, 139, 85, 18, 187, 9, 202, 170, 26, 103, 128, 17, 250, 172, 153, 34, 146, 156, 136, 136, 232, 157, 40, 34, 51, 68, 19, 153, 83, 130, 32, 115, 52, 129, 137, 152, 24, 233, 171, 0, 16, 144, 189, 155, 154, 152, 173, 40, 67, 34, 176, 223, 9, 18, 144, 186, 141, 68, 17, 153, 203, 137, 9, 18, 218, 136, 137, 145, 206, 24, 34, 2, 201, 171, 50, 160, 129, 189, 18, 253, 138, 171, 80, 131, 8, 24, 17, 169, 249, 141, 83, 67, 3, 172, 160, 157, 34, 168, 136, 169, 98, 192, 155, 201, 57, 22, 8, 17, 49, 37, 0, 128, 32, 1, 101, 1, 80, 130, 10, 249, 155, 152, 136, 202, 26, 20, 233, 219, 170, 48, 51, 34, 153, 24, 50, 38, 152, 50, 51, 71, 145, 137, 185, 41, 163, 223, 137, 10, 1, 136, 19, 16, 39, 217, 157, 24, 66, 36, 129, 137, 153, 221, 10, 33, 50, 52, 34, 161, 156, 33, 177, 139, 34, 69, 161, 202, 255, 172, 169, 169, 171, 153, 9, 160, 190, 137, 24, 36, 83, 69, 50, 51, 36, 51, 36, 66, 35, 66, 18, 32, 2, 170, 169, 206, 169, 202, 186, 219, 187, 187, 189, 187, 188, 137, 136, 25, 2, 32, 129, 57, 55, 83, 83, 50, 34, 34, 0, 152, 153, 0, 115, 146, 205, 187, 188, 188, 170, 154, 40, 161, 223, 154, 155, 17, 169, 64, 52, 20, 219, 137, 24, 85, 18, 33, 1, 32, 161, 10, 17, 116, 20, 169, 189, 9, 152, 187, 205, 153, 201, 170, 188, 10, 128, 169, 190, 9, 34, 35, 67, 68, 52, 128, 8, 99, 53, 49, 18, 0, 184, 188, 10, 32, 51, 176, 239, 155, 186, 41, 224, 139, 128, 0, 233, 25, 0, 50, 152, 48, 145, 114, 7, 32, 18, 50, 2, 185, 89, 70, 215, 255, 49, 0, 18, 128, 152, 153, 32, 217, 138, 65, 36, 136, 202, 172, 153, 9, 17, 137, 17, 217, 222, 155, 0, 152, 169, 112, 52, 16, 129, 32, 32, 102, 18, 48, 50, 70, 130, 170, 169, 10, 19, 152, 161, 173, 152, 188, 219, 190, 155, 24, 19, 188, 41, 66, 35, 216, 171, 88, 38, 18, 67, 2, 128, 185, 138, 35, 98, 35, 48, 21, 187, 236, 172, 24, 35, 2, 152, 136, 251, 171, 8, 16, 18, 65, 3, 204, 203, 157, 9, 137, 186, 27, 38, 33, 208, 12, 52, 99, 35, 8, 67, 17, 36, 201, 137, 185, 16, 251, 142, 153, 9, 184, 172, 154, 9, 145, 172, 32, 54, 19, 153, 65, 129, 9, 0, 115, 36, 0, 16, 16, 99, 147, 189, 0, 34, 21, 202, 186, 189, 9, 200, 172, 169, 136, 160, 191, 138, 152, 17, 129, 65, 161, 112, 19, 83, 20, 17, 33, 37, 169, 153, 136, 116, 19, 185, 169, 205, 171, 9, 66, 33, 176, 191, 136, 152, 0, 136, 49, 33, 55, 176, 9, 99, 4, 185, 171, 72, 36, 18, 217, 203, 171, 168, 202, 188, 41, 22, 152, 185, 11, 184, 27, 71, 34, 20, 144, 9, 128, 64, 36, 152, 83, 35, 34, 2, 128, 16, 208, 191, 25, 2, 25, 4, 190, 169, 207, 24, 129, 32, 1, 137, 136, 0, 0, 144, 173, 114, 36, 18, 0, 186, 88, 146, 12, 35, 17, 36, 131, 136, 184, 223, 137, 136, 40, 52, 200, 10, 1, 169, 205, 26, 53, 36, 168, 172, 170, 115, 5, 154, 152, 41, 19, 219, 186, 11, 36, 184, 17, 232, 11, 18, 98, 131, 191, 138, 16, 2, 152, 137, 184, 156, 1, 9, 87, 128, 48, 2, 34, 200, 74, 55, 128, 0, 156, 33, 186, 186, 223, 137, 137, 16, 202, 156, 137, 16, 36, 169, 137, 25, 71, 17, 168, 174, 40, 1, 17, 0, 33, 160, 250, 139, 68, 49, 21, 168, 32, 130, 153, 202, 172, 48, 132, 223, 9, 1, 32, 144, 137, 136, 84, 129, 56, 86, 52, 130, 8, 34, 9, 100, 130, 24, 144, 8, 232, 189, 154, 8, 251, 139, 1, 168, 204, 11, 1, 56, 36, 0, 51, 99, 52, 0, 35, 18, 50, 0, 86, 160, 10, 128, 169, 236, 171, 219, 10, 130, 0, 184, 172, 129, 220, 40, 19, 84, 36, 17, 169, 9, 25, 70, 1, 16, 129, 33, 144, 112, 177, 157, 144, 169, 218, 171, 168, 188, 218, 173, 169, 187, 40, 52, 19, 203, 64, 146, 58, 71, 34, 51, 34, 129, 152, 0, 16, 36, 16, 177, 239, 153, 152, 171, 153, 205, 186, 174, 25, 2, 202, 155, 203, 155, 68, 67, 50, 18, 49, 18, 8, 82, 70, 3, 128, 128, 220, 187, 25, 129, 153, 34, 252, 173, 185, 9, 2, 18, 16, 37, 184, 65, 19, 8, 97, 53, 34, 66, 34, 18, 128, 144, 205, 153, 137, 85, 130, 187, 153, 236, 203, 171, 49, 34, 129, 137, 146, 189, 203, 94, 246, 43, 0, 72, 2, 97, 52, 35, 128, 82, 2, 171, 88, 38, 130, 154, 137, 137, 160, 223, 137, 136, 32, 129, 152, 169, 219, 154, 187, 139, 70, 20, 17, 192, 11, 147, 175, 33, 82, 51, 51, 131, 154, 192, 157, 50, 144, 48, 129, 201, 206, 137, 185, 171, 219, 154, 169, 138, 129, 171, 250, 140, 69, 129, 16, 24, 70, 129, 33, 128, 32, 184, 56, 251, 11, 168, 0, 251, 186, 40, 195, 27, 20, 24, 160, 64, 160, 40, 0, 85, 1, 65, 53, 161, 140, 51, 0, 69, 184, 24, 216, 26, 129, 154, 152, 152, 251, 174, 0, 202, 8, 160, 57, 179, 158, 217, 139, 0, 82, 2, 66, 160, 186, 26, 23, 186, 50, 130, 136, 234, 42, 53, 128, 200, 12, 129, 11, 87, 145, 169, 171, 201, 157, 50, 152, 0, 136, 35, 251, 171, 80, 36, 33, 19, 137, 54, 152, 83, 217, 139, 184, 26, 160, 40, 185, 114, 195, 157, 169, 42, 38, 66, 146, 170, 186, 40, 1, 129, 12, 55, 32, 21, 138, 152, 170, 138, 87, 146, 9, 0, 176, 191, 128, 0, 2, 234, 172, 40, 128, 138, 137, 152, 219, 89, 54, 130, 136, 33, 82, 18, 136, 153, 24, 144, 10, 128, 9, 208, 175, 16, 24, 118, 20, 160, 170, 171, 138, 99, 19, 218, 156, 137, 16, 129, 136, 24, 129, 113, 36, 144, 136, 24, 128, 64, 4, 172, 84, 129, 186, 187, 138, 101, 18, 1, 128, 188, 10, 0, 218, 156, 64, 53, 2, 219, 9, 201, 25, 19, 0, 128, 114, 6, 153, 152, 10, 129, 171, 56, 39, 1, 168, 186, 251, 189, 24, 51, 37, 19, 220, 154, 25, 68, 19, 144, 203, 9, 0, 66, 162, 203, 202, 25, 53, 1, 153, 137, 34, 233, 11, 3, 154, 24, 185, 173, 160, 223, 187, 41, 38, 33, 129, 137, 136, 65, 54, 16, 152, 188, 187, 170, 154, 117, 145, 202, 205, 10, 32, 50, 128, 0, 49, 55, 129, 32, 1, 49, 55, 161, 238, 170, 48, 2, 9, 0, 169, 153, 185, 138, 68, 83, 69, 145, 189, 138, 33, 2, 128, 136, 153, 136, 251, 189, 42, 36, 81, 21, 169, 154, 8, 98, 51, 160, 191, 9, 50, 35, 169, 0, 235, 155, 8, 18, 8, 53, 216, 157, 48, 53, 144, 202, 170, 155, 115, 3, 153, 155, 8, 66, 20, 16, 177, 12, 54, 130, 152, 235, 171, 40, 69, 129, 153, 219, 26, 35, 17, 2, 206, 138, 17, 144, 82, 130, 170, 206, 10, 49, 54, 161, 154, 187, 40, 146, 112, 6, 186, 139, 16, 0, 1, 218, 24, 144, 136, 113, 55, 160, 154, 169, 10, 68, 19, 219, 170, 152, 9, 84, 129, 8, 185, 40, 16, 54, 216, 154, 136, 68, 131, 219, 25, 34, 1, 204, 203, 10, 67, 50, 179, 207, 154, 72, 53, 1, 168, 203, 154, 81, 19, 0, 144, 189, 24, 52, 184, 40, 209, 140, 34, 50, 53, 168, 205, 154, 17, 130, 16, 54, 4, 54, 0, 176, 175, 0, 152, 56, 53, 176, 173, 97, 20, 144, 169, 189, 25, 68, 145, 187, 9, 34, 131, 24, 129, 10, 83, 51, 248, 158, 48, 34, 128, 49, 240, 189, 25, 33, 128, 81, 145, 190, 24, 50, 67, 145, 187, 137, 98, 35, 145, 221, 171, 56, 37, 152, 137, 185, 157, 65, 21, 160, 170, 171, 24, 99, 35, 168, 186, 205, 56, 38, 2, 169, 174, 25, 52, 2, 185, 172, 137, 65, 51, 21, 251, 139, 49, 19, 128, 184, 190, 10, 84, 18, 200, 172, 16, 51, 2, 152, 203, 41, 36, 144, 189, 41, 50, 51, 145, 223, 138, 50, 168, 139, 67, 129, 25, 3, 203, 96, 53, 144, 188, 187, 97, 3, 201, 171, 65, 35, 160, 189, 11, 17, 49, 177, 122, 20, 9, 129, 171, 115, 161, 26, 147, 207, 64, 130, 172, 41, 51, 160, 25, 184, 28, 21, 251, 139, 115, 20, 202, 155, 32, 35, 129, 235, 9, 66, 18, 216, 155, 24, 50, 36, 136, 202, 11, 52, 144, 204, 42, 37, 185, 25, 36, 152, 186, 141, 18, 33, 130, 155, 184, 191, 80, 52, 146, 171, 0, 170, 50, 176, 172, 96, 39, 184, 9, 185, 138, 81, 148, 12, 132, 188, 25, 98, 131, 185, 169, 10, 1, 16, 84, 2, 205, 26, 34, 32, 37, 234, 155, 153, 97, 4, 169, 186, 80, 146, 43, 4, 185, 154, 114, 35, 168, 235, 139, 50, 128, 49, 3, 206, 137, 1, 48, 37, 152, 202, 10, 144, 56, 131, 48, 248, 89, 19, 201, 137, 128, 16, 36, 237, 9, 128, 80, 2, 170, 169, 24, 8, 98, 20, 168, 205, 155, 50, 53, 130, 202, 9, 129, 168, 137, 48, 119, 145, 172, 8, 50, 18, 249, 172, 32, 18, 50, 176, 173, 40, 53, 161, 154, 152, 169, 41, 53, 176, 223, 41, 37, 18, 184, 189, 155, 81, 36, 152, 185, 154, 0, 49, 39, 200, 155, 49, 2, 32, 146, 174, 17, 153, 98, 192, 155, 66, 130, 170, 8, 170, 114, 130, 10, 68, 177, 191, 9, 1, 32, 52, 192, 207, 24, 51, 3, 129, 218, 156, 66, 130, 170, 9, 16, 0, 16, 33, 145, 189, 138, 33, 33, 66, 251, 175, 33, 67, 2, 188, 24, 169, 81, 145, 139, 24, 84, 145, 202, 187, 72, 55, 144, 219, 155, 98, 3, 187, 24, 161, 56, 193, 58, 131, 26, 160, 170, 205, 115, 7, 203, 24, 33, 2, 152, 202, 171, 88, 54, 144, 186, 189, 88, 21, 144, 152, 169, 153, 48, 22, 152, 144, 204, 24, 51, 5, 170, 154, 155, 65, 35, 34, 185, 174, 10, 83, 35, 185, 175, 24, 35, 129, 184, 203, 40, 35, 49, 20, 249, 188, 81, 51, 145, 237, 138, 35, 18, 129, 169, 219, 26, 53, 2, 186, 11, 1, 0, 144, 171, 66, 2, 233, 11, 38, 144, 234, 156, 81, 34, 1, 186, 188, 10, 114, 51, 168, 170, 170, 40, 132, 138, 54, 176, 157, 25, 34, 33, 17, 201, 234, 6, 57, 0, 219, 138, 99, 19, 144, 201, 189, 66, 146, 57, 3, 188, 137, 169, 187, 96, 52, 160, 155, 128, 202, 115, 23, 186, 153, 48, 131, 188, 33, 145, 168, 26, 119, 145, 155, 144, 138, 82, 1, 128, 191, 66, 176, 0, 153, 68, 168, 170, 40, 53, 128, 186, 156, 144, 89, 39, 185, 137, 152, 32, 51, 18, 221, 187, 11, 118, 2, 187, 138, 1, 40, 53, 160, 173, 138, 65, 20, 185, 155, 33, 34, 67, 177, 255, 24, 50, 17, 128, 189, 10, 49, 18, 152, 169, 154, 185, 113, 37, 152, 169, 189, 25, 99, 51, 176, 190, 9, 17, 51, 4, 235, 154, 0, 51, 130, 128, 218, 155, 56, 71, 145, 202, 154, 82, 3, 169, 170, 186, 73, 38, 161, 188, 58, 38, 152, 154, 0, 152, 25, 70, 160, 139, 1, 202, 24, 84, 2, 154, 168, 190, 48, 20, 0, 49, 248, 157, 32, 36, 145, 219, 171, 72, 39, 177, 172, 9, 65, 51, 145, 205, 10, 50, 2, 168, 170, 10, 66, 129, 168, 141, 53, 130, 201, 189, 64, 53, 130, 221, 138, 49, 35, 152, 186, 154, 136, 82, 20, 184, 171, 155, 100, 35, 177, 191, 24, 32, 20, 201, 25, 136, 65, 128, 136, 187, 67, 251, 40, 18, 0, 168, 137, 153, 115, 145, 154, 184, 27, 86, 20, 250, 11, 49, 18, 184, 9, 152, 8, 129, 24, 53, 249, 157, 49, 20, 184, 154, 8, 49, 3, 40, 209, 207, 48, 19, 152, 128, 234, 41, 20, 202, 64, 19, 202, 156, 17, 50, 2, 251, 154, 48, 53, 130, 187, 171, 137, 84, 131, 186, 172, 48, 20, 17, 233, 156, 17, 18, 129, 235, 25, 68, 160, 140, 49, 17, 201, 141, 33, 66, 20, 202, 172, 11, 83, 3, 9, 144, 188, 187, 121, 54, 128, 187, 155, 8, 81, 36, 153, 155, 8, 129, 8, 162, 175, 67, 128, 40, 201, 25, 1, 72, 35, 201, 206, 9, 17, 115, 4, 203, 170, 8, 85, 145, 153, 144, 169, 8, 49, 37, 128, 203, 173, 40, 53, 34, 234, 139, 24, 34, 146, 186, 156, 80, 67, 1, 219, 156, 48, 35, 8, 18, 234, 140, 49, 2, 217, 157, 48, 3, 136, 17, 20, 204, 10, 16, 35, 201, 57, 5, 185, 190, 42, 71, 130, 186, 155, 48, 2, 16, 3, 220, 138, 67, 1, 8, 201, 154, 128, 9, 82, 20, 184, 172, 138, 85, 146, 155, 177, 13, 35, 25, 6, 189, 9, 81, 35, 202, 10, 170, 88, 54, 146, 236, 10, 34, 1, 0, 168, 172, 49, 35, 168, 11, 1, 236, 57, 38, 184, 139, 136, 9, 87, 130, 203, 171, 57, 54, 130, 187, 9, 168, 42, 132, 88, 133, 189, 32, 19, 0, 168, 137, 203, 58, 71, 184, 139, 18, 152, 56, 145, 157, 68, 176, 10, 153, 81, 2, 152, 217, 189, 56, 55, 2, 186, 173, 16, 36, 0, 168, 172, 16, 49, 163, 159, 66, 129, 186, 171, 113, 3, 171, 128, 169, 186, 244, 60, 0, 0, 136, 36, 185, 114, 164, 190, 9, 84, 19, 185, 173, 40, 19, 10, 51, 216, 172, 8, 66, 3, 171, 203, 42, 71, 161, 170, 16, 202, 89, 53, 184, 156, 152, 8, 69, 129, 153, 201, 156, 99, 18, 154, 10, 168, 154, 84, 145, 9, 0, 219, 11, 54, 144, 16, 176, 155, 17, 80, 36, 218, 155, 136, 48, 37, 216, 12, 50, 168, 9, 20, 217, 41, 19, 128, 184, 174, 48, 35, 18, 252, 155, 67, 2, 153, 152, 136, 33, 83, 177, 223, 41, 67, 2, 219, 154, 56, 38, 185, 136, 152, 32, 2, 9, 129, 138, 68, 249, 139, 99, 162, 172, 50, 162, 170, 82, 145, 137, 168, 157, 81, 3, 10, 193, 191, 66, 145, 11, 34, 168, 57, 132, 173, 82, 184, 26, 19, 17, 176, 174, 56, 38, 217, 10, 4, 153, 129, 186, 114, 5, 187, 24, 130, 154, 67, 129, 185, 157, 49, 160, 97, 161, 141, 20, 188, 80, 130, 9, 152, 154, 33, 232, 27, 54, 160, 32, 209, 157, 32, 1, 51, 163, 223, 137, 49, 51, 160, 172, 128, 136, 0, 81, 3, 207, 25, 67, 160, 139, 1, 24, 53, 224, 172, 49, 2, 24, 177, 190, 16, 51, 146, 171, 19, 206, 24, 35, 1, 144, 8, 129, 10, 144, 139, 148, 255, 81, 5, 201, 155, 49, 19, 0, 169, 219, 28, 38, 152, 24, 152, 170, 73, 4, 154, 128, 153, 113, 21, 201, 155, 1, 50, 4, 190, 40, 130, 24, 2, 202, 155, 81, 19, 168, 9, 177, 175, 83, 129, 201, 142, 83, 129, 170, 24, 160, 56, 132, 9, 4, 189, 10, 66, 130, 56, 210, 157, 0, 32, 20, 168, 188, 42, 67, 82, 146, 207, 25, 0, 67, 145, 168, 189, 32, 19, 17, 168, 219, 26, 39, 184, 72, 145, 157, 9, 34, 35, 0, 202, 172, 139, 116, 18, 184, 187, 137, 48, 87, 160, 156, 136, 40, 52, 146, 235, 137, 33, 33, 2, 251, 138, 50, 128, 33, 250, 12, 51, 146, 171, 33, 200, 155, 33, 71, 193, 156, 32, 17, 1, 160, 169, 174, 80, 20, 152, 202, 9, 50, 2, 25, 3, 255, 41, 35, 153, 0, 184, 140, 49, 3, 170, 16, 144, 184, 141, 86, 2, 202, 187, 169, 97, 54, 145, 203, 172, 33, 52, 17, 217, 187, 33, 129, 66, 163, 174, 16, 24, 34, 233, 138, 50, 35, 160, 218, 172, 82, 3, 9, 177, 191, 56, 36, 18, 192, 174, 0, 1, 67, 129, 204, 139, 33, 52, 146, 172, 152, 138, 100, 130, 203, 8, 144, 64, 4, 202, 154, 49, 51, 2, 235, 203, 72, 36, 184, 25, 152, 154, 68, 176, 140, 52, 200, 26, 36, 185, 140, 33, 50, 192, 155, 34, 185, 96, 147, 191, 88, 35, 217, 139, 48, 36, 184, 137, 201, 40, 38, 128, 152, 236, 26, 68, 130, 170, 154, 138, 66, 67, 162, 191, 56, 2, 152, 0, 128, 187, 155, 118, 131, 203, 9, 1, 34, 161, 171, 148, 248, 63, 0, 128, 168, 56, 71, 200, 27, 18, 137, 2, 56, 146, 255, 10, 83, 129, 8, 168, 188, 24, 51, 36, 144, 153, 237, 26, 68, 144, 9, 168, 139, 69, 145, 137, 152, 186, 139, 71, 19, 169, 189, 154, 98, 35, 136, 186, 174, 72, 51, 128, 218, 10, 1, 10, 55, 161, 171, 153, 136, 115, 19, 219, 154, 8, 68, 2, 234, 154, 49, 20, 160, 138, 176, 158, 98, 18, 185, 171, 64, 17, 33, 234, 138, 0, 67, 131, 235, 155, 65, 35, 17, 185, 190, 155, 100, 131, 169, 152, 137, 33, 128, 129, 189, 114, 133, 187, 10, 66, 2, 152, 155, 176, 140, 116, 19, 185, 203, 139, 82, 51, 129, 220, 155, 50, 4, 152, 136, 8, 152, 128, 184, 120, 6, 168, 154, 24, 129, 11, 54, 146, 235, 156, 97, 2, 8, 185, 140, 16, 16, 66, 131, 207, 40, 1, 8, 1, 184, 10, 35, 16, 130, 221, 139, 65, 51, 130, 222, 10, 67, 2, 153, 169, 202, 42, 87, 144, 154, 186, 89, 37, 168, 171, 40, 20, 128, 145, 191, 40, 67, 145, 137, 186, 41, 130, 41, 39, 184, 156, 34, 128, 8, 49, 146, 255, 25, 37, 169, 24, 161, 173, 32, 66, 20, 233, 171, 17, 18, 51, 146, 204, 155, 8, 98, 19, 186, 171, 139, 100, 35, 192, 189, 8, 67, 35, 202, 188, 41, 54, 129, 201, 154, 48, 17, 1, 203, 40, 128, 48, 161, 113, 248, 10, 18, 8, 17, 17, 233, 173, 56, 38, 144, 169, 170, 99, 146, 204, 40, 36, 176, 171, 40, 51, 168, 156, 24, 65, 35, 234, 138, 2, 33, 130, 172, 154, 64, 21, 155, 217, 141, 54, 129, 170, 139, 53, 192, 138, 1, 155, 69, 130, 171, 187, 156, 115, 7, 152, 169, 138, 50, 35, 160, 204, 155, 32, 54, 129, 169, 168, 170, 74, 55, 168, 187, 25, 70, 160, 171, 153, 82, 19, 136, 201, 157, 32, 67, 130, 203, 8, 168, 40, 99, 19, 253, 138, 66, 19, 185, 171, 8, 16, 52, 129, 202, 188, 81, 19, 176, 174, 65, 2, 137, 144, 173, 48, 51, 4, 235, 155, 26, 85, 1, 169, 187, 48, 3, 16, 146, 174, 40, 36, 176, 204, 10, 35, 66, 20, 184, 206, 10, 83, 35, 176, 175, 153, 48, 38, 152, 154, 152, 33, 1, 16, 128, 168, 206, 57, 36, 32, 192, 175, 32, 1, 48, 131, 205, 137, 82, 144, 9, 129, 153, 201, 72, 4, 137, 128, 24, 184, 120, 19, 171, 138, 137, 203, 72, 67, 36, 251, 42, 132, 188, 82, 145, 138, 17, 152, 128, 185, 26, 54, 129, 188, 81, 192, 58, 36, 184, 220, 24, 52, 3, 235, 140, 32, 8, 98, 3, 205, 139, 66, 3, 136, 184, 172, 49, 19, 170, 9, 2, 144, 136, 82, 146, 157, 128, 9, 71, 176, 173, 25, 51, 146, 154, 24, 83, 144, 203, 202, 10, 70, 2, 185, 154, 152, 141, 69, 3, 176, 206, 41, 52, 176, 9, 59, 2, 67, 0, 160, 12, 21, 136, 130, 171, 1, 203, 56, 84, 19, 252, 26, 34, 152, 16, 128, 218, 139, 99, 35, 152, 252, 139, 53, 129, 136, 154, 152, 171, 99, 20, 129, 204, 10, 33, 51, 201, 11, 130, 170, 32, 65, 53, 160, 205, 170, 64, 37, 160, 170, 153, 24, 35, 83, 5, 252, 11, 33, 82, 145, 171, 169, 58, 39, 153, 137, 136, 1, 49, 21, 222, 9, 36, 160, 136, 1, 170, 8, 24, 68, 145, 170, 189, 56, 38, 1, 188, 154, 32, 55, 145, 201, 173, 40, 53, 130, 219, 137, 16, 49, 160, 57, 194, 175, 33, 35, 128, 185, 139, 169, 57, 103, 152, 153, 25, 18, 154, 168, 88, 39, 217, 154, 32, 35, 144, 8, 234, 155, 99, 3, 128, 201, 172, 56, 37, 2, 235, 138, 33, 18, 160, 9, 145, 138, 169, 80, 37, 176, 157, 169, 96, 3, 41, 232, 27, 3, 136, 152, 57, 21, 219, 40, 2, 9, 144, 170, 48, 6, 189, 64, 34, 2, 252, 156, 64, 38, 184, 156, 17, 137, 65, 35, 200, 173, 9, 50, 20, 152, 202, 155, 49, 54, 162, 190, 24, 17, 51, 161, 220, 138, 66, 130, 137, 2, 221, 41, 37, 168, 8, 168, 138, 128, 98, 4, 186, 153, 155, 115, 19, 169, 156, 9, 48, 50, 18, 217, 188, 186, 112, 38, 152, 203, 10, 50, 34, 20, 234, 156, 16, 51, 146, 156, 8, 137, 16, 34, 145, 153, 136, 218, 140, 117, 146, 172, 8, 49, 129, 24, 217, 11, 3, 0, 98, 19, 254, 10, 36, 1, 168, 172, 8, 98, 2, 172, 152, 9, 99, 3, 218, 139, 18, 34, 128, 154, 187, 25, 36, 18, 145, 186, 158, 100, 192, 155, 82, 52, 217, 171, 24, 33, 83, 144, 170, 204, 56, 53, 1, 202, 172, 41, 52, 3, 201, 172, 25, 53, 161, 9, 184, 139, 18, 98, 147, 153, 250, 11, 68, 1, 200, 155, 81, 1, 169, 137, 34, 168, 25, 19, 217, 27, 35, 81, 225, 141, 34, 19, 217, 155, 33, 38, 201, 138, 1, 33, 33, 216, 172, 32, 52, 19, 237, 11, 66, 129, 8, 169, 11, 54, 201, 155, 52, 145, 10, 162, 157, 50, 152, 0, 136, 17, 33, 201, 24, 249, 43, 55, 144, 188, 8, 130, 73, 37, 185, 187, 10, 86, 162, 172, 16, 0, 17, 129, 219, 8, 128, 66, 129, 16, 138, 145, 191, 41, 53, 200, 73, 131, 220, 156, 68, 18, 168, 156, 136, 0, 36, 152, 8, 154, 34, 236, 80, 145, 25, 224, 42, 20, 137, 145, 172, 33, 68, 161, 174, 136, 0, 69, 145, 171, 170, 72, 37, 168, 8, 185, 171, 81, 22, 144, 153, 187, 41, 37, 50, 194, 191, 24, 66, 146, 155, 144, 139, 84, 1, 168, 203, 72, 3, 172, 48, 3, 185, 155, 68, 145, 203, 25, 131, 11, 37, 98, 226, 157, 0, 50, 131, 170, 154, 128, 187, 26, 119, 5, 202, 169, 32, 51, 168, 154, 128, 153, 81, 182, 0, 65, 0, 131, 40, 163, 207, 8, 0, 49, 36, 233, 187, 32, 37, 145, 24, 200, 191, 49, 50, 22, 235, 9, 137, 68, 145, 171, 137, 17, 50, 36, 217, 175, 48, 19, 136, 145, 188, 8, 17, 99, 145, 170, 203, 40, 53, 130, 202, 155, 155, 116, 21, 169, 203, 26, 83, 18, 185, 156, 0, 33, 2, 155, 68, 250, 10, 51, 130, 169, 154, 152, 154, 117, 130, 171, 136, 16, 128, 17, 169, 99, 192, 140, 0, 50, 147, 173, 33, 200, 140, 84, 2, 168, 204, 10, 53, 146, 154, 170, 48, 0, 18, 171, 83, 168, 169, 172, 97, 22, 217, 10, 33, 0, 137, 19, 204, 56, 3, 203, 24, 24, 23, 201, 8, 25, 37, 218, 25, 3, 169, 9, 34, 51, 250, 157, 56, 68, 146, 190, 41, 131, 9, 53, 160, 189, 10, 50, 67, 129, 205, 25, 0, 48, 37, 249, 139, 34, 128, 66, 192, 172, 32, 35, 152, 16, 250, 28, 52, 161, 170, 168, 56, 22, 154, 16, 187, 64, 161, 25, 52, 177, 191, 49, 145, 32, 176, 24, 192, 25, 169, 102, 145, 202, 139, 51, 128, 99, 161, 189, 9, 32, 53, 216, 10, 20, 136, 176, 157, 33, 52, 176, 157, 9, 50, 131, 171, 82, 248, 43, 21, 169, 137, 33, 201, 113, 162, 174, 49, 2, 0, 200, 172, 48, 38, 153, 8, 234, 41, 20, 152, 8, 152, 8, 33, 201, 88, 148, 157, 16, 136, 52, 200, 138, 17, 152, 157, 100, 145, 138, 184, 43, 55, 160, 171, 8, 129, 33, 21, 184, 189, 64, 129, 41, 20, 220, 56, 162, 28, 19, 153, 8, 128, 153, 138, 56, 71, 177, 155, 17, 187, 65, 146, 155, 87, 193, 188, 16, 100, 146, 203, 9, 16, 18, 0, 160, 173, 137, 114, 5, 187, 8, 8, 66, 131, 204, 138, 33, 65, 19, 252, 10, 49, 18, 168, 138, 200, 43, 39, 144, 153, 137, 137, 83, 131, 173, 24, 144, 58, 55, 200, 171, 8, 66, 35, 201, 154, 154, 98, 2, 169, 137, 0, 152, 32, 68, 130, 207, 10, 51, 33, 161, 205, 25, 51, 192, 43, 21, 201, 8, 152, 33, 50, 146, 255, 40, 18, 152, 136, 152, 24, 168, 122, 23, 202, 9, 129, 48, 2, 170, 171, 153, 80, 70, 144, 188, 8, 40, 52, 144, 154, 219, 10, 99, 18, 128, 218, 187, 49, 37, 17, 200, 156, 152, 64, 37, 152, 171, 153, 137, 100, 19, 186, 172, 8, 32, 53, 146, 189, 154, 32, 99, 3, 203, 170, 9, 82, 37, 200, 156, 16, 0, 48, 20, 218, 138, 16, 0, 32, 145, 154, 17, 168, 138, 84, 147, 207, 56, 20, 186, 81, 176, 174, 65, 3, 137, 160, 205, 48, 22, 144, 171, 137, 25, 100, 130, 187, 137, 1, 24, 67, 160, 172, 9, 50, 152, 82, 176, 139, 184, 43, 103, 129, 169, 173, 48, 3, 8, 17, 169, 187, 187, 104, 55, 130, 218, 204, 57, 53, 1, 184, 175, 40, 20, 144, 19, 8, 63, 0, 136, 169, 155, 67, 35, 0, 218, 189, 72, 21, 136, 152, 172, 49, 20, 168, 139, 2, 171, 82, 18, 144, 191, 26, 54, 144, 153, 153, 0, 144, 80, 35, 233, 172, 49, 18, 0, 201, 138, 50, 1, 40, 192, 191, 48, 5, 152, 1, 234, 57, 36, 216, 27, 4, 170, 49, 144, 32, 192, 157, 40, 52, 144, 154, 26, 4, 220, 40, 53, 177, 172, 137, 24, 66, 51, 176, 207, 154, 115, 2, 153, 168, 153, 8, 53, 161, 170, 25, 19, 153, 168, 11, 39, 137, 50, 176, 221, 27, 71, 184, 139, 35, 185, 9, 52, 19, 234, 138, 170, 88, 54, 176, 155, 8, 154, 48, 19, 82, 193, 157, 146, 140, 84, 2, 218, 137, 129, 32, 130, 10, 129, 171, 97, 161, 140, 84, 177, 174, 49, 128, 33, 176, 154, 154, 33, 68, 145, 174, 40, 51, 169, 129, 223, 40, 51, 20, 234, 138, 0, 24, 34, 144, 1, 250, 10, 35, 36, 208, 171, 144, 40, 52, 54, 192, 175, 26, 67, 2, 144, 187, 170, 11, 101, 35, 184, 204, 138, 66, 34, 136, 137, 185, 172, 65, 34, 50, 176, 205, 187, 97, 35, 136, 144, 189, 41, 19, 66, 129, 202, 190, 56, 53, 145, 171, 129, 187, 113, 129, 24, 152, 185, 28, 55, 185, 41, 160, 27, 37, 130, 219, 153, 136, 66, 19, 128, 221, 25, 51, 129, 201, 156, 56, 85, 130, 219, 154, 154, 116, 130, 153, 152, 11, 33, 16, 1, 168, 174, 56, 37, 129, 186, 203, 170, 115, 37, 184, 154, 152, 27, 67, 17, 160, 58, 210, 142, 1, 26, 52, 136, 161, 191, 32, 65, 2, 153, 236, 41, 19, 24, 129, 188, 152, 32, 18, 82, 130, 185, 255, 41, 50, 19, 218, 137, 169, 9, 84, 2, 136, 218, 155, 32, 38, 130, 185, 203, 10, 68, 2, 129, 201, 188, 57, 38, 128, 0, 218, 138, 49, 52, 177, 190, 24, 1, 66, 19, 236, 155, 64, 67, 160, 187, 153, 65, 35, 51, 249, 175, 33, 17, 19, 185, 173, 8, 34, 36, 184, 154, 217, 73, 21, 152, 168, 139, 50, 19, 136, 201, 159, 49, 34, 129, 187, 185, 12, 55, 130, 189, 25, 35, 1, 18, 251, 139, 17, 16, 83, 162, 205, 10, 17, 68, 1, 170, 220, 25, 51, 34, 161, 190, 155, 67, 20, 2, 220, 138, 128, 81, 4, 152, 219, 25, 19, 49, 176, 174, 24, 51, 130, 218, 154, 81, 19, 186, 136, 137, 16, 80, 5, 220, 25, 17, 0, 128, 16, 216, 171, 97, 36, 168, 169, 203, 41, 87, 168, 9, 168, 41, 20, 152, 136, 184, 138, 100, 19, 204, 8, 144, 25, 51, 129, 186, 25, 145, 157, 98, 131, 172, 36, 236, 56, 3, 169, 137, 0, 16, 176, 58, 135, 155, 33, 8, 19, 206, 8, 1, 32, 50, 5, 222, 41, 3, 11, 38, 233, 10, 2, 16, 0, 0, 218, 41, 129, 49, 176, 24, 252, 43, 22, 137, 128, 169, 26, 48, 255, 32, 0, 68, 144, 9, 185, 26, 3, 64, 161, 156, 152, 66, 234, 112, 145, 138, 128, 171, 40, 54, 145, 189, 40, 20, 169, 34, 218, 9, 50, 193, 140, 5, 202, 98, 129, 136, 200, 10, 17, 17, 136, 185, 74, 22, 168, 155, 68, 161, 139, 136, 16, 160, 42, 39, 184, 25, 50, 146, 255, 57, 21, 152, 18, 220, 140, 67, 130, 153, 200, 11, 20, 24, 37, 186, 137, 170, 82, 2, 137, 16, 185, 203, 157, 84, 131, 136, 202, 155, 83, 130, 137, 50, 233, 10, 50, 176, 140, 34, 219, 97, 129, 33, 251, 26, 1, 33, 153, 192, 141, 19, 48, 6, 188, 9, 33, 17, 128, 204, 27, 34, 67, 177, 26, 226, 157, 83, 2, 170, 153, 219, 41, 71, 130, 169, 204, 25, 50, 36, 177, 157, 136, 137, 67, 3, 153, 9, 251, 42, 38, 152, 169, 171, 137, 57, 119, 128, 170, 16, 128, 8, 37, 184, 171, 138, 0, 97, 20, 186, 153, 170, 114, 132, 137, 153, 154, 115, 19, 144, 222, 26, 19, 8, 8, 2, 203, 40, 144, 48, 35, 18, 223, 11, 0, 99, 19, 200, 190, 26, 83, 2, 153, 137, 170, 97, 2, 136, 219, 25, 19, 0, 50, 208, 157, 24, 18, 128, 83, 200, 139, 34, 18, 129, 160, 239, 24, 2, 32, 161, 10, 201, 42, 38, 168, 137, 169, 42, 71, 129, 186, 203, 138, 34, 20, 177, 171, 48, 38, 201, 88, 132, 170, 217, 140, 51, 99, 20, 203, 154, 32, 34, 66, 248, 173, 32, 35, 18, 184, 205, 137, 82, 18, 185, 190, 56, 53, 129, 168, 171, 32, 160, 113, 19, 204, 171, 16, 51, 53, 160, 173, 8, 8, 51, 147, 190, 25, 1, 81, 20, 250, 188, 57, 69, 34, 168, 188, 155, 41, 86, 2, 202, 188, 24, 52, 18, 128, 217, 203, 25, 83, 19, 144, 202, 170, 48, 20, 152, 153, 202, 10, 52, 130, 0, 169, 186, 88, 37, 128, 250, 171, 24, 70, 3, 202, 155, 99, 51, 145, 207, 156, 17, 18, 35, 144, 204, 138, 49, 51, 83, 130, 252, 154, 32, 35, 131, 234, 172, 32, 51, 3, 201, 188, 10, 115, 35, 144, 202, 188, 25, 36, 130, 153, 169, 24, 115, 18, 185, 154, 16, 50, 35, 232, 173, 40, 1, 9, 83, 145, 26, 146, 255, 139, 50, 51, 2, 222, 155, 81, 35, 160, 154, 16, 66, 19, 218, 174, 57, 35, 186, 155, 25, 84, 35, 53, 232, 189, 137, 34, 52, 160, 191, 25, 34, 49, 131, 190, 16, 128, 16, 34, 144, 186, 171, 0, 97, 37, 185, 172, 10, 49, 84, 145, 189, 156, 80, 20, 128, 144, 203, 9, 66, 53, 145, 205, 10, 83, 18, 185, 174, 8, 32, 18, 129, 153, 139, 1, 24, 71, 129, 170, 171, 186, 96, 55, 131, 219, 171, 56, 36, 160, 202, 138, 49, 68, 147, 206, 154, 24, 50, 18, 160, 205, 9, 82, 35, 144, 188, 187, 64, 70, 130, 185, 187, 10, 8, 228, 64, 0, 84, 35, 176, 204, 138, 33, 34, 160, 188, 136, 33, 51, 131, 203, 41, 4, 251, 73, 37, 186, 137, 153, 25, 53, 18, 201, 171, 25, 115, 19, 203, 26, 1, 24, 69, 178, 173, 8, 17, 2, 153, 218, 140, 65, 35, 200, 156, 169, 58, 87, 168, 139, 50, 145, 139, 17, 0, 35, 168, 236, 156, 67, 2, 136, 176, 157, 82, 3, 234, 140, 32, 82, 146, 188, 155, 99, 2, 128, 137, 136, 25, 21, 169, 251, 10, 52, 36, 192, 173, 16, 17, 0, 8, 160, 156, 50, 34, 146, 206, 57, 35, 177, 223, 42, 37, 129, 153, 169, 154, 98, 18, 137, 169, 188, 40, 85, 130, 172, 138, 40, 37, 18, 234, 156, 32, 20, 0, 168, 172, 40, 35, 19, 205, 9, 168, 32, 53, 192, 10, 163, 157, 129, 24, 38, 152, 145, 175, 32, 1, 17, 1, 234, 140, 52, 3, 168, 202, 172, 48, 52, 161, 203, 169, 114, 4, 153, 9, 137, 16, 16, 35, 202, 138, 202, 27, 55, 160, 10, 0, 136, 72, 39, 185, 10, 200, 158, 16, 50, 18, 35, 221, 138, 136, 83, 161, 137, 251, 57, 55, 128, 153, 186, 139, 115, 3, 169, 171, 154, 50, 38, 217, 9, 1, 152, 202, 72, 37, 144, 185, 140, 18, 1, 50, 179, 191, 48, 18, 35, 232, 190, 40, 19, 50, 193, 159, 0, 16, 35, 153, 169, 172, 114, 18, 168, 138, 33, 130, 188, 136, 155, 84, 129, 187, 155, 48, 103, 160, 139, 128, 152, 27, 37, 171, 49, 176, 41, 1, 99, 129, 32, 68, 224, 11, 54, 201, 9, 192, 155, 17, 33, 36, 152, 186, 41, 35, 99, 192, 59, 23, 169, 170, 66, 185, 112, 146, 173, 64, 130, 189, 154, 81, 3, 170, 16, 145, 9, 2, 139, 36, 202, 56, 2, 68, 200, 136, 218, 24, 83, 131, 157, 144, 12, 3, 140, 84, 145, 156, 1, 171, 66, 53, 250, 15, 33, 18, 185, 10, 128, 81, 130, 154, 154, 137, 115, 146, 173, 0, 0, 65, 19, 201, 171, 8, 8, 35, 203, 25, 202, 113, 162, 155, 67, 3, 203, 41, 21, 169, 170, 138, 51, 218, 138, 97, 3, 155, 36, 9, 162, 90, 149, 175, 48, 3, 40, 177, 255, 24, 50, 145, 188, 25, 51, 152, 65, 178, 175, 16, 130, 8, 144, 155, 67, 3, 153, 16, 152, 8, 187, 96, 103, 177, 174, 40, 3, 136, 137, 33, 152, 40, 130, 88, 194, 175, 9, 40, 19, 16, 184, 158, 34, 83, 4, 154, 185, 174, 64, 36, 160, 171, 171, 32, 39, 145, 186, 137, 152, 117, 131, 188, 10, 33, 16, 18, 184, 172, 80, 3, 138, 160, 170, 204, 72, 35, 34, 144, 251, 142, 50, 1, 0, 219, 41, 161, 28, 71, 144, 138, 169, 25, 17, 83, 176, 157, 0, 0, 50, 19, 217, 205, 11, 100, 130, 153, 137, 153, 16, 51, 144, 205, 155, 48, 70, 130, 169, 186, 10, 34, 16, 38, 201, 156, 8, 90, 248, 54, 0, 98, 19, 218, 138, 1, 0, 52, 168, 138, 136, 50, 36, 160, 205, 188, 48, 37, 129, 128, 251, 139, 16, 48, 4, 169, 170, 24, 129, 97, 178, 142, 36, 216, 155, 99, 145, 24, 161, 154, 184, 141, 66, 52, 177, 175, 0, 136, 49, 3, 8, 2, 206, 24, 19, 168, 40, 39, 233, 139, 48, 84, 129, 188, 137, 65, 2, 185, 186, 154, 82, 2, 17, 234, 26, 21, 152, 41, 177, 175, 65, 129, 25, 129, 172, 66, 184, 16, 0, 99, 1, 144, 218, 24, 184, 156, 66, 131, 26, 71, 218, 138, 18, 1, 185, 155, 18, 81, 39, 235, 25, 19, 144, 170, 9, 52, 201, 11, 18, 17, 34, 178, 207, 0, 187, 104, 20, 152, 137, 187, 96, 3, 137, 128, 187, 172, 98, 20, 0, 152, 137, 201, 89, 37, 1, 160, 206, 155, 64, 52, 1, 202, 158, 32, 35, 34, 184, 203, 188, 56, 37, 144, 154, 184, 138, 82, 19, 8, 18, 252, 26, 53, 177, 187, 139, 99, 2, 16, 184, 156, 0, 8, 64, 20, 236, 138, 34, 67, 129, 205, 137, 17, 16, 145, 172, 81, 129, 9, 52, 177, 173, 16, 18, 184, 141, 35, 153, 99, 144, 8, 218, 140, 17, 34, 69, 178, 175, 0, 152, 16, 50, 18, 232, 175, 26, 83, 34, 128, 185, 172, 16, 83, 3, 218, 155, 9, 66, 36, 144, 186, 137, 186, 72, 37, 3, 186, 138, 184, 204, 139, 176, 43, 87, 1, 0, 185, 172, 80, 36, 17, 145, 222, 155, 16, 52, 34, 144, 205, 139, 65, 51, 160, 187, 168, 139, 85, 161, 10, 17, 186, 187, 24, 152, 117, 23, 136, 168, 172, 40, 52, 2, 137, 170, 190, 10, 68, 35, 160, 189, 11, 66, 35, 144, 218, 172, 56, 52, 161, 204, 25, 35, 34, 144, 185, 157, 98, 145, 155, 17, 16, 129, 221, 26, 66, 53, 162, 204, 153, 32, 35, 128, 201, 172, 24, 99, 129, 186, 171, 24, 115, 36, 17, 144, 202, 186, 25, 38, 177, 204, 10, 50, 145, 80, 20, 219, 138, 16, 0, 152, 137, 136, 168, 155, 82, 50, 68, 144, 204, 41, 53, 130, 233, 140, 83, 1, 186, 189, 41, 70, 2, 160, 172, 10, 50, 36, 18, 192, 206, 24, 33, 18, 185, 173, 138, 82, 51, 160, 171, 169, 112, 20, 185, 172, 8, 50, 1, 234, 188, 25, 50, 50, 35, 18, 224, 190, 72, 52, 129, 185, 221, 154, 33, 67, 144, 171, 16, 34, 16, 85, 129, 154, 16, 2, 152, 188, 139, 51, 2, 152, 220, 170, 188, 97, 54, 1, 202, 187, 25, 85, 34, 201, 204, 154, 48, 52, 129, 185, 138, 17, 16, 2, 170, 186, 172, 144, 27, 54, 1, 68, 145, 10, 146, 157, 2, 138, 87, 145, 204, 138, 66, 19, 153, 0, 8, 68, 208, 10, 69, 19, 218, 189, 25, 17, 33, 130, 186, 154, 8, 146, 156, 67, 50, 146, 239, 154, 64, 37, 146, 204, 154, 33, 67, 18, 19, 7, 52, 0, 129, 186, 154, 16, 2, 186, 136, 204, 137, 17, 136, 117, 5, 153, 49, 1, 152, 236, 139, 65, 52, 160, 188, 187, 57, 36, 19, 186, 32, 185, 89, 20, 128, 250, 154, 144, 155, 17, 16, 3, 187, 171, 204, 80, 87, 130, 137, 128, 156, 35, 128, 168, 189, 200, 12, 52, 1, 17, 67, 37, 145, 185, 171, 33, 218, 42, 232, 173, 153, 49, 17, 52, 128, 51, 0, 160, 173, 153, 56, 163, 173, 185, 219, 42, 55, 168, 186, 206, 41, 53, 34, 18, 201, 171, 144, 171, 18, 203, 186, 156, 8, 117, 37, 129, 153, 17, 145, 186, 189, 139, 84, 146, 186, 24, 52, 35, 176, 174, 98, 19, 136, 153, 205, 40, 20, 200, 188, 25, 2, 48, 5, 202, 9, 49, 38, 152, 153, 202, 154, 25, 67, 144, 137, 8, 186, 88, 70, 1, 136, 33, 19, 128, 154, 251, 156, 152, 41, 224, 156, 49, 35, 49, 22, 128, 66, 130, 171, 9, 200, 173, 152, 207, 9, 49, 18, 201, 139, 48, 85, 18, 169, 203, 41, 19, 186, 187, 41, 54, 83, 146, 187, 137, 34, 176, 138, 185, 97, 240, 140, 51, 0, 50, 200, 10, 17, 69, 33, 50, 232, 187, 202, 25, 36, 217, 25, 176, 43, 87, 1, 186, 138, 18, 18, 130, 222, 170, 137, 65, 2, 154, 153, 9, 50, 102, 35, 168, 169, 155, 48, 129, 136, 250, 203, 9, 68, 35, 144, 171, 8, 152, 116, 19, 192, 173, 137, 25, 53, 128, 171, 10, 144, 41, 69, 2, 152, 169, 154, 41, 84, 2, 218, 187, 138, 52, 161, 41, 3, 137, 160, 113, 133, 173, 8, 144, 40, 35, 176, 206, 138, 98, 35, 129, 202, 10, 168, 88, 21, 152, 153, 156, 136, 33, 131, 56, 194, 58, 149, 157, 16, 17, 19, 153, 170, 156, 138, 97, 131, 187, 24, 17, 33, 179, 223, 33, 129, 40, 129, 154, 204, 24, 18, 18, 9, 16, 219, 0, 0, 147, 10, 4, 153, 0, 186, 98, 131, 187, 1, 186, 66, 200, 58, 194, 138, 4, 186, 48, 162, 26, 4, 176, 25, 1, 9, 16, 18, 186, 27, 4, 0, 153, 185, 49, 162, 57, 162, 10, 146, 10, 34, 160, 0, 144, 17, 145, 41, 2, 153, 25, 16, 9, 16, 145, 9, 0, 145, 144, 16, 0, 0, 0, 0, 0, 9, 33, 169, 25, 145, 16, 0, 17, 153, 25, 0, 9, 0, 1, 0, 0, 144, 153, 0, 16, 1, 1, 153, 33, 144, 11, 17, 144, 41, 0, 9, 0, 25, 17, 169, 16, 17, 0, 0, 144, 153, 17, 1, 153, 25, 17, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 10, 17, 10, 1, 9, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 0, 1, 0, 0, 0, 144, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 1, 0 };
 
-static const size_t audio_lost_sample_data_length = sizeof(audio_lost_sample_data) / sizeof(audio_lost_sample_data[0]);
+static const size_t audio_lost_sample_data_length = 24356;
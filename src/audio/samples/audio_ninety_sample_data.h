@@ -1,4 +1,4 @@
-// This file was generated by a script on 20-11-2024 08:37:38
+// This file was generated by a script on 17-10-2026 14:18:56
 
 #pragma once
 
@@ -6,6 +6,7 @@
 #include <stdint.h>
 #include <pico/platform/sections.h>
 
-static const int16_t __in_flash("audio_ninety_sample_data") audio_ninety_sample_data[] = { 7, 0, -13, -20, -11, 5, 10, 5, 3, 8, 10, 7, 5, 5, 3, 0, -2, -4, -7, -2, 6, 10, 8, 6, 7, 10, 6, -1, -3, 1, 6, 3, 0, 2, 3, 0, -6, -6, 1, 9, 8, 0, -4, -3, 0, 1, 3, 7, 8, 10, 14, 18, 16, 10, 9, 12, 17, 19, 18, 13, 9, 11, 19, 22, 18, 16, 19, 22, 21, 19, 22, 23, 19, 11, 11, 18, 22, 21, 18, 20, 25, 28, 28, 28, 29, 31, 33, 33, 28, 19, 17, 23, 29, 25, 18, 14, 14, 12, 12, 16, 16, 11, 8, 7, 7, 7, 7, 8, 8, 7, 2, -1, -3, -2, -1, -1, -6, -11, -11, -3, 5, 5, -3, -11, -10, -4, 0, 0, -2, -2, 0, 5, 7, 1, -4, -8, -2, 5, 8, 7, 3, 2, 2, 0, -3, -2, 3, 9, 12, 13, 12, 7, 0, -3, -4, -8, -9, 0, 13, 21, 19, 12, 5, 0, 0, 2, 8, 13, 13, 8, 1, 0, 6, 14, 18, 12, 5, 3, 7, 10, 10, 10, 10, 6, 1, 1, 6, 13, 18, 14, 9, 8, 16, 23, 24, 20, 22, 29, 33, 29, 16, 3, 7, 20, 29, 22, 12, 12, 22, 29, 29, 22, 18, 23, 34, 42, 38, 30, 27, 31, 37, 39, 34, 24, 20, 27, 38, 43, 42, 40, 37, 31, 31, 41, 56, 65, 64, 59, 54, 51, 52, 56, 59, 50, 38, 38, 52, 64, 61, 53, 57, 72, 82, 82, 80, 80, 75, 63, 56, 61, 67, 66, 61, 62, 65, 64, 60, 65, 77, 81, 75, 71, 75, 87, 101, 109, 105, 92, 82, 84, 94, 103, 105, 103, 101, 101, 103, 103, 103, 104, 110, 119, 127, 130, 126, 123, 128, 138, 142, 140, 138, 137, 131, 126, 130, 144, 149, 141, 133, 136, 148, 155, 155, 152, 150, 145, 139, 139, 147, 150, 146, 140, 139, 139, 133, 129, 137, 146, 145, 139, 137, 138, 135, 133, 139, 147, 141, 127, 120, 127, 134, 129, 121, 123, 127, 121, 107, 99, 103, 108, 105, 101, 98, 96, 91, 88, 92, 94, 84, 70, 63, 65, 69, 67, 66, 63, 52, 40, 41, 54, 57, 42, 20, 12, 13, 6, -6, -9, -3, -6, -15, -21, -20, -21, -23, -22, -21, -30, -42, -51, -54, -54, -55, -61, -75, -94, -105, -106, -100, -100, -108, -125, -140, -150, -153, -152, -150, -148, -151, -160, -167, -162, -153, -149, -156, -172, -190, -198, -196, -199, -207, -214, -214, -220, -237, -259, -273, -276, -279, -284, -283, -280, -291, -307, -311, -313, -328, -340, -331, -317, -323, -342, -347, -342, -355, -377, -379, -356, -342, -349, -363, -363, -353, -344, -337, -319, -298, -287, -287, -277, -254, -233, -222, -205, -179, -159, -149, -126, -87, -57, -51, -41, -9, 34, 76, 112, 137, 152, 168, 197, 233, 266, 290, 310, 332, 357, 385, 421, 454, 480, 506, 540, 578, 605, 625, 653, 689, 714, 727, 746, 777, 799, 805, 818, 851, 880, 879, 870, 887, 919, 934, 934, 943, 958, 959, 955, 971, 1002, 1005, 973, 946, 947, 955, 946, 935, 932, 918, 887, 865, 871, 883, 873, 844, 815, 791, 774, 758, 742, 717, 684, 652, 623, 589, 556, 536, 521, 488, 442, 411, 398, 375, 330, 288, 265, 240, 193, 140, 98, 63, 19, -30, -71, -104, -145, -196, -236, -256, -278, -327, -382, -412, -425, -458, -512, -555, -577, -608, -659, -705, -728, -744, -775, -820, -863, -892, -913, -927, -937, -947, -967, -998, -1021, -1029, -1037, -1063, -1090, -1102, -1106, -1121, -1142, -1154, -1169, -1193, -1207, -1200, -1191, -1203, -1227, -1245, -1254, -1267, -1280, -1280, -1274, -1278, -1294, -1303, -1298, -1292, -1294, -1289, -1268, -1243, -1225, -1206, -1186, -1178, -1185, -1193, -1179, -1155, -1148, -1158, -1169, -1174, -1181, -1181, -1163, -1136, -1115, -1106, -1096, -1077, -1057, -1044, -1035, -1027, -1025, -1026, -1021, -1011, -1011, -1023, -1029, -1014, -983, -955, -944, -948, -950, -935, -914, -904, -895, -880, -871, -884, -896, -891, -884, -891, -889, -871, -859, -865, -865, -845, -819, -800, -788, -778, -776, -778, -780, -784, -790, -800, -812, -831, -855, -873, -875, -865, -856, -856, -863, -870, -873, -866, -843, -819, -819, -846, -874, -878, -877, -894, -914, -910, -897, -909, -940, -950, -927, -905, -914, -946, -977, -1000, -1018, -1026, -1034, -1056, -1093, -1119, -1119, -1107, -1100, -1100, -1105, -1117, -1127, -1120, -1108, -1112, -1136, -1158, -1172, -1181, -1180, -1168, -1161, -1171, -1173, -1139, -1086, -1059, -1057, -1029, -961, -912, -910, -915, -881, -833, -824, -844, -850, -839, -844, -863, -849, -793, -749, -750, -761, -736, -685, -647, -635, -641, -679, -758, -859, -947, -1027, -1121, -1215, -1275, -1296, -1292, -1247, -1133, -969, -799, -649, -510, -375, -243, -121, -18, 61, 120, 162, 198, 259, 372, 512, 637, 741, 863, 1030, 1234, 1459, 1687, 1898, 2085, 2277, 2496, 2734, 2960, 3157, 3325, 3481, 3651, 3847, 4062, 4281, 4499, 4718, 4941, 5180, 5439, 5688, 5909, 6114, 6318, 6500, 6639, 6761, 6886, 7027, 7176, 7333, 7479, 7604, 7738, 7916, 8119, 8301, 8457, 8607, 8750, 8863, 8948, 9030, 9112, 9166, 9166, 9129, 9097, 9089, 9098, 9104, 9094, 9062, 9010, 8948, 8887, 8822, 8740, 8648, 8552, 8441, 8289, 8110, 7949, 7819, 7696, 7563, 7411, 7240, 7061, 6905, 6783, 6667, 6527, 6355, 6159, 5943, 5718, 5496, 5274, 5041, 4792, 4520, 4221, 3916, 3640, 3404, 3177, 2943, 2710, 2498, 2283, 2054, 1821, 1603, 1371, 1095, 800, 528, 267, -17, -323, -622, -916, -1222, -1526, -1796, -2034, -2272, -2519, -2759, -2984, -3215, -3458, -3698, -3920, -4134, -4358, -4588, -4799, -4985, -5157, -5324, -5479, -5623, -5758, -5884, -5987, -6062, -6129, -6212, -6311, -6416, -6512, -6601, -6674, -6744, -6827, -6934, -7044, -7129, -7192, -7253, -7305, -7328, -7332, -7343, -7352, -7337, -7309, -7292, -7287, -7284, -7277, -7269, -7249, -7217, -7189, -7168, -7141, -7094, -7024, -6942, -6854, -6765, -6671, -6575, -6480, -6380, -6261, -6130, -6010, -5906, -5804, -5688, -5568, -5451, -5337, -5227, -5117, -4995, -4852, -4702, -4557, -4405, -4244, -4084, -3940, -3805, -3666, -3524, -3391, -3269, -3149, -3034, -2932, -2833, -2718, -2588, -2459, -2334, -2206, -2085, -1979, -1866, -1733, -1599, -1499, -1420, -1336, -1244, -1165, -1105, -1038, -956, -870, -791, -707, -611, -521, -451, -396, -343, -288, -227, -160, -100, -62, -40, -15, 20, 53, 69, 71, 71, 65, 51, 37, 41, 60, 70, 57, 42, 39, 38, 21, -2, -21, -40, -68, -96, -106, -100, -96, -104, -117, -127, -128, -129, -142, -167, -188, -200, -214, -234, -257, -289, -335, -377, -401, -423, -467, -515, -542, -555, -579, -608, -621, -622, -629, -644, -656, -659, -671, -696, -720, -728, -724, -718, -708, -695, -689, -691, -682, -646, -607, -594, -593, -571, -536, -529, -539, -521, -471, -437, -434, -414, -344, -264, -216, -183, -119, -34, 27, 64, 121, 206, 290, 355, 413, 469, 518, 567, 627, 691, 743, 785, 831, 883, 919, 936, 957, 1011, 1086, 1143, 1169, 1188, 1226, 1274, 1318, 1361, 1408, 1445, 1459, 1469, 1493, 1529, 1555, 1576, 1605, 1641, 1668, 1680, 1686, 1686, 1672, 1655, 1655, 1661, 1638, 1586, 1551, 1558, 1568, 1541, 1492, 1469, 1460, 1418, 1351, 1310, 1310, 1305, 1266, 1217, 1180, 1148, 1114, 1081, 1042, 979, 897, 822, 766, 712, 655, 603, 542, 453, 355, 298, 270, 221, 139, 77, 52, 18, -54, -131, -180, -223, -294, -369, -416, -455, -507, -547, -554, -573, -638, -704, -723, -724, -752, -795, -821, -837, -865, -912, -951, -967, -963, -970, -1001, -1035, -1052, -1059, -1069, -1066, -1041, -1026, -1050, -1084, -1095, -1087, -1080, -1083, -1085, -1082, -1064, -1037, -1014, -998, -970, -927, -887, -864, -848, -828, -803, -769, -727, -702, -706, -714, -694, -657, -629, -610, -579, -531, -484, -454, -428, -391, -342, -291, -245, -214, -204, -196, -167, -116, -63, -15, 33, 82, 125, 173, 242, 319, 390, 445, 486, 518, 552, 599, 652, 696, 716, 711, 695, 700, 730, 756, 759, 757, 767, 770, 765, 773, 788, 773, 725, 691, 675, 632, 546, 464, 407, 342, 247, 158, 124, 150, 220, 334, 491, 646, 764, 873, 1004, 1133, 1217, 1273, 1339, 1410, 1456, 1481, 1520, 1590, 1683, 1796, 1948, 2136, 2324, 2485, 2641, 2825, 3029, 3208, 3351, 3493, 3682, 3896, 4075, 4203, 4327, 4486, 4647, 4778, 4913, 5089, 5277, 5433, 5579, 5762, 5966, 6140, 6286, 6455, 6650, 6813, 6910, 6986, 7092, 7216, 7328, 7432, 7543, 7657, 7767, 7875, 7972, 8039, 8095, 8160, 8225, 8262, 8260, 8241, 8214, 8194, 8197, 8227, 8242, 8205, 8142, 8099, 8068, 8004, 7911, 7831, 7759, 7639, 7471, 7304, 7140, 6948, 6748, 6595, 6479, 6345, 6182, 6039, 5924, 5791, 5620, 5451, 5309, 5154, 4947, 4709, 4455, 4176, 3870, 3589, 3347, 3097, 2810, 2530, 2302, 2100, 1866, 1606, 1366, 1156, 925, 646, 347, 61, -222, -520, -834, -1155, -1492, -1837, -2161, -2438, -2679, -2919, -3168, -3418, -3657, -3896, -4125, -4339, -4548, -4774, -5028, -5295, -5552, -5782, -5978, -6152, -6328, -6519, -6715, -6889, -7011, -7089, -7151, -7226, -7330, -7438, -7519, -7565, -7614, -7693, -7800, -7918, -8037, -8128, -8179, -8217, -8286, -8367, -8431, -8483, -8521, -8522, -8495, -8499, -8543, -8575, -8575, -8585, -8617, -8632, -8606, -8574, -8555, -8537, -8502, -8450, -8388, -8314, -8228, -8141, -8056, -7971, -7891, -7814, -7745, -7671, -7593, -7516, -7454, -7390, -7306, -7196, -7081, -6969, -6857, -6740, -6620, -6496, -6351, -6194, -6053, -5939, -5830, -5708, -5576, -5451, -5324, -5188, -5059, -4940, -4803, -4625, -4442, -4291, -4146, -3982, -3824, -3703, -3580, -3424, -3273, -3168, -3083, -2971, -2832, -2695, -2557, -2406, -2245, -2097, -1973, -1858, -1727, -1580, -1442, -1324, -1206, -1085, -983, -907, -827, -724, -635, -576, -526, -464, -402, -352, -305, -248, -196, -157, -119, -70, -10, 43, 74, 82, 95, 139, 211, 289, 363, 435, 509, 579, 652, 731, 805, 851, 872, 896, 933, 959, 967, 978, 992, 988, 970, 979, 1018, 1043, 1037, 1032, 1049, 1071, 1088, 1109, 1136, 1146, 1126, 1099, 1103, 1136, 1158, 1143, 1122, 1130, 1152, 1160, 1175, 1227, 1279, 1285, 1274, 1288, 1295, 1250, 1196, 1174, 1157, 1115, 1087, 1098, 1108, 1092, 1085, 1124, 1181, 1215, 1232, 1257, 1292, 1312, 1312, 1314, 1333, 1350, 1345, 1331, 1327, 1324, 1305, 1278, 1273, 1287, 1291, 1268, 1229, 1199, 1178, 1158, 1124, 1071, 1005, 947, 900, 858, 822, 796, 772, 741, 714, 714, 727, 719, 677, 631, 607, 587, 543, 474, 407, 358, 309, 238, 155, 77, 19, -23, -55, -84, -121, -183, -259, -316, -328, -323, -340, -364, -373, -385, -423, -449, -430, -408, -433, -470, -462, -428, -423, -441, -445, -439, -460, -498, -499, -457, -431, -455, -489, -489, -472, -476, -483, -451, -396, -372, -388, -396, -371, -343, -342, -344, -327, -306, -295, -284, -266, -251, -238, -219, -184, -139, -92, -58, -47, -46, -28, 5, 17, 2, 0, 39, 92, 106, 92, 101, 139, 176, 206, 258, 325, 371, 395, 418, 453, 493, 540, 585, 610, 620, 641, 690, 748, 796, 824, 856, 924, 1024, 1117, 1160, 1161, 1163, 1189, 1221, 1233, 1221, 1183, 1114, 1024, 950, 916, 903, 871, 812, 756, 712, 656, 575, 508, 472, 426, 319, 179, 54, -67, -225, -395, -534, -644, -745, -808, -807, -763, -714, -642, -514, -352, -217, -126, -34, 66, 141, 179, 220, 283, 343, 404, 495, 617, 743, 876, 1047, 1274, 1533, 1809, 2089, 2353, 2585, 2813, 3085, 3391, 3667, 3892, 4109, 4344, 4572, 4791, 5025, 5271, 5506, 5751, 6050, 6382, 6673, 6917, 7170, 7461, 7740, 7969, 8182, 8409, 8615, 8761, 8900, 9083, 9282, 9445, 9586, 9756, 9957, 10141, 10290, 10418, 10544, 10661, 10761, 10838, 10891, 10922, 10933, 10940, 10942, 10933, 10916, 10900, 10888, 10873, 10835, 10761, 10654, 10548, 10469, 10379, 10244, 10077, 9908, 9727, 9518, 9322, 9161, 9010, 8836, 8657, 8495, 8337, 8157, 7964, 7777, 7587, 7365, 7093, 6787, 6480, 6177, 5852, 5515, 5209, 4949, 4690, 4392, 4084, 3800, 3530, 3267, 3010, 2740, 2428, 2092, 1769, 1449, 1099, 733, 381, 22, -361, -753, -1112, -1434, -1734, -2017, -2300, -2600, -2929, -3248, -3533, -3803, -4102, -4428, -4742, -5030, -5302, -5553, -5788, -6033, -6285, -6490, -6620, -6725, -6859, -7008, -7135, -7238, -7347, -7443, -7512, -7584, -7712, -7888, -8050, -8179, -8310, -8452, -8570, -8665, -8773, -8889, -8972, -9012, -9055, -9130, -9216, -9282, -9331, -9382, -9440, -9493, -9537, -9576, -9602, -9606, -9585, -9550, -9510, -9464, -9417, -9372, -9324, -9270, -9222, -9185, -9156, -9130, -9105, -9089, -9069, -9026, -8965, -8903, -8841, -8757, -8643, -8516, -8392, -8268, -8144, -8024, -7904, -7767, -7622, -7500, -7411, -7321, -7204, -7077, -6950, -6809, -6649, -6496, -6360, -6213, -6049, -5889, -5749, -5605, -5445, -5298, -5191, -5108, -4997, -4839, -4669, -4521, -4389, -4244, -4084, -3924, -3750, -3547, -3344, -3186, -3059, -2905, -2711, -2524, -2368, -2224, -2077, -1946, -1839, -1734, -1610, -1489, -1395, -1317, -1224, -1117, -1029, -969, -912, -834, -759, -713, -682, -643, -600, -572, -552, -520, -475, -433, -387, -322, -243, -180, -148, -136, -135, -147, -171, -179, -141, -79, -53, -84, -121, -117, -93, -78, -42, 51, 160, 218, 219, 208, 200, 190, 204, 268, 350, 375, 323, 255, 235, 270, 344, 429, 475, 450, 404, 395, 406, 394, 382, 393, 385, 329, 273, 263, 270, 251, 219, 202, 202, 221, 264, 316, 337, 325, 322, 355, 397, 422, 447, 508, 586, 629, 626, 610, 608, 628, 683, 784, 884, 900, 815, 716, 698, 762, 852, 913, 894, 792, 693, 683, 736, 766, 763, 779, 813, 826, 824, 843, 871, 865, 830, 805, 804, 805, 802, 813, 830, 819, 776, 740, 741, 778, 829, 865, 843, 751, 641, 591, 599, 599, 553, 497, 458, 405, 323, 273, 285, 304, 274, 224, 178, 106, 11, -42, -53, -103, -211, -291, -285, -249, -260, -305, -321, -317, -337, -366, -352, -290, -249, -269, -313, -340, -355, -367, -338, -252, -174, -175, -222, -220, -143, -44, 31, 74, 88, 103, 166, 284, 384, 405, 379, 389, 455, 509, 496, 440, 412, 432, 474, 502, 513, 528, 571, 628, 657, 630, 583, 571, 602, 629, 616, 577, 544, 533, 547, 593, 651, 683, 673, 662, 700, 785, 860, 884, 866, 841, 823, 819, 829, 839, 832, 812, 809, 836, 880, 928, 987, 1054, 1114, 1156, 1184, 1202, 1193, 1139, 1049, 950, 865, 787, 704, 616, 535, 476, 430, 393, 362, 344, 336, 305, 230, 116, -24, -205, -439, -706, -956, -1159, -1332, -1493, -1626, -1685, -1643, -1499, -1272, -1013, -769, -537, -295, -76, 31, 10, -64, -102, -90, -71, -72, -81, -49, 67, 263, 490, 728, 1011, 1384, 1833, 2271, 2606, 2827, 3019, 3268, 3572, 3859, 4067, 4225, 4411, 4661, 4944, 5231, 5547, 5922, 6347, 6775, 7174, 7535, 7854, 8131, 8385, 8621, 8828, 8981, 9115, 9280, 9462, 9617, 9763, 9973, 10265, 10585, 10892, 11187, 11454, 11668, 11844, 12007, 12153, 12270, 12347, 12383, 12382, 12370, 12383, 12423, 12473, 12526, 12583, 12628, 12647, 12653, 12667, 12654, 12560, 12377, 12181, 12019, 11857, 11676, 11497, 11329, 11142, 10950, 10815, 10760, 10735, 10681, 10591, 10461, 10290, 10082, 9858, 9624, 9363, 9031, 8607, 8138, 7719, 7376, 7054, 6721, 6412, 6144, 5865, 5541, 5223, 4955, 4705, 4409, 4052, 3663, 3256, 2834, 2417, 2036, 1679, 1297, 873, 460, 114, -172, -446, -715, -973, -1245, -1575, -1948, -2300, -2623, -2972, -3369, -3781, -4160, -4505, -4806, -5047, -5235, -5422, -5632, -5816, -5930, -5998, -6081, -6184, -6292, -6417, -6591, -6781, -6927, -7023, -7137, -7312, -7519, -7711, -7897, -8070, -8197, -8274, -8366, -8513, -8676, -8825, -8969, -9120, -9261, -9397, -9553, -9732, -9892, -10002, -10065, -10117, -10172, -10224, -10243, -10225, -10189, -10143, -10096, -10071, -10097, -10147, -10173, -10167, -10164, -10177, -10205, -10254, -10321, -10357, -10336, -10283, -10235, -10182, -10113, -10039, -9972, -9895, -9805, -9737, -9694, -9644, -9553, -9431, -9324, -9262, -9207, -9100, -8935, -8765, -8621, -8475, -8307, -8147, -8011, -7884, -7775, -7704, -7643, -7546, -7449, -7390, -7342, -7252, -7127, -6997, -6847, -6679, -6530, -6405, -6256, -6063, -5861, -5680, -5519, -5378, -5262, -5158, -5036, -4888, -4737, -4612, -4519, -4442, -4359, -4260, -4137, -3991, -3840, -3737, -3695, -3666, -3611, -3548, -3497, -3432, -3348, -3294, -3284, -3254, -3158, -3020, -2862, -2693, -2567, -2506, -2434, -2271, -2077, -1962, -1928, -1901, -1861, -1823, -1772, -1682, -1594, -1570, -1594, -1576, -1485, -1385, -1328, -1286, -1218, -1147, -1099, -1052, -974, -901, -869, -831, -724, -606, -567, -561, -464, -298, -181, -117, -12, 133, 233, 295, 396, 531, 609, 615, 628, 703, 794, 840, 855, 894, 973, 1079, 1203, 1337, 1457, 1550, 1643, 1764, 1888, 1985, 2078, 2205, 2344, 2440, 2503, 2596, 2724, 2829, 2890, 2950, 3027, 3100, 3160, 3226, 3284, 3295, 3251, 3197, 3185, 3226, 3272, 3263, 3198, 3124, 3068, 3032, 3027, 3059, 3070, 3004, 2905, 2851, 2839, 2810, 2766, 2738, 2701, 2613, 2509, 2456, 2449, 2411, 2301, 2150, 2011, 1896, 1781, 1654, 1538, 1438, 1320, 1170, 1035, 949, 881, 797, 721, 656, 555, 417, 306, 244, 171, 59, -49, -132, -232, -354, -449, -501, -556, -656, -773, -871, -950, -1023, -1082, -1126, -1180, -1258, -1329, -1362, -1385, -1439, -1501, -1524, -1506, -1490, -1483, -1453, -1393, -1339, -1298, -1246, -1186, -1168, -1187, -1184, -1125, -1062, -1041, -1045, -1034, -995, -942, -885, -821, -750, -684, -626, -568, -500, -430, -391, -403, -441, -455, -425, -394, -405, -436, -451, -459, -466, -433, -339, -243, -202, -194, -166, -122, -107, -121, -129, -121, -127, -151, -157, -120, -75, -71, -89, -64, 31, 150, 237, 288, 323, 350, 371, 405, 454, 491, 520, 571, 648, 707, 726, 741, 802, 909, 1014, 1087, 1124, 1117, 1073, 1024, 991, 944, 866, 788, 730, 669, 607, 589, 616, 626, 588, 544, 517, 477, 398, 294, 166, -12, -241, -458, -601, -678, -734, -782, -789, -732, -625, -475, -257, 29, 325, 539, 638, 669, 707, 787, 859, 844, 744, 666, 734, 932, 1111, 1180, 1216, 1380, 1724, 2154, 2544, 2841, 3067, 3267, 3493, 3766, 4041, 4254, 4403, 4553, 4744, 4956, 5160, 5375, 5642, 5967, 6317, 6651, 6971, 7290, 7598, 7860, 8061, 8224, 8365, 8494, 8630, 8795, 8960, 9091, 9198, 9322, 9479, 9680, 9948, 10253, 10490, 10606, 10663, 10735, 10851, 11007, 11172, 11262, 11221, 11101, 11016, 10996, 10986, 10952, 10927, 10941, 10949, 10888, 10766, 10657, 10611, 10583, 10496, 10321, 10117, 9965, 9891, 9848, 9766, 9623, 9460, 9344, 9298, 9293, 9278, 9219, 9104, 8934, 8722, 8500, 8296, 8085, 7830, 7532, 7237, 6935, 6586, 6242, 6005, 5869, 5711, 5461, 5190, 4972, 4779, 4558, 4326, 4105, 3863, 3546, 3184, 2841, 2526, 2215, 1919, 1644, 1339, 982, 651, 423, 255, 42, -244, -555, -859, -1161, -1461, -1728, -1962, -2209, -2500, -2809, -3080, -3297, -3477, -3625, -3742, -3846, -3959, -4076, -4176, -4272, -4379, -4474, -4531, -4594, -4727, -4918, -5116, -5317, -5542, -5763, -5928, -6058, -6223, -6446, -6666, -6826, -6933, -7034, -7158, -7308, -7473, -7617, -7701, -7741, -7797, -7889, -7986, -8057, -8102, -8111, -8091, -8085, -8125, -8194, -8243, -8268, -8297, -8340, -8374, -8386, -8403, -8449, -8524, -8594, -8630, -8615, -8564, -8523, -8521, -8524, -8502, -8468, -8432, -8376, -8304, -8260, -8247, -8216, -8159, -8118, -8080, -7990, -7862, -7775, -7739, -7694, -7605, -7501, -7398, -7286, -7194, -7184, -7247, -7268, -7173, -7023, -6921, -6871, -6808, -6712, -6612, -6503, -6370, -6224, -6112, -6032, -5944, -5824, -5690, -5550, -5404, -5291, -5240, -5207, -5111, -4963, -4839, -4777, -4749, -4737, -4734, -4714, -4659, -4589, -4531, -4489, -4460, -4453, -4462, -4446, -4376, -4269, -4163, -4074, -3999, -3930, -3848, -3721, -3545, -3376, -3280, -3242, -3192, -3089, -2963, -2862, -2810, -2792, -2778, -2740, -2687, -2642, -2618, -2596, -2560, -2514, -2473, -2440, -2399, -2351, -2323, -2340, -2367, -2347, -2261, -2159, -2093, -2068, -2046, -1981, -1848, -1671, -1510, -1402, -1319, -1216, -1090, -973, -893, -860, -866, -871, -825, -739, -654, -592, -530, -443, -318, -159, 12, 181, 354, 536, 709, 866, 1040, 1237, 1417, 1555, 1679, 1812, 1947, 2078, 2211, 2314, 2375, 2441, 2565, 2713, 2809, 2852, 2890, 2939, 2962, 2951, 2930, 2909, 2880, 2854, 2857, 2876, 2871, 2852, 2873, 2931, 2962, 2936, 2891, 2862, 2823, 2758, 2698, 2661, 2600, 2474, 2320, 2201, 2111, 2011, 1905, 1814, 1708, 1554, 1385, 1259, 1169, 1067, 934, 777, 607, 445, 321, 240, 167, 70, -50, -157, -227, -266, -298, -335, -381, -450, -562, -699, -813, -884, -934, -989, -1054, -1140, -1248, -1342, -1368, -1328, -1279, -1280, -1330, -1389, -1410, -1382, -1339, -1343, -1413, -1493, -1511, -1451, -1375, -1343, -1352, -1354, -1323, -1266, -1192, -1095, -991, -910, -854, -795, -731, -686, -650, -574, -472, -414, -416, -408, -342, -248, -169, -95, -6, 86, 168, 266, 398, 511, 559, 578, 631, 705, 752, 788, 860, 946, 982, 973, 987, 1062, 1162, 1241, 1292, 1331, 1350, 1346, 1349, 1374, 1398, 1392, 1366, 1352, 1349, 1329, 1288, 1250, 1237, 1236, 1223, 1195, 1175, 1173, 1170, 1139, 1075, 1007, 966, 958, 960, 948, 919, 882, 861, 886, 948, 994, 994, 982, 1008, 1058, 1082, 1060, 1020, 993, 993, 1021, 1071, 1115, 1119, 1097, 1096, 1141, 1206, 1266, 1326, 1394, 1463, 1535, 1612, 1690, 1755, 1809, 1857, 1907, 1970, 2057, 2154, 2232, 2282, 2315, 2332, 2342, 2374, 2435, 2480, 2463, 2398, 2340, 2323, 2340, 2365, 2388, 2407, 2410, 2379, 2334, 2319, 2340, 2333, 2257, 2159, 2105, 2077, 2025, 1957, 1906, 1859, 1798, 1774, 1851, 2028, 2228, 2378, 2468, 2528, 2589, 2661, 2726, 2751, 2722, 2658, 2605, 2571, 2505, 2363, 2173, 2031, 1999, 2046, 2079, 2049, 1994, 1956, 1913, 1832, 1761, 1785, 1903, 2016, 2022, 1898, 1719, 1601, 1615, 1728, 1832, 1842, 1767, 1684, 1650, 1663, 1685, 1693, 1683, 1653, 1595, 1505, 1409, 1338, 1303, 1291, 1278, 1273, 1303, 1392, 1511, 1612, 1659, 1667, 1687, 1764, 1892, 2010, 2044, 1988, 1910, 1885, 1897, 1895, 1881, 1885, 1898, 1894, 1884, 1891, 1903, 1899, 1897, 1918, 1939, 1921, 1862, 1799, 1774, 1799, 1846, 1876, 1880, 1894, 1950, 2040, 2120, 2174, 2217, 2266, 2313, 2353, 2376, 2353, 2269, 2168, 2097, 2033, 1940, 1847, 1789, 1724, 1607, 1487, 1423, 1401, 1375, 1346, 1322, 1274, 1183, 1092, 1053, 1072, 1120, 1172, 1214, 1225, 1191, 1142, 1152, 1268, 1446, 1590, 1654, 1665, 1670, 1696, 1772, 1873, 1902, 1807, 1683, 1641, 1663, 1679, 1695, 1725, 1710, 1623, 1570, 1657, 1857, 2066, 2190, 2186, 2078, 1968, 1968, 2099, 2277, 2379, 2330, 2131, 1887, 1734, 1743, 1859, 1937, 1854, 1628, 1413, 1343, 1391, 1440, 1445, 1425, 1387, 1326, 1281, 1295, 1321, 1297, 1221, 1136, 1057, 996, 982, 1030, 1099, 1127, 1093, 1033, 1005, 1042, 1127, 1201, 1192, 1069, 873, 699, 618, 598, 546, 436, 310, 189, 67, -19, -36, -30, -58, -111, -166, -246, -343, -381, -371, -430, -596, -749, -810, -845, -947, -1097, -1225, -1310, -1399, -1536, -1704, -1826, -1874, -1905, -1995, -2144, -2308, -2450, -2549, -2596, -2636, -2730, -2844, -2911, -2944, -2988, -3015, -2992, -2980, -3026, -3062, -3022, -2971, -3012, -3117, -3175, -3158, -3143, -3204, -3327, -3422, -3423, -3370, -3342, -3352, -3347, -3304, -3236, -3151, -3066, -3020, -2994, -2928, -2846, -2841, -2901, -2923, -2886, -2849, -2805, -2711, -2631, -2632, -2647, -2585, -2480, -2415, -2396, -2399, -2436, -2485, -2487, -2444, -2441, -2524, -2617, -2629, -2576, -2533, -2511, -2472, -2425, -2418, -2443, -2443, -2389, -2305, -2240, -2248, -2346, -2462, -2505, -2486, -2486, -2525, -2572, -2636, -2724, -2784, -2777, -2736, -2719, -2752, -2832, -2915, -2939, -2912, -2938, -3068, -3224, -3338, -3449, -3581, -3682, -3729, -3786, -3903, -4071, -4238, -4327, -4283, -4176, -4158, -4277, -4423, -4497, -4525, -4558, -4616, -4702, -4808, -4905, -4984, -5058, -5111, -5113, -5089, -5081, -5070, -5031, -4990, -4954, -4875, -4775, -4770, -4848, -4872, -4783, -4665, -4573, -4495, -4474, -4557, -4650, -4606, -4431, -4270, -4210, -4207, -4199, -4185, -4163, -4100, -3992, -3902, -3889, -3929, -3963, -3970, -3951, -3916, -3881, -3870, -3875, -3853, -3774, -3654, -3515, -3388, -3313, -3309, -3331, -3286, -3142, -2973, -2881, -2890, -2945, -2996, -3006, -2930, -2748, -2533, -2411, -2402, -2378, -2239, -2028, -1819, -1619, -1445, -1362, -1364, -1336, -1225, -1112, -1079, -1109, -1152, -1187, -1203, -1181, -1126, -1063, -1013, -988, -969, -908, -774, -596, -448, -376, -373, -415, -492, -572, -587, -524, -472, -508, -589, -638, -641, -608, -510, -349, -217, -187, -201, -159, -67, -3, 30, 96, 192, 238, 232, 267, 382, 502, 573, 626, 704, 816, 982, 1215, 1451, 1594, 1639, 1682, 1788, 1923, 2032, 2121, 2213, 2289, 2329, 2374, 2483, 2659, 2858, 3050, 3227, 3370, 3465, 3532, 3602, 3683, 3750, 3795, 3835, 3862, 3871, 3901, 3990, 4104, 4193, 4258, 4345, 4452, 4556, 4663, 4759, 4793, 4742, 4657, 4603, 4585, 4566, 4508, 4412, 4304, 4221, 4193, 4219, 4267, 4300, 4303, 4297, 4310, 4327, 4320, 4278, 4224, 4179, 4141, 4093, 4036, 3972, 3906, 3858, 3852, 3888, 3949, 3983, 3932, 3812, 3740, 3764, 3750, 3588, 3393, 3300, 3247, 3131, 2992, 2874, 2715, 2532, 2442, 2429, 2339, 2153, 1994, 1898, 1789, 1654, 1530, 1380, 1160, 911, 698, 527, 366, 201, 19, -172, -339, -454, -516, -541, -542, -565, -646, -759, -842, -862, -832, -791, -809, -923, -1059, -1111, -1082, -1051, -1023, -950, -865, -855, -910, -935, -887, -818, -802, -885, -1051, -1213, -1279, -1248, -1214, -1249, -1336, -1402, -1394, -1314, -1208, -1146, -1187, -1308, -1400, -1399, -1371, -1410, -1523, -1634, -1695, -1708, -1684, -1628, -1576, -1565, -1569, -1536, -1477, -1447, -1436, -1379, -1301, -1278, -1290, -1236, -1106, -1001, -952, -865, -683, -469, -291, -120, 104, 363, 591, 775, 959, 1158, 1354, 1538, 1713, 1863, 1981, 2102, 2264, 2445, 2603, 2752, 2939, 3144, 3296, 3396, 3532, 3728, 3912, 4045, 4153, 4233, 4260, 4273, 4337, 4418, 4425, 4342, 4225, 4153, 4185, 4296, 4337, 4185, 3908, 3660, 3508, 3444, 3391, 3152, 2575, 1835, 1285, 1043, 1019, 1145, 1277, 1149, 772, 591, 895, 1420, 1780, 1863, 1699, 1348, 1041, 967, 988, 873, 648, 436, 232, 70, 94, 305, 503, 578, 567, 514, 512, 735, 1178, 1555, 1641, 1529, 1416, 1402, 1523, 1783, 2069, 2245, 2319, 2410, 2584, 2844, 3218, 3703, 4166, 4452, 4571, 4684, 4843, 4919, 4824, 4676, 4627, 4673, 4731, 4785, 4857, 4939, 5037, 5207, 5484, 5819, 6124, 6351, 6523, 6676, 6808, 6897, 6934, 6965, 7043, 7177, 7302, 7357, 7365, 7414, 7536, 7691, 7845, 8001, 8135, 8165, 8056, 7883, 7757, 7687, 7578, 7385, 7183, 7073, 7039, 6984, 6896, 6867, 6949, 7088, 7231, 7378, 7513, 7564, 7499, 7373, 7246, 7118, 6985, 6853, 6694, 6443, 6111, 5805, 5637, 5589, 5540, 5405, 5220, 5074, 4987, 4886, 4683, 4375, 4049, 3772, 3513, 3189, 2789, 2385, 2059, 1823, 1654, 1534, 1456, 1395, 1332, 1255, 1127, 896, 573, 262, 19, -226, -572, -995, -1403, -1752, -2056, -2318, -2539, -2751, -2965, -3125, -3190, -3237, -3387, -3620, -3811, -3933, -4091, -4325, -4557, -4740, -4943, -5229, -5537, -5774, -5921, -6031, -6145, -6287, -6471, -6694, -6916, -7125, -7356, -7608, -7832, -8042, -8308, -8615, -8844, -8969, -9084, -9246, -9405, -9507, -9564, -9566, -9510, -9458, -9501, -9635, -9751, -9767, -9730, -9739, -9825, -9922, -9962, -9955, -9944, -9923, -9870, -9812, -9759, -9677, -9568, -9522, -9582, -9657, -9660, -9646, -9697, -9758, -9730, -9650, -9633, -9681, -9684, -9583, -9449, -9322, -9184, -9082, -9077, -9088, -8975, -8804, -8757, -8829, -8854, -8791, -8748, -8748, -8694, -8549, -8395, -8306, -8268, -8207, -8066, -7866, -7694, -7594, -7515, -7403, -7259, -7116, -6987, -6874, -6791, -6737, -6671, -6565, -6452, -6376, -6307, -6172, -5956, -5742, -5600, -5529, -5479, -5404, -5283, -5140, -5058, -5083, -5153, -5142, -5012, -4848, -4734, -4652, -4545, -4413, -4292, -4176, -4036, -3890, -3797, -3771, -3744, -3655, -3502, -3333, -3209, -3173, -3199, -3179, -3024, -2800, -2650, -2593, -2519, -2373, -2199, -2033, -1874, -1764, -1741, -1750, -1677, -1503, -1315, -1202, -1170, -1161, -1105, -953, -733, -539, -438, -377, -264, -115, -12, 65, 221, 447, 609, 658, 725, 924, 1181, 1341, 1391, 1465, 1658, 1924, 2154, 2291, 2345, 2376, 2457, 2609, 2769, 2846, 2841, 2843, 2909, 3007, 3093, 3178, 3274, 3359, 3432, 3533, 3653, 3705, 3655, 3582, 3575, 3608, 3603, 3534, 3460, 3457, 3516, 3535, 3465, 3407, 3454, 3533, 3521, 3448, 3402, 3383, 3357, 3353, 3343, 3225, 3027, 2923, 2971, 3001, 2875, 2662, 2486, 2366, 2285, 2292, 2369, 2343, 2094, 1781, 1639, 1638, 1577, 1420, 1296, 1232, 1131, 973, 849, 787, 716, 598, 474, 352, 195, 40, -26, -60, -204, -429, -539, -509, -515, -630, -749, -831, -928, -1015, -1025, -1009, -1068, -1170, -1190, -1131, -1131, -1250, -1384, -1424, -1391, -1352, -1302, -1226, -1190, -1250, -1334, -1328, -1253, -1222, -1213, -1111, -960, -928, -991, -928, -700, -515, -464, -407, -271, -158, -129, -130, -126, -122, -94, -29, 9, -35, -119, -137, -26, 151, 243, 158, 13, 7, 158, 302, 322, 247, 142, 56, 45, 120, 193, 180, 91, -32, -160, -238, -224, -178, -177, -202, -205, -213, -254, -271, -227, -179, -177, -198, -201, -191, -174, -150, -139, -167, -191, -138, -49, -60, -195, -279, -173, 0, 27, -89, -138, -22, 116, 123, 39, -17, -29, -35, -13, 45, 60, -13, -75, -46, -12, -89, -236, -344, -417, -534, -701, -839, -919, -994, -1091, -1178, -1234, -1297, -1363, -1375, -1335, -1347, -1506, -1786, -2057, -2225, -2321, -2479, -2776, -3119, -3334, -3338, -3167, -2875, -2497, -2065, -1608, -1148, -732, -447, -335, -315, -248, -100, 41, 115, 177, 301, 498, 738, 1022, 1356, 1778, 2325, 2919, 3353, 3549, 3687, 3983, 4402, 4766, 5009, 5200, 5404, 5643, 5967, 6385, 6767, 6995, 7234, 7748, 8447, 8987, 9324, 9737, 10300, 10782, 11083, 11367, 11693, 11896, 11947, 12042, 12304, 12580, 12732, 12888, 13195, 13552, 13808, 14030, 14318, 14587, 14747, 14893, 15097, 15297, 15463, 15640, 15740, 15663, 15566, 15694, 16014, 16251, 16290, 16285, 16379, 16534, 16651, 16719, 16745, 16673, 16503, 16331, 16195, 15972, 15574, 15129, 14842, 14743, 14695, 14582, 14400, 14204, 13999, 13762, 13515, 13328, 13208, 13049, 12734, 12292, 11835, 11444, 11121, 10844, 10569, 10244, 9857, 9492, 9229, 9017, 8724, 8289, 7804, 7374, 7012, 6630, 6159, 5600, 4970, 4292, 3644, 3112, 2638, 2068, 1428, 933, 640, 340, -66, -435, -691, -976, -1329, -1610, -1798, -2075, -2512, -2982, -3353, -3615, -3828, -4068, -4372, -4692, -4988, -5306, -5649, -5883, -5951, -6007, -6191, -6436, -6614, -6768, -7006, -7331, -7686, -8044, -8387, -8683, -8907, -9056, -9171, -9303, -9443, -9487, -9433, -9447, -9630, -9846, -9972, -10090, -10268, -10394, -10431, -10528, -10715, -10846, -10909, -11100, -11478, -11827, -11962, -11975, -12022, -12068, -11988, -11833, -11790, -11915, -12075, -12159, -12234, -12384, -12529, -12537, -12400, -12253, -12198, -12201, -12190, -12128, -12017, -11839, -11621, -11460, -11447, -11522, -11540, -11452, -11344, -11279, -11232, -11174, -11130, -11113, -11079, -11010, -10940, -10906, -10882, -10787, -10586, -10374, -10285, -10272, -10134, -9826, -9532, -9356, -9188, -8957, -8750, -8599, -8407, -8174, -8005, -7889, -7697, -7400, -7114, -6894, -6682, -6455, -6292, -6250, -6277, -6264, -6184, -6124, -6150, -6184, -6112, -5944, -5762, -5582, -5429, -5425, -5563, -5597, -5380, -5123, -5043, -5041, -4969, -4934, -5067, -5211, -5149, -4946, -4827, -4817, -4761, -4630, -4518, -4372, -4025, -3505, -2982, -2437, -1792, -1255, -1107, -1219, -1190, -916, -638, -479, -286, 39, 357, 503, 529, 570, 660, 753, 819, 815, 713, 615, 632, 688, 673, 694, 850, 951, 816, 623, 641, 812, 914, 914, 907, 896, 847, 789, 727, 591, 372, 204, 203, 300, 329, 236, 119, 67, 48, 5, -26, -1, 14, -65, -189, -206, -97, 3, 16, -7, -15, -36, -96, -155, -109, 139, 481, 547, 121, -511, -915, -1035, -1046, -958, -756, -657, -828, -1105, -1278, -1417, -1683, -2047, -2356, -2486, -2332, -1848, -1194, -671, -399, -225, -93, -192, -491, -537, -150, 167, 7, -233, -13, 430, 495, 160, -82, -63, -58, -135, 30, 530, 891, 651, -15, -604, -958, -1379, -2121, -3030, -3654, -3627, -2990, -2197, -1723, -1608, -1496, -1163, -809, -656, -558, -302, 10, 218, 426, 716, 928, 1073, 1477, 2164, 2605, 2436, 1960, 1644, 1500, 1244, 827, 586, 827, 1317, 1460, 1156, 1071, 1630, 2159, 1704, 456, -407, -200, 598, 1154, 1231, 1169, 1204, 1096, 556, -155, -454, -266, -187, -601, -1150, -1345, -1301, -1460, -1866, -2125, -2001, -1706, -1576, -1684, -1857, -1906, -1745, -1416, -1074, -846, -656, -279, 265, 593, 435, 93, 38, 183, 37, -429, -643, -275, 314, 725, 1163, 2042, 3220, 4037, 4041, 3375, 2459, 1564, 816, 346, 171, 54, -233, -556, -614, -440, -364, -491, -651, -819, -1148, -1617, -2057, -2482, -2981, -3388, -3455, -3285, -3290, -3748, -4578, -5504, -6356, -7220, -8242, -9255, -9812, -9570, -8407, -6277, -3318, -96, 2744, 5112, 7352, 9384, 10559, 10551, 10050, 10098, 10935, 11992, 12884, 13982, 15736, 17842, 19480, 20179, 20134, 19725, 19168, 18592, 18128, 17847, 17860, 18456, 19762, 21343, 22533, 23032, 22977, 22626, 22231, 22001, 21953, 22003, 22313, 23138, 24419, 25725, 26714, 27245, 27175, 26355, 24847, 22966, 20997, 19046, 17166, 15573, 14542, 14125, 14077, 14114, 14120, 13945, 13275, 11952, 10313, 8862, 7745, 6835, 6172, 5919, 6009, 6243, 6623, 7243, 7847, 7863, 7074, 5901, 4868, 4030, 3195, 2400, 1864, 1627, 1519, 1373, 1051, 400, -611, -1780, -2819, -3580, -4051, -4174, -3838, -3009, -1771, -253, 1334, 2660, 3449, 3698, 3576, 3202, 2678, 2193, 1923, 1925, 2203, 2747, 3443, 4079, 4493, 4629, 4431, 3848, 2968, 2033, 1214, 483, -190, -659, -774, -616, -345, 13, 461, 860, 1111, 1338, 1693, 2154, 2626, 3086, 3538, 3939, 4253, 4480, 4550, 4322, 3767, 3077, 2441, 1856, 1286, 862, 707, 733, 824, 1044, 1390, 1589, 1404, 936, 447, 13, -424, -834, -1104, -1217, -1264, -1265, -1130, -817, -510, -502, -880, -1488, -2250, -3264, -4465, -5571, -6475, -7349, -8206, -8864, -9398, -10093, -10939, -11671, -12278, -12930, -13542, -13929, -14172, -14424, -14587, -14511, -14300, -14161, -14103, -14040, -14002, -14135, -14458, -14767, -14824, -14620, -14373, -14188, -13908, -13412, -12904, -12699, -12810, -12994, -13096, -13194, -13316, -13315, -13081, -12693, -12220, -11518, -10469, -9249, -8147, -7255, -6539, -6003, -5661, -5458, -5357, -5345, -5365, -5410, -5594, -5953, -6295, -6455, -6534, -6698, -6958, -7223, -7414, -7479, -7482, -7631, -8010, -8415, -8597, -8577, -8558, -8645, -8822, -9069, -9334, -9457, -9320, -9081, -9052, -9300, -9572, -9680, -9688, -9699, -9735, -9845, -10077, -10366, -10720, -11242, -11795, -12039, -11973, -11888, -11747, -11269, -10556, -9911, -9248, -8466, -7971, -8043, -8229, -8064, -7774, -7665, -7518, -7078, -6506, -5998, -5489, -4911, -4330, -3838, -3568, -3709, -4266, -4966, -5440, -5379, -4759, -4122, -4202, -4903, -5230, -4585, -3509, -2782, -2512, -2438, -2407, -2266, -1857, -1301, -843, -475, -67, 330, 602, 731, 700, 531, 392, 352, 203, -157, -459, -532, -620, -902, -1120, -1037, -837, -805, -937, -1063, -1078, -949, -639, -175, 329, 763, 1117, 1531, 2168, 2964, 3572, 3661, 3238, 2609, 2102, 1861, 1734, 1395, 731, 33, -381, -579, -796, -1010, -1112, -1250, -1639, -2178, -2546, -2564, -2316, -1989, -1722, -1541, -1379, -1203, -1024, -795, -439, -54, 118, -3, -231, -349, -364, -424, -612, -903, -1243, -1645, -2113, -2497, -2570, -2359, -2194, -2233, -2205, -1835, -1247, -712, -278, 61, 159, -30, -205, -26, 453, 906, 1195, 1468, 1818, 2096, 2159, 2112, 2124, 2111, 1812, 1154, 421, -7, -35, 66, -7, -271, -502, -540, -405, -152, 200, 593, 923, 1214, 1640, 2292, 2989, 3458, 3642, 3703, 3735, 3649, 3399, 3205, 3321, 3661, 3920, 4020, 4103, 4155, 4065, 3913, 3758, 3303, 2371, 1430, 1082, 1274, 1551, 1763, 2070, 2569, 3268, 4126, 4892, 5202, 5025, 4780, 4824, 5004, 4812, 4046, 3214, 3065, 3621, 4065, 3780, 3121, 2780, 2826, 2843, 2694, 2594, 2556, 2364, 2091, 2111, 2438, 2634, 2595, 2786, 3415, 4023, 4264, 4411, 4656, 4605, 3984, 3232, 2841, 2553, 1907, 1161, 902, 964, 685, 189, 353, 1267, 1759, 1037, -23, -102, 629, 850, 123, -667, -865, -785, -997, -2091, -4645, -8123, -10711, -11364, -10787, -9403, -6310, -1283, 4375, 9816, 15363, 20730, 24676, 26802, 27864, 28187, 27381, 25812, 24878, 25494, 27061, 28447, 29331, 30116, 31000, 31742, 32004, 31372, 29566, 26973, 24417, 22257, 20406, 19047, 18463, 18301, 18038, 17811, 17962, 18230, 18190, 18013, 17985, 17780, 17013, 16261, 16535, 17653, 18189, 17271, 15537, 13848, 11922, 9163, 6051, 3645, 2065, 615, -685, -960, -135, 489, -50, -1096, -1609, -1852, -2782, -4357, -5550, -5889, -5825, -5489, -4172, -1501, 1691, 4307, 6214, 7845, 9099, 9505, 9253, 8996, 8651, 7524, 5757, 4411, 3867, 3462, 2912, 2738, 3028, 3120, 2760, 2416, 2262, 1882, 1197, 819, 1120, 1668, 1949, 2106, 2467, 2914, 3279, 3800, 4581, 5142, 5195, 5279, 5958, 6860, 7195, 6875, 6453, 6113, 5439, 4156, 2491, 629, -1514, -3785, -5625, -6722, -7319, -7683, -7727, -7400, -6967, -6657, -6310, -5719, -5063, -4698, -4614, -4490, -4185, -3794, -3281, -2438, -1289, -171, 693, 1409, 2056, 2418, 2326, 1999, 1754, 1527, 1004, 96, -982, -2021, -2944, -3742, -4475, -5308, -6311, -7259, -7791, -7833, -7627, -7356, -6977, -6446, -5888, -5430, -5152, -5176, -5541, -6044, -6472, -6852, -7213, -7457, -7576, -7689, -7758, -7732, -7849, -8377, -9196, -10169, -11503, -13275, -15036, -16378, -17426, -18374, -19081, -19370, -19309, -18974, -18328, -17438, -16521, -15681, -14863, -14019, -13220, -12583, -12126, -11709, -11177, -10623, -10283, -10128, -9862, -9363, -8834, -8430, -8152, -8072, -8195, -8270, -8129, -8057, -8340, -8814, -9233, -9692, -10282, -10751, -10860, -10751, -10668, -10621, -10445, -9981, -9225, -8365, -7608, -6981, -6513, -6404, -6681, -6937, -6893, -6940, -7622, -8715, -9475, -9663, -9769, -10178, -10657, -10897, -11077, -11526, -12189, -12796, -13332, -13946, -14498, -14677, -14550, -14536, -14672, -14502, -13896, -13327, -12978, -12395, -11460, -10739, -10391, -9776, -8668, -7747, -7459, -7329, -6872, -6280, -6021, -6280, -6892, -7395, -7285, -6598, -6005, -5977, -6075, -5497, -4197, -3032, -2689, -2855, -2730, -2162, -1744, -1766, -1864, -1977, -2505, -3005, -2311, -650, 305, 262, 809, 2328, 3139, 2559, 2043, 2524, 3184, 3379, 3528, 3751, 3477, 2645, 2004, 2099, 2617, 2744, 2099, 1340, 1298, 1558, 1141, 461, 711, 1359, 765, -752, -1243, -468, -77, -603, -940, -590, -135, 208, 705, 1244, 1580, 1924, 2467, 2909, 2908, 2565, 2151, 1771, 1451, 1259, 1153, 907, 436, 74, 214, 668, 801, 405, 17, 66, 191, -86, -448, -320, 59, 39, -254, -113, 579, 1292, 1815, 2413, 3080, 3398, 3237, 3005, 3032, 3125, 3000, 2702, 2366, 1932, 1422, 1094, 1039, 989, 755, 405, -29, -578, -1074, -1331, -1489, -1790, -2161, -2326, -2129, -1567, -741, 114, 769, 1216, 1588, 1930, 2218, 2463, 2644, 2709, 2695, 2666, 2628, 2682, 3006, 3433, 3504, 3198, 3002, 3024, 2862, 2467, 2255, 2224, 1909, 1323, 1035, 1288, 1761, 2180, 2568, 2935, 3199, 3408, 3727, 4219, 4755, 5110, 5109, 4766, 4316, 4057, 4154, 4466, 4581, 4242, 3842, 4079, 4963, 5722, 5926, 5946, 6070, 6037, 5771, 5631, 5626, 5293, 4648, 4367, 4651, 4802, 4390, 4079, 4538, 5227, 5276, 4961, 5083, 5426, 5199, 4548, 4230, 4224, 3967, 3529, 3399, 3556, 3653, 3715, 3981, 4372, 4646, 4847, 5198, 5594, 5535, 4687, 3395, 2342, 1718, 1107, 282, -403, -664, -693, -674, -576, -575, -898, -1111, -615, 171, 186, -646, -1344, -1463, -1708, -2823, -4743, -6962, -9109, -10949, -12256, -12965, -13235, -12997, -11272, -6592, 1227, 10012, 16927, 21170, 24130, 26961, 29195, 29926, 29331, 28399, 27808, 27718, 28188, 29226, 30483, 31457, 32044, 32410, 32529, 32168, 31089, 28880, 25227, 20792, 17037, 14747, 13479, 12617, 11966, 11453, 11232, 11811, 13097, 13958, 13737, 13206, 13121, 12823, 11493, 9906, 9513, 10079, 9876, 8248, 6512, 5713, 5151, 3839, 2052, 519, -642, -1477, -1819, -1879, -2321, -3376, -4645, -5825, -6948, -7897, -8318, -8165, -7831, -7445, -6500, -4483, -1602, 1521, 4542, 7321, 9469, 10548, 10614, 10206, 9797, 9461, 9045, 8471, 7871, 7472, 7374, 7418, 7336, 7023, 6570, 5961, 4907, 3230, 1281, -300, -1311, -2146, -3120, -3964, -4260, -4078, -3743, -3283, -2566, -1748, -1037, -237, 928, 2193, 2961, 3077, 2898, 2602, 1941, 812, -439, -1549, -2674, -3912, -4952, -5587, -6094, -6717, -7239, -7432, -7578, -8117, -8977, -9715, -10158, -10474, -10641, -10330, -9384, -8008, -6414, -4653, -2800, -969, 817, 2495, 3796, 4536, 4891, 5143, 5293, 5173, 4791, 4315, 3775, 3004, 1912, 615, -752, -2224, -3856, -5537, -7081, -8446, -9704, -10856, -11767, -12316, -12566, -12734, -12991, -13311, -13497, -13393, -13055, -12666, -12257, -11663, -10843, -10027, -9428, -8982, -8537, -8148, -8022, -8283, -8869, -9575, -10257, -11005, -11972, -13047, -13938, -14624, -15319, -16010, -16362, -16284, -16143, -16220, -16251, -15819, -14933, -13958, -13030, -11967, -10730, -9577, -8670, -7792, -6699, -5457, -4358, -3551, -2974, -2523, -2099, -1589, -1038, -732, -888, -1392, -2079, -3007, -4170, -5350, -6487, -7709, -8864, -9645, -10147, -10600, -10759, -10394, -9904, -9695, -9524, -9193, -9021, -9084, -8971, -8682, -8669, -8873, -8808, -8437, -8057, -7693, -7387, -7334, -7298, -6969, -6836, -7443, -8216, -8482, -8841, -9949, -11081, -11411, -11467, -11919, -12222, -11801, -11317, -11450, -11474, -10397, -8791, -7961, -7685, -6617, -4764, -3586, -3462, -3165, -2150, -1322, -1162, -921, -170, 464, 557, 653, 1289, 2139, 2640, 2751, 2564, 1871, 772, 1, -129, -420, -1542, -2753, -2872, -1986, -1200, -934, -573, 231, 984, 1365, 1812, 2592, 3148, 2991, 2522, 2353, 2467, 2543, 2547, 2556, 2443, 2152, 1958, 2130, 2420, 2216, 1313, 265, -372, -887, -1905, -3193, -3846, -3760, -3883, -4646, -5114, -4400, -3133, -2583, -2798, -2611, -1463, -159, 416, 429, 513, 831, 1217, 1639, 2096, 2474, 2696, 2755, 2617, 2379, 2335, 2525, 2458, 1714, 698, 197, 220, -38, -885, -1639, -1804, -1813, -2063, -2185, -1863, -1484, -1394, -1246, -680, 8, 382, 571, 959, 1471, 1679, 1530, 1460, 1711, 1991, 1948, 1622, 1314, 1232, 1341, 1409, 1191, 680, 125, -269, -541, -823, -1159, -1536, -1942, -2225, -2069, -1409, -718, -492, -548, -307, 348, 1021, 1530, 2098, 2801, 3332, 3455, 3367, 3445, 3807, 4203, 4355, 4285, 4199, 4134, 3962, 3716, 3619, 3660, 3400, 2539, 1513, 1087, 1307, 1429, 1068, 728, 875, 1147, 1066, 893, 1139, 1669, 1894, 1623, 1285, 1397, 2087, 3070, 3965, 4551, 4789, 4801, 4919, 5433, 6052, 6042, 5184, 4174, 3690, 3580, 3377, 3123, 3130, 3335, 3474, 3704, 4387, 5293, 5753, 5659, 5574, 5709, 5760, 5836, 6375, 7092, 7240, 6981, 7242, 8233, 9280, 9907, 10116, 9907, 9337, 8676, 7976, 6883, 5254, 3490, 2058, 1034, 197, -657, -1559, -2369, -2976, -3389, -3454, -2911, -2043, -1555, -1364, -586, 741, 1381, 880, 104, -599, -1863, -3833, -6168, -8990, -12007, -13708, -13160, -11018, -7473, -1604, 6062, 13000, 17844, 21635, 25177, 27600, 28167, 27566, 26780, 26068, 25507, 25554, 26605, 28387, 30163, 31428, 32194, 32616, 32668, 32184, 30904, 28407, 24460, 19639, 15249, 12218, 10287, 8654, 7180, 6502, 6938, 7865, 8490, 8702, 8788, 8571, 7579, 5927, 4369, 3419, 2884, 2360, 1825, 1603, 1932, 2635, 3218, 3412, 3459, 3657, 3865, 3718, 3141, 2255, 1051, -529, -2308, -3922, -5079, -5688, -5869, -5826, -5598, -4959, -3678, -1758, 600, 3087, 5297, 6920, 7961, 8600, 8899, 8863, 8650, 8439, 8179, 7751, 7314, 7209, 7492, 7826, 7879, 7640, 7195, 6406, 5043, 3161, 1077, -960, -2921, -4792, -6400, -7484, -7966, -8065, -8025, -7741, -6938, -5718, -4531, -3590, -2720, -1910, -1488, -1598, -1907, -2045, -2049, -2187, -2531, -2837, -2853, -2681, -2689, -2968, -3185, -3182, -3291, -3762, -4375, -4980, -5816, -6887, -7684, -7870, -7704, -7470, -7031, -6162, -4866, -3302, -1688, -241, 1012, 2162, 3125, 3707, 3933, 4005, 3945, 3673, 3278, 2903, 2512, 2000, 1353, 546, -478, -1660, -2878, -4169, -5648, -7247, -8788, -10175, -11366, -12284, -12949, -13542, -14161, -14645, -14765, -14552, -14228, -13912, -13519, -12991, -12412, -11863, -11318, -10749, -10207, -9742, -9391, -9218, -9277, -9521, -9847, -10196, -10515, -10791, -11080, -11449, -11820, -12038, -12097, -12155, -12260, -12220, -11856, -11292, -10825, -10529, -10142, -9410, -8478, -7701, -7148, -6606, -6009, -5424, -4697, -3718, -2880, -2578, -2462, -2009, -1472, -1418, -1754, -2103, -2664, -3773, -5042, -5834, -6331, -7227, -8429, -9106, -9122, -9316, -9987, -10302, -9789, -9322, -9734, -10462, -10512, -9991, -9732, -9892, -9908, -9608, -9412, -9368, -8933, -7946, -7062, -6809, -6903, -6860, -6761, -7013, -7709, -8588, -9397, -9982, -10238, -10222, -10183, -10203, -10078, -9795, -9707, -9840, -9600, -8677, -7586, -6881, -6408, -5724, -4647, -3286, -2047, -1556, -1918, -2260, -1692, -507, 204, 83, -70, 497, 1463, 2013, 1935, 1637, 1422, 1247, 891, 85, -1112, -2069, -2294, -2219, -2458, -2724, -2396, -1693, -1262, -1160, -1085, -1116, -1420, -1714, -1644, -1392, -1420, -1852, -2341, -2411, -1798, -630, 585, 1279, 1308, 1089, 1116, 1348, 1296, 719, -53, -637, -1136, -1810, -2472, -2749, -2740, -2834, -3023, -3002, -2753, -2452, -2141, -1907, -1905, -1924, -1576, -1001, -646, -456, -100, 288, 478, 820, 1681, 2586, 2799, 2419, 2148, 2193, 2111, 1672, 1209, 965, 642, -72, -913, -1448, -1812, -2487, -3420, -3912, -3531, -2703, -2123, -1915, -1684, -1236, -808, -608, -471, -96, 486, 852, 702, 338, 360, 914, 1605, 2171, 2731, 3272, 3464, 3215, 2890, 2765, 2629, 2193, 1557, 1031, 699, 440, 264, 337, 678, 1056, 1303, 1520, 1881, 2367, 2834, 3204, 3468, 3576, 3514, 3470, 3728, 4325, 4968, 5354, 5466, 5509, 5655, 5879, 6042, 6094, 6031, 5675, 4834, 3825, 3354, 3551, 3687, 3210, 2451, 1897, 1433, 809, 267, 123, 146, -70, -413, -404, 72, 675, 1232, 1961, 2933, 3710, 3924, 3887, 4105, 4419, 4322, 4009, 4226, 4995, 5499, 5461, 5578, 6238, 6777, 6501, 5649, 4910, 4516, 4171, 3615, 3024, 2784, 2937, 3132, 3331, 4030, 5452, 6971, 7847, 8040, 7930, 7681, 7373, 7287, 7449, 7244, 6162, 4752, 4043, 4084, 3975, 3362, 2807, 2496, 1821, 648, -182, -277, -492, -1532, -2568, -2364, -1170, -292, -98, 174, 658, 365, -1269, -3604, -5885, -8104, -10395, -12398, -13651, -13852, -12425, -8560, -2297, 4931, 11548, 17132, 21872, 25373, 27099, 27509, 27712, 28251, 28822, 29045, 28986, 29064, 29664, 30779, 31951, 32648, 32767, 32523, 31834, 30119, 27049, 23076, 18794, 14489, 10696, 8199, 6796, 5390, 3903, 3588, 4659, 5429, 4754, 3749, 3809, 4280, 3618, 1952, 949, 1306, 2060, 2477, 3014, 4006, 4814, 4892, 4620, 4486, 4374, 4082, 3785, 3509, 2766, 1217, -640, -2053, -2936, -3704, -4436, -4863, -4975, -4977, -4796, -4105, -2714, -682, 1664, 3833, 5563, 7033, 8332, 9138, 9289, 9208, 9286, 9340, 9069, 8595, 8262, 8243, 8469, 8665, 8497, 7886, 7030, 5926, 4265, 1949, -605, -2920, -4902, -6668, -8189, -9293, -9866, -9947, -9642, -9063, -8298, -7419, -6496, -5605, -4828, -4222, -3787, -3512, -3336, -3094, -2619, -1960, -1381, -1075, -980, -939, -924, -1003, -1191, -1430, -1729, -2234, -3068, -4104, -5003, -5581, -5985, -6360, -6605, -6607, -6397, -5911, -4985, -3749, -2575, -1542, -456, 632, 1431, 1918, 2312, 2623, 2688, 2526, 2276, 1920, 1396, 789, 235, -303, -994, -1947, -3112, -4373, -5710, -7209, -8832, -10326, -11545, -12698, -13999, -15242, -16063, -16460, -16698, -16832, -16671, -16197, -15648, -15152, -14555, -13715, -12789, -12041, -11471, -10824, -10039, -9398, -9148, -9127, -8986, -8672, -8475, -8554, -8638, -8462, -8227, -8289, -8488, -8396, -8126, -8217, -8707, -9027, -8928, -8821, -9055, -9444, -9604, -9343, -8697, -7852, -7007, -6230, -5527, -4953, -4474, -3920, -3304, -2916, -2869, -2949, -3051, -3324, -3769, -4204, -4652, -5249, -5867, -6318, -6724, -7231, -7664, -7889, -8131, -8573, -9016, -9254, -9400, -9666, -10018, -10277, -10333, -10222, -10027, -9688, -9100, -8453, -8130, -8009, -7436, -6277, -5410, -5532, -6061, -6020, -5571, -5681, -6458, -6878, -6391, -5826, -6112, -6806, -6759, -5915, -5419, -5835, -6294, -5875, -4991, -4602, -4764, -4891, -4887, -5042, -5172, -4808, -4026, -3322, -2872, -2463, -1960, -1339, -433, 833, 2012, 2439, 2104, 1735, 1849, 2184, 2237, 1893, 1337, 795, 444, 299, 181, 5, -118, -198, -422, -771, -983, -1073, -1461, -2291, -3020, -3114, -2849, -2887, -3246, -3323, -2870, -2256, -1658, -743, 554, 1599, 1902, 1881, 2113, 2302, 1838, 1064, 859, 1108, 824, -206, -1077, -1218, -1148, -1441, -1846, -1848, -1562, -1574, -2049, -2432, -2255, -1904, -2077, -2645, -2796, -2287, -1698, -1309, -642, 549, 1705, 2322, 2685, 3285, 3980, 4197, 3743, 3063, 2624, 2256, 1442, 298, -392, -391, -461, -1114, -1771, -1861, -1805, -2161, -2596, -2554, -2261, -2316, -2697, -2798, -2242, -1347, -696, -390, 59, 895, 1660, 2011, 2499, 3731, 5207, 5912, 5858, 6014, 6793, 7495, 7416, 6787, 6222, 5777, 5069, 4124, 3492, 3396, 3317, 2808, 2281, 2392, 2963, 3276, 3210, 3298, 3666, 3758, 3247, 2538, 2137, 2017, 1883, 1675, 1569, 1627, 1779, 2069, 2643, 3411, 3986, 4110, 3947, 3730, 3330, 2463, 1218, 55, -710, -1130, -1244, -877, -138, 346, 305, 534, 1823, 3535, 4338, 4095, 3823, 3970, 3986, 3553, 3112, 3077, 3314, 3555, 3772, 4079, 4578, 5350, 6291, 6992, 7170, 7174, 7522, 7861, 7166, 5286, 3557, 3283, 4183, 4957, 5068, 5169, 5860, 6758, 7193, 7368, 8142, 9705, 11026, 10945, 9473, 7634, 6277, 5433, 4713, 3973, 3495, 3511, 3590, 2919, 1520, 497, 517, 872, 775, 495, 413, 131, -648, -1426, -1789, -1935, -1943, -1506, -760, -503, -1272, -2879, -4989, -7471, -9805, -10823, -9721, -7017, -3910, -898, 2388, 6339, 10960, 16072, 21176, 25354, 27896, 28968, 29396, 29836, 30390, 30885, 31257, 31613, 31961, 32092, 31956, 31764, 31458, 30523, 28744, 26521, 23897, 20306, 15832, 11677, 8591, 5969, 3257, 1185, 538, 660, 328, -476, -835, -577, -468, -678, -412, 634, 1576, 1756, 1774, 2403, 3308, 3726, 3773, 4127, 4697, 4654, 3790, 2871, 2416, 2002, 1162, 200, -446, -1050, -2160, -3632, -4728, -5128, -5233, -5371, -5249, -4437, -3019, -1425, 145, 1859, 3849, 5870, 7459, 8446, 9084, 9552, 9623, 9119, 8406, 8014, 7851, 7332, 6358, 5543, 5217, 4753, 3455, 1687, 355, -520, -1857, -4015, -6127, -7393, -8255, -9531, -10922, -11433, -10917, -10145, -9490, -8607, -7372, -6143, -5036, -3767, -2366, -1356, -1034, -1066, -1032, -1019, -1332, -1863, -2163, -2149, -2273, -2832, -3528, -3993, -4316, -4669, -4863, -4806, -4968, -5758, -6768, -7237, -7036, -6640, -6340, -5974, -5289, -4239, -2956, -1592, -230, 1057, 2111, 2794, 3171, 3345, 3232, 2737, 2011, 1276, 513, -354, -1189, -1861, -2574, -3598, -4878, -6155, -7354, -8613, -9966, -11269, -12438, -13535, -14578, -15418, -15915, -16112, -16144, -16071, -15884, -15556, -15097, -14547, -13964, -13276, -12294, -10985, -9696, -8907, -8723, -8762, -8640, -8370, -8193, -8161, -8172, -8245, -8507, -8868, -9003, -8756, -8377, -8213, -8283, -8342, -8267, -8173, -8200, -8341, -8492, -8538, -8370, -7912, -7159, -6202, -5206, -4302, -3476, -2602, -1648, -781, -214, -49, -236, -640, -1065, -1364, -1559, -1805, -2191, -2652, -3151, -3800, -4663, -5522, -6052, -6282, -6661, -7433, -8159, -8299, -8068, -8130, -8520, -8606, -8194, -7833, -7820, -7715, -7146, -6416, -5931, -5545, -4902, -4123, -3707, -3808, -3999, -3912, -3813, -4180, -4899, -5360, -5363, -5357, -5675, -6105, -6351, -6422, -6389, -6222, -6023, -5988, -6038, -5849, -5342, -4813, -4528, -4366, -3964, -3163, -2237, -1602, -1278, -856, -76, 795, 1320, 1423, 1386, 1472, 1723, 2025, 2244, 2285, 2121, 1809, 1530, 1490, 1610, 1439, 658, -402, -1101, -1314, -1544, -2113, -2667, -2790, -2724, -2952, -3320, -3271, -2830, -2583, -2715, -2801, -2571, -2188, -1754, -1166, -489, 30, 349, 690, 1165, 1572, 1617, 1232, 578, -148, -848, -1438, -1821, -2006, -2141, -2309, -2419, -2400, -2354, -2367, -2299, -1999, -1647, -1589, -1836, -1962, -1590, -850, -221, 67, 328, 949, 1800, 2446, 2829, 3221, 3561, 3470, 2963, 2528, 2358, 2126, 1604, 1014, 581, 192, -287, -712, -855, -801, -901, -1304, -1719, -1794, -1607, -1469, -1372, -1075, -658, -456, -420, -114, 563, 1167, 1383, 1446, 1675, 2016, 2290, 2609, 3163, 3738, 3860, 3479, 3156, 3355, 3814, 3894, 3407, 2820, 2601, 2660, 2598, 2377, 2308, 2406, 2271, 1803, 1504, 1729, 2091, 2070, 1818, 1801, 1940, 1753, 1249, 996, 1169, 1239, 842, 410, 456, 716, 631, 415, 765, 1555, 1823, 1348, 1132, 1765, 2430, 2302, 1857, 1960, 2587, 3263, 3984, 4913, 5780, 6252, 6521, 6869, 6985, 6402, 5429, 4874, 4868, 4722, 4028, 3186, 2799, 3056, 3778, 4556, 4909, 4745, 4637, 5145, 5894, 5994, 5423, 5124, 5445, 5675, 5548, 5836, 6805, 7554, 7607, 7773, 8614, 9355, 9222, 8728, 8649, 8483, 7246, 5264, 3786, 3097, 2430, 1607, 1196, 1139, 774, 231, 360, 1200, 1800, 1671, 1385, 1515, 1768, 1530, 776, -25, -749, -1810, -3484, -5455, -7269, -8832, -10168, -10995, -10921, -9673, -6874, -2137, 4080, 10341, 15527, 19732, 23409, 26415, 28311, 29012, 28713, 27678, 26392, 25419, 24984, 24935, 25130, 25579, 26287, 27043, 27337, 26574, 24622, 21864, 18657, 15083, 11378, 8047, 5283, 2896, 943, -179, -385, 8, 836, 2051, 3305, 4145, 4542, 4779, 4868, 4598, 4007, 3448, 3134, 2937, 2680, 2377, 2119, 1971, 2063, 2478, 2946, 2929, 2267, 1406, 794, 259, -564, -1478, -1954, -2033, -2251, -2699, -2908, -2683, -2276, -1701, -670, 748, 2152, 3511, 5167, 7018, 8365, 8850, 8956, 9179, 9212, 8483, 7095, 5597, 4185, 2739, 1390, 422, -221, -850, -1537, -2113, -2603, -3259, -4153, -5124, -6151, -7394, -8747, -9843, -10571, -11106, -11372, -10991, -9837, -8204, -6354, -4368, -2401, -716, 606, 1686, 2503, 2801, 2468, 1787, 1115, 406, -641, -1992, -3143, -3729, -3991, -4390, -4975, -5420, -5549, -5530, -5593, -5862, -6365, -6978, -7415, -7491, -7277, -6940, -6520, -5874, -4782, -3220, -1591, -350, 585, 1648, 2792, 3484, 3515, 3248, 2932, 2396, 1519, 470, -635, -1905, -3345, -4700, -5843, -7012, -8459, -9982, -11106, -11771, -12476, -13592, -14789, -15531, -15862, -16271, -16831, -17016, -16499, -15659, -15011, -14500, -13689, -12486, -11244, -10190, -9171, -8042, -7012, -6341, -5977, -5753, -5741, -6128, -6823, -7460, -7892, -8365, -9088, -9803, -10075, -9907, -9714, -9678, -9527, -9053, -8524, -8272, -8155, -7808, -7262, -6887, -6691, -6214, -5285, -4337, -3683, -2998, -1930, -817, -201, 49, 518, 1205, 1433, 895, 104, -492, -1213, -2457, -3923, -5086, -6011, -7104, -8300, -9118, -9412, -9565, -9842, -10006, -9799, -9448, -9365, -9495, -9354, -8698, -7864, -7318, -7086, -6777, -6122, -5284, -4547, -3889, -3094, -2226, -1674, -1664, -1920, -2017, -1909, -1928, -2299, -2916, -3556, -4134, -4631, -4952, -5060, -5133, -5297, -5262, -4702, -3911, -3455, -3225, -2652, -1851, -1530, -1700, -1571, -882, -287, -246, -345, -41, 603, 1185, 1562, 1864, 2139, 2278, 2236, 2057, 1693, 1018, 75, -870, -1594, -2135, -2746, -3557, -4298, -4490, -4040, -3427, -3110, -3001, -2738, -2291, -1909, -1601, -1076, -288, 373, 636, 737, 1028, 1480, 1891, 2273, 2693, 2963, 2896, 2690, 2702, 2891, 2800, 2160, 1253, 517, -24, -700, -1617, -2476, -3014, -3337, -3650, -3868, -3765, -3376, -2963, -2653, -2331, -1889, -1383, -896, -428, 38, 450, 755, 1009, 1317, 1667, 1932, 2073, 2224, 2516, 2845, 2951, 2717, 2318, 1994, 1747, 1418, 970, 468, -107, -685, -937, -704, -363, -318, -396, -251, 51, 285, 510, 832, 1125, 1326, 1588, 1928, 2112, 2092, 2152, 2427, 2634, 2488, 2175, 2097, 2270, 2336, 2133, 1875, 1740, 1631, 1417, 1143, 917, 719, 355, -285, -907, -974, -458, 49, 243, 534, 1224, 2005, 2696, 3639, 4893, 5859, 6133, 6096, 6310, 6784, 7080, 6813, 6026, 5218, 4918, 5058, 4946, 4187, 3438, 3634, 4507, 4780, 4033, 3234, 3095, 3134, 2830, 2428, 2133, 1673, 1114, 1024, 1447, 1667, 1428, 1480, 2313, 3173, 3168, 2736, 2938, 3766, 4315, 4388, 4677, 5477, 6287, 6716, 6921, 7152, 7412, 7610, 7689, 7581, 7201, 6583, 6046, 6030, 6478, 6700, 6302, 5856, 5969, 6155, 5574, 4436, 3689, 3623, 3639, 3185, 2236, 1169, 589, 959, 1956, 2557, 2163, 1320, 715, -108, -2231, -5655, -9149, -11784, -13578, -14581, -14490, -13225, -10884, -7140, -1650, 5015, 11569, 17172, 21719, 25171, 27253, 27935, 27673, 26910, 25750, 24381, 23349, 23012, 23099, 23181, 23277, 23580, 23862, 23530, 22178, 19938, 17262, 14464, 11456, 8142, 4932, 2546, 1257, 709, 520, 760, 1692, 3283, 5090, 6605, 7701, 8687, 9719, 10432, 10445, 9959, 9374, 8643, 7507, 6091, 4752, 3545, 2319, 1078, -78, -1143, -2088, -2824, -3330, -3667, -3931, -4255, -4659, -4859, -4585, -4063, -3759, -3648, -3235, -2250, -899, 623, 2356, 4231, 5997, 7649, 9512, 11463, 12650, 12490, 11498, 10450, 9235, 7301, 4825, 2553, 744, -942, -2655, -4050, -4840, -5200, -5495, -5805, -5974, -6026, -6279, -6928, -7703, -8190, -8352, -8500, -8716, -8586, -7669, -6090, -4340, -2633, -835, 996, 2477, 3372, 3775, 3731, 3064, 1769, 192, -1397, -3119, -5086, -6955, -8210, -8833, -9287, -9791, -10032, -9675, -8882, -8107, -7577, -7191, -6795, -6388, -5966, -5355, -4380, -3198, -2145, -1221, -13, 1660, 3396, 4680, 5494, 6110, 6502, 6346, 5578, 4503, 3277, 1700, -266, -2223, -3869, -5477, -7396, -9391, -10895, -11784, -12483, -13279, -13951, -14194, -14127, -14065, -14001, -13642, -12979, -12388, -12073, -11737, -11053, -10203, -9561, -9126, -8546, -7715, -6924, -6416, -6114, -5927, -6040, -6627, -7477, -8219, -8822, -9602, -10751, -12080, -13167, -13680, -13580, -13066, -12304, -11321, -10204, -9113, -8031, -6809, -5542, -4495, -3661, -2836, -2071, -1499, -914, -64, 790, 1184, 1150, 1151, 1416, 1687, 1596, 997, 25, -1078, -2171, -3278, -4464, -5675, -6789, -7799, -8797, -9678, -10102, -9960, -9590, -9260, -8824, -8184, -7566, -7039, -6320, -5385, -4671, -4367, -4096, -3591, -3129, -3036, -3181, -3230, -3151, -3205, -3554, -4035, -4390, -4604, -4856, -5191, -5435, -5494, -5532, -5741, -6039, -6170, -6051, -5874, -5862, -5948, -5776, -5081, -4037, -3111, -2524, -2012, -1218, -164, 777, 1311, 1442, 1329, 1118, 930, 772, 439, -210, -910, -1230, -1211, -1330, -1797, -2287, -2536, -2748, -3200, -3750, -4034, -3992, -3909, -3991, -4143, -4145, -3828, -3097, -2024, -938, -174, 315, 903, 1738, 2494, 2821, 2787, 2659, 2463, 2101, 1673, 1339, 1047, 693, 333, 10, -377, -865, -1301, -1601, -1904, -2344, -2855, -3245, -3365, -3233, -3009, -2834, -2696, -2497, -2213, -1872, -1460, -937, -322, 316, 901, 1332, 1564, 1692, 1870, 2100, 2193, 1974, 1474, 917, 568, 561, 779, 886, 641, 274, 268, 661, 897, 632, 206, 29, 24, 2, 42, 168, 180, 48, 28, 230, 500, 812, 1313, 1897, 2152, 1948, 1718, 1866, 2189, 2262, 2117, 2023, 1872, 1337, 578, 205, 454, 819, 647, -104, -835, -992, -652, -350, -370, -449, -188, 459, 1234, 1931, 2563, 3229, 3934, 4537, 4920, 5166, 5510, 6049, 6611, 6948, 6999, 6879, 6723, 6582, 6428, 6185, 5729, 4989, 4031, 3007, 2055, 1369, 1125, 1145, 887, 193, -361, -243, 245, 433, 177, -177, -411, -541, -480, -103, 451, 928, 1403, 2163, 3148, 4013, 4745, 5574, 6298, 6460, 6240, 6362, 7055, 7797, 8122, 8090, 8018, 8197, 8797, 9646, 10297, 10564, 10783, 11175, 11218, 10267, 8701, 7687, 7609, 7515, 6455, 4734, 3299, 2479, 1939, 1509, 1377, 1569, 1800, 1927, 2051, 2127, 1941, 1481, 838, -258, -2219, -4876, -7557, -9975, -12473, -15208, -17555, -18593, -17907, -15545, -11590, -6239, -22, 6474, 12946, 19004, 23928, 27166, 28829, 29345, 28908, 27563, 25515, 23140, 20905, 19316, 18752, 19166, 20033, 20746, 20975, 20633, 19641, 17926, 15683, 13257, 10837, 8365, 5851, 3643, 2283, 2141, 3212, 5158, 7455, 9571, 11237, 12516, 13605, 14499, 14923, 14474, 12945, 10615, 8135, 5922, 3836, 1661, -433, -2203, -3693, -4942, -5773, -6144, -6337, -6508, -6469, -6087, -5548, -4961, -4088, -2778, -1392, -365, 442, 1439, 2599, 3710, 4963, 6511, 7918, 8759, 9310, 9900, 10241, 10013, 9429, 8623, 7160, 4747, 1907, -635, -2806, -4862, -6593, -7560, -7896, -7994, -7625, -6353, -4627, -3330, -2503, -1612, -720, -341, -503, -845, -1271, -1813, -2239, -2319, -2130, -1804, -1311, -723, -383, -531, -984, -1523, -2329, -3650, -5256, -6761, -8208, -9774, -11181, -12033, -12415, -12557, -12287, -11348, -9927, -8402, -6844, -5123, -3299, -1610, -156, 1140, 2290, 3120, 3502, 3603, 3696, 3746, 3459, 2771, 1993, 1339, 652, -222, -1121, -1857, -2542, -3356, -4237, -4999, -5602, -6156, -6746, -7328, -7750, -7952, -8055, -8182, -8217, -7912, -7257, -6517, -5899, -5385, -4927, -4622, -4586, -4812, -5213, -5805, -6677, -7787, -8869, -9758, -10639, -11732, -12770, -13245, -13187, -13165, -13446, -13614, -13290, -12783, -12595, -12589, -12249, -11603, -11060, -10486, -9426, -8115, -7077, -6005, -4360, -2675, -1757, -1303, -672, -212, -466, -1044, -1431, -1899, -2749, -3614, -4138, -4490, -4818, -4927, -4829, -4911, -5165, -4937, -4084, -3569, -4023, -4540, -4136, -3453, -3572, -4133, -4116, -3579, -3236, -3218, -3237, -3218, -3119, -2880, -2802, -3275, -4089, -4682, -4955, -5326, -6066, -6990, -7760, -8195, -8302, -8242, -8275, -8517, -8714, -8522, -8066, -7790, -7722, -7404, -6636, -5790, -5228, -4830, -4327, -3719, -3222, -2938, -2735, -2432, -2050, -1788, -1725, -1687, -1507, -1333, -1468, -1893, -2181, -2106, -2022, -2322, -2788, -2965, -2911, -2970, -3079, -2885, -2383, -1894, -1584, -1381, -1201, -981, -692, -498, -693, -1310, -1954, -2246, -2257, -2316, -2479, -2513, -2310, -1917, -1311, -550, 29, 187, 99, -43, -353, -875, -1394, -1874, -2516, -3261, -3737, -3778, -3513, -3062, -2551, -2235, -2171, -1963, -1228, -221, 336, 55, -701, -1260, -1310, -1062, -921, -1085, -1368, -1359, -855, -107, 530, 970, 1255, 1346, 1360, 1604, 2046, 2145, 1566, 690, 95, -149, -370, -725, -1031, -1054, -817, -528, -226, 318, 1171, 1931, 2200, 2163, 2321, 2751, 3067, 3026, 2802, 2653, 2629, 2662, 2752, 2982, 3277, 3311, 2887, 2379, 2319, 2530, 2260, 1318, 418, 113, 37, -354, -841, -814, -276, 184, 342, 661, 1494, 2484, 3085, 3314, 3572, 3949, 4161, 4100, 4019, 4070, 3993, 3512, 2905, 2771, 3173, 3430, 3027, 2354, 2184, 2659, 3228, 3480, 3525, 3601, 3654, 3502, 3224, 3121, 3343, 3663, 3761, 3629, 3558, 3746, 4078, 4349, 4534, 4705, 4784, 4572, 4056, 3528, 3276, 3207, 2950, 2385, 1855, 1700, 1791, 1811, 1798, 2049, 2607, 3186, 3544, 3649, 3639, 3772, 4257, 4955, 5462, 5536, 5283, 4949, 4691, 4526, 4314, 3886, 3269, 2675, 2243, 1962, 1906, 2258, 3058, 4052, 4888, 5412, 5756, 6154, 6656, 7040, 7033, 6683, 6416, 6562, 6873, 6764, 6034, 5031, 4060, 3052, 1917, 804, -179, -1120, -2029, -2693, -2908, -2657, -2024, -1170, -445, -246, -657, -1403, -2352, -3786, -5954, -8628, -11364, -13919, -16102, -17460, -17483, -16004, -13115, -8894, -3487, 2587, 8596, 14051, 18734, 22317, 24374, 24811, 23928, 22019, 19433, 16883, 15078, 14064, 13415, 13021, 13190, 14117, 15598, 17246, 18661, 19499, 19580, 19006, 18030, 16904, 15834, 15032, 14574, 14280, 13937, 13633, 13696, 14218, 14868, 15255, 15220, 14798, 14048, 12927, 11380, 9499, 7585, 5823, 4035, 2051, 96, -1505, -2756, -3774, -4432, -4567, -4309, -3842, -3050, -1711, 88, 1977, 3667, 5105, 6261, 7011, 7293, 7204, 6882, 6362, 5643, 4810, 4022, 3441, 3159, 3135, 3246, 3406, 3631, 3848, 3719, 2961, 1851, 1014, 507, -291, -1570, -2569, -2622, -2027, -1320, -412, 959, 2466, 3504, 3966, 4174, 4207, 3721, 2472, 725, -994, -2417, -3659, -4904, -6063, -6775, -6850, -6657, -6714, -6914, -6725, -6183, -5930, -6125, -6156, -5678, -5143, -4985, -4935, -4514, -3752, -3053, -2565, -2045, -1327, -684, -509, -729, -893, -852, -1019, -1727, -2623, -3080, -3087, -3256, -3840, -4274, -4018, -3419, -3185, -3285, -3025, -2128, -1120, -489, 0, 852, 2014, 2942, 3309, 3258, 2993, 2483, 1626, 468, -864, -2308, -3930, -5789, -7724, -9345, -10406, -11077, -11696, -12355, -12880, -13187, -13380, -13535, -13584, -13533, -13534, -13610, -13561, -13325, -13109, -12973, -12662, -12101, -11581, -11265, -10946, -10539, -10396, -10794, -11413, -11723, -11710, -11804, -12197, -12571, -12585, -12266, -11805, -11273, -10699, -10156, -9568, -8641, -7341, -6117, -5289, -4507, -3338, -2102, -1334, -781, 184, 1329, 1711, 1136, 551, 655, 881, 254, -1223, -2687, -3641, -4382, -5261, -6115, -6585, -6578, -6310, -6061, -5913, -5732, -5443, -5178, -5018, -4771, -4328, -4009, -4210, -4739, -4983, -4817, -4826, -5349, -5898, -6005, -6059, -6613, -7467, -8107, -8459, -8585, -8280, -7575, -7023, -6997, -7115, -6797, -5988, -5094, -4381, -3712, -2878, -2048, -1639, -1665, -1546, -782, 255, 670, 274, 11, 552, 1087, 579, -443, -788, -672, -1136, -1979, -2188, -1895, -2065, -2663, -2760, -2154, -1528, -1189, -776, -159, 274, 365, 457, 693, 737, 511, 475, 795, 1014, 870, 695, 783, 1030, 1233, 1193, 738, 45, -481, -898, -1675, -2756, -3470, -3573, -3603, -3901, -4015, -3507, -2758, -2356, -2089, -1286, -17, 871, 1011, 1044, 1599, 2392, 2739, 2538, 2227, 2034, 1807, 1484, 1259, 1177, 994, 579, 145, -13, 165, 492, 684, 583, 300, 77, 14, 80, 253, 480, 626, 656, 727, 951, 1250, 1563, 1946, 2353, 2518, 2322, 2060, 2038, 2023, 1551, 706, 88, -74, -236, -744, -1245, -1259, -931, -695, -511, -82, 374, 397, 240, 653, 1622, 2217, 1994, 1673, 1971, 2536, 2660, 2457, 2488, 2620, 2260, 1579, 1441, 2044, 2567, 2389, 1835, 1506, 1524, 1686, 1894, 2156, 2409, 2532, 2526, 2627, 3145, 4119, 5102, 5483, 5083, 4408, 4121, 4269, 4174, 3418, 2665, 2813, 3466, 3432, 2771, 2810, 3794, 4335, 3778, 3276, 3721, 4311, 4075, 3475, 3468, 3932, 4034, 3578, 3075, 2696, 2108, 1349, 964, 1028, 819, -187, -1551, -2295, -1877, -718, 149, 189, -84, 51, 596, 1256, 2055, 2812, 2867, 2130, 1554, 1786, 2234, 2160, 1889, 2180, 3024, 3767, 4083, 4349, 5019, 5967, 6627, 6750, 6668, 6724, 6751, 6444, 5935, 5622, 5524, 5269, 4772, 4422, 4337, 4016, 3231, 2699, 3089, 3825, 3777, 2925, 2340, 2544, 2823, 2313, 1083, -258, -1500, -2940, -4731, -6666, -8641, -10888, -13420, -15630, -16883, -17226, -17032, -16215, -14351, -11340, -7381, -2567, 2861, 8146, 12455, 15568, 17646, 18592, 18177, 16681, 14754, 12631, 10031, 7114, 4901, 4279, 5026, 6257, 7524, 9041, 11062, 13506, 16033, 18282, 20002, 21104, 21694, 22013, 22278, 22476, 22406, 22014, 21531, 21135, 20649, 19773, 18505, 17121, 15765, 14321, 12674, 10889, 9036, 7092, 5155, 3597, 2738, 2445, 2254, 2003, 2003, 2471, 3114, 3600, 4204, 5448, 7208, 8629, 9143, 9089, 9157, 9438, 9302, 8192, 6250, 4112, 2243, 608, -1044, -2666, -3767, -3913, -3264, -2333, -1311, 16, 1722, 3523, 5088, 6225, 6869, 7136, 7248, 7173, 6632, 5649, 4720, 4230, 4048, 3849, 3530, 3077, 2383, 1503, 799, 411, -143, -1303, -2600, -3143, -2857, -2493, -2438, -2266, -1600, -716, -74, 284, 552, 712, 627, 358, 37, -402, -1089, -1948, -2869, -3939, -5225, -6507, -7465, -8013, -8287, -8453, -8606, -8682, -8441, -7691, -6609, -5644, -4944, -4124, -2851, -1414, -370, 174, 514, 751, 733, 427, -54, -686, -1461, -2167, -2547, -2602, -2581, -2619, -2606, -2433, -2236, -2237, -2467, -2732, -2858, -2872, -3000, -3416, -3988, -4380, -4475, -4502, -4671, -4962, -5315, -5760, -6263, -6753, -7348, -8250, -9394, -10513, -11552, -12725, -14095, -15367, -16270, -16867, -17330, -17563, -17360, -16825, -16304, -15913, -15439, -14716, -13895, -13264, -12915, -12604, -12118, -11720, -11911, -12644, -13213, -13171, -12924, -13022, -13289, -13137, -12494, -11851, -11412, -10804, -9771, -8618, -7653, -6745, -5762, -4907, -4314, -3794, -3240, -2806, -2601, -2591, -2737, -2927, -3033, -3206, -3653, -4087, -4037, -3704, -3761, -4305, -4739, -4760, -4738, -4935, -5079, -5073, -5414, -6182, -6457, -5734, -4993, -5145, -5487, -5064, -4327, -4077, -4127, -4164, -4505, -5125, -5414, -5367, -5615, -6160, -6427, -6404, -6495, -6496, -5836, -4648, -3723, -3427, -3344, -3072, -2660, -2135, -1461, -1115, -1672, -2567, -2621, -1924, -1676, -2193, -2711, -2936, -3087, -2919, -2196, -1510, -1426, -1599, -1506, -1112, -449, 444, 1126, 1290, 1415, 1957, 2382, 2046, 1509, 1779, 2496, 2253, 929, 191, 934, 1836, 1561, 859, 1072, 1939, 2342, 2104, 1812, 1722, 1668, 1488, 1211, 1119, 1402, 1619, 1276, 920, 1536, 2825, 3438, 3044, 2782, 3361, 3986, 3789, 3259, 3338, 3729, 3306, 1987, 958, 948, 1358, 1297, 678, 157, 447, 1484, 2283, 2245, 2149, 2765, 3329, 2938, 2382, 2737, 3250, 2635, 1483, 1337, 2101, 2277, 1413, 703, 1000, 1611, 1553, 969, 594, 587, 661, 737, 849, 895, 903, 1023, 1154, 1107, 1049, 1214, 1367, 1113, 524, 39, -89, 52, 218, 198, 19, -10, 386, 1097, 1715, 1983, 2023, 2110, 2307, 2401, 2214, 1883, 1703, 1769, 1931, 2088, 2291, 2536, 2690, 2693, 2646, 2579, 2374, 2070, 1952, 2081, 2023, 1473, 939, 1199, 2076, 2479, 1940, 1429, 1956, 2942, 2968, 1918, 1140, 1338, 1627, 1141, 416, 357, 745, 754, 403, 528, 1366, 2070, 1913, 1323, 1239, 1776, 2137, 1755, 1022, 762, 1197, 1791, 2108, 2446, 3217, 4065, 4247, 3768, 3368, 3401, 3405, 2981, 2403, 1996, 1547, 906, 711, 1641, 3109, 3678, 3006, 2439, 3187, 4602, 4956, 3626, 1818, 981, 1042, 762, -339, -1379, -1592, -1271, -827, -168, 475, 528, 394, 1267, 2990, 3747, 2719, 1548, 2035, 3505, 3913, 2873, 1948, 2118, 2669, 2747, 2452, 2145, 1983, 2165, 2552, 2486, 1934, 1875, 2726, 3507, 3420, 3001, 2959, 3058, 2880, 2718, 2855, 2707, 1684, 426, 63, 485, 557, -83, -735, -955, -990, -1169, -1878, -3621, -6213, -8670, -10557, -12536, -15033, -17390, -18741, -18868, -17859, -15621, -12047, -7322, -1960, 3335, 7915, 11434, 13858, 15095, 14788, 12685, 9247, 5403, 1715, -1664, -4344, -5815, -6136, -5544, -3686, -247, 4051, 8156, 11789, 15002, 17564, 19482, 21160, 22465, 22775, 22164, 21468, 21002, 20357, 19423, 18612, 17950, 16937, 15508, 14314, 13625, 12775, 11364, 10154, 9879, 10122, 10290, 10630, 11434, 12293, 12914, 13555, 14168, 14318, 14081, 13959, 13942, 13623, 12997, 12283, 11369, 10124, 8886, 7949, 6886, 5122, 2989, 1436, 611, -305, -1660, -2673, -2636, -1835, -799, 471, 2080, 3739, 5187, 6530, 7795, 8510, 8213, 7102, 5712, 4166, 2277, 159, -1833, -3518, -4735, -5275, -5350, -5455, -5478, -4893, -3874, -3100, -2543, -1674, -650, -20, 408, 1225, 2219, 2628, 2378, 2143, 2176, 1896, 851, -573, -1796, -2830, -3991, -5284, -6503, -7462, -7955, -7993, -8023, -8243, -8109, -7237, -6225, -5701, -5344, -4665, -3928, -3490, -3053, -2288, -1517, -1228, -1342, -1404, -1253, -1237, -1805, -2941, -4126, -4921, -5459, -6184, -7098, -7621, -7364, -6717, -6234, -5687, -4411, -2534, -999, -247, 318, 1211, 1935, 1748, 795, -166, -904, -1897, -3336, -4711, -5582, -6244, -7184, -8268, -8890, -8831, -8609, -8865, -9563, -10034, -9926, -9755, -10194, -11036, -11404, -10993, -10541, -10787, -11442, -11695, -11513, -11682, -12554, -13499, -13873, -13957, -14454, -15407, -16127, -16175, -15936, -16003, -16228, -15890, -14844, -13861, -13475, -13141, -12197, -11045, -10526, -10522, -10075, -8887, -7834, -7795, -8459, -8669, -7907, -6991, -6986, -7729, -8111, -7716, -7334, -7560, -7755, -7057, -5818, -5107, -5017, -4426, -2706, -845, -172, -525, -614, -39, 147, -807, -2060, -2438, -2245, -2724, -3957, -4577, -3836, -2835, -2907, -3654, -3673, -2767, -2150, -2501, -3064, -3077, -2976, -3455, -4080, -3881, -3039, -2874, -3858, -4643, -3920, -2559, -2522, -3951, -4966, -4569, -4004, -4569, -5597, -5764, -5243, -5195, -5659, -5442, -4084, -2708, -2417, -2789, -2714, -2057, -1605, -1653, -1605, -1059, -537, -653, -993, -539, 776, 1671, 1145, -97, -555, 76, 685, 448, -104, -79, 474, 856, 967, 1454, 2559, 3537, 3593, 3006, 2717, 2987, 3032, 2182, 959, 467, 893, 1297, 1058, 796, 1311, 2248, 2634, 2459, 2683, 3615, 4244, 3724, 2719, 2466, 2985, 3241, 2790, 2286, 2333, 2714, 2964, 3057, 3235, 3496, 3541, 3203, 2755, 2603, 2717, 2673, 2299, 1888, 1712, 1715, 1797, 1982, 2206, 2267, 2111, 1918, 1824, 1815, 1910, 2156, 2352, 2141, 1607, 1353, 1638, 1863, 1418, 600, 102, 5, -60, -90, 231, 847, 1305, 1467, 1738, 2425, 3206, 3526, 3296, 2923, 2769, 2801, 2715, 2315, 1799, 1524, 1431, 1118, 629, 567, 1089, 1498, 1285, 909, 996, 1360, 1422, 1165, 1065, 1250, 1366, 1284, 1413, 2023, 2698, 2880, 2666, 2620, 2900, 3034, 2627, 2019, 1893, 2264, 2352, 1802, 1423, 2010, 3021, 3372, 3113, 3184, 3852, 4445, 4502, 4259, 4058, 3912, 3710, 3450, 3187, 2946, 2716, 2456, 2148, 1937, 2042, 2383, 2503, 2149, 1728, 1771, 2111, 2136, 1790, 1700, 2136, 2518, 2407, 2296, 2691, 3092, 2888, 2534, 2674, 2830, 2250, 1340, 993, 1169, 1206, 996, 863, 756, 400, -11, -85, -4, -147, -230, 30, -122, -1233, -2001, -1027, 563, 728, -60, 283, 1838, 2748, 2477, 2360, 2958, 3108, 2159, 1341, 1899, 2994, 2847, 1476, 778, 1846, 3492, 3995, 3398, 3217, 4175, 5138, 4763, 3571, 3361, 4642, 5835, 5518, 4486, 4508, 5628, 6116, 5157, 4073, 4155, 4712, 4369, 3232, 2413, 2150, 1786, 1235, 1181, 1716, 1946, 1332, 554, 421, 719, 706, 125, -752, -1402, -1360, -916, -1104, -2098, -2645, -2163, -2002, -3283, -5094, -6233, -7223, -9129, -11667, -13693, -14668, -14831, -14449, -13400, -11301, -7973, -3902, 18, 3313, 6196, 8769, 10308, 9847, 7485, 4502, 1983, -262, -2911, -5611, -7010, -6359, -4326, -1938, 736, 4225, 8431, 12484, 15640, 17820, 19239, 19969, 19957, 19328, 18483, 17785, 17176, 16251, 14887, 13582, 12943, 12873, 12674, 12113, 11804, 12115, 12533, 12700, 13163, 14279, 15385, 15921, 16347, 17120, 17787, 17785, 17220, 16300, 14921, 13212, 11808, 11114, 10778, 10229, 9384, 8582, 8060, 7861, 7919, 7879, 7247, 6144, 5356, 5211, 5152, 4828, 4675, 5000, 5439, 5669, 5876, 6154, 6191, 5730, 4822, 3644, 2349, 1049, -274, -1760, -3388, -4828, -5709, -5965, -5762, -5227, -4476, -3801, -3426, -3089, -2350, -1375, -945, -1494, -2561, -3400, -3832, -4291, -5134, -6190, -7053, -7657, -8282, -8958, -9262, -8965, -8542, -8600, -8920, -8616, -7413, -6175, -5760, -5886, -5765, -5387, -5385, -5819, -6012, -5772, -5821, -6635, -7554, -7737, -7440, -7482, -7862, -7846, -7222, -6533, -6172, -5960, -5576, -4925, -4138, -3509, -3237, -3131, -2827, -2346, -2095, -2202, -2270, -1957, -1536, -1516, -1853, -1994, -1685, -1300, -1237, -1400, -1526, -1701, -2157, -2736, -2992, -2885, -2924, -3451, -4063, -4099, -3482, -2836, -2709, -2972, -3152, -3238, -3759, -4948, -6339, -7482, -8597, -10007, -11358, -12073, -12333, -12829, -13560, -13710, -13034, -12441, -12590, -12810, -12284, -11479, -11387, -11935, -12320, -12417, -12782, -13509, -14074, -14301, -14617, -15197, -15580, -15449, -15144, -14997, -14677, -13732, -12446, -11497, -11026, -10535, -9682, -8740, -8182, -8130, -8346, -8519, -8484, -8307, -8205, -8211, -8020, -7456, -6794, -6279, -5701, -4838, -3957, -3410, -3156, -2973, -2791, -2638, -2590, -2729, -2873, -2606, -1898, -1329, -1285, -1335, -917, -301, -215, -671, -950, -848, -1050, -1921, -2771, -2897, -2640, -2707, -3033, -3059, -2703, -2306, -1887, -1183, -425, -330, -1051, -1698, -1451, -809, -1008, -2270, -3443, -3605, -3228, -3237, -3605, -3581, -2913, -2185, -2017, -2366, -2622, -2247, -1353, -694, -864, -1458, -1416, -428, 502, 470, -26, -21, 280, -25, -833, -1140, -716, -428, -759, -1084, -736, 32, 674, 1184, 1728, 2079, 2101, 2163, 2416, 2347, 1670, 912, 561, 394, 127, -24, 139, 400, 614, 1072, 1902, 2622, 2827, 2900, 3379, 3974, 4026, 3682, 3692, 4141, 4346, 4065, 3889, 4132, 4203, 3653, 3069, 3149, 3538, 3502, 3197, 3331, 3955, 4538, 4877, 5167, 5457, 5632, 5713, 5732, 5526, 5019, 4512, 4340, 4389, 4272, 3951, 3827, 4080, 4329, 4214, 3971, 4025, 4216, 4054, 3572, 3263, 3182, 2922, 2513, 2512, 3012, 3375, 3248, 3125, 3507, 4075, 4197, 3886, 3624, 3503, 3154, 2496, 1909, 1631, 1495, 1339, 1244, 1318, 1519, 1744, 1905, 1958, 1959, 2016, 2090, 1972, 1627, 1384, 1491, 1635, 1406, 1062, 1189, 1667, 1721, 1098, 481, 471, 767, 748, 419, 317, 680, 1233, 1717, 2141, 2525, 2815, 3026, 3171, 3195, 3144, 3099, 2905, 2407, 1936, 1978, 2362, 2457, 2180, 2145, 2661, 3246, 3416, 3383, 3561, 3759, 3498, 2899, 2543, 2509, 2278, 1700, 1402, 1908, 2812, 3225, 2939, 2707, 3091, 3410, 2607, 1032, 194, 512, 651, -291, -1230, -654, 1185, 2754, 3340, 3626, 4282, 5022, 5242, 4806, 3945, 3000, 2393, 2258, 2118, 1593, 1195, 1561, 2226, 2225, 1732, 1896, 2864, 3232, 2115, 649, 401, 1127, 1390, 787, 202, 237, 609, 897, 957, 760, 393, 53, -230, -639, -1182, -1564, -1619, -1552, -1517, -1269, -588, 198, 589, 556, 340, -46, -571, -853, -683, -488, -605, -483, 583, 2101, 2841, 2726, 2994, 4009, 4377, 3089, 1180, 97, -343, -1157, -2288, -2734, -2012, -689, 392, 1026, 1749, 2928, 4044, 4364, 3975, 3383, 2493, 1050, -388, -1059, -1257, -1811, -2523, -2314, -967, 352, 657, 392, 550, 1104, 1087, 81, -1150, -1735, -1828, -2218, -3161, -4166, -4765, -4909, -4918, -5393, -6572, -7497, -7010, -5619, -4610, -3478, -682, 3216, 6044, 7423, 8753, 10156, 10285, 8789, 6592, 4144, 1373, -1095, -2304, -2247, -1568, -248, 2398, 6372, 10657, 14432, 17713, 20398, 21733, 21399, 20213, 19075, 17843, 15989, 13847, 12388, 12026, 12293, 12655, 13050, 13592, 14277, 15139, 16123, 16893, 17099, 16908, 16736, 16665, 16538, 16389, 16351, 16213, 15599, 14561, 13553, 12738, 11715, 10280, 8994, 8552, 8767, 8797, 8294, 7830, 8015, 8574, 8636, 7858, 6822, 6151, 5645, 4792, 3753, 3066, 2725, 2425, 2314, 2586, 2744, 2239, 1359, 620, -145, -1361, -2906, -4402, -5747, -6921, -7707, -7989, -7929, -7633, -6944, -5861, -4854, -4400, -4381, -4351, -4347, -4945, -6346, -7926, -9020, -9756, -10594, -11423, -11747, -11610, -11573, -11741, -11541, -10705, -9813, -9452, -9341, -8836, -7955, -7233, -6849, -6575, -6454, -6761, -7426, -8163, -9003, -10068, -11045, -11500, -11532, -11499, -11324, -10643, -9543, -8578, -7946, -7210, -6085, -5044, -4716, -4993, -5204, -5029, -4742, -4593, -4518, -4572, -4965, -5436, -5363, -4761, -4391, -4594, -4843, -4688, -4273, -3711, -2898, -2102, -1897, -2194, -2144, -1397, -756, -1063, -1975, -2577, -2767, -3176, -3927, -4435, -4486, -4635, -5298, -6096, -6476, -6495, -6610, -7047, -7722, -8520, -9235, -9502, -9235, -8939, -9129, -9633, -9911, -9862, -9854, -10033, -10207, -10424, -11082, -12132, -12817, -12666, -12303, -12633, -13454, -13684, -12971, -12201, -12115, -12273, -11944, -11247, -10731, -10411, -9964, -9417, -9059, -8924, -8821, -8718, -8790, -9132, -9571, -9777, -9587, -9227, -9070, -9120, -8920, -8115, -6961, -6054, -5586, -5078, -4079, -3000, -2724, -3245, -3462, -2899, -2558, -3183, -3879, -3654, -3091, -3109, -3280, -2788, -1979, -1662, -1707, -1453, -912, -664, -901, -1238, -1363, -1372, -1448, -1525, -1434, -1152, -777, -404, -210, -385, -741, -702, -169, 25, -782, -1920, -2238, -1776, -1494, -1703, -1937, -2049, -2236, -2278, -1818, -1161, -883, -831, -305, 807, 1746, 1895, 1596, 1603, 1938, 1870, 1052, 119, -213, -147, -339, -784, -802, -50, 1039, 1850, 2240, 2513, 2954, 3506, 3844, 3789, 3508, 3160, 2586, 1713, 1018, 1077, 1654, 1753, 871, -136, 62, 1466, 2410, 1631, 161, 101, 1655, 2872, 2555, 1945, 2666, 4321, 5238, 4861, 4174, 4016, 4078, 3698, 2834, 1884, 1145, 756, 744, 932, 1137, 1509, 2261, 3156, 3731, 3965, 4222, 4536, 4529, 4193, 4061, 4265, 4165, 3492, 3033, 3438, 4080, 4004, 3337, 2916, 2984, 3052, 2709, 2033, 1329, 915, 1040, 1673, 2431, 2980, 3465, 4215, 5095, 5608, 5561, 5206, 4741, 4132, 3368, 2555, 1798, 1263, 1206, 1663, 2227, 2451, 2424, 2644, 3294, 3903, 3918, 3391, 2865, 2674, 2685, 2681, 2651, 2614, 2475, 2258, 2179, 2256, 2190, 1825, 1381, 1063, 827, 631, 582, 769, 1218, 1912, 2649, 3120, 3337, 3674, 4246, 4629, 4421, 3779, 3175, 2841, 2646, 2417, 2204, 2184, 2384, 2609, 2738, 2897, 3193, 3398, 3177, 2602, 2166, 2182, 2392, 2382, 2221, 2393, 3100, 3916, 4316, 4336, 4382, 4512, 4297, 3482, 2378, 1457, 849, 415, 77, -75, 149, 880, 1944, 2896, 3434, 3633, 3693, 3696, 3631, 3417, 2878, 1999, 1162, 811, 925, 1100, 1103, 1083, 1263, 1607, 1843, 1802, 1653, 1668, 1781, 1667, 1308, 1147, 1461, 1941, 2110, 1940, 1748, 1640, 1405, 925, 370, -119, -644, -1269, -1749, -1770, -1315, -679, -148, 248, 724, 1390, 1964, 2042, 1680, 1390, 1395, 1314, 830, 328, 474, 1298, 2056, 2110, 1737, 1758, 2353, 2678, 1988, 689, -212, -390, -277, -135, 242, 936, 1689, 2398, 3269, 4288, 4957, 4851, 4120, 3181, 2206, 1218, 407, -40, -288, -569, -638, 8, 1285, 2491, 3277, 3889, 4315, 4169, 3696, 3626, 3688, 2684, 594, -927, -873, -335, -662, -1378, -1272, -586, -408, -475, 389, 1870, 2341, 1563, 1097, 1682, 2108, 1278, -326, -1983, -3987, -6450, -8286, -8828, -9173, -10142, -10316, -8162, -4529, -903, 3059, 7875, 11931, 13289, 12469, 11321, 10202, 7868, 3643, -1469, -5687, -7834, -7838, -6304, -3829, -573, 3642, 8705, 13896, 18390, 21702, 23362, 22870, 20538, 17570, 14844, 12352, 9986, 7890, 6060, 4659, 4466, 5940, 8339, 10650, 12708, 14724, 16597, 18307, 20020, 21406, 21734, 20931, 19737, 18597, 17165, 15178, 13048, 11163, 9226, 7010, 5311, 5166, 6502, 8297, 9882, 11262, 12578, 13925, 15297, 16182, 15715, 13713, 11103, 8935, 7354, 5877, 4328, 3080, 2495, 2482, 2719, 2994, 3165, 2950, 2137, 945, -152, -1037, -1921, -2756, -3250, -3414, -3424, -3067, -2170, -1286, -1100, -1502, -2110, -3099, -4648, -6317, -7684, -8960, -10317, -11401, -11862, -11783, -11367, -10762, -10163, -9630, -8988, -8210, -7630, -7509, -7685, -7855, -7982, -8254, -8822, -9619, -10432, -11136, -11870, -12788, -13711, -14242, -14205, -13757, -13063, -12102, -10822, -9341, -7930, -6866, -6242, -5953, -5913, -6192, -6862, -7785, -8730, -9586, -10257, -10527, -10219, -9493, -8704, -7961, -7042, -5814, -4560, -3705, -3317, -3058, -2650, -2181, -1903, -1884, -2018, -2245, -2550, -2858, -3119, -3407, -3757, -4101, -4436, -4811, -5048, -4894, -4449, -4055, -3797, -3527, -3271, -3199, -3285, -3420, -3730, -4422, -5441, -6502, -7382, -8033, -8549, -9093, -9718, -10257, -10473, -10318, -9991, -9812, -9977, -10262, -10203, -9739, -9378, -9479, -9804, -10072, -10392, -10838, -11202, -11479, -11964, -12667, -13182, -13312, -13223, -13075, -12872, -12563, -12019, -11177, -10354, -9949, -9858, -9681, -9420, -9388, -9615, -9897, -10208, -10608, -10951, -11058, -10904, -10531, -10012, -9537, -9218, -8842, -8134, -7232, -6577, -6362, -6351, -6241, -6009, -5819, -5771, -5847, -5968, -5990, -5784, -5427, -5188, -5187, -5252, -5158, -4875, -4465, -3895, -3204, -2684, -2472, -2123, -1206, -161, 265, 195, 216, 193, -350, -1076, -1349, -1400, -1818, -2421, -2638, -2389, -1901, -1251, -565, -54, 327, 779, 1288, 1795, 2440, 3165, 3451, 2944, 2096, 1689, 1868, 1979, 1393, 208, -942, -1532, -1420, -689, 482, 1780, 2901, 3837, 4827, 5938, 6882, 7312, 7114, 6324, 5046, 3580, 2357, 1520, 815, 108, -194, 374, 1590, 2680, 3274, 3814, 4774, 5877, 6437, 6307, 6008, 5925, 5857, 5503, 4939, 4387, 3899, 3497, 3231, 2960, 2463, 1900, 1700, 1951, 2281, 2456, 2736, 3454, 4512, 5483, 6087, 6350, 6394, 6263, 5921, 5288, 4349, 3321, 2532, 2048, 1667, 1353, 1385, 1898, 2580, 3063, 3375, 3748, 4113, 4137, 3768, 3402, 3376, 3515, 3412, 3007, 2651, 2645, 2893, 3039, 2858, 2399, 1845, 1319, 869, 549, 410, 433, 563, 833, 1374, 2221, 3145, 3789, 3993, 3927, 3804, 3557, 2939, 1962, 978, 263, -266, -745, -1014, -799, -105, 745, 1422, 1825, 2104, 2442, 2804, 2923, 2619, 2001, 1333, 809, 475, 241, -40, -367, -519, -348, -22, 183, 222, 248, 418, 769, 1189, 1454, 1471, 1447, 1653, 2066, 2408, 2475, 2280, 1947, 1591, 1243, 858, 437, 95, -87, -142, -83, 179, 653, 1160, 1511, 1704, 1845, 1967, 2010, 1898, 1591, 1133, 677, 397, 327, 322, 243, 106, 8, -19, 18, 140, 334, 474, 450, 400, 596, 1049, 1405, 1442, 1366, 1418, 1523, 1591, 1704, 1787, 1605, 1277, 1172, 1211, 971, 604, 769, 1484, 1862, 1463, 1136, 1776, 2846, 3063, 2226, 1317, 933, 738, 387, -17, -435, -959, -1301, -962, -50, 715, 969, 1085, 1386, 1567, 1284, 804, 549, 363, -107, -596, -468, 266, 937, 1269, 1631, 2097, 2203, 1958, 1995, 2298, 1956, 827, 220, 988, 2031, 1944, 1337, 1914, 3582, 4338, 3304, 2012, 1970, 2557, 2353, 1278, 346, 157, 567, 1257, 1942, 2355, 2511, 2798, 3451, 4054, 3949, 3192, 2626, 2708, 2775, 2106, 1231, 1105, 1454, 1310, 845, 1019, 1646, 1619, 875, 474, 812, 1241, 1306, 1241, 1348, 1676, 2110, 2363, 2126, 1327, 71, -1515, -3165, -4527, -5585, -6607, -7501, -7662, -6467, -3633, 649, 5398, 9102, 10935, 11396, 11334, 10876, 9514, 6733, 2484, -2267, -5687, -6567, -5422, -3413, -724, 3151, 8045, 12961, 17101, 20239, 22157, 22375, 20690, 17716, 14540, 11908, 9883, 8271, 7088, 6538, 6769, 7827, 9685, 12151, 14700, 16681, 17792, 18408, 19180, 20279, 21178, 21210, 20233, 18736, 17373, 16275, 14824, 12548, 10119, 8649, 8167, 7913, 8013, 9385, 11968, 14528, 16326, 17692, 18837, 19303, 18697, 17159, 15005, 12466, 9765, 7277, 5537, 4924, 5188, 5623, 5830, 5984, 6229, 6375, 6239, 5735, 4673, 3038, 1440, 589, 421, 305, 49, 85, 620, 1184, 1173, 481, -674, -2138, -3740, -5210, -6520, -7877, -9151, -9853, -9916, -9798, -9681, -9322, -8728, -8189, -7706, -7132, -6645, -6484, -6569, -6758, -7164, -7864, -8814, -10068, -11653, -13268, -14585, -15622, -16423, -16731, -16339, -15395, -14094, -12467, -10648, -9015, -7874, -7335, -7416, -8056, -9069, -10282, -11622, -12968, -14117, -14918, -15314, -15238, -14647, -13621, -12361, -11060, -9853, -8745, -7621, -6484, -5592, -5167, -5103, -5214, -5553, -6179, -6933, -7660, -8404, -9131, -9592, -9639, -9340, -8758, -7899, -6886, -5910, -5061, -4372, -3953, -3893, -4200, -4846, -5729, -6584, -7151, -7458, -7738, -8088, -8329, -8275, -7994, -7728, -7667, -7871, -8306, -8826, -9213, -9372, -9415, -9462, -9452, -9280, -8965, -8585, -8185, -7861, -7779, -8070, -8693, -9427, -10013, -10398, -10807, -11399, -11944, -12051, -11680, -11114, -10565, -10055, -9571, -9067, -8502, -8020, -7844, -7944, -8101, -8314, -8687, -9127, -9515, -10000, -10631, -11093, -11141, -10911, -10557, -10005, -9251, -8408, -7451, -6374, -5463, -5010, -4915, -4956, -5134, -5523, -6095, -6796, -7493, -7896, -7885, -7712, -7526, -7088, -6289, -5500, -5032, -4652, -4035, -3328, -2873, -2663, -2455, -2229, -2155, -2194, -2173, -2235, -2740, -3602, -4212, -4193, -3829, -3600, -3550, -3306, -2526, -1246, 89, 951, 1173, 1101, 1169, 1345, 1184, 432, -531, -1024, -805, -236, 306, 871, 1584, 2273, 2788, 3263, 3695, 3704, 3207, 2724, 2602, 2567, 2413, 2491, 3087, 3916, 4542, 4858, 4971, 4978, 4917, 4730, 4347, 3865, 3500, 3332, 3284, 3349, 3608, 4072, 4687, 5369, 5914, 6072, 5834, 5473, 5243, 5210, 5285, 5234, 4899, 4544, 4601, 4915, 4849, 4300, 3892, 3951, 4048, 3815, 3511, 3514, 3782, 4058, 4261, 4518, 4931, 5378, 5550, 5254, 4635, 3986, 3406, 2800, 2164, 1690, 1558, 1739, 2016, 2236, 2502, 3005, 3633, 3988, 3894, 3626, 3443, 3193, 2643, 1919, 1371, 1147, 1138, 1193, 1243, 1261, 1267, 1330, 1492, 1684, 1774, 1711, 1555, 1397, 1316, 1360, 1462, 1461, 1306, 1126, 1008, 851, 539, 115, -295, -582, -647, -475, -203, 16, 180, 373, 659, 1055, 1446, 1554, 1246, 758, 372, 69, -254, -512, -662, -809, -891, -726, -437, -324, -332, -179, 66, 130, 52, 52, 119, 117, 24, -138, -311, -305, -96, -47, -396, -824, -953, -883, -853, -872, -895, -889, -678, -226, 105, 158, 315, 733, 917, 600, 240, 223, 405, 592, 664, 369, -187, -295, 278, 722, 442, 11, 112, 500, 649, 568, 533, 669, 943, 1146, 1077, 949, 1111, 1365, 1323, 1244, 1537, 1787, 1397, 779, 768, 1243, 1415, 1141, 955, 1034, 1064, 1040, 1366, 2013, 2363, 2166, 1945, 2072, 2164, 1847, 1478, 1486, 1548, 1145, 554, 465, 807, 955, 928, 1212, 1495, 1025, 223, 339, 1348, 1791, 1069, 352, 683, 1529, 1942, 2081, 2513, 2944, 2883, 2739, 2900, 2632, 1405, 284, 339, 772, 304, -566, -355, 1092, 2535, 3164, 3358, 3764, 4393, 4789, 4601, 3828, 2822, 2083, 1732, 1264, 300, -546, -290, 999, 2148, 2463, 2566, 3252, 4232, 4705, 4606, 4436, 4199, 3523, 2575, 1904, 1497, 870, 97, -159, 253, 593, 287, -190, 27, 936, 1679, 1763, 1673, 2002, 2495, 2442, 1693, 726, -150, -1094, -2272, -3514, -4364, -4302, -3115, -1212, 775, 2724, 4923, 7248, 9047, 9841, 9630, 8504, 6556, 4211, 2204, 1065, 812, 1209, 2166, 3769, 6017, 8712, 11478, 13821, 15371, 16106, 16159, 15507, 14277, 13081, 12399, 11977, 11444, 11065, 11162, 11470, 11706, 12144, 12975, 13821, 14416, 15113, 16228, 17461, 18366, 18931, 19437, 19895, 19913, 19132, 17696, 16163, 14872, 13691, 12530, 11725, 11657, 12369, 13763, 15632, 17402, 18484, 18941, 19107, 18770, 17518, 15627, 13705, 11893, 10224, 9052, 8514, 8253, 8153, 8511, 9204, 9566, 9265, 8521, 7573, 6486, 5362, 4228, 3034, 2002, 1486, 1416, 1351, 1042, 514, -210, -1041, -1744, -2299, -2990, -3882, -4644, -5050, -5265, -5495, -5742, -6021, -6482, -7179, -7933, -8567, -9079, -9485, -9666, -9525, -9193, -8885, -8633, -8417, -8382, -8748, -9548, -10622, -11766, -12795, -13597, -14192, -14636, -14830, -14601, -13933, -13032, -12198, -11605, -11259, -11045, -10953, -11104, -11506, -11959, -12335, -12658, -12838, -12741, -12576, -12662, -12825, -12671, -12283, -11984, -11620, -10869, -9955, -9303, -8825, -8184, -7430, -6870, -6640, -6713, -7038, -7496, -7917, -8228, -8430, -8481, -8344, -7986, -7350, -6508, -5761, -5356, -5200, -5104, -5113, -5337, -5712, -6106, -6469, -6702, -6670, -6491, -6435, -6512, -6440, -6140, -5921, -6038, -6329, -6514, -6634, -6925, -7337, -7529, -7352, -7064, -6943, -6940, -6883, -6788, -6788, -6852, -6854, -6853, -7028, -7352, -7572, -7532, -7362, -7285, -7395, -7588, -7678, -7597, -7513, -7640, -7931, -8084, -7926, -7637, -7473, -7433, -7328, -7134, -7052, -7201, -7422, -7544, -7659, -7941, -8261, -8291, -7987, -7615, -7277, -6811, -6218, -5763, -5579, -5510, -5458, -5499, -5698, -6010, -6353, -6578, -6525, -6260, -6042, -5980, -5875, -5554, -5149, -4880, -4729, -4554, -4402, -4380, -4334, -4009, -3541, -3334, -3467, -3601, -3536, -3474, -3635, -3922, -4087, -4048, -3903, -3705, -3369, -2822, -2156, -1588, -1247, -1099, -1051, -1037, -1042, -1118, -1354, -1686, -1848, -1630, -1114, -523, 0, 375, 579, 762, 1100, 1454, 1457, 1042, 555, 272, 135, 53, 163, 631, 1311, 1791, 1839, 1736, 1934, 2373, 2533, 2249, 1964, 1948, 1893, 1609, 1476, 1787, 2205, 2289, 2133, 2127, 2364, 2589, 2596, 2470, 2464, 2690, 2992, 3155, 3167, 3193, 3341, 3534, 3621, 3522, 3262, 2940, 2696, 2635, 2705, 2705, 2543, 2376, 2384, 2521, 2639, 2743, 2906, 3071, 3093, 2933, 2709, 2571, 2591, 2685, 2639, 2301, 1815, 1545, 1657, 1899, 1921, 1727, 1618, 1728, 1857, 1857, 1926, 2253, 2598, 2607, 2394, 2331, 2386, 2221, 1832, 1513, 1297, 1025, 781, 728, 769, 767, 851, 1138, 1451, 1603, 1659, 1721, 1672, 1386, 998, 733, 575, 328, -19, -243, -228, -122, -78, -45, 91, 328, 573, 744, 773, 615, 371, 261, 347, 415, 268, 12, -111, -47, 104, 270, 416, 479, 460, 460, 517, 508, 334, 110, 32, 118, 204, 190, 149, 159, 198, 230, 248, 236, 184, 138, 124, 108, 88, 116, 212, 393, 691, 1002, 1092, 937, 833, 941, 1032, 898, 687, 609, 643, 696, 807, 1033, 1330, 1618, 1845, 1971, 1979, 1913, 1817, 1700, 1587, 1526, 1525, 1538, 1556, 1639, 1873, 2261, 2640, 2799, 2775, 2830, 3001, 2976, 2655, 2389, 2358, 2250, 1916, 1745, 1990, 2336, 2458, 2469, 2568, 2705, 2755, 2673, 2473, 2253, 2152, 2127, 2004, 1840, 1909, 2265, 2611, 2703, 2627, 2602, 2680, 2707, 2550, 2278, 2113, 2183, 2371, 2478, 2456, 2394, 2394, 2499, 2613, 2500, 2047, 1511, 1244, 1221, 1120, 883, 848, 1269, 1927, 2379, 2469, 2452, 2646, 3031, 3244, 2972, 2318, 1694, 1390, 1281, 1119, 964, 1069, 1425, 1750, 1924, 2080, 2296, 2500, 2644, 2710, 2649, 2516, 2441, 2373, 2121, 1731, 1448, 1328, 1168, 840, 402, -35, -348, -408, -245, -54, 49, 147, 339, 594, 788, 762, 346, -471, -1416, -2089, -2309, -2241, -2167, -2128, -1822, -969, 305, 1612, 2746, 3684, 4244, 4200, 3750, 3395, 3288, 3173, 2955, 2916, 3279, 3969, 4802, 5701, 6616, 7448, 8138, 8716, 9230, 9691, 10101, 10484, 10856, 11219, 11594, 12024, 12441, 12649, 12556, 12402, 12478, 12650, 12532, 12188, 12217, 12892, 13814, 14549, 15150, 15791, 16351, 16633, 16609, 16364, 16006, 15651, 15297, 14887, 14528, 14416, 14550, 14811, 15199, 15646, 15877, 15756, 15514, 15277, 14822, 14071, 13348, 12914, 12670, 12474, 12340, 12227, 12018, 11697, 11291, 10735, 10023, 9278, 8568, 7864, 7197, 6623, 6128, 5740, 5530, 5387, 5029, 4410, 3719, 2968, 2031, 1049, 297, -225, -636, -811, -678, -525, -638, -929, -1239, -1677, -2362, -3135, -3827, -4522, -5345, -6115, -6501, -6457, -6236, -6032, -5891, -5916, -6200, -6617, -7018, -7480, -8086, -8651, -8980, -9149, -9290, -9409, -9546, -9789, -10073, -10267, -10445, -10811, -11349, -11845, -12140, -12233, -12150, -11902, -11530, -11106, -10735, -10510, -10486, -10640, -10892, -11175, -11402, -11522, -11522, -11425, -11241, -10995, -10723, -10432, -10107, -9792, -9567, -9423, -9292, -9173, -9118, -9081, -8975, -8812, -8663, -8512, -8315, -8181, -8302, -8664, -8991, -9109, -9123, -9134, -9050, -8849, -8720, -8722, -8608, -8289, -8068, -8204, -8530, -8756, -8858, -8960, -9064, -9127, -9191, -9280, -9247, -8937, -8446, -8072, -7991, -8096, -8198, -8244, -8224, -8041, -7718, -7569, -7820, -8171, -8173, -7857, -7543, -7276, -7017, -7030, -7435, -7759, -7524, -6977, -6684, -6720, -6755, -6649, -6517, -6368, -6104, -5832, -5820, -6084, -6308, -6275, -6117, -6016, -5910, -5699, -5473, -5340, -5189, -4848, -4403, -4141, -4176, -4305, -4301, -4216, -4232, -4295, -4180, -3918, -3789, -3835, -3787, -3562, -3397, -3397, -3403, -3388, -3487, -3646, -3664, -3559, -3496, -3455, -3334, -3194, -3165, -3238, -3317, -3327, -3253, -3197, -3293, -3471, -3476, -3265, -3078, -3043, -3012, -2875, -2728, -2683, -2757, -2943, -3172, -3269, -3155, -2950, -2794, -2685, -2592, -2561, -2544, -2333, -1879, -1537, -1642, -1964, -2028, -1864, -1835, -1869, -1621, -1244, -1192, -1394, -1385, -1106, -895, -869, -893, -961, -1127, -1242, -1110, -812, -599, -561, -576, -545, -521, -536, -447, -138, 176, 133, -228, -451, -266, 124, 508, 928, 1299, 1307, 972, 845, 1300, 1996, 2328, 2130, 1737, 1522, 1599, 1862, 2132, 2261, 2230, 2173, 2224, 2367, 2504, 2591, 2609, 2511, 2324, 2223, 2332, 2576, 2786, 2897, 2953, 2999, 3050, 3142, 3311, 3513, 3603, 3460, 3144, 2889, 2851, 2944, 2965, 2853, 2759, 2823, 2984, 3070, 3038, 2993, 3026, 3140, 3277, 3341, 3252, 3074, 2979, 3019, 3025, 2877, 2707, 2696, 2790, 2777, 2584, 2362, 2276, 2323, 2383, 2387, 2383, 2413, 2437, 2408, 2353, 2300, 2218, 2092, 1979, 1897, 1765, 1532, 1296, 1209, 1297, 1450, 1545, 1542, 1501, 1547, 1761, 2021, 2055, 1781, 1493, 1492, 1660, 1632, 1344, 1071, 1002, 1040, 1041, 1002, 984, 1017, 1103, 1214, 1246, 1131, 1003, 1060, 1242, 1267, 1052, 818, 713, 635, 515, 472, 539, 534, 386, 318, 517, 809, 909, 860, 916, 1105, 1236, 1259, 1281, 1280, 1169, 1029, 987, 986, 930, 892, 950, 1017, 1003, 1025, 1235, 1587, 1865, 1942, 1910, 1946, 2075, 2163, 2142, 2102, 2089, 1992, 1783, 1654, 1737, 1903, 1985, 2001, 2016, 2032, 2092, 2250, 2407, 2431, 2362, 2291, 2216, 2152, 2181, 2260, 2248, 2177, 2195, 2275, 2301, 2356, 2565, 2793, 2818, 2690, 2660, 2809, 2965, 2947, 2741, 2485, 2322, 2276, 2237, 2090, 1840, 1615, 1535, 1595, 1693, 1770, 1841, 1934, 2026, 2070, 2036, 1951, 1885, 1888, 1927, 1887, 1708, 1483, 1374, 1428, 1543, 1622, 1694, 1809, 1951, 2077, 2151, 2147, 2091, 2074, 2097, 2035, 1824, 1578, 1414, 1310, 1217, 1147, 1104, 1087, 1151, 1331, 1526, 1620, 1637, 1671, 1710, 1669, 1548, 1428, 1297, 1040, 621, 141, -312, -716, -971, -970, -832, -802, -867, -758, -340, 255, 869, 1423, 1827, 2031, 2144, 2301, 2488, 2584, 2527, 2367, 2223, 2201, 2330, 2563, 2861, 3206, 3545, 3876, 4338, 5048, 5863, 6521, 6948, 7274, 7586, 7885, 8163, 8427, 8637, 8754, 8817, 8897, 9033, 9229, 9486, 9800, 10186, 10645, 11111, 11497, 11822, 12184, 12621, 13027, 13278, 13377, 13425, 13480, 13551, 13645, 13793, 13950, 14027, 14035, 14088, 14250, 14442, 14565, 14600, 14606, 14610, 14585, 14489, 14333, 14165, 14011, 13838, 13572, 13221, 12901, 12710, 12553, 12287, 11965, 11714, 11473, 11129, 10782, 10579, 10397, 10025, 9517, 9052, 8595, 8026, 7412, 6911, 6505, 6054, 5530, 5050, 4689, 4366, 3999, 3609, 3252, 2890, 2456, 1977, 1547, 1143, 651, 57, -484, -905, -1303, -1767, -2224, -2587, -2931, -3364, -3823, -4164, -4376, -4607, -4967, -5412, -5861, -6303, -6745, -7188, -7656, -8179, -8714, -9172, -9549, -9948, -10394, -10767, -10976, -11114, -11301, -11482, -11553, -11579, -11680, -11834, -11968, -12131, -12359, -12554, -12658, -12766, -12955, -13159, -13296, -13368, -13375, -13312, -13210, -13108, -13013, -12899, -12777, -12657, -12541, -12448, -12398, -12378, -12370, -12394, -12458, -12523, -12558, -12589, -12643, -12688, -12656, -12530, -12362, -12231, -12165, -12104, -11995, -11873, -11781, -11648, -11454, -11335, -11400, -11518, -11498, -11354, -11199, -11040, -10877, -10770, -10703, -10555, -10298, -10033, -9803, -9577, -9385, -9256, -9113, -8876, -8628, -8507, -8510, -8514, -8453, -8363, -8278, -8184, -8057, -7918, -7781, -7620, -7394, -7134, -6908, -6722, -6523, -6338, -6254, -6222, -6087, -5853, -5725, -5784, -5842, -5726, -5515, -5345, -5184, -4935, -4667, -4521, -4465, -4323, -4067, -3856, -3784, -3771, -3742, -3699, -3636, -3542, -3458, -3414, -3367, -3284, -3201, -3134, -3028, -2886, -2796, -2808, -2834, -2795, -2729, -2717, -2741, -2735, -2714, -2751, -2827, -2827, -2718, -2606, -2577, -2583, -2538, -2441, -2320, -2150, -1937, -1794, -1814, -1900, -1882, -1768, -1716, -1781, -1837, -1787, -1691, -1641, -1604, -1487, -1290, -1107, -976, -856, -714, -572, -449, -334, -234, -194, -244, -341, -403, -395, -362, -350, -341, -292, -211, -127, -17, 189, 487, 770, 940, 1002, 1039, 1117, 1235, 1337, 1384, 1384, 1360, 1337, 1374, 1542, 1801, 2002, 2062, 2079, 2216, 2486, 2776, 3004, 3180, 3294, 3294, 3203, 3165, 3287, 3495, 3633, 3642, 3580, 3530, 3562, 3720, 3976, 4211, 4308, 4273, 4238, 4317, 4486, 4616, 4634, 4591, 4559, 4535, 4502, 4502, 4546, 4568, 4520, 4465, 4480, 4571, 4700, 4790, 4748, 4603, 4520, 4559, 4593, 4531, 4413, 4228, 3937, 3678, 3635, 3711, 3673, 3527, 3448, 3431, 3361, 3270, 3278, 3341, 3313, 3160, 2964, 2791, 2643, 2495, 2333, 2152, 1960, 1790, 1665, 1587, 1536, 1511, 1499, 1477, 1430, 1380, 1339, 1296, 1247, 1190, 1073, 842, 551, 349, 318, 359, 327, 204, 80, -4, -58, -45, 57, 142, 84, -58, -130, -119, -137, -209, -257, -265, -308, -411, -494, -494, -457, -462, -514, -567, -597, -605, -582, -515, -433, -377, -360, -351, -312, -222, -81, 53, 85, -12, -127, -128, -29, 83, 181, 244, 204, 107, 136, 336, 513, 549, 553, 616, 660, 653, 707, 858, 972, 955, 894, 907, 967, 970, 898, 819, 765, 710, 660, 653, 667, 607, 454, 322, 320, 401, 425, 337, 215, 142, 126, 117, 75, -7, -97, -147, -156, -174, -251, -364, -458, -500, -503, -487, -478, -515, -597, -641, -603, -562, -594, -629, -587, -533, -554, -592, -578, -572, -628, -664, -605, -523, -540, -636, -690, -637, -513, -370, -215, -62, 51, 109, 167, 295, 503, 720, 841, 827, 741, 691, 702, 700, 635, 567, 582, 659, 724, 783, 902, 1067, 1192, 1275, 1391, 1510, 1500, 1345, 1181, 1079, 957, 747, 490, 236, -19, -249, -331, -162, 197, 582, 898, 1206, 1600, 2078, 2594, 3138, 3675, 4050, 4152, 4100, 4118, 4262, 4467, 4709, 4972, 5149, 5197, 5292, 5664, 6319, 7065, 7743, 8330, 8856, 9331, 9768, 10203, 10656, 11079, 11358, 11481, 11556, 11670, 11780, 11854, 11995, 12285, 12646, 12970, 13324, 13819, 14390, 14834, 15115, 15377, 15712, 16009, 16184, 16313, 16449, 16480, 16341, 16179, 16145, 16216, 16273, 16300, 16347, 16415, 16445, 16425, 16402, 16419, 16452, 16428, 16299, 16059, 15736, 15363, 14982, 14631, 14314, 14021, 13741, 13454, 13134, 12787, 12488, 12267, 12058, 11776, 11429, 11048, 10619, 10122, 9588, 9026, 8414, 7794, 7276, 6895, 6537, 6081, 5519, 4955, 4476, 4120, 3882, 3671, 3322, 2749, 2056, 1415, 886, 437, 38, -380, -930, -1605, -2255, -2766, -3153, -3465, -3733, -4035, -4460, -5001, -5551, -6041, -6481, -6911, -7369, -7905, -8528, -9142, -9606, -9911, -10215, -10658, -11187, -11599, -11775, -11779, -11763, -11849, -12058, -12352, -12645, -12874, -13032, -13157, -13289, -13467, -13734, -14081, -14386, -14512, -14439, -14267, -14099, -14018, -14039, -14060, -13945, -13721, -13550, -13514, -13562, -13637, -13725, -13775, -13768, -13797, -13949, -14152, -14258, -14227, -14138, -14047, -13943, -13812, -13701, -13669, -13682, -13612, -13415, -13212, -13161, -13243, -13332, -13381, -13414, -13403, -13297, -13145, -13020, -12924, -12815, -12668, -12441, -12108, -11726, -11378, -11087, -10860, -10722, -10607, -10388, -10107, -9951, -9954, -9940, -9798, -9603, -9432, -9238, -8989, -8758, -8558, -8276, -7854, -7445, -7199, -7033, -6795, -6533, -6395, -6344, -6216, -5997, -5810, -5720, -5674, -5596, -5434, -5145, -4758, -4378, -4093, -3877, -3648, -3382, -3128, -2919, -2740, -2575, -2422, -2289, -2186, -2145, -2139, -2077, -1900, -1669, -1479, -1349, -1224, -1096, -1003, -930, -822, -705, -675, -724, -747, -743, -808, -926, -962, -894, -827, -791, -710, -562, -418, -309, -204, -96, -4, 54, 73, 38, -43, -151, -274, -388, -466, -491, -458, -351, -202, -111, -99, -51, 106, 279, 368, 393, 372, 254, 70, -79, -216, -422, -642, -766, -821, -885, -902, -796, -656, -585, -528, -379, -182, -76, -104, -195, -301, -431, -576, -690, -788, -928, -1088, -1144, -1042, -880, -756, -621, -371, -36, 233, 372, 451, 553, 667, 745, 753, 664, 499, 343, 276, 286, 314, 352, 434, 582, 790, 1024, 1238, 1410, 1554, 1679, 1760, 1786, 1766, 1708, 1632, 1577, 1541, 1466, 1363, 1341, 1455, 1615, 1737, 1860, 2025, 2185, 2297, 2404, 2545, 2676, 2735, 2715, 2640, 2503, 2337, 2253, 2308, 2399, 2386, 2303, 2296, 2416, 2599, 2778, 2898, 2915, 2858, 2833, 2887, 2958, 2972, 2905, 2765, 2599, 2485, 2446, 2439, 2449, 2490, 2526, 2507, 2470, 2489, 2553, 2590, 2580, 2547, 2478, 2356, 2230, 2156, 2102, 2006, 1900, 1870, 1878, 1802, 1657, 1603, 1669, 1692, 1596, 1495, 1477, 1473, 1446, 1456, 1513, 1500, 1351, 1169, 1105, 1154, 1190, 1140, 1054, 1005, 988, 967, 941, 939, 982, 1056, 1109, 1095, 1034, 1010, 1087, 1266, 1449, 1490, 1354, 1224, 1282, 1446, 1502, 1440, 1397, 1385, 1346, 1350, 1469, 1570, 1500, 1345, 1295, 1353, 1395, 1387, 1390, 1387, 1316, 1216, 1218, 1326, 1407, 1405, 1393, 1380, 1277, 1098, 1005, 1067, 1148, 1118, 1022, 973, 980, 978, 973, 1028, 1109, 1085, 907, 730, 714, 796, 765, 557, 311, 186, 231, 417, 647, 762, 695, 591, 632, 778, 811, 688, 615, 682, 685, 466, 209, 145, 203, 221, 242, 352, 465, 522, 657, 939, 1195, 1254, 1193, 1202, 1323, 1459, 1529, 1514, 1405, 1202, 1009, 991, 1185, 1416, 1499, 1454, 1428, 1478, 1545, 1636, 1789, 1900, 1754, 1310, 819, 532, 418, 250, -103, -555, -942, -1162, -1175, -989, -683, -394, -190, 7, 307, 678, 990, 1186, 1295, 1312, 1224, 1117, 1118, 1217, 1303, 1344, 1420, 1599, 1902, 2357, 2959, 3579, 4060, 4397, 4755, 5238, 5761, 6194, 6512, 6753, 6931, 7090, 7314, 7619, 7924, 8196, 8513, 8924, 9357, 9756, 10194, 10777, 11434, 11981, 12356, 12680, 13051, 13427, 13732, 13977, 14184, 14323, 14394, 14523, 14819, 15194, 15469, 15622, 15772, 15984, 16238, 16518, 16800, 16999, 17027, 16929, 16803, 16712, 16656, 16609, 16520, 16336, 16063, 15763, 15529, 15419, 15403, 15358, 15188, 14912, 14640, 14431, 14227, 13956, 13603, 13197, 12744, 12249, 11762, 11356, 11009, 10620, 10145, 9650, 9227, 8917, 8669, 8394, 8024, 7583, 7130, 6682, 6214, 5735, 5271, 4805, 4292, 3730, 3166, 2639, 2158, 1733, 1365, 1008, 592, 109, -360, -754, -1108, -1509, -1994, -2536, -3103, -3674, -4218, -4699, -5139, -5605, -6127, -6659, -7136, -7540, -7880, -8161, -8402, -8652, -8954, -9286, -9583, -9830, -10071, -10373, -10755, -11175, -11568, -11888, -12131, -12333, -12521, -12701, -12860, -12990, -13084, -13140, -13169, -13205, -13305, -13480, -13691, -13874, -14009, -14124, -14263, -14457, -14709, -14968, -15154, -15228, -15232, -15253, -15309, -15365, -15379, -15376, -15362, -15309, -15231, -15187, -15207, -15248, -15269, -15270, -15265, -15270, -15308, -15362, -15359, -15243, -15041, -14841, -14696, -14604, -14515, -14361, -14098, -13766, -13457, -13235, -13102, -13011, -12924, -12803, -12617, -12389, -12187, -12065, -11984, -11867, -11686, -11455, -11198, -10907, -10615, -10368, -10169, -9960, -9696, -9412, -9173, -8994, -8836, -8664, -8474, -8268, -8038, -7805, -7600, -7433, -7247, -6982, -6639, -6275, -5952, -5699, -5512, -5347, -5153, -4916, -4648, -4376, -4138, -3973, -3858, -3721, -3530, -3311, -3099, -2917, -2799, -2750, -2703, -2576, -2391, -2244, -2170, -2121, -2045, -1953, -1867, -1779, -1673, -1579, -1531, -1511, -1473, -1392, -1265, -1122, -1030, -1035, -1086, -1079, -988, -867, -765, -693, -659, -646, -605, -520, -425, -358, -316, -297, -327, -396, -424, -342, -204, -126, -139, -171, -148, -75, 9, 76, 92, 37, -46, -90, -78, -52, -50, -77, -102, -93, -67, -68, -103, -115, -66, 5, 32, 14, 13, 59, 118, 163, 210, 279, 363, 454, 566, 690, 788, 861, 954, 1086, 1225, 1341, 1438, 1519, 1569, 1604, 1652, 1731, 1807, 1849, 1871, 1912, 1989, 2086, 2177, 2257, 2333, 2431, 2557, 2691, 2819, 2957, 3093, 3163, 3146, 3129, 3183, 3259, 3284, 3280, 3300, 3334, 3336, 3330, 3368, 3450, 3514, 3532, 3536, 3549, 3560, 3573, 3605, 3628, 3590, 3504, 3432, 3393, 3367, 3352, 3344, 3308, 3225, 3129, 3064, 3043, 3063, 3111, 3139, 3101, 3013, 2932, 2882, 2829, 2750, 2670, 2598, 2495, 2337, 2186, 2108, 2077, 2019, 1907, 1786, 1693, 1631, 1596, 1580, 1574, 1558, 1520, 1450, 1370, 1326, 1340, 1364, 1317, 1181, 1037, 970, 973, 983, 973, 967, 969, 952, 915, 897, 928, 966, 946, 861, 766, 721, 730, 754, 746, 701, 659, 675, 745, 813, 842, 845, 866, 932, 1033, 1140, 1224, 1286, 1359, 1459, 1559, 1620, 1651, 1705, 1800, 1892, 1945, 1974, 2010, 2054, 2109, 2189, 2278, 2330, 2335, 2330, 2346, 2367, 2367, 2354, 2349, 2355, 2362, 2369, 2384, 2389, 2368, 2330, 2300, 2282, 2266, 2243, 2205, 2154, 2112, 2098, 2076, 1962, 1737, 1514, 1429, 1463, 1471, 1369, 1212, 1100, 1064, 1098, 1188, 1282, 1309, 1247, 1153, 1087, 1043, 992, 943, 913, 891, 849, 796, 754, 734, 755, 824, 901, 927, 925, 952, 1002, 1029, 1043, 1071, 1071, 994, 886, 812, 756, 651, 491, 325, 168, 21, -50, 27, 172, 202, 86, -31, -71, -95, -148, -204, -302, -513, -805, -1091, -1355, -1596, -1771, -1875, -1978, -2092, -2121, -1985, -1740, -1495, -1297, -1129, -985, -851, -679, -472, -342, -373, -487, -531, -465, -328, -125, 128, 364, 552, 773, 1106, 1553, 2072, 2622, 3130, 3539, 3875, 4211, 4585, 4971, 5329, 5632, 5863, 6061, 6281, 6563, 6897, 7270, 7700, 8209, 8757, 9276, 9758, 10247, 10757, 11233, 11636, 11996, 12358, 12717, 13028, 13274, 13483, 13688, 13903, 14154, 14450, 14786, 15093, 15328, 15501, 15659, 15830, 15992, 16117, 16194, 16234, 16239, 16207, 16137, 16033, 15932, 15871, 15836, 15790, 15726, 15665, 15608, 15531, 15422, 15271, 15061, 14800, 14549, 14333, 14082, 13724, 13284, 12846, 12475, 12177, 11922, 11666, 11372, 11028, 10652, 10293, 9967, 9654, 9302, 8876, 8395, 7898, 7413, 6927, 6435, 5952, 5486, 5020, 4527, 4029, 3579, 3184, 2797, 2368, 1897, 1426, 976, 528, 34, -524, -1114, -1683, -2222, -2741, -3232, -3708, -4198, -4720, -5243, -5725, -6171, -6598, -6989, -7328, -7638, -7970, -8353, -8779, -9209, -9620, -9989, -10326, -10647, -10960, -11270, -11570, -11850, -12094, -12298, -12467, -12617, -12760, -12904, -13050, -13199, -13352, -13520, -13705, -13900, -14094, -14267, -14424, -14582, -14757, -14945, -15111, -15231, -15314, -15391, -15458, -15479, -15457, -15437, -15450, -15472, -15478, -15469, -15447, -15395, -15344, -15325, -15339, -15353, -15333, -15279, -15195, -15096, -14988, -14864, -14704, -14522, -14339, -14152, -13935, -13692, -13466, -13285, -13126, -12942, -12728, -12518, -12351, -12225, -12112, -11950, -11712, -11435, -11183, -10985, -10793, -10551, -10254, -9934, -9619, -9325, -9082, -8895, -8725, -8514, -8260, -8020, -7842, -7699, -7521, -7287, -7029, -6766, -6471, -6126, -5778, -5488, -5244, -4973, -4652, -4341, -4096, -3886, -3654, -3410, -3208, -3049, -2885, -2702, -2525, -2372, -2213, -2024, -1828, -1671, -1566, -1471, -1351, -1224, -1133, -1079, -1032, -987, -972, -990, -999, -973, -925, -872, -807, -717, -610, -505, -409, -323, -256, -219, -201, -172, -128, -117, -177, -266, -297, -253, -209, -231, -279, -273, -192, -102, -61, -56, -40, -3, 18, -8, -72, -149, -230, -316, -404, -486, -560, -624, -663, -679, -684, -696, -720, -747, -773, -799, -835, -904, -1025, -1193, -1370, -1511, -1609, -1676, -1718, -1725, -1680, -1586, -1455, -1301, -1140, -983, -833, -686, -556, -470, -449, -483, -531, -561, -582, -615, -635, -606, -535, -456, -353, -192, 7, 183, 312, 426, 554, 696, 826, 891, 855, 755, 682, 704, 815, 955, 1071, 1143, 1210, 1322, 1503, 1732, 1980, 2235, 2469, 2629, 2682, 2682, 2705, 2741, 2736, 2705, 2719, 2780, 2843, 2918, 3049, 3204, 3332, 3460, 3639, 3833, 3972, 4045, 4087, 4100, 4075, 4038, 4029, 4041, 4043, 4027, 4023, 4033, 4054, 4115, 4247, 4390, 4471, 4486, 4486, 4489, 4487, 4485, 4462, 4363, 4185, 4019, 3953, 3987, 4061, 4118, 4137, 4133, 4142, 4193, 4273, 4338, 4350, 4300, 4186, 4025, 3860, 3736, 3649, 3549, 3420, 3288, 3181, 3097, 3039, 3038, 3078, 3077, 2982, 2857, 2797, 2782, 2713, 2564, 2414, 2307, 2205, 2083, 1973, 1894, 1817, 1728, 1659, 1637, 1655, 1691, 1717, 1716, 1670, 1590, 1512, 1455, 1413, 1373, 1326, 1250, 1145, 1057, 1030, 1039, 1040, 1045, 1074, 1090, 1073, 1058, 1069, 1065, 1030, 1009, 1025, 1035, 1008, 977, 986, 1018, 1036, 1046, 1085, 1171, 1275, 1349, 1382, 1397, 1416, 1436, 1424, 1370, 1312, 1288, 1277, 1236, 1175, 1145, 1151, 1167, 1189, 1241, 1319, 1383, 1398, 1364, 1308, 1274, 1275, 1267, 1183, 1013, 819, 681, 627, 616, 591, 544, 527, 557, 595, 584, 550, 577, 695, 817, 832, 723, 556, 394, 263, 184, 174, 200, 205, 177, 159, 191, 276, 386, 490, 568, 617, 629, 592, 521, 460, 442, 448, 456, 469, 506, 552, 571, 555, 547, 583, 650, 712, 743, 722, 634, 492, 331, 166, 0, -141, -231, -277, -321, -388, -465, -530, -585, -631, -662, -691, -773, -956, -1232, -1545, -1839, -2082, -2283, -2467, -2635, -2748, -2780, -2774, -2777, -2766, -2694, -2571, -2447, -2336, -2231, -2143, -2100, -2095, -2082, -2026, -1930, -1820, -1719, -1616, -1478, -1287, -1052, -789, -489, -128, 293, 724, 1117, 1461, 1778, 2096, 2416, 2727, 3008, 3263, 3529, 3844, 4205, 4576, 4961, 5398, 5903, 6430, 6918, 7374, 7831, 8284, 8691, 9048, 9396, 9743, 10056, 10321, 10565, 10828, 11120, 11428, 11755, 12101, 12457, 12788, 13091, 13382, 13664, 13906, 14083, 14221, 14348, 14445, 14481, 14486, 14512, 14552, 14580, 14612, 14679, 14759, 14799, 14806, 14834, 14893, 14908, 14841, 14736, 14644, 14536, 14381, 14180, 13944, 13660, 13347, 13071, 12866, 12688, 12484, 12261, 12045, 11815, 11561, 11304, 11077, 10831, 10514, 10151, 9797, 9449, 9067, 8661, 8263, 7860, 7456, 7083, 6742, 6379, 5956, 5521, 5126, 4750, 4353, 3917, 3459, 2976, 2468, 1953, 1452, 955, 437, -67, -530, -966, -1420, -1888, -2315, -2704, -3119, -3573, -3986, -4306, -4604, -4966, -5376, -5762, -6126, -6493, -6854, -7177, -7467, -7748, -8008, -8233, -8438, -8647, -8861, -9070, -9265, -9431, -9569, -9712, -9899, -10144, -10390, -10581, -10732, -10896, -11089, -11266, -11408, -11548, -11719, -11894, -12037, -12161, -12298, -12414, -12476, -12512, -12587, -12708, -12825, -12914, -12994, -13050, -13043, -13001, -13035, -13176, -13298, -13303, -13228, -13148, -13072, -13024, -13039, -13069, -13011, -12861, -12714, -12622, -12555, -12491, -12425, -12324, -12163, -11986, -11872, -11822, -11766, -11643, -11477, -11301, -11110, -10919, -10783, -10715, -10635, -10458, -10201, -9969, -9833, -9757, -9644, -9451, -9255, -9122, -9006, -8832, -8650, -8532, -8410, -8180, -7886, -7639, -7440, -7235, -7038, -6873, -6695, -6469, -6233, -6035, -5867, -5706, -5558, -5424, -5280, -5104, -4898, -4698, -4552, -4465, -4378, -4242, -4091, -3984, -3919, -3844, -3733, -3627, -3566, -3545, -3541, -3539, -3526, -3480, -3401, -3339, -3324, -3323, -3284, -3206, -3124, -3068, -3026, -2980, -2929, -2897, -2895, -2897, -2864, -2800, -2744, -2715, -2686, -2630, -2549, -2459, -2373, -2299, -2222, -2129, -2031, -1941, -1842, -1722, -1638, -1629, -1636, -1580, -1483, -1389, -1287, -1179, -1131, -1153, -1155, -1070, -925, -764, -629, -592, -689, -829, -857, -746, -630, -650, -798, -965, -1058, -1058, -988, -904, -851, -802, -697, -556, -450, -376, -270, -155, -106, -121, -130, -126, -138, -146, -117, -79, -87, -126, -135, -68, 63, 206, 286, 265, 197, 174, 235, 317, 351, 358, 401, 481, 542, 568, 619, 744, 920, 1071, 1143, 1165, 1216, 1320, 1417, 1457, 1477, 1552, 1679, 1798, 1884, 1979, 2122, 2296, 2460, 2617, 2793, 2999, 3203, 3375, 3513, 3631, 3738, 3835, 3926, 4016, 4100, 4166, 4218, 4284, 4395, 4544, 4694, 4808, 4907, 5041, 5239, 5444, 5574, 5603, 5585, 5595, 5648, 5690, 5656, 5552, 5456, 5431, 5453, 5479, 5516, 5591, 5688, 5761, 5793, 5802, 5821, 5874, 5935, 5921, 5785, 5590, 5426, 5316, 5231, 5159, 5081, 4955, 4806, 4716, 4708, 4707, 4640, 4506, 4344, 4173, 3997, 3815, 3612, 3376, 3123, 2896, 2705, 2536, 2393, 2301, 2246, 2162, 2021, 1882, 1810, 1789, 1751, 1647, 1470, 1261, 1082, 946, 822, 683, 549, 432, 327, 256, 259, 332, 423, 487, 511, 500, 488, 515, 568, 578, 517, 410, 291, 183, 121, 126, 167, 203, 227, 243, 267, 359, 544, 733, 809, 789, 780, 817, 843, 818, 757, 683, 614, 571, 568, 600, 649, 702, 756, 838, 964, 1094, 1175, 1220, 1271, 1302, 1248, 1129, 1040, 1023, 1021, 966, 861, 752, 683, 674, 715, 769, 797, 792, 774, 751, 713, 659, 603, 533, 429, 304, 197, 126, 74, 41, 57, 117, 163, 158, 152, 210, 299, 326, 254, 139, 32, -57, -119, -134, -116, -128, -200, -283, -287, -180, -6, 156, 258, 288, 264, 227, 229, 277, 320, 280, 138, -14, -65, -11, 60, 114, 210, 363, 512, 639, 791, 965, 1087, 1130, 1136, 1130, 1104, 1067, 1040, 1003, 946, 891, 875, 905, 970, 1062, 1161, 1237, 1273, 1286, 1285, 1237, 1106, 912, 703, 486, 243, -10, -235, -415, -550, -611, -576, -487, -417, -376, -290, -131, 17, 51, -17, -93, -124, -150, -217, -317, -425, -531, -593, -536, -369, -193, -75, 52, 268, 531, 757, 945, 1152, 1374, 1547, 1673, 1807, 1955, 2074, 2193, 2396, 2674, 2933, 3164, 3449, 3812, 4178, 4504, 4821, 5142, 5441, 5703, 5941, 6159, 6361, 6563, 6780, 7000, 7206, 7436, 7741, 8107, 8454, 8739, 8999, 9276, 9578, 9894, 10204, 10462, 10633, 10731, 10799, 10864, 10964, 11121, 11285, 11375, 11378, 11388, 11483, 11642, 11780, 11839, 11850, 11861, 11900, 11924, 11878, 11739, 11553, 11395, 11284, 11182, 11045, 10878, 10711, 10567, 10443, 10335, 10216, 10081, 9958, 9854, 9725, 9512, 9219, 8913, 8639, 8386, 8128, 7844, 7527, 7189, 6853, 6552, 6295, 6061, 5841, 5622, 5376, 5081, 4763, 4465, 4180, 3852, 3443, 2979, 2515, 2106, 1758, 1425, 1036, 585, 134, -253, -583, -899, -1219, -1530, -1847, -2212, -2611, -2977, -3265, -3517, -3805, -4162, -4558, -4943, -5274, -5531, -5745, -5978, -6260, -6553, -6794, -6970, -7123, -7294, -7514, -7789, -8083, -8338, -8538, -8737, -8979, -9242, -9482, -9682, -9865, -10044, -10206, -10348, -10493, -10644, -10794, -10944, -11091, -11217, -11316, -11420, -11554, -11687, -11779, -11849, -11937, -12033, -12093, -12118, -12168, -12245, -12301, -12297, -12298, -12352, -12416, -12433, -12410, -12393, -12398, -12402, -12395, -12369, -12316, -12244, -12192, -12178, -12158, -12081, -11967, -11884, -11858, -11840, -11786, -11694, -11590, -11493, -11414, -11354, -11276, -11147, -10978, -10821, -10714, -10629, -10516, -10358, -10187, -10035, -9916, -9830, -9737, -9597, -9399, -9201, -9054, -8933, -8766, -8531, -8291, -8083, -7880, -7667, -7484, -7341, -7174, -6933, -6671, -6474, -6338, -6200, -6033, -5870, -5720, -5555, -5366, -5189, -5035, -4869, -4692, -4538, -4410, -4269, -4092, -3920, -3789, -3694, -3602, -3501, -3392, -3286, -3190, -3114, -3040, -2937, -2795, -2649, -2522, -2412, -2321, -2246, -2163, -2046, -1916, -1819, -1760, -1697, -1607, -1528, -1495, -1469, -1386, -1238, -1093, -1000, -939, -869, -776, -667, -529, -370, -256, -235, -253, -214, -108, 8, 103, 183, 248, 283, 315, 400, 540, 671, 735, 752, 786, 873, 979, 1037, 1017, 950, 912, 940, 998, 1011, 955, 863, 790, 773, 812, 874, 924, 978, 1063, 1150, 1180, 1159, 1158, 1218, 1292, 1310, 1254, 1170, 1117, 1093, 1037, 928, 819, 772, 772, 783, 808, 861, 932, 1002, 1078, 1149, 1202, 1253, 1334, 1428, 1481, 1467, 1413, 1375, 1406, 1515, 1659, 1774, 1850, 1924, 2022, 2150, 2312, 2505, 2699, 2842, 2923, 2986, 3089, 3240, 3398, 3515, 3575, 3612, 3679, 3820, 4022, 4233, 4412, 4563, 4722, 4921, 5152, 5380, 5570, 5722, 5841, 5923, 5969, 6022, 6108, 6186, 6189, 6133, 6097, 6125, 6199, 6292, 6391, 6480, 6543, 6595, 6667, 6758, 6839, 6897, 6946, 6974, 6941, 6838, 6733, 6699, 6724, 6739, 6692, 6603, 6523, 6497, 6511, 6524, 6490, 6399, 6273, 6156, 6075, 6015, 5916, 5748, 5550, 5373, 5230, 5092, 4946, 4803, 4676, 4571, 4476, 4365, 4235, 4109, 3990, 3837, 3641, 3443, 3273, 3106, 2908, 2688, 2471, 2268, 2092, 1956, 1839, 1713, 1574, 1430, 1277, 1099, 923, 802, 733, 638, 463, 254, 85, -44, -180, -326, -445, -543, -660, -782, -840, -823, -824, -919, -1058, -1146, -1172, -1205, -1286, -1392, -1492, -1583, -1659, -1709, -1741, -1778, -1829, -1871, -1885, -1884, -1897, -1915, -1906, -1863, -1820, -1807, -1816, -1837, -1857, -1861, -1836, -1809, -1822, -1883, -1958, -1999, -1963, -1845, -1706, -1631, -1628, -1619, -1557, -1491, -1477, -1478, -1435, -1374, -1370, -1402, -1366, -1244, -1128, -1073, -1024, -929, -827, -758, -683, -554, -412, -344, -366, -396, -358, -262, -171, -132, -149, -196, -234, -220, -153, -75, -15, 33, 82, 99, 70, 38, 64, 129, 150, 89, -2, -63, -76, -53, -2, 46, 48, 8, 8, 82, 167, 198, 203, 230, 259, 263, 258, 279, 291, 251, 183, 148, 138, 105, 66, 97, 200, 293, 344, 404, 502, 598, 661, 720, 797, 860, 864, 821, 774, 733, 699, 689, 701, 690, 619, 533, 507, 543, 584, 602, 619, 640, 634, 613, 634, 675, 630, 458, 257, 120, 33, -53, -152, -271, -430, -600, -702, -696, -627, -555, -493, -427, -374, -364, -388, -394, -351, -299, -294, -340, -387, -381, -319, -247, -200, -158, -71, 87, 308, 546, 735, 849, 958, 1156, 1428, 1671, 1827, 1959, 2142, 2369, 2581, 2750, 2921, 3150, 3443, 3754, 4031, 4263, 4496, 4779, 5113, 5451, 5733, 5955, 6166, 6413, 6682, 6923, 7108, 7272, 7465, 7723, 8019, 8287, 8483, 8665, 8912, 9202, 9447, 9623, 9798, 9997, 10165, 10249, 10301, 10387, 10493, 10567, 10625, 10710, 10782, 10785, 10769, 10827, 10947, 11016, 11012, 11005, 11036, 11044, 10976, 10880, 10812, 10749, 10628, 10455, 10288, 10150, 10012, 9861, 9704, 9534, 9331, 9118, 8953, 8844, 8715, 8484, 8180, 7894, 7684, 7514, 7297, 6980, 6601, 6251, 5972, 5710, 5416, 5107, 4821, 4536, 4237, 3931, 3624, 3306, 3002, 2733, 2454, 2085, 1616, 1147, 764, 446, 106, -299, -744, -1175, -1577, -1949, -2282, -2578, -2880, -3235, -3622, -3974, -4255, -4508, -4796, -5133, -5502, -5892, -6288, -6636, -6892, -7103, -7375, -7742, -8102, -8350, -8490, -8621, -8807, -9026, -9254, -9483, -9691, -9849, -9991, -10175, -10400, -10610, -10793, -10981, -11154, -11257, -11307, -11411, -11606, -11809, -11915, -11937, -11963, -12035, -12125, -12203, -12276, -12337, -12360, -12367, -12388, -12442, -12498, -12527, -12530, -12515, -12483, -12442, -12414, -12384, -12325, -12248, -12182, -12103, -11984, -11866, -11804, -11753, -11643, -11505, -11410, -11334, -11205, -11048, -10950, -10902, -10795, -10589, -10396, -10291, -10198, -10045, -9867, -9715, -9544, -9335, -9156, -9036, -8900, -8701, -8488, -8321, -8181, -8025, -7849, -7671, -7499, -7316, -7111, -6893, -6682, -6470, -6244, -6023, -5836, -5654, -5427, -5178, -4980, -4831, -4659, -4434, -4209, -4032, -3869, -3686, -3496, -3325, -3153, -2949, -2735, -2554, -2406, -2270, -2141, -2009, -1845, -1655, -1506, -1439, -1400, -1315, -1172, -1022, -913, -856, -824, -763, -650, -513, -383, -277, -212, -181, -142, -60, 32, 86, 108, 137, 173, 198, 214, 251, 316, 394, 465, 517, 556, 606, 684, 779, 858, 908, 954, 999, 1011, 982, 975, 1034, 1113, 1126, 1082, 1056, 1083, 1129, 1173, 1224, 1264, 1241, 1172, 1154, 1223, 1286, 1248, 1147, 1069, 1031, 994, 936, 866, 805, 776, 772, 743, 662, 576, 552, 600, 658, 624, 454, 225, 81, 50, 19, -84, -221, -349, -482, -585, -590, -537, -546, -629, -686, -675, -658, -669, -685, -690, -707, -756, -813, -842, -829, -797, -778, -779, -786, -790, -766, -664, -500, -367, -326, -297, -181, -6, 148, 290, 476, 673, 804, 884, 1024, 1275, 1553, 1750, 1871, 2012, 2248, 2566, 2887, 3144, 3340, 3545, 3832, 4171, 4435, 4573, 4696, 4936, 5238, 5441, 5553, 5719, 5958, 6165, 6319, 6501, 6692, 6827, 6945, 7135, 7351, 7479, 7509, 7524, 7577, 7672, 7791, 7896, 7935, 7885, 7792, 7753, 7824, 7946, 7989, 7903, 7787, 7747, 7768, 7786, 7801, 7832, 7816, 7681, 7489, 7389, 7417, 7455, 7369, 7176, 6971, 6810, 6655, 6485, 6349, 6263, 6147, 5935, 5692, 5518, 5409, 5285, 5113, 4913, 4681, 4424, 4187, 3999, 3827, 3620, 3372, 3106, 2854, 2661, 2547, 2462, 2311, 2065, 1801, 1608, 1483, 1341, 1124, 854, 599, 401, 251, 106, -78, -296, -483, -600, -694, -840, -1003, -1077, -1058, -1090, -1246, -1406, -1451, -1436, -1487, -1612, -1726, -1816, -1939, -2092, -2195, -2223, -2248, -2324, -2416, -2490, -2550, -2579, -2544, -2487, -2502, -2596, -2674, -2685, -2674, -2691, -2716, -2736, -2788, -2894, -2974, -2941, -2832, -2770, -2800, -2842, -2810, -2702, -2581, -2512, -2497, -2502, -2487, -2452, -2407, -2346, -2270, -2205, -2183, -2203, -2225, -2208, -2145, -2069, -2010, -1951, -1863, -1761, -1686, -1630, -1560, -1484, -1425, -1360, -1269, -1202, -1203, -1210, -1140, -1019, -939, -923, -908, -853, -778, -703, -612, -500, -399, -342, -294, -205, -85, 8, 52, 86, 131, 162, 174, 222, 338, 465, 522, 512, 518, 611, 786, 949, 1005, 959, 918, 959, 1051, 1130, 1185, 1229, 1250, 1235, 1206, 1195, 1215, 1274, 1369, 1462, 1490, 1450, 1436, 1531, 1689, 1789, 1786, 1739, 1713, 1708, 1714, 1739, 1774, 1766, 1685, 1586, 1544, 1568, 1619, 1654, 1638, 1537, 1387, 1282, 1264, 1265, 1207, 1093, 967, 860, 776, 705, 634, 556, 491, 464, 461, 454, 434, 429, 455, 472, 437, 366, 328, 342, 354, 318, 266, 256, 275, 274, 265, 295, 363, 432, 487, 540, 582, 617, 688, 829, 994, 1104, 1136, 1164, 1261, 1414, 1557, 1660, 1754, 1868, 2003, 2154, 2336, 2537, 2714, 2847, 2985, 3174, 3397, 3602, 3781, 3945, 4094, 4220, 4364, 4574, 4816, 5002, 5120, 5247, 5422, 5601, 5764, 5941, 6136, 6316, 6475, 6620, 6733, 6817, 6934, 7110, 7274, 7348, 7364, 7413, 7514, 7618, 7691, 7753, 7818, 7870, 7896, 7919, 7962, 8003, 8014, 7993, 7955, 7901, 7840, 7805, 7809, 7795, 7683, 7482, 7300, 7230, 7230, 7198, 7067, 6881, 6702, 6559, 6449, 6346, 6208, 6015, 5796, 5604, 5443, 5273, 5063, 4834, 4617, 4423, 4224, 3988, 3726, 3480, 3279, 3089, 2851, 2562, 2270, 2008, 1756, 1478, 1167, 851, 559, 291, 22, -269, -579, -880, -1154, -1405, -1656, -1928, -2213, -2485, -2748, -3024, -3318, -3600, -3857, -4130, -4434, -4735, -4995, -5231, -5477, -5726, -5952, -6170, -6408, -6649, -6840, -6985, -7142, -7354, -7594, -7816, -8023, -8226, -8411, -8560, -8704, -8883, -9089, -9276, -9420, -9539, -9644, -9744, -9858, -10001, -10130, -10198, -10226, -10274, -10374, -10488, -10583, -10643, -10665, -10673, -10694, -10731, -10763, -10783, -10794, -10800, -10774, -10716, -10656, -10631, -10627, -10607, -10555, -10494, -10441, -10384, -10322, -10263, -10218, -10172, -10110, -10038, -9960, -9873, -9780, -9694, -9614, -9522, -9421, -9325, -9224, -9096, -8968, -8883, -8823, -8714, -8538, -8373, -8266, -8183, -8064, -7916, -7779, -7651, -7501, -7338, -7195, -7073, -6936, -6777, -6609, -6443, -6283, -6141, -6006, -5846, -5669, -5501, -5344, -5180, -5023, -4879, -4719, -4530, -4345, -4196, -4064, -3914, -3743, -3578, -3421, -3258, -3107, -2993, -2889, -2741, -2556, -2404, -2312, -2228, -2102, -1956, -1820, -1677, -1515, -1377, -1304, -1232, -1085, -905, -781, -701, -599, -493, -417, -321, -164, -19, 44, 80, 177, 312, 408, 475, 581, 716, 800, 834, 914, 1054, 1156, 1178, 1204, 1298, 1406, 1468, 1495, 1527, 1569, 1614, 1663, 1725, 1786, 1827, 1846, 1865, 1899, 1940, 1955, 1947, 1956, 1996, 2031, 2017, 1981, 1978, 2015, 2044, 2049, 2066, 2101, 2111, 2079, 2065, 2110, 2177, 2214, 2225, 2238, 2243, 2228, 2235, 2288, 2319, 2259, 2185, 2225, 2352, 2438, 2459, 2489, 2527, 2509, 2445, 2414, 2432, 2461, 2474, 2457, 2392, 2294, 2218, 2196, 2213, 2216, 2147, 2015, 1925, 1945, 1993, 1949, 1840, 1796, 1836, 1863, 1813, 1747, 1740, 1822, 1960, 2084, 2129, 2094, 2019, 1951, 1945, 2024, 2096, 2054, 1951, 1928, 1981, 2009, 2049, 2184, 2323, 2330, 2282, 2343, 2481, 2560, 2568, 2581, 2617, 2658, 2718, 2807, 2900, 2986, 3065, 3122, 3151, 3195, 3305, 3458, 3568, 3625, 3702, 3796, 3820, 3778, 3812, 3963, 4084, 4084, 4069, 4125, 4184, 4180, 4193, 4292, 4407, 4438, 4434, 4509, 4638, 4702, 4680, 4679, 4739, 4789, 4774, 4728, 4685, 4636, 4581, 4535, 4495, 4448, 4399, 4369, 4361, 4356, 4334, 4283, 4194, 4076, 3977, 3924, 3876, 3785, 3679, 3610, 3562, 3481, 3372, 3299, 3276, 3247, 3184, 3123, 3072, 2976, 2834, 2739, 2734, 2707, 2563, 2375, 2268, 2226, 2153, 2032, 1920, 1831, 1727, 1608, 1511, 1436, 1343, 1229, 1146, 1115, 1075, 972, 844, 763, 717, 638, 519, 429, 375, 291, 169, 76, 30, -44, -170, -268, -287, -279, -307, -355, -386, -413, -478, -567, -625, -633, -641, -684, -734, -748, -734, -732, -756, -780, -777, -756, -736, -733, -743, -760, -778, -787, -784, -776, -781, -803, -825, -816, -778, -755, -756, -743, -693, -639, -615, -604, -579, -545, -504, -457, -424, -428, -450, -435, -369, -300, -275, -273, -237, -158, -89, -79, -86, -38, 46, 88, 84, 108, 169, 192, 172, 182, 234, 258, 240, 240, 289, 351, 385, 397, 407, 428, 464, 509, 560, 613, 655, 674, 690, 725, 766, 772, 738, 716, 740, 779, 790, 777, 787, 829, 873, 903, 935, 976, 1003, 1019, 1042, 1077, 1104, 1107, 1094, 1071, 1049, 1034, 1022, 998, 971, 951, 927, 892, 870, 870, 866, 850, 844, 861, 873, 870, 860, 832, 787, 760, 770, 773, 727, 666, 640, 651, 666, 657, 623, 581, 562, 576, 598, 611, 615, 606, 577, 553, 559, 570, 552, 524, 519, 519, 495, 458, 439, 433, 418, 401, 393, 392, 382, 361, 333, 296, 247, 202, 171, 131, 71, 13, -24, -79, -161, -226, -259, -318, -414, -492, -536, -593, -665, -710, -737, -792, -866, -919, -958, -1008, -1047, -1053, -1050, -1073, -1112, -1143, -1161, -1172, -1176, -1180, -1193, -1224, -1260, -1283, -1283, -1276, -1283, -1299, -1292, -1266, -1256, -1277, -1291, -1265, -1215, -1178, -1159, -1146, -1116, -1064, -1012, -984, -966, -914, -832, -767, -741, -710, -643, -568, -519, -480, -418, -347, -296, -251, -179, -103, -57, -19, 54, 133, 167, 182, 236, 317, 382, 425, 461, 495, 539, 602, 651, 669, 687, 732, 776, 801, 830, 871, 898, 915, 952, 1010, 1045, 1054, 1075, 1117, 1142, 1142, 1159, 1216, 1273, 1284, 1276, 1295, 1324, 1331, 1331, 1355, 1390, 1398, 1387, 1383, 1401, 1438, 1479, 1497, 1479, 1451, 1447, 1466, 1483, 1480, 1457, 1426, 1407, 1395, 1366, 1316, 1275, 1261, 1255, 1227, 1186, 1151, 1124, 1087, 1043, 1004, 979, 957, 917, 853, 786, 737, 701, 656, 604, 551, 490, 421, 361, 317, 265, 193, 126, 76, 23, -45, -115, -173, -227, -285, -348, -414, -480, -540, -599, -665, -728, -781, -849, -940, -1025, -1070, -1100, -1155, -1239, -1318, -1373, -1423, -1483, -1555, -1622, -1679, -1730, -1790, -1856, -1925, -1993, -2061, -2125, -2183, -2245, -2312, -2369, -2417, -2475, -2546, -2607, -2649, -2692, -2742, -2790, -2833, -2891, -2960, -3014, -3046, -3073, -3107, -3150, -3198, -3235, -3252, -3278, -3325, -3369, -3385, -3397, -3429, -3462, -3476, -3494, -3519, -3537, -3542, -3554, -3568, -3568, -3557, -3551, -3545, -3533, -3519, -3512, -3496, -3472, -3452, -3441, -3426, -3401, -3373, -3348, -3321, -3290, -3262, -3237, -3197, -3140, -3090, -3056, -3013, -2949, -2891, -2859, -2826, -2767, -2691, -2621, -2566, -2526, -2496, -2454, -2396, -2348, -2322, -2284, -2224, -2170, -2138, -2103, -2050, -1991, -1939, -1894, -1852, -1811, -1765, -1715, -1672, -1637, -1596, -1548, -1510, -1481, -1461, -1443, -1421, -1392, -1364, -1352, -1345, -1319, -1283, -1262, -1255, -1233, -1195, -1162, -1147, -1136, -1115, -1077, -1032, -998, -979, -962, -935, -909, -899, -892, -875, -854, -835, -811, -786, -769, -763, -757, -754, -748, -731, -708, -701, -715, -729, -733, -731, -733, -734, -735, -738, -742, -743, -748, -758, -765, -769, -782, -807, -829, -837, -835, -842, -861, -885, -905, -916, -916, -916, -929, -952, -961, -956, -960, -983, -994, -981, -968, -977, -994, -1005, -1008, -1003, -997, -1002, -1009, -995, -963, -948, -962, -979, -983, -983, -982, -977, -972, -974, -971, -958, -947, -941, -925, -896, -883, -891, -896, -877, -853, -843, -835, -809, -784, -786, -793, -773, -734, -704, -672, -627, -595, -580, -552, -507, -488, -490, -460, -398, -359, -358, -345, -299, -241, -189, -127, -58, -11, 11, 48, 110, 162, 182, 213, 274, 328, 357, 392, 453, 503, 538, 585, 653, 710, 738, 759, 791, 830, 863, 881, 890, 916, 976, 1041, 1083, 1104, 1125, 1150, 1179, 1211, 1228, 1227, 1229, 1254, 1269, 1250, 1232, 1247, 1275, 1281, 1273, 1267, 1263, 1257, 1265, 1284, 1288, 1267, 1246, 1243, 1242, 1218, 1191, 1188, 1205, 1216, 1216, 1221, 1236, 1254, 1271, 1284, 1269, 1228, 1184, 1157, 1146, 1159, 1193, 1221, 1220, 1211, 1227, 1261, 1273, 1258, 1257, 1289, 1322, 1326, 1314, 1306, 1293, 1277, 1276, 1289, 1291, 1287, 1307, 1344, 1366, 1372, 1380, 1383, 1370, 1356, 1358, 1356, 1344, 1351, 1387, 1424, 1433, 1430, 1441, 1457, 1451, 1437, 1439, 1451, 1447, 1431, 1440, 1479, 1511, 1522, 1540, 1578, 1609, 1606, 1591, 1595, 1605, 1600, 1599, 1617, 1630, 1625, 1629, 1657, 1678, 1678, 1682, 1681, 1657, 1632, 1639, 1647, 1628, 1615, 1632, 1636, 1610, 1609, 1659, 1702, 1690, 1646, 1609, 1586, 1565, 1546, 1536, 1533, 1530, 1518, 1490, 1463, 1457, 1474, 1489, 1473, 1438, 1409, 1383, 1343, 1312, 1318, 1335, 1322, 1291, 1281, 1296, 1312, 1334, 1364, 1374, 1345, 1312, 1317, 1344, 1352, 1341, 1349, 1374, 1388, 1393, 1424, 1473, 1500, 1492, 1483, 1479, 1469, 1470, 1499, 1519, 1498, 1468, 1472, 1498, 1506, 1495, 1490, 1493, 1490, 1476, 1463, 1463, 1462, 1446, 1428, 1436, 1463, 1474, 1456, 1441, 1459, 1491, 1508, 1509, 1516, 1527, 1525, 1515, 1520, 1543, 1559, 1561, 1562, 1569, 1564, 1548, 1542, 1540, 1531, 1522, 1533, 1541, 1516, 1476, 1452, 1438, 1403, 1352, 1316, 1301, 1291, 1276, 1267, 1265, 1252, 1222, 1195, 1192, 1194, 1165, 1118, 1095, 1108, 1114, 1092, 1085, 1116, 1135, 1109, 1087, 1122, 1182, 1197, 1177, 1184, 1227, 1254, 1264, 1310, 1388, 1422, 1398, 1398, 1438, 1413, 1255, 1043, 890, 804, 725, 645, 609, 640, 683, 677, 615, 525, 426, 323, 226, 152, 118, 121, 134, 134, 141, 179, 223, 209, 114, 5, -51, -67, -93, -118, -102, -72, -104, -195, -255, -251, -254, -328, -427, -460, -398, -295, -200, -119, -49, -38, -124, -221, -192, -82, -88, -265, -464, -610, -821, -1196, -1675, -2089, -2163, -1567, -136, 2024, 4641, 7190, 8739, 8366, 6052, 2840, -100, -2390, -4298, -5872, -6561, -5757, -3602, -1123, 438, 586, -130, -883, -1600, -2771, -4196, -4772, -3908, -2365, -1244, -856, -1046, -1876, -3380, -5110, -6396, -6863, -6453, -5212, -3350, -1436, -279, -407, -1618, -3206, -4647, -5836, -6638, -6659, -5655, -3891, -1869, 43, 1537, 2259, 2041, 1078, -214, -1437, -2346, -2920, -3143, -2825, -1915, -938, -636, -1221, -2409, -3931, -5475, -6381, -6050, -4604, -2688, -748, 1061, 2445, 2944, 2485, 1514, 466, -586, -1586, -2238, -2363, -2133, -1716, -1029, -49, 1028, 2044, 2973, 3585, 3442, 2450, 1192, 459, 592, 1478, 2919, 4624, 6019, 6559, 6153, 4977, 3079, 531, -2174, -4279, -5252, -4986, -3700, -1822, 163, 1871, 2960, 2959, 1436, -1414, -4516, -6548, -6829, -5452, -2886, 114, 2451, 3170, 2158, 84, -2345, -4697, -6450, -6926, -5943, -4149, -2344, -824, 246, 430, -436, -1730, -2635, -2865, -2476, -1435, 244, 2301, 4429, 6292, 7229, 6412, 3654, -128, -3540, -5735, -6693, -6653, -5703, -4026, -2220, -1054, -940, -1724, -2896, -3924, -4472, -4447, -3982, -3354, -2864, -2662, -2720, -2948, -3236, -3432, -3435, -3334, -3303, -3353, -3310, -2995, -2300, -1265, -289, -31, -756, -1893, -2512, -2190, -1201, -6, 1167, 2189, 2815, 2783, 1981, 498, -1272, -2513, -2379, -805, 1288, 2754, 3075, 2388, 1030, -689, -2345, -3356, -3245, -2035, -226, 1673, 3379, 4485, 4451, 3314, 1950, 1151, 882, 786, 840, 1109, 1424, 1632, 1727, 1615, 1221, 731, 340, 38, -81, 206, 788, 1317, 1801, 2347, 2582, 2164, 1494, 1093, 819, 463, 357, 732, 1221, 1479, 1578, 1600, 1574, 1726, 2126, 2426, 2473, 2567, 2797, 2938, 3138, 3745, 4404, 4399, 3853, 3578, 3826, 4127, 4246, 4462, 4912, 5284, 5248, 4805, 4079, 3005, 1474, -180, -1179, -1085, -294, 738, 2189, 4073, 5428, 5383, 4571, 4217, 4296, 3811, 2602, 1673, 1678, 2055, 1888, 1063, 276, 138, 507, 709, 312, -318, -262, 1002, 3002, 4829, 6036, 6547, 6189, 4966, 3367, 1759, 6, -1743, -2641, -2192, -1074, -270, 87, 523, 1297, 2201, 2983, 3564, 3881, 3879, 3682, 3536, 3389, 2744, 1174, -1150, -3548, -5395, -6571, -7266, -7311, -6047, -3349, -394, 1346, 1590, 967, -206, -1910, -3535, -4163, -3648, -2751, -2272, -2452, -3016, -3540, -3916, -4404, -5064, -5359, -4671, -3019, -976, 869, 2084, 2333, 1530, -23, -1837, -3565, -5076, -6210, -6488, -5367, -3033, -595, 1020, 1952, 2620, 2788, 2271, 1686, 1498, 1177, 274, -636, -968, -1137, -1831, -3129, -4721, -6190, -6884, -6284, -4553, -2327, -202, 1372, 2240, 2706, 2997, 2782, 1808, 522, -605, -1679, -2709, -3356, -3762, -4442, -5042, -4613, -3292, -2333, -2378, -2855, -2889, -1922, 99, 2369, 3681, 3682, 3004, 2011, 438, -1602, -3270, -3913, -3695, -3125, -2385, -1286, 242, 1693, 2282, 1880, 1314, 1408, 2094, 2784, 3075, 2797, 1955, 902, 74, -540, -1168, -1624, -1560, -1122, -680, -55, 1275, 3234, 4983, 5740, 5379, 4162, 2342, 234, -1702, -3174, -4239, -4941, -5061, -4487, -3554, -2696, -1994, -1251, -381, 491, 1172, 1492, 1403, 1120, 1101, 1610, 2249, 2102, 591, -1858, -4095, -5212, -5188, -4600, -3810, -2621, -807, 1243, 2707, 3090, 2564, 1639, 792, 322, 246, 326, 233, -316, -1403, -2564, -2910, -2052, -611, 594, 1476, 2275, 2792, 2675, 2089, 1482, 926, 226, -483, -809, -760, -833, -1270, -1650, -1436, -583, 571, 1637, 2243, 2147, 1557, 1053, 997, 1247, 1516, 1754, 1976, 1990, 1587, 842, -57, -1127, -2324, -3139, -2899, -1580, 109, 1601, 2974, 4304, 5022, 4498, 2984, 1370, 231, -356, -436, -158, 159, 384, 603, 694, 425, -46, -352, -443, -360, 103, 913, 1461, 1321, 851, 592, 553, 440, 147, -162, -205, 150, 607, 694, 418, 187, 88, -181, -664, -1005, -978, -616, 37, 832, 1316, 1114, 442, -115, -243, -114, -68, -301, -757, -1051, -561, 917, 2617, 3412, 3044, 2131, 1130, 29, -1087, -1975, -2575, -2767, -2249, -1187, -338, -42, 94, 284, 201, -274, -823, -1178, -1192, -742, -68, 317, 400, 547, 624, 190, -510, -896, -1095, -1597, -2289, -2751, -2982, -3101, -2976, -2644, -2394, -2204, -1801, -1309, -1123, -1210, -1186, -987, -882, -933, -897, -688, -563, -773, -1229, -1643, -1848, -1887, -1919, -2124, -2547, -2955, -3065, -2934, -2899, -3061, -3100, -2668, -1789, -743, 237, 1026, 1487, 1533, 1266, 885, 457, -58, -601, -989, -1111, -1013, -828, -688, -635, -588, -457, -265, -65, 179, 486, 765, 955, 1110, 1279, 1433, 1545, 1595, 1484, 1178, 855, 737, 785, 781, 664, 594, 701, 946, 1237, 1565, 1917, 2143, 2038, 1618, 1194, 1057, 1160, 1229, 1145, 1042, 1066, 1196, 1386, 1703, 2180, 2627, 2788, 2650, 2414, 2168, 1807, 1281, 749, 414, 354, 521, 774, 976, 1120, 1312, 1588, 1882, 2158, 2445, 2695, 2789, 2684, 2495, 2353, 2250, 2065, 1715, 1270, 911, 775, 845, 972, 1060, 1204, 1523, 1884, 2020, 1929, 1892, 2048, 2243, 2300, 2229, 2124, 2046, 1913, 1493, 755, 154, 130, 414, 376, 1, -156, 130, 511, 625, 429, 60, -249, -299, -160, -119, -292, -545, -734, -764, -566, -249, -71, -122, -275, -492, -865, -1314, -1627, -1783, -1917, -2014, -1985, -1945, -2088, -2363, -2516, -2481, -2472, -2633, -2816, -2828, -2707, -2614, -2580, -2540, -2493, -2460, -2411, -2320, -2217, -2140, -2123, -2245, -2544, -2936, -3267, -3456, -3524, -3520, -3470, -3358, -3144, -2811, -2474, -2361, -2596, -2996, -3220, -3140, -2940, -2856, -2951, -3123, -3178, -2969, -2592, -2341, -2319, -2291, -2069, -1826, -1852, -2138, -2398, -2399, -2195, -2037, -2060, -2112, -1981, -1743, -1623, -1616, -1494, -1195, -873, -606, -338, -99, -42, -190, -375, -473, -542, -674, -819, -827, -649, -405, -252, -231, -230, -78, 279, 690, 924, 927, 852, 849, 918, 981, 988, 932, 812, 609, 353, 203, 354, 765, 1099, 1088, 849, 711, 830, 1101, 1339, 1405, 1287, 1141, 1164, 1352, 1459, 1277, 894, 618, 660, 917, 1076, 946, 662, 513, 630, 880, 1026, 922, 584, 161, -182, -401, -577, -778, -891, -749, -420, -174, -107, 3, 331, 703, 840, 710, 475, 245, 19, -239, -545, -832, -977, -960, -951, -1118, -1393, -1509, -1243, -630, 22, 411, 545, 701, 988, 1203, 1149, 819, 240, -470, -970, -1021, -856, -823, -884, -857, -747, -498, 56, 743, 1137, 1229, 1331, 1409, 1221, 912, 785, 742, 578, 438, 510, 724, 1020, 1441, 1847, 2028, 2070, 2171, 2215, 1967, 1478, 994, 691, 664, 918, 1280, 1575, 1859, 2237, 2574, 2651, 2526, 2454, 2503, 2499, 2350, 2174, 2037, 1847, 1640, 1651, 1878, 1906, 1415, 609, -15, -86, 486, 1370, 1981, 2118, 2268, 2916, 3830, 4398, 4328, 3751, 2935, 2151, 1562, 1105, 685, 461, 694, 1333, 2019, 2537, 3036, 3665, 4220, 4355, 4004, 3411, 2836, 2421, 2236, 2215, 2165, 2026, 1990, 2228, 2614, 2835, 2678, 2198, 1667, 1335, 1267, 1473, 2043, 2848, 3393, 3448, 3506, 4034, 4619, 4542, 3759, 2691, 1523, 340, -513, -714, -248, 673, 1667, 2342, 2850, 3734, 4859, 5282, 4581, 3378, 2260, 1236, 376, -102, -360, -605, -499, 218, 1083, 1618, 2012, 2495, 2786, 2599, 2051, 1385, 856, 685, 694, 436, 0, -44, 300, 412, 163, 88, 352, 547, 456, 276, 250, 599, 1414, 2246, 2383, 1765, 1024, 568, 210, -295, -937, -1649, -2311, -2632, -2410, -1872, -1431, -1136, -678, 0, 525, 632, 483, 209, -408, -1490, -2753, -3869, -4738, -5291, -5466, -5410, -5329, -5196, -4891, -4411, -3740, -2870, -2064, -1648, -1580, -1612, -1723, -1942, -2114, -2269, -2748, -3579, -4292, -4625, -4758, -4735, -4393, -3874, -3529, -3357, -3045, -2448, -1652, -841, -343, -418, -798, -894, -544, -174, -145, -333, -437, -401, -369, -365, -225, 173, 711, 1110, 1197, 1100, 1212, 1732, 2285, 2375, 2107, 1957, 2013, 2100, 2328, 2766, 3034, 2954, 3019, 3539, 4115, 4459, 4825, 5198, 5107, 4552, 4127, 4054, 3959, 3566, 2972, 2438, 2285, 2610, 3037, 3280, 3686, 4518, 5171, 5046, 4619, 4664, 4964, 4704, 3722, 2634, 2027, 1947, 1952, 1609, 1063, 923, 1328, 1665, 1493, 1157, 1137, 1352, 1433, 1241, 895, 616, 563, 619, 497, 139, -298, -828, -1487, -1963, -2036, -2089, -2523, -3023, -3113, -2931, -2819, -2706, -2478, -2373, -2569, -2868, -3099, -3385, -3821, -4258, -4570, -4817, -5064, -5209, -5140, -4931, -4730, -4611, -4643, -4890, -5197, -5299, -5320, -5633, -6190, -6598, -6812, -6996, -6928, -6397, -5860, -5764, -5733, -5285, -4720, -4525, -4578, -4591, -4642, -4865, -5174, -5512, -5875, -6129, -6197, -6274, -6477, -6539, -6193, -5632, -5263, -5127, -4859, -4236, -3508, -3087, -3088, -3309, -3446, -3332, -3154, -3353, -4024, -4659, -4813, -4689, -4674, -4698, -4519, -4252, -4117, -4007, -3694, -3260, -3002, -3034, -3214, -3380, -3453, -3364, -3143, -3032, -3228, -3565, -3725, -3648, -3446, -3154, -2911, -2993, -3343, -3549, -3494, -3463, -3492, -3345, -3149, -3292, -3689, -3827, -3499, -2939, -2417, -2109, -2148, -2421, -2528, -2230, -1809, -1740, -2111, -2619, -3038, -3356, -3488, -3311, -3018, -3024, -3336, -3451, -2986, -2113, -1315, -952, -1032, -1207, -1151, -947, -886, -1009, -1194, -1459, -1725, -1739, -1562, -1511, -1450, -1011, -551, -728, -1213, -1152, -676, -558, -777, -743, -490, -418, -372, 1, 446, 502, 305, 296, 443, 330, -42, -114, 434, 1115, 1193, 628, 101, 189, 773, 1279, 1298, 892, 456, 384, 762, 1326, 1769, 1992, 1994, 1817, 1821, 2480, 3547, 4094, 3779, 3296, 3224, 3348, 3448, 3666, 3858, 3567, 2854, 2323, 2259, 2438, 2663, 2911, 3121, 3257, 3438, 3770, 4218, 4738, 5314, 5772, 5787, 5284, 4664, 4390, 4412, 4281, 3771, 3091, 2543, 2302, 2511, 3192, 4014, 4455, 4358, 4124, 4237, 4739, 5281, 5515, 5270, 4552, 3630, 3049, 3236, 3955, 4423, 4137, 3410, 2932, 3029, 3556, 4135, 4267, 3633, 2632, 2118, 2355, 2790, 2942, 2879, 2760, 2602, 2536, 2693, 2900, 2923, 2852, 2854, 2809, 2562, 2342, 2484, 2847, 2935, 2591, 2129, 1729, 1305, 982, 1033, 1197, 879, 123, -288, 96, 915, 1664, 2234, 2612, 2650, 2422, 2376, 2701, 2878, 2336, 1270, 327, -231, -534, -588, -308, 146, 496, 692, 901, 1263, 1779, 2267, 2394, 1967, 1274, 890, 973, 1076, 957, 1057, 1648, 2149, 2077, 1941, 2325, 2836, 2823, 2403, 1983, 1575, 1212, 1278, 1825, 2245, 2166, 2098, 2600, 3338, 3611, 3470, 3533, 3806, 3603, 2782, 2217, 2567, 3311, 3618, 3597, 3803, 4045, 3801, 3421, 3558, 3771, 3108, 1842, 1151, 1279, 1404, 1214, 1355, 2265, 3463, 4214, 4356, 4336, 4594, 5039, 5142, 4503, 3224, 1851, 1044, 1131, 1717, 2008, 1768, 1610, 2004, 2564, 2751, 2631, 2406, 1900, 1025, 148, -376, -535, -371, 80, 563, 848, 1127, 1751, 2701, 3580, 3949, 3537, 2451, 1235, 448, 115, -171, -669, -1208, -1428, -1148, -535, 49, 412, 632, 756, 579, -25, -716, -958, -741, -616, -843, -907, -285, 715, 1398, 1585, 1513, 1193, 471, -488, -1355, -2117, -2936, -3652, -3911, -3743, -3414, -2760, -1446, 63, 854, 996, 1404, 2109, 2037, 842, -433, -959, -1186, -1822, -2687, -3184, -3166, -2768, -1967, -1018, -644, -981, -1021, -130, 753, 571, -155, -306, 55, 103, -312, -703, -875, -1019, -1203, -1346, -1490, -1701, -1840, -1768, -1674, -1811, -1972, -1717, -1076, -530, -312, -199, 70, 531, 1028, 1268, 1029, 475, -9, -340, -782, -1478, -2199, -2621, -2599, -2234, -1805, -1643, -1842, -2102, -2060, -1858, -2073, -2923, -3942, -4620, -4932, -5003, -4835, -4569, -4417, -4248, -3781, -3113, -2525, -2074, -1862, -2197, -3035, -3829, -4298, -4714, -5214, -5542, -5643, -5820, -6109, -6056, -5398, -4522, -3936, -3635, -3341, -3036, -2796, -2463, -2005, -1758, -1810, -1766, -1527, -1534, -1816, -1790, -1343, -1139, -1456, -1695, -1354, -706, -231, 37, 353, 799, 1191, 1384, 1536, 1896, 2312, 2363, 2057, 1924, 2196, 2527, 2676, 2833, 3096, 3345, 3661, 4188, 4716, 5022, 5279, 5546, 5479, 5028, 4648, 4529, 4407, 4228, 4131, 3991, 3830, 4125, 4929, 5479, 5415, 5370, 5751, 6034, 5794, 5389, 5179, 4973, 4542, 4022, 3621, 3381, 3287, 3309, 3343, 3276, 3066, 2797, 2639, 2671, 2716, 2554, 2249, 1995, 1743, 1398, 1175, 1244, 1278, 897, 330, 28, -129, -585, -1213, -1431, -1249, -1408, -2175, -2767, -2539, -2012, -2033, -2534, -2905, -3011, -3092, -3190, -3271, -3539, -4083, -4554, -4612, -4426, -4434, -4733, -5044, -5189, -5309, -5590, -5960, -6256, -6458, -6598, -6591, -6392, -6218, -6258, -6283, -5927, -5310, -4920, -4930, -5074, -5177, -5295, -5457, -5625, -5857, -6191, -6470, -6542, -6459, -6308, -6052, -5679, -5313, -5048, -4815, -4437, -3839, -3241, -3030, -3248, -3459, -3407, -3376, -3549, -3666, -3695, -4004, -4449, -4360, -3799, -3592, -3860, -3791, -3135, -2620, -2623, -2622, -2240, -1852, -1829, -1939, -1872, -1779, -1862, -1879, -1580, -1328, -1638, -2241, -2306, -1722, -1368, -1784, -2324, -2290, -2027, -2085, -2149, -1826, -1570, -1780, -1906, -1426, -823, -693, -786, -651, -459, -522, -657, -583, -499, -754, -1222, -1485, -1511, -1622, -1879, -2015, -1992, -2043, -2160, -2043, -1631, -1245, -1116, -1106, -945, -603, -333, -354, -547, -647, -683, -897, -1255, -1479, -1576, -1807, -2121, -2191, -1965, -1708, -1564, -1532, -1648, -1800, -1722, -1424, -1227, -1234, -1275, -1323, -1440, -1473, -1296, -1100, -1053, -988, -813, -801, -1079, -1214, -867, -546, -921, -1571, -1501, -855, -723, -1174, -1122, -359, 54, -280, -480, -32, 459, 510, 459, 606, 684, 555, 651, 1287, 2031, 2262, 2020, 1802, 1792, 1783, 1742, 1828, 1877, 1486, 791, 562, 1171, 2095, 2754, 3200, 3580, 3749, 3864, 4430, 5304, 5572, 4850, 3836, 3239, 3002, 2868, 2911, 3061, 2855, 2261, 2124, 2994, 4132, 4623, 4758, 5174, 5463, 5031, 4481, 4709, 5357, 5410, 4744, 4035, 3735, 3830, 4151, 4476, 4604, 4481, 4184, 3951, 4141, 4739, 5142, 4961, 4651, 4713, 4855, 4730, 4752, 5253, 5559, 4929, 3854, 3430, 3811, 4155, 3960, 3625, 3605, 3710, 3602, 3485, 3770, 4261, 4294, 3693, 3029, 2779, 2776, 2741, 2746, 2794, 2581, 2078, 1829, 2222, 2912, 3301, 3188, 2737, 2164, 1726, 1653, 1818, 1734, 1193, 640, 521, 638, 669, 847, 1423, 1961, 1958, 1655, 1526, 1548, 1550, 1579, 1503, 979, 121, -455, -472, -246, -78, 46, 167, 205, 188, 329, 807, 1481, 1919, 1863, 1590, 1508, 1527, 1386, 1353, 1781, 2154, 1636, 519, 24, 579, 1332, 1422, 901, 368, 314, 823, 1564, 2127, 2431, 2606, 2723, 2912, 3314, 3651, 3470, 2965, 2676, 2447, 1776, 1022, 918, 1217, 1177, 940, 1126, 1563, 1713, 1767, 2243, 2965, 3276, 2929, 2310, 1958, 2031, 2130, 1803, 1232, 997, 1199, 1385, 1333, 1237, 1247, 1367, 1565, 1535, 864, -166, -644, -343, -172, -782, -1501, -1325, -391, 323, 411, 347, 506, 667, 603, 408, 106, -411, -941, -1125, -1128, -1521, -2276, -2607, -2190, -1802, -2140, -2741, -2943, -3038, -3389, -3408, -2710, -2203, -2554, -2704, -1492, 176, 491, -530, -1165, -684, -318, -1212, -2836, -4087, -4713, -4923, -4776, -4567, -4636, -4509, -3472, -2012, -1280, -1299, -1094, -409, 32, -138, -507, -753, -1064, -1527, -1843, -1926, -2193, -2841, -3333, -3119, -2531, -2331, -2588, -2643, -2148, -1421, -711, 81, 724, 735, 380, 475, 905, 725, -117, -657, -665, -923, -1611, -1931, -1418, -518, 161, 389, 306, 347, 845, 1545, 1856, 1597, 1089, 678, 534, 727, 1152, 1570, 1839, 1924, 1790, 1569, 1657, 2174, 2543, 2068, 872, -201, -566, -426, -298, -348, -347, -122, 189, 451, 858, 1601, 2373, 2626, 2300, 1823, 1505, 1397, 1502, 1603, 1209, 253, -546, -579, -202, -169, -566, -891, -934, -928, -898, -550, 88, 577, 778, 977, 1148, 926, 460, 369, 600, 290, -948, -2376, -3078, -2958, -2598, -2446, -2355, -1901, -1083, -366, 88, 619, 1228, 1409, 1111, 813, 437, -528, -1683, -2018, -1665, -1787, -2608, -3097, -2675, -1924, -1406, -935, -231, 515, 1040, 1519, 2313, 3342, 3991, 3720, 2557, 884, -955, -2612, -3737, -4507, -5745, -7817, -9785, -10324, -9063, -6555, -3594, -1084, 311, 1004, 2126, 3930, 5358, 5405, 4050, 1788, -882, -3391, -5223, -6295, -6921, -7394, -7729, -7693, -7000, -5585, -3746, -1996, -745, -67, 286, 675, 1337, 2187, 2759, 2592, 1863, 1241, 977, 755, 506, 421, 116, -935, -2098, -2123, -1054, -146, 124, 535, 1555, 2617, 3216, 3651, 4297, 4908, 5093, 4921, 4569, 4046, 3704, 4157, 5127, 5467, 4866, 4293, 4337, 4466, 4268, 3979, 3517, 2413, 1103, 913, 2117, 3280, 3460, 3741, 5208, 6831, 7302, 7406, 8244, 8732, 7446, 5323, 4014, 3217, 1851, 265, -616, -967, -1362, -1538, -1012, -138, 376, 594, 1147, 2064, 2596, 2346, 1875, 1842, 2109, 2025, 1214, -105, -1350, -2173, -2836, -3776, -4901, -5796, -6391, -6825, -6908, -6406, -5544, -4734, -4116, -3736, -3632, -3549, -3224, -3023, -3593, -4852, -6016, -6580, -6693, -6694, -6796, -7061, -7315, -7295, -7018, -6780, -6829, -7267, -7999, -8576, -8660, -8629, -8959, -9153, -8437, -7230, -6510, -6184, -5532, -4668, -4142, -3885, -3740, -4055, -4823, -5405, -5653, -6085, -6720, -6994, -6871, -6818, -6916, -6870, -6597, -6122, -5340, -4350, -3507, -2909, -2254, -1318, -219, 716, 1104, 784, 83, -530, -1056, -1788, -2672, -3392, -3896, -4261, -4294, -3768, -2798, -1642, -441, 608, 1260, 1589, 1949, 2425, 2675, 2420, 1786, 1119, 669, 501, 536, 588, 476, 202, -26, -40, 98, 213, 241, 242, 265, 322, 482, 836, 1365, 1928, 2383, 2622, 2554, 2236, 1978, 2009, 2088, 1766, 1034, 360, 55, -22, -52, 44, 254, 213, -247, -639, -431, 98, 283, 62, -84, 33, 252, 539, 917, 1165, 1100, 893, 749, 538, 84, -457, -845, -1172, -1654, -2114, -2207, -2018, -1873, -1692, -1268, -877, -807, -668, -71, 541, 609, 346, 172, 5, -246, -270, -9, 37, -437, -1082, -1359, -1094, -571, -281, -329, -248, 167, 474, 614, 1273, 2328, 2428, 1284, 575, 1323, 2254, 2062, 1396, 1358, 1735, 1862, 1884, 2280, 2992, 3573, 3742, 3610, 3493, 3468, 3284, 2978, 3011, 3410, 3472, 2926, 2543, 2959, 3827, 4623, 5302, 5777, 5816, 5649, 5750, 6075, 6313, 6379, 6080, 5127, 3988, 3622, 4035, 4306, 4144, 4113, 4335, 4306, 4043, 4218, 5025, 5809, 6000, 5752, 5442, 5072, 4521, 4095, 4259, 4791, 4754, 3685, 2382, 1992, 2632, 3464, 3879, 3891, 3639, 3248, 3077, 3386, 3837, 3807, 3106, 2085, 1258, 929, 967, 951, 715, 536, 640, 907, 1288, 1910, 2566, 2696, 2184, 1615, 1456, 1459, 1118, 357, -465, -1012, -1255, -1336, -1303, -1097, -820, -686, -621, -318, 150, 295, 14, -213, -137, -36, -97, -189, -318, -582, -742, -551, -326, -525, -995, -1202, -1009, -747, -692, -813, -928, -886, -649, -305, -8, 80, -98, -350, -338, -51, 117, 23, 27, 289, 444, 385, 578, 1141, 1503, 1345, 1000, 696, 323, 10, 24, 98, -268, -892, -1046, -482, 327, 940, 1418, 1974, 2506, 2726, 2633, 2560, 2623, 2446, 1733, 801, 130, -276, -586, -640, -380, -228, -381, -275, 491, 1366, 1626, 1372, 1154, 1140, 1126, 984, 748, 509, 366, 330, 266, 70, -190, -335, -225, 91, 272, -51, -793, -1365, -1293, -755, -323, -344, -694, -991, -905, -388, 215, 403, 20, -494, -575, -211, 59, -115, -465, -572, -504, -630, -945, -1001, -621, -280, -494, -1085, -1411, -1206, -785, -477, -212, 156, 406, 195, -213, -34, 888, 1537, 988, -265, -1042, -1066, -928, -909, -837, -816, -1074, -1186, -467, 763, 1316, 869, 488, 864, 1171, 551, -383, -617, -350, -422, -852, -1043, -917, -844, -750, -256, 385, 436, -163, -648, -605, -376, -242, -198, -477, -1222, -1788, -1446, -563, -94, -215, -376, -397, -519, -512, 162, 1168, 1367, 524, -277, -381, -414, -802, -938, -603, -688, -1580, -2154, -1386, 24, 699, 499, 352, 583, 592, 49, -713, -1575, -2802, -4290, -5539, -6433, -7143, -7370, -6595, -5168, -4123, -3659, -2766, -886, 990, 1700, 1437, 983, 362, -714, -1969, -3111, -4414, -5962, -7136, -7483, -7323, -7071, -6612, -5666, -4332, -2993, -1895, -882, 289, 1402, 1899, 1727, 1458, 1339, 967, 211, -439, -841, -1522, -2585, -3207, -2812, -1949, -1409, -1096, -374, 871, 2137, 3082, 3876, 4654, 5143, 5068, 4631, 4262, 4045, 3778, 3443, 3165, 2842, 2377, 2165, 2683, 3678, 4413, 4571, 4340, 3944, 3707, 4077, 4947, 5460, 5080, 4361, 4177, 4696, 5437, 5936, 6034, 5835, 5553, 5299, 4961, 4388, 3600, 2783, 2132, 1638, 1031, 227, -243, 160, 1011, 1356, 1150, 1248, 1932, 2584, 2813, 2803, 2597, 2025, 1247, 539, -206, -1153, -2112, -2888, -3591, -4304, -4851, -5095, -5112, -4935, -4478, -3829, -3327, -3121, -2910, -2439, -2011, -2096, -2634, -3182, -3594, -4128, -4897, -5686, -6283, -6681, -6948, -7111, -7212, -7273, -7206, -6896, -6415, -6051, -5948, -5875, -5507, -4914, -4510, -4457, -4454, -4270, -4093, -4147, -4324, -4469, -4679, -5026, -5345, -5502, -5595, -5693, -5647, -5326, -4836, -4354, -3891, -3406, -2971, -2640, -2274, -1820, -1514, -1528, -1632, -1577, -1468, -1440, -1376, -1250, -1287, -1509, -1599, -1428, -1272, -1366, -1607, -1779, -1794, -1610, -1201, -680, -273, -61, 133, 493, 955, 1308, 1458, 1427, 1218, 837, 382, -25, -392, -777, -1116, -1323, -1526, -1857, -2044, -1704, -1064, -756, -855, -827, -435, 23, 363, 634, 696, 353, -174, -481, -569, -777, -1219, -1696, -2070, -2416, -2764, -2994, -3039, -2984, -2865, -2627, -2327, -2099, -1857, -1432, -935, -648, -604, -644, -756, -1011, -1332, -1615, -1919, -2323, -2736, -2990, -3018, -2896, -2774, -2718, -2586, -2215, -1737, -1456, -1421, -1392, -1216, -989, -818, -723, -686, -635, -455, -193, -64, -161, -301, -278, -104, 42, 20, -157, -300, -175, 236, 692, 969, 1161, 1545, 2211, 2868, 3118, 2941, 2807, 3053, 3359, 3273, 2999, 3055, 3391, 3594, 3713, 4065, 4503, 4647, 4629, 4825, 5109, 5029, 4624, 4404, 4555, 4695, 4578, 4544, 5003, 5797, 6416, 6665, 6775, 6963, 7201, 7375, 7338, 6858, 5926, 5081, 4910, 5183, 5114, 4572, 4279, 4654, 5273, 5685, 5984, 6317, 6481, 6315, 6037, 5936, 5990, 5913, 5533, 5021, 4661, 4417, 4099, 3888, 4065, 4195, 3557, 2482, 2160, 2877, 3617, 3601, 3112, 2686, 2530, 2786, 3412, 3834, 3472, 2553, 1833, 1658, 1702, 1525, 1041, 463, -20, -359, -433, -54, 532, 620, 29, -415, -100, 333, 81, -483, -608, -537, -906, -1425, -1323, -637, -152, -331, -861, -1150, -978, -689, -754, -1223, -1792, -2268, -2569, -2478, -1896, -1291, -1275, -1705, -1764, -1098, -379, -383, -982, -1498, -1724, -1951, -2197, -2132, -1789, -1661, -1885, -1922, -1378, -649, -308, -302, -312, -481, -1044, -1609, -1641, -1356, -1370, -1726, -1942, -1723, -1157, -510, -108, -137, -384, -480, -350, -199, -212, -458, -843, -1084, -1014, -841, -741, -519, -99, 91, -216, -577, -507, -262, -367, -763, -983, -929, -878, -881, -662, -175, 165, 22, -344, -433, -212, -166, -588, -1217, -1664, -1801, -1623, -1176, -778, -753, -835, -480, 194, 504, 230, -225, -632, -1093, -1517, -1682, -1685, -1786, -1886, -1671, -1158, -707, -489, -268, 131, 391, 33, -819, -1411, -1257, -799, -844, -1451, -1762, -1139, -89, 421, 316, 309, 603, 596, 44, -468, -492, -355, -490, -735, -714, -396, 57, 636, 1239, 1503, 1314, 1159, 1370, 1469, 957, 268, 137, 451, 577, 418, 394, 656, 980, 1257, 1538, 1714, 1534, 1010, 511, 336, 428, 574, 651, 630, 600, 826, 1463, 2229, 2586, 2329, 1769, 1384, 1358, 1387, 976, 76, -667, -630, -36, 317, 187, 227, 964, 1878, 2079, 1554, 1099, 1114, 1175, 854, 283, -200, -493, -646, -638, -412, 21, 589, 1135, 1391, 1191, 762, 533, 560, 489, 173, -136, -326, -530, -686, -543, -107, 434, 986, 1301, 967, 109, -477, -363, -52, -209, -888, -1656, -2006, -1672, -951, -551, -723, -784, -63, 913, 1010, 274, 57, 932, 1681, 1199, 222, 81, 728, 1138, 842, 145, -571, -1005, -916, -467, -234, -508, -882, -777, -145, 592, 1097, 1281, 1051, 331, -622, -1368, -1824, -2388, -3332, -4372, -5037, -5171, -4838, -4009, -2756, -1525, -737, -248, 404, 1308, 2021, 2013, 1072, -524, -2091, -3015, -3278, -3399, -3803, -4345, -4492, -3901, -2738, -1482, -513, 159, 833, 1609, 2034, 1753, 1407, 1913, 2818, 2752, 1643, 911, 1222, 1665, 1448, 938, 712, 818, 1168, 1743, 2340, 2756, 3163, 3843, 4706, 5398, 5786, 6005, 6071, 5756, 4998, 4251, 4063, 4333, 4376, 3885, 3423, 3657, 4455, 5178, 5550, 5765, 5942, 5955, 5718, 5335, 5030, 4906, 4706, 4144, 3570, 3665, 4275, 4517, 4225, 4109, 4318, 4187, 3588, 3157, 2975, 2364, 1207, 298, 113, 186, -20, -327, -327, -125, -81, -147, -40, 133, -50, -685, -1432, -1992, -2379, -2817, -3499, -4351, -5017, -5263, -5312, -5527, -5885, -6061, -5976, -5919, -6034, -6066, -5819, -5568, -5671, -5996, -6149, -6124, -6296, -6783, -7251, -7510, -7827, -8378, -8829, -8850, -8677, -8676, -8717, -8492, -8068, -7709, -7461, -7285, -7189, -7083, -6848, -6599, -6520, -6554, -6551, -6528, -6505, -6402, -6251, -6184, -6173, -6077, -5946, -5878, -5731, -5309, -4748, -4351, -4128, -3806, -3253, -2654, -2249, -2050, -1896, -1715, -1616, -1630, -1566, -1325, -1185, -1354, -1525, -1313, -887, -656, -584, -362, 16, 340, 603, 907, 1194, 1363, 1493, 1683, 1868, 1961, 2026, 2129, 2153, 1992, 1818, 1849, 1960, 1874, 1639, 1544, 1636, 1704, 1683, 1691, 1743, 1745, 1694, 1685, 1733, 1754, 1693, 1565, 1391, 1213, 1117, 1131, 1131, 977, 728, 563, 490, 338, 56, -157, -198, -284, -590, -876, -874, -814, -1021, -1267, -1183, -971, -1016, -1153, -1046, -877, -981, -1205, -1246, -1235, -1463, -1847, -2099, -2187, -2315, -2538, -2678, -2620, -2491, -2446, -2389, -2139, -1790, -1636, -1692, -1653, -1410, -1253, -1372, -1563, -1601, -1563, -1578, -1618, -1624, -1607, -1534, -1389, -1259, -1178, -1005, -659, -300, -115, -18, 203, 547, 798, 856, 881, 1022, 1228, 1374, 1447, 1490, 1518, 1558, 1680, 1902, 2194, 2509, 2783, 2957, 3084, 3320, 3686, 3958, 3948, 3813, 3868, 4089, 4139, 3938, 3854, 4133, 4485, 4551, 4486, 4726, 5303, 5754, 5727, 5450, 5428, 5732, 5868, 5489, 4938, 4708, 4691, 4470, 4092, 3958, 4127, 4320, 4390, 4416, 4485, 4694, 5031, 5222, 5035, 4695, 4553, 4482, 4114, 3515, 3077, 2861, 2532, 1998, 1609, 1623, 1790, 1746, 1541, 1481, 1614, 1706, 1692, 1736, 1797, 1536, 894, 347, 277, 402, 202, -361, -937, -1260, -1280, -1086, -947, -1131, -1502, -1613, -1368, -1249, -1569, -1881, -1652, -1208, -1224, -1581, -1675, -1539, -1628, -1798, -1652, -1480, -1765, -2218, -2236, -1865, -1548, -1379, -1217, -1094, -1040, -891, -598, -435, -597, -843, -843, -706, -756, -895, -667, -22, 474, 454, 330, 639, 1189, 1413, 1282, 1162, 1025, 662, 391, 658, 1141, 1184, 894, 984, 1647, 2331, 2606, 2620, 2670, 2761, 2759, 2667, 2571, 2485, 2399, 2322, 2215, 2110, 2237, 2658, 2976, 2864, 2640, 2783, 3151, 3262, 3106, 3047, 3143, 3095, 2857, 2769, 2979, 3170, 3008, 2618, 2326, 2214, 2136, 2038, 1972, 1900, 1756, 1619, 1642, 1806, 1936, 1950, 1904, 1797, 1580, 1320, 1109, 869, 545, 318, 285, 201, -92, -294, -114, 186, 165, -125, -290, -269, -386, -753, -1069, -1153, -1254, -1589, -1925, -1917, -1626, -1389, -1379, -1490, -1535, -1475, -1489, -1737, -2082, -2241, -2238, -2400, -2821, -3145, -3065, -2753, -2587, -2632, -2666, -2589, -2510, -2480, -2422, -2341, -2334, -2367, -2301, -2172, -2181, -2344, -2429, -2341, -2306, -2484, -2659, -2582, -2409, -2420, -2507, -2333, -1897, -1512, -1329, -1210, -1044, -893, -835, -862, -940, -1078, -1283, -1504, -1619, -1530, -1264, -997, -876, -795, -486, 38, 406, 421, 333, 366, 334, 63, -212, -224, -122, -159, -215, -29, 311, 506, 585, 864, 1339, 1573, 1362, 1074, 1063, 1140, 939, 529, 312, 438, 632, 620, 509, 585, 856, 1056, 1098, 1194, 1376, 1332, 964, 715, 917, 1182, 932, 312, 23, 287, 561, 384, 27, -12, 198, 170, -151, -249, 117, 463, 334, 45, 85, 296, 257, 48, -51, -124, -310, -449, -462, -521, -615, -577, -490, -473, -362, -136, -146, -411, -424, -116, -134, -721, -1166, -933, -542, -673, -994, -765, -175, -39, -340, -277, 246, 383, -179, -661, -519, -312, -665, -1175, -1110, -625, -443, -654, -702, -412, -164, -113, -61, -46, -301, -717, -926, -832, -674, -695, -909, -1044, -777, -198, 221, 248, 146, 170, 259, 349, 495, 514, 34, -805, -1181, -654, 23, -111, -767, -839, -163, 339, 224, 66, 293, 556, 527, 386, 261, -95, -696, -1099, -1201, -1622, -2708, -3732, -3860, -3369, -3066, -2972, -2491, -1544, -636, 62, 871, 1832, 2477, 2521, 2165, 1550, 552, -607, -1330, -1514, -1749, -2306, -2696, -2518, -1978, -1262, -155, 1334, 2539, 2862, 2613, 2654, 3272, 3869, 3816, 3207, 2612, 2377, 2392, 2384, 2213, 1968, 1891, 2143, 2573, 2852, 2925, 3121, 3650, 4235, 4499, 4567, 4877, 5448, 5753, 5464, 4946, 4701, 4697, 4619, 4385, 4078, 3745, 3561, 3749, 4129, 4249, 4069, 3953, 3962, 3763, 3373, 3266, 3460, 3225, 2328, 1769, 2300, 3019, 2795, 2185, 2343, 2852, 2479, 1376, 712, 632, 204, -925, -2066, -2574, -2585, -2628, -2910, -3135, -2991, -2611, -2304, -2075, -1858, -1927, -2464, -3072, -3339, -3584, -4329, -5350, -6005, -6261, -6659, -7298, -7642, -7478, -7318, -7531, -7690, -7327, -6752, -6551, -6665, -6621, -6348, -6204, -6381, -6737, -7094, -7401, -7668, -7941, -8271, -8600, -8728, -8545, -8185, -7843, -7521, -7150, -6817, -6617, -6426, -6072, -5717, -5678, -5862, -5783, -5358, -5129, -5308, -5289, -4700, -4142, -4143, -4291, -4099, -3856, -3839, -3694, -3214, -2830, -2787, -2689, -2208, -1584, -1152, -897, -616, -248, 85, 259, 316, 434, 660, 830, 827, 743, 704, 783, 1060, 1472, 1663, 1434, 1181, 1406, 1990, 2466, 2733, 2959, 3099, 3055, 3039, 3287, 3612, 3636, 3305, 2946, 2853, 2929, 2809, 2407, 2155, 2377, 2708, 2639, 2364, 2418, 2740, 2835, 2631, 2489, 2542, 2608, 2567, 2419, 2185, 1958, 1840, 1748, 1558, 1356, 1269, 1183, 932, 634, 544, 662, 717, 550, 320, 293, 430, 386, -21, -461, -487, -170, -41, -332, -658, -589, -290, -224, -427, -530, -441, -491, -808, -1106, -1212, -1314, -1530, -1658, -1562, -1411, -1360, -1293, -1093, -903, -905, -998, -967, -813, -667, -534, -416, -470, -738, -876, -562, -44, 93, -253, -561, -462, -223, -202, -298, -253, -47, 274, 731, 1131, 1248, 1312, 1711, 2254, 2408, 2174, 2060, 2255, 2445, 2417, 2318, 2311, 2377, 2533, 2875, 3302, 3489, 3342, 3227, 3476, 3900, 4067, 3923, 3814, 3966, 4281, 4619, 4944, 5164, 5168, 5138, 5346, 5624, 5540, 5126, 4832, 4760, 4569, 4172, 3919, 4038, 4378, 4659, 4717, 4604, 4617, 4994, 5552, 5866, 5760, 5404, 5027, 4778, 4739, 4819, 4740, 4320, 3674, 3097, 2799, 2808, 2953, 2971, 2722, 2350, 2151, 2273, 2601, 2880, 2941, 2823, 2661, 2473, 2230, 2064, 2087, 2040, 1530, 677, 18, -228, -323, -481, -686, -950, -1261, -1365, -1047, -564, -391, -592, -764, -662, -497, -541, -764, -1033, -1352, -1705, -1977, -2201, -2560, -2977, -3094, -2846, -2662, -2855, -3134, -3041, -2627, -2322, -2278, -2241, -2064, -1916, -1939, -2025, -2052, -2066, -2133, -2245, -2438, -2788, -3179, -3314, -3114, -2876, -2813, -2757, -2534, -2247, -1915, -1352, -691, -452, -756, -1051, -945, -752, -894, -1270, -1532, -1627, -1748, -1898, -1815, -1364, -819, -565, -576, -487, -167, 146, 322, 476, 555, 316, -126, -251, 106, 457, 380, 110, 73, 202, 198, 156, 355, 619, 532, 232, 256, 621, 780, 574, 483, 756, 947, 685, 336, 421, 783, 856, 597, 508, 777, 996, 900, 801, 957, 1009, 596, 88, 54, 297, 162, -364, -627, -321, 134, 339, 426, 663, 989, 1190, 1228, 1129, 850, 478, 245, 116, -252, -886, -1276, -1085, -701, -637, -707, -382, 256, 635, 692, 859, 1065, 879, 571, 740, 1011, 554, -295, -482, -73, -78, -661, -958, -601, -213, -290, -487, -210, 498, 1012, 991, 832, 1040, 1452, 1572, 1372, 1165, 909, 371, -182, -225, 125, 179, -257, -568, -310, 127, 286, 432, 946, 1455, 1377, 955, 897, 1300, 1636, 1564, 1148, 588, 195, 251, 547, 490, -74, -521, -265, 401, 660, 223, -310, -264, 198, 360, 66, -143, -79, -155, -376, -234, 137, 44, -330, -162, 370, 339, -184, -351, -145, -181, -446, -597, -813, -1250, -1473, -1257, -1141, -1542, -2007, -1886, -1260, -800, -874, -1093, -793, 91, 841, 746, -79, -865, -1065, -907, -1099, -2102, -3651, -5000, -5734, -6090, -6290, -6037, -5100, -3989, -3313, -2862, -1973, -477, 1185, 2406, 2654, 1748, 182, -1197, -1986, -2450, -3096, -4221, -5603, -6472, -6127, -4753, -3295, -2373, -1685, -652, 726, 1989, 2859, 3305, 3235, 2775, 2523, 2703, 2532, 1406, 135, -160, 226, 233, -164, -109, 572, 1217, 1640, 2406, 3663, 4712, 5137, 5458, 6111, 6597, 6373, 5841, 5674, 5725, 5383, 4583, 3847, 3564, 3651, 3843, 4035, 4313, 4728, 5146, 5442, 5679, 5935, 6084, 6020, 5894, 5874, 5855, 5671, 5408, 5284, 5369, 5515, 5437, 4924, 4162, 3619, 3388, 3021, 2258, 1466, 1003, 747, 551, 613, 1012, 1391, 1438, 1328, 1444, 1834, 2090, 1760, 913, 85, -494, -1193, -2155, -2906, -3284, -3911, -5026, -5796, -5590, -5054, -5051, -5365, -5265, -4739, -4343, -4270, -4238, -4141, -4241, -4667, -5177, -5581, -6093, -6938, -7877, -8484, -8751, -9025, -9355, -9412, -9080, -8641, -8277, -7843, -7299, -6874, -6706, -6709, -6797, -6938, -7058, -7198, -7541, -8093, -8554, -8706, -8651, -8540, -8335, -8043, -7874, -7919, -7891, -7448, -6727, -6193, -6010, -5891, -5617, -5328, -5187, -5085, -4899, -4760, -4871, -5135, -5242, -5080, -4838, -4690, -4568, -4344, -4029, -3719, -3408, -3027, -2599, -2238, -2007, -1825, -1585, -1325, -1162, -1079, -927, -671, -482, -493, -586, -573, -466, -399, -327, -52, 397, 706, 719, 732, 1107, 1731, 2148, 2187, 2131, 2229, 2352, 2301, 2187, 2230, 2350, 2272, 2002, 1876, 2104, 2460, 2578, 2421, 2322, 2539, 2915, 3098, 3011, 2931, 3089, 3338, 3373, 3163, 2983, 2980, 2949, 2674, 2292, 2120, 2177, 2171, 1968, 1835, 2013, 2324, 2452, 2417, 2453, 2578, 2592, 2438, 2268, 2184, 2096, 1839, 1390, 987, 939, 1206, 1358, 1107, 710, 597, 801, 976, 897, 707, 653, 751, 789, 668, 576, 704, 893, 843, 604, 498, 589, 602, 382, 99, -47, -52, 25, 139, 245, 330, 395, 429, 487, 662, 864, 838, 599, 525, 790, 1069, 1054, 902, 928, 1156, 1409, 1593, 1657, 1505, 1186, 1002, 1174, 1481, 1526, 1328, 1308, 1675, 2147, 2384, 2422, 2530, 2807, 3080, 3119, 2876, 2556, 2418, 2507, 2578, 2407, 2145, 2184, 2617, 3078, 3236, 3197, 3259, 3482, 3709, 3833, 3870, 3867, 3804, 3646, 3484, 3523, 3762, 3856, 3572, 3218, 3210, 3425, 3454, 3280, 3192, 3234, 3219, 3187, 3363, 3689, 3802, 3561, 3298, 3353, 3589, 3586, 3209, 2766, 2595, 2701, 2818, 2724, 2448, 2207, 2182, 2326, 2408, 2282, 2049, 1856, 1675, 1456, 1330, 1378, 1372, 1095, 802, 909, 1326, 1525, 1299, 1000, 933, 912, 692, 429, 319, 165, -266, -746, -919, -866, -881, -963, -945, -873, -902, -956, -837, -597, -546, -819, -1155, -1216, -1014, -874, -1036, -1388, -1619, -1599, -1557, -1771, -2141, -2291, -2129, -1992, -2122, -2304, -2204, -1857, -1563, -1461, -1441, -1383, -1297, -1217, -1152, -1183, -1404, -1717, -1863, -1770, -1687, -1823, -2001, -1885, -1479, -1161, -1184, -1357, -1343, -1088, -834, -760, -819, -878, -852, -685, -394, -149, -149, -347, -457, -330, -173, -263, -556, -750, -690, -522, -424, -344, -137, 187, 450, 515, 446, 454, 645, 843, 802, 559, 370, 328, 318, 316, 408, 507, 393, 121, 48, 328, 650, 628, 318, 125, 267, 551, 690, 649, 591, 625, 723, 809, 806, 672, 449, 274, 234, 247, 160, -36, -167, -103, 33, 42, -83, -200, -247, -237, -172, -146, -291, -460, -333, -25, -43, -436, -648, -418, -190, -355, -714, -925, -997, -1063, -1058, -918, -824, -957, -1151, -1101, -817, -594, -563, -569, -477, -331, -245, -291, -460, -636, -725, -796, -930, -1041, -1032, -1005, -1059, -1073, -904, -628, -412, -322, -348, -412, -353, -98, 169, 183, -79, -392, -523, -420, -203, -75, -193, -504, -726, -640, -367, -175, -82, 18, -17, -316, -526, -244, 273, 459, 283, 84, -60, -205, -150, 227, 585, 540, 201, -46, -40, 96, 197, 187, 81, -33, -52, 16, 56, 54, 147, 364, 512, 504, 466, 404, 180, -68, -38, 99, -184, -851, -1163, -785, -328, -386, -582, -232, 438, 604, 186, -39, 299, 682, 603, 165, -323, -738, -1000, -1033, -950, -950, -1027, -994, -806, -609, -451, -225, 28, 136, 162, 282, 302, -36, -446, -500, -430, -679, -1037, -1112, -1108, -1290, -1288, -742, -84, 88, -51, 134, 798, 1444, 1572, 1235, 872, 723, 584, 183, -366, -729, -808, -830, -971, -1065, -830, -254, 358, 703, 723, 578, 496, 575, 620, 269, -558, -1452, -1904, -1834, -1586, -1483, -1503, -1360, -792, 152, 1064, 1445, 1227, 880, 777, 675, 234, -276, -437, -533, -1076, -1723, -1613, -733, 23, 213, 375, 927, 1398, 1362, 1309, 1775, 2258, 2032, 1409, 1192, 1390, 1448, 1245, 1041, 914, 879, 1076, 1422, 1530, 1345, 1403, 2090, 3002, 3444, 3361, 3267, 3376, 3394, 3189, 3054, 3114, 3024, 2477, 1719, 1344, 1670, 2389, 2885, 2914, 2845, 3085, 3541, 3874, 3993, 3969, 3720, 3174, 2603, 2415, 2620, 2750, 2397, 1738, 1377, 1633, 2129, 2245, 1898, 1579, 1608, 1691, 1426, 968, 797, 933, 890, 486, 173, 300, 489, 211, -373, -641, -457, -354, -728, -1320, -1728, -2009, -2401, -2776, -2800, -2551, -2525, -2951, -3459, -3584, -3362, -3203, -3320, -3546, -3717, -3893, -4158, -4371, -4362, -4279, -4513, -5140, -5656, -5622, -5385, -5632, -6297, -6637, -6376, -6062, -6090, -6117, -5786, -5430, -5538, -5905, -5933, -5591, -5472, -5832, -6220, -6203, -5998, -6044, -6318, -6399, -6085, -5656, -5501, -5615, -5623, -5350, -5103, -5191, -5393, -5229, -4659, -4160, -4078, -4196, -4121, -3834, -3627, -3622, -3614, -3455, -3297, -3349, -3526, -3540, -3291, -2977, -2800, -2675, -2368, -1841, -1352, -1164, -1204, -1132, -813, -539, -606, -824, -801, -578, -564, -829, -941, -618, -139, 80, 63, 165, 534, 951, 1181, 1282, 1448, 1667, 1738, 1577, 1367, 1335, 1448, 1452, 1210, 912, 874, 1145, 1423, 1476, 1491, 1763, 2136, 2206, 2046, 2143, 2567, 2795, 2535, 2127, 1993, 2107, 2180, 2035, 1725, 1456, 1381, 1444, 1535, 1716, 2047, 2330, 2346, 2234, 2301, 2541, 2627, 2371, 1946, 1648, 1558, 1493, 1267, 949, 794, 908, 1129, 1268, 1351, 1491, 1641, 1632, 1442, 1271, 1276, 1342, 1227, 909, 641, 593, 609, 486, 310, 321, 499, 594, 514, 438, 498, 587, 606, 645, 767, 816, 681, 565, 682, 865, 810, 577, 506, 670, 789, 710, 641, 749, 876, 893, 975, 1226, 1403, 1355, 1328, 1506, 1704, 1738, 1685, 1611, 1526, 1582, 1878, 2141, 2060, 1845, 1968, 2436, 2777, 2748, 2629, 2652, 2654, 2530, 2520, 2683, 2683, 2446, 2389, 2685, 2989, 3124, 3319, 3611, 3738, 3689, 3736, 3886, 3869, 3700, 3679, 3767, 3533, 2953, 2656, 2946, 3227, 2964, 2569, 2672, 3113, 3363, 3417, 3580, 3784, 3739, 3532, 3524, 3709, 3645, 3092, 2387, 2011, 2040, 2184, 2162, 1934, 1685, 1664, 1889, 2088, 2037, 1891, 1941, 2101, 1985, 1590, 1416, 1630, 1695, 1264, 800, 753, 819, 592, 252, 54, -174, -578, -880, -832, -599, -452, -437, -430, -329, -141, -4, -75, -317, -513, -596, -832, -1438, -2102, -2301, -2064, -1939, -2127, -2255, -2073, -1792, -1612, -1477, -1386, -1478, -1681, -1739, -1623, -1599, -1820, -2081, -2134, -2020, -1942, -1952, -1952, -1968, -2133, -2383, -2437, -2222, -2043, -2125, -2233, -2025, -1604, -1329, -1262, -1166, -970, -888, -1069, -1383, -1566, -1551, -1583, -1874, -2157, -1983, -1457, -1104, -983, -652, -96, 151, -25, -76, 244, 396, -35, -607, -704, -488, -487, -611, -360, 194, 492, 481, 678, 1202, 1523, 1321, 955, 870, 998, 992, 780, 593, 613, 827, 1111, 1298, 1323, 1378, 1636, 1854, 1693, 1339, 1273, 1468, 1462, 1206, 1178, 1553, 1897, 1868, 1721, 1809, 1990, 1925, 1686, 1568, 1524, 1306, 1037, 1099, 1487, 1746, 1643, 1472, 1565, 1820, 1914, 1747, 1460, 1169, 913, 777, 802, 844, 762, 707, 933, 1322, 1465, 1278, 1172, 1384, 1540, 1193, 538, 154, 180, 218, 44, -94, -31, 10, -65, 20, 379, 653, 589, 372, 220, 98, 1, 0, -8, -200, -438, -434, -262, -311, -646, -855, -716, -574, -769, -1068, -1080, -908, -894, -1005, -937, -703, -612, -708, -690, -479, -377, -525, -681, -742, -935, -1294, -1526, -1560, -1634, -1750, -1671, -1450, -1365, -1361, -1142, -755, -544, -593, -644, -622, -756, -1115, -1405, -1446, -1490, -1778, -2067, -2001, -1750, -1769, -2002, -1935, -1545, -1464, -1915, -2254, -2048, -1793, -1995, -2343, -2364, -2184, -2096, -1981, -1648, -1235, -1003, -1019, -1165, -1286, -1322, -1397, -1627, -1899, -2046, -2117, -2220, -2245, -2029, -1686, -1473, -1436, -1391, -1211, -980, -891, -1012, -1161, -1104, -912, -906, -1157, -1335, -1204, -982, -989, -1171, -1235, -1128, -1098, -1276, -1440, -1332, -1029, -842, -892, -960, -795, -452, -246, -361, -628, -755, -729, -829, -1183, -1515, -1505, -1297, -1301, -1511, -1446, -938, -500, -558, -795, -705, -451, -585, -1112, -1440, -1260, -1015, -1240, -1740, -1829, -1357, -1002, -1253, -1637, -1495, -1091, -1178, -1740, -2049, -1833, -1600, -1725, -1918, -1783, -1429, -1267, -1406, -1543, -1425, -1251, -1394, -1834, -2142, -2060, -1853, -1883, -2067, -2025, -1707, -1491, -1584, -1697, -1563, -1414, -1590, -1929, -1975, -1692, -1522, -1706, -1906, -1706, -1227, -950, -1077, -1327, -1331, -1065, -859, -1018, -1423, -1615, -1368, -1009, -949, -1091, -1003, -577, -170, -30, 33, 220, 353, 268, 192, 347, 509, 391, 149, 98, 240, 410, 579, 748, 851, 934, 1132, 1404, 1548, 1555, 1641, 1898, 2120, 2129, 2069, 2204, 2474, 2532, 2269, 2041, 2154, 2389, 2372, 2203, 2275, 2567, 2696, 2627, 2767, 3242, 3624, 3565, 3327, 3383, 3713, 3847, 3547, 3156, 3098, 3255, 3198, 2910, 2816, 3072, 3269, 3106, 2930, 3218, 3746, 3862, 3523, 3381, 3686, 3831, 3369, 2784, 2686, 2848, 2656, 2132, 1850, 2023, 2250, 2180, 2001, 2077, 2374, 2527, 2394, 2238, 2273, 2323, 2142, 1804, 1548, 1393, 1186, 892, 623, 470, 445, 465, 411, 318, 393, 646, 742, 486, 189, 224, 437, 379, 0, -313, -370, -425, -688, -950, -963, -898, -1067, -1388, -1487, -1225, -880, -806, -1020, -1128, -854, -563, -791, -1321, -1426, -1088, -1073, -1615, -1983, -1675, -1172, -1074, -1226, -1148, -849, -725, -874, -969, -822, -689, -825, -1034, -971, -735, -683, -749, -539, -95, 85, -103, -204, -2, 167, 66, -84, -19, 209, 364, 293, 126, 224, 677, 1052, 996, 786, 806, 912, 864, 873, 1142, 1350, 1180, 952, 1153, 1664, 1937, 1786, 1568, 1589, 1678, 1490, 1082, 871, 1047, 1338, 1467, 1527, 1676, 1834, 1950, 2187, 2541, 2616, 2165, 1493, 1049, 898, 807, 576, 235, 43, 224, 626, 900, 1041, 1299, 1603, 1620, 1337, 993, 624, 187, -113, -173, -321, -779, -1170, -1045, -582, -283, -255, -206, -28, -1, -334, -775, -923, -839, -968, -1367, -1532, -1274, -1150, -1525, -1843, -1507, -896, -782, -1239, -1730, -1873, -1696, -1472, -1469, -1629, -1637, -1483, -1496, -1633, -1458, -1057, -1128, -1845, -2483, -2465, -2114, -1982, -2055, -2007, -1824, -1726, -1668, -1376, -874, -590, -835, -1420, -1906, -2035, -1864, -1643, -1566, -1590, -1525, -1294, -971, -587, -110, 320, 382, -78, -771, -1224, -1300, -1319, -1620, -2085, -2210, -1671, -661, 323, 929, 1127, 1175, 1412, 1881, 2151, 1782, 907, 17, -600, -876, -757, -392, -127, 3, 332, 923, 1481, 1917, 2315, 2500, 2315, 2101, 2177, 2227, 1862, 1388, 1341, 1617, 1695, 1470, 1358, 1611, 1947, 1949, 1629, 1384, 1488, 1812, 2065, 2128, 2126, 2249, 2552, 2867, 2941, 2699, 2367, 2221, 2256, 2198, 1886, 1480, 1239, 1201, 1301, 1630, 2166, 2450, 2070, 1447, 1436, 2063, 2374, 1787, 920, 685, 1093, 1494, 1605, 1632, 1653, 1551, 1484, 1712, 1964, 1680, 836, -68, -788, -1429, -1857, -1722, -1233, -1144, -1615, -1758, -897, 419, 1264, 1523, 1552, 1311, 723, 252, 265, 248, -514, -1766, -2546, -2522, -2248, -2108, -1911, -1643, -1592, -1526, -845, 251, 862, 753, 539, 525, 448, 256, 198, 215, -25, -605, -1243, -1604, -1532, -1174, -899, -898, -958, -775, -292, 339, 882, 1090, 996, 961, 1163, 1277, 1046, 734, 605, 445, 53, -277, -242, -64, -96, -230, -84, 384, 784, 785, 556, 564, 907, 1143, 968, 701, 742, 916, 848, 630, 600, 733, 744, 568, 348, 106, -221, -578, -827, -939, -999, -1058, -1094, -1061, -894, -532, -92, 146, 117, 105, 227, 161, -300, -835, -1132, -1411, -1977, -2636, -3029, -3147, -3214, -3261, -3158, -2899, -2635, -2472, -2315, -2029, -1691, -1545, -1655, -1835, -2021, -2388, -2933, -3367, -3634, -4024, -4569, -4899, -4900, -4894, -4994, -4848, -4269, -3582, -3162, -3004, -2897, -2738, -2596, -2580, -2741, -3087, -3620, -4245, -4670, -4701, -4599, -4762, -5064, -4974, -4392, -3823, -3588, -3435, -3090, -2692, -2510, -2555, -2633, -2600, -2503, -2524, -2746, -3023, -3167, -3156, -3032, -2808, -2612, -2667, -2899, -2887, -2416, -1833, -1611, -1747, -1814, -1513, -1023, -782, -973, -1287, -1276, -914, -630, -739, -1004, -971, -592, -283, -330, -529, -529, -297, -58, 43, 38, -4, 14, 242, 670, 1019, 1028, 882, 1021, 1491, 1782, 1493, 902, 615, 786, 1004, 914, 608, 380, 435, 877, 1565, 2036, 2026, 1939, 2267, 2765, 2822, 2414, 2009, 1770, 1480, 1097, 822, 696, 572, 491, 675, 1096, 1442, 1611, 1887, 2409, 2825, 2757, 2366, 2101, 2051, 1899, 1488, 984, 524, 123, -23, 259, 638, 646, 482, 671, 1110, 1326, 1352, 1487, 1580, 1393, 1158, 1137, 1136, 964, 781, 688, 514, 231, 48, 78, 225, 359, 381, 286, 263, 498, 882, 1135, 1183, 1146, 1094, 1049, 1083, 1199, 1249, 1126, 906, 731, 668, 755, 977, 1163, 1098, 805, 595, 701, 970, 1067, 940, 895, 1147, 1510, 1743, 1987, 2484, 3005, 3070, 2704, 2411, 2372, 2232, 1758, 1154, 640, 233, 38, 300, 979, 1621, 1907, 2091, 2617, 3427, 4002, 4035, 3762, 3518, 3279, 2844, 2232, 1650, 1226, 1003, 1044, 1267, 1395, 1338, 1396, 1796, 2288, 2524, 2553, 2640, 2809, 2879, 2825, 2781, 2747, 2584, 2273, 1944, 1600, 1175, 805, 721, 847, 875, 743, 671, 819, 1183, 1710, 2209, 2363, 2060, 1621, 1428, 1483, 1471, 1170, 696, 336, 191, 106, 3, 74, 371, 538, 310, -13, -53, 78, 108, 95, 126, -4, -339, -431, 44, 699, 897, 597, 278, 197, 130, -113, -375, -492, -618, -924, -1206, -1148, -828, -594, -503, -301, 39, 198, 57, -36, 181, 425, 276, -130, -303, -162, -89, -234, -361, -417, -614, -850, -732, -309, -127, -364, -520, -200, 315, 585, 671, 854, 1050, 1004, 813, 698, 547, 221, -46, -72, -159, -541, -798, -439, 241, 539, 392, 416, 891, 1367, 1456, 1303, 1105, 812, 556, 607, 772, 567, 102, -30, 246, 397, 203, 83, 330, 623, 549, 252, 221, 577, 876, 723, 320, 142, 277, 432, 416, 256, -45, -409, -505, -153, 282, 344, 140, 99, 269, 339, 245, 256, 403, 321, -146, -621, -722, -541, -348, -256, -361, -663, -768, -286, 398, 507, 8, -347, -148, 208, 177, -302, -877, -1175, -1162, -1125, -1214, -1251, -1149, -1075, -967, -568, -93, -23, -188, -50, 206, 17, -424, -561, -569, -896, -1293, -1354, -1336, -1562, -1704, -1437, -1101, -1109, -1226, -997, -516, -318, -595, -936, -874, -436, -35, 9, -276, -611, -682, -407, -116, -291, -978, -1648, -1885, -1908, -2045, -2087, -1711, -1190, -987, -955, -592, 148, 844, 1177, 1108, 720, 199, -177, -290, -345, -661, -1314, -2065, -2576, -2713, -2620, -2569, -2714, -2927, -2915, -2532, -1938, -1388, -980, -649, -251, 319, 894, 1012, 401, -607, -1451, -2005, -2569, -3292, -3963, -4330, -4338, -4037, -3464, -2675, -1803, -1018, -372, 219, 726, 866, 500, 0, -205, -303, -771, -1559, -2135, -2263, -2186, -2128, -2069, -1941, -1697, -1260, -657, -110, 201, 429, 831, 1318, 1546, 1451, 1329, 1332, 1293, 1095, 795, 383, -129, -441, -246, 256, 583, 594, 599, 918, 1578, 2335, 2822, 2852, 2609, 2447, 2520, 2724, 2843, 2704, 2388, 2234, 2351, 2416, 2257, 2194, 2337, 2189, 1542, 1076, 1356, 1945, 2132, 1940, 1862, 2127, 2633, 3163, 3470, 3441, 3238, 3066, 2918, 2656, 2194, 1556, 934, 584, 506, 411, 202, 135, 328, 567, 755, 1028, 1327, 1408, 1306, 1259, 1239, 1049, 753, 547, 359, -9, -505, -908, -1157, -1345, -1502, -1588, -1661, -1809, -1932, -1826, -1493, -1181, -1054, -1050, -1091, -1198, -1342, -1428, -1494, -1711, -2135, -2591, -2887, -3025, -3082, -3064, -3009, -3066, -3229, -3278, -3134, -2984, -2902, -2778, -2684, -2793, -2940, -2834, -2632, -2689, -2917, -2983, -2917, -2984, -3205, -3430, -3636, -3831, -3900, -3784, -3621, -3586, -3693, -3759, -3562, -3131, -2812, -2821, -2907, -2781, -2612, -2670, -2801, -2752, -2691, -2907, -3307, -3581, -3615, -3482, -3326, -3332, -3483, -3472, -3149, -2809, -2705, -2631, -2342, -2018, -1942, -2037, -2031, -1876, -1757, -1800, -1928, -1977, -1940, -1997, -2187, -2261, -2092, -1973, -2120, -2265, -2130, -1904, -1781, -1537, -1002, -461, -213, -179, -168, -83, 157, 475, 471, -99, -818, -1042, -801, -733, -1097, -1396, -1168, -685, -443, -341, 75, 786, 1268, 1278, 1169, 1323, 1636, 1736, 1494, 1078, 678, 384, 236, 202, 186, 151, 133, 173, 387, 877, 1388, 1455, 1168, 1245, 1938, 2538, 2410, 1893, 1657, 1729, 1718, 1559, 1457, 1334, 969, 599, 709, 1195, 1420, 1227, 1185, 1632, 2122, 2163, 1925, 1888, 2141, 2354, 2288, 2054, 1920, 2028, 2286, 2415, 2203, 1798, 1627, 1843, 2073, 1914, 1482, 1231, 1367, 1696, 1949, 2069, 2184, 2371, 2543, 2645, 2816, 3131, 3316, 3096, 2669, 2428, 2399, 2368, 2303, 2216, 1962, 1598, 1545, 1998, 2544, 2723, 2594, 2525, 2704, 3038, 3310, 3330, 3116, 2912, 2941, 3165, 3333, 3212, 2804, 2426, 2382, 2533, 2454, 2066, 1731, 1671, 1787, 2011, 2343, 2570, 2560, 2652, 3171, 3767, 3830, 3390, 3004, 2867, 2651, 2218, 1913, 1951, 1998, 1675, 1210, 1147, 1555, 1963, 2051, 1982, 1968, 1959, 1990, 2293, 2769, 2847, 2311, 1764, 1804, 2202, 2333, 2020, 1546, 1169, 943, 810, 677, 518, 478, 683, 978, 1031, 818, 725, 1019, 1417, 1465, 1136, 778, 621, 629, 682, 640, 390, 14, -204, -150, -68, -232, -521, -592, -404, -298, -494, -768, -769, -475, -141, 39, 54, -39, -150, -131, 62, 187, -113, -821, -1455, -1618, -1523, -1681, -2144, -2423, -2199, -1762, -1520, -1395, -1048, -510, -216, -383, -696, -781, -672, -640, -801, -1106, -1503, -1894, -2087, -2000, -1793, -1741, -1970, -2314, -2385, -1951, -1292, -948, -1069, -1261, -1129, -712, -323, -172, -278, -542, -799, -924, -1011, -1299, -1790, -2132, -2086, -1907, -1972, -2151, -1949, -1286, -723, -714, -988, -1036, -859, -761, -768, -773, -895, -1127, -1115, -798, -664, -925, -1137, -1027, -930, -1116, -1392, -1563, -1671, -1700, -1546, -1276, -1048, -875, -661, -356, 6, 283, 304, 155, 135, 290, 294, -53, -536, -902, -1151, -1339, -1400, -1335, -1270, -1245, -1125, -824, -449, -119, 154, 318, 242, 14, -3, 306, 535, 273, -348, -917, -1240, -1314, -1114, -750, -579, -786, -999, -725, -53, 477, 662, 714, 637, 265, -120, -32, 379, 476, 80, -418, -716, -741, -436, 71, 395, 329, 72, -103, -93, 97, 331, 355, 118, -79, 9, 226, 293, 269, 423, 720, 853, 759, 703, 769, 738, 562, 479, 499, 301, -137, -344, -72, 245, 174, 31, 354, 929, 1114, 951, 1092, 1657, 2102, 2147, 1992, 1719, 1235, 717, 446, 342, 124, -255, -614, -763, -604, -198, 253, 628, 1017, 1474, 1803, 1800, 1621, 1600, 1706, 1537, 956, 325, -64, -351, -616, -603, -237, 81, 60, -61, 95, 573, 1131, 1465, 1410, 1125, 945, 955, 930, 762, 616, 586, 499, 208, -141, -274, -84, 255, 443, 311, -1, -172, -19, 285, 416, 282, 67, -64, -162, -317, -467, -482, -333, -65, 279, 589, 630, 361, 173, 384, 632, 378, -168, -396, -366, -617, -1067, -1130, -795, -653, -863, -926, -563, -124, 52, 121, 306, 426, 247, -43, -126, -67, -189, -612, -1207, -1729, -1897, -1641, -1359, -1535, -2037, -2180, -1617, -835, -533, -799, -1190, -1383, -1383, -1247, -1056, -1065, -1462, -2056, -2480, -2522, -2149, -1545, -1171, -1331, -1669, -1569, -983, -377, -78, -124, -519, -1138, -1555, -1404, -838, -397, -430, -769, -927, -566, 177, 796, 882, 572, 374, 520, 698, 611, 443, 472, 567, 482, 426, 775, 1333, 1498, 1248, 1300, 1947, 2514, 2442, 2173, 2261, 2383, 2049, 1632, 1769, 2249, 2337, 1906, 1567, 1756, 2216, 2472, 2464, 2484, 2638, 2717, 2655, 2725, 3086, 3398, 3237, 2752, 2524, 2756, 2964, 2656, 2021, 1643, 1701, 1819, 1728, 1658, 1864, 2115, 2042, 1796, 1838, 2139, 2174, 1775, 1433, 1509, 1687, 1500, 1017, 696, 727, 810, 602, 190, -35, 13, -21, -373, -747, -808, -686, -672, -778, -905, -1075, -1235, -1250, -1210, -1324, -1556, -1737, -1909, -2142, -2319, -2436, -2725, -3167, -3380, -3219, -3007, -3038, -3258, -3451, -3437, -3197, -3022, -3219, -3589, -3651, -3421, -3375, -3641, -3849, -3781, -3623, -3615, -3832, -4177, -4390, -4305, -4130, -4111, -4102, -3906, -3749, -3839, -3889, -3637, -3368, -3402, -3572, -3612, -3550, -3484, -3421, -3394, -3363, -3189, -2970, -3000, -3198, -3141, -2836, -2799, -3186, -3517, -3437, -3134, -2876, -2620, -2324, -2188, -2302, -2363, -2089, -1685, -1560, -1748, -1953, -2034, -2053, -1988, -1797, -1665, -1802, -2015, -1894, -1463, -1248, -1517, -1857, -1765, -1366, -1146, -1158, -1009, -592, -306, -383, -479, -269, -28, -171, -600, -916, -1016, -1072, -1149, -1166, -1063, -824, -515, -277, -147, 24, 309, 544, 578, 450, 251, 49, -46, 2, 41, -49, -102, 103, 446, 587, 454, 308, 305, 283, 127, 20, 88, 137, 14, -49, 209, 663, 996, 1099, 1086, 1072, 1090, 1075, 886, 466, 9, -171, -23, 177, 224, 250, 408, 598, 738, 965, 1253, 1284, 987, 736, 735, 757, 673, 656, 728, 703, 592, 611, 777, 890, 904, 929, 926, 737, 435, 334, 576, 886, 937, 796, 815, 1118, 1457, 1594, 1559, 1416, 1111, 778, 764, 1058, 1160, 831, 501, 581, 912, 1181, 1362, 1512, 1580, 1611, 1745, 1909, 1874, 1685, 1678, 1937, 2106, 1959, 1809, 1955, 2150, 2076, 1920, 1981, 2133, 2175, 2208, 2302, 2288, 2151, 2136, 2291, 2401, 2397, 2427, 2523, 2549, 2468, 2405, 2442, 2552, 2693, 2818, 2801, 2556, 2273, 2261, 2496, 2581, 2308, 1974, 1961, 2226, 2432, 2409, 2258, 2122, 2051, 2068, 2200, 2349, 2340, 2131, 1896, 1815, 1881, 1958, 1964, 1874, 1642, 1295, 1012, 952, 994, 888, 620, 418, 425, 587, 810, 1004, 1093, 1089, 1025, 836, 538, 349, 295, 45, -469, -775, -588, -298, -258, -241, 1, 226, 201, 172, 380, 515, 169, -468, -877, -1001, -1168, -1368, -1282, -966, -776, -670, -307, 221, 459, 333, 209, 255, 245, 12, -308, -556, -753, -901, -889, -729, -590, -480, -247, 20, 30, -195, -296, -156, -54, -111, -70, 219, 488, 499, 434, 551, 704, 625, 426, 378, 391, 205, -56, -43, 236, 424, 398, 435, 710, 1018, 1110, 1022, 885, 675, 363, 109, 41, 29, -61, -54, 297, 848, 1197, 1277, 1419, 1758, 1945, 1667, 1128, 744, 592, 460, 274, 148, 97, 23, -10, 193, 602, 902, 903, 698, 428, 190, 104, 172, 146, -127, -342, -96, 477, 841, 828, 824, 1057, 1182, 883, 412, 129, -94, -561, -1138, -1456, -1446, -1286, -1009, -546, -26, 357, 711, 1226, 1662, 1597, 1130, 749, 509, 46, -576, -866, -769, -791, -1091, -1160, -638, 110, 581, 805, 1068, 1305, 1289, 1169, 1245, 1372, 1154, 667, 411, 498, 478, 133, -118, 7, 105, -205, -522, -255, 434, 934, 1045, 1031, 1088, 1214, 1381, 1540, 1578, 1409, 1022, 475, -73, -381, -340, -148, -121, -305, -408, -201, 195, 498, 606, 597, 513, 354, 215, 193, 179, -24, -356, -491, -295, -22, 49, -14, -8, 53, 11, -131, -243, -344, -599, -972, -1187, -1108, -907, -769, -686, -612, -526, -354, -111, -43, -324, -761, -1088, -1344, -1686, -2066, -2356, -2574, -2777, -2899, -2855, -2655, -2407, -2226, -2174, -2208, -2241, -2260, -2325, -2451, -2596, -2748, -2936, -3107, -3124, -2969, -2843, -2908, -3019, -2921, -2670, -2567, -2719, -2910, -2930, -2805, -2695, -2694, -2735, -2642, -2374, -2133, -2077, -2052, -1865, -1643, -1629, -1767, -1787, -1618, -1447, -1408, -1432, -1410, -1320, -1175, -1010, -923, -999, -1128, -1051, -696, -348, -299, -448, -409, -45, 363, 521, 435, 286, 234, 384, 651, 693, 350, 16, 145, 532, 616, 371, 321, 690, 1101, 1247, 1307, 1474, 1564, 1438, 1404, 1685, 1899, 1601, 1037, 788, 916, 1004, 909, 919, 1167, 1406, 1473, 1550, 1763, 1923, 1876, 1780, 1780, 1733, 1523, 1352, 1387, 1408, 1161, 871, 966, 1383, 1642, 1561, 1403, 1302, 1108, 843, 780, 905, 827, 429, 169, 413, 875, 1066, 1005, 1014, 1069, 916, 610, 390, 203, -126, -521, -793, -930, -939, -756, -436, -122, 188, 523, 707, 575, 283, 89, -40, -331, -821, -1291, -1526, -1520, -1446, -1426, -1370, -1169, -927, -784, -636, -380, -237, -402, -624, -612, -551, -718, -983, -1119, -1234, -1480, -1697, -1711, -1632, -1612, -1559, -1347, -1082, -918, -788, -550, -306, -267, -391, -478, -540, -716, -991, -1307, -1743, -2234, -2449, -2226, -1851, -1641, -1569, -1435, -1137, -745, -488, -589, -942, -1172, -1175, -1315, -1839, -2397, -2470, -2100, -1840, -1984, -2210, -2102, -1718, -1437, -1456, -1655, -1828, -1857, -1773, -1690, -1642, -1570, -1479, -1484, -1594, -1600, -1366, -1077, -1042, -1299, -1577, -1630, -1456, -1179, -942, -914, -1131, -1336, -1227, -884, -674, -755, -979, -1218, -1445, -1531, -1330, -1013, -969, -1224, -1296, -865, -294, -140, -404, -647, -705, -824, -1098, -1264, -1192, -1155, -1340, -1483, -1313, -982, -696, -353, 80, 297, 154, -29, -10, -20, -319, -774, -1089, -1157, -1059, -935, -843, -679, -350, 10, 214, 311, 422, 450, 267, 19, -70, -52, -119, -290, -414, -352, -66, 302, 534, 638, 822, 1057, 1067, 890, 876, 1028, 969, 651, 406, 319, 203, 155, 470, 1058, 1470, 1501, 1390, 1487, 1888, 2346, 2527, 2422, 2303, 2247, 2115, 2023, 2262, 2642, 2567, 1949, 1391, 1349, 1654, 1930, 1995, 1867, 1731, 1831, 2187, 2576, 2855, 3040, 3084, 2940, 2766, 2710, 2659, 2452, 2187, 2024, 1932, 1810, 1675, 1618, 1722, 2024, 2418, 2680, 2715, 2670, 2678, 2643, 2416, 2063, 1781, 1617, 1460, 1306, 1270, 1361, 1467, 1616, 1912, 2236, 2364, 2325, 2273, 2128, 1793, 1489, 1418, 1387, 1156, 922, 1019, 1350, 1541, 1489, 1440, 1537, 1640, 1598, 1471, 1345, 1162, 866, 576, 428, 374, 325, 380, 640, 875, 772, 477, 446, 717, 866, 711, 514, 447, 381, 242, 107, -12, -136, -151, -3, 115, 12, -199, -270, -173, -39, 142, 433, 626, 456, 145, 214, 667, 881, 508, -47, -251, -108, 42, 74, 103, 174, 232, 336, 662, 1210, 1707, 1887, 1724, 1361, 935, 616, 575, 677, 461, -228, -839, -754, -102, 543, 929, 1119, 1090, 884, 813, 1047, 1221, 911, 261, -217, -311, -228, -169, -135, -163, -355, -572, -481, -84, 148, -117, -608, -848, -792, -738, -779, -733, -585, -578, -753, -754, -373, 11, -107, -631, -985, -945, -830, -886, -968, -950, -956, -1027, -998, -818, -681, -733, -931, -1182, -1403, -1479, -1351, -1141, -1036, -1027, -910, -575, -205, -90, -267, -493, -611, -754, -1076, -1456, -1642, -1576, -1347, -1044, -779, -654, -563, -322, -43, -8, -182, -271, -233, -307, -524, -629, -544, -494, -552, -472, -235, -241, -598, -747, -328, 146, 121, -108, 0, 342, 536, 643, 855, 919, 512, -120, -441, -395, -399, -603, -689, -484, -253, -168, 31, 552, 1079, 1154, 801, 408, 172, -8, -184, -299, -437, -713, -894, -582, 166, 780, 847, 525, 264, 269, 355, 193, -294, -832, -1119, -1117, -937, -662, -420, -362, -413, -321, -57, 98, -25, -286, -488, -601, -635, -537, -329, -167, -168, -268, -335, -347, -370, -437, -550, -758, -1069, -1302, -1187, -665, -18, 342, 243, -82, -221, -14, 234, 76, -567, -1283, -1578, -1366, -963, -672, -491, -252, 92, 406, 561, 544, 397, 135, -222, -573, -774, -754, -567, -328, -127, 14, 167, 436, 805, 1058, 984, 637, 277, 86, 61, 97, 60, -146, -396, -345, 168, 820, 1118, 1014, 949, 1231, 1616, 1670, 1352, 1023, 930, 927, 774, 496, 306, 318, 506, 757, 856, 681, 525, 840, 1504, 1856, 1606, 1206, 1121, 1257, 1303, 1148, 811, 350, 28, 194, 773, 1175, 1056, 832, 1045, 1542, 1798, 1708, 1484, 1168, 769, 511, 465, 391, 232, 257, 513, 690, 677, 768, 1156, 1606, 1754, 1503, 1074, 765, 702, 760, 726, 496, 141, -106, 0, 475, 984, 1216, 1246, 1302, 1330, 1170, 949, 836, 662, 197, -440, -993, -1408, -1697, -1739, -1488, -1087, -665, -193, 384, 1071, 1806, 2396, 2548, 2151, 1456, 827, 308, -384, -1406, -2457, -3033, -2945, -2453, -1928, -1482, -961, -207, 717, 1532, 1934, 1863, 1567, 1295, 991, 438, -361, -1143, -1719, -2079, -2216, -2098, -1842, -1633, -1435, -1026, -425, 13, 110, 158, 415, 617, 406, -66, -434, -693, -1044, -1434, -1706, -1939, -2209, -2293, -1980, -1532, -1397, -1556, -1558, -1228, -903, -885, -1091, -1338, -1558, -1643, -1487, -1272, -1303, -1493, -1434, -1052, -775, -842, -939, -856, -990, -1641, -2330, -2493, -2375, -2515, -2825, -2900, -2748, -2537, -2065, -1134, -136, 360, 395, 489, 810, 977, 748, 355, 7, -430, -1014, -1447, -1498, -1321, -1165, -1032, -760, -259, 397, 1033, 1540, 1962, 2311, 2450, 2367, 2314, 2436, 2506, 2283, 1836, 1358, 948, 738, 844, 1094, 1132, 932, 869, 1215, 1797, 2290, 2619, 2907, 3173, 3308, 3256, 3072, 2824, 2555, 2317, 2080, 1723, 1256, 960, 1085, 1439, 1555, 1311, 1120, 1353, 1833, 2101, 1977, 1647, 1376, 1318, 1434, 1512, 1382, 1156, 1088, 1172, 1108, 790, 536, 547, 482, 24, -487, -576, -452, -621, -998, -1142, -1032, -939, -846, -615, -492, -780, -1161, -1035, -523, -405, -934, -1458, -1524, -1558, -2001, -2572, -2869, -3032, -3333, -3657, -3759, -3622, -3377, -3122, -2940, -2857, -2749, -2450, -2014, -1755, -1930, -2447, -2953, -3197, -3246, -3374, -3805, -4458, -4955, -5017, -4783, -4554, -4390, -4194, -3956, -3647, -3168, -2646, -2390, -2412, -2443, -2436, -2542, -2724, -2897, -3211, -3694, -4010, -4005, -3975, -4070, -4032, -3776, -3576, -3484, -3209, -2675, -2180, -1950, -1915, -1867, -1656, -1320, -1134, -1341, -1814, -2215, -2378, -2357, -2255, -2207, -2299, -2407, -2385, -2330, -2300, -2015, -1338, -769, -820, -1162, -1063, -455, 14, -88, -534, -869, -938, -849, -727, -681, -791, -966, -994, -828, -598, -349, -66, 81, -56, -228, -46, 425, 748, 709, 522, 476, 641, 883, 992, 839, 506, 233, 186, 300, 435, 564, 743, 925, 1015, 1068, 1259, 1585, 1792, 1732, 1605, 1635, 1663, 1436, 1141, 1169, 1442, 1531, 1334, 1149, 1147, 1257, 1422, 1563, 1494, 1211, 1015, 1113, 1309, 1339, 1249, 1237, 1279, 1213, 1079, 1062, 1124, 1046, 805, 553, 319, 85, 51, 381, 808, 901, 606, 248, 138, 376, 789, 970, 641, 42, -310, -199, 138, 339, 229, -56, -196, -83, 48, 82, 268, 662, 830, 578, 393, 664, 1096, 1254, 1129, 866, 543, 315, 250, 126, -166, -317, -121, 162, 304, 436, 679, 946, 1228, 1573, 1819, 1776, 1541, 1280, 988, 672, 463, 332, 114, -135, -147, 148, 561, 927, 1210, 1383, 1447, 1482, 1551, 1622, 1673, 1736, 1798, 1721, 1401, 956, 647, 604, 720, 792, 696, 450, 238, 334, 849, 1544, 2041, 2206, 2249, 2411, 2676, 2825, 2690, 2298, 1788, 1275, 851, 626, 660, 853, 998, 1005, 1024, 1260, 1712, 2129, 2244, 2041, 1769, 1692, 1821, 1944, 1894, 1715, 1587, 1623, 1782, 1909, 1860, 1614, 1266, 919, 604, 333, 157, 125, 232, 424, 653, 911, 1184, 1397, 1409, 1163, 798, 538, 444, 394, 266, 83, -14, 133, 515, 858, 881, 668, 544, 556, 391, -137, -788, -1212, -1317, -1227, -1035, -744, -392, -40, 311, 683, 1010, 1188, 1148, 827, 237, -341, -545, -399, -340, -605, -941, -1050, -985, -945, -947, -923, -919, -992, -1023, -853, -521, -178, 178, 650, 1130, 1287, 1033, 730, 658, 518, -136, -1132, -1864, -2088, -1990, -1687, -1240, -905, -775, -490, 178, 838, 1045, 922, 798, 652, 297, -192, -556, -691, -679, -611, -529, -496, -525, -480, -213, 160, 327, 180, -12, 49, 339, 609, 717, 692, 592, 517, 606, 791, 743, 339, -63, -109, 60, 128, 131, 334, 738, 1081, 1242, 1376, 1615, 1883, 2051, 2081, 1959, 1653, 1255, 978, 908, 898, 777, 536, 259, 21, -71, 96, 492, 875, 989, 870, 852, 1168, 1597, 1748, 1639, 1641, 1831, 1831, 1423, 890, 571, 446, 278, -114, -725, -1272, -1391, -1098, -798, -681, -518, -130, 349, 828, 1406, 2041, 2400, 2254, 1770, 1302, 980, 637, 75, -682, -1417, -1919, -2128, -2102, -1930, -1647, -1216, -607, 67, 593, 935, 1318, 1842, 2238, 2215, 1841, 1344, 767, 86, -573, -1089, -1528, -1971, -2305, -2368, -2156, -1769, -1247, -567, 215, 905, 1316, 1472, 1566, 1695, 1721, 1459, 894, 169, -532, -1041, -1299, -1441, -1615, -1708, -1471, -896, -269, 162, 397, 616, 1001, 1449, 1542, 1117, 638, 530, 478, 29, -540, -686, -489, -379, -429, -475, -452, -298, 19, 219, 44, -217, -97, 371, 817, 1086, 1214, 1216, 1196, 1337, 1563, 1544, 1138, 514, -171, -895, -1489, -1621, -1201, -625, -374, -414, -238, 453, 1318, 1799, 1788, 1580, 1339, 966, 476, 72, -161, -334, -479, -502, -431, -413, -405, -207, 74, -13, -532, -809, -355, 322, 468, 181, 110, 465, 948, 1253, 1156, 620, 46, -107, -32, -276, -829, -1127, -914, -505, -255, -192, -203, -243, -331, -487, -672, -811, -883, -921, -940, -929, -883, -728, -349, 121, 265, -111, -641, -910, -1024, -1324, -1805, -2186, -2373, -2476, -2524, -2427, -2204, -1947, -1612, -1129, -695, -600, -748, -796, -781, -1073, -1688, -2206, -2431, -2617, -2933, -3167, -3070, -2705, -2358, -2245, -2314, -2269, -1815, -1037, -449, -483, -929, -1161, -938, -656, -691, -912, -1024, -1042, -1140, -1257, -1146, -757, -353, -195, -231, -163, 156, 546, 745, 724, 675, 741, 880, 966, 958, 952, 1087, 1346, 1527, 1492, 1366, 1381, 1546, 1668, 1619, 1470, 1348, 1290, 1267, 1267, 1295, 1352, 1489, 1737, 1989, 2092, 2141, 2323, 2530, 2488, 2247, 2016, 1718, 1268, 984, 1036, 979, 497, 51, 129, 460, 579, 610, 928, 1509, 2042, 2362, 2468, 2372, 2166, 2027, 1920, 1506, 655, -189, -552, -609, -841, -1204, -1244, -897, -583, -486, -306, 133, 525, 563, 405, 329, 267, 37, -259, -470, -732, -1210, -1725, -1984, -2016, -2049, -2110, -2061, -1962, -1958, -1885, -1520, -1149, -1259, -1706, -1924, -1877, -1988, -2293, -2476, -2505, -2545, -2532, -2415, -2404, -2555, -2553, -2242, -1938, -1947, -2151, -2281, -2333, -2497, -2821, -3092, -3111, -2956, -2865, -2858, -2728, -2423, -2177, -2130, -2135, -2057, -1962, -1904, -1813, -1714, -1728, -1844, -1927, -1941, -1926, -1840, -1690, -1656, -1861, -2099, -2079, -1837, -1661, -1627, -1480, -1085, -732, -763, -1022, -1019, -660, -444, -733, -1234, -1500, -1512, -1445, -1297, -1154, -1290, -1647, -1746, -1386, -908, -632, -587, -745, -1009, -1102, -935, -801, -913, -1104, -1217, -1290, -1294, -1190, -1122, -1134, -1013, -798, -861, -1162, -1189, -830, -519, -420, -344, -335, -494, -501, -125, 182, -68, -619, -916, -925, -962, -1091, -1121, -1004, -898, -896, -880, -663, -190, 389, 766, 699, 322, 109, 304, 568, 444, -6, -342, -396, -415, -595, -781, -718, -452, -329, -542, -827, -786, -438, -167, -151, -189, -74, 178, 471, 677, 637, 384, 205, 229, 205, -62, -376, -466, -396, -404, -510, -524, -331, -14, 275, 500, 728, 955, 1062, 1044, 1106, 1372, 1617, 1524, 1119, 751, 692, 879, 1008, 850, 527, 427, 731, 1132, 1238, 1118, 1182, 1535, 1789, 1682, 1529, 1726, 2096, 2124, 1727, 1297, 1154, 1299, 1506, 1454, 990, 464, 406, 809, 1136, 1108, 1005, 1086, 1195, 1162, 1170, 1399, 1591, 1394, 965, 769, 900, 1060, 1066, 948, 727, 503, 530, 847, 1094, 984, 716, 636, 740, 789, 769, 881, 1141, 1292, 1213, 1108, 1175, 1286, 1209, 956, 723, 584, 450, 279, 162, 188, 317, 454, 523, 504, 461, 517, 679, 789, 716, 522, 319, 137, -4, -46, 9, 74, 72, -15, -137, -129, 134, 479, 542, 265, 62, 282, 701, 804, 481, 155, 183, 447, 634, 683, 768, 1009, 1331, 1513, 1398, 1179, 1252, 1626, 1792, 1440, 975, 945, 1266, 1381, 1076, 737, 791, 1202, 1607, 1764, 1712, 1644, 1729, 1957, 2109, 2009, 1755, 1558, 1417, 1191, 934, 866, 1001, 1071, 911, 707, 706, 880, 1039, 1104, 1061, 877, 681, 759, 1159, 1497, 1439, 1164, 1062, 1141, 1078, 787, 549, 539, 583, 536, 550, 764, 1060, 1266, 1377, 1426, 1365, 1174, 901, 604, 352, 244, 291, 357, 333, 346, 615, 1124, 1555, 1646, 1484, 1329, 1245, 1090, 808, 536, 379, 224, -58, -374, -459, -189, 257, 545, 458, 103, -135, 102, 731, 1200, 1026, 394, -13, 160, 515, 422, -198, -851, -1110, -1064, -1110, -1403, -1633, -1408, -790, -228, 54, 301, 790, 1404, 1760, 1586, 971, 325, -31, -281, -849, -1664, -2135, -1952, -1446, -1015, -621, -44, 742, 1591, 2342, 2835, 2978, 2793, 2389, 1839, 1188, 501, -155, -756, -1264, -1536, -1395, -841, -132, 453, 906, 1424, 2051, 2578, 2840, 2923, 2955, 2824, 2330, 1527, 728, 169, -184, -502, -875, -1242, -1413, -1164, -440, 495, 1281, 1846, 2405, 3022, 3418, 3333, 2915, 2486, 2070, 1416, 477, -429, -1018, -1272, -1262, -1020, -639, -216, 304, 971, 1597, 1956, 2072, 2085, 1958, 1573, 1003, 486, 159, -58, -339, -699, -933, -843, -526, -277, -257, -404, -632, -891, -1079, -1131, -1175, -1396, -1737, -1904, -1720, -1349, -1099, -1086, -1121, -957, -584, -225, -76, -128, -287, -560, -991, -1479, -1784, -1833, -1858, -2139, -2583, -2747, -2338, -1600, -993, -652, -360, 11, 374, 647, 807, 749, 401, -152, -796, -1413, -1748, -1633, -1376, -1455, -1779, -1789, -1267, -562, -29, 302, 486, 502, 436, 471, 624, 649, 387, 0, -280, -441, -576, -653, -625, -575, -597, -657, -651, -467, -61, 346, 376, 20, -222, 10, 406, 417, 22, -307, -295, -99, 94, 304, 447, 294, -75, -190, 133, 418, 146, -528, -1013, -1019, -776, -637, -706, -842, -833, -537, -2, 498, 672, 534, 393, 427, 415, 57, -545, -1016, -1240, -1473, -1865, -2184, -2138, -1770, -1394, -1233, -1210, -1059, -641, -167, -45, -425, -936, -1089, -923, -936, -1336, -1772, -1992, -2214, -2591, -2827, -2670, -2313, -2056, -1941, -1850, -1624, -1127, -461, -53, -179, -583, -825, -871, -1054, -1538, -2091, -2418, -2519, -2559, -2511, -2181, -1601, -1109, -904, -742, -335, 141, 252, -89, -508, -720, -887, -1256, -1716, -1959, -1926, -1812, -1728, -1609, -1399, -1100, -723, -369, -220, -283, -340, -288, -317, -596, -979, -1182, -1153, -1138, -1382, -1797, -2014, -1852, -1587, -1538, -1619, -1590, -1469, -1342, -1126, -864, -837, -1074, -1249, -1237, -1245, -1329, -1398, -1584, -1978, -2284, -2258, -2137, -2134, -2027, -1664, -1362, -1395, -1580, -1612, -1464, -1308, -1315, -1536, -1799, -1831, -1591, -1352, -1331, -1413, -1351, -1136, -1009, -1134, -1391, -1539, -1511, -1448, -1511, -1704, -1854, -1750, -1341, -789, -312, -31, 33, -1, 78, 299, 329, -90, -712, -1119, -1325, -1627, -1993, -2101, -1875, -1602, -1475, -1336, -959, -394, 67, 237, 210, 189, 242, 331, 461, 600, 561, 222, -223, -466, -478, -505, -700, -976, -1183, -1203, -915, -311, 331, 642, 634, 744, 1227, 1780, 1962, 1774, 1529, 1382, 1248, 1028, 753, 562, 561, 656, 604, 381, 346, 780, 1365, 1459, 958, 509, 657, 1143, 1381, 1303, 1328, 1655, 2084, 2387, 2536, 2579, 2539, 2407, 2111, 1583, 911, 325, -14, -143, -194, -206, -63, 342, 932, 1493, 1938, 2321, 2600, 2638, 2512, 2493, 2607, 2552, 2156, 1607, 1120, 741, 458, 255, 34, -245, -418, -295, 82, 534, 984, 1445, 1855, 2116, 2261, 2466, 2783, 2968, 2670, 1859, 926, 299, 42, -52, -143, -251, -326, -233, 168, 802, 1387, 1742, 1838, 1644, 1245, 965, 990, 1031, 740, 232, -151, -316, -326, -164, 119, 308, 246, 42, -105, -108, -14, 71, 62, -20, -68, -20, 93, 224, 383, 595, 843, 1035, 1065, 960, 907, 984, 988, 717, 298, -36, -297, -561, -724, -706, -631, -571, -391, -53, 291, 597, 991, 1465, 1813, 1931, 1896, 1764, 1497, 1094, 629, 177, -212, -462, -513, -418, -310, -217, -11, 390, 872, 1237, 1431, 1538, 1614, 1642, 1626, 1566, 1371, 950, 440, 130, 116, 216, 261, 244, 215, 203, 304, 617, 1062, 1420, 1583, 1632, 1649, 1575, 1371, 1161, 1051, 949, 717, 398, 156, 105, 291, 629, 847, 746, 506, 447, 577, 656, 567, 384, 209, 138, 167, 98, -150, -297, -87, 247, 365, 347, 418, 511, 483, 448, 498, 461, 216, -65, -175, -128, -54, -23, -58, -169, -337, -484, -505, -343, -88, 83, 130, 178, 297, 432, 556, 689, 715, 509, 218, 141, 331, 595, 762, 730, 489, 287, 414, 682, 566, -15, -569, -733, -637, -515, -393, -231, -42, 187, 491, 843, 1153, 1337, 1323, 1100, 776, 541, 493, 522, 408, 33, -524, -1047, -1314, -1253, -1036, -967, -1104, -1121, -665, 150, 817, 1024, 1003, 1142, 1457, 1648, 1545, 1224, 754, 116, -624, -1235, -1495, -1403, -1201, -1142, -1160, -902, -205, 619, 1149, 1349, 1481, 1655, 1702, 1494, 1167, 924, 767, 543, 210, -62, -111, -3, 35, -111, -295, -263, 8, 265, 318, 287, 401, 664, 879, 923, 856, 776, 679, 487, 161, -194, -425, -484, -454, -361, -157, 121, 290, 238, 82, -8, -45, -189, -501, -842, -1030, -991, -771, -462, -164, 76, 298, 504, 568, 364, -19, -338, -469, -536, -721, -1004, -1170, -1061, -812, -718, -851, -971, -856, -564, -289, -126, -79, -122, -155, -46, 192, 380, 341, 89, -189, -312, -320, -448, -792, -1101, -1116, -955, -887, -886, -710, -317, 89, 337, 405, 393, 415, 435, 251, -202, -657, -845, -844, -864, -907, -849, -685, -524, -427, -394, -399, -398, -363, -347, -430, -576, -643, -593, -557, -608, -593, -403, -211, -219, -337, -320, -86, 257, 534, 540, 213, -166, -211, 80, 280, 74, -361, -603, -480, -204, -57, -68, -52, 128, 407, 630, 730, 734, 663, 496, 252, 29, -97, -178, -327, -544, -679, -627, -497, -465, -530, -560, -544, -571, -601, -513, -347, -274, -345, -464, -555, -608, -595, -512, -448, -477, -533, -502, -396, -354, -458, -620, -706, -702, -712, -821, -988, -1075, -1014, -927, -946, -924, -587, -38, 265, 151, -29, 28, 199, 223, 37, -254, -486, -532, -491, -607, -867, -934, -629, -221, -30, -3, 135, 456, 753, 851, 812, 794, 800, 681, 390, 109, 32, 97, 46, -234, -560, -673, -567, -470, -513, -557, -403, -84, 191, 346, 499, 706, 800, 624, 301, 118, 125, 81, -172, -483, -639, -660, -681, -724, -748, -755, -714, -543, -288, -126, -138, -239, -329, -366, -330, -257, -275, -441, -619, -628, -484, -379, -423, -531, -573, -522, -417, -273, -125, -75, -183, -360, -460, -470, -511, -668, -878, -1032, -1073, -1013, -896, -786, -695, -533, -211, 189, 458, 480, 336, 184, 99, 29, -125, -394, -680, -818, -754, -620, -583, -629, -607, -473, -334, -226, -40, 253, 477, 461, 275, 139, 171, 272, 273, 107, -162, -422, -604, -745, -909, -1052, -1061, -980, -959, -937, -688, -247, 65, 121, 95, 108, 127, 158, 220, 218, 133, 145, 322, 445, 342, 145, 25, -62, -215, -365, -396, -364, -446, -674, -876, -886, -758, -672, -672, -629, -438, -156, 96, 266, 355, 357, 276, 178, 121, 64, -89, -362, -659, -902, -1077, -1182, -1218, -1249, -1346, -1449, -1399, -1162, -878, -662, -445, -128, 201, 332, 184, -110, -404, -670, -944, -1197, -1347, -1333, -1158, -870, -526, -169, 145, 342, 410, 429, 461, 449, 336, 155, -50, -259, -382, -308, -120, -38, -86, -29, 278, 630, 741, 639, 583, 656, 671, 503, 294, 251, 400, 599, 699, 647, 511, 412, 389, 361, 276, 208, 244, 300, 197, -78, -319, -381, -391, -542, -791, -905, -759, -466, -204, -1, 275, 725, 1244, 1617, 1736, 1646, 1376, 901, 258, -406, -971, -1418, -1756, -1927, -1837, -1455, -845, -143, 495, 952, 1239, 1436, 1532, 1423, 1120, 786, 485, 149, -164, -270, -164, -52, -7, 75, 211, 279, 236, 124, -56, -298, -488, -514, -399, -241, -105, 8, 151, 346, 491, 461, 294, 161, 124, 76, -31, -110, -98, -63, -78, -117, -119, -122, -212, -386, -541, -562, -402, -110, 189, 391, 545, 798, 1163, 1450, 1488, 1310, 1044, 716, 282, -232, -717, -1083, -1286, -1296, -1098, -747, -316, 205, 853, 1537, 2046, 2244, 2176, 1926, 1490, 850, 114, -522, -949, -1193, -1276, -1139, -758, -268, 140, 433, 707, 992, 1163, 1115, 900, 639, 381, 94, -231, -534, -748, -852, -888, -893, -850, -732, -575, -456, -376, -246, -8, 234, 325, 265, 219, 278, 332, 241, 42, -104, -132, -129, -162, -168, -42, 184, 373, 459, 515, 605, 658, 579, 387, 168, -70, -365, -656, -765, -575, -168, 247, 551, 805, 1117, 1433, 1552, 1369, 971, 500, 25, -408, -769, -1025, -1097, -874, -409, 50, 351, 599, 932, 1291, 1533, 1585, 1452, 1190, 909, 671, 390, -12, -431, -656, -625, -479, -349, -206, 49, 434, 859, 1229, 1500, 1643, 1635, 1487, 1257, 993, 702, 383, 55, -253, -508, -648, -606, -386, -108, 104, 263, 477, 772, 1032, 1178, 1229, 1182, 959, 593, 267, 80, -60, -231, -366, -365, -199, 117, 508, 796, 818, 640, 511, 585, 740, 759, 615, 458, 406, 425, 430, 415, 439, 534, 634, 625, 476, 298, 205, 165, 75, -34, -10, 214, 513, 736, 896, 1107, 1341, 1406, 1214, 970, 930, 1028, 961, 655, 358, 278, 341, 376, 318, 189, 63, 33, 83, 107, 113, 206, 351, 371, 279, 307, 533, 734, 710, 563, 512, 571, 547, 331, 29, -190, -286, -318, -301, -210, -73, 24, 67, 131, 253, 333, 265, 93, -2, 85, 264, 352, 302, 263, 386, 625, 766, 669, 419, 203, 69, -62, -190, -212, -149, -152, -233, -211, -11, 200, 265, 221, 169, 137, 118, 121, 142, 142, 73, -60, -143, -43, 190, 316, 181, -66, -199, -211, -274, -454, -637, -735, -778, -764, -589, -253, 70, 248, 359, 491, 611, 675, 714, 730, 722, 775, 914, 960, 755, 426, 218, 142, 27, -191, -377, -397, -280, -177, -166, -166, -68, 72, 140, 171, 314, 568, 776, 839, 806, 726, 597, 430, 241, 33, -148, -248, -294, -360, -439, -481, -524, -649, -828, -963, -1016, -1003, -938, -824, -650, -394, -111, 34, -61, -292, -475, -587, -776, -1096, -1395, -1488, -1370, -1203, -1110, -1065, -993, -910, -881, -901, -912, -893, -861, -827, -822, -903, -1035, -1088, -1034, -1022, -1121, -1158, -952, -622, -443, -457, -454, -332, -267, -409, -629, -700, -589, -438, -352, -348, -388, -422, -434, -488, -604, -689, -657, -573, -566, -648, -723, -738, -748, -821, -929, -963, -866, -704, -574, -470, -292, 7, 340, 575, 687, 721, 659, 432, 82, -223, -399, -510, -594, -584, -413, -109, 255, 611, 855, 905, 810, 713, 634, 437, 96, -178, -246, -246, -321, -343, -177, 41, 135, 156, 208, 215, 76, -178, -473, -779, -1031, -1143, -1114, -1034, -971, -907, -780, -564, -340, -243, -301, -401, -441, -470, -577, -718, -767, -700, -639, -691, -807, -872, -870, -898, -1001, -1077, -985, -715, -409, -199, -76, 61, 254, 401, 352, 97, -203, -399, -530, -721, -958, -1087, -1020, -805, -514, -187, 145, 464, 760, 987, 1063, 992, 842, 614, 230, -281, -737, -965, -976, -893, -769, -533, -143, 276, 530, 572, 546, 563, 566, 469, 301, 137, -25, -210, -385, -507, -577, -610, -603, -557, -492, -408, -292, -164, -66, -1, 74, 192, 315, 382, 389, 361, 300, 190, 48, -81, -180, -291, -438, -571, -612, -543, -419, -305, -225, -180, -173, -215, -310, -457, -662, -910, -1136, -1225, -1090, -764, -385, -98, 71, 190, 289, 285, 80, -297, -707, -1024, -1201, -1266, -1274, -1216, -1020, -689, -388, -257, -217, -96, 108, 263, 304, 285, 242, 157, 40, -53, -118, -193, -264, -254, -153, -49, 13, 109, 309, 561, 772, 920, 1045, 1146, 1184, 1138, 1008, 811, 581, 360, 179, 28, -97, -145, -34, 234, 550, 785, 914, 998, 1079, 1151, 1179, 1101, 853, 460, 89, -107, -156, -183, -243, -273, -199, -15, 197, 310, 253, 99, 6, 60, 208, 351, 449, 509, 525, 472, 363, 233, 96, -61, -243, -433, -597, -678, -629, -482, -287, -23, 353, 789, 1145, 1346, 1440, 1483, 1455, 1298, 1010, 689, 460, 357, 295, 202, 117, 124, 225, 333, 370, 325, 245, 189, 172, 186, 245, 387, 572, 674, 642, 588, 641, 766, 815, 721, 573, 475, 415, 307, 131, -26, -90, -86, -83, -90, -66, -4, 67, 145, 242, 336, 382, 396, 463, 642, 887, 1072, 1114, 1035, 925, 842, 747, 541, 205, -129, -332, -417, -458, -419, -248, -35, 86, 136, 223, 358, 468, 524, 529, 477, 398, 354, 354, 351, 316, 261, 205, 161, 124, 52, -83, -226, -284, -243, -172, -118, -78, -44, -23, 10, 106, 263, 410, 498, 579, 722, 896, 1019, 1072, 1113, 1188, 1278, 1337, 1319, 1193, 969, 709, 479, 261, -25, -375, -644, -693, -551, -365, -217, -53, 197, 514, 833, 1130, 1408, 1636, 1745, 1706, 1552, 1311, 972, 511, -28, -529, -892, -1116, -1259, -1331, -1294, -1162, -998, -833, -635, -383, -126, 75, 208, 285, 297, 201, -29, -358, -699, -971, -1169, -1353, -1552, -1675, -1595, -1320, -1011, -793, -646, -504, -397, -398, -504, -642, -768, -884, -968, -960, -846, -691, -554, -428, -286, -145, -43, 25, 84, 108, 69, -1, -86, -257, -557, -856, -999, -1005, -983, -929, -780, -564, -348, -149, 19, 129, 212, 323, 436, 472, 427, 349, 229, 32, -216, -440, -592, -673, -703, -686, -616, -467, -227, 54, 263, 327, 310, 325, 365, 343, 245, 163, 145, 134, 77, 12, 7, 69, 135, 138, 59, -76, -203, -281, -343, -433, -504, -483, -415, -419, -501, -562, -590, -667, -792, -865, -835, -761, -720, -727, -744, -699, -568, -424, -363, -401, -478, -537, -552, -540, -563, -669, -809, -877, -841, -769, -703, -589, -388, -183, -92, -108, -122, -74, -11, 22, 66, 166, 305, 429, 501, 509, 465, 393, 310, 223, 140, 93, 92, 99, 72, 40, 75, 188, 314, 423, 535, 634, 667, 629, 568, 504, 440, 397, 373, 323, 244, 202, 237, 280, 250, 167, 133, 188, 261, 256, 168, 77, 55, 89, 110, 83, 61, 106, 172, 157, 62, 5, 44, 109, 141, 173, 235, 291, 310, 302, 278, 231, 169, 124, 104, 83, 33, -43, -132, -210, -235, -183, -96, -56, -89, -138, -153, -146, -130, -102, -66, -50, -55, -70, -92, -138, -202, -249, -249, -195, -98, 16, 103, 120, 81, 43, 40, 34, -10, -78, -106, -54, 56, 165, 221, 235, 248, 264, 244, 176, 108, 85, 87, 71, 54, 91, 151, 149, 70, -2, -19, -10, 1, 38, 76, 70, 38, 53, 124, 179, 159, 71, -24, -63, -30, 12, -15, -118, -222, -266, -246, -195, -138, -79, -12, 56, 102, 104, 78, 51, 29, 20, 34, 73, 103, 96, 85, 123, 195, 224, 174, 108, 91, 106, 109, 105, 117, 142, 165, 169, 152, 124, 107, 95, 32, -105, -258, -355, -390, -398, -395, -374, -335, -296, -256, -204, -132, -53, 1, 12, -14, -58, -90, -104, -118, -172, -274, -366, -394, -369, -342, -316, -255, -168, -111, -97, -74, -6, 88, 161, 171, 131, 110, 150, 204, 204, 165, 149, 160, 144, 87, 54, 92, 165, 198, 169, 129, 136, 184, 225, 225, 193, 149, 112, 98, 106, 91, 24, -45, -50, 12, 66, 54, 3, -22, 1, 45, 63, 39, -7, -53, -95, -137, -170, -178, -159, -130, -90, -18, 80, 147, 152, 139, 150, 159, 133, 102, 115, 159, 173, 154, 148, 181, 214, 214, 202, 214, 246, 269, 283, 306, 342, 375, 402, 436, 474, 485, 454, 391, 322, 262, 216, 189, 173, 167, 184, 233, 289, 326, 339, 338, 327, 309, 285, 237, 151, 45, -38, -85, -111, -132, -129, -86, -17, 42, 80, 105, 128, 138, 124, 87, 38, -24, -98, -169, -217, -238, -243, -246, -232, -179, -102, -49, -45, -63, -62, -36, -10, -8, -38, -84, -113, -104, -79, -70, -76, -83, -86, -99, -126, -147, -146, -125, -99, -79, -64, -47, -24, 8, 38, 56, 65, 67, 55, 17, -34, -64, -65, -68, -90, -104, -77, -33, -11, -10, -11, -23, -58, -94, -107, -107, -111, -108, -88, -57, -19, 19, 32, 10, -12, -3, 21, 17, -26, -77, -103, -103, -104, -118, -131, -131, -124, -122, -124, -111, -89, -75, -72, -72, -66, -51, -21, 0, -6, -28, -25, 2, 22, 16, 0, -8, -15, -21, -17, -1, 9, 14, 22, 40, 59, 70, 72, 66, 52, 32, 16, 5, -2, -8, -6, 5, 16, 22, 32, 49, 60, 51, 30, 18, 14, 3, -15, -30, -34, -35, -35, -28, -15, -11, -10, -2, 10, 14, 7, 2, 9, 8, -9, -25, -26, -23, -32, -46, -55, -56, -54, -49, -42, -34, -24, -15, -13, -12, -7, 2, 5, 0, -4, -1, 0, -2, -8, -11, -11, -12, -14, -15, -9, 0, 3, 3, 6, 12, 18, 17, 13, 11, 11, 11, 10, 10, 9, 6, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 1, 2, 3, 3, 2, 2, 3, 5, 7, 10, 12, 13, 14, 16, 18, 17, 14, 11, 9, 8, 6, 5, 5, 5, 3, 2, 2, 3, 6, 7, 7, 8, 8, 9, 10, 10, 9, 8, 6, 6, 5, 5, 5, 6, 6, 5, 5, 5, 5, 3, 3, 5, 5, 5, 5, 5, 3, 2, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 2, 1, 2, 2, 2, 2, 1, 1, 1, 1, 1, 0, 0, 2, 2, 2, 2, 2, 1, 0, 0, 1, 2, 2, 2, 2, 2, 2, 2, 1, 0, 0, 0, 1, 2, 1, 0, 0, 0, 2, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, -1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 1, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, 0, 0, 0, -2, -1, 1, 0, -1, 0, 2, 0, -1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 1, 0, 0, 0, 1, 0, 0, -1 };
+// IMA ADPCM blocks, see audio_adpcm.h
+static const uint8_t __in_flash("audio_ninety_sample_data") audio_ninety_sample_data[] = { 0, 0, 0, 0, 180, 174, 83, 145, 24, 128, 9, 169, 169, 58, 37, 137, 16, 202, 24, 147, 27, 145, 12, 82, 176, 10, 18, 49, 33, 51, 201, 24, 35, 185, 27, 21, 153, 33, 153, 17, 218, 32, 1, 27, 4, 0, 17, 2, 235, 24, 146, 155, 153, 57, 176, 155, 0, 16, 144, 187, 9, 1, 203, 48, 5, 187, 48, 19, 153, 65, 160, 156, 82, 129, 137, 153, 27, 67, 1, 185, 157, 152, 88, 52, 169, 170, 24, 36, 192, 138, 83, 162, 155, 35, 0, 176, 155, 83, 162, 137, 52, 176, 81, 145, 205, 64, 146, 139, 35, 176, 57, 23, 184, 24, 2, 249, 24, 35, 136, 185, 96, 36, 152, 138, 16, 209, 140, 52, 168, 97, 130, 8, 202, 42, 130, 10, 1, 59, 23, 169, 65, 36, 201, 10, 51, 128, 136, 17, 16, 52, 20, 153, 99, 129, 137, 170, 114, 145, 27, 36, 152, 168, 11, 21, 185, 8, 156, 99, 168, 8, 137, 83, 218, 42, 146, 11, 177, 175, 32, 153, 153, 170, 19, 221, 9, 145, 144, 189, 72, 209, 172, 144, 154, 129, 187, 128, 9, 209, 188, 9, 168, 207, 10, 0, 218, 171, 8, 0, 200, 42, 35, 251, 157, 144, 153, 168, 221, 138, 152, 0, 219, 136, 203, 50, 233, 25, 203, 72, 146, 138, 34, 98, 20, 16, 37, 50, 52, 81, 52, 16, 69, 50, 34, 65, 67, 33, 50, 68, 35, 67, 51, 51, 38, 32, 51, 32, 38, 144, 66, 1, 33, 144, 115, 176, 139, 145, 154, 251, 10, 162, 204, 170, 170, 220, 186, 188, 169, 204, 154, 218, 171, 202, 173, 170, 172, 186, 188, 153, 189, 138, 219, 154, 218, 154, 169, 203, 170, 152, 169, 172, 153, 188, 137, 187, 187, 158, 16, 217, 154, 186, 16, 216, 9, 129, 113, 51, 51, 146, 74, 21, 170, 152, 88, 37, 17, 67, 18, 1, 0, 3, 156, 116, 19, 136, 66, 17, 35, 171, 33, 10, 39, 9, 84, 34, 17, 136, 153, 203, 221, 10, 17, 160, 137, 114, 131, 204, 8, 186, 33, 250, 41, 147, 204, 170, 152, 235, 138, 17, 136, 170, 34, 248, 155, 137, 18, 137, 119, 1, 82, 2, 40, 19, 138, 145, 42, 71, 144, 66, 18, 200, 206, 171, 188, 154, 32, 86, 36, 35, 51, 35, 18, 33, 70, 35, 99, 67, 36, 51, 83, 35, 35, 52, 67, 36, 67, 67, 50, 50, 34, 51, 52, 51, 68, 36, 51, 35, 34, 34, 152, 137, 0, 184, 204, 203, 204, 203, 189, 172, 187, 219, 203, 154, 203, 188, 188, 203, 188, 188, 187, 203, 186, 188, 187, 204, 203, 202, 202, 186, 187, 187, 188, 203, 187, 203, 203, 186, 186, 171, 203, 169, 169, 203, 186, 186, 219, 187, 170, 154, 136, 25, 34, 0, 16, 98, 34, 99, 84, 67, 51, 52, 53, 51, 52, 36, 67, 66, 67, 51, 52, 67, 51, 51, 52, 50, 68, 66, 50, 50, 52, 35, 51, 20, 51, 52, 67, 51, 61, 254, 25, 0, 50, 51, 37, 18, 33, 18, 0, 153, 10, 35, 186, 9, 221, 186, 204, 25, 144, 154, 136, 251, 170, 201, 218, 173, 154, 204, 153, 169, 137, 168, 137, 202, 171, 17, 34, 130, 114, 39, 40, 19, 41, 39, 32, 70, 18, 67, 19, 99, 50, 34, 50, 83, 34, 50, 18, 66, 38, 1, 50, 51, 36, 1, 50, 51, 99, 2, 129, 169, 24, 252, 11, 161, 157, 185, 174, 128, 187, 187, 203, 235, 173, 171, 186, 204, 172, 168, 172, 168, 203, 170, 188, 170, 187, 152, 190, 137, 185, 154, 219, 155, 128, 203, 138, 9, 51, 220, 25, 128, 24, 83, 35, 69, 20, 33, 66, 51, 152, 98, 18, 99, 19, 50, 68, 34, 1, 82, 36, 51, 67, 53, 51, 35, 66, 51, 130, 10, 36, 0, 1, 25, 179, 239, 184, 175, 186, 188, 9, 68, 54, 34, 67, 18, 33, 17, 49, 69, 68, 36, 51, 52, 35, 53, 35, 51, 52, 67, 36, 67, 67, 34, 36, 18, 50, 50, 67, 51, 51, 34, 20, 136, 138, 40, 177, 159, 186, 174, 219, 189, 219, 171, 186, 203, 186, 204, 186, 204, 188, 188, 186, 204, 154, 187, 172, 203, 203, 187, 188, 204, 170, 186, 202, 186, 186, 172, 188, 187, 187, 203, 172, 154, 168, 170, 154, 186, 204, 187, 153, 187, 187, 138, 130, 172, 136, 171, 83, 33, 115, 83, 67, 67, 50, 66, 35, 51, 69, 67, 67, 51, 68, 35, 51, 52, 52, 51, 84, 51, 66, 35, 67, 35, 50, 68, 66, 51, 50, 52, 67, 50, 35, 66, 19, 34, 35, 51, 51, 83, 67, 1, 49, 54, 52, 51, 68, 34, 16, 18, 1, 129, 26, 37, 152, 34, 50, 21, 187, 96, 145, 26, 19, 114, 5, 24, 192, 140, 185, 26, 144, 88, 36, 33, 35, 128, 50, 169, 137, 236, 40, 192, 188, 170, 221, 172, 171, 170, 170, 11, 145, 206, 153, 204, 172, 202, 172, 155, 169, 202, 172, 136, 168, 152, 171, 49, 219, 64, 160, 24, 235, 48, 179, 12, 1, 89, 37, 153, 50, 128, 50, 33, 36, 66, 70, 51, 0, 66, 161, 80, 20, 25, 67, 83, 52, 17, 66, 51, 2, 82, 52, 34, 101, 19, 8, 17, 128, 219, 188, 153, 185, 172, 204, 170, 234, 188, 219, 172, 154, 10, 17, 82, 52, 34, 34, 17, 35, 83, 53, 52, 70, 67, 50, 51, 53, 50, 67, 51, 83, 66, 36, 50, 67, 34, 51, 34, 67, 35, 52, 36, 34, 34, 18, 1, 8, 136, 137, 185, 222, 171, 204, 204, 187, 173, 186, 187, 188, 188, 188, 189, 188, 188, 172, 186, 203, 187, 203, 219, 186, 188, 172, 172, 187, 171, 172, 172, 187, 203, 172, 186, 187, 187, 170, 202, 170, 186, 169, 220, 187, 187, 187, 219, 138, 170, 171, 186, 187, 171, 138, 50, 69, 51, 68, 34, 18, 18, 82, 68, 67, 54, 67, 51, 52, 52, 34, 52, 83, 51, 52, 67, 51, 52, 34, 83, 36, 50, 108, 239, 32, 0, 52, 83, 35, 51, 68, 34, 35, 35, 67, 34, 51, 20, 50, 34, 18, 35, 33, 52, 68, 52, 1, 128, 138, 99, 145, 11, 18, 116, 36, 136, 136, 49, 21, 202, 24, 52, 146, 138, 144, 8, 232, 155, 144, 170, 32, 85, 145, 32, 20, 98, 20, 144, 24, 100, 3, 203, 40, 51, 217, 140, 2, 0, 2, 24, 130, 187, 0, 24, 163, 207, 32, 37, 249, 156, 128, 169, 185, 172, 0, 185, 204, 157, 168, 173, 24, 160, 9, 153, 80, 146, 170, 153, 115, 5, 10, 83, 34, 0, 99, 19, 9, 35, 184, 26, 51, 32, 85, 145, 155, 50, 201, 155, 97, 20, 136, 114, 3, 152, 136, 0, 152, 40, 54, 68, 35, 2, 200, 206, 186, 187, 172, 169, 137, 168, 222, 204, 204, 187, 171, 155, 65, 53, 52, 67, 129, 137, 128, 128, 49, 55, 53, 69, 35, 34, 66, 34, 34, 83, 51, 69, 51, 51, 51, 50, 35, 51, 36, 69, 52, 66, 33, 18, 18, 128, 8, 17, 33, 17, 0, 217, 207, 186, 203, 187, 172, 137, 169, 204, 188, 204, 204, 203, 186, 171, 187, 204, 170, 203, 188, 188, 186, 188, 172, 186, 186, 203, 188, 187, 189, 203, 170, 169, 186, 153, 153, 186, 204, 170, 202, 188, 187, 155, 202, 188, 202, 186, 188, 171, 154, 169, 8, 34, 18, 201, 9, 136, 203, 158, 48, 51, 54, 66, 36, 33, 68, 20, 49, 54, 51, 37, 35, 34, 49, 35, 66, 53, 68, 35, 83, 36, 50, 18, 67, 51, 18, 51, 53, 21, 1, 33, 33, 35, 16, 70, 52, 19, 82, 36, 0, 1, 34, 3, 8, 53, 18, 67, 33, 52, 33, 54, 1, 100, 18, 66, 18, 66, 1, 32, 19, 32, 68, 68, 50, 66, 35, 67, 36, 49, 67, 33, 50, 50, 3, 187, 57, 132, 205, 170, 40, 208, 157, 152, 154, 218, 172, 152, 205, 172, 202, 170, 203, 171, 185, 170, 189, 156, 186, 172, 203, 170, 201, 203, 170, 169, 186, 171, 185, 157, 1, 17, 53, 66, 19, 137, 69, 128, 33, 67, 68, 34, 67, 35, 169, 40, 146, 155, 137, 116, 23, 0, 2, 9, 8, 10, 66, 144, 113, 38, 1, 1, 33, 17, 67, 19, 64, 54, 34, 168, 170, 234, 171, 186, 25, 177, 171, 252, 204, 220, 171, 153, 136, 49, 69, 69, 17, 0, 17, 168, 25, 53, 17, 115, 38, 34, 33, 51, 35, 50, 52, 68, 83, 51, 67, 34, 33, 18, 51, 35, 67, 69, 36, 17, 32, 50, 130, 187, 136, 152, 0, 251, 155, 185, 207, 154, 153, 203, 154, 136, 201, 205, 203, 203, 219, 187, 172, 169, 203, 186, 187, 188, 205, 187, 187, 188, 188, 170, 203, 203, 203, 170, 203, 187, 171, 170, 170, 186, 186, 156, 202, 205, 203, 171, 186, 189, 170, 185, 203, 171, 153, 202, 153, 8, 160, 187, 169, 171, 153, 237, 155, 33, 2, 40, 51, 55, 3, 66, 50, 86, 18, 50, 52, 52, 230, 227, 28, 0, 160, 89, 52, 17, 67, 83, 51, 34, 68, 67, 18, 48, 52, 2, 0, 32, 36, 17, 128, 81, 54, 34, 51, 70, 20, 16, 50, 19, 1, 33, 18, 49, 51, 67, 20, 184, 114, 37, 1, 114, 67, 18, 66, 18, 129, 16, 51, 51, 69, 69, 66, 50, 67, 51, 51, 67, 51, 19, 82, 20, 17, 1, 136, 153, 9, 129, 25, 37, 186, 186, 191, 185, 223, 170, 170, 186, 190, 170, 187, 205, 170, 154, 187, 171, 153, 185, 251, 172, 154, 169, 219, 154, 33, 168, 154, 49, 232, 155, 83, 129, 40, 83, 68, 34, 34, 34, 68, 2, 48, 53, 51, 53, 99, 18, 32, 18, 50, 20, 8, 84, 34, 1, 8, 17, 168, 136, 202, 171, 144, 172, 136, 252, 172, 8, 168, 155, 98, 2, 24, 36, 186, 138, 99, 3, 10, 100, 50, 52, 67, 36, 34, 50, 54, 35, 1, 32, 36, 216, 154, 17, 17, 160, 141, 129, 207, 138, 186, 186, 140, 116, 37, 1, 17, 2, 153, 154, 250, 172, 8, 145, 153, 185, 10, 54, 192, 173, 32, 2, 170, 9, 0, 152, 220, 172, 136, 136, 81, 52, 1, 49, 39, 145, 139, 0, 9, 0, 9, 129, 40, 163, 223, 25, 34, 0, 85, 35, 49, 34, 145, 207, 170, 203, 185, 204, 138, 152, 169, 204, 9, 34, 2, 201, 112, 53, 1, 8, 51, 193, 156, 0, 16, 200, 74, 71, 1, 170, 48, 36, 217, 172, 16, 162, 189, 9, 1, 152, 154, 16, 201, 187, 155, 67, 162, 156, 82, 131, 238, 155, 152, 187, 188, 138, 144, 170, 204, 9, 250, 140, 153, 172, 154, 188, 155, 184, 205, 170, 137, 187, 154, 138, 0, 170, 82, 250, 9, 160, 189, 16, 129, 32, 99, 19, 33, 4, 154, 34, 114, 131, 56, 37, 0, 170, 56, 232, 140, 34, 32, 2, 137, 69, 131, 221, 8, 152, 185, 172, 32, 160, 204, 25, 249, 172, 187, 170, 217, 188, 26, 18, 204, 138, 153, 203, 171, 155, 24, 0, 50, 115, 4, 139, 115, 18, 177, 27, 55, 1, 0, 32, 36, 144, 137, 33, 17, 24, 87, 52, 1, 24, 85, 129, 137, 40, 85, 1, 32, 53, 35, 130, 48, 19, 153, 137, 48, 36, 17, 116, 37, 1, 153, 138, 33, 201, 137, 81, 38, 0, 48, 17, 66, 1, 81, 20, 49, 115, 52, 18, 32, 35, 35, 19, 81, 54, 36, 19, 33, 33, 17, 1, 65, 37, 34, 52, 36, 145, 171, 137, 235, 172, 8, 18, 8, 0, 168, 173, 186, 189, 187, 40, 37, 251, 27, 248, 156, 168, 187, 204, 137, 201, 171, 202, 186, 206, 170, 170, 203, 170, 137, 136, 186, 139, 17, 232, 156, 16, 48, 3, 170, 83, 192, 191, 9, 145, 170, 48, 21, 201, 11, 144, 189, 138, 48, 2, 32, 20, 65, 5, 56, 55, 33, 70, 51, 68, 35, 51, 36, 51, 50, 68, 50, 52, 35, 83, 35, 34, 0, 34, 176, 173, 65, 225, 189, 154, 116, 13, 35, 0, 201, 255, 153, 24, 144, 138, 66, 2, 185, 139, 144, 203, 170, 48, 20, 152, 80, 55, 144, 136, 49, 36, 17, 82, 84, 35, 16, 1, 168, 8, 16, 33, 82, 85, 34, 18, 18, 0, 49, 18, 16, 84, 51, 3, 219, 155, 219, 156, 152, 138, 66, 67, 18, 201, 187, 203, 220, 189, 153, 152, 171, 170, 236, 203, 186, 189, 171, 169, 152, 152, 203, 190, 186, 220, 171, 171, 186, 170, 137, 219, 170, 203, 172, 203, 172, 154, 169, 203, 172, 203, 187, 204, 154, 170, 154, 137, 17, 200, 139, 129, 203, 137, 16, 51, 83, 21, 170, 8, 186, 97, 160, 80, 68, 35, 128, 68, 145, 41, 1, 113, 35, 17, 84, 35, 33, 52, 35, 34, 66, 35, 99, 53, 18, 33, 66, 130, 10, 84, 18, 66, 50, 67, 2, 48, 69, 18, 9, 69, 18, 49, 52, 35, 0, 98, 51, 0, 65, 54, 1, 50, 19, 69, 18, 65, 36, 17, 99, 34, 0, 34, 35, 8, 50, 51, 37, 66, 20, 169, 24, 184, 12, 18, 172, 66, 200, 153, 137, 248, 159, 0, 202, 171, 137, 130, 223, 137, 168, 153, 185, 170, 185, 188, 204, 137, 235, 9, 168, 170, 170, 8, 202, 40, 216, 156, 17, 49, 177, 12, 19, 112, 4, 41, 39, 1, 35, 0, 8, 48, 161, 140, 85, 162, 139, 53, 160, 171, 40, 131, 220, 156, 0, 128, 136, 153, 50, 144, 8, 34, 193, 122, 133, 174, 83, 160, 57, 132, 154, 8, 32, 176, 27, 226, 174, 186, 189, 169, 171, 170, 138, 129, 255, 157, 168, 219, 137, 50, 69, 51, 36, 0, 32, 17, 32, 83, 83, 68, 36, 17, 50, 35, 34, 67, 53, 34, 70, 34, 66, 34, 34, 1, 48, 35, 82, 36, 34, 20, 33, 35, 34, 169, 115, 3, 16, 34, 17, 218, 187, 237, 172, 136, 169, 170, 203, 170, 234, 204, 170, 170, 219, 170, 170, 189, 172, 187, 205, 203, 170, 203, 154, 170, 171, 186, 171, 204, 188, 154, 186, 188, 203, 138, 169, 187, 218, 204, 187, 171, 170, 185, 24, 216, 187, 202, 154, 217, 154, 252, 139, 136, 24, 17, 186, 154, 188, 48, 20, 8, 66, 69, 2, 137, 34, 18, 18, 16, 36, 2, 102, 20, 56, 69, 18, 51, 50, 37, 49, 53, 51, 51, 145, 32, 129, 57, 55, 36, 176, 104, 19, 16, 176, 27, 23, 16, 34, 115, 55, 67, 3, 8, 34, 33, 52, 1, 16, 17, 152, 27, 129, 96, 178, 13, 35, 8, 168, 169, 222, 11, 2, 186, 137, 138, 0, 251, 56, 3, 137, 184, 43, 119, 197, 173, 136, 16, 145, 171, 186, 190, 24, 70, 19, 1, 168, 72, 146, 42, 6, 170, 8, 41, 39, 217, 171, 219, 173, 32, 20, 16, 17, 1, 34, 18, 51, 97, 38, 169, 138, 186, 42, 21, 154, 54, 251, 11, 35, 128, 144, 219, 9, 160, 156, 144, 171, 33, 146, 139, 99, 20, 66, 37, 169, 8, 217, 57, 237, 254, 42, 0, 37, 115, 36, 168, 187, 156, 152, 153, 24, 144, 153, 204, 187, 173, 24, 184, 223, 186, 188, 26, 101, 53, 51, 36, 129, 8, 33, 34, 69, 3, 144, 168, 137, 16, 70, 2, 144, 137, 128, 65, 53, 19, 184, 206, 188, 187, 154, 128, 128, 234, 172, 155, 138, 0, 49, 2, 205, 187, 187, 154, 136, 218, 205, 171, 137, 49, 55, 52, 17, 152, 169, 9, 49, 52, 2, 201, 205, 171, 171, 24, 33, 67, 17, 67, 67, 51, 18, 161, 207, 171, 187, 8, 16, 20, 217, 187, 203, 138, 136, 65, 3, 221, 220, 203, 186, 171, 186, 188, 186, 156, 153, 9, 2, 16, 152, 188, 40, 36, 115, 35, 153, 137, 10, 99, 100, 68, 51, 18, 2, 0, 136, 169, 171, 168, 187, 155, 184, 223, 9, 136, 186, 155, 66, 192, 140, 136, 152, 204, 220, 156, 0, 65, 68, 51, 131, 25, 18, 65, 53, 83, 35, 129, 204, 138, 52, 200, 57, 39, 0, 24, 49, 34, 50, 18, 152, 138, 218, 155, 201, 26, 2, 170, 56, 103, 51, 67, 84, 2, 201, 154, 168, 204, 153, 153, 152, 203, 11, 65, 18, 33, 49, 69, 145, 154, 144, 218, 219, 172, 24, 129, 80, 37, 35, 144, 25, 53, 35, 51, 128, 128, 253, 157, 8, 160, 9, 32, 67, 50, 84, 36, 0, 128, 154, 64, 17, 0, 168, 250, 191, 9, 17, 49, 69, 18, 152, 16, 233, 155, 35, 217, 9, 136, 136, 185, 64, 129, 114, 4, 17, 200, 172, 185, 157, 144, 10, 23, 202, 40, 177, 155, 144, 255, 174, 8, 50, 55, 52, 35, 2, 128, 154, 33, 18, 33, 1, 233, 204, 186, 153, 136, 8, 129, 136, 184, 27, 22, 235, 188, 205, 155, 154, 24, 145, 154, 169, 174, 136, 49, 103, 18, 17, 0, 152, 185, 155, 153, 24, 152, 137, 202, 42, 19, 49, 36, 100, 130, 64, 19, 169, 202, 207, 204, 187, 153, 136, 16, 17, 49, 1, 17, 51, 71, 36, 33, 129, 153, 184, 190, 188, 186, 219, 155, 24, 17, 51, 35, 184, 189, 186, 154, 137, 144, 255, 219, 189, 170, 154, 9, 33, 67, 67, 50, 19, 50, 35, 33, 68, 34, 144, 24, 176, 190, 235, 138, 0, 16, 100, 67, 18, 161, 9, 216, 189, 136, 169, 153, 219, 171, 188, 8, 144, 97, 34, 115, 18, 66, 19, 32, 19, 202, 10, 37, 128, 115, 20, 8, 33, 136, 184, 91, 39, 16, 20, 153, 33, 1, 161, 188, 48, 192, 140, 161, 28, 179, 191, 19, 170, 34, 50, 36, 66, 2, 187, 187, 138, 220, 10, 20, 187, 16, 188, 65, 176, 113, 37, 51, 129, 10, 145, 187, 190, 138, 168, 204, 188, 153, 186, 25, 87, 35, 34, 33, 17, 128, 128, 64, 20, 171, 160, 158, 184, 159, 49, 50, 35, 50, 54, 131, 203, 26, 3, 188, 114, 6, 0, 152, 136, 217, 41, 160, 58, 6, 26, 145, 157, 152, 154, 1, 33, 37, 65, 131, 159, 21, 41, 0, 255, 154, 169, 154, 128, 0, 138, 83, 208, 138, 233, 205, 172, 153, 8, 115, 103, 18, 16, 1, 136, 136, 0, 17, 0, 128, 202, 205, 171, 137, 137, 24, 18, 152, 136, 204, 25, 200, 156, 185, 173, 170, 136, 185, 188, 203, 136, 17, 116, 53, 36, 18, 128, 137, 152, 137, 136, 136, 170, 222, 203, 153, 170, 8, 32, 50, 67, 69, 1, 152, 202, 172, 203, 155, 169, 138, 184, 173, 154, 24, 86, 83, 51, 52, 18, 1, 128, 153, 202, 204, 203, 188, 187, 203, 169, 136, 152, 9, 34, 66, 68, 18, 34, 144, 204, 187, 190, 171, 187, 9, 128, 72, 54, 68, 67, 34, 67, 35, 34, 33, 19, 185, 205, 189, 188, 171, 169, 24, 18, 33, 129, 48, 176, 81, 52, 2, 64, 241, 140, 218, 156, 144, 25, 130, 120, 36, 48, 38, 0, 34, 0, 34, 0, 83, 2, 185, 174, 152, 189, 56, 3, 50, 21, 65, 146, 153, 0, 128, 168, 26, 164, 255, 153, 203, 9, 184, 57, 22, 8, 52, 130, 16, 18, 35, 1, 169, 40, 248, 175, 128, 187, 9, 153, 50, 16, 54, 3, 67, 145, 40, 131, 188, 24, 176, 223, 169, 169, 202, 25, 69, 0, 64, 20, 51, 3, 8, 51, 146, 152, 202, 9, 252, 175, 1, 153, 16, 152, 65, 145, 10, 86, 35, 0, 48, 3, 191, 138, 152, 0, 17, 70, 1, 8, 0, 83, 161, 98, 36, 128, 171, 204, 190, 171, 170, 171, 170, 56, 21, 49, 23, 169, 202, 190, 205, 9, 82, 85, 35, 33, 1, 136, 152, 16, 34, 18, 1, 185, 223, 173, 154, 153, 8, 16, 128, 152, 172, 138, 153, 25, 34, 129, 17, 185, 207, 189, 187, 137, 0, 82, 70, 51, 34, 16, 136, 152, 153, 24, 1, 185, 222, 190, 203, 187, 153, 8, 48, 52, 35, 35, 168, 8, 169, 138, 1, 172, 144, 222, 203, 173, 8, 32, 100, 67, 51, 35, 2, 128, 153, 170, 188, 205, 188, 204, 203, 186, 169, 169, 137, 32, 33, 51, 52, 52, 35, 128, 185, 188, 186, 173, 138, 137, 80, 38, 34, 85, 34, 50, 66, 37, 1, 49, 152, 202, 206, 154, 202, 10, 169, 41, 162, 140, 19, 136, 34, 64, 87, 128, 0, 185, 188, 155, 0, 8, 3, 41, 119, 18, 66, 67, 145, 24, 21, 128, 65, 129, 152, 168, 236, 138, 144, 41, 34, 1, 168, 10, 130, 205, 88, 54, 2, 9, 0, 219, 170, 203, 9, 152, 40, 50, 130, 88, 37, 33, 35, 115, 6, 137, 136, 169, 169, 205, 169, 218, 25, 35, 17, 50, 17, 99, 146, 10, 84, 50, 18, 169, 153, 220, 155, 154, 48, 36, 65, 83, 18, 145, 32, 70, 2, 0, 17, 128, 251, 159, 0, 185, 170, 187, 8, 170, 64, 53, 84, 18, 24, 129, 42, 37, 0, 52, 233, 155, 185, 155, 17, 113, 54, 2, 144, 137, 145, 206, 10, 168, 138, 235, 138, 200, 11, 52, 16, 145, 239, 236, 241, 62, 0, 187, 203, 137, 114, 70, 50, 18, 1, 128, 129, 128, 17, 18, 128, 217, 221, 203, 155, 153, 138, 17, 153, 0, 201, 10, 18, 65, 130, 136, 152, 153, 253, 187, 170, 153, 136, 33, 87, 36, 35, 18, 128, 128, 152, 137, 17, 201, 220, 236, 187, 187, 171, 137, 17, 66, 50, 35, 18, 17, 83, 34, 0, 136, 169, 251, 220, 155, 169, 136, 49, 86, 35, 67, 18, 17, 128, 169, 203, 187, 205, 204, 219, 187, 186, 172, 154, 136, 16, 35, 83, 36, 34, 36, 129, 17, 129, 24, 129, 9, 148, 174, 1, 186, 58, 103, 35, 51, 34, 36, 144, 152, 188, 219, 187, 202, 154, 186, 156, 169, 172, 24, 66, 54, 2, 101, 130, 137, 130, 172, 50, 201, 64, 162, 42, 22, 136, 144, 40, 54, 33, 51, 86, 19, 153, 16, 160, 202, 137, 153, 136, 186, 154, 253, 139, 129, 138, 83, 99, 52, 129, 1, 202, 8, 217, 155, 144, 10, 1, 172, 33, 217, 73, 51, 101, 35, 32, 19, 202, 154, 205, 10, 184, 138, 168, 10, 130, 140, 85, 19, 66, 35, 114, 21, 8, 18, 160, 170, 203, 139, 168, 11, 36, 8, 3, 221, 137, 153, 8, 33, 70, 3, 153, 250, 188, 154, 24, 35, 24, 103, 129, 8, 144, 137, 1, 17, 82, 36, 0, 33, 252, 141, 33, 8, 33, 1, 99, 2, 204, 154, 169, 9, 160, 174, 0, 144, 136, 172, 137, 40, 20, 252, 204, 155, 66, 53, 83, 52, 36, 17, 0, 0, 0, 128, 128, 168, 205, 204, 188, 171, 187, 8, 152, 9, 128, 64, 2, 40, 20, 24, 2, 189, 153, 204, 169, 220, 154, 128, 32, 54, 52, 52, 35, 17, 144, 155, 168, 189, 168, 222, 154, 219, 171, 185, 155, 33, 66, 83, 50, 36, 129, 128, 169, 9, 184, 173, 169, 9, 233, 157, 32, 32, 99, 52, 52, 34, 1, 168, 187, 189, 187, 235, 188, 203, 172, 171, 171, 138, 8, 17, 51, 68, 85, 19, 0, 0, 129, 128, 170, 24, 20, 137, 1, 152, 138, 114, 71, 36, 50, 36, 2, 168, 154, 153, 187, 205, 204, 153, 185, 140, 129, 138, 35, 0, 70, 18, 52, 130, 9, 177, 159, 8, 170, 138, 16, 2, 40, 71, 1, 99, 36, 32, 83, 1, 128, 33, 1, 185, 138, 161, 255, 138, 169, 138, 144, 10, 35, 137, 66, 84, 36, 33, 50, 176, 206, 186, 153, 137, 9, 128, 49, 5, 154, 116, 19, 65, 36, 34, 129, 187, 169, 205, 170, 187, 9, 201, 140, 17, 49, 21, 48, 55, 1, 33, 50, 69, 160, 26, 4, 219, 9, 152, 8, 217, 42, 131, 11, 161, 175, 1, 188, 32, 169, 117, 161, 57, 132, 10, 68, 83, 19, 17, 176, 174, 128, 219, 25, 51, 146, 56, 6, 155, 18, 41, 55, 0, 37, 168, 136, 223, 170, 153, 9, 169, 64, 129, 8, 145, 189, 235, 220, 171, 155, 48, 119, 52, 50, 34, 1, 144, 153, 9, 0, 235, 99, 57, 0, 33, 160, 222, 188, 188, 186, 154, 8, 49, 34, 16, 136, 170, 153, 169, 153, 49, 133, 205, 170, 189, 137, 169, 24, 66, 71, 51, 53, 19, 0, 168, 205, 187, 187, 169, 171, 186, 189, 220, 171, 154, 25, 85, 67, 36, 18, 17, 153, 170, 219, 155, 153, 169, 136, 160, 203, 139, 49, 68, 71, 36, 34, 35, 136, 169, 204, 219, 187, 203, 188, 154, 202, 155, 153, 138, 66, 35, 115, 51, 67, 19, 17, 152, 172, 170, 188, 25, 0, 65, 35, 48, 53, 49, 87, 33, 52, 17, 49, 177, 188, 251, 172, 170, 156, 137, 136, 16, 128, 64, 36, 17, 52, 36, 52, 2, 137, 128, 218, 172, 170, 136, 9, 85, 17, 67, 129, 64, 3, 41, 53, 18, 17, 152, 251, 189, 171, 202, 139, 65, 1, 49, 34, 84, 19, 32, 50, 67, 129, 9, 129, 255, 154, 186, 156, 153, 9, 50, 33, 52, 36, 51, 34, 67, 18, 65, 19, 219, 171, 235, 203, 156, 33, 128, 33, 50, 67, 50, 36, 8, 36, 217, 24, 177, 171, 202, 188, 234, 190, 56, 35, 98, 36, 69, 2, 0, 17, 200, 140, 128, 172, 64, 177, 140, 144, 154, 203, 56, 161, 112, 132, 25, 51, 16, 69, 17, 16, 1, 184, 189, 32, 178, 12, 209, 175, 128, 201, 156, 49, 146, 172, 251, 207, 154, 137, 50, 101, 67, 35, 18, 128, 136, 138, 9, 128, 1, 185, 206, 188, 188, 170, 136, 32, 51, 36, 49, 1, 154, 219, 188, 202, 171, 187, 170, 153, 169, 41, 51, 64, 103, 67, 67, 51, 36, 168, 186, 221, 171, 171, 155, 137, 136, 152, 202, 153, 136, 80, 55, 52, 51, 18, 168, 220, 187, 189, 153, 153, 24, 34, 18, 34, 50, 71, 34, 68, 36, 17, 129, 202, 203, 189, 186, 204, 154, 168, 137, 0, 24, 50, 17, 68, 18, 67, 35, 17, 200, 189, 186, 206, 154, 16, 66, 67, 67, 51, 34, 35, 67, 35, 8, 33, 217, 205, 203, 203, 171, 187, 9, 17, 51, 52, 84, 18, 33, 2, 9, 128, 219, 154, 186, 138, 184, 156, 33, 144, 115, 119, 17, 50, 34, 128, 137, 153, 189, 137, 184, 171, 217, 171, 24, 153, 64, 103, 35, 33, 36, 129, 152, 185, 169, 187, 203, 188, 171, 204, 139, 17, 18, 50, 69, 68, 36, 18, 16, 2, 218, 187, 16, 161, 13, 35, 219, 9, 8, 129, 137, 99, 99, 20, 153, 33, 144, 153, 223, 25, 129, 189, 24, 130, 40, 69, 51, 52, 19, 34, 83, 130, 152, 153, 218, 221, 203, 138, 136, 187, 33, 145, 171, 9, 69, 67, 84, 35, 36, 128, 48, 20, 128, 64, 37, 1, 2, 222, 138, 184, 190, 153, 9, 0, 0, 144, 202, 253, 204, 186, 203, 25, 115, 68, 51, 36, 2, 128, 168, 170, 138, 16, 1, 168, 205, 203, 203, 170, 16, 83, 50, 33, 17, 185, 191, 203, 186, 171, 170, 136, 136, 33, 66, 53, 35, 52, 67, 37, 238, 30, 57, 0, 17, 2, 168, 235, 190, 172, 171, 153, 0, 67, 19, 50, 145, 153, 170, 24, 50, 21, 184, 220, 221, 186, 188, 137, 8, 67, 53, 67, 51, 51, 18, 0, 152, 203, 187, 189, 187, 204, 170, 186, 170, 153, 136, 99, 52, 34, 2, 186, 221, 189, 186, 188, 10, 144, 41, 19, 56, 38, 115, 36, 82, 35, 32, 145, 169, 201, 171, 169, 8, 152, 113, 146, 43, 132, 11, 51, 8, 24, 3, 223, 155, 217, 172, 153, 0, 153, 49, 2, 115, 37, 17, 35, 2, 50, 2, 16, 162, 174, 16, 235, 9, 136, 97, 19, 18, 49, 162, 223, 9, 136, 24, 82, 52, 128, 168, 188, 219, 187, 40, 67, 2, 113, 36, 185, 138, 1, 168, 88, 52, 19, 0, 65, 209, 173, 137, 154, 40, 34, 116, 18, 24, 33, 152, 9, 24, 50, 224, 140, 145, 223, 136, 169, 32, 18, 82, 21, 1, 17, 136, 128, 219, 40, 177, 157, 67, 1, 0, 185, 40, 4, 137, 82, 34, 2, 250, 157, 152, 203, 9, 0, 97, 35, 0, 80, 36, 144, 170, 168, 220, 187, 137, 114, 52, 18, 49, 1, 170, 33, 248, 174, 203, 187, 187, 155, 65, 36, 161, 204, 221, 204, 186, 137, 83, 69, 52, 36, 2, 128, 169, 155, 137, 9, 49, 36, 1, 169, 203, 153, 153, 9, 66, 129, 202, 221, 188, 203, 203, 170, 154, 8, 49, 84, 36, 19, 2, 136, 170, 187, 154, 8, 17, 146, 223, 155, 219, 11, 49, 115, 35, 1, 160, 236, 171, 171, 171, 24, 136, 32, 146, 56, 5, 48, 69, 49, 51, 145, 9, 249, 172, 128, 171, 65, 129, 113, 35, 66, 52, 129, 169, 220, 219, 219, 171, 154, 169, 137, 152, 128, 128, 16, 17, 98, 19, 50, 193, 172, 128, 172, 32, 68, 67, 83, 54, 33, 52, 18, 83, 144, 137, 177, 206, 154, 170, 137, 1, 1, 33, 32, 51, 218, 26, 208, 140, 184, 175, 137, 65, 130, 40, 84, 34, 36, 130, 64, 20, 153, 35, 235, 9, 201, 8, 184, 72, 19, 67, 2, 16, 144, 56, 146, 26, 36, 248, 174, 202, 173, 136, 136, 66, 17, 85, 2, 40, 19, 153, 153, 154, 152, 204, 24, 18, 184, 139, 33, 36, 16, 84, 67, 20, 185, 128, 254, 138, 168, 138, 18, 49, 4, 73, 39, 153, 49, 128, 24, 235, 56, 147, 172, 16, 33, 18, 16, 119, 19, 185, 9, 200, 12, 131, 11, 38, 170, 50, 201, 56, 176, 172, 189, 10, 249, 173, 49, 131, 8, 50, 53, 184, 27, 131, 42, 55, 33, 99, 2, 8, 152, 171, 168, 172, 184, 191, 66, 200, 10, 161, 207, 187, 205, 203, 203, 137, 16, 115, 68, 67, 34, 2, 152, 170, 188, 154, 33, 50, 68, 36, 18, 1, 0, 144, 153, 201, 219, 203, 203, 188, 187, 137, 137, 16, 34, 114, 52, 0, 24, 200, 190, 187, 172, 138, 33, 67, 68, 19, 17, 128, 186, 171, 152, 185, 205, 154, 235, 233, 250, 54, 0, 156, 1, 0, 51, 19, 2, 168, 202, 205, 188, 189, 155, 137, 136, 65, 53, 50, 69, 18, 1, 136, 186, 203, 10, 8, 24, 1, 186, 137, 249, 172, 9, 185, 219, 203, 220, 204, 186, 204, 153, 137, 16, 18, 66, 51, 17, 51, 233, 11, 129, 9, 54, 65, 84, 34, 51, 34, 34, 129, 152, 153, 204, 32, 200, 139, 160, 137, 252, 74, 131, 58, 21, 136, 202, 9, 202, 9, 9, 102, 18, 0, 34, 35, 251, 56, 160, 138, 25, 68, 128, 32, 84, 18, 32, 162, 43, 150, 159, 49, 169, 64, 145, 136, 152, 137, 33, 187, 103, 146, 41, 147, 10, 178, 223, 0, 152, 26, 52, 136, 51, 202, 34, 251, 57, 176, 28, 2, 171, 0, 0, 0, 17, 152, 35, 253, 155, 17, 152, 88, 38, 1, 16, 161, 170, 17, 50, 51, 144, 233, 156, 129, 223, 81, 161, 42, 6, 172, 16, 170, 24, 160, 97, 147, 138, 35, 235, 41, 35, 98, 19, 155, 8, 219, 170, 141, 116, 161, 41, 4, 219, 137, 168, 139, 32, 50, 144, 102, 161, 10, 5, 170, 32, 136, 137, 32, 200, 64, 132, 10, 144, 25, 249, 157, 1, 170, 137, 200, 239, 171, 203, 155, 40, 100, 68, 51, 34, 129, 202, 188, 171, 137, 48, 85, 35, 51, 33, 17, 153, 168, 169, 186, 173, 170, 188, 25, 16, 67, 34, 3, 137, 176, 205, 204, 172, 235, 187, 170, 187, 48, 99, 52, 50, 20, 184, 188, 205, 171, 138, 136, 40, 35, 66, 35, 50, 21, 152, 144, 222, 170, 203, 186, 9, 136, 64, 20, 33, 35, 66, 19, 136, 129, 252, 172, 169, 171, 49, 50, 103, 18, 17, 130, 187, 186, 175, 154, 186, 10, 128, 171, 0, 250, 41, 145, 155, 145, 206, 137, 217, 138, 129, 24, 54, 17, 99, 129, 65, 3, 154, 67, 176, 25, 146, 89, 23, 16, 54, 145, 16, 176, 156, 144, 172, 66, 168, 72, 146, 138, 160, 28, 20, 189, 99, 184, 27, 162, 140, 1, 26, 71, 144, 32, 129, 32, 130, 58, 55, 217, 41, 129, 10, 34, 48, 55, 160, 25, 208, 157, 17, 152, 66, 129, 65, 179, 141, 17, 170, 32, 17, 33, 192, 156, 129, 219, 9, 16, 3, 170, 137, 97, 178, 175, 34, 236, 138, 8, 65, 18, 82, 20, 169, 8, 169, 172, 168, 141, 36, 185, 33, 177, 24, 146, 114, 7, 136, 17, 203, 40, 192, 74, 22, 9, 50, 144, 153, 169, 170, 186, 172, 65, 193, 12, 131, 155, 54, 153, 52, 201, 17, 222, 25, 152, 136, 186, 8, 137, 163, 255, 97, 144, 64, 129, 40, 176, 43, 133, 157, 82, 145, 40, 130, 156, 52, 184, 72, 194, 11, 146, 173, 152, 138, 18, 219, 24, 192, 172, 32, 217, 42, 240, 172, 202, 173, 10, 32, 100, 52, 35, 35, 185, 173, 187, 156, 48, 52, 69, 51, 18, 0, 168, 152, 186, 171, 144, 153, 33, 48, 55, 18, 51, 176, 222, 172, 32, 46, 57, 0, 153, 169, 154, 9, 168, 175, 8, 137, 33, 16, 130, 251, 189, 219, 187, 172, 8, 34, 18, 49, 21, 202, 155, 186, 174, 154, 155, 33, 152, 114, 21, 8, 0, 138, 129, 204, 25, 160, 48, 21, 33, 99, 18, 16, 34, 137, 51, 192, 57, 4, 153, 234, 156, 128, 204, 72, 3, 153, 200, 223, 170, 188, 137, 169, 40, 130, 57, 5, 155, 168, 173, 169, 171, 32, 49, 119, 3, 34, 35, 144, 9, 1, 16, 69, 50, 69, 17, 16, 0, 152, 82, 3, 56, 5, 170, 144, 207, 24, 152, 40, 34, 54, 192, 10, 148, 190, 24, 144, 56, 4, 153, 82, 147, 11, 54, 160, 24, 217, 41, 161, 41, 38, 50, 1, 32, 248, 155, 168, 24, 33, 115, 4, 32, 3, 10, 19, 170, 3, 207, 32, 160, 80, 35, 34, 1, 160, 175, 9, 169, 41, 147, 11, 163, 207, 168, 139, 53, 153, 84, 160, 153, 234, 155, 152, 8, 33, 2, 24, 161, 175, 17, 203, 97, 208, 11, 1, 139, 83, 51, 51, 33, 136, 184, 223, 32, 144, 72, 5, 24, 145, 173, 152, 156, 99, 146, 41, 209, 175, 1, 187, 114, 3, 17, 1, 184, 156, 152, 169, 50, 192, 97, 193, 141, 17, 154, 24, 1, 168, 170, 218, 10, 128, 98, 20, 144, 186, 26, 146, 113, 55, 8, 19, 236, 138, 170, 41, 52, 33, 52, 128, 202, 189, 138, 169, 96, 3, 8, 1, 204, 10, 201, 171, 8, 234, 26, 52, 115, 39, 17, 1, 186, 203, 171, 0, 83, 54, 36, 18, 152, 153, 187, 139, 16, 17, 49, 36, 128, 136, 152, 144, 221, 187, 220, 155, 0, 169, 33, 192, 173, 185, 157, 153, 24, 160, 173, 235, 188, 187, 138, 0, 83, 19, 128, 176, 207, 170, 170, 8, 136, 65, 35, 32, 38, 17, 144, 188, 220, 154, 8, 48, 53, 35, 38, 145, 8, 1, 0, 171, 64, 163, 25, 68, 54, 144, 64, 163, 173, 168, 187, 136, 205, 137, 168, 204, 155, 33, 185, 10, 152, 170, 255, 10, 145, 155, 52, 144, 66, 34, 66, 2, 0, 168, 157, 49, 129, 114, 39, 33, 67, 144, 40, 177, 28, 2, 57, 22, 24, 19, 169, 9, 137, 49, 54, 145, 12, 21, 222, 24, 128, 137, 136, 67, 1, 115, 4, 9, 129, 188, 9, 169, 88, 37, 17, 34, 1, 170, 220, 11, 18, 190, 96, 162, 140, 52, 153, 82, 146, 137, 136, 172, 155, 0, 17, 69, 17, 17, 168, 24, 232, 42, 132, 187, 0, 218, 172, 49, 37, 50, 37, 152, 202, 203, 171, 40, 4, 16, 52, 192, 154, 8, 136, 169, 8, 232, 172, 154, 40, 101, 35, 33, 51, 233, 155, 169, 9, 33, 33, 51, 251, 13, 0, 25, 55, 130, 0, 233, 173, 154, 137, 49, 54, 2, 128, 152, 235, 155, 16, 8, 48, 129, 9, 145, 157, 99, 128, 138, 218, 188, 219, 138, 67, 35, 83, 2, 169, 136, 204, 81, 132, 9, 19, 252, 177, 2, 56, 0, 138, 0, 33, 51, 53, 147, 203, 188, 171, 153, 72, 55, 33, 145, 137, 208, 175, 24, 168, 32, 128, 99, 161, 41, 177, 191, 204, 139, 168, 88, 54, 68, 18, 152, 169, 205, 155, 16, 50, 69, 36, 2, 152, 171, 171, 171, 138, 83, 51, 36, 51, 2, 185, 219, 204, 186, 172, 40, 67, 34, 51, 146, 222, 170, 170, 154, 0, 0, 184, 188, 187, 156, 136, 81, 3, 185, 221, 172, 187, 139, 24, 50, 50, 52, 144, 137, 202, 190, 202, 203, 137, 50, 69, 52, 19, 1, 185, 188, 172, 8, 36, 83, 83, 17, 16, 2, 128, 153, 154, 186, 187, 172, 66, 20, 34, 145, 201, 239, 171, 170, 170, 139, 32, 145, 10, 37, 184, 202, 172, 202, 189, 8, 17, 82, 53, 2, 17, 152, 170, 188, 24, 68, 20, 83, 52, 0, 16, 1, 152, 40, 21, 128, 64, 68, 37, 17, 54, 130, 8, 203, 137, 202, 25, 83, 51, 50, 67, 68, 161, 157, 0, 250, 155, 32, 68, 35, 67, 18, 184, 205, 155, 170, 41, 53, 18, 52, 1, 137, 168, 203, 186, 169, 188, 25, 19, 115, 39, 2, 128, 185, 189, 171, 169, 48, 37, 33, 130, 186, 24, 216, 11, 18, 234, 188, 171, 9, 49, 102, 51, 128, 152, 220, 172, 169, 25, 83, 34, 17, 2, 202, 188, 153, 170, 25, 20, 0, 65, 36, 128, 82, 18, 202, 187, 204, 154, 8, 83, 36, 17, 1, 201, 204, 137, 136, 153, 8, 50, 130, 89, 39, 128, 16, 32, 160, 158, 160, 29, 39, 170, 84, 177, 156, 152, 170, 155, 114, 18, 16, 144, 155, 201, 27, 54, 33, 18, 10, 178, 223, 66, 168, 114, 161, 138, 129, 203, 24, 50, 2, 65, 131, 173, 0, 204, 24, 168, 49, 224, 25, 2, 8, 50, 162, 255, 188, 186, 170, 72, 103, 36, 0, 128, 185, 205, 138, 32, 82, 67, 35, 1, 186, 203, 154, 138, 16, 68, 51, 17, 33, 2, 219, 186, 251, 171, 136, 56, 54, 35, 17, 185, 206, 187, 154, 16, 0, 0, 168, 220, 171, 136, 8, 33, 176, 207, 187, 203, 171, 0, 16, 34, 50, 19, 153, 251, 220, 188, 187, 138, 49, 54, 53, 2, 160, 202, 203, 170, 9, 50, 69, 35, 67, 2, 128, 169, 203, 187, 138, 66, 53, 52, 34, 160, 219, 156, 153, 153, 16, 2, 202, 187, 137, 9, 82, 83, 2, 250, 187, 170, 172, 57, 52, 67, 66, 3, 152, 185, 173, 188, 139, 49, 70, 52, 37, 1, 136, 185, 188, 137, 17, 99, 20, 49, 51, 17, 1, 8, 248, 173, 16, 1, 81, 54, 3, 8, 128, 204, 9, 34, 67, 35, 35, 192, 139, 152, 97, 52, 1, 128, 185, 188, 137, 33, 70, 36, 144, 154, 0, 200, 10, 147, 190, 16, 186, 48, 51, 84, 20, 234, 187, 188, 138, 32, 34, 69, 146, 153, 218, 188, 136, 0, 8, 32, 2, 168, 155, 48, 200, 172, 251, 189, 138, 49, 19, 180, 0, 37, 0, 67, 53, 177, 174, 186, 154, 137, 65, 1, 50, 145, 16, 168, 205, 64, 224, 156, 0, 128, 56, 55, 40, 20, 187, 40, 18, 237, 56, 164, 10, 19, 9, 49, 147, 58, 134, 73, 211, 14, 18, 154, 0, 72, 22, 152, 0, 186, 24, 221, 40, 0, 34, 221, 80, 161, 27, 36, 32, 130, 25, 250, 15, 128, 10, 68, 1, 32, 145, 202, 155, 201, 11, 54, 0, 66, 129, 152, 218, 154, 187, 41, 162, 27, 71, 8, 33, 200, 173, 219, 171, 64, 69, 67, 35, 130, 203, 173, 137, 16, 52, 54, 34, 129, 184, 154, 153, 9, 1, 66, 20, 67, 37, 17, 129, 235, 187, 172, 138, 82, 68, 1, 128, 203, 188, 187, 137, 24, 18, 200, 219, 187, 188, 137, 152, 186, 173, 186, 173, 153, 137, 170, 189, 187, 154, 33, 35, 2, 253, 204, 171, 154, 25, 83, 35, 2, 128, 187, 171, 26, 146, 42, 39, 115, 21, 34, 35, 129, 186, 186, 137, 65, 86, 34, 0, 144, 171, 171, 32, 144, 81, 146, 172, 185, 158, 33, 1, 16, 144, 8, 236, 10, 2, 185, 42, 177, 175, 66, 2, 65, 177, 171, 235, 140, 83, 83, 36, 1, 128, 186, 187, 64, 3, 81, 36, 18, 2, 80, 21, 152, 0, 186, 10, 66, 101, 52, 17, 128, 144, 186, 58, 71, 35, 17, 50, 208, 171, 153, 97, 52, 144, 65, 161, 138, 184, 73, 4, 9, 50, 160, 88, 20, 0, 34, 162, 190, 140, 129, 170, 56, 34, 52, 209, 187, 32, 249, 175, 17, 160, 24, 129, 81, 132, 138, 144, 174, 170, 139, 128, 81, 20, 16, 201, 188, 185, 172, 24, 1, 66, 36, 160, 172, 17, 234, 9, 50, 18, 8, 129, 206, 24, 129, 9, 1, 0, 170, 136, 25, 103, 69, 144, 25, 161, 171, 1, 115, 52, 18, 144, 169, 154, 8, 48, 119, 19, 0, 130, 173, 152, 172, 67, 1, 17, 145, 188, 138, 202, 113, 4, 136, 0, 201, 26, 18, 144, 40, 179, 255, 12, 153, 48, 38, 128, 49, 161, 175, 138, 152, 48, 19, 49, 34, 145, 170, 233, 174, 153, 219, 172, 0, 2, 33, 51, 248, 191, 155, 0, 32, 86, 36, 34, 152, 137, 152, 40, 69, 67, 50, 34, 34, 34, 51, 67, 146, 9, 146, 13, 87, 34, 35, 129, 169, 186, 172, 25, 67, 20, 168, 203, 191, 138, 153, 152, 202, 204, 188, 187, 171, 155, 185, 206, 219, 187, 169, 25, 128, 170, 220, 172, 188, 170, 16, 16, 168, 203, 204, 155, 153, 152, 186, 186, 221, 171, 25, 66, 36, 130, 169, 187, 10, 65, 83, 83, 34, 18, 1, 17, 51, 83, 162, 191, 137, 24, 35, 32, 39, 201, 154, 153, 153, 9, 103, 2, 152, 8, 50, 178, 142, 67, 34, 200, 43, 23, 8, 16, 33, 131, 187, 48, 33, 53, 35, 87, 129, 136, 129, 24, 20, 8, 51, 8, 176, 140, 19, 65, 4, 154, 40, 194, 142, 37, 0, 51, 88, 245, 32, 0, 161, 205, 42, 36, 18, 129, 118, 146, 138, 1, 56, 6, 10, 35, 128, 169, 42, 39, 0, 0, 24, 55, 200, 26, 53, 36, 176, 89, 21, 168, 26, 49, 0, 25, 33, 130, 217, 41, 52, 18, 16, 82, 20, 250, 138, 1, 169, 49, 129, 25, 67, 161, 158, 0, 219, 40, 200, 156, 16, 8, 0, 168, 201, 188, 218, 205, 25, 19, 136, 96, 4, 188, 32, 216, 139, 128, 8, 16, 3, 203, 81, 192, 156, 169, 41, 200, 89, 20, 24, 35, 0, 168, 141, 152, 41, 130, 112, 55, 129, 32, 129, 9, 234, 9, 19, 0, 32, 53, 160, 169, 10, 132, 27, 19, 115, 23, 10, 50, 216, 172, 136, 203, 156, 17, 17, 34, 145, 170, 24, 249, 158, 32, 17, 50, 35, 168, 24, 251, 175, 137, 137, 24, 83, 1, 0, 184, 203, 223, 188, 170, 24, 128, 97, 53, 51, 17, 17, 145, 169, 40, 84, 36, 52, 55, 35, 33, 18, 34, 16, 32, 66, 68, 68, 34, 50, 20, 1, 0, 33, 2, 16, 67, 18, 8, 184, 205, 187, 207, 170, 185, 188, 218, 171, 201, 189, 219, 187, 187, 188, 186, 203, 186, 189, 187, 204, 187, 203, 186, 187, 173, 169, 203, 203, 203, 187, 173, 186, 171, 154, 170, 136, 185, 202, 172, 154, 188, 154, 16, 50, 66, 67, 35, 17, 144, 187, 169, 172, 114, 38, 17, 50, 82, 36, 185, 64, 67, 35, 49, 71, 34, 19, 66, 20, 8, 32, 33, 66, 51, 70, 34, 51, 1, 83, 146, 40, 37, 83, 35, 48, 37, 1, 0, 33, 18, 33, 51, 69, 130, 24, 2, 136, 161, 13, 69, 0, 49, 85, 36, 152, 32, 145, 26, 20, 81, 53, 34, 36, 35, 18, 185, 138, 2, 32, 54, 116, 53, 2, 16, 18, 129, 136, 97, 37, 1, 82, 36, 18, 152, 40, 36, 144, 25, 100, 19, 136, 49, 3, 152, 152, 40, 160, 27, 102, 146, 172, 1, 201, 237, 154, 129, 154, 152, 10, 129, 190, 172, 187, 204, 170, 138, 136, 153, 153, 170, 250, 206, 138, 128, 170, 138, 56, 146, 158, 128, 154, 152, 188, 40, 168, 171, 24, 70, 17, 16, 101, 18, 202, 32, 51, 146, 12, 55, 129, 2, 16, 37, 160, 32, 176, 172, 185, 0, 252, 139, 18, 219, 153, 144, 203, 137, 185, 174, 137, 0, 201, 42, 162, 58, 148, 10, 208, 74, 133, 172, 82, 52, 36, 33, 115, 19, 160, 136, 160, 9, 50, 98, 37, 49, 131, 189, 186, 206, 203, 154, 98, 51, 83, 52, 52, 18, 136, 33, 51, 3, 114, 70, 50, 34, 51, 51, 18, 1, 2, 82, 52, 68, 37, 17, 34, 17, 1, 170, 24, 1, 32, 128, 25, 145, 238, 189, 188, 187, 203, 219, 154, 186, 204, 219, 187, 189, 186, 186, 204, 170, 154, 218, 188, 187, 186, 220, 171, 154, 170, 219, 187, 203, 187, 174, 170, 185, 172, 137, 128, 186, 187, 170, 186, 206, 155, 33, 18, 136, 20, 201, 33, 0, 82, 3, 153, 138, 136, 221, 9, 33, 50, 19, 40, 71, 145, 138, 9, 83, 34, 67, 85, 52, 35, 17, 52, 130, 32, 67, 83, 51, 84, 20, 33, 19, 16, 51, 17, 65, 85, 51, 50, 67, 34, 34, 34, 0, 97, 51, 35, 35, 50, 4, 137, 176, 157, 34, 65, 54, 34, 51, 2, 201, 188, 172, 25, 84, 1, 81, 35, 144, 219, 187, 190, 153, 137, 66, 17, 68, 129, 169, 188, 170, 204, 24, 36, 99, 52, 17, 17, 1, 201, 155, 0, 33, 85, 36, 50, 33, 128, 154, 154, 202, 89, 36, 67, 51, 66, 19, 168, 205, 25, 130, 138, 84, 51, 152, 24, 3, 235, 172, 137, 16, 129, 26, 35, 184, 237, 171, 202, 139, 168, 159, 17, 187, 136, 136, 131, 239, 25, 144, 153, 137, 136, 50, 130, 156, 117, 3, 186, 65, 145, 137, 9, 53, 234, 8, 129, 128, 202, 64, 130, 136, 236, 26, 130, 155, 128, 40, 132, 207, 24, 216, 156, 48, 20, 153, 48, 177, 42, 248, 141, 0, 16, 18, 115, 3, 8, 49, 129, 219, 140, 52, 145, 24, 49, 36, 252, 158, 152, 187, 171, 40, 52, 34, 84, 34, 0, 153, 16, 1, 66, 86, 68, 34, 65, 50, 18, 17, 50, 36, 83, 36, 83, 67, 33, 34, 34, 17, 32, 99, 18, 33, 51, 36, 144, 153, 153, 202, 190, 171, 144, 235, 187, 202, 189, 189, 172, 186, 219, 170, 169, 219, 187, 219, 186, 188, 188, 186, 171, 188, 172, 187, 204, 203, 187, 186, 189, 186, 170, 170, 203, 171, 187, 190, 172, 169, 154, 154, 153, 136, 202, 172, 155, 219, 188, 154, 136, 153, 128, 32, 34, 153, 137, 128, 219, 112, 55, 18, 49, 55, 36, 17, 32, 66, 35, 33, 99, 67, 67, 49, 67, 35, 34, 67, 52, 50, 83, 68, 35, 18, 51, 68, 34, 17, 67, 51, 17, 48, 37, 17, 34, 34, 36, 17, 49, 70, 1, 137, 67, 35, 0, 66, 51, 17, 202, 89, 37, 152, 33, 51, 177, 173, 16, 144, 26, 130, 171, 71, 145, 56, 36, 67, 53, 53, 35, 68, 51, 51, 18, 65, 35, 33, 84, 51, 67, 53, 52, 35, 152, 50, 129, 33, 136, 115, 3, 0, 1, 34, 251, 156, 137, 168, 205, 138, 32, 161, 189, 186, 188, 204, 174, 138, 185, 172, 138, 136, 168, 219, 9, 161, 207, 137, 128, 128, 152, 24, 146, 190, 10, 129, 187, 97, 19, 16, 100, 51, 34, 53, 18, 81, 34, 17, 34, 68, 2, 8, 1, 137, 0, 17, 160, 174, 169, 218, 188, 168, 255, 158, 0, 169, 138, 32, 2, 201, 153, 154, 153, 185, 155, 82, 20, 16, 34, 33, 248, 173, 202, 189, 172, 42, 4, 171, 153, 169, 252, 189, 187, 154, 170, 56, 55, 34, 34, 83, 129, 153, 49, 54, 36, 99, 52, 37, 35, 50, 51, 20, 34, 83, 67, 68, 50, 67, 35, 50, 51, 35, 50, 68, 67, 34, 33, 34, 1, 144, 79, 63, 31, 0, 185, 171, 169, 186, 219, 236, 204, 187, 204, 189, 171, 171, 188, 188, 187, 204, 188, 172, 172, 187, 203, 187, 202, 203, 187, 204, 187, 172, 187, 188, 187, 188, 186, 186, 204, 187, 203, 186, 186, 172, 154, 170, 170, 187, 188, 204, 170, 187, 172, 170, 169, 8, 145, 136, 16, 51, 146, 41, 117, 67, 68, 52, 83, 67, 34, 66, 35, 34, 99, 36, 50, 83, 67, 50, 34, 66, 51, 50, 68, 67, 68, 34, 50, 36, 50, 35, 35, 36, 51, 83, 34, 49, 34, 18, 1, 136, 33, 83, 68, 51, 51, 1, 34, 209, 156, 18, 184, 96, 20, 24, 17, 186, 205, 187, 188, 170, 136, 152, 170, 202, 253, 204, 170, 137, 24, 67, 68, 51, 51, 18, 169, 137, 138, 81, 99, 84, 34, 50, 51, 146, 187, 81, 52, 18, 84, 68, 67, 17, 8, 0, 9, 33, 66, 37, 82, 35, 1, 128, 137, 0, 136, 16, 100, 36, 128, 128, 144, 252, 155, 17, 1, 128, 50, 3, 250, 189, 170, 202, 171, 170, 16, 200, 157, 168, 189, 187, 203, 170, 171, 25, 17, 176, 190, 170, 186, 221, 154, 128, 16, 145, 8, 184, 42, 176, 12, 21, 65, 87, 2, 0, 129, 187, 137, 219, 9, 32, 84, 3, 186, 10, 249, 207, 138, 136, 137, 1, 144, 96, 3, 235, 187, 137, 0, 137, 65, 52, 19, 144, 172, 136, 16, 50, 146, 73, 54, 129, 207, 188, 188, 153, 153, 155, 170, 153, 253, 189, 188, 170, 154, 136, 128, 50, 52, 50, 1, 32, 53, 52, 69, 53, 84, 67, 50, 51, 51, 36, 83, 51, 68, 52, 51, 36, 51, 51, 51, 36, 36, 52, 67, 50, 35, 34, 18, 129, 16, 16, 50, 1, 49, 209, 173, 204, 205, 219, 170, 186, 187, 188, 188, 219, 188, 203, 188, 187, 172, 203, 172, 187, 188, 188, 188, 187, 188, 203, 187, 187, 173, 186, 187, 173, 187, 187, 187, 172, 186, 203, 170, 202, 219, 154, 171, 187, 187, 173, 186, 155, 184, 188, 186, 10, 162, 191, 40, 35, 130, 74, 55, 18, 33, 68, 36, 17, 67, 68, 35, 17, 84, 19, 33, 52, 18, 52, 34, 70, 34, 35, 51, 68, 34, 35, 50, 68, 35, 18, 67, 18, 34, 20, 0, 8, 50, 19, 32, 54, 34, 51, 1, 32, 39, 33, 83, 52, 67, 67, 67, 51, 128, 82, 67, 19, 8, 115, 36, 161, 140, 50, 200, 157, 16, 17, 49, 37, 50, 35, 136, 136, 40, 130, 155, 103, 20, 152, 41, 3, 32, 36, 33, 87, 18, 16, 35, 1, 83, 51, 83, 37, 67, 67, 35, 34, 34, 34, 34, 83, 68, 34, 68, 35, 129, 40, 145, 188, 8, 17, 68, 18, 0, 66, 248, 173, 154, 169, 203, 10, 168, 220, 203, 187, 205, 186, 170, 153, 185, 156, 152, 234, 203, 154, 187, 186, 137, 51, 18, 136, 49, 209, 206, 170, 16, 17, 16, 117, 19, 8, 16, 169, 186, 137, 49, 36, 101, 19, 151, 4, 30, 0, 17, 161, 173, 136, 202, 187, 40, 18, 144, 186, 204, 236, 187, 155, 9, 35, 8, 84, 177, 190, 170, 8, 200, 139, 86, 35, 128, 137, 18, 249, 155, 33, 49, 54, 67, 51, 129, 144, 137, 170, 155, 66, 54, 19, 0, 251, 190, 188, 188, 170, 25, 17, 33, 53, 161, 138, 169, 204, 155, 113, 35, 82, 52, 51, 67, 33, 35, 83, 53, 67, 52, 36, 36, 34, 34, 35, 36, 83, 52, 35, 67, 67, 34, 1, 17, 50, 2, 56, 37, 130, 16, 144, 206, 171, 202, 203, 186, 186, 172, 187, 207, 172, 187, 219, 187, 172, 186, 187, 189, 203, 219, 188, 171, 203, 203, 171, 187, 203, 203, 187, 187, 220, 186, 170, 186, 172, 170, 186, 189, 156, 187, 203, 186, 186, 171, 188, 187, 171, 219, 171, 170, 171, 169, 172, 128, 187, 25, 129, 24, 115, 52, 16, 85, 3, 32, 68, 35, 50, 86, 34, 49, 52, 36, 33, 68, 51, 66, 68, 35, 67, 49, 68, 18, 34, 51, 67, 36, 66, 34, 66, 35, 34, 50, 51, 51, 100, 35, 35, 35, 53, 34, 50, 19, 81, 54, 18, 49, 68, 51, 128, 65, 51, 51, 17, 85, 35, 16, 67, 130, 155, 49, 192, 173, 41, 35, 99, 19, 136, 83, 160, 172, 169, 175, 137, 0, 50, 52, 35, 83, 20, 168, 25, 86, 18, 50, 99, 52, 18, 33, 52, 19, 32, 85, 51, 51, 84, 35, 34, 17, 33, 130, 138, 48, 53, 20, 34, 52, 33, 145, 190, 25, 160, 188, 9, 160, 222, 171, 185, 191, 187, 203, 187, 186, 203, 172, 204, 187, 188, 204, 170, 170, 186, 203, 188, 154, 202, 188, 186, 187, 187, 172, 0, 235, 138, 169, 203, 171, 154, 169, 154, 144, 9, 37, 129, 170, 56, 148, 207, 42, 70, 2, 40, 18, 40, 3, 42, 103, 17, 34, 50, 84, 129, 25, 51, 129, 170, 65, 36, 34, 144, 42, 21, 204, 139, 49, 131, 11, 55, 1, 33, 128, 17, 236, 137, 170, 114, 35, 82, 35, 49, 3, 186, 171, 8, 248, 141, 17, 16, 129, 25, 195, 255, 171, 169, 202, 156, 16, 17, 18, 128, 24, 3, 187, 80, 36, 81, 86, 51, 18, 69, 34, 34, 52, 35, 53, 37, 35, 52, 52, 34, 67, 35, 50, 68, 51, 66, 36, 34, 35, 17, 33, 18, 35, 128, 98, 130, 24, 176, 173, 218, 189, 187, 219, 203, 172, 169, 205, 171, 186, 205, 171, 187, 188, 203, 203, 187, 187, 206, 171, 171, 204, 186, 187, 187, 188, 172, 187, 219, 203, 171, 170, 173, 170, 153, 187, 172, 170, 188, 187, 203, 153, 202, 156, 136, 170, 169, 138, 136, 186, 137, 33, 35, 115, 36, 68, 20, 49, 37, 50, 37, 33, 54, 33, 67, 51, 53, 49, 52, 36, 50, 52, 67, 52, 67, 51, 67, 36, 50, 83, 34, 51, 51, 53, 51, 35, 52, 52, 17, 65, 36, 16, 49, 52, 35, 32, 67, 2, 33, 1, 67, 53, 18, 44, 2, 23, 0, 67, 37, 34, 17, 138, 68, 161, 42, 51, 36, 233, 56, 163, 190, 169, 202, 155, 160, 205, 41, 163, 255, 137, 153, 170, 171, 16, 184, 10, 145, 136, 185, 157, 32, 1, 152, 115, 103, 0, 50, 51, 53, 19, 99, 36, 33, 68, 51, 35, 53, 35, 65, 36, 33, 51, 51, 36, 66, 20, 0, 17, 35, 145, 155, 83, 177, 156, 16, 16, 248, 173, 16, 218, 187, 203, 155, 219, 172, 170, 203, 204, 170, 187, 204, 171, 153, 203, 188, 169, 188, 188, 170, 203, 155, 186, 171, 128, 190, 8, 201, 170, 188, 139, 184, 187, 155, 50, 248, 139, 128, 137, 251, 27, 36, 153, 81, 51, 128, 32, 50, 38, 128, 25, 52, 36, 68, 35, 66, 34, 36, 128, 115, 2, 16, 51, 68, 35, 65, 36, 17, 2, 33, 70, 129, 48, 55, 128, 25, 34, 18, 129, 138, 65, 69, 144, 72, 37, 144, 9, 24, 129, 204, 26, 18, 232, 173, 136, 201, 172, 170, 185, 154, 8, 137, 17, 250, 9, 144, 140, 1, 41, 54, 50, 35, 117, 36, 0, 82, 34, 50, 52, 53, 51, 83, 52, 50, 50, 99, 51, 34, 67, 67, 67, 34, 34, 66, 20, 24, 50, 33, 34, 16, 34, 144, 218, 171, 144, 255, 140, 136, 202, 187, 170, 235, 187, 203, 219, 171, 203, 172, 171, 204, 187, 203, 203, 187, 188, 203, 187, 203, 187, 188, 188, 187, 204, 170, 187, 203, 187, 171, 203, 188, 172, 186, 186, 188, 171, 171, 203, 171, 153, 219, 155, 136, 153, 153, 9, 81, 19, 16, 53, 67, 67, 34, 52, 68, 36, 51, 52, 68, 35, 50, 55, 33, 66, 51, 83, 50, 67, 67, 51, 67, 67, 51, 36, 52, 51, 67, 67, 51, 36, 50, 37, 18, 51, 52, 52, 33, 68, 34, 34, 50, 53, 2, 83, 18, 67, 18, 66, 3, 49, 21, 1, 18, 50, 51, 17, 66, 145, 65, 130, 140, 51, 32, 5, 155, 70, 2, 1, 9, 37, 220, 97, 2, 17, 184, 25, 1, 216, 173, 9, 176, 175, 16, 201, 25, 160, 138, 116, 18, 153, 138, 35, 217, 41, 17, 55, 144, 66, 2, 16, 49, 68, 35, 3, 114, 36, 17, 3, 25, 54, 136, 34, 8, 84, 128, 67, 129, 32, 129, 170, 187, 172, 187, 139, 168, 223, 188, 154, 188, 155, 204, 138, 169, 171, 206, 138, 201, 158, 168, 170, 186, 172, 170, 172, 153, 204, 153, 203, 154, 219, 154, 202, 139, 128, 154, 201, 172, 8, 186, 8, 160, 10, 34, 144, 186, 10, 145, 206, 97, 130, 81, 20, 17, 51, 37, 152, 97, 20, 40, 37, 129, 82, 1, 49, 145, 64, 146, 72, 21, 16, 33, 52, 36, 17, 67, 176, 42, 5, 25, 68, 49, 35, 49, 36, 144, 187, 171, 220, 170, 173, 128, 138, 34, 168, 238, 9, 192, 157, 16, 168, 156, 17, 1, 200, 10, 161, 140, 192, 172, 168, 138, 168, 220, 204, 187, 235, 171, 204, 155, 235, 155, 232, 253, 26, 0, 186, 154, 188, 171, 156, 136, 185, 171, 152, 152, 205, 10, 144, 9, 20, 171, 101, 18, 49, 53, 18, 85, 18, 50, 21, 50, 36, 66, 35, 66, 20, 48, 52, 34, 49, 37, 17, 50, 50, 36, 65, 36, 17, 20, 16, 54, 128, 33, 129, 82, 128, 41, 53, 145, 139, 34, 200, 172, 202, 190, 136, 203, 186, 219, 171, 201, 205, 154, 187, 203, 188, 186, 189, 186, 204, 170, 187, 188, 203, 187, 219, 188, 154, 218, 171, 170, 188, 171, 188, 188, 187, 188, 203, 186, 188, 186, 187, 204, 203, 153, 186, 187, 185, 189, 137, 172, 169, 170, 168, 138, 18, 49, 21, 99, 34, 82, 51, 68, 50, 85, 34, 67, 20, 50, 53, 35, 49, 52, 49, 53, 33, 68, 34, 35, 36, 51, 67, 35, 33, 50, 20, 49, 37, 48, 53, 17, 82, 36, 18, 50, 17, 50, 52, 36, 17, 16, 99, 144, 139, 128, 8, 153, 168, 172, 233, 190, 8, 201, 172, 10, 176, 157, 145, 172, 50, 186, 155, 33, 170, 118, 163, 154, 0, 16, 8, 52, 82, 38, 137, 67, 17, 53, 152, 84, 50, 37, 49, 20, 32, 39, 24, 67, 67, 36, 32, 36, 33, 36, 34, 52, 66, 36, 18, 34, 19, 33, 71, 17, 17, 34, 129, 48, 161, 42, 5, 152, 152, 65, 193, 12, 200, 139, 34, 0, 83, 51, 251, 158, 25, 50, 152, 82, 144, 48, 5, 153, 169, 16, 145, 116, 2, 0, 169, 128, 26, 71, 0, 32, 153, 16, 184, 113, 5, 65, 130, 9, 128, 32, 130, 96, 131, 0, 189, 17, 187, 19, 14, 55, 185, 187, 170, 9, 169, 205, 40, 178, 189, 235, 10, 145, 155, 34, 68, 176, 12, 19, 26, 21, 65, 38, 152, 136, 72, 161, 11, 4, 137, 128, 187, 128, 189, 97, 161, 59, 23, 0, 1, 9, 36, 0, 129, 156, 168, 58, 243, 175, 185, 173, 137, 153, 152, 188, 128, 236, 9, 161, 56, 178, 92, 5, 9, 51, 80, 21, 9, 146, 255, 140, 153, 8, 0, 170, 187, 172, 9, 0, 16, 147, 207, 137, 152, 16, 217, 10, 200, 140, 66, 51, 2, 204, 65, 232, 172, 251, 173, 72, 119, 67, 130, 204, 186, 154, 25, 52, 2, 153, 185, 156, 66, 18, 168, 205, 154, 48, 54, 130, 187, 172, 10, 98, 67, 18, 168, 171, 155, 25, 52, 161, 206, 171, 65, 68, 35, 128, 186, 187, 153, 33, 83, 52, 35, 200, 173, 48, 69, 18, 184, 206, 187, 9, 66, 51, 2, 236, 172, 16, 83, 2, 169, 172, 154, 34, 36, 130, 185, 138, 49, 55, 52, 145, 206, 156, 9, 17, 19, 144, 155, 137, 33, 1, 144, 153, 0, 128, 48, 87, 19, 219, 26, 52, 52, 130, 235, 172, 48, 38, 144, 187, 172, 48, 68, 35, 168, 171, 137, 16, 1, 128, 202, 170, 40, 53, 67, 161, 173, 169, 40, 36, 0, 24, 52, 0, 19, 115, 6, 155, 33, 32, 51, 200, 207, 190, 76, 255, 57, 0, 10, 34, 69, 130, 137, 152, 187, 24, 200, 139, 17, 202, 112, 54, 17, 184, 188, 188, 26, 34, 17, 67, 34, 129, 152, 200, 255, 171, 153, 56, 85, 1, 168, 170, 25, 17, 152, 154, 185, 73, 71, 19, 144, 219, 187, 138, 115, 35, 17, 144, 137, 169, 155, 184, 207, 170, 66, 53, 18, 1, 184, 187, 188, 138, 171, 98, 131, 137, 116, 20, 144, 170, 173, 9, 17, 51, 20, 152, 40, 19, 201, 173, 169, 10, 34, 115, 54, 145, 202, 188, 170, 137, 33, 35, 66, 35, 129, 137, 83, 248, 190, 137, 17, 82, 35, 128, 170, 137, 128, 218, 155, 99, 35, 33, 168, 186, 203, 9, 184, 26, 71, 20, 168, 137, 17, 17, 168, 206, 219, 26, 68, 51, 35, 217, 172, 9, 0, 1, 144, 154, 8, 99, 130, 154, 152, 185, 72, 19, 171, 185, 175, 32, 70, 146, 187, 8, 160, 187, 117, 23, 152, 170, 171, 138, 81, 2, 1, 168, 155, 56, 37, 0, 176, 158, 169, 157, 137, 32, 17, 83, 145, 16, 129, 32, 161, 191, 138, 160, 189, 25, 160, 120, 70, 35, 1, 153, 186, 172, 8, 17, 0, 33, 51, 53, 18, 35, 17, 250, 171, 129, 153, 97, 67, 36, 217, 139, 0, 152, 32, 98, 53, 128, 170, 220, 171, 24, 34, 33, 83, 50, 19, 185, 170, 236, 188, 9, 17, 66, 20, 136, 49, 145, 154, 251, 223, 24, 152, 41, 18, 186, 139, 2, 202, 11, 98, 129, 185, 205, 155, 137, 0, 202, 10, 176, 139, 35, 16, 17, 66, 36, 192, 255, 154, 136, 1, 67, 19, 234, 26, 17, 169, 56, 39, 8, 50, 200, 11, 50, 152, 98, 1, 82, 36, 35, 161, 155, 185, 139, 85, 1, 32, 71, 1, 9, 16, 136, 186, 173, 114, 2, 154, 49, 18, 170, 64, 194, 174, 32, 146, 157, 49, 145, 205, 171, 170, 41, 37, 17, 53, 145, 187, 219, 203, 9, 168, 156, 115, 22, 1, 17, 168, 220, 138, 129, 128, 33, 85, 1, 0, 168, 137, 169, 33, 69, 19, 16, 176, 191, 138, 50, 36, 67, 144, 8, 160, 171, 219, 48, 240, 191, 56, 37, 0, 83, 130, 202, 187, 170, 41, 68, 35, 36, 161, 188, 154, 136, 9, 66, 146, 190, 139, 98, 36, 0, 67, 216, 204, 187, 24, 52, 35, 68, 161, 189, 186, 153, 8, 83, 18, 18, 185, 188, 136, 186, 56, 161, 73, 146, 138, 118, 4, 186, 170, 203, 188, 25, 51, 65, 37, 128, 202, 206, 171, 137, 8, 17, 66, 68, 129, 128, 153, 184, 190, 137, 40, 51, 33, 86, 19, 152, 40, 130, 137, 0, 40, 101, 2, 8, 68, 160, 8, 32, 36, 8, 69, 34, 131, 189, 136, 219, 155, 66, 49, 39, 168, 16, 233, 172, 8, 169, 41, 146, 10, 17, 202, 139, 144, 205, 220, 138, 176, 139, 17, 32, 161, 188, 251, 171, 169, 9, 50, 129, 220, 136, 220, 155, 9, 69, 0, 66, 129, 128, 222, 237, 42, 0, 170, 188, 154, 184, 88, 38, 17, 69, 130, 152, 16, 233, 139, 128, 16, 18, 49, 38, 152, 138, 33, 178, 174, 33, 36, 216, 9, 8, 49, 250, 57, 69, 129, 153, 51, 176, 175, 153, 33, 176, 89, 55, 129, 8, 129, 152, 186, 16, 1, 55, 201, 64, 144, 32, 0, 84, 144, 24, 201, 88, 5, 187, 49, 4, 187, 56, 38, 1, 137, 86, 146, 138, 1, 17, 234, 138, 16, 18, 17, 83, 52, 3, 204, 10, 200, 188, 8, 69, 129, 25, 50, 145, 206, 10, 20, 185, 10, 67, 192, 157, 32, 128, 152, 24, 130, 8, 200, 42, 20, 220, 186, 11, 178, 191, 82, 51, 2, 10, 18, 253, 171, 136, 33, 17, 49, 52, 193, 172, 0, 8, 53, 152, 83, 168, 187, 11, 38, 136, 84, 129, 40, 233, 26, 20, 24, 144, 26, 225, 174, 0, 8, 68, 18, 24, 1, 251, 172, 16, 145, 40, 2, 152, 251, 155, 25, 34, 18, 85, 19, 218, 156, 137, 170, 24, 51, 18, 144, 205, 25, 144, 88, 53, 128, 201, 188, 203, 139, 16, 100, 20, 16, 1, 204, 137, 185, 9, 49, 21, 137, 68, 184, 24, 160, 138, 153, 137, 154, 16, 170, 116, 5, 17, 66, 161, 203, 185, 205, 137, 34, 145, 10, 145, 255, 137, 8, 16, 32, 51, 18, 250, 155, 170, 138, 153, 80, 38, 16, 17, 49, 1, 40, 176, 96, 161, 58, 39, 33, 35, 18, 67, 160, 74, 19, 65, 66, 53, 19, 130, 173, 153, 153, 169, 116, 4, 40, 145, 171, 201, 188, 153, 0, 168, 156, 0, 218, 171, 173, 1, 221, 153, 218, 25, 217, 10, 3, 172, 136, 136, 234, 138, 129, 186, 153, 219, 170, 9, 34, 136, 103, 1, 137, 152, 169, 172, 8, 65, 52, 34, 85, 19, 153, 128, 153, 200, 13, 21, 26, 52, 128, 51, 144, 17, 137, 53, 252, 56, 162, 12, 129, 56, 162, 105, 20, 8, 129, 25, 176, 159, 152, 154, 128, 25, 55, 0, 65, 130, 138, 169, 174, 184, 155, 67, 2, 170, 113, 1, 136, 138, 67, 16, 3, 159, 52, 236, 48, 177, 96, 162, 40, 3, 24, 145, 112, 21, 153, 128, 0, 192, 157, 99, 18, 2, 48, 6, 202, 154, 8, 145, 140, 69, 1, 17, 185, 65, 192, 155, 32, 17, 169, 42, 39, 153, 0, 136, 22, 236, 25, 129, 10, 128, 41, 4, 189, 9, 136, 144, 157, 98, 129, 186, 139, 129, 190, 8, 16, 53, 160, 9, 8, 248, 173, 24, 16, 0, 24, 69, 2, 138, 136, 72, 211, 159, 49, 160, 139, 83, 34, 0, 49, 163, 157, 218, 140, 129, 25, 19, 80, 21, 186, 10, 177, 157, 17, 136, 24, 130, 255, 26, 160, 11, 53, 128, 0, 144, 218, 154, 168, 159, 18, 185, 153, 10, 38, 153, 103, 160, 25, 177, 173, 137, 0, 8, 84, 1, 32, 129, 153, 185, 137, 218, 27, 20, 137, 99, 67, 2, 9, 146, 174, 136, 156, 82, 250, 253, 51, 0, 18, 8, 66, 162, 186, 41, 67, 2, 184, 113, 178, 223, 8, 128, 24, 17, 65, 4, 169, 137, 16, 251, 139, 1, 170, 128, 48, 54, 16, 145, 140, 161, 255, 138, 1, 16, 51, 49, 19, 170, 251, 142, 0, 155, 49, 34, 52, 35, 69, 146, 236, 203, 154, 218, 139, 82, 52, 2, 50, 2, 235, 188, 154, 137, 136, 50, 53, 19, 1, 50, 146, 187, 153, 137, 250, 142, 35, 17, 83, 17, 34, 145, 185, 58, 23, 170, 0, 153, 251, 141, 51, 0, 54, 1, 18, 236, 154, 202, 137, 137, 34, 1, 66, 129, 10, 128, 252, 171, 185, 172, 169, 16, 52, 34, 0, 17, 252, 171, 8, 152, 9, 17, 184, 175, 8, 154, 101, 17, 34, 18, 144, 173, 168, 155, 0, 8, 82, 69, 51, 82, 36, 145, 170, 202, 172, 169, 32, 85, 35, 18, 33, 144, 203, 138, 8, 168, 138, 18, 128, 0, 115, 54, 34, 184, 10, 176, 239, 136, 8, 129, 171, 65, 145, 25, 50, 36, 168, 186, 207, 170, 203, 24, 17, 52, 16, 55, 160, 152, 138, 18, 206, 25, 35, 8, 36, 113, 5, 172, 50, 168, 24, 129, 83, 3, 152, 144, 11, 4, 173, 114, 51, 130, 8, 18, 160, 255, 8, 129, 8, 144, 80, 2, 152, 186, 26, 132, 207, 41, 18, 144, 153, 49, 216, 189, 136, 144, 9, 34, 69, 160, 155, 176, 206, 153, 8, 32, 0, 82, 144, 26, 128, 153, 171, 66, 250, 42, 2, 153, 48, 53, 161, 12, 20, 9, 20, 56, 55, 169, 203, 11, 192, 158, 68, 34, 35, 129, 8, 249, 188, 153, 24, 145, 97, 20, 153, 128, 168, 153, 136, 186, 25, 37, 252, 11, 51, 184, 26, 69, 160, 139, 35, 201, 25, 201, 72, 163, 159, 33, 18, 35, 202, 113, 164, 173, 128, 0, 144, 89, 21, 153, 17, 218, 8, 152, 9, 16, 83, 176, 12, 17, 176, 190, 82, 130, 9, 9, 85, 176, 139, 152, 41, 248, 58, 38, 9, 128, 186, 220, 188, 170, 40, 38, 33, 53, 146, 168, 203, 203, 172, 9, 17, 83, 51, 67, 19, 152, 152, 172, 186, 174, 65, 17, 82, 36, 33, 130, 154, 152, 154, 186, 90, 38, 128, 138, 97, 145, 139, 82, 1, 152, 169, 204, 172, 170, 172, 66, 145, 64, 19, 152, 204, 203, 219, 170, 171, 136, 33, 52, 17, 51, 216, 172, 219, 187, 154, 153, 24, 98, 2, 48, 37, 0, 17, 168, 169, 189, 138, 9, 85, 36, 51, 51, 52, 152, 16, 16, 146, 156, 51, 234, 10, 114, 52, 17, 83, 18, 168, 219, 187, 187, 170, 157, 115, 129, 32, 20, 2, 203, 138, 202, 172, 171, 138, 16, 83, 34, 69, 130, 144, 202, 186, 204, 137, 17, 16, 69, 2, 40, 34, 16, 48, 21, 169, 64, 130, 187, 114, 23, 49, 68, 129, 25, 130, 10, 20, 65, 4, 16, 147, 157, 17, 137, 102, 18, 16, 17, 200, 190, 8, 176, 42, 37, 53, 22, 47, 0, 33, 145, 154, 145, 220, 170, 170, 18, 255, 24, 131, 154, 24, 35, 250, 138, 136, 186, 171, 56, 5, 172, 34, 217, 8, 202, 80, 146, 155, 33, 201, 188, 9, 53, 176, 88, 4, 187, 153, 10, 19, 138, 87, 129, 144, 203, 16, 168, 25, 54, 131, 138, 17, 184, 173, 17, 49, 22, 202, 32, 216, 9, 128, 83, 147, 140, 2, 205, 139, 49, 3, 72, 23, 169, 187, 154, 152, 40, 39, 18, 35, 251, 12, 130, 171, 100, 1, 24, 168, 139, 145, 137, 83, 68, 145, 24, 192, 141, 17, 137, 34, 35, 162, 191, 25, 16, 136, 114, 22, 169, 10, 176, 174, 56, 129, 64, 21, 170, 8, 201, 170, 9, 50, 54, 145, 171, 128, 203, 169, 42, 70, 20, 233, 10, 129, 188, 42, 36, 137, 69, 176, 72, 163, 141, 34, 201, 170, 32, 145, 11, 70, 17, 201, 188, 185, 204, 138, 49, 39, 18, 50, 2, 236, 171, 9, 169, 40, 54, 34, 50, 129, 58, 133, 173, 17, 168, 9, 66, 35, 83, 52, 17, 160, 189, 25, 176, 27, 55, 17, 129, 169, 139, 234, 11, 20, 153, 129, 174, 201, 175, 8, 152, 24, 8, 0, 232, 187, 170, 220, 154, 136, 154, 0, 136, 50, 201, 10, 250, 155, 219, 138, 129, 16, 37, 18, 17, 50, 129, 0, 32, 20, 32, 35, 117, 39, 33, 67, 19, 16, 129, 48, 162, 75, 22, 33, 36, 51, 35, 34, 35, 33, 192, 12, 146, 159, 17, 8, 0, 137, 17, 218, 204, 137, 176, 175, 168, 173, 152, 188, 24, 203, 64, 168, 49, 202, 9, 221, 154, 185, 26, 2, 97, 21, 8, 34, 185, 25, 152, 0, 82, 19, 117, 19, 49, 52, 0, 49, 19, 16, 48, 71, 36, 18, 83, 131, 9, 19, 156, 53, 145, 116, 2, 138, 18, 235, 137, 185, 41, 17, 0, 99, 162, 156, 216, 173, 169, 172, 16, 168, 24, 129, 1, 252, 141, 128, 172, 10, 16, 185, 57, 209, 42, 4, 140, 145, 25, 194, 141, 51, 18, 2, 82, 162, 139, 130, 91, 87, 144, 50, 146, 153, 187, 115, 160, 96, 35, 8, 0, 152, 137, 153, 25, 71, 153, 49, 161, 24, 200, 57, 179, 191, 153, 137, 169, 11, 36, 128, 235, 188, 219, 138, 201, 42, 132, 187, 144, 191, 152, 188, 48, 131, 137, 128, 237, 9, 218, 10, 19, 136, 17, 16, 1, 41, 132, 172, 18, 190, 65, 152, 115, 22, 16, 1, 136, 170, 171, 97, 34, 80, 37, 144, 0, 187, 24, 152, 84, 2, 84, 162, 138, 177, 173, 33, 152, 65, 3, 49, 248, 43, 179, 191, 34, 201, 40, 184, 89, 147, 11, 130, 155, 201, 138, 169, 33, 64, 134, 140, 133, 175, 33, 184, 98, 144, 64, 192, 10, 161, 12, 35, 138, 51, 0, 192, 174, 17, 168, 57, 71, 128, 24, 16, 224, 158, 50, 200, 72, 129, 24, 1, 153, 235, 138, 251, 140, 2, 32, 52, 67, 51, 152, 251, 171, 206, 250, 52, 0, 152, 154, 48, 100, 52, 128, 40, 2, 187, 9, 136, 138, 66, 3, 98, 20, 32, 20, 201, 137, 152, 187, 42, 21, 138, 168, 142, 161, 207, 50, 185, 49, 251, 139, 218, 156, 8, 153, 17, 18, 145, 204, 153, 221, 138, 185, 25, 144, 40, 5, 8, 18, 186, 172, 171, 188, 25, 53, 67, 19, 66, 132, 25, 36, 10, 55, 144, 33, 24, 38, 0, 68, 18, 34, 19, 16, 34, 144, 24, 86, 161, 42, 55, 17, 129, 40, 132, 187, 9, 233, 42, 131, 12, 20, 170, 1, 184, 188, 170, 188, 169, 206, 24, 160, 140, 130, 207, 32, 160, 11, 4, 154, 129, 174, 153, 154, 33, 16, 37, 160, 49, 51, 147, 191, 117, 160, 9, 1, 8, 66, 53, 0, 68, 145, 41, 129, 9, 48, 70, 145, 57, 21, 153, 50, 53, 1, 56, 147, 175, 168, 172, 49, 19, 137, 71, 130, 187, 138, 128, 207, 171, 16, 152, 156, 48, 19, 170, 218, 137, 248, 175, 9, 137, 169, 40, 35, 170, 33, 184, 205, 187, 218, 140, 18, 170, 96, 2, 40, 129, 136, 152, 202, 206, 24, 2, 33, 68, 54, 145, 10, 146, 172, 153, 9, 71, 129, 32, 19, 1, 234, 57, 131, 139, 130, 56, 149, 12, 21, 154, 20, 202, 64, 160, 57, 147, 41, 241, 142, 129, 156, 50, 1, 51, 2, 201, 173, 201, 173, 48, 128, 115, 130, 17, 169, 49, 253, 24, 176, 41, 130, 25, 39, 136, 33, 144, 169, 190, 32, 192, 42, 19, 82, 132, 139, 51, 216, 172, 32, 216, 43, 21, 187, 64, 144, 26, 169, 66, 201, 82, 200, 24, 168, 169, 157, 17, 188, 112, 130, 25, 54, 200, 139, 128, 222, 170, 152, 49, 36, 49, 70, 2, 186, 172, 153, 219, 26, 83, 18, 66, 35, 129, 153, 128, 190, 25, 160, 48, 36, 115, 3, 33, 146, 154, 160, 189, 9, 1, 66, 34, 34, 129, 10, 184, 157, 33, 249, 175, 153, 188, 138, 9, 50, 144, 65, 178, 223, 170, 188, 169, 173, 32, 152, 48, 2, 16, 201, 172, 220, 172, 152, 137, 49, 50, 52, 129, 152, 169, 236, 139, 0, 34, 130, 96, 38, 1, 33, 1, 17, 184, 58, 51, 66, 54, 67, 52, 18, 51, 17, 82, 130, 9, 2, 98, 38, 128, 84, 2, 8, 129, 9, 145, 171, 84, 161, 40, 22, 152, 34, 176, 138, 232, 172, 129, 170, 98, 129, 16, 160, 155, 234, 190, 40, 178, 156, 34, 185, 24, 177, 74, 148, 172, 130, 220, 10, 17, 18, 1, 82, 131, 157, 53, 168, 64, 36, 160, 173, 66, 160, 104, 35, 16, 67, 176, 156, 16, 202, 96, 4, 0, 33, 1, 144, 186, 81, 209, 139, 131, 154, 128, 72, 23, 186, 48, 232, 156, 16, 185, 139, 34, 219, 186, 156, 0, 190, 81, 162, 155, 176, 157, 233, 155, 128, 136, 129, 41, 5, 204, 40, 145, 158, 8, 202, 25, 162, 26, 54, 0, 17, 16, 216, 172, 17, 105, 249, 36, 0, 186, 114, 132, 9, 50, 145, 8, 99, 131, 155, 50, 250, 26, 18, 64, 37, 128, 32, 131, 173, 136, 40, 178, 143, 83, 184, 26, 36, 137, 32, 129, 219, 139, 152, 173, 48, 176, 155, 56, 224, 44, 7, 173, 34, 201, 138, 9, 33, 202, 80, 3, 24, 34, 201, 171, 185, 11, 160, 120, 54, 128, 24, 68, 192, 171, 50, 162, 175, 49, 18, 129, 174, 115, 145, 153, 9, 52, 184, 11, 33, 168, 138, 17, 48, 55, 136, 233, 139, 227, 159, 49, 152, 99, 160, 41, 131, 204, 154, 8, 136, 32, 34, 52, 1, 2, 207, 8, 202, 8, 138, 71, 145, 65, 4, 169, 137, 203, 154, 144, 57, 55, 130, 136, 0, 252, 156, 0, 0, 48, 55, 145, 137, 168, 155, 216, 11, 54, 0, 35, 128, 67, 217, 25, 144, 153, 40, 19, 26, 119, 130, 8, 144, 8, 216, 156, 65, 130, 16, 50, 128, 234, 155, 17, 251, 25, 2, 170, 16, 219, 25, 200, 26, 177, 159, 1, 203, 171, 187, 32, 224, 155, 18, 185, 170, 188, 16, 252, 140, 162, 157, 17, 128, 35, 200, 56, 193, 12, 130, 155, 84, 145, 56, 130, 43, 87, 128, 16, 1, 16, 129, 138, 68, 18, 84, 20, 8, 34, 168, 48, 200, 89, 36, 24, 52, 18, 34, 161, 140, 130, 189, 89, 3, 72, 5, 9, 21, 186, 25, 144, 173, 25, 33, 53, 144, 64, 193, 173, 137, 202, 25, 34, 33, 130, 172, 24, 250, 140, 144, 138, 19, 153, 33, 16, 20, 188, 99, 201, 57, 146, 58, 3, 115, 132, 56, 4, 153, 25, 55, 169, 113, 3, 137, 144, 40, 208, 72, 20, 65, 129, 16, 176, 40, 253, 43, 162, 11, 37, 16, 130, 138, 147, 255, 10, 0, 154, 16, 129, 9, 146, 158, 17, 190, 0, 186, 186, 189, 33, 1, 40, 35, 233, 154, 252, 156, 1, 152, 33, 18, 145, 139, 1, 220, 24, 129, 128, 204, 56, 147, 74, 55, 16, 18, 219, 10, 200, 43, 39, 33, 21, 136, 18, 220, 24, 144, 82, 1, 65, 146, 139, 0, 186, 64, 51, 0, 53, 234, 24, 176, 104, 2, 26, 146, 155, 201, 12, 38, 153, 33, 161, 204, 155, 0, 137, 100, 145, 41, 210, 159, 8, 137, 0, 8, 36, 168, 154, 137, 192, 12, 130, 174, 33, 203, 40, 144, 65, 145, 64, 161, 155, 253, 137, 137, 48, 129, 84, 130, 8, 234, 138, 200, 10, 131, 27, 22, 173, 33, 186, 40, 17, 70, 130, 153, 152, 203, 138, 138, 100, 1, 32, 19, 185, 65, 208, 26, 132, 154, 2, 188, 114, 129, 40, 37, 185, 10, 233, 139, 131, 27, 71, 152, 32, 217, 26, 162, 142, 35, 201, 49, 232, 25, 145, 25, 35, 154, 49, 251, 11, 130, 10, 37, 168, 34, 235, 56, 162, 59, 55, 184, 72, 162, 157, 50, 161, 113, 19, 16, 129, 41, 162, 140, 50, 67, 18, 69, 130, 81, 2, 41, 5, 187, 65, 176, 155, 8, 35, 0, 97, 145, 114, 130, 9, 19, 188, 41, 200, 57, 179, 90, 7, 138, 18, 205, 24, 201, 25, 129, 26, 19, 169, 0, 251, 170, 202, 170, 8, 168, 97, 193, 11, 131, 175, 136, 186, 24, 218, 57, 5, 154, 67, 250, 40, 184, 43, 5, 8, 18, 153, 18, 186, 81, 128, 115, 146, 41, 146, 10, 37, 169, 113, 132, 137, 129, 48, 179, 60, 39, 168, 0, 218, 42, 19, 32, 34, 69, 225, 172, 137, 170, 25, 36, 34, 132, 203, 219, 138, 201, 27, 36, 0, 130, 220, 8, 201, 41, 193, 58, 6, 202, 8, 130, 9, 129, 41, 135, 190, 16, 129, 16, 0, 115, 145, 172, 25, 1, 0, 66, 52, 4, 251, 137, 152, 139, 115, 36, 0, 17, 145, 190, 138, 16, 17, 81, 50, 18, 169, 0, 235, 40, 160, 40, 4, 172, 49, 19, 40, 69, 160, 156, 136, 204, 138, 65, 37, 219, 72, 177, 157, 34, 0, 136, 24, 179, 255, 169, 9, 130, 153, 85, 2, 144, 169, 8, 236, 10, 0, 1, 0, 84, 1, 9, 152, 8, 217, 155, 56, 1, 24, 54, 20, 136, 1, 185, 169, 189, 32, 168, 114, 3, 10, 51, 202, 32, 185, 40, 192, 204, 204, 138, 137, 8, 99, 36, 136, 129, 206, 169, 204, 138, 136, 33, 18, 49, 21, 153, 218, 173, 186, 172, 128, 24, 70, 2, 1, 1, 201, 204, 138, 128, 27, 69, 1, 35, 129, 8, 129, 203, 10, 50, 148, 139, 119, 129, 24, 35, 185, 72, 147, 11, 53, 168, 56, 19, 128, 104, 38, 144, 81, 162, 158, 17, 169, 9, 100, 130, 40, 3, 203, 169, 156, 153, 40, 68, 33, 53, 169, 139, 217, 188, 154, 50, 144, 98, 1, 17, 186, 8, 187, 202, 158, 40, 2, 138, 101, 2, 152, 8, 2, 202, 154, 81, 130, 173, 64, 145, 73, 37, 82, 4, 170, 152, 205, 186, 41, 54, 1, 99, 130, 152, 185, 188, 154, 40, 129, 64, 21, 0, 2, 136, 169, 220, 203, 139, 1, 153, 98, 53, 160, 171, 129, 204, 155, 152, 64, 178, 140, 1, 0, 250, 72, 21, 154, 152, 185, 153, 188, 65, 18, 82, 145, 57, 163, 159, 1, 153, 169, 28, 23, 154, 83, 2, 17, 168, 168, 173, 152, 173, 115, 146, 48, 19, 169, 187, 32, 251, 41, 161, 57, 149, 11, 52, 233, 25, 129, 185, 157, 52, 144, 24, 145, 56, 249, 142, 16, 145, 154, 85, 160, 26, 130, 204, 10, 128, 8, 17, 69, 144, 33, 233, 136, 202, 8, 154, 67, 152, 99, 161, 27, 68, 160, 155, 67, 250, 155, 152, 32, 21, 32, 54, 1, 187, 154, 184, 207, 138, 0, 152, 56, 53, 35, 83, 4, 251, 154, 186, 170, 16, 68, 67, 34, 2, 185, 137, 220, 139, 0, 0, 66, 52, 34, 67, 129, 9, 168, 204, 157, 64, 130, 32, 70, 130, 137, 16, 128, 155, 1, 138, 178, 255, 33, 145, 40, 67, 130, 153, 185, 221, 156, 136, 155, 1, 46, 0, 137, 33, 49, 3, 137, 184, 174, 218, 188, 169, 153, 168, 25, 54, 1, 153, 154, 201, 207, 138, 136, 128, 137, 33, 34, 161, 44, 149, 155, 161, 205, 187, 24, 4, 154, 117, 130, 24, 146, 9, 193, 174, 24, 130, 10, 69, 16, 51, 145, 56, 130, 155, 144, 159, 35, 187, 115, 65, 70, 129, 0, 34, 224, 141, 0, 169, 65, 1, 99, 130, 24, 2, 186, 172, 137, 136, 0, 115, 5, 26, 53, 185, 9, 144, 153, 204, 65, 145, 72, 4, 137, 18, 168, 26, 36, 251, 41, 145, 172, 49, 19, 49, 35, 115, 162, 158, 136, 152, 203, 88, 20, 152, 50, 2, 186, 64, 162, 191, 24, 216, 138, 48, 51, 16, 103, 160, 154, 185, 10, 176, 142, 51, 128, 128, 64, 6, 188, 32, 161, 173, 138, 153, 40, 4, 139, 68, 176, 156, 8, 184, 174, 16, 186, 57, 177, 142, 68, 1, 153, 32, 210, 207, 25, 185, 25, 20, 48, 21, 168, 25, 160, 219, 156, 17, 160, 140, 100, 146, 8, 51, 145, 171, 154, 252, 10, 129, 41, 55, 152, 24, 0, 152, 138, 21, 171, 17, 219, 169, 32, 52, 67, 68, 131, 137, 2, 222, 170, 137, 16, 40, 68, 51, 146, 139, 38, 251, 171, 24, 19, 170, 100, 19, 144, 202, 64, 176, 156, 40, 52, 169, 9, 34, 176, 27, 20, 56, 23, 152, 129, 171, 192, 175, 50, 168, 101, 128, 80, 130, 168, 203, 138, 201, 154, 65, 36, 51, 131, 137, 161, 239, 153, 137, 34, 136, 81, 51, 184, 137, 160, 138, 233, 156, 66, 145, 171, 66, 145, 171, 185, 139, 100, 52, 176, 59, 180, 175, 160, 140, 19, 138, 68, 1, 18, 202, 8, 249, 172, 25, 146, 156, 69, 145, 154, 0, 130, 220, 138, 67, 146, 26, 53, 130, 219, 10, 52, 168, 57, 55, 160, 25, 129, 137, 145, 88, 6, 9, 37, 160, 16, 187, 81, 176, 43, 21, 128, 2, 8, 38, 217, 25, 178, 174, 0, 136, 34, 169, 64, 208, 11, 162, 174, 24, 202, 10, 200, 140, 1, 153, 170, 8, 218, 186, 172, 202, 159, 17, 152, 138, 51, 251, 40, 176, 10, 2, 220, 26, 130, 48, 163, 105, 132, 138, 16, 1, 64, 132, 27, 6, 189, 49, 51, 20, 137, 84, 161, 138, 24, 50, 203, 114, 162, 28, 35, 16, 23, 136, 34, 218, 154, 136, 24, 52, 35, 82, 3, 186, 171, 1, 154, 87, 145, 10, 168, 26, 177, 121, 38, 129, 128, 168, 190, 26, 2, 32, 35, 69, 184, 139, 144, 16, 169, 80, 2, 0, 222, 57, 4, 9, 84, 129, 201, 139, 4, 203, 64, 34, 1, 32, 130, 12, 36, 170, 51, 201, 65, 0, 130, 139, 37, 0, 3, 186, 82, 53, 248, 12, 18, 204, 56, 2, 170, 9, 66, 200, 156, 1, 144, 206, 155, 161, 172, 56, 36, 1, 201, 173, 200, 174, 33, 0, 50, 136, 35, 239, 138, 152, 32, 17, 84, 145, 8, 168, 12, 0, 40, 0, 187, 170, 56, 34, 54, 176, 58, 129, 112, 4, 41, 129, 140, 176, 141, 36, 8, 53, 145, 186, 189, 9, 137, 87, 2, 33, 161, 174, 137, 153, 152, 56, 38, 160, 171, 9, 200, 75, 39, 128, 2, 234, 153, 188, 10, 33, 68, 35, 52, 200, 170, 204, 9, 160, 89, 21, 17, 129, 8, 161, 157, 128, 171, 17, 188, 115, 4, 8, 17, 129, 201, 189, 10, 1, 153, 82, 3, 144, 170, 128, 220, 41, 19, 9, 145, 187, 250, 174, 17, 2, 17, 66, 209, 188, 202, 187, 170, 9, 67, 18, 152, 160, 203, 219, 139, 36, 169, 113, 161, 138, 18, 128, 114, 19, 72, 131, 138, 52, 128, 32, 68, 145, 43, 103, 144, 48, 21, 153, 40, 3, 189, 65, 177, 88, 35, 16, 145, 72, 195, 175, 1, 136, 50, 16, 35, 168, 144, 174, 0, 189, 97, 130, 138, 187, 41, 249, 43, 22, 136, 144, 171, 203, 173, 9, 65, 51, 36, 186, 170, 252, 155, 0, 0, 34, 34, 20, 186, 0, 235, 154, 172, 24, 0, 53, 35, 68, 144, 153, 235, 204, 156, 49, 2, 49, 22, 184, 10, 250, 139, 34, 169, 81, 130, 154, 24, 1, 17, 176, 120, 4, 203, 40, 67, 176, 43, 38, 169, 187, 74, 4, 139, 71, 144, 137, 185, 9, 160, 58, 54, 68, 146, 10, 200, 188, 8, 2, 83, 20, 17, 168, 155, 144, 172, 97, 36, 33, 3, 139, 147, 191, 168, 88, 39, 136, 48, 20, 137, 137, 57, 149, 190, 16, 2, 153, 65, 36, 1, 169, 136, 219, 154, 169, 24, 71, 130, 8, 184, 173, 154, 138, 17, 99, 20, 136, 218, 139, 184, 27, 38, 152, 33, 169, 202, 189, 138, 25, 53, 217, 56, 162, 155, 169, 187, 140, 36, 218, 41, 66, 38, 202, 96, 177, 156, 1, 0, 1, 65, 55, 128, 187, 139, 177, 207, 48, 20, 1, 138, 18, 251, 138, 0, 128, 154, 80, 178, 172, 0, 8, 2, 11, 55, 232, 10, 128, 8, 136, 56, 146, 235, 154, 50, 1, 114, 20, 185, 153, 189, 10, 67, 19, 50, 5, 154, 144, 156, 17, 25, 6, 158, 68, 152, 48, 2, 3, 222, 137, 144, 41, 2, 114, 3, 186, 154, 154, 201, 74, 55, 144, 10, 144, 189, 138, 34, 3, 24, 20, 201, 170, 40, 67, 152, 137, 153, 251, 189, 114, 20, 168, 24, 146, 191, 25, 18, 18, 51, 1, 202, 188, 138, 51, 35, 99, 36, 200, 171, 8, 184, 13, 71, 129, 40, 2, 186, 9, 202, 10, 66, 161, 107, 23, 169, 24, 144, 219, 26, 37, 168, 66, 129, 170, 172, 136, 10, 20, 0, 70, 144, 156, 25, 168, 172, 81, 35, 0, 160, 155, 250, 174, 154, 24, 51, 68, 68, 2, 201, 171, 204, 172, 32, 18, 67, 52, 129, 153, 201, 204, 154, 8, 17, 49, 37, 0, 18, 217, 170, 202, 154, 154, 52, 162, 64, 3, 187, 155, 82, 184, 113, 130, 25, 249, 142, 128, 45, 246, 48, 0, 137, 16, 100, 35, 8, 17, 169, 187, 189, 0, 17, 83, 53, 50, 18, 137, 1, 234, 187, 26, 2, 154, 86, 35, 33, 129, 185, 172, 203, 173, 33, 161, 58, 23, 168, 139, 17, 186, 41, 249, 138, 232, 140, 145, 155, 16, 49, 193, 13, 6, 187, 9, 204, 138, 186, 24, 50, 18, 97, 36, 233, 170, 144, 235, 138, 17, 17, 50, 69, 129, 128, 153, 201, 173, 0, 9, 35, 49, 87, 0, 16, 34, 218, 154, 0, 128, 137, 1, 117, 132, 26, 51, 200, 138, 1, 144, 137, 50, 53, 162, 59, 71, 152, 24, 19, 218, 138, 32, 34, 35, 80, 37, 168, 0, 204, 64, 160, 138, 34, 147, 175, 33, 144, 0, 185, 24, 250, 188, 155, 70, 177, 155, 98, 161, 158, 16, 129, 154, 17, 32, 22, 154, 82, 145, 186, 139, 202, 58, 36, 65, 67, 36, 176, 219, 171, 169, 140, 84, 34, 17, 0, 1, 16, 249, 172, 8, 145, 187, 113, 23, 129, 17, 145, 203, 187, 137, 18, 0, 115, 3, 169, 25, 146, 170, 48, 147, 223, 171, 171, 24, 67, 52, 2, 220, 138, 168, 154, 114, 131, 153, 168, 223, 137, 0, 34, 51, 67, 129, 251, 155, 129, 185, 9, 0, 128, 152, 100, 67, 52, 161, 154, 249, 175, 8, 17, 1, 66, 19, 137, 185, 172, 9, 0, 128, 65, 21, 169, 64, 19, 152, 25, 131, 239, 24, 0, 65, 19, 33, 35, 160, 221, 138, 152, 202, 154, 98, 3, 136, 68, 145, 16, 224, 156, 153, 219, 155, 50, 32, 68, 83, 35, 200, 170, 203, 189, 139, 24, 50, 54, 35, 66, 130, 202, 204, 171, 186, 137, 49, 85, 67, 1, 16, 152, 204, 172, 152, 136, 65, 36, 16, 51, 176, 141, 200, 140, 1, 136, 16, 20, 185, 97, 35, 1, 24, 131, 238, 203, 139, 66, 129, 65, 21, 144, 153, 187, 153, 137, 1, 56, 148, 175, 68, 144, 40, 51, 217, 140, 160, 156, 49, 1, 128, 169, 170, 137, 8, 65, 103, 177, 156, 168, 172, 153, 24, 50, 84, 19, 137, 184, 207, 152, 154, 48, 19, 9, 87, 130, 154, 33, 152, 137, 152, 81, 20, 8, 52, 130, 8, 18, 8, 99, 130, 10, 35, 200, 139, 9, 32, 117, 19, 32, 132, 188, 220, 10, 232, 10, 2, 48, 39, 2, 152, 153, 252, 155, 152, 137, 34, 32, 52, 160, 136, 203, 187, 191, 138, 144, 16, 16, 69, 216, 9, 169, 10, 136, 130, 10, 70, 168, 137, 234, 138, 2, 32, 52, 129, 33, 32, 131, 172, 8, 99, 192, 13, 51, 48, 71, 168, 48, 195, 173, 24, 17, 217, 73, 20, 144, 138, 17, 169, 138, 40, 129, 115, 216, 72, 19, 0, 138, 39, 218, 10, 152, 24, 1, 72, 70, 130, 170, 34, 217, 139, 160, 10, 20, 202, 64, 3, 41, 52, 131, 188, 0, 190, 25, 152, 72, 53, 50, 19, 0, 54, 233, 139, 18, 202, 73, 4, 8, 51, 169, 115, 48, 8, 43, 0, 192, 139, 32, 216, 140, 50, 152, 17, 8, 51, 251, 27, 130, 201, 10, 37, 185, 25, 129, 98, 146, 9, 146, 190, 154, 171, 48, 35, 153, 114, 146, 189, 171, 25, 1, 203, 112, 6, 170, 82, 160, 11, 50, 16, 84, 145, 26, 21, 235, 40, 161, 12, 52, 0, 25, 34, 201, 170, 188, 41, 177, 12, 51, 145, 189, 113, 133, 154, 145, 187, 0, 9, 69, 18, 145, 219, 172, 9, 128, 80, 39, 145, 153, 169, 156, 185, 156, 99, 130, 187, 115, 147, 172, 48, 217, 171, 0, 155, 98, 35, 50, 22, 200, 155, 186, 174, 33, 34, 68, 36, 18, 169, 219, 187, 187, 9, 69, 34, 67, 18, 0, 185, 207, 153, 169, 153, 66, 38, 18, 19, 168, 186, 205, 172, 136, 33, 50, 52, 18, 136, 204, 171, 169, 171, 64, 2, 185, 172, 136, 204, 42, 37, 128, 66, 20, 152, 204, 156, 136, 218, 57, 54, 17, 50, 17, 184, 206, 155, 16, 168, 88, 37, 2, 128, 24, 160, 188, 153, 8, 128, 9, 116, 3, 187, 83, 192, 11, 18, 19, 234, 56, 178, 207, 16, 128, 136, 83, 19, 153, 0, 236, 155, 169, 11, 52, 129, 82, 19, 235, 25, 176, 172, 185, 26, 52, 16, 115, 21, 168, 137, 201, 171, 137, 64, 53, 17, 67, 160, 156, 185, 157, 0, 16, 66, 67, 129, 8, 200, 157, 128, 218, 25, 2, 136, 34, 83, 176, 11, 152, 217, 175, 24, 16, 52, 176, 40, 131, 220, 56, 132, 8, 35, 218, 10, 145, 172, 113, 39, 1, 8, 1, 204, 170, 185, 41, 19, 82, 38, 129, 8, 17, 129, 205, 137, 152, 171, 72, 71, 129, 48, 4, 168, 152, 170, 10, 128, 155, 103, 160, 27, 35, 9, 52, 35, 144, 217, 206, 155, 136, 24, 99, 35, 35, 136, 24, 217, 189, 170, 153, 171, 66, 53, 36, 18, 49, 178, 255, 138, 136, 136, 32, 52, 1, 184, 10, 184, 174, 137, 34, 130, 171, 16, 1, 154, 49, 69, 52, 4, 138, 1, 207, 171, 171, 16, 48, 55, 67, 36, 129, 185, 220, 171, 138, 16, 49, 85, 18, 1, 128, 184, 206, 10, 0, 8, 24, 100, 18, 128, 168, 154, 186, 174, 40, 36, 169, 41, 161, 203, 9, 249, 41, 21, 8, 129, 24, 217, 156, 1, 128, 186, 155, 85, 2, 32, 35, 3, 206, 57, 36, 200, 43, 148, 207, 9, 1, 33, 50, 52, 1, 219, 138, 144, 206, 156, 16, 128, 72, 39, 129, 32, 145, 186, 206, 154, 16, 128, 82, 37, 0, 129, 153, 154, 201, 138, 1, 169, 64, 3, 40, 53, 144, 153, 236, 187, 8, 49, 37, 169, 137, 250, 171, 48, 52, 67, 2, 250, 154, 152, 171, 65, 161, 25, 53, 2, 136, 82, 130, 204, 137, 233, 138, 17, 56, 54, 3, 8, 176, 207, 9, 136, 32, 17, 0, 8, 144, 156, 1, 9, 55, 168, 96, 52, 208, 139, 35, 250, 9, 18, 128, 66, 18, 136, 151, 2, 36, 0, 218, 170, 168, 172, 33, 144, 136, 136, 114, 145, 155, 137, 35, 169, 81, 177, 159, 136, 218, 25, 129, 112, 55, 152, 16, 160, 172, 8, 217, 72, 35, 32, 68, 128, 128, 217, 139, 128, 220, 8, 129, 40, 53, 33, 19, 251, 137, 168, 172, 128, 136, 8, 68, 2, 154, 25, 129, 189, 56, 147, 140, 49, 54, 177, 173, 144, 204, 139, 33, 35, 86, 37, 144, 138, 169, 204, 9, 2, 8, 50, 82, 37, 176, 10, 2, 220, 187, 186, 138, 2, 112, 39, 128, 128, 0, 144, 48, 162, 157, 170, 155, 161, 191, 40, 130, 81, 53, 2, 144, 138, 201, 190, 187, 137, 153, 10, 71, 34, 68, 144, 187, 203, 171, 48, 69, 67, 1, 0, 152, 187, 172, 65, 145, 113, 19, 137, 129, 202, 57, 35, 200, 138, 168, 26, 194, 223, 136, 186, 58, 53, 83, 53, 19, 184, 206, 172, 170, 8, 82, 52, 18, 1, 184, 186, 172, 25, 1, 33, 128, 202, 173, 24, 35, 51, 37, 200, 138, 169, 137, 129, 137, 208, 190, 72, 54, 34, 99, 2, 185, 189, 174, 154, 24, 83, 83, 51, 129, 186, 206, 170, 137, 33, 36, 18, 34, 184, 202, 187, 172, 137, 8, 50, 34, 115, 19, 137, 17, 218, 139, 128, 56, 55, 1, 2, 217, 188, 189, 57, 54, 50, 67, 144, 205, 187, 170, 41, 54, 18, 67, 1, 184, 187, 220, 171, 16, 33, 68, 52, 18, 160, 187, 189, 188, 170, 48, 37, 49, 52, 2, 200, 189, 154, 170, 56, 70, 131, 169, 33, 160, 155, 0, 8, 67, 216, 172, 168, 10, 71, 19, 67, 160, 140, 145, 189, 9, 145, 186, 24, 0, 83, 160, 112, 132, 138, 128, 220, 155, 8, 34, 2, 50, 162, 174, 66, 146, 73, 37, 217, 155, 170, 24, 152, 96, 4, 152, 136, 0, 160, 173, 115, 161, 171, 152, 204, 137, 48, 71, 17, 17, 16, 8, 48, 209, 174, 152, 171, 24, 2, 56, 20, 64, 54, 128, 169, 188, 172, 138, 169, 153, 251, 138, 16, 66, 54, 146, 172, 185, 190, 24, 18, 16, 1, 136, 16, 1, 204, 25, 176, 122, 39, 128, 17, 202, 41, 34, 136, 137, 201, 26, 2, 187, 137, 220, 57, 39, 66, 70, 17, 128, 219, 155, 153, 56, 69, 20, 128, 137, 203, 155, 144, 56, 36, 24, 192, 205, 172, 9, 1, 33, 52, 146, 138, 169, 141, 17, 201, 137, 184, 75, 103, 17, 34, 129, 204, 154, 186, 10, 53, 53, 67, 2, 168, 235, 173, 137, 16, 66, 20, 128, 0, 169, 186, 187, 154, 9, 33, 83, 51, 50, 53, 2, 169, 221, 170, 203, 155, 66, 19, 130, 201, 221, 172, 25, 70, 18, 1, 176, 205, 170, 8, 32, 53, 1, 49, 2, 144, 170, 171, 170, 64, 20, 84, 53, 33, 2, 169, 190, 187, 171, 41, 87, 2, 1, 1, 201, 190, 137, 136, 8, 67, 129, 155, 64, 34, 1, 185, 189, 188, 173, 9, 83, 84, 97, 1, 42, 0, 36, 2, 128, 186, 173, 137, 137, 40, 17, 169, 137, 32, 70, 130, 25, 19, 235, 154, 218, 155, 128, 0, 34, 83, 34, 32, 103, 2, 153, 169, 236, 171, 137, 48, 20, 32, 34, 1, 185, 9, 152, 187, 186, 253, 155, 32, 18, 17, 97, 53, 33, 68, 18, 32, 34, 216, 190, 188, 204, 138, 33, 34, 53, 37, 35, 129, 202, 220, 188, 154, 137, 24, 34, 67, 51, 17, 160, 221, 172, 154, 170, 81, 35, 34, 129, 185, 187, 10, 68, 51, 52, 19, 2, 169, 252, 189, 138, 16, 82, 51, 19, 34, 19, 185, 252, 203, 153, 136, 49, 70, 2, 8, 128, 169, 8, 154, 40, 2, 220, 156, 185, 26, 130, 187, 202, 159, 32, 129, 24, 55, 145, 154, 8, 217, 172, 33, 66, 55, 129, 24, 1, 49, 37, 2, 185, 202, 155, 8, 153, 114, 52, 35, 145, 186, 171, 185, 174, 34, 218, 41, 132, 188, 41, 144, 57, 133, 158, 33, 17, 51, 145, 201, 172, 153, 204, 173, 41, 20, 169, 8, 32, 18, 152, 218, 174, 48, 70, 2, 153, 136, 201, 41, 39, 2, 0, 185, 155, 144, 57, 134, 188, 9, 33, 147, 26, 55, 217, 156, 17, 232, 155, 17, 35, 67, 130, 153, 153, 49, 131, 89, 23, 202, 8, 128, 17, 1, 169, 154, 255, 173, 136, 0, 17, 33, 67, 2, 185, 153, 216, 174, 9, 17, 83, 2, 64, 36, 160, 40, 2, 154, 144, 158, 82, 145, 10, 51, 184, 188, 25, 250, 140, 51, 200, 25, 19, 202, 187, 172, 24, 67, 71, 2, 25, 160, 9, 19, 137, 67, 144, 65, 34, 98, 50, 67, 177, 207, 170, 137, 24, 83, 2, 144, 169, 237, 172, 153, 136, 66, 34, 17, 128, 219, 219, 187, 136, 24, 84, 2, 9, 33, 176, 172, 32, 129, 137, 218, 10, 82, 18, 66, 36, 18, 160, 206, 138, 168, 57, 22, 0, 201, 155, 136, 48, 69, 19, 170, 49, 248, 157, 128, 137, 8, 0, 49, 18, 24, 115, 131, 11, 37, 184, 153, 25, 51, 49, 70, 1, 184, 189, 169, 8, 50, 66, 37, 218, 138, 202, 154, 8, 65, 1, 66, 161, 58, 248, 139, 160, 172, 8, 34, 67, 19, 32, 21, 169, 17, 201, 9, 169, 73, 19, 33, 36, 184, 153, 144, 144, 202, 0, 9, 25, 0, 16, 17, 144, 16, 33, 18, 17, 18, 160, 154, 169, 9, 144, 153, 33, 1, 1, 17, 144, 153, 153, 0, 1, 9, 0, 153, 17, 0, 144, 153, 144, 0, 0, 0, 0, 17, 153, 1, 0, 9, 0, 144, 16, 1, 0, 153, 16, 1, 0, 0, 144, 9, 16, 145, 9, 16, 145, 9, 0, 0, 0, 0, 16, 144, 0, 145, 25, 0, 0, 1, 9, 0, 0, 144, 16, 16, 153, 16, 0, 0, 9, 1, 0, 0, 0, 0, 144, 1, 144, 16, 144, 17, 153, 17, 144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
-static const size_t audio_ninety_sample_data_length = sizeof(audio_ninety_sample_data) / sizeof(audio_ninety_sample_data[0]);
+static const size_t audio_ninety_sample_data_length = 34674;
@@ -1,4 +1,4 @@
-// This file was generated by a script on 20-11-2024 08:37:38
+// This file was generated by a script on 17-10-2026 14:18:57
 
 #pragma once
 
@@ -6,6 +6,7 @@
 #include <stdint.h>
 #include <pico/platform/sections.h>
 
-static const int16_t __in_flash("audio_one_hundred_sample_data") audio_one_hundred_sample_data[] = { 58, 57, 56, 59, 69, 82, 87, 85, 85, 90, 94, 95, 96, 98, 95, 93, 93, 94, 94, 98, 101, 102, 100, 99, 100, 101, 99, 96, 94, 91, 89, 88, 89, 90, 88, 85, 83, 84, 85, 84, 82, 82, 81, 80, 80, 82, 85, 86, 85, 86, 88, 88, 88, 87, 87, 86, 86, 86, 87, 87, 86, 83, 81, 82, 85, 84, 81, 78, 77, 76, 74, 73, 73, 72, 72, 69, 65, 62, 63, 66, 66, 62, 59, 56, 56, 57, 58, 57, 50, 45, 45, 48, 49, 46, 41, 37, 36, 36, 37, 37, 35, 28, 24, 23, 25, 25, 21, 18, 17, 17, 16, 12, 9, 11, 13, 12, 7, 2, 1, 4, 5, 2, -1, -3, -4, -4, -5, -6, -8, -9, -12, -14, -14, -10, -10, -16, -20, -18, -15, -16, -21, -25, -25, -25, -26, -28, -28, -28, -27, -26, -27, -32, -38, -39, -38, -39, -43, -43, -41, -40, -44, -48, -49, -51, -56, -57, -54, -50, -50, -52, -53, -56, -60, -62, -61, -58, -58, -59, -59, -59, -58, -57, -57, -58, -61, -61, -58, -51, -47, -46, -47, -46, -42, -37, -35, -35, -34, -31, -27, -25, -25, -27, -27, -24, -20, -19, -20, -19, -16, -14, -15, -19, -18, -14, -9, -9, -10, -8, -4, -3, -2, 0, 5, 6, 4, 6, 12, 15, 14, 11, 12, 16, 20, 24, 28, 31, 34, 33, 31, 34, 39, 42, 42, 41, 40, 43, 49, 57, 58, 55, 55, 63, 70, 70, 65, 63, 64, 64, 61, 59, 60, 60, 58, 57, 58, 59, 59, 57, 59, 63, 65, 62, 58, 58, 62, 68, 70, 64, 55, 50, 56, 63, 65, 62, 57, 52, 50, 52, 57, 57, 51, 48, 51, 55, 50, 43, 41, 44, 46, 44, 42, 39, 33, 27, 28, 34, 34, 27, 23, 25, 27, 24, 20, 18, 16, 13, 7, 3, 2, 3, 5, 5, 0, -7, -10, -8, -6, -10, -16, -17, -13, -13, -18, -22, -21, -20, -24, -28, -26, -22, -20, -24, -30, -35, -36, -37, -38, -43, -51, -59, -60, -59, -58, -58, -60, -66, -73, -78, -79, -81, -89, -101, -109, -111, -108, -107, -114, -127, -132, -126, -122, -130, -143, -149, -149, -152, -159, -165, -162, -163, -171, -175, -174, -173, -178, -184, -187, -188, -193, -198, -200, -201, -205, -212, -216, -219, -222, -223, -223, -227, -236, -241, -242, -244, -250, -255, -256, -258, -263, -269, -274, -279, -283, -283, -283, -286, -293, -297, -294, -291, -294, -301, -303, -298, -297, -305, -310, -305, -301, -309, -314, -307, -300, -301, -301, -298, -304, -318, -318, -302, -289, -294, -306, -311, -312, -312, -310, -308, -306, -310, -320, -328, -328, -323, -325, -334, -341, -337, -334, -337, -344, -350, -356, -362, -364, -365, -369, -373, -379, -388, -396, -401, -410, -423, -435, -440, -446, -462, -478, -484, -482, -484, -489, -496, -500, -503, -502, -496, -487, -487, -493, -494, -481, -457, -432, -408, -373, -327, -284, -242, -189, -121, -52, 13, 83, 157, 231, 313, 419, 527, 614, 693, 791, 910, 1022, 1122, 1226, 1344, 1462, 1572, 1680, 1789, 1896, 2004, 2117, 2228, 2320, 2405, 2507, 2616, 2711, 2792, 2877, 2964, 3036, 3100, 3169, 3246, 3318, 3379, 3430, 3472, 3508, 3540, 3572, 3600, 3623, 3634, 3636, 3634, 3639, 3637, 3623, 3606, 3596, 3585, 3565, 3539, 3511, 3475, 3427, 3382, 3346, 3310, 3257, 3194, 3130, 3071, 3007, 2939, 2868, 2800, 2731, 2656, 2577, 2496, 2416, 2336, 2258, 2180, 2091, 1993, 1898, 1812, 1726, 1631, 1535, 1448, 1356, 1251, 1150, 1062, 975, 874, 770, 677, 588, 495, 391, 281, 170, 68, -25, -122, -222, -320, -417, -522, -629, -725, -810, -898, -992, -1085, -1173, -1267, -1366, -1459, -1541, -1622, -1707, -1785, -1850, -1922, -2014, -2106, -2174, -2220, -2278, -2355, -2422, -2473, -2529, -2602, -2664, -2692, -2716, -2771, -2841, -2887, -2905, -2929, -2969, -2997, -3002, -3016, -3051, -3076, -3070, -3053, -3052, -3052, -3039, -3022, -3016, -3005, -2974, -2940, -2920, -2904, -2871, -2826, -2791, -2769, -2734, -2677, -2622, -2590, -2564, -2519, -2462, -2411, -2370, -2319, -2264, -2222, -2187, -2144, -2093, -2048, -2011, -1970, -1929, -1890, -1851, -1811, -1779, -1751, -1715, -1674, -1639, -1613, -1592, -1575, -1558, -1528, -1491, -1461, -1436, -1411, -1396, -1395, -1390, -1361, -1318, -1283, -1259, -1246, -1242, -1231, -1204, -1173, -1152, -1136, -1116, -1094, -1077, -1053, -1013, -976, -957, -949, -933, -898, -865, -847, -837, -817, -783, -755, -743, -736, -718, -703, -696, -679, -650, -637, -643, -639, -617, -610, -625, -630, -613, -600, -605, -612, -610, -604, -598, -602, -614, -619, -608, -591, -590, -599, -608, -609, -603, -582, -558, -549, -552, -545, -525, -508, -492, -469, -452, -442, -418, -374, -335, -319, -301, -268, -234, -204, -172, -131, -90, -51, -10, 31, 70, 104, 136, 169, 199, 230, 271, 320, 358, 380, 400, 429, 459, 486, 515, 543, 564, 579, 599, 630, 657, 672, 682, 695, 702, 702, 713, 740, 760, 754, 742, 746, 758, 759, 756, 761, 765, 757, 746, 747, 756, 759, 749, 741, 740, 737, 723, 707, 698, 693, 679, 664, 667, 679, 679, 661, 648, 642, 634, 619, 616, 624, 624, 611, 601, 598, 597, 590, 583, 582, 581, 576, 574, 574, 571, 561, 553, 552, 549, 536, 521, 516, 516, 514, 511, 513, 510, 496, 475, 467, 476, 483, 483, 480, 476, 468, 465, 473, 486, 494, 491, 483, 478, 481, 493, 505, 514, 520, 532, 548, 555, 553, 559, 579, 602, 609, 603, 598, 608, 630, 655, 672, 675, 673, 681, 699, 713, 721, 736, 751, 764, 778, 795, 806, 806, 807, 815, 828, 842, 857, 868, 870, 873, 884, 888, 884, 889, 913, 932, 929, 921, 939, 966, 972, 954, 948, 958, 958, 947, 957, 980, 984, 968, 964, 974, 966, 941, 928, 935, 935, 912, 887, 879, 874, 851, 824, 807, 790, 766, 745, 734, 713, 675, 642, 628, 612, 576, 535, 504, 478, 439, 394, 360, 331, 295, 249, 212, 179, 133, 74, 31, 15, -7, -59, -112, -143, -173, -225, -272, -297, -329, -391, -440, -456, -480, -534, -583, -600, -617, -651, -685, -709, -739, -778, -813, -838, -855, -874, -895, -917, -934, -948, -975, -1011, -1044, -1065, -1082, -1100, -1117, -1126, -1132, -1142, -1158, -1175, -1191, -1204, -1217, -1233, -1255, -1277, -1291, -1295, -1301, -1308, -1312, -1317, -1335, -1354, -1355, -1344, -1342, -1356, -1362, -1359, -1360, -1364, -1360, -1353, -1353, -1350, -1335, -1316, -1304, -1289, -1268, -1248, -1238, -1233, -1221, -1197, -1172, -1159, -1153, -1132, -1094, -1073, -1080, -1082, -1052, -1016, -1005, -1003, -983, -958, -949, -946, -925, -898, -895, -908, -899, -868, -847, -847, -835, -807, -793, -804, -804, -776, -746, -738, -736, -723, -707, -697, -686, -671, -654, -641, -628, -611, -596, -584, -568, -563, -575, -577, -543, -500, -495, -516, -512, -489, -484, -498, -488, -454, -433, -447, -467, -460, -434, -424, -436, -440, -415, -386, -381, -385, -364, -331, -321, -325, -306, -262, -232, -228, -222, -190, -150, -123, -97, -62, -26, -10, -6, 33, 117, 187, 189, 176, 231, 321, 357, 344, 369, 451, 509, 511, 519, 581, 650, 679, 702, 757, 808, 814, 822, 885, 961, 979, 959, 981, 1054, 1116, 1134, 1140, 1172, 1220, 1253, 1263, 1275, 1314, 1358, 1369, 1348, 1337, 1357, 1376, 1359, 1309, 1256, 1215, 1175, 1118, 1048, 979, 908, 812, 700, 612, 564, 505, 399, 275, 166, 64, -41, -132, -212, -329, -509, -685, -780, -806, -853, -957, -1064, -1104, -1068, -983, -877, -774, -705, -665, -615, -523, -416, -329, -243, -105, 99, 318, 520, 740, 1026, 1362, 1676, 1930, 2160, 2419, 2728, 3061, 3375, 3633, 3847, 4073, 4370, 4725, 5059, 5311, 5520, 5761, 6047, 6317, 6521, 6671, 6817, 6992, 7183, 7349, 7455, 7509, 7559, 7632, 7714, 7775, 7797, 7777, 7728, 7668, 7600, 7515, 7412, 7307, 7196, 7047, 6847, 6646, 6498, 6383, 6223, 5975, 5690, 5439, 5235, 5040, 4821, 4564, 4276, 3992, 3749, 3550, 3345, 3096, 2816, 2554, 2339, 2141, 1923, 1688, 1467, 1270, 1074, 861, 652, 472, 313, 148, -24, -174, -285, -390, -524, -674, -809, -927, -1041, -1145, -1243, -1362, -1514, -1666, -1769, -1830, -1898, -2002, -2118, -2224, -2325, -2436, -2547, -2651, -2761, -2889, -3024, -3155, -3286, -3420, -3543, -3651, -3762, -3903, -4059, -4205, -4328, -4438, -4539, -4627, -4726, -4858, -4999, -5117, -5218, -5324, -5428, -5510, -5579, -5663, -5753, -5809, -5818, -5821, -5838, -5848, -5824, -5789, -5765, -5734, -5677, -5607, -5542, -5461, -5348, -5221, -5107, -5003, -4877, -4717, -4544, -4374, -4200, -4015, -3830, -3662, -3501, -3329, -3143, -2957, -2787, -2628, -2472, -2311, -2141, -1969, -1810, -1669, -1544, -1424, -1309, -1199, -1094, -998, -922, -869, -817, -749, -685, -657, -657, -653, -640, -648, -676, -699, -716, -752, -810, -862, -904, -959, -1031, -1102, -1166, -1235, -1312, -1384, -1450, -1527, -1618, -1702, -1757, -1799, -1855, -1924, -1986, -2029, -2059, -2085, -2111, -2132, -2140, -2144, -2157, -2176, -2183, -2172, -2161, -2164, -2172, -2164, -2142, -2122, -2106, -2083, -2053, -2030, -2018, -2002, -1972, -1950, -1952, -1965, -1964, -1948, -1932, -1928, -1932, -1937, -1943, -1950, -1950, -1938, -1926, -1939, -1968, -1992, -2001, -2012, -2038, -2065, -2074, -2078, -2091, -2106, -2105, -2093, -2087, -2093, -2093, -2074, -2046, -2021, -2003, -1990, -1967, -1922, -1862, -1812, -1775, -1727, -1661, -1599, -1542, -1462, -1351, -1242, -1163, -1099, -1020, -920, -822, -728, -631, -528, -432, -336, -230, -114, -7, 88, 175, 249, 329, 429, 526, 586, 629, 701, 801, 895, 970, 1031, 1066, 1087, 1135, 1213, 1267, 1271, 1268, 1290, 1321, 1334, 1348, 1383, 1424, 1440, 1439, 1443, 1448, 1438, 1422, 1419, 1417, 1398, 1379, 1376, 1365, 1315, 1263, 1258, 1290, 1296, 1258, 1220, 1206, 1181, 1130, 1103, 1120, 1123, 1063, 990, 982, 1022, 1031, 988, 950, 943, 930, 886, 851, 858, 876, 869, 841, 819, 807, 803, 809, 819, 814, 792, 777, 785, 797, 781, 747, 734, 756, 782, 784, 769, 761, 763, 765, 769, 777, 778, 756, 719, 692, 685, 686, 679, 659, 633, 614, 611, 618, 614, 594, 567, 547, 530, 510, 489, 487, 509, 527, 509, 480, 494, 549, 577, 546, 510, 524, 570, 608, 634, 653, 655, 644, 648, 679, 720, 741, 730, 707, 715, 767, 824, 828, 781, 738, 739, 759, 750, 714, 688, 693, 703, 690, 664, 655, 655, 637, 603, 572, 547, 506, 462, 445, 446, 419, 354, 311, 333, 373, 364, 319, 305, 342, 370, 353, 324, 323, 349, 384, 412, 428, 432, 439, 472, 529, 589, 633, 656, 668, 681, 714, 758, 787, 785, 781, 812, 867, 900, 904, 917, 961, 1010, 1035, 1045, 1059, 1073, 1073, 1063, 1059, 1050, 1037, 1034, 1048, 1043, 1017, 1017, 1054, 1073, 1041, 988, 944, 902, 861, 822, 760, 673, 591, 527, 459, 394, 351, 297, 183, 47, -44, -102, -177, -268, -353, -455, -595, -743, -855, -945, -1053, -1186, -1313, -1421, -1515, -1590, -1625, -1620, -1595, -1562, -1532, -1530, -1567, -1606, -1585, -1494, -1379, -1284, -1216, -1143, -1025, -833, -593, -359, -168, 9, 227, 494, 778, 1052, 1321, 1589, 1861, 2149, 2457, 2758, 3050, 3357, 3672, 3964, 4237, 4535, 4847, 5115, 5342, 5590, 5869, 6127, 6348, 6570, 6808, 7023, 7196, 7364, 7562, 7766, 7920, 8025, 8110, 8196, 8271, 8322, 8363, 8404, 8443, 8468, 8476, 8475, 8469, 8441, 8365, 8255, 8153, 8076, 7976, 7808, 7589, 7394, 7236, 7058, 6832, 6606, 6415, 6217, 5979, 5726, 5467, 5176, 4863, 4575, 4295, 3973, 3626, 3304, 3005, 2699, 2399, 2117, 1830, 1520, 1218, 948, 682, 388, 80, -210, -481, -757, -1029, -1283, -1521, -1757, -1983, -2170, -2335, -2507, -2688, -2864, -3040, -3225, -3400, -3541, -3657, -3775, -3897, -4011, -4107, -4188, -4257, -4322, -4405, -4504, -4584, -4612, -4623, -4672, -4754, -4812, -4838, -4865, -4920, -4980, -5014, -5010, -4984, -4959, -4944, -4937, -4921, -4898, -4871, -4838, -4787, -4727, -4680, -4654, -4616, -4547, -4471, -4411, -4358, -4289, -4224, -4177, -4126, -4047, -3956, -3878, -3817, -3761, -3702, -3623, -3523, -3426, -3361, -3321, -3274, -3198, -3108, -3032, -2980, -2940, -2889, -2833, -2783, -2745, -2699, -2645, -2600, -2571, -2537, -2487, -2440, -2423, -2425, -2408, -2370, -2355, -2392, -2446, -2481, -2495, -2525, -2579, -2645, -2700, -2747, -2808, -2890, -2967, -3019, -3084, -3195, -3316, -3398, -3472, -3596, -3744, -3856, -3929, -4021, -4137, -4224, -4259, -4289, -4356, -4439, -4486, -4499, -4517, -4561, -4602, -4616, -4618, -4631, -4644, -4629, -4584, -4540, -4513, -4473, -4395, -4305, -4253, -4224, -4174, -4086, -4002, -3949, -3892, -3801, -3703, -3640, -3591, -3503, -3378, -3272, -3207, -3144, -3055, -2965, -2897, -2833, -2753, -2667, -2593, -2517, -2423, -2322, -2242, -2168, -2077, -1970, -1869, -1770, -1666, -1567, -1486, -1408, -1314, -1202, -1086, -980, -895, -811, -687, -529, -385, -270, -146, 5, 153, 284, 426, 574, 702, 810, 936, 1088, 1237, 1361, 1487, 1635, 1790, 1923, 2027, 2117, 2201, 2280, 2357, 2422, 2466, 2495, 2524, 2550, 2560, 2563, 2579, 2597, 2595, 2568, 2535, 2502, 2469, 2431, 2378, 2301, 2215, 2135, 2054, 1969, 1900, 1859, 1813, 1728, 1621, 1533, 1465, 1376, 1253, 1126, 1016, 904, 775, 645, 537, 441, 339, 235, 148, 77, 0, -88, -172, -241, -303, -371, -444, -511, -564, -611, -659, -707, -752, -788, -809, -808, -791, -782, -790, -799, -773, -709, -642, -613, -620, -620, -573, -484, -391, -319, -256, -175, -69, 44, 147, 238, 336, 448, 551, 633, 717, 816, 910, 970, 1025, 1100, 1168, 1187, 1191, 1244, 1344, 1403, 1382, 1340, 1345, 1381, 1394, 1385, 1399, 1436, 1452, 1433, 1419, 1438, 1460, 1450, 1423, 1419, 1446, 1465, 1448, 1410, 1376, 1352, 1325, 1302, 1308, 1348, 1389, 1396, 1384, 1387, 1396, 1382, 1362, 1369, 1382, 1356, 1315, 1314, 1332, 1294, 1204, 1139, 1129, 1119, 1071, 1016, 985, 963, 910, 839, 797, 789, 766, 689, 595, 541, 521, 478, 391, 313, 292, 290, 238, 150, 105, 108, 83, 6, -46, -27, 11, 7, -20, -29, -9, 27, 84, 151, 194, 188, 169, 201, 285, 344, 319, 261, 270, 352, 408, 383, 347, 393, 506, 606, 658, 702, 769, 837, 887, 939, 1019, 1113, 1191, 1252, 1316, 1381, 1427, 1452, 1474, 1512, 1553, 1570, 1555, 1528, 1509, 1485, 1431, 1335, 1213, 1071, 903, 708, 507, 323, 147, -40, -235, -412, -568, -724, -891, -1067, -1257, -1467, -1693, -1913, -2126, -2347, -2570, -2763, -2896, -2967, -2974, -2913, -2799, -2667, -2537, -2403, -2266, -2132, -1991, -1836, -1678, -1502, -1258, -915, -523, -132, 278, 747, 1268, 1806, 2361, 2946, 3539, 4084, 4580, 5089, 5631, 6170, 6686, 7212, 7772, 8349, 8925, 9483, 10004, 10476, 10931, 11384, 11814, 12191, 12526, 12840, 13129, 13369, 13544, 13673, 13789, 13927, 14068, 14168, 14188, 14160, 14146, 14134, 14041, 13825, 13569, 13340, 13112, 12830, 12504, 12180, 11848, 11480, 11083, 10677, 10259, 9808, 9319, 8794, 8250, 7695, 7155, 6632, 6116, 5594, 5071, 4548, 4022, 3514, 3030, 2540, 2000, 1434, 912, 441, -37, -533, -1006, -1437, -1856, -2251, -2589, -2882, -3183, -3500, -3792, -4038, -4273, -4529, -4796, -5046, -5287, -5533, -5765, -5950, -6092, -6210, -6314, -6397, -6452, -6481, -6505, -6558, -6641, -6719, -6766, -6794, -6817, -6831, -6839, -6847, -6837, -6791, -6725, -6678, -6649, -6605, -6520, -6406, -6297, -6207, -6131, -6057, -5981, -5896, -5808, -5727, -5648, -5552, -5426, -5279, -5120, -4951, -4757, -4548, -4355, -4193, -4037, -3859, -3660, -3464, -3275, -3072, -2853, -2640, -2441, -2226, -1978, -1730, -1516, -1315, -1090, -851, -651, -506, -371, -203, -20, 137, 251, 330, 394, 454, 519, 580, 611, 603, 575, 546, 504, 417, 273, 86, -99, -263, -433, -642, -890, -1145, -1402, -1673, -1959, -2251, -2554, -2883, -3242, -3617, -3992, -4362, -4722, -5068, -5403, -5740, -6074, -6395, -6700, -6998, -7294, -7591, -7902, -8221, -8502, -8710, -8876, -9070, -9285, -9448, -9516, -9528, -9557, -9610, -9629, -9584, -9514, -9474, -9448, -9368, -9233, -9112, -9036, -8929, -8738, -8505, -8303, -8119, -7889, -7604, -7331, -7102, -6876, -6603, -6314, -6070, -5867, -5646, -5378, -5107, -4865, -4633, -4377, -4103, -3847, -3616, -3383, -3144, -2928, -2735, -2519, -2272, -2055, -1907, -1781, -1615, -1428, -1270, -1130, -962, -769, -598, -473, -364, -228, -68, 83, 202, 289, 357, 418, 501, 637, 805, 932, 989, 1043, 1168, 1347, 1502, 1599, 1690, 1845, 2061, 2277, 2420, 2481, 2514, 2593, 2735, 2899, 3021, 3087, 3121, 3153, 3219, 3334, 3457, 3517, 3491, 3439, 3416, 3425, 3444, 3455, 3419, 3288, 3092, 2912, 2812, 2785, 2768, 2672, 2441, 2130, 1878, 1760, 1717, 1638, 1456, 1184, 889, 641, 472, 338, 176, -21, -208, -358, -511, -699, -893, -1057, -1211, -1376, -1528, -1645, -1759, -1897, -2041, -2148, -2204, -2235, -2275, -2334, -2387, -2402, -2379, -2353, -2345, -2334, -2292, -2226, -2161, -2092, -1977, -1806, -1631, -1521, -1458, -1346, -1121, -836, -606, -469, -355, -178, 51, 274, 475, 698, 958, 1200, 1380, 1534, 1729, 1972, 2210, 2417, 2613, 2809, 2982, 3121, 3261, 3432, 3598, 3714, 3792, 3890, 4034, 4177, 4280, 4349, 4413, 4474, 4513, 4531, 4536, 4534, 4516, 4490, 4462, 4420, 4340, 4235, 4150, 4098, 4027, 3888, 3706, 3561, 3485, 3415, 3296, 3148, 3043, 2994, 2931, 2799, 2639, 2536, 2514, 2504, 2435, 2310, 2180, 2074, 1999, 1957, 1935, 1877, 1746, 1609, 1574, 1660, 1751, 1734, 1620, 1508, 1444, 1382, 1264, 1103, 958, 866, 805, 727, 628, 561, 561, 566, 479, 302, 140, 74, 71, 37, -89, -305, -536, -696, -756, -763, -801, -921, -1101, -1241, -1243, -1118, -1003, -1027, -1169, -1269, -1206, -1025, -894, -930, -1066, -1147, -1107, -1031, -1014, -1018, -933, -748, -589, -558, -599, -573, -410, -173, 20, 110, 142, 220, 400, 609, 736, 781, 860, 1048, 1286, 1470, 1574, 1659, 1782, 1955, 2160, 2363, 2523, 2628, 2722, 2837, 2953, 3029, 3061, 3082, 3114, 3169, 3223, 3216, 3122, 2999, 2913, 2838, 2695, 2485, 2285, 2133, 1967, 1736, 1472, 1227, 963, 620, 212, -211, -645, -1112, -1589, -2028, -2432, -2852, -3312, -3772, -4147, -4395, -4582, -4796, -5024, -5170, -5183, -5125, -5058, -4997, -4949, -4921, -4879, -4749, -4501, -4180, -3834, -3447, -2982, -2436, -1815, -1105, -326, 433, 1109, 1741, 2407, 3125, 3852, 4568, 5268, 5948, 6619, 7332, 8123, 8968, 9804, 10573, 11252, 11823, 12311, 12771, 13230, 13621, 13896, 14111, 14353, 14600, 14767, 14841, 14894, 14967, 15014, 14997, 14937, 14836, 14654, 14384, 14074, 13729, 13282, 12750, 12240, 11789, 11315, 10763, 10194, 9671, 9181, 8694, 8203, 7707, 7200, 6675, 6120, 5518, 4885, 4267, 3698, 3163, 2644, 2144, 1673, 1215, 768, 375, 55, -257, -626, -1010, -1350, -1664, -2008, -2370, -2723, -3078, -3417, -3693, -3925, -4169, -4405, -4574, -4704, -4861, -5024, -5148, -5265, -5423, -5599, -5753, -5918, -6136, -6355, -6484, -6532, -6603, -6729, -6844, -6914, -6958, -6966, -6893, -6790, -6754, -6780, -6809, -6831, -6845, -6808, -6733, -6712, -6752, -6747, -6651, -6508, -6332, -6086, -5823, -5633, -5486, -5265, -4938, -4613, -4382, -4205, -3987, -3690, -3331, -2933, -2560, -2263, -1980, -1584, -1085, -620, -243, 127, 548, 981, 1385, 1749, 2044, 2276, 2525, 2828, 3123, 3342, 3495, 3629, 3768, 3908, 4029, 4095, 4091, 4048, 3996, 3913, 3755, 3524, 3281, 3040, 2752, 2380, 1959, 1534, 1100, 645, 165, -361, -938, -1503, -1992, -2453, -3000, -3642, -4295, -4900, -5493, -6099, -6695, -7254, -7806, -8398, -9002, -9546, -9982, -10351, -10725, -11118, -11481, -11777, -12019, -12232, -12425, -12597, -12761, -12924, -13039, -13062, -12991, -12893, -12816, -12724, -12550, -12275, -11966, -11686, -11439, -11160, -10812, -10419, -10041, -9701, -9374, -9026, -8657, -8283, -7896, -7489, -7066, -6649, -6237, -5819, -5428, -5093, -4792, -4487, -4194, -3937, -3691, -3440, -3230, -3077, -2903, -2659, -2408, -2232, -2108, -1964, -1779, -1598, -1480, -1435, -1419, -1375, -1309, -1276, -1294, -1302, -1229, -1084, -939, -859, -838, -811, -717, -568, -441, -405, -434, -447, -389, -289, -208, -161, -122, -61, 30, 172, 365, 557, 671, 697, 723, 832, 988, 1087, 1086, 1044, 1038, 1083, 1151, 1215, 1257, 1253, 1208, 1175, 1223, 1347, 1438, 1401, 1261, 1116, 996, 834, 604, 376, 238, 174, 102, -24, -167, -276, -348, -411, -476, -551, -680, -894, -1122, -1264, -1327, -1436, -1642, -1840, -1927, -1930, -1916, -1858, -1705, -1523, -1441, -1479, -1524, -1503, -1456, -1414, -1325, -1169, -1032, -1001, -1009, -905, -615, -230, 99, 299, 417, 528, 663, 831, 1030, 1206, 1274, 1244, 1252, 1416, 1689, 1941, 2120, 2277, 2448, 2603, 2724, 2844, 2993, 3129, 3181, 3150, 3123, 3163, 3248, 3326, 3391, 3470, 3567, 3656, 3729, 3799, 3855, 3844, 3755, 3662, 3645, 3683, 3686, 3621, 3544, 3509, 3503, 3491, 3471, 3459, 3443, 3385, 3288, 3203, 3165, 3120, 3006, 2863, 2784, 2748, 2649, 2481, 2351, 2306, 2268, 2173, 2059, 1990, 1973, 1983, 1993, 1970, 1898, 1790, 1688, 1632, 1627, 1622, 1570, 1483, 1423, 1416, 1419, 1397, 1362, 1337, 1315, 1285, 1257, 1252, 1269, 1284, 1270, 1216, 1128, 1034, 973, 954, 950, 926, 888, 871, 900, 964, 1029, 1081, 1122, 1168, 1200, 1201, 1187, 1214, 1295, 1388, 1442, 1490, 1592, 1760, 1947, 2108, 2231, 2332, 2424, 2517, 2613, 2697, 2749, 2773, 2797, 2847, 2905, 2932, 2932, 2950, 3017, 3102, 3154, 3148, 3101, 3062, 3086, 3171, 3241, 3231, 3183, 3201, 3301, 3391, 3372, 3256, 3150, 3153, 3257, 3347, 3333, 3241, 3186, 3231, 3336, 3428, 3479, 3483, 3413, 3280, 3185, 3213, 3311, 3336, 3219, 3014, 2804, 2641, 2526, 2421, 2278, 2081, 1839, 1538, 1163, 787, 550, 496, 460, 227, -205, -603, -763, -744, -779, -993, -1315, -1611, -1818, -1936, -1985, -2040, -2216, -2532, -2819, -2883, -2742, -2624, -2685, -2823, -2843, -2731, -2668, -2773, -2948, -3028, -2989, -2934, -2939, -2980, -2988, -2885, -2640, -2322, -2087, -1996, -1922, -1705, -1407, -1229, -1188, -1087, -855, -674, -625, -490, -91, 395, 675, 751, 886, 1196, 1529, 1731, 1849, 1981, 2101, 2139, 2148, 2241, 2399, 2483, 2422, 2314, 2284, 2321, 2300, 2170, 2039, 2042, 2122, 2049, 1679, 1181, 863, 792, 710, 380, -114, -532, -815, -1124, -1593, -2154, -2650, -3030, -3365, -3730, -4101, -4375, -4462, -4339, -4080, -3847, -3770, -3816, -3801, -3617, -3357, -3179, -3075, -2881, -2485, -1927, -1265, -476, 435, 1355, 2208, 3049, 3923, 4740, 5400, 5989, 6666, 7418, 8083, 8617, 9194, 10008, 11002, 11916, 12606, 13185, 13838, 14533, 15053, 15289, 15371, 15497, 15674, 15747, 15633, 15436, 15291, 15227, 15164, 15019, 14739, 14339, 13889, 13436, 12951, 12351, 11622, 10808, 9947, 9065, 8195, 7361, 6564, 5804, 5109, 4481, 3830, 3071, 2261, 1534, 914, 249, -558, -1425, -2191, -2774, -3195, -3538, -3902, -4299, -4643, -4844, -4938, -5040, -5194, -5336, -5401, -5410, -5425, -5457, -5465, -5428, -5341, -5205, -5032, -4876, -4781, -4680, -4451, -4074, -3724, -3583, -3626, -3657, -3524, -3262, -3049, -3027, -3152, -3248, -3218, -3144, -3123, -3139, -3150, -3190, -3289, -3409, -3523, -3643, -3758, -3842, -3935, -4126, -4414, -4675, -4804, -4844, -4920, -5075, -5246, -5358, -5384, -5319, -5210, -5130, -5115, -5137, -5160, -5147, -5028, -4791, -4550, -4402, -4276, -4064, -3784, -3500, -3182, -2809, -2461, -2198, -1936, -1575, -1172, -859, -639, -398, -104, 147, 291, 392, 513, 633, 726, 817, 899, 891, 764, 608, 493, 352, 80, -302, -676, -1014, -1401, -1892, -2441, -2998, -3578, -4201, -4823, -5404, -5969, -6553, -7143, -7723, -8321, -8936, -9501, -9975, -10422, -10900, -11384, -11843, -12299, -12737, -13078, -13278, -13408, -13545, -13657, -13683, -13612, -13482, -13291, -13038, -12796, -12607, -12385, -12005, -11499, -11014, -10604, -10175, -9646, -9056, -8449, -7789, -7057, -6336, -5704, -5116, -4505, -3881, -3290, -2714, -2154, -1655, -1225, -796, -333, 132, 564, 935, 1201, 1368, 1519, 1703, 1864, 1919, 1867, 1754, 1605, 1424, 1257, 1123, 974, 742, 451, 179, -68, -378, -776, -1160, -1463, -1769, -2213, -2769, -3250, -3542, -3751, -4059, -4487, -4878, -5106, -5218, -5340, -5512, -5697, -5849, -5947, -5979, -5949, -5905, -5868, -5794, -5635, -5420, -5206, -4969, -4642, -4277, -4005, -3823, -3582, -3208, -2773, -2352, -1953, -1613, -1370, -1153, -828, -388, 16, 266, 433, 671, 1023, 1379, 1621, 1752, 1886, 2119, 2386, 2508, 2423, 2320, 2387, 2533, 2547, 2423, 2342, 2361, 2381, 2355, 2341, 2348, 2305, 2208, 2139, 2114, 2038, 1880, 1752, 1734, 1731, 1629, 1489, 1467, 1597, 1782, 1906, 1934, 1905, 1914, 2017, 2185, 2321, 2373, 2386, 2450, 2606, 2843, 3106, 3333, 3490, 3632, 3848, 4116, 4325, 4445, 4562, 4731, 4892, 4991, 5061, 5144, 5226, 5281, 5308, 5329, 5357, 5399, 5451, 5478, 5457, 5409, 5388, 5381, 5315, 5184, 5062, 4968, 4827, 4613, 4396, 4231, 4101, 3994, 3915, 3833, 3707, 3563, 3448, 3363, 3273, 3142, 2955, 2734, 2546, 2420, 2292, 2073, 1804, 1652, 1695, 1799, 1787, 1667, 1590, 1624, 1701, 1722, 1621, 1405, 1195, 1138, 1212, 1256, 1224, 1226, 1331, 1496, 1680, 1870, 2021, 2087, 2098, 2108, 2103, 2055, 1996, 1989, 2033, 2083, 2157, 2314, 2537, 2735, 2879, 3007, 3097, 3070, 2939, 2803, 2699, 2579, 2444, 2354, 2317, 2279, 2224, 2231, 2377, 2603, 2734, 2636, 2376, 2190, 2228, 2309, 2073, 1478, 978, 983, 1305, 1431, 1257, 1162, 1382, 1666, 1668, 1417, 1180, 1085, 1064, 1027, 870, 496, 43, -104, 200, 581, 624, 421, 354, 485, 544, 400, 223, 139, 25, -218, -414, -359, -183, -195, -411, -507, -308, -72, -150, -486, -704, -654, -631, -925, -1350, -1443, -1113, -814, -976, -1419, -1579, -1239, -829, -891, -1384, -1759, -1668, -1384, -1354, -1592, -1737, -1578, -1275, -1057, -962, -880, -721, -473, -199, -25, -13, -40, 94, 386, 574, 494, 347, 465, 857, 1214, 1360, 1458, 1656, 1827, 1798, 1664, 1606, 1528, 1198, 736, 577, 791, 896, 629, 410, 588, 802, 604, 188, -72, -314, -862, -1664, -2477, -3255, -4018, -4628, -4978, -5178, -5378, -5531, -5478, -5163, -4621, -3890, -3162, -2772, -2796, -2851, -2590, -2138, -1724, -1241, -490, 494, 1621, 2949, 4517, 6264, 8108, 9909, 11383, 12328, 12912, 13515, 14344, 15279, 16076, 16649, 17199, 18013, 19164, 20433, 21585, 22528, 23203, 23459, 23241, 22795, 22427, 22065, 21334, 20128, 18845, 17886, 17184, 16488, 15763, 15112, 14473, 13646, 12543, 11226, 9768, 8216, 6613, 4968, 3217, 1375, -319, -1613, -2518, -3247, -3897, -4445, -4921, -5391, -5822, -6188, -6579, -7072, -7619, -8128, -8539, -8763, -8714, -8422, -8000, -7476, -6773, -5894, -4998, -4215, -3497, -2780, -2161, -1743, -1413, -985, -485, -69, 232, 539, 988, 1635, 2361, 2931, 3255, 3490, 3723, 3771, 3483, 3020, 2626, 2300, 1894, 1349, 720, 115, -336, -596, -816, -1229, -1856, -2471, -2910, -3290, -3813, -4472, -5112, -5690, -6255, -6775, -7157, -7381, -7493, -7530, -7547, -7566, -7492, -7240, -6909, -6655, -6474, -6312, -6182, -6051, -5766, -5289, -4795, -4404, -4011, -3475, -2851, -2293, -1847, -1457, -1122, -901, -785, -681, -555, -461, -438, -457, -502, -626, -864, -1176, -1510, -1872, -2331, -2945, -3705, -4502, -5212, -5793, -6349, -7010, -7777, -8519, -9135, -9673, -10232, -10823, -11400, -11989, -12647, -13314, -13833, -14178, -14463, -14732, -14873, -14828, -14681, -14487, -14203, -13830, -13461, -13162, -12903, -12617, -12256, -11801, -11283, -10761, -10227, -9616, -8882, -8070, -7250, -6442, -5642, -4895, -4277, -3802, -3425, -3114, -2814, -2455, -2068, -1792, -1658, -1499, -1198, -847, -574, -396, -310, -359, -519, -695, -882, -1163, -1542, -1902, -2211, -2571, -2977, -3228, -3240, -3258, -3493, -3799, -3976, -4132, -4449, -4854, -5211, -5578, -6026, -6410, -6586, -6633, -6706, -6778, -6713, -6502, -6261, -6055, -5894, -5847, -5930, -5984, -5908, -5857, -5953, -5988, -5739, -5316, -4936, -4584, -4173, -3737, -3339, -3006, -2780, -2640, -2447, -2172, -1995, -2010, -2046, -1938, -1721, -1449, -1074, -607, -205, -6, 30, 70, 248, 566, 846, 834, 470, 87, 121, 549, 902, 945, 962, 1208, 1553, 1839, 2110, 2339, 2399, 2370, 2442, 2539, 2465, 2322, 2373, 2597, 2737, 2734, 2792, 3048, 3399, 3688, 3883, 4018, 4085, 4081, 4045, 3986, 3892, 3819, 3830, 3857, 3811, 3782, 3931, 4216, 4449, 4560, 4651, 4760, 4789, 4704, 4631, 4641, 4609, 4417, 4171, 4051, 4049, 4036, 3974, 3944, 3978, 4026, 4046, 4039, 3994, 3864, 3615, 3315, 3101, 3009, 2893, 2618, 2288, 2122, 2153, 2184, 2067, 1878, 1788, 1824, 1857, 1769, 1587, 1425, 1330, 1221, 1011, 750, 594, 618, 698, 672, 568, 540, 639, 798, 961, 1092, 1132, 1113, 1169, 1306, 1348, 1244, 1199, 1356, 1585, 1706, 1753, 1860, 2052, 2266, 2501, 2789, 3062, 3192, 3182, 3175, 3275, 3415, 3470, 3390, 3254, 3213, 3343, 3531, 3625, 3668, 3784, 3923, 3910, 3757, 3649, 3659, 3647, 3489, 3228, 2969, 2763, 2650, 2684, 2784, 2748, 2527, 2302, 2186, 2088, 1977, 1913, 1784, 1409, 956, 775, 835, 789, 537, 314, 283, 385, 504, 529, 341, 3, -143, 89, 304, -8, -593, -698, -287, -108, -425, -663, -487, -245, -154, -3, 273, 494, 658, 823, 762, 331, -47, 121, 581, 604, 138, -51, 422, 1043, 1334, 1503, 1739, 1815, 1704, 1651, 1518, 1015, 498, 542, 901, 892, 520, 380, 664, 981, 1025, 908, 875, 995, 1147, 1149, 899, 530, 371, 533, 660, 415, 57, 47, 335, 566, 690, 833, 930, 977, 1163, 1418, 1363, 940, 480, 111, -297, -663, -771, -696, -670, -698, -670, -599, -522, -410, -357, -589, -1181, -1973, -2830, -3819, -5004, -6215, -7179, -7834, -8285, -8530, -8423, -7903, -7070, -6041, -4918, -3804, -2813, -2057, -1636, -1501, -1337, -793, 189, 1441, 2929, 4894, 7463, 10359, 13150, 15666, 17969, 20034, 21709, 22947, 23776, 24214, 24351, 24453, 24749, 25200, 25668, 26191, 26889, 27619, 28034, 27992, 27619, 26927, 25718, 23997, 22026, 19945, 17757, 15686, 13995, 12536, 11044, 9690, 8761, 8059, 7136, 5876, 4411, 2689, 598, -1673, -3743, -5434, -6810, -7887, -8567, -8842, -8794, -8408, -7694, -6960, -6533, -6298, -5934, -5507, -5379, -5581, -5767, -5728, -5541, -5261, -4753, -3859, -2636, -1396, -442, 231, 859, 1496, 1909, 1939, 1698, 1354, 939, 474, 85, -124, -179, -154, -71, 55, 157, 147, -18, -324, -729, -1192, -1685, -2200, -2732, -3253, -3699, -4005, -4149, -4150, -4036, -3841, -3645, -3506, -3355, -3109, -2867, -2804, -2856, -2800, -2669, -2703, -2894, -2961, -2825, -2709, -2700, -2567, -2177, -1774, -1654, -1744, -1785, -1764, -1888, -2216, -2625, -3029, -3387, -3645, -3868, -4193, -4536, -4676, -4670, -4789, -5038, -5180, -5229, -5424, -5781, -6067, -6203, -6327, -6507, -6654, -6722, -6807, -6962, -7092, -7119, -7111, -7155, -7219, -7236, -7227, -7222, -7203, -7194, -7264, -7410, -7536, -7605, -7691, -7880, -8184, -8527, -8825, -9066, -9309, -9540, -9675, -9745, -9891, -10110, -10203, -10118, -10098, -10332, -10657, -10830, -10877, -10989, -11179, -11233, -11024, -10689, -10430, -10184, -9716, -8993, -8314, -7927, -7686, -7297, -6780, -6424, -6297, -6122, -5693, -5169, -4809, -4530, -4026, -3268, -2622, -2335, -2153, -1744, -1293, -1264, -1658, -1975, -1984, -2050, -2482, -2983, -3104, -2950, -2977, -3250, -3378, -3224, -3198, -3632, -4274, -4714, -5018, -5537, -6246, -6726, -6832, -6891, -7113, -7207, -6864, -6292, -5956, -5971, -6046, -5953, -5805, -5822, -6023, -6229, -6311, -6279, -6160, -5906, -5451, -4839, -4227, -3754, -3416, -3129, -2875, -2700, -2609, -2606, -2745, -2988, -3132, -3083, -2989, -2909, -2665, -2221, -1836, -1635, -1421, -1107, -899, -921, -1031, -1097, -1141, -1207, -1301, -1397, -1362, -987, -278, 427, 800, 907, 1109, 1591, 2142, 2418, 2329, 2078, 1904, 1886, 1981, 2143, 2388, 2730, 3071, 3252, 3251, 3269, 3499, 3865, 4059, 3874, 3449, 3136, 3131, 3249, 3180, 2905, 2690, 2662, 2684, 2668, 2721, 2903, 3091, 3156, 3116, 3068, 3092, 3182, 3185, 2948, 2570, 2365, 2481, 2701, 2774, 2775, 2955, 3332, 3668, 3855, 3996, 4126, 4112, 3943, 3783, 3712, 3630, 3490, 3365, 3299, 3280, 3328, 3459, 3630, 3763, 3793, 3696, 3576, 3563, 3563, 3334, 2901, 2619, 2650, 2735, 2639, 2525, 2663, 3021, 3343, 3492, 3592, 3838, 4189, 4344, 4150, 3864, 3807, 3905, 3874, 3755, 3846, 4147, 4293, 4168, 4177, 4595, 5017, 4897, 4385, 4068, 4054, 3882, 3340, 2775, 2535, 2517, 2426, 2198, 2046, 2130, 2285, 2239, 2054, 2026, 2092, 1845, 1237, 755, 686, 761, 690, 579, 613, 759, 934, 1153, 1436, 1764, 2125, 2443, 2545, 2383, 2199, 2258, 2447, 2400, 2084, 1913, 2124, 2398, 2364, 2192, 2288, 2598, 2642, 2211, 1708, 1615, 1791, 1633, 957, 345, 292, 445, 187, -335, -447, -72, 149, -117, -421, -239, 291, 658, 681, 644, 772, 895, 817, 770, 1126, 1780, 2277, 2555, 3006, 3730, 4291, 4472, 4754, 5549, 6363, 6339, 5550, 5020, 5314, 5760, 5477, 4686, 4363, 4817, 5254, 4888, 4026, 3664, 4112, 4540, 4109, 3123, 2523, 2493, 2271, 1333, 160, -462, -437, -303, -441, -718, -862, -881, -948, -1099, -1186, -1131, -1115, -1484, -2368, -3405, -3988, -3887, -3487, -3301, -3393, -3406, -3077, -2572, -2277, -2347, -2579, -2723, -2827, -3147, -3808, -4721, -5759, -6842, -7813, -8394, -8465, -8192, -7813, -7335, -6573, -5432, -3981, -2316, -578, 910, 1793, 2136, 2503, 3398, 4721, 6109, 7579, 9523, 12082, 14923, 17680, 20234, 22521, 24360, 25638, 26461, 26953, 27069, 26766, 26233, 25801, 25635, 25689, 25897, 26178, 26349, 26136, 25419, 24302, 22875, 21067, 18782, 16175, 13576, 11182, 8916, 6698, 4711, 3239, 2317, 1597, 723, -297, -1211, -2009, -2993, -4302, -5677, -6819, -7765, -8647, -9348, -9614, -9376, -8785, -8041, -7270, -6539, -5853, -5180, -4508, -3883, -3378, -3040, -2914, -3004, -3165, -3173, -2957, -2648, -2317, -1922, -1553, -1384, -1322, -1086, -707, -556, -787, -1145, -1427, -1779, -2351, -2952, -3307, -3450, -3582, -3672, -3515, -3126, -2749, -2470, -2142, -1712, -1361, -1235, -1250, -1269, -1307, -1425, -1553, -1562, -1453, -1333, -1196, -920, -473, 6, 332, 421, 307, 47, -350, -903, -1575, -2328, -3183, -4117, -4922, -5397, -5610, -5790, -6001, -6158, -6302, -6572, -6918, -7140, -7240, -7473, -7921, -8297, -8389, -8388, -8509, -8552, -8206, -7584, -7063, -6685, -6164, -5428, -4758, -4319, -3926, -3433, -3050, -3018, -3194, -3250, -3193, -3318, -3708, -4077, -4201, -4221, -4364, -4591, -4733, -4855, -5233, -5957, -6811, -7588, -8350, -9255, -10256, -11150, -11848, -12460, -13042, -13422, -13469, -13353, -13331, -13353, -13190, -12892, -12782, -12943, -13060, -12901, -12651, -12531, -12344, -11746, -10803, -9890, -9090, -8117, -6891, -5745, -4965, -4441, -3935, -3470, -3231, -3241, -3348, -3428, -3441, -3359, -3189, -3006, -2807, -2521, -2248, -2253, -2563, -2835, -2885, -3041, -3650, -4439, -4849, -4874, -5053, -5538, -5787, -5452, -4977, -4896, -4971, -4625, -3956, -3667, -4000, -4373, -4285, -4033, -4161, -4563, -4677, -4363, -4072, -4084, -4058, -3575, -2793, -2252, -2185, -2315, -2354, -2388, -2661, -3187, -3774, -4274, -4635, -4843, -4947, -5035, -5073, -4950, -4718, -4542, -4390, -4132, -3897, -3973, -4342, -4657, -4704, -4568, -4310, -3843, -3208, -2685, -2383, -1957, -1026, 220, 1200, 1645, 1862, 2225, 2723, 3083, 3207, 3283, 3535, 3974, 4429, 4750, 4935, 5107, 5335, 5560, 5746, 5957, 6109, 5891, 5222, 4509, 4114, 3845, 3365, 2815, 2566, 2590, 2534, 2321, 2222, 2341, 2444, 2365, 2243, 2189, 2093, 1898, 1766, 1756, 1711, 1628, 1780, 2252, 2714, 2896, 3003, 3374, 3915, 4291, 4480, 4742, 5061, 5123, 4891, 4744, 4861, 4921, 4650, 4331, 4410, 4808, 5048, 4974, 4895, 4992, 5000, 4678, 4208, 3921, 3835, 3651, 3187, 2661, 2443, 2538, 2616, 2586, 2745, 3131, 3315, 3121, 3012, 3327, 3693, 3651, 3393, 3406, 3737, 4033, 4092, 4084, 4218, 4440, 4542, 4506, 4556, 4783, 4970, 4961, 4941, 5075, 5177, 5013, 4666, 4327, 4018, 3716, 3456, 3194, 2889, 2692, 2735, 2811, 2638, 2311, 2117, 2032, 1778, 1315, 944, 867, 889, 718, 429, 394, 720, 1043, 1079, 1095, 1491, 2076, 2263, 1967, 1816, 2192, 2566, 2301, 1759, 1815, 2461, 2763, 2361, 2067, 2576, 3389, 3607, 3256, 3085, 3289, 3267, 2667, 1968, 1704, 1704, 1515, 1185, 1122, 1357, 1487, 1335, 1149, 1104, 1072, 976, 909, 829, 575, 284, 343, 846, 1449, 1811, 1928, 2070, 2452, 2932, 3105, 2865, 2656, 2873, 3306, 3523, 3507, 3556, 3772, 4023, 4267, 4555, 4797, 4795, 4482, 3955, 3287, 2551, 1969, 1766, 1807, 1662, 1206, 881, 1016, 1183, 828, 344, 632, 1518, 1682, 536, -908, -1526, -1507, -1641, -1981, -1956, -1406, -860, -789, -979, -859, -368, -119, -569, -1410, -2103, -2622, -3217, -3800, -4040, -3928, -3727, -3495, -3054, -2460, -2108, -2245, -2629, -2860, -2913, -3094, -3524, -3953, -4193, -4462, -5043, -5819, -6477, -6943, -7312, -7531, -7489, -7149, -6411, -5110, -3380, -1527, 387, 2411, 4275, 5680, 6796, 7978, 9178, 10197, 11266, 12833, 14916, 17114, 19172, 21167, 23108, 24745, 25898, 26654, 27092, 27118, 26683, 25987, 25212, 24415, 23732, 23367, 23234, 22888, 22018, 20781, 19498, 18193, 16624, 14701, 12622, 10560, 8482, 6396, 4553, 3171, 2054, 922, -65, -562, -713, -982, -1442, -1821, -2113, -2570, -3167, -3704, -4200, -4722, -5066, -4999, -4645, -4350, -4337, -4489, -4397, -3788, -3007, -2678, -2824, -2952, -2954, -3209, -3718, -4023, -4012, -4042, -4251, -4409, -4421, -4406, -4391, -4297, -4104, -3828, -3495, -3183, -2957, -2781, -2628, -2557, -2535, -2399, -2109, -1843, -1708, -1532, -1130, -595, -157, 148, 485, 904, 1194, 1154, 889, 648, 420, -59, -861, -1665, -2168, -2495, -2966, -3611, -4163, -4487, -4765, -5153, -5592, -6050, -6666, -7461, -8190, -8721, -9228, -9776, -10112, -10071, -9871, -9728, -9492, -8958, -8284, -7783, -7426, -6897, -6119, -5423, -5089, -4940, -4629, -4147, -3737, -3403, -2940, -2451, -2281, -2358, -2225, -1824, -1620, -1831, -2165, -2472, -3002, -3863, -4773, -5554, -6419, -7493, -8475, -9033, -9308, -9694, -10221, -10575, -10683, -10889, -11379, -11866, -12077, -12212, -12615, -13144, -13350, -13151, -12928, -12879, -12700, -12125, -11394, -10881, -10525, -10048, -9527, -9299, -9340, -9284, -8998, -8733, -8653, -8602, -8429, -8191, -7904, -7423, -6780, -6324, -6237, -6206, -5879, -5444, -5330, -5541, -5694, -5570, -5312, -5144, -5093, -4971, -4601, -4083, -3678, -3391, -2992, -2477, -2136, -2011, -1777, -1320, -985, -1021, -1165, -1072, -866, -943, -1332, -1580, -1372, -1045, -1166, -1675, -1965, -1897, -2013, -2529, -2985, -3200, -3633, -4423, -5028, -5228, -5459, -5882, -6031, -5675, -5246, -5093, -5018, -4809, -4699, -4934, -5245, -5170, -4743, -4448, -4502, -4594, -4413, -4037, -3552, -2754, -1641, -804, -733, -1020, -901, -306, 274, 589, 703, 642, 532, 679, 1105, 1442, 1540, 1705, 2136, 2561, 2651, 2464, 2290, 2268, 2288, 2204, 2036, 1945, 2034, 2227, 2346, 2320, 2292, 2470, 2861, 3221, 3323, 3223, 3146, 3187, 3240, 3233, 3229, 3268, 3281, 3278, 3392, 3632, 3785, 3677, 3388, 3148, 3168, 3466, 3773, 3756, 3457, 3278, 3414, 3630, 3682, 3645, 3666, 3698, 3624, 3469, 3391, 3532, 3866, 4205, 4405, 4534, 4695, 4811, 4790, 4746, 4818, 4900, 4821, 4641, 4558, 4612, 4684, 4724, 4788, 4905, 5016, 5040, 5001, 5035, 5160, 5161, 4876, 4500, 4299, 4172, 3882, 3534, 3403, 3410, 3238, 2905, 2777, 2997, 3274, 3313, 3195, 3141, 3106, 2833, 2308, 1879, 1781, 1768, 1523, 1216, 1259, 1654, 2037, 2242, 2377, 2445, 2349, 2197, 2211, 2352, 2364, 2189, 2045, 2100, 2272, 2399, 2451, 2479, 2482, 2467, 2477, 2500, 2467, 2419, 2446, 2512, 2514, 2463, 2410, 2362, 2378, 2514, 2582, 2355, 2018, 1959, 2132, 2162, 1986, 1873, 1912, 1971, 2034, 2146, 2187, 2027, 1803, 1817, 2163, 2557, 2553, 2052, 1534, 1534, 1925, 2107, 1871, 1610, 1637, 1799, 1895, 2000, 2193, 2310, 2173, 1899, 1777, 1928, 2196, 2360, 2373, 2334, 2342, 2483, 2858, 3400, 3739, 3592, 3168, 2878, 2741, 2537, 2346, 2408, 2535, 2276, 1721, 1522, 1887, 2129, 1704, 1135, 1156, 1482, 1322, 661, 109, -74, -3, 213, 343, 201, 154, 587, 1032, 887, 607, 975, 1657, 1710, 1054, 356, -60, -369, -665, -905, -1130, -1373, -1553, -1591, -1552, -1612, -1885, -2201, -2230, -2032, -2103, -2570, -2879, -2748, -2688, -3023, -3226, -2879, -2468, -2581, -3109, -3787, -4751, -5986, -6862, -6740, -5727, -4473, -3305, -1793, 713, 4132, 7477, 9833, 11234, 12355, 13563, 14644, 15334, 15719, 16034, 16434, 17125, 18480, 20595, 22939, 24722, 25570, 25660, 25346, 24929, 24515, 23902, 22776, 21152, 19401, 17879, 16746, 16072, 15721, 15263, 14394, 13191, 11880, 10550, 9292, 8194, 7146, 5917, 4512, 3145, 2030, 1307, 992, 820, 443, -50, -264, -106, 47, -71, -308, -488, -791, -1457, -2353, -3122, -3597, -3859, -4019, -4192, -4570, -5178, -5613, -5422, -4797, -4501, -4908, -5512, -5752, -5781, -5937, -6033, -5862, -5749, -5876, -5769, -5164, -4555, -4279, -3901, -3107, -2352, -2037, -1829, -1315, -787, -719, -917, -840, -520, -480, -807, -1046, -1071, -1336, -2050, -2757, -3059, -3225, -3713, -4439, -4965, -5188, -5415, -5834, -6331, -6786, -7192, -7510, -7736, -8043, -8581, -9169, -9451, -9340, -9083, -8923, -8865, -8786, -8610, -8305, -7856, -7352, -6972, -6790, -6710, -6648, -6613, -6616, -6635, -6651, -6599, -6418, -6159, -5923, -5673, -5336, -5056, -4983, -5004, -4961, -5015, -5384, -5921, -6265, -6294, -6137, -5913, -5684, -5555, -5548, -5479, -5184, -4843, -4860, -5356, -6019, -6503, -6795, -7058, -7333, -7566, -7796, -8072, -8307, -8396, -8460, -8722, -9164, -9601, -10014, -10491, -10951, -11260, -11552, -12013, -12486, -12672, -12579, -12436, -12304, -12081, -11774, -11511, -11271, -10905, -10439, -10075, -9810, -9405, -8792, -8172, -7639, -7089, -6523, -6015, -5456, -4716, -4023, -3708, -3697, -3651, -3519, -3548, -3760, -3857, -3781, -3886, -4293, -4549, -4317, -3907, -3734, -3665, -3366, -2911, -2620, -2594, -2709, -2847, -2974, -3101, -3251, -3397, -3455, -3375, -3099, -2601, -2059, -1774, -1701, -1447, -1000, -966, -1686, -2594, -2930, -2723, -2556, -2724, -3009, -3097, -2887, -2441, -1866, -1327, -1136, -1547, -2250, -2517, -2229, -2182, -2789, -3236, -2752, -1885, -1585, -1735, -1565, -872, -29, 679, 1133, 1227, 1101, 1138, 1494, 1903, 2011, 1799, 1656, 1952, 2450, 2542, 2286, 2475, 3271, 3697, 3212, 2720, 3145, 3962, 4091, 3483, 2954, 2983, 3291, 3354, 3003, 2586, 2528, 2739, 2834, 2795, 2931, 3197, 3263, 3193, 3397, 3883, 4161, 3988, 3715, 3748, 4003, 4095, 3894, 3715, 3859, 4194, 4398, 4516, 4883, 5484, 5855, 5733, 5403, 5201, 5047, 4752, 4424, 4273, 4211, 3996, 3692, 3638, 3931, 4253, 4308, 4168, 4032, 3901, 3649, 3295, 2982, 2768, 2595, 2430, 2321, 2300, 2357, 2496, 2719, 2928, 2988, 2898, 2809, 2850, 2979, 3062, 3037, 2940, 2836, 2774, 2791, 2879, 2992, 3099, 3152, 3053, 2800, 2610, 2638, 2678, 2449, 2067, 1871, 1905, 1947, 1936, 1999, 2122, 2126, 1983, 1879, 1949, 2083, 2089, 1950, 1845, 1868, 1913, 1887, 1911, 2072, 2182, 2040, 1805, 1752, 1852, 1873, 1747, 1538, 1311, 1224, 1424, 1739, 1845, 1760, 1752, 1842, 1827, 1695, 1596, 1506, 1284, 979, 777, 712, 647, 508, 361, 275, 260, 339, 536, 756, 808, 649, 452, 388, 434, 470, 423, 288, 109, 36, 252, 735, 1175, 1305, 1254, 1384, 1806, 2269, 2556, 2728, 2921, 3078, 3074, 2997, 3087, 3359, 3502, 3254, 2748, 2349, 2241, 2317, 2422, 2510, 2522, 2292, 1838, 1628, 2062, 2649, 2379, 1222, 399, 736, 1557, 1783, 1336, 926, 1004, 1478, 1994, 2164, 1848, 1404, 1358, 1709, 1893, 1567, 1110, 1029, 1205, 1112, 625, 109, -206, -498, -899, -1269, -1510, -1760, -2035, -2098, -1931, -1914, -2187, -2333, -2097, -1957, -2411, -3144, -3538, -3678, -4150, -4971, -5516, -5563, -5628, -5904, -5597, -3892, -1049, 1985, 4721, 7377, 10293, 13452, 16451, 18686, 19771, 19869, 19565, 19353, 19343, 19473, 19794, 20404, 21203, 21992, 22764, 23654, 24514, 24823, 24261, 23050, 21590, 19911, 17921, 15904, 14322, 13192, 12131, 10970, 9960, 9311, 8948, 8736, 8644, 8550, 8226, 7726, 7423, 7438, 7397, 7003, 6485, 6107, 5689, 5020, 4405, 4273, 4419, 4194, 3364, 2395, 1710, 1159, 396, -613, -1737, -3000, -4433, -5762, -6646, -7125, -7564, -8142, -8644, -8814, -8717, -8584, -8448, -8110, -7471, -6705, -6064, -5575, -5021, -4220, -3270, -2474, -2019, -1783, -1494, -1080, -725, -585, -593, -599, -584, -611, -735, -1014, -1528, -2251, -3055, -3886, -4836, -5937, -7012, -7854, -8471, -8989, -9368, -9440, -9184, -8743, -8195, -7511, -6775, -6181, -5787, -5468, -5166, -5006, -5091, -5310, -5466, -5524, -5583, -5694, -5806, -5831, -5695, -5413, -5150, -5081, -5174, -5291, -5507, -6026, -6837, -7663, -8316, -8858, -9389, -9862, -10139, -10147, -9867, -9308, -8562, -7815, -7200, -6668, -6109, -5475, -4809, -4229, -3899, -3839, -3796, -3512, -3108, -2931, -3069, -3282, -3442, -3728, -4299, -5006, -5606, -6136, -6857, -7852, -8891, -9740, -10412, -11069, -11783, -12488, -13065, -13465, -13699, -13794, -13760, -13654, -13532, -13312, -12861, -12228, -11617, -11075, -10475, -9811, -9241, -8797, -8395, -8046, -7802, -7583, -7322, -7123, -7069, -7057, -6971, -6823, -6644, -6483, -6442, -6463, -6338, -6118, -6108, -6328, -6463, -6439, -6420, -6329, -6045, -5836, -5851, -5603, -4698, -3559, -2711, -2006, -1124, -206, 464, 872, 1061, 1044, 902, 634, 106, -554, -959, -1019, -1023, -1061, -970, -851, -996, -1353, -1613, -1726, -1917, -2367, -3088, -3818, -4052, -3619, -3037, -2772, -2534, -1863, -938, -166, 451, 1002, 1317, 1330, 1263, 1222, 1105, 961, 926, 882, 630, 300, 190, 346, 555, 650, 637, 631, 699, 748, 591, 203, -167, -290, -291, -471, -766, -719, -145, 509, 793, 937, 1466, 2336, 2944, 2981, 2799, 2833, 3025, 3069, 2912, 2733, 2627, 2597, 2669, 2802, 2842, 2750, 2666, 2640, 2524, 2280, 2107, 2077, 1924, 1462, 1029, 1061, 1393, 1486, 1273, 1220, 1547, 1951, 2183, 2386, 2714, 3020, 3173, 3330, 3622, 3861, 3877, 3870, 4047, 4196, 4058, 3812, 3736, 3731, 3555, 3231, 2888, 2520, 2162, 1994, 2039, 2022, 1734, 1370, 1250, 1372, 1438, 1306, 1120, 1015, 978, 994, 1064, 1119, 1132, 1195, 1373, 1610, 1865, 2147, 2367, 2425, 2377, 2312, 2176, 1930, 1721, 1655, 1588, 1372, 1128, 1091, 1270, 1466, 1545, 1537, 1509, 1455, 1361, 1286, 1268, 1271, 1262, 1304, 1459, 1653, 1777, 1915, 2263, 2806, 3278, 3528, 3676, 3880, 4128, 4328, 4369, 4157, 3750, 3369, 3134, 2905, 2554, 2191, 1986, 1920, 1856, 1739, 1613, 1505, 1382, 1226, 1040, 816, 558, 305, 65, -192, -358, -250, 4, 34, -179, -212, 83, 346, 385, 435, 588, 573, 290, 6, -72, -31, -50, -245, -606, -917, -932, -665, -336, -85, 31, -29, -151, -49, 329, 636, 554, 209, -63, -156, -193, -213, -124, 88, 303, 474, 705, 1076, 1558, 2092, 2564, 2821, 2923, 3179, 3663, 4022, 4037, 3968, 4090, 4307, 4436, 4459, 4390, 4271, 4214, 4133, 3752, 3136, 2715, 2522, 2060, 1179, 334, -173, -547, -993, -1453, -1806, -1944, -1753, -1331, -955, -663, -210, 438, 973, 1182, 1193, 1128, 882, 306, -541, -1398, -1993, -2205, -2027, -1437, -341, 1341, 3595, 6283, 9180, 11966, 14330, 16094, 17274, 17989, 18304, 18231, 17817, 17207, 16566, 16071, 15942, 16298, 16968, 17654, 18228, 18700, 18981, 18947, 18642, 18148, 17452, 16576, 15703, 14965, 14303, 13677, 13189, 12858, 12517, 12060, 11656, 11496, 11486, 11343, 11009, 10671, 10443, 10207, 9842, 9354, 8773, 8069, 7265, 6505, 5882, 5333, 4738, 4088, 3478, 2957, 2444, 1813, 1026, 154, -735, -1637, -2536, -3344, -3934, -4275, -4475, -4685, -4911, -4963, -4702, -4311, -4109, -4115, -4089, -3941, -3776, -3600, -3397, -3354, -3591, -3887, -4064, -4331, -4873, -5498, -5982, -6352, -6642, -6798, -6891, -7017, -7049, -6847, -6591, -6534, -6632, -6709, -6799, -7049, -7439, -7806, -8056, -8179, -8141, -7896, -7494, -7046, -6546, -5910, -5177, -4564, -4207, -4053, -4013, -4121, -4460, -5009, -5593, -6020, -6284, -6570, -6973, -7301, -7350, -7183, -7006, -6877, -6747, -6649, -6632, -6630, -6567, -6506, -6550, -6652, -6664, -6516, -6256, -5947, -5594, -5193, -4767, -4356, -4005, -3769, -3652, -3559, -3389, -3230, -3305, -3629, -3864, -3774, -3630, -3857, -4417, -4944, -5356, -5891, -6612, -7294, -7825, -8337, -8882, -9283, -9440, -9497, -9574, -9572, -9443, -9363, -9395, -9344, -9112, -8901, -8809, -8685, -8511, -8516, -8730, -8876, -8853, -8922, -9259, -9665, -9842, -9801, -9791, -9930, -10076, -10089, -10014, -9961, -9908, -9766, -9605, -9529, -9449, -9166, -8705, -8246, -7813, -7304, -6762, -6298, -5900, -5506, -5161, -4882, -4566, -4196, -3881, -3608, -3198, -2618, -2078, -1745, -1513, -1202, -843, -626, -652, -829, -1025, -1173, -1248, -1250, -1231, -1249, -1284, -1275, -1222, -1184, -1192, -1214, -1211, -1189, -1184, -1203, -1189, -1052, -751, -367, -59, 96, 196, 369, 595, 750, 758, 641, 454, 269, 149, 61, -97, -361, -614, -721, -641, -465, -349, -376, -442, -337, -25, 275, 346, 239, 168, 182, 142, 24, -25, -1, -74, -237, -253, -49, 178, 318, 433, 528, 528, 502, 598, 784, 872, 801, 675, 557, 423, 352, 488, 738, 785, 531, 261, 200, 258, 313, 414, 550, 588, 527, 532, 633, 692, 660, 659, 769, 939, 1093, 1215, 1332, 1471, 1639, 1826, 2002, 2130, 2187, 2213, 2272, 2341, 2332, 2255, 2257, 2363, 2402, 2305, 2231, 2262, 2229, 2036, 1841, 1768, 1725, 1635, 1578, 1613, 1662, 1659, 1646, 1664, 1675, 1627, 1529, 1414, 1282, 1119, 937, 755, 588, 471, 429, 407, 322, 211, 191, 280, 362, 358, 293, 225, 201, 243, 299, 289, 235, 248, 370, 511, 601, 670, 780, 913, 1022, 1106, 1206, 1338, 1463, 1543, 1568, 1555, 1541, 1576, 1712, 1924, 2102, 2153, 2103, 2084, 2180, 2348, 2473, 2473, 2364, 2260, 2252, 2289, 2239, 2072, 1879, 1718, 1579, 1465, 1383, 1306, 1246, 1275, 1365, 1366, 1256, 1205, 1312, 1449, 1468, 1420, 1431, 1513, 1605, 1703, 1834, 1946, 1965, 1938, 1998, 2157, 2267, 2238, 2178, 2219, 2315, 2361, 2402, 2535, 2672, 2666, 2598, 2671, 2861, 2957, 2910, 2867, 2904, 2935, 2919, 2928, 3020, 3141, 3216, 3249, 3293, 3377, 3474, 3530, 3481, 3323, 3144, 3049, 3017, 2918, 2698, 2465, 2348, 2323, 2288, 2208, 2108, 1960, 1759, 1600, 1535, 1412, 1110, 764, 532, 330, 35, -245, -340, -286, -231, -198, -105, 88, 362, 653, 846, 834, 664, 514, 461, 368, 85, -291, -527, -515, -262, 245, 1012, 1907, 2776, 3619, 4514, 5428, 6225, 6829, 7294, 7690, 8000, 8157, 8187, 8256, 8493, 8846, 9187, 9521, 9955, 10493, 10985, 11299, 11460, 11556, 11620, 11650, 11672, 11696, 11641, 11439, 11175, 11040, 11101, 11226, 11269, 11260, 11332, 11542, 11825, 12095, 12309, 12430, 12449, 12384, 12255, 12033, 11695, 11302, 10940, 10652, 10424, 10273, 10228, 10254, 10268, 10232, 10177, 10095, 9915, 9606, 9217, 8776, 8284, 7771, 7289, 6840, 6423, 6108, 5939, 5846, 5723, 5543, 5333, 5114, 4911, 4738, 4563, 4289, 3872, 3366, 2845, 2322, 1742, 1085, 406, -202, -648, -895, -1041, -1250, -1552, -1827, -1996, -2143, -2350, -2648, -3115, -3829, -4712, -5564, -6282, -6877, -7371, -7769, -8085, -8285, -8317, -8214, -8089, -7981, -7876, -7795, -7778, -7818, -7919, -8149, -8540, -9000, -9414, -9761, -10066, -10285, -10355, -10325, -10289, -10225, -10028, -9726, -9473, -9317, -9184, -9098, -9169, -9397, -9640, -9801, -9900, -9954, -9919, -9779, -9577, -9337, -9037, -8653, -8217, -7775, -7358, -6981, -6659, -6377, -6122, -5946, -5916, -5999, -6063, -6047, -6010, -6049, -6167, -6292, -6355, -6337, -6260, -6152, -6044, -5984, -6024, -6158, -6317, -6462, -6615, -6812, -7047, -7280, -7452, -7509, -7485, -7489, -7546, -7533, -7384, -7203, -7083, -6986, -6898, -6922, -7111, -7344, -7493, -7563, -7644, -7797, -7990, -8103, -8043, -7846, -7642, -7472, -7284, -7061, -6884, -6806, -6778, -6762, -6812, -6985, -7223, -7413, -7526, -7579, -7540, -7410, -7285, -7207, -7055, -6725, -6308, -5962, -5725, -5569, -5505, -5515, -5526, -5525, -5578, -5719, -5878, -5974, -5988, -5909, -5685, -5338, -5013, -4842, -4776, -4663, -4455, -4223, -4023, -3855, -3732, -3666, -3602, -3456, -3201, -2898, -2628, -2410, -2172, -1855, -1514, -1294, -1268, -1327, -1291, -1095, -847, -675, -611, -607, -629, -639, -551, -289, 84, 411, 613, 767, 952, 1132, 1269, 1421, 1622, 1783, 1816, 1784, 1792, 1846, 1879, 1889, 1947, 2094, 2278, 2410, 2466, 2495, 2541, 2577, 2539, 2421, 2285, 2192, 2156, 2121, 2012, 1815, 1629, 1573, 1641, 1711, 1705, 1656, 1623, 1630, 1644, 1603, 1476, 1338, 1312, 1401, 1483, 1488, 1470, 1504, 1612, 1789, 1992, 2141, 2192, 2188, 2188, 2208, 2244, 2285, 2289, 2215, 2088, 1969, 1913, 1943, 2028, 2068, 1982, 1826, 1732, 1744, 1813, 1889, 1928, 1869, 1710, 1552, 1454, 1374, 1259, 1118, 979, 847, 736, 659, 607, 587, 614, 644, 604, 519, 471, 452, 386, 270, 179, 128, 63, -25, -82, -64, -1, 42, 22, -46, -102, -93, -40, 0, -7, -49, -95, -110, -66, 39, 156, 219, 244, 332, 541, 793, 959, 1025, 1101, 1256, 1423, 1516, 1553, 1594, 1625, 1571, 1430, 1297, 1244, 1229, 1193, 1170, 1248, 1425, 1605, 1703, 1726, 1760, 1907, 2183, 2463, 2605, 2623, 2632, 2671, 2698, 2703, 2739, 2804, 2837, 2820, 2802, 2821, 2859, 2874, 2860, 2856, 2898, 2960, 2972, 2909, 2816, 2742, 2692, 2666, 2668, 2687, 2704, 2719, 2743, 2758, 2745, 2731, 2791, 2951, 3149, 3292, 3346, 3352, 3344, 3304, 3201, 3042, 2905, 2872, 2907, 2868, 2692, 2503, 2426, 2425, 2431, 2498, 2628, 2645, 2430, 2112, 1864, 1677, 1461, 1231, 1060, 947, 843, 704, 545, 444, 465, 582, 719, 872, 1077, 1284, 1363, 1256, 1048, 871, 775, 708, 590, 417, 282, 293, 491, 874, 1445, 2175, 2956, 3661, 4280, 4908, 5588, 6199, 6592, 6754, 6795, 6820, 6912, 7125, 7430, 7717, 7964, 8250, 8617, 9056, 9607, 10288, 10962, 11462, 11767, 11947, 12032, 12077, 12196, 12391, 12514, 12467, 12325, 12203, 12162, 12250, 12491, 12846, 13206, 13501, 13725, 13909, 14100, 14266, 14301, 14119, 13781, 13438, 13184, 12968, 12694, 12316, 11889, 11521, 11288, 11189, 11152, 11091, 10921, 10615, 10207, 9786, 9416, 9045, 8564, 7976, 7425, 7007, 6633, 6200, 5765, 5454, 5278, 5184, 5125, 5034, 4816, 4452, 4009, 3556, 3106, 2602, 1972, 1209, 464, -87, -482, -951, -1590, -2186, -2463, -2470, -2530, -2855, -3336, -3777, -4170, -4625, -5159, -5692, -6174, -6658, -7166, -7628, -7948, -8122, -8233, -8327, -8348, -8236, -8059, -7970, -8042, -8188, -8292, -8392, -8602, -8903, -9179, -9438, -9787, -10194, -10476, -10551, -10529, -10518, -10509, -10442, -10302, -10157, -10143, -10277, -10365, -10262, -10113, -10128, -10227, -10189, -9984, -9758, -9567, -9321, -8991, -8624, -8245, -7826, -7385, -7014, -6789, -6666, -6512, -6248, -5957, -5791, -5783, -5803, -5739, -5682, -5781, -5955, -5936, -5670, -5453, -5535, -5799, -5956, -5933, -5880, -5944, -6113, -6240, -6234, -6220, -6351, -6511, -6439, -6160, -5967, -5955, -5922, -5751, -5562, -5491, -5559, -5728, -5913, -6019, -6064, -6154, -6314, -6467, -6594, -6718, -6775, -6653, -6402, -6229, -6242, -6312, -6277, -6163, -6124, -6209, -6326, -6407, -6481, -6580, -6668, -6679, -6596, -6459, -6319, -6164, -5919, -5584, -5286, -5141, -5113, -5088, -5049, -5091, -5277, -5552, -5795, -5947, -6077, -6277, -6485, -6515, -6325, -6092, -5982, -5953, -5887, -5783, -5716, -5679, -5606, -5491, -5423, -5448, -5489, -5419, -5213, -4954, -4698, -4398, -4014, -3621, -3341, -3191, -3054, -2838, -2583, -2403, -2352, -2393, -2468, -2538, -2565, -2517, -2388, -2199, -1971, -1737, -1528, -1351, -1164, -910, -576, -243, -45, -34, -58, 81, 362, 560, 577, 586, 767, 1078, 1354, 1536, 1697, 1902, 2126, 2279, 2330, 2338, 2356, 2319, 2163, 1944, 1763, 1611, 1425, 1243, 1158, 1186, 1259, 1319, 1361, 1409, 1492, 1605, 1676, 1654, 1562, 1450, 1346, 1276, 1282, 1343, 1407, 1466, 1558, 1700, 1881, 2090, 2275, 2360, 2353, 2365, 2449, 2474, 2298, 2010, 1842, 1840, 1804, 1614, 1403, 1307, 1275, 1230, 1194, 1178, 1150, 1125, 1115, 1066, 978, 959, 1007, 950, 748, 598, 628, 714, 713, 652, 607, 570, 506, 427, 379, 388, 390, 287, 76, -115, -183, -183, -215, -262, -257, -216, -224, -300, -365, -336, -203, -24, 109, 138, 98, 99, 222, 422, 574, 633, 690, 864, 1155, 1446, 1657, 1806, 1938, 2060, 2176, 2292, 2379, 2395, 2346, 2261, 2134, 1991, 1916, 1917, 1896, 1819, 1789, 1845, 1858, 1731, 1579, 1586, 1762, 1919, 1881, 1697, 1587, 1690, 1889, 1985, 1967, 1988, 2127, 2307, 2432, 2498, 2517, 2463, 2340, 2249, 2264, 2328, 2339, 2282, 2182, 2050, 1963, 2030, 2203, 2290, 2236, 2180, 2164, 2074, 1889, 1750, 1733, 1773, 1840, 1973, 2141, 2240, 2285, 2445, 2800, 3185, 3378, 3381, 3386, 3483, 3542, 3411, 3125, 2874, 2802, 2905, 3050, 3086, 2964, 2772, 2654, 2649, 2680, 2689, 2710, 2739, 2658, 2372, 1981, 1693, 1566, 1470, 1310, 1155, 1090, 1053, 945, 808, 782, 882, 964, 933, 850, 791, 718, 564, 335, 73, -179, -345, -334, -161, 91, 383, 713, 1077, 1504, 2065, 2742, 3379, 3839, 4156, 4452, 4755, 4988, 5122, 5228, 5412, 5680, 5957, 6241, 6593, 6985, 7298, 7567, 8008, 8651, 9195, 9419, 9506, 9711, 9978, 10128, 10190, 10343, 10619, 10891, 11081, 11263, 11541, 11912, 12290, 12650, 13059, 13504, 13834, 13939, 13944, 13987, 14033, 13961, 13781, 13604, 13494, 13437, 13366, 13182, 12882, 12616, 12483, 12364, 12132, 11838, 11575, 11252, 10743, 10115, 9566, 9172, 8836, 8447, 8029, 7673, 7422, 7211, 6962, 6677, 6422, 6237, 6070, 5814, 5378, 4774, 4138, 3607, 3165, 2672, 2062, 1427, 884, 449, 79, -258, -576, -900, -1245, -1591, -1923, -2253, -2640, -3135, -3729, -4348, -4895, -5321, -5661, -5982, -6312, -6616, -6852, -7005, -7064, -7045, -6998, -7009, -7114, -7301, -7516, -7701, -7840, -7999, -8247, -8548, -8810, -9015, -9208, -9377, -9439, -9365, -9221, -9113, -9089, -9108, -9076, -8962, -8870, -8878, -8915, -8885, -8838, -8863, -8916, -8870, -8699, -8476, -8260, -8040, -7773, -7426, -7041, -6692, -6358, -5978, -5621, -5446, -5415, -5314, -5087, -4905, -4891, -4976, -5054, -5089, -5063, -4974, -4857, -4753, -4679, -4675, -4753, -4819, -4765, -4651, -4635, -4764, -4912, -4982, -5020, -5071, -5070, -4981, -4934, -5013, -5086, -5024, -4916, -4896, -4941, -5010, -5146, -5304, -5377, -5413, -5518, -5638, -5688, -5763, -5895, -5909, -5753, -5655, -5730, -5815, -5811, -5797, -5811, -5848, -6007, -6308, -6546, -6591, -6574, -6610, -6661, -6741, -6891, -6950, -6750, -6438, -6273, -6254, -6247, -6254, -6310, -6334, -6291, -6285, -6367, -6461, -6509, -6526, -6509, -6447, -6370, -6287, -6183, -6078, -6028, -6020, -5995, -5935, -5845, -5720, -5602, -5553, -5535, -5446, -5302, -5204, -5147, -5057, -4945, -4852, -4725, -4541, -4395, -4337, -4279, -4177, -4057, -3877, -3601, -3362, -3283, -3251, -3099, -2844, -2572, -2266, -1943, -1726, -1644, -1558, -1367, -1117, -908, -773, -704, -650, -525, -297, -44, 128, 240, 404, 645, 856, 976, 1063, 1161, 1220, 1217, 1197, 1163, 1092, 1056, 1144, 1291, 1350, 1309, 1281, 1335, 1456, 1594, 1693, 1722, 1706, 1658, 1547, 1409, 1347, 1354, 1300, 1159, 1072, 1101, 1147, 1139, 1134, 1182, 1272, 1388, 1499, 1536, 1472, 1369, 1293, 1238, 1158, 1037, 875, 677, 488, 380, 361, 345, 259, 146, 114, 188, 258, 230, 118, 12, -49, -80, -94, -111, -171, -292, -409, -442, -411, -395, -427, -466, -478, -458, -419, -394, -428, -521, -597, -583, -516, -498, -551, -599, -599, -598, -609, -558, -403, -226, -126, -82, -2, 146, 301, 389, 414, 442, 543, 724, 913, 1024, 1072, 1178, 1419, 1706, 1881, 1928, 1971, 2091, 2202, 2200, 2112, 2043, 2022, 2030, 2071, 2141, 2191, 2206, 2227, 2264, 2295, 2349, 2455, 2557, 2601, 2634, 2689, 2701, 2637, 2598, 2662, 2774, 2859, 2908, 2932, 2945, 3005, 3157, 3341, 3448, 3469, 3487, 3546, 3588, 3536, 3409, 3311, 3297, 3301, 3243, 3151, 3106, 3083, 2992, 2845, 2747, 2713, 2648, 2510, 2362, 2270, 2207, 2114, 1972, 1831, 1746, 1697, 1609, 1509, 1519, 1630, 1672, 1588, 1530, 1605, 1724, 1806, 1882, 1967, 2003, 2011, 2107, 2299, 2452, 2503, 2574, 2774, 3007, 3100, 3065, 3056, 3147, 3298, 3428, 3435, 3252, 2989, 2867, 2923, 2970, 2911, 2842, 2829, 2757, 2547, 2298, 2181, 2217, 2290, 2300, 2207, 2010, 1782, 1656, 1679, 1723, 1667, 1561, 1509, 1501, 1474, 1477, 1619, 1875, 2086, 2176, 2230, 2348, 2516, 2685, 2803, 2780, 2553, 2248, 2102, 2170, 2277, 2266, 2166, 2127, 2283, 2662, 3142, 3560, 3878, 4177, 4506, 4863, 5232, 5556, 5761, 5881, 6055, 6309, 6533, 6702, 6943, 7300, 7635, 7844, 8030, 8319, 8662, 8915, 9089, 9280, 9459, 9525, 9510, 9524, 9546, 9474, 9344, 9300, 9325, 9254, 9047, 8892, 8938, 9097, 9196, 9226, 9281, 9361, 9366, 9298, 9268, 9287, 9193, 8919, 8661, 8582, 8564, 8403, 8109, 7807, 7509, 7208, 6972, 6795, 6552, 6205, 5850, 5520, 5162, 4809, 4518, 4231, 3847, 3429, 3117, 2895, 2610, 2253, 2001, 1912, 1803, 1555, 1306, 1157, 975, 644, 254, -92, -418, -728, -992, -1273, -1645, -2026, -2279, -2434, -2603, -2798, -2975, -3160, -3429, -3798, -4194, -4535, -4792, -5027, -5316, -5647, -5928, -6097, -6167, -6184, -6153, -6079, -5985, -5892, -5789, -5669, -5577, -5567, -5638, -5760, -5932, -6144, -6328, -6418, -6463, -6573, -6731, -6797, -6704, -6564, -6488, -6438, -6345, -6275, -6325, -6420, -6422, -6353, -6347, -6401, -6373, -6245, -6186, -6241, -6193, -5932, -5656, -5540, -5445, -5209, -4917, -4680, -4447, -4198, -4068, -4089, -4098, -4011, -3966, -4075, -4245, -4355, -4436, -4549, -4617, -4540, -4403, -4381, -4471, -4516, -4471, -4449, -4529, -4680, -4856, -5050, -5258, -5456, -5650, -5869, -6096, -6277, -6415, -6528, -6575, -6548, -6591, -6801, -6989, -6935, -6774, -6836, -7146, -7429, -7544, -7600, -7694, -7776, -7788, -7755, -7697, -7584, -7391, -7195, -7077, -6982, -6758, -6447, -6317, -6463, -6582, -6419, -6171, -6133, -6187, -6010, -5630, -5328, -5149, -4892, -4537, -4287, -4212, -4143, -4033, -4054, -4252, -4361, -4215, -4058, -4194, -4480, -4521, -4282, -4112, -4163, -4191, -4052, -3945, -3970, -3834, -3298, -2558, -1942, -1489, -1088, -736, -430, -16, 526, 845, 611, 69, -226, -136, 74, 307, 638, 946, 1089, 1262, 1667, 2064, 2118, 1904, 1687, 1496, 1243, 976, 746, 456, 33, -383, -609, -663, -696, -738, -717, -668, -705, -796, -784, -670, -631, -745, -879, -909, -892, -946, -1068, -1130, -1078, -1031, -1118, -1286, -1388, -1431, -1532, -1678, -1734, -1690, -1665, -1686, -1658, -1574, -1526, -1517, -1443, -1275, -1113, -1016, -920, -762, -574, -402, -213, 31, 285, 497, 705, 964, 1202, 1303, 1302, 1360, 1501, 1552, 1452, 1347, 1319, 1274, 1197, 1190, 1195, 1065, 909, 978, 1210, 1304, 1223, 1242, 1455, 1627, 1623, 1628, 1764, 1840, 1727, 1652, 1798, 1966, 1962, 1969, 2158, 2342, 2365, 2422, 2653, 2791, 2569, 2166, 1923, 1798, 1509, 1079, 823, 803, 765, 639, 632, 797, 930, 963, 1053, 1269, 1503, 1666, 1766, 1794, 1748, 1724, 1838, 2072, 2289, 2432, 2585, 2809, 3066, 3312, 3480, 3441, 3172, 2904, 2789, 2645, 2310, 1977, 1859, 1848, 1800, 1788, 1837, 1840, 1858, 2080, 2454, 2730, 2875, 3087, 3445, 3842, 4211, 4559, 4835, 4908, 4662, 4104, 3415, 2838, 2457, 2134, 1722, 1268, 969, 1032, 1537, 2319, 3005, 3336, 3441, 3644, 4100, 4659, 5003, 4889, 4434, 4024, 3776, 3408, 2927, 2904, 3602, 4384, 4580, 4477, 4773, 5461, 5871, 5641, 5067, 4543, 4136, 3789, 3499, 3158, 2607, 2029, 1805, 1934, 2030, 1926, 1764, 1579, 1330, 1180, 1288, 1480, 1511, 1446, 1502, 1774, 2227, 2700, 2901, 2689, 2319, 2130, 2032, 1651, 968, 468, 456, 595, 417, 21, -107, 123, 280, 137, 14, 127, 126, -217, -406, 17, 627, 816, 822, 1206, 1846, 2245, 2392, 2561, 2698, 2633, 2567, 2772, 3061, 3073, 2905, 2954, 3161, 3042, 2506, 1986, 1686, 1345, 833, 336, -67, -430, -643, -633, -626, -847, -1215, -1513, -1562, -1198, -530, -24, 61, 11, 74, 114, 47, -54, -395, -1159, -1947, -2385, -2843, -3608, -4156, -4180, -4292, -4807, -5043, -4558, -3803, -3107, -2285, -1378, -617, 189, 1226, 2166, 2839, 3563, 4368, 4874, 5139, 5536, 5937, 6121, 6459, 7167, 7654, 7555, 7488, 7910, 8300, 8128, 7682, 7396, 7184, 6755, 6029, 5151, 4402, 3930, 3483, 2781, 2089, 1825, 1898, 2044, 2425, 3210, 4009, 4407, 4590, 4892, 5249, 5493, 5673, 5784, 5632, 5213, 4817, 4650, 4601, 4456, 4152, 3791, 3491, 3219, 2864, 2491, 2294, 2204, 1887, 1271, 683, 327, 36, -310, -597, -805, -1078, -1373, -1441, -1229, -944, -706, -428, -54, 304, 561, 762, 961, 1064, 932, 593, 220, -112, -512, -1064, -1657, -2141, -2529, -2925, -3339, -3700, -3978, -4171, -4268, -4316, -4419, -4599, -4745, -4770, -4682, -4483, -4150, -3749, -3422, -3181, -2846, -2335, -1855, -1594, -1412, -1119, -868, -898, -1085, -1147, -1131, -1309, -1698, -2081, -2411, -2843, -3358, -3726, -3905, -4136, -4491, -4691, -4579, -4391, -4316, -4161, -3720, -3161, -2734, -2387, -1922, -1386, -991, -758, -520, -245, -69, -21, 0, -25, -194, -424, -526, -526, -635, -918, -1260, -1596, -1992, -2497, -3070, -3629, -4131, -4587, -5016, -5389, -5626, -5668, -5539, -5331, -5114, -4871, -4511, -3979, -3383, -2930, -2734, -2691, -2590, -2318, -1978, -1839, -2140, -2793, -3405, -3679, -3751, -3987, -4529, -5189, -5759, -6198, -6526, -6726, -6884, -7156, -7456, -7480, -7201, -7001, -7041, -6966, -6507, -5975, -5752, -5648, -5197, -4432, -3861, -3719, -3684, -3393, -2863, -2272, -1739, -1401, -1344, -1339, -1098, -772, -810, -1324, -2009, -2642, -3273, -3901, -4327, -4429, -4393, -4521, -4817, -4928, -4627, -4193, -4081, -4298, -4443, -4301, -4042, -3835, -3594, -3268, -3031, -2971, -2854, -2503, -2210, -2350, -2750, -2950, -2921, -2985, -3164, -3231, -3233, -3369, -3535, -3512, -3399, -3428, -3586, -3695, -3620, -3337, -3033, -2967, -3041, -2831, -2268, -1829, -1785, -1822, -1645, -1404, -1291, -1198, -1012, -860, -905, -1140, -1395, -1483, -1380, -1280, -1340, -1488, -1612, -1737, -1801, -1634, -1364, -1397, -1730, -1862, -1560, -1157, -942, -818, -655, -477, -250, 88, 432, 657, 911, 1420, 2083, 2544, 2660, 2681, 2864, 3132, 3254, 3218, 3204, 3267, 3273, 3131, 2947, 2899, 3010, 3076, 2913, 2663, 2592, 2667, 2665, 2616, 2650, 2578, 2222, 1940, 2136, 2550, 2713, 2692, 2775, 2922, 3039, 3309, 3754, 4024, 3907, 3638, 3502, 3508, 3501, 3362, 3073, 2771, 2650, 2731, 2856, 2900, 2837, 2627, 2244, 1798, 1487, 1418, 1533, 1665, 1669, 1610, 1708, 2046, 2438, 2709, 2870, 2919, 2760, 2526, 2653, 3324, 3998, 3982, 3439, 3180, 3427, 3539, 3214, 2977, 3121, 3190, 2918, 2672, 2605, 2344, 1839, 1579, 1692, 1643, 1133, 586, 452, 501, 240, -283, -569, -459, -354, -529, -698, -501, -91, 105, 21, 30, 416, 1034, 1579, 1980, 2330, 2601, 2730, 2900, 3318, 3774, 3856, 3585, 3385, 3420, 3448, 3299, 3069, 2899, 2915, 3237, 3775, 4191, 4257, 4042, 3698, 3306, 2926, 2564, 2153, 1719, 1453, 1418, 1398, 1196, 962, 920, 875, 472, -92, -214, 132, 292, 25, -122, 180, 514, 529, 544, 889, 1328, 1528, 1637, 1960, 2405, 2685, 2846, 3122, 3420, 3461, 3327, 3363, 3566, 3595, 3299, 2846, 2354, 1795, 1253, 939, 875, 807, 522, 112, -156, -96, 334, 1015, 1630, 1908, 1917, 1942, 2112, 2369, 2735, 3269, 3726, 3695, 3233, 2950, 3130, 3222, 2706, 1924, 1389, 921, 268, -157, -44, 85, -255, -650, -560, -268, -335, -659, -748, -534, -342, -243, 25, 520, 914, 1003, 1009, 1192, 1478, 1708, 1977, 2414, 2847, 3037, 3103, 3349, 3732, 3938, 3901, 3780, 3576, 3202, 2801, 2517, 2187, 1669, 1182, 988, 1010, 991, 788, 388, -75, -309, -119, 251, 329, 47, -137, 49, 255, 92, -196, -175, 61, 142, 51, -30, -162, -440, -705, -857, -1108, -1591, -2013, -2036, -1761, -1571, -1599, -1601, -1377, -1110, -1116, -1338, -1400, -1194, -1013, -995, -919, -746, -742, -889, -824, -547, -486, -733, -898, -801, -633, -496, -353, -351, -670, -1183, -1608, -1816, -1852, -1820, -1850, -1986, -2134, -2231, -2331, -2439, -2459, -2418, -2475, -2633, -2665, -2430, -2052, -1745, -1599, -1511, -1271, -831, -435, -310, -314, -161, 120, 280, 291, 345, 496, 606, 551, 315, -7, -218, -192, -68, -52, -83, 49, 352, 631, 739, 664, 451, 178, -99, -397, -685, -892, -1129, -1567, -2038, -2225, -2287, -2638, -3131, -3260, -3083, -3092, -3294, -3321, -3272, -3564, -4100, -4354, -4218, -4132, -4401, -4760, -4723, -4195, -3620, -3431, -3478, -3296, -2833, -2478, -2385, -2291, -2045, -1822, -1744, -1703, -1635, -1615, -1641, -1584, -1388, -1147, -947, -793, -706, -743, -859, -886, -727, -520, -436, -453, -415, -278, -170, -232, -450, -665, -752, -745, -759, -798, -723, -493, -311, -392, -588, -549, -315, -327, -700, -978, -853, -640, -687, -836, -829, -813, -1035, -1367, -1546, -1650, -1880, -2071, -1899, -1513, -1364, -1455, -1398, -1208, -1323, -1803, -2180, -2181, -2015, -1886, -1701, -1344, -912, -599, -459, -352, -179, -91, -254, -439, -242, 305, 758, 950, 1159, 1513, 1710, 1529, 1191, 983, 867, 686, 536, 582, 713, 706, 620, 632, 607, 268, -314, -808, -1111, -1380, -1657, -1786, -1670, -1415, -1222, -1191, -1188, -993, -632, -373, -332, -324, -191, -43, -4, 21, 133, 179, 6, -159, 18, 441, 785, 1133, 1760, 2371, 2341, 1742, 1338, 1453, 1574, 1307, 985, 990, 1103, 1024, 1018, 1348, 1571, 1183, 579, 460, 622, 286, -528, -975, -736, -502, -824, -1311, -1424, -1368, -1579, -1894, -1915, -1800, -1944, -2227, -2267, -2120, -2177, -2509, -2782, -2765, -2608, -2560, -2561, -2294, -1644, -927, -544, -519, -505, -281, -75, -198, -477, -475, -181, 57, 226, 557, 850, 716, 366, 297, 356, 25, -584, -867, -727, -654, -890, -1160, -1241, -1318, -1630, -2016, -2081, -1782, -1570, -1732, -1901, -1672, -1330, -1377, -1660, -1704, -1577, -1635, -1745, -1535, -1088, -737, -512, -265, 36, 405, 881, 1308, 1454, 1394, 1450, 1777, 2251, 2659, 2850, 2829, 2766, 2807, 2885, 2868, 2792, 2789, 2810, 2682, 2444, 2364, 2465, 2356, 1818, 1226, 1017, 1044, 914, 633, 459, 400, 297, 146, 41, -4, -31, -123, -357, -619, -668, -547, -577, -805, -892, -663, -278, 148, 603, 917, 943, 913, 1154, 1522, 1578, 1301, 1139, 1303, 1433, 1207, 860, 746, 711, 365, -196, -498, -504, -734, -1359, -1749, -1308, -358, 292, 386, 319, 388, 481, 494, 553, 693, 750, 760, 1007, 1481, 1750, 1688, 1742, 2120, 2355, 2087, 1694, 1643, 1743, 1501, 880, 268, -111, -399, -764, -1099, -1208, -1152, -1160, -1208, -985, -395, 150, 186, -156, -253, 178, 722, 996, 1244, 1760, 2234, 2323, 2309, 2504, 2627, 2461, 2420, 2755, 2887, 2299, 1471, 1162, 1220, 928, 257, -64, 248, 607, 510, 219, 58, -244, -1006, -1883, -2323, -2397, -2567, -2811, -2614, -1832, -956, -373, 101, 736, 1385, 1775, 1938, 2061, 2134, 2037, 1847, 1728, 1659, 1541, 1456, 1476, 1385, 1002, 535, 248, 120, 90, 167, 123, -266, -700, -799, -857, -1266, -1596, -1207, -342, 287, 543, 730, 866, 762, 535, 445, 473, 456, 519, 970, 1767, 2448, 2695, 2675, 2617, 2382, 1729, 837, 227, 184, 516, 891, 1196, 1446, 1534, 1312, 890, 593, 540, 487, 212, -163, -387, -425, -431, -446, -372, -168, 71, 240, 280, 114, -297, -827, -1305, -1765, -2328, -2886, -3244, -3468, -3728, -3873, -3615, -3007, -2335, -1670, -944, -331, -128, -277, -365, -163, 125, 280, 442, 909, 1740, 2758, 3737, 4450, 4754, 4750, 4668, 4529, 4119, 3378, 2600, 2095, 1846, 1708, 1716, 1877, 1899, 1485, 793, 181, -309, -822, -1271, -1492, -1582, -1675, -1585, -1091, -440, -125, -179, -131, 238, 555, 450, 84, -189, -323, -421, -390, -64, 508, 1142, 1728, 2191, 2355, 2088, 1487, 750, -42, -814, -1304, -1316, -1020, -697, -359, 61, 383, 405, 323, 479, 771, 758, 367, 67, 170, 411, 482, 543, 845, 1249, 1472, 1469, 1356, 1276, 1391, 1688, 1821, 1445, 649, -244, -1104, -1944, -2674, -3154, -3400, -3481, -3350, -2993, -2659, -2664, -2925, -3018, -2777, -2564, -2725, -3001, -2843, -2159, -1373, -751, -161, 428, 761, 817, 975, 1438, 1955, 2277, 2457, 2582, 2641, 2685, 2814, 2998, 3105, 3039, 2723, 2114, 1398, 977, 1018, 1162, 923, 313, -200, -370, -401, -492, -518, -357, -193, -240, -413, -562, -830, -1419, -2105, -2449, -2366, -2017, -1312, -152, 1045, 1758, 2073, 2357, 2519, 2245, 1673, 1253, 1160, 1259, 1441, 1634, 1673, 1421, 948, 434, -59, -573, -1061, -1370, -1439, -1317, -1026, -581, -117, 192, 297, 236, 55, -121, -94, 170, 445, 561, 683, 1067, 1577, 1797, 1627, 1423, 1465, 1618, 1661, 1579, 1411, 1149, 863, 662, 494, 225, -102, -343, -467, -578, -784, -1114, -1448, -1590, -1532, -1464, -1451, -1422, -1468, -1678, -1702, -1120, -234, 209, 84, -20, 257, 670, 936, 1127, 1445, 1952, 2557, 3075, 3320, 3217, 2793, 2143, 1463, 946, 607, 354, 249, 377, 532, 373, -118, -654, -1043, -1291, -1417, -1459, -1552, -1753, -1973, -2138, -2218, -2156, -2052, -2197, -2602, -2832, -2607, -2174, -1788, -1330, -722, -221, 17, 232, 648, 1107, 1276, 1031, 582, 303, 377, 614, 756, 784, 719, 416, -97, -471, -529, -575, -857, -1246, -1659, -2240, -2874, -3078, -2650, -2011, -1706, -1854, -2154, -2227, -1938, -1507, -1320, -1538, -1913, -2040, -1790, -1383, -1064, -855, -648, -285, 357, 1047, 1164, 498, -311, -693, -930, -1395, -1738, -1573, -1215, -998, -646, 80, 833, 1282, 1621, 2095, 2505, 2527, 2171, 1674, 1170, 745, 615, 933, 1542, 2233, 3018, 3865, 4440, 4498, 4224, 3890, 3479, 2906, 2243, 1524, 692, -112, -546, -562, -585, -927, -1349, -1513, -1573, -1804, -1977, -1703, -1258, -1330, -1970, -2461, -2358, -2061, -2052, -2194, -2220, -2335, -2693, -2805, -2249, -1494, -1207, -1226, -990, -498, -126, 41, 137, 152, 69, 47, 195, 392, 444, 290, 47, -90, -47, 71, 195, 410, 711, 836, 610, 257, 134, 305, 554, 592, 233, -359, -702, -571, -321, -271, -290, -271, -406, -636, -631, -498, -696, -1154, -1398, -1470, -1808, -2337, -2545, -2328, -2038, -1877, -1762, -1629, -1502, -1348, -1105, -804, -569, -492, -506, -409, -53, 444, 795, 843, 742, 738, 832, 836, 704, 642, 779, 924, 869, 801, 1095, 1661, 1936, 1645, 1163, 863, 570, 14, -602, -926, -1067, -1350, -1653, -1591, -1337, -1512, -2119, -2447, -2271, -2261, -2753, -3081, -2667, -2014, -1916, -2299, -2486, -2226, -1833, -1521, -1244, -1116, -1345, -1697, -1652, -1167, -739, -617, -547, -284, 93, 436, 697, 860, 879, 673, 192, -418, -866, -1058, -1224, -1473, -1485, -921, 2, 707, 1000, 1222, 1580, 1763, 1482, 965, 532, 135, -339, -728, -883, -857, -636, -141, 431, 746, 765, 666, 527, 364, 171, -219, -877, -1416, -1487, -1413, -1635, -1880, -1641, -1119, -905, -1078, -1211, -1004, -486, 72, 345, 318, 410, 887, 1449, 1709, 1643, 1358, 895, 484, 434, 630, 651, 420, 259, 338, 513, 618, 591, 397, 63, -294, -526, -467, -24, 580, 867, 617, 117, -247, -388, -367, -230, -100, -146, -330, -415, -269, 5, 269, 486, 695, 918, 1112, 1181, 1063, 813, 572, 466, 573, 939, 1524, 2115, 2402, 2244, 1830, 1478, 1269, 975, 380, -407, -1085, -1500, -1702, -1709, -1484, -1089, -636, -149, 305, 501, 325, -40, -418, -845, -1304, -1602, -1652, -1533, -1220, -606, 159, 726, 937, 914, 806, 725, 839, 1273, 1885, 2332, 2402, 2183, 1861, 1437, 764, -169, -1139, -1914, -2414, -2573, -2275, -1616, -957, -489, -29, 519, 899, 946, 877, 896, 921, 913, 1065, 1477, 1983, 2381, 2618, 2737, 2807, 2843, 2703, 2192, 1396, 714, 444, 439, 380, 291, 433, 754, 854, 584, 244, 48, -261, -970, -1866, -2425, -2404, -2010, -1555, -1149, -720, -168, 535, 1289, 1929, 2422, 2927, 3495, 3826, 3586, 2978, 2666, 2963, 3405, 3411, 3043, 2731, 2569, 2324, 1821, 933, -395, -1800, -2651, -2817, -2753, -2769, -2757, -2644, -2499, -2226, -1668, -1009, -608, -512, -478, -418, -501, -761, -910, -656, -30, 764, 1607, 2374, 2834, 2877, 2727, 2722, 2920, 3100, 3077, 2931, 2897, 3100, 3424, 3571, 3295, 2618, 1813, 1119, 544, -16, -606, -1259, -2024, -2768, -3211, -3275, -3205, -3240, -3397, -3597, -3746, -3691, -3343, -2857, -2513, -2429, -2473, -2394, -1992, -1287, -519, 98, 645, 1365, 2287, 3119, 3606, 3838, 4066, 4332, 4462, 4350, 4018, 3455, 2636, 1693, 872, 310, -27, -275, -556, -878, -1139, -1353, -1726, -2373, -3110, -3704, -4125, -4402, -4457, -4293, -4130, -4111, -3970, -3312, -2182, -1072, -319, 138, 389, 409, 347, 446, 645, 760, 930, 1340, 1805, 2120, 2415, 2679, 2550, 2013, 1687, 2005, 2698, 3316, 3706, 3858, 3784, 3651, 3633, 3641, 3388, 2726, 1774, 839, 245, 127, 315, 472, 377, 45, -388, -813, -1200, -1530, -1726, -1741, -1698, -1811, -2105, -2376, -2519, -2685, -3028, -3515, -4010, -4345, -4353, -4059, -3736, -3515, -3097, -2208, -1200, -783, -1158, -1770, -2021, -1914, -1816, -1820, -1630, -924, 352, 1946, 3340, 4016, 3904, 3496, 3374, 3681, 4161, 4558, 4767, 4717, 4446, 4274, 4483, 4819, 4734, 4099, 3241, 2393, 1576, 868, 284, -390, -1252, -2001, -2377, -2606, -3049, -3642, -4070, -4327, -4654, -4982, -4964, -4623, -4392, -4432, -4495, -4456, -4295, -3690, -2416, -943, 128, 970, 2079, 3345, 4247, 4613, 4684, 4693, 4781, 4981, 5139, 5044, 4715, 4374, 4182, 4110, 4003, 3678, 3081, 2365, 1744, 1251, 734, 48, -814, -1800, -2842, -3806, -4525, -4947, -5172, -5235, -5019, -4527, -4065, -3910, -3912, -3675, -3100, -2492, -2138, -1963, -1711, -1242, -538, 418, 1551, 2545, 3034, 2985, 2734, 2577, 2463, 2185, 1708, 1168, 703, 458, 605, 1138, 1720, 1930, 1647, 1111, 664, 480, 439, 290, -30, -347, -487, -406, -50, 574, 1236, 1682, 1971, 2244, 2319, 1919, 1138, 281, -530, -1320, -2014, -2507, -2759, -2769, -2657, -2681, -2896, -3026, -2913, -2791, -2870, -3060, -3233, -3376, -3363, -3022, -2449, -1856, -1129, 30, 1512, 2772, 3455, 3764, 4078, 4420, 4505, 4185, 3651, 3162, 2755, 2343, 1919, 1534, 1162, 751, 345, -1, -405, -1074, -1996, -2846, -3381, -3779, -4364, -5084, -5599, -5768, -5673, -5332, -4774, -4246, -3960, -3834, -3749, -3734, -3671, -3304, -2693, -2142, -1612, -757, 428, 1515, 2220, 2615, 2860, 3005, 3013, 2795, 2304, 1690, 1221, 1024, 1055, 1219, 1450, 1774, 2304, 2957, 3274, 2867, 1951, 1052, 415, 56, -3, 4, -394, -1216, -1807, -1719, -1270, -954, -804, -643, -481, -401, -389, -413, -530, -845, -1330, -1683, -1528, -959, -641, -1082, -2057, -2986, -3540, -3656, -3386, -3013, -2930, -3130, -3154, -2708, -1993, -1325, -767, -276, 52, 91, -36, 34, 547, 1365, 2120, 2614, 2987, 3502, 4134, 4496, 4394, 4213, 4358, 4609, 4575, 4390, 4291, 3976, 3213, 2532, 2475, 2682, 2497, 1996, 1636, 1356, 754, -124, -796, -1107, -1426, -2030, -2729, -3288, -3836, -4548, -5206, -5450, -5321, -5172, -5124, -4967, -4595, -4195, -3885, -3467, -2739, -1875, -1214, -801, -392, 122, 611, 1001, 1412, 1912, 2401, 2863, 3463, 4204, 4700, 4566, 3910, 3199, 2673, 2191, 1620, 1011, 360, -406, -1132, -1524, -1571, -1536, -1576, -1660, -1712, -1593, -1189, -695, -454, -434, -271, 88, 269, 62, -275, -410, -299, -65, 252, 675, 1129, 1425, 1462, 1370, 1377, 1542, 1680, 1562, 1131, 529, -71, -587, -961, -1189, -1433, -1793, -1914, -1281, -116, 634, 521, 171, 324, 908, 1396, 1518, 1297, 858, 455, 370, 651, 1073, 1409, 1656, 2049, 2710, 3252, 3066, 2190, 1354, 924, 482, -202, -628, -418, 33, 277, 456, 823, 1192, 1257, 1062, 873, 783, 617, 181, -402, -747, -652, -337, -61, 235, 673, 1156, 1616, 2208, 2969, 3581, 3742, 3545, 3275, 3047, 2753, 2224, 1435, 588, -79, -546, -848, -846, -529, -305, -510, -890, -1066, -1203, -1625, -2082, -2037, -1505, -1064, -1092, -1450, -1924, -2527, -3226, -3727, -3782, -3497, -3081, -2467, -1476, -270, 675, 1082, 1084, 934, 764, 676, 747, 809, 538, -74, -612, -702, -378, 115, 569, 758, 470, -211, -788, -781, -163, 739, 1636, 2265, 2359, 1974, 1579, 1433, 1245, 811, 468, 533, 815, 1029, 1180, 1274, 1143, 759, 340, 34, -226, -550, -948, -1319, -1507, -1454, -1273, -1047, -699, -242, 138, 388, 636, 838, 773, 522, 444, 636, 874, 1051, 1213, 1302, 1333, 1554, 2073, 2579, 2713, 2433, 1919, 1432, 1276, 1529, 1816, 1667, 1055, 340, -270, -895, -1602, -2230, -2682, -3022, -3136, -2786, -2276, -2329, -3012, -3537, -3466, -3298, -3472, -3613, -3276, -2742, -2523, -2537, -2287, -1599, -757, 2, 657, 1116, 1214, 1069, 1056, 1263, 1339, 1064, 720, 705, 974, 1131, 1017, 914, 1066, 1243, 1072, 633, 344, 283, 72, -450, -830, -584, 103, 649, 914, 1207, 1506, 1372, 798, 347, 220, 18, -350, -427, -35, 504, 1077, 1798, 2422, 2514, 2088, 1500, 1009, 735, 614, 324, -269, -747, -773, -674, -771, -760, -389, -121, -462, -1202, -1793, -1972, -1799, -1519, -1445, -1600, -1617, -1261, -726, -221, 274, 711, 936, 1010, 1115, 1197, 1119, 995, 968, 958, 856, 684, 389, -79, -505, -631, -537, -380, -89, 313, 520, 421, 251, 74, -252, -647, -963, -1398, -2070, -2603, -2726, -2713, -2738, -2493, -1831, -1019, -214, 507, 737, 211, -547, -871, -847, -875, -820, -302, 543, 1200, 1419, 1400, 1462, 1694, 1881, 1836, 1705, 1704, 1685, 1395, 984, 770, 689, 525, 377, 356, 218, -195, -608, -761, -722, -578, -400, -417, -640, -656, -367, -297, -632, -829, -652, -574, -727, -533, 243, 1051, 1435, 1530, 1579, 1583, 1486, 1262, 811, 62, -867, -1708, -2190, -2229, -2059, -2008, -2095, -2090, -1971, -1956, -2056, -2015, -1751, -1482, -1355, -1251, -1038, -735, -377, 101, 740, 1426, 1989, 2288, 2181, 1677, 1179, 1138, 1371, 1327, 1089, 1257, 1784, 1961, 1642, 1383, 1258, 654, -603, -1837, -2405, -2360, -2167, -2178, -2409, -2602, -2534, -2284, -2105, -2082, -2072, -1946, -1753, -1677, -1825, -1992, -1761, -1019, -203, 253, 423, 572, 735, 871, 943, 699, -1, -656, -677, -331, -307, -689, -1194, -1874, -2723, -3204, -3000, -2579, -2407, -2268, -1828, -1263, -924, -839, -798, -630, -300, 127, 574, 1010, 1366, 1530, 1570, 1788, 2350, 3015, 3453, 3687, 4001, 4505, 5007, 5260, 5186, 4882, 4495, 4103, 3709, 3278, 2730, 1964, 1057, 371, 161, 169, -138, -939, -1943, -2834, -3555, -4155, -4634, -4976, -5155, -5056, -4525, -3619, -2713, -2265, -2415, -2858, -3093, -2810, -2144, -1523, -1198, -956, -394, 602, 1808, 2940, 3750, 3979, 3558, 2841, 2382, 2357, 2414, 2191, 1811, 1667, 1852, 2035, 1921, 1600, 1362, 1324, 1360, 1281, 955, 309, -639, -1672, -2386, -2547, -2341, -2072, -1698, -1113, -635, -620, -811, -736, -487, -431, -523, -570, -683, -875, -766, -248, 158, 62, -208, -167, 103, 186, -22, -279, -403, -323, 108, 836, 1331, 1150, 572, 138, -121, -395, -523, -315, 21, 301, 669, 1163, 1500, 1572, 1632, 1766, 1698, 1324, 1034, 1230, 1802, 2331, 2638, 2821, 2899, 2732, 2310, 1816, 1353, 892, 622, 904, 1545, 1681, 990, 330, 368, 397, -481, -1893, -2943, -3499, -3765, -3611, -3159, -3007, -3280, -3406, -3073, -2548, -2047, -1590, -1316, -1289, -1268, -1062, -726, -320, 121, 388, 379, 401, 753, 1248, 1570, 1753, 1981, 2196, 2210, 1969, 1555, 1132, 887, 849, 822, 641, 357, 100, -43, -26, 45, -45, -258, -236, 113, 391, 354, 284, 409, 502, 314, -79, -563, -1149, -1702, -1922, -1704, -1217, -590, 176, 929, 1334, 1332, 1280, 1367, 1254, 653, -90, -430, -336, -181, -185, -336, -588, -814, -780, -409, 6, 76, -296, -859, -1301, -1479, -1420, -1226, -1031, -941, -958, -1005, -1071, -1239, -1461, -1465, -1128, -745, -607, -505, -92, 548, 1121, 1576, 1873, 1738, 1148, 586, 388, 267, -123, -652, -986, -1028, -796, -264, 412, 735, 274, -805, -1850, -2417, -2624, -2771, -2848, -2652, -2218, -1817, -1557, -1247, -700, 64, 961, 1918, 2773, 3308, 3476, 3442, 3377, 3359, 3451, 3717, 4129, 4567, 4949, 5268, 5472, 5405, 4997, 4385, 3767, 3229, 2767, 2326, 1803, 1180, 634, 310, 96, -208, -618, -1073, -1614, -2241, -2760, -3057, -3325, -3791, -4251, -4262, -3768, -3223, -2985, -2922, -2772, -2531, -2312, -2095, -1837, -1576, -1284, -865, -398, -152, -196, -205, 157, 821, 1462, 1955, 2388, 2719, 2751, 2477, 2130, 1806, 1341, 662, 58, -93, 214, 610, 825, 972, 1249, 1515, 1424, 931, 347, -117, -596, -1226, -1801, -1991, -1763, -1394, -1097, -877, -700, -543, -316, -30, 36, -288, -678, -685, -373, -132, 2, 363, 955, 1316, 1241, 1103, 1134, 1040, 801, 1022, 1784, 2197, 1904, 1810, 2454, 3053, 2954, 2659, 2670, 2680, 2393, 1994, 1644, 1387, 1418, 1722, 1860, 1620, 1278, 998, 641, 257, 33, -154, -552, -1031, -1329, -1509, -1760, -2024, -2152, -2146, -2158, -2389, -2882, -3261, -3026, -2272, -1663, -1524, -1548, -1463, -1336, -1162, -828, -537, -669, -1137, -1414, -1269, -1048, -1066, -1180, -1175, -1173, -1297, -1341, -1134, -889, -769, -585, -284, -244, -679, -1227, -1517, -1665, -1856, -1827, -1255, -411, 96, 128, 112, 361, 727, 995, 1120, 1027, 635, 219, 256, 732, 1009, 676, 176, 221, 789, 1201, 1098, 852, 907, 1204, 1446, 1592, 1775, 1948, 1926, 1714, 1490, 1272, 861, 213, -369, -534, -262, 156, 430, 486, 413, 300, 182, 56, -108, -358, -711, -1091, -1350, -1374, -1227, -1075, -915, -563, -7, 459, 644, 669, 632, 393, -26, -214, 92, 482, 410, 108, 307, 1039, 1459, 1083, 481, 347, 540, 548, 339, 146, -145, -786, -1539, -1881, -1772, -1682, -1812, -1887, -1806, -1891, -2297, -2695, -2831, -2926, -3169, -3245, -2810, -2143, -1807, -1797, -1594, -1044, -617, -663, -927, -1026, -978, -999, -1051, -900, -512, -158, -54, -86, 24, 360, 766, 1093, 1304, 1360, 1188, 844, 599, 672, 859, 749, 330, 82, 302, 744, 1078, 1294, 1423, 1296, 888, 525, 426, 331, -16, -293, -65, 377, 401, 113, 116, 320, 99, -434, -570, -275, -152, -302, -294, -58, 82, -39, -379, -822, -1078, -970, -759, -728, -761, -750, -843, -876, -384, 543, 1281, 1646, 1864, 1765, 1116, 377, 105, 94, -24, -94, 46, 193, 317, 610, 869, 717, 338, 120, -45, -369, -536, -210, 266, 327, -3, -246, -182, -28, -21, -209, -610, -1178, -1565, -1338, -569, 180, 531, 593, 590, 605, 681, 859, 1099, 1347, 1574, 1688, 1591, 1353, 1103, 786, 291, -297, -785, -1061, -1082, -856, -522, -219, 104, 516, 803, 707, 335, 37, -4, 133, 275, 212, -130, -543, -724, -682, -682, -821, -903, -757, -472, -302, -418, -763, -1117, -1295, -1291, -1240, -1288, -1498, -1819, -2089, -2093, -1768, -1323, -1051, -960, -787, -499, -474, -951, -1568, -1773, -1489, -1109, -965, -1053, -1131, -959, -487, 130, 707, 1099, 1131, 716, 102, -272, -266, -97, 80, 377, 868, 1388, 1730, 1851, 1798, 1575, 1157, 605, 104, -131, -29, 283, 601, 811, 987, 1299, 1783, 2180, 2104, 1475, 720, 379, 515, 654, 438, 121, 204, 700, 1112, 1141, 997, 1001, 1228, 1532, 1635, 1303, 710, 358, 422, 486, 169, -408, -918, -1188, -1139, -786, -342, -15, 241, 531, 763, 759, 436, -192, -929, -1374, -1310, -1010, -852, -785, -527, -94, 211, 238, 148, 175, 379, 612, 694, 622, 565, 614, 651, 499, 118, -390, -900, -1304, -1549, -1640, -1606, -1510, -1488, -1652, -1908, -2027, -1921, -1754, -1700, -1733, -1744, -1713, -1677, -1570, -1296, -911, -625, -569, -606, -464, -41, 565, 1247, 1916, 2351, 2322, 1917, 1474, 1163, 947, 890, 1114, 1459, 1600, 1591, 1847, 2468, 2954, 2876, 2450, 2081, 1678, 953, 132, -257, -165, 11, 71, 153, 335, 591, 980, 1528, 1999, 2056, 1649, 1045, 518, 84, -372, -828, -1076, -979, -668, -456, -502, -614, -499, -185, -23, -177, -378, -319, -117, -122, -314, -304, 51, 412, 502, 476, 505, 522, 583, 914, 1382, 1502, 1183, 894, 950, 1180, 1340, 1349, 1164, 806, 433, 178, 71, 117, 240, 268, 267, 542, 1051, 1319, 1183, 1023, 995, 792, 327, -105, -419, -771, -1036, -940, -549, -110, 369, 919, 1354, 1529, 1541, 1465, 1213, 757, 256, -99, -202, -30, 334, 734, 1059, 1302, 1465, 1505, 1424, 1313, 1219, 1040, 685, 320, 236, 495, 867, 1129, 1222, 1151, 953, 721, 496, 252, 35, -118, -372, -834, -1230, -1254, -1074, -1041, -1099, -963, -659, -469, -560, -924, -1486, -2023, -2258, -2196, -2108, -2104, -1947, -1447, -834, -484, -473, -638, -973, -1546, -2128, -2310, -2097, -1993, -2235, -2345, -1811, -917, -387, -387, -447, -270, -49, 30, 69, 137, 146, 118, 255, 557, 740, 690, 669, 835, 898, 605, 236, 173, 289, 195, -177, -592, -918, -1197, -1432, -1542, -1523, -1510, -1625, -1830, -1961, -1912, -1746, -1679, -1810, -1863, -1483, -833, -434, -269, 208, 1027, 1532, 1462, 1260, 1192, 1123, 1168, 1579, 2053, 2031, 1637, 1518, 1807, 1957, 1611, 1113, 980, 1210, 1341, 1028, 321, -567, -1479, -2272, -2780, -2930, -2775, -2378, -1768, -1078, -593, -523, -777, -1046, -1131, -1077, -971, -760, -374, 86, 458, 684, 782, 785, 809, 972, 1138, 1043, 716, 465, 476, 711, 1097, 1494, 1662, 1542, 1267, 791, -17, -840, -1078, -685, -248, -146, -155, 23, 356, 671, 903, 1013, 917, 684, 589, 782, 1007, 873, 328, -307, -738, -911, -924, -859, -674, -242, 400, 968, 1175, 951, 313, -685, -1767, -2523, -2879, -3122, -3356, -3300, -2779, -2052, -1475, -1098, -787, -552, -522, -707, -1031, -1510, -2144, -2706, -2908, -2728, -2323, -1792, -1218, -737, -359, 47, 461, 645, 531, 418, 598, 996, 1344, 1567, 1755, 1890, 1879, 1827, 1922, 2136, 2275, 2308, 2327, 2292, 2080, 1763, 1513, 1267, 803, 216, -68, 55, 155, -49, -318, -500, -907, -1657, -2305, -2515, -2505, -2553, -2665, -2822, -2992, -2900, -2357, -1774, -1791, -2397, -2879, -2710, -2119, -1672, -1528, -1376, -969, -447, -65, 153, 347, 584, 826, 1039, 1162, 1092, 822, 504, 284, 238, 529, 1317, 2382, 3162, 3328, 3079, 2756, 2459, 2168, 1985, 1937, 1766, 1218, 488, 21, -48, 107, 427, 931, 1422, 1675, 1707, 1563, 1139, 521, 56, -159, -420, -882, -1344, -1646, -1852, -1960, -1834, -1491, -1133, -856, -576, -289, -184, -387, -728, -962, -1114, -1389, -1710, -1680, -1183, -679, -546, -515, -212, 170, 332, 458, 743, 852, 486, -43, -352, -529, -749, -878, -786, -598, -447, -324, -261, -329, -383, -130, 442, 951, 1070, 942, 908, 989, 915, 602, 315, 301, 510, 794, 1123, 1459, 1645, 1686, 1892, 2464, 3194, 3760, 3992, 3756, 3029, 2206, 1810, 1831, 1833, 1666, 1561, 1642, 1853, 2199, 2626, 2765, 2219, 1076, -183, -1284, -2285, -3149, -3591, -3518, -3241, -3031, -2792, -2428, -2142, -2134, -2253, -2264, -2201, -2200, -2153, -1878, -1505, -1263, -1039, -617, -193, -32, 151, 816, 1764, 2375, 2482, 2401, 2365, 2394, 2504, 2670, 2744, 2618, 2322, 1929, 1513, 1142, 769, 247, -433, -1051, -1375, -1367, -1165, -975, -939, -1011, -1010, -892, -880, -1203, -1775, -2276, -2482, -2428, -2237, -1906, -1331, -520, 303, 859, 1044, 943, 689, 361, 34, -204, -275, -110, 279, 734, 1023, 1057, 916, 672, 387, 193, 168, 175, 80, 24, 245, 707, 1123, 1257, 1039, 552, 27, -257, -218, -49, 3, -104, -241, -289, -210, 16, 369, 660, 574, 33, -567, -720, -418, -128, -171, -465, -882, -1395, -1842, -1986, -1886, -1836, -1935, -2076, -2230, -2402, -2409, -2077, -1534, -1101, -931, -867, -625, -108, 431, 599, 308, -74, -103, 301, 848, 1266, 1551, 1826, 2178, 2697, 3368, 3857, 3772, 3208, 2614, 2134, 1617, 1183, 1143, 1402, 1581, 1641, 1815, 2083, 2205, 2153, 2089, 2025, 1790, 1301, 676, 98, -348, -671, -868, -861, -607, -210, 88, 142, 53, 52, 171, 221, 84, -145, -378, -671, -1032, -1318, -1442, -1525, -1668, -1748, -1666, -1630, -1839, -2012, -1681, -968, -554, -741, -1028, -877, -469, -357, -645, -1020, -1372, -1784, -2021, -1705, -1000, -428, -49, 508, 1289, 1942, 2309, 2464, 2369, 1974, 1485, 1142, 945, 769, 539, 233, -75, -198, -54, 179, 274, 164, -135, -624, -1199, -1609, -1684, -1545, -1499, -1747, -2155, -2346, -2117, -1656, -1252, -956, -755, -780, -969, -916, -421, 165, 504, 683, 814, 791, 675, 771, 1128, 1435, 1494, 1388, 1275, 1321, 1623, 2023, 2235, 2235, 2190, 2077, 1770, 1397, 1185, 1021, 563, -199, -870, -1172, -1244, -1296, -1269, -1063, -852, -869, -1032, -1076, -965, -932, -1176, -1677, -2219, -2512, -2390, -1969, -1513, -1160, -830, -417, 29, 350, 448, 387, 299, 232, 132, -18, -88, 118, 575, 934, 911, 656, 499, 462, 368, 182, -102, -614, -1251, -1585, -1460, -1260, -1280, -1345, -1276, -1254, -1425, -1593, -1574, -1537, -1731, -2082, -2342, -2453, -2462, -2262, -1799, -1332, -1061, -799, -399, -81, 57, 260, 551, 633, 552, 701, 1094, 1405, 1631, 1949, 2196, 2146, 2020, 2112, 2295, 2307, 2185, 2091, 2009, 1837, 1580, 1311, 1062, 814, 518, 117, -364, -755, -868, -751, -674, -743, -762, -575, -321, -180, -166, -244, -409, -552, -592, -680, -980, -1317, -1368, -1134, -924, -922, -997, -922, -668, -460, -544, -845, -1006, -833, -537, -387, -278, 111, 777, 1288, 1340, 1138, 1043, 1065, 976, 763, 663, 839, 1203, 1537, 1682, 1676, 1696, 1758, 1608, 1077, 379, -128, -322, -316, -276, -282, -220, 150, 794, 1214, 992, 330, -247, -567, -860, -1310, -1841, -2316, -2682, -2908, -2892, -2529, -1895, -1303, -1071, -1242, -1594, -1904, -2114, -2270, -2416, -2533, -2511, -2224, -1701, -1091, -449, 277, 1004, 1509, 1697, 1669, 1554, 1441, 1401, 1391, 1284, 1127, 1130, 1313, 1471, 1521, 1559, 1549, 1297, 824, 439, 387, 587, 800, 884, 845, 732, 567, 363, 156, -15, -179, -419, -757, -1035, -982, -504, 136, 574, 719, 750, 769, 662, 329, -132, -560, -924, -1279, -1560, -1574, -1216, -649, -134, 278, 761, 1383, 1919, 2043, 1624, 846, 102, -285, -358, -420, -537, -366, 309, 1137, 1609, 1786, 2191, 2952, 3497, 3340, 2730, 2207, 1867, 1456, 891, 307, -113, -175, 149, 503, 518, 338, 342, 481, 421, 200, 199, 493, 691, 487, 59, -216, -262, -342, -661, -1091, -1317, -1166, -747, -303, 58, 446, 959, 1446, 1642, 1504, 1262, 1129, 1088, 955, 641, 309, 232, 485, 882, 1272, 1695, 2139, 2380, 2272, 1964, 1620, 1108, 216, -918, -1891, -2478, -2766, -2825, -2609, -2232, -1962, -1832, -1655, -1429, -1288, -1144, -938, -991, -1530, -2100, -2067, -1421, -559, 329, 1215, 1906, 2245, 2379, 2566, 2851, 3129, 3366, 3559, 3612, 3467, 3278, 3230, 3222, 3025, 2645, 2240, 1792, 1241, 743, 483, 336, -3, -668, -1501, -2206, -2533, -2480, -2355, -2504, -2983, -3547, -3916, -3913, -3466, -2636, -1711, -1093, -966, -1106, -1082, -642, 123, 892, 1304, 1199, 751, 330, 232, 548, 1199, 1935, 2413, 2467, 2286, 2209, 2337, 2406, 2061, 1186, -15, -1182, -2034, -2518, -2791, -3000, -3120, -3070, -2958, -2996, -3212, -3464, -3716, -4106, -4675, -5211, -5437, -5290, -4958, -4674, -4503, -4293, -3815, -3014, -2103, -1329, -667, 48, 737, 1128, 1210, 1253, 1392, 1566, 1769, 1983, 1995, 1724, 1527, 1797, 2391, 2861, 3105, 3379, 3707, 3765, 3430, 3032, 2838, 2675, 2339, 1947, 1623, 1267, 851, 543, 409, 372, 472, 760, 1029, 1023, 802, 615, 573, 612, 640, 566, 356, 137, 87, 220, 406, 624, 1025, 1681, 2375, 2799, 2940, 3090, 3453, 3870, 4002, 3741, 3391, 3383, 3716, 3886, 3565, 3119, 3080, 3411, 3708, 3834, 3863, 3716, 3299, 2751, 2217, 1641, 1038, 618, 419, 104, -566, -1305, -1616, -1445, -1210, -1200, -1295, -1336, -1421, -1670, -1946, -2023, -1917, -1861, -1980, -2123, -2031, -1624, -1088, -652, -347, -1, 494, 983, 1221, 1201, 1166, 1248, 1292, 1139, 909, 838, 914, 868, 557, 182, 38, 153, 285, 208, -85, -452, -772, -1041, -1296, -1508, -1603, -1604, -1662, -1846, -1992, -1869, -1467, -1049, -859, -848, -723, -355, 6, 74, -20, 96, 464, 745, 757, 684, 724, 847, 915, 812, 517, 191, 29, -71, -459, -1213, -1960, -2375, -2617, -3044, -3645, -4088, -4260, -4385, -4587, -4725, -4707, -4603, -4473, -4359, -4389, -4571, -4643, -4429, -4136, -4014, -3998, -3913, -3786, -3720, -3644, -3394, -2978, -2560, -2278, -2186, -2307, -2549, -2673, -2561, -2439, -2541, -2736, -2779, -2737, -2805, -2920, -2886, -2706, -2541, -2504, -2621, -2831, -2957, -2882, -2765, -2869, -3172, -3316, -3026, -2441, -1941, -1719, -1637, -1467, -1128, -735, -495, -477, -499, -414, -409, -704, -1104, -1250, -1228, -1429, -1898, -2272, -2324, -2178, -2028, -1952, -1995, -2189, -2445, -2608, -2676, -2770, -2886, -2851, -2617, -2329, -2018, -1578, -1049, -609, -238, 216, 695, 969, 960, 744, 380, -26, -239, -113, 183, 360, 314, 136, -115, -399, -538, -428, -363, -752, -1498, -2069, -2225, -2226, -2276, -2252, -2033, -1737, -1531, -1418, -1242, -870, -408, -113, 14, 327, 977, 1592, 1812, 1830, 2061, 2545, 2985, 3208, 3243, 3085, 2733, 2436, 2498, 2784, 2885, 2811, 2885, 2966, 2558, 1707, 955, 492, 120, -168, -309, -484, -739, -799, -673, -737, -897, -493, 553, 1288, 1007, 383, 501, 1278, 1845, 2141, 2800, 3717, 4171, 4174, 4250, 4258, 3841, 3492, 3811, 4345, 4339, 3960, 3816, 3927, 3961, 3939, 4092, 4341, 4396, 4191, 3871, 3487, 3042, 2698, 2474, 2030, 1248, 699, 848, 1292, 1425, 1273, 1061, 691, 164, -250, -566, -1034, -1517, -1645, -1475, -1275, -986, -485, -9, 171, 135, 83, 155, 502, 1091, 1494, 1334, 864, 710, 1059, 1511, 1771, 1980, 2181, 2000, 1270, 522, 331, 641, 1121, 1675, 2182, 2356, 2190, 2043, 2073, 2100, 2065, 2087, 2053, 1658, 977, 564, 797, 1443, 2058, 2487, 2744, 2811, 2850, 3150, 3551, 3467, 2787, 2102, 1778, 1509, 1117, 1028, 1500, 1969, 1806, 1248, 902, 655, -13, -922, -1495, -1858, -2461, -2990, -2909, -2633, -2958, -3831, -4687, -5474, -6419, -7341, -7951, -8369, -8803, -9070, -8883, -8323, -7657, -6865, -5837, -4861, -4360, -4266, -4222, -4197, -4188, -3728, -2417, -628, 1044, 2618, 4405, 6331, 8108, 9686, 11166, 12538, 13694, 14527, 14958, 15075, 15157, 15457, 16068, 16896, 17644, 17956, 17807, 17591, 17584, 17560, 17197, 16591, 16033, 15444, 14489, 13148, 11821, 10758, 9803, 8825, 7968, 7254, 6420, 5388, 4448, 3796, 3321, 2977, 2832, 2732, 2382, 1807, 1274, 825, 261, -411, -893, -1014, -938, -803, -498, 31, 562, 913, 1220, 1620, 1939, 1946, 1645, 1148, 520, -85, -412, -411, -365, -427, -293, 269, 869, 981, 780, 759, 824, 517, -122, -713, -1222, -1817, -2368, -2671, -2815, -2921, -2881, -2677, -2576, -2776, -3108, -3313, -3408, -3653, -4208, -4986, -5753, -6256, -6378, -6353, -6607, -7199, -7636, -7547, -7195, -7048, -7113, -7079, -6889, -6800, -6970, -7220, -7278, -7178, -7258, -7661, -8009, -7859, -7373, -7119, -7213, -7121, -6452, -5574, -5132, -5220, -5356, -5194, -4925, -4861, -4919, -4812, -4596, -4629, -4909, -4950, -4479, -3862, -3524, -3389, -3159, -2862, -2757, -2933, -3232, -3467, -3635, -3928, -4451, -4953, -5125, -5091, -5201, -5419, -5423, -5261, -5346, -5780, -6209, -6447, -6777, -7409, -8051, -8376, -8562, -8924, -9316, -9414, -9358, -9506, -9795, -9870, -9696, -9548, -9559, -9611, -9561, -9374, -9118, -8929, -8859, -8734, -8324, -7697, -7192, -6935, -6640, -6097, -5565, -5311, -5049, -4306, -3209, -2356, -1994, -1792, -1445, -1073, -885, -823, -784, -864, -1105, -1275, -1194, -973, -741, -432, -85, 82, 59, 122, 355, 484, 313, 12, -181, -262, -322, -310, -113, 231, 616, 1048, 1534, 1901, 1982, 1912, 1971, 2180, 2288, 2176, 2025, 2039, 2164, 2196, 2151, 2320, 2829, 3298, 3301, 3009, 2987, 3362, 3655, 3484, 3016, 2657, 2582, 2687, 2754, 2649, 2429, 2235, 2065, 1777, 1399, 1232, 1487, 1900, 2018, 1811, 1631, 1627, 1606, 1503, 1444, 1369, 1097, 741, 548, 483, 406, 460, 832, 1305, 1486, 1368, 1288, 1410, 1552, 1525, 1372, 1184, 951, 696, 546, 528, 532, 525, 548, 565, 558, 658, 892, 961, 630, 166, 44, 304, 508, 346, 4, -152, -40, 173, 374, 590, 850, 1126, 1351, 1445, 1407, 1337, 1288, 1193, 1054, 1046, 1226, 1341, 1151, 812, 697, 854, 983, 925, 880, 964, 952, 685, 407, 389, 559, 663, 560, 247, -93, -192, -48, 45, 44, 235, 589, 657, 365, 254, 604, 951, 832, 485, 386, 486, 417, 218, 298, 700, 1003, 967, 787, 676, 680, 794, 882, 751, 549, 593, 708, 427, -107, -318, -231, -415, -924, -1164, -856, -405, -265, -439, -604, -518, -282, -218, -457, -747, -806, -686, -593, -495, -193, 292, 704, 963, 1316, 1875, 2307, 2302, 2113, 2232, 2711, 3128, 3160, 2880, 2555, 2324, 2161, 2156, 2638, 3587, 4112, 3318, 1703, 690, 645, 498, -451, -1500, -1725, -1305, -1151, -1677, -2236, -1795, -220, 1286, 1500, 644, -75, -176, -270, -694, -690, 530, 2504, 3967, 4368, 4251, 4308, 4739, 5433, 6134, 6490, 6406, 6128, 5696, 4867, 3865, 3505, 4109, 4920, 4983, 4176, 3047, 2051, 1303, 804, 522, 291, -122, -801, -1680, -2666, -3546, -4002, -4003, -3960, -4185, -4507, -4676, -4778, -4978, -5120, -4923, -4347, -3645, -3185, -3303, -4140, -5495, -6958, -8229, -9303, -10279, -11121, -11681, -11913, -11903, -11608, -10737, -9157, -7249, -5556, -4206, -2986, -1835, -777, 481, 2402, 5082, 8278, 11799, 15499, 19097, 22276, 24932, 27093, 28760, 29936, 30740, 31285, 31614, 31705, 31582, 31356, 31171, 31137, 31212, 31192, 30831, 30108, 29214, 28277, 27156, 25658, 23824, 21783, 19554, 17091, 14552, 12241, 10238, 8315, 6303, 4393, 2897, 1825, 952, 154, -487, -889, -1140, -1404, -1726, -2004, -2148, -2271, -2504, -2812, -3099, -3412, -3729, -3697, -2980, -1800, -814, -392, -364, -419, -497, -695, -1034, -1447, -1950, -2677, -3626, -4450, -4702, -4340, -3790, -3443, -3274, -3084, -2912, -2980, -3312, -3682, -3978, -4328, -4771, -5125, -5250, -5192, -4925, -4332, -3516, -2839, -2512, -2427, -2443, -2572, -2826, -3117, -3426, -3909, -4665, -5528, -6198, -6576, -6859, -7281, -7892, -8566, -9170, -9644, -10005, -10337, -10736, -11220, -11720, -12148, -12490, -12750, -12905, -12951, -12918, -12802, -12549, -12136, -11570, -10841, -9962, -9031, -8150, -7356, -6665, -6110, -5628, -5110, -4588, -4231, -4090, -3988, -3766, -3453, -3161, -2896, -2646, -2550, -2783, -3324, -3940, -4484, -5076, -5937, -7120, -8430, -9578, -10330, -10652, -10789, -11101, -11659, -12148, -12326, -12401, -12716, -13227, -13636, -13909, -14287, -14789, -15102, -15081, -15016, -15145, -15181, -14709, -13837, -13115, -12878, -12979, -13072, -12899, -12483, -12061, -11784, -11512, -11136, -10844, -10731, -10438, -9592, -8445, -7592, -7148, -6621, -5650, -4548, -3928, -3790, -3373, -2227, -995, -580, -720, -341, 749, 1554, 1543, 1549, 2431, 3647, 4017, 3509, 3288, 3972, 4780, 4736, 4029, 3567, 3642, 3672, 3199, 2554, 2351, 2566, 2572, 2118, 1782, 2052, 2444, 2162, 1329, 767, 759, 749, 285, -422, -949, -1197, -1297, -1252, -890, -224, 338, 435, 266, 274, 378, 164, -217, -78, 689, 1291, 1104, 487, 235, 625, 1297, 1789, 1933, 1848, 1756, 1771, 1770, 1550, 1155, 922, 1046, 1286, 1317, 1184, 1169, 1345, 1549, 1728, 1989, 2306, 2446, 2315, 2135, 2139, 2244, 2244, 2200, 2346, 2672, 2877, 2811, 2669, 2622, 2554, 2356, 2164, 2112, 2107, 2029, 1849, 1527, 1112, 872, 960, 1075, 826, 282, -168, -348, -341, -219, -10, 156, 136, 21, 93, 433, 737, 679, 325, 74, 222, 649, 940, 839, 587, 638, 1024, 1317, 1303, 1272, 1437, 1490, 1132, 677, 637, 877, 755, 154, -255, -7, 468, 561, 376, 433, 780, 960, 783, 661, 1010, 1579, 1709, 1260, 913, 1281, 2034, 2355, 2093, 1911, 2236, 2644, 2589, 2273, 2260, 2489, 2389, 1887, 1573, 1716, 1823, 1443, 868, 644, 759, 696, 183, -439, -713, -669, -738, -1093, -1386, -1281, -937, -743, -744, -653, -375, -178, -260, -397, -230, 229, 619, 750, 817, 1030, 1279, 1389, 1479, 1741, 1996, 1848, 1322, 977, 1148, 1442, 1311, 885, 720, 865, 805, 339, -99, -125, 126, 344, 426, 380, 200, -40, -183, -208, -291, -548, -779, -645, -69, 667, 1237, 1593, 1968, 2539, 3102, 3237, 2897, 2567, 2574, 2600, 2278, 1889, 1959, 2482, 3015, 3323, 3486, 3550, 3534, 3632, 4009, 4370, 4164, 3331, 2484, 2141, 2090, 1824, 1337, 1157, 1705, 2866, 4101, 4800, 4654, 3877, 3087, 2825, 3010, 2948, 2091, 788, -10, 109, 576, 699, 544, 593, 936, 1209, 1172, 918, 577, 51, -868, -2186, -3491, -4222, -4316, -4492, -5717, -8147, -10738, -11940, -10815, -7520, -2997, 1628, 5554, 8705, 11557, 14602, 17852, 20910, 23331, 24858, 25587, 25986, 26627, 27738, 29114, 30402, 31397, 32078, 32503, 32726, 32767, 32621, 32206, 31412, 30248, 28864, 27442, 25967, 24268, 22255, 20138, 18314, 16932, 15761, 14489, 13034, 11414, 9615, 7701, 5851, 4178, 2733, 1702, 1281, 1290, 1206, 743, 101, -380, -647, -784, -736, -501, -417, -860, -1769, -2775, -3687, -4517, -5247, -5960, -6929, -8262, -9677, -10803, -11482, -11690, -11467, -10993, -10523, -10175, -9958, -9938, -10155, -10391, -10278, -9720, -9014, -8422, -7859, -7128, -6194, -5007, -3395, -1410, 431, 1564, 1904, 1764, 1441, 1076, 788, 640, 506, 154, -477, -1192, -1794, -2292, -2776, -3275, -3796, -4426, -5249, -6241, -7292, -8327, -9345, -10323, -11180, -11837, -12313, -12717, -13150, -13571, -13824, -13783, -13488, -13089, -12702, -12364, -12121, -12006, -11961, -11908, -11884, -11981, -12088, -11916, -11431, -11029, -11060, -11227, -10844, -9722, -8504, -7915, -7964, -8163, -8275, -8393, -8475, -8380, -8293, -8548, -8955, -8954, -8445, -7921, -7684, -7452, -6939, -6403, -6332, -6784, -7374, -7778, -7984, -8092, -8161, -8242, -8404, -8671, -9026, -9334, -9375, -9176, -9164, -9659, -10435, -11128, -11769, -12479, -13057, -13316, -13532, -13998, -14460, -14454, -14046, -13766, -13813, -13778, -13254, -12365, -11501, -10819, -10261, -9765, -9214, -8378, -7182, -5901, -4891, -4128, -3249, -2022, -717, 183, 631, 1097, 1913, 2799, 3275, 3271, 3030, 2613, 1922, 1172, 822, 939, 995, 575, -54, -420, -490, -459, -258, 193, 539, 335, -260, -647, -604, -548, -840, -1179, -953, -62, 897, 1275, 1039, 779, 1106, 2010, 2888, 3221, 3004, 2448, 1657, 836, 427, 603, 934, 873, 409, -66, -316, -415, -457, -455, -515, -793, -1229, -1574, -1757, -1955, -2234, -2418, -2355, -2090, -1703, -1249, -861, -668, -507, -9, 899, 1783, 2203, 2271, 2403, 2702, 2913, 2916, 2866, 2863, 2788, 2619, 2600, 2907, 3318, 3443, 3202, 2868, 2680, 2608, 2492, 2219, 1776, 1242, 736, 360, 179, 241, 536, 986, 1463, 1782, 1776, 1552, 1521, 1943, 2515, 2702, 2442, 2213, 2340, 2605, 2704, 2720, 2841, 2952, 2951, 3134, 3687, 4086, 3688, 2790, 2342, 2580, 2690, 2095, 1331, 1148, 1327, 1128, 572, 404, 850, 1260, 1149, 892, 1016, 1359, 1436, 1283, 1391, 1833, 2083, 1875, 1705, 2094, 2730, 2950, 2791, 2870, 3339, 3660, 3573, 3547, 3954, 4370, 4198, 3602, 3235, 3239, 3115, 2576, 1952, 1573, 1282, 866, 517, 448, 390, -52, -677, -869, -543, -365, -781, -1315, -1275, -842, -791, -1289, -1653, -1443, -1086, -1067, -1126, -759, -136, 151, 52, 105, 503, 804, 738, 652, 855, 1051, 853, 442, 259, 296, 183, -187, -549, -759, -980, -1307, -1582, -1734, -1923, -2222, -2437, -2411, -2247, -2130, -2077, -1985, -1806, -1588, -1329, -883, -132, 748, 1360, 1518, 1521, 1811, 2366, 2716, 2648, 2574, 2895, 3325, 3313, 2960, 2945, 3475, 3898, 3653, 3115, 3011, 3359, 3514, 3164, 2670, 2385, 2179, 1892, 1746, 1898, 1993, 1745, 1563, 1921, 2428, 2355, 1817, 1529, 1619, 1519, 934, 220, -191, -241, -140, -146, -383, -704, -765, -391, 111, 234, -187, -880, -1559, -2193, -2994, -4372, -6600, -9107, -10623, -10554, -9652, -8808, -7684, -5132, -469, 5995, 13227, 19843, 24732, 27651, 29165, 30000, 30566, 30979, 31221, 31210, 30950, 30691, 30812, 31407, 32123, 32569, 32677, 32604, 32438, 32131, 31465, 30003, 27405, 23965, 20505, 17580, 15063, 12709, 10875, 10024, 9860, 9541, 8896, 8670, 9358, 10316, 10544, 9876, 8966, 8244, 7600, 6918, 6276, 5573, 4544, 3350, 2534, 2248, 2016, 1306, 6, -1578, -2989, -4000, -4935, -6347, -8327, -10372, -12021, -13338, -14593, -15783, -16670, -17153, -17253, -16909, -16073, -14923, -13629, -12027, -9920, -7596, -5616, -4104, -2723, -1399, -538, -248, 53, 833, 1646, 1824, 1535, 1489, 1867, 2221, 2222, 1919, 1350, 397, -1022, -2781, -4603, -6268, -7824, -9474, -11153, -12436, -12981, -12934, -12669, -12272, -11564, -10589, -9702, -9056, -8374, -7535, -6960, -7090, -7648, -7923, -7724, -7565, -7864, -8343, -8511, -8396, -8467, -8884, -9307, -9489, -9681, -10243, -11134, -12113, -13136, -14243, -15253, -15945, -16428, -16905, -17201, -16908, -16029, -15056, -14291, -13438, -12139, -10622, -9436, -8676, -7870, -6720, -5526, -4740, -4353, -4036, -3638, -3263, -3013, -2921, -3097, -3608, -4302, -4973, -5674, -6632, -7877, -9135, -10172, -11100, -12246, -13664, -14990, -15827, -16202, -16495, -16915, -17239, -17137, -16577, -15845, -15152, -14441, -13563, -12475, -11254, -10038, -8992, -8166, -7382, -6406, -5316, -4480, -4082, -3814, -3268, -2501, -1953, -1868, -2053, -2243, -2360, -2439, -2524, -2743, -3203, -3799, -4268, -4518, -4735, -5027, -5166, -4867, -4209, -3533, -3037, -2613, -2005, -1027, 187, 1147, 1529, 1700, 2294, 3297, 4018, 4035, 3711, 3632, 3851, 3913, 3488, 2803, 2351, 2283, 2268, 1983, 1458, 892, 345, -169, -560, -859, -1330, -2112, -2885, -3145, -2793, -2286, -2090, -2085, -1724, -875, -143, 4, -15, 402, 981, 980, 436, 124, 340, 527, 225, -281, -540, -572, -578, -462, -145, 19, -297, -795, -943, -740, -628, -859, -1302, -1670, -1707, -1352, -853, -498, -217, 310, 1146, 1922, 2329, 2530, 2943, 3664, 4318, 4482, 4141, 3658, 3403, 3424, 3457, 3266, 2920, 2706, 2760, 2948, 3097, 3191, 3235, 3125, 2880, 2788, 3005, 3132, 2664, 1821, 1395, 1682, 2119, 2181, 2140, 2526, 3231, 3675, 3718, 3841, 4296, 4616, 4339, 3780, 3580, 3685, 3428, 2638, 1974, 1923, 2042, 1689, 1071, 925, 1347, 1634, 1365, 959, 899, 1021, 980, 893, 1034, 1234, 1142, 893, 983, 1529, 2084, 2282, 2316, 2572, 2997, 3228, 3197, 3229, 3441, 3497, 3142, 2622, 2306, 2113, 1727, 1170, 770, 598, 351, -123, -527, -591, -529, -713, -1039, -1045, -675, -477, -793, -1167, -938, -188, 396, 502, 529, 899, 1450, 1729, 1624, 1413, 1316, 1282, 1169, 942, 667, 442, 329, 229, -44, -539, -1123, -1665, -2078, -2294, -2416, -2752, -3378, -3847, -3676, -2984, -2311, -1926, -1581, -962, -113, 646, 1100, 1330, 1565, 1912, 2212, 2204, 1882, 1638, 1881, 2520, 2995, 2946, 2685, 2738, 3077, 3189, 2831, 2236, 1629, 1039, 622, 595, 803, 823, 653, 808, 1528, 2331, 2689, 2759, 2961, 3259, 3402, 3442, 3410, 3003, 2229, 1776, 1964, 2020, 1184, -6, -436, -12, 309, -22, -610, -1027, -1323, -1451, -1183, -854, -1154, -1917, -2241, -2050, -2402, -3807, -5396, -6335, -7100, -8358, -9429, -9004, -6949, -4080, -432, 4782, 11442, 18077, 23329, 26971, 29334, 30657, 31208, 31322, 30983, 29922, 28428, 27529, 27818, 28733, 29399, 29756, 30223, 30865, 31403, 31592, 31229, 30169, 28438, 25970, 22585, 18722, 15635, 14281, 14381, 14977, 15397, 15519, 15676, 16462, 18087, 19853, 20638, 20007, 18517, 16994, 15846, 14961, 13930, 12314, 10002, 7492, 5530, 4288, 3122, 1375, -783, -2657, -3936, -4971, -6144, -7419, -8569, -9581, -10568, -11515, -12276, -12743, -12846, -12588, -12125, -11656, -11122, -10272, -9002, -7483, -5881, -4192, -2381, -617, 723, 1345, 1310, 965, 491, -260, -1398, -2696, -3870, -4937, -6013, -6844, -6988, -6541, -6229, -6532, -7109, -7439, -7626, -8107, -8917, -9714, -10284, -10585, -10451, -9719, -8523, -7229, -6023, -4765, -3268, -1667, -405, 205, 261, -6, -593, -1616, -2967, -4372, -5699, -6987, -8264, -9514, -10762, -11984, -12990, -13577, -13779, -13870, -14102, -14438, -14634, -14566, -14437, -14486, -14589, -14415, -13920, -13401, -12975, -12303, -11043, -9367, -7792, -6595, -5615, -4621, -3665, -3001, -2803, -3106, -3888, -5017, -6196, -7204, -8167, -9342, -10642, -11712, -12465, -13197, -14093, -14929, -15453, -15742, -16043, -16393, -16688, -16941, -17144, -17100, -16682, -16131, -15670, -15086, -14130, -13051, -12215, -11496, -10555, -9468, -8600, -8097, -7822, -7625, -7482, -7512, -7878, -8555, -9319, -10021, -10650, -11136, -11416, -11632, -11929, -12093, -11773, -11029, -10256, -9634, -8979, -8114, -7085, -6053, -5120, -4326, -3582, -2654, -1412, -123, 758, 1204, 1733, 2711, 3824, 4541, 4881, 5311, 5917, 6166, 5667, 4752, 4010, 3484, 2721, 1486, 67, -1130, -1938, -2330, -2283, -1940, -1670, -1688, -1718, -1294, -412, 355, 456, -19, -429, -301, 129, 301, 128, 82, 454, 939, 1151, 1159, 1256, 1384, 1176, 477, -456, -1313, -2051, -2759, -3453, -4108, -4741, -5322, -5696, -5708, -5349, -4787, -4268, -3867, -3347, -2485, -1506, -865, -593, -238, 442, 1100, 1315, 1209, 1252, 1632, 2103, 2403, 2566, 2746, 2986, 3234, 3440, 3516, 3339, 2918, 2460, 2121, 1789, 1273, 628, 65, -316, -486, -332, 165, 776, 1314, 1904, 2688, 3505, 4113, 4516, 4840, 5067, 5084, 4898, 4704, 4686, 4827, 4951, 4952, 4938, 5050, 5219, 5247, 5059, 4716, 4223, 3520, 2689, 1973, 1474, 967, 222, -614, -1139, -1185, -968, -745, -536, -257, 70, 407, 845, 1472, 2123, 2467, 2423, 2312, 2464, 2795, 2959, 2853, 2711, 2712, 2732, 2618, 2471, 2432, 2353, 1963, 1324, 805, 548, 258, -326, -1008, -1439, -1625, -1829, -2024, -1913, -1490, -1197, -1254, -1233, -625, 368, 1030, 1074, 969, 1241, 1777, 2075, 1945, 1666, 1538, 1552, 1520, 1378, 1280, 1370, 1502, 1350, 871, 421, 244, 115, -269, -808, -1181, -1367, -1602, -1872, -1799, -1171, -297, 332, 609, 806, 1139, 1561, 1950, 2266, 2414, 2210, 1650, 1079, 892, 1082, 1259, 1053, 475, -72, -195, -10, -21, -346, -534, -401, -445, -995, -1550, -1531, -1180, -1130, -1450, -1665, -1519, -1214, -930, -539, 63, 707, 1191, 1513, 1773, 2051, 2429, 2835, 2966, 2675, 2274, 2162, 2331, 2508, 2561, 2519, 2433, 2406, 2548, 2803, 2953, 2862, 2570, 2133, 1536, 834, 212, -180, -428, -729, -1080, -1210, -955, -549, -327, -232, 67, 608, 1003, 940, 489, -107, -700, -1301, -2084, -3296, -4864, -6167, -6415, -5341, -3372, -1087, 1491, 4917, 9565, 14908, 19783, 23379, 25724, 27157, 27842, 27806, 27184, 26207, 25193, 24523, 24409, 24694, 25045, 25433, 26109, 27133, 28104, 28544, 28279, 27419, 26109, 24606, 23275, 22292, 21499, 20798, 20387, 20408, 20678, 20962, 21334, 21999, 22835, 23449, 23640, 23527, 23299, 23016, 22685, 22159, 21019, 19011, 16537, 14326, 12529, 10566, 8004, 5192, 2828, 1171, -43, -1066, -1955, -2753, -3530, -4238, -4821, -5359, -5932, -6473, -6913, -7263, -7473, -7422, -7117, -6668, -6027, -5010, -3703, -2568, -1980, -1810, -1696, -1614, -1903, -2757, -3960, -5200, -6418, -7704, -9023, -10180, -11009, -11488, -11687, -11690, -11527, -11150, -10536, -9833, -9258, -8826, -8360, -7828, -7428, -7255, -7091, -6705, -6141, -5549, -4871, -3937, -2802, -1767, -1040, -569, -278, -233, -570, -1309, -2366, -3596, -4861, -6127, -7475, -8933, -10267, -11155, -11553, -11730, -11852, -11769, -11342, -10709, -10032, -9253, -8332, -7497, -6974, -6687, -6435, -6194, -6040, -5919, -5718, -5476, -5333, -5299, -5221, -5048, -4933, -5046, -5400, -5945, -6699, -7631, -8544, -9263, -9906, -10708, -11612, -12392, -13035, -13635, -14041, -14060, -13849, -13662, -13426, -12945, -12283, -11605, -10944, -10375, -10092, -10106, -10218, -10344, -10614, -11072, -11553, -11868, -11996, -12015, -11986, -11936, -11915, -12010, -12302, -12768, -13298, -13811, -14304, -14812, -15314, -15721, -15920, -15825, -15398, -14673, -13736, -12653, -11390, -9907, -8291, -6722, -5328, -4186, -3367, -2808, -2271, -1654, -1240, -1364, -1849, -2085, -1814, -1427, -1270, -1090, -605, -143, -113, -227, 50, 552, 605, 18, -725, -1165, -1279, -1241, -1153, -1061, -983, -799, -301, 529, 1407, 2015, 2321, 2483, 2548, 2462, 2304, 2199, 2015, 1507, 815, 385, 309, 231, -36, -304, -559, -1083, -1865, -2408, -2400, -2226, -2507, -3314, -4092, -4352, -4191, -4016, -3967, -3874, -3692, -3572, -3479, -3082, -2266, -1531, -1457, -1828, -1820, -1184, -616, -632, -862, -901, -1001, -1351, -1536, -1309, -1100, -1268, -1546, -1622, -1589, -1539, -1298, -811, -395, -372, -651, -804, -563, -184, -141, -468, -691, -472, 55, 684, 1389, 2052, 2482, 2820, 3444, 4300, 4837, 4730, 4264, 3889, 3719, 3557, 3210, 2734, 2329, 1986, 1492, 941, 778, 1052, 1202, 907, 523, 347, 194, 14, 117, 483, 585, 225, -92, 104, 658, 1098, 1245, 1264, 1331, 1466, 1638, 1834, 2015, 2105, 2047, 1802, 1353, 798, 329, 47, -141, -400, -820, -1357, -1808, -1932, -1761, -1614, -1686, -1786, -1645, -1307, -1010, -849, -707, -465, -149, 133, 348, 566, 765, 783, 666, 771, 1197, 1476, 1311, 1127, 1349, 1667, 1614, 1322, 1116, 908, 482, -27, -383, -584, -785, -1095, -1458, -1614, -1362, -896, -555, -278, 223, 854, 1256, 1497, 2036, 2922, 3592, 3646, 3419, 3474, 3839, 4062, 3898, 3565, 3337, 3214, 3101, 2997, 2880, 2598, 2074, 1496, 1151, 1076, 1008, 725, 331, 88, 72, 168, 354, 734, 1259, 1678, 1831, 1818, 1813, 1851, 1858, 1776, 1639, 1561, 1590, 1609, 1512, 1418, 1505, 1686, 1707, 1519, 1293, 1142, 1022, 897, 814, 838, 962, 1077, 1111, 1237, 1699, 2343, 2653, 2451, 2188, 2278, 2539, 2554, 2249, 1825, 1371, 882, 500, 386, 401, 235, -140, -419, -445, -430, -561, -672, -528, -226, -29, 72, 296, 623, 810, 795, 697, 482, 17, -586, -1093, -1512, -1930, -2047, -1346, 267, 2315, 4345, 6404, 8763, 11400, 13928, 15907, 17063, 17418, 17373, 17475, 17901, 18357, 18551, 18553, 18629, 19015, 19810, 20857, 21798, 22345, 22451, 22176, 21632, 21101, 20851, 20847, 20830, 20686, 20531, 20437, 20398, 20485, 20782, 21092, 21020, 20515, 20087, 20186, 20610, 20784, 20530, 20230, 20143, 20032, 19605, 18941, 18132, 16947, 15272, 13575, 12347, 11426, 10352, 9214, 8474, 8167, 7840, 7256, 6693, 6360, 6021, 5346, 4427, 3583, 2913, 2311, 1758, 1327, 1011, 780, 716, 869, 1019, 836, 307, -226, -511, -726, -1206, -2000, -2847, -3522, -4048, -4585, -5192, -5793, -6302, -6742, -7182, -7597, -7877, -7954, -7842, -7583, -7245, -6911, -6614, -6289, -5905, -5589, -5491, -5577, -5616, -5460, -5195, -5007, -4955, -4965, -4985, -5024, -5087, -5163, -5297, -5551, -5898, -6211, -6440, -6669, -6963, -7238, -7404, -7510, -7662, -7837, -7897, -7742, -7402, -7002, -6637, -6267, -5780, -5203, -4725, -4481, -4411, -4392, -4359, -4280, -4175, -4152, -4287, -4501, -4644, -4683, -4700, -4829, -5168, -5639, -5972, -5981, -5828, -5815, -5986, -6144, -6237, -6427, -6766, -7046, -7145, -7262, -7597, -7994, -8173, -8137, -8059, -7990, -7911, -7940, -8177, -8522, -8823, -9101, -9459, -9884, -10256, -10526, -10738, -10971, -11272, -11639, -12042, -12435, -12782, -13093, -13382, -13634, -13797, -13852, -13849, -13825, -13731, -13499, -13170, -12835, -12555, -12346, -12199, -12003, -11619, -11095, -10635, -10276, -9859, -9370, -9006, -8859, -8770, -8632, -8523, -8512, -8510, -8435, -8350, -8295, -8166, -7868, -7485, -7140, -6782, -6286, -5727, -5348, -5223, -5169, -5009, -4796, -4631, -4469, -4227, -3982, -3853, -3775, -3579, -3237, -2877, -2569, -2299, -2071, -1931, -1900, -1900, -1795, -1554, -1364, -1407, -1552, -1513, -1313, -1249, -1391, -1517, -1526, -1535, -1582, -1551, -1426, -1337, -1345, -1371, -1319, -1156, -930, -785, -850, -1069, -1217, -1144, -960, -892, -1002, -1143, -1166, -1054, -879, -760, -799, -948, -1030, -973, -882, -829, -755, -686, -765, -962, -1005, -752, -431, -335, -440, -506, -459, -439, -493, -479, -353, -303, -474, -721, -787, -625, -423, -356, -395, -405, -312, -158, 13, 180, 302, 323, 263, 224, 263, 325, 347, 355, 385, 369, 239, 104, 174, 468, 753, 838, 799, 802, 861, 891, 876, 876, 870, 788, 683, 694, 831, 951, 972, 964, 984, 1012, 1069, 1164, 1188, 1019, 721, 467, 334, 292, 292, 251, 84, -175, -392, -495, -532, -584, -690, -855, -1026, -1102, -1064, -1032, -1134, -1302, -1331, -1131, -859, -746, -834, -984, -1098, -1208, -1280, -1171, -907, -765, -873, -970, -809, -508, -281, -74, 222, 472, 484, 346, 298, 391, 466, 436, 408, 514, 716, 876, 967, 1098, 1321, 1525, 1598, 1572, 1559, 1607, 1681, 1734, 1722, 1620, 1490, 1452, 1547, 1699, 1804, 1833, 1838, 1892, 1992, 2058, 2058, 2100, 2276, 2475, 2536, 2474, 2397, 2334, 2322, 2452, 2687, 2822, 2787, 2755, 2869, 3054, 3197, 3296, 3365, 3365, 3272, 3141, 3075, 3158, 3354, 3505, 3490, 3362, 3257, 3253, 3366, 3562, 3686, 3607, 3441, 3406, 3512, 3636, 3784, 3974, 4032, 3845, 3621, 3571, 3620, 3666, 3782, 3976, 4071, 3990, 3867, 3811, 3779, 3717, 3611, 3410, 3079, 2684, 2354, 2184, 2158, 2122, 1936, 1680, 1587, 1715, 1850, 1807, 1628, 1418, 1224, 1120, 1182, 1309, 1264, 952, 538, 251, 140, 80, -38, -112, 118, 780, 1720, 2680, 3551, 4353, 5069, 5651, 6134, 6628, 7127, 7475, 7550, 7452, 7429, 7617, 7956, 8311, 8630, 9014, 9572, 10247, 10809, 11129, 11346, 11663, 12090, 12532, 12959, 13336, 13553, 13600, 13668, 13907, 14198, 14334, 14349, 14474, 14809, 15205, 15507, 15745, 15978, 16204, 16427, 16730, 17075, 17223, 16988, 16525, 16179, 16062, 15976, 15741, 15400, 15068, 14820, 14704, 14748, 14854, 14895, 14867, 14815, 14699, 14469, 14207, 14029, 13901, 13666, 13301, 12964, 12733, 12512, 12236, 11989, 11818, 11605, 11273, 10933, 10672, 10364, 9825, 9103, 8409, 7830, 7248, 6563, 5822, 5110, 4424, 3739, 3093, 2539, 2091, 1749, 1514, 1321, 1030, 598, 151, -195, -527, -982, -1512, -1963, -2321, -2708, -3163, -3608, -3989, -4305, -4552, -4744, -4947, -5250, -5678, -6177, -6684, -7164, -7624, -8117, -8691, -9331, -9927, -10400, -10800, -11167, -11448, -11596, -11678, -11746, -11750, -11663, -11565, -11538, -11560, -11587, -11605, -11605, -11577, -11564, -11612, -11689, -11710, -11641, -11520, -11375, -11223, -11084, -10993, -10907, -10772, -10638, -10613, -10679, -10705, -10680, -10692, -10732, -10720, -10698, -10757, -10809, -10698, -10445, -10212, -10051, -9905, -9763, -9692, -9703, -9721, -9687, -9635, -9652, -9761, -9904, -10014, -10086, -10129, -10119, -10076, -10077, -10120, -10104, -10023, -10016, -10129, -10255, -10326, -10414, -10507, -10513, -10472, -10524, -10655, -10670, -10479, -10180, -9892, -9635, -9400, -9187, -8977, -8737, -8497, -8332, -8253, -8196, -8126, -8081, -8068, -8027, -7923, -7779, -7588, -7323, -7031, -6771, -6515, -6233, -6009, -5942, -5989, -6026, -6000, -5968, -6017, -6163, -6304, -6299, -6130, -5911, -5734, -5588, -5451, -5337, -5240, -5123, -5003, -4907, -4799, -4635, -4469, -4385, -4370, -4322, -4180, -3983, -3806, -3662, -3489, -3242, -2990, -2867, -2907, -2973, -2918, -2737, -2559, -2498, -2542, -2578, -2524, -2427, -2367, -2296, -2082, -1762, -1565, -1625, -1793, -1815, -1623, -1370, -1221, -1194, -1182, -1104, -977, -842, -683, -496, -346, -284, -237, -100, 95, 216, 200, 106, 20, -28, -66, -114, -159, -174, -169, -194, -233, -190, 4, 308, 611, 821, 894, 854, 792, 780, 793, 775, 702, 584, 436, 310, 288, 397, 576, 755, 913, 1060, 1200, 1334, 1471, 1586, 1606, 1475, 1229, 968, 764, 637, 576, 547, 497, 428, 424, 567, 831, 1119, 1363, 1542, 1630, 1599, 1486, 1388, 1351, 1300, 1139, 900, 721, 676, 714, 762, 812, 872, 911, 921, 953, 1026, 1066, 990, 829, 661, 499, 295, 64, -108, -196, -252, -286, -243, -106, 66, 237, 413, 583, 710, 782, 795, 721, 559, 385, 261, 133, -74, -305, -405, -332, -210, -129, -49, 64, 173, 273, 402, 516, 519, 446, 424, 444, 374, 191, 50, 67, 182, 301, 437, 644, 879, 1084, 1292, 1564, 1826, 1941, 1890, 1775, 1673, 1561, 1403, 1226, 1073, 955, 864, 819, 867, 1007, 1159, 1225, 1204, 1222, 1395, 1655, 1782, 1673, 1466, 1354, 1372, 1431, 1456, 1406, 1294, 1218, 1286, 1477, 1651, 1737, 1800, 1926, 2107, 2283, 2410, 2446, 2343, 2131, 1945, 1901, 1933, 1881, 1707, 1546, 1509, 1562, 1623, 1708, 1861, 2033, 2148, 2224, 2312, 2386, 2385, 2320, 2248, 2178, 2078, 1923, 1721, 1537, 1486, 1612, 1820, 1978, 2059, 2149, 2319, 2541, 2717, 2770, 2705, 2619, 2591, 2593, 2501, 2250, 1943, 1743, 1681, 1652, 1586, 1549, 1617, 1755, 1864, 1905, 1893, 1823, 1682, 1527, 1438, 1357, 1109, 615, 47, -341, -477, -508, -595, -682, -556, -110, 526, 1168, 1763, 2331, 2859, 3361, 3905, 4450, 4790, 4788, 4599, 4527, 4706, 5006, 5259, 5417, 5540, 5757, 6247, 7079, 8052, 8887, 9547, 10198, 10883, 11498, 12017, 12503, 12919, 13155, 13259, 13417, 13694, 13953, 14124, 14355, 14785, 15313, 15801, 16292, 16895, 17532, 18003, 18246, 18347, 18394, 18436, 18512, 18610, 18602, 18340, 17905, 17549, 17405, 17396, 17449, 17573, 17721, 17763, 17686, 17597, 17554, 17484, 17332, 17116, 16851, 16503, 16048, 15547, 15070, 14646, 14235, 13838, 13471, 13125, 12757, 12344, 11916, 11471, 10945, 10306, 9629, 8986, 8350, 7685, 7015, 6360, 5664, 4926, 4267, 3826, 3601, 3465, 3255, 2895, 2448, 2072, 1834, 1611, 1230, 663, 34, -525, -1004, -1514, -2139, -2807, -3346, -3684, -3929, -4237, -4658, -5133, -5570, -5892, -6095, -6291, -6643, -7210, -7852, -8367, -8695, -8980, -9392, -9927, -10404, -10680, -10775, -10826, -10918, -11050, -11172, -11267, -11336, -11368, -11350, -11303, -11330, -11542, -11901, -12228, -12411, -12510, -12617, -12724, -12791, -12834, -12875, -12890, -12844, -12712, -12472, -12140, -11836, -11697, -11739, -11828, -11837, -11783, -11737, -11728, -11755, -11850, -11982, -12035, -11949, -11821, -11764, -11748, -11670, -11531, -11404, -11319, -11249, -11168, -11120, -11131, -11173, -11200, -11193, -11160, -11127, -11134, -11213, -11312, -11321, -11181, -10960, -10771, -10653, -10567, -10483, -10372, -10200, -9976, -9789, -9679, -9560, -9387, -9243, -9185, -9124, -8983, -8809, -8671, -8532, -8356, -8206, -8146, -8081, -7904, -7689, -7581, -7531, -7381, -7162, -7025, -6959, -6818, -6621, -6510, -6483, -6397, -6203, -6000, -5850, -5700, -5512, -5327, -5162, -4969, -4755, -4611, -4548, -4450, -4264, -4092, -4017, -3976, -3885, -3746, -3589, -3409, -3226, -3118, -3113, -3126, -3099, -3110, -3237, -3393, -3456, -3459, -3503, -3577, -3625, -3646, -3605, -3386, -2974, -2548, -2277, -2116, -1919, -1664, -1418, -1169, -867, -618, -603, -791, -959, -978, -922, -868, -805, -760, -803, -891, -861, -653, -407, -289, -294, -287, -200, -61, 89, 240, 347, 353, 267, 168, 125, 153, 218, 267, 248, 156, 51, 25, 126, 318, 513, 612, 576, 485, 495, 648, 787, 746, 559, 400, 369, 417, 449, 410, 328, 273, 279, 329, 426, 589, 771, 888, 954, 1041, 1127, 1164, 1230, 1392, 1526, 1478, 1317, 1221, 1213, 1199, 1153, 1110, 1063, 991, 936, 945, 996, 1021, 1006, 995, 1003, 988, 916, 819, 734, 620, 429, 221, 120, 127, 132, 93, 66, 61, 24, -15, 8, 46, -14, -161, -293, -394, -542, -751, -953, -1093, -1194, -1297, -1410, -1506, -1565, -1575, -1537, -1476, -1420, -1375, -1316, -1237, -1176, -1175, -1209, -1218, -1183, -1145, -1122, -1093, -1038, -946, -786, -550, -306, -134, -10, 143, 330, 480, 559, 599, 631, 634, 606, 581, 584, 607, 655, 766, 929, 1066, 1134, 1192, 1313, 1482, 1623, 1717, 1796, 1880, 1938, 1951, 1937, 1915, 1880, 1834, 1804, 1799, 1794, 1769, 1759, 1804, 1879, 1936, 1980, 2048, 2120, 2155, 2181, 2247, 2315, 2322, 2293, 2288, 2304, 2301, 2291, 2293, 2284, 2238, 2159, 2067, 1993, 1986, 2042, 2081, 2048, 1967, 1894, 1853, 1857, 1897, 1920, 1887, 1829, 1775, 1715, 1645, 1610, 1609, 1583, 1511, 1457, 1464, 1510, 1563, 1630, 1715, 1793, 1846, 1896, 1957, 2010, 2046, 2096, 2146, 2144, 2116, 2166, 2294, 2376, 2395, 2471, 2628, 2739, 2759, 2765, 2774, 2723, 2618, 2539, 2503, 2460, 2399, 2339, 2277, 2219, 2200, 2239, 2285, 2284, 2241, 2201, 2167, 2076, 1863, 1528, 1132, 749, 444, 241, 105, -26, -150, -150, 112, 648, 1325, 2004, 2643, 3266, 3871, 4398, 4785, 5000, 5056, 5001, 4931, 4919, 4973, 5052, 5126, 5193, 5300, 5596, 6246, 7202, 8207, 9020, 9627, 10139, 10663, 11227, 11768, 12165, 12386, 12544, 12709, 12798, 12749, 12702, 12882, 13380, 14067, 14737, 15247, 15642, 16072, 16594, 17092, 17447, 17656, 17747, 17740, 17656, 17512, 17295, 17013, 16756, 16630, 16655, 16805, 17026, 17241, 17396, 17525, 17683, 17837, 17909, 17896, 17809, 17601, 17202, 16673, 16159, 15717, 15294, 14858, 14474, 14167, 13863, 13497, 13116, 12762, 12409, 12010, 11546, 10965, 10253, 9522, 8897, 8320, 7616, 6796, 6077, 5613, 5324, 5030, 4655, 4269, 3959, 3733, 3527, 3262, 2881, 2357, 1722, 1077, 468, -152, -827, -1479, -2023, -2502, -2986, -3452, -3825, -4121, -4399, -4697, -5049, -5484, -5968, -6438, -6903, -7417, -7971, -8518, -9044, -9544, -9984, -10329, -10570, -10700, -10742, -10790, -10884, -10977, -11020, -11032, -11028, -11029, -11163, -11509, -11902, -12123, -12227, -12391, -12591, -12702, -12729, -12723, -12640, -12483, -12337, -12193, -11979, -11770, -11710, -11741, -11685, -11543, -11470, -11540, -11703, -11855, -11890, -11774, -11606, -11520, -11506, -11487, -11430, -11351, -11274, -11237, -11288, -11381, -11460, -11560, -11728, -11883, -11929, -11910, -11907, -11890, -11799, -11661, -11517, -11355, -11159, -10984, -10868, -10780, -10680, -10577, -10497, -10431, -10358, -10272, -10190, -10101, -9965, -9759, -9498, -9220, -8970, -8778, -8661, -8585, -8509, -8424, -8363, -8361, -8406, -8451, -8456, -8413, -8322, -8163, -7931, -7666, -7405, -7146, -6877, -6636, -6467, -6369, -6326, -6349, -6411, -6452, -6457, -6460, -6457, -6414, -6340, -6252, -6113, -5884, -5634, -5437, -5273, -5097, -4950, -4910, -4955, -4969, -4889, -4765, -4677, -4637, -4618, -4607, -4584, -4505, -4346, -4147, -3968, -3830, -3739, -3728, -3827, -3995, -4119, -4126, -4063, -4039, -4096, -4161, -4135, -3999, -3798, -3558, -3257, -2891, -2537, -2303, -2211, -2178, -2122, -2061, -2059, -2116, -2161, -2150, -2103, -2024, -1898, -1752, -1609, -1413, -1099, -740, -486, -381, -337, -294, -307, -433, -632, -810, -919, -965, -967, -940, -889, -771, -519, -127, 291, 613, 826, 1001, 1174, 1300, 1311, 1204, 1034, 858, 689, 517, 353, 242, 223, 295, 426, 625, 913, 1246, 1523, 1714, 1875, 2038, 2141, 2135, 2044, 1903, 1720, 1521, 1374, 1309, 1275, 1236, 1242, 1369, 1584, 1783, 1920, 2037, 2158, 2233, 2211, 2108, 1956, 1748, 1482, 1209, 975, 747, 486, 259, 178, 263, 409, 525, 623, 753, 926, 1095, 1204, 1244, 1238, 1184, 1055, 854, 648, 510, 436, 354, 238, 131, 90, 107, 136, 160, 180, 192, 187, 170, 142, 83, -6, -93, -154, -205, -265, -286, -208, -42, 128, 252, 346, 435, 526, 641, 788, 897, 881, 758, 640, 623, 695, 760, 728, 628, 591, 694, 845, 926, 947, 994, 1077, 1146, 1176, 1190, 1187, 1160, 1122, 1109, 1119, 1126, 1110, 1098, 1133, 1226, 1357, 1497, 1615, 1689, 1727, 1770, 1843, 1901, 1879, 1790, 1715, 1696, 1707, 1726, 1756, 1783, 1772, 1747, 1791, 1941, 2126, 2242, 2272, 2271, 2272, 2267, 2244, 2192, 2103, 2023, 2003, 1988, 1875, 1706, 1634, 1664, 1652, 1559, 1503, 1527, 1537, 1474, 1374, 1276, 1186, 1126, 1128, 1169, 1166, 1081, 960, 900, 926, 967, 944, 861, 771, 693, 631, 623, 683, 762, 800, 812, 835, 860, 873, 903, 965, 1024, 1051, 1051, 1045, 1081, 1199, 1322, 1316, 1203, 1158, 1245, 1365, 1463, 1569, 1655, 1663, 1658, 1734, 1871, 1996, 2111, 2193, 2143, 1914, 1610, 1370, 1247, 1242, 1327, 1387, 1246, 900, 620, 662, 934, 1132, 1141, 1092, 1071, 1038, 974, 909, 825, 674, 493, 346, 220, 83, 18, 160, 464, 723, 866, 1065, 1476, 2028, 2573, 3050, 3446, 3723, 3892, 4056, 4286, 4573, 4879, 5189, 5454, 5593, 5628, 5750, 6134, 6741, 7378, 7938, 8428, 8871, 9283, 9726, 10266, 10858, 11376, 11755, 12038, 12279, 12470, 12635, 12864, 13197, 13558, 13859, 14113, 14398, 14765, 15205, 15649, 15992, 16217, 16409, 16655, 16908, 17083, 17148, 17126, 17047, 16933, 16824, 16748, 16712, 16701, 16675, 16614, 16508, 16383, 16256, 16165, 16147, 16154, 16056, 15782, 15394, 14977, 14565, 14210, 13968, 13770, 13466, 13007, 12504, 12061, 11687, 11362, 11074, 10759, 10322, 9774, 9250, 8830, 8425, 7920, 7371, 6875, 6434, 6019, 5654, 5342, 4992, 4582, 4209, 3915, 3617, 3253, 2869, 2506, 2100, 1586, 1000, 418, -121, -602, -982, -1302, -1706, -2235, -2723, -3030, -3232, -3450, -3688, -3948, -4314, -4782, -5225, -5584, -5955, -6412, -6885, -7292, -7641, -7986, -8317, -8587, -8793, -8983, -9188, -9363, -9449, -9468, -9506, -9627, -9822, -10047, -10262, -10433, -10557, -10684, -10859, -11071, -11266, -11396, -11442, -11418, -11370, -11336, -11315, -11282, -11251, -11247, -11254, -11266, -11324, -11443, -11577, -11683, -11771, -11845, -11886, -11937, -12046, -12177, -12209, -12112, -11963, -11854, -11823, -11846, -11861, -11810, -11695, -11595, -11576, -11599, -11590, -11567, -11604, -11677, -11667, -11557, -11422, -11286, -11144, -11064, -11075, -11045, -10848, -10574, -10381, -10260, -10114, -9968, -9910, -9891, -9782, -9591, -9451, -9399, -9327, -9195, -9086, -8985, -8784, -8501, -8305, -8223, -8086, -7821, -7555, -7402, -7307, -7166, -6973, -6789, -6640, -6508, -6374, -6244, -6128, -6025, -5923, -5792, -5588, -5299, -4998, -4776, -4649, -4543, -4393, -4212, -4016, -3796, -3584, -3444, -3371, -3301, -3231, -3187, -3107, -2919, -2715, -2646, -2703, -2764, -2785, -2790, -2770, -2726, -2724, -2798, -2867, -2843, -2756, -2716, -2773, -2860, -2871, -2768, -2587, -2420, -2338, -2352, -2386, -2374, -2309, -2207, -2088, -2007, -2036, -2141, -2218, -2242, -2286, -2364, -2397, -2354, -2313, -2340, -2394, -2401, -2366, -2339, -2322, -2274, -2193, -2134, -2134, -2169, -2215, -2294, -2419, -2529, -2562, -2558, -2595, -2677, -2731, -2733, -2729, -2740, -2722, -2640, -2531, -2454, -2436, -2446, -2459, -2480, -2523, -2551, -2521, -2465, -2458, -2493, -2481, -2380, -2265, -2198, -2135, -2005, -1831, -1689, -1594, -1494, -1380, -1302, -1277, -1252, -1186, -1117, -1093, -1095, -1070, -1025, -1004, -1006, -969, -869, -757, -686, -658, -647, -639, -624, -586, -540, -514, -515, -521, -505, -466, -425, -396, -366, -323, -280, -262, -256, -226, -183, -182, -246, -333, -394, -411, -395, -380, -414, -501, -583, -596, -531, -433, -371, -399, -480, -512, -475, -447, -462, -453, -409, -398, -403, -323, -168, -68, -57, -22, 91, 218, 311, 427, 583, 683, 667, 640, 741, 936, 1078, 1116, 1125, 1147, 1148, 1147, 1240, 1446, 1644, 1746, 1820, 1948, 2079, 2147, 2202, 2295, 2380, 2427, 2495, 2603, 2680, 2714, 2790, 2943, 3105, 3219, 3309, 3390, 3430, 3419, 3413, 3467, 3546, 3589, 3600, 3617, 3639, 3652, 3687, 3768, 3869, 3960, 4036, 4096, 4136, 4186, 4272, 4369, 4428, 4431, 4393, 4336, 4277, 4253, 4279, 4301, 4269, 4218, 4257, 4405, 4556, 4626, 4647, 4677, 4714, 4736, 4744, 4728, 4638, 4467, 4283, 4148, 4043, 3921, 3795, 3708, 3644, 3558, 3469, 3420, 3400, 3382, 3376, 3376, 3335, 3252, 3182, 3121, 3022, 2905, 2821, 2750, 2642, 2532, 2479, 2454, 2399, 2328, 2293, 2272, 2193, 2064, 1964, 1909, 1826, 1690, 1588, 1564, 1551, 1507, 1507, 1620, 1786, 1894, 1950, 2033, 2134, 2177, 2173, 2200, 2241, 2213, 2137, 2102, 2103, 2062, 1994, 1986, 2047, 2117, 2165, 2196, 2200, 2176, 2146, 2110, 1999, 1782, 1545, 1385, 1257, 1049, 806, 660, 603, 524, 441, 462, 574, 664, 700, 714, 681, 567, 430, 352, 319, 243, 105, -36, -123, -146, -104, 48, 342, 715, 1047, 1289, 1513, 1803, 2147, 2481, 2737, 2877, 2912, 2929, 3027, 3195, 3352, 3488, 3673, 3942, 4261, 4627, 5080, 5624, 6178, 6660, 7075, 7482, 7911, 8329, 8684, 8964, 9183, 9362, 9519, 9691, 9913, 10195, 10503, 10813, 11139, 11524, 11925, 12287, 12628, 13011, 13393, 13652, 13791, 13917, 14060, 14137, 14147, 14172, 14221, 14243, 14250, 14305, 14409, 14501, 14555, 14589, 14621, 14640, 14639, 14612, 14553, 14431, 14203, 13884, 13583, 13387, 13238, 13028, 12747, 12463, 12200, 11958, 11765, 11624, 11469, 11217, 10899, 10578, 10262, 9904, 9479, 9011, 8524, 8043, 7599, 7189, 6777, 6325, 5866, 5468, 5138, 4827, 4509, 4198, 3891, 3528, 3074, 2562, 2070, 1637, 1244, 829, 343, -193, -720, -1175, -1543, -1878, -2236, -2618, -2965, -3257, -3552, -3900, -4273, -4634, -5020, -5459, -5911, -6327, -6726, -7134, -7530, -7896, -8247, -8584, -8854, -9041, -9195, -9378, -9571, -9719, -9812, -9909, -10048, -10220, -10398, -10574, -10738, -10868, -10989, -11160, -11376, -11532, -11557, -11522, -11506, -11469, -11360, -11255, -11241, -11258, -11223, -11161, -11129, -11115, -11120, -11194, -11324, -11396, -11363, -11303, -11287, -11290, -11262, -11212, -11166, -11109, -11004, -10885, -10810, -10773, -10718, -10634, -10570, -10561, -10572, -10575, -10593, -10631, -10644, -10584, -10487, -10399, -10324, -10235, -10128, -9999, -9837, -9670, -9547, -9464, -9365, -9247, -9166, -9129, -9085, -9011, -8955, -8934, -8883, -8753, -8607, -8519, -8442, -8282, -8054, -7845, -7680, -7519, -7357, -7226, -7125, -7010, -6872, -6750, -6680, -6640, -6581, -6485, -6379, -6280, -6144, -5962, -5785, -5655, -5522, -5327, -5119, -4974, -4873, -4742, -4582, -4462, -4407, -4362, -4285, -4187, -4078, -3945, -3797, -3695, -3663, -3634, -3531, -3357, -3187, -3075, -3015, -2987, -2987, -3002, -2997, -2948, -2877, -2827, -2823, -2863, -2911, -2917, -2848, -2737, -2644, -2599, -2583, -2570, -2536, -2471, -2389, -2333, -2333, -2358, -2351, -2298, -2250, -2247, -2277, -2317, -2358, -2375, -2352, -2316, -2312, -2318, -2280, -2202, -2123, -2048, -1943, -1817, -1727, -1693, -1672, -1626, -1567, -1503, -1447, -1456, -1573, -1702, -1686, -1547, -1459, -1485, -1519, -1505, -1493, -1480, -1385, -1211, -1056, -971, -920, -876, -849, -835, -804, -747, -701, -691, -687, -633, -522, -415, -349, -281, -165, -26, 86, 172, 244, 284, 284, 293, 347, 401, 407, 378, 362, 355, 333, 312, 355, 489, 657, 765, 787, 800, 882, 1033, 1171, 1226, 1195, 1116, 1040, 1009, 1054, 1140, 1184, 1154, 1130, 1185, 1285, 1366, 1446, 1534, 1569, 1541, 1536, 1584, 1608, 1594, 1611, 1650, 1625, 1548, 1522, 1578, 1645, 1663, 1641, 1618, 1631, 1694, 1767, 1797, 1778, 1768, 1810, 1884, 1937, 1933, 1879, 1810, 1755, 1731, 1732, 1738, 1729, 1705, 1671, 1624, 1568, 1530, 1548, 1612, 1657, 1644, 1607, 1595, 1614, 1630, 1632, 1623, 1599, 1547, 1491, 1471, 1480, 1471, 1441, 1433, 1458, 1485, 1524, 1609, 1702, 1734, 1730, 1769, 1842, 1893, 1930, 1984, 2000, 1925, 1846, 1875, 1970, 1996, 1943, 1944, 2052, 2163, 2208, 2253, 2352, 2429, 2427, 2419, 2473, 2537, 2546, 2530, 2552, 2596, 2621, 2642, 2700, 2778, 2822, 2826, 2835, 2859, 2857, 2833, 2868, 3008, 3159, 3191, 3104, 3019, 3020, 3101, 3223, 3330, 3343, 3238, 3114, 3077, 3125, 3204, 3275, 3304, 3253, 3151, 3076, 3049, 3041, 3040, 3040, 3012, 2954, 2913, 2906, 2896, 2862, 2819, 2757, 2669, 2588, 2538, 2487, 2400, 2313, 2276, 2262, 2213, 2144, 2113, 2123, 2111, 2045, 1966, 1916, 1878, 1827, 1788, 1792, 1806, 1766, 1683, 1623, 1605, 1586, 1564, 1576, 1610, 1593, 1527, 1500, 1535, 1564, 1543, 1529, 1570, 1608, 1580, 1530, 1533, 1568, 1558, 1504, 1478, 1496, 1496, 1456, 1430, 1445, 1463, 1441, 1404, 1395, 1411, 1433, 1465, 1511, 1529, 1482, 1415, 1409, 1481, 1565, 1606, 1618, 1630, 1629, 1587, 1535, 1541, 1631, 1751, 1823, 1813, 1771, 1767, 1835, 1937, 2014, 2044, 2043, 2035, 2027, 2029, 2067, 2139, 2203, 2243, 2297, 2384, 2455, 2491, 2555, 2670, 2750, 2721, 2645, 2626, 2648, 2614, 2498, 2376, 2297, 2231, 2149, 2077, 2045, 2029, 2004, 1987, 1996, 1978, 1883, 1788, 1805, 1899, 1916, 1811, 1689, 1613, 1541, 1466, 1440, 1445, 1420, 1391, 1431, 1524, 1592, 1622, 1683, 1793, 1904, 1976, 2022, 2050, 2040, 2009, 2031, 2140, 2294, 2435, 2536, 2588, 2618, 2723, 2964, 3259, 3467, 3571, 3674, 3841, 4026, 4194, 4375, 4586, 4768, 4870, 4938, 5051, 5214, 5369, 5498, 5602, 5686, 5782, 5954, 6193, 6372, 6394, 6366, 6478, 6715, 6866, 6848, 6799, 6840, 6921, 6968, 6982, 6959, 6892, 6840, 6873, 6938, 6922, 6806, 6663, 6569, 6534, 6536, 6537, 6488, 6358, 6177, 6020, 5939, 5876, 5742, 5550, 5420, 5376, 5287, 5066, 4826, 4698, 4636, 4504, 4304, 4152, 4064, 3939, 3728, 3503, 3321, 3144, 2952, 2788, 2623, 2364, 2031, 1766, 1613, 1457, 1238, 1026, 864, 678, 426, 164, -49, -239, -449, -664, -864, -1083, -1359, -1646, -1882, -2071, -2256, -2455, -2658, -2878, -3102, -3293, -3444, -3601, -3800, -4023, -4245, -4467, -4692, -4888, -5022, -5126, -5276, -5502, -5744, -5912, -5984, -6021, -6093, -6221, -6374, -6521, -6657, -6782, -6884, -6960, -7044, -7158, -7285, -7372, -7410, -7450, -7518, -7583, -7609, -7616, -7627, -7629, -7623, -7655, -7738, -7800, -7795, -7780, -7817, -7870, -7880, -7863, -7875, -7904, -7895, -7848, -7816, -7797, -7749, -7685, -7661, -7661, -7620, -7546, -7497, -7466, -7418, -7378, -7373, -7374, -7342, -7310, -7297, -7266, -7199, -7141, -7122, -7084, -6988, -6895, -6880, -6892, -6822, -6688, -6609, -6609, -6601, -6549, -6506, -6490, -6439, -6331, -6230, -6179, -6122, -6011, -5890, -5815, -5760, -5650, -5493, -5365, -5280, -5176, -5033, -4926, -4889, -4843, -4714, -4562, -4476, -4435, -4355, -4232, -4104, -3976, -3835, -3696, -3581, -3471, -3353, -3239, -3151, -3079, -3013, -2944, -2867, -2777, -2688, -2620, -2568, -2495, -2404, -2335, -2293, -2234, -2153, -2093, -2066, -2034, -1995, -1992, -2009, -1992, -1953, -1974, -2065, -2122, -2078, -2008, -2006, -2036, -1995, -1895, -1840, -1861, -1870, -1809, -1742, -1743, -1794, -1826, -1819, -1817, -1843, -1873, -1888, -1904, -1939, -1978, -1990, -1963, -1916, -1877, -1851, -1821, -1782, -1761, -1764, -1753, -1695, -1630, -1634, -1694, -1712, -1650, -1592, -1604, -1629, -1594, -1538, -1513, -1473, -1372, -1261, -1201, -1144, -1019, -873, -807, -801, -735, -592, -476, -428, -356, -214, -81, -19, 36, 153, 303, 422, 521, 636, 755, 833, 881, 952, 1057, 1154, 1198, 1207, 1220, 1253, 1299, 1326, 1323, 1310, 1312, 1311, 1282, 1243, 1232, 1236, 1213, 1175, 1162, 1169, 1136, 1056, 985, 946, 880, 755, 629, 574, 551, 485, 402, 402, 508, 649, 804, 1044, 1395, 1773, 2116, 2490, 2984, 3553, 4077, 4503, 4844, 5099, 5255, 5335, 5381, 5388, 5313, 5131, 4883, 4638, 4425, 4200, 3943, 3698, 3530, 3435, 3383, 3379, 3435, 3520, 3564, 3564, 3587, 3671, 3763, 3786, 3735, 3666, 3623, 3610, 3600, 3546, 3415, 3235, 3070, 2938, 2807, 2662, 2504, 2316, 2097, 1868, 1628, 1351, 1070, 864, 741, 622, 458, 292, 177, 134, 168, 246, 314, 368, 459, 606, 750, 857, 956, 1076, 1205, 1315, 1379, 1388, 1374, 1394, 1457, 1503, 1487, 1438, 1411, 1418, 1415, 1365, 1284, 1234, 1245, 1276, 1274, 1253, 1275, 1368, 1504, 1636, 1724, 1764, 1815, 1941, 2108, 2218, 2245, 2261, 2319, 2398, 2445, 2427, 2341, 2238, 2170, 2099, 1959, 1788, 1680, 1618, 1523, 1417, 1370, 1373, 1380, 1415, 1505, 1614, 1712, 1826, 1958, 2071, 2155, 2238, 2321, 2382, 2402, 2377, 2312, 2242, 2207, 2195, 2154, 2071, 1985, 1921, 1862, 1791, 1725, 1696, 1707, 1736, 1753, 1763, 1783, 1818, 1847, 1845, 1823, 1811, 1835, 1890, 1935, 1930, 1884, 1841, 1813, 1766, 1695, 1649, 1643, 1628, 1565, 1482, 1403, 1329, 1270, 1240, 1210, 1164, 1139, 1164, 1212, 1247, 1275, 1299, 1317, 1368, 1467, 1568, 1624, 1666, 1731, 1786, 1793, 1767, 1721, 1641, 1538, 1453, 1388, 1310, 1208, 1089, 966, 869, 810, 757, 689, 657, 701, 758, 762, 764, 836, 947, 1025, 1084, 1183, 1314, 1418, 1498, 1612, 1765, 1892, 1963, 2032, 2148, 2255, 2269, 2208, 2166, 2155, 2076, 1907, 1745, 1633, 1492, 1305, 1155, 1059, 914, 713, 574, 545, 547, 533, 545, 589, 618, 619, 622, 647, 681, 703, 700, 685, 696, 744, 785, 746, 637, 557, 551, 517, 352, 112, -90, -258, -449, -625, -726, -786, -858, -901, -851, -736, -633, -568, -533, -533, -578, -642, -675, -675, -700, -801, -955, -1088, -1159, -1173, -1143, -1085, -1047, -1066, -1077, -978, -778, -623, -624, -759, -933, -1080, -1195, -1315, -1480, -1654, -1761, -1803, -1849, -1927, -1981, -1960, -1864, -1716, -1552, -1433, -1382, -1383, -1434, -1551, -1699, -1805, -1876, -2011, -2256, -2491, -2558, -2458, -2333, -2268, -2176, -1929, -1543, -1147, -834, -597, -403, -264, -182, -131, -109, -156, -289, -484, -709, -935, -1139, -1356, -1630, -1874, -1928, -1788, -1621, -1508, -1354, -1105, -844, -634, -415, -156, 51, 127, 120, 106, 35, -174, -463, -683, -802, -907, -1030, -1092, -1045, -945, -856, -760, -618, -440, -244, -37, 138, 213, 204, 208, 221, 138, -45, -206, -307, -431, -592, -694, -694, -661, -628, -550, -425, -335, -326, -354, -392, -504, -719, -959, -1162, -1360, -1546, -1618, -1569, -1508, -1466, -1340, -1088, -796, -525, -249, 11, 162, 172, 107, 15, -132, -336, -520, -647, -781, -936, -987, -844, -588, -343, -103, 176, 437, 595, 670, 750, 863, 954, 980, 936, 813, 597, 323, 53, -163, -300, -313, -218, -133, -163, -243, -194, 57, 411, 725, 937, 1038, 1022, 929, 833, 747, 592, 332, 28, -287, -645, -1026, -1353, -1599, -1784, -1856, -1715, -1360, -896, -398, 149, 760, 1369, 1872, 2218, 2422, 2505, 2468, 2321, 2113, 1895, 1697, 1571, 1602, 1828, 2160, 2441, 2563, 2492, 2250, 1933, 1667, 1490, 1307, 1008, 574, 76, -354, -532, -307, 296, 1097, 2032, 3285, 5042, 7166, 9306, 11194, 12614, 13226, 12722, 11127, 8711, 5733, 2431, -881, -3934, -6577, -8676, -10062, -10678, -10635, -9990, -8635, -6553, -4100, -1791, 193, 2035, 3822, 5315, 6224, 6510, 6336, 5892, 5339, 4803, 4350, 3983, 3641, 3266, 2937, 2766, 2574, 1977, 923, -242, -1427, -2943, -4822, -6526, -7576, -7983, -7899, -7323, -6333, -5197, -4145, -3269, -2686, -2524, -2707, -2984, -3226, -3531, -3910, -4072, -3695, -2772, -1552, -266, 901, 1756, 2221, 2430, 2545, 2505, 2177, 1631, 1046, 373, -619, -1922, -3186, -4128, -4774, -5218, -5451, -5487, -5387, -5065, -4329, -3252, -2301, -1894, -1973, -2198, -2374, -2461, -2306, -1729, -800, 247, 1288, 2267, 2972, 3107, 2580, 1546, 175, -1390, -2897, -4078, -4956, -5739, -6340, -6392, -5862, -5236, -4883, -4656, -4237, -3554, -2722, -1836, -899, 149, 1308, 2309, 2697, 2252, 1199, -59, -1294, -2462, -3482, -4210, -4577, -4626, -4428, -4134, -4033, -4282, -4596, -4458, -3746, -2923, -2481, -2383, -2263, -1971, -1684, -1571, -1709, -2223, -3181, -4367, -5408, -6033, -6025, -5183, -3657, -2048, -920, -329, 77, 684, 1669, 2860, 3836, 4315, 4413, 4398, 4336, 4105, 3641, 2976, 2132, 1139, 170, -529, -869, -975, -1013, -1078, -1254, -1591, -1967, -2162, -2156, -2179, -2350, -2439, -2169, -1612, -1010, -363, 466, 1285, 1632, 1345, 727, 139, -264, -394, -185, 231, 569, 702, 801, 1062, 1399, 1501, 1138, 360, -586, -1423, -1949, -2105, -1989, -1747, -1450, -1073, -614, -159, 189, 374, 371, 225, 111, 188, 383, 482, 398, 191, -101, -443, -731, -939, -1239, -1760, -2344, -2713, -2785, -2650, -2341, -1877, -1521, -1611, -2081, -2507, -2707, -2894, -3097, -2904, -1993, -539, 1043, 2432, 3374, 3680, 3488, 3225, 3048, 2653, 1988, 1720, 2373, 3434, 4007, 3992, 3900, 3829, 3484, 2922, 2490, 2118, 1384, 307, -497, -620, -305, 112, 694, 1511, 2228, 2494, 2400, 2232, 2119, 2170, 2607, 3495, 4595, 5665, 6673, 7569, 8053, 7799, 6891, 5791, 4852, 4003, 3020, 1940, 1115, 871, 1156, 1527, 1541, 1146, 657, 393, 423, 677, 1100, 1642, 2205, 2775, 3508, 4463, 5351, 5792, 5737, 5285, 4395, 3190, 2217, 1907, 2075, 2314, 2496, 2599, 2540, 2438, 2510, 2623, 2420, 1859, 1182, 533, 25, -126, 114, 495, 817, 1095, 1329, 1525, 1850, 2408, 3017, 3494, 3901, 4273, 4462, 4444, 4381, 4288, 3996, 3450, 2767, 2078, 1535, 1206, 849, 192, -465, -453, 397, 1548, 2401, 2724, 2624, 2507, 2781, 3341, 3666, 3593, 3483, 3561, 3671, 3711, 3769, 3784, 3566, 3149, 2799, 2678, 2731, 2825, 2873, 2852, 2775, 2615, 2335, 2047, 1952, 2062, 2153, 2068, 1881, 1708, 1572, 1458, 1313, 1049, 702, 461, 383, 278, 7, -314, -502, -444, -130, 253, 398, 274, 205, 346, 431, 266, 29, -95, -189, -346, -539, -823, -1319, -1997, -2702, -3332, -3814, -4033, -3948, -3632, -3182, -2705, -2364, -2236, -2215, -2189, -2156, -2117, -2116, -2321, -2765, -3100, -3028, -2765, -2682, -2745, -2738, -2724, -2791, -2695, -2188, -1475, -992, -899, -1004, -1108, -1170, -1231, -1322, -1489, -1794, -2215, -2617, -2848, -2835, -2573, -2140, -1721, -1525, -1591, -1742, -1752, -1552, -1238, -915, -568, -103, 516, 1217, 1872, 2366, 2626, 2640, 2471, 2198, 1845, 1402, 911, 448, 50, -282, -516, -589, -540, -529, -653, -792, -768, -568, -290, 50, 498, 996, 1412, 1659, 1731, 1699, 1687, 1743, 1729, 1537, 1304, 1219, 1259, 1291, 1273, 1179, 932, 583, 315, 196, 95, -110, -449, -888, -1324, -1695, -2163, -2935, -3829, -4393, -4491, -4415, -4410, -4418, -4306, -4002, -3473, -2778, -2092, -1517, -979, -409, 60, 246, 146, -109, -493, -1131, -2091, -3254, -4415, -5369, -5972, -6285, -6581, -6992, -7276, -7168, -6780, -6423, -6178, -5904, -5490, -4933, -4285, -3660, -3143, -2685, -2185, -1684, -1361, -1276, -1273, -1226, -1255, -1536, -2016, -2501, -2961, -3536, -4267, -5001, -5575, -5930, -6034, -5865, -5491, -5090, -4776, -4480, -4065, -3554, -3119, -2856, -2643, -2292, -1774, -1227, -768, -379, -7, 309, 450, 320, -70, -623, -1196, -1675, -2058, -2437, -2849, -3174, -3255, -3108, -2920, -2829, -2800, -2718, -2536, -2320, -2160, -2069, -1991, -1891, -1760, -1571, -1281, -917, -562, -220, 191, 688, 1130, 1374, 1440, 1426, 1292, 911, 312, -312, -875, -1421, -1947, -2415, -2877, -3334, -3587, -3507, -3282, -3106, -2847, -2306, -1566, -833, -138, 585, 1292, 1847, 2159, 2250, 2232, 2187, 2060, 1797, 1497, 1281, 1061, 654, 121, -257, -356, -365, -502, -739, -872, -788, -533, -211, 93, 351, 667, 1196, 1889, 2449, 2676, 2680, 2685, 2797, 3021, 3299, 3485, 3493, 3479, 3669, 4064, 4454, 4674, 4703, 4583, 4346, 3999, 3545, 3056, 2611, 2136, 1489, 783, 349, 314, 501, 771, 1152, 1605, 2027, 2445, 2920, 3348, 3660, 4034, 4674, 5501, 6303, 7027, 7716, 8246, 8323, 7774, 6733, 5517, 4304, 3056, 1770, 671, -49, -504, -929, -1304, -1421, -1214, -790, -184, 670, 1692, 2578, 3079, 3249, 3355, 3561, 3769, 3732, 3318, 2615, 1867, 1282, 897, 582, 226, -82, -156, 0, 150, 122, -9, -114, -236, -461, -693, -759, -692, -724, -1000, -1377, -1601, -1624, -1659, -1869, -2133, -2222, -2103, -1927, -1756, -1498, -1097, -659, -271, 134, 664, 1271, 1821, 2224, 2341, 1968, 1122, 128, -799, -1774, -2830, -3649, -4032, -4239, -4545, -4725, -4397, -3639, -2908, -2409, -1929, -1320, -725, -284, -9, 19, -218, -414, -267, 21, 96, 69, 269, 598, 666, 390, 17, -330, -765, -1378, -2055, -2580, -2822, -2865, -2902, -2974, -2846, -2243, -1237, -285, 194, 222, 103, 3, -141, -394, -670, -856, -932, -914, -794, -591, -361, -129, 111, 282, 264, 100, -49, -182, -419, -682, -704, -438, -162, -92, -143, -140, -66, -16, -58, -180, -369, -700, -1265, -1944, -2439, -2618, -2627, -2577, -2377, -1983, -1466, -752, 346, 1694, 2786, 3287, 3355, 3325, 3296, 3087, 2522, 1693, 944, 498, 235, -50, -350, -592, -837, -1105, -1223, -1110, -935, -820, -580, -43, 598, 1076, 1522, 2267, 3184, 3729, 3718, 3563, 3566, 3462, 2935, 2175, 1533, 985, 319, -335, -607, -433, -108, 232, 790, 1636, 2428, 2865, 3129, 3542, 3969, 4012, 3676, 3313, 2949, 2321, 1546, 1093, 1035, 998, 846, 832, 1066, 1373, 1622, 1803, 1877, 1830, 1772, 1816, 1983, 2244, 2535, 2764, 2915, 3069, 3227, 3251, 3058, 2742, 2423, 2083, 1674, 1281, 1073, 1093, 1219, 1359, 1610, 2095, 2682, 3049, 3109, 3135, 3291, 3374, 3177, 2797, 2363, 1831, 1223, 702, 270, -169, -480, -428, -130, 67, 138, 374, 903, 1515, 1980, 2291, 2584, 2931, 3266, 3487, 3581, 3594, 3532, 3386, 3204, 2982, 2579, 1927, 1215, 668, 269, -109, -464, -759, -1051, -1322, -1400, -1229, -1013, -951, -1009, -1033, -901, -603, -258, 4, 234, 585, 1023, 1318, 1374, 1361, 1463, 1647, 1756, 1683, 1478, 1307, 1284, 1350, 1388, 1426, 1574, 1792, 1909, 1884, 1906, 2156, 2576, 2960, 3222, 3489, 3899, 4383, 4746, 4929, 5062, 5249, 5430, 5523, 5580, 5704, 5897, 6065, 6153, 6180, 6178, 6167, 6177, 6196, 6130, 5913, 5640, 5496, 5488, 5432, 5211, 4921, 4723, 4636, 4526, 4263, 3926, 3769, 3849, 3852, 3564, 3270, 3303, 3469, 3372, 3060, 2843, 2765, 2643, 2423, 2148, 1821, 1463, 1112, 707, 157, -493, -1153, -1809, -2432, -2942, -3331, -3684, -3981, -4104, -4041, -3945, -3911, -3879, -3784, -3670, -3594, -3519, -3446, -3500, -3752, -4080, -4392, -4796, -5362, -5943, -6419, -6888, -7423, -7876, -8107, -8207, -8317, -8416, -8405, -8261, -8055, -7822, -7586, -7408, -7332, -7309, -7277, -7275, -7355, -7497, -7706, -7997, -8232, -8249, -8167, -8197, -8188, -7877, -7471, -7394, -7574, -7573, -7300, -7092, -7122, -7208, -7172, -7055, -6921, -6745, -6528, -6339, -6177, -5930, -5573, -5297, -5260, -5321, -5218, -4954, -4806, -4884, -4961, -4823, -4568, -4384, -4234, -3988, -3674, -3423, -3258, -3117, -2995, -2950, -2997, -3085, -3152, -3184, -3206, -3229, -3214, -3123, -2978, -2854, -2776, -2701, -2614, -2614, -2753, -2879, -2845, -2799, -2934, -3120, -3140, -3130, -3337, -3610, -3648, -3514, -3500, -3611, -3606, -3437, -3286, -3262, -3298, -3328, -3380, -3468, -3498, -3370, -3136, -2961, -2899, -2826, -2660, -2516, -2534, -2668, -2794, -2908, -3069, -3248, -3373, -3427, -3411, -3323, -3172, -2946, -2592, -2154, -1828, -1745, -1793, -1790, -1707, -1641, -1639, -1677, -1720, -1729, -1648, -1473, -1301, -1200, -1099, -932, -801, -801, -781, -572, -310, -210, -185, -15, 290, 567, 792, 1022, 1199, 1252, 1253, 1321, 1447, 1526, 1481, 1346, 1224, 1205, 1290, 1397, 1435, 1401, 1385, 1482, 1693, 1949, 2192, 2415, 2638, 2868, 3065, 3170, 3207, 3272, 3377, 3403, 3291, 3159, 3105, 3050, 2888, 2699, 2610, 2576, 2441, 2192, 2005, 1994, 2070, 2079, 2018, 2000, 2079, 2213, 2355, 2524, 2729, 2952, 3181, 3410, 3563, 3542, 3405, 3300, 3250, 3135, 2937, 2768, 2665, 2533, 2315, 2052, 1803, 1606, 1468, 1339, 1176, 1037, 1001, 1044, 1105, 1204, 1352, 1446, 1423, 1411, 1554, 1758, 1787, 1633, 1528, 1562, 1569, 1491, 1511, 1677, 1760, 1660, 1589, 1665, 1703, 1577, 1463, 1507, 1557, 1438, 1269, 1260, 1333, 1225, 910, 632, 506, 375, 144, -1, 99, 288, 331, 295, 433, 762, 1045, 1176, 1299, 1509, 1701, 1785, 1835, 1927, 1982, 1891, 1696, 1518, 1366, 1135, 804, 491, 280, 101, -145, -413, -555, -543, -509, -560, -595, -453, -176, 37, 167, 417, 887, 1381, 1704, 1929, 2227, 2538, 2672, 2632, 2592, 2572, 2364, 1884, 1340, 932, 576, 117, -357, -651, -777, -895, -939, -655, -59, 487, 780, 1017, 1397, 1755, 1851, 1776, 1808, 1982, 2076, 1987, 1890, 1963, 2137, 2228, 2214, 2225, 2286, 2312, 2312, 2387, 2479, 2375, 2034, 1665, 1415, 1238, 1098, 1034, 1011, 961, 976, 1195, 1553, 1831, 1931, 1943, 1969, 2006, 1987, 1879, 1728, 1609, 1564, 1605, 1745, 2002, 2317, 2535, 2538, 2423, 2416, 2539, 2578, 2452, 2379, 2511, 2717, 2853, 2978, 3161, 3325, 3388, 3324, 3095, 2706, 2298, 1993, 1740, 1437, 1108, 845, 702, 685, 739, 785, 881, 1183, 1676, 2113, 2358, 2558, 2890, 3336, 3762, 4070, 4227, 4327, 4532, 4821, 4965, 4839, 4580, 4353, 4139, 3849, 3472, 3008, 2417, 1702, 952, 289, -202, -559, -905, -1264, -1478, -1465, -1388, -1400, -1412, -1291, -1147, -1161, -1294, -1393, -1473, -1690, -2036, -2325, -2472, -2532, -2445, -2067, -1505, -1050, -699, -138, 707, 1561, 2248, 2901, 3589, 4170, 4575, 4949, 5363, 5657, 5692, 5583, 5490, 5358, 5046, 4597, 4156, 3748, 3334, 3003, 2859, 2864, 2945, 3164, 3620, 4232, 4851, 5511, 6354, 7306, 8103, 8667, 9194, 9796, 10280, 10444, 10354, 10176, 9900, 9438, 8866, 8319, 7730, 6985, 6232, 5677, 5194, 4553, 3886, 3463, 3214, 2912, 2590, 2408, 2357, 2378, 2523, 2799, 3135, 3493, 3820, 3960, 3915, 3891, 3926, 3748, 3249, 2680, 2223, 1712, 979, 131, -631, -1314, -2035, -2807, -3536, -4177, -4773, -5342, -5833, -6216, -6537, -6838, -7074, -7166, -7116, -7017, -6942, -6864, -6708, -6473, -6264, -6183, -6214, -6261, -6294, -6383, -6585, -6836, -7045, -7219, -7439, -7715, -7979, -8180, -8338, -8493, -8679, -8904, -9137, -9335, -9501, -9669, -9821, -9913, -9963, -10006, -9994, -9828, -9487, -9068, -8690, -8391, -8088, -7666, -7154, -6722, -6464, -6263, -5957, -5571, -5237, -4979, -4702, -4384, -4135, -4006, -3907, -3787, -3755, -3878, -4043, -4132, -4190, -4290, -4396, -4446, -4453, -4437, -4376, -4253, -4048, -3771, -3494, -3284, -3063, -2731, -2382, -2156, -1978, -1706, -1434, -1328, -1307, -1179, -977, -901, -1038, -1275, -1443, -1493, -1616, -2059, -2723, -3218, -3433, -3689, -4170, -4625, -4838, -4949, -5129, -5289, -5298, -5217, -5177, -5191, -5189, -5124, -5014, -4906, -4811, -4715, -4623, -4576, -4539, -4415, -4186, -4008, -4054, -4263, -4401, -4387, -4409, -4610, -4868, -5046, -5202, -5369, -5406, -5275, -5163, -5145, -5026, -4699, -4341, -4115, -3950, -3715, -3443, -3228, -3076, -2929, -2774, -2604, -2398, -2182, -2047, -1986, -1853, -1606, -1422, -1433, -1503, -1444, -1301, -1223, -1206, -1138, -1029, -976, -908, -668, -323, -92, 36, 277, 604, 787, 838, 973, 1185, 1296, 1318, 1396, 1506, 1553, 1595, 1728, 1891, 1979, 2018, 2105, 2268, 2438, 2524, 2506, 2474, 2528, 2639, 2716, 2758, 2828, 2913, 2965, 3016, 3145, 3336, 3481, 3500, 3402, 3275, 3225, 3244, 3205, 3054, 2896, 2809, 2734, 2628, 2554, 2532, 2487, 2414, 2397, 2444, 2483, 2519, 2620, 2749, 2794, 2770, 2823, 2997, 3148, 3148, 3076, 3083, 3175, 3227, 3183, 3088, 2976, 2828, 2661, 2520, 2388, 2196, 1944, 1742, 1657, 1603, 1447, 1222, 1114, 1210, 1372, 1411, 1334, 1294, 1360, 1449, 1493, 1532, 1621, 1723, 1771, 1793, 1858, 1966, 2060, 2133, 2206, 2270, 2298, 2317, 2370, 2459, 2569, 2670, 2708, 2659, 2586, 2566, 2578, 2552, 2454, 2288, 2074, 1880, 1776, 1731, 1668, 1595, 1580, 1621, 1649, 1659, 1740, 1929, 2154, 2332, 2480, 2670, 2919, 3185, 3423, 3594, 3680, 3719, 3761, 3751, 3618, 3410, 3207, 2948, 2546, 2087, 1702, 1365, 987, 594, 237, -96, -391, -577, -680, -801, -944, -1013, -981, -932, -908, -854, -742, -629, -532, -377, -145, 38, 94, 125, 205, 251, 195, 109, 36, -87, -264, -438, -627, -861, -1065, -1186, -1309, -1468, -1572, -1613, -1729, -1938, -2059, -2013, -1966, -2056, -2146, -2024, -1721, -1459, -1311, -1123, -771, -308, 142, 483, 691, 874, 1183, 1565, 1815, 1900, 1978, 2075, 2072, 1986, 1928, 1835, 1571, 1224, 1010, 913, 721, 376, 64, -66, -81, -105, -125, -51, 109, 289, 486, 757, 1108, 1491, 1850, 2158, 2448, 2763, 3046, 3191, 3224, 3261, 3287, 3180, 2978, 2829, 2691, 2419, 2077, 1871, 1768, 1528, 1123, 841, 868, 1015, 1005, 874, 897, 1180, 1537, 1754, 1833, 1920, 2123, 2382, 2527, 2460, 2280, 2162, 2132, 2070, 1899, 1657, 1422, 1236, 1091, 938, 727, 457, 162, -130, -402, -619, -787, -970, -1215, -1469, -1652, -1750, -1837, -1984, -2208, -2475, -2760, -3091, -3520, -4049, -4580, -5018, -5378, -5743, -6091, -6249, -6077, -5663, -5226, -4812, -4187, -3145, -1822, -564, 494, 1525, 2697, 3938, 5069, 6033, 6856, 7504, 7926, 8186, 8393, 8497, 8314, 7791, 7105, 6441, 5801, 5115, 4419, 3849, 3471, 3253, 3161, 3241, 3566, 4140, 4906, 5802, 6789, 7841, 8947, 10091, 11242, 12324, 13235, 13917, 14420, 14822, 15082, 15070, 14762, 14300, 13765, 13068, 12138, 11085, 10066, 9090, 8080, 7036, 6065, 5246, 4581, 4064, 3723, 3580, 3588, 3680, 3824, 4045, 4371, 4772, 5136, 5356, 5473, 5585, 5665, 5583, 5319, 4985, 4617, 4145, 3541, 2830, 2022, 1153, 320, -474, -1349, -2336, -3281, -4053, -4700, -5343, -5969, -6476, -6811, -7034, -7222, -7376, -7457, -7456, -7417, -7390, -7380, -7333, -7223, -7118, -7084, -7046, -6885, -6661, -6537, -6526, -6491, -6381, -6271, -6198, -6170, -6232, -6410, -6601, -6722, -6832, -7035, -7315, -7578, -7790, -7984, -8147, -8234, -8264, -8307, -8325, -8234, -8043, -7810, -7490, -7027, -6493, -5961, -5341, -4558, -3729, -3001, -2337, -1628, -919, -348, 45, 331, 544, 645, 611, 464, 212, -136, -517, -893, -1329, -1833, -2274, -2581, -2878, -3218, -3449, -3476, -3431, -3395, -3248, -2916, -2504, -2087, -1598, -1029, -509, -114, 248, 644, 941, 1003, 898, 760, 531, 84, -526, -1144, -1750, -2421, -3176, -3973, -4767, -5478, -6065, -6608, -7176, -7668, -7959, -8110, -8236, -8293, -8158, -7847, -7499, -7181, -6833, -6400, -5918, -5481, -5152, -4948, -4830, -4727, -4635, -4664, -4877, -5172, -5419, -5660, -5997, -6382, -6711, -7001, -7334, -7686, -7962, -8134, -8260, -8355, -8378, -8299, -8142, -7923, -7629, -7249, -6807, -6340, -5858, -5365, -4877, -4418, -3982, -3564, -3189, -2884, -2637, -2411, -2216, -2073, -1964, -1863, -1786, -1755, -1754, -1769, -1818, -1892, -1938, -1950, -1990, -2061, -2072, -1957, -1774, -1619, -1482, -1284, -999, -668, -319, 44, 384, 690, 1016, 1373, 1662, 1843, 2031, 2293, 2519, 2605, 2628, 2690, 2763, 2763, 2681, 2550, 2375, 2164, 1958, 1770, 1567, 1324, 1085, 928, 867, 846, 814, 780, 783, 853, 975, 1096, 1183, 1263, 1393, 1573, 1762, 1944, 2133, 2319, 2479, 2616, 2758, 2896, 2984, 2995, 2954, 2891, 2799, 2645, 2421, 2154, 1881, 1620, 1360, 1087, 825, 632, 532, 471, 360, 212, 150, 238, 360, 378, 345, 405, 554, 688, 820, 1046, 1330, 1535, 1661, 1838, 2111, 2372, 2505, 2516, 2494, 2487, 2455, 2346, 2199, 2105, 2071, 1989, 1792, 1566, 1456, 1468, 1474, 1377, 1237, 1148, 1142, 1222, 1383, 1568, 1723, 1922, 2254, 2649, 2966, 3226, 3565, 3994, 4398, 4721, 4984, 5206, 5402, 5603, 5805, 5941, 5968, 5918, 5854, 5796, 5734, 5659, 5556, 5384, 5125, 4850, 4653, 4527, 4386, 4186, 3980, 3847, 3817, 3857, 3909, 3972, 4106, 4303, 4441, 4475, 4531, 4695, 4847, 4842, 4736, 4669, 4636, 4525, 4308, 4059, 3824, 3552, 3180, 2733, 2298, 1909, 1506, 1035, 549, 139, -187, -501, -826, -1077, -1192, -1226, -1277, -1325, -1281, -1155, -1040, -966, -883, -776, -679, -602, -537, -525, -592, -667, -671, -675, -831, -1148, -1436, -1550, -1620, -1896, -2370, -2731, -2788, -2754, -2954, -3336, -3517, -3329, -3074, -3086, -3248, -3185, -2827, -2469, -2298, -2216, -2090, -1881, -1568, -1213, -1017, -1017, -960, -702, -474, -515, -704, -798, -778, -813, -1021, -1352, -1638, -1747, -1751, -1877, -2196, -2454, -2392, -2160, -2148, -2362, -2357, -1969, -1599, -1538, -1523, -1235, -772, -368, -49, 191, 314, 456, 825, 1285, 1394, 1038, 686, 763, 1017, 890, 317, -243, -449, -387, -345, -577, -1113, -1589, -1545, -1073, -823, -1159, -1657, -1674, -1157, -657, -633, -951, -1094, -764, -191, 125, -20, -288, -195, 268, 614, 510, 196, 95, 278, 503, 584, 504, 344, 225, 257, 379, 365, 59, -407, -741, -818, -831, -1019, -1344, -1516, -1368, -1038, -780, -667, -560, -335, -15, 282, 444, 435, 354, 404, 638, 794, 605, 269, 224, 406, 233, -533, -1402, -1874, -2166, -2862, -4086, -5359, -6190, -6574, -6822, -7102, -7265, -7050, -6329, -5152, -3703, -2199, -729, 835, 2689, 4754, 6644, 8060, 9147, 10279, 11492, 12363, 12566, 12300, 11958, 11592, 10934, 9854, 8526, 7158, 5803, 4491, 3347, 2481, 1870, 1471, 1400, 1813, 2687, 3825, 5131, 6682, 8493, 10350, 12035, 13566, 15039, 16379, 17402, 18043, 18367, 18392, 18072, 17402, 16473, 15380, 14145, 12736, 11161, 9515, 7916, 6418, 5032, 3808, 2817, 2080, 1554, 1241, 1227, 1547, 2093, 2683, 3258, 3890, 4606, 5291, 5808, 6122, 6292, 6342, 6226, 5883, 5341, 4710, 4048, 3290, 2359, 1324, 317, -639, -1618, -2625, -3569, -4399, -5156, -5871, -6493, -6968, -7309, -7537, -7633, -7584, -7464, -7344, -7201, -6964, -6648, -6343, -6106, -5911, -5694, -5421, -5128, -4869, -4642, -4392, -4122, -3899, -3764, -3696, -3689, -3786, -4014, -4332, -4705, -5146, -5660, -6201, -6713, -7192, -7648, -8027, -8248, -8308, -8269, -8149, -7910, -7515, -6958, -6255, -5453, -4595, -3679, -2686, -1631, -570, 449, 1388, 2187, 2816, 3291, 3614, 3735, 3626, 3322, 2859, 2228, 1444, 614, -153, -867, -1612, -2366, -2987, -3381, -3605, -3748, -3814, -3753, -3538, -3179, -2711, -2185, -1636, -1073, -495, 95, 683, 1217, 1612, 1812, 1845, 1772, 1588, 1219, 633, -110, -947, -1878, -2892, -3909, -4868, -5808, -6749, -7611, -8319, -8919, -9465, -9912, -10205, -10367, -10438, -10392, -10181, -9837, -9439, -9013, -8514, -7908, -7230, -6560, -5981, -5543, -5205, -4896, -4651, -4590, -4742, -4986, -5262, -5633, -6116, -6598, -7015, -7413, -7831, -8221, -8535, -8740, -8827, -8824, -8773, -8653, -8398, -8007, -7537, -6996, -6333, -5582, -4861, -4218, -3562, -2832, -2145, -1650, -1304, -963, -626, -413, -369, -424, -521, -639, -756, -882, -1067, -1312, -1569, -1809, -2035, -2230, -2379, -2515, -2657, -2757, -2773, -2723, -2633, -2473, -2212, -1882, -1543, -1199, -810, -380, 17, 329, 585, 838, 1081, 1251, 1302, 1244, 1150, 1077, 992, 813, 527, 182, -188, -565, -897, -1185, -1543, -2034, -2519, -2795, -2874, -2966, -3144, -3220, -3033, -2707, -2467, -2320, -2085, -1682, -1225, -852, -596, -395, -153, 173, 505, 718, 797, 868, 1021, 1183, 1214, 1082, 901, 778, 696, 565, 335, 48, -209, -380, -484, -565, -623, -639, -632, -610, -504, -250, 67, 310, 487, 745, 1152, 1594, 1944, 2231, 2571, 2979, 3342, 3568, 3720, 3928, 4236, 4513, 4566, 4386, 4214, 4258, 4401, 4355, 4065, 3737, 3537, 3444, 3376, 3278, 3103, 2856, 2673, 2717, 2948, 3138, 3177, 3226, 3470, 3858, 4214, 4504, 4835, 5249, 5670, 6022, 6309, 6580, 6870, 7147, 7367, 7512, 7589, 7595, 7516, 7387, 7288, 7221, 7053, 6690, 6279, 6047, 5949, 5721, 5333, 5059, 5019, 4990, 4801, 4610, 4620, 4786, 4922, 4934, 4885, 4909, 5067, 5274, 5403, 5442, 5484, 5556, 5585, 5537, 5508, 5556, 5553, 5353, 5040, 4805, 4637, 4380, 4018, 3668, 3339, 2965, 2578, 2222, 1856, 1488, 1202, 969, 669, 336, 143, 94, 18, -157, -314, -331, -218, -64, 50, 112, 184, 341, 575, 791, 926, 1030, 1151, 1208, 1136, 1050, 1072, 1071, 850, 489, 204, 15, -190, -411, -615, -868, -1176, -1390, -1407, -1330, -1294, -1294, -1252, -1154, -1020, -835, -597, -368, -210, -89, 48, 178, 267, 347, 415, 400, 320, 286, 288, 177, -63, -275, -412, -596, -880, -1160, -1366, -1563, -1816, -2087, -2290, -2386, -2407, -2430, -2520, -2655, -2690, -2532, -2316, -2242, -2263, -2153, -1894, -1687, -1603, -1498, -1322, -1209, -1229, -1280, -1280, -1289, -1395, -1588, -1797, -1988, -2183, -2407, -2633, -2830, -3018, -3228, -3433, -3575, -3659, -3747, -3851, -3886, -3786, -3634, -3557, -3524, -3378, -3084, -2787, -2581, -2415, -2230, -2053, -1929, -1907, -2007, -2125, -2133, -2142, -2394, -2826, -3088, -3058, -3022, -3204, -3435, -3468, -3335, -3226, -3164, -3057, -2932, -2879, -2822, -2648, -2445, -2341, -2247, -2034, -1797, -1656, -1525, -1312, -1127, -1067, -1031, -917, -801, -790, -850, -894, -904, -892, -821, -702, -650, -684, -638, -416, -187, -63, 118, 470, 782, 884, 968, 1275, 1717, 2044, 2186, 2252, 2349, 2514, 2706, 2786, 2623, 2290, 2029, 1943, 1854, 1611, 1350, 1243, 1218, 1176, 1244, 1537, 1905, 2168, 2380, 2662, 2998, 3318, 3608, 3852, 3994, 4017, 3975, 3947, 3975, 3980, 3784, 3328, 2810, 2462, 2242, 1886, 1265, 524, -116, -588, -951, -1245, -1443, -1512, -1461, -1308, -1052, -672, -177, 320, 622, 657, 594, 610, 584, 241, -439, -1181, -1751, -2165, -2548, -2928, -3192, -3185, -2877, -2368, -1712, -810, 361, 1612, 2757, 3854, 5062, 6360, 7553, 8476, 9113, 9569, 9954, 10247, 10306, 10056, 9603, 9089, 8543, 7932, 7308, 6772, 6336, 5944, 5652, 5613, 5869, 6292, 6812, 7481, 8294, 9132, 9947, 10802, 11664, 12372, 12856, 13212, 13490, 13590, 13424, 13028, 12516, 11920, 11179, 10271, 9279, 8302, 7333, 6302, 5224, 4232, 3443, 2822, 2256, 1728, 1361, 1251, 1329, 1455, 1597, 1790, 2030, 2233, 2330, 2299, 2156, 1905, 1536, 1035, 423, -244, -946, -1690, -2443, -3141, -3771, -4354, -4876, -5310, -5691, -6058, -6376, -6594, -6754, -6915, -7072, -7202, -7308, -7387, -7428, -7453, -7472, -7453, -7390, -7344, -7331, -7276, -7137, -6973, -6833, -6666, -6421, -6121, -5824, -5539, -5245, -4947, -4687, -4521, -4472, -4521, -4651, -4860, -5139, -5457, -5787, -6115, -6406, -6570, -6536, -6341, -6071, -5715, -5174, -4436, -3635, -2864, -2061, -1207, -435, 150, 632, 1120, 1548, 1769, 1774, 1684, 1588, 1440, 1162, 762, 334, -46, -410, -792, -1158, -1443, -1641, -1766, -1798, -1708, -1523, -1291, -1033, -761, -501, -268, -65, 69, 88, -19, -226, -496, -787, -1094, -1468, -1934, -2394, -2726, -2947, -3194, -3519, -3850, -4124, -4370, -4652, -4989, -5362, -5757, -6177, -6615, -7046, -7440, -7800, -8147, -8481, -8766, -8940, -9014, -9058, -9113, -9105, -8941, -8651, -8346, -8062, -7712, -7254, -6791, -6434, -6146, -5852, -5596, -5498, -5564, -5724, -5962, -6276, -6602, -6879, -7132, -7382, -7574, -7633, -7543, -7316, -6941, -6425, -5829, -5202, -4540, -3822, -3089, -2410, -1797, -1222, -712, -340, -119, 36, 198, 325, 311, 121, -150, -373, -508, -627, -788, -959, -1076, -1116, -1071, -923, -683, -411, -153, 91, 348, 630, 910, 1109, 1169, 1159, 1185, 1215, 1119, 911, 736, 642, 515, 303, 129, 101, 129, 72, -61, -146, -150, -183, -320, -498, -659, -844, -1092, -1312, -1408, -1465, -1645, -1924, -2067, -1962, -1815, -1870, -2041, -2031, -1775, -1539, -1514, -1548, -1401, -1104, -883, -845, -872, -811, -675, -616, -724, -910, -1035, -1116, -1277, -1538, -1757, -1835, -1857, -1935, -1997, -1880, -1574, -1232, -938, -611, -190, 269, 696, 1079, 1411, 1655, 1816, 1949, 2049, 2043, 1920, 1786, 1703, 1592, 1388, 1180, 1096, 1101, 1094, 1104, 1239, 1512, 1823, 2120, 2452, 2872, 3343, 3790, 4188, 4572, 4936, 5191, 5298, 5341, 5393, 5372, 5173, 4866, 4611, 4432, 4219, 3940, 3704, 3587, 3524, 3444, 3396, 3477, 3661, 3808, 3865, 3937, 4145, 4453, 4700, 4806, 4868, 5029, 5253, 5362, 5318, 5283, 5331, 5343, 5254, 5199, 5277, 5380, 5409, 5429, 5524, 5646, 5725, 5816, 5971, 6089, 6048, 5926, 5895, 5936, 5867, 5631, 5363, 5152, 4931, 4658, 4418, 4263, 4102, 3868, 3671, 3642, 3698, 3651, 3495, 3411, 3479, 3568, 3524, 3382, 3295, 3327, 3345, 3185, 2888, 2667, 2597, 2473, 2098, 1594, 1249, 1109, 921, 549, 200, 84, 83, -24, -175, -138, 80, 241, 248, 287, 518, 820, 969, 955, 967, 1112, 1265, 1280, 1210, 1213, 1301, 1341, 1275, 1201, 1215, 1264, 1237, 1119, 1005, 959, 940, 874, 745, 608, 521, 484, 451, 387, 320, 288, 276, 238, 189, 191, 245, 258, 172, 66, 52, 115, 137, 79, 31, 58, 95, 70, 31, 58, 91, 8, -187, -351, -431, -560, -847, -1189, -1423, -1578, -1819, -2152, -2397, -2495, -2617, -2882, -3127, -3149, -3027, -3000, -3101, -3111, -2930, -2706, -2570, -2416, -2130, -1841, -1741, -1748, -1616, -1352, -1259, -1497, -1826, -1961, -1997, -2236, -2693, -3062, -3168, -3209, -3445, -3803, -3941, -3721, -3421, -3358, -3429, -3274, -2835, -2456, -2354, -2316, -2067, -1686, -1457, -1438, -1437, -1333, -1222, -1205, -1239, -1267, -1355, -1578, -1872, -2100, -2205, -2265, -2416, -2673, -2852, -2801, -2663, -2614, -2527, -2226, -1917, -1907, -2032, -1858, -1371, -991, -985, -1174, -1227, -1034, -782, -738, -924, -1079, -1008, -871, -929, -1094, -996, -547, -157, -131, -172, 172, 814, 1294, 1430, 1421, 1474, 1630, 1789, 1725, 1346, 942, 843, 901, 727, 313, 4, -30, 57, 114, 150, 255, 505, 873, 1212, 1426, 1642, 2054, 2601, 2966, 2969, 2825, 2840, 2988, 3008, 2799, 2465, 2083, 1682, 1318, 990, 582, 50, -492, -971, -1407, -1748, -1878, -1848, -1857, -1961, -1962, -1696, -1266, -920, -769, -728, -709, -746, -935, -1325, -1882, -2537, -3226, -3928, -4649, -5313, -5735, -5783, -5574, -5304, -4864, -3910, -2396, -728, 737, 2068, 3471, 4958, 6390, 7576, 8320, 8607, 8692, 8794, 8820, 8578, 8087, 7501, 6912, 6398, 6046, 5834, 5650, 5498, 5547, 5901, 6435, 7008, 7691, 8606, 9617, 10474, 11164, 11895, 12713, 13406, 13789, 13887, 13851, 13793, 13636, 13196, 12468, 11726, 11150, 10547, 9717, 8835, 8204, 7796, 7362, 6833, 6363, 6057, 5848, 5596, 5257, 4924, 4685, 4503, 4267, 3971, 3681, 3393, 3046, 2678, 2376, 2095, 1666, 1090, 574, 237, -104, -651, -1280, -1724, -2013, -2426, -3049, -3653, -4071, -4428, -4923, -5561, -6184, -6721, -7241, -7805, -8328, -8676, -8869, -9053, -9268, -9342, -9097, -8619, -8166, -7852, -7529, -7031, -6438, -5990, -5768, -5610, -5375, -5184, -5242, -5524, -5804, -5964, -6152, -6521, -6994, -7365, -7557, -7666, -7764, -7775, -7577, -7168, -6633, -6001, -5214, -4239, -3163, -2110, -1127, -192, 691, 1444, 1988, 2314, 2443, 2374, 2105, 1696, 1231, 761, 292, -158, -538, -787, -869, -796, -624, -395, -106, 287, 776, 1273, 1685, 2003, 2283, 2544, 2732, 2793, 2725, 2554, 2291, 1925, 1458, 914, 334, -265, -904, -1569, -2179, -2683, -3125, -3556, -3939, -4224, -4442, -4651, -4840, -4986, -5152, -5416, -5771, -6131, -6458, -6804, -7202, -7607, -7958, -8247, -8478, -8629, -8688, -8689, -8672, -8619, -8489, -8297, -8120, -8020, -7970, -7884, -7754, -7677, -7717, -7814, -7854, -7848, -7889, -7972, -7992, -7906, -7810, -7755, -7634, -7326, -6898, -6473, -6030, -5446, -4731, -4013, -3339, -2632, -1871, -1181, -660, -250, 162, 557, 786, 799, 728, 723, 750, 682, 507, 365, 355, 407, 417, 440, 605, 875, 1095, 1250, 1502, 1895, 2266, 2496, 2667, 2882, 3091, 3199, 3209, 3183, 3124, 2987, 2755, 2481, 2207, 1916, 1579, 1226, 909, 619, 309, -1, -232, -370, -515, -735, -961, -1090, -1158, -1289, -1503, -1702, -1847, -2009, -2211, -2365, -2431, -2508, -2667, -2829, -2871, -2830, -2837, -2941, -3051, -3092, -3104, -3163, -3264, -3345, -3397, -3459, -3540, -3590, -3603, -3604, -3583, -3506, -3405, -3342, -3275, -3100, -2821, -2571, -2401, -2209, -1905, -1556, -1276, -1048, -777, -475, -258, -162, -87, 46, 175, 197, 123, 64, 100, 208, 313, 389, 483, 677, 1008, 1412, 1773, 2050, 2314, 2657, 3058, 3412, 3655, 3833, 4008, 4170, 4276, 4342, 4432, 4544, 4582, 4486, 4337, 4258, 4274, 4276, 4170, 3954, 3703, 3523, 3495, 3589, 3662, 3582, 3400, 3320, 3485, 3818, 4121, 4279, 4337, 4402, 4538, 4748, 4979, 5109, 5055, 4900, 4828, 4846, 4770, 4542, 4337, 4243, 4057, 3619, 3165, 3039, 3153, 3056, 2570, 2086, 2043, 2335, 2489, 2318, 2121, 2202, 2481, 2707, 2834, 2986, 3162, 3218, 3130, 3073, 3144, 3196, 3056, 2759, 2445, 2145, 1856, 1665, 1598, 1486, 1214, 983, 1066, 1390, 1613, 1620, 1668, 1988, 2421, 2640, 2626, 2692, 3005, 3331, 3390, 3269, 3256, 3393, 3452, 3326, 3194, 3200, 3235, 3169, 3104, 3181, 3305, 3336, 3393, 3677, 4056, 4197, 4088, 4069, 4326, 4632, 4694, 4542, 4402, 4339, 4222, 4005, 3824, 3779, 3754, 3598, 3380, 3312, 3444, 3592, 3595, 3511, 3488, 3520, 3481, 3332, 3169, 3044, 2879, 2607, 2296, 2059, 1928, 1845, 1710, 1471, 1192, 1029, 1048, 1130, 1110, 937, 679, 454, 354, 332, 222, -52, -386, -657, -856, -1003, -1131, -1342, -1693, -2026, -2174, -2244, -2467, -2802, -2988, -3009, -3144, -3463, -3619, -3413, -3223, -3456, -3885, -3990, -3780, -3739, -4028, -4288, -4266, -4199, -4374, -4622, -4539, -4113, -3787, -3863, -4058, -3892, -3344, -2892, -2887, -3119, -3150, -2924, -2782, -2912, -3093, -3083, -2971, -2943, -2929, -2736, -2399, -2120, -1922, -1624, -1199, -842, -631, -395, -64, 162, 168, 152, 318, 526, 536, 405, 391, 527, 569, 393, 183, 134, 176, 118, -60, -212, -204, -70, 28, -14, -85, 7, 247, 375, 261, 109, 140, 222, 52, -323, -558, -593, -801, -1384, -2012, -2274, -2222, -2190, -2328, -2495, -2514, -2317, -1969, -1633, -1484, -1542, -1635, -1602, -1525, -1630, -1960, -2286, -2398, -2378, -2438, -2584, -2636, -2515, -2347, -2257, -2216, -2158, -2073, -1966, -1819, -1661, -1585, -1630, -1708, -1677, -1525, -1426, -1541, -1777, -1875, -1729, -1564, -1643, -1908, -2008, -1725, -1195, -658, -199, 174, 445, 771, 1438, 2399, 3132, 3234, 2939, 2767, 2848, 2856, 2513, 1941, 1463, 1183, 867, 335, -170, -237, 162, 625, 819, 822, 962, 1476, 2284, 2982, 3184, 2975, 2811, 2884, 2867, 2392, 1509, 536, -384, -1384, -2581, -3754, -4472, -4642, -4679, -4833, -4656, -3629, -1983, -322, 1241, 2990, 4872, 6498, 7698, 8605, 9289, 9616, 9450, 8815, 7924, 7019, 6171, 5294, 4416, 3733, 3378, 3284, 3385, 3720, 4302, 5002, 5695, 6395, 7171, 8000, 8783, 9455, 10079, 10687, 11142, 11281, 11240, 11334, 11536, 11463, 10983, 10428, 10027, 9583, 8918, 8247, 7780, 7355, 6734, 6065, 5637, 5370, 4972, 4493, 4187, 3935, 3411, 2738, 2321, 2162, 1923, 1555, 1249, 1060, 1019, 1244, 1637, 1870, 1854, 1803, 1768, 1572, 1174, 693, 87, -808, -1985, -3205, -4283, -5225, -6116, -6970, -7723, -8317, -8750, -9010, -9043, -8847, -8525, -8169, -7739, -7216, -6694, -6200, -5635, -5016, -4580, -4435, -4382, -4281, -4295, -4595, -5083, -5595, -6150, -6799, -7447, -7953, -8323, -8629, -8827, -8783, -8488, -8093, -7694, -7189, -6472, -5671, -4988, -4423, -3835, -3244, -2734, -2215, -1597, -1084, -897, -844, -582, -193, -49, -193, -314, -325, -493, -897, -1206, -1252, -1338, -1656, -1892, -1796, -1621, -1576, -1415, -961, -499, -245, 45, 603, 1188, 1496, 1666, 2008, 2431, 2593, 2485, 2378, 2276, 1937, 1371, 832, 331, -361, -1265, -2160, -2941, -3669, -4311, -4760, -5090, -5503, -5935, -6057, -5789, -5464, -5327, -5229, -5002, -4759, -4614, -4507, -4428, -4497, -4731, -5009, -5286, -5593, -5924, -6271, -6645, -6995, -7293, -7639, -8063, -8387, -8511, -8602, -8756, -8801, -8646, -8460, -8313, -8021, -7509, -6960, -6487, -5954, -5285, -4647, -4167, -3705, -3076, -2388, -1912, -1684, -1466, -1111, -755, -581, -558, -543, -514, -536, -614, -699, -795, -915, -991, -963, -869, -726, -447, 3, 503, 951, 1432, 2047, 2692, 3190, 3530, 3822, 4056, 4099, 3950, 3761, 3568, 3248, 2777, 2308, 1920, 1514, 1030, 581, 265, -9, -343, -631, -766, -867, -1068, -1240, -1231, -1176, -1224, -1261, -1191, -1171, -1244, -1182, -923, -768, -896, -1078, -1061, -916, -876, -1044, -1333, -1582, -1680, -1672, -1729, -1968, -2305, -2531, -2554, -2526, -2681, -3024, -3276, -3210, -2961, -2809, -2780, -2651, -2290, -1763, -1218, -791, -522, -247, 208, 705, 965, 1015, 1086, 1196, 1215, 1188, 1195, 1095, 817, 631, 759, 979, 948, 745, 758, 1116, 1518, 1655, 1599, 1641, 1904, 2246, 2500, 2647, 2774, 2959, 3239, 3565, 3783, 3817, 3819, 3978, 4179, 4117, 3782, 3568, 3737, 4034, 4019, 3678, 3423, 3532, 3826, 3944, 3750, 3405, 3175, 3197, 3335, 3299, 3029, 2773, 2728, 2830, 3000, 3274, 3572, 3713, 3753, 3953, 4344, 4625, 4607, 4450, 4345, 4223, 3954, 3627, 3393, 3193, 2878, 2525, 2326, 2267, 2192, 2117, 2187, 2357, 2401, 2306, 2360, 2751, 3269, 3585, 3655, 3645, 3649, 3674, 3755, 3886, 3911, 3693, 3335, 3083, 3049, 3129, 3190, 3205, 3203, 3188, 3165, 3170, 3227, 3303, 3349, 3327, 3223, 3071, 2947, 2877, 2784, 2597, 2359, 2165, 2058, 2002, 1926, 1823, 1785, 1895, 2045, 2091, 2110, 2263, 2450, 2433, 2247, 2118, 2051, 1857, 1528, 1214, 919, 537, 114, -185, -366, -565, -782, -848, -705, -525, -425, -276, 57, 428, 586, 535, 507, 620, 732, 662, 438, 223, 109, 60, 6, -67, -140, -188, -204, -213, -227, -240, -243, -240, -210, -156, -150, -232, -304, -267, -204, -267, -430, -529, -529, -542, -605, -607, -498, -386, -349, -299, -168, -68, -93, -165, -218, -359, -654, -980, -1228, -1455, -1724, -2003, -2251, -2459, -2577, -2584, -2561, -2582, -2591, -2489, -2316, -2197, -2144, -2057, -1920, -1842, -1854, -1855, -1824, -1883, -2068, -2231, -2295, -2381, -2598, -2844, -2970, -2987, -3001, -3020, -2987, -2919, -2869, -2780, -2556, -2277, -2153, -2208, -2204, -2013, -1862, -1953, -2082, -1996, -1870, -1984, -2158, -2039, -1752, -1679, -1776, -1691, -1431, -1355, -1486, -1435, -1144, -1097, -1457, -1693, -1477, -1281, -1526, -1831, -1722, -1472, -1567, -1835, -1789, -1460, -1294, -1378, -1364, -1112, -876, -773, -545, -73, 322, 380, 328, 519, 893, 1078, 886, 501, 229, 170, 180, 74, -165, -385, -403, -163, 168, 293, 181, 240, 725, 1228, 1302, 1232, 1479, 1797, 1762, 1606, 1685, 1723, 1430, 1154, 1205, 1219, 885, 597, 776, 1092, 1043, 829, 1030, 1603, 1865, 1530, 1150, 1260, 1620, 1689, 1464, 1333, 1345, 1243, 1091, 1201, 1468, 1430, 1106, 1053, 1428, 1674, 1432, 1155, 1416, 2016, 2236, 1796, 1154, 823, 747, 475, -221, -1162, -2062, -2803, -3380, -3797, -4060, -4100, -3740, -2927, -1865, -691, 773, 2656, 4662, 6419, 7882, 9097, 9928, 10268, 10218, 9844, 9070, 7942, 6678, 5428, 4209, 3139, 2446, 2199, 2229, 2410, 2830, 3603, 4613, 5628, 6614, 7710, 8895, 9891, 10516, 10926, 11358, 11746, 11852, 11643, 11316, 10982, 10588, 10081, 9483, 8835, 8210, 7711, 7321, 6877, 6269, 5590, 5032, 4706, 4491, 4134, 3545, 2979, 2680, 2501, 2180, 1811, 1606, 1468, 1242, 1104, 1246, 1501, 1662, 1832, 2109, 2292, 2173, 1806, 1300, 617, -335, -1590, -3100, -4713, -6200, -7430, -8447, -9320, -10019, -10425, -10423, -10028, -9454, -8887, -8257, -7423, -6530, -5868, -5435, -5009, -4604, -4475, -4659, -4926, -5182, -5619, -6321, -7040, -7558, -8007, -8588, -9180, -9519, -9597, -9560, -9421, -9153, -8808, -8359, -7727, -7029, -6457, -5926, -5269, -4610, -4140, -3764, -3343, -2963, -2673, -2311, -1843, -1500, -1352, -1184, -868, -566, -451, -480, -558, -705, -971, -1304, -1619, -1920, -2216, -2436, -2521, -2497, -2323, -1913, -1364, -868, -365, 338, 1129, 1710, 2067, 2393, 2678, 2758, 2660, 2504, 2231, 1730, 1094, 505, -18, -605, -1312, -2047, -2670, -3157, -3591, -3996, -4245, -4290, -4295, -4367, -4339, -4038, -3627, -3385, -3304, -3171, -2970, -2906, -3055, -3261, -3417, -3647, -4075, -4598, -5026, -5337, -5655, -6032, -6404, -6720, -6989, -7221, -7395, -7526, -7664, -7803, -7881, -7882, -7822, -7653, -7332, -6965, -6667, -6354, -5897, -5380, -4939, -4538, -4131, -3826, -3663, -3469, -3159, -2903, -2846, -2880, -2846, -2779, -2801, -2907, -2993, -3039, -3100, -3169, -3189, -3151, -3051, -2812, -2437, -2051, -1661, -1100, -380, 292, 890, 1541, 2145, 2508, 2746, 3064, 3293, 3179, 2878, 2681, 2528, 2217, 1817, 1529, 1344, 1141, 942, 856, 871, 886, 880, 930, 1040, 1144, 1236, 1357, 1479, 1537, 1565, 1619, 1660, 1618, 1543, 1514, 1487, 1372, 1210, 1125, 1090, 965, 754, 623, 610, 546, 351, 161, 60, -65, -287, -486, -584, -711, -989, -1303, -1455, -1459, -1471, -1501, -1424, -1230, -1019, -788, -461, -83, 223, 444, 630, 770, 826, 807, 725, 582, 411, 244, 52, -185, -385, -442, -392, -366, -390, -352, -197, -12, 140, 324, 561, 759, 882, 1050, 1312, 1534, 1627, 1731, 1989, 2277, 2380, 2356, 2444, 2657, 2763, 2703, 2665, 2710, 2691, 2581, 2515, 2514, 2461, 2364, 2354, 2446, 2531, 2563, 2612, 2747, 2971, 3213, 3386, 3484, 3599, 3802, 4046, 4227, 4313, 4365, 4429, 4489, 4506, 4485, 4456, 4420, 4342, 4238, 4208, 4254, 4209, 4007, 3855, 3896, 3928, 3749, 3515, 3430, 3389, 3252, 3142, 3182, 3213, 3091, 2975, 3056, 3204, 3184, 3077, 3152, 3407, 3561, 3544, 3604, 3865, 4125, 4192, 4131, 4070, 4001, 3870, 3691, 3487, 3239, 2967, 2749, 2647, 2642, 2682, 2747, 2826, 2898, 2981, 3114, 3260, 3327, 3311, 3265, 3165, 2953, 2684, 2463, 2260, 1969, 1607, 1304, 1103, 921, 737, 644, 682, 753, 780, 833, 969, 1088, 1079, 999, 950, 894, 719, 445, 196, -9, -260, -549, -755, -847, -931, -1032, -1058, -1004, -973, -970, -899, -769, -715, -789, -890, -935, -963, -1052, -1200, -1345, -1449, -1531, -1615, -1701, -1777, -1841, -1904, -1988, -2083, -2145, -2158, -2175, -2223, -2237, -2160, -2050, -2007, -2046, -2108, -2135, -2122, -2126, -2232, -2438, -2600, -2583, -2444, -2378, -2433, -2407, -2159, -1852, -1708, -1678, -1609, -1534, -1560, -1636, -1702, -1850, -2097, -2277, -2341, -2484, -2796, -3066, -3114, -3095, -3247, -3495, -3569, -3420, -3227, -3066, -2878, -2712, -2676, -2649, -2407, -2019, -1822, -1926, -2070, -2055, -2030, -2127, -2154, -1921, -1656, -1685, -1920, -2034, -1932, -1748, -1577, -1490, -1568, -1721, -1725, -1547, -1397, -1391, -1391, -1284, -1180, -1219, -1313, -1290, -1163, -1068, -1017, -956, -911, -873, -739, -543, -486, -572, -568, -436, -392, -484, -518, -432, -369, -391, -435, -487, -544, -531, -417, -312, -313, -365, -347, -209, 21, 293, 568, 843, 1113, 1336, 1461, 1505, 1561, 1678, 1788, 1740, 1454, 1042, 717, 548, 378, 82, -201, -240, -53, 132, 245, 466, 929, 1506, 1995, 2382, 2765, 3123, 3333, 3363, 3288, 3135, 2881, 2541, 2146, 1709, 1278, 891, 507, 142, -41, 24, 153, 242, 456, 860, 1245, 1502, 1791, 2142, 2322, 2233, 2052, 1858, 1493, 917, 384, 112, 4, -107, -108, 246, 978, 1897, 2898, 3979, 5051, 5989, 6762, 7335, 7596, 7499, 7125, 6544, 5801, 5030, 4357, 3775, 3276, 2986, 3005, 3237, 3540, 3935, 4527, 5277, 6012, 6626, 7130, 7540, 7840, 8054, 8206, 8212, 7982, 7623, 7341, 7139, 6828, 6362, 5955, 5774, 5742, 5698, 5652, 5683, 5739, 5729, 5694, 5680, 5595, 5389, 5179, 5018, 4769, 4380, 4014, 3754, 3469, 3100, 2811, 2705, 2636, 2480, 2374, 2484, 2677, 2698, 2563, 2485, 2454, 2236, 1752, 1158, 577, -28, -681, -1323, -1906, -2408, -2791, -3021, -3114, -3086, -2964, -2785, -2606, -2465, -2360, -2285, -2259, -2333, -2526, -2776, -3014, -3279, -3668, -4124, -4484, -4725, -4981, -5260, -5417, -5439, -5477, -5587, -5660, -5641, -5604, -5604, -5622, -5648, -5695, -5749, -5780, -5796, -5839, -5892, -5893, -5829, -5762, -5727, -5690, -5605, -5483, -5349, -5206, -5074, -4987, -4942, -4894, -4826, -4784, -4818, -4926, -5049, -5132, -5175, -5212, -5238, -5201, -5074, -4892, -4694, -4469, -4186, -3856, -3524, -3217, -2933, -2673, -2455, -2285, -2148, -2038, -1974, -1977, -2027, -2079, -2117, -2176, -2291, -2438, -2539, -2559, -2550, -2578, -2618, -2582, -2450, -2292, -2159, -2018, -1837, -1646, -1498, -1389, -1283, -1177, -1108, -1085, -1074, -1053, -1040, -1062, -1113, -1163, -1195, -1215, -1243, -1288, -1342, -1390, -1420, -1449, -1503, -1568, -1601, -1598, -1607, -1643, -1665, -1635, -1584, -1556, -1533, -1461, -1346, -1239, -1153, -1043, -902, -791, -739, -705, -653, -609, -606, -636, -683, -745, -828, -931, -1051, -1184, -1318, -1446, -1571, -1676, -1740, -1746, -1693, -1586, -1439, -1277, -1114, -947, -784, -638, -520, -433, -393, -397, -419, -456, -534, -657, -786, -903, -1034, -1187, -1326, -1426, -1497, -1553, -1593, -1607, -1589, -1544, -1486, -1436, -1390, -1335, -1279, -1233, -1196, -1155, -1120, -1106, -1096, -1056, -976, -881, -809, -765, -718, -642, -562, -515, -494, -465, -432, -429, -457, -478, -479, -496, -549, -609, -634, -630, -627, -623, -588, -509, -403, -293, -173, -19, 152, 298, 394, 461, 530, 603, 656, 671, 639, 577, 518, 475, 433, 376, 318, 283, 266, 254, 261, 321, 424, 519, 573, 620, 696, 782, 835, 858, 888, 934, 972, 981, 977, 988, 1015, 1042, 1067, 1093, 1113, 1119, 1114, 1107, 1106, 1108, 1099, 1060, 998, 943, 904, 858, 787, 716, 675, 673, 702, 747, 788, 824, 881, 987, 1121, 1245, 1332, 1385, 1416, 1431, 1443, 1460, 1463, 1427, 1359, 1293, 1245, 1197, 1131, 1060, 998, 946, 909, 888, 881, 891, 925, 976, 1027, 1079, 1152, 1238, 1312, 1372, 1427, 1479, 1514, 1542, 1571, 1592, 1585, 1557, 1538, 1534, 1516, 1463, 1392, 1338, 1309, 1280, 1237, 1205, 1203, 1209, 1206, 1215, 1247, 1276, 1289, 1322, 1388, 1445, 1472, 1502, 1548, 1589, 1628, 1689, 1761, 1792, 1780, 1767, 1778, 1782, 1748, 1700, 1664, 1642, 1622, 1616, 1630, 1640, 1634, 1634, 1660, 1696, 1718, 1722, 1714, 1696, 1683, 1696, 1728, 1748, 1746, 1754, 1797, 1855, 1895, 1919, 1943, 1955, 1935, 1900, 1865, 1818, 1749, 1672, 1595, 1512, 1437, 1394, 1378, 1357, 1328, 1310, 1307, 1300, 1276, 1240, 1205, 1198, 1225, 1251, 1237, 1188, 1147, 1132, 1135, 1131, 1092, 1011, 924, 860, 808, 742, 681, 646, 612, 550, 475, 415, 368, 317, 258, 199, 154, 144, 164, 174, 160, 152, 168, 186, 199, 222, 253, 263, 257, 263, 287, 304, 298, 274, 240, 198, 152, 103, 46, -16, -74, -109, -113, -101, -93, -93, -86, -60, -27, 8, 69, 146, 194, 203, 218, 261, 300, 314, 329, 351, 348, 310, 267, 240, 219, 192, 158, 122, 94, 86, 85, 72, 57, 59, 78, 91, 95, 101, 113, 132, 153, 169, 178, 187, 205, 233, 262, 289, 308, 315, 317, 314, 304, 287, 285, 304, 312, 287, 254, 242, 243, 234, 215, 194, 166, 132, 104, 84, 69, 70, 88, 106, 109, 105, 99, 88, 81, 81, 72, 46, 17, 0, -20, -52, -81, -95, -110, -129, -144, -157, -178, -192, -183, -165, -162, -182, -212, -239, -261, -282, -307, -351, -417, -494, -561, -606, -627, -640, -660, -684, -701, -708, -711, -705, -686, -660, -651, -667, -682, -680, -676, -694, -719, -725, -718, -717, -716, -713, -723, -742, -739, -712, -696, -704, -718, -729, -745, -758, -755, -746, -760, -800, -859, -916, -937, -915, -889, -888, -883, -844, -779, -713, -649, -599, -577, -552, -502, -460, -474, -525, -567, -598, -636, -676, -722, -791, -871, -913, -903, -880, -873, -868, -850, -832, -836, -861, -895, -932, -980, -1046, -1115, -1160, -1175, -1161, -1113, -1016, -881, -750, -651, -566, -463, -350, -264, -221, -196, -170, -155, -172, -210, -236, -232, -204, -185, -199, -233, -241, -206, -143, -58, 56, 184, 299, 408, 531, 650, 757, 880, 1028, 1150, 1224, 1291, 1368, 1427, 1478, 1557, 1657, 1729, 1773, 1821, 1872, 1908, 1949, 2016, 2090, 2132, 2145, 2166, 2217, 2288, 2369, 2454, 2529, 2579, 2628, 2709, 2817, 2922, 3014, 3098, 3158, 3192, 3230, 3279, 3299, 3277, 3244, 3211, 3160, 3092, 3038, 2996, 2937, 2860, 2800, 2773, 2764, 2758, 2753, 2742, 2719, 2694, 2687, 2693, 2691, 2668, 2632, 2584, 2519, 2445, 2382, 2321, 2246, 2154, 2059, 1963, 1862, 1766, 1669, 1564, 1455, 1369, 1297, 1210, 1101, 999, 919, 853, 791, 733, 675, 610, 545, 487, 434, 369, 286, 199, 120, 36, -68, -194, -323, -445, -566, -691, -820, -949, -1079, -1201, -1309, -1405, -1497, -1581, -1657, -1730, -1805, -1864, -1898, -1922, -1969, -2045, -2124, -2191, -2250, -2318, -2399, -2487, -2582, -2687, -2791, -2886, -2970, -3050, -3130, -3208, -3277, -3337, -3390, -3442, -3491, -3536, -3569, -3591, -3611, -3644, -3683, -3709, -3719, -3731, -3752, -3772, -3788, -3816, -3861, -3910, -3949, -3979, -4018, -4077, -4141, -4188, -4207, -4212, -4220, -4234, -4232, -4200, -4156, -4123, -4105, -4083, -4043, -3992, -3947, -3916, -3892, -3868, -3838, -3804, -3776, -3758, -3743, -3716, -3677, -3646, -3626, -3595, -3533, -3458, -3415, -3409, -3402, -3359, -3291, -3225, -3168, -3113, -3059, -3001, -2922, -2823, -2734, -2661, -2581, -2480, -2368, -2261, -2160, -2079, -2013, -1931, -1833, -1760, -1730, -1706, -1654, -1591, -1538, -1485, -1417, -1335, -1253, -1169, -1078, -983, -886, -786, -686, -593, -508, -430, -348, -263, -182, -110, -48, 8, 66, 125, 178, 229, 278, 331, 386, 437, 483, 525, 565, 599, 637, 684, 740, 791, 837, 893, 965, 1042, 1106, 1157, 1208, 1265, 1321, 1367, 1398, 1418, 1434, 1443, 1442, 1431, 1414, 1397, 1376, 1349, 1321, 1291, 1267, 1252, 1254, 1264, 1276, 1294, 1327, 1372, 1423, 1469, 1502, 1518, 1524, 1524, 1516, 1505, 1489, 1464, 1423, 1377, 1340, 1309, 1260, 1190, 1125, 1090, 1071, 1039, 985, 936, 910, 901, 898, 887, 858, 825, 810, 820, 830, 826, 828, 850, 874, 871, 838, 793, 753, 720, 680, 618, 533, 445, 363, 277, 191, 121, 71, 24, -26, -66, -78, -67, -53, -36, -8, 25, 57, 84, 117, 155, 182, 192, 189, 178, 162, 144, 124, 93, 39, -25, -71, -93, -116, -148, -161, -144, -112, -79, -35, 11, 58, 126, 221, 306, 358, 413, 486, 547, 584, 625, 667, 675, 657, 646, 641, 629, 622, 628, 626, 606, 598, 616, 647, 685, 737, 787, 831, 887, 952, 1001, 1038, 1092, 1154, 1192, 1215, 1244, 1254, 1229, 1212, 1241, 1275, 1262, 1212, 1171, 1152, 1141, 1129, 1112, 1093, 1087, 1094, 1104, 1111, 1128, 1152, 1169, 1172, 1172, 1178, 1195, 1221, 1236, 1219, 1185, 1165, 1152, 1120, 1087, 1068, 1045, 992, 934, 892, 853, 807, 770, 739, 694, 662, 674, 696, 685, 670, 693, 729, 738, 727, 723, 719, 706, 694, 679, 647, 605, 564, 515, 453, 399, 370, 351, 332, 309, 274, 227, 197, 196, 204, 200, 199, 207, 205, 189, 182, 201, 226, 232, 222, 221, 236, 255, 258, 240, 212, 191, 177, 159, 135, 109, 93, 96, 117, 140, 153, 162, 179, 201, 224, 251, 280, 296, 301, 321, 360, 397, 429, 466, 503, 525, 544, 573, 592, 581, 559, 557, 571, 581, 588, 598, 613, 629, 652, 684, 721, 760, 799, 839, 885, 934, 973, 1003, 1045, 1101, 1146, 1163, 1178, 1206, 1236, 1253, 1264, 1266, 1256, 1247, 1252, 1258, 1246, 1237, 1248, 1266, 1269, 1268, 1279, 1307, 1351, 1402, 1442, 1465, 1486, 1512, 1525, 1514, 1498, 1491, 1492, 1497, 1506, 1510, 1496, 1468, 1449, 1449, 1455, 1439, 1395, 1334, 1285, 1265, 1262, 1246, 1205, 1159, 1135, 1136, 1137, 1123, 1108, 1109, 1126, 1140, 1133, 1109, 1091, 1091, 1088, 1055, 999, 946, 903, 856, 807, 766, 730, 694, 664, 630, 575, 518, 491, 480, 449, 408, 396, 406, 399, 375, 361, 353, 330, 289, 246, 213, 184, 143, 76, 1, -45, -62, -85, -141, -209, -249, -258, -267, -300, -346, -376, -385, -392, -420, -462, -503, -543, -595, -656, -707, -750, -796, -856, -927, -996, -1045, -1071, -1098, -1144, -1198, -1231, -1248, -1262, -1273, -1282, -1298, -1327, -1348, -1357, -1370, -1392, -1401, -1394, -1383, -1380, -1378, -1371, -1357, -1338, -1313, -1281, -1238, -1194, -1165, -1154, -1135, -1102, -1084, -1101, -1134, -1142, -1118, -1092, -1088, -1096, -1079, -1018, -938, -879, -835, -774, -696, -626, -567, -499, -427, -369, -322, -274, -235, -208, -173, -130, -100, -77, -47, -26, -20, 7, 68, 109, 114, 147, 226, 295, 336, 401, 494, 563, 615, 692, 783, 846, 890, 940, 988, 1020, 1055, 1104, 1137, 1137, 1119, 1099, 1077, 1060, 1052, 1054, 1055, 1050, 1042, 1037, 1042, 1065, 1097, 1118, 1117, 1117, 1148, 1198, 1228, 1224, 1216, 1231, 1252, 1245, 1213, 1184, 1151, 1090, 1027, 999, 977, 908, 805, 732, 698, 663, 612, 565, 530, 502, 481, 463, 434, 399, 372, 349, 312, 267, 231, 209, 189, 154, 102, 35, -34, -96, -156, -228, -320, -415, -494, -560, -632, -716, -793, -856, -908, -953, -1000, -1056, -1118, -1163, -1182, -1191, -1213, -1249, -1287, -1318, -1349, -1389, -1442, -1501, -1556, -1610, -1668, -1729, -1791, -1859, -1927, -1968, -1989, -2037, -2123, -2198, -2227, -2247, -2283, -2315, -2333, -2354, -2380, -2394, -2404, -2434, -2473, -2494, -2494, -2493, -2502, -2521, -2551, -2576, -2589, -2600, -2614, -2622, -2623, -2636, -2665, -2688, -2691, -2695, -2723, -2759, -2779, -2780, -2781, -2786, -2777, -2752, -2723, -2691, -2649, -2606, -2575, -2548, -2505, -2447, -2394, -2357, -2339, -2331, -2319, -2290, -2250, -2221, -2208, -2202, -2192, -2168, -2126, -2078, -2039, -2002, -1944, -1874, -1810, -1752, -1687, -1620, -1574, -1548, -1516, -1460, -1379, -1300, -1248, -1221, -1178, -1100, -1019, -961, -917, -869, -818, -769, -713, -658, -619, -582, -519, -449, -407, -385, -340, -263, -196, -160, -128, -65, 14, 78, 124, 169, 214, 258, 310, 374, 429, 462, 488, 516, 541, 562, 583, 603, 620, 646, 679, 708, 734, 761, 790, 828, 887, 955, 994, 1000, 1012, 1044, 1060, 1057, 1071, 1094, 1093, 1078, 1079, 1083, 1066, 1048, 1046, 1046, 1043, 1060, 1081, 1075, 1060, 1078, 1116, 1117, 1083, 1067, 1088, 1092, 1045, 990, 977, 987, 988, 994, 1020, 1031, 1000, 963, 974, 1015, 1031, 1008, 969, 944, 941, 946, 945, 940, 943, 946, 930, 891, 863, 864, 867, 842, 808, 805, 823, 814, 783, 778, 802, 807, 779, 750, 737, 714, 671, 628, 593, 561, 528, 506, 489, 458, 420, 409, 427, 438, 427, 419, 424, 418, 396, 390, 407, 418, 412, 410, 419, 421, 408, 407, 429, 444, 442, 456, 502, 533, 527, 531, 577, 613, 606, 602, 628, 654, 670, 701, 733, 736, 738, 779, 833, 860, 884, 938, 1000, 1032, 1042, 1053, 1072, 1094, 1115, 1128, 1134, 1147, 1170, 1188, 1184, 1166, 1159, 1173, 1193, 1195, 1176, 1159, 1162, 1175, 1179, 1186, 1215, 1251, 1272, 1278, 1290, 1317, 1348, 1360, 1339, 1286, 1236, 1209, 1178, 1115, 1048, 995, 924, 833, 781, 789, 791, 747, 695, 667, 642, 614, 597, 581, 539, 486, 460, 450, 411, 344, 293, 279, 259, 198, 126, 85, 69, 44, 0, -52, -106, -159, -209, -255, -305, -365, -437, -521, -606, -664, -690, -698, -720, -750, -764, -759, -758, -767, -766, -752, -758, -791, -833, -878, -935, -990, -1026, -1066, -1139, -1219, -1264, -1283, -1300, -1315, -1322, -1315, -1285, -1237, -1209, -1216, -1203, -1145, -1098, -1107, -1138, -1150, -1160, -1199, -1239, -1236, -1206, -1195, -1200, -1174, -1104, -1028, -976, -934, -890, -853, -824, -795, -781, -783, -780, -764, -757, -768, -772, -752, -721, -686, -633, -559, -482, -413, -339, -253, -173, -108, -45, 20, 67, 78, 70, 77, 88, 81, 62, 65, 94, 116, 118, 135, 191, 256, 297, 330, 382, 443, 498, 542, 577, 603, 633, 678, 717, 734, 757, 807, 854, 869, 876, 914, 976, 1029, 1063, 1091, 1122, 1151, 1164, 1165, 1172, 1198, 1224, 1231, 1235, 1252, 1269, 1276, 1297, 1338, 1368, 1374, 1391, 1427, 1447, 1442, 1444, 1462, 1465, 1442, 1419, 1410, 1404, 1389, 1366, 1345, 1334, 1339, 1344, 1334, 1319, 1317, 1326, 1332, 1331, 1325, 1316, 1306, 1294, 1281, 1258, 1224, 1191, 1173, 1160, 1138, 1108, 1097, 1111, 1121, 1104, 1073, 1062, 1069, 1067, 1047, 1028, 1022, 1016, 996, 969, 947, 928, 908, 886, 860, 839, 829, 814, 781, 754, 755, 751, 708, 660, 639, 617, 568, 536, 537, 518, 458, 414, 422, 430, 396, 354, 346, 349, 319, 258, 209, 187, 167, 131, 88, 53, 36, 30, 14, -25, -39, -3, 5, -73, -149, -132, -135, -280, -465, -568, -653, -787, -866, -802, -610, -243, 354, 1086, 1920, 3053, 4432, 5437, 5489, 4710, 3606, 2383, 918, -823, -2597, -3999, -4707, -4710, -4302, -3724, -2917, -1801, -669, -8, 71, -56, -157, -474, -1201, -2019, -2506, -2685, -2817, -2866, -2645, -2295, -2150, -2170, -1955, -1423, -1031, -1101, -1399, -1615, -1866, -2370, -2973, -3358, -3441, -3321, -3009, -2430, -1626, -808, -216, 60, 110, 1, -308, -795, -1248, -1482, -1542, -1529, -1415, -1189, -1057, -1258, -1782, -2454, -3182, -3945, -4603, -4887, -4654, -4027, -3229, -2335, -1337, -379, 253, 461, 457, 445, 368, 105, -210, -336, -268, -195, -179, -94, 104, 246, 184, -9, -187, -353, -615, -942, -1171, -1281, -1457, -1759, -1979, -2000, -2017, -2152, -2208, -2081, -1985, -2015, -1915, -1543, -1104, -737, -344, 91, 427, 594, 564, 236, -364, -1020, -1645, -2338, -3011, -3328, -3124, -2573, -1859, -987, 14, 929, 1522, 1751, 1728, 1471, 838, -252, -1565, -2621, -3078, -2964, -2533, -1965, -1294, -583, -24, 186, 38, -316, -748, -1224, -1709, -2061, -2105, -1798, -1297, -847, -620, -641, -801, -974, -1147, -1360, -1533, -1460, -1028, -278, 706, 1778, 2647, 3071, 3062, 2739, 2161, 1496, 1034, 834, 674, 517, 608, 996, 1366, 1456, 1294, 1018, 740, 585, 613, 802, 1139, 1579, 1927, 2022, 1936, 1741, 1285, 509, -250, -600, -514, -190, 265, 816, 1344, 1722, 1918, 1985, 2013, 2067, 2104, 2054, 1978, 2029, 2191, 2241, 2010, 1573, 1119, 766, 503, 271, 90, 95, 390, 889, 1402, 1832, 2153, 2296, 2196, 1825, 1154, 252, -516, -709, -297, 342, 950, 1594, 2320, 2924, 3174, 3060, 2693, 2135, 1424, 712, 262, 270, 700, 1314, 1868, 2287, 2642, 2939, 2988, 2575, 1728, 723, -173, -826, -1162, -1142, -811, -263, 407, 1075, 1570, 1788, 1765, 1576, 1252, 832, 416, 107, -67, -134, -100, 55, 324, 690, 1130, 1580, 1907, 2013, 1907, 1613, 1110, 462, -135, -542, -772, -831, -566, 145, 1148, 2069, 2607, 2687, 2362, 1683, 757, -139, -691, -840, -788, -619, -169, 590, 1328, 1702, 1688, 1365, 662, -372, -1351, -1842, -1809, -1512, -1095, -464, 383, 1153, 1472, 1247, 708, 134, -348, -697, -880, -932, -944, -945, -933, -1048, -1471, -2124, -2734, -3186, -3523, -3645, -3340, -2648, -1868, -1166, -447, 374, 1135, 1541, 1450, 992, 460, 132, 142, 420, 827, 1291, 1745, 1958, 1680, 937, -34, -1097, -2228, -3286, -4035, -4337, -4161, -3529, -2620, -1765, -1169, -777, -507, -478, -861, -1582, -2308, -2729, -2788, -2618, -2337, -1992, -1645, -1427, -1438, -1656, -1971, -2293, -2587, -2830, -2950, -2895, -2644, -2159, -1400, -497, 235, 601, 715, 787, 893, 1052, 1304, 1601, 1841, 2072, 2428, 2824, 2949, 2639, 2060, 1445, 831, 168, -479, -974, -1260, -1331, -1153, -790, -456, -278, -160, -41, -60, -263, -357, -10, 727, 1506, 2057, 2348, 2400, 2171, 1634, 861, -53, -1094, -2190, -3055, -3334, -2979, -2321, -1707, -1218, -804, -499, -367, -383, -461, -456, -165, 474, 1243, 1899, 2426, 2840, 2956, 2582, 1761, 699, -337, -1112, -1623, -2081, -2449, -2376, -1837, -1333, -1165, -1112, -1036, -1145, -1482, -1787, -1958, -2077, -2089, -1934, -1805, -1837, -1812, -1503, -1006, -507, -20, 464, 852, 1082, 1186, 1141, 824, 240, -376, -835, -1201, -1542, -1686, -1494, -1180, -1036, -1002, -829, -514, -268, -176, -131, -3, 274, 723, 1304, 1919, 2455, 2829, 3008, 3014, 2858, 2518, 2022, 1502, 1105, 865, 726, 679, 776, 1021, 1321, 1574, 1773, 1924, 1972, 1849, 1544, 1064, 449, -127, -465, -589, -649, -578, -187, 440, 972, 1283, 1511, 1708, 1742, 1543, 1190, 762, 279, -250, -783, -1196, -1363, -1314, -1210, -1100, -883, -586, -396, -364, -347, -320, -405, -570, -597, -418, -234, -256, -500, -862, -1260, -1664, -2069, -2442, -2750, -3028, -3313, -3490, -3377, -2992, -2534, -2073, -1519, -934, -586, -564, -628, -609, -734, -1275, -2032, -2466, -2372, -2071, -1897, -1772, -1432, -842, -239, 122, 194, 169, 284, 574, 875, 1086, 1303, 1592, 1807, 1764, 1592, 1624, 1958, 2312, 2448, 2527, 2884, 3594, 4395, 4993, 5310, 5498, 5726, 5992, 6092, 5825, 5270, 4756, 4528, 4522, 4529, 4520, 4605, 4785, 4891, 4825, 4682, 4631, 4717, 4865, 4995, 5106, 5240, 5384, 5417, 5187, 4679, 4089, 3608, 3217, 2816, 2480, 2338, 2310, 2211, 2068, 2022, 2025, 1904, 1658, 1474, 1447, 1450, 1272, 886, 536, 454, 493, 270, -242, -682, -877, -1053, -1362, -1652, -1809, -1915, -1989, -1960, -1884, -1906, -2044, -2224, -2439, -2694, -2924, -3082, -3202, -3307, -3347, -3281, -3151, -3022, -2920, -2878, -2952, -3094, -3115, -2949, -2808, -2910, -3172, -3350, -3406, -3480, -3584, -3577, -3498, -3608, -3943, -4166, -4080, -3933, -3953, -3958, -3727, -3363, -3011, -2601, -2123, -1769, -1617, -1522, -1413, -1413, -1548, -1646, -1589, -1461, -1396, -1358, -1237, -1043, -913, -930, -1052, -1184, -1240, -1224, -1275, -1506, -1808, -1947, -1857, -1656, -1407, -1072, -714, -531, -573, -618, -524, -479, -662, -859, -766, -457, -212, -83, 11, 4, -155, -296, -292, -366, -754, -1249, -1445, -1356, -1380, -1612, -1717, -1578, -1526, -1744, -1984, -2072, -2172, -2379, -2494, -2398, -2248, -2167, -2032, -1733, -1414, -1305, -1404, -1485, -1427, -1411, -1643, -2018, -2257, -2307, -2344, -2428, -2454, -2436, -2476, -2508, -2377, -2127, -1908, -1716, -1484, -1245, -1005, -721, -490, -460, -558, -604, -614, -674, -674, -517, -361, -373, -442, -376, -190, -12, 127, 259, 360, 384, 367, 379, 401, 326, 139, 41, 247, 674, 991, 1059, 1099, 1347, 1698, 1895, 1876, 1802, 1820, 1952, 2110, 2174, 2112, 2031, 2050, 2112, 2027, 1727, 1388, 1231, 1259, 1266, 1122, 948, 948, 1157, 1417, 1593, 1701, 1811, 1939, 2020, 1972, 1767, 1480, 1229, 1041, 819, 522, 237, 12, -243, -594, -911, -1007, -902, -823, -904, -993, -829, -417, -86, -92, -284, -289, -21, 207, 115, -156, -252, -83, 66, -38, -244, -243, -28, 105, 40, 0, 129, 184, -103, -600, -956, -1056, -1072, -1148, -1249, -1297, -1269, -1172, -1034, -932, -917, -920, -822, -631, -449, -286, -77, 127, 179, 64, -60, -65, -7, -46, -276, -589, -763, -727, -667, -735, -826, -769, -589, -416, -297, -226, -194, -140, -34, 18, -77, -208, -223, -191, -260, -390, -398, -215, 68, 327, 500, 615, 739, 871, 921, 827, 629, 405, 213, 120, 166, 297, 405, 444, 454, 466, 470, 450, 413, 377, 389, 519, 775, 1038, 1151, 1097, 1007, 973, 948, 861, 726, 590, 453, 325, 306, 457, 655, 719, 693, 810, 1152, 1552, 1882, 2182, 2450, 2573, 2527, 2444, 2424, 2431, 2363, 2153, 1903, 1872, 2108, 2302, 2272, 2328, 2702, 2984, 2685, 2039, 1682, 1753, 1858, 1762, 1647, 1753, 2080, 2480, 2814, 2988, 2963, 2811, 2661, 2534, 2314, 1959, 1674, 1693, 1928, 2077, 2084, 2160, 2322, 2327, 2138, 1998, 1940, 1741, 1400, 1184, 1147, 1074, 923, 906, 1116, 1397, 1558, 1551, 1467, 1471, 1676, 1998, 2189, 2101, 1859, 1685, 1592, 1439, 1215, 1024, 885, 789, 835, 1003, 1029, 802, 608, 667, 759, 628, 417, 392, 503, 521, 406, 310, 310, 303, 183, 18, -50, -23, -41, -105, -19, 271, 533, 596, 618, 768, 923, 895, 726, 563, 432, 281, 79, -158, -326, -313, -222, -291, -515, -636, -554, -413, -289, -137, 20, 149, 332, 588, 737, 688, 653, 807, 943, 780, 474, 457, 763, 945, 764, 523, 533, 695, 792, 791, 688, 475, 285, 227, 166, -38, -284, -499, -844, -1347, -1706, -1712, -1574, -1592, -1730, -1731, -1503, -1192, -946, -804, -772, -838, -916, -983, -1180, -1572, -1973, -2230, -2467, -2807, -3100, -3181, -3149, -3145, -3083, -2823, -2425, -2083, -1913, -1824, -1612, -1233, -958, -1056, -1408, -1646, -1601, -1367, -1061, -787, -616, -406, 29, 481, 526, 233, 126, 335, 393, 30, -377, -403, -162, -75, -271, -454, -344, -16, 258, 390, 540, 861, 1294, 1637, 1803, 1917, 2064, 2101, 1986, 1929, 1924, 1590, 941, 588, 684, 604, 143, -48, 281, 542, 495, 657, 1153, 1383, 1126, 933, 1149, 1374, 1180, 753, 505, 462, 343, 80, -93, -93, -134, -307, -350, -85, 198, 139, -138, -245, -148, -156, -381, -615, -739, -855, -1001, -1050, -960, -879, -934, -1049, -1064, -961, -867, -824, -734, -599, -643, -965, -1281, -1283, -1144, -1280, -1673, -1857, -1629, -1346, -1341, -1380, -1045, -431, -22, 19, 8, 155, 271, 196, 129, 279, 456, 379, 188, 267, 636, 886, 798, 660, 770, 951, 909, 790, 881, 995, 771, 388, 266, 264, -71, -630, -891, -806, -818, -1078, -1264, -1144, -896, -807, -903, -942, -749, -501, -446, -484, -363, -220, -409, -864, -1227, -1476, -1838, -2244, -2474, -2649, -2990, -3290, -3209, -2928, -2963, -3391, -3720, -3600, -3303, -3315, -3632, -3806, -3615, -3357, -3362, -3512, -3479, -3271, -3224, -3502, -3868, -4034, -4037, -4101, -4244, -4304, -4239, -4173, -4183, -4282, -4524, -4893, -5207, -5359, -5478, -5646, -5700, -5496, -5151, -4805, -4388, -3776, -3037, -2399, -2033, -1901, -1770, -1468, -1117, -943, -959, -1012, -1058, -1135, -1184, -1150, -1131, -1210, -1271, -1189, -1026, -889, -752, -566, -352, -122, 188, 594, 988, 1222, 1287, 1380, 1689, 2069, 2193, 2127, 2308, 2770, 2960, 2636, 2327, 2468, 2704, 2524, 2081, 1871, 1924, 1872, 1565, 1198, 911, 692, 630, 803, 958, 791, 507, 583, 1006, 1301, 1287, 1263, 1380, 1392, 1144, 884, 823, 759, 453, 59, -167, -302, -523, -736, -813, -886, -1058, -1162, -1057, -890, -829, -818, -765, -736, -785, -783, -627, -479, -533, -670, -637, -459, -353, -345, -309, -250, -253, -272, -255, -275, -381, -456, -414, -386, -527, -746, -818, -690, -500, -319, -79, 213, 474, 732, 1098, 1553, 1972, 2288, 2472, 2494, 2444, 2496, 2644, 2685, 2570, 2494, 2597, 2780, 2883, 2866, 2775, 2656, 2570, 2572, 2621, 2614, 2574, 2638, 2794, 2848, 2767, 2768, 2927, 3026, 2930, 2818, 2820, 2776, 2539, 2243, 2062, 1916, 1654, 1384, 1283, 1230, 994, 671, 544, 553, 383, 4, -287, -368, -399, -492, -560, -531, -464, -415, -362, -277, -194, -143, -90, -5, 65, 65, 53, 122, 180, 34, -269, -410, -253, -88, -206, -436, -385, -16, 341, 489, 589, 801, 1015, 1072, 1052, 1114, 1202, 1140, 960, 895, 1065, 1324, 1470, 1491, 1522, 1647, 1808, 1926, 2023, 2143, 2242, 2282, 2319, 2364, 2284, 2034, 1809, 1740, 1681, 1489, 1316, 1363, 1561, 1683, 1685, 1729, 1950, 2260, 2410, 2263, 1988, 1876, 1938, 1891, 1577, 1222, 1121, 1240, 1307, 1238, 1225, 1412, 1684, 1890, 2058, 2273, 2483, 2592, 2621, 2617, 2504, 2207, 1858, 1697, 1729, 1658, 1293, 922, 970, 1344, 1523, 1381, 1363, 1689, 2002, 2050, 2091, 2272, 2263, 1855, 1420, 1315, 1281, 890, 291, -20, 8, 29, -5, 188, 589, 859, 967, 1200, 1564, 1767, 1764, 1797, 1889, 1748, 1281, 788, 526, 364, 67, -313, -567, -620, -498, -214, 130, 380, 573, 864, 1193, 1321, 1208, 1048, 931, 765, 496, 193, -51, -172, -97, 177, 516, 762, 954, 1275, 1766, 2185, 2295, 2174, 2071, 1990, 1701, 1219, 864, 716, 458, -16, -318, -189, 103, 251, 304, 368, 386, 400, 606, 1021, 1410, 1570, 1515, 1403, 1380, 1420, 1313, 946, 493, 155, -107, -395, -627, -700, -705, -771, -879, -955, -990, -1019, -1089, -1281, -1606, -1931, -2117, -2141, -2073, -1991, -1956, -1920, -1747, -1422, -1156, -1105, -1130, -1048, -962, -1104, -1421, -1594, -1483, -1323, -1382, -1618, -1792, -1816, -1797, -1826, -1894, -1986, -2104, -2185, -2146, -2056, -2063, -2121, -2031, -1803, -1686, -1747, -1749, -1557, -1304, -1111, -987, -963, -1024, -1002, -850, -831, -1161, -1644, -1962, -2128, -2378, -2720, -2908, -2834, -2665, -2554, -2449, -2287, -2117, -1935, -1641, -1292, -1104, -1132, -1173, -1064, -888, -827, -948, -1132, -1182, -1043, -874, -818, -808, -736, -660, -670, -728, -799, -904, -986, -943, -870, -964, -1171, -1218, -1060, -971, -1104, -1237, -1107, -807, -614, -574, -469, -196, 98, 241, 221, 125, 24, -92, -330, -743, -1197, -1528, -1759, -1966, -2087, -2071, -2030, -2008, -1862, -1555, -1281, -1140, -1022, -888, -869, -967, -995, -923, -995, -1328, -1667, -1706, -1534, -1492, -1680, -1854, -1835, -1728, -1715, -1825, -1969, -2050, -2053, -2044, -2047, -1977, -1796, -1634, -1564, -1460, -1220, -966, -820, -694, -494, -298, -195, -127, -18, 98, 179, 268, 399, 517, 515, 350, 100, -115, -276, -463, -698, -876, -932, -920, -872, -726, -484, -279, -169, -21, 276, 630, 861, 948, 1047, 1260, 1467, 1448, 1232, 1140, 1337, 1532, 1377, 964, 632, 454, 240, -113, -541, -927, -1167, -1221, -1203, -1228, -1218, -1033, -738, -498, -332, -161, 21, 167, 244, 233, 121, -35, -176, -312, -440, -494, -473, -505, -663, -843, -919, -918, -969, -1142, -1383, -1571, -1628, -1587, -1552, -1571, -1551, -1368, -1031, -691, -454, -272, -69, 106, 153, 102, 122, 324, 622, 820, 827, 748, 754, 873, 996, 1044, 1031, 965, 845, 772, 874, 1087, 1194, 1114, 1005, 1045, 1221, 1393, 1486, 1574, 1763, 2009, 2149, 2141, 2137, 2240, 2345, 2350, 2304, 2273, 2217, 2113, 2003, 1848, 1537, 1118, 797, 636, 460, 172, -9, 123, 387, 446, 319, 320, 561, 822, 935, 978, 1019, 965, 803, 723, 835, 942, 832, 596, 427, 308, 181, 129, 157, 89, -85, -107, 107, 283, 216, 49, -41, -134, -354, -606, -716, -700, -711, -772, -776, -686, -570, -422, -189, 90, 323, 499, 671, 831, 935, 982, 996, 999, 1024, 1096, 1179, 1195, 1112, 976, 845, 723, 577, 396, 208, 44, -82, -152, -133, -34, 72, 145, 236, 390, 559, 721, 960, 1278, 1492, 1500, 1456, 1535, 1689, 1793, 1827, 1798, 1659, 1426, 1216, 1088, 976, 809, 617, 438, 237, -4, -218, -355, -486, -659, -791, -823, -810, -748, -530, -187, 64, 140, 201, 360, 529, 601, 570, 445, 216, -74, -348, -607, -913, -1243, -1508, -1706, -1934, -2159, -2192, -1980, -1770, -1799, -1936, -1852, -1491, -1118, -891, -683, -407, -187, -75, 76, 310, 439, 396, 370, 454, 492, 383, 252, 202, 157, 61, 0, 27, 26, -94, -230, -260, -291, -490, -769, -876, -767, -649, -636, -599, -395, -77, 200, 396, 583, 793, 973, 1073, 1109, 1083, 961, 745, 489, 178, -263, -772, -1140, -1307, -1459, -1695, -1846, -1764, -1570, -1410, -1222, -901, -529, -246, -6, 306, 625, 786, 815, 853, 865, 741, 582, 514, 396, 85, -226, -323, -341, -486, -656, -675, -632, -682, -755, -698, -548, -471, -515, -590, -616, -584, -492, -329, -158, -95, -144, -130, 73, 348, 497, 535, 593, 640, 545, 374, 278, 180, -99, -499, -792, -953, -1137, -1353, -1450, -1407, -1369, -1370, -1263, -995, -712, -495, -237, 57, 181, 90, 34, 156, 271, 190, -5, -141, -178, -155, -104, -44, 14, 68, 108, 175, 352, 619, 813, 850, 832, 838, 810, 733, 707, 744, 707, 565, 477, 521, 553, 479, 451, 592, 701, 535, 248, 183, 308, 283, 31, -183, -232, -260, -364, -439, -415, -381, -391, -359, -234, -91, 15, 166, 382, 519, 489, 414, 416, 418, 315, 174, 103, 61, -38, -104, 13, 234, 331, 275, 253, 345, 445, 507, 584, 654, 654, 666, 814, 1013, 1045, 930, 923, 1071, 1075, 817, 618, 706, 830, 725, 541, 482, 476, 444, 480, 551, 489, 342, 346, 499, 544, 415, 335, 420, 482, 367, 234, 302, 500, 607, 590, 564, 550, 519, 508, 533, 530, 491, 476, 481, 458, 451, 513, 586, 595, 542, 434, 263, 101, 48, 58, -10, -166, -274, -261, -192, -127, -52, 14, -10, -144, -259, -268, -262, -356, -508, -602, -617, -599, -539, -422, -329, -346, -414, -394, -277, -184, -177, -184, -171, -185, -235, -250, -237, -283, -400, -490, -510, -543, -637, -720, -718, -672, -613, -471, -245, -87, -65, -34, 86, 160, 133, 176, 355, 473, 409, 339, 424, 538, 473, 284, 159, 114, 46, 14, 132, 301, 349, 363, 503, 670, 689, 638, 669, 715, 681, 670, 782, 926, 988, 1010, 1073, 1144, 1163, 1170, 1223, 1284, 1262, 1164, 1076, 1026, 990, 988, 1050, 1109, 1064, 957, 944, 1049, 1105, 1032, 973, 1006, 985, 826, 691, 670, 588, 346, 112, 4, -99, -274, -385, -364, -370, -515, -660, -670, -649, -744, -861, -843, -780, -837, -920, -853, -729, -744, -855, -918, -952, -1023, -1070, -1048, -1031, -1075, -1141, -1187, -1177, -1082, -960, -924, -963, -974, -963, -1010, -1080, -1089, -1074, -1089, -1055, -899, -680, -438, -119, 244, 507, 620, 700, 833, 983, 1075, 1050, 896, 700, 579, 525, 448, 338, 277, 280, 287, 276, 268, 286, 360, 513, 692, 807, 853, 879, 882, 838, 780, 726, 639, 521, 452, 476, 548, 640, 759, 863, 897, 886, 874, 855, 816, 784, 738, 614, 406, 191, 20, -127, -266, -376, -454, -506, -519, -463, -320, -95, 165, 395, 550, 633, 657, 626, 565, 495, 370, 143, -130, -327, -418, -469, -524, -576, -632, -692, -711, -656, -564, -507, -511, -554, -611, -672, -742, -829, -925, -1010, -1060, -1053, -981, -867, -768, -733, -756, -800, -834, -838, -811, -784, -795, -842, -887, -919, -960, -1019, -1082, -1136, -1183, -1206, -1189, -1144, -1090, -1018, -904, -776, -691, -645, -570, -465, -420, -479, -572, -636, -692, -762, -804, -785, -739, -695, -618, -483, -350, -290, -283, -274, -285, -348, -391, -335, -241, -215, -235, -190, -74, 17, 55, 107, 204, 280, 274, 219, 151, 46, -105, -241, -319, -384, -478, -546, -519, -434, -386, -389, -384, -361, -361, -377, -365, -349, -398, -485, -531, -550, -608, -671, -646, -555, -526, -602, -684, -684, -626, -573, -542, -517, -511, -542, -562, -532, -501, -563, -726, -902, -1033, -1140, -1232, -1271, -1274, -1306, -1337, -1264, -1101, -980, -924, -816, -615, -418, -287, -185, -87, -31, -35, -65, -93, -116, -133, -138, -141, -159, -193, -215, -205, -181, -175, -185, -180, -150, -131, -156, -213, -256, -279, -321, -399, -479, -494, -415, -277, -129, 13, 162, 317, 455, 579, 696, 766, 728, 587, 431, 322, 226, 84, -97, -255, -366, -456, -541, -609, -660, -711, -727, -663, -527, -387, -286, -212, -141, -72, -15, 15, 34, 79, 161, 234, 245, 211, 174, 147, 130, 137, 166, 173, 132, 92, 106, 145, 124, 31, -66, -152, -265, -389, -456, -472, -519, -603, -613, -482, -275, -80, 101, 303, 496, 630, 719, 832, 982, 1105, 1153, 1160, 1166, 1147, 1094, 1094, 1187, 1258, 1206, 1139, 1194, 1288, 1264, 1155, 1100, 1101, 1073, 1039, 1078, 1178, 1264, 1321, 1387, 1457, 1485, 1463, 1426, 1389, 1338, 1300, 1304, 1326, 1332, 1359, 1425, 1452, 1370, 1246, 1165, 1104, 1001, 857, 693, 517, 375, 321, 339, 366, 380, 388, 382, 360, 334, 305, 268, 229, 154, -8, -225, -376, -427, -480, -594, -677, -658, -606, -585, -530, -374, -215, -200, -293, -323, -248, -190, -196, -177, -105, -69, -112, -177, -241, -349, -496, -607, -642, -645, -658, -679, -695, -723, -765, -776, -725, -657, -620, -603, -562, -492, -422, -368, -328, -297, -267, -217, -146, -91, -83, -92, -72, -28, 12, 52, 105, 134, 106, 44, -7, -59, -122, -154, -109, -20, 34, 57, 112, 202, 255, 264, 314, 420, 498, 517, 551, 628, 671, 645, 623, 663, 728, 765, 802, 895, 1013, 1053, 978, 873, 832, 809, 708, 561, 489, 510, 518, 473, 452, 489, 536, 568, 624, 705, 775, 830, 890, 928, 897, 804, 698, 593, 459, 290, 134, 8, -124, -283, -436, -547, -605, -590, -494, -368, -286, -242, -176, -66, 46, 144, 255, 372, 442, 446, 448, 479, 482, 412, 315, 236, 136, -4, -124, -166, -170, -202, -244, -239, -185, -128, -71, 18, 140, 243, 289, 305, 322, 328, 301, 251, 215, 208, 209, 179, 106, 7, -86, -163, -239, -323, -407, -486, -584, -702, -793, -824, -838, -888, -919, -868, -769, -690, -607, -486, -373, -303, -224, -91, 36, 95, 133, 224, 339, 385, 356, 330, 326, 288, 201, 121, 55, -43, -178, -287, -356, -438, -547, -624, -627, -586, -556, -534, -472, -344, -198, -86, 16, 172, 363, 510, 599, 677, 748, 768, 744, 712, 661, 560, 430, 305, 179, 51, -53, -146, -247, -328, -349, -343, -340, -292, -174, -65, -30, -28, -3, 24, 23, 14, 12, -6, -53, -102, -118, -102, -77, -69, -70, -37, 17, 28, -18, -45, -22, -21, -83, -157, -202, -247, -291, -292, -256, -234, -216, -141, -17, 84, 144, 226, 371, 516, 581, 575, 567, 574, 559, 497, 413, 333, 258, 197, 174, 179, 168, 127, 96, 101, 109, 100, 98, 112, 114, 91, 72, 71, 64, 37, -1, -45, -85, -106, -122, -167, -236, -282, -294, -324, -412, -525, -615, -690, -786, -905, -1008, -1077, -1127, -1143, -1094, -984, -853, -726, -608, -502, -405, -297, -169, -59, -10, -26, -69, -112, -166, -259, -396, -534, -625, -655, -643, -602, -532, -453, -388, -325, -226, -86, 38, 103, 135, 197, 291, 365, 393, 400, 402, 386, 341, 278, 207, 120, 24, -45, -74, -93, -129, -162, -161, -135, -130, -160, -193, -190, -153, -112, -89, -67, -16, 70, 171, 262, 346, 431, 517, 596, 672, 749, 808, 816, 780, 734, 688, 613, 517, 437, 383, 324, 266, 236, 215, 162, 90, 37, 4, -31, -70, -86, -74, -51, -26, 0, 25, 39, 42, 45, 62, 90, 123, 156, 190, 214, 212, 176, 121, 59, -13, -110, -223, -318, -378, -429, -473, -476, -431, -399, -421, -441, -383, -261, -160, -108, -56, 20, 90, 126, 150, 175, 168, 109, 30, -41, -126, -238, -343, -405, -445, -502, -571, -609, -595, -551, -500, -450, -399, -349, -298, -240, -188, -155, -145, -150, -165, -175, -171, -162, -158, -137, -78, 2, 57, 82, 114, 172, 219, 234, 252, 303, 348, 340, 302, 286, 282, 258, 230, 232, 255, 287, 349, 450, 548, 603, 616, 624, 641, 656, 640, 594, 547, 516, 468, 392, 327, 315, 318, 275, 204, 164, 158, 151, 129, 115, 125, 150, 169, 168, 158, 169, 195, 204, 182, 150, 126, 107, 94, 87, 69, 33, 1, 2, 24, 35, 25, 6, -6, -4, 21, 57, 81, 86, 85, 92, 109, 125, 124, 98, 53, 7, -36, -85, -129, -151, -153, -167, -211, -261, -290, -311, -352, -399, -421, -420, -415, -403, -384, -374, -374, -354, -306, -262, -248, -250, -243, -234, -237, -254, -270, -282, -300, -328, -353, -368, -392, -444, -506, -530, -499, -446, -418, -415, -406, -358, -279, -188, -103, -21, 71, 180, 289, 385, 465, 540, 607, 656, 688, 708, 720, 707, 666, 604, 526, 433, 338, 255, 177, 90, 11, -41, -73, -109, -147, -166, -173, -190, -206, -192, -153, -143, -168, -169, -113, -53, -41, -49, -38, -21, -28, -60, -104, -162, -235, -300, -344, -375, -406, -424, -416, -389, -364, -347, -334, -325, -318, -298, -255, -199, -144, -81, -4, 66, 113, 134, 150, 167, 174, 166, 149, 139, 131, 114, 91, 78, 73, 57, 27, 5, -4, -27, -73, -115, -134, -145, -163, -183, -188, -183, -183, -187, -178, -151, -110, -65, -22, 14, 36, 44, 47, 52, 52, 37, 11, -13, -34, -57, -75, -81, -79, -86, -104, -116, -111, -88, -48, 1, 57, 122, 193, 253, 288, 310, 339, 370, 387, 385, 372, 355, 331, 297, 258, 218, 183, 154, 131, 117, 112, 105, 81, 46, 14, -14, -44, -70, -85, -87, -81, -54, -1, 58, 93, 100, 101, 108, 103, 77, 45, 16, -24, -80, -126, -146, -153, -170, -191, -206, -220, -242, -264, -277, -282, -287, -291, -280, -250, -217, -185, -155, -130, -111, -88, -58, -34, -24, -24, -31, -48, -70, -88, -109, -146, -194, -238, -265, -277, -277, -276, -281, -293, -303, -299, -280, -248, -206, -162, -130, -112, -89, -45, -3, 15, 20, 37, 65, 90, 109, 128, 142, 149, 160, 177, 192, 202, 213, 221, 226, 227, 230, 233, 234, 236, 241, 245, 246, 246, 248, 259, 278, 302, 318, 319, 312, 311, 318, 311, 283, 247, 222, 208, 190, 165, 135, 103, 65, 23, -19, -59, -96, -129, -154, -174, -194, -214, -227, -230, -232, -243, -264, -276, -267, -246, -226, -216, -210, -202, -188, -168, -149, -140, -146, -155, -154, -138, -117, -104, -103, -111, -121, -126, -125, -116, -101, -84, -70, -62, -54, -45, -36, -29, -25, -19, -8, 4, 23, 39, 44, 42, 45, 55, 53, 39, 23, 17, 19, 28, 43, 60, 74, 92, 113, 126, 127, 123, 118, 118, 120, 121, 122, 125, 132, 143, 152, 157, 158, 161, 170, 180, 189, 197, 209, 222, 237, 252, 260, 261, 260, 261, 256, 242, 225, 211, 193, 171, 154, 145, 132, 117, 108, 105, 98, 83, 73, 73, 73, 65, 50, 39, 28, 17, 6, -1, -15, -34, -49, -56, -63, -77, -91, -101, -104, -105, -106, -109, -113, -114, -111, -111, -121, -133, -139, -137, -136, -139, -139, -133, -127, -124, -117, -102, -84, -75, -73, -71, -70, -72, -80, -88, -95, -101, -102, -97, -93, -92, -85, -70, -56, -52, -50, -40, -22, -9, -1, 7, 18, 23, 23, 22, 24, 28, 30, 26, 21, 22, 29, 37, 40, 40, 37, 31, 25, 21, 20, 19, 16, 13, 14, 19, 25, 27, 29, 36, 47, 53, 53, 52, 55, 56, 51, 48, 47, 46, 42, 35, 29, 23, 12, 0, -6, -8, -12, -17, -16, -10, -4, 0, 3, 7, 9, 11, 13, 13, 11, 4, -1, -3, -4, -7, -13, -18, -21, -22, -23, -25, -29, -30, -29, -28, -29, -30, -30, -28, -26, -21, -15, -12, -13, -14, -10, -4, 0, -1, -3, -2, 0, 1, 0, -5, -8, -9, -10, -10, -8, -6, -5, -5, -5, -2, 0, 1, 1, 3, 6, 8, 8, 7, 7, 8, 8, 7, 6, 6, 7, 8, 8, 6, 2, 0, 1, 2, 3, 4, 4, 4, 3, 2, 3, 5, 6, 6, 6, 6, 6, 7, 8, 9, 11, 11, 8, 8, 9, 9, 9, 8, 7, 7, 7, 6, 5, 4, 4, 5, 5, 6, 7, 8, 7, 6, 5, 5, 5, 5, 4, 3, 2, 2, 2, 2, 2, 4, 4, 2, 0, 0, 1, 2, 2, 1, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1, 1, 1, 1, 1, 2, 2, 1, 0, 1, 2, 2, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, -2, 0, 1, 2, 0, -1, 0, 1, 1, 0, -1, -1 };
+// IMA ADPCM blocks, see audio_adpcm.h
+static const uint8_t __in_flash("audio_one_hundred_sample_data") audio_one_hundred_sample_data[] = { 0, 0, 0, 0, 119, 1, 33, 129, 24, 16, 0, 137, 8, 48, 18, 153, 16, 185, 185, 153, 16, 185, 9, 145, 153, 153, 16, 19, 25, 17, 144, 144, 0, 1, 169, 9, 146, 170, 153, 153, 153, 160, 171, 33, 176, 170, 16, 145, 172, 16, 145, 156, 8, 1, 217, 137, 0, 187, 9, 185, 26, 146, 203, 0, 145, 155, 153, 153, 153, 155, 57, 192, 9, 147, 187, 9, 153, 9, 17, 185, 140, 144, 11, 17, 186, 153, 12, 48, 145, 185, 155, 32, 144, 0, 17, 144, 10, 66, 1, 16, 51, 2, 33, 19, 145, 41, 19, 25, 18, 176, 49, 19, 25, 19, 33, 19, 25, 20, 168, 49, 51, 35, 146, 25, 4, 144, 41, 52, 160, 80, 2, 138, 0, 154, 0, 153, 16, 144, 49, 145, 155, 67, 160, 158, 49, 128, 202, 8, 132, 186, 50, 219, 8, 129, 170, 172, 64, 184, 27, 162, 155, 170, 156, 24, 17, 219, 9, 145, 140, 17, 187, 16, 187, 49, 178, 156, 152, 201, 187, 9, 1, 201, 171, 153, 205, 139, 1, 235, 25, 161, 173, 144, 170, 129, 157, 0, 202, 137, 203, 136, 203, 153, 155, 176, 173, 136, 187, 169, 203, 170, 11, 160, 156, 48, 202, 24, 193, 42, 211, 58, 131, 32, 220, 88, 147, 171, 128, 16, 160, 174, 40, 201, 26, 129, 173, 170, 153, 187, 188, 172, 235, 171, 218, 156, 128, 169, 153, 32, 4, 138, 103, 51, 70, 51, 69, 36, 67, 51, 69, 34, 83, 35, 67, 67, 50, 67, 51, 51, 53, 50, 51, 36, 66, 50, 18, 34, 34, 17, 8, 128, 186, 169, 220, 219, 188, 187, 190, 188, 203, 172, 203, 203, 202, 186, 219, 171, 172, 172, 202, 171, 187, 173, 187, 188, 172, 187, 188, 203, 187, 203, 187, 188, 203, 187, 187, 203, 204, 154, 186, 186, 203, 155, 201, 172, 152, 170, 152, 171, 32, 128, 50, 49, 71, 17, 68, 34, 83, 20, 50, 52, 66, 51, 50, 53, 50, 51, 52, 51, 83, 35, 34, 65, 52, 34, 2, 80, 52, 19, 16, 68, 33, 50, 66, 53, 18, 81, 19, 33, 37, 1, 19, 49, 21, 8, 4, 138, 35, 168, 17, 146, 157, 83, 160, 138, 114, 20, 24, 67, 66, 34, 116, 18, 49, 36, 67, 51, 52, 36, 35, 67, 83, 34, 33, 51, 36, 34, 82, 19, 17, 1, 97, 146, 9, 2, 8, 161, 139, 19, 172, 152, 191, 154, 189, 48, 224, 154, 185, 24, 192, 154, 168, 139, 184, 10, 234, 138, 217, 156, 144, 25, 233, 156, 17, 144, 169, 57, 53, 185, 26, 54, 35, 68, 1, 113, 19, 137, 82, 36, 128, 49, 20, 51, 51, 22, 0, 49, 52, 18, 49, 145, 114, 134, 57, 20, 155, 2, 43, 7, 138, 145, 172, 129, 205, 152, 203, 170, 188, 201, 173, 154, 204, 171, 219, 171, 203, 187, 205, 138, 186, 157, 186, 171, 235, 139, 186, 156, 185, 171, 219, 155, 170, 186, 170, 205, 187, 185, 180, 251, 13, 0, 170, 168, 188, 171, 219, 188, 138, 169, 152, 190, 40, 176, 9, 152, 49, 16, 87, 50, 52, 2, 83, 36, 64, 21, 136, 52, 1, 51, 17, 68, 144, 81, 131, 66, 162, 80, 4, 16, 18, 34, 36, 50, 51, 20, 154, 119, 144, 16, 144, 65, 146, 27, 20, 138, 68, 128, 82, 129, 98, 2, 48, 36, 51, 21, 64, 39, 128, 82, 129, 65, 2, 48, 20, 49, 132, 65, 4, 8, 37, 1, 49, 2, 49, 20, 154, 34, 250, 172, 186, 174, 188, 173, 169, 204, 186, 187, 219, 189, 138, 185, 155, 65, 67, 18, 50, 53, 82, 54, 51, 70, 34, 51, 83, 51, 50, 68, 51, 50, 52, 34, 50, 36, 18, 32, 33, 128, 170, 203, 204, 203, 205, 169, 203, 173, 171, 203, 203, 171, 203, 172, 171, 203, 186, 187, 188, 187, 187, 187, 204, 186, 171, 203, 204, 153, 170, 187, 188, 187, 189, 219, 186, 187, 219, 172, 171, 186, 203, 172, 187, 171, 202, 171, 128, 137, 49, 33, 54, 52, 54, 36, 52, 53, 67, 51, 67, 67, 51, 67, 51, 36, 35, 51, 51, 35, 50, 20, 8, 128, 154, 201, 173, 187, 190, 202, 187, 203, 188, 170, 202, 155, 154, 169, 136, 169, 24, 129, 25, 53, 67, 52, 33, 37, 160, 32, 19, 137, 170, 64, 195, 191, 153, 189, 152, 185, 32, 129, 88, 38, 34, 115, 37, 50, 52, 68, 68, 18, 67, 51, 67, 67, 67, 35, 51, 67, 20, 34, 52, 35, 17, 67, 3, 24, 18, 64, 19, 0, 144, 138, 200, 139, 250, 143, 1, 170, 169, 172, 1, 206, 40, 160, 139, 201, 10, 146, 171, 153, 33, 217, 26, 178, 159, 50, 160, 9, 0, 17, 223, 138, 136, 203, 138, 129, 204, 170, 187, 72, 179, 30, 23, 185, 65, 34, 1, 9, 68, 129, 27, 70, 176, 11, 129, 172, 16, 185, 137, 235, 171, 205, 9, 234, 26, 130, 155, 51, 186, 72, 52, 1, 81, 54, 34, 16, 67, 2, 56, 23, 16, 67, 17, 16, 144, 152, 153, 147, 14, 36, 220, 187, 187, 207, 171, 187, 186, 223, 169, 169, 187, 190, 170, 203, 187, 171, 9, 32, 1, 171, 113, 38, 33, 115, 52, 50, 99, 51, 67, 67, 51, 52, 36, 67, 35, 51, 52, 50, 52, 34, 36, 19, 18, 17, 17, 17, 128, 152, 205, 156, 235, 188, 187, 189, 187, 189, 219, 203, 202, 202, 170, 187, 203, 187, 188, 203, 187, 203, 186, 187, 187, 188, 203, 171, 186, 187, 186, 186, 188, 155, 169, 173, 153, 187, 138, 34, 2, 34, 68, 69, 34, 82, 36, 66, 34, 82, 51, 35, 83, 52, 19, 50, 53, 18, 35, 51, 67, 35, 67, 35, 24, 20, 235, 154, 202, 188, 203, 204, 185, 189, 187, 205, 170, 202, 138, 169, 171, 136, 186, 136, 137, 65, 36, 115, 20, 33, 52, 34, 68, 34, 99, 34, 34, 36, 49, 36, 67, 51, 67, 52, 67, 35, 67, 83, 50, 66, 81, 253, 30, 0, 52, 67, 67, 66, 50, 50, 68, 34, 36, 35, 34, 35, 34, 17, 1, 16, 129, 202, 187, 220, 220, 186, 187, 186, 205, 171, 204, 172, 187, 188, 186, 203, 170, 187, 187, 188, 187, 187, 172, 170, 16, 145, 56, 103, 129, 40, 69, 18, 83, 51, 51, 53, 50, 67, 18, 51, 1, 115, 129, 9, 1, 24, 18, 154, 34, 185, 72, 162, 190, 186, 27, 69, 128, 0, 185, 33, 221, 16, 252, 138, 184, 170, 201, 172, 152, 221, 137, 186, 155, 184, 158, 136, 172, 32, 152, 24, 83, 36, 152, 98, 130, 11, 37, 153, 114, 19, 33, 35, 82, 51, 51, 20, 17, 50, 145, 170, 250, 221, 219, 188, 187, 188, 203, 186, 188, 188, 188, 203, 155, 137, 33, 67, 51, 52, 52, 84, 68, 52, 83, 67, 51, 36, 67, 35, 52, 67, 51, 51, 67, 35, 35, 35, 17, 34, 2, 136, 184, 207, 187, 220, 202, 202, 187, 188, 204, 187, 203, 187, 188, 203, 187, 188, 187, 188, 203, 170, 186, 187, 171, 188, 203, 186, 171, 169, 138, 137, 185, 155, 153, 137, 8, 84, 18, 82, 53, 50, 50, 52, 67, 83, 68, 67, 67, 50, 67, 36, 67, 51, 83, 51, 67, 51, 35, 83, 34, 17, 17, 2, 136, 169, 236, 204, 186, 204, 187, 189, 203, 219, 187, 203, 187, 203, 187, 188, 187, 188, 170, 187, 155, 144, 137, 49, 17, 115, 19, 99, 52, 66, 52, 51, 53, 50, 67, 67, 66, 50, 51, 52, 50, 37, 18, 51, 35, 68, 34, 50, 67, 34, 18, 82, 36, 17, 83, 19, 66, 53, 2, 17, 67, 34, 16, 65, 20, 153, 8, 0, 249, 204, 137, 168, 221, 170, 136, 219, 187, 155, 203, 171, 187, 173, 187, 171, 203, 187, 137, 154, 154, 17, 16, 83, 52, 101, 35, 34, 55, 20, 49, 67, 66, 67, 33, 67, 35, 67, 34, 50, 20, 18, 36, 18, 18, 1, 128, 152, 185, 221, 170, 234, 188, 153, 203, 154, 202, 172, 136, 201, 187, 154, 169, 190, 57, 130, 204, 154, 204, 156, 169, 154, 8, 251, 171, 144, 251, 171, 137, 184, 188, 48, 147, 173, 97, 146, 154, 32, 128, 115, 3, 9, 84, 19, 16, 52, 3, 66, 53, 17, 66, 67, 34, 49, 34, 16, 32, 130, 220, 186, 236, 187, 203, 189, 219, 188, 188, 188, 202, 187, 171, 169, 155, 24, 16, 1, 49, 87, 67, 68, 52, 37, 51, 67, 51, 52, 67, 52, 51, 36, 34, 34, 18, 18, 2, 16, 128, 168, 204, 189, 205, 171, 188, 188, 186, 188, 203, 203, 203, 171, 187, 172, 187, 186, 219, 170, 203, 186, 187, 187, 187, 170, 172, 186, 188, 219, 171, 153, 171, 154, 40, 5, 152, 136, 65, 144, 80, 85, 68, 18, 99, 50, 33, 68, 67, 34, 68, 51, 66, 51, 51, 50, 52, 34, 18, 35, 129, 153, 218, 190, 219, 188, 173, 172, 188, 187, 219, 203, 187, 188, 202, 187, 171, 187, 203, 170, 13, 209, 41, 0, 170, 169, 170, 24, 34, 66, 55, 51, 68, 52, 51, 83, 51, 52, 52, 51, 51, 52, 50, 51, 50, 68, 34, 50, 35, 1, 33, 128, 56, 71, 1, 32, 52, 145, 40, 36, 17, 67, 85, 35, 0, 67, 2, 137, 34, 34, 168, 74, 39, 201, 172, 204, 187, 153, 202, 154, 154, 218, 189, 139, 218, 155, 8, 65, 35, 152, 16, 65, 53, 129, 115, 55, 1, 17, 34, 3, 8, 115, 34, 34, 19, 35, 35, 137, 49, 35, 68, 35, 35, 200, 141, 1, 187, 137, 153, 152, 237, 155, 233, 171, 185, 175, 152, 186, 137, 128, 184, 174, 138, 160, 172, 8, 169, 153, 170, 40, 161, 223, 172, 136, 168, 41, 52, 20, 19, 144, 114, 36, 65, 54, 36, 33, 34, 34, 0, 50, 129, 65, 37, 168, 26, 53, 168, 112, 130, 188, 48, 132, 171, 81, 19, 176, 174, 48, 209, 205, 154, 170, 220, 219, 171, 136, 251, 154, 8, 202, 170, 137, 168, 189, 24, 129, 138, 18, 203, 26, 129, 137, 116, 38, 16, 66, 17, 64, 2, 113, 35, 17, 67, 17, 18, 0, 49, 145, 139, 129, 189, 40, 250, 223, 136, 186, 156, 202, 172, 170, 187, 138, 49, 3, 8, 99, 18, 114, 68, 52, 37, 51, 51, 51, 37, 35, 69, 34, 50, 35, 1, 17, 144, 154, 136, 218, 204, 203, 204, 219, 187, 203, 186, 187, 188, 172, 203, 172, 154, 154, 170, 137, 153, 137, 128, 136, 32, 66, 35, 98, 69, 0, 24, 35, 160, 9, 1, 128, 201, 187, 188, 187, 223, 155, 152, 187, 138, 49, 2, 152, 96, 55, 34, 99, 51, 53, 50, 68, 34, 50, 35, 17, 18, 34, 184, 173, 220, 189, 203, 189, 188, 203, 203, 202, 186, 187, 203, 186, 172, 171, 138, 138, 8, 50, 52, 67, 70, 51, 83, 67, 52, 67, 50, 36, 51, 50, 67, 51, 35, 17, 34, 128, 170, 188, 186, 190, 188, 204, 187, 235, 203, 153, 187, 171, 153, 170, 155, 8, 1, 82, 68, 83, 36, 34, 53, 36, 35, 50, 53, 34, 66, 51, 33, 67, 145, 25, 2, 170, 0, 152, 144, 173, 185, 191, 128, 203, 56, 38, 128, 32, 37, 1, 65, 54, 51, 66, 52, 33, 50, 18, 34, 2, 16, 34, 146, 140, 216, 190, 218, 204, 170, 169, 185, 187, 187, 205, 173, 170, 220, 9, 129, 153, 16, 160, 190, 25, 129, 56, 69, 51, 129, 0, 154, 24, 66, 71, 35, 34, 184, 172, 203, 138, 153, 104, 21, 201, 27, 209, 191, 40, 145, 41, 132, 186, 137, 168, 207, 41, 132, 137, 1, 169, 169, 172, 48, 200, 74, 148, 173, 0, 251, 40, 146, 156, 67, 216, 26, 1, 154, 50, 19, 33, 53, 131, 56, 38, 169, 114, 19, 32, 130, 138, 249, 156, 2, 170, 49, 235, 170, 222, 203, 186, 153, 152, 32, 84, 35, 8, 49, 83, 84, 68, 83, 51, 35, 33, 50, 35, 66, 53, 36, 2, 168, 153, 220, 187, 222, 69, 52, 0, 186, 186, 219, 204, 188, 219, 187, 187, 170, 170, 169, 169, 186, 203, 154, 32, 99, 68, 51, 51, 20, 34, 35, 34, 84, 36, 17, 129, 201, 170, 218, 203, 154, 169, 189, 170, 219, 187, 172, 154, 136, 8, 32, 36, 34, 33, 116, 35, 67, 52, 50, 18, 17, 1, 0, 169, 220, 188, 220, 204, 170, 187, 188, 187, 203, 187, 189, 170, 169, 8, 17, 83, 50, 50, 84, 67, 67, 68, 51, 67, 34, 18, 34, 34, 17, 83, 18, 128, 169, 203, 189, 203, 187, 128, 203, 170, 220, 187, 188, 137, 137, 48, 52, 2, 153, 17, 154, 119, 50, 51, 52, 17, 50, 131, 24, 68, 69, 19, 0, 50, 132, 204, 64, 2, 32, 36, 50, 128, 17, 185, 81, 2, 96, 52, 33, 0, 137, 154, 0, 137, 117, 18, 17, 144, 9, 201, 158, 128, 137, 1, 128, 200, 191, 155, 217, 156, 128, 169, 9, 160, 188, 185, 221, 9, 128, 137, 50, 52, 128, 81, 160, 89, 36, 32, 52, 69, 34, 136, 34, 161, 155, 68, 2, 51, 200, 11, 232, 189, 155, 16, 216, 171, 170, 185, 255, 9, 168, 10, 16, 160, 158, 34, 251, 57, 177, 25, 18, 66, 34, 130, 191, 65, 192, 57, 22, 17, 144, 136, 205, 32, 168, 57, 18, 10, 33, 208, 157, 17, 218, 56, 18, 18, 48, 133, 206, 186, 139, 0, 8, 17, 17, 253, 190, 204, 187, 170, 8, 82, 52, 36, 34, 0, 82, 68, 69, 52, 50, 51, 33, 0, 0, 33, 49, 35, 168, 252, 204, 188, 187, 202, 154, 169, 203, 204, 172, 170, 154, 136, 33, 18, 32, 1, 152, 16, 66, 71, 51, 34, 19, 144, 170, 187, 138, 0, 18, 184, 206, 204, 187, 172, 154, 0, 34, 33, 67, 128, 33, 185, 74, 2, 115, 7, 8, 136, 188, 203, 169, 203, 9, 185, 153, 235, 155, 169, 138, 185, 139, 144, 138, 128, 1, 252, 170, 218, 190, 172, 186, 153, 202, 25, 192, 158, 152, 138, 83, 35, 71, 35, 49, 36, 16, 83, 18, 68, 35, 48, 3, 187, 136, 206, 24, 168, 25, 208, 173, 186, 173, 137, 137, 83, 130, 8, 129, 185, 8, 81, 85, 51, 34, 18, 0, 186, 9, 33, 101, 35, 65, 1, 153, 136, 154, 112, 55, 2, 49, 20, 152, 137, 17, 67, 20, 128, 67, 162, 189, 16, 185, 139, 128, 80, 3, 152, 32, 240, 158, 32, 129, 98, 34, 17, 168, 138, 170, 170, 24, 84, 2, 170, 136, 239, 138, 145, 41, 53, 17, 83, 145, 140, 129, 25, 36, 10, 71, 185, 11, 234, 155, 136, 154, 32, 169, 24, 253, 139, 128, 9, 33, 51, 54, 19, 170, 48, 233, 41, 131, 26, 6, 205, 24, 233, 139, 161, 155, 35, 187, 114, 131, 0, 129, 89, 38, 49, 37, 17, 53, 184, 27, 163, 158, 34, 234, 41, 161, 173, 136, 205, 137, 128, 137, 128, 137, 0, 236, 172, 16, 129, 40, 35, 168, 153, 236, 205, 129, 233, 53, 0, 187, 138, 17, 67, 70, 52, 35, 16, 82, 67, 68, 52, 36, 18, 17, 136, 137, 136, 1, 128, 235, 204, 204, 172, 171, 171, 153, 170, 170, 219, 187, 170, 139, 48, 83, 50, 51, 51, 18, 168, 32, 83, 67, 1, 66, 161, 172, 204, 172, 152, 24, 67, 50, 36, 1, 136, 169, 40, 50, 102, 51, 128, 219, 220, 203, 188, 137, 153, 136, 170, 138, 218, 139, 144, 72, 54, 50, 53, 35, 51, 152, 8, 217, 155, 152, 171, 249, 206, 187, 188, 172, 170, 10, 128, 16, 2, 153, 50, 49, 119, 21, 67, 19, 18, 2, 128, 136, 16, 17, 51, 200, 154, 249, 159, 144, 153, 49, 128, 98, 161, 9, 145, 139, 51, 8, 87, 2, 136, 160, 204, 171, 137, 136, 33, 18, 52, 217, 139, 49, 71, 19, 115, 52, 1, 33, 1, 32, 66, 17, 33, 33, 18, 250, 158, 169, 139, 136, 137, 16, 153, 152, 171, 144, 74, 103, 1, 66, 18, 34, 160, 25, 192, 28, 36, 137, 129, 236, 153, 201, 156, 1, 24, 20, 138, 67, 168, 88, 2, 16, 19, 8, 52, 136, 35, 252, 203, 170, 203, 9, 160, 157, 185, 174, 9, 185, 72, 3, 96, 5, 153, 51, 234, 64, 161, 57, 6, 137, 129, 204, 9, 169, 16, 145, 138, 152, 152, 189, 112, 36, 16, 66, 161, 41, 20, 0, 50, 67, 2, 221, 204, 139, 136, 171, 17, 235, 98, 208, 156, 128, 137, 34, 128, 48, 177, 175, 186, 155, 17, 49, 22, 168, 137, 201, 171, 234, 188, 170, 136, 99, 70, 52, 52, 34, 50, 50, 69, 52, 51, 35, 18, 152, 186, 187, 153, 233, 189, 188, 205, 187, 203, 154, 170, 137, 152, 153, 185, 186, 171, 48, 2, 9, 87, 129, 136, 185, 10, 168, 137, 128, 50, 69, 20, 18, 0, 82, 34, 98, 52, 34, 36, 168, 186, 253, 171, 169, 187, 170, 203, 219, 204, 169, 170, 16, 32, 68, 35, 99, 19, 32, 50, 66, 19, 25, 20, 185, 204, 191, 187, 189, 153, 169, 138, 185, 156, 184, 156, 33, 16, 86, 18, 50, 129, 32, 2, 32, 67, 70, 2, 32, 4, 153, 33, 2, 81, 53, 65, 35, 33, 52, 152, 32, 232, 42, 147, 174, 128, 173, 170, 175, 152, 138, 49, 1, 2, 202, 65, 147, 40, 69, 86, 2, 9, 50, 1, 136, 64, 2, 65, 3, 169, 8, 169, 25, 36, 136, 115, 5, 136, 0, 8, 128, 32, 37, 218, 138, 53, 200, 25, 18, 9, 161, 155, 115, 22, 17, 0, 8, 145, 155, 17, 17, 36, 145, 65, 240, 159, 169, 156, 144, 156, 50, 144, 136, 237, 139, 168, 27, 68, 17, 128, 10, 1, 171, 49, 4, 129, 8, 145, 26, 3, 203, 10, 55, 239, 24, 144, 26, 16, 2, 204, 96, 132, 204, 32, 161, 10, 2, 49, 178, 157, 66, 130, 8, 114, 38, 169, 154, 154, 16, 251, 58, 194, 140, 130, 174, 9, 17, 137, 52, 169, 115, 176, 30, 4, 46, 0, 172, 169, 153, 154, 8, 185, 141, 130, 174, 16, 156, 67, 201, 221, 172, 48, 68, 84, 53, 19, 17, 18, 0, 17, 84, 36, 129, 136, 153, 203, 188, 154, 153, 202, 188, 187, 203, 188, 170, 137, 169, 8, 145, 153, 234, 173, 138, 137, 186, 27, 21, 202, 9, 137, 1, 25, 55, 34, 54, 17, 50, 144, 33, 176, 139, 252, 156, 169, 173, 152, 186, 187, 170, 234, 156, 32, 0, 17, 67, 37, 1, 0, 136, 0, 66, 67, 36, 129, 128, 222, 10, 32, 17, 0, 68, 216, 188, 153, 170, 170, 154, 200, 205, 202, 170, 202, 155, 17, 33, 51, 68, 37, 50, 69, 50, 67, 67, 35, 8, 129, 153, 144, 173, 66, 2, 83, 2, 153, 153, 170, 25, 102, 20, 16, 3, 222, 25, 128, 137, 48, 52, 161, 158, 1, 172, 83, 129, 64, 36, 2, 9, 50, 144, 41, 6, 25, 38, 186, 98, 160, 11, 130, 170, 24, 129, 49, 145, 115, 148, 10, 2, 170, 98, 17, 84, 130, 170, 169, 156, 168, 155, 68, 144, 169, 235, 155, 170, 9, 32, 68, 144, 9, 19, 184, 170, 64, 51, 194, 207, 0, 251, 9, 128, 16, 160, 25, 2, 172, 16, 8, 38, 235, 24, 160, 188, 74, 21, 9, 129, 170, 218, 173, 136, 170, 137, 81, 19, 203, 9, 145, 219, 73, 71, 129, 64, 35, 18, 130, 25, 21, 251, 138, 0, 129, 218, 74, 148, 191, 49, 144, 10, 51, 177, 155, 20, 203, 41, 233, 171, 202, 170, 170, 41, 192, 41, 242, 158, 168, 173, 128, 25, 119, 37, 51, 36, 19, 136, 8, 0, 33, 34, 51, 177, 206, 204, 171, 170, 171, 138, 137, 160, 154, 8, 203, 186, 174, 25, 233, 156, 186, 204, 219, 170, 153, 169, 8, 0, 66, 36, 50, 68, 35, 16, 34, 129, 128, 144, 220, 189, 204, 188, 170, 154, 24, 51, 68, 19, 18, 129, 154, 136, 153, 40, 53, 144, 201, 239, 171, 171, 170, 32, 84, 51, 51, 68, 34, 8, 50, 145, 154, 220, 173, 203, 204, 171, 170, 156, 154, 8, 16, 65, 52, 67, 36, 34, 18, 18, 2, 0, 34, 18, 40, 5, 172, 0, 98, 130, 116, 55, 49, 35, 17, 136, 201, 187, 8, 24, 144, 172, 169, 238, 139, 50, 17, 85, 34, 18, 128, 136, 9, 184, 155, 50, 129, 16, 192, 207, 9, 186, 113, 20, 64, 36, 144, 16, 144, 153, 0, 1, 153, 152, 174, 160, 191, 56, 177, 88, 35, 66, 19, 50, 132, 32, 162, 141, 184, 205, 172, 26, 200, 155, 17, 186, 153, 32, 1, 97, 53, 36, 145, 168, 189, 152, 219, 40, 19, 144, 184, 153, 128, 114, 36, 114, 38, 17, 33, 1, 202, 156, 202, 170, 136, 154, 169, 202, 219, 202, 170, 65, 176, 88, 18, 32, 216, 155, 128, 251, 11, 51, 35, 169, 114, 131, 172, 137, 24, 67, 66, 69, 52, 1, 66, 131, 24, 18, 144, 153, 249, 175, 168, 190, 153, 221, 253, 49, 0, 170, 153, 49, 35, 69, 19, 136, 218, 189, 155, 65, 101, 68, 52, 35, 17, 128, 152, 154, 24, 50, 50, 129, 186, 206, 187, 187, 170, 186, 155, 152, 188, 186, 205, 204, 188, 171, 172, 187, 203, 204, 203, 187, 154, 153, 9, 49, 130, 16, 50, 3, 189, 203, 207, 170, 153, 152, 40, 3, 153, 201, 190, 153, 32, 69, 68, 51, 18, 144, 234, 171, 170, 171, 24, 18, 18, 128, 17, 184, 88, 70, 52, 52, 51, 16, 34, 217, 27, 194, 191, 187, 190, 171, 187, 137, 8, 1, 24, 67, 17, 3, 173, 144, 206, 10, 144, 138, 17, 48, 20, 113, 53, 52, 52, 50, 34, 67, 35, 69, 35, 49, 35, 168, 155, 137, 128, 8, 17, 152, 16, 136, 112, 119, 18, 16, 34, 152, 186, 154, 204, 156, 33, 130, 41, 55, 145, 9, 169, 8, 202, 88, 36, 33, 136, 82, 145, 171, 171, 116, 176, 140, 0, 34, 144, 32, 129, 72, 38, 50, 67, 52, 18, 16, 130, 11, 20, 187, 161, 255, 152, 152, 16, 136, 0, 185, 204, 204, 187, 154, 168, 155, 67, 168, 139, 49, 184, 112, 23, 33, 51, 50, 68, 17, 136, 96, 52, 145, 40, 37, 176, 138, 161, 206, 171, 170, 169, 49, 200, 74, 4, 9, 51, 84, 2, 24, 38, 152, 48, 17, 53, 160, 114, 129, 8, 128, 48, 21, 17, 51, 146, 223, 137, 202, 172, 136, 169, 219, 139, 251, 156, 186, 155, 0, 17, 84, 35, 176, 154, 249, 172, 32, 86, 52, 52, 51, 35, 18, 129, 17, 36, 67, 37, 2, 1, 128, 128, 187, 26, 2, 16, 70, 36, 1, 169, 251, 203, 170, 137, 0, 152, 185, 207, 203, 188, 171, 155, 152, 186, 187, 187, 222, 188, 188, 189, 171, 137, 170, 154, 170, 220, 205, 172, 170, 153, 137, 16, 16, 0, 152, 251, 187, 187, 154, 16, 48, 54, 33, 145, 188, 155, 9, 52, 85, 83, 51, 36, 34, 1, 137, 0, 168, 155, 32, 67, 145, 204, 172, 189, 187, 9, 152, 80, 20, 34, 201, 173, 153, 218, 25, 67, 50, 37, 16, 136, 204, 170, 8, 50, 66, 87, 34, 1, 8, 136, 170, 138, 82, 54, 2, 49, 36, 34, 17, 99, 36, 51, 68, 2, 136, 67, 2, 128, 16, 86, 19, 34, 18, 51, 3, 136, 2, 32, 70, 3, 1, 145, 188, 155, 201, 191, 8, 130, 153, 0, 217, 140, 34, 144, 81, 69, 2, 128, 16, 129, 218, 155, 33, 177, 175, 32, 17, 249, 170, 185, 203, 187, 154, 24, 144, 172, 184, 175, 169, 171, 33, 146, 172, 48, 130, 203, 73, 55, 18, 116, 36, 16, 51, 17, 1, 217, 155, 152, 40, 71, 1, 48, 55, 1, 24, 128, 17, 128, 8, 17, 9, 50, 209, 188, 154, 0, 17, 18, 169, 119, 38, 0, 136, 202, 139, 128, 190, 137, 16, 4, 206, 171, 203, 154, 185, 170, 32, 68, 83, 161, 187, 170, 218, 11, 101, 69, 52, 35, 44, 19, 47, 0, 36, 2, 0, 32, 50, 50, 69, 68, 51, 17, 0, 33, 145, 169, 40, 100, 51, 34, 34, 176, 191, 170, 219, 172, 138, 136, 202, 204, 171, 189, 172, 170, 187, 153, 136, 219, 189, 203, 204, 187, 170, 204, 9, 168, 187, 187, 190, 186, 188, 153, 137, 24, 2, 168, 170, 220, 203, 219, 138, 8, 0, 34, 176, 41, 3, 27, 71, 51, 70, 51, 52, 18, 49, 20, 128, 16, 201, 80, 130, 172, 16, 185, 10, 184, 28, 39, 0, 66, 128, 203, 137, 186, 203, 154, 115, 130, 8, 2, 170, 170, 172, 56, 53, 85, 52, 1, 16, 185, 190, 169, 187, 73, 20, 16, 18, 17, 35, 168, 115, 39, 83, 35, 17, 51, 18, 153, 137, 49, 70, 51, 67, 68, 20, 128, 65, 130, 48, 68, 33, 51, 2, 0, 185, 175, 186, 155, 32, 17, 33, 21, 184, 203, 10, 34, 67, 70, 52, 129, 32, 208, 158, 136, 202, 9, 137, 136, 136, 185, 40, 250, 12, 1, 138, 169, 170, 0, 253, 155, 144, 136, 129, 170, 112, 51, 145, 64, 53, 17, 100, 20, 18, 33, 17, 128, 186, 172, 128, 154, 2, 206, 64, 147, 172, 82, 129, 48, 36, 1, 185, 11, 3, 219, 172, 97, 146, 137, 219, 139, 17, 84, 17, 115, 21, 8, 1, 186, 140, 33, 160, 156, 8, 0, 160, 255, 153, 152, 138, 152, 138, 18, 168, 169, 236, 188, 10, 67, 68, 83, 68, 35, 34, 18, 17, 49, 52, 68, 34, 100, 18, 16, 17, 16, 50, 34, 68, 52, 67, 3, 0, 144, 186, 153, 201, 190, 153, 219, 187, 207, 170, 170, 187, 170, 202, 170, 185, 207, 187, 203, 219, 170, 154, 170, 187, 187, 205, 188, 187, 170, 187, 170, 8, 128, 186, 189, 186, 205, 187, 186, 41, 50, 128, 64, 2, 9, 146, 42, 119, 51, 84, 51, 52, 20, 0, 34, 144, 137, 32, 50, 1, 186, 98, 192, 171, 152, 56, 194, 42, 5, 169, 206, 137, 186, 169, 141, 36, 154, 8, 152, 239, 138, 136, 152, 155, 85, 1, 128, 136, 0, 170, 137, 32, 67, 52, 1, 33, 69, 35, 48, 38, 33, 36, 99, 18, 33, 83, 53, 1, 67, 53, 20, 17, 50, 20, 1, 66, 36, 49, 52, 33, 17, 144, 168, 57, 22, 152, 66, 51, 129, 218, 156, 152, 173, 17, 136, 50, 69, 144, 187, 201, 204, 189, 137, 168, 154, 34, 216, 155, 137, 169, 190, 25, 144, 138, 33, 178, 191, 48, 177, 11, 136, 116, 39, 32, 66, 1, 33, 69, 17, 81, 36, 0, 34, 152, 138, 16, 34, 0, 18, 84, 35, 33, 176, 74, 38, 2, 48, 87, 1, 16, 144, 187, 8, 202, 138, 236, 138, 201, 187, 185, 189, 154, 202, 48, 178, 75, 36, 51, 1, 117, 2, 66, 20, 136, 49, 3, 221, 9, 128, 137, 218, 172, 1, 144, 189, 138, 145, 170, 144, 96, 38, 17, 50, 51, 248, 156, 16, 160, 56, 87, 35, 50, 67, 112, 20, 42, 0, 19, 33, 51, 67, 53, 34, 68, 18, 18, 129, 0, 185, 8, 234, 27, 35, 17, 2, 139, 208, 223, 9, 202, 172, 156, 170, 204, 186, 172, 202, 171, 186, 157, 153, 186, 185, 205, 187, 187, 204, 171, 154, 171, 203, 190, 171, 186, 173, 153, 8, 17, 18, 35, 152, 204, 173, 153, 186, 41, 20, 49, 162, 139, 3, 43, 39, 25, 119, 1, 51, 51, 20, 128, 17, 187, 171, 187, 99, 160, 25, 177, 191, 204, 186, 188, 171, 138, 144, 190, 49, 249, 155, 153, 136, 16, 82, 35, 82, 21, 153, 50, 145, 100, 35, 67, 3, 32, 184, 58, 179, 159, 51, 137, 35, 72, 119, 21, 17, 18, 35, 186, 27, 34, 52, 17, 54, 160, 170, 202, 186, 190, 137, 136, 24, 153, 32, 177, 155, 144, 157, 17, 235, 154, 202, 25, 128, 49, 1, 116, 35, 66, 67, 68, 51, 67, 4, 0, 18, 170, 152, 137, 200, 29, 21, 9, 37, 128, 19, 155, 68, 8, 52, 1, 38, 251, 154, 218, 10, 152, 40, 2, 49, 37, 1, 137, 83, 51, 82, 36, 130, 188, 170, 190, 9, 9, 0, 88, 38, 17, 68, 50, 2, 250, 172, 154, 171, 10, 100, 19, 16, 66, 129, 187, 185, 141, 69, 145, 50, 163, 188, 186, 186, 205, 25, 128, 169, 154, 33, 144, 81, 54, 162, 171, 217, 174, 8, 184, 41, 145, 25, 224, 73, 5, 32, 37, 16, 128, 40, 2, 26, 146, 223, 154, 172, 171, 9, 168, 203, 72, 38, 0, 8, 136, 251, 157, 185, 11, 169, 74, 68, 67, 51, 68, 34, 19, 33, 18, 82, 130, 56, 146, 187, 218, 206, 155, 186, 156, 0, 98, 19, 32, 17, 17, 201, 139, 153, 203, 171, 204, 153, 250, 171, 169, 154, 186, 40, 67, 83, 35, 34, 145, 190, 203, 205, 170, 170, 171, 153, 152, 170, 16, 115, 52, 49, 54, 17, 34, 160, 9, 234, 203, 219, 138, 186, 25, 17, 98, 37, 50, 51, 34, 35, 0, 184, 156, 168, 206, 203, 189, 172, 187, 170, 0, 50, 83, 69, 18, 0, 50, 177, 207, 9, 201, 187, 170, 153, 186, 56, 130, 113, 21, 48, 38, 0, 49, 52, 1, 32, 130, 221, 187, 172, 8, 169, 40, 20, 154, 49, 51, 37, 17, 53, 202, 10, 168, 137, 186, 48, 201, 26, 87, 128, 98, 3, 24, 18, 33, 130, 204, 8, 146, 170, 155, 100, 200, 57, 37, 17, 50, 53, 50, 71, 2, 16, 17, 136, 129, 185, 24, 177, 142, 0, 25, 250, 43, 21, 24, 33, 115, 146, 154, 128, 201, 140, 16, 128, 251, 156, 25, 129, 24, 68, 34, 160, 43, 119, 152, 25, 160, 25, 160, 138, 235, 9, 200, 156, 144, 157, 16, 153, 65, 129, 88, 52, 35, 18, 81, 3, 170, 0, 201, 137, 85, 3, 186, 203, 203, 156, 136, 169, 136, 221, 57, 160, 40, 132, 64, 20, 48, 36, 49, 3, 26, 3, 222, 219, 155, 152, 186, 10, 85, 20, 116, 7, 48, 0, 128, 17, 67, 131, 156, 1, 205, 171, 172, 16, 186, 48, 185, 57, 19, 116, 3, 40, 50, 83, 20, 32, 20, 152, 217, 171, 235, 155, 128, 201, 156, 49, 160, 42, 162, 12, 19, 169, 250, 155, 251, 11, 33, 8, 50, 192, 56, 2, 65, 168, 97, 193, 9, 19, 131, 223, 155, 128, 160, 153, 153, 8, 185, 121, 37, 2, 83, 4, 16, 34, 24, 33, 201, 173, 16, 128, 98, 3, 184, 204, 187, 187, 191, 153, 219, 25, 160, 8, 251, 26, 160, 12, 53, 129, 81, 2, 32, 17, 0, 128, 64, 51, 34, 169, 72, 21, 8, 35, 233, 155, 136, 24, 39, 185, 65, 232, 27, 131, 138, 192, 173, 185, 42, 23, 8, 145, 190, 16, 33, 68, 18, 33, 160, 58, 87, 1, 19, 170, 154, 154, 16, 144, 136, 255, 155, 170, 8, 34, 0, 98, 2, 16, 2, 16, 193, 58, 71, 83, 132, 171, 16, 186, 0, 136, 37, 220, 25, 250, 9, 145, 139, 144, 11, 144, 139, 146, 174, 40, 0, 116, 21, 0, 16, 168, 32, 34, 67, 201, 8, 236, 9, 144, 138, 185, 141, 19, 169, 83, 184, 40, 153, 115, 20, 34, 68, 18, 8, 83, 19, 144, 16, 136, 8, 218, 25, 249, 159, 128, 153, 136, 153, 136, 184, 140, 129, 155, 100, 52, 2, 56, 4, 155, 18, 251, 136, 251, 137, 201, 58, 38, 0, 24, 8, 1, 40, 22, 8, 35, 203, 24, 251, 171, 170, 155, 129, 56, 71, 160, 56, 36, 65, 3, 16, 145, 89, 225, 157, 144, 155, 33, 168, 185, 223, 137, 152, 65, 36, 49, 35, 1, 128, 153, 153, 136, 249, 187, 137, 129, 190, 137, 188, 116, 18, 16, 153, 8, 8, 85, 19, 8, 202, 174, 16, 17, 1, 185, 138, 184, 172, 136, 0, 52, 2, 251, 189, 203, 171, 169, 41, 55, 52, 3, 136, 33, 17, 117, 67, 2, 128, 168, 188, 155, 136, 1, 220, 171, 187, 153, 8, 70, 129, 32, 130, 187, 137, 64, 55, 36, 144, 204, 203, 10, 17, 50, 130, 24, 3, 189, 33, 1, 84, 130, 137, 65, 209, 206, 203, 154, 137, 32, 130, 138, 34, 186, 114, 39, 33, 1, 48, 35, 1, 0, 33, 129, 253, 187, 16, 202, 140, 136, 24, 129, 169, 251, 173, 32, 100, 35, 17, 144, 171, 24, 17, 176, 205, 202, 170, 24, 66, 35, 129, 170, 64, 19, 113, 35, 169, 32, 144, 203, 172, 202, 172, 153, 218, 155, 0, 0, 200, 120, 39, 136, 33, 18, 66, 36, 129, 219, 172, 153, 8, 145, 204, 170, 136, 168, 170, 25, 161, 175, 66, 83, 52, 17, 66, 161, 171, 32, 130, 216, 174, 136, 201, 203, 156, 66, 146, 153, 66, 145, 155, 82, 34, 50, 71, 176, 172, 184, 9, 19, 115, 35, 50, 2, 203, 172, 57, 84, 83, 1, 153, 185, 204, 203, 137, 160, 138, 168, 57, 132, 174, 16, 144, 144, 155, 86, 1, 48, 3, 129, 136, 34, 136, 1, 37, 0, 160, 172, 17, 67, 21, 234, 24, 2, 236, 26, 1, 8, 169, 40, 251, 138, 234, 25, 18, 16, 17, 67, 18, 24, 70, 3, 137, 1, 138, 34, 153, 103, 162, 156, 202, 156, 168, 9, 145, 158, 0, 156, 82, 160, 41, 50, 18, 202, 80, 3, 33, 52, 34, 168, 207, 154, 153, 88, 38, 1, 17, 185, 187, 203, 136, 82, 20, 144, 152, 201, 174, 8, 153, 65, 129, 25, 69, 129, 49, 21, 168, 187, 24, 160, 10, 35, 185, 207, 10, 69, 162, 187, 9, 17, 184, 57, 53, 67, 50, 161, 189, 25, 87, 19, 184, 171, 250, 172, 154, 16, 50, 52, 145, 187, 189, 138, 64, 85, 2, 128, 8, 83, 2, 169, 251, 188, 170, 41, 67, 34, 20, 128, 128, 16, 68, 34, 0, 144, 222, 155, 136, 24, 18, 187, 202, 223, 10, 33, 34, 83, 51, 51, 51, 218, 42, 131, 187, 185, 254, 204, 138, 128, 0, 16, 66, 17, 8, 168, 40, 70, 52, 1, 136, 17, 152, 40, 35, 252, 188, 186, 203, 203, 138, 128, 168, 8, 83, 18, 8, 116, 35, 67, 52, 2, 17, 145, 202, 190, 156, 153, 153, 153, 218, 172, 154, 0, 1, 96, 54, 18, 129, 0, 16, 48, 36, 18, 232, 25, 53, 17, 152, 8, 250, 188, 139, 1, 168, 187, 203, 137, 128, 172, 169, 205, 187, 56, 51, 117, 21, 169, 25, 8, 65, 86, 18, 144, 24, 17, 0, 153, 33, 216, 189, 187, 203, 172, 153, 186, 155, 186, 48, 131, 9, 115, 119, 18, 35, 18, 128, 16, 128, 154, 137, 185, 221, 171, 218, 219, 187, 170, 9, 48, 19, 40, 54, 18, 65, 69, 52, 130, 137, 152, 203, 154, 64, 4, 185, 155, 152, 202, 25, 115, 36, 17, 160, 206, 186, 171, 136, 128, 137, 16, 168, 170, 120, 68, 84, 37, 2, 16, 144, 170, 169, 171, 187, 187, 221, 204, 169, 186, 154, 33, 52, 17, 0, 64, 53, 84, 52, 19, 0, 144, 203, 154, 16, 49, 69, 162, 175, 154, 136, 217, 10, 18, 16, 1, 8, 185, 174, 80, 178, 191, 137, 17, 144, 32, 38, 35, 1, 8, 84, 20, 49, 19, 152, 33, 168, 200, 191, 24, 185, 171, 237, 154, 184, 187, 188, 140, 0, 16, 50, 67, 70, 18, 34, 35, 51, 52, 84, 129, 203, 170, 187, 189, 156, 8, 136, 24, 67, 130, 65, 161, 155, 49, 69, 51, 144, 16, 146, 223, 187, 155, 186, 104, 39, 152, 33, 2, 185, 138, 66, 34, 99, 147, 190, 169, 171, 33, 18, 51, 161, 139, 251, 173, 17, 34, 52, 68, 52, 144, 153, 202, 205, 170, 137, 18, 185, 153, 188, 80, 131, 203, 204, 11, 49, 100, 52, 0, 136, 136, 144, 188, 40, 67, 161, 189, 72, 53, 3, 170, 152, 187, 48, 18, 145, 206, 170, 202, 155, 16, 67, 53, 18, 130, 155, 67, 34, 1, 116, 20, 202, 154, 34, 249, 187, 203, 187, 153, 67, 216, 138, 145, 112, 242, 44, 0, 57, 21, 40, 85, 50, 2, 9, 1, 186, 32, 146, 41, 195, 175, 152, 174, 66, 19, 34, 217, 139, 185, 72, 68, 36, 160, 187, 138, 235, 138, 128, 48, 178, 207, 25, 1, 9, 82, 51, 35, 16, 144, 137, 160, 235, 174, 9, 49, 36, 153, 202, 173, 235, 139, 128, 82, 68, 18, 202, 9, 8, 99, 18, 8, 1, 144, 8, 203, 138, 154, 168, 206, 136, 33, 168, 72, 192, 42, 161, 115, 39, 0, 128, 185, 206, 170, 24, 144, 0, 128, 32, 19, 49, 84, 84, 51, 146, 203, 24, 160, 97, 161, 154, 253, 156, 0, 136, 8, 16, 8, 32, 144, 58, 87, 2, 16, 0, 218, 139, 2, 187, 191, 10, 3, 49, 36, 0, 65, 67, 51, 1, 98, 21, 33, 51, 129, 202, 187, 189, 206, 138, 152, 204, 171, 170, 138, 48, 55, 129, 153, 65, 19, 65, 54, 36, 161, 170, 0, 169, 25, 145, 186, 8, 217, 223, 187, 24, 17, 36, 144, 16, 128, 152, 26, 55, 168, 56, 160, 155, 112, 23, 168, 154, 138, 49, 50, 38, 128, 129, 172, 82, 20, 1, 185, 173, 171, 98, 192, 138, 208, 174, 153, 16, 145, 24, 51, 34, 0, 65, 83, 1, 56, 37, 17, 2, 219, 171, 136, 201, 155, 16, 186, 112, 131, 41, 177, 207, 188, 25, 68, 83, 129, 0, 185, 157, 0, 144, 154, 48, 5, 219, 154, 16, 17, 136, 184, 139, 55, 17, 85, 51, 129, 189, 137, 203, 138, 66, 37, 251, 155, 136, 8, 34, 33, 84, 83, 34, 128, 128, 16, 51, 35, 130, 221, 187, 187, 189, 171, 185, 219, 219, 170, 185, 11, 68, 1, 17, 34, 50, 68, 36, 136, 84, 36, 33, 160, 186, 220, 139, 34, 17, 50, 233, 172, 203, 155, 34, 34, 33, 66, 192, 12, 50, 65, 38, 137, 144, 25, 55, 138, 37, 152, 8, 186, 171, 48, 178, 174, 188, 169, 204, 154, 170, 10, 184, 191, 114, 2, 0, 16, 34, 201, 26, 130, 137, 160, 72, 20, 82, 208, 172, 153, 96, 36, 128, 34, 2, 200, 11, 36, 219, 64, 130, 9, 34, 18, 2, 172, 251, 189, 24, 35, 144, 152, 154, 204, 156, 24, 33, 100, 19, 136, 201, 41, 132, 43, 39, 186, 24, 152, 186, 223, 9, 128, 8, 168, 140, 168, 72, 37, 24, 52, 168, 8, 136, 81, 19, 24, 68, 35, 160, 188, 33, 249, 25, 36, 17, 201, 155, 200, 59, 5, 11, 178, 143, 17, 9, 18, 217, 156, 32, 8, 152, 120, 55, 1, 184, 156, 144, 24, 1, 35, 202, 154, 156, 99, 160, 10, 1, 218, 173, 81, 20, 128, 0, 17, 34, 128, 187, 236, 172, 138, 34, 51, 36, 200, 138, 17, 216, 156, 128, 153, 66, 146, 205, 9, 128, 203, 138, 84, 2, 49, 224, 156, 34, 128, 24, 85, 19, 160, 173, 16, 17, 68, 17, 168, 219, 155, 48, 34, 50, 39, 216, 171, 16, 185, 65, 132, 136, 50, 176, 191, 102, 1, 45, 0, 0, 234, 154, 32, 35, 50, 2, 221, 157, 40, 0, 49, 131, 8, 50, 145, 25, 176, 255, 171, 153, 16, 152, 155, 33, 129, 8, 33, 119, 1, 16, 84, 67, 2, 171, 155, 40, 4, 32, 55, 184, 186, 191, 10, 1, 16, 50, 53, 176, 189, 187, 156, 48, 129, 25, 36, 170, 48, 192, 96, 19, 8, 16, 101, 160, 10, 34, 168, 205, 153, 16, 128, 100, 146, 137, 217, 187, 171, 65, 53, 36, 129, 168, 204, 138, 49, 67, 18, 144, 153, 250, 139, 66, 18, 168, 203, 186, 202, 190, 16, 144, 66, 129, 221, 155, 0, 40, 85, 1, 169, 188, 25, 160, 104, 37, 128, 16, 0, 0, 24, 20, 8, 2, 205, 24, 201, 172, 171, 136, 144, 187, 49, 194, 120, 39, 33, 38, 152, 136, 48, 131, 155, 35, 205, 41, 177, 223, 187, 138, 33, 83, 2, 169, 8, 32, 52, 20, 0, 16, 146, 173, 56, 69, 128, 218, 205, 24, 2, 24, 34, 17, 169, 41, 147, 255, 137, 8, 48, 52, 145, 221, 172, 152, 8, 50, 35, 34, 152, 219, 173, 9, 67, 51, 51, 35, 153, 98, 19, 18, 136, 49, 3, 144, 237, 170, 206, 9, 144, 169, 236, 139, 136, 152, 25, 69, 184, 27, 52, 1, 68, 18, 33, 33, 129, 219, 138, 115, 55, 144, 137, 153, 136, 204, 138, 33, 51, 2, 217, 188, 169, 203, 170, 24, 67, 51, 19, 219, 170, 219, 80, 4, 32, 19, 33, 193, 174, 168, 8, 18, 1, 152, 117, 3, 9, 128, 187, 40, 68, 35, 48, 87, 3, 201, 156, 8, 137, 16, 67, 192, 207, 171, 155, 0, 17, 18, 144, 24, 8, 83, 34, 68, 17, 86, 2, 136, 0, 0, 168, 188, 202, 235, 155, 16, 0, 8, 0, 220, 171, 32, 99, 53, 3, 152, 170, 138, 65, 36, 144, 186, 138, 152, 72, 55, 161, 189, 10, 1, 153, 24, 99, 147, 206, 24, 130, 202, 172, 9, 128, 153, 138, 85, 19, 32, 53, 161, 139, 84, 34, 34, 69, 130, 203, 186, 139, 18, 32, 19, 152, 216, 222, 171, 153, 40, 51, 128, 24, 161, 189, 204, 139, 169, 8, 193, 107, 39, 153, 48, 160, 187, 157, 114, 18, 67, 19, 129, 187, 155, 185, 203, 25, 19, 217, 206, 138, 1, 202, 41, 52, 18, 152, 96, 36, 17, 152, 49, 4, 153, 65, 21, 128, 201, 171, 234, 174, 137, 136, 33, 152, 24, 192, 205, 9, 51, 67, 67, 2, 136, 137, 154, 115, 3, 155, 152, 218, 221, 9, 129, 8, 144, 10, 176, 189, 9, 114, 20, 34, 3, 50, 145, 98, 35, 51, 153, 49, 176, 154, 221, 203, 187, 206, 154, 1, 136, 50, 2, 201, 138, 249, 139, 50, 144, 65, 147, 173, 82, 17, 101, 2, 137, 128, 138, 65, 35, 8, 160, 255, 138, 128, 0, 82, 146, 188, 169, 187, 172, 10, 99, 19, 184, 154, 154, 9, 100, 52, 53, 2, 144, 136, 144, 137, 34, 16, 23, 6, 35, 0, 200, 191, 24, 18, 168, 186, 187, 204, 173, 96, 36, 129, 128, 219, 186, 171, 72, 53, 51, 53, 160, 190, 137, 152, 81, 36, 32, 36, 184, 171, 219, 171, 40, 131, 137, 146, 11, 37, 235, 138, 184, 158, 49, 36, 83, 19, 169, 9, 186, 156, 83, 52, 35, 185, 220, 206, 171, 136, 32, 1, 33, 16, 130, 191, 64, 53, 36, 1, 16, 18, 129, 168, 8, 218, 188, 188, 154, 235, 173, 137, 145, 202, 10, 114, 35, 128, 56, 68, 129, 170, 40, 53, 3, 137, 16, 252, 173, 155, 152, 8, 128, 168, 185, 174, 9, 34, 33, 116, 51, 67, 34, 0, 16, 17, 160, 58, 55, 33, 18, 188, 153, 188, 203, 172, 136, 48, 3, 187, 8, 144, 190, 40, 83, 86, 20, 1, 50, 144, 139, 35, 220, 56, 18, 144, 206, 203, 171, 169, 190, 9, 1, 9, 169, 139, 1, 185, 114, 38, 34, 67, 1, 8, 144, 154, 145, 205, 9, 146, 204, 187, 171, 10, 185, 59, 119, 0, 33, 3, 25, 37, 136, 16, 161, 204, 138, 222, 156, 169, 187, 152, 153, 0, 18, 184, 73, 21, 0, 2, 81, 54, 2, 169, 25, 145, 155, 145, 11, 54, 160, 173, 33, 250, 57, 55, 17, 33, 36, 8, 0, 204, 9, 234, 138, 17, 128, 186, 139, 154, 80, 53, 69, 51, 67, 130, 201, 155, 48, 130, 202, 156, 17, 238, 154, 128, 40, 18, 33, 68, 3, 115, 19, 16, 67, 1, 185, 11, 19, 8, 241, 191, 170, 153, 168, 24, 153, 117, 131, 11, 52, 49, 22, 128, 160, 25, 132, 138, 0, 24, 3, 218, 188, 171, 237, 10, 18, 153, 202, 171, 188, 24, 49, 53, 130, 8, 100, 146, 139, 66, 18, 162, 207, 24, 34, 19, 137, 8, 8, 232, 173, 65, 51, 1, 32, 132, 190, 154, 139, 52, 201, 170, 221, 154, 171, 16, 234, 172, 172, 154, 154, 49, 68, 52, 130, 0, 56, 119, 34, 67, 35, 35, 35, 1, 24, 66, 19, 137, 136, 202, 203, 206, 187, 187, 187, 235, 170, 153, 136, 186, 187, 204, 138, 0, 66, 20, 34, 131, 218, 188, 138, 128, 97, 3, 9, 176, 190, 203, 155, 137, 40, 144, 172, 169, 223, 171, 136, 201, 10, 18, 8, 17, 186, 24, 249, 27, 37, 25, 86, 129, 24, 1, 8, 130, 139, 70, 2, 33, 144, 186, 201, 190, 9, 168, 16, 217, 156, 235, 155, 169, 139, 144, 155, 34, 136, 64, 37, 32, 102, 18, 50, 20, 82, 38, 1, 17, 129, 128, 153, 32, 50, 20, 0, 19, 218, 154, 136, 84, 83, 51, 145, 33, 145, 11, 18, 73, 119, 152, 32, 145, 187, 25, 161, 186, 235, 156, 82, 144, 137, 152, 152, 204, 154, 8, 70, 129, 25, 1, 186, 219, 137, 128, 0, 40, 22, 206, 24, 146, 156, 33, 50, 83, 18, 137, 168, 138, 36, 236, 41, 145, 24, 224, 11, 18, 233, 155, 17, 48, 6, 155, 53, 201, 8, 168, 218, 0, 38, 0, 97, 130, 153, 24, 145, 12, 210, 158, 144, 157, 50, 161, 25, 18, 219, 24, 17, 116, 34, 66, 131, 25, 37, 160, 155, 138, 103, 161, 175, 128, 171, 41, 160, 43, 87, 144, 10, 152, 88, 52, 0, 24, 34, 129, 169, 220, 41, 3, 204, 171, 138, 169, 204, 203, 137, 128, 138, 152, 25, 69, 130, 237, 187, 187, 155, 9, 65, 71, 35, 35, 51, 86, 52, 52, 51, 34, 17, 1, 128, 136, 8, 160, 203, 204, 204, 188, 189, 186, 203, 170, 154, 154, 152, 152, 137, 152, 153, 170, 96, 54, 129, 8, 153, 186, 205, 155, 49, 2, 17, 184, 203, 203, 154, 32, 87, 18, 0, 153, 154, 220, 172, 154, 201, 171, 171, 185, 188, 187, 154, 8, 49, 71, 53, 52, 36, 18, 50, 2, 16, 35, 35, 177, 223, 186, 236, 187, 154, 152, 186, 136, 202, 154, 203, 10, 144, 88, 39, 129, 8, 34, 34, 35, 49, 119, 18, 50, 20, 17, 68, 129, 65, 2, 72, 20, 153, 66, 168, 10, 176, 140, 0, 171, 50, 250, 12, 168, 172, 137, 32, 37, 145, 24, 186, 113, 148, 154, 66, 2, 136, 128, 201, 26, 2, 137, 51, 82, 20, 169, 16, 144, 115, 130, 153, 200, 154, 160, 251, 157, 0, 234, 154, 24, 18, 152, 65, 132, 172, 81, 146, 10, 37, 136, 17, 189, 40, 249, 26, 3, 9, 35, 154, 101, 160, 59, 22, 137, 49, 168, 40, 233, 26, 176, 157, 128, 189, 10, 184, 27, 20, 16, 51, 169, 115, 5, 17, 18, 48, 163, 191, 49, 217, 25, 216, 138, 33, 145, 185, 138, 217, 43, 103, 34, 49, 4, 154, 8, 187, 96, 35, 1, 24, 52, 250, 157, 136, 154, 115, 35, 168, 155, 128, 221, 10, 1, 136, 18, 152, 218, 221, 171, 136, 252, 156, 81, 68, 34, 35, 51, 35, 16, 32, 51, 34, 1, 128, 202, 189, 189, 204, 187, 186, 202, 219, 187, 171, 139, 136, 169, 138, 9, 1, 251, 188, 186, 218, 188, 156, 8, 33, 1, 144, 9, 68, 50, 68, 69, 52, 2, 136, 137, 136, 185, 172, 170, 171, 189, 205, 171, 172, 154, 169, 153, 16, 50, 35, 0, 129, 153, 115, 133, 57, 103, 129, 136, 136, 0, 168, 56, 20, 49, 4, 203, 139, 137, 168, 202, 139, 2, 239, 186, 171, 153, 203, 32, 130, 80, 54, 35, 50, 85, 36, 49, 83, 18, 48, 19, 144, 202, 171, 1, 219, 137, 24, 36, 217, 10, 144, 43, 71, 129, 25, 53, 128, 202, 171, 32, 184, 171, 136, 136, 204, 171, 201, 9, 83, 52, 17, 101, 35, 24, 17, 8, 136, 10, 99, 144, 171, 152, 251, 203, 154, 32, 68, 1, 10, 99, 161, 25, 2, 16, 0, 114, 164, 174, 1, 203, 8, 200, 40, 130, 26, 3, 25, 22, 153, 84, 145, 64, 129, 72, 146, 188, 144, 220, 169, 170, 136, 220, 24, 177, 12, 3, 172, 49, 136, 100, 129, 32, 130, 41, 162, 158, 3, 1, 43, 0, 144, 203, 170, 187, 170, 173, 32, 17, 49, 53, 103, 51, 0, 65, 130, 40, 131, 11, 54, 202, 40, 177, 173, 169, 25, 177, 90, 133, 156, 128, 205, 10, 128, 169, 56, 5, 219, 172, 236, 205, 10, 17, 82, 71, 52, 34, 0, 0, 0, 136, 24, 1, 128, 136, 202, 207, 187, 187, 155, 144, 137, 34, 161, 172, 170, 202, 219, 154, 184, 205, 156, 186, 205, 170, 170, 153, 24, 66, 52, 54, 51, 50, 17, 32, 3, 9, 33, 152, 236, 205, 203, 186, 172, 9, 16, 34, 51, 66, 130, 155, 17, 186, 26, 216, 155, 233, 189, 189, 171, 169, 25, 69, 50, 84, 34, 50, 51, 17, 33, 1, 201, 188, 204, 189, 171, 204, 171, 137, 153, 32, 52, 67, 68, 36, 34, 51, 19, 49, 36, 128, 153, 136, 202, 173, 169, 153, 114, 35, 66, 69, 18, 32, 21, 144, 0, 160, 172, 128, 201, 187, 187, 202, 190, 41, 18, 32, 55, 128, 50, 184, 26, 178, 158, 8, 48, 177, 158, 17, 202, 139, 68, 34, 84, 20, 32, 67, 144, 170, 0, 170, 10, 18, 2, 218, 57, 242, 175, 33, 128, 82, 130, 33, 162, 156, 144, 191, 24, 202, 40, 145, 139, 129, 41, 146, 28, 71, 129, 50, 1, 56, 208, 157, 185, 188, 153, 188, 8, 186, 88, 178, 28, 55, 0, 50, 130, 154, 136, 203, 155, 201, 191, 172, 137, 218, 27, 53, 33, 99, 19, 17, 33, 168, 41, 38, 160, 48, 176, 191, 171, 24, 144, 113, 36, 24, 17, 128, 251, 26, 200, 142, 16, 169, 153, 24, 145, 158, 161, 207, 170, 171, 113, 84, 69, 51, 18, 1, 136, 168, 9, 17, 1, 17, 128, 220, 205, 188, 9, 0, 0, 49, 35, 201, 172, 185, 220, 187, 170, 188, 172, 169, 171, 171, 171, 138, 33, 51, 101, 52, 52, 36, 129, 152, 186, 204, 170, 11, 1, 184, 153, 234, 171, 9, 100, 51, 68, 51, 1, 153, 204, 172, 187, 172, 156, 138, 144, 152, 0, 144, 49, 36, 101, 52, 35, 51, 2, 201, 188, 172, 188, 171, 202, 154, 153, 169, 137, 56, 37, 68, 37, 50, 36, 18, 0, 160, 204, 171, 155, 153, 41, 55, 51, 84, 51, 51, 84, 35, 33, 83, 2, 49, 160, 188, 202, 205, 155, 137, 17, 8, 66, 4, 170, 33, 128, 40, 21, 24, 144, 207, 187, 203, 186, 171, 32, 52, 51, 71, 2, 49, 18, 8, 50, 19, 33, 51, 160, 207, 170, 204, 171, 25, 99, 66, 67, 34, 17, 144, 137, 17, 8, 33, 176, 207, 205, 171, 202, 172, 0, 17, 33, 50, 54, 130, 8, 19, 153, 128, 169, 152, 255, 154, 186, 172, 153, 9, 36, 136, 102, 130, 24, 34, 153, 9, 152, 8, 162, 191, 137, 204, 154, 169, 112, 36, 1, 49, 18, 145, 189, 25, 161, 205, 24, 168, 9, 240, 138, 2, 170, 49, 83, 53, 35, 33, 52, 160, 140, 17, 128, 137, 67, 146, 237, 188, 66, 3, 46, 0, 156, 169, 154, 66, 1, 83, 147, 219, 188, 220, 189, 56, 85, 83, 53, 36, 17, 128, 152, 137, 8, 1, 33, 18, 184, 205, 170, 170, 9, 16, 50, 52, 128, 153, 218, 254, 203, 170, 189, 170, 154, 153, 169, 153, 154, 154, 8, 49, 84, 53, 1, 0, 185, 191, 202, 187, 154, 136, 17, 67, 34, 66, 17, 33, 52, 69, 52, 19, 1, 202, 205, 187, 204, 170, 137, 8, 49, 66, 52, 17, 17, 0, 33, 129, 17, 145, 221, 205, 172, 170, 172, 171, 137, 17, 49, 69, 35, 130, 152, 202, 171, 137, 0, 144, 221, 188, 187, 188, 9, 84, 69, 83, 67, 34, 18, 33, 129, 138, 17, 17, 67, 144, 66, 192, 173, 8, 0, 16, 85, 51, 17, 144, 152, 217, 157, 136, 154, 202, 173, 24, 218, 155, 16, 24, 17, 64, 55, 144, 72, 2, 137, 184, 41, 162, 140, 0, 115, 132, 153, 50, 192, 25, 70, 67, 18, 83, 130, 170, 152, 202, 186, 188, 41, 177, 156, 169, 65, 193, 43, 39, 0, 16, 33, 17, 200, 221, 154, 169, 219, 139, 17, 152, 65, 19, 34, 53, 34, 2, 25, 55, 169, 66, 184, 171, 207, 154, 169, 155, 98, 34, 68, 18, 115, 2, 9, 2, 168, 138, 137, 185, 207, 137, 168, 170, 24, 66, 53, 0, 8, 144, 153, 0, 154, 81, 176, 173, 170, 9, 51, 64, 119, 147, 9, 130, 218, 203, 154, 144, 172, 8, 153, 66, 18, 83, 130, 185, 207, 187, 139, 118, 53, 52, 52, 35, 128, 16, 16, 8, 49, 53, 1, 169, 154, 8, 153, 136, 48, 132, 190, 49, 161, 155, 233, 190, 222, 171, 186, 171, 153, 170, 169, 220, 186, 170, 170, 137, 17, 217, 156, 185, 190, 187, 202, 171, 187, 170, 25, 51, 37, 67, 19, 137, 50, 19, 136, 153, 202, 222, 171, 187, 172, 169, 139, 115, 52, 67, 37, 2, 8, 16, 160, 170, 136, 250, 173, 0, 144, 138, 219, 154, 201, 172, 16, 16, 200, 188, 219, 172, 170, 186, 204, 187, 187, 155, 9, 16, 85, 51, 34, 98, 53, 34, 36, 17, 16, 128, 17, 32, 70, 51, 54, 18, 16, 18, 50, 35, 65, 69, 50, 18, 0, 65, 131, 27, 4, 170, 136, 25, 36, 136, 113, 36, 200, 10, 20, 186, 56, 36, 200, 25, 18, 34, 251, 89, 5, 152, 129, 8, 18, 220, 40, 3, 136, 66, 67, 2, 137, 32, 0, 129, 191, 114, 20, 136, 1, 136, 160, 11, 52, 0, 16, 66, 240, 174, 138, 128, 219, 155, 136, 202, 170, 1, 218, 72, 21, 169, 169, 41, 38, 154, 99, 34, 52, 152, 25, 129, 56, 37, 34, 38, 129, 24, 17, 184, 140, 82, 2, 16, 35, 40, 87, 128, 153, 56, 38, 137, 66, 34, 1, 187, 58, 55, 184, 138, 115, 145, 154, 50, 68, 176, 141, 16, 66, 145, 155, 152, 251, 190, 171, 136, 202, 41, 146, 203, 156, 33, 233, 173, 137, 137, 115, 55, 120, 10, 52, 0, 51, 50, 34, 35, 145, 40, 52, 67, 69, 34, 33, 51, 36, 2, 32, 20, 24, 53, 35, 51, 83, 35, 251, 154, 168, 187, 155, 32, 128, 185, 221, 154, 235, 171, 186, 171, 204, 172, 219, 174, 187, 219, 171, 172, 171, 153, 169, 203, 171, 204, 170, 203, 171, 170, 170, 235, 188, 187, 188, 189, 170, 155, 153, 8, 16, 128, 136, 0, 144, 138, 82, 52, 20, 66, 2, 137, 128, 9, 177, 123, 55, 34, 18, 128, 16, 184, 174, 153, 16, 152, 64, 208, 171, 203, 16, 234, 88, 69, 34, 50, 67, 18, 16, 129, 33, 84, 68, 50, 36, 128, 8, 128, 187, 88, 52, 34, 34, 67, 34, 53, 1, 65, 37, 51, 53, 130, 25, 52, 145, 24, 35, 114, 39, 153, 40, 20, 0, 33, 66, 35, 17, 68, 130, 170, 137, 154, 8, 153, 114, 103, 1, 136, 128, 144, 170, 138, 82, 35, 67, 50, 2, 251, 172, 138, 152, 9, 115, 51, 19, 168, 154, 201, 174, 8, 16, 17, 24, 18, 251, 187, 189, 171, 137, 65, 52, 67, 34, 152, 189, 186, 190, 25, 18, 34, 51, 37, 160, 8, 250, 11, 50, 84, 67, 67, 35, 169, 169, 188, 187, 154, 81, 20, 9, 69, 162, 171, 16, 144, 171, 114, 20, 48, 67, 3, 234, 154, 128, 172, 25, 33, 68, 18, 34, 152, 171, 220, 189, 40, 52, 33, 99, 18, 153, 136, 250, 172, 136, 137, 33, 3, 152, 189, 170, 239, 172, 137, 136, 65, 54, 51, 36, 36, 130, 137, 34, 34, 33, 103, 67, 34, 35, 35, 34, 16, 34, 34, 70, 51, 68, 18, 0, 0, 0, 219, 139, 8, 33, 144, 137, 186, 190, 206, 172, 187, 187, 203, 188, 219, 188, 203, 203, 187, 188, 154, 152, 202, 170, 185, 190, 172, 202, 187, 154, 202, 187, 154, 202, 205, 170, 185, 203, 138, 136, 153, 137, 136, 129, 221, 171, 168, 137, 137, 24, 115, 52, 146, 136, 16, 144, 186, 58, 21, 32, 53, 18, 19, 152, 9, 33, 232, 140, 101, 34, 33, 50, 54, 33, 51, 17, 68, 50, 52, 17, 84, 1, 67, 18, 66, 2, 81, 35, 67, 51, 68, 17, 65, 18, 33, 51, 38, 2, 8, 184, 157, 136, 154, 41, 119, 21, 17, 18, 51, 131, 186, 24, 17, 145, 10, 87, 129, 16, 50, 35, 160, 155, 48, 146, 205, 56, 55, 130, 10, 52, 217, 139, 1, 169, 10, 66, 55, 18, 18, 33, 38, 185, 138, 152, 154, 156, 40, 129, 8, 233, 188, 221, 156, 8, 137, 144, 9, 178, 206, 201, 188, 170, 185, 170, 16, 34, 49, 37, 152, 40, 18, 66, 87, 53, 35, 66, 19, 16, 136, 9, 32, 85, 19, 49, 38, 18, 18, 144, 152, 153, 136, 153, 68, 35, 68, 1, 36, 144, 24, 136, 136, 221, 188, 32, 145, 189, 137, 18, 202, 203, 156, 160, 172, 56, 52, 53, 50, 51, 66, 131, 74, 55, 33, 39, 128, 144, 171, 169, 186, 35, 9, 23, 0, 203, 40, 2, 203, 250, 223, 173, 155, 153, 137, 100, 53, 51, 36, 18, 128, 136, 16, 0, 66, 119, 35, 18, 34, 35, 17, 16, 136, 97, 53, 34, 66, 34, 1, 144, 169, 187, 137, 67, 51, 50, 20, 168, 253, 204, 170, 171, 171, 188, 187, 204, 220, 171, 203, 203, 153, 154, 170, 154, 202, 204, 203, 203, 186, 186, 187, 170, 187, 190, 203, 203, 203, 186, 154, 137, 136, 137, 8, 168, 207, 138, 169, 137, 24, 35, 83, 19, 24, 19, 217, 155, 83, 1, 16, 34, 145, 172, 220, 155, 0, 32, 54, 83, 35, 34, 34, 34, 51, 100, 84, 51, 34, 17, 18, 152, 9, 49, 87, 52, 67, 19, 2, 152, 136, 8, 33, 99, 69, 50, 34, 145, 16, 20, 1, 16, 114, 36, 19, 160, 173, 16, 144, 26, 100, 68, 83, 17, 0, 0, 137, 0, 49, 52, 100, 36, 16, 128, 186, 170, 137, 17, 115, 55, 34, 18, 1, 185, 187, 203, 138, 50, 101, 67, 33, 17, 144, 187, 172, 153, 136, 84, 35, 34, 130, 219, 220, 187, 203, 139, 48, 34, 82, 19, 129, 185, 191, 138, 170, 154, 16, 16, 128, 153, 251, 170, 170, 56, 103, 17, 18, 66, 1, 187, 40, 146, 156, 84, 1, 33, 18, 128, 153, 25, 144, 57, 119, 35, 18, 33, 130, 188, 8, 16, 146, 57, 119, 4, 128, 136, 169, 138, 216, 157, 0, 155, 0, 202, 187, 138, 130, 221, 9, 129, 188, 186, 56, 21, 0, 17, 65, 35, 136, 115, 135, 138, 50, 51, 3, 72, 54, 34, 249, 189, 9, 1, 250, 10, 35, 136, 136, 153, 186, 174, 170, 57, 55, 50, 86, 51, 35, 17, 51, 52, 19, 17, 87, 67, 34, 50, 68, 34, 17, 2, 50, 52, 50, 68, 36, 17, 34, 2, 144, 154, 153, 136, 185, 173, 139, 176, 255, 188, 170, 185, 189, 172, 170, 203, 173, 171, 188, 187, 203, 170, 172, 171, 203, 203, 204, 187, 187, 202, 172, 154, 170, 202, 188, 187, 204, 171, 186, 155, 171, 154, 136, 203, 173, 155, 186, 173, 154, 16, 16, 16, 136, 168, 206, 170, 154, 201, 140, 82, 2, 136, 65, 3, 9, 145, 12, 69, 67, 130, 112, 36, 33, 2, 48, 36, 17, 36, 82, 37, 17, 37, 18, 34, 51, 51, 51, 51, 85, 69, 18, 32, 35, 52, 18, 17, 17, 54, 145, 137, 8, 1, 186, 65, 161, 140, 116, 19, 136, 16, 67, 130, 172, 152, 155, 18, 185, 40, 34, 116, 2, 170, 236, 139, 144, 171, 8, 8, 70, 2, 136, 168, 25, 4, 10, 71, 18, 69, 34, 50, 2, 33, 3, 16, 34, 56, 103, 1, 0, 16, 18, 136, 33, 35, 67, 20, 32, 3, 207, 154, 1, 234, 139, 83, 146, 155, 17, 8, 19, 120, 39, 16, 66, 66, 51, 137, 115, 3, 0, 8, 114, 35, 33, 35, 49, 34, 82, 18, 99, 36, 33, 129, 24, 35, 0, 17, 98, 52, 35, 33, 69, 17, 17, 29, 0, 130, 169, 139, 17, 202, 114, 22, 0, 1, 144, 250, 171, 186, 171, 186, 171, 152, 8, 235, 171, 205, 170, 188, 137, 186, 153, 236, 170, 202, 139, 168, 80, 37, 33, 34, 8, 146, 156, 160, 140, 67, 18, 144, 186, 255, 173, 185, 156, 153, 9, 19, 1, 201, 187, 184, 190, 138, 81, 71, 35, 50, 53, 18, 0, 33, 35, 68, 53, 69, 51, 51, 52, 35, 18, 34, 67, 52, 68, 51, 67, 51, 17, 2, 0, 1, 24, 51, 17, 17, 152, 251, 223, 171, 185, 188, 187, 187, 234, 188, 203, 204, 187, 172, 203, 171, 171, 203, 202, 219, 171, 187, 204, 187, 171, 203, 186, 202, 203, 187, 173, 187, 172, 187, 170, 185, 170, 154, 203, 203, 186, 202, 172, 8, 0, 51, 128, 33, 1, 200, 159, 32, 128, 17, 50, 54, 19, 66, 2, 136, 169, 72, 54, 66, 52, 53, 35, 51, 19, 65, 17, 114, 35, 82, 53, 50, 35, 50, 36, 18, 49, 52, 69, 51, 83, 51, 50, 36, 17, 49, 68, 35, 1, 84, 35, 1, 128, 16, 35, 152, 139, 85, 35, 0, 65, 20, 144, 48, 131, 186, 171, 67, 128, 116, 52, 68, 18, 32, 50, 130, 191, 64, 130, 9, 16, 116, 35, 16, 16, 32, 2, 56, 55, 34, 68, 35, 18, 8, 35, 144, 137, 170, 117, 38, 128, 66, 3, 168, 154, 50, 146, 57, 39, 51, 145, 56, 145, 49, 250, 57, 19, 169, 97, 35, 137, 114, 130, 202, 138, 8, 152, 203, 187, 97, 130, 154, 17, 144, 234, 156, 145, 138, 50, 116, 20, 24, 20, 49, 192, 27, 21, 138, 54, 17, 36, 136, 50, 128, 48, 18, 70, 1, 16, 152, 114, 23, 154, 40, 67, 176, 156, 49, 18, 218, 138, 136, 160, 171, 136, 203, 220, 187, 218, 155, 168, 156, 128, 204, 154, 171, 16, 251, 138, 137, 32, 217, 41, 145, 57, 164, 12, 130, 157, 0, 171, 17, 218, 24, 66, 36, 205, 72, 20, 0, 160, 11, 86, 130, 137, 67, 19, 136, 8, 83, 35, 99, 34, 98, 130, 139, 144, 190, 170, 187, 153, 137, 144, 207, 48, 192, 172, 170, 9, 153, 98, 18, 82, 51, 17, 152, 112, 52, 19, 64, 71, 18, 33, 50, 83, 34, 32, 36, 34, 34, 85, 2, 24, 37, 152, 17, 0, 152, 26, 130, 205, 154, 8, 218, 189, 153, 204, 138, 218, 156, 153, 172, 169, 219, 171, 187, 204, 173, 154, 187, 186, 189, 187, 188, 187, 190, 170, 187, 203, 172, 170, 188, 203, 187, 170, 219, 172, 136, 185, 187, 203, 154, 187, 172, 153, 171, 137, 8, 176, 175, 0, 185, 8, 168, 80, 18, 68, 129, 83, 19, 35, 0, 50, 65, 39, 33, 54, 128, 115, 1, 16, 1, 82, 35, 81, 35, 66, 37, 50, 67, 16, 68, 17, 50, 52, 52, 51, 67, 34, 50, 67, 35, 51, 53, 33, 36, 33, 130, 25, 147, 207, 34, 144, 98, 146, 56, 3, 171, 128, 231, 248, 18, 0, 186, 169, 189, 57, 53, 50, 21, 24, 54, 192, 73, 130, 41, 20, 115, 20, 66, 20, 16, 37, 17, 52, 18, 83, 35, 67, 2, 66, 18, 0, 18, 1, 9, 168, 155, 176, 141, 192, 191, 185, 191, 138, 186, 80, 68, 85, 36, 83, 52, 34, 17, 1, 136, 202, 171, 203, 171, 138, 24, 18, 24, 50, 161, 171, 137, 252, 174, 186, 202, 219, 203, 203, 155, 185, 170, 25, 33, 49, 54, 50, 67, 34, 144, 33, 130, 155, 128, 220, 10, 1, 42, 87, 51, 17, 69, 2, 32, 18, 200, 171, 251, 187, 169, 171, 0, 65, 37, 52, 35, 51, 18, 185, 157, 168, 204, 170, 203, 25, 1, 16, 35, 168, 57, 55, 184, 156, 204, 138, 201, 204, 170, 154, 154, 65, 18, 18, 116, 20, 33, 130, 168, 205, 170, 203, 188, 171, 170, 41, 131, 80, 38, 65, 51, 67, 37, 18, 51, 161, 138, 252, 171, 219, 170, 203, 139, 128, 24, 1, 24, 2, 144, 64, 179, 207, 136, 207, 171, 187, 170, 153, 65, 35, 0, 170, 10, 249, 189, 137, 17, 129, 72, 55, 168, 188, 170, 189, 153, 153, 9, 83, 52, 0, 201, 187, 218, 190, 24, 18, 97, 69, 18, 18, 0, 128, 186, 173, 203, 187, 41, 35, 84, 51, 83, 18, 136, 185, 175, 137, 138, 16, 34, 67, 68, 18, 8, 152, 173, 186, 187, 16, 48, 37, 128, 217, 206, 186, 139, 16, 49, 71, 66, 18, 144, 184, 187, 187, 140, 99, 36, 36, 18, 32, 1, 184, 221, 187, 137, 17, 152, 113, 37, 18, 152, 153, 218, 188, 204, 170, 138, 81, 52, 53, 36, 2, 129, 169, 169, 10, 68, 18, 184, 173, 170, 204, 173, 25, 85, 83, 69, 67, 17, 184, 190, 173, 187, 170, 136, 33, 53, 36, 35, 19, 128, 152, 154, 153, 154, 152, 236, 219, 219, 155, 9, 33, 36, 19, 128, 137, 154, 41, 71, 36, 18, 0, 144, 171, 204, 189, 155, 138, 8, 66, 37, 130, 137, 8, 68, 68, 34, 144, 220, 172, 155, 170, 16, 34, 32, 52, 53, 52, 4, 185, 189, 187, 154, 8, 2, 169, 96, 20, 0, 33, 144, 251, 189, 9, 98, 51, 17, 49, 37, 1, 128, 169, 203, 189, 154, 8, 152, 185, 9, 152, 57, 71, 67, 20, 169, 171, 25, 51, 1, 67, 176, 255, 154, 8, 1, 34, 34, 129, 152, 32, 145, 203, 173, 186, 206, 138, 33, 36, 185, 156, 169, 114, 87, 18, 128, 136, 169, 40, 21, 8, 152, 171, 217, 188, 24, 50, 52, 129, 137, 48, 87, 51, 19, 200, 188, 187, 173, 8, 1, 185, 9, 49, 53, 83, 52, 130, 218, 188, 9, 17, 128, 9, 145, 205, 187, 41, 50, 34, 66, 69, 50, 18, 136, 184, 207, 171, 154, 189, 80, 36, 129, 24, 19, 136, 16, 0, 168, 174, 9, 1, 136, 203, 140, 1, 184, 171, 187, 207, 138, 201, 171, 80, 35, 153, 18, 203, 154, 203, 237, 189, 114, 245, 48, 0, 171, 9, 50, 52, 0, 0, 8, 251, 10, 2, 8, 144, 113, 23, 128, 8, 152, 184, 203, 10, 82, 19, 152, 40, 37, 52, 54, 36, 129, 168, 202, 187, 187, 138, 0, 170, 64, 84, 52, 35, 129, 24, 184, 156, 0, 160, 206, 155, 185, 221, 187, 236, 187, 8, 128, 33, 84, 36, 50, 18, 153, 235, 205, 187, 153, 169, 25, 34, 33, 68, 52, 50, 67, 1, 0, 168, 190, 218, 203, 155, 24, 34, 35, 68, 19, 50, 53, 36, 34, 145, 251, 186, 170, 187, 24, 18, 0, 67, 18, 33, 66, 70, 51, 84, 34, 128, 201, 204, 203, 170, 187, 9, 33, 99, 53, 36, 51, 2, 136, 169, 170, 219, 173, 136, 168, 9, 67, 51, 100, 52, 129, 0, 49, 1, 40, 54, 2, 185, 205, 203, 203, 157, 24, 33, 35, 52, 35, 115, 67, 51, 3, 220, 188, 188, 171, 154, 137, 33, 99, 36, 2, 0, 129, 202, 188, 169, 154, 25, 1, 138, 186, 155, 129, 207, 10, 184, 155, 50, 83, 54, 52, 68, 35, 160, 207, 187, 172, 137, 153, 66, 35, 51, 36, 130, 153, 33, 129, 82, 160, 189, 235, 172, 137, 128, 80, 54, 129, 136, 152, 153, 8, 32, 50, 35, 184, 186, 190, 72, 4, 136, 17, 169, 236, 221, 138, 8, 49, 68, 55, 19, 128, 144, 218, 155, 153, 153, 154, 25, 17, 114, 36, 67, 21, 144, 128, 203, 187, 188, 9, 34, 85, 19, 33, 130, 170, 219, 173, 128, 136, 33, 18, 128, 8, 67, 67, 33, 2, 251, 202, 187, 10, 17, 100, 20, 0, 1, 201, 219, 172, 186, 137, 19, 48, 70, 34, 34, 34, 129, 168, 186, 239, 171, 170, 155, 171, 40, 2, 136, 98, 51, 83, 52, 128, 17, 146, 187, 24, 16, 84, 130, 80, 54, 34, 53, 19, 33, 18, 32, 51, 2, 128, 24, 251, 158, 136, 219, 138, 186, 158, 129, 203, 32, 217, 138, 185, 204, 203, 235, 203, 203, 154, 170, 8, 0, 16, 1, 17, 201, 205, 235, 187, 202, 155, 152, 136, 34, 51, 18, 16, 168, 251, 188, 0, 8, 70, 161, 48, 130, 9, 50, 68, 35, 85, 2, 24, 35, 153, 98, 18, 52, 20, 18, 128, 154, 136, 8, 83, 34, 34, 208, 11, 193, 141, 208, 140, 1, 10, 67, 144, 152, 138, 116, 2, 49, 130, 202, 186, 173, 9, 66, 85, 52, 128, 24, 0, 152, 16, 52, 34, 52, 24, 85, 1, 83, 51, 51, 0, 33, 146, 188, 56, 19, 137, 117, 52, 67, 50, 17, 33, 176, 156, 201, 172, 184, 175, 0, 144, 16, 51, 69, 67, 51, 184, 154, 234, 170, 218, 172, 155, 186, 154, 17, 67, 130, 88, 5, 155, 0, 10, 37, 170, 18, 173, 17, 204, 24, 250, 141, 185, 25, 18, 57, 55, 17, 50, 1, 2, 233, 170, 220, 171, 186, 171, 24, 153, 100, 34, 115, 36, 33, 18, 136, 184, 191, 187, 188, 139, 137, 115, 20, 33, 2, 59, 7, 43, 0, 8, 17, 153, 33, 1, 24, 129, 50, 251, 207, 153, 8, 9, 83, 3, 0, 128, 170, 139, 64, 70, 2, 137, 2, 170, 99, 33, 51, 145, 238, 171, 187, 203, 137, 1, 81, 54, 33, 82, 34, 17, 34, 162, 203, 202, 189, 190, 188, 170, 170, 137, 129, 24, 130, 154, 217, 189, 137, 81, 38, 66, 68, 50, 51, 49, 34, 144, 152, 204, 172, 187, 9, 33, 70, 52, 53, 51, 50, 19, 152, 203, 189, 219, 187, 202, 171, 154, 170, 8, 65, 67, 18, 8, 176, 223, 170, 189, 172, 187, 172, 171, 171, 170, 153, 1, 1, 66, 18, 136, 168, 205, 170, 188, 172, 170, 203, 187, 202, 154, 137, 64, 71, 35, 83, 36, 33, 50, 51, 67, 34, 17, 160, 171, 184, 155, 24, 82, 71, 51, 98, 35, 49, 20, 40, 18, 202, 139, 250, 175, 153, 187, 153, 153, 24, 128, 16, 33, 50, 18, 81, 38, 200, 137, 184, 174, 185, 40, 2, 115, 21, 34, 50, 33, 50, 52, 18, 99, 130, 8, 19, 16, 35, 114, 39, 32, 20, 16, 19, 16, 17, 48, 36, 32, 53, 129, 24, 20, 33, 19, 98, 37, 144, 155, 144, 205, 153, 155, 168, 138, 18, 82, 21, 24, 54, 152, 56, 145, 188, 205, 186, 220, 139, 169, 157, 49, 144, 25, 18, 49, 20, 48, 52, 51, 18, 49, 70, 19, 185, 9, 233, 206, 155, 153, 137, 1, 48, 87, 34, 67, 36, 18, 16, 184, 204, 220, 188, 202, 186, 187, 153, 169, 9, 1, 33, 51, 70, 3, 17, 145, 171, 220, 203, 188, 169, 171, 184, 174, 1, 154, 115, 20, 82, 52, 19, 50, 36, 1, 1, 153, 233, 172, 168, 189, 136, 136, 33, 67, 84, 51, 36, 51, 1, 0, 201, 170, 221, 153, 218, 10, 129, 9, 68, 2, 33, 20, 184, 137, 201, 188, 171, 203, 189, 188, 170, 202, 187, 153, 219, 219, 235, 203, 186, 186, 41, 68, 83, 70, 51, 67, 67, 34, 18, 16, 144, 203, 187, 204, 154, 137, 32, 84, 83, 67, 51, 36, 34, 1, 144, 187, 220, 188, 203, 187, 187, 154, 9, 16, 49, 36, 18, 1, 200, 188, 190, 205, 187, 188, 188, 171, 187, 170, 153, 137, 8, 0, 16, 2, 64, 36, 0, 34, 2, 234, 187, 218, 189, 171, 170, 136, 40, 69, 85, 52, 68, 52, 50, 36, 17, 1, 144, 186, 203, 204, 170, 170, 138, 0, 66, 53, 53, 51, 51, 3, 153, 251, 189, 203, 188, 203, 170, 171, 138, 137, 49, 67, 83, 67, 18, 16, 129, 187, 188, 204, 171, 188, 170, 153, 24, 67, 69, 52, 52, 67, 51, 50, 34, 34, 17, 17, 136, 153, 153, 169, 88, 39, 66, 84, 51, 36, 67, 34, 49, 19, 16, 129, 185, 205, 187, 204, 171, 9, 137, 16, 36, 34, 84, 51, 52, 51, 51, 3, 170, 251, 205, 187, 188, 187, 153, 185, 58, 3, 41, 54, 115, 36, 33, 52, 1, 136, 168, 156, 168, 197, 7, 31, 0, 205, 9, 152, 171, 40, 69, 66, 85, 34, 66, 51, 35, 34, 35, 144, 153, 169, 235, 189, 171, 202, 171, 8, 17, 84, 2, 64, 2, 170, 184, 191, 188, 190, 188, 203, 203, 170, 170, 137, 136, 32, 18, 49, 34, 1, 186, 128, 255, 156, 200, 188, 8, 202, 42, 131, 26, 54, 2, 50, 53, 2, 80, 130, 154, 136, 220, 155, 160, 189, 49, 184, 112, 3, 48, 39, 18, 17, 83, 177, 11, 147, 207, 136, 144, 188, 64, 161, 12, 67, 168, 40, 37, 153, 64, 130, 139, 49, 145, 170, 32, 248, 174, 136, 185, 42, 52, 17, 83, 35, 152, 64, 162, 142, 145, 255, 153, 202, 172, 137, 152, 49, 70, 67, 83, 51, 35, 50, 2, 152, 185, 206, 187, 172, 154, 137, 65, 83, 68, 51, 67, 34, 1, 144, 186, 204, 204, 187, 203, 170, 154, 9, 17, 51, 67, 51, 18, 136, 219, 204, 219, 203, 187, 172, 187, 171, 170, 137, 0, 17, 66, 35, 50, 52, 67, 66, 18, 129, 201, 204, 189, 188, 187, 171, 8, 49, 86, 83, 52, 83, 51, 35, 35, 1, 168, 219, 189, 187, 203, 171, 152, 8, 50, 68, 52, 67, 51, 34, 136, 201, 221, 203, 188, 203, 186, 171, 170, 153, 8, 49, 52, 53, 53, 35, 33, 2, 169, 219, 188, 187, 203, 170, 136, 17, 115, 83, 83, 35, 67, 51, 33, 18, 128, 152, 169, 202, 203, 170, 170, 155, 24, 66, 70, 52, 83, 35, 34, 19, 145, 153, 201, 205, 203, 187, 235, 171, 152, 137, 81, 18, 82, 67, 33, 49, 36, 0, 34, 160, 187, 185, 206, 171, 153, 136, 24, 114, 52, 65, 68, 34, 67, 19, 34, 67, 160, 10, 130, 190, 154, 153, 219, 10, 36, 16, 84, 36, 66, 36, 18, 35, 19, 0, 169, 153, 252, 156, 153, 172, 136, 169, 40, 2, 8, 99, 17, 16, 144, 24, 248, 173, 186, 205, 186, 188, 187, 187, 219, 138, 168, 138, 49, 19, 65, 54, 17, 18, 169, 0, 223, 171, 170, 203, 172, 24, 0, 16, 67, 53, 18, 50, 33, 129, 154, 208, 175, 186, 189, 171, 188, 155, 136, 186, 89, 20, 40, 53, 17, 20, 136, 8, 235, 187, 188, 188, 202, 171, 153, 138, 66, 2, 116, 35, 50, 34, 160, 138, 248, 159, 8, 169, 24, 17, 33, 17, 68, 17, 68, 33, 51, 17, 50, 160, 137, 48, 22, 41, 87, 33, 53, 1, 84, 18, 0, 34, 161, 174, 152, 187, 137, 24, 70, 50, 67, 67, 18, 128, 8, 184, 255, 153, 186, 189, 170, 153, 8, 33, 84, 19, 128, 128, 236, 172, 169, 154, 56, 68, 69, 52, 51, 37, 19, 17, 1, 169, 187, 188, 172, 169, 40, 83, 68, 67, 51, 51, 33, 144, 203, 189, 205, 187, 188, 187, 186, 170, 8, 16, 34, 2, 160, 220, 220, 203, 203, 186, 187, 170, 171, 154, 169, 169, 137, 136, 32, 129, 82, 52, 84, 52, 67, 51, 17, 169, 204, 237, 235, 38, 0, 188, 188, 9, 66, 84, 69, 66, 50, 34, 50, 129, 152, 184, 204, 171, 203, 154, 137, 48, 67, 67, 50, 1, 201, 204, 203, 189, 154, 186, 172, 186, 204, 187, 173, 187, 187, 155, 137, 9, 99, 67, 68, 51, 50, 18, 168, 204, 203, 170, 154, 65, 69, 53, 67, 52, 50, 34, 2, 17, 152, 187, 154, 187, 139, 65, 54, 36, 52, 35, 129, 0, 218, 170, 202, 139, 144, 171, 152, 205, 188, 204, 137, 203, 26, 147, 12, 53, 128, 98, 2, 8, 18, 202, 169, 235, 139, 152, 41, 71, 50, 53, 67, 34, 1, 1, 154, 169, 188, 9, 8, 115, 52, 68, 52, 50, 51, 16, 128, 219, 171, 219, 154, 152, 25, 36, 17, 84, 19, 48, 20, 152, 1, 154, 50, 16, 99, 34, 37, 184, 25, 250, 174, 186, 171, 202, 139, 129, 156, 33, 185, 27, 224, 190, 168, 206, 154, 186, 140, 152, 9, 35, 0, 69, 130, 32, 2, 137, 18, 170, 32, 233, 155, 169, 205, 138, 153, 154, 168, 10, 3, 206, 40, 160, 26, 162, 42, 242, 223, 153, 205, 170, 202, 155, 185, 140, 1, 137, 68, 34, 53, 129, 82, 177, 157, 184, 174, 137, 186, 58, 4, 40, 55, 0, 66, 130, 16, 1, 136, 202, 189, 137, 218, 10, 18, 97, 3, 58, 55, 152, 40, 18, 171, 33, 185, 114, 7, 56, 37, 129, 16, 129, 188, 9, 218, 11, 0, 32, 115, 19, 66, 37, 144, 24, 160, 188, 173, 187, 205, 186, 138, 128, 9, 99, 18, 0, 168, 206, 188, 188, 171, 24, 50, 119, 51, 67, 51, 19, 1, 128, 184, 187, 187, 169, 9, 69, 52, 54, 51, 67, 19, 129, 152, 235, 187, 219, 172, 153, 170, 154, 169, 171, 169, 188, 202, 172, 218, 203, 170, 204, 154, 202, 187, 186, 205, 170, 187, 154, 154, 40, 54, 34, 84, 18, 16, 129, 170, 170, 220, 155, 137, 40, 70, 52, 54, 36, 51, 34, 2, 152, 187, 188, 187, 138, 32, 67, 84, 51, 50, 34, 128, 203, 205, 188, 188, 188, 171, 187, 154, 170, 169, 204, 203, 187, 173, 170, 137, 8, 32, 51, 18, 50, 163, 155, 152, 141, 67, 82, 119, 50, 68, 36, 36, 35, 34, 18, 128, 8, 168, 138, 1, 48, 54, 66, 53, 34, 34, 130, 136, 235, 203, 219, 187, 187, 172, 154, 203, 153, 186, 172, 187, 171, 217, 139, 0, 187, 138, 202, 171, 202, 138, 24, 69, 34, 103, 34, 82, 51, 66, 35, 17, 34, 160, 25, 51, 50, 119, 36, 34, 83, 34, 33, 17, 16, 2, 186, 9, 184, 207, 138, 17, 201, 57, 55, 17, 32, 67, 129, 155, 144, 190, 185, 223, 8, 200, 139, 18, 169, 49, 35, 66, 144, 25, 177, 223, 186, 138, 201, 27, 37, 8, 69, 129, 48, 4, 137, 2, 169, 24, 154, 50, 33, 119, 146, 56, 19, 170, 169, 173, 136, 219, 24, 131, 137, 144, 204, 187, 207, 154, 153, 219, 9, 128, 86, 4, 36, 0, 203, 155, 168, 206, 170, 154, 219, 156, 168, 172, 160, 156, 34, 251, 24, 176, 10, 160, 28, 38, 152, 113, 2, 10, 17, 153, 24, 0, 115, 34, 83, 19, 66, 1, 40, 131, 137, 18, 189, 8, 201, 11, 35, 168, 115, 163, 11, 210, 175, 168, 191, 137, 144, 9, 81, 18, 152, 16, 217, 140, 136, 137, 33, 2, 33, 66, 20, 153, 64, 162, 159, 34, 217, 73, 70, 34, 34, 85, 3, 153, 0, 202, 155, 203, 139, 67, 1, 96, 52, 145, 9, 192, 190, 188, 189, 138, 128, 80, 53, 52, 52, 18, 2, 168, 187, 203, 187, 137, 32, 99, 66, 66, 34, 35, 18, 8, 129, 204, 186, 189, 186, 188, 155, 203, 154, 220, 153, 169, 153, 24, 36, 136, 168, 205, 205, 189, 172, 186, 170, 153, 24, 34, 67, 67, 67, 18, 24, 168, 189, 204, 187, 154, 10, 67, 67, 69, 35, 51, 51, 37, 1, 49, 128, 137, 218, 154, 200, 26, 2, 114, 35, 83, 20, 33, 19, 137, 201, 190, 218, 188, 203, 154, 154, 139, 34, 1, 34, 18, 128, 204, 203, 188, 203, 186, 173, 137, 137, 33, 82, 69, 51, 53, 35, 68, 18, 32, 18, 0, 128, 137, 169, 9, 50, 87, 52, 83, 36, 17, 130, 168, 185, 189, 203, 203, 154, 171, 153, 170, 0, 152, 2, 26, 55, 186, 48, 192, 190, 9, 201, 173, 128, 217, 10, 19, 32, 86, 36, 33, 67, 1, 16, 128, 144, 172, 49, 184, 120, 20, 8, 51, 20, 33, 68, 2, 40, 147, 174, 50, 208, 10, 4, 201, 138, 130, 188, 24, 67, 36, 32, 39, 152, 153, 203, 170, 204, 153, 136, 32, 161, 113, 22, 0, 8, 16, 160, 173, 24, 0, 136, 128, 17, 129, 219, 155, 235, 172, 138, 154, 57, 4, 65, 132, 172, 201, 205, 203, 187, 170, 154, 50, 34, 87, 129, 8, 129, 187, 153, 168, 153, 136, 136, 128, 34, 208, 27, 180, 191, 128, 10, 52, 33, 53, 169, 234, 191, 187, 188, 187, 137, 128, 56, 37, 32, 20, 8, 144, 175, 153, 189, 138, 136, 17, 49, 87, 129, 56, 162, 42, 162, 45, 6, 8, 5, 9, 4, 188, 35, 219, 33, 200, 64, 146, 48, 20, 115, 3, 40, 35, 218, 139, 144, 172, 72, 35, 26, 87, 128, 33, 136, 0, 172, 0, 173, 65, 168, 114, 161, 10, 3, 154, 144, 26, 133, 140, 36, 186, 115, 178, 173, 152, 221, 171, 155, 137, 98, 52, 85, 51, 50, 17, 152, 202, 188, 172, 153, 0, 65, 67, 51, 37, 2, 18, 144, 169, 186, 189, 187, 186, 205, 170, 168, 188, 138, 186, 154, 154, 65, 33, 36, 217, 221, 220, 188, 187, 187, 154, 16, 51, 68, 51, 34, 3, 169, 202, 190, 186, 203, 10, 24, 50, 84, 36, 51, 36, 34, 19, 67, 3, 49, 4, 144, 201, 203, 187, 154, 48, 71, 67, 68, 34, 17, 128, 169, 220, 171, 188, 188, 170, 170, 8, 8, 67, 213, 241, 41, 0, 18, 33, 161, 172, 251, 173, 169, 187, 186, 170, 169, 154, 16, 115, 37, 67, 52, 51, 34, 65, 18, 136, 129, 169, 152, 138, 49, 119, 67, 68, 67, 50, 18, 18, 184, 169, 219, 155, 170, 9, 128, 33, 34, 67, 1, 18, 185, 153, 207, 138, 235, 10, 201, 156, 201, 155, 218, 172, 128, 24, 83, 67, 37, 18, 1, 144, 186, 203, 188, 8, 145, 65, 36, 99, 18, 66, 19, 81, 19, 24, 20, 152, 129, 170, 160, 139, 52, 17, 102, 51, 33, 53, 19, 32, 129, 136, 185, 156, 162, 207, 0, 235, 137, 154, 0, 186, 82, 184, 114, 130, 65, 4, 152, 168, 188, 204, 154, 8, 17, 18, 36, 130, 185, 207, 187, 220, 170, 170, 9, 1, 49, 2, 170, 249, 189, 202, 171, 153, 138, 1, 16, 20, 185, 138, 220, 187, 170, 171, 171, 189, 138, 184, 88, 20, 169, 9, 240, 174, 32, 145, 112, 20, 16, 129, 153, 235, 154, 218, 139, 168, 156, 66, 50, 2, 81, 38, 153, 8, 137, 68, 184, 25, 67, 145, 139, 52, 128, 35, 185, 81, 34, 18, 97, 21, 10, 19, 139, 50, 169, 186, 112, 132, 9, 85, 37, 36, 18, 1, 33, 248, 172, 169, 187, 56, 34, 116, 52, 35, 19, 128, 186, 205, 203, 186, 156, 16, 33, 53, 34, 20, 168, 218, 189, 138, 136, 115, 69, 66, 34, 17, 152, 187, 173, 170, 137, 33, 83, 52, 35, 19, 2, 160, 172, 186, 189, 138, 144, 16, 136, 152, 189, 219, 189, 186, 173, 152, 153, 49, 160, 138, 253, 189, 187, 173, 155, 153, 16, 17, 2, 1, 185, 189, 251, 187, 170, 155, 136, 154, 16, 136, 152, 154, 152, 11, 83, 33, 100, 67, 35, 17, 18, 201, 173, 137, 25, 85, 52, 69, 51, 36, 34, 17, 1, 153, 152, 219, 138, 128, 9, 69, 51, 68, 19, 50, 1, 16, 144, 170, 154, 185, 173, 154, 204, 137, 168, 58, 36, 98, 54, 66, 36, 17, 17, 144, 186, 220, 188, 172, 187, 138, 66, 69, 51, 52, 18, 1, 153, 234, 171, 188, 172, 153, 137, 32, 34, 50, 51, 51, 19, 65, 87, 18, 50, 35, 17, 2, 154, 168, 206, 9, 8, 115, 68, 83, 67, 17, 18, 2, 169, 155, 186, 187, 137, 96, 54, 33, 51, 19, 49, 3, 24, 51, 67, 18, 152, 8, 250, 191, 186, 204, 10, 49, 50, 116, 52, 19, 1, 0, 160, 188, 187, 204, 186, 138, 25, 82, 51, 54, 51, 51, 19, 19, 184, 138, 251, 174, 153, 170, 8, 0, 51, 66, 55, 17, 51, 99, 4, 136, 0, 186, 171, 153, 18, 9, 69, 2, 169, 25, 38, 24, 70, 34, 17, 186, 204, 205, 187, 172, 136, 154, 128, 186, 155, 67, 218, 140, 8, 236, 187, 202, 155, 186, 189, 170, 188, 138, 1, 152, 18, 50, 20, 8, 36, 201, 204, 204, 203, 171, 8, 129, 33, 52, 71, 2, 32, 18, 32, 200, 171, 186, 188, 155, 86, 0, 14, 0, 152, 11, 36, 16, 67, 52, 33, 115, 51, 3, 128, 186, 88, 209, 156, 152, 202, 219, 171, 137, 51, 128, 185, 137, 251, 158, 186, 156, 169, 170, 187, 66, 192, 189, 186, 251, 205, 170, 137, 169, 152, 0, 50, 160, 10, 176, 158, 1, 0, 202, 96, 146, 154, 187, 32, 252, 175, 25, 1, 48, 54, 51, 33, 52, 201, 171, 187, 205, 157, 16, 8, 17, 168, 187, 221, 187, 8, 100, 68, 34, 51, 19, 16, 145, 154, 40, 146, 140, 115, 84, 67, 51, 67, 83, 34, 33, 33, 67, 18, 34, 34, 52, 18, 49, 70, 51, 34, 84, 51, 51, 17, 19, 170, 218, 172, 202, 172, 137, 8, 153, 138, 128, 203, 206, 203, 202, 188, 203, 203, 203, 170, 203, 171, 186, 186, 203, 187, 204, 203, 203, 204, 186, 188, 187, 172, 187, 186, 187, 155, 186, 205, 186, 219, 203, 203, 187, 202, 170, 171, 186, 170, 154, 187, 155, 170, 172, 220, 172, 186, 190, 154, 136, 9, 67, 35, 66, 53, 34, 50, 67, 33, 83, 34, 84, 21, 0, 66, 51, 36, 83, 52, 66, 67, 67, 18, 67, 2, 33, 50, 82, 67, 51, 68, 51, 36, 50, 36, 35, 35, 67, 34, 36, 35, 51, 51, 84, 35, 68, 51, 51, 83, 18, 17, 0, 169, 185, 203, 172, 9, 17, 99, 53, 51, 1, 144, 169, 236, 187, 203, 190, 153, 186, 156, 136, 169, 155, 16, 8, 68, 216, 172, 203, 220, 172, 203, 170, 169, 138, 16, 48, 50, 67, 36, 0, 169, 186, 237, 172, 153, 138, 33, 52, 52, 70, 35, 66, 34, 49, 144, 137, 152, 0, 139, 98, 68, 51, 53, 51, 99, 17, 17, 154, 50, 217, 155, 153, 169, 25, 17, 68, 2, 24, 99, 145, 173, 201, 171, 251, 187, 187, 172, 187, 33, 169, 115, 128, 136, 154, 217, 188, 205, 154, 153, 170, 172, 8, 8, 0, 154, 83, 144, 32, 4, 235, 154, 187, 172, 48, 21, 33, 52, 52, 2, 84, 51, 52, 34, 51, 201, 40, 33, 65, 82, 68, 67, 67, 36, 50, 52, 17, 50, 18, 152, 9, 161, 58, 6, 40, 102, 51, 18, 19, 169, 9, 32, 176, 175, 8, 250, 174, 136, 169, 171, 8, 169, 32, 147, 173, 136, 238, 171, 187, 172, 186, 219, 156, 168, 155, 129, 155, 185, 191, 171, 236, 171, 153, 235, 137, 168, 170, 136, 203, 187, 190, 187, 219, 188, 154, 185, 172, 153, 136, 186, 154, 186, 26, 18, 32, 84, 69, 52, 19, 65, 162, 140, 50, 145, 115, 55, 49, 36, 51, 36, 50, 34, 50, 35, 51, 64, 39, 32, 54, 49, 53, 50, 52, 49, 34, 50, 131, 169, 171, 136, 144, 153, 113, 36, 128, 85, 130, 25, 130, 172, 220, 156, 201, 173, 153, 171, 169, 153, 186, 171, 220, 154, 186, 205, 188, 202, 204, 170, 202, 170, 170, 186, 172, 152, 169, 187, 203, 189, 188, 203, 219, 170, 184, 189, 153, 169, 153, 154, 185, 126, 246, 15, 0, 157, 8, 169, 172, 154, 169, 176, 190, 136, 205, 137, 144, 65, 67, 53, 34, 69, 34, 17, 48, 36, 1, 48, 54, 67, 68, 51, 52, 19, 66, 53, 18, 82, 51, 49, 51, 52, 35, 69, 2, 67, 35, 66, 52, 34, 51, 99, 18, 18, 33, 17, 34, 52, 51, 68, 69, 2, 32, 129, 33, 152, 8, 187, 8, 72, 132, 59, 23, 156, 2, 191, 25, 8, 19, 188, 80, 161, 187, 8, 144, 0, 251, 12, 176, 140, 146, 140, 3, 204, 169, 189, 203, 170, 201, 155, 18, 153, 145, 156, 35, 137, 18, 140, 54, 40, 87, 8, 51, 136, 67, 65, 3, 80, 21, 50, 22, 0, 17, 17, 16, 50, 169, 41, 4, 187, 32, 33, 119, 1, 33, 19, 251, 155, 234, 171, 204, 10, 160, 155, 154, 169, 204, 153, 235, 154, 201, 156, 153, 186, 188, 172, 203, 188, 157, 137, 153, 8, 136, 16, 185, 205, 172, 186, 205, 138, 137, 8, 66, 146, 81, 131, 154, 200, 139, 19, 56, 119, 17, 18, 17, 0, 0, 145, 40, 52, 70, 52, 67, 51, 51, 3, 24, 128, 10, 36, 32, 87, 33, 51, 36, 18, 66, 18, 66, 4, 48, 53, 33, 34, 1, 48, 4, 32, 19, 115, 19, 81, 129, 32, 184, 155, 185, 189, 26, 161, 155, 19, 160, 188, 205, 221, 171, 185, 156, 17, 234, 25, 184, 154, 201, 188, 202, 202, 154, 234, 138, 216, 156, 201, 10, 218, 27, 176, 140, 160, 175, 152, 186, 170, 152, 156, 4, 191, 0, 239, 153, 154, 65, 103, 83, 68, 131, 202, 203, 189, 154, 24, 33, 52, 130, 144, 185, 172, 137, 24, 18, 16, 38, 168, 169, 205, 138, 33, 100, 35, 1, 153, 203, 137, 16, 17, 234, 204, 172, 25, 67, 68, 35, 128, 128, 169, 8, 128, 33, 129, 171, 219, 188, 184, 172, 136, 138, 34, 57, 119, 50, 35, 129, 251, 172, 172, 9, 67, 53, 51, 0, 186, 207, 155, 16, 50, 35, 129, 186, 188, 11, 82, 19, 152, 153, 171, 113, 70, 51, 130, 185, 172, 137, 25, 66, 144, 186, 9, 82, 52, 128, 234, 189, 10, 50, 52, 18, 0, 0, 152, 33, 209, 190, 171, 154, 72, 69, 34, 129, 220, 188, 41, 67, 67, 3, 168, 219, 156, 40, 67, 33, 130, 250, 172, 139, 24, 67, 50, 129, 169, 203, 154, 8, 49, 69, 35, 145, 235, 188, 155, 40, 71, 35, 152, 219, 171, 9, 33, 38, 130, 201, 189, 9, 32, 83, 18, 184, 171, 154, 136, 8, 233, 189, 154, 41, 54, 52, 67, 129, 170, 138, 50, 52, 162, 223, 203, 171, 8, 66, 51, 17, 160, 189, 138, 17, 35, 130, 202, 187, 154, 64, 102, 36, 1, 0, 16, 34, 49, 20, 235, 203, 187, 171, 24, 51, 18, 1, 171, 119, 35, 1, 185, 206, 203, 139, 33, 35, 34, 128, 8, 114, 52, 18, 161, 206, 171, 170, 9, 51, 0, 128, 187, 170, 32, 130, 112, 54, 5, 254, 45, 0, 67, 18, 128, 234, 187, 170, 25, 19, 32, 37, 1, 65, 85, 51, 3, 144, 235, 171, 138, 8, 51, 51, 18, 235, 206, 171, 136, 48, 39, 17, 1, 185, 188, 204, 138, 24, 32, 19, 0, 144, 139, 52, 216, 205, 203, 186, 170, 26, 69, 83, 35, 136, 144, 221, 10, 2, 33, 53, 2, 24, 50, 34, 36, 168, 80, 20, 64, 70, 18, 17, 1, 217, 154, 8, 8, 2, 152, 25, 35, 50, 19, 255, 188, 170, 154, 136, 138, 160, 187, 9, 252, 155, 160, 175, 153, 171, 153, 8, 128, 186, 189, 172, 153, 25, 51, 18, 218, 72, 163, 175, 152, 137, 161, 175, 32, 136, 100, 66, 51, 17, 0, 154, 33, 1, 83, 130, 186, 10, 249, 157, 48, 99, 19, 136, 1, 202, 81, 19, 129, 186, 144, 255, 8, 152, 25, 160, 154, 185, 25, 19, 115, 20, 137, 0, 220, 138, 136, 8, 152, 83, 51, 52, 52, 4, 153, 144, 48, 131, 41, 54, 51, 18, 9, 177, 191, 117, 2, 32, 20, 144, 32, 2, 153, 16, 249, 157, 8, 169, 56, 37, 17, 18, 201, 189, 186, 189, 186, 174, 25, 145, 41, 39, 160, 32, 147, 140, 33, 185, 88, 129, 57, 224, 175, 136, 136, 136, 33, 1, 40, 52, 67, 19, 186, 40, 249, 158, 0, 152, 48, 35, 1, 49, 177, 140, 160, 14, 100, 35, 33, 18, 218, 187, 26, 35, 1, 128, 168, 9, 119, 20, 137, 136, 170, 187, 139, 69, 129, 114, 37, 34, 129, 136, 136, 188, 72, 130, 113, 162, 175, 0, 136, 48, 36, 130, 154, 185, 174, 56, 1, 48, 184, 155, 237, 138, 168, 72, 35, 144, 72, 38, 185, 154, 202, 170, 26, 19, 190, 17, 218, 40, 160, 138, 176, 158, 129, 42, 71, 0, 34, 184, 171, 204, 187, 16, 233, 25, 34, 51, 52, 38, 152, 35, 251, 72, 145, 11, 18, 152, 189, 152, 235, 218, 188, 16, 152, 56, 37, 1, 152, 185, 207, 169, 187, 8, 24, 84, 19, 33, 37, 200, 10, 66, 34, 98, 3, 154, 2, 220, 16, 161, 26, 52, 33, 69, 19, 32, 160, 136, 238, 10, 184, 57, 130, 113, 145, 25, 162, 172, 152, 171, 136, 139, 69, 200, 8, 176, 156, 170, 24, 146, 139, 51, 50, 150, 223, 0, 201, 58, 131, 104, 37, 0, 16, 136, 33, 169, 113, 146, 25, 130, 25, 210, 142, 184, 158, 128, 154, 33, 145, 56, 4, 40, 195, 191, 202, 171, 201, 10, 131, 174, 33, 184, 58, 3, 27, 4, 221, 9, 153, 25, 129, 218, 189, 153, 154, 99, 83, 84, 34, 0, 34, 129, 136, 152, 0, 137, 49, 67, 52, 69, 52, 18, 49, 22, 41, 21, 186, 33, 233, 9, 169, 172, 154, 34, 218, 81, 130, 24, 176, 140, 216, 156, 169, 154, 168, 42, 19, 16, 144, 104, 147, 11, 38, 24, 0, 8, 200, 26, 208, 158, 50, 68, 52, 99, 67, 18, 128, 32, 160, 41, 35, 168, 215, 10, 30, 0, 187, 16, 160, 115, 162, 80, 162, 11, 250, 174, 185, 155, 185, 159, 160, 188, 136, 137, 0, 17, 33, 33, 50, 136, 67, 255, 41, 145, 11, 55, 16, 34, 129, 17, 201, 73, 20, 0, 50, 50, 50, 17, 177, 255, 136, 171, 49, 130, 81, 21, 201, 25, 201, 156, 17, 137, 83, 34, 51, 2, 168, 207, 10, 216, 11, 20, 137, 52, 0, 2, 191, 136, 220, 137, 128, 65, 2, 50, 2, 16, 250, 157, 153, 155, 25, 67, 34, 52, 145, 170, 218, 187, 26, 69, 34, 68, 4, 137, 184, 173, 169, 173, 33, 1, 0, 32, 55, 129, 137, 144, 221, 154, 170, 9, 168, 136, 152, 236, 171, 24, 1, 48, 39, 129, 16, 218, 26, 130, 172, 136, 152, 170, 10, 3, 58, 87, 9, 68, 18, 128, 48, 240, 159, 153, 155, 32, 1, 50, 82, 36, 136, 33, 161, 155, 67, 1, 33, 152, 203, 43, 194, 159, 35, 203, 115, 2, 65, 35, 152, 170, 237, 172, 153, 9, 128, 82, 18, 33, 160, 40, 250, 140, 2, 170, 40, 152, 171, 128, 32, 55, 32, 54, 34, 67, 17, 34, 34, 67, 216, 204, 170, 172, 8, 48, 53, 33, 70, 2, 33, 2, 156, 51, 250, 156, 185, 188, 138, 128, 32, 37, 34, 34, 1, 187, 172, 155, 144, 205, 137, 201, 173, 9, 129, 88, 54, 19, 35, 145, 64, 37, 144, 32, 2, 152, 171, 115, 146, 26, 52, 50, 85, 1, 40, 1, 137, 201, 218, 206, 155, 186, 26, 5, 137, 52, 1, 144, 170, 35, 251, 170, 154, 161, 140, 53, 185, 170, 190, 10, 136, 40, 83, 69, 34, 35, 17, 128, 32, 3, 235, 187, 204, 203, 154, 32, 35, 82, 52, 85, 130, 24, 18, 128, 219, 171, 202, 187, 204, 171, 186, 139, 40, 87, 18, 32, 2, 168, 220, 203, 203, 170, 186, 56, 131, 26, 103, 17, 34, 17, 34, 136, 1, 186, 153, 155, 0, 190, 137, 223, 8, 130, 49, 54, 34, 51, 1, 168, 206, 235, 172, 152, 154, 17, 34, 53, 51, 52, 2, 0, 186, 185, 207, 9, 170, 0, 153, 65, 145, 137, 48, 69, 145, 80, 37, 0, 144, 171, 250, 173, 169, 138, 0, 40, 69, 50, 35, 153, 34, 217, 154, 16, 18, 17, 114, 38, 128, 136, 137, 145, 171, 1, 154, 54, 221, 41, 216, 138, 168, 8, 128, 64, 51, 84, 130, 10, 176, 156, 169, 74, 22, 136, 33, 34, 130, 96, 5, 10, 2, 175, 17, 185, 9, 25, 145, 141, 20, 171, 34, 204, 82, 1, 9, 137, 129, 137, 144, 56, 5, 234, 174, 9, 186, 11, 34, 35, 248, 139, 176, 174, 8, 50, 131, 10, 38, 128, 128, 138, 160, 191, 137, 188, 16, 115, 53, 24, 18, 24, 53, 154, 50, 250, 138, 153, 83, 0, 83, 144, 16, 136, 83, 1, 18, 1, 49, 217, 171, 137, 67, 234, 56, 162, 27, 248, 141, 218, 156, 185, 9, 184, 12, 176, 11, 162, 187, 252, 26, 0, 59, 134, 171, 185, 26, 160, 188, 97, 5, 136, 160, 139, 145, 114, 71, 52, 19, 17, 34, 200, 171, 153, 155, 8, 136, 49, 103, 1, 0, 152, 170, 171, 48, 68, 19, 136, 168, 185, 255, 187, 170, 170, 137, 66, 55, 51, 1, 153, 201, 205, 139, 137, 153, 137, 49, 130, 170, 203, 219, 171, 48, 54, 128, 153, 24, 129, 187, 187, 175, 171, 9, 83, 84, 36, 33, 35, 203, 170, 171, 49, 98, 54, 1, 8, 155, 82, 128, 82, 19, 65, 2, 186, 237, 154, 170, 9, 19, 128, 1, 9, 193, 158, 169, 27, 6, 186, 56, 19, 2, 155, 66, 254, 173, 169, 8, 137, 82, 19, 99, 51, 33, 130, 137, 137, 8, 169, 9, 2, 8, 51, 252, 154, 235, 139, 84, 52, 52, 51, 20, 185, 173, 202, 172, 170, 169, 153, 40, 54, 34, 34, 18, 32, 37, 144, 153, 9, 2, 172, 64, 249, 188, 219, 137, 170, 88, 54, 67, 35, 33, 36, 0, 128, 10, 51, 186, 98, 200, 10, 153, 82, 34, 51, 145, 170, 172, 16, 48, 22, 221, 154, 204, 188, 155, 1, 0, 152, 168, 185, 253, 173, 152, 169, 16, 32, 69, 152, 41, 1, 48, 161, 203, 236, 154, 128, 136, 153, 40, 35, 49, 54, 19, 34, 99, 2, 0, 51, 83, 145, 173, 203, 41, 22, 33, 36, 16, 38, 16, 34, 137, 65, 34, 85, 161, 156, 184, 158, 0, 137, 32, 33, 52, 50, 162, 206, 219, 188, 186, 188, 154, 32, 36, 49, 52, 67, 20, 0, 0, 203, 203, 173, 137, 168, 32, 50, 85, 18, 0, 128, 155, 8, 234, 188, 186, 188, 219, 187, 137, 170, 99, 35, 38, 34, 52, 17, 67, 129, 137, 201, 187, 221, 170, 186, 138, 2, 65, 54, 51, 54, 35, 34, 144, 168, 205, 187, 188, 186, 154, 0, 98, 19, 16, 0, 136, 185, 156, 33, 0, 115, 160, 26, 224, 187, 186, 56, 18, 119, 18, 67, 20, 136, 128, 186, 187, 155, 144, 171, 0, 136, 1, 203, 144, 221, 203, 153, 220, 138, 234, 188, 202, 203, 169, 40, 84, 35, 51, 52, 20, 137, 154, 220, 171, 136, 34, 51, 83, 53, 2, 66, 2, 0, 168, 188, 204, 154, 168, 9, 1, 186, 64, 35, 98, 69, 51, 67, 51, 51, 160, 187, 206, 171, 171, 154, 219, 155, 186, 8, 34, 51, 2, 48, 69, 52, 130, 236, 203, 205, 170, 169, 16, 146, 73, 39, 33, 34, 2, 129, 235, 202, 203, 154, 170, 10, 51, 67, 66, 51, 2, 152, 8, 0, 115, 39, 16, 35, 16, 67, 184, 9, 186, 32, 85, 54, 2, 16, 128, 203, 185, 174, 9, 202, 138, 152, 25, 18, 144, 65, 160, 173, 154, 169, 175, 16, 129, 155, 64, 37, 128, 33, 130, 221, 188, 203, 137, 200, 156, 185, 156, 8, 33, 0, 115, 3, 0, 129, 170, 186, 189, 201, 206, 25, 20, 0, 115, 67, 66, 67, 34, 35, 18, 16, 169, 205, 14, 2, 26, 0, 188, 187, 188, 153, 170, 137, 153, 65, 161, 104, 4, 8, 129, 203, 204, 171, 170, 9, 50, 33, 1, 84, 53, 53, 51, 17, 16, 153, 153, 186, 138, 251, 154, 235, 155, 153, 138, 0, 25, 70, 52, 35, 0, 0, 218, 186, 186, 9, 201, 26, 101, 68, 67, 35, 17, 19, 152, 170, 189, 188, 170, 138, 200, 188, 203, 154, 8, 116, 35, 128, 129, 187, 204, 188, 153, 169, 153, 187, 154, 137, 114, 37, 35, 34, 52, 129, 169, 188, 251, 188, 153, 8, 152, 9, 99, 52, 35, 82, 20, 16, 34, 34, 2, 50, 35, 34, 1, 17, 16, 51, 17, 113, 84, 2, 137, 145, 207, 154, 185, 204, 203, 203, 186, 170, 170, 137, 168, 172, 65, 20, 16, 51, 21, 153, 72, 51, 160, 170, 48, 70, 34, 33, 34, 33, 68, 53, 0, 32, 200, 157, 32, 83, 51, 21, 128, 9, 0, 0, 67, 19, 16, 68, 35, 53, 53, 1, 0, 202, 189, 204, 154, 171, 138, 218, 10, 176, 172, 187, 172, 204, 155, 201, 171, 137, 152, 137, 16, 190, 10, 144, 48, 20, 115, 21, 0, 128, 170, 170, 40, 17, 85, 19, 49, 38, 18, 35, 128, 16, 177, 11, 52, 17, 202, 154, 153, 171, 49, 4, 65, 36, 128, 17, 187, 153, 203, 186, 175, 138, 169, 32, 51, 50, 33, 17, 217, 138, 152, 156, 153, 169, 155, 17, 153, 16, 50, 20, 152, 67, 129, 9, 17, 176, 155, 9, 33, 1, 32, 17, 17, 19, 145, 16, 144, 9, 17, 144, 171, 17, 17, 0, 153, 17, 17, 0, 16, 17, 17, 10, 1, 144, 9, 144, 153, 16, 16, 17, 153, 9, 0, 153, 9, 0, 16, 145, 10, 17, 144, 144, 0, 0, 1, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 16, 144, 0, 0, 1, 153, 17, 144, 0, 9, 1, 9, 16, 144, 0, 0, 0, 1, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
-static const size_t audio_one_hundred_sample_data_length = sizeof(audio_one_hundred_sample_data) / sizeof(audio_one_hundred_sample_data[0]);
+static const size_t audio_one_hundred_sample_data_length = 35231;
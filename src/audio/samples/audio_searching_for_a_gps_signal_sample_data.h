@@ -1,4 +1,4 @@
-// This file was generated by a script on 20-11-2024 09:45:25
+// This file was generated by a script on 17-10-2026 14:18:58
 
 #pragma once
 
@@ -6,6 +6,7 @@
 #include <stdint.h>
 #include <pico/platform/sections.h>
 
-static const int16_t __in_flash("audio_searching_for_a_gps_signal_sample_data") audio_searching_for_a_gps_signal_sample_data[] = { -290, -116, -11, -377, -707, -383, 332, 731, 553, 100, -147, 72, 462, 463, 78, -74, 244, 495, 231, -262, -469, -304, -17, 240, 444, 516, 371, 82, -238, -587, -873, -805, -361, 44, 189, 268, 254, -71, -315, 104, 711, 580, 21, 46, 500, 400, -249, -576, -351, -109, -155, -337, -443, -280, 224, 749, 793, 298, -281, -565, -580, -399, 86, 735, 945, 399, -344, -565, -316, -46, 179, 474, 665, 566, 295, -18, -339, -512, -445, -377, -490, -512, -167, 333, 600, 518, 133, -473, -1026, -1128, -641, 201, 1008, 1419, 1282, 760, 135, -506, -1117, -1376, -912, 131, 1131, 1608, 1546, 1066, 181, -913, -1651, -1573, -850, -10, 650, 1080, 1175, 872, 355, -136, -563, -909, -959, -583, -76, 224, 511, 1091, 1490, 835, -691, -1741, -1452, -365, 548, 926, 866, 532, 155, -89, -271, -484, -642, -635, -411, 82, 663, 779, 119, -764, -985, -340, 554, 997, 779, 182, -350, -594, -646, -650, -518, -85, 492, 754, 500, 43, -293, -609, -991, -1069, -561, 173, 677, 976, 1132, 824, -59, -1034, -1606, -1684, -1216, -169, 1051, 1767, 1702, 1063, 186, -601, -1079, -1242, -1041, -275, 800, 1291, 795, 67, -115, -24, -239, -628, -727, -428, 129, 735, 983, 558, -220, -650, -479, -71, 257, 552, 763, 522, -221, -781, -512, 244, 584, 236, -242, -328, -122, -84, -422, -779, -691, -302, -98, 63, 715, 1456, 1118, -342, -1391, -909, 393, 1109, 796, -1, -671, -883, -496, 226, 601, 300, -121, -85, 108, -12, -110, 247, 594, 321, -236, -382, -73, 317, 552, 528, 330, 269, 333, 70, -506, -658, -112, 431, 422, 147, -56, -327, -661, -582, 169, 1106, 1442, 856, -238, -1053, -1058, -421, 154, 124, -288, -321, 365, 1185, 1255, 378, -780, -1330, -981, -342, -159, -217, 326, 1372, 1728, 941, 51, -106, -104, -719, -1554, -1577, -429, 1192, 2083, 1543, 120, -953, -1119, -764, -303, 148, 375, 203, -47, -6, 107, -73, -334, -244, 105, 241, -39, -478, -632, -270, 350, 648, 345, -205, -419, -71, 560, 925, 659, 14, -339, -163, 43, -138, -365, -78, 628, 1100, 832, -61, -930, -1137, -719, -279, -123, -8, 181, 198, 60, 154, 496, 549, 21, -697, -1041, -796, -112, 623, 897, 485, -133, -210, 248, 431, -36, -517, -454, -198, -131, 130, 860, 1361, 850, -310, -989, -727, -174, -119, -509, -645, -125, 693, 1093, 772, 211, -3, -166, -941, -1809, -1443, 64, 1074, 877, 412, 189, -361, -1159, -1208, -479, -143, -464, -226, 1074, 2027, 1352, -164, -1099, -1433, -1598, -959, 671, 1623, 630, -954, -1224, -398, 204, 217, -43, -442, -747, -621, -206, 129, 366, 532, 421, 112, 30, 163, -2, -628, -1249, -1247, -241, 1432, 2414, 1490, -675, -2133, -1956, -760, 588, 1392, 1072, 132, -6, 796, 1010, 83, -659, -429, -24, -4, 56, 301, 395, 388, 435, 317, 152, 479, 1019, 707, -577, -1598, -1362, -198, 777, 658, -444, -1267, -754, 413, 673, -143, -690, -195, 582, 655, 61, -368, -56, 546, 378, -738, -1523, -918, 369, 1015, 921, 817, 835, 586, -25, -757, -1171, -732, 408, 984, 115, -1167, -1129, 296, 1501, 1294, 93, -912, -1172, -1158, -1409, -1416, -126, 2226, 3678, 2636, -101, -2154, -2127, -799, 139, 27, -335, -3, 843, 1313, 1121, 733, 321, -502, -1601, -1898, -745, 876, 1360, 476, -411, -280, 198, -170, -1094, -1042, 384, 1556, 1013, -470, -1061, -329, 597, 824, 516, 217, 142, 120, -54, -238, -96, 166, -190, -1257, -1904, -1094, 635, 1716, 1361, 316, -178, 158, 457, -65, -977, -1119, -183, 800, 759, -80, -531, 94, 1165, 1431, 396, -1162, -2043, -1778, -777, 391, 1373, 1747, 1070, -369, -1298, -706, 745, 1398, 642, -572, -1292, -1498, -1278, -316, 1196, 2045, 1188, -870, -2405, -2106, -273, 1494, 1698, 258, -1388, -1730, -821, -59, -167, -215, 789, 2173, 2329, 754, -1373, -2442, -1922, -696, 28, 126, 486, 1449, 1996, 1023, -1024, -2512, -2476, -1397, -164, 834, 1338, 1003, 172, -169, 169, 209, -614, -1576, -1799, -1252, -297, 735, 1407, 1358, 725, -31, -524, -526, -140, 116, -66, -230, 196, 891, 994, 385, -208, -524, -1114, -1872, -1433, 787, 3042, 3221, 1516, -374, -1699, -2597, -2574, -957, 1483, 2897, 2312, 583, -669, -847, -853, -1402, -1467, 193, 2437, 2772, 852, -1184, -1687, -773, 772, 1873, 1279, -724, -1829, -632, 1180, 1152, -605, -1811, -1028, 758, 1407, 139, -1383, -1000, 1087, 2475, 1621, -415, -1586, -1140, 36, 730, 680, 642, 1010, 855, -727, -2609, -2485, -21, 2302, 2292, 768, 32, 496, 586, -421, -1508, -1816, -1405, -247, 1430, 2200, 1075, -545, -734, 126, 348, -334, -868, -639, 157, 1015, 1302, 724, -263, -1146, -2017, -2781, -2356, 56, 3122, 4153, 2188, -751, -2163, -1852, -1301, -1200, -932, -1, 1215, 2008, 1964, 1286, 644, 310, -293, -1593, -2803, -2659, -919, 1353, 2687, 2321, 941, 75, 195, 171, -678, -1278, -660, 257, 197, -290, 250, 1781, 2650, 1685, -545, -2486, -3031, -2205, -803, 410, 1234, 1931, 2650, 2955, 2058, -109, -2273, -3047, -2593, -1957, -1108, 584, 2321, 2635, 1939, 1709, 1500, -321, -3097, -4021, -2015, 834, 2099, 1577, 684, 402, 418, -83, -1191, -1949, -1291, 606, 2150, 1940, 495, -332, 308, 1266, 1017, -499, -2034, -2449, -1610, -173, 1079, 1753, 1900, 1659, 950, -320, -1732, -2404, -1825, -535, 393, 585, 669, 1206, 1745, 1442, 241, -1108, -1890, -1756, -782, 358, 907, 945, 1001, 821, -133, -1180, -1099, -279, -355, -1481, -1764, -28, 2286, 2948, 1744, 357, -106, -220, -862, -1796, -2001, -819, 1341, 3100, 3067, 1153, -1189, -2347, -1974, -932, -111, 399, 1013, 1689, 1631, 255, -1733, -2771, -1983, 27, 1827, 2230, 1007, -846, -1637, -436, 1704, 2518, 860, -2011, -3728, -3075, -708, 1836, 3193, 2593, 274, -2205, -2930, -1517, 414, 1201, 942, 721, 727, 325, -486, -959, -908, -1009, -1465, -1339, 189, 2377, 3401, 2199, -542, -3113, -4116, -3235, -1179, 943, 2382, 3000, 2907, 2118, 667, -1167, -2827, -3581, -2771, -410, 2364, 3771, 2708, -144, -2643, -3021, -1564, 94, 1131, 1812, 1882, 685, -1143, -2348, -3127, -3972, -3243, 798, 6069, 8101, 5128, -564, -5501, -7305, -5405, -1266, 2660, 4706, 4326, 1832, -1000, -1786, -539, -47, -1813, -3700, -3043, -113, 2786, 4069, 3668, 2286, 593, -1211, -3056, -4219, -3682, -1537, 852, 2332, 2844, 2762, 2094, 593, -1590, -3474, -3645, -1635, 1106, 2269, 1116, -552, -619, 575, 999, 127, -685, -900, -1166, -1199, -387, 110, -619, -483, 2297, 4851, 3221, -1357, -4072, -3080, -706, 763, 1288, 1506, 1262, 128, -1506, -2365, -1454, 720, 2464, 2465, 867, -1064, -2053, -1716, -733, 5, 442, 1105, 1889, 2036, 1377, 432, -658, -1977, -2848, -2445, -915, 1188, 3335, 4030, 1650, -2508, -4619, -2982, 165, 2156, 2553, 1918, 503, -1257, -2649, -3123, -2082, 737, 3938, 4874, 2502, -1145, -3066, -2253, -271, 644, -197, -1461, -1424, 127, 1882, 2517, 1691, -110, -1944, -2653, -1567, 671, 2357, 2208, 537, -1181, -1741, -1024, 270, 1283, 1483, 931, 86, -716, -1356, -1510, -688, 1033, 2694, 3024, 1319, -1757, -4079, -3550, -378, 2733, 3291, 1421, -838, -1960, -1880, -1095, 79, 1248, 1783, 1432, 598, -350, -1510, -2761, -3212, -1983, 520, 2659, 3035, 1789, 284, -431, -584, -1014, -1828, -2149, -1297, 183, 1137, 1258, 1242, 1449, 1341, 496, -685, -1571, -1766, -956, 760, 2377, 2721, 1771, 478, -469, -1026, -1220, -982, -391, 432, 1503, 2561, 2692, 1075, -1671, -3447, -2611, 50, 2000, 1751, 296, -636, -733, -629, -367, 370, 1191, 1300, 403, -1213, -2736, -2919, -1318, 739, 1705, 1804, 2097, 2391, 1721, 163, -1262, -1937, -1959, -1619, -1112, -322, 1087, 2821, 3559, 2123, -1118, -4417, -5928, -4824, -1729, 1676, 3822, 4316, 3736, 2445, 214, -2550, -4159, -3499, -1694, -363, 728, 2335, 3494, 2949, 1287, -446, -2376, -4083, -3668, -625, 2456, 3111, 1999, 872, -478, -2739, -4138, -2301, 1447, 3190, 1950, 546, 568, 349, -1116, -1993, -1034, -131, -1104, -2265, -964, 2097, 4053, 3998, 2772, 316, -3069, -4688, -2789, -85, 5, -1350, -661, 2219, 4209, 3547, 1437, -328, -1490, -2691, -3560, -2502, 953, 4455, 4972, 2360, -614, -1739, -1417, -1070, -888, -111, 1293, 2427, 2594, 1602, -448, -2518, -2683, -458, 1861, 1910, 260, -977, -1276, -1324, -701, 1441, 3689, 3139, -422, -3532, -3462, -1400, 254, 1305, 2430, 2802, 1409, -929, -2580, -2843, -1977, -731, 104, 663, 1870, 3547, 4012, 2282, -707, -3519, -5266, -5071, -2417, 1306, 3349, 2784, 1723, 1960, 1968, -452, -3875, -4711, -2243, 914, 2812, 3514, 3038, 1055, -1504, -2901, -2717, -2037, -1659, -1093, 569, 3004, 4228, 2649, -542, -2370, -1710, -469, -652, -1788, -2002, -485, 1848, 3374, 2943, 646, -2146, -3646, -2855, -314, 2124, 2660, 1160, -877, -2109, -2283, -1330, 1008, 3842, 4822, 2608, -1035, -3041, -2598, -1446, -892, -451, 204, 143, -923, -1518, -511, 1126, 1997, 2276, 2588, 2089, -327, -3413, -4209, -1648, 2078, 4136, 3587, 1068, -2212, -4447, -3874, -733, 2453, 3588, 3165, 2712, 2018, -335, -3940, -6035, -4673, -982, 2510, 4536, 5217, 4568, 2139, -1796, -5444, -6696, -5240, -2553, 323, 3296, 5287, 4623, 2165, 722, 428, -1391, -4751, -5864, -2912, 1178, 3275, 3674, 3730, 2900, 24, -4045, -6594, -5576, -1552, 2792, 4939, 4236, 1784, -452, -779, 457, 533, -2235, -5266, -4663, -704, 2849, 4024, 3721, 2832, 1570, 230, -1578, -4097, -5088, -2289, 1892, 3111, 1791, 1589, 2591, 1792, -1015, -3108, -3287, -2556, -1656, -559, 733, 2133, 3184, 2869, 1055, -512, -301, 552, -318, -2747, -3650, -1100, 2985, 5408, 5296, 3603, 850, -2638, -5676, -7046, -6176, -2533, 3422, 8483, 8746, 4135, -1342, -4167, -4252, -3302, -2222, -765, 1167, 2692, 2870, 2246, 2325, 3022, 2068, -1781, -6069, -6839, -3119, 2077, 5123, 5039, 3379, 1809, 488, -1236, -3356, -5103, -5756, -4574, -852, 4297, 7357, 5904, 1762, -1507, -2831, -3131, -2590, -1054, 453, 970, 994, 1026, 334, -1167, -1501, 769, 3492, 2985, -989, -4692, -5120, -2832, 243, 3010, 4447, 3383, 316, -2328, -2772, -1636, -804, -1164, -1623, -412, 2425, 4540, 4099, 2173, 999, 746, -306, -2745, -4805, -4404, -1374, 2565, 5311, 5579, 3206, -904, -4854, -6436, -4709, -905, 2798, 4997, 5041, 2602, -1184, -3497, -2757, -656, 514, 907, 1618, 2074, 1126, -719, -1890, -1541, -119, 1019, 717, -501, -1119, -1039, -1247, -1241, 147, 1812, 1864, 1104, 1169, 981, -938, -2837, -2338, -227, 1354, 1846, 1386, -18, -1420, -1681, -1233, -820, 132, 1686, 2057, 421, -1247, -1227, -688, -1200, -1638, -111, 2241, 2310, -241, -2200, -1441, 392, 987, 506, 219, 187, -171, -618, -359, 849, 2139, 1985, -297, -3486, -5560, -5365, -2527, 2706, 7992, 9127, 4211, -3366, -8069, -7625, -4001, -88, 2702, 4065, 4061, 3302, 2513, 1481, -390, -2304, -2622, -1456, -657, -909, -924, 120, 1388, 1864, 1355, 29, -1645, -2665, -2280, -847, 812, 2395, 3545, 3004, -42, -3837, -5150, -3122, -283, 1052, 1539, 2723, 4012, 3600, 1388, -934, -2422, -3499, -4040, -2888, -63, 2387, 2855, 2128, 1903, 2377, 1997, -696, -4865, -7063, -4464, 1308, 5315, 4876, 2110, 363, 193, 57, -797, -1674, -1989, -2110, -2309, -1695, 764, 4045, 5293, 3124, -440, -2544, -2889, -3087, -3614, -3140, -654, 2909, 5210, 4504, 1398, -1615, -2750, -2476, -2051, -1605, -653, 447, 949, 1210, 2196, 3376, 2820, 54, -2898, -4231, -4113, -2922, -289, 2931, 4401, 3234, 834, -1616, -3894, -4990, -3548, -236, 2517, 3165, 2167, 1099, 1177, 1892, 1397, -757, -2615, -2733, -1977, -1096, 558, 2400, 2109, -430, -1962, -357, 2467, 3436, 1863, -758, -2711, -3061, -1933, -305, 837, 1301, 1624, 2283, 2866, 2127, -630, -4091, -5386, -2731, 2279, 5679, 4953, 1244, -2553, -4563, -4136, -1471, 1607, 2632, 1669, 1224, 2009, 1676, -993, -3644, -3745, -1990, -688, -479, -90, 1579, 4140, 5942, 5054, 593, -5864, -10199, -8411, -736, 7461, 10519, 7951, 3365, -896, -4897, -7789, -7556, -4016, 1211, 6631, 9908, 7699, 144, -7284, -9611, -7192, -2989, 1170, 4279, 5734, 5992, 5065, 1564, -4177, -8198, -7090, -2174, 2650, 5202, 5497, 3979, 1183, -1775, -3774, -4447, -3751, -1495, 1615, 3421, 2592, 536, -880, -1928, -3076, -2933, -821, 1430, 2662, 3851, 4587, 2384, -2726, -7032, -7650, -4618, 1178, 8124, 12453, 10497, 2616, -6775, -12493, -11750, -5894, 757, 4991, 6848, 7097, 5195, 1427, -1797, -2994, -3611, -4965, -5362, -2530, 2572, 6517, 7213, 5242, 1959, -1949, -5669, -7569, -6501, -3185, 787, 4691, 7832, 7988, 3614, -2712, -6494, -6777, -5661, -3169, 2235, 8037, 8432, 2467, -3508, -4229, -2096, -1701, -1998, 310, 3242, 2820, 782, 1005, 1728, -215, -1870, 377, 2795, 298, -4473, -5535, -2517, 681, 2261, 3035, 3323, 2514, 453, -2079, -3763, -3555, -1592, 747, 2051, 2131, 1908, 1982, 1753, 288, -2286, -4637, -5178, -3055, 1167, 5291, 6543, 3925, -487, -3599, -4480, -3992, -2079, 1484, 4240, 3194, -218, -1775, -638, 570, 833, 1176, 1338, 279, -1296, -2032, -1760, -423, 2219, 4515, 3475, -1170, -5700, -6267, -2688, 2056, 4882, 4707, 2468, -51, -1489, -1694, -1543, -1804, -2231, -1947, -322, 2533, 5400, 6120, 3361, -1495, -5292, -6025, -4129, -1330, 887, 2194, 3351, 4555, 4117, 515, -4251, -5712, -2211, 2564, 3503, -331, -4838, -5283, -974, 4304, 6084, 3346, -950, -3347, -3437, -3064, -2692, -802, 2619, 4730, 3395, 47, -2517, -3459, -3563, -3004, -1083, 2180, 5290, 6288, 4336, 421, -3256, -4802, -3983, -2066, -223, 1352, 2575, 2888, 2161, 1005, -302, -1829, -2782, -2112, -441, 591, 843, 1526, 2667, 2771, 1126, -1103, -2277, -1906, -789, 130, 860, 1769, 2048, 359, -2524, -3769, -2117, 522, 1878, 1626, 435, -1078, -2047, -1889, -1058, -30, 1413, 2802, 2618, 534, -1784, -2963, -3092, -2268, -63, 3000, 5244, 5482, 3779, 680, -3108, -6252, -6946, -4199, 712, 4453, 4544, 2200, 554, 281, -529, -2413, -3842, -4400, -4855, -4118, -122, 5910, 9665, 8697, 4536, -240, -4358, -6828, -6401, -3426, -280, 1666, 3546, 5853, 6318, 3187, -1670, -5138, -6087, -4666, -1133, 2914, 4690, 3313, 861, -734, -1822, -2994, -2977, -569, 2539, 3285, 1480, 153, 855, 1068, -1648, -4942, -4501, -541, 2530, 2631, 1961, 2289, 2533, 1597, -75, -2036, -4006, -4802, -3644, -1763, -489, 1088, 4298, 7619, 7677, 3504, -1970, -5294, -5977, -5471, -3786, 441, 6187, 9141, 6516, 778, -3493, -4682, -4019, -2599, -1006, -112, 56, 756, 2221, 2745, 1404, -220, -487, -144, -851, -2401, -2943, -1589, 496, 2022, 3412, 5194, 5351, 1308, -5099, -8431, -6484, -2250, 1686, 5472, 7864, 5927, 306, -4639, -6742, -7134, -6062, -2598, 2178, 5819, 7424, 7375, 5623, 1944, -3310, -8809, -11574, -8545, -796, 6048, 7806, 5952, 4124, 2998, 746, -3317, -7408, -8750, -5811, 181, 5797, 8110, 6780, 3271, -1099, -5532, -8708, -8679, -4554, 1911, 7052, 8102, 5345, 1513, -834, -1319, -1362, -2150, -3331, -3711, -2600, -193, 2698, 4744, 4585, 1973, -1762, -4633, -5131, -2844, 1101, 4191, 4122, 678, -3936, -6386, -4283, 1684, 7560, 9282, 6253, 1056, -3627, -6509, -7009, -5120, -1974, 808, 2539, 3525, 3899, 3245, 1405, -1014, -3128, -4198, -3626, -1396, 1393, 3379, 4422, 5083, 4609, 1266, -4418, -8435, -7176, -1825, 2995, 4672, 4659, 4911, 4670, 2032, -2752, -7101, -8559, -6455, -1680, 3969, 8225, 9222, 6557, 1302, -4679, -8956, -9270, -5575, -459, 3578, 5800, 5845, 3569, 815, -212, -664, -3016, -5660, -4521, 117, 3441, 2949, 1194, 1304, 2808, 2585, -1160, -6019, -7145, -2975, 2273, 3675, 1540, 126, 1837, 4878, 5560, 1648, -5281, -10244, -9193, -3243, 2878, 6005, 6501, 6088, 5344, 2903, -2659, -8956, -10233, -4674, 2126, 4831, 4868, 5056, 3880, 234, -2473, -2154, -1970, -4239, -6007, -4006, 673, 4944, 7022, 6402, 3500, -148, -2968, -4620, -5368, -4844, -2313, 2065, 6760, 9701, 9369, 5318, -1532, -8686, -12912, -12008, -5946, 2972, 10528, 12662, 8811, 2394, -2942, -6189, -7584, -6788, -3691, 718, 4889, 7054, 5926, 2638, 435, 438, -344, -4281, -8381, -7405, -841, 6145, 8685, 6804, 3552, 739, -1833, -4075, -5008, -4717, -4350, -3250, 845, 6845, 9151, 4750, -1850, -4453, -2830, -872, -174, 501, 1556, 1828, 628, -1524, -3469, -3679, -1198, 2610, 4445, 2755, -130, -1473, -2016, -3429, -3989, -1169, 3061, 4254, 1805, -722, -727, 812, 986, -1815, -5190, -4415, 1026, 5487, 4823, 2088, 1729, 2477, 558, -3725, -6636, -5680, -1456, 2996, 4326, 2426, 725, 1172, 1623, -35, -2666, -4161, -3443, -183, 3830, 4710, 1650, -1070, -679, 310, -144, -335, 191, -737, -2442, -1481, 1783, 3214, 1731, 209, -244, -1586, -4126, -5022, -2594, 1053, 3263, 4007, 4143, 3276, 1322, -701, -2911, -5778, -6561, -1927, 5162, 7365, 2838, -2580, -3991, -2673, -1643, -916, 680, 2423, 2822, 1965, 715, -974, -2837, -2872, 144, 3592, 3421, -430, -3734, -3372, -585, 1868, 3189, 3610, 2432, -544, -3336, -3816, -2194, -36, 1481, 1546, 101, -1299, -1162, -311, -305, -562, 433, 2005, 2054, 452, -805, -854, -971, -1756, -1653, 338, 2546, 2954, 1866, 656, -324, -1071, -1042, -414, -572, -1978, -2951, -1826, 756, 2866, 3643, 3329, 1784, -1173, -4105, -4511, -1818, 1569, 3050, 2487, 1135, -576, -2355, -2628, -466, 2145, 2696, 1685, 979, 302, -1451, -2993, -2242, -63, 983, 771, 1053, 1245, -980, -4208, -3362, 2265, 5997, 2641, -3951, -6550, -4015, -668, 890, 2099, 4719, 7376, 6404, 593, -5713, -7106, -4090, -1364, -236, 1534, 3545, 3046, 558, -859, -758, -812, -1303, -1817, -2515, -2263, 792, 5094, 6166, 2537, -2328, -4722, -4242, -2215, 411, 2561, 2987, 2332, 2698, 3451, 981, -4675, -7652, -4471, 683, 3028, 3763, 5184, 5033, 833, -4547, -6142, -3279, 84, 150, -2810, -4708, -1741, 5000, 9519, 6911, -717, -6276, -6042, -3229, -2011, -1719, 444, 4214, 6701, 5786, 1302, -4764, -8364, -6467, -1146, 2138, 1470, 895, 3892, 7385, 5926, -234, -5792, -7572, -6347, -3131, 1308, 4723, 5456, 4563, 2956, -458, -5247, -7754, -5618, -1015, 2492, 3832, 3940, 3603, 2950, 1860, 78, -2396, -4570, -4795, -2595, 228, 1361, 1024, 1928, 5174, 7437, 4452, -3126, -9677, -10363, -5006, 2604, 7230, 6153, 2550, 1728, 3070, 1300, -3705, -6039, -3443, 180, 2101, 2881, 2368, 543, -182, 1020, 1312, -58, 49, 1823, 899, -3632, -6370, -3454, 1937, 4303, 2366, -946, -2543, -1486, 1017, 2399, 944, -1552, -1469, 1064, 1619, -1345, -2937, 894, 6227, 6024, -24, -5411, -5823, -3345, -1127, 1035, 3814, 5583, 5017, 2719, -959, -5473, -7399, -3729, 2184, 3767, 429, -1886, 380, 3919, 3940, 295, -3373, -4500, -3720, -2670, -1403, 1072, 4494, 6894, 6347, 2437, -3390, -7923, -7869, -3236, 2053, 4500, 4304, 2997, 841, -1538, -2373, -1703, -1566, -2009, -877, 1639, 2545, 785, -1246, -1200, 684, 2167, 1046, -2047, -3394, -1060, 1685, 1209, -875, -1026, 366, 875, 777, 1489, 1858, 90, -2433, -2575, 174, 2857, 2423, -1060, -4487, -4634, -1156, 3086, 4674, 2795, -116, -1037, 440, 1942, 1319, -908, -2628, -2864, -2294, -1437, 142, 2615, 5108, 6205, 4531, -273, -6208, -9821, -9199, -4695, 2509, 9682, 11966, 7071, -580, -4759, -4751, -3713, -2666, -729, 1351, 2056, 1535, 872, 791, 1591, 2134, -137, -5335, -8874, -6253, 1176, 7606, 8641, 4429, -1426, -5024, -5273, -4011, -2648, -387, 3239, 6306, 6505, 3606, -938, -5061, -6587, -4762, -1529, 486, 1175, 2429, 4532, 5042, 2072, -2811, -6117, -5850, -2501, 1718, 3739, 2016, -797, -507, 2333, 2605, -1583, -5596, -4815, -578, 2764, 3508, 2694, 1090, -900, -1765, -397, 1484, 1347, -67, 233, 2328, 2737, -65, -2813, -2232, 21, 171, -1774, -2347, 76, 3585, 5668, 4953, 1106, -4122, -6856, -4954, -972, 1252, 1778, 3239, 5173, 4085, -248, -3530, -3686, -3252, -3058, -311, 4416, 5738, 2007, -1763, -1880, -321, 385, 555, 609, -110, -1091, -875, 234, 458, -337, -310, 999, 1353, -742, -3341, -3497, -686, 3373, 6308, 5848, 1652, -3083, -4568, -3131, -2086, -2066, -317, 3506, 4957, 960, -4567, -5184, -442, 4172, 4969, 3433, 1851, -119, -3237, -6143, -6806, -4817, -954, 3897, 7917, 8143, 3509, -2750, -5964, -4843, -2033, -697, -1512, -2131, 400, 5432, 8169, 5396, -294, -4622, -7109, -8974, -8408, -2565, 6694, 12855, 11191, 3632, -3421, -5813, -5204, -5226, -5612, -2870, 3469, 8696, 8468, 4119, 128, -2101, -4436, -6696, -6036, -2345, 998, 2725, 4323, 5028, 2831, -187, -671, -250, -1882, -3355, -1589, 909, 601, -619, 682, 3325, 3923, 1949, -1086, -4401, -6983, -6488, -2134, 2959, 5337, 5703, 6474, 6415, 2296, -4628, -8850, -8090, -5767, -4289, -941, 5798, 10750, 8829, 3303, 168, -1543, -5671, -9669, -8242, -2270, 3463, 6947, 7810, 5148, 540, -2446, -3655, -5414, -6394, -3006, 3324, 6596, 4414, 852, 216, 1705, 1924, -58, -2534, -4125, -4379, -2876, -97, 2265, 3363, 3634, 2729, -11, -2923, -3418, -1927, -1023, -1197, -816, 619, 2003, 2512, 2131, 1251, 510, 0, -948, -2156, -2503, -2203, -2339, -1658, 1935, 6350, 6926, 3253, -891, -3789, -6373, -7609, -4917, 1187, 6920, 9095, 7007, 2119, -2495, -4212, -3540, -3092, -3336, -1611, 3179, 7224, 6113, 972, -3307, -4646, -4401, -3075, -317, 2372, 3397, 3567, 3394, 1071, -3601, -6976, -6128, -2398, 1410, 3992, 4612, 2747, -20, -682, 1071, 1589, -2060, -7459, -8946, -4145, 3382, 8388, 8923, 5935, 479, -5607, -8371, -5585, -602, 2231, 3701, 6131, 7142, 3480, -2385, -5914, -7083, -7689, -6141, -479, 6633, 10443, 9298, 4494, -2453, -9405, -12486, -9130, -1807, 4395, 7498, 8706, 8009, 4317, -790, -4252, -5766, -6596, -5649, -1331, 4050, 5957, 3119, -1268, -3342, -2304, -657, -532, -482, 1614, 3570, 1737, -2210, -3826, -3753, -5160, -5440, 382, 9801, 14823, 11708, 2625, -8101, -14696, -12769, -4983, 1762, 5222, 7497, 8196, 5691, 2066, -313, -3267, -8078, -11048, -8404, -1235, 6743, 12091, 12091, 6881, 271, -4751, -8644, -11155, -9395, -2844, 4369, 8322, 8622, 6469, 3022, -737, -4849, -9069, -10055, -4421, 4496, 8686, 5622, 818, -821, -626, -1549, -2952, -2558, -454, 1409, 1969, 1386, -2, -1127, 95, 3959, 6700, 4107, -2420, -6538, -4854, -934, 536, 183, 1061, 2555, 1886, -464, -1504, -399, 1217, 1975, 1123, -1734, -4921, -4949, -888, 3390, 3882, 1839, 1150, 1728, 453, -2184, -2759, -1467, -1075, -1042, 191, 699, -76, 1646, 5290, 3495, -4729, -9337, -4190, 4191, 7679, 5992, 2254, -1739, -4361, -4843, -4480, -3279, 944, 7063, 9314, 4840, -1842, -4798, -3600, -1756, -1015, -375, 559, 656, -129, -139, 1214, 2361, 1936, 319, -1377, -2188, -1408, 615, 2157, 1840, 255, -1010, -1326, -1123, -734, -248, -202, -1063, -1923, -1108, 1424, 3685, 4090, 2895, 667, -2817, -6974, -9038, -6147, 1057, 7840, 9297, 5021, -859, -4407, -5147, -4174, -1674, 1857, 4338, 4360, 2737, 334, -3083, -6533, -7235, -3774, 2139, 7346, 9110, 6418, 1277, -2616, -3864, -4226, -4791, -4043, -1024, 2227, 3432, 3462, 4504, 5960, 5006, 1019, -3402, -5827, -5595, -2703, 1676, 4385, 3468, 1072, 112, 16, -1099, -2403, -1988, -491, 28, -402, -55, 1120, 855, -2043, -5097, -4581, -401, 3208, 2638, -786, -2787, -1510, 895, 1976, 2104, 2600, 2468, -448, -5325, -7959, -5522, 77, 4751, 6749, 7133, 6684, 4407, -381, -5882, -8827, -7535, -3439, 425, 2108, 1982, 1767, 2468, 3046, 1367, -2874, -6774, -7118, -3952, 363, 4299, 7061, 7273, 4717, 1474, -1074, -3800, -6461, -6524, -3342, 273, 2390, 4156, 6320, 6950, 4123, -1331, -6572, -8852, -6863, -1627, 3665, 6019, 5299, 3506, 1534, -1417, -4668, -4952, -631, 4715, 5861, 2500, -883, -1766, -2163, -3427, -3431, -1283, 349, 506, 2097, 5823, 7512, 4563, -136, -3235, -5038, -6291, -5341, -1283, 3246, 5407, 5960, 6675, 6209, 2627, -1977, -4119, -4348, -5152, -5692, -3497, 919, 4887, 6452, 4686, 651, -2014, -1609, -1391, -3629, -4705, -1176, 4092, 6487, 5130, 750, -5746, -10319, -7830, 743, 8159, 9035, 4444, -1243, -4597, -4553, -2573, -1624, -3063, -4415, -2275, 2489, 5492, 5221, 4363, 3798, 963, -4304, -8254, -8679, -6284, -1469, 4458, 7518, 6294, 4811, 5303, 3937, -1742, -7718, -9912, -9236, -7181, -2518, 4610, 10180, 10688, 7100, 2461, -2099, -6788, -10222, -9920, -5519, 669, 6012, 8717, 7813, 4112, 62, -2783, -4724, -5760, -4812, -1647, 2410, 5691, 6476, 3525, -1603, -4599, -3177, -311, -497, -3912, -6116, -3188, 3846, 9734, 10103, 5460, -434, -5105, -8319, -9261, -6014, 1006, 7527, 9365, 6874, 3768, 2188, 869, -1986, -6033, -9308, -9823, -6467, -56, 6322, 9453, 8727, 5852, 2227, -1991, -6157, -8310, -7149, -3377, 1906, 7738, 11040, 8151, 882, -4045, -4002, -2846, -2836, -2025, -712, -1598, -3023, -833, 3578, 5204, 3469, 1326, -634, -3314, -5717, -6478, -5483, -2415, 2611, 6930, 7603, 5114, 1778, -1722, -5414, -7717, -6862, -3321, 952, 4553, 6636, 6274, 3602, 857, 132, 251, -1807, -5901, -7715, -4061, 2842, 8023, 9037, 6936, 3158, -2130, -8079, -11172, -7548, 1871, 10476, 12099, 6870, -339, -5040, -5403, -2843, -1490, -3211, -3548, 1747, 8094, 7862, 2206, -1676, -2001, -2420, -4248, -5944, -6067, -2573, 4814, 10223, 7659, 934, -1405, 1033, 1784, -1348, -4806, -5670, -3405, 1153, 5001, 5270, 3449, 2869, 2903, 660, -3331, -5974, -6171, -4793, -2235, 1174, 4174, 5661, 5305, 2788, -1637, -5862, -7289, -5781, -3452, -1243, 2227, 7237, 10227, 7039, -1300, -8475, -9614, -6255, -2973, -1036, 1675, 5823, 9291, 10101, 7452, 1051, -7176, -12517, -12071, -7997, -3521, 1131, 6367, 10281, 10418, 6194, -715, -6381, -6955, -3483, -1348, -2585, -2857, 1325, 6777, 8198, 4995, 559, -2723, -4713, -5316, -4164, -2053, -151, 1715, 3408, 2880, -93, -1248, 2215, 6127, 5188, 817, -2248, -3228, -4024, -4472, -3358, -1049, 1548, 3940, 4940, 3496, 738, -1215, -2028, -2772, -3577, -3109, -221, 3959, 5830, 2917, -2055, -3761, -1819, -1742, -6255, -9886, -6057, 3197, 9306, 8133, 4153, 2835, 3432, 1805, -3041, -8061, -9588, -6044, 554, 5358, 5497, 3523, 3124, 3053, -504, -6579, -9393, -6325, -1476, 756, 1730, 4715, 8436, 9003, 5691, 586, -4533, -7595, -6463, -2434, 911, 2971, 4904, 4996, 1834, -1209, -1388, -1578, -3821, -4592, -1876, 568, 398, 486, 2423, 3390, 1543, -1301, -3126, -3547, -2571, -831, -4, -466, 54, 2964, 5406, 3636, -896, -3010, -1579, -876, -2766, -3157, 797, 5109, 4571, 235, -2780, -2600, -1915, -2901, -4029, -2637, 1179, 4812, 6547, 6703, 5491, 2635, -344, -1106, -643, -1932, -3913, -2776, 425, 742, -1885, -2657, -495, 1058, 507, -787, -2235, -3139, -1741, 1096, 1847, 66, -1156, -1025, -1419, -1915, -214, 3103, 4879, 3511, -32, -3677, -5360, -4759, -3802, -3434, -1640, 2560, 5884, 4942, 1110, -1725, -2130, -1485, -1368, -2346, -3989, -4977, -4162, -1932, 378, 2346, 4342, 5437, 3685, -171, -1890, 721, 3821, 2561, -1987, -4733, -3541, -646, 1371, 2027, 2260, 2597, 1691, -1939, -5964, -5877, -2085, 215, -165, 1098, 4954, 6792, 4696, 2001, 1016, 1188, 2262, 3243, 1330, -3032, -4623, -1171, 2836, 3340, 2010, 1751, 2081, 1231, -892, -3129, -4261, -3592, -1625, 288, 1287, 1258, 427, -150, 843, 2695, 2968, 1030, -1468, -3856, -6218, -6174, -1136, 6116, 9338, 6417, 950, -2842, -3498, -2439, -2789, -5553, -6909, -3248, 2290, 3698, 968, -718, 622, 1801, 237, -2839, -4917, -4503, -982, 4628, 8445, 6824, 1814, -561, 1112, 1776, -1565, -5419, -6066, -4140, -1222, 2273, 4999, 5623, 5287, 4810, 1943, -4310, -9925, -10454, -6439, -1234, 3484, 7580, 10205, 9877, 5975, -415, -6827, -10770, -10888, -6765, 921, 8947, 12455, 9768, 4509, 644, -2374, -6903, -11813, -12945, -7885, 1414, 9869, 12859, 9955, 4806, 466, -3352, -7219, -9199, -7259, -2171, 3490, 7281, 7617, 4874, 1472, -916, -2825, -4406, -4278, -2549, -1643, -2368, -2400, -258, 2207, 2735, 1662, 648, 259, 58, -206, -764, -1982, -3077, -2060, 1143, 3163, 1258, -2524, -3997, -2281, 182, 1827, 3325, 5124, 5860, 3768, -976, -5773, -7905, -7195, -5456, -3505, -400, 4016, 7594, 7909, 4846, 336, -3726, -6469, -7496, -6550, -3835, 17, 4236, 7519, 7994, 4896, -62, -4198, -6206, -6056, -3966, -852, 1596, 2772, 3746, 4972, 4986, 2415, -1858, -5180, -5256, -2176, 1327, 2667, 2312, 2258, 2381, 1112, -1123, -2373, -2293, -1810, -949, 427, 1442, 1780, 2250, 2583, 1397, -1029, -2792, -3084, -2280, -282, 2427, 3439, 1040, -2697, -3918, -1581, 1571, 2420, 602, -1731, -2412, -1096, 878, 1927, 1614, 834, 526, 574, 457, 250, 146, -171, -733, -904, -624, -705, -1171, -832, 753, 2393, 3002, 2852, 2543, 1920, 614, -1072, -2404, -2945, -2733, -1925, -620, 1020, 2697, 4003, 4337, 2960, -290, -4211, -6656, -6154, -3106, 688, 3595, 5117, 5443, 4596, 2611, 238, -1522, -2507, -3011, -2642, -908, 1381, 2802, 2979, 2280, 746, -1349, -3022, -3729, -3754, -2878, -408, 2889, 4762, 4154, 2429, 1255, 527, -782, -2631, -3837, -3412, -1084, 2672, 6014, 6509, 4107, 1656, 876, 77, -2307, -4594, -4371, -1826, 1106, 2900, 2925, 1644, 516, 247, -204, -1613, -2701, -1733, 1189, 4450, 6465, 6338, 4126, 1067, -1231, -2224, -2541, -2457, -1056, 2324, 6140, 7290, 4236, -1135, -5335, -6522, -5476, -3809, -1999, 493, 3573, 5922, 6429, 5147, 2321, -1753, -5190, -5507, -3292, -1716, -1547, -580, 1434, 2012, 629, -538, -656, -772, -901, -376, -13, -699, -1231, -230, 1273, 1317, -174, -1755, -2690, -3300, -3512, -2586, -494, 1628, 2797, 2985, 2392, 1084, -351, -1030, -941, -908, -1153, -829, 703, 2757, 3828, 3033, 825, -1716, -3938, -5622, -6243, -5092, -2241, 1308, 4599, 7116, 8161, 6850, 3329, -643, -3064, -3469, -2870, -2143, -1127, 560, 2530, 3842, 3873, 2752, 1177, -172, -1050, -1256, -134, 2437, 4750, 4545, 1834, -1057, -2311, -2011, -933, 355, 1278, 1570, 1743, 2254, 2534, 1706, -79, -1640, -1939, -987, 379, 1582, 2935, 4707, 5938, 5251, 2781, 106, -1813, -3380, -4732, -4758, -2718, 64, 1517, 1499, 1814, 3350, 4564, 3535, 574, -2130, -3019, -2573, -2239, -2415, -2067, -543, 1014, 1056, -158, -993, -804, -523, -986, -1894, -2499, -2368, -1391, 150, 1344, 1257, 99, -852, -897, -757, -1285, -2134, -2497, -2378, -2333, -2509, -2665, -2706, -2677, -2549, -2312, -2026, -1678, -1275, -1082, -1398, -2013, -2304, -2185, -2410, -3430, -4462, -4410, -3264, -1913, -1036, -778, -955, -1068, -717, -255, -419, -1368, -2646, -3801, -4476, -4382, -3740, -3098, -2422, -1205, 272, 828, -209, -2228, -4126, -5203, -5259, -4428, -3030, -1398, 120, 1121, 1384, 986, -55, -1832, -3866, -4955, -4338, -2685, -1289, -562, 24, 633, 590, -499, -1982, -2994, -3410, -3433, -2888, -1627, -192, 605, 495, -273, -1496, -3021, -4360, -4890, -4490, -3531, -2284, -924, -48, -354, -1642, -2817, -3003, -2212, -1125, -604, -1041, -1782, -1703, -703, 22, -480, -1735, -2538, -2383, -1815, -1619, -1980, -2378, -2199, -1432, -775, -1013, -2228, -3580, -3991, -3161, -1800, -719, 68, 972, 1818, 1891, 941, -453, -1625, -2335, -2475, -1846, -539, 801, 1467, 1318, 779, 214, -466, -1471, -2541, -3012, -2502, -1300, 5, 1060, 1803, 2226, 2236, 1718, 669, -638, -1640, -1829, -1231, -344, 583, 1893, 3807, 5676, 6577, 6523, 6417, 6855, 7577, 8154, 8616, 9300, 10353, 11569, 12557, 13086, 13217, 13062, 12671, 12227, 12141, 12596, 13232, 13607, 13853, 14452, 15328, 15713, 15173, 14302, 13956, 14156, 14322, 14237, 14247, 14582, 15064, 15517, 16027, 16674, 17260, 17515, 17440, 17300, 17285, 17335, 17289, 17059, 16587, 15841, 14971, 14241, 13671, 12997, 12202, 11688, 11697, 11876, 11720, 11241, 10788, 10504, 10161, 9541, 8770, 8261, 8340, 8884, 9349, 9250, 8586, 7705, 6772, 5602, 4201, 3037, 2456, 2195, 1754, 1068, 378, -241, -954, -1913, -3095, -4229, -4935, -5192, -5462, -6157, -7100, -7799, -8095, -8232, -8387, -8471, -8431, -8450, -8695, -9081, -9430, -9693, -9871, -9954, -10082, -10567, -11526, -12599, -13266, -13395, -13323, -13412, -13670, -13873, -13939, -14034, -14307, -14626, -14696, -14362, -13728, -13019, -12371, -11797, -11248, -10757, -10448, -10362, -10355, -10285, -10179, -10102, -9974, -9720, -9425, -9168, -8895, -8589, -8292, -7961, -7541, -7216, -7202, -7316, -7116, -6439, -5606, -5007, -4702, -4367, -3659, -2691, -1997, -1847, -1810, -1361, -683, -440, -796, -1153, -937, -368, -167, -639, -1274, -1453, -1303, -1494, -2232, -2975, -3291, -3499, -4124, -5036, -5518, -5087, -4093, -3437, -3659, -4323, -4521, -4047, -3700, -4229, -5325, -6016, -5877, -5487, -5627, -6271, -6641, -6250, -5611, -5660, -6659, -7966, -8831, -9098, -9089, -9145, -9334, -9442, -9199, -8653, -8232, -8312, -8830, -9358, -9519, -9316, -9149, -9341, -9609, -9325, -8425, -7632, -7592, -8231, -9113, -9892, -10326, -10348, -10138, -9832, -9334, -8714, -8436, -8815, -9580, -10200, -10369, -10060, -9476, -8974, -8655, -8083, -6837, -5280, -4418, -4789, -5817, -6453, -6262, -5636, -5143, -4943, -4771, -4267, -3481, -3019, -3358, -4022, -4039, -3203, -2196, -1593, -1411, -1507, -1759, -1992, -2110, -2093, -1772, -1106, -637, -895, -1417, -1151, 86, 1325, 1698, 1414, 1279, 1676, 2258, 2518, 2395, 2265, 2399, 2654, 2745, 2669, 2693, 2939, 3132, 2902, 2248, 1581, 1229, 1003, 475, -435, -1474, -2620, -4152, -5980, -7431, -7951, -7654, -7007, -6252, -5191, -3357, -654, 2128, 3977, 4913, 5821, 6967, 7700, 7765, 7886, 8739, 10106, 11276, 11753, 11608, 11406, 11616, 11977, 11822, 11011, 10098, 9630, 9783, 10590, 11958, 13457, 14549, 15185, 15841, 16930, 18271, 19288, 19684, 19854, 20413, 21472, 22601, 23520, 24422, 25547, 26735, 27629, 28119, 28353, 28472, 28515, 28523, 28480, 28198, 27536, 26633, 25843, 25281, 24781, 24239, 23778, 23504, 23368, 23338, 23498, 23897, 24384, 24647, 24490, 24117, 23953, 24124, 24286, 24156, 23837, 23453, 22924, 22255, 21573, 20682, 19150, 17028, 15024, 13683, 12736, 11644, 10383, 9285, 8381, 7344, 6132, 5081, 4291, 3444, 2388, 1448, 969, 831, 625, 151, -413, -782, -923, -1080, -1460, -2024, -2666, -3409, -4297, -5251, -6179, -7147, -8294, -9626, -10995, -12298, -13540, -14734, -15810, -16697, -17351, -17677, -17591, -17188, -16685, -16230, -15877, -15712, -15720, -15671, -15356, -14815, -14197, -13585, -13128, -13058, -13354, -13665, -13704, -13542, -13421, -13470, -13644, -13862, -13996, -13856, -13329, -12571, -11902, -11527, -11373, -11214, -10842, -10206, -9433, -8666, -7856, -6874, -5814, -4915, -4212, -3497, -2706, -2046, -1739, -1775, -1935, -1963, -1805, -1689, -1862, -2272, -2686, -2991, -3173, -3183, -3090, -3155, -3524, -3993, -4253, -4202, -3915, -3518, -3201, -3129, -3266, -3396, -3345, -3122, -2900, -2911, -3246, -3747, -4169, -4470, -4852, -5485, -6288, -6987, -7368, -7500, -7672, -8124, -8809, -9485, -9978, -10292, -10487, -10564, -10566, -10654, -10929, -11220, -11248, -10961, -10514, -10018, -9587, -9394, -9421, -9415, -9352, -9521, -10000, -10518, -10971, -11542, -12166, -12495, -12433, -12217, -11973, -11664, -11389, -11331, -11456, -11552, -11520, -11402, -11203, -10866, -10405, -9906, -9362, -8733, -8148, -7832, -7794, -7858, -7989, -8235, -8441, -8371, -8081, -7831, -7745, -7766, -7835, -7887, -7855, -7826, -8013, -8381, -8545, -8236, -7703, -7362, -7140, -6600, -5711, -4966, -4645, -4392, -3784, -2942, -2250, -1746, -1176, -512, -14, 212, 336, 430, 354, 33, -452, -1026, -1548, -1759, -1586, -1321, -1246, -1266, -1149, -864, -516, -137, 278, 666, 929, 1053, 1093, 1074, 941, 624, 158, -275, -470, -379, -175, -85, -142, -192, -148, -137, -316, -625, -864, -978, -1134, -1450, -1846, -2231, -2768, -3782, -5417, -7440, -9319, -10644, -11531, -12341, -12821, -12042, -9512, -5890, -2167, 1386, 4996, 8568, 11598, 13665, 14668, 14764, 14343, 13976, 14097, 14688, 15377, 15803, 15876, 15706, 15439, 15146, 14761, 14152, 13401, 12911, 13068, 13978, 15511, 17408, 19284, 20884, 22339, 23963, 25685, 27073, 27841, 28151, 28338, 28634, 29112, 29732, 30381, 30874, 31075, 31050, 31008, 31049, 31037, 30757, 30204, 29544, 28872, 28104, 27113, 25892, 24478, 22897, 21290, 19992, 19351, 19352, 19655, 19961, 20295, 20867, 21701, 22573, 23190, 23358, 22984, 22168, 21209, 20317, 19282, 17759, 15811, 13842, 12033, 10195, 8190, 6097, 4045, 2073, 223, -1464, -3077, -4730, -6295, -7469, -8165, -8612, -8965, -9096, -8956, -8779, -8677, -8475, -8095, -7798, -7841, -8168, -8559, -8844, -8995, -9155, -9513, -10047, -10537, -10927, -11385, -12054, -12915, -13953, -15202, -16551, -17718, -18546, -19158, -19704, -20078, -20056, -19595, -18766, -17594, -16164, -14792, -13674, -12561, -11069, -9247, -7578, -6452, -5782, -5181, -4438, -3743, -3374, -3264, -3085, -2761, -2564, -2657, -2811, -2766, -2619, -2681, -3015, -3356, -3413, -3164, -2821, -2588, -2459, -2161, -1388, -192, 973, 1744, 2254, 2856, 3632, 4378, 4909, 5170, 5189, 5083, 5019, 5056, 5080, 4937, 4566, 4003, 3365, 2768, 2189, 1436, 334, -1050, -2448, -3621, -4565, -5449, -6374, -7264, -7957, -8378, -8544, -8455, -8133, -7711, -7426, -7423, -7634, -7825, -7822, -7676, -7647, -7924, -8398, -8820, -9144, -9545, -10137, -10861, -11634, -12444, -13317, -14250, -15176, -15920, -16357, -16565, -16708, -16802, -16742, -16491, -16065, -15438, -14607, -13720, -12974, -12440, -12010, -11520, -10866, -10075, -9311, -8741, -8384, -8070, -7639, -7120, -6671, -6391, -6291, -6371, -6580, -6781, -6904, -7056, -7345, -7691, -7946, -8073, -8111, -8082, -7987, -7803, -7504, -7135, -6776, -6391, -5834, -5099, -4379, -3824, -3358, -2843, -2311, -1924, -1767, -1768, -1803, -1840, -1962, -2253, -2711, -3247, -3808, -4402, -5057, -5722, -6288, -6683, -6885, -6891, -6715, -6466, -6305, -6265, -6177, -5867, -5374, -4871, -4421, -3939, -3423, -3016, -2774, -2536, -2162, -1800, -1742, -2037, -2417, -2637, -2778, -3120, -3728, -4317, -4617, -4697, -4834, -5157, -5580, -5958, -6178, -6185, -6071, -6053, -6201, -6314, -6168, -5827, -5537, -5380, -5206, -4925, -4664, -4559, -4574, -4653, -4854, -5319, -6197, -7522, -8966, -9877, -9908, -9472, -9199, -9039, -8208, -6076, -2878, 565, 3590, 6093, 8295, 10363, 12289, 14035, 15581, 16854, 17829, 18657, 19538, 20469, 21230, 21585, 21396, 20680, 19676, 18745, 18026, 17466, 17129, 17287, 18065, 19254, 20593, 22016, 23543, 25086, 26507, 27741, 28772, 29545, 30076, 30513, 31011, 31499, 31796, 31899, 31946, 32026, 32057, 31917, 31554, 31006, 30370, 29659, 28761, 27607, 26268, 24799, 23124, 21275, 19498, 18032, 16837, 15781, 14884, 14293, 14011, 13833, 13549, 13158, 12882, 12801, 12657, 12075, 11077, 10139, 9628, 9273, 8504, 7203, 5784, 4445, 2934, 1101, -840, -2758, -4793, -6935, -8950, -10781, -12532, -14095, -15219, -15913, -16398, -16727, -16752, -16387, -15743, -15019, -14341, -13679, -12943, -12168, -11469, -10842, -10221, -9692, -9394, -9239, -9016, -8750, -8653, -8794, -9053, -9390, -9876, -10451, -10915, -11195, -11434, -11771, -12092, -12088, -11559, -10610, -9508, -8421, -7314, -6041, -4490, -2682, -863, 671, 1931, 3203, 4556, 5667, 6324, 6785, 7344, 7919, 8286, 8427, 8448, 8403, 8300, 8143, 7902, 7610, 7304, 6905, 6342, 5802, 5556, 5541, 5457, 5249, 5166, 5332, 5567, 5681, 5737, 5882, 6086, 6169, 6017, 5713, 5444, 5327, 5254, 4937, 4265, 3537, 3100, 2803, 2153, 1007, -274, -1398, -2454, -3614, -4872, -6182, -7578, -9042, -10400, -11515, -12445, -13336, -14159, -14741, -15015, -15108, -15192, -15299, -15357, -15328, -15282, -15334, -15451, -15454, -15257, -15027, -15010, -15204, -15393, -15449, -15496, -15746, -16245, -16843, -17373, -17798, -18188, -18580, -18904, -19066, -19023, -18789, -18357, -17740, -17050, -16423, -15753, -14787, -13555, -12436, -11588, -10715, -9577, -8373, -7394, -6622, -5893, -5148, -4423, -3757, -3233, -2861, -2547, -2263, -2105, -2117, -2199, -2277, -2388, -2531, -2631, -2660, -2696, -2783, -2838, -2744, -2508, -2270, -2145, -2079, -1925, -1633, -1326, -1134, -1032, -875, -601, -320, -163, -113, -50, 71, 147, 44, -266, -748, -1381, -2129, -2886, -3582, -4314, -5208, -6191, -7033, -7564, -7747, -7715, -7772, -8132, -8554, -8577, -8141, -7642, -7332, -7097, -6790, -6428, -6025, -5539, -4994, -4499, -4181, -4161, -4454, -4856, -5109, -5229, -5525, -6172, -6939, -7489, -7826, -8201, -8657, -9009, -9214, -9433, -9730, -9995, -10105, -9979, -9640, -9314, -9208, -9104, -8653, -8025, -7743, -7899, -8091, -8139, -8312, -8790, -9322, -9465, -9024, -8198, -7257, -5980, -3766, -496, 3075, 6200, 8975, 11855, 14761, 17161, 18816, 20004, 21100, 22218, 23204, 23858, 24185, 24342, 24426, 24352, 23965, 23259, 22328, 21250, 20126, 19190, 18732, 18836, 19389, 20405, 21967, 23855, 25596, 27056, 28437, 29788, 30861, 31550, 32006, 32343, 32554, 32679, 32767, 32761, 32589, 32224, 31656, 30891, 30032, 29036, 27697, 25877, 23753, 21624, 19611, 17692, 15824, 13985, 12239, 10805, 9855, 9285, 8875, 8633, 8770, 9245, 9633, 9522, 8960, 8337, 7832, 7177, 6136, 4903, 3769, 2571, 1030, -558, -1710, -2665, -4099, -6035, -7873, -9420, -11058, -12966, -14827, -16340, -17478, -18328, -18935, -19280, -19262, -18806, -17979, -16916, -15752, -14629, -13608, -12508, -11158, -9763, -8690, -7913, -7086, -6078, -5121, -4401, -3869, -3475, -3300, -3413, -3770, -4257, -4812, -5484, -6319, -7122, -7635, -7862, -7967, -7824, -7116, -5899, -4533, -3063, -1211, 1012, 3234, 5290, 7361, 9475, 11299, 12646, 13733, 14750, 15468, 15638, 15500, 15428, 15326, 14787, 13760, 12602, 11559, 10552, 9449, 8258, 7068, 5946, 4928, 4121, 3684, 3643, 3745, 3709, 3616, 3799, 4329, 4871, 5124, 5137, 5120, 5112, 4953, 4507, 3825, 3133, 2501, 1733, 683, -476, -1549, -2612, -3764, -4899, -5991, -7246, -8679, -10023, -11217, -12493, -13905, -15203, -16275, -17273, -18216, -18903, -19281, -19515, -19690, -19651, -19285, -18771, -18371, -18102, -17714, -17096, -16427, -15952, -15700, -15479, -15127, -14702, -14407, -14327, -14372, -14508, -14843, -15388, -15920, -16261, -16455, -16607, -16721, -16779, -16721, -16370, -15592, -14532, -13438, -12390, -11343, -10232, -8931, -7409, -5919, -4739, -3794, -2884, -2025, -1247, -421, 385, 847, 974, 1152, 1473, 1589, 1377, 1110, 908, 603, 173, -165, -324, -444, -630, -805, -863, -781, -606, -410, -304, -379, -582, -744, -805, -865, -993, -1171, -1371, -1535, -1565, -1523, -1648, -2013, -2391, -2650, -2953, -3418, -3935, -4455, -5102, -5928, -6855, -7810, -8682, -9339, -9824, -10325, -10827, -11149, -11346, -11586, -11769, -11698, -11508, -11450, -11501, -11472, -11246, -10701, -9903, -9275, -8990, -8502, -7400, -6241, -5723, -5721, -5790, -5838, -5796, -5576, -5603, -6258, -6959, -6985, -6737, -6932, -7272, -7153, -6786, -6643, -6741, -7030, -7425, -7442, -6915, -6641, -7077, -7321, -6590, -5512, -4871, -4336, -3455, -2585, -2152, -2060, -2206, -2594, -2987, -3211, -3644, -4642, -5734, -5909, -4575, -2054, 651, 2821, 4851, 7787, 11766, 15647, 18479, 20463, 22207, 23787, 25043, 26040, 26854, 27358, 27493, 27448, 27336, 26994, 26226, 25031, 23482, 21659, 19850, 18534, 17859, 17524, 17477, 18135, 19614, 21372, 23015, 24732, 26614, 28302, 29526, 30413, 31070, 31415, 31461, 31374, 31243, 30989, 30561, 29902, 28940, 27612, 25897, 23875, 21776, 19853, 18099, 16220, 14041, 11773, 9820, 8373, 7259, 6203, 5162, 4431, 4348, 4838, 5380, 5503, 5280, 5149, 5242, 5168, 4573, 3591, 2467, 1230, -58, -1116, -1849, -2586, -3537, -4442, -5049, -5576, -6399, -7556, -8777, -9836, -10786, -11801, -12846, -13593, -13867, -13927, -14025, -13955, -13431, -12566, -11606, -10585, -9561, -8729, -8011, -7023, -5687, -4403, -3419, -2493, -1383, -196, 798, 1503, 2005, 2402, 2621, 2461, 1867, 1062, 252, -624, -1681, -2773, -3621, -4126, -4391, -4446, -4174, -3456, -2309, -897, 605, 2174, 3893, 5716, 7433, 8861, 9964, 10783, 11432, 12074, 12678, 12959, 12778, 12384, 12008, 11494, 10592, 9387, 8114, 6773, 5229, 3574, 2099, 908, -149, -1150, -1906, -2246, -2309, -2389, -2533, -2555, -2378, -2210, -2282, -2574, -2895, -3140, -3368, -3693, -4153, -4677, -5136, -5476, -5791, -6214, -6740, -7284, -7837, -8496, -9328, -10309, -11371, -12478, -13616, -14768, -15911, -17010, -18002, -18804, -19391, -19820, -20138, -20405, -20661, -20835, -20744, -20361, -19889, -19432, -18787, -17756, -16438, -15024, -13551, -12052, -10685, -9561, -8682, -8021, -7549, -7199, -6983, -7008, -7268, -7575, -7779, -7884, -7908, -7853, -7761, -7615, -7294, -6790, -6254, -5752, -5160, -4466, -3775, -3041, -2125, -1126, -255, 504, 1317, 2199, 3035, 3710, 4106, 4184, 4126, 4112, 3996, 3546, 2854, 2193, 1618, 1028, 462, 27, -337, -790, -1317, -1736, -1978, -2192, -2580, -3167, -3809, -4393, -4922, -5388, -5734, -5969, -6215, -6507, -6683, -6615, -6424, -6323, -6394, -6565, -6755, -6897, -6980, -7106, -7382, -7767, -8114, -8361, -8568, -8793, -9037, -9294, -9591, -9939, -10297, -10595, -10807, -10984, -11214, -11515, -11740, -11666, -11249, -10691, -10130, -9446, -8561, -7688, -6967, -6266, -5554, -5116, -5060, -5034, -4772, -4515, -4572, -4787, -4826, -4681, -4529, -4342, -4040, -3870, -4102, -4482, -4453, -4029, -3878, -4285, -4572, -4129, -3464, -3302, -3174, -2324, -1438, -1609, -2166, -1788, -1081, -1599, -3065, -3985, -4335, -5233, -6590, -7102, -6179, -4406, -2404, -190, 2522, 5861, 9588, 13220, 16352, 18925, 21093, 23000, 24614, 25821, 26630, 27271, 27959, 28650, 28987, 28620, 27610, 26420, 25217, 23509, 20992, 18295, 16276, 15006, 14156, 13829, 14292, 15327, 16637, 18328, 20481, 22716, 24617, 26167, 27439, 28371, 28960, 29378, 29816, 30260, 30491, 30244, 29551, 28825, 28278, 27479, 25821, 23347, 20706, 18384, 16265, 13967, 11344, 8640, 6268, 4511, 3356, 2579, 2029, 1738, 1818, 2193, 2604, 2867, 2986, 3016, 2951, 2773, 2506, 2137, 1620, 1007, 478, 122, -180, -612, -1190, -1906, -2863, -4072, -5281, -6295, -7277, -8441, -9672, -10675, -11304, -11578, -11567, -11427, -11316, -11217, -10989, -10542, -9857, -9022, -8283, -7788, -7258, -6266, -4847, -3449, -2314, -1247, -53, 1186, 2313, 3284, 4053, 4492, 4566, 4435, 4211, 3783, 3029, 2088, 1190, 357, -509, -1312, -1822, -1991, -1994, -1948, -1738, -1162, -198, 984, 2226, 3495, 4759, 5911, 7006, 8273, 9669, 10719, 11166, 11406, 11850, 12272, 12224, 11712, 10995, 10104, 8955, 7645, 6313, 4925, 3411, 1842, 371, -891, -1925, -2747, -3373, -3804, -4115, -4444, -4815, -5087, -5180, -5219, -5390, -5694, -6004, -6215, -6297, -6282, -6274, -6392, -6608, -6763, -6785, -6869, -7238, -7835, -8442, -9041, -9792, -10703, -11635, -12549, -13468, -14319, -15053, -15790, -16579, -17300, -17905, -18451, -18881, -19118, -19280, -19396, -19187, -18511, -17622, -16662, -15453, -13998, -12560, -11126, -9567, -8168, -7214, -6420, -5472, -4645, -4184, -3863, -3649, -3819, -4184, -4240, -4122, -4342, -4797, -5085, -5337, -5797, -6150, -6113, -5980, -6036, -6070, -5840, -5391, -4759, -3899, -2947, -2114, -1395, -659, 115, 888, 1629, 2217, 2499, 2502, 2438, 2437, 2405, 2197, 1787, 1225, 529, -249, -994, -1673, -2466, -3536, -4750, -5796, -6585, -7316, -8103, -8774, -9163, -9385, -9600, -9699, -9510, -9103, -8668, -8237, -7787, -7385, -7053, -6708, -6370, -6189, -6218, -6366, -6594, -6927, -7334, -7773, -8271, -8850, -9459, -10062, -10671, -11255, -11739, -12118, -12462, -12786, -12991, -12971, -12699, -12254, -11719, -11129, -10472, -9767, -9070, -8390, -7700, -7045, -6547, -6228, -5942, -5555, -5092, -4668, -4378, -4202, -4028, -3787, -3581, -3528, -3562, -3588, -3718, -4087, -4488, -4576, -4445, -4570, -5039, -5255, -4836, -4331, -4425, -4845, -4936, -4839, -5130, -5676, -5973, -6188, -6743, -7301, -7115, -6016, -4343, -2303, 38, 2521, 5125, 8046, 11298, 14439, 16988, 18935, 20646, 22312, 23746, 24757, 25516, 26226, 26680, 26477, 25643, 24668, 23791, 22660, 20892, 18696, 16684, 15216, 14248, 13667, 13526, 13924, 14801, 16051, 17671, 19679, 21837, 23711, 25109, 26283, 27490, 28598, 29327, 29696, 30011, 30348, 30433, 30103, 29565, 28894, 27784, 26078, 24156, 22276, 20084, 17252, 14226, 11674, 9589, 7545, 5557, 4117, 3432, 3217, 3203, 3480, 4085, 4721, 5134, 5444, 5881, 6341, 6553, 6481, 6294, 6041, 5625, 5070, 4542, 4057, 3367, 2288, 901, -559, -1897, -3027, -4049, -5174, -6402, -7427, -8028, -8291, -8366, -8290, -8123, -7938, -7634, -7084, -6398, -5802, -5317, -4826, -4305, -3767, -3124, -2336, -1594, -1079, -636, 51, 944, 1605, 1775, 1720, 1809, 1985, 1893, 1427, 836, 349, -65, -519, -993, -1407, -1752, -2039, -2226, -2254, -2122, -1836, -1376, -781, -149, 506, 1341, 2442, 3602, 4584, 5460, 6416, 7368, 8145, 8819, 9457, 9812, 9702, 9394, 9178, 8870, 8144, 7054, 5903, 4823, 3752, 2649, 1522, 352, -816, -1784, -2403, -2814, -3279, -3812, -4229, -4470, -4621, -4691, -4664, -4640, -4670, -4645, -4505, -4325, -4123, -3871, -3680, -3679, -3782, -3896, -4137, -4599, -5182, -5836, -6654, -7592, -8524, -9525, -10648, -11681, -12522, -13424, -14456, -15325, -16002, -16782, -17592, -18026, -18152, -18331, -18438, -18100, -17435, -16740, -15872, -14645, -13338, -12244, -11206, -10033, -8887, -7995, -7314, -6710, -6154, -5728, -5543, -5575, -5643, -5651, -5765, -6110, -6485, -6657, -6747, -7018, -7411, -7636, -7640, -7652, -7722, -7591, -7105, -6489, -5979, -5443, -4618, -3586, -2708, -2086, -1482, -771, -173, 138, 320, 549, 691, 553, 287, 189, 171, -158, -852, -1486, -1885, -2416, -3270, -4051, -4543, -5164, -6134, -6971, -7346, -7613, -8073, -8497, -8696, -8810, -8860, -8690, -8393, -8231, -8154, -7911, -7526, -7260, -7185, -7084, -6850, -6674, -6731, -6910, -7048, -7205, -7510, -7934, -8383, -8827, -9246, -9645, -10113, -10680, -11210, -11564, -11789, -11956, -12036, -11993, -11807, -11396, -10727, -10001, -9464, -9013, -8270, -7195, -6272, -5841, -5563, -5018, -4405, -4078, -3831, -3372, -2966, -2876, -2783, -2465, -2333, -2643, -2943, -2932, -3109, -3891, -4743, -4913, -4600, -4662, -5301, -5742, -5373, -4547, -3969, -3737, -3465, -3021, -2646, -2501, -2510, -2646, -2918, -3124, -2943, -2360, -1629, -768, 520, 2405, 4736, 7262, 9804, 12184, 14282, 16175, 18000, 19734, 21209, 22320, 23161, 23875, 24521, 25042, 25311, 25209, 24689, 23827, 22667, 21194, 19592, 18248, 17225, 16203, 15232, 14921, 15536, 16617, 17788, 19216, 20961, 22687, 24199, 25631, 26975, 28015, 28704, 29200, 29574, 29804, 29864, 29687, 29244, 28631, 27883, 26785, 25175, 23225, 21188, 19070, 16735, 14322, 12104, 10140, 8293, 6655, 5585, 5189, 5094, 4973, 4989, 5465, 6231, 6765, 6898, 6960, 7165, 7261, 6996, 6547, 6122, 5607, 4827, 3893, 2957, 1960, 806, -468, -1797, -3177, -4563, -5883, -7111, -8224, -9154, -9861, -10367, -10648, -10624, -10305, -9885, -9514, -9079, -8382, -7500, -6712, -6106, -5536, -4938, -4374, -3818, -3243, -2792, -2567, -2362, -1936, -1420, -1140, -1146, -1193, -1164, -1210, -1452, -1766, -1972, -2110, -2325, -2563, -2600, -2395, -2168, -2022, -1748, -1200, -583, -104, 349, 940, 1601, 2221, 2821, 3392, 3913, 4519, 5282, 5993, 6502, 7008, 7637, 8155, 8395, 8494, 8504, 8273, 7846, 7421, 6914, 6082, 5038, 4126, 3420, 2683, 1791, 855, 2, -739, -1394, -1983, -2543, -3073, -3496, -3740, -3839, -3912, -3981, -3936, -3711, -3417, -3212, -3101, -2972, -2796, -2675, -2709, -2933, -3344, -3927, -4611, -5330, -6148, -7224, -8529, -9787, -10791, -11708, -12795, -13944, -14851, -15486, -16060, -16590, -16939, -17135, -17285, -17265, -16879, -16238, -15582, -14930, -14098, -13063, -12009, -11059, -10163, -9270, -8462, -7818, -7332, -7025, -6963, -7093, -7254, -7394, -7636, -8028, -8414, -8620, -8647, -8651, -8745, -8883, -8892, -8678, -8321, -7968, -7663, -7305, -6817, -6231, -5569, -4768, -3843, -3005, -2394, -1846, -1138, -414, -36, -33, -31, 118, 63, -441, -1015, -1254, -1457, -2082, -2911, -3429, -3724, -4224, -4906, -5452, -5917, -6567, -7262, -7619, -7688, -7901, -8331, -8541, -8313, -7994, -7855, -7712, -7402, -7112, -6958, -6798, -6615, -6575, -6701, -6947, -7360, -7879, -8257, -8491, -8852, -9370, -9792, -10114, -10546, -11027, -11302, -11394, -11549, -11775, -11879, -11823, -11713, -11481, -10950, -10174, -9446, -8875, -8231, -7354, -6487, -5963, -5779, -5666, -5465, -5246, -5116, -5125, -5229, -5292, -5153, -4834, -4609, -4719, -5045, -5216, -5100, -5035, -5353, -5832, -5992, -5811, -5661, -5543, -5025, -4066, -3202, -2772, -2524, -2192, -1887, -1781, -1816, -1988, -2441, -3082, -3400, -2954, -1880, -677, 498, 2004, 4122, 6574, 8923, 11156, 13478, 15688, 17400, 18693, 20024, 21494, 22796, 23796, 24645, 25359, 25741, 25749, 25489, 24970, 24090, 22905, 21607, 20315, 19033, 17906, 17238, 17205, 17644, 18336, 19266, 20491, 21930, 23379, 24698, 25850, 26830, 27628, 28257, 28744, 29128, 29409, 29537, 29448, 29116, 28561, 27809, 26886, 25764, 24322, 22516, 20512, 18547, 16627, 14608, 12559, 10730, 9256, 8081, 7183, 6590, 6285, 6233, 6447, 6841, 7181, 7289, 7212, 7060, 6804, 6346, 5678, 4931, 4195, 3424, 2535, 1558, 609, -234, -1031, -1928, -2997, -4137, -5169, -6056, -6877, -7606, -8147, -8520, -8777, -8847, -8706, -8522, -8350, -8011, -7511, -7161, -7042, -6832, -6406, -6076, -6045, -6056, -5811, -5373, -4955, -4603, -4232, -3785, -3250, -2653, -2105, -1755, -1581, -1365, -1048, -895, -1096, -1454, -1653, -1654, -1629, -1662, -1711, -1683, -1471, -1042, -512, -21, 449, 1020, 1712, 2402, 3037, 3711, 4478, 5237, 5925, 6607, 7283, 7820, 8198, 8553, 8846, 8845, 8506, 8039, 7530, 6883, 6087, 5239, 4368, 3475, 2647, 1921, 1241, 619, 158, -151, -429, -697, -889, -1025, -1191, -1375, -1470, -1510, -1655, -1925, -2117, -2131, -2158, -2369, -2644, -2841, -3041, -3388, -3843, -4335, -4935, -5702, -6543, -7359, -8200, -9142, -10155, -11129, -11985, -12730, -13423, -14080, -14664, -15182, -15692, -16155, -16437, -16521, -16534, -16479, -16227, -15779, -15246, -14594, -13729, -12790, -11965, -11208, -10440, -9790, -9340, -8991, -8741, -8723, -8860, -8972, -9160, -9593, -10088, -10339, -10437, -10642, -10896, -10962, -10856, -10774, -10736, -10583, -10231, -9771, -9320, -8835, -8139, -7207, -6260, -5449, -4619, -3639, -2739, -2170, -1787, -1333, -915, -808, -980, -1179, -1340, -1599, -2020, -2541, -3071, -3568, -4042, -4536, -5076, -5645, -6211, -6752, -7243, -7646, -7955, -8222, -8462, -8546, -8367, -8051, -7790, -7497, -6974, -6362, -5966, -5733, -5425, -5160, -5201, -5451, -5687, -5982, -6435, -6904, -7316, -7800, -8346, -8828, -9314, -9872, -10303, -10562, -10979, -11616, -11960, -11733, -11362, -11237, -11108, -10573, -9671, -8711, -7911, -7289, -6737, -6225, -5877, -5682, -5343, -4829, -4607, -4790, -4756, -4234, -3863, -4017, -4143, -3912, -3839, -4189, -4494, -4533, -4667, -4952, -4968, -4692, -4559, -4663, -4572, -4016, -3264, -2759, -2620, -2575, -2409, -2263, -2389, -2639, -2647, -2466, -2502, -2723, -2441, -1134, 844, 2766, 4469, 6407, 8825, 11357, 13516, 15317, 17063, 18807, 20320, 21523, 22621, 23740, 24716, 25306, 25518, 25515, 25282, 24589, 23442, 22166, 20968, 19715, 18467, 17693, 17592, 17818, 18180, 19022, 20465, 22005, 23266, 24475, 25888, 27296, 28373, 29115, 29681, 30165, 30526, 30706, 30688, 30533, 30232, 29654, 28706, 27542, 26385, 25161, 23571, 21489, 19194, 17051, 15168, 13409, 11719, 10213, 9023, 8199, 7797, 7836, 8188, 8589, 8868, 9056, 9186, 9209, 9114, 8976, 8734, 8144, 7089, 5894, 4989, 4266, 3171, 1566, 0, -1186, -2393, -3930, -5379, -6399, -7371, -8586, -9594, -10004, -10168, -10504, -10809, -10737, -10383, -9982, -9515, -8889, -8238, -7764, -7411, -6976, -6462, -6121, -6053, -6044, -5862, -5565, -5347, -5227, -5050, -4729, -4442, -4403, -4537, -4570, -4503, -4663, -5116, -5508, -5651, -5777, -5993, -6018, -5719, -5354, -5072, -4629, -3823, -2799, -1784, -798, 206, 1191, 2117, 3054, 4066, 5031, 5743, 6183, 6587, 7146, 7754, 8135, 8143, 7864, 7457, 6985, 6422, 5773, 5034, 4128, 3021, 1947, 1217, 810, 432, 5, -263, -310, -305, -305, -188, 65, 328, 481, 441, 271, 237, 432, 492, 138, -261, -320, -336, -735, -1343, -1865, -2475, -3359, -4292, -5114, -6059, -7277, -8535, -9623, -10611, -11557, -12382, -13035, -13582, -14131, -14690, -15134, -15319, -15300, -15313, -15430, -15447, -15195, -14751, -14213, -13561, -12869, -12281, -11780, -11189, -10495, -9917, -9640, -9666, -9886, -10152, -10383, -10650, -11083, -11666, -12231, -12684, -13034, -13282, -13371, -13301, -13174, -13034, -12800, -12386, -11828, -11213, -10556, -9833, -9055, -8222, -7292, -6310, -5402, -4609, -3875, -3227, -2779, -2528, -2368, -2327, -2562, -3088, -3674, -4107, -4453, -4908, -5490, -6020, -6362, -6557, -6722, -6932, -7202, -7481, -7653, -7630, -7512, -7479, -7506, -7339, -6871, -6325, -5909, -5521, -4989, -4419, -4048, -3909, -3860, -3855, -3983, -4286, -4719, -5278, -5969, -6655, -7144, -7466, -7866, -8446, -9025, -9407, -9594, -9688, -9752, -9815, -9891, -9864, -9530, -8859, -8090, -7424, -6741, -5824, -4771, -3915, -3395, -3049, -2726, -2488, -2478, -2699, -2990, -3164, -3185, -3198, -3343, -3594, -3782, -3788, -3666, -3566, -3596, -3736, -3847, -3756, -3420, -2988, -2674, -2474, -2128, -1439, -620, -137, -128, -235, -138, -40, -320, -1002, -1826, -2560, -2936, -2706, -2001, -1173, -170, 1446, 3773, 6390, 8947, 11369, 13614, 15619, 17441, 19085, 20435, 21480, 22312, 22924, 23296, 23565, 23730, 23473, 22631, 21496, 20326, 19076, 17743, 16478, 15330, 14355, 13957, 14413, 15415, 16529, 17832, 19601, 21680, 23688, 25469, 27048, 28378, 29405, 30189, 30791, 31199, 31367, 31296, 30985, 30435, 29652, 28659, 27447, 25947, 24114, 22042, 19955, 18050, 16367, 14767, 13137, 11611, 10544, 10130, 10185, 10427, 10822, 11474, 12325, 13227, 14111, 14896, 15399, 15489, 15270, 14918, 14390, 13510, 12241, 10745, 9144, 7388, 5444, 3430, 1482, -398, -2274, -4123, -5834, -7286, -8410, -9258, -9923, -10419, -10666, -10631, -10346, -9839, -9194, -8530, -7825, -6961, -6107, -5592, -5360, -5072, -4768, -4852, -5345, -5809, -6087, -6462, -7040, -7531, -7816, -8173, -8774, -9336, -9582, -9717, -10067, -10531, -10780, -10804, -10800, -10709, -10299, -9625, -8968, -8375, -7604, -6512, -5263, -4097, -3054, -2024, -992, -75, 718, 1548, 2404, 2989, 3190, 3351, 3736, 4087, 4086, 3870, 3658, 3323, 2722, 2086, 1639, 1194, 506, -279, -810, -1009, -1083, -1156, -1105, -785, -280, 217, 716, 1375, 2155, 2769, 3080, 3290, 3571, 3781, 3714, 3419, 3044, 2579, 1947, 1212, 495, -234, -1117, -2178, -3263, -4244, -5168, -6145, -7156, -8069, -8805, -9380, -9787, -9985, -10042, -10076, -10042, -9821, -9495, -9274, -9166, -9053, -8990, -9095, -9258, -9344, -9453, -9724, -10054, -10319, -10611, -11037, -11509, -11919, -12357, -12951, -13631, -14215, -14647, -15033, -15403, -15674, -15784, -15769, -15630, -15311, -14838, -14323, -13817, -13257, -12615, -11984, -11465, -11023, -10572, -10114, -9758, -9552, -9410, -9234, -9070, -9044, -9201, -9442, -9618, -9704, -9799, -9990, -10258, -10477, -10515, -10320, -9996, -9758, -9645, -9413, -8860, -8140, -7534, -7051, -6561, -6105, -5766, -5461, -5136, -4960, -5063, -5282, -5406, -5452, -5570, -5777, -5981, -6139, -6285, -6412, -6475, -6494, -6545, -6634, -6706, -6740, -6751, -6713, -6603, -6459, -6301, -6133, -5999, -5900, -5708, -5423, -5304, -5423, -5424, -5095, -4802, -4915, -5179, -5105, -4651, -4133, -3755, -3528, -3423, -3369, -3226, -2965, -2791, -2920, -3271, -3523, -3467, -3192, -2889, -2637, -2436, -2313, -2240, -2062, -1673, -1220, -945, -868, -796, -634, -466, -301, 0, 475, 908, 1037, 854, 645, 687, 904, 903, 443, -246, -748, -910, -804, -442, 260, 1350, 2784, 4536, 6607, 9012, 11720, 14516, 17029, 19061, 20663, 21900, 22808, 23568, 24299, 24693, 24393, 23571, 22669, 21768, 20774, 19768, 18734, 17474, 16096, 15135, 14825, 14960, 15472, 16564, 18173, 19971, 21861, 23930, 26064, 27975, 29507, 30645, 31413, 31876, 32151, 32270, 32183, 31842, 31199, 30201, 28877, 27260, 25303, 23080, 20889, 18921, 17053, 15201, 13665, 12765, 12369, 12192, 12224, 12637, 13456, 14510, 15589, 16550, 17432, 18391, 19349, 19942, 19899, 19286, 18247, 16820, 15063, 13028, 10655, 7927, 5101, 2476, 126, -1978, -3762, -5165, -6261, -7069, -7498, -7546, -7402, -7199, -6875, -6338, -5671, -5054, -4552, -4101, -3681, -3383, -3301, -3432, -3743, -4266, -5024, -5954, -6998, -8167, -9423, -10557, -11417, -12112, -12761, -13248, -13440, -13442, -13399, -13244, -12910, -12549, -12310, -12085, -11722, -11298, -10981, -10723, -10324, -9728, -9080, -8453, -7762, -6951, -6078, -5176, -4256, -3416, -2741, -2190, -1705, -1372, -1300, -1419, -1593, -1829, -2200, -2660, -3071, -3436, -3850, -4254, -4472, -4514, -4531, -4475, -4159, -3634, -3094, -2477, -1572, -443, 659, 1664, 2630, 3485, 4110, 4544, 4827, 4816, 4342, 3475, 2446, 1369, 203, -1042, -2269, -3425, -4508, -5398, -5958, -6228, -6318, -6199, -5844, -5397, -4954, -4436, -3835, -3354, -3101, -2976, -2926, -3066, -3425, -3858, -4304, -4925, -5830, -6877, -7864, -8796, -9809, -10887, -11882, -12712, -13388, -13871, -14124, -14231, -14290, -14240, -13978, -13583, -13276, -13132, -13013, -12828, -12676, -12653, -12710, -12759, -12857, -13063, -13291, -13430, -13509, -13613, -13689, -13625, -13470, -13401, -13428, -13377, -13182, -13020, -13035, -13139, -13164, -13067, -12909, -12718, -12506, -12277, -12032, -11750, -11418, -11073, -10785, -10577, -10372, -10078, -9736, -9468, -9301, -9119, -8868, -8617, -8449, -8364, -8359, -8422, -8509, -8588, -8710, -8934, -9203, -9406, -9500, -9509, -9463, -9349, -9076, -8551, -7833, -7110, -6435, -5680, -4790, -3882, -3086, -2445, -2014, -1809, -1697, -1550, -1492, -1714, -2151, -2532, -2740, -2917, -3215, -3612, -3962, -4165, -4228, -4177, -3990, -3672, -3323, -2953, -2392, -1548, -641, 97, 748, 1432, 1977, 2173, 2170, 2221, 2241, 1959, 1402, 855, 402, -104, -617, -897, -1005, -1269, -1623, -1565, -1026, -569, -478, -269, 511, 1585, 2382, 2829, 3291, 3983, 4777, 5451, 5900, 6039, 5799, 5314, 4944, 4878, 4848, 4470, 3869, 3617, 4126, 5356, 7068, 9024, 10947, 12764, 14736, 17044, 19349, 21203, 22543, 23510, 24117, 24400, 24534, 24578, 24402, 23972, 23424, 22828, 22132, 21397, 20763, 20233, 19652, 19053, 18797, 19185, 20105, 21225, 22404, 23661, 24951, 26192, 27418, 28631, 29644, 30229, 30411, 30417, 30431, 30414, 30122, 29379, 28221, 26813, 25244, 23560, 21898, 20352, 18844, 17376, 16229, 15651, 15529, 15635, 15906, 16346, 16820, 17236, 17650, 18090, 18449, 18639, 18660, 18529, 18307, 17978, 17339, 16184, 14634, 12957, 11153, 9035, 6695, 4461, 2461, 530, -1303, -2684, -3402, -3734, -4046, -4285, -4200, -3829, -3406, -2984, -2515, -2097, -1820, -1640, -1555, -1703, -2116, -2647, -3264, -4088, -5143, -6291, -7424, -8530, -9589, -10537, -11357, -12079, -12716, -13215, -13533, -13667, -13644, -13479, -13200, -12873, -12540, -12172, -11726, -11253, -10881, -10658, -10500, -10334, -10170, -10012, -9836, -9638, -9449, -9206, -8826, -8371, -8008, -7800, -7686, -7626, -7629, -7733, -8004, -8447, -8887, -9113, -9124, -9122, -9190, -9183, -8950, -8513, -8014, -7554, -7124, -6632, -6005, -5266, -4523, -3886, -3350, -2837, -2334, -1925, -1701, -1667, -1800, -2103, -2568, -3155, -3818, -4523, -5234, -5921, -6590, -7230, -7783, -8158, -8262, -8068, -7673, -7241, -6818, -6268, -5486, -4611, -3910, -3507, -3306, -3169, -3084, -3155, -3449, -3897, -4378, -4891, -5562, -6425, -7359, -8263, -9162, -10094, -10971, -11670, -12159, -12474, -12633, -12616, -12438, -12146, -11765, -11288, -10743, -10225, -9821, -9509, -9211, -8919, -8713, -8656, -8730, -8894, -9106, -9339, -9621, -10037, -10559, -11002, -11283, -11563, -11980, -12423, -12722, -12900, -13071, -13221, -13279, -13231, -13110, -12908, -12611, -12201, -11678, -11097, -10536, -10050, -9637, -9287, -9015, -8822, -8689, -8608, -8613, -8738, -8949, -9158, -9325, -9504, -9781, -10135, -10451, -10667, -10843, -11039, -11199, -11197, -11008, -10740, -10466, -10126, -9640, -9037, -8365, -7581, -6650, -5656, -4717, -3875, -3123, -2487, -1963, -1515, -1172, -1049, -1175, -1406, -1570, -1667, -1818, -2078, -2356, -2558, -2716, -2895, -3051, -3099, -3068, -3029, -2877, -2432, -1760, -1107, -489, 327, 1390, 2430, 3228, 3846, 4418, 4975, 5449, 5764, 5898, 5914, 5842, 5607, 5185, 4744, 4453, 4233, 3884, 3374, 2834, 2414, 2210, 2237, 2398, 2602, 2886, 3328, 3944, 4753, 5790, 6905, 7843, 8573, 9296, 10084, 10840, 11544, 12195, 12576, 12444, 11858, 11065, 10183, 9219, 8177, 7046, 5862, 4858, 4356, 4461, 5078, 6090, 7451, 9135, 11101, 13220, 15218, 16878, 18263, 19518, 20560, 21175, 21327, 21166, 20803, 20246, 19493, 18586, 17601, 16649, 15763, 14872, 13964, 13181, 12638, 12345, 12336, 12652, 13179, 13786, 14638, 15956, 17593, 19095, 20289, 21399, 22606, 23806, 24757, 25343, 25551, 25370, 24797, 23914, 22868, 21711, 20372, 18808, 17192, 15789, 14725, 13948, 13409, 13116, 13055, 13179, 13484, 13972, 14585, 15244, 15891, 16478, 16985, 17455, 17936, 18321, 18415, 18151, 17665, 17050, 16193, 14985, 13533, 12048, 10529, 8849, 7085, 5559, 4465, 3666, 2966, 2407, 2122, 2085, 2162, 2354, 2723, 3139, 3400, 3495, 3538, 3531, 3370, 3018, 2477, 1755, 971, 255, -468, -1381, -2430, -3389, -4155, -4806, -5450, -6144, -6828, -7291, -7434, -7480, -7626, -7694, -7479, -7144, -6901, -6658, -6326, -6118, -6190, -6362, -6490, -6723, -7200, -7783, -8270, -8624, -8904, -9109, -9180, -9103, -9021, -9102, -9276, -9259, -9000, -8820, -8911, -9091, -9185, -9288, -9441, -9443, -9232, -9045, -9015, -8929, -8582, -8097, -7724, -7513, -7345, -7182, -7156, -7362, -7691, -7945, -8076, -8190, -8330, -8430, -8496, -8608, -8724, -8734, -8693, -8739, -8828, -8816, -8749, -8766, -8799, -8667, -8389, -8158, -8063, -8040, -7982, -7829, -7582, -7340, -7224, -7270, -7400, -7516, -7604, -7732, -7999, -8470, -9098, -9714, -10134, -10372, -10623, -10993, -11348, -11532, -11569, -11575, -11579, -11515, -11286, -10844, -10301, -9847, -9510, -9154, -8820, -8773, -9111, -9564, -9831, -9889, -9901, -10022, -10316, -10680, -10848, -10646, -10255, -10047, -10235, -10697, -11144, -11353, -11285, -11067, -10891, -10895, -11046, -11168, -11095, -10788, -10287, -9619, -8833, -8116, -7724, -7756, -8058, -8430, -8801, -9174, -9518, -9780, -9890, -9793, -9618, -9669, -10028, -10369, -10375, -10120, -9886, -9762, -9670, -9503, -9143, -8522, -7748, -7018, -6383, -5782, -5286, -5076, -5224, -5564, -5871, -6057, -6160, -6213, -6193, -6125, -6110, -6215, -6384, -6563, -6780, -6953, -6795, -6153, -5284, -4546, -3951, -3299, -2590, -1983, -1535, -1226, -1099, -1172, -1359, -1571, -1809, -2014, -1998, -1683, -1285, -1073, -1018, -838, -453, -138, -131, -249, -78, 518, 1296, 1940, 2332, 2477, 2461, 2478, 2718, 3152, 3590, 3904, 4067, 4074, 4015, 4057, 4214, 4317, 4306, 4298, 4367, 4459, 4621, 4983, 5534, 6092, 6545, 6945, 7330, 7601, 7652, 7529, 7348, 7143, 6880, 6589, 6411, 6474, 6822, 7418, 8159, 8861, 9365, 9719, 10131, 10664, 11100, 11230, 11061, 10713, 10288, 9949, 9831, 9847, 9826, 9812, 9944, 10157, 10298, 10395, 10539, 10702, 10838, 11087, 11552, 12089, 12431, 12491, 12383, 12250, 12179, 12228, 12416, 12630, 12733, 12716, 12693, 12714, 12784, 12927, 13122, 13247, 13265, 13303, 13443, 13565, 13519, 13353, 13193, 13045, 12853, 12668, 12567, 12495, 12374, 12332, 12553, 12954, 13251, 13357, 13435, 13547, 13574, 13459, 13296, 13163, 13038, 12908, 12766, 12580, 12354, 12158, 12060, 12010, 11910, 11737, 11568, 11438, 11306, 11153, 11000, 10829, 10621, 10426, 10291, 10180, 10051, 9971, 9972, 9971, 9902, 9792, 9642, 9405, 9120, 8900, 8742, 8519, 8167, 7779, 7469, 7240, 6995, 6651, 6207, 5727, 5293, 4970, 4795, 4739, 4720, 4667, 4574, 4445, 4240, 3935, 3593, 3281, 2968, 2593, 2200, 1886, 1665, 1477, 1267, 1037, 829, 696, 602, 396, 0, -474, -880, -1209, -1519, -1796, -2003, -2204, -2490, -2826, -3088, -3266, -3477, -3767, -4042, -4248, -4445, -4639, -4722, -4667, -4614, -4678, -4806, -4906, -5043, -5309, -5649, -5938, -6191, -6479, -6721, -6802, -6846, -7101, -7561, -7955, -8130, -8197, -8307, -8437, -8487, -8426, -8301, -8159, -8024, -7941, -7970, -8111, -8292, -8469, -8684, -9011, -9428, -9831, -10120, -10315, -10508, -10755, -11021, -11221, -11318, -11369, -11448, -11542, -11566, -11444, -11170, -10801, -10432, -10169, -10093, -10199, -10419, -10677, -10942, -11242, -11616, -12065, -12518, -12862, -13066, -13209, -13384, -13515, -13470, -13266, -13072, -12994, -12951, -12855, -12748, -12717, -12741, -12734, -12671, -12625, -12655, -12739, -12812, -12872, -12944, -13002, -12998, -12971, -12995, -12995, -12830, -12541, -12284, -12042, -11655, -11148, -10719, -10426, -10171, -9956, -9924, -10117, -10399, -10639, -10841, -11056, -11259, -11341, -11237, -10996, -10691, -10311, -9832, -9330, -8903, -8520, -8067, -7561, -7147, -6884, -6643, -6319, -6015, -5907, -6001, -6158, -6299, -6408, -6415, -6266, -6051, -5844, -5581, -5203, -4810, -4467, -4087, -3633, -3236, -2993, -2836, -2674, -2484, -2261, -2033, -1833, -1610, -1265, -876, -680, -757, -890, -841, -604, -320, -32, 312, 684, 949, 1046, 1088, 1226, 1490, 1794, 2077, 2335, 2564, 2788, 3083, 3440, 3653, 3583, 3412, 3372, 3370, 3230, 3076, 3124, 3300, 3442, 3611, 3884, 4142, 4292, 4456, 4728, 5005, 5189, 5363, 5621, 5882, 5997, 5943, 5809, 5655, 5495, 5374, 5353, 5408, 5454, 5469, 5519, 5654, 5841, 6051, 6290, 6523, 6674, 6775, 6968, 7253, 7437, 7428, 7352, 7277, 7125, 6942, 6919, 7061, 7155, 7126, 7100, 7144, 7192, 7229, 7295, 7354, 7342, 7314, 7376, 7542, 7725, 7850, 7926, 7993, 8058, 8079, 8029, 7959, 7928, 7945, 7986, 8037, 8062, 7999, 7876, 7798, 7808, 7859, 7972, 8221, 8544, 8752, 8782, 8751, 8766, 8808, 8793, 8655, 8405, 8174, 8107, 8171, 8174, 8032, 7875, 7861, 8002, 8196, 8347, 8451, 8585, 8765, 8869, 8778, 8565, 8373, 8220, 8006, 7726, 7453, 7220, 7019, 6859, 6766, 6739, 6763, 6826, 6869, 6818, 6677, 6547, 6490, 6435, 6287, 6095, 5991, 5992, 5984, 5903, 5819, 5807, 5817, 5747, 5592, 5431, 5321, 5233, 5097, 4876, 4580, 4287, 4064, 3888, 3690, 3502, 3450, 3544, 3635, 3616, 3556, 3534, 3482, 3285, 2966, 2657, 2411, 2178, 1959, 1827, 1816, 1888, 2007, 2153, 2276, 2358, 2457, 2586, 2635, 2530, 2343, 2160, 1939, 1602, 1181, 793, 508, 309, 161, 68, 64, 163, 339, 536, 702, 818, 888, 899, 801, 550, 206, -71, -217, -367, -635, -909, -1039, -1088, -1167, -1222, -1182, -1136, -1143, -1128, -1108, -1223, -1458, -1666, -1849, -2103, -2343, -2398, -2331, -2339, -2413, -2393, -2275, -2229, -2308, -2359, -2289, -2217, -2282, -2439, -2590, -2755, -2984, -3257, -3559, -3927, -4317, -4602, -4731, -4765, -4743, -4646, -4495, -4380, -4380, -4479, -4530, -4410, -4216, -4166, -4254, -4260, -4188, -4331, -4765, -5174, -5348, -5440, -5612, -5785, -5885, -5974, -6113, -6286, -6492, -6734, -6944, -7045, -7010, -6821, -6471, -6049, -5719, -5544, -5430, -5259, -5075, -5035, -5226, -5592, -6024, -6438, -6778, -7026, -7208, -7331, -7338, -7204, -6982, -6753, -6574, -6466, -6371, -6181, -5914, -5731, -5683, -5605, -5428, -5377, -5650, -6120, -6512, -6767, -7000, -7225, -7288, -7078, -6684, -6298, -6036, -5878, -5738, -5535, -5266, -5032, -4992, -5194, -5486, -5662, -5689, -5700, -5797, -5942, -6066, -6166, -6261, -6338, -6373, -6345, -6193, -5847, -5334, -4808, -4439, -4284, -4303, -4424, -4566, -4684, -4840, -5122, -5429, -5538, -5431, -5356, -5433, -5461, -5223, -4790, -4406, -4208, -4164, -4172, -4167, -4142, -4066, -3851, -3496, -3204, -3188, -3393, -3563, -3597, -3642, -3827, -4042, -4051, -3778, -3357, -2971, -2666, -2401, -2170, -2022, -1973, -1958, -1902, -1793, -1679, -1587, -1487, -1331, -1107, -859, -641, -478, -337, -173, -54, -165, -562, -994, -1172, -1117, -1047, -972, -681, -64, 741, 1509, 2073, 2380, 2499, 2541, 2518, 2344, 2012, 1636, 1319, 1064, 851, 726, 809, 1185, 1776, 2386, 2869, 3200, 3322, 3173, 2901, 2795, 2878, 2884, 2719, 2617, 2726, 2894, 2953, 2953, 3009, 3162, 3431, 3815, 4222, 4528, 4753, 5008, 5219, 5142, 4737, 4315, 4119, 4026, 3871, 3778, 3906, 4146, 4297, 4374, 4510, 4724, 4944, 5141, 5307, 5367, 5299, 5245, 5344, 5502, 5541, 5502, 5537, 5592, 5482, 5215, 5017, 5063, 5366, 5798, 6141, 6240, 6171, 6151, 6256, 6395, 6474, 6481, 6401, 6221, 5987, 5786, 5636, 5498, 5406, 5467, 5681, 5903, 6047, 6176, 6296, 6318, 6231, 6099, 5889, 5552, 5246, 5175, 5264, 5264, 5150, 5109, 5189, 5218, 5099, 4969, 5012, 5200, 5311, 5207, 4964, 4748, 4615, 4517, 4429, 4363, 4307, 4220, 4082, 3858, 3507, 3112, 2877, 2905, 3062, 3179, 3246, 3346, 3483, 3581, 3555, 3370, 3091, 2825, 2606, 2419, 2317, 2343, 2368, 2252, 2078, 1993, 1922, 1707, 1441, 1334, 1381, 1402, 1372, 1448, 1676, 1882, 1867, 1635, 1369, 1188, 1026, 760, 425, 244, 388, 749, 1015, 1018, 879, 757, 630, 445, 288, 251, 259, 193, 105, 141, 309, 483, 609, 712, 717, 503, 146, -89, -110, -91, -159, -209, -129, 23, 161, 316, 518, 655, 579, 265, -223, -810, -1337, -1529, -1256, -743, -327, -25, 410, 966, 1229, 917, 294, -237, -689, -1274, -1844, -1992, -1633, -1114, -717, -407, -132, -44, -253, -605, -891, -1137, -1459, -1770, -1863, -1720, -1503, -1274, -949, -537, -207, -57, -18, -88, -433, -1082, -1790, -2344, -2768, -3058, -3019, -2534, -1753, -932, -255, 191, 409, 417, 84, -737, -1882, -2926, -3628, -4051, -4230, -4036, -3394, -2420, -1316, -301, 388, 582, 276, -394, -1248, -2082, -2730, -3155, -3456, -3693, -3713, -3317, -2584, -1898, -1538, -1397, -1201, -920, -845, -1253, -2025, -2706, -3022, -3203, -3567, -3966, -3983, -3591, -3175, -2961, -2805, -2546, -2211, -1879, -1598, -1473, -1637, -2125, -2817, -3482, -3897, -3961, -3705, -3213, -2590, -2041, -1807, -1969, -2345, -2674, -2872, -3054, -3306, -3532, -3556, -3324, -2976, -2711, -2611, -2580, -2512, -2510, -2810, -3375, -3773, -3617, -3021, -2426, -2062, -1837, -1724, -1928, -2536, -3282, -3861, -4271, -4591, -4611, -4033, -2975, -1973, -1469, -1449, -1604, -1688, -1713, -1864, -2265, -2833, -3325, -3498, -3282, -2861, -2527, -2363, -2163, -1775, -1403, -1366, -1714, -2224, -2659, -2888, -2882, -2655, -2133, -1231, -230, 245, -57, -658, -1057, -1452, -2272, -3274, -3719, -3378, -2750, -2179, -1411, -320, 635, 1069, 1174, 1117, 622, -416, -1570, -2470, -3136, -3534, -3455, -2893, -2024, -880, 504, 1723, 2218, 1858, 1046, 274, -331, -1007, -1919, -2776, -3058, -2611, -1782, -949, -199, 546, 1331, 2077, 2491, 2185, 1126, -204, -1316, -2098, -2553, -2511, -1912, -1041, -237, 487, 1341, 2324, 2990, 2725, 1444, -69, -863, -834, -724, -1045, -1435, -1246, -408, 572, 1306, 1853, 2372, 2712, 2529, 1721, 617, -246, -523, -278, 162, 586, 1080, 1776, 2484, 2798, 2620, 2288, 2029, 1625, 906, 213, -13, 163, 386, 575, 940, 1566, 2329, 3070, 3604, 3684, 3226, 2546, 2064, 1787, 1370, 755, 393, 616, 1113, 1394, 1538, 2029, 2896, 3518, 3463, 3058, 2803, 2557, 1777, 473, -540, -491, 496, 1642, 2451, 3149, 4063, 4868, 4815, 3635, 1931, 577, -25, -59, 168, 587, 1294, 2242, 3132, 3585, 3459, 2944, 2346, 1806, 1336, 1029, 1016, 1208, 1415, 1697, 2175, 2563, 2409, 1856, 1574, 1847, 2259, 2342, 2112, 1867, 1776, 1834, 1943, 1971, 1814, 1475, 1107, 887, 856, 915, 1022, 1273, 1697, 2097, 2268, 2275, 2327, 2420, 2351, 2120, 2016, 2119, 1968, 1171, 116, -459, -399, -48, 476, 1226, 1884, 2070, 1961, 2009, 2279, 2511, 2498, 2146, 1577, 1254, 1539, 2099, 2230, 1743, 1136, 960, 1284, 1691, 1677, 1199, 822, 1099, 1824, 2204, 1787, 962, 431, 425, 651, 845, 1106, 1592, 2096, 2199, 1799, 1245, 875, 652, 350, -109, -581, -788, -527, 85, 670, 1050, 1333, 1410, 893, -172, -1063, -1230, -838, -284, 311, 888, 1245, 1287, 1167, 1018, 778, 364, -102, -322, -77, 528, 1127, 1391, 1228, 669, -301, -1610, -2781, -3053, -2106, -522, 750, 1274, 1226, 894, 452, 28, -367, -889, -1518, -1862, -1570, -861, -297, -127, -201, -491, -1164, -2012, -2380, -1922, -1006, -156, 505, 1008, 1200, 1015, 789, 844, 938, 622, -12, -552, -998, -1526, -1874, -1855, -1927, -2286, -2164, -1062, 290, 1138, 1663, 1988, 1575, 328, -918, -1587, -1968, -2402, -2716, -2632, -2139, -1482, -1036, -934, -782, -111, 853, 1316, 779, -510, -1939, -2999, -3426, -3215, -2660, -2250, -2314, -2665, -2709, -1965, -565, 702, 986, 257, -602, -975, -1365, -2366, -3396, -3439, -2573, -1725, -1345, -1253, -1264, -1200, -826, -331, -268, -736, -1256, -1611, -2106, -2874, -3590, -4047, -4460, -4917, -4898, -3764, -1660, 462, 1837, 2512, 2744, 2207, 484, -1874, -3614, -4199, -4281, -4540, -4732, -4211, -2885, -1305, -22, 837, 1442, 1882, 1980, 1425, 126, -1532, -2936, -3783, -4146, -4072, -3507, -2651, -1808, -901, 198, 982, 745, -290, -1169, -1534, -1840, -2079, -1437, 103, 926, -134, -1807, -2041, -984, -479, -1162, -1954, -2059, -1771, -1480, -1203, -856, -269, 650, 1483, 1585, 861, -224, -1176, -1609, -1416, -1042, -942, -883, -632, -694, -1149, -750, 1159, 2815, 2001, -869, -3242, -3411, -1921, -547, -530, -1353, -1296, 381, 2419, 3306, 2967, 1967, 326, -1891, -3804, -4425, -3605, -2006, -591, -3, 81, 623, 1834, 2749, 2611, 1910, 1557, 1633, 1414, 365, -1176, -2193, -1918, -656, 527, 1016, 1263, 1901, 2573, 2260, 758, -803, -1234, -551, 363, 937, 1284, 1689, 2156, 2355, 1834, 477, -1048, -1635, -989, -203, -328, -725, 65, 2034, 3669, 4082, 3782, 3370, 2782, 1826, 516, -917, -1858, -1735, -905, -285, 19, 745, 1997, 2830, 2614, 1922, 1626, 1715, 1490, 691, -89, -140, 499, 1157, 1332, 1092, 806, 855, 1455, 2243, 2345, 1472, 490, 73, -374, -1385, -1990, -1073, 698, 1774, 1852, 1836, 2192, 2491, 2261, 1504, 542, -259, -685, -783, -760, -710, -447, 311, 1442, 2189, 1950, 1310, 1600, 3095, 4399, 4096, 2384, 527, -731, -1566, -2343, -3178, -4005, -4359, -3242, -101, 3944, 6787, 7496, 6911, 5956, 4468, 2048, -954, -3704, -5410, -5574, -4328, -2360, -139, 2300, 4674, 6307, 6689, 5569, 3009, 46, -1738, -2066, -2014, -1795, -497, 1537, 2538, 2061, 1534, 1647, 1499, 648, -7, 245, 1034, 1756, 2322, 2836, 3084, 2522, 843, -1405, -3021, -3233, -2348, -1147, 76, 1550, 3235, 4372, 4071, 2408, 659, 32, 272, 98, -929, -1755, -1362, -205, 521, 573, 694, 1168, 1348, 842, 234, 174, 552, 1013, 1523, 1820, 1115, -852, -2879, -3320, -1917, 41, 1439, 2436, 3598, 4675, 4851, 3794, 1996, 196, -1415, -3346, -5699, -7110, -5904, -2399, 1312, 3897, 5506, 6180, 5546, 3987, 2351, 680, -1252, -2666, -2552, -1226, 13, 379, -21, -780, -1533, -2004, -2045, -1556, -378, 1423, 3208, 4016, 3427, 2015, 734, -71, -753, -1547, -2175, -2473, -2733, -2845, -1706, 1425, 5188, 6941, 5534, 2345, -593, -2628, -4379, -6268, -7652, -7258, -4391, 144, 4324, 6313, 5801, 3958, 2075, 447, -1424, -3761, -5932, -6922, -6167, -3923, -1063, 1351, 2630, 2928, 2976, 3212, 3426, 3126, 1694, -1345, -5216, -7746, -7641, -6017, -4294, -1999, 1576, 5117, 6696, 6218, 4876, 3275, 1271, -1269, -4222, -6999, -8566, -8325, -6624, -3906, -259, 3660, 6348, 6829, 5714, 4384, 3431, 1994, -1344, -6559, -11109, -11914, -8682, -4253, -1298, 289, 2181, 4890, 7266, 8188, 7573, 5721, 2863, -419, -3314, -5562, -7299, -8268, -8074, -6708, -4050, 184, 4968, 7788, 7215, 4586, 2124, 447, -1254, -3581, -6196, -8087, -8108, -5666, -1344, 3324, 6795, 8203, 7293, 4290, 229, -3144, -4675, -4880, -5183, -6234, -7294, -6892, -4005, 797, 5366, 7760, 7699, 5891, 3050, 237, -1430, -2367, -4161, -6921, -8717, -8223, -6087, -3377, -495, 2153, 4058, 5476, 7015, 8106, 7087, 3274, -1955, -6611, -9779, -11234, -10435, -7188, -2850, 604, 2787, 4829, 6874, 7086, 4082, -733, -4477, -5748, -5225, -3994, -2615, -1492, -840, -230, 867, 2021, 2175, 1191, 104, -420, -933, -1970, -2880, -2830, -2309, -2511, -3438, -3800, -2802, -835, 1670, 4582, 6808, 6441, 3227, -358, -1827, -1604, -2016, -3960, -6009, -6609, -5583, -3365, -407, 2295, 3800, 4543, 5251, 4883, 2024, -2160, -4952, -5530, -5071, -4354, -3239, -1461, 1294, 4734, 6932, 5905, 2449, -463, -1017, 211, 1673, 2000, 558, -1905, -3728, -4217, -4227, -4291, -3232, 125, 4452, 6739, 5758, 3192, 1149, 147, -314, -852, -1885, -2788, -1969, 703, 2845, 2478, 454, -1389, -2500, -2671, -1103, 1953, 4269, 3831, 1181, -1218, -1619, -789, -978, -2830, -4208, -3130, -510, 1645, 3310, 5381, 6926, 6100, 3073, -104, -2036, -2887, -3369, -3808, -3831, -2770, -797, 919, 1680, 1882, 1842, 1558, 1735, 3058, 4417, 3941, 1536, -1385, -3759, -4726, -3313, -260, 1588, 580, -1513, -1976, -316, 2067, 3880, 4521, 3793, 2072, 316, -761, -1166, -868, 683, 3429, 5418, 4144, -295, -4536, -5541, -3951, -2391, -1441, 443, 3797, 7493, 10546, 12013, 10279, 5161, -625, -4607, -7311, -9699, -10213, -6907, -831, 4609, 6719, 5345, 2723, 1580, 2568, 3786, 3308, 1410, -302, -1037, -957, 107, 2360, 4357, 3775, 655, -2113, -2304, -369, 2353, 4800, 5357, 2852, -1212, -3904, -4227, -3220, -1526, 747, 2468, 2206, 565, -7, 1856, 4809, 6473, 5830, 3414, 195, -2788, -4419, -4266, -3126, -2214, -1993, -1897, -862, 1565, 4220, 5082, 3671, 1934, 1918, 3156, 3197, 558, -3437, -5888, -5295, -3082, -1860, -2154, -1432, 2814, 9135, 12556, 9799, 2966, -3090, -5717, -5488, -3995, -2578, -2036, -1914, -917, 1150, 3087, 4228, 5010, 5333, 4168, 1385, -1484, -2997, -3341, -3430, -3198, -1707, 1134, 3923, 5177, 4790, 3662, 2274, 247, -2746, -6047, -8318, -8659, -7143, -4295, -602, 3281, 6357, 7854, 7887, 6973, 4958, 1373, -2798, -5169, -4879, -3940, -4213, -4673, -3530, -1362, 126, 1047, 2560, 3951, 3057, -300, -3413, -3902, -2236, -382, 457, 41, -1261, -1992, -539, 2494, 4348, 3338, 616, -1750, -2990, -3373, -3213, -3062, -3683, -4719, -4273, -1111, 3442, 7028, 8723, 8556, 5820, 154, -6269, -10105, -10596, -9956, -9452, -7343, -1997, 4896, 9958, 11435, 9312, 4125, -2264, -6440, -6329, -3557, -1301, -569, -65, 997, 1748, 1242, -408, -2695, -4980, -6030, -4977, -2740, -769, 1170, 3922, 6498, 6956, 4966, 1594, -2393, -6258, -8518, -8168, -5894, -3086, -457, 1801, 3190, 2749, 53, -3280, -4192, -1809, 1057, 2144, 3055, 5355, 6641, 4444, 671, -1862, -3859, -6781, -9230, -9223, -6982, -3528, 511, 3758, 4704, 4036, 3806, 4081, 2834, -447, -3335, -3793, -3028, -3151, -3396, -1223, 3350, 6867, 6015, 947, -4684, -6738, -4585, -1927, -2390, -5014, -5958, -3735, -419, 1944, 3602, 5304, 6337, 5704, 3968, 2268, 391, -2467, -5849, -8435, -9367, -8240, -5412, -2488, -258, 2895, 7479, 10020, 7916, 4124, 2387, 1480, -1191, -4536, -6377, -6827, -6209, -3980, -905, 1837, 5069, 9083, 10896, 7988, 1982, -4215, -9252, -11839, -10940, -8376, -6846, -5499, -1512, 5091, 11655, 16016, 16690, 12565, 4968, -2297, -6535, -7998, -8000, -7564, -7794, -9177, -10070, -7651, -1121, 6874, 12383, 13342, 10618, 6818, 4524, 4543, 4930, 2672, -2920, -9373, -13700, -14446, -11443, -5706, 454, 5186, 8644, 11526, 13282, 13195, 11700, 9078, 4412, -2625, -10026, -14579, -14282, -9508, -2579, 3753, 7804, 9001, 7139, 2722, -2226, -5252, -5812, -5510, -5522, -4707, -1137, 4997, 11054, 14347, 13933, 10530, 5849, 1421, -2861, -7848, -12000, -11878, -7270, -2658, -1492, -2120, -1518, 202, 1374, 2193, 4157, 7345, 9708, 9042, 5745, 2814, 1749, 72, -4325, -8721, -9347, -6938, -4349, -1933, 571, 1612, 1022, 1334, 3226, 4367, 4134, 4265, 4414, 2514, -434, -1065, 809, 1823, 526, -643, 207, 1371, 873, 89, 1256, 3544, 4556, 3789, 2203, 554, -325, -256, -791, -2296, -1428, 3978, 9690, 9835, 4655, -1080, -4879, -7500, -9313, -9274, -6484, -878, 6557, 13231, 16000, 14001, 9518, 5001, 495, -4514, -8507, -9857, -9626, -9203, -6953, -1158, 5380, 8003, 6514, 5051, 6015, 7294, 5787, 1514, -2621, -4141, -3108, -1207, 312, 1311, 1959, 2031, 1372, 741, 1129, 1810, 422, -3860, -8472, -10026, -7486, -2053, 4260, 9046, 10601, 9552, 7810, 5826, 2658, -1592, -5360, -7379, -7581, -6801, -6045, -5116, -2366, 2491, 6391, 6184, 2856, 114, -86, 1393, 2695, 2275, 24, -2146, -2480, -1793, -1867, -2825, -4007, -5225, -5209, -1892, 3717, 7220, 6300, 3492, 2044, 1886, 1031, -1328, -4406, -6928, -7679, -6123, -3315, -1214, -293, 923, 2985, 3967, 2535, 704, 1131, 3061, 3614, 2314, 1582, 2664, 3623, 2240, -1238, -5359, -9323, -12125, -12021, -8490, -2991, 2982, 8570, 12322, 12964, 11107, 7823, 2593, -4666, -10872, -12517, -10560, -9124, -8948, -6052, 1286, 8386, 10196, 7777, 5210, 4030, 3892, 4172, 2377, -3742, -11141, -14200, -12274, -8838, -5192, -1106, 1632, 2167, 3257, 6436, 8810, 7930, 5212, 2240, -1784, -7215, -12088, -14159, -12685, -8330, -2651, 2827, 7724, 12102, 14562, 12630, 5835, -2796, -9535, -13409, -15425, -15259, -11294, -3923, 3858, 9429, 11979, 11373, 8067, 3695, -431, -4613, -8977, -11752, -10840, -6098, 269, 4594, 4273, 921, -912, 375, 1645, 455, -1427, -1806, -1627, -2495, -3595, -3444, -2565, -2227, -2037, -1064, -150, -426, -628, 943, 3000, 3435, 3047, 3195, 2436, -313, -2699, -3128, -3979, -6675, -7834, -4216, 2097, 6504, 7114, 5146, 2433, 196, -970, -1159, -966, -847, -769, -601, -336, 314, 1797, 3534, 3831, 1880, -911, -2443, -2119, -994, -477, -1309, -2990, -3736, -1885, 1797, 4183, 3450, 1707, 2005, 3928, 4760, 3732, 1923, -637, -4092, -6471, -6126, -5219, -6926, -9834, -8654, -850, 9673, 16349, 16409, 12637, 8944, 5648, 432, -6954, -13199, -15257, -13787, -11341, -8251, -2574, 5752, 13000, 15182, 12267, 7359, 2717, -1575, -5334, -7061, -6103, -4408, -4440, -5907, -5975, -2539, 3568, 9256, 11455, 9302, 4782, 1018, -442, -496, -853, -2109, -3501, -3886, -2601, 238, 3708, 6495, 7808, 7683, 6202, 3137, -1115, -5305, -8611, -10905, -11429, -8951, -3878, 1570, 5822, 9018, 11443, 12483, 11402, 8094, 3054, -2493, -6691, -8506, -9197, -10929, -13360, -13122, -7847, 734, 8829, 13977, 15399, 13260, 9019, 4676, 920, -2411, -4640, -5161, -4882, -4614, -3623, -1569, 230, 1049, 1929, 3251, 3522, 1862, -321, -1345, -1408, -1599, -1934, -1683, -731, 771, 3254, 6423, 8125, 6678, 3481, 1144, -87, -2030, -5562, -9556, -11900, -10526, -4740, 3267, 9219, 10268, 7419, 3941, 1922, 1026, -67, -2242, -5493, -8460, -8803, -5658, -1291, 1384, 2238, 3177, 4755, 5370, 3558, 33, -2578, -2265, -76, 1100, 704, 1271, 3766, 4888, 1544, -4019, -6596, -4666, -1778, -1252, -2198, -1763, 815, 4037, 6539, 7919, 7925, 6441, 3912, 714, -3343, -7835, -10590, -9426, -5040, -538, 2138, 3665, 5022, 5856, 5719, 4874, 3205, 58, -4297, -8216, -9766, -7896, -3447, 744, 2269, 1868, 2075, 3401, 3929, 2514, 203, -1587, -2618, -3339, -3830, -3385, -1182, 2106, 3934, 2278, -1904, -5635, -6764, -5190, -2385, -575, -1095, -2940, -3972, -3352, -1532, 1024, 3376, 3951, 2764, 1918, 2388, 2643, 1576, 62, -1017, -1688, -1979, -2337, -3574, -4542, -2663, 1395, 3320, 1359, -1054, -650, 1575, 3036, 2913, 1643, -300, -2145, -2803, -1606, 1052, 3302, 2684, -999, -4471, -4491, -1869, -122, -916, -2547, -2393, 172, 2812, 2362, -1114, -3777, -3122, -1525, -2300, -4621, -5263, -3236, -149, 2214, 2860, 1845, 536, 206, 362, -68, -638, -229, 745, 788, -404, -1537, -1567, -809, -172, -447, -2357, -5563, -7441, -5205, 155, 4565, 5930, 5822, 5903, 5878, 5305, 4444, 3003, 475, -2210, -3315, -2528, -1220, -586, -394, 366, 1830, 2508, 915, -2077, -3737, -2668, -149, 2046, 3678, 5290, 6755, 7172, 5653, 2355, -894, -1980, -1015, -152, -587, -1407, -1489, -577, 1342, 3702, 4738, 3198, 133, -2348, -3206, -2460, -615, 1150, 1745, 1570, 1762, 2086, 1239, -798, -2301, -1917, -246, 963, 742, -116, -67, 1188, 2289, 1998, 683, -351, -190, 1136, 2376, 1624, -1486, -4535, -4821, -2647, -478, 581, 1611, 3492, 5550, 6814, 7028, 5948, 3241, -22, -1519, -737, -160, -1855, -4728, -6552, -6570, -5063, -2733, -1051, -719, 21, 2941, 6622, 8371, 7899, 6597, 4771, 1901, -1699, -5019, -7077, -7045, -4927, -2174, -333, 617, 1534, 2348, 2269, 1369, 826, 1451, 2510, 2453, 968, -217, 615, 2758, 3931, 3286, 1888, 481, -1262, -3125, -4054, -3903, -3768, -3978, -3135, 7, 4405, 7267, 6908, 4651, 3336, 3933, 4534, 3015, -300, -3365, -5000, -5624, -5748, -5117, -3658, -2105, -788, 1340, 5293, 9973, 12579, 11177, 6461, 1114, -2399, -3746, -4607, -6447, -8561, -8872, -6567, -3082, -87, 2387, 4742, 5900, 4566, 1635, -764, -1909, -2178, -1437, 146, 1236, 1182, 912, 754, -281, -2206, -3693, -4486, -5538, -6507, -5555, -1936, 2953, 7062, 9020, 8377, 5705, 2386, -374, -2384, -3969, -4999, -5175, -5032, -5526, -6433, -6375, -4848, -3077, -2166, -1397, 714, 4294, 7970, 10421, 10990, 9210, 5292, 879, -2330, -4557, -7016, -9626, -11232, -11216, -9459, -6020, -2051, 655, 1960, 3309, 4868, 5015, 3080, 534, -918, -906, -121, 380, -100, -1247, -2198, -2833, -3758, -5030, -5788, -5261, -3501, -1244, 558, 1393, 1622, 1921, 2274, 2065, 1030, -461, -1933, -3025, -3422, -3133, -2712, -2784, -3391, -3954, -3743, -2369, -132, 1976, 2952, 2792, 2630, 3371, 4364, 4068, 1936, -1090, -3874, -6004, -7506, -8342, -8137, -6211, -2497, 1621, 4457, 5888, 6743, 6856, 5466, 3079, 1067, -137, -920, -1192, -692, 74, 384, 265, 110, -219, -1305, -3291, -5273, -5691, -3819, -819, 1482, 2692, 3781, 5189, 6252, 6299, 5205, 3085, 466, -1631, -2576, -2717, -2611, -2338, -1947, -1773, -1941, -2075, -1632, -176, 2454, 5682, 8091, 8355, 6343, 3129, 11, -2426, -4356, -5833, -6127, -4449, -1295, 1731, 3468, 3819, 3078, 1695, 576, 401, 738, 772, 622, 992, 1906, 2672, 2815, 2435, 1891, 1521, 1394, 1241, 809, 93, -813, -1610, -1657, -750, 294, 866, 1724, 3590, 5385, 5537, 4293, 3092, 2336, 1298, -303, -1952, -3200, -3984, -4281, -4027, -3303, -2183, -567, 1451, 3256, 4228, 4499, 4569, 4406, 3653, 2414, 996, -679, -2510, -3589, -3140, -1683, -478, -159, -445, -803, -942, -880, -803, -731, -316, 852, 2727, 4654, 5767, 5650, 4713, 3719, 2845, 1535, -553, -2869, -4513, -5022, -4384, -2774, -629, 1414, 2939, 3915, 4400, 4310, 3497, 1955, 50, -1416, -1719, -989, -223, -229, -726, -824, -273, 353, 699, 1072, 1674, 2162, 2251, 2035, 1600, 1004, 548, 385, 140, -455, -1058, -1362, -1649, -2152, -2550, -2480, -1995, -1274, -414, 418, 1060, 1569, 2068, 2465, 2592, 2487, 2204, 1461, -89, -2117, -3585, -3811, -3211, -2650, -2352, -1848, -810, 418, 1145, 1104, 850, 1112, 1712, 1698, 703, -521, -1226, -1535, -1831, -2002, -1730, -1105, -597, -604, -1041, -1326, -942, -116, 441, 461, 360, 537, 890, 1163, 1284, 1181, 608, -545, -1967, -3203, -4134, -4843, -5104, -4403, -2598, -326, 1488, 2423, 2704, 2734, 2724, 2649, 2296, 1492, 509, -40, -57, -383, -1830, -3993, -5503, -5366, -3753, -1589, 313, 1762, 3017, 4186, 4845, 4382, 2759, 777, -526, -716, -131, 596, 1003, 905, 415, -102, -369, -544, -1071, -2037, -2828, -2577, -1015, 1182, 2995, 3965, 4374, 4541, 4261, 3064, 800, -2164, -5084, -7023, -7192, -5474, -2680, -74, 1434, 1737, 1326, 853, 731, 878, 885, 652, 778, 1890, 3631, 4707, 4089, 1946, -594, -2392, -2972, -2525, -1517, -312, 852, 1730, 2066, 1839, 1421, 1302, 1569, 1708, 1061, -494, -2390, -3856, -4428, -4089, -3253, -2695, -3022, -3891, -4069, -2652, -48, 2464, 4009, 4673, 4925, 4767, 3676, 1343, -1705, -4352, -5676, -5449, -3991, -1814, 385, 1669, 1375, -147, -1701, -2385, -2231, -1720, -1210, -877, -642, -61, 1169, 2629, 3600, 3899, 3793, 3296, 2122, 250, -1893, -3790, -5171, -6005, -6226, -5612, -4122, -2281, -801, 147, 866, 1370, 1279, 474, -686, -1822, -2745, -3264, -3216, -2660, -1782, -762, 122, 548, 458, 139, -199, -691, -1525, -2542, -3261, -3359, -3043, -2820, -2861, -2793, -2248, -1409, -777, -585, -691, -838, -859, -829, -1086, -1824, -2558, -2454, -1348, -127, 189, -461, -1262, -1506, -1210, -822, -769, -1285, -2337, -3569, -4560, -5176, -5481, -5430, -4843, -3525, -1406, 1163, 3303, 4302, 4286, 3809, 3014, 1761, 203, -1344, -2758, -3884, -4342, -3927, -2890, -1620, -390, 543, 1042, 1338, 1846, 2639, 3360, 3743, 4055, 4892, 6541, 8598, 10276, 11042, 10936, 10336, 9538, 8638, 7706, 6931, 6498, 6451, 6753, 7370, 8161, 8879, 9451, 10049, 10769, 11510, 12190, 12760, 12969, 12527, 11556, 10549, 9906, 9794, 10237, 11039, 11807, 12302, 12576, 12666, 12474, 12055, 11682, 11468, 11183, 10497, 9375, 8230, 7612, 7625, 7767, 7642, 7482, 7639, 7938, 8023, 7923, 7824, 7668, 7399, 7105, 6686, 5920, 5005, 4463, 4360, 4152, 3472, 2605, 2026, 1756, 1405, 721, -100, -707, -1038, -1371, -1972, -2724, -3163, -2954, -2268, -1600, -1297, -1433, -1995, -2839, -3638, -4233, -4912, -6013, -7396, -8579, -9318, -9696, -9785, -9573, -9257, -9219, -9531, -9783, -9612, -9143, -8729, -8588, -8817, -9423, -10127, -10505, -10480, -10410, -10586, -10861, -10947, -10816, -10688, -10694, -10731, -10632, -10411, -10289, -10480, -10950, -11367, -11385, -11019, -10570, -10199, -9736, -9011, -8168, -7564, -7410, -7599, -7783, -7651, -7230, -6837, -6707, -6720, -6599, -6297, -6044, -6002, -6082, -6143, -6164, -6107, -5897, -5583, -5292, -4958, -4469, -3988, -3702, -3410, -2793, -1950, -1221, -770, -639, -809, -1016, -944, -742, -874, -1432, -2037, -2408, -2576, -2569, -2295, -1788, -1259, -834, -451, -77, 182, 312, 458, 634, 655, 503, 367, 240, -64, -487, -837, -1219, -1757, -2172, -2217, -2200, -2463, -2792, -2801, -2410, -1743, -1069, -829, -1112, -1323, -984, -454, -293, -467, -702, -1004, -1388, -1721, -2042, -2456, -2735, -2606, -2249, -1997, -1842, -1647, -1446, -1281, -1161, -1240, -1609, -2009, -2197, -2390, -2828, -3206, -3049, -2426, -1865, -1688, -1782, -1893, -1933, -1967, -2033, -2036, -1880, -1642, -1507, -1522, -1557, -1537, -1578, -1858, -2422, -3135, -3783, -4217, -4418, -4408, -4162, -3691, -3134, -2590, -1979, -1212, -465, -56, -139, -610, -1204, -1598, -1626, -1443, -1274, -1096, -789, -425, -133, 105, 282, 284, 160, 116, 144, 98, 127, 580, 1387, 1980, 1910, 1234, 308, -555, -1145, -1367, -1321, -1210, -1073, -686, 157, 1365, 2640, 3741, 4532, 4902, 4821, 4442, 3977, 3490, 2910, 2219, 1503, 830, 257, -53, 52, 457, 830, 1036, 1286, 1759, 2271, 2487, 2345, 2110, 2036, 2095, 2090, 1928, 1673, 1409, 1197, 1167, 1457, 1920, 2081, 1577, 594, -246, -500, -331, -336, -938, -1928, -2675, -2787, -2569, -2707, -3490, -4482, -5030, -4944, -4488, -3812, -2684, -857, 1524, 4002, 6163, 7867, 9141, 9949, 10145, 9701, 8783, 7520, 5933, 4241, 2884, 2077, 1622, 1394, 1548, 2129, 2954, 3989, 5434, 7339, 9518, 11761, 13904, 15701, 16976, 17794, 18277, 18359, 17950, 17252, 16614, 16117, 15505, 14625, 13727, 13148, 12961, 13052, 13440, 14193, 15068, 15667, 15982, 16522, 17649, 19110, 20351, 21085, 21367, 21421, 21486, 21615, 21480, 20704, 19448, 18354, 17880, 17786, 17533, 16927, 16200, 15586, 15043, 14480, 13947, 13537, 13228, 12867, 12326, 11673, 11216, 11135, 11216, 11167, 11072, 11148, 11356, 11536, 11596, 11314, 10376, 8937, 7561, 6451, 5291, 3945, 2645, 1453, 195, -993, -1699, -1880, -2043, -2603, -3322, -3609, -3258, -2707, -2499, -2631, -2666, -2410, -2189, -2396, -2982, -3617, -4259, -5256, -6825, -8655, -10180, -11080, -11430, -11540, -11771, -12268, -12754, -12821, -12434, -11902, -11412, -10943, -10550, -10353, -10275, -10087, -9739, -9452, -9479, -9867, -10432, -10921, -11232, -11451, -11678, -11869, -11914, -11781, -11519, -11249, -11089, -11040, -10935, -10612, -10115, -9626, -9261, -9012, -8817, -8581, -8166, -7505, -6754, -6209, -6047, -6192, -6433, -6597, -6618, -6568, -6669, -7099, -7691, -7994, -7786, -7444, -7520, -7988, -8200, -7711, -6848, -6272, -6197, -6283, -6139, -5704, -5196, -4892, -4966, -5392, -5946, -6394, -6705, -7051, -7593, -8316, -9044, -9523, -9573, -9273, -8939, -8779, -8665, -8341, -7805, -7281, -6902, -6625, -6500, -6700, -7189, -7620, -7766, -7803, -7965, -8232, -8522, -8850, -9147, -9229, -9065, -8796, -8536, -8361, -8338, -8349, -8118, -7654, -7399, -7634, -7974, -7848, -7321, -7015, -7185, -7362, -7115, -6663, -6417, -6316, -6071, -5758, -5737, -6066, -6361, -6295, -5961, -5662, -5504, -5385, -5305, -5397, -5585, -5511, -4994, -4379, -4157, -4365, -4585, -4456, -3988, -3429, -3020, -2811, -2664, -2421, -2066, -1673, -1281, -929, -656, -431, -171, 73, 153, 55, -57, -87, -89, -107, -53, 166, 526, 882, 1116, 1261, 1470, 1818, 2171, 2358, 2376, 2348, 2392, 2598, 2995, 3436, 3711, 3782, 3765, 3727, 3671, 3650, 3637, 3447, 2983, 2487, 2264, 2262, 2170, 1890, 1695, 1830, 2178, 2451, 2548, 2576, 2637, 2738, 2822, 2784, 2584, 2324, 2099, 1846, 1501, 1180, 1007, 930, 878, 858, 822, 687, 537, 512, 532, 417, 216, 140, 261, 510, 826, 1142, 1388, 1581, 1735, 1807, 1874, 2102, 2349, 2221, 1734, 1396, 1436, 1532, 1444, 1290, 1137, 918, 734, 754, 922, 1133, 1398, 1613, 1571, 1384, 1408, 1704, 2020, 2241, 2399, 2392, 2163, 1929, 1934, 2138, 2350, 2448, 2387, 2242, 2200, 2292, 2304, 2156, 2061, 2089, 1962, 1510, 1047, 1046, 1588, 2279, 2614, 2454, 2177, 2197, 2360, 2177, 1609, 1158, 1132, 1274, 1257, 1144, 1209, 1542, 1897, 1910, 1512, 1057, 828, 619, 137, -446, -756, -838, -1045, -1424, -1687, -1673, -1522, -1453, -1573, -1838, -2088, -2170, -2079, -1988, -2156, -2789, -3775, -4659, -5116, -5327, -5613, -5883, -5822, -5302, -4242, -2459, -45, 2508, 4832, 6936, 8727, 9828, 10129, 9998, 9657, 8798, 7250, 5639, 4856, 4951, 5182, 5126, 5202, 5946, 7302, 8810, 10167, 11345, 12503, 13798, 15256, 16754, 18174, 19507, 20708, 21620, 22036, 21854, 21193, 20408, 19759, 19126, 18265, 17310, 16663, 16432, 16362, 16346, 16625, 17325, 18152, 18839, 19560, 20587, 21671, 22253, 22221, 21969, 21717, 21207, 20233, 19052, 18066, 17335, 16669, 16012, 15554, 15392, 15321, 15038, 14459, 13741, 12985, 12188, 11360, 10548, 9711, 8743, 7688, 6768, 6167, 5867, 5707, 5525, 5221, 4807, 4480, 4465, 4558, 4188, 3166, 2033, 1261, 548, -547, -1809, -2769, -3531, -4473, -5518, -6305, -6830, -7399, -8048, -8452, -8453, -8274, -8148, -7977, -7574, -7054, -6743, -6785, -7061, -7464, -8065, -8945, -10031, -11134, -12108, -12912, -13549, -14015, -14305, -14414, -14304, -13921, -13290, -12543, -11814, -11127, -10434, -9708, -9011, -8525, -8435, -8676, -8984, -9295, -9794, -10420, -10823, -10962, -11124, -11250, -10961, -10322, -9764, -9311, -8690, -8083, -7909, -7978, -7648, -6753, -5771, -5183, -5038, -5128, -5182, -4978, -4540, -4251, -4540, -5336, -6017, -6091, -5803, -5788, -6156, -6385, -6199, -5966, -5965, -5932, -5701, -5575, -5685, -5698, -5475, -5321, -5356, -5412, -5550, -5972, -6464, -6610, -6445, -6368, -6511, -6679, -6792, -6945, -7100, -7108, -7139, -7604, -8492, -9254, -9535, -9567, -9619, -9596, -9398, -9128, -8800, -8301, -7778, -7627, -7955, -8383, -8552, -8556, -8738, -9206, -9769, -10226, -10538, -10712, -10700, -10516, -10282, -10101, -9942, -9767, -9622, -9504, -9338, -9212, -9324, -9549, -9452, -8957, -8482, -8256, -8028, -7639, -7258, -6947, -6574, -6240, -6237, -6528, -6763, -6767, -6659, -6533, -6336, -6005, -5612, -5320, -5204, -5072, -4660, -4001, -3426, -3119, -2983, -2879, -2685, -2205, -1431, -778, -620, -739, -615, -154, 276, 419, 391, 434, 625, 818, 852, 787, 851, 1120, 1453, 1764, 2105, 2453, 2735, 3054, 3547, 4036, 4207, 4048, 3843, 3746, 3702, 3665, 3676, 3754, 3862, 3951, 4006, 4099, 4328, 4652, 4868, 4860, 4724, 4567, 4396, 4217, 4095, 4031, 3916, 3706, 3505, 3462, 3605, 3830, 3995, 4054, 4084, 4185, 4348, 4492, 4577, 4607, 4576, 4467, 4279, 4016, 3729, 3501, 3339, 3118, 2820, 2615, 2586, 2576, 2543, 2712, 3166, 3605, 3754, 3685, 3606, 3636, 3786, 3923, 3810, 3418, 3021, 2798, 2616, 2392, 2291, 2391, 2468, 2361, 2273, 2492, 2942, 3236, 3173, 3033, 3213, 3643, 3834, 3609, 3397, 3572, 3858, 3775, 3390, 3161, 3233, 3319, 3195, 2973, 2833, 2767, 2673, 2561, 2534, 2640, 2810, 2942, 3003, 3058, 3214, 3480, 3681, 3615, 3300, 3007, 2960, 3096, 3188, 3127, 2985, 2868, 2834, 2917, 3060, 3114, 2986, 2710, 2289, 1674, 986, 515, 337, 184, -104, -215, 259, 1203, 2074, 2575, 2922, 3317, 3518, 3180, 2409, 1667, 1157, 639, -59, -705, -964, -781, -318, 127, 209, -82, -242, 13, 190, -204, -756, -789, -413, -170, -83, 181, 596, 842, 863, 863, 888, 724, 231, -370, -703, -700, -721, -1060, -1493, -1580, -1295, -1074, -1289, -1873, -2502, -2975, -3371, -3972, -5044, -6491, -7665, -7788, -6686, -4883, -2752, -7, 3660, 7763, 11312, 13741, 15116, 15566, 14897, 12900, 9786, 6205, 2864, 206, -1641, -2653, -2674, -1473, 857, 3680, 6236, 8320, 10286, 12346, 14160, 15351, 16098, 16906, 17847, 18525, 18757, 18801, 18810, 18433, 17302, 15619, 14004, 12791, 11739, 10459, 9026, 8021, 8001, 8962, 10377, 11707, 12821, 14009, 15508, 17081, 18123, 18300, 17853, 17122, 16096, 14714, 13238, 11945, 10768, 9676, 9001, 9003, 9386, 9653, 9673, 9594, 9383, 8775, 7614, 6065, 4493, 3122, 1896, 655, -542, -1273, -1085, -51, 1232, 2252, 2971, 3477, 3725, 3730, 3539, 2906, 1538, -292, -1997, -3440, -4894, -6379, -7636, -8593, -9367, -10033, -10672, -11309, -11709, -11596, -11046, -10326, -9486, -8452, -7258, -5937, -4605, -3732, -3790, -4578, -5510, -6505, -7927, -9744, -11434, -12642, -13426, -13897, -14058, -13896, -13438, -12810, -12202, -11651, -10985, -10178, -9433, -8799, -8093, -7329, -6774, -6441, -6109, -5802, -5764, -5991, -6286, -6610, -6977, -7240, -7337, -7409, -7486, -7431, -7254, -7135, -7043, -6770, -6319, -5943, -5777, -5682, -5431, -4911, -4199, -3482, -2893, -2431, -2033, -1681, -1384, -1150, -1067, -1283, -1851, -2660, -3549, -4427, -5245, -5948, -6500, -6902, -7164, -7254, -7097, -6643, -6018, -5492, -5209, -5050, -4825, -4542, -4316, -4187, -4146, -4262, -4598, -5106, -5695, -6379, -7216, -8167, -9125, -10055, -10935, -11570, -11733, -11475, -11060, -10584, -9913, -9052, -8254, -7708, -7389, -7220, -7231, -7461, -7863, -8299, -8617, -8822, -9046, -9268, -9293, -9124, -9021, -9031, -8859, -8420, -8083, -8116, -8288, -8254, -8010, -7802, -7777, -7832, -7695, -7212, -6543, -5958, -5462, -4864, -4206, -3775, -3646, -3523, -3239, -3097, -3393, -3848, -3974, -3840, -3882, -4109, -4140, -3906, -3682, -3504, -3179, -2726, -2348, -2085, -1843, -1549, -1103, -454, 208, 644, 882, 1150, 1514, 1846, 2024, 2016, 1888, 1771, 1683, 1472, 1124, 868, 784, 648, 415, 381, 666, 1057, 1473, 2044, 2679, 3122, 3400, 3704, 3979, 4090, 4147, 4266, 4341, 4286, 4194, 4131, 4115, 4244, 4518, 4683, 4544, 4221, 3885, 3537, 3209, 3025, 2936, 2757, 2509, 2433, 2670, 3172, 3755, 4162, 4302, 4448, 4837, 5213, 5242, 5115, 5201, 5352, 5167, 4703, 4341, 4184, 4004, 3666, 3255, 2936, 2801, 2775, 2740, 2787, 3112, 3616, 3961, 4079, 4227, 4470, 4582, 4456, 4238, 4052, 3940, 3945, 3987, 3931, 3877, 4045, 4323, 4335, 4014, 3647, 3386, 3138, 2863, 2617, 2375, 2090, 1828, 1691, 1721, 1895, 2089, 2141, 2075, 2128, 2402, 2703, 2858, 2930, 2995, 2977, 2822, 2579, 2284, 1897, 1399, 818, 230, -219, -475, -702, -1096, -1523, -1625, -1346, -1067, -1072, -1122, -856, -414, -205, -232, -202, -167, -457, -1059, -1643, -2089, -2475, -2780, -2989, -3179, -3247, -2990, -2558, -2326, -2345, -2431, -2642, -3112, -3636, -3945, -4131, -4407, -4675, -4654, -4218, -3473, -2702, -2166, -1822, -1467, -1226, -1399, -1826, -2113, -2371, -2937, -3563, -3744, -3526, -3209, -2780, -2322, -2259, -2552, -2514, -1989, -1789, -2392, -3063, -2908, -2114, -1517, -1343, -1052, -310, 471, 798, 847, 1081, 1361, 1137, 477, 68, 75, -180, -1043, -1875, -2005, -1653, -1431, -1515, -1690, -1809, -1858, -1850, -1871, -2071, -2490, -2979, -3324, -3328, -2750, -1361, 800, 3282, 5559, 7543, 9514, 11435, 12699, 12848, 12083, 10719, 8662, 6058, 3832, 2760, 2494, 2253, 2118, 2811, 4544, 6775, 8966, 11033, 13032, 14858, 16436, 17797, 18898, 19600, 19953, 20177, 20238, 19769, 18618, 17127, 15749, 14549, 13320, 12026, 10906, 10227, 10063, 10338, 10902, 11665, 12713, 14140, 15675, 16845, 17610, 18380, 19194, 19461, 18774, 17415, 15789, 13917, 11807, 9824, 8344, 7280, 6349, 5624, 5466, 5930, 6569, 6976, 7244, 7607, 7829, 7400, 6338, 5228, 4417, 3654, 2700, 1712, 921, 378, 106, 55, 52, 57, 228, 423, 194, -475, -1036, -1246, -1551, -2345, -3416, -4351, -5066, -5719, -6370, -6931, -7300, -7491, -7617, -7717, -7643, -7198, -6383, -5444, -4650, -4042, -3473, -2893, -2553, -2782, -3558, -4512, -5466, -6629, -8084, -9447, -10302, -10705, -10935, -10986, -10643, -9867, -8853, -7800, -6773, -5741, -4667, -3610, -2777, -2389, -2398, -2502, -2535, -2715, -3307, -4186, -4970, -5488, -5832, -6077, -6169, -6105, -5939, -5603, -4985, -4220, -3639, -3292, -2865, -2220, -1669, -1454, -1350, -1049, -659, -486, -620, -949, -1382, -1865, -2296, -2644, -3058, -3666, -4325, -4729, -4811, -4845, -5078, -5387, -5482, -5344, -5194, -5126, -5059, -5021, -5153, -5397, -5521, -5515, -5612, -5932, -6347, -6694, -6928, -7090, -7263, -7520, -7832, -8098, -8344, -8724, -9260, -9716, -9908, -9999, -10229, -10440, -10270, -9740, -9203, -8789, -8361, -7930, -7623, -7412, -7245, -7266, -7563, -7944, -8219, -8411, -8547, -8547, -8457, -8413, -8335, -7994, -7389, -6828, -6528, -6360, -6058, -5593, -5237, -5153, -5087, -4763, -4428, -4469, -4587, -4133, -3252, -2791, -2971, -3094, -2728, -2261, -2108, -2109, -1970, -1731, -1592, -1566, -1502, -1306, -1069, -970, -1049, -1144, -1094, -950, -885, -916, -825, -461, -18, 121, -82, -190, 149, 651, 726, 319, 12, 179, 451, 319, -93, -269, -140, -182, -637, -1082, -1036, -647, -433, -494, -441, -85, 257, 305, 257, 393, 529, 283, -212, -364, 46, 490, 418, 60, 79, 623, 1141, 1149, 785, 511, 529, 604, 440, 92, -108, -64, -86, -375, -613, -410, 42, 183, -84, -225, 121, 592, 677, 497, 530, 803, 907, 722, 614, 869, 1274, 1374, 1046, 720, 895, 1423, 1639, 1326, 1047, 1257, 1677, 1897, 2027, 2317, 2616, 2659, 2570, 2676, 3004, 3230, 3126, 2854, 2758, 2934, 3149, 3252, 3377, 3621, 3795, 3752, 3676, 3757, 3857, 3754, 3487, 3201, 2901, 2561, 2281, 2152, 2120, 2067, 1978, 1976, 2217, 2674, 3070, 3146, 2983, 2883, 2954, 2999, 2832, 2537, 2295, 2107, 1832, 1472, 1213, 1187, 1293, 1318, 1159, 900, 733, 739, 763, 616, 385, 310, 399, 443, 381, 356, 384, 299, 54, -174, -260, -325, -584, -1042, -1422, -1463, -1267, -1179, -1312, -1448, -1440, -1395, -1357, -1235, -1113, -1227, -1551, -1774, -1774, -1755, -1868, -2019, -2080, -2059, -2030, -2013, -1925, -1648, -1243, -994, -1103, -1397, -1513, -1317, -1031, -1004, -1366, -1819, -1897, -1559, -1283, -1366, -1518, -1438, -1334, -1448, -1475, -1010, -253, 226, 314, 478, 1026, 1635, 1805, 1488, 1050, 798, 726, 631, 348, 11, -32, 288, 612, 712, 862, 1319, 1861, 2154, 2200, 2172, 2164, 2243, 2387, 2375, 2087, 1743, 1567, 1428, 1109, 674, 321, 87, -117, -364, -653, -884, -884, -630, -334, -209, -205, -117, 85, 166, -109, -740, -1522, -2249, -2855, -3441, -4145, -4877, -5205, -4700, -3389, -1677, 144, 2092, 4165, 6130, 7729, 8882, 9532, 9478, 8578, 7056, 5411, 4007, 2932, 2204, 1953, 2245, 2945, 3942, 5318, 7068, 8865, 10419, 11801, 13065, 13938, 14339, 14701, 15300, 15745, 15573, 14970, 14365, 13805, 13060, 12062, 10993, 10118, 9618, 9449, 9462, 9654, 10177, 11034, 12066, 13145, 14195, 15095, 15804, 16380, 16737, 16650, 16123, 15360, 14327, 12846, 11104, 9595, 8492, 7569, 6773, 6392, 6569, 7068, 7602, 8180, 8919, 9662, 10008, 9732, 9012, 8176, 7332, 6362, 5203, 3999, 2975, 2184, 1524, 987, 718, 716, 742, 656, 576, 559, 463, 254, 57, -160, -605, -1286, -2003, -2653, -3265, -3832, -4368, -4952, -5504, -5780, -5728, -5587, -5500, -5291, -4786, -4157, -3726, -3579, -3519, -3427, -3475, -3912, -4717, -5620, -6399, -7063, -7691, -8227, -8529, -8543, -8350, -8040, -7597, -6911, -5977, -5024, -4340, -3931, -3529, -3008, -2629, -2709, -3172, -3654, -3996, -4374, -4870, -5273, -5434, -5482, -5466, -5196, -4633, -4002, -3390, -2688, -1971, -1416, -910, -288, 240, 389, 315, 342, 422, 308, -23, -416, -835, -1329, -1838, -2253, -2583, -2902, -3170, -3281, -3267, -3224, -3095, -2788, -2443, -2277, -2287, -2363, -2533, -2850, -3261, -3763, -4455, -5273, -5985, -6510, -6989, -7467, -7797, -7901, -7896, -7895, -7881, -7846, -7877, -8028, -8206, -8341, -8515, -8804, -9081, -9195, -9178, -9162, -9154, -9080, -8957, -8868, -8851, -8882, -8940, -9037, -9203, -9442, -9718, -9932, -9986, -9864, -9641, -9398, -9125, -8760, -8311, -7910, -7663, -7507, -7339, -7216, -7227, -7302, -7299, -7226, -7135, -6965, -6691, -6461, -6345, -6210, -5966, -5725, -5565, -5408, -5207, -5034, -4898, -4695, -4400, -4116, -3930, -3822, -3766, -3778, -3833, -3829, -3751, -3705, -3722, -3642, -3345, -2969, -2726, -2590, -2373, -2053, -1816, -1727, -1631, -1463, -1370, -1406, -1432, -1425, -1524, -1716, -1853, -1962, -2095, -2065, -1742, -1381, -1203, -980, -461, 118, 382, 388, 447, 565, 476, 148, -138, -248, -334, -440, -418, -274, -166, -29, 296, 667, 860, 996, 1257, 1462, 1420, 1343, 1483, 1678, 1639, 1428, 1321, 1377, 1402, 1287, 1150, 1150, 1298, 1502, 1685, 1828, 1987, 2258, 2640, 2962, 3072, 3071, 3204, 3506, 3720, 3670, 3522, 3533, 3717, 3927, 4095, 4178, 4133, 4089, 4245, 4485, 4520, 4435, 4563, 4860, 4994, 4973, 5108, 5422, 5625, 5572, 5380, 5217, 5200, 5331, 5419, 5277, 5017, 4904, 4979, 5072, 5085, 5073, 5073, 5037, 4898, 4661, 4454, 4406, 4450, 4369, 4104, 3844, 3696, 3529, 3246, 2986, 2894, 2852, 2660, 2362, 2182, 2176, 2154, 1982, 1759, 1614, 1526, 1395, 1187, 948, 785, 774, 803, 662, 339, 54, -115, -331, -669, -975, -1158, -1344, -1616, -1818, -1788, -1619, -1554, -1668, -1805, -1805, -1725, -1738, -1898, -2089, -2177, -2155, -2107, -2085, -2068, -2014, -1947, -1961, -2113, -2305, -2365, -2270, -2167, -2125, -2074, -2002, -2004, -2054, -2012, -1896, -1880, -2016, -2170, -2210, -2118, -1947, -1820, -1829, -1867, -1736, -1461, -1283, -1305, -1346, -1234, -1053, -970, -932, -761, -464, -234, -155, -143, -137, -161, -218, -288, -351, -331, -150, 85, 241, 432, 847, 1351, 1643, 1721, 1819, 1965, 1962, 1738, 1441, 1250, 1220, 1296, 1355, 1338, 1354, 1622, 2174, 2743, 3007, 2970, 2907, 2977, 3018, 2801, 2343, 1871, 1571, 1425, 1268, 1022, 796, 702, 642, 484, 316, 309, 384, 303, 13, -323, -554, -632, -615, -664, -911, -1259, -1507, -1619, -1732, -1967, -2401, -3080, -3892, -4527, -4743, -4602, -4356, -4127, -3787, -3043, -1646, 414, 2750, 4688, 5794, 6242, 6466, 6567, 6381, 5889, 5188, 4250, 3173, 2394, 2294, 2821, 3731, 4883, 6098, 7155, 8106, 9216, 10502, 11661, 12487, 13106, 13719, 14312, 14713, 14830, 14767, 14653, 14397, 13814, 12972, 12126, 11344, 10552, 9958, 9932, 10427, 10942, 11271, 11775, 12788, 14066, 15099, 15678, 15962, 16095, 16045, 15742, 15154, 14275, 13168, 12019, 10948, 9912, 8891, 8082, 7717, 7757, 7954, 8127, 8266, 8425, 8638, 8858, 8919, 8634, 7977, 7166, 6417, 5729, 4988, 4221, 3535, 2908, 2246, 1593, 1039, 544, 42, -405, -727, -1011, -1378, -1764, -1974, -1962, -1923, -2102, -2550, -3081, -3515, -3869, -4297, -4887, -5540, -6063, -6312, -6277, -6071, -5841, -5622, -5334, -4909, -4437, -4134, -4135, -4402, -4850, -5440, -6112, -6754, -7342, -7907, -8379, -8625, -8666, -8610, -8390, -7872, -7153, -6480, -5919, -5386, -4861, -4371, -3913, -3580, -3553, -3824, -4147, -4328, -4426, -4590, -4846, -5053, -5034, -4764, -4400, -4058, -3651, -3045, -2333, -1741, -1319, -890, -354, 164, 532, 821, 1127, 1326, 1213, 821, 360, -87, -624, -1285, -1955, -2497, -2859, -3056, -3117, -3021, -2720, -2273, -1884, -1699, -1645, -1600, -1617, -1869, -2425, -3178, -3960, -4667, -5287, -5864, -6441, -6990, -7423, -7686, -7811, -7880, -7943, -7992, -8014, -8031, -8060, -8063, -8014, -7973, -8021, -8129, -8199, -8233, -8342, -8576, -8866, -9162, -9466, -9777, -10047, -10254, -10420, -10534, -10532, -10366, -10061, -9705, -9374, -9077, -8794, -8548, -8395, -8362, -8413, -8487, -8557, -8619, -8669, -8687, -8637, -8487, -8225, -7887, -7569, -7324, -7123, -6925, -6762, -6651, -6504, -6262, -6017, -5888, -5819, -5677, -5458, -5266, -5195, -5257, -5375, -5425, -5365, -5300, -5322, -5338, -5173, -4817, -4437, -4161, -3937, -3661, -3326, -3034, -2867, -2821, -2828, -2813, -2755, -2720, -2785, -2909, -2967, -2912, -2823, -2770, -2677, -2419, -1991, -1517, -1084, -669, -244, 121, 332, 385, 362, 338, 310, 218, 51, -93, -90, 61, 243, 360, 440, 560, 759, 982, 1110, 1088, 1031, 1093, 1260, 1395, 1469, 1540, 1585, 1531, 1434, 1417, 1471, 1473, 1391, 1316, 1327, 1439, 1672, 2041, 2451, 2733, 2883, 3084, 3428, 3771, 3937, 3927, 3827, 3738, 3761, 3894, 3973, 3916, 3879, 4006, 4237, 4476, 4709, 4870, 4891, 4901, 5040, 5183, 5184, 5168, 5268, 5378, 5408, 5455, 5534, 5518, 5459, 5525, 5658, 5647, 5500, 5375, 5296, 5236, 5253, 5324, 5300, 5146, 5016, 5004, 5013, 4947, 4816, 4653, 4457, 4214, 3934, 3677, 3527, 3504, 3504, 3409, 3246, 3144, 3180, 3300, 3386, 3350, 3182, 2930, 2621, 2248, 1860, 1576, 1440, 1332, 1116, 835, 668, 718, 897, 996, 899, 720, 663, 759, 814, 712, 557, 477, 436, 360, 303, 334, 364, 234, -46, -277, -314, -264, -349, -603, -811, -777, -567, -414, -423, -493, -490, -415, -358, -376, -441, -513, -593, -695, -783, -793, -732, -686, -705, -700, -537, -239, 6, 95, 133, 259, 427, 522, 543, 532, 475, 384, 355, 415, 473, 477, 496, 557, 602, 625, 716, 909, 1096, 1161, 1117, 1082, 1129, 1214, 1248, 1222, 1198, 1212, 1241, 1271, 1322, 1398, 1453, 1472, 1507, 1631, 1848, 2085, 2242, 2279, 2253, 2267, 2357, 2465, 2512, 2478, 2393, 2302, 2263, 2325, 2458, 2541, 2489, 2370, 2334, 2405, 2463, 2411, 2278, 2148, 2055, 1990, 1908, 1783, 1664, 1643, 1730, 1814, 1777, 1605, 1373, 1160, 991, 798, 510, 152, -185, -475, -766, -1063, -1288, -1411, -1540, -1768, -2019, -2129, -2081, -2037, -2127, -2277, -2338, -2297, -2293, -2395, -2539, -2670, -2876, -3268, -3859, -4556, -5219, -5690, -5936, -6130, -6424, -6686, -6613, -6062, -5143, -4035, -2843, -1595, -303, 965, 2047, 2795, 3203, 3358, 3302, 3031, 2597, 2127, 1710, 1350, 1056, 919, 1030, 1372, 1857, 2416, 3015, 3658, 4412, 5308, 6235, 7042, 7740, 8451, 9119, 9488, 9430, 9122, 8787, 8381, 7737, 6921, 6209, 5762, 5504, 5367, 5419, 5731, 6262, 6925, 7635, 8290, 8804, 9206, 9592, 9941, 10094, 9970, 9702, 9429, 9112, 8647, 8059, 7471, 6979, 6643, 6461, 6355, 6256, 6200, 6219, 6235, 6171, 6060, 5958, 5819, 5565, 5193, 4753, 4293, 3843, 3422, 2984, 2466, 1893, 1385, 1008, 679, 296, -78, -328, -443, -500, -502, -429, -359, -426, -648, -940, -1277, -1725, -2311, -2940, -3499, -3988, -4471, -4926, -5209, -5225, -5054, -4862, -4722, -4588, -4418, -4244, -4116, -4062, -4098, -4227, -4437, -4703, -4992, -5292, -5616, -5988, -6375, -6688, -6897, -7053, -7152, -7110, -6913, -6666, -6451, -6232, -5940, -5569, -5171, -4822, -4579, -4415, -4235, -3993, -3750, -3575, -3467, -3363, -3203, -2973, -2716, -2477, -2218, -1861, -1425, -995, -596, -199, 136, 292, 250, 107, -84, -366, -746, -1128, -1419, -1612, -1732, -1754, -1642, -1426, -1181, -937, -692, -470, -311, -216, -192, -288, -534, -846, -1103, -1348, -1742, -2285, -2763, -3065, -3319, -3627, -3902, -4029, -4040, -4000, -3914, -3785, -3646, -3513, -3386, -3304, -3298, -3334, -3358, -3415, -3609, -3946, -4294, -4544, -4735, -4936, -5135, -5281, -5362, -5366, -5272, -5117, -4959, -4803, -4639, -4516, -4500, -4575, -4691, -4816, -4938, -5081, -5287, -5512, -5601, -5479, -5274, -5121, -5025, -4956, -4911, -4837, -4677, -4513, -4467, -4489, -4450, -4384, -4401, -4459, -4417, -4296, -4293, -4482, -4697, -4760, -4726, -4767, -4920, -5062, -5072, -4916, -4656, -4417, -4284, -4201, -4082, -3949, -3821, -3637, -3420, -3313, -3309, -3240, -3101, -3018, -2923, -2665, -2363, -2194, -2062, -1849, -1698, -1656, -1482, -1119, -864, -843, -852, -768, -657, -504, -305, -223, -296, -285, -74, 140, 256, 397, 559, 571, 432, 341, 396, 566, 789, 912, 797, 569, 540, 796, 1137, 1403, 1586, 1650, 1538, 1347, 1286, 1469, 1818, 2159, 2316, 2231, 2027, 1949, 2157, 2579, 2940, 2986, 2773, 2640, 2815, 3156, 3394, 3494, 3577, 3649, 3655, 3678, 3846, 4070, 4109, 3869, 3543, 3379, 3418, 3473, 3368, 3126, 2918, 2845, 2821, 2708, 2543, 2502, 2638, 2764, 2713, 2582, 2552, 2635, 2719, 2768, 2795, 2761, 2620, 2431, 2311, 2314, 2367, 2325, 2138, 1947, 1908, 1956, 1880, 1642, 1398, 1243, 1120, 990, 882, 782, 635, 451, 315, 267, 269, 283, 296, 285, 223, 140, 119, 175, 226, 223, 201, 205, 227, 262, 331, 403, 424, 388, 357, 386, 496, 659, 792, 820, 759, 691, 667, 703, 798, 893, 880, 737, 568, 485, 511, 605, 672, 602, 388, 193, 166, 258, 305, 236, 92, -75, -236, -371, -485, -608, -762, -927, -1062, -1153, -1200, -1208, -1164, -1065, -945, -853, -782, -684, -545, -411, -322, -262, -217, -188, -156, -67, 78, 193, 184, 71, -51, -112, -120, -113, -126, -188, -304, -414, -458, -464, -519, -656, -809, -899, -921, -934, -993, -1092, -1177, -1212, -1219, -1230, -1248, -1269, -1305, -1348, -1362, -1316, -1222, -1111, -996, -873, -738, -606, -499, -433, -382, -313, -230, -176, -170, -207, -279, -340, -334, -274, -259, -328, -413, -462, -486, -484, -423, -331, -269, -225, -142, -33, 38, 46, 5, -78, -177, -241, -249, -235, -245, -297, -388, -479, -518, -476, -383, -290, -212, -121, 14, 186, 333, 421, 506, 657, 831, 882, 736, 503, 346, 282, 204, 85, 21, 43, 64, 58, 101, 200, 283, 359, 478, 572, 562, 534, 606, 706, 688, 574, 496, 482, 473, 473, 532, 612, 615, 575, 653, 914, 1229, 1472, 1675, 1903, 2113, 2237, 2325, 2479, 2676, 2782, 2752, 2681, 2639, 2619, 2616, 2643, 2671, 2683, 2758, 2950, 3158, 3259, 3290, 3371, 3518, 3649, 3693, 3638, 3528, 3433, 3390, 3356, 3274, 3141, 3024, 2976, 3006, 3095, 3200, 3274, 3299, 3325, 3420, 3582, 3720, 3760, 3720, 3667, 3627, 3568, 3463, 3325, 3188, 3070, 2959, 2845, 2735, 2632, 2517, 2389, 2304, 2278, 2238, 2137, 2032, 1961, 1878, 1764, 1680, 1615, 1479, 1275, 1113, 1007, 856, 647, 499, 489, 546, 553, 481, 393, 368, 403, 413, 332, 189, 64, -6, -57, -134, -234, -324, -389, -442, -506, -573, -621, -650, -694, -771, -850, -876, -859, -862, -915, -978, -1028, -1107, -1265, -1461, -1608, -1690, -1781, -1908, -2008, -2038, -2066, -2119, -2114, -2020, -1958, -2004, -2079, -2118, -2146, -2132, -2005, -1870, -1894, -2019, -2025, -1895, -1804, -1825, -1872, -1897, -1932, -1974, -1977, -1946, -1952, -2031, -2129, -2193, -2225, -2241, -2228, -2176, -2119, -2086, -2055, -2010, -1970, -1918, -1754, -1453, -1219, -1261, -1468, -1549, -1451, -1359, -1323, -1248, -1156, -1157, -1234, -1294, -1311, -1266, -1126, -996, -1037, -1197, -1309, -1359, -1399, -1387, -1349, -1441, -1649, -1774, -1819, -1992, -2297, -2550, -2740, -2980, -3223, -3426, -3735, -4189, -4541, -4656, -4747, -5001, -5314, -5474, -5379, -5041, -4592, -4219, -3931, -3568, -3079, -2593, -2168, -1732, -1280, -906, -664, -569, -592, -548, -224, 289, 653, 726, 690, 738, 979, 1499, 2241, 2911, 3291, 3495, 3746, 4121, 4597, 5089, 5413, 5452, 5350, 5318, 5354, 5373, 5427, 5576, 5751, 5879, 6030, 6319, 6797, 7426, 8025, 8381, 8519, 8701, 9055, 9430, 9684, 9825, 9845, 9660, 9301, 8933, 8673, 8534, 8499, 8493, 8389, 8140, 7855, 7702, 7753, 7959, 8156, 8176, 7982, 7674, 7342, 7015, 6744, 6502, 6134, 5588, 5061, 4691, 4337, 3904, 3562, 3399, 3204, 2864, 2576, 2499, 2508, 2454, 2359, 2242, 2025, 1720, 1473, 1350, 1208, 899, 469, 65, -268, -572, -822, -971, -1049, -1122, -1211, -1323, -1467, -1587, -1621, -1638, -1778, -2048, -2341, -2628, -2984, -3423, -3826, -4126, -4422, -4785, -5106, -5255, -5294, -5348, -5379, -5287, -5113, -4975, -4873, -4719, -4524, -4392, -4359, -4357, -4335, -4309, -4280, -4227, -4200, -4266, -4349, -4291, -4086, -3891, -3772, -3628, -3386, -3120, -2924, -2762, -2582, -2430, -2384, -2412, -2436, -2481, -2616, -2809, -2980, -3122, -3245, -3314, -3293, -3215, -3112, -2967, -2783, -2618, -2496, -2367, -2205, -2080, -2074, -2155, -2254, -2389, -2628, -2944, -3242, -3477, -3677, -3840, -3962, -4070, -4172, -4206, -4124, -3972, -3834, -3741, -3678, -3645, -3643, -3648, -3653, -3705, -3853, -4049, -4213, -4346, -4489, -4610, -4645, -4617, -4580, -4533, -4432, -4272, -4081, -3874, -3686, -3560, -3501, -3448, -3368, -3291, -3288, -3404, -3597, -3755, -3804, -3789, -3812, -3888, -3946, -3936, -3902, -3875, -3807, -3659, -3502, -3421, -3388, -3339, -3314, -3379, -3471, -3484, -3451, -3484, -3583, -3658, -3680, -3708, -3762, -3786, -3757, -3715, -3681, -3623, -3558, -3552, -3584, -3558, -3467, -3429, -3480, -3517, -3482, -3450, -3497, -3552, -3501, -3359, -3252, -3223, -3203, -3124, -3012, -2920, -2839, -2760, -2709, -2697, -2661, -2556, -2454, -2458, -2552, -2617, -2599, -2553, -2528, -2510, -2480, -2460, -2488, -2561, -2612, -2569, -2442, -2337, -2328, -2373, -2410, -2414, -2341, -2156, -1948, -1860, -1871, -1827, -1666, -1469, -1310, -1211, -1190, -1216, -1183, -1028, -840, -756, -783, -824, -815, -771, -689, -545, -403, -363, -396, -363, -223, -72, 24, 109, 209, 299, 364, 429, 503, 582, 676, 775, 865, 970, 1131, 1328, 1477, 1536, 1577, 1693, 1868, 2015, 2101, 2161, 2223, 2259, 2263, 2291, 2367, 2430, 2427, 2416, 2476, 2563, 2603, 2640, 2751, 2874, 2911, 2906, 2951, 3018, 3042, 3053, 3095, 3135, 3141, 3149, 3190, 3246, 3293, 3342, 3403, 3486, 3587, 3667, 3703, 3739, 3825, 3935, 4010, 4053, 4111, 4164, 4142, 4048, 3988, 4017, 4070, 4077, 4078, 4118, 4139, 4098, 4082, 4176, 4301, 4306, 4201, 4133, 4161, 4180, 4120, 4043, 3998, 3924, 3777, 3634, 3556, 3477, 3331, 3150, 3005, 2920, 2889, 2894, 2886, 2832, 2760, 2726, 2724, 2705, 2642, 2550, 2457, 2371, 2278, 2167, 2045, 1932, 1841, 1780, 1753, 1763, 1795, 1817, 1803, 1777, 1791, 1856, 1936, 1994, 2014, 1987, 1915, 1849, 1861, 1950, 2010, 1953, 1835, 1773, 1769, 1740, 1693, 1699, 1738, 1715, 1635, 1596, 1604, 1571, 1470, 1371, 1316, 1276, 1228, 1189, 1169, 1143, 1098, 1073, 1114, 1202, 1275, 1286, 1242, 1179, 1124, 1089, 1067, 1049, 1027, 985, 915, 842, 803, 792, 784, 786, 808, 796, 709, 614, 612, 690, 743, 713, 625, 523, 428, 350, 292, 209, 57, -134, -268, -280, -238, -258, -366, -467, -466, -385, -323, -343, -403, -435, -429, -423, -444, -466, -456, -434, -448, -490, -498, -479, -508, -565, -540, -433, -372, -372, -325, -228, -195, -226, -199, -107, -59, -85, -87, -40, -20, -40, -9, 89, 136, 63, -17, -6, 25, -8, -44, -12, 11, -67, -178, -204, -199, -304, -475, -545, -539, -658, -932, -1150, -1212, -1245, -1323, -1368, -1360, -1394, -1487, -1543, -1527, -1519, -1570, -1651, -1746, -1880, -2046, -2209, -2388, -2629, -2872, -2999, -3031, -3095, -3160, -3061, -2789, -2504, -2255, -1922, -1457, -963, -527, -148, 190, 519, 890, 1287, 1609, 1791, 1918, 2131, 2446, 2755, 2988, 3203, 3493, 3876, 4307, 4739, 5154, 5576, 6043, 6541, 6971, 7268, 7480, 7696, 7920, 8074, 8132, 8150, 8176, 8190, 8194, 8243, 8367, 8525, 8670, 8827, 9040, 9280, 9496, 9683, 9879, 10065, 10182, 10222, 10234, 10220, 10128, 9965, 9776, 9559, 9306, 9100, 8970, 8830, 8630, 8457, 8358, 8245, 8092, 7974, 7894, 7752, 7537, 7335, 7133, 6849, 6489, 6143, 5830, 5500, 5145, 4804, 4486, 4154, 3809, 3513, 3287, 3072, 2817, 2541, 2291, 2058, 1803, 1507, 1180, 831, 472, 126, -199, -534, -907, -1297, -1653, -1940, -2170, -2362, -2538, -2705, -2875, -3036, -3170, -3290, -3440, -3659, -3935, -4227, -4518, -4814, -5117, -5430, -5753, -6078, -6379, -6641, -6858, -7004, -7083, -7145, -7236, -7318, -7355, -7371, -7416, -7480, -7550, -7649, -7777, -7890, -7965, -8028, -8084, -8103, -8084, -8059, -8028, -7933, -7750, -7528, -7317, -7112, -6874, -6608, -6334, -6067, -5828, -5669, -5593, -5529, -5429, -5339, -5333, -5396, -5454, -5476, -5484, -5455, -5363, -5248, -5175, -5100, -4937, -4728, -4585, -4490, -4361, -4226, -4183, -4213, -4239, -4262, -4349, -4493, -4637, -4761, -4882, -4971, -4985, -4948, -4916, -4886, -4797, -4656, -4531, -4444, -4342, -4207, -4086, -4008, -3961, -3942, -3968, -4016, -4034, -4021, -4039, -4108, -4157, -4124, -4040, -3951, -3850, -3720, -3593, -3492, -3366, -3195, -3042, -2964, -2915, -2832, -2768, -2805, -2884, -2870, -2806, -2846, -2972, -3010, -2936, -2890, -2900, -2844, -2703, -2594, -2560, -2511, -2414, -2336, -2322, -2326, -2307, -2294, -2319, -2361, -2395, -2441, -2499, -2528, -2500, -2479, -2519, -2572, -2546, -2460, -2423, -2473, -2531, -2531, -2499, -2481, -2495, -2553, -2655, -2730, -2722, -2690, -2719, -2778, -2783, -2745, -2705, -2651, -2553, -2454, -2408, -2383, -2316, -2221, -2163, -2140, -2079, -1978, -1918, -1937, -1950, -1890, -1795, -1734, -1699, -1633, -1522, -1397, -1274, -1142, -997, -868, -770, -673, -550, -434, -380, -371, -353, -333, -358, -398, -379, -327, -328, -371, -371, -318, -281, -258, -186, -74, -6, -11, -8, 66, 174, 260, 328, 382, 379, 339, 368, 495, 612, 641, 648, 715, 814, 889, 955, 1071, 1240, 1410, 1539, 1635, 1732, 1821, 1866, 1864, 1874, 1925, 1987, 2032, 2066, 2073, 2030, 1976, 1996, 2091, 2171, 2174, 2134, 2104, 2085, 2074, 2106, 2173, 2192, 2115, 2029, 2016, 2025, 1990, 1977, 2063, 2164, 2150, 2050, 2001, 2061, 2173, 2256, 2260, 2185, 2080, 2019, 2033, 2091, 2132, 2102, 2013, 1940, 1939, 1988, 2048, 2106, 2123, 2061, 1985, 2002, 2073, 2078, 2045, 2077, 2121, 2058, 1970, 2026, 2197, 2295, 2269, 2220, 2220, 2252, 2306, 2383, 2438, 2421, 2380, 2420, 2541, 2626, 2610, 2563, 2552, 2562, 2562, 2557, 2543, 2510, 2473, 2443, 2401, 2362, 2365, 2387, 2378, 2370, 2427, 2507, 2509, 2448, 2430, 2479, 2512, 2475, 2413, 2383, 2375, 2335, 2257, 2186, 2156, 2146, 2130, 2129, 2162, 2176, 2151, 2159, 2236, 2280, 2238, 2228, 2311, 2345, 2235, 2123, 2152, 2227, 2207, 2137, 2124, 2165, 2180, 2164, 2170, 2196, 2198, 2169, 2150, 2164, 2187, 2202, 2205, 2178, 2102, 2013, 1990, 2034, 2051, 1981, 1895, 1874, 1881, 1842, 1786, 1801, 1880, 1946, 1942, 1856, 1743, 1723, 1846, 1973, 1942, 1794, 1691, 1667, 1640, 1597, 1597, 1615, 1556, 1421, 1327, 1317, 1305, 1241, 1181, 1136, 1024, 874, 839, 922, 945, 836, 730, 710, 709, 677, 669, 705, 722, 685, 650, 650, 645, 598, 541, 498, 427, 292, 149, 56, 1, -50, -93, -134, -213, -332, -445, -524, -578, -614, -630, -656, -718, -798, -835, -811, -773, -775, -798, -792, -755, -736, -759, -783, -767, -737, -742, -769, -764, -708, -634, -565, -508, -468, -445, -428, -415, -439, -504, -551, -515, -445, -474, -635, -797, -826, -737, -627, -563, -556, -589, -629, -647, -637, -576, -443, -300, -252, -301, -347, -345, -332, -317, -293, -306, -391, -495, -567, -624, -660, -639, -609, -656, -750, -800, -794, -760, -669, -540, -518, -680, -888, -952, -870, -807, -886, -1108, -1402, -1685, -1902, -2020, -2043, -2039, -2106, -2243, -2352, -2362, -2298, -2165, -1922, -1632, -1454, -1396, -1296, -1093, -906, -796, -700, -598, -534, -483, -375, -242, -158, -99, 20, 229, 497, 831, 1230, 1597, 1826, 1990, 2267, 2668, 3035, 3309, 3567, 3792, 3886, 3919, 4068, 4315, 4474, 4503, 4568, 4770, 5013, 5199, 5372, 5619, 5898, 6099, 6218, 6374, 6622, 6850, 6946, 6928, 6890, 6852, 6831, 6894, 7010, 7022, 6899, 6824, 6878, 6916, 6884, 6930, 7086, 7186, 7155, 7109, 7094, 7049, 6996, 7007, 7017, 6882, 6613, 6352, 6180, 6059, 5936, 5807, 5660, 5445, 5177, 4967, 4907, 4899, 4761, 4475, 4204, 4059, 3960, 3797, 3593, 3392, 3130, 2767, 2415, 2221, 2135, 1976, 1678, 1353, 1082, 855, 716, 730, 760, 576, 218, -50, -172, -317, -522, -691, -875, -1218, -1643, -1944, -2116, -2320, -2607, -2879, -3091, -3297, -3520, -3698, -3799, -3899, -4072, -4284, -4453, -4583, -4737, -4916, -5077, -5236, -5457, -5702, -5850, -5880, -5937, -6095, -6247, -6273, -6226, -6237, -6283, -6241, -6109, -6014, -5994, -5940, -5788, -5623, -5521, -5452, -5389, -5366, -5384, -5355, -5247, -5140, -5108, -5127, -5114, -5041, -4957, -4895, -4805, -4644, -4493, -4458, -4477, -4401, -4264, -4254, -4384, -4472, -4451, -4454, -4541, -4633, -4693, -4774, -4862, -4861, -4769, -4706, -4724, -4727, -4652, -4576, -4548, -4495, -4382, -4309, -4315, -4287, -4181, -4122, -4154, -4150, -4043, -3966, -4010, -4062, -3989, -3847, -3776, -3778, -3743, -3653, -3586, -3544, -3447, -3299, -3205, -3200, -3191, -3124, -3049, -3003, -2929, -2812, -2765, -2854, -2968, -2961, -2853, -2750, -2664, -2557, -2491, -2538, -2593, -2470, -2198, -2025, -2081, -2211, -2239, -2197, -2181, -2170, -2132, -2133, -2215, -2307, -2338, -2329, -2326, -2337, -2363, -2402, -2436, -2457, -2464, -2444, -2406, -2401, -2436, -2465, -2468, -2485, -2492, -2421, -2311, -2298, -2391, -2433, -2348, -2229, -2173, -2166, -2160, -2130, -2075, -2006, -1947, -1887, -1797, -1680, -1614, -1642, -1696, -1669, -1572, -1523, -1582, -1659, -1655, -1602, -1603, -1655, -1659, -1603, -1583, -1653, -1732, -1741, -1713, -1713, -1745, -1792, -1857, -1929, -1965, -1947, -1924, -1946, -2001, -2036, -2017, -1950, -1862, -1773, -1697, -1634, -1538, -1354, -1103, -906, -829, -768, -585, -321, -153, -144, -148, -20, 190, 342, 400, 445, 532, 651, 788, 908, 948, 942, 1030, 1230, 1358, 1318, 1257, 1297, 1363, 1387, 1425, 1492, 1506, 1459, 1463, 1566, 1670, 1694, 1686, 1730, 1809, 1854, 1863, 1886, 1931, 1964, 1983, 2005, 2020, 2023, 2040, 2057, 2027, 1958, 1922, 1954, 2003, 2011, 1983, 1957, 1951, 1966, 1998, 2044, 2080, 2080, 2048, 2025, 2040, 2074, 2098, 2110, 2117, 2104, 2066, 2055, 2105, 2169, 2182, 2162, 2171, 2211, 2236, 2235, 2249, 2296, 2332, 2314, 2261, 2229, 2252, 2294, 2292, 2223, 2132, 2088, 2106, 2132, 2106, 2029, 1950, 1906, 1886, 1858, 1799, 1713, 1628, 1569, 1545, 1525, 1489, 1449, 1442, 1461, 1450, 1375, 1287, 1263, 1313, 1371, 1370, 1325, 1295, 1316, 1375, 1453, 1548, 1656, 1755, 1825, 1882, 1964, 2084, 2214, 2310, 2353, 2369, 2401, 2463, 2540, 2605, 2652, 2685, 2694, 2678, 2669, 2722, 2827, 2907, 2891, 2812, 2761, 2783, 2827, 2836, 2819, 2814, 2813, 2764, 2658, 2563, 2543, 2579, 2599, 2561, 2491, 2452, 2465, 2514, 2554, 2529, 2430, 2340, 2349, 2420, 2437, 2370, 2295, 2265, 2257, 2253, 2283, 2344, 2388, 2379, 2334, 2302, 2326, 2383, 2389, 2306, 2197, 2133, 2098, 2046, 1978, 1911, 1821, 1694, 1569, 1496, 1458, 1406, 1342, 1294, 1250, 1180, 1117, 1114, 1143, 1121, 1050, 1005, 1001, 984, 928, 851, 771, 721, 720, 715, 636, 517, 450, 432, 387, 310, 268, 281, 315, 349, 377, 368, 313, 287, 374, 515, 554, 456, 357, 344, 343, 282, 187, 82, -44, -152, -192, -213, -277, -325, -284, -208, -185, -195, -148, -26, 109, 190, 194, 173, 212, 313, 369, 293, 144, 65, 107, 184, 217, 227, 260, 302, 341, 417, 551, 687, 772, 832, 914, 1013, 1113, 1209, 1289, 1327, 1319, 1304, 1317, 1354, 1384, 1398, 1444, 1560, 1710, 1802, 1821, 1845, 1916, 1985, 1994, 1971, 1956, 1931, 1863, 1787, 1761, 1769, 1734, 1650, 1592, 1621, 1698, 1756, 1778, 1793, 1831, 1914, 2029, 2127, 2185, 2208, 2192, 2130, 2065, 2051, 2056, 1996, 1838, 1614, 1369, 1160, 1018, 869, 601, 238, -83, -305, -473, -617, -767, -959, -1160, -1290, -1388, -1543, -1665, -1609, -1478, -1519, -1718, -1808, -1698, -1589, -1632, -1728, -1755, -1765, -1822, -1846, -1789, -1790, -1934, -2057, -2019, -1943, -1979, -2053, -2049, -2032, -2078, -2117, -2079, -2046, -2103, -2190, -2214, -2205, -2252, -2327, -2348, -2338, -2391, -2478, -2469, -2349, -2250, -2227, -2173, -2025, -1902, -1883, -1839, -1665, -1500, -1461, -1416, -1264, -1157, -1172, -1125, -939, -808, -793, -714, -527, -402, -374, -282, -96, 42, 98, 184, 330, 436, 483, 582, 776, 934, 982, 1016, 1129, 1253, 1316, 1372, 1441, 1459, 1438, 1495, 1648, 1776, 1812, 1802, 1823, 1924, 2097, 2242, 2275, 2264, 2322, 2425, 2484, 2496, 2502, 2476, 2394, 2324, 2297, 2263, 2208, 2195, 2235, 2252, 2215, 2176, 2192, 2257, 2317, 2307, 2219, 2126, 2092, 2080, 2001, 1861, 1766, 1752, 1721, 1567, 1316, 1088, 956, 895, 849, 795, 712, 581, 435, 357, 355, 320, 166, -23, -118, -132, -185, -305, -422, -507, -612, -760, -904, -994, -1026, -1021, -1014, -1023, -1039, -1063, -1096, -1108, -1082, -1089, -1195, -1334, -1395, -1416, -1521, -1686, -1784, -1807, -1870, -2023, -2189, -2296, -2340, -2363, -2410, -2503, -2633, -2771, -2892, -2966, -2994, -3048, -3193, -3367, -3465, -3504, -3585, -3702, -3742, -3699, -3700, -3817, -3956, -3993, -3942, -3917, -3977, -4058, -4068, -4000, -3915, -3867, -3858, -3873, -3895, -3891, -3845, -3796, -3794, -3834, -3859, -3840, -3819, -3838, -3884, -3912, -3900, -3871, -3848, -3821, -3768, -3704, -3672, -3675, -3650, -3566, -3477, -3458, -3492, -3504, -3451, -3372, -3312, -3281, -3243, -3183, -3125, -3090, -3060, -3005, -2933, -2880, -2859, -2855, -2854, -2842, -2788, -2685, -2592, -2583, -2649, -2693, -2647, -2555, -2514, -2533, -2554, -2546, -2545, -2571, -2596, -2589, -2562, -2561, -2605, -2657, -2662, -2640, -2654, -2701, -2705, -2668, -2665, -2693, -2673, -2622, -2632, -2685, -2672, -2587, -2525, -2519, -2508, -2459, -2393, -2323, -2255, -2238, -2302, -2390, -2393, -2279, -2144, -2102, -2153, -2187, -2117, -1957, -1830, -1846, -1950, -1984, -1906, -1846, -1880, -1935, -1963, -2021, -2098, -2101, -2054, -2097, -2243, -2330, -2264, -2151, -2111, -2127, -2120, -2092, -2077, -2044, -1949, -1840, -1788, -1777, -1743, -1674, -1580, -1458, -1346, -1292, -1265, -1214, -1179, -1181, -1123, -942, -771, -756, -809, -735, -528, -368, -343, -342, -250, -98, 47, 176, 265, 274, 272, 357, 457, 453, 449, 623, 900, 1037, 993, 941, 996, 1138, 1312, 1449, 1494, 1512, 1628, 1861, 2101, 2237, 2250, 2227, 2303, 2507, 2669, 2638, 2534, 2594, 2836, 3062, 3163, 3205, 3252, 3290, 3336, 3441, 3588, 3679, 3675, 3660, 3729, 3849, 3920, 3913, 3887, 3896, 3917, 3929, 3951, 3985, 3985, 3957, 3977, 4084, 4207, 4274, 4272, 4205, 4126, 4164, 4331, 4422, 4291, 4120, 4137, 4256, 4247, 4124, 4069, 4103, 4085, 3972, 3893, 3942, 4059, 4126, 4095, 3974, 3803, 3666, 3673, 3815, 3930, 3875, 3717, 3637, 3690, 3758, 3751, 3676, 3551, 3390, 3293, 3346, 3419, 3298, 3003, 2778, 2764, 2870, 2931, 2853, 2670, 2532, 2539, 2615, 2636, 2619, 2626, 2609, 2527, 2452, 2434, 2416, 2360, 2286, 2159, 1966, 1850, 1901, 1966, 1899, 1805, 1819, 1877, 1895, 1938, 2022, 2044, 1976, 1911, 1944, 2113, 2382, 2530, 2346, 1980, 1810, 1892, 1902, 1698, 1539, 1643, 1848, 1868, 1676, 1509, 1547, 1684, 1664, 1466, 1353, 1474, 1641, 1666, 1632, 1648, 1651, 1603, 1587, 1577, 1462, 1330, 1372, 1503, 1437, 1171, 1028, 1188, 1444, 1520, 1417, 1319, 1319, 1398, 1521, 1607, 1542, 1364, 1263, 1282, 1285, 1232, 1199, 1116, 886, 688, 765, 996, 1067, 949, 869, 916, 971, 963, 934, 940, 968, 948, 833, 680, 588, 546, 453, 315, 248, 298, 382, 461, 583, 764, 915, 964, 945, 927, 917, 887, 831, 772, 717, 656, 597, 572, 558, 478, 316, 171, 143, 193, 225, 247, 315, 388, 363, 257, 187, 209, 246, 192, 22, -202, -366, -380, -261, -143, -155, -279, -365, -311, -205, -209, -311, -322, -181, -72, -117, -162, -37, 142, 155, 6, -115, -106, -37, 1, -20, -100, -184, -163, 0, 149, 67, -217, -402, -271, 1, 77, -54, -119, -52, -89, -280, -371, -278, -199, -214, -213, -229, -348, -419, -311, -252, -464, -738, -760, -580, -445, -420, -421, -411, -391, -355, -309, -283, -295, -354, -468, -604, -627, -459, -268, -310, -531, -612, -488, -453, -618, -721, -628, -559, -657, -745, -673, -548, -497, -501, -527, -593, -678, -705, -690, -762, -969, -1137, -1072, -852, -799, -1051, -1342, -1379, -1276, -1330, -1538, -1668, -1671, -1667, -1662, -1624, -1632, -1691, -1673, -1594, -1641, -1789, -1843, -1828, -1937, -2129, -2190, -2097, -1988, -1919, -1900, -1965, -2056, -2036, -1916, -1846, -1872, -1893, -1849, -1775, -1719, -1709, -1766, -1857, -1934, -1997, -2042, -2045, -2079, -2241, -2404, -2351, -2177, -2175, -2296, -2226, -1972, -1863, -1966, -2017, -1908, -1784, -1759, -1839, -1982, -2060, -1956, -1778, -1738, -1814, -1811, -1688, -1562, -1523, -1569, -1641, -1604, -1402, -1207, -1224, -1363, -1368, -1241, -1234, -1452, -1680, -1713, -1632, -1615, -1663, -1685, -1698, -1733, -1708, -1595, -1544, -1613, -1653, -1597, -1558, -1577, -1599, -1658, -1750, -1688, -1470, -1408, -1598, -1700, -1545, -1382, -1351, -1300, -1216, -1251, -1298, -1143, -913, -906, -1084, -1180, -1112, -997, -926, -895, -866, -818, -792, -856, -948, -967, -1000, -1197, -1432, -1416, -1167, -1034, -1173, -1307, -1162, -884, -765, -792, -770, -722, -761, -762, -561, -337, -339, -440, -403, -338, -442, -604, -659, -728, -971, -1224, -1205, -930, -708, -777, -1041, -1212, -1169, -1079, -1123, -1254, -1366, -1449, -1435, -1178, -793, -690, -994, -1284, -1164, -805, -623, -662, -677, -593, -556, -574, -506, -403, -469, -664, -758, -786, -1002, -1337, -1408, -1147, -937, -1002, -1072, -864, -559, -531, -778, -953, -890, -771, -781, -874, -890, -750, -534, -441, -500, -436, -96, 165, -41, -493, -653, -451, -256, -271, -374, -456, -520, -517, -409, -342, -477, -684, -700, -556, -552, -738, -802, -598, -420, -517, -648, -483, -219, -292, -581, -614, -450, -485, -530, -166, 180, -156, -711, -531, 159, 380, 14, -260, -170, 54, 233, 238, -8, -267, -260, -163, -240, -311, -144, 1, -156, -351, -162, 282, 511, 422, 339, 431, 489, 375, 296, 436, 563, 363, 0, -71, 205, 414, 364, 326, 455, 497, 331, 271, 512, 736, 613, 332, 287, 501, 652, 538, 263, 40, 6, 160, 317, 222, -52, -79, 284, 591, 458, 171, 166, 357, 424, 410, 580, 909, 1116, 1087, 977, 973, 1100, 1282, 1442, 1492, 1345, 1066, 950, 1199, 1527, 1463, 1078, 945, 1260, 1548, 1471, 1289, 1309, 1425, 1456, 1456, 1466, 1367, 1179, 1142, 1361, 1589, 1558, 1354, 1301, 1538, 1888, 2127, 2214, 2194, 2064, 1882, 1826, 1956, 2051, 1901, 1634, 1499, 1470, 1385, 1261, 1199, 1169, 1145, 1247, 1523, 1794, 1888, 1814, 1691, 1657, 1810, 2046, 2083, 1827, 1599, 1728, 2064, 2192, 2068, 2053, 2252, 2321, 2106, 1985, 2220, 2437, 2192, 1732, 1639, 1890, 1906, 1511, 1204, 1313, 1499, 1413, 1267, 1336, 1452, 1387, 1245, 1190, 1183, 1163, 1136, 1112, 1139, 1273, 1394, 1395, 1452, 1630, 1563, 1117, 849, 1090, 1308, 1060, 755, 766, 735, 417, 283, 650, 1009, 864, 548, 607, 857, 749, 350, 190, 308, 262, 51, 141, 500, 474, -108, -518, -184, 444, 591, 265, 158, 581, 1041, 1046, 836, 880, 1016, 787, 382, 396, 749, 829, 588, 514, 625, 557, 398, 455, 517, 252, -83, -91, 142, 311, 255, -50, -371, -296, 90, 203, -10, 40, 359, 279, -176, -244, 180, 472, 510, 648, 829, 851, 899, 1003, 800, 338, 86, 32, -123, -182, 41, 68, -304, -422, -10, 224, -48, -178, 149, 356, 88, -263, -324, -144, 72, 86, -195, -429, -223, 124, 30, -350, -344, 97, 293, -45, -360, -113, 423, 607, 293, -119, -323, -371, -385, -388, -424, -524, -585, -521, -450, -528, -678, -639, -302, 100, 212, 9, -101, 163, 497, 442, 110, -26, 95, 119, -46, -116, 19, 106, 12, -9, 260, 608, 651, 344, 16, -32, 202, 449, 371, -29, -251, 109, 653, 596, -80, -519, -185, 418, 499, 5, -458, -493, -311, -281, -378, -303, 3, 235, 140, -107, -105, 245, 571, 496, 151, 29, 313, 566, 304, -275, -515, -208, 127, 47, -246, -331, -195, -144, -315, -565, -701, -656, -508, -411, -447, -463, -206, 219, 342, 45, -112, 218, 571, 468, 198, 185, 313, 411, 604, 806, 685, 316, 94, 20, -144, -238, 23, 337, 184, -201, -52, 685, 1148, 865, 501, 748, 1206, 1103, 495, -1, -158, -185, -262, -431, -651, -727, -531, -309, -390, -651, -662, -387, -281, -592, -905, -710, -166, 98, -128, -425, -422, -289, -360, -597, -695, -599, -584, -777, -894, -662, -280, -154, -311, -405, -303, -246, -392, -552, -571, -658, -965, -1162, -942, -738, -1188, -1959, -2010, -1107, -196, -54, -391, -551, -385, -145, -21, -13, -71, -197, -422, -614, -541, -264, -164, -325, -316, 100, 530, 553, 295, 111, 130, 269, 299, -9, -461, -491, -26, 285, 87, -173, -86, 108, 88, -82, -215, -188, 103, 516, 620, 304, 25, 144, 458, 595, 438, 131, 13, 314, 669, 421, -314, -634, -176, 345, 296, -30, -76, 173, 419, 574, 718, 806, 753, 666, 734, 920, 985, 817, 555, 382, 343, 337, 211, -31, -132, 28, 139, -23, -96, 260, 666, 640, 453, 616, 1024, 1221, 1087, 755, 345, 79, 189, 508, 594, 333, 87, 169, 455, 607, 501, 353, 363, 373, 47, -565, -944, -727, -266, -255, -800, -1252, -1108, -671, -480, -562, -678, -803, -877, -617, -85, 146, -137, -382, -203, -65, -488, -1079, -1092, -604, -422, -827, -1116, -734, -261, -591, -1426, -1594, -904, -472, -862, -1165, -617, 79, -21, -591, -706, -353, -237, -547, -740, -473, -98, -139, -636, -1184, -1378, -1151, -827, -805, -1029, -928, -226, 429, 164, -847, -1457, -1085, -544, -811, -1605, -1908, -1471, -924, -724, -751, -804, -833, -845, -910, -1060, -1113, -967, -960, -1400, -1868, -1589, -620, -1, -423, -1263, -1428, -853, -464, -809, -1400, -1461, -819, -63, 30, -606, -1105, -803, -292, -508, -1175, -1226, -518, 0, -263, -859, -1095, -844, -461, -320, -548, -931, -1037, -677, -269, -392, -934, -1195, -875, -391, -171, -280, -690, -1190, -1249, -705, -212, -336, -685, -585, -72, 317, 269, -138, -565, -583, -110, 388, 469, 245, 39, -118, -335, -515, -445, -93, 261, 139, -617, -1422, -1483, -827, -204, 39, 241, 564, 690, 521, 423, 482, 234, -473, -946, -595, 106, 310, 39, -152, -266, -609, -922, -775, -408, -295, -372, -363, -297, -196, 136, 520, 319, -560, -1186, -807, -61, -111, -891, -1256, -783, -257, -199, -131, 335, 703, 479, 60, 45, 216, -79, -750, -970, -422, 196, 229, -31, 17, 283, 327, 347, 912, 1793, 2011, 1279, 539, 651, 1206, 1178, 395, -310, -229, 463, 1164, 1536, 1641, 1642, 1608, 1482, 1210, 900, 731, 639, 310, -292, -602, -158, 510, 469, -68, 105, 1171, 1748, 1022, 0, -182, 182, 331, 352, 673, 1142, 1297, 1096, 940, 1152, 1504, 1305, 218, -1019, -1165, 21, 1268, 1269, 364, 27, 767, 1497, 1233, 443, 173, 581, 972, 841, 339, -67, -97, 158, 412, 500, 431, 228, -45, -155, 118, 618, 869, 577, -28, -306, 198, 1050, 1132, 77, -933, -580, 821, 1773, 1479, 488, -175, 57, 886, 1295, 661, -279, -301, 519, 890, 281, -247, 294, 1274, 1436, 875, 820, 1572, 1917, 981, -377, -725, -4, 481, -99, -966, -777, 544, 1654, 1502, 604, 170, 418, 442, -225, -781, -476, 54, -80, -356, 191, 1025, 962, 222, -150, -22, 181, 339, 161, -585, -1051, -508, -99, -964, -1826, -1117, 155, 330, -163, -286, -392, -792, -628, 300, 727, 95, -390, 202, 1001, 814, 17, -192, 263, 369, -206, -656, -467, -209, -530, -1227, -1589, -1197, -338, 196, -51, -605, -661, -131, 463, 815, 906, 569, -312, -1376, -1937, -1489, -193, 885, 631, -537, -848, 333, 1417, 880, -680, -1710, -1619, -801, 0, -53, -1128, -2129, -1918, -890, -364, -902, -1965, -2696, -2614, -2036, -1872, -2396, -2723, -2164, -1389, -1294, -1530, -1207, -380, 140, 119, 120, 546, 1111, 1387, 1392, 1407, 1528, 1605, 1528, 1325, 1092, 998, 1245, 1735, 1893, 1254, 237, -263, -73, 148, -30, -458, -934, -1198, -783, 202, 840, 767, 799, 1359, 1619, 1035, 334, 206, 287, 127, 27, 304, 612, 653, 851, 1574, 2313, 2457, 2295, 2278, 2055, 1403, 1114, 1652, 2018, 1341, 458, 504, 979, 757, 175, 382, 1024, 571, -944, -1755, -1330, -1038, -1319, -1095, -400, -436, -878, -389, 558, 546, -109, -303, -192, -152, 195, 592, 211, -480, -531, -629, -1669, -2445, -1591, -321, -498, -1448, -1297, -347, -412, -1377, -1216, 339, 1046, -67, -1079, -673, -262, -1031, -1777, -1353, -691, -896, -1473, -1548, -1160, -630, 78, 849, 1085, 421, -584, -889, -180, 704, 850, 457, 449, 1035, 1394, 974, 451, 784, 1756, 2280, 2022, 1888, 2603, 3453, 3137, 1829, 1150, 1482, 1117, -461, -984, 644, 1939, 1230, 639, 1650, 2140, 844, -57, 581, 788, -215, -495, 537, 1029, 374, 206, 1322, 2447, 2316, 1232, 447, 728, 1521, 1615, 770, 41, 196, 725, 861, 685, 669, 845, 945, 844, 511, -102, -829, -1240, -1136, -847, -756, -714, -376, 79, 141, -213, -432, -71, 753, 1338, 864, -470, -1142, -193, 1077, 818, -532, -940, 27, 698, 103, -667, -598, -409, -778, -690, 617, 1669, 991, -295, -430, 164, 303, 231, 359, -12, -935, -987, 291, 1228, 583, -502, -430, 411, 560, -102, -464, -245, -245, -664, -851, -671, -621, -684, -498, -359, -812, -1584, -1909, -1573, -985, -540, -268, 94, 691, 1168, 1088, 711, 715, 1158, 1512, 1616, 1705, 1677, 1282, 745, 390, 20, -543, -832, -415, 272, 477, 131, -151, 86, 559, 503, -382, -1387, -1622, -1167, -728, -458, -55, 279, 71, -473, -715, -520, -175, 223, 637, 835, 798, 854, 1069, 1050, 611, 117, -55, -47, -333, -1045, -1535, -1050, -62, -55, -1354, -2350, -1829, -765, -615, -1148, -1226, -585, 278, 1004, 1251, 612, -553, -1026, -413, -90, -1132, -2195, -1418, 321, 607, -619, -1267, -691, -186, -407, -850, -1246, -1465, -1067, -281, -47, -317, -40, 777, 867, -61, -681, -133, 690, 628, -88, -498, -484, -658, -1086, -1275, -1268, -1632, -2261, -2239, -1193, 12, 339, -218, -865, -1015, -685, -228, -44, -277, -483, -33, 907, 1318, 684, -105, 68, 890, 1070, 336, -282, -312, -453, -984, -1169, -736, -363, -411, -641, -998, -1332, -1005, -29, 505, 231, 257, 1117, 1737, 1322, 614, 428, 415, -44, -779, -1155, -910, -431, -335, -663, -859, -880, -1379, -2195, -2225, -1526, -1397, -1753, -1230, -138, 90, 147, 1558, 3060, 2475, 845, 507, 905, 268, -696, -411, 341, -105, -1227, -1326, -472, -331, -1431, -2401, -2014, -583, 923, 1847, 1753, 814, 208, 723, 1348, 777, -457, -1010, -955, -1238, -1683, -1326, -364, -78, -789, -1283, -735, -22, -296, -1164, -1335, -561, 245, 572, 819, 1146, 1028, 358, -73, 191, 586, 685, 930, 1535, 1791, 1230, 488, 374, 799, 968, 300, -715, -781, 367, 1055, 6, -1306, -715, 1131, 1737, 561, -606, -691, -418, -386, -151, 357, 419, 182, 898, 2507, 2971, 1429, 9, 622, 1819, 1098, -1053, -1917, -736, 494, 481, 213, 378, 28, -997, -1251, -436, 38, -139, -142, -394, -1443, -1849, -875, -705, -2370, -3012, -743, 1748, 1675, 344, 132, 734, 752, 334, 341, 636, 657, 587, 833, 1090, 1016, 1049, 1355, 1055, -72, -526, 508, 1463, 885, -242, -399, 81, 81, -451, -931, -1187, -1251, -1005, -495, 25, 477, 895, 1034, 562, -262, -597, -28, 650, 332, -586, -328, 1550, 2844, 1699, -390, -814, 218, 617, 60, -134, 267, 443, 369, 453, 259, -654, -1516, -1324, -408, 53, -315, -728, -511, -97, -274, -796, -578, 644, 1652, 1220, -64, -273, 1223, 2532, 1911, 594, 754, 1697, 1153, -643, -1569, -1287, -992, -841, -637, -1247, -2675, -2979, -1343, 164, -227, -1394, -1460, -554, 51, 83, 180, 455, 373, -144, -517, -441, -120, 342, 917, 1188, 850, 330, 135, 97, -98, -309, -293, -1, 532, 960, 685, -116, -369, 293, 807, 283, -732, -1205, -824, -9, 407, -324, -1863, -2727, -2086, -921, -541, -736, -402, 627, 1477, 1636, 1472, 1316, 932, 218, -281, -128, 208, 121, 90, 925, 1904, 1385, -353, -965, 342, 1256, -116, -2236, -2490, -939, 285, 246, -99, 0, 27, -497, -931, -524, 310, 678, 702, 1207, 2078, 2178, 1171, 302, 655, 1471, 1260, 125, -392, 132, 334, -455, -835, 258, 1408, 811, -610, -468, 1177, 1664, -52, -1581, -823, 1002, 1936, 2372, 3228, 3527, 2455, 1502, 1937, 2380, 1256, -367, -564, 438, 960, 553, 278, 690, 948, 239, -933, -1581, -1640, -1727, -1970, -1864, -1170, -453, -515, -1197, -1314, -487, 57, -236, 86, 1642, 2437, 1351, 435, 1127, 1553, 376, -344, 973, 2185, 1071, -691, -516, 453, -452, -2203, -1787, -180, -906, -3160, -2836, -57, 1250, 679, 1145, 2325, 1230, -1655, -2891, -1775, -645, -482, -167, 532, 515, -195, -79, 1215, 2001, 1230, 114, -108, -71, -582, -822, 216, 1816, 2505, 2077, 1388, 824, 327, 346, 1087, 1372, 208, -1259, -1513, -1127, -1214, -1310, -1027, -1229, -1753, -1133, 294, 737, 506, 1157, 1882, 1027, -359, -468, 8, -121, -95, 562, 374, -1328, -2796, -2605, -1633, -1273, -1457, -1258, -337, 694, 948, 202, -710, -686, 309, 1064, 623, -309, -152, 1286, 2236, 1213, -792, -1494, -422, 537, -9, -1202, -1728, -1616, -1371, -1042, -949, -1458, -1689, -518, 1077, 1003, -686, -1819, -1227, 117, 818, 395, -731, -1653, -1710, -1107, -412, 226, 779, 949, 732, 531, 294, -418, -1345, -1710, -1465, -1122, -683, -45, 181, -401, -881, -234, 949, 1168, 159, -748, -372, 993, 2151, 2329, 1664, 796, 328, 369, 415, 3, -599, -864, -888, -1157, -1721, -2284, -2724, -2971, -2882, -2620, -2445, -2043, -993, 162, 422, -270, -1070, -1321, -941, -457, -813, -2004, -2468, -1398, -269, -164, 52, 775, 338, -1112, -728, 1883, 3400, 2537, 2021, 3379, 4652, 4409, 3732, 3427, 2733, 1278, -109, -748, -876, -1149, -1862, -2468, -2121, -917, 99, 374, 200, -377, -1511, -2438, -2108, -950, -435, -950, -1576, -1783, -1822, -1530, -334, 1210, 1539, 475, -138, 693, 1501, 1085, 679, 1553, 2777, 3269, 3679, 4433, 4360, 2997, 1967, 2322, 2561, 1166, -624, -807, -77, -610, -2246, -2985, -2787, -3473, -4852, -4498, -2010, -224, -878, -1949, -1088, 690, 1167, 674, 746, 863, -122, -1070, -516, 238, -550, -1568, -573, 1724, 2853, 2280, 1531, 1489, 1449, 651, -379, -526, 208, 479, -502, -1723, -1832, -1124, -966, -1696, -2297, -2109, -1660, -1457, -1019, 120, 1293, 1563, 1177, 1038, 1189, 944, 240, -250, -280, -252, -214, 330, 1226, 1405, 460, -495, -464, 29, 164, 149, 347, 474, 451, 583, 581, 17, -455, -88, 498, 538, 630, 1347, 1751, 955, -255, -771, -878, -1322, -1720, -1223, -159, 374, 353, 873, 2191, 3116, 2778, 1730, 893, 523, 457, 371, -174, -1234, -2290, -2963, -3237, -2929, -1954, -921, -336, 215, 1059, 1650, 1803, 2221, 2889, 2740, 1656, 836, 684, 323, -466, -788, -356, -9, -318, -869, -1065, -840, -509, -335, -326, -369, -489, -751, -898, -482, 455, 1153, 888, -218, -1383, -2002, -2058, -1776, -1289, -791, -716, -1291, -1923, -1637, -425, 501, 335, -95, 475, 1819, 2542, 2062, 1254, 1030, 1196, 1075, 559, -23, -570, -1099, -1344, -1080, -580, -236, -79, -18, -29, 82, 469, 804, 758, 620, 690, 684, 446, 256, 9, -625, -1147, -905, -477, -577, -578, 31, 386, 190, 657, 1907, 2227, 1289, 1039, 2236, 3173, 2747, 2033, 2121, 2620, 2811, 2599, 2069, 1229, 415, 197, 677, 1252, 1344, 1241, 1761, 2885, 3372, 2445, 1104, 648, 735, 349, -269, -374, -325, -718, -1064, -901, -867, -1357, -1617, -1112, -307, 387, 1018, 1365, 1207, 1050, 1358, 1496, 609, -886, -1636, -1026, 152, 644, -23, -1253, -2110, -2167, -1680, -1139, -804, -534, 56, 1120, 2105, 2155, 1145, -158, -1130, -1853, -2463, -2776, -2744, -2519, -2077, -1511, -1353, -1782, -2053, -1604, -1079, -1265, -1617, -1043, 172, 673, 327, 546, 1750, 2372, 1429, 201, 106, 749, 1232, 1491, 1525, 1088, 546, 412, 257, -437, -1189, -1506, -1725, -1869, -1251, -4, 614, 58, -799, -1074, -845, -605, -640, -998, -1438, -1457, -861, -229, -186, -299, 396, 1654, 2177, 1775, 1672, 2214, 2272, 1435, 732, 711, 720, 325, -186, -573, -646, -161, 431, 282, -311, -166, 782, 1419, 1250, 661, -61, -636, -703, -671, -1106, -1281, -522, -83, -907, -1424, -641, -501, -1980, -2742, -1623, -805, -1161, -623, 1073, 1435, 65, -553, 438, 1337, 1131, 345, -547, -1242, -1264, -850, -852, -1289, -1383, -995, -699, -701, -792, -908, -952, -629, 46, 607, 786, 826, 1029, 1341, 1376, 758, -272, -810, -425, 41, -283, -841, -585, 106, -97, -1302, -2138, -1815, -1164, -1122, -1277, -729, 404, 1307, 1654, 1594, 1135, 440, 132, 452, 722, 417, 86, 401, 912, 703, -87, -434, -78, 92, -420, -870, -542, 32, -45, -582, -585, 213, 931, 702, -196, -768, -628, -419, -734, -1231, -1220, -626, 124, 747, 1098, 923, 252, -278, -96, 427, 467, 62, 75, 689, 1001, 596, 316, 744, 1113, 613, -242, -512, -247, -209, -718, -1400, -1817, -1944, -2080, -2403, -2694, -2633, -2286, -2051, -2069, -1979, -1471, -894, -783, -934, -617, 213, 757, 598, 295, 521, 1286, 2101, 2447, 2126, 1538, 1348, 1564, 1461, 701, -45, -99, 136, -153, -777, -790, -127, 174, -339, -791, -411, 281, 423, 93, -61, 116, 248, 135, -75, -232, -194, 295, 1189, 1793, 1553, 959, 953, 1586, 2025, 1773, 1165, 713, 548, 530, 512, 375, 101, -134, -183, -216, -443, -632, -521, -523, -1160, -1933, -1897, -1240, -999, -1350, -1424, -766, 149, 759, 962, 985, 1073, 1100, 684, 8, -251, -214, -753, -1703, -1855, -1209, -1156, -1897, -1938, -789, 66, -244, -501, 356, 1255, 858, 0, 230, 1040, 951, 402, 759, 1470, 1125, 324, 531, 1273, 1150, 403, 177, 482, 536, 137, -304, -315, 202, 588, 215, -204, 364, 1167, 812, -42, 119, 724, 320, -585, -846, -1060, -1934, -2426, -1749, -854, -475, -205, -40, -280, -247, 523, 1008, 656, 580, 1212, 1370, 782, 661, 1225, 1494, 1397, 1495, 1467, 1037, 907, 1100, 456, -1019, -1746, -1188, -515, -400, -392, -273, -180, 105, 582, 605, -10, -512, -442, -239, -326, -539, -593, -397, -11, 269, 110, -314, -450, -204, -105, -410, -653, -423, -89, -256, -776, -920, -510, -285, -859, -1771, -2086, -1665, -1201, -1089, -1043, -873, -799, -863, -816, -701, -725, -608, 75, 953, 1200, 789, 526, 802, 1109, 905, 371, 28, -52, -245, -592, -515, 265, 995, 908, 559, 999, 1924, 2027, 1080, 190, 6, 0, -400, -1035, -1413, -1223, -520, 192, 363, 61, -119, 151, 634, 937, 885, 565, 239, 100, 85, 85, 219, 550, 730, 401, -149, -252, 194, 537, 278, -205, -230, 227, 550, 338, -196, -664, -908, -960, -887, -742, -538, -278, -44, 63, 75, 111, 219, 367, 547, 753, 966, 1211, 1515, 1804, 1971, 2050, 2133, 2159, 1943, 1385, 574, -230, -721, -830, -879, -1190, -1630, -1825, -1723, -1601, -1554, -1383, -1048, -840, -877, -842, -515, -234, -354, -619, -594, -433, -625, -1140, -1467, -1387, -1224, -1259, -1321, -1088, -563, -50, 206, 229, 241, 463, 886, 1237, 1321, 1328, 1558, 1907, 1949, 1544, 1002, 596, 234, -245, -688, -794, -585, -435, -584, -803, -725, -371, -123, -206, -439, -556, -534, -506, -527, -567, -626, -703, -746, -717, -675, -736, -859, -742, -133, 634, 868, 441, 30, 119, 336, 213, -25, 44, 291, 365, 384, 692, 1182, 1427, 1390, 1429, 1591, 1466, 910, 354, 162, 203, 213, 142, -18, -309, -587, -626, -475, -434, -623, -805, -727, -456, -286, -339, -390, -217, 27, 27, -178, -223, 50, 402, 615, 750, 944, 1202, 1417, 1439, 1208, 930, 916, 1152, 1298, 1183, 994, 918, 918, 879, 735, 465, 141, -48, 7, 208, 356, 335, 155, -100, -329, -469, -522, -500, -408, -269, -121, 30, 189, 300, 309, 244, 170, 92, -2, -45, 41, 211, 325, 359, 462, 744, 1066, 1147, 910, 592, 467, 533, 549, 374, 111, -82, -217, -404, -629, -732, -617, -413, -346, -476, -647, -693, -642, -663, -827, -1004, -1025, -897, -769, -703, -592, -353, -111, -79, -250, -374, -272, -79, -41, -198, -371, -383, -225, -62, -72, -225, -285, -152, -26, -84, -169, -44, 225, 364, 270, 76, -102, -291, -513, -681, -704, -648, -674, -846, -1035, -1050, -867, -696, -764, -988, -1027, -737, -382, -260, -303, -248, -36, 165, 243, 241, 256, 344, 528, 771, 952, 969, 903, 938, 1117, 1309, 1431, 1535, 1668, 1810, 1927, 1992, 1942, 1738, 1444, 1160, 920, 684, 450, 267, 158, 97, 90, 146, 192, 174, 195, 328, 402, 259, 76, 82, 171, 172, 180, 291, 368, 352, 402, 520, 482, 293, 261, 473, 638, 561, 433, 493, 662, 693, 523, 278, 12, -325, -685, -887, -895, -906, -1040, -1129, -1008, -852, -954, -1252, -1389, -1226, -1010, -962, -970, -841, -625, -476, -345, -78, 250, 415, 390, 380, 481, 539, 428, 240, 165, 235, 281, 142, -107, -248, -240, -283, -472, -624, -572, -430, -402, -485, -543, -580, -683, -778, -700, -533, -539, -710, -778, -707, -769, -1029, -1200, -1124, -995, -963, -897, -673, -428, -327, -315, -248, -181, -306, -650, -1003, -1169, -1134, -994, -862, -853, -1003, -1184, -1226, -1139, -1094, -1138, -1071, -735, -324, -210, -408, -491, -248, -62, -324, -777, -909, -729, -588, -493, -172, 294, 504, 371, 248, 312, 288, -43, -452, -629, -639, -692, -751, -690, -564, -459, -293, -13, 211, 215, 85, 0, -30, -108, -237, -348, -465, -603, -626, -432, -188, -106, -111, -29, 86, 90, 51, 106, 183, 120, -44, -155, -258, -541, -965, -1259, -1340, -1394, -1498, -1527, -1478, -1462, -1378, -1040, -561, -173, 184, 702, 1248, 1544, 1623, 1748, 1937, 1961, 1767, 1623, 1726, 1882, 1755, 1372, 1085, 1009, 832, 411, 96, 105, 58, -367, -825, -856, -612, -486, -466, -371, -289, -348, -378, -173, 159, 418, 652, 1016, 1394, 1514, 1367, 1214, 1165, 1084, 931, 861, 954, 1099, 1183, 1191, 1103, 905, 659, 464, 316, 135, -99, -290, -354, -323, -290, -295, -332, -386, -439, -461, -436, -378, -282, -130, 51, 165, 177, 218, 433, 782, 1102, 1310, 1399, 1382, 1385, 1576, 1818, 1742, 1282, 795, 505, 231, -184, -597, -884, -1195, -1705, -2340, -2975, -3676, -4547, -5477, -6263, -6885, -7425, -7820, -7996, -8110, -8329, -8498, -8343, -7890, -7430, -7058, -6579, -5835, -4934, -4032, -3114, -2091, -1003, 39, 1016, 1980, 2936, 3864, 4794, 5737, 6590, 7220, 7639, 7992, 8356, 8651, 8769, 8719, 8591, 8481, 8441, 8414, 8285, 8070, 7913, 7811, 7612, 7314, 7060, 6831, 6535, 6283, 6200, 6122, 5918, 5794, 5868, 5895, 5751, 5680, 5785, 5871, 5895, 5980, 6040, 5949, 5900, 6082, 6314, 6398, 6415, 6421, 6342, 6298, 6471, 6670, 6537, 6146, 5870, 5759, 5518, 5044, 4564, 4201, 3807, 3284, 2787, 2381, 1857, 1084, 289, -310, -820, -1405, -2010, -2563, -3151, -3784, -4254, -4448, -4566, -4850, -5217, -5377, -5250, -5076, -5065, -5114, -4997, -4729, -4498, -4320, -4039, -3658, -3359, -3170, -2950, -2706, -2574, -2508, -2394, -2341, -2498, -2723, -2811, -2869, -3128, -3520, -3797, -3932, -4131, -4467, -4789, -4986, -5129, -5260, -5322, -5338, -5418, -5504, -5430, -5233, -5081, -4946, -4678, -4313, -3995, -3712, -3369, -2987, -2620, -2226, -1775, -1350, -1019, -721, -364, 34, 395, 692, 960, 1201, 1423, 1654, 1849, 1872, 1742, 1680, 1751, 1721, 1459, 1158, 977, 825, 606, 331, -34, -495, -872, -1068, -1292, -1723, -2194, -2485, -2664, -2907, -3206, -3480, -3726, -3957, -4110, -4144, -4115, -4127, -4210, -4306, -4340, -4311, -4275, -4274, -4274, -4213, -4083, -3959, -3864, -3707, -3445, -3234, -3207, -3234, -3115, -2912, -2803, -2767, -2693, -2636, -2676, -2706, -2592, -2391, -2272, -2319, -2482, -2600, -2563, -2512, -2650, -2848, -2879, -2892, -3104, -3249, -3031, -2784, -2908, -3088, -2887, -2557, -2512, -2554, -2323, -1950, -1709, -1503, -1146, -724, -407, -167, 121, 516, 965, 1391, 1772, 2153, 2523, 2800, 2985, 3189, 3435, 3590, 3612, 3639, 3750, 3832, 3799, 3724, 3693, 3682, 3642, 3555, 3401, 3188, 2970, 2802, 2681, 2581, 2476, 2315, 2051, 1752, 1581, 1576, 1546, 1349, 1135, 1091, 1079, 871, 586, 505, 555, 424, 115, -62, -18, 5, -128, -230, -136, 6, -44, -245, -314, -158, -13, -94, -266, -297, -230, -247, -303, -234, -110, -178, -452, -688, -760, -794, -930, -1148, -1346, -1471, -1537, -1580, -1615, -1663, -1754, -1880, -1935, -1827, -1621, -1500, -1538, -1593, -1483, -1245, -1057, -940, -775, -587, -540, -585, -496, -261, -98, -58, -10, 62, 83, 94, 136, 119, 33, -20, -95, -346, -674, -835, -855, -952, -1135, -1253, -1334, -1512, -1745, -1879, -1891, -1880, -1884, -1852, -1762, -1645, -1511, -1318, -1065, -830, -675, -577, -468, -329, -176, 10, 238, 424, 464, 395, 379, 486, 618, 655, 561, 390, 261, 265, 298, 172, -74, -206, -185, -261, -556, -835, -891, -918, -1172, -1492, -1569, -1566, -1848, -2232, -2224, -1914, -1879, -2188, -2363, -2276, -2301, -2502, -2473, -2096, -1820, -1895, -1907, -1465, -862, -523, -297, 148, 648, 905, 1082, 1464, 1922, 2187, 2280, 2333, 2379, 2479, 2701, 2910, 2890, 2694, 2592, 2664, 2719, 2664, 2668, 2812, 2877, 2719, 2587, 2741, 3010, 3072, 2936, 2851, 2911, 3024, 3070, 2983, 2771, 2523, 2262, 1922, 1486, 982, 314, -601, -1600, -2487, -3363, -4386, -5401, -6148, -6683, -7185, -7596, -7758, -7735, -7668, -7480, -7002, -6258, -5454, -4665, -3744, -2564, -1242, -12, 1126, 2386, 3774, 4985, 5872, 6673, 7555, 8301, 8743, 9079, 9491, 9815, 9899, 9928, 10077, 10198, 10103, 9951, 9981, 10094, 10000, 9714, 9541, 9596, 9694, 9718, 9745, 9798, 9843, 9938, 10117, 10271, 10317, 10352, 10428, 10448, 10400, 10410, 10507, 10561, 10533, 10518, 10567, 10596, 10577, 10591, 10684, 10765, 10763, 10762, 10855, 10975, 10971, 10852, 10739, 10642, 10439, 10071, 9617, 9135, 8577, 7917, 7238, 6560, 5741, 4674, 3517, 2548, 1755, 861, -268, -1388, -2235, -2878, -3527, -4180, -4672, -4973, -5187, -5356, -5413, -5311, -5065, -4724, -4329, -3903, -3436, -2944, -2474, -2034, -1606, -1227, -999, -941, -885, -691, -506, -616, -1011, -1354, -1461, -1564, -1926, -2457, -2878, -3135, -3395, -3742, -4067, -4298, -4494, -4697, -4858, -4973, -5102, -5227, -5256, -5193, -5148, -5162, -5172, -5129, -5033, -4922, -4868, -4887, -4830, -4538, -4068, -3635, -3318, -2985, -2502, -1872, -1216, -660, -234, 180, 717, 1365, 1956, 2373, 2660, 2925, 3192, 3358, 3325, 3111, 2829, 2507, 2045, 1416, 738, 79, -645, -1473, -2266, -2937, -3596, -4330, -5024, -5544, -5939, -6332, -6712, -6958, -7044, -7068, -7093, -7097, -7072, -7015, -6888, -6695, -6546, -6489, -6415, -6269, -6178, -6202, -6218, -6154, -6128, -6220, -6326, -6380, -6468, -6642, -6798, -6841, -6825, -6870, -6981, -7048, -7018, -6989, -7068, -7183, -7203, -7181, -7275, -7431, -7463, -7418, -7534, -7809, -7973, -7939, -7902, -7974, -8027, -7951, -7783, -7566, -7280, -6926, -6547, -6176, -5788, -5302, -4683, -4043, -3507, -3019, -2416, -1725, -1132, -674, -239, 176, 458, 607, 731, 814, 760, 596, 452, 341, 144, -158, -454, -704, -1026, -1461, -1855, -2092, -2279, -2555, -2865, -3087, -3227, -3353, -3445, -3458, -3422, -3396, -3346, -3204, -3007, -2871, -2826, -2758, -2566, -2300, -2070, -1925, -1806, -1620, -1335, -1018, -737, -455, -116, 227, 494, 739, 1061, 1420, 1704, 1912, 2113, 2301, 2418, 2498, 2624, 2782, 2852, 2735, 2481, 2240, 2073, 1870, 1520, 1088, 741, 495, 209, -170, -497, -630, -637, -681, -792, -867, -846, -747, -556, -247, 109, 413, 700, 1074, 1538, 2019, 2495, 2962, 3364, 3673, 3961, 4302, 4664, 4959, 5137, 5232, 5343, 5515, 5649, 5642, 5554, 5531, 5548, 5423, 5116, 4804, 4607, 4388, 4005, 3600, 3384, 3251, 2924, 2441, 2101, 1976, 1816, 1486, 1154, 974, 863, 674, 435, 310, 369, 479, 464, 355, 346, 487, 604, 582, 522, 549, 584, 499, 358, 326, 376, 299, 36, -209, -278, -269, -350, -542, -776, -1002, -1181, -1323, -1508, -1759, -1979, -2158, -2404, -2691, -2839, -2855, -2965, -3221, -3375, -3290, -3188, -3296, -3475, -3445, -3216, -3041, -2979, -2824, -2478, -2110, -1851, -1590, -1203, -780, -483, -289, -50, 273, 538, 627, 627, 696, 845, 953, 987, 1020, 1049, 966, 760, 592, 547, 455, 121, -328, -565, -522, -489, -678, -927, -976, -813, -628, -564, -620, -694, -632, -346, 29, 217, 138, 75, 328, 802, 1146, 1223, 1211, 1272, 1354, 1375, 1342, 1271, 1122, 898, 699, 614, 597, 525, 365, 244, 299, 501, 660, 637, 537, 616, 933, 1209, 1169, 983, 1099, 1589, 1926, 1678, 1192, 1175, 1664, 1921, 1479, 811, 631, 876, 893, 450, -6, -147, -225, -538, -928, -1138, -1288, -1637, -2100, -2367, -2387, -2473, -2849, -3325, -3570, -3613, -3824, -4341, -4823, -4929, -4843, -5019, -5473, -5696, -5373, -4847, -4566, -4369, -3761, -2682, -1534, -486, 695, 2137, 3595, 4934, 6381, 8089, 9765, 11076, 12192, 13476, 14841, 15879, 16493, 16992, 17526, 17897, 17962, 17853, 17685, 17343, 16752, 16136, 15688, 15272, 14649, 13895, 13276, 12842, 12421, 11936, 11510, 11270, 11199, 11190, 11190, 11274, 11498, 11781, 12029, 12312, 12708, 13071, 13210, 13200, 13258, 13389, 13412, 13256, 12990, 12633, 12172, 11658, 11145, 10625, 10030, 9295, 8425, 7551, 6809, 6119, 5268, 4237, 3266, 2479, 1684, 684, -389, -1281, -2019, -2855, -3829, -4728, -5486, -6291, -7175, -7866, -8227, -8532, -9061, -9676, -9973, -9825, -9508, -9307, -9162, -8812, -8216, -7583, -7001, -6298, -5387, -4475, -3750, -3099, -2358, -1617, -1083, -758, -490, -261, -203, -367, -646, -946, -1308, -1767, -2266, -2735, -3205, -3726, -4242, -4662, -4985, -5281, -5549, -5700, -5684, -5550, -5347, -5092, -4798, -4447, -3959, -3334, -2713, -2179, -1662, -1114, -620, -199, 241, 705, 1049, 1252, 1486, 1852, 2235, 2484, 2616, 2740, 2875, 2957, 2973, 2961, 2922, 2821, 2652, 2427, 2128, 1749, 1308, 799, 207, -409, -1030, -1762, -2661, -3582, -4407, -5234, -6133, -6948, -7561, -8113, -8735, -9284, -9555, -9580, -9547, -9497, -9336, -9034, -8686, -8341, -7950, -7496, -7072, -6758, -6490, -6175, -5841, -5617, -5586, -5688, -5802, -5900, -6081, -6436, -6917, -7403, -7859, -8344, -8877, -9396, -9842, -10240, -10637, -11005, -11268, -11391, -11435, -11473, -11495, -11435, -11297, -11138, -10943, -10634, -10202, -9778, -9453, -9134, -8667, -8060, -7473, -6980, -6492, -5926, -5313, -4707, -4090, -3448, -2814, -2192, -1557, -944, -418, 32, 486, 961, 1387, 1686, 1859, 1958, 2024, 2025, 1897, 1645, 1349, 1051, 679, 132, -527, -1106, -1508, -1855, -2298, -2823, -3328, -3755, -4053, -4183, -4260, -4477, -4794, -4921, -4731, -4454, -4335, -4295, -4101, -3718, -3315, -2993, -2677, -2312, -1986, -1764, -1524, -1127, -697, -490, -468, -327, 13, 277, 295, 287, 469, 704, 737, 582, 494, 630, 811, 674, 190, -195, -141, 27, -218, -776, -1081, -1005, -1006, -1332, -1637, -1591, -1425, -1507, -1701, -1571, -1101, -697, -549, -397, 21, 651, 1272, 1749, 2113, 2484, 2883, 3219, 3506, 3916, 4385, 4533, 4226, 3916, 4052, 4382, 4287, 3663, 3039, 2804, 2732, 2456, 2002, 1589, 1241, 903, 659, 569, 498, 331, 137, 38, 94, 295, 516, 586, 552, 676, 1051, 1429, 1583, 1636, 1825, 2120, 2318, 2425, 2633, 2940, 3083, 2965, 2837, 2924, 3100, 3105, 2918, 2691, 2481, 2234, 1961, 1739, 1522, 1157, 642, 207, 6, -127, -455, -957, -1361, -1546, -1673, -1903, -2179, -2387, -2528, -2653, -2758, -2826, -2868, -2871, -2802, -2683, -2600, -2586, -2551, -2373, -2055, -1772, -1669, -1648, -1467, -1071, -678, -463, -342, -142, 137, 390, 608, 846, 1031, 1017, 839, 744, 841, 901, 665, 226, -72, -104, -130, -437, -931, -1237, -1211, -1149, -1375, -1750, -1851, -1584, -1316, -1333, -1445, -1231, -592, 98, 401, 327, 377, 961, 1877, 2517, 2572, 2317, 2234, 2505, 2924, 3134, 2913, 2381, 1913, 1798, 1938, 1942, 1553, 964, 606, 617, 678, 479, 185, 147, 348, 492, 528, 687, 981, 1128, 1074, 1164, 1550, 1832, 1632, 1265, 1316, 1727, 1896, 1611, 1299, 1328, 1527, 1518, 1198, 834, 743, 839, 655, 0, -646, -764, -576, -733, -1359, -1941, -2146, -2238, -2544, -2950, -3217, -3469, -3927, -4429, -4603, -4453, -4319, -4269, -3952, -3163, -2130, -1035, 296, 1996, 3801, 5526, 7388, 9507, 11555, 13290, 14961, 16788, 18551, 19980, 21161, 22236, 23109, 23595, 23715, 23627, 23402, 22919, 22015, 20750, 19413, 18226, 17130, 15958, 14704, 13536, 12526, 11600, 10774, 10253, 10127, 10145, 10064, 10025, 10293, 10837, 11436, 12053, 12751, 13431, 13926, 14267, 14623, 14989, 15190, 15133, 14901, 14534, 13946, 13109, 12147, 11151, 10083, 8925, 7733, 6500, 5159, 3781, 2538, 1502, 549, -467, -1565, -2650, -3636, -4514, -5331, -6113, -6852, -7571, -8291, -8987, -9575, -9995, -10272, -10469, -10610, -10687, -10700, -10617, -10346, -9847, -9258, -8714, -8101, -7237, -6241, -5357, -4534, -3546, -2444, -1501, -791, -187, 316, 607, 687, 652, 505, 133, -488, -1246, -2000, -2717, -3450, -4230, -5020, -5728, -6295, -6740, -7120, -7389, -7418, -7210, -6924, -6587, -6024, -5175, -4208, -3232, -2182, -1054, 30, 1060, 2115, 3121, 3886, 4391, 4792, 5160, 5390, 5397, 5229, 4980, 4660, 4249, 3779, 3282, 2723, 2083, 1420, 793, 198, -390, -998, -1652, -2309, -2866, -3326, -3838, -4438, -4987, -5427, -5903, -6473, -6987, -7353, -7721, -8229, -8755, -9084, -9239, -9415, -9668, -9827, -9761, -9578, -9432, -9272, -8951, -8514, -8151, -7913, -7643, -7273, -6968, -6896, -6998, -7122, -7292, -7641, -8182, -8774, -9334, -9945, -10672, -11436, -12107, -12676, -13228, -13754, -14140, -14317, -14369, -14380, -14294, -13972, -13393, -12668, -11882, -10988, -9921, -8740, -7557, -6418, -5297, -4204, -3173, -2217, -1359, -668, -192, 121, 375, 583, 666, 571, 345, 62, -250, -597, -961, -1346, -1781, -2254, -2695, -3023, -3211, -3294, -3346, -3388, -3337, -3135, -2849, -2541, -2144, -1663, -1289, -1108, -897, -470, -18, 182, 179, 227, 421, 626, 689, 572, 365, 202, 138, 78, -126, -510, -973, -1415, -1822, -2193, -2500, -2804, -3235, -3766, -4158, -4271, -4296, -4515, -4903, -5178, -5187, -5084, -5086, -5205, -5289, -5220, -5011, -4729, -4445, -4195, -3936, -3563, -3040, -2490, -2068, -1767, -1454, -1092, -768, -520, -310, -155, -122, -154, -131, -47, 13, 11, -78, -290, -542, -638, -545, -519, -776, -1157, -1305, -1134, -921, -899, -981, -945, -746, -472, -154, 204, 514, 666, 758, 1009, 1442, 1816, 1949, 1944, 2011, 2216, 2483, 2706, 2811, 2790, 2732, 2734, 2797, 2843, 2806, 2641, 2325, 1927, 1628, 1540, 1520, 1282, 774, 276, 61, 95, 143, 17, -304, -659, -804, -688, -529, -531, -646, -742, -776, -695, -421, -61, 103, -8, -120, 55, 473, 802, 768, 428, 118, 125, 371, 505, 280, -185, -560, -650, -549, -500, -673, -1027, -1337, -1393, -1256, -1215, -1404, -1584, -1471, -1168, -1035, -1108, -1017, -610, -251, -181, -57, 432, 926, 971, 846, 1115, 1610, 1668, 1300, 1223, 1597, 1674, 1136, 802, 1250, 1666, 1125, 254, 355, 1354, 1868, 1277, 576, 897, 1956, 2568, 2281, 1849, 2085, 2841, 3394, 3447, 3329, 3370, 3507, 3559, 3581, 3719, 3891, 3869, 3671, 3587, 3758, 3996, 4082, 4076, 4173, 4414, 4688, 4944, 5246, 5622, 5963, 6167, 6299, 6502, 6696, 6600, 6142, 5645, 5413, 5304, 4939, 4232, 3475, 2949, 2659, 2422, 2059, 1529, 937, 399, -6, -224, -321, -522, -886, -1091, -921, -669, -591, -392, 133, 532, 425, 266, 576, 1049, 1075, 718, 543, 815, 1296, 1655, 1879, 2303, 3241, 4557, 5854, 7019, 8290, 9772, 11275, 12677, 14099, 15589, 16904, 17852, 18590, 19422, 20339, 20970, 21061, 20812, 20570, 20282, 19622, 18633, 17696, 16858, 15808, 14593, 13662, 13086, 12466, 11740, 11320, 11368, 11567, 11717, 12038, 12656, 13321, 13780, 14162, 14705, 15322, 15703, 15759, 15672, 15583, 15432, 15085, 14428, 13461, 12367, 11288, 10120, 8723, 7191, 5639, 4009, 2322, 846, -315, -1441, -2705, -3845, -4576, -4991, -5360, -5759, -6107, -6377, -6596, -6719, -6719, -6701, -6842, -7141, -7367, -7353, -7227, -7225, -7377, -7508, -7532, -7531, -7556, -7555, -7517, -7520, -7571, -7535, -7344, -7115, -6977, -6868, -6635, -6273, -5933, -5705, -5550, -5435, -5396, -5435, -5487, -5527, -5622, -5815, -6048, -6207, -6236, -6136, -5926, -5643, -5335, -4989, -4507, -3820, -3027, -2295, -1656, -977, -166, 694, 1473, 2143, 2741, 3252, 3647, 3946, 4139, 4167, 4017, 3722, 3287, 2732, 2137, 1507, 750, -72, -751, -1272, -1839, -2447, -2849, -3003, -3129, -3294, -3337, -3223, -3099, -3016, -2888, -2717, -2588, -2503, -2380, -2224, -2143, -2218, -2394, -2583, -2793, -3112, -3575, -4124, -4714, -5370, -6107, -6868, -7602, -8334, -9098, -9827, -10439, -10954, -11456, -11937, -12302, -12549, -12803, -13095, -13285, -13288, -13250, -13337, -13478, -13478, -13307, -13106, -12929, -12693, -12376, -12061, -11752, -11343, -10826, -10391, -10139, -9872, -9373, -8772, -8393, -8243, -8000, -7523, -7052, -6719, -6353, -5919, -5639, -5531, -5315, -4927, -4643, -4579, -4543, -4405, -4235, -4081, -3920, -3728, -3450, -3042, -2605, -2250, -1890, -1397, -835, -305, 222, 728, 1074, 1299, 1683, 2303, 2836, 2999, 2952, 3022, 3225, 3302, 3144, 2895, 2633, 2225, 1601, 980, 553, 129, -573, -1373, -1825, -1958, -2282, -2946, -3490, -3594, -3552, -3724, -4015, -4150, -4125, -4125, -4200, -4216, -4060, -3779, -3526, -3421, -3430, -3378, -3114, -2701, -2395, -2391, -2574, -2655, -2500, -2271, -2231, -2453, -2757, -2924, -2928, -2934, -3076, -3276, -3339, -3243, -3199, -3329, -3454, -3372, -3179, -3079, -3056, -2991, -2899, -2820, -2653, -2324, -1966, -1740, -1582, -1311, -897, -469, -108, 215, 517, 789, 1082, 1425, 1699, 1787, 1797, 1906, 2056, 2055, 1901, 1741, 1593, 1342, 1010, 771, 661, 476, 57, -435, -696, -656, -550, -569, -625, -541, -312, -23, 333, 791, 1252, 1590, 1862, 2221, 2671, 3072, 3382, 3680, 3957, 4089, 4102, 4197, 4410, 4467, 4171, 3732, 3469, 3329, 3009, 2484, 2042, 1797, 1512, 1053, 668, 553, 489, 213, -100, -98, 162, 282, 131, 28, 213, 508, 647, 671, 764, 890, 885, 744, 631, 651, 733, 714, 482, 95, -238, -368, -399, -565, -929, -1287, -1457, -1485, -1472, -1413, -1344, -1405, -1554, -1517, -1201, -883, -809, -859, -785, -552, -283, -18, 273, 561, 777, 942, 1131, 1347, 1560, 1774, 1937, 1914, 1731, 1688, 1993, 2379, 2380, 1996, 1755, 2036, 2589, 2908, 2855, 2718, 2779, 3070, 3481, 3872, 4100, 4133, 4154, 4359, 4651, 4779, 4769, 4893, 5103, 4955, 4337, 3823, 3905, 4207, 3959, 3086, 2351, 2360, 2794, 2862, 2368, 1955, 2188, 2783, 3058, 2898, 2836, 3209, 3703, 3842, 3616, 3375, 3324, 3387, 3411, 3233, 2712, 2018, 1653, 1801, 1923, 1464, 681, 248, 244, 127, -360, -862, -1063, -1170, -1481, -1815, -1781, -1420, -1199, -1319, -1448, -1252, -908, -823, -1059, -1335, -1504, -1708, -2062, -2435, -2571, -2326, -1851, -1447, -1096, -365, 961, 2500, 3901, 5374, 7146, 8936, 10477, 11999, 13697, 15273, 16431, 17367, 18318, 19062, 19288, 19207, 19197, 19092, 18405, 17221, 16166, 15462, 14671, 13542, 12475, 11848, 11489, 11123, 10942, 11264, 11896, 12462, 13020, 13873, 14899, 15745, 16473, 17358, 18275, 18840, 19039, 19176, 19303, 19148, 18585, 17767, 16831, 15719, 14375, 12888, 11310, 9592, 7772, 6026, 4404, 2816, 1263, -152, -1384, -2423, -3169, -3633, -4045, -4516, -4826, -4763, -4512, -4417, -4486, -4434, -4205, -4053, -4079, -4089, -4007, -4096, -4488, -4917, -5138, -5314, -5735, -6372, -6974, -7457, -7975, -8617, -9263, -9777, -10226, -10748, -11298, -11682, -11823, -11872, -11970, -12053, -11941, -11618, -11256, -10943, -10552, -9994, -9381, -8781, -8047, -7104, -6157, -5368, -4553, -3508, -2404, -1564, -959, -301, 417, 880, 1013, 1102, 1232, 1139, 766, 410, 158, -227, -767, -1208, -1527, -1922, -2345, -2572, -2614, -2649, -2679, -2579, -2338, -2006, -1560, -960, -260, 427, 1046, 1655, 2360, 3096, 3626, 3870, 4043, 4250, 4252, 3927, 3543, 3210, 2629, 1702, 791, 54, -833, -2032, -3231, -4237, -5254, -6419, -7567, -8546, -9420, -10278, -11073, -11703, -12115, -12368, -12538, -12592, -12424, -12051, -11625, -11224, -10754, -10112, -9442, -8983, -8710, -8367, -7944, -7745, -7865, -8038, -8176, -8545, -9194, -9791, -10237, -10876, -11858, -12867, -13622, -14193, -14724, -15202, -15569, -15785, -15793, -15541, -15031, -14300, -13435, -12539, -11559, -10334, -8901, -7506, -6268, -5097, -3978, -2936, -1838, -657, 250, 655, 883, 1293, 1731, 1918, 1885, 1697, 1305, 847, 579, 391, -11, -548, -881, -1032, -1297, -1612, -1567, -1126, -816, -930, -1014, -547, 255, 789, 931, 1056, 1390, 1815, 2204, 2537, 2778, 2895, 2971, 3101, 3231, 3233, 3101, 2944, 2756, 2319, 1535, 733, 317, 72, -613, -1734, -2650, -3162, -3702, -4281, -4475, -4535, -5189, -6192, -6494, -5939, -5519, -5784, -6174, -6096, -5695, -5335, -5000, -4530, -4064, -3880, -3931, -3839, -3441, -3007, -2788, -2694, -2652, -2850, -3263, -3345, -2776, -2187, -2476, -3454, -3946, -3413, -2725, -2811, -3337, -3454, -3204, -3163, -3184, -2701, -1946, -1686, -1909, -1817, -1053, -95, 585, 1033, 1428, 1761, 2077, 2628, 3480, 4194, 4323, 4130, 4324, 5027, 5551, 5451, 5189, 5330, 5649, 5627, 5373, 5358, 5532, 5430, 5048, 4907, 5199, 5438, 5226, 4880, 4929, 5313, 5538, 5402, 5202, 5249, 5521, 5734, 5701, 5640, 5884, 6246, 6207, 5860, 5918, 6524, 6944, 6749, 6382, 6259, 6190, 5969, 5758, 5651, 5415, 4911, 4331, 3945, 3808, 3757, 3616, 3393, 3206, 3000, 2663, 2416, 2585, 2929, 2860, 2405, 2194, 2455, 2803, 3021, 3274, 3515, 3462, 3241, 3362, 3947, 4441, 4292, 3628, 3065, 2960, 3033, 2833, 2343, 1881, 1551, 1198, 840, 701, 761, 696, 381, 86, 49, 137, 152, 165, 296, 414, 449, 707, 1369, 1989, 2127, 2098, 2454, 3057, 3398, 3479, 3656, 3946, 4069, 4016, 4071, 4357, 4674, 4773, 4610, 4344, 4177, 4221, 4384, 4403, 4099, 3641, 3398, 3513, 3765, 3880, 3811, 3703, 3698, 3821, 4035, 4337, 4734, 5074, 5128, 4963, 4973, 5319, 5649, 5599, 5259, 4911, 4641, 4400, 4135, 3783, 3346, 2909, 2415, 1744, 1107, 831, 707, 251, -394, -629, -422, -313, -446, -442, -172, 71, 118, 89, 53, -28, -108, -120, -185, -494, -969, -1294, -1374, -1547, -2136, -2920, -3397, -3562, -3919, -4634, -5204, -5272, -5171, -5256, -5299, -5005, -4616, -4446, -4272, -3704, -2897, -2358, -2216, -2088, -1681, -1182, -918, -911, -949, -940, -980, -1108, -1244, -1338, -1461, -1690, -2011, -2379, -2787, -3209, -3579, -3863, -4124, -4466, -4892, -5254, -5339, -5107, -4786, -4691, -4884, -5078, -4973, -4659, -4497, -4577, -4667, -4729, -4945, -5155, -4954, -4477, -4246, -4194, -3733, -2818, -1948, -1176, -83, 1369, 2756, 3865, 4826, 5763, 6688, 7526, 8101, 8358, 8451, 8429, 8131, 7635, 7288, 7069, 6542, 5605, 4680, 3982, 3274, 2530, 2144, 2235, 2293, 2016, 1970, 2808, 4220, 5412, 6310, 7413, 8717, 9769, 10571, 11501, 12457, 12906, 12693, 12206, 11764, 11290, 10526, 9401, 8134, 6967, 5834, 4531, 3189, 2177, 1528, 890, 107, -608, -1074, -1301, -1280, -996, -601, -256, 114, 663, 1372, 2080, 2683, 3151, 3480, 3684, 3766, 3692, 3454, 3089, 2630, 2090, 1493, 837, 73, -777, -1571, -2248, -2950, -3816, -4736, -5489, -6048, -6558, -7072, -7470, -7696, -7794, -7697, -7260, -6593, -5984, -5391, -4489, -3280, -2166, -1312, -522, 259, 861, 1285, 1707, 2091, 2196, 1908, 1373, 884, 641, 432, -232, -1395, -2487, -3171, -3770, -4545, -5243, -5671, -6005, -6243, -6082, -5494, -4764, -3940, -2827, -1490, -221, 914, 2105, 3415, 4670, 5657, 6285, 6620, 6835, 7058, 7213, 7066, 6495, 5677, 4913, 4293, 3623, 2707, 1579, 465, -390, -877, -1107, -1405, -2002, -2638, -2708, -2044, -1255, -974, -1068, -1005, -617, -62, 540, 1009, 1035, 626, 272, 332, 585, 579, 129, -628, -1424, -2039, -2484, -2946, -3597, -4490, -5538, -6402, -6792, -7045, -7795, -8877, -9417, -9283, -9292, -9747, -10013, -9825, -9699, -9760, -9410, -8479, -7650, -7397, -7296, -6713, -5646, -4576, -3842, -3441, -3259, -3149, -2874, -2341, -1862, -1863, -2360, -2909, -3119, -3010, -2918, -3123, -3574, -3982, -4168, -4200, -4173, -4086, -3967, -3860, -3669, -3256, -2702, -2243, -1922, -1526, -952, -369, 17, 208, 306, 339, 336, 398, 522, 479, 105, -416, -750, -791, -689, -651, -847, -1305, -1781, -1912, -1654, -1407, -1562, -2023, -2362, -2368, -2189, -2023, -1934, -1947, -2043, -2084, -1991, -1904, -1933, -1971, -1957, -2045, -2304, -2491, -2387, -2144, -2068, -2201, -2311, -2204, -1966, -1837, -1930, -2135, -2292, -2387, -2533, -2779, -3016, -3146, -3245, -3455, -3734, -3869, -3780, -3650, -3672, -3826, -3957, -3957, -3799, -3531, -3268, -3137, -3144, -3112, -2833, -2318, -1859, -1742, -1884, -1918, -1692, -1481, -1570, -1859, -2039, -2039, -2075, -2326, -2708, -2954, -2889, -2648, -2577, -2855, -3257, -3384, -3068, -2534, -2179, -2199, -2427, -2476, -2080, -1398, -935, -994, -1285, -1331, -1127, -1017, -1071, -1084, -1091, -1297, -1591, -1636, -1422, -1276, -1381, -1586, -1642, -1475, -1284, -1339, -1587, -1664, -1446, -1237, -1268, -1409, -1521, -1601, -1508, -1107, -694, -717, -1091, -1295, -1070, -616, -252, -225, -570, -961, -944, -475, 36, 215, 39, -241, -303, -18, 336, 335, -44, -394, -425, -278, -217, -288, -347, -258, 19, 409, 755, 936, 988, 1084, 1377, 1801, 2065, 1933, 1540, 1309, 1472, 1802, 1884, 1591, 1174, 928, 907, 965, 955, 799, 499, 169, -9, 45, 224, 354, 374, 373, 496, 790, 1111, 1273, 1299, 1345, 1412, 1350, 1149, 947, 781, 618, 522, 555, 583, 465, 327, 409, 744, 1134, 1377, 1451, 1516, 1754, 2132, 2444, 2607, 2760, 2983, 3173, 3266, 3338, 3436, 3487, 3454, 3390, 3318, 3199, 3050, 2967, 3021, 3171, 3287, 3299, 3320, 3549, 3988, 4388, 4551, 4568, 4645, 4789, 4842, 4752, 4639, 4576, 4483, 4280, 4030, 3832, 3688, 3570, 3498, 3453, 3332, 3109, 2941, 2989, 3198, 3332, 3262, 3111, 3126, 3365, 3621, 3681, 3570, 3435, 3303, 3113, 2877, 2657, 2426, 2116, 1734, 1363, 1088, 975, 1014, 1071, 1038, 968, 979, 1087, 1239, 1388, 1475, 1419, 1262, 1186, 1297, 1468, 1499, 1365, 1213, 1136, 1075, 954, 788, 629, 468, 271, 78, -11, 50, 222, 412, 548, 618, 701, 910, 1224, 1436, 1371, 1107, 866, 742, 663, 551, 375, 120, -182, -394, -379, -170, 33, 104, 105, 173, 368, 674, 1002, 1188, 1165, 1104, 1208, 1401, 1468, 1398, 1339, 1288, 1092, 737, 401, 197, 36, -235, -629, -1007, -1232, -1280, -1212, -1088, -940, -776, -574, -314, -25, 219, 396, 536, 633, 614, 481, 368, 384, 418, 276, -28, -240, -195, -58, -117, -398, -634, -626, -499, -510, -691, -825, -762, -608, -551, -617, -668, -605, -519, -576, -793, -1003, -1101, -1210, -1452, -1719, -1848, -1874, -1906, -1915, -1827, -1657, -1430, -1153, -916, -790, -666, -450, -259, -201, -205, -271, -521, -855, -1005, -1010, -1178, -1566, -1979, -2313, -2503, -2400, -2090, -1957, -2074, -2037, -1601, -963, -345, 219, 678, 1023, 1417, 1889, 2176, 2156, 2010, 1832, 1553, 1202, 785, 130, -625, -950, -762, -697, -1063, -1379, -1252, -814, -203, 473, 796, 606, 521, 1029, 1647, 1755, 1545, 1499, 1621, 1676, 1579, 1365, 1237, 1509, 2062, 2250, 1807, 1340, 1473, 1980, 2177, 1788, 1139, 732, 754, 922, 825, 463, 257, 463, 845, 1039, 1007, 975, 1102, 1340, 1556, 1631, 1513, 1298, 1210, 1351, 1520, 1445, 1154, 898, 743, 456, -147, -963, -1807, -2652, -3534, -4375, -5125, -5836, -6394, -6352, -5395, -3842, -2319, -967, 651, 2805, 5117, 7010, 8333, 9245, 9748, 9720, 9239, 8597, 7993, 7418, 6747, 5848, 4753, 3781, 3241, 3096, 3019, 2856, 2773, 2954, 3388, 4107, 5314, 6996, 8692, 10093, 11451, 12965, 14289, 15194, 15930, 16481, 16419, 15794, 15070, 14175, 12851, 11606, 10937, 10275, 9081, 7976, 7572, 7475, 7399, 7746, 8447, 8803, 8789, 9002, 9408, 9520, 9430, 9448, 9341, 8853, 8316, 8027, 7801, 7493, 7257, 7085, 6692, 5982, 5163, 4417, 3755, 3093, 2310, 1326, 252, -652, -1269, -1751, -2274, -2772, -3098, -3363, -3767, -4206, -4406, -4415, -4523, -4770, -4949, -4986, -4969, -4888, -4675, -4440, -4367, -4462, -4612, -4797, -5129, -5687, -6444, -7334, -8325, -9348, -10249, -10888, -11282, -11560, -11760, -11752, -11429, -10869, -10225, -9565, -8863, -8143, -7478, -6915, -6397, -5834, -5230, -4752, -4558, -4530, -4401, -4159, -4087, -4335, -4729, -5079, -5428, -5868, -6353, -6771, -7064, -7197, -7127, -6857, -6445, -5878, -5071, -4023, -2922, -1962, -1156, -430, 214, 723, 1088, 1287, 1257, 1029, 781, 645, 522, 238, -198, -618, -950, -1297, -1719, -2125, -2436, -2691, -2925, -3083, -3117, -3054, -2932, -2755, -2512, -2196, -1813, -1421, -1100, -863, -680, -567, -587, -765, -1071, -1475, -1950, -2479, -3053, -3642, -4170, -4600, -4998, -5435, -5869, -6226, -6522, -6817, -7130, -7433, -7659, -7694, -7517, -7263, -7050, -6780, -6322, -5758, -5292, -4985, -4748, -4574, -4580, -4839, -5249, -5648, -5993, -6376, -6860, -7348, -7691, -7864, -7970, -8065, -8087, -7962, -7722, -7458, -7214, -6966, -6713, -6470, -6212, -5899, -5552, -5232, -4936, -4617, -4256, -3847, -3380, -2956, -2719, -2663, -2617, -2514, -2482, -2603, -2800, -2990, -3156, -3244, -3183, -3014, -2850, -2737, -2594, -2331, -1979, -1684, -1537, -1410, -1112, -725, -502, -420, -178, 269, 614, 698, 744, 966, 1288, 1521, 1567, 1448, 1300, 1273, 1328, 1268, 1023, 711, 463, 348, 407, 563, 638, 598, 631, 853, 1154, 1418, 1626, 1738, 1705, 1645, 1752, 2018, 2237, 2272, 2181, 2085, 2052, 2098, 2177, 2160, 1926, 1550, 1267, 1188, 1192, 1138, 1049, 983, 909, 796, 687, 657, 747, 882, 831, 477, 101, 105, 406, 509, 226, -96, -117, 108, 356, 551, 736, 950, 1177, 1378, 1545, 1710, 1863, 1893, 1723, 1453, 1254, 1149, 1020, 802, 580, 451, 398, 342, 294, 341, 475, 546, 468, 400, 554, 886, 1141, 1218, 1284, 1499, 1803, 2055, 2227, 2344, 2373, 2276, 2134, 2083, 2110, 2045, 1793, 1486, 1326, 1331, 1354, 1313, 1291, 1385, 1523, 1564, 1550, 1698, 2048, 2343, 2365, 2264, 2330, 2579, 2783, 2816, 2778, 2777, 2789, 2747, 2678, 2651, 2639, 2510, 2216, 1891, 1699, 1620, 1486, 1225, 944, 776, 723, 702, 660, 607, 560, 521, 506, 527, 565, 588, 592, 600, 618, 628, 644, 714, 837, 906, 825, 669, 590, 616, 622, 495, 262, 52, -30, 2, 19, -86, -255, -329, -286, -266, -357, -448, -386, -195, -43, 29, 139, 344, 549, 657, 676, 669, 683, 715, 694, 565, 440, 508, 743, 871, 706, 392, 187, 107, -25, -269, -483, -588, -679, -800, -852, -737, -470, -148, 70, 68, 8, 173, 512, 673, 581, 540, 702, 869, 876, 703, 315, -256, -754, -966, -1018, -1135, -1289, -1300, -1112, -798, -409, 10, 346, 496, 506, 450, 258, -109, -442, -515, -440, -426, -370, -48, 408, 650, 627, 615, 769, 936, 947, 841, 706, 533, 347, 252, 234, 181, 138, 166, 55, -325, -610, -490, -323, -513, -740, -535, -113, 78, 121, 312, 584, 747, 874, 1089, 1246, 1125, 747, 301, -152, -672, -1220, -1636, -1839, -1847, -1645, -1214, -544, 482, 1935, 3462, 4550, 5210, 5844, 6429, 6513, 6035, 5429, 4936, 4433, 3896, 3522, 3424, 3559, 3844, 4186, 4534, 4980, 5583, 6141, 6386, 6383, 6499, 6928, 7473, 7880, 8218, 8742, 9460, 10035, 10230, 10233, 10334, 10474, 10372, 10026, 9738, 9658, 9593, 9387, 9173, 9127, 9206, 9297, 9422, 9600, 9678, 9562, 9491, 9704, 10016, 10047, 9815, 9652, 9659, 9611, 9389, 9145, 9014, 8944, 8843, 8735, 8681, 8653, 8523, 8179, 7626, 6986, 6405, 5905, 5353, 4660, 3976, 3522, 3329, 3262, 3257, 3325, 3439, 3533, 3568, 3503, 3307, 3031, 2733, 2361, 1871, 1365, 959, 568, 46, -541, -995, -1264, -1498, -1820, -2177, -2476, -2720, -2958, -3168, -3299, -3383, -3477, -3551, -3517, -3396, -3331, -3413, -3573, -3694, -3773, -3896, -4111, -4399, -4714, -5011, -5272, -5500, -5690, -5815, -5893, -5979, -6078, -6110, -6047, -5987, -6027, -6124, -6170, -6160, -6170, -6203, -6180, -6096, -6026, -5930, -5701, -5387, -5159, -5048, -4933, -4821, -4839, -5006, -5191, -5341, -5515, -5727, -5894, -5957, -5940, -5896, -5828, -5715, -5555, -5353, -5139, -4968, -4876, -4816, -4720, -4598, -4510, -4450, -4388, -4345, -4356, -4381, -4374, -4363, -4385, -4426, -4461, -4502, -4553, -4600, -4657, -4749, -4856, -4931, -4960, -4959, -4925, -4844, -4729, -4623, -4534, -4423, -4260, -4077, -3940, -3867, -3817, -3747, -3667, -3597, -3535, -3467, -3422, -3415, -3431, -3461, -3527, -3647, -3782, -3884, -3954, -4022, -4058, -4010, -3900, -3816, -3776, -3699, -3544, -3354, -3163, -2963, -2778, -2659, -2585, -2508, -2465, -2512, -2628, -2756, -2889, -3025, -3113, -3136, -3123, -3081, -2984, -2844, -2718, -2634, -2576, -2541, -2547, -2583, -2605, -2595, -2584, -2586, -2569, -2512, -2430, -2338, -2243, -2182, -2203, -2287, -2357, -2393, -2454, -2563, -2658, -2695, -2723, -2784, -2835, -2816, -2774, -2792, -2837, -2810, -2706, -2608, -2540, -2466, -2376, -2292, -2212, -2131, -2076, -2070, -2084, -2079, -2075, -2120, -2205, -2280, -2336, -2415, -2519, -2600, -2657, -2714, -2757, -2753, -2713, -2644, -2510, -2298, -2080, -1908, -1761, -1612, -1470, -1342, -1241, -1213, -1269, -1353, -1418, -1491, -1588, -1655, -1652, -1624, -1635, -1663, -1635, -1522, -1360, -1208, -1085, -977, -861, -728, -589, -450, -303, -150, -11, 117, 287, 534, 795, 960, 1040, 1138, 1283, 1393, 1417, 1414, 1434, 1444, 1408, 1392, 1471, 1616, 1732, 1808, 1913, 2070, 2236, 2378, 2505, 2616, 2717, 2821, 2921, 2997, 3062, 3162, 3289, 3383, 3417, 3427, 3450, 3469, 3439, 3357, 3265, 3201, 3165, 3125, 3062, 2993, 2962, 2994, 3070, 3149, 3212, 3271, 3332, 3376, 3390, 3383, 3364, 3332, 3274, 3187, 3081, 2968, 2865, 2793, 2744, 2672, 2559, 2436, 2322, 2187, 2033, 1891, 1745, 1550, 1340, 1190, 1095, 991, 899, 899, 971, 1013, 986, 945, 943, 973, 1003, 1002, 958, 891, 813, 731, 672, 672, 701, 666, 537, 403, 360, 384, 362, 236, 71, -20, -8, 9, -50, -136, -138, -54, 11, 5, -20, -14, -1, -13, -24, 10, 84, 131, 116, 85, 118, 227, 341, 381, 358, 352, 418, 531, 629, 674, 661, 590, 496, 447, 473, 520, 532, 519, 515, 527, 569, 674, 843, 993, 1041, 1007, 984, 999, 993, 922, 828, 760, 720, 683, 650, 635, 659, 728, 788, 776, 735, 774, 889, 931, 809, 635, 564, 582, 542, 404, 289, 288, 343, 360, 349, 366, 409, 427, 419, 424, 450, 444, 375, 269, 186, 153, 143, 111, 23, -105, -220, -289, -312, -304, -274, -249, -249, -253, -234, -209, -202, -177, -116, -72, -105, -185, -248, -277, -283, -288, -309, -345, -361, -347, -336, -334, -291, -193, -111, -99, -117, -109, -83, -67, -63, -51, -44, -71, -125, -166, -180, -196, -253, -328, -360, -337, -295, -253, -188, -108, -65, -82, -113, -125, -136, -178, -251, -339, -432, -508, -533, -474, -312, -73, 184, 409, 607, 809, 1006, 1146, 1200, 1202, 1203, 1211, 1199, 1157, 1121, 1128, 1188, 1280, 1382, 1482, 1578, 1675, 1785, 1905, 2023, 2137, 2265, 2434, 2639, 2844, 3017, 3162, 3314, 3485, 3638, 3727, 3772, 3862, 4025, 4183, 4258, 4293, 4379, 4524, 4660, 4757, 4867, 5008, 5120, 5163, 5196, 5291, 5426, 5538, 5617, 5690, 5770, 5876, 6015, 6155, 6253, 6341, 6458, 6576, 6646, 6672, 6674, 6646, 6592, 6544, 6508, 6457, 6392, 6342, 6307, 6261, 6210, 6185, 6180, 6159, 6114, 6093, 6122, 6159, 6154, 6106, 6057, 6014, 5972, 5920, 5839, 5703, 5530, 5365, 5215, 5054, 4871, 4687, 4518, 4368, 4250, 4147, 4036, 3911, 3797, 3707, 3622, 3526, 3426, 3311, 3166, 2996, 2854, 2765, 2683, 2552, 2377, 2208, 2059, 1918, 1792, 1666, 1500, 1279, 1046, 834, 625, 395, 154, -77, -305, -526, -718, -870, -985, -1090, -1220, -1377, -1516, -1601, -1666, -1762, -1887, -2006, -2113, -2226, -2351, -2487, -2644, -2841, -3060, -3276, -3482, -3697, -3929, -4157, -4347, -4490, -4597, -4694, -4796, -4905, -4994, -5043, -5068, -5099, -5150, -5214, -5282, -5341, -5390, -5456, -5557, -5666, -5759, -5852, -5974, -6107, -6215, -6299, -6385, -6480, -6571, -6641, -6680, -6701, -6731, -6775, -6799, -6780, -6741, -6716, -6688, -6628, -6539, -6473, -6446, -6423, -6376, -6330, -6308, -6300, -6280, -6254, -6244, -6252, -6263, -6266, -6260, -6239, -6211, -6182, -6156, -6134, -6110, -6059, -5974, -5880, -5790, -5679, -5533, -5392, -5281, -5168, -5032, -4901, -4790, -4674, -4554, -4467, -4417, -4379, -4347, -4331, -4316, -4289, -4271, -4265, -4234, -4154, -4042, -3921, -3793, -3658, -3531, -3411, -3281, -3141, -3006, -2891, -2795, -2708, -2623, -2540, -2456, -2382, -2325, -2280, -2229, -2174, -2133, -2111, -2088, -2045, -1995, -1950, -1900, -1835, -1764, -1707, -1660, -1599, -1502, -1386, -1281, -1202, -1137, -1057, -948, -834, -755, -713, -674, -623, -578, -567, -582, -599, -612, -623, -642, -669, -686, -685, -679, -682, -680, -641, -566, -485, -409, -324, -224, -127, -50, 17, 82, 131, 148, 148, 159, 171, 143, 68, -9, -51, -76, -126, -196, -244, -247, -238, -245, -248, -212, -150, -107, -105, -109, -88, -50, -25, -12, 14, 68, 124, 158, 176, 196, 219, 235, 236, 228, 214, 192, 157, 114, 77, 57, 43, 19, -10, -9, 46, 146, 254, 352, 446, 550, 661, 772, 874, 954, 1002, 1017, 1013, 994, 963, 925, 893, 878, 871, 861, 847, 849, 887, 961, 1039, 1096, 1147, 1228, 1341, 1449, 1515, 1557, 1614, 1686, 1737, 1750, 1749, 1760, 1785, 1807, 1805, 1781, 1762, 1781, 1819, 1842, 1850, 1868, 1896, 1904, 1885, 1862, 1853, 1852, 1834, 1789, 1742, 1729, 1758, 1789, 1794, 1792, 1816, 1856, 1870, 1851, 1832, 1828, 1815, 1764, 1688, 1622, 1574, 1520, 1446, 1370, 1316, 1282, 1247, 1201, 1152, 1114, 1095, 1083, 1064, 1037, 999, 960, 919, 872, 815, 752, 695, 647, 596, 547, 520, 518, 514, 488, 453, 422, 396, 375, 353, 310, 246, 182, 125, 60, -10, -56, -73, -94, -132, -166, -177, -175, -175, -176, -165, -138, -100, -68, -50, -35, -14, 1, -4, -32, -55, -54, -43, -47, -68, -73, -40, 9, 35, 29, 27, 56, 103, 131, 129, 115, 114, 131, 146, 131, 106, 110, 149, 174, 165, 163, 202, 251, 268, 246, 220, 215, 228, 244, 244, 224, 200, 183, 174, 171, 180, 208, 249, 284, 303, 316, 337, 360, 376, 378, 374, 363, 344, 320, 299, 289, 280, 265, 245, 230, 229, 235, 235, 222, 209, 217, 238, 250, 246, 248, 270, 296, 306, 298, 282, 267, 258, 254, 243, 229, 223, 215, 192, 165, 162, 179, 181, 159, 140, 148, 170, 186, 187, 174, 149, 118, 93, 79, 75, 72, 70, 83, 118, 159, 182, 189, 200, 213, 217, 203, 172, 115, 42, -9, -18, -14, -41, -93, -118, -89, -39, -6, 5, 28, 82, 153, 213, 252, 283, 315, 342, 343, 315, 282, 261, 240, 205, 162, 137, 129, 117, 94, 84, 104, 139, 170, 202, 247, 300, 352, 398, 435, 462, 488, 527, 566, 594, 626, 696, 808, 927, 1031, 1139, 1272, 1405, 1509, 1590, 1673, 1753, 1817, 1864, 1903, 1937, 1993, 2097, 2228, 2345, 2435, 2526, 2630, 2750, 2896, 3060, 3213, 3343, 3473, 3623, 3779, 3926, 4072, 4218, 4338, 4420, 4498, 4613, 4747, 4844, 4897, 4957, 5059, 5164, 5239, 5307, 5406, 5516, 5596, 5658, 5749, 5855, 5935, 6001, 6097, 6205, 6276, 6320, 6369, 6424, 6473, 6523, 6557, 6560, 6556, 6580, 6600, 6571, 6523, 6493, 6462, 6403, 6346, 6309, 6271, 6206, 6137, 6090, 6052, 6013, 5975, 5938, 5887, 5822, 5767, 5730, 5673, 5576, 5471, 5383, 5293, 5174, 5050, 4935, 4814, 4673, 4531, 4395, 4243, 4085, 3947, 3831, 3708, 3572, 3439, 3317, 3202, 3089, 2971, 2846, 2727, 2619, 2511, 2386, 2253, 2126, 1991, 1826, 1640, 1472, 1333, 1186, 1004, 806, 612, 417, 219, 35, -130, -311, -522, -734, -908, -1039, -1157, -1300, -1494, -1701, -1869, -1993, -2125, -2287, -2449, -2593, -2736, -2891, -3053, -3215, -3378, -3539, -3697, -3872, -4067, -4263, -4445, -4613, -4778, -4931, -5066, -5189, -5308, -5433, -5559, -5666, -5745, -5819, -5910, -6012, -6102, -6177, -6261, -6364, -6466, -6549, -6636, -6749, -6871, -6974, -7051, -7124, -7198, -7266, -7323, -7368, -7391, -7410, -7447, -7496, -7521, -7518, -7516, -7529, -7534, -7517, -7487, -7476, -7478, -7478, -7465, -7447, -7431, -7408, -7371, -7332, -7306, -7291, -7268, -7221, -7161, -7104, -7068, -7046, -7024, -6990, -6938, -6880, -6829, -6790, -6731, -6635, -6529, -6450, -6376, -6272, -6155, -6062, -5979, -5874, -5763, -5676, -5597, -5505, -5402, -5298, -5198, -5118, -5052, -4969, -4854, -4733, -4629, -4518, -4382, -4240, -4114, -4002, -3892, -3776, -3648, -3508, -3378, -3274, -3182, -3074, -2949, -2821, -2702, -2582, -2450, -2323, -2208, -2103, -1991, -1868, -1744, -1629, -1522, -1421, -1326, -1231, -1134, -1037, -942, -847, -748, -645, -539, -423, -293, -166, -61, 30, 127, 239, 357, 461, 539, 604, 681, 781, 875, 936, 973, 1016, 1062, 1103, 1143, 1187, 1232, 1280, 1342, 1403, 1440, 1469, 1521, 1591, 1650, 1684, 1710, 1745, 1791, 1830, 1847, 1836, 1823, 1830, 1848, 1843, 1808, 1764, 1737, 1733, 1740, 1733, 1702, 1661, 1641, 1659, 1696, 1716, 1707, 1695, 1701, 1718, 1727, 1729, 1730, 1726, 1706, 1674, 1650, 1636, 1626, 1608, 1585, 1554, 1506, 1442, 1381, 1341, 1316, 1286, 1244, 1210, 1193, 1185, 1174, 1164, 1159, 1164, 1175, 1183, 1176, 1149, 1131, 1135, 1150, 1146, 1115, 1075, 1042, 1010, 969, 916, 863, 814, 777, 746, 715, 680, 645, 628, 640, 665, 673, 662, 652, 662, 690, 723, 746, 749, 733, 721, 722, 721, 699, 659, 616, 580, 555, 538, 507, 454, 408, 396, 400, 393, 388, 402, 419, 418, 414, 431, 456, 464, 462, 473, 498, 517, 520, 528, 552, 580, 594, 602, 606, 592, 551, 511, 501, 510, 494, 444, 398, 378, 373, 367, 363, 359, 353, 348, 359, 382, 408, 431, 451, 467, 474, 473, 469, 463, 438, 390, 334, 289, 267, 263, 257, 227, 176, 138, 139, 163, 177, 172, 170, 192, 224, 246, 259, 276, 301, 322, 330, 331, 332, 336, 341, 335, 321, 304, 298, 294, 281, 257, 235, 227, 234, 250, 265, 273, 288, 315, 345, 366, 386, 415, 449, 475, 499, 521, 534, 543, 557, 561, 554, 562, 592, 602, 564, 520, 515, 538, 558, 577, 608, 646, 683, 721, 759, 797, 839, 882, 916, 951, 993, 1029, 1040, 1044, 1063, 1093, 1105, 1101, 1101, 1110, 1112, 1109, 1106, 1113, 1128, 1152, 1178, 1200, 1212, 1223, 1244, 1282, 1321, 1349, 1361, 1370, 1384, 1402, 1417, 1430, 1440, 1441, 1431, 1410, 1388, 1372, 1358, 1349, 1350, 1359, 1362, 1353, 1343, 1339, 1338, 1340, 1349, 1348, 1329, 1310, 1315, 1328, 1323, 1306, 1290, 1282, 1271, 1248, 1214, 1175, 1150, 1148, 1154, 1147, 1125, 1095, 1063, 1038, 1028, 1029, 1028, 1013, 993, 981, 976, 965, 945, 926, 912, 903, 886, 861, 830, 795, 761, 727, 691, 651, 614, 581, 559, 554, 557, 543, 512, 494, 500, 510, 505, 501, 521, 549, 560, 552, 539, 539, 559, 591, 623, 660, 723, 800, 862, 907, 963, 1041, 1114, 1163, 1198, 1240, 1294, 1348, 1387, 1421, 1480, 1576, 1668, 1731, 1793, 1894, 2015, 2117, 2203, 2296, 2402, 2509, 2616, 2718, 2817, 2930, 3049, 3137, 3199, 3291, 3430, 3556, 3635, 3709, 3804, 3901, 3983, 4074, 4177, 4264, 4327, 4394, 4485, 4574, 4634, 4684, 4746, 4812, 4854, 4877, 4910, 4959, 5001, 5021, 5021, 5018, 5020, 5031, 5038, 5031, 5019, 5001, 4970, 4922, 4880, 4861, 4846, 4800, 4729, 4673, 4644, 4604, 4531, 4459, 4413, 4371, 4315, 4247, 4168, 4072, 3987, 3925, 3854, 3743, 3621, 3525, 3438, 3334, 3228, 3140, 3049, 2942, 2833, 2734, 2632, 2529, 2432, 2336, 2228, 2108, 1988, 1870, 1751, 1635, 1532, 1425, 1298, 1160, 1038, 928, 798, 647, 507, 385, 259, 119, -29, -188, -351, -490, -613, -762, -943, -1105, -1232, -1360, -1506, -1652, -1790, -1935, -2082, -2232, -2389, -2544, -2674, -2794, -2934, -3087, -3224, -3353, -3504, -3666, -3812, -3946, -4082, -4229, -4374, -4515, -4640, -4745, -4845, -4953, -5061, -5154, -5243, -5342, -5454, -5563, -5659, -5735, -5808, -5898, -6007, -6106, -6180, -6241, -6316, -6409, -6493, -6558, -6611, -6669, -6736, -6803, -6858, -6905, -6948, -6990, -7025, -7053, -7073, -7089, -7098, -7101, -7100, -7101, -7100, -7098, -7095, -7093, -7091, -7086, -7085, -7088, -7093, -7081, -7059, -7041, -7031, -7015, -6988, -6949, -6910, -6860, -6798, -6734, -6680, -6631, -6565, -6485, -6405, -6329, -6257, -6184, -6099, -6002, -5912, -5845, -5780, -5694, -5592, -5506, -5441, -5370, -5277, -5170, -5067, -4973, -4871, -4760, -4648, -4532, -4403, -4262, -4129, -4015, -3909, -3794, -3674, -3559, -3445, -3326, -3215, -3116, -3010, -2888, -2760, -2640, -2523, -2409, -2295, -2174, -2047, -1940, -1850, -1741, -1616, -1510, -1417, -1302, -1176, -1079, -997, -883, -736, -609, -512, -415, -302, -194, -96, 9, 121, 212, 273, 345, 444, 542, 618, 691, 778, 864, 945, 1036, 1129, 1209, 1279, 1365, 1458, 1538, 1607, 1669, 1722, 1783, 1861, 1935, 1983, 2030, 2098, 2164, 2198, 2228, 2278, 2333, 2370, 2400, 2424, 2442, 2472, 2518, 2555, 2570, 2584, 2615, 2646, 2669, 2697, 2722, 2723, 2724, 2752, 2778, 2767, 2741, 2747, 2768, 2760, 2723, 2692, 2683, 2670, 2636, 2602, 2594, 2605, 2599, 2570, 2539, 2524, 2516, 2489, 2446, 2402, 2367, 2336, 2304, 2267, 2220, 2173, 2137, 2109, 2081, 2058, 2035, 2000, 1950, 1908, 1875, 1829, 1774, 1738, 1712, 1666, 1607, 1563, 1524, 1467, 1397, 1339, 1286, 1240, 1206, 1167, 1104, 1045, 1031, 1045, 1030, 985, 943, 917, 893, 873, 855, 834, 809, 787, 765, 744, 735, 737, 726, 694, 665, 649, 631, 605, 586, 574, 559, 536, 507, 469, 433, 424, 443, 457, 454, 453, 469, 490, 507, 526, 551, 580, 600, 608, 604, 592, 580, 571, 558, 539, 523, 515, 509, 500, 497, 516, 551, 575, 564, 543, 551, 591, 626, 636, 638, 640, 636, 631, 642, 661, 672, 683, 707, 727, 724, 718, 741, 772, 774, 745, 730, 744, 758, 749, 732, 727, 726, 718, 717, 732, 746, 746, 746, 761, 781, 789, 799, 826, 849, 835, 810, 808, 813, 791, 758, 750, 757, 744, 725, 726, 746, 771, 803, 831, 834, 823, 825, 837, 839, 835, 843, 860, 877, 897, 918, 930, 937, 948, 965, 983, 1006, 1024, 1018, 1002, 996, 1002, 1001, 1007, 1036, 1066, 1078, 1094, 1129, 1160, 1177, 1204, 1241, 1252, 1239, 1247, 1291, 1334, 1341, 1318, 1288, 1273, 1279, 1296, 1308, 1323, 1351, 1366, 1350, 1321, 1310, 1318, 1311, 1280, 1250, 1241, 1261, 1289, 1313, 1328, 1334, 1334, 1332, 1333, 1342, 1348, 1331, 1290, 1237, 1196, 1172, 1154, 1120, 1072, 1031, 1007, 988, 960, 934, 930, 940, 940, 923, 901, 878, 863, 863, 858, 825, 774, 742, 735, 730, 705, 663, 604, 542, 507, 497, 475, 428, 390, 388, 396, 375, 311, 235, 187, 184, 185, 158, 127, 131, 154, 144, 105, 72, 47, 13, -26, -68, -125, -185, -209, -183, -143, -130, -139, -141, -115, -66, -14, 18, 38, 64, 107, 153, 185, 205, 229, 265, 298, 314, 321, 336, 368, 404, 435, 468, 511, 554, 593, 639, 703, 775, 843, 907, 970, 1028, 1084, 1142, 1199, 1251, 1301, 1352, 1393, 1416, 1436, 1469, 1518, 1566, 1607, 1652, 1694, 1715, 1737, 1795, 1871, 1911, 1920, 1951, 2011, 2048, 2058, 2081, 2127, 2160, 2174, 2192, 2215, 2209, 2170, 2138, 2138, 2135, 2098, 2055, 2056, 2084, 2083, 2036, 1992, 1987, 2009, 2022, 2020, 2012, 2000, 1978, 1953, 1938, 1925, 1889, 1829, 1782, 1758, 1722, 1658, 1596, 1560, 1528, 1478, 1429, 1395, 1358, 1302, 1252, 1213, 1169, 1110, 1047, 992, 942, 891, 831, 757, 683, 624, 566, 493, 412, 346, 287, 211, 115, 18, -75, -177, -291, -394, -485, -580, -686, -783, -863, -950, -1057, -1161, -1244, -1324, -1428, -1546, -1659, -1766, -1874, -1991, -2111, -2235, -2363, -2486, -2584, -2659, -2744, -2860, -2993, -3102, -3184, -3275, -3393, -3514, -3610, -3687, -3773, -3869, -3956, -4034, -4127, -4233, -4329, -4410, -4498, -4607, -4708, -4780, -4833, -4891, -4954, -5012, -5065, -5120, -5176, -5233, -5295, -5370, -5443, -5495, -5521, -5540, -5573, -5605, -5620, -5635, -5671, -5712, -5720, -5705, -5714, -5752, -5778, -5773, -5766, -5774, -5780, -5767, -5739, -5714, -5699, -5674, -5620, -5550, -5509, -5504, -5489, -5447, -5410, -5381, -5322, -5237, -5174, -5133, -5070, -4988, -4948, -4959, -4948, -4866, -4741, -4633, -4559, -4497, -4432, -4362, -4285, -4188, -4082, -3989, -3906, -3821, -3728, -3643, -3577, -3509, -3410, -3269, -3119, -3000, -2910, -2813, -2702, -2594, -2489, -2361, -2217, -2095, -2005, -1924, -1833, -1736, -1637, -1543, -1457, -1365, -1246, -1103, -957, -814, -674, -555, -463, -363, -240, -127, -42, 30, 103, 165, 234, 347, 517, 698, 849, 964, 1066, 1168, 1278, 1391, 1493, 1580, 1652, 1716, 1774, 1831, 1902, 2007, 2142, 2282, 2391, 2474, 2548, 2613, 2648, 2669, 2714, 2795, 2866, 2890, 2887, 2902, 2946, 3002, 3053, 3102, 3159, 3236, 3318, 3376, 3404, 3427, 3448, 3447, 3431, 3433, 3459, 3484, 3501, 3514, 3527, 3537, 3552, 3566, 3557, 3526, 3507, 3522, 3549, 3554, 3535, 3525, 3529, 3529, 3519, 3516, 3517, 3500, 3453, 3392, 3322, 3257, 3216, 3211, 3223, 3242, 3275, 3323, 3357, 3360, 3343, 3327, 3297, 3226, 3124, 3029, 2961, 2909, 2871, 2855, 2849, 2837, 2825, 2842, 2887, 2924, 2928, 2892, 2822, 2715, 2579, 2438, 2310, 2192, 2083, 1991, 1934, 1907, 1894, 1884, 1883, 1895, 1910, 1910, 1881, 1814, 1708, 1579, 1451, 1352, 1285, 1239, 1199, 1170, 1158, 1160, 1161, 1142, 1098, 1030, 939, 820, 681, 533, 380, 236, 135, 90, 75, 56, 40, 36, 36, 27, 8, -34, -127, -261, -396, -499, -567, -595, -577, -530, -473, -416, -374, -349, -337, -339, -378, -473, -604, -737, -853, -944, -999, -1024, -1027, -1009, -962, -892, -822, -760, -717, -706, -716, -715, -690, -669, -683, -721, -750, -769, -791, -809, -788, -716, -627, -549, -486, -444, -441, -477, -549, -648, -756, -844, -910, -976, -1031, -1006, -855, -594, -277, 42, 326, 585, 855, 1125, 1325, 1403, 1375, 1263, 1075, 857, 687, 628, 701, 868, 1050, 1192, 1333, 1496, 1529, 1244, 665, 20, -442, -527, -138, 591, 1366, 2027, 2595, 2983, 2977, 2539, 1845, 1022, 103, -771, -1359, -1541, -1394, -1007, -405, 387, 1284, 2149, 2867, 3387, 3710, 3833, 3745, 3448, 2984, 2434, 1896, 1448, 1110, 895, 876, 1167, 1769, 2528, 3266, 3863, 4195, 4112, 3567, 2689, 1701, 825, 222, -36, 18, 314, 780, 1305, 1733, 1942, 1883, 1570, 1081, 540, 50, -344, -598, -671, -585, -368, 32, 637, 1262, 1646, 1737, 1662, 1499, 1226, 856, 499, 300, 354, 613, 887, 1017, 1045, 1117, 1263, 1356, 1266, 958, 482, -50, -518, -823, -877, -641, -237, 114, 336, 581, 951, 1296, 1370, 1099, 613, 94, -363, -783, -1224, -1626, -1851, -1844, -1669, -1349, -855, -289, 106, 166, -74, -498, -1025, -1594, -2127, -2553, -2816, -2839, -2567, -2087, -1634, -1371, -1251, -1175, -1195, -1424, -1783, -2026, -1957, -1601, -1149, -779, -521, -306, -150, -172, -433, -864, -1383, -1947, -2460, -2792, -2909, -2858, -2648, -2269, -1822, -1480, -1337, -1376, -1535, -1748, -1984, -2246, -2502, -2670, -2708, -2669, -2582, -2372, -1971, -1464, -998, -586, -122, 386, 792, 1018, 1117, 1059, 687, 27, -634, -1084, -1381, -1593, -1611, -1318, -788, -187, 377, 852, 1160, 1240, 1096, 797, 414, 44, -221, -392, -537, -582, -365, 58, 409, 563, 673, 843, 983, 1022, 965, 779, 472, 231, 257, 522, 852, 1146, 1386, 1512, 1472, 1348, 1244, 1114, 907, 799, 976, 1219, 1139, 817, 694, 852, 909, 661, 324, 128, 77, 164, 457, 921, 1342, 1486, 1297, 938, 637, 460, 325, 229, 256, 355, 355, 220, 74, -40, -159, -237, -238, -262, -385, -541, -711, -976, -1247, -1264, -1014, -820, -862, -908, -684, -263, 32, 13, -199, -380, -495, -697, -996, -1181, -1182, -1223, -1435, -1627, -1669, -1749, -2039, -2371, -2492, -2392, -2171, -1841, -1435, -1139, -1127, -1320, -1475, -1522, -1727, -2368, -3255, -3828, -3810, -3452, -3017, -2478, -1915, -1625, -1605, -1458, -1075, -864, -1107, -1610, -2139, -2730, -3378, -3802, -3710, -3103, -2260, -1521, -1103, -988, -963, -846, -768, -1107, -2034, -3196, -3995, -4083, -3550, -2746, -2033, -1640, -1626, -1941, -2441, -2879, -3058, -2976, -2691, -2090, -1090, -78, 204, -583, -1973, -3309, -4477, -5607, -6277, -5781, -4125, -2013, 105, 2163, 3681, 3838, 2478, 345, -1813, -3795, -5569, -6837, -7177, -6391, -4670, -2474, -251, 1676, 3027, 3593, 3378, 2469, 857, -1265, -3187, -4155, -4184, -3895, -3551, -2752, -1191, 707, 2106, 2513, 2123, 1481, 926, 404, -228, -877, -1263, -1249, -966, -604, -229, 90, 203, 157, 400, 1262, 2295, 2540, 1555, -11, -971, -695, 296, 894, 627, 205, 557, 1571, 2279, 2240, 2112, 2551, 3048, 2505, 766, -1061, -1904, -1785, -1354, -846, 71, 1580, 3245, 4261, 3992, 2425, 408, -773, -529, 428, 988, 1013, 1251, 2064, 2842, 2784, 1853, 802, 418, 797, 1311, 1251, 474, -510, -909, -188, 1360, 2676, 2942, 2449, 2042, 1914, 1637, 1234, 1289, 1771, 1585, 16, -1959, -2618, -1482, 450, 2204, 3635, 4780, 5335, 5041, 3901, 1831, -1194, -4299, -5727, -4479, -1484, 1453, 3424, 4471, 4702, 4328, 3977, 3930, 3529, 2104, 71, -1433, -1643, -736, 315, 657, 623, 1360, 3031, 4208, 3539, 1269, -1305, -3134, -3805, -3272, -1625, 949, 3913, 6156, 6610, 5279, 3179, 1109, -938, -3003, -4490, -4753, -3874, -2314, -186, 2368, 4465, 5181, 4804, 4239, 3340, 1160, -2141, -4893, -5673, -4616, -2830, -1172, 288, 2074, 4627, 7446, 8928, 7629, 3936, 0, -2347, -3225, -3964, -5191, -6155, -5744, -3571, -205, 3247, 5789, 7228, 8170, 8823, 8051, 4611, -777, -5666, -8287, -8676, -7403, -4548, -506, 3370, 5936, 7483, 8780, 9181, 6934, 1645, -4451, -8154, -7930, -5018, -2141, -702, 658, 3754, 7465, 8503, 5697, 1492, -1247, -2175, -2572, -3054, -3020, -1642, 1167, 4457, 6665, 6645, 4575, 1772, -496, -1874, -2574, -2647, -1963, -609, 1107, 2837, 4064, 4102, 2669, 434, -1306, -1641, -754, 377, 974, 1199, 1866, 3362, 4958, 5355, 3937, 1353, -1205, -3128, -4433, -4781, -3289, -2, 3259, 4736, 4779, 4682, 4158, 1862, -1898, -4781, -4892, -2633, -108, 884, 583, 934, 2959, 5105, 5173, 2962, -68, -2610, -3843, -3233, -1290, 439, 1113, 1500, 2432, 3230, 2498, 79, -2525, -3624, -2814, -1073, 246, 609, 787, 1913, 3735, 4327, 2280, -1308, -3912, -4338, -3603, -3195, -3304, -2974, -1362, 1403, 4207, 5562, 4717, 2412, 143, -1516, -3280, -5489, -6885, -5887, -2720, 705, 2990, 4212, 4665, 4020, 2335, 631, -365, -1192, -2633, -4405, -5391, -4721, -2447, 450, 2613, 3247, 2642, 1706, 1071, 796, 663, 350, -588, -2131, -3093, -2042, 604, 2358, 1325, -1446, -2858, -785, 3747, 7049, 5864, 747, -3970, -4352, -833, 2602, 2951, 999, -421, 94, 1612, 2743, 3255, 3675, 4086, 3860, 2501, 517, -786, -605, 410, 893, 345, -354, 16, 1818, 4284, 6094, 6147, 4089, 515, -3119, -5038, -4267, -1582, 965, 1971, 2040, 2879, 5064, 7229, 7640, 6048, 3584, 1296, -537, -1799, -2109, -1322, -15, 1006, 1527, 1955, 2766, 4157, 5827, 6740, 5709, 2755, -597, -2835, -3588, -3027, -1200, 1468, 3861, 4959, 4617, 3535, 2693, 2437, 1946, 268, -2167, -4022, -4729, -4462, -2860, 548, 4650, 7076, 6587, 4139, 1424, -694, -2045, -2427, -1828, -913, -499, -637, -768, -595, -318, -285, -736, -1515, -1879, -1166, 241, 1185, 939, -268, -1686, -2586, -2792, -2902, -3477, -3970, -3311, -1637, -434, -470, -520, 1022, 3687, 5018, 3041, -1983, -7975, -12240, -12604, -8757, -2863, 1953, 3994, 3665, 2284, 949, 187, -216, -1151, -3207, -5647, -7025, -6937, -6188, -5012, -2532, 1302, 4520, 4925, 2345, -1518, -4646, -5829, -5220, -4265, -4429, -5626, -6307, -5239, -2750, -22, 2191, 3576, 3646, 2005, -965, -4305, -7011, -8162, -7386, -5634, -4504, -4262, -3505, -1211, 1713, 3201, 1814, -2095, -6323, -8096, -6258, -2401, 609, 1306, 551, -129, -613, -2088, -5141, -8541, -10158, -8785, -4985, -555, 2557, 3241, 1722, -712, -2758, -4073, -5126, -5972, -5758, -3926, -1341, 640, 1527, 1222, -617, -3379, -4913, -3921, -1941, -1384, -2488, -3660, -3937, -3596, -2875, -1582, -26, 971, 1177, 874, -364, -3170, -6348, -7231, -4812, -1043, 1265, 734, -1916, -4113, -3271, 259, 3076, 2467, -944, -4630, -6583, -6030, -3594, -1308, -981, -2075, -2273, -517, 1542, 1657, -380, -3018, -5045, -6228, -6203, -4255, -520, 3355, 5197, 3854, 142, -3450, -4475, -2604, 21, 945, -231, -1945, -2752, -2568, -1971, -1363, -1118, -1648, -2599, -2618, -726, 2321, 4705, 5250, 3755, 415, -3604, -5734, -4331, -1366, -509, -2382, -3815, -2193, 1374, 3797, 3528, 1682, 366, 496, 1197, 1128, 2, -1368, -2139, -2101, -1544, -667, 760, 2835, 4359, 3134, -1340, -5873, -5926, -440, 6678, 10311, 8756, 4422, 558, -2064, -4859, -8219, -10051, -8328, -3586, 2223, 7690, 11562, 12473, 10312, 6127, 587, -5181, -8324, -7196, -4252, -2658, -1957, -185, 2467, 5032, 7718, 9992, 9685, 5908, 478, -4109, -6113, -4622, -722, 2342, 2426, 1115, 1254, 2886, 3541, 2042, -101, -1195, -1414, -1554, -1287, 62, 2024, 3634, 4858, 5967, 6081, 4248, 1718, 802, 1226, 467, -1703, -2238, 485, 4091, 5534, 4042, 7, -5847, -10957, -11383, -5526, 3851, 12128, 16478, 16705, 13560, 7673, 455, -5303, -7388, -6715, -6344, -7414, -7414, -3528, 3319, 9112, 11066, 10122, 8815, 7498, 4038, -2168, -7392, -6969, -1121, 5150, 7997, 7830, 6205, 2782, -3008, -9123, -11533, -7679, 965, 9722, 14417, 14461, 12050, 8807, 4387, -1501, -7032, -9320, -7292, -2788, 1244, 3199, 3422, 3087, 3047, 3457, 3844, 3419, 1813, -153, -754, 1235, 5229, 8930, 9790, 6812, 1370, -3786, -6688, -7398, -7097, -6224, -4017, 94, 5228, 9500, 11290, 9803, 5326, -361, -4569, -5736, -4386, -1685, 1847, 5630, 8374, 8990, 7250, 3125, -3243, -10181, -14299, -13002, -7120, -141, 5131, 8536, 11220, 13359, 13640, 10635, 4477, -2782, -8724, -12501, -14496, -14200, -10038, -2166, 5887, 9957, 9280, 6654, 4629, 2733, -895, -5894, -9026, -7511, -2366, 2282, 3170, 760, -1861, -2476, -1790, -1990, -3557, -4394, -2770, -177, 301, -1956, -4378, -4361, -1731, 1644, 3381, 2257, -577, -2675, -3053, -2855, -3152, -3663, -3795, -3429, -2425, -662, 1327, 2705, 3355, 3931, 4940, 6071, 6373, 5069, 2427, -216, -1652, -2088, -2767, -3967, -4081, -1572, 2719, 6374, 7981, 7743, 6284, 4415, 3414, 3937, 5011, 5269, 4694, 4378, 5125, 6763, 8277, 8426, 6823, 4411, 2497, 1565, 1426, 2019, 3494, 5702, 8018, 9682, 10321, 10173, 9607, 8521, 6711, 4809, 4045, 4762, 5788, 5734, 4521, 3414, 3732, 5614, 7830, 8934, 8743, 8460, 9030, 9759, 9166, 7066, 4921, 3849, 3182, 1733, -88, -495, 1464, 4751, 7570, 9058, 9387, 8929, 7943, 6645, 5035, 2968, 752, -830, -1373, -1139, -272, 1419, 3590, 5055, 4888, 3387, 1720, 802, 541, 75, -1145, -2549, -2991, -2074, -529, 629, 1024, 955, 820, 576, -142, -1310, -2261, -2690, -3465, -5575, -8362, -9685, -8019, -3950, 308, 2570, 2150, 98, -2060, -3718, -5162, -6690, -8289, -9798, -10743, -10386, -8548, -6106, -4245, -3515, -3813, -4789, -5840, -6187, -5486, -4408, -4269, -5788, -8179, -9775, -9769, -9086, -9239, -10516, -11710, -11530, -9919, -7992, -6853, -6475, -5590, -3011, 581, 2333, -533, -7697, -15386, -19445, -18573, -14500, -9861, -6348, -4283, -3140, -2501, -2668, -4192, -6808, -9286, -10562, -10685, -10353, -9912, -9232, -8319, -7445, -6820, -6629, -6969, -7213, -6132, -3550, -1267, -1454, -4386, -8329, -11304, -12485, -12249, -11338, -9963, -7606, -3862, 487, 3648, 4405, 3181, 963, -2266, -7077, -12864, -17530, -18816, -15538, -8328, 117, 6292, 8439, 7612, 5832, 3852, 1145, -2592, -6763, -10439, -12878, -13345, -11066, -5986, 420, 5573, 7374, 5722, 2618, 538, 345, 699, -356, -3221, -6273, -7512, -6410, -4126, -2258, -1544, -1353, -191, 2723, 6089, 7483, 5954, 2897, 174, -1613, -2919, -4276, -5650, -6056, -4263, -452, 3497, 6007, 7196, 7769, 7507, 5636, 2140, -1771, -4277, -4093, -1671, 698, 802, -1005, -1794, 702, 5142, 7736, 6244, 2131, -1154, -1305, 1273, 4178, 5102, 3641, 1297, -163, -208, 352, 386, -278, -334, 1807, 5953, 9712, 10536, 7880, 3230, -1460, -5022, -7156, -7657, -5958, -1956, 2934, 6600, 8268, 8772, 8668, 7257, 3895, -618, -4405, -5838, -4594, -1918, 256, 938, 775, 1042, 2184, 3571, 4317, 4054, 3070, 1955, 1157, 809, 662, 101, -1360, -3278, -4523, -4719, -4574, -4195, -2318, 1687, 6124, 8642, 8903, 8273, 7348, 5044, 311, -5971, -11136, -12777, -10599, -6308, -1878, 1827, 4948, 7672, 9420, 8864, 5244, -75, -4103, -5009, -3913, -3395, -4789, -7141, -8038, -5324, 930, 7878, 12056, 12192, 9470, 5573, 1415, -2564, -5993, -8660, -10438, -10775, -8646, -3452, 3635, 9627, 11738, 9765, 6012, 2825, 724, -1028, -2871, -4439, -5083, -4340, -2056, 1500, 5470, 8529, 9557, 8394, 5954, 3398, 1178, -985, -3127, -4407, -3925, -2025, -203, 543, 810, 1980, 4673, 8274, 11613, 13620, 13441, 10714, 6003, 613, -4168, -7390, -8314, -6846, -4034, -1227, 1319, 4319, 8105, 12035, 14876, 15327, 12848, 8415, 3797, -51, -3140, -5265, -5723, -4115, -686, 3698, 7506, 9324, 9156, 8079, 6590, 4573, 2689, 2218, 3338, 4804, 5450, 5217, 4869, 5253, 6527, 7687, 7191, 4315, -185, -4430, -6282, -4673, -719, 3009, 4838, 5175, 5289, 5682, 6108, 6414, 6628, 6503, 5661, 4167, 2463, 716, -1233, -3244, -4747, -5299, -4729, -2876, 186, 3684, 6394, 7279, 5807, 2302, -1795, -4741, -5896, -5879, -5445, -4743, -3499, -1435, 1183, 3178, 3374, 2107, 1018, 1126, 1880, 2236, 1821, 896, -105, -802, -1054, -1024, -943, -965, -1168, -1373, -1039, 262, 2207, 3847, 4417, 3885, 2928, 2459, 2889, 3765, 4339, 4318, 3841, 3146, 2659, 2858, 3613, 4182, 4152, 3833, 3552, 3393, 3754, 5251, 7714, 9924, 10709, 9977, 8560, 7358, 6771, 6687, 6751, 6718, 6686, 7001, 7841, 8925, 9733, 9950, 9631, 9053, 8539, 8343, 8558, 9094, 9810, 10545, 11048, 10988, 10254, 9237, 8533, 8400, 8690, 9232, 9949, 10621, 10933, 10743, 10147, 9345, 8558, 7844, 7019, 6111, 5705, 6292, 7415, 8101, 7965, 7388, 6863, 6657, 6783, 6937, 6747, 6266, 5864, 5562, 4979, 3976, 2941, 2330, 2200, 2210, 1929, 1224, 427, 103, 531, 1420, 2140, 2182, 1438, 139, -1377, -2789, -3746, -3894, -3097, -1749, -700, -610, -1306, -2014, -2388, -2955, -4380, -6503, -8376, -9136, -8685, -7661, -6879, -6733, -7021, -7329, -7470, -7587, -7959, -8701, -9510, -9807, -9344, -8516, -7878, -7572, -7480, -7697, -8395, -9435, -10406, -11015, -11306, -11516, -11850, -12317, -12795, -13193, -13482, -13485, -12918, -11737, -10410, -9579, -9495, -9871, -10331, -10822, -11522, -12482, -13466, -14127, -14156, -13331, -11725, -9958, -8917, -8950, -9587, -10286, -11175, -12700, -14735, -16464, -17087, -16296, -14128, -10925, -7589, -5389, -4941, -5633, -6494, -7433, -9193, -12108, -15195, -16559, -14950, -11126, -7534, -6191, -7009, -8309, -8721, -8271, -8002, -8817, -10514, -11779, -11348, -9304, -6987, -5727, -5745, -6219, -6211, -5510, -4652, -4125, -3876, -3799, -4323, -5933, -8199, -9794, -9676, -7987, -5683, -3659, -2379, -1919, -1892, -1694, -1294, -1354, -2207, -3331, -4241, -5036, -5602, -5185, -3443, -1202, 330, 695, 316, -74, -41, 223, 146, -509, -1349, -1854, -1923, -1724, -1288, -547, 255, 594, 304, -20, 421, 1731, 3154, 3852, 3688, 3212, 2952, 2892, 2727, 2404, 2015, 1381, 354, -532, -415, 774, 2161, 2935, 3044, 2900, 2874, 3078, 3390, 3742, 4339, 5303, 6154, 6117, 5026, 3487, 2145, 1157, 501, 378, 1033, 2330, 3799, 5019, 5794, 6000, 5513, 4317, 2608, 894, 70, 1078, 4009, 7489, 9420, 8691, 6028, 3070, 1019, 238, 389, 518, -237, -1512, -1817, -62, 3474, 7532, 10513, 11039, 8854, 5203, 1803, -428, -1448, -1525, -1071, -563, -85, 810, 2329, 3765, 4234, 3961, 3978, 4499, 4589, 3588, 1883, 194, -1042, -1699, -2161, -3025, -3951, -3687, -1806, 710, 3011, 5110, 6780, 7216, 6217, 4515, 2790, 1183, -257, -1497, -2814, -4370, -5408, -4583, -1508, 2397, 4997, 5181, 3411, 1013, -744, -1350, -1243, -1056, -700, 332, 1915, 3313, 4255, 5163, 6018, 5723, 3290, -745, -4698, -7227, -7876, -6687, -4230, -1536, 886, 3557, 6831, 9862, 11403, 11009, 8942, 5712, 2085, -1168, -3787, -5836, -7119, -7216, -5920, -3336, 137, 3789, 6909, 9112, 10090, 9387, 7015, 3968, 1471, -116, -1137, -1534, -706, 1334, 3305, 3711, 2410, 696, -10, 683, 2078, 3051, 2967, 2178, 1601, 1798, 2614, 3588, 4369, 4708, 4471, 3821, 3162, 2656, 2076, 1382, 997, 1111, 1215, 932, 731, 1123, 1740, 1985, 2084, 2722, 3999, 5303, 5919, 5385, 3563, 807, -2057, -4219, -5454, -6036, -6164, -5713, -4497, -2539, -238, 1557, 2059, 1486, 972, 1204, 1816, 2381, 3103, 3988, 4201, 3029, 977, -755, -1656, -2108, -2423, -2382, -1828, -1016, -163, 780, 1740, 2432, 2766, 2950, 3235, 3843, 4800, 5626, 5756, 5389, 5292, 5662, 5921, 5619, 4839, 3872, 3115, 3083, 3976, 5395, 6715, 7490, 7615, 7556, 8127, 9402, 10311, 9955, 8826, 8143, 8505, 9676, 11075, 12023, 12083, 11490, 10956, 10869, 11055, 11254, 11468, 11761, 12091, 12379, 12649, 12950, 13170, 13032, 12422, 11700, 11339, 11380, 11579, 11947, 12671, 13532, 14036, 14063, 13840, 13414, 12688, 11888, 11394, 11186, 10871, 10243, 9489, 8872, 8503, 8460, 8772, 9214, 9431, 9400, 9419, 9525, 9354, 8702, 7790, 6881, 6104, 5568, 5188, 4681, 4047, 3688, 3741, 3775, 3482, 3051, 2614, 1910, 786, -419, -1255, -1589, -1480, -941, -107, 593, 732, 366, -69, -442, -1226, -2908, -5232, -7299, -8390, -8519, -8193, -7854, -7587, -7251, -6759, -6330, -6409, -7223, -8467, -9520, -9965, -9868, -9658, -9751, -10197, -10665, -10832, -10755, -10748, -10969, -11272, -11414, -11321, -11167, -11256, -11796, -12739, -13777, -14507, -14598, -13977, -12972, -12187, -12052, -12441, -12839, -12893, -12780, -12954, -13622, -14514, -15113, -15060, -14466, -13823, -13527, -13480, -13295, -12898, -12667, -12976, -13761, -14618, -15160, -15260, -15013, -14462, -13522, -12242, -11066, -10534, -10745, -11302, -11795, -12184, -12588, -12958, -13100, -12897, -12333, -11459, -10566, -10155, -10427, -10932, -11071, -10799, -10523, -10357, -9962, -9161, -8348, -8035, -8280, -8787, -9266, -9420, -8936, -7880, -6844, -6327, -6276, -6315, -6176, -5800, -5378, -5291, -5706, -6306, -6620, -6464, -5925, -5195, -4520, -3993, -3442, -2802, -2442, -2691, -3248, -3477, -3225, -2855, -2545, -2064, -1396, -1039, -1286, -1695, -1708, -1465, -1454, -1667, -1653, -1205, -573, -72, 194, 310, 410, 533, 562, 363, -2, -278, -242, 146, 826, 1669, 2344, 2457, 2013, 1464, 1101, 809, 562, 601, 883, 995, 888, 1107, 1959, 2966, 3474, 3438, 3298, 3262, 3058, 2436, 1689, 1425, 1843, 2454, 2630, 2370, 2279, 2727, 3305, 3393, 3064, 2940, 3224, 3465, 3320, 2993, 2738, 2392, 1762, 1182, 1327, 2430, 3941, 5074, 5568, 5752, 5899, 5865, 5428, 4706, 3960, 3205, 2291, 1349, 889, 1354, 2646, 4132, 5143, 5444, 5307, 5117, 4954, 4578, 3820, 2877, 2161, 1956, 2310, 3160, 4378, 5601, 6310, 6290, 5899, 5554, 5135, 4254, 2994, 1832, 1033, 594, 600, 1059, 1686, 2259, 2896, 3721, 4662, 5665, 6611, 6996, 6338, 4890, 3470, 2641, 2400, 2411, 2248, 1721, 1231, 1473, 2589, 3849, 4378, 3993, 3156, 2293, 1442, 574, -28, 36, 799, 1894, 3073, 4422, 5917, 7009, 6960, 5591, 3463, 1287, -637, -2275, -3478, -4031, -3887, -3128, -1830, -181, 1525, 3134, 4509, 5217, 4867, 3784, 2777, 2208, 1796, 1234, 525, -216, -836, -1085, -853, -415, -144, -2, 344, 914, 1283, 1185, 847, 586, 496, 677, 1263, 2001, 2280, 1886, 1360, 1250, 1386, 1298, 1050, 1046, 1160, 821, -50, -899, -1257, -956, 30, 1293, 1960, 1673, 1040, 684, 479, 114, -421, -1116, -1991, -2772, -3181, -3404, -3761, -4204, -4533, -4705, -4577, -3804, -2270, -285, 1753, 3599, 5021, 5764, 5748, 5128, 4035, 2430, 336, -1897, -3715, -4663, -4565, -3634, -2474, -1540, -566, 932, 2660, 3801, 4201, 4390, 4577, 4565, 4530, 4959, 5870, 6718, 7090, 7027, 6827, 6750, 6732, 6452, 5821, 5218, 5021, 5154, 5443, 6083, 7324, 8808, 9793, 10169, 10655, 11746, 12985, 13722, 13965, 14011, 13809, 13198, 12406, 11786, 11459, 11397, 11557, 11802, 12054, 12518, 13436, 14675, 15742, 16160, 15813, 15105, 14647, 14610, 14549, 14103, 13575, 13521, 13997, 14617, 15127, 15504, 15602, 15165, 14316, 13615, 13348, 13146, 12568, 11676, 10877, 10511, 10767, 11525, 12163, 12069, 11374, 10745, 10464, 10192, 9602, 8774, 7971, 7348, 6958, 6825, 6868, 6854, 6543, 5946, 5329, 4883, 4431, 3590, 2263, 853, -106, -476, -580, -729, -891, -862, -564, -79, 409, 586, 136, -941, -2281, -3556, -4801, -6201, -7680, -8854, -9407, -9342, -8905, -8444, -8279, -8503, -8883, -9110, -9155, -9241, -9529, -9975, -10459, -10850, -11022, -10972, -10904, -11102, -11640, -12344, -13064, -13800, -14540, -15141, -15476, -15565, -15473, -15244, -14967, -14730, -14494, -14129, -13699, -13462, -13586, -13939, -14247, -14393, -14494, -14716, -15127, -15649, -16085, -16217, -16050, -15828, -15779, -15912, -16074, -16072, -15766, -15223, -14777, -14735, -15004, -15189, -15009, -14488, -13820, -13235, -12901, -12818, -12821, -12748, -12625, -12648, -12986, -13511, -13808, -13629, -13176, -12851, -12696, -12462, -12036, -11536, -10957, -10140, -9200, -8605, -8638, -8980, -9069, -8784, -8495, -8480, -8598, -8513, -8031, -7229, -6415, -5969, -6041, -6425, -6733, -6674, -6218, -5651, -5342, -5278, -5054, -4425, -3581, -2774, -2014, -1312, -845, -679, -648, -681, -948, -1469, -1861, -1790, -1485, -1370, -1357, -1034, -404, 126, 401, 566, 652, 642, 721, 1005, 1296, 1414, 1432, 1427, 1398, 1550, 2140, 2966, 3431, 3201, 2541, 1965, 1744, 1789, 1852, 1762, 1503, 1166, 916, 965, 1446, 2243, 3000, 3387, 3437, 3483, 3693, 3816, 3549, 2981, 2473, 2231, 2208, 2276, 2340, 2371, 2462, 2716, 3043, 3200, 3075, 2767, 2386, 1964, 1639, 1661, 2054, 2453, 2567, 2635, 3041, 3699, 4150, 4176, 3915, 3529, 3087, 2658, 2275, 1892, 1553, 1475, 1812, 2421, 2990, 3342, 3528, 3652, 3699, 3593, 3343, 3059, 2840, 2715, 2700, 2797, 2939, 3002, 2951, 2917, 3063, 3357, 3549, 3430, 3083, 2815, 2808, 2907, 2801, 2408, 2058, 2149, 2596, 2858, 2710, 2593, 2928, 3473, 3823, 4080, 4493, 4836, 4699, 4110, 3464, 3063, 2939, 2900, 2710, 2357, 2115, 2121, 2173, 2058, 1846, 1666, 1507, 1359, 1320, 1504, 1947, 2576, 3147, 3374, 3263, 3139, 3226, 3398, 3410, 3169, 2707, 2073, 1288, 410, -340, -583, -183, 376, 430, 5, -111, 655, 1912, 2732, 2640, 1973, 1349, 1042, 889, 571, -82, -916, -1505, -1486, -900, -141, 419, 712, 940, 1316, 1778, 1998, 1726, 1090, 402, -141, -403, -188, 523, 1334, 1711, 1493, 992, 671, 713, 820, 543, -125, -722, -913, -722, -196, 562, 1019, 579, -608, -1862, -2974, -4376, -6289, -8242, -9379, -9026, -7193, -4646, -2128, 430, 3442, 6613, 8946, 9700, 8834, 6663, 3612, 256, -2793, -5164, -6770, -7635, -7755, -7072, -5472, -2922, 193, 3004, 4789, 5692, 6476, 7533, 8482, 8772, 8373, 7672, 7039, 6661, 6638, 6871, 6997, 6703, 6034, 5226, 4499, 4247, 4883, 6135, 7083, 7402, 7907, 9319, 11299, 13139, 14759, 16350, 17596, 17918, 17295, 16358, 15599, 14834, 13630, 12097, 10909, 10551, 10859, 11478, 12389, 13723, 15251, 16480, 17231, 17765, 18252, 18406, 17953, 17125, 16437, 16068, 15803, 15534, 15485, 15774, 16097, 16051, 15648, 15223, 14973, 14828, 14591, 14004, 12963, 11880, 11440, 11696, 11938, 11658, 11093, 10696, 10552, 10565, 10641, 10659, 10539, 10335, 10059, 9635, 9139, 8759, 8367, 7543, 6192, 4811, 3875, 3191, 2205, 809, -497, -1263, -1514, -1504, -1361, -1126, -838, -488, -54, 392, 688, 608, -76, -1452, -3205, -4821, -6124, -7421, -8981, -10545, -11503, -11549, -11065, -10737, -10882, -11206, -11265, -10988, -10625, -10405, -10412, -10644, -10972, -11162, -11127, -11125, -11534, -12485, -13763, -14977, -15857, -16389, -16810, -17321, -17851, -18102, -17806, -16987, -15969, -15158, -14736, -14572, -14398, -14083, -13749, -13669, -14052, -14847, -15747, -16448, -16914, -17321, -17744, -18007, -17854, -17226, -16331, -15504, -14954, -14671, -14512, -14412, -14452, -14687, -14975, -15031, -14738, -14248, -13780, -13404, -13030, -12617, -12184, -11775, -11436, -11262, -11365, -11706, -12014, -11969, -11543, -11081, -10891, -10828, -10509, -9860, -9257, -9030, -9057, -8957, -8559, -8033, -7593, -7252, -6909, -6524, -6146, -5829, -5562, -5246, -4806, -4349, -4044, -3889, -3779, -3785, -4038, -4410, -4638, -4673, -4552, -4138, -3362, -2489, -1794, -1136, -236, 789, 1489, 1613, 1342, 985, 622, 117, -586, -1305, -1699, -1552, -1003, -439, -56, 343, 965, 1642, 2073, 2242, 2304, 2256, 2023, 1730, 1610, 1689, 1750, 1609, 1329, 1137, 1202, 1502, 1823, 1904, 1699, 1450, 1401, 1496, 1529, 1472, 1450, 1534, 1733, 2043, 2357, 2524, 2545, 2503, 2316, 1836, 1188, 720, 557, 499, 408, 446, 778, 1279, 1763, 2253, 2764, 3041, 2886, 2505, 2171, 1834, 1341, 734, 133, -333, -413, 19, 647, 1075, 1406, 1986, 2759, 3289, 3336, 3073, 2820, 2702, 2539, 2064, 1341, 802, 709, 797, 704, 553, 757, 1313, 1713, 1702, 1697, 2169, 2909, 3328, 3253, 3020, 2948, 3030, 3102, 2986, 2586, 1977, 1435, 1272, 1609, 2248, 2757, 2812, 2518, 2307, 2464, 2824, 2989, 2758, 2326, 2101, 2297, 2712, 2978, 2994, 2898, 2745, 2488, 2186, 1936, 1689, 1417, 1318, 1560, 2015, 2454, 2803, 3014, 2960, 2669, 2399, 2235, 1840, 890, -329, -1080, -952, -279, 370, 826, 1274, 1777, 2160, 2302, 2272, 2091, 1566, 570, -572, -1248, -1215, -877, -755, -844, -716, -106, 810, 1632, 2035, 1911, 1410, 831, 347, -100, -565, -905, -988, -983, -1101, -1136, -656, 254, 850, 627, 50, -88, 163, 55, -545, -829, -317, 337, 364, -93, -470, -767, -1514, -3101, -5303, -7343, -8532, -8946, -9001, -8396, -6289, -2659, 1462, 5259, 8702, 11639, 13222, 12639, 9913, 5763, 1041, -3546, -7443, -10212, -11586, -11506, -10001, -7056, -2796, 2160, 6749, 10084, 11988, 12798, 12773, 11858, 10035, 7770, 5965, 5179, 5089, 5063, 5127, 5724, 6658, 7147, 6967, 6710, 6765, 6915, 7055, 7571, 8728, 10269, 11890, 13661, 15772, 18007, 19814, 20691, 20359, 18850, 16723, 14837, 13541, 12449, 11260, 10325, 10184, 11047, 12833, 15213, 17547, 19306, 20476, 21258, 21646, 21539, 20889, 19609, 17852, 16271, 15517, 15526, 15793, 16150, 16752, 17495, 18065, 18377, 18493, 18154, 16974, 15216, 13760, 13036, 12538, 11777, 11168, 11390, 12347, 13298, 13697, 13569, 13252, 13022, 12781, 12218, 11321, 10440, 9674, 8766, 7721, 6973, 6650, 6254, 5336, 4055, 2905, 2107, 1467, 663, -320, -1065, -1142, -607, 71, 572, 950, 1289, 1403, 1070, 328, -748, -2323, -4479, -6712, -8330, -9283, -10084, -10943, -11484, -11348, -10658, -9889, -9463, -9482, -9730, -9985, -10294, -10755, -11239, -11605, -11976, -12503, -13049, -13381, -13586, -13997, -14740, -15612, -16358, -16937, -17359, -17570, -17540, -17320, -16914, -16296, -15619, -15081, -14678, -14345, -14248, -14537, -15030, -15514, -16058, -16764, -17488, -18094, -18603, -18916, -18777, -18178, -17440, -16769, -16047, -15159, -14281, -13672, -13384, -13328, -13493, -13911, -14431, -14794, -14911, -14914, -14921, -14888, -14704, -14267, -13583, -12787, -12103, -11653, -11333, -10970, -10559, -10246, -10054, -9856, -9611, -9414, -9293, -9176, -9048, -8940, -8804, -8613, -8465, -8355, -8063, -7477, -6836, -6416, -6158, -5815, -5351, -4949, -4675, -4341, -3804, -3195, -2778, -2618, -2615, -2727, -3017, -3442, -3773, -3786, -3528, -3231, -2944, -2395, -1421, -317, 520, 1101, 1596, 1828, 1503, 772, 92, -389, -844, -1281, -1421, -1079, -396, 364, 1036, 1538, 1818, 1911, 1923, 1863, 1598, 1103, 638, 499, 691, 962, 1125, 1228, 1404, 1674, 1936, 2070, 1988, 1625, 1025, 461, 277, 492, 744, 770, 780, 1152, 1895, 2648, 3070, 3092, 2810, 2327, 1710, 1027, 380, -141, -516, -703, -560, 36, 956, 1841, 2435, 2779, 3008, 3070, 2783, 2122, 1289, 521, -48, -326, -214, 249, 860, 1449, 2042, 2667, 3123, 3122, 2652, 2026, 1503, 1041, 533, 118, 64, 385, 814, 1179, 1569, 2065, 2521, 2729, 2660, 2415, 2094, 1786, 1599, 1605, 1821, 2193, 2583, 2842, 2949, 3039, 3143, 3019, 2412, 1468, 683, 384, 393, 377, 359, 680, 1461, 2424, 3299, 4080, 4708, 4864, 4404, 3660, 2955, 2166, 1092, -67, -909, -1212, -984, -369, 374, 1044, 1704, 2510, 3335, 3766, 3506, 2682, 1710, 937, 429, 6, -545, -1168, -1422, -911, 147, 1031, 1308, 1204, 1127, 1090, 817, 170, -672, -1359, -1641, -1539, -1215, -754, -199, 306, 660, 921, 1095, 962, 368, -476, -1229, -1793, -2231, -2459, -2367, -2106, -1842, -1296, -110, 1237, 1644, 815, -159, -206, 312, 220, -788, -1851, -2196, -1881, -1201, -283, 441, 315, -565, -1334, -1685, -2360, -4024, -6434, -8786, -10163, -9876, -8058, -5651, -3266, -527, 3068, 7197, 10805, 12701, 12162, 9512, 6081, 2950, -151, -4099, -8561, -11678, -11887, -9560, -6358, -3356, -422, 2868, 6424, 9741, 12224, 13325, 12839, 11302, 9769, 8942, 8651, 8371, 7857, 7205, 6695, 6733, 7296, 7514, 6651, 5380, 5047, 5897, 7173, 8591, 10530, 12994, 15516, 17890, 20087, 21762, 22415, 21966, 20732, 18981, 16858, 14625, 12639, 11077, 10076, 10030, 11231, 13231, 15209, 16924, 18721, 20650, 22276, 23189, 23239, 22487, 21344, 20344, 19541, 18553, 17339, 16437, 16257, 16550, 16782, 16692, 16307, 15734, 15132, 14729, 14605, 14522, 14274, 14053, 14228, 14790, 15335, 15608, 15677, 15571, 15046, 13960, 12630, 11472, 10490, 9391, 8202, 7363, 7154, 7288, 7284, 7039, 6741, 6423, 5899, 5081, 4048, 2940, 1936, 1214, 713, 238, -117, -17, 533, 1044, 1079, 642, -90, -1092, -2391, -3930, -5587, -7192, -8525, -9399, -9872, -10144, -10172, -9759, -9112, -8812, -8990, -9185, -9248, -9670, -10688, -11770, -12364, -12555, -12733, -13075, -13517, -13912, -14162, -14372, -14832, -15685, -16731, -17640, -18224, -18450, -18271, -17719, -17023, -16406, -15793, -15007, -14236, -13874, -13987, -14334, -14870, -15747, -16855, -17868, -18671, -19372, -19953, -20198, -19949, -19278, -18400, -17478, -16507, -15428, -14375, -13621, -13253, -13084, -12988, -13073, -13461, -14094, -14790, -15349, -15558, -15344, -14911, -14584, -14472, -14318, -13814, -12925, -11995, -11358, -10941, -10410, -9673, -8963, -8395, -7856, -7444, -7489, -7943, -8203, -7911, -7614, -8070, -9091, -9628, -9057, -7890, -6991, -6537, -6078, -5295, -4310, -3384, -2659, -2168, -1914, -1847, -1870, -1925, -2013, -2184, -2507, -2973, -3348, -3287, -2752, -2140, -1778, -1516, -1015, -238, 555, 1121, 1367, 1369, 1304, 1271, 1171, 908, 569, 315, 255, 434, 781, 1027, 987, 831, 834, 986, 1106, 1167, 1239, 1286, 1298, 1412, 1721, 2091, 2317, 2340, 2208, 1945, 1575, 1187, 842, 492, 115, -130, -74, 209, 537, 927, 1529, 2249, 2714, 2680, 2306, 1992, 1917, 1753, 1048, -22, -686, -563, -159, -43, -26, 355, 974, 1306, 1229, 1121, 1207, 1237, 917, 393, 105, 239, 554, 749, 829, 988, 1269, 1455, 1354, 1081, 853, 625, 225, -193, -257, 51, 379, 594, 879, 1271, 1566, 1683, 1688, 1575, 1323, 1049, 851, 731, 749, 1029, 1500, 1900, 2106, 2240, 2403, 2469, 2251, 1740, 1126, 628, 374, 384, 575, 822, 1096, 1514, 2151, 2896, 3522, 3825, 3699, 3220, 2642, 2182, 1804, 1363, 886, 564, 525, 735, 1104, 1523, 1834, 1910, 1830, 1805, 1864, 1791, 1471, 1087, 861, 844, 1023, 1345, 1632, 1719, 1661, 1543, 1280, 855, 444, 83, -404, -919, -984, -425, 246, 464, 308, 330, 791, 1261, 1057, 103, -923, -1452, -1671, -1950, -2100, -1799, -1279, -911, -504, 298, 1242, 1698, 1423, 742, 159, -67, -160, -593, -1464, -2229, -2314, -1789, -1148, -640, -169, 270, 460, 331, 138, 76, 17, -187, -422, -528, -534, -516, -505, -634, -1080, -1789, -2558, -3368, -4388, -5558, -6461, -6675, -6094, -4741, -2487, 717, 4424, 7786, 10068, 10947, 10501, 9063, 6920, 4114, 745, -2686, -5593, -7631, -8400, -7316, -4369, -526, 3201, 6651, 9946, 12578, 13760, 13465, 12439, 11301, 10112, 8923, 8086, 7819, 7857, 7994, 8479, 9488, 10490, 10692, 10047, 9336, 9199, 9401, 9368, 9304, 10155, 12379, 15248, 17837, 19994, 21797, 22714, 22267, 20999, 19813, 18657, 16737, 13979, 11446, 10230, 10450, 11565, 13158, 15107, 17230, 19244, 21012, 22490, 23420, 23373, 22248, 20531, 18987, 17991, 17236, 16295, 15367, 15053, 15439, 15883, 15903, 15669, 15454, 15129, 14435, 13455, 12589, 12192, 12351, 12849, 13427, 13985, 14455, 14619, 14285, 13554, 12582, 11309, 9653, 7814, 6108, 4775, 4021, 3884, 4075, 4312, 4669, 5173, 5377, 4847, 3786, 2651, 1532, 338, -782, -1630, -2221, -2579, -2514, -1950, -1312, -1224, -1865, -2881, -3926, -5072, -6524, -8225, -9853, -11067, -11704, -11829, -11608, -11089, -10321, -9604, -9334, -9567, -10033, -10640, -11554, -12752, -13873, -14603, -14975, -15234, -15502, -15657, -15535, -15263, -15276, -15815, -16650, -17403, -18003, -18500, -18761, -18614, -18099, -17388, -16580, -15740, -14994, -14518, -14491, -15019, -15991, -17035, -17814, -18329, -18805, -19273, -19458, -19137, -18440, -17672, -16985, -16403, -15960, -15648, -15341, -14974, -14648, -14444, -14282, -14021, -13632, -13210, -12941, -13002, -13403, -13938, -14324, -14472, -14459, -14341, -14029, -13436, -12617, -11662, -10564, -9323, -8169, -7479, -7329, -7351, -7251, -7191, -7423, -7823, -8128, -8313, -8366, -8087, -7437, -6742, -6254, -5874, -5453, -5013, -4579, -4103, -3639, -3271, -2947, -2560, -2106, -1662, -1288, -1040, -956, -994, -1068, -1208, -1521, -1925, -2077, -1749, -1158, -678, -315, 207, 941, 1607, 1998, 2170, 2172, 1915, 1423, 980, 819, 837, 834, 856, 1073, 1452, 1810, 2094, 2323, 2389, 2143, 1689, 1338, 1248, 1284, 1251, 1169, 1220, 1495, 1899, 2226, 2321, 2214, 2075, 1939, 1625, 1073, 564, 367, 390, 447, 601, 966, 1421, 1750, 1925, 2013, 1955, 1643, 1135, 629, 227, -110, -393, -507, -351, 46, 600, 1196, 1684, 1932, 1913, 1657, 1223, 730, 262, -234, -772, -1096, -945, -426, 149, 666, 1146, 1520, 1727, 1851, 1903, 1670, 1033, 268, -191, -219, -56, 64, 155, 349, 706, 1185, 1668, 1967, 1943, 1705, 1538, 1625, 1897, 2148, 2200, 2072, 1975, 2092, 2316, 2351, 2070, 1615, 1188, 893, 778, 866, 1100, 1376, 1688, 2132, 2718, 3260, 3548, 3561, 3408, 3158, 2842, 2499, 2130, 1688, 1235, 951, 942, 1133, 1352, 1449, 1430, 1511, 1847, 2225, 2270, 2013, 1897, 2120, 2336, 2193, 1832, 1600, 1466, 1107, 508, 65, 41, 244, 384, 443, 569, 839, 1178, 1398, 1395, 1301, 1204, 834, 13, -755, -826, -370, -129, -347, -594, -497, -101, 325, 453, 27, -845, -1702, -2145, -2133, -1881, -1648, -1577, -1521, -1061, 49, 1349, 1927, 1455, 635, 257, 235, -8, -692, -1690, -2769, -3413, -3113, -2147, -1370, -1062, -759, -108, 797, 1648, 1940, 1342, 422, 184, 628, 776, 225, -424, -728, -927, -1267, -1722, -2414, -3548, -4867, -5750, -5990, -5969, -5855, -5073, -2967, 384, 4331, 8101, 10841, 11941, 11630, 10603, 8976, 6355, 2777, -1188, -4938, -7681, -8453, -7088, -4552, -1683, 1686, 5813, 10012, 13209, 15028, 15635, 15009, 13245, 11301, 10248, 9843, 9146, 8321, 8365, 9311, 10263, 10837, 11132, 10907, 10109, 9518, 9661, 9979, 9963, 10322, 12046, 14963, 18003, 20483, 22279, 23158, 22952, 22205, 21391, 19820, 16814, 13435, 11352, 10626, 10364, 10681, 12147, 14255, 16184, 18049, 20131, 21870, 22536, 22069, 20831, 19287, 17996, 17187, 16484, 15559, 14812, 14797, 15255, 15394, 14981, 14518, 14161, 13357, 11870, 10398, 9589, 9271, 9141, 9426, 10314, 11443, 12342, 12865, 12980, 12586, 11735, 10563, 9044, 7072, 4854, 2966, 1894, 1591, 1580, 1496, 1403, 1533, 1825, 1890, 1424, 443, -812, -2069, -3103, -3821, -4254, -4408, -4241, -3823, -3432, -3321, -3526, -4005, -4828, -6083, -7679, -9401, -11118, -12670, -13684, -13891, -13583, -13266, -12931, -12315, -11683, -11566, -11944, -12354, -12741, -13384, -14230, -14918, -15260, -15328, -15227, -15105, -15119, -15309, -15639, -16174, -17004, -17982, -18787, -19252, -19476, -19527, -19219, -18344, -17010, -15627, -14581, -14057, -14016, -14238, -14489, -14801, -15371, -16196, -17019, -17643, -18059, -18232, -18043, -17530, -16968, -16597, -16288, -15720, -14788, -13839, -13264, -12958, -12465, -11677, -11051, -10959, -11178, -11304, -11342, -11610, -12179, -12745, -13033, -12987, -12626, -11991, -11295, -10737, -10136, -9133, -7838, -6787, -6213, -5864, -5531, -5260, -5086, -4974, -4964, -5104, -5324, -5532, -5636, -5475, -5032, -4630, -4584, -4717, -4525, -3798, -2825, -2013, -1524, -1240, -909, -314, 484, 1040, 916, 290, -155, -76, 132, -12, -400, -535, -182, 473, 1144, 1690, 2087, 2325, 2419, 2446, 2497, 2551, 2446, 2031, 1444, 1150, 1473, 2084, 2300, 2003, 1807, 2152, 2673, 2732, 2246, 1678, 1436, 1521, 1683, 1719, 1640, 1594, 1682, 1837, 1940, 1968, 1948, 1792, 1353, 731, 285, 208, 269, 169, -77, -212, -3, 572, 1221, 1477, 1222, 875, 815, 890, 739, 296, -257, -743, -1005, -953, -701, -452, -277, -154, -85, -24, 110, 234, 109, -314, -814, -1153, -1254, -1149, -941, -773, -666, -435, 40, 548, 724, 534, 315, 271, 211, -32, -278, -316, -277, -364, -485, -379, 12, 465, 673, 532, 320, 431, 875, 1255, 1344, 1380, 1647, 2073, 2398, 2513, 2473, 2307, 2012, 1620, 1223, 918, 736, 642, 595, 624, 841, 1313, 1926, 2432, 2683, 2741, 2734, 2671, 2507, 2302, 2177, 2112, 1968, 1755, 1684, 1846, 2063, 2144, 2099, 1986, 1789, 1563, 1451, 1493, 1542, 1483, 1398, 1458, 1717, 2031, 2151, 1943, 1537, 1247, 1252, 1394, 1386, 1175, 973, 961, 1123, 1404, 1776, 2080, 2033, 1577, 1038, 757, 630, 256, -497, -1290, -1701, -1614, -1198, -693, -285, -2, 330, 874, 1459, 1640, 1193, 403, -310, -888, -1492, -2070, -2410, -2470, -2343, -2011, -1481, -930, -507, -201, -4, 71, 138, 229, 104, -329, -635, -386, 143, 303, -69, -519, -637, -528, -591, -1043, -1735, -2322, -2540, -2333, -1816, -1202, -672, -247, 224, 818, 1295, 1169, 165, -1419, -2911, -3885, -4486, -5081, -5645, -5660, -4622, -2501, 338, 3437, 6310, 8450, 9524, 9520, 8608, 7031, 5054, 2805, 287, -2163, -3724, -3810, -2675, -940, 1171, 3696, 6422, 8878, 10648, 11566, 11825, 11785, 11526, 10887, 10126, 9886, 10322, 10914, 11284, 11504, 11562, 11344, 11046, 10885, 10636, 10144, 9880, 10392, 11531, 12856, 14349, 16235, 18317, 20046, 21147, 21690, 21572, 20516, 18664, 16676, 15030, 13782, 12987, 12730, 12852, 13300, 14478, 16534, 18751, 20214, 20781, 20844, 20701, 20411, 19866, 18845, 17405, 16133, 15514, 15352, 15164, 14878, 14711, 14632, 14411, 13978, 13477, 13007, 12530, 12004, 11518, 11258, 11320, 11638, 12013, 12256, 12236, 11893, 11185, 10105, 8743, 7301, 6013, 4948, 4005, 3108, 2419, 2205, 2502, 2974, 3190, 2971, 2461, 1862, 1171, 203, -1113, -2536, -3739, -4574, -5022, -5096, -4960, -4929, -5082, -5197, -5219, -5438, -6056, -6979, -8103, -9373, -10551, -11362, -11858, -12284, -12669, -12840, -12757, -12574, -12533, -12855, -13555, -14315, -14767, -14878, -14946, -15172, -15429, -15455, -15168, -14732, -14435, -14530, -15072, -15858, -16590, -17205, -17854, -18537, -18976, -18919, -18480, -17891, -17175, -16254, -15301, -14684, -14511, -14532, -14554, -14713, -15171, -15786, -16250, -16448, -16492, -16536, -16612, -16602, -16345, -15816, -15194, -14686, -14294, -13842, -13228, -12533, -11917, -11460, -11130, -10895, -10779, -10748, -10702, -10642, -10773, -11231, -11770, -11951, -11607, -10973, -10376, -9932, -9506, -8818, -7737, -6491, -5500, -4956, -4663, -4374, -4083, -3952, -4087, -4477, -5039, -5609, -5923, -5767, -5217, -4649, -4372, -4272, -3921, -3070, -1967, -1108, -729, -614, -374, 132, 668, 885, 710, 388, 140, -30, -180, -325, -533, -833, -1011, -789, -199, 484, 1103, 1607, 1929, 2129, 2434, 2862, 3037, 2668, 1990, 1497, 1381, 1423, 1343, 1078, 766, 625, 791, 1145, 1328, 1170, 951, 985, 1169, 1263, 1305, 1385, 1365, 1176, 1019, 1013, 992, 846, 652, 427, 128, -111, -132, -59, -128, -289, -266, 8, 290, 367, 296, 233, 175, 19, -264, -619, -969, -1215, -1273, -1182, -1086, -1018, -866, -559, -190, 95, 224, 180, -37, -374, -702, -942, -1134, -1312, -1402, -1326, -1121, -834, -461, -78, 138, 141, 89, 127, 219, 274, 284, 299, 349, 427, 497, 541, 575, 603, 583, 492, 415, 485, 713, 968, 1174, 1439, 1873, 2359, 2674, 2784, 2823, 2817, 2652, 2304, 1920, 1624, 1396, 1164, 949, 885, 1073, 1431, 1747, 1944, 2174, 2551, 2972, 3273, 3405, 3364, 3167, 2912, 2685, 2432, 2098, 1794, 1612, 1483, 1375, 1432, 1699, 1956, 2035, 2072, 2264, 2541, 2674, 2620, 2522, 2443, 2280, 2004, 1758, 1622, 1472, 1170, 806, 601, 639, 789, 897, 958, 1062, 1282, 1571, 1751, 1652, 1358, 1158, 1124, 981, 544, 20, -320, -469, -544, -596, -637, -616, -414, -96, 38, -105, -216, -89, 17, -176, -515, -684, -706, -811, -1005, -1053, -874, -674, -639, -670, -574, -364, -234, -316, -526, -624, -453, -147, -14, -165, -365, -356, -186, -78, -108, -173, -247, -432, -729, -894, -690, -226, 146, 317, 576, 1095, 1564, 1591, 1194, 583, -240, -1330, -2523, -3628, -4585, -5287, -5505, -5065, -3829, -1646, 1312, 4360, 6807, 8512, 9658, 10188, 9813, 8450, 6351, 3881, 1391, -712, -2096, -2715, -2668, -1852, -77, 2427, 4994, 7098, 8704, 9975, 10972, 11721, 12278, 12636, 12710, 12634, 12746, 13088, 13222, 12870, 12290, 11678, 10820, 9787, 9191, 9189, 9172, 8951, 9384, 11163, 13817, 16411, 18575, 20376, 21718, 22440, 22629, 22420, 21625, 19969, 17723, 15646, 14236, 13374, 12784, 12525, 12831, 13741, 15035, 16446, 17804, 18975, 19800, 20164, 20073, 19691, 19217, 18674, 17903, 16882, 15956, 15373, 14865, 14101, 13322, 12882, 12595, 12152, 11678, 11274, 10744, 10235, 10276, 10786, 11042, 10849, 10679, 10639, 10321, 9589, 8636, 7532, 6386, 5452, 4706, 3857, 2966, 2418, 2243, 2149, 2045, 1969, 1690, 979, -15, -1004, -1943, -2920, -3926, -4871, -5602, -5907, -5768, -5481, -5356, -5413, -5519, -5668, -5972, -6471, -7129, -7964, -9006, -10148, -11140, -11833, -12308, -12695, -13074, -13464, -13831, -14094, -14306, -14649, -15086, -15275, -15024, -14588, -14285, -14130, -14001, -13885, -13802, -13788, -13998, -14593, -15492, -16443, -17298, -18068, -18662, -18848, -18631, -18319, -18050, -17552, -16662, -15746, -15246, -15085, -14930, -14698, -14538, -14533, -14679, -14908, -15095, -15225, -15415, -15600, -15558, -15340, -15302, -15504, -15554, -15253, -14846, -14575, -14346, -13966, -13372, -12637, -11922, -11392, -11039, -10758, -10546, -10451, -10380, -10243, -10197, -10419, -10769, -10893, -10619, -10075, -9515, -9111, -8786, -8286, -7534, -6801, -6371, -6219, -6163, -6133, -6126, -6044, -5815, -5548, -5389, -5304, -5164, -4946, -4681, -4318, -3813, -3333, -3064, -2877, -2459, -1835, -1374, -1254, -1205, -998, -833, -1025, -1470, -1777, -1836, -1873, -1967, -1835, -1270, -457, 251, 738, 1154, 1652, 2137, 2342, 2166, 1837, 1596, 1408, 1156, 908, 787, 738, 681, 699, 874, 1072, 1106, 1026, 1064, 1321, 1647, 1867, 1997, 2185, 2485, 2778, 2919, 2874, 2690, 2375, 1884, 1239, 602, 140, -173, -465, -682, -598, -130, 521, 1110, 1557, 1923, 2251, 2502, 2576, 2388, 1956, 1402, 843, 320, -165, -582, -872, -992, -941, -768, -545, -327, -123, 75, 260, 396, 468, 494, 469, 379, 258, 213, 280, 346, 265, 43, -144, -172, -108, -142, -334, -512, -463, -186, 125, 336, 505, 746, 1046, 1258, 1246, 1015, 726, 551, 498, 456, 399, 462, 756, 1210, 1652, 2030, 2426, 2875, 3254, 3430, 3419, 3346, 3279, 3172, 2954, 2628, 2272, 1969, 1760, 1628, 1545, 1517, 1598, 1854, 2299, 2829, 3287, 3601, 3842, 4102, 4335, 4396, 4222, 3902, 3581, 3327, 3100, 2849, 2577, 2325, 2101, 1888, 1704, 1599, 1582, 1631, 1770, 2025, 2362, 2739, 3156, 3525, 3685, 3633, 3559, 3508, 3271, 2762, 2204, 1846, 1718, 1717, 1729, 1673, 1591, 1644, 1841, 1948, 1776, 1440, 1186, 1090, 1038, 896, 668, 485, 460, 538, 580, 572, 642, 864, 1158, 1424, 1643, 1813, 1873, 1788, 1630, 1496, 1345, 1046, 587, 141, -143, -288, -424, -635, -853, -919, -748, -437, -130, 192, 634, 1147, 1538, 1754, 1959, 2231, 2337, 2016, 1401, 905, 701, 544, 194, -209, -356, -188, 52, 186, 285, 486, 736, 890, 982, 1217, 1659, 2105, 2366, 2519, 2717, 2919, 2946, 2732, 2356, 1944, 1626, 1507, 1570, 1687, 1791, 1985, 2395, 2946, 3396, 3582, 3512, 3228, 2751, 2120, 1383, 544, -361, -1159, -1604, -1554, -1016, -100, 1050, 2366, 3873, 5542, 7155, 8436, 9251, 9608, 9528, 9029, 8165, 7031, 5752, 4488, 3373, 2499, 1949, 1785, 1932, 2193, 2488, 2987, 3899, 5142, 6411, 7564, 8756, 10120, 11500, 12632, 13436, 13968, 14207, 14056, 13514, 12695, 11691, 10565, 9404, 8348, 7480, 6863, 6638, 6947, 7711, 8614, 9451, 10365, 11567, 12908, 13949, 14508, 14793, 14989, 14966, 14592, 14008, 13427, 12853, 12172, 11417, 10772, 10367, 10148, 9939, 9630, 9318, 9185, 9283, 9484, 9626, 9673, 9673, 9653, 9595, 9481, 9272, 8859, 8223, 7541, 6988, 6500, 5917, 5296, 4821, 4528, 4314, 4121, 3955, 3788, 3592, 3350, 3030, 2647, 2261, 1818, 1172, 348, -391, -928, -1449, -2110, -2779, -3257, -3564, -3843, -4146, -4383, -4461, -4393, -4299, -4302, -4406, -4538, -4683, -4915, -5288, -5769, -6314, -6923, -7631, -8398, -9124, -9724, -10179, -10528, -10806, -11029, -11178, -11198, -11037, -10752, -10503, -10423, -10466, -10475, -10384, -10329, -10463, -10737, -10962, -11059, -11160, -11394, -11708, -11964, -12133, -12316, -12573, -12842, -13016, -13053, -13020, -12984, -12931, -12768, -12439, -12003, -11599, -11303, -11093, -10906, -10743, -10667, -10707, -10823, -10962, -11098, -11230, -11361, -11444, -11433, -11329, -11186, -11017, -10776, -10456, -10145, -9915, -9737, -9542, -9335, -9193, -9155, -9195, -9229, -9222, -9198, -9184, -9136, -8976, -8710, -8452, -8287, -8156, -7944, -7631, -7307, -7048, -6829, -6596, -6352, -6148, -5981, -5793, -5585, -5434, -5403, -5451, -5477, -5452, -5438, -5495, -5600, -5665, -5616, -5443, -5191, -4923, -4664, -4376, -4015, -3612, -3266, -3023, -2847, -2694, -2575, -2515, -2511, -2557, -2655, -2783, -2879, -2887, -2810, -2698, -2593, -2465, -2246, -1955, -1709, -1579, -1508, -1417, -1323, -1288, -1296, -1285, -1238, -1187, -1145, -1101, -1052, -1004, -945, -868, -793, -766, -790, -802, -751, -691, -711, -782, -780, -675, -596, -623, -669, -634, -551, -511, -524, -532, -501, -453, -433, -462, -510, -533, -527, -517, -507, -474, -414, -366, -358, -392, -453, -518, -572, -610, -637, -654, -658, -640, -595, -519, -431, -365, -335, -310, -255, -195, -187, -242, -303, -327, -345, -387, -432, -442, -416, -368, -299, -236, -202, -162, -84, -2, 31, 50, 109, 201, 277, 324, 359, 404, 499, 652, 802, 880, 910, 963, 1056, 1153, 1232, 1310, 1384, 1432, 1455, 1496, 1594, 1729, 1840, 1904, 1969, 2091, 2259, 2405, 2502, 2584, 2683, 2786, 2855, 2889, 2917, 2954, 2994, 3036, 3098, 3205, 3349, 3505, 3646, 3753, 3823, 3876, 3933, 3994, 4034, 4038, 4024, 4018, 4023, 4041, 4088, 4166, 4233, 4245, 4227, 4247, 4325, 4399, 4418, 4413, 4448, 4529, 4606, 4661, 4723, 4807, 4890, 4941, 4959, 4980, 5026, 5059, 5023, 4925, 4828, 4763, 4695, 4619, 4574, 4573, 4588, 4620, 4688, 4774, 4865, 4999, 5186, 5350, 5422, 5445, 5466, 5462, 5400, 5296, 5180, 5064, 4954, 4853, 4758, 4692, 4687, 4720, 4744, 4763, 4827, 4921, 4978, 4995, 5031, 5114, 5189, 5206, 5186, 5180, 5188, 5177, 5129, 5053, 4946, 4797, 4620, 4456, 4317, 4194, 4088, 4043, 4072, 4149, 4241, 4360, 4491, 4572, 4572, 4548, 4563, 4567, 4483, 4315, 4144, 4021, 3914, 3765, 3576, 3401, 3277, 3174, 3049, 2914, 2825, 2793, 2777, 2758, 2771, 2851, 2960, 3025, 3031, 3024, 3033, 3032, 2986, 2895, 2773, 2635, 2484, 2330, 2172, 1994, 1809, 1646, 1515, 1399, 1304, 1269, 1316, 1395, 1452, 1501, 1583, 1683, 1722, 1672, 1575, 1468, 1325, 1122, 906, 725, 576, 447, 363, 324, 278, 197, 119, 72, 32, -35, -148, -285, -390, -414, -394, -401, -429, -423, -396, -391, -398, -389, -410, -517, -661, -747, -775, -826, -928, -1008, -1015, -985, -982, -1003, -1009, -1006, -1018, -1043, -1056, -1067, -1114, -1193, -1254, -1287, -1331, -1388, -1402, -1367, -1355, -1393, -1405, -1341, -1255, -1227, -1262, -1305, -1318, -1312, -1324, -1368, -1414, -1414, -1357, -1291, -1246, -1201, -1125, -1046, -1024, -1053, -1070, -1058, -1062, -1101, -1137, -1158, -1169, -1149, -1088, -1017, -955, -858, -708, -573, -517, -519, -521, -509, -508, -535, -580, -608, -597, -548, -484, -410, -306, -170, -33, 64, 135, 214, 289, 310, 270, 222, 196, 174, 141, 107, 73, 39, 33, 68, 118, 157, 213, 314, 428, 500, 536, 579, 649, 712, 734, 725, 726, 742, 739, 698, 634, 581, 538, 471, 367, 276, 238, 226, 190, 151, 180, 268, 337, 354, 363, 389, 401, 368, 311, 262, 223, 173, 101, 14, -71, -142, -202, -262, -337, -413, -472, -515, -571, -646, -719, -780, -840, -908, -977, -1028, -1059, -1084, -1121, -1180, -1255, -1327, -1379, -1425, -1486, -1575, -1668, -1750, -1824, -1906, -1995, -2079, -2154, -2225, -2289, -2334, -2368, -2421, -2501, -2588, -2653, -2696, -2735, -2784, -2857, -2944, -3026, -3096, -3178, -3283, -3388, -3466, -3526, -3584, -3636, -3669, -3697, -3733, -3779, -3824, -3859, -3885, -3925, -3990, -4064, -4120, -4158, -4202, -4261, -4308, -4327, -4335, -4354, -4381, -4394, -4408, -4450, -4505, -4535, -4540, -4546, -4555, -4552, -4533, -4503, -4450, -4374, -4300, -4244, -4187, -4126, -4083, -4064, -4045, -4016, -3997, -4004, -4015, -4000, -3962, -3924, -3884, -3833, -3783, -3741, -3700, -3646, -3586, -3536, -3492, -3442, -3383, -3311, -3232, -3167, -3123, -3073, -2999, -2921, -2874, -2852, -2821, -2772, -2726, -2693, -2658, -2608, -2553, -2506, -2458, -2394, -2314, -2228, -2140, -2056, -1981, -1919, -1870, -1832, -1810, -1797, -1785, -1768, -1745, -1718, -1689, -1658, -1609, -1530, -1437, -1354, -1292, -1246, -1203, -1164, -1122, -1071, -1018, -978, -952, -912, -846, -776, -733, -718, -710, -702, -707, -731, -758, -773, -773, -756, -717, -657, -577, -480, -377, -290, -231, -183, -118, -54, -30, -51, -77, -83, -86, -118, -160, -178, -174, -171, -166, -138, -80, -13, 52, 117, 181, 245, 311, 365, 397, 425, 469, 512, 528, 528, 549, 593, 634, 652, 662, 684, 720, 760, 802, 844, 887, 940, 1014, 1100, 1180, 1258, 1350, 1451, 1531, 1570, 1589, 1618, 1664, 1712, 1737, 1739, 1751, 1791, 1835, 1863, 1894, 1951, 2023, 2077, 2113, 2153, 2204, 2265, 2332, 2395, 2445, 2491, 2548, 2616, 2676, 2713, 2735, 2755, 2781, 2809, 2835, 2867, 2910, 2955, 2987, 3007, 3028, 3053, 3078, 3097, 3122, 3149, 3170, 3177, 3176, 3179, 3184, 3186, 3174, 3144, 3092, 3040, 3017, 3014, 2989, 2940, 2911, 2927, 2944, 2935, 2929, 2938, 2932, 2899, 2868, 2841, 2797, 2748, 2712, 2669, 2600, 2538, 2500, 2456, 2387, 2318, 2273, 2234, 2178, 2120, 2076, 2044, 2007, 1951, 1892, 1846, 1824, 1810, 1781, 1734, 1680, 1622, 1565, 1514, 1461, 1387, 1307, 1245, 1193, 1133, 1075, 1047, 1036, 1013, 980, 955, 941, 921, 903, 908, 930, 933, 900, 854, 814, 779, 749, 732, 720, 690, 648, 617, 600, 574, 543, 529, 536, 534, 515, 500, 515, 544, 573, 603, 628, 629, 617, 627, 646, 614, 537, 484, 477, 464, 421, 388, 388, 395, 391, 393, 418, 473, 553, 631, 687, 737, 806, 868, 907, 940, 984, 1008, 994, 973, 968, 960, 944, 937, 932, 921, 920, 940, 958, 964, 990, 1050, 1122, 1192, 1267, 1342, 1401, 1442, 1475, 1496, 1513, 1538, 1546, 1503, 1440, 1424, 1452, 1470, 1459, 1460, 1493, 1537, 1572, 1605, 1639, 1664, 1676, 1683, 1690, 1700, 1722, 1762, 1802, 1806, 1773, 1741, 1733, 1739, 1747, 1753, 1745, 1719, 1696, 1691, 1694, 1685, 1669, 1650, 1612, 1569, 1549, 1563, 1576, 1559, 1528, 1510, 1500, 1474, 1441, 1419, 1394, 1349, 1296, 1257, 1223, 1178, 1133, 1102, 1066, 1019, 983, 962, 930, 882, 832, 793, 761, 730, 695, 660, 631, 618, 604, 566, 509, 463, 435, 406, 354, 284, 218, 174, 149, 122, 85, 50, 32, 24, 16, 0, -30, -79, -137, -180, -212, -236, -240, -223, -213, -234, -260, -260, -255, -278, -327, -375, -413, -442, -457, -454, -446, -456, -484, -511, -521, -506, -483, -475, -496, -529, -544, -533, -513, -501, -487, -458, -431, -426, -442, -452, -448, -447, -458, -468, -469, -472, -487, -502, -509, -509, -508, -501, -489, -482, -477, -467, -452, -432, -412, -401, -403, -407, -396, -378, -368, -365, -357, -350, -361, -386, -400, -402, -418, -457, -496, -510, -512, -512, -497, -470, -462, -474, -473, -442, -416, -423, -450, -473, -490, -511, -551, -613, -670, -697, -710, -743, -796, -831, -842, -850, -864, -879, -895, -911, -919, -912, -909, -933, -981, -1031, -1075, -1118, -1172, -1238, -1306, -1366, -1427, -1485, -1532, -1570, -1616, -1665, -1690, -1696, -1718, -1766, -1805, -1819, -1841, -1891, -1941, -1971, -1993, -2024, -2065, -2114, -2168, -2227, -2289, -2355, -2419, -2470, -2509, -2542, -2569, -2592, -2616, -2643, -2665, -2681, -2705, -2744, -2780, -2795, -2803, -2828, -2881, -2940, -2978, -2997, -3012, -3040, -3072, -3102, -3130, -3151, -3158, -3149, -3139, -3141, -3151, -3148, -3126, -3104, -3102, -3120, -3138, -3139, -3130, -3123, -3118, -3113, -3106, -3105, -3103, -3096, -3091, -3084, -3062, -3023, -2995, -2986, -2966, -2920, -2865, -2823, -2782, -2735, -2695, -2671, -2651, -2626, -2604, -2592, -2577, -2547, -2509, -2473, -2439, -2400, -2349, -2290, -2225, -2163, -2114, -2069, -2016, -1961, -1915, -1872, -1817, -1764, -1733, -1705, -1649, -1575, -1518, -1496, -1474, -1424, -1348, -1274, -1214, -1162, -1105, -1041, -973, -904, -834, -760, -681, -607, -543, -484, -423, -366, -313, -255, -195, -154, -122, -71, -2, 52, 96, 153, 226, 296, 365, 442, 512, 562, 605, 658, 715, 768, 815, 855, 884, 914, 954, 998, 1036, 1070, 1105, 1135, 1152, 1166, 1192, 1230, 1266, 1289, 1307, 1330, 1362, 1393, 1415, 1434, 1453, 1471, 1486, 1503, 1522, 1538, 1551, 1561, 1559, 1542, 1529, 1543, 1564, 1572, 1577, 1597, 1616, 1621, 1613, 1610, 1607, 1601, 1604, 1616, 1625, 1622, 1613, 1601, 1587, 1581, 1588, 1593, 1587, 1568, 1546, 1529, 1523, 1520, 1505, 1478, 1460, 1466, 1478, 1474, 1452, 1434, 1427, 1429, 1428, 1424, 1420, 1421, 1420, 1408, 1392, 1381, 1377, 1374, 1359, 1334, 1315, 1295, 1265, 1228, 1202, 1194, 1190, 1180, 1169, 1165, 1161, 1163, 1169, 1174, 1165, 1144, 1121, 1104, 1096, 1099, 1102, 1096, 1082, 1078, 1090, 1100, 1085, 1058, 1049, 1053, 1048, 1029, 1017, 1015, 1014, 1020, 1041, 1066, 1083, 1100, 1120, 1128, 1120, 1112, 1122, 1134, 1131, 1121, 1126, 1149, 1167, 1175, 1186, 1204, 1221, 1240, 1261, 1268, 1254, 1240, 1242, 1246, 1246, 1255, 1275, 1290, 1298, 1320, 1362, 1406, 1432, 1447, 1461, 1474, 1480, 1474, 1462, 1452, 1455, 1480, 1515, 1536, 1539, 1544, 1554, 1554, 1551, 1565, 1580, 1574, 1558, 1555, 1558, 1560, 1574, 1596, 1605, 1600, 1597, 1592, 1577, 1568, 1583, 1603, 1598, 1571, 1553, 1547, 1549, 1549, 1534, 1499, 1469, 1466, 1473, 1460, 1427, 1398, 1386, 1382, 1375, 1367, 1362, 1363, 1371, 1375, 1375, 1372, 1367, 1353, 1327, 1297, 1272, 1252, 1236, 1223, 1214, 1200, 1177, 1152, 1136, 1131, 1125, 1113, 1092, 1061, 1031, 1023, 1024, 1007, 976, 962, 961, 941, 908, 889, 878, 839, 779, 736, 717, 700, 678, 660, 645, 626, 604, 575, 538, 494, 453, 417, 382, 356, 339, 321, 289, 249, 218, 205, 200, 184, 150, 107, 73, 47, 23, -8, -40, -71, -100, -126, -144, -159, -180, -206, -225, -232, -240, -271, -323, -366, -378, -379, -402, -442, -464, -462, -477, -528, -578, -594, -586, -585, -605, -634, -654, -664, -668, -671, -678, -686, -701, -717, -726, -731, -747, -780, -805, -808, -801, -807, -822, -832, -840, -858, -884, -896, -885, -870, -879, -901, -902, -875, -856, -872, -894, -885, -861, -858, -877, -880, -866, -862, -880, -905, -921, -938, -963, -984, -986, -969, -946, -927, -915, -908, -904, -890, -869, -858, -866, -877, -874, -863, -862, -870, -876, -878, -891, -906, -896, -868, -858, -880, -902, -894, -868, -861, -876, -891, -891, -888, -885, -879, -870, -864, -862, -856, -850, -848, -858, -876, -889, -887, -879, -888, -912, -923, -908, -892, -901, -919, -923, -918, -923, -942, -957, -961, -961, -959, -952, -946, -955, -974, -986, -985, -984, -996, -1018, -1045, -1064, -1067, -1056, -1051, -1062, -1076, -1081, -1076, -1069, -1061, -1056, -1048, -1041, -1047, -1073, -1100, -1104, -1100, -1111, -1130, -1139, -1137, -1143, -1151, -1146, -1124, -1104, -1105, -1124, -1143, -1140, -1123, -1116, -1130, -1143, -1137, -1126, -1128, -1142, -1159, -1179, -1192, -1183, -1159, -1140, -1142, -1149, -1145, -1121, -1093, -1080, -1082, -1081, -1064, -1048, -1047, -1052, -1047, -1026, -1004, -994, -995, -997, -995, -988, -983, -977, -965, -954, -952, -951, -928, -889, -861, -846, -829, -808, -796, -791, -783, -770, -757, -744, -729, -723, -721, -712, -695, -686, -690, -690, -674, -653, -648, -651, -643, -621, -601, -587, -578, -570, -562, -552, -532, -516, -521, -544, -549, -522, -496, -498, -509, -502, -490, -493, -500, -485, -444, -405, -397, -419, -443, -433, -397, -371, -374, -379, -377, -383, -397, -390, -358, -337, -346, -361, -353, -333, -328, -335, -337, -345, -369, -388, -374, -346, -340, -350, -349, -339, -327, -304, -268, -250, -263, -280, -273, -248, -230, -232, -247, -258, -259, -255, -246, -231, -216, -214, -227, -236, -229, -220, -216, -204, -178, -158, -159, -167, -161, -144, -137, -136, -125, -110, -110, -121, -113, -83, -53, -37, -24, -7, 11, 28, 41, 46, 45, 49, 63, 82, 97, 108, 119, 121, 118, 127, 166, 218, 248, 252, 259, 279, 299, 314, 333, 353, 362, 368, 387, 414, 432, 441, 461, 492, 511, 516, 530, 559, 579, 584, 603, 638, 660, 667, 691, 736, 760, 745, 728, 748, 780, 791, 788, 803, 832, 850, 866, 904, 945, 962, 963, 974, 992, 998, 994, 990, 992, 1005, 1020, 1023, 1014, 1020, 1045, 1058, 1047, 1039, 1058, 1088, 1109, 1126, 1149, 1167, 1165, 1148, 1138, 1141, 1145, 1145, 1149, 1160, 1167, 1158, 1135, 1110, 1101, 1116, 1129, 1124, 1123, 1147, 1160, 1136, 1117, 1134, 1148, 1132, 1120, 1122, 1092, 1026, 993, 1016, 1035, 1008, 971, 952, 938, 912, 891, 893, 893, 869, 834, 815, 818, 820, 814, 807, 799, 780, 754, 731, 718, 715, 709, 689, 663, 652, 659, 658, 633, 594, 564, 548, 536, 526, 529, 536, 527, 506, 497, 506, 511, 506, 495, 472, 432, 401, 397, 387, 341, 290, 277, 284, 283, 277, 287, 304, 313, 317, 325, 322, 293, 252, 228, 228, 235, 236, 229, 217, 205, 205, 214, 205, 179, 161, 166, 168, 146, 119, 120, 135, 138, 136, 148, 166, 163, 147, 152, 170, 163, 139, 142, 174, 196, 190, 176, 169, 155, 143, 146, 163, 174, 164, 142, 135, 152, 185, 207, 212, 213, 223, 248, 282, 309, 311, 296, 293, 301, 295, 276, 282, 326, 358, 342, 315, 337, 393, 415, 386, 354, 359, 382, 398, 414, 431, 431, 423, 436, 464, 478, 478, 481, 486, 488, 494, 504, 505, 497, 504, 526, 540, 531, 514, 508, 514, 520, 527, 532, 532, 522, 514, 522, 538, 534, 504, 482, 495, 523, 528, 503, 482, 481, 483, 471, 444, 422, 420, 435, 451, 446, 430, 430, 454, 471, 446, 398, 369, 374, 377, 354, 322, 299, 282, 268, 267, 280, 282, 254, 209, 181, 176, 182, 180, 170, 158, 144, 128, 109, 89, 74, 71, 77, 82, 76, 68, 63, 58, 55, 54, 53, 51, 47, 41, 31, 19, 9, -2, -17, -28, -34, -40, -51, -61, -74, -94, -112, -117, -108, -109, -122, -123, -102, -85, -95, -118, -125, -125, -147, -184, -205, -201, -201, -219, -242, -258, -270, -283, -292, -295, -303, -318, -331, -327, -311, -303, -314, -333, -339, -334, -331, -343, -360, -366, -360, -365, -392, -424, -447, -463, -480, -490, -479, -457, -453, -472, -491, -495, -485, -477, -480, -498, -524, -537, -523, -509, -526, -558, -569, -556, -554, -573, -586, -585, -589, -614, -635, -629, -618, -628, -649, -662, -671, -688, -699, -695, -688, -689, -685, -670, -652, -650, -654, -650, -653, -683, -716, -717, -701, -706, -732, -740, -727, -717, -721, -728, -735, -740, -744, -758, -785, -798, -782, -767, -775, -781, -770, -766, -780, -791, -788, -791, -801, -792, -770, -769, -797, -819, -812, -789, -772, -768, -768, -768, -770, -773, -778, -789, -807, -818, -810, -791, -782, -791, -802, -794, -768, -743, -737, -750, -767, -771, -765, -756, -750, -740, -719, -703, -701, -704, -701, -690, -675, -663, -659, -663, -668, -658, -636, -619, -614, -613, -605, -585, -554, -530, -531, -550, -558, -541, -513, -490, -477, -474, -477, -470, -437, -391, -371, -389, -408, -391, -353, -334, -339, -342, -324, -297, -282, -284, -290, -273, -231, -193, -187, -199, -195, -163, -127, -109, -112, -123, -131, -130, -116, -94, -82, -84, -86, -73, -46, -22, -10, -6, -2, 3, 11, 12, 11, 19, 32, 40, 47, 63, 68, 49, 22, 22, 38, 29, -4, -15, 18, 53, 50, 30, 42, 74, 78, 51, 29, 33, 47, 56, 64, 75, 84, 84, 78, 79, 103, 136, 143, 117, 87, 90, 110, 105, 67, 41, 55, 84, 88, 70, 64, 86, 112, 120, 112, 105, 99, 88, 72, 61, 55, 47, 38, 40, 61, 79, 77, 61, 55, 67, 74, 70, 73, 96, 108, 82, 45, 41, 52, 39, 14, 24, 64, 93, 89, 70, 53, 54, 73, 85, 76, 70, 85, 95, 77, 58, 72, 97, 94, 67, 53, 64, 83, 89, 87, 94, 119, 140, 135, 114, 110, 127, 135, 117, 87, 63, 54, 65, 86, 98, 97, 99, 110, 124, 130, 130, 118, 104, 106, 129, 142, 126, 98, 92, 107, 124, 120, 104, 100, 125, 152, 144, 117, 112, 130, 133, 121, 129, 157, 173, 172, 182, 205, 207, 177, 151, 161, 190, 200, 189, 185, 198, 215, 216, 205, 202, 224, 258, 263, 225, 186, 195, 235, 266, 281, 288, 279, 255, 241, 254, 274, 285, 288, 289, 290, 285, 272, 257, 261, 289, 309, 293, 271, 290, 341, 377, 375, 349, 317, 294, 289, 294, 295, 289, 283, 287, 291, 295, 301, 302, 303, 311, 323, 326, 315, 303, 302, 310, 316, 315, 311, 315, 327, 335, 327, 314, 312, 319, 316, 305, 303, 322, 344, 343, 315, 287, 283, 300, 311, 308, 306, 314, 311, 291, 272, 266, 260, 249, 246, 255, 266, 272, 274, 265, 244, 228, 234, 256, 281, 295, 284, 259, 250, 266, 271, 244, 212, 216, 254, 285, 285, 256, 219, 206, 225, 250, 251, 235, 230, 251, 276, 277, 262, 251, 246, 248, 261, 277, 269, 245, 234, 246, 254, 245, 239, 250, 261, 256, 245, 238, 233, 222, 214, 218, 224, 223, 227, 245, 257, 249, 238, 244, 259, 268, 262, 248, 235, 245, 271, 284, 276, 273, 285, 289, 274, 263, 250, 220, 201, 224, 259, 258, 239, 255, 302, 326, 313, 300, 310, 316, 309, 316, 346, 357, 335, 321, 348, 380, 373, 355, 375, 411, 402, 353, 337, 374, 408, 417, 420, 407, 354, 316, 350, 403, 399, 377, 406, 442, 410, 342, 331, 379, 408, 385, 352, 343, 350, 378, 422, 441, 410, 401, 490, 600, 598, 512, 478, 531, 585, 596, 602, 609, 591, 558, 562, 574, 511, 404, 407, 559, 750, 954, 1233, 1481, 1477, 1236, 988, 800, 581, 354, 195, 74, -11, 35, 150, 116, -51, -112, -45, -76, -236, -288, -141, 3, -47, -229, -323, -225, -105, -199, -456, -562, -416, -302, -440, -652, -684, -625, -725, -971, -1116, -1092, -1096, -1243, -1389, -1402, -1378, -1472, -1619, -1643, -1566, -1560, -1641, -1640, -1536, -1515, -1617, -1649, -1554, -1515, -1595, -1626, -1561, -1543, -1600, -1642, -1702, -1851, -1974, -1937, -1821, -1776, -1822, -1917, -2025, -2058, -1940, -1746, -1616, -1590, -1630, -1717, -1809, -1833, -1774, -1679, -1575, -1464, -1408, -1438, -1472, -1425, -1340, -1328, -1393, -1436, -1379, -1247, -1125, -1070, -1043, -977, -894, -878, -938, -993, -1013, -1036, -1071, -1090, -1097, -1089, -1015, -883, -775, -699, -585, -464, -423, -411, -326, -227, -195, -167, -116, -139, -204, -130, 58, 132, 63, 27, 32, -42, -141, -149, -141, -192, -177, -14, 166, 269, 358, 471, 531, 511, 442, 333, 208, 149, 183, 252, 338, 449, 531, 553, 593, 677, 673, 501, 294, 195, 186, 198, 250, 375, 529, 650, 681, 554, 268, -35, -162, -54, 160, 338, 464, 602, 771, 923, 976, 856, 581, 321, 271, 417, 565, 626, 711, 899, 1058, 1009, 779, 560, 465, 484, 581, 693, 683, 488, 261, 173, 153, 39, -109, -83, 139, 350, 456, 613, 921, 1201, 1250, 1126, 997, 914, 893, 970, 1060, 1052, 1063, 1235, 1376, 1222, 874, 580, 380, 274, 338, 441, 370, 317, 627, 1125, 1360, 1322, 1286, 1244, 1103, 1029, 1126, 1182, 1072, 968, 958, 897, 715, 481, 226, 14, 36, 343, 656, 709, 649, 801, 1129, 1258, 1060, 813, 710, 636, 575, 722, 1059, 1319, 1461, 1684, 1932, 1888, 1486, 1035, 771, 684, 733, 945, 1241, 1436, 1520, 1655, 1794, 1614, 1044, 476, 259, 281, 316, 413, 677, 944, 1022, 1026, 1213, 1556, 1806, 1878, 1893, 1873, 1717, 1489, 1361, 1302, 1172, 1023, 982, 952, 779, 549, 445, 466, 471, 348, 70, -255, -396, -255, 6, 212, 381, 558, 682, 736, 793, 843, 758, 506, 226, 32, -123, -300, -404, -355, -264, -293, -420, -567, -781, -1069, -1264, -1280, -1249, -1210, -1002, -628, -365, -363, -502, -672, -847, -953, -926, -809, -605, -283, -26, -101, -456, -843, -1201, -1529, -1671, -1630, -1670, -1806, -1744, -1538, -1530, -1616, -1388, -995, -946, -1181, -1168, -799, -454, -371, -494, -710, -891, -928, -897, -996, -1221, -1360, -1277, -1036, -778, -615, -559, -570, -719, -1164, -1795, -2172, -2025, -1550, -1006, -310, 623, 1451, 1679, 1234, 515, -71, -424, -648, -816, -912, -855, -593, -248, -123, -389, -819, -1072, -1139, -1247, -1420, -1433, -1142, -651, -186, 94, 206, 291, 403, 421, 288, 184, 278, 402, 249, -187, -578, -679, -617, -675, -930, -1193, -1279, -1178, -998, -845, -765, -755, -769, -776, -800, -874, -941, -902, -750, -550, -272, 147, 574, 707, 453, 68, -151, -184, -196, -278, -365, -358, -256, -162, -172, -273, -385, -475, -572, -680, -743, -716, -646, -609, -601, -531, -358, -126, 107, 303, 427, 471, 468, 434, 363, 287, 225, 84, -206, -488, -532, -358, -184, -147, -242, -394, -420, -174, 205, 473, 629, 784, 834, 685, 520, 484, 409, 214, 130, 262, 357, 270, 197, 248, 238, 58, -120, -187, -302, -604, -908, -907, -587, -246, -84, 1, 192, 465, 655, 671, 552, 377, 234, 226, 399, 662, 868, 985, 1114, 1316, 1470, 1384, 1008, 484, 7, -333, -576, -827, -1118, -1324, -1301, -1088, -818, -465, 75, 699, 1182, 1544, 1931, 2239, 2187, 1747, 1190, 739, 428, 258, 272, 418, 538, 547, 467, 267, -94, -440, -533, -490, -618, -821, -713, -281, 126, 440, 875, 1387, 1696, 1754, 1712, 1571, 1248, 806, 362, -72, -489, -798, -943, -1004, -1104, -1287, -1483, -1578, -1535, -1429, -1328, -1197, -1002, -782, -562, -289, 42, 341, 576, 828, 1088, 1193, 1007, 547, -87, -776, -1403, -1905, -2268, -2443, -2417, -2304, -2167, -1865, -1324, -767, -391, -113, 120, 148, -15, -32, 244, 520, 554, 474, 427, 309, 32, -250, -416, -630, -1089, -1667, -2042, -2142, -2210, -2374, -2401, -2043, -1440, -930, -595, -273, 75, 338, 506, 625, 600, 353, 36, -208, -478, -785, -880, -692, -533, -650, -869, -940, -912, -1007, -1291, -1663, -1992, -2173, -2106, -1803, -1424, -1096, -755, -289, 243, 706, 1026, 1110, 896, 561, 346, 154, -262, -781, -1034, -996, -970, -1084, -1252, -1427, -1559, -1511, -1258, -965, -736, -522, -303, -99, 129, 429, 791, 1247, 1756, 2032, 1821, 1343, 1036, 918, 617, 10, -585, -906, -1045, -1175, -1252, -1126, -811, -450, -113, 223, 569, 886, 1179, 1462, 1661, 1672, 1536, 1420, 1398, 1358, 1168, 861, 564, 316, 45, -282, -584, -780, -870, -842, -628, -261, 63, 218, 308, 467, 661, 785, 835, 864, 919, 1059, 1284, 1479, 1553, 1561, 1553, 1441, 1161, 795, 414, -20, -519, -945, -1159, -1180, -1106, -940, -602, -106, 388, 720, 853, 839, 707, 481, 214, -17, -181, -299, -385, -377, -182, 195, 624, 969, 1166, 1137, 808, 285, -172, -475, -786, -1154, -1313, -1021, -425, 98, 393, 560, 635, 546, 368, 259, 144, -102, -262, -12, 511, 930, 1179, 1381, 1437, 1268, 1111, 1126, 1019, 471, -336, -961, -1246, -1340, -1328, -1125, -695, -116, 581, 1366, 2080, 2589, 2996, 3376, 3505, 3212, 2734, 2350, 1912, 1160, 291, -252, -382, -382, -403, -331, -181, -152, -214, -78, 279, 558, 721, 1131, 1911, 2664, 3082, 3372, 3779, 4064, 3874, 3356, 2865, 2312, 1425, 424, -292, -834, -1428, -1782, -1603, -1164, -697, 7, 921, 1609, 2020, 2457, 2784, 2714, 2542, 2575, 2448, 1910, 1424, 1272, 1048, 573, 214, 51, -228, -599, -799, -918, -1106, -1114, -761, -323, 10, 453, 1118, 1781, 2259, 2574, 2725, 2675, 2503, 2263, 1870, 1299, 727, 325, 76, -142, -414, -708, -856, -660, -108, 549, 1027, 1271, 1416, 1549, 1625, 1611, 1560, 1509, 1431, 1381, 1512, 1872, 2272, 2480, 2468, 2350, 2163, 1859, 1497, 1207, 969, 657, 299, 35, -130, -270, -302, -141, 74, 218, 439, 868, 1323, 1588, 1750, 1998, 2286, 2389, 2149, 1602, 966, 452, 36, -456, -1017, -1458, -1712, -1871, -1947, -1886, -1760, -1658, -1487, -1103, -567, -45, 422, 855, 1147, 1132, 780, 216, -429, -1086, -1688, -2138, -2393, -2565, -2821, -3147, -3347, -3347, -3285, -3187, -2889, -2402, -1977, -1658, -1234, -735, -510, -684, -1029, -1424, -1949, -2533, -2962, -3232, -3512, -3770, -3773, -3454, -3048, -2780, -2628, -2486, -2409, -2543, -2867, -3182, -3355, -3437, -3473, -3386, -3125, -2771, -2412, -2048, -1741, -1642, -1770, -2002, -2319, -2807, -3359, -3740, -3925, -4044, -4039, -3741, -3242, -2842, -2609, -2343, -1995, -1819, -1928, -2109, -2273, -2661, -3274, -3595, -3289, -2729, -2410, -2247, -1906, -1431, -1132, -1122, -1323, -1716, -2277, -2799, -3064, -3159, -3276, -3317, -3047, -2571, -2211, -1991, -1699, -1391, -1385, -1784, -2351, -2811, -3020, -2982, -2822, -2663, -2473, -2130, -1631, -1093, -645, -425, -591, -1164, -1951, -2670, -3108, -3267, -3380, -3603, -3639, -3083, -2135, -1454, -1197, -875, -275, 190, 190, -100, -439, -857, -1406, -1950, -2337, -2532, -2546, -2389, -2131, -1895, -1718, -1508, -1195, -847, -589, -478, -519, -672, -808, -778, -576, -303, -48, 99, 66, -61, -88, -10, 17, -6, 28, 13, -223, -516, -522, -213, 185, 541, 852, 1107, 1345, 1593, 1715, 1574, 1300, 1081, 874, 622, 468, 490, 551, 616, 851, 1258, 1633, 1896, 2097, 2148, 1936, 1564, 1176, 774, 381, 136, 76, 133, 338, 778, 1401, 2126, 2989, 3933, 4633, 4817, 4580, 4167, 3571, 2645, 1510, 550, -59, -478, -789, -803, -429, 124, 680, 1358, 2272, 3231, 3950, 4404, 4758, 5064, 5223, 5178, 4989, 4696, 4263, 3684, 3002, 2221, 1317, 439, -84, -137, 12, 161, 569, 1483, 2562, 3289, 3718, 4209, 4702, 4833, 4607, 4361, 4199, 3935, 3516, 3135, 2895, 2675, 2373, 2068, 1866, 1776, 1795, 1878, 1863, 1737, 1807, 2252, 2700, 2784, 2759, 2992, 3290, 3300, 3135, 3046, 2881, 2399, 1794, 1473, 1503, 1583, 1467, 1201, 992, 930, 936, 909, 801, 521, -17, -663, -1084, -1135, -996, -821, -516, -13, 517, 952, 1456, 2143, 2632, 2414, 1635, 956, 600, 153, -549, -1081, -1165, -1067, -1019, -892, -604, -315, -36, 451, 1156, 1755, 2102, 2455, 2966, 3322, 3241, 2973, 2873, 2804, 2453, 1926, 1550, 1353, 1165, 991, 962, 1096, 1385, 1896, 2597, 3239, 3666, 4075, 4732, 5494, 5918, 5874, 5690, 5589, 5326, 4639, 3782, 3226, 2988, 2762, 2588, 2844, 3551, 4305, 4881, 5406, 5921, 6296, 6505, 6600, 6533, 6299, 6057, 5879, 5640, 5268, 4905, 4673, 4504, 4305, 4119, 4059, 4144, 4269, 4315, 4284, 4270, 4317, 4373, 4383, 4346, 4266, 4128, 3939, 3710, 3390, 2951, 2486, 2123, 1856, 1587, 1322, 1156, 1092, 1024, 899, 781, 699, 570, 337, 73, -144, -386, -768, -1276, -1762, -2106, -2280, -2320, -2314, -2393, -2639, -2983, -3276, -3469, -3621, -3746, -3854, -4081, -4516, -4964, -5206, -5360, -5611, -5877, -6101, -6436, -6840, -6990, -6874, -6895, -7134, -7239, -7161, -7269, -7636, -7857, -7756, -7667, -7881, -8209, -8292, -8145, -8112, -8392, -8760, -8881, -8734, -8557, -8444, -8306, -8148, -8126, -8238, -8287, -8193, -8090, -8095, -8184, -8291, -8328, -8267, -8244, -8377, -8518, -8457, -8307, -8280, -8273, -8085, -7836, -7713, -7559, -7158, -6687, -6477, -6457, -6301, -6025, -5981, -6242, -6431, -6338, -6210, -6255, -6297, -6180, -6035, -5910, -5616, -5143, -4800, -4711, -4596, -4202, -3703, -3460, -3527, -3609, -3470, -3289, -3382, -3666, -3729, -3453, -3151, -2993, -2795, -2514, -2395, -2477, -2466, -2250, -2078, -2077, -2034, -1797, -1514, -1350, -1234, -1073, -984, -1110, -1333, -1405, -1299, -1213, -1244, -1283, -1238, -1164, -1096, -973, -759, -548, -439, -390, -313, -187, -30, 84, -13, -363, -658, -612, -428, -488, -719, -765, -615, -534, -539, -423, -202, -115, -232, -368, -360, -241, -125, -78, -138, -311, -509, -592, -538, -489, -588, -846, -1140, -1279, -1107, -696, -358, -317, -377, -150, 315, 485, 144, -220, -216, -150, -379, -645, -668, -739, -1123, -1503, -1530, -1316, -1096, -937, -863, -821, -584, -133, 147, 16, -267, -425, -569, -865, -1190, -1324, -1243, -1095, -1021, -965, -674, -66, 496, 608, 367, 142, -25, -361, -821, -1114, -1176, -1193, -1193, -974, -511, -110, -14, -104, -167, -219, -307, -279, -13, 322, 474, 376, 119, -130, -198, -116, -119, -227, -132, 260, 616, 716, 775, 955, 1045, 897, 769, 954, 1320, 1441, 1089, 510, 193, 310, 544, 585, 540, 624, 732, 710, 746, 1101, 1695, 2256, 2624, 2750, 2703, 2693, 2792, 2717, 2273, 1756, 1553, 1610, 1684, 1795, 2080, 2447, 2708, 2866, 3064, 3329, 3523, 3515, 3363, 3270, 3376, 3569, 3579, 3271, 2836, 2575, 2542, 2583, 2684, 2946, 3213, 3192, 3000, 3078, 3484, 3833, 3936, 4023, 4260, 4520, 4723, 4977, 5321, 5541, 5389, 4857, 4195, 3666, 3285, 2811, 2089, 1362, 1147, 1715, 2771, 3750, 4367, 4749, 5020, 5002, 4525, 3830, 3291, 2844, 2132, 1206, 531, 321, 369, 551, 914, 1369, 1821, 2458, 3417, 4340, 4761, 4763, 4784, 4839, 4491, 3623, 2718, 2127, 1644, 1110, 811, 942, 1248, 1571, 2108, 2887, 3595, 4081, 4499, 4919, 5283, 5611, 5878, 5897, 5613, 5301, 5232, 5347, 5390, 5199, 4815, 4480, 4459, 4800, 5253, 5564, 5786, 6165, 6773, 7379, 7756, 7970, 8244, 8614, 8893, 8973, 8946, 8913, 8792, 8482, 8081, 7808, 7758, 7873, 8114, 8502, 8986, 9419, 9729, 10010, 10372, 10744, 10948, 10891, 10648, 10378, 10215, 10177, 10134, 9961, 9697, 9465, 9272, 9110, 9057, 9065, 8929, 8673, 8572, 8675, 8700, 8609, 8669, 8906, 9023, 8910, 8721, 8485, 8096, 7635, 7259, 6896, 6367, 5746, 5314, 5114, 4915, 4634, 4438, 4341, 4147, 3888, 3786, 3703, 3275, 2620, 2218, 2091, 1834, 1395, 1098, 999, 834, 516, 206, -41, -350, -814, -1406, -2067, -2745, -3385, -3943, -4417, -4828, -5148, -5325, -5373, -5367, -5371, -5424, -5591, -5899, -6282, -6648, -6986, -7313, -7652, -8035, -8414, -8677, -8829, -9064, -9477, -9852, -9969, -10000, -10264, -10715, -10963, -10861, -10742, -10886, -11095, -10994, -10647, -10456, -10583, -10788, -10878, -10973, -11203, -11432, -11503, -11549, -11775, -12075, -12179, -12035, -11828, -11663, -11483, -11248, -11006, -10813, -10661, -10545, -10508, -10615, -10841, -11054, -11119, -11039, -10953, -10972, -11049, -11039, -10881, -10635, -10375, -10141, -9999, -9937, -9733, -9226, -8631, -8311, -8267, -8171, -7888, -7607, -7453, -7327, -7262, -7523, -8063, -8313, -7985, -7595, -7626, -7689, -7234, -6542, -6191, -6042, -5591, -4920, -4533, -4542, -4559, -4306, -3957, -3900, -4222, -4534, -4480, -4252, -4220, -4266, -4047, -3704, -3626, -3692, -3449, -2933, -2636, -2735, -2921, -2929, -2821, -2752, -2746, -2699, -2567, -2476, -2533, -2544, -2286, -1997, -2063, -2306, -2274, -2110, -2279, -2630, -2632, -2316, -2155, -2271, -2438, -2533, -2482, -2216, -1928, -1892, -1999, -2003, -2014, -2157, -2150, -1806, -1562, -1868, -2433, -2630, -2362, -2069, -2047, -2136, -2064, -1862, -1798, -1918, -1935, -1702, -1515, -1626, -1802, -1709, -1476, -1393, -1370, -1150, -851, -802, -1010, -1178, -1153, -1054, -997, -956, -910, -895, -859, -660, -302, -25, -1, -58, 75, 356, 481, 355, 214, 235, 283, 216, 190, 413, 763, 927, 940, 1174, 1744, 2291, 2522, 2621, 2863, 3147, 3209, 3028, 2773, 2523, 2258, 2009, 1824, 1697, 1630, 1709, 1986, 2350, 2674, 3016, 3498, 4020, 4312, 4250, 3957, 3663, 3558, 3649, 3700, 3472, 3081, 2892, 3020, 3187, 3198, 3262, 3541, 3734, 3552, 3351, 3620, 4041, 3873, 3187, 2858, 3236, 3654, 3533, 3221, 3219, 3285, 2986, 2624, 2712, 2973, 2812, 2433, 2463, 2787, 2799, 2567, 2718, 3263, 3497, 3140, 2756, 2781, 2863, 2557, 2115, 1985, 2018, 1762, 1273, 1027, 1235, 1680, 2099, 2354, 2367, 2229, 2273, 2735, 3355, 3655, 3556, 3383, 3277, 3003, 2490, 2080, 1936, 1661, 1041, 701, 1234, 2043, 2107, 1624, 1675, 2388, 2812, 2663, 2788, 3595, 4226, 3823, 2834, 2369, 2718, 3111, 2896, 2340, 2021, 1959, 1852, 1817, 2242, 3002, 3512, 3637, 3928, 4742, 5637, 5948, 5592, 5023, 4596, 4306, 4038, 3742, 3405, 3086, 3004, 3356, 4032, 4672, 5043, 5206, 5324, 5464, 5539, 5410, 5067, 4714, 4520, 4359, 3957, 3275, 2568, 2112, 1978, 2022, 2009, 1814, 1611, 1722, 2205, 2719, 2949, 3059, 3523, 4450, 5237, 5154, 4374, 3844, 3933, 3888, 3138, 2238, 1819, 1559, 1069, 876, 1513, 2443, 2847, 2889, 3300, 4169, 4867, 5000, 4825, 4714, 4686, 4641, 4713, 5053, 5454, 5532, 5307, 5149, 5183, 5231, 5338, 5669, 5878, 5491, 4899, 5018, 5872, 6567, 6729, 6909, 7494, 8164, 8607, 8968, 9401, 9679, 9519, 9065, 8776, 8823, 8815, 8398, 7897, 7969, 8658, 9357, 9685, 9886, 10177, 10352, 10238, 10136, 10395, 10816, 10895, 10538, 10228, 10400, 10896, 11204, 11074, 10695, 10292, 9864, 9378, 8986, 8839, 8804, 8612, 8256, 8101, 8515, 9395, 10101, 10058, 9435, 8922, 8846, 8829, 8448, 7766, 7087, 6535, 6111, 5817, 5607, 5400, 5205, 5067, 4898, 4547, 4055, 3639, 3397, 3199, 2948, 2748, 2672, 2603, 2461, 2336, 2248, 2009, 1510, 857, 127, -760, -1773, -2650, -3202, -3513, -3733, -3826, -3736, -3590, -3535, -3501, -3401, -3462, -3985, -4803, -5391, -5635, -6047, -6933, -7766, -7903, -7600, -7683, -8325, -8872, -8851, -8588, -8610, -8971, -9391, -9665, -9762, -9665, -9436, -9295, -9436, -9757, -9978, -10045, -10194, -10572, -10981, -11183, -11238, -11356, -11532, -11608, -11532, -11360, -11160, -11090, -11285, -11556, -11525, -11184, -10964, -11134, -11479, -11639, -11426, -10892, -10379, -10291, -10613, -10870, -10786, -10632, -10754, -11109, -11389, -11390, -11158, -10891, -10671, -10320, -9761, -9294, -9103, -8841, -8267, -7874, -8102, -8486, -8408, -8148, -8311, -8734, -8763, -8273, -7750, -7608, -7797, -7930, -7735, -7389, -7307, -7502, -7578, -7360, -6998, -6535, -5939, -5384, -4947, -4390, -3790, -3777, -4547, -5397, -5754, -5893, -6156, -6341, -6303, -6316, -6392, -5939, -4640, -3191, -2612, -2987, -3374, -3095, -2670, -3018, -4010, -4620, -4490, -4364, -4692, -4851, -4307, -3567, -3353, -3530, -3516, -3169, -2818, -2740, -2953, -3324, -3707, -3977, -4007, -3667, -3026, -2502, -2525, -2957, -3120, -2668, -2185, -2452, -3278, -3725, -3469, -3149, -3249, -3410, -3196, -2860, -2824, -2887, -2583, -2036, -1830, -2103, -2367, -2279, -2047, -1901, -1701, -1407, -1409, -1919, -2394, -2224, -1702, -1610, -1982, -2164, -1913, -1586, -1324, -899, -347, -13, 29, 78, 339, 694, 868, 678, 229, -130, -180, -64, -33, -131, -220, -161, 132, 642, 1220, 1738, 2194, 2545, 2653, 2567, 2608, 2919, 3187, 3028, 2459, 1827, 1467, 1515, 1848, 2181, 2326, 2361, 2485, 2854, 3474, 4055, 4151, 3734, 3366, 3412, 3523, 3273, 2846, 2627, 2610, 2641, 2798, 3141, 3473, 3646, 3794, 3960, 3830, 3270, 2797, 2888, 3148, 2919, 2412, 2280, 2457, 2498, 2581, 3051, 3443, 3119, 2418, 2156, 2379, 2467, 2213, 1996, 2030, 2097, 2077, 2208, 2577, 2775, 2419, 1767, 1397, 1426, 1458, 1258, 1055, 1106, 1325, 1509, 1696, 2055, 2531, 2819, 2650, 2011, 1169, 522, 292, 292, 120, -302, -522, -84, 845, 1635, 1989, 2269, 2899, 3674, 3897, 3162, 1858, 815, 430, 313, -32, -489, -595, -251, 291, 917, 1618, 2224, 2564, 2674, 2624, 2447, 2275, 2161, 1915, 1506, 1304, 1503, 1763, 1851, 2037, 2414, 2467, 1907, 1371, 1607, 2330, 2610, 2256, 2025, 2427, 3145, 3767, 4274, 4589, 4477, 4131, 4104, 4342, 4078, 3070, 2230, 2348, 2849, 2708, 2124, 2151, 2952, 3653, 3821, 3922, 4284, 4645, 4728, 4601, 4429, 4337, 4366, 4364, 4102, 3602, 3097, 2647, 2041, 1139, 125, -662, -1059, -1181, -1133, -728, 291, 1761, 3148, 4248, 5451, 7030, 8447, 8728, 7461, 5229, 3076, 1577, 419, -1013, -2650, -3623, -3242, -1779, -50, 1489, 2949, 4517, 6091, 7338, 7923, 7703, 6838, 5773, 4988, 4647, 4472, 4153, 3837, 3978, 4588, 5077, 5026, 4723, 4640, 4817, 5045, 5266, 5511, 5790, 6273, 7220, 8558, 9794, 10546, 10903, 11135, 11221, 10894, 10054, 8943, 7953, 7386, 7360, 7720, 8131, 8412, 8789, 9599, 10693, 11437, 11424, 10963, 10639, 10618, 10675, 10707, 10880, 11302, 11867, 12369, 12660, 12745, 12712, 12418, 11461, 9779, 8027, 6989, 6768, 6877, 6895, 6850, 7179, 8343, 10205, 11836, 12377, 11897, 11061, 10246, 9382, 8348, 7106, 5767, 4666, 4126, 4069, 4163, 4287, 4493, 4647, 4528, 4180, 3879, 3725, 3552, 3177, 2631, 2159, 2014, 2248, 2609, 2671, 2170, 1252, 305, -462, -1167, -1983, -2903, -3728, -4215, -4229, -3894, -3474, -3102, -2780, -2615, -2751, -3136, -3629, -4264, -5094, -5941, -6601, -7110, -7521, -7689, -7531, -7316, -7394, -7770, -8176, -8469, -8752, -9108, -9448, -9655, -9736, -9725, -9612, -9420, -9236, -9106, -9032, -9079, -9335, -9818, -10440, -11050, -11465, -11594, -11558, -11559, -11636, -11689, -11683, -11670, -11666, -11654, -11661, -11716, -11783, -11786, -11656, -11375, -11022, -10781, -10772, -10905, -11040, -11153, -11309, -11559, -11920, -12328, -12635, -12690, -12489, -12109, -11595, -10981, -10367, -9858, -9513, -9351, -9303, -9238, -9144, -9220, -9537, -9863, -9934, -9805, -9691, -9628, -9518, -9367, -9270, -9209, -9070, -8853, -8631, -8327, -7787, -7101, -6548, -6176, -5747, -5207, -4864, -4994, -5519, -6180, -6805, -7321, -7708, -8053, -8413, -8508, -7846, -6416, -4945, -4099, -3704, -3226, -2682, -2566, -3015, -3616, -4102, -4638, -5338, -5909, -6057, -5871, -5555, -5135, -4671, -4402, -4337, -4116, -3670, -3594, -4331, -5233, -5136, -3878, -2557, -2095, -2269, -2398, -2302, -2170, -2129, -2339, -3051, -4176, -5124, -5363, -4956, -4400, -4067, -3875, -3437, -2508, -1329, -495, -426, -976, -1597, -1927, -2075, -2268, -2385, -2135, -1635, -1377, -1469, -1393, -861, -429, -751, -1587, -2121, -2057, -1807, -1690, -1501, -954, -130, 747, 1630, 2476, 2977, 2795, 2050, 1255, 750, 401, -43, -555, -900, -885, -392, 570, 1733, 2694, 3297, 3645, 3758, 3593, 3376, 3422, 3601, 3452, 2922, 2578, 2913, 3699, 4241, 4155, 3721, 3473, 3590, 3777, 3671, 3247, 2829, 2769, 3157, 3803, 4437, 4909, 5221, 5454, 5640, 5656, 5338, 4721, 4074, 3653, 3484, 3442, 3411, 3360, 3340, 3455, 3735, 4043, 4191, 4117, 3877, 3548, 3212, 3000, 3036, 3290, 3584, 3754, 3810, 3880, 3972, 3914, 3560, 3007, 2463, 1956, 1364, 712, 260, 252, 669, 1241, 1685, 1969, 2304, 2801, 3163, 2956, 2160, 1247, 665, 398, 155, -195, -515, -606, -398, 73, 680, 1211, 1473, 1401, 1022, 410, -262, -731, -867, -840, -863, -853, -550, 8, 464, 670, 851, 1075, 1028, 554, -43, -474, -829, -1231, -1521, -1442, -916, -98, 639, 926, 834, 942, 1575, 2137, 1688, 263, -919, -899, -147, 185, -196, -517, -72, 982, 1944, 2284, 1983, 1399, 899, 641, 614, 694, 703, 647, 834, 1412, 2015, 2332, 2665, 3334, 3899, 3714, 2862, 1949, 1370, 1191, 1309, 1378, 1128, 904, 1333, 2405, 3421, 3877, 3904, 3792, 3581, 3230, 2843, 2526, 2189, 1745, 1366, 1323, 1610, 1964, 2195, 2274, 2143, 1680, 871, -74, -804, -1107, -1134, -1172, -1170, -679, 639, 2649, 4872, 6668, 7479, 7318, 6785, 6186, 5049, 2997, 593, -1241, -2161, -2340, -1969, -1179, -22, 1654, 3948, 6435, 8331, 9170, 9089, 8475, 7640, 6846, 6307, 5950, 5510, 5092, 5212, 6065, 7177, 8063, 8600, 8646, 8165, 7721, 7945, 8470, 8399, 7818, 7793, 8832, 10273, 11427, 12418, 13454, 14080, 13866, 13230, 12822, 12479, 11691, 10647, 10016, 9987, 10306, 10798, 11388, 11958, 12478, 12941, 13151, 12974, 12655, 12470, 12353, 12203, 12203, 12541, 13069, 13509, 13762, 13797, 13456, 12629, 11507, 10360, 9163, 7848, 6738, 6236, 6265, 6555, 7268, 8599, 10091, 11031, 11269, 11066, 10541, 9681, 8524, 7079, 5445, 4046, 3271, 2942, 2579, 2178, 2157, 2616, 3075, 3075, 2647, 2037, 1360, 747, 464, 486, 384, -13, -309, -197, -8, -216, -894, -1848, -2911, -3927, -4762, -5422, -5950, -6289, -6396, -6343, -6176, -5804, -5268, -4945, -5247, -6083, -6901, -7322, -7518, -7838, -8367, -8941, -9362, -9472, -9241, -8926, -8903, -9303, -9894, -10368, -10617, -10732, -10834, -10960, -11038, -10957, -10660, -10233, -9850, -9679, -9761, -10032, -10384, -10722, -11014, -11292, -11588, -11849, -11969, -11910, -11748, -11577, -11426, -11292, -11217, -11207, -11158, -10988, -10769, -10622, -10506, -10296, -10006, -9792, -9775, -9913, -10121, -10333, -10497, -10591, -10688, -10888, -11133, -11145, -10676, -9813, -8944, -8389, -8129, -7930, -7629, -7284, -7085, -7224, -7710, -8254, -8459, -8231, -7894, -7799, -7956, -8070, -7873, -7360, -6773, -6388, -6288, -6314, -6245, -5973, -5527, -5006, -4560, -4369, -4466, -4613, -4565, -4473, -4764, -5508, -6244, -6531, -6363, -5992, -5594, -5222, -4786, -4140, -3324, -2684, -2502, -2717, -3096, -3545, -4049, -4526, -4911, -5280, -5668, -5838, -5525, -4875, -4365, -4227, -4215, -4071, -3914, -4014, -4388, -4761, -4834, -4511, -3997, -3638, -3597, -3667, -3524, -3168, -3003, -3409, -4267, -5030, -5288, -5171, -5065, -5105, -5144, -5036, -4627, -3733, -2536, -1740, -1844, -2467, -2823, -2691, -2495, -2636, -3094, -3551, -3679, -3368, -2850, -2492, -2435, -2477, -2391, -2206, -2033, -1838, -1619, -1556, -1634, -1413, -640, 238, 690, 807, 981, 1264, 1436, 1336, 882, 141, -482, -561, -208, 57, 50, 160, 789, 1841, 2930, 3809, 4378, 4529, 4348, 4228, 4421, 4611, 4326, 3630, 3079, 3046, 3371, 3687, 3828, 3873, 3971, 4196, 4541, 4909, 5163, 5219, 5132, 5054, 5154, 5489, 5908, 6094, 5876, 5477, 5312, 5485, 5626, 5366, 4814, 4399, 4279, 4178, 3863, 3511, 3487, 3838, 4193, 4234, 4064, 4046, 4342, 4675, 4610, 4084, 3561, 3465, 3534, 3191, 2484, 2054, 2137, 2258, 2065, 1775, 1675, 1729, 1814, 1871, 1805, 1538, 1201, 1012, 992, 982, 866, 636, 287, -136, -394, -263, 77, 169, -118, -457, -585, -545, -398, -104, 235, 359, 181, -131, -380, -500, -495, -436, -513, -854, -1248, -1319, -1037, -798, -838, -929, -812, -606, -507, -404, -110, 244, 376, 322, 362, 514, 516, 305, 32, -311, -746, -985, -881, -825, -993, -830, -10, 812, 988, 834, 945, 1279, 1464, 1372, 1030, 493, 0, -167, -85, -48, 19, 509, 1277, 1521, 980, 538, 918, 1521, 1408, 720, 239, 234, 504, 925, 1362, 1602, 1754, 2165, 2711, 2786, 2246, 1780, 1896, 2085, 1626, 833, 612, 1071, 1496, 1524, 1445, 1529, 1756, 1997, 1985, 1545, 1035, 991, 1299, 1396, 1170, 1003, 1117, 1448, 1846, 1968, 1412, 325, -566, -869, -1003, -1525, -2295, -2605, -1928, -305, 1890, 4216, 6208, 7478, 7923, 7712, 7061, 6100, 4785, 2898, 461, -1778, -2750, -2150, -684, 933, 2734, 5028, 7635, 9903, 11278, 11617, 11078, 10012, 8858, 7883, 7092, 6564, 6554, 7029, 7560, 8032, 8886, 10179, 11113, 11076, 10548, 10408, 10731, 10934, 10814, 10829, 11407, 12481, 13752, 14840, 15242, 14854, 14335, 14186, 13885, 12855, 11683, 11219, 11253, 11254, 11520, 12465, 13606, 14244, 14381, 14358, 14190, 13742, 13029, 12156, 11288, 10702, 10559, 10760, 11134, 11604, 12060, 12234, 11915, 11152, 10138, 8907, 7445, 6025, 5047, 4568, 4384, 4537, 5269, 6452, 7564, 8175, 8165, 7573, 6578, 5419, 4166, 2724, 1145, -359, -1625, -2455, -2551, -1963, -1270, -998, -1122, -1346, -1473, -1441, -1436, -1896, -2918, -3888, -4231, -4186, -4357, -4894, -5540, -6154, -6736, -7266, -7791, -8467, -9290, -9979, -10244, -10026, -9468, -8756, -8103, -7741, -7738, -7899, -8073, -8406, -9120, -10118, -11080, -11784, -12175, -12259, -12096, -11794, -11404, -10938, -10472, -10093, -9821, -9712, -9864, -10213, -10470, -10442, -10249, -10121, -10103, -10070, -9923, -9692, -9479, -9399, -9503, -9731, -9910, -9911, -9767, -9552, -9264, -8927, -8681, -8599, -8541, -8352, -8064, -7812, -7726, -7865, -8081, -8005, -7472, -6836, -6570, -6687, -6797, -6671, -6434, -6286, -6307, -6531, -6955, -7360, -7368, -6863, -6157, -5593, -5185, -4791, -4378, -3995, -3664, -3460, -3513, -3839, -4283, -4660, -4882, -4986, -5071, -5193, -5269, -5121, -4692, -4134, -3679, -3423, -3312, -3267, -3247, -3203, -3104, -3021, -3073, -3265, -3485, -3653, -3751, -3816, -3938, -4201, -4540, -4715, -4594, -4341, -4198, -4110, -3829, -3366, -3050, -3040, -3141, -3243, -3548, -4150, -4749, -5055, -5160, -5335, -5650, -5909, -5853, -5411, -4829, -4470, -4471, -4691, -4952, -5146, -5154, -4965, -4829, -5053, -5549, -5830, -5560, -4983, -4692, -4980, -5570, -5929, -5769, -5243, -4772, -4730, -5141, -5665, -5868, -5535, -4800, -4098, -3835, -4005, -4207, -4167, -3996, -3820, -3541, -3159, -2987, -3217, -3518, -3405, -2876, -2388, -2205, -2146, -1962, -1675, -1408, -1172, -970, -856, -779, -582, -207, 270, 774, 1211, 1462, 1550, 1711, 2085, 2480, 2584, 2337, 1992, 1852, 2032, 2422, 2832, 3145, 3416, 3803, 4359, 4935, 5351, 5571, 5650, 5608, 5520, 5560, 5772, 5911, 5725, 5298, 4997, 5110, 5593, 6101, 6281, 6089, 5842, 5906, 6330, 6822, 7015, 6791, 6350, 6011, 5874, 5795, 5659, 5541, 5506, 5437, 5231, 5028, 5071, 5332, 5453, 5118, 4461, 4001, 4061, 4341, 4277, 3785, 3329, 3247, 3331, 3235, 2985, 2831, 2781, 2586, 2141, 1684, 1489, 1507, 1463, 1232, 995, 991, 1204, 1374, 1308, 1121, 1046, 1074, 927, 447, -155, -540, -586, -497, -565, -872, -1170, -1107, -617, -57, 136, -98, -426, -541, -501, -584, -911, -1331, -1613, -1658, -1527, -1332, -1127, -888, -598, -292, -4, 300, 653, 934, 914, 569, 226, 192, 377, 517, 588, 685, 718, 618, 568, 694, 839, 907, 1023, 1181, 1212, 1146, 1115, 1066, 1010, 1212, 1653, 1813, 1456, 1081, 1149, 1460, 1646, 1749, 1940, 2108, 2073, 1946, 1967, 2101, 2117, 1969, 1847, 1826, 1755, 1533, 1245, 1061, 1113, 1366, 1567, 1550, 1607, 2134, 2912, 3213, 2775, 2176, 2012, 2099, 1893, 1360, 943, 771, 503, 68, 10, 766, 1961, 2744, 2708, 2284, 2220, 2722, 3233, 3126, 2441, 1715, 1279, 1073, 1005, 1089, 1235, 1244, 1048, 820, 800, 1064, 1408, 1447, 990, 363, 186, 679, 1268, 1170, 304, -605, -915, -768, -777, -1255, -1906, -2152, -1688, -700, 540, 2113, 4103, 6039, 7307, 7929, 8252, 8088, 6924, 4842, 2538, 670, -461, -937, -1179, -1309, -628, 1589, 4876, 7956, 10141, 11612, 12564, 12904, 12655, 12019, 11033, 9647, 8169, 7222, 7087, 7433, 7844, 8279, 8825, 9431, 10102, 10936, 11764, 12275, 12440, 12450, 12453, 12741, 13615, 14671, 15035, 14639, 14283, 14193, 13731, 12650, 11493, 10603, 9854, 9367, 9542, 10319, 11164, 11763, 12232, 12706, 13046, 12992, 12500, 11799, 11044, 10094, 8922, 8027, 7875, 8147, 8205, 8066, 8137, 8236, 7725, 6531, 5247, 4249, 3342, 2289, 1229, 503, 354, 792, 1582, 2332, 2769, 2940, 2993, 2808, 2105, 891, -539, -2017, -3495, -4783, -5722, -6419, -6934, -7063, -6796, -6538, -6526, -6520, -6341, -6218, -6342, -6550, -6644, -6740, -7021, -7434, -7798, -8072, -8390, -8879, -9630, -10686, -11828, -12622, -12871, -12810, -12638, -12229, -11509, -10676, -9876, -9055, -8320, -7987, -8156, -8620, -9236, -10031, -10916, -11582, -11827, -11776, -11654, -11465, -11016, -10248, -9350, -8619, -8220, -8110, -8095, -7968, -7685, -7375, -7160, -7013, -6852, -6719, -6688, -6675, -6526, -6309, -6245, -6349, -6376, -6195, -5932, -5705, -5434, -5060, -4710, -4510, -4380, -4224, -4154, -4260, -4340, -4176, -3880, -3642, -3379, -3018, -2776, -2798, -2876, -2854, -2925, -3229, -3583, -3831, -4080, -4394, -4578, -4418, -3956, -3421, -2996, -2664, -2290, -1875, -1646, -1793, -2222, -2680, -3074, -3527, -4076, -4514, -4664, -4645, -4708, -4835, -4767, -4404, -3982, -3774, -3785, -3811, -3728, -3600, -3566, -3696, -3927, -4126, -4248, -4462, -4968, -5624, -6037, -6068, -6009, -6112, -6229, -6091, -5687, -5241, -4981, -4956, -4986, -4904, -4854, -5142, -5752, -6318, -6612, -6700, -6661, -6494, -6278, -6083, -5900, -5773, -5771, -5748, -5537, -5357, -5541, -5928, -6089, -5977, -5830, -5636, -5258, -4792, -4436, -4228, -4147, -4181, -4221, -4198, -4274, -4553, -4779, -4681, -4369, -4090, -3826, -3415, -2846, -2251, -1738, -1330, -995, -792, -943, -1498, -1960, -1724, -919, -279, -159, -185, 64, 549, 981, 1194, 1258, 1345, 1436, 1256, 802, 705, 1542, 2909, 3798, 3914, 4014, 4742, 5661, 5866, 5188, 4253, 3601, 3311, 3318, 3469, 3469, 3301, 3382, 3951, 4761, 5586, 6422, 7006, 6954, 6447, 6081, 6023, 5973, 5800, 5627, 5482, 5314, 5228, 5322, 5470, 5477, 5347, 5215, 5117, 4984, 4789, 4559, 4303, 4128, 4288, 4807, 5244, 5256, 5141, 5346, 5681, 5548, 4794, 3854, 3169, 2792, 2519, 2162, 1739, 1456, 1488, 1813, 2290, 2773, 3084, 3019, 2600, 2186, 2126, 2273, 2097, 1381, 600, 368, 683, 975, 850, 494, 308, 403, 573, 623, 516, 269, -110, -469, -512, -177, 150, 97, -187, -278, -44, 316, 625, 724, 443, -82, -368, -180, 92, -41, -526, -889, -820, -409, 56, 386, 570, 684, 738, 638, 345, 50, 0, 116, 72, -137, -31, 656, 1499, 1933, 2004, 2164, 2492, 2591, 2231, 1713, 1397, 1201, 850, 455, 504, 1214, 2157, 2657, 2552, 2415, 2866, 3706, 4079, 3545, 2635, 2150, 2221, 2377, 2270, 1979, 1672, 1397, 1295, 1613, 2305, 2857, 2827, 2403, 2218, 2676, 3530, 4044, 3667, 2722, 2123, 2286, 2683, 2694, 2336, 1911, 1538, 1278, 1211, 1231, 1166, 1102, 1213, 1428, 1631, 1927, 2364, 2659, 2572, 2333, 2361, 2646, 2654, 1935, 732, -156, -210, 255, 596, 619, 533, 458, 469, 800, 1437, 1839, 1582, 939, 436, 298, 508, 903, 1080, 828, 553, 747, 1241, 1499, 1291, 680, -172, -863, -1005, -830, -953, -1450, -1731, -1424, -863, -617, -862, -1302, -1528, -1409, -1270, -1634, -2660, -3793, -4075, -2925, -612, 2027, 4242, 5758, 6761, 7630, 8625, 9574, 9802, 8597, 5914, 2624, -45, -1302, -1235, -661, -264, 421, 2662, 6652, 10678, 12965, 13588, 13772, 14080, 14182, 13751, 12836, 11729, 10816, 10262, 9947, 9942, 10525, 11420, 11810, 11518, 11274, 11463, 11489, 10936, 10461, 10893, 12043, 13171, 14145, 15220, 16009, 15892, 15208, 14736, 14201, 12722, 10582, 8979, 8242, 7637, 6859, 6494, 7007, 8082, 8977, 9186, 8852, 8441, 7994, 7093, 5781, 4793, 4532, 4442, 3933, 3280, 3082, 3201, 2973, 2235, 1376, 408, -1085, -2958, -4460, -5397, -6289, -7155, -7254, -6365, -5313, -4854, -4835, -4764, -4595, -4655, -5152, -6039, -7177, -8422, -9600, -10589, -11331, -11770, -11925, -12061, -12412, -12726, -12608, -12280, -12358, -12862, -13168, -12900, -12246, -11497, -10830, -10427, -10340, -10345, -10225, -10091, -10211, -10713, -11500, -12309, -12820, -12869, -12540, -12039, -11484, -10864, -10114, -9232, -8381, -7843, -7781, -7963, -7877, -7289, -6569, -6256, -6333, -6262, -5716, -4923, -4303, -4083, -4249, -4586, -4840, -4933, -4883, -4575, -3963, -3367, -3064, -2717, -1797, -464, 549, 804, 527, 211, 173, 333, 319, -53, -458, -531, -459, -674, -1116, -1280, -965, -597, -696, -1211, -1523, -1144, -318, 249, 252, 52, 42, 118, -18, -387, -846, -1438, -2289, -3266, -3997, -4271, -4256, -4274, -4412, -4505, -4425, -4246, -4162, -4282, -4565, -4910, -5235, -5463, -5499, -5454, -5692, -6301, -6749, -6572, -6195, -6363, -7055, -7653, -7911, -8052, -8170, -8232, -8374, -8658, -8810, -8583, -8148, -7872, -7921, -8179, -8390, -8404, -8322, -8266, -8108, -7769, -7506, -7448, -7220, -6613, -6155, -6315, -6734, -6893, -6917, -7121, -7454, -7758, -7923, -7649, -6763, -5701, -4984, -4545, -4101, -3651, -3211, -2703, -2401, -2736, -3461, -3779, -3362, -2618, -2000, -1643, -1602, -1819, -1852, -1242, -304, 35, -472, -901, -389, 676, 1372, 1546, 1726, 2263, 3096, 3955, 4482, 4477, 4056, 3354, 2472, 1933, 2382, 3404, 3697, 2946, 2512, 3605, 5640, 7051, 7146, 6577, 6266, 6390, 6422, 5918, 5001, 4079, 3461, 3419, 4179, 5457, 6396, 6448, 6145, 6422, 7310, 7811, 7142, 5709, 4601, 4297, 4205, 3633, 2864, 2782, 3566, 4385, 4550, 4271, 4063, 3956, 3681, 3241, 2933, 2953, 3124, 3098, 2853, 2836, 3313, 3804, 3664, 3006, 2432, 2054, 1463, 547, -331, -864, -1073, -1062, -809, -228, 625, 1414, 1754, 1730, 1828, 2161, 2177, 1461, 440, -160, -296, -539, -1082, -1438, -1208, -649, -172, 206, 559, 637, 251, -291, -538, -464, -415, -585, -718, -368, 516, 1373, 1687, 1716, 2086, 2747, 2955, 2343, 1412, 820, 647, 541, 317, 196, 482, 1114, 1693, 2026, 2389, 2998, 3490, 3347, 2693, 2218, 2306, 2581, 2490, 2062, 1847, 2193, 2842, 3344, 3627, 3855, 3930, 3592, 2993, 2654, 2714, 2678, 2191, 1628, 1596, 2073, 2454, 2401, 2302, 2684, 3366, 3592, 3059, 2372, 2217, 2440, 2383, 1927, 1630, 1834, 2156, 2153, 1999, 2065, 2152, 1748, 888, 175, -55, -82, -281, -652, -894, -744, -239, 306, 617, 713, 756, 736, 520, 105, -366, -787, -1157, -1490, -1738, -1830, -1754, -1608, -1489, -1333, -1014, -638, -539, -827, -1168, -1148, -779, -490, -666, -1231, -1683, -1568, -969, -392, -192, -230, -161, 180, 645, 879, 659, 255, 209, 616, 986, 984, 793, 666, 658, 828, 1136, 1262, 1058, 899, 1085, 1409, 1708, 2180, 2776, 3067, 2977, 2936, 3141, 3303, 3137, 2581, 1764, 1127, 1196, 1878, 2397, 2214, 1686, 1581, 2193, 3106, 3639, 3409, 2641, 1979, 1793, 1599, 510, -1478, -3149, -3449, -2784, -2312, -2303, -1897, -180, 2929, 6698, 10123, 12590, 14168, 15151, 15416, 14502, 12340, 9411, 6093, 2400, -1176, -3365, -3496, -2556, -1725, -516, 2375, 6847, 11360, 14701, 16761, 17893, 18415, 18556, 18270, 17264, 15388, 12963, 10788, 9712, 9651, 9305, 7677, 5643, 4907, 5671, 6633, 7107, 7721, 8871, 9963, 10782, 12194, 14486, 16112, 15597, 13795, 12575, 11883, 10102, 7013, 4315, 3060, 2398, 1383, 561, 958, 2272, 3071, 2737, 2260, 2574, 2901, 1965, 226, -658, -452, -577, -1611, -2324, -1840, -1134, -1457, -2511, -3259, -3790, -5088, -7212, -9011, -9795, -10248, -11158, -12122, -12242, -11544, -10906, -10783, -10718, -10225, -9572, -9334, -9503, -9556, -9291, -9079, -9208, -9457, -9586, -9813, -10454, -11365, -12142, -12738, -13457, -14296, -14792, -14591, -13870, -12927, -11771, -10398, -9039, -7890, -6853, -5836, -5036, -4735, -4967, -5489, -5969, -6204, -6250, -6252, -6225, -6132, -6071, -6163, -6251, -6055, -5623, -5316, -5268, -5089, -4321, -3001, -1575, -354, 672, 1576, 2319, 2833, 3047, 2847, 2215, 1334, 449, -353, -1053, -1519, -1537, -1076, -407, 105, 325, 444, 676, 979, 1193, 1320, 1416, 1398, 1220, 1096, 1244, 1513, 1558, 1257, 709, -8, -851, -1736, -2586, -3375, -4086, -4708, -5175, -5316, -5021, -4522, -4286, -4491, -4830, -4965, -4962, -5093, -5390, -5658, -5858, -6200, -6725, -7115, -7093, -6901, -7117, -7976, -9131, -10083, -10705, -11187, -11632, -11922, -11963, -11807, -11470, -10787, -9699, -8540, -7789, -7549, -7445, -7141, -6752, -6717, -7262, -8101, -8723, -8947, -9032, -9184, -9247, -9048, -8768, -8652, -8534, -8040, -7113, -6112, -5335, -4678, -3808, -2687, -1751, -1321, -1072, -501, 166, 249, -316, -876, -1067, -1169, -1406, -1584, -1530, -1312, -1017, -635, -129, 523, 1240, 1792, 2123, 2560, 3373, 4338, 5007, 5194, 5034, 4877, 5117, 5701, 5942, 5357, 4476, 4152, 4286, 4037, 3205, 2583, 2744, 3245, 3428, 3393, 3589, 3923, 4071, 4360, 5381, 6811, 7463, 6759, 5538, 5118, 5755, 6348, 5826, 4526, 3619, 3364, 3009, 2379, 2196, 2506, 2284, 1172, 303, 667, 1715, 2299, 2194, 1991, 2022, 2100, 2164, 2481, 3024, 3170, 2436, 1253, 526, 540, 704, 415, -208, -689, -999, -1493, -2046, -1998, -1284, -833, -1261, -1862, -1613, -572, 452, 1074, 1447, 1603, 1480, 1386, 1723, 2210, 2038, 1004, -78, -430, -213, -59, -170, -272, -98, 346, 801, 1080, 1434, 2182, 2988, 3262, 3211, 3513, 4059, 4214, 4111, 4433, 5067, 5236, 4812, 4443, 4481, 4602, 4423, 3968, 3512, 3264, 3227, 3289, 3436, 3745, 4183, 4579, 4904, 5347, 6010, 6638, 6839, 6527, 5995, 5543, 5226, 4980, 4692, 4171, 3381, 2714, 2604, 2888, 2967, 2636, 2289, 2256, 2333, 2175, 1808, 1527, 1431, 1313, 1041, 813, 858, 1018, 912, 472, 33, -180, -387, -883, -1573, -2152, -2599, -3137, -3688, -3833, -3460, -3044, -2986, -2994, -2558, -1826, -1501, -1891, -2482, -2671, -2590, -2875, -3664, -4328, -4350, -4040, -3954, -3990, -3657, -3032, -2731, -2924, -3063, -2741, -2316, -2336, -2709, -2855, -2503, -1979, -1651, -1495, -1306, -1071, -939, -976, -1153, -1481, -1991, -2529, -2731, -2387, -1768, -1328, -1015, -301, 992, 2264, 2845, 2792, 2672, 2771, 2852, 2594, 2035, 1512, 1290, 1374, 1690, 2258, 2987, 3498, 3493, 3220, 3202, 3515, 3676, 3377, 2955, 2880, 3081, 3235, 3450, 4071, 4952, 5570, 5775, 5807, 5789, 5700, 5521, 5072, 4236, 3483, 3358, 3505, 3213, 2692, 2681, 3168, 3581, 3732, 3682, 3421, 3221, 3435, 3662, 3199, 2359, 2111, 2523, 2767, 2474, 1983, 1423, 443, -1140, -2926, -4111, -4164, -3469, -2960, -2781, -1757, 1214, 5634, 9805, 12610, 14258, 15369, 15925, 15392, 13505, 10482, 6632, 2360, -1400, -3413, -3275, -2003, -951, -187, 1458, 4691, 8651, 12004, 14453, 16367, 17436, 17029, 15779, 15302, 16037, 16610, 15772, 13884, 12021, 10571, 9257, 7879, 6454, 4939, 3386, 2382, 2802, 4623, 6407, 6953, 7142, 8755, 11551, 13347, 13146, 12160, 11363, 10187, 8191, 6166, 4824, 3865, 2856, 1988, 1499, 1069, 170, -1203, -2410, -2979, -3401, -4461, -5911, -6744, -6777, -6705, -6456, -5161, -3080, -1925, -2502, -3440, -3207, -2381, -2758, -4833, -7242, -8687, -9352, -10106, -11126, -11937, -12401, -12905, -13657, -14341, -14589, -14395, -13957, -13349, -12558, -11644, -10601, -9208, -7367, -5550, -4510, -4435, -4843, -5349, -6123, -7342, -8682, -9703, -10375, -10910, -11268, -11174, -10554, -9655, -8695, -7660, -6510, -5402, -4515, -3742, -2792, -1602, -444, 436, 1056, 1516, 1819, 1922, 1797, 1366, 564, -439, -1288, -1735, -1767, -1516, -1158, -782, -307, 388, 1212, 1950, 2507, 2835, 2823, 2529, 2321, 2453, 2694, 2696, 2503, 2437, 2615, 2798, 2647, 2029, 1084, 34, -1073, -2260, -3355, -4148, -4739, -5421, -6180, -6646, -6596, -6179, -5714, -5446, -5445, -5569, -5587, -5468, -5419, -5619, -6060, -6635, -7242, -7835, -8519, -9535, -10952, -12441, -13543, -14133, -14486, -14835, -15047, -14849, -14211, -13334, -12328, -11155, -9877, -8822, -8332, -8414, -8722, -8915, -8984, -9158, -9543, -9985, -10276, -10304, -9963, -9215, -8274, -7533, -7145, -6799, -6072, -4917, -3716, -2870, -2446, -2215, -1886, -1331, -662, -148, 30, -89, -337, -488, -253, 453, 1265, 1723, 1955, 2532, 3576, 4493, 4760, 4565, 4432, 4551, 4683, 4565, 4164, 3570, 2903, 2427, 2517, 3161, 3649, 3249, 2257, 1793, 2318, 2957, 2679, 1683, 1080, 1437, 2196, 2503, 2174, 1639, 1248, 962, 647, 359, 148, -154, -702, -1331, -1725, -1802, -1748, -1783, -1997, -2298, -2480, -2515, -2751, -3463, -4311, -4633, -4208, -3415, -2755, -2517, -2631, -2628, -2008, -843, 282, 806, 428, -735, -1895, -2134, -1647, -1597, -2357, -2943, -2630, -2020, -1917, -2095, -1797, -891, -8, 235, -52, -106, 591, 1667, 2446, 2842, 3170, 3441, 3492, 3548, 3924, 4315, 4061, 3119, 2250, 2126, 2609, 3102, 3335, 3573, 4152, 5078, 6086, 6862, 7242, 7305, 7323, 7485, 7669, 7576, 7140, 6686, 6628, 7042, 7635, 8056, 8169, 8029, 7766, 7553, 7541, 7648, 7515, 6860, 5925, 5338, 5452, 5903, 6084, 5872, 5669, 5783, 6057, 6200, 6176, 6072, 5812, 5285, 4675, 4309, 4168, 3906, 3378, 2843, 2512, 2223, 1701, 981, 390, 146, 98, -75, -450, -765, -797, -615, -385, -131, 131, 240, 66, -290, -643, -960, -1330, -1815, -2372, -2889, -3236, -3369, -3377, -3369, -3373, -3341, -3238, -3079, -2904, -2761, -2662, -2578, -2467, -2317, -2150, -1972, -1763, -1494, -1191, -961, -930, -1113, -1334, -1328, -1003, -580, -405, -573, -769, -599, -45, 511, 732, 661, 574, 641, 875, 1218, 1525, 1580, 1337, 1096, 1260, 1889, 2567, 2776, 2491, 2294, 2667, 3333, 3625, 3362, 2871, 2344, 1728, 1171, 921, 866, 662, 287, 62, 260, 846, 1484, 1814, 1883, 2145, 2757, 3239, 3161, 2740, 2401, 2153, 1751, 1101, 274, -550, -1076, -1126, -940, -930, -1123, -1088, -459, 591, 1444, 1577, 1074, 597, 733, 1264, 1273, 246, -1107, -1637, -1187, -645, -626, -870, -935, -736, -345, 130, 428, 317, -87, -493, -785, -1030, -1268, -1447, -1493, -1332, -913, -326, 169, 349, 238, -12, -284, -377, -108, 142, -397, -1717, -2742, -2858, -2897, -3881, -5569, -6893, -7192, -6592, -5667, -4847, -3759, -1368, 2760, 7757, 12332, 15833, 18187, 19503, 20027, 19827, 18310, 14799, 9847, 5366, 2888, 2041, 1322, 169, -268, 1419, 5162, 9527, 13154, 15565, 16812, 17282, 17798, 19056, 20672, 21555, 21343, 20673, 20036, 19273, 18294, 17329, 16355, 14890, 12606, 9845, 7475, 6145, 5523, 4794, 4068, 4312, 5486, 6232, 6019, 5883, 6351, 6414, 5426, 4251, 3758, 3690, 3616, 3685, 3907, 3807, 3152, 2398, 1970, 1479, -11, -2923, -6599, -9918, -12300, -13832, -14714, -15014, -14951, -14870, -14693, -13799, -11824, -9424, -7715, -6927, -6331, -5512, -4930, -4942, -5196, -5365, -5694, -6458, -7553, -8842, -10290, -11700, -12839, -13652, -14089, -14005, -13485, -12727, -11613, -9939, -7985, -6221, -4630, -2932, -1214, 195, 1200, 1849, 2184, 2392, 2737, 3176, 3376, 3170, 2674, 2022, 1284, 558, -62, -606, -1136, -1613, -1885, -1761, -1156, -236, 674, 1401, 2072, 2881, 3782, 4520, 4956, 5190, 5357, 5485, 5589, 5710, 5716, 5321, 4414, 3165, 1738, 161, -1517, -3224, -4954, -6628, -7946, -8678, -8893, -8719, -8104, -7057, -5867, -4890, -4227, -3785, -3518, -3456, -3584, -3897, -4479, -5391, -6477, -7485, -8384, -9330, -10377, -11429, -12449, -13457, -14379, -15054, -15410, -15472, -15265, -14784, -14083, -13250, -12322, -11336, -10442, -9793, -9288, -8764, -8342, -8194, -8115, -7819, -7494, -7438, -7455, -7210, -6869, -6773, -6869, -6954, -7056, -7230, -7387, -7483, -7458, -7087, -6287, -5351, -4505, -3568, -2376, -1116, 55, 1261, 2502, 3471, 3929, 4018, 4035, 4117, 4133, 3809, 3049, 2111, 1317, 656, -40, -706, -1145, -1326, -1313, -1059, -538, 119, 793, 1456, 2018, 2362, 2520, 2576, 2492, 2230, 1813, 1158, 194, -771, -1307, -1514, -1930, -2753, -3672, -4403, -4917, -5287, -5646, -6087, -6409, -6343, -6027, -5796, -5598, -5175, -4607, -4156, -3844, -3627, -3590, -3643, -3547, -3404, -3562, -3956, -4111, -3875, -3564, -3421, -3383, -3325, -3231, -3155, -3222, -3507, -3839, -3913, -3659, -3308, -3054, -2766, -2099, -894, 565, 1787, 2585, 3168, 3656, 3843, 3650, 3415, 3387, 3226, 2464, 1390, 906, 1371, 2155, 2592, 2772, 3027, 3314, 3627, 4283, 5266, 6022, 6317, 6567, 7014, 7420, 7774, 8442, 9354, 9778, 9295, 8406, 7861, 7716, 7479, 6919, 6332, 6005, 5845, 5722, 5779, 6176, 6693, 6933, 6805, 6553, 6346, 6097, 5708, 5255, 4865, 4593, 4404, 4245, 4189, 4446, 5001, 5398, 5260, 4834, 4568, 4389, 3880, 2979, 1991, 1075, 214, -459, -721, -601, -364, -137, 203, 716, 1220, 1529, 1699, 1852, 1912, 1707, 1299, 985, 949, 1063, 1094, 969, 790, 684, 692, 747, 718, 530, 270, 106, 128, 332, 688, 1116, 1505, 1824, 2132, 2419, 2543, 2443, 2252, 2106, 1923, 1544, 1030, 651, 571, 720, 970, 1266, 1579, 1911, 2339, 2846, 3171, 3053, 2606, 2211, 2061, 1975, 1755, 1451, 1214, 1085, 1077, 1275, 1630, 1823, 1602, 1167, 915, 875, 672, 121, -444, -628, -469, -278, -192, -151, -51, 234, 693, 1006, 920, 682, 651, 713, 615, 487, 503, 477, 288, 158, 185, 150, 0, -77, -142, -484, -1028, -1344, -1270, -1110, -1118, -1207, -1234, -1235, -1190, -924, -465, -218, -485, -960, -1090, -876, -810, -942, -811, -580, -1065, -2046, -2039, -714, 277, -94, -735, -621, -418, -804, -1151, -885, -544, -707, -1116, -1329, -1208, -523, 955, 2669, 3328, 2347, 800, 273, 895, 1253, 379, -1038, -1853, -2031, -2205, -2260, -1460, 105, 1257, 1239, 705, 720, 1320, 1722, 1471, 687, -421, -1472, -1775, -1213, -767, -1192, -1794, -1550, -772, -504, -827, -977, -767, -813, -1344, -1750, -1555, -1139, -1156, -1760, -2745, -3961, -5157, -5803, -5820, -6178, -7797, -9827, -10304, -8647, -6034, -3108, 658, 5030, 8786, 11785, 15013, 18319, 20350, 20532, 19278, 16781, 13389, 10267, 8226, 6830, 5513, 4511, 4219, 4730, 6149, 8354, 10583, 12082, 13011, 14026, 15272, 16360, 17141, 17884, 18727, 19363, 19497, 19260, 18918, 18500, 17852, 16757, 15023, 12861, 10972, 9698, 8507, 6908, 5351, 4453, 3977, 3363, 2578, 1842, 1123, 362, -284, -715, -937, -884, -570, -201, 173, 754, 1540, 2184, 2412, 2169, 1367, -33, -1830, -3791, -5850, -7873, -9674, -11329, -12975, -14271, -14702, -14390, -13913, -13331, -12112, -10170, -8240, -6883, -5730, -4267, -2854, -2149, -2002, -1783, -1522, -1811, -2777, -3910, -4752, -5194, -5364, -5562, -5980, -6379, -6409, -6116, -5732, -5181, -4294, -3189, -2090, -1052, -84, 763, 1547, 2355, 3068, 3519, 3756, 3902, 3933, 3823, 3708, 3678, 3649, 3524, 3320, 3028, 2523, 1758, 907, 186, -391, -946, -1532, -2109, -2658, -3095, -3222, -2972, -2580, -2294, -2012, -1481, -727, -33, 391, 550, 514, 282, -224, -1069, -2212, -3552, -5018, -6510, -7831, -8844, -9605, -10166, -10408, -10312, -10159, -10174, -10171, -9871, -9378, -9011, -8880, -8862, -8898, -9000, -9066, -8945, -8707, -8635, -8840, -9092, -9163, -9140, -9252, -9504, -9662, -9596, -9414, -9259, -9164, -9123, -9106, -8973, -8625, -8191, -7863, -7580, -7169, -6695, -6306, -5882, -5181, -4259, -3411, -2737, -2091, -1452, -1017, -851, -751, -631, -697, -1047, -1421, -1600, -1708, -1897, -2044, -1956, -1606, -1036, -294, 443, 960, 1254, 1537, 1901, 2178, 2178, 1899, 1426, 788, 71, -509, -825, -1016, -1247, -1454, -1505, -1465, -1510, -1675, -1880, -2119, -2460, -2877, -3233, -3484, -3756, -4135, -4524, -4771, -4841, -4828, -4854, -4994, -5215, -5396, -5477, -5531, -5635, -5747, -5780, -5716, -5613, -5530, -5518, -5592, -5691, -5670, -5468, -5233, -5176, -5276, -5250, -4900, -4318, -3762, -3365, -2998, -2401, -1550, -811, -494, -410, -190, 88, 38, -360, -693, -713, -585, -509, -415, -125, 445, 1299, 2337, 3251, 3697, 3752, 3934, 4553, 5270, 5535, 5208, 4595, 4082, 3913, 4057, 4169, 3906, 3335, 2856, 2724, 2841, 2990, 3033, 2890, 2548, 2186, 2155, 2629, 3303, 3626, 3433, 3148, 3192, 3407, 3392, 3166, 3016, 2865, 2395, 1741, 1461, 1791, 2314, 2434, 1946, 1235, 911, 1115, 1287, 906, 184, -329, -496, -482, -279, 168, 629, 844, 973, 1406, 2195, 2927, 3192, 3027, 2830, 2866, 2994, 2950, 2721, 2479, 2261, 1966, 1633, 1469, 1586, 1857, 2061, 2070, 1948, 1918, 2202, 2771, 3323, 3585, 3662, 3931, 4573, 5342, 5840, 5910, 5699, 5471, 5433, 5599, 5762, 5708, 5444, 5153, 4953, 4839, 4801, 4849, 4954, 5006, 4885, 4607, 4378, 4405, 4600, 4629, 4364, 4089, 4117, 4366, 4510, 4432, 4291, 4149, 3869, 3437, 3100, 2973, 2777, 2226, 1512, 1110, 1141, 1248, 1107, 800, 580, 515, 526, 570, 591, 450, 107, -253, -443, -495, -571, -724, -862, -915, -948, -1059, -1186, -1139, -927, -875, -1205, -1678, -1879, -1733, -1495, -1386, -1446, -1575, -1562, -1284, -902, -693, -670, -635, -576, -662, -832, -740, -258, 258, 429, 384, 517, 877, 1142, 1120, 936, 748, 583, 445, 362, 310, 261, 265, 386, 581, 725, 771, 782, 802, 780, 669, 523, 423, 350, 224, 43, -93, -121, -89, -83, -151, -283, -385, -360, -295, -420, -751, -955, -807, -604, -780, -1211, -1335, -1023, -830, -1121, -1421, -1123, -367, 319, 781, 1063, 1009, 636, 423, 667, 969, 761, -37, -1136, -2198, -2871, -2863, -2322, -1860, -1870, -2038, -1896, -1495, -1075, -512, 222, 608, 324, -73, 17, 296, 179, -240, -556, -915, -1708, -2655, -3038, -2828, -2774, -3236, -3745, -3899, -3790, -3453, -2814, -2281, -2369, -2729, -2545, -1944, -1973, -3079, -4467, -5288, -5670, -6139, -6534, -6207, -4968, -3175, -1005, 1734, 5131, 8905, 12463, 15105, 16505, 17070, 17428, 17604, 17165, 15947, 14229, 12391, 10836, 9920, 9647, 9683, 9842, 10212, 10787, 11372, 11989, 12961, 14344, 15608, 16220, 16358, 16633, 17209, 17633, 17569, 17214, 16811, 16165, 14966, 13371, 11929, 10918, 10079, 9014, 7736, 6579, 5697, 4878, 3884, 2739, 1622, 639, -213, -1082, -2139, -3240, -3905, -3918, -3697, -3628, -3420, -2654, -1605, -983, -1035, -1379, -1587, -1670, -2047, -3038, -4426, -5709, -6786, -7979, -9284, -10162, -10325, -10237, -10424, -10651, -10248, -9104, -7786, -6706, -5698, -4513, -3266, -2162, -1231, -523, -164, -72, 52, 317, 522, 497, 321, 137, -28, -126, -14, 306, 559, 511, 319, 316, 584, 948, 1257, 1484, 1633, 1761, 1955, 2228, 2498, 2701, 2847, 2968, 3104, 3297, 3535, 3713, 3708, 3492, 3133, 2696, 2200, 1634, 936, -4, -1242, -2608, -3790, -4620, -5236, -5846, -6405, -6676, -6590, -6286, -5843, -5243, -4622, -4228, -4046, -3876, -3748, -3893, -4317, -4771, -5176, -5688, -6332, -6923, -7332, -7657, -8035, -8447, -8786, -9019, -9218, -9456, -9747, -10016, -10125, -10031, -9890, -9833, -9733, -9424, -9015, -8686, -8334, -7761, -7048, -6430, -5971, -5595, -5271, -4994, -4745, -4562, -4493, -4514, -4619, -4871, -5235, -5509, -5583, -5595, -5703, -5846, -5835, -5550, -5028, -4406, -3810, -3240, -2631, -1989, -1393, -867, -411, -118, -106, -297, -448, -436, -405, -526, -733, -853, -884, -945, -1051, -1130, -1199, -1283, -1357, -1502, -1851, -2264, -2433, -2390, -2455, -2680, -2835, -2874, -2897, -2824, -2552, -2273, -2216, -2293, -2327, -2367, -2544, -2836, -3177, -3609, -4136, -4594, -4858, -5073, -5436, -5850, -6077, -6144, -6261, -6405, -6376, -6203, -6107, -6122, -6047, -5782, -5449, -5163, -4925, -4709, -4557, -4524, -4600, -4711, -4762, -4683, -4492, -4317, -4256, -4211, -3960, -3482, -3052, -2879, -2778, -2428, -1929, -1697, -1811, -1860, -1547, -1122, -975, -1096, -1146, -875, -379, 61, 306, 525, 936, 1479, 1927, 2246, 2593, 2988, 3263, 3317, 3252, 3251, 3419, 3657, 3660, 3242, 2625, 2231, 2226, 2443, 2621, 2521, 2077, 1576, 1395, 1511, 1599, 1589, 1635, 1633, 1325, 852, 657, 776, 771, 460, 238, 409, 641, 521, 270, 366, 724, 850, 659, 569, 784, 994, 844, 410, 120, 251, 575, 622, 281, -62, -78, 155, 438, 728, 1034, 1302, 1565, 1928, 2412, 2961, 3536, 4043, 4298, 4295, 4299, 4513, 4774, 4780, 4534, 4348, 4425, 4611, 4637, 4509, 4493, 4696, 4868, 4756, 4497, 4445, 4702, 5053, 5275, 5327, 5312, 5373, 5608, 5954, 6229, 6320, 6259, 6109, 5924, 5740, 5530, 5223, 4832, 4502, 4306, 4086, 3681, 3262, 3135, 3228, 3108, 2632, 2181, 2024, 1953, 1743, 1539, 1494, 1456, 1294, 1194, 1376, 1750, 2026, 2058, 1938, 1842, 1826, 1801, 1669, 1435, 1152, 861, 601, 429, 375, 419, 506, 536, 406, 155, 18, 179, 504, 650, 494, 284, 295, 498, 727, 961, 1170, 1171, 943, 852, 1123, 1378, 1168, 669, 386, 387, 330, 77, -120, -56, 94, -20, -390, -539, -182, 217, 67, -392, -408, 118, 538, 529, 503, 813, 1244, 1461, 1535, 1769, 2221, 2539, 2300, 1549, 819, 510, 450, 250, -160, -553, -684, -452, -46, 97, -185, -463, -316, -63, -313, -1030, -1587, -1641, -1438, -1316, -1258, -999, -441, 98, 219, -9, -147, -99, -246, -742, -1229, -1445, -1637, -2146, -2915, -3566, -3736, -3386, -2943, -3039, -3818, -4613, -4696, -4274, -4167, -4436, -4170, -3021, -1927, -1646, -1515, -575, 820, 1520, 1211, 639, 400, 262, -281, -1344, -2608, -3525, -3572, -2802, -2045, -1961, -2111, -1723, -1032, -823, -1004, -787, -194, -187, -1133, -2134, -2300, -1952, -2024, -2768, -3683, -4407, -5001, -5516, -5843, -5990, -6026, -5699, -4563, -2556, -112, 2379, 4832, 7092, 8956, 10638, 12499, 14128, 14628, 13996, 13195, 12760, 12316, 11601, 10941, 10570, 10336, 10158, 10192, 10585, 11272, 11920, 12184, 12221, 12634, 13522, 14239, 14431, 14533, 14847, 15024, 14897, 14856, 15013, 14897, 14269, 13459, 12785, 12249, 11757, 11174, 10300, 9151, 8003, 7038, 6148, 5160, 3961, 2548, 1114, -51, -924, -1711, -2376, -2610, -2396, -2133, -2023, -1742, -988, -66, 454, 490, 466, 605, 609, 143, -691, -1547, -2274, -2973, -3756, -4598, -5379, -6012, -6480, -6775, -6827, -6571, -6068, -5457, -4833, -4192, -3509, -2758, -1907, -992, -198, 241, 355, 444, 731, 1101, 1370, 1577, 1834, 2002, 1856, 1537, 1464, 1685, 1718, 1250, 619, 270, 94, -267, -751, -1014, -1014, -1019, -1084, -960, -558, -128, 133, 371, 769, 1223, 1514, 1631, 1680, 1640, 1402, 937, 309, -419, -1213, -2063, -2951, -3822, -4644, -5451, -6187, -6620, -6634, -6477, -6433, -6402, -6113, -5614, -5217, -5035, -4873, -4637, -4504, -4622, -4840, -4914, -4867, -4923, -5140, -5335, -5423, -5582, -5965, -6439, -6786, -7047, -7419, -7914, -8356, -8674, -8966, -9287, -9535, -9621, -9593, -9534, -9435, -9217, -8873, -8454, -7982, -7422, -6747, -5998, -5309, -4822, -4531, -4264, -3978, -3875, -4086, -4407, -4618, -4796, -5120, -5535, -5852, -5985, -5938, -5748, -5520, -5347, -5152, -4767, -4217, -3733, -3419, -3103, -2610, -2066, -1707, -1497, -1154, -612, -212, -202, -300, -101, 278, 380, 115, -223, -520, -910, -1351, -1657, -1904, -2333, -2909, -3348, -3566, -3737, -3934, -3995, -3874, -3757, -3726, -3559, -3125, -2709, -2650, -2805, -2774, -2550, -2543, -2945, -3441, -3720, -3954, -4473, -5126, -5420, -5304, -5345, -5884, -6482, -6596, -6365, -6243, -6241, -6098, -5849, -5701, -5594, -5332, -4922, -4510, -4164, -3903, -3736, -3568, -3243, -2800, -2484, -2400, -2305, -1927, -1387, -1041, -988, -996, -890, -750, -742, -904, -1112, -1169, -1015, -829, -796, -836, -758, -532, -223, 196, 725, 1149, 1283, 1336, 1673, 2217, 2485, 2307, 2135, 2359, 2659, 2463, 1900, 1699, 2055, 2264, 1875, 1415, 1396, 1418, 1056, 718, 785, 780, 300, -143, -37, 235, 149, -69, 24, 270, 238, 28, 89, 432, 570, 310, 63, 189, 474, 594, 690, 1010, 1294, 1093, 592, 433, 748, 1001, 839, 476, 162, -111, -303, -268, -109, -106, -230, -113, 400, 958, 1136, 1012, 1036, 1412, 1845, 1998, 1939, 1982, 2204, 2358, 2302, 2289, 2618, 3085, 3155, 2736, 2389, 2540, 2895, 2933, 2651, 2458, 2531, 2669, 2727, 2874, 3297, 3830, 4077, 3892, 3603, 3627, 3969, 4248, 4172, 3861, 3666, 3772, 4030, 4160, 4060, 3886, 3803, 3758, 3577, 3234, 2900, 2708, 2599, 2444, 2226, 2056, 2035, 2138, 2257, 2355, 2481, 2614, 2611, 2421, 2225, 2249, 2454, 2581, 2492, 2326, 2250, 2261, 2310, 2421, 2543, 2500, 2264, 2076, 2077, 2106, 2021, 1968, 2100, 2281, 2324, 2337, 2551, 2908, 3115, 3081, 3018, 3067, 3071, 2878, 2624, 2526, 2572, 2584, 2516, 2488, 2567, 2685, 2766, 2780, 2703, 2554, 2457, 2484, 2503, 2381, 2243, 2325, 2596, 2782, 2751, 2665, 2676, 2707, 2627, 2469, 2306, 2102, 1854, 1708, 1750, 1842, 1809, 1651, 1468, 1326, 1248, 1199, 1048, 724, 353, 136, 83, 24, -123, -215, -52, 336, 680, 760, 647, 566, 591, 604, 517, 349, 124, -167, -447, -599, -628, -637, -645, -550, -323, -87, 21, 17, 28, 119, 211, 220, 223, 348, 579, 807, 1034, 1278, 1410, 1331, 1224, 1305, 1423, 1266, 868, 561, 453, 322, 106, 81, 363, 612, 548, 408, 479, 564, 375, 99, 100, 345, 533, 546, 493, 558, 864, 1309, 1612, 1676, 1680, 1702, 1608, 1396, 1235, 1079, 704, 183, -143, -182, -191, -359, -619, -881, -1177, -1507, -1728, -1664, -1411, -1370, -1766, -2211, -2122, -1547, -1036, -733, -309, 213, 308, -170, -648, -632, -307, -118, -170, -331, -574, -895, -1114, -1099, -1057, -1262, -1603, -1779, -1867, -2251, -2955, -3451, -3328, -2801, -2309, -1932, -1536, -1218, -1148, -1137, -800, -142, 382, 452, 201, -62, -202, -215, -127, -91, -346, -880, -1388, -1698, -1965, -2291, -2491, -2447, -2341, -2337, -2255, -1840, -1188, -671, -483, -420, -196, 196, 520, 608, 527, 424, 353, 263, 132, 17, -13, 25, 35, -50, -174, -227, -205, -251, -447, -643, -610, -403, -385, -747, -1151, -1064, -457, 89, 143, 23, 370, 1224, 1946, 2081, 1885, 1847, 2050, 2197, 2073, 1754, 1473, 1356, 1301, 1109, 812, 787, 1279, 1871, 1847, 1260, 1009, 1516, 1999, 1632, 769, 331, 460, 571, 413, 230, 28, -547, -1395, -1751, -1199, -431, -485, -1552, -2885, -3664, -3578, -2823, -2030, -2071, -3472, -5836, -8154, -9730, -10640, -11306, -11991, -12769, -13532, -13767, -12672, -9918, -6202, -2663, 202, 2680, 5074, 7349, 9451, 11312, 12593, 12981, 12697, 12264, 11915, 11682, 11601, 11481, 10982, 10145, 9383, 8918, 8731, 8893, 9375, 9835, 10090, 10338, 10632, 10754, 10861, 11397, 12214, 12517, 12005, 11326, 11194, 11555, 11941, 12195, 12537, 13034, 13342, 13126, 12479, 11793, 11193, 10374, 8983, 7090, 5147, 3468, 1924, 262, -1396, -2623, -3211, -3404, -3551, -3682, -3541, -2967, -2139, -1397, -854, -316, 346, 903, 1028, 738, 309, -105, -564, -1135, -1767, -2324, -2742, -3206, -3937, -4728, -5120, -5182, -5487, -6127, -6560, -6658, -6943, -7501, -7699, -7299, -6914, -6942, -6847, -6026, -4771, -3845, -3400, -2857, -1822, -621, 213, 590, 757, 823, 659, 168, -554, -1353, -2188, -3080, -3953, -4661, -5230, -5836, -6438, -6712, -6529, -6209, -6070, -5977, -5607, -4987, -4444, -4100, -3736, -3211, -2683, -2320, -2054, -1772, -1571, -1552, -1568, -1435, -1285, -1431, -1878, -2259, -2355, -2423, -2836, -3568, -4217, -4471, -4413, -4385, -4618, -4947, -4975, -4534, -3939, -3613, -3560, -3398, -2901, -2316, -2009, -1965, -1850, -1521, -1245, -1337, -1721, -2031, -2070, -2062, -2355, -3003, -3716, -4220, -4510, -4724, -4944, -5235, -5698, -6311, -6805, -6910, -6720, -6621, -6787, -6966, -6846, -6459, -6058, -5745, -5419, -5006, -4546, -4099, -3671, -3272, -2936, -2681, -2497, -2363, -2232, -2027, -1725, -1448, -1379, -1557, -1790, -1842, -1657, -1388, -1252, -1374, -1712, -2023, -2012, -1615, -1119, -850, -791, -658, -288, 212, 699, 1160, 1568, 1777, 1748, 1704, 1848, 2051, 2046, 1820, 1537, 1236, 876, 546, 378, 285, 43, -393, -845, -1173, -1426, -1651, -1762, -1722, -1722, -1968, -2333, -2465, -2287, -2139, -2293, -2573, -2619, -2417, -2276, -2329, -2373, -2259, -2147, -2200, -2292, -2305, -2415, -2774, -3183, -3416, -3569, -3790, -3938, -3851, -3680, -3654, -3703, -3594, -3297, -2985, -2737, -2513, -2350, -2312, -2254, -1959, -1538, -1365, -1519, -1622, -1365, -928, -701, -791, -965, -1016, -995, -1018, -977, -674, -219, -15, -242, -624, -816, -782, -677, -642, -805, -1209, -1609, -1594, -1064, -421, -109, -105, -78, 103, 313, 478, 590, 539, 288, 56, 25, 86, 137, 271, 449, 382, 39, -205, -163, -205, -667, -1252, -1479, -1450, -1570, -1725, -1550, -1278, -1382, -1589, -1330, -870, -912, -1352, -1511, -1270, -1034, -905, -719, -559, -597, -659, -408, 104, 425, 250, -201, -482, -517, -627, -919, -1063, -879, -734, -966, -1305, -1284, -961, -758, -801, -848, -739, -560, -404, -250, -87, 50, 196, 422, 660, 774, 799, 872, 933, 814, 583, 483, 538, 546, 425, 314, 320, 414, 548, 681, 730, 660, 631, 841, 1196, 1370, 1277, 1180, 1245, 1317, 1294, 1334, 1516, 1610, 1447, 1251, 1382, 1843, 2200, 2066, 1635, 1517, 1896, 2235, 2085, 1751, 1708, 1845, 1812, 1697, 1789, 2019, 2135, 2177, 2330, 2535, 2614, 2635, 2816, 3137, 3354, 3406, 3496, 3690, 3747, 3533, 3323, 3431, 3699, 3731, 3507, 3372, 3430, 3454, 3401, 3538, 3904, 4136, 4044, 3957, 4227, 4709, 5004, 5044, 5094, 5269, 5368, 5234, 5020, 4983, 5149, 5314, 5265, 4984, 4683, 4586, 4656, 4606, 4270, 3844, 3662, 3755, 3842, 3702, 3429, 3242, 3201, 3210, 3182, 3119, 3085, 3170, 3395, 3639, 3733, 3691, 3744, 4058, 4513, 4850, 4953, 4833, 4508, 4125, 3963, 4025, 3904, 3363, 2712, 2308, 2067, 1769, 1438, 1178, 984, 875, 909, 1024, 1113, 1178, 1198, 1060, 793, 637, 761, 1100, 1482, 1745, 1774, 1645, 1628, 1869, 2194, 2325, 2166, 1795, 1337, 955, 803, 808, 650, 159, -390, -636, -666, -805, -1029, -1053, -898, -808, -748, -507, -128, 209, 550, 971, 1267, 1247, 1164, 1392, 1747, 1645, 986, 354, 160, 114, -148, -454, -506, -454, -637, -1059, -1447, -1622, -1609, -1508, -1419, -1424, -1538, -1660, -1581, -1156, -517, 11, 293, 483, 703, 908, 1118, 1398, 1599, 1557, 1495, 1695, 1960, 1937, 1713, 1528, 1253, 702, 101, -264, -549, -1023, -1557, -1853, -1969, -2166, -2356, -2209, -1768, -1385, -1029, -390, 386, 812, 914, 1174, 1707, 2197, 2523, 2745, 2704, 2259, 1668, 1313, 1231, 1165, 866, 257, -508, -1142, -1511, -1691, -1732, -1657, -1670, -1972, -2389, -2553, -2436, -2336, -2427, -2672, -3064, -3607, -4083, -4195, -3979, -3802, -3833, -3790, -3380, -2760, -2286, -2015, -1714, -1247, -708, -281, -82, -55, -7, 171, 358, 421, 393, 368, 396, 569, 938, 1337, 1599, 1852, 2311, 2887, 3356, 3725, 4125, 4507, 4737, 4864, 4997, 5091, 5048, 4956, 4979, 5094, 5143, 5115, 5185, 5423, 5599, 5503, 5345, 5485, 5776, 5697, 5261, 5020, 5031, 4772, 4242, 4015, 4060, 3793, 3293, 3165, 3316, 3171, 2826, 2798, 2998, 3011, 2903, 2967, 3075, 2940, 2676, 2592, 2656, 2576, 2263, 1920, 1687, 1481, 1229, 982, 774, 604, 564, 682, 741, 554, 285, 184, 219, 203, 65, -150, -374, -539, -679, -876, -1018, -902, -679, -692, -856, -785, -541, -553, -822, -931, -816, -834, -1081, -1267, -1273, -1320, -1537, -1753, -1828, -1870, -1983, -2089, -2130, -2204, -2306, -2251, -2036, -1970, -2195, -2388, -2252, -2044, -2177, -2520, -2596, -2402, -2379, -2578, -2601, -2410, -2396, -2587, -2564, -2277, -2172, -2376, -2493, -2326, -2224, -2468, -2773, -2704, -2317, -2042, -2087, -2286, -2406, -2326, -2034, -1685, -1541, -1657, -1748, -1606, -1473, -1660, -1960, -1880, -1463, -1289, -1566, -1863, -1892, -1871, -1952, -1977, -1955, -2175, -2658, -3048, -3149, -3147, -3257, -3462, -3676, -3872, -4023, -4061, -3995, -3958, -4038, -4141, -4130, -4046, -4048, -4186, -4362, -4498, -4583, -4556, -4348, -4080, -3967, -3970, -3844, -3580, -3410, -3345, -3155, -2845, -2727, -2897, -3053, -2964, -2753, -2590, -2423, -2231, -2233, -2509, -2702, -2495, -2125, -1994, -2044, -1989, -1861, -1825, -1751, -1433, -1028, -879, -1021, -1187, -1216, -1192, -1187, -1172, -1197, -1400, -1746, -1945, -1844, -1723, -1903, -2249, -2381, -2312, -2408, -2722, -2903, -2842, -2815, -2924, -2936, -2802, -2759, -2832, -2728, -2358, -2033, -2003, -2138, -2208, -2226, -2262, -2244, -2186, -2316, -2682, -2977, -3059, -3162, -3362, -3445, -3467, -3743, -4170, -4282, -4044, -3909, -4034, -4050, -3722, -3271, -2962, -2727, -2405, -2058, -1835, -1671, -1394, -1027, -768, -678, -630, -550, -491, -457, -342, -148, -47, -120, -210, -173, -71, -18, -11, -39, -120, -180, -99, 62, 155, 186, 276, 392, 384, 258, 211, 324, 439, 436, 410, 410, 291, 14, -203, -266, -349, -537, -693, -819, -1067, -1355, -1419, -1294, -1291, -1446, -1409, -1017, -585, -474, -603, -624, -433, -252, -214, -152, 106, 464, 713, 844, 1022, 1316, 1601, 1762, 1836, 1906, 1945, 1883, 1778, 1755, 1797, 1765, 1621, 1479, 1424, 1399, 1331, 1234, 1124, 954, 731, 593, 668, 896, 1135, 1358, 1592, 1759, 1765, 1726, 1864, 2186, 2426, 2422, 2325, 2347, 2457, 2529, 2604, 2752, 2806, 2542, 2104, 1920, 2170, 2524, 2512, 2104, 1851, 2263, 3067, 3469, 3241, 2962, 3036, 3156, 3035, 2928, 3049, 3102, 2824, 2490, 2509, 2842, 3112, 3108, 2945, 2826, 2802, 2797, 2771, 2793, 2942, 3235, 3619, 3940, 3988, 3703, 3305, 2995, 2676, 2202, 1763, 1666, 1815, 1831, 1668, 1717, 2282, 3181, 3911, 4079, 3734, 3286, 3064, 2932, 2478, 1679, 1116, 1308, 1979, 2355, 2155, 1851, 1908, 2224, 2472, 2632, 2891, 3246, 3485, 3461, 3202, 2849, 2604, 2647, 2914, 3024, 2656, 2005, 1621, 1711, 1918, 1912, 1883, 2141, 2562, 2908, 3305, 3861, 4207, 4031, 3685, 3610, 3522, 2867, 1824, 1159, 1181, 1438, 1514, 1591, 1965, 2481, 2781, 2791, 2685, 2610, 2628, 2654, 2407, 1727, 904, 346, 108, 45, 151, 393, 511, 354, 224, 481, 969, 1272, 1437, 1869, 2480, 2664, 2265, 1851, 1751, 1587, 1001, 193, -528, -1121, -1487, -1355, -743, -129, 131, 262, 623, 1103, 1320, 1215, 1014, 730, 151, -694, -1501, -2129, -2751, -3449, -3968, -4033, -3686, -3141, -2555, -2087, -1900, -1895, -1714, -1219, -677, -353, -208, -123, -84, -56, 22, 86, 1, -169, -204, -52, 73, 22, -23, 204, 688, 1196, 1600, 1918, 2101, 2029, 1680, 1245, 1057, 1329, 1815, 1965, 1619, 1326, 1687, 2617, 3543, 4133, 4490, 4745, 4827, 4682, 4466, 4390, 4470, 4542, 4438, 4109, 3665, 3345, 3293, 3378, 3376, 3275, 3212, 3219, 3245, 3300, 3377, 3383, 3314, 3327, 3495, 3696, 3764, 3658, 3471, 3357, 3362, 3300, 3052, 2886, 3128, 3544, 3558, 3097, 2723, 2791, 2949, 2713, 2157, 1698, 1461, 1273, 1079, 896, 585, 166, 85, 596, 1181, 1171, 687, 392, 568, 893, 962, 667, 161, -309, -606, -755, -835, -901, -1020, -1257, -1565, -1825, -1998, -2101, -2131, -2101, -2117, -2239, -2382, -2434, -2445, -2536, -2686, -2769, -2784, -2890, -3134, -3368, -3488, -3542, -3528, -3358, -3112, -3042, -3210, -3378, -3378, -3332, -3432, -3688, -3963, -4124, -4156, -4147, -4162, -4157, -4105, -4087, -4143, -4137, -3954, -3710, -3604, -3620, -3571, -3442, -3441, -3638, -3806, -3778, -3729, -3860, -4065, -4159, -4172, -4208, -4367, -4769, -5298, -5496, -5212, -4976, -5189, -5477, -5453, -5379, -5515, -5591, -5446, -5399, -5573, -5618, -5422, -5357, -5650, -6035, -6197, -6159, -6113, -6130, -6109, -5988, -5964, -6268, -6737, -6955, -6921, -7010, -7216, -7121, -6715, -6477, -6556, -6651, -6666, -6748, -6722, -6247, -5443, -4798, -4534, -4487, -4469, -4391, -4204, -3948, -3772, -3654, -3308, -2597, -1939, -1903, -2464, -3120, -3677, -4372, -5167, -5514, -5102, -4329, -3817, -3708, -3732, -3726, -3790, -3979, -4122, -3997, -3562, -2967, -2477, -2325, -2520, -2802, -2854, -2529, -1907, -1301, -1134, -1620, -2503, -3270, -3614, -3581, -3299, -2818, -2300, -2114, -2551, -3438, -4278, -4703, -4685, -4404, -4062, -3753, -3379, -2787, -2034, -1413, -1150, -1192, -1354, -1513, -1592, -1485, -1171, -811, -549, -312, -40, 24, -394, -1142, -1734, -1886, -1645, -1257, -1096, -1442, -2100, -2502, -2356, -1858, -1240, -484, 360, 965, 1067, 856, 781, 979, 1122, 872, 369, 198, 843, 2076, 2950, 2773, 2050, 1879, 2425, 2725, 2131, 1141, 540, 482, 635, 752, 843, 1143, 1916, 3035, 3814, 3631, 2719, 1998, 2015, 2440, 2730, 2883, 3177, 3596, 3948, 4256, 4602, 4730, 4324, 3602, 3241, 3599, 4244, 4398, 3700, 2485, 1399, 906, 1038, 1504, 1978, 2365, 2765, 3115, 3070, 2535, 2085, 2286, 2879, 3329, 3839, 4835, 5803, 5787, 4864, 4016, 3711, 3555, 3206, 2789, 2467, 2216, 2064, 2214, 2806, 3667, 4344, 4414, 3798, 2832, 1988, 1418, 916, 483, 647, 1823, 3540, 4794, 4999, 4352, 3487, 3024, 3118, 3313, 3155, 2959, 3459, 4673, 5715, 5913, 5574, 5323, 5113, 4416, 3247, 2404, 2456, 2928, 2910, 2297, 1845, 2048, 2577, 2943, 3139, 3358, 3588, 3746, 3826, 3823, 3877, 4288, 5006, 5351, 4687, 3163, 1626, 1118, 2224, 4312, 5758, 5610, 4481, 3251, 1899, 450, -121, 940, 2922, 4420, 4789, 4335, 3637, 3073, 2600, 1879, 865, 222, 776, 2516, 4370, 5129, 4500, 3217, 2344, 2534, 3602, 4562, 4450, 3285, 1904, 1008, 886, 1668, 2998, 3872, 3678, 2911, 2161, 1234, 36, -673, -329, 517, 1073, 1420, 2133, 3246, 4089, 4011, 3167, 2408, 2164, 1781, 607, -712, -935, 261, 2257, 4157, 4825, 3471, 1012, -556, -661, -465, -549, -246, 631, 1386, 1778, 2134, 2307, 1884, 1067, 443, 328, 749, 1437, 1726, 1209, 445, 309, 829, 1358, 1670, 2174, 3037, 3620, 3009, 1051, -1244, -2425, -1854, -238, 1117, 1475, 1105, 745, 712, 605, 82, -260, 525, 2117, 2848, 1780, 17, -746, -303, 248, 263, 203, 659, 1527, 2276, 2453, 1742, 148, -1579, -2289, -1556, -13, 1512, 2624, 3176, 3109, 2404, 933, -1070, -2395, -1872, -141, 936, 645, -145, -606, -555, 30, 741, 658, -247, -582, 509, 1798, 1484, -474, -2389, -2767, -1651, -274, 303, 126, -113, -169, -484, -1419, -2683, -3546, -3362, -1995, -72, 1321, 1526, 854, 146, -54, 129, 84, -667, -1761, -2197, -1543, -431, 364, 695, 650, 284, -73, -134, -281, -908, -1402, -850, 468, 1325, 1062, 110, -764, -1099, -879, -445, -173, -192, -464, -920, -1254, -929, 151, 1127, 867, -674, -2270, -2790, -2331, -1663, -1119, -601, -109, 223, 224, -556, -2510, -5014, -6434, -5527, -2643, 628, 2702, 2940, 1767, 30, -1763, -3514, -4908, -5141, -3586, -722, 1868, 2630, 1241, -1288, -3579, -4830, -4937, -4137, -2859, -1669, -988, -870, -1162, -1740, -2392, -2733, -2569, -2257, -2373, -3033, -3757, -4025, -3659, -2718, -1414, -297, -59, -845, -2026, -2912, -3386, -3611, -3412, -2470, -1045, 5, 60, -755, -1963, -3138, -3881, -3928, -3346, -2252, -684, 784, 1012, -326, -1988, -2565, -2079, -1608, -1923, -2836, -3286, -2097, 650, 3163, 3543, 1630, -1248, -3829, -5524, -6046, -5178, -2891, 368, 3407, 4731, 3704, 821, -2995, -6392, -7510, -5768, -3071, -1218, 648, 3518, 5240, 3043, -2051, -6332, -7631, -6283, -3397, -201, 2069, 2967, 2833, 1695, -715, -3722, -5682, -5677, -4435, -3110, -1873, -407, 863, 1037, -107, -1981, -3708, -4249, -3012, -1060, -581, -2152, -3549, -2479, 283, 1895, 1141, -479, -1394, -1872, -2674, -3356, -3091, -2076, -1072, -289, 408, 731, 229, -924, -2008, -2499, -2394, -1997, -1797, -2227, -2909, -2484, -88, 3046, 4344, 2387, -1800, -5824, -7646, -6418, -2620, 2036, 5251, 5481, 3006, -396, -2931, -3969, -3925, -3400, -2583, -1140, 1384, 4424, 5588, 2523, -3631, -8274, -8007, -4003, 175, 2528, 3383, 3692, 3650, 2429, -798, -5007, -7218, -5338, -629, 3518, 4807, 3372, 670, -1687, -2408, -1393, -317, -758, -1631, -623, 1751, 2371, 367, -1432, -962, 184, -247, -1767, -2396, -1670, -771, -399, 129, 1527, 3130, 3417, 1733, -1028, -3268, -3648, -1670, 1669, 4030, 3807, 2121, 1462, 2328, 2692, 1143, -989, -1543, -418, 607, 431, -218, -91, 1100, 2730, 3956, 4110, 2995, 1095, -810, -2248, -2966, -2504, -530, 2327, 4608, 5273, 4459, 2800, 598, -1891, -3900, -4526, -3437, -856, 2718, 6285, 8198, 7071, 3044, -2044, -5822, -6659, -4326, -219, 3194, 4225, 3420, 2505, 2129, 1674, 809, 17, -167, 413, 1396, 1699, 466, -1256, -1065, 1693, 4432, 4153, 1122, -1631, -2073, -808, 879, 2526, 3639, 3438, 2166, 1033, 500, 100, -288, -404, -293, 98, 1083, 2275, 2691, 2113, 1083, -87, -931, -610, 386, 11, -2036, -2662, 635, 5582, 7331, 4048, -1513, -5559, -6590, -5127, -1802, 2825, 6953, 8042, 5661, 2324, 189, -1362, -3307, -4421, -3260, -496, 2793, 6553, 9357, 7675, 506, -7484, -10344, -7193, -2064, 1515, 3460, 4882, 5365, 3810, 823, -1409, -1589, -630, -258, -856, -1075, 424, 2993, 4144, 2264, -1076, -2663, -1720, -848, -1901, -2810, -675, 3225, 4415, 1262, -2707, -3550, -1620, 143, 494, 112, -776, -2249, -3150, -2304, -497, 905, 2288, 4413, 5643, 3411, -1436, -4610, -3677, -938, 404, 469, 1166, 2624, 3301, 2102, -974, -4763, -6739, -4769, 228, 4749, 6038, 4060, 714, -1714, -1905, -517, 335, -604, -2118, -1864, 603, 2878, 2500, 408, 25, 2238, 3282, -306, -6065, -7816, -3261, 3382, 6686, 5623, 2951, 959, -423, -1963, -3309, -3418, -2090, -328, 759, 1038, 1188, 1657, 1976, 1331, -155, -1148, -648, 432, 344, -800, -961, 566, 1691, 559, -1620, -2335, -1168, 61, -104, -1065, -1067, 403, 1507, 344, -1924, -2027, 822, 3308, 2239, -1042, -2401, -304, 2560, 3082, 929, -2336, -4954, -5124, -2044, 2216, 4114, 2625, 71, -1038, -199, 1603, 2704, 1568, -1457, -3657, -2644, 787, 3627, 4221, 3714, 3793, 4089, 2745, -831, -4683, -5961, -3584, 798, 4333, 5419, 4680, 3505, 2041, -619, -4137, -6084, -4576, -854, 2290, 3887, 4761, 5023, 3895, 1605, -618, -2198, -3237, -3297, -1651, 1383, 4322, 5633, 4598, 1522, -2167, -4346, -3686, -1047, 1285, 2003, 1704, 1296, 563, -1014, -2719, -2865, -747, 1992, 2619, 362, -2261, -2112, 784, 3234, 2685, -101, -2512, -3001, -1763, 382, 2329, 2533, 353, -2390, -2830, -533, 1829, 1962, 798, 730, 2008, 2567, 1147, -1144, -2367, -1419, 1481, 4420, 4548, 1062, -3294, -5183, -4007, -1193, 1961, 4339, 4726, 2963, 325, -1721, -2264, -1071, 847, 1652, 800, -182, 43, 800, 702, -193, -512, 493, 1696, 1090, -1644, -3919, -2617, 2051, 6039, 5700, 1888, -1400, -2021, -1383, -1162, -998, -280, 472, 1112, 2215, 3094, 2148, -73, -845, 841, 2700, 2383, 494, -634, 2, 1312, 1866, 1387, 487, -273, -810, -1218, -1031, 814, 4226, 6566, 5063, 655, -2697, -2753, -956, 458, 1109, 1694, 2384, 2788, 2654, 2153, 1674, 1316, 486, -1480, -3931, -4716, -2237, 2267, 5303, 4682, 2138, 1117, 1987, 1689, -1036, -3106, -1848, 730, 1408, 846, 1765, 3951, 4487, 2052, -1544, -3663, -3125, -682, 1596, 1886, 586, 314, 2842, 6259, 6645, 2821, -2006, -4152, -3551, -2477, -1522, 575, 3658, 5745, 6003, 5118, 2822, -1465, -5501, -5514, -1195, 3605, 5428, 4221, 2075, 779, 472, -149, -1822, -3034, -1575, 2213, 5196, 4891, 2102, -397, -1010, -368, 72, -552, -1967, -2641, -956, 2420, 4404, 3024, -73, -1935, -1867, -1295, -1220, -1279, -837, 97, 950, 1144, 709, 373, 712, 1224, 723, -1071, -2762, -2651, -811, 940, 1452, 1529, 1913, 1369, -1175, -3708, -3335, -983, -537, -2864, -3996, -704, 4682, 6979, 4286, -529, -3773, -4440, -3790, -3042, -2160, -256, 2847, 5172, 3695, -1927, -7626, -8560, -4269, 1058, 3336, 2372, 679, -239, -1192, -3147, -5160, -5240, -2753, 709, 2810, 2409, 171, -2201, -3072, -1805, 505, 1475, -394, -3858, -5980, -5072, -1869, 1846, 4511, 4670, 1396, -3888, -7270, -5955, -1615, 1733, 2466, 1803, 634, -1070, -2436, -2455, -2103, -2887, -3904, -2887, 315, 3364, 4091, 2094, -1738, -5781, -7957, -6852, -3084, 1090, 3809, 4692, 3981, 1797, -1294, -4033, -5508, -5730, -4667, -1855, 2079, 4552, 3313, -661, -4022, -4785, -3841, -2583, -905, 1328, 2531, 1282, -1124, -2618, -3766, -5777, -6244, -1566, 6450, 11069, 8313, 680, -6753, -10553, -9537, -4537, 1644, 5702, 6035, 3496, 404, -1307, -1659, -2333, -4362, -6356, -5661, -1355, 4276, 7468, 6248, 1987, -2326, -4979, -6120, -5979, -4075, -678, 2418, 3566, 2890, 1599, 421, -874, -2761, -4677, -4678, -1609, 2451, 3886, 1917, -776, -1916, -1773, -1307, -637, 58, 219, 121, 653, 1181, -255, -3286, -3966, 269, 5939, 6987, 2282, -3341, -5362, -3924, -1615, 254, 1710, 2293, 1167, -1175, -2735, -1995, 496, 2701, 2868, 853, -1860, -3389, -3040, -1677, -457, 464, 1570, 2662, 2711, 1213, -1002, -2709, -3423, -3309, -2486, -802, 1805, 4439, 4869, 1518, -3616, -5919, -3255, 1441, 3796, 2708, 353, -1114, -1559, -2059, -2853, -2497, 319, 4208, 5672, 2988, -1522, -4006, -3185, -1071, -50, -393, -807, -421, 507, 1385, 1846, 1578, 346, -1475, -2774, -2484, -594, 1711, 3014, 2663, 896, -1490, -3141, -2600, 99, 2704, 2799, 410, -2291, -3279, -1977, 786, 3256, 3969, 2865, 624, -2368, -5120, -5284, -1558, 3660, 6111, 4076, -331, -3861, -4703, -2784, 761, 3963, 5043, 3896, 1883, -240, -3058, -6295, -7246, -3324, 3948, 9286, 8686, 3270, -2414, -5031, -4522, -2489, -109, 2066, 3358, 2989, 1045, -976, -1280, 252, 1776, 1558, -175, -1811, -2060, -766, 1226, 2509, 2024, 75, -1833, -2376, -1471, -128, 509, 45, -810, -823, 284, 966, -647, -3924, -5498, -2985, 1676, 3957, 1825, -2135, -4023, -2852, -667, 651, 1210, 1769, 1971, 677, -2243, -4960, -4980, -1771, 2304, 4369, 3925, 2527, 1265, -58, -1622, -2831, -2977, -1959, -420, 629, 755, 690, 1369, 2398, 2234, 30, -3175, -5249, -4710, -1785, 1914, 4579, 5322, 4423, 2640, 428, -1828, -3210, -2977, -1806, -963, -277, 1463, 4081, 5667, 4629, 901, -4104, -7504, -6279, -529, 5578, 7678, 5326, 1132, -2810, -5615, -5844, -2215, 3437, 6772, 5744, 2577, -64, -2239, -4499, -5160, -2576, 1363, 3132, 2394, 1796, 2188, 1776, 203, -653, -397, -467, -684, 250, 1118, -418, -3109, -3087, 501, 4329, 5396, 4046, 2133, 182, -2490, -5411, -6142, -2761, 3202, 7338, 6391, 1558, -2827, -3958, -2746, -1083, 855, 3100, 4067, 2550, -304, -2736, -4098, -3707, -578, 4185, 7013, 5376, 400, -4609, -6856, -5100, -133, 4713, 5516, 2097, -1158, -931, 619, -109, -2034, -1355, 1915, 3711, 1766, -1594, -2759, -919, 1501, 1874, 515, 205, 2413, 5218, 5633, 2765, -1821, -5565, -6178, -3021, 1731, 4425, 3631, 1740, 1496, 2001, 475, -2640, -3548, -511, 3591, 5161, 3787, 1211, -1249, -2790, -2446, -219, 1972, 2131, 785, 321, 1506, 2196, 431, -2395, -3034, -588, 2367, 3075, 1619, 111, -21, 841, 1459, 1028, -224, -1278, -1156, 363, 2608, 4298, 4097, 1512, -2348, -5105, -4661, -851, 4291, 7787, 7348, 2821, -2983, -5838, -4146, -635, 1477, 2145, 2362, 1127, -2048, -4008, -1459, 3653, 6152, 4421, 1643, 303, -840, -3018, -4018, -1222, 3769, 6362, 4176, -888, -5082, -5668, -2253, 2827, 5852, 5158, 2997, 2329, 2273, -543, -5915, -8772, -5529, 1147, 5943, 7003, 6287, 5292, 2733, -2958, -9639, -11818, -6644, 2009, 7841, 8840, 6955, 3666, -178, -2583, -2573, -2120, -2643, -2260, 616, 3795, 4322, 2640, 1331, 1210, 560, -2211, -5934, -6990, -2872, 4474, 9772, 9184, 3572, -2625, -5173, -3408, -592, -209, -1774, -1858, 724, 3305, 3429, 1900, 934, 1288, 1623, -137, -3910, -5954, -2984, 2467, 4920, 3615, 2177, 1548, -627, -4088, -5435, -3606, -1132, 3, 407, 1399, 3098, 4098, 2700, -628, -2699, -1263, 1377, 807, -3209, -5495, -2010, 4500, 7871, 6012, 2005, -1309, -4178, -7184, -8781, -6734, -805, 6260, 10114, 8121, 1977, -3745, -5977, -5268, -3741, -2257, -148, 2747, 4630, 3472, 354, -995, 583, 1323, -2017, -6574, -6653, -1280, 4820, 6998, 4737, 576, -2706, -3811, -3119, -1829, -1183, -2025, -3562, -2993, 1022, 5029, 4439, -52, -3609, -3815, -2002, 368, 2340, 2311, 118, -1703, -1728, -1933, -3494, -3455, 856, 6288, 6699, 864, -5807, -7822, -4908, -226, 3333, 3973, 1392, -2114, -3390, -1963, -51, 538, -309, -1701, -2102, -420, 2066, 2672, 1117, 187, 1378, 2091, -724, -5508, -7257, -3669, 2169, 5656, 5175, 1944, -2410, -6352, -7928, -5923, -1449, 2934, 5459, 5492, 2656, -2260, -6111, -5863, -2357, 767, 1801, 2141, 2868, 2787, 529, -3005, -5116, -4153, -1598, -182, 0, 919, 1956, 215, -3430, -4087, -465, 2900, 2810, 1036, -507, -2340, -3958, -3109, 344, 3503, 3729, 1001, -2244, -3055, -1215, 163, -770, -1609, 47, 2203, 1753, -617, -2294, -2926, -3252, -1919, 2378, 6585, 5524, -853, -6364, -6271, -2471, 795, 2572, 3763, 3608, 1122, -1954, -2690, -717, 1424, 1404, -545, -2487, -3252, -3064, -1799, 1458, 5865, 7582, 3577, -3801, -8352, -6523, -953, 2944, 2744, 552, -326, 911, 2452, 2502, 1149, -301, -1003, -1222, -1727, -2739, -3314, -2065, 941, 3558, 3709, 1613, -1002, -2982, -3924, -3335, -1008, 2165, 4338, 3604, -294, -4428, -4715, -937, 2499, 2455, 981, 1275, 2571, 1975, -574, -2404, -2298, -1606, -1150, 19, 2041, 3123, 2269, 756, -183, -898, -1788, -2444, -2601, -2041, -1, 3216, 4993, 3101, -929, -3289, -2389, -94, 1326, 1583, 1277, 158, -2002, -3708, -2766, 724, 3808, 3772, 945, -2160, -3592, -3153, -1816, -776, -364, 495, 2657, 4551, 3457, -628, -4328, -4760, -2485, -7, 1213, 1380, 1213, 1371, 2270, 3285, 2740, 40, -3049, -4544, -4331, -2748, 539, 4390, 5684, 3169, -790, -3672, -5064, -4711, -1869, 2468, 5511, 5428, 2640, -877, -2659, -1695, 184, 742, 530, 1237, 2236, 1814, 330, -950, -2437, -4498, -4787, -831, 5386, 8436, 5435, -983, -6058, -7380, -5345, -1273, 3075, 5409, 4649, 2376, 787, -402, -2998, -6326, -6538, -1305, 6124, 9555, 6450, 111, -4921, -7129, -6684, -3368, 1564, 4528, 3826, 2171, 2100, 1826, -1129, -4984, -5842, -3114, 126, 1311, 914, 1063, 2920, 5401, 5887, 2503, -3537, -8111, -7665, -2574, 3559, 7398, 7819, 5172, 475, -4410, -7350, -7523, -5436, -1161, 5179, 10366, 9144, 974, -7486, -9774, -6514, -2220, 1147, 4152, 6479, 6967, 5327, 1867, -3022, -7767, -9369, -5844, 1269, 7702, 9927, 7520, 2404, -3059, -6954, -7985, -5619, -443, 5093, 7321, 4956, 1040, -1425, -3538, -6385, -6456, -838, 6379, 9062, 7175, 4296, 606, -5436, -11029, -10648, -3139, 6700, 13254, 14049, 9139, -39, -9716, -14274, -10707, -2248, 4674, 6970, 6381, 5017, 2639, -757, -2857, -1972, -195, -740, -2993, -3087, 563, 5001, 6671, 5228, 2314, -1295, -5257, -7719, -6390, -1641, 3552, 7057, 8616, 7305, 1827, -5409, -8862, -6657, -2619, 368, 3938, 8462, 9130, 2680, -5618, -7826, -4179, -1202, -322, 2587, 6590, 5670, 330, -2462, -1506, -1583, -2248, 868, 5041, 3217, -3627, -7565, -5456, -1180, 1934, 4052, 5335, 4598, 1655, -1844, -4370, -5559, -4987, -1814, 3163, 6722, 6306, 2949, -394, -2514, -4136, -5193, -4317, -1171, 2830, 6168, 7433, 4793, -1511, -7029, -7191, -2746, 2004, 4557, 4667, 2308, -1297, -3080, -1616, 784, 1473, 804, 572, 968, 642, -940, -2258, -1175, 2283, 4983, 3410, -2232, -7254, -6793, -1035, 4874, 6392, 3713, 73, -2102, -2513, -2177, -2186, -2336, -1349, 778, 2302, 2721, 3546, 4568, 2744, -2798, -7693, -7099, -1667, 3477, 4580, 2421, 291, 107, 753, -128, -2796, -4207, -1258, 4407, 6693, 1880, -6096, -9496, -5226, 2446, 7058, 5927, 1253, -2910, -4230, -3300, -1906, -722, 771, 2491, 3026, 1214, -2068, -4408, -4305, -2564, -729, 1122, 3560, 5289, 3961, -46, -3224, -3383, -2105, -1454, -768, 1282, 3433, 3255, 894, -1134, -1581, -1492, -1492, -711, 791, 1110, -439, -1428, 385, 3299, 3641, 819, -2170, -3090, -2524, -1272, 1200, 4348, 5221, 1699, -4119, -7421, -5370, 341, 5258, 5995, 2652, -1808, -4339, -4135, -2287, 239, 2889, 4049, 1990, -1991, -4181, -3182, -1201, -43, 925, 2269, 3226, 3385, 2886, 1096, -2389, -5734, -6071, -2737, 1837, 4227, 2876, -446, -2347, -1472, 497, 1619, 1341, -588, -3874, -6079, -4533, 17, 4404, 6868, 7193, 4768, -95, -4442, -5472, -4000, -2531, -1241, 1256, 3989, 3990, 939, -1846, -2023, -756, 380, 1504, 2205, 948, -1612, -2294, -338, 733, -1194, -2636, 180, 4421, 4259, -113, -3031, -2402, -1813, -2978, -2576, 1344, 5129, 4573, 638, -2596, -3198, -2019, -32, 2019, 2483, 365, -2378, -2937, -1699, -1290, -1786, -371, 3461, 5919, 4039, 19, -2226, -2626, -3596, -4476, -1861, 3937, 7253, 4372, -962, -2760, -760, 766, -32, -1357, -2090, -2860, -3267, -1843, 1156, 3723, 4758, 4599, 3098, -501, -5234, -7835, -5990, -1341, 2373, 3911, 5061, 6316, 5087, 110, -5305, -7135, -5251, -1759, 2237, 5575, 6022, 3086, -836, -3752, -5598, -5957, -3720, 261, 3289, 4091, 3805, 3591, 2863, 161, -4507, -8259, -7463, -2165, 3208, 4920, 3751, 2469, 1860, 916, -978, -3406, -5045, -4121, -325, 3871, 5519, 4368, 2171, -364, -3680, -6575, -6159, -1950, 2326, 3067, 1059, -507, -150, 1636, 3589, 3462, -332, -5367, -6678, -2896, 2163, 4696, 4450, 2573, -603, -4180, -5666, -3429, 931, 4245, 5030, 3665, 326, -4753, -9026, -8436, -2008, 5954, 9791, 7789, 2606, -2347, -5232, -5365, -2958, 118, 1212, -115, -1094, 709, 3734, 4197, 876, -3739, -6387, -5373, -1270, 2953, 4205, 2961, 2380, 3050, 2227, -916, -3406, -3042, -1204, 40, 613, 1239, 1880, 2187, 2041, 1146, -810, -3194, -4417, -3387, -566, 2604, 4864, 5369, 3457, -516, -4037, -4240, -1795, -382, -941, -413, 1884, 2268, -96, -664, 2230, 3742, 797, -3060, -4265, -3861, -2941, 81, 5035, 7830, 5266, -755, -5490, -6424, -5035, -3841, -2794, 70, 4834, 8619, 8690, 4836, -1564, -8454, -12403, -9844, -1284, 7236, 9535, 5776, 1434, 82, -145, -2298, -5615, -6630, -3658, 1749, 6769, 8840, 6206, -400, -6533, -7271, -2675, 2090, 2879, 646, -1138, -695, 1253, 2778, 2154, -447, -2481, -1784, 349, 543, -2082, -4351, -2705, 2622, 7949, 9903, 7731, 2447, -4349, -10090, -11443, -6928, 994, 7670, 9880, 7370, 2111, -2739, -4407, -2812, -776, -560, -985, 116, 1528, 240, -2455, -1416, 3793, 6317, 1710, -4916, -6094, -1857, 2361, 3825, 3711, 2982, 1426, -214, -336, 1022, 1453, -877, -3974, -3563, 1142, 5334, 4283, -548, -3564, -2114, 1101, 2371, 1262, -20, 148, 1349, 1967, 677, -1938, -2895, -4, 4123, 4661, 1558, -703, -743, -1586, -3570, -2974, 841, 3569, 2813, 1199, 1401, 2371, 1414, -2373, -6753, -7819, -4015, 1726, 5519, 6635, 6027, 3385, -1316, -5689, -7124, -5331, -1417, 3127, 6041, 5737, 3295, 713, -1776, -4389, -5637, -4066, -509, 3059, 5172, 4665, 1240, -3127, -5389, -4375, -1211, 2500, 5340, 5781, 3117, -1263, -4484, -4467, -1716, 1144, 1880, 804, 20, 616, 1436, 963, -416, -1166, -1076, -1285, -1752, -1158, 127, -3, -1337, -619, 3225, 6255, 4238, -1958, -7708, -9628, -7390, -2248, 3739, 7718, 7848, 5026, 999, -3847, -8245, -8219, -2125, 4661, 5410, 895, -2327, -999, 2066, 3159, 1686, -711, -2481, -3202, -3045, -1719, 1066, 4021, 4858, 2921, -390, -3697, -6041, -5841, -2190, 2910, 5937, 5343, 2216, -1529, -4069, -4011, -1789, 24, -390, -1388, -44, 3152, 4539, 2686, 239, -638, -1028, -2259, -3780, -4759, -4372, -1057, 4726, 8461, 6551, 1528, -1678, -2588, -4197, -6844, -7058, -2422, 4967, 10214, 9619, 3364, -4244, -7517, -4427, 788, 2069, -1258, -3920, -1793, 2979, 5282, 3350, -194, -2247, -1865, -99, 447, -2432, -6303, -4920, 2649, 8077, 4554, -3027, -5319, -1634, 1251, 63, -1928, -1309, 1116, 2408, 1403, -59, 373, 2275, 2887, 1014, -1433, -2427, -2344, -2368, -1962, 442, 4551, 6999, 4187, -2928, -8122, -6261, 363, 4822, 3765, -205, -2925, -2156, 1517, 4240, 1820, -4200, -6788, -2420, 3942, 5778, 3192, 698, -187, -1690, -4289, -5040, -2190, 2013, 4606, 5148, 4377, 2240, -1210, -4787, -6955, -6458, -2592, 3392, 7659, 6766, 1614, -3231, -4553, -3292, -1916, -1054, -82, 885, 1483, 2175, 2975, 2294, -1018, -5172, -6749, -4432, 30, 4296, 6884, 6465, 2665, -2105, -4742, -5098, -4255, -1130, 4361, 7500, 4242, -2021, -5044, -4120, -2658, -1744, -197, 1693, 2522, 2033, 771, -959, -2654, -3429, -2725, -540, 2682, 5542, 5661, 1558, -4933, -8909, -6391, 1262, 7671, 7344, 1182, -4743, -5673, -2286, 1287, 2015, 330, -855, 609, 3396, 4017, 1372, -1683, -2207, -811, -113, -944, -1422, 488, 3968, 5381, 2405, -2197, -3124, 517, 3312, 639, -4374, -4612, 767, 4662, 2116, -2967, -4186, -1129, 1878, 1721, -1357, -4269, -3071, 2126, 5520, 3019, -1261, -993, 2567, 2717, -2338, -7021, -6352, -1667, 2864, 5517, 6532, 5399, 1684, -3058, -6492, -7251, -4532, 1406, 7106, 7536, 2120, -3412, -3679, -192, 1514, -220, -1955, -1449, -906, -2514, -4220, -2322, 3349, 8543, 8479, 2349, -5408, -8621, -5233, 478, 2746, 1037, -240, 1311, 3104, 2724, 1629, 1212, -215, -3261, -4629, -2084, 1448, 2210, 1079, 1493, 3735, 4270, 826, -3692, -4230, -520, 1875, -717, -4408, -3226, 2280, 6199, 5482, 2585, 473, -870, -2265, -2878, -1663, 505, 1715, 1226, -185, -1313, -1153, 364, 1560, 451, -2101, -2464, 1030, 5026, 4901, 711, -3020, -3324, -1969, -1787, -2266, -700, 3583, 7797, 8161, 3388, -3858, -9075, -9801, -6790, -1687, 4381, 9322, 9828, 4920, -1561, -4542, -3467, -1967, -2055, -2114, -1007, 65, 1016, 3668, 7190, 6993, 601, -8235, -12898, -9694, -499, 8387, 10706, 5618, -1535, -4924, -3889, -2101, -2082, -2220, 389, 5140, 7452, 3806, -3506, -8002, -5752, 395, 4248, 3282, 616, 29, 1196, 1124, -1277, -4025, -4841, -3190, 250, 3976, 5325, 2393, -2669, -4888, -2550, 429, 131, -1945, -1846, 460, 1387, -323, -2056, -2123, -1853, -1663, 291, 3528, 4177, 1026, -1998, -1890, -647, -853, -1340, -15, 1971, 1592, -1768, -5040, -4458, 483, 6206, 8258, 5107, -1143, -6625, -8005, -4699, 365, 3616, 4424, 4069, 2594, -105, -2043, -2031, -2251, -3768, -3226, 1310, 5527, 4687, 384, -2486, -1933, 515, 2185, 991, -2365, -3954, -1104, 3379, 4285, 703, -3133, -3698, -2174, -1573, -2092, -1296, 2101, 6440, 8614, 6424, 305, -6220, -8819, -6339, -1799, 1733, 4718, 8154, 8957, 3211, -6174, -10855, -7500, -1468, 1597, 2431, 4171, 6469, 6605, 3558, -1397, -6339, -9056, -7389, -1573, 4522, 6850, 5413, 3161, 1803, 899, -462, -2978, -6039, -6554, -2171, 4270, 7649, 6890, 3881, -1274, -8033, -11501, -7300, 1576, 7718, 7366, 2746, -1290, -1580, 356, 103, -3124, -4514, -909, 3693, 3727, 148, -1319, 1479, 4555, 3559, -1011, -5276, -6110, -2966, 1774, 3891, 1927, 46, 2007, 4471, 2278, -2520, -4012, -1881, -227, 63, 1078, 2708, 3264, 2805, 1842, -712, -4815, -6935, -3994, 1737, 5063, 4547, 3448, 3753, 3050, -802, -5096, -5850, -3898, -2790, -2028, 1450, 5818, 6060, 3038, 1998, 2307, -1323, -7550, -8814, -3238, 3149, 5731, 5272, 3647, 1682, 67, -1595, -4774, -8165, -6856, 971, 8824, 8453, 1064, -3593, -391, 4756, 4114, -1676, -6277, -6334, -3556, -581, 1668, 3230, 4042, 3969, 2935, 932, -1481, -3038, -3051, -2511, -2652, -2690, -465, 4393, 8951, 9205, 3881, -3913, -9088, -9027, -5577, -2238, 311, 4306, 9725, 11677, 6337, -2598, -8149, -9016, -8779, -8085, -4148, 3071, 9962, 13376, 11703, 4413, -5612, -12177, -11659, -6645, -1631, 2423, 6990, 11306, 11632, 5590, -4241, -11721, -11873, -4941, 3270, 6460, 4543, 2907, 3750, 2899, -2188, -6959, -6199, -1056, 3718, 5243, 3100, -1190, -3870, -1974, 2564, 4839, 2820, -1288, -4719, -6254, -5076, -627, 5244, 7949, 4233, -3275, -7736, -5576, -360, 2665, 3050, 2987, 2211, -99, -1636, -719, -626, -4323, -7905, -5306, 2554, 8800, 9327, 5831, 959, -4651, -9691, -10907, -6766, 326, 6763, 9925, 7810, 1082, -4610, -3992, 62, 47, -4769, -6927, -1869, 5418, 7278, 2928, -1800, -2385, -291, 471, -1027, -2475, -2371, -1203, 628, 2470, 1929, -1814, -4451, -1760, 3319, 4757, 2079, -1093, -3627, -5749, -5344, -1092, 4304, 7733, 8510, 6119, 238, -6218, -9066, -8063, -6169, -4379, -1061, 4252, 9391, 11632, 9576, 3484, -4713, -11607, -13611, -9314, -1050, 6502, 10080, 9838, 7315, 2840, -3318, -8485, -9091, -4822, 593, 3061, 1899, 222, 1251, 3587, 2415, -2809, -5844, -2447, 2909, 3933, 1416, -219, -884, -3125, -5568, -4217, 860, 5093, 5493, 3204, 7, -3415, -5073, -2401, 2790, 4712, 1262, -2955, -3402, -1197, 472, 1511, 3282, 4372, 1734, -4146, -8151, -6109, 3, 4573, 5287, 4601, 4297, 2521, -1912, -5778, -5114, -803, 2279, 1112, -2075, -2251, 2625, 8267, 7945, 499, -7582, -9499, -5382, -390, 2264, 3664, 5347, 5976, 3136, -2580, -7035, -6758, -2751, 986, 2366, 3122, 5265, 7142, 5103, -1073, -6759, -7586, -4245, -713, 966, 2061, 3783, 4928, 3761, 455, -3527, -6728, -7311, -3899, 1776, 5714, 6154, 4532, 2191, -278, -1602, -1753, -3015, -5195, -3688, 2976, 8317, 6051, -879, -4719, -3235, -829, -1025, -2181, -880, 3028, 5964, 4409, -1426, -7306, -8195, -2749, 4687, 7575, 3890, -1452, -2529, 250, 1523, -937, -3519, -2641, 684, 3236, 3287, 1214, -1142, -1998, -1881, -2534, -2912, -89, 4797, 6341, 2347, -2874, -4495, -2750, -856, -346, -293, 425, 1708, 2523, 1814, -578, -3297, -4260, -2653, 456, 3658, 5859, 5351, 874, -5223, -7639, -4012, 1677, 3636, 1064, -1489, -48, 4320, 7151, 5266, -548, -6445, -8647, -6418, -2065, 2116, 5679, 8148, 7491, 2766, -3016, -5487, -4266, -3029, -3701, -3709, -651, 3438, 5173, 4417, 2987, 1453, -266, -1686, -2901, -4324, -4646, -2186, 1693, 3858, 3862, 3792, 3841, 1610, -3374, -7497, -7189, -3004, 2144, 6294, 7869, 5049, -1153, -5975, -6161, -3460, -738, 1925, 4893, 6170, 3814, -912, -4974, -6763, -6321, -3730, 627, 4816, 6512, 5260, 2123, -1896, -5311, -5785, -2820, 782, 2358, 2494, 2682, 2073, -651, -3729, -4039, -1851, -198, 346, 1780, 3407, 2252, -670, -1187, 330, -497, -3384, -3183, 1001, 4009, 2723, -292, -1867, -1892, -1175, 606, 3419, 5312, 3924, -662, -5446, -7064, -4542, 158, 3869, 4802, 3558, 1337, -1572, -4191, -3750, 1008, 6693, 8105, 3523, -4107, -9577, -8567, -1111, 7088, 9366, 4915, -1084, -4042, -3942, -2598, -255, 3076, 5146, 3307, -1515, -5237, -5248, -2622, 387, 2825, 4387, 4256, 1791, -2112, -4971, -4665, -1733, 1179, 2603, 3258, 3422, 2154, 1, -993, -935, -1926, -3527, -2659, 1013, 3795, 3335, 1534, 602, -349, -2634, -4588, -3681, -390, 2782, 4680, 4982, 2251, -3518, -7699, -5079, 2680, 7800, 5622, -93, -2707, -981, 678, -1056, -4329, -5021, -1702, 3252, 6351, 5925, 2974, -257, -2680, -5006, -7358, -7224, -2134, 5571, 9664, 7031, 1247, -2477, -3430, -3984, -4299, -2209, 2065, 4993, 4544, 2718, 1755, 856, -1367, -3784, -4419, -3408, -2171, -946, 976, 3157, 3756, 1772, -1327, -2779, -1234, 1694, 2668, 193, -2980, -2657, 1133, 3733, 2117, -1356, -2932, -2142, -606, 1053, 2737, 3306, 1912, -263, -1651, -2675, -4289, -5072, -2756, 1582, 4136, 3512, 2159, 1973, 1543, -844, -3923, -5032, -3397, -172, 3281, 5329, 3948, -577, -4065, -2629, 2050, 4510, 2219, -2112, -4695, -4453, -2275, 1014, 4461, 6086, 4044, -1145, -6447, -8476, -5685, 725, 7110, 9366, 6142, 272, -3841, -4318, -2762, -1389, -340, 1499, 3700, 4022, 1507, -1790, -3408, -3235, -2283, -646, 1506, 2981, 3260, 2931, 1350, -2795, -7398, -7388, -1343, 5632, 7660, 4501, 629, -544, -136, -1338, -4261, -5174, -1963, 2373, 4108, 3696, 3310, 2618, 511, -1854, -2987, -3412, -3538, -2008, 1445, 4071, 3497, 1085, -363, -646, -1292, -1890, -672, 1594, 1981, 23, -1483, -902, 235, 294, -240, -275, 367, 1477, 2946, 4162, 3769, 836, -3541, -6353, -5473, -2219, 172, 540, 602, 1743, 3009, 2941, 1731, 454, -696, -2065, -3087, -2740, -1086, 1152, 3830, 6203, 5997, 2481, -1389, -3083, -4096, -5832, -5440, -414, 5805, 7583, 4196, -628, -4143, -6023, -5950, -3324, 673, 3404, 3729, 2914, 2198, 1406, 425, -176, -719, -2240, -3888, -2910, 1316, 5251, 5158, 1868, -476, -96, 391, -1507, -3870, -2982, 785, 2870, 689, -2850, -3299, -195, 3008, 3327, 947, -1836, -2746, -850, 2491, 4068, 2088, -1225, -2475, -1570, -501, 741, 2858, 3540, 229, -4338, -4714, -827, 1535, -658, -3352, -1972, 1836, 3606, 2534, 421, -2187, -4359, -3255, 1160, 4207, 3136, 939, 630, 1061, 742, 570, 912, 315, -1773, -4014, -4897, -3514, 241, 4554, 6132, 3533, -710, -2501, -674, 1555, 245, -4138, -6553, -3411, 2573, 5640, 4123, 1669, 1410, 1901, 184, -3357, -5395, -3939, -304, 2953, 4342, 3577, 1098, -1664, -2877, -2410, -2281, -3410, -3374, -7, 4136, 4587, 1437, -924, -247, 1294, 1197, -519, -2772, -4532, -3993, 245, 5956, 8073, 4653, -518, -3400, -4541, -5613, -5024, -1086, 3612, 4987, 2359, -1695, -3990, -2511, 1581, 3956, 1908, -2069, -3867, -2638, -90, 2213, 3064, 1960, 347, 11, 245, -841, -2828, -3266, -842, 3140, 5575, 3628, -2208, -7324, -7373, -3137, 1083, 3002, 3548, 3290, 1271, -1796, -2677, -174, 2077, 419, -2964, -2774, 1522, 4630, 3032, -197, -421, 1787, 2199, -519, -3459, -3980, -2355, -170, 1297, 1293, 204, -476, -205, -281, -1345, -1519, 926, 4132, 4266, 609, -3053, -3110, -715, 193, -1212, -1688, 521, 2764, 2538, 1255, 831, 469, -527, -1088, -1673, -4223, -7093, -5692, 285, 5767, 7364, 6411, 4463, 672, -5106, -9826, -9528, -3506, 4216, 8163, 6635, 2971, 1031, 714, -721, -3813, -5687, -4135, -621, 2290, 4154, 5110, 3799, -120, -3776, -4586, -3564, -2473, -713, 2142, 3803, 2345, -344, -842, 1242, 2823, 1134, -2885, -5283, -3340, 1289, 4452, 4112, 1934, 575, 722, 669, -1702, -5909, -8052, -5017, 990, 5010, 5601, 4900, 3993, 2334, -150, -3786, -8562, -10612, -5098, 5048, 10487, 7766, 2878, 1093, 991, -57, -1589, -2844, -4540, -6447, -6474, -2984, 3386, 9921, 13056, 10322, 2347, -6980, -12943, -13036, -7916, -15, 7878, 12799, 12078, 5401, -3745, -10051, -10507, -6293, -877, 2697, 3089, 1210, -183, 806, 2919, 3600, 2378, 542, -1326, -3274, -4556, -4263, -2405, 702, 4586, 7280, 6027, 770, -4580, -5997, -3634, -924, 34, 359, 1437, 2350, 1721, 388, 305, 1382, 1061, -2405, -6662, -6880, -2099, 2718, 4016, 4831, 7538, 7313, 453, -6988, -7730, -4090, -1881, -493, 2843, 5675, 4435, 453, -3048, -5044, -4901, -1474, 3408, 4805, 926, -3275, -1999, 3312, 5419, 871, -5387, -6315, -1073, 4590, 5051, 720, -2744, -1123, 3276, 4615, 936, -3740, -4958, -2955, -934, -180, 771, 2729, 4174, 3458, 872, -2085, -4072, -4237, -2558, -201, 1496, 2425, 3167, 3254, 1455, -1727, -3389, -1452, 2343, 4183, 2335, -1548, -4311, -3663, -52, 3258, 3534, 1535, -607, -2579, -4110, -2779, 2300, 6900, 6067, 553, -4586, -6249, -4940, -1653, 3097, 7134, 7112, 2747, -1900, -3200, -2067, -1665, -2926, -4028, -2834, 992, 5130, 6102, 3007, -1182, -3249, -3010, -1921, -733, 17, -562, -2025, -2000, 753, 3805, 3789, 1061, -915, -544, 548, 947, 802, 41, -1331, -1828, -674, 196, -540, -775, 1406, 4010, 3966, 1158, -2495, -5417, -5986, -2438, 4281, 9218, 7869, 1453, -4726, -7340, -6558, -3152, 1708, 5110, 5214, 3976, 3368, 1676, -2536, -6103, -5187, -897, 2610, 3459, 2667, 1383, 211, 3, 700, 149, -3144, -6532, -5665, -420, 4805, 6708, 5643, 2743, -1620, -5717, -6461, -3298, 403, 1752, 1820, 2509, 2505, -177, -3713, -4413, -1636, 2391, 5573, 6097, 2511, -3624, -7799, -7120, -2728, 2572, 6436, 7252, 4942, 1031, -3087, -6379, -6838, -3296, 1588, 3777, 2909, 1651, 1308, 1222, 798, -490, -2952, -4737, -2918, 1989, 5524, 4623, 916, -2203, -3294, -2751, -1111, 867, 1691, 514, -1286, -1486, 117, 1695, 2061, 1699, 1110, -249, -2824, -5420, -5410, -1357, 4124, 5904, 2256, -2590, -3712, -1153, 1683, 2832, 2513, 1211, -592, -2006, -2550, -2316, -924, 2198, 5942, 7292, 3985, -2825, -8858, -9951, -5474, 1382, 6599, 8057, 5651, 520, -4929, -7739, -6639, -3049, 715, 3443, 5034, 5586, 4891, 2346, -2243, -7224, -9456, -7186, -1858, 3566, 7108, 8215, 7010, 3978, -111, -4238, -7064, -7434, -5218, -1212, 3433, 6858, 6694, 2501, -2619, -4783, -3380, -887, 823, 1765, 1636, -454, -2770, -1268, 3976, 6679, 2863, -2702, -3636, -1209, -745, -2779, -3602, -1619, 1510, 3778, 4059, 2349, -46, -1986, -3417, -3787, -1958, 1118, 2798, 2455, 1493, 293, -1147, -1462, -540, -780, -2298, -1451, 2597, 5316, 3820, 752, -1112, -2453, -3889, -4031, -2433, -621, 517, 1528, 2548, 2921, 2538, 1802, 342, -2723, -6612, -8201, -5008, 1272, 5928, 6455, 4976, 4360, 3896, 1004, -4028, -7734, -7517, -3921, 905, 5067, 7229, 6590, 3198, -1885, -6654, -8754, -6971, -2439, 2126, 4728, 5307, 4577, 2641, -357, -3073, -4008, -3238, -1796, -183, 1280, 2009, 2258, 2834, 2832, 245, -4141, -6397, -4168, 592, 4216, 4751, 2837, 732, 101, 107, -1069, -2884, -2843, -311, 2469, 3071, 822, -3038, -5487, -3660, 1604, 5891, 6035, 2906, -1140, -4869, -7329, -6835, -2226, 5344, 11951, 12745, 6166, -3542, -9945, -10514, -7386, -3195, 938, 4097, 5286, 4447, 2014, -1735, -5416, -6050, -1893, 4658, 8276, 5388, -2006, -7481, -6296, -294, 4707, 5597, 3595, 380, -3481, -6300, -5434, -830, 4243, 6758, 6314, 3766, -314, -4894, -7674, -6630, -2281, 2503, 5183, 5290, 3496, 296, -3478, -5886, -5128, -1734, 1565, 2673, 2155, 1522, 605, -1135, -1744, 953, 4442, 3578, -1825, -6181, -5617, -1720, 2436, 5343, 5821, 2929, -2206, -6719, -7993, -4698, 2089, 8334, 9887, 6212, -11, -5338, -6581, -3045, 1080, 1066, -1213, -259, 3490, 4275, 596, -3162, -3853, -2101, 570, 2314, 1431, -642, -711, 547, -432, -3094, -2872, 1274, 5015, 4675, 1061, -2590, -3829, -2625, -976, -184, 742, 2577, 3790, 3122, 1815, 1095, 230, -1048, -1365, -602, -771, -2528, -3692, -2455, 332, 2870, 4274, 3976, 1333, -2768, -5298, -3923, 20, 3000, 3346, 2267, 1350, 821, 46, -1396, -2946, -2971, -430, 3307, 5463, 4519, 1029, -3242, -5912, -5182, -1810, 1282, 2306, 2138, 2057, 1783, 711, -401, -459, 30, -415, -1836, -2482, -1108, 1587, 3825, 4144, 2522, 871, 916, 1047, -1874, -6634, -7613, -2625, 3212, 4266, 1614, 100, 845, 765, -1475, -3272, -2458, -386, 782, 1126, 1741, 2661, 3403, 3723, 2798, -347, -4401, -5775, -2852, 1341, 2865, 2057, 2200, 3707, 3252, -637, -4546, -4606, -1677, 60, -1194, -2577, -547, 3988, 6289, 3743, -1024, -3896, -3581, -1097, 1850, 2896, 954, -1277, -588, 1612, 1877, 645, 356, 84, -2215, -4629, -3919, -1011, 731, 735, 903, 1667, 1594, 220, -1190, -1767, -2045, -2231, -1165, 1721, 4541, 4708, 2133, -548, -933, 477, 965, -863, -3027, -2956, -1299, -581, -931, -300, 1369, 1680, 47, -765, 1264, 3944, 3342, -1176, -5919, -6682, -2636, 3241, 6671, 5446, 1326, -1770, -1924, -648, 23, 47, 247, 554, 450, -54, -647, -1103, -1140, -716, -561, -1388, -2284, -1270, 1683, 3658, 2302, -938, -2777, -2064, -74, 1816, 2740, 1850, -614, -2446, -1665, 694, 1815, 974, 101, 217, -71, -1484, -2176, -726, 1120, 793, -1449, -2830, -1240, 2555, 5426, 4601, 395, -4137, -6100, -4573, -472, 3660, 4814, 2573, -32, -569, -289, -1183, -2197, -959, 2239, 4385, 3036, -1305, -5451, -6092, -2865, 1287, 3372, 3226, 2285, 666, -2306, -4956, -4004, 250, 3016, 1628, -501, 315, 2037, 714, -2598, -3181, 532, 4907, 5521, 1752, -2988, -4780, -2872, 211, 1850, 1520, 66, -1532, -2464, -2368, -1378, 508, 2880, 3717, 1484, -1399, -992, 1972, 2724, -366, -3824, -4557, -2845, 122, 3449, 5233, 3885, 1051, -6, 628, -650, -5056, -8430, -6460, -392, 5145, 7810, 7931, 5287, -528, -7005, -9509, -6164, -130, 3849, 4037, 2273, 1230, 1915, 2847, 1403, -2769, -6207, -5572, -1990, 1199, 3191, 4914, 5633, 3863, -39, -4476, -7663, -7150, -1838, 4576, 6147, 2031, -2107, -1447, 2144, 3343, 338, -3631, -4771, -2564, 858, 3319, 3886, 2871, 1418, 463, -466, -2506, -4979, -5215, -2254, 1129, 2301, 2510, 4004, 5703, 4816, 637, -5425, -10758, -11282, -4572, 5375, 10707, 8321, 2431, -1664, -2733, -2153, -1051, -388, -1137, -2452, -1864, 709, 2132, 1502, 2001, 4223, 3565, -1658, -6103, -5482, -1973, 1401, 4411, 5599, 2399, -3116, -5248, -2334, 1659, 2941, 1440, -719, -1636, -1085, -592, -1308, -2030, -724, 2189, 3832, 2551, -7, -1541, -1961, -1829, -322, 2346, 3101, 270, -2944, -2921, -679, 833, 1304, 1827, 2099, 1416, 153, -1220, -2497, -2445, 271, 3969, 4417, 291, -4120, -4233, -1071, 1287, 1870, 2358, 2553, 891, -1773, -2944, -2155, -765, 797, 2559, 2832, 3, -3646, -3649, 204, 2865, 972, -2783, -4012, -1802, 1989, 5170, 5476, 1773, -3402, -5336, -2803, 231, 436, -261, 1071, 2682, 1494, -792, -785, 357, -292, -1759, -1787, -1118, -740, 330, 1569, 809, -1028, -954, 303, -343, -1990, -916, 2503, 3800, 1499, -778, -409, 404, -841, -2616, -2641, -1794, -1253, 327, 3253, 4691, 3318, 1662, 1320, 356, -2665, -6011, -7138, -4857, 398, 6084, 8624, 6798, 2638, -1483, -4412, -5254, -3769, -1494, -117, 510, 1182, 1791, 2145, 2370, 1979, 661, -631, -1554, -3296, -5298, -4329, 295, 4556, 5441, 4574, 3857, 2092, -1742, -5680, -7012, -4943, -658, 3383, 4784, 3395, 1392, 352, -437, -1893, -2984, -2194, -111, 1370, 1867, 2290, 2290, 799, -1175, -1538, -796, -1314, -2806, -2059, 1954, 5736, 5466, 1381, -3518, -6750, -6479, -1746, 4315, 5550, 1074, -2368, -695, 1301, -1015, -4211, -3353, 331, 2957, 3166, 1251, -1533, -2356, 7, 2812, 3394, 2263, 274, -2414, -3728, -1697, 1275, 1777, 1020, 1521, 1522, -1404, -4704, -4129, 116, 4232, 5365, 3214, -484, -3011, -3000, -1858, -1437, -982, 1479, 4935, 5499, 1827, -2540, -4256, -3974, -2715, 552, 4591, 5066, 1450, -1485, -1473, -1177, -1671, -887, 1093, 2040, 2052, 2273, 1371, -1700, -4308, -3620, -746, 1345, 1548, 560, -482, -154, 2267, 4782, 3827, -775, -4275, -3122, -173, 14, -1436, -232, 3152, 3787, -158, -4944, -6291, -3535, 1031, 4590, 5516, 3991, 1329, -1253, -3103, -3884, -3480, -2035, 154, 2627, 4381, 4007, 1211, -1918, -2703, -1354, -844, -2426, -3344, -739, 3865, 6316, 5153, 2509, -127, -3765, -8249, -9867, -5362, 3176, 9800, 10412, 5721, -473, -4667, -5892, -5363, -4125, -1646, 2640, 7099, 8665, 6076, 1170, -3462, -6571, -7304, -4821, -527, 2188, 2402, 2611, 3699, 3183, 164, -2600, -3179, -2620, -1654, 539, 3339, 4218, 2242, -512, -1717, -1231, -379, -191, -885, -1946, -2106, -408, 2138, 3356, 2761, 1798, 1024, -508, -2585, -3299, -2262, -1660, -2341, -1495, 2700, 6468, 5084, 417, -1883, -1254, -1613, -3311, -2969, -193, 2216, 3267, 3527, 2182, -992, -3463, -3385, -2291, -1724, -405, 2463, 4023, 1399, -3043, -3864, 133, 4279, 4409, 1504, -1220, -2596, -3063, -2542, -850, 1052, 1861, 1434, 681, 358, 514, 778, 538, -851, -3188, -4693, -3265, 867, 4665, 5482, 3839, 1732, -469, -3368, -6082, -6896, -5207, -1143, 4629, 9221, 8883, 3686, -2248, -5938, -7446, -6827, -3452, 1526, 5579, 7365, 6623, 3070, -2240, -6145, -6217, -3385, -315, 1780, 3414, 4662, 4420, 2042, -1505, -4449, -5204, -3047, 726, 3227, 3274, 2602, 2163, 310, -3192, -5151, -3508, -257, 2109, 3280, 3085, 909, -1685, -1673, 798, 1791, -1029, -4974, -5894, -3158, 747, 3951, 5986, 5761, 1894, -4186, -8092, -6969, -2454, 2143, 5526, 7455, 6635, 2638, -1923, -4338, -5326, -6484, -6176, -1751, 5136, 9264, 7962, 3379, -1615, -6268, -9511, -8699, -3308, 3268, 7658, 9057, 7010, 1386, -4457, -5824, -3166, -1384, -2051, -1552, 2058, 5238, 3895, -834, -3953, -2758, 159, 804, -729, -1110, 540, 1558, 626, -673, -1731, -3491, -4651, -2493, 2112, 5377, 5892, 4822, 2278, -1924, -5424, -5422, -2491, 569, 2332, 3072, 2927, 1795, 261, -1159, -3116, -5755, -6569, -2747, 4256, 9427, 9579, 5459, -594, -5901, -7637, -5200, -1430, 903, 2217, 3782, 4544, 2697, -991, -3574, -3224, -800, 1485, 1826, -195, -2833, -3125, -509, 1715, 923, -755, -80, 1897, 2037, 511, -250, -337, -1787, -4050, -3916, -274, 4003, 5730, 4632, 2131, -735, -2835, -2763, -886, 379, -129, -686, 206, 1239, 690, -387, 166, 1717, 1260, -1940, -4563, -3388, 419, 3069, 3130, 2395, 2107, 1139, -1242, -3330, -3215, -1441, 1, 185, -152, 226, 1620, 2578, 1137, -2327, -4495, -2767, 1214, 3481, 2806, 1586, 1356, 401, -2556, -5083, -4126, -401, 2848, 3907, 3406, 2527, 1872, 1105, -821, -3896, -5736, -3882, 495, 3237, 2323, 369, 579, 2107, 1910, -396, -2492, -3010, -2249, -374, 2332, 4358, 4299, 2487, 243, -1461, -2354, -2993, -3993, -4135, -994, 4893, 8560, 5926, -723, -5348, -5602, -4603, -5008, -4771, -897, 5069, 8269, 6302, 1319, -3108, -4921, -3615, -62, 3055, 3060, 723, -269, 1430, 2661, 561, -3051, -4321, -2372, 415, 1762, 1496, 877, 819, 850, 117, -875, -843, -96, -526, -2579, -3878, -2020, 2167, 5390, 5567, 3691, 2002, 1263, 452, -1383, -3682, -4759, -3297, 442, 4525, 6432, 4688, -122, -5681, -9031, -7883, -2273, 4353, 7040, 3973, -1247, -3449, -1626, 669, 420, -1384, -1997, -780, 781, 1792, 2529, 2692, 1170, -1933, -4572, -4668, -2179, 949, 2758, 3206, 3450, 3188, 836, -2852, -4407, -2491, 95, 824, 337, -257, -1155, -1900, -1361, -133, 343, 725, 2472, 4229, 2999, -1140, -4416, -3960, -874, 1938, 3210, 3343, 2430, 160, -2594, -3989, -3428, -2092, -729, 1187, 3173, 3029, 274, -2156, -1887, -231, 660, 897, 1206, 1266, 1131, 1418, 1490, 274, -1371, -1840, -1395, -1031, -122, 2163, 4314, 3937, 1177, -1536, -2807, -3212, -2942, -1069, 1936, 3370, 1731, -814, -1414, -488, -326, -793, 358, 2884, 3355, 378, -2708, -2248, 1154, 4256, 5004, 3186, -482, -4378, -6479, -5785, -2777, 1174, 4254, 5022, 3373, 173, -3572, -6131, -5017, 246, 6197, 8226, 4816, -1749, -7414, -8467, -3873, 3133, 7301, 6214, 2061, -1464, -2701, -2412, -2006, -2054, -2052, -1170, 711, 2585, 3087, 1900, 165, -800, -970, -1263, -2015, -2387, -1396, 693, 2297, 2214, 1225, 956, 1312, 834, -377, -548, 422, 235, -1987, -3625, -2147, 1127, 3020, 2834, 2037, 666, -2306, -5291, -4910, -1062, 2600, 3665, 2854, 1224, -694, -1328, 635, 3428, 3665, 615, -2912, -3830, -1746, 1090, 2194, 1094, -746, -1925, -2244, -1914, -699, 1383, 3094, 2704, -21, -3167, -4421, -3059, -87, 2758, 3917, 2995, 1190, -94, -800, -1355, -1180, 282, 1965, 2355, 1529, 479, -667, -2189, -3357, -3109, -1761, -463, 840, 2982, 4939, 4066, -95, -4483, -6028, -4447, -1150, 2240, 4022, 3534, 2283, 1870, 1326, -1204, -4724, -5866, -3227, 930, 3732, 4501, 3758, 1517, -1754, -4085, -3908, -2067, -324, 1057, 2600, 3509, 2379, -263, -2035, -1699, -457, 238, 476, 795, 1047, 1056, 828, -40, -1485, -1938, -173, 2346, 3027, 1431, -685, -1843, -1833, -967, 365, 1618, 2224, 1767, -10, -2683, -4404, -2951, 1285, 4394, 2970, -1483, -4206, -2936, 163, 2090, 2092, 959, -539, -1658, -1632, -545, 585, 1185, 1745, 2492, 2186, -383, -3737, -4456, -1727, 933, 766, 89, 2022, 4504, 3311, -1223, -5168, -6250, -4263, 384, 5021, 5579, 1871, -1967, -3375, -3272, -2390, -486, 1576, 2784, 3301, 2611, -300, -3621, -3931, -1451, 449, 600, 413, 227, -405, -466, 932, 2556, 2960, 2205, 562, -1873, -3787, -3488, -1414, 490, 1738, 3344, 4872, 3933, -295, -5085, -7282, -6556, -3969, 184, 4811, 7011, 5407, 2210, -126, -1706, -2976, -2755, -473, 1993, 2435, 784, -1437, -2865, -2869, -1344, 1150, 3109, 2708, -378, -3842, -4639, -2301, 872, 2858, 3282, 2033, -732, -3118, -2901, -596, 1367, 2088, 2283, 1854, 55, -2555, -4429, -4578, -2520, 1879, 6850, 8467, 4356, -2637, -6725, -5593, -2523, -1266, -1108, 864, 4229, 5031, 1246, -4005, -5958, -3609, -152, 1515, 1917, 3022, 4760, 5089, 2853, -924, -4156, -4998, -2825, 801, 2916, 2044, -350, -1935, -1903, -919, -39, -30, -596, -369, 1360, 3382, 3831, 1976, -1584, -5244, -6642, -4197, 959, 5646, 7495, 6340, 3095, -1294, -5477, -7517, -6176, -2215, 2178, 5119, 5855, 4450, 1488, -1948, -4586, -5402, -3979, -1045, 1472, 1948, 831, 70, 587, 1245, 700, -614, -1132, -152, 1634, 3109, 3293, 1633, -1075, -2658, -1902, -383, -401, -1584, -1500, 381, 1509, -33, -2444, -2574, -346, 1298, 700, -348, 544, 2900, 4038, 2451, -685, -3062, -3232, -1298, 1373, 3105, 3244, 2435, 1342, -69, -1625, -2392, -1702, 16, 1590, 1748, -88, -2801, -4131, -3107, -1088, 225, 620, 788, 1209, 2040, 2932, 2944, 1594, -342, -1685, -1750, -232, 2364, 4221, 3855, 2056, 408, -1311, -4067, -6721, -6706, -3237, 1804, 5785, 6921, 4714, 204, -4210, -6008, -4133, 285, 4653, 6675, 5860, 3462, 1008, -953, -2683, -4133, -4440, -2759, 548, 3879, 5639, 5292, 3225, 125, -3086, -5067, -4635, -2017, 920, 2359, 2278, 1867, 1521, 601, -929, -2070, -2211, -1732, -1014, -11, 1146, 2095, 2714, 2891, 2170, 423, -1396, -1972, -1065, 187, 479, -370, -1373, -1521, -802, -20, 231, 144, 177, 239, -178, -1031, -1538, -1298, -881, -844, -807, -133, 1022, 1903, 1937, 993, -641, -2201, -2792, -2033, -367, 1146, 1528, 862, 290, 422, 439, -317, -955, -547, 201, 299, 215, 705, 1093, 261, -1478, -2735, -2608, -1198, 841, 2570, 3052, 2033, 341, -739, -663, -95, -82, -892, -1798, -1883, -913, 534, 1683, 2173, 2057, 1345, 8, -1537, -2381, -1889, -433, 757, 622, -626, -1438, -491, 1603, 2773, 1674, -1094, -3665, -4174, -2070, 1034, 2645, 2193, 1419, 1583, 2012, 1778, 874, -524, -2053, -2609, -1543, 141, 1207, 1677, 1756, 868, -1085, -3015, -3898, -3488, -1808, 615, 2442, 2783, 2153, 1309, 238, -1015, -1778, -1696, -1128, -293, 930, 2163, 2498, 1586, 104, -1004, -1362, -1149, -664, -102, 439, 972, 1533, 1943, 1753, 668, -1015, -2607, -3571, -3692, -2821, -934, 1430, 3228, 3701, 2979, 1742, 570, -188, -313, 143, 747, 1025, 917, 741, 721, 706, 356, -451, -1416, -2010, -1978, -1711, -1745, -1793, -907, 995, 2494, 2203, 421, -1379, -2158, -1883, -1024, -53, 797, 1570, 2241, 2392, 1581, 50, -1225, -1379, -507, 414, 530, -14, -381, -118, 374, 485, 108, -583, -1658, -3157, -4361, -4105, -2158, 276, 1819, 2171, 1749, 821, -340, -991, -540, 488, 1027, 951, 1041, 1336, 887, -386, -1182, -912, -732, -1523, -2420, -2334, -1569, -964, -547, 118, 964, 1381, 931, -61, -746, -728, -551, -725, -726, 238, 1697, 2126, 846, -1024, -1811, -1028, 408, 1378, 1546, 1247, 828, 302, -463, -1409, -2096, -1950, -909, 201, 342, -502, -1138, -544, 818, 1578, 1153, 236, -461, -1101, -1800, -1685, 126, 2901, 4710, 4529, 3094, 1534, 28, -1572, -2711, -2834, -2500, -2428, -2187, -1256, -371, -166, 143, 986, 1234, 380, -286, -119, -162, -760, -721, 455, 1897, 3079, 4041, 4232, 3095, 1354, 284, 177, 456, 660, 608, 179, -504, -1008, -1079, -967, -975, -872, -207, 898, 1750, 1863, 1338, 515, -223, -302, 750, 2636, 4297, 4916, 4561, 3648, 2267, 478, -1103, -1733, -1446, -957, -640, -174, 616, 1189, 958, 41, -1071, -2037, -2412, -1697, -247, 721, 678, 431, 677, 961, 732, 378, 460, 678, 354, -445, -855, -244, 984, 1815, 1747, 1163, 537, -142, -884, -1342, -1414, -1533, -1903, -2133, -2037, -2004, -2238, -2367, -2041, -1316, -447, 175, 177, -193, -44, 1004, 2104, 2138, 1047, -187, -670, -437, -261, -674, -1294, -1345, -778, -450, -1018, -2016, -2389, -1793, -884, -316, -33, 266, 516, 468, 67, -576, -1203, -1342, -742, 169, 707, 699, 438, 170, 6, 55, 238, 217, -181, -673, -805, -410, 217, 501, 71, -854, -1735, -2360, -2902, -3433, -3786, -3884, -3827, -3713, -3637, -3629, -3466, -2945, -2380, -2228, -2325, -2193, -1917, -1890, -1951, -1683, -1259, -1208, -1500, -1621, -1411, -1264, -1494, -1915, -2119, -1968, -1685, -1558, -1637, -1676, -1392, -809, -306, -158, -137, 184, 804, 1287, 1392, 1405, 1690, 2217, 2754, 3303, 4035, 4877, 5529, 5839, 5908, 5849, 5704, 5602, 5699, 5930, 6033, 5919, 5814, 5878, 5968, 5933, 5856, 5779, 5594, 5423, 5723, 6642, 7666, 8187, 8182, 8111, 8339, 8841, 9323, 9544, 9530, 9463, 9381, 9116, 8581, 8021, 7768, 7779, 7639, 7086, 6349, 5807, 5567, 5498, 5460, 5359, 5170, 4923, 4605, 4147, 3668, 3468, 3599, 3721, 3592, 3379, 3319, 3343, 3247, 2967, 2564, 2110, 1648, 1188, 681, 108, -447, -891, -1259, -1722, -2404, -3249, -4085, -4748, -5132, -5223, -5128, -5001, -4884, -4773, -4733, -4795, -4827, -4735, -4677, -4855, -5181, -5380, -5319, -5121, -5082, -5453, -6166, -6799, -7035, -7052, -7280, -7837, -8407, -8595, -8277, -7681, -7208, -7097, -7209, -7216, -6999, -6758, -6704, -6772, -6725, -6444, -5995, -5457, -4889, -4418, -4206, -4255, -4407, -4511, -4540, -4546, -4583, -4674, -4779, -4792, -4634, -4370, -4156, -4066, -4026, -3956, -3874, -3822, -3743, -3526, -3171, -2839, -2729, -2874, -3065, -3031, -2697, -2291, -2067, -1952, -1647, -1186, -1056, -1517, -2155, -2442, -2406, -2349, -2253, -1967, -1638, -1556, -1724, -1907, -1915, -1736, -1505, -1441, -1690, -2189, -2708, -2976, -2785, -2138, -1373, -1006, -1283, -1907, -2308, -2197, -1810, -1591, -1718, -1995, -2162, -2146, -2030, -1905, -1854, -1914, -1969, -1852, -1630, -1567, -1739, -1885, -1800, -1630, -1617, -1735, -1748, -1547, -1297, -1197, -1208, -1091, -723, -286, -57, -93, -253, -420, -538, -539, -364, -55, 258, 440, 431, 381, 550, 926, 1133, 916, 534, 403, 537, 661, 683, 761, 997, 1275, 1423, 1386, 1237, 1061, 873, 666, 479, 393, 432, 529, 608, 665, 728, 776, 743, 645, 547, 438, 267, 110, 95, 170, 179, 122, 116, 135, 58, -118, -302, -448, -565, -666, -748, -744, -548, -273, -232, -476, -582, -197, 436, 792, 670, 304, -2, -150, -220, -329, -502, -683, -879, -1195, -1665, -2145, -2437, -2465, -2351, -2367, -2706, -3235, -3589, -3592, -3419, -3276, -3163, -3004, -2713, -2196, -1534, -1037, -844, -758, -756, -1188, -2154, -3151, -3671, -3702, -3525, -3464, -3770, -4277, -4443, -4110, -3778, -3743, -3621, -3073, -2348, -1785, -1395, -1132, -1025, -967, -811, -669, -748, -945, -961, -789, -749, -986, -1255, -1324, -1268, -1193, -1049, -902, -1036, -1494, -1897, -1921, -1657, -1360, -1178, -1378, -2448, -4478, -6679, -8125, -8778, -9129, -9138, -8465, -7322, -6006, -4099, -1223, 1921, 4297, 5723, 6521, 6820, 6866, 7185, 7814, 8064, 7555, 6892, 6792, 7066, 6976, 6332, 5661, 5361, 5332, 5448, 5775, 6381, 7305, 8688, 10457, 12217, 13775, 15295, 16751, 17766, 18196, 18345, 18532, 18901, 19547, 20416, 21204, 21754, 22342, 23178, 23817, 23610, 22664, 21739, 21106, 20203, 18756, 17342, 16470, 15917, 15480, 15460, 16002, 16765, 17506, 18263, 18907, 19222, 19334, 19510, 19717, 19748, 19598, 19317, 18824, 18061, 17131, 16100, 14822, 13169, 11272, 9343, 7435, 5618, 4208, 3365, 2754, 2113, 1722, 1761, 1862, 1798, 1920, 2279, 2251, 1503, 538, -165, -736, -1335, -1785, -1973, -2156, -2569, -3104, -3581, -4083, -4850, -5981, -7376, -8835, -10080, -10927, -11557, -12278, -12910, -13005, -12634, -12309, -12126, -11750, -11207, -10870, -10753, -10507, -10013, -9395, -8671, -7847, -7153, -6774, -6583, -6422, -6464, -6986, -7811, -8473, -8853, -9304, -10004, -10583, -10608, -10088, -9322, -8506, -7683, -6853, -5999, -5097, -4175, -3334, -2586, -1842, -1123, -608, -322, -13, 438, 839, 1052, 1160, 1107, 741, 251, -33, -281, -867, -1621, -2046, -2112, -2173, -2295, -2282, -2165, -2170, -2306, -2385, -2374, -2446, -2661, -2884, -3014, -3093, -3123, -3061, -3040, -3255, -3664, -4101, -4653, -5508, -6574, -7607, -8566, -9504, -10343, -10975, -11429, -11743, -11898, -11941, -11985, -12006, -11902, -11716, -11667, -11865, -12154, -12314, -12302, -12250, -12282, -12449, -12753, -13121, -13403, -13537, -13657, -13900, -14232, -14484, -14563, -14524, -14458, -14372, -14180, -13800, -13267, -12715, -12271, -11943, -11667, -11432, -11238, -10986, -10482, -9664, -8773, -8096, -7614, -7016, -6190, -5410, -4931, -4592, -4111, -3537, -3075, -2709, -2322, -1966, -1727, -1441, -889, -86, 743, 1352, 1628, 1713, 1961, 2532, 3147, 3422, 3426, 3623, 4269, 5054, 5488, 5520, 5572, 5937, 6389, 6584, 6599, 6729, 6870, 6598, 5874, 5258, 5206, 5496, 5562, 5178, 4590, 4137, 3930, 3877, 3812, 3546, 2934, 2123, 1577, 1590, 1793, 1546, 847, 380, 546, 905, 851, 393, -33, -256, -466, -802, -1159, -1440, -1771, -2318, -3014, -3591, -3869, -3942, -4088, -4455, -4888, -5121, -5153, -5224, -5406, -5504, -5408, -5245, -5095, -4839, -4399, -3903, -3572, -3507, -3579, -3508, -3180, -2870, -2935, -3318, -3599, -3539, -3278, -3018, -2776, -2525, -2330, -2198, -1993, -1624, -1231, -1020, -957, -815, -500, -122, 256, 735, 1334, 1839, 2054, 2109, 2307, 2693, 2981, 2954, 2757, 2664, 2724, 2823, 2957, 3189, 3395, 3398, 3308, 3440, 3890, 4413, 4692, 4579, 4226, 4031, 4284, 4779, 5045, 4963, 4829, 4847, 4911, 4904, 4900, 4988, 5073, 4916, 4389, 3662, 3065, 2674, 2225, 1536, 829, 435, 389, 508, 739, 1150, 1641, 1998, 2285, 2777, 3366, 3529, 3083, 2477, 2069, 1644, 969, 240, -343, -934, -1662, -2325, -2714, -2928, -3227, -3697, -4115, -4183, -3935, -3742, -3734, -3542, -2955, -2408, -2392, -2755, -3059, -3292, -3817, -4900, -6528, -8353, -9787, -10472, -10556, -10174, -9021, -6801, -3779, -555, 2491, 5183, 7348, 8850, 9658, 9825, 9535, 9068, 8548, 7961, 7436, 7346, 7866, 8686, 9356, 9789, 10215, 10755, 11294, 11808, 12491, 13472, 14723, 16235, 18037, 19964, 21666, 22990, 23991, 24655, 24815, 24499, 24084, 23924, 24020, 24103, 24092, 24280, 24949, 25861, 26460, 26572, 26419, 25970, 24835, 23009, 21069, 19525, 18403, 17551, 16859, 16292, 16048, 16470, 17454, 18375, 18866, 19160, 19443, 19467, 18964, 17990, 16701, 15199, 13613, 12088, 10641, 9163, 7569, 5803, 3886, 1993, 414, -753, -1773, -2890, -3874, -4304, -4202, -3969, -3701, -3173, -2486, -2153, -2462, -3235, -4232, -5397, -6634, -7777, -8781, -9740, -10635, -11249, -11439, -11369, -11359, -11553, -11871, -12212, -12591, -13035, -13464, -13713, -13652, -13275, -12688, -12000, -11244, -10381, -9436, -8533, -7830, -7364, -7000, -6556, -5972, -5360, -4880, -4595, -4435, -4274, -4034, -3745, -3555, -3621, -3958, -4337, -4465, -4257, -3865, -3359, -2615, -1548, -314, 898, 2094, 3350, 4559, 5464, 5924, 6040, 5993, 5850, 5573, 5137, 4595, 4071, 3678, 3410, 3149, 2823, 2462, 2069, 1587, 1081, 728, 533, 243, -257, -683, -731, -556, -628, -1101, -1678, -2146, -2701, -3558, -4560, -5400, -6052, -6750, -7615, -8519, -9241, -9748, -10248, -10968, -11887, -12810, -13661, -14526, -15423, -16219, -16817, -17292, -17723, -18043, -18111, -17915, -17638, -17485, -17493, -17539, -17538, -17541, -17648, -17857, -18110, -18394, -18747, -19110, -19330, -19332, -19206, -19047, -18797, -18375, -17830, -17264, -16677, -16031, -15331, -14545, -13629, -12639, -11758, -11066, -10460, -9824, -9173, -8620, -8252, -8045, -7868, -7559, -7044, -6376, -5622, -4798, -3909, -2998, -2154, -1407, -708, -12, 616, 1038, 1211, 1312, 1618, 2188, 2772, 3126, 3412, 3990, 4833, 5493, 5692, 5600, 5471, 5354, 5253, 5268, 5385, 5374, 5088, 4693, 4489, 4539, 4613, 4502, 4264, 4052, 3788, 3299, 2704, 2335, 2223, 2046, 1674, 1306, 1070, 869, 657, 441, 100, -466, -1138, -1814, -2555, -3300, -3786, -3954, -4068, -4278, -4415, -4302, -3997, -3643, -3322, -3151, -3286, -3739, -4283, -4691, -4973, -5289, -5671, -5976, -6085, -5998, -5749, -5369, -4948, -4616, -4397, -4202, -4001, -3862, -3747, -3490, -3073, -2734, -2608, -2495, -2140, -1568, -991, -530, -207, -50, -41, -10, 258, 764, 1275, 1611, 1832, 2130, 2602, 3172, 3658, 3898, 3913, 3890, 3977, 4180, 4444, 4703, 4868, 4948, 5102, 5418, 5767, 6038, 6262, 6385, 6238, 5870, 5579, 5482, 5402, 5204, 4909, 4493, 3929, 3476, 3530, 4041, 4420, 4328, 4118, 4177, 4253, 3939, 3442, 3210, 3168, 2929, 2481, 2132, 1944, 1710, 1316, 799, 222, -280, -529, -615, -974, -1729, -2274, -2055, -1526, -1556, -1949, -1527, 18, 1317, 1120, 160, 62, 901, 1280, 577, -461, -1292, -2142, -2951, -3229, -3032, -2910, -2940, -2726, -2200, -1644, -1132, -645, -526, -1124, -1977, -2106, -1305, -478, -434, -1036, -1861, -2863, -3916, -4422, -4116, -3750, -4162, -4875, -4384, -1874, 2061, 6379, 10457, 13917, 16493, 18291, 19514, 19922, 19149, 17322, 14922, 12400, 10268, 9063, 8832, 9167, 9868, 11040, 12676, 14621, 16827, 19061, 20689, 21302, 21416, 22049, 23538, 25221, 26283, 26702, 27122, 27877, 28495, 28367, 27531, 26476, 25408, 24195, 22952, 22080, 21725, 21511, 21182, 20981, 21141, 21314, 21006, 20328, 19624, 18716, 17291, 15709, 14612, 14078, 13942, 14284, 15013, 15604, 15885, 16146, 16340, 16016, 15091, 13749, 11867, 9347, 6646, 4212, 1925, -301, -2079, -3200, -4097, -5171, -6144, -6559, -6546, -6524, -6464, -6096, -5598, -5315, -5005, -4291, -3584, -3552, -4042, -4534, -5158, -6276, -7764, -9393, -11211, -12974, -14109, -14555, -14845, -15165, -15169, -14693, -13961, -13101, -12032, -10844, -9833, -9121, -8517, -7852, -7195, -6623, -6048, -5433, -4914, -4547, -4186, -3767, -3409, -3148, -2941, -2882, -3073, -3330, -3377, -3240, -3157, -3209, -3288, -3225, -2903, -2349, -1757, -1280, -836, -274, 418, 1200, 2111, 3147, 4150, 4958, 5564, 6030, 6322, 6324, 5965, 5254, 4212, 2868, 1341, -141, -1355, -2228, -2837, -3294, -3642, -3849, -3844, -3601, -3223, -2907, -2783, -2777, -2734, -2662, -2727, -3048, -3564, -4159, -4827, -5702, -6875, -8232, -9523, -10617, -11649, -12807, -14008, -14927, -15371, -15539, -15805, -16271, -16724, -16963, -17024, -17078, -17213, -17433, -17677, -17897, -18089, -18241, -18275, -18114, -17844, -17636, -17521, -17378, -17185, -17096, -17202, -17391, -17506, -17559, -17673, -17876, -18039, -18047, -17883, -17558, -17064, -16375, -15442, -14310, -13202, -12268, -11315, -10110, -8855, -7907, -7204, -6466, -5788, -5514, -5689, -6065, -6440, -6648, -6516, -6057, -5510, -5000, -4380, -3484, -2330, -1045, 225, 1277, 1929, 2283, 2681, 3221, 3596, 3653, 3711, 3994, 4230, 4249, 4288, 4409, 4292, 3930, 3709, 3663, 3479, 3202, 3172, 3355, 3470, 3549, 3795, 4117, 4268, 4195, 3969, 3641, 3284, 2956, 2562, 1976, 1312, 856, 659, 463, 143, -62, -24, -85, -581, -1287, -1776, -2063, -2475, -3131, -3870, -4499, -4873, -4925, -4753, -4518, -4207, -3703, -3129, -2848, -2988, -3185, -3068, -2807, -2871, -3366, -3943, -4283, -4327, -4169, -3989, -3970, -4091, -4127, -3991, -3831, -3723, -3509, -3080, -2587, -2197, -1793, -1118, -161, 803, 1509, 1858, 1869, 1687, 1560, 1577, 1544, 1311, 1008, 813, 825, 1190, 1966, 2852, 3483, 3906, 4338, 4709, 4881, 4936, 4942, 4810, 4620, 4605, 4705, 4688, 4669, 4950, 5404, 5596, 5461, 5359, 5454, 5475, 5203, 4812, 4530, 4328, 4178, 4225, 4411, 4391, 4092, 3868, 3831, 3602, 2960, 2182, 1557, 1091, 777, 700, 759, 730, 680, 963, 1677, 2393, 2609, 2220, 1408, 371, -623, -1279, -1684, -2298, -3221, -3815, -3498, -2567, -1787, -1411, -1091, -661, -425, -604, -1007, -1473, -2166, -3101, -3752, -3626, -3025, -2634, -2507, -2153, -1615, -1456, -1643, -1513, -1062, -1164, -2075, -2816, -2534, -1645, -1051, -920, -928, -1121, -1696, -2298, -2496, -2759, -3923, -5734, -6923, -6619, -4912, -2226, 1005, 4299, 7450, 10756, 14502, 18338, 21324, 22530, 21712, 19581, 17239, 15169, 13102, 10873, 8895, 7685, 7386, 7981, 9542, 11907, 14458, 16605, 18384, 20176, 21960, 23404, 24519, 25675, 26926, 27869, 28339, 28642, 28920, 28814, 28024, 26819, 25597, 24293, 22641, 20880, 19592, 18957, 18667, 18587, 18937, 19721, 20440, 20673, 20539, 20320, 19942, 19203, 18295, 17547, 16895, 16001, 14952, 14287, 14215, 14273, 13927, 13218, 12535, 11922, 10963, 9377, 7410, 5438, 3492, 1447, -540, -2250, -3764, -5143, -6055, -6254, -6079, -5961, -5736, -5077, -4232, -3740, -3603, -3367, -2925, -2728, -3117, -3925, -4911, -6147, -7715, -9433, -11116, -12792, -14429, -15814, -16805, -17366, -17381, -16767, -15710, -14462, -12975, -11097, -9053, -7368, -6236, -5332, -4444, -3898, -4069, -4779, -5530, -6079, -6481, -6846, -7270, -7747, -8033, -7879, -7411, -6960, -6633, -6301, -5887, -5374, -4664, -3696, -2584, -1506, -512, 428, 1298, 2020, 2560, 2964, 3280, 3468, 3450, 3243, 3006, 2936, 3041, 3037, 2629, 1900, 1189, 603, -86, -985, -1889, -2600, -3095, -3308, -3101, -2502, -1716, -898, -107, 579, 1067, 1306, 1279, 968, 367, -533, -1759, -3265, -4866, -6350, -7672, -8936, -10228, -11477, -12512, -13213, -13561, -13658, -13666, -13686, -13615, -13286, -12722, -12191, -11948, -12019, -12293, -12676, -13133, -13687, -14377, -15190, -16034, -16807, -17509, -18175, -18719, -18993, -18999, -18936, -18885, -18727, -18383, -17974, -17594, -17168, -16687, -16288, -15995, -15638, -15097, -14437, -13773, -13160, -12604, -12039, -11309, -10384, -9563, -9242, -9352, -9371, -9088, -8898, -9061, -9275, -9295, -9280, -9240, -8895, -8202, -7321, -6143, -4661, -3372, -2525, -1564, -96, 1312, 2083, 2503, 3061, 3566, 3620, 3346, 3127, 2982, 2703, 2360, 2153, 1980, 1753, 1818, 2326, 2689, 2551, 2616, 3474, 4456, 4757, 4761, 5159, 5705, 5835, 5673, 5651, 5774, 5770, 5488, 4885, 4041, 3300, 3016, 2987, 2603, 1777, 1200, 1222, 1204, 630, 0, -167, -289, -820, -1400, -1611, -1646, -1700, -1598, -1352, -1241, -1215, -980, -626, -558, -842, -1183, -1489, -1957, -2587, -3090, -3429, -3915, -4524, -4805, -4714, -4789, -5172, -5337, -5056, -4778, -4778, -4782, -4559, -4206, -3758, -3134, -2428, -1864, -1446, -997, -501, -145, -56, -202, -560, -1147, -1826, -2274, -2343, -2249, -2220, -2109, -1602, -696, 280, 1096, 1801, 2442, 2886, 3032, 3021, 3043, 3072, 2972, 2767, 2646, 2732, 3000, 3410, 3902, 4283, 4319, 4012, 3609, 3322, 3204, 3213, 3211, 3010, 2653, 2473, 2734, 3352, 4052, 4545, 4563, 4072, 3492, 3328, 3526, 3512, 2976, 2315, 2080, 2282, 2512, 2572, 2559, 2449, 2055, 1383, 685, 165, -176, -478, -895, -1373, -1521, -1000, -45, 732, 1070, 1240, 1524, 1797, 1657, 883, -263, -1214, -1694, -2010, -2575, -3289, -3686, -3553, -3116, -2665, -2311, -2060, -1970, -2091, -2327, -2405, -2108, -1560, -1208, -1363, -1846, -2201, -2294, -2514, -3314, -4684, -6203, -7443, -8145, -8141, -7337, -5730, -3332, -73, 3994, 8410, 12444, 15595, 17690, 18485, 17718, 15730, 13306, 10715, 7768, 4863, 2932, 2268, 2524, 3697, 5947, 8750, 11384, 13917, 16644, 19172, 20903, 21937, 22778, 23625, 24437, 25297, 26258, 27115, 27471, 27087, 26029, 24596, 23116, 21722, 20290, 18730, 17335, 16657, 16843, 17521, 18490, 19940, 21825, 23582, 24816, 25642, 26174, 26175, 25459, 24202, 22709, 21171, 19746, 18540, 17472, 16371, 15261, 14414, 13975, 13716, 13264, 12543, 11721, 10819, 9653, 8220, 6862, 5824, 4913, 3875, 2891, 2335, 2218, 2252, 2284, 2381, 2533, 2622, 2559, 2290, 1728, 806, -425, -1832, -3353, -5011, -6808, -8654, -10416, -11978, -13221, -14065, -14481, -14445, -13954, -13189, -12370, -11430, -10167, -8727, -7553, -6802, -6309, -6102, -6424, -7248, -8278, -9412, -10780, -12346, -13804, -14909, -15653, -16089, -16169, -15838, -15139, -14178, -12969, -11458, -9731, -8063, -6664, -5488, -4429, -3555, -2978, -2688, -2659, -2983, -3654, -4393, -4915, -5208, -5427, -5624, -5732, -5647, -5286, -4635, -3847, -3164, -2696, -2323, -1923, -1548, -1229, -830, -294, 165, 422, 701, 1198, 1668, 1781, 1602, 1424, 1308, 1070, 539, -289, -1240, -2049, -2606, -3093, -3747, -4519, -5117, -5366, -5369, -5295, -5162, -4929, -4623, -4265, -3807, -3317, -3034, -3097, -3436, -3960, -4663, -5503, -6418, -7480, -8771, -10158, -11384, -12337, -13064, -13637, -14088, -14333, -14220, -13729, -13089, -12534, -12050, -11522, -11033, -10770, -10783, -10988, -11374, -12012, -12815, -13548, -14062, -14438, -14759, -14970, -15038, -14988, -14762, -14324, -13877, -13618, -13397, -12956, -12375, -11928, -11659, -11419, -11155, -10877, -10518, -10056, -9623, -9323, -9038, -8588, -7966, -7348, -6864, -6475, -6101, -5732, -5425, -5236, -5154, -5066, -4854, -4574, -4370, -4166, -3709, -2995, -2362, -1999, -1658, -1051, -303, 240, 528, 824, 1271, 1754, 2195, 2654, 3081, 3291, 3256, 3145, 3061, 2982, 2874, 2687, 2355, 1982, 1885, 2214, 2706, 3014, 3161, 3441, 3899, 4255, 4358, 4361, 4352, 4174, 3778, 3379, 3139, 3004, 2898, 2799, 2663, 2530, 2551, 2718, 2775, 2582, 2299, 2087, 1871, 1514, 1017, 472, -6, -310, -422, -461, -561, -738, -917, -1031, -1082, -1125, -1216, -1355, -1493, -1590, -1604, -1471, -1211, -1018, -1048, -1218, -1367, -1530, -1857, -2319, -2737, -3009, -3184, -3300, -3277, -2996, -2443, -1771, -1210, -857, -597, -283, 40, 170, 63, -74, -102, -142, -261, -271, -97, -17, -208, -440, -490, -463, -458, -371, -184, -36, 95, 398, 875, 1319, 1604, 1735, 1719, 1579, 1402, 1254, 1104, 910, 688, 520, 525, 763, 1120, 1376, 1438, 1441, 1575, 1861, 2131, 2182, 1983, 1729, 1636, 1694, 1664, 1408, 1118, 1115, 1418, 1726, 1851, 1911, 2004, 2061, 2126, 2391, 2749, 2771, 2308, 1754, 1514, 1551, 1612, 1570, 1438, 1243, 1074, 1115, 1459, 1934, 2229, 2196, 1959, 1769, 1798, 1988, 2036, 1723, 1251, 958, 775, 354, -363, -1155, -1961, -2826, -3566, -3910, -3772, -3041, -1452, 1061, 4106, 7230, 10333, 13438, 16187, 17891, 18045, 16588, 13779, 10246, 6898, 4212, 1867, -281, -1376, -577, 1769, 4840, 8377, 12124, 15304, 17502, 19187, 20739, 21922, 22495, 22486, 21945, 21154, 20758, 20944, 21111, 20730, 19798, 18318, 16283, 14340, 13439, 13614, 13999, 14185, 14851, 16649, 19171, 21569, 23586, 25314, 26452, 26668, 26219, 25371, 23793, 21393, 18905, 16969, 15470, 14278, 13639, 13488, 13348, 13160, 13328, 13898, 14393, 14487, 14229, 13674, 12808, 11851, 11124, 10488, 9496, 8248, 7466, 7318, 7125, 6532, 5946, 5538, 4939, 4165, 3654, 3322, 2680, 1754, 910, 121, -765, -1569, -2201, -3015, -4209, -5456, -6434, -7248, -8017, -8527, -8547, -8216, -7784, -7198, -6338, -5474, -5049, -5100, -5402, -5980, -7045, -8530, -10144, -11721, -13182, -14392, -15241, -15684, -15611, -14982, -14045, -13152, -12393, -11644, -10889, -10253, -9768, -9340, -8969, -8789, -8863, -9071, -9327, -9716, -10330, -11110, -11967, -12853, -13599, -13949, -13821, -13371, -12716, -11758, -10412, -8876, -7508, -6513, -5861, -5496, -5446, -5716, -6207, -6758, -7191, -7387, -7380, -7291, -7126, -6850, -6609, -6597, -6729, -6709, -6493, -6342, -6384, -6383, -6099, -5601, -5083, -4565, -4040, -3700, -3691, -3817, -3809, -3752, -3871, -4125, -4311, -4390, -4411, -4316, -4098, -4004, -4295, -4864, -5331, -5504, -5562, -5759, -6106, -6406, -6484, -6279, -5822, -5251, -4758, -4444, -4234, -4003, -3752, -3622, -3757, -4209, -4922, -5727, -6429, -6988, -7570, -8291, -8994, -9391, -9381, -9090, -8673, -8210, -7743, -7301, -6863, -6422, -6024, -5803, -5857, -6135, -6477, -6775, -7088, -7534, -8107, -8646, -8990, -9104, -9061, -8945, -8781, -8547, -8210, -7773, -7275, -6773, -6336, -6024, -5829, -5693, -5604, -5613, -5739, -5899, -6002, -6026, -6020, -6074, -6251, -6461, -6478, -6166, -5672, -5249, -4932, -4513, -3873, -3137, -2492, -1965, -1516, -1197, -1058, -1034, -1074, -1218, -1448, -1651, -1771, -1825, -1739, -1417, -940, -464, -3, 515, 1047, 1477, 1795, 2076, 2325, 2491, 2573, 2616, 2657, 2714, 2835, 3040, 3230, 3282, 3234, 3230, 3281, 3265, 3125, 2966, 2902, 2935, 3009, 3085, 3180, 3328, 3502, 3584, 3479, 3251, 3055, 2922, 2708, 2333, 1956, 1805, 1885, 2015, 2097, 2193, 2339, 2448, 2429, 2268, 1986, 1605, 1166, 707, 254, -174, -532, -775, -873, -814, -624, -396, -270, -291, -332, -247, -83, -13, -127, -370, -637, -809, -863, -993, -1397, -1894, -2081, -1928, -1824, -1977, -2142, -2064, -1857, -1779, -1854, -1918, -1908, -1914, -1998, -2096, -2120, -2034, -1865, -1702, -1604, -1473, -1180, -865, -829, -1081, -1308, -1319, -1243, -1248, -1378, -1632, -1941, -2105, -1987, -1744, -1655, -1761, -1824, -1619, -1166, -664, -270, 31, 334, 666, 950, 1064, 915, 503, -24, -448, -640, -660, -647, -626, -487, -190, 157, 516, 981, 1453, 1571, 1282, 1092, 1350, 1680, 1612, 1351, 1434, 1929, 2449, 2714, 2767, 2750, 2727, 2697, 2659, 2622, 2614, 2643, 2642, 2522, 2391, 2486, 2744, 2765, 2455, 2197, 2143, 1933, 1414, 958, 776, 641, 531, 835, 1731, 2971, 4403, 6162, 8198, 10089, 11526, 12594, 13360, 13539, 12911, 11704, 10205, 8431, 6549, 5098, 4347, 4057, 4147, 4902, 6277, 7809, 9328, 11064, 12946, 14542, 15772, 17006, 18392, 19574, 20233, 20518, 20686, 20608, 19966, 18752, 17267, 15707, 14122, 12633, 11453, 10766, 10701, 11297, 12460, 14035, 15934, 18011, 19968, 21589, 22844, 23646, 23784, 23240, 22242, 20970, 19382, 17498, 15564, 13850, 12424, 11221, 10223, 9554, 9367, 9586, 9973, 10458, 11215, 12210, 13087, 13642, 14029, 14288, 14119, 13381, 12323, 11154, 9776, 8146, 6488, 4953, 3435, 1920, 761, 240, 112, -44, -209, -89, 306, 732, 1128, 1468, 1546, 1306, 966, 562, -148, -1139, -2096, -2997, -4099, -5310, -6204, -6663, -7003, -7464, -7898, -8072, -7985, -7866, -7927, -8175, -8443, -8589, -8655, -8805, -9103, -9387, -9490, -9497, -9611, -9835, -10001, -10067, -10171, -10352, -10467, -10412, -10298, -10328, -10561, -10864, -11067, -11167, -11324, -11634, -12003, -12267, -12334, -12204, -11917, -11548, -11133, -10628, -10044, -9528, -9215, -9075, -9025, -9092, -9291, -9521, -9697, -9858, -10049, -10188, -10170, -10039, -9946, -9950, -9969, -9907, -9735, -9470, -9171, -8913, -8658, -8249, -7683, -7197, -6891, -6590, -6224, -6041, -6202, -6499, -6711, -6958, -7444, -8061, -8495, -8626, -8608, -8588, -8534, -8346, -7949, -7317, -6572, -5962, -5549, -5102, -4511, -4054, -3986, -4125, -4157, -4131, -4314, -4716, -5102, -5364, -5639, -6018, -6393, -6644, -6780, -6812, -6677, -6374, -5969, -5465, -4825, -4151, -3600, -3177, -2776, -2424, -2285, -2434, -2769, -3152, -3535, -3938, -4367, -4798, -5186, -5466, -5580, -5524, -5332, -5028, -4642, -4232, -3801, -3267, -2638, -2122, -1903, -1883, -1842, -1767, -1858, -2198, -2620, -2941, -3183, -3442, -3693, -3855, -3941, -4003, -4022, -3950, -3787, -3534, -3183, -2784, -2430, -2127, -1781, -1376, -1076, -998, -1019, -985, -988, -1199, -1533, -1796, -1998, -2240, -2457, -2540, -2550, -2554, -2453, -2164, -1790, -1438, -1074, -662, -275, 28, 294, 541, 659, 583, 443, 365, 257, 31, -173, -240, -312, -483, -556, -386, -140, 0, 121, 344, 642, 983, 1352, 1646, 1764, 1797, 1910, 2064, 2065, 1859, 1598, 1423, 1316, 1222, 1166, 1160, 1166, 1203, 1361, 1616, 1839, 2001, 2191, 2388, 2483, 2488, 2541, 2651, 2665, 2523, 2356, 2267, 2171, 1966, 1734, 1613, 1592, 1589, 1611, 1702, 1837, 1986, 2161, 2303, 2304, 2189, 2091, 2029, 1900, 1689, 1520, 1455, 1405, 1284, 1163, 1183, 1366, 1577, 1677, 1635, 1528, 1458, 1444, 1377, 1163, 884, 718, 709, 763, 828, 903, 955, 995, 1114, 1333, 1511, 1520, 1403, 1264, 1121, 958, 818, 754, 750, 752, 749, 791, 911, 1055, 1112, 1046, 919, 782, 622, 460, 368, 330, 267, 229, 346, 582, 795, 963, 1128, 1217, 1193, 1199, 1302, 1330, 1163, 931, 769, 642, 548, 604, 813, 992, 1050, 1154, 1440, 1747, 1835, 1745, 1695, 1723, 1743, 1783, 1893, 1960, 1910, 1904, 2086, 2337, 2494, 2578, 2658, 2684, 2626, 2570, 2596, 2654, 2707, 2844, 3148, 3530, 3853, 4109, 4318, 4381, 4268, 4158, 4163, 4106, 3842, 3549, 3466, 3595, 3803, 4031, 4259, 4476, 4713, 4959, 5121, 5130, 5028, 4838, 4542, 4216, 4018, 3990, 4011, 4028, 4180, 4618, 5319, 6129, 6930, 7700, 8416, 8977, 9250, 9167, 8808, 8349, 7894, 7352, 6621, 5856, 5385, 5331, 5508, 5733, 6043, 6537, 7172, 7809, 8385, 8903, 9336, 9673, 9988, 10334, 10606, 10653, 10503, 10296, 10059, 9673, 9114, 8534, 8071, 7713, 7375, 7079, 6959, 7097, 7407, 7758, 8170, 8726, 9346, 9849, 10206, 10499, 10661, 10538, 10146, 9618, 8977, 8207, 7422, 6727, 6072, 5443, 4972, 4758, 4759, 4908, 5159, 5428, 5656, 5888, 6152, 6351, 6373, 6222, 5932, 5492, 4900, 4217, 3496, 2726, 1906, 1122, 466, -45, -436, -677, -729, -656, -547, -393, -155, 98, 212, 143, -17, -219, -544, -1091, -1821, -2605, -3343, -4012, -4617, -5178, -5683, -6042, -6153, -6047, -5876, -5732, -5569, -5351, -5152, -5070, -5098, -5195, -5374, -5674, -6071, -6479, -6873, -7285, -7705, -8067, -8352, -8602, -8828, -8960, -8948, -8837, -8712, -8586, -8416, -8199, -7996, -7870, -7838, -7894, -8007, -8150, -8331, -8572, -8846, -9076, -9228, -9347, -9461, -9535, -9517, -9427, -9329, -9233, -9096, -8900, -8684, -8502, -8361, -8251, -8158, -8068, -7999, -7998, -8090, -8235, -8388, -8524, -8635, -8701, -8711, -8675, -8622, -8569, -8487, -8301, -7993, -7665, -7432, -7281, -7124, -6954, -6834, -6814, -6897, -7066, -7262, -7410, -7506, -7589, -7632, -7567, -7405, -7214, -6987, -6682, -6337, -6046, -5840, -5674, -5498, -5303, -5138, -5059, -5053, -5061, -5075, -5144, -5252, -5321, -5356, -5449, -5576, -5577, -5380, -5117, -4934, -4785, -4522, -4140, -3786, -3549, -3385, -3227, -3066, -2902, -2760, -2711, -2766, -2831, -2842, -2847, -2885, -2899, -2861, -2831, -2823, -2769, -2604, -2323, -1977, -1655, -1430, -1252, -992, -645, -375, -289, -295, -249, -161, -144, -213, -271, -289, -332, -407, -425, -347, -224, -93, 49, 196, 360, 594, 890, 1131, 1232, 1275, 1388, 1565, 1677, 1653, 1548, 1456, 1403, 1370, 1326, 1240, 1127, 1073, 1127, 1229, 1320, 1453, 1663, 1866, 2009, 2173, 2395, 2567, 2595, 2537, 2491, 2479, 2465, 2415, 2321, 2224, 2198, 2245, 2272, 2231, 2198, 2261, 2378, 2433, 2432, 2497, 2668, 2834, 2909, 2964, 3097, 3259, 3312, 3227, 3112, 3052, 3022, 2951, 2835, 2729, 2685, 2722, 2802, 2866, 2908, 3009, 3189, 3350, 3414, 3446, 3537, 3654, 3703, 3668, 3606, 3561, 3531, 3480, 3381, 3265, 3198, 3195, 3189, 3139, 3111, 3186, 3338, 3452, 3476, 3481, 3541, 3642, 3710, 3704, 3626, 3513, 3411, 3327, 3198, 3017, 2881, 2847, 2844, 2809, 2808, 2896, 3017, 3084, 3072, 2996, 2901, 2840, 2775, 2592, 2296, 2048, 1932, 1870, 1826, 1867, 1987, 2068, 2083, 2131, 2258, 2360, 2323, 2144, 1918, 1737, 1620, 1518, 1386, 1253, 1191, 1226, 1304, 1348, 1342, 1311, 1263, 1185, 1091, 1036, 1048, 1083, 1071, 1017, 974, 950, 922, 918, 968, 1010, 968, 872, 800, 744, 670, 622, 634, 665, 688, 748, 843, 887, 846, 782, 745, 710, 651, 575, 490, 406, 356, 386, 486, 591, 656, 707, 791, 899, 983, 1022, 1019, 973, 875, 753, 670, 663, 699, 715, 700, 684, 695, 728, 761, 781, 807, 855, 910, 936, 955, 1036, 1170, 1279, 1330, 1363, 1386, 1367, 1327, 1308, 1271, 1149, 976, 831, 716, 613, 554, 574, 645, 734, 858, 1020, 1177, 1299, 1420, 1564, 1683, 1702, 1622, 1514, 1425, 1330, 1189, 1007, 820, 638, 467, 341, 289, 292, 296, 289, 312, 401, 544, 714, 891, 1064, 1230, 1394, 1555, 1680, 1734, 1706, 1621, 1524, 1437, 1350, 1236, 1088, 942, 858, 869, 954, 1072, 1204, 1354, 1522, 1709, 1924, 2161, 2394, 2603, 2777, 2899, 2965, 2999, 3026, 3017, 2931, 2797, 2695, 2661, 2646, 2594, 2530, 2529, 2629, 2810, 3020, 3231, 3425, 3593, 3749, 3915, 4082, 4191, 4196, 4129, 4045, 3941, 3797, 3631, 3466, 3300, 3144, 3049, 3030, 3043, 3058, 3093, 3162, 3254, 3358, 3451, 3491, 3472, 3444, 3428, 3357, 3179, 2944, 2744, 2576, 2356, 2065, 1792, 1602, 1461, 1329, 1229, 1186, 1178, 1181, 1186, 1180, 1156, 1128, 1099, 1029, 897, 734, 571, 399, 204, -13, -252, -496, -704, -868, -1021, -1179, -1309, -1396, -1469, -1544, -1591, -1583, -1552, -1547, -1577, -1629, -1713, -1840, -1979, -2099, -2230, -2416, -2631, -2826, -3000, -3174, -3328, -3438, -3534, -3634, -3709, -3724, -3697, -3666, -3664, -3699, -3753, -3795, -3837, -3923, -4056, -4190, -4310, -4446, -4602, -4748, -4865, -4977, -5096, -5195, -5254, -5273, -5283, -5292, -5288, -5251, -5186, -5120, -5088, -5108, -5161, -5222, -5297, -5402, -5522, -5630, -5733, -5854, -5979, -6067, -6105, -6113, -6100, -6077, -6044, -5973, -5852, -5720, -5629, -5577, -5528, -5485, -5484, -5531, -5601, -5680, -5773, -5865, -5933, -5966, -5969, -5946, -5889, -5791, -5665, -5530, -5412, -5304, -5184, -5043, -4900, -4789, -4710, -4643, -4573, -4523, -4509, -4515, -4516, -4505, -4487, -4468, -4445, -4393, -4288, -4147, -4013, -3882, -3710, -3501, -3311, -3158, -3010, -2860, -2735, -2630, -2527, -2438, -2387, -2349, -2304, -2253, -2203, -2138, -2063, -1984, -1879, -1728, -1552, -1378, -1194, -996, -815, -664, -520, -375, -253, -172, -109, -47, 9, 55, 99, 142, 169, 185, 230, 325, 440, 527, 586, 665, 787, 931, 1052, 1135, 1192, 1250, 1313, 1369, 1393, 1386, 1374, 1381, 1395, 1388, 1356, 1331, 1337, 1363, 1383, 1390, 1406, 1460, 1549, 1636, 1683, 1693, 1705, 1737, 1759, 1727, 1654, 1598, 1580, 1565, 1523, 1475, 1448, 1440, 1442, 1452, 1460, 1451, 1429, 1410, 1393, 1367, 1341, 1320, 1298, 1274, 1262, 1278, 1313, 1349, 1373, 1394, 1421, 1444, 1439, 1401, 1350, 1312, 1284, 1240, 1181, 1132, 1104, 1093, 1093, 1110, 1147, 1198, 1250, 1298, 1350, 1412, 1481, 1545, 1597, 1636, 1665, 1686, 1704, 1709, 1684, 1625, 1566, 1523, 1474, 1410, 1364, 1365, 1398, 1438, 1491, 1567, 1664, 1781, 1912, 2031, 2116, 2171, 2194, 2174, 2127, 2089, 2054, 1987, 1891, 1814, 1780, 1762, 1738, 1717, 1723, 1767, 1847, 1951, 2068, 2186, 2301, 2408, 2490, 2528, 2520, 2486, 2438, 2365, 2267, 2163, 2079, 2013, 1951, 1891, 1846, 1830, 1848, 1892, 1936, 1957, 1966, 2000, 2056, 2088, 2073, 2058, 2072, 2064, 1993, 1893, 1817, 1761, 1684, 1580, 1482, 1416, 1383, 1365, 1344, 1320, 1307, 1313, 1325, 1321, 1302, 1288, 1279, 1258, 1209, 1134, 1051, 966, 886, 819, 768, 727, 691, 666, 665, 691, 733, 776, 810, 836, 854, 853, 823, 765, 694, 628, 566, 490, 398, 314, 271, 269, 273, 263, 256, 273, 321, 378, 438, 487, 512, 514, 505, 496, 478, 440, 377, 290, 191, 107, 43, -18, -89, -152, -184, -183, -155, -108, -59, -17, 41, 119, 185, 206, 193, 170, 139, 89, 16, -79, -188, -296, -400, -499, -573, -601, -601, -609, -605, -551, -464, -389, -332, -271, -215, -190, -190, -209, -261, -342, -421, -484, -551, -631, -701, -736, -746, -750, -743, -704, -636, -566, -505, -435, -347, -256, -184, -137, -96, -48, 3, 53, 97, 148, 208, 268, 317, 364, 424, 504, 579, 645, 726, 850, 993, 1118, 1229, 1347, 1475, 1601, 1716, 1819, 1904, 1982, 2083, 2211, 2336, 2425, 2505, 2614, 2747, 2858, 2938, 3015, 3105, 3188, 3248, 3306, 3371, 3441, 3517, 3595, 3663, 3720, 3792, 3890, 3983, 4036, 4068, 4121, 4190, 4229, 4222, 4205, 4197, 4177, 4131, 4084, 4048, 4017, 3995, 3985, 3968, 3928, 3895, 3882, 3859, 3815, 3781, 3763, 3723, 3647, 3566, 3504, 3442, 3365, 3268, 3147, 3009, 2878, 2768, 2663, 2539, 2407, 2305, 2245, 2193, 2127, 2051, 1980, 1908, 1831, 1751, 1657, 1542, 1416, 1300, 1190, 1069, 938, 811, 687, 554, 413, 278, 158, 57, -29, -121, -230, -344, -439, -513, -595, -701, -814, -922, -1037, -1168, -1288, -1386, -1500, -1652, -1813, -1956, -2088, -2215, -2317, -2402, -2500, -2605, -2695, -2772, -2859, -2961, -3070, -3184, -3298, -3399, -3494, -3589, -3680, -3773, -3889, -4022, -4123, -4177, -4226, -4308, -4408, -4490, -4551, -4612, -4684, -4761, -4836, -4899, -4942, -4971, -5014, -5085, -5169, -5238, -5290, -5335, -5377, -5417, -5457, -5495, -5521, -5546, -5577, -5596, -5585, -5568, -5574, -5586, -5586, -5595, -5628, -5657, -5662, -5666, -5683, -5690, -5666, -5627, -5595, -5571, -5543, -5507, -5456, -5399, -5341, -5280, -5217, -5155, -5104, -5057, -5017, -4981, -4949, -4922, -4892, -4866, -4838, -4802, -4751, -4697, -4643, -4575, -4480, -4381, -4300, -4234, -4156, -4068, -3997, -3943, -3886, -3824, -3770, -3721, -3659, -3581, -3496, -3402, -3302, -3201, -3098, -2995, -2899, -2813, -2718, -2603, -2489, -2413, -2362, -2294, -2190, -2079, -1990, -1921, -1844, -1757, -1667, -1577, -1480, -1373, -1265, -1165, -1078, -998, -907, -794, -677, -580, -507, -439, -361, -283, -214, -149, -80, -21, 28, 84, 161, 248, 331, 420, 525, 630, 722, 800, 876, 950, 1012, 1058, 1096, 1133, 1161, 1179, 1192, 1218, 1253, 1277, 1286, 1309, 1365, 1430, 1474, 1504, 1545, 1602, 1665, 1724, 1774, 1808, 1836, 1877, 1933, 1979, 1988, 1966, 1947, 1942, 1938, 1936, 1942, 1945, 1934, 1926, 1936, 1951, 1954, 1950, 1959, 1980, 1999, 2008, 2010, 2009, 2007, 2002, 1997, 1999, 2010, 2016, 2002, 1976, 1954, 1931, 1893, 1853, 1831, 1821, 1809, 1799, 1802, 1814, 1819, 1814, 1804, 1799, 1794, 1777, 1745, 1717, 1712, 1721, 1718, 1694, 1669, 1659, 1662, 1664, 1656, 1636, 1614, 1604, 1602, 1586, 1551, 1521, 1507, 1505, 1510, 1515, 1516, 1506, 1501, 1511, 1526, 1527, 1513, 1496, 1492, 1505, 1522, 1521, 1502, 1488, 1500, 1533, 1559, 1570, 1580, 1604, 1634, 1646, 1631, 1608, 1603, 1609, 1600, 1574, 1555, 1563, 1586, 1600, 1594, 1582, 1580, 1593, 1611, 1624, 1635, 1650, 1662, 1664, 1663, 1669, 1680, 1679, 1670, 1665, 1669, 1683, 1695, 1691, 1664, 1626, 1608, 1619, 1641, 1650, 1643, 1641, 1663, 1701, 1738, 1761, 1775, 1784, 1781, 1769, 1763, 1760, 1738, 1696, 1655, 1625, 1593, 1563, 1544, 1531, 1510, 1491, 1494, 1512, 1522, 1527, 1540, 1563, 1583, 1593, 1585, 1550, 1500, 1446, 1395, 1343, 1287, 1230, 1178, 1133, 1095, 1069, 1052, 1038, 1020, 998, 974, 941, 903, 864, 830, 799, 770, 748, 732, 706, 659, 597, 540, 489, 440, 391, 354, 330, 313, 296, 280, 261, 251, 260, 268, 245, 201, 170, 154, 129, 93, 58, 29, -2, -24, -22, -3, 13, 21, 22, 19, 24, 44, 73, 92, 96, 96, 97, 98, 99, 105, 107, 88, 53, 27, 25, 32, 33, 33, 28, 6, -19, -18, 9, 31, 32, 34, 54, 70, 52, 2, -51, -85, -104, -127, -165, -210, -255, -289, -304, -293, -263, -229, -193, -144, -78, 1, 86, 164, 226, 281, 344, 406, 436, 432, 429, 455, 507, 557, 580, 582, 605, 687, 804, 904, 971, 1044, 1155, 1298, 1452, 1594, 1708, 1801, 1906, 2032, 2135, 2196, 2239, 2297, 2368, 2424, 2468, 2528, 2619, 2730, 2840, 2938, 3039, 3154, 3273, 3385, 3496, 3604, 3697, 3775, 3857, 3930, 3966, 3966, 3962, 3957, 3931, 3899, 3888, 3893, 3899, 3917, 3942, 3949, 3944, 3961, 3989, 3979, 3936, 3901, 3876, 3832, 3764, 3690, 3599, 3468, 3322, 3199, 3098, 2989, 2865, 2752, 2670, 2595, 2508, 2416, 2329, 2248, 2175, 2106, 2013, 1888, 1766, 1669, 1558, 1401, 1230, 1085, 956, 817, 665, 503, 343, 223, 154, 89, -15, -136, -230, -304, -377, -459, -569, -717, -874, -1007, -1137, -1301, -1485, -1658, -1817, -1977, -2141, -2307, -2465, -2588, -2677, -2770, -2882, -2991, -3072, -3147, -3240, -3350, -3474, -3626, -3791, -3943, -4083, -4229, -4373, -4492, -4590, -4689, -4805, -4930, -5045, -5131, -5190, -5250, -5323, -5390, -5439, -5490, -5563, -5647, -5726, -5807, -5898, -5999, -6106, -6217, -6320, -6415, -6502, -6571, -6614, -6645, -6678, -6707, -6706, -6691, -6695, -6713, -6730, -6743, -6761, -6785, -6827, -6888, -6949, -6992, -7034, -7088, -7128, -7122, -7091, -7068, -7048, -7004, -6922, -6820, -6718, -6633, -6553, -6468, -6381, -6307, -6245, -6178, -6115, -6071, -6031, -5969, -5899, -5849, -5799, -5714, -5600, -5496, -5412, -5327, -5229, -5125, -5023, -4925, -4827, -4730, -4624, -4502, -4376, -4267, -4180, -4093, -3991, -3880, -3776, -3680, -3579, -3464, -3340, -3226, -3135, -3050, -2941, -2791, -2627, -2485, -2363, -2236, -2086, -1938, -1809, -1688, -1566, -1450, -1338, -1222, -1111, -1006, -880, -735, -615, -527, -420, -278, -152, -61, 36, 155, 262, 352, 449, 550, 638, 724, 825, 927, 1010, 1084, 1159, 1229, 1291, 1358, 1426, 1481, 1527, 1577, 1631, 1679, 1724, 1776, 1837, 1897, 1955, 2010, 2065, 2113, 2156, 2207, 2267, 2317, 2342, 2358, 2394, 2451, 2500, 2542, 2593, 2640, 2654, 2647, 2663, 2714, 2759, 2776, 2779, 2780, 2783, 2804, 2846, 2884, 2894, 2886, 2880, 2881, 2899, 2928, 2943, 2929, 2907, 2911, 2941, 2973, 2993, 3002, 2998, 2988, 2990, 3009, 3028, 3031, 3031, 3052, 3087, 3105, 3096, 3081, 3075, 3070, 3054, 3040, 3038, 3033, 3005, 2963, 2939, 2944, 2954, 2943, 2913, 2895, 2900, 2912, 2908, 2886, 2866, 2865, 2878, 2881, 2863, 2823, 2778, 2743, 2726, 2711, 2672, 2617, 2568, 2535, 2507, 2494, 2500, 2496, 2458, 2424, 2437, 2470, 2473, 2444, 2418, 2407, 2404, 2401, 2384, 2358, 2340, 2342, 2335, 2304, 2270, 2257, 2246, 2207, 2151, 2112, 2107, 2116, 2117, 2113, 2108, 2095, 2073, 2051, 2032, 2013, 1996, 1992, 2000, 1990, 1944, 1892, 1872, 1874, 1863, 1843, 1839, 1839, 1808, 1756, 1721, 1705, 1677, 1641, 1614, 1601, 1594, 1600, 1616, 1628, 1621, 1607, 1598, 1590, 1569, 1537, 1507, 1477, 1432, 1380, 1342, 1332, 1338, 1345, 1351, 1353, 1353, 1347, 1328, 1294, 1268, 1263, 1254, 1219, 1167, 1128, 1107, 1100, 1098, 1081, 1031, 974, 951, 954, 948, 929, 916, 900, 878, 866, 864, 840, 792, 750, 717, 668, 609, 566, 531, 488, 452, 433, 421, 417, 427, 420, 367, 296, 267, 278, 285, 266, 217, 139, 56, 11, 2, -18, -75, -152, -226, -284, -313, -306, -289, -304, -363, -432, -479, -498, -513, -542, -574, -596, -620, -669, -731, -778, -812, -848, -890, -929, -963, -982, -972, -966, -1013, -1085, -1107, -1073, -1058, -1096, -1147, -1181, -1224, -1291, -1360, -1413, -1449, -1472, -1480, -1485, -1510, -1560, -1615, -1649, -1657, -1659, -1677, -1703, -1727, -1755, -1797, -1839, -1863, -1874, -1884, -1881, -1852, -1815, -1793, -1778, -1752, -1711, -1674, -1644, -1614, -1571, -1507, -1424, -1335, -1265, -1215, -1158, -1070, -973, -892, -807, -682, -539, -425, -342, -250, -130, 2, 136, 271, 409, 538, 660, 789, 929, 1071, 1207, 1338, 1462, 1579, 1707, 1862, 2030, 2184, 2322, 2455, 2583, 2706, 2847, 3013, 3167, 3277, 3354, 3442, 3558, 3680, 3787, 3881, 3973, 4067, 4145, 4199, 4241, 4281, 4324, 4383, 4468, 4539, 4550, 4531, 4564, 4648, 4701, 4702, 4698, 4697, 4662, 4622, 4620, 4622, 4575, 4504, 4460, 4425, 4358, 4280, 4223, 4180, 4129, 4075, 4030, 3972, 3883, 3781, 3690, 3604, 3506, 3414, 3344, 3268, 3141, 2977, 2834, 2736, 2651, 2551, 2442, 2335, 2228, 2116, 2009, 1912, 1810, 1689, 1551, 1409, 1266, 1116, 949, 760, 566, 399, 251, 84, -118, -312, -466, -608, -772, -950, -1123, -1295, -1464, -1617, -1757, -1913, -2089, -2273, -2443, -2600, -2763, -2947, -3142, -3313, -3455, -3609, -3800, -3993, -4138, -4256, -4402, -4574, -4707, -4783, -4867, -4997, -5119, -5201, -5300, -5454, -5601, -5688, -5777, -5929, -6089, -6186, -6239, -6315, -6414, -6493, -6553, -6626, -6699, -6728, -6716, -6718, -6745, -6763, -6762, -6788, -6858, -6916, -6933, -6944, -6985, -7019, -7002, -6960, -6953, -6977, -6982, -6942, -6874, -6791, -6709, -6658, -6637, -6603, -6536, -6460, -6396, -6336, -6282, -6252, -6225, -6168, -6081, -6009, -5962, -5898, -5802, -5723, -5682, -5618, -5486, -5351, -5280, -5240, -5153, -5020, -4908, -4822, -4724, -4607, -4518, -4455, -4363, -4231, -4118, -4064, -4018, -3926, -3795, -3661, -3536, -3412, -3297, -3184, -3068, -2949, -2841, -2742, -2647, -2551, -2448, -2336, -2220, -2119, -2045, -1981, -1901, -1797, -1685, -1589, -1510, -1430, -1344, -1259, -1178, -1090, -995, -909, -842, -778, -695, -605, -542, -517, -501, -461, -392, -317, -252, -212, -198, -195, -176, -132, -79, -31, 2, 16, 19, 40, 86, 124, 130, 127, 141, 176, 225, 280, 331, 365, 390, 424, 469, 515, 557, 597, 630, 644, 645, 661, 702, 744, 759, 758, 766, 785, 799, 803, 813, 836, 855, 867, 893, 941, 986, 1006, 1009, 1017, 1039, 1071, 1107, 1141, 1169, 1200, 1237, 1271, 1296, 1327, 1369, 1412, 1445, 1475, 1505, 1517, 1516, 1548, 1640, 1729, 1750, 1735, 1773, 1852, 1897, 1905, 1936, 1993, 2026, 2032, 2045, 2065, 2075, 2089, 2121, 2160, 2200, 2258, 2323, 2360, 2369, 2387, 2435, 2495, 2541, 2586, 2633, 2656, 2649, 2672, 2756, 2844, 2879, 2886, 2909, 2932, 2924, 2920, 2972, 3047, 3073, 3060, 3083, 3156, 3200, 3193, 3205, 3274, 3330, 3322, 3300, 3319, 3342, 3322, 3295, 3322, 3377, 3383, 3342, 3320, 3319, 3280, 3212, 3184, 3212, 3232, 3217, 3210, 3236, 3266, 3258, 3215, 3187, 3202, 3220, 3170, 3068, 3009, 3037, 3080, 3072, 3036, 3011, 2981, 2914, 2855, 2857, 2885, 2860, 2797, 2780, 2814, 2802, 2711, 2633, 2636, 2662, 2646, 2606, 2592, 2585, 2540, 2469, 2421, 2393, 2348, 2283, 2247, 2247, 2230, 2161, 2073, 2021, 2009, 1999, 1967, 1931, 1911, 1899, 1868, 1819, 1784, 1766, 1741, 1704, 1684, 1702, 1726, 1711, 1672, 1646, 1633, 1590, 1523, 1486, 1482, 1455, 1390, 1342, 1332, 1307, 1245, 1200, 1210, 1222, 1178, 1105, 1060, 1024, 948, 850, 786, 749, 698, 642, 616, 588, 522, 450, 414, 400, 368, 327, 292, 246, 179, 109, 55, 2, -61, -112, -131, -145, -184, -226, -239, -246, -284, -333, -356, -361, -375, -393, -413, -445, -487, -511, -516, -518, -518, -501, -488, -524, -610, -681, -670, -578, -472, -421, -453, -545, -636, -658, -596, -511, -493, -572, -708, -848, -965, -1043, -1075, -1090, -1142, -1240, -1330, -1372, -1387, -1407, -1430, -1452, -1483, -1525, -1561, -1598, -1647, -1716, -1783, -1829, -1850, -1852, -1849, -1852, -1853, -1821, -1740, -1632, -1530, -1426, -1302, -1186, -1105, -1030, -915, -781, -682, -603, -502, -388, -291, -198, -65, 104, 271, 422, 585, 781, 992, 1191, 1390, 1610, 1845, 2055, 2228, 2407, 2610, 2801, 2933, 3032, 3156, 3318, 3496, 3681, 3865, 4045, 4225, 4411, 4597, 4779, 4976, 5188, 5381, 5530, 5658, 5792, 5922, 6025, 6106, 6187, 6275, 6354, 6413, 6455, 6500, 6565, 6630, 6666, 6675, 6685, 6721, 6774, 6816, 6834, 6826, 6808, 6795, 6780, 6733, 6649, 6556, 6487, 6430, 6346, 6229, 6112, 6002, 5877, 5742, 5625, 5525, 5401, 5249, 5099, 4968, 4820, 4642, 4464, 4297, 4109, 3879, 3644, 3451, 3281, 3074, 2816, 2555, 2334, 2152, 1987, 1832, 1666, 1449, 1187, 947, 768, 596, 364, 90, -178, -452, -742, -1014, -1247, -1480, -1752, -2043, -2311, -2558, -2802, -3029, -3226, -3415, -3636, -3880, -4114, -4348, -4601, -4852, -5077, -5293, -5530, -5766, -5966, -6153, -6350, -6538, -6689, -6832, -7005, -7186, -7322, -7420, -7529, -7657, -7762, -7848, -7961, -8094, -8195, -8257, -8330, -8430, -8523, -8590, -8665, -8751, -8809, -8817, -8820, -8850, -8876, -8866, -8850, -8870, -8901, -8886, -8841, -8812, -8811, -8804, -8781, -8771, -8774, -8765, -8732, -8702, -8689, -8671, -8627, -8577, -8534, -8484, -8414, -8342, -8289, -8244, -8190, -8126, -8074, -8026, -7956, -7856, -7751, -7678, -7631, -7575, -7487, -7376, -7261, -7152, -7058, -6994, -6956, -6906, -6804, -6647, -6484, -6360, -6279, -6218, -6145, -6047, -5914, -5750, -5587, -5463, -5384, -5314, -5208, -5071, -4933, -4819, -4714, -4600, -4477, -4345, -4195, -4035, -3894, -3784, -3675, -3529, -3357, -3190, -3037, -2898, -2778, -2672, -2554, -2413, -2268, -2140, -2034, -1933, -1815, -1677, -1546, -1437, -1330, -1200, -1064, -956, -862, -746, -618, -489, -358, -239, -161, -94, 23, 177, 291, 360, 440, 539, 622, 698, 797, 916, 1029, 1137, 1242, 1329, 1402, 1479, 1553, 1608, 1662, 1738, 1827, 1905, 1972, 2036, 2098, 2167, 2261, 2369, 2465, 2538, 2606, 2679, 2754, 2825, 2892, 2942, 2951, 2934, 2939, 2967, 2966, 2923, 2906, 2955, 3017, 3021, 2992, 2992, 3033, 3074, 3082, 3058, 3002, 2916, 2829, 2791, 2822, 2875, 2887, 2836, 2762, 2727, 2772, 2898, 3051, 3143, 3117, 3008, 2917, 2916, 3010, 3147, 3232, 3188, 3032, 2895, 2879, 2970, 3071, 3106, 3067, 2999, 2985, 3062, 3179, 3256, 3286, 3330, 3426, 3541, 3634, 3700, 3753, 3775, 3756, 3734, 3762, 3834, 3897, 3913, 3890, 3859, 3847, 3873, 3946, 4047, 4149, 4219, 4245, 4238, 4233, 4262, 4312, 4346, 4348, 4340, 4336, 4324, 4298, 4288, 4295, 4288, 4268, 4273, 4310, 4328, 4301, 4266, 4248, 4209, 4134, 4076, 4075, 4070, 3979, 3826, 3717, 3679, 3635, 3534, 3428, 3377, 3341, 3252, 3134, 3051, 2997, 2916, 2817, 2759, 2726, 2646, 2516, 2410, 2354, 2284, 2170, 2050, 1973, 1918, 1841, 1749, 1670, 1600, 1505, 1397, 1330, 1307, 1260, 1132, 955, 811, 735, 696, 655, 598, 518, 395, 239, 124, 110, 173, 209, 154, 42, -52, -112, -155, -175, -164, -172, -256, -365, -397, -356, -342, -393, -450, -466, -457, -436, -394, -349, -339, -364, -372, -334, -272, -221, -186, -162, -161, -183, -201, -192, -169, -139, -101, -66, -59, -88, -134, -181, -212, -191, -105, 6, 74, 74, 52, 60, 110, 184, 270, 355, 400, 370, 296, 258, 287, 324, 313, 285, 303, 363, 404, 398, 365, 334, 316, 311, 302, 283, 254, 206, 120, 3, -105, -176, -213, -219, -216, -251, -340, -426, -437, -393, -363, -359, -353, -332, -324, -353, -418, -497, -561, -598, -627, -682, -769, -858, -921, -956, -963, -927, -868, -835, -831, -793, -717, -685, -727, -758, -712, -653, -670, -727, -746, -735, -757, -789, -744, -631, -556, -544, -498, -372, -259, -236, -251, -238, -220, -247, -271, -227, -171, -221, -374, -482, -453, -327, -196, -111, -99, -150, -197, -172, -85, -19, -57, -213, -418, -575, -660, -755, -939, -1176, -1338, -1354, -1280, -1209, -1171, -1137, -1071, -940, -707, -399, -122, 34, 88, 112, 149, 204, 277, 359, 439, 498, 515, 506, 553, 734, 1003, 1251, 1449, 1648, 1871, 2099, 2353, 2646, 2910, 3072, 3171, 3305, 3483, 3627, 3723, 3847, 4022, 4153, 4189, 4236, 4425, 4736, 5038, 5260, 5426, 5556, 5665, 5819, 6080, 6361, 6490, 6448, 6397, 6437, 6509, 6570, 6655, 6742, 6758, 6733, 6784, 6924, 7071, 7195, 7324, 7439, 7491, 7495, 7526, 7596, 7646, 7617, 7532, 7421, 7271, 7090, 6935, 6838, 6757, 6636, 6491, 6363, 6261, 6155, 6040, 5933, 5837, 5713, 5528, 5298, 5071, 4856, 4617, 4339, 4068, 3840, 3632, 3404, 3171, 2973, 2800, 2611, 2398, 2192, 2014, 1840, 1636, 1399, 1136, 850, 549, 259, -17, -324, -695, -1088, -1419, -1680, -1938, -2207, -2443, -2649, -2889, -3171, -3445, -3703, -3981, -4262, -4518, -4792, -5142, -5519, -5843, -6116, -6385, -6652, -6882, -7074, -7251, -7396, -7472, -7520, -7614, -7748, -7857, -7952, -8100, -8270, -8377, -8436, -8570, -8811, -9026, -9111, -9097, -9075, -9064, -9064, -9114, -9200, -9211, -9100, -8993, -8995, -9046, -9065, -9098, -9185, -9258, -9265, -9284, -9371, -9469, -9515, -9529, -9549, -9549, -9502, -9448, -9432, -9422, -9369, -9299, -9277, -9293, -9297, -9286, -9294, -9307, -9288, -9253, -9241, -9233, -9167, -9038, -8922, -8836, -8706, -8508, -8317, -8158, -7978, -7790, -7673, -7629, -7549, -7403, -7285, -7259, -7263, -7227, -7150, -7050, -6899, -6695, -6515, -6394, -6254, -6014, -5746, -5553, -5416, -5249, -5053, -4899, -4810, -4745, -4672, -4583, -4467, -4328, -4205, -4113, -3999, -3791, -3527, -3309, -3167, -3026, -2834, -2632, -2468, -2329, -2192, -2071, -1971, -1850, -1697, -1580, -1539, -1496, -1353, -1149, -1006, -950, -890, -771, -634, -518, -392, -253, -171, -176, -178, -99, 19, 104, 181, 293, 402, 462, 529, 699, 937, 1109, 1167, 1206, 1302, 1423, 1505, 1557, 1609, 1657, 1704, 1775, 1872, 1957, 2011, 2066, 2151, 2250, 2343, 2443, 2578, 2732, 2868, 2971, 3021, 3004, 2964, 2990, 3079, 3135, 3122, 3113, 3156, 3206, 3226, 3244, 3299, 3386, 3492, 3594, 3647, 3613, 3523, 3460, 3485, 3562, 3581, 3481, 3324, 3222, 3184, 3161, 3162, 3216, 3247, 3154, 2988, 2912, 2979, 3109, 3234, 3330, 3349, 3253, 3127, 3133, 3301, 3483, 3526, 3453, 3395, 3412, 3465, 3501, 3489, 3420, 3327, 3270, 3273, 3267, 3180, 3046, 2957, 2944, 2952, 2959, 3016, 3140, 3269, 3346, 3385, 3424, 3463, 3509, 3579, 3660, 3702, 3678, 3630, 3592, 3540, 3458, 3403, 3422, 3463, 3473, 3484, 3537, 3594, 3617, 3634, 3662, 3652, 3581, 3503, 3460, 3404, 3267, 3084, 2942, 2868, 2832, 2845, 2917, 2982, 2985, 2983, 3048, 3144, 3206, 3251, 3291, 3287, 3219, 3141, 3079, 2978, 2821, 2660, 2542, 2446, 2356, 2295, 2284, 2286, 2265, 2242, 2268, 2330, 2368, 2348, 2297, 2234, 2132, 1994, 1882, 1837, 1802, 1700, 1560, 1474, 1474, 1500, 1500, 1499, 1523, 1551, 1535, 1464, 1386, 1341, 1306, 1223, 1071, 874, 659, 456, 321, 278, 259, 162, 6, -78, -9, 159, 308, 357, 316, 247, 203, 193, 197, 194, 148, 24, -145, -275, -328, -351, -364, -331, -250, -186, -162, -121, -30, 65, 104, 88, 63, 52, 41, 2, -80, -198, -297, -314, -259, -210, -198, -181, -143, -133, -151, -125, -30, 61, 82, 52, 13, -28, -88, -158, -203, -216, -219, -228, -223, -166, -72, -2, 5, -15, 1, 63, 103, 66, -15, -67, -61, -30, -30, -95, -213, -323, -356, -313, -260, -247, -266, -282, -260, -178, -73, -24, -58, -104, -76, -10, -14, -142, -336, -501, -592, -607, -570, -522, -511, -540, -574, -597, -620, -632, -604, -547, -522, -550, -567, -502, -387, -325, -366, -431, -399, -252, -90, 3, 35, 44, 31, -7, -19, 64, 233, 392, 469, 486, 500, 531, 564, 614, 704, 830, 934, 955, 862, 690, 523, 441, 441, 450, 401, 312, 254, 273, 353, 439, 482, 457, 384, 306, 245, 173, 62, -97, -304, -544, -762, -912, -1013, -1106, -1180, -1203, -1197, -1193, -1161, -1045, -845, -632, -473, -376, -304, -215, -120, -83, -137, -215, -209, -98, 18, 41, -7, -24, 57, 240, 495, 767, 976, 1091, 1196, 1427, 1795, 2149, 2329, 2344, 2347, 2454, 2652, 2854, 3003, 3124, 3274, 3485, 3742, 4011, 4282, 4553, 4811, 5027, 5191, 5332, 5487, 5670, 5842, 5941, 5936, 5870, 5828, 5860, 5938, 6005, 6058, 6126, 6212, 6281, 6322, 6378, 6479, 6609, 6716, 6752, 6694, 6570, 6451, 6394, 6392, 6380, 6300, 6143, 5958, 5820, 5767, 5754, 5692, 5558, 5418, 5344, 5291, 5158, 4929, 4675, 4445, 4210, 3944, 3662, 3400, 3192, 3028, 2857, 2637, 2388, 2178, 2041, 1940, 1826, 1662, 1450, 1218, 996, 789, 564, 296, 0, -283, -548, -821, -1111, -1384, -1615, -1810, -1977, -2132, -2324, -2582, -2856, -3090, -3304, -3552, -3838, -4137, -4449, -4762, -5043, -5290, -5533, -5776, -5983, -6144, -6274, -6376, -6436, -6478, -6547, -6648, -6733, -6794, -6894, -7061, -7232, -7358, -7474, -7611, -7732, -7813, -7890, -7965, -7982, -7935, -7901, -7920, -7960, -7978, -7977, -7977, -7996, -8048, -8119, -8179, -8212, -8246, -8311, -8386, -8416, -8397, -8368, -8331, -8255, -8173, -8148, -8175, -8182, -8146, -8090, -8020, -7943, -7919, -7997, -8116, -8165, -8093, -7961, -7840, -7761, -7715, -7680, -7624, -7510, -7344, -7169, -7021, -6901, -6792, -6674, -6534, -6388, -6279, -6212, -6137, -6023, -5896, -5789, -5683, -5554, -5416, -5295, -5186, -5059, -4879, -4652, -4424, -4256, -4169, -4105, -3992, -3831, -3698, -3636, -3606, -3550, -3463, -3363, -3249, -3102, -2939, -2780, -2621, -2447, -2272, -2121, -1984, -1832, -1674, -1555, -1495, -1447, -1360, -1247, -1145, -1058, -955, -835, -722, -629, -545, -466, -415, -404, -408, -399, -379, -365, -357, -347, -339, -348, -377, -394, -359, -280, -213, -178, -125, -8, 126, 195, 194, 184, 218, 293, 387, 468, 503, 476, 446, 496, 624, 739, 782, 798, 850, 928, 991, 1040, 1104, 1196, 1293, 1359, 1377, 1370, 1378, 1414, 1442, 1441, 1420, 1406, 1427, 1495, 1590, 1659, 1677, 1691, 1769, 1913, 2058, 2139, 2149, 2138, 2161, 2241, 2354, 2442, 2456, 2398, 2327, 2316, 2375, 2449, 2497, 2532, 2587, 2651, 2686, 2681, 2665, 2672, 2700, 2717, 2700, 2654, 2629, 2649, 2681, 2670, 2619, 2606, 2675, 2772, 2833, 2886, 2985, 3095, 3150, 3173, 3241, 3341, 3403, 3410, 3430, 3495, 3570, 3594, 3565, 3536, 3550, 3585, 3581, 3527, 3465, 3419, 3375, 3324, 3274, 3223, 3177, 3171, 3246, 3355, 3382, 3308, 3266, 3357, 3476, 3477, 3406, 3417, 3507, 3514, 3382, 3234, 3190, 3204, 3174, 3085, 3010, 2990, 2987, 2945, 2864, 2792, 2757, 2746, 2736, 2706, 2642, 2552, 2480, 2463, 2484, 2492, 2480, 2489, 2535, 2578, 2582, 2584, 2628, 2670, 2648, 2588, 2566, 2582, 2567, 2509, 2454, 2422, 2388, 2351, 2348, 2362, 2323, 2217, 2142, 2153, 2164, 2065, 1893, 1785, 1774, 1764, 1690, 1603, 1568, 1561, 1535, 1528, 1602, 1732, 1825, 1847, 1856, 1908, 2005, 2116, 2209, 2237, 2156, 2018, 1946, 1989, 2008, 1840, 1533, 1279, 1139, 984, 761, 631, 692, 755, 586, 292, 201, 350, 406, 174, -102, -159, -104, -158, -258, -206, -17, 163, 334, 559, 743, 725, 561, 425, 291, 3, -314, -321, -15, 142, -133, -540, -603, -267, 135, 343, 368, 302, 149, -94, -316, -361, -214, -52, -93, -357, -594, -497, -59, 399, 592, 551, 517, 622, 797, 918, 943, 903, 825, 701, 512, 289, 105, 43, 95, 132, 28, -164, -203, 43, 352, 357, 9, -361, -458, -359, -321, -399, -429, -313, -140, -15, 55, 74, 19, -76, -139, -196, -329, -498, -567, -533, -540, -652, -759, -770, -759, -843, -986, -1073, -1129, -1314, -1642, -1858, -1763, -1528, -1478, -1625, -1699, -1583, -1452, -1432, -1422, -1303, -1133, -1035, -1011, -930, -679, -338, -130, -138, -175, -39, 198, 301, 220, 146, 176, 169, -22, -292, -415, -338, -234, -230, -273, -274, -281, -332, -309, -177, -160, -378, -572, -548, -556, -805, -1041, -1065, -1157, -1493, -1709, -1496, -1149, -1113, -1346, -1453, -1182, -707, -499, -825, -1387, -1725, -1905, -2322, -2991, -3593, -4050, -4526, -4988, -5236, -5103, -4360, -2892, -1147, 161, 966, 1864, 3191, 4644, 5744, 6197, 5975, 5462, 5261, 5590, 6108, 6484, 6750, 7029, 7343, 7693, 8086, 8423, 8573, 8499, 8183, 7622, 6976, 6592, 6698, 7155, 7553, 7549, 7193, 6927, 7104, 7536, 7791, 7754, 7648, 7638, 7778, 8168, 8760, 9225, 9324, 9204, 9041, 8705, 8046, 7246, 6547, 5891, 5076, 4178, 3495, 3126, 2911, 2745, 2645, 2502, 2133, 1612, 1230, 1055, 841, 420, -111, -566, -835, -916, -901, -928, -1016, -1031, -905, -820, -1008, -1382, -1609, -1591, -1655, -2109, -2850, -3550, -4057, -4495, -5040, -5715, -6380, -6835, -6978, -6907, -6823, -6773, -6607, -6277, -5976, -5831, -5712, -5541, -5510, -5711, -5882, -5798, -5615, -5565, -5539, -5299, -4906, -4638, -4547, -4427, -4205, -4077, -4191, -4451, -4739, -5055, -5381, -5618, -5769, -5957, -6199, -6366, -6358, -6195, -5954, -5691, -5425, -5153, -4857, -4518, -4105, -3611, -3072, -2547, -2037, -1527, -1067, -697, -369, -53, 136, 106, -47, -171, -239, -306, -383, -475, -594, -678, -666, -642, -756, -1006, -1294, -1575, -1851, -2106, -2335, -2546, -2688, -2728, -2745, -2810, -2848, -2789, -2713, -2712, -2738, -2747, -2814, -2988, -3168, -3261, -3351, -3573, -3926, -4306, -4689, -5147, -5668, -6146, -6531, -6905, -7337, -7746, -8037, -8252, -8478, -8651, -8671, -8619, -8621, -8571, -8287, -7856, -7542, -7383, -7200, -6926, -6631, -6323, -5992, -5738, -5656, -5640, -5498, -5198, -4886, -4646, -4433, -4226, -4093, -4047, -3982, -3859, -3788, -3853, -3974, -4065, -4175, -4352, -4469, -4378, -4159, -4006, -3904, -3670, -3296, -2968, -2749, -2481, -2096, -1750, -1584, -1512, -1378, -1186, -1024, -897, -775, -725, -810, -929, -931, -867, -919, -1139, -1389, -1550, -1631, -1677, -1686, -1683, -1753, -1929, -2113, -2195, -2189, -2186, -2220, -2260, -2259, -2161, -1927, -1593, -1259, -981, -716, -383, 17, 355, 478, 425, 411, 529, 633, 612, 562, 560, 533, 488, 536, 623, 573, 435, 412, 465, 379, 151, -42, -145, -221, -299, -392, -509, -548, -410, -176, 29, 250, 564, 894, 1148, 1371, 1600, 1770, 1868, 1983, 2118, 2149, 2040, 1942, 1994, 2151, 2243, 2183, 2043, 1946, 1901, 1821, 1721, 1702, 1732, 1636, 1395, 1200, 1148, 1166, 1229, 1364, 1451, 1378, 1306, 1471, 1831, 2175, 2427, 2614, 2734, 2867, 3186, 3677, 4056, 4102, 3957, 3902, 3974, 3973, 3790, 3552, 3386, 3226, 2970, 2716, 2628, 2622, 2505, 2355, 2358, 2340, 2038, 1709, 1775, 2022, 1920, 1580, 1544, 1838, 2065, 2223, 2657, 3293, 3652, 3631, 3697, 4141, 4619, 4693, 4435, 4207, 4124, 4079, 4066, 4119, 4115, 3934, 3711, 3642, 3641, 3492, 3246, 3122, 3044, 2724, 2224, 1946, 2014, 2132, 2116, 2075, 2090, 2129, 2257, 2550, 2843, 2913, 2817, 2801, 2956, 3169, 3340, 3490, 3631, 3650, 3459, 3219, 3225, 3444, 3451, 3038, 2561, 2367, 2274, 2024, 1793, 1770, 1708, 1370, 1019, 985, 1105, 1038, 821, 731, 789, 769, 601, 494, 612, 815, 890, 883, 997, 1225, 1352, 1353, 1449, 1690, 1816, 1686, 1514, 1505, 1581, 1609, 1600, 1587, 1550, 1517, 1536, 1589, 1665, 1783, 1867, 1783, 1583, 1491, 1588, 1729, 1804, 1881, 2023, 2144, 2162, 2173, 2344, 2657, 2916, 2994, 2967, 2964, 2998, 3044, 3147, 3291, 3302, 3076, 2830, 2817, 2933, 2885, 2652, 2447, 2325, 2171, 1988, 1904, 1933, 1937, 1836, 1678, 1558, 1517, 1553, 1612, 1608, 1500, 1382, 1356, 1392, 1424, 1501, 1616, 1608, 1455, 1423, 1622, 1772, 1668, 1502, 1450, 1371, 1141, 908, 813, 741, 547, 285, 95, 1, -74, -186, -305, -367, -377, -398, -456, -505, -502, -442, -323, -173, -93, -142, -208, -119, 94, 215, 125, -59, -165, -173, -184, -269, -411, -566, -707, -823, -924, -1035, -1146, -1236, -1344, -1526, -1723, -1787, -1690, -1595, -1641, -1770, -1819, -1718, -1548, -1451, -1468, -1478, -1355, -1165, -1094, -1181, -1235, -1088, -832, -732, -898, -1129, -1136, -908, -744, -862, -1116, -1212, -1105, -992, -992, -1026, -1006, -962, -931, -870, -750, -628, -566, -516, -389, -229, -199, -342, -472, -388, -149, -28, -185, -500, -716, -704, -564, -523, -754, -1205, -1590, -1623, -1411, -1386, -1725, -2068, -2028, -1785, -1773, -2020, -2160, -2063, -2009, -2220, -2541, -2733, -2820, -2969, -3204, -3440, -3649, -3791, -3740, -3469, -3169, -3003, -2847, -2485, -1929, -1379, -913, -451, -7, 239, 261, 382, 933, 1765, 2364, 2486, 2464, 2760, 3393, 3991, 4328, 4522, 4724, 4851, 4833, 4836, 5056, 5365, 5455, 5279, 5078, 5037, 5101, 5169, 5240, 5335, 5395, 5344, 5225, 5192, 5342, 5585, 5729, 5666, 5456, 5237, 5121, 5159, 5277, 5297, 5092, 4739, 4445, 4310, 4251, 4134, 3931, 3673, 3350, 2911, 2404, 2011, 1856, 1798, 1557, 1070, 565, 254, 122, 71, 77, 114, 54, -153, -342, -302, -93, 25, -51, -166, -181, -162, -213, -284, -279, -212, -194, -310, -510, -643, -597, -436, -358, -480, -737, -970, -1084, -1111, -1153, -1280, -1459, -1604, -1692, -1766, -1828, -1790, -1606, -1397, -1350, -1472, -1564, -1481, -1311, -1222, -1267, -1385, -1496, -1551, -1539, -1501, -1487, -1506, -1546, -1610, -1680, -1712, -1680, -1632, -1637, -1730, -1884, -2044, -2153, -2201, -2229, -2284, -2365, -2405, -2348, -2197, -2005, -1820, -1662, -1527, -1387, -1222, -1070, -991, -983, -1010, -1067, -1143, -1184, -1184, -1231, -1367, -1529, -1680, -1827, -1926, -1974, -2131, -2484, -2818, -2949, -3041, -3304, -3625, -3816, -3950, -4156, -4363, -4470, -4523, -4584, -4640, -4694, -4752, -4773, -4739, -4722, -4790, -4916, -5056, -5183, -5261, -5291, -5346, -5472, -5618, -5732, -5838, -5952, -6029, -6062, -6123, -6251, -6388, -6460, -6463, -6448, -6456, -6489, -6515, -6502, -6438, -6322, -6165, -5986, -5829, -5706, -5560, -5302, -4921, -4529, -4238, -4034, -3838, -3628, -3416, -3190, -3006, -2965, -3022, -3018, -2939, -2920, -2955, -2909, -2831, -2890, -3041, -3065, -2957, -2931, -3060, -3194, -3252, -3348, -3523, -3603, -3518, -3460, -3534, -3551, -3396, -3248, -3206, -3090, -2853, -2723, -2767, -2766, -2638, -2547, -2566, -2594, -2583, -2565, -2519, -2430, -2359, -2328, -2270, -2162, -2079, -2060, -2043, -1986, -1948, -1977, -1983, -1891, -1778, -1743, -1718, -1592, -1417, -1261, -1062, -805, -604, -474, -300, -98, 8, 84, 269, 493, 623, 727, 882, 972, 971, 1067, 1293, 1401, 1268, 1110, 1120, 1214, 1229, 1143, 1039, 976, 954, 955, 968, 986, 999, 1002, 1013, 1050, 1074, 1050, 1033, 1105, 1232, 1308, 1342, 1425, 1570, 1701, 1789, 1861, 1924, 1964, 1986, 1982, 1945, 1908, 1939, 2010, 2005, 1912, 1900, 2074, 2263, 2284, 2288, 2494, 2737, 2707, 2520, 2535, 2759, 2880, 2813, 2754, 2811, 2932, 3092, 3284, 3427, 3451, 3416, 3435, 3536, 3639, 3641, 3526, 3403, 3347, 3308, 3239, 3234, 3334, 3399, 3329, 3213, 3111, 2945, 2755, 2690, 2686, 2533, 2312, 2305, 2519, 2682, 2696, 2668, 2638, 2578, 2522, 2462, 2306, 2064, 1860, 1740, 1646, 1572, 1575, 1676, 1878, 2115, 2229, 2189, 2230, 2487, 2690, 2572, 2316, 2216, 2214, 2165, 2215, 2501, 2813, 2907, 2924, 3163, 3585, 3862, 3833, 3677, 3602, 3588, 3504, 3353, 3235, 3166, 3081, 3006, 3024, 3097, 3113, 3080, 3087, 3064, 2848, 2511, 2321, 2325, 2273, 2012, 1701, 1560, 1581, 1626, 1642, 1651, 1637, 1566, 1474, 1441, 1464, 1441, 1310, 1131, 993, 934, 960, 1063, 1180, 1202, 1129, 1094, 1159, 1207, 1133, 1023, 985, 970, 884, 778, 781, 912, 1049, 1077, 1010, 984, 1087, 1237, 1278, 1176, 1055, 1014, 1007, 968, 951, 1034, 1129, 1099, 1012, 1057, 1207, 1234, 1071, 889, 779, 647, 454, 316, 287, 263, 162, 45, 27, 109, 193, 201, 166, 150, 119, 27, -53, -32, -2, -126, -329, -360, -166, 25, 40, -55, -109, -80, -37, -46, -95, -109, -90, -147, -296, -378, -285, -137, -62, -11, 81, 146, 141, 159, 245, 299, 250, 173, 163, 203, 240, 295, 395, 482, 505, 514, 551, 544, 424, 265, 149, 36, -107, -205, -214, -238, -339, -404, -331, -214, -224, -365, -494, -529, -542, -623, -740, -821, -870, -930, -944, -804, -545, -334, -241, -193, -145, -149, -166, -55, 172, 254, 45, -180, -54, 359, 649, 658, 650, 809, 951, 882, 747, 782, 931, 940, 744, 538, 496, 579, 656, 672, 638, 574, 522, 527, 558, 517, 388, 290, 301, 321, 246, 170, 245, 431, 555, 565, 543, 541, 553, 571, 557, 453, 289, 171, 144, 154, 174, 266, 428, 531, 526, 593, 846, 1067, 1014, 821, 722, 668, 570, 575, 727, 779, 666, 677, 922, 1127, 1135, 1103, 1114, 1045, 843, 575, 282, -2, -241, -484, -754, -901, -836, -751, -812, -889, -885, -974, -1236, -1484, -1660, -1959, -2415, -2801, -3014, -3160, -3272, -3277, -3175, -3021, -2809, -2549, -2295, -2020, -1662, -1316, -1150, -1148, -1099, -866, -528, -219, 35, 327, 730, 1188, 1594, 1937, 2310, 2739, 3087, 3213, 3197, 3278, 3520, 3699, 3659, 3568, 3613, 3710, 3727, 3735, 3795, 3781, 3633, 3492, 3419, 3324, 3209, 3152, 3086, 2880, 2605, 2431, 2358, 2283, 2178, 2063, 1917, 1750, 1633, 1585, 1525, 1390, 1213, 1053, 885, 678, 485, 358, 222, -22, -306, -491, -581, -704, -924, -1169, -1343, -1426, -1492, -1636, -1830, -1917, -1846, -1793, -1921, -2120, -2152, -2001, -1894, -1982, -2142, -2160, -2024, -1915, -1930, -1921, -1731, -1468, -1352, -1375, -1330, -1159, -1031, -1058, -1170, -1273, -1334, -1359, -1378, -1443, -1524, -1533, -1470, -1430, -1443, -1456, -1447, -1474, -1557, -1638, -1694, -1782, -1924, -2034, -2062, -2079, -2125, -2114, -2024, -1968, -1959, -1850, -1627, -1505, -1575, -1638, -1552, -1473, -1569, -1714, -1706, -1619, -1681, -1862, -1914, -1787, -1701, -1757, -1797, -1721, -1649, -1685, -1732, -1692, -1654, -1734, -1876, -1934, -1893, -1859, -1865, -1871, -1869, -1872, -1840, -1749, -1662, -1641, -1667, -1700, -1740, -1788, -1840, -1911, -2009, -2090, -2111, -2124, -2233, -2406, -2491, -2490, -2605, -2875, -3050, -3008, -3003, -3245, -3550, -3672, -3694, -3805, -3969, -4053, -4067, -4114, -4217, -4294, -4271, -4167, -4079, -4050, -4008, -3892, -3758, -3667, -3560, -3388, -3243, -3212, -3195, -3044, -2793, -2626, -2628, -2698, -2694, -2587, -2459, -2366, -2265, -2129, -2030, -2028, -2032, -1928, -1794, -1775, -1857, -1926, -1967, -2012, -2026, -1978, -1924, -1897, -1841, -1736, -1654, -1631, -1589, -1481, -1394, -1426, -1516, -1535, -1476, -1426, -1396, -1352, -1332, -1353, -1320, -1192, -1093, -1095, -1115, -1123, -1195, -1298, -1289, -1214, -1258, -1422, -1506, -1441, -1376, -1409, -1457, -1406, -1281, -1192, -1195, -1230, -1201, -1124, -1090, -1116, -1142, -1130, -1056, -862, -623, -552, -650, -594, -260, 17, 16, 1, 209, 428, 425, 362, 461, 657, 796, 904, 1040, 1138, 1148, 1168, 1272, 1359, 1336, 1316, 1399, 1444, 1293, 1125, 1221, 1474, 1503, 1240, 1044, 1147, 1325, 1300, 1177, 1177, 1237, 1167, 1053, 1148, 1416, 1561, 1479, 1381, 1407, 1472, 1566, 1824, 2135, 2141, 1839, 1704, 1961, 2294, 2433, 2519, 2659, 2669, 2517, 2542, 2936, 3350, 3370, 3124, 3036, 3176, 3287, 3303, 3372, 3441, 3318, 3080, 3028, 3206, 3354, 3323, 3220, 3091, 2827, 2505, 2433, 2667, 2803, 2560, 2196, 2079, 2145, 2122, 2010, 1980, 2026, 2010, 1933, 1920, 1957, 1917, 1804, 1754, 1785, 1765, 1696, 1734, 1906, 2046, 2067, 2072, 2160, 2294, 2395, 2447, 2505, 2603, 2671, 2605, 2465, 2455, 2619, 2735, 2626, 2443, 2455, 2653, 2767, 2662, 2505, 2453, 2438, 2361, 2278, 2237, 2154, 1996, 1859, 1774, 1657, 1516, 1455, 1458, 1412, 1291, 1167, 1062, 984, 969, 988, 937, 779, 626, 577, 602, 601, 525, 415, 354, 339, 296, 206, 168, 195, 148, -6, -102, -77, -69, -100, -50, -2, -164, -420, -458, -316, -295, -407, -403, -299, -350, -564, -623, -374, -84, -95, -357, -502, -331, -58, 20, -63, -77, 23, 101, 135, 240, 401, 434, 304, 211, 302, 475, 560, 559, 557, 531, 422, 298, 285, 367, 409, 350, 237, 103, -37, -117, -73, 0, -61, -247, -349, -255, -107, -79, -147, -180, -142, -86, -71, -131, -234, -247, -94, 88, 105, -4, 13, 285, 626, 801, 818, 834, 905, 986, 1094, 1255, 1404, 1474, 1529, 1637, 1716, 1670, 1613, 1740, 1986, 2045, 1794, 1504, 1488, 1680, 1744, 1547, 1266, 1030, 799, 648, 763, 977, 852, 381, 94, 203, 290, 49, -245, -313, -344, -572, -825, -821, -641, -581, -684, -761, -746, -718, -636, -382, -79, -12, -184, -270, -71, 237, 410, 454, 476, 456, 387, 441, 730, 1044, 1117, 1018, 1003, 1136, 1282, 1361, 1418, 1451, 1402, 1290, 1231, 1263, 1316, 1354, 1425, 1523, 1568, 1564, 1633, 1817, 1987, 2024, 1979, 1972, 2030, 2104, 2177, 2263, 2326, 2311, 2264, 2347, 2609, 2858, 2878, 2725, 2627, 2615, 2498, 2173, 1729, 1246, 742, 272, -123, -550, -1118, -1736, -2206, -2503, -2811, -3238, -3700, -4082, -4415, -4772, -5128, -5405, -5603, -5775, -5939, -6080, -6159, -6098, -5864, -5555, -5314, -5155, -4983, -4705, -4303, -3831, -3394, -3056, -2752, -2372, -1919, -1480, -1085, -703, -316, 53, 393, 702, 984, 1257, 1496, 1642, 1713, 1813, 1943, 2013, 2053, 2144, 2176, 2010, 1812, 1816, 1901, 1832, 1700, 1668, 1632, 1507, 1466, 1576, 1645, 1600, 1585, 1603, 1523, 1419, 1485, 1652, 1666, 1512, 1405, 1457, 1561, 1631, 1697, 1772, 1780, 1701, 1653, 1706, 1759, 1688, 1533, 1394, 1279, 1146, 1010, 919, 857, 759, 606, 457, 388, 376, 316, 189, 76, 3, -111, -248, -253, -150, -162, -328, -412, -307, -195, -187, -141, 33, 191, 212, 213, 328, 476, 530, 568, 709, 855, 846, 772, 828, 959, 981, 900, 872, 917, 931, 860, 725, 575, 463, 393, 311, 187, 74, -10, -118, -252, -327, -318, -347, -501, -671, -685, -573, -522, -583, -602, -486, -334, -240, -169, -59, 70, 193, 310, 409, 492, 587, 706, 809, 875, 926, 961, 966, 950, 915, 833, 699, 569, 477, 364, 159, -95, -284, -402, -566, -852, -1170, -1405, -1565, -1730, -1941, -2183, -2434, -2676, -2882, -3051, -3207, -3369, -3537, -3689, -3766, -3748, -3709, -3732, -3776, -3729, -3599, -3531, -3588, -3633, -3536, -3372, -3302, -3319, -3270, -3116, -2979, -2940, -2940, -2915, -2868, -2814, -2760, -2745, -2800, -2892, -2953, -2958, -2955, -2991, -3054, -3101, -3112, -3113, -3129, -3155, -3174, -3196, -3243, -3298, -3320, -3293, -3258, -3252, -3242, -3177, -3081, -3018, -2986, -2919, -2802, -2695, -2641, -2621, -2608, -2585, -2534, -2454, -2379, -2344, -2339, -2335, -2326, -2334, -2348, -2335, -2305, -2317, -2399, -2497, -2547, -2553, -2562, -2592, -2637, -2699, -2776, -2804, -2735, -2619, -2580, -2649, -2722, -2698, -2594, -2484, -2408, -2357, -2298, -2192, -2031, -1847, -1670, -1508, -1351, -1198, -1047, -885, -700, -518, -375, -269, -185, -128, -91, -17, 116, 225, 245, 239, 277, 301, 252, 183, 154, 120, 36, -56, -119, -178, -259, -320, -328, -324, -363, -439, -499, -507, -475, -444, -455, -510, -531, -431, -245, -102, -34, 53, 197, 335, 454, 617, 820, 992, 1125, 1266, 1413, 1529, 1624, 1720, 1801, 1848, 1902, 1999, 2104, 2145, 2118, 2074, 2038, 1990, 1937, 1921, 1931, 1905, 1832, 1764, 1744, 1759, 1770, 1743, 1669, 1593, 1559, 1547, 1507, 1457, 1437, 1440, 1444, 1471, 1547, 1647, 1747, 1860, 1982, 2070, 2132, 2227, 2366, 2470, 2487, 2468, 2511, 2618, 2698, 2707, 2704, 2766, 2875, 2961, 3026, 3134, 3271, 3332, 3264, 3157, 3121, 3147, 3161, 3158, 3187, 3235, 3241, 3211, 3237, 3340, 3405, 3351, 3255, 3245, 3322, 3376, 3336, 3244, 3171, 3148, 3159, 3190, 3231, 3255, 3235, 3201, 3210, 3251, 3249, 3200, 3172, 3182, 3165, 3115, 3108, 3151, 3166, 3136, 3124, 3138, 3137, 3114, 3103, 3100, 3078, 3050, 3043, 3048, 3041, 3040, 3062, 3072, 3028, 2979, 3007, 3071, 3030, 2844, 2637, 2537, 2539, 2551, 2509, 2425, 2362, 2356, 2349, 2272, 2161, 2096, 2061, 1972, 1848, 1760, 1695, 1557, 1330, 1116, 995, 934, 862, 757, 653, 565, 461, 316, 170, 72, 24, -22, -109, -218, -306, -356, -391, -447, -532, -613, -641, -613, -586, -642, -777, -883, -891, -866, -890, -948, -984, -1019, -1101, -1199, -1249, -1247, -1253, -1321, -1465, -1645, -1783, -1839, -1861, -1927, -2054, -2192, -2280, -2297, -2276, -2275, -2326, -2409, -2473, -2496, -2513, -2561, -2611, -2617, -2590, -2580, -2590, -2583, -2539, -2450, -2325, -2230, -2236, -2280, -2248, -2161, -2128, -2128, -2075, -2022, -2067, -2132, -2079, -1959, -1936, -2030, -2118, -2127, -2088, -2069, -2109, -2193, -2275, -2333, -2376, -2403, -2400, -2388, -2396, -2402, -2367, -2316, -2292, -2275, -2233, -2175, -2114, -2013, -1853, -1709, -1646, -1594, -1430, -1189, -1042, -1030, -1004, -881, -772, -751, -725, -610, -453, -322, -246, -241, -268, -206, -32, 95, 56, -63, -123, -118, -126, -184, -274, -365, -428, -468, -495, -494, -484, -555, -722, -825, -775, -713, -769, -850, -854, -827, -759, -574, -407, -461, -582, -429, -55, 133, 34, -24, 160, 382, 427, 402, 517, 700, 734, 629, 626, 831, 1055, 1072, 890, 688, 619, 718, 877, 903, 699, 429, 369, 533, 627, 472, 249, 187, 222, 161, 8, -62, 23, 131, 65, -172, -318, -172, 109, 191, 25, -125, -89, 33, 107, 130, 153, 197, 272, 377, 451, 441, 395, 419, 510, 560, 522, 492, 516, 522, 467, 419, 410, 380, 313, 284, 313, 320, 260, 201, 209, 257, 250, 144, 14, -13, 75, 139, 70, -46, -22, 170, 355, 369, 281, 313, 557, 811, 806, 565, 425, 619, 975, 1136, 998, 806, 837, 1081, 1246, 1107, 800, 690, 912, 1172, 1113, 796, 615, 757, 964, 953, 804, 733, 736, 714, 689, 674, 569, 385, 337, 495, 625, 561, 484, 607, 797, 795, 645, 585, 593, 444, 173, 0, -128, -467, -1004, -1493, -1854, -2154, -2360, -2464, -2638, -2980, -3281, -3323, -3236, -3321, -3629, -3943, -4122, -4201, -4184, -4047, -3928, -3948, -3903, -3516, -2918, -2456, -2152, -1754, -1204, -662, -183, 311, 852, 1420, 2030, 2660, 3216, 3660, 4125, 4766, 5519, 6156, 6554, 6798, 7035, 7338, 7709, 8021, 8101, 7973, 7898, 8001, 8073, 7912, 7610, 7349, 7160, 6963, 6682, 6256, 5705, 5158, 4726, 4361, 3947, 3447, 2909, 2394, 1949, 1572, 1206, 806, 422, 117, -143, -434, -713, -831, -775, -747, -921, -1186, -1286, -1158, -988, -940, -963, -928, -805, -654, -506, -353, -215, -106, 10, 154, 260, 281, 285, 379, 539, 623, 555, 411, 301, 244, 181, 84, -34, -162, -302, -464, -654, -853, -1006, -1116, -1249, -1442, -1641, -1810, -1989, -2172, -2295, -2356, -2433, -2547, -2636, -2668, -2693, -2742, -2780, -2769, -2724, -2680, -2649, -2611, -2533, -2424, -2322, -2248, -2190, -2138, -2091, -2022, -1885, -1692, -1522, -1431, -1386, -1316, -1203, -1093, -1018, -971, -940, -926, -926, -916, -890, -868, -867, -887, -910, -915, -902, -904, -959, -1059, -1166, -1270, -1385, -1494, -1565, -1619, -1719, -1875, -2017, -2091, -2146, -2249, -2377, -2479, -2586, -2749, -2935, -3065, -3146, -3245, -3385, -3525, -3622, -3664, -3672, -3702, -3773, -3847, -3894, -3938, -3993, -4024, -4011, -3990, -3992, -3978, -3910, -3812, -3724, -3639, -3524, -3393, -3294, -3227, -3131, -2990, -2852, -2756, -2680, -2585, -2464, -2330, -2208, -2106, -2009, -1893, -1767, -1653, -1547, -1446, -1383, -1373, -1381, -1367, -1357, -1391, -1446, -1468, -1454, -1442, -1435, -1405, -1375, -1403, -1475, -1513, -1492, -1486, -1546, -1620, -1646, -1633, -1611, -1576, -1516, -1446, -1376, -1301, -1205, -1094, -987, -912, -879, -866, -831, -758, -675, -615, -562, -486, -401, -334, -255, -137, -29, 6, 3, 24, 44, 3, -63, -86, -79, -120, -204, -237, -194, -167, -224, -295, -304, -268, -245, -253, -304, -389, -442, -414, -365, -363, -368, -331, -291, -283, -249, -148, -31, 56, 131, 197, 240, 283, 366, 460, 516, 541, 591, 680, 778, 861, 932, 984, 1006, 1023, 1074, 1138, 1147, 1105, 1080, 1091, 1090, 1060, 1020, 960, 868, 795, 776, 776, 739, 673, 606, 552, 514, 481, 421, 336, 287, 299, 324, 314, 298, 319, 365, 409, 458, 536, 619, 666, 680, 714, 806, 932, 1060, 1167, 1247, 1311, 1387, 1494, 1609, 1705, 1774, 1809, 1814, 1837, 1926, 2047, 2099, 2062, 2023, 2058, 2106, 2083, 2037, 2077, 2172, 2188, 2090, 1981, 1931, 1903, 1863, 1829, 1814, 1797, 1773, 1756, 1739, 1694, 1635, 1616, 1644, 1648, 1598, 1553, 1577, 1653, 1737, 1791, 1774, 1709, 1710, 1821, 1914, 1875, 1789, 1782, 1841, 1907, 1997, 2111, 2183, 2186, 2199, 2276, 2344, 2300, 2149, 1978, 1840, 1739, 1687, 1691, 1707, 1679, 1615, 1542, 1473, 1460, 1534, 1594, 1494, 1271, 1115, 1098, 1104, 1074, 1066, 1093, 1087, 1057, 1134, 1378, 1654, 1778, 1753, 1728, 1806, 1958, 2092, 2141, 2113, 2115, 2251, 2473, 2633, 2694, 2745, 2845, 2971, 3091, 3188, 3231, 3220, 3214, 3234, 3186, 2999, 2780, 2701, 2740, 2714, 2587, 2519, 2544, 2494, 2307, 2140, 2058, 1950, 1767, 1589, 1425, 1204, 968, 847, 842, 813, 706, 615, 582, 519, 386, 278, 234, 148, 1, -65, -24, -23, -102, -149, -155, -212, -260, -186, -54, 12, 42, 98, 128, 98, 98, 171, 215, 174, 147, 222, 322, 335, 293, 288, 293, 234, 159, 159, 171, 88, -43, -127, -181, -241, -267, -264, -325, -451, -548, -598, -650, -680, -668, -703, -848, -1003, -1054, -1041, -1045, -1054, -1034, -1029, -1090, -1150, -1119, -1042, -1032, -1070, -1032, -921, -867, -904, -906, -802, -666, -574, -509, -433, -357, -304, -262, -224, -208, -215, -192, -119, -47, -19, -10, 0, -2, -15, -36, -97, -194, -230, -175, -169, -323, -526, -601, -582, -647, -819, -937, -934, -938, -1018, -1074, -1069, -1134, -1319, -1457, -1448, -1426, -1508, -1610, -1623, -1587, -1571, -1543, -1446, -1322, -1274, -1319, -1356, -1290, -1181, -1186, -1308, -1364, -1238, -1059, -999, -1017, -932, -728, -592, -623, -674, -587, -443, -435, -569, -664, -613, -491, -420, -420, -454, -497, -535, -527, -429, -281, -191, -229, -351, -467, -542, -593, -610, -584, -544, -530, -534, -547, -593, -694, -822, -919, -955, -938, -902, -909, -985, -1074, -1089, -1029, -992, -988, -896, -688, -549, -594, -641, -528, -414, -513, -693, -666, -434, -260, -253, -260, -125, 119, 345, 468, 460, 359, 326, 457, 593, 511, 298, 233, 352, 452, 463, 490, 543, 509, 378, 256, 184, 105, -31, -216, -448, -734, -1014, -1184, -1238, -1316, -1540, -1876, -2167, -2282, -2211, -2077, -2048, -2196, -2410, -2524, -2498, -2416, -2355, -2289, -2161, -1966, -1741, -1498, -1203, -852, -521, -271, -41, 285, 701, 1062, 1297, 1506, 1829, 2252, 2632, 2888, 3108, 3431, 3848, 4194, 4371, 4477, 4642, 4833, 4925, 4937, 5006, 5164, 5270, 5213, 5071, 4995, 4998, 4985, 4912, 4817, 4705, 4529, 4291, 4056, 3861, 3667, 3412, 3084, 2754, 2502, 2310, 2080, 1804, 1580, 1442, 1291, 1075, 877, 747, 602, 379, 168, 70, 21, -112, -303, -392, -338, -289, -349, -419, -366, -247, -221, -300, -325, -220, -105, -121, -238, -313, -297, -272, -297, -337, -342, -325, -313, -296, -291, -344, -451, -560, -654, -756, -855, -948, -1064, -1202, -1294, -1328, -1386, -1496, -1592, -1659, -1746, -1844, -1902, -1950, -2053, -2182, -2263, -2297, -2328, -2365, -2381, -2379, -2361, -2320, -2252, -2187, -2152, -2138, -2122, -2105, -2091, -2066, -2004, -1916, -1830, -1743, -1643, -1528, -1403, -1266, -1154, -1099, -1057, -967, -856, -801, -798, -762, -658, -516, -382, -296, -282, -314, -349, -381, -424, -456, -463, -498, -632, -836, -1003, -1084, -1149, -1264, -1405, -1535, -1681, -1879, -2097, -2302, -2515, -2749, -2965, -3162, -3384, -3629, -3822, -3935, -4028, -4148, -4244, -4277, -4306, -4393, -4489, -4518, -4526, -4599, -4684, -4671, -4573, -4478, -4395, -4274, -4112, -3937, -3732, -3494, -3283, -3148, -3043, -2904, -2749, -2643, -2584, -2490, -2325, -2131, -1951, -1792, -1655, -1535, -1397, -1246, -1134, -1074, -1031, -1034, -1138, -1264, -1266, -1181, -1183, -1287, -1312, -1194, -1102, -1175, -1305, -1323, -1277, -1333, -1495, -1609, -1625, -1658, -1767, -1849, -1811, -1723, -1699, -1733, -1736, -1679, -1611, -1576, -1584, -1640, -1716, -1755, -1733, -1687, -1636, -1551, -1439, -1372, -1372, -1328, -1145, -918, -821, -837, -808, -696, -606, -550, -457, -372, -377, -385, -251, -24, 139, 208, 255, 299, 341, 427, 564, 657, 629, 569, 612, 742, 814, 784, 761, 823, 908, 945, 971, 1022, 1036, 963, 886, 909, 987, 992, 909, 856, 877, 883, 832, 834, 948, 1035, 949, 806, 841, 1042, 1145, 1029, 906, 1009, 1273, 1436, 1375, 1228, 1208, 1360, 1538, 1621, 1662, 1766, 1927, 2066, 2189, 2364, 2564, 2687, 2701, 2696, 2762, 2859, 2880, 2797, 2728, 2787, 2920, 3007, 3064, 3172, 3260, 3183, 3006, 2931, 2960, 2885, 2625, 2323, 2107, 1957, 1828, 1745, 1724, 1711, 1643, 1520, 1396, 1312, 1254, 1153, 937, 634, 417, 401, 477, 474, 434, 532, 793, 1120, 1450, 1726, 1840, 1801, 1742, 1716, 1655, 1600, 1683, 1871, 2001, 2065, 2230, 2543, 2840, 2998, 3106, 3262, 3392, 3390, 3314, 3263, 3197, 3063, 2943, 2921, 2955, 2995, 3070, 3147, 3107, 2927, 2724, 2579, 2436, 2225, 1980, 1773, 1613, 1460, 1289, 1110, 937, 792, 700, 650, 575, 413, 192, -4, -148, -280, -437, -587, -693, -765, -832, -889, -926, -953, -987, -1019, -1054, -1106, -1148, -1128, -1038, -931, -851, -780, -666, -487, -295, -161, -98, -45, 73, 246, 371, 403, 446, 618, 860, 1019, 1093, 1211, 1384, 1470, 1405, 1313, 1294, 1262, 1096, 847, 692, 705, 760, 699, 540, 443, 469, 486, 352, 106, -100, -231, -403, -682, -966, -1124, -1193, -1303, -1458, -1508, -1381, -1207, -1154, -1223, -1274, -1248, -1244, -1342, -1465, -1482, -1411, -1379, -1392, -1288, -992, -646, -420, -260, 6, 373, 633, 672, 634, 688, 778, 756, 669, 717, 937, 1118, 1139, 1158, 1350, 1583, 1596, 1392, 1240, 1253, 1226, 986, 677, 544, 569, 538, 429, 434, 588, 647, 453, 207, 153, 171, -39, -479, -853, -1029, -1195, -1450, -1578, -1405, -1151, -1140, -1312, -1357, -1234, -1210, -1383, -1526, -1485, -1427, -1556, -1767, -1778, -1522, -1201, -975, -764, -434, -56, 185, 258, 311, 450, 596, 631, 605, 688, 942, 1260, 1526, 1747, 1945, 2078, 2121, 2124, 2134, 2124, 2043, 1849, 1554, 1286, 1199, 1242, 1209, 1057, 950, 926, 793, 471, 146, -19, -141, -434, -886, -1269, -1431, -1473, -1594, -1818, -1971, -1943, -1861, -1922, -2092, -2130, -1935, -1756, -1859, -2119, -2177, -1949, -1670, -1491, -1297, -978, -625, -391, -312, -269, -105, 208, 520, 701, 806, 943, 1101, 1241, 1416, 1642, 1813, 1873, 1923, 2027, 2087, 2012, 1903, 1911, 1997, 1975, 1776, 1557, 1491, 1557, 1586, 1478, 1295, 1166, 1138, 1129, 992, 678, 296, 14, -129, -245, -401, -535, -598, -659, -753, -782, -717, -735, -997, -1409, -1748, -1935, -2073, -2242, -2433, -2616, -2799, -2973, -3110, -3215, -3308, -3361, -3346, -3326, -3368, -3438, -3475, -3520, -3607, -3667, -3640, -3556, -3409, -3144, -2801, -2518, -2313, -2062, -1712, -1352, -1073, -877, -695, -451, -119, 238, 563, 891, 1286, 1719, 2107, 2430, 2729, 3022, 3275, 3459, 3589, 3721, 3902, 4107, 4258, 4329, 4388, 4486, 4571, 4563, 4513, 4556, 4693, 4753, 4644, 4492, 4431, 4401, 4297, 4131, 3938, 3692, 3418, 3227, 3149, 3083, 2966, 2836, 2719, 2581, 2405, 2231, 2076, 1918, 1758, 1623, 1511, 1378, 1237, 1148, 1095, 998, 875, 845, 919, 943, 840, 722, 705, 744, 725, 630, 529, 472, 438, 398, 380, 433, 538, 587, 512, 398, 393, 500, 520, 320, 45, -55, 12, 8, -172, -348, -348, -272, -344, -585, -805, -885, -927, -1076, -1298, -1446, -1480, -1517, -1633, -1763, -1827, -1875, -2017, -2231, -2368, -2363, -2331, -2379, -2445, -2431, -2373, -2374, -2419, -2393, -2292, -2229, -2268, -2316, -2259, -2114, -1978, -1883, -1777, -1627, -1467, -1330, -1199, -1041, -864, -711, -602, -502, -374, -240, -159, -130, -86, 17, 132, 187, 185, 191, 220, 217, 148, 39, -85, -245, -432, -595, -716, -831, -970, -1129, -1324, -1568, -1832, -2074, -2301, -2544, -2807, -3059, -3288, -3502, -3696, -3848, -3957, -4061, -4189, -4329, -4456, -4566, -4656, -4714, -4729, -4728, -4733, -4738, -4694, -4570, -4400, -4259, -4183, -4108, -3948, -3697, -3436, -3226, -3041, -2842, -2663, -2555, -2478, -2338, -2135, -1959, -1831, -1671, -1431, -1177, -995, -892, -826, -783, -769, -758, -701, -606, -555, -594, -645, -601, -485, -451, -573, -733, -775, -728, -765, -911, -1002, -961, -949, -1081, -1216, -1176, -1046, -1038, -1159, -1231, -1179, -1130, -1200, -1318, -1340, -1256, -1192, -1210, -1221, -1153, -1070, -1068, -1102, -1057, -933, -837, -818, -819, -799, -797, -842, -887, -872, -807, -738, -690, -654, -639, -636, -615, -565, -530, -544, -582, -607, -615, -619, -620, -604, -548, -444, -317, -209, -141, -99, -66, -37, -3, 39, 94, 157, 213, 222, 170, 120, 166, 312, 446, 489, 500, 566, 650, 645, 573, 576, 684, 757, 696, 606, 623, 710, 726, 657, 619, 663, 701, 653, 565, 499, 458, 435, 450, 481, 478, 440, 410, 430, 500, 579, 601, 563, 544, 596, 669, 700, 723, 796, 897, 986, 1109, 1325, 1569, 1687, 1636, 1545, 1543, 1629, 1756, 1911, 2052, 2109, 2101, 2130, 2224, 2299, 2304, 2274, 2238, 2185, 2104, 1979, 1805, 1628, 1517, 1473, 1429, 1341, 1202, 1008, 784, 583, 399, 175, -85, -306, -478, -672, -890, -1009, -984, -975, -1147, -1411, -1516, -1393, -1241, -1224, -1253, -1151, -923, -712, -566, -381, -78, 255, 487, 641, 871, 1222, 1556, 1765, 1933, 2185, 2519, 2874, 3238, 3585, 3829, 3949, 4041, 4167, 4258, 4247, 4214, 4282, 4438, 4539, 4491, 4352, 4220, 4102, 3935, 3691, 3422, 3166, 2911, 2639, 2343, 2011, 1651, 1316, 1049, 807, 525, 228, -10, -186, -343, -506, -700, -946, -1201, -1364, -1407, -1397, -1385, -1377, -1379, -1395, -1364, -1205, -943, -711, -584, -494, -353, -180, -32, 106, 265, 408, 518, 646, 823, 1013, 1201, 1387, 1505, 1507, 1489, 1575, 1716, 1754, 1652, 1510, 1413, 1359, 1315, 1253, 1159, 1041, 949, 920, 909, 823, 630, 392, 159, -84, -349, -609, -838, -1058, -1274, -1448, -1527, -1516, -1484, -1508, -1589, -1655, -1646, -1591, -1584, -1670, -1779, -1829, -1826, -1819, -1774, -1600, -1319, -1092, -1025, -1020, -908, -671, -454, -360, -346, -312, -221, -90, 42, 136, 180, 225, 315, 421, 500, 558, 616, 656, 644, 584, 505, 420, 327, 224, 112, 12, -57, -104, -156, -226, -290, -328, -349, -391, -500, -684, -890, -1054, -1167, -1265, -1356, -1406, -1395, -1362, -1334, -1281, -1162, -1013, -918, -908, -929, -924, -907, -909, -922, -907, -862, -823, -804, -754, -610, -398, -216, -131, -102, -57, 16, 81, 111, 93, 12, -89, -127, -71, 9, 49, 70, 127, 198, 203, 106, -17, -71, -52, -50, -140, -286, -385, -374, -301, -252, -251, -249, -204, -128, -44, 42, 124, 182, 216, 233, 216, 154, 72, 7, -10, 34, 142, 263, 328, 332, 358, 485, 684, 852, 910, 887, 882, 944, 1016, 1007, 920, 852, 862, 900, 893, 852, 851, 895, 890, 760, 569, 462, 515, 655, 738, 687, 537, 381, 294, 276, 281, 281, 283, 287, 246, 129, -4, -48, 39, 197, 328, 382, 392, 420, 487, 569, 656, 774, 922, 1053, 1150, 1278, 1493, 1753, 1964, 2097, 2206, 2339, 2491, 2645, 2776, 2819, 2724, 2555, 2445, 2421, 2400, 2346, 2294, 2243, 2146, 2015, 1923, 1894, 1863, 1729, 1436, 1049, 717, 525, 401, 256, 120, 61, 33, -71, -251, -389, -421, -430, -529, -706, -836, -837, -766, -744, -824, -928, -908, -699, -396, -160, -61, -37, 8, 119, 289, 494, 701, 860, 936, 955, 998, 1131, 1339, 1534, 1639, 1674, 1743, 1890, 2031, 2057, 1979, 1903, 1870, 1808, 1665, 1511, 1442, 1436, 1378, 1242, 1117, 1083, 1120, 1148, 1098, 941, 736, 580, 493, 390, 235, 86, -8, -95, -221, -376, -519, -626, -683, -718, -789, -942, -1175, -1457, -1728, -1883, -1885, -1861, -2012, -2378, -2771, -2960, -2898, -2758, -2735, -2845, -2934, -2891, -2788, -2765, -2831, -2849, -2733, -2556, -2427, -2320, -2127, -1837, -1550, -1335, -1142, -904, -627, -358, -112, 124, 368, 624, 889, 1156, 1405, 1648, 1911, 2183, 2418, 2609, 2799, 2994, 3148, 3244, 3332, 3447, 3541, 3545, 3449, 3323, 3271, 3340, 3451, 3473, 3347, 3141, 2957, 2817, 2680, 2519, 2351, 2187, 1998, 1760, 1517, 1352, 1279, 1225, 1118, 971, 833, 712, 573, 422, 315, 287, 293, 261, 182, 126, 168, 278, 366, 386, 395, 463, 576, 667, 705, 734, 780, 814, 819, 834, 906, 1016, 1127, 1215, 1265, 1284, 1321, 1412, 1492, 1473, 1374, 1305, 1307, 1307, 1245, 1161, 1101, 1024, 890, 752, 662, 575, 427, 248, 86, -88, -309, -522, -682, -826, -1002, -1172, -1280, -1345, -1443, -1601, -1767, -1884, -1941, -1970, -2011, -2099, -2224, -2323, -2358, -2362, -2366, -2346, -2282, -2190, -2079, -1937, -1792, -1690, -1630, -1576, -1514, -1430, -1280, -1065, -873, -772, -708, -569, -350, -172, -117, -122, -72, 55, 179, 212, 144, 29, -65, -105, -116, -170, -315, -527, -734, -899, -1037, -1183, -1351, -1539, -1733, -1919, -2119, -2363, -2619, -2816, -2978, -3184, -3404, -3544, -3638, -3790, -3967, -4076, -4166, -4313, -4417, -4372, -4267, -4267, -4359, -4396, -4303, -4138, -4004, -3958, -3946, -3833, -3564, -3248, -3033, -2920, -2776, -2517, -2218, -1998, -1880, -1793, -1683, -1550, -1421, -1316, -1224, -1107, -948, -809, -776, -827, -855, -794, -689, -654, -785, -1021, -1169, -1142, -1110, -1256, -1511, -1708, -1842, -1950, -1965, -1905, -1960, -2198, -2417, -2460, -2433, -2492, -2608, -2677, -2713, -2758, -2761, -2651, -2499, -2452, -2513, -2552, -2509, -2450, -2400, -2276, -2066, -1915, -1927, -1969, -1844, -1584, -1392, -1349, -1364, -1348, -1274, -1125, -935, -807, -777, -762, -706, -654, -639, -608, -527, -442, -412, -437, -482, -506, -496, -478, -515, -632, -758, -783, -706, -649, -691, -772, -819, -838, -868, -896, -918, -991, -1147, -1330, -1439, -1439, -1376, -1322, -1302, -1308, -1327, -1348, -1331, -1244, -1137, -1124, -1226, -1320, -1287, -1167, -1100, -1136, -1197, -1209, -1180, -1143, -1071, -934, -771, -662, -612, -528, -351, -144, -15, 11, 14, 67, 185, 337, 468, 519, 475, 408, 412, 507, 616, 670, 682, 701, 714, 657, 539, 483, 565, 690, 696, 579, 465, 424, 408, 376, 364, 387, 381, 300, 214, 217, 288, 317, 258, 164, 107, 106, 148, 209, 280, 362, 442, 478, 463, 462, 527, 616, 674, 709, 721, 693, 673, 749, 906, 1036, 1100, 1149, 1209, 1250, 1276, 1326, 1386, 1403, 1369, 1344, 1374, 1437, 1490, 1517, 1516, 1486, 1460, 1479, 1520, 1531, 1514, 1496, 1444, 1340, 1266, 1262, 1252, 1199, 1183, 1235, 1260, 1219, 1204, 1248, 1264, 1218, 1194, 1245, 1290, 1250, 1170, 1141, 1158, 1166, 1163, 1192, 1237, 1256, 1260, 1288, 1334, 1384, 1436, 1469, 1467, 1470, 1512, 1535, 1510, 1513, 1594, 1683, 1723, 1776, 1866, 1911, 1885, 1885, 1953, 1971, 1857, 1709, 1686, 1766, 1791, 1705, 1621, 1640, 1739, 1847, 1906, 1881, 1803, 1775, 1840, 1922, 1946, 1924, 1888, 1837, 1786, 1744, 1678, 1583, 1538, 1590, 1658, 1653, 1605, 1614, 1663, 1646, 1529, 1410, 1378, 1394, 1366, 1276, 1163, 1069, 1029, 1053, 1109, 1148, 1165, 1159, 1113, 1047, 1020, 1037, 1027, 959, 877, 818, 788, 824, 944, 1060, 1059, 979, 979, 1120, 1268, 1280, 1192, 1145, 1177, 1190, 1105, 969, 864, 798, 730, 653, 607, 598, 586, 536, 457, 382, 304, 202, 94, 32, 27, 34, 7, -53, -102, -94, -9, 101, 163, 151, 109, 71, 32, -3, -28, -46, -64, -55, -23, -13, -17, 40, 165, 243, 197, 114, 114, 189, 230, 179, 85, 20, -14, -67, -116, -66, 101, 252, 247, 140, 117, 234, 336, 268, 68, -93, -134, -131, -169, -235, -269, -263, -246, -209, -130, -30, 28, 31, 18, 12, 18, 45, 73, 44, -47, -102, -35, 96, 176, 182, 196, 270, 350, 358, 304, 293, 389, 511, 523, 415, 328, 377, 507, 587, 582, 561, 560, 526, 442, 388, 415, 456, 414, 296, 180, 120, 107, 93, 36, -45, -106, -128, -147, -188, -245, -292, -322, -342, -379, -454, -521, -518, -470, -486, -596, -695, -671, -543, -423, -367, -344, -310, -248, -148, 3, 189, 345, 427, 456, 495, 570, 652, 689, 662, 614, 607, 655, 723, 782, 818, 808, 759, 720, 717, 722, 700, 672, 662, 646, 580, 477, 396, 381, 424, 467, 453, 380, 289, 200, 105, 7, -67, -109, -142, -191, -252, -320, -388, -445, -473, -472, -483, -547, -652, -724, -714, -680, -729, -894, -1097, -1262, -1357, -1374, -1320, -1269, -1321, -1487, -1675, -1781, -1770, -1675, -1583, -1588, -1707, -1850, -1889, -1773, -1567, -1404, -1366, -1409, -1411, -1309, -1147, -998, -872, -743, -621, -529, -409, -181, 126, 357, 422, 409, 475, 665, 896, 1072, 1164, 1230, 1351, 1549, 1754, 1885, 1928, 1921, 1897, 1884, 1908, 1986, 2092, 2177, 2198, 2150, 2074, 2042, 2092, 2178, 2197, 2100, 1964, 1897, 1908, 1906, 1827, 1711, 1630, 1587, 1542, 1484, 1446, 1446, 1480, 1536, 1591, 1616, 1640, 1719, 1836, 1889, 1831, 1738, 1701, 1743, 1827, 1903, 1934, 1917, 1891, 1880, 1872, 1861, 1858, 1839, 1754, 1598, 1452, 1401, 1424, 1420, 1325, 1163, 994, 856, 761, 685, 581, 440, 315, 236, 143, -7, -161, -232, -221, -207, -257, -357, -439, -446, -403, -386, -425, -458, -410, -316, -285, -333, -355, -300, -268, -349, -461, -463, -345, -213, -143, -145, -198, -262, -285, -250, -188, -160, -209, -343, -515, -652, -723, -755, -796, -866, -948, -1003, -1000, -952, -922, -971, -1075, -1154, -1188, -1254, -1387, -1489, -1479, -1442, -1511, -1652, -1719, -1684, -1680, -1820, -2033, -2160, -2145, -2088, -2109, -2228, -2370, -2458, -2477, -2464, -2465, -2500, -2568, -2662, -2778, -2895, -2958, -2932, -2861, -2849, -2943, -3074, -3134, -3101, -3053, -3064, -3116, -3128, -3070, -2995, -2950, -2890, -2771, -2662, -2652, -2697, -2671, -2555, -2454, -2434, -2471, -2513, -2525, -2490, -2414, -2346, -2326, -2346, -2359, -2334, -2282, -2227, -2183, -2151, -2143, -2170, -2204, -2195, -2116, -2005, -1933, -1921, -1928, -1912, -1884, -1869, -1846, -1784, -1706, -1666, -1664, -1645, -1576, -1480, -1387, -1303, -1232, -1184, -1157, -1128, -1089, -1059, -1057, -1059, -1030, -969, -910, -874, -836, -767, -682, -648, -705, -801, -838, -779, -701, -706, -799, -879, -879, -840, -835, -867, -888, -895, -912, -951, -995, -1040, -1076, -1092, -1105, -1137, -1158, -1117, -1020, -922, -850, -810, -796, -768, -686, -588, -550, -564, -545, -443, -277, -86, 87, 203, 273, 373, 546, 748, 904, 962, 926, 851, 828, 909, 1059, 1196, 1266, 1256, 1182, 1101, 1079, 1117, 1129, 1030, 830, 628, 504, 445, 391, 325, 270, 230, 179, 124, 117, 172, 206, 141, 7, -91, -80, 20, 118, 138, 114, 162, 324, 501, 593, 617, 647, 704, 772, 856, 968, 1089, 1207, 1329, 1447, 1510, 1501, 1509, 1615, 1759, 1802, 1729, 1641, 1589, 1542, 1480, 1416, 1351, 1291, 1256, 1222, 1148, 1056, 999, 983, 963, 933, 915, 897, 868, 836, 796, 707, 573, 462, 441, 494, 546, 549, 520, 497, 489, 476, 454, 455, 499, 563, 603, 605, 594, 595, 609, 596, 521, 436, 458, 607, 724, 685, 561, 466, 389, 280, 195, 187, 196, 149, 88, 90, 137, 155, 140, 137, 160, 176, 175, 206, 302, 411, 455, 421, 365, 313, 257, 229, 277, 352, 326, 163, -14, -82, -54, -36, -65, -91, -95, -131, -236, -346, -376, -326, -286, -334, -443, -512, -488, -447, -486, -569, -604, -615, -666, -686, -588, -473, -487, -570, -572, -510, -497, -511, -458, -350, -271, -234, -182, -96, -32, -50, -129, -178, -144, -79, -36, 14, 93, 98, -22, -148, -137, -54, -61, -163, -241, -242, -240, -283, -325, -314, -271, -248, -245, -214, -145, -97, -116, -165, -170, -106, -33, -15, -9, 73, 213, 299, 306, 338, 452, 583, 656, 672, 673, 703, 795, 910, 939, 835, 685, 597, 600, 670, 758, 795, 757, 707, 671, 612, 537, 521, 566, 582, 553, 533, 508, 417, 293, 231, 225, 193, 143, 166, 272, 363, 382, 388, 417, 422, 390, 413, 546, 704, 810, 897, 1010, 1099, 1113, 1126, 1229, 1374, 1450, 1451, 1485, 1583, 1651, 1619, 1550, 1531, 1565, 1615, 1667, 1718, 1752, 1762, 1762, 1763, 1754, 1726, 1683, 1644, 1610, 1580, 1549, 1503, 1431, 1369, 1345, 1342, 1326, 1334, 1427, 1567, 1629, 1559, 1441, 1380, 1380, 1402, 1445, 1506, 1525, 1477, 1450, 1506, 1553, 1491, 1390, 1372, 1435, 1495, 1529, 1549, 1537, 1474, 1401, 1380, 1416, 1455, 1444, 1398, 1382, 1417, 1453, 1431, 1366, 1319, 1319, 1349, 1384, 1406, 1401, 1365, 1319, 1268, 1221, 1194, 1210, 1251, 1283, 1298, 1309, 1308, 1263, 1163, 1052, 990, 991, 1019, 1034, 1023, 998, 962, 897, 798, 692, 609, 559, 528, 507, 488, 458, 393, 284, 159, 63, 14, -21, -85, -177, -266, -323, -356, -378, -405, -441, -467, -475, -488, -539, -614, -653, -634, -599, -594, -592, -542, -465, -435, -476, -530, -551, -548, -538, -515, -484, -473, -490, -509, -505, -494, -527, -624, -734, -768, -707, -626, -598, -624, -667, -719, -790, -850, -863, -856, -876, -909, -892, -829, -783, -769, -725, -658, -648, -704, -729, -688, -640, -619, -589, -534, -480, -440, -408, -383, -347, -280, -215, -205, -246, -288, -307, -311, -289, -245, -239, -331, -466, -523, -465, -388, -370, -382, -388, -432, -539, -621, -591, -502, -478, -539, -597, -608, -601, -591, -551, -494, -490, -554, -597, -550, -482, -496, -560, -563, -520, -543, -620, -623, -550, -542, -619, -653, -615, -608, -663, -701, -705, -744, -822, -878, -886, -880, -900, -957, -1030, -1062, -1011, -906, -810, -762, -750, -750, -759, -760, -723, -657, -618, -614, -576, -490, -442, -475, -518, -507, -474, -451, -408, -331, -266, -251, -273, -295, -299, -292, -305, -335, -336, -299, -289, -340, -382, -353, -305, -322, -375, -392, -374, -376, -411, -439, -435, -425, -429, -424, -385, -317, -266, -252, -270, -311, -375, -443, -477, -475, -485, -534, -589, -605, -603, -643, -717, -764, -785, -847, -938, -956, -898, -885, -964, -1041, -1067, -1088, -1113, -1089, -1040, -1036, -1051, -1026, -978, -963, -959, -934, -920, -940, -952, -917, -863, -835, -815, -767, -706, -679, -667, -625, -571, -554, -569, -571, -566, -576, -578, -555, -539, -544, -548, -545, -563, -588, -577, -548, -559, -616, -664, -662, -613, -551, -516, -518, -537, -539, -515, -461, -385, -325, -312, -311, -266, -194, -164, -176, -174, -150, -144, -153, -138, -101, -95, -139, -197, -220, -188, -132, -97, -89, -87, -86, -109, -153, -182, -186, -217, -302, -378, -368, -312, -309, -355, -354, -301, -296, -349, -360, -316, -317, -385, -413, -360, -322, -358, -402, -381, -337, -334, -336, -278, -201, -214, -323, -410, -412, -391, -407, -415, -364, -303, -306, -335, -301, -209, -144, -133, -127, -99, -75, -58, -12, 56, 86, 38, -43, -97, -117, -113, -85, -43, -46, -122, -227, -295, -304, -277, -258, -294, -381, -475, -548, -605, -629, -598, -538, -513, -539, -559, -537, -499, -482, -483, -480, -468, -462, -455, -403, -289, -169, -125, -136, -115, -42, 23, 76, 164, 265, 302, 284, 295, 353, 387, 375, 370, 401, 432, 433, 431, 453, 469, 432, 355, 301, 282, 233, 127, 52, 67, 83, -2, -130, -187, -201, -251, -311, -310, -282, -301, -336, -313, -251, -234, -262, -257, -193, -138, -140, -161, -149, -119, -98, -73, -22, 43, 98, 119, 93, 44, 22, 33, 47, 61, 103, 168, 211, 212, 208, 230, 256, 255, 239, 239, 249, 240, 207, 175, 155, 139, 129, 154, 212, 237, 192, 137, 150, 208, 236, 227, 233, 258, 266, 262, 285, 330, 362, 378, 395, 408, 403, 376, 341, 327, 352, 391, 414, 430, 462, 494, 503, 510, 546, 586, 611, 651, 730, 789, 777, 735, 739, 788, 811, 803, 830, 904, 949, 929, 903, 917, 952, 987, 1020, 1019, 951, 875, 878, 940, 966, 939, 915, 915, 898, 856, 837, 847, 825, 758, 727, 777, 831, 825, 802, 806, 807, 778, 758, 777, 802, 799, 779, 768, 768, 770, 772, 770, 755, 734, 732, 760, 792, 797, 777, 760, 767, 804, 863, 904, 903, 879, 869, 865, 842, 811, 803, 810, 799, 774, 775, 796, 774, 694, 634, 636, 651, 644, 644, 655, 619, 538, 496, 526, 557, 533, 500, 507, 521, 501, 473, 471, 461, 409, 359, 367, 391, 374, 349, 371, 409, 410, 404, 442, 495, 505, 482, 469, 474, 468, 452, 449, 454, 451, 453, 493, 539, 540, 508, 501, 521, 512, 461, 420, 422, 434, 431, 435, 469, 499, 485, 443, 415, 404, 392, 387, 403, 423, 425, 425, 455, 499, 512, 492, 484, 506, 514, 474, 422, 415, 452, 481, 474, 454, 438, 418, 380, 339, 319, 313, 292, 247, 207, 204, 219, 208, 157, 101, 78, 72, 45, 0, -32, -37, -36, -45, -57, -68, -95, -142, -188, -215, -225, -235, -244, -242, -239, -248, -260, -255, -241, -256, -307, -355, -353, -316, -296, -313, -334, -331, -315, -311, -321, -323, -311, -302, -315, -331, -313, -264, -235, -252, -288, -294, -275, -260, -246, -210, -183, -217, -285, -290, -218, -180, -228, -274, -250, -205, -190, -167, -104, -48, -41, -37, 0, 17, -42, -112, -104, -56, -74, -141, -158, -116, -102, -133, -145, -126, -126, -152, -156, -127, -116, -149, -182, -182, -176, -203, -240, -249, -239, -235, -238, -239, -235, -224, -206, -202, -217, -218, -183, -142, -136, -154, -155, -138, -144, -177, -191, -173, -169, -199, -216, -184, -151, -171, -216, -218, -183, -173, -206, -228, -218, -218, -250, -272, -247, -208, -198, -209, -214, -218, -240, -262, -258, -244, -252, -272, -272, -267, -285, -312, -312, -304, -317, -335, -327, -309, -303, -307, -310, -314, -314, -293, -257, -241, -264, -290, -275, -228, -190, -175, -170, -164, -164, -161, -141, -116, -108, -115, -108, -89, -79, -82, -75, -54, -46, -58, -65, -57, -64, -90, -105, -94, -89, -107, -119, -107, -90, -94, -110, -118, -120, -136, -161, -181, -182, -175, -171, -174, -182, -186, -183, -173, -169, -183, -198, -194, -174, -165, -177, -183, -166, -151, -152, -152, -143, -141, -149, -144, -122, -105, -107, -113, -105, -90, -84, -83, -73, -56, -51, -55, -55, -44, -36, -40, -41, -33, -25, -28, -33, -31, -26, -29, -33, -31, -25, -24, -28, -28, -28, -30, -35, -40, -43, -45, -45, -40, -36, -41, -47, -47, -40, -35, -40, -44, -44, -41, -41, -44, -46, -44, -41, -40, -43, -44, -40, -33, -32, -34, -36, -35, -33, -35, -36, -35, -32, -32, -32, -31, -31, -33, -33, -30, -26, -26, -26, -26, -28, -30, -29, -25, -23, -24, -25, -23, -23, -24, -23, -22, -22, -24, -25, -22, -19, -19, -19, -17, -15, -17, -17, -13, -12, -14, -15, -13, -10, -9, -11, -12, -12, -10, -9, -9, -8, -6, -6, -8, -9, -9, -8, -7, -7, -7, -7, -7, -7, -7, -7, -7, -4, -3, -3, -6, -6, -4, -3, -3, -3, -3, -3, -2, -2, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, 0, 0, -1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0 };
+// IMA ADPCM blocks, see audio_adpcm.h
+static const uint8_t __in_flash("audio_searching_for_a_gps_signal_sample_data") audio_searching_for_a_gps_signal_sample_data[] = { 0, 0, 0, 0, 255, 243, 223, 103, 168, 42, 130, 155, 51, 251, 25, 34, 1, 185, 204, 10, 53, 1, 184, 91, 134, 139, 131, 173, 33, 152, 25, 54, 192, 171, 16, 84, 160, 141, 16, 33, 145, 170, 171, 1, 137, 86, 129, 219, 155, 84, 35, 184, 188, 155, 114, 20, 152, 219, 10, 50, 35, 160, 187, 171, 56, 22, 66, 194, 191, 48, 19, 144, 154, 153, 9, 66, 5, 204, 57, 21, 184, 154, 8, 48, 21, 185, 170, 140, 84, 18, 161, 190, 11, 82, 21, 160, 187, 137, 64, 21, 185, 8, 153, 41, 68, 177, 172, 48, 18, 162, 191, 81, 145, 138, 0, 170, 48, 18, 87, 233, 10, 20, 168, 138, 49, 145, 10, 145, 56, 179, 158, 50, 130, 153, 193, 143, 51, 160, 170, 12, 87, 144, 188, 32, 2, 138, 68, 192, 172, 33, 129, 83, 177, 140, 176, 140, 70, 129, 172, 24, 32, 128, 9, 144, 9, 18, 202, 57, 22, 201, 41, 21, 185, 10, 146, 42, 55, 233, 139, 33, 16, 0, 25, 3, 206, 26, 68, 161, 139, 19, 172, 40, 32, 39, 250, 9, 130, 137, 66, 145, 154, 217, 28, 23, 144, 168, 10, 18, 25, 39, 217, 138, 24, 22, 201, 24, 1, 152, 9, 18, 16, 168, 24, 233, 11, 102, 145, 173, 32, 34, 169, 40, 193, 10, 130, 16, 0, 136, 57, 166, 207, 64, 130, 187, 66, 177, 42, 3, 171, 66, 249, 26, 37, 136, 136, 202, 41, 21, 218, 72, 131, 187, 9, 137, 103, 145, 188, 32, 129, 24, 17, 152, 185, 157, 84, 144, 10, 145, 11, 54, 202, 41, 18, 153, 8, 137, 16, 250, 59, 55, 169, 9, 161, 155, 53, 192, 41, 20, 220, 9, 50, 19, 234, 26, 20, 201, 137, 48, 37, 234, 10, 67, 176, 155, 34, 8, 99, 192, 172, 33, 1, 49, 177, 207, 16, 19, 129, 154, 129, 203, 24, 53, 130, 186, 11, 18, 153, 84, 176, 171, 189, 114, 23, 186, 154, 72, 36, 184, 139, 160, 80, 6, 187, 24, 35, 217, 42, 4, 172, 65, 161, 11, 37, 201, 26, 18, 128, 129, 191, 80, 3, 155, 1, 187, 24, 84, 178, 140, 2, 154, 48, 4, 202, 202, 26, 119, 144, 155, 0, 0, 33, 130, 169, 153, 189, 80, 37, 169, 9, 168, 41, 2, 42, 39, 234, 155, 34, 35, 18, 177, 223, 9, 17, 67, 144, 136, 221, 40, 20, 152, 8, 169, 42, 53, 184, 26, 131, 190, 41, 52, 1, 168, 205, 25, 51, 0, 18, 248, 171, 48, 20, 0, 185, 13, 130, 156, 71, 161, 154, 152, 138, 84, 3, 204, 10, 18, 17, 130, 220, 26, 37, 144, 156, 66, 177, 173, 64, 35, 201, 155, 66, 129, 136, 168, 9, 168, 112, 21, 202, 156, 49, 35, 1, 202, 203, 25, 54, 146, 189, 40, 34, 129, 218, 154, 25, 119, 145, 172, 25, 51, 129, 202, 24, 160, 27, 69, 145, 169, 186, 26, 53, 18, 152, 235, 11, 83, 82, 4, 62, 0, 145, 11, 2, 169, 152, 32, 178, 112, 135, 174, 33, 1, 128, 170, 25, 37, 176, 171, 32, 18, 50, 176, 220, 187, 97, 68, 193, 158, 49, 1, 168, 170, 24, 70, 160, 172, 33, 145, 10, 51, 161, 189, 41, 38, 168, 140, 33, 2, 169, 171, 56, 71, 176, 175, 64, 3, 186, 9, 33, 18, 169, 202, 140, 115, 3, 186, 9, 169, 40, 37, 128, 129, 219, 154, 99, 4, 170, 154, 8, 34, 53, 224, 173, 80, 130, 154, 128, 16, 2, 218, 139, 68, 1, 16, 202, 171, 0, 50, 85, 177, 207, 25, 67, 2, 152, 188, 26, 35, 65, 146, 172, 188, 97, 3, 153, 202, 58, 23, 153, 128, 153, 17, 170, 115, 131, 201, 157, 34, 144, 80, 146, 186, 169, 41, 71, 160, 155, 0, 16, 34, 160, 190, 72, 132, 154, 9, 81, 131, 191, 32, 18, 1, 218, 138, 33, 2, 67, 193, 190, 10, 68, 130, 9, 184, 143, 50, 2, 184, 156, 24, 16, 99, 161, 173, 17, 152, 56, 37, 185, 158, 64, 2, 185, 138, 82, 20, 219, 10, 1, 1, 160, 41, 36, 0, 249, 141, 82, 129, 186, 11, 53, 129, 152, 204, 26, 53, 17, 185, 205, 24, 50, 51, 201, 137, 235, 57, 37, 8, 200, 172, 65, 35, 184, 138, 1, 205, 65, 19, 152, 169, 203, 73, 6, 136, 145, 187, 0, 18, 51, 147, 174, 16, 234, 73, 37, 160, 219, 154, 64, 54, 176, 157, 0, 16, 17, 128, 24, 249, 139, 83, 130, 153, 153, 170, 41, 86, 146, 187, 9, 16, 18, 8, 201, 88, 132, 174, 40, 50, 146, 173, 24, 128, 40, 53, 184, 138, 234, 27, 100, 130, 202, 155, 66, 35, 168, 173, 32, 1, 1, 185, 27, 67, 185, 9, 136, 70, 152, 128, 190, 65, 18, 185, 139, 17, 99, 176, 13, 128, 73, 5, 173, 33, 145, 8, 137, 48, 132, 222, 138, 100, 3, 235, 10, 33, 18, 136, 152, 170, 41, 129, 32, 19, 202, 157, 48, 52, 147, 239, 41, 18, 16, 146, 203, 154, 41, 54, 144, 0, 232, 173, 83, 131, 154, 136, 152, 136, 24, 85, 161, 157, 136, 8, 99, 129, 187, 9, 16, 33, 1, 50, 249, 158, 16, 67, 145, 187, 156, 82, 3, 153, 16, 217, 138, 17, 52, 232, 25, 5, 185, 154, 50, 2, 32, 161, 255, 41, 37, 184, 155, 32, 20, 137, 128, 188, 56, 2, 64, 37, 249, 173, 65, 20, 184, 170, 10, 83, 35, 249, 139, 17, 19, 129, 184, 174, 49, 35, 160, 202, 138, 33, 21, 168, 154, 10, 68, 17, 177, 239, 40, 83, 146, 220, 9, 49, 2, 144, 170, 137, 137, 115, 2, 169, 172, 9, 83, 50, 200, 173, 24, 81, 3, 188, 24, 8, 49, 168, 0, 186, 68, 251, 57, 18, 0, 184, 156, 56, 20, 128, 128, 251, 138, 98, 19, 218, 138, 16, 36, 200, 25, 129, 129, 185, 9, 115, 147, 191, 56, 36, 168, 154, 8, 136, 73, 247, 59, 0, 48, 54, 193, 174, 24, 34, 17, 129, 206, 57, 4, 218, 32, 20, 186, 137, 0, 66, 146, 188, 9, 48, 54, 160, 189, 9, 50, 18, 144, 186, 156, 65, 2, 65, 200, 172, 32, 34, 2, 253, 41, 35, 168, 171, 32, 67, 132, 205, 137, 65, 52, 176, 220, 139, 99, 2, 154, 136, 170, 152, 113, 38, 169, 187, 137, 67, 33, 2, 220, 139, 49, 21, 169, 153, 9, 83, 160, 25, 200, 13, 52, 136, 0, 185, 203, 41, 36, 98, 132, 204, 138, 16, 84, 145, 172, 8, 16, 0, 17, 144, 139, 144, 155, 84, 34, 3, 255, 26, 34, 35, 218, 171, 0, 99, 2, 144, 235, 155, 98, 18, 137, 153, 187, 40, 55, 128, 186, 172, 48, 54, 160, 170, 128, 152, 24, 83, 130, 235, 138, 66, 131, 235, 25, 53, 161, 188, 137, 33, 35, 16, 185, 188, 9, 53, 19, 129, 239, 10, 36, 1, 8, 203, 140, 65, 51, 161, 190, 138, 82, 18, 152, 154, 168, 27, 39, 152, 16, 200, 141, 82, 144, 24, 2, 236, 10, 36, 1, 128, 218, 139, 83, 1, 136, 155, 8, 170, 114, 19, 168, 172, 137, 48, 69, 130, 251, 171, 64, 52, 161, 203, 137, 32, 51, 129, 156, 136, 189, 112, 19, 153, 170, 153, 0, 97, 20, 203, 26, 1, 1, 144, 171, 72, 22, 185, 137, 138, 100, 144, 138, 130, 219, 96, 131, 138, 144, 173, 49, 5, 153, 0, 185, 26, 69, 160, 11, 129, 8, 201, 98, 145, 138, 218, 56, 37, 0, 169, 172, 156, 102, 160, 138, 0, 16, 130, 152, 186, 80, 132, 172, 56, 19, 161, 189, 57, 35, 176, 11, 130, 72, 133, 187, 136, 138, 87, 144, 154, 137, 130, 172, 114, 19, 184, 190, 72, 35, 153, 187, 88, 4, 153, 184, 27, 37, 8, 224, 12, 39, 202, 25, 18, 32, 147, 191, 41, 2, 33, 184, 137, 144, 152, 112, 6, 202, 10, 34, 2, 9, 193, 175, 66, 1, 129, 204, 24, 131, 170, 115, 147, 189, 16, 129, 34, 147, 205, 26, 51, 136, 67, 249, 139, 32, 51, 144, 201, 157, 65, 2, 128, 152, 186, 139, 68, 129, 81, 195, 191, 56, 36, 168, 24, 217, 41, 18, 128, 153, 2, 138, 148, 191, 83, 145, 154, 48, 161, 11, 4, 172, 70, 200, 139, 18, 34, 130, 235, 171, 68, 161, 42, 3, 204, 8, 1, 83, 130, 205, 11, 83, 129, 168, 153, 129, 24, 20, 186, 56, 163, 159, 66, 184, 16, 129, 17, 220, 72, 131, 189, 72, 20, 185, 41, 146, 187, 24, 65, 69, 161, 207, 10, 83, 4, 186, 138, 16, 17, 129, 9, 16, 252, 43, 54, 160, 187, 0, 33, 52, 184, 189, 25, 51, 32, 3, 222, 138, 67, 162, 10, 3, 190, 64, 18, 153, 154, 50, 184, 80, 192, 12, 3, 155, 69, 130, 221, 25, 34, 16, 146, 174, 8, 48, 21, 203, 40, 0, 152, 9, 2, 137, 19, 191, 88, 37, 200, 116, 6, 67, 0, 140, 16, 40, 20, 220, 56, 3, 153, 201, 138, 66, 37, 192, 156, 32, 128, 40, 22, 217, 154, 136, 85, 146, 187, 9, 128, 82, 131, 171, 170, 26, 52, 18, 177, 141, 160, 58, 132, 58, 5, 203, 173, 80, 20, 0, 184, 175, 16, 48, 52, 201, 153, 187, 97, 35, 160, 187, 153, 73, 23, 168, 8, 144, 155, 40, 36, 2, 202, 156, 18, 24, 50, 145, 170, 186, 157, 129, 114, 55, 188, 186, 73, 54, 145, 172, 9, 128, 97, 130, 172, 9, 48, 18, 128, 220, 27, 67, 2, 185, 41, 241, 156, 68, 131, 201, 155, 65, 17, 17, 235, 138, 24, 84, 129, 202, 156, 50, 35, 145, 218, 138, 25, 68, 144, 171, 17, 128, 51, 251, 137, 9, 87, 146, 204, 10, 51, 17, 152, 154, 203, 42, 55, 2, 203, 170, 25, 84, 1, 169, 170, 139, 85, 146, 139, 136, 136, 34, 144, 153, 113, 162, 159, 32, 0, 16, 184, 24, 17, 217, 12, 68, 160, 8, 200, 24, 0, 17, 57, 151, 191, 98, 145, 153, 137, 0, 83, 177, 156, 16, 0, 0, 9, 33, 184, 171, 82, 147, 187, 8, 17, 176, 60, 103, 144, 219, 156, 114, 3, 186, 138, 32, 51, 152, 204, 155, 85, 18, 201, 154, 128, 32, 20, 24, 145, 221, 9, 66, 129, 138, 152, 9, 2, 8, 131, 223, 64, 131, 171, 49, 1, 128, 238, 25, 37, 1, 168, 204, 9, 51, 129, 0, 160, 191, 32, 52, 131, 202, 186, 139, 53, 19, 19, 237, 155, 65, 35, 168, 185, 140, 69, 160, 138, 152, 56, 1, 114, 161, 173, 137, 64, 20, 0, 200, 171, 136, 40, 39, 145, 187, 0, 155, 86, 145, 219, 26, 38, 144, 171, 16, 144, 41, 22, 144, 168, 189, 16, 53, 130, 9, 249, 155, 32, 99, 2, 170, 203, 10, 83, 19, 168, 187, 153, 65, 52, 176, 174, 33, 184, 58, 87, 160, 171, 138, 98, 3, 169, 152, 186, 140, 115, 19, 168, 186, 155, 64, 53, 146, 174, 8, 0, 145, 41, 21, 169, 185, 139, 81, 53, 160, 187, 157, 48, 37, 130, 186, 9, 251, 57, 54, 144, 187, 173, 114, 18, 186, 138, 2, 137, 53, 192, 138, 136, 10, 115, 147, 156, 1, 185, 40, 52, 160, 8, 235, 10, 48, 52, 129, 251, 154, 17, 66, 21, 234, 139, 18, 17, 51, 160, 207, 10, 49, 66, 130, 234, 138, 18, 137, 83, 144, 171, 138, 33, 34, 130, 157, 68, 200, 139, 136, 33, 52, 161, 173, 152, 8, 85, 161, 157, 1, 188, 115, 131, 153, 144, 203, 57, 53, 152, 8, 235, 25, 35, 32, 4, 219, 171, 64, 18, 130, 187, 136, 155, 53, 8, 35, 220, 138, 33, 146, 113, 162, 158, 1, 138, 69, 184, 11, 128, 25, 54, 1, 201, 139, 144, 43, 5, 155, 51, 169, 156, 115, 160, 9, 152, 115, 146, 189, 9, 1, 114, 146, 186, 24, 152, 154, 65, 36, 19, 251, 41, 147, 174, 131, 237, 67, 0, 33, 2, 0, 233, 12, 35, 24, 36, 202, 136, 17, 250, 57, 3, 137, 144, 203, 25, 67, 129, 153, 82, 192, 188, 11, 119, 145, 170, 8, 160, 57, 6, 153, 1, 185, 9, 100, 130, 156, 1, 187, 41, 52, 3, 136, 253, 11, 50, 36, 1, 235, 171, 56, 54, 145, 186, 185, 156, 100, 3, 184, 154, 139, 65, 51, 160, 156, 154, 16, 129, 72, 19, 170, 136, 152, 188, 115, 164, 157, 34, 18, 19, 252, 155, 16, 50, 53, 176, 189, 154, 49, 68, 3, 235, 154, 16, 50, 1, 130, 236, 138, 51, 1, 8, 202, 10, 17, 35, 16, 193, 175, 24, 83, 177, 158, 66, 160, 138, 49, 129, 137, 8, 9, 169, 24, 184, 114, 23, 136, 185, 172, 9, 66, 83, 2, 251, 172, 48, 52, 1, 184, 172, 137, 48, 37, 136, 219, 154, 16, 85, 146, 169, 168, 171, 96, 53, 176, 154, 201, 11, 68, 130, 153, 152, 170, 114, 36, 168, 188, 136, 40, 70, 160, 174, 8, 17, 50, 18, 202, 173, 40, 1, 33, 161, 138, 136, 17, 170, 84, 192, 171, 137, 114, 20, 144, 186, 9, 144, 81, 21, 201, 188, 138, 97, 52, 18, 202, 157, 8, 16, 34, 130, 185, 171, 56, 71, 184, 156, 40, 33, 0, 1, 234, 154, 50, 67, 36, 233, 187, 170, 72, 37, 8, 34, 234, 155, 0, 0, 51, 176, 27, 144, 172, 64, 38, 176, 11, 160, 171, 0, 137, 8, 48, 82, 19, 251, 9, 249, 11, 68, 2, 8, 32, 216, 188, 10, 34, 99, 20, 234, 155, 24, 83, 34, 144, 218, 156, 48, 35, 17, 184, 174, 136, 65, 20, 152, 188, 171, 49, 53, 147, 188, 40, 20, 169, 88, 146, 173, 32, 144, 26, 36, 233, 140, 50, 20, 35, 192, 188, 137, 81, 20, 152, 154, 188, 41, 68, 19, 1, 202, 188, 40, 67, 100, 19, 136, 33, 17, 66, 36, 1, 152, 138, 66, 17, 99, 161, 171, 1, 8, 66, 51, 38, 129, 136, 128, 217, 205, 186, 202, 138, 145, 186, 170, 206, 10, 35, 200, 205, 219, 170, 152, 170, 187, 205, 171, 152, 218, 138, 152, 8, 160, 170, 154, 153, 253, 157, 8, 152, 136, 152, 138, 98, 51, 51, 35, 0, 16, 17, 52, 67, 36, 52, 132, 24, 71, 19, 65, 52, 128, 66, 161, 9, 20, 203, 25, 217, 156, 184, 173, 66, 130, 155, 35, 236, 10, 129, 170, 66, 232, 172, 136, 144, 24, 35, 200, 154, 17, 185, 115, 5, 202, 170, 0, 34, 20, 218, 138, 49, 19, 101, 36, 184, 10, 34, 1, 83, 145, 139, 69, 2, 136, 137, 40, 37, 185, 114, 21, 137, 33, 145, 24, 1, 136, 18, 250, 171, 185, 191, 205, 172, 25, 17, 99, 53, 18, 33, 1, 32, 67, 129, 8, 129, 188, 10, 100, 51, 18, 68, 2, 32, 83, 34, 36, 19, 0, 0, 152, 220, 170, 170, 154, 137, 49, 21, 169, 25, 145, 219, 205, 219, 206, 132, 66, 59, 0, 187, 185, 187, 202, 187, 187, 188, 138, 168, 171, 153, 219, 188, 205, 202, 203, 203, 186, 187, 154, 32, 34, 18, 8, 83, 52, 3, 170, 24, 129, 186, 42, 119, 35, 16, 66, 52, 68, 36, 34, 51, 129, 9, 16, 201, 171, 137, 145, 220, 10, 66, 3, 153, 32, 132, 236, 170, 219, 188, 138, 169, 174, 170, 136, 136, 170, 56, 69, 19, 136, 161, 190, 219, 171, 16, 34, 3, 153, 32, 115, 52, 53, 20, 128, 153, 26, 50, 0, 153, 1, 252, 57, 37, 81, 37, 17, 83, 34, 66, 17, 0, 152, 188, 140, 32, 128, 33, 52, 52, 18, 128, 217, 204, 25, 1, 136, 0, 203, 171, 218, 189, 237, 206, 171, 153, 41, 87, 51, 52, 35, 1, 137, 16, 17, 136, 152, 169, 187, 81, 55, 52, 51, 36, 2, 0, 33, 34, 129, 8, 160, 189, 204, 204, 204, 171, 137, 1, 33, 67, 2, 201, 188, 251, 188, 187, 204, 171, 172, 186, 171, 153, 137, 16, 0, 18, 168, 170, 169, 251, 186, 218, 189, 189, 187, 154, 137, 82, 84, 50, 82, 67, 17, 33, 17, 0, 1, 136, 24, 168, 139, 66, 18, 115, 55, 18, 50, 35, 1, 137, 0, 185, 191, 187, 221, 173, 171, 186, 171, 138, 16, 34, 160, 137, 2, 220, 171, 204, 204, 203, 172, 155, 152, 8, 49, 69, 67, 18, 50, 68, 18, 33, 50, 17, 153, 154, 201, 172, 137, 16, 67, 53, 68, 53, 35, 67, 17, 128, 152, 218, 188, 204, 171, 154, 24, 18, 16, 115, 51, 67, 19, 50, 3, 219, 154, 251, 171, 152, 202, 170, 16, 152, 25, 38, 18, 51, 130, 201, 255, 204, 138, 17, 48, 119, 51, 50, 50, 50, 34, 18, 35, 129, 219, 171, 154, 65, 53, 53, 67, 50, 17, 33, 17, 0, 0, 169, 204, 204, 204, 188, 173, 171, 170, 137, 152, 153, 136, 235, 171, 185, 191, 219, 203, 203, 172, 186, 171, 137, 9, 32, 35, 67, 51, 51, 35, 17, 18, 185, 236, 187, 154, 187, 120, 69, 67, 52, 53, 35, 51, 35, 33, 18, 129, 144, 168, 171, 205, 155, 136, 138, 49, 17, 50, 177, 191, 137, 253, 171, 201, 190, 172, 172, 172, 172, 170, 170, 138, 136, 136, 8, 136, 40, 2, 171, 136, 237, 188, 170, 171, 137, 83, 69, 66, 68, 35, 67, 36, 34, 50, 35, 33, 17, 136, 137, 153, 136, 153, 81, 20, 32, 53, 18, 66, 20, 16, 17, 233, 221, 188, 187, 205, 170, 8, 152, 11, 51, 34, 67, 83, 36, 130, 201, 137, 219, 173, 169, 170, 153, 170, 25, 52, 1, 86, 145, 136, 201, 155, 115, 84, 85, 52, 50, 51, 19, 34, 33, 0, 128, 185, 204, 187, 10, 98, 68, 36, 34, 34, 16, 0, 1, 168, 219, 219, 220, 203, 203, 186, 171, 154, 137, 16, 1, 187, 202, 205, 203, 188, 171, 204, 172, 187, 172, 170, 153, 16, 67, 67, 51, 53, 34, 51, 51, 34, 109, 242, 47, 0, 145, 186, 189, 174, 138, 25, 84, 68, 68, 51, 67, 35, 34, 1, 8, 168, 204, 187, 219, 187, 171, 10, 128, 24, 67, 1, 136, 201, 190, 203, 189, 188, 203, 203, 203, 187, 203, 187, 170, 153, 136, 50, 34, 99, 35, 18, 50, 3, 152, 221, 171, 153, 136, 64, 87, 67, 51, 84, 50, 34, 34, 50, 2, 17, 144, 169, 202, 155, 168, 138, 48, 35, 217, 154, 169, 204, 138, 176, 223, 185, 188, 189, 205, 187, 171, 170, 154, 169, 17, 128, 48, 119, 18, 81, 20, 8, 136, 129, 187, 24, 185, 65, 145, 203, 80, 177, 105, 22, 34, 20, 136, 153, 169, 206, 72, 55, 35, 69, 36, 17, 17, 17, 0, 136, 152, 219, 203, 154, 136, 66, 52, 83, 34, 18, 0, 136, 153, 218, 204, 204, 171, 203, 172, 170, 169, 137, 33, 136, 8, 184, 205, 188, 171, 202, 170, 186, 205, 171, 187, 155, 144, 48, 70, 51, 51, 84, 51, 51, 37, 18, 1, 168, 188, 204, 187, 138, 24, 84, 68, 67, 36, 34, 18, 33, 128, 169, 202, 189, 189, 172, 171, 170, 9, 136, 8, 129, 170, 154, 219, 188, 185, 203, 188, 205, 219, 187, 188, 203, 154, 153, 153, 8, 50, 99, 84, 52, 51, 20, 18, 16, 152, 137, 136, 0, 49, 53, 52, 53, 99, 35, 51, 52, 19, 0, 136, 204, 187, 172, 170, 203, 170, 185, 205, 171, 171, 169, 170, 32, 129, 187, 170, 250, 189, 169, 186, 219, 203, 170, 170, 172, 96, 52, 69, 51, 51, 2, 32, 129, 137, 33, 82, 161, 13, 20, 172, 68, 1, 54, 184, 66, 250, 154, 202, 41, 54, 53, 69, 50, 50, 18, 18, 16, 2, 169, 188, 221, 187, 154, 24, 50, 69, 67, 18, 2, 17, 16, 169, 186, 251, 191, 186, 203, 203, 154, 152, 8, 16, 0, 8, 137, 170, 187, 171, 219, 220, 188, 203, 203, 154, 9, 0, 0, 67, 52, 34, 70, 36, 50, 67, 34, 1, 152, 186, 205, 186, 155, 9, 0, 100, 83, 66, 34, 67, 18, 16, 130, 186, 205, 203, 188, 203, 186, 169, 153, 168, 9, 152, 170, 137, 8, 185, 138, 249, 205, 203, 188, 188, 187, 203, 171, 171, 153, 24, 55, 53, 38, 67, 34, 34, 18, 1, 168, 24, 185, 170, 172, 0, 136, 99, 69, 36, 51, 67, 35, 130, 8, 168, 235, 188, 172, 204, 172, 170, 171, 153, 136, 48, 51, 52, 50, 35, 168, 219, 204, 188, 188, 188, 170, 170, 137, 67, 69, 67, 51, 67, 19, 49, 51, 19, 34, 3, 136, 250, 156, 145, 157, 83, 184, 8, 234, 153, 188, 113, 54, 53, 52, 68, 18, 18, 18, 17, 0, 170, 187, 206, 187, 153, 24, 66, 68, 36, 34, 34, 2, 1, 144, 186, 237, 172, 204, 172, 170, 155, 137, 8, 18, 1, 33, 128, 152, 187, 188, 236, 204, 171, 186, 188, 137, 8, 0, 34, 52, 35, 52, 99, 34, 50, 37, 129, 16, 169, 173, 93, 1, 47, 0, 186, 171, 171, 138, 50, 71, 67, 84, 51, 51, 36, 35, 129, 153, 218, 190, 203, 187, 188, 171, 153, 171, 152, 8, 8, 40, 49, 51, 160, 234, 206, 204, 188, 188, 187, 188, 172, 186, 137, 137, 66, 68, 68, 51, 67, 34, 34, 1, 128, 136, 186, 153, 203, 138, 144, 114, 37, 83, 52, 34, 51, 2, 2, 184, 136, 252, 155, 219, 171, 235, 154, 153, 138, 9, 32, 1, 67, 2, 33, 130, 171, 235, 205, 186, 219, 187, 155, 138, 32, 86, 51, 83, 37, 2, 50, 17, 35, 16, 18, 187, 168, 255, 25, 184, 42, 37, 17, 34, 0, 169, 42, 71, 84, 69, 67, 51, 51, 51, 19, 34, 17, 168, 220, 204, 170, 170, 41, 83, 83, 51, 36, 18, 17, 0, 168, 202, 236, 188, 219, 187, 187, 171, 9, 136, 34, 18, 24, 144, 203, 235, 188, 219, 188, 203, 187, 171, 170, 9, 33, 50, 69, 51, 51, 51, 37, 1, 67, 1, 136, 176, 171, 185, 140, 51, 98, 70, 34, 83, 35, 51, 68, 51, 66, 18, 129, 201, 202, 205, 187, 202, 172, 171, 170, 171, 137, 136, 32, 35, 17, 35, 201, 223, 188, 204, 173, 171, 172, 155, 170, 137, 9, 66, 52, 68, 67, 50, 51, 18, 144, 152, 186, 156, 8, 153, 56, 54, 66, 53, 84, 67, 33, 51, 130, 0, 184, 158, 200, 172, 169, 172, 202, 155, 152, 155, 34, 17, 52, 33, 2, 202, 206, 170, 203, 171, 204, 137, 169, 8, 33, 87, 35, 83, 35, 1, 16, 129, 136, 49, 146, 172, 17, 221, 25, 17, 117, 19, 17, 17, 152, 219, 58, 71, 67, 69, 51, 67, 34, 50, 34, 34, 1, 169, 204, 188, 172, 10, 33, 83, 52, 36, 34, 17, 17, 128, 185, 205, 235, 188, 188, 203, 171, 170, 137, 24, 1, 0, 153, 218, 203, 203, 203, 187, 219, 203, 186, 154, 154, 0, 1, 67, 2, 50, 3, 48, 54, 67, 83, 36, 18, 33, 144, 171, 8, 136, 64, 71, 50, 53, 52, 67, 67, 50, 19, 34, 168, 204, 204, 203, 187, 172, 170, 169, 153, 152, 138, 168, 187, 144, 235, 186, 205, 204, 204, 187, 204, 187, 186, 171, 187, 155, 9, 32, 54, 69, 52, 50, 35, 18, 136, 153, 204, 153, 169, 24, 0, 98, 52, 84, 52, 36, 36, 18, 18, 145, 137, 186, 189, 203, 202, 187, 172, 155, 170, 40, 51, 115, 21, 17, 130, 154, 203, 172, 188, 187, 173, 185, 157, 33, 16, 100, 36, 18, 34, 32, 19, 9, 52, 153, 2, 188, 152, 139, 36, 26, 119, 2, 0, 145, 9, 129, 58, 119, 55, 50, 52, 50, 51, 34, 35, 2, 144, 235, 203, 187, 11, 16, 84, 52, 66, 50, 33, 17, 128, 152, 235, 188, 204, 204, 187, 187, 171, 154, 0, 2, 1, 144, 152, 237, 172, 186, 205, 170, 172, 170, 187, 137, 153, 32, 34, 37, 19, 51, 2, 16, 20, 33, 67, 144, 8, 250, 140, 153, 151, 232, 42, 0, 56, 36, 116, 52, 67, 51, 67, 51, 33, 50, 131, 186, 204, 188, 205, 156, 153, 137, 136, 0, 33, 0, 138, 18, 189, 9, 221, 187, 190, 188, 204, 171, 187, 170, 186, 154, 128, 136, 67, 69, 51, 67, 36, 1, 169, 169, 204, 187, 155, 25, 17, 99, 68, 52, 52, 68, 50, 35, 18, 0, 201, 172, 185, 172, 154, 153, 171, 10, 2, 40, 103, 34, 51, 19, 128, 185, 206, 188, 171, 202, 156, 137, 136, 136, 84, 52, 83, 52, 17, 17, 152, 153, 8, 169, 138, 18, 168, 26, 87, 34, 114, 20, 128, 0, 217, 172, 9, 52, 116, 68, 66, 34, 34, 34, 17, 16, 144, 218, 187, 188, 187, 25, 68, 68, 52, 51, 34, 18, 17, 152, 187, 206, 235, 203, 186, 186, 187, 136, 17, 50, 68, 18, 128, 170, 221, 188, 204, 187, 203, 203, 154, 154, 152, 0, 34, 51, 52, 18, 33, 200, 170, 218, 155, 202, 156, 168, 155, 8, 80, 53, 83, 68, 36, 50, 35, 51, 19, 32, 2, 154, 220, 187, 218, 172, 9, 136, 66, 51, 69, 18, 17, 129, 186, 220, 203, 219, 203, 187, 188, 171, 170, 9, 8, 33, 18, 1, 169, 169, 205, 187, 190, 172, 189, 187, 170, 154, 16, 68, 52, 53, 51, 51, 36, 17, 17, 160, 171, 153, 204, 139, 99, 18, 114, 37, 34, 19, 34, 129, 154, 152, 187, 171, 155, 152, 171, 137, 82, 69, 35, 82, 21, 137, 38, 184, 96, 36, 1, 16, 19, 201, 27, 67, 35, 18, 115, 36, 0, 33, 50, 55, 144, 9, 130, 222, 154, 48, 85, 69, 68, 67, 35, 19, 18, 1, 168, 187, 203, 188, 188, 8, 65, 69, 67, 67, 18, 17, 128, 144, 186, 205, 204, 187, 187, 171, 137, 16, 82, 35, 67, 19, 176, 236, 219, 188, 188, 187, 171, 154, 9, 24, 32, 35, 35, 34, 144, 218, 205, 204, 187, 170, 155, 9, 24, 34, 34, 83, 34, 99, 67, 52, 52, 36, 35, 18, 128, 169, 202, 187, 172, 138, 0, 115, 67, 69, 36, 35, 18, 129, 218, 219, 203, 187, 187, 154, 24, 49, 51, 37, 2, 144, 203, 235, 189, 172, 188, 171, 155, 137, 8, 49, 18, 33, 1, 152, 201, 156, 153, 25, 19, 24, 54, 168, 40, 68, 68, 67, 52, 35, 67, 36, 34, 51, 34, 152, 169, 220, 172, 10, 32, 102, 53, 67, 68, 34, 17, 0, 144, 187, 153, 203, 171, 8, 82, 67, 85, 36, 50, 18, 8, 160, 204, 186, 171, 169, 11, 39, 16, 86, 18, 33, 51, 18, 201, 137, 184, 172, 116, 69, 51, 83, 51, 34, 1, 0, 153, 185, 187, 172, 187, 57, 86, 67, 51, 52, 19, 129, 128, 201, 221, 203, 187, 203, 154, 8, 16, 18, 34, 17, 144, 185, 254, 188, 204, 188, 186, 187, 137, 137, 16, 17, 34, 17, 144, 219, 235, 188, 188, 187, 187, 171, 153, 16, 34, 67, 52, 35, 33, 33, 50, 52, 70, 34, 136, 225, 42, 0, 1, 152, 251, 155, 128, 136, 99, 67, 51, 69, 51, 51, 51, 2, 185, 206, 219, 171, 172, 170, 24, 50, 83, 53, 35, 1, 145, 202, 203, 205, 203, 187, 187, 155, 9, 33, 83, 67, 34, 34, 2, 168, 187, 236, 172, 154, 188, 169, 153, 8, 49, 69, 53, 36, 35, 33, 1, 152, 186, 187, 205, 156, 170, 137, 67, 52, 70, 52, 53, 67, 34, 34, 2, 153, 137, 169, 171, 170, 139, 0, 116, 39, 67, 68, 18, 34, 18, 128, 160, 187, 170, 204, 188, 136, 33, 82, 84, 68, 50, 34, 67, 18, 184, 204, 188, 219, 154, 40, 68, 68, 52, 34, 34, 2, 137, 170, 188, 172, 203, 154, 137, 49, 83, 70, 50, 50, 51, 2, 184, 204, 204, 219, 170, 153, 136, 16, 49, 50, 36, 34, 2, 201, 220, 220, 187, 189, 170, 154, 138, 8, 32, 33, 0, 152, 219, 189, 188, 204, 171, 186, 187, 154, 144, 24, 20, 50, 130, 170, 251, 189, 154, 153, 1, 168, 48, 147, 156, 185, 88, 3, 113, 37, 18, 129, 186, 156, 153, 153, 170, 0, 184, 32, 152, 118, 19, 24, 82, 19, 168, 154, 251, 206, 187, 153, 187, 10, 136, 49, 87, 34, 34, 160, 157, 136, 169, 156, 65, 162, 189, 9, 18, 160, 25, 101, 84, 34, 152, 170, 186, 138, 32, 216, 11, 50, 17, 99, 70, 51, 36, 128, 170, 152, 8, 0, 185, 202, 42, 119, 20, 50, 34, 1, 136, 154, 10, 83, 1, 66, 2, 41, 87, 19, 0, 40, 51, 19, 136, 32, 1, 24, 66, 103, 35, 35, 18, 169, 202, 155, 80, 70, 35, 34, 36, 128, 187, 155, 128, 16, 51, 49, 36, 117, 51, 144, 137, 32, 35, 136, 16, 68, 2, 48, 147, 189, 188, 172, 169, 88, 39, 1, 1, 169, 170, 186, 220, 154, 153, 203, 170, 187, 189, 172, 185, 137, 160, 219, 190, 187, 220, 203, 170, 219, 188, 154, 136, 136, 186, 220, 186, 204, 154, 154, 171, 153, 251, 172, 171, 170, 186, 188, 170, 188, 171, 155, 16, 185, 203, 207, 171, 187, 153, 252, 154, 152, 137, 32, 33, 129, 218, 202, 205, 171, 170, 202, 138, 137, 10, 82, 54, 2, 169, 203, 188, 189, 155, 169, 9, 35, 2, 34, 128, 32, 145, 203, 186, 11, 145, 120, 119, 50, 53, 34, 1, 186, 187, 187, 25, 70, 68, 36, 66, 35, 18, 51, 145, 170, 137, 83, 67, 53, 67, 52, 18, 33, 50, 66, 68, 146, 9, 83, 66, 35, 1, 50, 53, 51, 67, 37, 153, 136, 170, 49, 51, 55, 34, 68, 33, 36, 129, 170, 170, 25, 1, 66, 69, 52, 18, 99, 1, 137, 187, 56, 130, 24, 17, 50, 168, 116, 37, 17, 16, 169, 9, 34, 176, 175, 32, 115, 23, 128, 0, 160, 188, 8, 176, 139, 68, 34, 82, 145, 188, 218, 203, 171, 154, 8, 1, 185, 156, 202, 173, 128, 169, 8, 234, 187, 186, 207, 172, 169, 139, 33, 51, 14, 34, 0, 152, 152, 253, 186, 170, 137, 17, 35, 34, 4, 218, 188, 206, 171, 154, 9, 33, 51, 19, 176, 223, 155, 201, 155, 152, 8, 129, 0, 251, 187, 188, 25, 152, 48, 177, 41, 179, 207, 219, 188, 189, 155, 8, 33, 130, 153, 83, 161, 16, 252, 158, 152, 137, 153, 170, 187, 10, 100, 52, 17, 33, 160, 206, 171, 170, 9, 49, 36, 17, 99, 17, 48, 208, 174, 154, 138, 66, 36, 17, 50, 3, 219, 138, 152, 170, 170, 138, 80, 103, 35, 1, 153, 169, 219, 8, 145, 72, 38, 2, 8, 24, 99, 2, 170, 136, 187, 104, 53, 50, 18, 129, 17, 34, 66, 53, 36, 49, 145, 223, 9, 0, 115, 52, 34, 128, 144, 187, 171, 170, 97, 69, 34, 144, 138, 0, 153, 33, 0, 49, 86, 36, 33, 146, 204, 138, 153, 34, 18, 82, 50, 18, 153, 51, 145, 33, 252, 12, 84, 3, 136, 33, 0, 185, 189, 170, 9, 69, 33, 1, 169, 237, 154, 1, 138, 1, 170, 80, 162, 189, 154, 154, 153, 220, 190, 138, 18, 17, 34, 216, 188, 172, 136, 144, 156, 216, 155, 0, 24, 53, 208, 187, 202, 173, 66, 2, 154, 185, 139, 144, 10, 69, 18, 208, 174, 128, 136, 33, 50, 36, 249, 205, 154, 65, 34, 67, 162, 189, 202, 155, 66, 34, 2, 201, 170, 187, 41, 51, 70, 3, 128, 236, 172, 154, 56, 54, 35, 1, 234, 189, 154, 8, 83, 36, 18, 185, 219, 154, 137, 40, 52, 18, 17, 176, 191, 138, 186, 48, 35, 50, 52, 35, 250, 174, 138, 49, 52, 145, 186, 169, 170, 56, 53, 1, 0, 222, 27, 53, 18, 161, 221, 154, 10, 115, 19, 128, 136, 168, 172, 25, 35, 33, 52, 176, 190, 137, 82, 70, 145, 154, 217, 155, 33, 67, 53, 1, 168, 205, 170, 9, 66, 68, 19, 184, 171, 203, 140, 49, 52, 66, 19, 233, 203, 138, 40, 51, 83, 35, 232, 156, 8, 152, 48, 36, 34, 145, 220, 139, 32, 34, 52, 145, 169, 219, 156, 17, 48, 84, 35, 160, 157, 169, 171, 49, 18, 101, 130, 153, 217, 189, 48, 36, 51, 131, 222, 154, 24, 32, 67, 129, 170, 186, 137, 33, 66, 130, 173, 50, 160, 138, 16, 176, 221, 137, 16, 83, 20, 8, 145, 154, 161, 255, 13, 17, 34, 129, 40, 129, 218, 25, 4, 203, 24, 131, 172, 98, 161, 172, 24, 17, 52, 176, 172, 170, 188, 41, 54, 18, 209, 174, 41, 34, 19, 128, 153, 188, 42, 54, 146, 236, 173, 57, 37, 1, 153, 153, 186, 25, 37, 128, 201, 156, 81, 35, 2, 152, 0, 234, 170, 155, 136, 27, 119, 18, 128, 188, 154, 137, 40, 20, 16, 99, 145, 190, 139, 16, 130, 137, 100, 19, 186, 153, 189, 56, 20, 128, 16, 3, 203, 186, 205, 169, 10, 103, 35, 1, 216, 172, 9, 9, 64, 51, 18, 1, 218, 173, 138, 24, 51, 67, 147, 188, 153, 208, 248, 49, 0, 57, 55, 219, 40, 161, 138, 17, 17, 99, 131, 218, 155, 16, 0, 1, 43, 119, 224, 138, 18, 144, 72, 35, 169, 204, 140, 33, 19, 40, 35, 168, 9, 233, 173, 49, 19, 48, 146, 207, 24, 18, 16, 17, 234, 156, 33, 152, 115, 3, 152, 169, 204, 137, 34, 32, 37, 168, 9, 200, 11, 66, 144, 9, 52, 225, 155, 202, 58, 55, 8, 1, 184, 172, 138, 0, 65, 38, 168, 112, 130, 188, 171, 169, 155, 117, 37, 145, 168, 203, 171, 40, 67, 52, 2, 217, 172, 8, 32, 35, 153, 128, 170, 48, 20, 18, 250, 175, 24, 34, 66, 130, 188, 9, 176, 26, 36, 8, 2, 186, 40, 67, 193, 255, 24, 35, 33, 2, 218, 172, 219, 25, 54, 34, 128, 186, 202, 10, 34, 145, 170, 137, 98, 68, 145, 186, 170, 170, 152, 88, 119, 146, 187, 154, 155, 80, 69, 129, 154, 169, 186, 9, 68, 19, 0, 0, 184, 223, 10, 17, 83, 19, 152, 186, 204, 155, 32, 84, 51, 144, 154, 234, 189, 40, 36, 33, 34, 129, 203, 173, 170, 136, 66, 54, 130, 170, 170, 203, 11, 100, 51, 145, 219, 139, 136, 153, 80, 53, 130, 185, 171, 185, 173, 49, 52, 36, 34, 145, 223, 171, 8, 67, 19, 34, 192, 174, 8, 16, 1, 17, 1, 170, 152, 171, 16, 200, 73, 70, 37, 200, 140, 136, 185, 24, 99, 34, 16, 201, 174, 8, 17, 65, 20, 200, 138, 32, 160, 172, 136, 16, 87, 129, 170, 136, 153, 25, 37, 168, 171, 72, 53, 200, 139, 129, 187, 99, 50, 35, 249, 171, 136, 9, 65, 19, 128, 8, 67, 233, 173, 25, 21, 184, 56, 51, 145, 188, 154, 80, 53, 250, 155, 18, 32, 53, 19, 250, 187, 169, 56, 39, 129, 138, 16, 168, 153, 16, 52, 233, 138, 66, 2, 235, 138, 33, 34, 168, 73, 36, 200, 188, 10, 17, 0, 82, 20, 170, 56, 232, 173, 32, 129, 113, 21, 201, 155, 24, 1, 24, 34, 17, 160, 205, 137, 8, 82, 4, 144, 186, 189, 139, 82, 52, 19, 144, 219, 157, 24, 136, 49, 18, 50, 250, 140, 18, 129, 154, 99, 146, 172, 137, 8, 153, 112, 53, 129, 235, 156, 8, 40, 84, 2, 185, 172, 16, 2, 0, 129, 202, 154, 49, 36, 37, 177, 205, 155, 56, 51, 35, 216, 141, 50, 17, 35, 236, 154, 171, 56, 69, 18, 136, 160, 204, 24, 136, 115, 147, 204, 25, 130, 154, 66, 34, 18, 185, 202, 220, 138, 64, 50, 99, 162, 155, 185, 172, 24, 67, 52, 21, 234, 187, 10, 18, 81, 53, 2, 219, 156, 9, 128, 152, 98, 36, 144, 154, 128, 217, 172, 40, 52, 35, 33, 152, 219, 190, 138, 83, 34, 145, 203, 137, 8, 64, 53, 130, 202, 187, 172, 72, 3, 8, 18, 48, 52, 217, 154, 234, 139, 34, 35, 129, 48, 130, 0, 222, 40, 161, 25, 146, 57, 22, 184, 156, 144, 233, 252, 56, 0, 43, 119, 178, 157, 138, 40, 69, 19, 185, 202, 171, 9, 32, 55, 129, 9, 145, 204, 8, 17, 1, 144, 8, 177, 223, 41, 68, 3, 152, 185, 188, 10, 16, 64, 54, 184, 138, 18, 184, 140, 129, 169, 138, 119, 130, 138, 136, 202, 138, 65, 17, 49, 161, 11, 20, 155, 50, 252, 189, 10, 99, 36, 2, 169, 220, 139, 1, 32, 54, 144, 137, 8, 233, 156, 32, 34, 2, 49, 146, 203, 205, 171, 65, 52, 36, 145, 205, 155, 137, 83, 51, 129, 186, 203, 171, 80, 36, 160, 9, 145, 137, 152, 9, 17, 32, 130, 105, 5, 136, 233, 154, 216, 89, 37, 144, 154, 9, 8, 128, 16, 51, 209, 173, 32, 144, 155, 116, 130, 10, 18, 185, 221, 10, 161, 28, 119, 130, 153, 168, 172, 8, 17, 68, 3, 169, 187, 154, 16, 160, 80, 54, 145, 187, 137, 152, 137, 81, 52, 129, 217, 188, 171, 40, 55, 35, 2, 200, 204, 139, 153, 137, 86, 20, 128, 170, 154, 138, 0, 33, 17, 33, 176, 157, 8, 25, 65, 85, 145, 172, 169, 220, 25, 85, 2, 169, 152, 152, 187, 72, 36, 16, 17, 219, 10, 18, 24, 20, 237, 25, 1, 8, 51, 20, 152, 204, 188, 27, 53, 18, 17, 152, 218, 173, 25, 52, 130, 40, 160, 172, 153, 8, 85, 145, 189, 41, 19, 168, 26, 99, 3, 169, 1, 186, 171, 152, 173, 117, 162, 10, 35, 168, 172, 41, 53, 248, 11, 34, 153, 72, 132, 188, 17, 185, 56, 38, 145, 138, 128, 9, 2, 203, 40, 130, 255, 41, 53, 1, 8, 137, 202, 156, 17, 1, 33, 194, 158, 64, 18, 34, 177, 206, 8, 129, 137, 65, 19, 234, 139, 48, 3, 8, 161, 174, 48, 130, 10, 52, 201, 10, 52, 250, 142, 34, 1, 35, 2, 218, 157, 16, 218, 137, 50, 2, 81, 21, 152, 186, 189, 138, 51, 35, 17, 160, 25, 132, 173, 82, 146, 187, 204, 137, 128, 114, 23, 160, 8, 144, 188, 138, 24, 50, 66, 71, 129, 204, 153, 152, 137, 66, 34, 19, 202, 155, 24, 35, 136, 184, 174, 154, 42, 119, 19, 168, 187, 169, 137, 128, 10, 83, 17, 85, 51, 160, 190, 171, 186, 138, 99, 36, 17, 1, 187, 138, 17, 185, 170, 203, 26, 71, 18, 0, 129, 203, 187, 25, 129, 170, 112, 54, 1, 24, 130, 207, 171, 138, 72, 69, 18, 129, 185, 171, 152, 33, 128, 152, 236, 155, 84, 19, 33, 130, 202, 189, 137, 0, 1, 136, 81, 70, 131, 218, 171, 170, 56, 69, 1, 168, 137, 0, 8, 34, 144, 169, 136, 202, 173, 56, 37, 114, 3, 186, 170, 205, 154, 8, 50, 69, 35, 0, 168, 204, 203, 10, 36, 128, 137, 0, 16, 86, 35, 168, 170, 205, 172, 25, 83, 35, 17, 168, 204, 138, 17, 144, 40, 18, 49, 3, 186, 188, 169, 189, 170, 188, 49, 55, 36, 34, 2, 168, 253, 173, 24, 117, 243, 57, 0, 1, 49, 51, 152, 49, 232, 172, 152, 24, 50, 168, 58, 39, 136, 17, 2, 216, 222, 170, 138, 98, 37, 1, 8, 136, 186, 137, 232, 173, 56, 37, 19, 19, 201, 172, 24, 1, 160, 153, 168, 173, 112, 52, 17, 136, 235, 189, 138, 67, 35, 128, 9, 128, 8, 115, 146, 189, 155, 33, 50, 18, 168, 24, 176, 255, 138, 16, 129, 138, 100, 35, 1, 168, 221, 155, 32, 67, 129, 186, 9, 17, 16, 82, 36, 0, 202, 205, 171, 137, 49, 38, 17, 129, 186, 187, 10, 82, 51, 130, 169, 219, 173, 24, 129, 48, 37, 129, 9, 152, 190, 96, 4, 185, 24, 1, 235, 172, 153, 32, 101, 52, 129, 152, 187, 188, 154, 64, 51, 19, 33, 67, 17, 116, 36, 1, 169, 170, 154, 24, 66, 35, 67, 51, 19, 250, 156, 24, 51, 18, 144, 186, 185, 223, 171, 8, 136, 32, 128, 153, 186, 237, 172, 152, 203, 155, 217, 171, 154, 204, 9, 36, 129, 219, 187, 235, 188, 154, 0, 1, 154, 49, 3, 233, 156, 8, 153, 8, 1, 8, 35, 251, 140, 51, 52, 70, 2, 137, 48, 18, 24, 50, 144, 136, 64, 53, 84, 35, 82, 53, 2, 152, 16, 217, 156, 9, 65, 51, 50, 18, 33, 160, 170, 206, 203, 188, 128, 186, 88, 69, 145, 25, 4, 152, 171, 187, 173, 49, 34, 34, 34, 249, 156, 201, 26, 53, 129, 136, 152, 32, 35, 136, 144, 255, 188, 138, 40, 67, 52, 53, 129, 186, 139, 18, 49, 52, 34, 160, 8, 8, 119, 133, 202, 171, 136, 1, 98, 68, 35, 0, 169, 186, 188, 187, 9, 35, 34, 69, 145, 137, 128, 185, 172, 48, 23, 236, 139, 0, 235, 138, 128, 219, 10, 50, 86, 53, 35, 18, 128, 202, 219, 154, 137, 32, 50, 70, 52, 51, 34, 0, 169, 169, 202, 156, 8, 49, 52, 33, 86, 34, 0, 8, 184, 174, 137, 169, 171, 171, 156, 170, 219, 138, 128, 8, 18, 176, 255, 158, 186, 186, 187, 138, 168, 140, 33, 145, 16, 145, 205, 235, 205, 170, 136, 152, 137, 18, 50, 17, 32, 34, 208, 188, 169, 153, 41, 66, 1, 66, 54, 19, 34, 100, 36, 128, 153, 128, 200, 172, 49, 216, 73, 52, 128, 48, 35, 200, 188, 186, 236, 171, 16, 2, 33, 53, 34, 161, 204, 136, 169, 187, 140, 49, 20, 128, 84, 162, 27, 38, 153, 66, 2, 51, 208, 10, 67, 17, 145, 27, 103, 145, 25, 82, 17, 17, 50, 36, 34, 50, 144, 137, 8, 80, 54, 18, 67, 20, 128, 48, 69, 18, 136, 136, 184, 207, 10, 184, 25, 36, 1, 32, 128, 235, 202, 203, 153, 136, 168, 138, 176, 157, 98, 67, 35, 2, 65, 163, 191, 0, 168, 201, 10, 51, 52, 184, 96, 36, 129, 202, 32, 19, 184, 40, 200, 26, 252, 15, 82, 145, 9, 145, 188, 24, 144, 64, 131, 204, 169, 204, 138, 185, 10, 1, 185, 210, 248, 36, 0, 156, 33, 251, 239, 137, 136, 40, 100, 53, 67, 18, 128, 152, 188, 9, 128, 32, 69, 35, 51, 53, 51, 36, 128, 170, 186, 219, 154, 128, 65, 36, 67, 36, 136, 169, 205, 171, 185, 153, 152, 219, 203, 203, 203, 203, 153, 152, 153, 10, 176, 223, 154, 188, 170, 203, 170, 170, 10, 16, 48, 36, 168, 235, 205, 203, 154, 138, 8, 65, 67, 50, 52, 17, 169, 186, 158, 137, 24, 53, 50, 20, 40, 55, 2, 136, 49, 161, 190, 24, 160, 42, 1, 32, 162, 48, 131, 201, 239, 8, 128, 153, 153, 136, 239, 139, 136, 16, 33, 68, 160, 154, 152, 189, 156, 9, 17, 18, 34, 33, 146, 29, 71, 17, 51, 66, 2, 171, 24, 50, 85, 18, 65, 54, 1, 17, 84, 3, 8, 51, 129, 32, 2, 25, 84, 51, 52, 99, 19, 153, 137, 8, 17, 17, 82, 37, 160, 170, 187, 169, 205, 40, 36, 1, 65, 18, 128, 234, 204, 154, 203, 11, 136, 115, 5, 136, 16, 145, 189, 154, 154, 17, 154, 116, 130, 41, 36, 170, 65, 216, 26, 144, 170, 168, 137, 50, 20, 49, 55, 217, 139, 18, 169, 138, 65, 160, 223, 205, 138, 153, 56, 71, 17, 1, 201, 171, 202, 155, 49, 18, 170, 19, 236, 16, 2, 50, 131, 0, 250, 157, 136, 170, 57, 161, 191, 171, 221, 189, 32, 70, 68, 52, 18, 144, 218, 203, 154, 137, 50, 52, 51, 36, 18, 33, 1, 128, 201, 205, 169, 187, 138, 83, 35, 52, 36, 144, 186, 204, 187, 171, 16, 129, 136, 236, 204, 186, 186, 10, 52, 35, 18, 136, 236, 189, 186, 172, 154, 169, 138, 40, 52, 68, 52, 130, 202, 218, 203, 170, 136, 40, 33, 35, 52, 51, 52, 33, 1, 170, 202, 138, 152, 48, 17, 85, 19, 33, 86, 51, 34, 34, 2, 249, 188, 188, 171, 154, 8, 52, 20, 17, 18, 1, 201, 205, 188, 189, 172, 138, 32, 66, 36, 19, 128, 169, 171, 170, 138, 18, 32, 71, 152, 32, 2, 24, 87, 51, 67, 18, 32, 177, 156, 129, 138, 51, 99, 52, 34, 99, 68, 17, 33, 18, 144, 137, 203, 139, 186, 88, 53, 69, 18, 33, 0, 17, 137, 137, 82, 162, 204, 203, 153, 185, 73, 70, 2, 33, 3, 25, 161, 175, 153, 203, 154, 136, 80, 36, 17, 18, 185, 170, 0, 137, 100, 208, 171, 187, 187, 173, 10, 35, 145, 97, 20, 1, 176, 204, 205, 219, 154, 169, 155, 35, 136, 68, 130, 0, 236, 172, 169, 153, 40, 20, 144, 218, 172, 169, 10, 116, 35, 18, 129, 171, 219, 156, 33, 67, 160, 64, 209, 11, 38, 16, 52, 1, 32, 217, 10, 218, 140, 17, 152, 136, 128, 202, 187, 104, 119, 51, 67, 34, 144, 219, 188, 137, 8, 65, 52, 52, 50, 34, 2, 0, 217, 172, 187, 203, 137, 32, 82, 52, 35, 50, 160, 191, 189, 187, 170, 137, 33, 1, 18, 235, 172, 65, 17, 53, 0, 186, 172, 138, 136, 16, 144, 173, 169, 221, 171, 186, 154, 137, 9, 84, 37, 34, 18, 201, 204, 219, 171, 137, 24, 83, 51, 52, 36, 129, 8, 185, 173, 170, 152, 16, 82, 52, 33, 52, 16, 49, 145, 203, 188, 203, 204, 138, 160, 138, 17, 16, 160, 171, 168, 223, 170, 153, 187, 203, 236, 154, 152, 26, 54, 34, 20, 17, 168, 172, 153, 0, 16, 86, 35, 33, 52, 0, 67, 152, 117, 129, 24, 18, 8, 18, 24, 49, 145, 25, 18, 40, 119, 145, 57, 4, 171, 49, 218, 25, 232, 11, 35, 8, 52, 128, 18, 251, 58, 133, 11, 53, 176, 10, 144, 172, 128, 203, 98, 161, 57, 5, 9, 3, 153, 115, 160, 27, 22, 154, 49, 18, 52, 144, 81, 146, 155, 50, 34, 37, 152, 18, 250, 203, 172, 137, 152, 64, 54, 144, 9, 144, 173, 186, 188, 24, 160, 172, 8, 218, 25, 128, 8, 250, 155, 216, 189, 40, 144, 10, 0, 35, 251, 11, 152, 139, 0, 32, 119, 129, 154, 50, 200, 141, 50, 153, 16, 137, 119, 1, 33, 4, 169, 138, 168, 139, 36, 17, 54, 2, 8, 32, 200, 156, 186, 174, 154, 187, 138, 52, 130, 65, 192, 223, 187, 202, 171, 115, 69, 51, 36, 18, 168, 219, 171, 137, 32, 52, 54, 35, 35, 17, 18, 184, 187, 220, 172, 137, 24, 66, 68, 35, 34, 129, 202, 205, 173, 170, 153, 16, 34, 51, 145, 204, 188, 204, 170, 170, 136, 128, 136, 152, 169, 236, 187, 203, 186, 171, 16, 32, 85, 2, 0, 184, 207, 186, 170, 137, 33, 83, 69, 18, 33, 129, 186, 186, 203, 137, 48, 70, 66, 51, 51, 4, 8, 144, 202, 219, 171, 186, 154, 0, 81, 35, 152, 218, 220, 204, 171, 170, 138, 8, 8, 152, 170, 218, 171, 0, 16, 34, 144, 185, 207, 172, 24, 83, 67, 53, 18, 17, 136, 24, 49, 54, 17, 52, 34, 36, 50, 54, 18, 0, 9, 17, 40, 103, 18, 50, 18, 49, 129, 136, 218, 171, 27, 103, 17, 53, 130, 16, 200, 154, 152, 40, 34, 70, 17, 35, 152, 66, 200, 25, 160, 11, 99, 34, 83, 53, 0, 65, 130, 10, 51, 35, 153, 100, 144, 82, 1, 81, 130, 186, 32, 177, 158, 17, 8, 136, 220, 139, 144, 205, 169, 188, 137, 219, 138, 176, 172, 169, 188, 139, 193, 190, 170, 189, 154, 172, 32, 161, 138, 130, 204, 9, 16, 16, 129, 221, 41, 2, 33, 152, 81, 192, 140, 81, 130, 56, 39, 136, 49, 17, 100, 18, 8, 152, 153, 80, 36, 115, 36, 0, 1, 187, 138, 1, 8, 103, 35, 136, 0, 234, 171, 168, 170, 152, 170, 24, 249, 156, 9, 184, 173, 153, 251, 220, 138, 16, 32, 117, 68, 19, 129, 128, 153, 203, 10, 49, 53, 36, 67, 35, 33, 18, 0, 153, 251, 171, 187, 56, 35, 115, 38, 1, 128, 168, 204, 187, 203, 154, 24, 0, 17, 190, 33, 45, 0, 1, 234, 188, 187, 173, 186, 187, 187, 156, 170, 171, 0, 234, 172, 171, 205, 154, 16, 17, 51, 37, 168, 204, 188, 187, 156, 0, 65, 53, 50, 51, 51, 176, 171, 169, 188, 80, 36, 84, 36, 34, 36, 18, 18, 200, 203, 219, 187, 154, 24, 66, 35, 0, 184, 239, 171, 187, 187, 170, 137, 136, 136, 8, 16, 169, 154, 251, 189, 172, 171, 170, 32, 70, 35, 51, 2, 137, 138, 137, 65, 71, 35, 50, 18, 67, 20, 33, 36, 129, 139, 17, 136, 118, 51, 50, 52, 2, 8, 1, 185, 25, 35, 115, 103, 34, 34, 130, 128, 152, 169, 56, 35, 50, 69, 130, 25, 52, 17, 145, 139, 1, 203, 80, 103, 35, 33, 52, 130, 153, 48, 145, 57, 55, 51, 8, 51, 128, 51, 33, 131, 59, 7, 173, 170, 33, 233, 139, 160, 220, 235, 187, 138, 152, 171, 48, 147, 207, 189, 188, 137, 187, 10, 35, 202, 41, 177, 172, 168, 26, 209, 207, 24, 201, 10, 35, 136, 24, 130, 170, 219, 138, 18, 8, 119, 3, 17, 34, 128, 169, 41, 130, 33, 18, 118, 3, 136, 32, 145, 8, 17, 66, 3, 114, 70, 2, 8, 33, 145, 186, 41, 38, 201, 24, 162, 188, 171, 219, 155, 51, 249, 189, 187, 221, 171, 203, 154, 185, 171, 1, 201, 8, 176, 188, 253, 205, 186, 137, 170, 80, 70, 67, 51, 20, 1, 136, 154, 170, 153, 48, 68, 52, 68, 51, 36, 19, 152, 170, 205, 171, 137, 32, 68, 67, 18, 34, 145, 185, 219, 188, 156, 137, 137, 0, 152, 169, 220, 188, 172, 203, 188, 170, 186, 154, 8, 16, 201, 204, 220, 187, 172, 155, 24, 18, 17, 34, 128, 202, 189, 188, 189, 170, 138, 32, 52, 67, 69, 34, 17, 50, 18, 34, 53, 67, 69, 51, 51, 130, 170, 205, 187, 154, 16, 67, 36, 35, 1, 217, 173, 203, 189, 170, 171, 137, 16, 34, 35, 130, 152, 249, 206, 169, 169, 138, 24, 35, 36, 131, 185, 203, 235, 156, 50, 19, 17, 81, 3, 24, 130, 26, 5, 206, 8, 169, 139, 100, 34, 17, 34, 68, 1, 33, 33, 71, 17, 34, 48, 38, 0, 16, 51, 145, 80, 20, 50, 176, 26, 69, 162, 140, 84, 34, 144, 154, 115, 19, 184, 56, 54, 160, 41, 37, 1, 1, 56, 20, 205, 9, 144, 187, 137, 202, 40, 147, 155, 51, 17, 249, 173, 24, 216, 155, 145, 191, 169, 169, 186, 172, 9, 128, 160, 155, 35, 152, 16, 99, 4, 153, 113, 52, 161, 138, 65, 131, 206, 9, 18, 249, 139, 2, 185, 204, 170, 186, 173, 153, 24, 51, 51, 84, 35, 17, 17, 115, 130, 202, 9, 136, 217, 139, 168, 205, 137, 168, 171, 137, 152, 168, 155, 100, 68, 51, 52, 33, 50, 130, 201, 11, 19, 189, 155, 64, 37, 50, 38, 152, 203, 10, 128, 219, 155, 81, 51, 99, 37, 33, 83, 160, 173, 153, 154, 16, 24, 101, 0, 28, 0, 51, 99, 130, 40, 148, 187, 136, 56, 5, 74, 119, 34, 50, 17, 50, 130, 153, 136, 1, 64, 71, 1, 33, 19, 185, 155, 201, 188, 9, 83, 2, 64, 53, 128, 154, 201, 204, 170, 187, 203, 187, 152, 204, 170, 172, 217, 173, 170, 173, 0, 144, 138, 0, 219, 171, 169, 188, 154, 171, 155, 234, 139, 0, 203, 218, 206, 170, 185, 154, 168, 64, 162, 155, 9, 71, 184, 72, 130, 137, 169, 16, 216, 172, 137, 48, 19, 50, 52, 119, 135, 153, 1, 1, 1, 153, 8, 36, 200, 154, 9, 177, 175, 185, 191, 186, 187, 206, 139, 169, 156, 64, 37, 34, 53, 50, 36, 2, 8, 68, 3, 8, 98, 53, 2, 34, 67, 2, 137, 0, 32, 34, 98, 85, 19, 17, 50, 18, 152, 189, 155, 8, 201, 156, 32, 3, 235, 172, 171, 236, 171, 186, 154, 186, 140, 144, 153, 219, 155, 218, 189, 170, 155, 152, 153, 171, 136, 220, 204, 219, 171, 202, 154, 136, 24, 34, 34, 36, 129, 16, 16, 161, 44, 71, 33, 68, 34, 34, 129, 152, 235, 186, 154, 32, 67, 37, 35, 36, 160, 202, 206, 187, 170, 154, 138, 50, 36, 17, 8, 168, 207, 171, 171, 25, 32, 115, 52, 35, 17, 18, 192, 189, 9, 168, 9, 16, 115, 20, 16, 161, 139, 145, 188, 152, 155, 50, 66, 5, 26, 22, 154, 33, 187, 116, 3, 33, 52, 50, 2, 82, 132, 171, 32, 17, 17, 233, 42, 39, 144, 9, 114, 21, 24, 67, 34, 128, 80, 35, 137, 16, 98, 3, 8, 68, 34, 34, 34, 50, 53, 51, 71, 18, 32, 52, 17, 17, 0, 35, 128, 83, 33, 69, 129, 34, 0, 34, 16, 82, 50, 84, 67, 17, 83, 18, 34, 201, 26, 2, 56, 177, 121, 7, 155, 16, 186, 186, 191, 170, 220, 170, 8, 152, 154, 144, 218, 187, 204, 187, 171, 9, 17, 153, 81, 52, 144, 188, 80, 162, 158, 152, 9, 145, 156, 152, 190, 170, 169, 153, 171, 115, 4, 170, 170, 137, 170, 190, 138, 136, 146, 207, 56, 146, 189, 172, 170, 191, 139, 129, 172, 56, 146, 154, 0, 169, 17, 201, 24, 250, 97, 130, 50, 162, 82, 146, 56, 145, 113, 162, 12, 145, 42, 225, 140, 184, 159, 168, 191, 136, 137, 136, 154, 0, 170, 220, 188, 235, 155, 137, 41, 70, 66, 53, 51, 66, 66, 18, 33, 51, 51, 69, 52, 67, 67, 19, 18, 34, 0, 0, 24, 66, 50, 69, 35, 51, 2, 128, 218, 204, 187, 186, 188, 185, 187, 202, 174, 188, 205, 186, 203, 186, 172, 170, 203, 186, 203, 188, 188, 187, 189, 171, 171, 170, 186, 186, 235, 188, 188, 203, 172, 187, 170, 152, 169, 136, 153, 186, 189, 154, 138, 16, 81, 71, 51, 68, 51, 51, 17, 33, 160, 137, 24, 68, 34, 55, 35, 66, 128, 136, 219, 187, 187, 24, 17, 100, 35, 82, 34, 0, 152, 25, 185, 43, 54, 145, 240, 26, 0, 68, 36, 83, 19, 17, 146, 10, 146, 143, 17, 40, 53, 32, 35, 129, 16, 185, 202, 156, 17, 218, 97, 161, 138, 2, 200, 174, 16, 169, 40, 50, 71, 1, 50, 18, 99, 129, 40, 21, 49, 68, 52, 67, 34, 67, 1, 0, 153, 48, 168, 48, 35, 87, 130, 48, 37, 34, 160, 113, 3, 32, 36, 66, 69, 18, 34, 129, 16, 19, 1, 186, 113, 131, 153, 137, 66, 209, 139, 160, 88, 133, 171, 82, 131, 218, 9, 33, 201, 11, 50, 3, 204, 64, 160, 34, 204, 114, 130, 9, 32, 34, 168, 114, 131, 138, 0, 136, 186, 201, 138, 130, 105, 5, 139, 34, 203, 138, 250, 154, 152, 16, 161, 113, 145, 72, 209, 28, 146, 138, 17, 9, 130, 154, 33, 2, 252, 142, 1, 187, 9, 202, 80, 131, 220, 72, 147, 188, 136, 137, 160, 175, 136, 169, 217, 156, 18, 172, 136, 9, 1, 154, 136, 219, 202, 191, 170, 153, 185, 190, 154, 137, 184, 156, 32, 160, 48, 145, 43, 131, 12, 87, 35, 2, 17, 218, 42, 148, 239, 24, 18, 144, 137, 32, 54, 145, 137, 1, 128, 220, 170, 25, 161, 158, 16, 99, 192, 157, 17, 217, 189, 154, 136, 184, 10, 49, 87, 1, 49, 34, 33, 1, 67, 33, 99, 69, 36, 34, 82, 35, 34, 1, 66, 2, 64, 51, 67, 37, 17, 36, 1, 137, 24, 3, 156, 17, 25, 38, 152, 152, 10, 224, 191, 154, 170, 203, 173, 9, 218, 171, 169, 203, 220, 171, 168, 219, 186, 9, 176, 190, 153, 186, 234, 172, 154, 187, 187, 187, 170, 235, 170, 202, 186, 204, 137, 169, 139, 0, 25, 36, 17, 54, 19, 17, 8, 53, 128, 48, 51, 101, 19, 24, 5, 171, 128, 187, 202, 11, 36, 9, 83, 32, 22, 0, 20, 9, 36, 169, 115, 1, 32, 18, 68, 2, 32, 19, 99, 161, 12, 51, 83, 145, 73, 55, 168, 8, 0, 0, 187, 9, 144, 169, 170, 40, 4, 172, 152, 121, 7, 154, 82, 1, 24, 34, 51, 69, 146, 9, 21, 170, 40, 176, 72, 193, 140, 129, 185, 204, 9, 145, 187, 97, 53, 50, 116, 52, 1, 68, 2, 40, 36, 1, 34, 67, 0, 98, 130, 9, 2, 33, 160, 80, 19, 40, 20, 16, 34, 17, 1, 33, 252, 25, 3, 170, 24, 99, 130, 170, 65, 17, 161, 156, 70, 144, 48, 1, 65, 147, 173, 49, 240, 156, 16, 217, 155, 168, 219, 187, 137, 186, 24, 248, 156, 34, 160, 26, 84, 52, 36, 50, 84, 18, 0, 50, 34, 1, 136, 115, 132, 155, 32, 144, 128, 236, 155, 2, 186, 27, 36, 250, 11, 3, 203, 137, 24, 21, 168, 25, 4, 206, 138, 186, 218, 204, 153, 153, 154, 171, 24, 201, 11, 201, 189, 138, 208, 173, 152, 155, 32, 33, 201, 105, 21, 187, 128, 218, 203, 155, 168, 42, 19, 56, 103, 1, 8, 19, 234, 9, 18, 24, 33, 115, 35, 4, 3, 30, 0, 49, 67, 50, 129, 8, 34, 48, 119, 1, 32, 1, 136, 169, 140, 152, 172, 65, 2, 33, 69, 20, 128, 170, 9, 251, 191, 171, 219, 173, 170, 169, 202, 153, 170, 33, 232, 41, 129, 138, 152, 24, 224, 27, 146, 11, 144, 42, 177, 143, 152, 155, 176, 14, 37, 17, 38, 16, 53, 16, 36, 24, 37, 32, 37, 16, 37, 32, 50, 33, 54, 0, 51, 33, 2, 40, 55, 129, 64, 68, 128, 49, 1, 136, 187, 169, 155, 19, 203, 97, 131, 190, 137, 251, 138, 201, 175, 138, 137, 185, 171, 136, 190, 138, 185, 172, 218, 171, 8, 8, 137, 153, 1, 223, 137, 218, 153, 185, 173, 136, 185, 188, 187, 168, 206, 153, 170, 25, 200, 156, 17, 186, 56, 36, 128, 137, 67, 168, 42, 145, 173, 33, 50, 70, 130, 113, 3, 137, 82, 18, 49, 35, 66, 36, 1, 0, 85, 4, 170, 66, 129, 9, 160, 9, 2, 189, 24, 201, 56, 176, 114, 200, 81, 2, 48, 52, 4, 219, 64, 5, 137, 82, 131, 139, 34, 169, 185, 141, 162, 175, 49, 146, 16, 32, 70, 1, 48, 99, 19, 32, 129, 115, 5, 25, 37, 128, 50, 51, 2, 56, 133, 120, 36, 137, 48, 36, 0, 99, 35, 128, 81, 130, 26, 54, 1, 1, 48, 51, 136, 82, 130, 136, 1, 17, 160, 113, 22, 152, 26, 22, 202, 32, 184, 25, 216, 42, 35, 217, 173, 48, 146, 157, 17, 168, 204, 26, 194, 191, 40, 144, 187, 16, 129, 136, 187, 153, 219, 222, 26, 145, 10, 1, 50, 176, 27, 119, 164, 157, 0, 170, 49, 176, 12, 131, 157, 65, 144, 0, 137, 184, 29, 147, 191, 67, 161, 9, 33, 146, 158, 128, 137, 250, 27, 20, 154, 16, 144, 0, 200, 173, 168, 156, 33, 66, 53, 128, 128, 169, 169, 187, 137, 238, 139, 1, 33, 146, 188, 17, 250, 175, 16, 1, 170, 33, 176, 88, 147, 73, 5, 187, 32, 128, 187, 112, 148, 174, 65, 161, 8, 184, 42, 130, 136, 172, 35, 239, 40, 130, 0, 0, 16, 168, 235, 72, 148, 171, 3, 172, 34, 187, 67, 130, 169, 156, 177, 239, 33, 193, 140, 145, 171, 128, 0, 160, 48, 249, 9, 219, 41, 34, 160, 11, 37, 137, 49, 3, 235, 186, 137, 249, 13, 132, 26, 22, 153, 34, 160, 155, 98, 144, 32, 19, 169, 113, 4, 11, 2, 190, 24, 144, 136, 8, 20, 154, 18, 152, 235, 114, 177, 58, 5, 32, 137, 84, 176, 26, 35, 0, 2, 202, 152, 239, 48, 161, 58, 22, 8, 128, 64, 3, 26, 177, 157, 233, 12, 36, 185, 10, 129, 171, 10, 103, 177, 27, 21, 136, 1, 24, 145, 156, 200, 157, 51, 137, 99, 176, 26, 1, 138, 99, 145, 113, 162, 141, 17, 144, 137, 40, 160, 140, 131, 156, 52, 185, 84, 201, 40, 136, 54, 251, 65, 161, 26, 17, 176, 138, 129, 41, 179, 61, 39, 152, 1, 233, 1, 38, 0, 153, 34, 236, 40, 147, 40, 176, 88, 163, 141, 35, 218, 138, 34, 233, 88, 146, 138, 2, 32, 38, 152, 40, 35, 177, 159, 67, 216, 40, 147, 10, 2, 8, 202, 72, 132, 155, 69, 3, 160, 139, 34, 220, 137, 169, 137, 57, 71, 128, 137, 66, 192, 43, 21, 137, 19, 156, 67, 220, 24, 192, 10, 146, 9, 146, 139, 136, 152, 81, 131, 98, 249, 44, 178, 11, 216, 73, 147, 11, 147, 158, 128, 26, 133, 174, 66, 161, 73, 131, 9, 177, 140, 4, 138, 145, 26, 208, 140, 35, 201, 12, 5, 9, 147, 142, 51, 16, 2, 16, 251, 139, 138, 3, 158, 36, 154, 35, 219, 24, 131, 172, 82, 200, 72, 178, 43, 23, 186, 137, 128, 152, 24, 144, 10, 87, 144, 57, 131, 156, 1, 154, 18, 153, 71, 176, 140, 35, 232, 58, 134, 172, 50, 176, 140, 1, 8, 51, 201, 64, 132, 140, 34, 251, 41, 130, 139, 1, 201, 9, 18, 136, 101, 160, 57, 148, 138, 18, 50, 250, 138, 153, 83, 217, 97, 146, 26, 131, 189, 136, 152, 138, 34, 200, 72, 193, 43, 23, 169, 0, 168, 8, 160, 74, 21, 153, 1, 170, 168, 175, 35, 223, 88, 3, 153, 17, 0, 152, 154, 48, 161, 112, 132, 153, 24, 176, 142, 36, 154, 32, 168, 137, 69, 177, 27, 20, 201, 57, 165, 159, 34, 160, 24, 34, 1, 152, 49, 177, 159, 136, 186, 58, 178, 122, 135, 8, 35, 185, 173, 48, 177, 27, 36, 169, 8, 239, 26, 3, 173, 48, 129, 153, 56, 23, 169, 17, 220, 32, 177, 74, 163, 159, 35, 154, 83, 184, 40, 177, 41, 132, 189, 25, 3, 27, 87, 201, 26, 146, 156, 50, 129, 136, 144, 137, 1, 191, 114, 163, 140, 34, 201, 72, 3, 187, 65, 201, 72, 163, 155, 49, 161, 140, 67, 217, 41, 20, 185, 140, 52, 184, 81, 130, 203, 48, 5, 153, 169, 9, 52, 249, 141, 35, 17, 17, 153, 177, 175, 65, 145, 137, 171, 65, 128, 0, 65, 164, 191, 65, 184, 58, 3, 64, 163, 12, 177, 158, 67, 144, 40, 0, 101, 160, 12, 2, 188, 64, 34, 128, 144, 170, 137, 220, 58, 133, 27, 39, 187, 41, 0, 49, 145, 41, 163, 255, 58, 133, 138, 34, 185, 24, 130, 187, 40, 18, 169, 156, 84, 178, 157, 99, 208, 27, 37, 184, 26, 19, 234, 32, 161, 42, 6, 10, 34, 221, 24, 145, 27, 53, 184, 9, 176, 43, 147, 90, 133, 155, 16, 144, 174, 35, 205, 82, 144, 136, 9, 21, 170, 51, 201, 40, 192, 26, 161, 157, 97, 129, 138, 51, 17, 251, 156, 81, 130, 155, 52, 233, 10, 34, 200, 10, 35, 218, 10, 2, 170, 83, 144, 66, 2, 40, 20, 128, 1, 168, 154, 115, 209, 157, 0, 168, 154, 114, 130, 32, 177, 140, 144, 40, 2, 114, 4, 136, 185, 74, 210, 12, 129, 27, 164, 191, 17, 25, 2, 76, 254, 48, 0, 58, 5, 155, 0, 50, 235, 136, 190, 99, 168, 32, 192, 96, 161, 10, 161, 43, 130, 139, 66, 83, 177, 157, 51, 144, 72, 161, 43, 39, 137, 67, 233, 9, 217, 73, 163, 57, 193, 26, 193, 73, 161, 72, 3, 157, 32, 176, 11, 3, 136, 1, 184, 207, 9, 1, 32, 3, 171, 116, 163, 159, 50, 216, 40, 145, 11, 161, 112, 163, 140, 2, 8, 201, 88, 163, 12, 2, 154, 129, 154, 1, 24, 210, 158, 49, 34, 66, 131, 139, 52, 0, 208, 172, 202, 41, 21, 154, 65, 232, 140, 17, 33, 145, 155, 33, 52, 129, 32, 224, 140, 168, 189, 115, 200, 43, 3, 137, 67, 19, 251, 25, 193, 59, 6, 170, 18, 168, 153, 66, 145, 81, 192, 42, 3, 172, 144, 154, 168, 14, 85, 144, 138, 33, 128, 41, 23, 186, 64, 176, 138, 184, 57, 131, 202, 59, 71, 136, 52, 186, 137, 234, 25, 2, 154, 200, 141, 4, 58, 6, 80, 148, 140, 161, 26, 146, 141, 3, 188, 81, 20, 168, 25, 162, 156, 136, 26, 21, 171, 51, 217, 73, 19, 32, 200, 26, 2, 82, 193, 139, 18, 221, 72, 178, 29, 21, 186, 24, 24, 1, 56, 39, 204, 49, 218, 58, 130, 8, 185, 56, 146, 160, 159, 19, 159, 53, 160, 8, 144, 0, 128, 17, 136, 162, 175, 52, 202, 24, 160, 154, 24, 67, 35, 193, 157, 66, 217, 113, 162, 156, 2, 136, 0, 128, 200, 11, 36, 169, 33, 185, 113, 149, 139, 53, 186, 48, 250, 10, 1, 160, 141, 52, 184, 56, 1, 16, 184, 10, 66, 20, 186, 137, 169, 72, 53, 250, 40, 162, 158, 49, 177, 175, 49, 129, 65, 3, 137, 201, 10, 146, 96, 148, 159, 19, 219, 56, 130, 8, 152, 42, 35, 56, 6, 188, 65, 201, 25, 193, 89, 146, 12, 20, 188, 81, 17, 1, 186, 33, 205, 40, 145, 24, 177, 173, 136, 8, 67, 184, 88, 146, 113, 179, 43, 210, 74, 179, 14, 162, 12, 148, 12, 21, 8, 145, 158, 17, 0, 129, 9, 35, 202, 8, 138, 100, 145, 153, 137, 3, 205, 24, 136, 145, 58, 23, 24, 178, 141, 129, 32, 248, 139, 3, 24, 67, 160, 12, 51, 217, 96, 178, 157, 34, 185, 9, 16, 160, 121, 132, 172, 49, 146, 187, 40, 51, 19, 169, 249, 156, 17, 50, 193, 74, 5, 187, 97, 3, 186, 9, 152, 171, 160, 189, 154, 32, 65, 87, 144, 139, 33, 234, 57, 4, 48, 234, 97, 146, 40, 130, 137, 218, 171, 136, 170, 81, 19, 184, 173, 80, 145, 138, 24, 85, 160, 41, 146, 57, 22, 33, 216, 27, 192, 141, 145, 156, 160, 11, 71, 153, 49, 145, 8, 186, 34, 203, 115, 131, 10, 168, 140, 18, 188, 40, 176, 27, 18, 116, 3, 152, 145, 156, 8, 72, 4, 188, 40, 129, 1, 24, 224, 42, 3, 97, 210, 156, 168, 41, 37, 40, 38, 200, 153, 136, 202, 46, 251, 52, 0, 187, 41, 84, 17, 35, 32, 131, 175, 152, 155, 18, 185, 25, 19, 136, 185, 122, 39, 216, 171, 0, 34, 176, 28, 39, 152, 82, 162, 138, 128, 186, 187, 41, 36, 1, 24, 52, 153, 129, 187, 252, 29, 130, 72, 146, 115, 178, 89, 147, 11, 18, 185, 190, 40, 18, 73, 22, 219, 9, 169, 128, 169, 1, 171, 84, 51, 146, 40, 240, 159, 33, 145, 172, 16, 17, 33, 38, 176, 173, 170, 136, 17, 19, 155, 67, 169, 116, 146, 81, 177, 12, 33, 0, 186, 136, 189, 138, 73, 23, 169, 25, 0, 170, 72, 132, 72, 22, 137, 2, 172, 8, 185, 138, 83, 200, 65, 147, 187, 140, 160, 89, 194, 58, 241, 59, 147, 114, 177, 58, 147, 202, 138, 130, 138, 34, 136, 136, 115, 19, 16, 2, 238, 25, 145, 26, 148, 174, 32, 128, 98, 18, 152, 155, 18, 170, 66, 233, 25, 177, 42, 132, 12, 53, 217, 9, 144, 138, 52, 20, 200, 10, 3, 11, 21, 154, 35, 236, 25, 176, 172, 152, 154, 48, 130, 112, 19, 41, 55, 153, 65, 20, 169, 25, 232, 139, 145, 12, 35, 172, 82, 144, 25, 128, 169, 96, 37, 184, 48, 163, 188, 137, 144, 187, 136, 172, 1, 255, 40, 145, 72, 36, 1, 128, 218, 9, 251, 40, 176, 104, 146, 56, 148, 11, 132, 26, 148, 12, 131, 155, 1, 202, 48, 179, 92, 148, 12, 146, 157, 200, 58, 20, 1, 9, 21, 137, 4, 139, 35, 8, 200, 41, 255, 25, 1, 0, 24, 2, 172, 16, 152, 24, 20, 200, 41, 160, 59, 148, 143, 18, 236, 24, 1, 16, 128, 0, 24, 87, 144, 25, 146, 171, 153, 27, 71, 152, 82, 192, 139, 160, 171, 81, 3, 153, 50, 130, 187, 137, 40, 38, 220, 56, 162, 140, 36, 202, 155, 8, 33, 51, 1, 32, 67, 52, 68, 20, 16, 176, 255, 155, 136, 169, 9, 1, 49, 130, 64, 147, 11, 178, 223, 16, 136, 82, 20, 128, 66, 2, 32, 19, 206, 170, 172, 24, 145, 10, 36, 184, 9, 128, 152, 154, 17, 218, 115, 87, 169, 16, 168, 32, 0, 99, 1, 40, 233, 155, 8, 152, 203, 40, 176, 26, 37, 137, 82, 168, 72, 36, 34, 67, 192, 11, 35, 186, 10, 201, 206, 10, 19, 176, 189, 138, 16, 51, 52, 131, 169, 187, 57, 55, 49, 87, 177, 171, 1, 219, 170, 203, 41, 19, 187, 25, 217, 140, 50, 34, 71, 160, 42, 3, 203, 56, 132, 155, 36, 169, 100, 146, 187, 188, 139, 129, 189, 72, 147, 141, 84, 129, 32, 18, 128, 66, 36, 144, 49, 21, 34, 51, 145, 222, 203, 170, 155, 136, 1, 8, 20, 219, 40, 128, 35, 40, 149, 142, 36, 169, 65, 176, 190, 205, 137, 144, 25, 146, 157, 34, 129, 82, 34, 84, 129, 16, 144, 171, 2, 251, 10, 184, 11, 4, 154, 184, 59, 6, 156, 145, 175, 17, 1, 68, 1, 16, 250, 118, 253, 41, 0, 171, 32, 1, 202, 24, 145, 113, 6, 137, 18, 234, 24, 16, 83, 145, 8, 200, 156, 128, 25, 17, 82, 131, 153, 168, 186, 202, 88, 20, 24, 2, 25, 146, 174, 234, 174, 136, 9, 128, 97, 52, 82, 35, 0, 2, 170, 33, 249, 138, 202, 11, 216, 140, 18, 24, 128, 56, 53, 82, 19, 169, 152, 154, 34, 2, 250, 187, 202, 203, 8, 128, 152, 137, 32, 115, 35, 16, 102, 34, 129, 32, 148, 206, 154, 172, 170, 205, 203, 219, 171, 154, 152, 137, 64, 35, 84, 52, 52, 52, 36, 51, 67, 35, 18, 33, 128, 137, 136, 169, 154, 219, 187, 188, 152, 171, 1, 171, 35, 49, 194, 121, 5, 0, 153, 52, 250, 155, 235, 187, 188, 188, 204, 172, 186, 203, 202, 138, 153, 154, 17, 136, 50, 51, 100, 18, 50, 17, 1, 218, 152, 220, 154, 202, 171, 169, 136, 153, 65, 51, 86, 50, 52, 83, 51, 51, 83, 35, 35, 50, 3, 154, 129, 191, 171, 219, 204, 171, 202, 172, 169, 187, 186, 138, 128, 169, 25, 0, 56, 54, 82, 38, 128, 50, 2, 18, 153, 100, 129, 171, 16, 251, 136, 187, 53, 185, 115, 128, 83, 18, 68, 34, 66, 67, 50, 20, 18, 34, 8, 2, 152, 136, 184, 236, 171, 170, 186, 191, 11, 184, 156, 192, 141, 160, 172, 0, 169, 34, 232, 40, 146, 140, 129, 41, 163, 223, 136, 186, 155, 153, 152, 202, 41, 23, 136, 82, 34, 66, 128, 81, 18, 16, 0, 128, 154, 251, 175, 144, 154, 185, 156, 8, 8, 50, 68, 53, 18, 34, 67, 37, 144, 16, 3, 202, 139, 193, 174, 144, 205, 136, 219, 136, 219, 48, 184, 26, 200, 96, 130, 80, 21, 49, 20, 49, 35, 1, 16, 51, 200, 25, 145, 72, 193, 58, 7, 153, 32, 144, 220, 203, 189, 206, 172, 203, 171, 170, 153, 0, 49, 70, 51, 54, 67, 67, 50, 49, 34, 17, 2, 24, 128, 9, 145, 156, 16, 0, 16, 65, 19, 32, 144, 48, 146, 40, 146, 112, 3, 88, 132, 203, 250, 221, 203, 188, 188, 190, 171, 188, 172, 170, 154, 153, 137, 17, 51, 68, 51, 36, 35, 0, 33, 217, 155, 217, 173, 169, 171, 170, 155, 154, 154, 2, 136, 65, 19, 40, 119, 22, 50, 52, 51, 67, 52, 19, 34, 129, 186, 220, 189, 219, 203, 186, 187, 171, 186, 153, 8, 8, 32, 51, 17, 36, 137, 2, 187, 202, 191, 8, 169, 26, 160, 141, 176, 142, 160, 191, 1, 153, 65, 84, 83, 51, 69, 51, 52, 52, 34, 35, 1, 129, 170, 185, 189, 188, 189, 170, 202, 154, 153, 24, 0, 67, 3, 66, 38, 34, 82, 36, 67, 51, 67, 36, 34, 18, 17, 19, 219, 172, 219, 173, 170, 172, 137, 152, 8, 49, 70, 50, 68, 67, 51, 34, 36, 19, 17, 18, 144, 8, 251, 172, 202, 172, 184, 174, 152, 186, 153, 186, 26, 1, 11, 51, 168, 10, 2, 27, 0, 17, 220, 25, 250, 141, 136, 187, 188, 201, 187, 219, 156, 152, 187, 33, 202, 80, 18, 114, 51, 82, 51, 33, 52, 0, 32, 1, 1, 218, 139, 250, 173, 0, 185, 40, 18, 153, 113, 20, 136, 99, 2, 0, 0, 136, 202, 155, 152, 171, 81, 131, 42, 71, 168, 114, 162, 139, 21, 219, 25, 176, 140, 184, 171, 201, 157, 136, 219, 137, 202, 140, 144, 171, 99, 17, 85, 52, 83, 67, 67, 35, 51, 36, 17, 17, 128, 152, 172, 170, 204, 170, 170, 170, 8, 24, 50, 67, 53, 0, 16, 160, 220, 188, 173, 188, 189, 187, 189, 172, 202, 187, 187, 204, 170, 187, 169, 202, 9, 18, 48, 69, 67, 52, 51, 67, 34, 17, 144, 186, 219, 172, 203, 187, 170, 154, 16, 66, 83, 84, 51, 66, 35, 66, 18, 49, 35, 17, 18, 8, 153, 220, 235, 219, 219, 202, 188, 202, 187, 170, 187, 137, 0, 49, 67, 52, 36, 50, 35, 144, 169, 251, 188, 188, 188, 171, 172, 153, 136, 24, 33, 83, 69, 34, 99, 35, 51, 53, 67, 51, 52, 35, 51, 20, 17, 128, 185, 219, 235, 188, 154, 203, 187, 153, 168, 140, 49, 1, 99, 51, 52, 35, 83, 20, 24, 36, 8, 49, 160, 41, 179, 239, 16, 202, 10, 168, 11, 146, 43, 71, 1, 99, 35, 50, 50, 66, 4, 185, 49, 249, 155, 153, 172, 171, 154, 168, 154, 49, 20, 40, 71, 1, 49, 19, 82, 145, 25, 2, 219, 203, 187, 204, 174, 153, 218, 154, 153, 170, 153, 138, 136, 33, 2, 81, 55, 0, 98, 35, 32, 67, 34, 131, 155, 17, 253, 138, 168, 158, 8, 185, 57, 131, 57, 119, 129, 48, 37, 144, 24, 19, 202, 139, 0, 220, 137, 144, 138, 18, 16, 21, 8, 53, 202, 64, 161, 11, 130, 189, 25, 250, 142, 145, 187, 137, 186, 170, 205, 8, 1, 114, 69, 83, 67, 67, 51, 67, 35, 50, 18, 128, 153, 205, 187, 203, 172, 171, 170, 8, 136, 49, 52, 37, 34, 18, 1, 186, 222, 203, 188, 188, 219, 170, 186, 172, 171, 187, 202, 186, 170, 153, 137, 24, 98, 67, 83, 52, 67, 36, 34, 2, 0, 169, 204, 203, 187, 188, 170, 154, 24, 35, 86, 67, 52, 51, 52, 19, 33, 129, 153, 186, 204, 203, 172, 187, 188, 172, 186, 203, 186, 203, 170, 188, 138, 169, 26, 33, 82, 37, 34, 36, 128, 169, 221, 203, 203, 188, 186, 170, 137, 24, 99, 68, 52, 53, 51, 36, 51, 34, 17, 1, 168, 170, 203, 188, 203, 170, 136, 8, 67, 99, 51, 33, 53, 1, 32, 2, 185, 155, 217, 206, 187, 187, 235, 187, 136, 202, 138, 129, 153, 65, 52, 67, 84, 36, 33, 35, 34, 1, 8, 1, 160, 205, 25, 192, 158, 18, 128, 32, 53, 52, 17, 115, 18, 8, 50, 18, 136, 24, 145, 252, 172, 136, 250, 154, 8, 184, 155, 17, 160, 137, 113, 20, 153, 136, 255, 39, 0, 82, 131, 203, 32, 177, 190, 8, 160, 188, 41, 176, 43, 23, 25, 38, 16, 53, 144, 82, 160, 73, 192, 58, 211, 13, 36, 186, 97, 129, 9, 20, 128, 0, 0, 16, 160, 24, 19, 16, 84, 66, 67, 17, 34, 248, 171, 184, 191, 155, 169, 204, 170, 137, 170, 26, 19, 114, 147, 57, 133, 154, 82, 18, 100, 53, 67, 52, 67, 51, 18, 51, 2, 153, 201, 189, 203, 188, 169, 170, 0, 33, 52, 35, 68, 1, 136, 169, 222, 188, 219, 203, 172, 171, 187, 171, 153, 169, 152, 9, 136, 171, 16, 160, 138, 144, 16, 152, 113, 36, 65, 53, 19, 1, 136, 153, 189, 139, 82, 68, 68, 69, 35, 52, 52, 50, 34, 17, 144, 202, 189, 188, 173, 186, 170, 137, 137, 16, 17, 18, 33, 35, 202, 204, 236, 219, 203, 203, 187, 172, 170, 171, 153, 155, 8, 168, 32, 36, 68, 67, 68, 19, 66, 21, 17, 51, 51, 36, 17, 52, 0, 33, 34, 99, 68, 50, 68, 67, 34, 49, 53, 0, 16, 144, 186, 206, 172, 202, 172, 152, 172, 8, 153, 9, 136, 40, 67, 129, 64, 38, 152, 24, 3, 219, 10, 168, 139, 17, 187, 98, 17, 32, 82, 70, 18, 67, 52, 51, 66, 51, 0, 33, 176, 203, 236, 138, 218, 156, 24, 136, 33, 68, 52, 50, 83, 35, 50, 1, 48, 209, 173, 185, 174, 154, 172, 137, 186, 32, 162, 58, 22, 16, 130, 170, 16, 232, 190, 137, 217, 171, 128, 1, 184, 97, 4, 24, 66, 67, 35, 50, 51, 52, 200, 88, 133, 171, 115, 129, 8, 66, 34, 128, 66, 129, 49, 250, 13, 145, 190, 32, 176, 26, 36, 137, 67, 161, 138, 0, 250, 157, 0, 234, 137, 168, 154, 184, 10, 35, 153, 83, 177, 156, 218, 155, 98, 50, 102, 52, 83, 35, 67, 35, 50, 17, 136, 168, 175, 154, 172, 154, 152, 49, 35, 54, 51, 52, 18, 16, 201, 204, 204, 188, 204, 186, 187, 187, 171, 153, 154, 16, 128, 16, 1, 24, 233, 171, 217, 189, 186, 204, 170, 202, 153, 144, 24, 66, 50, 54, 52, 54, 50, 68, 34, 49, 2, 0, 168, 171, 219, 171, 203, 137, 8, 48, 84, 68, 36, 51, 36, 17, 0, 186, 235, 189, 203, 189, 186, 188, 187, 187, 171, 137, 24, 51, 68, 68, 33, 33, 129, 153, 251, 171, 220, 187, 170, 155, 137, 66, 69, 67, 68, 51, 67, 50, 36, 1, 17, 129, 169, 170, 185, 172, 169, 11, 37, 137, 101, 2, 32, 50, 34, 16, 17, 152, 187, 255, 156, 184, 189, 169, 138, 200, 156, 34, 169, 32, 35, 52, 130, 64, 20, 129, 217, 88, 163, 174, 50, 168, 41, 128, 100, 128, 64, 52, 33, 17, 68, 3, 25, 36, 152, 33, 168, 40, 217, 57, 162, 12, 36, 169, 64, 130, 72, 132, 12, 39, 169, 136, 154, 169, 206, 138, 152, 169, 201, 42, 131, 158, 49, 50, 130, 43, 87, 89, 17, 47, 0, 200, 139, 144, 172, 186, 154, 128, 188, 0, 0, 33, 96, 71, 128, 66, 1, 17, 129, 48, 19, 202, 10, 131, 221, 26, 18, 153, 16, 68, 37, 161, 64, 131, 188, 187, 219, 204, 219, 155, 184, 157, 1, 136, 34, 128, 136, 137, 233, 173, 168, 237, 153, 185, 139, 128, 40, 20, 97, 52, 0, 50, 2, 136, 160, 153, 202, 220, 187, 172, 186, 173, 41, 19, 186, 66, 146, 137, 188, 115, 3, 117, 35, 69, 51, 50, 51, 18, 128, 185, 155, 237, 171, 187, 10, 144, 120, 53, 66, 51, 50, 35, 169, 186, 221, 188, 203, 187, 169, 187, 138, 40, 34, 83, 68, 34, 17, 128, 170, 204, 188, 204, 171, 219, 171, 170, 171, 137, 64, 52, 68, 53, 35, 35, 34, 17, 202, 155, 233, 189, 170, 172, 153, 25, 67, 84, 67, 51, 52, 35, 16, 0, 184, 189, 202, 235, 186, 137, 169, 139, 52, 129, 48, 52, 3, 187, 48, 232, 190, 186, 202, 204, 155, 185, 158, 128, 153, 1, 40, 54, 1, 99, 35, 17, 16, 50, 192, 155, 16, 202, 171, 8, 17, 49, 87, 34, 66, 20, 1, 0, 0, 200, 172, 8, 160, 205, 24, 146, 173, 16, 1, 144, 24, 129, 9, 249, 26, 19, 170, 98, 145, 171, 186, 205, 153, 188, 26, 130, 187, 64, 39, 130, 64, 55, 144, 16, 130, 156, 136, 219, 10, 18, 220, 40, 37, 160, 72, 38, 152, 24, 128, 8, 202, 40, 146, 139, 66, 201, 73, 130, 169, 25, 103, 168, 25, 52, 168, 12, 52, 145, 154, 52, 208, 11, 1, 152, 65, 53, 2, 64, 21, 200, 25, 3, 219, 10, 128, 201, 156, 32, 1, 40, 69, 1, 0, 184, 187, 156, 0, 202, 114, 36, 1, 82, 19, 49, 18, 17, 129, 154, 219, 9, 36, 0, 103, 19, 24, 1, 153, 153, 204, 170, 138, 169, 174, 49, 146, 11, 54, 161, 170, 205, 186, 205, 187, 9, 129, 137, 50, 20, 185, 58, 21, 203, 154, 218, 187, 189, 25, 83, 18, 65, 38, 185, 155, 169, 219, 188, 48, 19, 40, 100, 35, 144, 65, 128, 153, 236, 171, 186, 190, 138, 17, 34, 67, 52, 34, 129, 186, 16, 252, 10, 129, 188, 40, 184, 43, 35, 154, 50, 250, 159, 185, 171, 136, 40, 84, 36, 18, 67, 0, 217, 172, 160, 190, 155, 64, 145, 96, 53, 35, 50, 51, 152, 186, 190, 206, 25, 160, 26, 83, 35, 137, 68, 144, 0, 128, 154, 115, 177, 11, 21, 203, 11, 129, 171, 66, 130, 24, 36, 161, 155, 66, 233, 170, 236, 189, 188, 172, 171, 80, 69, 50, 69, 34, 1, 144, 153, 169, 203, 171, 136, 136, 33, 101, 52, 36, 51, 34, 1, 186, 220, 171, 202, 139, 136, 49, 1, 33, 145, 144, 205, 153, 155, 201, 206, 186, 187, 190, 171, 170, 170, 169, 140, 136, 154, 136, 33, 4, 169, 234, 206, 204, 171, 155, 137, 40, 83, 67, 51, 51, 52, 19, 50, 238, 44, 0, 0, 18, 219, 186, 189, 171, 8, 82, 69, 53, 51, 51, 34, 129, 169, 153, 219, 187, 219, 186, 170, 137, 32, 66, 69, 35, 34, 129, 218, 204, 188, 188, 186, 187, 187, 187, 188, 32, 51, 101, 67, 33, 0, 202, 187, 204, 171, 137, 137, 49, 52, 51, 52, 53, 67, 67, 83, 34, 0, 0, 169, 171, 25, 67, 50, 70, 35, 65, 21, 33, 37, 0, 66, 1, 168, 24, 201, 173, 25, 17, 8, 84, 35, 129, 41, 53, 160, 137, 32, 248, 173, 136, 152, 137, 170, 40, 147, 255, 40, 177, 11, 50, 51, 67, 51, 51, 209, 188, 169, 173, 138, 153, 49, 145, 90, 55, 16, 83, 34, 1, 169, 9, 233, 172, 128, 136, 50, 128, 116, 4, 9, 35, 128, 0, 153, 9, 252, 172, 152, 188, 153, 144, 152, 136, 16, 0, 0, 0, 100, 161, 157, 0, 220, 155, 0, 203, 25, 176, 42, 39, 49, 68, 1, 0, 128, 188, 114, 161, 173, 168, 187, 154, 155, 115, 21, 128, 81, 145, 40, 2, 251, 173, 137, 137, 40, 67, 52, 129, 168, 189, 24, 24, 100, 129, 16, 1, 169, 186, 137, 137, 176, 255, 1, 153, 81, 1, 49, 17, 35, 250, 203, 188, 155, 16, 100, 100, 35, 18, 2, 170, 186, 170, 25, 50, 83, 68, 129, 48, 36, 66, 52, 0, 16, 184, 139, 169, 155, 33, 66, 161, 89, 6, 155, 136, 203, 154, 169, 137, 251, 223, 170, 202, 171, 137, 0, 16, 144, 186, 189, 190, 186, 204, 154, 170, 186, 170, 155, 153, 9, 19, 202, 171, 251, 204, 186, 186, 153, 169, 24, 145, 170, 128, 25, 37, 116, 22, 17, 129, 170, 187, 173, 136, 17, 66, 68, 18, 33, 34, 17, 129, 8, 144, 170, 187, 204, 205, 138, 24, 68, 51, 84, 36, 17, 33, 33, 34, 136, 201, 205, 155, 154, 66, 19, 115, 52, 52, 17, 2, 184, 204, 170, 8, 64, 36, 34, 0, 153, 0, 0, 68, 68, 129, 171, 186, 190, 137, 186, 33, 169, 113, 21, 50, 50, 35, 128, 0, 251, 171, 235, 154, 154, 40, 115, 54, 50, 50, 35, 161, 170, 219, 10, 129, 25, 86, 51, 66, 51, 52, 52, 82, 68, 17, 33, 2, 8, 128, 57, 53, 50, 69, 35, 50, 50, 35, 68, 3, 16, 144, 204, 138, 170, 156, 65, 51, 51, 18, 168, 234, 205, 203, 169, 202, 172, 204, 186, 189, 170, 170, 32, 145, 137, 33, 184, 204, 172, 16, 250, 155, 128, 205, 10, 144, 11, 35, 136, 24, 137, 99, 130, 42, 87, 128, 40, 36, 130, 203, 9, 2, 136, 33, 103, 19, 137, 128, 186, 171, 169, 24, 53, 168, 114, 210, 156, 144, 172, 24, 129, 16, 129, 40, 232, 188, 9, 202, 189, 138, 24, 129, 16, 1, 82, 163, 190, 136, 152, 154, 1, 64, 71, 128, 16, 0, 0, 217, 138, 201, 157, 33, 66, 20, 152, 137, 219, 204, 154, 114, 69, 50, 50, 3, 128, 128, 175, 4, 29, 0, 153, 32, 68, 51, 52, 52, 83, 68, 51, 50, 52, 17, 82, 19, 32, 52, 50, 37, 1, 66, 35, 50, 99, 51, 50, 36, 0, 169, 154, 203, 170, 186, 138, 202, 58, 3, 190, 203, 235, 206, 187, 219, 187, 187, 186, 188, 170, 172, 188, 189, 169, 219, 187, 187, 188, 190, 172, 203, 187, 203, 154, 170, 187, 154, 219, 186, 203, 203, 189, 188, 203, 187, 170, 170, 170, 138, 169, 202, 170, 235, 187, 235, 171, 186, 187, 155, 153, 155, 49, 50, 102, 2, 33, 18, 16, 17, 152, 8, 67, 67, 50, 118, 51, 69, 51, 67, 51, 67, 34, 1, 1, 17, 16, 86, 67, 67, 66, 50, 51, 50, 51, 51, 50, 36, 17, 67, 67, 52, 51, 84, 52, 35, 83, 20, 17, 18, 128, 137, 152, 154, 0, 8, 117, 51, 53, 36, 34, 2, 0, 160, 205, 153, 202, 138, 0, 40, 37, 128, 49, 18, 115, 35, 17, 17, 128, 186, 205, 155, 170, 139, 119, 67, 50, 52, 35, 2, 136, 185, 153, 137, 9, 116, 36, 65, 52, 34, 50, 2, 0, 18, 160, 42, 37, 32, 19, 203, 136, 251, 156, 34, 0, 82, 161, 137, 250, 188, 187, 189, 171, 185, 172, 137, 170, 188, 219, 188, 203, 186, 10, 168, 172, 170, 218, 174, 203, 171, 152, 171, 136, 128, 65, 36, 18, 35, 201, 11, 129, 156, 86, 130, 40, 21, 144, 16, 145, 12, 37, 136, 68, 161, 138, 33, 176, 172, 137, 97, 52, 18, 35, 3, 169, 204, 155, 186, 188, 0, 176, 28, 22, 8, 84, 128, 170, 153, 186, 169, 191, 40, 192, 27, 52, 176, 221, 154, 9, 40, 70, 2, 17, 160, 252, 172, 8, 186, 42, 37, 16, 69, 34, 33, 130, 186, 170, 204, 138, 169, 41, 53, 68, 83, 34, 18, 67, 34, 102, 51, 52, 37, 33, 34, 17, 33, 54, 36, 50, 68, 52, 50, 52, 67, 35, 34, 52, 19, 50, 37, 65, 35, 50, 52, 66, 51, 33, 35, 51, 136, 34, 235, 170, 204, 170, 204, 154, 170, 187, 174, 170, 191, 186, 204, 187, 204, 202, 171, 187, 188, 187, 203, 203, 186, 188, 188, 204, 171, 203, 188, 203, 186, 219, 171, 170, 219, 187, 170, 188, 187, 188, 188, 187, 189, 188, 186, 187, 203, 202, 154, 170, 187, 187, 189, 186, 189, 187, 186, 187, 154, 185, 156, 8, 137, 50, 130, 40, 36, 100, 35, 49, 85, 35, 33, 82, 67, 50, 55, 50, 68, 50, 67, 35, 52, 67, 34, 83, 51, 68, 51, 51, 52, 37, 35, 66, 67, 50, 36, 51, 52, 51, 67, 66, 50, 67, 51, 53, 51, 67, 67, 35, 50, 52, 18, 34, 34, 51, 68, 35, 66, 52, 33, 50, 19, 152, 32, 232, 172, 0, 200, 171, 66, 146, 9, 34, 0, 201, 175, 153, 186, 236, 188, 155, 186, 171, 152, 153, 33, 145, 174, 32, 232, 188, 219, 188, 171, 171, 188, 25, 3, 153, 82, 36, 160, 137, 192, 187, 2, 13, 0, 190, 156, 185, 189, 9, 136, 33, 144, 83, 0, 65, 2, 81, 35, 1, 250, 156, 145, 189, 137, 9, 152, 24, 52, 67, 17, 144, 217, 207, 154, 136, 218, 10, 17, 136, 66, 18, 50, 19, 0, 1, 201, 156, 184, 175, 9, 51, 49, 55, 50, 68, 50, 34, 33, 144, 114, 209, 155, 19, 67, 52, 52, 67, 51, 52, 19, 32, 20, 8, 1, 137, 65, 84, 18, 49, 55, 2, 17, 34, 33, 160, 204, 186, 9, 17, 187, 9, 64, 248, 28, 146, 203, 169, 221, 172, 0, 184, 188, 155, 8, 203, 138, 202, 156, 186, 205, 172, 188, 203, 170, 8, 202, 9, 129, 57, 22, 153, 72, 52, 85, 52, 50, 68, 33, 34, 20, 50, 55, 34, 68, 50, 67, 67, 50, 52, 19, 68, 35, 50, 36, 67, 34, 51, 36, 50, 35, 33, 67, 129, 8, 1, 168, 218, 189, 153, 221, 154, 218, 155, 186, 204, 188, 170, 205, 170, 172, 186, 172, 203, 186, 172, 188, 203, 171, 219, 187, 203, 203, 187, 188, 188, 203, 203, 171, 203, 202, 186, 172, 172, 170, 172, 187, 188, 187, 204, 186, 170, 187, 187, 204, 187, 186, 219, 171, 186, 188, 171, 187, 188, 186, 186, 154, 138, 8, 8, 0, 0, 1, 153, 116, 34, 83, 69, 83, 36, 66, 67, 51, 52, 68, 33, 52, 50, 66, 52, 67, 67, 67, 36, 35, 67, 51, 67, 66, 51, 52, 51, 52, 36, 51, 36, 52, 50, 99, 19, 51, 51, 52, 35, 83, 35, 51, 52, 67, 51, 52, 51, 51, 52, 21, 50, 19, 50, 36, 34, 33, 37, 17, 50, 66, 2, 72, 146, 27, 147, 191, 168, 188, 24, 201, 156, 184, 190, 187, 203, 188, 171, 171, 203, 174, 186, 173, 185, 188, 202, 188, 171, 186, 189, 25, 185, 172, 169, 170, 186, 203, 9, 233, 155, 202, 154, 201, 219, 155, 18, 128, 66, 50, 53, 19, 169, 154, 219, 171, 168, 105, 38, 169, 81, 19, 8, 136, 65, 33, 52, 137, 84, 192, 25, 146, 154, 160, 48, 3, 80, 21, 82, 163, 140, 176, 158, 145, 11, 83, 36, 144, 16, 128, 65, 67, 35, 34, 83, 52, 185, 25, 16, 87, 32, 36, 34, 5, 8, 53, 160, 155, 33, 33, 37, 202, 9, 216, 155, 66, 35, 0, 8, 17, 252, 159, 153, 186, 155, 170, 139, 129, 202, 187, 144, 223, 138, 168, 205, 171, 152, 188, 0, 249, 187, 128, 169, 16, 200, 171, 188, 189, 157, 49, 128, 40, 53, 19, 66, 36, 33, 51, 17, 66, 37, 67, 36, 99, 51, 36, 51, 67, 51, 51, 33, 99, 50, 67, 17, 69, 2, 49, 3, 66, 18, 33, 216, 138, 200, 139, 131, 190, 24, 130, 153, 219, 153, 237, 154, 202, 171, 202, 171, 218, 170, 219, 187, 202, 203, 172, 187, 188, 203, 204, 187, 188, 203, 187, 187, 189, 187, 204, 187, 219, 187, 188, 171, 218, 187, 186, 189, 170, 187, 172, 188, 187, 188, 172, 84, 237, 28, 0, 154, 171, 171, 172, 188, 156, 153, 169, 153, 202, 24, 185, 11, 145, 41, 38, 50, 87, 2, 32, 19, 85, 18, 67, 129, 65, 38, 34, 34, 83, 51, 51, 52, 51, 85, 51, 50, 52, 67, 52, 34, 50, 52, 66, 83, 67, 35, 35, 52, 34, 34, 98, 68, 34, 34, 51, 51, 34, 51, 115, 52, 34, 35, 16, 66, 18, 24, 66, 35, 68, 36, 1, 129, 136, 34, 17, 17, 18, 217, 26, 4, 154, 0, 138, 208, 239, 187, 138, 17, 66, 131, 153, 251, 175, 154, 137, 136, 8, 35, 176, 222, 189, 187, 172, 153, 128, 8, 0, 202, 206, 187, 169, 153, 8, 144, 219, 205, 188, 188, 138, 152, 8, 136, 168, 222, 171, 138, 16, 50, 18, 128, 250, 174, 171, 153, 0, 50, 51, 3, 8, 33, 201, 171, 170, 114, 71, 17, 144, 219, 187, 170, 27, 119, 52, 51, 67, 18, 168, 203, 139, 49, 52, 51, 241, 223, 137, 65, 36, 34, 168, 204, 188, 138, 32, 83, 67, 35, 1, 168, 187, 173, 154, 56, 85, 35, 129, 235, 203, 138, 24, 35, 19, 184, 204, 171, 138, 17, 69, 36, 144, 168, 187, 9, 51, 2, 33, 162, 239, 172, 10, 49, 35, 82, 18, 219, 172, 187, 171, 16, 84, 36, 152, 203, 172, 155, 40, 52, 18, 128, 218, 26, 99, 34, 17, 168, 205, 188, 153, 32, 67, 19, 168, 186, 188, 153, 17, 100, 37, 51, 52, 1, 184, 191, 155, 137, 82, 67, 19, 128, 187, 187, 154, 73, 53, 17, 18, 145, 235, 138, 52, 36, 129, 154, 186, 74, 148, 157, 2, 235, 137, 48, 39, 145, 187, 153, 9, 1, 186, 186, 137, 216, 219, 204, 56, 131, 89, 53, 168, 154, 219, 137, 184, 139, 249, 155, 49, 84, 2, 154, 184, 255, 10, 33, 34, 130, 33, 162, 189, 189, 10, 84, 34, 0, 0, 250, 172, 40, 35, 130, 185, 155, 33, 102, 3, 219, 172, 171, 97, 52, 36, 176, 188, 203, 153, 50, 69, 34, 128, 201, 203, 137, 1, 65, 36, 145, 153, 169, 154, 16, 33, 2, 40, 87, 176, 173, 48, 129, 42, 52, 136, 34, 251, 159, 24, 32, 67, 130, 204, 10, 18, 24, 34, 192, 140, 32, 184, 156, 114, 3, 153, 144, 137, 130, 239, 41, 51, 51, 145, 251, 189, 42, 52, 19, 128, 9, 185, 174, 24, 18, 40, 37, 233, 172, 8, 67, 52, 160, 187, 188, 139, 50, 70, 2, 136, 201, 174, 8, 34, 50, 68, 145, 205, 138, 152, 9, 83, 36, 17, 144, 221, 171, 24, 67, 51, 17, 176, 223, 10, 33, 17, 66, 160, 172, 9, 9, 81, 35, 168, 188, 153, 0, 51, 36, 176, 174, 24, 18, 16, 68, 176, 190, 155, 57, 55, 1, 136, 251, 138, 50, 0, 48, 3, 205, 155, 48, 19, 32, 162, 207, 25, 34, 0, 66, 193, 175, 24, 128, 32, 68, 129, 203, 169, 156, 81, 35, 17, 185, 170, 201, 171, 82, 53, 53, 10, 62, 0, 128, 153, 136, 168, 157, 98, 146, 157, 114, 146, 172, 40, 3, 154, 32, 1, 1, 184, 173, 16, 145, 9, 71, 130, 235, 171, 64, 18, 0, 52, 176, 188, 171, 24, 51, 17, 98, 35, 250, 173, 8, 50, 20, 168, 137, 200, 172, 9, 115, 36, 168, 187, 137, 32, 128, 8, 129, 169, 58, 39, 184, 157, 136, 154, 114, 130, 48, 23, 250, 172, 40, 37, 129, 137, 136, 169, 155, 0, 82, 53, 176, 173, 9, 1, 138, 65, 52, 1, 219, 172, 9, 34, 24, 69, 145, 190, 41, 51, 145, 152, 234, 156, 65, 36, 144, 170, 153, 9, 83, 18, 184, 173, 65, 144, 138, 16, 67, 2, 200, 206, 57, 37, 184, 27, 53, 216, 155, 48, 2, 137, 67, 192, 172, 137, 115, 19, 185, 141, 33, 145, 154, 16, 1, 169, 104, 53, 160, 205, 26, 19, 170, 114, 1, 154, 0, 160, 154, 16, 65, 37, 249, 141, 68, 129, 170, 170, 170, 82, 52, 3, 201, 188, 10, 18, 17, 51, 52, 232, 188, 9, 36, 144, 40, 160, 170, 136, 33, 38, 33, 192, 156, 144, 140, 84, 145, 221, 138, 84, 35, 152, 219, 154, 0, 136, 99, 18, 136, 169, 174, 48, 20, 136, 218, 155, 98, 35, 144, 170, 188, 25, 51, 2, 136, 0, 184, 155, 116, 4, 218, 171, 8, 32, 69, 18, 185, 174, 24, 49, 50, 160, 221, 156, 48, 36, 18, 130, 218, 173, 138, 32, 69, 129, 137, 169, 171, 65, 4, 154, 8, 152, 41, 4, 187, 88, 20, 185, 138, 136, 136, 48, 69, 2, 33, 18, 236, 171, 137, 138, 102, 18, 160, 153, 16, 128, 41, 67, 192, 188, 137, 49, 54, 18, 136, 203, 156, 33, 184, 27, 70, 130, 24, 145, 190, 154, 203, 72, 38, 2, 153, 185, 188, 155, 32, 84, 130, 186, 138, 201, 139, 82, 2, 128, 184, 188, 185, 239, 25, 54, 1, 170, 170, 170, 170, 65, 37, 129, 170, 24, 3, 221, 138, 1, 187, 65, 36, 17, 71, 178, 223, 137, 34, 18, 0, 160, 170, 10, 0, 17, 18, 128, 73, 55, 200, 174, 136, 17, 83, 36, 144, 186, 206, 154, 98, 51, 129, 153, 186, 203, 10, 82, 37, 145, 154, 0, 185, 156, 49, 18, 40, 70, 144, 187, 170, 185, 72, 55, 18, 128, 218, 172, 32, 2, 154, 100, 146, 172, 40, 19, 186, 137, 129, 137, 102, 3, 218, 187, 138, 66, 37, 1, 144, 204, 139, 48, 2, 0, 33, 129, 170, 139, 168, 222, 137, 24, 116, 36, 128, 169, 206, 139, 49, 51, 51, 146, 221, 139, 1, 185, 56, 103, 1, 169, 170, 170, 137, 98, 52, 145, 186, 153, 154, 8, 99, 36, 144, 170, 171, 171, 64, 3, 33, 86, 19, 176, 191, 171, 25, 51, 51, 54, 2, 218, 172, 170, 40, 83, 35, 152, 185, 154, 34, 146, 24, 36, 249, 191, 25, 67, 1, 0, 0, 8, 170, 188, 203, 139, 80, 53, 4, 201, 172, 137, 9, 233, 64, 0, 0, 50, 36, 160, 137, 2, 169, 171, 9, 128, 152, 114, 55, 128, 154, 33, 130, 185, 26, 36, 160, 153, 115, 103, 145, 169, 136, 128, 0, 50, 18, 169, 154, 49, 53, 130, 220, 138, 48, 67, 145, 219, 187, 204, 41, 37, 168, 138, 0, 184, 171, 252, 171, 8, 201, 155, 82, 2, 251, 203, 138, 66, 2, 170, 153, 222, 155, 17, 2, 152, 136, 201, 139, 81, 2, 128, 204, 171, 153, 169, 171, 138, 117, 36, 136, 169, 202, 187, 48, 87, 1, 153, 202, 188, 25, 70, 51, 144, 153, 235, 156, 66, 4, 152, 8, 144, 170, 80, 35, 136, 40, 33, 0, 250, 172, 56, 53, 2, 128, 129, 186, 187, 42, 103, 2, 152, 0, 152, 154, 8, 50, 20, 153, 114, 21, 152, 136, 152, 169, 173, 88, 35, 128, 0, 33, 99, 2, 205, 171, 138, 82, 36, 2, 201, 204, 41, 70, 146, 187, 155, 128, 185, 88, 71, 130, 201, 170, 9, 0, 32, 34, 129, 40, 184, 206, 138, 169, 10, 86, 50, 2, 185, 188, 170, 203, 26, 87, 2, 170, 138, 128, 17, 67, 33, 129, 223, 156, 8, 50, 51, 53, 129, 218, 203, 170, 9, 65, 52, 20, 129, 203, 155, 137, 49, 4, 186, 25, 20, 160, 9, 66, 18, 169, 171, 203, 10, 161, 57, 21, 65, 71, 145, 221, 172, 137, 8, 66, 51, 145, 9, 18, 50, 209, 175, 153, 8, 17, 35, 20, 1, 33, 52, 144, 40, 161, 221, 138, 115, 19, 128, 66, 130, 172, 65, 36, 152, 137, 16, 16, 18, 34, 129, 191, 137, 33, 54, 2, 169, 205, 153, 185, 172, 138, 50, 129, 0, 249, 174, 171, 169, 155, 8, 186, 220, 190, 154, 32, 67, 160, 169, 253, 173, 137, 0, 16, 16, 176, 173, 9, 128, 154, 9, 144, 154, 16, 248, 205, 138, 82, 2, 169, 0, 185, 174, 32, 19, 16, 18, 250, 187, 24, 68, 38, 129, 169, 153, 153, 65, 68, 145, 138, 17, 33, 54, 129, 187, 56, 87, 129, 0, 17, 144, 156, 33, 37, 35, 20, 185, 41, 34, 84, 146, 11, 1, 10, 69, 35, 16, 0, 202, 11, 101, 36, 160, 170, 154, 32, 145, 114, 23, 144, 128, 187, 41, 4, 137, 67, 160, 40, 145, 187, 252, 27, 86, 19, 0, 152, 203, 202, 155, 97, 36, 128, 136, 185, 203, 24, 68, 36, 152, 153, 235, 171, 9, 33, 51, 68, 52, 177, 190, 138, 136, 169, 81, 36, 185, 187, 172, 72, 52, 53, 131, 220, 188, 170, 136, 50, 53, 51, 146, 187, 154, 187, 188, 25, 19, 33, 22, 168, 137, 81, 21, 170, 25, 168, 0, 251, 142, 48, 37, 169, 152, 169, 219, 155, 169, 154, 9, 103, 52, 36, 129, 169, 204, 172, 10, 34, 34, 68, 2, 0, 128, 65, 18, 136, 136, 185, 156, 32, 101, 36, 17, 67, 2, 128, 187, 155, 8, 18, 116, 52, 145, 170, 128, 187, 48, 53, 2, 251, 139, 185, 204, 125, 42, 51, 0, 25, 51, 200, 155, 202, 204, 154, 136, 160, 188, 186, 207, 172, 9, 137, 16, 34, 177, 207, 203, 203, 154, 16, 1, 153, 136, 168, 202, 154, 0, 233, 188, 203, 155, 8, 33, 18, 52, 146, 172, 153, 234, 172, 25, 2, 169, 64, 38, 144, 42, 69, 35, 0, 0, 192, 172, 65, 18, 81, 67, 69, 130, 137, 17, 144, 65, 69, 129, 153, 56, 20, 16, 69, 67, 34, 0, 152, 172, 32, 129, 99, 19, 1, 24, 50, 1, 128, 114, 55, 185, 155, 0, 168, 187, 112, 53, 1, 16, 160, 188, 138, 1, 0, 83, 145, 219, 172, 48, 4, 65, 37, 160, 202, 186, 187, 72, 53, 3, 1, 169, 187, 137, 49, 145, 73, 39, 217, 10, 144, 189, 65, 146, 56, 39, 34, 147, 190, 154, 152, 171, 0, 185, 187, 154, 117, 37, 129, 8, 1, 219, 220, 172, 24, 2, 138, 101, 130, 170, 137, 185, 173, 32, 36, 17, 34, 145, 190, 154, 65, 21, 169, 9, 144, 189, 25, 99, 162, 190, 188, 190, 26, 68, 52, 83, 2, 184, 204, 171, 154, 0, 83, 52, 2, 33, 1, 168, 153, 0, 144, 202, 155, 115, 18, 81, 37, 51, 18, 185, 170, 205, 154, 17, 67, 37, 17, 1, 185, 154, 153, 24, 130, 187, 155, 251, 191, 25, 128, 171, 8, 128, 168, 218, 187, 236, 190, 170, 218, 171, 8, 0, 17, 34, 130, 238, 188, 186, 188, 138, 17, 152, 24, 17, 144, 155, 0, 253, 204, 153, 169, 153, 65, 36, 1, 17, 1, 218, 188, 169, 154, 65, 53, 18, 0, 152, 138, 83, 35, 67, 51, 19, 201, 27, 53, 2, 115, 4, 0, 50, 20, 50, 51, 50, 54, 2, 129, 202, 138, 81, 71, 34, 52, 18, 169, 185, 189, 10, 36, 34, 53, 17, 128, 169, 9, 144, 187, 81, 4, 186, 24, 128, 24, 85, 35, 144, 250, 174, 136, 136, 51, 53, 35, 201, 170, 189, 188, 56, 37, 49, 38, 152, 152, 184, 174, 8, 136, 65, 130, 64, 21, 136, 8, 144, 235, 155, 82, 2, 153, 48, 161, 172, 66, 2, 153, 219, 170, 140, 98, 50, 129, 186, 218, 239, 137, 34, 17, 34, 128, 200, 221, 137, 1, 8, 83, 34, 169, 186, 186, 154, 144, 104, 38, 184, 24, 200, 41, 5, 155, 218, 223, 155, 9, 81, 54, 52, 18, 184, 205, 172, 153, 24, 83, 36, 18, 129, 168, 171, 9, 8, 33, 128, 8, 0, 98, 68, 83, 51, 145, 234, 170, 169, 137, 66, 53, 35, 1, 160, 235, 170, 0, 17, 34, 1, 234, 173, 138, 170, 49, 35, 153, 153, 251, 187, 219, 154, 201, 188, 170, 203, 138, 34, 19, 18, 235, 221, 204, 154, 169, 9, 34, 129, 137, 169, 171, 202, 171, 185, 191, 172, 153, 16, 66, 36, 18, 144, 188, 219, 172, 154, 64, 67, 67, 36, 0, 168, 171, 8, 8, 81, 69, 19, 18, 34, 33, 18, 17, 18, 50, 50, 118, 36, 33, 51, 171, 236, 43, 0, 50, 69, 18, 136, 202, 138, 50, 99, 55, 35, 2, 201, 171, 186, 40, 69, 51, 1, 136, 217, 139, 33, 17, 49, 20, 217, 189, 25, 2, 72, 55, 1, 185, 204, 186, 138, 80, 68, 2, 1, 201, 203, 154, 32, 52, 51, 3, 204, 171, 172, 40, 51, 83, 19, 168, 187, 10, 99, 51, 16, 145, 255, 155, 8, 40, 69, 50, 3, 202, 203, 204, 154, 48, 50, 83, 19, 216, 187, 169, 187, 57, 55, 129, 8, 201, 188, 9, 34, 36, 34, 145, 221, 187, 138, 16, 66, 87, 144, 11, 129, 219, 25, 66, 130, 172, 169, 223, 155, 48, 68, 99, 51, 130, 188, 203, 188, 139, 67, 50, 68, 34, 129, 154, 137, 152, 153, 16, 160, 157, 51, 85, 52, 67, 2, 168, 219, 187, 170, 56, 53, 36, 36, 129, 169, 170, 202, 138, 16, 152, 187, 153, 152, 26, 54, 1, 200, 207, 187, 203, 138, 128, 153, 169, 205, 188, 154, 169, 48, 131, 234, 204, 189, 187, 154, 136, 49, 145, 9, 251, 156, 137, 153, 153, 185, 206, 170, 8, 50, 36, 52, 146, 185, 206, 187, 170, 25, 99, 51, 53, 18, 0, 168, 219, 138, 48, 17, 64, 70, 17, 50, 51, 35, 184, 42, 211, 175, 82, 18, 34, 52, 19, 1, 128, 137, 203, 10, 84, 17, 99, 35, 0, 136, 168, 170, 24, 36, 160, 40, 18, 1, 48, 103, 1, 169, 188, 172, 156, 32, 67, 54, 131, 170, 153, 223, 10, 2, 40, 35, 152, 0, 219, 26, 34, 32, 51, 217, 171, 190, 57, 20, 67, 3, 144, 203, 170, 80, 53, 17, 1, 250, 172, 9, 17, 66, 84, 18, 168, 172, 170, 171, 24, 52, 3, 136, 128, 190, 138, 66, 19, 168, 236, 171, 189, 72, 20, 136, 51, 249, 157, 152, 24, 18, 82, 20, 184, 139, 184, 174, 40, 35, 51, 145, 153, 168, 155, 8, 160, 255, 189, 219, 154, 82, 86, 67, 2, 152, 203, 188, 171, 25, 69, 51, 36, 129, 153, 169, 137, 8, 49, 3, 186, 24, 136, 118, 38, 34, 129, 170, 202, 204, 9, 33, 52, 35, 35, 168, 189, 154, 186, 8, 130, 152, 217, 188, 25, 34, 51, 160, 206, 205, 188, 154, 8, 16, 1, 217, 172, 172, 154, 9, 49, 176, 190, 204, 188, 154, 8, 49, 18, 169, 235, 188, 154, 152, 8, 129, 235, 187, 154, 49, 69, 67, 1, 218, 172, 153, 138, 65, 51, 34, 34, 50, 33, 82, 35, 200, 173, 9, 33, 86, 83, 67, 1, 128, 128, 154, 137, 82, 51, 34, 67, 51, 51, 83, 51, 2, 144, 202, 157, 99, 34, 68, 19, 129, 185, 156, 128, 32, 52, 35, 176, 190, 8, 152, 64, 37, 145, 153, 236, 155, 0, 49, 37, 17, 185, 190, 171, 139, 65, 54, 19, 160, 204, 186, 172, 49, 53, 50, 1, 160, 207, 137, 16, 16, 66, 35, 168, 25, 51, 160, 41, 5, 221, 171, 8, 50, 84, 52, 2, 169, 203, 203, 152, 6, 43, 0, 156, 24, 18, 8, 53, 160, 58, 163, 174, 201, 174, 24, 1, 48, 51, 152, 249, 191, 16, 145, 25, 66, 176, 191, 10, 17, 0, 115, 22, 169, 136, 184, 188, 27, 37, 1, 67, 19, 203, 41, 176, 156, 153, 219, 206, 153, 0, 114, 55, 51, 0, 185, 204, 173, 154, 49, 83, 83, 18, 144, 169, 137, 152, 40, 17, 129, 155, 0, 16, 119, 21, 2, 144, 169, 220, 153, 8, 50, 51, 52, 128, 187, 171, 186, 11, 17, 186, 234, 206, 137, 8, 51, 35, 160, 220, 220, 187, 138, 136, 8, 1, 202, 189, 171, 137, 32, 2, 185, 222, 189, 172, 138, 1, 32, 2, 169, 201, 172, 137, 0, 144, 218, 220, 154, 9, 65, 69, 18, 128, 153, 186, 188, 153, 49, 20, 66, 53, 19, 66, 3, 153, 160, 189, 9, 82, 36, 99, 36, 2, 17, 0, 144, 153, 24, 52, 136, 113, 38, 17, 48, 51, 185, 11, 145, 155, 100, 36, 18, 0, 8, 200, 157, 81, 144, 41, 4, 203, 9, 1, 9, 16, 1, 168, 223, 154, 128, 138, 113, 19, 169, 8, 201, 173, 10, 34, 17, 0, 18, 249, 172, 25, 33, 48, 70, 128, 138, 168, 138, 144, 42, 71, 129, 26, 37, 129, 67, 19, 168, 204, 187, 154, 8, 100, 52, 2, 136, 169, 138, 186, 57, 21, 153, 204, 9, 145, 25, 70, 161, 174, 16, 168, 138, 82, 36, 200, 173, 168, 191, 9, 34, 19, 82, 19, 235, 171, 187, 138, 33, 53, 35, 1, 16, 233, 42, 20, 203, 8, 200, 174, 25, 67, 50, 67, 147, 239, 170, 169, 9, 115, 54, 35, 129, 169, 188, 189, 137, 34, 68, 36, 18, 128, 152, 137, 17, 1, 144, 137, 185, 73, 71, 83, 67, 17, 168, 204, 170, 138, 16, 115, 35, 129, 136, 185, 188, 138, 136, 137, 168, 187, 188, 155, 32, 20, 176, 239, 188, 187, 187, 154, 34, 144, 203, 220, 204, 171, 9, 128, 136, 136, 220, 188, 156, 154, 152, 16, 152, 204, 153, 144, 10, 50, 130, 222, 171, 203, 10, 66, 83, 20, 129, 136, 186, 155, 136, 8, 114, 51, 51, 53, 36, 18, 0, 0, 217, 156, 82, 35, 82, 69, 18, 1, 1, 168, 202, 9, 36, 2, 98, 37, 1, 32, 18, 153, 154, 137, 186, 58, 87, 35, 17, 50, 177, 175, 8, 168, 154, 50, 162, 11, 19, 17, 216, 138, 184, 205, 188, 0, 169, 96, 19, 153, 184, 206, 187, 24, 1, 99, 36, 129, 218, 171, 169, 25, 83, 68, 1, 8, 16, 8, 32, 1, 1, 184, 59, 119, 34, 54, 2, 0, 202, 187, 187, 139, 115, 19, 82, 51, 0, 187, 203, 188, 154, 26, 68, 16, 66, 146, 153, 235, 155, 218, 156, 16, 1, 50, 37, 201, 138, 250, 172, 136, 136, 40, 20, 153, 17, 235, 137, 169, 40, 4, 24, 36, 186, 74, 22, 170, 32, 130, 154, 221, 58, 39, 33, 68, 168, 220, 189, 203, 153, 66, 71, 32, 5, 63, 0, 36, 17, 129, 202, 203, 171, 136, 50, 54, 51, 18, 2, 1, 8, 1, 170, 235, 171, 8, 41, 119, 21, 18, 0, 136, 203, 156, 153, 24, 49, 36, 35, 0, 169, 186, 189, 170, 203, 154, 170, 202, 10, 19, 153, 184, 239, 203, 171, 202, 137, 136, 152, 220, 187, 203, 187, 25, 1, 136, 169, 205, 204, 188, 169, 153, 154, 153, 186, 41, 36, 17, 1, 176, 255, 172, 170, 24, 17, 98, 19, 1, 1, 136, 169, 168, 10, 3, 139, 70, 34, 100, 67, 34, 17, 0, 1, 202, 40, 54, 35, 84, 35, 0, 0, 32, 18, 17, 83, 68, 35, 66, 37, 129, 18, 202, 154, 144, 113, 53, 34, 50, 145, 170, 170, 155, 137, 48, 4, 9, 70, 34, 66, 35, 184, 237, 204, 154, 153, 48, 38, 34, 18, 144, 204, 187, 172, 138, 16, 34, 34, 35, 1, 168, 155, 34, 251, 141, 129, 172, 80, 36, 49, 51, 192, 172, 136, 25, 101, 51, 52, 19, 136, 153, 219, 172, 154, 136, 64, 70, 34, 34, 17, 202, 171, 187, 172, 187, 155, 8, 115, 68, 51, 129, 152, 251, 157, 9, 128, 9, 18, 202, 155, 152, 172, 24, 128, 82, 68, 34, 144, 170, 235, 190, 153, 169, 138, 66, 83, 52, 35, 34, 193, 175, 137, 186, 25, 18, 49, 35, 81, 54, 18, 33, 160, 190, 139, 16, 33, 71, 3, 168, 204, 189, 188, 10, 83, 68, 52, 36, 2, 152, 202, 203, 171, 138, 16, 49, 69, 52, 67, 36, 17, 129, 186, 204, 187, 171, 24, 52, 52, 69, 18, 1, 152, 170, 203, 187, 154, 169, 139, 32, 17, 136, 153, 237, 205, 170, 203, 154, 153, 153, 170, 219, 203, 220, 171, 187, 172, 154, 154, 8, 0, 169, 201, 205, 204, 203, 187, 155, 154, 137, 34, 19, 136, 17, 235, 155, 201, 173, 154, 172, 138, 0, 48, 71, 51, 18, 18, 168, 186, 186, 10, 83, 68, 53, 35, 51, 2, 136, 8, 32, 102, 35, 49, 54, 50, 51, 51, 83, 2, 137, 0, 169, 26, 71, 52, 99, 51, 34, 17, 129, 168, 170, 40, 67, 115, 52, 17, 17, 129, 16, 17, 17, 34, 52, 145, 56, 148, 140, 38, 168, 50, 130, 41, 20, 186, 10, 1, 100, 3, 203, 172, 170, 136, 65, 54, 19, 65, 2, 203, 137, 187, 41, 85, 34, 82, 19, 49, 53, 18, 99, 53, 18, 49, 67, 50, 17, 82, 53, 33, 84, 19, 34, 35, 16, 33, 50, 71, 67, 18, 33, 17, 128, 8, 48, 53, 144, 97, 18, 24, 53, 34, 68, 1, 33, 161, 190, 186, 171, 24, 66, 54, 85, 18, 1, 168, 187, 173, 187, 138, 17, 49, 38, 16, 36, 145, 8, 184, 206, 205, 187, 171, 25, 50, 69, 1, 8, 184, 191, 186, 235, 170, 186, 186, 136, 8, 83, 130, 8, 160, 221, 203, 188, 219, 170, 170, 24, 18, 49, 20, 201, 204, 204, 171, 155, 152, 186, 153, 219, 172, 9, 144, 83, 254, 26, 0, 16, 136, 161, 223, 138, 185, 139, 1, 137, 128, 154, 216, 189, 169, 140, 2, 154, 85, 145, 138, 144, 187, 80, 36, 82, 3, 137, 128, 186, 154, 114, 52, 85, 19, 8, 128, 168, 9, 67, 84, 52, 35, 50, 144, 154, 169, 171, 139, 99, 67, 70, 2, 49, 18, 136, 129, 219, 171, 236, 155, 152, 25, 37, 129, 17, 202, 170, 204, 219, 170, 186, 172, 186, 188, 187, 188, 171, 169, 205, 187, 202, 204, 186, 203, 187, 187, 155, 204, 172, 154, 202, 188, 187, 190, 154, 170, 169, 185, 171, 186, 191, 171, 202, 154, 168, 153, 217, 156, 136, 9, 50, 86, 51, 67, 2, 33, 129, 25, 52, 68, 36, 50, 37, 50, 68, 67, 33, 52, 2, 50, 50, 82, 51, 52, 54, 67, 35, 34, 1, 16, 34, 51, 86, 52, 19, 34, 51, 36, 34, 54, 2, 0, 160, 170, 32, 85, 69, 51, 35, 51, 145, 10, 184, 157, 0, 48, 71, 50, 52, 51, 33, 51, 1, 82, 20, 16, 67, 36, 83, 68, 51, 52, 20, 16, 49, 129, 33, 36, 66, 37, 34, 67, 67, 50, 67, 51, 17, 34, 66, 52, 34, 34, 35, 52, 3, 0, 1, 251, 191, 9, 202, 26, 129, 8, 200, 203, 204, 186, 174, 170, 173, 170, 187, 171, 219, 187, 154, 218, 203, 172, 203, 172, 171, 171, 168, 170, 169, 10, 3, 206, 187, 171, 201, 173, 169, 155, 0, 171, 98, 67, 2, 26, 211, 191, 152, 186, 0, 8, 115, 53, 50, 67, 18, 19, 153, 136, 138, 153, 72, 18, 117, 52, 52, 34, 17, 33, 192, 156, 18, 9, 83, 50, 50, 1, 17, 84, 19, 188, 8, 1, 216, 138, 144, 187, 207, 9, 145, 187, 185, 174, 218, 172, 186, 156, 203, 154, 203, 203, 170, 186, 155, 218, 173, 170, 220, 171, 153, 186, 137, 168, 251, 187, 170, 24, 161, 12, 176, 191, 171, 9, 144, 203, 41, 19, 251, 25, 33, 65, 4, 154, 0, 169, 136, 219, 9, 16, 35, 65, 68, 36, 152, 66, 2, 34, 251, 11, 251, 156, 128, 34, 145, 88, 147, 187, 203, 222, 155, 169, 172, 137, 153, 154, 9, 209, 190, 203, 219, 203, 186, 170, 203, 137, 201, 139, 202, 156, 170, 203, 188, 204, 171, 154, 154, 170, 155, 219, 155, 185, 191, 155, 169, 187, 172, 24, 129, 9, 52, 193, 11, 17, 17, 3, 32, 50, 119, 5, 66, 36, 51, 35, 50, 18, 82, 52, 52, 68, 52, 35, 52, 50, 52, 34, 84, 18, 49, 53, 51, 67, 52, 67, 36, 35, 51, 67, 35, 66, 52, 50, 53, 83, 34, 34, 51, 51, 34, 68, 34, 51, 17, 52, 36, 49, 52, 34, 34, 51, 36, 34, 184, 60, 21, 49, 5, 137, 152, 48, 147, 219, 156, 33, 234, 172, 137, 235, 10, 146, 203, 9, 136, 9, 192, 172, 153, 236, 186, 205, 138, 152, 138, 8, 1, 233, 187, 9, 144, 140, 50, 236, 9, 185, 138, 24, 252, 3, 6, 0, 70, 34, 4, 152, 33, 168, 113, 18, 50, 67, 20, 171, 0, 32, 54, 65, 55, 18, 17, 145, 153, 64, 38, 0, 129, 40, 147, 140, 0, 115, 145, 144, 155, 67, 232, 154, 0, 251, 138, 144, 173, 137, 153, 8, 17, 136, 201, 206, 186, 154, 170, 204, 138, 169, 220, 155, 168, 157, 184, 172, 218, 174, 153, 169, 168, 202, 219, 187, 171, 170, 204, 155, 152, 205, 170, 186, 203, 171, 170, 203, 154, 233, 189, 136, 202, 137, 217, 140, 128, 169, 154, 136, 153, 187, 138, 237, 138, 128, 170, 185, 158, 33, 186, 88, 179, 27, 5, 139, 18, 220, 170, 188, 32, 52, 18, 48, 21, 169, 33, 160, 138, 205, 98, 177, 28, 4, 169, 8, 16, 34, 32, 2, 236, 11, 178, 159, 34, 185, 9, 217, 155, 0, 34, 251, 11, 160, 191, 138, 17, 186, 25, 50, 49, 163, 255, 9, 170, 137, 153, 112, 2, 187, 48, 161, 28, 130, 204, 172, 66, 3, 9, 85, 129, 32, 3, 25, 84, 129, 8, 17, 49, 4, 112, 37, 18, 19, 16, 35, 51, 17, 99, 129, 64, 20, 24, 53, 19, 18, 99, 147, 156, 53, 152, 33, 152, 115, 7, 153, 48, 130, 136, 168, 97, 146, 26, 19, 137, 218, 43, 21, 137, 34, 85, 146, 10, 36, 168, 10, 32, 67, 176, 42, 19, 116, 132, 25, 18, 32, 132, 26, 71, 18, 34, 34, 129, 48, 53, 34, 128, 114, 71, 8, 33, 32, 2, 33, 36, 33, 22, 32, 35, 49, 38, 33, 38, 153, 65, 128, 50, 34, 55, 1, 32, 128, 8, 50, 144, 113, 146, 74, 36, 66, 130, 170, 16, 24, 35, 251, 141, 33, 9, 20, 203, 50, 171, 240, 175, 17, 185, 153, 170, 8, 204, 10, 128, 153, 235, 154, 152, 219, 9, 192, 189, 153, 9, 161, 171, 2, 185, 239, 138, 217, 140, 128, 24, 17, 16, 216, 172, 8, 128, 170, 32, 234, 10, 192, 12, 2, 40, 131, 27, 149, 13, 37, 168, 184, 10, 36, 218, 40, 38, 0, 65, 36, 160, 0, 200, 113, 146, 42, 22, 170, 32, 18, 2, 41, 21, 0, 0, 33, 160, 114, 146, 155, 16, 34, 184, 60, 133, 191, 65, 176, 11, 176, 174, 40, 130, 139, 53, 252, 10, 160, 171, 170, 40, 208, 174, 8, 144, 169, 186, 172, 24, 128, 154, 138, 136, 153, 204, 188, 235, 154, 185, 203, 189, 25, 192, 64, 147, 157, 200, 174, 0, 186, 170, 170, 168, 172, 64, 162, 142, 0, 186, 25, 249, 158, 154, 25, 3, 187, 41, 146, 221, 42, 178, 158, 1, 170, 144, 189, 32, 202, 170, 187, 33, 16, 70, 144, 128, 207, 24, 184, 41, 146, 153, 169, 252, 42, 146, 41, 177, 27, 185, 114, 225, 10, 51, 129, 128, 153, 220, 42, 20, 185, 114, 3, 185, 8, 18, 99, 3, 8, 66, 18, 153, 115, 19, 16, 116, 130, 138, 66, 34, 128, 97, 21, 153, 65, 1, 40, 35, 152, 222, 254, 10, 0, 115, 5, 136, 67, 129, 137, 40, 35, 136, 114, 18, 1, 32, 8, 49, 35, 6, 204, 56, 234, 73, 3, 27, 5, 171, 32, 17, 34, 160, 112, 21, 203, 32, 216, 26, 3, 154, 52, 145, 153, 202, 154, 185, 112, 2, 155, 34, 9, 39, 220, 24, 185, 81, 131, 170, 48, 162, 57, 211, 60, 132, 172, 65, 128, 81, 130, 155, 35, 220, 155, 65, 129, 32, 19, 192, 11, 23, 202, 40, 130, 155, 54, 185, 57, 160, 113, 2, 65, 200, 27, 20, 137, 50, 168, 104, 5, 188, 64, 19, 128, 171, 50, 18, 128, 201, 12, 39, 186, 115, 3, 202, 137, 128, 136, 0, 16, 0, 50, 177, 141, 34, 168, 82, 179, 157, 130, 140, 70, 216, 139, 34, 9, 129, 189, 153, 138, 50, 2, 251, 28, 52, 163, 157, 18, 205, 64, 131, 203, 41, 131, 154, 68, 168, 137, 32, 147, 159, 17, 153, 34, 184, 155, 172, 33, 24, 55, 185, 66, 163, 204, 98, 146, 41, 177, 202, 175, 67, 168, 114, 145, 8, 128, 64, 161, 74, 147, 58, 134, 157, 35, 129, 233, 59, 132, 41, 179, 143, 18, 169, 8, 67, 178, 121, 7, 154, 18, 0, 128, 10, 208, 14, 69, 68, 3, 188, 202, 171, 153, 32, 200, 25, 216, 40, 148, 156, 34, 250, 41, 161, 155, 161, 174, 0, 187, 8, 218, 40, 168, 48, 193, 57, 194, 57, 160, 202, 191, 49, 161, 203, 73, 38, 128, 170, 24, 67, 35, 153, 66, 160, 58, 71, 1, 49, 160, 138, 169, 137, 112, 37, 66, 3, 48, 4, 33, 185, 116, 162, 8, 186, 8, 10, 87, 33, 17, 152, 203, 25, 49, 52, 16, 3, 239, 9, 24, 50, 3, 236, 156, 33, 19, 51, 19, 251, 140, 33, 17, 35, 232, 170, 32, 130, 189, 137, 187, 112, 34, 82, 19, 170, 137, 18, 0, 53, 252, 170, 25, 145, 88, 22, 8, 152, 25, 144, 137, 185, 190, 11, 69, 128, 65, 161, 155, 137, 114, 19, 50, 232, 172, 8, 50, 2, 34, 251, 159, 0, 16, 2, 40, 35, 129, 176, 187, 169, 156, 200, 157, 128, 234, 156, 34, 35, 35, 16, 161, 207, 154, 154, 16, 168, 204, 188, 0, 64, 38, 160, 169, 10, 66, 53, 201, 188, 171, 128, 9, 132, 73, 6, 10, 52, 144, 186, 24, 202, 26, 53, 18, 184, 255, 26, 50, 69, 19, 202, 154, 153, 8, 50, 160, 157, 152, 137, 115, 34, 16, 0, 153, 33, 251, 155, 128, 202, 8, 19, 1, 8, 168, 26, 54, 86, 19, 202, 10, 152, 136, 33, 168, 170, 187, 26, 34, 64, 87, 51, 18, 136, 170, 217, 191, 40, 18, 170, 105, 37, 33, 160, 138, 201, 41, 146, 26, 216, 156, 234, 12, 67, 17, 50, 3, 186, 139, 69, 35, 65, 146, 223, 186, 169, 170, 32, 52, 55, 35, 35, 200, 188, 154, 24, 1, 169, 190, 8, 170, 113, 35, 68, 1, 136, 203, 172, 187, 137, 168, 249, 250, 38, 0, 154, 16, 50, 68, 83, 52, 50, 19, 250, 190, 171, 154, 24, 49, 69, 34, 1, 137, 51, 144, 168, 205, 169, 191, 154, 152, 72, 53, 34, 35, 17, 184, 188, 219, 40, 145, 155, 144, 222, 154, 48, 52, 68, 36, 2, 185, 169, 205, 10, 144, 153, 10, 52, 51, 67, 83, 68, 35, 217, 138, 234, 155, 152, 8, 67, 50, 51, 36, 2, 169, 136, 251, 171, 219, 170, 136, 83, 35, 32, 19, 1, 49, 38, 1, 168, 222, 203, 188, 137, 32, 99, 51, 0, 185, 171, 155, 137, 116, 51, 130, 220, 171, 186, 57, 55, 17, 128, 138, 185, 74, 54, 17, 144, 9, 250, 174, 137, 16, 66, 83, 35, 34, 160, 187, 220, 157, 136, 8, 1, 8, 35, 81, 54, 17, 34, 201, 187, 191, 171, 154, 32, 99, 36, 17, 130, 9, 201, 154, 201, 154, 186, 154, 10, 69, 66, 53, 19, 129, 169, 204, 172, 153, 170, 41, 70, 18, 16, 128, 144, 136, 81, 20, 144, 186, 173, 202, 171, 169, 40, 20, 115, 35, 49, 3, 251, 173, 170, 187, 138, 9, 17, 98, 68, 34, 130, 218, 188, 187, 153, 186, 137, 17, 100, 50, 67, 145, 202, 204, 154, 170, 32, 36, 17, 161, 188, 138, 25, 69, 67, 3, 169, 220, 172, 153, 32, 53, 33, 19, 169, 233, 157, 65, 17, 50, 2, 202, 189, 153, 136, 82, 19, 35, 208, 188, 137, 33, 81, 52, 35, 233, 188, 154, 152, 72, 39, 16, 34, 160, 185, 188, 170, 16, 34, 50, 68, 3, 152, 10, 99, 34, 168, 24, 128, 129, 207, 48, 53, 51, 66, 161, 187, 219, 137, 1, 69, 36, 1, 202, 188, 171, 25, 114, 68, 52, 3, 184, 235, 188, 154, 137, 50, 67, 69, 18, 17, 128, 168, 218, 203, 188, 138, 16, 98, 36, 33, 17, 153, 153, 187, 170, 187, 155, 16, 176, 114, 7, 16, 130, 137, 234, 156, 24, 169, 153, 128, 201, 206, 138, 16, 82, 51, 99, 146, 188, 185, 172, 8, 0, 34, 83, 53, 34, 35, 168, 137, 220, 170, 153, 24, 84, 68, 33, 52, 130, 152, 233, 172, 152, 24, 68, 34, 34, 1, 152, 170, 202, 156, 154, 138, 32, 128, 24, 1, 169, 205, 220, 189, 171, 171, 138, 169, 169, 234, 187, 220, 204, 138, 136, 168, 172, 154, 153, 251, 171, 169, 171, 189, 9, 176, 26, 249, 26, 160, 156, 2, 204, 25, 18, 34, 160, 41, 131, 187, 41, 241, 27, 4, 80, 21, 114, 35, 40, 2, 171, 33, 137, 66, 114, 37, 1, 68, 129, 24, 146, 155, 52, 50, 36, 137, 36, 0, 53, 19, 19, 234, 24, 129, 25, 33, 115, 19, 17, 66, 162, 207, 32, 169, 40, 0, 66, 162, 11, 50, 162, 191, 26, 161, 207, 41, 53, 144, 99, 177, 11, 160, 12, 217, 139, 34, 18, 64, 39, 169, 153, 203, 9, 2, 65, 71, 144, 153, 186, 139, 128, 99, 19, 137, 152, 64, 36, 185, 140, 58, 255, 38, 0, 129, 25, 55, 1, 18, 170, 115, 177, 159, 16, 128, 16, 8, 100, 35, 0, 8, 216, 171, 16, 64, 51, 49, 51, 176, 58, 4, 223, 137, 0, 51, 184, 113, 3, 33, 35, 68, 146, 191, 156, 203, 155, 115, 35, 17, 168, 172, 202, 172, 9, 32, 35, 85, 19, 128, 160, 205, 169, 154, 32, 65, 52, 50, 34, 34, 176, 139, 1, 251, 138, 83, 18, 68, 20, 17, 35, 128, 152, 235, 138, 33, 84, 34, 34, 20, 168, 155, 136, 202, 187, 154, 176, 158, 1, 25, 21, 185, 221, 188, 218, 172, 152, 154, 168, 138, 233, 173, 152, 171, 152, 187, 203, 205, 188, 172, 170, 154, 8, 136, 185, 174, 171, 188, 171, 185, 174, 137, 218, 9, 145, 10, 21, 169, 152, 203, 152, 219, 41, 50, 67, 36, 34, 160, 189, 24, 129, 10, 85, 51, 18, 116, 21, 0, 18, 17, 160, 159, 34, 136, 84, 2, 67, 130, 16, 3, 187, 48, 144, 84, 128, 115, 129, 9, 0, 0, 17, 136, 69, 184, 32, 235, 48, 145, 154, 96, 3, 137, 168, 112, 178, 159, 18, 128, 32, 144, 56, 163, 43, 21, 64, 5, 170, 16, 1, 129, 97, 38, 128, 49, 162, 10, 144, 104, 22, 32, 55, 1, 49, 160, 186, 172, 154, 25, 69, 67, 68, 129, 170, 8, 160, 173, 33, 0, 36, 186, 100, 233, 41, 146, 137, 160, 12, 163, 12, 3, 43, 39, 187, 16, 204, 8, 218, 42, 67, 1, 9, 85, 129, 137, 202, 154, 234, 57, 4, 10, 36, 8, 54, 218, 25, 145, 170, 136, 72, 37, 16, 69, 145, 155, 153, 170, 138, 99, 20, 16, 0, 184, 155, 218, 205, 138, 128, 153, 65, 35, 65, 55, 184, 27, 216, 156, 169, 73, 20, 16, 37, 128, 136, 8, 50, 160, 9, 16, 37, 236, 80, 18, 48, 51, 50, 146, 172, 128, 220, 80, 19, 17, 129, 41, 20, 187, 97, 146, 187, 204, 154, 152, 156, 116, 130, 170, 136, 202, 172, 154, 153, 153, 185, 174, 154, 169, 136, 154, 201, 222, 188, 173, 154, 136, 0, 0, 128, 221, 154, 202, 140, 129, 187, 16, 168, 172, 8, 34, 202, 138, 234, 155, 137, 154, 33, 4, 203, 80, 146, 157, 98, 3, 170, 16, 216, 10, 34, 67, 54, 17, 37, 169, 16, 201, 88, 3, 137, 49, 161, 57, 70, 68, 34, 4, 189, 137, 153, 128, 72, 87, 129, 9, 129, 172, 16, 138, 67, 128, 40, 18, 186, 172, 48, 39, 176, 56, 164, 158, 32, 137, 33, 128, 99, 161, 26, 18, 65, 216, 28, 19, 155, 50, 99, 36, 8, 50, 145, 174, 24, 144, 25, 115, 52, 34, 129, 56, 147, 207, 10, 34, 0, 65, 53, 176, 10, 160, 172, 8, 66, 20, 17, 249, 11, 146, 141, 0, 65, 162, 158, 1, 154, 0, 24, 21, 235, 10, 152, 9, 34, 66, 37, 233, 172, 137, 184, 73, 53, 18, 83, 176, 175, 9, 153, 24, 50, 36, 2, 114, 10, 46, 0, 152, 152, 202, 25, 3, 82, 224, 43, 36, 170, 99, 35, 129, 138, 162, 223, 16, 168, 72, 3, 32, 2, 152, 9, 176, 191, 203, 190, 155, 136, 114, 52, 51, 53, 176, 175, 170, 186, 10, 68, 50, 51, 4, 152, 187, 152, 168, 49, 131, 154, 34, 50, 115, 71, 35, 16, 144, 204, 171, 16, 33, 81, 37, 152, 137, 0, 48, 67, 1, 160, 255, 156, 8, 8, 48, 54, 128, 170, 186, 204, 154, 8, 0, 128, 169, 152, 203, 139, 49, 208, 191, 171, 188, 156, 24, 34, 17, 185, 235, 204, 154, 138, 16, 168, 171, 186, 156, 9, 33, 34, 129, 238, 188, 154, 128, 136, 128, 0, 152, 9, 115, 36, 144, 154, 218, 204, 138, 65, 69, 35, 18, 24, 128, 172, 25, 17, 33, 17, 83, 99, 85, 34, 50, 146, 204, 172, 169, 138, 117, 35, 17, 2, 170, 186, 188, 8, 50, 20, 32, 4, 206, 80, 4, 8, 8, 128, 235, 139, 33, 1, 98, 51, 160, 155, 137, 41, 20, 8, 37, 234, 10, 1, 49, 55, 51, 130, 204, 169, 185, 137, 84, 52, 18, 144, 8, 128, 172, 98, 130, 154, 16, 184, 140, 99, 35, 18, 1, 235, 156, 9, 136, 24, 50, 129, 219, 171, 48, 36, 16, 145, 223, 187, 189, 138, 67, 19, 66, 146, 206, 154, 153, 153, 65, 67, 129, 218, 171, 9, 8, 98, 18, 17, 200, 188, 170, 10, 85, 4, 8, 36, 250, 11, 2, 137, 81, 3, 168, 139, 8, 8, 81, 35, 98, 130, 189, 154, 0, 153, 115, 21, 136, 152, 153, 170, 138, 50, 17, 233, 205, 155, 128, 56, 119, 51, 129, 153, 234, 172, 137, 32, 66, 68, 18, 136, 169, 137, 153, 48, 52, 2, 170, 49, 216, 80, 38, 50, 129, 154, 186, 173, 24, 50, 51, 19, 169, 154, 137, 85, 19, 176, 239, 187, 172, 137, 33, 54, 18, 153, 219, 204, 170, 136, 137, 33, 152, 203, 154, 136, 170, 16, 249, 205, 186, 154, 153, 16, 50, 162, 191, 154, 185, 172, 24, 2, 204, 155, 137, 137, 49, 69, 145, 186, 172, 187, 170, 33, 35, 35, 24, 70, 33, 68, 2, 186, 172, 153, 204, 96, 55, 18, 17, 18, 185, 157, 33, 145, 41, 70, 2, 8, 66, 36, 129, 9, 160, 223, 9, 34, 49, 68, 19, 169, 203, 171, 186, 58, 55, 0, 16, 185, 155, 84, 2, 24, 35, 253, 139, 0, 136, 48, 87, 130, 154, 16, 184, 138, 50, 3, 24, 34, 66, 144, 116, 23, 0, 1, 168, 188, 40, 1, 80, 54, 35, 128, 8, 161, 173, 40, 17, 0, 66, 35, 145, 25, 54, 162, 157, 17, 250, 138, 184, 138, 67, 144, 56, 133, 174, 9, 234, 137, 145, 138, 0, 128, 203, 138, 160, 235, 172, 49, 193, 155, 32, 68, 161, 172, 9, 144, 205, 40, 147, 24, 35, 113, 19, 8, 2, 204, 204, 26, 160, 114, 7, 8, 1, 152, 187, 8, 0, 116, 160, 25, 150, 3, 47, 0, 131, 173, 16, 50, 17, 68, 192, 10, 177, 143, 33, 128, 16, 1, 204, 40, 161, 25, 83, 208, 190, 137, 202, 57, 103, 35, 18, 152, 202, 204, 155, 48, 83, 83, 34, 144, 169, 154, 137, 33, 65, 36, 160, 24, 129, 72, 69, 19, 153, 153, 205, 9, 24, 68, 1, 144, 185, 173, 154, 17, 35, 161, 222, 235, 170, 137, 32, 52, 130, 202, 188, 189, 187, 11, 49, 128, 152, 0, 236, 155, 144, 202, 186, 187, 220, 154, 33, 52, 1, 153, 234, 204, 154, 0, 17, 35, 19, 145, 187, 32, 2, 32, 53, 161, 188, 32, 69, 36, 1, 66, 19, 186, 113, 23, 136, 16, 0, 186, 140, 69, 35, 34, 35, 130, 204, 170, 152, 137, 98, 52, 2, 0, 16, 128, 187, 171, 170, 223, 25, 34, 64, 38, 136, 169, 191, 137, 169, 10, 84, 1, 169, 9, 17, 250, 25, 36, 202, 26, 67, 176, 156, 98, 19, 137, 24, 49, 35, 187, 113, 20, 16, 34, 34, 17, 98, 68, 34, 16, 67, 160, 155, 82, 51, 83, 68, 18, 128, 8, 18, 234, 26, 52, 162, 10, 69, 145, 172, 152, 152, 152, 186, 80, 193, 175, 16, 200, 138, 144, 169, 168, 190, 137, 168, 138, 35, 200, 9, 250, 175, 24, 168, 10, 68, 145, 154, 144, 219, 138, 33, 50, 68, 50, 37, 184, 140, 18, 16, 144, 40, 19, 67, 144, 168, 121, 23, 202, 48, 17, 34, 168, 32, 176, 139, 250, 173, 64, 130, 112, 22, 170, 9, 185, 155, 218, 104, 37, 152, 40, 130, 219, 153, 8, 129, 153, 56, 3, 222, 40, 132, 189, 9, 168, 156, 99, 68, 53, 18, 128, 235, 203, 137, 136, 81, 53, 35, 1, 152, 186, 172, 24, 17, 33, 67, 19, 129, 16, 70, 145, 137, 234, 171, 155, 48, 37, 33, 129, 203, 235, 187, 8, 128, 0, 251, 158, 170, 171, 40, 50, 18, 136, 237, 219, 186, 154, 137, 16, 8, 16, 153, 152, 202, 186, 219, 206, 172, 8, 16, 67, 67, 19, 169, 219, 172, 8, 0, 82, 36, 1, 0, 33, 17, 1, 0, 49, 144, 56, 54, 83, 20, 17, 144, 40, 52, 68, 130, 8, 217, 187, 219, 25, 85, 18, 51, 145, 188, 188, 188, 9, 152, 64, 36, 136, 17, 160, 203, 185, 255, 137, 128, 8, 51, 130, 0, 176, 223, 137, 16, 17, 1, 0, 34, 250, 25, 17, 68, 19, 0, 136, 200, 27, 37, 83, 53, 35, 34, 233, 26, 53, 128, 50, 19, 16, 160, 142, 87, 2, 32, 19, 219, 138, 8, 144, 64, 68, 35, 168, 10, 152, 153, 138, 17, 160, 154, 219, 219, 42, 55, 144, 50, 249, 174, 153, 153, 137, 50, 51, 201, 139, 145, 223, 25, 129, 138, 16, 144, 202, 139, 36, 184, 56, 53, 176, 159, 17, 216, 10, 67, 18, 0, 184, 140, 129, 26, 119, 130, 17, 160, 171, 169, 12, 70, 130, 40, 36, 219, 10, 129, 154, 138, 98, 131, 154, 170, 8, 44, 0, 115, 146, 157, 16, 152, 154, 138, 128, 8, 50, 115, 146, 9, 2, 255, 138, 17, 136, 128, 50, 163, 189, 24, 19, 186, 98, 162, 205, 155, 129, 156, 50, 162, 156, 1, 251, 159, 115, 51, 19, 33, 2, 251, 174, 136, 0, 49, 55, 1, 0, 144, 153, 153, 136, 49, 145, 25, 168, 42, 71, 50, 130, 170, 250, 189, 152, 138, 49, 18, 169, 217, 188, 136, 170, 9, 216, 219, 220, 155, 154, 40, 35, 8, 128, 218, 189, 172, 154, 136, 169, 17, 184, 42, 54, 36, 8, 16, 201, 205, 137, 33, 67, 52, 36, 144, 48, 36, 8, 99, 18, 168, 137, 56, 69, 17, 86, 2, 152, 24, 152, 138, 144, 155, 66, 201, 58, 39, 144, 0, 169, 204, 189, 155, 128, 137, 32, 144, 203, 171, 8, 251, 29, 146, 173, 153, 136, 169, 41, 37, 168, 138, 1, 98, 2, 114, 147, 154, 168, 187, 57, 119, 4, 17, 18, 145, 156, 66, 18, 144, 72, 6, 153, 66, 3, 48, 68, 130, 201, 171, 97, 177, 73, 39, 144, 8, 152, 186, 138, 115, 2, 9, 35, 235, 139, 168, 138, 67, 128, 137, 170, 138, 1, 139, 55, 217, 170, 204, 156, 9, 33, 53, 129, 32, 200, 174, 136, 154, 48, 35, 3, 235, 9, 144, 40, 87, 129, 49, 176, 173, 136, 137, 65, 35, 82, 130, 172, 16, 184, 41, 39, 17, 160, 172, 128, 188, 56, 132, 73, 21, 203, 25, 168, 26, 131, 9, 225, 191, 136, 168, 9, 52, 2, 128, 217, 187, 172, 138, 32, 17, 69, 160, 12, 51, 250, 10, 52, 129, 48, 20, 201, 72, 130, 137, 24, 20, 170, 82, 83, 36, 136, 17, 233, 189, 64, 146, 138, 99, 146, 187, 153, 239, 139, 17, 24, 117, 36, 34, 0, 185, 220, 187, 138, 1, 82, 54, 18, 1, 128, 185, 172, 10, 184, 157, 33, 16, 35, 82, 37, 169, 155, 236, 155, 152, 9, 18, 152, 1, 235, 10, 176, 26, 147, 173, 218, 189, 153, 170, 40, 2, 32, 19, 137, 18, 169, 169, 255, 154, 202, 9, 67, 68, 35, 51, 3, 168, 154, 136, 0, 128, 41, 38, 16, 119, 35, 35, 34, 144, 218, 171, 171, 56, 36, 1, 18, 18, 0, 170, 66, 209, 221, 188, 203, 186, 138, 34, 162, 154, 144, 172, 202, 189, 16, 249, 174, 154, 153, 24, 65, 53, 3, 16, 2, 204, 154, 136, 24, 2, 81, 70, 34, 83, 18, 17, 3, 187, 152, 153, 32, 67, 69, 36, 34, 69, 2, 136, 64, 160, 157, 144, 172, 48, 128, 49, 48, 119, 162, 139, 33, 218, 154, 169, 24, 233, 27, 36, 152, 0, 16, 4, 236, 137, 128, 170, 169, 139, 37, 186, 113, 35, 1, 136, 34, 248, 156, 1, 136, 32, 34, 82, 20, 24, 19, 41, 6, 154, 24, 201, 155, 8, 49, 38, 66, 52, 145, 188, 154, 218, 173, 24, 160, 138, 144, 187, 153, 172, 32, 250, 156, 201, 188, 187, 156, 7, 241, 45, 0, 50, 0, 100, 161, 139, 160, 175, 24, 0, 65, 146, 57, 131, 171, 84, 18, 33, 129, 202, 190, 41, 22, 66, 54, 1, 136, 128, 187, 9, 67, 37, 152, 32, 160, 155, 34, 114, 39, 0, 136, 169, 189, 8, 185, 48, 19, 168, 42, 243, 158, 18, 186, 251, 190, 138, 17, 49, 119, 21, 1, 128, 185, 204, 155, 16, 16, 66, 53, 33, 129, 153, 17, 202, 171, 187, 188, 187, 97, 19, 48, 39, 152, 168, 188, 170, 154, 153, 203, 156, 184, 157, 8, 64, 22, 168, 32, 217, 172, 153, 169, 152, 170, 25, 49, 52, 69, 53, 130, 152, 202, 187, 169, 9, 67, 52, 37, 35, 67, 36, 17, 1, 168, 204, 155, 24, 18, 83, 67, 18, 160, 8, 1, 153, 34, 250, 191, 188, 187, 186, 171, 32, 35, 136, 24, 176, 222, 187, 221, 204, 154, 152, 8, 66, 67, 52, 129, 137, 136, 170, 10, 98, 52, 17, 84, 35, 2, 33, 51, 145, 153, 114, 20, 33, 53, 145, 8, 145, 202, 172, 64, 162, 158, 49, 217, 26, 19, 185, 170, 170, 185, 206, 138, 0, 170, 137, 250, 142, 33, 19, 136, 100, 19, 201, 140, 1, 170, 48, 128, 97, 19, 137, 84, 18, 17, 8, 34, 249, 139, 34, 16, 84, 51, 1, 24, 145, 187, 72, 52, 128, 170, 24, 249, 175, 16, 145, 8, 17, 152, 218, 172, 152, 188, 170, 220, 139, 152, 170, 24, 50, 19, 234, 187, 204, 188, 154, 128, 0, 32, 35, 17, 66, 51, 69, 36, 160, 11, 70, 145, 42, 70, 129, 136, 50, 3, 187, 114, 7, 152, 65, 145, 186, 172, 10, 185, 42, 54, 2, 82, 130, 186, 201, 205, 171, 8, 144, 80, 38, 144, 10, 131, 222, 25, 1, 136, 32, 18, 184, 170, 170, 138, 98, 37, 129, 170, 40, 243, 191, 128, 251, 138, 33, 49, 119, 51, 35, 1, 168, 221, 155, 152, 136, 81, 36, 18, 0, 33, 129, 137, 170, 186, 236, 188, 137, 153, 32, 129, 40, 184, 157, 136, 16, 200, 155, 250, 223, 155, 138, 136, 0, 65, 36, 16, 17, 136, 136, 202, 188, 187, 155, 32, 99, 53, 52, 51, 51, 17, 16, 2, 184, 188, 188, 186, 155, 80, 53, 51, 68, 18, 1, 16, 0, 251, 205, 203, 187, 188, 137, 32, 67, 34, 17, 128, 186, 221, 186, 203, 187, 188, 154, 24, 66, 52, 52, 34, 34, 0, 34, 0, 50, 145, 153, 171, 10, 119, 39, 66, 51, 52, 34, 8, 128, 201, 188, 186, 156, 9, 49, 68, 35, 2, 128, 186, 207, 156, 168, 203, 155, 154, 170, 32, 18, 84, 34, 129, 24, 145, 157, 50, 1, 16, 145, 205, 57, 37, 114, 55, 35, 18, 128, 137, 216, 172, 50, 2, 33, 66, 54, 16, 18, 66, 21, 186, 139, 185, 156, 137, 48, 36, 169, 170, 189, 172, 153, 56, 54, 185, 170, 253, 203, 170, 9, 17, 49, 51, 1, 161, 173, 8, 144, 154, 0, 200, 18, 2, 35, 0, 188, 64, 69, 51, 35, 146, 171, 251, 173, 24, 49, 51, 69, 130, 172, 137, 186, 154, 56, 37, 234, 10, 218, 156, 17, 0, 48, 37, 168, 8, 168, 128, 171, 144, 171, 250, 207, 16, 136, 136, 48, 38, 202, 41, 144, 33, 254, 88, 147, 10, 144, 25, 129, 155, 97, 71, 161, 155, 17, 219, 138, 136, 115, 130, 9, 17, 184, 204, 24, 145, 26, 19, 153, 1, 173, 33, 224, 205, 171, 160, 222, 40, 69, 68, 35, 66, 1, 185, 188, 154, 169, 24, 67, 36, 17, 35, 33, 34, 144, 169, 235, 221, 170, 186, 171, 153, 186, 186, 171, 9, 50, 83, 37, 145, 252, 188, 188, 187, 187, 9, 18, 85, 51, 50, 20, 0, 128, 188, 154, 137, 154, 40, 66, 85, 51, 51, 67, 34, 16, 136, 136, 136, 186, 222, 172, 171, 187, 171, 41, 51, 114, 52, 2, 160, 251, 204, 188, 171, 170, 8, 0, 24, 35, 1, 152, 24, 19, 219, 8, 202, 26, 35, 2, 48, 119, 34, 66, 50, 70, 51, 51, 2, 16, 184, 156, 168, 25, 100, 53, 18, 33, 1, 202, 189, 171, 153, 138, 128, 185, 235, 203, 185, 203, 154, 128, 185, 155, 169, 138, 49, 3, 203, 112, 21, 10, 87, 35, 66, 53, 1, 17, 176, 11, 1, 49, 119, 51, 1, 48, 20, 201, 138, 16, 202, 139, 16, 144, 188, 104, 20, 153, 16, 160, 169, 237, 41, 18, 235, 25, 160, 172, 9, 49, 35, 81, 54, 128, 9, 129, 170, 186, 171, 65, 131, 137, 117, 20, 16, 68, 2, 153, 24, 129, 186, 154, 8, 2, 250, 10, 2, 204, 48, 146, 186, 237, 154, 233, 156, 24, 169, 137, 0, 152, 204, 137, 153, 138, 168, 10, 21, 222, 25, 2, 152, 72, 36, 8, 145, 26, 87, 0, 32, 2, 170, 169, 137, 136, 67, 3, 0, 200, 187, 202, 173, 25, 152, 188, 17, 252, 44, 162, 143, 18, 186, 115, 21, 129, 153, 33, 234, 189, 138, 34, 144, 48, 67, 37, 154, 16, 200, 185, 222, 25, 160, 154, 17, 37, 168, 65, 248, 156, 153, 25, 69, 69, 52, 36, 17, 128, 152, 203, 154, 136, 16, 17, 66, 52, 17, 32, 1, 170, 236, 204, 169, 186, 187, 202, 203, 171, 203, 171, 24, 0, 84, 130, 137, 168, 206, 187, 188, 138, 144, 24, 70, 34, 36, 51, 17, 0, 17, 152, 152, 25, 35, 168, 64, 37, 18, 34, 52, 34, 34, 99, 130, 235, 188, 205, 220, 187, 155, 171, 8, 33, 68, 17, 0, 184, 172, 204, 170, 186, 186, 154, 187, 171, 34, 17, 87, 50, 69, 35, 34, 34, 1, 136, 188, 140, 136, 10, 116, 52, 66, 51, 51, 2, 154, 0, 185, 138, 169, 169, 170, 253, 157, 128, 154, 9, 80, 3, 137, 184, 190, 190, 171, 186, 157, 152, 9, 2, 0, 69, 35, 34, 144, 138, 81, 18, 96, 38, 17, 83, 129, 40, 20, 137, 99, 19, 50, 38, 34, 34, 128, 180, 12, 40, 0, 40, 3, 223, 137, 17, 200, 155, 16, 8, 192, 157, 0, 171, 49, 201, 81, 161, 57, 163, 191, 49, 192, 139, 67, 51, 36, 84, 52, 19, 8, 49, 168, 10, 3, 138, 37, 217, 73, 36, 128, 49, 38, 128, 169, 187, 221, 170, 202, 140, 128, 189, 137, 169, 136, 154, 99, 131, 137, 136, 218, 219, 170, 8, 1, 202, 42, 23, 169, 56, 51, 132, 155, 53, 251, 138, 168, 26, 145, 158, 83, 201, 48, 132, 32, 20, 32, 36, 249, 140, 152, 154, 25, 19, 186, 49, 251, 141, 1, 16, 52, 161, 8, 218, 171, 217, 189, 24, 147, 205, 40, 160, 114, 4, 48, 36, 153, 137, 218, 173, 32, 2, 41, 3, 24, 3, 207, 24, 184, 188, 170, 153, 32, 119, 52, 36, 50, 50, 145, 154, 168, 155, 136, 40, 52, 1, 99, 3, 17, 145, 24, 248, 203, 170, 218, 204, 170, 203, 188, 171, 171, 8, 1, 66, 21, 128, 129, 218, 172, 186, 188, 170, 137, 49, 53, 67, 52, 52, 2, 16, 18, 33, 145, 139, 2, 223, 153, 186, 137, 136, 81, 35, 67, 36, 0, 168, 206, 188, 189, 187, 203, 10, 0, 16, 36, 17, 2, 184, 8, 200, 154, 250, 172, 185, 173, 170, 170, 9, 16, 99, 52, 84, 51, 19, 34, 144, 171, 218, 187, 9, 50, 51, 87, 35, 50, 37, 49, 36, 128, 65, 160, 187, 189, 171, 205, 170, 168, 24, 1, 98, 3, 9, 131, 206, 169, 204, 9, 200, 155, 2, 16, 34, 49, 55, 34, 18, 68, 3, 64, 37, 128, 1, 144, 139, 50, 128, 81, 69, 37, 1, 82, 129, 25, 163, 158, 18, 187, 136, 188, 0, 175, 32, 153, 48, 184, 81, 177, 43, 36, 81, 179, 158, 34, 201, 186, 137, 2, 42, 103, 145, 32, 4, 8, 18, 9, 68, 176, 28, 3, 171, 33, 32, 103, 145, 137, 34, 184, 25, 19, 185, 153, 252, 155, 153, 171, 24, 34, 51, 216, 12, 51, 202, 137, 49, 148, 190, 0, 154, 99, 0, 100, 129, 8, 176, 171, 129, 137, 50, 3, 251, 10, 193, 43, 55, 168, 0, 185, 189, 173, 17, 184, 172, 153, 236, 172, 136, 153, 98, 3, 152, 0, 185, 220, 155, 136, 40, 68, 129, 16, 130, 48, 55, 51, 163, 42, 211, 191, 168, 138, 52, 168, 17, 204, 72, 130, 24, 85, 18, 8, 169, 186, 222, 138, 152, 186, 203, 10, 3, 206, 80, 19, 51, 193, 12, 18, 152, 202, 137, 160, 172, 217, 174, 48, 51, 35, 0, 116, 2, 153, 137, 129, 234, 155, 186, 9, 129, 97, 53, 1, 49, 3, 152, 153, 154, 25, 160, 156, 145, 175, 48, 240, 12, 53, 128, 115, 3, 136, 1, 184, 154, 168, 139, 87, 184, 57, 163, 175, 0, 152, 201, 157, 66, 216, 172, 32, 131, 238, 171, 137, 169, 137, 114, 39, 34, 33, 34, 2, 136, 137, 128, 185, 170, 8, 35, 33, 17, 81, 21, 202, 40, 33, 50, 146, 70, 51, 41, 0, 206, 218, 236, 187, 202, 186, 136, 136, 16, 51, 50, 51, 161, 203, 219, 187, 187, 206, 137, 185, 138, 201, 41, 131, 113, 38, 33, 67, 19, 0, 169, 188, 189, 171, 187, 155, 33, 16, 115, 19, 66, 34, 34, 1, 24, 145, 175, 137, 251, 155, 0, 170, 48, 38, 24, 52, 2, 48, 147, 173, 8, 251, 172, 138, 169, 219, 139, 1, 153, 65, 36, 66, 51, 52, 34, 18, 49, 52, 177, 155, 68, 145, 189, 88, 21, 16, 82, 35, 35, 136, 33, 176, 189, 188, 138, 204, 172, 170, 136, 176, 157, 33, 202, 56, 129, 41, 147, 138, 252, 158, 153, 9, 130, 24, 53, 51, 2, 81, 22, 153, 67, 130, 138, 128, 80, 22, 186, 9, 1, 234, 11, 69, 1, 16, 17, 129, 187, 24, 32, 148, 190, 128, 222, 9, 137, 33, 169, 99, 184, 41, 34, 34, 152, 117, 129, 187, 144, 155, 18, 235, 48, 130, 24, 51, 67, 50, 69, 1, 1, 217, 9, 160, 138, 66, 19, 138, 103, 129, 9, 129, 48, 177, 44, 87, 185, 56, 147, 140, 1, 26, 20, 32, 20, 48, 38, 16, 3, 188, 82, 176, 26, 144, 115, 147, 73, 38, 8, 2, 169, 40, 130, 205, 25, 201, 157, 0, 185, 138, 128, 153, 98, 19, 24, 71, 3, 185, 172, 145, 207, 154, 169, 154, 9, 17, 0, 218, 25, 69, 1, 9, 82, 161, 204, 154, 152, 205, 137, 153, 24, 1, 99, 50, 36, 144, 67, 249, 155, 152, 138, 144, 189, 9, 1, 144, 26, 87, 19, 33, 33, 34, 152, 67, 184, 218, 191, 170, 203, 138, 154, 81, 35, 70, 1, 49, 35, 129, 204, 138, 168, 206, 154, 137, 0, 186, 9, 145, 219, 174, 24, 0, 48, 39, 33, 67, 18, 0, 33, 128, 8, 99, 36, 66, 37, 50, 34, 1, 129, 9, 2, 24, 38, 185, 83, 248, 137, 217, 9, 202, 8, 184, 40, 152, 17, 218, 25, 233, 171, 187, 187, 139, 18, 221, 9, 160, 188, 170, 172, 66, 184, 97, 184, 25, 216, 10, 185, 141, 153, 153, 169, 97, 193, 43, 164, 157, 2, 138, 3, 12, 21, 155, 19, 205, 80, 130, 169, 65, 20, 152, 33, 219, 96, 161, 138, 136, 8, 251, 140, 136, 170, 169, 24, 144, 10, 1, 204, 170, 96, 20, 40, 36, 48, 21, 154, 49, 51, 133, 188, 115, 129, 16, 0, 69, 145, 138, 0, 128, 220, 26, 161, 157, 145, 172, 0, 9, 2, 41, 87, 144, 136, 8, 160, 190, 152, 154, 216, 157, 18, 9, 84, 18, 51, 19, 68, 2, 16, 0, 50, 162, 9, 19, 144, 187, 116, 2, 34, 192, 57, 3, 9, 254, 154, 169, 171, 205, 41, 168, 112, 20, 137, 18, 16, 99, 18, 50, 20, 16, 128, 138, 145, 203, 137, 186, 251, 172, 65, 67, 35, 144, 115, 130, 136, 2, 49, 225, 158, 50, 200, 74, 38, 153, 0, 152, 1, 203, 48, 3, 170, 8, 8, 115, 38, 160, 119, 14, 41, 0, 172, 203, 140, 129, 9, 71, 3, 169, 153, 235, 27, 20, 168, 32, 17, 66, 1, 187, 11, 20, 237, 26, 0, 40, 36, 83, 146, 154, 232, 174, 0, 0, 34, 130, 136, 128, 250, 173, 9, 16, 144, 40, 36, 49, 7, 185, 136, 205, 171, 26, 67, 17, 50, 146, 185, 223, 171, 187, 139, 51, 53, 0, 65, 35, 1, 0, 1, 169, 56, 146, 121, 70, 34, 129, 203, 41, 20, 171, 115, 23, 1, 128, 136, 0, 153, 156, 8, 136, 136, 16, 0, 9, 83, 161, 187, 144, 175, 115, 192, 10, 161, 174, 153, 153, 203, 72, 4, 171, 49, 176, 190, 154, 136, 185, 188, 153, 8, 168, 155, 168, 157, 184, 191, 153, 48, 21, 186, 24, 250, 171, 8, 136, 1, 9, 70, 129, 33, 208, 10, 176, 172, 144, 252, 158, 18, 169, 24, 138, 2, 139, 4, 205, 10, 129, 16, 224, 157, 144, 26, 37, 137, 152, 112, 38, 129, 0, 17, 17, 114, 3, 203, 187, 157, 65, 2, 8, 152, 8, 68, 19, 154, 73, 53, 193, 204, 9, 33, 3, 250, 155, 16, 17, 66, 52, 129, 137, 8, 51, 35, 19, 223, 139, 33, 177, 174, 49, 68, 36, 144, 24, 144, 140, 116, 130, 138, 17, 218, 138, 1, 16, 69, 147, 187, 40, 2, 66, 34, 18, 236, 25, 4, 251, 155, 32, 17, 18, 192, 26, 36, 98, 3, 188, 152, 169, 153, 25, 85, 2, 219, 170, 170, 97, 38, 160, 153, 0, 152, 98, 18, 153, 184, 173, 40, 168, 10, 51, 17, 18, 0, 96, 22, 251, 141, 66, 130, 170, 188, 40, 38, 128, 153, 169, 171, 114, 4, 184, 9, 35, 200, 172, 32, 36, 184, 186, 173, 33, 18, 68, 130, 187, 168, 206, 56, 54, 161, 174, 8, 0, 33, 16, 144, 171, 24, 20, 202, 57, 19, 115, 162, 223, 9, 34, 145, 136, 160, 57, 23, 202, 9, 1, 24, 51, 176, 207, 25, 67, 18, 152, 205, 10, 36, 153, 136, 33, 192, 56, 133, 190, 40, 3, 144, 144, 204, 26, 84, 2, 153, 25, 184, 156, 82, 17, 136, 137, 185, 58, 71, 169, 139, 32, 0, 185, 42, 87, 216, 139, 32, 17, 17, 192, 207, 26, 69, 130, 169, 186, 138, 84, 3, 201, 171, 16, 34, 1, 168, 138, 16, 200, 155, 82, 38, 144, 172, 137, 48, 38, 160, 188, 137, 66, 53, 192, 155, 17, 185, 89, 71, 160, 188, 153, 65, 52, 145, 204, 155, 65, 34, 51, 252, 154, 33, 35, 128, 185, 173, 16, 18, 35, 176, 204, 57, 4, 171, 114, 146, 154, 153, 9, 35, 35, 161, 174, 137, 17, 186, 114, 55, 234, 155, 64, 52, 168, 171, 137, 1, 83, 20, 236, 138, 51, 1, 0, 201, 157, 65, 19, 185, 154, 33, 153, 82, 176, 27, 130, 156, 33, 17, 69, 192, 173, 40, 38, 168, 24, 160, 140, 33, 152, 32, 37, 160, 189, 155, 96, 36, 145, 202, 172, 24, 84, 19, 216, 228, 11, 67, 0, 172, 41, 36, 128, 136, 152, 137, 17, 177, 13, 54, 200, 139, 33, 19, 176, 154, 153, 8, 81, 19, 217, 171, 64, 249, 105, 21, 218, 138, 48, 67, 144, 171, 169, 25, 68, 52, 250, 156, 33, 18, 0, 184, 138, 1, 136, 82, 161, 173, 17, 169, 100, 160, 140, 33, 144, 168, 25, 51, 99, 177, 191, 48, 129, 33, 160, 206, 25, 38, 145, 171, 16, 145, 10, 52, 200, 56, 242, 157, 83, 129, 153, 153, 136, 33, 1, 0, 144, 171, 49, 200, 88, 162, 143, 33, 168, 48, 195, 141, 53, 217, 41, 4, 202, 11, 99, 145, 138, 32, 145, 173, 65, 3, 8, 176, 191, 41, 38, 128, 153, 202, 26, 37, 17, 144, 187, 155, 72, 53, 146, 205, 10, 51, 128, 152, 187, 104, 4, 187, 88, 131, 188, 24, 36, 176, 141, 51, 160, 56, 176, 159, 65, 4, 220, 25, 50, 2, 202, 138, 49, 145, 10, 130, 139, 83, 249, 28, 54, 184, 139, 0, 0, 17, 18, 234, 40, 131, 172, 49, 145, 171, 153, 112, 55, 218, 11, 33, 0, 1, 136, 137, 234, 140, 115, 130, 138, 128, 187, 66, 145, 66, 192, 173, 48, 3, 138, 69, 192, 157, 0, 17, 20, 128, 235, 11, 52, 129, 154, 152, 154, 114, 131, 187, 8, 145, 155, 116, 145, 171, 0, 128, 17, 2, 137, 17, 250, 12, 67, 0, 144, 206, 48, 176, 122, 21, 186, 139, 1, 33, 52, 250, 140, 50, 130, 138, 169, 138, 68, 130, 202, 24, 19, 251, 9, 83, 130, 219, 27, 36, 128, 168, 137, 144, 41, 55, 160, 205, 9, 52, 2, 168, 188, 137, 50, 39, 201, 138, 16, 34, 145, 156, 186, 120, 39, 185, 172, 48, 20, 144, 154, 144, 169, 96, 36, 185, 171, 9, 66, 19, 168, 169, 188, 96, 20, 185, 137, 1, 1, 24, 193, 143, 69, 193, 155, 17, 33, 144, 171, 65, 3, 204, 9, 33, 33, 2, 204, 155, 16, 100, 3, 221, 25, 20, 152, 153, 136, 64, 21, 203, 26, 17, 136, 16, 17, 184, 188, 80, 36, 184, 173, 80, 2, 203, 41, 52, 144, 204, 138, 85, 145, 187, 24, 52, 144, 170, 204, 89, 53, 184, 156, 0, 18, 129, 185, 16, 131, 172, 40, 36, 200, 155, 34, 146, 11, 36, 238, 58, 23, 185, 9, 18, 1, 160, 189, 88, 20, 152, 153, 154, 40, 19, 0, 49, 248, 174, 64, 51, 128, 187, 172, 32, 17, 84, 146, 222, 9, 68, 128, 171, 138, 99, 146, 154, 154, 57, 21, 136, 136, 153, 128, 40, 194, 142, 53, 145, 170, 188, 89, 38, 184, 155, 17, 34, 161, 188, 10, 86, 129, 204, 25, 67, 160, 138, 146, 26, 36, 218, 41, 2, 137, 83, 176, 175, 40, 36, 168, 24, 202, 73, 20, 169, 155, 48, 3, 139, 34, 237, 56, 19, 170, 24, 129, 172, 64, 53, 216, 173, 64, 52, 200, 157, 33, 1, 136, 171, 99, 146, 155, 184, 73, 38, 202, 136, 252, 69, 0, 139, 83, 129, 137, 168, 174, 82, 3, 152, 217, 140, 82, 2, 153, 154, 0, 136, 51, 161, 138, 217, 141, 100, 130, 187, 26, 2, 137, 67, 152, 9, 176, 175, 99, 129, 137, 186, 41, 19, 32, 35, 251, 27, 132, 158, 83, 146, 171, 186, 58, 87, 129, 203, 8, 16, 17, 146, 155, 17, 205, 88, 4, 184, 138, 16, 144, 9, 54, 200, 139, 34, 2, 187, 128, 139, 119, 193, 155, 50, 2, 186, 25, 18, 185, 72, 4, 154, 18, 223, 57, 37, 168, 172, 25, 52, 2, 219, 11, 51, 1, 128, 235, 26, 34, 16, 194, 142, 67, 152, 169, 26, 53, 176, 141, 33, 153, 51, 216, 154, 40, 87, 216, 138, 34, 17, 168, 140, 34, 168, 139, 56, 71, 177, 175, 48, 2, 153, 17, 160, 153, 136, 154, 115, 132, 186, 154, 80, 51, 233, 12, 35, 144, 40, 201, 10, 1, 66, 162, 171, 169, 138, 114, 23, 217, 9, 18, 128, 185, 27, 55, 184, 171, 32, 2, 82, 163, 207, 40, 18, 8, 24, 146, 205, 137, 82, 4, 201, 154, 32, 38, 168, 171, 33, 129, 32, 185, 202, 140, 103, 145, 172, 25, 51, 129, 154, 201, 139, 87, 145, 187, 9, 66, 130, 137, 184, 156, 67, 129, 40, 4, 252, 10, 67, 130, 185, 172, 40, 115, 130, 189, 24, 18, 18, 144, 219, 155, 99, 19, 185, 172, 41, 68, 145, 155, 170, 104, 5, 152, 186, 12, 84, 2, 202, 156, 49, 19, 152, 169, 25, 129, 11, 69, 145, 187, 172, 81, 36, 128, 205, 25, 18, 50, 225, 156, 18, 16, 147, 172, 129, 56, 148, 159, 32, 18, 145, 186, 155, 80, 37, 168, 171, 153, 65, 37, 161, 191, 32, 35, 152, 156, 33, 128, 8, 168, 42, 55, 249, 139, 53, 144, 155, 8, 128, 33, 18, 17, 251, 143, 51, 144, 10, 144, 155, 116, 177, 157, 81, 129, 154, 9, 1, 33, 160, 172, 16, 35, 36, 234, 11, 1, 48, 3, 173, 9, 16, 3, 172, 100, 176, 156, 32, 83, 193, 174, 65, 3, 202, 9, 17, 3, 202, 26, 18, 33, 1, 201, 191, 72, 20, 184, 26, 18, 184, 189, 114, 19, 160, 189, 24, 17, 66, 184, 139, 33, 18, 235, 40, 194, 90, 133, 187, 16, 9, 69, 200, 138, 33, 17, 203, 24, 128, 114, 146, 172, 152, 56, 55, 202, 25, 145, 152, 152, 82, 3, 160, 206, 26, 37, 16, 128, 205, 8, 35, 3, 203, 155, 40, 38, 128, 144, 235, 27, 68, 145, 136, 153, 155, 81, 20, 153, 203, 27, 53, 144, 10, 50, 248, 140, 66, 130, 185, 171, 99, 2, 185, 189, 96, 20, 184, 170, 40, 18, 153, 66, 192, 172, 64, 4, 136, 144, 187, 48, 17, 17, 128, 234, 172, 82, 51, 177, 191, 56, 145, 49, 192, 72, 194, 157, 16, 99, 162, 173, 25, 1, 82, 2, 235, 171, 97, 19, 170, 136, 169, 57, 53, 162, 190, 56, 3, 154, 32, 129, 106, 8, 61, 0, 172, 33, 192, 43, 103, 128, 203, 139, 98, 18, 185, 154, 17, 128, 17, 201, 97, 194, 140, 34, 1, 153, 137, 2, 219, 80, 148, 171, 49, 145, 10, 2, 234, 73, 5, 155, 136, 27, 53, 153, 40, 250, 155, 84, 2, 168, 172, 25, 83, 130, 170, 186, 41, 53, 130, 220, 9, 51, 3, 251, 10, 34, 128, 9, 129, 154, 136, 24, 132, 44, 87, 233, 139, 49, 36, 160, 203, 139, 54, 160, 10, 3, 169, 154, 32, 53, 177, 205, 137, 84, 129, 170, 138, 34, 152, 82, 178, 155, 168, 156, 112, 38, 185, 154, 169, 104, 37, 184, 157, 49, 160, 25, 20, 185, 9, 1, 235, 113, 146, 156, 18, 152, 16, 145, 9, 2, 202, 9, 24, 116, 161, 174, 64, 130, 170, 48, 179, 158, 82, 161, 137, 153, 57, 36, 145, 218, 171, 80, 37, 184, 140, 16, 16, 0, 1, 232, 171, 83, 35, 208, 171, 24, 115, 145, 157, 16, 0, 17, 152, 170, 8, 68, 3, 222, 42, 52, 192, 139, 34, 144, 25, 19, 188, 24, 145, 56, 39, 204, 56, 162, 142, 36, 201, 24, 2, 171, 97, 162, 11, 3, 190, 64, 34, 128, 188, 139, 99, 3, 188, 56, 145, 10, 161, 59, 103, 168, 157, 49, 145, 8, 129, 136, 201, 57, 4, 9, 19, 206, 56, 162, 12, 38, 168, 153, 137, 49, 145, 169, 48, 162, 143, 69, 200, 138, 129, 40, 54, 208, 188, 16, 83, 2, 203, 9, 0, 24, 16, 83, 232, 173, 81, 18, 186, 9, 129, 32, 35, 251, 27, 20, 152, 24, 168, 154, 66, 20, 219, 25, 131, 138, 19, 186, 8, 96, 20, 188, 24, 144, 66, 232, 11, 70, 161, 188, 57, 51, 128, 185, 11, 184, 113, 134, 155, 16, 129, 156, 83, 176, 139, 1, 24, 85, 145, 190, 25, 35, 35, 241, 157, 33, 1, 17, 176, 219, 9, 53, 145, 153, 152, 186, 88, 38, 168, 235, 41, 52, 168, 138, 129, 154, 83, 176, 57, 147, 190, 40, 21, 153, 33, 234, 24, 1, 32, 128, 201, 158, 82, 130, 136, 200, 139, 17, 65, 5, 139, 192, 142, 67, 129, 153, 168, 186, 113, 134, 170, 33, 176, 139, 34, 18, 129, 169, 172, 0, 8, 116, 133, 219, 138, 34, 49, 20, 220, 138, 8, 67, 20, 200, 173, 32, 18, 34, 192, 189, 48, 20, 137, 128, 172, 48, 19, 201, 26, 21, 185, 171, 97, 20, 218, 26, 19, 128, 168, 25, 216, 59, 71, 160, 186, 139, 83, 20, 185, 12, 130, 155, 84, 161, 139, 17, 153, 24, 34, 232, 42, 6, 169, 170, 80, 36, 160, 220, 9, 17, 66, 19, 217, 173, 41, 52, 1, 185, 188, 56, 20, 152, 17, 232, 42, 4, 153, 168, 42, 38, 144, 187, 58, 23, 186, 40, 17, 18, 252, 26, 36, 128, 152, 203, 64, 146, 138, 69, 224, 139, 34, 1, 1, 218, 11, 51, 1, 34, 250, 141, 33, 1, 17, 185, 173, 56, 38, 144, 180, 17, 68, 0, 169, 137, 169, 114, 149, 171, 32, 136, 64, 146, 190, 72, 20, 186, 40, 144, 27, 51, 176, 171, 144, 120, 22, 203, 25, 1, 0, 17, 185, 157, 66, 36, 232, 156, 66, 161, 25, 35, 249, 139, 33, 51, 130, 190, 26, 145, 48, 21, 152, 154, 154, 154, 85, 130, 128, 250, 11, 83, 18, 218, 11, 33, 34, 161, 174, 137, 67, 19, 200, 203, 56, 35, 8, 216, 139, 35, 33, 179, 143, 146, 12, 53, 201, 9, 32, 20, 233, 155, 66, 3, 184, 187, 112, 5, 218, 10, 52, 161, 156, 0, 33, 162, 188, 32, 35, 130, 251, 10, 35, 17, 160, 171, 160, 27, 103, 152, 137, 186, 81, 35, 192, 174, 97, 146, 155, 17, 185, 56, 38, 168, 171, 170, 112, 21, 169, 138, 136, 65, 130, 153, 169, 155, 34, 66, 19, 220, 42, 20, 219, 64, 146, 156, 17, 18, 161, 172, 169, 90, 23, 136, 136, 202, 41, 83, 162, 188, 81, 145, 172, 32, 67, 161, 190, 41, 69, 144, 171, 8, 17, 33, 176, 157, 0, 50, 3, 185, 239, 72, 20, 170, 8, 169, 56, 21, 136, 168, 155, 136, 114, 130, 170, 136, 41, 20, 172, 17, 144, 16, 83, 130, 239, 26, 34, 0, 17, 152, 170, 171, 80, 68, 131, 205, 153, 10, 71, 144, 171, 137, 51, 3, 137, 169, 152, 219, 114, 132, 170, 0, 186, 97, 162, 140, 51, 176, 140, 82, 161, 156, 17, 49, 225, 13, 34, 170, 65, 146, 202, 26, 38, 168, 8, 136, 128, 188, 41, 71, 161, 156, 18, 201, 58, 38, 153, 8, 186, 43, 53, 146, 203, 9, 160, 96, 5, 171, 17, 152, 172, 97, 21, 202, 137, 9, 52, 160, 171, 81, 162, 156, 33, 18, 169, 8, 202, 89, 37, 249, 138, 50, 1, 160, 155, 51, 234, 88, 146, 138, 2, 188, 40, 35, 160, 9, 184, 120, 6, 188, 32, 144, 56, 3, 139, 169, 169, 223, 113, 19, 153, 219, 11, 69, 129, 154, 144, 154, 49, 35, 145, 175, 25, 17, 20, 185, 57, 179, 191, 82, 130, 153, 128, 235, 58, 38, 128, 152, 202, 156, 116, 129, 138, 136, 136, 153, 32, 54, 162, 205, 138, 66, 35, 192, 172, 24, 35, 144, 9, 2, 169, 186, 9, 115, 36, 217, 140, 33, 0, 16, 153, 40, 248, 139, 53, 16, 130, 207, 40, 16, 33, 200, 154, 48, 20, 203, 80, 177, 140, 67, 176, 26, 35, 220, 24, 1, 17, 146, 203, 138, 66, 18, 129, 251, 25, 21, 201, 10, 36, 160, 170, 42, 71, 200, 154, 48, 67, 184, 156, 1, 153, 81, 4, 202, 9, 16, 128, 137, 68, 176, 11, 2, 152, 155, 51, 139, 103, 192, 187, 89, 38, 200, 155, 32, 36, 136, 168, 172, 64, 3, 152, 137, 128, 190, 112, 3, 168, 203, 40, 4, 0, 176, 156, 83, 18, 220, 10, 67, 2, 186, 187, 72, 21, 152, 8, 168, 171, 115, 131, 203, 8, 33, 145, 139, 51, 128, 163, 6, 54, 0, 217, 205, 80, 21, 187, 57, 18, 152, 171, 8, 115, 20, 251, 155, 83, 2, 185, 171, 64, 34, 1, 184, 190, 42, 69, 17, 169, 203, 10, 65, 36, 184, 172, 33, 2, 168, 43, 55, 235, 24, 144, 24, 35, 160, 187, 154, 100, 129, 153, 138, 130, 27, 87, 169, 154, 137, 50, 33, 2, 168, 237, 157, 99, 2, 136, 184, 188, 72, 36, 130, 219, 171, 66, 35, 144, 201, 154, 17, 34, 1, 1, 223, 42, 37, 144, 138, 152, 10, 52, 193, 173, 82, 3, 187, 157, 64, 38, 176, 173, 24, 34, 17, 153, 203, 56, 23, 201, 10, 51, 144, 186, 27, 69, 130, 202, 171, 80, 35, 152, 203, 10, 52, 128, 152, 154, 69, 232, 11, 51, 3, 251, 154, 83, 3, 202, 139, 50, 152, 64, 176, 140, 49, 146, 139, 146, 14, 53, 192, 155, 17, 17, 35, 185, 169, 140, 129, 173, 114, 35, 200, 158, 64, 130, 152, 136, 170, 64, 22, 184, 173, 48, 19, 8, 168, 137, 128, 156, 115, 3, 186, 128, 238, 56, 5, 153, 129, 154, 48, 1, 32, 1, 250, 157, 66, 129, 16, 216, 12, 18, 153, 98, 162, 172, 56, 18, 186, 49, 160, 136, 206, 49, 131, 16, 176, 156, 136, 115, 5, 187, 40, 176, 12, 18, 24, 4, 171, 70, 248, 139, 83, 130, 187, 16, 128, 0, 144, 137, 24, 176, 58, 119, 185, 26, 50, 161, 188, 81, 145, 9, 184, 74, 132, 157, 98, 130, 189, 25, 52, 161, 139, 144, 42, 39, 202, 140, 51, 130, 168, 173, 96, 129, 26, 145, 140, 68, 176, 156, 33, 130, 154, 137, 50, 21, 219, 48, 209, 155, 66, 36, 186, 25, 250, 27, 39, 1, 186, 157, 65, 130, 152, 1, 201, 11, 36, 18, 161, 190, 10, 69, 177, 10, 3, 203, 24, 36, 144, 153, 185, 140, 53, 1, 50, 249, 190, 88, 20, 168, 138, 0, 128, 9, 19, 8, 147, 223, 32, 34, 177, 158, 34, 145, 138, 0, 152, 82, 162, 187, 8, 99, 193, 12, 18, 16, 144, 186, 11, 87, 192, 139, 35, 1, 176, 157, 33, 50, 224, 13, 51, 218, 24, 36, 176, 158, 33, 128, 17, 169, 40, 185, 16, 48, 164, 13, 146, 44, 39, 187, 16, 186, 16, 81, 22, 169, 152, 190, 57, 55, 146, 172, 154, 33, 2, 16, 0, 184, 171, 205, 114, 4, 136, 186, 141, 65, 3, 168, 153, 153, 64, 2, 129, 203, 41, 201, 113, 5, 188, 10, 68, 177, 43, 161, 11, 37, 160, 155, 83, 144, 202, 41, 20, 9, 208, 12, 53, 160, 187, 16, 16, 84, 192, 156, 16, 67, 176, 139, 128, 49, 130, 160, 207, 48, 3, 169, 96, 147, 175, 32, 144, 65, 192, 156, 66, 3, 185, 170, 9, 66, 36, 185, 142, 1, 138, 115, 146, 170, 204, 73, 38, 160, 171, 8, 32, 52, 161, 189, 138, 81, 1, 0, 184, 139, 16, 68, 177, 156, 16, 144, 137, 84, 145, 153, 218, 231, 245, 61, 0, 41, 144, 114, 150, 155, 128, 9, 51, 1, 234, 11, 17, 81, 194, 156, 52, 176, 170, 24, 50, 129, 153, 0, 216, 174, 114, 3, 169, 202, 139, 98, 37, 184, 172, 9, 67, 19, 200, 188, 32, 19, 18, 184, 174, 41, 37, 136, 168, 157, 49, 19, 192, 139, 20, 220, 40, 36, 130, 220, 10, 67, 18, 200, 171, 152, 80, 22, 168, 187, 10, 69, 2, 185, 141, 17, 8, 35, 217, 26, 2, 137, 18, 185, 201, 74, 55, 144, 218, 138, 35, 18, 168, 170, 204, 105, 38, 160, 188, 24, 34, 17, 160, 188, 48, 3, 219, 72, 146, 9, 3, 155, 200, 140, 71, 145, 185, 138, 19, 152, 34, 185, 81, 249, 27, 37, 128, 152, 172, 32, 2, 8, 35, 251, 29, 21, 152, 136, 172, 65, 19, 152, 137, 204, 42, 23, 152, 16, 168, 139, 64, 67, 168, 172, 137, 138, 103, 162, 172, 8, 8, 68, 146, 172, 9, 51, 168, 41, 177, 158, 50, 129, 136, 144, 138, 146, 175, 115, 3, 154, 153, 202, 41, 70, 145, 189, 27, 69, 145, 140, 16, 144, 8, 17, 129, 217, 139, 52, 2, 128, 236, 41, 2, 136, 153, 33, 1, 68, 250, 11, 51, 1, 201, 156, 32, 50, 132, 189, 32, 130, 129, 24, 184, 142, 16, 98, 131, 205, 137, 48, 21, 186, 24, 136, 98, 192, 12, 52, 160, 204, 9, 67, 18, 186, 173, 96, 4, 201, 139, 67, 130, 186, 136, 0, 24, 35, 161, 156, 136, 138, 114, 130, 137, 128, 139, 130, 191, 114, 130, 153, 204, 64, 19, 168, 154, 83, 192, 140, 49, 145, 170, 24, 82, 130, 205, 25, 52, 145, 170, 153, 48, 5, 169, 187, 28, 51, 100, 163, 191, 42, 67, 146, 137, 200, 141, 66, 3, 184, 172, 40, 35, 34, 235, 10, 2, 1, 128, 168, 157, 69, 177, 171, 40, 67, 145, 221, 42, 39, 201, 26, 19, 144, 154, 40, 18, 17, 248, 142, 50, 136, 50, 249, 140, 65, 3, 203, 136, 17, 18, 145, 189, 56, 2, 8, 137, 83, 144, 204, 11, 52, 34, 164, 223, 9, 50, 20, 184, 170, 9, 67, 160, 187, 48, 38, 216, 155, 67, 18, 202, 11, 51, 1, 216, 188, 72, 55, 177, 159, 16, 0, 33, 176, 157, 49, 1, 33, 192, 188, 57, 36, 184, 138, 18, 144, 80, 4, 251, 155, 98, 19, 184, 204, 25, 67, 2, 185, 187, 41, 37, 144, 8, 145, 139, 82, 3, 220, 26, 130, 10, 36, 235, 72, 129, 25, 20, 234, 138, 66, 130, 168, 170, 25, 36, 192, 173, 50, 2, 16, 49, 200, 174, 32, 38, 184, 186, 189, 104, 52, 161, 189, 24, 52, 129, 186, 170, 138, 99, 20, 168, 219, 9, 66, 129, 136, 169, 137, 32, 50, 35, 176, 207, 41, 2, 170, 40, 3, 8, 176, 173, 33, 8, 101, 2, 251, 154, 65, 3, 153, 128, 170, 49, 128, 35, 254, 138, 68, 18, 202, 137, 1, 170, 56, 53, 147, 6, 54, 0, 129, 218, 156, 64, 130, 171, 115, 162, 189, 73, 20, 152, 16, 168, 187, 57, 37, 129, 234, 171, 49, 39, 144, 153, 170, 16, 66, 19, 219, 154, 16, 34, 34, 146, 223, 155, 40, 85, 2, 169, 154, 24, 2, 136, 8, 217, 187, 16, 136, 118, 131, 188, 9, 34, 34, 2, 251, 11, 49, 160, 25, 2, 202, 221, 11, 70, 2, 153, 154, 33, 1, 24, 233, 10, 177, 11, 51, 66, 20, 217, 138, 145, 80, 6, 203, 42, 20, 128, 153, 202, 10, 52, 193, 25, 22, 169, 169, 10, 103, 130, 170, 186, 10, 0, 48, 3, 49, 193, 11, 192, 96, 37, 2, 219, 138, 0, 144, 171, 0, 8, 85, 2, 201, 138, 116, 18, 168, 203, 171, 17, 32, 34, 216, 172, 41, 38, 136, 16, 153, 16, 202, 41, 39, 152, 170, 171, 136, 170, 1, 154, 115, 38, 152, 80, 3, 204, 9, 145, 11, 18, 235, 41, 36, 16, 129, 202, 139, 68, 2, 169, 8, 129, 219, 57, 21, 234, 187, 170, 138, 0, 0, 97, 19, 8, 2, 56, 6, 154, 18, 219, 26, 35, 137, 116, 19, 32, 38, 0, 65, 67, 52, 20, 8, 137, 32, 144, 8, 129, 153, 187, 118, 23, 128, 17, 2, 128, 168, 219, 9, 201, 188, 137, 144, 169, 219, 171, 17, 169, 9, 217, 220, 187, 204, 171, 202, 204, 187, 138, 16, 16, 144, 0, 177, 173, 33, 224, 190, 137, 201, 155, 82, 2, 136, 34, 128, 48, 55, 37, 129, 137, 136, 136, 137, 66, 19, 16, 17, 82, 54, 145, 27, 69, 18, 83, 193, 157, 0, 32, 2, 169, 32, 3, 252, 171, 97, 20, 185, 10, 19, 169, 9, 17, 128, 41, 5, 170, 49, 176, 120, 35, 40, 87, 129, 153, 9, 66, 35, 136, 114, 145, 156, 17, 0, 67, 130, 186, 203, 155, 32, 18, 33, 201, 187, 175, 24, 160, 0, 250, 187, 170, 10, 86, 176, 105, 22, 168, 138, 137, 169, 202, 205, 137, 129, 219, 138, 17, 17, 84, 52, 1, 184, 223, 137, 0, 169, 24, 2, 80, 36, 18, 0, 17, 153, 40, 192, 139, 16, 50, 251, 142, 34, 161, 255, 159, 136, 24, 33, 84, 51, 17, 0, 16, 144, 138, 129, 186, 137, 32, 100, 69, 51, 36, 18, 0, 33, 51, 50, 52, 217, 187, 220, 156, 153, 40, 50, 51, 1, 17, 152, 218, 205, 204, 204, 203, 171, 153, 153, 0, 8, 1, 204, 170, 170, 152, 202, 186, 221, 189, 170, 170, 10, 17, 32, 35, 33, 68, 53, 35, 16, 200, 173, 170, 172, 56, 53, 52, 67, 67, 50, 50, 17, 35, 17, 200, 156, 218, 172, 128, 9, 129, 137, 136, 187, 169, 24, 208, 207, 251, 203, 187, 171, 154, 137, 8, 32, 160, 156, 0, 168, 205, 154, 185, 188, 8, 17, 115, 53, 35, 34, 49, 86, 52, 49, 52, 18, 51, 35, 51, 50, 71, 36, 1, 33, 20, 0, 53, 2, 32, 19, 16, 177, 223, 138, 20, 50, 0, 24, 160, 187, 137, 184, 222, 138, 145, 172, 32, 184, 171, 201, 171, 220, 188, 137, 184, 171, 136, 154, 33, 82, 70, 1, 24, 50, 216, 10, 35, 51, 19, 84, 20, 32, 67, 68, 36, 1, 49, 2, 154, 17, 65, 3, 58, 103, 129, 154, 66, 130, 137, 129, 24, 161, 255, 155, 202, 171, 24, 49, 36, 66, 19, 235, 170, 188, 203, 203, 153, 185, 139, 18, 32, 55, 168, 154, 253, 220, 154, 0, 99, 68, 35, 19, 1, 136, 153, 137, 49, 34, 49, 35, 69, 69, 52, 51, 18, 144, 137, 0, 0, 84, 130, 152, 222, 172, 154, 153, 8, 51, 18, 129, 234, 189, 188, 203, 203, 188, 170, 186, 154, 0, 33, 19, 217, 204, 203, 170, 171, 8, 136, 170, 186, 171, 64, 69, 52, 68, 18, 17, 51, 34, 16, 34, 129, 188, 41, 69, 70, 68, 50, 36, 0, 128, 169, 170, 170, 169, 187, 189, 170, 218, 11, 145, 220, 202, 204, 171, 202, 172, 169, 202, 172, 187, 187, 170, 138, 33, 1, 136, 144, 188, 204, 187, 16, 66, 70, 67, 83, 67, 36, 34, 35, 35, 17, 81, 83, 67, 67, 50, 50, 2, 17, 68, 17, 68, 3, 136, 137, 0, 176, 156, 0, 185, 203, 191, 139, 185, 156, 170, 186, 223, 202, 170, 136, 153, 33, 50, 145, 221, 154, 170, 139, 48, 68, 19, 34, 17, 84, 18, 49, 55, 35, 0, 32, 54, 18, 66, 52, 1, 24, 49, 35, 33, 69, 35, 161, 189, 152, 202, 221, 10, 51, 153, 0, 251, 137, 201, 154, 186, 205, 170, 168, 174, 48, 168, 115, 135, 137, 18, 186, 187, 155, 16, 24, 52, 67, 192, 140, 83, 176, 219, 156, 17, 170, 114, 119, 34, 17, 0, 168, 186, 155, 8, 33, 68, 67, 18, 24, 67, 2, 17, 130, 203, 203, 187, 137, 153, 1, 217, 203, 206, 138, 8, 34, 16, 144, 205, 206, 203, 186, 170, 169, 138, 8, 16, 17, 49, 4, 186, 220, 205, 203, 138, 152, 16, 50, 83, 35, 34, 50, 66, 18, 34, 19, 2, 170, 41, 145, 25, 103, 51, 66, 68, 52, 36, 18, 1, 186, 207, 203, 170, 153, 137, 24, 33, 128, 0, 168, 205, 204, 204, 187, 203, 187, 153, 168, 154, 136, 153, 170, 154, 40, 52, 33, 35, 218, 153, 202, 11, 115, 70, 69, 35, 83, 35, 50, 18, 153, 154, 49, 52, 69, 69, 50, 17, 33, 1, 16, 1, 0, 200, 137, 186, 32, 17, 84, 129, 203, 188, 251, 171, 153, 170, 128, 221, 170, 202, 188, 137, 32, 50, 22, 152, 32, 201, 172, 24, 1, 137, 18, 50, 71, 35, 70, 36, 0, 136, 136, 153, 137, 115, 36, 34, 17, 128, 168, 0, 128, 115, 145, 8, 176, 188, 154, 48, 232, 138, 250, 174, 153, 8, 8, 81, 4, 201, 204, 153, 186, 43, 52, 18, 18, 169, 220, 172, 32, 2, 66, 128, 48, 248, 28, 35, 0, 185, 156, 249, 174, 64, 84, 237, 3, 65, 0, 51, 68, 35, 129, 187, 186, 188, 138, 49, 54, 51, 51, 35, 67, 2, 1, 168, 205, 203, 187, 138, 24, 51, 128, 169, 220, 171, 204, 138, 144, 187, 204, 206, 203, 203, 170, 170, 8, 0, 50, 2, 32, 161, 190, 190, 189, 187, 171, 10, 66, 99, 83, 18, 18, 129, 154, 154, 153, 154, 48, 35, 66, 99, 53, 36, 51, 34, 18, 129, 153, 25, 200, 191, 186, 189, 171, 25, 99, 51, 35, 129, 202, 221, 204, 171, 187, 172, 153, 8, 8, 49, 34, 153, 203, 204, 188, 172, 171, 137, 0, 33, 52, 67, 35, 83, 68, 35, 67, 53, 128, 16, 145, 137, 0, 115, 69, 52, 34, 53, 17, 17, 144, 152, 153, 153, 9, 52, 9, 87, 129, 33, 145, 0, 152, 221, 154, 168, 188, 0, 188, 152, 203, 137, 24, 17, 48, 4, 203, 235, 188, 185, 157, 128, 154, 34, 128, 82, 68, 37, 33, 35, 144, 234, 171, 8, 0, 85, 52, 50, 17, 8, 136, 153, 48, 69, 2, 202, 138, 8, 202, 41, 71, 2, 187, 25, 208, 156, 17, 128, 200, 189, 171, 185, 156, 100, 18, 17, 145, 236, 155, 168, 171, 33, 50, 1, 168, 73, 37, 185, 155, 250, 223, 154, 16, 84, 69, 67, 18, 145, 185, 219, 170, 9, 50, 53, 67, 35, 17, 17, 34, 2, 200, 188, 188, 203, 9, 34, 69, 35, 17, 160, 204, 187, 187, 203, 154, 168, 187, 205, 188, 186, 187, 138, 0, 0, 129, 218, 206, 188, 189, 203, 186, 153, 16, 50, 99, 51, 18, 144, 219, 219, 203, 170, 136, 48, 83, 68, 51, 35, 34, 0, 185, 187, 154, 137, 64, 69, 35, 34, 35, 67, 35, 67, 4, 153, 168, 222, 188, 169, 203, 154, 0, 16, 50, 68, 129, 202, 205, 203, 189, 171, 170, 153, 32, 36, 50, 19, 160, 235, 173, 170, 153, 8, 50, 36, 65, 52, 17, 50, 83, 35, 67, 53, 35, 51, 34, 16, 66, 50, 87, 34, 50, 37, 33, 50, 67, 19, 152, 136, 185, 220, 56, 52, 48, 37, 129, 160, 204, 154, 152, 169, 48, 176, 190, 218, 205, 170, 136, 152, 154, 136, 169, 154, 56, 39, 168, 186, 207, 171, 153, 48, 71, 35, 33, 2, 152, 136, 137, 34, 204, 8, 16, 51, 115, 54, 2, 144, 154, 186, 187, 80, 37, 129, 66, 3, 203, 25, 216, 139, 53, 1, 1, 65, 5, 205, 9, 128, 169, 9, 84, 130, 169, 32, 208, 172, 202, 190, 204, 154, 48, 119, 67, 51, 35, 160, 205, 172, 169, 25, 82, 67, 35, 33, 17, 152, 137, 0, 185, 221, 155, 0, 17, 85, 51, 34, 144, 217, 188, 187, 154, 8, 25, 33, 144, 203, 173, 186, 173, 152, 185, 185, 172, 186, 190, 202, 186, 219, 172, 170, 10, 32, 83, 19, 160, 235, 205, 187, 170, 9, 50, 36, 51, 34, 50, 128, 169, 220, 204, 187, 9, 66, 69, 37, 18, 129, 152, 170, 136, 1, 18, 144, 32, 163, 230, 39, 0, 129, 64, 55, 67, 130, 136, 145, 171, 136, 65, 209, 190, 9, 186, 154, 114, 51, 34, 49, 161, 253, 187, 187, 188, 138, 50, 67, 67, 35, 130, 187, 188, 220, 187, 8, 17, 66, 68, 51, 19, 17, 152, 170, 8, 201, 140, 86, 50, 99, 67, 34, 17, 128, 169, 154, 24, 69, 52, 52, 50, 18, 2, 0, 17, 36, 129, 24, 200, 155, 32, 50, 54, 162, 175, 186, 191, 25, 1, 33, 1, 251, 219, 203, 171, 138, 32, 34, 136, 49, 177, 206, 138, 249, 171, 17, 169, 33, 145, 136, 160, 139, 114, 19, 115, 3, 187, 24, 176, 206, 25, 3, 153, 116, 36, 34, 34, 145, 205, 155, 128, 16, 83, 83, 3, 154, 50, 184, 112, 36, 128, 136, 8, 8, 152, 26, 6, 188, 184, 191, 153, 40, 119, 52, 52, 35, 17, 202, 235, 171, 137, 16, 68, 66, 51, 50, 36, 1, 0, 218, 188, 203, 170, 16, 68, 52, 36, 18, 144, 186, 205, 203, 154, 154, 8, 17, 66, 34, 17, 185, 206, 219, 187, 203, 154, 136, 8, 17, 18, 144, 186, 237, 187, 188, 171, 153, 154, 16, 153, 154, 153, 188, 9, 186, 155, 202, 26, 147, 222, 154, 202, 188, 24, 68, 52, 53, 17, 144, 169, 154, 170, 32, 1, 24, 85, 36, 99, 52, 33, 19, 185, 186, 207, 154, 0, 16, 84, 36, 50, 51, 144, 8, 217, 171, 203, 171, 137, 81, 68, 68, 34, 18, 145, 186, 188, 188, 171, 9, 66, 68, 67, 52, 129, 0, 184, 173, 170, 154, 137, 24, 82, 53, 36, 67, 2, 8, 176, 188, 187, 171, 128, 114, 53, 51, 37, 18, 129, 138, 201, 154, 169, 57, 22, 50, 69, 36, 129, 33, 184, 172, 153, 9, 0, 84, 51, 51, 2, 49, 208, 156, 218, 171, 136, 32, 52, 37, 176, 154, 251, 154, 168, 11, 53, 130, 155, 168, 223, 137, 1, 1, 33, 53, 168, 202, 171, 137, 8, 65, 21, 186, 219, 156, 152, 57, 55, 34, 129, 32, 192, 174, 153, 64, 3, 98, 4, 152, 0, 17, 145, 64, 22, 17, 144, 8, 17, 115, 39, 33, 144, 9, 200, 155, 50, 83, 51, 51, 160, 236, 187, 128, 48, 119, 67, 35, 19, 153, 187, 205, 171, 8, 34, 99, 51, 51, 34, 51, 160, 186, 207, 187, 171, 154, 49, 53, 54, 35, 18, 200, 220, 203, 171, 187, 9, 17, 34, 51, 2, 218, 206, 219, 187, 188, 154, 137, 0, 33, 18, 153, 219, 222, 187, 187, 172, 138, 16, 17, 34, 129, 185, 221, 187, 204, 170, 169, 9, 17, 49, 67, 2, 169, 203, 205, 155, 154, 9, 33, 51, 55, 50, 33, 18, 176, 220, 170, 137, 32, 49, 103, 20, 18, 18, 144, 203, 154, 153, 65, 68, 68, 35, 18, 51, 129, 8, 186, 138, 204, 80, 37, 66, 53, 34, 33, 34, 145, 137, 144, 24, 1, 114, 71, 34, 50, 52, 129, 16, 144, 136, 169, 40, 53, 52, 84, 52, 107, 4, 38, 0, 1, 50, 129, 170, 153, 185, 157, 65, 66, 38, 35, 52, 144, 9, 152, 187, 41, 161, 74, 22, 32, 54, 18, 52, 161, 171, 169, 174, 25, 34, 66, 55, 1, 34, 129, 170, 168, 205, 10, 168, 56, 55, 0, 49, 131, 235, 171, 220, 139, 144, 56, 36, 184, 187, 250, 191, 153, 24, 33, 24, 51, 233, 188, 154, 187, 9, 19, 152, 202, 187, 32, 200, 154, 10, 36, 250, 171, 156, 16, 49, 22, 185, 153, 188, 188, 26, 69, 18, 83, 18, 152, 204, 138, 1, 152, 32, 18, 65, 20, 81, 54, 17, 128, 138, 250, 188, 171, 9, 50, 85, 35, 51, 19, 203, 202, 204, 203, 171, 9, 128, 48, 85, 51, 67, 35, 129, 186, 187, 205, 171, 32, 68, 67, 68, 67, 34, 18, 0, 160, 172, 137, 169, 64, 70, 51, 67, 50, 131, 169, 188, 189, 203, 137, 8, 33, 67, 34, 153, 184, 255, 170, 219, 171, 169, 153, 128, 128, 136, 169, 206, 187, 189, 188, 172, 170, 154, 169, 9, 1, 169, 220, 187, 220, 172, 187, 186, 170, 138, 17, 152, 170, 235, 189, 219, 187, 187, 203, 137, 136, 16, 51, 146, 188, 221, 172, 203, 171, 9, 0, 65, 53, 19, 34, 168, 188, 189, 154, 24, 99, 68, 50, 67, 36, 18, 18, 128, 0, 16, 49, 87, 51, 69, 35, 51, 35, 35, 18, 49, 50, 53, 69, 53, 67, 51, 51, 35, 18, 34, 18, 2, 115, 36, 34, 53, 20, 33, 33, 129, 8, 128, 170, 33, 17, 114, 69, 1, 16, 161, 188, 152, 202, 137, 24, 128, 186, 186, 173, 186, 58, 54, 35, 36, 216, 173, 201, 187, 154, 16, 84, 51, 52, 53, 34, 33, 16, 250, 170, 187, 139, 51, 85, 53, 37, 34, 128, 154, 201, 172, 137, 153, 48, 85, 67, 51, 19, 152, 202, 204, 170, 171, 153, 33, 19, 49, 37, 153, 129, 223, 155, 188, 156, 153, 152, 8, 0, 153, 169, 237, 203, 171, 170, 154, 16, 36, 35, 129, 251, 188, 203, 188, 137, 128, 8, 52, 36, 130, 136, 186, 207, 188, 170, 172, 9, 33, 51, 84, 18, 152, 186, 206, 203, 203, 153, 128, 56, 52, 50, 19, 144, 205, 172, 202, 154, 136, 32, 68, 66, 67, 35, 33, 51, 51, 53, 51, 84, 51, 84, 52, 50, 52, 67, 18, 83, 35, 65, 51, 50, 51, 35, 52, 52, 35, 68, 20, 33, 34, 152, 152, 203, 170, 138, 202, 155, 218, 155, 236, 172, 202, 219, 188, 186, 188, 155, 170, 187, 188, 219, 188, 172, 188, 187, 188, 188, 170, 203, 171, 187, 204, 187, 188, 203, 204, 186, 171, 186, 172, 186, 188, 188, 187, 203, 203, 188, 153, 187, 156, 171, 172, 155, 185, 204, 171, 170, 170, 171, 186, 26, 130, 10, 250, 139, 168, 73, 53, 50, 84, 52, 52, 51, 51, 50, 51, 51, 70, 36, 84, 51, 51, 52, 50, 67, 50, 53, 68, 51, 52, 51, 53, 34, 66, 36, 34, 204, 248, 27, 0, 67, 51, 53, 50, 67, 52, 35, 50, 36, 50, 51, 83, 52, 52, 52, 50, 35, 34, 34, 1, 66, 2, 98, 36, 49, 83, 35, 34, 67, 3, 169, 136, 0, 144, 42, 3, 40, 55, 1, 136, 168, 49, 210, 191, 219, 172, 152, 9, 2, 153, 153, 236, 139, 129, 188, 26, 160, 204, 137, 251, 170, 0, 0, 138, 50, 192, 140, 66, 200, 42, 39, 17, 66, 145, 155, 145, 189, 65, 146, 138, 67, 34, 35, 129, 50, 192, 25, 38, 248, 158, 17, 129, 40, 54, 18, 0, 138, 200, 190, 187, 171, 186, 11, 20, 33, 53, 145, 207, 188, 203, 172, 186, 153, 153, 170, 204, 187, 187, 170, 236, 188, 187, 172, 153, 153, 138, 16, 251, 154, 202, 171, 171, 32, 18, 128, 65, 38, 128, 0, 0, 192, 175, 8, 0, 200, 11, 52, 8, 36, 251, 173, 153, 202, 171, 9, 67, 83, 84, 51, 50, 67, 129, 16, 52, 1, 113, 53, 34, 68, 52, 34, 67, 34, 33, 34, 50, 69, 51, 52, 52, 36, 35, 50, 1, 136, 169, 136, 32, 3, 40, 149, 189, 202, 190, 205, 188, 186, 172, 171, 202, 186, 186, 220, 171, 204, 187, 172, 188, 187, 169, 203, 170, 186, 205, 203, 202, 203, 171, 172, 187, 170, 187, 186, 188, 205, 203, 186, 187, 187, 219, 171, 154, 171, 186, 204, 202, 187, 189, 187, 187, 153, 154, 24, 152, 154, 186, 222, 187, 187, 12, 34, 66, 71, 35, 67, 50, 50, 51, 66, 36, 82, 52, 51, 52, 52, 67, 67, 51, 51, 53, 51, 52, 52, 51, 68, 52, 51, 52, 67, 50, 67, 50, 68, 34, 66, 35, 66, 35, 51, 51, 53, 35, 51, 67, 35, 35, 36, 51, 53, 51, 36, 66, 51, 17, 83, 35, 52, 128, 81, 18, 0, 16, 37, 129, 9, 66, 145, 11, 53, 19, 168, 64, 3, 64, 38, 153, 137, 171, 152, 207, 10, 145, 172, 32, 185, 12, 17, 236, 172, 138, 220, 170, 138, 128, 172, 48, 176, 171, 136, 235, 10, 217, 140, 201, 173, 8, 8, 153, 186, 187, 139, 161, 255, 10, 168, 128, 219, 155, 186, 171, 8, 35, 185, 170, 222, 203, 220, 138, 0, 129, 128, 203, 139, 217, 189, 137, 152, 205, 137, 152, 153, 154, 200, 190, 202, 172, 170, 155, 9, 128, 207, 9, 144, 220, 171, 136, 204, 171, 9, 145, 204, 154, 153, 155, 218, 172, 186, 186, 171, 16, 222, 41, 160, 172, 203, 188, 154, 8, 218, 171, 136, 185, 202, 188, 154, 136, 68, 18, 82, 51, 67, 70, 36, 33, 68, 50, 53, 51, 67, 52, 52, 67, 66, 51, 51, 52, 68, 35, 67, 50, 52, 19, 51, 52, 51, 51, 34, 50, 115, 2, 24, 36, 8, 168, 138, 192, 173, 202, 172, 185, 171, 220, 172, 203, 186, 218, 173, 170, 186, 203, 187, 203, 188, 188, 188, 189, 186, 219, 187, 186, 188, 188, 186, 188, 188, 202, 187, 172, 203, 187, 186, 173, 157, 237, 34, 0, 169, 186, 186, 174, 170, 188, 154, 186, 170, 187, 9, 152, 137, 250, 154, 168, 10, 4, 10, 115, 52, 17, 65, 51, 36, 17, 68, 19, 52, 20, 99, 35, 49, 68, 34, 36, 49, 52, 18, 99, 51, 67, 50, 52, 50, 67, 67, 35, 34, 53, 35, 51, 52, 83, 34, 66, 35, 16, 65, 67, 1, 0, 51, 36, 0, 65, 3, 24, 68, 52, 34, 66, 67, 34, 1, 81, 19, 8, 34, 16, 36, 81, 53, 130, 33, 52, 36, 67, 35, 52, 37, 34, 0, 115, 7, 24, 19, 16, 19, 16, 1, 49, 68, 68, 1, 49, 37, 50, 129, 114, 20, 24, 129, 56, 21, 25, 21, 0, 67, 152, 17, 169, 98, 176, 9, 251, 25, 145, 16, 130, 172, 17, 253, 9, 1, 154, 201, 11, 145, 141, 129, 190, 16, 169, 136, 204, 154, 203, 10, 217, 172, 136, 170, 137, 203, 170, 186, 42, 163, 175, 200, 157, 168, 172, 153, 188, 16, 220, 169, 204, 155, 170, 169, 204, 153, 169, 187, 205, 186, 187, 153, 187, 153, 220, 137, 169, 201, 187, 8, 40, 226, 207, 64, 35, 201, 155, 67, 176, 191, 171, 137, 201, 155, 137, 153, 185, 187, 220, 171, 137, 128, 56, 103, 51, 52, 35, 68, 34, 67, 35, 69, 51, 99, 51, 67, 36, 50, 36, 18, 51, 52, 52, 67, 67, 51, 36, 34, 35, 34, 50, 33, 50, 35, 16, 67, 19, 168, 153, 223, 172, 186, 205, 202, 187, 202, 188, 187, 189, 188, 204, 170, 188, 172, 170, 171, 204, 187, 202, 188, 203, 187, 188, 203, 187, 187, 203, 188, 203, 187, 219, 186, 186, 187, 203, 187, 170, 172, 186, 172, 170, 203, 185, 171, 136, 153, 16, 170, 81, 130, 33, 0, 80, 19, 98, 36, 99, 50, 34, 52, 66, 69, 33, 49, 53, 51, 19, 82, 69, 18, 18, 67, 52, 35, 49, 53, 51, 67, 52, 52, 50, 68, 51, 51, 51, 53, 51, 67, 52, 50, 52, 51, 52, 52, 20, 50, 52, 34, 51, 83, 67, 51, 35, 67, 18, 52, 51, 51, 84, 36, 34, 51, 51, 18, 9, 130, 156, 68, 144, 56, 4, 218, 205, 25, 2, 202, 41, 71, 129, 186, 48, 37, 217, 138, 34, 145, 154, 68, 18, 65, 36, 34, 128, 25, 52, 144, 138, 98, 68, 2, 128, 33, 130, 136, 168, 9, 184, 97, 161, 156, 236, 11, 232, 173, 153, 187, 154, 204, 155, 203, 154, 235, 170, 201, 187, 185, 172, 187, 173, 168, 221, 155, 152, 185, 204, 11, 17, 202, 155, 138, 128, 205, 24, 160, 139, 16, 51, 160, 72, 38, 18, 152, 9, 66, 51, 193, 204, 26, 71, 2, 9, 66, 67, 129, 156, 17, 152, 65, 130, 170, 137, 169, 251, 221, 171, 9, 152, 204, 40, 129, 16, 160, 220, 155, 185, 205, 138, 24, 19, 32, 22, 154, 66, 184, 9, 185, 116, 3, 98, 18, 8, 144, 41, 163, 223, 48, 35, 144, 26, 36, 249, 173, 153, 13, 253, 34, 0, 219, 138, 17, 0, 50, 87, 34, 0, 0, 33, 17, 128, 97, 53, 51, 52, 68, 34, 33, 34, 34, 52, 16, 116, 35, 18, 33, 53, 146, 8, 17, 34, 128, 81, 36, 51, 1, 48, 129, 189, 206, 170, 185, 172, 186, 187, 219, 205, 187, 204, 187, 187, 188, 186, 188, 203, 203, 219, 187, 188, 204, 171, 170, 187, 203, 172, 203, 187, 204, 171, 187, 171, 171, 153, 186, 187, 205, 138, 251, 154, 0, 8, 169, 48, 131, 153, 201, 139, 216, 156, 136, 40, 3, 64, 35, 137, 128, 41, 20, 112, 55, 51, 55, 51, 36, 16, 36, 128, 17, 99, 36, 50, 69, 18, 50, 19, 33, 50, 52, 66, 85, 34, 49, 36, 34, 34, 66, 18, 49, 39, 16, 50, 50, 36, 136, 51, 36, 83, 17, 70, 18, 32, 18, 33, 17, 66, 35, 50, 53, 68, 52, 18, 152, 48, 130, 40, 19, 66, 70, 19, 185, 27, 20, 237, 153, 8, 1, 235, 25, 51, 19, 204, 80, 19, 154, 16, 129, 202, 138, 208, 188, 128, 32, 54, 18, 17, 50, 20, 169, 186, 173, 32, 16, 52, 17, 130, 207, 169, 222, 154, 9, 18, 128, 67, 33, 1, 188, 218, 190, 170, 154, 136, 152, 49, 146, 219, 221, 154, 185, 172, 8, 128, 17, 200, 172, 201, 222, 187, 139, 184, 172, 66, 4, 152, 137, 128, 218, 188, 153, 0, 51, 32, 69, 128, 136, 168, 236, 138, 33, 0, 1, 24, 54, 145, 170, 219, 138, 144, 64, 38, 128, 48, 162, 174, 16, 192, 189, 25, 2, 152, 97, 20, 153, 48, 240, 189, 137, 16, 128, 153, 136, 64, 144, 72, 22, 169, 97, 20, 129, 144, 40, 55, 1, 24, 32, 82, 3, 235, 155, 8, 185, 26, 67, 145, 203, 186, 206, 205, 170, 154, 137, 128, 49, 55, 35, 17, 3, 169, 88, 3, 137, 115, 54, 19, 65, 38, 130, 16, 50, 34, 67, 68, 51, 36, 34, 50, 20, 152, 8, 34, 33, 51, 49, 85, 3, 201, 171, 136, 251, 172, 9, 201, 155, 201, 205, 187, 204, 186, 185, 203, 171, 169, 188, 189, 202, 203, 172, 187, 203, 170, 170, 189, 187, 188, 189, 187, 187, 188, 154, 154, 152, 171, 186, 206, 154, 187, 170, 138, 18, 153, 9, 152, 220, 170, 201, 156, 17, 66, 20, 137, 50, 53, 193, 158, 66, 35, 17, 66, 54, 51, 50, 53, 18, 66, 51, 67, 52, 66, 68, 36, 16, 50, 18, 17, 66, 67, 52, 52, 36, 51, 51, 18, 82, 34, 67, 51, 51, 1, 0, 1, 16, 128, 171, 116, 20, 98, 20, 128, 48, 51, 146, 58, 71, 1, 49, 34, 67, 36, 128, 32, 1, 138, 97, 37, 16, 115, 35, 128, 33, 37, 144, 139, 51, 19, 52, 2, 9, 34, 234, 25, 130, 157, 85, 34, 99, 1, 50, 2, 49, 4, 153, 33, 216, 187, 202, 187, 155, 87, 160, 57, 5, 10, 3, 191, 136, 168, 139, 152, 188, 153, 152, 220, 248, 9, 27, 0, 154, 1, 25, 50, 0, 37, 217, 25, 201, 171, 186, 24, 252, 12, 192, 174, 8, 170, 137, 136, 99, 3, 16, 68, 18, 219, 26, 225, 190, 169, 155, 16, 251, 41, 176, 141, 128, 9, 36, 51, 132, 171, 235, 140, 20, 219, 56, 20, 128, 170, 139, 34, 216, 28, 54, 1, 8, 18, 128, 169, 204, 154, 1, 202, 88, 4, 189, 25, 128, 24, 35, 1, 169, 170, 205, 9, 176, 12, 168, 173, 217, 174, 48, 161, 41, 2, 48, 37, 32, 87, 1, 24, 19, 153, 0, 205, 9, 130, 136, 144, 64, 224, 11, 216, 139, 249, 42, 4, 154, 99, 161, 173, 185, 189, 187, 171, 113, 71, 18, 34, 36, 129, 153, 33, 17, 17, 50, 18, 185, 206, 9, 50, 168, 43, 21, 136, 40, 100, 18, 153, 234, 188, 218, 171, 153, 136, 169, 187, 170, 220, 170, 8, 152, 16, 177, 174, 128, 222, 171, 202, 187, 139, 0, 16, 67, 17, 2, 187, 65, 0, 85, 18, 33, 145, 204, 203, 154, 186, 138, 83, 67, 67, 83, 52, 52, 67, 34, 18, 152, 153, 152, 169, 9, 176, 207, 187, 187, 171, 137, 137, 33, 144, 184, 223, 153, 205, 188, 189, 172, 186, 187, 185, 137, 0, 80, 38, 17, 51, 83, 2, 16, 52, 35, 35, 16, 19, 201, 185, 173, 82, 18, 85, 19, 83, 34, 16, 34, 33, 144, 138, 145, 191, 155, 136, 160, 189, 10, 144, 9, 115, 55, 35, 68, 3, 8, 17, 152, 128, 25, 146, 156, 178, 191, 154, 169, 155, 100, 51, 54, 35, 35, 33, 2, 170, 81, 146, 172, 168, 139, 193, 191, 8, 48, 162, 89, 55, 35, 33, 85, 3, 137, 128, 186, 186, 189, 137, 185, 8, 207, 32, 201, 56, 35, 87, 1, 32, 4, 169, 136, 8, 160, 155, 176, 173, 217, 174, 16, 8, 8, 66, 19, 10, 66, 35, 131, 220, 48, 240, 156, 168, 138, 200, 139, 129, 155, 128, 187, 99, 129, 82, 130, 81, 145, 11, 1, 136, 152, 32, 83, 162, 175, 50, 33, 36, 0, 117, 18, 136, 16, 49, 224, 139, 130, 173, 170, 155, 128, 202, 155, 33, 200, 140, 1, 67, 216, 88, 146, 140, 202, 156, 185, 189, 152, 170, 137, 152, 137, 82, 36, 169, 115, 146, 156, 136, 185, 188, 186, 187, 203, 190, 41, 146, 156, 83, 129, 48, 21, 153, 115, 161, 139, 52, 218, 25, 130, 8, 1, 65, 19, 66, 20, 188, 98, 178, 173, 40, 192, 190, 40, 192, 12, 2, 155, 1, 219, 154, 202, 171, 10, 69, 33, 85, 51, 67, 1, 80, 37, 129, 65, 19, 17, 129, 40, 4, 169, 8, 1, 18, 185, 72, 22, 184, 156, 32, 200, 190, 137, 185, 204, 205, 138, 168, 204, 153, 8, 136, 170, 33, 146, 138, 144, 137, 18, 237, 26, 19, 235, 171, 136, 203, 155, 169, 97, 19, 170, 81, 146, 171, 137, 1, 152, 203, 25, 2, 223, 171, 153, 185, 41, 71, 51, 51, 149, 250, 31, 0, 52, 130, 152, 155, 160, 207, 171, 139, 253, 155, 184, 172, 185, 170, 152, 153, 137, 0, 218, 188, 153, 201, 188, 186, 154, 234, 155, 8, 152, 8, 99, 69, 34, 115, 52, 35, 34, 67, 2, 136, 1, 24, 162, 141, 18, 204, 168, 157, 17, 137, 52, 49, 39, 136, 34, 136, 0, 49, 19, 114, 2, 16, 146, 72, 21, 64, 53, 68, 35, 51, 34, 69, 17, 19, 32, 22, 170, 16, 160, 155, 9, 0, 129, 33, 145, 121, 38, 32, 53, 34, 18, 128, 169, 66, 216, 120, 4, 72, 132, 11, 20, 152, 33, 52, 3, 8, 51, 208, 155, 170, 88, 162, 173, 189, 10, 220, 48, 131, 136, 169, 233, 188, 170, 9, 98, 35, 8, 54, 202, 9, 25, 54, 129, 84, 130, 153, 144, 154, 169, 9, 2, 9, 249, 175, 128, 203, 9, 128, 128, 153, 9, 200, 188, 9, 51, 177, 57, 194, 157, 184, 12, 84, 144, 57, 5, 186, 9, 137, 67, 185, 113, 193, 172, 202, 138, 168, 139, 50, 160, 152, 189, 32, 223, 56, 4, 138, 16, 152, 8, 234, 42, 21, 32, 130, 48, 162, 139, 34, 115, 19, 16, 248, 172, 187, 11, 201, 41, 132, 204, 136, 202, 154, 137, 117, 18, 16, 136, 98, 177, 44, 38, 8, 33, 169, 33, 208, 154, 33, 136, 153, 24, 233, 10, 160, 42, 55, 136, 0, 128, 220, 154, 0, 99, 1, 113, 130, 170, 168, 48, 177, 112, 4, 9, 185, 190, 172, 187, 10, 129, 10, 250, 187, 236, 155, 153, 0, 50, 52, 68, 35, 24, 83, 51, 68, 52, 66, 35, 129, 49, 146, 25, 1, 16, 200, 156, 186, 169, 207, 154, 153, 186, 172, 152, 188, 188, 204, 169, 204, 154, 201, 171, 153, 202, 42, 176, 141, 35, 202, 56, 131, 96, 21, 24, 35, 184, 170, 136, 202, 56, 129, 25, 218, 172, 251, 138, 152, 48, 1, 117, 146, 25, 162, 12, 162, 141, 34, 153, 34, 169, 34, 221, 9, 129, 128, 16, 53, 128, 170, 202, 251, 138, 200, 173, 176, 175, 128, 204, 137, 185, 137, 184, 9, 51, 17, 69, 50, 38, 0, 68, 131, 9, 50, 51, 52, 8, 99, 160, 153, 138, 34, 49, 39, 16, 52, 185, 57, 18, 19, 41, 103, 128, 168, 12, 146, 174, 18, 153, 66, 131, 25, 20, 153, 64, 103, 145, 80, 131, 48, 131, 41, 37, 49, 130, 48, 147, 56, 242, 28, 6, 156, 32, 160, 24, 169, 114, 146, 9, 17, 55, 192, 41, 21, 16, 160, 112, 131, 138, 17, 16, 160, 156, 51, 168, 251, 141, 18, 218, 9, 144, 8, 152, 24, 185, 25, 184, 114, 3, 32, 36, 18, 51, 235, 88, 162, 13, 35, 186, 137, 186, 201, 189, 186, 172, 144, 188, 156, 8, 234, 155, 129, 202, 137, 201, 25, 249, 26, 136, 17, 237, 24, 144, 40, 232, 56, 5, 156, 50, 145, 40, 17, 82, 176, 41, 36, 8, 185, 141, 18, 217, 203, 9, 162, 195, 255, 28, 0, 174, 50, 144, 25, 2, 234, 88, 4, 10, 70, 2, 24, 33, 50, 18, 35, 169, 117, 176, 13, 2, 203, 187, 26, 148, 191, 1, 202, 136, 202, 32, 144, 9, 16, 55, 160, 57, 22, 0, 136, 80, 4, 136, 33, 17, 144, 170, 17, 49, 20, 56, 71, 128, 24, 34, 34, 168, 116, 6, 154, 160, 221, 203, 187, 219, 172, 169, 202, 170, 186, 170, 169, 153, 49, 39, 17, 52, 38, 34, 67, 51, 67, 51, 35, 36, 1, 33, 1, 17, 204, 16, 185, 152, 155, 20, 137, 193, 43, 7, 171, 48, 34, 3, 156, 34, 236, 187, 188, 154, 219, 156, 144, 172, 185, 12, 130, 157, 34, 16, 54, 0, 66, 17, 52, 152, 65, 160, 24, 176, 191, 171, 202, 171, 204, 9, 217, 139, 19, 138, 84, 18, 66, 35, 35, 83, 34, 17, 128, 202, 205, 170, 206, 170, 218, 172, 169, 202, 171, 187, 186, 172, 9, 128, 25, 21, 153, 83, 130, 65, 4, 0, 17, 2, 202, 138, 152, 187, 9, 169, 170, 190, 42, 3, 113, 38, 48, 68, 1, 16, 50, 20, 128, 128, 8, 147, 223, 137, 152, 170, 141, 82, 161, 10, 53, 34, 82, 69, 51, 51, 52, 37, 19, 18, 32, 52, 128, 17, 186, 169, 189, 187, 188, 8, 218, 139, 18, 200, 121, 38, 33, 51, 52, 38, 34, 35, 34, 18, 50, 20, 168, 169, 155, 161, 190, 8, 144, 190, 137, 186, 9, 56, 87, 51, 37, 49, 37, 128, 65, 2, 40, 52, 82, 20, 186, 8, 0, 33, 160, 114, 162, 139, 51, 234, 139, 16, 18, 169, 64, 200, 26, 217, 56, 177, 24, 184, 137, 219, 9, 136, 20, 207, 66, 250, 175, 0, 153, 9, 168, 171, 201, 172, 218, 189, 154, 169, 171, 219, 187, 153, 203, 170, 168, 188, 25, 177, 191, 8, 184, 153, 189, 138, 192, 207, 138, 153, 203, 137, 128, 185, 139, 169, 139, 2, 8, 116, 38, 152, 49, 129, 50, 202, 114, 160, 139, 2, 202, 171, 154, 24, 137, 99, 1, 67, 84, 69, 16, 84, 1, 32, 2, 48, 52, 1, 24, 39, 184, 9, 152, 187, 155, 137, 209, 175, 32, 170, 0, 115, 132, 59, 55, 137, 66, 128, 49, 161, 88, 4, 187, 41, 3, 221, 41, 178, 156, 145, 171, 50, 250, 59, 21, 170, 32, 1, 16, 66, 130, 26, 35, 153, 1, 188, 168, 158, 1, 203, 48, 248, 141, 18, 202, 97, 3, 10, 55, 184, 58, 23, 169, 48, 163, 158, 35, 200, 26, 131, 154, 128, 137, 235, 73, 146, 41, 133, 154, 192, 174, 217, 189, 171, 153, 202, 138, 144, 188, 139, 56, 146, 113, 55, 34, 52, 67, 67, 67, 50, 66, 52, 18, 17, 35, 145, 25, 161, 189, 170, 220, 204, 170, 187, 204, 170, 186, 171, 202, 154, 129, 186, 25, 4, 8, 51, 52, 35, 52, 18, 56, 38, 186, 171, 201, 219, 203, 188, 171, 219, 187, 188, 154, 170, 139, 153, 10, 47, 245, 24, 0, 34, 34, 70, 36, 17, 50, 86, 19, 17, 51, 18, 1, 8, 17, 144, 138, 1, 239, 187, 173, 170, 235, 155, 185, 172, 219, 172, 169, 187, 155, 136, 187, 171, 171, 17, 16, 87, 51, 53, 35, 68, 51, 50, 53, 51, 52, 36, 51, 2, 8, 144, 155, 16, 48, 179, 207, 1, 188, 26, 33, 69, 67, 52, 36, 1, 49, 37, 49, 36, 99, 18, 24, 144, 155, 160, 158, 2, 202, 40, 0, 204, 43, 2, 40, 19, 115, 39, 18, 33, 51, 3, 99, 51, 35, 16, 67, 160, 9, 168, 220, 189, 8, 202, 171, 170, 251, 9, 128, 24, 50, 68, 36, 32, 69, 52, 18, 67, 51, 19, 0, 85, 145, 25, 146, 42, 5, 219, 138, 153, 137, 153, 200, 155, 130, 188, 98, 36, 184, 120, 147, 139, 50, 84, 130, 48, 163, 207, 155, 137, 128, 186, 154, 36, 252, 139, 136, 24, 152, 115, 23, 136, 17, 2, 8, 83, 18, 32, 51, 18, 128, 160, 239, 9, 152, 9, 217, 155, 202, 203, 188, 137, 168, 154, 201, 155, 218, 9, 160, 137, 170, 115, 2, 2, 9, 35, 154, 69, 144, 8, 219, 0, 236, 169, 137, 168, 173, 154, 9, 249, 140, 8, 8, 160, 26, 3, 41, 23, 136, 84, 18, 34, 18, 1, 24, 53, 1, 128, 153, 221, 41, 240, 157, 144, 156, 136, 153, 152, 175, 0, 170, 24, 16, 83, 145, 57, 132, 172, 69, 129, 97, 146, 24, 3, 187, 81, 1, 153, 9, 84, 146, 203, 153, 25, 1, 144, 234, 188, 25, 129, 188, 40, 2, 117, 131, 57, 179, 14, 37, 128, 83, 35, 168, 56, 163, 143, 33, 8, 129, 172, 170, 220, 204, 171, 152, 220, 139, 16, 160, 171, 32, 17, 84, 52, 69, 35, 66, 36, 34, 99, 34, 49, 36, 2, 34, 0, 33, 146, 155, 136, 186, 221, 189, 186, 220, 187, 170, 188, 169, 203, 169, 188, 153, 202, 9, 145, 25, 19, 155, 69, 184, 27, 144, 137, 1, 1, 252, 172, 186, 219, 187, 168, 188, 186, 172, 201, 157, 137, 137, 24, 49, 20, 16, 1, 82, 53, 83, 83, 35, 18, 82, 129, 65, 52, 1, 152, 153, 137, 250, 190, 153, 186, 203, 189, 203, 188, 202, 171, 154, 170, 136, 171, 137, 203, 64, 51, 85, 67, 52, 34, 50, 34, 82, 52, 51, 50, 37, 1, 176, 140, 131, 155, 37, 202, 24, 234, 138, 169, 27, 19, 137, 67, 130, 188, 26, 51, 71, 2, 113, 21, 8, 33, 33, 130, 88, 37, 17, 16, 66, 129, 25, 36, 137, 50, 18, 18, 189, 80, 184, 26, 176, 120, 164, 13, 21, 169, 113, 129, 10, 50, 1, 67, 50, 53, 2, 40, 18, 187, 99, 18, 51, 250, 26, 250, 187, 170, 137, 160, 187, 170, 252, 172, 24, 136, 97, 52, 3, 136, 152, 24, 21, 49, 55, 17, 18, 144, 153, 187, 24, 49, 163, 239, 169, 219, 170, 170, 187, 171, 169, 221, 170, 171, 187, 75, 253, 31, 0, 154, 138, 153, 169, 186, 113, 36, 50, 55, 19, 48, 37, 1, 69, 18, 65, 145, 10, 201, 173, 0, 185, 10, 192, 190, 170, 190, 153, 169, 41, 20, 153, 0, 203, 40, 129, 115, 55, 49, 36, 0, 16, 152, 80, 2, 48, 5, 171, 136, 206, 9, 152, 56, 193, 141, 176, 191, 153, 154, 50, 176, 40, 192, 27, 177, 142, 53, 51, 69, 2, 17, 1, 16, 84, 35, 19, 129, 128, 217, 189, 9, 168, 138, 251, 157, 184, 189, 136, 185, 9, 145, 139, 52, 218, 73, 20, 66, 36, 0, 66, 35, 33, 34, 83, 18, 32, 161, 10, 130, 207, 25, 160, 187, 9, 253, 187, 154, 170, 152, 138, 129, 255, 154, 153, 169, 170, 169, 153, 0, 168, 153, 187, 65, 118, 67, 49, 52, 35, 51, 69, 51, 52, 52, 50, 34, 33, 51, 19, 33, 2, 42, 37, 188, 138, 220, 235, 171, 137, 186, 186, 204, 186, 187, 203, 171, 185, 140, 2, 188, 41, 201, 156, 153, 57, 21, 218, 56, 241, 157, 129, 187, 16, 233, 155, 184, 173, 136, 186, 153, 251, 10, 144, 9, 1, 9, 36, 169, 114, 35, 66, 36, 51, 37, 34, 51, 18, 65, 35, 8, 129, 251, 219, 188, 170, 203, 204, 188, 202, 187, 187, 187, 170, 172, 187, 170, 8, 136, 114, 37, 17, 84, 51, 51, 35, 50, 54, 34, 69, 18, 16, 8, 33, 145, 25, 20, 220, 8, 200, 9, 176, 29, 131, 171, 33, 219, 40, 147, 72, 131, 41, 55, 0, 0, 170, 64, 51, 2, 32, 36, 200, 153, 128, 113, 70, 34, 17, 32, 49, 51, 193, 59, 119, 0, 17, 160, 48, 162, 12, 19, 171, 34, 235, 155, 25, 129, 170, 113, 4, 153, 67, 17, 115, 66, 69, 146, 9, 49, 52, 129, 48, 2, 153, 203, 206, 172, 136, 202, 204, 186, 204, 170, 187, 10, 192, 157, 34, 136, 98, 34, 83, 36, 49, 68, 33, 66, 67, 35, 17, 17, 128, 64, 129, 187, 219, 204, 172, 203, 219, 170, 171, 172, 154, 186, 219, 153, 0, 8, 8, 100, 34, 33, 35, 51, 36, 67, 52, 20, 128, 50, 160, 173, 137, 170, 188, 136, 251, 189, 219, 186, 186, 155, 0, 168, 10, 2, 188, 10, 40, 119, 19, 16, 52, 1, 32, 51, 18, 65, 35, 50, 129, 219, 219, 203, 170, 169, 171, 154, 250, 206, 154, 154, 9, 1, 65, 36, 128, 0, 136, 32, 18, 115, 71, 1, 16, 1, 168, 155, 50, 17, 66, 208, 156, 0, 204, 138, 34, 8, 50, 53, 51, 17, 201, 173, 24, 54, 2, 80, 38, 129, 40, 129, 170, 16, 168, 32, 248, 175, 33, 146, 188, 138, 128, 0, 218, 156, 82, 19, 24, 49, 83, 52, 66, 69, 34, 34, 50, 19, 234, 153, 144, 169, 218, 138, 201, 223, 170, 153, 137, 168, 171, 136, 218, 138, 17, 202, 96, 37, 1, 32, 66, 51, 1, 49, 54, 17, 49, 19, 186, 169, 191, 137, 201, 218, 4, 31, 0, 155, 17, 234, 173, 169, 203, 169, 202, 171, 138, 218, 190, 172, 0, 235, 156, 16, 144, 9, 2, 137, 82, 34, 84, 51, 66, 67, 51, 67, 67, 51, 52, 35, 51, 35, 49, 131, 203, 42, 5, 204, 172, 186, 203, 219, 156, 137, 170, 186, 203, 138, 144, 154, 65, 3, 48, 38, 17, 17, 0, 84, 51, 2, 66, 131, 173, 8, 203, 186, 191, 170, 205, 202, 203, 170, 187, 154, 202, 172, 137, 169, 172, 9, 8, 67, 68, 36, 17, 49, 85, 19, 49, 53, 128, 49, 3, 201, 139, 168, 222, 187, 186, 204, 202, 202, 187, 202, 171, 185, 187, 202, 26, 131, 155, 84, 19, 48, 103, 18, 49, 51, 18, 50, 50, 66, 52, 144, 24, 4, 236, 10, 160, 174, 169, 0, 216, 155, 145, 170, 152, 72, 20, 138, 17, 82, 38, 136, 99, 2, 128, 49, 37, 128, 17, 16, 50, 128, 154, 16, 250, 141, 33, 185, 153, 153, 201, 223, 137, 17, 128, 136, 48, 4, 203, 65, 146, 138, 17, 116, 35, 49, 69, 2, 16, 67, 19, 169, 48, 36, 0, 160, 159, 66, 184, 155, 152, 8, 208, 12, 18, 218, 10, 49, 83, 19, 136, 99, 18, 144, 73, 55, 17, 17, 17, 18, 154, 66, 19, 160, 26, 20, 154, 238, 11, 168, 57, 161, 57, 193, 90, 162, 158, 129, 16, 19, 48, 68, 51, 8, 36, 138, 87, 33, 20, 9, 3, 222, 40, 160, 27, 83, 129, 139, 66, 128, 185, 186, 220, 42, 131, 10, 131, 239, 8, 169, 187, 26, 34, 0, 219, 9, 200, 173, 41, 54, 168, 104, 3, 154, 1, 204, 171, 170, 138, 184, 189, 219, 156, 8, 169, 10, 69, 130, 154, 169, 153, 8, 18, 104, 39, 169, 56, 178, 173, 169, 59, 103, 152, 40, 146, 174, 9, 153, 8, 0, 67, 2, 136, 16, 161, 174, 99, 2, 32, 132, 137, 84, 176, 43, 52, 152, 144, 172, 32, 250, 171, 136, 186, 155, 185, 172, 154, 251, 11, 130, 191, 65, 35, 16, 82, 84, 19, 0, 34, 129, 138, 50, 35, 184, 139, 160, 140, 250, 174, 24, 129, 188, 204, 171, 153, 186, 219, 154, 128, 220, 138, 145, 239, 154, 0, 145, 188, 138, 35, 200, 140, 83, 19, 137, 83, 51, 51, 67, 86, 18, 24, 66, 19, 32, 37, 18, 136, 8, 50, 3, 185, 58, 5, 220, 137, 176, 172, 169, 154, 40, 51, 34, 87, 145, 171, 50, 20, 152, 152, 136, 249, 191, 8, 168, 205, 154, 170, 203, 169, 173, 10, 144, 171, 24, 144, 58, 7, 137, 18, 220, 48, 21, 152, 153, 33, 161, 223, 154, 152, 169, 10, 2, 233, 138, 218, 11, 161, 158, 129, 220, 137, 129, 187, 154, 129, 185, 205, 155, 32, 192, 157, 17, 168, 40, 36, 98, 3, 9, 37, 145, 153, 50, 20, 137, 49, 52, 17, 186, 112, 23, 128, 16, 16, 66, 1, 49, 54, 51, 18, 33, 2, 56, 54, 34, 69, 161, 157, 186, 252, 27, 0, 50, 200, 139, 2, 154, 168, 203, 172, 153, 170, 116, 37, 1, 48, 21, 8, 100, 67, 18, 65, 36, 129, 138, 66, 35, 168, 139, 1, 252, 157, 137, 137, 153, 9, 17, 234, 10, 50, 128, 114, 20, 0, 33, 50, 52, 52, 1, 72, 5, 169, 153, 170, 171, 170, 220, 153, 152, 152, 154, 251, 189, 24, 130, 152, 136, 10, 99, 1, 136, 145, 206, 97, 130, 187, 203, 138, 160, 138, 3, 136, 18, 56, 119, 146, 154, 154, 66, 249, 156, 129, 136, 136, 188, 24, 145, 173, 32, 186, 138, 155, 71, 168, 40, 128, 99, 18, 50, 147, 172, 65, 49, 4, 206, 32, 184, 138, 160, 9, 18, 32, 39, 169, 72, 19, 96, 37, 0, 68, 1, 0, 67, 193, 172, 32, 18, 169, 185, 140, 2, 153, 250, 157, 136, 26, 52, 0, 1, 26, 103, 18, 34, 0, 67, 2, 49, 147, 140, 33, 51, 2, 0, 185, 189, 187, 235, 173, 137, 25, 87, 161, 155, 8, 34, 161, 74, 178, 143, 34, 1, 200, 139, 33, 184, 57, 163, 191, 32, 18, 184, 205, 170, 49, 19, 129, 254, 156, 24, 128, 153, 204, 188, 153, 152, 185, 191, 171, 184, 188, 154, 153, 170, 152, 236, 9, 2, 56, 22, 170, 9, 16, 3, 169, 17, 253, 158, 34, 128, 170, 187, 9, 169, 97, 3, 83, 176, 41, 20, 65, 51, 34, 115, 3, 186, 9, 65, 240, 157, 33, 128, 152, 174, 49, 160, 139, 0, 67, 192, 42, 133, 139, 146, 14, 3, 157, 1, 170, 168, 174, 8, 185, 157, 98, 19, 0, 136, 66, 1, 98, 146, 10, 18, 98, 18, 153, 8, 168, 72, 192, 43, 148, 156, 129, 171, 16, 8, 102, 3, 169, 189, 10, 185, 141, 168, 158, 185, 141, 2, 188, 137, 25, 3, 41, 5, 32, 161, 73, 22, 49, 21, 32, 4, 136, 128, 40, 129, 8, 203, 81, 249, 138, 83, 1, 137, 66, 53, 128, 83, 129, 24, 128, 49, 209, 156, 66, 2, 8, 202, 138, 251, 13, 130, 137, 3, 140, 2, 157, 35, 187, 66, 8, 85, 216, 11, 128, 40, 132, 25, 38, 0, 1, 49, 36, 235, 138, 16, 130, 221, 138, 1, 201, 172, 154, 34, 145, 25, 35, 8, 17, 112, 87, 129, 32, 34, 83, 129, 56, 129, 24, 2, 40, 193, 175, 184, 174, 0, 235, 137, 169, 0, 152, 64, 144, 64, 3, 9, 34, 98, 36, 145, 171, 17, 65, 38, 128, 33, 152, 24, 201, 156, 153, 115, 161, 12, 20, 8, 2, 40, 37, 17, 129, 219, 57, 36, 49, 20, 64, 36, 115, 131, 10, 19, 40, 39, 168, 33, 50, 240, 12, 18, 153, 144, 155, 160, 159, 50, 152, 128, 170, 50, 184, 138, 0, 200, 141, 69, 160, 26, 101, 2, 138, 168, 139, 144, 12, 179, 255, 8, 128, 160, 172, 33, 170, 1, 185, 152, 207, 16, 168, 50, 144, 69, 144, 9, 152, 8, 8, 71, 168, 40, 217, 11, 128, 175, 1, 16, 0, 64, 147, 173, 153, 40, 2, 104, 20, 138, 18, 190, 57, 131, 170, 235, 156, 168, 188, 24, 233, 156, 160, 187, 8, 168, 201, 205, 138, 152, 0, 153, 32, 250, 14, 17, 153, 16, 128, 24, 161, 59, 87, 169, 24, 17, 37, 251, 72, 161, 26, 3, 82, 3, 32, 209, 12, 146, 156, 3, 138, 1, 139, 4, 219, 0, 203, 25, 128, 24, 50, 177, 121, 7, 9, 129, 156, 2, 171, 52, 234, 56, 177, 27, 208, 58, 20, 137, 200, 10, 146, 12, 176, 141, 161, 27, 20, 137, 136, 102, 161, 43, 54, 1, 128, 48, 19, 24, 20, 24, 21, 154, 146, 175, 1, 170, 50, 200, 138, 220, 139, 1, 152, 9, 35, 190, 96, 161, 73, 130, 16, 144, 113, 130, 41, 19, 48, 21, 136, 35, 137, 67, 169, 64, 169, 65, 144, 9, 201, 153, 10, 51, 203, 48, 179, 11, 2, 154, 33, 161, 57, 4, 168, 17, 153, 33, 0, 1, 153, 50, 0, 144, 26, 19, 144, 17, 25, 1, 153, 49, 0, 33, 153, 19, 153, 33, 145, 153, 17, 17, 17, 153, 25, 1, 0, 0, 0, 32, 1, 10, 17, 1, 0, 1, 1, 0, 0, 16, 144, 16, 144, 16, 145, 0, 0, 0, 0, 0, 0, 0, 0, 25, 0, 0, 145, 9, 1, 0, 0, 0, 0, 0, 16, 144, 0, 0, 0, 0, 9, 1, 9, 0, 0, 16, 144, 0, 16, 0, 1, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 0, 16, 0, 0, 0, 0, 9, 0, 0, 0, 0, 16, 144, 0, 16, 0, 9, 1, 0, 0, 0, 0, 144, 16, 0, 0, 0, 0, 9, 1, 0, 0, 0, 0, 0, 144, 16, 144, 16, 0, 0, 0, 9, 0, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
-static const size_t audio_searching_for_a_gps_signal_sample_data_length = sizeof(audio_searching_for_a_gps_signal_sample_data) / sizeof(audio_searching_for_a_gps_signal_sample_data[0]);
+static const size_t audio_searching_for_a_gps_signal_sample_data_length = 74216;
@@ -1,4 +1,4 @@
-// This file was generated by a script on 20-11-2024 08:37:38
+// This file was generated by a script on 17-10-2026 14:18:59
 
 #pragma once
 
@@ -6,6 +6,7 @@
 #include <stdint.h>
 #include <pico/platform/sections.h>
 
-static const int16_t __in_flash("audio_seventy_sample_data") audio_seventy_sample_data[] = { -506, -178, 76, -464, -995, -500, 560, 1033, 589, -229, -736, -553, 78, 558, 705, 855, 1013, 761, 115, -393, -562, -635, -600, -133, 681, 1241, 1197, 806, 321, -369, -1103, -1208, -553, -9, -130, -380, -314, -258, -266, 62, 399, 93, -273, 337, 1304, 1072, -274, -1109, -720, -56, -50, -488, -674, -392, 93, 479, 551, 296, 48, 88, 78, -371, -748, -358, 328, 427, 214, 435, 760, 437, -255, -592, -548, -367, 77, 704, 966, 621, 20, -519, -919, -1004, -629, -54, 297, 347, 300, 192, -158, -708, -987, -567, 372, 1155, 1231, 600, -256, -794, -845, -644, -326, 228, 912, 1302, 1267, 991, 330, -862, -1825, -1500, -85, 1146, 1453, 1021, 162, -786, -1192, -680, 310, 1043, 1192, 717, -322, -1401, -1539, -347, 1192, 1659, 847, -219, -767, -863, -657, -108, 461, 519, 101, -277, -360, -247, -86, -3, 24, 226, 502, 246, -645, -1273, -980, -241, 323, 738, 931, 501, -285, -481, 121, 670, 579, 205, 45, 47, -152, -665, -1098, -876, -21, 650, 473, -193, -477, -115, 378, 500, 219, -267, -793, -1099, -885, -233, 388, 718, 883, 833, 308, -437, -718, -425, -94, 81, 365, 640, 453, -144, -580, -501, -39, 423, 512, 214, -44, -41, -129, -472, -505, 153, 873, 881, 434, 263, 278, -231, -1227, -1606, -595, 1120, 2096, 1716, 578, -577, -1527, -1931, -1173, 397, 1200, 477, -502, -411, 278, 526, 363, 234, 115, 111, 489, 806, 332, -646, -1183, -960, -293, 461, 770, 178, -772, -892, 21, 847, 712, -48, -713, -1080, -1159, -651, 584, 1800, 1814, 346, -1499, -2296, -1613, -161, 1044, 1410, 980, 346, 100, 60, -548, -1694, -2050, -686, 1449, 2600, 2105, 587, -981, -1773, -1438, -508, 73, 110, 283, 986, 1707, 1797, 1241, 292, -1013, -2298, -2489, -1009, 1119, 2332, 2236, 1401, 172, -1206, -1960, -1485, -388, 157, -31, 39, 1069, 2307, 2244, 439, -1743, -2567, -1761, -473, 315, 637, 891, 1078, 899, 214, -731, -1374, -1237, -410, 509, 953, 748, 73, -599, -724, -247, 194, -8, -628, -842, -196, 870, 1453, 1045, 5, -743, -543, 371, 1081, 893, -8, -899, -1213, -742, 359, 1325, 1177, -2, -851, -490, 185, -133, -1139, -1325, -116, 1356, 1707, 775, -538, -1367, -1425, -910, -284, 79, 268, 568, 840, 653, 55, -328, -54, 591, 808, 1, -1400, -1944, -632, 1637, 2795, 1904, 29, -1294, -1673, -1493, -862, 208, 1086, 1124, 773, 948, 1342, 659, -1254, -2728, -2275, -426, 1124, 1547, 1304, 906, 206, -901, -1819, -1791, -803, 455, 1324, 1517, 1007, 100, -576, -657, -465, -342, -63, 474, 641, -15, -898, -1149, -642, 270, 1162, 1450, 818, -239, -997, -1218, -804, 224, 1006, 581, -373, -355, 475, 659, -37, -533, -393, -10, 360, 313, -693, -1920, -1542, 712, 2687, 2422, 330, -1729, -2451, -1861, -784, 189, 1116, 1840, 1496, -131, -1548, -1277, 92, 896, 646, 82, -139, 210, 949, 1213, 185, -1518, -2255, -1341, 287, 1344, 1295, 407, -653, -1349, -1639, -1591, -864, 726, 2302, 2483, 1071, -487, -720, 124, 384, -846, -2267, -1787, 663, 2753, 2570, 858, -312, -307, -229, -848, -1502, -1243, -84, 1297, 2177, 1742, -347, -2730, -3090, -990, 1359, 1969, 1248, 520, -92, -1093, -1994, -1568, 419, 2524, 2952, 1414, -616, -1592, -1486, -1410, -1853, -1926, -649, 1476, 2927, 2918, 1836, 134, -1889, -3215, -2559, -215, 1782, 1904, 719, -120, 110, 568, 169, -746, -744, 400, 925, -399, -2015, -1508, 847, 2276, 1249, -646, -1153, -267, 328, -99, -677, -604, -220, -210, -579, -761, -307, 634, 1355, 1187, 282, -448, -428, -144, -314, -587, 0, 1297, 1855, 854, -732, -1412, -857, 63, 405, -13, -610, -755, -420, 91, 845, 1979, 2701, 1636, -1168, -3350, -2631, 160, 1981, 1488, 299, 84, 391, 121, -606, -1003, -850, -450, -108, 28, 100, 444, 955, 855, -321, -1754, -2019, -824, 583, 1021, 764, 826, 1339, 1411, 454, -983, -1862, -1749, -1070, -452, -21, 558, 1404, 1897, 1157, -851, -2876, -3399, -2043, 208, 2001, 2539, 1801, 380, -871, -1444, -1515, -1443, -1031, 173, 1766, 2430, 1491, -79, -890, -859, -902, -1213, -922, 361, 1666, 1805, 792, -481, -1393, -1737, -1159, 418, 1842, 1460, -568, -1832, -539, 1971, 2834, 1255, -873, -1759, -1578, -1213, -584, 767, 2206, 2371, 953, -809, -1602, -1344, -763, -264, 265, 841, 1157, 875, -126, -1441, -1925, -594, 1772, 2855, 1416, -1129, -2534, -2216, -1084, 220, 1615, 2475, 1731, -554, -2671, -2962, -1539, 209, 1228, 1430, 1201, 821, 295, -376, -759, -268, 767, 1024, -178, -1643, -1510, 454, 2386, 2293, 255, -1585, -1396, 226, 994, -266, -2184, -2481, -521, 2109, 3240, 2025, -509, -2435, -2497, -1018, 625, 1414, 1425, 1135, 574, -300, -909, -634, 93, 149, -739, -1542, -1165, 302, 1747, 2130, 1274, -273, -1782, -2515, -1819, 232, 2303, 2746, 1418, -86, -449, -236, -751, -1818, -1908, -502, 1014, 1337, 938, 927, 1125, 423, -1311, -2679, -2270, -164, 2173, 3024, 1585, -1140, -2733, -1739, 498, 1589, 1055, 20, -905, -1488, -1042, 199, 656, 20, 109, 1576, 2351, 815, -1782, -3134, -2295, 11, 2042, 2263, 921, -358, -864, -1175, -1277, -396, 1074, 1543, 509, -703, -878, -351, -143, -437, -428, 509, 1793, 2004, 425, -1829, -2567, -769, 2071, 3396, 2262, -45, -1787, -2209, -1394, 76, 1252, 1518, 1186, 828, 436, -237, -1045, -1634, -1774, -1279, -173, 1051, 1836, 2032, 1642, 623, -720, -1744, -2076, -1648, -361, 1373, 2224, 1279, -463, -1145, -420, 292, -57, -797, -619, 537, 1307, 626, -779, -1166, 62, 1562, 1631, 50, -1872, -2565, -1366, 1005, 2900, 2957, 1027, -1832, -3790, -3048, 371, 3706, 3805, 709, -2469, -3307, -2172, -519, 1107, 2554, 2966, 1498, -1234, -3366, -3501, -1763, 685, 2505, 2715, 1306, -400, -810, 48, 360, -1109, -3025, -2792, 191, 3536, 4472, 2680, -75, -2263, -3400, -3128, -1126, 1714, 3356, 2558, 144, -2061, -2906, -2136, 8, 2429, 3206, 1486, -1040, -2031, -1434, -930, -995, -497, 972, 2276, 2357, 1318, -178, -1453, -1723, -578, 1069, 1422, -191, -2229, -2529, -666, 1820, 3147, 2654, 864, -1179, -2695, -3355, -2768, -563, 2465, 4181, 3046, -244, -3397, -4122, -1523, 2646, 4736, 2866, -911, -3361, -3434, -1749, 800, 2663, 2408, 805, -383, -1300, -2717, -3139, -854, 2414, 3429, 1831, -163, -1053, -890, -234, 234, 82, -260, -121, 358, 543, 139, -787, -1775, -1802, -278, 1738, 2519, 1704, 190, -1511, -3245, -3854, -1834, 2198, 5067, 4043, -18, -3323, -3248, -1079, 354, 667, 1282, 1810, 625, -1344, -1433, 266, 1234, 974, 1082, 1325, -126, -2640, -3165, -809, 1736, 2135, 1134, 323, -404, -1458, -1763, -571, 643, 415, -180, 533, 1790, 1589, -30, -1135, -851, -297, -496, -886, -485, 616, 1544, 1623, 589, -1302, -2893, -2720, -658, 1636, 2419, 1498, -115, -1430, -1773, -788, 854, 1488, 498, -426, 369, 1709, 1117, -1259, -2411, -508, 2464, 2985, 340, -2363, -1995, 598, 1793, 93, -2203, -2529, -994, 877, 2170, 2402, 1173, -1017, -2724, -2795, -1099, 1517, 3373, 2946, 531, -1855, -2607, -1821, -478, 681, 1399, 1731, 1754, 1147, -595, -2903, -3626, -1198, 2576, 3904, 1917, -169, -91, 310, -1060, -2736, -2302, -123, 1833, 2712, 2587, 1525, -70, -1464, -2178, -1891, -560, 846, 1010, 110, -431, -177, -29, -399, -590, -221, 94, -140, -599, -947, -1261, -1082, 546, 3016, 3751, 1449, -1775, -3114, -2280, -584, 1183, 2239, 1258, -1599, -3569, -2292, 973, 2862, 2092, 362, -699, -1412, -2175, -1771, 722, 3451, 3463, 683, -1875, -2142, -1109, -344, 278, 1239, 1814, 1305, 278, -341, -339, -20, 58, -499, -1154, -948, -64, 536, 778, 939, 349, -1112, -1563, 266, 2522, 2776, 1350, -8, -845, -1497, -1683, -1165, -367, 551, 1954, 3474, 3652, 1485, -2126, -4872, -5020, -2885, -115, 2184, 3783, 4002, 1798, -2123, -4811, -3953, -443, 2814, 3908, 2873, 562, -2002, -3474, -2862, -732, 1290, 2361, 2729, 2321, 565, -1982, -3347, -2432, -505, 701, 1266, 1965, 2042, 411, -1701, -2206, -1596, -1831, -2335, -646, 3055, 5388, 4000, -6, -3833, -5245, -3352, 897, 4670, 5162, 2307, -1157, -2785, -2709, -2326, -1982, -1049, 574, 2126, 2692, 1805, -131, -1981, -2849, -2545, -1008, 1541, 3644, 3457, 1201, -714, -687, 277, 310, -923, -2123, -1945, -304, 1620, 2456, 1847, 570, -401, -729, -690, -721, -948, -1068, -825, -386, 172, 1253, 2723, 3164, 1477, -1312, -3105, -2937, -1149, 1402, 3227, 2747, 239, -1967, -2216, -1217, -450, -164, 262, 965, 1452, 1350, 695, -338, -1486, -2125, -1512, 236, 1814, 1954, 861, -156, -386, -348, -647, -907, -510, 92, 59, -8, 1233, 2951, 2327, -1182, -4228, -3740, -530, 2409, 3098, 1396, -1249, -2658, -2055, -755, 207, 1202, 1924, 1006, -1211, -2392, -1533, 34, 1185, 1934, 1862, 249, -1995, -2678, -1094, 1029, 1819, 1299, 474, -421, -1623, -2493, -1952, -78, 1824, 2687, 2417, 1382, -87, -1592, -2453, -1888, 229, 2716, 3620, 1930, -1318, -3845, -3957, -1699, 1331, 3123, 2556, 148, -2312, -3013, -1373, 1494, 3553, 3454, 1516, -876, -2483, -2644, -1353, 513, 1723, 1965, 1867, 1519, 299, -1569, -2695, -2255, -825, 680, 1812, 2339, 2196, 1537, 427, -923, -1761, -1649, -1252, -986, -120, 1381, 1997, 1110, 2, -617, -1197, -1061, 757, 2360, 891, -2413, -3237, -353, 2877, 3281, 1039, -1972, -4185, -4227, -1411, 2382, 3533, 1129, -1222, -167, 2531, 2391, -1652, -5860, -6030, -1738, 3505, 5517, 3163, -729, -2421, -1233, 207, -200, -1358, -1222, -86, 493, 587, 1094, 1372, 381, -1041, -1459, -1026, -562, -9, 762, 1193, 989, 444, -418, -1554, -1891, -359, 1940, 2276, -209, -2801, -2218, 1382, 4647, 4826, 2118, -1365, -3660, -3996, -2785, -797, 1567, 3762, 4337, 2140, -1621, -3910, -3060, -480, 1372, 1811, 1828, 1738, 435, -2302, -3991, -1941, 2523, 4710, 2267, -1950, -3745, -2091, 1106, 3399, 3125, 600, -1648, -1666, -444, 85, -225, -599, -687, 73, 1854, 2791, 976, -2175, -3560, -2541, -647, 1271, 2864, 3043, 1497, -208, -1002, -2000, -3839, -4146, -519, 4816, 6624, 3195, -1891, -4849, -5118, -3330, 47, 3095, 3223, 790, -931, -241, 1016, 444, -1820, -3610, -3271, -1132, 1191, 2582, 3178, 3398, 2819, 661, -2710, -5329, -5076, -1625, 3000, 5939, 5677, 2695, -1552, -5219, -6147, -3530, 470, 2997, 3841, 3923, 2258, -1592, -4201, -2388, 1202, 1790, -102, -102, 2511, 3705, 907, -3270, -4322, -1300, 2169, 2570, 822, -96, -282, -1671, -2989, -1317, 2014, 2908, 1215, 224, 467, -247, -1810, -1863, 147, 2528, 3529, 2207, -897, -3349, -3294, -1631, 107, 1813, 2889, 1649, -1255, -2451, -840, 655, -28, -1065, -320, 1119, 932, -833, -1960, -1120, 577, 1323, 920, 433, 28, -1054, -2219, -1441, 1553, 4098, 3755, 877, -2712, -5471, -5899, -2905, 2416, 6744, 6969, 2518, -3760, -6987, -4572, 472, 2763, 1059, -1074, -709, 1374, 2980, 3056, 1739, -151, -1546, -2020, -1963, -1575, -530, 1162, 2701, 3004, 1458, -1320, -3384, -3080, -1036, 572, 1006, 1734, 3417, 3771, 566, -4145, -5777, -3216, 76, 1415, 1858, 2806, 3183, 1777, -319, -1536, -2093, -2724, -2611, -562, 2390, 3528, 1761, -1008, -2214, -1267, 344, 712, -673, -2181, -1604, 1039, 3193, 2812, 642, -1111, -1279, -286, 813, 1156, 422, -1013, -2157, -1880, 86, 2340, 2785, 1088, -768, -1217, -1138, -1888, -2686, -1659, 1263, 3903, 3990, 1279, -2075, -3383, -2195, -569, -72, 98, 1126, 2256, 1968, 443, -677, -590, -54, 43, -372, -1065, -1597, -958, 1193, 2999, 2278, -241, -1995, -2387, -2660, -2645, -970, 1743, 2985, 1785, -102, -543, 579, 1353, 50, -2483, -3559, -2078, 377, 2254, 3351, 2951, -114, -4391, -5917, -2911, 1962, 4913, 4605, 2035, -1095, -3190, -3304, -1753, 214, 1648, 2607, 3410, 3458, 1514, -2466, -6171, -6309, -1714, 4764, 8191, 6199, 1107, -3257, -5248, -4924, -2506, 676, 2221, 1707, 1342, 2064, 1942, -139, -2255, -2450, -1469, -1060, -1417, -1412, -124, 2524, 5480, 6288, 2639, -4423, -9833, -8886, -2218, 4941, 8200, 7211, 3823, -518, -4418, -5844, -4011, -695, 2064, 3939, 4465, 2103, -2466, -5226, -3648, -2, 2130, 1919, 640, -248, 303, 1862, 2140, -266, -3399, -4069, -1653, 1668, 3718, 3973, 2899, 1006, -1127, -2742, -3327, -2694, -803, 1507, 2353, 1205, 126, 391, 88, -2019, -3417, -1992, 339, 1431, 2188, 3086, 1961, -1866, -5301, -5509, -2809, 1418, 6182, 9344, 7780, 789, -7710, -11611, -8034, -397, 5054, 5859, 4426, 2793, 180, -3132, -4049, -1377, 1356, 816, -1208, -798, 2196, 4279, 3301, 613, -1606, -2903, -3620, -3167, -955, 1651, 2553, 1964, 1633, 1214, -964, -3507, -3064, -239, 901, -132, 447, 3152, 3149, -1497, -5159, -2821, 1684, 1908, -575, 20, 2563, 1707, -1193, -947, 958, -20, -1523, 921, 4023, 2026, -3067, -5172, -3288, -530, 1583, 3178, 3690, 2585, 502, -1552, -2930, -3079, -1711, 513, 2148, 2226, 1283, 681, 756, 299, -1543, -3528, -3634, -1510, 1612, 4342, 4873, 1543, -3873, -6307, -3660, 521, 2902, 3975, 3846, 752, -3885, -5322, -2326, 1393, 3141, 3463, 2800, 759, -1753, -3087, -2767, -1007, 1930, 4437, 3733, -679, -5047, -5005, -770, 3190, 3630, 1498, -620, -1490, -1028, 339, 1349, 740, -1121, -2546, -2099, 551, 3967, 5063, 2025, -2811, -5190, -3738, -547, 2058, 3114, 2477, 877, -297, -714, -1542, -2909, -2418, 1686, 6592, 6841, 860, -6514, -9091, -5353, 1209, 5822, 5819, 2243, -1199, -2007, -1350, -1490, -2083, -1236, 955, 2295, 1458, -601, -2122, -2380, -1875, -1078, 347, 2424, 3669, 2579, 15, -1673, -1792, -1623, -1671, -814, 1190, 2453, 1475, -558, -1507, -1172, -712, -218, 850, 1560, 514, -1325, -1476, 464, 2296, 2298, 955, -383, -1042, -1013, -367, 859, 2156, 2249, 277, -2545, -3760, -2507, -163, 1783, 2661, 1883, -352, -2269, -2531, -1782, -581, 1570, 3592, 2928, -172, -2486, -2747, -2399, -1578, 843, 3731, 4694, 3686, 2036, -268, -3273, -5188, -4279, -1015, 2545, 4000, 2085, -1330, -2576, -945, 569, 149, -984, -1922, -2924, -2892, -427, 2966, 4583, 4255, 3163, 995, -2445, -4894, -4091, -1168, 1071, 2059, 2987, 3386, 1574, -1596, -3139, -2451, -1568, -780, 1461, 4051, 3673, 353, -2173, -2340, -2463, -3497, -2541, 2074, 6676, 6554, 2159, -2365, -4951, -6114, -5312, -1326, 4128, 7008, 5512, 1543, -2240, -4521, -4650, -2407, 809, 2401, 1429, -236, -757, -803, -1619, -2147, -410, 2926, 4751, 3378, 419, -1723, -2714, -3345, -2781, 623, 5298, 6513, 2547, -2316, -3713, -2732, -2312, -1948, -48, 1897, 1782, 798, 984, 1288, -257, -2314, -1860, 803, 2109, 486, -1391, -795, 1023, 1255, 306, 795, 2342, 1668, -1422, -3015, -1479, 337, 835, 1580, 2131, -179, -4057, -4726, -1457, 1675, 2348, 1743, 940, 188, 88, 533, 510, 26, -397, -1350, -2563, -1539, 2228, 4581, 2141, -2371, -3947, -1993, 82, 210, -351, 228, 1823, 2899, 2447, 730, -1337, -2870, -3322, -2609, -939, 1198, 2666, 2297, 494, -1027, -1473, -1206, 18, 2278, 3338, 894, -3162, -4422, -1841, 1418, 2771, 2444, 1105, -1403, -4205, -4743, -1515, 3530, 6563, 5483, 1268, -3706, -7239, -7412, -3210, 3648, 8709, 8310, 3089, -2796, -5712, -5066, -2356, 662, 2457, 1961, -222, -1689, -851, 912, 1219, -47, -1113, -1043, -277, 570, 1043, 969, 1002, 1604, 1633, -34, -2036, -2124, -505, 778, 881, 484, 168, 219, 949, 1769, 1097, -1476, -3899, -3735, -928, 2434, 4532, 4942, 3622, 320, -3988, -6206, -3996, 523, 2921, 2433, 1909, 1724, -652, -4186, -4091, 218, 3483, 2652, 471, -391, -978, -2223, -2354, -39, 2883, 3457, 1050, -2130, -3513, -2602, -833, 367, 671, 519, 699, 1830, 3044, 1934, -2401, -6761, -6583, -1534, 3753, 5105, 3114, 1168, 732, 110, -2264, -4729, -4047, 91, 4294, 5697, 4473, 1511, -2903, -6710, -6318, -1501, 3205, 4053, 2206, 793, 543, 52, -1451, -3110, -3435, -1614, 1577, 3848, 3133, -59, -2620, -1846, 1729, 4997, 5284, 2215, -2519, -6153, -6280, -2703, 2057, 4931, 4923, 2940, -143, -3605, -5488, -3602, 1140, 4456, 3505, 546, -601, -399, -1964, -4191, -2257, 3638, 6449, 2330, -3407, -4000, 147, 3850, 3905, 831, -2789, -4075, -2009, 1666, 4338, 4209, 713, -4034, -5419, -1626, 2864, 2962, -61, -1339, 384, 2319, 2326, 742, -962, -1365, -274, 410, -1191, -3573, -2893, 1536, 5250, 4275, 433, -2127, -3083, -4157, -3996, -592, 3378, 3650, 967, -575, 186, 1042, 171, -2430, -5074, -4925, -1002, 3678, 5516, 4385, 2074, -611, -3007, -3980, -3510, -2037, 1025, 4691, 5170, 1449, -2066, -2417, -2066, -2732, -2237, -69, 1375, 2189, 3944, 4125, -335, -5833, -6163, -1530, 2937, 4804, 4997, 3755, 570, -3308, -5229, -3749, -123, 2709, 2974, 1755, 966, 399, -1408, -3784, -3812, -417, 3493, 4586, 3112, 1069, -1743, -5891, -7981, -3547, 5416, 10844, 7913, 88, -6230, -8297, -6662, -2210, 3199, 5941, 4423, 1719, 742, -291, -3174, -4390, -543, 4373, 3801, -1696, -5415, -3540, 1463, 5253, 5757, 3355, -567, -4401, -6438, -5261, -901, 4341, 7003, 5196, 400, -3938, -5710, -5233, -3180, 514, 4743, 6488, 4029, -474, -3368, -3506, -2497, -1867, -1440, -254, 1919, 4145, 5007, 3671, 484, -3070, -5073, -4666, -3029, -1727, -48, 3673, 7757, 7623, 1997, -4661, -7617, -6572, -3643, 62, 4121, 7375, 8201, 5366, -930, -7732, -10273, -6327, 840, 5542, 5481, 3078, 1325, 416, -852, -2389, -3156, -2908, -1871, 305, 3264, 4430, 1596, -2932, -4056, -823, 1651, -619, -4446, -3882, 1381, 5776, 5270, 1604, -1241, -2098, -2472, -2797, -1394, 2188, 5109, 4534, 1443, -1274, -2880, -4025, -3788, -994, 2757, 4477, 3112, -273, -3654, -4409, -1331, 2848, 3816, 917, -2390, -3048, -1060, 1687, 3006, 1498, -1786, -3237, -557, 3434, 3636, -271, -3207, -2226, -228, -3, 456, 3227, 5446, 3263, -1983, -5268, -4201, -1280, -40, -551, 112, 3032, 4988, 2586, -2536, -5234, -3406, -304, 615, 322, 1210, 2144, 797, -1095, -341, 1203, -942, -5547, -6390, -1657, 3587, 5334, 5224, 5143, 2828, -3133, -8338, -7853, -3082, 1792, 6073, 9445, 7850, -405, -9089, -11140, -7077, -1553, 3307, 6948, 7647, 4503, -708, -5205, -6922, -5092, -1000, 2800, 4910, 5404, 4114, 865, -3023, -5534, -5503, -2412, 2949, 6742, 4706, -1745, -5808, -3444, 2025, 4694, 2538, -1686, -3692, -1652, 1936, 3211, 1795, 415, 274, 227, -230, -596, -845, -588, 980, 2463, 1423, -633, 296, 3358, 3072, -1836, -5901, -4762, -529, 2117, 1564, -274, -859, 442, 1695, 346, -3214, -4793, -1132, 4829, 6498, 2172, -2427, -2065, 1025, 1166, -2342, -4789, -3070, 825, 3688, 4848, 4766, 3014, -434, -4059, -6268, -6159, -2801, 3315, 8106, 6847, 339, -4965, -4452, -504, 1476, 66, -1680, -1582, -922, -1277, -1432, 770, 4751, 7047, 4827, -1192, -7107, -8702, -4806, 1331, 4878, 4355, 2298, 814, -511, -1638, -1239, -50, -560, -2118, -1260, 2020, 3292, 382, -3184, -3005, 695, 3600, 2384, -1261, -2534, 27, 2187, 141, -3658, -4071, -504, 3085, 4011, 3112, 1781, 16, -2049, -3072, -2210, -622, -54, -578, -765, 273, 1836, 2418, 1033, -1767, -3741, -2549, 1494, 4819, 4178, 539, -2266, -2579, -2122, -2110, -1240, 1567, 4897, 6233, 4060, -1095, -6328, -8144, -5741, -1178, 3603, 7321, 7697, 3321, -2826, -5598, -3612, -55, 2002, 2253, 1517, 223, -1055, -1272, 33, 1784, 1946, -605, -4477, -6172, -2973, 3743, 8534, 6559, -1172, -8165, -8831, -3852, 1680, 4420, 5071, 5049, 3774, 414, -3694, -5942, -4857, -1110, 2939, 4608, 3036, 213, -1101, -570, -370, -1884, -3654, -3451, -1035, 2088, 4231, 3854, 481, -3439, -4058, -1102, 1296, 356, -1554, -1012, 1182, 1798, 432, -607, -770, -1487, -2109, -294, 2988, 3678, 955, -1293, -623, 723, 300, -730, -336, 656, 41, -2005, -2856, -834, 2809, 5336, 4848, 1384, -3105, -5729, -4723, -1121, 2311, 3970, 4087, 2583, -1005, -4579, -4440, -1018, 1146, 922, 1869, 4214, 3252, -1881, -5550, -3948, 578, 4372, 5681, 3507, -1321, -4853, -4051, -879, 757, 366, 349, 1497, 1989, 645, -1309, -2159, -1363, 833, 3220, 3293, 10, -3432, -3033, 145, 1503, 207, 289, 3203, 4218, -483, -6718, -7095, -1150, 4306, 4757, 2881, 2677, 3244, 1411, -2586, -5766, -6783, -5841, -2217, 3687, 7694, 6194, 1477, -1601, -2011, -1853, -2288, -3153, -3546, -1461, 3429, 7034, 5356, 368, -3254, -4887, -6392, -6413, -1942, 5359, 9231, 6005, -938, -5109, -4120, -1349, -511, -850, 654, 3890, 5191, 2391, -1950, -3775, -2653, -1389, -1155, -352, 1421, 2429, 2264, 1837, 369, -2468, -3322, -154, 2801, 1691, -178, 973, 1979, -905, -4331, -3234, 1282, 4546, 4412, 1453, -2891, -5949, -4945, -551, 3084, 3407, 2430, 2883, 3553, 1401, -2897, -5202, -3910, -1985, -1508, -158, 3640, 6116, 3796, -22, -864, -936, -3910, -6488, -3538, 2782, 6512, 5897, 2502, -2143, -5330, -4559, -1860, -969, -746, 2283, 6386, 6221, 1107, -3811, -4544, -2245, 57, 1252, 1494, 654, -690, -1028, -266, 97, 29, 843, 1651, 246, -2336, -2809, -1040, 189, 259, 975, 2355, 2352, 557, -1112, -1515, -1660, -2484, -2692, -233, 3947, 5574, 2417, -1926, -2949, -1709, -1815, -2438, -457, 2592, 2425, -618, -2149, -534, 1824, 2751, 2093, 537, -810, -927, -409, -1007, -2477, -1825, 2341, 6364, 5466, 271, -4143, -4954, -3444, -1116, 1510, 3116, 2740, 1633, 959, -259, -2505, -3862, -2810, -359, 1813, 2807, 1777, -1232, -3355, -1069, 4331, 6437, 1307, -6689, -9579, -5078, 1861, 5926, 6107, 3545, -1008, -5512, -6040, -1377, 4068, 5518, 3678, 1767, -159, -3212, -5223, -3658, -407, 1061, 1004, 1833, 3431, 3575, 1534, -1549, -4655, -6772, -5901, -1208, 4218, 6138, 4587, 3026, 2396, 362, -3327, -5471, -4173, -1120, 1612, 3739, 5014, 4044, 164, -4620, -6708, -4417, -34, 2851, 3525, 3391, 2096, -1381, -4734, -4800, -2968, -2094, -258, 5178, 10235, 8660, 766, -7967, -12885, -10905, -1717, 8701, 12482, 8845, 2606, -3713, -9042, -9494, -3349, 3739, 5437, 2664, 218, 34, 1136, 2086, 1491, -769, -2698, -2757, -1801, -768, 765, 2369, 2351, 566, -1184, -1653, -857, 522, 827, -1083, -3000, -1527, 2193, 3292, 520, -1855, -909, 719, -167, -2000, -1660, 31, 545, 603, 1589, 1162, -1946, -2714, 2618, 7893, 4864, -3869, -8434, -5329, 199, 3233, 3891, 3701, 2466, -286, -3406, -4847, -3365, 651, 4961, 6176, 2542, -3276, -5984, -3414, 921, 2523, 1498, 1011, 1601, 1078, -639, -1422, -1248, -1542, -1520, -290, 344, 148, 2116, 5083, 2724, -5041, -9190, -4759, 2734, 6960, 7269, 4469, -776, -5412, -6756, -5785, -3246, 2452, 9545, 11352, 4757, -4705, -9453, -7734, -2972, 1309, 3715, 4172, 3159, 1674, 691, 109, -1147, -3357, -4867, -3516, 851, 5715, 7759, 5441, 82, -5164, -7418, -5636, -937, 4070, 6499, 4809, 65, -4486, -5813, -3421, 808, 4713, 6941, 6194, 1321, -6266, -11434, -9127, -180, 8235, 9438, 3938, -2087, -4352, -3857, -2730, -731, 2149, 3517, 1974, -462, -1904, -3262, -5035, -4811, -654, 5309, 8650, 6800, 992, -4812, -6991, -5144, -1751, 980, 2841, 4059, 3711, 1110, -2071, -3049, -1376, 708, 1544, 1568, 1447, 1172, 1041, 1147, 391, -1580, -2607, -817, 2262, 3802, 3177, 1354, -1166, -3655, -4204, -1668, 2158, 3791, 1647, -2065, -3546, -1754, 406, 151, -1408, -1416, 273, 1428, 1302, 1261, 1694, 1014, -1704, -4783, -5451, -2720, 1548, 4456, 4785, 3497, 1722, -364, -2392, -3271, -2491, -606, 1561, 2804, 1575, -1737, -3878, -2526, 346, 1267, -184, -1828, -2293, -1768, -525, 1306, 2981, 3612, 3161, 1880, -649, -4134, -6018, -4101, -85, 2616, 3537, 4027, 3445, 712, -2539, -4309, -4922, -4268, -399, 5794, 8828, 5139, -1993, -6856, -7575, -5443, -1085, 5094, 10065, 9671, 3642, -3440, -7281, -7858, -6761, -3312, 2970, 8082, 7263, 2403, -549, -936, -2740, -5488, -4552, -106, 2946, 3341, 3673, 3626, 684, -3760, -5278, -2396, 2364, 6091, 7366, 5734, 1358, -4565, -9188, -8778, -2133, 6650, 10905, 7778, 703, -4882, -6743, -5831, -2895, 2000, 6987, 8709, 5852, -143, -7212, -12240, -10484, -681, 10529, 14349, 8946, -645, -8818, -11914, -8311, -392, 5939, 6866, 4081, 1206, -757, -2630, -3992, -3613, -1958, -578, 511, 2222, 3737, 3387, 1421, -929, -3583, -5862, -4836, 928, 7683, 9763, 5528, -1924, -8336, -10667, -7580, -476, 6248, 8467, 6183, 2248, -1976, -6463, -8971, -6409, 8, 5257, 6379, 4357, 912, -2789, -4888, -3712, 29, 3609, 4600, 2730, 163, -873, -1249, -3368, -5921, -4309, 2086, 7624, 7357, 2372, -2912, -5129, -3645, -1108, -1004, -2539, -1301, 3331, 6569, 5510, 2297, -973, -4314, -6277, -4358, 486, 4432, 5560, 4539, 1867, -2009, -4892, -4328, -813, 2352, 2561, 318, -1973, -2857, -2712, -1986, -116, 2913, 5529, 6345, 5070, 864, -6422, -12071, -9137, 1790, 11028, 11055, 4160, -3110, -7064, -6555, -1767, 4044, 5984, 2774, -2053, -4820, -5095, -4081, -2043, 1217, 4589, 6011, 4616, 1364, -2388, -5693, -7311, -5825, -1344, 3843, 7079, 7248, 4555, -374, -5961, -8962, -6399, 799, 7283, 7938, 2784, -3656, -6812, -4848, 930, 6344, 7057, 3052, -1759, -4894, -6384, -4873, 1186, 8030, 8993, 3290, -3103, -4946, -1844, 2981, 4621, 522, -5259, -6251, -2276, 1467, 2609, 2537, 1541, -557, -1897, -1661, -1740, -2238, -883, 1310, 622, -1995, -1224, 3958, 8113, 6447, -96, -6344, -7297, -2750, 2046, 2756, 1290, 1324, 2099, 1340, 106, -102, -565, -1824, -1933, -817, -947, -2184, -1620, 942, 2658, 2543, 1999, 1243, -656, -2870, -3105, -728, 2211, 3122, 1422, -1052, -2042, -1188, -190, -531, -1301, -189, 2921, 4836, 2832, -1958, -6267, -7649, -4773, 1841, 7891, 8020, 2369, -3222, -4832, -4278, -3752, -1338, 4484, 9399, 7656, 529, -5091, -5783, -3686, -712, 2762, 4568, 2739, -478, -2228, -3802, -6433, -6454, -715, 6598, 8318, 3417, -2676, -5384, -4746, -2407, 1311, 5807, 8224, 5831, -217, -5400, -6055, -2193, 3117, 6044, 4514, -57, -3703, -3716, -1424, -118, -438, 246, 3123, 4909, 2057, -3387, -5679, -3065, 65, -63, -1161, 1088, 5734, 7113, 2491, -4475, -8539, -7566, -1962, 5881, 10654, 7957, 249, -5946, -8372, -8865, -6807, -336, 7045, 8622, 3415, -2828, -5643, -5825, -4952, -1996, 3304, 7662, 7985, 4865, 27, -5439, -8289, -4652, 3179, 7966, 6952, 3441, -388, -4503, -6685, -4970, -2042, -831, 439, 3706, 6320, 5167, 1039, -3689, -7475, -8285, -4018, 4265, 11713, 13022, 6261, -5026, -13215, -12435, -4274, 3850, 6649, 5549, 4599, 4193, 1347, -4430, -8567, -6612, -547, 3211, 2030, -579, -1479, -1544, -1319, 669, 3171, 2467, -695, -1432, 900, 2035, 892, 882, 2871, 3529, 1021, -2805, -5690, -6431, -3692, 2676, 8802, 8897, 1886, -6547, -10234, -8335, -3426, 2608, 8021, 9750, 5938, -1351, -7320, -7624, -1563, 6101, 8363, 3138, -4538, -8381, -6268, -38, 6251, 8165, 4764, -15, -2607, -3930, -5547, -5498, -1680, 3801, 6907, 5917, 1609, -4142, -8450, -8480, -4039, 1843, 5475, 5290, 2585, 98, -407, 585, 1404, 799, -1402, -3680, -3067, 1396, 5805, 5491, 1356, -2124, -3915, -6044, -7665, -5499, 375, 6105, 8603, 7022, 1754, -4774, -8345, -6634, -1353, 4172, 7670, 8080, 5270, 310, -4686, -7134, -5534, -1833, -121, -732, 847, 5935, 8476, 3669, -4419, -8775, -7815, -3760, 1518, 5422, 4931, 875, -2392, -2385, 18, 3156, 5065, 3554, -1167, -5820, -7279, -4493, 1760, 7853, 8364, 2224, -4467, -5676, -2871, -1416, -2403, -2223, 1230, 5616, 7240, 4849, -15, -5059, -8473, -8434, -3474, 5077, 12275, 13271, 7439, -2128, -11382, -16028, -12300, -775, 11402, 15562, 9633, -326, -6941, -8024, -5890, -2867, 270, 3019, 4629, 4036, 104, -5650, -7761, -2886, 4493, 7850, 6822, 3870, -1354, -7401, -8426, -3132, 2057, 3716, 5209, 6922, 4221, -2904, -8681, -9609, -5470, 3317, 11849, 11317, 504, -10452, -12414, -5919, 4015, 12971, 16098, 10351, -998, -10816, -14187, -10011, -508, 8594, 11438, 7333, 239, -5755, -7645, -3783, 3057, 6477, 3843, -662, -2473, -1717, -510, 339, 884, 1572, 2841, 3357, 1070, -2720, -4364, -3464, -2538, -1350, 2329, 6687, 6752, 1517, -4762, -8148, -8013, -5019, 292, 6247, 9535, 7581, 1225, -5577, -8773, -7186, -3641, -2244, -2562, 622, 7757, 10262, 3042, -5789, -7151, -4379, -3935, -3101, 1705, 5162, 2333, -2297, -3179, -1736, -1177, -1720, -2761, -2975, 187, 5393, 6073, -367, -7037, -6143, 1163, 7033, 5805, -1179, -7294, -6821, -790, 4442, 4766, 1922, -350, -302, 1534, 2789, 1073, -2241, -3065, -1028, 338, 807, 3315, 6083, 3958, -2031, -5565, -4900, -3187, -930, 3358, 7284, 6825, 2533, -1698, -3739, -3630, -1577, 1593, 3805, 3590, 1823, 581, 756, 1514, 1747, 1077, -516, -2799, -4564, -3992, -437, 4531, 7973, 7461, 2949, -2865, -6735, -7393, -5306, -1153, 3805, 7054, 6599, 2847, -2119, -5625, -4940, 45, 4598, 3441, -2345, -6221, -3817, 3066, 8743, 7787, -368, -9250, -11171, -5737, 1206, 5254, 5142, 619, -5278, -6480, -2040, 1615, 751, -813, 82, 1287, 1168, 913, 155, -2453, -5015, -4944, -3549, -2717, -297, 5741, 11322, 9780, 686, -8700, -11222, -6551, 486, 5687, 7617, 6024, 1396, -3938, -6580, -4885, -642, 2523, 2927, 2626, 4041, 5627, 4044, 28, -2266, -1517, -233, -15, -220, -120, 1024, 3282, 3549, -1149, -6922, -6843, -1442, 2933, 4522, 5789, 5877, 2683, -1507, -4143, -6561, -8226, -4438, 4990, 12367, 11578, 4578, -3384, -9033, -10857, -8611, -3684, 2080, 6869, 8339, 5680, 1706, -502, -1572, -3331, -5068, -5330, -3986, -354, 6114, 11543, 9618, -12, -9942, -12946, -8197, 179, 7155, 9655, 8018, 4596, 256, -5797, -11840, -12347, -4242, 7039, 12173, 8705, 2624, -1028, -3195, -5431, -6257, -4870, -2739, -248, 3292, 6384, 6488, 3481, -1049, -5694, -8307, -6545, -1224, 3823, 6024, 5408, 2023, -4087, -9662, -9165, -1426, 7624, 11769, 10983, 7699, 1324, -7743, -13269, -9900, -1439, 4306, 5709, 6407, 7492, 6374, 1662, -4641, -9042, -9162, -5356, -170, 4231, 7368, 8891, 7547, 2926, -2899, -6775, -7167, -4902, -1702, 1509, 4625, 6836, 6186, 1836, -4147, -8749, -10426, -8233, -1716, 5929, 8703, 5136, 593, -739, -1070, -3374, -6052, -6233, -3731, 382, 4991, 7484, 5081, -1078, -5901, -5615, -1733, 1007, 218, -1446, 15, 4160, 5983, 2276, -4015, -7410, -6310, -3667, -2080, -827, 1648, 4256, 4136, 845, -2299, -2438, -1003, -799, -1146, 191, 1991, 1555, 126, 963, 3482, 4410, 3042, 917, -1559, -4137, -4570, -1156, 3967, 6839, 5986, 2796, -1109, -4285, -4530, -1204, 2269, 2456, 1226, 2031, 3125, 937, -2481, -2713, -1033, -1764, -4030, -3276, 672, 3377, 2816, 1392, 840, -340, -2939, -4258, -1937, 1991, 3720, 2466, 150, -1803, -3015, -2973, -1273, 1484, 3482, 2628, -860, -3156, -1037, 3192, 4856, 3743, 2795, 1866, -1226, -5019, -5681, -2624, 1443, 4030, 3688, 480, -2655, -2520, -80, 1357, 1316, 1388, 1131, -856, -3274, -3356, -789, 2036, 2761, 1004, -1441, -2385, -1877, -1792, -2353, -1640, 740, 2653, 2699, 1282, -1432, -4923, -6346, -3193, 2656, 6698, 6564, 3094, -1064, -2809, -1297, 661, 825, 1163, 3672, 5975, 5295, 2924, 1018, -634, -2046, -2128, -1565, -1535, -228, 3783, 6598, 3505, -3362, -7438, -6088, -2156, 1187, 3404, 5090, 6147, 5664, 2917, -1427, -5141, -5970, -3659, -264, 1821, 2200, 2304, 2763, 1973, -1680, -6788, -9563, -7685, -2429, 3255, 7439, 9033, 6411, -1079, -9992, -14109, -10456, -2269, 4998, 8475, 7936, 4184, -809, -4324, -5256, -4817, -4050, -2406, 195, 1845, 1200, 59, 748, 1938, 366, -3853, -7026, -6710, -3679, 216, 3265, 4041, 2685, 1017, 237, 131, 471, 891, 253, -1249, -1083, 1686, 3816, 2225, -1406, -3027, -1241, 1907, 3559, 2614, 771, 454, 968, -998, -5764, -8577, -5324, 2142, 8303, 9544, 6060, 191, -5406, -8622, -8111, -3739, 2378, 6249, 5430, 1880, -453, -578, -872, -2794, -4569, -3831, -790, 2227, 3315, 2148, -415, -2788, -3462, -2450, -1322, -867, 129, 2478, 4223, 2818, -851, -3013, -1849, 425, 1191, 918, 1441, 2472, 2145, 276, -1122, -580, 1241, 2845, 3176, 1463, -2178, -5252, -4372, 443, 5163, 6569, 5216, 2936, 548, -1085, -1002, 93, 626, 774, 1835, 3515, 4096, 2828, 557, -1381, -2087, -1737, -1465, -1756, -1536, 126, 2434, 3907, 3821, 2165, -226, -1688, -1631, -1474, -1761, -502, 3095, 6053, 5511, 2350, -1277, -4638, -6783, -5965, -2633, 60, 228, -693, -630, 294, 280, -1784, -4797, -6281, -5049, -2521, -751, 15, 804, 1945, 2839, 2845, 1570, -800, -2873, -2941, -1006, 1079, 1650, 671, -486, -250, 1260, 1596, -1141, -5041, -6263, -3897, -477, 1944, 3460, 4157, 3269, 1126, -419, -698, -1230, -2600, -2633, -75, 2281, 1304, -1685, -3022, -1631, 934, 3125, 3714, 1897, -1041, -2419, -1585, -442, -95, 539, 2187, 3441, 2642, 278, -1573, -1719, -856, -294, -487, -845, -405, 1273, 3458, 4677, 4325, 3418, 3014, 2415, 254, -2663, -3414, -722, 2790, 3533, 1135, -1734, -3009, -3028, -2875, -2588, -1561, 303, 2568, 4811, 6403, 6130, 3130, -1487, -4938, -5391, -3717, -1909, -563, 1121, 3450, 5483, 5905, 4043, 564, -2640, -3958, -3300, -1208, 2023, 5077, 5279, 1715, -2719, -4499, -3435, -1756, -675, 255, 1321, 1926, 1582, 756, 368, 501, 210, -797, -1129, 358, 2556, 3666, 3657, 3151, 1335, -2519, -6489, -7563, -5156, -1234, 2308, 4780, 5745, 4609, 1470, -2258, -4600, -4655, -3321, -2032, -974, 747, 3057, 3984, 1728, -2659, -6002, -6536, -5324, -3739, -1357, 2391, 5887, 6460, 3522, -813, -4118, -5485, -5092, -3507, -1909, -1497, -1963, -1825, -724, 36, -483, -1777, -2937, -3379, -2715, -1196, 79, 408, 306, 426, 529, 147, -630, -1479, -2211, -2596, -2399, -1780, -1192, -797, -275, 651, 1668, 2031, 1340, 55, -924, -1125, -782, -334, 115, 652, 1091, 984, 158, -988, -1819, -1905, -1095, 449, 2080, 2883, 2477, 1359, 206, -867, -2032, -2950, -2717, -827, 1897, 3679, 3421, 1727, -54, -1402, -2486, -2916, -1786, 954, 4038, 5938, 5873, 3937, 951, -1795, -3246, -3259, -2460, -1426, -65, 2040, 4494, 5701, 4369, 1210, -1798, -3629, -4495, -4323, -2588, 340, 3112, 4732, 4933, 3601, 928, -2038, -3897, -3907, -2323, -97, 1699, 2625, 3027, 3241, 2913, 1619, -168, -1297, -1123, -79, 940, 1469, 1622, 1636, 1553, 1339, 1063, 824, 664, 660, 892, 1212, 1262, 973, 807, 1204, 1972, 2561, 2790, 2942, 3201, 3330, 2969, 2064, 958, 150, -49, 346, 1080, 1775, 2093, 2020, 1837, 1600, 984, 6, -641, -504, 22, 495, 1006, 1516, 1577, 1194, 937, 850, 271, -965, -2115, -2614, -2760, -3006, -3209, -2959, -2230, -1332, -531, -94, -353, -1203, -1965, -2228, -2328, -2584, -2721, -2467, -1966, -1306, -411, 430, 736, 539, 249, -121, -912, -2050, -2900, -2892, -2038, -870, -44, 116, -184, -482, -512, -406, -459, -786, -1212, -1531, -1753, -1907, -1688, -734, 666, 1724, 2092, 2037, 1539, 170, -1859, -3369, -3414, -2240, -737, 495, 1228, 1311, 825, 159, -508, -1440, -2505, -2667, -1223, 928, 2255, 2379, 1968, 1387, 543, -310, -539, 160, 1428, 2519, 2806, 2258, 1463, 953, 613, 69, -406, 38, 1646, 3388, 4022, 3386, 2156, 820, -404, -1092, -890, 16, 1136, 2063, 2484, 2335, 2114, 2444, 3180, 3451, 2657, 1132, -145, -322, 702, 2219, 3391, 3904, 3834, 3203, 2026, 595, -664, -1444, -1528, -876, 158, 1005, 1353, 1177, 447, -767, -2022, -2781, -2972, -2908, -2701, -2154, -1324, -763, -943, -1672, -2374, -2671, -2454, -1740, -835, -338, -535, -960, -895, -226, 476, 661, 411, 295, 659, 1266, 1788, 2352, 3239, 4286, 5043, 5285, 4967, 4030, 2768, 1919, 1890, 2277, 2567, 2848, 3401, 4018, 4189, 3689, 2719, 1688, 1088, 1405, 2816, 4759, 6022, 5689, 4212, 3145, 3442, 4397, 4583, 3540, 2092, 1348, 1792, 3014, 4106, 4497, 4407, 4277, 4041, 3396, 2402, 1366, 538, 244, 759, 1741, 2307, 1936, 813, -644, -2058, -2905, -2710, -1593, -281, 526, 666, 403, -98, -1047, -2709, -4792, -6366, -6575, -5539, -4317, -3933, -4508, -5489, -6468, -7477, -8574, -9535, -10038, -9903, -9163, -8102, -7296, -7313, -8188, -9254, -9724, -9465, -9118, -9420, -10408, -11279, -11066, -9630, -7932, -7085, -7258, -7768, -8144, -8606, -9418, -10266, -10611, -10394, -9986, -9622, -9339, -9324, -9798, -10565, -11132, -11190, -10694, -9754, -8847, -8622, -9094, -9466, -9151, -8515, -8256, -8413, -8379, -7718, -6674, -5870, -5600, -5503, -4995, -4002, -3127, -2988, -3475, -3920, -3937, -3734, -3504, -3107, -2571, -2360, -2712, -3131, -3019, -2551, -2492, -3183, -4009, -4024, -2991, -1679, -1036, -1211, -1512, -1430, -1419, -2318, -4002, -5157, -4660, -2801, -693, 1181, 3326, 6256, 9671, 12744, 14931, 16314, 17304, 18224, 19105, 19751, 20053, 20197, 20573, 21276, 21890, 21855, 21077, 20023, 19265, 19108, 19568, 20489, 21481, 22026, 21888, 21398, 21127, 21335, 21745, 21955, 21943, 22014, 22229, 22231, 21886, 21769, 22509, 23783, 24579, 24501, 24165, 24124, 23938, 22726, 20382, 17623, 15107, 12997, 11286, 9959, 8885, 7994, 7409, 7030, 6401, 5361, 4360, 3775, 3450, 3132, 2820, 2597, 2522, 2634, 2674, 2186, 1197, 337, -37, -301, -932, -1985, -3313, -4801, -6221, -7296, -8014, -8639, -9440, -10558, -11995, -13543, -14800, -15430, -15453, -15277, -15387, -15791, -15823, -14760, -12670, -10413, -8805, -8084, -8075, -8431, -8781, -8990, -9256, -9739, -10252, -10512, -10428, -10072, -9628, -9446, -9742, -10293, -10663, -10698, -10518, -10244, -9919, -9503, -8800, -7625, -6192, -5033, -4452, -4231, -3939, -3327, -2426, -1378, -202, 1223, 2875, 4371, 5227, 5280, 4735, 3951, 3261, 2816, 2417, 1724, 788, 187, 415, 1268, 2054, 2339, 2232, 2049, 1981, 2148, 2577, 3014, 3041, 2586, 2073, 1878, 1858, 1671, 1320, 986, 505, -448, -1662, -2448, -2579, -2677, -3424, -4813, -6380, -7825, -9119, -10196, -10942, -11434, -11993, -12878, -14082, -15336, -16201, -16324, -15844, -15364, -15322, -15544, -15597, -15292, -14750, -14308, -14351, -14945, -15673, -16100, -16229, -16243, -16009, -15303, -14339, -13637, -13363, -13131, -12637, -12050, -11642, -11413, -11294, -11251, -10938, -9828, -7981, -6112, -4735, -3738, -2890, -2144, -1438, -666, 138, 939, 1774, 2548, 3059, 3350, 3687, 4146, 4577, 4883, 5082, 5209, 5365, 5674, 6024, 6082, 5798, 5631, 6014, 6759, 7329, 7627, 7921, 8175, 8178, 8234, 8751, 9278, 9032, 8219, 7681, 7465, 6946, 6115, 5636, 5756, 6063, 6193, 6061, 5558, 4611, 3514, 2732, 2315, 1887, 1271, 751, 581, 606, 673, 1051, 1971, 2898, 2930, 1978, 860, 152, -263, -508, -618, -1011, -1794, -1954, -730, 689, 555, -895, -2103, -2787, -4128, -6621, -9243, -10656, -10357, -8660, -5999, -2416, 1959, 6029, 8345, 8642, 7617, 5385, 1838, -1942, -4656, -6506, -7993, -8306, -7001, -5531, -5008, -4464, -3056, -1588, -624, 367, 1318, 1473, 1045, 922, 1392, 2713, 5443, 8812, 10794, 10861, 10687, 11541, 13063, 14743, 16628, 18532, 20048, 21059, 21423, 20827, 19519, 18136, 16605, 14302, 11313, 8490, 6462, 5408, 5362, 6039, 6759, 7170, 7596, 8366, 9295, 10010, 10294, 9920, 8644, 6692, 4899, 3942, 3562, 2900, 1558, -114, -1704, -3175, -4496, -5343, -5572, -5691, -6425, -7841, -9222, -9953, -10286, -10992, -12387, -14020, -15282, -15962, -16090, -15724, -15032, -14240, -13354, -12198, -10816, -9501, -8547, -8178, -8385, -8687, -8473, -7820, -7418, -7548, -7747, -7620, -7355, -7235, -7202, -7112, -7036, -7020, -6886, -6486, -5986, -5594, -5170, -4391, -3237, -2031, -1038, -300, 157, 286, 311, 633, 1253, 1686, 1784, 2080, 2875, 3660, 3964, 4029, 4084, 3773, 2888, 1876, 1130, 425, -535, -1588, -2417, -2947, -3159, -2906, -2250, -1694, -1705, -2171, -2635, -2881, -2947, -2902, -2996, -3544, -4313, -4649, -4543, -4933, -6514, -8924, -11360, -13375, -14904, -16056, -17090, -18124, -18700, -17786, -14370, -8449, -1591, 4008, 7590, 10325, 13372, 16370, 18361, 19168, 19076, 18290, 17329, 17055, 17695, 18591, 19158, 19372, 19196, 18353, 16836, 15216, 14127, 13702, 13617, 13550, 13541, 13865, 14698, 16032, 17806, 19697, 21031, 21442, 21494, 22081, 23332, 24813, 26416, 28246, 29897, 30725, 30682, 30188, 29444, 28221, 26068, 22588, 17868, 12868, 8874, 6382, 4802, 3385, 2075, 1295, 1099, 956, 449, -110, -110, 429, 835, 711, 567, 1209, 2833, 4909, 6741, 7873, 8130, 7560, 6403, 4947, 3346, 1646, -110, -1862, -3605, -5356, -7025, -8510, -9916, -11516, -13410, -15313, -16695, -17099, -16411, -14898, -12958, -10848, -8679, -6501, -4258, -1880, 357, 1894, 2540, 2762, 3042, 3271, 3079, 2448, 1680, 957, 221, -595, -1411, -2099, -2675, -3283, -3900, -4265, -4265, -4186, -4286, -4325, -3889, -3011, -2064, -1153, -18, 1504, 3220, 4798, 6124, 7370, 8712, 9986, 10819, 11075, 10932, 10455, 9462, 7912, 6123, 4337, 2390, 69, -2350, -4335, -5751, -6942, -8082, -8862, -8976, -8620, -8206, -7838, -7343, -6755, -6452, -6744, -7481, -8168, -8508, -8657, -8945, -9430, -9901, -10242, -10612, -11196, -12008, -12942, -14012, -15341, -16987, -18798, -20494, -21947, -23212, -24314, -25131, -25600, -25827, -25903, -25742, -25234, -24324, -22937, -21041, -18821, -16588, -14494, -12595, -11104, -10288, -10103, -10147, -10068, -9843, -9612, -9532, -9772, -10364, -10798, -10237, -8446, -6304, -4997, -4922, -5583, -6235, -6347, -5692, -4486, -3299, -2446, -1461, 316, 2714, 4827, 6243, 7443, 8820, 10018, 10570, 10570, 10411, 10207, 9720, 8707, 7311, 6049, 5227, 4504, 3376, 1906, 527, -594, -1433, -1690, -1076, 87, 1008, 1050, 176, -948, -1450, -1220, -1113, -1801, -2875, -3596, -3906, -4161, -4389, -4377, -4073, -3532, -2868, -2554, -3283, -5180, -7400, -8888, -9461, -9831, -10577, -11411, -11647, -11076, -10042, -8804, -7312, -5633, -4095, -2845, -1685, -557, 246, 557, 638, 849, 1266, 1655, 1704, 1371, 1075, 1214, 1536, 1523, 1296, 1495, 2258, 3062, 3584, 4065, 4678, 5124, 5081, 4687, 4359, 4279, 4343, 4478, 4789, 5358, 6136, 7084, 8244, 9515, 10505, 10759, 10158, 8990, 7642, 6300, 4949, 3581, 2281, 1139, 252, -247, -303, -80, 209, 499, 692, 538, -37, -703, -1177, -1599, -2154, -2668, -2865, -2764, -2628, -2722, -3146, -3701, -4045, -4165, -4424, -4936, -5349, -5410, -5327, -5393, -5663, -6106, -6705, -7388, -8070, -8694, -9106, -9162, -8945, -8533, -7643, -6072, -4367, -3389, -3223, -3129, -2639, -2136, -2157, -2558, -2669, -2144, -1282, -522, 130, 910, 1726, 2096, 1797, 1338, 1490, 2346, 3160, 3334, 3202, 3490, 4296, 5115, 5663, 6087, 6395, 6317, 5891, 5775, 6521, 7721, 8263, 7685, 6925, 7136, 8073, 8564, 8315, 8097, 8215, 8146, 7705, 7278, 6863, 6067, 5076, 4488, 4167, 3316, 1843, 638, 25, -1073, -3624, -6949, -9568, -10822, -10773, -9355, -6522, -2361, 3338, 10604, 18132, 24000, 27698, 30156, 31766, 31830, 30061, 27404, 25024, 23342, 22318, 22050, 22575, 23343, 23505, 22802, 21816, 21051, 20194, 18649, 16482, 14521, 13494, 13515, 14353, 15792, 17572, 19255, 20432, 21025, 21301, 21595, 21988, 22338, 22620, 23073, 23866, 24693, 24930, 24215, 22562, 20030, 16450, 11698, 6110, 470, -4446, -8278, -10974, -12523, -12948, -12569, -11857, -10967, -9874, -8848, -8340, -8434, -8880, -9454, -9830, -9552, -8668, -7918, -7766, -7910, -8014, -8230, -8672, -9161, -9719, -10627, -11860, -12979, -13703, -14152, -14586, -15179, -16018, -17044, -17991, -18534, -18514, -17897, -16511, -14107, -10741, -6919, -3184, 294, 3598, 6651, 9068, 10389, 10496, 9838, 9141, 8753, 8331, 7371, 6029, 5018, 4581, 4076, 2968, 1737, 1201, 1299, 1244, 740, 349, 545, 1049, 1365, 1506, 1755, 2083, 2293, 2491, 2940, 3638, 4374, 4995, 5426, 5702, 6003, 6332, 6296, 5557, 4221, 2467, 224, -2437, -5066, -7405, -9701, -12095, -14169, -15506, -16383, -17353, -18338, -18714, -18295, -17651, -17284, -17084, -16771, -16383, -16095, -15976, -15967, -15938, -15834, -15923, -16543, -17517, -18243, -18506, -18722, -19247, -19935, -20504, -20933, -21287, -21478, -21475, -21505, -21857, -22422, -22784, -22708, -22309, -21716, -20789, -19303, -17286, -15063, -12977, -11042, -9003, -6835, -4876, -3342, -1975, -531, 666, 1169, 1121, 1099, 1248, 1141, 610, 141, 102, 157, -35, -197, 14, 390, 717, 1329, 2571, 4172, 5536, 6256, 6285, 6038, 6182, 6915, 7697, 8013, 8089, 8405, 8928, 9266, 9349, 9509, 9885, 10194, 10145, 9714, 8878, 7538, 5824, 4042, 2307, 703, -414, -921, -1360, -2268, -3409, -4248, -4617, -4563, -4230, -4138, -4750, -5673, -6046, -5714, -5308, -5337, -5818, -6523, -7113, -7363, -7515, -8063, -9022, -9833, -10102, -10030, -9935, -9785, -9454, -9159, -9170, -9273, -8960, -8221, -7645, -7607, -7734, -7444, -6647, -5692, -4758, -3672, -2342, -1040, -48, 828, 2011, 3416, 4478, 4979, 5312, 5762, 6127, 6262, 6342, 6441, 6408, 6288, 6367, 6764, 7348, 7904, 8181, 8091, 7995, 8320, 8861, 9007, 8677, 8434, 8562, 8688, 8543, 8485, 8853, 9248, 9057, 8468, 8253, 8561, 8648, 8005, 7110, 6638, 6427, 5789, 4612, 3526, 2920, 2405, 1496, 388, -342, -587, -835, -1448, -2076, -2056, -1355, -727, -758, -1140, -1201, -876, -654, -722, -767, -623, -617, -975, -1350, -1341, -1184, -1416, -2020, -2426, -2317, -1979, -1808, -1856, -1920, -1877, -1839, -1986, -2258, -2377, -2252, -2095, -1974, -1612, -813, 246, 1289, 2177, 2801, 3090, 3222, 3495, 3919, 4207, 4199, 4060, 4027, 4143, 4299, 4399, 4409, 4313, 4104, 3835, 3630, 3630, 3913, 4374, 4728, 4763, 4609, 4600, 4897, 5358, 5729, 5850, 5647, 5171, 4677, 4530, 4874, 5436, 5729, 5464, 4752, 4032, 3762, 3942, 3962, 3185, 1838, 956, 1156, 1752, 1581, 580, -74, 442, 1552, 2134, 1876, 1272, 768, 411, 79, -317, -777, -1223, -1680, -2288, -2965, -3281, -2954, -2270, -1827, -1966, -2573, -3261, -3644, -3607, -3436, -3539, -3904, -4031, -3634, -3132, -3008, -2913, -2059, -513, 635, 705, 343, 464, 787, 277, -1131, -2208, -2058, -1289, -1042, -1440, -1619, -1045, -59, 833, 1605, 2301, 2571, 2083, 1160, 665, 1179, 2239, 2531, 1200, -1097, -3024, -4441, -6496, -9745, -13097, -14950, -14614, -12329, -8506, -3323, 3233, 10922, 18782, 25318, 29465, 31332, 31770, 31408, 30251, 28108, 25161, 22104, 19749, 18610, 18853, 20219, 21778, 22425, 22096, 21670, 21227, 19665, 16786, 14238, 13263, 13069, 12497, 11952, 12521, 14240, 16158, 17336, 17341, 16287, 14815, 13629, 12930, 12424, 11871, 11390, 11115, 10866, 10277, 9075, 7022, 3965, 95, -4103, -8369, -12702, -16818, -20065, -22064, -22939, -22820, -21627, -19533, -17222, -15342, -13943, -12765, -11844, -11451, -11500, -11508, -11329, -11414, -11923, -12131, -11436, -10544, -10567, -11249, -11278, -10438, -10041, -10958, -12377, -13012, -12707, -12314, -12332, -12206, -11130, -9289, -7770, -7049, -6247, -4356, -1696, 585, 2087, 3510, 5476, 7741, 9768, 11536, 13306, 14922, 15860, 15801, 14836, 13335, 11767, 10307, 8559, 6238, 3989, 2808, 2761, 3070, 3270, 3508, 3913, 4350, 4647, 4640, 4231, 3610, 3095, 2694, 2197, 1717, 1652, 1981, 2084, 1536, 693, 26, -731, -2172, -4222, -6281, -8087, -9801, -11440, -12859, -14178, -15588, -16959, -18001, -18730, -19397, -20113, -20708, -20948, -20770, -20303, -19639, -18749, -17690, -16710, -15936, -15098, -13898, -12578, -11764, -11707, -12020, -12233, -12367, -12686, -13156, -13460, -13515, -13609, -13931, -14249, -14229, -13862, -13418, -13040, -12608, -11978, -11187, -10316, -9217, -7687, -5854, -4084, -2426, -601, 1387, 3099, 4278, 5162, 5992, 6666, 7054, 7229, 7210, 6836, 6080, 5209, 4430, 3606, 2548, 1424, 550, -123, -932, -1905, -2638, -2802, -2507, -2103, -1764, -1289, -433, 502, 861, 674, 773, 1481, 2095, 2161, 2201, 2581, 2784, 2514, 2454, 3100, 3715, 3241, 1679, -148, -1838, -3636, -5597, -7296, -8499, -9394, -10036, -10167, -9705, -8901, -7993, -7122, -6450, -5995, -5568, -5059, -4522, -3887, -2997, -1957, -1059, -357, 309, 892, 1119, 995, 874, 869, 547, -373, -1365, -1597, -1022, -376, -139, 8, 512, 1251, 1836, 2197, 2402, 2212, 1412, 448, 179, 941, 2279, 3604, 4800, 6123, 7700, 9239, 10242, 10491, 10221, 9713, 8907, 7612, 6016, 4691, 3954, 3510, 2919, 2225, 1814, 1746, 1606, 1045, 189, -539, -855, -799, -589, -338, 31, 628, 1445, 2402, 3418, 4324, 4816, 4744, 4478, 4589, 4986, 4880, 4002, 3226, 3374, 3975, 4029, 3550, 3392, 3723, 3692, 2752, 1503, 749, 346, -405, -1548, -2365, -2320, -1611, -823, -286, 276, 1421, 3103, 4488, 4982, 4968, 4970, 4747, 3922, 2919, 2416, 2253, 1725, 792, 235, 503, 974, 738, -149, -795, -846, -1049, -2047, -3283, -3798, -3665, -3679, -3807, -3032, -1003, 1059, 1764, 1300, 1045, 1652, 2383, 2441, 2146, 2263, 2718, 2747, 2191, 1892, 2503, 3429, 3479, 2417, 1167, 438, -158, -1224, -2526, -3435, -3916, -4361, -4725, -4516, -3580, -2371, -1372, -571, 308, 1176, 1489, 1015, 312, 14, -118, -747, -1696, -1988, -1233, -268, -11, -278, -245, 211, 275, -661, -2123, -3065, -3001, -2385, -1982, -1996, -1894, -1114, 110, 929, 874, 362, 25, -101, -324, -493, -94, 832, 1634, 2098, 2777, 3914, 4836, 4876, 4268, 3702, 3452, 3288, 2978, 2629, 2617, 3128, 3813, 4141, 4157, 4549, 5649, 6766, 6983, 6439, 6125, 6361, 6260, 5090, 3416, 2376, 2279, 2485, 2327, 1678, 835, 319, 628, 1761, 2923, 3155, 2424, 1728, 1804, 2079, 1525, 287, -505, -637, -1383, -3675, -6623, -8670, -9513, -9912, -9918, -8440, -4669, 809, 6785, 12750, 18864, 24879, 29733, 32379, 32767, 31805, 30408, 28552, 25506, 21086, 16394, 13093, 11999, 12516, 13310, 13525, 13517, 14252, 15748, 16658, 15861, 14002, 12816, 13072, 13912, 14100, 13484, 12963, 13271, 14020, 14185, 13394, 12332, 11621, 10910, 9483, 7503, 6006, 5558, 5491, 4750, 3169, 1419, -186, -2201, -5091, -8331, -11087, -13480, -16343, -19710, -22363, -23157, -22227, -20599, -18935, -16983, -14275, -11244, -9095, -8258, -7649, -6281, -4945, -5138, -6722, -8003, -8138, -8176, -9211, -10583, -10798, -9676, -8553, -8470, -9042, -9216, -8514, -7335, -6375, -5831, -5168, -3841, -2146, -891, -191, 794, 2646, 4740, 6050, 6564, 7250, 8659, 10285, 11422, 11991, 12343, 12722, 13062, 13001, 12129, 10458, 8458, 6459, 4337, 1999, -245, -2086, -3625, -4997, -5878, -5852, -5157, -4473, -3968, -3227, -2128, -1116, -525, -277, -306, -663, -1174, -1609, -2207, -3433, -5237, -6963, -8201, -9281, -10711, -12405, -13847, -14879, -15861, -17023, -18057, -18580, -18690, -18810, -19062, -19101, -18648, -17952, -17432, -16997, -16230, -15143, -14170, -13378, -12359, -10997, -9693, -8632, -7496, -6139, -5027, -4695, -5096, -5720, -6264, -6945, -8113, -9701, -11242, -12415, -13270, -13857, -13946, -13404, -12484, -11472, -10216, -8389, -6131, -4025, -2373, -852, 926, 2775, 4226, 5235, 6166, 7073, 7566, 7576, 7719, 8482, 9294, 9019, 7515, 6002, 5359, 4824, 3413, 1744, 974, 771, 155, -525, -472, -345, -1207, -2317, -2064, -558, 574, 653, 629, 1333, 2386, 3207, 3965, 4911, 5605, 5583, 5128, 4700, 4161, 3120, 1533, -424, -2572, -4683, -6558, -8234, -9819, -11290, -12569, -13539, -13928, -13557, -12695, -11785, -10861, -9639, -8244, -7262, -6879, -6457, -5472, -4395, -3956, -3881, -3265, -1995, -955, -758, -1091, -1421, -1751, -2375, -3298, -4234, -5039, -5778, -6495, -7020, -6980, -5960, -4080, -2304, -1527, -1427, -947, 226, 1561, 2795, 4145, 5597, 6902, 8150, 9595, 11100, 12305, 13139, 13641, 13514, 12507, 11119, 10117, 9304, 7729, 5324, 3316, 2502, 2151, 1209, -198, -1144, -1217, -710, 30, 739, 975, 595, 256, 588, 1113, 989, 483, 537, 1197, 1701, 1887, 2247, 2686, 2372, 997, -663, -1758, -2328, -2943, -3934, -5275, -6613, -7136, -6196, -4413, -3290, -3445, -4139, -4697, -5264, -5837, -5786, -4895, -3958, -3556, -2966, -1176, 1377, 3180, 3764, 4366, 5889, 7257, 6895, 5123, 3638, 2902, 1756, -186, -1480, -1038, 6, -153, -1463, -2282, -1813, -920, -510, -399, -201, -152, -347, 17, 1704, 4237, 6402, 7783, 9107, 10989, 12803, 13285, 12052, 9909, 7551, 4850, 1842, -638, -2064, -3032, -4097, -4642, -3850, -2095, -576, 17, -63, -152, 110, 453, 441, 289, 722, 1961, 3476, 4814, 5948, 6677, 6469, 5166, 3245, 1118, -1308, -3975, -6264, -7860, -9262, -10461, -9914, -6272, -724, 3981, 6739, 8878, 11537, 13757, 13953, 12083, 9302, 6308, 3275, 820, -279, -83, 910, 2911, 6490, 11328, 16160, 19946, 22398, 23444, 23019, 21549, 20043, 19270, 19153, 19268, 19561, 20262, 21504, 23295, 25536, 27671, 28643, 27647, 24923, 21658, 18981, 17181, 15814, 14433, 13178, 12741, 13669, 15631, 17506, 18371, 18222, 17496, 16146, 13702, 10056, 5992, 2721, 834, -212, -1225, -1975, -1515, 233, 2047, 2979, 3315, 3436, 2699, 280, -3378, -6883, -9543, -11864, -14397, -16828, -18469, -19081, -18832, -17973, -16783, -15588, -14630, -14093, -14144, -14573, -14573, -13491, -11801, -10741, -10768, -10912, -10076, -8445, -7047, -6359, -6068, -5911, -5967, -6110, -5929, -5295, -4523, -3795, -2881, -1633, -367, 662, 1770, 3339, 5001, 5926, 5994, 5987, 6385, 6692, 6415, 6021, 6170, 6639, 6771, 6598, 6733, 7411, 8211, 8624, 8543, 8178, 7665, 6810, 5445, 3915, 2740, 1795, 408, -1527, -3136, -3649, -3462, -3509, -3912, -4033, -3772, -3841, -4563, -5272, -5333, -5005, -4887, -5158, -5674, -6333, -6936, -7201, -7209, -7581, -8789, -10479, -11860, -12629, -13130, -13648, -14030, -14050, -13758, -13343, -12862, -12253, -11459, -10536, -9694, -9200, -9148, -9286, -9229, -8880, -8455, -8103, -7805, -7514, -7086, -6261, -5229, -4779, -5243, -5796, -5570, -5055, -5418, -6789, -8094, -8464, -8051, -7414, -6719, -5831, -4820, -3940, -3105, -1904, -358, 729, 697, -22, -398, -165, -68, -616, -1253, -1234, -844, -978, -1727, -2251, -2074, -1687, -1725, -2189, -2694, -2927, -2760, -2320, -1965, -1876, -1714, -1065, -156, 342, 271, 200, 473, 562, -149, -1400, -2413, -2946, -3364, -3811, -3947, -3599, -3066, -2512, -1599, -159, 1250, 1962, 2026, 1990, 2078, 1936, 1071, -535, -2214, -3270, -3883, -4903, -6646, -8645, -10669, -13130, -16105, -18781, -20312, -20642, -19938, -17880, -14243, -9663, -4779, 915, 8046, 15423, 20727, 23168, 23988, 24312, 23963, 22653, 20913, 19341, 17787, 15971, 14333, 13690, 14180, 15062, 15535, 15365, 14609, 13285, 11570, 10005, 8983, 8269, 7399, 6426, 5883, 6110, 6929, 7969, 9003, 10004, 11066, 12177, 13064, 13486, 13650, 14039, 14639, 14764, 13940, 12636, 11573, 10572, 8767, 5884, 2472, -1031, -4673, -8393, -11857, -14953, -17775, -19985, -20906, -20426, -19171, -17468, -14907, -11465, -8174, -5832, -3854, -1443, 784, 1542, 745, -444, -1153, -1525, -2028, -2768, -3548, -4149, -4402, -4301, -4152, -4212, -4342, -4396, -4751, -5678, -6589, -6770, -6451, -6236, -6030, -5442, -4656, -3948, -2915, -1099, 1004, 2533, 3641, 5273, 7593, 9715, 11192, 12531, 13872, 14461, 13967, 13099, 12284, 10864, 8333, 5366, 2867, 686, -1800, -4383, -6272, -7347, -8040, -8243, -7530, -6321, -5568, -5282, -4524, -2910, -1182, -202, -49, -193, -191, -77, -87, -124, 157, 654, 758, 233, -367, -497, -400, -769, -1935, -3575, -5017, -5814, -6157, -6596, -7276, -7787, -7809, -7462, -6965, -6529, -6477, -6931, -7439, -7438, -6957, -6384, -5797, -4977, -3797, -2326, -749, 688, 1866, 2820, 3424, 3473, 3212, 3095, 2928, 2093, 701, -505, -1337, -2155, -2913, -3262, -3463, -4045, -4745, -4751, -3968, -3206, -3018, -2997, -2419, -1196, 124, 1101, 1807, 2562, 3555, 4772, 6014, 6894, 7078, 6642, 5945, 5104, 3984, 2767, 1987, 1729, 1409, 707, 206, 575, 1556, 2227, 2077, 1430, 862, 494, 8, -777, -1604, -2131, -2342, -2366, -2088, -1278, -137, 645, 645, 259, 217, 628, 911, 614, -106, -834, -1312, -1461, -1316, -1062, -920, -924, -929, -816, -644, -632, -1023, -1887, -3017, -4063, -4800, -5185, -5157, -4533, -3305, -1898, -819, -112, 599, 1523, 2397, 2711, 2127, 847, -328, -585, 95, 951, 1431, 1820, 2642, 3746, 4463, 4483, 4094, 3506, 2474, 863, -829, -1946, -2438, -2720, -2874, -2634, -2100, -1702, -1365, -579, 489, 906, 284, -634, -993, -686, -4, 809, 1457, 1641, 1544, 1771, 2573, 3347, 3166, 1855, 206, -1063, -2233, -3861, -5532, -6323, -6314, -6437, -6760, -6267, -4595, -2785, -1923, -1983, -2289, -2454, -2582, -2965, -3696, -4465, -4805, -4536, -3861, -3047, -2219, -1345, -324, 775, 1514, 1404, 493, -684, -1754, -2791, -3943, -5056, -5787, -5892, -5477, -4957, -4606, -4232, -3622, -3091, -3099, -3530, -3918, -4128, -4272, -4199, -3656, -2810, -2062, -1480, -775, 171, 1042, 1385, 996, 7, -1255, -2435, -3340, -4072, -4812, -5509, -5906, -5897, -5607, -5118, -4365, -3424, -2653, -2345, -2384, -2410, -2258, -2045, -1865, -1654, -1344, -919, -329, 494, 1456, 2287, 2825, 3128, 3249, 3088, 2619, 2019, 1364, 494, -547, -1278, -1284, -737, -141, 204, 301, 249, 138, -3, -215, -504, -808, -1055, -1188, -1087, -625, 163, 1143, 2236, 3378, 4413, 5203, 5732, 5994, 5912, 5479, 4796, 3995, 3288, 2985, 3214, 3676, 3998, 4192, 4553, 5187, 5877, 6295, 6248, 5791, 5168, 4592, 4089, 3604, 3171, 2860, 2616, 2338, 2082, 2029, 2201, 2333, 2153, 1695, 1238, 1080, 1367, 1955, 2405, 2403, 2203, 2307, 2640, 2422, 1016, -1402, -4162, -6829, -9399, -11867, -13935, -15151, -15184, -13919, -11412, -7769, -3086, 2383, 8027, 13063, 17090, 20234, 22607, 23885, 23716, 22375, 20631, 19049, 17690, 16531, 15735, 15309, 14944, 14461, 14172, 14409, 14834, 14708, 13833, 12822, 12279, 12176, 12180, 12214, 12409, 12802, 13341, 14018, 14721, 15173, 15287, 15369, 15758, 16305, 16643, 16827, 17282, 18112, 18896, 19317, 19531, 19683, 19408, 18218, 16151, 13638, 10891, 7809, 4460, 1137, -1956, -4689, -6788, -8089, -8816, -9170, -9001, -8204, -7129, -6192, -5394, -4538, -3720, -3288, -3447, -4043, -4737, -5301, -5764, -6344, -7184, -8120, -8768, -8960, -8954, -9083, -9390, -9769, -10200, -10661, -10967, -11043, -11109, -11410, -11831, -12014, -11811, -11514, -11553, -11933, -12134, -11728, -10937, -10219, -9548, -8499, -6964, -5254, -3621, -2087, -694, 447, 1328, 1953, 2197, 1951, 1371, 720, 22, -862, -1831, -2533, -2891, -3279, -3956, -4622, -4831, -4689, -4679, -4900, -4968, -4721, -4462, -4354, -4116, -3597, -3090, -2767, -2351, -1628, -881, -453, -211, 229, 919, 1464, 1514, 1174, 860, 770, 686, 303, -395, -1192, -1923, -2590, -3274, -4015, -4752, -5332, -5690, -5993, -6468, -7110, -7705, -8117, -8400, -8708, -9116, -9521, -9684, -9503, -9181, -8938, -8697, -8255, -7640, -6999, -6321, -5538, -4807, -4390, -4269, -4147, -3890, -3737, -3962, -4515, -5145, -5750, -6384, -7068, -7717, -8198, -8432, -8497, -8593, -8742, -8647, -8104, -7391, -6951, -6767, -6361, -5378, -4040, -2891, -2229, -1855, -1360, -594, 214, 728, 888, 957, 1174, 1495, 1772, 2014, 2293, 2510, 2526, 2424, 2402, 2476, 2491, 2426, 2437, 2560, 2569, 2263, 1776, 1414, 1238, 1008, 528, -77, -454, -395, -98, 22, -122, -189, 83, 474, 643, 633, 716, 922, 1046, 966, 765, 596, 545, 547, 439, 105, -425, -1061, -1701, -2223, -2548, -2755, -2972, -3215, -3453, -3656, -3662, -3317, -2855, -2701, -2778, -2555, -1889, -1236, -945, -864, -768, -676, -664, -706, -746, -738, -679, -671, -847, -1122, -1184, -871, -440, -285, -428, -503, -252, 163, 429, 471, 448, 482, 531, 531, 491, 445, 349, 122, -181, -335, -169, 179, 359, 221, 40, 175, 579, 888, 930, 890, 918, 904, 758, 608, 587, 581, 386, 2, -369, -584, -647, -646, -699, -889, -1112, -1088, -729, -328, -152, -69, 175, 501, 627, 537, 475, 551, 549, 219, -358, -814, -921, -875, -998, -1277, -1393, -1186, -822, -490, -199, 69, 219, 170, 11, -87, -78, -54, -104, -220, -335, -387, -296, 7, 417, 583, 282, -218, -492, -546, -676, -889, -935, -817, -758, -717, -430, 72, 432, 427, 214, 27, -83, -143, -139, -134, -275, -508, -518, -154, 357, 722, 842, 720, 476, 400, 660, 1033, 1232, 1276, 1297, 1254, 1116, 1026, 1056, 1075, 1003, 934, 946, 976, 974, 986, 1039, 1078, 1097, 1163, 1258, 1233, 1059, 968, 1162, 1478, 1574, 1380, 1150, 1136, 1347, 1646, 1884, 1949, 1821, 1670, 1729, 2013, 2308, 2482, 2578, 2619, 2588, 2601, 2793, 3031, 3047, 2812, 2533, 2348, 2225, 2113, 2008, 1898, 1762, 1600, 1458, 1405, 1470, 1554, 1506, 1325, 1177, 1164, 1164, 1045, 919, 1006, 1267, 1419, 1378, 1425, 1782, 2246, 2464, 2450, 2513, 2738, 2882, 2860, 2891, 3045, 3032, 2701, 2348, 2248, 2279, 2235, 2161, 2153, 2125, 2020, 2008, 2220, 2471, 2468, 2260, 2175, 2373, 2706, 3010, 3281, 3553, 3830, 4128, 4428, 4626, 4658, 4582, 4460, 4295, 4116, 3999, 3939, 3854, 3738, 3691, 3711, 3621, 3306, 2907, 2607, 2344, 1937, 1448, 1156, 1174, 1327, 1466, 1666, 1985, 2246, 2279, 2207, 2187, 2058, 1539, 655, -301, -1109, -1700, -2062, -2273, -2435, -2446, -2010, -1006, 301, 1568, 2721, 3849, 4894, 5644, 6042, 6265, 6472, 6632, 6642, 6495, 6286, 6165, 6202, 6262, 6142, 5864, 5683, 5704, 5762, 5685, 5533, 5462, 5536, 5696, 5831, 5897, 5973, 6137, 6300, 6295, 6105, 5869, 5659, 5446, 5241, 5115, 5128, 5283, 5525, 5767, 6077, 6638, 7401, 8026, 8381, 8731, 9169, 9311, 8903, 8232, 7622, 6969, 6085, 5102, 4242, 3505, 2805, 2202, 1801, 1556, 1316, 1032, 802, 712, 702, 680, 651, 663, 674, 596, 429, 263, 100, -172, -586, -968, -1150, -1254, -1535, -1962, -2230, -2235, -2226, -2361, -2460, -2356, -2207, -2250, -2441, -2554, -2538, -2577, -2828, -3215, -3522, -3650, -3713, -3898, -4250, -4620, -4828, -4873, -4929, -5126, -5408, -5626, -5709, -5708, -5738, -5900, -6157, -6344, -6358, -6305, -6336, -6450, -6517, -6471, -6355, -6230, -6090, -5856, -5502, -5153, -5006, -5074, -5195, -5301, -5509, -5889, -6353, -6800, -7181, -7431, -7501, -7442, -7332, -7123, -6717, -6201, -5792, -5518, -5164, -4636, -4148, -3897, -3806, -3802, -3967, -4267, -4481, -4638, -5029, -5663, -6174, -6389, -6541, -6804, -7026, -7029, -6876, -6708, -6542, -6327, -6070, -5856, -5729, -5616, -5457, -5332, -5351, -5441, -5431, -5349, -5386, -5567, -5697, -5655, -5548, -5486, -5420, -5249, -4980, -4717, -4575, -4563, -4581, -4556, -4550, -4625, -4730, -4790, -4827, -4872, -4873, -4812, -4780, -4826, -4836, -4680, -4416, -4217, -4139, -4097, -4016, -3918, -3806, -3669, -3575, -3589, -3597, -3395, -3007, -2701, -2640, -2705, -2692, -2561, -2430, -2396, -2419, -2401, -2321, -2225, -2099, -1888, -1654, -1539, -1500, -1336, -1026, -808, -841, -997, -1098, -1166, -1299, -1443, -1507, -1574, -1754, -1925, -1912, -1810, -1785, -1713, -1440, -1166, -1114, -1103, -875, -572, -437, -379, -180, 107, 293, 365, 446, 584, 717, 802, 843, 863, 907, 1026, 1204, 1333, 1377, 1453, 1634, 1783, 1736, 1590, 1576, 1691, 1684, 1489, 1395, 1584, 1826, 1857, 1792, 1855, 2016, 2141, 2240, 2329, 2334, 2303, 2408, 2637, 2756, 2682, 2633, 2727, 2746, 2542, 2395, 2532, 2651, 2411, 2075, 2012, 2047, 1898, 1791, 1946, 2056, 1841, 1634, 1802, 2118, 2186, 2048, 2002, 2096, 2200, 2363, 2709, 3084, 3165, 2939, 2744, 2744, 2708, 2424, 2040, 1793, 1660, 1487, 1273, 1113, 970, 793, 709, 859, 1118, 1283, 1390, 1591, 1826, 1931, 1962, 2096, 2248, 2142, 1798, 1610, 1781, 1994, 1879, 1580, 1514, 1707, 1792, 1624, 1497, 1570, 1552, 1200, 790, 726, 945, 1096, 1118, 1243, 1523, 1741, 1819, 1943, 2198, 2389, 2395, 2357, 2361, 2292, 2143, 2082, 2109, 2039, 1879, 1826, 1890, 1933, 1947, 2009, 2074, 2094, 2139, 2213, 2188, 2039, 1934, 2019, 2265, 2512, 2594, 2463, 2282, 2264, 2398, 2480, 2434, 2409, 2533, 2741, 2885, 2918, 2896, 2867, 2812, 2701, 2579, 2532, 2547, 2516, 2428, 2416, 2548, 2678, 2648, 2533, 2547, 2696, 2766, 2663, 2556, 2556, 2502, 2272, 2049, 2077, 2288, 2433, 2426, 2383, 2388, 2389, 2320, 2187, 2078, 2058, 2093, 2085, 2002, 1909, 1897, 2008, 2192, 2326, 2308, 2206, 2179, 2248, 2255, 2101, 1889, 1770, 1774, 1829, 1847, 1781, 1705, 1771, 2002, 2226, 2277, 2201, 2137, 2130, 2127, 2118, 2145, 2202, 2217, 2140, 2025, 1974, 1998, 1998, 1917, 1827, 1814, 1851, 1864, 1845, 1818, 1814, 1894, 2052, 2151, 2117, 2124, 2297, 2418, 2246, 1953, 1869, 1974, 1987, 1828, 1672, 1627, 1619, 1573, 1519, 1515, 1565, 1642, 1696, 1651, 1505, 1402, 1472, 1614, 1596, 1393, 1204, 1150, 1122, 983, 764, 557, 368, 166, 6, -36, 12, 79, 180, 377, 641, 890, 1098, 1298, 1511, 1735, 1945, 2084, 2112, 2075, 2063, 2082, 2052, 1957, 1896, 1926, 1950, 1868, 1748, 1667, 1543, 1321, 1136, 1094, 1056, 850, 575, 470, 583, 731, 754, 666, 589, 612, 728, 843, 860, 830, 955, 1273, 1536, 1615, 1745, 2089, 2409, 2519, 2625, 2871, 2993, 2806, 2562, 2493, 2439, 2213, 1969, 1911, 1923, 1791, 1596, 1589, 1745, 1798, 1659, 1504, 1428, 1361, 1285, 1257, 1224, 1083, 896, 830, 906, 978, 951, 861, 739, 586, 483, 524, 599, 504, 305, 263, 373, 342, 66, -212, -314, -341, -410, -462, -448, -491, -686, -929, -1088, -1230, -1476, -1746, -1881, -1894, -1924, -2004, -2066, -2103, -2161, -2212, -2207, -2228, -2387, -2571, -2593, -2565, -2763, -3094, -3221, -3188, -3349, -3683, -3845, -3819, -3861, -3956, -3923, -3864, -3973, -4097, -3993, -3810, -3857, -4057, -4060, -3877, -3886, -4165, -4355, -4334, -4419, -4723, -4969, -5086, -5290, -5530, -5565, -5485, -5522, -5539, -5339, -5093, -5015, -5033, -5062, -5114, -5125, -5110, -5324, -5757, -5946, -5766, -5740, -6134, -6499, -6522, -6465, -6536, -6558, -6441, -6308, -6192, -6087, -6101, -6194, -6155, -6014, -5995, -6060, -6015, -5967, -6054, -6069, -5847, -5699, -5896, -6116, -5934, -5507, -5327, -5510, -5725, -5708, -5541, -5418, -5319, -5087, -4756, -4572, -4610, -4619, -4430, -4255, -4329, -4518, -4556, -4431, -4274, -4103, -3918, -3774, -3637, -3450, -3309, -3304, -3286, -3105, -2886, -2790, -2769, -2744, -2753, -2757, -2673, -2589, -2595, -2533, -2276, -2041, -2059, -2172, -2105, -1868, -1642, -1516, -1479, -1477, -1394, -1185, -977, -879, -829, -756, -668, -569, -506, -608, -810, -815, -604, -581, -848, -938, -618, -288, -254, -305, -247, -168, -75, 134, 366, 502, 650, 851, 909, 783, 683, 650, 533, 377, 321, 292, 232, 353, 759, 1163, 1329, 1365, 1367, 1239, 1002, 873, 949, 1103, 1207, 1211, 1098, 958, 979, 1216, 1498, 1630, 1589, 1463, 1333, 1243, 1236, 1329, 1463, 1497, 1355, 1196, 1283, 1576, 1746, 1698, 1699, 1855, 1915, 1808, 1783, 1890, 1868, 1657, 1460, 1316, 1130, 993, 1023, 1124, 1220, 1416, 1666, 1708, 1528, 1479, 1770, 2171, 2355, 2240, 1947, 1629, 1412, 1377, 1522, 1719, 1800, 1725, 1659, 1767, 1981, 2073, 1988, 1930, 2027, 2060, 1771, 1356, 1318, 1728, 2105, 2169, 2201, 2416, 2557, 2433, 2282, 2296, 2285, 2135, 2133, 2504, 2949, 2981, 2572, 2149, 2020, 2052, 1960, 1717, 1571, 1745, 2191, 2582, 2567, 2120, 1665, 1672, 2101, 2408, 2262, 1966, 1991, 2334, 2663, 2789, 2713, 2513, 2427, 2670, 3034, 3066, 2708, 2301, 2002, 1676, 1340, 1243, 1444, 1718, 1888, 2022, 2272, 2623, 2883, 2847, 2471, 1944, 1576, 1527, 1653, 1699, 1617, 1593, 1770, 2068, 2311, 2407, 2363, 2229, 2125, 2168, 2234, 2009, 1532, 1343, 1719, 2169, 2193, 2058, 2181, 2367, 2258, 2025, 1949, 1839, 1462, 1108, 1175, 1469, 1471, 1149, 1010, 1347, 1900, 2314, 2514, 2497, 2235, 1914, 1833, 1960, 1962, 1698, 1381, 1288, 1513, 1823, 1845, 1591, 1566, 1952, 2192, 1915, 1596, 1701, 1886, 1719, 1443, 1445, 1623, 1723, 1750, 1758, 1701, 1633, 1669, 1744, 1706, 1602, 1609, 1726, 1770, 1657, 1539, 1570, 1680, 1714, 1670, 1684, 1805, 1944, 1957, 1798, 1609, 1618, 1845, 2047, 2077, 2093, 2272, 2515, 2623, 2562, 2444, 2361, 2349, 2364, 2285, 2048, 1737, 1487, 1363, 1369, 1431, 1386, 1179, 1004, 1040, 1154, 1103, 941, 929, 1088, 1152, 1001, 872, 989, 1187, 1141, 839, 580, 508, 416, 149, -93, -60, 125, 145, -27, -104, 68, 328, 467, 480, 482, 564, 756, 1022, 1231, 1236, 1025, 762, 655, 709, 703, 505, 309, 369, 595, 674, 551, 444, 448, 465, 473, 575, 797, 1040, 1178, 1118, 944, 948, 1248, 1516, 1435, 1154, 958, 861, 812, 854, 869, 685, 518, 650, 837, 710, 489, 568, 784, 788, 695, 757, 879, 903, 893, 883, 770, 613, 599, 691, 653, 456, 354, 498, 694, 684, 489, 357, 434, 618, 728, 679, 553, 521, 597, 561, 284, -20, -150, -268, -556, -800, -761, -643, -755, -951, -854, -506, -349, -540, -720, -566, -279, -267, -558, -818, -823, -684, -711, -1064, -1473, -1483, -1158, -1056, -1331, -1496, -1364, -1345, -1568, -1649, -1537, -1631, -1914, -1967, -1830, -1945, -2308, -2458, -2242, -1979, -1926, -2033, -2181, -2365, -2640, -2978, -3243, -3341, -3364, -3506, -3782, -3958, -3830, -3485, -3261, -3397, -3743, -3868, -3652, -3558, -3957, -4405, -4218, -3587, -3350, -3684, -3919, -3681, -3371, -3376, -3518, -3478, -3307, -3319, -3668, -4147, -4419, -4416, -4389, -4543, -4828, -5159, -5551, -5883, -5854, -5398, -4958, -4978, -5226, -5115, -4669, -4516, -4792, -4889, -4557, -4361, -4639, -4901, -4748, -4592, -4912, -5433, -5588, -5351, -5137, -5116, -5081, -4875, -4646, -4550, -4462, -4237, -4063, -4163, -4261, -3995, -3668, -3783, -4037, -3842, -3577, -3969, -4595, -4517, -4040, -4208, -4932, -5182, -4659, -4039, -3825, -3853, -3684, -3134, -2599, -2621, -2931, -2752, -2275, -2485, -3252, -3349, -2621, -2181, -2368, -2446, -2220, -2087, -1918, -1498, -1377, -1928, -2465, -2359, -2018, -2009, -2206, -2268, -2108, -1699, -1118, -751, -879, -1166, -1090, -742, -686, -1047, -1259, -941, -543, -655, -1032, -923, -238, 246, 14, -446, -348, 299, 779, 699, 418, 427, 683, 769, 490, 96, -58, 47, 154, 151, 220, 487, 785, 931, 1015, 1185, 1383, 1480, 1506, 1572, 1685, 1745, 1686, 1617, 1791, 2215, 2463, 2235, 1870, 1793, 1829, 1729, 1798, 2178, 2253, 1663, 1129, 1339, 1839, 1828, 1359, 1064, 1229, 1587, 1684, 1363, 1080, 1392, 2044, 2236, 1895, 1801, 2329, 2931, 3075, 2881, 2674, 2484, 2145, 1623, 1238, 1438, 2067, 2209, 1366, 436, 654, 1838, 2628, 2384, 1895, 2052, 2640, 2832, 2390, 1822, 1511, 1299, 1024, 946, 1250, 1556, 1429, 1111, 1147, 1463, 1487, 1162, 1108, 1634, 2229, 2368, 2326, 2623, 3075, 3104, 2754, 2629, 2871, 2972, 2588, 1919, 1380, 1301, 1691, 2045, 1865, 1388, 1169, 1120, 806, 458, 686, 1311, 1520, 1233, 1314, 2089, 2685, 2445, 2063, 2330, 2686, 2228, 1334, 987, 1165, 1126, 729, 410, 368, 499, 741, 949, 830, 446, 380, 888, 1319, 1082, 719, 1036, 1650, 1682, 1348, 1392, 1547, 1134, 534, 595, 1182, 1551, 1507, 1368, 1390, 1625, 1845, 1662, 1206, 1048, 1150, 877, 328, 380, 1035, 1217, 608, 272, 909, 1706, 1630, 980, 871, 1608, 2370, 2438, 2052, 1839, 1926, 2023, 2033, 2085, 2153, 2082, 1942, 2022, 2379, 2708, 2798, 2895, 3307, 3816, 3911, 3535, 3141, 2985, 2901, 2794, 2711, 2507, 2082, 1791, 1941, 2200, 2180, 2123, 2371, 2713, 2837, 2871, 3043, 3325, 3630, 3904, 3990, 3838, 3689, 3707, 3717, 3562, 3385, 3358, 3438, 3524, 3555, 3455, 3255, 3194, 3426, 3701, 3622, 3175, 2735, 2554, 2472, 2229, 1876, 1667, 1628, 1499, 1186, 978, 1058, 1121, 850, 474, 380, 461, 378, 186, 150, 234, 218, 143, 226, 483, 758, 976, 1149, 1253, 1286, 1353, 1476, 1431, 1088, 799, 1018, 1601, 1952, 1875, 1784, 2021, 2388, 2503, 2307, 2057, 1971, 2004, 1961, 1755, 1524, 1471, 1590, 1618, 1396, 1131, 1113, 1262, 1279, 1159, 1176, 1365, 1447, 1334, 1308, 1541, 1785, 1771, 1619, 1608, 1719, 1758, 1770, 1945, 2213, 2301, 2187, 2130, 2210, 2191, 1936, 1668, 1623, 1695, 1648, 1543, 1632, 1905, 2040, 1852, 1534, 1376, 1400, 1412, 1298, 1163, 1154, 1255, 1335, 1326, 1292, 1293, 1304, 1274, 1191, 1069, 958, 894, 814, 613, 351, 225, 257, 235, 37, -184, -255, -187, -115, -156, -326, -484, -475, -392, -487, -770, -978, -998, -1027, -1213, -1417, -1462, -1388, -1377, -1497, -1623, -1618, -1533, -1582, -1875, -2233, -2345, -2171, -2077, -2369, -2810, -2931, -2748, -2698, -2925, -3160, -3289, -3481, -3806, -4155, -4442, -4572, -4442, -4225, -4270, -4533, -4544, -4120, -3670, -3603, -3787, -3844, -3689, -3525, -3488, -3556, -3728, -4000, -4231, -4290, -4296, -4433, -4629, -4677, -4646, -4830, -5323, -5878, -6210, -6276, -6229, -6221, -6299, -6434, -6567, -6600, -6450, -6217, -6112, -6089, -5835, -5367, -5223, -5689, -6230, -6192, -5711, -5406, -5405, -5320, -5035, -4893, -5015, -5078, -4999, -5158, -5628, -5910, -5804, -5782, -6087, -6343, -6355, -6451, -6690, -6606, -6023, -5400, -5094, -4869, -4408, -3855, -3601, -3740, -4040, -4284, -4429, -4467, -4375, -4259, -4287, -4391, -4304, -4014, -3851, -3878, -3658, -3016, -2544, -2762, -3260, -3320, -2984, -2853, -3091, -3292, -3175, -2877, -2579, -2294, -2088, -2099, -2200, -2070, -1714, -1507, -1584, -1687, -1668, -1645, -1625, -1485, -1269, -1076, -833, -508, -276, -219, -263, -478, -981, -1493, -1592, -1393, -1441, -1846, -2040, -1561, -714, -200, -192, -88, 612, 1454, 1586, 1065, 785, 1030, 1112, 703, 454, 823, 1236, 992, 322, 35, 435, 974, 863, -44, -984, -995, -9, 983, 1113, 759, 958, 1792, 2218, 1705, 992, 813, 903, 802, 646, 702, 875, 1051, 1261, 1440, 1501, 1571, 1746, 1859, 1769, 1612, 1554, 1557, 1485, 1235, 804, 385, 308, 659, 1108, 1329, 1479, 1932, 2551, 2708, 2243, 1827, 2000, 2379, 2311, 1804, 1380, 1361, 1650, 1890, 1819, 1704, 2111, 2936, 3310, 2917, 2543, 2774, 2970, 2295, 1072, 435, 923, 1908, 2393, 2163, 1984, 2516, 3325, 3467, 2808, 2097, 1851, 1900, 2009, 2224, 2449, 2332, 1886, 1753, 2319, 2947, 2760, 1974, 1716, 2512, 3596, 3808, 2795, 1359, 704, 1143, 1679, 1330, 522, 404, 1167, 1991, 2360, 2480, 2589, 2692, 2831, 3032, 3103, 2883, 2590, 2632, 3091, 3621, 3790, 3448, 2750, 1993, 1517, 1623, 2239, 2684, 2272, 1297, 922, 1728, 2901, 3283, 2785, 2236, 2207, 2487, 2608, 2424, 2145, 2010, 2013, 2018, 2025, 2168, 2435, 2646, 2746, 2896, 3250, 3749, 4109, 3900, 2976, 1907, 1556, 2041, 2576, 2458, 1764, 1050, 834, 1308, 2118, 2585, 2497, 2395, 2721, 3120, 3027, 2614, 2541, 2915, 3179, 3086, 3083, 3461, 3831, 3833, 3711, 3763, 3782, 3526, 3250, 3347, 3756, 4067, 4003, 3600, 3071, 2680, 2635, 2909, 3173, 3076, 2681, 2422, 2526, 2620, 2246, 1548, 1068, 940, 849, 674, 625, 743, 841, 873, 903, 863, 710, 552, 337, -181, -998, -1808, -2474, -3091, -3595, -3749, -3513, -3053, -2500, -1933, -1469, -1155, -888, -601, -412, -415, -471, -331, 44, 445, 698, 870, 1094, 1307, 1358, 1331, 1452, 1660, 1647, 1416, 1374, 1672, 1956, 1925, 1736, 1677, 1810, 2038, 2197, 2141, 1962, 1981, 2277, 2496, 2364, 2155, 2302, 2710, 2927, 2920, 3136, 3685, 4144, 4338, 4618, 5095, 5369, 5248, 5070, 5060, 5008, 4723, 4279, 3828, 3516, 3522, 3832, 4100, 4024, 3739, 3633, 3801, 3949, 3852, 3640, 3540, 3577, 3650, 3664, 3545, 3340, 3285, 3455, 3562, 3385, 3141, 3093, 3128, 3031, 2812, 2554, 2305, 2194, 2285, 2359, 2212, 2037, 2096, 2240, 2112, 1667, 1159, 727, 318, -56, -298, -488, -816, -1196, -1302, -1114, -1000, -1141, -1300, -1279, -1184, -1189, -1411, -1862, -2269, -2248, -1907, -1812, -2146, -2530, -2738, -2929, -3161, -3343, -3594, -4025, -4383, -4391, -4192, -4092, -4186, -4414, -4655, -4686, -4471, -4337, -4541, -4892, -5104, -5173, -5144, -4982, -4820, -4857, -4959, -4836, -4570, -4476, -4566, -4584, -4474, -4433, -4557, -4704, -4693, -4506, -4344, -4431, -4725, -4930, -4901, -4855, -5061, -5500, -5928, -6144, -6110, -5963, -5887, -5896, -5852, -5725, -5590, -5388, -5055, -4867, -5100, -5462, -5452, -5176, -5163, -5517, -5831, -5860, -5713, -5514, -5253, -4959, -4760, -4746, -4896, -5105, -5291, -5448, -5610, -5741, -5745, -5581, -5360, -5195, -5007, -4679, -4416, -4545, -4869, -4812, -4344, -4042, -4091, -4043, -3706, -3404, -3257, -3037, -2792, -2856, -3161, -3246, -2981, -2721, -2600, -2313, -1844, -1754, -2255, -2697, -2576, -2296, -2331, -2419, -2263, -2087, -2011, -1739, -1250, -895, -790, -850, -1154, -1594, -1704, -1410, -1223, -1310, -1195, -722, -399, -559, -932, -1165, -1166, -998, -813, -778, -893, -1021, -1151, -1348, -1499, -1435, -1251, -1198, -1339, -1504, -1562, -1507, -1292, -864, -440, -340, -401, -146, 302, 292, -190, -483, -505, -765, -1125, -1017, -693, -761, -908, -530, -10, -15, -312, -387, -366, -509, -648, -686, -848, -1092, -1015, -552, -188, -310, -727, -950, -742, -297, 45, 158, 139, 78, 25, 93, 313, 468, 475, 607, 909, 870, 335, 94, 686, 1350, 1146, 481, 426, 991, 1260, 999, 949, 1403, 1651, 1278, 921, 1121, 1395, 1207, 883, 854, 888, 700, 505, 515, 624, 786, 1103, 1477, 1629, 1431, 1014, 708, 865, 1488, 2141, 2534, 2875, 3315, 3460, 2939, 2148, 1857, 2126, 2240, 1823, 1335, 1181, 1113, 956, 1048, 1496, 1873, 2117, 2741, 3659, 3889, 2961, 1732, 1249, 1504, 1790, 1761, 1546, 1228, 856, 759, 1117, 1511, 1577, 1663, 2123, 2604, 2768, 2883, 3038, 2842, 2354, 2219, 2545, 2812, 2919, 3188, 3366, 2813, 1710, 1015, 1046, 1052, 502, 8, 338, 1247, 1965, 2286, 2398, 2220, 1700, 1287, 1374, 1677, 1786, 1930, 2528, 3278, 3474, 3117, 2791, 2507, 1797, 973, 913, 1548, 1943, 1854, 1817, 1961, 2059, 2270, 2716, 2948, 2714, 2476, 2512, 2398, 1867, 1365, 1336, 1629, 1909, 2146, 2410, 2559, 2453, 2255, 2194, 2222, 2210, 2267, 2501, 2731, 2842, 3121, 3784, 4456, 4589, 4189, 3706, 3353, 2842, 1790, 221, -1457, -2939, -4262, -5429, -6130, -6214, -6063, -5957, -5551, -4573, -3492, -2815, -2323, -1637, -899, -342, 139, 618, 954, 1138, 1282, 1380, 1517, 1914, 2370, 2344, 1870, 1583, 1646, 1575, 1195, 887, 836, 837, 793, 798, 877, 984, 1083, 1039, 787, 559, 562, 669, 785, 1080, 1554, 1964, 2420, 3376, 4772, 6003, 6884, 7878, 9207, 10407, 10958, 10823, 10303, 9686, 9111, 8568, 7993, 7373, 6753, 6228, 6000, 6185, 6518, 6569, 6330, 6181, 6265, 6422, 6637, 6969, 7230, 7250, 7249, 7408, 7551, 7622, 7821, 8055, 7969, 7644, 7472, 7432, 7268, 7105, 7101, 6981, 6579, 6205, 6019, 5675, 5016, 4350, 3847, 3298, 2579, 1800, 1053, 403, -47, -328, -590, -828, -890, -775, -585, -287, 145, 536, 720, 777, 813, 719, 373, -104, -527, -936, -1507, -2245, -2944, -3462, -3859, -4229, -4560, -4808, -4989, -5104, -5129, -5090, -5048, -5029, -5033, -5072, -5138, -5209, -5309, -5441, -5509, -5466, -5422, -5431, -5335, -5025, -4633, -4324, -4070, -3798, -3534, -3308, -3131, -3080, -3215, -3422, -3512, -3519, -3668, -4030, -4388, -4542, -4576, -4659, -4767, -4799, -4805, -4848, -4865, -4803, -4742, -4685, -4509, -4208, -3942, -3773, -3579, -3305, -3062, -2959, -2984, -3070, -3187, -3342, -3574, -3906, -4306, -4702, -5026, -5271, -5477, -5714, -5986, -6230, -6442, -6745, -7181, -7566, -7705, -7671, -7637, -7594, -7415, -7075, -6644, -6202, -5840, -5589, -5342, -5037, -4828, -4865, -5011, -5040, -4984, -5057, -5329, -5662, -5888, -5899, -5664, -5314, -5133, -5314, -5686, -5865, -5700, -5446, -5425, -5633, -5799, -5745, -5501, -5144, -4736, -4423, -4261, -4005, -3413, -2725, -2388, -2343, -2154, -1754, -1501, -1524, -1564, -1467, -1378, -1472, -1755, -2100, -2325, -2351, -2318, -2436, -2693, -2874, -2815, -2562, -2292, -2136, -2066, -1945, -1742, -1582, -1526, -1420, -1130, -825, -803, -1043, -1165, -942, -642, -639, -886, -1014, -860, -638, -566, -594, -578, -511, -467, -466, -482, -543, -704, -942, -1188, -1386, -1495, -1499, -1472, -1476, -1413, -1151, -769, -478, -313, -114, 191, 487, 637, 617, 491, 358, 321, 392, 462, 435, 387, 455, 594, 628, 565, 614, 841, 1039, 1055, 1041, 1175, 1364, 1422, 1428, 1583, 1810, 1816, 1581, 1397, 1383, 1327, 1139, 1063, 1266, 1509, 1525, 1477, 1705, 2151, 2448, 2503, 2557, 2730, 2918, 3069, 3157, 3040, 2702, 2418, 2379, 2419, 2350, 2224, 2154, 2177, 2293, 2371, 2192, 1805, 1510, 1346, 1094, 831, 820, 928, 835, 674, 760, 987, 1107, 1177, 1231, 1044, 637, 388, 424, 550, 731, 995, 1045, 638, 134, 72, 400, 618, 423, -108, -775, -1337, -1508, -1153, -519, -77, -116, -518, -916, -992, -619, 94, 748, 786, 140, -410, -155, 472, 615, 460, 762, 1263, 1144, 794, 1375, 2672, 3129, 2243, 1346, 1541, 2178, 2150, 1600, 1318, 1314, 1158, 1016, 1140, 1084, 570, 284, 727, 1172, 831, 232, 375, 1122, 1472, 1098, 669, 683, 858, 845, 787, 865, 995, 1160, 1442, 1657, 1581, 1503, 1873, 2437, 2447, 1803, 1311, 1536, 2042, 2175, 2019, 1990, 2036, 1883, 1672, 1637, 1500, 922, 249, 150, 605, 929, 835, 778, 1086, 1421, 1441, 1367, 1491, 1648, 1574, 1362, 1177, 892, 312, -519, -1482, -2625, -3915, -5015, -5694, -6225, -6890, -7390, -7278, -6595, -5515, -3904, -1887, -184, 779, 1506, 2559, 3702, 4384, 4558, 4572, 4632, 4725, 4882, 5205, 5675, 6152, 6536, 6836, 7049, 7150, 7226, 7409, 7680, 7842, 7799, 7714, 7799, 8064, 8376, 8668, 8959, 9257, 9595, 10026, 10548, 11079, 11639, 12387, 13371, 14367, 15151, 15805, 16534, 17254, 17641, 17593, 17284, 16770, 15973, 15058, 14237, 13306, 11975, 10541, 9576, 9064, 8568, 8043, 7841, 8013, 8194, 8222, 8299, 8490, 8536, 8338, 8167, 8130, 7913, 7359, 6834, 6646, 6494, 5967, 5208, 4645, 4332, 3966, 3422, 2848, 2259, 1511, 661, -42, -616, -1335, -2225, -3001, -3567, -4149, -4849, -5437, -5722, -5814, -5909, -6005, -5986, -5801, -5418, -4773, -3971, -3328, -3014, -2834, -2573, -2390, -2578, -3151, -3883, -4626, -5396, -6212, -7020, -7732, -8280, -8595, -8642, -8482, -8266, -8080, -7826, -7369, -6776, -6266, -5899, -5533, -5082, -4649, -4332, -4090, -3901, -3806, -3763, -3629, -3368, -3128, -2989, -2840, -2582, -2345, -2312, -2425, -2497, -2519, -2620, -2832, -3060, -3251, -3381, -3412, -3375, -3395, -3466, -3383, -3041, -2668, -2529, -2511, -2311, -1970, -1796, -1815, -1786, -1740, -1927, -2274, -2488, -2668, -3145, -3821, -4257, -4383, -4584, -5085, -5682, -6110, -6390, -6717, -7167, -7599, -7877, -8072, -8320, -8587, -8790, -9019, -9337, -9555, -9587, -9694, -9987, -10071, -9710, -9268, -9071, -8936, -8714, -8582, -8536, -8324, -8068, -8220, -8804, -9361, -9625, -9729, -9804, -9793, -9713, -9664, -9628, -9423, -8941, -8306, -7712, -7224, -6810, -6432, -6033, -5548, -5037, -4678, -4535, -4486, -4372, -4123, -3762, -3371, -3039, -2751, -2446, -2145, -1913, -1707, -1480, -1346, -1427, -1635, -1763, -1719, -1568, -1436, -1479, -1702, -1858, -1688, -1262, -866, -644, -561, -576, -611, -490, -118, 300, 460, 308, 76, -19, -11, -64, -253, -522, -810, -1108, -1373, -1536, -1632, -1738, -1757, -1538, -1265, -1306, -1567, -1514, -995, -534, -562, -854, -1006, -1034, -1153, -1297, -1289, -1277, -1507, -1793, -1751, -1451, -1262, -1210, -1112, -1089, -1298, -1452, -1252, -950, -943, -1146, -1234, -1178, -1113, -981, -666, -292, -92, -44, 84, 360, 621, 767, 870, 961, 1032, 1176, 1484, 1804, 1906, 1829, 1817, 1918, 1935, 1797, 1684, 1671, 1581, 1383, 1371, 1658, 1952, 2071, 2220, 2519, 2769, 2894, 3067, 3300, 3382, 3300, 3275, 3382, 3482, 3506, 3512, 3525, 3483, 3373, 3242, 3144, 3067, 2953, 2766, 2540, 2325, 2113, 1896, 1747, 1735, 1786, 1775, 1668, 1517, 1437, 1590, 1972, 2224, 2028, 1620, 1471, 1611, 1734, 1771, 1821, 1773, 1486, 1116, 870, 689, 498, 423, 479, 375, -45, -414, -296, 121, 236, -114, -474, -500, -381, -383, -442, -419, -359, -322, -216, 105, 657, 1221, 1470, 1376, 1318, 1549, 1798, 1715, 1399, 1099, 840, 648, 684, 853, 803, 536, 496, 840, 1128, 1007, 685, 521, 474, 265, -129, -437, -520, -537, -575, -372, 267, 983, 1276, 1314, 1687, 2376, 2683, 2298, 1703, 1393, 1330, 1280, 1184, 1096, 1116, 1358, 1757, 2008, 1951, 1857, 2037, 2307, 2198, 1700, 1307, 1250, 1251, 1136, 1054, 977, 666, 262, 176, 346, 289, -120, -521, -649, -539, -287, -6, 166, 163, 3, -283, -581, -843, -1444, -2834, -4739, -6391, -7604, -8694, -9531, -9719, -9406, -8816, -7427, -4764, -1408, 1761, 4552, 6968, 8706, 9699, 10244, 10377, 9976, 9321, 8762, 8231, 7766, 7828, 8532, 9431, 10353, 11503, 12637, 13187, 13221, 13348, 13715, 13874, 13609, 13223, 13116, 13419, 14009, 14673, 15379, 16254, 17257, 18138, 18859, 19685, 20717, 21688, 22396, 22961, 23448, 23652, 23396, 22793, 22017, 21055, 19783, 18207, 16432, 14565, 12736, 11176, 10088, 9447, 9093, 8980, 9185, 9672, 10205, 10573, 10752, 10773, 10572, 10026, 9155, 8131, 7112, 6138, 5233, 4468, 3882, 3394, 2927, 2530, 2253, 1954, 1388, 492, -581, -1687, -2830, -4043, -5236, -6288, -7169, -7890, -8383, -8569, -8490, -8275, -7938, -7378, -6631, -5949, -5507, -5149, -4629, -4007, -3591, -3546, -3772, -4100, -4450, -4811, -5236, -5809, -6534, -7257, -7782, -8012, -8030, -8049, -8173, -8209, -7883, -7238, -6633, -6280, -6003, -5560, -4967, -4392, -3861, -3301, -2725, -2225, -1773, -1281, -800, -492, -376, -330, -320, -431, -655, -873, -1068, -1363, -1828, -2362, -2818, -3155, -3430, -3716, -4037, -4350, -4536, -4478, -4191, -3839, -3542, -3246, -2842, -2364, -1999, -1867, -1925, -2078, -2314, -2671, -3160, -3752, -4411, -5103, -5811, -6535, -7257, -7931, -8562, -9238, -10000, -10775, -11481, -12135, -12787, -13433, -14021, -14487, -14767, -14847, -14815, -14797, -14806, -14731, -14477, -14089, -13712, -13434, -13257, -13131, -13018, -12873, -12707, -12607, -12675, -12870, -13029, -13083, -13144, -13337, -13617, -13822, -13886, -13855, -13746, -13481, -13034, -12517, -12017, -11470, -10764, -9901, -8932, -7907, -6953, -6217, -5600, -4862, -4018, -3332, -2881, -2494, -2161, -2031, -2040, -1884, -1497, -1186, -1204, -1419, -1525, -1442, -1349, -1401, -1590, -1819, -1985, -2005, -1891, -1762, -1700, -1607, -1326, -869, -423, -137, 17, 170, 362, 510, 548, 517, 443, 280, 76, 9, 59, -106, -679, -1358, -1756, -1906, -2104, -2455, -2840, -3157, -3360, -3381, -3174, -2817, -2442, -2094, -1773, -1526, -1325, -996, -497, -130, -148, -348, -397, -298, -200, -57, 144, 195, 33, -44, 161, 394, 327, 0, -296, -414, -428, -472, -566, -615, -532, -305, 44, 473, 863, 1156, 1541, 2186, 2825, 3075, 3111, 3420, 3933, 4141, 3990, 3924, 4076, 4153, 4022, 3812, 3596, 3406, 3350, 3414, 3402, 3250, 3130, 3203, 3498, 3920, 4259, 4355, 4385, 4650, 5076, 5319, 5320, 5313, 5386, 5461, 5597, 5852, 5983, 5719, 5235, 4971, 5005, 4931, 4419, 3635, 2971, 2541, 2148, 1693, 1331, 1148, 958, 598, 239, 115, 172, 210, 200, 198, 143, 15, -42, 44, 110, -27, -345, -705, -1006, -1173, -1197, -1243, -1557, -2094, -2459, -2470, -2466, -2731, -2997, -2981, -2927, -3060, -3081, -2761, -2460, -2470, -2456, -2074, -1601, -1427, -1404, -1151, -715, -433, -343, -191, 56, 194, 211, 278, 360, 359, 434, 680, 777, 512, 285, 538, 1017, 1171, 982, 923, 1232, 1658, 1903, 1979, 2048, 2146, 2190, 2162, 2101, 1979, 1791, 1704, 1868, 2079, 1974, 1624, 1501, 1757, 2030, 2052, 1943, 1809, 1612, 1434, 1394, 1354, 1175, 1044, 1126, 1145, 805, 389, 468, 1089, 1663, 1709, 1395, 1233, 1442, 1822, 2116, 2224, 2122, 1854, 1655, 1829, 2370, 2934, 3268, 3457, 3648, 3822, 3990, 4278, 4630, 4693, 4262, 3638, 3246, 3106, 2905, 2526, 2142, 1822, 1386, 759, 182, -105, -205, -367, -620, -776, -718, -520, -279, -32, 191, 377, 533, 531, 142, -582, -1270, -1767, -2331, -3033, -3466, -3312, -2710, -1838, -623, 989, 2867, 4852, 6756, 8326, 9434, 10212, 10782, 11128, 11277, 11335, 11327, 11294, 11423, 11817, 12340, 12873, 13409, 13817, 13987, 14151, 14525, 14870, 14960, 15142, 15762, 16474, 16856, 17127, 17643, 18211, 18463, 18469, 18521, 18596, 18512, 18322, 18274, 18467, 18742, 18931, 19046, 19178, 19249, 19066, 18555, 17810, 16881, 15723, 14345, 12903, 11527, 10235, 9061, 8084, 7337, 6763, 6374, 6244, 6335, 6394, 6223, 5936, 5721, 5500, 5063, 4423, 3718, 2920, 2007, 1149, 405, -424, -1345, -2085, -2603, -3156, -3739, -4163, -4533, -5074, -5616, -5944, -6247, -6709, -7113, -7326, -7628, -8151, -8563, -8590, -8404, -8258, -8151, -7970, -7682, -7313, -6862, -6338, -5803, -5420, -5285, -5228, -5009, -4767, -4917, -5480, -5965, -6097, -6162, -6453, -6824, -6991, -6925, -6721, -6382, -5920, -5431, -4970, -4475, -3910, -3361, -2889, -2422, -1939, -1596, -1519, -1557, -1485, -1326, -1294, -1414, -1500, -1493, -1548, -1677, -1657, -1452, -1403, -1728, -2156, -2334, -2336, -2464, -2785, -3134, -3386, -3517, -3525, -3453, -3397, -3403, -3404, -3323, -3209, -3221, -3441, -3762, -4031, -4298, -4713, -5213, -5615, -5998, -6625, -7446, -8126, -8611, -9186, -9929, -10580, -10985, -11285, -11602, -11885, -12026, -11988, -11892, -11940, -12136, -12198, -11998, -11857, -12067, -12386, -12426, -12256, -12209, -12303, -12282, -12095, -11969, -11986, -11939, -11688, -11446, -11498, -11747, -11808, -11603, -11517, -11773, -12036, -11941, -11654, -11481, -11312, -10857, -10191, -9598, -9069, -8416, -7676, -7051, -6504, -5828, -5103, -4650, -4493, -4276, -3873, -3560, -3482, -3469, -3453, -3503, -3479, -3217, -2930, -2849, -2813, -2636, -2465, -2406, -2307, -2142, -2070, -2060, -1989, -1975, -2127, -2213, -2059, -1885, -1871, -1857, -1734, -1673, -1747, -1803, -1786, -1824, -1980, -2202, -2444, -2654, -2828, -3087, -3480, -3797, -3909, -4033, -4361, -4694, -4813, -4794, -4731, -4573, -4432, -4517, -4666, -4468, -3939, -3536, -3470, -3477, -3317, -3100, -3000, -2956, -2805, -2590, -2526, -2707, -2950, -3016, -2851, -2553, -2223, -1966, -1888, -1922, -1792, -1348, -855, -709, -899, -1017, -845, -618, -540, -379, 97, 629, 893, 1096, 1583, 2177, 2486, 2554, 2664, 2839, 2986, 3135, 3268, 3281, 3249, 3342, 3490, 3510, 3465, 3512, 3593, 3572, 3489, 3469, 3557, 3739, 3952, 4108, 4251, 4513, 4844, 5025, 5039, 5109, 5282, 5372, 5322, 5239, 5122, 4899, 4687, 4646, 4679, 4581, 4346, 4137, 4047, 4027, 3967, 3795, 3549, 3350, 3223, 3046, 2758, 2468, 2304, 2239, 2175, 2089, 2029, 2020, 2022, 1981, 1900, 1846, 1830, 1771, 1601, 1387, 1210, 1011, 710, 398, 229, 173, 44, -236, -534, -708, -787, -880, -999, -1074, -1110, -1206, -1381, -1504, -1457, -1306, -1222, -1258, -1282, -1180, -1033, -974, -943, -784, -561, -518, -661, -710, -514, -210, 43, 183, 201, 225, 441, 740, 799, 653, 637, 726, 594, 332, 360, 669, 891, 974, 1159, 1467, 1717, 1864, 1955, 2011, 2092, 2230, 2294, 2201, 2141, 2296, 2534, 2637, 2637, 2680, 2782, 2888, 2985, 3045, 2996, 2852, 2753, 2774, 2776, 2608, 2353, 2230, 2255, 2191, 1870, 1429, 1148, 1126, 1175, 1040, 717, 521, 722, 1160, 1413, 1364, 1404, 1914, 2729, 3298, 3350, 3166, 3146, 3289, 3303, 3140, 3086, 3283, 3499, 3541, 3574, 3790, 4114, 4422, 4702, 4869, 4748, 4346, 3831, 3224, 2476, 1788, 1460, 1438, 1342, 987, 599, 444, 458, 405, 239, 124, 138, 167, 135, 149, 314, 538, 646, 607, 520, 424, 255, -59, -573, -1282, -2036, -2552, -2626, -2211, -1388, -377, 570, 1469, 2600, 4013, 5322, 6228, 6883, 7491, 7935, 8075, 8089, 8253, 8610, 9027, 9456, 9949, 10503, 11017, 11361, 11547, 11695, 11845, 11904, 11857, 11869, 12081, 12456, 12921, 13476, 14049, 14515, 14879, 15230, 15500, 15586, 15571, 15585, 15584, 15526, 15532, 15665, 15821, 15954, 16139, 16277, 16133, 15689, 15155, 14635, 14051, 13335, 12522, 11713, 11059, 10623, 10242, 9739, 9196, 8827, 8622, 8346, 7894, 7403, 6983, 6551, 6011, 5471, 5072, 4760, 4363, 3861, 3368, 2908, 2372, 1739, 1139, 603, -7, -724, -1350, -1804, -2269, -2814, -3228, -3481, -3863, -4460, -4949, -5170, -5407, -5870, -6344, -6558, -6585, -6606, -6599, -6465, -6300, -6291, -6395, -6408, -6308, -6276, -6392, -6560, -6693, -6786, -6862, -6979, -7177, -7386, -7513, -7602, -7704, -7743, -7706, -7728, -7791, -7651, -7240, -6840, -6623, -6415, -6068, -5713, -5488, -5290, -5011, -4743, -4625, -4613, -4553, -4398, -4244, -4145, -4018, -3798, -3585, -3487, -3436, -3302, -3139, -3111, -3202, -3240, -3198, -3188, -3206, -3131, -2962, -2804, -2677, -2542, -2420, -2353, -2312, -2259, -2264, -2401, -2612, -2781, -2924, -3128, -3342, -3469, -3604, -3948, -4456, -4893, -5217, -5594, -6055, -6447, -6727, -7002, -7303, -7540, -7722, -7983, -8353, -8685, -8889, -9078, -9373, -9707, -9958, -10140, -10320, -10416, -10307, -10121, -10131, -10322, -10387, -10231, -10118, -10197, -10273, -10247, -10312, -10521, -10625, -10520, -10456, -10597, -10762, -10769, -10709, -10701, -10636, -10392, -10091, -9914, -9769, -9423, -8923, -8528, -8307, -8049, -7670, -7364, -7268, -7209, -6980, -6668, -6517, -6528, -6441, -6126, -5768, -5559, -5390, -5102, -4809, -4712, -4713, -4587, -4384, -4318, -4353, -4298, -4168, -4118, -4104, -3955, -3706, -3554, -3523, -3443, -3259, -3151, -3218, -3288, -3203, -3061, -3022, -3017, -2901, -2733, -2714, -2871, -3013, -2996, -2877, -2782, -2748, -2749, -2772, -2787, -2694, -2445, -2155, -2019, -2059, -2126, -2118, -2059, -1964, -1843, -1806, -1879, -1843, -1587, -1370, -1377, -1338, -1019, -668, -551, -506, -333, -133, -6, 145, 310, 323, 196, 119, 152, 207, 242, 271, 283, 275, 267, 282, 396, 690, 1031, 1160, 1090, 1101, 1286, 1506, 1765, 2129, 2367, 2243, 2009, 2089, 2441, 2727, 2844, 2902, 2931, 2943, 3029, 3199, 3367, 3522, 3706, 3863, 3935, 3967, 4003, 4010, 4000, 4042, 4098, 4067, 3984, 3987, 4088, 4166, 4180, 4219, 4324, 4409, 4417, 4419, 4474, 4504, 4416, 4262, 4151, 4074, 3949, 3809, 3758, 3797, 3800, 3698, 3568, 3489, 3451, 3450, 3525, 3613, 3549, 3300, 3060, 2997, 3032, 2999, 2904, 2861, 2839, 2705, 2480, 2362, 2421, 2487, 2414, 2250, 2106, 1987, 1861, 1756, 1690, 1617, 1480, 1297, 1112, 949, 807, 702, 627, 542, 443, 398, 441, 519, 583, 654, 742, 786, 748, 682, 660, 679, 684, 643, 540, 372, 204, 168, 301, 456, 503, 494, 522, 533, 471, 447, 580, 752, 757, 616, 547, 617, 670, 641, 670, 799, 862, 806, 842, 1074, 1305, 1349, 1299, 1323, 1437, 1579, 1728, 1858, 1912, 1878, 1828, 1840, 1928, 2031, 2077, 2064, 2038, 2038, 2039, 1995, 1936, 1950, 2050, 2122, 2073, 1982, 1965, 1992, 1955, 1869, 1846, 1905, 1953, 1937, 1913, 1912, 1896, 1858, 1886, 2014, 2121, 2071, 1914, 1812, 1817, 1820, 1734, 1600, 1503, 1444, 1357, 1222, 1107, 1082, 1124, 1139, 1074, 966, 891, 903, 987, 1068, 1067, 970, 866, 868, 994, 1139, 1173, 1075, 957, 922, 946, 941, 930, 997, 1101, 1110, 1025, 961, 930, 865, 816, 858, 882, 736, 479, 289, 214, 179, 133, 57, -40, -98, -85, -68, -93, -70, 39, 116, 39, -123, -217, -182, -99, -134, -416, -880, -1273, -1405, -1265, -912, -433, -6, 244, 467, 917, 1601, 2321, 2951, 3477, 3844, 4030, 4141, 4305, 4525, 4725, 4847, 4886, 4907, 5032, 5311, 5655, 5958, 6212, 6494, 6879, 7420, 8093, 8762, 9244, 9460, 9526, 9632, 9871, 10185, 10445, 10567, 10565, 10532, 10587, 10803, 11153, 11543, 11884, 12153, 12380, 12597, 12783, 12872, 12844, 12756, 12656, 12505, 12273, 12004, 11749, 11507, 11258, 11042, 10915, 10888, 10935, 11005, 11044, 11044, 11052, 11077, 11068, 11014, 10949, 10847, 10632, 10297, 9920, 9557, 9223, 8951, 8741, 8529, 8254, 7926, 7588, 7281, 7021, 6779, 6459, 5990, 5416, 4866, 4410, 4022, 3605, 3090, 2526, 2065, 1802, 1662, 1482, 1195, 864, 556, 265, -17, -255, -469, -771, -1217, -1707, -2142, -2552, -2961, -3303, -3589, -3943, -4381, -4760, -5014, -5244, -5507, -5757, -6006, -6338, -6743, -7106, -7407, -7756, -8204, -8641, -8964, -9235, -9525, -9773, -9916, -10007, -10087, -10068, -9892, -9671, -9530, -9448, -9370, -9327, -9361, -9417, -9428, -9456, -9605, -9834, -9999, -10062, -10086, -10079, -9981, -9833, -9731, -9673, -9567, -9387, -9199, -9061, -8992, -8988, -9024, -9059, -9085, -9112, -9166, -9248, -9354, -9474, -9552, -9524, -9384, -9216, -9097, -9022, -8948, -8867, -8794, -8732, -8702, -8774, -8979, -9233, -9418, -9512, -9599, -9726, -9843, -9893, -9875, -9782, -9599, -9397, -9248, -9096, -8868, -8628, -8463, -8303, -8084, -7914, -7885, -7896, -7819, -7719, -7700, -7698, -7588, -7415, -7306, -7231, -7060, -6819, -6656, -6565, -6396, -6159, -6040, -6074, -6112, -6092, -6110, -6195, -6239, -6205, -6194, -6231, -6192, -6014, -5815, -5693, -5568, -5346, -5109, -4967, -4856, -4683, -4513, -4466, -4495, -4457, -4319, -4192, -4155, -4180, -4201, -4191, -4136, -4022, -3873, -3754, -3698, -3679, -3672, -3682, -3706, -3705, -3665, -3636, -3668, -3748, -3807, -3775, -3620, -3371, -3115, -2934, -2788, -2555, -2197, -1847, -1654, -1601, -1553, -1458, -1400, -1450, -1567, -1670, -1730, -1748, -1719, -1668, -1626, -1561, -1392, -1133, -918, -828, -784, -663, -490, -401, -462, -592, -702, -789, -894, -1009, -1076, -1052, -927, -723, -477, -203, 128, 551, 1025, 1431, 1690, 1856, 2021, 2193, 2272, 2181, 1969, 1792, 1794, 1971, 2177, 2289, 2358, 2513, 2815, 3228, 3686, 4093, 4368, 4526, 4668, 4842, 4976, 5000, 4948, 4890, 4850, 4808, 4777, 4810, 4937, 5114, 5277, 5425, 5605, 5844, 6092, 6277, 6346, 6278, 6082, 5798, 5494, 5215, 4962, 4706, 4420, 4108, 3831, 3674, 3670, 3762, 3871, 3972, 4061, 4137, 4199, 4260, 4317, 4323, 4228, 4047, 3849, 3688, 3564, 3467, 3401, 3358, 3316, 3280, 3287, 3348, 3416, 3426, 3356, 3220, 3028, 2785, 2504, 2227, 1965, 1689, 1380, 1099, 936, 892, 902, 950, 1058, 1192, 1289, 1361, 1454, 1553, 1593, 1566, 1501, 1376, 1160, 902, 704, 588, 477, 328, 194, 131, 113, 104, 115, 142, 134, 65, -32, -137, -273, -434, -587, -730, -909, -1113, -1251, -1251, -1156, -1040, -903, -729, -548, -371, -155, 91, 270, 344, 398, 472, 483, 382, 253, 180, 149, 102, 56, 55, 93, 148, 240, 399, 567, 664, 704, 758, 835, 890, 897, 870, 820, 762, 724, 707, 689, 681, 703, 730, 712, 670, 689, 783, 835, 750, 588, 470, 399, 303, 170, 30, -113, -258, -350, -364, -364, -402, -437, -414, -357, -320, -301, -274, -267, -314, -366, -355, -328, -379, -495, -581, -623, -687, -786, -848, -857, -874, -927, -961, -950, -945, -974, -979, -942, -940, -1014, -1088, -1098, -1082, -1061, -977, -819, -687, -646, -634, -554, -393, -220, -113, -76, -45, 46, 185, 305, 373, 424, 498, 577, 623, 638, 657, 678, 683, 692, 727, 743, 682, 583, 567, 684, 832, 878, 816, 754, 767, 850, 936, 923, 739, 452, 229, 125, 45, -68, -169, -240, -287, -215, 84, 529, 965, 1384, 1886, 2473, 3037, 3526, 3952, 4307, 4563, 4762, 4992, 5263, 5484, 5598, 5670, 5784, 5962, 6213, 6579, 7075, 7629, 8155, 8638, 9120, 9628, 10166, 10725, 11262, 11689, 11951, 12108, 12258, 12450, 12653, 12853, 13039, 13186, 13314, 13532, 13931, 14418, 14785, 14963, 15100, 15315, 15518, 15596, 15590, 15577, 15495, 15246, 14895, 14610, 14440, 14300, 14130, 13969, 13845, 13716, 13583, 13519, 13559, 13602, 13525, 13307, 13009, 12683, 12347, 12013, 11656, 11212, 10649, 10017, 9430, 8933, 8501, 8103, 7712, 7285, 6798, 6297, 5860, 5492, 5134, 4715, 4205, 3624, 3036, 2518, 2090, 1684, 1225, 722, 271, -69, -333, -586, -857, -1138, -1412, -1679, -1990, -2383, -2809, -3180, -3517, -3929, -4440, -4961, -5446, -5919, -6349, -6682, -6962, -7274, -7616, -7891, -8069, -8203, -8360, -8578, -8856, -9163, -9447, -9692, -9919, -10151, -10373, -10577, -10796, -11041, -11231, -11280, -11211, -11121, -11051, -10954, -10829, -10720, -10668, -10655, -10651, -10633, -10610, -10616, -10678, -10768, -10850, -10891, -10869, -10764, -10589, -10389, -10193, -10006, -9842, -9687, -9506, -9292, -9099, -8989, -8951, -8941, -8941, -8957, -8964, -8945, -8919, -8928, -8960, -8945, -8832, -8652, -8489, -8398, -8360, -8310, -8209, -8072, -7966, -7938, -8000, -8112, -8218, -8282, -8293, -8273, -8240, -8197, -8135, -8044, -7910, -7720, -7496, -7275, -7066, -6851, -6657, -6544, -6534, -6553, -6519, -6449, -6430, -6487, -6562, -6620, -6661, -6653, -6549, -6391, -6278, -6219, -6141, -6021, -5893, -5769, -5641, -5547, -5530, -5575, -5616, -5628, -5626, -5614, -5584, -5550, -5541, -5530, -5439, -5237, -5007, -4846, -4755, -4650, -4504, -4363, -4252, -4147, -4056, -4030, -4050, -4038, -3980, -3935, -3902, -3848, -3810, -3828, -3824, -3719, -3575, -3490, -3454, -3408, -3368, -3367, -3378, -3349, -3290, -3246, -3223, -3197, -3156, -3094, -2973, -2777, -2561, -2392, -2251, -2085, -1905, -1756, -1623, -1470, -1336, -1279, -1268, -1211, -1099, -1022, -1000, -949, -833, -723, -644, -519, -332, -164, -27, 142, 319, 425, 487, 591, 705, 732, 695, 695, 759, 825, 854, 868, 901, 970, 1073, 1182, 1254, 1282, 1307, 1355, 1384, 1359, 1329, 1345, 1373, 1359, 1325, 1308, 1299, 1318, 1432, 1633, 1808, 1908, 2030, 2267, 2568, 2812, 2969, 3095, 3231, 3369, 3517, 3676, 3795, 3818, 3783, 3794, 3878, 3968, 4023, 4078, 4151, 4192, 4181, 4189, 4274, 4380, 4435, 4453, 4467, 4456, 4419, 4426, 4491, 4534, 4531, 4544, 4601, 4644, 4647, 4658, 4688, 4681, 4602, 4498, 4426, 4383, 4347, 4307, 4232, 4080, 3888, 3768, 3754, 3736, 3619, 3453, 3327, 3236, 3130, 3016, 2933, 2862, 2751, 2625, 2544, 2497, 2402, 2241, 2087, 1993, 1943, 1912, 1892, 1850, 1761, 1650, 1568, 1523, 1485, 1432, 1348, 1236, 1134, 1070, 1024, 955, 863, 792, 776, 811, 854, 856, 806, 737, 701, 712, 743, 755, 719, 640, 549, 477, 420, 352, 268, 185, 112, 44, -22, -82, -142, -227, -330, -405, -430, -456, -525, -611, -674, -732, -806, -867, -886, -882, -874, -857, -837, -821, -798, -765, -749, -762, -769, -748, -729, -741, -762, -763, -750, -736, -725, -719, -704, -667, -619, -587, -573, -563, -560, -556, -518, -450, -416, -442, -484, -523, -590, -664, -679, -646, -660, -743, -829, -883, -935, -990, -1015, -1016, -1050, -1135, -1216, -1251, -1264, -1294, -1321, -1335, -1370, -1433, -1464, -1441, -1431, -1481, -1549, -1578, -1573, -1567, -1561, -1543, -1534, -1563, -1613, -1640, -1625, -1607, -1621, -1643, -1632, -1590, -1561, -1553, -1526, -1457, -1379, -1320, -1252, -1145, -1009, -880, -770, -665, -543, -412, -300, -214, -126, -22, 75, 160, 270, 419, 562, 682, 831, 1032, 1215, 1305, 1321, 1320, 1312, 1280, 1217, 1138, 1063, 1007, 958, 902, 855, 853, 889, 930, 965, 1017, 1089, 1146, 1156, 1112, 1011, 846, 647, 483, 419, 445, 499, 548, 642, 862, 1245, 1776, 2434, 3175, 3906, 4533, 5046, 5502, 5934, 6329, 6655, 6878, 7008, 7105, 7249, 7435, 7600, 7749, 7985, 8413, 9030, 9746, 10462, 11133, 11745, 12315, 12881, 13444, 13965, 14396, 14721, 14936, 15003, 14917, 14783, 14759, 14926, 15222, 15517, 15749, 15957, 16230, 16566, 16904, 17197, 17451, 17667, 17794, 17786, 17652, 17433, 17170, 16914, 16706, 16530, 16327, 16076, 15836, 15676, 15591, 15507, 15388, 15255, 15130, 14979, 14757, 14446, 14032, 13505, 12886, 12269, 11730, 11239, 10714, 10137, 9561, 9011, 8476, 7970, 7538, 7166, 6765, 6295, 5787, 5284, 4760, 4181, 3590, 3047, 2563, 2124, 1708, 1286, 822, 363, -9, -300, -568, -840, -1146, -1554, -2078, -2611, -3086, -3546, -4024, -4492, -4955, -5484, -6067, -6603, -7021, -7343, -7615, -7867, -8127, -8410, -8715, -9028, -9331, -9606, -9890, -10239, -10634, -10990, -11271, -11538, -11821, -12078, -12295, -12472, -12569, -12541, -12435, -12319, -12220, -12162, -12191, -12280, -12329, -12300, -12253, -12246, -12316, -12500, -12718, -12800, -12671, -12452, -12258, -12076, -11868, -11658, -11442, -11192, -10944, -10779, -10697, -10652, -10643, -10691, -10786, -10899, -11026, -11170, -11295, -11371, -11375, -11289, -11138, -10982, -10865, -10770, -10662, -10513, -10333, -10161, -10058, -10045, -10093, -10175, -10289, -10389, -10397, -10308, -10196, -10123, -10068, -9987, -9823, -9533, -9132, -8710, -8360, -8088, -7862, -7673, -7514, -7362, -7221, -7139, -7131, -7148, -7122, -7049, -6957, -6841, -6657, -6400, -6122, -5860, -5586, -5272, -4941, -4664, -4498, -4426, -4360, -4240, -4105, -4025, -4019, -4058, -4104, -4094, -3958, -3718, -3474, -3261, -3035, -2805, -2631, -2493, -2313, -2106, -1951, -1853, -1767, -1705, -1721, -1798, -1839, -1796, -1714, -1653, -1625, -1591, -1531, -1482, -1472, -1471, -1444, -1420, -1442, -1500, -1572, -1688, -1858, -2011, -2077, -2079, -2072, -2058, -2022, -1985, -1943, -1848, -1690, -1529, -1432, -1412, -1441, -1483, -1523, -1557, -1604, -1677, -1765, -1834, -1851, -1806, -1709, -1581, -1449, -1338, -1242, -1125, -978, -845, -786, -822, -927, -1076, -1252, -1412, -1521, -1588, -1653, -1714, -1718, -1639, -1490, -1296, -1069, -850, -685, -595, -560, -543, -518, -513, -608, -810, -1033, -1203, -1332, -1419, -1395, -1264, -1137, -1078, -1004, -827, -570, -302, -38, 204, 342, 320, 218, 195, 289, 394, 416, 376, 350, 387, 505, 717, 988, 1253, 1478, 1693, 1923, 2137, 2295, 2406, 2496, 2543, 2515, 2448, 2420, 2454, 2503, 2533, 2564, 2624, 2714, 2860, 3094, 3380, 3612, 3738, 3816, 3903, 3984, 4047, 4115, 4192, 4232, 4216, 4178, 4159, 4172, 4217, 4274, 4308, 4289, 4220, 4143, 4107, 4114, 4095, 3984, 3827, 3729, 3721, 3728, 3693, 3639, 3584, 3514, 3445, 3438, 3497, 3538, 3477, 3336, 3204, 3133, 3112, 3099, 3055, 2955, 2810, 2692, 2672, 2713, 2694, 2567, 2441, 2396, 2338, 2183, 2030, 1981, 1950, 1812, 1624, 1497, 1421, 1364, 1374, 1449, 1468, 1358, 1205, 1140, 1190, 1273, 1285, 1172, 973, 765, 588, 454, 366, 287, 145, -76, -285, -392, -399, -353, -273, -197, -193, -279, -357, -310, -158, -45, -93, -260, -395, -411, -369, -334, -267, -137, -26, 0, 15, 128, 318, 485, 571, 557, 452, 327, 284, 337, 386, 347, 226, 106, 81, 196, 394, 548, 575, 524, 521, 602, 694, 726, 693, 625, 529, 432, 385, 389, 379, 322, 272, 264, 237, 143, 82, 164, 303, 304, 159, 43, 37, 37, -26, -85, -92, -132, -258, -359, -312, -183, -131, -164, -158, -57, 87, 239, 400, 528, 553, 499, 472, 523, 593, 622, 623, 616, 583, 542, 576, 702, 840, 927, 985, 1054, 1154, 1310, 1530, 1739, 1851, 1874, 1899, 1993, 2154, 2342, 2500, 2562, 2500, 2369, 2294, 2367, 2535, 2639, 2579, 2433, 2331, 2302, 2303, 2334, 2380, 2335, 2125, 1854, 1695, 1668, 1636, 1494, 1282, 1089, 954, 896, 970, 1224, 1601, 1969, 2267, 2580, 2998, 3482, 3947, 4370, 4733, 4961, 5036, 5089, 5236, 5436, 5597, 5730, 5896, 6108, 6374, 6739, 7218, 7752, 8250, 8688, 9120, 9591, 10107, 10622, 11070, 11400, 11602, 11746, 11915, 12132, 12347, 12537, 12741, 12993, 13270, 13534, 13819, 14181, 14600, 14988, 15271, 15428, 15479, 15467, 15448, 15438, 15390, 15258, 15039, 14805, 14617, 14511, 14454, 14399, 14347, 14318, 14319, 14321, 14300, 14244, 14124, 13910, 13605, 13267, 12917, 12523, 12043, 11512, 10985, 10458, 9919, 9424, 9018, 8657, 8265, 7853, 7464, 7069, 6609, 6102, 5620, 5147, 4600, 3972, 3364, 2822, 2270, 1661, 1084, 641, 309, -7, -342, -676, -1011, -1357, -1715, -2086, -2493, -2956, -3450, -3942, -4441, -4991, -5593, -6178, -6682, -7112, -7511, -7901, -8266, -8596, -8897, -9159, -9396, -9649, -9950, -10262, -10550, -10832, -11155, -11507, -11831, -12111, -12390, -12695, -12989, -13217, -13364, -13438, -13454, -13433, -13413, -13390, -13345, -13283, -13248, -13262, -13299, -13335, -13385, -13467, -13541, -13552, -13483, -13377, -13258, -13116, -12921, -12676, -12409, -12148, -11906, -11668, -11427, -11209, -11056, -10968, -10910, -10855, -10810, -10782, -10785, -10827, -10882, -10874, -10762, -10587, -10437, -10327, -10196, -10001, -9779, -9568, -9379, -9223, -9119, -9056, -8988, -8905, -8846, -8822, -8782, -8692, -8587, -8502, -8397, -8221, -7984, -7755, -7553, -7345, -7115, -6896, -6727, -6599, -6495, -6414, -6365, -6335, -6316, -6320, -6327, -6272, -6134, -5977, -5863, -5758, -5591, -5376, -5179, -5008, -4822, -4614, -4432, -4319, -4275, -4267, -4252, -4202, -4134, -4084, -4063, -4041, -3971, -3835, -3660, -3497, -3373, -3264, -3134, -2985, -2855, -2778, -2736, -2701, -2655, -2614, -2590, -2593, -2611, -2627, -2624, -2619, -2643, -2693, -2715, -2674, -2609, -2597, -2664, -2769, -2866, -2948, -3015, -3063, -3110, -3190, -3295, -3373, -3392, -3364, -3294, -3196, -3119, -3087, -3051, -2953, -2829, -2752, -2739, -2751, -2763, -2778, -2778, -2742, -2687, -2655, -2657, -2650, -2582, -2450, -2293, -2137, -1990, -1838, -1685, -1571, -1533, -1539, -1501, -1391, -1288, -1279, -1347, -1403, -1391, -1322, -1231, -1132, -1025, -917, -821, -750, -710, -686, -654, -610, -601, -664, -776, -871, -910, -904, -894, -911, -926, -848, -625, -321, -63, 110, 275, 511, 793, 1041, 1220, 1346, 1440, 1513, 1580, 1630, 1619, 1558, 1554, 1706, 1963, 2179, 2296, 2405, 2589, 2822, 3037, 3256, 3515, 3763, 3910, 3952, 3967, 4022, 4131, 4288, 4475, 4634, 4711, 4749, 4848, 5049, 5291, 5494, 5637, 5717, 5749, 5801, 5915, 6019, 5994, 5835, 5662, 5579, 5594, 5649, 5681, 5647, 5550, 5443, 5383, 5390, 5442, 5512, 5561, 5535, 5390, 5161, 4966, 4895, 4915, 4900, 4783, 4621, 4486, 4391, 4312, 4252, 4222, 4193, 4126, 4031, 3933, 3839, 3736, 3633, 3541, 3434, 3284, 3125, 3023, 2983, 2943, 2863, 2757, 2659, 2615, 2656, 2746, 2776, 2705, 2596, 2503, 2415, 2315, 2229, 2162, 2084, 1975, 1841, 1695, 1567, 1496, 1473, 1435, 1345, 1236, 1169, 1153, 1143, 1099, 1021, 936, 883, 888, 922, 920, 852, 778, 761, 786, 805, 823, 855, 870, 833, 773, 747, 770, 817, 874, 942, 1015, 1079, 1139, 1235, 1390, 1574, 1736, 1855, 1963, 2093, 2230, 2334, 2395, 2439, 2501, 2570, 2615, 2624, 2621, 2643, 2703, 2796, 2903, 3016, 3133, 3247, 3336, 3373, 3364, 3345, 3345, 3373, 3418, 3430, 3358, 3247, 3207, 3274, 3359, 3376, 3344, 3320, 3296, 3227, 3114, 2986, 2843, 2657, 2434, 2207, 1994, 1788, 1599, 1468, 1386, 1290, 1153, 1039, 1022, 1073, 1077, 968, 776, 562, 352, 152, -29, -205, -411, -654, -862, -946, -895, -761, -581, -370, -144, 91, 358, 643, 883, 1049, 1181, 1292, 1345, 1344, 1374, 1475, 1572, 1600, 1637, 1816, 2165, 2589, 3003, 3392, 3756, 4104, 4477, 4918, 5370, 5719, 5911, 6022, 6133, 6237, 6306, 6388, 6547, 6764, 6978, 7197, 7472, 7798, 8130, 8470, 8834, 9197, 9502, 9742, 9953, 10126, 10206, 10187, 10141, 10119, 10122, 10147, 10209, 10274, 10300, 10326, 10434, 10598, 10729, 10824, 10930, 11025, 11013, 10876, 10707, 10577, 10467, 10323, 10140, 9937, 9721, 9528, 9406, 9359, 9304, 9184, 9044, 8954, 8903, 8805, 8604, 8315, 7991, 7657, 7330, 7007, 6683, 6343, 5985, 5624, 5283, 4968, 4685, 4444, 4247, 4047, 3775, 3415, 3023, 2675, 2374, 2049, 1632, 1135, 628, 173, -238, -653, -1075, -1472, -1827, -2144, -2426, -2675, -2932, -3236, -3577, -3940, -4333, -4734, -5116, -5514, -5978, -6467, -6899, -7286, -7695, -8094, -8394, -8592, -8786, -9020, -9239, -9398, -9531, -9693, -9884, -10066, -10227, -10407, -10621, -10825, -10990, -11119, -11248, -11366, -11440, -11462, -11466, -11471, -11452, -11399, -11352, -11369, -11441, -11502, -11503, -11493, -11538, -11639, -11732, -11794, -11860, -11921, -11917, -11848, -11788, -11762, -11715, -11611, -11506, -11453, -11409, -11310, -11202, -11170, -11205, -11211, -11163, -11138, -11171, -11191, -11132, -11028, -10937, -10845, -10717, -10556, -10404, -10272, -10136, -10004, -9905, -9838, -9766, -9685, -9640, -9657, -9682, -9657, -9587, -9506, -9419, -9313, -9200, -9080, -8918, -8692, -8467, -8301, -8173, -8040, -7913, -7824, -7758, -7687, -7626, -7583, -7540, -7458, -7349, -7238, -7117, -6949, -6727, -6504, -6319, -6165, -6018, -5874, -5729, -5581, -5441, -5318, -5225, -5163, -5111, -5035, -4920, -4801, -4713, -4647, -4573, -4486, -4395, -4296, -4186, -4111, -4122, -4165, -4138, -4031, -3964, -3993, -4030, -4007, -3974, -3959, -3880, -3681, -3455, -3314, -3219, -3071, -2886, -2764, -2695, -2589, -2479, -2470, -2532, -2527, -2454, -2432, -2476, -2462, -2355, -2259, -2227, -2189, -2095, -2002, -1956, -1891, -1746, -1582, -1498, -1487, -1489, -1508, -1550, -1550, -1440, -1253, -1089, -994, -935, -842, -663, -392, -87, 159, 281, 297, 299, 368, 542, 786, 992, 1075, 1102, 1219, 1468, 1765, 2047, 2322, 2570, 2750, 2920, 3180, 3508, 3790, 3981, 4143, 4321, 4495, 4659, 4847, 5079, 5303, 5459, 5552, 5665, 5860, 6107, 6338, 6522, 6671, 6809, 6936, 7057, 7191, 7348, 7486, 7567, 7600, 7654, 7770, 7925, 8063, 8178, 8287, 8380, 8440, 8499, 8616, 8756, 8822, 8799, 8774, 8798, 8800, 8731, 8653, 8633, 8618, 8518, 8374, 8290, 8261, 8187, 8055, 7946, 7873, 7776, 7653, 7558, 7466, 7321, 7141, 7002, 6918, 6837, 6720, 6579, 6434, 6299, 6186, 6090, 5964, 5778, 5588, 5457, 5349, 5170, 4938, 4734, 4574, 4391, 4181, 3999, 3858, 3715, 3550, 3392, 3247, 3104, 2969, 2867, 2780, 2648, 2463, 2294, 2189, 2089, 1932, 1753, 1644, 1611, 1554, 1404, 1223, 1110, 1089, 1100, 1080, 1010, 903, 797, 740, 759, 816, 846, 828, 797, 781, 784, 799, 837, 884, 902, 884, 875, 917, 980, 1011, 999, 986, 986, 992, 1020, 1087, 1157, 1165, 1117, 1094, 1140, 1196, 1202, 1181, 1174, 1153, 1080, 1006, 994, 1008, 994, 988, 1050, 1136, 1167, 1153, 1153, 1166, 1143, 1098, 1088, 1099, 1050, 925, 807, 747, 688, 597, 530, 529, 543, 514, 441, 352, 261, 180, 126, 83, 0, -159, -380, -619, -847, -1062, -1262, -1445, -1612, -1756, -1856, -1889, -1877, -1869, -1879, -1865, -1805, -1753, -1756, -1796, -1833, -1865, -1905, -1946, -1988, -2031, -2043, -1980, -1857, -1746, -1668, -1563, -1384, -1167, -979, -825, -644, -411, -183, -18, 115, 282, 462, 596, 722, 926, 1179, 1387, 1577, 1855, 2205, 2496, 2719, 3014, 3431, 3828, 4081, 4265, 4507, 4785, 4980, 5103, 5267, 5499, 5719, 5908, 6121, 6365, 6564, 6712, 6914, 7217, 7505, 7682, 7803, 7965, 8139, 8253, 8325, 8405, 8480, 8518, 8551, 8606, 8665, 8698, 8724, 8772, 8833, 8896, 8952, 8998, 8995, 8926, 8826, 8736, 8648, 8516, 8342, 8156, 7974, 7794, 7624, 7464, 7303, 7124, 6950, 6809, 6688, 6551, 6395, 6251, 6107, 5925, 5696, 5456, 5215, 4945, 4656, 4371, 4076, 3754, 3443, 3214, 3036, 2805, 2495, 2212, 2025, 1848, 1587, 1279, 991, 694, 353, 6, -309, -632, -983, -1317, -1614, -1925, -2274, -2607, -2871, -3087, -3310, -3555, -3804, -4051, -4315, -4604, -4893, -5162, -5434, -5728, -6021, -6278, -6509, -6747, -6988, -7182, -7319, -7440, -7582, -7733, -7874, -8028, -8225, -8439, -8631, -8808, -8985, -9144, -9281, -9470, -9736, -9979, -10103, -10143, -10161, -10167, -10187, -10262, -10359, -10394, -10367, -10354, -10380, -10417, -10472, -10565, -10667, -10720, -10728, -10743, -10776, -10796, -10748, -10644, -10531, -10438, -10350, -10256, -10184, -10129, -10041, -9896, -9773, -9762, -9828, -9861, -9814, -9743, -9687, -9611, -9491, -9372, -9285, -9175, -8982, -8742, -8525, -8336, -8169, -8041, -7946, -7837, -7719, -7636, -7585, -7543, -7521, -7499, -7398, -7210, -7028, -6871, -6677, -6453, -6282, -6129, -5896, -5626, -5457, -5387, -5284, -5102, -4925, -4809, -4709, -4580, -4438, -4318, -4196, -4032, -3841, -3677, -3548, -3418, -3267, -3128, -3028, -2952, -2873, -2806, -2791, -2827, -2857, -2827, -2745, -2673, -2649, -2648, -2606, -2491, -2341, -2210, -2118, -2060, -2026, -2002, -1965, -1906, -1850, -1834, -1868, -1920, -1945, -1912, -1820, -1709, -1624, -1582, -1553, -1490, -1365, -1188, -998, -850, -785, -808, -856, -840, -720, -560, -477, -514, -577, -518, -303, -39, 163, 303, 442, 610, 798, 989, 1162, 1286, 1354, 1395, 1439, 1497, 1564, 1636, 1716, 1812, 1912, 2001, 2090, 2227, 2419, 2615, 2768, 2877, 2946, 2966, 2983, 3057, 3145, 3140, 3048, 2978, 2976, 2980, 2960, 2950, 2979, 3026, 3057, 3057, 3060, 3119, 3223, 3268, 3198, 3102, 3099, 3171, 3208, 3157, 3061, 2979, 2936, 2919, 2918, 2941, 3005, 3080, 3118, 3135, 3185, 3262, 3307, 3315, 3339, 3370, 3342, 3268, 3253, 3346, 3451, 3461, 3386, 3345, 3412, 3568, 3735, 3828, 3806, 3723, 3706, 3827, 3982, 3999, 3857, 3720, 3720, 3790, 3804, 3772, 3781, 3841, 3895, 3917, 3923, 3938, 3996, 4097, 4152, 4084, 3952, 3866, 3840, 3830, 3821, 3803, 3729, 3613, 3555, 3602, 3670, 3671, 3616, 3575, 3567, 3569, 3557, 3536, 3511, 3474, 3424, 3375, 3349, 3336, 3316, 3289, 3263, 3220, 3149, 3102, 3137, 3220, 3252, 3194, 3120, 3107, 3131, 3127, 3080, 3028, 2974, 2894, 2808, 2767, 2768, 2768, 2739, 2677, 2587, 2510, 2495, 2519, 2504, 2450, 2393, 2314, 2193, 2097, 2077, 2051, 1952, 1836, 1769, 1712, 1647, 1625, 1653, 1646, 1573, 1508, 1503, 1509, 1468, 1378, 1290, 1232, 1193, 1147, 1088, 1034, 988, 951, 945, 974, 994, 969, 950, 995, 1044, 1011, 923, 875, 871, 853, 814, 767, 688, 583, 515, 507, 504, 480, 455, 443, 423, 394, 377, 365, 341, 304, 261, 210, 155, 101, 52, 27, 27, 16, -42, -112, -124, -87, -82, -139, -196, -200, -186, -209, -248, -247, -216, -215, -259, -306, -333, -343, -319, -250, -188, -187, -217, -193, -92, 25, 81, 63, 25, 21, 59, 103, 145, 204, 255, 270, 275, 332, 442, 555, 656, 762, 853, 894, 911, 955, 1030, 1083, 1091, 1074, 1042, 966, 842, 713, 614, 555, 556, 619, 670, 619, 513, 479, 546, 607, 600, 586, 621, 648, 609, 550, 539, 526, 432, 312, 270, 286, 275, 234, 210, 194, 150, 102, 74, 53, 34, 33, 22, -42, -146, -216, -207, -136, -85, -139, -253, -266, -141, -42, -46, -13, 107, 160, 107, 140, 316, 438, 427, 451, 597, 723, 730, 713, 773, 863, 913, 951, 1055, 1225, 1374, 1452, 1510, 1617, 1755, 1874, 1984, 2132, 2275, 2342, 2362, 2447, 2620, 2769, 2819, 2851, 2970, 3147, 3271, 3334, 3415, 3528, 3607, 3639, 3698, 3815, 3920, 3957, 3968, 4020, 4088, 4118, 4121, 4135, 4141, 4116, 4106, 4134, 4140, 4091, 4058, 4074, 4077, 4038, 4009, 4005, 3981, 3920, 3866, 3815, 3726, 3601, 3490, 3413, 3342, 3262, 3179, 3092, 2990, 2870, 2754, 2664, 2581, 2486, 2381, 2282, 2186, 2077, 1953, 1832, 1727, 1624, 1495, 1336, 1179, 1053, 946, 813, 637, 451, 291, 148, -4, -153, -262, -355, -501, -695, -867, -988, -1109, -1264, -1421, -1542, -1644, -1762, -1889, -2008, -2119, -2235, -2352, -2459, -2562, -2676, -2801, -2935, -3077, -3233, -3390, -3528, -3654, -3805, -3977, -4125, -4222, -4315, -4435, -4547, -4628, -4711, -4812, -4904, -4980, -5075, -5188, -5278, -5352, -5453, -5572, -5653, -5693, -5755, -5863, -5963, -6010, -6049, -6124, -6204, -6232, -6235, -6264, -6308, -6324, -6312, -6315, -6334, -6340, -6324, -6299, -6276, -6247, -6211, -6168, -6119, -6063, -6021, -6003, -5984, -5939, -5890, -5865, -5849, -5804, -5739, -5688, -5650, -5610, -5572, -5550, -5530, -5485, -5431, -5397, -5376, -5322, -5232, -5156, -5107, -5055, -4984, -4925, -4886, -4839, -4774, -4716, -4683, -4661, -4636, -4610, -4587, -4563, -4541, -4521, -4488, -4430, -4358, -4309, -4287, -4261, -4221, -4194, -4186, -4170, -4127, -4082, -4058, -4041, -4012, -3985, -3975, -3973, -3955, -3927, -3906, -3888, -3858, -3828, -3809, -3787, -3744, -3697, -3668, -3649, -3625, -3604, -3592, -3577, -3549, -3512, -3471, -3426, -3377, -3322, -3260, -3188, -3111, -3026, -2933, -2834, -2734, -2639, -2553, -2482, -2423, -2364, -2285, -2191, -2105, -2034, -1958, -1853, -1721, -1580, -1431, -1270, -1104, -955, -826, -702, -580, -482, -417, -358, -283, -198, -118, -37, 53, 150, 266, 419, 596, 770, 936, 1093, 1220, 1320, 1433, 1570, 1694, 1800, 1916, 2036, 2116, 2170, 2236, 2320, 2400, 2488, 2605, 2741, 2884, 3035, 3186, 3317, 3430, 3541, 3643, 3705, 3728, 3749, 3800, 3888, 4003, 4128, 4252, 4370, 4488, 4607, 4717, 4804, 4855, 4884, 4931, 5023, 5143, 5253, 5333, 5386, 5406, 5399, 5402, 5431, 5471, 5502, 5532, 5567, 5603, 5651, 5713, 5765, 5783, 5782, 5773, 5743, 5702, 5678, 5661, 5615, 5548, 5517, 5530, 5529, 5474, 5402, 5361, 5345, 5312, 5252, 5195, 5151, 5086, 4991, 4905, 4869, 4880, 4896, 4913, 4949, 5026, 5099, 5106, 5096, 5180, 5293, 5234, 5033, 4939, 4976, 5002, 5140, 5520, 5802, 5688, 5580, 5867, 6159, 6051, 5836, 5770, 5647, 5550, 5804, 5994, 5455, 4599, 4303, 4390, 4163, 3866, 4170, 4852, 5144, 4886, 4420, 3866, 3148, 2400, 1880, 1665, 1737, 2173, 2921, 3541, 3569, 2977, 1902, 237, -1878, -3602, -4182, -3794, -2861, -1148, 1744, 5521, 9236, 11605, 11364, 8277, 3663, -746, -3919, -5145, -4011, -1425, 977, 2766, 4326, 5028, 4062, 2211, 496, -1452, -3604, -4316, -2914, -908, 665, 2137, 2917, 1699, -902, -3087, -4641, -6202, -7074, -6394, -5040, -4261, -3876, -3290, -2827, -3009, -3702, -4492, -5087, -5154, -4483, -3343, -2293, -1632, -1367, -1583, -2526, -4219, -6200, -7807, -8582, -8290, -6908, -4771, -2555, -888, -118, -431, -1806, -3835, -5836, -7306, -8089, -8132, -7341, -5779, -3838, -2015, -606, 282, 483, -188, -1607, -3212, -4389, -4857, -4611, -3728, -2494, -1464, -1005, -901, -760, -608, -752, -1282, -1994, -2607, -2834, -2501, -1737, -880, -160, 312, 341, -238, -1246, -2229, -2935, -3474, -3901, -3954, -3417, -2489, -1537, -715, -153, -159, -873, -1919, -2757, -3232, -3548, -3861, -4117, -4213, -4092, -3718, -3118, -2469, -2008, -1851, -2039, -2578, -3176, -3229, -2455, -1287, -269, 515, 1090, 1254, 957, 400, -417, -1565, -2603, -2960, -2701, -2238, -1592, -630, 472, 1546, 2609, 3403, 3443, 2761, 1898, 1194, 681, 475, 615, 750, 567, 259, 206, 491, 955, 1444, 1871, 2231, 2549, 2691, 2434, 1859, 1395, 1330, 1514, 1615, 1438, 941, 247, -326, -468, -198, 160, 419, 738, 1258, 1799, 2150, 2449, 2917, 3369, 3367, 2772, 1858, 917, 48, -699, -1233, -1530, -1672, -1709, -1572, -1191, -637, -91, 305, 479, 376, 55, -174, 46, 698, 1309, 1481, 1260, 882, 400, -211, -826, -1245, -1408, -1391, -1311, -1227, -1055, -676, -205, 37, -23, -37, 313, 796, 865, 348, -364, -833, -1011, -1038, -825, -182, 669, 1125, 908, 456, 313, 321, -165, -1336, -2563, -3100, -2861, -2371, -2115, -2133, -2244, -2432, -2830, -3364, -3690, -3556, -3060, -2460, -1855, -1199, -558, -123, 6, -106, -491, -1291, -2411, -3437, -4060, -4288, -4180, -3795, -3406, -3263, -3212, -2992, -2690, -2364, -1695, -496, 902, 2149, 3166, 3793, 3891, 3753, 3643, 3274, 2462, 1772, 1697, 1899, 1919, 1900, 2069, 2291, 2497, 2857, 3287, 3481, 3555, 4033, 5016, 5896, 6209, 6285, 6621, 7084, 7288, 7318, 7353, 7193, 6769, 6504, 6564, 6522, 6222, 6044, 6099, 6142, 6220, 6466, 6575, 6386, 6329, 6588, 6645, 6251, 5869, 5740, 5538, 5188, 5081, 5332, 5654, 5937, 6309, 6687, 6798, 6564, 6129, 5567, 4808, 3850, 2914, 2281, 1970, 1699, 1280, 889, 777, 832, 723, 428, 292, 503, 817, 953, 1024, 1240, 1410, 1147, 495, -127, -572, -1120, -1965, -2946, -3790, -4376, -4727, -4960, -5182, -5346, -5316, -5114, -4920, -4841, -4853, -4917, -5034, -5130, -5099, -4977, -4967, -5188, -5509, -5741, -5874, -5987, -6112, -6301, -6653, -7079, -7316, -7268, -7105, -6990, -6947, -7012, -7188, -7329, -7284, -7129, -7015, -6922, -6721, -6401, -6039, -5640, -5159, -4652, -4248, -3946, -3644, -3348, -3221, -3324, -3522, -3687, -3839, -4037, -4271, -4478, -4562, -4436, -4143, -3811, -3452, -2913, -2151, -1369, -812, -511, -347, -224, -134, -111, -179, -344, -579, -825, -1027, -1192, -1366, -1566, -1752, -1898, -2031, -2162, -2220, -2093, -1765, -1375, -1091, -924, -784, -682, -751, -981, -1196, -1318, -1455, -1633, -1715, -1657, -1612, -1679, -1736, -1664, -1552, -1565, -1724, -1917, -2091, -2283, -2500, -2714, -2911, -3044, -3011, -2801, -2563, -2426, -2350, -2255, -2149, -2050, -1924, -1775, -1686, -1676, -1647, -1544, -1474, -1571, -1792, -2007, -2201, -2478, -2840, -3157, -3330, -3384, -3367, -3284, -3140, -2958, -2768, -2596, -2478, -2420, -2351, -2190, -1966, -1801, -1732, -1683, -1618, -1538, -1413, -1279, -1329, -1653, -2027, -2227, -2360, -2600, -2854, -2960, -2968, -2982, -2978, -2924, -2861, -2761, -2534, -2188, -1796, -1382, -933, -493, -107, 219, 460, 561, 533, 430, 283, 115, -17, -76, -78, -39, 35, 111, 186, 329, 545, 712, 780, 865, 1026, 1185, 1346, 1639, 2064, 2468, 2797, 3091, 3337, 3547, 3822, 4121, 4219, 4041, 3745, 3401, 2965, 2573, 2422, 2399, 2216, 1869, 1632, 1677, 1970, 2421, 2902, 3227, 3309, 3274, 3359, 3685, 4175, 4616, 4805, 4686, 4390, 4142, 4084, 4176, 4237, 4105, 3767, 3336, 2948, 2751, 2900, 3375, 3876, 4114, 4155, 4238, 4418, 4634, 4835, 4830, 4429, 3925, 3872, 4231, 4410, 4217, 4052, 4124, 4259, 4449, 4869, 5376, 5555, 5270, 4786, 4403, 4175, 3917, 3412, 2705, 2180, 2171, 2529, 2766, 2687, 2657, 3065, 3743, 4209, 4317, 4270, 4144, 3835, 3372, 2924, 2599, 2415, 2306, 2102, 1742, 1453, 1403, 1390, 1245, 1192, 1407, 1642, 1643, 1566, 1627, 1767, 1860, 1861, 1716, 1399, 1029, 679, 244, -279, -630, -619, -396, -211, -126, -42, 113, 343, 579, 707, 646, 458, 278, 112, -199, -734, -1331, -1773, -2005, -2059, -1929, -1680, -1485, -1412, -1335, -1148, -927, -804, -846, -1055, -1341, -1539, -1577, -1610, -1827, -2170, -2340, -2135, -1704, -1410, -1433, -1601, -1657, -1612, -1630, -1698, -1671, -1583, -1628, -1805, -1882, -1744, -1547, -1467, -1477, -1445, -1307, -1052, -673, -224, 153, 358, 438, 503, 590, 691, 773, 712, 373, -143, -504, -495, -264, -116, -156, -188, 66, 653, 1304, 1739, 1978, 2187, 2327, 2208, 1851, 1570, 1617, 1916, 2102, 1826, 1178, 754, 1027, 1729, 2171, 2083, 1741, 1412, 1125, 882, 737, 673, 637, 586, 509, 557, 1017, 1886, 2648, 2834, 2566, 2277, 2161, 2114, 1956, 1506, 745, 26, -191, 147, 656, 961, 968, 832, 804, 966, 1074, 870, 453, 121, -30, -40, 148, 541, 918, 1080, 1070, 1012, 967, 964, 896, 492, -287, -984, -1136, -883, -757, -989, -1331, -1445, -1318, -1297, -1713, -2430, -2973, -3157, -3248, -3415, -3454, -3156, -2436, -1175, 529, 2133, 3201, 3882, 4363, 4416, 4003, 3565, 3247, 2611, 1495, 401, -200, -268, 128, 851, 1579, 2115, 2605, 3183, 3822, 4607, 5592, 6497, 7068, 7533, 8166, 8709, 8852, 8828, 8964, 8998, 8449, 7468, 6737, 6574, 6602, 6410, 6165, 6327, 6955, 7642, 8063, 8299, 8528, 8709, 8678, 8416, 8073, 7825, 7788, 7945, 8081, 7964, 7646, 7448, 7542, 7714, 7613, 7091, 6265, 5336, 4489, 3862, 3417, 2934, 2282, 1665, 1396, 1475, 1591, 1513, 1274, 1068, 1045, 1132, 1030, 596, 121, -118, -339, -903, -1708, -2421, -3032, -3762, -4670, -5676, -6706, -7590, -8089, -8179, -8095, -8018, -7946, -7798, -7503, -7087, -6745, -6685, -6896, -7267, -7796, -8427, -8907, -9121, -9354, -9861, -10404, -10586, -10463, -10454, -10716, -10952, -10933, -10803, -10760, -10727, -10557, -10294, -10011, -9681, -9318, -9002, -8688, -8317, -8035, -7968, -7956, -7819, -7668, -7644, -7604, -7389, -7106, -6928, -6842, -6734, -6556, -6352, -6212, -6172, -6101, -5865, -5537, -5225, -4796, -4089, -3259, -2535, -1918, -1401, -1119, -993, -725, -377, -363, -772, -1244, -1590, -1910, -2157, -2162, -2036, -2039, -2128, -2045, -1756, -1462, -1203, -810, -274, 169, 410, 608, 839, 919, 756, 509, 246, -219, -940, -1605, -1966, -2221, -2693, -3284, -3594, -3491, -3251, -3101, -2998, -2868, -2747, -2677, -2703, -2871, -3089, -3175, -3190, -3402, -3810, -4103, -4182, -4284, -4554, -4851, -5043, -5168, -5313, -5524, -5773, -5944, -5963, -5919, -5932, -5944, -5839, -5698, -5700, -5830, -5885, -5775, -5605, -5492, -5418, -5310, -5154, -5003, -4848, -4597, -4268, -4092, -4195, -4357, -4358, -4357, -4538, -4682, -4565, -4404, -4392, -4266, -3826, -3385, -3195, -3001, -2555, -2093, -1882, -1720, -1321, -856, -684, -712, -514, -30, 357, 443, 413, 430, 481, 579, 740, 836, 864, 1058, 1494, 1894, 2082, 2275, 2648, 2988, 3034, 2893, 2845, 2921, 2939, 2860, 2835, 2922, 3045, 3242, 3632, 4143, 4556, 4798, 4939, 5011, 4997, 4904, 4715, 4427, 4133, 3891, 3609, 3287, 3173, 3394, 3697, 3792, 3744, 3773, 3916, 4089, 4297, 4505, 4493, 4171, 3891, 3994, 4167, 3906, 3433, 3356, 3511, 3171, 2358, 1899, 2127, 2457, 2367, 2028, 1885, 2116, 2542, 2826, 2795, 2582, 2358, 2095, 1770, 1486, 1251, 957, 700, 704, 900, 1029, 1157, 1547, 2047, 2192, 1933, 1701, 1643, 1331, 548, -183, -359, -294, -546, -916, -798, -190, 372, 697, 1006, 1326, 1375, 1055, 619, 318, 178, 155, 232, 337, 370, 419, 777, 1557, 2438, 2951, 2967, 2739, 2511, 2336, 2262, 2352, 2515, 2618, 2762, 3040, 3231, 3264, 3564, 4280, 4761, 4527, 4124, 4211, 4582, 4777, 4915, 5244, 5568, 5688, 5826, 6164, 6407, 6221, 5755, 5398, 5215, 4966, 4612, 4434, 4597, 4949, 5308, 5689, 6105, 6399, 6465, 6423, 6380, 6186, 5711, 5137, 4702, 4371, 4051, 3869, 3924, 4031, 4048, 4119, 4331, 4423, 4176, 3811, 3660, 3613, 3307, 2757, 2336, 2134, 1904, 1624, 1506, 1468, 1248, 966, 909, 904, 586, 79, -173, -122, -98, -282, -539, -723, -852, -1043, -1360, -1728, -2038, -2304, -2598, -2863, -3007, -3080, -3133, -3051, -2776, -2479, -2264, -1984, -1626, -1474, -1653, -1927, -2130, -2390, -2770, -3108, -3349, -3645, -3982, -4080, -3812, -3446, -3259, -3124, -2750, -2175, -1745, -1613, -1586, -1497, -1413, -1385, -1289, -1140, -1222, -1601, -1819, -1492, -966, -872, -1182, -1263, -843, -373, -282, -376, -275, -38, 50, 34, 180, 482, 674, 693, 733, 870, 980, 1067, 1273, 1508, 1441, 1064, 878, 1225, 1782, 2016, 1845, 1561, 1392, 1420, 1640, 1854, 1737, 1255, 835, 884, 1288, 1610, 1674, 1657, 1671, 1637, 1585, 1710, 1975, 2016, 1595, 950, 496, 334, 236, 41, -163, -257, -257, -244, -205, -13, 414, 896, 1035, 703, 331, 405, 732, 652, -34, -777, -1054, -1025, -1109, -1283, -1306, -1296, -1499, -1692, -1529, -1255, -1364, -1783, -2064, -2138, -2276, -2527, -2720, -2770, -2722, -2643, -2636, -2721, -2674, -2266, -1700, -1502, -1857, -2279, -2174, -1595, -1191, -1377, -1853, -2066, -1922, -1786, -1938, -2299, -2685, -3018, -3238, -3237, -3044, -2876, -2853, -2780, -2429, -1920, -1581, -1478, -1426, -1436, -1799, -2634, -3646, -4454, -4952, -5310, -5699, -6048, -6030, -5377, -4200, -2874, -1644, -560, 310, 851, 1081, 1141, 1062, 718, 60, -705, -1281, -1554, -1639, -1630, -1435, -907, -85, 759, 1400, 1926, 2645, 3606, 4482, 5067, 5590, 6243, 6792, 7011, 7093, 7233, 7234, 6910, 6503, 6318, 6285, 6186, 6099, 6337, 7054, 7966, 8604, 8925, 9440, 10396, 11179, 11153, 10640, 10374, 10360, 10095, 9573, 9269, 9342, 9490, 9548, 9642, 9870, 10151, 10365, 10444, 10358, 10071, 9583, 9030, 8615, 8324, 7898, 7307, 6922, 6913, 6892, 6556, 6203, 6135, 6124, 5890, 5542, 5203, 4759, 4218, 3754, 3345, 2797, 2139, 1517, 904, 246, -349, -821, -1320, -1913, -2350, -2420, -2326, -2441, -2788, -3080, -3217, -3422, -3822, -4280, -4725, -5300, -6050, -6759, -7255, -7623, -7978, -8232, -8274, -8206, -8192, -8185, -8046, -7845, -7800, -7936, -8041, -8023, -8042, -8221, -8439, -8552, -8633, -8789, -8913, -8882, -8805, -8849, -8946, -8941, -8829, -8667, -8404, -8013, -7581, -7190, -6817, -6459, -6166, -5935, -5720, -5510, -5327, -5186, -5100, -5037, -4920, -4711, -4469, -4240, -4009, -3797, -3675, -3595, -3419, -3169, -3017, -2994, -2903, -2597, -2155, -1746, -1444, -1249, -1139, -1035, -838, -603, -533, -702, -909, -967, -976, -1110, -1310, -1405, -1434, -1573, -1809, -1928, -1877, -1858, -1986, -2115, -2133, -2128, -2112, -1946, -1700, -1653, -1852, -2060, -2178, -2320, -2532, -2804, -3229, -3819, -4352, -4655, -4845, -5078, -5310, -5437, -5484, -5493, -5405, -5199, -5026, -5018, -5077, -5075, -5113, -5280, -5385, -5321, -5384, -5793, -6260, -6468, -6560, -6762, -6968, -7055, -7144, -7262, -7190, -6850, -6451, -6148, -5877, -5580, -5361, -5282, -5235, -5106, -4954, -4932, -5065, -5219, -5273, -5205, -5038, -4800, -4568, -4432, -4337, -4115, -3750, -3458, -3330, -3190, -2905, -2583, -2296, -1996, -1751, -1642, -1473, -1070, -702, -663, -685, -387, 38, 199, 216, 473, 897, 1105, 1102, 1291, 1763, 2106, 2084, 2020, 2248, 2596, 2747, 2790, 3012, 3401, 3727, 3930, 4171, 4556, 4960, 5157, 5127, 5094, 5184, 5196, 4951, 4615, 4393, 4205, 3991, 3987, 4296, 4551, 4473, 4376, 4696, 5310, 5720, 5702, 5501, 5434, 5468, 5238, 4631, 4113, 4062, 4094, 3668, 3054, 2851, 2961, 2967, 3008, 3367, 3727, 3711, 3527, 3480, 3505, 3521, 3524, 3325, 2893, 2596, 2502, 2194, 1761, 1876, 2457, 2516, 1831, 1412, 1857, 2473, 2478, 2039, 1660, 1378, 1045, 878, 1169, 1669, 1757, 1292, 863, 998, 1482, 1835, 2051, 2323, 2359, 1821, 1152, 1071, 1451, 1617, 1478, 1421, 1401, 1112, 808, 1056, 1820, 2455, 2545, 2330, 2336, 2825, 3559, 4061, 4080, 3799, 3595, 3660, 3878, 4043, 4063, 3927, 3674, 3521, 3767, 4388, 4989, 5303, 5462, 5639, 5800, 5919, 6054, 6166, 6142, 6012, 5884, 5744, 5554, 5443, 5546, 5767, 5901, 5936, 6048, 6310, 6584, 6698, 6620, 6393, 6130, 6030, 6176, 6322, 6120, 5630, 5282, 5265, 5276, 5061, 4843, 4903, 5011, 4763, 4287, 4089, 4231, 4228, 3880, 3621, 3715, 3700, 3139, 2472, 2376, 2620, 2437, 1800, 1395, 1452, 1520, 1381, 1298, 1330, 1141, 665, 329, 373, 444, 152, -376, -853, -1308, -1812, -2042, -1706, -1214, -1290, -1876, -2147, -1777, -1389, -1420, -1501, -1438, -1716, -2438, -2858, -2615, -2366, -2639, -3049, -3141, -3073, -3014, -2720, -2181, -1999, -2472, -2922, -2690, -2226, -2282, -2587, -2488, -2301, -2740, -3477, -3534, -2852, -2311, -2394, -2728, -2884, -2874, -2778, -2487, -2049, -1838, -2067, -2375, -2304, -1982, -1889, -2064, -2109, -1998, -2173, -2672, -2837, -2311, -1704, -1710, -2061, -2037, -1630, -1439, -1547, -1359, -698, -347, -1004, -2080, -2288, -1364, -458, -505, -1065, -1300, -1216, -1184, -1070, -722, -577, -948, -1403, -1519, -1583, -1881, -1990, -1535, -1100, -1443, -2161, -2192, -1530, -1191, -1518, -1899, -2096, -2434, -2752, -2622, -2369, -2569, -2963, -3005, -2909, -3112, -3298, -2950, -2375, -2295, -2740, -3056, -2897, -2552, -2315, -2126, -1989, -2157, -2579, -2693, -2260, -1926, -2279, -2779, -2603, -2198, -2601, -3430, -3236, -2027, -1529, -2510, -3574, -3288, -2079, -1338, -1590, -2133, -2051, -1216, -319, 38, 7, 41, 207, 324, 331, 113, -488, -1230, -1591, -1584, -1705, -2012, -2033, -1577, -940, -336, 220, 680, 1099, 1803, 2895, 3878, 4169, 3790, 3282, 3024, 2749, 1791, -65, -2113, -3442, -4023, -4576, -5413, -5969, -5562, -4127, -2118, -64, 1717, 3208, 4583, 5808, 6430, 6006, 4782, 3568, 2756, 1857, 299, -1670, -3256, -3942, -3785, -3189, -2580, -2015, -1125, 252, 1618, 2506, 3242, 4435, 5955, 7034, 7233, 6850, 6450, 6306, 6282, 6029, 5266, 4046, 2818, 2190, 2410, 3022, 3308, 3228, 3557, 4781, 6351, 7455, 8036, 8491, 8905, 9127, 9206, 9207, 9029, 8707, 8485, 8393, 8143, 7664, 7328, 7407, 7615, 7474, 6939, 6391, 6068, 5842, 5630, 5674, 6148, 6708, 6949, 7049, 7455, 8048, 8321, 8238, 8137, 7951, 7315, 6345, 5517, 4877, 4078, 3072, 2218, 1677, 1250, 833, 587, 551, 504, 388, 458, 820, 1210, 1466, 1703, 1865, 1644, 1030, 405, -48, -613, -1556, -2783, -4032, -5134, -5986, -6489, -6687, -6770, -6802, -6617, -6127, -5570, -5199, -4962, -4703, -4475, -4436, -4609, -4920, -5302, -5697, -6071, -6471, -6953, -7461, -7890, -8241, -8609, -8980, -9188, -9115, -8853, -8565, -8264, -7844, -7230, -6467, -5716, -5213, -5047, -5014, -4870, -4687, -4717, -5018, -5436, -5828, -6082, -6141, -6116, -6196, -6325, -6248, -5897, -5470, -5107, -4743, -4281, -3725, -3143, -2626, -2228, -1903, -1562, -1241, -1110, -1248, -1498, -1678, -1834, -2133, -2531, -2819, -2944, -3005, -3000, -2874, -2711, -2592, -2392, -2019, -1611, -1300, -1015, -718, -534, -492, -416, -236, -129, -240, -486, -776, -1204, -1803, -2322, -2548, -2695, -3071, -3534, -3700, -3531, -3286, -3056, -2738, -2372, -2110, -1932, -1677, -1360, -1194, -1316, -1630, -1951, -2256, -2658, -3158, -3601, -3954, -4394, -4952, -5341, -5357, -5181, -5043, -4838, -4421, -3975, -3729, -3523, -3072, -2540, -2393, -2675, -2942, -3023, -3263, -3806, -4259, -4370, -4464, -4818, -5151, -5121, -4887, -4772, -4716, -4477, -4134, -3961, -3897, -3603, -3048, -2602, -2469, -2429, -2266, -2055, -1958, -2009, -2166, -2384, -2580, -2687, -2732, -2759, -2749, -2625, -2307, -1848, -1467, -1282, -1069, -605, -112, 90, 145, 340, 538, 537, 581, 911, 1245, 1325, 1424, 1779, 2066, 1990, 1877, 2124, 2472, 2395, 2002, 1902, 2251, 2587, 2653, 2784, 3227, 3706, 3948, 4179, 4654, 5120, 5195, 5018, 5009, 5143, 5056, 4755, 4626, 4704, 4611, 4261, 4062, 4259, 4580, 4656, 4468, 4280, 4340, 4689, 5144, 5437, 5444, 5296, 5280, 5557, 5892, 5819, 5250, 4683, 4456, 4217, 3653, 3148, 3079, 3117, 2922, 2806, 3006, 3185, 3196, 3431, 3946, 4142, 3718, 3137, 2856, 2776, 2616, 2307, 1915, 1478, 1018, 656, 642, 1049, 1419, 1207, 657, 518, 824, 880, 561, 487, 746, 645, -6, -520, -437, -113, -12, -169, -439, -737, -966, -1032, -911, -689, -558, -646, -768, -618, -264, -37, 53, 238, 394, 214, -111, -141, 72, 172, 124, 47, -125, -303, -107, 504, 1041, 1177, 1116, 1111, 1165, 1296, 1601, 1937, 1989, 1816, 1905, 2410, 2820, 2786, 2772, 3307, 3987, 4029, 3517, 3289, 3634, 3910, 3595, 3061, 2961, 3284, 3510, 3500, 3702, 4349, 4999, 5213, 5263, 5646, 6250, 6582, 6551, 6407, 6186, 5839, 5582, 5571, 5533, 5185, 4743, 4562, 4610, 4630, 4574, 4621, 4869, 5176, 5305, 5248, 5276, 5565, 5861, 5783, 5372, 5066, 5052, 4968, 4451, 3726, 3296, 3187, 2957, 2440, 2018, 1989, 2117, 2040, 1795, 1678, 1751, 1777, 1609, 1365, 1212, 1109, 919, 652, 400, 134, -206, -476, -484, -411, -703, -1413, -2002, -2031, -1795, -1916, -2485, -3014, -3187, -3207, -3299, -3323, -3133, -2953, -3052, -3270, -3223, -2880, -2611, -2667, -2906, -3111, -3291, -3538, -3788, -3938, -4064, -4360, -4851, -5294, -5367, -5003, -4486, -4176, -4125, -4012, -3542, -2846, -2317, -2077, -1929, -1885, -2190, -2741, -3096, -3205, -3387, -3614, -3644, -3728, -4138, -4324, -3650, -2584, -2104, -2311, -2502, -2191, -1467, -768, -586, -928, -1185, -945, -611, -668, -869, -776, -623, -914, -1495, -1705, -1396, -1099, -1142, -1260, -1245, -1262, -1250, -808, -27, 334, -53, -503, -310, 243, 430, 182, -7, 0, -94, -310, -322, -148, -184, -513, -817, -988, -1226, -1510, -1565, -1404, -1362, -1481, -1376, -927, -565, -503, -321, 205, 511, 91, -699, -1225, -1398, -1483, -1688, -2212, -3071, -3747, -3611, -2802, -2143, -2086, -2241, -2061, -1580, -1186, -974, -718, -398, -349, -755, -1298, -1514, -1334, -1109, -1213, -1759, -2536, -3027, -2828, -2238, -2010, -2303, -2487, -2203, -1856, -1764, -1690, -1499, -1491, -1867, -2488, -3184, -3740, -3805, -3318, -2821, -2836, -3091, -2827, -1781, -488, 366, 583, 384, 59, -165, -209, -267, -655, -1360, -1995, -2250, -2137, -1773, -1191, -475, 200, 778, 1396, 2141, 2866, 3423, 3871, 4241, 4326, 4012, 3626, 3577, 3811, 3901, 3587, 3056, 2772, 3051, 3678, 4136, 4328, 4710, 5506, 6325, 6809, 7140, 7577, 7994, 8176, 8178, 8097, 7838, 7377, 6956, 6808, 6811, 6673, 6380, 6253, 6502, 6930, 7220, 7321, 7381, 7452, 7468, 7492, 7644, 7842, 7812, 7461, 7027, 6765, 6662, 6567, 6420, 6189, 5743, 5043, 4378, 4078, 4043, 3862, 3372, 2795, 2412, 2333, 2447, 2447, 2131, 1750, 1684, 1810, 1680, 1271, 975, 852, 499, -233, -942, -1326, -1630, -2191, -2876, -3400, -3860, -4450, -4942, -5008, -4838, -4881, -5102, -5096, -4816, -4647, -4756, -4836, -4665, -4537, -4859, -5536, -6128, -6472, -6814, -7293, -7695, -7885, -8064, -8326, -8389, -8118, -7858, -7857, -7829, -7487, -7046, -6786, -6615, -6385, -6179, -6077, -5991, -5897, -5879, -5949, -6033, -6131, -6286, -6481, -6648, -6699, -6567, -6280, -5948, -5578, -5096, -4557, -4135, -3840, -3507, -3101, -2768, -2580, -2521, -2611, -2825, -2951, -2844, -2652, -2619, -2747, -2839, -2760, -2532, -2295, -2188, -2200, -2159, -1947, -1639, -1365, -1140, -899, -633, -420, -342, -388, -430, -362, -249, -297, -605, -1009, -1253, -1263, -1201, -1222, -1325, -1436, -1512, -1488, -1330, -1168, -1148, -1176, -1081, -952, -961, -988, -837, -648, -690, -919, -1114, -1250, -1440, -1669, -1859, -2065, -2383, -2762, -3023, -3087, -3057, -3056, -3080, -3036, -2881, -2656, -2430, -2227, -2027, -1839, -1776, -1927, -2179, -2359, -2504, -2754, -3038, -3204, -3358, -3703, -4099, -4189, -3906, -3537, -3338, -3327, -3376, -3323, -3064, -2654, -2296, -2143, -2149, -2142, -2008, -1814, -1748, -1887, -2081, -2126, -2051, -2090, -2328, -2508, -2342, -1910, -1603, -1615, -1657, -1318, -643, -64, 235, 466, 651, 576, 447, 777, 1383, 1486, 1035, 928, 1529, 2056, 1924, 1741, 2269, 3113, 3337, 2919, 2654, 2828, 3024, 3094, 3300, 3555, 3574, 3617, 4143, 4926, 5392, 5568, 5902, 6371, 6489, 6135, 5789, 5861, 6140, 6120, 5636, 5025, 4766, 5058, 5621, 5896, 5664, 5376, 5599, 6275, 6837, 6986, 6941, 6958, 7011, 7083, 7295, 7522, 7323, 6632, 6044, 5955, 5921, 5422, 4736, 4445, 4511, 4495, 4346, 4409, 4789, 5213, 5428, 5466, 5427, 5320, 5180, 5090, 4980, 4615, 3933, 3216, 2780, 2638, 2561, 2359, 2008, 1618, 1319, 1197, 1253, 1378, 1338, 932, 273, -215, -228, 116, 470, 583, 408, 84, -130, -70, 162, 369, 404, 90, -665, -1512, -1912, -1872, -1938, -2296, -2535, -2418, -2255, -2322, -2429, -2268, -1818, -1327, -1053, -1021, -1026, -952, -907, -911, -828, -780, -1094, -1595, -1727, -1538, -1654, -2119, -2301, -2051, -1894, -1945, -1705, -1049, -508, -388, -345, -1, 484, 713, 608, 437, 372, 275, 2, -321, -477, -437, -302, -98, 140, 261, 213, 259, 642, 1163, 1395, 1228, 953, 870, 1006, 1177, 1186, 1013, 849, 900, 1125, 1255, 1137, 928, 853, 882, 843, 724, 629, 541, 401, 297, 316, 354, 327, 365, 566, 707, 529, 206, 158, 428, 598, 419, 139, 26, 0, -89, -206, -339, -598, -928, -1125, -1189, -1320, -1535, -1643, -1553, -1360, -1222, -1210, -1201, -969, -554, -353, -608, -1076, -1425, -1633, -1791, -1895, -2068, -2559, -3260, -3578, -3153, -2431, -2115, -2247, -2293, -2012, -1695, -1539, -1415, -1311, -1433, -1723, -1838, -1756, -1888, -2315, -2497, -2159, -1905, -2315, -2892, -2767, -2105, -1842, -2162, -2261, -1718, -1102, -948, -955, -671, -341, -445, -786, -767, -438, -521, -1199, -1652, -1277, -682, -687, -971, -725, -88, 220, 200, 343, 605, 621, 455, 316, 91, -201, -144, 300, 436, -88, -463, 172, 1249, 1499, 873, 449, 605, 727, 669, 932, 1337, 1071, 304, 258, 1263, 2069, 1732, 1018, 1070, 1568, 1439, 735, 457, 776, 836, 391, 277, 915, 1522, 1403, 1032, 1090, 1259, 928, 474, 679, 1238, 1087, 219, -115, 622, 1387, 1352, 1252, 1866, 2415, 1888, 868, 566, 951, 1134, 811, 274, -274, -623, -412, 261, 691, 495, 233, 596, 1328, 1574, 1154, 781, 936, 1184, 972, 501, 267, 166, -262, -971, -1575, -2096, -2726, -3105, -2799, -2218, -2050, -2095, -1616, -483, 851, 2105, 3158, 3708, 3567, 3057, 2654, 2401, 1917, 906, -416, -1481, -1965, -2068, -2005, -1587, -639, 499, 1392, 2184, 3321, 4772, 5981, 6528, 6470, 6138, 5857, 5787, 5838, 5754, 5338, 4619, 3897, 3579, 3777, 4098, 4166, 4160, 4489, 5139, 5820, 6479, 7181, 7783, 8212, 8682, 9245, 9520, 9251, 8708, 8250, 7856, 7338, 6735, 6275, 6064, 5993, 5901, 5766, 5721, 5918, 6327, 6704, 6788, 6586, 6376, 6346, 6385, 6299, 6064, 5775, 5498, 5236, 4937, 4497, 3897, 3246, 2625, 1989, 1319, 699, 172, -291, -639, -775, -755, -763, -840, -837, -695, -580, -722, -1175, -1753, -2244, -2683, -3295, -4109, -4903, -5588, -6306, -7020, -7484, -7700, -7959, -8299, -8420, -8253, -8094, -8081, -8012, -7782, -7613, -7686, -7870, -7977, -8095, -8454, -9057, -9656, -10110, -10525, -10978, -11339, -11441, -11345, -11255, -11235, -11105, -10708, -10185, -9830, -9713, -9619, -9404, -9194, -9125, -9094, -8945, -8770, -8787, -8957, -8985, -8737, -8486, -8545, -8818, -8914, -8657, -8260, -7967, -7730, -7358, -6841, -6349, -5947, -5526, -5028, -4597, -4364, -4266, -4156, -4033, -3968, -3919, -3805, -3700, -3709, -3745, -3602, -3266, -2961, -2837, -2779, -2578, -2199, -1782, -1424, -1083, -743, -523, -477, -418, -137, 246, 413, 276, 84, 40, 81, 84, 87, 180, 302, 290, 144, 132, 464, 920, 1084, 948, 944, 1270, 1587, 1590, 1469, 1537, 1672, 1552, 1238, 1094, 1177, 1150, 869, 595, 501, 448, 378, 435, 583, 568, 387, 332, 521, 747, 795, 657, 453, 331, 360, 432, 368, 131, -153, -371, -493, -543, -588, -719, -950, -1139, -1123, -960, -880, -959, -1016, -914, -790, -818, -927, -949, -917, -989, -1149, -1201, -1097, -1024, -1104, -1195, -1127, -951, -826, -775, -732, -719, -786, -841, -720, -439, -218, -195, -254, -207, 21, 397, 789, 1011, 1006, 967, 1098, 1361, 1596, 1736, 1775, 1751, 1810, 2059, 2346, 2448, 2436, 2572, 2880, 3121, 3203, 3313, 3577, 3851, 3989, 4091, 4308, 4575, 4778, 4966, 5182, 5284, 5198, 5162, 5405, 5736, 5757, 5430, 5137, 5157, 5345, 5424, 5376, 5367, 5479, 5674, 5927, 6213, 6481, 6693, 6869, 7006, 7027, 6886, 6664, 6481, 6342, 6165, 5891, 5504, 5046, 4738, 4797, 5024, 4966, 4655, 4628, 5049, 5417, 5372, 5196, 5208, 5263, 5133, 4925, 4785, 4542, 4059, 3621, 3521, 3493, 3085, 2429, 2045, 2028, 2017, 1875, 1784, 1753, 1618, 1467, 1593, 1942, 2046, 1646, 1070, 781, 733, 508, -19, -490, -637, -682, -955, -1362, -1540, -1395, -1192, -1169, -1324, -1534, -1711, -1815, -1860, -1889, -1929, -2011, -2145, -2214, -2048, -1707, -1509, -1606, -1762, -1734, -1639, -1723, -1934, -2056, -2128, -2360, -2616, -2492, -2003, -1653, -1658, -1641, -1318, -937, -806, -834, -787, -649, -533, -478, -485, -580, -728, -788, -693, -570, -585, -709, -786, -746, -638, -529, -461, -416, -281, 22, 358, 508, 472, 465, 597, 733, 683, 409, 35, -276, -433, -475, -554, -756, -918, -804, -466, -216, -173, -158, -68, -18, -55, -98, -182, -424, -759, -987, -1031, -955, -827, -762, -908, -1214, -1373, -1222, -1076, -1360, -1944, -2256, -2100, -1893, -1971, -2132, -2033, -1657, -1204, -863, -743, -797, -814, -711, -737, -1130, -1669, -1900, -1838, -1946, -2307, -2407, -2010, -1596, -1527, -1481, -1179, -958, -1069, -1076, -623, -239, -636, -1474, -1718, -1150, -660, -860, -1280, -1298, -1064, -1019, -1066, -809, -247, 187, 177, -134, -311, -65, 453, 783, 623, 180, -69, 22, 150, 68, -65, -34, 77, 102, 68, 92, 210, 448, 825, 1225, 1449, 1456, 1410, 1452, 1538, 1562, 1491, 1262, 785, 234, -21, 68, 166, 173, 367, 724, 828, 635, 634, 1029, 1382, 1280, 866, 501, 319, 302, 439, 577, 455, 167, 166, 472, 510, 142, -9, 204, 54, -663, -1071, -721, -364, -597, -870, -513, 218, 681, 742, 711, 741, 743, 690, 645, 526, 151, -425, -905, -1062, -903, -637, -537, -623, -559, -208, -10, -216, -248, 388, 1126, 1156, 743, 738, 1200, 1452, 1252, 1056, 1156, 1217, 879, 330, 8, -51, -167, -385, -344, 105, 569, 673, 634, 891, 1423, 1838, 1942, 1856, 1732, 1636, 1573, 1447, 1188, 916, 758, 655, 580, 657, 842, 897, 866, 1090, 1549, 1789, 1644, 1501, 1651, 1871, 1824, 1488, 1017, 493, 18, -207, -210, -374, -894, -1348, -1251, -787, -528, -644, -826, -791, -559, -377, -519, -989, -1420, -1511, -1412, -1422, -1478, -1294, -890, -568, -418, -201, 139, 256, -80, -556, -723, -652, -740, -1034, -1149, -880, -488, -226, 73, 661, 1380, 1839, 1942, 1962, 2133, 2399, 2547, 2469, 2297, 2272, 2449, 2638, 2686, 2697, 2820, 2962, 2967, 2965, 3233, 3678, 3869, 3745, 3815, 4370, 4971, 5156, 5143, 5364, 5690, 5700, 5403, 5188, 5171, 5045, 4600, 4088, 3900, 4059, 4239, 4236, 4205, 4419, 4876, 5282, 5385, 5255, 5121, 5011, 4749, 4308, 3914, 3673, 3354, 2761, 2151, 1959, 2150, 2172, 1677, 1048, 908, 1241, 1377, 920, 297, 129, 342, 316, -179, -691, -831, -864, -1258, -1912, -2342, -2476, -2779, -3482, -4179, -4426, -4407, -4611, -5049, -5280, -5169, -5139, -5483, -5875, -5858, -5579, -5641, -6253, -6907, -7025, -6708, -6605, -7050, -7638, -7827, -7676, -7703, -8107, -8535, -8645, -8597, -8737, -9018, -9045, -8688, -8343, -8367, -8503, -8237, -7647, -7374, -7626, -7836, -7568, -7203, -7311, -7751, -7937, -7665, -7330, -7319, -7511, -7458, -7011, -6530, -6355, -6287, -5949, -5433, -5128, -5033, -4751, -4241, -3973, -4149, -4251, -3824, -3297, -3365, -3861, -3982, -3537, -3169, -3257, -3356, -3016, -2484, -2192, -2026, -1611, -1034, -708, -663, -539, -276, -258, -596, -824, -603, -291, -377, -666, -607, -172, 160, 202, 238, 456, 708, 849, 932, 1041, 1159, 1214, 1138, 969, 871, 942, 1065, 1067, 942, 807, 728, 688, 642, 580, 565, 659, 777, 755, 631, 663, 925, 1122, 1003, 736, 663, 789, 795, 518, 182, 56, 74, -6, -202, -287, -150, 16, 16, -49, 54, 291, 329, 20, -310, -287, -49, -64, -427, -713, -629, -445, -538, -776, -713, -312, -95, -433, -955, -1005, -552, -250, -512, -935, -923, -537, -310, -396, -407, -137, 49, -174, -497, -374, 136, 418, 179, -146, -72, 265, 439, 435, 577, 899, 1093, 1059, 1060, 1269, 1506, 1566, 1525, 1582, 1764, 1953, 2076, 2135, 2180, 2323, 2649, 2995, 3070, 2902, 2880, 3169, 3416, 3282, 3017, 3118, 3579, 3925, 3957, 4005, 4296, 4594, 4674, 4683, 4797, 4871, 4715, 4411, 4198, 4219, 4392, 4473, 4351, 4299, 4634, 5177, 5459, 5392, 5305, 5386, 5479, 5435, 5305, 5153, 4958, 4696, 4418, 4219, 4180, 4260, 4309, 4232, 4093, 3984, 3904, 3831, 3822, 3904, 3900, 3623, 3213, 3069, 3270, 3446, 3348, 3145, 2993, 2760, 2408, 2143, 2041, 1944, 1770, 1546, 1266, 1043, 1099, 1338, 1383, 1201, 1156, 1287, 1183, 743, 404, 424, 470, 191, -202, -277, -38, 87, -94, -272, -162, 7, -144, -512, -641, -455, -416, -798, -1211, -1139, -704, -490, -674, -807, -541, -178, -188, -482, -571, -297, -29, -85, -276, -189, 189, 400, 197, -9, 239, 652, 612, 204, 62, 275, 310, 14, -89, 299, 776, 893, 808, 993, 1491, 1818, 1618, 1203, 1158, 1486, 1580, 1120, 553, 437, 719, 957, 963, 903, 918, 963, 979, 1016, 1101, 1129, 985, 774, 740, 909, 995, 823, 603, 569, 586, 400, 105, -49, -124, -411, -899, -1198, -1087, -866, -960, -1303, -1431, -1155, -850, -886, -1107, -1164, -1151, -1449, -2024, -2396, -2365, -2347, -2701, -3128, -3121, -2749, -2521, -2599, -2653, -2517, -2478, -2716, -2937, -2858, -2726, -2916, -3266, -3322, -3071, -2877, -2806, -2578, -2211, -2068, -2232, -2371, -2290, -2219, -2399, -2703, -2819, -2664, -2473, -2425, -2373, -2096, -1707, -1505, -1482, -1350, -1091, -1032, -1273, -1430, -1204, -864, -834, -1021, -945, -469, -18, 52, -35, 123, 420, 416, 154, 157, 507, 654, 397, 300, 735, 1255, 1376, 1312, 1508, 1927, 2194, 2125, 1898, 1813, 1917, 1930, 1734, 1652, 1885, 2082, 1985, 2003, 2464, 2862, 2598, 2041, 1993, 2400, 2467, 1941, 1480, 1589, 1902, 1897, 1739, 1857, 2120, 2073, 1775, 1752, 2096, 2244, 1823, 1254, 1182, 1574, 1808, 1556, 1197, 1266, 1753, 2160, 2113, 1729, 1371, 1181, 945, 406, -339, -867, -939, -800, -743, -620, -182, 382, 757, 1037, 1457, 1875, 2003, 1773, 1230, 510, -18, -168, -331, -834, -1242, -1037, -550, -438, -654, -654, -297, 88, 294, 356, 271, 22, -173, -23, 378, 533, 187, -230, -158, 205, 134, -459, -834, -626, -450, -790, -1159, -941, -348, 54, 133, 79, 43, 112, 262, 293, 107, -134, -368, -777, -1322, -1523, -1119, -630, -751, -1354, -1639, -1283, -805, -674, -741, -744, -732, -714, -531, -245, -148, -269, -357, -330, -354, -492, -651, -826, -1129, -1566, -1909, -1860, -1434, -1116, -1344, -1857, -1933, -1322, -508, -53, -140, -629, -1145, -1283, -1125, -1191, -1635, -2026, -2178, -2487, -3055, -3257, -2768, -2308, -2616, -3148, -2832, -1824, -1294, -1481, -1340, -404, 400, 347, 63, 322, 691, 274, -780, -1430, -1227, -899, -1234, -1953, -2140, -1510, -616, 107, 778, 1450, 1856, 1990, 2267, 2807, 3165, 3027, 2602, 2172, 1795, 1573, 1684, 1991, 2063, 1769, 1527, 1729, 2222, 2624, 2885, 3199, 3515, 3588, 3434, 3349, 3501, 3781, 4037, 4219, 4260, 4029, 3512, 2986, 2837, 3140, 3476, 3325, 2694, 2218, 2437, 3073, 3350, 3069, 2893, 3306, 3752, 3394, 2446, 2010, 2478, 2947, 2632, 2029, 1916, 2047, 1783, 1330, 1266, 1384, 1041, 280, -272, -401, -456, -630, -740, -700, -715, -851, -827, -482, -111, -74, -347, -720, -1185, -1773, -2227, -2320, -2380, -2950, -3899, -4456, -4270, -3842, -3722, -3844, -3876, -3757, -3611, -3489, -3384, -3322, -3364, -3525, -3670, -3620, -3521, -3783, -4401, -4808, -4735, -4666, -5024, -5493, -5617, -5491, -5391, -5237, -4813, -4202, -3728, -3615, -3769, -3825, -3559, -3250, -3357, -3853, -4276, -4403, -4432, -4456, -4270, -3823, -3452, -3459, -3646, -3510, -2903, -2371, -2521, -3142, -3395, -2989, -2562, -2626, -2819, -2633, -2229, -2045, -2038, -1879, -1561, -1375, -1443, -1582, -1597, -1535, -1574, -1727, -1808, -1745, -1721, -1798, -1742, -1464, -1270, -1345, -1413, -1207, -911, -812, -904, -1061, -1234, -1326, -1213, -1016, -1040, -1374, -1763, -1916, -1814, -1683, -1747, -1963, -2075, -1945, -1723, -1603, -1582, -1558, -1488, -1381, -1316, -1446, -1768, -2005, -1980, -1932, -2159, -2514, -2608, -2383, -2149, -2107, -2179, -2242, -2267, -2137, -1734, -1315, -1351, -1796, -2059, -1886, -1670, -1707, -1840, -1942, -2057, -2059, -1809, -1524, -1431, -1372, -1207, -1139, -1283, -1406, -1345, -1194, -1031, -908, -968, -1154, -1073, -567, -67, -31, -345, -594, -571, -354, -101, 68, 115, 67, -30, -32, 315, 969, 1383, 1137, 585, 368, 511, 566, 396, 285, 394, 569, 673, 784, 1107, 1747, 2520, 3036, 3108, 2942, 2809, 2730, 2548, 2108, 1352, 491, 11, 175, 626, 845, 818, 965, 1538, 2408, 3264, 3841, 4086, 4205, 4399, 4543, 4357, 3822, 3250, 2934, 2857, 2749, 2387, 1865, 1544, 1697, 2193, 2649, 2889, 3127, 3590, 4133, 4483, 4670, 4914, 5155, 5102, 4710, 4216, 3757, 3287, 2862, 2653, 2618, 2465, 2077, 1789, 2032, 2772, 3459, 3607, 3297, 3024, 3113, 3436, 3644, 3522, 3126, 2701, 2482, 2476, 2496, 2433, 2343, 2235, 1968, 1532, 1172, 1090, 1200, 1250, 1084, 742, 449, 515, 1058, 1762, 2111, 1962, 1725, 1797, 2038, 2047, 1748, 1391, 1062, 637, 166, -80, -49, -56, -315, -580, -497, -135, 140, 243, 463, 904, 1226, 1202, 1162, 1411, 1628, 1402, 925, 529, 66, -585, -1008, -920, -784, -1054, -1377, -1148, -417, 293, 736, 1080, 1469, 1789, 1868, 1714, 1449, 1134, 741, 270, -235, -727, -1087, -1104, -741, -332, -208, -168, 262, 1081, 1748, 1888, 1666, 1434, 1363, 1419, 1432, 1206, 768, 437, 448, 605, 559, 353, 371, 726, 1039, 1004, 864, 1035, 1443, 1615, 1403, 1188, 1270, 1468, 1507, 1412, 1274, 1074, 944, 1119, 1466, 1563, 1372, 1278, 1428, 1579, 1608, 1639, 1684, 1575, 1290, 1022, 940, 1018, 1094, 1029, 837, 704, 844, 1289, 1800, 2033, 1897, 1689, 1772, 2121, 2305, 1970, 1267, 699, 519, 467, 283, 162, 337, 567, 605, 751, 1279, 1781, 1831, 1739, 1913, 2107, 1964, 1663, 1479, 1325, 1099, 927, 856, 761, 593, 391, 172, 25, 88, 312, 496, 617, 797, 1040, 1299, 1663, 2145, 2446, 2267, 1767, 1384, 1271, 1131, 640, -104, -654, -781, -769, -865, -738, 0, 942, 1331, 1206, 1316, 1902, 2380, 2243, 1632, 968, 489, 220, 66, -91, -273, -423, -520, -562, -442, -65, 386, 536, 287, 36, 199, 656, 923, 795, 522, 407, 493, 651, 719, 561, 185, -190, -339, -336, -415, -527, -386, -18, 163, 26, -10, 366, 824, 888, 629, 432, 309, -13, -444, -554, -322, -190, -302, -288, 10, 301, 426, 552, 674, 545, 214, 56, 151, 112, -281, -692, -738, -566, -566, -751, -829, -696, -501, -383, -433, -654, -815, -670, -390, -382, -696, -1047, -1286, -1411, -1370, -1225, -1281, -1709, -2271, -2627, -2686, -2599, -2612, -2874, -3189, -3162, -2734, -2246, -1909, -1639, -1427, -1378, -1387, -1309, -1311, -1594, -1990, -2287, -2588, -3007, -3397, -3613, -3662, -3509, -3158, -2827, -2640, -2377, -1889, -1413, -1140, -940, -749, -728, -897, -1066, -1205, -1441, -1751, -1992, -2149, -2265, -2337, -2377, -2379, -2208, -1773, -1283, -1014, -935, -805, -509, -84, 390, 741, 745, 379, -107, -461, -642, -744, -862, -1059, -1359, -1657, -1702, -1321, -628, 29, 390, 467, 489, 692, 1097, 1440, 1449, 1166, 827, 524, 235, 66, 105, 143, -95, -537, -841, -789, -447, -91, -49, -330, -485, -132, 509, 912, 921, 803, 794, 893, 975, 904, 641, 299, -7, -331, -751, -1146, -1340, -1358, -1379, -1472, -1517, -1354, -978, -589, -400, -368, -249, 26, 221, 140, -101, -272, -323, -393, -634, -1076, -1597, -1996, -2201, -2352, -2591, -2870, -3025, -2952, -2647, -2162, -1602, -1097, -740, -542, -434, -328, -243, -326, -710, -1331, -1989, -2515, -2830, -2910, -2825, -2763, -2830, -2876, -2665, -2203, -1778, -1625, -1661, -1619, -1424, -1293, -1365, -1426, -1212, -862, -791, -1094, -1427, -1528, -1562, -1818, -2280, -2715, -3000, -3140, -3065, -2729, -2313, -2028, -1771, -1313, -759, -435, -400, -408, -373, -523, -1028, -1701, -2180, -2325, -2334, -2462, -2714, -2870, -2755, -2419, -2033, -1723, -1520, -1404, -1288, -1051, -672, -334, -278, -495, -695, -661, -559, -742, -1237, -1689, -1897, -2056, -2305, -2402, -2166, -1848, -1700, -1542, -1107, -531, -104, 191, 545, 881, 897, 498, 6, -191, -107, -118, -435, -850, -1108, -1189, -1060, -590, -6, 123, -300, -578, -174, 493, 707, 489, 458, 874, 1319, 1352, 1087, 965, 1082, 1060, 607, -39, -429, -447, -312, -228, -252, -340, -300, 106, 804, 1390, 1613, 1641, 1717, 1837, 1865, 1760, 1579, 1378, 1141, 768, 259, -156, -237, -64, 53, 14, 40, 306, 686, 987, 1230, 1547, 1917, 2203, 2382, 2526, 2583, 2383, 1949, 1568, 1403, 1209, 743, 253, 135, 346, 583, 855, 1302, 1764, 2078, 2437, 2948, 3331, 3418, 3401, 3327, 3025, 2629, 2472, 2477, 2293, 1930, 1694, 1696, 1845, 2095, 2392, 2607, 2729, 2885, 3098, 3254, 3315, 3353, 3367, 3259, 3041, 2881, 2842, 2778, 2626, 2547, 2595, 2572, 2425, 2380, 2482, 2424, 2113, 1928, 2129, 2417, 2424, 2267, 2307, 2568, 2758, 2754, 2680, 2575, 2358, 2087, 1897, 1695, 1304, 858, 670, 723, 691, 501, 484, 792, 1079, 1048, 909, 937, 986, 864, 714, 622, 361, -86, -338, -252, -200, -417, -654, -682, -663, -758, -790, -572, -314, -366, -701, -962, -964, -845, -800, -917, -1211, -1568, -1759, -1704, -1582, -1563, -1618, -1663, -1668, -1574, -1357, -1156, -1147, -1277, -1326, -1231, -1187, -1341, -1567, -1645, -1614, -1704, -1962, -2112, -1907, -1477, -1167, -1120, -1142, -1006, -720, -459, -334, -344, -472, -671, -809, -780, -661, -610, -614, -518, -333, -284, -436, -485, -191, 166, 178, -27, 0, 273, 403, 316, 327, 500, 556, 441, 464, 767, 1070, 1096, 948, 902, 999, 1061, 1022, 1010, 1058, 970, 624, 247, 180, 436, 698, 745, 681, 745, 1050, 1482, 1777, 1788, 1677, 1644, 1572, 1278, 926, 747, 596, 244, -146, -314, -304, -216, 72, 540, 787, 568, 257, 356, 774, 1026, 979, 926, 955, 800, 442, 297, 553, 717, 255, -617, -1208, -1245, -1060, -958, -876, -699, -427, -6, 608, 1213, 1582, 1808, 2027, 2035, 1624, 1021, 591, 357, 69, -430, -1072, -1575, -1593, -1043, -262, 321, 627, 888, 1264, 1685, 2045, 2329, 2469, 2334, 1984, 1655, 1395, 1080, 813, 798, 815, 464, -68, -173, 278, 837, 1172, 1317, 1377, 1478, 1823, 2428, 2956, 3072, 2784, 2374, 2152, 2222, 2372, 2303, 2009, 1715, 1472, 1224, 1137, 1396, 1769, 1847, 1636, 1449, 1444, 1594, 1884, 2226, 2424, 2427, 2405, 2506, 2759, 3114, 3372, 3226, 2648, 2023, 1698, 1572, 1309, 780, 150, -315, -411, -68, 571, 1216, 1652, 1917, 2236, 2700, 3078, 3086, 2816, 2570, 2285, 1590, 543, -260, -534, -622, -812, -905, -701, -376, -102, 281, 862, 1310, 1329, 1166, 1171, 1156, 789, 294, 68, -79, -529, -1024, -1059, -775, -704, -871, -850, -561, -391, -528, -690, -609, -447, -516, -831, -1138, -1284, -1311, -1287, -1250, -1291, -1419, -1422, -1142, -841, -879, -1087, -994, -686, -771, -1405, -2053, -2353, -2569, -3024, -3615, -4082, -4316, -4257, -3812, -3109, -2504, -2136, -1718, -1053, -464, -352, -636, -1013, -1497, -2246, -3095, -3713, -4060, -4338, -4582, -4568, -4148, -3513, -2982, -2583, -2055, -1386, -1000, -1092, -1208, -977, -743, -937, -1322, -1517, -1656, -1979, -2264, -2270, -2257, -2510, -2779, -2674, -2305, -2064, -1922, -1519, -862, -371, -208, -91, 129, 249, 185, 112, 43, -247, -714, -921, -680, -425, -600, -969, -952, -486, -65, -3, -93, -36, 160, 337, 427, 438, 403, 487, 861, 1311, 1401, 1148, 1071, 1320, 1386, 964, 441, 204, 75, -228, -605, -803, -749, -475, -23, 438, 710, 861, 1194, 1736, 2050, 1827, 1356, 1068, 912, 589, 129, -207, -400, -632, -894, -987, -840, -604, -428, -323, -254, -193, -40, 312, 741, 900, 638, 252, 130, 263, 245, -216, -928, -1417, -1533, -1595, -1811, -1912, -1691, -1439, -1359, -1130, -577, -164, -236, -415, -328, -253, -546, -1035, -1382, -1571, -1745, -1931, -2079, -2153, -2156, -2131, -2081, -1915, -1629, -1440, -1496, -1640, -1682, -1671, -1698, -1688, -1632, -1702, -1948, -2132, -2072, -1901, -1853, -1991, -2172, -2213, -2138, -2207, -2505, -2695, -2513, -2287, -2447, -2796, -2818, -2504, -2278, -2303, -2359, -2332, -2335, -2404, -2398, -2257, -2165, -2336, -2732, -3068, -3143, -3047, -3019, -3153, -3326, -3377, -3251, -3008, -2780, -2673, -2630, -2526, -2383, -2318, -2307, -2273, -2311, -2502, -2690, -2797, -3008, -3304, -3314, -2998, -2854, -3085, -3187, -2796, -2302, -2172, -2193, -1931, -1577, -1632, -1979, -2042, -1790, -1751, -2049, -2270, -2284, -2346, -2430, -2252, -1926, -1848, -1982, -1907, -1537, -1234, -1173, -1107, -904, -826, -1000, -1136, -1035, -959, -1108, -1259, -1226, -1161, -1159, -1053, -801, -610, -576, -565, -480, -352, -181, 68, 324, 420, 286, 81, 62, 275, 436, 303, 63, 49, 226, 339, 423, 640, 850, 859, 853, 1058, 1285, 1310, 1296, 1422, 1508, 1357, 1124, 1053, 1172, 1343, 1432, 1393, 1325, 1361, 1447, 1439, 1388, 1475, 1667, 1765, 1718, 1638, 1580, 1536, 1563, 1691, 1804, 1764, 1589, 1447, 1524, 1829, 2080, 1971, 1601, 1380, 1441, 1547, 1571, 1663, 1855, 1932, 1801, 1628, 1576, 1682, 1923, 2187, 2231, 1922, 1485, 1337, 1623, 2032, 2137, 1861, 1526, 1448, 1604, 1793, 1936, 2058, 2097, 1992, 1876, 1962, 2247, 2518, 2582, 2384, 2006, 1677, 1629, 1816, 1935, 1782, 1464, 1255, 1323, 1619, 1928, 2054, 2003, 1961, 2067, 2275, 2437, 2454, 2308, 2038, 1701, 1378, 1162, 1112, 1185, 1253, 1264, 1321, 1523, 1808, 2039, 2143, 2112, 1976, 1845, 1818, 1830, 1712, 1469, 1326, 1414, 1589, 1653, 1638, 1714, 1903, 2012, 1904, 1674, 1519, 1484, 1459, 1386, 1318, 1300, 1309, 1361, 1517, 1766, 1992, 2092, 2045, 1870, 1659, 1568, 1660, 1788, 1761, 1565, 1347, 1245, 1278, 1327, 1236, 995, 792, 789, 911, 980, 993, 1128, 1487, 1912, 2123, 2042, 1924, 2020, 2146, 1886, 1224, 640, 451, 471, 423, 335, 358, 489, 662, 881, 1140, 1357, 1485, 1560, 1580, 1438, 1086, 691, 505, 561, 629, 510, 257, 78, 88, 240, 432, 542, 490, 348, 323, 498, 702, 777, 752, 692, 598, 521, 517, 453, 186, -151, -301, -260, -209, -154, 29, 301, 470, 483, 477, 558, 671, 728, 722, 660, 490, 217, 2, 27, 230, 349, 256, 87, -3, -36, -46, 24, 148, 150, -22, -137, 5, 255, 328, 252, 302, 519, 637, 527, 386, 371, 389, 343, 267, 148, -51, -210, -180, -61, -53, -149, -206, -156, 0, 256, 541, 727, 767, 724, 667, 627, 596, 499, 262, -55, -313, -464, -557, -600, -556, -416, -198, 65, 283, 390, 491, 726, 1011, 1135, 1061, 898, 675, 372, 77, -97, -208, -379, -586, -701, -712, -715, -694, -493, -94, 287, 482, 561, 666, 812, 931, 938, 732, 306, -136, -353, -367, -438, -673, -853, -758, -484, -271, -132, 78, 368, 583, 650, 609, 510, 388, 259, 72, -203, -431, -467, -382, -339, -353, -353, -309, -195, 2, 136, 22, -264, -426, -333, -132, 3, 47, 26, -25, -22, 113, 308, 343, 92, -341, -756, -1023, -1093, -946, -666, -499, -606, -796, -696, -265, 113, 152, -6, -140, -267, -431, -514, -476, -484, -610, -720, -753, -823, -927, -882, -692, -660, -949, -1232, -1100, -658, -380, -438, -544, -450, -260, -190, -305, -539, -798, -1009, -1146, -1222, -1241, -1182, -1032, -816, -589, -415, -326, -300, -274, -246, -286, -428, -586, -627, -548, -487, -533, -573, -435, -153, 21, -27, -124, -83, 19, 21, -58, -116, -162, -234, -297, -350, -433, -472, -324, -32, 163, 161, 132, 235, 370, 356, 215, 104, 55, -18, -127, -224, -320, -412, -418, -353, -388, -558, -597, -294, 138, 310, 181, 75, 175, 291, 209, 8, -127, -207, -334, -486, -548, -495, -414, -377, -369, -321, -211, -106, -69, -82, -114, -201, -351, -481, -554, -648, -778, -822, -737, -674, -751, -840, -760, -569, -481, -548, -636, -689, -813, -1040, -1255, -1397, -1491, -1502, -1414, -1344, -1337, -1224, -941, -708, -668, -687, -683, -788, -1028, -1232, -1363, -1588, -1922, -2122, -2089, -2036, -2105, -2089, -1744, -1230, -954, -1021, -1144, -1102, -1022, -1099, -1294, -1465, -1595, -1721, -1768, -1688, -1619, -1690, -1767, -1666, -1477, -1426, -1507, -1518, -1395, -1282, -1306, -1413, -1461, -1392, -1296, -1288, -1367, -1445, -1483, -1536, -1618, -1629, -1497, -1345, -1336, -1372, -1202, -873, -746, -952, -1215, -1310, -1365, -1553, -1800, -1963, -2023, -2009, -1904, -1729, -1558, -1408, -1229, -1004, -836, -847, -1027, -1225, -1349, -1507, -1801, -2083, -2147, -2066, -2030, -1992, -1830, -1676, -1686, -1691, -1523, -1374, -1444, -1557, -1498, -1387, -1426, -1569, -1679, -1730, -1767, -1838, -1972, -2109, -2132, -2042, -1975, -1973, -1929, -1789, -1602, -1403, -1201, -1052, -1006, -1021, -1021, -995, -989, -1090, -1336, -1573, -1564, -1364, -1296, -1427, -1442, -1180, -912, -855, -874, -808, -718, -665, -567, -404, -307, -335, -355, -244, -73, 8, -9, -10, 35, 8, -167, -364, -406, -294, -169, -93, -10, 126, 350, 693, 1072, 1281, 1257, 1188, 1212, 1212, 1079, 898, 758, 602, 394, 243, 261, 419, 598, 697, 756, 931, 1257, 1515, 1513, 1394, 1428, 1592, 1625, 1448, 1261, 1228, 1269, 1220, 1070, 950, 953, 1026, 1073, 1063, 1067, 1172, 1357, 1486, 1487, 1484, 1609, 1790, 1856, 1794, 1710, 1624, 1481, 1286, 1088, 896, 727, 652, 701, 825, 967, 1115, 1260, 1378, 1466, 1543, 1606, 1622, 1557, 1424, 1292, 1221, 1192, 1126, 989, 850, 793, 832, 910, 959, 953, 945, 1012, 1132, 1200, 1204, 1261, 1385, 1428, 1324, 1200, 1181, 1242, 1310, 1328, 1255, 1132, 1092, 1193, 1330, 1393, 1391, 1372, 1349, 1365, 1487, 1679, 1781, 1700, 1563, 1536, 1596, 1593, 1496, 1425, 1440, 1480, 1488, 1460, 1400, 1329, 1312, 1364, 1421, 1442, 1467, 1507, 1526, 1522, 1541, 1585, 1580, 1487, 1356, 1258, 1201, 1168, 1190, 1289, 1399, 1396, 1289, 1241, 1393, 1659, 1801, 1693, 1476, 1387, 1477, 1589, 1600, 1553, 1499, 1397, 1236, 1129, 1176, 1310, 1402, 1420, 1421, 1435, 1464, 1524, 1618, 1690, 1656, 1513, 1365, 1306, 1281, 1186, 1046, 996, 1041, 1033, 929, 868, 935, 1059, 1175, 1261, 1250, 1112, 1002, 1049, 1120, 1007, 754, 568, 533, 560, 553, 490, 408, 388, 496, 718, 947, 1073, 1060, 959, 861, 823, 807, 700, 443, 155, 33, 88, 140, 94, 53, 112, 246, 418, 619, 776, 808, 740, 622, 437, 214, 55, -11, -78, -174, -249, -303, -336, -255, -35, 139, 105, -40, -108, -65, -2, 6, -54, -150, -221, -262, -310, -343, -294, -224, -279, -468, -643, -727, -755, -740, -654, -521, -382, -233, -82, 18, 60, 100, 120, 5, -257, -475, -484, -396, -439, -597, -660, -576, -475, -387, -258, -168, -221, -325, -330, -274, -265, -290, -311, -376, -487, -541, -482, -388, -343, -350, -369, -372, -341, -279, -222, -207, -218, -207, -162, -125, -125, -141, -148, -169, -226, -285, -300, -269, -227, -186, -127, -35, 62, 109, 110, 164, 315, 420, 329, 112, -23, 0, 102, 177, 158, 56, -1, 92, 232, 246, 178, 195, 267, 213, 37, -39, 79, 209, 138, -84, -188, -17, 268, 378, 246, 74, 27, 50, 37, -8, -53, -146, -322, -447, -354, -106, 58, 48, -6, -7, 11, 48, 128, 155, 55, -16, 115, 301, 282, 106, 29, 63, -30, -314, -548, -546, -457, -537, -767, -902, -808, -594, -392, -199, 25, 210, 267, 223, 169, 111, -36, -306, -618, -871, -1022, -1090, -1101, -1068, -989, -863, -711, -580, -504, -464, -434, -446, -553, -725, -864, -923, -950, -1002, -1079, -1141, -1136, -1056, -973, -950, -936, -841, -686, -571, -521, -496, -516, -630, -788, -866, -840, -821, -905, -1043, -1100, -1009, -829, -652, -523, -459, -464, -466, -336, -75, 110, 54, -137, -271, -331, -405, -471, -482, -496, -560, -588, -499, -345, -235, -210, -241, -253, -199, -156, -231, -373, -424, -367, -342, -421, -522, -548, -474, -323, -169, -96, -97, -67, 17, 49, -47, -196, -286, -341, -450, -597, -665, -629, -562, -481, -333, -135, 22, 119, 195, 238, 196, 88, -17, -114, -247, -380, -416, -362, -359, -463, -549, -493, -355, -264, -239, -230, -212, -189, -153, -120, -103, -75, -15, 26, -29, -162, -259, -273, -277, -355, -467, -528, -518, -467, -396, -338, -309, -241, -59, 160, 247, 168, 52, -6, -16, -2, 22, 11, -78, -209, -290, -263, -170, -124, -195, -309, -321, -207, -97, -97, -161, -199, -207, -215, -191, -86, 44, 68, -57, -248, -396, -447, -405, -351, -444, -728, -1004, -1046, -883, -729, -684, -681, -656, -636, -634, -613, -589, -645, -787, -911, -954, -987, -1076, -1170, -1211, -1227, -1262, -1268, -1201, -1116, -1103, -1158, -1203, -1206, -1204, -1220, -1235, -1250, -1281, -1309, -1282, -1206, -1150, -1172, -1265, -1375, -1434, -1433, -1435, -1511, -1644, -1752, -1785, -1772, -1744, -1700, -1642, -1604, -1601, -1592, -1528, -1434, -1364, -1327, -1302, -1280, -1249, -1207, -1213, -1308, -1423, -1472, -1495, -1568, -1637, -1596, -1474, -1358, -1252, -1129, -1022, -948, -848, -701, -581, -543, -532, -486, -456, -515, -619, -662, -647, -649, -658, -625, -597, -629, -641, -528, -343, -200, -106, -6, 98, 186, 259, 309, 293, 214, 126, 69, 31, -2, -23, -15, 20, 68, 130, 228, 370, 505, 576, 590, 605, 644, 683, 708, 716, 684, 599, 518, 515, 590, 655, 636, 545, 471, 510, 655, 787, 813, 775, 768, 808, 846, 863, 872, 847, 747, 606, 537, 593, 700, 747, 705, 641, 613, 634, 683, 727, 738, 717, 690, 673, 661, 641, 617, 598, 575, 541, 518, 532, 585, 621, 591, 539, 558, 684, 827, 869, 807, 748, 777, 861, 906, 873, 811, 785, 807, 830, 809, 766, 758, 803, 846, 851, 866, 960, 1094, 1159, 1113, 1025, 980, 996, 1045, 1097, 1096, 1007, 893, 894, 1030, 1146, 1127, 1045, 1035, 1118, 1235, 1324, 1324, 1228, 1127, 1116, 1149, 1106, 972, 866, 859, 880, 863, 859, 929, 1033, 1110, 1182, 1259, 1288, 1274, 1312, 1410, 1424, 1278, 1103, 1060, 1113, 1113, 1020, 926, 907, 968, 1119, 1330, 1466, 1457, 1443, 1572, 1737, 1756, 1657, 1576, 1517, 1405, 1264, 1153, 1062, 968, 910, 930, 1001, 1068, 1138, 1270, 1476, 1663, 1719, 1647, 1557, 1510, 1437, 1271, 1060, 873, 720, 613, 597, 675, 785, 891, 985, 1035, 1040, 1067, 1141, 1196, 1173, 1096, 977, 811, 663, 615, 629, 603, 539, 524, 587, 693, 817, 938, 982, 903, 790, 774, 839, 822, 622, 346, 175, 158, 208, 247, 264, 270, 272, 296, 372, 470, 522, 515, 490, 457, 375, 230, 103, 62, 77, 63, -6, -78, -110, -101, -66, -16, 28, 40, 29, 31, 52, 55, 10, -79, -191, -295, -371, -418, -453, -468, -418, -294, -183, -171, -196, -132, -8, 10, -129, -303, -415, -511, -645, -752, -756, -683, -598, -500, -373, -269, -225, -155, 14, 173, 142, -69, -267, -345, -406, -568, -800, -981, -1047, -1021, -940, -822, -692, -584, -488, -357, -195, -88, -85, -118, -134, -188, -341, -538, -701, -855, -1040, -1201, -1267, -1253, -1201, -1107, -969, -812, -635, -416, -167, 46, 153, 124, -7, -162, -290, -408, -561, -740, -873, -924, -932, -916, -812, -595, -374, -265, -207, -85, 64, 112, 47, -32, -113, -255, -440, -553, -557, -549, -610, -685, -692, -634, -546, -450, -416, -496, -603, -605, -560, -615, -747, -822, -845, -923, -1035, -1063, -1006, -966, -974, -959, -900, -854, -857, -867, -856, -866, -926, -986, -1005, -1035, -1150, -1322, -1451, -1498, -1505, -1492, -1440, -1366, -1336, -1354, -1347, -1292, -1239, -1218, -1220, -1245, -1303, -1362, -1398, -1445, -1530, -1631, -1717, -1767, -1747, -1648, -1549, -1545, -1614, -1650, -1605, -1534, -1514, -1564, -1631, -1650, -1628, -1632, -1673, -1680, -1623, -1561, -1540, -1539, -1527, -1507, -1463, -1382, -1308, -1293, -1308, -1289, -1240, -1185, -1107, -994, -912, -919, -959, -926, -819, -749, -761, -786, -756, -712, -714, -728, -686, -591, -492, -418, -352, -264, -149, -45, -2, -32, -83, -83, -8, 93, 155, 151, 110, 82, 100, 154, 211, 239, 238, 239, 278, 372, 495, 574, 552, 470, 420, 441, 476, 476, 458, 449, 434, 394, 362, 380, 445, 509, 540, 549, 575, 640, 722, 740, 623, 425, 292, 284, 301, 249, 180, 200, 318, 456, 560, 633, 710, 814, 913, 949, 896, 787, 665, 555, 475, 430, 391, 341, 313, 335, 392, 455, 524, 597, 659, 733, 859, 1016, 1118, 1116, 1052, 991, 932, 835, 690, 529, 387, 286, 239, 240, 256, 291, 381, 530, 683, 821, 988, 1184, 1304, 1263, 1112, 970, 888, 817, 721, 626, 571, 559, 588, 648, 707, 745, 794, 866, 911, 896, 872, 879, 874, 823, 770, 769, 804, 832, 866, 940, 1042, 1119, 1147, 1138, 1115, 1089, 1072, 1072, 1061, 1007, 917, 835, 788, 774, 786, 826, 882, 925, 960, 1027, 1135, 1232, 1273, 1268, 1241, 1185, 1092, 984, 879, 778, 683, 602, 531, 476, 451, 457, 480, 522, 602, 692, 738, 720, 673, 624, 565, 502, 475, 493, 504, 464, 407, 403, 463, 523, 530, 492, 444, 399, 363, 340, 316, 265, 194, 155, 188, 258, 312, 339, 362, 381, 382, 376, 382, 388, 368, 328, 295, 262, 187, 82, 7, -22, -54, -105, -150, -180, -202, -183, -102, -28, -38, -96, -110, -64, -26, -42, -105, -176, -228, -276, -354, -447, -486, -444, -368, -316, -286, -254, -215, -181, -154, -139, -143, -163, -193, -228, -252, -258, -277, -331, -396, -444, -477, -496, -469, -393, -332, -336, -372, -389, -387, -399, -435, -480, -524, -572, -619, -654, -664, -654, -641, -622, -572, -499, -449, -457, -486, -490, -480, -500, -560, -639, -711, -750, -761, -769, -784, -767, -698, -611, -562, -539, -488, -397, -313, -295, -353, -440, -509, -558, -617, -694, -758, -789, -785, -741, -663, -586, -538, -494, -419, -325, -243, -183, -161, -198, -287, -381, -440, -474, -504, -541, -578, -590, -557, -483, -415, -378, -354, -313, -255, -215, -214, -231, -246, -259, -295, -352, -401, -418, -417, -420, -426, -405, -355, -317, -326, -360, -355, -297, -240, -247, -302, -333, -307, -273, -291, -363, -430, -453, -435, -404, -369, -339, -325, -342, -370, -374, -347, -331, -363, -419, -449, -459, -483, -513, -512, -482, -455, -439, -415, -385, -369, -364, -347, -312, -292, -311, -351, -377, -374, -373, -396, -425, -419, -363, -293, -248, -230, -200, -137, -65, -26, -26, -30, -16, 3, 7, 2, 0, -7, -19, -13, 16, 43, 48, 52, 60, 63, 67, 90, 110, 90, 47, 30, 50, 75, 88, 111, 154, 206, 246, 274, 296, 312, 309, 282, 251, 232, 223, 210, 197, 192, 200, 208, 215, 239, 296, 366, 410, 419, 422, 442, 476, 499, 490, 443, 363, 281, 232, 229, 244, 240, 224, 226, 251, 283, 311, 338, 358, 366, 361, 348, 314, 265, 224, 199, 180, 152, 125, 114, 123, 143, 170, 197, 210, 205, 191, 182, 175, 158, 134, 119, 114, 117, 125, 138, 152, 173, 209, 255, 285, 286, 277, 278, 277, 252, 211, 190, 186, 173, 152, 148, 160, 176, 190, 208, 224, 240, 274, 319, 342, 329, 295, 261, 227, 192, 160, 136, 123, 113, 98, 86, 92, 125, 164, 186, 188, 186, 187, 185, 172, 151, 130, 115, 105, 88, 65, 57, 76, 100, 103, 85, 69, 74, 98, 123, 128, 114, 104, 105, 107, 98, 79, 60, 47, 41, 48, 71, 100, 123, 136, 149, 159, 157, 150, 148, 148, 133, 105, 85, 86, 100, 107, 105, 103, 110, 126, 141, 145, 147, 154, 160, 157, 149, 139, 122, 98, 77, 66, 59, 52, 49, 55, 66, 78, 91, 100, 104, 107, 107, 105, 103, 96, 76, 46, 26, 27, 35, 28, 10, 1, 10, 22, 30, 39, 55, 69, 72, 67, 63, 56, 48, 39, 31, 19, 9, 7, 11, 14, 12, 14, 24, 34, 37, 36, 35, 31, 26, 22, 22, 18, 5, -11, -23, -26, -20, -15, -16, -22, -22, -10, 0, -2, -10, -11, -10, -15, -25, -35, -40, -46, -50, -51, -50, -49, -47, -44, -38, -34, -32, -38, -44, -47, -47, -47, -50, -53, -51, -48, -44, -41, -40, -39, -38, -37, -35, -34, -35, -37, -38, -39, -39, -38, -35, -34, -34, -34, -34, -32, -32, -31, -31, -30, -30, -31, -31, -30, -30, -32, -35, -34, -31, -29, -29, -29, -28, -28, -28, -27, -26, -26, -28, -29, -29, -29, -29, -29, -28, -26, -26, -27, -28, -27, -25, -23, -23, -23, -23, -22, -21, -21, -20, -19, -18, -19, -19, -18, -18, -18, -19, -18, -16, -15, -13, -13, -12, -12, -13, -13, -11, -10, -10, -11, -12, -12, -12, -11, -11, -10, -10, -11, -11, -11, -10, -9, -9, -9, -10, -10, -9, -9, -8, -7, -7, -8, -8, -7, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -7, -7, -6, -6, -6, -6, -6, -6, -6, -6, -4, -3, -3, -4, -4, -3, -3, -3, -3, -3, -3, -4, -4, -4, -3, -3, -3, -3, -3, -3, -2, -2, -2, -2, -2, -2, -2, -1, -1, -2, -2, -1, 0, 0, -1, -1, 0, 0, -2, -1, 0, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 0, 1, 0, -1, 0, 2, 2, 0, 0, -1 };
+// IMA ADPCM blocks, see audio_adpcm.h
+static const uint8_t __in_flash("audio_seventy_sample_data") audio_seventy_sample_data[] = { 0, 0, 0, 0, 255, 247, 159, 103, 185, 26, 35, 16, 144, 174, 136, 56, 23, 160, 201, 139, 51, 152, 0, 56, 180, 107, 134, 173, 17, 144, 25, 34, 144, 10, 208, 42, 6, 25, 162, 157, 24, 83, 161, 172, 138, 66, 2, 136, 235, 41, 39, 160, 156, 8, 49, 20, 160, 236, 10, 53, 144, 186, 25, 37, 160, 188, 72, 6, 169, 137, 16, 2, 169, 8, 1, 16, 179, 223, 49, 34, 160, 157, 51, 168, 137, 217, 27, 55, 185, 41, 3, 186, 173, 66, 20, 129, 235, 25, 2, 33, 217, 10, 51, 160, 138, 216, 120, 3, 139, 184, 175, 100, 146, 186, 154, 98, 145, 10, 17, 136, 9, 18, 250, 10, 51, 194, 140, 36, 184, 170, 56, 71, 192, 172, 50, 3, 153, 137, 234, 89, 36, 185, 171, 33, 2, 48, 3, 235, 189, 72, 22, 160, 170, 26, 19, 8, 68, 224, 156, 33, 2, 0, 168, 171, 64, 19, 184, 140, 34, 201, 56, 39, 201, 10, 51, 216, 139, 81, 131, 188, 33, 201, 88, 4, 186, 11, 33, 2, 18, 201, 26, 21, 221, 57, 39, 201, 137, 24, 34, 144, 16, 250, 11, 37, 128, 152, 187, 48, 37, 144, 171, 8, 32, 3, 236, 24, 52, 160, 173, 24, 52, 186, 72, 160, 27, 34, 248, 13, 39, 184, 155, 33, 50, 129, 175, 48, 129, 137, 48, 209, 157, 81, 1, 170, 138, 32, 54, 176, 141, 2, 203, 97, 131, 171, 128, 153, 64, 36, 233, 140, 67, 144, 152, 154, 80, 4, 202, 9, 144, 32, 38, 152, 188, 26, 53, 160, 10, 129, 11, 35, 221, 81, 162, 139, 17, 153, 16, 152, 40, 53, 201, 138, 129, 57, 39, 235, 25, 2, 168, 24, 50, 23, 250, 12, 36, 153, 24, 153, 8, 1, 0, 33, 232, 140, 66, 129, 40, 184, 174, 32, 17, 66, 161, 223, 40, 51, 161, 187, 137, 16, 85, 161, 156, 128, 8, 52, 176, 188, 24, 54, 232, 25, 21, 186, 137, 17, 51, 192, 157, 16, 17, 17, 185, 158, 84, 161, 172, 32, 50, 145, 175, 24, 35, 128, 153, 153, 65, 209, 12, 53, 200, 11, 35, 219, 72, 20, 201, 11, 34, 130, 152, 170, 48, 192, 27, 55, 144, 189, 41, 53, 177, 155, 161, 139, 54, 145, 24, 251, 10, 53, 178, 158, 64, 145, 153, 25, 18, 137, 21, 251, 9, 36, 160, 138, 136, 50, 177, 140, 17, 137, 69, 208, 156, 99, 145, 171, 24, 34, 145, 152, 186, 154, 99, 20, 128, 188, 155, 81, 21, 201, 25, 129, 10, 36, 218, 56, 4, 204, 41, 37, 176, 174, 65, 132, 202, 24, 33, 1, 202, 139, 83, 2, 186, 41, 176, 14, 69, 161, 187, 9, 99, 129, 187, 9, 53, 160, 156, 16, 24, 51, 176, 174, 40, 5, 203, 56, 37, 200, 186, 8, 69, 146, 189, 56, 37, 202, 10, 49, 130, 170, 185, 88, 22, 170, 9, 1, 136, 16, 144, 203, 80, 21, 185, 188, 72, 39, 203, 19, 66, 0, 185, 12, 33, 0, 144, 12, 34, 9, 176, 143, 67, 144, 153, 138, 50, 152, 82, 216, 10, 129, 8, 36, 176, 191, 64, 20, 185, 138, 66, 161, 42, 148, 159, 82, 176, 11, 20, 202, 40, 35, 160, 174, 32, 37, 200, 139, 33, 17, 129, 217, 156, 100, 144, 10, 160, 26, 67, 129, 186, 155, 64, 4, 154, 0, 137, 17, 169, 170, 113, 71, 235, 25, 33, 145, 188, 82, 146, 154, 152, 80, 4, 188, 16, 16, 17, 169, 137, 1, 186, 65, 18, 177, 175, 70, 160, 155, 137, 33, 83, 3, 238, 138, 50, 35, 176, 191, 49, 20, 169, 156, 48, 19, 128, 204, 26, 51, 32, 200, 141, 128, 56, 71, 201, 171, 82, 3, 202, 137, 0, 33, 3, 201, 171, 49, 39, 184, 138, 130, 171, 80, 20, 169, 154, 128, 136, 32, 99, 20, 221, 138, 83, 146, 187, 24, 17, 32, 129, 202, 156, 97, 3, 186, 8, 153, 34, 128, 87, 249, 11, 52, 160, 171, 48, 33, 161, 174, 49, 19, 200, 142, 50, 145, 169, 171, 98, 20, 168, 187, 26, 55, 161, 175, 56, 35, 200, 155, 83, 2, 203, 10, 49, 3, 152, 235, 26, 51, 19, 168, 204, 10, 1, 115, 161, 170, 9, 54, 251, 57, 5, 186, 11, 68, 177, 26, 132, 205, 72, 35, 202, 25, 129, 9, 1, 16, 160, 155, 17, 34, 146, 218, 156, 101, 192, 27, 53, 176, 173, 24, 35, 4, 219, 10, 35, 129, 176, 174, 115, 161, 155, 65, 1, 171, 40, 128, 9, 81, 177, 159, 33, 34, 176, 155, 218, 120, 21, 202, 10, 33, 131, 170, 17, 200, 11, 52, 18, 144, 221, 11, 84, 130, 202, 139, 66, 18, 152, 173, 65, 160, 48, 193, 141, 50, 144, 137, 170, 115, 161, 9, 169, 48, 22, 202, 11, 34, 35, 251, 41, 146, 25, 130, 172, 50, 146, 153, 188, 114, 135, 202, 138, 99, 2, 219, 42, 19, 153, 56, 1, 186, 138, 24, 82, 3, 220, 11, 36, 0, 3, 238, 41, 18, 16, 160, 170, 153, 80, 21, 202, 25, 2, 170, 96, 130, 171, 40, 2, 186, 12, 54, 177, 140, 152, 58, 71, 192, 155, 33, 0, 34, 200, 10, 129, 168, 58, 71, 201, 138, 9, 115, 145, 154, 18, 234, 41, 51, 146, 222, 41, 37, 168, 170, 40, 34, 17, 192, 191, 88, 36, 185, 171, 32, 35, 136, 0, 188, 24, 145, 48, 87, 193, 175, 48, 20, 152, 171, 25, 51, 2, 251, 26, 35, 152, 9, 131, 204, 57, 37, 144, 186, 139, 64, 20, 169, 128, 173, 82, 17, 161, 191, 56, 69, 146, 206, 25, 20, 128, 152, 138, 33, 168, 49, 146, 188, 153, 65, 20, 137, 200, 12, 20, 9, 133, 189, 66, 160, 48, 201, 32, 169, 68, 234, 25, 18, 2, 185, 170, 40, 37, 160, 136, 216, 139, 100, 2, 251, 42, 35, 128, 219, 41, 20, 128, 186, 26, 82, 147, 190, 72, 3, 170, 8, 18, 185, 159, 251, 57, 0, 27, 71, 193, 156, 48, 18, 168, 153, 169, 113, 135, 203, 41, 36, 168, 138, 0, 8, 34, 185, 138, 32, 99, 162, 173, 128, 16, 36, 217, 9, 1, 34, 219, 72, 3, 187, 137, 66, 132, 221, 25, 36, 145, 172, 24, 66, 147, 174, 8, 49, 21, 169, 188, 27, 54, 178, 156, 18, 152, 154, 104, 21, 152, 218, 26, 35, 17, 176, 158, 16, 49, 132, 189, 128, 25, 71, 176, 156, 9, 68, 129, 187, 10, 50, 146, 154, 160, 89, 22, 185, 155, 8, 71, 177, 141, 0, 40, 130, 9, 176, 27, 37, 187, 65, 160, 49, 249, 43, 3, 17, 237, 56, 3, 152, 9, 128, 152, 202, 114, 165, 156, 33, 144, 33, 129, 219, 138, 49, 52, 185, 140, 48, 37, 221, 41, 20, 152, 203, 72, 37, 185, 173, 48, 53, 184, 157, 16, 18, 152, 26, 2, 154, 16, 17, 8, 1, 191, 56, 3, 137, 32, 179, 255, 56, 21, 144, 204, 25, 21, 136, 176, 139, 38, 168, 136, 137, 83, 176, 156, 33, 1, 8, 50, 251, 143, 67, 128, 10, 169, 10, 54, 145, 219, 138, 53, 144, 137, 152, 138, 82, 147, 188, 81, 2, 235, 138, 67, 2, 186, 171, 114, 130, 154, 160, 42, 39, 218, 40, 131, 186, 41, 52, 200, 141, 66, 168, 24, 130, 154, 41, 177, 13, 55, 185, 154, 9, 69, 176, 25, 128, 188, 80, 21, 153, 186, 8, 66, 4, 188, 8, 8, 35, 65, 240, 141, 51, 129, 200, 155, 65, 2, 137, 169, 12, 69, 144, 170, 173, 116, 146, 187, 25, 66, 129, 138, 169, 73, 133, 172, 49, 3, 202, 155, 65, 21, 185, 171, 32, 53, 161, 173, 0, 1, 33, 19, 234, 156, 16, 33, 54, 216, 157, 32, 34, 18, 235, 156, 66, 130, 152, 152, 137, 0, 67, 193, 156, 35, 218, 80, 131, 171, 136, 24, 37, 184, 171, 9, 69, 145, 188, 56, 6, 186, 40, 35, 218, 74, 3, 188, 33, 0, 52, 251, 11, 19, 25, 36, 251, 9, 3, 8, 145, 10, 178, 159, 68, 1, 168, 190, 48, 36, 130, 191, 41, 50, 2, 218, 154, 49, 35, 144, 204, 10, 99, 146, 173, 49, 146, 156, 49, 145, 137, 144, 136, 64, 162, 28, 134, 174, 48, 147, 153, 18, 249, 57, 22, 187, 48, 184, 43, 53, 0, 218, 171, 64, 38, 200, 11, 34, 169, 0, 8, 99, 162, 191, 40, 36, 152, 153, 8, 145, 25, 21, 219, 48, 147, 157, 35, 219, 72, 3, 168, 185, 25, 18, 9, 66, 177, 191, 113, 130, 171, 8, 24, 53, 161, 207, 24, 66, 2, 219, 26, 19, 136, 153, 16, 2, 236, 57, 54, 217, 139, 66, 1, 152, 186, 26, 68, 145, 155, 129, 185, 64, 37, 200, 140, 34, 168, 48, 161, 138, 154, 117, 160, 27, 129, 9, 146, 157, 115, 130, 235, 9, 51, 129, 217, 11, 51, 24, 148, 191, 65, 18, 202, 10, 34, 136, 17, 202, 8, 52, 224, 10, 0, 65, 0, 11, 35, 10, 21, 222, 72, 2, 137, 144, 171, 25, 100, 146, 171, 128, 136, 40, 39, 200, 139, 137, 85, 145, 172, 17, 128, 33, 177, 172, 17, 16, 18, 144, 235, 89, 130, 26, 209, 11, 39, 168, 187, 65, 3, 8, 176, 159, 32, 16, 36, 202, 9, 172, 115, 130, 186, 10, 18, 64, 132, 189, 40, 17, 144, 137, 1, 24, 178, 159, 19, 16, 131, 204, 136, 137, 102, 161, 141, 0, 24, 132, 155, 49, 129, 171, 24, 201, 113, 135, 187, 24, 49, 129, 137, 202, 42, 52, 145, 174, 114, 177, 158, 50, 2, 201, 138, 83, 144, 153, 154, 49, 130, 33, 192, 189, 10, 71, 128, 137, 185, 26, 36, 18, 232, 156, 65, 2, 152, 203, 16, 33, 55, 233, 171, 80, 20, 169, 171, 48, 4, 153, 0, 128, 154, 24, 33, 131, 188, 24, 19, 190, 115, 177, 10, 130, 11, 19, 56, 249, 122, 165, 172, 49, 2, 152, 186, 25, 54, 176, 173, 50, 129, 8, 184, 9, 8, 34, 104, 165, 207, 66, 1, 185, 155, 33, 85, 193, 156, 32, 2, 128, 137, 152, 169, 97, 20, 186, 157, 49, 20, 185, 140, 49, 20, 200, 174, 65, 4, 186, 8, 16, 17, 169, 153, 10, 86, 129, 188, 25, 34, 17, 184, 156, 50, 0, 136, 128, 233, 57, 22, 168, 188, 72, 20, 202, 41, 130, 138, 35, 128, 161, 223, 40, 37, 144, 169, 155, 49, 36, 234, 26, 4, 169, 8, 50, 20, 169, 222, 25, 37, 0, 184, 156, 25, 85, 162, 174, 0, 66, 2, 188, 138, 32, 38, 184, 137, 169, 65, 2, 0, 204, 41, 37, 145, 204, 11, 69, 146, 172, 136, 50, 19, 234, 187, 97, 20, 201, 154, 49, 3, 169, 153, 8, 17, 33, 130, 188, 188, 113, 22, 202, 154, 65, 19, 169, 187, 42, 39, 144, 185, 25, 51, 161, 155, 185, 45, 87, 168, 155, 17, 144, 81, 130, 187, 156, 97, 2, 168, 187, 80, 2, 170, 9, 48, 53, 161, 223, 27, 55, 168, 155, 32, 19, 186, 138, 32, 52, 162, 204, 155, 97, 35, 160, 205, 25, 53, 176, 156, 49, 19, 188, 154, 113, 3, 203, 41, 3, 203, 40, 19, 136, 155, 128, 40, 132, 30, 54, 233, 139, 51, 144, 24, 153, 144, 137, 130, 10, 39, 136, 185, 140, 68, 161, 156, 17, 152, 114, 162, 190, 40, 54, 184, 140, 128, 82, 130, 189, 0, 34, 145, 155, 186, 112, 6, 170, 9, 33, 35, 234, 139, 51, 147, 173, 40, 129, 48, 194, 158, 49, 152, 98, 193, 172, 64, 20, 200, 139, 24, 99, 160, 155, 0, 65, 131, 186, 173, 98, 130, 154, 155, 33, 17, 51, 233, 172, 56, 55, 193, 173, 48, 3, 136, 160, 172, 65, 146, 137, 8, 34, 200, 57, 145, 72, 192, 173, 57, 71, 184, 157, 33, 50, 161, 174, 56, 20, 203, 9, 52, 160, 170, 152, 72, 36, 200, 203, 48, 36, 152, 138, 16, 184, 11, 5, 244, 59, 0, 71, 184, 154, 170, 115, 20, 185, 172, 49, 36, 160, 188, 26, 35, 24, 23, 235, 26, 49, 130, 186, 32, 35, 250, 155, 98, 3, 188, 24, 145, 48, 20, 218, 171, 88, 53, 176, 205, 25, 53, 144, 187, 24, 33, 17, 184, 158, 83, 129, 170, 140, 51, 1, 161, 175, 57, 53, 224, 139, 66, 18, 218, 154, 49, 20, 185, 139, 81, 145, 154, 16, 0, 16, 160, 157, 16, 81, 3, 206, 9, 49, 21, 200, 156, 17, 129, 82, 193, 140, 129, 48, 162, 155, 17, 137, 72, 7, 188, 64, 131, 173, 32, 3, 154, 16, 161, 140, 18, 64, 179, 191, 16, 66, 131, 188, 10, 50, 131, 170, 16, 144, 205, 27, 71, 131, 220, 137, 33, 20, 176, 172, 64, 147, 188, 98, 130, 204, 41, 20, 168, 154, 35, 152, 1, 128, 185, 140, 18, 116, 133, 189, 41, 35, 129, 203, 26, 51, 8, 17, 233, 26, 0, 8, 50, 240, 142, 51, 16, 168, 172, 154, 116, 132, 187, 154, 49, 52, 160, 170, 168, 137, 97, 53, 249, 139, 49, 4, 152, 202, 138, 69, 145, 154, 152, 8, 33, 35, 176, 190, 25, 68, 129, 218, 11, 69, 129, 185, 173, 65, 2, 0, 184, 172, 56, 36, 18, 201, 172, 24, 50, 35, 232, 188, 41, 69, 145, 139, 152, 138, 82, 35, 234, 11, 19, 152, 81, 177, 158, 16, 1, 34, 184, 12, 1, 24, 131, 27, 22, 186, 204, 88, 36, 184, 172, 56, 4, 9, 161, 141, 146, 27, 39, 137, 137, 171, 115, 145, 154, 137, 66, 130, 173, 82, 145, 152, 235, 40, 36, 184, 11, 19, 128, 184, 14, 67, 160, 155, 0, 25, 39, 152, 189, 74, 39, 168, 154, 32, 128, 51, 200, 186, 137, 129, 115, 165, 159, 32, 17, 1, 168, 188, 40, 51, 128, 145, 223, 25, 83, 18, 218, 157, 49, 20, 168, 154, 9, 16, 19, 152, 16, 250, 11, 67, 3, 169, 136, 0, 200, 96, 162, 157, 50, 146, 139, 193, 175, 114, 18, 186, 171, 48, 22, 152, 10, 152, 26, 67, 145, 172, 8, 2, 66, 179, 175, 33, 129, 32, 200, 26, 51, 209, 190, 81, 20, 169, 154, 16, 0, 49, 177, 189, 9, 145, 80, 36, 176, 173, 128, 56, 71, 184, 188, 26, 36, 144, 16, 184, 158, 49, 18, 33, 1, 251, 11, 51, 161, 10, 4, 223, 40, 35, 2, 185, 139, 184, 120, 147, 157, 65, 2, 202, 9, 2, 48, 163, 174, 24, 129, 25, 69, 146, 137, 233, 156, 68, 160, 155, 8, 16, 52, 36, 216, 174, 24, 2, 50, 2, 235, 155, 48, 53, 200, 156, 32, 16, 17, 168, 8, 184, 72, 22, 144, 251, 141, 65, 18, 145, 203, 10, 17, 33, 20, 251, 11, 16, 67, 4, 203, 154, 16, 17, 9, 18, 185, 154, 97, 2, 128, 144, 186, 155, 48, 36, 98, 19, 234, 154, 17, 34, 129, 220, 11, 114, 19, 184, 187, 172, 112, 36, 168, 187, 138, 156, 244, 55, 0, 115, 36, 168, 188, 10, 17, 82, 35, 234, 171, 9, 82, 20, 160, 203, 138, 66, 18, 0, 184, 172, 32, 19, 128, 144, 153, 8, 33, 176, 73, 39, 1, 17, 250, 172, 24, 35, 129, 152, 236, 26, 33, 34, 160, 153, 252, 156, 136, 25, 67, 34, 201, 155, 152, 24, 68, 52, 146, 169, 206, 138, 83, 2, 137, 8, 152, 170, 154, 114, 39, 129, 201, 189, 32, 67, 1, 169, 186, 140, 85, 2, 153, 169, 24, 37, 161, 154, 169, 42, 87, 145, 186, 171, 48, 52, 129, 41, 19, 252, 139, 82, 18, 152, 188, 156, 40, 35, 129, 251, 155, 136, 33, 35, 200, 171, 81, 35, 168, 64, 4, 137, 66, 51, 70, 2, 200, 172, 24, 1, 35, 177, 206, 26, 70, 130, 187, 33, 176, 158, 33, 19, 8, 185, 189, 155, 82, 162, 220, 171, 48, 21, 128, 185, 191, 139, 50, 144, 203, 187, 156, 32, 37, 168, 172, 17, 201, 11, 55, 130, 153, 185, 171, 33, 34, 184, 175, 40, 69, 144, 9, 19, 136, 85, 2, 32, 37, 144, 10, 16, 51, 161, 12, 4, 205, 88, 20, 136, 128, 251, 27, 53, 52, 69, 35, 2, 18, 0, 16, 33, 168, 172, 41, 52, 130, 170, 49, 129, 32, 184, 122, 55, 144, 136, 238, 188, 186, 169, 153, 153, 187, 138, 169, 136, 0, 236, 155, 184, 221, 203, 154, 169, 188, 173, 137, 0, 137, 116, 35, 1, 137, 136, 154, 9, 34, 144, 172, 0, 50, 115, 54, 35, 16, 66, 68, 83, 19, 144, 170, 153, 203, 10, 52, 145, 136, 33, 3, 204, 136, 185, 203, 223, 138, 176, 205, 187, 170, 169, 219, 156, 24, 1, 137, 49, 130, 235, 153, 16, 84, 18, 32, 35, 1, 48, 119, 21, 17, 17, 18, 34, 34, 32, 33, 2, 17, 50, 176, 90, 39, 17, 1, 64, 163, 174, 184, 172, 16, 145, 251, 157, 153, 170, 136, 32, 54, 192, 172, 137, 152, 140, 69, 184, 156, 251, 156, 32, 68, 52, 2, 169, 189, 170, 138, 34, 1, 51, 50, 3, 137, 113, 55, 131, 24, 51, 52, 35, 144, 188, 220, 188, 155, 0, 17, 32, 35, 144, 237, 155, 152, 203, 172, 170, 136, 202, 171, 169, 205, 155, 24, 34, 83, 52, 18, 137, 48, 129, 25, 17, 24, 0, 81, 37, 83, 54, 51, 1, 16, 51, 32, 70, 0, 144, 205, 170, 188, 170, 25, 51, 176, 171, 8, 249, 156, 160, 255, 172, 153, 154, 24, 103, 36, 18, 33, 17, 136, 137, 17, 0, 152, 188, 154, 128, 24, 99, 68, 17, 24, 67, 67, 35, 152, 186, 239, 204, 154, 153, 137, 136, 136, 24, 128, 16, 84, 35, 144, 187, 189, 188, 187, 188, 187, 189, 139, 65, 52, 37, 36, 35, 1, 0, 168, 170, 186, 187, 202, 170, 0, 9, 115, 52, 84, 36, 35, 51, 2, 152, 220, 204, 203, 187, 170, 170, 24, 1, 34, 145, 188, 137, 186, 187, 235, 204, 204, 19, 196, 55, 0, 204, 171, 171, 154, 136, 32, 84, 69, 51, 51, 130, 0, 0, 144, 170, 115, 39, 144, 137, 34, 35, 99, 37, 34, 34, 129, 136, 185, 189, 186, 235, 171, 138, 65, 131, 203, 9, 160, 173, 137, 9, 49, 20, 252, 158, 137, 168, 24, 66, 51, 52, 50, 2, 16, 33, 152, 26, 130, 25, 87, 33, 34, 168, 153, 16, 83, 54, 53, 19, 218, 188, 203, 171, 155, 24, 17, 128, 188, 186, 203, 25, 128, 204, 138, 202, 138, 128, 203, 190, 172, 138, 33, 87, 36, 128, 17, 144, 40, 36, 51, 20, 169, 81, 19, 41, 53, 34, 129, 154, 71, 162, 27, 20, 152, 0, 187, 250, 156, 185, 190, 185, 223, 155, 32, 84, 84, 36, 1, 129, 168, 153, 9, 0, 144, 153, 185, 174, 137, 49, 52, 17, 1, 1, 17, 67, 177, 239, 220, 188, 186, 138, 8, 16, 17, 128, 152, 8, 34, 128, 136, 186, 235, 173, 154, 154, 188, 156, 56, 117, 53, 36, 51, 34, 136, 137, 153, 187, 153, 188, 137, 160, 26, 19, 17, 19, 82, 69, 34, 17, 130, 222, 205, 173, 187, 187, 170, 170, 24, 17, 1, 18, 0, 0, 232, 173, 137, 202, 170, 153, 128, 218, 9, 66, 86, 53, 36, 36, 35, 50, 18, 8, 128, 154, 8, 153, 49, 83, 87, 34, 136, 32, 18, 16, 34, 16, 50, 216, 253, 203, 172, 138, 153, 171, 137, 1, 218, 25, 1, 202, 139, 185, 175, 9, 0, 18, 144, 98, 131, 40, 69, 52, 68, 34, 67, 19, 17, 1, 0, 136, 32, 53, 129, 40, 21, 170, 1, 137, 53, 218, 41, 224, 172, 185, 190, 170, 235, 153, 168, 10, 51, 168, 40, 146, 40, 200, 140, 178, 175, 32, 129, 8, 144, 156, 33, 98, 71, 36, 2, 16, 18, 136, 24, 16, 144, 202, 10, 115, 2, 9, 82, 3, 217, 155, 83, 145, 205, 25, 208, 173, 32, 200, 42, 20, 168, 154, 170, 186, 219, 156, 65, 130, 188, 137, 129, 139, 83, 1, 103, 2, 9, 161, 189, 48, 144, 40, 53, 50, 161, 173, 82, 209, 189, 202, 190, 9, 82, 69, 52, 35, 0, 136, 170, 171, 9, 33, 129, 152, 236, 155, 136, 25, 83, 130, 186, 170, 153, 153, 169, 238, 205, 188, 203, 154, 9, 33, 35, 34, 2, 128, 128, 137, 66, 176, 72, 194, 158, 16, 128, 84, 19, 82, 52, 35, 83, 51, 50, 2, 203, 203, 204, 155, 8, 0, 17, 0, 170, 170, 186, 40, 209, 189, 251, 189, 187, 172, 186, 187, 169, 170, 9, 66, 68, 35, 83, 20, 128, 137, 168, 137, 168, 10, 67, 66, 68, 68, 69, 51, 83, 19, 18, 17, 0, 185, 172, 203, 172, 186, 187, 24, 18, 68, 20, 8, 67, 128, 18, 137, 53, 251, 175, 187, 156, 138, 8, 50, 34, 18, 50, 83, 52, 35, 3, 136, 168, 207, 40, 2, 48, 36, 2, 232, 155, 115, 51, 52, 36, 128, 185, 204, 171, 153, 155, 22, 7, 50, 0, 136, 203, 171, 16, 49, 69, 53, 19, 136, 16, 232, 27, 2, 154, 130, 223, 138, 202, 138, 50, 50, 101, 3, 128, 168, 156, 152, 156, 32, 201, 138, 216, 156, 8, 56, 103, 128, 24, 129, 8, 129, 153, 66, 192, 172, 185, 173, 152, 9, 52, 36, 50, 161, 155, 200, 157, 67, 145, 16, 208, 158, 24, 1, 32, 37, 160, 137, 152, 98, 34, 98, 2, 170, 136, 154, 56, 21, 32, 70, 144, 25, 232, 172, 8, 152, 171, 81, 4, 170, 16, 234, 138, 250, 173, 137, 32, 71, 52, 52, 34, 128, 153, 219, 187, 25, 0, 24, 18, 201, 10, 2, 153, 32, 177, 173, 234, 172, 137, 201, 172, 220, 187, 203, 188, 24, 49, 67, 37, 0, 18, 176, 138, 168, 140, 51, 160, 40, 38, 33, 69, 18, 82, 51, 32, 83, 18, 16, 128, 250, 203, 203, 187, 171, 10, 33, 49, 52, 2, 152, 170, 236, 189, 171, 188, 187, 202, 170, 128, 137, 66, 33, 68, 36, 67, 36, 51, 4, 168, 170, 205, 172, 153, 24, 51, 69, 53, 50, 67, 34, 34, 0, 32, 147, 191, 153, 204, 137, 153, 8, 203, 81, 2, 16, 36, 50, 131, 170, 250, 220, 203, 186, 186, 171, 24, 50, 83, 36, 1, 67, 1, 81, 3, 153, 169, 188, 172, 170, 88, 55, 129, 33, 36, 67, 50, 52, 34, 129, 219, 170, 221, 155, 168, 170, 24, 34, 161, 41, 130, 11, 53, 48, 179, 255, 155, 169, 188, 41, 38, 152, 153, 10, 51, 34, 119, 2, 32, 130, 187, 170, 174, 17, 176, 26, 18, 16, 144, 114, 71, 17, 50, 160, 204, 203, 171, 153, 41, 67, 0, 8, 129, 40, 69, 51, 129, 236, 203, 172, 170, 26, 87, 19, 18, 2, 186, 188, 155, 16, 84, 53, 34, 129, 169, 9, 24, 48, 68, 20, 202, 188, 154, 170, 40, 52, 129, 185, 223, 172, 153, 152, 33, 18, 0, 233, 189, 186, 186, 139, 16, 35, 18, 144, 88, 21, 128, 66, 20, 0, 136, 32, 35, 53, 37, 67, 20, 128, 17, 153, 32, 128, 64, 20, 160, 219, 190, 187, 220, 154, 128, 136, 128, 186, 24, 161, 219, 155, 176, 255, 154, 152, 9, 16, 34, 67, 35, 136, 32, 50, 34, 85, 21, 169, 48, 250, 140, 17, 49, 67, 66, 52, 168, 25, 160, 11, 129, 173, 32, 176, 156, 49, 18, 113, 21, 136, 1, 251, 171, 153, 24, 35, 86, 35, 8, 144, 251, 156, 169, 204, 203, 188, 138, 49, 71, 52, 53, 19, 128, 144, 169, 169, 138, 16, 129, 201, 203, 169, 185, 9, 67, 51, 52, 35, 16, 3, 221, 187, 238, 219, 187, 187, 187, 9, 50, 70, 35, 35, 4, 168, 137, 168, 153, 9, 0, 9, 218, 155, 17, 49, 38, 85, 36, 50, 53, 34, 18, 169, 202, 191, 203, 202, 138, 137, 33, 1, 66, 35, 128, 0, 8, 48, 176, 140, 160, 255, 154, 152, 153, 24, 18, 160, 11, 51, 69, 143, 236, 50, 0, 69, 36, 50, 129, 136, 200, 204, 169, 154, 168, 11, 52, 0, 115, 36, 33, 67, 20, 145, 186, 204, 138, 184, 25, 21, 168, 154, 218, 171, 136, 66, 38, 144, 24, 145, 188, 154, 17, 129, 0, 2, 253, 189, 154, 32, 54, 35, 66, 18, 218, 155, 50, 34, 68, 2, 185, 221, 172, 137, 8, 18, 49, 21, 202, 8, 51, 3, 24, 69, 217, 173, 202, 155, 136, 24, 54, 130, 136, 152, 187, 25, 52, 68, 67, 130, 219, 187, 188, 10, 33, 17, 36, 168, 154, 8, 116, 34, 67, 19, 217, 188, 171, 187, 137, 34, 54, 19, 128, 16, 33, 82, 68, 52, 18, 145, 187, 221, 187, 32, 19, 129, 137, 186, 171, 26, 103, 68, 51, 34, 129, 202, 203, 25, 34, 48, 68, 130, 202, 187, 187, 171, 186, 40, 178, 207, 41, 37, 144, 32, 249, 255, 172, 154, 137, 50, 70, 52, 36, 33, 0, 169, 153, 138, 137, 152, 16, 168, 171, 136, 16, 50, 69, 1, 32, 35, 65, 54, 1, 145, 239, 204, 203, 187, 187, 153, 9, 34, 34, 35, 146, 186, 187, 220, 187, 8, 153, 187, 187, 136, 204, 41, 130, 172, 101, 35, 70, 52, 51, 35, 2, 168, 203, 219, 138, 170, 155, 129, 137, 34, 33, 54, 66, 53, 18, 82, 2, 154, 152, 235, 188, 187, 188, 155, 186, 189, 154, 170, 140, 33, 34, 69, 52, 37, 2, 16, 144, 188, 204, 187, 154, 136, 9, 85, 2, 98, 37, 2, 34, 35, 0, 32, 18, 34, 144, 24, 136, 40, 240, 189, 153, 205, 10, 2, 137, 67, 129, 33, 146, 187, 9, 250, 207, 186, 153, 169, 169, 72, 20, 24, 55, 1, 0, 128, 8, 128, 202, 72, 21, 153, 67, 2, 8, 129, 136, 218, 172, 82, 146, 26, 38, 128, 128, 169, 136, 251, 172, 8, 168, 11, 54, 2, 67, 145, 24, 232, 174, 8, 169, 41, 52, 50, 129, 154, 0, 169, 155, 114, 39, 203, 138, 168, 24, 0, 85, 131, 154, 137, 8, 202, 104, 37, 128, 138, 66, 1, 128, 153, 128, 153, 0, 0, 33, 48, 132, 175, 100, 161, 139, 99, 2, 169, 65, 20, 1, 8, 83, 192, 171, 169, 169, 203, 154, 33, 217, 139, 184, 44, 39, 8, 55, 2, 32, 130, 32, 240, 140, 128, 9, 152, 56, 5, 155, 115, 50, 51, 83, 1, 152, 171, 154, 185, 25, 251, 191, 201, 187, 16, 49, 36, 128, 168, 255, 172, 154, 137, 32, 70, 36, 51, 18, 16, 128, 152, 8, 144, 155, 24, 169, 25, 51, 34, 53, 208, 188, 203, 137, 83, 67, 71, 19, 34, 177, 174, 219, 172, 171, 170, 153, 153, 136, 136, 0, 169, 186, 237, 170, 184, 172, 8, 153, 33, 185, 10, 249, 189, 137, 202, 172, 144, 186, 155, 136, 235, 138, 128, 154, 49, 67, 86, 4, 152, 168, 205, 187, 154, 1, 99, 52, 49, 53, 1, 160, 170, 218, 174, 153, 153, 24, 18, 66, 18, 33, 175, 234, 36, 0, 130, 10, 146, 173, 48, 17, 70, 20, 128, 0, 169, 153, 9, 18, 138, 119, 2, 16, 33, 19, 8, 117, 3, 8, 17, 129, 40, 50, 70, 1, 98, 130, 154, 168, 154, 217, 138, 2, 114, 3, 48, 22, 32, 36, 16, 33, 17, 0, 83, 18, 81, 130, 139, 131, 158, 83, 128, 48, 35, 130, 56, 55, 153, 2, 174, 34, 221, 8, 169, 34, 188, 83, 161, 24, 50, 71, 160, 137, 200, 172, 153, 170, 186, 57, 37, 50, 21, 32, 162, 175, 34, 201, 57, 177, 26, 248, 141, 2, 16, 51, 33, 52, 136, 152, 155, 160, 157, 17, 32, 18, 65, 249, 42, 70, 144, 11, 18, 137, 99, 2, 136, 169, 140, 144, 138, 68, 184, 80, 161, 11, 250, 13, 19, 144, 0, 186, 139, 129, 203, 72, 39, 168, 24, 192, 173, 16, 160, 25, 55, 145, 137, 128, 32, 176, 157, 0, 203, 24, 145, 137, 117, 146, 64, 195, 158, 1, 170, 136, 153, 16, 18, 233, 26, 132, 189, 137, 235, 171, 172, 8, 33, 69, 51, 51, 37, 2, 136, 128, 170, 1, 219, 186, 191, 137, 220, 25, 2, 153, 32, 3, 89, 55, 32, 53, 1, 35, 203, 137, 188, 9, 202, 56, 177, 172, 153, 153, 220, 25, 129, 202, 172, 33, 235, 24, 232, 140, 152, 8, 185, 158, 186, 157, 8, 153, 152, 136, 200, 141, 176, 159, 160, 156, 136, 9, 161, 42, 149, 139, 4, 159, 136, 172, 170, 139, 145, 88, 4, 128, 137, 208, 159, 1, 188, 0, 9, 17, 34, 168, 64, 144, 1, 138, 55, 188, 115, 146, 11, 34, 65, 36, 8, 50, 201, 40, 67, 36, 50, 3, 80, 20, 0, 128, 34, 40, 87, 160, 65, 34, 0, 65, 20, 16, 18, 178, 14, 3, 142, 52, 128, 16, 65, 20, 50, 161, 138, 219, 152, 57, 119, 1, 136, 154, 32, 129, 169, 80, 20, 168, 169, 16, 19, 204, 98, 146, 32, 161, 40, 232, 171, 187, 32, 99, 4, 154, 70, 146, 203, 138, 34, 145, 41, 21, 153, 17, 207, 72, 3, 56, 145, 138, 176, 120, 6, 187, 136, 184, 41, 39, 192, 11, 51, 185, 88, 3, 168, 57, 6, 219, 170, 139, 49, 19, 84, 130, 220, 138, 1, 9, 65, 18, 153, 9, 193, 175, 67, 144, 17, 184, 168, 190, 48, 192, 73, 53, 129, 186, 24, 184, 142, 50, 192, 64, 178, 27, 162, 13, 18, 128, 153, 17, 184, 64, 193, 27, 19, 9, 70, 192, 12, 52, 0, 99, 129, 154, 8, 249, 203, 9, 128, 187, 33, 201, 72, 177, 43, 134, 174, 152, 172, 32, 176, 73, 20, 0, 49, 38, 176, 156, 0, 172, 64, 161, 10, 0, 98, 20, 168, 104, 147, 156, 137, 128, 187, 67, 218, 49, 160, 49, 0, 200, 140, 146, 158, 66, 184, 43, 36, 200, 40, 249, 156, 201, 138, 162, 26, 23, 154, 65, 192, 138, 130, 205, 56, 177, 26, 176, 41, 250, 24, 217, 41, 3, 122, 248, 37, 0, 169, 235, 187, 137, 218, 42, 52, 218, 41, 209, 28, 21, 154, 34, 152, 32, 216, 172, 8, 185, 189, 11, 53, 160, 96, 144, 57, 178, 43, 210, 158, 18, 128, 34, 17, 51, 154, 85, 169, 50, 222, 48, 217, 57, 19, 40, 68, 152, 49, 249, 56, 130, 41, 32, 4, 189, 48, 152, 24, 85, 146, 9, 2, 171, 99, 169, 112, 146, 10, 52, 168, 16, 177, 156, 1, 0, 52, 18, 66, 1, 17, 145, 89, 55, 202, 9, 8, 5, 174, 64, 184, 25, 18, 187, 115, 162, 72, 4, 153, 169, 173, 81, 208, 11, 38, 153, 32, 161, 155, 153, 57, 146, 11, 4, 140, 54, 129, 66, 176, 40, 192, 175, 40, 146, 156, 168, 42, 22, 10, 38, 168, 33, 251, 25, 168, 9, 16, 129, 140, 52, 185, 114, 152, 0, 202, 48, 131, 9, 50, 235, 9, 234, 64, 193, 57, 133, 139, 68, 152, 8, 128, 0, 152, 49, 20, 80, 4, 186, 153, 137, 235, 26, 2, 57, 21, 32, 83, 18, 154, 8, 202, 24, 2, 218, 89, 147, 191, 137, 187, 139, 217, 26, 192, 156, 145, 138, 129, 25, 70, 34, 16, 32, 248, 43, 39, 152, 50, 144, 139, 144, 203, 24, 209, 139, 2, 10, 20, 138, 70, 168, 16, 0, 68, 145, 25, 232, 139, 128, 42, 38, 219, 137, 144, 138, 18, 144, 0, 185, 189, 170, 223, 9, 184, 156, 17, 200, 138, 162, 175, 136, 203, 24, 160, 11, 146, 255, 24, 160, 141, 1, 170, 169, 204, 154, 33, 184, 120, 4, 137, 17, 144, 201, 139, 168, 139, 192, 239, 10, 8, 152, 137, 34, 1, 100, 193, 139, 36, 24, 18, 137, 177, 175, 129, 171, 152, 27, 119, 1, 50, 145, 154, 137, 17, 152, 65, 130, 115, 134, 139, 18, 154, 33, 67, 1, 25, 37, 152, 8, 32, 37, 99, 2, 184, 191, 24, 184, 90, 23, 0, 67, 160, 25, 176, 57, 163, 159, 50, 233, 140, 52, 144, 64, 145, 140, 128, 8, 16, 17, 16, 17, 169, 8, 218, 190, 73, 35, 81, 20, 187, 49, 216, 139, 35, 153, 102, 145, 26, 209, 173, 65, 129, 24, 4, 186, 137, 17, 129, 156, 53, 217, 73, 5, 219, 25, 145, 139, 67, 1, 0, 17, 160, 10, 53, 177, 206, 9, 35, 235, 57, 21, 169, 24, 128, 138, 8, 16, 34, 33, 70, 163, 223, 41, 129, 202, 40, 35, 136, 50, 185, 73, 130, 88, 131, 25, 184, 28, 53, 216, 172, 40, 130, 172, 1, 236, 154, 136, 8, 129, 128, 169, 252, 189, 187, 154, 49, 53, 19, 34, 1, 24, 53, 19, 35, 129, 65, 184, 121, 2, 154, 50, 147, 12, 38, 185, 114, 1, 97, 18, 65, 129, 137, 168, 189, 138, 51, 201, 24, 146, 171, 17, 176, 158, 35, 204, 8, 217, 187, 26, 178, 12, 179, 255, 171, 170, 169, 156, 18, 154, 16, 200, 175, 56, 176, 156, 170, 186, 175, 40, 128, 186, 56, 194, 67, 238, 37, 0, 173, 8, 34, 153, 98, 145, 24, 177, 138, 53, 234, 10, 176, 207, 9, 1, 8, 33, 83, 178, 13, 2, 188, 40, 66, 35, 160, 203, 186, 138, 68, 51, 54, 202, 96, 130, 48, 34, 50, 201, 73, 19, 100, 192, 10, 130, 24, 2, 115, 18, 184, 140, 18, 24, 38, 185, 10, 49, 160, 170, 172, 64, 177, 155, 97, 55, 128, 67, 208, 10, 186, 64, 168, 53, 176, 8, 169, 168, 29, 38, 200, 25, 36, 129, 136, 48, 2, 98, 248, 73, 147, 140, 35, 138, 20, 186, 49, 186, 8, 203, 16, 99, 20, 202, 26, 55, 34, 18, 220, 25, 160, 140, 152, 49, 35, 87, 176, 157, 16, 136, 154, 40, 2, 80, 18, 1, 217, 40, 2, 19, 254, 138, 160, 26, 53, 1, 185, 10, 18, 97, 4, 169, 217, 139, 35, 136, 17, 81, 145, 10, 233, 139, 34, 50, 145, 154, 0, 96, 19, 116, 5, 185, 185, 223, 203, 170, 10, 8, 65, 35, 34, 36, 33, 2, 1, 64, 2, 172, 145, 187, 8, 136, 33, 129, 190, 16, 82, 39, 115, 53, 34, 52, 129, 169, 186, 202, 186, 25, 2, 153, 16, 67, 2, 32, 18, 83, 217, 137, 186, 160, 207, 169, 190, 187, 189, 172, 154, 169, 24, 49, 52, 1, 144, 220, 187, 221, 186, 169, 154, 153, 0, 128, 128, 153, 170, 26, 129, 115, 71, 33, 18, 2, 170, 137, 250, 155, 152, 137, 144, 24, 33, 101, 34, 66, 19, 152, 170, 221, 188, 171, 170, 172, 202, 189, 8, 8, 82, 52, 34, 51, 130, 138, 145, 206, 138, 83, 145, 172, 34, 160, 27, 84, 36, 49, 70, 130, 49, 129, 0, 145, 188, 139, 144, 173, 49, 36, 17, 36, 32, 69, 176, 57, 133, 170, 66, 128, 16, 129, 152, 205, 172, 10, 128, 97, 53, 33, 67, 129, 169, 24, 129, 41, 4, 25, 55, 8, 66, 129, 99, 184, 11, 201, 73, 132, 72, 38, 0, 33, 17, 233, 138, 128, 138, 40, 177, 207, 185, 138, 145, 26, 36, 1, 251, 12, 17, 19, 206, 40, 145, 205, 155, 82, 130, 186, 56, 39, 176, 27, 5, 24, 147, 90, 23, 186, 32, 176, 9, 137, 128, 172, 36, 218, 65, 162, 11, 129, 24, 17, 36, 137, 101, 184, 28, 19, 137, 144, 138, 250, 141, 18, 136, 35, 144, 33, 185, 218, 223, 219, 172, 169, 169, 48, 85, 52, 33, 50, 1, 0, 0, 49, 50, 33, 16, 49, 130, 25, 69, 67, 66, 52, 53, 84, 51, 51, 35, 152, 220, 172, 204, 187, 169, 153, 1, 0, 129, 153, 168, 191, 152, 204, 155, 202, 187, 205, 186, 203, 171, 203, 154, 137, 8, 49, 55, 35, 17, 145, 221, 187, 188, 187, 137, 17, 33, 84, 35, 50, 51, 34, 16, 65, 35, 82, 2, 153, 152, 189, 171, 24, 153, 114, 23, 40, 34, 8, 160, 174, 217, 173, 152, 219, 154, 185, 171, 170, 171, 203, 138, 202, 89, 36, 32, 17, 168, 222, 38, 0, 51, 250, 158, 136, 0, 128, 82, 52, 35, 51, 68, 2, 16, 50, 52, 66, 34, 50, 145, 171, 49, 147, 175, 115, 19, 0, 24, 53, 162, 154, 136, 219, 188, 171, 153, 72, 132, 11, 87, 152, 137, 152, 8, 202, 48, 3, 1, 172, 99, 160, 9, 33, 70, 1, 65, 18, 17, 33, 69, 128, 24, 160, 10, 202, 104, 35, 81, 19, 50, 145, 40, 2, 128, 201, 172, 186, 191, 188, 187, 0, 176, 172, 116, 163, 157, 17, 0, 200, 172, 170, 25, 250, 27, 4, 187, 24, 144, 16, 32, 119, 34, 137, 34, 185, 187, 10, 147, 141, 53, 201, 153, 218, 154, 8, 114, 22, 40, 19, 186, 139, 136, 9, 99, 130, 41, 147, 191, 8, 137, 185, 157, 130, 189, 25, 50, 2, 203, 173, 255, 188, 171, 138, 17, 86, 53, 51, 18, 0, 168, 152, 137, 66, 66, 35, 8, 2, 169, 24, 53, 68, 67, 50, 68, 33, 1, 184, 235, 204, 219, 171, 154, 136, 16, 18, 128, 184, 205, 172, 171, 170, 154, 154, 220, 188, 188, 172, 171, 137, 0, 49, 53, 33, 66, 2, 169, 171, 204, 173, 139, 136, 136, 83, 20, 49, 52, 67, 35, 67, 19, 1, 136, 171, 202, 190, 156, 170, 186, 9, 83, 50, 68, 3, 152, 202, 205, 219, 202, 186, 202, 187, 203, 187, 187, 137, 128, 0, 83, 51, 17, 18, 19, 201, 154, 201, 174, 8, 65, 70, 51, 85, 67, 50, 50, 67, 33, 1, 0, 35, 160, 25, 145, 202, 138, 49, 32, 103, 35, 16, 18, 128, 184, 155, 193, 255, 138, 153, 155, 10, 65, 35, 20, 50, 53, 152, 25, 17, 19, 155, 68, 217, 155, 136, 137, 81, 69, 35, 84, 4, 32, 34, 137, 1, 169, 187, 24, 184, 43, 103, 18, 32, 36, 128, 1, 66, 177, 175, 136, 221, 171, 170, 154, 186, 155, 0, 128, 168, 25, 194, 207, 170, 136, 236, 10, 168, 10, 144, 88, 131, 80, 20, 40, 21, 1, 18, 16, 0, 65, 193, 75, 21, 137, 83, 2, 16, 128, 153, 140, 50, 249, 41, 3, 169, 187, 137, 173, 1, 223, 80, 3, 154, 50, 3, 200, 42, 55, 34, 17, 49, 4, 236, 138, 169, 171, 204, 156, 136, 154, 17, 34, 35, 2, 239, 171, 203, 10, 68, 85, 67, 36, 17, 1, 0, 136, 32, 49, 34, 1, 51, 16, 71, 17, 50, 1, 0, 168, 40, 51, 18, 194, 255, 188, 189, 203, 171, 154, 137, 0, 153, 153, 219, 204, 187, 188, 203, 169, 171, 201, 170, 185, 155, 219, 138, 17, 17, 83, 68, 35, 1, 34, 250, 154, 152, 155, 32, 115, 35, 52, 36, 51, 18, 8, 1, 153, 144, 10, 5, 206, 137, 200, 171, 137, 1, 128, 34, 232, 188, 204, 173, 218, 188, 185, 188, 154, 154, 9, 0, 154, 19, 219, 40, 144, 48, 131, 112, 131, 140, 18, 204, 65, 33, 86, 35, 68, 50, 67, 17, 33, 2, 8, 8, 51, 1, 3, 245, 35, 0, 51, 33, 20, 32, 200, 74, 4, 32, 162, 26, 234, 205, 186, 220, 139, 201, 155, 0, 34, 185, 116, 4, 16, 17, 16, 19, 203, 57, 69, 18, 24, 70, 145, 25, 18, 113, 19, 65, 36, 24, 1, 17, 128, 33, 144, 17, 152, 57, 70, 50, 69, 130, 33, 129, 170, 189, 8, 234, 154, 152, 219, 155, 235, 171, 152, 137, 8, 169, 137, 234, 173, 219, 156, 168, 203, 154, 153, 137, 202, 10, 20, 136, 66, 1, 69, 160, 72, 53, 1, 64, 4, 137, 161, 13, 52, 48, 37, 2, 17, 18, 154, 84, 1, 32, 18, 146, 173, 0, 221, 9, 217, 158, 8, 185, 42, 38, 8, 85, 2, 136, 129, 137, 34, 0, 83, 51, 146, 222, 219, 171, 128, 171, 9, 153, 9, 128, 56, 21, 152, 186, 239, 204, 138, 82, 36, 83, 67, 18, 17, 129, 32, 49, 66, 19, 17, 1, 8, 82, 68, 51, 35, 18, 8, 136, 32, 50, 52, 251, 191, 203, 188, 171, 186, 187, 169, 204, 187, 188, 187, 219, 187, 189, 172, 219, 170, 186, 154, 219, 154, 186, 156, 8, 24, 130, 136, 1, 186, 171, 202, 189, 155, 154, 145, 106, 87, 17, 51, 18, 36, 1, 32, 18, 67, 20, 32, 19, 154, 1, 57, 55, 50, 35, 33, 232, 173, 187, 157, 250, 188, 170, 173, 169, 170, 170, 173, 154, 203, 170, 154, 49, 192, 57, 162, 9, 249, 25, 161, 12, 0, 113, 35, 98, 52, 33, 36, 1, 66, 129, 65, 20, 50, 19, 40, 19, 24, 19, 80, 38, 16, 19, 153, 66, 0, 83, 176, 12, 35, 0, 137, 116, 21, 136, 0, 49, 144, 112, 131, 96, 19, 32, 35, 50, 176, 9, 2, 1, 8, 112, 87, 129, 40, 51, 38, 169, 80, 18, 0, 16, 50, 67, 18, 1, 128, 17, 200, 48, 4, 65, 3, 40, 210, 174, 186, 171, 1, 220, 153, 32, 162, 239, 8, 168, 136, 218, 9, 145, 187, 203, 154, 202, 189, 187, 170, 186, 41, 35, 52, 162, 155, 1, 252, 189, 57, 5, 0, 160, 72, 5, 171, 18, 8, 21, 25, 71, 128, 32, 50, 19, 153, 48, 36, 152, 8, 202, 96, 146, 140, 145, 140, 18, 152, 144, 42, 103, 185, 11, 168, 189, 169, 173, 25, 160, 172, 48, 3, 189, 88, 20, 187, 25, 136, 83, 176, 155, 171, 34, 255, 141, 136, 153, 9, 144, 33, 179, 174, 17, 248, 191, 8, 83, 19, 66, 53, 36, 17, 16, 33, 0, 16, 52, 36, 67, 54, 52, 0, 17, 34, 1, 8, 99, 51, 51, 50, 129, 170, 235, 188, 187, 171, 8, 2, 128, 129, 186, 253, 190, 203, 170, 186, 204, 186, 202, 220, 171, 171, 189, 170, 152, 187, 187, 172, 187, 191, 187, 172, 186, 188, 170, 187, 219, 172, 187, 189, 186, 186, 153, 9, 67, 18, 2, 152, 152, 221, 139, 136, 66, 18, 82, 36, 129, 152, 136, 170, 204, 9, 68, 19, 18, 19, 177, 239, 154, 216, 218, 37, 0, 169, 153, 32, 53, 51, 69, 34, 51, 128, 34, 0, 115, 18, 99, 18, 66, 129, 8, 152, 9, 144, 113, 36, 66, 20, 49, 3, 24, 51, 129, 136, 83, 53, 1, 128, 9, 33, 218, 26, 103, 51, 66, 53, 2, 17, 128, 170, 153, 17, 49, 87, 3, 33, 19, 185, 171, 188, 26, 116, 83, 83, 36, 18, 17, 145, 186, 48, 20, 49, 86, 36, 18, 17, 1, 152, 136, 8, 67, 67, 83, 36, 144, 218, 172, 187, 219, 170, 16, 17, 17, 17, 130, 250, 171, 155, 138, 153, 32, 2, 251, 205, 188, 172, 188, 137, 0, 33, 18, 34, 129, 218, 190, 171, 186, 155, 136, 0, 168, 205, 219, 203, 203, 138, 34, 52, 37, 52, 19, 17, 176, 171, 169, 137, 50, 117, 35, 16, 34, 144, 170, 138, 137, 33, 217, 113, 178, 175, 169, 172, 172, 138, 144, 25, 18, 16, 176, 11, 194, 207, 168, 187, 144, 170, 0, 10, 3, 207, 8, 65, 55, 0, 82, 20, 1, 50, 35, 34, 35, 1, 1, 48, 225, 142, 68, 145, 10, 51, 248, 175, 137, 169, 152, 113, 68, 66, 67, 50, 34, 17, 35, 17, 49, 84, 69, 50, 67, 67, 50, 17, 17, 34, 18, 50, 71, 18, 33, 17, 136, 200, 173, 154, 169, 154, 139, 16, 234, 189, 188, 204, 204, 171, 186, 187, 204, 170, 187, 220, 186, 171, 203, 171, 170, 171, 172, 219, 187, 188, 204, 187, 171, 186, 172, 169, 185, 188, 172, 187, 187, 219, 154, 17, 33, 51, 1, 8, 129, 219, 155, 96, 69, 51, 51, 68, 19, 129, 128, 8, 129, 9, 86, 35, 16, 67, 18, 186, 172, 8, 33, 83, 85, 52, 67, 34, 8, 16, 144, 170, 9, 100, 18, 50, 52, 36, 144, 137, 8, 33, 0, 118, 36, 18, 35, 35, 3, 8, 18, 50, 146, 112, 38, 16, 0, 24, 34, 17, 66, 87, 36, 34, 36, 50, 18, 32, 35, 17, 54, 65, 53, 66, 34, 33, 19, 137, 50, 1, 66, 69, 17, 32, 145, 9, 146, 154, 41, 119, 23, 49, 52, 33, 34, 51, 2, 8, 66, 33, 34, 136, 69, 17, 128, 10, 20, 0, 51, 0, 131, 239, 154, 153, 251, 172, 128, 203, 155, 187, 186, 188, 171, 251, 156, 152, 136, 187, 155, 169, 220, 155, 170, 172, 24, 130, 202, 10, 2, 250, 187, 186, 189, 187, 187, 204, 172, 153, 203, 186, 187, 9, 16, 33, 66, 145, 57, 146, 140, 50, 18, 115, 39, 0, 0, 115, 129, 171, 204, 24, 216, 156, 170, 9, 218, 171, 152, 153, 234, 25, 176, 172, 0, 32, 176, 173, 17, 169, 97, 2, 114, 36, 82, 52, 51, 53, 34, 51, 36, 68, 51, 84, 19, 128, 136, 185, 170, 170, 138, 50, 82, 36, 160, 238, 172, 9, 17, 98, 86, 52, 52, 50, 34, 19, 1, 34, 33, 100, 84, 50, 51, 36, 35, 34, 144, 9, 65, 51, 66, 52, 51, 34, 168, 204, 187, 187, 189, 220, 61, 37, 0, 154, 169, 187, 251, 204, 205, 171, 187, 173, 203, 170, 170, 188, 203, 203, 171, 187, 219, 186, 169, 186, 205, 187, 203, 187, 204, 171, 154, 170, 187, 172, 187, 189, 172, 186, 170, 170, 32, 34, 145, 154, 17, 176, 239, 41, 51, 52, 67, 52, 18, 129, 168, 187, 173, 10, 82, 35, 35, 69, 19, 144, 170, 139, 67, 19, 84, 71, 36, 34, 18, 33, 129, 0, 33, 82, 69, 50, 37, 19, 1, 34, 129, 152, 64, 69, 51, 51, 66, 36, 17, 129, 138, 33, 2, 49, 2, 16, 162, 205, 222, 155, 0, 24, 17, 100, 35, 136, 137, 169, 187, 140, 66, 54, 50, 83, 19, 184, 205, 171, 169, 137, 83, 69, 35, 2, 0, 168, 206, 170, 9, 50, 33, 70, 52, 35, 168, 40, 2, 152, 65, 71, 51, 66, 35, 17, 129, 138, 17, 16, 82, 100, 52, 17, 17, 17, 17, 152, 8, 33, 146, 204, 9, 248, 172, 128, 168, 185, 138, 35, 252, 171, 136, 185, 190, 24, 216, 154, 202, 156, 184, 174, 152, 40, 176, 157, 33, 192, 189, 172, 153, 219, 171, 0, 34, 168, 43, 54, 217, 138, 16, 65, 3, 64, 53, 130, 187, 41, 145, 190, 56, 39, 128, 40, 18, 169, 188, 9, 168, 139, 249, 41, 5, 188, 128, 169, 152, 174, 64, 129, 48, 69, 51, 144, 24, 3, 128, 170, 114, 22, 33, 66, 53, 2, 32, 68, 3, 169, 42, 37, 201, 138, 0, 145, 223, 138, 168, 203, 138, 81, 54, 50, 68, 36, 34, 0, 33, 33, 50, 69, 53, 36, 51, 68, 34, 1, 33, 18, 51, 52, 83, 52, 34, 128, 8, 169, 188, 171, 153, 137, 8, 169, 253, 204, 219, 203, 172, 172, 170, 186, 187, 189, 172, 188, 172, 203, 171, 169, 171, 187, 188, 188, 189, 203, 203, 171, 171, 187, 186, 187, 204, 186, 188, 172, 202, 170, 153, 128, 0, 17, 128, 137, 186, 138, 99, 83, 69, 67, 50, 36, 18, 16, 0, 144, 9, 115, 19, 67, 37, 35, 17, 33, 17, 33, 52, 115, 52, 67, 51, 35, 34, 1, 0, 40, 70, 34, 53, 52, 51, 36, 0, 16, 33, 0, 99, 37, 35, 66, 19, 1, 18, 128, 136, 8, 201, 57, 5, 204, 172, 170, 201, 172, 8, 67, 19, 81, 36, 128, 136, 16, 35, 8, 102, 52, 67, 51, 128, 65, 131, 154, 48, 68, 36, 35, 2, 33, 176, 191, 137, 128, 72, 119, 19, 50, 52, 18, 2, 17, 152, 88, 38, 33, 66, 51, 53, 17, 24, 50, 52, 17, 98, 36, 18, 0, 35, 201, 156, 16, 144, 202, 137, 34, 146, 223, 155, 128, 203, 170, 154, 153, 202, 187, 173, 203, 188, 155, 169, 188, 25, 20, 203, 203, 171, 187, 220, 172, 138, 169, 156, 9, 186, 187, 32, 216, 140, 1, 33, 160, 157, 49, 68, 36, 67, 55, 20, 50, 35, 18, 34, 1, 16, 99, 52, 52, 19, 136, 24, 18, 221, 41, 3, 137, 217, 155, 12, 26, 0, 189, 205, 219, 186, 171, 169, 187, 24, 192, 206, 171, 203, 203, 155, 33, 52, 53, 83, 34, 33, 0, 16, 3, 96, 70, 67, 50, 67, 36, 1, 17, 0, 50, 36, 68, 67, 51, 51, 50, 129, 137, 0, 33, 1, 69, 35, 51, 216, 188, 202, 219, 203, 153, 168, 171, 169, 222, 188, 203, 203, 187, 172, 171, 186, 204, 172, 187, 220, 171, 203, 186, 171, 171, 203, 188, 219, 202, 202, 186, 187, 170, 185, 171, 170, 172, 187, 189, 170, 170, 138, 8, 32, 129, 172, 0, 235, 171, 171, 48, 20, 114, 19, 65, 19, 137, 2, 153, 100, 35, 69, 51, 36, 34, 49, 129, 25, 83, 67, 52, 85, 35, 50, 34, 33, 18, 49, 53, 69, 52, 51, 51, 52, 51, 34, 49, 53, 35, 66, 51, 37, 152, 64, 130, 9, 2, 117, 21, 34, 35, 33, 131, 137, 3, 9, 54, 32, 83, 33, 69, 130, 128, 137, 100, 19, 33, 69, 37, 1, 24, 66, 19, 32, 69, 36, 19, 66, 36, 34, 34, 51, 52, 19, 67, 53, 34, 50, 50, 52, 17, 49, 53, 51, 35, 81, 20, 136, 0, 187, 136, 206, 154, 202, 171, 219, 170, 205, 154, 170, 219, 170, 186, 190, 154, 204, 171, 203, 171, 202, 186, 187, 170, 220, 155, 202, 171, 153, 204, 138, 128, 186, 171, 32, 146, 138, 24, 52, 145, 89, 36, 152, 8, 115, 4, 154, 50, 144, 152, 207, 8, 136, 68, 128, 0, 169, 25, 252, 172, 169, 11, 144, 219, 172, 169, 251, 189, 172, 187, 186, 138, 128, 24, 33, 160, 154, 187, 203, 88, 55, 65, 84, 50, 82, 35, 34, 36, 65, 52, 82, 67, 50, 53, 18, 51, 18, 67, 51, 83, 34, 83, 20, 33, 18, 17, 1, 32, 1, 17, 35, 35, 208, 204, 218, 188, 188, 187, 188, 172, 186, 203, 203, 204, 203, 203, 187, 188, 185, 173, 170, 219, 186, 204, 186, 187, 188, 203, 186, 186, 203, 188, 187, 188, 188, 186, 187, 171, 202, 186, 189, 203, 186, 202, 189, 137, 8, 168, 138, 0, 152, 202, 156, 136, 153, 98, 51, 36, 19, 84, 131, 153, 34, 50, 54, 67, 85, 50, 34, 34, 34, 2, 1, 116, 35, 52, 51, 69, 17, 49, 19, 50, 36, 67, 36, 35, 36, 18, 34, 144, 25, 36, 129, 114, 36, 18, 1, 33, 18, 170, 42, 71, 18, 33, 85, 51, 146, 25, 68, 146, 25, 71, 19, 50, 52, 50, 1, 17, 34, 67, 67, 82, 68, 34, 1, 16, 2, 187, 128, 136, 49, 2, 104, 22, 202, 32, 161, 188, 153, 16, 83, 2, 67, 2, 18, 249, 72, 3, 155, 115, 21, 152, 56, 4, 203, 16, 144, 32, 18, 0, 115, 178, 188, 136, 152, 251, 25, 130, 154, 8, 152, 170, 188, 154, 185, 219, 174, 66, 161, 140, 0, 203, 218, 156, 128, 169, 174, 24, 169, 218, 188, 152, 204, 169, 138, 0, 172, 8, 234, 171, 169, 171, 171, 40, 161, 201, 3, 16, 0, 106, 163, 175, 144, 185, 205, 138, 136, 137, 169, 153, 186, 205, 187, 156, 136, 205, 40, 192, 138, 144, 11, 2, 204, 154, 114, 131, 25, 71, 129, 137, 33, 49, 3, 64, 55, 67, 18, 16, 35, 128, 218, 190, 170, 56, 161, 157, 35, 136, 33, 203, 152, 207, 9, 152, 152, 170, 169, 9, 233, 174, 32, 162, 142, 36, 0, 36, 26, 39, 8, 51, 128, 50, 18, 101, 19, 49, 67, 67, 19, 48, 54, 16, 82, 18, 50, 2, 66, 19, 32, 19, 16, 160, 40, 208, 26, 192, 138, 235, 203, 205, 156, 170, 187, 204, 187, 187, 188, 188, 204, 170, 188, 188, 186, 205, 170, 187, 170, 220, 170, 186, 172, 186, 187, 203, 187, 188, 219, 203, 187, 219, 187, 170, 187, 187, 188, 203, 203, 186, 173, 168, 203, 153, 187, 137, 169, 9, 160, 24, 51, 53, 53, 37, 17, 67, 17, 68, 35, 50, 33, 84, 17, 84, 19, 66, 34, 50, 51, 33, 34, 50, 82, 70, 2, 34, 17, 49, 21, 33, 3, 32, 36, 50, 37, 82, 20, 18, 18, 49, 69, 67, 83, 52, 83, 67, 35, 35, 66, 52, 50, 69, 52, 67, 51, 51, 35, 50, 52, 67, 52, 69, 67, 50, 49, 67, 50, 35, 34, 67, 83, 83, 51, 36, 50, 1, 17, 68, 67, 51, 67, 18, 33, 99, 34, 2, 8, 33, 33, 34, 68, 3, 128, 187, 170, 206, 26, 200, 172, 168, 188, 218, 188, 9, 16, 97, 2, 72, 149, 159, 0, 115, 147, 73, 147, 139, 154, 37, 239, 9, 153, 66, 145, 187, 190, 154, 48, 53, 184, 223, 172, 9, 66, 70, 35, 184, 190, 139, 48, 35, 2, 185, 188, 156, 66, 50, 177, 190, 170, 25, 19, 17, 129, 186, 139, 84, 35, 145, 252, 187, 9, 99, 36, 128, 202, 171, 137, 66, 52, 34, 160, 219, 139, 32, 36, 1, 0, 168, 187, 25, 70, 18, 176, 189, 170, 138, 99, 51, 130, 235, 170, 152, 137, 32, 52, 19, 202, 140, 85, 35, 17, 185, 204, 140, 16, 66, 52, 35, 160, 188, 153, 16, 169, 40, 68, 34, 18, 234, 138, 1, 201, 189, 24, 34, 82, 35, 50, 4, 221, 203, 170, 137, 24, 50, 36, 129, 155, 113, 19, 185, 219, 171, 137, 1, 65, 36, 136, 99, 192, 187, 137, 82, 22, 168, 136, 250, 156, 17, 128, 144, 185, 9, 83, 51, 36, 128, 235, 204, 137, 40, 1, 16, 33, 101, 52, 18, 128, 152, 203, 24, 128, 17, 33, 20, 80, 54, 129, 34, 0, 144, 187, 129, 156, 0, 49, 177, 88, 224, 155, 202, 57, 67, 52, 161, 190, 206, 171, 153, 170, 8, 168, 41, 19, 48, 211, 207, 185, 189, 156, 153, 137, 0, 17, 136, 153, 16, 176, 174, 153, 185, 221, 9, 1, 128, 170, 33, 34, 100, 52, 53, 35, 51, 145, 171, 186, 173, 25, 54, 68, 54, 34, 0, 129, 152, 170, 170, 187, 171, 187, 57, 119, 18, 16, 86, 253, 41, 0, 184, 154, 170, 9, 145, 42, 132, 189, 188, 188, 156, 48, 21, 17, 18, 51, 2, 49, 194, 191, 204, 188, 153, 16, 50, 67, 2, 50, 38, 1, 33, 66, 249, 172, 169, 155, 128, 24, 33, 86, 52, 52, 51, 2, 160, 185, 154, 0, 34, 82, 37, 33, 51, 116, 52, 35, 35, 52, 160, 204, 188, 137, 201, 10, 99, 51, 128, 49, 39, 129, 170, 8, 161, 205, 155, 81, 35, 16, 33, 131, 222, 56, 161, 25, 33, 69, 161, 172, 170, 221, 138, 18, 8, 99, 2, 136, 202, 171, 137, 202, 138, 152, 57, 132, 8, 34, 192, 206, 203, 172, 40, 17, 32, 66, 129, 187, 234, 206, 138, 8, 18, 0, 34, 130, 188, 139, 200, 158, 66, 131, 138, 128, 8, 129, 172, 83, 129, 48, 86, 36, 2, 16, 1, 216, 174, 16, 129, 56, 55, 19, 17, 185, 11, 36, 251, 27, 37, 168, 169, 154, 136, 152, 112, 39, 145, 137, 152, 234, 139, 49, 1, 137, 17, 218, 154, 40, 68, 129, 136, 136, 238, 155, 17, 185, 24, 200, 175, 136, 137, 98, 85, 35, 17, 144, 138, 219, 171, 40, 51, 51, 83, 68, 35, 49, 3, 24, 200, 175, 8, 137, 48, 36, 17, 129, 170, 139, 18, 217, 26, 146, 255, 187, 170, 202, 139, 24, 168, 137, 145, 205, 153, 205, 187, 204, 188, 155, 8, 8, 33, 50, 160, 204, 173, 153, 203, 25, 168, 137, 1, 48, 52, 53, 36, 36, 0, 17, 0, 52, 19, 65, 35, 16, 70, 99, 84, 50, 18, 32, 130, 203, 186, 10, 129, 25, 53, 83, 37, 33, 1, 169, 235, 174, 138, 187, 10, 18, 16, 2, 168, 156, 184, 191, 152, 203, 154, 185, 172, 8, 128, 50, 184, 74, 37, 33, 52, 68, 22, 153, 8, 170, 49, 48, 119, 17, 66, 1, 67, 129, 65, 3, 8, 16, 18, 48, 71, 17, 36, 144, 8, 128, 24, 65, 86, 18, 1, 144, 186, 172, 203, 41, 20, 9, 50, 67, 216, 27, 194, 142, 160, 191, 33, 168, 25, 36, 152, 186, 172, 187, 139, 35, 114, 6, 153, 168, 191, 9, 169, 65, 35, 50, 176, 173, 9, 16, 0, 117, 36, 144, 137, 25, 16, 33, 2, 116, 147, 27, 18, 49, 4, 65, 162, 173, 169, 156, 65, 66, 35, 128, 168, 191, 171, 170, 16, 0, 19, 220, 137, 220, 155, 185, 136, 187, 9, 222, 137, 144, 170, 185, 204, 187, 187, 154, 41, 85, 49, 21, 170, 186, 189, 186, 140, 82, 17, 115, 2, 0, 0, 16, 216, 41, 6, 138, 67, 128, 32, 0, 65, 2, 16, 18, 52, 248, 74, 20, 169, 9, 50, 250, 138, 20, 129, 8, 41, 3, 223, 138, 152, 138, 128, 32, 54, 177, 11, 132, 207, 9, 152, 128, 153, 33, 216, 138, 185, 138, 16, 152, 113, 23, 170, 64, 130, 156, 1, 184, 188, 137, 34, 0, 70, 3, 128, 251, 175, 153, 153, 48, 54, 52, 18, 129, 160, 203, 63, 253, 49, 0, 154, 9, 65, 53, 35, 84, 34, 34, 18, 16, 168, 171, 144, 57, 119, 18, 50, 132, 138, 152, 171, 16, 16, 50, 19, 217, 206, 154, 203, 138, 176, 139, 168, 189, 204, 187, 220, 186, 172, 171, 187, 8, 185, 155, 219, 189, 204, 156, 154, 137, 128, 16, 17, 154, 128, 203, 153, 187, 17, 169, 72, 101, 53, 67, 35, 34, 34, 18, 33, 68, 67, 19, 49, 21, 16, 70, 51, 17, 49, 3, 202, 9, 203, 137, 235, 9, 160, 138, 0, 100, 160, 156, 186, 221, 173, 154, 169, 137, 0, 35, 144, 144, 187, 162, 255, 155, 169, 152, 9, 54, 51, 51, 1, 50, 176, 156, 66, 53, 18, 69, 35, 65, 36, 51, 49, 54, 128, 68, 129, 67, 130, 98, 130, 40, 19, 33, 38, 34, 52, 130, 24, 192, 172, 186, 64, 148, 89, 37, 144, 136, 234, 139, 192, 140, 128, 48, 131, 138, 0, 192, 174, 169, 13, 5, 172, 66, 168, 154, 139, 82, 176, 28, 51, 49, 240, 155, 19, 137, 184, 59, 103, 144, 32, 36, 144, 9, 17, 144, 155, 115, 21, 16, 16, 1, 152, 153, 170, 66, 1, 82, 4, 184, 171, 35, 252, 139, 168, 10, 194, 158, 0, 187, 129, 223, 24, 201, 137, 128, 136, 201, 11, 176, 190, 203, 41, 132, 157, 34, 136, 160, 175, 17, 169, 9, 48, 22, 187, 65, 168, 32, 221, 72, 130, 138, 0, 66, 161, 10, 19, 138, 161, 191, 69, 160, 56, 146, 114, 177, 143, 35, 160, 9, 0, 18, 203, 137, 154, 53, 250, 56, 162, 154, 170, 48, 218, 24, 170, 100, 176, 9, 35, 33, 234, 56, 179, 30, 178, 14, 22, 187, 81, 146, 137, 52, 129, 0, 0, 217, 171, 136, 138, 84, 51, 50, 101, 18, 169, 152, 253, 171, 137, 154, 80, 68, 34, 34, 146, 187, 187, 206, 154, 24, 18, 82, 35, 66, 51, 145, 138, 144, 236, 155, 32, 128, 98, 52, 17, 1, 128, 168, 152, 185, 11, 146, 206, 153, 137, 68, 1, 82, 129, 152, 221, 171, 203, 171, 170, 9, 152, 48, 36, 18, 250, 156, 219, 189, 171, 138, 136, 33, 20, 33, 1, 170, 188, 203, 188, 171, 172, 26, 50, 99, 84, 35, 0, 1, 176, 203, 138, 128, 26, 69, 51, 84, 51, 50, 50, 161, 186, 217, 188, 152, 16, 34, 115, 36, 34, 2, 32, 162, 204, 221, 155, 184, 171, 34, 67, 36, 49, 35, 217, 203, 204, 186, 219, 138, 17, 65, 20, 65, 19, 170, 169, 175, 152, 170, 40, 17, 83, 1, 84, 19, 24, 18, 168, 187, 153, 8, 115, 39, 17, 52, 1, 18, 0, 52, 17, 53, 153, 83, 200, 73, 2, 81, 35, 82, 3, 137, 145, 155, 144, 174, 66, 144, 10, 69, 2, 137, 83, 232, 155, 201, 139, 160, 24, 2, 114, 161, 157, 152, 186, 188, 139, 52, 233, 24, 160, 40, 249, 10, 17, 169, 155, 25, 35, 169, 114, 18, 34, 219, 56, 128, 124, 0, 36, 0, 185, 75, 103, 0, 8, 32, 3, 26, 54, 136, 69, 176, 41, 162, 141, 33, 40, 70, 0, 50, 2, 169, 187, 128, 221, 9, 128, 48, 19, 8, 53, 232, 138, 232, 172, 152, 172, 24, 168, 25, 160, 171, 186, 189, 204, 138, 193, 191, 24, 200, 155, 136, 40, 129, 11, 38, 184, 170, 203, 154, 221, 139, 83, 130, 65, 53, 16, 160, 157, 137, 138, 200, 105, 37, 137, 49, 20, 154, 33, 152, 32, 251, 41, 129, 136, 128, 86, 145, 10, 20, 154, 128, 138, 130, 188, 186, 140, 2, 42, 71, 16, 21, 234, 138, 152, 235, 10, 51, 128, 49, 35, 50, 208, 157, 17, 216, 157, 48, 161, 41, 3, 32, 208, 190, 139, 67, 152, 113, 22, 145, 136, 136, 185, 155, 32, 53, 36, 67, 51, 34, 160, 139, 18, 220, 25, 53, 48, 54, 18, 50, 129, 168, 173, 137, 184, 41, 38, 0, 129, 32, 131, 191, 154, 153, 235, 190, 137, 184, 157, 8, 168, 139, 145, 173, 185, 207, 153, 203, 170, 187, 24, 152, 56, 146, 57, 242, 190, 169, 187, 153, 139, 51, 0, 70, 18, 34, 17, 129, 168, 186, 189, 40, 71, 67, 37, 33, 51, 1, 169, 25, 3, 170, 98, 19, 0, 100, 50, 66, 2, 136, 32, 248, 172, 0, 152, 137, 32, 3, 40, 132, 72, 132, 189, 186, 188, 251, 171, 9, 128, 48, 52, 52, 18, 219, 170, 189, 170, 205, 57, 20, 128, 48, 54, 129, 16, 18, 186, 25, 232, 42, 55, 136, 115, 20, 1, 136, 82, 160, 89, 130, 73, 20, 154, 1, 17, 2, 120, 36, 17, 3, 186, 48, 232, 156, 65, 145, 25, 53, 129, 128, 17, 163, 223, 8, 187, 10, 144, 48, 21, 128, 168, 152, 222, 172, 136, 169, 171, 25, 129, 222, 138, 34, 145, 171, 48, 3, 253, 157, 128, 138, 0, 144, 65, 35, 0, 0, 16, 224, 141, 145, 156, 18, 40, 55, 129, 67, 129, 138, 184, 156, 16, 51, 146, 113, 22, 153, 25, 1, 154, 48, 162, 156, 128, 170, 202, 10, 128, 113, 195, 141, 35, 218, 9, 169, 202, 157, 153, 155, 65, 1, 64, 23, 202, 154, 138, 234, 172, 67, 146, 40, 19, 16, 185, 26, 250, 58, 211, 13, 20, 137, 83, 0, 33, 184, 48, 249, 43, 4, 26, 21, 0, 130, 153, 170, 96, 192, 90, 21, 155, 16, 24, 146, 143, 37, 169, 16, 184, 25, 176, 88, 132, 10, 160, 27, 150, 157, 67, 136, 51, 251, 8, 145, 186, 26, 37, 153, 82, 144, 10, 146, 156, 185, 175, 186, 42, 19, 88, 71, 50, 129, 153, 169, 221, 154, 8, 65, 51, 67, 53, 129, 152, 8, 168, 188, 25, 1, 32, 54, 52, 35, 66, 145, 172, 186, 173, 137, 136, 24, 52, 160, 137, 144, 204, 186, 220, 204, 187, 188, 187, 138, 8, 136, 33, 250, 173, 202, 188, 187, 172, 153, 153, 17, 0, 34, 169, 154, 239, 171, 186, 154, 1, 16, 159, 212, 38, 0, 85, 2, 32, 17, 40, 130, 138, 68, 200, 57, 38, 66, 52, 51, 52, 2, 17, 16, 17, 144, 115, 4, 33, 68, 35, 20, 0, 83, 145, 138, 0, 16, 1, 139, 103, 145, 32, 3, 9, 162, 157, 128, 188, 153, 25, 131, 141, 83, 160, 171, 16, 249, 187, 154, 184, 189, 48, 145, 41, 132, 155, 161, 159, 34, 170, 113, 2, 0, 153, 115, 4, 25, 115, 35, 136, 65, 18, 0, 64, 20, 16, 37, 17, 52, 33, 67, 51, 20, 137, 84, 192, 138, 18, 136, 65, 68, 50, 18, 160, 188, 186, 222, 187, 48, 201, 88, 131, 137, 161, 155, 237, 154, 184, 159, 8, 137, 152, 8, 20, 220, 137, 201, 139, 168, 156, 33, 160, 170, 153, 136, 170, 90, 23, 168, 16, 185, 154, 189, 113, 132, 32, 19, 0, 33, 128, 185, 41, 131, 172, 65, 35, 81, 71, 1, 24, 130, 221, 154, 136, 155, 81, 3, 24, 129, 153, 206, 139, 33, 160, 158, 33, 252, 26, 129, 9, 68, 2, 136, 129, 236, 9, 168, 73, 18, 32, 130, 120, 178, 143, 34, 169, 40, 128, 82, 131, 154, 82, 130, 172, 16, 152, 16, 128, 16, 70, 20, 128, 16, 144, 236, 156, 0, 16, 4, 137, 52, 216, 154, 24, 145, 12, 3, 157, 162, 191, 34, 170, 100, 130, 0, 136, 152, 235, 155, 33, 145, 80, 161, 112, 3, 138, 20, 153, 0, 235, 10, 153, 88, 3, 40, 38, 128, 137, 152, 187, 153, 25, 19, 105, 23, 152, 33, 185, 191, 155, 152, 189, 49, 146, 9, 35, 250, 140, 0, 41, 52, 33, 20, 204, 9, 184, 73, 51, 115, 37, 128, 17, 145, 9, 33, 128, 34, 128, 86, 129, 96, 19, 16, 3, 187, 152, 207, 25, 1, 40, 68, 128, 153, 219, 171, 235, 140, 0, 219, 24, 177, 141, 129, 203, 136, 219, 154, 233, 154, 136, 155, 0, 187, 56, 248, 141, 1, 202, 25, 184, 155, 144, 139, 53, 160, 100, 145, 41, 147, 172, 51, 160, 112, 35, 48, 37, 33, 21, 152, 68, 184, 57, 148, 56, 37, 49, 37, 24, 130, 171, 67, 185, 112, 2, 40, 18, 17, 2, 185, 42, 2, 188, 154, 169, 72, 132, 12, 55, 217, 24, 208, 171, 128, 171, 51, 160, 115, 192, 13, 130, 172, 32, 185, 112, 178, 141, 35, 202, 48, 130, 56, 195, 28, 38, 170, 48, 130, 66, 130, 48, 20, 25, 67, 18, 64, 70, 144, 56, 163, 28, 39, 0, 50, 0, 17, 234, 10, 18, 138, 86, 130, 25, 128, 169, 203, 187, 24, 161, 171, 170, 56, 248, 191, 33, 169, 202, 189, 152, 186, 173, 48, 160, 57, 250, 141, 160, 140, 18, 170, 34, 250, 41, 192, 12, 20, 153, 50, 176, 57, 133, 10, 22, 169, 67, 200, 41, 176, 89, 5, 24, 21, 169, 40, 209, 140, 33, 136, 0, 8, 1, 202, 56, 177, 141, 184, 174, 200, 174, 17, 200, 40, 131, 139, 208, 174, 128, 187, 200, 243, 41, 0, 48, 147, 40, 192, 28, 178, 143, 34, 48, 20, 169, 17, 235, 41, 2, 65, 22, 16, 3, 171, 99, 160, 97, 3, 24, 3, 139, 22, 139, 69, 0, 49, 147, 154, 1, 155, 37, 9, 71, 217, 56, 192, 27, 130, 25, 130, 12, 35, 222, 56, 161, 27, 52, 192, 155, 234, 173, 0, 0, 67, 18, 51, 161, 206, 139, 200, 26, 19, 10, 67, 2, 169, 43, 23, 203, 48, 232, 26, 161, 43, 53, 128, 8, 130, 186, 220, 157, 51, 232, 41, 18, 136, 128, 50, 145, 9, 184, 219, 221, 11, 52, 218, 72, 37, 184, 154, 129, 203, 184, 157, 67, 186, 114, 130, 80, 2, 25, 161, 174, 16, 185, 73, 52, 51, 2, 66, 146, 187, 171, 49, 209, 42, 38, 34, 3, 137, 65, 35, 176, 223, 41, 146, 173, 65, 161, 56, 179, 191, 34, 201, 8, 185, 25, 251, 155, 144, 9, 160, 64, 4, 187, 205, 139, 216, 173, 17, 128, 24, 1, 1, 168, 9, 193, 207, 0, 186, 25, 32, 85, 18, 137, 34, 232, 154, 128, 81, 130, 25, 54, 201, 41, 131, 25, 20, 16, 35, 168, 24, 200, 25, 144, 113, 147, 73, 20, 169, 155, 66, 232, 156, 16, 168, 42, 20, 0, 33, 177, 207, 0, 219, 57, 2, 152, 40, 87, 184, 42, 1, 154, 137, 53, 1, 19, 171, 49, 37, 201, 113, 7, 154, 16, 18, 128, 9, 116, 146, 155, 0, 153, 33, 17, 117, 36, 144, 136, 185, 206, 9, 17, 0, 84, 35, 1, 16, 201, 171, 152, 219, 26, 52, 33, 68, 18, 33, 200, 188, 187, 138, 217, 42, 55, 144, 9, 18, 200, 171, 8, 152, 201, 174, 25, 160, 203, 112, 20, 152, 16, 168, 187, 204, 10, 168, 10, 37, 33, 37, 128, 50, 251, 187, 173, 0, 185, 114, 35, 34, 2, 169, 203, 204, 171, 32, 20, 72, 54, 144, 137, 0, 186, 12, 129, 10, 52, 160, 114, 161, 9, 2, 153, 171, 115, 161, 41, 2, 0, 250, 139, 1, 200, 41, 71, 129, 9, 35, 252, 154, 136, 25, 130, 82, 4, 25, 146, 171, 185, 154, 201, 187, 27, 53, 50, 69, 84, 129, 188, 152, 236, 138, 128, 80, 20, 8, 35, 200, 172, 152, 137, 137, 8, 68, 161, 42, 36, 184, 25, 17, 250, 140, 136, 25, 21, 137, 68, 160, 153, 219, 41, 145, 64, 19, 33, 234, 9, 216, 139, 1, 139, 65, 129, 172, 82, 208, 171, 9, 130, 207, 138, 0, 186, 88, 36, 18, 0, 128, 235, 186, 188, 137, 65, 35, 99, 20, 17, 144, 154, 187, 156, 138, 9, 115, 22, 16, 50, 36, 176, 173, 137, 169, 187, 105, 54, 1, 16, 50, 176, 203, 155, 0, 251, 10, 51, 176, 90, 38, 144, 0, 145, 202, 203, 203, 137, 136, 24, 54, 1, 49, 147, 172, 152, 252, 187, 153, 186, 26, 100, 36, 18, 1, 128, 236, 187, 137, 0, 136, 82, 19, 128, 19, 137, 115, 160, 140, 8, 250, 41, 0, 168, 190, 153, 48, 21, 66, 36, 128, 144, 205, 139, 136, 154, 64, 51, 18, 65, 52, 160, 10, 177, 223, 153, 153, 50, 33, 70, 34, 35, 192, 156, 0, 203, 138, 81, 4, 170, 99, 145, 56, 3, 154, 129, 222, 10, 0, 128, 72, 38, 1, 0, 128, 154, 203, 189, 24, 129, 48, 37, 51, 52, 33, 176, 175, 169, 204, 41, 33, 53, 34, 37, 0, 169, 156, 160, 187, 16, 68, 18, 50, 18, 0, 219, 139, 185, 26, 232, 40, 249, 59, 132, 9, 36, 144, 202, 172, 235, 156, 128, 10, 67, 152, 0, 170, 218, 159, 0, 170, 8, 137, 52, 232, 10, 1, 202, 172, 17, 136, 136, 66, 132, 153, 2, 235, 9, 217, 58, 39, 128, 49, 19, 160, 187, 33, 129, 115, 160, 121, 3, 10, 35, 9, 19, 27, 87, 144, 24, 128, 24, 250, 141, 34, 128, 64, 37, 136, 136, 188, 154, 189, 10, 49, 23, 169, 64, 130, 8, 202, 41, 226, 175, 24, 0, 32, 83, 35, 17, 192, 188, 153, 220, 10, 82, 18, 33, 35, 17, 185, 187, 188, 128, 221, 56, 36, 1, 64, 37, 161, 155, 16, 200, 186, 154, 99, 144, 138, 66, 36, 136, 65, 36, 249, 171, 168, 204, 139, 82, 35, 18, 36, 152, 170, 223, 154, 136, 24, 33, 66, 2, 9, 184, 158, 200, 138, 2, 10, 35, 185, 49, 249, 155, 8, 128, 138, 70, 168, 49, 248, 143, 153, 171, 9, 83, 19, 67, 19, 186, 251, 156, 153, 9, 50, 36, 67, 130, 41, 145, 156, 185, 11, 184, 28, 37, 81, 38, 0, 17, 152, 168, 157, 33, 201, 64, 19, 9, 34, 1, 24, 87, 144, 41, 209, 156, 168, 171, 33, 54, 17, 83, 146, 172, 184, 172, 169, 154, 49, 19, 17, 115, 21, 186, 25, 232, 173, 9, 138, 34, 32, 39, 152, 16, 219, 154, 153, 153, 0, 32, 37, 168, 8, 9, 145, 175, 48, 160, 140, 161, 175, 50, 218, 72, 130, 9, 144, 32, 194, 191, 25, 144, 139, 66, 20, 16, 19, 24, 217, 156, 204, 88, 161, 73, 21, 40, 147, 139, 3, 173, 136, 57, 21, 26, 38, 1, 18, 155, 17, 187, 32, 72, 39, 0, 33, 68, 20, 186, 72, 162, 140, 35, 81, 131, 48, 5, 40, 178, 158, 34, 146, 25, 130, 41, 39, 153, 153, 64, 147, 189, 113, 148, 172, 1, 16, 3, 186, 57, 70, 192, 157, 51, 177, 140, 33, 33, 144, 26, 55, 160, 174, 24, 145, 157, 48, 35, 152, 66, 2, 219, 189, 138, 16, 24, 68, 19, 168, 138, 176, 175, 49, 0, 65, 162, 173, 137, 153, 8, 81, 54, 129, 203, 25, 130, 189, 26, 144, 175, 40, 129, 115, 36, 137, 16, 251, 157, 128, 8, 17, 33, 19, 0, 234, 156, 0, 169, 138, 50, 130, 155, 69, 129, 169, 137, 249, 158, 0, 32, 20, 0, 32, 0, 201, 189, 48, 146, 156, 136, 49, 224, 58, 21, 9, 21, 169, 130, 1, 35, 0, 8, 168, 219, 11, 131, 170, 98, 69, 2, 136, 137, 218, 189, 153, 8, 66, 52, 17, 68, 129, 202, 219, 153, 170, 10, 8, 116, 35, 16, 17, 176, 207, 137, 168, 25, 35, 50, 53, 128, 169, 187, 175, 8, 129, 24, 82, 162, 158, 48, 2, 152, 48, 5, 237, 155, 25, 35, 185, 114, 3, 153, 154, 9, 168, 138, 186, 113, 208, 27, 23, 144, 32, 144, 202, 170, 136, 48, 68, 34, 0, 144, 219, 24, 145, 72, 39, 152, 16, 160, 137, 170, 185, 122, 38, 128, 33, 168, 155, 201, 170, 139, 146, 159, 87, 145, 8, 129, 171, 168, 155, 33, 0, 65, 19, 152, 251, 171, 202, 41, 178, 59, 55, 170, 185, 207, 154, 16, 1, 114, 3, 8, 202, 171, 205, 10, 128, 104, 37, 152, 0, 168, 170, 153, 33, 154, 98, 144, 32, 131, 171, 66, 176, 155, 218, 104, 3, 105, 22, 186, 153, 218, 153, 16, 51, 67, 37, 184, 171, 251, 139, 0, 33, 131, 64, 163, 26, 131, 174, 137, 202, 140, 34, 24, 69, 52, 18, 8, 128, 251, 140, 19, 138, 54, 128, 17, 33, 51, 137, 68, 130, 40, 249, 155, 35, 34, 100, 53, 131, 9, 176, 187, 219, 11, 83, 17, 115, 2, 9, 2, 203, 8, 184, 11, 18, 8, 100, 2, 56, 6, 168, 185, 189, 172, 9, 66, 50, 35, 18, 160, 205, 153, 201, 140, 32, 129, 40, 37, 16, 21, 203, 24, 18, 219, 57, 21, 136, 8, 85, 145, 139, 1, 171, 16, 144, 203, 40, 35, 49, 130, 82, 248, 174, 153, 64, 131, 156, 101, 145, 155, 33, 144, 169, 173, 49, 2, 0, 33, 37, 233, 155, 169, 157, 129, 171, 83, 35, 216, 10, 178, 223, 8, 144, 137, 82, 20, 152, 153, 176, 191, 9, 128, 24, 82, 51, 144, 219, 172, 153, 154, 153, 114, 131, 155, 17, 160, 171, 169, 58, 180, 239, 137, 16, 51, 52, 2, 17, 252, 139, 129, 155, 34, 51, 147, 140, 2, 153, 251, 25, 35, 152, 16, 52, 128, 48, 3, 138, 251, 140, 49, 82, 68, 1, 114, 162, 173, 16, 130, 155, 83, 160, 48, 250, 41, 163, 158, 98, 161, 138, 128, 136, 218, 42, 37, 136, 8, 17, 177, 90, 132, 156, 161, 191, 0, 200, 26, 52, 66, 3, 152, 185, 207, 154, 9, 16, 49, 19, 1, 192, 173, 137, 154, 10, 66, 0, 84, 19, 128, 204, 10, 177, 157, 98, 34, 1, 56, 55, 185, 154, 153, 136, 153, 115, 2, 136, 17, 219, 25, 177, 155, 115, 20, 24, 2, 219, 154, 203, 26, 34, 70, 19, 17, 169, 203, 203, 25, 176, 44, 52, 0, 16, 17, 17, 36, 251, 140, 176, 171, 40, 36, 49, 119, 145, 153, 128, 129, 202, 26, 18, 202, 72, 131, 154, 8, 96, 4, 235, 154, 16, 250, 140, 18, 129, 0, 0, 144, 173, 137, 171, 153, 9, 67, 177, 138, 144, 153, 187, 115, 149, 204, 137, 176, 175, 40, 249, 32, 0, 136, 17, 18, 8, 99, 2, 17, 17, 224, 156, 184, 26, 54, 51, 36, 98, 2, 16, 144, 156, 0, 24, 145, 121, 53, 34, 34, 34, 185, 156, 154, 9, 66, 99, 53, 1, 16, 2, 144, 189, 48, 147, 189, 113, 19, 137, 17, 129, 232, 172, 50, 145, 155, 49, 2, 169, 153, 186, 186, 174, 97, 162, 27, 119, 145, 9, 34, 169, 9, 129, 139, 51, 17, 119, 146, 154, 16, 2, 205, 64, 131, 11, 82, 2, 203, 24, 233, 138, 128, 32, 52, 50, 129, 98, 224, 155, 129, 186, 57, 71, 2, 56, 4, 170, 186, 173, 186, 9, 35, 115, 53, 144, 138, 202, 189, 170, 24, 51, 19, 0, 20, 184, 222, 139, 144, 137, 66, 83, 144, 155, 130, 239, 137, 0, 0, 8, 34, 129, 152, 220, 154, 128, 186, 9, 49, 3, 136, 2, 253, 172, 155, 137, 98, 3, 40, 5, 220, 169, 171, 16, 51, 37, 33, 54, 216, 155, 185, 174, 9, 34, 34, 51, 37, 144, 152, 221, 186, 187, 10, 49, 69, 67, 37, 129, 170, 186, 219, 138, 8, 114, 34, 32, 3, 153, 218, 156, 8, 154, 40, 66, 177, 12, 161, 158, 168, 140, 17, 24, 18, 128, 128, 189, 168, 239, 138, 8, 33, 128, 32, 2, 144, 188, 186, 191, 171, 80, 3, 170, 66, 177, 155, 129, 139, 69, 1, 16, 84, 19, 25, 67, 85, 130, 25, 36, 136, 33, 136, 114, 51, 51, 54, 145, 137, 83, 130, 153, 49, 19, 0, 115, 23, 168, 25, 129, 136, 169, 25, 68, 1, 66, 5, 237, 10, 144, 9, 67, 34, 66, 18, 201, 188, 169, 168, 25, 66, 51, 52, 70, 131, 154, 186, 191, 171, 136, 16, 115, 35, 68, 129, 171, 170, 186, 137, 48, 35, 82, 130, 137, 192, 139, 35, 115, 37, 0, 153, 136, 184, 191, 137, 16, 51, 82, 53, 130, 169, 190, 203, 187, 170, 9, 33, 54, 146, 170, 188, 25, 160, 141, 52, 176, 187, 155, 219, 173, 66, 18, 18, 136, 0, 202, 203, 207, 154, 169, 170, 25, 54, 184, 56, 146, 205, 170, 204, 25, 51, 33, 34, 18, 168, 219, 138, 234, 173, 153, 82, 2, 154, 128, 203, 203, 171, 25, 17, 71, 130, 137, 144, 205, 171, 136, 25, 85, 2, 82, 18, 202, 155, 187, 156, 32, 53, 18, 53, 51, 161, 190, 154, 153, 138, 97, 19, 33, 51, 152, 153, 220, 139, 136, 40, 38, 184, 80, 132, 171, 34, 249, 154, 32, 18, 145, 138, 34, 236, 138, 185, 48, 19, 52, 17, 98, 145, 172, 8, 187, 112, 38, 16, 52, 1, 24, 1, 136, 168, 65, 19, 16, 0, 53, 251, 42, 18, 99, 36, 33, 129, 187, 154, 169, 25, 18, 119, 36, 128, 33, 129, 236, 171, 24, 152, 32, 50, 35, 145, 234, 189, 153, 171, 25, 66, 35, 169, 153, 204, 154, 32, 50, 86, 37, 136, 128, 219, 137, 169, 24, 34, 51, 100, 21, 169, 187, 188, 154, 123, 0, 15, 0, 169, 25, 70, 1, 8, 168, 202, 154, 202, 57, 4, 187, 81, 4, 169, 0, 201, 156, 25, 84, 34, 17, 152, 8, 251, 11, 17, 128, 49, 5, 16, 129, 186, 222, 155, 153, 24, 50, 36, 17, 136, 185, 255, 138, 129, 155, 33, 18, 37, 145, 168, 171, 219, 139, 17, 8, 68, 129, 168, 186, 176, 207, 138, 32, 168, 64, 131, 139, 192, 188, 170, 154, 17, 49, 20, 176, 156, 144, 170, 49, 35, 17, 17, 17, 144, 153, 25, 18, 0, 16, 17, 16, 144, 16, 144, 27, 18, 1, 1, 16, 1, 153, 9, 0, 17, 145, 25, 33, 0, 16, 1, 17, 145, 16, 0, 25, 17, 2, 1, 9, 17, 145, 9, 16, 16, 144, 0, 17, 0, 9, 1, 17, 144, 16, 1, 0, 0, 0, 0, 9, 1, 0, 0, 0, 17, 145, 16, 0, 0, 144, 0, 1, 0, 0, 1, 0, 0, 16, 144, 16, 1, 9, 1, 9, 17, 9, 0, 9, 1, 0, 144, 16, 0, 0, 9, 0, 1, 144, 16, 0, 9, 16, 0, 144, 0, 1, 0, 0, 0, 144, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
-static const size_t audio_seventy_sample_data_length = sizeof(audio_seventy_sample_data) / sizeof(audio_seventy_sample_data[0]);
+static const size_t audio_seventy_sample_data_length = 27940;
@@ -1,4 +1,4 @@
-// This file was generated by a script on 20-11-2024 08:37:38
+// This file was generated by a script on 17-10-2026 14:18:59
 
 #pragma once
 
@@ -6,6 +6,7 @@
 #include <stdint.h>
 #include <pico/platform/sections.h>
 
-static const int16_t __in_flash("audio_sixty_sample_data") audio_sixty_sample_data[] = { -279, -48, 82, -420, -867, -441, 450, 826, 410, -306, -689, -434, 166, 540, 571, 631, 759, 561, -3, -450, -530, -468, -363, -4, 599, 1017, 942, 557, 109, -440, -967, -966, -353, 149, 54, -216, -263, -267, -232, 125, 456, 198, -137, 325, 1062, 810, -305, -910, -475, 128, 74, -432, -719, -490, 51, 536, 659, 397, 83, -16, -164, -598, -807, -252, 511, 603, 262, 248, 418, 185, -286, -465, -348, -113, 290, 684, 635, 176, -227, -428, -588, -618, -330, 72, 226, 140, 70, 20, -229, -640, -773, -288, 562, 1128, 1010, 384, -289, -688, -785, -685, -368, 210, 827, 1135, 1095, 840, 213, -844, -1639, -1332, -141, 909, 1252, 998, 316, -551, -1017, -670, 152, 786, 905, 501, -308, -1089, -1120, -160, 999, 1295, 634, -154, -514, -564, -441, -84, 289, 299, 2, -215, -204, -73, 67, 100, 26, 87, 301, 184, -453, -970, -801, -234, 262, 647, 793, 380, -292, -402, 167, 617, 436, 16, -87, 80, 66, -375, -896, -869, -187, 463, 431, -62, -305, -43, 335, 431, 226, -134, -562, -880, -810, -323, 254, 651, 852, 776, 286, -327, -528, -310, -117, -22, 250, 556, 467, 4, -405, -502, -272, 138, 370, 213, -23, -28, -67, -376, -487, 27, 677, 743, 379, 208, 198, -214, -1018, -1352, -572, 841, 1743, 1538, 607, -417, -1241, -1570, -995, 175, 777, 275, -387, -238, 364, 617, 466, 188, -118, -176, 251, 627, 272, -476, -780, -521, -91, 307, 432, -39, -751, -786, 33, 816, 810, 212, -430, -894, -1067, -656, 398, 1428, 1495, 399, -1025, -1722, -1324, -261, 739, 1129, 833, 316, 109, 84, -414, -1374, -1713, -641, 1114, 2138, 1832, 635, -677, -1397, -1222, -583, -196, -127, 174, 902, 1532, 1562, 1065, 261, -840, -1927, -2117, -930, 821, 1860, 1814, 1128, 137, -920, -1475, -1118, -317, 73, -54, 47, 879, 1847, 1788, 372, -1352, -2045, -1480, -513, 138, 509, 852, 1048, 801, 91, -713, -1124, -892, -192, 502, 801, 615, 116, -380, -566, -364, -48, 6, -251, -445, -148, 592, 1150, 906, -20, -780, -671, 128, 826, 842, 235, -560, -1051, -814, 176, 1167, 1153, 130, -715, -529, 77, 9, -699, -995, -312, 723, 1138, 672, -177, -812, -982, -773, -412, -76, 222, 498, 600, 354, -67, -203, 199, 810, 911, 53, -1293, -1901, -967, 868, 2045, 1709, 450, -631, -1121, -1176, -808, -24, 633, 624, 348, 617, 1188, 905, -516, -1812, -1732, -551, 511, 819, 653, 341, -115, -626, -861, -665, -188, 350, 722, 676, 219, -232, -322, -185, -153, -177, 53, 451, 485, -48, -698, -963, -735, -80, 766, 1229, 917, 196, -358, -628, -569, -104, 238, -168, -723, -316, 694, 998, 509, 164, 136, -24, -282, -550, -1142, -1685, -942, 1182, 2823, 2296, 97, -1891, -2430, -1731, -684, 238, 1108, 1696, 1275, -178, -1379, -1190, -111, 553, 428, 127, 142, 448, 747, 595, -290, -1448, -1865, -1056, 351, 1320, 1381, 760, -174, -1188, -1959, -1987, -967, 781, 2281, 2457, 1142, -456, -884, -201, 112, -719, -1610, -1102, 651, 2020, 1746, 291, -738, -510, 79, -148, -895, -987, -189, 754, 1283, 1081, -163, -1832, -2260, -790, 1051, 1558, 957, 445, 146, -610, -1547, -1413, 132, 1733, 1946, 912, -160, -591, -733, -1182, -1888, -2007, -793, 1257, 2639, 2480, 1283, -105, -1311, -1956, -1527, -222, 881, 993, 437, 85, 282, 509, 141, -516, -469, 376, 685, -420, -1735, -1441, 293, 1524, 1149, 70, -419, -293, -264, -419, -277, 127, 110, -594, -1270, -1019, 181, 1432, 1762, 1007, -119, -777, -783, -596, -518, -224, 607, 1448, 1346, 218, -929, -1184, -609, 64, 184, -273, -608, -224, 468, 674, 587, 979, 1471, 747, -1148, -2262, -1227, 755, 1473, 550, -419, -304, 279, 275, -331, -807, -710, -209, 246, 329, 154, 109, 228, 44, -660, -1258, -942, 136, 914, 741, 193, 227, 826, 1012, 164, -1145, -1772, -1260, -232, 403, 435, 352, 527, 658, 199, -844, -1766, -1820, -895, 451, 1477, 1729, 1198, 252, -564, -903, -913, -936, -812, 0, 1337, 2006, 1224, -152, -689, -339, -315, -1049, -1421, -466, 1073, 1702, 1044, -49, -844, -1194, -934, 50, 1050, 919, -286, -965, -30, 1426, 1535, 176, -1024, -1039, -540, -445, -470, 168, 1259, 1658, 791, -583, -1299, -1034, -382, 30, 164, 314, 564, 572, -40, -1019, -1349, -313, 1300, 1739, 352, -1498, -2019, -974, 481, 1412, 1677, 1193, -225, -1944, -2528, -1343, 566, 1706, 1546, 496, -578, -741, 166, 1028, 756, -184, -555, -212, -33, -294, -237, 641, 1560, 1169, -643, -2105, -1498, 435, 1269, 152, -1217, -1165, -13, 980, 1195, 657, -316, -1035, -870, -74, 492, 532, 524, 656, 431, -277, -629, -92, 427, -166, -1335, -1471, -51, 1691, 2172, 1021, -634, -1396, -1089, -629, -371, 310, 1460, 1904, 982, -266, -677, -748, -1529, -2323, -1366, 1189, 2907, 2263, 431, -802, -1159, -1147, -919, -630, -522, -134, 1211, 2654, 2111, -693, -3015, -2462, -264, 844, 553, 287, 240, 19, 368, 1346, 1011, -1252, -2714, -1205, 1500, 2301, 583, -1781, -2512, -722, 1998, 2918, 1419, -456, -1222, -1508, -1842, -1300, 539, 2207, 2160, 738, -751, -1837, -2499, -1901, 622, 3591, 4314, 2029, -1301, -3315, -3059, -898, 1870, 3446, 2767, 485, -1704, -2521, -1740, -21, 1498, 1855, 999, -185, -797, -797, -743, -837, -678, 9, 876, 1336, 1133, 509, -30, -241, -443, -960, -1359, -830, 631, 2013, 2250, 1060, -884, -2261, -2013, -446, 993, 1359, 1091, 904, 501, -752, -2240, -2355, -579, 1679, 2683, 1908, -116, -2310, -3138, -1572, 1465, 3557, 3009, 278, -2480, -3003, -877, 1719, 2119, 213, -1611, -1596, -383, 534, 805, 950, 1010, 390, -1008, -2219, -2095, -550, 1299, 2128, 1453, -48, -1155, -1120, -203, 688, 768, -22, -872, -782, 281, 1274, 1352, 677, -282, -1354, -2091, -1612, 162, 1760, 1615, 16, -1293, -1261, -300, 863, 1747, 1582, -59, -1901, -2001, -412, 887, 870, 496, 692, 996, 687, -43, -589, -743, -521, 97, 687, 353, -988, -1988, -1402, 241, 1436, 1507, 883, 132, -526, -1102, -1590, -1600, -552, 1292, 2522, 1981, 35, -1858, -2291, -736, 1734, 2893, 1591, -887, -2524, -2598, -1334, 801, 2572, 2519, 773, -1187, -2542, -3113, -2178, 457, 2947, 3179, 1427, -357, -1031, -796, -262, 67, 46, 10, 211, 343, 127, -203, -424, -645, -795, -501, 298, 1192, 1691, 1262, -520, -2979, -4016, -2065, 1654, 3928, 2933, 140, -1578, -1226, -305, -272, -566, -52, 750, 546, -319, -368, 521, 1128, 1045, 831, 301, -1183, -2749, -2438, -39, 2225, 2554, 1550, 456, -732, -2006, -2133, -655, 701, 599, 278, 1173, 2203, 1503, -546, -1928, -1696, -654, 155, 529, 735, 853, 750, 374, -280, -1239, -2178, -2221, -784, 1369, 2563, 1912, 141, -1335, -1654, -850, 301, 814, 504, 350, 1083, 1768, 857, -1392, -2721, -1496, 1128, 2398, 1188, -660, -762, 619, 988, -820, -2947, -2983, -894, 1388, 2368, 1971, 745, -751, -1773, -1524, 4, 1733, 2331, 1280, -801, -2437, -2230, -267, 1666, 2039, 1185, 266, -391, -971, -1253, -955, -138, 978, 1722, 1022, -871, -1755, -280, 1740, 1721, -157, -1579, -1266, 55, 1150, 1482, 1208, 602, -280, -1174, -1221, 25, 1371, 1038, -855, -2204, -1647, -238, 339, 168, 451, 1176, 1136, 48, -1135, -1831, -1916, -825, 1301, 2581, 1765, 369, 196, 537, 75, -543, -286, 12, -849, -2104, -1990, -228, 1705, 2314, 1314, -534, -2142, -2493, -1080, 1345, 2764, 1737, -655, -1844, -924, 586, 1284, 1358, 1105, 55, -1498, -1991, -663, 1224, 2066, 1702, 904, 14, -1192, -2434, -2393, -213, 2406, 2389, -546, -2856, -1786, 1057, 2470, 1915, 971, 328, -477, -1384, -1724, -1300, -318, 1224, 2976, 3548, 1802, -1226, -3111, -2889, -1799, -896, 359, 2282, 3297, 1687, -1643, -3745, -3005, -702, 1063, 1686, 1805, 1842, 1572, 663, -724, -1803, -1858, -1112, -186, 869, 1876, 1706, -21, -1465, -923, 509, 713, -427, -1556, -1816, -935, 813, 1941, 1034, -883, -1296, 266, 1637, 1097, -654, -1957, -2021, -772, 1523, 3437, 2822, -303, -2862, -2437, -278, 1046, 930, 158, -675, -854, 114, 1056, 297, -1475, -1791, 34, 1985, 2079, 506, -1069, -1389, -612, 268, 761, 1144, 1368, 735, -751, -1759, -1195, 284, 1154, 919, 376, 302, 513, 285, -544, -1306, -1507, -1487, -1375, -251, 2254, 4240, 3290, -203, -3200, -3585, -2076, -441, 622, 1247, 1318, 757, 210, 332, 687, 292, -894, -1873, -1738, -427, 1218, 1829, 722, -1003, -1462, -299, 930, 865, -151, -910, -836, -210, 572, 1315, 1641, 874, -992, -2505, -2009, 103, 1617, 1371, 569, 559, 758, -147, -1961, -3011, -2014, 568, 2793, 2913, 1057, -1051, -2024, -1806, -895, 345, 1469, 1990, 1764, 765, -1094, -3126, -3531, -1140, 2637, 4647, 3085, -659, -3488, -3673, -2132, -610, 591, 2228, 3968, 4132, 1950, -1112, -2991, -3171, -2421, -1104, 1046, 3490, 4422, 2443, -1671, -5287, -5859, -2714, 2331, 5890, 5342, 1049, -3759, -5651, -3648, 442, 3902, 5061, 3770, 742, -2764, -4846, -3931, -552, 2723, 3811, 2798, 880, -1092, -2510, -2763, -1785, -123, 1567, 2524, 2074, 594, -716, -1473, -2112, -2301, -1335, 185, 1154, 1615, 1737, 826, -715, -902, 543, 1261, 47, -1429, -1638, -871, 382, 1830, 2253, 638, -1898, -3297, -2962, -1477, 897, 3681, 4964, 2813, -1852, -5234, -4402, -466, 2845, 3323, 1983, 867, 419, -362, -1940, -3285, -2923, -562, 2382, 3821, 2806, 360, -1786, -2980, -3495, -3056, -903, 2549, 5174, 4687, 780, -3922, -5555, -2897, 1036, 2764, 2357, 1743, 1024, -598, -2052, -1617, 289, 1861, 2166, 1232, -606, -2348, -2720, -1636, -151, 1144, 2381, 3029, 1885, -868, -2930, -2463, -452, 861, 1010, 1116, 1433, 1065, -47, -732, -456, -90, -357, -731, -492, 105, 508, 788, 996, 479, -1017, -2188, -1542, 332, 1308, 593, -343, -209, 267, -131, -974, -957, 54, 1031, 1248, 754, -136, -1016, -1308, -518, 1158, 2409, 1615, -998, -2763, -1640, 740, 1093, -871, -2126, -805, 1321, 1756, 635, -381, -935, -1485, -1163, 1086, 3732, 3838, 955, -2453, -4086, -3427, -1175, 1267, 2599, 2734, 2166, 696, -1546, -2948, -2316, -568, 1111, 2674, 3367, 1477, -2251, -3909, -1371, 2376, 3022, 401, -1903, -1471, 486, 1517, 1025, 65, -710, -1360, -1401, -215, 1208, 930, -975, -2164, -1435, -274, -99, -162, 646, 1801, 2095, 1204, -469, -2316, -3356, -2562, 1, 2818, 4105, 3271, 1138, -1054, -2550, -2949, -1932, 160, 1888, 1878, 474, -628, -443, 348, 500, -452, -1878, -2447, -987, 2128, 4427, 3370, -471, -3470, -3066, -563, 1319, 1920, 1914, 1023, -1005, -2548, -1783, 543, 2054, 1830, 907, 114, -971, -2652, -3660, -2257, 1058, 3222, 2166, -370, -1245, -65, 1031, 906, 408, 291, 264, 48, -229, -593, -906, -281, 1752, 3546, 2505, -1426, -4901, -4876, -1989, 901, 2291, 2646, 2371, 1092, -1045, -2764, -2894, -1676, -264, 848, 2126, 3500, 3594, 1322, -2230, -4521, -4133, -1929, 473, 2396, 3599, 3273, 1221, -936, -1829, -2375, -3336, -2741, 838, 4541, 4587, 1542, -1298, -2815, -3732, -3260, -128, 3764, 4548, 1650, -1424, -2204, -1638, -641, 1310, 2912, 1410, -2140, -3160, -660, 1131, -337, -2348, -1666, 1066, 3095, 2990, 1206, -1109, -2889, -3306, -1966, 676, 3213, 4143, 3015, 634, -1697, -2917, -2627, -1289, 165, 1254, 2207, 2990, 2588, 224, -2850, -4009, -2227, 494, 1512, 665, -50, 369, 659, -307, -1287, -416, 1585, 2082, 280, -1753, -2070, -918, 431, 1150, 948, 151, -276, 96, 411, -174, -1136, -1360, -539, 721, 1655, 1894, 1552, 671, -1087, -3354, -4146, -1769, 2301, 4302, 2601, -338, -1401, -752, -602, -1233, -978, 324, 1053, 898, 871, 564, -983, -2404, -1719, 191, 1119, 766, -99, -1123, -1295, 356, 2235, 1960, 317, -357, -270, -767, -1074, -33, 1296, 1535, 920, -263, -2216, -3693, -2632, 672, 3477, 3754, 1789, -892, -2771, -3045, -1911, 64, 2555, 4686, 4532, 1055, -3621, -5555, -3163, 947, 3007, 2014, -180, -1734, -2273, -2141, -1642, -892, 458, 2710, 4767, 4441, 1012, -3414, -5796, -4740, -1129, 2865, 5048, 4334, 1313, -2165, -4084, -3351, -501, 2478, 3517, 2196, 9, -1417, -1962, -2247, -1881, 91, 2928, 4048, 2000, -1463, -3330, -2689, -1026, 300, 1194, 1645, 1389, 866, 606, -35, -1515, -2305, -913, 1361, 2157, 1208, -274, -1599, -2214, -1343, 483, 1433, 805, -269, -899, -1313, -1466, -608, 1214, 2498, 1878, -62, -1236, -501, 841, 756, -664, -1459, -789, 163, 399, 192, -85, -235, 326, 1411, 1351, -457, -1886, -1249, -160, -688, -1661, -608, 2041, 3356, 1928, -619, -2132, -2292, -1918, -1147, 401, 2068, 2376, 1136, -53, -46, 455, 457, 233, 291, 53, -1051, -2029, -1441, 336, 1604, 1873, 1910, 1321, -1100, -3980, -3736, 137, 3523, 3235, 969, -206, -234, -723, -1639, -1602, -294, 1174, 1823, 1601, 834, -257, -1382, -2108, -2235, -1790, -600, 1415, 3282, 3231, 720, -2390, -3594, -2381, -307, 1086, 1457, 1216, 1050, 1526, 2216, 1702, -526, -2698, -2467, 166, 2646, 2743, 869, -883, -1407, -1391, -1626, -1649, -724, 591, 903, -52, -771, 46, 1482, 1483, -213, -1662, -1345, 258, 1771, 2045, 542, -1696, -2274, -509, 1150, 746, -175, 500, 1727, 1119, -1210, -2854, -2181, 12, 1435, 843, -265, 237, 1462, 629, -1991, -2808, -303, 2793, 3487, 1725, -669, -1906, -1326, -13, 616, 960, 1830, 1822, -490, -2967, -2584, -353, 536, 39, 509, 1798, 1348, -1060, -2505, -1534, -152, 57, 354, 1503, 1691, 177, -711, 311, 1222, 688, 302, 820, 280, -1981, -3162, -1275, 1283, 1186, -865, -1641, -531, 218, -91, 302, 1750, 1917, -374, -2832, -2685, -162, 2294, 2986, 1944, -115, -2311, -3250, -1798, 1242, 3368, 3003, 1103, -429, -1063, -1566, -2092, -1628, 129, 1456, 738, -742, -467, 1191, 1420, -418, -1866, -1391, -109, 869, 1655, 1829, 464, -1499, -1649, 276, 1567, 503, -1095, -965, 61, 9, -502, 442, 2083, 1642, -1137, -3176, -2308, 146, 1963, 2767, 2775, 1129, -2233, -4663, -3444, 501, 3650, 3918, 2002, -452, -2340, -3118, -2564, -801, 1561, 3349, 3338, 1294, -1568, -3337, -2758, -279, 2063, 2371, 843, -545, -530, 89, -18, -818, -1375, -1477, -1466, -923, 726, 2260, 1557, -871, -1672, 682, 3301, 2680, -730, -3468, -3215, -547, 2372, 3494, 1933, -1290, -3690, -3480, -1361, 599, 1410, 1457, 1051, 281, -257, -96, 221, 22, -468, -849, -1158, -1114, -74, 1539, 2113, 1031, -200, -177, 165, -810, -2436, -2505, -715, 1023, 1702, 2176, 2721, 2030, -419, -2811, -3052, -1338, 526, 1475, 1587, 1137, 703, 928, 917, -1011, -3714, -3665, -481, 2056, 1968, 1536, 2396, 2761, 944, -2116, -4602, -5151, -2739, 1908, 5321, 4422, 542, -1997, -1411, -261, -1077, -2509, -1677, 1285, 3460, 3122, 1277, -483, -1652, -2131, -1603, -297, 709, 794, 645, 1010, 1318, 556, -974, -1805, -1101, 239, 512, -645, -1444, -250, 1706, 1687, -553, -2231, -1482, 273, 878, 536, 617, 727, -425, -1940, -1761, -367, 341, 840, 2141, 2114, -859, -3393, -2161, 321, 813, 1160, 3191, 3572, -332, -4698, -4520, -604, 2598, 2952, 1663, 407, -458, -1396, -2358, -2375, -702, 1830, 3215, 2329, 241, -991, -731, -199, -403, -743, -324, 380, 330, -255, -259, 292, 112, -979, -1300, 58, 1437, 899, -904, -1545, 259, 3116, 3950, 1147, -2912, -4268, -2423, -7, 1929, 3759, 3771, 645, -2267, -1536, -13, -1820, -4133, -1455, 4448, 6401, 2410, -2153, -3039, -2019, -1966, -2075, -668, 1191, 2099, 2861, 3652, 2185, -2189, -5899, -5394, -1314, 3296, 6181, 5977, 2038, -3823, -7241, -5222, 252, 4161, 3868, 1187, -745, -905, -433, -731, -1933, -2698, -1631, 832, 2676, 2717, 1791, 1078, 337, -1218, -3001, -3306, -1471, 1194, 2844, 2689, 1031, -1333, -3185, -3167, -1033, 1700, 3267, 3439, 2605, 243, -3478, -5749, -3968, 279, 3214, 3687, 2956, 1386, -1201, -3351, -3223, -1079, 1313, 2573, 1966, -524, -3144, -3074, 137, 3118, 2677, 71, -1315, -1200, -1659, -2239, -512, 2722, 3494, 609, -2403, -2198, 419, 2298, 1807, 49, -1000, -785, -226, 35, 158, 20, -550, -582, 717, 1825, 853, -989, -1142, -24, -8, -872, -229, 1904, 2699, 917, -1280, -1613, -526, 258, 441, 930, 1613, 1198, -407, -1337, -458, 670, 121, -1325, -1416, -9, 842, 251, -315, 236, 723, -285, -1989, -2435, -1221, 463, 1826, 2739, 2521, 454, -2457, -3907, -2741, -67, 2081, 2628, 2068, 1382, 517, -1231, -3261, -3565, -1464, 950, 1500, 932, 1363, 2355, 1276, -2063, -4176, -2682, 452, 2289, 2773, 2907, 1744, -1522, -4233, -2913, 1121, 2872, 828, -1343, -1290, -960, -1396, -417, 2204, 3170, 1454, 46, 264, -173, -2175, -3248, -1628, 1080, 2253, 1219, -433, -621, 1028, 2521, 1699, -812, -1987, -487, 1125, 243, -1220, 416, 4187, 5142, 1344, -3835, -6488, -5619, -2151, 2166, 4949, 4730, 2389, -143, -1936, -3106, -3670, -3186, -1296, 1645, 4260, 4658, 2124, -1425, -2898, -1765, -880, -2205, -3556, -1797, 2314, 5157, 5108, 3542, 1525, -1485, -5038, -6546, -4318, 105, 4072, 6303, 6003, 2341, -3147, -6338, -5027, -1525, 791, 1350, 1675, 2806, 4258, 4305, 1327, -3816, -7326, -5910, -605, 4029, 4609, 2023, -340, -715, -451, -1376, -2903, -2884, -573, 2666, 4874, 4320, 384, -4499, -5873, -2645, 992, 1376, 58, 203, 1667, 2257, 1191, -671, -2040, -1870, -331, 1196, 2054, 2769, 2853, 649, -3231, -4954, -2207, 2004, 3067, 1065, 70, 1466, 1999, -553, -3636, -3740, -937, 2096, 3337, 2308, -194, -2154, -1778, 1, 263, -1511, -2134, 110, 2050, 783, -1108, -11, 2382, 2257, 9, -1564, -2312, -3254, -2837, 809, 5520, 6734, 3070, -2224, -5218, -4737, -1937, 1298, 3029, 2454, 1054, 745, 1128, 602, -729, -1619, -1728, -1086, 514, 2062, 1744, -78, -1111, -859, -1081, -2132, -1976, 402, 3022, 3350, 1231, -1407, -2766, -2331, -644, 1076, 1610, 884, 1, -421, -951, -1863, -2224, -1244, 574, 2191, 2963, 2389, 175, -2547, -3293, -1101, 1571, 1928, 744, 538, 1217, 1003, 105, -210, -383, -1009, -1064, -451, -868, -1891, -455, 3568, 5722, 3011, -2104, -5346, -5229, -3008, -344, 1973, 3731, 4162, 2146, -1550, -3999, -3606, -1766, 237, 2554, 3962, 2447, -307, -434, 1311, 367, -3421, -4881, -1738, 2114, 2788, 1099, -192, -436, -916, -2370, -3715, -3016, 303, 4263, 5721, 3385, -549, -2211, -304, 1739, -190, -4450, -4738, 790, 5937, 5138, 1166, -234, 778, -27, -3159, -4882, -3232, -20, 2724, 4399, 3891, 109, -4555, -5378, -1608, 2131, 2378, 769, -137, -748, -1964, -2357, -283, 3224, 5395, 4536, 1149, -2753, -4856, -4064, -1751, -621, -1365, -1510, 1125, 5050, 6730, 4510, -349, -5158, -7163, -5025, -351, 3278, 3829, 2631, 2202, 2795, 1877, -2139, -6102, -4810, 1299, 4982, 1767, -3304, -2987, 1752, 4043, 1411, -1908, -2093, -241, 748, 192, -791, -1391, -1383, -702, 88, 57, -525, -228, 1066, 1416, -97, -1247, 108, 2020, 1054, -1740, -1840, 1396, 3382, 1446, -1647, -2525, -1062, 1109, 2106, 448, -2617, -3497, -1303, 903, 1514, 2309, 3609, 2771, -746, -3449, -2677, 7, 1670, 1605, 863, 154, -262, 65, 961, 1104, -198, -1803, -2579, -2677, -1850, 802, 3949, 4111, 460, -3332, -3756, -1527, 355, 613, 479, 1537, 3460, 4016, 1690, -2013, -3959, -2909, -524, 984, 1044, 677, 1051, 1936, 1622, -801, -3602, -4329, -2851, -782, 985, 2239, 2429, 1663, 1036, 509, -1307, -3991, -4580, -1621, 2329, 3796, 2289, -179, -1911, -2314, -1184, 841, 1832, 697, -791, -330, 1116, 575, -2094, -3457, -1201, 2679, 4361, 2420, -1250, -3665, -3050, 116, 3341, 3903, 1382, -1838, -3138, -2231, -535, 1117, 2633, 3009, 996, -2096, -3056, -1285, 368, 433, 692, 1904, 1975, 25, -1791, -1908, -1071, 135, 1930, 3242, 2194, -954, -3714, -4335, -3147, -1047, 1557, 3861, 4155, 1524, -2286, -4048, -2470, 451, 2057, 1939, 1331, 841, 251, -340, -597, -357, 630, 1911, 1408, -1920, -4848, -3101, 2065, 4769, 2574, -551, -605, 1036, 899, -1067, -2488, -2799, -2672, -1132, 2377, 4708, 2687, -1359, -2485, -155, 1865, 1249, -807, -2097, -1570, 140, 1312, 1111, 545, 345, -720, -3403, -5203, -2843, 2659, 5995, 3663, -1558, -3937, -1816, 969, 933, -430, 264, 2626, 2997, 139, -2659, -2164, 386, 1330, -253, -1887, -1675, -160, 1537, 2428, 1217, -1480, -2248, 14, 1364, -505, -1722, 599, 2628, 779, -1769, -862, 1881, 2587, 746, -1774, -3504, -3328, -846, 2070, 2686, 1074, 179, 1434, 2480, 798, -2180, -3043, -1549, -764, -1806, -1855, 910, 3696, 3386, 1495, 891, 467, -2064, -4666, -3531, 793, 4301, 4667, 2348, -1115, -3585, -3488, -1830, -825, -366, 1441, 4224, 4849, 1835, -2152, -3721, -2807, -1402, -131, 1355, 2267, 1777, 688, -200, -1271, -2033, -913, 1521, 2433, 909, -899, -1364, -1028, -514, 329, 1075, 942, 516, 1081, 1990, 831, -2815, -5516, -3692, 1522, 5286, 4993, 2686, 696, -1788, -5235, -6401, -2776, 2219, 3368, 1037, -264, 1019, 2304, 1621, -190, -1483, -1495, -425, 643, 445, -731, -735, 1685, 4385, 3975, 292, -3407, -4636, -3715, -1766, 718, 3093, 4396, 4112, 2130, -1248, -4461, -5227, -2920, 587, 3063, 3796, 2853, 215, -2744, -2838, 792, 3702, 1441, -3525, -5079, -2181, 1006, 2159, 2227, 1252, -1483, -3842, -2528, 1592, 4113, 3353, 1971, 1557, 61, -3289, -5092, -2979, 277, 1348, 1255, 2278, 3413, 2419, -251, -2621, -4207, -5178, -4272, -648, 3276, 4226, 2751, 2086, 2713, 1998, -758, -3001, -3171, -2444, -1467, 934, 4312, 5222, 1759, -2861, -4117, -2016, -123, 125, 539, 1738, 1552, -792, -2447, -1467, -329, -1391, -1940, 1515, 6575, 7569, 2871, -4249, -9337, -8772, -2091, 5827, 8997, 6832, 2452, -2743, -7516, -8139, -3424, 1749, 2945, 1633, 886, 978, 1391, 2091, 1981, 375, -1010, -1003, -1150, -2055, -1589, 732, 2117, 1188, 16, 262, 967, 605, -1212, -3426, -3673, -755, 2700, 3002, 553, -1228, -1232, -1010, -1004, -362, 381, 59, -490, 274, 1249, -10, -2547, -2158, 2324, 6129, 4445, -1083, -4748, -4048, -1402, 496, 1586, 2398, 2150, 287, -1918, -2720, -1643, 739, 3237, 3816, 1090, -2999, -4197, -1127, 2401, 2363, 72, -329, 1345, 1573, -343, -1348, -446, 32, -902, -1964, -2397, -1451, 1998, 5462, 3529, -3558, -8062, -5090, 1376, 5306, 5297, 2893, -319, -2887, -4298, -5055, -4209, 241, 6797, 10048, 6928, 343, -4849, -6760, -6222, -4177, -1056, 2245, 4230, 4002, 2241, 382, -1098, -2686, -4018, -3575, -809, 2796, 5390, 6001, 4044, -263, -4612, -5917, -3407, 901, 4282, 4727, 1816, -2201, -3767, -1965, 521, 1394, 1422, 1758, 1032, -2254, -5866, -5445, -302, 4765, 4902, 995, -2022, -1886, -814, -480, 474, 2329, 2596, 818, -109, 316, -1057, -4517, -5846, -2822, 2131, 5976, 6824, 3442, -2415, -6010, -5488, -3770, -2514, 215, 4395, 6075, 3108, -1710, -4467, -3871, -1013, 2125, 4085, 4919, 5144, 4018, 712, -3229, -4851, -3123, 313, 3305, 4655, 3896, 1071, -2888, -5923, -5547, -1054, 4549, 6348, 2677, -2501, -3984, -1438, 764, -291, -2453, -2154, 556, 2815, 3223, 2673, 1775, -40, -2997, -5971, -6811, -3828, 1760, 5843, 5814, 3317, 851, -1313, -2913, -2494, -513, 650, 768, 1227, 1025, -1280, -3213, -1786, 870, 855, -1045, -1366, 39, 632, -59, -161, 1003, 2007, 1748, 630, -806, -2528, -3819, -3398, -1360, 651, 1662, 2003, 1743, 458, -1409, -2654, -2725, -1782, 224, 3026, 4891, 3817, 267, -2962, -4086, -3600, -1924, 1259, 4534, 5034, 2607, 406, -48, -1009, -3800, -5392, -2811, 1605, 3377, 2541, 2351, 2657, 561, -3018, -3944, -1893, -420, -244, 1335, 4410, 5493, 2977, -665, -2505, -1991, 17, 2666, 4689, 4139, 151, -5168, -7927, -6035, -1033, 3645, 5580, 4612, 1968, -1207, -3946, -4627, -1903, 2966, 6478, 6221, 2405, -3356, -8247, -8377, -2424, 5390, 9100, 6932, 1313, -4633, -8115, -7068, -2472, 1709, 2838, 2081, 1655, 1691, 933, -917, -2743, -3314, -2301, -310, 1511, 2353, 2661, 3197, 2904, 38, -3915, -4790, -1535, 2207, 3486, 2937, 1393, -1703, -5081, -5337, -1760, 2008, 2971, 2317, 1885, 318, -3686, -6823, -4647, 1497, 5778, 5521, 3115, 997, -749, -1995, -1630, 352, 2092, 1772, -206, -1274, 190, 1967, 492, -3484, -5065, -2000, 2293, 3873, 2938, 1721, 772, -778, -3078, -4958, -4729, -1503, 3493, 7243, 7363, 4073, -387, -3772, -5095, -4560, -2768, -190, 2481, 3948, 3260, 1100, -825, -1728, -2067, -2319, -2528, -2461, -1384, 1051, 3190, 2855, 671, -825, -824, 80, 1806, 2897, 401, -4478, -5689, -1314, 2824, 2244, -268, -1092, -1042, -1241, -229, 2034, 2533, -174, -3481, -4428, -3203, -1676, -229, 2241, 5440, 6532, 3395, -1918, -5142, -4751, -2558, -55, 2515, 4023, 3241, 1450, 702, 330, -1282, -2891, -2058, 647, 2372, 1879, 244, -1221, -1641, -139, 3052, 5437, 4463, 834, -2546, -4444, -5059, -3090, 2339, 7438, 6831, 895, -4648, -5992, -3928, -515, 2575, 3349, 996, -2139, -2885, -1252, 63, -30, 368, 2557, 4338, 2796, -1102, -3399, -2757, -2001, -2746, -2108, 2358, 7609, 8601, 4433, -1885, -6917, -7950, -4366, 458, 2301, 1307, 362, 57, -425, -443, 100, -210, -817, 53, 628, -1731, -4108, -2063, 2127, 3260, 1962, 1860, 1904, -924, -4684, -4818, -1201, 2068, 2448, 1123, 147, -46, -59, -118, 42, 716, 1970, 3037, 2182, -1325, -5390, -6807, -4479, 174, 4912, 7580, 6817, 3336, -449, -2874, -4035, -3970, -1624, 2936, 6637, 5946, 1125, -3967, -6079, -4692, -773, 3815, 6074, 4048, -558, -4102, -5077, -4413, -2372, 1797, 6609, 7996, 4216, -1220, -3841, -3289, -1805, -257, 1439, 2268, 1332, -594, -2370, -3343, -2305, 1500, 5554, 5321, -253, -6554, -8060, -4296, 225, 1760, 1439, 2439, 4356, 3287, -2052, -7149, -6715, -1325, 3376, 3733, 1742, 1032, 1962, 2527, 1642, -635, -3656, -5047, -2344, 2465, 4000, 765, -2935, -3502, -1928, -452, 314, 431, 251, 857, 2565, 3879, 3524, 2038, 298, -1703, -3475, -3318, -744, 1812, 1933, 809, 1046, 1920, 580, -2711, -4793, -4542, -3344, -1436, 1815, 4642, 4156, 766, -2013, -2206, -1148, -542, -223, 401, 843, 797, 1184, 2288, 2247, -545, -4339, -5287, -1904, 3100, 5749, 4627, 1536, -760, -1118, -1021, -2669, -5123, -4405, 339, 3838, 1861, -2016, -1937, 1398, 3132, 2310, 1827, 2554, 2528, 719, -1829, -3776, -4307, -2982, -214, 2333, 2819, 914, -1835, -3427, -2963, -987, 1087, 1990, 1561, 557, -615, -1969, -2549, -856, 2481, 4336, 2626, -1120, -3547, -2739, 529, 3765, 4852, 3627, 1212, -1487, -3377, -2814, -87, 1649, 702, -395, 410, 619, -2418, -6312, -6774, -3265, 1507, 5143, 6309, 4360, 273, -3345, -4264, -2221, 1242, 4006, 4957, 4629, 3817, 2146, -1003, -4823, -7496, -7747, -5251, -613, 4216, 6647, 5557, 2065, -1864, -4572, -4701, -1795, 2600, 5634, 5621, 3368, 836, -907, -2058, -2886, -2988, -1974, -375, 680, 683, 188, 19, 390, 827, 613, -514, -1707, -1462, 605, 2887, 3394, 1765, -784, -2613, -2538, -696, 1372, 2566, 3489, 4618, 4648, 2453, -874, -3709, -5774, -6849, -5785, -2360, 1726, 4741, 6061, 5179, 1698, -3148, -6557, -6486, -3436, 89, 2048, 2992, 4819, 7044, 6597, 2466, -2271, -4661, -5039, -4423, -2336, 849, 2773, 2135, 314, -1130, -2059, -2352, -1299, 819, 2318, 2031, 678, -279, -448, -486, -794, -1026, -805, -172, 608, 1147, 1028, 244, -682, -1259, -1307, -726, 430, 1590, 1863, 677, -1692, -3825, -3790, -1188, 1733, 2255, 70, -2945, -4716, -3736, 297, 5038, 6600, 3745, -590, -2875, -2309, -261, 1490, 1571, -138, -2242, -3381, -3467, -2818, -1403, 406, 1637, 1641, 364, -1785, -3438, -2978, -691, 1464, 2706, 3773, 4297, 2839, -79, -2041, -2173, -1856, -1727, -625, 1825, 3772, 3380, 1139, -1126, -2440, -2719, -1839, -128, 1183, 1419, 1375, 1623, 1281, -257, -1819, -2039, -1266, -657, -266, 716, 2336, 3603, 3871, 3632, 3538, 3318, 2332, 819, -270, -620, -881, -1479, -1901, -1555, -742, -210, -182, -267, -102, 201, 174, -475, -1316, -1417, -403, 899, 1275, 487, -411, -180, 1244, 2510, 2053, -323, -3117, -4426, -3537, -1289, 868, 2057, 2310, 2028, 1301, -128, -2245, -4249, -4936, -3779, -1556, 328, 1066, 804, 96, -578, -862, -610, 19, 726, 1207, 1113, 323, -629, -880, -249, 473, 469, -190, -784, -797, -349, 49, -105, -1042, -2494, -3703, -3908, -2950, -1269, 603, 2302, 3482, 3691, 2523, 77, -2579, -3798, -2808, -501, 1690, 3224, 4173, 4234, 2943, 540, -1996, -3571, -3542, -2240, -893, -411, -363, 152, 891, 641, -898, -2314, -2009, -93, 1821, 2453, 1992, 1479, 1562, 2004, 2075, 1321, 84, -729, -545, 212, 546, -16, -981, -1564, -1511, -1022, -269, 722, 1936, 3150, 3692, 2716, 305, -2170, -3452, -3531, -2892, -1599, 164, 1692, 2617, 3255, 3676, 3350, 2099, 523, -630, -890, -25, 1598, 2751, 2314, 691, -486, -398, -41, -609, -1579, -1417, 114, 1506, 1481, 487, -206, -160, 129, 326, 655, 1121, 1057, -14, -1437, -1966, -1096, 669, 2559, 3847, 3813, 2273, 30, -1866, -2928, -2887, -1455, 867, 2646, 2925, 2107, 1000, -229, -1806, -3543, -4507, -3531, -580, 2594, 4106, 3960, 3247, 2020, -156, -2175, -2090, 161, 2543, 3372, 2663, 1199, -640, -2912, -5323, -6666, -5693, -2858, -141, 1328, 2182, 2866, 2611, 1065, -707, -1641, -1755, -1409, -718, 48, 524, 670, 458, -521, -2340, -4007, -4284, -3104, -1499, -172, 1059, 2216, 2474, 1207, -906, -2484, -2796, -2140, -1306, -904, -913, -856, -654, -864, -1687, -2349, -1966, -533, 1229, 2510, 2801, 2214, 1383, 723, 151, -267, -187, 143, -147, -1197, -1939, -1568, -701, -413, -683, -527, 555, 1916, 2656, 2629, 2318, 2050, 1711, 1121, 466, 265, 793, 1567, 1667, 748, -546, -1365, -1525, -1346, -941, -153, 851, 1453, 1262, 618, 183, 200, 387, 367, -1, -668, -1392, -1736, -1472, -1018, -936, -1028, -655, 91, 562, 697, 864, 781, -61, -1320, -2328, -3084, -3708, -3812, -3253, -2550, -2029, -1613, -1534, -2014, -2421, -1978, -982, -252, 107, 393, 394, -230, -1050, -1281, -969, -1012, -1906, -3093, -3798, -3963, -4013, -4143, -4257, -4310, -4304, -4155, -3840, -3517, -3316, -3140, -2862, -2591, -2567, -2841, -3256, -3632, -3783, -3486, -2705, -1788, -1182, -1061, -1399, -2113, -2926, -3324, -2972, -2129, -1458, -1434, -1968, -2513, -2536, -1952, -1180, -734, -701, -642, -104, 802, 1496, 1616, 1502, 1838, 2862, 4024, 4511, 4139, 3506, 3164, 3041, 2938, 3034, 3457, 3887, 4050, 4117, 4212, 4148, 3934, 3964, 4396, 4919, 5257, 5504, 5868, 6478, 7349, 8268, 8796, 8726, 8472, 8642, 9246, 9701, 9709, 9685, 10062, 10573, 10629, 10112, 9425, 8956, 8826, 8995, 9296, 9435, 9235, 8889, 8788, 9008, 9244, 9273, 9284, 9622, 10346, 11175, 11742, 11807, 11351, 10614, 9984, 9722, 9783, 9954, 10091, 10133, 10012, 9755, 9566, 9597, 9739, 9729, 9444, 8949, 8398, 7944, 7604, 7225, 6721, 6326, 6383, 6853, 7243, 7117, 6561, 5994, 5679, 5536, 5417, 5318, 5254, 5092, 4687, 4136, 3662, 3297, 2856, 2201, 1349, 355, -680, -1507, -1889, -1909, -1951, -2299, -2885, -3434, -3748, -3808, -3748, -3782, -4046, -4399, -4578, -4606, -4858, -5547, -6362, -6810, -6772, -6568, -6596, -7028, -7747, -8489, -9059, -9429, -9696, -9929, -10115, -10222, -10246, -10224, -10250, -10471, -10896, -11261, -11237, -10892, -10664, -10795, -11000, -10845, -10312, -9748, -9418, -9267, -9138, -8961, -8750, -8583, -8644, -9132, -9983, -10829, -11251, -11034, -10295, -9463, -9050, -9205, -9609, -9902, -10070, -10289, -10540, -10590, -10322, -9850, -9308, -8698, -8051, -7561, -7400, -7493, -7560, -7335, -6781, -6203, -6043, -6366, -6748, -6825, -6696, -6618, -6625, -6655, -6778, -7120, -7748, -8607, -9408, -9759, -9607, -9350, -9241, -9041, -8487, -7787, -7333, -7088, -6647, -5833, -5005, -4624, -4663, -4643, -4283, -3877, -3919, -4421, -4876, -4919, -4816, -5095, -5800, -6468, -6789, -6924, -7079, -7192, -7212, -7274, -7451, -7611, -7554, -7168, -6514, -5922, -5708, -5715, -5444, -4720, -3882, -3276, -2939, -2766, -2656, -2542, -2528, -2825, -3379, -3818, -3950, -4038, -4337, -4591, -4365, -3740, -3301, -3382, -3655, -3652, -3409, -3325, -3533, -3776, -3844, -3942, -4435, -5385, -6488, -7584, -9043, -11394, -14505, -17337, -18831, -18913, -18194, -16648, -13424, -8415, -3185, 405, 2081, 3026, 4265, 5598, 5969, 4807, 3013, 2080, 2267, 2509, 2416, 2935, 4483, 5778, 5508, 4148, 3307, 3823, 5094, 6051, 6452, 7195, 9289, 12538, 15720, 17928, 19308, 20402, 21347, 21917, 22062, 22192, 22872, 24295, 25988, 27255, 27897, 28337, 28945, 29516, 29446, 28433, 26784, 25151, 23944, 23137, 22546, 22189, 22311, 23037, 24185, 25432, 26576, 27546, 28277, 28681, 28841, 28957, 29091, 29071, 28737, 28177, 27580, 26906, 25786, 23874, 21425, 19227, 17654, 16078, 13855, 11530, 10142, 9740, 9465, 8923, 8457, 8258, 8032, 7528, 6820, 6067, 5310, 4438, 3300, 1954, 755, 2, -375, -659, -1018, -1520, -2325, -3584, -5130, -6560, -7725, -8932, -10525, -12353, -13884, -14737, -14958, -14950, -15134, -15537, -15754, -15451, -14822, -14320, -14122, -14090, -14039, -13796, -13212, -12404, -11812, -11818, -12331, -12918, -13265, -13442, -13695, -14114, -14523, -14715, -14648, -14380, -13915, -13203, -12294, -11332, -10467, -9723, -9005, -8215, -7369, -6581, -5907, -5230, -4434, -3605, -2940, -2419, -1773, -912, -224, -137, -514, -780, -639, -310, -131, -222, -495, -684, -494, 47, 545, 723, 748, 921, 1279, 1648, 1904, 2059, 2196, 2342, 2429, 2406, 2336, 2258, 1987, 1296, 359, -265, -263, -33, -240, -975, -1697, -1978, -1978, -2047, -2260, -2535, -2944, -3625, -4502, -5304, -5879, -6319, -6783, -7318, -7856, -8300, -8583, -8779, -9048, -9376, -9493, -9260, -8935, -8899, -9209, -9615, -9920, -10138, -10404, -10826, -11433, -12166, -12869, -13398, -13706, -13826, -13726, -13302, -12535, -11608, -10817, -10375, -10285, -10354, -10394, -10382, -10399, -10445, -10470, -10495, -10524, -10381, -9875, -9118, -8418, -7939, -7587, -7245, -6921, -6642, -6350, -5984, -5564, -5130, -4646, -4059, -3403, -2775, -2283, -2043, -2102, -2315, -2411, -2256, -1978, -1787, -1722, -1613, -1278, -688, 26, 698, 1224, 1538, 1555, 1238, 693, 153, -161, -164, 53, 303, 477, 663, 1023, 1541, 1995, 2135, 1854, 1221, 450, -242, -803, -1314, -1770, -1993, -1828, -1345, -766, -249, 153, 392, 402, 206, -87, -412, -758, -1080, -1304, -1457, -1625, -1806, -1920, -1994, -2201, -2637, -3191, -3696, -4121, -4472, -4635, -4507, -4171, -3792, -3426, -3101, -2942, -3048, -3395, -3961, -4748, -5647, -6446, -6971, -7118, -6880, -6438, -6074, -5852, -5577, -5129, -4639, -4281, -4120, -4165, -4381, -4646, -4867, -5117, -5507, -5968, -6260, -6211, -5847, -5304, -4707, -4118, -3521, -2833, -1966, -1013, -278, -37, -223, -465, -484, -315, -102, 77, 134, -42, -348, -512, -481, -452, -516, -587, -647, -713, -627, -256, 178, 329, 242, 325, 717, 1022, 819, 147, -744, -1840, -3216, -4684, -5861, -6415, -6091, -4768, -2633, 14, 3153, 6907, 11043, 15000, 18265, 20547, 21763, 22042, 21660, 20823, 19768, 18929, 18570, 18467, 18239, 17875, 17580, 17417, 17370, 17510, 17887, 18461, 19339, 20758, 22721, 24921, 27004, 28779, 30194, 31226, 31885, 32188, 32179, 31982, 31735, 31540, 31368, 31197, 31080, 31067, 31080, 30937, 30555, 29935, 29076, 28018, 26879, 25668, 24330, 23129, 22519, 22503, 22598, 22656, 23043, 23857, 24597, 24840, 24667, 24300, 23676, 22572, 20901, 18881, 16955, 15353, 13810, 11965, 9884, 7853, 5849, 3635, 1254, -963, -2816, -4374, -5696, -6694, -7270, -7396, -7046, -6269, -5400, -4919, -4942, -5214, -5638, -6494, -7914, -9567, -11012, -12127, -13041, -13920, -14799, -15513, -15815, -15754, -15765, -16208, -16952, -17521, -17618, -17368, -17094, -16870, -16408, -15414, -14020, -12655, -11570, -10666, -9776, -8939, -8304, -7914, -7662, -7396, -7048, -6669, -6323, -5964, -5503, -5005, -4673, -4591, -4596, -4466, -4150, -3738, -3254, -2610, -1734, -657, 589, 2054, 3730, 5380, 6677, 7544, 8214, 8890, 9445, 9565, 9120, 8330, 7588, 7120, 6784, 6251, 5424, 4585, 4072, 3937, 3995, 4048, 3966, 3667, 3198, 2763, 2546, 2506, 2411, 2124, 1713, 1357, 1117, 872, 377, -585, -2000, -3558, -4944, -6118, -7293, -8624, -10038, -11365, -12495, -13396, -14081, -14662, -15389, -16433, -17724, -19009, -20028, -20628, -20831, -20853, -20912, -20987, -20915, -20701, -20535, -20521, -20617, -20813, -21219, -21898, -22733, -23471, -23916, -24037, -23910, -23592, -23077, -22377, -21582, -20784, -19928, -18877, -17621, -16356, -15231, -14127, -12825, -11336, -9894, -8661, -7622, -6751, -6084, -5611, -5189, -4740, -4400, -4320, -4361, -4139, -3420, -2373, -1354, -547, 142, 882, 1686, 2456, 3147, 3830, 4586, 5345, 5927, 6249, 6457, 6758, 7142, 7388, 7332, 7023, 6621, 6217, 5803, 5348, 4859, 4410, 4074, 3840, 3620, 3357, 3084, 2842, 2595, 2267, 1848, 1385, 902, 391, -90, -471, -782, -1113, -1473, -1787, -2054, -2377, -2877, -3632, -4611, -5650, -6602, -7476, -8347, -9151, -9742, -10096, -10275, -10281, -10081, -9767, -9508, -9379, -9325, -9313, -9406, -9650, -9971, -10295, -10626, -10993, -11370, -11716, -12029, -12299, -12522, -12741, -12932, -12955, -12702, -12204, -11522, -10663, -9708, -8785, -7889, -6943, -6064, -5456, -5104, -4819, -4534, -4281, -4018, -3632, -3029, -2166, -1142, -267, 198, 360, 482, 591, 539, 379, 392, 687, 1081, 1495, 2194, 3406, 4888, 6185, 7193, 8187, 9327, 10401, 11076, 11261, 11219, 11297, 11579, 11822, 11860, 11896, 12204, 12578, 12444, 11734, 11153, 11226, 11442, 10995, 10005, 9284, 9087, 8922, 8513, 8221, 8203, 7847, 6599, 4751, 2774, 408, -2770, -6433, -9791, -12010, -11950, -8944, -4245, 66, 3849, 8556, 14324, 19677, 23516, 25257, 24037, 19967, 14979, 10828, 7683, 5385, 4050, 3092, 1916, 1399, 2633, 4826, 6437, 7292, 7962, 8385, 8672, 9973, 13162, 17477, 21415, 24398, 26774, 28704, 29858, 30067, 29637, 28791, 27521, 25986, 24456, 23127, 22458, 23014, 24306, 25023, 24912, 24885, 24911, 23878, 21709, 19525, 17721, 15997, 14853, 14957, 15794, 16616, 17948, 20547, 23697, 25957, 26974, 27369, 27243, 26065, 23877, 21305, 18323, 14515, 10674, 8133, 6565, 4396, 1441, -1060, -2678, -3992, -5108, -5746, -6215, -6735, -6657, -5423, -3476, -1533, 174, 1490, 1969, 1381, -20, -1958, -4479, -7526, -10542, -12955, -14777, -16320, -17599, -18489, -19105, -19476, -19301, -18576, -17925, -17804, -17804, -17246, -16073, -14771, -13647, -12581, -11383, -10111, -9000, -8206, -7723, -7429, -7232, -7189, -7412, -7791, -8069, -8262, -8661, -9217, -9360, -8728, -7737, -7047, -6772, -6505, -5967, -5279, -4630, -3958, -3031, -1706, 2, 2000, 4166, 6380, 8488, 10201, 11156, 11221, 10638, 9695, 8360, 6465, 4218, 2264, 1112, 660, 440, 211, 162, 545, 1330, 2210, 2882, 3271, 3553, 3932, 4447, 4992, 5445, 5636, 5364, 4540, 3302, 1849, 223, -1648, -3752, -5902, -7837, -9335, -10304, -10862, -11298, -11864, -12505, -12985, -13224, -13447, -13944, -14806, -15905, -17027, -17930, -18414, -18459, -18288, -18151, -18069, -17916, -17636, -17332, -17141, -17221, -17711, -18520, -19405, -20280, -21288, -22434, -23428, -24022, -24182, -23900, -23093, -21855, -20497, -19172, -17670, -15762, -13651, -11705, -9998, -8412, -7038, -6021, -5259, -4685, -4500, -4815, -5293, -5620, -5864, -6136, -6276, -6081, -5440, -4259, -2596, -772, 980, 2743, 4549, 6121, 7221, 7980, 8599, 8999, 8971, 8524, 7898, 7310, 6872, 6628, 6505, 6298, 5925, 5631, 5641, 5793, 5786, 5643, 5601, 5691, 5743, 5641, 5357, 4862, 4186, 3452, 2708, 1895, 1075, 479, 173, -154, -760, -1369, -1511, -1293, -1354, -2005, -2841, -3387, -3745, -4396, -5544, -6938, -8207, -9177, -9847, -10224, -10323, -10243, -10105, -9905, -9489, -8728, -7790, -7091, -6858, -6848, -6724, -6537, -6557, -6808, -7112, -7446, -7898, -8406, -8838, -9218, -9604, -9865, -9765, -9232, -8402, -7404, -6251, -4914, -3451, -2003, -721, 240, 755, 833, 679, 550, 529, 483, 275, 17, 48, 572, 1394, 2146, 2683, 3062, 3342, 3588, 3916, 4299, 4528, 4558, 4662, 5031, 5495, 5827, 6097, 6492, 6985, 7340, 7395, 7222, 7027, 6965, 7032, 7057, 6872, 6545, 6332, 6290, 6151, 5729, 5188, 4715, 4182, 3443, 2722, 2384, 2445, 2575, 2553, 2480, 2536, 2649, 2562, 2134, 1502, 914, 463, 12, -643, -1527, -2392, -2933, -3063, -2954, -2788, -2583, -2347, -2204, -2219, -2217, -2064, -2037, -2550, -3547, -4476, -4958, -5219, -5697, -6382, -6748, -6439, -5834, -5585, -5675, -5483, -4839, -4374, -4549, -4933, -4936, -4743, -4956, -5596, -6241, -7011, -8534, -10693, -12353, -12703, -12052, -10942, -9256, -6600, -2835, 2041, 7913, 14114, 19478, 23132, 24927, 24990, 23467, 21137, 19183, 17528, 14667, 10398, 7058, 6457, 7418, 8089, 8781, 10585, 13240, 15994, 18936, 22157, 25043, 27167, 28840, 30338, 31530, 32271, 32624, 32669, 32422, 31923, 31059, 29574, 27545, 25683, 24580, 23822, 22661, 21500, 21428, 22415, 23378, 23934, 24592, 25316, 25499, 25129, 24614, 23820, 22406, 20750, 19513, 18729, 18082, 17584, 17421, 17360, 16911, 15959, 14898, 13941, 12649, 10458, 7607, 4982, 2970, 975, -1609, -4397, -6487, -7615, -8342, -9060, -9488, -9333, -8837, -8205, -7132, -5486, -3959, -3287, -3262, -3288, -3463, -4384, -6238, -8623, -11123, -13601, -16050, -18387, -20362, -21684, -22250, -22162, -21507, -20306, -18649, -16634, -14257, -11609, -9117, -7247, -5961, -4790, -3597, -2891, -3102, -3875, -4514, -4883, -5333, -5939, -6394, -6589, -6716, -6825, -6705, -6199, -5372, -4352, -3192, -1895, -448, 1139, 2761, 4200, 5289, 6058, 6680, 7221, 7572, 7676, 7729, 7974, 8377, 8694, 8881, 9078, 9205, 8923, 8115, 7018, 5810, 4427, 2870, 1350, 100, -727, -981, -623, 99, 844, 1503, 2171, 2839, 3326, 3518, 3480, 3203, 2528, 1461, 229, -1059, -2560, -4336, -6261, -8261, -10329, -12307, -14014, -15451, -16647, -17454, -17782, -17721, -17325, -16612, -15814, -15290, -15122, -15136, -15248, -15567, -16124, -16837, -17680, -18709, -19869, -20947, -21796, -22448, -22979, -23369, -23573, -23640, -23586, -23354, -22917, -22351, -21715, -20949, -20023, -19035, -18122, -17299, -16506, -15728, -14971, -14176, -13325, -12541, -11885, -11211, -10415, -9651, -9017, -8384, -7678, -7083, -6689, -6311, -5861, -5571, -5552, -5454, -4839, -3755, -2618, -1626, -603, 607, 2030, 3659, 5330, 6604, 7272, 7686, 8142, 8335, 7929, 7262, 6859, 6640, 6193, 5556, 5151, 5078, 4935, 4458, 3934, 3805, 4099, 4494, 4750, 4901, 5149, 5657, 6330, 6861, 7109, 7177, 6994, 6292, 5177, 4109, 3188, 2032, 542, -871, -1890, -2592, -3097, -3414, -3621, -3819, -3961, -3963, -3908, -3922, -3970, -3958, -3957, -4096, -4293, -4315, -4158, -4060, -4092, -4039, -3817, -3679, -3856, -4250, -4602, -4812, -5000, -5331, -5796, -6142, -6118, -5763, -5346, -5034, -4740, -4324, -3796, -3292, -2914, -2601, -2205, -1673, -1138, -720, -318, 253, 978, 1605, 1946, 2049, 2029, 1915, 1728, 1607, 1622, 1610, 1420, 1256, 1498, 2195, 3009, 3641, 4128, 4680, 5390, 6154, 6799, 7197, 7294, 7118, 6798, 6515, 6331, 6124, 5758, 5307, 4996, 4928, 4958, 4942, 4950, 5050, 4999, 4533, 3879, 3489, 3296, 2835, 2096, 1603, 1576, 1615, 1378, 1022, 830, 765, 563, 58, -732, -1676, -2586, -3356, -4102, -4977, -5797, -6177, -6154, -6225, -6583, -6798, -6524, -6089, -6052, -6445, -6831, -6917, -6823, -6796, -6905, -7046, -7082, -6971, -6842, -6908, -7175, -7420, -7594, -7978, -8657, -9167, -9020, -8419, -8013, -7957, -7691, -6782, -5538, -4497, -3792, -3264, -2768, -2151, -1504, -1392, -2077, -2715, -2348, -1399, -1072, -1518, -1734, -1063, 129, 1211, 1904, 2234, 2344, 2447, 2643, 2795, 2801, 2887, 3127, 2967, 2002, 971, 776, 813, -304, -2536, -4382, -4778, -3780, -1786, 816, 3799, 7563, 12757, 18858, 24070, 27181, 28765, 29852, 30249, 29037, 26179, 22517, 18466, 14126, 10314, 7943, 6672, 5812, 5931, 7952, 11361, 14991, 18578, 22213, 25316, 27375, 28817, 30181, 31369, 32123, 32544, 32767, 32742, 32319, 31294, 29442, 26810, 23797, 20743, 17619, 14488, 12110, 11351, 12019, 13229, 14846, 17396, 20497, 22929, 24393, 25571, 26442, 26091, 24353, 22206, 20390, 18730, 16882, 14896, 12898, 10865, 8875, 7232, 6062, 4950, 3276, 1082, -833, -1915, -2588, -3540, -4649, -5213, -5050, -4669, -4453, -4306, -4159, -4244, -4610, -4849, -4735, -4687, -5215, -6172, -7038, -7701, -8455, -9453, -10657, -12163, -14051, -16033, -17649, -18761, -19560, -20086, -20066, -19272, -17840, -16084, -14166, -12088, -9906, -7774, -5834, -4233, -3171, -2804, -3047, -3626, -4363, -5343, -6689, -8223, -9531, -10377, -10962, -11599, -12222, -12359, -11692, -10430, -8954, -7273, -5160, -2722, -335, 1893, 4106, 6146, 7527, 7978, 7681, 6939, 5887, 4562, 2996, 1257, -440, -1713, -2311, -2422, -2457, -2505, -2269, -1619, -871, -355, -10, 370, 775, 1103, 1452, 2009, 2694, 3104, 2915, 2208, 1366, 603, -270, -1603, -3412, -5278, -6749, -7789, -8668, -9495, -10083, -10334, -10449, -10630, -10838, -10946, -10985, -11071, -11242, -11422, -11543, -11609, -11719, -12020, -12611, -13429, -14269, -14961, -15528, -16158, -16992, -17973, -18930, -19720, -20327, -20779, -21089, -21254, -21233, -20971, -20430, -19648, -18696, -17660, -16653, -15775, -15025, -14374, -13893, -13701, -13783, -13993, -14205, -14308, -14217, -13943, -13642, -13429, -13230, -12884, -12318, -11569, -10702, -9769, -8820, -7900, -7012, -6121, -5214, -4287, -3364, -2566, -2043, -1711, -1281, -666, -65, 420, 940, 1487, 1864, 2115, 2486, 2883, 2904, 2535, 2295, 2519, 2934, 3158, 3248, 3474, 3818, 4099, 4400, 4937, 5586, 5975, 6009, 5974, 6139, 6507, 6879, 7010, 6835, 6586, 6495, 6424, 6008, 5180, 4276, 3629, 3241, 2836, 2179, 1353, 723, 542, 675, 802, 826, 884, 1073, 1307, 1447, 1423, 1230, 899, 494, 83, -325, -770, -1282, -1800, -2204, -2396, -2399, -2374, -2510, -2832, -3149, -3264, -3210, -3181, -3255, -3288, -3122, -2796, -2478, -2249, -2056, -1867, -1777, -1863, -2005, -2016, -1915, -1901, -2001, -1945, -1495, -759, -79, 329, 529, 729, 1036, 1371, 1580, 1629, 1621, 1660, 1756, 1879, 2052, 2295, 2523, 2644, 2747, 3003, 3367, 3659, 3916, 4346, 4950, 5512, 5939, 6271, 6462, 6453, 6315, 6108, 5775, 5373, 5134, 5133, 5168, 5114, 5158, 5465, 5828, 5979, 6044, 6332, 6750, 6857, 6559, 6253, 6199, 6173, 5877, 5346, 4845, 4553, 4421, 4248, 3906, 3495, 3202, 3029, 2798, 2427, 2016, 1620, 1134, 502, -62, -283, -236, -325, -792, -1379, -1659, -1604, -1654, -2203, -3136, -3976, -4395, -4465, -4455, -4500, -4563, -4589, -4545, -4405, -4218, -4139, -4326, -4782, -5344, -5772, -5866, -5599, -5156, -4764, -4460, -4099, -3577, -3014, -2713, -2913, -3507, -4068, -4264, -4189, -4135, -4177, -4099, -3669, -2837, -1779, -834, -279, -59, 178, 687, 1314, 1712, 1786, 1766, 1880, 2228, 2849, 3541, 3819, 3619, 3634, 4356, 5285, 5786, 5971, 6110, 6087, 6008, 6361, 7018, 7192, 6767, 6602, 7139, 7674, 7348, 6153, 4575, 2909, 1317, 148, -349, -459, -499, 25, 2180, 6536, 12626, 19123, 24389, 27427, 28636, 29059, 28967, 27758, 24927, 20442, 14870, 9694, 6433, 4845, 3481, 2282, 2845, 5714, 9323, 12191, 14499, 17078, 20116, 23248, 25986, 27995, 29315, 30216, 30786, 30937, 30554, 29259, 26450, 22096, 17228, 13002, 9595, 6601, 4275, 3590, 4866, 7305, 10260, 13935, 18198, 21883, 24120, 25249, 25718, 25158, 23323, 20743, 17914, 14847, 11697, 8889, 6531, 4453, 2570, 916, -369, -929, -638, -84, 84, 80, 507, 1330, 2002, 2393, 2787, 3076, 2672, 1339, -476, -2320, -4232, -6234, -7978, -9299, -10485, -11604, -12218, -12156, -11818, -11516, -11234, -11093, -11318, -11806, -12383, -13189, -14290, -15314, -15893, -16050, -15924, -15548, -15006, -14394, -13588, -12488, -11375, -10714, -10559, -10575, -10661, -11120, -12014, -12874, -13428, -13985, -14676, -15100, -15188, -15463, -15992, -16235, -16052, -15726, -15022, -13537, -11743, -10376, -9171, -7376, -5198, -3596, -2960, -2909, -3245, -4198, -5713, -7284, -8698, -10173, -11488, -11940, -11478, -10879, -10498, -9962, -9155, -8361, -7509, -6409, -5471, -5130, -4952, -4237, -3041, -1947, -1277, -1088, -1499, -2485, -3691, -4841, -6151, -7920, -9844, -11255, -11915, -12024, -11640, -10755, -9741, -8966, -8171, -6969, -5678, -4955, -4888, -5038, -5157, -5363, -5813, -6515, -7413, -8458, -9591, -10761, -11909, -12958, -13798, -14349, -14607, -14575, -14243, -13676, -13001, -12199, -11098, -9755, -8536, -7739, -7359, -7284, -7383, -7476, -7587, -8079, -9135, -10315, -11045, -11203, -11010, -10716, -10576, -10619, -10448, -9698, -8624, -7698, -7007, -6446, -6031, -5601, -4821, -3811, -3130, -2971, -2993, -3010, -3140, -3377, -3546, -3650, -3782, -3843, -3648, -3172, -2474, -1578, -545, 464, 1331, 2045, 2585, 2821, 2702, 2415, 2190, 2030, 1796, 1513, 1363, 1410, 1575, 1847, 2291, 2848, 3319, 3643, 3959, 4310, 4532, 4618, 4831, 5230, 5482, 5409, 5283, 5293, 5268, 5061, 4727, 4247, 3582, 2969, 2674, 2595, 2495, 2420, 2524, 2781, 3153, 3771, 4622, 5336, 5549, 5371, 5205, 5166, 4993, 4519, 3890, 3287, 2764, 2391, 2216, 2121, 1988, 1925, 2054, 2254, 2378, 2478, 2624, 2731, 2734, 2723, 2786, 2908, 3039, 3155, 3224, 3228, 3184, 3083, 2876, 2575, 2260, 1982, 1701, 1399, 1169, 1153, 1380, 1719, 2023, 2276, 2569, 2912, 3170, 3218, 3091, 2889, 2643, 2334, 2004, 1753, 1661, 1733, 1906, 2114, 2376, 2756, 3203, 3537, 3649, 3602, 3454, 3117, 2549, 1967, 1668, 1665, 1701, 1655, 1690, 1943, 2315, 2675, 3027, 3348, 3493, 3405, 3211, 3051, 2937, 2836, 2752, 2697, 2672, 2684, 2738, 2807, 2812, 2654, 2297, 1842, 1463, 1232, 1059, 854, 697, 765, 1079, 1446, 1704, 1892, 2114, 2335, 2445, 2395, 2182, 1809, 1350, 961, 729, 590, 435, 217, -37, -252, -303, -141, 35, -113, -673, -1272, -1444, -1155, -761, -547, -474, -329, 20, 436, 561, 255, -131, -244, -280, -654, -1282, -1686, -1696, -1563, -1482, -1370, -1138, -873, -685, -591, -568, -629, -744, -831, -854, -797, -555, -88, 360, 529, 548, 694, 929, 1056, 1090, 1083, 935, 700, 688, 1009, 1393, 1650, 1886, 2168, 2414, 2618, 2834, 2981, 2933, 2768, 2671, 2696, 2756, 2813, 2936, 3171, 3483, 3821, 4145, 4374, 4426, 4327, 4167, 3974, 3813, 3847, 4119, 4402, 4549, 4762, 5248, 5821, 6134, 6145, 6090, 6076, 5957, 5592, 5069, 4616, 4375, 4337, 4424, 4585, 4836, 5185, 5530, 5709, 5743, 5844, 6065, 6154, 5956, 5687, 5609, 5638, 5530, 5247, 4929, 4599, 4153, 3567, 2970, 2444, 1916, 1309, 747, 493, 702, 1342, 2296, 3504, 4944, 6517, 7992, 9223, 10282, 11157, 11473, 10880, 9614, 8219, 6912, 5622, 4382, 3268, 2242, 1448, 1284, 1834, 2692, 3551, 4510, 5697, 7009, 8322, 9572, 10663, 11522, 12168, 12567, 12575, 12148, 11448, 10605, 9567, 8265, 6838, 5508, 4355, 3390, 2774, 2687, 3033, 3592, 4364, 5460, 6756, 7995, 9065, 9892, 10317, 10309, 10002, 9406, 8423, 7158, 5875, 4641, 3375, 2169, 1202, 482, -89, -493, -650, -580, -361, -24, 428, 944, 1433, 1791, 1894, 1663, 1174, 621, 42, -783, -1991, -3339, -4509, -5484, -6404, -7260, -7947, -8431, -8653, -8583, -8368, -8189, -7966, -7541, -7038, -6715, -6577, -6462, -6411, -6639, -7183, -7815, -8378, -8961, -9678, -10440, -11058, -11491, -11820, -12101, -12320, -12432, -12373, -12127, -11781, -11407, -10967, -10455, -9989, -9655, -9388, -9142, -9031, -9165, -9502, -9944, -10399, -10788, -11059, -11256, -11454, -11632, -11689, -11564, -11309, -11009, -10691, -10318, -9867, -9384, -8933, -8517, -8119, -7754, -7446, -7177, -6930, -6777, -6834, -7099, -7390, -7556, -7635, -7781, -8047, -8303, -8400, -8330, -8180, -8010, -7817, -7594, -7356, -7085, -6731, -6279, -5788, -5344, -5049, -4979, -5038, -5003, -4869, -4919, -5282, -5688, -5883, -5965, -6147, -6451, -6824, -7216, -7487, -7508, -7360, -7211, -7037, -6724, -6308, -5894, -5473, -5004, -4592, -4388, -4367, -4360, -4320, -4399, -4707, -5142, -5545, -5877, -6163, -6386, -6533, -6680, -6879, -7021, -6949, -6656, -6211, -5574, -4742, -3943, -3388, -2920, -2285, -1601, -1139, -896, -738, -736, -978, -1281, -1476, -1710, -2191, -2827, -3297, -3387, -3151, -2784, -2413, -1996, -1373, -490, 452, 1158, 1607, 2055, 2598, 2984, 3052, 2995, 2962, 2781, 2307, 1722, 1260, 959, 776, 697, 676, 694, 871, 1301, 1841, 2263, 2561, 2934, 3439, 3885, 4104, 4145, 4122, 4045, 3912, 3780, 3600, 3222, 2649, 2081, 1646, 1287, 964, 770, 792, 996, 1312, 1709, 2129, 2465, 2675, 2817, 2873, 2721, 2355, 1958, 1609, 1164, 587, 86, -188, -336, -478, -608, -682, -651, -418, -1, 372, 520, 572, 755, 1020, 1095, 894, 647, 556, 513, 319, 0, -281, -457, -585, -706, -779, -704, -421, -40, 233, 386, 663, 1182, 1709, 1966, 2023, 2168, 2496, 2793, 2838, 2666, 2485, 2412, 2371, 2272, 2189, 2268, 2492, 2647, 2593, 2502, 2694, 3231, 3818, 4142, 4257, 4465, 4910, 5401, 5689, 5758, 5762, 5806, 5898, 6006, 6067, 6017, 5898, 5795, 5669, 5430, 5154, 5021, 5056, 5122, 5167, 5279, 5537, 5919, 6280, 6456, 6467, 6572, 6920, 7282, 7356, 7195, 7070, 7037, 6922, 6664, 6418, 6292, 6219, 6110, 5995, 5909, 5792, 5608, 5443, 5371, 5364, 5390, 5480, 5617, 5717, 5764, 5828, 5948, 6076, 6154, 6140, 6030, 5926, 5938, 6001, 5891, 5524, 5122, 4952, 4973, 4879, 4516, 4081, 3858, 3844, 3793, 3587, 3404, 3466, 3752, 4063, 4275, 4441, 4647, 4876, 5017, 4985, 4813, 4609, 4400, 4111, 3731, 3367, 3066, 2746, 2385, 2109, 2009, 2037, 2152, 2379, 2682, 2956, 3174, 3405, 3655, 3808, 3752, 3508, 3228, 3051, 2971, 2861, 2619, 2293, 2026, 1879, 1764, 1574, 1343, 1209, 1249, 1415, 1636, 1887, 2151, 2364, 2474, 2520, 2584, 2669, 2662, 2470, 2171, 1945, 1844, 1703, 1377, 961, 685, 605, 550, 380, 198, 196, 390, 624, 785, 920, 1120, 1389, 1585, 1519, 1160, 731, 463, 306, 27, -433, -881, -1102, -1089, -1006, -1023, -1174, -1316, -1282, -1066, -834, -728, -741, -836, -1073, -1479, -1873, -2019, -1968, -1996, -2194, -2321, -2138, -1704, -1304, -1146, -1148, -1023, -656, -326, -354, -646, -859, -943, -1155, -1577, -1965, -2138, -2238, -2463, -2738, -2807, -2607, -2375, -2322, -2345, -2171, -1726, -1251, -993, -907, -770, -543, -457, -666, -1005, -1248, -1435, -1731, -2084, -2272, -2308, -2481, -2864, -3099, -2924, -2609, -2518, -2532, -2335, -1992, -1798, -1776, -1736, -1641, -1611, -1667, -1714, -1691, -1647, -1688, -1867, -2078, -2151, -2103, -2175, -2505, -2897, -3060, -3028, -3093, -3294, -3301, -2914, -2395, -2093, -1978, -1803, -1549, -1416, -1484, -1615, -1707, -1822, -2017, -2213, -2303, -2344, -2482, -2726, -2925, -2980, -2971, -3000, -3042, -2999, -2831, -2568, -2272, -2046, -1977, -2035, -2123, -2205, -2293, -2369, -2426, -2492, -2523, -2438, -2284, -2181, -2113, -1994, -1903, -1972, -2085, -1994, -1718, -1555, -1654, -1850, -1967, -2084, -2329, -2613, -2777, -2819, -2790, -2632, -2305, -1921, -1563, -1209, -951, -994, -1301, -1565, -1586, -1478, -1467, -1648, -1906, -2012, -1891, -1781, -1895, -2070, -2029, -1842, -1760, -1753, -1610, -1377, -1296, -1356, -1291, -1080, -1059, -1385, -1724, -1748, -1650, -1814, -2206, -2463, -2481, -2504, -2700, -2919, -2950, -2789, -2561, -2341, -2142, -1989, -1873, -1736, -1577, -1479, -1486, -1547, -1626, -1761, -1975, -2227, -2462, -2675, -2889, -3108, -3299, -3401, -3337, -3117, -2901, -2803, -2636, -2156, -1576, -1353, -1459, -1432, -1189, -1137, -1409, -1684, -1782, -1873, -2046, -2215, -2356, -2507, -2585, -2510, -2372, -2293, -2209, -1982, -1636, -1344, -1182, -1077, -1001, -1014, -1109, -1211, -1323, -1449, -1507, -1504, -1635, -1946, -2202, -2271, -2324, -2423, -2336, -1969, -1562, -1307, -1107, -844, -610, -552, -651, -746, -708, -604, -639, -884, -1173, -1352, -1498, -1730, -1977, -2090, -2092, -2092, -2064, -1864, -1457, -1018, -761, -706, -629, -350, 0, 146, 61, -31, -23, -24, -114, -245, -403, -633, -893, -1052, -1072, -1031, -963, -819, -601, -417, -315, -215, -87, -47, -135, -168, 6, 262, 366, 278, 167, 199, 363, 457, 313, 55, -21, 142, 354, 530, 755, 986, 1071, 1032, 1009, 969, 806, 593, 467, 423, 423, 530, 763, 1008, 1176, 1299, 1437, 1610, 1784, 1870, 1791, 1596, 1425, 1337, 1274, 1209, 1193, 1216, 1196, 1156, 1279, 1617, 1891, 1819, 1552, 1453, 1563, 1636, 1593, 1607, 1776, 2051, 2389, 2737, 2965, 2983, 2838, 2618, 2331, 1977, 1612, 1318, 1155, 1133, 1196, 1250, 1243, 1209, 1223, 1302, 1422, 1599, 1892, 2272, 2609, 2827, 2950, 2973, 2851, 2622, 2379, 2149, 1907, 1689, 1530, 1409, 1303, 1221, 1107, 899, 696, 678, 836, 981, 1056, 1246, 1665, 2115, 2314, 2252, 2135, 2051, 1882, 1565, 1224, 997, 881, 822, 839, 924, 964, 886, 795, 777, 733, 582, 488, 616, 852, 987, 1051, 1193, 1373, 1421, 1303, 1155, 1076, 1044, 997, 960, 999, 1093, 1111, 978, 778, 634, 548, 450, 340, 261, 205, 158, 176, 317, 506, 615, 677, 856, 1163, 1381, 1359, 1239, 1213, 1226, 1110, 884, 721, 666, 591, 438, 330, 387, 532, 609, 603, 638, 748, 811, 746, 665, 715, 854, 920, 884, 885, 1025, 1233, 1366, 1376, 1295, 1145, 942, 739, 591, 500, 443, 435, 494, 601, 717, 826, 909, 945, 955, 967, 977, 984, 1027, 1116, 1208, 1290, 1393, 1484, 1465, 1290, 1009, 703, 457, 315, 206, 32, -151, -189, -81, 42, 189, 456, 789, 1010, 1088, 1154, 1258, 1309, 1232, 1051, 835, 645, 538, 512, 462, 281, 34, -118, -147, -174, -259, -307, -254, -135, 24, 229, 416, 485, 458, 470, 556, 593, 516, 437, 449, 457, 350, 193, 85, -28, -213, -389, -471, -504, -526, -482, -345, -167, -3, 103, 103, 22, -9, 71, 167, 189, 183, 228, 289, 264, 114, -87, -244, -345, -458, -595, -639, -489, -218, -2, 87, 105, 109, 110, 129, 192, 274, 326, 347, 387, 468, 543, 533, 404, 196, -20, -191, -280, -254, -122, 55, 216, 361, 518, 649, 656, 509, 316, 211, 218, 276, 342, 410, 437, 402, 368, 407, 458, 390, 197, 40, 58, 200, 311, 304, 233, 180, 162, 125, 35, -84, -165, -152, -54, 50, 97, 103, 126, 159, 121, -13, -139, -137, -41, -5, -78, -130, -73, -4, -49, -162, -241, -291, -364, -434, -452, -416, -357, -314, -330, -389, -396, -320, -263, -292, -337, -299, -210, -154, -144, -124, -63, 8, 26, -49, -209, -373, -463, -503, -600, -762, -841, -736, -564, -476, -453, -393, -289, -201, -153, -141, -139, -87, 11, 49, -26, -106, -91, -54, -110, -231, -325, -371, -421, -497, -568, -580, -509, -402, -331, -307, -261, -155, -64, -83, -182, -230, -175, -118, -167, -273, -306, -248, -206, -262, -363, -391, -313, -222, -222, -300, -356, -344, -324, -349, -377, -324, -204, -118, -117, -148, -165, -189, -218, -224, -252, -358, -469, -459, -364, -332, -402, -469, -465, -413, -363, -354, -399, -440, -392, -263, -175, -222, -344, -407, -354, -260, -230, -286, -364, -409, -427, -444, -463, -444, -380, -332, -346, -358, -289, -190, -153, -143, -59, 67, 114, 65, 17, -8, -96, -266, -407, -433, -392, -361, -325, -232, -118, -59, -46, -14, 21, -22, -127, -154, -36, 109, 151, 127, 143, 180, 143, 19, -122, -239, -336, -389, -361, -282, -231, -214, -176, -128, -150, -243, -295, -241, -151, -87, 20, 253, 528, 678, 670, 606, 531, 389, 189, 46, 21, 75, 125, 61, -207, -623, -997, -1255, -1501, -1760, -1832, -1507, -795, 47, 685, 953, 1006, 1112, 1250, 1141, 715, 291, 187, 354, 476, 306, -93, -434, -591, -846, -1472, -2183, -2412, -2083, -1665, -1448, -1215, -720, -108, 300, 430, 499, 680, 864, 807, 498, 192, 70, -36, -390, -950, -1378, -1488, -1463, -1522, -1574, -1445, -1228, -1119, -1060, -893, -676, -580, -579, -483, -192, 206, 511, 540, 335, 117, -21, -257, -709, -1176, -1374, -1265, -1034, -842, -738, -715, -727, -705, -660, -703, -848, -888, -622, -163, 186, 326, 398, 443, 310, -72, -510, -766, -806, -765, -733, -688, -585, -440, -317, -317, -478, -679, -727, -591, -426, -322, -193, 20, 226, 297, 226, 88, -65, -238, -443, -646, -765, -757, -679, -604, -535, -444, -371, -411, -560, -678, -659, -570, -482, -317, -25, 253, 397, 498, 627, 629, 390, 53, -212, -403, -533, -568, -568, -628, -677, -598, -476, -490, -630, -736, -762, -790, -809, -663, -260, 261, 675, 890, 947, 898, 769, 574, 305, -12, -267, -336, -237, -123, -115, -228, -395, -531, -631, -762, -873, -733, -266, 248, 533, 683, 897, 1097, 1069, 835, 607, 507, 511, 550, 569, 549, 492, 394, 228, 25, -131, -223, -278, -278, -168, 40, 278, 513, 725, 855, 868, 818, 786, 779, 758, 732, 747, 807, 845, 786, 624, 413, 206, 23, -128, -215, -172, 24, 293, 501, 597, 643, 682, 691, 665, 657, 690, 744, 833, 972, 1092, 1085, 933, 693, 424, 177, 12, -46, -16, 76, 204, 313, 384, 457, 545, 581, 530, 486, 564, 747, 921, 1034, 1126, 1217, 1238, 1142, 977, 822, 692, 563, 462, 450, 523, 611, 668, 712, 752, 751, 694, 638, 629, 649, 658, 679, 764, 919, 1080, 1163, 1143, 1072, 1022, 1006, 998, 981, 954, 912, 870, 870, 921, 947, 869, 730, 649, 666, 690, 646, 590, 619, 721, 794, 792, 772, 800, 867, 931, 964, 974, 984, 992, 985, 956, 918, 879, 831, 764, 688, 619, 568, 528, 496, 470, 439, 412, 433, 525, 621, 633, 575, 569, 667, 748, 690, 580, 607, 744, 779, 649, 531, 527, 511, 389, 273, 280, 352, 373, 350, 364, 413, 426, 379, 317, 264, 206, 160, 164, 219, 281, 322, 338, 335, 319, 299, 260, 193, 132, 93, 61, 44, 83, 147, 141, 77, 60, 104, 109, 45, -4, -12, -36, -96, -125, -98, -60, -42, -10, 47, 75, 53, 48, 97, 124, 69, -8, -23, 0, -5, -47, -86, -94, -80, -87, -148, -220, -226, -181, -185, -248, -279, -252, -229, -223, -173, -78, -18, -27, -47, -40, -50, -114, -192, -228, -251, -322, -426, -488, -499, -545, -666, -768, -753, -651, -582, -582, -563, -458, -343, -310, -324, -287, -214, -199, -241, -267, -283, -353, -454, -522, -580, -691, -833, -929, -962, -968, -969, -971, -971, -941, -858, -738, -612, -503, -442, -439, -456, -449, -442, -494, -595, -690, -758, -819, -884, -957, -1047, -1146, -1217, -1243, -1237, -1210, -1154, -1060, -934, -791, -646, -530, -461, -416, -373, -355, -416, -547, -668, -736, -807, -944, -1105, -1197, -1206, -1200, -1214, -1193, -1104, -991, -886, -761, -614, -494, -415, -339, -281, -283, -310, -307, -323, -424, -558, -643, -699, -794, -919, -1013, -1059, -1060, -1011, -916, -803, -694, -582, -462, -345, -245, -166, -119, -133, -197, -249, -247, -229, -262, -345, -423, -441, -398, -354, -390, -496, -565, -535, -488, -499, -507, -431, -314, -256, -257, -237, -164, -101, -105, -155, -172, -122, -58, -46, -81, -137, -216, -315, -383, -395, -402, -426, -409, -327, -243, -199, -161, -116, -89, -48, 51, 158, 185, 162, 167, 189, 159, 91, 75, 114, 111, 14, -92, -115, -93, -141, -264, -343, -304, -223, -192, -188, -138, -56, -5, 9, 29, 66, 114, 170, 211, 230, 272, 336, 330, 223, 133, 130, 114, 6, -112, -165, -185, -193, -169, -136, -134, -124, -68, -16, 1, 46, 147, 235, 282, 352, 465, 530, 489, 424, 411, 377, 235, 76, 30, 40, -11, -63, -17, 29, -41, -127, -86, -1, -20, -81, -47, 59, 101, 58, 44, 161, 362, 496, 506, 512, 603, 668, 600, 508, 520, 531, 399, 223, 172, 183, 93, -56, -103, -54, -66, -126, -45, 191, 355, 356, 386, 545, 670, 659, 654, 751, 842, 832, 772, 716, 642, 541, 430, 306, 177, 85, 44, 17, -7, 3, 60, 97, 79, 101, 247, 443, 592, 750, 975, 1131, 1094, 1002, 1011, 1019, 886, 704, 612, 566, 480, 357, 218, 65, -49, -111, -197, -320, -363, -257, -83, 109, 342, 599, 828, 1048, 1260, 1349, 1258, 1132, 1118, 1124, 948, 600, 297, 162, 86, -61, -281, -552, -820, -902, -665, -330, -210, -216, -21, 378, 670, 759, 854, 1042, 1173, 1187, 1227, 1334, 1313, 1084, 844, 695, 437, -31, -449, -604, -656, -766, -794, -626, -443, -412, -401, -240, -33, 42, 80, 341, 836, 1250, 1350, 1290, 1317, 1323, 1034, 537, 202, 90, -55, -244, -213, -5, 37, -113, -188, -198, -420, -808, -959, -713, -360, -167, -34, 244, 608, 828, 841, 780, 743, 712, 651, 551, 452, 441, 504, 453, 196, -87, -244, -408, -676, -846, -742, -497, -292, -83, 221, 540, 735, 763, 647, 468, 367, 448, 619, 667, 543, 435, 437, 348, -30, -556, -943, -1094, -1058, -881, -651, -418, -85, 369, 712, 811, 879, 1006, 959, 743, 751, 1044, 1158, 899, 631, 566, 431, 34, -375, -537, -543, -588, -641, -600, -531, -522, -465, -255, -35, 67, 162, 318, 426, 496, 628, 659, 432, 252, 420, 622, 481, 250, 253, 236, -78, -388, -377, -289, -452, -728, -797, -619, -357, -114, 92, 240, 268, 151, -53, -251, -426, -601, -691, -554, -247, -33, -58, -185, -251, -303, -449, -638, -689, -474, -53, 329, 487, 501, 546, 565, 373, 38, -201, -319, -453, -552, -448, -204, -83, -188, -378, -492, -499, -451, -371, -214, 69, 412, 675, 814, 846, 713, 339, -130, -412, -427, -368, -340, -146, 374, 972, 1247, 1159, 1022, 987, 866, 509, 101, -119, -179, -235, -306, -335, -393, -560, -703, -683, -663, -843, -1011, -776, -180, 311, 456, 477, 634, 830, 776, 395, -81, -425, -650, -870, -1004, -882, -595, -441, -509, -610, -644, -711, -840, -871, -717, -472, -249, -55, 109, 195, 190, 178, 238, 312, 243, 17, -126, -22, 90, -127, -550, -754, -699, -740, -974, -1094, -909, -595, -364, -225, -93, 89, 285, 368, 322, 329, 499, 635, 558, 402, 357, 356, 240, 0, -335, -772, -1210, -1444, -1421, -1276, -1072, -736, -280, 99, 228, 167, 132, 242, 424, 536, 552, 541, 532, 518, 514, 458, 167, -369, -799, -822, -654, -665, -774, -629, -166, 343, 611, 514, 258, 274, 627, 849, 820, 1159, 2160, 3125, 3433, 3401, 3375, 2909, 1586, -111, -1415, -2208, -2806, -3251, -3310, -2979, -2579, -2314, -2058, -1662, -1224, -910, -657, -255, 355, 1059, 1764, 2483, 3148, 3483, 3179, 2177, 754, -666, -1824, -2733, -3428, -3718, -3513, -3182, -3023, -2667, -1754, -837, -639, -779, -322, 759, 1658, 1990, 2068, 2137, 2062, 1663, 907, -103, -1094, -1714, -1889, -1955, -2196, -2423, -2331, -2084, -2029, -2053, -1856, -1598, -1543, -1407, -765, 142, 767, 1092, 1503, 2036, 2326, 2183, 1822, 1504, 1257, 969, 616, 260, -64, -388, -764, -1212, -1655, -1928, -1963, -1871, -1736, -1419, -762, 141, 1031, 1719, 2171, 2405, 2477, 2502, 2545, 2520, 2351, 2151, 2008, 1688, 903, -169, -1077, -1745, -2461, -3200, -3480, -2992, -1982, -917, -17, 758, 1473, 2067, 2382, 2276, 1810, 1333, 1226, 1496, 1777, 1775, 1495, 995, 254, -598, -1221, -1447, -1496, -1587, -1549, -1097, -388, 83, 108, -64, -237, -549, -1051, -1345, -980, -83, 733, 1065, 1042, 954, 829, 494, -124, -888, -1504, -1634, -1113, -164, 700, 1055, 868, 433, 48, -222, -476, -730, -816, -550, 4, 527, 759, 765, 722, 622, 403, 186, 78, -45, -219, -178, 154, 382, 201, -206, -598, -962, -1268, -1395, -1298, -858, 44, 1010, 1384, 1250, 1227, 1218, 588, -399, -734, -285, 67, -67, -182, -15, -38, -563, -1212, -1567, -1712, -1761, -1410, -500, 486, 1057, 1349, 1595, 1542, 978, 264, -142, -280, -433, -682, -864, -751, -336, -50, -429, -1374, -2079, -1928, -1175, -427, 243, 1131, 2013, 2217, 1676, 1037, 568, -138, -1125, -1748, -1622, -1030, -346, 183, 291, -14, -371, -646, -955, -1014, -438, 428, 1011, 1426, 1836, 1753, 1042, 481, 461, 465, 404, 813, 1451, 1475, 915, 349, -344, -1387, -2175, -2258, -2071, -1816, -1041, 179, 1168, 1834, 2474, 2745, 2238, 1435, 920, 475, -151, -614, -745, -923, -1250, -1293, -834, -199, 216, 227, -124, -464, -282, 493, 1352, 1798, 1816, 1574, 1004, 117, -570, -575, -235, -237, -461, -207, 540, 1046, 936, 474, -174, -1091, -2072, -2610, -2404, -1578, -521, 318, 646, 430, -237, -1214, -2144, -2517, -2110, -1207, -252, 514, 1093, 1576, 1931, 1836, 931, -576, -1822, -2114, -1705, -1370, -1313, -1044, -432, -196, -859, -1878, -2398, -2296, -1860, -1109, -11, 1223, 2284, 2721, 2111, 911, 237, 133, -398, -1163, -779, 596, 1148, 404, -357, -669, -1112, -1446, -996, -146, 545, 1452, 2598, 2941, 2182, 1587, 1998, 2617, 2613, 2547, 3206, 4063, 4069, 3366, 2911, 2826, 2525, 2053, 1811, 1551, 1055, 878, 1161, 1051, 415, 408, 1342, 1863, 1153, 170, -31, 278, 361, 150, 84, 429, 1118, 1850, 2185, 1778, 741, -370, -1130, -1509, -1552, -1325, -1233, -1594, -1873, -1340, -487, -556, -1623, -2296, -1516, 305, 2040, 2937, 2908, 2311, 1608, 986, 291, -620, -1535, -1979, -1719, -1080, -666, -769, -1232, -1896, -2843, -3955, -4552, -3892, -2145, -443, 394, 763, 1311, 1634, 881, -678, -1938, -2471, -2604, -2308, -1312, -17, 811, 1063, 1078, 742, -278, -1528, -1947, -1222, -160, 514, 885, 1074, 808, 200, -119, -113, -427, -1050, -1072, -87, 1185, 1867, 1753, 1279, 1169, 1758, 2411, 2210, 1216, 278, -178, -395, -629, -950, -1203, -784, 720, 2551, 3515, 3579, 3467, 3091, 1960, 696, 468, 1167, 1662, 1635, 1805, 2392, 2491, 1321, -581, -1855, -1823, -1026, -131, 1038, 2727, 4125, 4117, 2811, 1224, -88, -1007, -1160, -530, 39, 44, 78, 530, 697, 19, -1050, -1911, -2431, -2494, -1984, -1221, -650, -331, -211, -391, -891, -1690, -2980, -4655, -5733, -5179, -3272, -1336, -143, 602, 1056, 582, -973, -2346, -2303, -1350, -809, -886, -823, -272, 570, 1469, 1992, 1597, 394, -892, -1850, -2493, -2721, -2409, -1734, -852, 205, 1024, 916, -96, -1131, -1625, -1954, -2364, -2070, -444, 1475, 2052, 1322, 591, 143, -739, -1940, -2676, -2894, -2707, -1496, 739, 2419, 2349, 1247, 254, -546, -1371, -1983, -2220, -2091, -1278, 511, 2838, 4717, 5266, 4139, 1968, 223, -165, 188, 265, 253, 1043, 2512, 3374, 2677, 775, -1233, -2520, -2953, -2670, -1584, 312, 2327, 3491, 3659, 3425, 3087, 2590, 2106, 1652, 704, -667, -1206, -270, 765, 323, -1082, -1762, -1340, -921, -1120, -1345, -1161, -999, -1057, -747, 123, 853, 1033, 1038, 1097, 1134, 1250, 1138, -42, -1849, -2184, -286, 1723, 1845, 889, 541, 584, -291, -2078, -3456, -3690, -3315, -3035, -2813, -2311, -1567, -864, -325, 12, 1, -405, -960, -1419, -1815, -2105, -1919, -1249, -868, -1193, -1289, -164, 1585, 2595, 2367, 1181, -337, -953, 91, 1444, 1252, 201, 387, 1703, 2187, 1371, 586, 427, 329, 255, 796, 1681, 1695, 288, -1603, -2655, -2479, -1684, -1221, -1770, -2955, -3199, -1447, 1068, 2155, 1447, 389, -81, -238, -439, -718, -1032, -1046, -356, 701, 1375, 1597, 1698, 1488, 760, 28, -204, -58, 440, 1459, 2461, 2634, 2152, 1636, 947, -63, -658, -481, -362, -684, -557, 400, 1144, 885, 72, -743, -1521, -1980, -1488, 101, 2152, 3702, 4101, 3663, 3331, 3102, 1726, -1091, -3628, -4351, -3518, -1899, -62, 638, -877, -3109, -3459, -1903, -557, -328, -503, -645, -648, -113, 685, 591, -554, -1333, -935, -417, -994, -2210, -2642, -1840, -816, -542, -651, -172, 732, 642, -1208, -3411, -3569, -1240, 1172, 1368, 77, -395, 386, 1078, 1185, 1308, 1517, 1615, 2091, 2948, 2832, 1068, -746, -857, 200, 783, 719, 1110, 2141, 2594, 1775, 754, 835, 1441, 852, -950, -1783, -337, 1735, 1987, 218, -1837, -2718, -2063, -393, 1141, 1791, 2112, 2743, 2887, 1588, -197, -614, 507, 1597, 1453, 265, -1030, -1378, -51, 2444, 4068, 3097, 340, -1755, -2244, -2283, -2559, -2301, -1284, -607, -721, -694, -133, -101, -1329, -2776, -2810, -1344, -72, -231, -595, 961, 3862, 4945, 2950, 404, -162, 655, 1256, 1651, 2208, 1931, -63, -2695, -3998, -3342, -1781, -814, -1218, -2518, -3176, -1877, 866, 2907, 2951, 2412, 3596, 6073, 6594, 3562, -216, -1192, -30, -178, -2458, -4290, -3954, -2534, -1536, -1109, -910, -948, -1282, -1720, -1715, -540, 1714, 3564, 3539, 1996, 707, 838, 1911, 2411, 1012, -2357, -6089, -7867, -6682, -3903, -1841, -1436, -1975, -2645, -3089, -2703, -1035, 927, 1465, 506, -177, 430, 1258, 1245, 1355, 2981, 5278, 5961, 4308, 1558, -1170, -3518, -4945, -5005, -4108, -2732, -722, 1473, 2130, 265, -2566, -3941, -3426, -2325, -1177, 517, 2265, 2751, 2344, 2763, 3764, 2967, -229, -3224, -3476, -1142, 1932, 4065, 4390, 3099, 1269, -171, -1215, -2175, -2699, -2043, -164, 1970, 3261, 3250, 2106, 503, -589, -823, -984, -1583, -1497, 506, 3311, 4166, 1788, -2386, -5759, -6639, -5299, -3316, -1548, 487, 2707, 3777, 3379, 2669, 1660, -469, -2139, -928, 1635, 1910, 172, -360, 886, 2075, 2460, 1629, -1352, -4920, -5359, -2394, 225, 814, 1457, 3137, 3908, 2483, 9, -1882, -2335, -991, 1626, 3794, 4037, 2677, 1074, -317, -1957, -3404, -3115, -890, 965, 466, -999, -307, 2988, 5748, 5179, 2181, -241, -849, -918, -1467, -1756, -1176, -658, -742, -161, 1722, 2952, 1674, -972, -2622, -2596, -1546, -191, 655, 753, 1107, 2191, 2720, 1932, 795, -593, -3362, -6187, -5423, -475, 4767, 6725, 5135, 1735, -1113, -1583, -550, -799, -2583, -2824, -56, 3109, 4068, 3795, 4331, 4913, 3152, -898, -4383, -5122, -3340, -307, 2373, 2992, 1734, 1035, 1663, 1085, -1802, -3992, -3204, -1484, -1192, -1149, 507, 2790, 3538, 2425, 584, -1150, -2321, -2375, -1318, -27, 1035, 2663, 5153, 6444, 3948, -1608, -6176, -7195, -6348, -5850, -4588, -1021, 2699, 3688, 2924, 2559, 1598, -1203, -3537, -2955, -656, 1416, 3360, 4907, 4381, 1787, -681, -2080, -3269, -3848, -2019, 1747, 3964, 2622, 115, -379, 477, -144, -2450, -3920, -3090, -777, 1768, 3781, 4727, 4561, 3694, 2244, 209, -1558, -1870, -935, -318, -724, -1048, -387, 247, -449, -1764, -1978, -974, -111, 0, -136, -303, -614, -322, 1391, 3197, 2481, -606, -2483, -1117, 872, 349, -1540, -1442, 1188, 3752, 3988, 1908, -887, -2528, -2146, -638, 310, 229, 255, 1125, 1621, 86, -2913, -4830, -4130, -1891, -193, 226, 468, 1880, 3816, 3608, -101, -4738, -6257, -3738, 179, 2629, 2584, 498, -2106, -3165, -1907, -77, -8, -1693, -3130, -3270, -2602, -878, 2751, 6518, 6394, 1416, -4202, -6137, -4549, -2115, -103, 1662, 2914, 3095, 2511, 1819, 694, -1765, -5028, -6540, -4310, 293, 3895, 5033, 4610, 2790, -1075, -5141, -5737, -2385, 1474, 3322, 3640, 3299, 2445, 1672, 1199, -266, -3163, -4908, -2904, 1299, 3385, 1422, -2199, -4005, -3052, -872, 937, 1873, 1819, 767, -568, -1243, -1668, -3102, -4871, -4231, -254, 4193, 5865, 4490, 1571, -1762, -4414, -5097, -3704, -1571, 1, 448, -312, -1538, -1886, -1186, -1107, -2683, -3995, -2072, 3019, 7721, 8935, 6792, 3038, -1208, -4917, -6405, -4993, -2315, -463, 382, 1166, 1577, 293, -2470, -4428, -3910, -1753, 58, 520, -22, -537, -91, 1185, 2203, 2439, 2431, 2347, 1589, 373, -87, 337, 87, -1795, -4020, -4379, -2090, 1521, 4111, 4076, 1864, -295, -510, 745, 1419, 824, 577, 1828, 3003, 1948, -509, -1244, 859, 3236, 3063, 885, -535, -129, 524, 175, -104, 946, 2260, 1928, 251, -797, -696, -859, -2112, -3379, -3039, -559, 2954, 5144, 4003, 205, -2832, -2548, -412, 221, -973, -1129, 731, 1774, -34, -2487, -2541, -741, 162, -489, -695, 899, 2865, 2696, -2, -2863, -3439, -1932, -650, -873, -1150, 523, 3372, 4332, 2026, -1646, -4263, -5007, -3703, -452, 3214, 5202, 5145, 3985, 2009, -791, -3559, -5407, -6036, -4703, -722, 4122, 6214, 4327, 1088, -916, -2325, -4656, -6552, -4941, 330, 5340, 6305, 3414, -481, -3340, -4517, -3430, -329, 2317, 2252, 957, 1509, 3191, 2178, -2143, -5601, -4916, -1528, 1349, 2679, 3173, 2948, 1435, -809, -1722, 14, 2828, 3611, 1359, -1623, -2533, -1042, 986, 1818, 1301, 662, 1239, 3053, 4511, 4019, 1819, -241, -614, 798, 3027, 4670, 4185, 779, -4092, -6759, -4304, 2016, 7213, 7321, 3334, -414, -1285, -517, -589, -2001, -3219, -2871, -1280, -4, 20, -461, -414, -352, -1442, -3171, -3666, -2387, -872, -481, -784, -727, -185, 471, 1382, 2578, 3136, 2225, 252, -2120, -4705, -6378, -5128, -1198, 2127, 2600, 1540, 867, 164, -1669, -3885, -4650, -3173, -108, 3211, 5197, 4563, 1526, -1974, -4074, -4486, -3579, -1321, 1598, 3006, 1435, -1835, -4415, -5455, -5216, -3169, 1251, 6277, 8533, 6758, 2896, -887, -3837, -4997, -3131, 789, 3950, 5153, 5226, 4016, 373, -4440, -6676, -4736, -1272, 878, 2149, 3514, 3464, 1200, -263, 1372, 3150, 1557, -1433, -1766, 381, 1976, 1879, 1043, 514, 1243, 3509, 5643, 5259, 1872, -2952, -7148, -8731, -6332, -839, 4268, 5734, 3583, 373, -2058, -3401, -2833, 872, 6303, 9114, 6334, -625, -7647, -10846, -8249, -1140, 6057, 9011, 6713, 1226, -4385, -7411, -6767, -3941, -1515, -484, 2, 728, 1462, 1572, 674, -915, -2044, -1724, -464, 259, 154, 683, 2798, 5053, 5108, 2638, -506, -2657, -3465, -3109, -1984, -1055, -936, -669, 1055, 3348, 3619, 1281, -1126, -1815, -2280, -3694, -3587, 357, 5567, 7576, 5778, 2698, -216, -2637, -3276, -1188, 1956, 3192, 1443, -1386, -2352, -731, 828, -344, -2947, -3279, -426, 2888, 4360, 4136, 2820, 166, -3704, -7402, -8815, -6127, 722, 8699, 12886, 10532, 3692, -3037, -6965, -8335, -7690, -4603, 458, 5226, 7588, 7050, 3956, -963, -5930, -8718, -8475, -6008, -2270, 2171, 5974, 6987, 4572, 730, -2235, -3625, -3008, -28, 3041, 2595, -765, -2582, -1597, -995, -1905, -1822, -65, 1163, 1460, 2474, 3517, 1827, -2543, -6021, -6218, -4374, -2407, -192, 2764, 4990, 4603, 2092, -441, -1917, -2468, -2069, -718, 777, 1626, 2090, 2689, 2961, 1983, -62, -1653, -1629, -799, -930, -2032, -2228, -824, 831, 2303, 4463, 5909, 3399, -2511, -6881, -6653, -3007, 2521, 8708, 11828, 8320, 666, -4504, -4493, -2542, -1870, -1806, -761, 355, -191, -1744, -2163, -1274, -955, -1661, -1492, 394, 1902, 1171, -542, -1304, -1722, -2907, -3042, 392, 5852, 8642, 6611, 2348, -479, -1156, -1745, -3654, -5320, -4384, -1409, 983, 2244, 3664, 4410, 2212, -2158, -5507, -6855, -7121, -5362, -153, 6178, 9272, 8279, 5813, 2859, -1843, -6793, -7121, -1589, 4153, 4908, 2535, 1436, 1706, 968, -840, -2199, -2441, -1427, 254, 656, -1067, -2760, -2608, -1874, -1841, -1287, 624, 2194, 2002, 1185, 1496, 3046, 4683, 5135, 3619, 549, -2257, -3104, -2166, -627, 1612, 5182, 7929, 5712, -1889, -9859, -13579, -13062, -9799, -3600, 4658, 10650, 10436, 5115, -558, -3106, -2323, 502, 4120, 7022, 7488, 5013, 980, -2556, -4163, -3310, -645, 1680, 1292, -1972, -5488, -6427, -4606, -2072, -172, 1668, 3903, 5040, 3237, -663, -3072, -1548, 1811, 2673, 487, -580, 1797, 4212, 2994, -217, -1765, -1174, 127, 1483, 1815, -396, -4238, -6825, -6923, -5177, -2221, 599, 1255, 199, 299, 2015, 2521, 804, -582, -3, 993, 1305, 2439, 4882, 5704, 3066, 341, 1349, 3910, 3199, -685, -3874, -5076, -5362, -4213, -1201, 801, -744, -3166, -1994, 2165, 4460, 2951, 835, 926, 1902, 1980, 2672, 5508, 7447, 3910, -4123, -9963, -8962, -3528, 892, 2238, 2182, 2113, 1446, -729, -4068, -6834, -7118, -4845, -1914, 448, 2585, 4030, 3383, 1372, 226, -119, -879, -546, 2576, 5858, 5731, 3221, 1200, -465, -2769, -4486, -4776, -4878, -4866, -2854, 924, 3153, 1863, -1190, -3405, -4081, -3469, -1226, 2592, 6033, 6557, 3948, 654, -850, -48, 2040, 3849, 3763, 916, -3731, -7534, -8021, -5030, -848, 2118, 3534, 4362, 4466, 2425, -1940, -6081, -6830, -3670, 1099, 5039, 6758, 5179, 604, -3640, -4320, -2881, -2713, -2626, 1391, 8175, 11272, 7552, 618, -5116, -8750, -9966, -6717, 941, 7945, 8940, 4325, -1591, -6445, -10050, -10823, -6720, 726, 7034, 9335, 8114, 5132, 1699, -1270, -2936, -2682, -577, 2300, 4335, 4380, 2218, -1484, -5176, -7102, -6868, -5663, -4237, -1877, 1558, 4218, 4409, 2828, 1263, 290, -734, -2421, -4381, -4896, -2465, 1826, 5326, 7285, 8288, 6745, 591, -7647, -12325, -11155, -6126, 655, 7317, 9996, 5827, -1984, -6633, -5667, -2807, -1293, 398, 4195, 7645, 7084, 3212, -317, -2228, -3659, -3979, -985, 4274, 6921, 4153, -1135, -4477, -4974, -4177, -2418, 592, 3023, 2414, -308, -1574, -412, 317, -1006, -2087, -945, 834, 1216, 432, -892, -2489, -2664, -7, 3443, 4722, 3998, 2610, 298, -2474, -3604, -3002, -2558, -2003, -93, 1144, -647, -2892, -1622, 2043, 4063, 3420, 1640, -776, -3614, -4793, -2030, 4144, 10494, 13516, 11213, 3851, -5507, -12021, -12520, -8118, -2328, 2629, 6027, 6481, 2599, -4097, -9172, -8958, -3419, 4307, 9920, 9985, 4333, -2753, -5672, -3026, 1492, 4250, 5118, 4829, 2321, -2884, -7984, -9312, -6358, -1440, 3495, 7522, 8904, 5614, -1500, -8280, -11017, -9142, -4048, 2429, 7958, 10332, 8733, 3625, -3558, -9918, -12310, -9886, -3922, 3820, 10298, 11461, 6898, 1206, -2353, -5274, -8210, -7849, -2899, 2414, 4150, 3170, 1672, -269, -2764, -4326, -3701, -1316, 1865, 5116, 6995, 5605, 1252, -2598, -2903, -652, 782, -4, -1484, -1768, -576, 840, 781, -1152, -2902, -1675, 2302, 5038, 3318, -1097, -3960, -4100, -3408, -2207, 1109, 5758, 8039, 5882, 959, -3848, -6603, -6365, -3343, 997, 4841, 6651, 5324, 1276, -2785, -3893, -1966, 221, 456, -588, -936, -42, 1147, 1859, 1844, 1019, -67, -673, -1397, -2977, -3394, -3, 4957, 5737, 1141, -3417, -3362, -270, 1780, 1654, 1065, 1156, 1015, -638, -3104, -4014, -2391, -165, 376, -642, -1542, -1172, 577, 2504, 2233, -928, -3790, -3023, -104, 1037, -161, -1235, -1024, -28, 1654, 3572, 3993, 2203, 28, -406, 833, 1705, 84, -3894, -7016, -6157, -2375, 425, 994, 1908, 4433, 5508, 2351, -2348, -3658, -1400, 759, 2005, 4211, 6053, 4234, -30, -2671, -3517, -4648, -4430, -381, 4626, 5789, 3675, 2286, 2023, -138, -4425, -6610, -3529, 1982, 3957, 1139, -1043, 1401, 4508, 2470, -2866, -4750, -1546, 2322, 3657, 2926, 1154, -831, -1854, -1899, -1812, -973, 1150, 2165, -50, -3151, -3910, -3355, -3873, -4220, -1855, 2119, 4366, 4012, 2637, 784, -1982, -4019, -2549, 1794, 5230, 6099, 5756, 4288, 456, -4014, -5519, -4186, -3373, -3602, -2006, 1829, 4187, 2656, -490, -2164, -2528, -2643, -1004, 3720, 8220, 7284, 914, -4992, -5612, -2019, 1630, 3073, 2625, 950, -1436, -3133, -2558, 15, 2458, 2915, 1139, -1864, -4667, -6009, -5098, -1886, 2142, 4006, 2092, -1157, -1911, -55, 1413, 1610, 2508, 4407, 4636, 1738, -2155, -4163, -3677, -1744, 630, 2558, 3066, 2030, 470, -882, -2333, -3621, -2924, 603, 4068, 3391, -888, -3436, -1212, 2616, 4084, 3735, 3278, 1418, -2661, -5604, -4243, -527, 1582, 1352, 641, 521, 618, 202, -1043, -2320, -2004, 305, 2612, 2393, -641, -3972, -4476, -1724, 1109, 970, -899, -868, 1460, 2885, 1994, 1016, 1237, 527, -2342, -4180, -1674, 2893, 4370, 2036, -335, -975, -1641, -2771, -2445, -616, 407, 132, 287, 847, -190, -2450, -2672, 71, 2344, 1724, 720, 2197, 3987, 2390, -1143, -1836, 664, 1523, -1553, -4575, -3439, 67, 1693, 980, 392, 675, 766, 393, -266, -1619, -3236, -3408, -1493, 1281, 3844, 5973, 6684, 4186, -1540, -7277, -8923, -5345, 537, 4330, 3708, 382, -1334, 374, 1771, -1127, -5444, -5122, -698, 1733, 743, 959, 4050, 5883, 3653, -373, -3287, -4749, -4812, -2783, 316, 1686, 986, 1476, 4433, 5673, 1377, -5097, -6817, -2487, 2363, 3297, 1791, 1143, 1355, 523, -1321, -2712, -3418, -3863, -3169, -338, 3494, 5781, 4974, 1714, -1685, -3370, -3913, -4537, -3823, 202, 5028, 5603, 1668, -1865, -2171, -1107, -341, 947, 2399, 1236, -2961, -5847, -3694, 1412, 4969, 5979, 5775, 3829, -596, -4924, -5874, -3647, -159, 4050, 7841, 7582, 1345, -6746, -9984, -6409, -81, 4383, 5567, 3782, -267, -4171, -4553, -934, 3415, 5474, 5179, 3683, 1373, -1430, -3606, -4220, -3447, -1826, 541, 3151, 4420, 3132, 41, -3031, -4881, -4795, -2318, 1615, 4746, 5715, 4973, 3330, 1208, -1165, -3921, -6546, -6683, -2973, 1535, 3188, 3224, 4012, 3330, -796, -4098, -2689, -533, -2353, -4492, -1004, 5707, 7893, 3261, -3327, -7142, -7558, -5492, -1525, 2607, 4439, 4137, 4286, 5039, 3012, -3218, -9618, -10680, -5161, 2986, 8024, 6803, 1340, -2859, -2257, 1043, 2195, -164, -2635, -2251, -216, 952, 1220, 1765, 2166, 1331, -218, -1085, -1024, -798, -696, -419, 20, 316, 513, 702, 463, -349, -924, -929, -1463, -2768, -2474, 1357, 6629, 9105, 7147, 2567, -2347, -6636, -9611, -9656, -5131, 3123, 10584, 11721, 5207, -3911, -8542, -6321, -1108, 2284, 3132, 3476, 3468, 1071, -3140, -4457, -317, 4528, 3658, -1785, -4730, -2081, 2392, 4466, 3527, 822, -1856, -2369, -264, 2308, 3102, 1446, -2190, -5508, -4958, -395, 3357, 2768, 29, -1310, -844, 595, 2593, 3557, 1987, -499, -1540, -2245, -4547, -6075, -2745, 4232, 8511, 6294, 373, -4360, -6190, -5778, -3384, 249, 2775, 2860, 2013, 1844, 1717, 478, -1814, -4586, -6727, -5966, -1061, 5512, 9483, 9198, 6189, 2095, -2756, -7622, -9853, -6572, 1471, 8831, 10389, 6742, 1722, -3346, -8068, -8799, -3294, 3260, 4628, 2587, 2074, 2062, -591, -3377, -2305, 722, 1613, 1075, 2048, 3501, 1941, -2487, -5190, -2770, 2367, 4666, 2439, -582, -1611, -2319, -3546, -2354, 1537, 2985, 86, -1581, 1293, 3543, 570, -3854, -3992, -14, 4226, 6077, 4608, 372, -4335, -7068, -6593, -2683, 2863, 5898, 4293, 1259, 515, 713, -1024, -3210, -2572, 34, 985, -474, -1550, -45, 2918, 4091, 1650, -2457, -4714, -4235, -2576, -108, 3641, 6504, 5122, 40, -4698, -6794, -6739, -4591, 282, 6464, 10191, 8141, 518, -7614, -9653, -4664, 730, 670, -2390, -1880, 3785, 9934, 11420, 6801, -1535, -8964, -11443, -8481, -2955, 2313, 6689, 9995, 10292, 5474, -2965, -9717, -10472, -6061, -753, 2745, 5229, 8037, 9665, 6801, -1041, -9440, -12922, -10023, -3423, 3425, 8051, 9008, 6625, 2924, -706, -4590, -8292, -8985, -4439, 3178, 8393, 7475, 1731, -4105, -6052, -3791, -379, 869, -123, -252, 2503, 5823, 5649, 1432, -3196, -4862, -3568, -1049, 1636, 3562, 3190, 465, -1911, -1664, -88, 265, -610, -1122, -1137, -1440, -1461, -213, 1378, 1642, 1136, 1687, 2560, 859, -3370, -5822, -3578, 775, 2935, 2393, 1618, 1503, 595, -1567, -3073, -2178, 607, 3348, 4103, 1920, -1528, -2440, 427, 3238, 2354, -426, -1546, -1530, -2719, -4019, -2740, 191, 1276, -70, -560, 1951, 4627, 2747, -3454, -7821, -6048, -1240, 1724, 3412, 6008, 6314, 161, -8489, -10758, -4719, 2736, 6099, 6801, 7159, 5089, -1173, -7596, -8668, -4579, 365, 3906, 5883, 4988, 419, -4975, -7151, -5176, -1021, 3038, 5488, 5657, 3555, -241, -3525, -2882, 1357, 3225, -530, -4035, -1102, 4371, 4916, 1006, -2105, -3259, -3709, -2685, -641, -657, -2311, -781, 4773, 8190, 4460, -3634, -8895, -7214, -1115, 3462, 3975, 3362, 4094, 3847, 377, -3583, -4449, -2649, -129, 2210, 2729, 558, -762, 2000, 4701, 1254, -5936, -8932, -5346, 420, 4249, 4922, 2618, -886, -2867, -2806, -2450, -1974, 634, 5272, 7937, 5368, -153, -3058, -1496, 343, -1635, -5220, -4959, -270, 3739, 3821, 2424, 2424, 2212, -954, -5518, -6996, -3588, 2204, 6693, 7230, 2578, -5253, -10025, -6545, 2434, 8540, 7557, 2901, -959, -3732, -6388, -7183, -3534, 3632, 9610, 9982, 4371, -3514, -8932, -9475, -6315, -2484, 235, 2486, 5310, 7796, 7639, 3702, -2538, -7726, -8607, -4405, 1912, 5509, 4073, 266, -1149, 1007, 2700, 229, -3676, -3071, 1695, 3242, -1779, -7073, -5903, -100, 4335, 5286, 4281, 2650, 1011, -527, -2730, -5340, -5773, -2514, 1739, 3373, 2775, 2908, 3956, 2876, -1283, -4917, -4403, -595, 3102, 4700, 4047, 1922, -50, -936, -1941, -3726, -3841, -407, 3628, 3970, 943, -1850, -2990, -3407, -2437, 1773, 7580, 9491, 4496, -3577, -8146, -6814, -2378, 1603, 3734, 3827, 1979, -609, -2243, -2990, -3903, -3875, -1262, 1615, 1281, -136, 1699, 4218, 1232, -5692, -8554, -4782, 766, 4213, 5663, 5541, 3847, 1580, -696, -3651, -6597, -6822, -3213, 1566, 3983, 3486, 2296, 1879, 953, -2253, -6535, -8127, -4821, 1517, 6920, 8658, 6408, 1603, -3268, -5690, -4908, -2575, -707, 687, 2745, 4927, 5001, 2244, -1235, -3269, -3929, -3997, -2958, -138, 3287, 5109, 4389, 1877, -1335, -4286, -5432, -3155, 1782, 5295, 3776, -982, -3206, -493, 3093, 2898, -351, -2869, -3333, -3097, -2726, -1309, 1432, 4031, 4339, 1711, -1775, -3295, -2567, -1351, -167, 1598, 2985, 2440, 715, -522, -1329, -1766, -414, 2317, 2999, 218, -2854, -3257, -1805, -144, 1836, 3833, 3755, 666, -2990, -3991, -1980, 857, 2774, 3512, 3020, 1156, -1248, -2660, -2472, -1139, 1021, 3476, 4151, 1035, -4089, -5962, -1908, 3967, 5250, 1262, -2319, -1493, 756, -484, -4587, -6671, -4377, 597, 5772, 8666, 6716, 618, -4566, -5108, -2801, -1047, -290, 563, 1577, 2296, 2360, 1144, -1160, -2720, -2373, -1665, -2318, -2690, 306, 5721, 8132, 4204, -2749, -6713, -5493, -1341, 2803, 5231, 5157, 3027, 482, -1475, -3470, -5728, -6312, -3358, 1519, 4353, 3654, 2018, 1962, 2126, -329, -4681, -6780, -4325, 600, 4677, 6227, 4648, 509, -3260, -3797, -1895, -121, 988, 1560, 398, -1921, -2049, 625, 2174, 646, -887, -86, 1173, 843, -248, -650, -293, 187, 174, -487, -827, 230, 1930, 2492, 1807, 1320, 1211, -4, -2557, -3983, -1999, 2032, 4088, 2280, -695, -1139, 619, 961, -1457, -3559, -2177, 1753, 4774, 5008, 3054, 83, -2881, -4356, -3304, -854, 793, 1388, 2411, 3769, 3460, 877, -2325, -4814, -6240, -5677, -2345, 2401, 6146, 7726, 6942, 3660, -1343, -6118, -8787, -8059, -3588, 2631, 7157, 8788, 8608, 6030, -502, -8335, -11635, -8425, -1891, 4553, 8750, 8569, 4211, -609, -3343, -5056, -6131, -4416, 426, 5331, 7532, 6181, 1394, -4723, -8071, -6641, -2302, 2624, 6862, 7898, 3303, -4505, -9270, -7800, -2652, 2373, 5988, 7902, 6745, 1584, -5501, -10075, -9061, -3418, 3062, 6903, 6532, 2685, -1092, -812, 2191, 1272, -5632, -10486, -5645, 4421, 9260, 6668, 2963, 1625, -112, -3765, -6022, -4288, -572, 2390, 4641, 5975, 3658, -2798, -7923, -6220, 6, 3398, 1235, -1782, -661, 3428, 5308, 2486, -2366, -5102, -4312, -1485, 1439, 3587, 4930, 5453, 4467, 928, -4869, -9975, -10375, -4842, 3249, 8831, 9536, 6234, 327, -6777, -11661, -10243, -2905, 4562, 7312, 6261, 4484, 1676, -3715, -8546, -6923, 1024, 7891, 8520, 5222, 1412, -3143, -7680, -8047, -2988, 2846, 5041, 3878, 1400, -1320, -3162, -2857, -520, 2298, 3629, 2185, -891, -2361, -894, 1042, 1224, 890, 1469, 1192, -1822, -5328, -5348, -1801, 1666, 3067, 3465, 2973, 287, -3167, -4124, -3067, -2812, -1914, 2784, 7589, 5187, -2849, -6191, -820, 4778, 2807, -2410, -2926, -217, -508, -2374, -48, 4723, 5374, 2066, 33, -499, -3027, -6165, -5020, 376, 4797, 5142, 3036, 520, -2347, -4797, -4241, -28, 4513, 5758, 3395, -702, -4448, -5485, -2375, 2719, 5086, 2709, -1335, -3066, -2242, -968, 92, 1078, 672, -1656, -3297, -2062, 556, 2548, 3725, 3045, -702, -4517, -4009, -365, 2034, 2697, 3055, 1645, -2103, -4308, -2604, -47, 990, 2348, 4343, 3357, -1460, -4990, -3104, 1205, 2165, -764, -2673, -331, 3756, 5075, 2427, -1674, -4214, -4029, -1869, 886, 3537, 5846, 6559, 3444, -3614, -10158, -10265, -3109, 5472, 9030, 6432, 1063, -3311, -4665, -3085, -507, 1313, 2722, 4314, 4042, -591, -7252, -9339, -3710, 4571, 7718, 4107, -983, -2791, -1942, -1219, -811, 592, 2128, 1706, -201, -1251, -1139, -1377, -1941, -1631, -790, -355, 302, 1702, 2532, 2028, 1407, 932, -1226, -5103, -6969, -3695, 2834, 7635, 7866, 4715, 688, -3117, -6209, -6744, -2907, 3571, 7709, 6366, 1499, -2701, -4245, -3724, -2030, 191, 1611, 1062, -480, -727, 638, 1423, 367, -1092, -1332, -474, 783, 1743, 986, -1898, -4170, -2837, 919, 3410, 3419, 2516, 1635, -11, -3263, -7097, -7993, -3065, 4674, 7777, 3665, -1871, -3186, -1459, -79, 748, 1597, 1328, -166, -949, -276, 439, 338, 29, -27, -56, -240, -610, -1111, -1384, -1100, -540, -152, 390, 1764, 3273, 2861, -43, -3115, -4083, -3184, -869, 3564, 8281, 8002, 852, -7480, -10362, -7662, -3156, 1677, 6936, 10046, 7461, 331, -5636, -6665, -4055, -684, 1989, 3012, 2017, 864, 1584, 2522, 404, -3569, -4209, -257, 2871, 1260, -1388, -571, 1213, 246, -482, 2452, 4639, 1121, -4173, -4941, -2032, 482, 1753, 1917, 604, -135, 1703, 3259, 1143, -2165, -2514, -784, 104, 549, 1940, 2813, 1157, -2038, -3959, -3157, -374, 2634, 4370, 4221, 2441, -357, -3565, -6151, -6153, -1969, 4944, 9964, 9202, 2912, -5206, -10546, -9781, -3257, 4428, 8377, 7709, 4413, -269, -5538, -8857, -7517, -2038, 4075, 7570, 7550, 5140, 1840, -1757, -5303, -7147, -5424, -942, 3218, 5367, 6074, 5378, 2221, -2731, -6537, -7038, -4669, -1092, 2398, 5150, 6589, 5482, 946, -4728, -6811, -3998, -497, 347, 375, 1775, 2983, 2440, 1364, 410, -1501, -3789, -4289, -2566, 533, 4471, 7033, 4723, -1689, -6429, -5928, -2347, 1298, 4463, 6502, 5513, 1168, -4214, -7824, -7880, -3894, 2509, 7548, 7879, 3733, -1047, -2657, -1373, -1013, -3273, -4524, -1085, 4411, 6231, 3524, 204, -1656, -3075, -3899, -2599, 215, 2181, 2536, 2238, 1661, 252, -2080, -3997, -3215, 792, 4616, 4263, 782, -1316, -966, -973, -2015, -1863, -343, 489, 761, 2168, 3517, 1834, -2254, -4573, -3307, -1297, -1297, -1680, 835, 5464, 7315, 3578, -2738, -6535, -6156, -3577, -684, 2245, 4810, 5572, 3873, 1063, -1462, -3905, -5671, -3650, 3054, 8743, 7000, -507, -6635, -7837, -5205, -185, 4970, 6588, 4036, 438, -2725, -5596, -5530, -685, 4341, 4585, 2342, 1503, 498, -2309, -3540, -1248, 820, 66, -745, 482, 1237, -612, -2725, -1844, 1616, 4579, 4970, 2691, -1422, -5525, -6883, -4286, 350, 4361, 6889, 7530, 4709, -1764, -7826, -8378, -3470, 1874, 4297, 4551, 3159, -436, -3546, -2299, 1041, 919, -1417, -128, 3616, 2775, -3075, -6560, -4110, 29, 1935, 2641, 3302, 2188, -842, -2141, -90, 1467, -364, -2378, -1044, 1456, 1674, 567, 418, 578, -160, -910, -1050, -1700, -2812, -1976, 1685, 4831, 3815, -175, -2766, -2277, -748, 237, 1129, 1925, 1589, 103, -1274, -1642, -1113, -507, -512, -295, 1549, 3646, 2801, -367, -1736, -958, -2017, -4987, -4680, 483, 5360, 5769, 3117, 48, -2816, -4439, -2843, 953, 2608, 511, -1509, -395, 1233, 404, -329, 2140, 4484, 1456, -5013, -7586, -3449, 2546, 4722, 2733, 50, -999, -981, -1440, -2659, -2835, 166, 4845, 5680, 97, -6419, -6915, -2089, 2208, 3364, 2643, 1071, -506, -720, -171, -919, -2340, -1870, 246, 1494, 1206, 239, -1248, -2574, -2028, 177, 1641, 1549, 1249, 986, -250, -1815, -1843, -430, 501, 363, 440, 1239, 1561, 678, -550, -1472, -2471, -3068, -1602, 1547, 2919, 587, -2233, -1313, 2215, 3317, 529, -2220, -2087, -1119, -1486, -1189, 1905, 4995, 3519, -1991, -6050, -5066, -1138, 1601, 1952, 1497, 1348, 947, -530, -2658, -3517, -1593, 1451, 2042, -103, -1324, -103, 703, -488, -1367, -545, 387, 789, 1686, 2205, 366, -2707, -3770, -2024, 525, 2070, 2083, 936, -217, -490, -328, -339, -151, 210, -394, -2040, -2801, -1336, 1335, 3325, 3553, 1822, -1006, -2972, -2675, -911, 512, 1170, 1823, 2187, 934, -1601, -2982, -2055, -490, 340, 1230, 2425, 2297, 438, -1088, -1217, -1411, -2244, -1754, 886, 2944, 1830, -787, -1428, -31, 416, -949, -1568, 98, 1981, 1656, -226, -1442, -1280, -378, 965, 2279, 1999, -496, -2905, -2649, -681, 125, -404, 91, 2065, 2982, 1263, -1237, -1907, -927, -544, -1345, -1199, 1277, 3901, 3515, 491, -1768, -1483, -178, 175, -617, -1731, -2231, -1234, 1068, 2845, 2574, 977, -206, -471, -597, -1214, -1914, -1528, 234, 1628, 1135, 353, 1448, 2680, 1015, -2097, -2908, -1562, -527, 514, 2477, 3069, 666, -1781, -1497, -430, -1162, -2347, -1518, 886, 2747, 3069, 2150, 498, -1496, -3212, -3416, -1135, 2402, 4090, 2592, 60, -1148, -1293, -1334, -849, 323, 869, 185, -349, 362, 1461, 1693, 1004, -133, -1499, -2480, -1993, -113, 1323, 1009, 32, -18, 476, 420, 243, 756, 1163, 343, -1086, -1718, -1206, -17, 1419, 2427, 2070, 304, -1587, -2219, -1391, 79, 1352, 2002, 1767, 565, -1017, -1792, -1052, 599, 1848, 1965, 1189, 69, -1043, -1728, -1362, 159, 1729, 1823, 261, -1382, -1515, -189, 1232, 1523, 536, -739, -1106, -516, 6, 114, 562, 1437, 1653, 880, 103, -253, -797, -1461, -1343, -362, 654, 1312, 1595, 1110, -236, -1490, -1717, -1145, -474, 206, 1057, 1704, 1548, 634, -200, -257, 32, -322, -1143, -1170, -387, -238, -663, 213, 2218, 2570, 696, -465, 289, 332, -1614, -2593, -332, 2551, 2366, -164, -1385, -311, 612, -45, -816, -438, 255, 481, 952, 2045, 2499, 993, -1898, -3855, -2870, 475, 3117, 2837, 884, 16, 703, 1009, -188, -1713, -1964, -849, 657, 1786, 2095, 1298, -144, -935, -430, 316, -31, -1159, -1500, -289, 1667, 3014, 2878, 1133, -1343, -2777, -2102, -507, -30, -538, -9, 1983, 3310, 2470, 639, -446, -879, -1627, -2434, -2028, -88, 2038, 2722, 1650, -84, -1110, -925, -152, 263, 148, 148, 517, 435, -723, -1811, -996, 1305, 2340, 742, -1467, -1904, -906, -40, 546, 1374, 1834, 1074, -345, -1144, -998, -693, -871, -1106, -348, 1506, 2874, 2099, -421, -2586, -2928, -1728, -81, 1171, 1632, 1325, 684, 70, -673, -1730, -2429, -1704, 305, 2001, 2207, 1420, 596, -202, -1175, -1837, -1685, -1010, -308, 445, 1377, 2080, 1839, 390, -1554, -2630, -2078, -620, 479, 960, 1385, 1781, 1469, 200, -1326, -2127, -1713, -417, 827, 1302, 1142, 819, 331, -532, -1408, -1600, -979, -48, 698, 1022, 727, -198, -1215, -1482, -661, 630, 1355, 996, -59, -1074, -1556, -1239, -108, 1101, 1217, 188, -594, -307, 223, 165, -191, -585, -1218, -1568, -789, 525, 982, 632, 534, 620, 17, -1087, -1673, -1426, -854, -352, 83, 582, 1060, 994, 3, -1213, -1522, -1035, -841, -975, -375, 983, 1681, 973, -215, -754, -634, -582, -993, -1419, -1059, 59, 829, 532, -75, -20, 303, -97, -1012, -1303, -744, -311, -429, -235, 788, 1590, 1016, -442, -1417, -1402, -783, -73, 188, -280, -772, -215, 1149, 1793, 899, -653, -1600, -1677, -1294, -640, 187, 734, 702, 418, 134, -387, -905, -601, 284, 332, -653, -1008, 109, 1263, 985, -194, -910, -869, -664, -563, -385, -100, 176, 525, 890, 752, -127, -1041, -1196, -758, -278, 203, 731, 881, 465, 64, 93, -4, -772, -1486, -989, 426, 1262, 953, 354, -1, -524, -1193, -1236, -481, 365, 798, 778, 365, -89, -138, -79, -518, -1059, -831, -105, 163, 23, 205, 591, 454, -100, -302, -118, -254, -691, -510, 435, 1000, 546, -116, -318, -483, -769, -490, 354, 740, 362, 67, 240, 311, 2, -242, -135, 112, 268, 273, 88, -199, -253, 109, 489, 345, -162, -391, -238, -130, -75, 254, 589, 389, -36, 62, 559, 632, 66, -557, -731, -413, 176, 704, 898, 794, 606, 353, -110, -676, -918, -569, 124, 667, 833, 778, 679, 466, 26, -469, -698, -582, -322, -67, 154, 318, 485, 757, 852, 287, -627, -882, -267, 278, 244, 204, 513, 689, 447, 101, -210, -610, -816, -391, 431, 945, 798, 204, -385, -613, -488, -269, 42, 627, 1116, 842, 2, -471, -304, -47, 69, 267, 425, 340, 407, 922, 1208, 541, -562, -983, -532, 11, 163, 209, 404, 493, 259, -17, -27, 118, 195, 151, -34, -281, -229, 300, 798, 696, 243, 112, 357, 400, -80, -650, -568, 290, 1073, 889, 82, -210, 216, 433, 32, -304, -125, 140, 165, 215, 400, 380, 127, 103, 384, 360, -200, -533, -5, 756, 783, 221, -80, 83, 297, 363, 302, 45, -282, -320, -53, 147, 155, 171, 226, 202, 198, 375, 537, 335, -151, -402, -136, 275, 285, -43, -85, 460, 1019, 777, -238, -1031, -758, 228, 817, 561, 114, 149, 458, 487, 208, -16, -87, -184, -316, -277, 8, 366, 626, 714, 557, 188, -97, -77, -8, -216, -450, -234, 309, 607, 452, 134, -42, -26, 20, -116, -331, -189, 349, 632, 262, -184, -30, 401, 322, -247, -496, -52, 537, 641, 297, -128, -423, -429, -58, 343, 310, 26, 41, 260, 151, -177, -144, 209, 280, -21, -146, 137, 388, 260, 44, 135, 375, 318, -68, -390, -382, -153, 54, 113, 86, 143, 316, 354, 50, -383, -529, -306, -43, 29, 60, 213, 336, 219, -18, -127, -122, -189, -315, -311, -126, 103, 236, 208, 45, -114, -135, -62, -65, -175, -222, -96, 59, 67, -10, -11, 45, 32, -38, -83, -148, -282, -355, -220, 36, 208, 170, -62, -345, -472, -355, -135, 7, 25, -49, -159, -180, -74, -23, -163, -291, -165, 70, 92, -123, -329, -360, -241, -105, -93, -205, -264, -164, -49, -52, -70, 14, 75, -55, -290, -393, -283, -102, -36, -130, -261, -280, -205, -189, -295, -390, -302, -43, 175, 143, -135, -416, -449, -227, 21, 102, 42, -28, -78, -154, -216, -176, -119, -212, -364, -303, -45, 63, -122, -333, -318, -178, -115, -114, -74, -49, -143, -279, -304, -237, -161, -45, 82, 47, -94, -30, 193, 77, -454, -756, -432, 75, 226, 100, 12, -45, -238, -495, -564, -346, -47, 42, -122, -299, -283, -142, -47, -17, 13, 28, -51, -192, -278, -266, -234, -222, -175, -68, 32, 73, 80, 51, -80, -310, -510, -585, -521, -324, -28, 227, 305, 213, 51, -154, -409, -577, -462, -118, 124, 64, -128, -205, -164, -121, -85, -52, -96, -192, -179, -23, 67, -58, -257, -285, -116, 36, -4, -191, -336, -320, -173, 11, 146, 156, 20, -179, -301, -291, -220, -173, -143, -89, -2, 67, 53, -81, -285, -424, -402, -266, -125, 14, 212, 365, 240, -154, -444, -355, -92, -13, -151, -274, -215, 4, 217, 215, -17, -245, -305, -288, -286, -241, -175, -175, -114, 167, 450, 363, -34, -366, -451, -333, -84, 135, 149, 75, 140, 217, 35, -268, -327, -121, 92, 189, 177, 53, -75, -39, 86, 48, -165, -289, -186, 4, 126, 177, 188, 127, 15, -36, -10, -36, -157, -218, -129, -9, 59, 130, 171, 80, -17, 82, 246, 133, -247, -487, -335, 34, 279, 258, 90, -7, 11, -8, -163, -314, -283, -106, 72, 214, 344, 399, 286, 49, -124, -93, 65, 137, 42, -23, 137, 387, 405, 149, -109, -180, -144, -119, -97, -31, 75, 187, 244, 209, 136, 99, 55, -79, -242, -256, -68, 179, 332, 370, 339, 238, 47, -176, -299, -228, 2, 249, 350, 265, 121, 74, 113, 87, -66, -206, -163, 36, 209, 242, 188, 150, 148, 140, 98, 30, -34, -73, -78, -51, 24, 156, 282, 302, 206, 95, 34, -34, -160, -220, -54, 249, 391, 248, 29, -40, 20, 79, 67, -10, -94, -72, 80, 216, 217, 163, 183, 233, 180, 6, -167, -181, 15, 293, 417, 304, 102, 0, 39, 137, 184, 105, -25, -40, 89, 178, 120, 51, 95, 167, 173, 153, 148, 126, 114, 179, 284, 317, 243, 92, -80, -180, -117, 59, 201, 242, 226, 178, 95, 34, 66, 158, 172, 32, -184, -281, -133, 176, 424, 483, 418, 310, 147, -72, -239, -251, -142, -22, 54, 124, 223, 311, 297, 137, -84, -223, -218, -131, -20, 148, 367, 464, 277, -36, -150, -22, 66, -16, -86, 9, 153, 202, 183, 176, 168, 100, -33, -171, -222, -112, 121, 297, 238, -7, -186, -128, 57, 154, 115, 63, 88, 142, 152, 104, 1, -139, -220, -125, 108, 286, 299, 219, 126, 1, -136, -176, -68, 65, 92, 39, 21, 50, 45, -9, -33, 2, 32, 15, 8, 47, 71, 6, -116, -177, -115, 7, 79, 57, -5, -27, -12, -51, -150, -140, 79, 312, 321, 180, 61, -92, -331, -439, -269, -26, 91, 163, 229, 171, 20, -15, 87, 152, 114, 20, -104, -174, -65, 116, 126, -9, -40, 50, 47, -85, -142, -10, 214, 355, 292, 64, -115, -93, 19, 33, -30, -61, -60, -66, -39, 26, 53, 27, 11, -10, -87, -144, -66, 102, 210, 178, 33, -156, -281, -240, -71, 91, 184, 254, 313, 261, 52, -174, -232, -118, -8, -22, -94, -117, -104, -116, -112, -29, 39, -39, -193, -206, -35, 128, 142, 80, 66, 97, 97, 51, 7, -7, 4, 25, 25, -14, -65, -77, -70, -116, -198, -207, -121, -39, -12, 23, 95, 111, 22, -63, -21, 105, 167, 112, 13, -67, -129, -144, -74, 23, 26, -60, -84, 26, 123, 58, -75, -93, -7, 23, -28, -26, 90, 208, 179, -11, -234, -304, -133, 154, 300, 184, -22, -83, -16, -25, -138, -156, 20, 261, 411, 408, 233, -60, -295, -363, -329, -265, -139, 29, 135, 148, 133, 76, -63, -205, -222, -127, -33, 4, -1, -20, -3, 50, 67, 16, -8, 53, 115, 100, 65, 76, 93, 72, 57, 104, 204, 300, 319, 154, -228, -632, -703, -316, 210, 448, 325, 101, -22, -71, -115, -133, -114, -112, -114, -28, 143, 241, 177, 85, 83, 57, -146, -414, -484, -300, -63, 50, 60, 67, 104, 149, 164, 84, -134, -380, -424, -172, 158, 278, 195, 150, 206, 171, -43, -266, -362, -337, -127, 294, 639, 556, 142, -235, -448, -553, -505, -276, -28, 130, 324, 580, 644, 316, -222, -622, -754, -683, -418, 58, 562, 816, 777, 586, 266, -188, -613, -833, -850, -642, -89, 644, 1051, 830, 208, -413, -819, -930, -703, -243, 205, 500, 687, 804, 716, 294, -340, -912, -1187, -1003, -336, 501, 975, 842, 353, -127, -455, -585, -465, -184, 12, 1, -79, -62, 21, 51, 62, 141, 217, 173, 32, -155, -352, -323, 124, 631, 685, 507, 665, 947, 683, -36, -556, -707, -685, -391, 238, 780, 866, 572, 8, -743, -1258, -1131, -617, -211, 64, 368, 512, 306, -1, -127, -155, -264, -381, -337, -128, 80, 129, 2, -140, -138, -17, 50, -21, -159, -247, -222, -103, 22, 102, 198, 389, 589, 605, 386, 107, -67, -171, -313, -455, -448, -247, 61, 382, 587, 494, 129, -207, -327, -369, -452, -421, -205, -35, -54, -51, 123, 175, -171, -587, -520, -63, 167, 17, -18, 302, 612, 605, 407, 164, -109, -281, -232, -112, -90, -101, -74, -96, -159, -154, -176, -423, -784, -899, -640, -238, 58, 215, 263, 153, -104, -343, -428, -407, -344, -251, -252, -440, -551, -292, 80, 129, -53, -159, -318, -679, -795, -240, 639, 1251, 1532, 1621, 1348, 557, -423, -1018, -915, -222, 717, 1611, 2336, 2723, 2403, 1148, -667, -2241, -3021, -2976, -2244, -873, 832, 2070, 2130, 1169, 32, -652, -837, -708, -427, -179, -26, 290, 984, 1663, 1580, 614, -478, -1020, -1186, -1447, -1652, -1261, -235, 843, 1372, 1094, 85, -1175, -1894, -1538, -374, 748, 1208, 1141, 1105, 1229, 977, -20, -1278, -2043, -2125, -1715, -906, 0, 373, 67, -281, -273, -234, -377, -401, -191, -27, 62, 375, 954, 1541, 1886, 1710, 819, -465, -1433, -1731, -1552, -1072, -240, 945, 2303, 3479, 3880, 2908, 651, -1865, -3253, -2592, -49, 2994, 4753, 4415, 2443, -458, -3875, -6989, -8337, -6946, -3329, 818, 3625, 4072, 2620, 681, -707, -1378, -1432, -1007, -569, -386, 201, 1929, 4038, 4664, 3114, 744, -903, -1838, -2697, -2976, -1587, 1154, 3394, 3716, 2302, 51, -2482, -4791, -5973, -5419, -3391, -312, 3474, 6453, 6290, 2865, -902, -2610, -2531, -1379, 906, 3300, 3911, 2775, 1452, 206, -1410, -2219, -786, 1874, 3540, 3601, 2822, 1661, 418, -51, 819, 2363, 3345, 3237, 2273, 693, -1346, -3138, -3579, -2357, -500, 665, 677, -206, -1672, -3117, -3355, -1679, 863, 2379, 2258, 1366, 366, -806, -1854, -1838, -207, 2492, 4826, 5306, 3725, 1580, 381, 88, 156, 744, 1573, 1350, -109, -994, -121, 1398, 2053, 1708, 1223, 1900, 4635, 7920, 8227, 4254, -948, -3742, -3842, -3179, -2883, -2634, -1642, 353, 2223, 1888, -1316, -5260, -7303, -7340, -6931, -5890, -2415, 2868, 5950, 4375, 684, -1455, -2409, -4704, -7542, -7320, -3701, -796, -848, -1068, 744, 1901, -287, -3374, -3671, -1988, -1377, -1833, -1168, 578, 1185, 47, -1080, -1293, -1876, -3560, -4730, -3628, -672, 2069, 2377, -480, -4071, -4782, -2974, -2529, -3962, -3450, -362, 712, -2410, -6036, -6365, -3407, 1317, 6039, 7905, 5176, -2, -3887, -5096, -4251, -1427, 3565, 9128, 12087, 10288, 4461, -2627, -8352, -10990, -8984, -1774, 7508, 12723, 10479, 3356, -4074, -9377, -10737, -6114, 2894, 10395, 12204, 9225, 4109, -1239, -4878, -5835, -5336, -4177, -1341, 2664, 5163, 5462, 4976, 3332, -212, -3052, -2692, -1164, -740, 460, 3778, 6375, 6263, 5264, 4386, 2272, -522, -1496, -540, 587, 1828, 3606, 4162, 1683, -2803, -6589, -7563, -5220, -1573, -13, -1172, -1996, -786, -33, -1991, -4705, -4993, -2922, -1140, -1440, -3382, -5255, -5715, -4957, -4249, -4107, -3679, -2291, -771, -865, -3576, -7664, -9702, -7123, -1723, 1831, 1370, -1112, -3054, -3690, -3239, -2625, -2984, -3112, 63, 6051, 9400, 6449, -111, -5676, -8735, -9117, -5484, 1749, 7736, 7789, 3451, -201, -1868, -3353, -3578, -467, 2984, 2519, 237, 574, 2270, 2046, 1537, 3087, 3870, 1040, -2163, -1340, 2178, 4319, 4666, 5113, 4691, 1340, -2552, -2629, 29, 785, -124, 1204, 4086, 4504, 2784, 2054, 1747, -114, -1523, 256, 3359, 4182, 2643, 1033, 286, 125, 809, 2122, 2256, 528, -329, 1676, 3276, 624, -3694, -4359, -1345, 1906, 4573, 6696, 6069, 2285, -1114, -2118, -2215, -1593, 1062, 4024, 4309, 2855, 2276, 1912, -18, -2355, -2875, -1369, 1281, 4118, 5366, 3665, 368, -1831, -2336, -2537, -2813, -2035, -196, 912, 474, -152, -293, -1446, -4084, -5701, -4384, -1851, -496, 353, 2553, 5222, 5583, 2997, -371, -2749, -4046, -4041, -2249, 199, 1696, 2889, 4910, 6002, 4034, 771, -702, -883, -1902, -2848, -1187, 2793, 6306, 7573, 6641, 3939, 224, -2530, -2230, 893, 4095, 4839, 2899, -358, -3525, -5516, -5630, -3988, -1483, 929, 2504, 2644, 1530, 708, 1595, 3049, 2353, -391, -1413, 1226, 3966, 2432, -2356, -5469, -4151, 22, 3782, 4986, 3624, 1286, -638, -2333, -4402, -5718, -4035, 732, 5430, 7032, 5850, 3925, 1695, -1507, -4647, -5393, -3341, -675, 841, 1512, 1639, 177, -2733, -4316, -2834, -328, 737, 508, -501, -2309, -2927, -568, 1585, -436, -3884, -3541, -495, 1093, 1454, 2128, 1248, -1841, -3717, -2939, -2122, -1928, -307, 2001, 2261, 978, 312, -411, -2499, -4146, -3203, -1068, -538, -1841, -2902, -2181, -165, 1321, 1065, -91, -240, 1157, 2673, 2651, 716, -2097, -3973, -3708, -2038, -589, 482, 2018, 3325, 2765, 786, -500, -615, -784, -1181, -850, 120, 671, 487, 132, 233, 1174, 2556, 3047, 2068, 920, 878, 1416, 1537, 1141, 221, -1274, -2382, -2110, -1122, -251, 1175, 3004, 2659, -1221, -5979, -8183, -7059, -3411, 1622, 5777, 6786, 4691, 982, -3192, -6129, -5658, -2244, 954, 2455, 3576, 4627, 3840, 622, -3315, -6099, -6664, -4583, -828, 2528, 4439, 5189, 4522, 1819, -1754, -3694, -3008, -992, 734, 1514, 1254, 219, -642, -332, 844, 1265, -138, -2474, -3900, -3631, -2259, -524, 1212, 2300, 1862, 46, -1602, -1720, -606, 455, 840, 819, 424, -745, -2219, -2370, -366, 2493, 4307, 4306, 2402, -1087, -4436, -5543, -4685, -3743, -2701, -191, 2809, 3656, 2272, 1131, 1219, 1148, 128, -808, -703, 45, 564, 565, 237, -48, 238, 1118, 1433, 264, -1068, -530, 1286, 1982, 1214, 817, 1420, 1872, 1528, 700, -297, -691, 645, 3160, 4401, 3066, 659, -730, -808, -559, -544, -395, 429, 1750, 2636, 2338, 1068, -319, -1182, -1406, -1195, -963, -1219, -2040, -2591, -1896, -423, 129, -710, -1212, -92, 1197, 543, -1656, -3238, -3411, -3264, -3459, -3156, -1573, 577, 1834, 1516, -46, -2168, -4077, -5092, -4988, -3824, -1637, 918, 2403, 2295, 1710, 1231, -75, -2108, -2764, -1268, 125, -443, -1656, -1298, 566, 2066, 1852, 11, -2404, -4007, -3803, -1979, 298, 2160, 3401, 3282, 710, -3344, -5651, -4558, -1936, 80, 1618, 3084, 3657, 2964, 1591, -366, -2778, -4102, -3004, -392, 2044, 3691, 4160, 2896, 602, -1151, -2072, -2889, -3528, -3535, -3185, -2514, -830, 1553, 2999, 2859, 2145, 1511, 579, -643, -1501, -1749, -1498, -541, 1128, 2635, 3023, 2329, 1200, -129, -1768, -3308, -3948, -3484, -2348, -679, 1660, 4044, 5235, 4856, 3725, 2517, 1079, -646, -1956, -2229, -1747, -1008, 91, 1542, 2407, 1908, 627, -480, -1283, -1640, -821, 1109, 2853, 3608, 3611, 2818, 1090, -515, -786, -301, -371, -777, -362, 873, 1768, 1496, 180, -1366, -2151, -1786, -779, 324, 1547, 2834, 3574, 3367, 2630, 1976, 1530, 1196, 1106, 1416, 1906, 2167, 2130, 2209, 2828, 3936, 4948, 5124, 4256, 3049, 2483, 2659, 2783, 2492, 2497, 3479, 4994, 6077, 6466, 6501, 6143, 5045, 3637, 3067, 3744, 4886, 5752, 6158, 5765, 4323, 2555, 1420, 827, 387, 619, 1970, 3684, 4923, 5827, 6525, 6467, 5538, 4542, 4016, 3672, 3250, 2969, 2979, 3024, 2720, 1879, 651, -533, -1327, -1717, -1732, -1136, 219, 1912, 3096, 3096, 1870, 151, -1009, -1227, -1138, -1446, -1997, -2260, -2188, -2117, -2243, -2580, -3010, -3144, -2701, -2138, -2286, -3224, -4110, -4314, -4159, -4197, -4316, -4126, -3850, -4104, -4918, -5707, -6125, -6302, -6220, -5573, -4350, -3106, -2461, -2544, -3028, -3598, -4293, -5302, -6479, -7286, -7310, -6695, -5948, -5467, -5302, -5259, -5130, -4833, -4394, -3784, -2930, -1929, -1247, -1421, -2384, -3364, -3758, -3821, -4061, -4427, -4638, -4745, -4776, -4505, -4087, -4009, -4123, -3798, -3091, -2529, -2042, -1419, -1132, -1465, -1808, -1888, -2316, -3086, -3197, -2405, -1669, -1480, -1410, -1331, -1541, -1769, -1388, -462, 350, 629, 328, -506, -1635, -2525, -2741, -2346, -1838, -1680, -1828, -1801, -1359, -884, -785, -894, -890, -855, -900, -779, -419, -207, -314, -448, -560, -967, -1625, -2165, -2496, -2608, -2197, -1264, -466, -234, -302, -491, -980, -1518, -1417, -638, -13, -154, -821, -1496, -1968, -2189, -2059, -1646, -1252, -995, -592, 71, 487, 109, -878, -1762, -2035, -1680, -1067, -721, -865, -1110, -957, -436, 103, 582, 1144, 1765, 2242, 2409, 2155, 1498, 746, 335, 369, 521, 445, 171, 0, 143, 536, 924, 1126, 1161, 1181, 1343, 1743, 2318, 2843, 3235, 3690, 4223, 4364, 3834, 3174, 3023, 3191, 3172, 3016, 2973, 2855, 2499, 2258, 2427, 2744, 2933, 3208, 3849, 4670, 5247, 5383, 5107, 4457, 3543, 2724, 2346, 2406, 2721, 3217, 3760, 4016, 3896, 3750, 3776, 3706, 3367, 3000, 2801, 2659, 2490, 2371, 2264, 2054, 1898, 2102, 2613, 2950, 2771, 2256, 1772, 1414, 1128, 965, 939, 909, 847, 810, 604, 59, -434, -432, -266, -544, -1106, -1353, -1186, -828, -287, 351, 701, 666, 644, 806, 806, 408, -142, -528, -716, -883, -1226, -1848, -2595, -3028, -2775, -1991, -1289, -1136, -1473, -1999, -2510, -2843, -2841, -2593, -2371, -2217, -1888, -1302, -743, -598, -1043, -1901, -2688, -2983, -2841, -2702, -2800, -2948, -2926, -2813, -2760, -2689, -2458, -2177, -2085, -2182, -2298, -2480, -2922, -3500, -3773, -3486, -2814, -2138, -1727, -1640, -1736, -1850, -1982, -2254, -2667, -3059, -3301, -3404, -3333, -2953, -2345, -1979, -2166, -2541, -2561, -2292, -2151, -2207, -2296, -2437, -2587, -2436, -1924, -1415, -1092, -721, -265, -55, -263, -724, -1266, -1781, -2112, -2228, -2343, -2570, -2724, -2677, -2635, -2838, -3139, -3090, -2478, -1663, -1270, -1448, -1712, -1702, -1742, -2238, -2951, -3409, -3670, -4076, -4548, -4674, -4271, -3499, -2610, -1828, -1201, -510, 458, 1557, 2433, 3014, 3509, 3941, 4024, 3647, 3152, 2868, 2718, 2598, 2702, 3116, 3607, 4158, 5099, 6337, 7269, 7690, 8042, 8557, 8988, 9268, 9710, 10433, 11107, 11399, 11310, 11113, 11092, 11294, 11454, 11320, 11061, 11189, 11855, 12521, 12709, 12796, 13407, 14227, 14370, 13760, 13201, 13174, 13385, 13413, 13130, 12640, 12345, 12642, 13286, 13571, 13313, 13081, 13234, 13396, 13103, 12481, 11991, 11747, 11444, 10836, 10050, 9378, 8916, 8572, 8271, 8014, 7730, 7332, 6869, 6492, 6211, 5875, 5414, 4910, 4488, 4237, 4145, 3946, 3288, 2201, 1176, 582, 238, -292, -1205, -2324, -3252, -3652, -3601, -3529, -3701, -3907, -3863, -3764, -4073, -4863, -5701, -6277, -6761, -7351, -7877, -8132, -8284, -8572, -8898, -9035, -8997, -8999, -9156, -9406, -9635, -9804, -10001, -10345, -10774, -11046, -11014, -10835, -10775, -10818, -10727, -10466, -10335, -10492, -10709, -10748, -10671, -10594, -10437, -10112, -9721, -9405, -9191, -9031, -8878, -8705, -8558, -8506, -8488, -8320, -7957, -7616, -7483, -7382, -6973, -6264, -5673, -5489, -5482, -5254, -4807, -4528, -4675, -5065, -5303, -5183, -4819, -4438, -4152, -3950, -3778, -3580, -3279, -2846, -2391, -2121, -2131, -2291, -2344, -2134, -1756, -1485, -1512, -1768, -2040, -2194, -2235, -2208, -2196, -2312, -2573, -2844, -2974, -2913, -2675, -2343, -2095, -2072, -2181, -2185, -1999, -1774, -1700, -1802, -1939, -1989, -2015, -2209, -2615, -2996, -3111, -3093, -3333, -3917, -4400, -4367, -4018, -3870, -4010, -4038, -3757, -3482, -3543, -3795, -3878, -3734, -3659, -3847, -4122, -4186, -4033, -3946, -4108, -4365, -4439, -4304, -4217, -4340, -4529, -4583, -4541, -4523, -4450, -4243, -4071, -4097, -4146, -3958, -3629, -3495, -3645, -3840, -3886, -3835, -3780, -3726, -3707, -3757, -3707, -3315, -2687, -2247, -2156, -2123, -1929, -1767, -1851, -1995, -1927, -1749, -1717, -1728, -1468, -1019, -747, -639, -262, 461, 993, 920, 532, 355, 429, 423, 264, 228, 431, 633, 695, 873, 1374, 1908, 2076, 1980, 2008, 2145, 2105, 1995, 2187, 2570, 2660, 2410, 2298, 2590, 3019, 3233, 3173, 2994, 2801, 2488, 1982, 1624, 1892, 2626, 3138, 3291, 3684, 4539, 5355, 5839, 6212, 6428, 6076, 5170, 4255, 3718, 3565, 3631, 3681, 3642, 3791, 4237, 4528, 4436, 4533, 5129, 5414, 4646, 3461, 2943, 3071, 3051, 2697, 2525, 2735, 2932, 2877, 2895, 3258, 3639, 3562, 3104, 2726, 2532, 2229, 1816, 1698, 1944, 1998, 1456, 708, 361, 395, 362, 127, -36, -28, -54, -133, 46, 578, 1085, 1251, 1268, 1443, 1701, 1748, 1474, 1020, 587, 285, 73, -90, -70, 246, 605, 715, 791, 1254, 1986, 2490, 2661, 2839, 3139, 3298, 3184, 2991, 2885, 2771, 2520, 2230, 2119, 2237, 2393, 2433, 2444, 2630, 3038, 3564, 4095, 4475, 4511, 4248, 4049, 4143, 4314, 4288, 4098, 3877, 3665, 3571, 3721, 3964, 4038, 4019, 4157, 4403, 4484, 4387, 4350, 4391, 4282, 4034, 3975, 4164, 4174, 3771, 3338, 3262, 3323, 3136, 2827, 2783, 3008, 3208, 3305, 3465, 3665, 3710, 3626, 3641, 3743, 3702, 3512, 3289, 2842, 1974, 1112, 916, 1264, 1339, 807, 259, 208, 390, 518, 890, 1507, 1552, 723, 71, 384, 867, 613, 159, 319, 615, 248, -305, -181, 95, -652, -2031, -2421, -1605, -1114, -1589, -1895, -1486, -1470, -2433, -3162, -2579, -1445, -1135, -1792, -2556, -2878, -2884, -2732, -2370, -1912, -1730, -1916, -2081, -2041, -2215, -2846, -3345, -3138, -2724, -2948, -3539, -3477, -2722, -2343, -2783, -3111, -2460, -1298, -593, -391, -24, 567, 682, 79, -438, -99, 737, 1074, 557, -261, -735, -685, -262, 234, 451, 319, 229, 528, 1024, 1292, 1288, 1293, 1375, 1339, 1180, 1146, 1264, 1358, 1590, 2162, 2485, 1963, 1418, 2009, 3030, 2898, 1897, 1529, 1827, 1739, 1376, 1514, 1788, 1423, 838, 881, 1393, 1758, 2018, 2450, 2744, 2522, 2248, 2747, 3861, 4315, 3233, 1260, -482, -2046, -4156, -6396, -7472, -7467, -8007, -9503, -10037, -8040, -4516, -1530, 306, 1778, 3375, 4747, 5419, 5351, 4763, 3747, 2264, 468, -1185, -2345, -3130, -3921, -4813, -5440, -5400, -4737, -3816, -2867, -1871, -795, 373, 1771, 3509, 5402, 7092, 8370, 9129, 9214, 8610, 7677, 6851, 6167, 5318, 4227, 3321, 3067, 3369, 3675, 3746, 4021, 4902, 6013, 6612, 6534, 6274, 6251, 6498, 6874, 7227, 7511, 8005, 9039, 10328, 11087, 10977, 10471, 10143, 10045, 9778, 8921, 7522, 6218, 5566, 5290, 4779, 4141, 4013, 4489, 4989, 5129, 5017, 4822, 4658, 4813, 5458, 6191, 6362, 5929, 5595, 5849, 6222, 5798, 4375, 2674, 1396, 431, -779, -2400, -3998, -5045, -5349, -5069, -4538, -4032, -3587, -3070, -2498, -2182, -2320, -2638, -2711, -2609, -2870, -3728, -4743, -5385, -5681, -6015, -6557, -7200, -7915, -8773, -9607, -10074, -10148, -10140, -10120, -9800, -9113, -8383, -7800, -7253, -6784, -6579, -6602, -6705, -6985, -7509, -7977, -8151, -8261, -8577, -8879, -8777, -8297, -7826, -7631, -7654, -7748, -7848, -7921, -7869, -7626, -7295, -7022, -6749, -6267, -5539, -4743, -3984, -3279, -2818, -2791, -2964, -2903, -2660, -2667, -2989, -3272, -3361, -3446, -3606, -3710, -3751, -3861, -4048, -4146, -4074, -3898, -3631, -3189, -2584, -1962, -1369, -732, -157, 67, -148, -612, -1158, -1774, -2415, -3023, -3661, -4363, -4958, -5262, -5283, -5110, -4821, -4529, -4325, -4181, -4056, -3994, -3980, -3893, -3748, -3733, -3911, -4143, -4349, -4612, -4966, -5340, -5728, -6187, -6619, -6793, -6702, -6648, -6790, -6860, -6639, -6348, -6247, -6214, -6146, -6287, -6740, -7186, -7413, -7552, -7612, -7442, -7162, -6984, -6755, -6243, -5651, -5270, -5027, -4794, -4720, -4901, -5132, -5274, -5481, -5838, -6104, -6058, -5861, -5769, -5700, -5448, -5131, -4967, -4810, -4408, -3930, -3671, -3489, -3052, -2440, -1961, -1616, -1205, -814, -748, -1010, -1231, -1188, -1106, -1271, -1563, -1616, -1364, -1076, -837, -414, 208, 622, 626, 583, 827, 1094, 1011, 771, 806, 1087, 1262, 1308, 1589, 2244, 2899, 3167, 3200, 3432, 3858, 3975, 3603, 3223, 3167, 3053, 2549, 2065, 2056, 2225, 2091, 1801, 1754, 1933, 2076, 2094, 2050, 2053, 2297, 2839, 3335, 3397, 3206, 3343, 3948, 4446, 4307, 3713, 3136, 2625, 1943, 1176, 669, 437, 172, -117, -28, 520, 1076, 1447, 2029, 2933, 3516, 3382, 3089, 3237, 3523, 3399, 3050, 2961, 3017, 2787, 2422, 2500, 3015, 3235, 2768, 2190, 2168, 2419, 2241, 1799, 1913, 2566, 2820, 2492, 2611, 3674, 4763, 5054, 4975, 5241, 5746, 6011, 5897, 5578, 5360, 5622, 6389, 7073, 7122, 6856, 7110, 8031, 8749, 8505, 7618, 6954, 6796, 6747, 6532, 6339, 6417, 6805, 7509, 8540, 9649, 10458, 11007, 11679, 12442, 12728, 12288, 11554, 10916, 10311, 9694, 9249, 8944, 8485, 7860, 7501, 7762, 8453, 8919, 8684, 8081, 7942, 8420, 8726, 8411, 8116, 8424, 8856, 8719, 8240, 8075, 8265, 8313, 7872, 7003, 6007, 5212, 4709, 4331, 3930, 3525, 3168, 2943, 2987, 3216, 3198, 2721, 2169, 1941, 1868, 1610, 1182, 802, 559, 468, 458, 340, 89, 0, 177, 228, -171, -825, -1461, -2171, -3062, -3869, -4332, -4626, -4996, -5206, -4891, -4313, -4055, -4038, -3644, -2843, -2333, -2453, -2770, -2927, -3111, -3522, -4007, -4329, -4480, -4619, -4853, -5058, -5008, -4791, -4758, -4911, -4824, -4395, -4017, -3825, -3552, -3217, -3128, -3129, -2778, -2247, -2112, -2378, -2548, -2491, -2522, -2769, -2968, -2823, -2350, -1947, -1979, -2194, -1947, -1185, -672, -868, -1211, -1019, -550, -547, -1028, -1202, -620, 179, 424, 193, 300, 1065, 1800, 1805, 1366, 1221, 1385, 1229, 545, -106, -160, 323, 751, 582, -97, -534, -101, 928, 1675, 1587, 809, -94, -516, -219, 326, 330, -419, -1343, -1830, -1870, -1770, -1642, -1482, -1463, -1734, -2016, -1915, -1539, -1285, -1217, -1189, -1309, -1644, -1931, -2064, -2307, -2667, -2852, -2999, -3444, -3803, -3414, -2658, -2593, -3286, -3648, -3100, -2369, -2255, -2507, -2546, -2503, -2664, -2709, -2372, -2068, -1986, -1710, -1409, -1877, -2789, -2735, -1578, -918, -1633, -2668, -2778, -2092, -1495, -1427, -1650, -1701, -1338, -780, -537, -772, -925, -443, 200, 55, -699, -924, -378, -71, -539, -1320, -2165, -3315, -4585, -5483, -6087, -6704, -7058, -6713, -5849, -4783, -3186, -650, 2218, 4237, 5168, 5823, 6531, 6615, 5727, 4488, 3344, 1987, 277, -1293, -2332, -2840, -2795, -2229, -1559, -1097, -459, 930, 2937, 4834, 6226, 7365, 8566, 9728, 10605, 11184, 11493, 11387, 10733, 9670, 8479, 7311, 6256, 5457, 4953, 4554, 4239, 4408, 5301, 6416, 7184, 7824, 8771, 9678, 9983, 10033, 10516, 11184, 11198, 10563, 10146, 10295, 10428, 10168, 9896, 9779, 9200, 7855, 6485, 5760, 5307, 4570, 3775, 3311, 2969, 2498, 2242, 2598, 3305, 3765, 3821, 3775, 3817, 3846, 3792, 3714, 3514, 2939, 2028, 1175, 584, -86, -1244, -2768, -4202, -5342, -6283, -7046, -7533, -7806, -7981, -7962, -7586, -6913, -6123, -5281, -4499, -4091, -4271, -4812, -5292, -5632, -6160, -7114, -8274, -9226, -9881, -10486, -11107, -11473, -11464, -11366, -11383, -11306, -10954, -10515, -10133, -9587, -8759, -8013, -7668, -7454, -6924, -6243, -5992, -6314, -6778, -7113, -7455, -7799, -7912, -7861, -7988, -8223, -8075, -7447, -6858, -6588, -6235, -5511, -4908, -4912, -5066, -4635, -3791, -3248, -3085, -2833, -2339, -1729, -1056, -550, -636, -1183, -1477, -1315, -1366, -2042, -2745, -2795, -2507, -2617, -3038, -3056, -2548, -2063, -1792, -1434, -997, -794, -711, -366, 99, 180, -127, -340, -317, -513, -1245, -2210, -2934, -3408, -3942, -4559, -4957, -5021, -4966, -4932, -4779, -4429, -4072, -3840, -3568, -3136, -2841, -3078, -3711, -4189, -4345, -4602, -5165, -5594, -5581, -5547, -5911, -6338, -6339, -6031, -5791, -5677, -5648, -5760, -5895, -5798, -5538, -5454, -5609, -5741, -5645, -5362, -5123, -5189, -5526, -5701, -5367, -4756, -4328, -4164, -4026, -3769, -3398, -3007, -2815, -2928, -3090, -3039, -2973, -3222, -3679, -3975, -3942, -3584, -2968, -2375, -2096, -1963, -1555, -875, -292, 84, 470, 964, 1403, 1582, 1420, 1168, 1319, 1938, 2360, 2062, 1453, 1282, 1621, 2043, 2301, 2381, 2328, 2351, 2701, 3286, 3792, 4132, 4384, 4521, 4563, 4681, 4881, 5017, 5124, 5275, 5223, 4801, 4410, 4509, 4937, 5242, 5288, 5113, 4748, 4470, 4688, 5265, 5513, 5111, 4560, 4449, 4679, 4773, 4624, 4502, 4492, 4436, 4324, 4294, 4277, 4121, 4000, 4229, 4586, 4438, 3712, 3180, 3354, 3664, 3364, 2646, 2120, 1785, 1358, 1126, 1476, 1975, 1831, 1133, 832, 1428, 2256, 2303, 1435, 502, 319, 827, 1361, 1492, 1383, 1424, 1769, 2171, 2160, 1537, 719, 246, -22, -605, -1427, -1928, -1966, -1687, -931, 252, 1145, 1475, 2108, 3494, 4510, 4035, 2747, 2095, 2275, 2369, 1939, 1394, 1008, 565, 120, 317, 1443, 2636, 2835, 2255, 2004, 2261, 2248, 2113, 2950, 4462, 4830, 3745, 3228, 4435, 5923, 6147, 5567, 5245, 5079, 4475, 3564, 2914, 2696, 2689, 2777, 3010, 3339, 3637, 3979, 4590, 5373, 5824, 5633, 5132, 4869, 4956, 5089, 5039, 4803, 4471, 4282, 4538, 5150, 5616, 5675, 5502, 5160, 4554, 3928, 3645, 3511, 3114, 2685, 2751, 3148, 3236, 2979, 2996, 3576, 4226, 4343, 3936, 3475, 3151, 2693, 2030, 1690, 2011, 2385, 2066, 1386, 1248, 1665, 1836, 1476, 1036, 721, 258, -346, -664, -589, -580, -960, -1389, -1321, -751, -210, -54, -129, -200, -355, -723, -1084, -1139, -1058, -1332, -2045, -2676, -2791, -2630, -2726, -3131, -3401, -3283, -3071, -3094, -3185, -2951, -2453, -2082, -1860, -1438, -872, -669, -947, -1275, -1460, -1762, -2277, -2793, -3226, -3578, -3622, -3205, -2671, -2462, -2431, -2015, -1052, -62, 313, -43, -670, -1020, -965, -814, -919, -1304, -1642, -1554, -1041, -579, -516, -471, 71, 710, 650, 153, 213, 827, 1022, 574, 200, 173, 126, 53, 219, 285, -293, -1200, -1565, -1239, -893, -857, -665, 13, 698, 868, 881, 1428, 2322, 2630, 2027, 1210, 743, 340, -316, -893, -1106, -1266, -1543, -1458, -756, 0, 260, 223, 342, 634, 831, 789, 518, 110, -223, -277, -141, -149, -367, -406, 0, 513, 620, 244, -317, -758, -835, -495, -141, -316, -959, -1375, -1105, -474, -126, -304, -780, -1240, -1452, -1307, -1026, -1063, -1449, -1593, -1114, -419, -17, 195, 441, 467, 17, -573, -841, -910, -1261, -1953, -2532, -2678, -2611, -2651, -2613, -2025, -969, -189, -125, -340, -252, 72, 264, 222, -59, -697, -1505, -1885, -1626, -1415, -1979, -3035, -3646, -3513, -3292, -3617, -4346, -4969, -5229, -5070, -4438, -3438, -2432, -1637, -828, 263, 1439, 2269, 2635, 2714, 2557, 2144, 1647, 1173, 526, -361, -1055, -1159, -909, -757, -617, -130, 548, 1013, 1567, 2913, 4731, 5874, 6249, 7007, 8411, 9310, 9218, 9078, 9385, 9306, 8329, 7213, 6664, 6240, 5340, 4359, 4101, 4565, 5105, 5516, 6143, 7101, 8072, 8878, 9556, 9966, 9946, 9755, 9794, 9881, 9411, 8305, 7255, 6745, 6445, 5915, 5294, 4874, 4552, 4160, 3752, 3356, 2958, 2776, 2969, 3176, 2966, 2546, 2446, 2711, 2904, 2740, 2329, 1897, 1513, 1065, 429, -336, -1082, -1783, -2524, -3248, -3797, -4201, -4691, -5337, -5916, -6235, -6416, -6669, -6921, -6920, -6648, -6365, -6220, -6084, -5812, -5498, -5355, -5532, -6002, -6590, -7102, -7572, -8214, -9111, -10039, -10687, -10929, -10850, -10610, -10345, -10118, -9854, -9376, -8571, -7583, -6777, -6420, -6392, -6327, -6056, -5774, -5707, -5853, -6085, -6353, -6656, -6954, -7213, -7405, -7458, -7302, -7020, -6749, -6432, -5806, -4791, -3728, -3001, -2575, -2157, -1667, -1241, -961, -852, -970, -1231, -1427, -1551, -1748, -1918, -1814, -1524, -1403, -1497, -1503, -1294, -1055, -853, -513, -61, 134, -35, -94, 326, 857, 937, 656, 493, 550, 555, 393, 165, -105, -483, -933, -1345, -1660, -1899, -2094, -2261, -2419, -2579, -2721, -2777, -2689, -2472, -2236, -2134, -2194, -2244, -2138, -2029, -2171, -2509, -2804, -3066, -3503, -4076, -4533, -4826, -5138, -5489, -5682, -5615, -5435, -5280, -5101, -4761, -4285, -3890, -3741, -3741, -3673, -3519, -3462, -3603, -3874, -4199, -4553, -4845, -4927, -4789, -4615, -4551, -4517, -4314, -3836, -3165, -2487, -1995, -1790, -1768, -1691, -1448, -1164, -1012, -1024, -1165, -1351, -1429, -1324, -1173, -1107, -982, -607, -144, 88, 132, 382, 1008, 1661, 1950, 1942, 1983, 2208, 2491, 2701, 2785, 2717, 2590, 2604, 2797, 2964, 2983, 3022, 3269, 3579, 3682, 3625, 3700, 3961, 4219, 4426, 4661, 4784, 4624, 4401, 4444, 4674, 4816, 4868, 4923, 4861, 4637, 4553, 4839, 5214, 5243, 4962, 4786, 4852, 4838, 4501, 4065, 3868, 3920, 3952, 3748, 3341, 3027, 3145, 3631, 3983, 3848, 3485, 3393, 3676, 3981, 3952, 3561, 3079, 2797, 2738, 2653, 2333, 1865, 1511, 1409, 1444, 1393, 1198, 1076, 1274, 1706, 1988, 1890, 1640, 1613, 1800, 1837, 1569, 1270, 1173, 1118, 907, 675, 586, 530, 399, 348, 481, 591, 496, 394, 540, 797, 859, 789, 923, 1290, 1555, 1589, 1628, 1798, 1918, 1919, 1986, 2127, 2045, 1640, 1319, 1479, 1912, 2081, 1903, 1824, 2154, 2702, 3114, 3264, 3271, 3324, 3501, 3659, 3670, 3657, 3803, 3996, 4019, 3941, 3991, 4204, 4447, 4600, 4513, 4138, 3788, 3880, 4358, 4721, 4655, 4328, 4096, 4212, 4658, 5065, 5031, 4613, 4259, 4198, 4213, 4079, 3852, 3645, 3397, 3029, 2701, 2676, 2943, 3083, 2727, 2104, 1800, 1926, 1944, 1514, 993, 794, 722, 401, -27, -118, 135, 242, -113, -650, -884, -817, -915, -1411, -1961, -2239, -2455, -2872, -3207, -3081, -2778, -2900, -3379, -3514, -3084, -2734, -2986, -3458, -3568, -3477, -3698, -4117, -4184, -3906, -3872, -4265, -4546, -4314, -3915, -3846, -4018, -4016, -3852, -3892, -4151, -4207, -3883, -3567, -3625, -3848, -3758, -3295, -2899, -2901, -3115, -3167, -3002, -2836, -2735, -2577, -2369, -2241, -2168, -1988, -1673, -1323, -986, -686, -537, -567, -606, -508, -385, -393, -466, -428, -289, -178, -63, 240, 728, 1087, 1104, 1033, 1271, 1711, 1827, 1465, 1082, 1020, 1097, 1111, 1182, 1318, 1287, 1164, 1350, 1879, 2260, 2176, 1836, 1588, 1535, 1572, 1528, 1299, 961, 707, 632, 693, 817, 933, 1002, 1038, 1022, 818, 402, 90, 210, 540, 491, -83, -608, -526, -40, 200, -37, -426, -692, -924, -1230, -1470, -1497, -1414, -1413, -1502, -1537, -1392, -1017, -468, -50, -98, -428, -458, -154, -184, -760, -1189, -1054, -891, -1157, -1493, -1504, -1352, -1212, -935, -513, -255, -354, -641, -759, -451, 115, 406, 212, -8, 153, 443, 533, 619, 877, 935, 539, 165, 345, 768, 718, 155, -215, 64, 603, 778, 649, 859, 1623, 2330, 2428, 2185, 2178, 2484, 2844, 3116, 3143, 2692, 1944, 1441, 1308, 1189, 997, 970, 1034, 866, 524, 359, 506, 897, 1465, 2025, 2297, 2304, 2382, 2699, 3058, 3276, 3423, 3514, 3297, 2614, 1796, 1272, 997, 609, -4, -675, -1185, -1260, -766, -162, -114, -417, -109, 1028, 1903, 1558, 468, -262, -505, -1057, -2228, -3405, -4083, -4438, -4711, -4777, -4516, -3950, -2989, -1638, -375, 263, 387, 548, 906, 1047, 603, -297, -1259, -2042, -2585, -2859, -2894, -2813, -2674, -2343, -1700, -846, 20, 820, 1583, 2276, 2787, 3079, 3238, 3389, 3606, 3861, 3956, 3622, 2909, 2284, 2147, 2357, 2509, 2461, 2399, 2597, 3188, 3983, 4558, 4796, 5149, 5949, 6728, 6742, 6075, 5558, 5595, 5631, 5091, 4297, 3935, 4025, 4022, 3750, 3576, 3767, 4151, 4437, 4489, 4363, 4201, 4049, 3805, 3448, 3162, 3016, 2828, 2500, 2159, 1856, 1550, 1369, 1385, 1264, 716, 62, -227, -291, -590, -1169, -1705, -2051, -2289, -2514, -2748, -2927, -2990, -3070, -3360, -3692, -3697, -3455, -3481, -3920, -4345, -4504, -4669, -5066, -5495, -5735, -5942, -6354, -6860, -7150, -7172, -7193, -7372, -7500, -7327, -6930, -6573, -6299, -5967, -5647, -5559, -5657, -5634, -5446, -5429, -5797, -6320, -6635, -6683, -6681, -6809, -6976, -6965, -6720, -6420, -6176, -5839, -5265, -4619, -4200, -3973, -3592, -2961, -2474, -2434, -2570, -2521, -2441, -2623, -2887, -2901, -2783, -2825, -2911, -2706, -2232, -1793, -1528, -1311, -968, -469, 19, 317, 450, 578, 709, 720, 638, 613, 628, 536, 353, 226, 162, 52, -86, -137, -85, -39, -83, -176, -191, -52, 140, 215, 188, 203, 244, 203, 149, 178, 104, -253, -668, -835, -896, -1149, -1526, -1778, -1947, -2217, -2522, -2669, -2684, -2756, -2891, -2924, -2820, -2720, -2650, -2504, -2316, -2247, -2269, -2245, -2252, -2443, -2731, -2963, -3226, -3615, -3980, -4184, -4324, -4484, -4549, -4420, -4160, -3837, -3438, -3005, -2657, -2412, -2176, -1915, -1739, -1719, -1786, -1841, -1929, -2145, -2402, -2479, -2359, -2296, -2372, -2304, -1947, -1625, -1538, -1338, -785, -276, -146, -56, 356, 819, 957, 941, 1088, 1317, 1382, 1333, 1368, 1489, 1541, 1492, 1479, 1593, 1756, 1902, 2116, 2465, 2795, 2944, 3060, 3407, 3880, 4071, 3891, 3720, 3857, 4130, 4218, 4099, 3986, 4009, 4128, 4281, 4443, 4571, 4605, 4530, 4375, 4194, 4083, 4103, 4110, 3889, 3514, 3322, 3440, 3690, 3931, 4145, 4211, 4054, 3896, 3968, 4106, 3998, 3640, 3228, 2833, 2455, 2188, 2063, 1923, 1640, 1363, 1314, 1443, 1485, 1380, 1365, 1562, 1705, 1532, 1251, 1271, 1532, 1512, 996, 454, 408, 656, 557, -8, -455, -404, -217, -337, -603, -646, -489, -339, -207, -66, -1, 14, 126, 261, 197, -18, -110, -33, -33, -199, -305, -169, 70, 191, 217, 310, 477, 592, 628, 657, 667, 591, 541, 712, 1000, 1049, 810, 727, 1094, 1608, 1834, 1809, 1841, 2042, 2302, 2518, 2625, 2586, 2503, 2565, 2745, 2752, 2519, 2444, 2803, 3226, 3265, 3150, 3306, 3563, 3555, 3490, 3718, 3997, 3921, 3669, 3697, 4021, 4299, 4369, 4339, 4325, 4334, 4327, 4292, 4245, 4171, 4013, 3791, 3642, 3644, 3721, 3830, 3983, 4045, 3848, 3594, 3646, 3902, 3905, 3580, 3258, 3039, 2789, 2612, 2682, 2805, 2679, 2428, 2399, 2639, 2871, 2864, 2620, 2316, 2114, 1971, 1705, 1289, 945, 820, 742, 488, 209, 255, 597, 764, 507, 178, 177, 340, 235, -151, -448, -532, -690, -1060, -1350, -1325, -1223, -1408, -1810, -2066, -2066, -2044, -2171, -2346, -2457, -2538, -2571, -2454, -2281, -2279, -2384, -2341, -2227, -2334, -2576, -2644, -2625, -2841, -3193, -3324, -3260, -3313, -3488, -3492, -3277, -3123, -3172, -3237, -3156, -3058, -3096, -3173, -3130, -3025, -2997, -3025, -2989, -2847, -2655, -2498, -2448, -2483, -2520, -2552, -2665, -2844, -2946, -2939, -2973, -3123, -3222, -3070, -2702, -2342, -2132, -1990, -1769, -1517, -1416, -1435, -1319, -1072, -1047, -1337, -1551, -1479, -1413, -1546, -1654, -1628, -1661, -1773, -1720, -1502, -1386, -1410, -1352, -1134, -898, -749, -673, -638, -609, -564, -549, -639, -837, -1061, -1239, -1352, -1416, -1466, -1525, -1567, -1525, -1357, -1113, -903, -776, -666, -495, -333, -351, -554, -702, -615, -432, -392, -504, -622, -689, -710, -619, -389, -215, -319, -617, -778, -663, -506, -566, -759, -810, -653, -476, -420, -404, -286, -81, 62, 45, -91, -228, -276, -224, -140, -166, -386, -657, -705, -461, -188, -124, -173, -115, -5, -66, -223, -113, 322, 653, 631, 599, 867, 1169, 1191, 1148, 1338, 1592, 1607, 1400, 1174, 1068, 1162, 1355, 1390, 1267, 1270, 1423, 1471, 1478, 1759, 2151, 2153, 1798, 1621, 1785, 1917, 1812, 1668, 1622, 1536, 1360, 1294, 1462, 1665, 1642, 1436, 1297, 1356, 1553, 1791, 1988, 2057, 1994, 1903, 1856, 1785, 1649, 1582, 1638, 1548, 1082, 568, 558, 996, 1267, 1060, 667, 456, 528, 789, 967, 731, 121, -345, -260, 201, 553, 519, 178, -200, -342, -117, 348, 714, 678, 243, -267, -486, -278, 116, 242, -93, -515, -560, -392, -481, -732, -622, -177, 28, -181, -370, -216, 172, 582, 860, 869, 649, 444, 338, 54, -670, -1686, -2601, -3256, -3803, -4310, -4549, -4228, -3282, -1908, -489, 621, 1424, 2201, 2986, 3485, 3551, 3193, 2147, 236, -1760, -2573, -2116, -1780, -2550, -3568, -3390, -2053, -759, 42, 927, 2032, 2834, 3310, 3966, 4713, 4971, 4741, 4491, 4214, 3626, 3019, 2883, 2834, 1994, 551, -131, 628, 1836, 2339, 2398, 2929, 3939, 4761, 5308, 6008, 6716, 6723, 5947, 5208, 5040, 5001, 4528, 3740, 3000, 2431, 2201, 2566, 3290, 3654, 3298, 2616, 2203, 2282, 2657, 2983, 3057, 2925, 2689, 2399, 2235, 2462, 2944, 3098, 2604, 1780, 1070, 528, 22, -462, -933, -1477, -2078, -2579, -2873, -2982, -2948, -2820, -2701, -2685, -2717, -2646, -2429, -2230, -2261, -2546, -2908, -3253, -3690, -4248, -4713, -4974, -5314, -6001, -6802, -7274, -7335, -7212, -7064, -6936, -6859, -6744, -6390, -5814, -5337, -5176, -5129, -4971, -4888, -5166, -5622, -5831, -5833, -6028, -6428, -6647, -6593, -6554, -6617, -6565, -6360, -6224, -6181, -5978, -5541, -5134, -4900, -4590, -4009, -3405, -3100, -2977, -2724, -2402, -2360, -2631, -2862, -2950, -3187, -3603, -3757, -3502, -3259, -3215, -2991, -2446, -1979, -1706, -1238, -501, 55, 244, 380, 642, 810, 738, 572, 453, 298, 11, -313, -510, -571, -603, -636, -588, -409, -143, 164, 517, 891, 1199, 1339, 1297, 1207, 1217, 1305, 1277, 1030, 698, 498, 443, 378, 219, 48, -60, -162, -303, -419, -458, -502, -633, -755, -715, -551, -454, -463, -399, -182, -9, -73, -306, -492, -531, -510, -602, -902, -1293, -1528, -1563, -1616, -1813, -1994, -2020, -1990, -2015, -2000, -1818, -1535, -1280, -1059, -816, -606, -529, -545, -521, -468, -568, -907, -1308, -1541, -1597, -1635, -1730, -1795, -1734, -1531, -1219, -871, -603, -453, -294, -15, 288, 450, 478, 519, 617, 678, 646, 588, 581, 606, 586, 503, 432, 442, 523, 646, 839, 1100, 1348, 1534, 1741, 2048, 2379, 2630, 2772, 2790, 2688, 2597, 2648, 2740, 2680, 2517, 2471, 2574, 2689, 2790, 2959, 3154, 3244, 3223, 3204, 3235, 3244, 3212, 3202, 3235, 3225, 3147, 3126, 3254, 3431, 3512, 3532, 3601, 3633, 3449, 3110, 2912, 2926, 2866, 2543, 2171, 2026, 2019, 1912, 1759, 1794, 1974, 2000, 1840, 1828, 2111, 2349, 2219, 1928, 1881, 1998, 1836, 1336, 923, 783, 602, 201, -124, -162, -153, -324, -481, -374, -124, 4, 11, 60, 133, 100, 20, 42, 75, -100, -441, -718, -866, -944, -961, -988, -1151, -1365, -1432, -1402, -1403, -1270, -877, -575, -703, -1009, -1064, -878, -677, -526, -472, -638, -898, -909, -585, -247, -168, -274, -315, -209, -98, -134, -239, -218, -94, -112, -302, -340, -22, 432, 723, 836, 912, 1056, 1317, 1620, 1753, 1656, 1546, 1559, 1563, 1497, 1487, 1520, 1419, 1277, 1413, 1812, 2075, 2012, 1900, 2044, 2390, 2663, 2718, 2619, 2509, 2483, 2569, 2739, 2851, 2731, 2429, 2266, 2382, 2454, 2218, 1981, 2118, 2394, 2369, 2165, 2201, 2462, 2635, 2641, 2583, 2453, 2234, 2077, 2050, 1986, 1749, 1476, 1372, 1416, 1448, 1443, 1504, 1599, 1558, 1366, 1233, 1279, 1364, 1286, 1031, 765, 641, 650, 657, 582, 491, 478, 520, 516, 443, 364, 298, 179, -7, -160, -199, -199, -273, -369, -343, -174, 10, 92, 69, 17, 28, 89, 80, -53, -211, -285, -307, -339, -344, -299, -280, -314, -269, -65, 121, 77, -59, 23, 296, 417, 335, 379, 666, 863, 763, 616, 658, 730, 613, 437, 455, 613, 666, 603, 657, 907, 1147, 1248, 1368, 1635, 1856, 1801, 1618, 1630, 1803, 1812, 1584, 1368, 1298, 1297, 1321, 1368, 1350, 1271, 1309, 1506, 1654, 1664, 1698, 1836, 1949, 1968, 1967, 1954, 1870, 1743, 1633, 1509, 1317, 1101, 964, 946, 972, 881, 634, 462, 577, 795, 765, 540, 492, 691, 845, 836, 823, 844, 735, 488, 292, 216, 92, -237, -705, -1107, -1313, -1376, -1390, -1354, -1257, -1222, -1362, -1537, -1508, -1296, -1161, -1238, -1436, -1638, -1789, -1858, -1877, -1942, -2082, -2242, -2422, -2685, -2936, -2959, -2790, -2828, -3269, -3643, -3418, -2864, -2685, -2939, -3071, -2879, -2684, -2629, -2586, -2615, -2831, -3025, -2973, -2870, -3021, -3306, -3378, -3211, -3113, -3252, -3437, -3432, -3265, -3105, -3001, -2879, -2722, -2572, -2442, -2321, -2242, -2227, -2221, -2136, -1994, -1972, -2199, -2500, -2533, -2243, -2009, -2143, -2426, -2406, -2034, -1729, -1766, -1901, -1790, -1489, -1307, -1343, -1488, -1678, -1866, -1977, -2079, -2324, -2585, -2530, -2170, -1868, -1743, -1536, -1125, -744, -580, -533, -413, -211, -135, -374, -807, -1102, -1186, -1327, -1593, -1662, -1425, -1264, -1416, -1523, -1195, -622, -253, -153, -80, 13, -2, -35, 110, 265, 93, -280, -421, -342, -464, -803, -882, -568, -337, -512, -740, -528, 35, 415, 360, 179, 242, 464, 512, 341, 208, 223, 213, 67, -83, -93, 30, 202, 299, 241, 155, 235, 384, 414, 500, 852, 1116, 870, 477, 567, 969, 1035, 728, 538, 613, 687, 675, 710, 770, 707, 608, 690, 876, 864, 649, 583, 786, 901, 674, 414, 523, 844, 940, 830, 884, 1073, 1030, 830, 910, 1202, 1193, 846, 602, 531, 354, 134, 152, 287, 223, 60, 140, 435, 622, 644, 750, 999, 1112, 908, 635, 609, 721, 616, 241, -67, -80, 51, 70, -43, -118, -58, 105, 296, 440, 504, 552, 671, 826, 894, 828, 687, 572, 583, 720, 808, 690, 473, 388, 458, 524, 554, 665, 818, 813, 658, 658, 942, 1182, 1046, 737, 707, 983, 1173, 1083, 941, 964, 1072, 1120, 1137, 1212, 1284, 1220, 1050, 949, 977, 966, 814, 662, 602, 470, 249, 281, 662, 865, 557, 253, 511, 1024, 1183, 997, 868, 868, 802, 625, 428, 226, 9, -165, -256, -310, -396, -499, -494, -308, -104, -115, -272, -264, -51, 76, 30, 14, 16, -212, -592, -709, -487, -314, -458, -790, -1077, -1193, -1095, -909, -892, -1109, -1300, -1241, -1059, -1004, -1037, -925, -685, -618, -808, -927, -731, -486, -589, -983, -1246, -1222, -1213, -1478, -1810, -1828, -1570, -1454, -1665, -1885, -1823, -1605, -1430, -1269, -1155, -1241, -1373, -1185, -793, -710, -979, -1118, -968, -872, -1000, -1125, -1117, -1115, -1185, -1203, -1159, -1184, -1245, -1098, -710, -405, -401, -465, -281, 73, 312, 380, 427, 443, 336, 281, 506, 744, 553, 184, 276, 698, 716, 314, 230, 614, 838, 663, 536, 716, 988, 1196, 1394, 1570, 1664, 1775, 2011, 2232, 2210, 2000, 1908, 2053, 2143, 1882, 1398, 1086, 1116, 1280, 1296, 1124, 984, 1095, 1440, 1817, 2075, 2214, 2281, 2306, 2343, 2429, 2491, 2387, 2038, 1478, 879, 493, 433, 462, 229, -247, -551, -398, 45, 403, 508, 486, 523, 627, 646, 533, 422, 329, 62, -382, -702, -811, -1023, -1428, -1677, -1621, -1573, -1720, -1867, -1866, -1783, -1619, -1375, -1266, -1437, -1654, -1647, -1533, -1588, -1826, -2058, -2224, -2432, -2709, -2912, -2896, -2685, -2463, -2442, -2663, -2870, -2692, -2131, -1717, -1915, -2475, -2710, -2455, -2304, -2631, -2925, -2633, -2114, -2020, -2217, -2113, -1686, -1361, -1248, -1205, -1274, -1486, -1548, -1256, -908, -913, -1187, -1297, -1076, -762, -560, -419, -304, -325, -451, -433, -137, 268, 503, 424, 202, 262, 771, 1276, 1263, 959, 983, 1349, 1489, 1232, 1054, 1249, 1460, 1312, 1019, 954, 1046, 1081, 1207, 1589, 1908, 1838, 1681, 1935, 2523, 3009, 3221, 3240, 3085, 2810, 2668, 2812, 3003, 2862, 2360, 1873, 1721, 1815, 1874, 1870, 2005, 2219, 2202, 1987, 2002, 2347, 2635, 2697, 2748, 2762, 2537, 2363, 2662, 3105, 3000, 2367, 1796, 1564, 1584, 1750, 1814, 1428, 690, 129, 29, 223, 464, 586, 506, 413, 593, 972, 1297, 1655, 2200, 2566, 2345, 1853, 1661, 1706, 1501, 880, 34, -834, -1520, -1849, -1914, -1925, -1825, -1408, -704, 61, 796, 1557, 2359, 3089, 3493, 3337, 2717, 2055, 1564, 995, 145, -716, -1212, -1377, -1492, -1591, -1424, -825, 45, 842, 1361, 1714, 2144, 2682, 3125, 3312, 3296, 3199, 3035, 2689, 2064, 1237, 513, 177, 162, 78, -278, -601, -396, 404, 1356, 2008, 2365, 2729, 3209, 3571, 3593, 3353, 3050, 2684, 2167, 1564, 1017, 613, 477, 667, 876, 717, 375, 367, 691, 903, 935, 1098, 1384, 1496, 1462, 1561, 1823, 2054, 2196, 2288, 2233, 1884, 1250, 533, -24, -302, -382, -466, -639, -790, -743, -433, 48, 509, 772, 801, 674, 482, 324, 312, 340, 51, -633, -1219, -1306, -1239, -1541, -2070, -2348, -2387, -2575, -2997, -3349, -3375, -3045, -2473, -1856, -1381, -1094, -895, -667, -413, -312, -573, -1151, -1740, -2202, -2749, -3459, -3923, -3732, -3105, -2636, -2526, -2418, -1951, -1197, -494, -75, 27, -34, 23, 330, 584, 408, -12, -172, -70, -199, -672, -1020, -934, -682, -613, -659, -493, 40, 754, 1324, 1641, 1918, 2402, 2999, 3301, 3087, 2642, 2382, 2293, 2058, 1628, 1237, 957, 708, 609, 855, 1326, 1717, 1946, 2131, 2327, 2518, 2744, 2979, 3050, 2860, 2607, 2541, 2563, 2361, 1928, 1590, 1481, 1344, 972, 508, 195, 91, 98, 84, -9, -72, 85, 440, 682, 578, 302, 213, 336, 323, -35, -553, -983, -1328, -1668, -1964, -2190, -2428, -2722, -3003, -3204, -3289, -3240, -3130, -3124, -3278, -3419, -3353, -3126, -2972, -3020, -3194, -3381, -3556, -3739, -3949, -4258, -4712, -5193, -5509, -5652, -5777, -5945, -6039, -5934, -5626, -5241, -4965, -4896, -4936, -4899, -4769, -4698, -4791, -5003, -5241, -5443, -5568, -5601, -5608, -5665, -5736, -5700, -5558, -5467, -5458, -5355, -5065, -4776, -4668, -4623, -4419, -4072, -3798, -3731, -3806, -3882, -3870, -3764, -3638, -3592, -3639, -3653, -3522, -3300, -3101, -2953, -2840, -2765, -2642, -2340, -1954, -1779, -1867, -1890, -1613, -1248, -1122, -1210, -1220, -1024, -825, -849, -1043, -1142, -1010, -786, -657, -623, -539, -325, -35, 234, 429, 539, 587, 638, 738, 813, 735, 540, 438, 557, 743, 767, 625, 533, 643, 878, 1061, 1098, 1023, 970, 1084, 1373, 1618, 1589, 1368, 1288, 1491, 1722, 1667, 1360, 1080, 971, 930, 836, 751, 779, 892, 962, 946, 940, 1073, 1356, 1612, 1664, 1563, 1490, 1449, 1305, 1108, 1038, 1030, 842, 516, 372, 537, 784, 842, 656, 411, 384, 657, 975, 1037, 894, 818, 893, 983, 1015, 1027, 999, 872, 732, 741, 809, 654, 312, 187, 379, 491, 353, 311, 532, 726, 757, 836, 997, 1105, 1281, 1624, 1780, 1482, 1142, 1269, 1623, 1591, 1156, 866, 970, 1154, 1173, 1193, 1317, 1373, 1365, 1545, 1854, 1969, 1944, 2137, 2504, 2683, 2663, 2705, 2792, 2727, 2556, 2441, 2364, 2260, 2181, 2141, 2034, 1870, 1872, 2172, 2569, 2742, 2673, 2648, 2857, 3197, 3457, 3502, 3309, 3003, 2809, 2787, 2761, 2569, 2257, 1950, 1747, 1727, 1868, 2017, 2095, 2197, 2335, 2383, 2360, 2458, 2642, 2624, 2308, 1954, 1776, 1686, 1554, 1445, 1435, 1414, 1265, 1114, 1155, 1310, 1322, 1120, 872, 708, 620, 553, 456, 280, 77, -2, 109, 316, 474, 529, 508, 454, 399, 347, 243, 52, -140, -206, -229, -431, -761, -859, -601, -380, -545, -852, -829, -471, -201, -215, -278, -177, -13, 80, 167, 258, 210, 21, -115, -176, -340, -618, -803, -822, -789, -733, -594, -370, -116, 150, 400, 565, 647, 729, 786, 664, 342, 70, 27, 7, -237, -495, -379, 7, 201, 114, 123, 427, 753, 808, 656, 530, 495, 432, 273, 107, 55, 121, 197, 201, 155, 143, 206, 284, 286, 187, 24, -165, -337, -430, -443, -476, -605, -731, -679, -463, -315, -395, -582, -665, -659, -740, -918, -995, -880, -760, -833, -998, -1007, -847, -771, -928, -1170, -1296, -1326, -1420, -1603, -1730, -1711, -1628, -1578, -1499, -1264, -912, -664, -656, -743, -643, -335, -159, -418, -950, -1287, -1213, -982, -946, -1129, -1270, -1201, -1000, -810, -651, -488, -381, -393, -407, -219, 154, 428, 400, 238, 240, 381, 380, 179, 48, 52, -148, -716, -1169, -948, -218, 292, 217, -8, 285, 1155, 1937, 2033, 1646, 1459, 1691, 1842, 1495, 949, 713, 672, 305, -357, -605, -93, 540, 563, 209, 304, 1030, 1687, 1741, 1525, 1600, 1884, 1851, 1409, 1045, 1091, 1252, 1037, 451, 35, 195, 654, 842, 677, 597, 813, 1035, 1083, 1240, 1662, 1903, 1567, 1125, 1348, 2001, 2045, 1246, 582, 691, 974, 745, 300, 231, 451, 512, 373, 349, 576, 869, 1012, 1013, 1021, 1065, 1027, 879, 788, 859, 896, 594, 24, -341, -251, -94, -354, -837, -941, -547, -130, -10, 10, 202, 506, 652, 524, 338, 400, 659, 703, 348, -51, -141, -80, -199, -444, -553, -524, -584, -794, -916, -706, -255, 45, -41, -248, -83, 495, 953, 851, 437, 259, 338, 186, -353, -841, -1007, -1125, -1382, -1512, -1358, -1180, -1146, -1054, -771, -508, -461, -533, -537, -457, -470, -740, -1177, -1476, -1465, -1374, -1555, -1964, -2155, -1867, -1392, -1188, -1261, -1226, -905, -535, -373, -376, -395, -423, -529, -691, -801, -799, -738, -704, -727, -758, -722, -565, -300, -23, 162, 273, 451, 748, 1008, 1080, 1051, 1108, 1238, 1283, 1181, 1015, 887, 868, 996, 1225, 1443, 1591, 1721, 1901, 2150, 2422, 2621, 2671, 2612, 2580, 2641, 2702, 2623, 2389, 2122, 1966, 1979, 2143, 2356, 2478, 2467, 2462, 2629, 2895, 2994, 2820, 2606, 2590, 2644, 2485, 2156, 1965, 1980, 1955, 1784, 1670, 1726, 1758, 1597, 1395, 1352, 1387, 1305, 1163, 1139, 1161, 1012, 722, 504, 403, 300, 153, -29, -277, -531, -667, -723, -832, -963, -1022, -1100, -1304, -1520, -1618, -1698, -1870, -2071, -2232, -2408, -2626, -2802, -2887, -2927, -2946, -2935, -2966, -3137, -3352, -3366, -3178, -3130, -3424, -3799, -3972, -4033, -4155, -4245, -4238, -4311, -4528, -4646, -4490, -4226, -4088, -4120, -4207, -4197, -4037, -3881, -3926, -4110, -4164, -4037, -3970, -4092, -4212, -4146, -4016, -4059, -4238, -4270, -4050, -3819, -3804, -3884, -3765, -3390, -3016, -2861, -2853, -2800, -2697, -2694, -2774, -2717, -2485, -2417, -2741, -3128, -3063, -2594, -2314, -2520, -2787, -2547, -1908, -1539, -1734, -1963, -1638, -1048, -953, -1401, -1682, -1483, -1310, -1538, -1816, -1760, -1593, -1672, -1820, -1642, -1203, -966, -1088, -1200, -979, -616, -486, -564, -540, -379, -376, -626, -808, -679, -500, -668, -1083, -1268, -1094, -947, -1062, -1158, -961, -690, -652, -706, -524, -168, -1, -102, -176, -62, 33, -91, -332, -509, -634, -773, -844, -769, -661, -659, -694, -602, -395, -227, -136, -33, 63, 36, -85, -114, -2, 73, -27, -232, -361, -314, -173, -134, -262, -379, -318, -191, -181, -218, -108, 92, 132, -8, -41, 168, 392, 395, 304, 349, 474, 468, 353, 313, 344, 276, 123, 112, 285, 411, 428, 579, 917, 1093, 955, 876, 1134, 1435, 1403, 1160, 1049, 1161, 1345, 1459, 1504, 1608, 1798, 1860, 1693, 1661, 2084, 2549, 2380, 1713, 1391, 1751, 2198, 2163, 1878, 1911, 2293, 2585, 2584, 2555, 2695, 2814, 2696, 2483, 2428, 2457, 2316, 2030, 1938, 2181, 2461, 2454, 2261, 2257, 2569, 2924, 3022, 2904, 2847, 2929, 2943, 2756, 2525, 2389, 2216, 1887, 1565, 1438, 1399, 1282, 1197, 1383, 1801, 2177, 2387, 2551, 2702, 2711, 2580, 2458, 2320, 2006, 1610, 1398, 1350, 1231, 1075, 1112, 1290, 1365, 1371, 1548, 1841, 1912, 1683, 1476, 1514, 1572, 1371, 1085, 1105, 1393, 1472, 1157, 870, 1008, 1320, 1319, 1029, 867, 948, 991, 855, 738, 816, 992, 1050, 950, 878, 986, 1110, 944, 540, 317, 457, 627, 502, 260, 260, 466, 564, 525, 611, 805, 768, 469, 325, 489, 572, 315, 6, -15, 165, 310, 398, 532, 702, 803, 816, 830, 915, 998, 901, 528, 58, -147, 58, 351, 318, 64, 60, 412, 715, 712, 622, 696, 815, 722, 405, 126, 132, 310, 275, -59, -244, 30, 394, 347, 60, 15, 163, 62, -291, -418, -154, 34, -239, -652, -585, -35, 331, 104, -304, -311, -16, 11, -343, -602, -476, -283, -380, -566, -417, 25, 269, 60, -289, -370, -242, -274, -547, -747, -643, -389, -218, -71, 250, 670, 880, 786, 635, 582, 453, 127, -177, -244, -198, -259, -389, -404, -237, 59, 388, 599, 604, 574, 773, 1133, 1221, 856, 460, 506, 796, 734, 234, -148, -25, 302, 379, 243, 229, 394, 515, 551, 654, 791, 728, 403, 28, -174, -130, 97, 315, 315, 129, 19, 136, 356, 509, 611, 707, 689, 453, 180, 146, 278, 216, -173, -593, -726, -594, -419, -316, -257, -209, -152, -20, 251, 554, 658, 483, 234, 170, 279, 274, -49, -519, -796, -852, -985, -1291, -1447, -1237, -958, -932, -905, -408, 419, 894, 727, 418, 474, 652, 390, -307, -918, -1203, -1478, -1972, -2364, -2186, -1536, -1047, -1108, -1323, -1019, -167, 561, 684, 471, 426, 558, 509, 205, -71, -254, -619, -1203, -1606, -1627, -1593, -1766, -1860, -1536, -965, -556, -362, -91, 423, 972, 1234, 1158, 995, 909, 740, 302, -248, -612, -808, -1123, -1604, -1909, -1752, -1295, -920, -710, -365, 289, 912, 1079, 946, 1050, 1416, 1459, 928, 338, 171, 199, -21, -398, -526, -390, -361, -559, -660, -404, 35, 347, 475, 539, 605, 704, 896, 1139, 1227, 1025, 689, 475, 380, 173, -213, -514, -493, -302, -289, -519, -658, -416, 34, 235, 30, -263, -354, -366, -517, -729, -840, -982, -1354, -1761, -1789, -1441, -1206, -1398, -1706, -1614, -1129, -814, -1034, -1464, -1536, -1201, -921, -1011, -1313, -1530, -1574, -1485, -1274, -1019, -922, -1087, -1301, -1276, -1035, -866, -899, -966, -890, -716, -590, -545, -459, -200, 160, 342, 217, 77, 297, 768, 970, 658, 234, 223, 602, 910, 917, 858, 985, 1225, 1384, 1446, 1536, 1722, 1917, 1986, 1965, 2063, 2307, 2373, 2077, 1812, 2074, 2702, 3067, 2896, 2525, 2379, 2511, 2683, 2686, 2562, 2490, 2500, 2475, 2452, 2617, 2923, 3044, 2882, 2763, 2916, 3110, 3034, 2760, 2559, 2450, 2252, 1990, 1915, 2072, 2167, 1980, 1686, 1589, 1734, 1915, 1976, 1924, 1825, 1693, 1514, 1318, 1176, 1116, 1065, 926, 678, 393, 170, 58, 9, -106, -377, -695, -839, -721, -507, -464, -703, -1016, -1020, -646, -373, -641, -1192, -1475, -1520, -1765, -2192, -2358, -2230, -2259, -2608, -2890, -2784, -2467, -2334, -2497, -2702, -2693, -2550, -2564, -2804, -3045, -3115, -3105, -3124, -3138, -3097, -3038, -3012, -3058, -3219, -3455, -3576, -3472, -3313, -3358, -3604, -3777, -3679, -3414, -3236, -3248, -3330, -3326, -3196, -3014, -2885, -2877, -3010, -3244, -3434, -3376, -3068, -2884, -3188, -3762, -3931, -3436, -2869, -2908, -3352, -3415, -2916, -2523, -2642, -2864, -2824, -2777, -2904, -2914, -2735, -2750, -3033, -3149, -2951, -2785, -2815, -2834, -2768, -2781, -2879, -2859, -2670, -2506, -2454, -2386, -2266, -2245, -2317, -2226, -1921, -1732, -1868, -2125, -2264, -2282, -2204, -2006, -1819, -1845, -2010, -2007, -1687, -1228, -906, -835, -940, -1041, -987, -796, -677, -791, -1004, -1051, -945, -925, -1031, -1026, -828, -638, -593, -569, -444, -300, -263, -285, -206, -14, 75, -104, -362, -335, -43, 86, -137, -349, -190, 102, 59, -285, -426, -159, 123, 51, -174, -130, 180, 384, 313, 215, 336, 577, 675, 548, 344, 242, 301, 447, 527, 467, 380, 452, 668, 803, 729, 587, 577, 677, 720, 671, 662, 767, 945, 1122, 1214, 1162, 1099, 1284, 1664, 1794, 1446, 996, 899, 1034, 944, 574, 310, 336, 428, 453, 605, 958, 1294, 1540, 1870, 2219, 2266, 2020, 1847, 1797, 1488, 813, 240, 165, 362, 388, 275, 380, 779, 1200, 1474, 1627, 1693, 1760, 1998, 2351, 2505, 2354, 2159, 2113, 2116, 2052, 1902, 1607, 1160, 792, 735, 895, 990, 1004, 1198, 1673, 2205, 2614, 2995, 3410, 3689, 3710, 3611, 3483, 3167, 2576, 1977, 1626, 1345, 831, 281, 256, 880, 1578, 1822, 1760, 1915, 2493, 3190, 3532, 3290, 2710, 2273, 2179, 2157, 1902, 1456, 1070, 898, 917, 995, 990, 908, 924, 1131, 1369, 1445, 1412, 1503, 1813, 2143, 2183, 1860, 1490, 1441, 1636, 1629, 1230, 743, 541, 632, 785, 831, 752, 654, 720, 1062, 1526, 1775, 1646, 1331, 1114, 1038, 937, 725, 474, 279, 184, 227, 404, 637, 855, 1056, 1234, 1326, 1285, 1135, 973, 907, 917, 782, 306, -336, -678, -500, -121, -21, -254, -425, -202, 322, 816, 1082, 1169, 1226, 1344, 1454, 1393, 1105, 750, 499, 285, -86, -590, -932, -907, -657, -459, -351, -137, 285, 785, 1193, 1482, 1708, 1856, 1837, 1609, 1280, 1000, 772, 471, 95, -182, -265, -263, -268, -235, -142, -74, -10, 222, 667, 1092, 1247, 1185, 1171, 1331, 1487, 1377, 965, 474, 153, 29, -67, -248, -376, -294, -110, -21, 52, 336, 752, 966, 881, 707, 569, 398, 200, 89, 46, -83, -297, -371, -176, 124, 292, 301, 271, 250, 227, 237, 322, 443, 531, 530, 381, 107, -108, -79, 108, 153, -81, -370, -353, 19, 388, 405, 187, 187, 578, 988, 988, 666, 468, 554, 605, 366, 53, 6, 136, 65, -276, -537, -424, -86, 109, 37, -31, 229, 755, 1159, 1265, 1249, 1186, 936, 604, 558, 793, 771, 211, -437, -614, -373, -160, -159, -204, -182, -75, 247, 817, 1277, 1320, 1195, 1267, 1362, 1177, 891, 777, 700, 492, 287, 128, -148, -444, -414, -157, -245, -805, -1155, -736, 41, 400, 314, 424, 985, 1596, 1897, 1918, 1749, 1383, 838, 145, -588, -1051, -1061, -963, -1184, -1492, -1299, -560, 183, 551, 643, 685, 759, 827, 816, 668, 391, 60, -229, -387, -379, -306, -345, -546, -723, -693, -594, -764, -1245, -1679, -1810, -1773, -1767, -1751, -1667, -1618, -1593, -1345, -812, -385, -419, -701, -744, -560, -628, -1115, -1669, -2017, -2285, -2589, -2785, -2796, -2786, -2903, -3115, -3298, -3331, -3162, -2876, -2602, -2346, -2026, -1613, -1101, -515, -55, -33, -451, -945, -1243, -1477, -1917, -2606, -3326, -3783, -3835, -3638, -3424, -3138, -2521, -1624, -891, -595, -475, -164, 240, 328, -15, -453, -666, -721, -868, -1192, -1589, -1919, -2059, -1970, -1777, -1693, -1764, -1772, -1491, -988, -563, -402, -388, -265, 82, 516, 760, 642, 258, -112, -299, -385, -565, -938, -1408, -1739, -1769, -1614, -1543, -1597, -1490, -1019, -390, 38, 229, 441, 760, 932, 764, 445, 287, 325, 362, 250, -20, -389, -734, -919, -888, -724, -626, -817, -1247, -1444, -1013, -255, 148, 37, -78, 196, 692, 1037, 1091, 950, 773, 669, 593, 355, -141, -678, -910, -803, -707, -898, -1144, -976, -407, -9, -114, -311, -89, 385, 617, 581, 634, 893, 1176, 1350, 1344, 1086, 678, 390, 297, 153, -247, -786, -1169, -1212, -967, -632, -331, -1, 435, 916, 1361, 1773, 2086, 2168, 2091, 2077, 2083, 1797, 1162, 516, 76, -290, -710, -1058, -1195, -1171, -1048, -755, -281, 174, 476, 755, 1116, 1371, 1380, 1342, 1409, 1371, 1003, 381, -335, -1031, -1455, -1442, -1303, -1490, -1901, -2001, -1605, -1077, -784, -730, -766, -836, -919, -934, -866, -846, -961, -1109, -1196, -1295, -1457, -1548, -1446, -1293, -1372, -1767, -2244, -2496, -2453, -2332, -2367, -2507, -2484, -2182, -1810, -1604, -1461, -1068, -402, 145, 235, -2, -203, -282, -489, -973, -1604, -2251, -2888, -3342, -3379, -3169, -3151, -3267, -2992, -2236, -1516, -1095, -659, -21, 539, 767, 768, 668, 372, -189, -846, -1400, -1869, -2375, -2832, -2970, -2722, -2379, -2185, -1961, -1383, -521, 210, 586, 773, 981, 1185, 1247, 1093, 722, 210, -256, -479, -464, -457, -647, -898, -894, -495, 138, 707, 1007, 1138, 1425, 1902, 2111, 1779, 1352, 1284, 1277, 856, 215, -168, -255, -222, -42, 250, 394, 348, 425, 797, 1254, 1495, 1422, 1192, 1078, 1126, 1013, 590, 259, 363, 587, 538, 402, 445, 471, 314, 279, 570, 844, 790, 641, 752, 1044, 1211, 1168, 1058, 965, 843, 687, 596, 642, 776, 904, 973, 954, 866, 895, 1285, 1928, 2321, 2209, 2023, 2240, 2657, 2773, 2518, 2100, 1580, 1096, 967, 1153, 1149, 765, 464, 662, 1185, 1625, 1828, 1912, 2079, 2455, 2934, 3222, 3153, 2908, 2774, 2771, 2644, 2248, 1786, 1534, 1400, 995, 287, -191, -42, 439, 790, 1016, 1293, 1569, 1906, 2583, 3428, 3755, 3364, 2898, 2849, 2894, 2541, 1814, 1017, 288, -323, -660, -590, -228, 164, 518, 1036, 1824, 2585, 2933, 2915, 2913, 3032, 3024, 2764, 2390, 2003, 1663, 1515, 1513, 1310, 849, 608, 840, 1128, 1090, 954, 1042, 1214, 1252, 1305, 1593, 1968, 2122, 2072, 2046, 2025, 1762, 1242, 716, 307, -53, -302, -254, 12, 179, 156, 226, 584, 1031, 1267, 1277, 1208, 1065, 821, 613, 541, 448, 164, -149, -188, 74, 379, 553, 621, 594, 423, 216, 186, 288, 231, -61, -327, -369, -306, -288, -244, -29, 384, 905, 1374, 1567, 1336, 860, 532, 466, 352, 0, -346, -471, -497, -510, -371, -155, -176, -415, -492, -307, -151, -152, -148, -67, -22, -59, -123, -182, -252, -356, -552, -858, -1169, -1346, -1379, -1365, -1348, -1280, -1150, -1019, -886, -665, -352, -118, -99, -192, -240, -313, -615, -1107, -1462, -1484, -1384, -1472, -1704, -1738, -1400, -905, -566, -451, -417, -378, -416, -614, -884, -1016, -875, -566, -345, -362, -491, -572, -680, -967, -1352, -1637, -1772, -1759, -1538, -1220, -1039, -908, -522, -18, 133, -63, -122, 72, 121, -171, -543, -789, -976, -1161, -1263, -1297, -1402, -1539, -1427, -965, -453, -236, -280, -323, -217, 32, 336, 460, 154, -500, -1093, -1328, -1298, -1240, -1208, -1092, -875, -681, -565, -414, -106, 279, 515, 463, 223, 27, 19, 129, 137, -123, -562, -884, -906, -724, -542, -478, -585, -796, -840, -569, -299, -388, -597, -415, 130, 552, 657, 655, 605, 327, -201, -757, -1183, -1536, -1871, -2089, -2044, -1718, -1212, -658, -174, 192, 519, 897, 1220, 1210, 752, 82, -472, -847, -1190, -1531, -1727, -1710, -1578, -1415, -1205, -945, -664, -375, -146, -97, -209, -294, -294, -391, -670, -879, -749, -409, -214, -241, -213, 29, 268, 242, 24, -129, -152, -193, -371, -605, -702, -600, -467, -486, -567, -480, -191, 121, 374, 615, 802, 816, 705, 701, 896, 1091, 1043, 755, 384, 39, -205, -306, -424, -816, -1375, -1636, -1442, -1135, -925, -605, -36, 603, 1148, 1576, 1845, 1974, 2058, 1987, 1477, 622, -96, -474, -798, -1271, -1694, -1822, -1629, -1172, -493, 233, 755, 1047, 1358, 1810, 2176, 2219, 2021, 1748, 1374, 907, 569, 482, 453, 307, 140, 59, -18, -147, -178, 35, 395, 603, 466, 208, 303, 865, 1406, 1462, 1160, 844, 576, 341, 287, 397, 418, 331, 390, 594, 692, 662, 620, 437, -58, -684, -1171, -1500, -1711, -1720, -1524, -1198, -673, 146, 1093, 1886, 2424, 2686, 2542, 1956, 1149, 360, -401, -1243, -2159, -2948, -3297, -3017, -2271, -1423, -666, 39, 694, 1197, 1506, 1622, 1534, 1346, 1231, 1118, 727, 66, -502, -814, -1095, -1483, -1735, -1660, -1466, -1390, -1264, -783, -52, 561, 981, 1394, 1742, 1743, 1380, 923, 476, -110, -822, -1375, -1606, -1635, -1536, -1172, -554, -22, 204, 360, 682, 924, 703, 134, -278, -313, -214, -210, -181, 80, 559, 1082, 1498, 1698, 1660, 1534, 1393, 1021, 306, -362, -565, -479, -560, -837, -999, -927, -711, -381, 45, 408, 589, 759, 1167, 1735, 2126, 2196, 2117, 1998, 1696, 1110, 377, -343, -1056, -1774, -2397, -2778, -2824, -2559, -2112, -1531, -731, 214, 950, 1343, 1710, 2222, 2502, 2208, 1564, 891, 145, -740, -1530, -2050, -2451, -2858, -3077, -2905, -2449, -1917, -1291, -486, 332, 915, 1296, 1664, 1943, 1900, 1535, 1017, 393, -311, -917, -1286, -1509, -1730, -1964, -2095, -1938, -1409, -791, -506, -527, -406, 1, 379, 508, 462, 291, 73, 27, 148, 70, -294, -543, -495, -466, -615, -696, -614, -573, -628, -620, -555, -568, -584, -439, -289, -450, -766, -691, -160, 227, 196, 273, 839, 1421, 1475, 1216, 1088, 1012, 651, 22, -589, -1046, -1408, -1717, -1914, -1914, -1688, -1272, -734, -167, 315, 670, 985, 1332, 1589, 1540, 1154, 619, 77, -559, -1372, -2159, -2612, -2731, -2801, -2912, -2831, -2434, -1930, -1507, -1111, -650, -126, 430, 904, 1060, 834, 479, 188, -155, -691, -1332, -1966, -2570, -3037, -3204, -3098, -2887, -2587, -2043, -1211, -289, 454, 898, 1098, 1147, 1029, 682, 180, -278, -591, -812, -999, -1183, -1412, -1619, -1562, -1159, -727, -564, -491, -141, 440, 841, 831, 587, 363, 225, 128, 52, -43, -196, -281, -127, 191, 393, 382, 302, 212, 76, 16, 191, 461, 519, 299, -2, -187, -168, 26, 260, 401, 477, 604, 816, 1082, 1385, 1645, 1714, 1552, 1276, 980, 637, 200, -336, -916, -1360, -1465, -1243, -862, -385, 217, 817, 1281, 1709, 2167, 2387, 2155, 1700, 1335, 937, 230, -660, -1357, -1773, -2115, -2375, -2258, -1672, -925, -272, 355, 982, 1407, 1524, 1426, 1141, 682, 254, -1, -264, -657, -969, -1060, -1102, -1178, -1129, -931, -743, -526, -148, 239, 361, 212, -7, -159, -211, -273, -535, -860, -727, -23, 603, 668, 558, 789, 1184, 1276, 971, 444, -122, -533, -739, -965, -1325, -1493, -1143, -483, 7, 160, 142, 135, 212, 422, 753, 1057, 1136, 945, 617, 268, -152, -738, -1420, -2010, -2402, -2599, -2585, -2280, -1698, -1006, -358, 231, 792, 1249, 1512, 1604, 1582, 1349, 751, -133, -984, -1594, -2016, -2332, -2476, -2366, -2032, -1545, -925, -196, 569, 1233, 1629, 1695, 1567, 1466, 1423, 1247, 794, 186, -315, -588, -727, -870, -1054, -1205, -1169, -819, -238, 280, 559, 735, 993, 1259, 1342, 1168, 766, 170, -512, -1089, -1454, -1625, -1594, -1319, -872, -483, -314, -268, -128, 153, 384, 392, 241, 124, 93, 12, -249, -627, -922, -998, -864, -588, -219, 188, 558, 867, 1138, 1335, 1357, 1204, 960, 627, 135, -454, -959, -1284, -1422, -1339, -1012, -507, 69, 619, 1038, 1310, 1569, 1887, 2065, 1897, 1512, 1202, 1003, 709, 225, -337, -829, -1203, -1496, -1693, -1657, -1280, -722, -239, 198, 767, 1355, 1695, 1843, 1991, 1980, 1573, 983, 609, 428, 154, -247, -593, -787, -805, -588, -197, 125, 244, 330, 584, 898, 1029, 1009, 1080, 1276, 1422, 1422, 1267, 894, 405, 156, 290, 440, 249, -89, -157, 84, 307, 312, 223, 254, 464, 775, 1072, 1259, 1325, 1363, 1413, 1340, 1054, 729, 608, 669, 720, 714, 744, 835, 901, 810, 476, -16, -395, -479, -389, -342, -341, -223, 95, 544, 991, 1305, 1466, 1574, 1670, 1615, 1267, 713, 202, -155, -471, -879, -1340, -1702, -1858, -1810, -1566, -1085, -366, 437, 1097, 1522, 1793, 1981, 1981, 1646, 1046, 482, 155, -63, -443, -1046, -1653, -2003, -2053, -2018, -2072, -2024, -1495, -517, 414, 1007, 1446, 1877, 2093, 1916, 1466, 884, 188, -516, -1029, -1322, -1513, -1580, -1363, -898, -458, -177, 135, 642, 1158, 1383, 1276, 988, 591, 121, -276, -478, -557, -618, -565, -248, 221, 561, 707, 858, 1095, 1231, 1123, 855, 532, 133, -297, -546, -506, -351, -269, -188, 28, 249, 266, 188, 294, 577, 771, 797, 809, 864, 858, 760, 632, 399, -93, -765, -1294, -1556, -1783, -2102, -2245, -1941, -1319, -667, -43, 612, 1200, 1534, 1585, 1467, 1254, 914, 416, -202, -848, -1394, -1723, -1830, -1827, -1777, -1601, -1225, -741, -288, 120, 525, 881, 1079, 1075, 893, 581, 217, -103, -348, -558, -756, -848, -714, -374, -12, 218, 372, 593, 860, 944, 689, 221, -192, -452, -673, -970, -1251, -1289, -987, -517, -127, 148, 420, 654, 696, 600, 624, 794, 773, 324, -311, -666, -604, -414, -393, -493, -433, -116, 242, 404, 436, 630, 1104, 1589, 1741, 1566, 1350, 1219, 982, 458, -245, -873, -1251, -1325, -1104, -670, -175, 309, 845, 1475, 2044, 2324, 2248, 1895, 1328, 580, -210, -853, -1315, -1735, -2144, -2343, -2151, -1660, -1100, -560, -16, 502, 945, 1268, 1349, 1086, 629, 251, -39, -424, -846, -1038, -989, -1004, -1232, -1430, -1286, -801, -230, 208, 454, 539, 541, 558, 587, 479, 175, -113, -99, 218, 545, 659, 644, 702, 835, 855, 624, 215, -187, -456, -592, -652, -648, -500, -112, 443, 909, 1050, 901, 678, 508, 363, 230, 160, 118, 0, -226, -479, -722, -981, -1226, -1370, -1371, -1264, -1062, -717, -199, 407, 943, 1314, 1563, 1719, 1698, 1438, 1066, 723, 342, -198, -767, -1097, -1133, -1039, -920, -736, -442, -35, 489, 1101, 1680, 2069, 2194, 2077, 1784, 1389, 973, 561, 85, -455, -866, -923, -665, -354, -194, -194, -234, -168, 40, 249, 306, 309, 461, 726, 856, 728, 387, -131, -805, -1501, -2038, -2285, -2182, -1778, -1300, -967, -764, -534, -220, 116, 389, 511, 457, 338, 250, 98, -253, -704, -1034, -1189, -1249, -1186, -883, -368, 173, 627, 1009, 1302, 1402, 1296, 1106, 856, 398, -311, -1059, -1619, -1911, -1885, -1509, -896, -236, 392, 949, 1323, 1460, 1450, 1340, 1037, 527, 3, -346, -541, -709, -911, -1079, -1107, -1009, -936, -937, -822, -462, -43, 191, 276, 316, 272, 160, 148, 209, 70, -306, -565, -467, -209, -91, -165, -274, -253, -53, 226, 394, 348, 190, 87, 15, -185, -510, -734, -715, -560, -402, -234, -58, 49, 126, 315, 588, 695, 475, 45, -368, -672, -897, -1045, -1046, -881, -659, -509, -423, -275, -43, 78, -127, -616, -1058, -1165, -978, -739, -563, -351, -38, 249, 342, 246, 77, -130, -434, -797, -1057, -1104, -979, -765, -483, -149, 160, 345, 368, 255, 34, -272, -594, -799, -780, -559, -260, 7, 176, 188, 36, -180, -371, -566, -816, -1037, -1096, -978, -764, -526, -319, -173, 0, 324, 720, 910, 703, 205, -318, -707, -993, -1273, -1516, -1553, -1308, -918, -549, -196, 180, 456, 457, 244, 61, 8, -45, -188, -299, -256, -154, -148, -228, -304, -376, -457, -430, -196, 126, 316, 345, 384, 509, 607, 580, 477, 328, 58, -338, -715, -941, -1000, -893, -618, -230, 225, 726, 1128, 1191, 912, 607, 517, 536, 439, 216, 24, -75, -190, -416, -682, -814, -730, -494, -178, 238, 754, 1206, 1375, 1225, 953, 770, 687, 536, 215, -168, -421, -484, -494, -606, -796, -877, -734, -461, -173, 161, 574, 921, 1091, 1198, 1340, 1347, 1074, 716, 519, 406, 139, -307, -751, -1032, -1110, -1043, -900, -670, -283, 191, 537, 647, 678, 791, 912, 833, 500, 99, -148, -235, -349, -602, -853, -902, -757, -572, -401, -193, 26, 177, 233, 184, 20, -163, -211, -110, 34, 183, 321, 334, 191, 78, 110, 121, -30, -184, -106, 140, 289, 172, -119, -342, -313, -114, -25, -202, -457, -486, -275, -125, -214, -330, -191, 148, 412, 476, 424, 311, 77, -294, -698, -994, -1127, -1149, -1098, -919, -533, -11, 419, 582, 525, 460, 530, 697, 824, 802, 606, 316, 66, -89, -267, -577, -880, -887, -550, -169, -23, -11, 155, 524, 885, 1162, 1508, 1949, 2208, 2030, 1517, 992, 601, 215, -308, -854, -1112, -945, -559, -244, -33, 246, 627, 934, 1043, 1042, 1041, 971, 723, 398, 229, 265, 309, 205, 45, 15, 152, 305, 317, 190, 67, 51, 114, 223, 418, 694, 920, 1015, 1088, 1256, 1434, 1451, 1273, 1020, 818, 693, 599, 466, 275, 76, -76, -200, -360, -568, -742, -751, -530, -147, 241, 500, 566, 457, 309, 311, 480, 581, 445, 221, 92, -66, -451, -934, -1226, -1276, -1247, -1227, -1149, -882, -345, 326, 793, 856, 691, 571, 513, 353, 42, -317, -628, -831, -871, -757, -627, -617, -681, -657, -515, -341, -140, 154, 461, 602, 568, 519, 512, 455, 304, 108, -114, -378, -627, -733, -634, -420, -269, -266, -317, -297, -250, -330, -552, -745, -734, -439, 59, 436, 347, -76, -281, -49, 211, 130, -102, -122, 108, 386, 561, 574, 452, 300, 174, 19, -200, -393, -489, -524, -528, -417, -112, 325, 712, 912, 949, 950, 966, 902, 687, 402, 170, -14, -224, -472, -720, -929, -1012, -881, -588, -304, -103, 89, 306, 430, 380, 266, 244, 303, 323, 288, 271, 261, 185, 37, -152, -394, -633, -706, -572, -421, -391, -330, -43, 373, 619, 544, 304, 138, 98, 47, -128, -369, -508, -443, -234, -13, 160, 322, 454, 468, 332, 125, -99, -364, -639, -777, -659, -341, 27, 334, 488, 388, 58, -263, -385, -413, -497, -484, -172, 269, 495, 489, 501, 614, 670, 549, 282, -27, -254, -283, -147, -45, -101, -164, -30, 217, 347, 385, 565, 871, 978, 738, 390, 188, 89, -68, -276, -389, -370, -302, -228, -123, 1, 90, 140, 199, 262, 276, 225, 151, 132, 225, 399, 520, 514, 461, 462, 480, 412, 260, 134, 116, 200, 335, 470, 566, 602, 601, 575, 492, 337, 186, 118, 93, 42, 32, 167, 381, 488, 449, 425, 528, 667, 676, 525, 337, 230, 173, 57, -121, -273, -388, -549, -754, -877, -858, -768, -660, -521, -361, -229, -125, -27, 16, -59, -214, -318, -304, -254, -317, -540, -807, -985, -1089, -1196, -1228, -1017, -582, -187, 0, 89, 222, 305, 174, -77, -154, 41, 263, 266, 136, 123, 271, 368, 254, 1, -215, -339, -426, -503, -512, -390, -169, 11, 12, -147, -283, -272, -185, -168, -229, -247, -126, 110, 347, 455, 405, 285, 179, 97, 28, 6, 26, 41, 37, 12, -94, -319, -526, -528, -333, -118, 33, 212, 508, 833, 969, 794, 441, 162, 16, -149, -400, -584, -596, -518, -426, -281, -115, -80, -219, -355, -312, -128, 24, 51, -13, -109, -199, -272, -351, -479, -644, -770, -840, -906, -951, -891, -749, -647, -578, -448, -310, -338, -522, -639, -562, -398, -242, -11, 342, 614, 553, 214, -90, -185, -180, -275, -518, -802, -958, -922, -804, -751, -765, -720, -544, -267, 41, 296, 381, 259, 35, -138, -240, -366, -538, -650, -638, -568, -510, -459, -428, -465, -504, -400, -140, 133, 339, 523, 703, 815, 817, 720, 536, 280, 32, -113, -142, -105, -10, 172, 369, 464, 494, 609, 782, 820, 694, 591, 603, 613, 520, 384, 301, 307, 392, 501, 543, 462, 291, 102, -61, -199, -310, -386, -408, -327, -89, 264, 577, 715, 704, 656, 583, 410, 141, -74, -130, -81, -43, -43, -64, -138, -299, -491, -625, -694, -717, -647, -452, -213, -54, 10, 66, 149, 206, 199, 123, -33, -260, -417, -344, -103, 52, -4, -162, -267, -299, -318, -382, -496, -583, -539, -374, -206, -102, -34, 11, 14, -13, -43, -90, -176, -270, -325, -336, -308, -211, -39, 101, 114, 67, 121, 261, 291, 122, -81, -143, -121, -163, -273, -337, -332, -344, -391, -352, -157, 58, 100, 21, 92, 407, 737, 889, 942, 980, 911, 708, 517, 381, 176, -97, -267, -276, -212, -83, 161, 449, 651, 745, 779, 775, 752, 750, 747, 689, 579, 479, 405, 301, 147, -9, -148, -317, -508, -591, -490, -313, -179, -51, 143, 337, 423, 432, 473, 575, 665, 635, 426, 92, -227, -454, -641, -852, -1021, -1013, -804, -521, -287, -81, 172, 455, 652, 684, 594, 481, 404, 350, 263, 100, -105, -252, -268, -226, -249, -330, -345, -224, 0, 274, 568, 811, 952, 1041, 1144, 1206, 1108, 835, 489, 150, -159, -390, -476, -443, -408, -395, -294, -70, 135, 200, 210, 309, 493, 617, 568, 365, 129, -43, -167, -287, -362, -323, -216, -172, -231, -329, -415, -508, -628, -742, -799, -752, -596, -408, -275, -214, -184, -169, -180, -193, -174, -125, -77, -48, -27, 21, 109, 156, 49, -169, -294, -238, -151, -182, -263, -247, -122, 21, 136, 221, 268, 301, 385, 533, 637, 587, 468, 463, 583, 613, 408, 103, -77, -123, -196, -344, -436, -369, -228, -126, -55, 25, 84, 71, 42, 120, 323, 549, 709, 798, 822, 742, 536, 265, 26, -129, -202, -185, -93, -3, 19, 6, 21, 50, 32, -26, -54, -28, 23, 93, 195, 281, 267, 126, -58, -194, -278, -345, -389, -364, -278, -206, -198, -227, -230, -180, -114, -88, -128, -218, -320, -387, -368, -277, -210, -264, -416, -534, -530, -457, -413, -406, -386, -349, -328, -291, -187, -71, -49, -122, -206, -304, -487, -732, -899, -900, -821, -785, -793, -722, -502, -199, 66, 237, 332, 386, 391, 321, 175, 0, -167, -320, -449, -516, -512, -458, -362, -196, 19, 210, 355, 521, 746, 950, 1041, 1047, 1072, 1110, 1037, 783, 438, 139, -58, -184, -279, -358, -388, -317, -150, 60, 286, 517, 692, 745, 725, 709, 670, 538, 336, 124, -89, -279, -362, -326, -283, -306, -322, -229, -42, 138, 243, 272, 265, 253, 230, 188, 138, 109, 107, 122, 130, 111, 66, 32, 11, -56, -190, -270, -167, 78, 327, 516, 664, 755, 764, 732, 706, 659, 555, 427, 355, 378, 466, 538, 536, 475, 419, 388, 355, 321, 316, 336, 326, 263, 186, 134, 85, 0, -97, -133, -78, 33, 140, 180, 116, -1, -59, -20, 29, 1, -68, -102, -100, -123, -203, -326, -477, -647, -801, -881, -877, -846, -850, -860, -784, -588, -345, -177, -128, -166, -243, -341, -442, -513, -553, -605, -679, -717, -676, -590, -510, -436, -367, -352, -399, -441, -429, -399, -401, -419, -411, -361, -300, -260, -249, -250, -254, -278, -320, -350, -353, -379, -474, -595, -653, -633, -621, -665, -683, -588, -425, -299, -220, -129, 1, 156, 328, 479, 545, 525, 498, 514, 520, 452, 344, 288, 305, 349, 386, 427, 452, 433, 388, 360, 349, 350, 403, 525, 644, 689, 678, 659, 630, 567, 502, 486, 512, 521, 483, 418, 349, 269, 183, 111, 70, 50, 47, 63, 104, 176, 267, 338, 341, 281, 215, 170, 109, 2, -104, -142, -108, -63, -51, -56, -67, -96, -135, -174, -223, -280, -297, -236, -138, -59, 3, 59, 66, -17, -181, -371, -533, -618, -603, -513, -381, -234, -106, -49, -63, -96, -96, -73, -63, -76, -83, -51, 6, 44, 41, 32, 57, 108, 146, 163, 173, 167, 125, 51, -36, -118, -171, -176, -149, -125, -98, -35, 62, 148, 187, 190, 184, 167, 123, 48, -24, -68, -94, -126, -161, -166, -133, -89, -75, -94, -126, -159, -205, -285, -379, -436, -413, -332, -245, -169, -102, -80, -126, -177, -171, -139, -154, -212, -270, -329, -383, -400, -376, -367, -402, -450, -469, -430, -319, -177, -100, -128, -199, -238, -247, -256, -255, -225, -207, -259, -346, -377, -326, -273, -266, -261, -196, -79, 44, 135, 177, 177, 161, 134, 86, 32, 7, 6, -11, -49, -65, -40, 4, 60, 135, 224, 280, 276, 235, 204, 202, 211, 218, 215, 187, 128, 67, 30, -1, -71, -163, -198, -138, -41, 7, -3, -17, 10, 73, 127, 125, 70, 23, 14, -13, -100, -193, -224, -212, -205, -197, -146, -56, 35, 107, 141, 136, 112, 111, 146, 183, 180, 140, 89, 49, 32, 52, 103, 139, 136, 113, 93, 77, 79, 118, 174, 206, 228, 276, 331, 330, 272, 222, 223, 244, 255, 279, 343, 417, 453, 463, 477, 487, 463, 423, 412, 456, 540, 625, 676, 682, 668, 645, 591, 485, 347, 234, 172, 150, 155, 189, 238, 264, 259, 256, 273, 288, 289, 282, 250, 161, 52, -7, -4, 0, -33, -101, -176, -219, -211, -193, -240, -356, -476, -550, -581, -588, -568, -529, -475, -414, -362, -337, -342, -355, -358, -354, -349, -354, -379, -418, -438, -412, -366, -357, -396, -430, -420, -404, -415, -429, -413, -374, -332, -279, -214, -157, -109, -55, -25, -55, -140, -224, -280, -327, -380, -417, -430, -437, -443, -416, -341, -262, -214, -179, -140, -116, -119, -124, -113, -113, -138, -161, -140, -86, -34, 4, 40, 65, 63, 49, 54, 86, 135, 188, 221, 210, 185, 198, 238, 250, 233, 238, 267, 269, 235, 215, 238, 276, 297, 297, 296, 313, 357, 413, 449, 443, 399, 347, 316, 305, 278, 222, 176, 187, 237, 271, 261, 227, 203, 211, 244, 278, 285, 268, 250, 235, 212, 187, 172, 158, 130, 101, 97, 122, 142, 138, 127, 132, 148, 155, 159, 173, 189, 177, 133, 89, 67, 57, 42, 39, 59, 84, 102, 129, 181, 239, 273, 286, 304, 326, 318, 272, 214, 166, 122, 79, 59, 58, 61, 63, 78, 101, 108, 98, 84, 71, 59, 54, 48, 16, -34, -75, -92, -105, -128, -150, -155, -147, -138, -138, -149, -169, -191, -198, -188, -179, -182, -191, -190, -182, -175, -177, -187, -198, -191, -165, -143, -148, -169, -179, -166, -139, -110, -93, -96, -108, -105, -87, -71, -74, -88, -94, -91, -85, -74, -50, -17, 8, 21, 25, 27, 32, 41, 53, 58, 61, 74, 86, 76, 50, 34, 37, 39, 29, 26, 46, 72, 78, 71, 66, 62, 45, 26, 25, 33, 33, 28, 32, 45, 57, 61, 57, 40, 19, 14, 28, 38, 21, -5, -10, 4, 12, 2, -3, -1, -3, -17, -27, -24, -11, -2, -4, -13, -15, -1, 22, 39, 36, 25, 27, 41, 51, 47, 39, 34, 27, 17, 9, 7, 8, 11, 16, 25, 32, 34, 40, 52, 59, 52, 40, 33, 29, 25, 19, 19, 23, 23, 20, 20, 22, 20, 10, 0, -5, -12, -22, -31, -35, -34, -30, -28, -25, -23, -23, -20, -13, -12, -18, -23, -20, -20, -31, -41, -37, -31, -35, -40, -38, -34, -34, -36, -34, -33, -34, -34, -35, -37, -36, -29, -21, -18, -18, -15, -11, -11, -12, -11, -8, -10, -17, -20, -16, -13, -14, -16, -15, -14, -14, -12, -11, -11, -11, -8, -3, 0, 1, 0, -2, -3, -3, -5, -10, -14, -15, -14, -13, -10, -5, -1, 0, 1, 1, 1, 1, 2, 2, 1, 0, 1, 2, 3, 2, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 1, 4, 6, 4, 1, 0, 1, 1, 0, -2, -2, -1, 0, 0, 0, 0, 0, 1, 1, 0, 1, 1, 0, -1, -1, -1, -1, -3, -4, -4, -4, -4, -3, -1, 0, 0, 0, -2, -2, -3, -4, -5, -5, -5, -7, -8, -9, -8, -5, -3, -4, -5, -4, -3, -2, -2, -3, -3, -3, -4, -4, -5, -7, -8, -8, -5, -4, -4, -7, -7, -4, -2, -2, -2, -3, -3, -3, -3, -3, -3, -4, -4, -3, -2, 0, -1, -2, -3, -2, -2, -3, -3, -2, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, -1, 0, 1, 1, 0, 0, 0, -1, -1, -1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -2, -2, 0, 0, 0, 0, -1, 0, 1, 1, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, 0, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0 };
+// IMA ADPCM blocks, see audio_adpcm.h
+static const uint8_t __in_flash("audio_sixty_sample_data") audio_sixty_sample_data[] = { 0, 0, 0, 0, 255, 247, 143, 71, 186, 26, 36, 128, 145, 189, 8, 49, 38, 184, 203, 139, 53, 153, 8, 72, 162, 91, 150, 173, 34, 168, 9, 36, 144, 138, 201, 73, 5, 137, 145, 140, 16, 36, 184, 156, 137, 67, 129, 137, 235, 89, 37, 184, 156, 8, 65, 35, 152, 237, 10, 37, 129, 187, 25, 36, 161, 189, 64, 20, 186, 137, 32, 2, 170, 16, 1, 25, 163, 255, 48, 34, 160, 141, 35, 185, 24, 200, 13, 68, 168, 25, 18, 186, 172, 80, 36, 128, 219, 25, 1, 50, 232, 138, 49, 146, 138, 200, 121, 4, 154, 176, 159, 115, 146, 170, 139, 81, 162, 26, 18, 153, 10, 50, 251, 25, 34, 176, 14, 52, 184, 187, 40, 87, 176, 157, 33, 3, 168, 136, 218, 73, 38, 184, 171, 32, 1, 49, 132, 202, 189, 89, 36, 160, 202, 25, 18, 8, 52, 240, 140, 32, 17, 16, 169, 156, 33, 35, 185, 155, 49, 176, 74, 55, 217, 11, 36, 176, 172, 81, 132, 187, 48, 200, 57, 22, 185, 139, 17, 34, 2, 202, 73, 4, 253, 41, 37, 184, 154, 24, 50, 152, 49, 249, 141, 35, 129, 153, 154, 33, 51, 200, 139, 1, 40, 5, 205, 25, 68, 146, 172, 9, 34, 202, 114, 144, 9, 153, 185, 76, 87, 200, 154, 33, 33, 145, 188, 48, 130, 9, 17, 232, 140, 82, 130, 185, 187, 64, 39, 160, 140, 1, 170, 97, 147, 171, 16, 168, 56, 21, 216, 141, 67, 128, 153, 185, 96, 3, 186, 137, 170, 121, 37, 168, 187, 25, 52, 152, 25, 144, 139, 21, 205, 80, 130, 154, 128, 8, 130, 203, 97, 19, 202, 138, 129, 81, 2, 189, 41, 18, 170, 66, 129, 50, 253, 44, 20, 154, 40, 168, 9, 34, 144, 24, 233, 43, 38, 168, 32, 209, 157, 49, 130, 0, 160, 175, 56, 53, 160, 171, 10, 24, 116, 145, 156, 0, 154, 84, 161, 170, 25, 67, 200, 58, 134, 186, 24, 128, 83, 177, 173, 17, 2, 0, 176, 158, 84, 176, 156, 66, 2, 201, 156, 67, 130, 186, 56, 147, 156, 17, 137, 69, 249, 26, 35, 202, 32, 18, 186, 10, 51, 128, 161, 173, 67, 251, 72, 20, 218, 9, 1, 50, 177, 157, 176, 58, 87, 184, 153, 0, 0, 65, 148, 175, 48, 129, 136, 24, 146, 175, 82, 161, 140, 66, 161, 155, 136, 65, 3, 203, 154, 113, 4, 218, 137, 51, 146, 172, 25, 50, 161, 155, 8, 8, 67, 146, 171, 153, 172, 115, 7, 202, 10, 51, 145, 152, 204, 88, 20, 185, 141, 66, 147, 188, 57, 5, 186, 32, 1, 0, 202, 11, 69, 145, 171, 56, 2, 187, 80, 3, 218, 171, 113, 131, 187, 56, 36, 232, 139, 36, 136, 16, 169, 138, 48, 147, 207, 81, 130, 153, 154, 10, 116, 129, 188, 56, 37, 218, 137, 65, 130, 202, 153, 97, 2, 170, 9, 1, 8, 0, 153, 152, 24, 69, 145, 223, 57, 38, 88, 15, 65, 0, 169, 10, 129, 24, 129, 10, 34, 136, 251, 12, 38, 144, 169, 138, 67, 136, 34, 250, 10, 18, 1, 128, 169, 188, 104, 37, 185, 155, 50, 129, 40, 195, 207, 66, 162, 11, 18, 205, 48, 20, 168, 171, 64, 20, 218, 10, 67, 144, 154, 152, 33, 20, 249, 41, 4, 156, 32, 17, 153, 186, 64, 132, 189, 49, 129, 33, 208, 171, 72, 39, 185, 24, 153, 16, 219, 80, 4, 201, 138, 82, 146, 172, 49, 1, 169, 156, 99, 145, 153, 187, 112, 132, 172, 65, 129, 153, 153, 8, 66, 4, 235, 10, 17, 50, 178, 191, 48, 19, 8, 168, 172, 40, 51, 132, 190, 49, 176, 155, 84, 162, 156, 36, 201, 138, 99, 147, 189, 48, 130, 169, 56, 162, 142, 83, 176, 139, 18, 2, 161, 175, 65, 129, 137, 145, 186, 136, 112, 54, 249, 138, 33, 1, 144, 136, 145, 171, 64, 21, 187, 57, 132, 171, 32, 51, 194, 207, 64, 147, 9, 160, 173, 98, 131, 202, 9, 33, 18, 168, 206, 72, 21, 201, 138, 18, 33, 3, 220, 138, 33, 67, 177, 191, 56, 38, 184, 156, 49, 19, 201, 171, 65, 4, 168, 170, 24, 51, 146, 203, 169, 56, 37, 1, 219, 72, 177, 155, 67, 4, 220, 10, 67, 21, 235, 10, 67, 144, 137, 153, 10, 68, 146, 172, 153, 49, 39, 200, 156, 50, 130, 137, 170, 48, 4, 202, 154, 66, 34, 178, 191, 48, 2, 0, 184, 10, 145, 25, 35, 18, 252, 29, 36, 169, 24, 184, 88, 18, 186, 140, 115, 146, 159, 64, 176, 41, 3, 154, 169, 113, 4, 204, 9, 35, 130, 168, 157, 48, 50, 193, 159, 66, 160, 27, 18, 168, 153, 56, 132, 173, 49, 128, 50, 177, 207, 25, 69, 145, 187, 138, 66, 3, 187, 32, 176, 157, 116, 130, 189, 48, 2, 152, 187, 82, 130, 169, 202, 58, 55, 185, 41, 1, 137, 136, 168, 40, 103, 233, 11, 51, 1, 168, 203, 16, 35, 51, 240, 173, 32, 51, 129, 188, 153, 26, 103, 152, 155, 8, 52, 177, 156, 1, 35, 250, 57, 145, 10, 52, 168, 173, 40, 52, 145, 188, 10, 50, 35, 146, 239, 24, 19, 153, 0, 169, 82, 193, 139, 50, 129, 154, 1, 202, 73, 36, 145, 251, 141, 115, 145, 139, 0, 9, 18, 8, 201, 26, 21, 168, 138, 53, 184, 10, 153, 68, 144, 220, 26, 55, 160, 172, 16, 66, 131, 206, 41, 35, 169, 138, 24, 49, 53, 248, 156, 48, 36, 169, 172, 49, 19, 201, 153, 8, 84, 177, 172, 32, 18, 145, 136, 202, 57, 7, 169, 138, 65, 146, 155, 9, 114, 146, 172, 34, 184, 42, 3, 152, 56, 134, 190, 49, 170, 115, 164, 172, 0, 33, 4, 170, 24, 136, 144, 188, 114, 2, 144, 207, 80, 2, 154, 136, 137, 50, 129, 186, 171, 24, 86, 3, 190, 42, 35, 128, 24, 146, 207, 64, 2, 186, 9, 136, 51, 177, 59, 7, 203, 5, 56, 0, 172, 48, 4, 235, 40, 131, 26, 147, 191, 65, 146, 9, 146, 159, 52, 160, 171, 33, 17, 1, 207, 48, 129, 32, 232, 26, 2, 33, 192, 42, 163, 24, 250, 75, 4, 140, 17, 8, 3, 206, 48, 4, 185, 155, 114, 130, 170, 137, 8, 36, 185, 64, 192, 27, 35, 2, 236, 56, 163, 12, 130, 57, 149, 190, 65, 18, 176, 175, 65, 3, 186, 154, 48, 37, 192, 187, 65, 3, 170, 24, 152, 138, 32, 55, 233, 73, 131, 174, 32, 4, 201, 10, 50, 0, 168, 8, 128, 153, 137, 85, 161, 139, 177, 15, 51, 2, 162, 223, 40, 19, 136, 9, 208, 13, 36, 128, 1, 235, 139, 115, 130, 171, 16, 153, 80, 130, 170, 138, 48, 2, 24, 160, 159, 49, 176, 74, 5, 173, 33, 129, 128, 203, 64, 17, 3, 239, 33, 0, 3, 191, 48, 3, 169, 168, 9, 99, 146, 156, 0, 136, 17, 152, 16, 200, 89, 147, 157, 84, 193, 157, 34, 34, 200, 28, 161, 75, 23, 186, 25, 8, 33, 1, 161, 207, 48, 36, 184, 174, 65, 130, 153, 8, 152, 41, 51, 152, 169, 188, 89, 21, 160, 172, 56, 37, 136, 220, 42, 52, 144, 201, 10, 51, 146, 189, 104, 130, 170, 128, 57, 22, 188, 48, 130, 170, 16, 0, 152, 88, 162, 142, 2, 26, 7, 186, 24, 2, 17, 217, 42, 147, 141, 51, 170, 34, 221, 57, 52, 130, 222, 25, 51, 145, 153, 204, 56, 5, 8, 162, 175, 65, 17, 152, 173, 81, 161, 10, 128, 65, 161, 10, 201, 58, 22, 169, 56, 163, 158, 34, 185, 116, 176, 173, 33, 36, 168, 170, 137, 48, 53, 176, 158, 1, 153, 114, 130, 169, 203, 41, 53, 130, 220, 9, 34, 0, 17, 192, 159, 48, 4, 154, 8, 153, 56, 37, 216, 140, 34, 144, 32, 144, 171, 72, 34, 129, 253, 41, 20, 154, 2, 219, 56, 20, 185, 10, 3, 140, 67, 186, 82, 184, 170, 9, 119, 160, 171, 32, 35, 168, 8, 184, 137, 81, 147, 156, 144, 10, 71, 176, 171, 48, 4, 153, 153, 154, 115, 19, 217, 156, 67, 144, 24, 168, 136, 137, 162, 92, 55, 251, 137, 33, 34, 176, 188, 32, 67, 161, 140, 147, 159, 51, 161, 137, 169, 26, 87, 144, 156, 18, 217, 88, 147, 154, 129, 171, 66, 19, 216, 141, 35, 144, 137, 137, 99, 146, 188, 27, 19, 9, 85, 161, 189, 42, 52, 144, 24, 233, 27, 38, 186, 72, 145, 11, 17, 137, 9, 32, 152, 64, 176, 60, 149, 14, 51, 219, 24, 19, 219, 57, 19, 33, 250, 11, 20, 144, 137, 32, 168, 172, 16, 87, 184, 140, 34, 128, 49, 192, 158, 48, 1, 25, 129, 190, 41, 36, 1, 153, 216, 140, 84, 161, 154, 24, 19, 186, 49, 249, 58, 23, 186, 26, 67, 177, 141, 16, 34, 176, 157, 34, 0, 130, 188, 24, 83, 163, 191, 41, 82, 2, 235, 25, 19, 136, 51, 5, 61, 0, 152, 152, 33, 147, 239, 81, 145, 138, 1, 154, 136, 114, 145, 140, 33, 168, 26, 34, 152, 184, 175, 115, 147, 157, 33, 152, 33, 192, 11, 4, 169, 32, 19, 250, 40, 178, 90, 162, 28, 19, 203, 138, 53, 160, 41, 178, 159, 2, 9, 68, 168, 152, 204, 97, 2, 201, 10, 17, 48, 19, 221, 25, 1, 18, 168, 169, 41, 23, 186, 8, 17, 130, 25, 195, 239, 81, 130, 169, 201, 56, 5, 153, 17, 169, 9, 17, 176, 96, 132, 189, 25, 50, 35, 200, 205, 40, 36, 144, 187, 104, 162, 157, 50, 129, 200, 26, 37, 152, 168, 157, 50, 130, 33, 234, 170, 25, 70, 144, 8, 184, 12, 16, 68, 193, 141, 17, 0, 129, 171, 33, 154, 103, 176, 173, 64, 20, 169, 171, 56, 20, 137, 8, 129, 170, 128, 9, 22, 153, 16, 201, 140, 69, 160, 138, 0, 16, 152, 50, 252, 96, 147, 173, 16, 2, 129, 186, 41, 52, 209, 157, 51, 176, 56, 184, 25, 161, 155, 115, 135, 159, 49, 1, 169, 154, 25, 101, 145, 172, 9, 33, 34, 168, 169, 154, 80, 36, 161, 190, 41, 52, 176, 156, 49, 0, 144, 190, 96, 3, 187, 16, 16, 2, 155, 176, 175, 84, 3, 235, 10, 17, 50, 194, 172, 48, 19, 1, 233, 171, 66, 19, 200, 188, 80, 20, 202, 41, 129, 10, 50, 128, 201, 188, 73, 39, 160, 169, 9, 18, 0, 200, 43, 133, 138, 18, 137, 35, 200, 219, 10, 53, 17, 184, 173, 40, 69, 146, 205, 8, 65, 3, 171, 153, 157, 99, 129, 8, 218, 40, 129, 82, 160, 172, 48, 51, 249, 172, 65, 19, 168, 187, 56, 39, 176, 174, 72, 20, 184, 171, 48, 4, 136, 136, 154, 25, 67, 16, 128, 222, 40, 20, 168, 203, 48, 5, 136, 217, 26, 38, 160, 153, 9, 34, 168, 58, 179, 191, 68, 129, 153, 170, 11, 86, 2, 203, 154, 32, 66, 145, 170, 137, 136, 56, 54, 200, 10, 49, 226, 158, 36, 152, 9, 24, 3, 204, 25, 34, 99, 177, 175, 16, 34, 129, 154, 168, 26, 37, 168, 139, 115, 147, 189, 153, 114, 131, 188, 41, 50, 160, 140, 17, 0, 51, 251, 27, 128, 112, 4, 218, 154, 66, 128, 136, 8, 128, 8, 193, 59, 7, 136, 176, 141, 36, 144, 9, 136, 16, 34, 250, 157, 66, 35, 184, 172, 9, 114, 130, 188, 25, 67, 145, 172, 9, 82, 19, 235, 9, 16, 17, 169, 153, 97, 3, 191, 40, 3, 0, 146, 175, 72, 2, 137, 0, 168, 156, 99, 160, 154, 18, 0, 24, 35, 184, 189, 12, 53, 152, 16, 250, 10, 33, 37, 200, 138, 1, 16, 0, 48, 248, 142, 82, 129, 170, 128, 185, 112, 146, 11, 35, 137, 0, 219, 154, 82, 3, 218, 9, 50, 129, 170, 155, 116, 146, 173, 64, 18, 169, 172, 49, 146, 25, 240, 140, 83, 3, 201, 139, 65, 18, 152, 202, 173, 32, 125, 235, 64, 0, 69, 145, 186, 138, 99, 130, 170, 153, 136, 33, 130, 136, 16, 200, 11, 71, 160, 172, 32, 20, 33, 208, 189, 153, 81, 36, 145, 235, 138, 51, 17, 34, 248, 171, 8, 51, 147, 171, 138, 83, 130, 170, 136, 152, 33, 51, 216, 172, 32, 69, 176, 191, 88, 3, 218, 26, 69, 161, 156, 16, 130, 185, 137, 33, 36, 168, 173, 64, 20, 17, 219, 11, 128, 98, 130, 203, 137, 33, 3, 8, 216, 139, 18, 49, 54, 144, 144, 235, 138, 168, 25, 35, 144, 33, 216, 140, 69, 160, 10, 38, 248, 155, 64, 19, 128, 185, 189, 41, 37, 129, 153, 8, 18, 130, 203, 41, 132, 186, 32, 146, 223, 139, 83, 52, 2, 235, 156, 49, 20, 1, 218, 171, 32, 18, 24, 130, 174, 64, 4, 136, 24, 152, 172, 32, 161, 156, 40, 83, 68, 177, 191, 10, 33, 67, 17, 129, 188, 155, 99, 146, 172, 16, 170, 80, 3, 171, 16, 16, 130, 222, 41, 69, 1, 219, 170, 32, 53, 144, 186, 219, 25, 55, 129, 152, 172, 72, 19, 185, 219, 171, 97, 19, 1, 176, 171, 24, 49, 1, 201, 191, 40, 36, 35, 193, 173, 24, 17, 8, 144, 186, 113, 52, 144, 170, 153, 16, 233, 26, 19, 9, 54, 131, 153, 185, 155, 68, 208, 172, 8, 49, 21, 168, 137, 129, 202, 156, 33, 128, 98, 2, 129, 222, 170, 138, 50, 34, 176, 58, 55, 17, 192, 155, 1, 191, 139, 144, 136, 16, 34, 18, 51, 192, 189, 57, 87, 2, 185, 156, 65, 2, 186, 72, 36, 128, 68, 3, 24, 55, 145, 154, 136, 32, 19, 0, 168, 96, 20, 34, 85, 35, 152, 65, 130, 32, 3, 220, 138, 32, 144, 139, 34, 0, 102, 36, 160, 172, 137, 17, 136, 170, 16, 192, 206, 170, 202, 10, 67, 201, 171, 137, 137, 217, 188, 187, 206, 204, 154, 128, 169, 155, 8, 168, 155, 184, 239, 137, 129, 202, 187, 169, 153, 136, 128, 234, 138, 35, 169, 114, 20, 1, 33, 129, 253, 155, 49, 20, 168, 137, 154, 40, 53, 53, 18, 136, 81, 4, 185, 24, 0, 152, 236, 189, 9, 17, 64, 36, 48, 68, 130, 40, 2, 172, 8, 234, 171, 152, 136, 168, 9, 101, 19, 24, 54, 19, 1, 0, 218, 139, 168, 42, 54, 168, 40, 161, 155, 249, 207, 203, 222, 170, 0, 82, 54, 18, 16, 1, 169, 9, 128, 49, 131, 172, 65, 18, 114, 69, 17, 17, 0, 16, 66, 2, 17, 1, 235, 171, 154, 9, 82, 51, 35, 1, 16, 168, 219, 235, 206, 187, 202, 156, 137, 152, 136, 153, 186, 203, 189, 153, 152, 186, 206, 171, 219, 187, 138, 144, 137, 49, 2, 0, 66, 38, 168, 155, 153, 187, 10, 99, 69, 67, 50, 51, 52, 67, 51, 66, 36, 144, 26, 2, 168, 25, 54, 1, 49, 51, 33, 17, 144, 234, 255, 137, 128, 187, 9, 168, 185, 191, 172, 169, 171, 155, 121, 222, 44, 0, 169, 139, 50, 209, 172, 170, 205, 173, 155, 8, 99, 67, 1, 8, 8, 136, 128, 81, 54, 33, 18, 34, 66, 67, 52, 36, 129, 137, 33, 2, 65, 86, 34, 130, 201, 155, 40, 17, 66, 52, 161, 206, 187, 186, 25, 99, 34, 1, 169, 187, 172, 153, 154, 185, 223, 186, 154, 49, 67, 19, 201, 237, 187, 154, 49, 18, 66, 36, 128, 169, 170, 205, 137, 83, 36, 52, 68, 18, 153, 0, 17, 144, 170, 0, 152, 152, 113, 21, 25, 51, 250, 190, 189, 155, 80, 69, 68, 52, 34, 0, 136, 169, 8, 152, 136, 8, 33, 100, 68, 35, 34, 1, 128, 152, 136, 136, 144, 218, 204, 188, 188, 10, 128, 50, 4, 152, 220, 205, 172, 186, 188, 219, 187, 186, 170, 137, 33, 34, 136, 218, 221, 170, 169, 170, 9, 160, 187, 24, 18, 116, 52, 51, 51, 34, 17, 49, 50, 52, 3, 16, 99, 99, 68, 52, 53, 19, 18, 2, 186, 171, 186, 205, 138, 0, 152, 203, 9, 169, 203, 169, 253, 204, 171, 203, 187, 187, 170, 219, 188, 170, 136, 136, 16, 129, 152, 220, 188, 138, 17, 52, 53, 68, 52, 51, 53, 36, 34, 18, 33, 129, 16, 84, 51, 51, 52, 67, 51, 19, 33, 34, 184, 204, 187, 204, 169, 169, 170, 202, 204, 203, 186, 170, 187, 187, 223, 188, 172, 187, 154, 9, 32, 2, 129, 184, 204, 202, 187, 171, 171, 139, 101, 84, 67, 67, 34, 17, 1, 34, 68, 37, 2, 0, 136, 40, 51, 102, 52, 50, 36, 2, 8, 17, 8, 34, 233, 10, 177, 175, 136, 154, 160, 239, 203, 220, 170, 72, 52, 67, 52, 19, 201, 187, 171, 153, 153, 66, 18, 1, 48, 103, 34, 34, 0, 152, 185, 170, 25, 19, 8, 208, 190, 203, 137, 18, 115, 36, 0, 160, 203, 189, 157, 169, 171, 154, 153, 152, 32, 53, 20, 145, 203, 205, 187, 170, 154, 152, 32, 1, 16, 69, 50, 67, 50, 1, 129, 168, 153, 187, 89, 38, 17, 50, 52, 100, 68, 67, 35, 1, 169, 219, 188, 154, 136, 16, 34, 19, 33, 50, 19, 250, 205, 188, 189, 171, 138, 153, 154, 152, 201, 204, 154, 0, 0, 16, 17, 184, 191, 188, 188, 138, 49, 70, 67, 52, 36, 51, 33, 1, 168, 137, 137, 64, 86, 67, 51, 51, 33, 129, 185, 170, 153, 169, 138, 130, 153, 17, 218, 207, 219, 187, 154, 202, 154, 129, 205, 154, 251, 203, 154, 137, 0, 32, 68, 2, 0, 129, 169, 202, 187, 187, 27, 102, 52, 53, 36, 18, 128, 136, 144, 9, 83, 20, 18, 32, 18, 0, 83, 34, 67, 2, 153, 25, 168, 173, 168, 206, 203, 204, 9, 128, 8, 129, 220, 171, 218, 188, 138, 16, 17, 0, 40, 232, 191, 137, 186, 42, 35, 41, 53, 169, 24, 249, 219, 206, 139, 33, 100, 69, 52, 35, 1, 169, 170, 251, 138, 1, 32, 66, 67, 35, 33, 17, 15, 126, 59, 0, 0, 152, 202, 189, 153, 171, 56, 34, 50, 161, 203, 207, 170, 153, 8, 201, 187, 237, 188, 186, 204, 154, 152, 8, 16, 82, 18, 128, 168, 206, 172, 172, 170, 8, 33, 83, 83, 35, 18, 18, 168, 137, 169, 138, 136, 48, 85, 83, 67, 67, 33, 17, 129, 16, 17, 1, 161, 222, 203, 188, 171, 24, 50, 50, 51, 0, 234, 205, 203, 204, 187, 172, 171, 153, 16, 34, 2, 128, 186, 205, 219, 171, 170, 153, 8, 49, 52, 54, 52, 51, 36, 67, 51, 66, 51, 67, 34, 34, 2, 80, 55, 51, 53, 53, 19, 16, 145, 155, 169, 171, 152, 188, 57, 35, 34, 71, 34, 136, 206, 172, 188, 188, 153, 137, 136, 8, 8, 8, 169, 16, 129, 64, 161, 175, 154, 219, 138, 83, 33, 52, 36, 34, 68, 34, 68, 34, 128, 152, 9, 160, 58, 119, 18, 50, 51, 2, 169, 154, 202, 172, 8, 8, 145, 238, 153, 218, 137, 144, 154, 168, 236, 188, 186, 188, 137, 152, 25, 3, 203, 8, 144, 153, 34, 217, 187, 238, 10, 20, 32, 70, 51, 33, 51, 192, 43, 21, 153, 115, 35, 1, 0, 129, 32, 249, 140, 200, 191, 40, 68, 68, 84, 34, 16, 136, 202, 203, 155, 137, 40, 53, 67, 35, 17, 17, 16, 144, 202, 190, 204, 170, 9, 34, 68, 34, 17, 184, 188, 187, 188, 188, 171, 202, 188, 138, 186, 9, 17, 0, 168, 25, 184, 207, 170, 235, 219, 187, 170, 9, 82, 52, 53, 51, 35, 129, 170, 219, 172, 154, 170, 56, 69, 68, 52, 51, 20, 129, 169, 203, 188, 154, 8, 24, 34, 18, 34, 33, 53, 146, 220, 187, 222, 187, 154, 154, 137, 152, 8, 152, 137, 152, 235, 189, 187, 235, 187, 156, 154, 8, 49, 69, 52, 35, 35, 128, 153, 8, 35, 35, 100, 53, 68, 35, 36, 67, 18, 33, 50, 51, 51, 65, 2, 171, 82, 2, 50, 36, 70, 130, 0, 51, 144, 154, 233, 191, 155, 186, 189, 8, 129, 16, 18, 168, 204, 187, 189, 172, 9, 152, 202, 8, 136, 40, 53, 35, 19, 185, 32, 168, 113, 119, 18, 16, 17, 0, 24, 32, 50, 17, 84, 34, 69, 36, 17, 136, 170, 172, 128, 8, 68, 1, 83, 177, 139, 184, 207, 153, 184, 171, 185, 204, 203, 173, 137, 184, 157, 128, 236, 155, 8, 8, 8, 16, 161, 205, 154, 66, 34, 67, 36, 201, 140, 128, 0, 115, 37, 2, 32, 35, 128, 48, 53, 146, 80, 37, 0, 128, 66, 177, 56, 165, 223, 187, 154, 136, 114, 103, 35, 17, 128, 169, 220, 155, 153, 8, 51, 36, 66, 51, 18, 17, 136, 250, 189, 172, 154, 25, 51, 69, 34, 1, 169, 203, 219, 170, 170, 170, 8, 1, 24, 34, 17, 161, 207, 172, 172, 170, 154, 0, 1, 145, 170, 220, 170, 8, 49, 82, 52, 2, 128, 218, 171, 202, 137, 185, 25, 98, 71, 34, 52, 19, 144, 218, 175, 233, 57, 0, 187, 188, 24, 17, 49, 67, 52, 16, 83, 35, 161, 220, 187, 190, 155, 0, 35, 51, 53, 2, 136, 153, 204, 188, 188, 172, 137, 0, 35, 84, 36, 18, 128, 136, 234, 171, 8, 1, 24, 69, 35, 19, 66, 37, 128, 144, 152, 152, 40, 84, 84, 50, 34, 128, 153, 152, 154, 16, 83, 37, 34, 18, 33, 36, 137, 136, 219, 221, 155, 136, 25, 50, 71, 19, 137, 152, 219, 172, 153, 136, 25, 2, 33, 129, 24, 50, 34, 160, 251, 190, 187, 203, 32, 53, 66, 51, 160, 202, 188, 155, 48, 52, 70, 18, 152, 220, 171, 8, 8, 67, 67, 19, 169, 169, 153, 137, 16, 1, 253, 174, 153, 153, 48, 52, 49, 34, 185, 207, 171, 168, 170, 139, 50, 251, 159, 33, 1, 33, 4, 186, 137, 236, 138, 1, 32, 19, 1, 153, 137, 96, 54, 1, 33, 2, 168, 140, 69, 34, 51, 50, 130, 171, 17, 65, 70, 52, 18, 169, 187, 96, 35, 115, 21, 8, 136, 219, 170, 24, 33, 52, 1, 33, 177, 156, 160, 205, 235, 188, 187, 173, 26, 69, 53, 37, 35, 18, 202, 188, 187, 172, 138, 49, 52, 68, 67, 34, 18, 152, 203, 204, 203, 186, 137, 33, 83, 52, 35, 1, 185, 205, 172, 203, 154, 154, 8, 17, 50, 34, 161, 204, 235, 189, 187, 187, 171, 8, 1, 50, 36, 17, 160, 191, 172, 204, 154, 153, 153, 32, 66, 67, 35, 34, 144, 204, 203, 154, 169, 24, 52, 83, 68, 50, 50, 35, 19, 200, 171, 169, 189, 25, 50, 52, 68, 68, 52, 2, 8, 129, 205, 137, 185, 188, 139, 34, 82, 68, 51, 20, 128, 128, 204, 187, 170, 170, 170, 81, 86, 52, 50, 67, 18, 129, 185, 169, 221, 138, 33, 51, 101, 35, 34, 34, 128, 152, 204, 155, 153, 128, 82, 52, 50, 52, 130, 144, 153, 235, 189, 171, 155, 40, 68, 51, 18, 160, 205, 202, 188, 138, 153, 136, 99, 18, 32, 18, 187, 137, 220, 171, 169, 24, 85, 18, 115, 34, 0, 35, 144, 154, 152, 25, 52, 153, 116, 23, 16, 50, 1, 0, 16, 128, 153, 218, 171, 16, 32, 71, 19, 16, 68, 144, 137, 201, 170, 168, 154, 202, 155, 8, 82, 2, 50, 20, 184, 11, 210, 255, 137, 184, 172, 128, 170, 64, 36, 33, 35, 184, 188, 221, 186, 203, 154, 16, 67, 51, 67, 130, 204, 153, 185, 174, 153, 186, 9, 67, 52, 19, 17, 129, 221, 154, 218, 173, 136, 169, 32, 51, 50, 38, 232, 171, 185, 190, 9, 128, 153, 32, 20, 152, 236, 155, 128, 154, 115, 3, 16, 36, 176, 139, 251, 155, 168, 139, 50, 129, 115, 22, 16, 1, 201, 169, 202, 137, 202, 26, 4, 32, 36, 0, 1, 137, 0, 216, 156, 144, 207, 9, 168, 80, 36, 17, 18, 152, 169, 203, 137, 219, 139, 144, 24, 84, 37, 128, 153, 153, 153, 40, 36, 50, 162, 60, 71, 185, 198, 248, 36, 0, 154, 205, 137, 32, 69, 51, 131, 188, 16, 168, 157, 33, 186, 65, 129, 99, 145, 49, 240, 139, 161, 174, 128, 170, 40, 67, 35, 34, 35, 160, 218, 205, 187, 187, 156, 80, 18, 115, 21, 8, 1, 186, 152, 170, 170, 42, 19, 114, 53, 17, 129, 153, 186, 9, 252, 139, 152, 97, 36, 33, 3, 153, 32, 232, 171, 202, 155, 8, 64, 71, 1, 48, 19, 137, 8, 170, 219, 172, 8, 49, 52, 34, 3, 154, 86, 145, 9, 19, 235, 41, 36, 52, 128, 136, 219, 138, 40, 54, 34, 50, 20, 201, 155, 154, 24, 153, 117, 132, 155, 17, 8, 83, 53, 131, 185, 205, 171, 138, 1, 144, 32, 82, 69, 51, 129, 185, 173, 187, 155, 170, 218, 12, 34, 65, 71, 129, 137, 201, 171, 152, 16, 144, 137, 201, 41, 38, 33, 19, 203, 137, 153, 49, 208, 174, 169, 154, 153, 80, 36, 65, 38, 152, 8, 202, 139, 185, 43, 20, 24, 35, 186, 114, 129, 88, 36, 160, 219, 187, 154, 16, 67, 35, 1, 0, 32, 69, 66, 131, 223, 203, 153, 170, 24, 50, 55, 3, 17, 145, 204, 170, 136, 204, 138, 152, 25, 67, 53, 128, 32, 144, 11, 192, 174, 202, 171, 136, 65, 37, 2, 138, 34, 129, 34, 249, 174, 169, 154, 84, 3, 0, 8, 18, 17, 49, 2, 223, 187, 9, 67, 51, 52, 192, 172, 16, 33, 144, 24, 161, 223, 32, 130, 153, 152, 219, 10, 67, 129, 17, 234, 11, 18, 170, 66, 218, 170, 186, 24, 51, 201, 88, 146, 42, 38, 0, 67, 176, 223, 153, 186, 58, 37, 16, 35, 17, 40, 21, 187, 17, 251, 155, 185, 154, 68, 18, 66, 148, 155, 34, 234, 41, 161, 156, 67, 176, 11, 145, 74, 39, 144, 136, 137, 249, 11, 19, 187, 48, 3, 203, 115, 148, 171, 65, 161, 171, 152, 25, 37, 136, 100, 129, 99, 145, 153, 235, 139, 1, 49, 20, 1, 145, 157, 53, 129, 16, 233, 203, 154, 33, 17, 33, 217, 42, 36, 101, 21, 136, 169, 187, 24, 145, 255, 170, 185, 72, 70, 3, 0, 129, 203, 24, 144, 172, 185, 206, 25, 19, 65, 36, 0, 33, 169, 171, 217, 189, 136, 136, 49, 1, 51, 2, 113, 37, 144, 155, 235, 156, 17, 17, 128, 0, 168, 105, 38, 16, 144, 189, 10, 128, 1, 34, 176, 141, 34, 50, 53, 145, 187, 189, 172, 16, 33, 18, 216, 11, 50, 102, 19, 17, 192, 173, 154, 136, 137, 49, 200, 138, 136, 116, 55, 0, 144, 170, 187, 41, 1, 202, 154, 171, 115, 55, 32, 129, 170, 9, 0, 152, 186, 174, 137, 40, 69, 35, 2, 137, 144, 8, 18, 250, 189, 186, 9, 69, 19, 0, 128, 24, 33, 53, 200, 190, 172, 8, 33, 18, 34, 144, 57, 55, 19, 3, 235, 171, 171, 40, 34, 18, 176, 140, 1, 113, 69, 129, 153, 136, 152, 169, 32, 226, 173, 16, 154, 80, 209, 2, 29, 0, 130, 24, 51, 17, 0, 184, 219, 235, 187, 171, 170, 186, 114, 7, 10, 35, 202, 96, 176, 11, 200, 139, 3, 25, 2, 203, 202, 10, 67, 18, 152, 201, 189, 154, 57, 133, 140, 2, 173, 136, 156, 33, 33, 21, 137, 20, 204, 24, 184, 138, 129, 191, 40, 192, 42, 1, 100, 130, 8, 200, 156, 185, 174, 152, 189, 64, 130, 64, 19, 24, 4, 138, 201, 172, 219, 172, 137, 128, 16, 84, 67, 129, 8, 160, 204, 154, 171, 204, 138, 24, 82, 68, 51, 18, 1, 234, 171, 217, 156, 8, 8, 66, 67, 67, 33, 1, 9, 201, 173, 185, 188, 9, 65, 52, 67, 51, 19, 184, 10, 160, 190, 40, 162, 175, 32, 136, 84, 1, 32, 131, 154, 67, 144, 204, 173, 8, 9, 68, 17, 17, 98, 19, 9, 144, 155, 2, 223, 8, 201, 26, 3, 32, 36, 16, 49, 36, 33, 133, 174, 136, 189, 153, 0, 1, 48, 4, 115, 34, 82, 145, 153, 233, 156, 144, 25, 178, 27, 132, 43, 22, 137, 116, 2, 40, 145, 11, 208, 156, 160, 156, 129, 41, 71, 8, 35, 8, 34, 152, 186, 189, 204, 138, 137, 32, 129, 112, 38, 66, 130, 10, 176, 157, 153, 187, 188, 169, 156, 99, 67, 52, 51, 145, 138, 216, 175, 153, 185, 188, 56, 21, 32, 38, 16, 18, 24, 129, 204, 186, 191, 137, 137, 34, 0, 66, 1, 117, 2, 128, 176, 173, 153, 137, 3, 154, 200, 158, 66, 17, 67, 2, 152, 136, 169, 24, 249, 156, 186, 26, 52, 83, 36, 152, 154, 49, 177, 138, 250, 207, 136, 33, 49, 52, 16, 145, 138, 21, 187, 169, 191, 137, 136, 16, 24, 52, 18, 51, 65, 224, 42, 164, 12, 216, 11, 160, 156, 67, 51, 2, 218, 186, 155, 114, 2, 138, 169, 155, 117, 18, 0, 160, 173, 152, 25, 35, 186, 11, 33, 116, 52, 1, 218, 157, 8, 16, 70, 129, 137, 184, 171, 152, 136, 169, 11, 208, 74, 87, 0, 16, 168, 173, 153, 25, 19, 152, 152, 138, 99, 50, 34, 136, 33, 250, 42, 193, 159, 128, 154, 66, 34, 33, 19, 8, 36, 201, 136, 250, 204, 171, 16, 66, 53, 128, 24, 18, 128, 128, 152, 255, 138, 1, 25, 68, 146, 137, 20, 72, 71, 129, 152, 222, 154, 137, 8, 17, 32, 33, 33, 68, 51, 20, 233, 204, 170, 153, 16, 32, 52, 128, 114, 2, 0, 152, 188, 172, 136, 153, 32, 8, 33, 16, 103, 17, 33, 129, 154, 169, 187, 187, 189, 172, 24, 49, 87, 51, 18, 128, 128, 153, 185, 255, 170, 170, 41, 53, 35, 51, 129, 187, 40, 130, 250, 204, 138, 136, 32, 37, 136, 169, 171, 115, 5, 128, 152, 219, 138, 82, 19, 153, 154, 169, 40, 53, 1, 152, 185, 168, 10, 38, 202, 188, 154, 96, 70, 128, 128, 218, 25, 146, 24, 184, 173, 136, 114, 35, 17, 184, 172, 152, 153, 49, 195, 207, 225, 247, 52, 0, 48, 35, 53, 160, 171, 251, 9, 49, 2, 154, 154, 72, 38, 33, 200, 138, 128, 82, 176, 188, 174, 8, 49, 39, 33, 144, 171, 170, 139, 169, 72, 21, 160, 26, 55, 1, 185, 189, 16, 144, 97, 146, 186, 190, 26, 99, 18, 169, 188, 25, 68, 34, 17, 200, 190, 8, 1, 48, 176, 173, 32, 115, 51, 161, 157, 152, 27, 22, 154, 153, 25, 36, 68, 177, 25, 2, 56, 134, 170, 152, 154, 186, 41, 249, 80, 161, 141, 129, 136, 50, 21, 218, 172, 136, 0, 153, 83, 216, 58, 55, 1, 169, 169, 203, 25, 18, 168, 235, 156, 98, 19, 17, 177, 189, 137, 49, 37, 0, 201, 140, 65, 17, 144, 154, 144, 12, 69, 130, 10, 34, 232, 155, 152, 153, 114, 23, 8, 153, 139, 17, 0, 2, 237, 138, 34, 82, 131, 203, 170, 24, 130, 16, 193, 188, 137, 50, 35, 145, 236, 205, 26, 53, 18, 145, 188, 32, 1, 40, 52, 146, 206, 154, 8, 66, 35, 200, 171, 153, 113, 6, 152, 153, 171, 24, 100, 131, 170, 169, 138, 48, 87, 2, 201, 138, 0, 24, 36, 202, 157, 25, 65, 20, 128, 152, 153, 202, 41, 147, 173, 17, 136, 0, 40, 53, 0, 128, 145, 255, 73, 3, 138, 168, 173, 8, 16, 33, 35, 129, 186, 171, 43, 38, 138, 119, 129, 186, 57, 131, 11, 22, 170, 136, 40, 132, 237, 9, 1, 169, 105, 36, 169, 136, 152, 136, 51, 19, 144, 189, 8, 99, 3, 169, 204, 26, 144, 80, 147, 188, 155, 114, 38, 128, 136, 251, 155, 33, 19, 219, 56, 2, 136, 16, 2, 173, 17, 218, 57, 19, 24, 133, 207, 72, 3, 138, 17, 0, 128, 50, 248, 13, 17, 8, 3, 186, 32, 250, 58, 5, 203, 9, 36, 17, 129, 235, 40, 130, 203, 56, 39, 201, 139, 136, 17, 130, 40, 200, 13, 51, 152, 102, 177, 139, 1, 1, 216, 172, 33, 146, 155, 100, 131, 40, 20, 190, 25, 184, 11, 35, 0, 144, 9, 116, 3, 171, 56, 193, 239, 25, 34, 136, 136, 32, 4, 153, 17, 0, 84, 177, 189, 156, 24, 50, 5, 218, 9, 33, 50, 145, 33, 250, 142, 50, 2, 185, 154, 154, 82, 51, 168, 157, 136, 137, 86, 160, 174, 25, 34, 34, 146, 168, 173, 66, 160, 41, 18, 250, 141, 50, 16, 18, 218, 154, 82, 2, 185, 186, 11, 54, 169, 113, 147, 187, 9, 137, 17, 24, 38, 234, 10, 33, 1, 48, 161, 188, 207, 96, 4, 168, 138, 0, 138, 52, 129, 16, 251, 140, 49, 18, 153, 128, 173, 32, 0, 83, 161, 187, 138, 51, 99, 21, 251, 156, 129, 49, 4, 136, 185, 27, 67, 35, 217, 171, 153, 100, 146, 139, 145, 156, 49, 37, 129, 169, 188, 40, 128, 41, 162, 141, 50, 144, 152, 113, 150, 188, 50, 200, 64, 4, 203, 26, 33, 8, 17, 252, 9, 34, 129, 51, 248, 142, 49, 1, 24, 10, 65, 0, 170, 25, 2, 171, 24, 101, 132, 204, 25, 17, 2, 128, 168, 204, 41, 54, 128, 201, 140, 51, 1, 144, 137, 219, 42, 23, 185, 9, 35, 129, 170, 153, 219, 113, 21, 169, 171, 24, 34, 145, 154, 130, 188, 117, 5, 169, 187, 25, 35, 1, 161, 174, 48, 18, 137, 48, 18, 136, 218, 25, 249, 140, 68, 131, 186, 40, 145, 56, 179, 175, 52, 184, 27, 145, 56, 132, 158, 8, 187, 112, 22, 200, 10, 17, 137, 34, 188, 56, 146, 72, 132, 205, 40, 129, 56, 21, 235, 138, 49, 37, 152, 202, 155, 41, 70, 162, 170, 185, 42, 71, 161, 171, 25, 51, 160, 33, 249, 13, 35, 16, 168, 155, 83, 177, 141, 33, 129, 25, 51, 233, 139, 67, 130, 207, 42, 38, 176, 138, 0, 153, 16, 130, 8, 168, 156, 51, 129, 40, 67, 36, 251, 189, 42, 54, 144, 152, 186, 41, 55, 130, 204, 10, 48, 35, 234, 154, 32, 55, 145, 187, 140, 65, 19, 152, 236, 25, 19, 17, 168, 42, 179, 142, 34, 144, 25, 53, 232, 189, 24, 53, 161, 170, 9, 69, 162, 190, 25, 68, 145, 187, 9, 18, 1, 16, 136, 155, 32, 1, 113, 3, 205, 153, 16, 1, 48, 5, 188, 152, 10, 103, 145, 170, 153, 66, 144, 155, 34, 217, 72, 35, 168, 220, 155, 114, 37, 185, 171, 9, 66, 35, 184, 189, 10, 50, 53, 160, 187, 26, 68, 200, 9, 145, 56, 1, 34, 252, 12, 17, 50, 131, 188, 138, 48, 34, 32, 176, 175, 24, 176, 72, 52, 36, 252, 13, 50, 20, 233, 10, 129, 0, 0, 137, 0, 136, 35, 185, 153, 139, 119, 147, 187, 136, 170, 81, 18, 18, 236, 154, 40, 70, 129, 169, 172, 72, 3, 153, 128, 154, 24, 3, 203, 16, 0, 53, 168, 65, 19, 252, 154, 17, 68, 162, 223, 137, 65, 35, 176, 171, 33, 35, 160, 174, 9, 50, 216, 139, 34, 35, 35, 251, 27, 20, 154, 51, 218, 10, 34, 192, 174, 40, 67, 144, 32, 177, 27, 2, 84, 193, 28, 147, 190, 136, 49, 163, 28, 23, 168, 0, 0, 36, 252, 12, 34, 129, 128, 186, 138, 66, 50, 129, 171, 152, 112, 4, 171, 186, 139, 128, 101, 146, 187, 8, 84, 3, 203, 25, 34, 200, 190, 56, 36, 1, 160, 190, 40, 53, 128, 173, 24, 8, 84, 162, 189, 137, 97, 2, 170, 171, 56, 54, 145, 169, 154, 16, 35, 176, 190, 10, 33, 99, 2, 154, 153, 187, 89, 39, 1, 233, 172, 32, 37, 161, 172, 32, 16, 50, 200, 170, 137, 84, 162, 157, 8, 33, 130, 155, 17, 170, 66, 144, 187, 120, 21, 153, 202, 9, 1, 35, 188, 114, 146, 185, 156, 100, 35, 233, 172, 16, 50, 1, 218, 138, 99, 130, 202, 25, 34, 128, 202, 155, 82, 35, 177, 190, 26, 52, 35, 201, 189, 25, 68, 2, 170, 170, 10, 68, 145, 168, 154, 33, 68, 145, 229, 21, 64, 0, 173, 24, 146, 137, 33, 184, 44, 55, 218, 10, 16, 99, 145, 188, 10, 82, 18, 185, 140, 33, 144, 8, 18, 152, 154, 218, 121, 6, 187, 32, 130, 8, 184, 156, 51, 161, 26, 53, 248, 11, 20, 153, 16, 51, 193, 156, 34, 252, 10, 36, 0, 19, 220, 41, 17, 34, 234, 138, 9, 69, 144, 137, 217, 41, 21, 154, 34, 234, 41, 19, 168, 154, 0, 64, 177, 142, 128, 56, 23, 136, 186, 42, 54, 128, 217, 155, 16, 40, 22, 169, 138, 56, 55, 232, 139, 50, 128, 169, 9, 67, 160, 173, 9, 84, 145, 155, 34, 24, 3, 221, 10, 50, 2, 169, 187, 26, 103, 184, 42, 20, 136, 234, 26, 35, 136, 8, 169, 26, 69, 216, 139, 67, 168, 48, 146, 10, 249, 58, 7, 169, 136, 9, 34, 136, 161, 141, 37, 152, 50, 251, 57, 193, 27, 36, 137, 128, 152, 187, 88, 38, 3, 251, 142, 49, 130, 154, 17, 218, 48, 146, 64, 161, 173, 9, 50, 146, 96, 209, 141, 50, 144, 136, 168, 137, 25, 85, 129, 203, 137, 8, 54, 176, 139, 1, 34, 250, 43, 53, 128, 217, 139, 65, 51, 248, 156, 65, 1, 168, 138, 66, 129, 153, 171, 25, 66, 35, 218, 156, 56, 53, 128, 170, 188, 139, 70, 129, 145, 188, 33, 185, 117, 177, 171, 24, 67, 129, 0, 250, 140, 67, 130, 171, 32, 161, 138, 19, 0, 161, 171, 0, 16, 17, 16, 217, 138, 250, 112, 39, 185, 188, 137, 100, 3, 219, 26, 34, 128, 160, 155, 68, 200, 25, 35, 169, 139, 66, 144, 174, 64, 131, 155, 32, 19, 203, 138, 173, 117, 146, 187, 9, 50, 2, 137, 160, 204, 10, 87, 1, 170, 187, 58, 71, 144, 186, 138, 83, 145, 136, 169, 48, 145, 33, 250, 43, 22, 169, 152, 8, 5, 154, 35, 235, 56, 20, 185, 173, 48, 37, 169, 8, 170, 49, 161, 58, 22, 235, 26, 33, 37, 217, 155, 40, 69, 146, 205, 24, 131, 9, 83, 160, 189, 25, 51, 35, 192, 190, 40, 35, 33, 161, 207, 25, 66, 1, 168, 186, 138, 100, 130, 187, 25, 18, 136, 67, 200, 156, 32, 35, 200, 10, 1, 137, 136, 48, 4, 41, 226, 191, 82, 129, 8, 169, 26, 68, 160, 141, 50, 200, 9, 154, 82, 161, 72, 163, 223, 33, 2, 2, 206, 57, 20, 8, 185, 141, 50, 2, 184, 157, 49, 35, 168, 188, 80, 177, 59, 7, 155, 137, 33, 168, 114, 179, 175, 33, 2, 24, 184, 155, 50, 3, 171, 53, 253, 25, 20, 144, 154, 0, 56, 37, 218, 26, 145, 11, 53, 152, 128, 204, 57, 38, 176, 174, 66, 130, 154, 154, 57, 39, 176, 172, 24, 34, 33, 2, 236, 154, 67, 146, 154, 18, 218, 64, 193, 11, 37, 128, 153, 153, 139, 68, 129, 0, 217, 11, 52, 129, 186, 168, 11, 71, 176, 154, 24, 86, 160, 158, 16, 18, 144, 154, 152, 48, 18, 251, 62, 0, 132, 58, 211, 159, 65, 17, 152, 169, 186, 88, 20, 136, 152, 219, 41, 39, 145, 187, 26, 33, 33, 3, 189, 139, 40, 69, 129, 203, 155, 115, 146, 171, 66, 192, 137, 8, 50, 4, 188, 26, 33, 35, 201, 154, 57, 23, 188, 24, 51, 132, 221, 24, 35, 128, 202, 10, 66, 19, 222, 57, 5, 170, 32, 201, 42, 53, 146, 189, 24, 17, 16, 0, 186, 11, 162, 120, 39, 219, 26, 34, 130, 169, 186, 154, 85, 130, 137, 176, 158, 66, 19, 201, 139, 33, 1, 201, 48, 179, 43, 130, 155, 33, 184, 105, 21, 153, 200, 174, 115, 145, 139, 2, 187, 114, 3, 202, 170, 49, 18, 49, 248, 187, 26, 85, 19, 185, 189, 10, 84, 18, 152, 190, 42, 52, 130, 202, 153, 24, 68, 145, 219, 26, 66, 18, 220, 9, 50, 18, 201, 173, 48, 36, 168, 10, 146, 175, 98, 129, 137, 153, 9, 19, 18, 250, 27, 20, 153, 48, 161, 157, 32, 34, 1, 217, 174, 56, 23, 144, 202, 26, 67, 129, 168, 203, 81, 3, 170, 202, 72, 19, 168, 154, 56, 19, 217, 25, 2, 24, 233, 140, 52, 1, 184, 142, 0, 97, 163, 158, 50, 185, 40, 168, 99, 176, 137, 186, 113, 2, 169, 170, 80, 4, 201, 138, 82, 145, 155, 16, 16, 184, 42, 37, 146, 191, 64, 1, 144, 172, 49, 33, 147, 207, 49, 177, 58, 21, 203, 10, 50, 51, 209, 207, 72, 19, 184, 139, 32, 18, 129, 222, 57, 6, 153, 9, 0, 16, 152, 9, 136, 16, 16, 35, 169, 249, 159, 99, 2, 186, 170, 73, 22, 168, 139, 40, 17, 152, 24, 145, 139, 50, 162, 223, 81, 130, 152, 202, 140, 116, 161, 138, 16, 0, 152, 8, 129, 8, 136, 152, 8, 17, 98, 131, 223, 8, 98, 131, 206, 8, 34, 35, 218, 139, 33, 2, 152, 1, 234, 56, 147, 27, 146, 89, 211, 141, 33, 1, 153, 34, 235, 40, 1, 17, 234, 10, 52, 130, 202, 173, 64, 39, 184, 173, 48, 20, 152, 186, 10, 53, 130, 185, 187, 42, 54, 17, 185, 174, 24, 36, 18, 217, 156, 34, 0, 17, 168, 169, 156, 99, 20, 249, 10, 34, 33, 201, 172, 48, 53, 168, 140, 0, 154, 68, 161, 154, 138, 65, 2, 152, 202, 26, 55, 184, 10, 152, 32, 1, 36, 251, 28, 130, 56, 23, 219, 10, 33, 35, 160, 187, 187, 115, 135, 187, 24, 67, 161, 170, 11, 69, 152, 136, 139, 34, 137, 17, 219, 97, 2, 218, 155, 98, 18, 160, 190, 32, 20, 144, 186, 49, 168, 97, 232, 25, 18, 0, 169, 41, 161, 43, 5, 137, 152, 137, 185, 115, 135, 171, 16, 17, 145, 170, 25, 1, 112, 147, 158, 144, 12, 55, 152, 186, 25, 21, 154, 32, 137, 52, 237, 41, 20, 169, 8, 152, 56, 7, 188, 56, 19, 153, 137, 144, 9, 36, 153, 187, 113, 1, 136, 202, 32, 130, 32, 160, 166, 2, 51, 0, 173, 170, 117, 161, 28, 20, 187, 24, 8, 39, 233, 10, 35, 128, 136, 186, 57, 6, 154, 17, 169, 18, 33, 242, 157, 50, 2, 170, 8, 0, 161, 159, 99, 2, 203, 10, 34, 17, 177, 175, 33, 18, 130, 188, 136, 26, 71, 201, 24, 161, 57, 132, 156, 40, 35, 248, 11, 19, 25, 36, 204, 41, 144, 104, 131, 188, 32, 144, 139, 114, 130, 170, 136, 169, 97, 146, 41, 196, 157, 18, 49, 209, 11, 145, 26, 39, 144, 187, 139, 101, 145, 155, 128, 17, 145, 41, 18, 218, 187, 113, 130, 10, 129, 24, 177, 158, 49, 37, 201, 156, 49, 19, 184, 158, 65, 2, 170, 171, 97, 3, 204, 32, 3, 202, 24, 1, 49, 193, 155, 186, 96, 51, 144, 191, 24, 34, 51, 201, 139, 161, 141, 4, 57, 39, 188, 2, 158, 68, 184, 42, 145, 9, 2, 65, 209, 174, 81, 130, 154, 1, 170, 57, 36, 160, 156, 33, 201, 73, 37, 184, 174, 33, 145, 81, 162, 171, 153, 26, 70, 161, 171, 32, 129, 24, 224, 42, 23, 202, 24, 17, 17, 201, 10, 145, 56, 55, 234, 154, 50, 18, 153, 185, 171, 114, 5, 153, 154, 10, 34, 66, 146, 221, 26, 35, 17, 145, 205, 25, 51, 129, 153, 188, 57, 37, 145, 204, 40, 37, 185, 171, 81, 4, 171, 32, 152, 186, 90, 22, 9, 168, 172, 33, 34, 50, 248, 156, 17, 40, 38, 202, 9, 144, 26, 22, 152, 24, 201, 41, 146, 113, 162, 173, 16, 18, 170, 115, 161, 172, 24, 49, 130, 153, 186, 113, 192, 73, 131, 172, 0, 0, 17, 34, 233, 140, 33, 50, 160, 11, 249, 43, 39, 168, 168, 138, 83, 129, 169, 8, 202, 81, 128, 33, 185, 42, 217, 113, 162, 154, 152, 97, 145, 9, 144, 26, 17, 160, 139, 69, 217, 25, 0, 51, 218, 65, 208, 155, 66, 19, 152, 218, 171, 99, 3, 136, 201, 155, 32, 35, 33, 20, 239, 40, 1, 24, 145, 186, 171, 101, 130, 187, 9, 49, 53, 234, 26, 16, 1, 8, 21, 236, 25, 2, 0, 144, 137, 1, 152, 11, 71, 184, 41, 192, 12, 69, 200, 24, 144, 9, 1, 16, 168, 48, 248, 75, 133, 154, 16, 0, 186, 56, 130, 16, 136, 36, 251, 44, 3, 140, 54, 249, 10, 20, 152, 24, 144, 137, 137, 56, 36, 144, 188, 0, 186, 115, 147, 170, 0, 186, 114, 164, 28, 147, 157, 67, 160, 171, 48, 4, 11, 146, 13, 4, 155, 67, 185, 49, 248, 138, 34, 0, 32, 225, 157, 34, 0, 18, 201, 9, 169, 72, 36, 184, 139, 130, 155, 68, 160, 16, 168, 170, 175, 84, 130, 204, 25, 35, 144, 138, 19, 173, 99, 192, 138, 33, 160, 57, 131, 56, 226, 158, 49, 161, 138, 1, 187, 115, 135, 187, 56, 20, 137, 153, 25, 177, 28, 23, 186, 56, 129, 1, 218, 24, 66, 147, 28, 151, 175, 66, 128, 136, 186, 56, 166, 254, 37, 0, 20, 170, 56, 1, 1, 218, 137, 1, 49, 20, 144, 253, 154, 49, 38, 145, 186, 157, 81, 130, 154, 0, 1, 169, 64, 178, 141, 51, 232, 10, 51, 3, 251, 137, 17, 16, 18, 208, 173, 48, 50, 38, 250, 10, 3, 169, 49, 132, 203, 9, 0, 1, 113, 132, 189, 24, 50, 144, 16, 235, 40, 19, 168, 10, 131, 175, 50, 18, 152, 155, 128, 157, 66, 34, 193, 75, 164, 207, 65, 130, 153, 8, 171, 64, 35, 19, 251, 10, 18, 153, 115, 192, 154, 0, 16, 34, 145, 153, 217, 140, 84, 2, 168, 219, 26, 68, 128, 138, 128, 187, 96, 18, 137, 136, 153, 170, 16, 115, 19, 203, 169, 172, 117, 145, 139, 16, 152, 9, 67, 144, 16, 234, 12, 99, 145, 155, 32, 161, 139, 36, 154, 33, 128, 152, 89, 5, 234, 171, 81, 18, 152, 170, 49, 241, 172, 115, 2, 152, 202, 10, 33, 17, 34, 216, 172, 40, 66, 21, 219, 25, 145, 41, 3, 8, 168, 205, 40, 38, 216, 26, 34, 137, 16, 152, 203, 42, 55, 144, 170, 140, 50, 161, 24, 168, 41, 129, 56, 225, 159, 65, 129, 153, 144, 12, 87, 160, 185, 172, 83, 17, 128, 139, 18, 169, 157, 83, 168, 40, 200, 57, 39, 185, 12, 130, 152, 128, 32, 129, 137, 173, 115, 147, 235, 26, 51, 34, 145, 207, 24, 130, 137, 8, 40, 179, 143, 36, 144, 0, 160, 137, 16, 168, 139, 176, 143, 67, 17, 4, 188, 97, 145, 171, 138, 67, 192, 72, 163, 141, 18, 10, 53, 248, 156, 83, 145, 139, 129, 138, 84, 2, 235, 154, 16, 49, 2, 152, 188, 40, 19, 136, 48, 176, 73, 132, 10, 145, 73, 55, 241, 207, 56, 21, 168, 136, 136, 8, 0, 35, 169, 144, 222, 40, 35, 8, 16, 160, 191, 89, 4, 136, 128, 203, 9, 100, 130, 188, 153, 48, 35, 67, 225, 173, 8, 66, 35, 152, 204, 155, 40, 70, 146, 203, 154, 50, 51, 17, 217, 190, 25, 84, 129, 170, 137, 32, 129, 8, 0, 16, 145, 203, 12, 87, 144, 17, 234, 154, 16, 53, 160, 204, 10, 35, 34, 144, 155, 152, 9, 52, 160, 11, 19, 202, 10, 52, 50, 70, 192, 172, 153, 138, 84, 35, 232, 154, 136, 56, 130, 48, 241, 13, 20, 137, 51, 168, 203, 26, 1, 8, 160, 128, 239, 40, 67, 1, 185, 155, 16, 1, 157, 84, 144, 169, 157, 86, 19, 152, 220, 10, 67, 51, 145, 223, 154, 24, 52, 3, 187, 138, 0, 17, 81, 131, 205, 138, 152, 82, 20, 185, 157, 64, 18, 128, 128, 205, 10, 33, 35, 169, 128, 136, 18, 48, 55, 146, 238, 138, 16, 67, 52, 177, 207, 26, 68, 129, 202, 188, 25, 69, 130, 153, 153, 0, 0, 49, 21, 203, 155, 137, 115, 2, 201, 187, 26, 84, 36, 192, 171, 16, 51, 161, 186, 171, 100, 2, 169, 154, 66, 130, 203, 173, 41, 36, 153, 2, 58, 0, 160, 203, 72, 37, 152, 170, 10, 100, 18, 202, 137, 0, 130, 156, 65, 145, 24, 87, 192, 172, 0, 8, 33, 130, 205, 10, 16, 100, 146, 155, 169, 138, 53, 136, 18, 219, 40, 145, 49, 177, 138, 233, 42, 39, 176, 141, 17, 10, 21, 188, 56, 54, 161, 188, 25, 98, 35, 217, 172, 9, 69, 129, 187, 139, 99, 3, 185, 170, 9, 33, 36, 128, 202, 11, 2, 97, 130, 152, 203, 8, 18, 19, 253, 154, 50, 129, 25, 177, 141, 35, 184, 140, 17, 0, 52, 248, 157, 82, 130, 169, 8, 0, 88, 23, 201, 155, 40, 38, 160, 154, 136, 50, 168, 32, 136, 19, 206, 64, 2, 128, 189, 56, 144, 82, 160, 9, 187, 84, 144, 154, 0, 131, 171, 53, 222, 40, 51, 147, 205, 136, 33, 4, 138, 184, 155, 99, 19, 218, 138, 136, 49, 146, 137, 251, 43, 36, 65, 4, 188, 155, 56, 36, 50, 194, 158, 152, 57, 54, 145, 219, 10, 67, 160, 219, 137, 34, 51, 152, 42, 147, 175, 52, 250, 26, 51, 145, 186, 186, 58, 103, 145, 153, 186, 40, 35, 0, 219, 42, 20, 152, 155, 53, 235, 48, 1, 145, 173, 16, 48, 4, 154, 217, 26, 4, 154, 81, 130, 138, 67, 200, 174, 32, 34, 34, 201, 138, 152, 49, 129, 9, 69, 161, 140, 1, 185, 175, 32, 82, 132, 223, 25, 66, 3, 186, 172, 48, 20, 16, 200, 173, 16, 36, 2, 184, 173, 33, 17, 152, 9, 18, 220, 10, 66, 34, 185, 140, 50, 0, 201, 140, 85, 130, 234, 139, 16, 49, 21, 154, 128, 169, 16, 130, 137, 64, 209, 27, 22, 153, 17, 169, 155, 117, 162, 156, 8, 8, 50, 146, 188, 139, 1, 185, 75, 23, 154, 67, 249, 10, 136, 49, 37, 169, 173, 10, 82, 35, 144, 169, 142, 34, 169, 80, 130, 235, 10, 67, 34, 216, 173, 33, 34, 18, 185, 204, 42, 68, 17, 186, 171, 153, 24, 82, 38, 152, 153, 155, 25, 83, 4, 185, 203, 156, 33, 69, 35, 168, 187, 188, 24, 50, 37, 201, 170, 57, 54, 130, 202, 140, 129, 25, 36, 201, 171, 64, 51, 21, 168, 169, 9, 33, 129, 80, 69, 176, 156, 0, 9, 100, 18, 152, 219, 41, 35, 145, 206, 154, 8, 99, 18, 1, 186, 153, 153, 8, 217, 189, 155, 32, 70, 131, 219, 138, 128, 138, 0, 153, 138, 51, 248, 140, 128, 24, 145, 189, 138, 48, 87, 129, 153, 186, 173, 32, 18, 129, 32, 66, 69, 129, 203, 137, 168, 152, 16, 3, 56, 55, 66, 145, 138, 251, 56, 4, 0, 153, 98, 19, 201, 173, 41, 1, 8, 50, 144, 0, 24, 36, 153, 233, 174, 153, 99, 3, 144, 202, 80, 130, 187, 155, 49, 50, 115, 162, 190, 24, 34, 153, 65, 51, 68, 2, 201, 172, 0, 152, 25, 67, 1, 16, 85, 50, 66, 193, 155, 129, 137, 200, 26, 20, 115, 36, 144, 235, 215, 13, 52, 0, 155, 16, 35, 146, 9, 184, 156, 169, 153, 171, 115, 148, 188, 170, 137, 136, 184, 223, 0, 201, 25, 66, 20, 8, 129, 219, 154, 169, 206, 25, 67, 144, 171, 138, 18, 50, 55, 160, 175, 9, 128, 136, 1, 32, 18, 153, 251, 156, 81, 35, 128, 152, 202, 171, 8, 100, 146, 138, 18, 152, 169, 114, 36, 66, 161, 203, 187, 152, 154, 0, 218, 112, 21, 152, 8, 219, 154, 170, 57, 70, 35, 83, 36, 33, 1, 185, 137, 25, 67, 100, 52, 16, 18, 33, 52, 129, 9, 17, 169, 113, 4, 64, 19, 203, 0, 160, 171, 114, 145, 9, 161, 173, 169, 205, 170, 154, 169, 202, 170, 203, 187, 154, 250, 175, 138, 186, 173, 9, 136, 136, 144, 205, 170, 170, 153, 170, 136, 160, 186, 186, 206, 10, 1, 24, 20, 186, 24, 49, 87, 18, 33, 17, 1, 98, 35, 96, 53, 0, 49, 146, 187, 66, 52, 33, 66, 68, 130, 137, 82, 130, 186, 138, 0, 218, 171, 65, 37, 144, 40, 20, 154, 137, 252, 155, 160, 191, 32, 145, 56, 147, 155, 3, 235, 24, 161, 156, 18, 202, 8, 16, 53, 152, 85, 145, 139, 1, 1, 25, 119, 4, 16, 128, 25, 1, 56, 39, 48, 54, 184, 8, 152, 40, 18, 114, 20, 8, 128, 24, 5, 138, 83, 129, 169, 220, 42, 38, 32, 69, 17, 144, 204, 153, 0, 24, 34, 8, 37, 206, 9, 152, 25, 129, 56, 131, 173, 185, 155, 3, 223, 9, 152, 136, 136, 97, 18, 16, 1, 218, 171, 154, 48, 21, 80, 53, 16, 17, 168, 152, 203, 41, 1, 48, 87, 51, 152, 26, 129, 186, 171, 83, 129, 82, 145, 25, 218, 57, 240, 140, 160, 139, 35, 49, 19, 10, 130, 206, 239, 139, 1, 187, 24, 49, 6, 189, 49, 170, 33, 219, 32, 238, 24, 162, 24, 200, 42, 5, 185, 137, 17, 19, 153, 160, 175, 33, 217, 64, 162, 74, 38, 16, 2, 171, 81, 161, 172, 32, 3, 136, 66, 130, 0, 160, 24, 65, 55, 188, 84, 200, 25, 152, 16, 186, 72, 19, 20, 169, 116, 194, 190, 203, 156, 136, 155, 101, 34, 33, 17, 152, 185, 188, 155, 170, 10, 66, 67, 67, 68, 67, 18, 144, 171, 185, 188, 8, 1, 81, 36, 152, 16, 33, 49, 87, 1, 138, 152, 235, 171, 153, 138, 34, 128, 153, 97, 4, 154, 33, 251, 175, 185, 187, 139, 32, 33, 34, 130, 138, 160, 239, 137, 169, 186, 219, 137, 128, 50, 37, 34, 129, 152, 173, 137, 170, 80, 19, 136, 137, 48, 37, 99, 53, 52, 130, 136, 130, 170, 137, 154, 168, 155, 65, 101, 68, 51, 35, 186, 205, 187, 188, 171, 24, 35, 18, 1, 16, 2, 204, 218, 219, 203, 155, 16, 138, 67, 1, 160, 207, 153, 24, 35, 114, 51, 33, 144, 155, 234, 10, 18, 48, 21, 81, 20, 65, 36, 50, 2, 170, 16, 202, 56, 52, 101, 130, 114, 2, 46, 0, 40, 129, 10, 35, 64, 71, 129, 49, 160, 155, 232, 11, 145, 138, 33, 136, 64, 71, 144, 80, 130, 188, 202, 172, 152, 10, 52, 66, 37, 152, 16, 168, 9, 201, 80, 177, 140, 146, 12, 21, 9, 55, 129, 33, 129, 154, 113, 2, 25, 53, 201, 138, 152, 9, 83, 69, 18, 50, 161, 203, 186, 155, 219, 25, 36, 185, 57, 179, 59, 150, 155, 1, 252, 173, 153, 153, 138, 24, 192, 155, 168, 172, 138, 152, 155, 3, 223, 188, 188, 154, 154, 66, 1, 99, 130, 153, 185, 187, 169, 186, 49, 160, 113, 22, 33, 129, 99, 161, 9, 168, 42, 54, 168, 115, 147, 26, 132, 155, 69, 145, 80, 131, 153, 145, 189, 56, 147, 174, 98, 130, 202, 25, 1, 188, 138, 0, 1, 186, 65, 2, 144, 188, 185, 158, 201, 59, 7, 171, 52, 144, 8, 9, 51, 64, 227, 14, 36, 202, 40, 2, 136, 50, 162, 89, 132, 141, 18, 218, 235, 171, 170, 25, 68, 101, 35, 2, 1, 186, 202, 188, 154, 16, 34, 82, 54, 34, 50, 18, 129, 218, 203, 170, 169, 8, 68, 34, 36, 1, 49, 192, 9, 144, 153, 252, 173, 168, 154, 153, 41, 35, 128, 0, 136, 250, 189, 186, 206, 187, 171, 153, 8, 65, 67, 35, 169, 171, 236, 172, 170, 154, 24, 8, 50, 83, 53, 17, 82, 144, 154, 170, 9, 168, 113, 35, 82, 131, 56, 38, 16, 51, 37, 184, 9, 216, 140, 129, 138, 52, 49, 35, 48, 6, 154, 152, 223, 155, 170, 138, 128, 49, 35, 83, 162, 190, 152, 173, 0, 186, 56, 2, 144, 25, 20, 170, 97, 147, 172, 116, 2, 17, 51, 145, 9, 176, 175, 48, 54, 17, 83, 35, 51, 35, 170, 113, 147, 141, 33, 2, 8, 115, 34, 1, 16, 17, 33, 233, 11, 37, 152, 171, 114, 161, 140, 1, 152, 136, 9, 168, 74, 149, 191, 17, 218, 170, 154, 66, 217, 57, 5, 188, 41, 3, 136, 51, 232, 172, 185, 173, 24, 100, 2, 82, 146, 171, 0, 185, 169, 27, 87, 144, 25, 136, 115, 177, 73, 3, 153, 168, 187, 9, 16, 34, 99, 36, 169, 9, 128, 201, 41, 54, 136, 219, 155, 185, 11, 4, 10, 70, 160, 170, 235, 25, 162, 156, 19, 187, 203, 173, 0, 187, 96, 3, 136, 185, 139, 176, 239, 8, 152, 26, 129, 40, 52, 66, 5, 169, 169, 189, 186, 72, 20, 32, 71, 145, 154, 0, 168, 10, 52, 0, 69, 184, 64, 177, 10, 152, 2, 223, 25, 1, 65, 3, 64, 5, 186, 170, 188, 137, 10, 54, 1, 32, 129, 202, 139, 1, 139, 70, 160, 173, 40, 146, 189, 82, 129, 187, 9, 131, 156, 69, 18, 1, 235, 137, 217, 154, 128, 64, 39, 144, 16, 129, 201, 156, 16, 235, 10, 161, 187, 26, 85, 51, 83, 36, 0, 152, 170, 219, 138, 16, 48, 36, 116, 36, 32, 51, 136, 129, 189, 154, 188, 41, 213, 17, 49, 0, 34, 99, 51, 19, 144, 0, 251, 157, 168, 154, 153, 170, 154, 17, 201, 57, 145, 189, 188, 205, 203, 187, 170, 219, 154, 153, 10, 34, 17, 36, 162, 206, 187, 205, 172, 9, 17, 17, 99, 52, 129, 16, 1, 168, 170, 171, 154, 82, 51, 119, 35, 17, 34, 1, 153, 153, 153, 64, 128, 56, 51, 86, 145, 56, 5, 153, 128, 185, 235, 203, 170, 153, 154, 138, 65, 19, 152, 34, 251, 173, 220, 170, 170, 9, 18, 66, 53, 129, 32, 160, 235, 171, 25, 3, 64, 71, 36, 0, 16, 18, 144, 154, 33, 33, 71, 130, 114, 19, 8, 33, 17, 153, 32, 2, 65, 21, 8, 52, 50, 162, 13, 51, 16, 233, 72, 4, 171, 129, 206, 9, 160, 172, 96, 146, 154, 35, 208, 156, 152, 218, 138, 136, 153, 98, 146, 138, 2, 203, 137, 203, 137, 138, 34, 170, 100, 128, 113, 2, 16, 1, 32, 249, 27, 21, 153, 115, 2, 8, 17, 128, 34, 136, 64, 35, 249, 11, 38, 168, 26, 52, 200, 139, 144, 186, 235, 139, 19, 252, 9, 176, 156, 168, 139, 2, 220, 9, 201, 156, 185, 27, 147, 158, 20, 185, 25, 218, 40, 192, 42, 4, 137, 130, 140, 52, 184, 113, 2, 153, 18, 33, 19, 65, 53, 52, 1, 41, 1, 26, 51, 115, 55, 136, 66, 177, 140, 0, 32, 168, 115, 132, 170, 8, 184, 188, 8, 18, 17, 216, 175, 33, 232, 11, 20, 170, 170, 171, 24, 160, 56, 103, 130, 10, 130, 174, 16, 170, 40, 49, 37, 184, 73, 22, 168, 49, 0, 19, 190, 81, 200, 26, 20, 41, 54, 144, 16, 35, 200, 174, 152, 136, 144, 155, 81, 68, 1, 32, 34, 17, 251, 158, 153, 187, 139, 83, 160, 114, 147, 172, 168, 189, 154, 9, 48, 85, 35, 0, 1, 202, 188, 153, 8, 17, 69, 51, 51, 35, 16, 33, 177, 207, 8, 129, 24, 69, 18, 82, 131, 171, 8, 204, 10, 160, 25, 36, 144, 154, 218, 170, 201, 187, 156, 152, 207, 137, 201, 171, 153, 154, 152, 203, 56, 248, 154, 201, 155, 202, 172, 128, 153, 81, 35, 51, 145, 48, 240, 173, 128, 168, 32, 36, 84, 36, 32, 37, 136, 0, 169, 0, 136, 114, 19, 50, 53, 2, 17, 144, 8, 185, 154, 187, 25, 162, 155, 87, 145, 16, 153, 161, 255, 138, 202, 154, 186, 10, 169, 40, 18, 99, 129, 128, 236, 186, 189, 154, 138, 65, 84, 35, 34, 35, 144, 153, 204, 24, 145, 112, 4, 97, 3, 48, 19, 16, 18, 8, 2, 136, 82, 67, 54, 33, 84, 145, 25, 3, 153, 40, 51, 19, 218, 156, 128, 237, 9, 35, 19, 171, 49, 251, 174, 171, 137, 203, 24, 128, 56, 178, 14, 131, 223, 40, 185, 139, 146, 139, 34, 34, 1, 50, 249, 25, 192, 41, 21, 16, 35, 0, 160, 105, 6, 139, 85, 129, 32, 34, 129, 25, 131, 141, 85, 144, 33, 144, 162, 13, 38, 0, 67, 185, 80, 3, 128, 8, 137, 201, 173, 16, 49, 210, 13, 132, 219, 185, 9, 145, 140, 67, 184, 173, 185, 175, 152, 185, 64, 161, 140, 146, 173, 153, 173, 16, 218, 10, 152, 153, 137, 65, 152, 32, 234, 9, 220, 25, 169, 48, 130, 41, 146, 26, 4, 24, 70, 19, 137, 185, 174, 144, 187, 117, 20, 33, 3, 16, 4, 188, 1, 169, 128, 27, 23, 24, 83, 2, 16, 0, 218, 172, 138, 153, 25, 85, 34, 49, 131, 173, 65, 160, 154, 40, 39, 217, 25, 129, 139, 51, 1, 115, 130, 186, 8, 130, 207, 56, 4, 24, 145, 59, 87, 136, 35, 128, 66, 176, 155, 65, 160, 56, 1, 103, 168, 42, 145, 138, 185, 73, 131, 172, 65, 36, 145, 153, 185, 42, 251, 191, 51, 218, 9, 34, 251, 11, 51, 184, 156, 82, 131, 204, 25, 19, 203, 24, 184, 97, 145, 42, 52, 131, 170, 202, 255, 155, 170, 24, 69, 52, 33, 19, 160, 252, 156, 1, 169, 48, 20, 50, 19, 50, 145, 153, 188, 137, 238, 25, 20, 24, 51, 34, 3, 188, 137, 218, 156, 25, 20, 201, 9, 33, 144, 169, 41, 21, 236, 170, 186, 186, 188, 137, 24, 1, 8, 35, 216, 188, 205, 155, 234, 187, 0, 16, 16, 99, 19, 24, 177, 157, 160, 156, 0, 25, 34, 48, 71, 34, 69, 1, 33, 160, 153, 218, 41, 2, 115, 19, 99, 3, 32, 128, 137, 185, 172, 136, 8, 83, 83, 51, 129, 9, 129, 205, 138, 169, 170, 185, 139, 201, 27, 37, 24, 54, 201, 139, 152, 207, 138, 168, 138, 128, 48, 55, 50, 19, 8, 160, 223, 138, 136, 25, 82, 36, 17, 36, 2, 16, 145, 136, 128, 170, 48, 85, 53, 51, 69, 18, 144, 25, 145, 155, 51, 83, 21, 136, 0, 136, 129, 155, 86, 1, 1, 237, 137, 200, 156, 136, 10, 18, 139, 54, 202, 24, 250, 155, 201, 11, 152, 26, 20, 24, 128, 9, 209, 174, 138, 136, 202, 25, 40, 71, 169, 41, 34, 160, 140, 69, 144, 24, 129, 9, 130, 140, 102, 17, 16, 50, 146, 137, 144, 8, 202, 115, 133, 25, 36, 128, 137, 48, 162, 159, 1, 187, 66, 184, 81, 130, 168, 188, 144, 205, 9, 0, 32, 201, 10, 162, 191, 10, 152, 137, 0, 186, 218, 189, 136, 185, 81, 36, 152, 40, 200, 157, 136, 24, 144, 114, 132, 26, 22, 9, 37, 169, 1, 201, 48, 144, 113, 19, 65, 147, 138, 132, 188, 136, 16, 168, 97, 2, 48, 3, 128, 219, 203, 205, 137, 160, 173, 65, 184, 73, 130, 0, 235, 139, 250, 188, 137, 8, 1, 170, 48, 147, 205, 138, 152, 187, 221, 11, 130, 191, 97, 144, 24, 1, 128, 170, 16, 234, 40, 144, 11, 51, 50, 68, 34, 2, 56, 5, 206, 56, 148, 12, 52, 152, 65, 130, 186, 171, 234, 11, 54, 32, 53, 1, 33, 177, 175, 152, 139, 19, 169, 102, 146, 253, 47, 0, 2, 0, 128, 17, 218, 25, 201, 56, 162, 59, 87, 152, 16, 144, 9, 160, 138, 50, 146, 42, 5, 114, 164, 12, 4, 170, 16, 8, 145, 42, 132, 156, 20, 219, 65, 145, 48, 200, 81, 208, 138, 170, 16, 184, 97, 2, 65, 161, 141, 145, 189, 40, 152, 25, 67, 18, 33, 20, 185, 139, 37, 235, 25, 1, 66, 184, 120, 148, 140, 35, 169, 32, 129, 18, 217, 10, 200, 155, 220, 112, 161, 43, 7, 152, 144, 153, 186, 154, 152, 10, 68, 168, 88, 129, 8, 221, 41, 162, 204, 8, 2, 187, 49, 145, 115, 177, 74, 147, 175, 128, 202, 56, 177, 27, 36, 34, 185, 116, 177, 41, 161, 10, 152, 24, 168, 117, 4, 24, 36, 1, 160, 72, 179, 14, 5, 140, 19, 153, 50, 35, 19, 82, 131, 171, 35, 239, 10, 1, 154, 81, 35, 17, 0, 1, 249, 190, 138, 160, 172, 49, 4, 0, 0, 153, 202, 175, 152, 172, 129, 153, 0, 51, 178, 13, 129, 189, 186, 173, 48, 3, 188, 114, 150, 155, 2, 170, 98, 144, 49, 3, 128, 139, 84, 168, 57, 36, 17, 168, 96, 36, 168, 112, 131, 10, 19, 155, 50, 234, 24, 16, 53, 168, 100, 19, 144, 155, 34, 250, 155, 0, 16, 2, 139, 54, 0, 176, 107, 132, 190, 9, 1, 251, 138, 1, 129, 41, 51, 115, 146, 155, 152, 222, 187, 137, 0, 83, 52, 67, 19, 200, 186, 219, 171, 137, 24, 84, 35, 34, 51, 129, 152, 236, 188, 9, 168, 26, 86, 17, 33, 1, 153, 187, 189, 154, 33, 185, 72, 1, 66, 129, 64, 19, 129, 223, 172, 137, 152, 9, 67, 20, 144, 153, 8, 251, 142, 144, 154, 152, 187, 48, 70, 18, 17, 2, 234, 187, 219, 10, 36, 16, 98, 19, 0, 40, 146, 156, 145, 173, 32, 128, 98, 37, 18, 66, 146, 171, 168, 188, 170, 57, 54, 17, 34, 50, 177, 156, 176, 207, 152, 203, 139, 8, 137, 82, 130, 140, 129, 221, 171, 171, 170, 172, 154, 32, 168, 27, 38, 169, 203, 202, 236, 171, 137, 138, 64, 52, 128, 16, 145, 188, 171, 9, 169, 65, 2, 115, 22, 32, 36, 128, 9, 33, 145, 72, 68, 18, 33, 55, 146, 64, 20, 9, 50, 200, 41, 20, 17, 68, 20, 17, 16, 145, 156, 50, 176, 58, 55, 161, 40, 55, 184, 73, 147, 189, 137, 154, 48, 129, 72, 55, 144, 152, 202, 137, 220, 42, 4, 202, 72, 19, 154, 17, 129, 184, 12, 193, 175, 19, 138, 67, 16, 35, 116, 177, 27, 132, 173, 17, 0, 1, 32, 7, 16, 21, 8, 145, 169, 153, 153, 202, 120, 36, 9, 66, 3, 203, 138, 184, 205, 137, 33, 17, 18, 40, 132, 207, 153, 153, 128, 170, 48, 208, 157, 153, 185, 156, 66, 18, 152, 153, 219, 156, 200, 158, 35, 217, 64, 130, 24, 18, 17, 201, 154, 251, 137, 0, 66, 67, 20, 1, 161, 174, 70, 0, 40, 0, 136, 187, 113, 129, 48, 19, 170, 152, 203, 25, 2, 137, 49, 208, 205, 155, 136, 203, 97, 146, 171, 160, 156, 50, 218, 72, 177, 158, 152, 187, 32, 33, 87, 2, 25, 21, 250, 137, 130, 137, 32, 18, 34, 136, 116, 130, 137, 130, 155, 184, 255, 64, 130, 41, 53, 160, 24, 160, 172, 176, 158, 51, 160, 112, 2, 9, 130, 187, 32, 250, 10, 19, 137, 34, 32, 38, 203, 97, 208, 10, 145, 138, 1, 9, 50, 129, 0, 184, 25, 241, 191, 16, 217, 40, 19, 16, 35, 170, 80, 208, 155, 145, 140, 136, 155, 115, 131, 42, 55, 184, 9, 233, 155, 168, 41, 1, 65, 3, 9, 129, 222, 138, 161, 157, 82, 129, 32, 20, 8, 152, 154, 24, 128, 8, 85, 20, 33, 37, 0, 16, 161, 171, 56, 70, 33, 67, 36, 128, 25, 145, 190, 138, 67, 130, 72, 20, 202, 24, 235, 10, 168, 26, 176, 141, 144, 139, 192, 175, 153, 170, 189, 137, 170, 153, 189, 169, 219, 186, 188, 137, 8, 217, 140, 4, 205, 137, 153, 144, 171, 83, 130, 137, 36, 200, 57, 177, 43, 148, 141, 68, 144, 114, 19, 0, 1, 25, 20, 206, 64, 146, 42, 23, 152, 66, 176, 42, 161, 11, 130, 42, 55, 153, 67, 129, 32, 200, 43, 179, 175, 33, 154, 83, 128, 98, 145, 24, 145, 172, 170, 24, 130, 40, 39, 33, 129, 139, 35, 251, 27, 3, 187, 66, 144, 115, 177, 88, 3, 9, 131, 155, 161, 143, 36, 48, 39, 153, 52, 184, 42, 51, 48, 21, 140, 87, 201, 42, 131, 10, 36, 128, 17, 185, 9, 234, 57, 4, 11, 53, 145, 24, 184, 173, 234, 155, 152, 57, 55, 33, 1, 154, 234, 156, 152, 9, 18, 56, 6, 186, 16, 235, 48, 209, 43, 3, 172, 1, 170, 65, 161, 41, 195, 207, 33, 170, 56, 129, 50, 248, 42, 193, 140, 34, 17, 35, 0, 49, 251, 191, 49, 184, 64, 3, 25, 145, 190, 32, 232, 41, 132, 138, 145, 157, 35, 204, 80, 146, 139, 3, 172, 33, 185, 114, 146, 140, 129, 171, 65, 18, 69, 129, 137, 202, 139, 144, 137, 99, 36, 136, 83, 176, 13, 130, 189, 33, 145, 40, 1, 34, 249, 172, 48, 130, 154, 65, 34, 130, 190, 41, 248, 156, 17, 1, 16, 65, 20, 186, 41, 232, 173, 152, 170, 51, 0, 119, 130, 10, 145, 189, 153, 171, 81, 131, 41, 39, 145, 8, 160, 154, 235, 138, 144, 56, 53, 33, 68, 129, 152, 201, 188, 169, 172, 65, 34, 99, 19, 8, 3, 190, 9, 185, 25, 160, 73, 37, 1, 1, 51, 177, 175, 168, 173, 16, 160, 58, 23, 169, 9, 170, 170, 206, 56, 146, 12, 22, 185, 56, 147, 187, 24, 83, 161, 11, 52, 152, 65, 18, 113, 36, 169, 115, 161, 139, 36, 136, 49, 2, 50, 19, 56, 7, 188, 115, 148, 138, 16, 144, 9, 136, 83, 161, 41, 147, 218, 11, 33, 0, 174, 185, 140, 33, 235, 41, 2, 168, 202, 171, 153, 220, 172, 138, 217, 156, 33, 193, 139, 53, 251, 137, 185, 25, 200, 10, 20, 170, 32, 200, 139, 136, 0, 1, 217, 157, 49, 217, 26, 52, 152, 56, 36, 176, 174, 80, 194, 158, 52, 184, 72, 130, 10, 144, 32, 200, 58, 131, 24, 184, 96, 19, 33, 144, 114, 149, 171, 24, 36, 168, 120, 37, 144, 8, 17, 169, 41, 160, 88, 19, 48, 19, 40, 23, 219, 64, 178, 44, 132, 156, 66, 184, 80, 146, 41, 19, 186, 26, 35, 185, 114, 148, 138, 2, 9, 99, 35, 153, 117, 177, 141, 128, 172, 16, 16, 53, 50, 4, 170, 216, 175, 24, 136, 48, 36, 16, 32, 20, 169, 136, 168, 222, 154, 2, 32, 70, 34, 35, 128, 201, 190, 170, 219, 48, 21, 8, 52, 162, 187, 9, 219, 154, 24, 152, 48, 4, 40, 69, 192, 139, 130, 205, 9, 1, 152, 80, 21, 184, 153, 169, 171, 26, 83, 51, 19, 200, 155, 176, 255, 12, 2, 153, 66, 20, 0, 17, 185, 172, 202, 173, 16, 2, 82, 52, 18, 129, 202, 186, 219, 154, 128, 32, 16, 116, 19, 136, 18, 233, 172, 136, 154, 33, 16, 69, 146, 169, 185, 138, 218, 40, 22, 128, 136, 16, 34, 200, 174, 32, 193, 140, 53, 160, 104, 131, 155, 16, 219, 24, 216, 26, 35, 152, 116, 18, 136, 186, 40, 240, 141, 16, 128, 0, 83, 3, 9, 161, 155, 185, 187, 190, 72, 249, 58, 37, 8, 52, 1, 185, 220, 156, 8, 153, 96, 19, 0, 0, 136, 187, 155, 0, 184, 12, 178, 239, 136, 0, 0, 56, 54, 168, 40, 217, 157, 170, 9, 136, 170, 40, 68, 66, 68, 36, 176, 171, 218, 204, 138, 17, 66, 38, 1, 33, 160, 155, 152, 203, 155, 32, 129, 88, 54, 0, 49, 21, 200, 154, 153, 204, 138, 1, 24, 86, 2, 33, 145, 155, 0, 201, 188, 10, 18, 251, 74, 22, 136, 49, 2, 153, 137, 235, 156, 16, 170, 98, 130, 25, 36, 8, 50, 130, 251, 138, 201, 172, 24, 51, 99, 51, 51, 128, 136, 252, 156, 170, 138, 24, 82, 35, 50, 2, 25, 232, 190, 172, 0, 184, 56, 36, 128, 136, 8, 144, 155, 186, 59, 149, 255, 9, 0, 9, 66, 17, 84, 3, 153, 153, 205, 203, 138, 1, 41, 55, 33, 36, 129, 152, 204, 171, 187, 41, 35, 114, 37, 2, 1, 128, 203, 155, 8, 185, 80, 38, 2, 50, 161, 140, 200, 173, 8, 33, 0, 64, 21, 168, 8, 217, 27, 130, 9, 176, 104, 147, 25, 21, 152, 169, 154, 48, 35, 184, 112, 119, 144, 33, 144, 203, 155, 1, 172, 97, 18, 16, 67, 130, 154, 152, 205, 138, 220, 10, 35, 33, 66, 85, 161, 137, 160, 205, 186, 9, 34, 66, 53, 129, 0, 160, 187, 171, 176, 174, 50, 168, 33, 1, 70, 129, 136, 251, 172, 154, 32, 129, 156, 0, 40, 0, 80, 35, 144, 185, 155, 217, 140, 67, 17, 184, 139, 146, 191, 24, 0, 115, 53, 161, 187, 152, 188, 137, 40, 131, 141, 34, 128, 18, 169, 169, 236, 205, 137, 8, 33, 34, 100, 2, 137, 217, 189, 0, 168, 72, 37, 1, 128, 202, 41, 67, 168, 168, 205, 155, 32, 21, 66, 21, 10, 1, 203, 155, 154, 168, 42, 119, 0, 8, 49, 160, 175, 137, 0, 32, 17, 65, 20, 168, 10, 1, 236, 138, 33, 144, 154, 37, 184, 115, 4, 8, 218, 187, 186, 137, 68, 52, 34, 51, 216, 173, 170, 154, 0, 34, 66, 51, 160, 9, 234, 26, 37, 8, 51, 184, 139, 201, 157, 33, 152, 114, 36, 34, 144, 56, 132, 221, 170, 153, 236, 25, 18, 82, 36, 19, 0, 200, 190, 169, 186, 24, 68, 36, 33, 50, 152, 202, 187, 9, 170, 137, 154, 85, 146, 27, 71, 160, 154, 138, 1, 9, 19, 136, 252, 174, 153, 24, 67, 69, 35, 129, 219, 203, 187, 156, 49, 52, 51, 35, 128, 153, 201, 190, 153, 155, 16, 1, 86, 19, 34, 176, 203, 204, 155, 24, 82, 19, 48, 145, 174, 8, 0, 82, 51, 129, 168, 252, 155, 128, 153, 32, 83, 18, 65, 37, 128, 169, 221, 187, 187, 138, 65, 68, 52, 33, 18, 217, 187, 189, 154, 154, 49, 83, 53, 18, 18, 168, 188, 189, 153, 153, 25, 53, 130, 65, 18, 152, 139, 146, 174, 0, 138, 1, 9, 129, 72, 180, 15, 38, 24, 68, 160, 136, 219, 172, 154, 137, 50, 54, 35, 34, 130, 220, 203, 204, 137, 136, 32, 51, 67, 52, 19, 186, 202, 205, 187, 139, 32, 82, 54, 35, 129, 168, 172, 154, 154, 170, 96, 19, 48, 39, 152, 153, 152, 152, 41, 36, 144, 169, 57, 7, 202, 10, 50, 3, 67, 53, 4, 186, 204, 220, 171, 41, 67, 68, 34, 34, 186, 203, 206, 170, 153, 64, 67, 35, 3, 168, 188, 169, 187, 137, 8, 51, 100, 19, 169, 138, 217, 28, 71, 136, 33, 144, 188, 155, 186, 73, 38, 0, 8, 50, 18, 202, 204, 204, 171, 136, 82, 36, 51, 19, 0, 234, 189, 170, 153, 33, 83, 52, 20, 128, 9, 185, 189, 153, 152, 137, 84, 35, 17, 3, 202, 206, 170, 136, 50, 19, 16, 36, 152, 137, 217, 188, 24, 99, 51, 51, 130, 201, 205, 188, 154, 33, 69, 35, 18, 34, 202, 170, 235, 203, 170, 9, 99, 50, 52, 17, 129, 235, 154, 185, 170, 56, 52, 17, 67, 1, 48, 131, 251, 158, 16, 185, 40, 2, 9, 68, 51, 0, 145, 206, 9, 129, 16, 145, 223, 154, 1, 24, 68, 20, 17, 128, 251, 171, 185, 172, 9, 82, 53, 51, 17, 168, 174, 154, 218, 155, 8, 8, 116, 35, 18, 129, 203, 219, 154, 136, 49, 35, 82, 20, 153, 203, 154, 137, 64, 36, 17, 18, 185, 205, 171, 16, 17, 66, 144, 81, 2, 0, 160, 234, 207, 154, 236, 249, 46, 0, 169, 57, 69, 51, 20, 128, 169, 204, 172, 153, 0, 49, 52, 67, 18, 160, 203, 171, 171, 41, 54, 19, 67, 176, 175, 170, 170, 56, 54, 34, 2, 9, 130, 239, 9, 0, 8, 50, 130, 114, 3, 153, 169, 206, 171, 24, 67, 67, 52, 129, 202, 189, 171, 170, 25, 68, 66, 34, 2, 186, 187, 204, 9, 168, 25, 70, 19, 0, 8, 200, 11, 52, 129, 32, 192, 190, 154, 9, 82, 38, 145, 153, 153, 137, 185, 188, 203, 10, 49, 87, 67, 18, 0, 186, 219, 188, 138, 1, 50, 69, 52, 2, 168, 203, 188, 203, 40, 18, 128, 48, 3, 32, 22, 217, 221, 171, 9, 51, 34, 50, 36, 129, 153, 234, 173, 136, 32, 54, 51, 2, 168, 235, 205, 154, 16, 52, 36, 2, 136, 202, 187, 153, 154, 24, 0, 114, 51, 0, 152, 8, 250, 27, 19, 153, 48, 38, 168, 138, 220, 138, 34, 35, 18, 69, 177, 191, 170, 9, 49, 18, 67, 194, 191, 24, 18, 66, 18, 169, 218, 172, 24, 66, 67, 1, 169, 189, 10, 67, 35, 176, 203, 203, 155, 66, 36, 50, 70, 161, 189, 171, 170, 56, 53, 67, 2, 170, 152, 154, 32, 160, 170, 10, 119, 2, 40, 129, 170, 221, 171, 25, 68, 52, 4, 170, 9, 169, 155, 201, 156, 49, 69, 37, 129, 170, 152, 204, 138, 144, 154, 66, 52, 53, 17, 129, 219, 154, 219, 172, 8, 33, 69, 2, 16, 128, 204, 153, 169, 139, 34, 67, 51, 145, 188, 41, 52, 3, 188, 1, 189, 113, 145, 172, 32, 161, 141, 35, 154, 114, 19, 153, 251, 187, 136, 32, 70, 3, 136, 17, 129, 218, 170, 202, 12, 83, 129, 65, 51, 99, 145, 188, 187, 204, 9, 35, 34, 52, 129, 136, 235, 9, 144, 138, 50, 168, 139, 50, 71, 19, 49, 3, 220, 155, 169, 188, 170, 188, 139, 101, 51, 144, 10, 34, 218, 170, 207, 137, 8, 48, 55, 3, 137, 168, 203, 171, 24, 2, 9, 67, 68, 20, 136, 144, 202, 219, 155, 65, 1, 136, 145, 174, 64, 39, 184, 42, 147, 138, 67, 2, 170, 186, 174, 137, 40, 71, 19, 0, 144, 203, 171, 188, 187, 41, 54, 35, 20, 168, 24, 144, 128, 234, 219, 140, 33, 16, 70, 130, 155, 152, 202, 26, 67, 35, 3, 235, 203, 156, 65, 52, 145, 188, 9, 137, 85, 1, 24, 144, 203, 139, 18, 152, 83, 2, 68, 177, 173, 169, 155, 16, 33, 51, 17, 3, 202, 72, 39, 152, 0, 218, 138, 50, 21, 129, 168, 174, 138, 9, 84, 146, 56, 3, 205, 153, 218, 170, 218, 9, 33, 66, 34, 18, 218, 10, 145, 207, 154, 137, 100, 19, 17, 161, 155, 67, 160, 56, 178, 191, 153, 137, 82, 131, 186, 32, 160, 72, 71, 145, 153, 138, 25, 8, 185, 207, 56, 36, 82, 20, 202, 154, 186, 11, 17, 67, 176, 27, 53, 144, 171, 170, 205, 155, 153, 81, 19, 253, 32, 0, 34, 67, 216, 26, 52, 85, 130, 188, 136, 185, 172, 32, 128, 65, 69, 3, 185, 155, 202, 137, 17, 17, 153, 116, 52, 34, 1, 201, 189, 137, 16, 52, 1, 66, 177, 10, 176, 157, 40, 4, 218, 172, 171, 153, 114, 38, 129, 136, 202, 154, 1, 136, 185, 173, 137, 81, 36, 1, 17, 160, 236, 26, 36, 169, 138, 152, 186, 97, 35, 17, 144, 168, 203, 138, 81, 38, 144, 50, 225, 140, 136, 154, 128, 9, 71, 144, 97, 20, 0, 169, 171, 219, 138, 33, 53, 19, 0, 136, 160, 187, 203, 205, 202, 155, 66, 50, 68, 129, 33, 129, 222, 187, 186, 138, 68, 51, 68, 1, 168, 152, 201, 187, 24, 168, 72, 70, 36, 18, 1, 217, 189, 186, 8, 128, 66, 19, 40, 21, 200, 187, 171, 9, 19, 201, 186, 189, 25, 54, 19, 0, 136, 17, 34, 48, 22, 252, 26, 129, 10, 83, 34, 1, 83, 146, 139, 4, 222, 138, 169, 25, 50, 33, 1, 57, 103, 2, 144, 219, 171, 9, 33, 128, 16, 169, 8, 67, 52, 232, 173, 153, 9, 34, 144, 32, 19, 234, 172, 49, 162, 191, 32, 129, 17, 32, 54, 177, 219, 237, 137, 1, 24, 69, 35, 17, 152, 203, 187, 155, 16, 115, 67, 50, 52, 1, 16, 250, 173, 154, 137, 24, 66, 52, 2, 8, 185, 205, 171, 9, 128, 56, 69, 2, 136, 152, 153, 0, 144, 170, 217, 175, 115, 51, 18, 144, 152, 202, 10, 35, 176, 154, 154, 24, 217, 173, 202, 156, 82, 3, 217, 25, 145, 154, 136, 205, 189, 156, 24, 136, 114, 36, 128, 169, 169, 168, 138, 49, 36, 3, 170, 32, 152, 81, 36, 128, 160, 172, 168, 255, 9, 144, 56, 39, 33, 66, 36, 129, 8, 160, 156, 16, 33, 128, 155, 136, 117, 19, 152, 184, 154, 1, 218, 203, 188, 137, 8, 67, 53, 168, 187, 251, 155, 32, 128, 152, 171, 204, 73, 37, 35, 200, 191, 156, 32, 66, 19, 152, 0, 128, 24, 35, 136, 66, 19, 128, 252, 203, 10, 16, 65, 53, 1, 152, 218, 170, 169, 137, 50, 161, 203, 252, 187, 65, 36, 18, 170, 16, 201, 203, 139, 1, 203, 57, 119, 129, 153, 128, 24, 160, 156, 50, 128, 85, 36, 129, 136, 170, 137, 169, 41, 68, 84, 1, 154, 0, 128, 202, 172, 202, 157, 66, 130, 24, 51, 200, 154, 249, 140, 128, 32, 53, 18, 144, 40, 131, 219, 154, 65, 2, 154, 10, 69, 18, 68, 184, 139, 2, 114, 20, 0, 144, 154, 100, 35, 136, 185, 207, 155, 9, 33, 0, 24, 0, 184, 239, 137, 144, 186, 10, 177, 207, 138, 24, 33, 50, 129, 137, 0, 168, 157, 66, 193, 10, 129, 25, 69, 68, 50, 35, 250, 171, 186, 153, 136, 114, 35, 33, 130, 8, 160, 59, 55, 50, 130, 9, 84, 35, 168, 65, 161, 64, 192, 41, 20, 128, 98, 36, 184, 172, 169, 204, 49, 130, 5, 1, 18, 0, 171, 64, 19, 170, 202, 171, 218, 155, 36, 152, 48, 17, 67, 250, 159, 136, 24, 18, 99, 35, 17, 146, 205, 171, 171, 128, 32, 18, 185, 186, 168, 255, 155, 168, 153, 17, 152, 203, 41, 129, 10, 34, 185, 44, 87, 184, 41, 68, 1, 10, 51, 184, 25, 50, 103, 18, 0, 16, 18, 48, 162, 175, 0, 138, 84, 128, 137, 203, 16, 136, 48, 4, 216, 156, 19, 235, 24, 145, 9, 184, 11, 52, 184, 89, 39, 152, 56, 130, 155, 186, 140, 16, 66, 18, 114, 162, 187, 153, 11, 2, 10, 145, 190, 185, 172, 10, 2, 19, 33, 4, 202, 1, 175, 33, 169, 32, 160, 17, 0, 153, 64, 19, 33, 3, 25, 146, 157, 17, 160, 17, 16, 17, 32, 51, 145, 153, 153, 156, 24, 33, 51, 17, 1, 16, 144, 25, 17, 153, 0, 144, 16, 144, 0, 16, 18, 169, 25, 144, 153, 17, 0, 0, 1, 25, 144, 9, 0, 153, 9, 16, 17, 1, 153, 153, 9, 144, 153, 32, 1, 25, 17, 144, 0, 9, 153, 153, 18, 160, 32, 17, 144, 0, 0, 144, 16, 17, 144, 25, 144, 16, 17, 0, 144, 0, 1, 144, 16, 0, 0, 1, 9, 144, 0, 16, 0, 0, 0, 0, 16, 144, 16, 144, 25, 1, 9, 144, 0, 17, 144, 0, 0, 0, 0, 144, 25, 1, 0, 0, 0, 0, 0, 0, 9, 0, 0, 16, 0, 9, 1, 0, 0, 9, 9, 17, 0, 25, 1, 153, 0, 0, 1, 0, 144, 16, 0, 0, 0, 25, 0, 0, 144, 1, 0, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 0, 0, 1, 0, 0, 0, 0, 144, 0, 0, 16, 0, 0, 0, 0, 0, 0, 0, 144, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 144, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 9, 1, 0, 0, 0, 0, 0, 0, 0, 144, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
-static const size_t audio_sixty_sample_data_length = sizeof(audio_sixty_sample_data) / sizeof(audio_sixty_sample_data[0]);
+static const size_t audio_sixty_sample_data_length = 28962;
@@ -1,4 +1,4 @@
-// This file was generated by a script on 03-12-2024 09:42:18
+// This file was generated by a script on 17-10-2026 14:19:01
 
 #pragma once
 
@@ -6,6 +6,7 @@
 #include <stdint.h>
 #include <pico/platform/sections.h>
 
-static const int16_t __in_flash("audio_ten_sample_data") audio_ten_sample_data[] = { 10, 3, -6, -6, 4, 10, 3, -3, 0, 5, 3, -2, -2, 0, -1, -2, 0, 3, 1, -2, -1, 2, 2, 0, -2, -1, 1, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 3, 1, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 2, 3, 3, 5, 9, 10, 9, 9, 10, 9, 7, 11, 14, 12, 9, 11, 14, 12, 9, 10, 13, 13, 11, 9, 6, 7, 10, 10, 6, 5, 7, 9, 7, 6, 10, 12, 10, 6, 6, 5, 3, 0, 2, 5, 6, 3, 1, 2, 4, 4, 3, 2, 2, 2, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 1, 2, 2, 2, 0, -2, -5, -7, -7, -3, 3, 6, 2, -1, 0, 3, 6, 5, 2, 1, 1, 2, 2, 1, 3, 6, 6, 4, 2, 1, -1, -4, -5, -3, -1, 1, 5, 9, 7, 5, 5, 6, 4, 1, 0, 0, -1, -4, -5, -2, 1, 3, 3, 4, 6, 11, 16, 18, 18, 16, 12, 6, 4, 10, 14, 11, 3, 1, 4, 6, 6, 5, 7, 10, 10, 9, 7, 4, 1, 6, 14, 14, 9, 6, 7, 4, -2, -5, 0, 4, 5, 7, 12, 14, 12, 11, 12, 13, 11, 11, 13, 10, 1, -3, 0, 6, 7, 3, -1, -5, -5, -1, 4, 6, 4, 1, 0, -2, -1, 2, 6, 4, 0, -3, 0, 5, 9, 7, 4, 0, -4, -3, 2, 13, 16, 9, 0, 0, 6, 12, 6, -1, -5, -3, -1, -3, -8, -12, -10, -2, 4, 7, 4, 0, -1, -1, 0, 2, 3, 0, -10, -16, -15, -10, -5, -6, -7, -6, -5, -5, -7, -11, -13, -10, -5, -6, -8, -7, -5, -8, -17, -22, -16, -5, -1, -6, -14, -16, -16, -20, -29, -36, -39, -40, -39, -31, -18, -8, -3, 0, 0, -8, -21, -29, -30, -30, -34, -34, -27, -17, -14, -13, -13, -15, -19, -20, -20, -27, -30, -22, -12, -14, -27, -34, -35, -37, -36, -29, -19, -19, -20, -8, 10, 17, 9, -2, -11, -17, -20, -12, -1, -7, -23, -23, -7, -1, -12, -24, -22, -8, 3, 0, -19, -32, -25, -11, -7, -6, 0, 3, -2, -8, -10, -16, -30, -39, -40, -41, -42, -35, -21, -14, -12, -6, 1, 4, -2, -14, -17, -10, -7, -19, -33, -34, -27, -32, -50, -55, -32, -3, 5, -1, -12, -21, -41, -66, -76, -73, -71, -65, -44, -16, -3, -4, -7, -15, -24, -23, -12, -8, -23, -40, -50, -50, -47, -40, -35, -28, -13, 5, 15, 10, 5, 14, 22, 10, -14, -24, -21, -16, 0, 45, 84, 81, 53, 33, 6, -40, -70, -48, -5, 17, 32, 51, 56, 37, 21, 28, 31, 3, -30, -32, -14, -6, 2, 37, 62, 31, -20, -31, -4, 5, -5, 0, 21, 31, 32, 62, 108, 107, 35, -42, -70, -65, -72, -88, -85, -65, -44, -23, -8, -10, -21, -30, -35, -49, -68, -69, -41, 1, 32, 36, 26, 19, 29, 44, 45, 33, 33, 53, 57, 10, -65, -110, -97, -36, 34, 54, 10, -12, 55, 129, 96, 13, -6, 17, 21, 33, 74, 67, -23, -86, -37, 32, 14, -58, -90, -85, -97, -95, -34, 17, -16, -50, 31, 126, 53, -124, -181, -73, 28, 19, -35, -53, -20, 29, 54, 51, 49, 50, 16, -40, -47, 23, 97, 108, 103, 142, 187, 167, 106, 103, 156, 165, 99, 64, 139, 244, 258, 178, 95, 61, 58, 61, 48, -22, -175, -331, -326, -110, 136, 190, 56, -38, 45, 159, 65, -230, -448, -359, 14, 567, 1223, 1756, 1818, 1372, 787, 313, -186, -785, -1177, -1091, -690, -288, 44, 354, 530, 444, 220, 70, -17, -170, -253, 3, 532, 936, 985, 778, 412, -72, -339, 221, 1814, 3794, 5197, 5576, 5052, 3669, 1222, -2037, -4905, -5886, -4491, -1684, 971, 2467, 2687, 1945, 394, -1996, -4692, -6171, -5099, -1987, 1237, 3271, 4039, 3593, 1849, -587, -2697, -4027, -4389, -3098, 163, 4017, 6150, 5454, 2865, 152, -1650, -2657, -3340, -3660, -3160, -1688, 331, 2213, 3240, 2877, 1273, -567, -1693, -2134, -2488, -2775, -2422, -1371, -468, -454, -1047, -1508, -1743, -2272, -3261, -4121, -4136, -3079, -1249, 755, 2306, 3025, 2841, 1821, 143, -1758, -3197, -3397, -1889, 793, 2978, 3171, 1538, -598, -2396, -3713, -4173, -3274, -1306, 796, 2387, 3214, 3111, 2210, 1080, 182, -491, -995, -1091, -543, 510, 1697, 2757, 3619, 4215, 4340, 3890, 3171, 2673, 2446, 2064, 1348, 651, 219, -219, -846, -1215, -738, 530, 1917, 2730, 2768, 2344, 1839, 1294, 640, 123, -19, -103, -522, -930, -657, 178, 793, 849, 743, 796, 747, 156, -994, -2196, -2768, -2408, -1384, -191, 839, 1598, 2138, 2555, 2604, 1684, -275, -2215, -2912, -2275, -1085, 100, 1041, 1278, 467, -894, -1849, -2077, -2039, -1992, -1574, -597, 426, 891, 662, -192, -1446, -2323, -2014, -914, -387, -879, -1224, -377, 961, 1232, 54, -1495, -2422, -2750, -2873, -2858, -2704, -2625, -2611, -2212, -1211, -190, 69, -378, -698, -331, 403, 775, 377, -551, -1281, -1273, -860, -809, -1160, -1150, -370, 789, 1829, 2429, 2198, 1006, -608, -1967, -2827, -3048, -2370, -929, 675, 1949, 2575, 2309, 1497, 1073, 1254, 1087, 14, -1115, -1303, -732, -245, -309, -802, -1196, -943, -231, -39, -925, -2207, -2678, -1735, 221, 1933, 2161, 1105, 393, 1006, 2022, 2048, 949, -412, -1129, -622, 857, 1968, 1580, 302, -321, 78, 461, 171, -133, 428, 1669, 2558, 2388, 1338, 56, -862, -1018, -368, 497, 764, 417, 426, 1396, 2448, 2132, 389, -1169, -1017, 760, 2836, 3933, 3531, 1874, -184, -1648, -2214, -2655, -3840, -5256, -5232, -3206, -928, -315, -913, -1000, -450, -601, -1775, -2873, -3131, -2711, -1865, -853, -212, -57, 308, 1145, 1291, -484, -3396, -4930, -3605, -808, 722, 48, -1187, -1160, -79, 539, -88, -1439, -2421, -1976, 321, 3406, 5084, 4142, 1685, -292, -1154, -1569, -1739, -1026, 577, 1889, 2013, 1364, 575, -587, -2311, -3531, -2899, -761, 914, 736, -727, -1906, -1935, -1130, -264, 95, -171, -551, -151, 1121, 1840, 683, -1469, -2641, -2625, -2637, -2505, -964, 1370, 2214, 1069, -121, -90, 224, -290, -1206, -1521, -944, 464, 2649, 4664, 4816, 2855, 642, -445, -968, -1284, -361, 1819, 3057, 1909, 9, -187, 1377, 2708, 2408, 943, -263, -238, 869, 2019, 2195, 1421, 996, 2163, 4049, 3863, 601, -2582, -2234, 273, 1013, -213, -276, 1551, 2897, 2509, 1133, -478, -1315, -144, 1856, 1647, -950, -2672, -1763, 132, 1152, 958, -131, -1042, -181, 2228, 3654, 2388, -601, -3486, -5186, -4909, -2314, 1261, 3321, 2724, 724, -893, -1666, -1836, -1288, -387, -493, -2065, -3551, -3564, -2553, -1202, 606, 2133, 1622, -948, -3157, -3204, -1799, -329, 976, 2158, 2355, 856, -1413, -2706, -2501, -1697, -1024, -342, 627, 1836, 2934, 3046, 1179, -2331, -5339, -5655, -3089, 550, 3210, 4117, 3850, 3269, 2455, 749, -1918, -3815, -2749, 735, 3086, 2079, -291, -894, 564, 2396, 3521, 3418, 1704, -667, -1779, -1234, -388, 176, 1269, 2968, 3905, 3115, 1225, -551, -1575, -1509, 135, 3226, 5969, 5846, 2309, -2197, -4735, -4837, -4034, -3122, -1426, 1225, 3373, 3462, 1536, -1318, -4317, -6784, -7403, -5234, -1398, 1675, 2833, 2878, 2758, 2455, 1717, 706, -324, -1351, -2538, -3943, -4810, -3622, 39, 4086, 5748, 4493, 1970, -327, -2101, -3490, -4229, -3410, -277, 4079, 6835, 6503, 4539, 2682, 827, -1008, -1252, 695, 2890, 3447, 2637, 1356, -384, -2610, -4644, -5678, -5232, -3347, -908, 890, 1751, 2174, 2197, 1300, -309, -1315, -721, 849, 1837, 1410, -37, -1351, -861, 2296, 5878, 5952, 2333, -693, -853, -583, -1493, -1670, -486, -165, -951, -481, 1213, 1457, -219, -1683, -2062, -2078, -1610, -156, 1288, 1269, -7, -1170, -1628, -1874, -2196, -2098, -1249, -231, 360, 1102, 2723, 3992, 2499, -1832, -5870, -6946, -5567, -3450, -937, 2097, 4579, 5154, 3712, 874, -2937, -6783, -8492, -6240, -770, 5080, 8731, 8727, 4608, -1865, -6752, -7850, -7055, -6379, -4445, 22, 4373, 5102, 2181, -1893, -4760, -4847, -2346, 131, 376, -526, -324, 888, 1444, 791, -480, -1783, -2190, -422, 3200, 5774, 4594, 644, -2403, -2558, -1033, 380, 1074, 782, -405, -1280, -900, 4, 813, 2370, 4707, 5815, 4519, 2199, 433, -595, -1009, -944, -1045, -1268, -372, 1743, 3159, 2664, 1097, -638, -2227, -2570, -756, 1782, 2678, 1654, 138, -986, -1514, -1212, -281, 655, 1505, 2415, 2953, 2823, 2457, 1801, -46, -2924, -4976, -4680, -2081, 1980, 6063, 7855, 5843, 1378, -2447, -4027, -4105, -3692, -2849, -1809, -1338, -1041, 507, 2722, 2708, -364, -3490, -4142, -3178, -1784, 759, 4122, 5196, 1972, -3026, -5406, -3731, -297, 2086, 2682, 2206, 875, -1554, -4019, -4275, -1651, 1887, 4219, 4834, 3816, 1609, 2, 373, 1163, 341, -879, -435, 561, 305, 238, 2389, 5360, 6397, 4951, 1889, -2001, -5195, -5784, -3658, -378, 2927, 5754, 7025, 5649, 2080, -1761, -3950, -3596, -979, 2824, 6416, 8257, 6931, 2212, -3945, -8206, -8237, -4254, 1564, 6693, 9276, 8497, 5060, 1010, -1924, -3682, -4622, -3858, -664, 3166, 4785, 3760, 1903, 154, -2166, -5223, -7600, -7420, -3864, 1828, 6431, 6956, 3579, -402, -2069, -1723, -1710, -3018, -4063, -2966, -161, 2103, 2492, 1708, 882, 259, -175, -236, -292, -1057, -2175, -2596, -2563, -3277, -4360, -3700, -353, 3968, 6672, 6431, 3586, -464, -3949, -5377, -4131, -909, 2409, 3981, 3446, 1903, 281, -1655, -4133, -5779, -4669, -1275, 1397, 1616, 931, 1047, 1016, -488, -2396, -2757, -1201, 1431, 3915, 4446, 2030, -1515, -3158, -2372, -1205, -766, 199, 2860, 6067, 7353, 5724, 2741, 520, -827, -2681, -5068, -6108, -4601, -1425, 1830, 3861, 3606, 1387, -595, -892, -504, -161, 1491, 4865, 7692, 8334, 7548, 5642, 1479, -4477, -9328, -10737, -8703, -4851, -1525, -287, -273, 348, 1264, 824, -259, 807, 4397, 7054, 5834, 1877, -1928, -4782, -7004, -7344, -4770, -1383, 160, 286, 283, -571, -2442, -3299, -2510, -1674, -437, 3033, 6699, 6075, 1561, -1724, -1904, -2505, -5847, -8868, -7166, -613, 6493, 9870, 8804, 5531, 2196, -599, -2873, -4443, -4993, -3886, -673, 2916, 3294, -388, -4078, -4034, -1700, -364, 49, 1376, 3099, 3345, 2105, 727, -325, -1192, -1334, -487, -34, -1256, -2795, -2363, -452, 632, 498, -96, -1706, -3890, -3589, -186, 2240, 1697, 1484, 3092, 3007, -188, -2799, -2567, -1619, -1727, -2229, -2472, -2062, -310, 1682, 1417, -655, -1092, 1035, 2764, 2124, 599, 158, 704, 761, -584, -2127, -1481, 983, 1373, -1823, -4322, -2392, 1217, 2181, 1391, 2226, 4640, 6006, 5005, 2173, -898, -1929, -136, 1859, 811, -2870, -5839, -6198, -5074, -4092, -3339, -2251, -931, 329, 1446, 1676, 108, -2180, -2676, -941, 759, 845, -102, -1129, -1584, -602, 1439, 1932, -994, -5527, -8181, -7665, -5183, -2105, 1033, 3840, 5719, 6245, 5174, 2333, -1658, -4795, -5146, -3070, -818, -2, -580, -1711, -2297, -1482, 172, 1086, 923, 939, 1674, 2309, 2585, 3145, 3708, 3063, 1236, -220, -557, -949, -2715, -5361, -6962, -6056, -2827, 1293, 4552, 5433, 3353, -194, -2127, -945, 1314, 1990, 1344, 1066, 1102, 718, 703, 1565, 1652, -21, -1251, 174, 2697, 3180, 1550, 510, 1255, 2202, 2027, 1310, 652, -170, -763, -684, -1267, -3516, -4972, -2592, 2361, 6113, 7333, 6709, 3837, -1745, -7876, -10858, -8630, -2212, 4706, 7691, 5106, 289, -1557, 552, 2344, 666, -1811, -1196, 1310, 2008, 861, 298, 515, 382, 147, -36, -766, -681, 2322, 6159, 6064, 1820, -1564, -924, 1495, 1837, -1061, -5251, -7469, -5494, -40, 5660, 8567, 7945, 4884, 621, -4017, -7848, -9028, -6396, -1067, 4262, 7800, 9334, 8432, 4224, -2155, -7410, -9446, -8398, -4321, 2366, 8269, 9316, 5651, 546, -4077, -7375, -7530, -4104, 87, 2718, 4773, 7299, 8525, 6409, 1646, -3397, -6938, -8232, -7382, -5371, -3210, -757, 2701, 6289, 7031, 2774, -4561, -9891, -9806, -5554, -517, 3616, 6463, 6809, 4115, 706, -871, -1099, -1113, 65, 2568, 3334, 274, -4358, -7207, -7069, -3868, 1567, 6187, 6891, 4054, 238, -3165, -5574, -5667, -2782, 1519, 4856, 5920, 4424, 804, -3189, -5060, -4102, -2310, -1239, 373, 3497, 5674, 4696, 2729, 2430, 2198, -34, -2091, -1462, -46, -627, -2437, -3635, -4481, -5372, -4870, -1758, 3040, 7554, 10117, 9498, 5564, 457, -2479, -2099, -816, -1340, -3022, -3058, -583, 2310, 3344, 2260, 330, -1052, -1265, -796, -824, -1831, -2758, -2232, -599, 273, -497, -1466, -844, 909, 1601, 187, -2112, -3673, -3993, -3059, -984, 1252, 2572, 3434, 4540, 4441, 1374, -3297, -6492, -7084, -5778, -3486, -1751, -1718, -1528, 1467, 5682, 6984, 4814, 2057, 171, -1102, -1173, 130, 817, -482, -2195, -2529, -2158, -2231, -2019, -479, 1407, 1899, 1279, 1377, 2661, 3712, 3581, 2696, 1499, 92, -761, -301, 577, 181, -1340, -1963, -745, 920, 1806, 2841, 5111, 7488, 8153, 7130, 5479, 3408, 754, -2069, -4663, -6742, -7585, -7019, -6076, -5010, -2390, 1890, 5069, 5219, 4168, 4333, 4669, 2503, -1882, -5356, -6181, -5320, -3575, -842, 1457, 1017, -1529, -3192, -3356, -3954, -4935, -3912, -539, 2659, 4062, 4370, 4167, 2854, 546, -1197, -1497, -1500, -2474, -3911, -4598, -4143, -2375, 1017, 5057, 7479, 7269, 5543, 3369, 572, -2726, -5190, -5716, -4628, -2853, -826, 1134, 2209, 1823, 581, -452, -1013, -1338, -1153, -22, 1668, 2947, 3214, 2319, 175, -2796, -5101, -5026, -2425, 834, 2460, 1437, -1638, -5020, -6542, -5009, -1397, 1919, 3468, 3603, 3158, 2222, 684, -844, -1591, -1825, -2616, -4038, -4412, -2340, 926, 2663, 2233, 1617, 2051, 2353, 1374, -89, -728, -366, 303, 325, -844, -2297, -2496, -1755, -1749, -2251, -1327, 1061, 2966, 3924, 5120, 6342, 5971, 3801, 1336, -192, -477, 289, 1178, 845, -1049, -3494, -5418, -6483, -6552, -5341, -2937, -281, 1211, 777, -804, -1826, -1393, -133, 888, 1198, 666, -650, -1907, -1782, -124, 1515, 1753, 1034, 630, 665, 233, -835, -1530, -1147, -213, 517, 1196, 2157, 2708, 1888, 241, -755, -996, -1584, -2493, -2715, -2491, -2578, -1839, 1161, 4724, 5697, 4184, 3137, 3446, 2885, 328, -2240, -3113, -3422, -4409, -4718, -2963, -816, -588, -1577, -1561, -236, 1351, 3025, 4842, 5721, 4737, 2795, 1494, 962, 80, -1463, -2516, -2082, -769, -46, -588, -1891, -3044, -3244, -1949, 498, 2593, 3055, 2446, 2349, 3040, 3259, 2206, 444, -1024, -1474, -732, 329, 396, -458, -682, 474, 1949, 2584, 2338, 1369, -659, -3589, -6022, -6350, -4297, -1182, 1246, 2146, 1970, 1697, 1697, 1383, 99, -1718, -2660, -1853, 35, 1691, 2686, 3469, 4015, 3561, 2008, 552, 201, 451, 184, -791, -1816, -2467, -2723, -2380, -1289, -89, 308, 118, 497, 1764, 3029, 3641, 3503, 2160, -516, -2978, -3408, -2183, -1068, -601, -49, 824, 1566, 1822, 1267, -424, -2864, -4972, -5883, -5314, -3490, -1281, 404, 1668, 3074, 4102, 3726, 2239, 779, -407, -1525, -1906, -875, 1065, 2939, 3823, 2409, -1685, -6125, -7853, -6688, -4617, -2538, -133, 2356, 4322, 5427, 5042, 3017, 1230, 1815, 4125, 5815, 5835, 4214, 1023, -2379, -3658, -2702, -1732, -1561, -967, 227, 932, 1283, 2232, 3306, 3360, 2536, 1533, 237, -1444, -2658, -2641, -1693, -454, 948, 2480, 3572, 3580, 2569, 1141, -223, -1058, -722, 781, 2383, 3228, 3565, 3640, 2984, 1594, 318, -622, -1924, -3623, -4784, -4913, -4263, -2956, -1052, 889, 2232, 2718, 2236, 1041, 158, 361, 834, 131, -1718, -3228, -3345, -2451, -1628, -1538, -1838, -1545, -221, 1316, 1875, 1204, -41, -1291, -2465, -3616, -4578, -4881, -4020, -2015, 311, 1999, 2828, 3216, 3326, 2774, 1369, -301, -1366, -1612, -1594, -1738, -1686, -905, 301, 963, 600, -399, -1530, -2625, -3452, -3570, -2773, -1192, 1033, 3683, 6061, 7231, 6751, 4874, 2125, -855, -3098, -3593, -2253, -211, 1322, 2249, 3188, 4170, 4413, 3416, 1747, 452, -62, -297, -817, -1475, -1744, -1579, -1473, -1683, -1887, -1712, -1208, -607, 79, 929, 1791, 2442, 2928, 3313, 3310, 2748, 2109, 1785, 1229, -147, -1870, -3359, -5053, -7280, -8974, -8857, -6902, -3700, 339, 4327, 6802, 7090, 5904, 4413, 3339, 2502, 836, -2293, -5709, -7710, -8283, -8236, -7117, -4273, -862, 1458, 2449, 2263, 653, -1402, -1854, -487, 955, 1984, 3755, 5981, 6436, 4124, 652, -2048, -3635, -4481, -4258, -2298, 1110, 4533, 6475, 6295, 4316, 1576, -741, -2131, -2967, -3687, -4087, -3703, -2525, -947, 726, 2231, 3039, 2831, 2186, 2054, 2527, 2875, 2677, 2126, 1337, 252, -821, -1396, -1599, -1975, -2379, -2009, -968, -578, -1351, -2125, -2261, -2700, -3522, -2956, -505, 1657, 2023, 1708, 1772, 1454, 210, -1057, -1713, -2223, -2717, -2372, -666, 1721, 3472, 3748, 2870, 1982, 1832, 1999, 1567, 330, -1037, -1741, -1650, -1451, -1812, -2199, -1409, 264, 914, -30, -719, 21, 794, 332, -289, 383, 2046, 3509, 3966, 3023, 1049, -671, -1445, -2139, -3532, -4794, -4738, -3585, -2449, -1825, -1404, -839, -12, 1131, 2312, 2720, 1808, 240, -749, -946, -1234, -2040, -2673, -2437, -1608, -939, -795, -1103, -1740, -2521, -2923, -2310, -656, 1201, 2365, 2776, 2980, 3082, 2438, 647, -1498, -2566, -2040, -883, -348, -671, -1188, -1275, -735, 424, 2026, 3633, 4749, 5164, 4994, 4444, 3660, 2711, 1563, 134, -1473, -2838, -3543, -3608, -3411, -3195, -2880, -2271, -1251, 105, 1383, 2012, 1859, 1426, 1332, 1770, 2478, 2947, 2646, 1473, 70, -654, -533, -330, -701, -1202, -779, 759, 2257, 2525, 1826, 1412, 1810, 2404, 2623, 2458, 1799, 434, -1093, -1777, -1441, -799, -226, 533, 1503, 2172, 2128, 1349, -166, -2403, -4732, -5866, -4999, -2797, -840, -263, -1024, -1991, -1819, -469, 558, 477, 616, 2113, 3707, 3709, 2572, 1550, 554, -830, -1867, -1812, -1087, -251, 799, 1838, 1931, 767, -615, -1205, -1404, -2227, -3545, -4010, -2646, 245, 3621, 6331, 7354, 6294, 3810, 1132, -862, -1894, -1963, -1198, 96, 1619, 3252, 4646, 4905, 3433, 967, -1199, -2747, -3885, -3966, -2275, 230, 1733, 1742, 1009, -72, -1513, -2747, -3056, -2621, -1979, -823, 1319, 3368, 3363, 1182, -1104, -2162, -2824, -3911, -4616, -4026, -2575, -998, 655, 2061, 2043, 152, -2096, -2852, -2175, -1302, -442, 980, 2544, 3275, 3270, 3068, 2318, 747, -709, -1224, -1269, -1474, -1701, -1826, -1975, -1821, -1020, -250, -483, -1438, -1834, -1092, 193, 1383, 2473, 3411, 3572, 2531, 709, -1232, -2945, -3992, -3902, -3003, -2128, -1412, -432, 667, 1408, 1873, 2263, 2209, 1561, 1041, 1200, 1493, 1191, 470, -152, -806, -1787, -2500, -1946, -251, 1406, 2389, 3064, 3651, 3919, 3976, 4135, 4074, 3214, 1664, -61, -1785, -3380, -4392, -4633, -4564, -4488, -3920, -2429, -669, 189, -58, -527, -569, -414, -312, 81, 1099, 2425, 3428, 3656, 2803, 766, -1808, -3643, -4187, -4279, -4677, -4671, -3323, -1275, 89, 626, 1132, 1703, 1756, 1281, 817, 452, -225, -1234, -1935, -1790, -999, -159, 503, 1272, 2322, 3315, 3765, 3687, 3618, 3990, 4595, 4825, 4312, 3171, 1634, -267, -2417, -4126, -4476, -3365, -1697, -209, 1119, 2229, 2624, 2311, 1929, 1565, 768, -75, 57, 1019, 1459, 834, 6, -408, -920, -1937, -2781, -2605, -1652, -842, -485, -210, -83, -819, -2500, -3956, -4142, -3497, -3023, -2591, -1283, 832, 2483, 2833, 2279, 1495, 604, -428, -1321, -1808, -1956, -1809, -1166, -100, 713, 701, 80, -634, -1423, -2435, -3211, -3003, -1756, -145, 1407, 3055, 4702, 5489, 4643, 2583, 610, -451, -756, -605, 101, 1227, 1985, 1842, 1241, 807, 459, -122, -748, -1039, -900, -245, 1050, 2493, 2961, 1867, -128, -1891, -2925, -3477, -3710, -3150, -1270, 1381, 3471, 4503, 4925, 4455, 2346, -325, -1360, -897, -1049, -1952, -1800, -656, -366, -1061, -1331, -984, -614, 166, 1553, 2445, 2328, 2209, 2462, 1875, -208, -2645, -4064, -4303, -3810, -2725, -1105, 530, 1496, 1624, 1278, 769, 154, -442, -757, -722, -496, -135, 395, 771, 327, -1157, -3096, -4764, -5872, -6219, -5495, -3888, -2153, -699, 690, 2025, 2848, 2883, 2207, 909, -700, -1883, -2197, -2116, -2284, -2509, -2163, -1288, -652, -669, -893, -709, -3, 1094, 2589, 4297, 5566, 5745, 4749, 3016, 1206, -15, -327, -69, 19, -428, -1012, -1025, -297, 548, 802, 546, 618, 1610, 3099, 4077, 4043, 3385, 2645, 1822, 707, -454, -1117, -1115, -730, -230, 271, 616, 648, 487, 496, 961, 1839, 2755, 3206, 2930, 2164, 1442, 932, 171, -1211, -2706, -3383, -3002, -2055, -953, 225, 1447, 2717, 4011, 4878, 4711, 3607, 2272, 952, -646, -2281, -3078, -2865, -2635, -3034, -3289, -2586, -1708, -1880, -2687, -2783, -2145, -1822, -1910, -1592, -873, -543, -571, -97, 960, 1597, 1282, 636, 129, -691, -1983, -2895, -2929, -2715, -2619, -2030, -797, 203, 516, 650, 894, 911, 487, -284, -1140, -1465, -878, -145, -175, -319, 655, 2252, 2706, 1489, -284, -1645, -2456, -2563, -1669, -151, 985, 1222, 1061, 1162, 1371, 1056, 274, -102, 373, 1144, 1728, 2463, 3459, 3801, 2862, 1584, 1184, 1206, 297, -1394, -2217, -1631, -1051, -1332, -1328, -275, 425, -436, -1661, -1736, -1232, -1258, -1421, -966, -287, -64, -236, -419, -285, 497, 1753, 2629, 2603, 2054, 1430, 635, -450, -1616, -2693, -3661, -4355, -4568, -4469, -4450, -4560, -4370, -3433, -1812, -114, 1034, 1542, 1697, 1648, 1451, 1442, 1880, 2280, 1902, 870, 9, -427, -1020, -2026, -2781, -2675, -2030, -1418, -734, 240, 1010, 1155, 1289, 2061, 2890, 2886, 2239, 1610, 1044, 434, 100, 177, 323, 370, 432, 352, -62, -419, -218, 260, 260, -383, -1097, -1436, -1638, -2118, -2710, -2776, -2037, -967, -200, 202, 624, 1275, 1961, 2441, 2698, 2754, 2471, 1820, 1098, 529, -159, -1257, -2371, -2837, -2649, -2336, -2040, -1439, -497, 397, 1093, 1837, 2622, 3017, 2994, 3206, 3973, 4605, 4395, 3579, 2672, 1550, -18, -1560, -2399, -2526, -2244, -1387, 213, 1817, 2371, 2016, 1805, 1938, 1657, 881, 260, -373, -1695, -3136, -3326, -2294, -1446, -1344, -1082, 14, 1390, 2220, 2334, 1787, 483, -1222, -2401, -2713, -2845, -3217, -3369, -3123, -3066, -3340, -3319, -2935, -2915, -3320, -3110, -1646, 365, 1915, 2826, 3376, 3432, 2749, 1701, 896, 223, -903, -2412, -3440, -3396, -2498, -1174, 424, 2040, 3063, 3170, 2826, 2645, 2641, 2558, 2429, 2333, 2083, 1521, 664, -512, -1847, -2691, -2483, -1434, -110, 1229, 2345, 2661, 1926, 757, -99, -744, -1722, -2884, -3430, -3085, -2503, -2301, -2351, -2400, -2724, -3543, -4228, -3880, -2577, -1176, 60, 1583, 3270, 4253, 4235, 3717, 2858, 1463, 34, -660, -877, -1355, -1846, -1538, -604, -58, -211, -397, -191, 48, 50, 193, 850, 1838, 2968, 4397, 5986, 6997, 6942, 6164, 5267, 4560, 4288, 4650, 5211, 4937, 3428, 1670, 850, 825, 649, 125, -216, -194, 133, 988, 2180, 2743, 2186, 1144, 171, -816, -1614, -1659, -1032, -270, 580, 1548, 1997, 1427, 346, -559, -1352, -2277, -3049, -3295, -3117, -2828, -2553, -2247, -1886, -1584, -1518, -1579, -1344, -683, -15, 396, 863, 1532, 2045, 2351, 2898, 3557, 3486, 2486, 1347, 486, -593, -2234, -4019, -5456, -6446, -6940, -6680, -5446, -3521, -1869, -1344, -1469, -830, 815, 1965, 1543, 467, 105, 295, 3, -879, -1562, -1712, -1708, -1679, -1366, -956, -1060, -1665, -2103, -2196, -2349, -2429, -1774, -482, 506, 798, 996, 1493, 1816, 1605, 1405, 1764, 2237, 2139, 1711, 1636, 1957, 2354, 2786, 3077, 2718, 1776, 992, 596, 68, -700, -1166, -1170, -1143, -1176, -839, 9, 895, 1371, 1539, 1808, 2348, 2915, 3183, 3007, 2390, 1362, 60, -1233, -2233, -2845, -3171, -3360, -3491, -3656, -4015, -4518, -4703, -4251, -3601, -3395, -3440, -2961, -1798, -572, 303, 942, 1358, 1324, 961, 746, 735, 377, -600, -1560, -1683, -1089, -713, -1056, -1625, -1858, -1959, -2227, -2176, -1222, 221, 1366, 2309, 3596, 4980, 5765, 5968, 6129, 6291, 6005, 5094, 3785, 2350, 953, -314, -1391, -2162, -2405, -1994, -1122, -157, 786, 1882, 3086, 4018, 4550, 4925, 5041, 4494, 3602, 3179, 3106, 2475, 1386, 914, 1135, 874, -233, -1049, -734, 28, 84, -703, -1494, -1563, -974, -260, 207, 294, -162, -1087, -1765, -1422, -257, 858, 1598, 2258, 2851, 3161, 3401, 3784, 3795, 2880, 1361, -104, -1367, -2544, -3692, -4931, -6163, -6763, -6359, -5423, -4400, -3105, -1660, -806, -604, -101, 1138, 2368, 2826, 2472, 1503, 127, -1241, -2317, -3204, -4048, -4964, -6216, -7711, -8614, -8359, -7518, -6780, -5926, -4686, -3577, -2985, -2400, -1317, -33, 930, 1422, 1452, 1097, 697, 593, 646, 435, -111, -671, -1071, -1431, -1719, -1737, -1726, -2217, -3000, -3170, -2466, -1554, -704, 604, 2450, 4032, 4886, 5534, 6498, 7441, 7734, 7331, 6625, 5852, 5142, 4757, 4679, 4351, 3462, 2474, 1756, 940, -240, -1316, -1863, -2010, -1883, -1444, -869, -219, 833, 2140, 2764, 2335, 1702, 1592, 1753, 1823, 1832, 1662, 1149, 663, 600, 584, 45, -859, -1653, -2436, -3575, -4812, -5461, -5440, -5352, -5439, -5279, -4700, -4070, -3442, -2448, -1249, -443, -2, 576, 1247, 1620, 1825, 2105, 2168, 1764, 1238, 915, 649, 290, -141, -734, -1412, -1750, -1565, -1140, -467, 827, 2544, 3902, 4640, 5158, 5569, 5579, 5198, 4728, 4124, 3179, 2278, 2144, 2647, 2791, 2280, 1995, 2303, 2296, 1491, 647, 62, -1000, -2474, -3194, -3053, -3272, -4108, -4417, -3749, -2993, -2657, -2123, -899, 528, 1499, 2027, 2504, 3108, 3892, 4882, 5668, 5548, 4527, 3357, 2246, 576, -1765, -3961, -5451, -6430, -7059, -7149, -6597, -5441, -3754, -1925, -454, 750, 2129, 3514, 4238, 4146, 3695, 3274, 2972, 2733, 2344, 1732, 1352, 1594, 1871, 1178, -383, -1579, -1730, -1618, -2275, -3589, -4784, -5703, -6708, -7653, -8006, -7791, -7532, -7444, -7400, -7265, -6686, -5186, -2939, -699, 1206, 2971, 4455, 5233, 5350, 5147, 4617, 3571, 1968, -222, -2831, -5140, -6546, -7390, -8198, -8653, -8217, -7116, -5810, -4183, -2079, 55, 1698, 2882, 3835, 4529, 5003, 5597, 6279, 6238, 4987, 3378, 2380, 1546, 174, -968, -920, -393, -399, -281, 864, 2234, 2608, 2249, 2016, 1842, 1351, 798, 432, -209, -1464, -2648, -2930, -2558, -2214, -1697, -585, 440, 573, 477, 1156, 2069, 2029, 1063, -106, -1293, -2451, -3215, -3704, -4628, -6037, -7018, -7102, -6953, -7073, -6750, -5188, -2952, -1102, 447, 2334, 4192, 5243, 5564, 5359, 4124, 1886, -181, -1451, -2544, -3711, -4339, -4386, -4456, -4375, -3401, -1703, -229, 689, 1477, 2345, 3077, 3569, 3948, 4184, 4032, 3430, 2604, 1734, 843, 100, -268, -377, -448, -230, 697, 2234, 3942, 5525, 6613, 6768, 6167, 5530, 4973, 3745, 1240, -2520, -7201, -12077, -16023, -18454, -19962, -21317, -22271, -21945, -19995, -16705, -12362, -7283, -2334, 1526, 4389, 7222, 10339, 12983, 14517, 14994, 14425, 12739, 10505, 8569, 6926, 4949, 2709, 1087, 702, 1387, 2767, 4747, 7375, 10534, 13947, 17326, 20391, 22924, 24891, 26456, 27734, 28662, 29186, 29395, 29415, 29350, 29338, 29513, 29782, 29830, 29398, 28522, 27527, 26687, 25890, 24714, 22870, 20541, 18203, 16208, 14767, 14047, 14155, 14912, 15877, 16662, 17276, 18054, 19292, 20881, 22287, 22858, 22450, 21545, 20466, 18829, 16297, 13416, 10831, 8192, 4814, 961, -2538, -5329, -7432, -8764, -9405, -9713, -9764, -9310, -8466, -7759, -7366, -6977, -6460, -6140, -6281, -6704, -7170, -7776, -8737, -9956, -11144, -12167, -13081, -13955, -14920, -16176, -17665, -18972, -19745, -20106, -20356, -20472, -20207, -19631, -19112, -18745, -18295, -17640, -16890, -16020, -15003, -14164, -13787, -13550, -12972, -12260, -12008, -12271, -12579, -12781, -13283, -14388, -15840, -17224, -18412, -19407, -19989, -19875, -19106, -17976, -16696, -15315, -13863, -12325, -10632, -8876, -7468, -6816, -6797, -6713, -6008, -4922, -4291, -4597, -5426, -6014, -6157, -6346, -7042, -8046, -8778, -9030, -9232, -9835, -10618, -10876, -10287, -9387, -8942, -9014, -8945, -8409, -7989, -8285, -8886, -8977, -8616, -8549, -9009, -9636, -10366, -11450, -12780, -13939, -14878, -15873, -16934, -17835, -18683, -19864, -21271, -22119, -21852, -20753, -19475, -18441, -17905, -17957, -18131, -17662, -16489, -15495, -15532, -16530, -17731, -18498, -18663, -18436, -18196, -18222, -18337, -18064, -17280, -16472, -15995, -15513, -14549, -13268, -12106, -10960, -9369, -7386, -5720, -4875, -4504, -3810, -2557, -1368, -893, -979, -1020, -843, -674, -475, -6, 613, 1007, 1016, 707, 238, 38, 559, 1522, 2071, 1991, 2148, 3247, 4737, 5551, 5570, 5581, 5980, 6396, 6507, 6240, 5343, 3822, 2493, 2010, 1783, 991, -55, -632, -873, -1256, -1614, -1583, -1395, -1430, -1492, -1198, -744, -719, -1266, -1962, -2477, -2866, -3222, -3569, -4082, -4904, -5737, -6149, -6215, -6362, -6657, -6765, -6586, -6394, -6264, -5880, -5179, -4666, -4692, -4890, -4764, -4383, -4067, -3815, -3517, -3275, -3134, -2853, -2303, -1796, -1704, -1911, -1926, -1507, -941, -680, -865, -1216, -1245, -671, 220, 811, 933, 1177, 2123, 3545, 4721, 5339, 5740, 6346, 7114, 7618, 7591, 7246, 6950, 6696, 6180, 5320, 4354, 3451, 2594, 1833, 1314, 1126, 1350, 2026, 2881, 3404, 3462, 3527, 4090, 5118, 6205, 6932, 7035, 6544, 5950, 5897, 6439, 6829, 6456, 5775, 5748, 6585, 7564, 7991, 7801, 7396, 7332, 7866, 8520, 8482, 7566, 6304, 5119, 4064, 3447, 3847, 5206, 6468, 6730, 6349, 6283, 6782, 7468, 8188, 8762, 8444, 6894, 5113, 4338, 4638, 5376, 6034, 6113, 5512, 5214, 6200, 7790, 8538, 8396, 8503, 9304, 10275, 11012, 11447, 11272, 10151, 8275, 5864, 2345, -2825, -8534, -12867, -15649, -18221, -20527, -20764, -18136, -13432, -7056, 1013, 9479, 16485, 21717, 25837, 28672, 29754, 29811, 29906, 29713, 28145, 25457, 23201, 22124, 21528, 20974, 20784, 20639, 19698, 18528, 18716, 20339, 22046, 23465, 25322, 27482, 29116, 30195, 31225, 32101, 32484, 32593, 32735, 32767, 32533, 32278, 32229, 32203, 31972, 31623, 31321, 30878, 29932, 28354, 26010, 22709, 18864, 15479, 12855, 10337, 7855, 6418, 6519, 7534, 9033, 11147, 13501, 15399, 16983, 18738, 20242, 20494, 19204, 16840, 13908, 10818, 7940, 5188, 2004, -1895, -6053, -9776, -12873, -15497, -17528, -18768, -19398, -19649, -19215, -17781, -15787, -13863, -11967, -9827, -7780, -6433, -5921, -6040, -6583, -7206, -7479, -7440, -7733, -8801, -10227, -11289, -11923, -12618, -13557, -14529, -15433, -16147, -16313, -15903, -15478, -15159, -14283, -12670, -11159, -10246, -9250, -7594, -5894, -4984, -4617, -4054, -3397, -3253, -3445, -3308, -3094, -3672, -4929, -6012, -6919, -8336, -10267, -12161, -13814, -15074, -15503, -15185, -14737, -14113, -12631, -10346, -8098, -6222, -4479, -3034, -2318, -2073, -1581, -1013, -1372, -2839, -4245, -4885, -5613, -7260, -9198, -10587, -11807, -13478, -15305, -16731, -17696, -18203, -18277, -18367, -18798, -19078, -18692, -18017, -17710, -17817, -18140, -18766, -19608, -20149, -20151, -20174, -20839, -21961, -22826, -23258, -23773, -24727, -25826, -26650, -27188, -27657, -28160, -28674, -29097, -29310, -29236, -28870, -28132, -26851, -25076, -23229, -21769, -20706, -19717, -18650, -17554, -16297, -14788, -13469, -12826, -12558, -12087, -11623, -11685, -11957, -11573, -10384, -9022, -8100, -7773, -7630, -6797, -4782, -2292, -557, 220, 1001, 2361, 3679, 4264, 4467, 4998, 5698, 6041, 6270, 6885, 7494, 7391, 6729, 6089, 5565, 5090, 4774, 4382, 3407, 1972, 712, -160, -735, -897, -848, -1362, -2613, -3592, -3460, -2692, -2343, -2831, -3795, -4568, -4708, -4439, -4451, -5075, -5953, -6677, -7229, -7682, -8001, -8319, -8926, -9798, -10422, -10327, -9640, -8959, -8671, -8559, -8164, -7421, -6731, -6448, -6460, -6373, -6103, -5964, -5933, -5365, -4045, -2859, -2439, -1984, -632, 968, 1825, 2222, 2820, 3357, 3449, 3571, 4208, 5044, 5597, 5770, 5604, 5272, 5183, 5391, 5290, 4497, 3582, 3258, 3317, 3126, 2867, 3319, 4411, 5067, 4865, 4721, 5373, 6197, 6329, 6055, 6187, 6682, 6771, 6218, 5707, 5870, 6452, 6732, 6539, 6377, 6549, 6622, 6058, 5096, 4560, 4731, 4894, 4336, 3427, 3150, 3701, 4296, 4415, 4487, 5025, 5696, 5856, 5632, 5700, 6121, 6225, 5747, 5292, 5367, 5642, 5523, 4955, 4339, 3962, 3716, 3272, 2526, 1791, 1375, 1133, 773, 421, 413, 724, 1046, 1281, 1540, 1818, 2023, 2182, 2360, 2501, 2504, 2350, 2074, 1713, 1347, 1107, 1073, 1167, 1211, 1120, 1055, 1266, 1784, 2335, 2631, 2649, 2552, 2421, 2235, 2071, 2103, 2327, 2467, 2346, 2236, 2590, 3496, 4568, 5319, 5524, 5295, 5042, 5306, 6315, 7613, 8358, 8259, 8093, 8925, 10719, 12142, 12127, 11223, 10832, 11343, 11804, 11451, 10769, 10627, 11051, 11417, 11557, 11891, 12531, 12860, 12282, 10960, 9509, 8269, 7178, 6162, 5182, 4086, 2904, 2202, 2579, 3737, 4689, 4893, 4637, 4318, 3924, 3238, 2188, 1084, 484, 403, 80, -767, -1192, -524, 289, 188, -101, 740, 2360, 3205, 2864, 2446, 2798, 3576, 4234, 4788, 5148, 4523, 2357, -770, -3820, -6379, -8665, -10949, -13180, -14701, -14339, -11433, -6649, -1225, 4424, 10598, 17040, 22559, 26186, 28050, 28777, 28693, 28034, 27234, 26367, 24920, 22769, 20735, 19573, 19057, 18571, 18054, 17689, 17275, 16647, 16403, 17406, 19530, 21782, 23633, 25327, 26929, 28083, 28759, 29238, 29318, 28501, 26896, 25204, 23832, 22686, 21606, 20536, 19323, 17880, 16490, 15451, 14348, 12335, 9382, 6341, 3725, 1292, -983, -2665, -3628, -4107, -3968, -2966, -1419, 163, 1850, 3780, 5359, 5814, 5233, 4361, 3503, 2323, 689, -968, -2408, -4057, -6340, -8957, -11347, -13544, -15854, -17891, -18821, -18692, -18510, -18631, -18036, -15856, -12803, -10269, -8651, -7391, -6266, -5819, -6459, -7657, -8373, -8232, -7960, -8392, -9302, -9692, -9174, -8530, -8644, -9319, -9693, -9537, -9384, -9388, -9006, -8004, -6901, -6069, -5219, -3963, -2265, -382, 1136, 1721, 1566, 1599, 2226, 2791, 2688, 2234, 2043, 2128, 2083, 1682, 963, -3, -1164, -2403, -3628, -4835, -5997, -6977, -7671, -8036, -7858, -6829, -5159, -3686, -3005, -2828, -2553, -2131, -2002, -2403, -3238, -4461, -6081, -7756, -8970, -9727, -10646, -12103, -13789, -15287, -16614, -17926, -19112, -20030, -20798, -21520, -21898, -21555, -20650, -19840, -19543, -19622, -19768, -19884, -20049, -20339, -20753, -21143, -21350, -21415, -21458, -21391, -21041, -20576, -20389, -20558, -20771, -20829, -20926, -21230, -21527, -21509, -21189, -20671, -19815, -18500, -17007, -15647, -14319, -12878, -11448, -10124, -8775, -7474, -6553, -6030, -5462, -4672, -4104, -4174, -4574, -4694, -4486, -4379, -4472, -4366, -3815, -2954, -1943, -841, 352, 1818, 3603, 5111, 5735, 5927, 6545, 7321, 7259, 6359, 5552, 5099, 4434, 3509, 3039, 3239, 3322, 2647, 1600, 862, 436, -38, -570, -1048, -1627, -2315, -2770, -2936, -3158, -3463, -3558, -3585, -3974, -4634, -5133, -5502, -6101, -6913, -7592, -8035, -8378, -8668, -8886, -9142, -9521, -9829, -9827, -9683, -9840, -10317, -10488, -9847, -8702, -7752, -7155, -6500, -5606, -4755, -4049, -3236, -2366, -1981, -2271, -2635, -2473, -1960, -1651, -1596, -1326, -542, 570, 1695, 2768, 3891, 5096, 6261, 7154, 7660, 8082, 8878, 9950, 10655, 10734, 10739, 11144, 11589, 11482, 10934, 10551, 10487, 10286, 9660, 8911, 8395, 8045, 7706, 7563, 7852, 8413, 8779, 8664, 8306, 8226, 8579, 8783, 8219, 7191, 6616, 6735, 6795, 6262, 5647, 5648, 5958, 5681, 4717, 3861, 3485, 2945, 1684, 177, -757, -1082, -1409, -1989, -2391, -2195, -1624, -1200, -974, -511, 291, 870, 792, 510, 774, 1523, 1920, 1562, 1057, 1153, 1683, 1789, 1185, 632, 833, 1270, 940, -11, -427, 9, 275, -252, -733, -224, 840, 1382, 1302, 1484, 2363, 3287, 3533, 3420, 3819, 4771, 5323, 4938, 4380, 4697, 5713, 6266, 5831, 5166, 5088, 5300, 5024, 4317, 3942, 4094, 4117, 3602, 3029, 3073, 3726, 4427, 4815, 5095, 5544, 5880, 5562, 4756, 4281, 4330, 4076, 3009, 1910, 1725, 2132, 2069, 1291, 636, 719, 1040, 674, -454, -1419, -1401, -704, -416, -1114, -2162, -2478, -1859, -1171, -1171, -1567, -1602, -1239, -1148, -1547, -1801, -1545, -1434, -2094, -2980, -3163, -2768, -2652, -2990, -3096, -2489, -1505, -840, -794, -972, -732, -51, 322, -155, -927, -938, -58, 765, 1007, 1378, 2557, 3879, 4291, 4007, 4125, 4976, 5838, 6073, 5702, 5052, 4576, 4885, 6308, 8257, 9508, 9417, 8745, 8877, 10170, 11473, 11615, 10755, 9790, 8969, 7948, 6894, 6447, 6608, 6479, 5308, 3340, 1425, -45, -1695, -4198, -6778, -7574, -5905, -3140, -598, 2266, 6621, 12200, 17572, 21814, 24948, 27057, 27931, 27486, 26009, 23814, 21188, 18656, 16728, 15274, 13725, 12117, 11287, 11765, 12916, 13628, 13571, 13471, 14221, 15921, 17845, 19264, 20178, 21143, 22465, 23782, 24509, 24506, 24098, 23474, 22387, 20613, 18437, 16370, 14536, 12696, 10908, 9611, 8847, 7863, 6028, 3767, 2065, 1282, 753, -349, -1977, -3142, -3110, -2439, -2138, -1944, -648, 1800, 3799, 4277, 4049, 4224, 4311, 3030, 384, -2202, -3862, -5228, -7209, -9625, -11586, -12644, -13062, -13315, -13609, -13749, -13430, -12733, -12040, -11328, -10048, -7958, -5653, -3895, -2786, -1933, -1176, -742, -766, -1105, -1630, -2269, -2793, -3010, -3195, -3754, -4552, -5050, -5060, -4874, -4754, -4722, -4758, -4780, -4497, -3663, -2479, -1454, -795, -222, 575, 1529, 2401, 3036, 3298, 3090, 2603, 2171, 1727, 779, -844, -2608, -3845, -4543, -5267, -6347, -7452, -8123, -8467, -8971, -9676, -10056, -9809, -9367, -9253, -9299, -8905, -8003, -7219, -6986, -7046, -7067, -7263, -7978, -9065, -10180, -11332, -12672, -14019, -15038, -15726, -16392, -17215, -18050, -18582, -18731, -18793, -19079, -19457, -19491, -19064, -18481, -17962, -17366, -16605, -15941, -15605, -15381, -14935, -14419, -14257, -14403, -14338, -13872, -13431, -13321, -13276, -12986, -12662, -12666, -12850, -12694, -12112, -11702, -11913, -12225, -11725, -10428, -9256, -8625, -7896, -6602, -5219, -4243, -3425, -2450, -1643, -1359, -1287, -959, -571, -691, -1354, -1962, -2113, -2004, -1941, -1900, -1726, -1443, -1134, -775, -332, 161, 645, 1055, 1371, 1642, 1864, 1942, 1881, 1816, 1708, 1284, 492, -312, -863, -1350, -1983, -2543, -2750, -2815, -3161, -3683, -3862, -3651, -3670, -4265, -4952, -5177, -5147, -5432, -6044, -6452, -6398, -6224, -6281, -6450, -6456, -6416, -6689, -7317, -7870, -7925, -7539, -7178, -7183, -7385, -7458, -7407, -7424, -7392, -7078, -6680, -6552, -6533, -6172, -5511, -4991, -4647, -4060, -3150, -2371, -1920, -1368, -426, 425, 618, 485, 892, 1955, 2781, 2744, 2385, 2648, 3642, 4703, 5359, 5656, 5832, 6217, 7080, 8163, 8781, 8755, 8732, 9183, 9752, 9990, 10090, 10341, 10342, 9520, 8186, 7344, 7383, 7608, 7240, 6336, 5458, 4944, 4849, 5175, 5711, 5916, 5433, 4610, 4052, 3862, 3774, 3703, 3574, 3037, 2055, 1337, 1324, 1319, 530, -525, -737, -254, -353, -1441, -2397, -2397, -2212, -2822, -3694, -3666, -2949, -2873, -3746, -4319, -3651, -2438, -1858, -1901, -1708, -1069, -586, -437, -10, 1001, 1903, 1933, 1406, 1336, 2035, 2704, 2557, 1858, 1430, 1566, 1931, 2284, 2691, 3104, 3363, 3651, 4389, 5555, 6578, 7109, 7435, 7896, 8300, 8326, 8192, 8374, 8764, 8717, 8062, 7439, 7308, 7208, 6569, 5774, 5584, 5804, 5493, 4526, 3868, 4003, 4043, 3063, 1596, 935, 1206, 1131, -121, -1663, -2150, -1726, -1625, -2160, -2388, -1928, -1640, -2060, -2489, -2311, -2100, -2614, -3498, -3837, -3523, -3283, -3568, -4029, -4119, -3689, -2950, -2217, -1729, -1417, -900, -41, 705, 924, 1018, 1716, 2784, 3077, 2200, 1334, 1750, 3163, 4337, 4735, 4735, 4743, 4985, 5701, 6729, 7200, 6442, 5012, 4202, 4489, 4935, 4356, 2892, 1897, 2141, 2906, 3384, 3908, 4863, 5509, 5226, 4953, 5847, 7302, 7778, 6984, 5932, 5306, 4943, 4678, 4716, 5079, 5347, 5213, 4940, 5069, 5888, 7190, 8251, 8141, 6665, 5008, 4697, 5566, 5577, 3184, -630, -3502, -4577, -5188, -6616, -8124, -7985, -5676, -2178, 1705, 6233, 11691, 17401, 22189, 25418, 27182, 27939, 28110, 27716, 26219, 23195, 19357, 16368, 15097, 14599, 13437, 11704, 10874, 11880, 14245, 16908, 19031, 20175, 20605, 21264, 22749, 24383, 24995, 24471, 23806, 23604, 23254, 21980, 19993, 18097, 16620, 15295, 13892, 12407, 10839, 9265, 7954, 7007, 6000, 4485, 2735, 1383, 354, -1054, -2951, -4513, -5061, -4716, -3858, -2645, -1247, 94, 1438, 3055, 4759, 5789, 5669, 4780, 3692, 2373, 548, -1636, -3885, -6111, -8083, -9366, -10012, -10527, -10869, -10434, -9204, -7930, -6938, -5690, -3778, -1658, -51, 847, 1298, 1470, 1366, 1071, 725, 263, -480, -1455, -2401, -3137, -3640, -3977, -4275, -4635, -4984, -5202, -5321, -5437, -5535, -5550, -5464, -5196, -4640, -3931, -3373, -3034, -2671, -2142, -1615, -1289, -1155, -1136, -1319, -1875, -2803, -3866, -4825, -5673, -6560, -7586, -8697, -9793, -10790, -11601, -12130, -12363, -12441, -12464, -12275, -11615, -10590, -9647, -8986, -8305, -7389, -6579, -6336, -6648, -7145, -7665, -8352, -9325, -10463, -11567, -12544, -13381, -14092, -14718, -15251, -15563, -15560, -15372, -15236, -15189, -15079, -14814, -14446, -14044, -13688, -13466, -13397, -13416, -13448, -13461, -13453, -13455, -13520, -13649, -13764, -13845, -13961, -14130, -14258, -14279, -14319, -14529, -14811, -14908, -14728, -14488, -14364, -14202, -13694, -12763, -11642, -10585, -9648, -8754, -7827, -6841, -5874, -5126, -4778, -4798, -4942, -5043, -5184, -5492, -5873, -6192, -6535, -6928, -6946, -6297, -5516, -5293, -5285, -4604, -3344, -2479, -2226, -1712, -638, -29, -603, -1412, -1249, -662, -1113, -2601, -3673, -3709, -3617, -4125, -4770, -4876, -4614, -4605, -4970, -5172, -4866, -4548, -4953, -5863, -6264, -5851, -5525, -5992, -6673, -6643, -6043, -5754, -5960, -5915, -5217, -4570, -4763, -5470, -5691, -5141, -4579, -4751, -5437, -5753, -5308, -4734, -4751, -5038, -4766, -4028, -3610, -3495, -2882, -1761, -1040, -909, -407, 942, 2275, 2738, 2782, 3281, 4051, 4256, 3868, 3639, 3802, 3888, 3743, 3769, 4165, 4717, 5286, 5901, 6525, 7114, 7717, 8321, 8798, 9019, 8905, 8533, 8257, 8359, 8562, 8432, 8122, 8077, 8190, 8054, 7796, 7885, 8237, 8274, 7734, 6901, 6174, 5776, 5724, 5740, 5402, 4672, 4117, 4282, 4927, 5267, 4957, 4412, 4133, 4182, 4357, 4420, 4119, 3435, 2816, 2741, 3033, 3027, 2517, 2028, 1974, 2021, 1699, 1216, 1094, 1327, 1524, 1640, 1940, 2389, 2648, 2665, 2792, 3230, 3676, 3696, 3377, 3293, 3667, 3917, 3493, 2863, 2978, 3826, 4342, 3939, 3360, 3556, 4291, 4546, 4019, 3444, 3407, 3564, 3359, 2945, 2845, 3044, 3076, 2897, 3002, 3541, 3914, 3619, 3064, 2980, 3318, 3322, 2670, 1957, 1791, 1903, 1601, 882, 479, 750, 1132, 990, 519, 301, 314, 14, -732, -1402, -1685, -1956, -2534, -3041, -3047, -2884, -3101, -3480, -3402, -2898, -2550, -2554, -2578, -2395, -2108, -1871, -1744, -1747, -1819, -1824, -1730, -1688, -1892, -2368, -2898, -3192, -3184, -3054, -2915, -2677, -2336, -2057, -1774, -1128, -75, 839, 1204, 1328, 1690, 2082, 1865, 1016, 377, 599, 1172, 1008, -28, -761, -178, 1255, 2284, 2602, 3109, 4330, 5417, 5397, 4796, 4923, 5804, 6053, 4995, 3704, 3416, 3923, 4156, 3769, 3417, 3706, 4379, 4723, 4542, 4415, 4897, 5654, 5735, 4788, 3705, 3696, 4817, 5916, 6026, 5221, 4134, 3355, 3313, 3953, 4479, 4086, 2914, 1748, 1042, 739, 733, 886, 818, 194, -793, -1670, -2359, -3171, -4083, -4597, -4461, -3861, -2761, -710, 2441, 6329, 10619, 15128, 19407, 22922, 25485, 27085, 27489, 26519, 24579, 22393, 20334, 18291, 16127, 14075, 12594, 12080, 12700, 14196, 15909, 17355, 18745, 20440, 22252, 23773, 25056, 26253, 27028, 27014, 26507, 25994, 25345, 24122, 22464, 20936, 19514, 17670, 15491, 13759, 12563, 11192, 9616, 8590, 8008, 6886, 5226, 4112, 3781, 3287, 2208, 1220, 820, 731, 640, 703, 1115, 1788, 2515, 3155, 3545, 3532, 3150, 2441, 1111, -1093, -3663, -5789, -7459, -9305, -11390, -13072, -13973, -14239, -13988, -13237, -12156, -10877, -9332, -7575, -5924, -4547, -3264, -1985, -1006, -659, -857, -1287, -1878, -2744, -3757, -4603, -5177, -5589, -5853, -5935, -5947, -5966, -5847, -5507, -5170, -5001, -4750, -4137, -3442, -3184, -3278, -3107, -2532, -2089, -2047, -2012, -1767, -1726, -2168, -2699, -2927, -3109, -3675, -4507, -5262, -6059, -7229, -8557, -9489, -10022, -10649, -11466, -12067, -12327, -12582, -12934, -12973, -12410, -11495, -10677, -10079, -9565, -9076, -8713, -8536, -8527, -8791, -9524, -10668, -11844, -12780, -13596, -14429, -15073, -15324, -15358, -15438, -15480, -15304, -14968, -14605, -14242, -13985, -13995, -14165, -14198, -14049, -13916, -13845, -13727, -13603, -13620, -13738, -13765, -13598, -13365, -13275, -13360, -13375, -13162, -12989, -13198, -13591, -13744, -13751, -13953, -14177, -14013, -13666, -13600, -13612, -13069, -11944, -10825, -9949, -8978, -7753, -6664, -6081, -5845, -5616, -5398, -5387, -5576, -5828, -6150, -6574, -6896, -6882, -6655, -6505, -6366, -5847, -4854, -3795, -3042, -2564, -2183, -1748, -1105, -355, 9, -275, -749, -875, -824, -1042, -1402, -1449, -1287, -1419, -1783, -1766, -1365, -1344, -1882, -2210, -2071, -2232, -2990, -3568, -3593, -3786, -4516, -5012, -4662, -4042, -3950, -4234, -4238, -3882, -3608, -3577, -3618, -3766, -4190, -4614, -4579, -4275, -4366, -4886, -5074, -4574, -4100, -4390, -4991, -4828, -3789, -2951, -3005, -3213, -2483, -974, 189, 535, 691, 1244, 1995, 2473, 2541, 2399, 2420, 2895, 3636, 4107, 4172, 4292, 4868, 5827, 6848, 7562, 7716, 7559, 7701, 8239, 8582, 8419, 8160, 8198, 8446, 8730, 8953, 8964, 8813, 8844, 9133, 9294, 9174, 9056, 9010, 8812, 8532, 8381, 8131, 7487, 6791, 6559, 6575, 6221, 5495, 5023, 5043, 5059, 4599, 3940, 3719, 4061, 4428, 4317, 3777, 3176, 2759, 2619, 2745, 2861, 2545, 1776, 1046, 683, 491, 298, 309, 611, 869, 846, 802, 1045, 1482, 1839, 2051, 2202, 2282, 2220, 2132, 2265, 2641, 2923, 2836, 2588, 2649, 3143, 3647, 3726, 3504, 3482, 3804, 4041, 3875, 3585, 3562, 3712, 3773, 3801, 3960, 4127, 4141, 4171, 4440, 4836, 5051, 4972, 4754, 4611, 4613, 4620, 4431, 4019, 3578, 3310, 3249, 3246, 3097, 2742, 2397, 2331, 2452, 2371, 1919, 1324, 839, 524, 355, 219, -100, -608, -975, -1016, -1018, -1268, -1619, -1779, -1706, -1539, -1403, -1453, -1796, -2204, -2248, -1940, -1900, -2469, -3065, -3017, -2659, -2799, -3343, -3412, -2745, -2022, -1675, -1320, -702, -306, -458, -544, 65, 790, 511, -662, -1371, -991, -513, -754, -885, 62, 1311, 1646, 1665, 2783, 4661, 5632, 5257, 4629, 4417, 4206, 3617, 2828, 2016, 1201, 704, 1019, 2007, 2733, 2596, 2340, 3195, 4968, 6035, 5627, 4962, 5258, 5848, 5463, 4347, 3637, 3465, 3088, 2446, 2151, 2213, 1971, 1349, 1102, 1553, 1976, 1778, 1506, 1965, 2792, 2823, 1700, 166, -1248, -2774, -4407, -5478, -5818, -6308, -7415, -7933, -6180, -1917, 3575, 8970, 13741, 17873, 21377, 24205, 26220, 27166, 26787, 25090, 22408, 19225, 16082, 13602, 12263, 11976, 12187, 12602, 13574, 15460, 17818, 19818, 21171, 22190, 23020, 23481, 23686, 24090, 24762, 25129, 24759, 23970, 23336, 22876, 22162, 21015, 19705, 18417, 16985, 15323, 13730, 12448, 11250, 9870, 8508, 7365, 6070, 4239, 2302, 961, 296, -2, 26, 517, 1424, 2773, 4673, 6749, 8145, 8516, 8434, 8374, 7812, 5940, 2950, -162, -2843, -5175, -7052, -8157, -8703, -9220, -9620, -9320, -8274, -7086, -6086, -5048, -3919, -3128, -2867, -2665, -2131, -1576, -1419, -1532, -1681, -2043, -2743, -3422, -3787, -4080, -4574, -5014, -5013, -4717, -4653, -5033, -5526, -5764, -5805, -5953, -6286, -6644, -6931, -7168, -7204, -6743, -5763, -4627, -3668, -2941, -2422, -2124, -2006, -2059, -2491, -3507, -4936, -6348, -7518, -8536, -9547, -10570, -11504, -12180, -12420, -12229, -11852, -11602, -11520, -11322, -10730, -9801, -8869, -8195, -7769, -7450, -7195, -7094, -7231, -7605, -8133, -8711, -9317, -10022, -10816, -11505, -11917, -12121, -12283, -12416, -12476, -12519, -12623, -12779, -12993, -13268, -13471, -13451, -13330, -13395, -13665, -13852, -13778, -13603, -13527, -13458, -13271, -13113, -13259, -13645, -13909, -13935, -14071, -14609, -15308, -15748, -15973, -16344, -16882, -17223, -17192, -16960, -16612, -16028, -15224, -14413, -13684, -12901, -11917, -10806, -9875, -9418, -9337, -9227, -8911, -8666, -8747, -9059, -9452, -9826, -9917, -9508, -8888, -8533, -8386, -7999, -7249, -6370, -5490, -4604, -3824, -3264, -2853, -2489, -2170, -1910, -1708, -1669, -1937, -2414, -2745, -2726, -2577, -2628, -2882, -3113, -3203, -3116, -2843, -2607, -2796, -3373, -3798, -3796, -3704, -3886, -4279, -4674, -4970, -5011, -4668, -4197, -4107, -4468, -4746, -4605, -4449, -4755, -5224, -5166, -4668, -4640, -5459, -6267, -6158, -5490, -5212, -5370, -5265, -4713, -4079, -3401, -2496, -1634, -1135, -706, -3, 596, 580, 269, 414, 1046, 1424, 1126, 610, 547, 1042, 1785, 2566, 3260, 3659, 3772, 4093, 5105, 6550, 7573, 7700, 7420, 7562, 8225, 8702, 8504, 8003, 7778, 7779, 7615, 7294, 7141, 7173, 7080, 6723, 6312, 6091, 6093, 6196, 6213, 5994, 5580, 5246, 5222, 5416, 5577, 5607, 5547, 5392, 5255, 5484, 6174, 6699, 6300, 5200, 4496, 4693, 4968, 4428, 3420, 2789, 2477, 1940, 1375, 1389, 1800, 1910, 1695, 1762, 2333, 3014, 3495, 3840, 4138, 4322, 4413, 4557, 4723, 4714, 4516, 4276, 3958, 3505, 3207, 3281, 3290, 2677, 1738, 1272, 1383, 1373, 857, 287, 197, 462, 674, 838, 1233, 1839, 2369, 2759, 3203, 3752, 4215, 4488, 4677, 4858, 4938, 4806, 4465, 3950, 3307, 2694, 2235, 1783, 1136, 447, 7, -229, -475, -614, -436, -142, -100, -219, -40, 584, 1291, 1685, 1739, 1698, 1753, 1934, 2195, 2450, 2492, 2110, 1429, 918, 776, 640, 161, -483, -1020, -1530, -2080, -2409, -2424, -2486, -2799, -3018, -2814, -2361, -1943, -1508, -899, -234, 255, 609, 1102, 1806, 2353, 2347, 1921, 1595, 1572, 1482, 946, 67, -748, -1163, -1061, -688, -614, -1108, -1589, -1254, -210, 594, 581, 221, 361, 1138, 1780, 1680, 1499, 2412, 4127, 4841, 3815, 2733, 3399, 5098, 5605, 4272, 2651, 2165, 2491, 2668, 2711, 3247, 4154, 4617, 4398, 4194, 4663, 5502, 5703, 4749, 3492, 3319, 4359, 5399, 5802, 6225, 7100, 7903, 8334, 8787, 9220, 8963, 7951, 6901, 6067, 4931, 3331, 1955, 1393, 1315, 1000, 348, -93, 32, 474, 768, 784, 847, 1366, 2211, 2682, 2482, 2336, 2927, 3726, 3795, 3191, 2585, 2025, 1077, -169, -1156, -1654, -1767, -1287, 232, 2759, 5628, 8303, 10905, 13694, 16411, 18416, 19308, 19182, 18459, 17621, 16942, 16423, 16063, 15959, 16125, 16422, 16880, 17797, 19189, 20392, 20696, 20268, 19937, 20026, 20098, 19970, 20038, 20321, 20123, 19167, 18199, 17949, 18091, 17792, 16844, 15798, 15178, 15003, 14936, 14584, 13790, 12909, 12556, 12695, 12470, 11315, 9776, 8531, 7400, 6010, 4770, 4296, 4307, 3975, 3207, 2806, 3296, 4122, 4325, 3702, 2868, 2209, 1396, 146, -1139, -2002, -2702, -3712, -4732, -4993, -4376, -3643, -3550, -4088, -4613, -4543, -3951, -3481, -3609, -4100, -4403, -4427, -4559, -4936, -5183, -5130, -5263, -5988, -6793, -6816, -6129, -5703, -6010, -6348, -5930, -5047, -4613, -4869, -5246, -5381, -5577, -6092, -6607, -6698, -6494, -6497, -6880, -7197, -6925, -6187, -5646, -5675, -5983, -6220, -6519, -7088, -7656, -7863, -8011, -8750, -9931, -10524, -10039, -9326, -9388, -9954, -10039, -9564, -9383, -9813, -10101, -9726, -9305, -9555, -10080, -10043, -9557, -9428, -9829, -10121, -9992, -9912, -10293, -10822, -10947, -10692, -10598, -10892, -11133, -10901, -10510, -10629, -11304, -11834, -11738, -11417, -11580, -12263, -12825, -12872, -12726, -12850, -13144, -13166, -12888, -12780, -13087, -13458, -13504, -13412, -13633, -14153, -14502, -14445, -14278, -14392, -14783, -15100, -15120, -14990, -14964, -15015, -14888, -14531, -14231, -14198, -14209, -13889, -13223, -12601, -12323, -12239, -11943, -11310, -10626, -10197, -9984, -9732, -9386, -9083, -8837, -8497, -8066, -7769, -7756, -7873, -7759, -7209, -6452, -5951, -5754, -5352, -4471, -3621, -3339, -3272, -2699, -1798, -1529, -2140, -2645, -2266, -1607, -1645, -2210, -2412, -2128, -1983, -2125, -2054, -1615, -1329, -1654, -2386, -2944, -3021, -2879, -3026, -3618, -4212, -4262, -3849, -3672, -4109, -4649, -4657, -4352, -4413, -4861, -5082, -4866, -4696, -4915, -5189, -5049, -4570, -4218, -4211, -4337, -4346, -4251, -4147, -3985, -3668, -3223, -2752, -2285, -1797, -1325, -954, -647, -256, 180, 340, 115, -47, 258, 689, 705, 582, 1090, 2206, 3031, 3122, 3098, 3553, 4118, 4176, 3964, 4116, 4491, 4403, 3850, 3591, 3975, 4496, 4601, 4321, 4071, 4164, 4503, 4664, 4374, 3914, 3791, 4060, 4291, 4231, 4110, 4125, 4049, 3760, 3682, 4062, 4313, 3843, 3126, 3037, 3517, 3806, 3660, 3524, 3648, 3786, 3740, 3647, 3641, 3638, 3537, 3326, 2929, 2375, 2080, 2406, 2987, 3123, 2846, 2842, 3318, 3727, 3723, 3599, 3587, 3409, 2921, 2641, 3021, 3619, 3653, 3169, 2927, 3284, 3844, 4107, 3984, 3715, 3605, 3738, 3844, 3675, 3414, 3402, 3550, 3452, 3083, 2898, 3115, 3339, 3215, 3026, 3168, 3421, 3346, 3055, 2963, 3008, 2812, 2442, 2367, 2712, 3039, 2981, 2699, 2575, 2670, 2717, 2562, 2375, 2435, 2793, 3157, 3191, 3025, 3198, 3864, 4449, 4459, 4162, 4035, 4033, 3872, 3571, 3282, 2983, 2651, 2428, 2389, 2423, 2439, 2452, 2419, 2259, 2068, 2102, 2391, 2544, 2143, 1351, 853, 1017, 1395, 1401, 1220, 1422, 1905, 2029, 1740, 1692, 2146, 2552, 2399, 1866, 1454, 1403, 1589, 1797, 2017, 2412, 2933, 3250, 3233, 3113, 2985, 2690, 2368, 2453, 2810, 2660, 1795, 1155, 1556, 2429, 2672, 2361, 2551, 3473, 4129, 3948, 3682, 4042, 4490, 4231, 3651, 3823, 4882, 5798, 5824, 5420, 5407, 5784, 5893, 5478, 5012, 4947, 5055, 4765, 4004, 3389, 3455, 3998, 4433, 4587, 4683, 4739, 4540, 4214, 4265, 4770, 5067, 4717, 4307, 4569, 5117, 4997, 4206, 3564, 3299, 2858, 1976, 976, 125, -511, -790, -660, -435, -421, -447, -105, 656, 1427, 1785, 1720, 1538, 1460, 1459, 1378, 1169, 946, 713, 129, -1037, -2216, -2541, -2116, -1837, -1842, -1246, 387, 2527, 4832, 7608, 10821, 13651, 15434, 16315, 16798, 17119, 17197, 16922, 16384, 15776, 15187, 14623, 14321, 14590, 15307, 15968, 16374, 16682, 16846, 16714, 16527, 16625, 16878, 17066, 17356, 17781, 17836, 17346, 16937, 17078, 17352, 17136, 16379, 15419, 14587, 14061, 13709, 13271, 12755, 12264, 11486, 10100, 8540, 7448, 6591, 5239, 3470, 2080, 1377, 939, 571, 649, 1356, 2216, 2673, 2797, 3015, 3335, 3254, 2534, 1562, 683, -348, -1753, -3038, -3591, -3668, -4002, -4715, -5358, -5747, -6087, -6456, -6736, -6912, -7067, -7203, -7275, -7244, -7074, -6782, -6449, -6078, -5618, -5228, -5271, -5805, -6265, -6078, -5494, -5293, -5634, -5882, -5756, -5823, -6434, -7015, -7030, -6954, -7562, -8658, -9311, -9130, -8653, -8384, -8116, -7498, -6724, -6244, -6071, -5824, -5382, -5084, -5279, -5904, -6626, -7158, -7448, -7684, -8124, -8736, -9162, -9239, -9302, -9634, -9925, -9781, -9456, -9503, -9809, -9686, -8970, -8359, -8401, -8659, -8437, -7901, -7826, -8352, -8758, -8594, -8327, -8607, -9237, -9486, -9143, -8804, -8957, -9312, -9355, -9216, -9467, -10188, -10791, -10869, -10753, -10951, -11413, -11655, -11479, -11210, -11193, -11329, -11316, -11175, -11270, -11786, -12408, -12703, -12666, -12664, -12884, -13121, -13193, -13292, -13641, -14053, -14222, -14258, -14505, -14874, -14873, -14345, -13712, -13383, -13193, -12694, -11784, -10866, -10394, -10351, -10309, -9942, -9413, -9116, -9186, -9314, -9075, -8385, -7675, -7443, -7565, -7408, -6766, -6132, -5770, -5366, -4828, -4520, -4345, -3714, -2680, -2003, -1877, -1699, -1198, -809, -792, -852, -740, -633, -757, -1059, -1307, -1349, -1191, -1000, -1016, -1354, -1799, -1938, -1647, -1359, -1607, -2320, -2900, -2986, -2783, -2560, -2322, -2168, -2367, -2807, -2987, -2847, -2911, -3392, -3807, -3789, -3673, -3987, -4700, -5198, -4993, -4386, -4205, -4653, -4957, -4606, -4239, -4506, -4787, -4114, -2836, -2220, -2591, -2935, -2430, -1520, -1157, -1513, -1910, -1856, -1609, -1638, -1903, -1946, -1544, -936, -526, -527, -735, -562, 358, 1482, 1841, 1372, 1083, 1623, 2482, 2947, 3043, 3128, 3206, 3117, 2965, 2962, 3081, 3162, 3183, 3194, 3115, 2846, 2570, 2621, 3030, 3426, 3493, 3298, 3106, 3046, 3090, 3248, 3551, 3873, 3973, 3818, 3715, 4017, 4707, 5294, 5287, 4880, 4797, 5195, 5305, 4699, 4151, 4408, 4863, 4520, 3673, 3428, 3962, 4388, 4236, 4045, 4291, 4593, 4416, 4004, 3979, 4363, 4599, 4432, 4188, 4153, 4201, 4168, 4175, 4318, 4405, 4255, 4008, 3842, 3689, 3441, 3192, 3054, 2967, 2833, 2636, 2412, 2267, 2300, 2392, 2319, 2117, 2037, 2095, 2090, 2020, 2073, 2184, 2062, 1731, 1627, 1937, 2240, 2113, 1760, 1625, 1661, 1492, 1137, 1018, 1250, 1482, 1545, 1697, 2065, 2330, 2302, 2377, 2904, 3458, 3331, 2610, 2071, 2069, 2160, 1935, 1659, 1777, 2178, 2397, 2379, 2567, 3135, 3600, 3519, 3186, 3123, 3236, 3104, 2874, 3053, 3512, 3535, 2996, 2656, 3049, 3687, 3790, 3365, 3080, 3214, 3269, 2837, 2439, 2804, 3610, 3870, 3516, 3436, 3867, 4106, 3956, 4061, 4568, 4782, 4335, 3659, 3276, 3352, 3727, 3936, 3686, 3347, 3301, 3155, 2556, 2146, 2508, 2867, 2168, 844, 208, 534, 885, 621, 121, -40, 110, 257, 469, 1102, 2037, 2587, 2440, 2223, 2637, 3499, 4173, 4533, 4814, 4932, 4661, 4137, 3722, 3703, 4288, 5282, 5765, 4956, 3453, 2720, 3250, 4073, 4167, 3635, 3253, 3336, 3408, 2964, 2345, 2387, 3255, 4235, 4813, 5160, 5348, 5101, 4637, 4755, 5622, 6322, 6015, 4854, 3515, 2437, 1832, 1814, 2071, 1924, 1239, 772, 1028, 1425, 1359, 1360, 2122, 3081, 3187, 2586, 2287, 2498, 2380, 1435, 142, -916, -1722, -2310, -2388, -1874, -1134, -231, 1387, 3923, 6587, 8570, 10053, 11644, 13196, 14038, 14076, 13859, 13571, 12857, 11871, 11513, 12120, 12680, 12132, 10945, 10596, 11675, 13233, 14139, 14487, 15150, 16283, 17124, 17359, 17673, 18492, 19153, 18990, 18272, 17471, 16521, 15437, 14701, 14444, 14112, 13443, 12945, 12899, 12685, 11770, 10684, 10164, 9811, 8770, 7237, 6080, 5337, 4453, 3681, 3780, 4516, 4848, 4595, 4723, 5736, 6849, 7142, 6626, 5701, 4511, 3427, 3074, 3142, 2463, 855, -521, -1145, -1758, -2659, -3138, -3048, -3295, -4305, -5338, -5642, -5331, -4909, -4585, -4341, -4275, -4520, -4888, -4957, -4704, -4691, -5287, -5982, -6071, -5713, -5651, -6057, -6400, -6428, -6506, -6905, -7418, -7884, -8504, -9383, -10160, -10415, -10238, -10087, -10085, -9803, -8935, -7839, -7085, -6640, -6067, -5366, -5013, -5165, -5464, -5679, -5974, -6475, -7063, -7651, -8282, -8844, -9098, -9114, -9321, -9861, -10301, -10282, -10011, -9743, -9343, -8785, -8403, -8254, -7945, -7411, -7083, -7066, -6961, -6668, -6593, -6852, -6975, -6652, -6200, -6061, -6200, -6319, -6425, -6765, -7339, -7815, -8111, -8571, -9375, -10126, -10433, -10543, -10812, -11018, -10876, -10742, -11012, -11327, -11251, -11127, -11459, -11991, -12180, -12080, -12131, -12448, -12835, -13206, -13606, -14016, -14366, -14708, -15157, -15675, -16058, -16189, -16209, -16268, -16270, -15994, -15448, -14922, -14644, -14521, -14230, -13637, -12946, -12505, -12395, -12319, -11889, -11063, -10212, -9731, -9641, -9625, -9359, -8799, -8218, -7977, -8147, -8352, -8111, -7384, -6642, -6329, -6297, -5966, -5085, -4170, -3913, -4285, -4507, -4027, -3291, -3195, -3825, -4220, -3690, -2834, -2630, -3036, -3317, -3288, -3328, -3550, -3793, -4085, -4411, -4475, -4200, -4002, -4133, -4227, -3959, -3645, -3739, -4069, -4162, -4050, -4131, -4354, -4325, -4126, -4205, -4412, -4059, -3119, -2524, -2907, -3683, -3886, -3434, -2991, -2916, -2965, -2862, -2545, -1954, -1112, -360, -3, 140, 409, 669, 552, 247, 393, 1043, 1392, 915, 197, 146, 858, 1752, 2387, 2676, 2649, 2493, 2585, 3112, 3789, 4165, 4153, 4051, 4105, 4276, 4432, 4553, 4668, 4738, 4710, 4552, 4267, 3921, 3710, 3793, 4035, 4101, 3879, 3651, 3696, 3923, 4064, 4090, 4164, 4273, 4242, 4104, 4154, 4556, 5107, 5527, 5812, 6138, 6549, 6918, 7191, 7436, 7646, 7682, 7516, 7291, 7036, 6602, 6071, 5820, 5949, 6009, 5685, 5301, 5300, 5611, 5892, 6089, 6363, 6695, 6880, 6842, 6762, 6850, 7089, 7265, 7213, 6949, 6586, 6218, 5931, 5781, 5693, 5442, 4889, 4185, 3648, 3406, 3275, 3041, 2720, 2464, 2296, 2107, 1920, 1970, 2383, 2932, 3243, 3224, 3121, 3169, 3345, 3499, 3547, 3477, 3282, 3003, 2757, 2628, 2549, 2357, 2012, 1640, 1358, 1113, 804, 491, 355, 436, 578, 650, 707, 858, 1121, 1429, 1698, 1862, 1921, 1968, 2078, 2194, 2199, 2116, 2114, 2285, 2462, 2363, 1946, 1521, 1382, 1421, 1263, 759, 142, -282, -395, -256, -68, -68, -256, -318, 21, 639, 1200, 1547, 1730, 1762, 1645, 1596, 1849, 2199, 2162, 1714, 1400, 1520, 1688, 1547, 1413, 1719, 2158, 2107, 1723, 1805, 2469, 2861, 2506, 2114, 2483, 3290, 3673, 3529, 3464, 3738, 3951, 3842, 3773, 4129, 4579, 4484, 3918, 3670, 4050, 4411, 4194, 3720, 3451, 3244, 2860, 2473, 2202, 1821, 1288, 914, 795, 737, 801, 1242, 1793, 1802, 1397, 1628, 2863, 3909, 3642, 2631, 2039, 1839, 1418, 994, 1002, 858, -116, -1097, -719, 653, 1300, 875, 923, 2119, 2974, 2372, 1530, 1982, 3097, 3333, 2795, 2849, 3880, 4914, 5245, 5214, 5315, 5489, 5614, 5937, 6479, 6578, 5797, 4870, 4835, 5417, 5489, 4991, 4856, 4994, 4225, 2581, 1748, 2574, 3852, 4208, 3792, 3513, 3792, 4551, 5518, 6136, 5862, 4922, 4207, 4047, 3653, 2288, 456, -826, -1495, -2294, -3254, -3471, -2604, -1460, -484, 1116, 3840, 6757, 9050, 11241, 13713, 15472, 15706, 15197, 15004, 14998, 14554, 13605, 12385, 11047, 9944, 9578, 9974, 10539, 10755, 10775, 11144, 12087, 13209, 14007, 14488, 15014, 15647, 16005, 15806, 15293, 14964, 15044, 15245, 14952, 13865, 12527, 11843, 11883, 11796, 11082, 10169, 9467, 8673, 7435, 6002, 4788, 3785, 2754, 1659, 638, -189, -722, -775, -229, 681, 1399, 1611, 1690, 2203, 2979, 3181, 2374, 1010, -275, -1342, -2323, -3245, -4223, -5580, -7247, -8422, -8555, -8378, -8981, -10086, -10483, -10005, -9699, -9981, -10048, -9422, -8768, -8676, -8705, -8318, -7900, -8046, -8374, -8086, -7340, -7053, -7427, -7703, -7382, -6870, -6826, -7431, -8357, -9102, -9468, -9759, -10370, -11189, -11692, -11606, -11160, -10673, -10158, -9408, -8375, -7300, -6469, -5906, -5481, -5234, -5275, -5430, -5502, -5780, -6657, -7728, -8156, -7946, -7955, -8596, -9377, -9787, -9864, -9821, -9726, -9650, -9690, -9785, -9698, -9186, -8288, -7464, -7173, -7207, -6982, -6459, -6084, -5861, -5442, -5041, -5167, -5546, -5426, -4871, -4711, -5268, -6104, -6848, -7547, -8294, -9067, -9856, -10653, -11350, -11829, -12043, -12061, -12034, -12059, -12056, -11931, -11792, -11739, -11673, -11519, -11430, -11490, -11546, -11573, -11787, -12169, -12465, -12731, -13220, -13746, -13881, -13787, -14024, -14635, -15052, -14934, -14501, -14048, -13657, -13370, -13251, -13144, -12691, -11792, -10826, -10227, -9956, -9640, -9075, -8369, -7633, -6888, -6279, -6024, -6036, -5906, -5441, -4931, -4685, -4621, -4546, -4501, -4550, -4493, -4112, -3565, -3265, -3404, -3710, -3761, -3482, -3204, -3226, -3405, -3359, -2955, -2461, -2186, -2129, -2058, -1848, -1616, -1575, -1817, -2235, -2594, -2721, -2658, -2614, -2709, -2812, -2761, -2677, -2850, -3207, -3244, -2781, -2408, -2706, -3348, -3510, -2952, -2159, -1628, -1478, -1529, -1491, -1201, -834, -655, -571, -221, 452, 1062, 1301, 1358, 1632, 2215, 2855, 3262, 3229, 2705, 2002, 1690, 1932, 2203, 1995, 1522, 1337, 1521, 1698, 1762, 2069, 2820, 3606, 3828, 3448, 3030, 3091, 3584, 4017, 3974, 3489, 3013, 2971, 3384, 3902, 4165, 4087, 3897, 3891, 4063, 4064, 3691, 3214, 2994, 2953, 2769, 2440, 2270, 2352, 2430, 2358, 2362, 2657, 3109, 3461, 3724, 4084, 4562, 5062, 5621, 6281, 6788, 6764, 6296, 5986, 6245, 6711, 6639, 5852, 4978, 4667, 4867, 5074, 5048, 4910, 4757, 4600, 4601, 4924, 5374, 5546, 5352, 5097, 5021, 5033, 4952, 4819, 4833, 5034, 5219, 5210, 5130, 5264, 5638, 5863, 5554, 4851, 4314, 4210, 4147, 3655, 2868, 2292, 2073, 1916, 1646, 1440, 1420, 1364, 1061, 725, 775, 1222, 1572, 1480, 1241, 1337, 1735, 1988, 1919, 1774, 1714, 1609, 1392, 1217, 1175, 1108, 817, 321, -120, -239, -85, -31, -311, -667, -673, -286, 151, 332, 233, 44, 21, 277, 656, 892, 889, 782, 801, 1137, 1726, 2161, 2117, 1837, 1829, 2117, 2227, 1925, 1522, 1300, 1121, 827, 639, 777, 988, 939, 821, 1034, 1469, 1698, 1745, 2011, 2511, 2800, 2792, 2989, 3592, 4003, 3725, 3211, 3208, 3621, 3770, 3446, 3068, 2951, 3005, 3036, 2937, 2688, 2473, 2631, 3179, 3568, 3347, 2917, 3022, 3575, 3734, 3203, 2647, 2640, 2937, 3022, 2740, 2198, 1563, 1191, 1460, 2144, 2438, 1994, 1486, 1599, 1982, 1845, 1176, 552, 174, -126, -271, -59, 276, 390, 547, 1428, 3071, 4526, 4919, 4605, 4690, 5443, 5904, 5393, 4638, 4682, 5252, 5222, 4396, 3847, 4388, 5511, 6086, 5638, 4659, 3953, 3919, 4320, 4535, 4115, 3239, 2579, 2576, 2940, 2990, 2415, 1599, 1294, 1896, 2984, 3693, 3670, 3453, 3688, 4245, 4438, 3995, 3344, 2910, 2521, 1740, 470, -998, -2305, -3145, -3374, -3209, -3145, -3225, -2559, -194, 3510, 7110, 9913, 12583, 15625, 18354, 20000, 20749, 21020, 20707, 19676, 18176, 16478, 14846, 13800, 13662, 14003, 14102, 13800, 13475, 13498, 14008, 14837, 15514, 15602, 15135, 14558, 14290, 14433, 14818, 15125, 15111, 14802, 14477, 14326, 14222, 13935, 13464, 13002, 12510, 11675, 10385, 8959, 7753, 6709, 5469, 3829, 2026, 551, -350, -947, -1583, -2069, -1938, -1215, -436, 146, 868, 1946, 2960, 3332, 3093, 2698, 2281, 1532, 336, -929, -1856, -2456, -3019, -3757, -4606, -5267, -5484, -5375, -5346, -5625, -6150, -6796, -7403, -7735, -7712, -7649, -7883, -8274, -8358, -7964, -7360, -6777, -6138, -5361, -4634, -4143, -3816, -3589, -3644, -4139, -4945, -5879, -6937, -8118, -9259, -10189, -10883, -11384, -11741, -11957, -11927, -11528, -10859, -10229, -9791, -9343, -8669, -7931, -7462, -7264, -7058, -6823, -6827, -7060, -7198, -7165, -7224, -7450, -7638, -7750, -7962, -8322, -8717, -9113, -9517, -9857, -10080, -10214, -10229, -10041, -9677, -9285, -8907, -8420, -7798, -7239, -6845, -6397, -5763, -5214, -4980, -4820, -4514, -4345, -4646, -5254, -5919, -6706, -7688, -8691, -9657, -10744, -11903, -12796, -13300, -13663, -14068, -14329, -14265, -14032, -13855, -13675, -13305, -12848, -12539, -12360, -12114, -11805, -11612, -11632, -11800, -11964, -11960, -11818, -11816, -12127, -12546, -12783, -12941, -13302, -13813, -14125, -14140, -14129, -14223, -14146, -13684, -13087, -12700, -12385, -11727, -10711, -9784, -9170, -8565, -7697, -6790, -6141, -5606, -4902, -4135, -3623, -3395, -3245, -3081, -2980, -3042, -3342, -3833, -4345, -4786, -5270, -5827, -6213, -6234, -6063, -5967, -5821, -5279, -4392, -3662, -3324, -3043, -2549, -2067, -1860, -1780, -1629, -1509, -1571, -1789, -2087, -2359, -2472, -2483, -2705, -3251, -3794, -4050, -4210, -4568, -5006, -5161, -4988, -4836, -4944, -5090, -4894, -4368, -3898, -3660, -3361, -2733, -1981, -1463, -1159, -796, -306, 178, 652, 1188, 1627, 1658, 1299, 1023, 1195, 1551, 1484, 823, 117, 26, 583, 1185, 1302, 1079, 1094, 1598, 2251, 2687, 2918, 3097, 3218, 3339, 3655, 4146, 4501, 4580, 4628, 4891, 5283, 5570, 5671, 5634, 5495, 5277, 5049, 4866, 4661, 4321, 3865, 3447, 3157, 2952, 2826, 2896, 3201, 3521, 3601, 3534, 3691, 4238, 4890, 5270, 5350, 5423, 5704, 6102, 6393, 6499, 6490, 6394, 6184, 5959, 5896, 5944, 5828, 5422, 4939, 4604, 4372, 4100, 3792, 3489, 3095, 2529, 1990, 1767, 1857, 1982, 2006, 2045, 2160, 2280, 2439, 2772, 3205, 3466, 3439, 3321, 3321, 3395, 3333, 3012, 2505, 1990, 1587, 1290, 1016, 686, 289, -130, -513, -795, -908, -872, -844, -939, -1065, -1057, -866, -552, -181, 154, 358, 484, 727, 1159, 1585, 1798, 1855, 1949, 2072, 2075, 1973, 1921, 1876, 1650, 1292, 1044, 931, 759, 518, 444, 635, 920, 1115, 1233, 1377, 1604, 1928, 2343, 2740, 2968, 3059, 3275, 3776, 4369, 4722, 4779, 4819, 5158, 5746, 6114, 5880, 5317, 5071, 5251, 5258, 4705, 4024, 3771, 3739, 3348, 2692, 2454, 2769, 2958, 2639, 2303, 2425, 2711, 2762, 2861, 3411, 4078, 4197, 3855, 3845, 4485, 5122, 5093, 4630, 4395, 4507, 4517, 4205, 3987, 4384, 5179, 5437, 4679, 3740, 3781, 4583, 4758, 3716, 2442, 2027, 2265, 2253, 1790, 1523, 1892, 2546, 2928, 3024, 3241, 3741, 4257, 4495, 4473, 4381, 4239, 3895, 3441, 3286, 3550, 3713, 3329, 2785, 2776, 3292, 3769, 3980, 4142, 4257, 4003, 3328, 2686, 2518, 2735, 2829, 2457, 1865, 1591, 1889, 2626, 3587, 4482, 4902, 4785, 4600, 4553, 4231, 3546, 3070, 2803, 1887, 230, -958, -1054, -1016, -1735, -2648, -2777, -2162, -1516, -1112, -672, -17, 761, 1573, 2269, 2455, 1906, 989, 178, -615, -1705, -2940, -3899, -4321, -4005, -2697, -439, 2361, 5410, 8682, 11988, 14824, 16821, 18038, 18608, 18427, 17472, 16149, 14915, 13853, 13003, 12704, 13144, 13917, 14612, 15476, 16833, 18233, 18788, 18328, 17542, 16985, 16480, 15736, 14913, 14256, 13699, 13211, 13005, 13126, 13276, 13235, 13051, 12776, 12445, 12188, 11984, 11566, 10838, 10077, 9459, 8732, 7643, 6401, 5383, 4534, 3515, 2325, 1349, 813, 679, 993, 1694, 2278, 2419, 2625, 3438, 4361, 4440, 3592, 2519, 1630, 769, -289, -1509, -2649, -3420, -3720, -3756, -3772, -3757, -3594, -3404, -3462, -3814, -4245, -4698, -5400, -6393, -7272, -7672, -7717, -7650, -7375, -6716, -5857, -5160, -4697, -4270, -3786, -3442, -3553, -4214, -5156, -6012, -6659, -7256, -7929, -8622, -9215, -9608, -9734, -9614, -9396, -9231, -9136, -9015, -8755, -8326, -7852, -7549, -7445, -7324, -7083, -6897, -6864, -6808, -6625, -6530, -6689, -6914, -6955, -6867, -6891, -7091, -7347, -7565, -7749, -7897, -7977, -8028, -8129, -8247, -8250, -8085, -7814, -7493, -7152, -6820, -6452, -5938, -5296, -4753, -4488, -4385, -4186, -3867, -3716, -3994, -4606, -5245, -5815, -6540, -7534, -8524, -9198, -9686, -10374, -11271, -11927, -12056, -11965, -12115, -12442, -12550, -12373, -12274, -12424, -12534, -12363, -12130, -12161, -12326, -12230, -11844, -11619, -11829, -12166, -12179, -11971, -12075, -12706, -13423, -13687, -13541, -13492, -13784, -14083, -13979, -13524, -13057, -12665, -12120, -11360, -10700, -10365, -10086, -9403, -8345, -7424, -6916, -6509, -5816, -4970, -4412, -4197, -3899, -3294, -2827, -3067, -3830, -4325, -4218, -4120, -4678, -5600, -6072, -5935, -5813, -6052, -6178, -5775, -5240, -5125, -5165, -4743, -4012, -3733, -4029, -4119, -3554, -2958, -3055, -3545, -3642, -3337, -3331, -3878, -4477, -4743, -4932, -5388, -5987, -6399, -6568, -6691, -6862, -7001, -7067, -7084, -6989, -6683, -6208, -5754, -5461, -5238, -4773, -3850, -2765, -2106, -1937, -1652, -876, -57, 246, 199, 297, 562, 585, 257, -54, -73, 11, -114, -423, -625, -543, -268, -14, 75, 50, 125, 472, 994, 1446, 1730, 1967, 2264, 2570, 2832, 3140, 3546, 3884, 3973, 3884, 3863, 3974, 4047, 3919, 3599, 3172, 2746, 2469, 2429, 2460, 2248, 1749, 1337, 1355, 1705, 2033, 2183, 2296, 2569, 3037, 3564, 4014, 4449, 5000, 5555, 5827, 5804, 5847, 6193, 6638, 6798, 6545, 6106, 5855, 5974, 6224, 6165, 5691, 5122, 4743, 4499, 4233, 3988, 3892, 3872, 3716, 3392, 3138, 3179, 3429, 3595, 3546, 3450, 3534, 3791, 4003, 4037, 3995, 4012, 4027, 3899, 3664, 3434, 3161, 2730, 2220, 1808, 1478, 1086, 665, 390, 290, 210, 64, -28, 101, 448, 841, 1144, 1388, 1660, 1922, 2079, 2182, 2392, 2720, 2938, 2877, 2691, 2707, 3004, 3313, 3373, 3239, 3140, 3138, 3070, 2806, 2430, 2129, 1935, 1687, 1328, 1101, 1236, 1547, 1673, 1656, 1870, 2402, 2909, 3170, 3356, 3619, 3797, 3732, 3627, 3828, 4283, 4542, 4352, 4024, 4026, 4335, 4522, 4406, 4268, 4330, 4405, 4250, 3986, 3929, 4148, 4390, 4380, 4153, 4026, 4189, 4424, 4417, 4284, 4392, 4721, 4797, 4449, 4216, 4610, 5296, 5500, 5122, 4832, 5016, 5284, 5177, 4788, 4415, 4090, 3696, 3281, 3041, 3107, 3349, 3453, 3345, 3365, 3739, 4091, 3929, 3402, 3077, 3040, 2812, 2201, 1681, 1666, 1887, 1891, 1828, 2193, 2962, 3557, 3713, 3780, 4047, 4264, 4115, 3763, 3493, 3081, 2098, 855, 370, 1045, 1880, 1644, 602, 238, 1198, 2350, 2340, 1448, 1114, 1862, 2608, 2284, 1462, 1646, 3171, 4656, 4856, 4268, 4237, 5025, 5639, 5389, 4734, 4493, 4822, 5146, 4872, 4017, 3123, 2545, 2021, 1147, 60, -744, -1130, -1468, -2023, -2505, -2373, -1526, -497, 41, -39, -274, -196, 72, -56, -958, -2376, -3819, -5116, -6379, -7564, -8465, -9021, -9256, -8934, -7639, -5272, -2276, 753, 3498, 5958, 8173, 10020, 11319, 12042, 12238, 11908, 11214, 10669, 10714, 11149, 11424, 11493, 11833, 12702, 13766, 14579, 14978, 14976, 14624, 14147, 13906, 14002, 14128, 13986, 13673, 13439, 13329, 13315, 13436, 13592, 13502, 13158, 12943, 13094, 13367, 13399, 13110, 12639, 12082, 11433, 10620, 9530, 8144, 6687, 5444, 4341, 3061, 1754, 1097, 1321, 1770, 1871, 1911, 2346, 2957, 3209, 3003, 2645, 2357, 2116, 1763, 1181, 484, -3, -62, 189, 459, 601, 668, 673, 497, 68, -527, -1200, -1950, -2743, -3538, -4382, -5240, -5819, -5915, -5734, -5527, -5167, -4509, -3772, -3206, -2725, -2209, -1801, -1663, -1736, -1925, -2246, -2678, -3120, -3557, -4079, -4672, -5131, -5320, -5377, -5508, -5710, -5854, -5921, -5948, -5918, -5850, -5838, -5888, -5885, -5824, -5829, -5894, -5852, -5633, -5361, -5140, -4923, -4703, -4602, -4675, -4765, -4724, -4668, -4797, -5081, -5332, -5499, -5678, -5849, -5874, -5745, -5602, -5467, -5170, -4662, -4121, -3631, -3047, -2371, -1878, -1670, -1468, -1106, -872, -1069, -1560, -2019, -2433, -3056, -3943, -4818, -5462, -6002, -6686, -7522, -8304, -8886, -9339, -9796, -10268, -10636, -10853, -11068, -11412, -11774, -11932, -11894, -11872, -11966, -12056, -12029, -11948, -11894, -11847, -11847, -12050, -12441, -12702, -12631, -12511, -12734, -13187, -13418, -13297, -13142, -13166, -13183, -12962, -12585, -12275, -12018, -11618, -10998, -10308, -9698, -9165, -8570, -7750, -6750, -5873, -5357, -5049, -4652, -4173, -3837, -3711, -3714, -3878, -4311, -4929, -5446, -5681, -5770, -6050, -6602, -7032, -6956, -6614, -6559, -6774, -6709, -6242, -5943, -6137, -6350, -6085, -5610, -5519, -5799, -5873, -5520, -5180, -5271, -5626, -5849, -5863, -5908, -6193, -6659, -7019, -7097, -7092, -7317, -7660, -7757, -7590, -7452, -7416, -7325, -7165, -6973, -6660, -6219, -5824, -5451, -4827, -3951, -3182, -2729, -2425, -2076, -1663, -1290, -1127, -1265, -1494, -1449, -1119, -907, -1082, -1414, -1498, -1249, -895, -656, -625, -821, -1048, -936, -414, 14, -39, -219, 63, 686, 1025, 957, 1031, 1605, 2322, 2668, 2624, 2526, 2551, 2658, 2790, 2831, 2584, 2048, 1566, 1422, 1490, 1497, 1448, 1490, 1511, 1331, 1185, 1505, 2186, 2682, 2828, 2916, 3036, 3092, 3399, 4392, 5768, 6646, 6606, 6089, 5867, 6394, 7464, 8299, 8183, 7233, 6329, 6136, 6401, 6432, 6036, 5591, 5351, 5183, 4972, 4767, 4566, 4378, 4368, 4546, 4585, 4338, 4169, 4375, 4688, 4747, 4722, 4986, 5410, 5483, 5089, 4711, 4724, 4877, 4724, 4274, 3887, 3738, 3647, 3434, 3233, 3339, 3734, 3933, 3526, 2824, 2593, 3070, 3636, 3656, 3288, 3154, 3456, 3854, 4128, 4449, 4884, 5128, 4982, 4662, 4432, 4281, 4100, 3931, 3815, 3642, 3316, 2945, 2763, 2874, 3100, 3158, 2957, 2662, 2449, 2315, 2183, 2097, 2144, 2250, 2220, 2049, 2011, 2328, 2826, 3113, 3082, 3006, 3073, 3070, 2796, 2510, 2557, 2735, 2534, 1974, 1677, 1943, 2297, 2228, 1956, 1978, 2176, 2002, 1423, 1023, 1100, 1291, 1194, 898, 709, 742, 939, 1234, 1537, 1697, 1628, 1448, 1430, 1700, 2053, 2193, 2138, 2192, 2506, 2887, 3118, 3257, 3470, 3724, 3833, 3744, 3614, 3587, 3630, 3612, 3510, 3403, 3313, 3203, 3178, 3390, 3661, 3584, 3134, 2796, 2867, 3016, 2833, 2423, 2145, 2094, 2133, 2205, 2310, 2323, 2132, 1905, 1937, 2175, 2175, 1683, 1026, 710, 771, 759, 364, -184, -430, -298, -190, -384, -645, -625, -423, -367, -519, -679, -730, -668, -498, -330, -351, -473, -304, 301, 925, 1056, 713, 400, 474, 735, 740, 384, -30, -282, -470, -647, -621, -366, -212, -315, -315, 89, 580, 690, 570, 772, 1359, 1743, 1516, 1082, 1121, 1677, 2150, 2182, 2111, 2397, 2943, 3300, 3345, 3355, 3465, 3441, 3118, 2740, 2568, 2436, 2056, 1562, 1317, 1317, 1244, 1070, 1153, 1615, 2072, 2214, 2275, 2555, 2890, 3024, 3054, 2989, 2457, 1438, 680, 624, 581, -206, -1236, -1396, -641, -105, -524, -1329, -1582, -1150, -611, -458, -814, -1483, -2096, -2574, -3358, -4720, -6111, -6859, -7176, -7657, -8060, -7416, -5281, -2170, 1288, 4986, 8863, 12440, 15186, 17058, 18242, 18615, 17967, 16601, 15211, 14075, 13001, 12115, 11902, 12163, 12035, 11509, 11730, 13125, 14451, 14488, 13549, 12632, 12131, 11972, 12172, 12621, 12877, 12676, 12264, 11935, 11639, 11382, 11511, 12109, 12518, 12161, 11420, 11028, 11012, 10867, 10322, 9280, 7595, 5425, 3420, 1934, 467, -1487, -3387, -4266, -4158, -3889, -3537, -2427, -690, 590, 1030, 1426, 2301, 3105, 3250, 2944, 2610, 2184, 1472, 719, 338, 331, 458, 639, 735, 382, -431, -1161, -1508, -1848, -2530, -3467, -4565, -5787, -6796, -7288, -7459, -7526, -7228, -6396, -5468, -4802, -4030, -2696, -1159, -244, -222, -567, -751, -850, -1266, -2196, -3508, -4894, -5978, -6557, -6807, -7042, -7374, -7719, -7997, -8088, -7936, -7780, -7916, -8190, -8192, -7928, -7788, -7840, -7688, -7083, -6245, -5465, -4740, -3980, -3305, -2863, -2601, -2431, -2443, -2664, -2903, -3121, -3574, -4322, -4980, -5270, -5422, -5795, -6399, -6969, -7257, -7181, -6877, -6575, -6332, -5967, -5335, -4526, -3748, -3167, -2852, -2738, -2701, -2738, -2975, -3466, -4065, -4620, -5154, -5758, -6424, -7072, -7683, -8285, -8875, -9433, -9974, -10509, -10954, -11234, -11432, -11704, -12026, -12222, -12206, -12077, -11933, -11754, -11478, -11123, -10740, -10334, -9924, -9573, -9294, -9013, -8734, -8571, -8540, -8522, -8481, -8519, -8622, -8676, -8696, -8796, -8929, -8927, -8768, -8566, -8380, -8182, -7917, -7471, -6720, -5738, -4858, -4322, -3964, -3398, -2538, -1767, -1506, -1727, -2046, -2241, -2446, -2864, -3447, -3984, -4387, -4736, -5101, -5453, -5737, -5936, -6037, -6050, -6056, -6192, -6510, -6862, -6984, -6860, -6809, -7062, -7351, -7263, -6872, -6621, -6652, -6673, -6490, -6263, -6170, -6155, -6147, -6229, -6456, -6662, -6655, -6517, -6532, -6759, -6899, -6797, -6734, -6918, -6969, -6484, -5829, -5635, -5701, -5216, -4028, -2889, -2367, -2178, -1773, -1119, -616, -504, -589, -545, -311, -81, 24, 77, 149, 257, 470, 864, 1279, 1372, 1074, 787, 906, 1251, 1274, 824, 357, 305, 520, 612, 619, 924, 1549, 2065, 2278, 2508, 2974, 3408, 3592, 3755, 4046, 4099, 3595, 2926, 2727, 2956, 2974, 2517, 1979, 1668, 1382, 982, 817, 1129, 1491, 1320, 743, 459, 821, 1480, 1955, 2139, 2128, 1955, 1747, 1885, 2622, 3652, 4348, 4464, 4423, 4839, 5873, 7102, 8013, 8480, 8760, 9052, 9215, 9036, 8667, 8503, 8572, 8431, 7822, 7105, 6842, 7160, 7726, 8169, 8350, 8363, 8446, 8799, 9284, 9443, 9027, 8383, 7997, 7805, 7379, 6695, 6191, 6077, 6050, 5764, 5295, 4993, 5050, 5255, 5208, 4765, 4199, 3854, 3754, 3648, 3352, 2906, 2447, 2088, 1897, 1858, 1802, 1547, 1164, 950, 1046, 1248, 1328, 1369, 1556, 1808, 1876, 1796, 1904, 2293, 2585, 2440, 2029, 1749, 1727, 1823, 1938, 2031, 2041, 1971, 1984, 2223, 2606, 2864, 2838, 2678, 2664, 2792, 2748, 2425, 2184, 2322, 2572, 2512, 2255, 2282, 2672, 2969, 2883, 2703, 2792, 3037, 3083, 2910, 2782, 2769, 2677, 2443, 2234, 2121, 1935, 1547, 1110, 879, 872, 810, 500, 132, 16, 137, 232, 210, 172, 125, 69, 186, 559, 879, 870, 752, 899, 1254, 1460, 1427, 1400, 1565, 1826, 1979, 1965, 1902, 1929, 2030, 2034, 1784, 1372, 1084, 1036, 980, 664, 236, 35, 104, 189, 135, 51, 119, 324, 401, 140, -211, -149, 348, 681, 448, -15, -222, -188, -211, -383, -629, -953, -1355, -1665, -1721, -1643, -1706, -1993, -2298, -2421, -2367, -2280, -2332, -2576, -2781, -2639, -2259, -2096, -2260, -2353, -2109, -1679, -1251, -900, -761, -824, -707, -143, 473, 549, 175, -11, 188, 278, -83, -537, -672, -696, -981, -1354, -1383, -1101, -905, -934, -989, -930, -809, -660, -471, -346, -461, -759, -882, -597, -178, -133, -496, -724, -394, 233, 553, 359, 20, 0, 342, 639, 465, -110, -512, -312, 224, 473, 255, 14, 155, 526, 712, 636, 605, 844, 1211, 1394, 1250, 906, 674, 849, 1408, 1904, 1873, 1463, 1345, 1810, 2355, 2424, 2108, 1750, 1324, 696, 120, -90, -172, -582, -1183, -1372, -1046, -788, -893, -891, -430, 46, -22, -485, -793, -761, -658, -801, -1321, -2127, -2967, -3652, -4251, -4919, -5555, -5743, -5144, -3832, -2162, -285, 2016, 4951, 8301, 11491, 13982, 15577, 16411, 16850, 17266, 17729, 17880, 17332, 16249, 15318, 15060, 15287, 15422, 15219, 14969, 14965, 15042, 14757, 14008, 13217, 12898, 13098, 13351, 13088, 12240, 11530, 11801, 12892, 13637, 13310, 12547, 12318, 12650, 12927, 12810, 12351, 11629, 10735, 9813, 8810, 7495, 5891, 4388, 3190, 1967, 399, -1173, -2143, -2420, -2368, -2204, -2028, -2035, -2100, -1704, -762, 72, 365, 383, 409, 388, 381, 588, 869, 931, 836, 758, 555, 64, -467, -721, -862, -1380, -2459, -3751, -4784, -5404, -5787, -6188, -6697, -7117, -7085, -6514, -5731, -4982, -4126, -3116, -2294, -1833, -1402, -804, -424, -631, -1213, -1751, -2164, -2627, -3242, -3944, -4569, -4993, -5282, -5651, -6199, -6767, -7159, -7356, -7483, -7617, -7746, -7824, -7817, -7669, -7334, -6859, -6348, -5851, -5358, -4878, -4424, -3964, -3500, -3131, -2948, -2924, -2981, -3074, -3206, -3393, -3666, -4032, -4449, -4886, -5338, -5746, -5988, -6048, -6088, -6245, -6402, -6294, -5844, -5255, -4761, -4381, -4019, -3638, -3258, -2956, -2875, -3082, -3433, -3755, -4100, -4636, -5344, -6008, -6516, -6977, -7547, -8222, -8847, -9286, -9578, -9888, -10324, -10783, -11072, -11144, -11169, -11245, -11203, -10872, -10406, -10086, -9896, -9578, -9062, -8567, -8270, -8097, -7888, -7622, -7407, -7304, -7253, -7162, -7041, -6996, -7085, -7208, -7179, -6974, -6824, -6931, -7179, -7223, -6895, -6347, -5835, -5467, -5168, -4766, -4136, -3323, -2488, -1775, -1266, -992, -898, -857, -819, -879, -1118, -1478, -1881, -2319, -2747, -3028, -3106, -3134, -3288, -3525, -3685, -3778, -3933, -4130, -4233, -4293, -4488, -4774, -4898, -4806, -4714, -4734, -4701, -4506, -4326, -4345, -4439, -4381, -4233, -4215, -4339, -4431, -4448, -4494, -4584, -4641, -4702, -4879, -5131, -5264, -5192, -5046, -4942, -4806, -4514, -4095, -3658, -3230, -2780, -2311, -1871, -1517, -1288, -1132, -917, -605, -331, -213, -170, -32, 245, 559, 781, 854, 806, 732, 748, 861, 921, 750, 370, 34, -33, 80, 110, 11, 12, 245, 536, 721, 906, 1222, 1546, 1669, 1628, 1635, 1746, 1791, 1649, 1410, 1212, 1040, 787, 427, 54, -202, -312, -400, -604, -830, -813, -503, -196, -109, -71, 182, 604, 926, 1043, 1128, 1371, 1763, 2160, 2493, 2808, 3112, 3351, 3567, 3906, 4316, 4485, 4278, 3978, 3873, 3864, 3707, 3436, 3235, 3093, 2904, 2757, 2854, 3164, 3408, 3436, 3421, 3563, 3831, 4105, 4390, 4707, 4931, 4913, 4754, 4756, 5060, 5449, 5543, 5215, 4706, 4338, 4209, 4235, 4296, 4248, 3958, 3530, 3286, 3372, 3539, 3490, 3242, 2997, 2836, 2709, 2621, 2655, 2838, 3097, 3359, 3626, 3938, 4306, 4706, 5068, 5292, 5315, 5185, 5028, 4901, 4760, 4598, 4493, 4470, 4407, 4211, 4025, 4059, 4269, 4367, 4194, 3916, 3774, 3782, 3752, 3569, 3357, 3311, 3453, 3621, 3699, 3750, 3878, 4069, 4232, 4339, 4441, 4568, 4672, 4690, 4602, 4431, 4265, 4222, 4283, 4214, 3881, 3553, 3569, 3784, 3754, 3436, 3250, 3391, 3547, 3426, 3207, 3253, 3530, 3610, 3241, 2735, 2583, 2760, 2773, 2404, 2025, 1997, 2174, 2222, 2145, 2173, 2329, 2431, 2417, 2374, 2291, 2073, 1799, 1624, 1437, 1019, 526, 360, 519, 532, 181, -170, -136, 157, 319, 229, 120, 160, 197, 17, -262, -305, -50, 140, -32, -394, -529, -303, 34, 207, 204, 186, 260, 396, 508, 535, 466, 335, 190, 46, -101, -231, -338, -434, -486, -436, -367, -413, -470, -309, -22, 16, -268, -513, -450, -245, -171, -262, -399, -501, -536, -463, -323, -256, -325, -413, -423, -446, -576, -689, -641, -542, -615, -868, -1103, -1197, -1232, -1358, -1577, -1713, -1709, -1809, -2186, -2508, -2338, -1882, -1772, -2133, -2424, -2293, -2017, -2001, -2243, -2494, -2652, -2793, -2966, -3091, -3066, -2881, -2663, -2596, -2705, -2738, -2494, -2228, -2324, -2667, -2782, -2590, -2442, -2451, -2344, -1978, -1526, -1150, -870, -688, -577, -429, -279, -435, -1009, -1428, -1078, -394, -466, -1318, -1678, -847, 277, 632, 407, 438, 908, 1282, 1153, 770, 756, 1373, 2106, 2243, 1848, 1770, 2542, 3637, 4129, 3879, 3582, 3672, 3738, 3233, 2299, 1545, 1298, 1294, 994, 201, -551, -554, 19, 192, -494, -1397, -1747, -1513, -1089, -767, -681, -772, -749, -517, -497, -1102, -2064, -2795, -3302, -4253, -5970, -7754, -8447, -7519, -5389, -2844, -442, 1671, 3692, 5982, 8608, 11010, 12338, 12305, 11516, 10818, 10554, 10575, 10769, 11197, 11791, 12331, 12771, 13301, 13905, 14257, 14204, 13940, 13539, 12796, 11844, 11372, 11787, 12570, 12873, 12524, 12076, 12018, 12269, 12487, 12533, 12511, 12505, 12493, 12436, 12386, 12465, 12729, 12940, 12649, 11570, 9860, 7951, 6239, 4920, 3935, 3018, 1950, 931, 482, 808, 1396, 1629, 1582, 1716, 1974, 1880, 1402, 980, 762, 546, 372, 485, 778, 892, 824, 894, 1058, 827, 23, -844, -1282, -1496, -2031, -2965, -3907, -4599, -5115, -5596, -6046, -6367, -6484, -6483, -6548, -6660, -6546, -6039, -5322, -4632, -3986, -3348, -2886, -2831, -3158, -3586, -3894, -4125, -4435, -4906, -5478, -5981, -6217, -6180, -6095, -6120, -6116, -5962, -5890, -6215, -6836, -7316, -7417, -7335, -7389, -7588, -7624, -7249, -6588, -6010, -5697, -5453, -5029, -4530, -4302, -4386, -4386, -4034, -3601, -3469, -3579, -3606, -3517, -3537, -3708, -3848, -3943, -4208, -4630, -4830, -4585, -4162, -3894, -3734, -3466, -3096, -2741, -2409, -2137, -2104, -2375, -2717, -2869, -2886, -3015, -3319, -3634, -3854, -4088, -4468, -4962, -5445, -5844, -6183, -6602, -7212, -7922, -8470, -8744, -8917, -9181, -9509, -9786, -9998, -10191, -10345, -10400, -10377, -10382, -10449, -10404, -10078, -9640, -9456, -9474, -9210, -8568, -8087, -8046, -8020, -7680, -7362, -7401, -7521, -7373, -7124, -7104, -7200, -7087, -6759, -6485, -6347, -6185, -5937, -5610, -5062, -4235, -3485, -3168, -3110, -2930, -2562, -2130, -1720, -1555, -1838, -2306, -2485, -2367, -2255, -2149, -1888, -1682, -1840, -2180, -2242, -1973, -1781, -1975, -2422, -2770, -2862, -2849, -2982, -3334, -3724, -3888, -3774, -3617, -3653, -3840, -3999, -4043, -3934, -3660, -3385, -3343, -3449, -3405, -3240, -3299, -3646, -3961, -4055, -4077, -4148, -4187, -4112, -3957, -3740, -3428, -3096, -2907, -2879, -2839, -2704, -2624, -2719, -2830, -2733, -2458, -2210, -2072, -1937, -1647, -1156, -613, -268, -231, -304, -164, 262, 712, 878, 753, 599, 604, 653, 568, 463, 569, 790, 782, 511, 362, 600, 1063, 1476, 1746, 1874, 1864, 1826, 1965, 2300, 2560, 2468, 2073, 1696, 1593, 1760, 2009, 2133, 2051, 1913, 1972, 2272, 2597, 2748, 2697, 2527, 2370, 2346, 2403, 2355, 2223, 2269, 2565, 2793, 2723, 2610, 2832, 3294, 3561, 3499, 3390, 3369, 3257, 3035, 3003, 3229, 3328, 3013, 2516, 2257, 2370, 2623, 2642, 2287, 1871, 1817, 2086, 2263, 2195, 2165, 2375, 2653, 2766, 2734, 2717, 2790, 2927, 3065, 3105, 2958, 2678, 2499, 2591, 2806, 2811, 2553, 2363, 2485, 2700, 2656, 2400, 2266, 2329, 2339, 2240, 2312, 2641, 2820, 2541, 2164, 2291, 2861, 3197, 2916, 2368, 2018, 1835, 1633, 1567, 1761, 1787, 1248, 631, 752, 1541, 2233, 2505, 2586, 2541, 2302, 2121, 2277, 2610, 2811, 2876, 2936, 3015, 3133, 3393, 3828, 4364, 4883, 5197, 5136, 4790, 4517, 4591, 4925, 5191, 5136, 4853, 4710, 4906, 5170, 5240, 5342, 5702, 5941, 5675, 5330, 5524, 6052, 6317, 6371, 6642, 7024, 7046, 6741, 6617, 6811, 6900, 6584, 6056, 5537, 4957, 4339, 4043, 4239, 4511, 4373, 3919, 3591, 3505, 3414, 3214, 3068, 2996, 2774, 2350, 2014, 2003, 2223, 2457, 2594, 2601, 2518, 2455, 2445, 2372, 2182, 1955, 1725, 1437, 1132, 941, 847, 708, 517, 451, 586, 751, 743, 602, 556, 724, 960, 1071, 1083, 1165, 1328, 1435, 1479, 1619, 1867, 1991, 1835, 1522, 1285, 1232, 1292, 1289, 1128, 944, 945, 1096, 1172, 1114, 1081, 1146, 1181, 1055, 746, 305, -140, -405, -426, -391, -527, -780, -887, -750, -583, -585, -674, -700, -732, -931, -1246, -1413, -1301, -1063, -965, -1095, -1297, -1352, -1202, -1022, -1054, -1344, -1668, -1779, -1689, -1602, -1607, -1573, -1391, -1171, -1099, -1182, -1248, -1196, -1138, -1240, -1498, -1723, -1752, -1623, -1533, -1595, -1681, -1594, -1352, -1167, -1159, -1240, -1299, -1335, -1392, -1469, -1559, -1688, -1884, -2096, -2196, -2113, -1991, -2078, -2372, -2564, -2448, -2199, -2105, -2201, -2309, -2300, -2172, -1981, -1829, -1802, -1871, -1881, -1780, -1729, -1859, -2012, -1934, -1670, -1461, -1340, -1144, -834, -519, -289, -204, -275, -336, -218, -95, -269, -642, -841, -786, -723, -742, -693, -536, -451, -554, -734, -791, -666, -475, -408, -563, -813, -864, -583, -234, -166, -344, -453, -373, -222, -67, 53, 3, -224, -360, -246, -136, -299, -581, -653, -525, -504, -703, -907, -948, -899, -822, -654, -442, -364, -446, -514, -442, -205, 171, 487, 414, -51, -452, -458, -315, -476, -989, -1532, -1881, -2049, -2080, -1960, -1788, -1716, -1711, -1666, -1672, -1830, -1932, -1785, -1657, -1892, -2324, -2519, -2430, -2376, -2561, -2919, -3272, -3490, -3624, -3831, -4039, -3879, -3138, -2105, -1183, -371, 661, 2081, 3666, 5025, 5951, 6571, 7115, 7622, 7933, 7996, 8063, 8407, 8906, 9135, 8949, 8711, 8793, 9110, 9345, 9392, 9328, 9268, 9376, 9734, 10150, 10395, 10585, 10944, 11367, 11590, 11631, 11680, 11756, 11753, 11703, 11712, 11761, 11739, 11620, 11483, 11353, 11161, 10813, 10241, 9428, 8480, 7600, 6868, 6131, 5295, 4514, 3925, 3424, 2954, 2707, 2802, 3004, 3022, 2876, 2755, 2692, 2627, 2644, 2827, 2958, 2715, 2178, 1766, 1660, 1668, 1600, 1343, 774, 13, -522, -719, -1005, -1657, -2354, -2761, -3043, -3460, -3905, -4175, -4352, -4579, -4724, -4637, -4506, -4521, -4413, -3913, -3369, -3209, -3165, -2821, -2436, -2431, -2607, -2636, -2712, -3088, -3564, -3927, -4305, -4759, -5074, -5195, -5421, -5891, -6290, -6314, -6145, -6078, -6017, -5795, -5612, -5612, -5469, -5018, -4680, -4690, -4648, -4291, -3980, -3949, -3931, -3782, -3734, -3854, -3945, -3980, -4083, -4197, -4195, -4191, -4358, -4578, -4582, -4399, -4335, -4477, -4574, -4479, -4347, -4259, -4113, -3933, -3839, -3691, -3314, -2913, -2758, -2705, -2541, -2440, -2596, -2809, -2850, -2860, -3067, -3446, -3838, -4142, -4330, -4474, -4727, -5102, -5421, -5576, -5703, -5961, -6283, -6503, -6606, -6728, -6910, -7035, -7034, -7023, -7134, -7305, -7352, -7234, -7093, -7077, -7162, -7212, -7157, -7038, -6918, -6825, -6764, -6744, -6747, -6749, -6761, -6820, -6922, -6996, -7003, -7020, -7136, -7271, -7227, -6951, -6635, -6465, -6344, -6007, -5386, -4748, -4328, -4034, -3677, -3324, -3125, -3001, -2831, -2732, -2779, -2756, -2534, -2356, -2406, -2467, -2322, -2090, -1952, -1880, -1817, -1811, -1873, -1923, -1925, -1921, -1909, -1848, -1802, -1881, -2003, -1933, -1663, -1492, -1552, -1577, -1358, -1115, -1113, -1218, -1135, -903, -827, -1034, -1317, -1448, -1446, -1487, -1665, -1928, -2148, -2211, -2105, -1963, -1953, -2058, -2071, -1864, -1578, -1445, -1474, -1475, -1350, -1201, -1137, -1116, -1027, -835, -590, -368, -202, -52, 141, 370, 554, 675, 810, 1019, 1236, 1338, 1300, 1220, 1190, 1182, 1114, 1012, 984, 1047, 1098, 1118, 1224, 1445, 1641, 1742, 1849, 2017, 2140, 2150, 2142, 2194, 2254, 2268, 2278, 2296, 2227, 2058, 1984, 2124, 2263, 2139, 1864, 1735, 1793, 1855, 1835, 1747, 1590, 1419, 1336, 1310, 1219, 1107, 1135, 1275, 1323, 1235, 1224, 1447, 1778, 1977, 1973, 1880, 1834, 1913, 2107, 2291, 2296, 2125, 1986, 2013, 2094, 2056, 1913, 1793, 1739, 1691, 1616, 1568, 1588, 1610, 1528, 1367, 1315, 1469, 1671, 1699, 1564, 1471, 1525, 1622, 1617, 1499, 1371, 1326, 1349, 1342, 1278, 1240, 1292, 1354, 1323, 1248, 1259, 1372, 1440, 1343, 1122, 904, 755, 659, 605, 600, 610, 560, 451, 404, 521, 752, 925, 962, 970, 1079, 1269, 1424, 1529, 1671, 1872, 2036, 2108, 2160, 2276, 2434, 2569, 2662, 2714, 2708, 2680, 2739, 2927, 3108, 3130, 3055, 3081, 3238, 3340, 3252, 3073, 3003, 3088, 3193, 3195, 3141, 3163, 3289, 3404, 3431, 3444, 3552, 3738, 3887, 3940, 3935, 3941, 3969, 3993, 3981, 3933, 3864, 3803, 3762, 3729, 3690, 3659, 3647, 3609, 3504, 3353, 3224, 3130, 3009, 2820, 2608, 2467, 2436, 2474, 2518, 2537, 2556, 2613, 2715, 2795, 2778, 2676, 2575, 2515, 2440, 2296, 2122, 1995, 1918, 1821, 1676, 1539, 1471, 1444, 1374, 1208, 987, 807, 754, 803, 823, 713, 521, 405, 447, 584, 683, 672, 584, 476, 358, 228, 146, 169, 247, 236, 71, -123, -200, -184, -236, -427, -656, -818, -932, -1065, -1219, -1356, -1458, -1509, -1493, -1449, -1447, -1487, -1511, -1520, -1569, -1680, -1779, -1807, -1800, -1830, -1908, -1980, -2001, -1977, -1923, -1838, -1730, -1644, -1619, -1651, -1679, -1637, -1529, -1430, -1419, -1497, -1600, -1657, -1642, -1596, -1588, -1635, -1670, -1618, -1506, -1440, -1471, -1534, -1555, -1543, -1568, -1635, -1699, -1761, -1847, -1936, -1969, -1951, -1946, -1973, -1980, -1958, -1980, -2064, -2106, -2037, -1968, -2028, -2161, -2215, -2176, -2141, -2148, -2161, -2164, -2169, -2179, -2186, -2178, -2117, -2002, -1901, -1875, -1899, -1904, -1890, -1910, -1967, -2001, -1983, -1947, -1906, -1812, -1650, -1449, -1199, -889, -620, -481, -363, -120, 156, 268, 232, 232, 318, 389, 404, 404, 390, 325, 239, 219, 298, 400, 418, 324, 203, 155, 181, 183, 82, -84, -209, -258, -280, -282, -203, -56, 35, 17, -17, 22, 140, 286, 377, 307, 87, -81, -25, 174, 318, 360, 446, 686, 1004, 1218, 1279, 1369, 1665, 2047, 2212, 2121, 2077, 2300, 2672, 2964, 3109, 3203, 3359, 3636, 3980, 4277, 4522, 4821, 5208, 5570, 5835, 6088, 6428, 6805, 7079, 7201, 7260, 7358, 7502, 7625, 7677, 7679, 7697, 7787, 7938, 8097, 8256, 8454, 8685, 8877, 8992, 9076, 9170, 9255, 9289, 9259, 9174, 9084, 9040, 9010, 8932, 8808, 8731, 8718, 8697, 8620, 8534, 8482, 8441, 8378, 8291, 8178, 8017, 7807, 7573, 7357, 7156, 6945, 6719, 6517, 6379, 6281, 6176, 6052, 5939, 5841, 5715, 5529, 5306, 5086, 4842, 4515, 4112, 3703, 3339, 2987, 2612, 2233, 1890, 1593, 1319, 1038, 730, 404, 87, -201, -477, -754, -1025, -1274, -1503, -1721, -1950, -2196, -2443, -2663, -2858, -3069, -3319, -3583, -3812, -4030, -4289, -4598, -4905, -5179, -5468, -5801, -6143, -6441, -6698, -6947, -7192, -7418, -7613, -7754, -7832, -7855, -7845, -7824, -7791, -7736, -7647, -7534, -7442, -7394, -7381, -7375, -7364, -7362, -7375, -7388, -7381, -7358, -7299, -7191, -7067, -7009, -7022, -7015, -6949, -6885, -6854, -6810, -6759, -6761, -6795, -6764, -6661, -6561, -6485, -6384, -6263, -6183, -6134, -6037, -5874, -5732, -5658, -5594, -5494, -5412, -5402, -5430, -5469, -5549, -5668, -5749, -5773, -5821, -5926, -6018, -6038, -6035, -6056, -6054, -5967, -5841, -5749, -5661, -5506, -5321, -5205, -5152, -5073, -4946, -4839, -4780, -4714, -4630, -4578, -4550, -4450, -4269, -4126, -4056, -3930, -3703, -3518, -3443, -3350, -3165, -3017, -2997, -3034, -3048, -3069, -3134, -3191, -3189, -3138, -3074, -3006, -2924, -2825, -2723, -2628, -2519, -2380, -2248, -2165, -2109, -2023, -1923, -1873, -1871, -1846, -1774, -1714, -1718, -1781, -1865, -1925, -1938, -1932, -1963, -2047, -2134, -2184, -2206, -2225, -2237, -2237, -2246, -2290, -2351, -2379, -2361, -2314, -2241, -2137, -2038, -1980, -1945, -1881, -1780, -1688, -1641, -1630, -1626, -1610, -1594, -1597, -1600, -1574, -1527, -1492, -1464, -1408, -1324, -1241, -1161, -1070, -996, -948, -885, -794, -738, -752, -772, -740, -698, -703, -723, -677, -560, -445, -375, -308, -187, -14, 171, 322, 407, 436, 474, 561, 656, 693, 667, 607, 537, 473, 450, 497, 600, 719, 811, 860, 906, 1009, 1171, 1321, 1409, 1465, 1544, 1654, 1765, 1843, 1886, 1918, 1973, 2043, 2085, 2082, 2074, 2102, 2164, 2227, 2269, 2296, 2330, 2383, 2424, 2408, 2327, 2243, 2230, 2299, 2380, 2394, 2327, 2246, 2233, 2313, 2439, 2541, 2570, 2525, 2452, 2426, 2503, 2663, 2817, 2877, 2847, 2813, 2848, 2949, 3050, 3087, 3036, 2919, 2791, 2698, 2658, 2661, 2668, 2609, 2449, 2252, 2137, 2137, 2176, 2159, 2046, 1873, 1736, 1717, 1780, 1799, 1727, 1649, 1654, 1711, 1730, 1690, 1631, 1576, 1507, 1425, 1367, 1344, 1327, 1293, 1254, 1228, 1222, 1246, 1283, 1308, 1330, 1389, 1489, 1570, 1592, 1600, 1653, 1739, 1786, 1764, 1726, 1735, 1783, 1813, 1790, 1750, 1748, 1801, 1890, 1984, 2054, 2096, 2138, 2209, 2309, 2421, 2553, 2692, 2782, 2781, 2757, 2817, 2965, 3082, 3094, 3065, 3083, 3145, 3198, 3244, 3297, 3321, 3269, 3186, 3143, 3144, 3153, 3160, 3149, 3068, 2924, 2823, 2841, 2904, 2883, 2780, 2721, 2752, 2767, 2689, 2606, 2635, 2733, 2747, 2613, 2435, 2348, 2379, 2447, 2463, 2390, 2253, 2109, 2005, 1951, 1942, 1970, 1985, 1915, 1756, 1595, 1498, 1456, 1435, 1394, 1287, 1122, 1005, 983, 974, 899, 810, 773, 764, 752, 761, 790, 789, 750, 724, 724, 709, 666, 627, 589, 507, 358, 195, 68, -28, -108, -141, -118, -104, -165, -276, -372, -432, -471, -479, -448, -426, -477, -573, -621, -582, -518, -471, -408, -305, -228, -235, -279, -272, -209, -167, -181, -203, -190, -169, -185, -242, -322, -409, -485, -527, -544, -576, -635, -677, -673, -671, -718, -768, -739, -646, -589, -620, -681, -700, -679, -669, -696, -719, -692, -623, -580, -608, -681, -739, -760, -759, -776, -844, -955, -1053, -1116, -1174, -1229, -1230, -1190, -1197, -1254, -1275, -1232, -1183, -1133, -1030, -911, -866, -875, -833, -727, -650, -636, -629, -597, -590, -634, -666, -640, -605, -623, -669, -687, -704, -780, -883, -912, -871, -891, -1026, -1162, -1198, -1171, -1145, -1104, -1048, -1030, -1046, -1015, -913, -803, -718, -635, -556, -503, -459, -385, -309, -280, -276, -211, -89, -12, -14, -13, 27, 45, 45, 131, 308, 426, 410, 374, 429, 530, 595, 653, 758, 839, 785, 633, 538, 575, 687, 813, 915, 937, 861, 779, 776, 773, 610, 286, -14, -184, -327, -568, -862, -1106, -1308, -1505, -1648, -1681, -1631, -1543, -1410, -1237, -1087, -1000, -933, -824, -673, -544, -482, -501, -599, -763, -934, -1009, -944, -829, -771, -744, -647, -477, -315, -157, 75, 386, 673, 906, 1144, 1399, 1593, 1698, 1794, 1949, 2133, 2338, 2638, 3013, 3289, 3389, 3497, 3795, 4220, 4615, 4948, 5220, 5355, 5340, 5323, 5426, 5587, 5672, 5685, 5723, 5788, 5817, 5834, 5942, 6156, 6377, 6571, 6782, 7017, 7207, 7320, 7385, 7412, 7390, 7356, 7383, 7468, 7505, 7417, 7256, 7154, 7162, 7210, 7227, 7226, 7236, 7218, 7117, 6950, 6777, 6611, 6429, 6218, 5976, 5691, 5377, 5093, 4871, 4700, 4567, 4463, 4375, 4306, 4262, 4217, 4138, 4054, 4007, 3932, 3758, 3536, 3335, 3094, 2718, 2275, 1905, 1613, 1313, 976, 652, 353, 61, -211, -429, -612, -818, -1061, -1301, -1533, -1795, -2078, -2327, -2520, -2709, -2933, -3178, -3412, -3610, -3761, -3883, -4029, -4221, -4420, -4567, -4670, -4787, -4966, -5195, -5421, -5621, -5807, -5993, -6155, -6288, -6445, -6637, -6792, -6853, -6865, -6870, -6855, -6827, -6847, -6912, -6940, -6909, -6876, -6859, -6826, -6817, -6899, -7032, -7083, -7019, -6950, -6983, -7099, -7197, -7229, -7225, -7225, -7232, -7236, -7262, -7333, -7415, -7457, -7469, -7506, -7582, -7660, -7719, -7751, -7732, -7656, -7563, -7488, -7426, -7354, -7252, -7094, -6877, -6653, -6492, -6418, -6407, -6421, -6410, -6346, -6298, -6347, -6469, -6554, -6566, -6544, -6515, -6422, -6234, -6005, -5800, -5614, -5391, -5111, -4810, -4542, -4349, -4242, -4170, -4064, -3928, -3840, -3840, -3863, -3832, -3746, -3649, -3537, -3379, -3182, -2989, -2818, -2663, -2541, -2460, -2361, -2194, -2029, -1978, -2028, -2053, -1986, -1883, -1817, -1791, -1770, -1715, -1592, -1388, -1176, -1065, -1056, -1019, -897, -799, -843, -984, -1094, -1138, -1182, -1252, -1300, -1281, -1199, -1064, -888, -715, -567, -389, -135, 104, 205, 191, 182, 206, 201, 153, 107, 63, -15, -86, -63, 62, 199, 302, 433, 637, 850, 999, 1109, 1214, 1279, 1267, 1206, 1143, 1082, 1021, 978, 967, 984, 1038, 1165, 1392, 1674, 1929, 2112, 2243, 2355, 2456, 2522, 2518, 2425, 2267, 2099, 1966, 1877, 1833, 1839, 1896, 1974, 2058, 2191, 2416, 2680, 2883, 3010, 3111, 3185, 3191, 3147, 3097, 3013, 2876, 2732, 2630, 2559, 2527, 2580, 2706, 2817, 2884, 2980, 3152, 3329, 3398, 3339, 3215, 3086, 2962, 2837, 2695, 2507, 2278, 2096, 2057, 2150, 2291, 2450, 2677, 2973, 3221, 3327, 3355, 3415, 3503, 3517, 3400, 3167, 2854, 2526, 2266, 2104, 1999, 1906, 1832, 1795, 1803, 1854, 1936, 2017, 2060, 2043, 1971, 1871, 1772, 1680, 1568, 1433, 1286, 1137, 996, 903, 905, 991, 1096, 1170, 1216, 1250, 1269, 1274, 1280, 1271, 1201, 1039, 818, 596, 399, 246, 167, 153, 139, 99, 94, 188, 349, 506, 611, 651, 631, 589, 568, 560, 520, 422, 269, 91, -61, -147, -167, -156, -140, -131, -134, -127, -79, 2, 67, 90, 95, 84, 27, -70, -140, -143, -132, -166, -206, -192, -155, -152, -136, -38, 72, 90, 53, 75, 152, 197, 210, 253, 310, 311, 256, 230, 284, 365, 394, 348, 267, 194, 152, 133, 100, 34, -36, -74, -87, -108, -133, -128, -80, -3, 69, 95, 64, 30, 41, 69, 67, 37, -18, -115, -213, -246, -235, -262, -324, -336, -287, -254, -256, -231, -157, -91, -79, -103, -124, -125, -121, -139, -205, -321, -450, -529, -515, -440, -376, -355, -325, -229, -76, 82, 228, 378, 506, 549, 497, 442, 464, 525, 520, 428, 327, 286, 306, 365, 463, 594, 730, 849, 957, 1042, 1066, 1063, 1111, 1184, 1151, 1002, 892, 894, 926, 939, 997, 1107, 1207, 1338, 1581, 1885, 2099, 2189, 2245, 2327, 2420, 2497, 2539, 2515, 2391, 2200, 2023, 1926, 1888, 1836, 1743, 1665, 1662, 1720, 1801, 1914, 2066, 2208, 2261, 2240, 2231, 2293, 2384, 2422, 2378, 2286, 2200, 2132, 2095, 2140, 2295, 2473, 2545, 2515, 2504, 2572, 2654, 2682, 2637, 2504, 2279, 2023, 1810, 1644, 1487, 1318, 1146, 997, 915, 927, 997, 1046, 1040, 1009, 989, 968, 901, 753, 547, 337, 140, -78, -334, -603, -858, -1093, -1276, -1400, -1523, -1679, -1785, -1785, -1785, -1889, -2011, -2017, -1955, -1963, -2031, -2039, -1969, -1933, -1954, -1919, -1752, -1531, -1349, -1183, -983, -766, -547, -299, -34, 175, 301, 408, 547, 683, 790, 921, 1118, 1319, 1439, 1523, 1698, 1988, 2304, 2581, 2821, 3047, 3284, 3563, 3856, 4099, 4283, 4461, 4671, 4895, 5124, 5371, 5625, 5832, 5973, 6087, 6238, 6445, 6657, 6792, 6834, 6845, 6875, 6921, 6967, 7018, 7072, 7102, 7107, 7139, 7222, 7323, 7396, 7446, 7497, 7533, 7514, 7442, 7364, 7302, 7213, 7058, 6865, 6694, 6545, 6372, 6173, 5986, 5811, 5608, 5394, 5221, 5065, 4861, 4618, 4391, 4162, 3870, 3535, 3240, 3025, 2853, 2664, 2428, 2151, 1890, 1701, 1594, 1529, 1458, 1347, 1170, 931, 656, 381, 122, -132, -414, -748, -1125, -1505, -1860, -2182, -2461, -2711, -2978, -3279, -3560, -3759, -3895, -4040, -4222, -4415, -4609, -4799, -4971, -5111, -5238, -5393, -5593, -5816, -6018, -6158, -6245, -6332, -6470, -6652, -6835, -6980, -7081, -7165, -7275, -7441, -7639, -7808, -7908, -7961, -8010, -8054, -8068, -8063, -8069, -8077, -8032, -7934, -7837, -7781, -7756, -7720, -7670, -7630, -7607, -7596, -7596, -7607, -7623, -7634, -7641, -7646, -7631, -7595, -7560, -7540, -7522, -7477, -7395, -7295, -7214, -7175, -7155, -7108, -7022, -6911, -6784, -6659, -6561, -6484, -6367, -6192, -6013, -5861, -5697, -5503, -5330, -5183, -5015, -4821, -4665, -4582, -4534, -4485, -4437, -4387, -4323, -4259, -4223, -4210, -4172, -4088, -3989, -3905, -3816, -3692, -3553, -3442, -3348, -3217, -3032, -2835, -2675, -2550, -2427, -2298, -2167, -2044, -1935, -1840, -1745, -1630, -1504, -1402, -1333, -1258, -1149, -1037, -986, -1002, -1022, -981, -888, -806, -788, -829, -874, -860, -772, -657, -577, -544, -527, -482, -388, -264, -159, -98, -56, -3, 52, 70, 32, -27, -57, -51, -46, -70, -103, -109, -95, -100, -130, -136, -93, -39, -25, -61, -116, -156, -168, -165, -179, -220, -257, -274, -288, -307, -303, -251, -167, -88, -21, 46, 121, 190, 249, 301, 330, 323, 302, 307, 338, 352, 318, 240, 151, 90, 82, 100, 105, 104, 135, 203, 269, 315, 366, 449, 554, 647, 700, 701, 667, 644, 673, 748, 809, 824, 813, 825, 874, 950, 1035, 1094, 1107, 1094, 1097, 1126, 1170, 1220, 1251, 1231, 1167, 1119, 1129, 1175, 1214, 1242, 1281, 1331, 1390, 1488, 1650, 1843, 1996, 2087, 2163, 2268, 2382, 2473, 2542, 2609, 2678, 2721, 2705, 2639, 2586, 2602, 2661, 2682, 2630, 2551, 2504, 2509, 2539, 2570, 2592, 2608, 2619, 2619, 2597, 2557, 2522, 2512, 2502, 2446, 2354, 2301, 2331, 2411, 2472, 2483, 2448, 2406, 2407, 2456, 2505, 2507, 2474, 2448, 2447, 2458, 2474, 2487, 2493, 2505, 2526, 2551, 2557, 2543, 2538, 2578, 2672, 2798, 2938, 3073, 3187, 3272, 3334, 3392, 3465, 3576, 3720, 3836, 3871, 3862, 3882, 3948, 4018, 4059, 4068, 4036, 3959, 3864, 3811, 3810, 3809, 3748, 3631, 3513, 3446, 3428, 3414, 3355, 3247, 3150, 3120, 3162, 3226, 3278, 3303, 3296, 3258, 3205, 3151, 3093, 3017, 2906, 2742, 2505, 2222, 1961, 1774, 1633, 1474, 1294, 1134, 995, 837, 663, 520, 426, 331, 202, 44, -118, -268, -389, -478, -564, -675, -805, -916, -995, -1059, -1125, -1200, -1297, -1413, -1506, -1543, -1569, -1657, -1798, -1933, -2059, -2219, -2405, -2544, -2604, -2624, -2676, -2787, -2927, -3032, -3069, -3073, -3118, -3224, -3330, -3365, -3351, -3362, -3412, -3450, -3448, -3418, -3373, -3314, -3267, -3249, -3230, -3193, -3167, -3173, -3189, -3193, -3206, -3257, -3329, -3386, -3411, -3413, -3395, -3346, -3264, -3173, -3091, -2991, -2830, -2621, -2433, -2301, -2187, -2044, -1886, -1757, -1662, -1566, -1473, -1421, -1423, -1440, -1421, -1360, -1277, -1198, -1146, -1117, -1064, -961, -861, -812, -784, -723, -645, -569, -483, -393, -334, -279, -155, 22, 160, 235, 319, 452, 588, 676, 737, 806, 869, 889, 871, 861, 888, 935, 985, 1049, 1115, 1144, 1135, 1163, 1290, 1468, 1594, 1643, 1663, 1682, 1691, 1690, 1702, 1721, 1716, 1684, 1668, 1693, 1739, 1779, 1802, 1821, 1849, 1908, 1989, 2033, 2007, 1977, 2008, 2042, 1993, 1899, 1866, 1900, 1908, 1847, 1770, 1740, 1764, 1813, 1858, 1875, 1854, 1828, 1852, 1945, 2049, 2085, 2039, 1973, 1933, 1903, 1869, 1855, 1881, 1914, 1928, 1949, 1989, 2014, 1999, 1965, 1942, 1915, 1852, 1760, 1662, 1553, 1402, 1203, 982, 772, 605, 511, 459, 376, 250, 153, 124, 101, 39, -7, -8, -39, -181, -393, -583, -726, -879, -1082, -1314, -1534, -1726, -1873, -1964, -2018, -2083, -2189, -2275, -2267, -2181, -2111, -2105, -2127, -2141, -2153, -2162, -2147, -2123, -2123, -2149, -2179, -2209, -2240, -2243, -2193, -2106, -2022, -1962, -1919, -1844, -1694, -1479, -1283, -1171, -1110, -1012, -855, -696, -586, -510, -425, -313, -170, 18, 235, 418, 543, 654, 803, 988, 1181, 1364, 1522, 1667, 1824, 1987, 2108, 2174, 2249, 2397, 2580, 2717, 2798, 2898, 3044, 3184, 3288, 3412, 3596, 3787, 3928, 4032, 4141, 4252, 4346, 4429, 4507, 4570, 4620, 4671, 4740, 4820, 4896, 4963, 5017, 5055, 5075, 5091, 5118, 5151, 5171, 5158, 5109, 5041, 4979, 4932, 4887, 4840, 4814, 4820, 4823, 4775, 4699, 4655, 4662, 4648, 4558, 4429, 4334, 4266, 4151, 3967, 3771, 3608, 3461, 3283, 3083, 2897, 2739, 2592, 2445, 2296, 2139, 1975, 1830, 1709, 1584, 1425, 1237, 1053, 884, 714, 526, 314, 78, -182, -432, -645, -831, -1034, -1272, -1510, -1716, -1902, -2095, -2296, -2491, -2684, -2876, -3032, -3129, -3209, -3318, -3432, -3507, -3566, -3641, -3722, -3792, -3879, -3988, -4092, -4191, -4327, -4498, -4666, -4817, -4958, -5082, -5184, -5292, -5430, -5573, -5687, -5753, -5762, -5726, -5699, -5744, -5842, -5910, -5887, -5804, -5747, -5758, -5820, -5909, -6002, -6069, -6072, -6009, -5943, -5939, -5978, -5990, -5951, -5880, -5788, -5682, -5601, -5573, -5554, -5490, -5406, -5348, -5308, -5253, -5186, -5140, -5103, -5040, -4953, -4887, -4835, -4736, -4581, -4418, -4273, -4118, -3961, -3847, -3779, -3709, -3609, -3510, -3428, -3367, -3333, -3322, -3293, -3212, -3089, -2969, -2881, -2813, -2741, -2648, -2528, -2384, -2248, -2151, -2070, -1964, -1839, -1724, -1623, -1532, -1472, -1448, -1424, -1376, -1339, -1339, -1350, -1338, -1316, -1310, -1315, -1294, -1237, -1167, -1130, -1129, -1122, -1074, -994, -921, -859, -776, -660, -540, -447, -372, -296, -239, -225, -238, -229, -198, -174, -177, -193, -218, -260, -297, -284, -218, -160, -154, -165, -138, -76, -17, 43, 129, 215, 243, 209, 171, 168, 160, 112, 49, 11, -2, 0, 32, 84, 118, 136, 192, 302, 421, 506, 548, 554, 532, 518, 539, 565, 541, 472, 431, 451, 484, 501, 544, 630, 707, 750, 808, 914, 1024, 1097, 1139, 1161, 1153, 1144, 1165, 1197, 1185, 1125, 1068, 1056, 1062, 1042, 1007, 1016, 1104, 1218, 1275, 1250, 1203, 1214, 1300, 1400, 1428, 1361, 1242, 1141, 1095, 1095, 1114, 1119, 1087, 1016, 936, 885, 867, 854, 817, 750, 673, 624, 621, 641, 644, 615, 571, 532, 524, 570, 656, 710, 691, 646, 654, 712, 738, 705, 664, 632, 554, 422, 312, 262, 217, 155, 153, 233, 305, 307, 285, 294, 315, 327, 356, 412, 436, 383, 312, 314, 382, 440, 468, 513, 586, 646, 671, 688, 709, 712, 686, 663, 657, 647, 615, 573, 527, 453, 360, 291, 266, 256, 243, 245, 270, 293, 302, 322, 381, 470, 553, 610, 640, 657, 680, 729, 795, 849, 884, 935, 1017, 1086, 1097, 1066, 1048, 1071, 1111, 1121, 1083, 1012, 943, 885, 851, 871, 956, 1048, 1090, 1102, 1149, 1244, 1360, 1493, 1626, 1701, 1686, 1645, 1657, 1708, 1713, 1649, 1578, 1543, 1513, 1472, 1472, 1546, 1650, 1725, 1785, 1871, 1965, 2018, 2048, 2100, 2128, 2055, 1923, 1862, 1891, 1915, 1907, 1936, 2009, 2072, 2133, 2259, 2434, 2565, 2615, 2647, 2698, 2733, 2725, 2704, 2682, 2615, 2499, 2409, 2389, 2383, 2352, 2331, 2329, 2306, 2275, 2306, 2413, 2512, 2545, 2553, 2575, 2581, 2531, 2455, 2412, 2377, 2285, 2145, 2030, 1983, 1970, 1962, 1980, 2041, 2128, 2228, 2343, 2421, 2392, 2284, 2223, 2241, 2214, 2064, 1874, 1740, 1646, 1550, 1468, 1420, 1399, 1404, 1443, 1491, 1520, 1530, 1532, 1511, 1459, 1396, 1351, 1307, 1231, 1117, 1009, 955, 945, 922, 872, 846, 864, 861, 778, 648, 527, 404, 250, 99, 13, -21, -78, -179, -276, -326, -330, -278, -157, -46, -70, -224, -372, -434, -459, -498, -570, -719, -982, -1292, -1527, -1648, -1726, -1817, -1910, -1974, -2006, -2009, -1961, -1868, -1783, -1752, -1760, -1769, -1782, -1824, -1915, -2062, -2272, -2515, -2719, -2831, -2865, -2894, -2951, -2995, -2972, -2895, -2824, -2768, -2688, -2591, -2561, -2640, -2760, -2836, -2872, -2922, -3007, -3116, -3214, -3263, -3246, -3194, -3137, -3075, -3019, -2981, -2934, -2843, -2743, -2675, -2625, -2593, -2646, -2773, -2849, -2842, -2864, -2968, -3040, -3013, -2961, -2948, -2930, -2868, -2791, -2717, -2627, -2518, -2412, -2316, -2216, -2115, -2036, -1979, -1917, -1830, -1745, -1696, -1691, -1710, -1727, -1715, -1670, -1638, -1667, -1741, -1798, -1813, -1818, -1846, -1892, -1944, -2003, -2066, -2109, -2089, -1998, -1881, -1789, -1722, -1637, -1504, -1323, -1119, -932, -814, -778, -784, -802, -825, -822, -748, -663, -710, -924, -1135, -1179, -1087, -1030, -1092, -1201, -1252, -1223, -1163, -1099, -1015, -910, -817, -743, -660, -547, -445, -405, -422, -453, -463, -429, -350, -262, -208, -188, -166, -119, -48, 50, 171, 287, 364, 364, 269, 129, 49, 60, 62, -8, -71, -25, 92, 190, 281, 455, 724, 1000, 1193, 1303, 1403, 1539, 1662, 1677, 1565, 1418, 1337, 1327, 1303, 1205, 1065, 959, 920, 930, 978, 1077, 1228, 1391, 1525, 1622, 1671, 1660, 1626, 1663, 1772, 1830, 1747, 1609, 1562, 1636, 1740, 1798, 1816, 1849, 1958, 2175, 2440, 2610, 2606, 2554, 2628, 2811, 2907, 2826, 2680, 2594, 2554, 2487, 2408, 2383, 2417, 2468, 2515, 2553, 2559, 2555, 2617, 2755, 2847, 2792, 2644, 2510, 2413, 2305, 2182, 2047, 1869, 1629, 1383, 1199, 1061, 901, 726, 612, 570, 539, 498, 495, 551, 618, 658, 684, 722, 784, 863, 936, 963, 937, 893, 878, 899, 914, 874, 784, 703, 690, 752, 841, 908, 950, 1001, 1093, 1237, 1421, 1619, 1797, 1927, 2012, 2086, 2186, 2322, 2467, 2602, 2734, 2868, 2994, 3115, 3249, 3390, 3521, 3644, 3760, 3832, 3853, 3885, 3964, 4025, 3997, 3931, 3933, 4028, 4140, 4208, 4244, 4310, 4441, 4615, 4772, 4878, 4949, 5019, 5105, 5199, 5268, 5285, 5280, 5320, 5404, 5443, 5390, 5308, 5267, 5252, 5223, 5172, 5105, 5006, 4883, 4754, 4618, 4451, 4256, 4061, 3889, 3739, 3600, 3463, 3335, 3233, 3159, 3103, 3080, 3106, 3168, 3223, 3255, 3257, 3192, 3046, 2878, 2754, 2643, 2468, 2218, 1955, 1704, 1446, 1179, 944, 753, 560, 336, 108, -105, -323, -527, -669, -778, -939, -1152, -1328, -1423, -1485, -1552, -1620, -1698, -1796, -1882, -1911, -1909, -1951, -2084, -2296, -2536, -2766, -2983, -3196, -3405, -3624, -3875, -4152, -4392, -4545, -4628, -4690, -4736, -4737, -4700, -4657, -4603, -4509, -4394, -4321, -4298, -4256, -4167, -4098, -4095, -4105, -4085, -4083, -4134, -4174, -4147, -4098, -4102, -4155, -4217, -4293, -4410, -4543, -4634, -4669, -4700, -4771, -4867, -4944, -4967, -4935, -4872, -4817, -4752, -4627, -4445, -4283, -4175, -4077, -3944, -3789, -3642, -3533, -3489, -3491, -3484, -3443, -3407, -3392, -3371, -3360, -3382, -3408, -3386, -3348, -3349, -3368, -3359, -3341, -3357, -3374, -3332, -3254, -3205, -3185, -3117, -2965, -2778, -2611, -2458, -2303, -2179, -2108, -2042, -1935, -1827, -1804, -1874, -1958, -2004, -2035, -2069, -2070, -2019, -1972, -1987, -2031, -2022, -1945, -1876, -1860, -1856, -1808, -1721, -1648, -1613, -1600, -1583, -1544, -1482, -1421, -1402, -1434, -1465, -1452, -1415, -1418, -1456, -1495, -1523, -1540, -1528, -1506, -1538, -1628, -1684, -1651, -1592, -1571, -1571, -1557, -1530, -1491, -1423, -1335, -1263, -1228, -1211, -1183, -1130, -1071, -1047, -1065, -1091, -1084, -1044, -993, -944, -912, -907, -914, -900, -841, -741, -624, -531, -495, -508, -526, -528, -504, -425, -295, -207, -230, -296, -290, -203, -111, -46, 2, 31, 32, 30, 43, 72, 123, 188, 228, 232, 246, 315, 406, 456, 464, 464, 473, 472, 438, 380, 346, 375, 443, 480, 460, 429, 453, 546, 659, 727, 725, 712, 756, 830, 843, 783, 737, 751, 761, 712, 642, 620, 637, 633, 578, 514, 500, 531, 547, 498, 410, 346, 337, 352, 346, 314, 275, 243, 221, 219, 249, 292, 315, 310, 273, 207, 143, 117, 97, 14, -126, -241, -293, -337, -427, -544, -629, -669, -687, -693, -668, -595, -494, -416, -395, -411, -421, -405, -396, -427, -479, -517, -545, -597, -667, -704, -684, -614, -516, -422, -363, -326, -248, -107, 30, 95, 87, 57, 41, 34, 27, 16, 11, 18, 38, 74, 139, 250, 403, 569, 716, 830, 924, 1017, 1120, 1230, 1324, 1371, 1349, 1284, 1249, 1297, 1400, 1478, 1488, 1462, 1477, 1573, 1739, 1928, 2074, 2139, 2140, 2129, 2143, 2196, 2276, 2347, 2364, 2310, 2226, 2180, 2210, 2297, 2383, 2412, 2366, 2292, 2252, 2274, 2312, 2315, 2281, 2235, 2185, 2138, 2125, 2159, 2196, 2193, 2168, 2163, 2192, 2240, 2272, 2246, 2155, 2066, 2029, 2009, 1928, 1771, 1587, 1425, 1303, 1224, 1184, 1168, 1161, 1154, 1143, 1125, 1116, 1155, 1244, 1314, 1296, 1214, 1143, 1104, 1065, 1001, 922, 824, 705, 580, 469, 380, 315, 285, 288, 308, 323, 335, 366, 431, 511, 560, 553, 509, 473, 476, 513, 549, 541, 475, 383, 320, 309, 337, 376, 405, 414, 414, 430, 464, 495, 524, 565, 589, 560, 502, 482, 500, 495, 445, 390, 359, 341, 335, 363, 434, 520, 589, 645, 719, 827, 947, 1039, 1078, 1071, 1043, 1002, 939, 851, 756, 662, 549, 412, 291, 229, 233, 267, 294, 288, 257, 256, 337, 477, 598, 648, 646, 639, 653, 670, 669, 653, 647, 653, 647, 621, 598, 583, 545, 478, 424, 406, 386, 321, 232, 171, 148, 121, 80, 64, 112, 206, 307, 391, 458, 521, 601, 700, 794, 862, 905, 920, 901, 868, 842, 802, 710, 586, 480, 407, 347, 303, 268, 219, 158, 135, 175, 247, 307, 355, 415, 489, 548, 569, 571, 597, 651, 675, 624, 543, 511, 533, 533, 455, 327, 208, 106, -2, -114, -198, -253, -296, -328, -342, -344, -325, -259, -167, -108, -92, -58, 19, 109, 184, 241, 271, 268, 249, 230, 199, 154, 115, 79, 11, -100, -222, -322, -406, -485, -560, -634, -739, -888, -1044, -1156, -1225, -1286, -1356, -1431, -1506, -1555, -1546, -1494, -1464, -1495, -1564, -1627, -1658, -1650, -1630, -1643, -1689, -1726, -1728, -1720, -1726, -1736, -1751, -1774, -1796, -1808, -1822, -1829, -1799, -1746, -1722, -1732, -1733, -1718, -1727, -1763, -1771, -1727, -1670, -1642, -1624, -1578, -1509, -1457, -1429, -1377, -1266, -1132, -1046, -1030, -1036, -1007, -934, -851, -788, -757, -735, -689, -625, -584, -571, -526, -407, -265, -185, -162, -118, -15, 82, 122, 149, 225, 348, 481, 611, 735, 846, 958, 1092, 1223, 1320, 1392, 1472, 1534, 1532, 1491, 1493, 1567, 1645, 1648, 1592, 1555, 1581, 1652, 1727, 1785, 1828, 1860, 1902, 1966, 2063, 2181, 2274, 2296, 2261, 2229, 2220, 2202, 2157, 2123, 2125, 2115, 2054, 1983, 1975, 2033, 2075, 2048, 1967, 1858, 1738, 1633, 1564, 1502, 1412, 1324, 1272, 1231, 1179, 1152, 1177, 1202, 1183, 1142, 1104, 1063, 1011, 960, 890, 761, 594, 470, 433, 418, 363, 304, 286, 257, 151, 16, -52, -81, -177, -360, -537, -667, -801, -963, -1080, -1103, -1096, -1117, -1120, -1050, -947, -866, -787, -681, -584, -544, -547, -565, -601, -667, -748, -846, -991, -1168, -1287, -1303, -1293, -1337, -1392, -1395, -1386, -1404, -1396, -1336, -1292, -1314, -1353, -1377, -1425, -1493, -1514, -1474, -1447, -1488, -1544, -1549, -1512, -1492, -1498, -1480, -1418, -1372, -1415, -1522, -1600, -1617, -1617, -1647, -1704, -1778, -1850, -1892, -1883, -1843, -1803, -1764, -1731, -1739, -1804, -1884, -1930, -1944, -1957, -2005, -2094, -2177, -2179, -2075, -1922, -1794, -1711, -1645, -1572, -1479, -1370, -1270, -1228, -1268, -1344, -1406, -1479, -1593, -1677, -1677, -1677, -1773, -1889, -1890, -1782, -1651, -1500, -1310, -1148, -1081, -1062, -1016, -949, -910, -903, -904, -925, -993, -1081, -1110, -1036, -919, -851, -844, -834, -789, -750, -737, -731, -751, -843, -979, -1063, -1077, -1092, -1140, -1179, -1170, -1110, -985, -801, -601, -425, -258, -89, 40, 88, 61, 11, -4, 17, 29, -21, -120, -193, -192, -119, 12, 190, 404, 634, 855, 1017, 1088, 1114, 1183, 1306, 1390, 1350, 1207, 1042, 898, 783, 718, 726, 774, 809, 835, 887, 955, 1012, 1069, 1127, 1126, 1045, 962, 932, 894, 768, 594, 462, 386, 307, 222, 188, 226, 266, 235, 150, 80, 49, 24, -24, -104, -217, -364, -533, -683, -767, -775, -735, -674, -608, -548, -486, -395, -251, -97, -28, -81, -188, -255, -281, -340, -466, -625, -774, -903, -1003, -1049, -1036, -1015, -1024, -1044, -1036, -991, -932, -897, -911, -972, -1051, -1142, -1257, -1391, -1515, -1621, -1734, -1854, -1953, -2012, -2035, -2021, -1970, -1903, -1858, -1851, -1854, -1844, -1834, -1849, -1885, -1921, -1949, -1977, -2012, -2044, -2046, -1988, -1882, -1796, -1763, -1723, -1611, -1455, -1335, -1273, -1222, -1144, -1035, -905, -768, -662, -605, -550, -427, -258, -138, -99, -73, -17, 33, 44, 14, -51, -139, -201, -212, -218, -236, -208, -97, 47, 175, 313, 506, 727, 923, 1066, 1171, 1255, 1319, 1351, 1324, 1211, 1033, 875, 786, 727, 644, 552, 506, 520, 597, 742, 933, 1116, 1263, 1384, 1481, 1546, 1588, 1619, 1612, 1526, 1392, 1301, 1298, 1339, 1361, 1371, 1433, 1572, 1742, 1870, 1918, 1897, 1841, 1772, 1678, 1544, 1387, 1223, 1050, 875, 730, 641, 619, 684, 858, 1104, 1334, 1493, 1614, 1756, 1934, 2098, 2178, 2133, 1989, 1789, 1555, 1308, 1101, 961, 840, 692, 554, 503, 575, 747, 964, 1142, 1214, 1213, 1247, 1373, 1539, 1637, 1611, 1487, 1336, 1217, 1156, 1175, 1286, 1451, 1575, 1595, 1563, 1587, 1698, 1810, 1817, 1707, 1537, 1356, 1179, 1007, 855, 724, 613, 547, 570, 698, 887, 1071, 1213, 1319, 1421, 1541, 1660, 1717, 1659, 1511, 1359, 1256, 1173, 1066, 961, 918, 949, 1005, 1050, 1122, 1267, 1456, 1608, 1658, 1624, 1581, 1575, 1561, 1460, 1286, 1143, 1077, 1042, 1022, 1083, 1253, 1448, 1594, 1707, 1845, 2033, 2237, 2392, 2437, 2362, 2215, 2045, 1872, 1703, 1551, 1417, 1283, 1138, 991, 885, 873, 963, 1082, 1137, 1111, 1070, 1067, 1066, 992, 820, 598, 381, 195, 55, -20, -49, -85, -174, -292, -362, -330, -218, -116, -96, -147, -204, -233, -238, -241, -277, -376, -505, -581, -567, -521, -497, -481, -444, -399, -367, -338, -285, -202, -106, -37, -17, -18, 17, 103, 220, 350, 493, 628, 739, 846, 980, 1137, 1292, 1425, 1531, 1595, 1608, 1600, 1624, 1707, 1805, 1848, 1808, 1740, 1731, 1818, 1973, 2143, 2299, 2436, 2540, 2594, 2623, 2693, 2840, 3020, 3151, 3175, 3110, 3034, 3037, 3142, 3280, 3355, 3335, 3264, 3211, 3219, 3274, 3330, 3339, 3291, 3194, 3078, 2992, 2977, 3000, 2972, 2860, 2718, 2626, 2606, 2631, 2649, 2614, 2529, 2448, 2404, 2372, 2305, 2197, 2068, 1934, 1803, 1680, 1566, 1465, 1378, 1301, 1212, 1109, 1009, 925, 850, 754, 622, 464, 304, 149, -29, -253, -488, -680, -826, -968, -1113, -1238, -1333, -1389, -1396, -1367, -1348, -1357, -1366, -1372, -1409, -1490, -1594, -1715, -1855, -1992, -2110, -2240, -2412, -2602, -2753, -2850, -2910, -2958, -3011, -3071, -3125, -3146, -3126, -3090, -3070, -3077, -3112, -3175, -3246, -3268, -3233, -3203, -3213, -3216, -3160, -3070, -2990, -2919, -2846, -2782, -2734, -2697, -2693, -2746, -2841, -2929, -3006, -3111, -3254, -3377, -3449, -3508, -3585, -3637, -3619, -3567, -3528, -3474, -3368, -3222, -3079, -2972, -2933, -2973, -3036, -3035, -2947, -2844, -2809, -2863, -2958, -3023, -3009, -2931, -2842, -2804, -2830, -2881, -2914, -2913, -2890, -2868, -2875, -2914, -2956, -2973, -2981, -3003, -3026, -3006, -2936, -2858, -2787, -2697, -2575, -2466, -2396, -2318, -2184, -2024, -1894, -1813, -1771, -1775, -1802, -1805, -1784, -1782, -1819, -1876, -1947, -2029, -2081, -2062, -1983, -1907, -1869, -1844, -1800, -1731, -1655, -1584, -1525, -1476, -1411, -1312, -1207, -1122, -1032, -912, -814, -795, -813, -799, -772, -795, -869, -947, -1033, -1149, -1267, -1335, -1355, -1378, -1427, -1478, -1509, -1520, -1493, -1414, -1332, -1299, -1289, -1236, -1149, -1071, -993, -891, -805, -773, -762, -725, -665, -591, -513, -453, -450, -492, -533, -565, -631, -740, -842, -903, -966, -1076, -1185, -1242, -1280, -1344, -1403, -1404, -1357, -1298, -1232, -1159, -1074, -958, -823, -744, -742, -725, -628, -522, -530, -648, -783, -876, -951, -1039, -1137, -1236, -1340, -1448, -1540, -1606, -1645, -1654, -1637, -1626, -1628, -1593, -1462, -1257, -1051, -888, -763, -646, -495, -306, -134, -31, 29, 104, 209, 314, 408, 492, 555, 590, 612, 633, 648, 639, 605, 561, 537, 565, 648, 762, 873, 959, 1017, 1055, 1094, 1177, 1317, 1470, 1568, 1626, 1718, 1874, 2036, 2150, 2235, 2318, 2378, 2383, 2362, 2369, 2394, 2371, 2278, 2156, 2051, 1982, 1942, 1883, 1742, 1562, 1469, 1497, 1536, 1511, 1490, 1539, 1629, 1726, 1858, 2041, 2205, 2291, 2340, 2405, 2432, 2357, 2244, 2173, 2090, 1913, 1710, 1571, 1436, 1231, 1025, 909, 845, 764, 676, 614, 575, 582, 663, 767, 812, 801, 802, 842, 867, 852, 837, 829, 783, 719, 747, 863, 924, 872, 810, 781, 699, 559, 452, 396, 320, 227, 164, 103, 24, -13, 14, 16, -62, -134, -101, -6, 30, -14, -56, -44, -1, 41, 94, 144, 195, 284, 423, 549, 629, 722, 844, 918, 913, 909, 930, 914, 853, 799, 751, 666, 568, 515, 502, 497, 520, 604, 702, 747, 767, 860, 1038, 1203, 1306, 1399, 1513, 1585, 1561, 1493, 1446, 1401, 1299, 1142, 982, 858, 760, 680, 614, 563, 529, 528, 570, 633, 685, 724, 766, 806, 845, 889, 940, 990, 1051, 1145, 1251, 1317, 1330, 1342, 1383, 1392, 1319, 1221, 1173, 1131, 1015, 856, 723, 584, 403, 266, 260, 324, 345, 331, 348, 397, 431, 453, 508, 603, 690, 729, 732, 744, 786, 828, 841, 830, 847, 930, 1036, 1095, 1121, 1195, 1315, 1396, 1416, 1447, 1525, 1588, 1587, 1545, 1493, 1439, 1385, 1330, 1254, 1165, 1110, 1131, 1227, 1359, 1499, 1635, 1762, 1869, 1945, 1980, 1977, 1946, 1890, 1791, 1639, 1448, 1258, 1080, 912, 777, 715, 717, 730, 737, 765, 817, 852, 850, 851, 892, 947, 975, 979, 996, 1015, 1007, 976, 949, 930, 904, 879, 859, 808, 715, 621, 558, 490, 376, 233, 115, 45, 0, -37, -70, -118, -170, -153, -16, 176, 326, 430, 530, 612, 642, 645, 637, 589, 490, 363, 215, 30, -143, -243, -294, -387, -547, -707, -795, -812, -800, -785, -785, -808, -831, -821, -791, -787, -799, -773, -719, -705, -736, -760, -792, -904, -1085, -1226, -1258, -1230, -1234, -1286, -1325, -1285, -1178, -1084, -1066, -1101, -1097, -1009, -903, -866, -894, -906, -880, -861, -851, -788, -649, -492, -375, -274, -137, 32, 188, 312, 421, 513, 563, 562, 536, 509, 475, 421, 342, 256, 202, 205, 254, 327, 423, 537, 645, 719, 771, 819, 868, 918, 983, 1062, 1104, 1070, 1014, 1019, 1073, 1083, 1045, 1055, 1145, 1202, 1138, 1026, 985, 1019, 1025, 944, 838, 791, 807, 820, 793, 772, 805, 893, 1006, 1132, 1270, 1399, 1497, 1575, 1648, 1716, 1754, 1743, 1677, 1572, 1460, 1368, 1289, 1185, 1032, 870, 758, 709, 654, 525, 340, 192, 132, 119, 88, 29, -25, -64, -97, -126, -142, -144, -162, -211, -277, -339, -399, -466, -537, -612, -699, -797, -896, -988, -1081, -1187, -1307, -1420, -1478, -1459, -1419, -1424, -1464, -1473, -1422, -1339, -1253, -1189, -1190, -1273, -1401, -1509, -1571, -1592, -1585, -1578, -1606, -1670, -1709, -1651, -1509, -1358, -1255, -1206, -1204, -1237, -1272, -1300, -1352, -1443, -1541, -1635, -1763, -1906, -1976, -1936, -1863, -1836, -1842, -1835, -1814, -1806, -1808, -1814, -1860, -1984, -2131, -2220, -2245, -2270, -2319, -2354, -2351, -2316, -2247, -2140, -2034, -1990, -2012, -2034, -2001, -1939, -1911, -1936, -1979, -2009, -2014, -2008, -2014, -2042, -2064, -2054, -2027, -2003, -1981, -1981, -2036, -2130, -2200, -2231, -2278, -2370, -2461, -2517, -2584, -2699, -2786, -2748, -2626, -2533, -2457, -2297, -2054, -1843, -1709, -1594, -1493, -1458, -1505, -1609, -1760, -1940, -2098, -2211, -2310, -2418, -2498, -2504, -2426, -2289, -2139, -2013, -1923, -1843, -1751, -1666, -1616, -1581, -1521, -1472, -1504, -1585, -1600, -1545, -1539, -1629, -1727, -1773, -1799, -1827, -1846, -1871, -1935, -2008, -2032, -1994, -1929, -1900, -1959, -2078, -2143, -2097, -2020, -1985, -1953, -1871, -1752, -1624, -1475, -1318, -1199, -1122, -1051, -982, -944, -924, -888, -857, -892, -996, -1078, -1071, -1033, -1060, -1160, -1256, -1286, -1266, -1262, -1332, -1428, -1414, -1246, -1071, -1048, -1117, -1094, -923, -711, -561, -484, -430, -351, -247, -170, -138, -95, 0, 87, 79, 2, -27, 21, 58, 10, -58, -49, 38, 138, 230, 329, 432, 538, 675, 846, 995, 1080, 1139, 1230, 1354, 1474, 1574, 1666, 1746, 1776, 1747, 1699, 1679, 1676, 1646, 1576, 1511, 1507, 1574, 1665, 1734, 1783, 1853, 1968, 2119, 2279, 2422, 2512, 2511, 2431, 2354, 2339, 2334, 2265, 2174, 2134, 2128, 2085, 2035, 2056, 2136, 2193, 2207, 2211, 2207, 2148, 2025, 1879, 1728, 1550, 1331, 1104, 908, 742, 592, 458, 346, 259, 217, 249, 348, 462, 549, 609, 653, 671, 615, 455, 236, 52, -57, -158, -324, -521, -628, -590, -492, -434, -404, -318, -173, -47, 19, 64, 124, 182, 202, 169, 104, 57, 79, 174, 296, 399, 485, 587, 715, 838, 923, 957, 941, 879, 770, 614, 423, 233, 89, 0, -54, -74, -41, 22, 67, 96, 171, 304, 416, 446, 434, 470, 570, 665, 701, 707, 738, 796, 838, 852, 869, 899, 899, 832, 722, 623, 551, 493, 446, 435, 490, 615, 784, 960, 1117, 1254, 1378, 1488, 1577, 1651, 1730, 1824, 1928, 2033, 2143, 2269, 2406, 2536, 2641, 2705, 2718, 2683, 2598, 2452, 2241, 1995, 1766, 1589, 1473, 1393, 1316, 1247, 1249, 1353, 1494, 1587, 1641, 1733, 1888, 2040, 2130, 2166, 2198, 2249, 2295, 2305, 2286, 2250, 2164, 1986, 1748, 1548, 1418, 1293, 1122, 924, 744, 616, 564, 584, 623, 634, 632, 669, 764, 891, 1010, 1097, 1167, 1257, 1364, 1441, 1477, 1511, 1570, 1629, 1681, 1767, 1904, 2022, 2034, 1942, 1830, 1745, 1669, 1567, 1430, 1264, 1084, 947, 888, 871, 835, 784, 756, 744, 719, 673, 629, 598, 593, 614, 649, 690, 751, 815, 836, 806, 761, 719, 656, 573, 489, 387, 256, 152, 141, 194, 207, 146, 95, 151, 305, 449, 509, 534, 635, 823, 1004, 1120, 1223, 1364, 1502, 1570, 1570, 1550, 1523, 1455, 1338, 1205, 1086, 999, 978, 1028, 1074, 1035, 946, 912, 952, 963, 874, 729, 631, 621, 642, 613, 539, 526, 613, 703, 692, 626, 607, 649, 650, 532, 312, 73, -99, -190, -278, -448, -679, -864, -941, -947, -972, -1046, -1130, -1167, -1131, -1036, -927, -874, -923, -1066, -1246, -1389, -1449, -1454, -1495, -1633, -1820, -1956, -2008, -2009, -1998, -2002, -2045, -2125, -2204, -2256, -2277, -2266, -2235, -2221, -2241, -2227, -2092, -1851, -1638, -1561, -1571, -1526, -1369, -1188, -1105, -1131, -1168, -1134, -1041, -958, -936, -965, -997, -993, -976, -999, -1052, -1063, -1024, -1019, -1081, -1128, -1092, -1020, -991, -989, -940, -813, -671, -604, -630, -650, -576, -461, -436, -521, -587, -554, -512, -593, -777, -921, -950, -928, -919, -912, -878, -813, -717, -606, -527, -480, -409, -314, -275, -315, -337, -254, -108, 1, 53, 92, 170, 280, 367, 396, 395, 397, 372, 275, 147, 68, 30, -61, -254, -490, -681, -796, -882, -998, -1134, -1206, -1156, -1045, -985, -995, -953, -765, -520, -398, -439, -495, -433, -303, -253, -347, -507, -629, -718, -853, -1043, -1187, -1220, -1219, -1306, -1460, -1542, -1475, -1342, -1256, -1229, -1174, -1024, -793, -562, -395, -297, -221, -126, -33, 3, -30, -83, -111, -125, -156, -205, -253, -293, -338, -381, -400, -384, -347, -290, -200, -65, 114, 323, 515, 629, 665, 688, 739, 777, 756, 706, 687, 685, 642, 563, 524, 566, 648, 714, 754, 758, 710, 632, 578, 549, 492, 381, 262, 178, 129, 98, 79, 77, 91, 102, 73, 6, -35, -6, 62, 89, 33, -80, -183, -225, -210, -187, -199, -239, -281, -336, -429, -533, -570, -498, -380, -332, -402, -514, -554, -494, -384, -267, -154, -81, -91, -144, -130, -1, 155, 224, 174, 51, -95, -210, -242, -199, -195, -340, -582, -772, -836, -833, -835, -856, -897, -958, -1011, -1003, -902, -740, -616, -602, -655, -654, -577, -529, -566, -596, -554, -533, -645, -831, -930, -882, -794, -796, -908, -1046, -1129, -1146, -1146, -1185, -1268, -1337, -1340, -1291, -1259, -1268, -1263, -1197, -1099, -1041, -1035, -1027, -983, -954, -996, -1086, -1135, -1104, -1053, -1066, -1136, -1184, -1178, -1189, -1292, -1456, -1589, -1672, -1769, -1922, -2086, -2184, -2198, -2167, -2128, -2052, -1875, -1592, -1301, -1128, -1078, -1016, -834, -597, -464, -475, -524, -528, -511, -526, -570, -606, -614, -599, -603, -639, -667, -650, -623, -608, -542, -362, -142, -24, -25, -18, 104, 288, 398, 389, 355, 406, 523, 592, 570, 533, 543, 560, 523, 455, 434, 473, 486, 388, 189, -5, -99, -88, -55, -95, -229, -390, -450, -336, -96, 125, 225, 225, 225, 278, 358, 409, 416, 379, 297, 203, 149, 135, 101, 32, -12, 4, 45, 85, 147, 225, 266, 244, 208, 210, 261, 330, 375, 379, 380, 447, 600, 767, 852, 850, 847, 910, 987, 982, 881, 751, 645, 547, 421, 268, 138, 52, -31, -141, -226, -217, -138, -75, -49, -4, 86, 221, 377, 501, 532, 506, 544, 687, 833, 896, 939, 1063, 1263, 1429, 1474, 1421, 1372, 1381, 1386, 1311, 1194, 1113, 1077, 1043, 1016, 1015, 1033, 1085, 1217, 1395, 1507, 1523, 1558, 1699, 1889, 2022, 2078, 2113, 2159, 2196, 2199, 2163, 2077, 1927, 1720, 1478, 1236, 1058, 987, 964, 887, 759, 708, 794, 940, 1057, 1131, 1178, 1208, 1234, 1258, 1280, 1328, 1434, 1524, 1487, 1347, 1278, 1374, 1502, 1467, 1273, 1107, 1088, 1144, 1136, 1051, 973, 946, 940, 915, 887, 891, 912, 895, 817, 742, 744, 812, 861, 850, 824, 854, 939, 1032, 1109, 1175, 1238, 1301, 1356, 1364, 1268, 1097, 948, 851, 720, 539, 435, 480, 553, 519, 433, 464, 666, 902, 985, 890, 773, 786, 877, 885, 768, 646, 617, 648, 666, 661, 665, 696, 744, 795, 846, 903, 965, 1014, 1030, 1007, 944, 855, 782, 769, 798, 774, 638, 470, 417, 506, 609, 630, 620, 671, 804, 1018, 1291, 1507, 1546, 1470, 1450, 1506, 1467, 1247, 977, 801, 670, 485, 301, 238, 278, 310, 326, 381, 451, 493, 567, 731, 868, 825, 641, 500, 476, 468, 396, 293, 197, 92, 20, 49, 114, 86, 3, 21, 132, 168, 90, 22, 21, 13, -64, -192, -349, -532, -716, -879, -1039, -1211, -1354, -1401, -1353, -1312, -1363, -1454, -1439, -1257, -1012, -842, -780, -769, -754, -706, -604, -467, -356, -315, -340, -404, -469, -484, -435, -384, -390, -443, -517, -606, -680, -690, -652, -635, -667, -711, -728, -704, -616, -459, -314, -289, -353, -324, -122, 98, 156, 96, 77, 132, 176, 173, 158, 131, 60, -30, -98, -168, -290, -418, -461, -451, -527, -708, -848, -847, -771, -706, -649, -584, -536, -510, -457, -341, -191, -71, -24, -33, -38, -5, 46, 67, 39, -24, -101, -170, -221, -253, -263, -261, -297, -422, -582, -646, -562, -450, -461, -596, -727, -770, -740, -698, -658, -617, -573, -532, -497, -479, -470, -414, -284, -173, -201, -350, -486, -531, -539, -599, -734, -906, -1045, -1095, -1061, -1012, -1016, -1069, -1104, -1068, -973, -865, -773, -689, -606, -530, -453, -357, -229, -104, -35, -38, -55, -36, -16, -53, -130, -198, -275, -380, -457, -468, -487, -573, -665, -694, -692, -699, -685, -630, -561, -498, -442, -390, -337, -254, -142, -44, 21, 72, 109, 102, 61, 51, 92, 106, 24, -101, -166, -167, -191, -274, -374, -466, -551, -600, -610, -629, -676, -709, -705, -688, -648, -571, -521, -543, -561, -500, -415, -377, -341, -257, -186, -193, -237, -246, -235, -254, -320, -398, -462, -519, -583, -656, -727, -797, -874, -944, -980, -977, -978, -1036, -1144, -1220, -1200, -1105, -994, -879, -758, -652, -557, -426, -244, -102, -74, -122, -150, -131, -121, -189, -340, -507, -597, -600, -600, -675, -796, -868, -861, -837, -825, -790, -731, -703, -696, -620, -478, -383, -366, -323, -220, -152, -162, -184, -167, -154, -177, -210, -235, -275, -359, -473, -571, -615, -624, -660, -749, -848, -898, -888, -850, -809, -767, -722, -683, -636, -554, -435, -324, -272, -267, -255, -218, -192, -187, -157, -97, -86, -165, -244, -234, -174, -167, -226, -295, -339, -373, -416, -469, -522, -566, -597, -617, -624, -603, -538, -447, -367, -305, -228, -116, -3, 64, 91, 118, 154, 173, 155, 117, 80, 43, 13, -1, -23, -73, -98, -30, 84, 119, 55, 12, 72, 173, 222, 230, 260, 303, 311, 312, 369, 458, 501, 490, 489, 529, 588, 648, 697, 702, 653, 602, 596, 603, 563, 475, 392, 335, 274, 212, 203, 266, 346, 389, 409, 455, 543, 653, 749, 793, 784, 752, 727, 713, 693, 675, 682, 705, 720, 713, 705, 724, 759, 782, 782, 772, 748, 689, 596, 494, 404, 317, 228, 157, 103, 57, 35, 74, 159, 227, 252, 272, 330, 414, 483, 525, 553, 569, 562, 528, 491, 474, 483, 507, 520, 510, 477, 443, 439, 465, 496, 493, 440, 358, 289, 271, 304, 341, 327, 254, 169, 135, 172, 262, 377, 480, 524, 482, 418, 426, 515, 605, 624, 571, 469, 343, 247, 235, 280, 306, 261, 166, 81, 63, 118, 190, 210, 174, 133, 131, 175, 253, 333, 376, 358, 304, 276, 313, 394, 453, 449, 397, 352, 360, 413, 460, 445, 365, 264, 190, 163, 180, 218, 244, 227, 171, 112, 97, 146, 216, 240, 199, 146, 127, 134, 139, 146, 158, 164, 161, 156, 136, 89, 44, 41, 69, 67, 14, -32, -14, 57, 124, 144, 124, 89, 60, 60, 105, 174, 211, 189, 132, 84, 67, 74, 90, 95, 67, 15, -23, -27, -12, -7, -21, -45, -72, -98, -108, -100, -91, -104, -124, -128, -117, -108, -103, -85, -64, -65, -84, -86, -59, -28, -12, -12, -16, -19, -23, -19, 0, 24, 35, 21, 0, -10, -6, 1, 9, 5, -27, -85, -132, -132, -99, -82, -100, -123, -128, -125, -132, -137, -126, -114, -119, -133, -124, -96, -71, -67, -66, -52, -30, -8, 7, 19, 19, 3, -14, -17, -5, 2, -3, -22, -48, -66, -66, -48, -28, -28, -46, -64, -67, -55, -39, -25, -25, -38, -50, -49, -41, -38, -38, -34, -31, -35, -37, -24, -8, -12, -30, -37, -24, -20, -36, -52, -53, -54, -73, -98, -107, -103, -99, -98, -93, -81, -69, -63, -57, -40, -21, -15, -23, -31, -29, -23, -23, -24, -22, -21, -27, -33, -32, -28, -24, -28, -34, -38, -34, -27, -23, -25, -29, -30, -29, -27, -22, -21, -24, -29, -30, -27, -25, -30, -33, -33, -31, -31, -32, -32, -34, -37, -40, -40, -39, -37, -36, -38, -41, -42, -38, -32, -30, -30, -28, -23, -17, -14, -16, -19, -18, -14, -12, -14, -15, -14, -12, -13, -13, -11, -7, -5, -5, -6, -6, -4, -2, 0, -1, -2, -1, 1, 3, 4, 4, 5, 5, 4, 4, 4, 4, 4, 3, 3, 3, 2, 0, 0, 0, 0, 0, 0, 0, 1, 1, 2, 4, 6, 4, 2, 2, 3, 2, 0, 0, -1, -3, -4, -1, 1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 1, 2, 3, 1, 0, 0, 1, 1, 0, 1, 2, 2, 0, 0, 0, 1, 1, 2, 2, 1, 0, 0, 1, 2, 2, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 1, 1, 1, 1, 2, 2, 2, 1, 1, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 1, 0, 0, 0, 1, 2, 1, 0, -1 };
+// IMA ADPCM blocks, see audio_adpcm.h
+static const uint8_t __in_flash("audio_ten_sample_data") audio_ten_sample_data[] = { 0, 0, 0, 0, 166, 11, 20, 170, 33, 201, 0, 144, 49, 185, 33, 144, 26, 17, 153, 1, 0, 0, 0, 17, 9, 1, 9, 0, 0, 0, 17, 16, 19, 0, 145, 41, 146, 27, 147, 27, 2, 169, 26, 2, 155, 33, 153, 18, 185, 144, 185, 49, 161, 9, 17, 153, 0, 9, 0, 9, 1, 9, 17, 0, 169, 154, 57, 4, 169, 33, 146, 154, 16, 144, 49, 144, 154, 185, 25, 18, 51, 153, 25, 185, 9, 169, 41, 18, 17, 65, 17, 144, 203, 40, 163, 141, 16, 144, 33, 144, 185, 58, 5, 138, 176, 140, 49, 33, 35, 153, 16, 153, 145, 158, 33, 160, 185, 57, 35, 185, 153, 32, 147, 187, 50, 147, 186, 27, 115, 144, 11, 34, 187, 27, 146, 156, 80, 18, 168, 9, 17, 145, 159, 16, 130, 8, 144, 185, 42, 3, 9, 145, 158, 65, 145, 155, 160, 189, 137, 80, 52, 2, 176, 174, 136, 137, 67, 1, 144, 155, 201, 57, 135, 187, 144, 48, 4, 88, 22, 185, 169, 57, 147, 143, 4, 170, 64, 130, 189, 34, 1, 2, 169, 169, 191, 128, 40, 37, 32, 18, 218, 41, 193, 141, 162, 157, 85, 128, 153, 219, 9, 16, 99, 1, 152, 137, 2, 203, 138, 33, 49, 70, 129, 25, 195, 173, 1, 116, 3, 171, 235, 42, 35, 34, 176, 26, 224, 140, 18, 80, 195, 140, 17, 9, 19, 64, 6, 206, 136, 144, 16, 17, 129, 152, 168, 11, 85, 2, 152, 33, 160, 72, 240, 159, 32, 4, 138, 83, 201, 8, 0, 130, 174, 50, 201, 9, 136, 52, 170, 70, 250, 41, 130, 137, 17, 129, 128, 186, 88, 4, 40, 146, 140, 19, 157, 68, 176, 171, 128, 216, 207, 64, 20, 170, 34, 250, 27, 101, 51, 176, 188, 188, 11, 36, 50, 145, 154, 169, 73, 55, 144, 188, 90, 119, 2, 169, 205, 155, 66, 35, 136, 219, 171, 97, 35, 128, 202, 170, 40, 70, 130, 187, 154, 137, 48, 53, 129, 219, 153, 136, 48, 2, 154, 169, 189, 64, 70, 18, 168, 219, 138, 99, 131, 202, 170, 24, 68, 18, 152, 170, 154, 40, 52, 36, 2, 170, 139, 202, 156, 186, 58, 87, 130, 153, 169, 138, 152, 26, 38, 144, 0, 236, 171, 65, 36, 18, 1, 251, 157, 33, 18, 144, 172, 136, 16, 52, 145, 235, 26, 19, 153, 115, 160, 157, 9, 8, 128, 66, 19, 154, 65, 162, 189, 32, 152, 88, 38, 146, 204, 171, 24, 69, 18, 168, 9, 200, 139, 18, 176, 42, 20, 237, 57, 53, 160, 25, 3, 220, 25, 36, 185, 25, 145, 41, 39, 184, 172, 24, 19, 137, 69, 217, 11, 68, 130, 188, 155, 184, 140, 54, 128, 24, 184, 139, 49, 36, 16, 4, 239, 25, 20, 168, 16, 145, 171, 113, 20, 184, 155, 136, 49, 4, 154, 235, 26, 37, 168, 138, 34, 128, 25, 37, 220, 10, 8, 84, 161, 10, 144, 138, 81, 53, 192, 171, 152, 98, 27, 7, 61, 0, 145, 139, 51, 200, 11, 66, 160, 73, 133, 191, 48, 144, 72, 129, 186, 41, 133, 173, 49, 1, 155, 114, 145, 189, 10, 68, 130, 170, 137, 17, 184, 140, 51, 53, 233, 11, 34, 50, 184, 159, 24, 17, 50, 2, 238, 139, 83, 18, 136, 169, 173, 81, 146, 138, 49, 129, 219, 9, 17, 66, 162, 188, 138, 85, 3, 190, 138, 16, 66, 2, 203, 172, 57, 53, 1, 136, 153, 170, 187, 58, 119, 130, 155, 170, 24, 85, 1, 154, 170, 56, 19, 185, 204, 171, 65, 36, 17, 152, 172, 65, 129, 203, 113, 4, 172, 8, 9, 1, 25, 3, 188, 136, 65, 3, 172, 137, 9, 67, 34, 39, 251, 142, 32, 49, 2, 201, 188, 58, 70, 130, 218, 138, 128, 50, 4, 202, 10, 34, 144, 16, 145, 186, 72, 55, 217, 138, 33, 128, 153, 16, 50, 38, 202, 155, 136, 128, 98, 146, 202, 139, 68, 145, 170, 9, 50, 50, 130, 186, 255, 11, 115, 19, 202, 155, 8, 17, 16, 66, 224, 139, 17, 68, 176, 158, 33, 2, 152, 203, 72, 36, 144, 155, 16, 170, 33, 136, 71, 161, 220, 138, 50, 52, 144, 204, 10, 82, 19, 217, 173, 32, 52, 129, 187, 170, 8, 53, 129, 186, 219, 10, 116, 2, 186, 136, 144, 25, 36, 144, 152, 136, 152, 155, 160, 44, 119, 131, 202, 155, 65, 34, 168, 170, 172, 81, 3, 9, 176, 140, 83, 3, 251, 9, 1, 65, 19, 202, 170, 202, 41, 53, 131, 187, 25, 64, 39, 128, 234, 188, 41, 35, 1, 16, 168, 114, 146, 188, 171, 56, 21, 0, 185, 25, 34, 87, 200, 10, 169, 27, 87, 129, 154, 153, 137, 33, 4, 203, 40, 1, 34, 160, 170, 138, 18, 235, 65, 129, 200, 12, 38, 136, 130, 173, 24, 144, 24, 83, 200, 56, 147, 139, 1, 189, 113, 192, 43, 21, 25, 34, 217, 155, 50, 249, 138, 1, 17, 33, 2, 235, 40, 131, 169, 57, 21, 207, 10, 50, 52, 17, 202, 188, 40, 19, 169, 24, 20, 8, 33, 32, 162, 207, 136, 220, 9, 69, 18, 202, 25, 2, 136, 136, 16, 192, 59, 7, 154, 17, 160, 169, 9, 250, 75, 55, 129, 235, 156, 65, 35, 186, 41, 145, 11, 4, 137, 128, 136, 137, 87, 192, 10, 1, 219, 25, 54, 129, 186, 188, 40, 69, 17, 184, 189, 9, 99, 2, 185, 171, 56, 36, 49, 177, 206, 138, 16, 34, 52, 192, 175, 16, 35, 2, 186, 137, 40, 19, 237, 10, 82, 3, 186, 171, 48, 38, 128, 188, 9, 18, 81, 146, 138, 184, 28, 146, 171, 170, 113, 71, 129, 187, 11, 129, 137, 83, 145, 170, 8, 160, 26, 36, 170, 98, 177, 189, 40, 68, 18, 1, 223, 138, 33, 1, 48, 7, 169, 153, 24, 161, 138, 128, 64, 20, 137, 51, 184, 204, 9, 147, 157, 67, 34, 55, 144, 202, 204, 171, 25, 33, 85, 3, 9, 192, 189, 24, 56, 235, 64, 0, 50, 130, 172, 144, 25, 55, 130, 160, 187, 9, 202, 25, 116, 36, 152, 202, 171, 24, 50, 35, 184, 170, 8, 84, 3, 234, 173, 72, 35, 217, 155, 81, 19, 128, 169, 155, 160, 155, 86, 130, 25, 160, 154, 16, 176, 142, 130, 57, 55, 33, 146, 205, 137, 32, 201, 172, 138, 83, 20, 168, 9, 34, 144, 203, 64, 4, 153, 144, 171, 65, 34, 36, 251, 138, 169, 8, 32, 119, 146, 9, 185, 156, 152, 56, 5, 10, 50, 68, 161, 187, 169, 172, 64, 145, 203, 72, 38, 145, 24, 160, 188, 41, 131, 154, 69, 129, 250, 188, 56, 37, 129, 8, 168, 156, 65, 34, 17, 216, 154, 128, 186, 154, 81, 4, 24, 68, 129, 236, 139, 33, 16, 34, 160, 237, 155, 49, 52, 34, 130, 188, 171, 57, 55, 177, 223, 25, 17, 35, 18, 184, 27, 37, 176, 206, 25, 129, 17, 1, 34, 152, 203, 188, 32, 83, 35, 176, 204, 9, 52, 2, 144, 189, 202, 172, 16, 83, 36, 128, 155, 16, 250, 138, 18, 144, 65, 4, 185, 203, 186, 57, 87, 17, 0, 169, 187, 8, 136, 83, 146, 219, 170, 40, 86, 36, 146, 203, 173, 40, 34, 17, 2, 202, 139, 153, 153, 0, 152, 33, 68, 52, 34, 130, 203, 201, 207, 187, 189, 64, 69, 20, 144, 137, 169, 204, 138, 24, 53, 18, 168, 139, 50, 82, 4, 204, 171, 8, 99, 35, 168, 188, 153, 137, 32, 52, 35, 168, 24, 129, 202, 189, 137, 169, 82, 177, 139, 202, 114, 7, 8, 168, 153, 153, 65, 38, 144, 137, 144, 203, 9, 144, 57, 23, 154, 33, 153, 114, 3, 218, 155, 185, 139, 52, 17, 50, 68, 177, 173, 152, 170, 49, 3, 201, 156, 114, 37, 0, 144, 205, 9, 18, 152, 24, 68, 35, 129, 185, 219, 204, 154, 8, 16, 66, 52, 129, 137, 50, 146, 207, 137, 145, 42, 54, 161, 25, 18, 185, 207, 9, 33, 50, 2, 236, 189, 25, 52, 144, 9, 35, 0, 69, 176, 186, 172, 40, 67, 3, 189, 153, 218, 73, 55, 4, 184, 172, 9, 17, 51, 3, 220, 171, 138, 68, 130, 168, 187, 24, 65, 54, 192, 156, 168, 25, 67, 35, 208, 156, 17, 50, 35, 136, 235, 139, 136, 9, 25, 67, 201, 57, 54, 35, 176, 207, 155, 40, 18, 51, 19, 1, 172, 17, 217, 186, 173, 114, 35, 17, 129, 0, 220, 188, 156, 8, 24, 68, 130, 137, 0, 65, 36, 160, 207, 154, 144, 48, 52, 16, 130, 153, 185, 188, 64, 35, 68, 19, 136, 34, 177, 223, 204, 138, 50, 35, 19, 153, 185, 11, 21, 186, 186, 190, 64, 19, 16, 252, 139, 2, 65, 38, 128, 154, 170, 153, 33, 52, 168, 203, 188, 81, 68, 51, 162, 190, 138, 32, 34, 168, 153, 171, 26, 116, 4, 218, 171, 152, 82, 53, 1, 200, 141, 128, 9, 1, 137, 1, 67, 2, 8, 250, 159, 24, 33, 18, 216, 5, 58, 0, 144, 168, 153, 16, 33, 161, 255, 154, 24, 51, 36, 19, 160, 204, 138, 136, 24, 35, 144, 65, 70, 36, 160, 204, 138, 0, 153, 40, 19, 9, 70, 131, 170, 219, 171, 16, 34, 1, 9, 115, 20, 185, 170, 236, 171, 49, 83, 51, 36, 184, 189, 188, 10, 145, 57, 131, 140, 19, 40, 36, 56, 39, 184, 202, 189, 0, 32, 38, 1, 0, 186, 156, 66, 136, 101, 160, 188, 137, 82, 2, 136, 145, 154, 65, 34, 21, 219, 9, 235, 25, 145, 48, 178, 141, 130, 24, 19, 137, 96, 37, 160, 186, 189, 188, 153, 0, 8, 117, 19, 1, 144, 16, 145, 173, 169, 173, 32, 50, 52, 0, 68, 168, 186, 155, 0, 0, 200, 43, 133, 189, 154, 203, 88, 37, 17, 51, 18, 160, 220, 186, 205, 9, 17, 66, 51, 67, 1, 65, 130, 189, 205, 156, 8, 82, 19, 137, 128, 171, 234, 140, 34, 16, 83, 2, 217, 172, 136, 136, 0, 9, 129, 9, 119, 19, 0, 185, 169, 235, 137, 50, 53, 130, 136, 136, 8, 185, 205, 172, 48, 53, 18, 202, 170, 203, 26, 2, 128, 202, 28, 70, 66, 35, 152, 202, 156, 152, 9, 20, 136, 0, 0, 68, 84, 35, 160, 171, 25, 147, 223, 137, 152, 136, 49, 36, 202, 187, 11, 66, 83, 161, 172, 187, 155, 32, 33, 34, 128, 115, 20, 51, 35, 68, 232, 187, 220, 172, 138, 48, 53, 129, 81, 130, 139, 144, 171, 136, 32, 130, 173, 136, 89, 39, 0, 2, 136, 33, 168, 57, 51, 195, 207, 169, 170, 8, 40, 70, 1, 33, 19, 201, 221, 187, 138, 137, 152, 155, 83, 129, 114, 36, 18, 152, 136, 233, 139, 34, 170, 137, 10, 103, 34, 67, 2, 0, 185, 190, 172, 170, 8, 67, 51, 37, 17, 160, 171, 184, 159, 128, 188, 49, 184, 140, 51, 3, 251, 26, 53, 34, 2, 33, 216, 175, 171, 203, 170, 49, 83, 20, 16, 36, 129, 219, 187, 170, 219, 156, 32, 49, 52, 18, 68, 18, 144, 137, 144, 187, 186, 10, 216, 142, 67, 68, 53, 18, 34, 145, 202, 154, 152, 204, 186, 189, 137, 40, 66, 68, 146, 138, 0, 144, 187, 136, 252, 171, 189, 138, 128, 33, 52, 84, 18, 34, 2, 1, 202, 153, 187, 220, 9, 67, 86, 34, 16, 144, 169, 188, 40, 176, 41, 232, 187, 221, 137, 168, 57, 19, 114, 20, 17, 34, 51, 216, 172, 205, 156, 138, 24, 66, 51, 51, 36, 152, 153, 168, 170, 33, 253, 138, 152, 188, 186, 140, 0, 0, 48, 119, 50, 34, 1, 152, 203, 205, 171, 153, 8, 51, 84, 51, 34, 17, 33, 208, 172, 186, 11, 1, 80, 20, 137, 153, 154, 220, 155, 17, 82, 3, 56, 132, 235, 187, 154, 204, 138, 128, 97, 53, 51, 20, 129, 235, 155, 170, 137, 128, 99, 19, 34, 18, 1, 184, 188, 188, 137, 24, 86, 52, 2, 169, 201, 223, 204, 154, 234, 183, 68, 0, 137, 9, 66, 68, 51, 34, 51, 17, 169, 188, 186, 173, 24, 66, 68, 52, 50, 34, 18, 0, 128, 8, 1, 186, 173, 203, 206, 187, 155, 32, 34, 49, 69, 3, 168, 204, 205, 203, 219, 171, 154, 136, 0, 17, 16, 1, 152, 169, 189, 188, 187, 219, 188, 138, 137, 33, 34, 66, 83, 36, 17, 50, 145, 154, 251, 175, 170, 9, 50, 68, 67, 52, 18, 128, 50, 130, 172, 136, 219, 154, 184, 140, 82, 129, 32, 146, 140, 2, 219, 251, 187, 187, 188, 218, 187, 65, 51, 130, 40, 69, 184, 172, 8, 129, 24, 53, 33, 69, 67, 68, 19, 17, 51, 129, 0, 16, 66, 130, 185, 90, 37, 8, 70, 130, 16, 1, 201, 190, 152, 201, 137, 153, 0, 128, 49, 200, 172, 170, 202, 189, 138, 152, 25, 17, 100, 130, 8, 34, 34, 19, 115, 3, 137, 68, 129, 139, 70, 18, 96, 52, 17, 50, 130, 169, 185, 191, 203, 170, 8, 52, 2, 48, 55, 3, 186, 32, 162, 13, 68, 146, 137, 51, 240, 188, 156, 65, 3, 136, 49, 51, 250, 158, 16, 1, 153, 99, 129, 32, 34, 129, 252, 204, 190, 171, 170, 32, 70, 53, 35, 18, 0, 136, 169, 154, 137, 136, 169, 64, 51, 69, 18, 18, 1, 0, 152, 128, 153, 170, 238, 221, 172, 186, 170, 16, 66, 51, 51, 3, 251, 188, 203, 219, 187, 187, 154, 137, 48, 52, 52, 20, 129, 137, 9, 200, 187, 170, 203, 187, 40, 33, 117, 19, 82, 19, 16, 2, 136, 161, 190, 202, 189, 187, 8, 17, 70, 36, 34, 1, 17, 201, 155, 218, 172, 187, 188, 153, 136, 137, 49, 145, 201, 172, 128, 220, 170, 201, 172, 153, 170, 138, 32, 101, 68, 34, 34, 51, 53, 1, 17, 136, 97, 35, 1, 115, 22, 17, 33, 1, 32, 0, 34, 184, 186, 170, 250, 189, 154, 8, 218, 11, 3, 217, 138, 129, 218, 170, 169, 185, 189, 64, 18, 17, 53, 0, 16, 1, 116, 5, 49, 21, 17, 129, 32, 35, 145, 137, 145, 206, 9, 153, 99, 130, 40, 5, 9, 2, 187, 65, 146, 25, 208, 159, 0, 202, 41, 3, 48, 20, 9, 3, 188, 32, 233, 156, 185, 189, 154, 170, 32, 35, 50, 35, 50, 184, 222, 171, 24, 144, 73, 71, 1, 137, 153, 56, 145, 106, 87, 2, 152, 65, 37, 136, 99, 3, 139, 17, 169, 41, 18, 81, 161, 223, 170, 186, 202, 26, 36, 128, 153, 219, 171, 152, 171, 83, 152, 85, 146, 8, 35, 18, 251, 223, 170, 170, 9, 100, 67, 52, 35, 1, 136, 136, 186, 170, 152, 137, 153, 73, 54, 36, 34, 1, 160, 204, 186, 170, 188, 187, 251, 189, 187, 187, 153, 32, 52, 68, 18, 169, 170, 189, 203, 204, 187, 172, 137, 0, 96, 36, 18, 2, 169, 9, 144, 154, 49, 200, 9, 129, 114, 51, 83, 69, 2, 128, 17, 144, 9, 152, 235, 219, 186, 172, 191, 228, 55, 0, 153, 48, 39, 1, 16, 144, 218, 204, 169, 201, 187, 187, 187, 170, 42, 52, 129, 136, 169, 203, 137, 8, 68, 145, 153, 200, 138, 84, 86, 36, 67, 51, 67, 2, 34, 130, 138, 1, 8, 100, 67, 52, 38, 129, 33, 168, 154, 187, 10, 192, 173, 154, 186, 203, 138, 169, 136, 251, 170, 219, 170, 169, 153, 171, 16, 218, 89, 55, 33, 67, 50, 35, 169, 49, 2, 114, 38, 67, 51, 34, 49, 37, 128, 18, 184, 138, 217, 172, 169, 24, 36, 184, 56, 226, 159, 0, 186, 16, 233, 155, 218, 173, 136, 154, 17, 18, 66, 130, 41, 21, 185, 64, 192, 10, 163, 159, 17, 186, 115, 129, 49, 19, 40, 22, 169, 82, 145, 138, 144, 172, 129, 203, 64, 20, 49, 145, 159, 144, 189, 24, 200, 10, 145, 175, 40, 161, 141, 33, 144, 24, 160, 41, 224, 156, 2, 138, 100, 130, 24, 19, 218, 72, 19, 97, 4, 8, 50, 145, 171, 113, 38, 152, 48, 3, 186, 203, 156, 128, 236, 187, 235, 155, 82, 51, 71, 35, 18, 128, 169, 187, 171, 186, 26, 35, 136, 115, 36, 17, 51, 130, 169, 220, 189, 202, 170, 153, 204, 154, 153, 172, 16, 0, 100, 18, 136, 160, 175, 170, 202, 170, 136, 136, 17, 34, 100, 36, 17, 1, 144, 153, 153, 168, 156, 24, 128, 128, 114, 52, 34, 83, 34, 145, 154, 219, 191, 155, 170, 156, 153, 154, 32, 128, 99, 3, 8, 201, 190, 219, 171, 170, 186, 154, 160, 10, 67, 52, 52, 18, 51, 129, 80, 3, 48, 3, 42, 71, 169, 116, 20, 65, 35, 50, 3, 32, 129, 188, 8, 0, 33, 67, 83, 51, 35, 17, 152, 249, 190, 186, 187, 137, 203, 25, 232, 171, 160, 188, 16, 152, 8, 251, 141, 34, 152, 8, 8, 52, 1, 116, 18, 99, 34, 66, 19, 41, 38, 144, 80, 35, 1, 66, 36, 8, 34, 17, 129, 223, 10, 144, 187, 139, 50, 177, 175, 136, 152, 235, 11, 200, 140, 129, 189, 0, 202, 32, 192, 58, 22, 0, 34, 32, 38, 160, 72, 130, 171, 32, 50, 35, 115, 54, 17, 33, 136, 33, 216, 139, 200, 141, 144, 188, 0, 237, 9, 192, 155, 129, 153, 18, 170, 17, 220, 25, 161, 138, 114, 34, 49, 52, 1, 69, 193, 26, 53, 129, 0, 83, 161, 158, 16, 202, 10, 18, 66, 146, 73, 6, 169, 154, 136, 2, 152, 96, 37, 208, 155, 2, 239, 154, 152, 10, 99, 83, 52, 34, 17, 136, 201, 187, 138, 185, 41, 69, 18, 16, 50, 129, 138, 201, 190, 170, 187, 204, 154, 186, 173, 186, 188, 25, 50, 68, 66, 35, 168, 203, 220, 187, 156, 153, 24, 66, 34, 69, 18, 0, 136, 152, 202, 170, 138, 169, 153, 136, 9, 32, 70, 35, 65, 19, 129, 217, 221, 186, 187, 189, 171, 154, 128, 49, 55, 34, 52, 144, 170, 204, 204, 170, 170, 154, 16, 0, 32, 66, 36, 201, 44, 0, 34, 128, 128, 8, 169, 154, 218, 138, 216, 156, 66, 33, 119, 52, 35, 52, 35, 130, 152, 168, 186, 202, 104, 4, 48, 39, 32, 35, 186, 48, 250, 141, 144, 137, 0, 153, 18, 234, 25, 161, 12, 19, 9, 53, 201, 57, 148, 171, 67, 152, 97, 2, 115, 2, 81, 19, 32, 18, 138, 0, 9, 83, 83, 50, 67, 18, 184, 9, 129, 140, 145, 27, 5, 222, 155, 136, 217, 10, 35, 186, 11, 2, 251, 141, 1, 187, 8, 202, 41, 17, 99, 1, 49, 133, 138, 51, 221, 80, 162, 26, 35, 188, 0, 185, 41, 160, 113, 163, 141, 2, 205, 8, 201, 9, 130, 155, 168, 191, 153, 172, 24, 185, 80, 130, 40, 34, 129, 136, 2, 252, 172, 16, 32, 51, 115, 55, 0, 33, 201, 10, 147, 174, 98, 2, 65, 131, 137, 4, 219, 41, 144, 25, 19, 137, 99, 208, 11, 52, 176, 188, 32, 162, 206, 153, 0, 168, 173, 186, 156, 32, 101, 70, 67, 51, 18, 144, 186, 203, 187, 154, 65, 51, 67, 36, 50, 1, 169, 202, 189, 219, 172, 170, 171, 169, 173, 152, 186, 137, 8, 50, 52, 1, 218, 238, 172, 170, 172, 136, 40, 34, 68, 35, 50, 3, 152, 202, 187, 170, 137, 128, 33, 19, 115, 20, 8, 36, 8, 1, 219, 153, 220, 187, 206, 154, 185, 153, 153, 32, 54, 18, 34, 129, 233, 189, 171, 187, 136, 136, 33, 51, 2, 138, 34, 32, 131, 139, 85, 145, 72, 178, 159, 168, 42, 20, 120, 71, 34, 52, 1, 1, 144, 153, 170, 40, 17, 102, 51, 18, 66, 19, 169, 9, 185, 41, 217, 48, 224, 26, 249, 138, 185, 43, 4, 137, 35, 128, 218, 12, 130, 157, 67, 217, 96, 131, 57, 39, 1, 33, 1, 8, 66, 2, 48, 55, 2, 8, 19, 168, 32, 34, 160, 64, 162, 137, 204, 185, 239, 136, 201, 137, 176, 140, 33, 200, 156, 25, 160, 175, 138, 9, 18, 136, 82, 18, 1, 136, 81, 130, 11, 55, 144, 56, 162, 139, 2, 48, 4, 80, 22, 168, 9, 168, 191, 138, 152, 188, 24, 249, 172, 154, 184, 188, 128, 202, 9, 18, 216, 140, 3, 191, 32, 200, 72, 20, 50, 130, 89, 148, 174, 33, 137, 84, 0, 115, 129, 137, 152, 170, 171, 81, 130, 73, 38, 153, 17, 201, 138, 184, 136, 185, 57, 147, 91, 5, 206, 203, 187, 152, 156, 117, 38, 35, 34, 2, 168, 203, 187, 137, 0, 50, 38, 34, 1, 16, 17, 185, 170, 219, 189, 219, 171, 187, 188, 219, 187, 153, 16, 83, 53, 3, 128, 233, 205, 186, 154, 152, 8, 50, 50, 20, 1, 33, 128, 168, 188, 154, 187, 56, 192, 157, 136, 187, 186, 104, 71, 35, 17, 128, 234, 204, 170, 186, 171, 8, 17, 16, 84, 51, 18, 1, 184, 204, 203, 188, 153, 137, 136, 152, 186, 10, 146, 173, 33, 17, 51, 251, 140, 249, 156, 169, 171, 16, 192, 189, 42, 0, 99, 68, 50, 53, 35, 0, 17, 168, 187, 72, 37, 32, 70, 66, 34, 17, 17, 129, 201, 137, 129, 170, 8, 36, 250, 11, 144, 203, 138, 83, 176, 26, 194, 12, 4, 191, 48, 129, 48, 53, 53, 34, 51, 160, 81, 162, 139, 84, 51, 18, 114, 37, 128, 32, 129, 154, 136, 154, 128, 188, 10, 129, 250, 10, 17, 144, 169, 116, 163, 175, 16, 218, 138, 170, 16, 128, 64, 36, 18, 1, 17, 152, 203, 173, 0, 222, 10, 176, 154, 18, 49, 54, 50, 36, 18, 1, 200, 205, 186, 218, 171, 153, 24, 2, 41, 71, 1, 128, 33, 2, 236, 138, 169, 188, 203, 137, 168, 25, 37, 83, 36, 49, 52, 168, 138, 216, 174, 10, 2, 171, 113, 3, 26, 36, 136, 101, 161, 26, 6, 186, 9, 0, 50, 129, 57, 5, 220, 56, 19, 65, 34, 33, 233, 187, 220, 155, 144, 169, 32, 1, 56, 38, 137, 67, 176, 187, 207, 154, 24, 86, 52, 52, 35, 129, 153, 153, 136, 16, 65, 68, 144, 136, 128, 16, 217, 155, 144, 205, 138, 152, 203, 9, 249, 172, 187, 171, 144, 155, 66, 177, 173, 235, 171, 202, 154, 50, 168, 10, 51, 200, 138, 184, 11, 249, 142, 19, 153, 82, 146, 138, 185, 140, 129, 186, 114, 3, 154, 218, 155, 232, 157, 33, 168, 56, 160, 58, 163, 13, 19, 172, 1, 235, 24, 160, 42, 132, 175, 16, 216, 138, 128, 10, 2, 187, 25, 251, 11, 129, 173, 0, 128, 81, 2, 48, 87, 129, 50, 36, 17, 34, 34, 21, 144, 97, 36, 32, 54, 0, 67, 177, 42, 132, 155, 2, 8, 36, 251, 138, 128, 188, 40, 177, 141, 130, 171, 18, 186, 113, 3, 137, 17, 81, 68, 51, 36, 50, 20, 154, 83, 136, 116, 3, 32, 2, 25, 130, 157, 66, 144, 10, 35, 235, 24, 130, 9, 201, 72, 210, 141, 34, 137, 16, 136, 136, 185, 207, 42, 5, 137, 36, 136, 152, 157, 82, 176, 41, 21, 168, 8, 161, 138, 146, 158, 49, 185, 66, 201, 8, 235, 56, 131, 171, 17, 203, 113, 3, 42, 71, 144, 9, 169, 171, 172, 128, 0, 184, 27, 22, 253, 10, 2, 25, 19, 138, 68, 201, 139, 18, 66, 37, 152, 184, 27, 148, 207, 65, 128, 80, 146, 24, 146, 11, 71, 152, 16, 160, 138, 161, 174, 32, 18, 0, 185, 96, 161, 43, 133, 189, 169, 190, 187, 8, 129, 32, 54, 130, 137, 144, 169, 250, 191, 24, 0, 114, 53, 84, 18, 1, 0, 152, 152, 153, 17, 19, 1, 152, 16, 49, 3, 189, 33, 250, 189, 154, 185, 218, 190, 171, 220, 154, 137, 16, 19, 16, 129, 204, 188, 204, 137, 168, 154, 153, 153, 137, 8, 33, 52, 52, 216, 27, 21, 154, 128, 205, 0, 236, 9, 17, 48, 36, 16, 18, 201, 188, 153, 203, 139, 168, 26, 131, 28, 71, 152, 49, 193, 10, 162, 158, 34, 169, 8, 250, 52, 216, 48, 0, 139, 145, 156, 33, 152, 16, 233, 157, 128, 153, 152, 219, 9, 202, 64, 21, 49, 54, 2, 40, 35, 152, 114, 19, 8, 68, 33, 34, 65, 39, 24, 17, 128, 16, 169, 137, 33, 200, 157, 50, 250, 139, 32, 17, 202, 25, 232, 10, 160, 175, 49, 160, 42, 163, 122, 23, 137, 49, 145, 10, 129, 137, 99, 130, 25, 71, 144, 24, 20, 0, 128, 136, 16, 8, 169, 11, 54, 160, 153, 33, 68, 161, 72, 71, 168, 32, 208, 26, 162, 158, 19, 152, 34, 186, 72, 146, 139, 129, 40, 178, 174, 202, 171, 169, 219, 10, 146, 157, 129, 25, 179, 175, 52, 217, 9, 202, 41, 19, 98, 131, 112, 131, 189, 0, 169, 64, 1, 81, 131, 138, 144, 42, 6, 173, 67, 177, 26, 192, 59, 23, 137, 18, 8, 21, 219, 10, 18, 185, 152, 174, 34, 238, 9, 145, 137, 0, 65, 36, 152, 83, 34, 1, 201, 10, 115, 178, 174, 49, 152, 9, 168, 11, 70, 17, 128, 10, 37, 217, 188, 137, 129, 171, 33, 8, 85, 160, 25, 217, 173, 170, 40, 67, 102, 35, 34, 19, 128, 153, 155, 34, 250, 40, 21, 17, 50, 16, 50, 200, 203, 172, 153, 170, 152, 221, 153, 235, 170, 154, 56, 145, 80, 4, 185, 204, 8, 234, 154, 170, 136, 200, 155, 33, 17, 160, 138, 2, 206, 40, 168, 138, 184, 189, 205, 155, 1, 16, 55, 35, 50, 130, 154, 203, 204, 187, 9, 202, 11, 34, 68, 3, 67, 2, 33, 177, 73, 6, 152, 200, 188, 202, 189, 138, 153, 16, 186, 17, 205, 9, 184, 188, 188, 187, 205, 138, 136, 56, 54, 17, 82, 36, 16, 98, 20, 128, 49, 19, 153, 98, 20, 40, 53, 161, 40, 4, 171, 115, 144, 9, 152, 153, 154, 19, 153, 52, 201, 8, 184, 48, 201, 118, 148, 155, 34, 128, 33, 85, 35, 16, 129, 26, 37, 219, 72, 36, 129, 8, 83, 1, 9, 17, 16, 128, 201, 187, 49, 193, 27, 51, 16, 131, 29, 119, 18, 34, 35, 34, 152, 203, 205, 9, 176, 139, 36, 50, 21, 136, 33, 147, 220, 172, 137, 235, 173, 137, 169, 154, 169, 80, 21, 136, 16, 1, 168, 172, 153, 234, 187, 202, 155, 17, 17, 82, 52, 17, 16, 2, 10, 68, 250, 156, 144, 205, 138, 16, 160, 72, 69, 17, 136, 40, 131, 173, 17, 153, 99, 184, 112, 145, 42, 22, 136, 17, 137, 51, 232, 41, 146, 187, 201, 156, 219, 154, 0, 99, 168, 114, 132, 171, 152, 138, 232, 27, 22, 9, 36, 170, 65, 144, 64, 19, 8, 1, 50, 241, 139, 131, 154, 225, 159, 49, 145, 25, 66, 130, 172, 153, 222, 154, 169, 40, 67, 116, 35, 67, 1, 136, 144, 185, 187, 25, 2, 16, 69, 19, 49, 129, 171, 32, 251, 159, 128, 170, 170, 205, 170, 186, 187, 138, 67, 3, 48, 5, 251, 171, 187, 219, 172, 8, 186, 25, 145, 48, 50, 219, 46, 0, 4, 40, 147, 42, 23, 153, 49, 208, 173, 154, 218, 10, 34, 83, 52, 51, 17, 136, 168, 207, 9, 176, 171, 8, 0, 136, 96, 38, 129, 49, 17, 51, 185, 97, 176, 190, 203, 187, 188, 138, 8, 136, 17, 0, 2, 152, 208, 173, 219, 140, 144, 173, 48, 51, 18, 81, 71, 17, 33, 51, 52, 129, 33, 20, 0, 128, 65, 21, 168, 40, 2, 10, 70, 1, 17, 2, 219, 155, 0, 168, 17, 251, 88, 162, 142, 67, 3, 8, 50, 1, 100, 19, 16, 53, 130, 235, 25, 145, 154, 17, 48, 71, 161, 137, 51, 200, 139, 52, 146, 9, 1, 205, 10, 186, 9, 145, 80, 53, 50, 54, 83, 2, 171, 66, 232, 140, 0, 144, 136, 40, 4, 153, 9, 168, 48, 131, 41, 55, 251, 140, 184, 174, 136, 153, 136, 170, 64, 147, 26, 52, 153, 168, 187, 152, 239, 154, 1, 186, 88, 19, 168, 72, 36, 152, 64, 39, 152, 40, 160, 156, 170, 26, 147, 57, 55, 32, 38, 40, 37, 201, 56, 177, 155, 129, 200, 26, 55, 185, 80, 193, 139, 18, 219, 172, 81, 161, 27, 146, 189, 170, 41, 18, 113, 103, 128, 16, 144, 137, 130, 171, 83, 146, 188, 16, 161, 173, 40, 184, 172, 84, 130, 8, 3, 202, 170, 252, 187, 139, 0, 56, 119, 22, 34, 18, 0, 152, 170, 155, 8, 128, 137, 50, 3, 186, 26, 35, 176, 156, 185, 175, 204, 206, 170, 219, 187, 154, 154, 32, 20, 67, 4, 152, 185, 190, 170, 185, 172, 8, 144, 203, 155, 8, 185, 56, 55, 83, 35, 17, 184, 206, 219, 171, 154, 153, 16, 52, 34, 52, 19, 17, 160, 9, 185, 154, 220, 188, 203, 153, 40, 68, 67, 37, 50, 52, 17, 17, 234, 188, 189, 188, 172, 138, 138, 0, 17, 50, 34, 50, 130, 186, 48, 248, 157, 185, 173, 8, 8, 69, 34, 85, 35, 66, 20, 34, 51, 16, 16, 169, 204, 186, 172, 24, 16, 86, 18, 49, 18, 16, 128, 186, 155, 184, 239, 137, 170, 25, 129, 25, 39, 33, 53, 35, 50, 52, 36, 160, 26, 131, 207, 40, 4, 9, 82, 17, 1, 33, 36, 0, 66, 2, 152, 186, 202, 220, 171, 153, 48, 5, 24, 55, 18, 32, 51, 0, 185, 155, 160, 255, 153, 169, 186, 189, 9, 0, 16, 33, 100, 129, 136, 129, 220, 187, 186, 203, 203, 154, 0, 153, 32, 54, 36, 48, 53, 2, 17, 152, 152, 236, 154, 185, 40, 37, 17, 99, 67, 2, 82, 21, 0, 66, 146, 156, 0, 189, 10, 219, 25, 161, 26, 2, 113, 4, 137, 68, 168, 9, 160, 74, 22, 188, 72, 192, 156, 0, 138, 49, 2, 65, 19, 136, 185, 157, 18, 235, 56, 20, 1, 234, 155, 17, 219, 41, 100, 34, 152, 152, 156, 218, 174, 136, 185, 40, 19, 66, 67, 3, 218, 187, 205, 154, 65, 55, 53, 67, 17, 129, 169, 170, 137, 32, 50, 69, 57, 71, 57, 0, 145, 154, 169, 187, 170, 9, 129, 169, 156, 202, 190, 203, 205, 170, 172, 155, 8, 35, 17, 84, 176, 173, 187, 173, 154, 8, 24, 0, 186, 235, 173, 137, 16, 83, 34, 49, 129, 236, 170, 186, 187, 153, 17, 1, 49, 69, 17, 32, 2, 32, 161, 140, 129, 204, 171, 154, 169, 138, 85, 68, 51, 70, 18, 1, 3, 234, 203, 235, 171, 185, 172, 8, 153, 25, 145, 41, 130, 26, 38, 186, 40, 249, 143, 128, 153, 48, 51, 84, 19, 81, 52, 18, 67, 18, 49, 163, 173, 0, 220, 9, 144, 40, 19, 56, 23, 137, 67, 184, 40, 208, 156, 184, 172, 152, 137, 9, 64, 68, 18, 100, 36, 16, 51, 129, 17, 176, 138, 161, 187, 65, 20, 8, 86, 34, 33, 35, 52, 19, 137, 2, 249, 188, 10, 168, 174, 56, 19, 49, 70, 50, 52, 130, 48, 20, 202, 26, 130, 206, 154, 169, 136, 185, 11, 20, 152, 81, 2, 8, 168, 189, 236, 172, 170, 156, 137, 137, 65, 36, 34, 19, 49, 37, 168, 64, 4, 153, 144, 205, 171, 218, 26, 35, 56, 71, 2, 18, 152, 98, 145, 138, 35, 169, 17, 219, 56, 3, 172, 82, 152, 97, 176, 91, 22, 154, 32, 200, 186, 203, 26, 2, 136, 38, 217, 10, 234, 138, 1, 56, 39, 0, 17, 184, 201, 207, 25, 131, 141, 66, 176, 57, 147, 12, 55, 144, 56, 129, 139, 17, 233, 171, 218, 187, 154, 186, 81, 21, 144, 16, 201, 191, 187, 187, 153, 97, 86, 35, 51, 34, 1, 168, 9, 1, 16, 68, 18, 144, 154, 0, 168, 138, 24, 146, 173, 49, 192, 221, 219, 205, 187, 203, 171, 17, 0, 49, 145, 170, 185, 206, 138, 33, 0, 144, 220, 188, 188, 188, 138, 1, 82, 51, 50, 18, 168, 218, 203, 203, 155, 136, 154, 136, 16, 136, 24, 160, 113, 36, 51, 145, 9, 177, 207, 169, 138, 34, 114, 53, 52, 37, 1, 18, 185, 173, 220, 187, 186, 173, 155, 186, 154, 185, 155, 0, 153, 16, 1, 208, 175, 16, 234, 25, 0, 40, 37, 66, 69, 50, 83, 52, 17, 34, 2, 152, 219, 155, 169, 173, 32, 144, 80, 146, 42, 21, 139, 36, 184, 11, 201, 189, 136, 202, 24, 2, 48, 99, 53, 98, 52, 18, 34, 18, 168, 48, 179, 156, 83, 2, 170, 113, 132, 41, 21, 0, 68, 1, 9, 1, 160, 190, 8, 136, 0, 154, 116, 19, 0, 48, 119, 130, 137, 50, 131, 188, 25, 160, 155, 153, 154, 138, 18, 172, 83, 128, 115, 176, 11, 145, 174, 137, 154, 80, 177, 159, 50, 160, 41, 36, 66, 145, 170, 169, 170, 234, 156, 33, 160, 172, 169, 8, 129, 155, 119, 129, 24, 168, 11, 162, 175, 49, 184, 32, 250, 11, 129, 171, 32, 53, 145, 10, 68, 146, 65, 36, 34, 19, 169, 24, 184, 171, 140, 71, 233, 10, 161, 172, 8, 16, 176, 12, 132, 207, 10, 176, 108, 1, 43, 0, 172, 1, 169, 32, 160, 154, 49, 132, 74, 119, 161, 9, 1, 187, 154, 10, 35, 9, 87, 128, 65, 163, 11, 53, 128, 82, 2, 16, 200, 155, 217, 156, 136, 9, 69, 0, 34, 1, 248, 174, 8, 219, 40, 146, 156, 34, 161, 188, 218, 190, 138, 153, 114, 55, 52, 35, 18, 144, 185, 170, 137, 128, 26, 54, 168, 155, 8, 18, 169, 170, 26, 38, 218, 10, 200, 237, 188, 186, 188, 10, 16, 83, 3, 33, 2, 152, 202, 155, 0, 16, 235, 171, 217, 235, 171, 138, 0, 52, 51, 71, 1, 137, 144, 219, 172, 137, 152, 137, 8, 128, 137, 2, 16, 86, 51, 52, 17, 129, 153, 186, 191, 153, 202, 155, 32, 34, 115, 52, 19, 0, 168, 235, 186, 188, 172, 187, 203, 171, 154, 170, 10, 33, 66, 53, 52, 51, 66, 1, 0, 153, 136, 186, 88, 36, 68, 101, 37, 18, 66, 18, 153, 152, 203, 187, 186, 171, 154, 8, 234, 155, 1, 219, 65, 2, 40, 19, 0, 218, 139, 131, 173, 17, 140, 119, 0, 98, 20, 16, 18, 128, 16, 1, 0, 33, 68, 160, 27, 4, 189, 40, 0, 115, 19, 49, 20, 32, 192, 142, 0, 187, 170, 171, 83, 217, 42, 37, 129, 152, 112, 36, 0, 81, 52, 1, 1, 168, 8, 201, 156, 49, 19, 0, 68, 176, 173, 184, 173, 9, 186, 10, 129, 221, 153, 168, 203, 155, 136, 218, 9, 2, 33, 19, 41, 55, 217, 138, 17, 129, 136, 100, 130, 137, 129, 173, 49, 200, 80, 130, 26, 19, 171, 152, 190, 169, 207, 9, 169, 155, 1, 144, 152, 115, 132, 24, 36, 136, 66, 129, 8, 1, 237, 138, 200, 171, 16, 152, 64, 193, 13, 37, 201, 9, 152, 202, 187, 8, 200, 156, 16, 184, 44, 37, 154, 115, 35, 145, 97, 4, 154, 17, 203, 9, 187, 56, 130, 24, 34, 37, 234, 57, 6, 171, 115, 129, 138, 35, 233, 26, 35, 170, 50, 130, 56, 23, 185, 42, 55, 184, 72, 4, 170, 204, 155, 184, 141, 33, 9, 52, 200, 10, 144, 237, 187, 203, 139, 115, 69, 99, 51, 35, 1, 16, 144, 171, 25, 144, 9, 160, 189, 9, 145, 190, 81, 147, 155, 33, 185, 205, 188, 205, 187, 203, 156, 9, 0, 128, 65, 3, 128, 128, 33, 128, 153, 190, 153, 252, 188, 153, 153, 10, 82, 66, 51, 18, 35, 185, 188, 218, 203, 169, 185, 172, 137, 153, 8, 65, 53, 36, 67, 50, 19, 128, 153, 187, 206, 187, 156, 136, 154, 97, 52, 50, 51, 3, 218, 187, 206, 187, 202, 172, 170, 185, 171, 136, 9, 69, 18, 83, 35, 33, 34, 1, 33, 160, 10, 38, 202, 88, 54, 34, 99, 52, 51, 1, 0, 168, 188, 188, 138, 152, 155, 185, 171, 201, 158, 17, 8, 67, 152, 48, 176, 138, 201, 169, 207, 26, 34, 115, 68, 67, 51, 34, 33, 36, 1, 66, 51, 145, 136, 19, 253, 154, 223, 255, 41, 0, 1, 137, 83, 34, 52, 129, 16, 177, 189, 218, 188, 155, 185, 11, 54, 1, 115, 18, 32, 68, 34, 35, 66, 20, 170, 137, 186, 187, 187, 114, 3, 40, 53, 52, 131, 138, 85, 160, 189, 8, 128, 219, 10, 130, 187, 170, 9, 68, 52, 68, 67, 1, 153, 154, 154, 152, 188, 64, 177, 158, 144, 202, 40, 19, 48, 53, 18, 51, 176, 190, 24, 250, 141, 130, 171, 49, 218, 64, 209, 156, 1, 188, 40, 144, 32, 130, 168, 205, 186, 191, 25, 184, 12, 34, 153, 16, 204, 56, 179, 159, 66, 129, 0, 18, 144, 186, 203, 186, 154, 33, 169, 103, 176, 28, 18, 170, 153, 50, 162, 139, 232, 27, 163, 223, 137, 186, 10, 250, 28, 20, 187, 49, 192, 170, 186, 9, 83, 161, 88, 148, 156, 34, 24, 55, 36, 1, 33, 250, 43, 134, 156, 99, 128, 16, 129, 10, 83, 160, 64, 21, 152, 128, 218, 139, 152, 188, 56, 209, 156, 17, 2, 9, 1, 237, 170, 236, 155, 82, 68, 34, 52, 19, 144, 137, 8, 33, 17, 50, 129, 169, 206, 25, 19, 169, 24, 1, 128, 136, 24, 52, 253, 223, 170, 154, 170, 9, 2, 0, 128, 170, 169, 25, 18, 24, 194, 255, 137, 186, 172, 154, 154, 9, 152, 65, 38, 51, 3, 186, 155, 235, 187, 10, 0, 40, 192, 191, 8, 152, 72, 53, 18, 67, 129, 56, 5, 136, 0, 154, 201, 157, 66, 18, 66, 51, 3, 188, 138, 217, 187, 234, 188, 171, 204, 173, 137, 169, 153, 154, 8, 136, 80, 21, 40, 39, 128, 34, 152, 49, 136, 65, 35, 66, 100, 53, 1, 17, 51, 161, 157, 1, 33, 146, 141, 34, 234, 154, 144, 219, 25, 129, 170, 24, 53, 144, 48, 249, 155, 144, 24, 66, 69, 1, 16, 145, 26, 38, 18, 100, 20, 128, 49, 20, 153, 0, 153, 49, 208, 58, 55, 18, 8, 65, 147, 189, 25, 35, 169, 96, 20, 153, 10, 128, 10, 54, 153, 115, 131, 137, 185, 72, 209, 157, 32, 192, 139, 34, 136, 67, 129, 24, 35, 193, 174, 49, 208, 26, 131, 172, 129, 25, 39, 219, 81, 162, 172, 153, 24, 240, 11, 38, 1, 152, 25, 34, 0, 16, 68, 53, 130, 171, 64, 130, 155, 50, 33, 39, 187, 114, 1, 50, 168, 41, 192, 206, 187, 26, 146, 188, 136, 170, 184, 175, 40, 18, 136, 9, 201, 203, 204, 153, 185, 40, 2, 155, 84, 1, 49, 18, 84, 161, 189, 8, 176, 139, 20, 137, 17, 252, 190, 137, 144, 155, 34, 160, 136, 221, 25, 19, 202, 40, 131, 206, 25, 129, 48, 19, 153, 17, 251, 140, 17, 168, 98, 2, 153, 152, 170, 235, 156, 33, 249, 9, 19, 153, 40, 52, 144, 40, 177, 30, 38, 49, 53, 19, 153, 34, 251, 11, 129, 48, 161, 156, 67, 177, 142, 68, 160, 8, 34, 130, 173, 18, 235, 24, 176, 155, 17, 84, 145, 25, 85, 131, 158, 1, 39, 0, 174, 24, 217, 156, 137, 17, 0, 128, 154, 34, 252, 9, 144, 188, 154, 186, 114, 87, 49, 52, 20, 18, 1, 0, 33, 128, 9, 34, 136, 24, 53, 19, 68, 2, 0, 144, 0, 176, 186, 237, 206, 173, 186, 203, 170, 153, 0, 144, 136, 136, 34, 236, 139, 144, 234, 173, 152, 188, 154, 186, 169, 153, 16, 16, 71, 1, 50, 152, 136, 205, 187, 187, 185, 190, 16, 0, 50, 40, 55, 128, 52, 128, 2, 154, 168, 10, 208, 140, 19, 171, 51, 83, 20, 115, 21, 16, 161, 138, 184, 206, 154, 170, 188, 154, 219, 138, 170, 137, 160, 155, 67, 160, 25, 52, 35, 0, 136, 251, 10, 216, 27, 87, 2, 100, 20, 33, 18, 17, 128, 32, 130, 57, 36, 17, 152, 9, 8, 34, 251, 113, 130, 56, 4, 26, 21, 219, 9, 169, 188, 24, 131, 138, 70, 129, 16, 19, 32, 84, 51, 66, 51, 50, 53, 146, 137, 152, 155, 34, 96, 54, 33, 36, 8, 32, 128, 177, 159, 51, 251, 10, 129, 185, 156, 153, 11, 20, 138, 103, 1, 137, 33, 3, 187, 32, 201, 155, 170, 9, 176, 175, 84, 160, 26, 130, 203, 25, 168, 41, 146, 12, 22, 250, 172, 137, 8, 184, 73, 53, 128, 82, 34, 66, 19, 33, 52, 2, 144, 114, 3, 9, 36, 202, 25, 131, 9, 53, 0, 84, 3, 128, 1, 152, 187, 169, 170, 184, 255, 155, 219, 187, 8, 1, 32, 36, 200, 171, 234, 172, 170, 203, 137, 218, 173, 25, 160, 157, 32, 130, 186, 203, 10, 130, 191, 10, 217, 188, 185, 187, 154, 16, 152, 9, 251, 139, 144, 187, 25, 99, 36, 145, 41, 69, 168, 171, 32, 160, 58, 55, 169, 9, 201, 187, 205, 25, 136, 8, 217, 74, 162, 159, 1, 128, 136, 136, 64, 38, 129, 8, 169, 26, 50, 119, 83, 52, 17, 52, 129, 24, 1, 128, 170, 56, 4, 219, 9, 192, 189, 136, 40, 37, 152, 65, 36, 234, 10, 36, 32, 69, 3, 81, 20, 137, 83, 18, 17, 68, 34, 83, 35, 50, 37, 1, 32, 1, 0, 49, 52, 68, 34, 17, 2, 168, 155, 185, 173, 152, 203, 169, 218, 204, 205, 186, 203, 171, 169, 170, 187, 206, 203, 204, 172, 187, 172, 171, 187, 173, 187, 187, 172, 187, 188, 187, 188, 188, 203, 188, 203, 203, 187, 186, 187, 155, 8, 16, 49, 52, 1, 0, 136, 8, 81, 70, 129, 32, 18, 49, 168, 114, 36, 67, 18, 99, 19, 34, 131, 152, 204, 139, 217, 138, 136, 72, 37, 82, 36, 32, 50, 33, 19, 81, 53, 65, 52, 33, 52, 128, 152, 169, 16, 51, 69, 51, 68, 35, 34, 20, 16, 50, 184, 189, 8, 217, 156, 137, 8, 169, 156, 48, 70, 35, 49, 53, 2, 24, 0, 24, 36, 82, 68, 51, 20, 67, 129, 24, 2, 74, 55, 34, 69, 36, 2, 32, 3, 168, 171, 41, 55, 19, 81, 68, 17, 49, 118, 6, 30, 0, 35, 17, 50, 130, 40, 68, 18, 50, 147, 191, 73, 3, 203, 73, 38, 144, 138, 99, 4, 136, 48, 19, 202, 173, 136, 160, 206, 10, 128, 218, 138, 1, 170, 40, 161, 187, 204, 154, 168, 154, 40, 35, 114, 38, 129, 66, 146, 9, 34, 170, 72, 55, 34, 50, 54, 53, 130, 40, 53, 144, 33, 18, 19, 235, 137, 0, 216, 174, 16, 184, 26, 192, 27, 5, 221, 9, 1, 201, 187, 137, 1, 251, 171, 137, 201, 188, 136, 186, 9, 9, 130, 170, 144, 173, 251, 190, 171, 154, 1, 234, 154, 137, 1, 218, 25, 34, 99, 130, 9, 19, 152, 17, 217, 189, 156, 152, 171, 8, 203, 113, 146, 154, 1, 153, 97, 146, 188, 136, 201, 190, 170, 10, 1, 156, 35, 84, 21, 24, 51, 0, 1, 170, 49, 217, 137, 207, 24, 217, 140, 0, 33, 128, 81, 36, 50, 33, 67, 129, 115, 130, 16, 0, 115, 132, 24, 18, 50, 163, 175, 49, 51, 160, 12, 248, 190, 170, 203, 187, 171, 25, 50, 53, 17, 67, 19, 184, 205, 25, 34, 48, 69, 83, 52, 67, 35, 17, 51, 84, 37, 16, 83, 51, 18, 128, 33, 130, 17, 0, 115, 36, 67, 18, 1, 136, 32, 160, 158, 24, 128, 128, 220, 203, 188, 204, 172, 170, 154, 153, 136, 170, 169, 206, 203, 190, 187, 203, 187, 172, 170, 187, 188, 219, 170, 202, 186, 171, 186, 219, 170, 186, 190, 186, 187, 187, 173, 137, 8, 145, 138, 17, 32, 224, 157, 18, 216, 138, 8, 136, 185, 157, 152, 188, 155, 65, 37, 50, 85, 68, 18, 128, 16, 145, 172, 8, 49, 87, 50, 83, 36, 18, 32, 33, 136, 32, 51, 54, 52, 35, 34, 53, 145, 24, 35, 1, 114, 53, 130, 33, 147, 173, 137, 154, 48, 70, 51, 84, 19, 8, 128, 153, 184, 26, 69, 50, 54, 34, 34, 168, 169, 170, 24, 114, 71, 34, 18, 17, 152, 188, 155, 137, 34, 99, 69, 19, 17, 128, 169, 188, 155, 41, 52, 51, 55, 146, 172, 187, 204, 188, 24, 67, 84, 18, 0, 130, 218, 204, 170, 137, 137, 24, 18, 129, 202, 186, 188, 189, 171, 56, 51, 18, 0, 128, 253, 190, 170, 10, 152, 32, 53, 18, 152, 136, 217, 189, 156, 8, 128, 0, 49, 19, 136, 220, 138, 144, 10, 2, 113, 6, 9, 34, 16, 131, 155, 115, 144, 187, 154, 202, 156, 152, 137, 68, 4, 168, 32, 168, 252, 155, 128, 139, 34, 40, 54, 144, 9, 152, 238, 187, 48, 3, 97, 68, 67, 2, 168, 17, 192, 155, 48, 84, 67, 34, 128, 34, 249, 10, 0, 50, 68, 70, 3, 17, 17, 129, 235, 155, 152, 170, 16, 67, 53, 145, 16, 19, 201, 187, 41, 87, 129, 24, 18, 217, 205, 171, 186, 187, 137, 18, 144, 137, 251, 190, 203, 203, 172, 154, 170, 137, 160, 139, 1, 11, 34, 41, 119, 51, 67, 52, 67, 17, 34, 50, 153, 3, 32, 0, 53, 33, 115, 67, 34, 66, 51, 34, 67, 67, 51, 34, 82, 35, 0, 0, 17, 2, 16, 68, 18, 18, 185, 173, 251, 188, 187, 189, 202, 187, 203, 173, 203, 188, 154, 187, 188, 155, 153, 202, 189, 188, 203, 204, 187, 171, 187, 173, 170, 185, 202, 186, 170, 219, 203, 154, 169, 188, 170, 186, 220, 170, 152, 9, 136, 16, 52, 18, 33, 18, 129, 152, 153, 40, 53, 34, 102, 52, 1, 66, 53, 36, 66, 68, 50, 52, 51, 37, 17, 16, 17, 18, 16, 68, 50, 53, 51, 84, 36, 34, 51, 51, 50, 53, 19, 67, 35, 137, 66, 19, 170, 96, 52, 0, 66, 37, 18, 33, 144, 155, 0, 170, 24, 200, 72, 21, 203, 138, 136, 172, 138, 10, 102, 35, 67, 50, 34, 153, 48, 193, 206, 138, 0, 16, 53, 34, 85, 18, 144, 8, 36, 129, 32, 54, 2, 8, 49, 51, 234, 10, 35, 66, 83, 86, 36, 18, 50, 34, 50, 129, 187, 64, 177, 173, 16, 18, 1, 160, 173, 137, 222, 26, 36, 144, 138, 51, 176, 10, 17, 2, 66, 19, 154, 119, 55, 51, 18, 50, 84, 3, 24, 34, 1, 201, 172, 8, 251, 155, 136, 218, 154, 33, 18, 168, 187, 205, 236, 220, 170, 170, 171, 187, 172, 170, 219, 187, 170, 202, 187, 170, 186, 189, 155, 201, 205, 202, 187, 137, 201, 187, 9, 202, 155, 128, 171, 32, 83, 18, 49, 129, 137, 249, 188, 137, 65, 53, 68, 69, 51, 50, 36, 50, 18, 144, 33, 52, 19, 114, 19, 32, 67, 51, 35, 87, 18, 34, 20, 18, 17, 9, 32, 66, 19, 24, 103, 18, 0, 8, 0, 152, 24, 50, 17, 82, 37, 153, 33, 220, 25, 176, 156, 49, 18, 169, 114, 6, 168, 153, 137, 32, 32, 34, 185, 202, 222, 188, 221, 203, 154, 153, 170, 137, 169, 144, 207, 187, 219, 203, 171, 153, 169, 10, 35, 136, 136, 8, 1, 170, 203, 64, 55, 19, 100, 53, 2, 66, 35, 33, 67, 69, 34, 34, 52, 36, 50, 51, 33, 69, 18, 50, 36, 82, 51, 34, 50, 50, 34, 50, 52, 36, 17, 32, 33, 201, 189, 171, 171, 0, 221, 10, 232, 172, 202, 205, 186, 203, 187, 187, 188, 172, 171, 204, 187, 188, 204, 187, 172, 187, 188, 187, 188, 187, 187, 185, 156, 170, 186, 219, 187, 190, 188, 171, 171, 189, 154, 24, 144, 172, 48, 131, 204, 187, 48, 3, 139, 115, 83, 3, 48, 51, 50, 37, 65, 36, 66, 54, 36, 20, 33, 34, 18, 1, 65, 68, 18, 35, 69, 34, 50, 52, 50, 2, 17, 2, 25, 1, 40, 70, 130, 64, 52, 83, 68, 34, 18, 128, 32, 129, 153, 172, 96, 2, 24, 37, 83, 19, 154, 136, 219, 153, 32, 20, 65, 55, 19, 144, 8, 162, 172, 33, 49, 55, 50, 54, 34, 128, 24, 130, 189, 8, 169, 112, 21, 152, 48, 5, 202, 155, 24, 152, 188, 139, 99, 3, 22, 0, 184, 205, 137, 129, 185, 139, 100, 130, 10, 35, 187, 251, 190, 153, 10, 51, 136, 16, 32, 21, 219, 72, 34, 66, 19, 17, 160, 138, 201, 204, 205, 154, 136, 40, 1, 97, 52, 19, 17, 83, 34, 83, 3, 153, 49, 177, 191, 171, 97, 35, 32, 69, 68, 129, 9, 1, 186, 153, 10, 69, 35, 52, 18, 19, 252, 9, 0, 48, 50, 86, 18, 16, 129, 136, 219, 139, 152, 136, 153, 113, 4, 16, 152, 156, 201, 189, 137, 8, 67, 83, 146, 171, 144, 223, 154, 169, 137, 16, 17, 0, 185, 187, 204, 190, 137, 153, 9, 208, 174, 219, 155, 168, 186, 137, 82, 131, 190, 137, 169, 237, 172, 153, 153, 137, 24, 34, 129, 136, 217, 221, 172, 153, 136, 9, 34, 33, 20, 203, 154, 186, 189, 9, 49, 51, 50, 55, 34, 161, 175, 128, 156, 16, 16, 66, 67, 52, 67, 35, 50, 83, 1, 152, 48, 145, 174, 136, 185, 219, 171, 97, 52, 50, 70, 52, 17, 136, 136, 50, 249, 141, 1, 168, 9, 33, 66, 34, 67, 19, 152, 24, 53, 2, 49, 84, 52, 2, 204, 10, 176, 42, 53, 115, 68, 18, 18, 2, 186, 138, 184, 174, 136, 49, 54, 34, 129, 24, 20, 234, 24, 34, 16, 116, 51, 136, 65, 162, 171, 168, 139, 33, 18, 0, 116, 147, 189, 186, 188, 221, 171, 186, 171, 137, 137, 34, 2, 50, 53, 145, 154, 17, 251, 140, 66, 18, 66, 85, 67, 33, 17, 67, 51, 51, 52, 52, 51, 2, 49, 147, 12, 84, 2, 82, 37, 18, 18, 35, 128, 65, 161, 171, 168, 219, 205, 188, 204, 187, 187, 172, 155, 153, 33, 18, 192, 191, 187, 205, 204, 186, 187, 202, 203, 186, 170, 203, 155, 169, 169, 187, 136, 249, 205, 187, 187, 204, 172, 138, 137, 0, 16, 50, 18, 65, 2, 8, 176, 26, 132, 188, 236, 172, 152, 186, 154, 49, 67, 86, 35, 66, 51, 3, 0, 17, 16, 144, 25, 131, 9, 162, 122, 38, 48, 103, 34, 35, 17, 51, 160, 171, 153, 56, 147, 11, 55, 1, 98, 19, 0, 66, 3, 169, 48, 192, 171, 26, 195, 207, 33, 129, 17, 99, 36, 17, 49, 19, 168, 64, 52, 2, 24, 87, 36, 129, 136, 65, 37, 168, 48, 36, 18, 128, 32, 68, 1, 65, 37, 128, 0, 202, 42, 36, 169, 114, 21, 128, 33, 160, 10, 176, 157, 129, 219, 24, 193, 188, 8, 152, 187, 137, 83, 130, 220, 140, 217, 189, 153, 203, 155, 136, 65, 36, 129, 25, 160, 187, 202, 173, 65, 53, 18, 84, 35, 136, 9, 136, 8, 33, 101, 53, 36, 33, 51, 34, 169, 58, 53, 144, 96, 69, 18, 128, 16, 34, 161, 156, 64, 19, 186, 26, 2, 203, 203, 57, 2, 139, 68, 163, 223, 137, 251, 203, 169, 136, 8, 152, 40, 36, 200, 170, 185, 220, 219, 170, 138, 24, 0, 65, 51, 184, 10, 51, 249, 173, 64, 1, 27, 0, 24, 17, 0, 33, 50, 36, 235, 25, 184, 157, 137, 98, 36, 50, 54, 19, 152, 185, 205, 202, 188, 9, 1, 152, 64, 38, 1, 8, 0, 136, 128, 154, 185, 175, 153, 204, 154, 169, 73, 69, 34, 50, 53, 18, 128, 154, 234, 173, 170, 153, 170, 41, 52, 51, 53, 0, 65, 177, 158, 129, 251, 187, 203, 154, 138, 9, 64, 36, 16, 68, 34, 129, 152, 170, 187, 238, 187, 171, 203, 204, 172, 169, 185, 154, 32, 161, 188, 9, 145, 203, 0, 152, 185, 155, 155, 102, 129, 24, 200, 72, 20, 65, 36, 49, 87, 1, 0, 50, 18, 32, 20, 48, 71, 2, 49, 19, 64, 68, 36, 50, 52, 34, 34, 152, 72, 131, 170, 81, 51, 34, 67, 70, 18, 153, 136, 170, 144, 204, 56, 146, 222, 187, 170, 188, 169, 154, 17, 169, 203, 188, 252, 188, 136, 169, 152, 220, 137, 235, 171, 187, 139, 136, 32, 37, 67, 34, 136, 186, 220, 220, 10, 136, 137, 128, 56, 129, 170, 219, 40, 177, 140, 19, 24, 38, 250, 154, 144, 202, 155, 32, 34, 147, 206, 153, 168, 174, 72, 53, 18, 51, 52, 161, 171, 204, 11, 200, 13, 67, 99, 18, 16, 1, 0, 169, 140, 82, 130, 32, 1, 144, 206, 138, 153, 9, 114, 53, 36, 35, 145, 136, 0, 202, 138, 99, 53, 53, 2, 16, 19, 200, 172, 155, 16, 1, 34, 35, 3, 190, 153, 222, 170, 169, 25, 129, 172, 137, 202, 205, 188, 137, 17, 34, 66, 53, 146, 156, 168, 220, 186, 154, 0, 144, 32, 19, 200, 204, 189, 203, 202, 154, 8, 49, 1, 24, 144, 186, 186, 188, 96, 39, 17, 84, 18, 33, 83, 35, 18, 84, 2, 17, 129, 168, 172, 8, 25, 86, 50, 69, 35, 17, 17, 185, 189, 154, 186, 9, 99, 53, 35, 18, 17, 184, 174, 16, 0, 98, 36, 0, 154, 219, 203, 188, 170, 24, 85, 35, 49, 51, 146, 220, 219, 154, 170, 154, 65, 52, 129, 33, 21, 168, 172, 9, 83, 2, 25, 51, 192, 190, 187, 172, 170, 49, 54, 35, 34, 20, 217, 170, 186, 154, 32, 50, 71, 19, 137, 136, 251, 154, 137, 66, 37, 34, 52, 19, 186, 189, 172, 171, 203, 138, 50, 146, 137, 192, 207, 203, 153, 152, 185, 9, 36, 144, 138, 136, 233, 172, 32, 0, 33, 33, 83, 52, 0, 81, 68, 36, 35, 52, 52, 18, 0, 48, 20, 185, 88, 69, 35, 19, 32, 69, 2, 153, 56, 37, 153, 10, 34, 160, 190, 139, 128, 206, 138, 16, 185, 156, 169, 205, 203, 171, 171, 187, 188, 172, 219, 188, 219, 188, 171, 187, 186, 137, 1, 128, 168, 205, 204, 187, 235, 187, 154, 168, 169, 8, 2, 160, 189, 24, 146, 64, 54, 51, 35, 2, 236, 171, 205, 170, 169, 10, 34, 98, 53, 2, 168, 72, 19, 202, 10, 67, 145, 154, 16, 129, 203, 137, 170, 114, 53, 99, 34, 82, 120, 247, 32, 0, 36, 17, 136, 24, 152, 202, 171, 80, 19, 32, 52, 36, 50, 54, 51, 37, 145, 1, 200, 203, 204, 137, 153, 138, 25, 53, 1, 82, 51, 52, 1, 50, 53, 2, 170, 218, 174, 170, 188, 154, 186, 32, 83, 67, 69, 1, 48, 131, 220, 170, 186, 203, 187, 154, 8, 0, 114, 71, 18, 34, 36, 2, 34, 50, 34, 17, 0, 160, 171, 114, 53, 19, 33, 115, 20, 33, 52, 35, 18, 128, 24, 217, 188, 155, 234, 157, 0, 136, 49, 83, 37, 2, 2, 186, 187, 207, 170, 188, 138, 170, 153, 48, 20, 136, 2, 136, 184, 29, 23, 169, 184, 174, 169, 171, 186, 9, 208, 26, 20, 169, 48, 66, 51, 87, 19, 51, 131, 24, 185, 187, 206, 138, 0, 68, 17, 100, 35, 34, 130, 170, 217, 189, 171, 170, 153, 40, 35, 35, 51, 68, 67, 69, 2, 40, 192, 156, 217, 173, 203, 138, 1, 24, 17, 48, 68, 129, 32, 2, 24, 70, 18, 98, 2, 48, 2, 186, 186, 204, 172, 65, 53, 52, 34, 129, 168, 221, 188, 203, 154, 0, 0, 17, 128, 34, 1, 17, 184, 170, 187, 251, 191, 171, 221, 154, 153, 153, 9, 86, 34, 34, 128, 160, 219, 220, 170, 168, 219, 137, 0, 136, 8, 129, 24, 3, 169, 250, 207, 8, 144, 25, 51, 144, 48, 22, 137, 1, 48, 71, 35, 83, 35, 34, 1, 152, 169, 204, 137, 50, 69, 35, 33, 33, 83, 145, 10, 18, 11, 39, 218, 25, 192, 171, 1, 153, 113, 67, 52, 34, 34, 129, 234, 171, 203, 189, 154, 186, 175, 9, 153, 137, 153, 136, 168, 172, 203, 187, 205, 187, 203, 188, 10, 130, 10, 82, 51, 208, 173, 138, 0, 185, 58, 87, 18, 136, 153, 185, 188, 205, 25, 17, 8, 0, 136, 250, 172, 152, 153, 16, 99, 19, 137, 33, 145, 170, 8, 168, 10, 36, 131, 255, 154, 201, 155, 219, 27, 37, 82, 53, 18, 2, 184, 204, 171, 186, 10, 82, 36, 34, 50, 17, 19, 201, 40, 208, 156, 153, 152, 188, 41, 20, 251, 26, 19, 49, 70, 67, 34, 33, 1, 17, 233, 10, 145, 188, 25, 192, 12, 55, 144, 64, 52, 17, 33, 18, 65, 130, 154, 18, 202, 80, 67, 67, 83, 52, 17, 50, 36, 35, 145, 138, 152, 173, 56, 53, 49, 70, 36, 2, 170, 136, 202, 137, 169, 80, 2, 128, 251, 204, 219, 187, 186, 171, 154, 49, 36, 34, 160, 239, 154, 170, 156, 16, 17, 65, 35, 32, 2, 185, 26, 70, 35, 83, 35, 129, 202, 190, 188, 153, 24, 17, 49, 53, 129, 65, 19, 0, 35, 17, 130, 238, 170, 170, 32, 86, 51, 51, 51, 50, 52, 52, 53, 51, 1, 200, 221, 188, 154, 169, 9, 66, 18, 67, 36, 0, 18, 136, 201, 207, 155, 186, 173, 138, 0, 128, 49, 52, 35, 67, 19, 33, 35, 70, 132, 186, 170, 204, 204, 154, 136, 153, 144, 169, 117, 2, 25, 0, 137, 33, 82, 19, 186, 234, 219, 219, 11, 1, 170, 114, 20, 32, 53, 34, 51, 130, 152, 234, 187, 139, 33, 202, 41, 208, 174, 0, 169, 56, 132, 138, 1, 239, 187, 153, 204, 154, 136, 169, 24, 66, 145, 205, 155, 144, 204, 154, 8, 144, 187, 138, 16, 145, 113, 103, 0, 16, 19, 152, 17, 18, 153, 0, 184, 40, 192, 43, 22, 40, 71, 129, 24, 4, 170, 17, 251, 140, 0, 0, 34, 36, 33, 20, 153, 84, 18, 33, 36, 0, 136, 205, 153, 251, 203, 153, 170, 9, 35, 24, 71, 146, 24, 18, 218, 170, 218, 139, 160, 156, 49, 3, 82, 54, 19, 33, 2, 168, 136, 169, 170, 171, 9, 68, 101, 68, 19, 1, 1, 152, 136, 186, 42, 38, 1, 202, 154, 235, 172, 152, 136, 0, 185, 43, 21, 251, 155, 16, 168, 185, 190, 58, 22, 186, 41, 68, 35, 168, 96, 20, 169, 173, 24, 200, 189, 9, 136, 168, 9, 115, 2, 9, 18, 153, 17, 222, 26, 130, 203, 138, 144, 187, 56, 129, 80, 37, 8, 18, 234, 25, 129, 187, 128, 239, 170, 202, 171, 24, 48, 87, 35, 16, 83, 1, 9, 8, 153, 0, 152, 9, 2, 116, 22, 128, 66, 1, 25, 19, 152, 0, 185, 41, 241, 190, 10, 128, 204, 57, 69, 129, 0, 17, 144, 186, 137, 170, 10, 50, 84, 129, 10, 67, 131, 80, 71, 1, 40, 130, 219, 171, 204, 170, 186, 138, 35, 33, 85, 52, 144, 81, 19, 64, 52, 145, 9, 176, 172, 153, 9, 48, 103, 1, 48, 52, 16, 1, 144, 235, 205, 171, 137, 169, 41, 36, 18, 16, 1, 82, 147, 158, 50, 248, 138, 0, 170, 136, 152, 0, 200, 139, 36, 168, 98, 51, 51, 67, 224, 189, 186, 173, 17, 169, 113, 4, 153, 16, 176, 139, 16, 8, 33, 50, 52, 19, 233, 172, 8, 248, 141, 33, 128, 65, 70, 2, 9, 128, 205, 169, 186, 25, 0, 17, 49, 54, 217, 138, 152, 186, 171, 48, 201, 80, 161, 11, 200, 221, 203, 171, 172, 25, 145, 11, 71, 2, 0, 32, 51, 128, 170, 24, 131, 219, 188, 16, 144, 139, 113, 54, 144, 112, 3, 136, 1, 128, 169, 187, 235, 140, 160, 174, 40, 17, 17, 33, 69, 18, 128, 17, 145, 203, 187, 137, 168, 255, 25, 130, 187, 9, 33, 33, 34, 1, 117, 147, 188, 137, 218, 188, 25, 129, 138, 65, 36, 51, 67, 83, 20, 136, 1, 185, 203, 188, 144, 188, 9, 8, 83, 35, 51, 70, 35, 33, 168, 40, 241, 172, 128, 203, 187, 138, 169, 10, 49, 39, 137, 83, 33, 36, 160, 8, 217, 172, 187, 188, 203, 171, 0, 236, 10, 83, 67, 50, 68, 3, 137, 0, 234, 156, 136, 185, 138, 1, 49, 1, 117, 2, 48, 130, 25, 144, 154, 234, 173, 10, 201, 171, 32, 33, 35, 84, 53, 1, 16, 129, 50, 225, 11, 3, 188, 170, 203, 187, 202, 253, 20, 0, 154, 41, 87, 34, 52, 21, 16, 1, 168, 169, 153, 201, 90, 22, 154, 66, 1, 17, 0, 115, 129, 40, 50, 2, 187, 25, 252, 171, 187, 72, 20, 33, 69, 19, 152, 137, 153, 32, 129, 41, 36, 144, 236, 190, 172, 171, 170, 41, 53, 16, 83, 19, 17, 168, 155, 33, 145, 204, 56, 131, 223, 139, 33, 216, 156, 65, 37, 145, 10, 83, 160, 235, 138, 17, 201, 154, 50, 161, 138, 99, 35, 169, 42, 38, 176, 10, 36, 232, 172, 8, 17, 184, 140, 66, 161, 155, 0, 16, 129, 169, 207, 16, 208, 26, 68, 128, 154, 56, 22, 184, 155, 16, 176, 189, 24, 144, 187, 156, 17, 186, 41, 18, 69, 192, 64, 20, 128, 152, 49, 22, 185, 10, 18, 248, 191, 40, 145, 153, 128, 41, 146, 43, 54, 129, 67, 51, 2, 219, 40, 145, 221, 10, 66, 168, 155, 66, 2, 171, 40, 1, 17, 169, 71, 200, 41, 193, 139, 224, 171, 1, 0, 36, 33, 53, 162, 26, 1, 8, 176, 12, 49, 202, 25, 21, 152, 8, 65, 144, 12, 32, 187, 16, 145, 144, 171, 16, 17, 169, 57, 4, 16, 67, 129, 27, 19, 153, 17, 0, 49, 2, 9, 33, 1, 25, 33, 1, 1, 9, 0, 144, 0, 153, 9, 0, 0, 1, 17, 146, 10, 145, 153, 153, 25, 146, 9, 1, 0, 0, 17, 145, 153, 1, 25, 1, 153, 16, 16, 144, 9, 17, 144, 25, 144, 0, 0, 16, 145, 25, 0, 16, 0, 9, 9, 1, 0, 0, 9, 0, 0, 16, 0, 9, 0, 0, 1, 9, 0, 0, 0, 0, 16, 0, 144, 0, 1, 9, 16, 0, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 0, 0, 0, 0, 0, 1, 0, 0, 9, 0, 0, 1, 0, 0, 0, 0, 9, 0, 0, 1, 144, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
-static const size_t audio_ten_sample_data_length = sizeof(audio_ten_sample_data) / sizeof(audio_ten_sample_data[0]);
+static const size_t audio_ten_sample_data_length = 21979;
@@ -1,4 +1,4 @@
-// This file was generated by a script on 20-11-2024 08:37:37
+// This file was generated by a script on 17-10-2026 14:19:02
 
 #pragma once
 
@@ -6,6 +6,7 @@
 #include <stdint.h>
 #include <pico/platform/sections.h>
 
-static const int16_t __in_flash("audio_thirty_sample_data") audio_thirty_sample_data[] = { -130, -150, -318, -623, -676, -225, 395, 650, 384, -93, -317, -83, 274, 241, -142, -275, 105, 516, 456, 110, -23, 116, 178, 16, -117, -59, 39, 31, -29, -108, -247, -342, -256, -74, 31, 53, 17, -63, -10, 298, 522, 312, 9, 142, 492, 472, 112, -103, -17, 179, 337, 328, 88, -157, -112, 98, 131, 9, 9, 125, 105, -48, -73, 61, 39, -289, -601, -538, -205, 31, 75, 120, 264, 384, 339, 134, -93, -183, -106, 4, 35, 29, 77, 148, 152, 87, 23, -8, -39, -90, -94, 42, 277, 381, 217, -47, -150, -111, -112, -116, 82, 453, 686, 608, 379, 198, 40, -164, -311, -276, -143, -59, -14, 44, 49, -40, -119, -143, -241, -443, -545, -420, -296, -388, -493, -266, 142, 249, -1, -161, -16, 196, 317, 409, 396, 153, -128, -174, -84, -141, -378, -629, -722, -521, -98, 155, -25, -374, -465, -251, 61, 342, 499, 451, 303, 255, 284, 224, 106, 113, 220, 198, 20, -77, -62, -225, -581, -669, -321, -36, -126, -169, 149, 401, 211, -76, -88, -37, -151, -127, 301, 775, 780, 392, 133, 187, 149, -290, -728, -573, -37, 78, -327, -503, -154, 88, -153, -440, -429, -334, -234, 68, 380, 280, -71, -120, 146, 225, 0, -106, 20, -58, -430, -500, -55, 197, -179, -606, -544, -225, 88, 369, 273, -325, -613, -33, 634, 754, 978, 1591, 1502, 264, -753, -460, 372, 612, 356, 214, 160, -99, -400, -403, -251, -357, -683, -737, -276, 410, 927, 1071, 802, 274, -158, -256, -107, 99, 272, 354, 319, 252, 211, 89, -194, -485, -566, -393, -44, 423, 857, 964, 630, 232, 289, 792, 1145, 939, 456, 211, 201, 40, -281, -382, -235, -203, -233, 133, 709, 669, -48, -389, 224, 883, 528, -460, -941, -748, -644, -819, -690, -234, -191, -685, -874, -344, 231, 183, -273, -560, -496, -312, -235, -241, -147, 47, 97, -126, -392, -441, -341, -286, -267, -177, -92, -151, -221, -53, 237, 287, 148, 271, 623, 532, -238, -897, -677, -5, 143, -272, -435, -164, -202, -774, -1040, -492, 218, 429, 388, 532, 725, 684, 481, 339, 383, 591, 756, 645, 394, 390, 649, 694, 244, -324, -502, -334, -174, -30, 298, 595, 445, -1, -220, -205, -403, -810, -910, -567, -265, -267, -251, -106, -382, -1294, -1913, -1301, -26, 508, 0, -528, -185, 774, 1301, 672, -499, -937, -692, -1014, -1769, -1412, -132, 95, -720, -469, 938, 1356, 654, 1014, 2627, 3133, 1909, 1272, 2492, 3659, 2979, 1621, 1320, 1373, 485, -351, 263, 1210, 735, -391, -408, 398, 613, 172, -30, 205, 483, 677, 886, 1108, 1283, 1336, 1236, 1053, 771, 284, -85, 244, 993, 1162, 758, 770, 1076, 521, -647, -981, -480, -327, -410, 46, 385, -197, -729, -304, 85, -447, -1026, -864, -528, -447, -282, -58, -136, -272, -130, -52, -301, -571, -802, -1299, -1882, -2067, -1910, -1646, -1120, -483, -434, -940, -962, -177, 371, -61, -858, -1067, -555, 51, 17, -695, -1158, -684, -15, -137, -548, -281, 159, -222, -975, -1102, -888, -1128, -1715, -2092, -1964, -1228, -415, -590, -1487, -1371, -62, 437, -394, -623, 341, 724, 70, 60, 983, 1156, 202, -344, 108, 447, -109, -1055, -1552, -1329, -824, -672, -817, -653, -286, -401, -649, -3, 1089, 1196, 478, 287, 592, 428, 39, 91, 137, -32, 407, 1283, 1255, 597, 1002, 2272, 2584, 1859, 1591, 1932, 1850, 1290, 831, 243, -852, -1935, -2187, -1348, 284, 1834, 2199, 1325, 595, 1166, 2500, 3185, 2648, 1558, 968, 1321, 2030, 2015, 895, -498, -1072, -745, -361, -473, -737, -631, -304, -275, -608, -863, -794, -605, -467, -295, -195, -552, -1342, -1872, -1688, -1266, -1229, -1383, -1235, -1045, -1512, -2470, -2811, -1970, -729, -123, -195, -357, -382, -397, -468, -657, -992, -1172, -930, -615, -634, -690, -420, -194, -411, -699, -606, -358, -303, -369, -469, -711, -986, -979, -600, -65, 221, -190, -1191, -1797, -1290, -355, -76, -244, 103, 894, 1122, 600, 234, 428, 437, -222, -750, -288, 574, 550, -461, -1327, -1433, -1410, -1856, -2284, -1894, -806, 151, 610, 918, 1379, 1829, 2049, 2068, 2028, 2002, 1952, 1866, 1994, 2481, 2671, 1642, -217, -1328, -1067, -394, -13, 543, 1483, 2044, 1893, 1880, 2426, 2441, 1213, 197, 881, 1924, 1174, -559, -1017, -468, -493, -558, 402, 1153, 562, 210, 1426, 2647, 2371, 1688, 1798, 1880, 1017, -88, -516, -488, -526, -509, -214, 20, -141, -344, -129, 244, 335, 402, 864, 1327, 1123, 439, 64, 225, 375, 0, -877, -1929, -2822, -3256, -3174, -2948, -2934, -2863, -2234, -1160, -176, 514, 868, 581, -298, -892, -554, 91, 83, -414, -456, 150, 586, 284, -341, -642, -616, -604, -518, -45, 589, 690, 50, -750, -1145, -1113, -756, -115, 320, -108, -1085, -1434, -811, -211, -447, -1108, -1317, -742, 231, 871, 889, 876, 1316, 1485, 539, -805, -1227, -934, -1151, -1941, -2243, -1776, -1394, -1608, -1889, -1521, -571, 159, 61, -539, -703, -38, 747, 719, -65, -655, -525, -243, -516, -1101, -1258, -869, -465, -378, -458, -464, -291, 61, 417, 459, 93, -352, -559, -637, -811, -879, -556, -195, -442, -1166, -1472, -999, -438, -487, -862, -821, -235, 377, 641, 618, 457, 288, 305, 469, 361, -156, -551, -405, -32, 169, 338, 638, 845, 788, 668, 659, 667, 531, 169, -297, -498, -272, -97, -378, -616, -164, 593, 794, 453, 240, 322, 334, 163, 19, 68, 345, 706, 827, 590, 298, 166, 64, -8, 127, 333, 408, 680, 1351, 1713, 1168, 500, 800, 1657, 1748, 836, 1, 9, 490, 757, 671, 449, 196, -43, -122, -36, -5, -68, 58, 487, 925, 1100, 1066, 930, 676, 360, 167, 187, 295, 349, 357, 407, 469, 388, 140, -9, 216, 692, 997, 922, 683, 559, 593, 709, 873, 1001, 885, 449, -45, -268, -229, -175, -119, 228, 940, 1585, 1692, 1335, 1007, 974, 984, 691, 194, -75, 6, 62, -191, -547, -764, -950, -1192, -1223, -893, -526, -445, -495, -426, -355, -453, -492, -189, 194, 166, -195, -382, -369, -651, -1301, -1716, -1590, -1388, -1532, -1696, -1402, -825, -478, -385, -146, 239, 242, -350, -984, -1076, -821, -730, -726, -382, 142, 247, -83, -223, 45, 214, -58, -437, -563, -612, -816, -950, -765, -506, -471, -453, -238, -199, -628, -996, -703, -79, 159, 44, 116, 424, 530, 377, 462, 1047, 1743, 2079, 2046, 1855, 1614, 1416, 1323, 1168, 839, 615, 764, 1027, 1074, 1081, 1325, 1622, 1672, 1581, 1581, 1563, 1382, 1311, 1642, 2032, 1979, 1768, 2039, 2531, 2408, 1780, 1605, 2018, 2137, 1696, 1526, 2081, 2648, 2541, 2132, 2110, 2324, 2129, 1584, 1450, 1939, 2253, 1784, 1090, 1061, 1673, 2288, 2735, 3205, 3458, 3097, 2503, 2470, 2878, 2729, 1818, 1234, 1552, 1753, 1058, 514, 1169, 1954, 1381, 127, -199, 278, 319, -167, -338, -112, -129, -492, -668, -431, -123, -56, -151, -280, -528, -956, -1449, -1858, -2027, -1809, -1416, -1375, -1727, -1878, -1652, -1629, -2034, -2284, -2020, -1641, -1466, -1297, -1105, -1309, -1955, -2343, -2010, -1532, -1636, -2048, -2093, -1943, -2261, -2983, -3524, -3761, -3884, -3776, -3387, -3177, -3516, -4123, -4487, -4387, -3807, -2890, -2116, -2044, -2578, -2890, -2431, -1659, -1312, -1387, -1463, -1445, -1281, -783, -372, -937, -2305, -3239, -3341, -3385, -3582, -3293, -2677, -2719, -3430, -3680, -3036, -2398, -2486, -2773, -2414, -1443, -543, -88, -24, -324, -896, -1280, -1082, -695, -895, -1652, -2055, -1651, -1119, -1211, -1791, -2458, -3232, -4003, -4178, -3604, -3001, -2947, -3200, -3361, -3354, -3102, -2523, -1936, -1847, -2272, -2730, -2849, -2734, -2774, -3156, -3532, -3306, -2378, -1410, -1152, -1582, -2009, -2037, -1987, -2192, -2421, -2457, -2611, -3018, -3154, -2738, -2360, -2515, -2868, -2963, -2755, -2292, -1777, -1766, -2312, -2539, -1988, -1451, -1568, -1809, -1655, -1511, -1736, -1962, -1931, -1977, -2266, -2459, -2420, -2511, -2918, -3240, -3118, -2867, -3039, -3582, -4004, -4321, -5193, -6899, -8714, -9759, -10102, -10509, -11196, -11365, -10092, -7286, -3713, -278, 2614, 5186, 7901, 10812, 13357, 14916, 15553, 15945, 16503, 16776, 16088, 14676, 13746, 14046, 14817, 14710, 13588, 12799, 13389, 14730, 15452, 15367, 15569, 16806, 18529, 19873, 20754, 21535, 22231, 22657, 23037, 23735, 24552, 24883, 24650, 24534, 25034, 25891, 26596, 27059, 27480, 27877, 28055, 27784, 26939, 25591, 24010, 22366, 20534, 18283, 15672, 13150, 11276, 10235, 9592, 8744, 7636, 6929, 7147, 7939, 8482, 8519, 8554, 8919, 9157, 8681, 7648, 6646, 5806, 4697, 3037, 1082, -848, -2712, -4518, -6133, -7573, -9086, -10660, -11879, -12550, -13050, -13682, -14215, -14414, -14550, -14959, -15445, -15590, -15452, -15498, -15910, -16316, -16265, -15687, -14801, -13905, -13275, -12935, -12573, -11884, -11065, -10615, -10800, -11512, -12436, -13252, -13856, -14449, -15200, -15939, -16403, -16601, -16660, -16489, -15941, -15098, -14156, -13108, -11826, -10347, -8841, -7341, -5803, -4398, -3380, -2646, -1870, -1133, -867, -1105, -1364, -1358, -1268, -1289, -1396, -1533, -1655, -1700, -1693, -1741, -1768, -1614, -1335, -1140, -1098, -1180, -1381, -1544, -1371, -865, -439, -351, -389, -240, 112, 461, 630, 583, 417, 248, 19, -432, -1087, -1752, -2367, -3137, -4202, -5369, -6311, -6983, -7652, -8546, -9577, -10487, -11154, -11636, -11975, -12134, -12153, -12163, -12199, -12223, -12288, -12444, -12479, -12139, -11634, -11460, -11747, -12149, -12359, -12374, -12354, -12480, -12873, -13414, -13831, -14002, -14012, -13934, -13817, -13762, -13729, -13542, -13185, -12834, -12485, -11968, -11356, -10881, -10455, -9720, -8621, -7482, -6515, -5635, -4756, -3965, -3284, -2613, -2004, -1694, -1645, -1453, -960, -508, -338, -167, 229, 600, 695, 751, 1098, 1652, 2101, 2381, 2638, 2951, 3329, 3872, 4629, 5360, 5812, 6120, 6587, 7181, 7626, 7803, 7713, 7324, 6811, 6544, 6561, 6466, 6050, 5594, 5429, 5566, 5752, 5654, 5163, 4621, 4349, 4071, 3387, 2590, 2188, 1988, 1553, 1103, 1035, 1106, 961, 833, 980, 1037, 588, -162, -791, -1251, -1713, -2190, -2587, -2940, -3382, -3918, -4359, -4560, -4631, -4795, -5085, -5341, -5540, -5805, -6098, -6194, -6044, -5891, -5866, -5781, -5445, -4945, -4487, -4127, -3804, -3517, -3352, -3364, -3460, -3445, -3217, -2884, -2619, -2459, -2289, -2007, -1616, -1253, -1108, -1191, -1258, -1148, -1049, -1158, -1264, -1036, -505, 54, 552, 1059, 1609, 2228, 2949, 3623, 3954, 3859, 3592, 3443, 3464, 3535, 3531, 3371, 3061, 2787, 2796, 3046, 3135, 2781, 2184, 1680, 1278, 813, 301, -104, -303, -264, -30, 264, 611, 1154, 1795, 2061, 1693, 1055, 665, 588, 524, 236, -305, -932, -1343, -1342, -1089, -988, -1298, -1923, -2590, -3112, -3475, -3788, -4191, -4730, -5238, -5479, -5445, -5361, -5306, -5063, -4465, -3718, -3177, -2909, -2690, -2375, -2056, -1828, -1630, -1363, -934, -223, 715, 1499, 1814, 1886, 2124, 2468, 2466, 1899, 940, -74, -885, -1479, -2085, -2742, -3068, -2790, -2207, -1730, -1349, -913, -446, 125, 977, 1949, 2630, 3014, 3487, 4176, 4851, 5340, 5608, 5590, 5275, 4737, 3945, 2847, 1543, 129, -1412, -2801, -3481, -3343, -2729, -1533, 802, 4159, 7644, 10794, 13940, 17220, 20179, 22423, 24033, 25174, 25898, 26270, 26393, 26335, 26138, 25883, 25633, 25379, 24966, 24171, 22944, 21601, 20560, 19958, 19693, 19709, 19993, 20435, 21035, 22018, 23423, 24833, 25769, 26227, 26485, 26680, 26824, 26968, 27183, 27440, 27655, 27767, 27844, 28062, 28454, 28705, 28466, 27775, 26876, 25744, 24169, 22176, 19979, 17698, 15337, 12964, 10692, 8646, 7023, 5919, 5119, 4367, 3755, 3555, 3792, 4251, 4694, 5002, 5183, 5398, 5698, 5822, 5533, 4961, 4292, 3357, 1935, 150, -1741, -3725, -5891, -8105, -10129, -11899, -13458, -14732, -15589, -16073, -16360, -16470, -16280, -15789, -15172, -14511, -13724, -12842, -12050, -11413, -10704, -9757, -8779, -8058, -7525, -6952, -6390, -6010, -5756, -5604, -5771, -6277, -6728, -6960, -7254, -7714, -8070, -8290, -8585, -8788, -8499, -7812, -7152, -6557, -5731, -4607, -3333, -1914, -279, 1424, 2906, 4056, 4996, 5839, 6555, 7067, 7306, 7174, 6689, 6089, 5545, 4911, 4065, 3236, 2600, 1928, 1013, 73, -617, -1150, -1669, -2041, -2148, -2178, -2322, -2402, -2125, -1615, -1319, -1472, -1867, -2239, -2611, -3141, -3868, -4731, -5723, -6818, -7937, -9055, -10262, -11601, -12942, -14187, -15479, -16986, -18586, -20045, -21352, -22625, -23847, -24864, -25612, -26090, -26314, -26371, -26361, -26283, -26073, -25758, -25401, -24981, -24464, -23950, -23566, -23292, -22975, -22587, -22242, -21977, -21701, -21391, -21200, -21141, -21041, -20861, -20784, -20883, -20956, -20826, -20521, -20096, -19493, -18681, -17735, -16680, -15445, -13926, -12160, -10363, -8781, -7417, -6074, -4686, -3385, -2281, -1328, -559, -52, 333, 892, 1630, 2237, 2492, 2469, 2336, 2210, 2114, 1938, 1547, 1005, 542, 255, 49, -121, -156, -5, 231, 479, 808, 1245, 1644, 1905, 2143, 2432, 2601, 2532, 2446, 2544, 2642, 2458, 2048, 1634, 1220, 673, 17, -625, -1321, -2206, -3154, -3854, -4279, -4755, -5447, -6076, -6308, -6196, -6022, -5906, -5718, -5315, -4733, -4170, -3760, -3430, -3046, -2625, -2276, -1993, -1678, -1349, -1132, -1068, -1052, -1011, -999, -1056, -1124, -1186, -1349, -1644, -1873, -1814, -1503, -1112, -692, -174, 452, 1142, 1946, 2931, 3985, 4868, 5537, 6209, 7026, 7814, 8316, 8545, 8726, 8938, 9048, 8998, 8918, 8898, 8849, 8710, 8608, 8637, 8725, 8795, 8864, 8923, 8933, 8960, 9083, 9249, 9362, 9445, 9525, 9546, 9510, 9533, 9629, 9664, 9552, 9330, 9036, 8673, 8301, 7965, 7601, 7103, 6487, 5869, 5324, 4828, 4343, 3890, 3485, 3067, 2571, 2052, 1665, 1437, 1180, 734, 180, -329, -757, -1091, -1292, -1457, -1781, -2211, -2463, -2505, -2611, -2917, -3260, -3536, -3837, -4198, -4526, -4787, -5027, -5252, -5398, -5428, -5352, -5216, -5082, -4975, -4873, -4769, -4691, -4638, -4551, -4399, -4221, -4061, -3880, -3592, -3167, -2691, -2282, -1964, -1660, -1305, -953, -723, -652, -627, -553, -525, -673, -848, -758, -417, -128, 22, 267, 709, 1169, 1539, 1865, 2139, 2332, 2548, 2896, 3371, 3967, 4668, 5279, 5668, 6082, 6832, 7723, 8280, 8383, 8235, 7922, 7361, 6605, 5876, 5378, 5108, 4837, 4397, 4062, 4305, 5076, 5767, 6057, 6241, 6604, 7022, 7319, 7536, 7680, 7609, 7354, 7226, 7316, 7284, 6982, 6815, 6921, 6682, 5818, 5097, 4982, 4713, 3783, 2976, 2805, 2499, 1586, 885, 1046, 1529, 1650, 1411, 1013, 562, 262, 96, -376, -1441, -2873, -4393, -5908, -7213, -8001, -8188, -7780, -6635, -4648, -1841, 1829, 6226, 10667, 14496, 17842, 21050, 23733, 25284, 25795, 25734, 25200, 24124, 22719, 21283, 20035, 19189, 18571, 17539, 15875, 14369, 13764, 13692, 13385, 12989, 13331, 14626, 16292, 17980, 20026, 22618, 25150, 26863, 27743, 28294, 28736, 28919, 28772, 28383, 27666, 26506, 25149, 24090, 23356, 22428, 21009, 19449, 18142, 16890, 15272, 13331, 11462, 9749, 7855, 5607, 3325, 1455, 15, -1234, -2260, -2719, -2538, -2087, -1643, -1054, -260, 426, 801, 1083, 1410, 1423, 754, -367, -1466, -2547, -4035, -6071, -8328, -10538, -12726, -14871, -16848, -18730, -20693, -22502, -23591, -23808, -23571, -23207, -22506, -21176, -19323, -17248, -14993, -12517, -10040, -7879, -6041, -4395, -3106, -2466, -2418, -2600, -2790, -3038, -3471, -4085, -4736, -5308, -5881, -6635, -7506, -8159, -8442, -8646, -9124, -9749, -10015, -9652, -8863, -7904, -6769, -5376, -3823, -2205, -445, 1479, 3343, 4907, 6200, 7331, 8171, 8504, 8424, 8205, 7829, 7038, 5888, 4740, 3696, 2449, 878, -763, -2282, -3801, -5449, -7091, -8503, -9624, -10570, -11401, -11919, -11845, -11228, -10463, -9816, -9134, -8237, -7320, -6718, -6527, -6624, -6948, -7562, -8465, -9557, -10753, -12071, -13588, -15294, -17041, -18680, -20209, -21678, -23058, -24276, -25323, -26199, -26845, -27251, -27537, -27785, -27895, -27698, -27159, -26374, -25414, -24316, -23104, -21840, -20531, -19152, -17755, -16508, -15576, -14933, -14406, -13878, -13403, -13034, -12699, -12327, -11973, -11725, -11523, -11255, -10944, -10732, -10698, -10717, -10529, -10000, -9229, -8363, -7337, -6014, -4483, -2940, -1335, 543, 2638, 4581, 6155, 7477, 8690, 9684, 10310, 10614, 10723, 10612, 10192, 9577, 9005, 8520, 7940, 7174, 6386, 5756, 5206, 4487, 3500, 2401, 1419, 649, 12, -604, -1172, -1481, -1382, -1015, -627, -233, 285, 847, 1225, 1369, 1384, 1288, 1066, 864, 826, 745, 241, -683, -1578, -2178, -2710, -3409, -4141, -4802, -5597, -6582, -7399, -7816, -8164, -8804, -9524, -9854, -9727, -9423, -9002, -8263, -7221, -6172, -5180, -3991, -2568, -1284, -434, 120, 623, 1100, 1411, 1460, 1303, 1119, 1006, 873, 624, 340, 70, -313, -840, -1212, -1177, -915, -786, -774, -513, 249, 1411, 2706, 3988, 5278, 6619, 7992, 9418, 10927, 12284, 13016, 13002, 12780, 12807, 12812, 12320, 11432, 10561, 9853, 9309, 9000, 8816, 8509, 8132, 7906, 7756, 7454, 7114, 6939, 6809, 6551, 6287, 6172, 6154, 6215, 6477, 6889, 7174, 7217, 7198, 7271, 7294, 6978, 6233, 5279, 4445, 3827, 3214, 2388, 1417, 584, 96, -111, -282, -609, -1108, -1696, -2350, -3118, -3976, -4764, -5350, -5787, -6201, -6516, -6482, -6059, -5546, -5168, -4799, -4362, -4155, -4413, -4855, -5106, -5326, -5916, -6769, -7299, -7194, -6776, -6569, -6629, -6512, -5996, -5556, -5699, -6117, -6209, -6110, -6306, -6600, -6488, -6128, -5877, -5396, -4285, -3002, -2204, -1758, -1205, -621, -366, -513, -938, -1547, -2124, -2330, -2075, -1667, -1458, -1403, -1059, -137, 1005, 1743, 2023, 2279, 2532, 2425, 2162, 2339, 2742, 2609, 2128, 2302, 3247, 3966, 3978, 3969, 4616, 5670, 6454, 6629, 6298, 5833, 5754, 6223, 6593, 6101, 5154, 4918, 5468, 5625, 4991, 4611, 4993, 5067, 4073, 3062, 3289, 4137, 4050, 3016, 2597, 3484, 4495, 4493, 4080, 4391, 5123, 5101, 4268, 3542, 2889, 1282, -1245, -3391, -4753, -6405, -8755, -10624, -11066, -10618, -9987, -8729, -5953, -1662, 3196, 7780, 12003, 16156, 20207, 23762, 26580, 28643, 29821, 29944, 29289, 28477, 27711, 26609, 24907, 22840, 20701, 18499, 16181, 13956, 12159, 10985, 10347, 10071, 10320, 11586, 13971, 16819, 19503, 22125, 24947, 27621, 29571, 30777, 31545, 32014, 32169, 32127, 31918, 31234, 29839, 28010, 26274, 24702, 22874, 20562, 18018, 15571, 13308, 11227, 9335, 7508, 5595, 3731, 2221, 1127, 244, -438, -631, -199, 515, 1094, 1568, 2203, 2996, 3638, 3942, 3975, 3776, 3249, 2382, 1333, 197, -1074, -2480, -3889, -5287, -6891, -8801, -10815, -12687, -14400, -16039, -17594, -19011, -20229, -21103, -21430, -21116, -20248, -19001, -17442, -15469, -12946, -10021, -7155, -4709, -2611, -569, 1420, 3034, 4013, 4438, 4561, 4491, 4123, 3334, 2196, 903, -467, -1993, -3684, -5343, -6772, -7956, -8949, -9639, -9787, -9305, -8328, -6966, -5161, -2895, -374, 2142, 4559, 6887, 9020, 10734, 11851, 12372, 12441, 12199, 11635, 10616, 9099, 7255, 5322, 3384, 1343, -856, -3077, -5094, -6829, -8377, -9772, -10865, -11530, -11876, -12020, -11843, -11250, -10467, -9748, -9031, -8237, -7564, -7173, -6967, -6884, -7145, -7893, -8954, -10115, -11376, -12777, -14260, -15740, -17191, -18577, -19857, -21032, -22131, -23182, -24175, -25057, -25781, -26390, -26960, -27466, -27806, -27865, -27652, -27208, -26551, -25668, -24558, -23240, -21770, -20242, -18728, -17238, -15784, -14442, -13317, -12428, -11656, -10926, -10307, -9940, -9855, -9921, -10018, -10155, -10426, -10855, -11378, -11899, -12311, -12491, -12352, -11922, -11305, -10537, -9544, -8161, -6315, -4195, -2166, -354, 1429, 3258, 4861, 6017, 6844, 7451, 7680, 7447, 7002, 6552, 5972, 5065, 3925, 2811, 1834, 885, -167, -1275, -2239, -2960, -3546, -4059, -4361, -4350, -4145, -3837, -3353, -2705, -2091, -1577, -1041, -528, -259, -285, -448, -719, -1181, -1751, -2253, -2717, -3308, -4028, -4695, -5211, -5649, -6058, -6385, -6657, -7046, -7626, -8220, -8615, -8755, -8703, -8577, -8500, -8381, -7917, -7027, -6030, -5163, -4281, -3281, -2401, -1782, -1188, -442, 203, 469, 500, 651, 982, 1197, 1101, 931, 1036, 1270, 1112, 552, 248, 482, 695, 521, 471, 1023, 1866, 2587, 3364, 4459, 5739, 7018, 8319, 9566, 10562, 11320, 12034, 12753, 13322, 13555, 13380, 12972, 12639, 12442, 12106, 11476, 10742, 10041, 9281, 8485, 7924, 7615, 7174, 6414, 5734, 5580, 5799, 5897, 5762, 5736, 6011, 6363, 6599, 6861, 7284, 7642, 7629, 7313, 7028, 6869, 6603, 6067, 5372, 4652, 3878, 2996, 2089, 1250, 436, -456, -1418, -2305, -2949, -3321, -3571, -3891, -4299, -4562, -4465, -4125, -3843, -3655, -3358, -2940, -2613, -2367, -2000, -1603, -1517, -1757, -1974, -2038, -2208, -2699, -3396, -4077, -4665, -5187, -5633, -5980, -6255, -6492, -6695, -6826, -6780, -6376, -5632, -4945, -4651, -4475, -3858, -2791, -1829, -1286, -889, -304, 432, 1101, 1636, 2093, 2461, 2642, 2623, 2555, 2545, 2469, 2174, 1782, 1545, 1431, 1195, 840, 611, 563, 527, 447, 441, 521, 568, 513, 375, 288, 504, 1082, 1598, 1510, 938, 654, 1179, 2123, 2669, 2491, 1992, 1765, 2037, 2631, 3242, 3605, 3573, 3274, 3124, 3431, 4001, 4428, 4580, 4456, 3966, 3344, 3217, 3594, 3467, 2277, 945, 548, 707, 341, -571, -1057, -715, -194, -37, 113, 810, 1885, 2726, 3115, 3343, 3750, 4347, 4725, 4411, 3584, 3094, 3356, 3677, 3246, 2289, 1657, 1615, 1655, 1305, 580, -318, -1193, -1741, -1797, -1777, -2133, -2463, -2019, -1056, -511, -458, -122, 574, 796, 151, -813, -1650, -2583, -3847, -5134, -6028, -6491, -6583, -6002, -4374, -1827, 1132, 4255, 7649, 11360, 15134, 18647, 21712, 24209, 26069, 27356, 28258, 28851, 28987, 28507, 27469, 26067, 24470, 22742, 20866, 18809, 16693, 14825, 13423, 12562, 12360, 13002, 14428, 16295, 18395, 20793, 23485, 26148, 28393, 30110, 31370, 32231, 32678, 32767, 32551, 31939, 30739, 28932, 26743, 24390, 21821, 18858, 15583, 12336, 9409, 6831, 4556, 2630, 1134, 47, -654, -886, -577, 69, 768, 1491, 2351, 3257, 4000, 4606, 5109, 5195, 4568, 3479, 2381, 1215, -430, -2581, -4767, -6688, -8497, -10296, -11809, -12844, -13680, -14644, -15546, -15975, -15949, -15895, -16051, -16233, -16168, -15789, -15181, -14470, -13792, -13141, -12264, -10952, -9427, -8116, -7041, -5821, -4357, -3018, -2011, -1017, 272, 1583, 2396, 2718, 3039, 3577, 3901, 3552, 2677, 1718, 711, -654, -2368, -3945, -5098, -6093, -7180, -8019, -8012, -7076, -5705, -4238, -2502, -240, 2390, 4958, 7219, 9195, 10883, 12149, 12913, 13214, 13030, 12268, 10974, 9339, 7437, 5213, 2749, 242, -2277, -4840, -7232, -9153, -10637, -11905, -12930, -13438, -13323, -12777, -12044, -11181, -10063, -8679, -7376, -6568, -6171, -5776, -5415, -5614, -6545, -7777, -8990, -10394, -12135, -13904, -15397, -16736, -18166, -19556, -20570, -21168, -21671, -22301, -22861, -23078, -23074, -23180, -23400, -23413, -23186, -23042, -23086, -23003, -22596, -22087, -21707, -21342, -20813, -20199, -19608, -18929, -18003, -16952, -16044, -15304, -14455, -13324, -12051, -10917, -10080, -9522, -9047, -8535, -8146, -8115, -8374, -8681, -9048, -9574, -10060, -10235, -10178, -10052, -9777, -9263, -8537, -7517, -6105, -4557, -3206, -1926, -458, 990, 2093, 3001, 3982, 4808, 5087, 4936, 4821, 4855, 4640, 3825, 2579, 1441, 648, -150, -1324, -2660, -3695, -4387, -4980, -5423, -5481, -5275, -5163, -5151, -4898, -4304, -3670, -3271, -3073, -2941, -2853, -2834, -2848, -2896, -3065, -3362, -3692, -4037, -4458, -4847, -4997, -4987, -5208, -5806, -6372, -6482, -6311, -6375, -6773, -7126, -7214, -7236, -7332, -7290, -6969, -6633, -6577, -6634, -6397, -5848, -5359, -5132, -5003, -4763, -4351, -3762, -3091, -2530, -2080, -1496, -738, -119, 212, 527, 1001, 1381, 1402, 1234, 1237, 1455, 1584, 1419, 1169, 1203, 1584, 2006, 2264, 2541, 3091, 3823, 4477, 5026, 5663, 6446, 7201, 7783, 8253, 8734, 9213, 9555, 9709, 9809, 9955, 10025, 9882, 9658, 9545, 9430, 9067, 8547, 8190, 8049, 7899, 7655, 7462, 7372, 7271, 7143, 7169, 7416, 7665, 7665, 7477, 7370, 7437, 7476, 7288, 6919, 6545, 6244, 5930, 5529, 5064, 4595, 4122, 3647, 3270, 3078, 2970, 2713, 2245, 1756, 1440, 1276, 1107, 828, 468, 111, -212, -549, -896, -1127, -1192, -1305, -1719, -2315, -2687, -2670, -2595, -2819, -3213, -3367, -3192, -3051, -3184, -3309, -3094, -2792, -2930, -3391, -3485, -3042, -2720, -2929, -3208, -3031, -2623, -2530, -2784, -2921, -2588, -1965, -1572, -1614, -1671, -1290, -672, -313, -195, 82, 522, 766, 779, 908, 1274, 1612, 1698, 1639, 1653, 1773, 1841, 1798, 1858, 2174, 2469, 2372, 2087, 2221, 2842, 3268, 3034, 2569, 2585, 3106, 3481, 3288, 2909, 3062, 3837, 4525, 4591, 4406, 4602, 5157, 5624, 5860, 5956, 5884, 5698, 5651, 5764, 5740, 5513, 5327, 5143, 4652, 3951, 3594, 3720, 3657, 2789, 1472, 688, 825, 1220, 1070, 451, 120, 487, 1179, 1637, 1805, 2004, 2341, 2574, 2536, 2375, 2280, 2158, 1806, 1290, 916, 762, 533, 61, -417, -744, -1196, -1944, -2593, -2815, -3031, -3775, -4672, -4868, -4360, -4055, -4325, -4405, -3677, -2752, -2532, -2846, -2911, -2723, -2978, -3767, -4325, -4200, -3858, -3769, -3474, -2121, 328, 3038, 5449, 7907, 10956, 14411, 17574, 20084, 22153, 24021, 25628, 26844, 27767, 28473, 28790, 28522, 27818, 27035, 26233, 25072, 23320, 21293, 19525, 18158, 16949, 15856, 15217, 15241, 15842, 16893, 18409, 20279, 22232, 24122, 25966, 27700, 29129, 30142, 30828, 31243, 31321, 31055, 30528, 29694, 28317, 26333, 24027, 21611, 19015, 16178, 13238, 10256, 7190, 4243, 1788, -65, -1562, -2819, -3672, -3998, -3855, -3369, -2623, -1723, -841, -126, 415, 904, 1350, 1484, 1078, 333, -456, -1396, -2731, -4244, -5571, -6849, -8410, -10074, -11444, -12588, -13802, -15006, -15908, -16487, -16911, -17223, -17350, -17251, -16916, -16347, -15564, -14543, -13329, -12122, -11048, -9940, -8630, -7308, -6209, -5216, -4139, -3115, -2303, -1519, -585, 337, 1010, 1469, 1844, 2165, 2379, 2404, 2184, 1795, 1372, 858, 134, -646, -1221, -1636, -2072, -2409, -2409, -2169, -1918, -1586, -940, 8, 1052, 2046, 2965, 3841, 4739, 5671, 6522, 7160, 7588, 7857, 7920, 7688, 7184, 6513, 5657, 4468, 2916, 1183, -570, -2350, -4145, -5854, -7440, -8954, -10318, -11353, -12061, -12637, -13138, -13443, -13506, -13468, -13449, -13411, -13262, -13027, -12855, -12831, -12830, -12703, -12601, -12777, -13136, -13399, -13612, -14089, -14788, -15425, -16037, -16880, -17866, -18703, -19440, -20305, -21226, -21975, -22548, -23061, -23488, -23725, -23803, -23785, -23649, -23324, -22780, -22072, -21284, -20400, -19299, -17988, -16677, -15462, -14167, -12667, -11193, -10057, -9165, -8205, -7167, -6416, -6125, -6015, -5833, -5732, -5922, -6248, -6454, -6604, -6870, -7164, -7276, -7161, -6925, -6633, -6315, -5936, -5392, -4655, -3859, -3108, -2337, -1449, -483, 466, 1348, 2140, 2807, 3330, 3713, 3934, 3952, 3769, 3433, 2981, 2411, 1731, 990, 214, -607, -1432, -2148, -2750, -3361, -4017, -4590, -4984, -5207, -5317, -5426, -5623, -5743, -5556, -5238, -5202, -5336, -5128, -4592, -4262, -4279, -4277, -4142, -4124, -4237, -4287, -4348, -4641, -5121, -5583, -5961, -6306, -6618, -6878, -7067, -7209, -7407, -7687, -7797, -7520, -7119, -7024, -7163, -7127, -6819, -6400, -5883, -5309, -4938, -4783, -4395, -3525, -2523, -1812, -1418, -1143, -758, -101, 673, 1160, 1290, 1463, 1900, 2360, 2665, 2944, 3266, 3473, 3531, 3603, 3754, 3873, 3903, 3884, 3837, 3784, 3850, 4144, 4543, 4782, 4806, 4888, 5256, 5793, 6224, 6508, 6817, 7219, 7594, 7871, 8178, 8642, 9160, 9471, 9470, 9339, 9338, 9512, 9671, 9596, 9278, 8914, 8688, 8597, 8507, 8304, 7986, 7624, 7300, 7049, 6839, 6628, 6393, 6111, 5762, 5397, 5115, 4922, 4721, 4453, 4180, 3964, 3772, 3560, 3319, 3084, 2905, 2803, 2684, 2471, 2237, 2093, 1970, 1764, 1562, 1487, 1433, 1227, 904, 577, 212, -241, -698, -1097, -1526, -2071, -2639, -3092, -3421, -3702, -3950, -4126, -4241, -4365, -4491, -4518, -4373, -4131, -3921, -3756, -3538, -3213, -2815, -2389, -1969, -1641, -1463, -1358, -1214, -1051, -975, -1011, -1105, -1219, -1327, -1373, -1348, -1324, -1341, -1310, -1123, -821, -543, -295, 60, 603, 1229, 1809, 2339, 2905, 3577, 4356, 5148, 5789, 6192, 6475, 6817, 7222, 7497, 7492, 7284, 7088, 7036, 7060, 6999, 6793, 6533, 6370, 6401, 6586, 6688, 6449, 5919, 5498, 5458, 5543, 5325, 4828, 4494, 4532, 4644, 4539, 4386, 4506, 4801, 4816, 4415, 4032, 4031, 4164, 3973, 3508, 3124, 2847, 2469, 2081, 1871, 1596, 877, -70, -710, -1098, -1858, -3078, -4014, -4271, -4487, -5209, -5883, -5803, -5291, -4975, -4695, -4041, -3200, -2497, -1851, -1137, -407, 360, 1081, 1444, 1530, 1840, 2306, 2317, 1976, 2024, 2401, 2319, 1718, 1202, 831, 264, -357, -782, -1263, -1978, -2556, -2681, -2462, -2062, -1632, -1389, -1128, -285, 1022, 1899, 2074, 2334, 3122, 3798, 3788, 3490, 3590, 4172, 4843, 5339, 5749, 6363, 7489, 9209, 11223, 13062, 14560, 16044, 17854, 19887, 21752, 23211, 24223, 24844, 25285, 25785, 26348, 26703, 26577, 25881, 24708, 23369, 22252, 21402, 20411, 18905, 17051, 15453, 14560, 14327, 14283, 14137, 14113, 14640, 15707, 16864, 17848, 18808, 19898, 21040, 22081, 22892, 23343, 23457, 23359, 22971, 22028, 20578, 18915, 17079, 14876, 12371, 9826, 7266, 4566, 1881, -486, -2510, -4337, -5949, -7141, -7785, -7929, -7716, -7264, -6604, -5702, -4589, -3404, -2310, -1443, -893, -566, -260, -24, -221, -1061, -2276, -3495, -4679, -5973, -7403, -8927, -10525, -12066, -13301, -14136, -14753, -15300, -15652, -15625, -15262, -14697, -13850, -12579, -11052, -9613, -8306, -6842, -5154, -3634, -2586, -1792, -934, -187, 102, 60, 67, 90, -151, -561, -782, -812, -975, -1367, -1754, -1921, -1879, -1766, -1708, -1713, -1699, -1600, -1401, -1070, -623, -218, -17, 57, 217, 486, 650, 563, 309, 9, -332, -728, -1091, -1359, -1615, -1910, -2103, -2091, -2018, -2087, -2255, -2383, -2505, -2732, -3062, -3438, -3936, -4651, -5494, -6268, -6923, -7625, -8533, -9627, -10728, -11687, -12482, -13192, -13936, -14771, -15594, -16183, -16417, -16406, -16340, -16235, -15973, -15526, -14988, -14420, -13832, -13318, -12918, -12579, -12311, -12246, -12414, -12648, -12882, -13260, -13858, -14536, -15178, -15831, -16542, -17238, -17835, -18328, -18733, -19023, -19156, -19124, -18908, -18457, -17765, -16907, -15964, -14929, -13763, -12499, -11236, -10002, -8774, -7590, -6565, -5752, -5083, -4520, -4108, -3881, -3797, -3827, -4018, -4339, -4645, -4844, -5043, -5373, -5742, -5945, -5945, -5917, -5959, -5953, -5753, -5355, -4843, -4292, -3767, -3265, -2684, -1955, -1182, -563, -170, 112, 423, 747, 909, 775, 425, 111, -25, -162, -609, -1383, -2111, -2495, -2698, -3064, -3635, -4206, -4666, -5014, -5225, -5339, -5504, -5731, -5830, -5699, -5451, -5225, -5079, -5028, -4982, -4784, -4457, -4248, -4289, -4441, -4543, -4563, -4495, -4367, -4323, -4444, -4608, -4665, -4601, -4434, -4216, -4130, -4262, -4351, -4075, -3556, -3205, -3162, -3194, -3041, -2670, -2230, -1936, -1880, -1917, -1821, -1542, -1227, -1003, -890, -820, -683, -358, 159, 681, 998, 1177, 1526, 2191, 2933, 3450, 3743, 4040, 4506, 5127, 5751, 6183, 6371, 6507, 6778, 7119, 7316, 7296, 7175, 7081, 7045, 7004, 6848, 6567, 6305, 6192, 6172, 6113, 5992, 5870, 5784, 5751, 5794, 5900, 6009, 6108, 6255, 6488, 6778, 7096, 7448, 7817, 8122, 8320, 8470, 8653, 8826, 8858, 8713, 8509, 8352, 8194, 7925, 7523, 7066, 6602, 6117, 5592, 5029, 4426, 3792, 3188, 2660, 2197, 1768, 1400, 1154, 1063, 1098, 1195, 1303, 1426, 1611, 1864, 2125, 2337, 2496, 2628, 2735, 2805, 2834, 2824, 2765, 2644, 2434, 2110, 1677, 1169, 618, 32, -587, -1248, -1918, -2522, -2978, -3291, -3544, -3777, -3923, -3919, -3798, -3638, -3473, -3283, -3025, -2681, -2273, -1852, -1432, -978, -473, 34, 491, 893, 1259, 1584, 1824, 1943, 1954, 1890, 1787, 1653, 1507, 1371, 1248, 1128, 1044, 1051, 1114, 1131, 1083, 1068, 1131, 1188, 1179, 1184, 1301, 1500, 1688, 1857, 2083, 2401, 2773, 3129, 3402, 3545, 3605, 3730, 3962, 4133, 4103, 3967, 3907, 3958, 4068, 4204, 4288, 4209, 4000, 3854, 3866, 3864, 3629, 3164, 2658, 2259, 1996, 1839, 1678, 1364, 916, 607, 620, 732, 596, 218, -74, -103, -2, 28, -47, -150, -206, -157, 38, 312, 453, 298, -26, -212, -167, -173, -503, -1039, -1441, -1570, -1544, -1516, -1580, -1726, -1774, -1512, -999, -568, -422, -369, -67, 568, 1271, 1696, 1763, 1750, 2010, 2541, 2928, 2798, 2291, 1930, 1993, 2196, 2104, 1710, 1365, 1238, 1169, 1111, 1274, 1623, 1677, 1233, 836, 1053, 1598, 1748, 1350, 922, 906, 1180, 1274, 939, 455, 235, 182, -92, -545, -790, -908, -1301, -1776, -1679, -934, -122, 454, 1103, 2211, 3909, 6085, 8331, 10185, 11645, 13177, 15073, 17114, 18866, 20042, 20670, 21069, 21584, 22134, 22213, 21486, 20222, 19003, 18082, 17134, 15680, 13711, 11845, 10663, 10030, 9396, 8617, 8051, 8008, 8520, 9553, 10947, 12298, 13425, 14630, 16228, 18077, 19828, 21261, 22308, 23059, 23715, 24201, 24150, 23466, 22441, 21101, 19205, 16938, 14731, 12444, 9688, 6790, 4398, 2440, 379, -1771, -3512, -4619, -5233, -5507, -5543, -5348, -4776, -3770, -2596, -1502, -412, 774, 1872, 2673, 3162, 3383, 3357, 3169, 2802, 2028, 732, -822, -2344, -3843, -5428, -7100, -8812, -10451, -11776, -12660, -13329, -14004, -14480, -14413, -13868, -13208, -12577, -11791, -10719, -9471, -8176, -6872, -5669, -4762, -4102, -3383, -2519, -1848, -1662, -1834, -2019, -2070, -2096, -2308, -2799, -3391, -3790, -3959, -4165, -4558, -4938, -5047, -4906, -4747, -4684, -4622, -4433, -4105, -3717, -3326, -2963, -2655, -2411, -2175, -1893, -1609, -1410, -1249, -1011, -718, -484, -293, -35, 252, 461, 614, 755, 767, 597, 408, 288, 36, -510, -1220, -1897, -2564, -3330, -4223, -5207, -6218, -7178, -8077, -8996, -9943, -10799, -11466, -11944, -12282, -12537, -12741, -12806, -12590, -12146, -11685, -11266, -10776, -10227, -9773, -9442, -9131, -8886, -8857, -9041, -9329, -9726, -10317, -11077, -11898, -12705, -13512, -14383, -15350, -16317, -17108, -17679, -18178, -18709, -19148, -19302, -19150, -18835, -18432, -17877, -17081, -16095, -15026, -13937, -12824, -11667, -10473, -9333, -8380, -7633, -6958, -6278, -5731, -5482, -5477, -5522, -5497, -5430, -5458, -5726, -6169, -6483, -6503, -6445, -6550, -6739, -6818, -6747, -6515, -6095, -5587, -5134, -4643, -3943, -3099, -2304, -1598, -965, -447, 46, 667, 1267, 1507, 1395, 1321, 1478, 1645, 1562, 1240, 854, 536, 272, -54, -521, -1063, -1579, -2030, -2364, -2555, -2742, -3076, -3379, -3331, -3008, -2814, -2879, -2916, -2744, -2525, -2433, -2427, -2425, -2426, -2413, -2341, -2267, -2326, -2469, -2470, -2313, -2291, -2546, -2814, -2858, -2811, -2888, -3077, -3278, -3429, -3452, -3346, -3300, -3435, -3586, -3556, -3417, -3347, -3396, -3532, -3693, -3749, -3630, -3472, -3443, -3480, -3381, -3070, -2638, -2219, -1882, -1575, -1142, -534, 75, 542, 929, 1384, 1923, 2469, 2929, 3209, 3314, 3432, 3683, 3879, 3768, 3428, 3155, 3052, 2951, 2696, 2318, 1980, 1806, 1760, 1705, 1599, 1552, 1652, 1850, 2075, 2319, 2595, 2920, 3370, 3967, 4576, 5046, 5433, 5884, 6420, 6937, 7311, 7466, 7458, 7484, 7598, 7579, 7271, 6870, 6590, 6343, 5980, 5565, 5168, 4735, 4288, 3942, 3674, 3373, 3084, 2920, 2849, 2803, 2834, 2980, 3158, 3328, 3572, 3902, 4186, 4353, 4491, 4693, 4895, 4996, 5018, 5040, 5031, 4895, 4647, 4407, 4215, 3987, 3663, 3269, 2850, 2432, 2037, 1673, 1331, 1007, 727, 515, 387, 333, 315, 311, 366, 538, 786, 982, 1067, 1149, 1365, 1687, 1941, 2046, 2099, 2208, 2348, 2425, 2411, 2337, 2239, 2142, 2041, 1894, 1666, 1384, 1106, 888, 757, 682, 577, 403, 246, 229, 355, 506, 593, 636, 704, 862, 1137, 1483, 1791, 1996, 2159, 2403, 2754, 3079, 3241, 3273, 3319, 3432, 3519, 3517, 3473, 3421, 3291, 3071, 2909, 2916, 2957, 2836, 2583, 2425, 2489, 2651, 2690, 2570, 2488, 2617, 2880, 3095, 3268, 3522, 3813, 3983, 4095, 4380, 4828, 5086, 4928, 4608, 4532, 4710, 4763, 4433, 3867, 3363, 3040, 2811, 2512, 2028, 1392, 806, 451, 279, 68, -320, -767, -1009, -924, -692, -596, -665, -670, -463, -175, -3, 59, 138, 226, 189, 16, -129, -150, -157, -302, -554, -758, -864, -937, -981, -951, -939, -1068, -1175, -927, -386, -53, -168, -318, -13, 646, 1145, 1205, 1013, 896, 1010, 1286, 1514, 1487, 1235, 1075, 1258, 1592, 1676, 1450, 1222, 1218, 1333, 1324, 1045, 572, 134, -106, -213, -306, -422, -640, -1124, -1783, -2198, -2154, -2058, -2471, -3369, -4130, -4257, -3897, -3578, -3595, -3683, -3224, -1828, 168, 1887, 2910, 3922, 5906, 8780, 11367, 12833, 13605, 14671, 16322, 18001, 19101, 19527, 19494, 19219, 18908, 18700, 18366, 17357, 15523, 13539, 12220, 11464, 10378, 8540, 6670, 5776, 5972, 6458, 6567, 6464, 6855, 8148, 10060, 11952, 13450, 14692, 16091, 17885, 19880, 21568, 22555, 22937, 23121, 23287, 23194, 22490, 21048, 19025, 16799, 14749, 12877, 10748, 8037, 5044, 2453, 636, -624, -1843, -3286, -4707, -5491, -5241, -4264, -3400, -3085, -2768, -1675, 52, 1520, 2250, 2582, 2953, 3458, 3966, 4148, 3639, 2547, 1442, 605, -268, -1463, -2929, -4551, -6185, -7525, -8455, -9266, -10175, -10969, -11428, -11639, -11651, -11334, -10743, -10193, -9783, -9230, -8292, -7123, -6122, -5498, -5090, -4533, -3637, -2616, -1946, -1851, -1991, -1804, -1203, -697, -748, -1206, -1552, -1495, -1226, -1190, -1625, -2258, -2573, -2464, -2363, -2639, -3141, -3490, -3576, -3559, -3609, -3745, -3866, -3846, -3672, -3430, -3162, -2820, -2382, -1862, -1236, -509, 199, 789, 1320, 1880, 2405, 2781, 3006, 3118, 3057, 2741, 2221, 1622, 948, 67, -1071, -2344, -3587, -4790, -6041, -7361, -8651, -9805, -10780, -11579, -12198, -12619, -12846, -12897, -12775, -12474, -12000, -11399, -10746, -10090, -9442, -8816, -8285, -7914, -7678, -7521, -7491, -7728, -8268, -8986, -9777, -10654, -11664, -12791, -13960, -15104, -16180, -17171, -18067, -18872, -19538, -19996, -20204, -20195, -20027, -19690, -19115, -18274, -17232, -16091, -14923, -13733, -12525, -11313, -10158, -9108, -8199, -7409, -6719, -6184, -5853, -5679, -5567, -5517, -5588, -5779, -6057, -6417, -6826, -7188, -7482, -7787, -8111, -8335, -8407, -8377, -8258, -8021, -7683, -7261, -6716, -6078, -5458, -4880, -4262, -3608, -3004, -2444, -1875, -1347, -935, -602, -298, -96, -29, 1, 58, -33, -440, -1009, -1434, -1712, -2141, -2827, -3503, -3963, -4313, -4698, -5064, -5354, -5644, -5932, -6036, -5878, -5694, -5699, -5728, -5495, -5029, -4585, -4186, -3709, -3213, -2827, -2436, -1910, -1413, -1167, -1066, -886, -680, -667, -878, -1135, -1333, -1546, -1853, -2216, -2549, -2863, -3210, -3549, -3786, -3935, -4089, -4208, -4152, -3955, -3784, -3594, -3150, -2465, -1836, -1358, -784, 25, 873, 1537, 2081, 2674, 3312, 3866, 4265, 4528, 4694, 4817, 4970, 5089, 4986, 4645, 4314, 4155, 4012, 3698, 3267, 2855, 2523, 2333, 2294, 2276, 2167, 2069, 2162, 2495, 3012, 3583, 4000, 4243, 4641, 5421, 6287, 6849, 7197, 7649, 8202, 8644, 8938, 9156, 9281, 9288, 9213, 9061, 8797, 8456, 8073, 7613, 7096, 6625, 6231, 5828, 5382, 4932, 4513, 4201, 4108, 4183, 4213, 4141, 4148, 4323, 4559, 4819, 5179, 5577, 5832, 5969, 6196, 6552, 6832, 6879, 6786, 6709, 6635, 6451, 6098, 5603, 5018, 4444, 3959, 3461, 2783, 1991, 1343, 900, 464, -43, -476, -735, -890, -1008, -1070, -1067, -991, -807, -503, -134, 229, 542, 805, 1103, 1495, 1866, 2040, 2054, 2085, 2124, 2026, 1819, 1627, 1402, 1056, 705, 452, 161, -268, -676, -893, -1004, -1150, -1333, -1478, -1489, -1305, -1044, -892, -780, -472, -24, 295, 484, 732, 1009, 1215, 1467, 1788, 1896, 1704, 1584, 1755, 1926, 1828, 1604, 1441, 1295, 1141, 1091, 1130, 1041, 755, 509, 540, 737, 805, 680, 600, 747, 1001, 1151, 1181, 1206, 1252, 1316, 1465, 1652, 1640, 1429, 1380, 1606, 1696, 1440, 1209, 1262, 1333, 1219, 1091, 1025, 891, 742, 706, 634, 377, 134, 61, -28, -274, -545, -773, -999, -1131, -1148, -1282, -1585, -1765, -1768, -1868, -2020, -1939, -1782, -1828, -1830, -1587, -1496, -1663, -1493, -913, -726, -1120, -1305, -1047, -1015, -1385, -1608, -1658, -2079, -2792, -3096, -2942, -3102, -3868, -4473, -4248, -3653, -3529, -3828, -3797, -3207, -2550, -2093, -1518, -650, 144, 606, 1060, 1843, 2694, 3175, 3342, 3486, 3558, 3370, 3102, 3045, 2974, 2416, 1480, 868, 859, 856, 257, -617, -1015, -898, -946, -1397, -1679, -1385, -981, -1029, -1212, -841, -22, 433, 258, 126, 577, 1187, 1228, 743, 373, 373, 365, 81, -236, -321, -290, -242, 72, 809, 1638, 2275, 3027, 4309, 5930, 7385, 8607, 9902, 11391, 12891, 14256, 15459, 16448, 17155, 17620, 17985, 18252, 18227, 17763, 16997, 16215, 15496, 14694, 13738, 12761, 11881, 11097, 10502, 10260, 10309, 10426, 10634, 11171, 12078, 13121, 14183, 15318, 16505, 17681, 18854, 19973, 20881, 21519, 21936, 22087, 21872, 21361, 20648, 19639, 18227, 16549, 14806, 13058, 11319, 9615, 7905, 6141, 4503, 3265, 2463, 1844, 1222, 715, 578, 894, 1487, 2106, 2629, 3109, 3664, 4284, 4778, 4971, 4923, 4755, 4406, 3761, 2932, 2039, 938, -494, -2003, -3318, -4558, -5930, -7296, -8412, -9312, -10113, -10731, -11037, -11080, -10974, -10700, -10201, -9544, -8853, -8115, -7242, -6293, -5490, -4926, -4430, -3866, -3384, -3223, -3315, -3402, -3450, -3665, -4104, -4562, -4915, -5306, -5816, -6254, -6445, -6543, -6750, -6916, -6777, -6430, -6151, -5870, -5324, -4611, -4059, -3664, -3137, -2436, -1823, -1416, -1076, -730, -458, -249, 57, 468, 741, 751, 736, 953, 1281, 1416, 1296, 1113, 990, 869, 680, 430, 113, -325, -873, -1394, -1787, -2162, -2712, -3399, -3994, -4436, -4898, -5403, -5754, -5935, -6173, -6452, -6474, -6208, -5987, -5938, -5826, -5511, -5164, -4967, -4922, -4954, -5003, -5115, -5441, -6040, -6731, -7334, -7967, -8820, -9812, -10735, -11588, -12498, -13400, -14109, -14610, -15088, -15598, -15954, -15982, -15795, -15632, -15496, -15124, -14427, -13671, -13055, -12404, -11560, -10767, -10242, -9786, -9176, -8634, -8468, -8552, -8589, -8604, -8805, -9150, -9415, -9608, -9925, -10348, -10605, -10609, -10590, -10694, -10752, -10579, -10226, -9794, -9288, -8703, -8047, -7315, -6537, -5762, -4947, -4073, -3292, -2713, -2170, -1555, -1090, -945, -895, -727, -609, -726, -933, -1062, -1221, -1521, -1811, -1933, -1995, -2190, -2477, -2639, -2607, -2545, -2593, -2670, -2613, -2408, -2178, -1993, -1820, -1645, -1485, -1325, -1135, -977, -971, -1108, -1226, -1245, -1307, -1554, -1878, -2062, -2107, -2208, -2431, -2621, -2675, -2693, -2798, -2988, -3198, -3381, -3498, -3535, -3581, -3756, -4010, -4126, -3995, -3812, -3846, -4082, -4234, -4171, -4117, -4270, -4456, -4431, -4307, -4294, -4278, -4056, -3748, -3540, -3314, -2929, -2505, -2158, -1818, -1511, -1370, -1303, -1104, -866, -859, -1037, -1106, -1026, -1066, -1325, -1579, -1655, -1708, -1959, -2333, -2581, -2647, -2684, -2772, -2814, -2700, -2417, -2004, -1524, -1066, -658, -174, 523, 1338, 1986, 2377, 2731, 3243, 3826, 4282, 4555, 4741, 4945, 5173, 5320, 5302, 5201, 5142, 5073, 4850, 4531, 4336, 4286, 4131, 3759, 3463, 3554, 3888, 4094, 4142, 4323, 4747, 5231, 5684, 6199, 6771, 7264, 7660, 8075, 8538, 8953, 9265, 9506, 9706, 9844, 9880, 9787, 9562, 9237, 8858, 8448, 7962, 7371, 6731, 6130, 5572, 5017, 4500, 4104, 3843, 3626, 3384, 3158, 3016, 2980, 3053, 3228, 3390, 3410, 3397, 3594, 3921, 4057, 3996, 4031, 4137, 4003, 3660, 3441, 3337, 3004, 2413, 1909, 1608, 1255, 688, 110, -244, -442, -674, -954, -1169, -1284, -1325, -1299, -1258, -1261, -1221, -1013, -734, -566, -438, -162, 199, 455, 620, 840, 1097, 1252, 1309, 1374, 1472, 1511, 1447, 1366, 1369, 1420, 1384, 1204, 1021, 1009, 1149, 1220, 1090, 902, 906, 1123, 1332, 1384, 1388, 1510, 1738, 1955, 2136, 2343, 2580, 2777, 2904, 3017, 3160, 3290, 3334, 3295, 3246, 3213, 3146, 3015, 2855, 2686, 2494, 2312, 2191, 2070, 1851, 1600, 1438, 1309, 1111, 924, 832, 713, 490, 298, 204, 67, -115, -194, -208, -332, -487, -496, -456, -558, -708, -738, -735, -849, -993, -1021, -992, -1040, -1127, -1115, -988, -856, -776, -689, -553, -460, -517, -651, -698, -705, -874, -1180, -1347, -1296, -1280, -1433, -1554, -1480, -1350, -1327, -1359, -1327, -1235, -1140, -1052, -947, -807, -614, -367, -113, 96, 275, 474, 653, 728, 726, 730, 695, 499, 220, 60, 7, -154, -449, -624, -529, -336, -271, -281, -137, 235, 705, 1135, 1525, 1933, 2387, 2878, 3343, 3724, 4054, 4395, 4677, 4783, 4745, 4654, 4478, 4174, 3834, 3503, 3033, 2370, 1779, 1505, 1373, 1046, 606, 462, 684, 903, 984, 1263, 1870, 2426, 2698, 2988, 3565, 4186, 4521, 4641, 4778, 4917, 4913, 4798, 4676, 4485, 4111, 3669, 3328, 2991, 2459, 1798, 1190, 628, 64, -422, -849, -1385, -1972, -2291, -2228, -2017, -1863, -1758, -1621, -1351, -893, -391, -101, -16, 98, 287, 346, 257, 284, 583, 1002, 1356, 1704, 2268, 3160, 4216, 5202, 6128, 7187, 8342, 9316, 10077, 10886, 11742, 12351, 12710, 13107, 13468, 13427, 13025, 12698, 12547, 12265, 11676, 10903, 10099, 9395, 8903, 8591, 8342, 8198, 8317, 8693, 9186, 9800, 10678, 11803, 12884, 13746, 14507, 15329, 16097, 16581, 16774, 16839, 16761, 16333, 15528, 14596, 13639, 12427, 10893, 9379, 8094, 6716, 5023, 3426, 2357, 1594, 739, -43, -326, -168, 20, 189, 676, 1513, 2302, 2842, 3343, 3887, 4174, 4065, 3800, 3466, 2804, 1691, 362, -1009, -2501, -4158, -5821, -7361, -8811, -10238, -11561, -12577, -13202, -13596, -13894, -13931, -13509, -12821, -12186, -11459, -10283, -8842, -7737, -7073, -6319, -5271, -4476, -4429, -4816, -5083, -5336, -6041, -7127, -8093, -8873, -9842, -11007, -11933, -12432, -12777, -13164, -13452, -13469, -13234, -12834, -12278, -11533, -10629, -9658, -8637, -7498, -6232, -5003, -3956, -3039, -2160, -1402, -908, -645, -483, -445, -642, -1039, -1463, -1851, -2306, -2866, -3387, -3745, -4020, -4320, -4600, -4755, -4774, -4691, -4530, -4359, -4181, -3861, -3361, -2901, -2588, -2189, -1559, -973, -681, -509, -238, -2, 6, -119, -219, -385, -779, -1329, -1822, -2236, -2729, -3352, -3945, -4411, -4888, -5517, -6157, -6573, -6816, -7144, -7590, -7947, -8139, -8293, -8403, -8350, -8194, -8113, -8059, -7827, -7440, -7102, -6874, -6651, -6424, -6300, -6306, -6348, -6376, -6470, -6726, -7080, -7364, -7542, -7773, -8160, -8545, -8747, -8848, -9066, -9400, -9620, -9643, -9661, -9796, -9841, -9577, -9155, -8833, -8529, -7994, -7265, -6556, -5878, -5150, -4467, -3942, -3504, -3074, -2705, -2428, -2212, -2118, -2220, -2387, -2429, -2406, -2522, -2810, -3115, -3329, -3490, -3683, -3913, -4081, -4112, -4061, -4005, -3855, -3465, -2906, -2395, -1948, -1389, -687, -25, 489, 955, 1429, 1787, 1922, 1915, 1902, 1867, 1714, 1453, 1167, 870, 530, 175, -165, -513, -852, -1106, -1261, -1405, -1557, -1620, -1542, -1381, -1174, -866, -443, -2, 392, 809, 1283, 1685, 1903, 2034, 2213, 2335, 2193, 1837, 1529, 1359, 1139, 728, 258, -111, -427, -779, -1089, -1294, -1510, -1820, -2070, -2113, -2039, -1999, -1958, -1792, -1511, -1220, -945, -630, -285, 16, 262, 484, 636, 628, 502, 393, 320, 182, -77, -408, -707, -901, -1011, -1158, -1389, -1556, -1516, -1370, -1339, -1432, -1443, -1254, -960, -685, -435, -161, 121, 394, 729, 1203, 1725, 2076, 2177, 2210, 2388, 2670, 2814, 2698, 2473, 2344, 2324, 2260, 2092, 1933, 1897, 1935, 1915, 1828, 1819, 1977, 2213, 2405, 2562, 2788, 3122, 3496, 3866, 4252, 4662, 5035, 5328, 5574, 5804, 5990, 6116, 6203, 6235, 6165, 6037, 5950, 5861, 5643, 5320, 5063, 4923, 4738, 4403, 4055, 3889, 3876, 3819, 3654, 3545, 3639, 3842, 3959, 4000, 4155, 4489, 4811, 4927, 4917, 4986, 5154, 5228, 5087, 4852, 4676, 4512, 4213, 3787, 3418, 3179, 2920, 2529, 2137, 1909, 1779, 1586, 1359, 1234, 1213, 1182, 1112, 1080, 1139, 1263, 1372, 1411, 1392, 1392, 1461, 1543, 1544, 1438, 1280, 1131, 1014, 930, 870, 785, 637, 515, 551, 719, 858, 910, 974, 1105, 1242, 1357, 1509, 1684, 1786, 1784, 1782, 1858, 1972, 2024, 1978, 1894, 1833, 1766, 1630, 1463, 1361, 1324, 1265, 1190, 1192, 1281, 1378, 1465, 1587, 1718, 1794, 1861, 2018, 2236, 2372, 2372, 2332, 2358, 2438, 2502, 2521, 2491, 2408, 2297, 2237, 2261, 2283, 2184, 1966, 1753, 1655, 1652, 1615, 1460, 1241, 1107, 1130, 1213, 1219, 1161, 1180, 1312, 1410, 1347, 1204, 1143, 1143, 1047, 838, 683, 641, 547, 347, 263, 445, 676, 698, 619, 696, 904, 1015, 1017, 1118, 1317, 1364, 1189, 1055, 1123, 1203, 1120, 980, 866, 660, 337, 99, 51, 37, -99, -336, -591, -797, -857, -726, -531, -480, -591, -646, -449, -74, 243, 425, 622, 962, 1331, 1514, 1488, 1445, 1526, 1617, 1507, 1197, 883, 652, 401, 91, -149, -273, -418, -685, -983, -1162, -1197, -1165, -1146, -1138, -1044, -789, -447, -128, 213, 717, 1335, 1805, 1998, 2129, 2430, 2746, 2767, 2518, 2295, 2140, 1782, 1138, 514, 131, -182, -657, -1173, -1508, -1729, -2002, -2179, -2012, -1640, -1411, -1298, -946, -282, 350, 751, 1112, 1596, 1999, 2090, 2004, 1981, 1952, 1721, 1320, 881, 410, -79, -455, -691, -957, -1326, -1671, -1906, -2071, -2162, -2137, -2050, -2017, -1987, -1785, -1425, -1139, -1030, -932, -776, -775, -1036, -1363, -1663, -2159, -2939, -3690, -4141, -4465, -4922, -5375, -5441, -5005, -4274, -3385, -2266, -900, 560, 2056, 3717, 5537, 7165, 8282, 9012, 9728, 10490, 10907, 10669, 9993, 9332, 8797, 8068, 6900, 5499, 4286, 3425, 2749, 2131, 1693, 1579, 1771, 2281, 3283, 4789, 6430, 7899, 9346, 11068, 12952, 14597, 15821, 16750, 17455, 17801, 17683, 17181, 16369, 15211, 13737, 12124, 10481, 8759, 7003, 5433, 4191, 3204, 2396, 1855, 1726, 2029, 2618, 3304, 4054, 5049, 6369, 7738, 8754, 9371, 9900, 10519, 10985, 10932, 10291, 9264, 8023, 6599, 5001, 3227, 1233, -962, -3122, -4950, -6401, -7661, -8811, -9651, -9957, -9775, -9364, -8854, -8113, -7011, -5738, -4622, -3700, -2768, -1837, -1214, -1066, -1210, -1476, -1971, -2857, -4059, -5374, -6721, -8153, -9607, -10910, -11960, -12819, -13549, -14082, -14302, -14166, -13759, -13210, -12574, -11782, -10781, -9693, -8713, -7870, -7060, -6270, -5629, -5222, -4994, -4878, -4915, -5158, -5541, -5955, -6391, -6945, -7655, -8391, -8982, -9390, -9700, -9964, -10108, -10045, -9784, -9388, -8870, -8192, -7383, -6549, -5753, -4979, -4209, -3505, -2929, -2470, -2101, -1843, -1737, -1768, -1894, -2099, -2386, -2724, -3089, -3510, -4016, -4539, -4959, -5261, -5537, -5828, -6040, -6083, -5993, -5861, -5686, -5379, -4913, -4384, -3903, -3455, -2964, -2450, -2016, -1706, -1465, -1277, -1220, -1328, -1508, -1666, -1849, -2171, -2632, -3103, -3500, -3865, -4261, -4660, -4992, -5249, -5469, -5639, -5694, -5598, -5391, -5154, -4909, -4604, -4186, -3702, -3255, -2901, -2607, -2341, -2120, -1981, -1924, -1923, -1976, -2092, -2258, -2431, -2590, -2729, -2838, -2932, -3051, -3202, -3316, -3342, -3311, -3291, -3297, -3289, -3222, -3069, -2837, -2580, -2363, -2202, -2052, -1845, -1574, -1321, -1199, -1211, -1230, -1152, -1026, -994, -1087, -1192, -1216, -1219, -1276, -1340, -1337, -1333, -1417, -1534, -1570, -1542, -1546, -1579, -1565, -1503, -1461, -1442, -1367, -1189, -965, -784, -652, -483, -213, 112, 383, 540, 641, 771, 931, 1040, 1068, 1056, 1022, 922, 781, 703, 709, 701, 610, 486, 391, 334, 301, 277, 264, 296, 403, 544, 664, 803, 1040, 1329, 1528, 1611, 1726, 1972, 2234, 2335, 2313, 2360, 2542, 2719, 2752, 2643, 2468, 2309, 2201, 2100, 1927, 1698, 1486, 1298, 1129, 1054, 1113, 1180, 1167, 1204, 1432, 1745, 1962, 2108, 2343, 2680, 2966, 3117, 3220, 3381, 3530, 3471, 3170, 2853, 2696, 2555, 2216, 1763, 1432, 1236, 1015, 754, 582, 509, 421, 309, 293, 414, 565, 650, 719, 877, 1108, 1278, 1335, 1429, 1678, 1964, 2094, 2089, 2100, 2128, 2046, 1847, 1621, 1379, 1073, 710, 328, -68, -460, -782, -992, -1090, -1092, -1052, -1016, -919, -647, -241, 118, 364, 593, 878, 1196, 1517, 1796, 1949, 1962, 1938, 1934, 1878, 1705, 1446, 1131, 772, 419, 128, -115, -325, -438, -415, -310, -183, -1, 297, 688, 1068, 1379, 1667, 2029, 2491, 2958, 3323, 3572, 3755, 3882, 3942, 3952, 3903, 3715, 3359, 2942, 2601, 2374, 2228, 2102, 1942, 1798, 1818, 2037, 2296, 2498, 2758, 3164, 3602, 3956, 4271, 4603, 4874, 5010, 5052, 5052, 4970, 4759, 4466, 4155, 3801, 3361, 2903, 2561, 2368, 2231, 2085, 1976, 1977, 2091, 2272, 2470, 2661, 2855, 3098, 3401, 3674, 3788, 3750, 3692, 3681, 3608, 3371, 3022, 2668, 2287, 1809, 1305, 925, 638, 289, -77, -235, -154, -69, -81, -37, 140, 326, 459, 628, 863, 1056, 1136, 1132, 1086, 1006, 891, 739, 520, 207, -161, -498, -740, -915, -1094, -1304, -1495, -1603, -1612, -1547, -1459, -1370, -1265, -1115, -903, -636, -354, -113, 45, 134, 168, 141, 43, -99, -279, -520, -820, -1121, -1372, -1562, -1666, -1670, -1629, -1600, -1569, -1503, -1417, -1322, -1192, -1026, -871, -734, -578, -417, -278, -115, 138, 432, 622, 673, 704, 785, 817, 706, 520, 349, 152, -111, -347, -482, -602, -782, -920, -910, -819, -751, -669, -485, -235, -16, 175, 425, 718, 932, 1012, 1031, 1058, 1073, 1056, 1024, 977, 910, 841, 779, 715, 669, 669, 668, 583, 419, 269, 165, 54, -85, -198, -252, -314, -418, -484, -442, -357, -294, -174, 70, 338, 486, 565, 721, 953, 1105, 1121, 1114, 1175, 1233, 1202, 1113, 1029, 927, 787, 657, 565, 440, 239, 25, -103, -153, -206, -308, -403, -392, -273, -161, -115, -35, 142, 309, 363, 387, 483, 595, 651, 727, 924, 1183, 1379, 1487, 1568, 1628, 1617, 1524, 1381, 1202, 968, 709, 498, 377, 307, 243, 197, 196, 234, 308, 445, 641, 819, 926, 1028, 1206, 1427, 1605, 1731, 1840, 1927, 1998, 2087, 2169, 2157, 2054, 1961, 1905, 1841, 1759, 1700, 1651, 1571, 1485, 1437, 1424, 1425, 1453, 1530, 1628, 1707, 1791, 1943, 2168, 2386, 2517, 2570, 2608, 2639, 2614, 2533, 2450, 2357, 2192, 1992, 1880, 1861, 1784, 1602, 1453, 1448, 1545, 1653, 1741, 1797, 1828, 1877, 1979, 2107, 2211, 2266, 2276, 2267, 2279, 2326, 2356, 2301, 2170, 2047, 1978, 1912, 1783, 1594, 1408, 1252, 1109, 967, 839, 740, 671, 638, 646, 667, 672, 667, 682, 699, 680, 638, 636, 659, 618, 497, 386, 332, 254, 76, -137, -275, -348, -455, -613, -734, -766, -782, -855, -940, -954, -900, -852, -833, -796, -711, -607, -507, -402, -293, -206, -150, -92, -28, -9, -59, -112, -104, -71, -120, -263, -394, -440, -475, -598, -779, -890, -904, -920, -1002, -1076, -1055, -978, -925, -874, -746, -575, -470, -427, -321, -135, -15, -35, -79, -45, 15, 13, -44, -107, -182, -272, -333, -333, -331, -388, -467, -485, -461, -455, -454, -415, -370, -365, -382, -377, -356, -343, -341, -346, -346, -311, -252, -236, -287, -338, -341, -352, -431, -537, -601, -636, -693, -759, -767, -714, -669, -654, -605, -496, -434, -515, -643, -649, -575, -638, -878, -1083, -1129, -1147, -1249, -1337, -1312, -1250, -1248, -1263, -1215, -1142, -1115, -1117, -1086, -1046, -1072, -1158, -1226, -1274, -1352, -1463, -1563, -1654, -1752, -1847, -1940, -2044, -2121, -2147, -2183, -2262, -2300, -2253, -2231, -2313, -2382, -2305, -2160, -2116, -2156, -2126, -2011, -1958, -2016, -2042, -1977, -1963, -2098, -2266, -2338, -2380, -2508, -2691, -2812, -2836, -2827, -2837, -2859, -2857, -2830, -2821, -2828, -2810, -2777, -2800, -2871, -2888, -2849, -2876, -3003, -3098, -3095, -3107, -3222, -3365, -3442, -3471, -3525, -3616, -3695, -3729, -3738, -3776, -3829, -3807, -3698, -3615, -3633, -3668, -3638, -3595, -3591, -3572, -3516, -3504, -3572, -3630, -3610, -3584, -3627, -3702, -3724, -3698, -3694, -3729, -3752, -3749, -3777, -3866, -3968, -4029, -4067, -4125, -4200, -4252, -4249, -4207, -4145, -4051, -3908, -3746, -3617, -3506, -3352, -3162, -3032, -3010, -3024, -2998, -2962, -2968, -3018, -3061, -3078, -3086, -3098, -3100, -3076, -3035, -2995, -2959, -2904, -2814, -2705, -2611, -2542, -2469, -2358, -2239, -2156, -2110, -2064, -2000, -1924, -1841, -1764, -1735, -1765, -1788, -1736, -1638, -1577, -1569, -1547, -1453, -1314, -1214, -1170, -1098, -935, -758, -660, -593, -446, -251, -142, -122, -79, 19, 100, 140, 180, 228, 237, 210, 212, 279, 368, 432, 482, 542, 610, 683, 782, 888, 955, 985, 1021, 1069, 1116, 1174, 1232, 1243, 1220, 1243, 1316, 1359, 1379, 1450, 1547, 1579, 1587, 1685, 1852, 1961, 1992, 2040, 2140, 2223, 2248, 2251, 2265, 2254, 2200, 2155, 2158, 2159, 2108, 2045, 2037, 2082, 2131, 2162, 2189, 2238, 2309, 2363, 2382, 2411, 2478, 2511, 2446, 2360, 2367, 2402, 2319, 2151, 2077, 2140, 2191, 2132, 2072, 2123, 2214, 2218, 2161, 2160, 2211, 2225, 2195, 2199, 2246, 2259, 2218, 2184, 2191, 2191, 2159, 2144, 2169, 2172, 2110, 2049, 2059, 2092, 2055, 1954, 1872, 1854, 1859, 1847, 1827, 1835, 1855, 1851, 1832, 1842, 1892, 1926, 1927, 1933, 1941, 1878, 1741, 1630, 1602, 1579, 1492, 1400, 1387, 1433, 1461, 1458, 1470, 1514, 1556, 1567, 1551, 1532, 1514, 1485, 1442, 1400, 1378, 1381, 1385, 1361, 1320, 1302, 1303, 1287, 1250, 1229, 1233, 1225, 1192, 1175, 1202, 1227, 1204, 1169, 1173, 1182, 1138, 1073, 1053, 1065, 1045, 1005, 1005, 1051, 1100, 1142, 1188, 1238, 1282, 1326, 1376, 1433, 1483, 1500, 1473, 1440, 1442, 1464, 1447, 1379, 1303, 1251, 1227, 1221, 1209, 1166, 1120, 1112, 1120, 1100, 1092, 1160, 1258, 1285, 1240, 1218, 1260, 1318, 1336, 1317, 1279, 1235, 1207, 1210, 1205, 1142, 1043, 990, 995, 993, 957, 941, 963, 965, 922, 889, 914, 944, 924, 880, 871, 878, 846, 794, 786, 813, 818, 795, 775, 754, 715, 676, 642, 586, 522, 485, 468, 453, 457, 470, 423, 324, 278, 301, 286, 198, 134, 131, 129, 98, 81, 83, 78, 67, 50, 5, -50, -68, -50, -47, -79, -119, -154, -188, -196, -166, -142, -168, -237, -297, -309, -275, -234, -225, -236, -225, -190, -174, -173, -135, -53, 16, 46, 49, 36, 5, -44, -115, -212, -306, -361, -393, -450, -543, -622, -649, -609, -520, -437, -401, -364, -247, -81, 22, 37, 50, 105, 155, 142, 89, 39, 2, -36, -85, -151, -229, -295, -313, -304, -326, -384, -403, -342, -259, -222, -215, -187, -135, -98, -86, -77, -76, -114, -187, -248, -278, -313, -385, -471, -537, -575, -600, -623, -640, -639, -607, -560, -522, -498, -475, -443, -385, -295, -222, -233, -303, -335, -302, -287, -349, -437, -480, -501, -555, -635, -690, -714, -743, -768, -745, -682, -630, -608, -575, -515, -471, -464, -453, -402, -349, -354, -411, -465, -488, -501, -521, -526, -505, -480, -480, -480, -441, -362, -286, -243, -212, -170, -129, -107, -101, -99, -113, -164, -245, -334, -415, -485, -534, -561, -594, -644, -669, -627, -531, -447, -399, -343, -232, -81, 42, 100, 137, 218, 333, 392, 330, 198, 115, 98, 45, -98, -257, -362, -443, -528, -568, -558, -563, -589, -548, -415, -273, -188, -127, -38, 75, 187, 289, 366, 398, 377, 340, 302, 242, 145, 54, 4, -20, -43, -63, -75, -83, -73, -29, 27, 57, 68, 96, 142, 169, 159, 134, 135, 174, 210, 186, 122, 100, 151, 209, 212, 186, 182, 205, 239, 281, 337, 380, 392, 393, 417, 459, 477, 460, 431, 408, 398, 407, 416, 392, 350, 360, 430, 491, 520, 559, 614, 646, 661, 696, 737, 763, 798, 846, 841, 770, 707, 696, 679, 613, 544, 516, 498, 440, 353, 292, 278, 269, 219, 156, 159, 235, 302, 310, 312, 364, 441, 493, 517, 524, 520, 525, 560, 588, 555, 484, 441, 433, 388, 278, 168, 128, 127, 102, 54, 20, -9, -52, -79, -58, -6, 49, 105, 159, 193, 220, 292, 415, 520, 552, 555, 603, 675, 691, 634, 559, 491, 398, 266, 126, 6, -79, -145, -222, -314, -356, -296, -200, -168, -181, -145, -45, 39, 50, 13, -9, 11, 50, 54, -9, -111, -173, -166, -157, -218, -308, -332, -290, -289, -371, -462, -486, -467, -472, -521, -569, -576, -548, -524, -536, -573, -591, -559, -521, -537, -585, -593, -577, -604, -643, -621, -586, -625, -688, -677, -632, -631, -631, -573, -509, -507, -516, -486, -452, -452, -454, -433, -433, -503, -608, -659, -616, -540, -510, -524, -516, -463, -410, -386, -346, -252, -139, -65, -17, 49, 131, 168, 131, 74, 45, 24, -22, -100, -203, -299, -338, -320, -339, -411, -396, -215, -15, 34, 0, 66, 254, 432, 517, 547, 580, 627, 682, 726, 705, 603, 495, 447, 370, 178, -22, -75, -30, -35, -85, -101, -104, -119, -77, 49, 169, 231, 289, 381, 479, 569, 637, 646, 606, 562, 477, 298, 100, -69, -295, -556, -630, -463, -283, -142, 216, 813, 1311, 1600, 1998, 2643, 3194, 3328, 3122, 2767, 2195, 1283, 189, -822, -1745, -2684, -3485, -3858, -3782, -3451, -2959, -2334, -1663, -976, -212, 544, 1094, 1431, 1720, 2001, 2178, 2208, 2062, 1644, 961, 199, -531, -1379, -2478, -3685, -4698, -5339, -5579, -5356, -4566, -3248, -1678, -151, 1247, 2587, 3858, 4890, 5512, 5702, 5551, 5137, 4470, 3562, 2479, 1321, 168, -934, -1926, -2727, -3275, -3573, -3657, -3521, -3133, -2517, -1795, -1094, -415, 339, 1152, 1832, 2204, 2268, 2127, 1872, 1607, 1365, 1033, 528, -41, -583, -1137, -1586, -1707, -1661, -1812, -1972, -1655, -1040, -713, -598, -169, 457, 726, 626, 572, 604, 469, 133, -308, -882, -1560, -2125, -2485, -2790, -3136, -3379, -3376, -3203, -2971, -2598, -2012, -1404, -978, -635, -206, 226, 529, 727, 752, 380, -361, -1090, -1601, -2092, -2709, -3239, -3380, -3079, -2462, -1640, -670, 358, 1268, 1871, 2129, 2162, 2041, 1696, 1104, 406, -233, -718, -966, -980, -940, -995, -1019, -824, -463, -60, 414, 942, 1351, 1601, 1856, 2105, 2086, 1705, 1160, 623, 104, -381, -756, -923, -775, -296, 310, 833, 1354, 2054, 2840, 3413, 3598, 3386, 2895, 2396, 2104, 1862, 1377, 720, 199, -184, -699, -1351, -1837, -2053, -2221, -2442, -2429, -1889, -910, 202, 1320, 2447, 3421, 3964, 3957, 3496, 2691, 1613, 371, -889, -2047, -3000, -3672, -4040, -4117, -3930, -3528, -3026, -2575, -2211, -1792, -1155, -294, 689, 1668, 2451, 2843, 2837, 2553, 1977, 1077, 114, -602, -1124, -1621, -1974, -2057, -2085, -2284, -2548, -2739, -2894, -2892, -2446, -1539, -438, 744, 2021, 3147, 3743, 3697, 3189, 2435, 1564, 604, -458, -1450, -2003, -1980, -1653, -1253, -704, 13, 636, 1001, 1294, 1699, 2112, 2351, 2400, 2333, 2208, 2068, 1920, 1734, 1484, 1181, 873, 638, 568, 673, 883, 1164, 1479, 1635, 1409, 870, 347, 43, -84, -62, 203, 745, 1461, 2204, 2814, 3122, 3041, 2591, 1799, 714, -500, -1584, -2283, -2388, -1832, -822, 356, 1676, 3154, 4433, 5012, 4792, 3921, 2404, 378, -1588, -2947, -3533, -3274, -2174, -670, 740, 2121, 3546, 4360, 3918, 2620, 1351, 409, -288, -554, -197, 555, 1355, 2075, 2584, 2620, 2120, 1380, 696, 42, -710, -1389, -1586, -1062, 90, 1585, 3031, 4019, 4394, 4362, 4174, 3798, 3117, 2266, 1553, 1113, 817, 506, 167, -168, -540, -955, -1296, -1393, -1100, -346, 775, 1998, 3091, 3966, 4448, 4253, 3358, 2071, 649, -780, -1893, -2261, -1843, -971, 97, 1258, 2312, 2992, 3129, 2592, 1308, -479, -2170, -3210, -3407, -2850, -1738, -391, 812, 1668, 2251, 2595, 2461, 1653, 410, -844, -1927, -2743, -3040, -2717, -2110, -1601, -1198, -749, -281, 47, 68, -320, -964, -1497, -1790, -2055, -2363, -2460, -2222, -1769, -1098, -84, 1098, 2037, 2512, 2531, 2043, 1038, -249, -1506, -2629, -3627, -4336, -4452, -3870, -2823, -1656, -582, 347, 1138, 1770, 2055, 1730, 866, -44, -703, -1332, -2090, -2644, -2735, -2681, -2837, -2994, -2722, -2025, -1259, -655, -215, 68, 158, 92, -62, -323, -614, -604, -38, 878, 1812, 2685, 3374, 3494, 2934, 2063, 1060, -288, -1896, -3246, -4075, -4434, -4225, -3429, -2448, -1569, -606, 440, 1100, 1188, 1033, 747, 127, -662, -1129, -1129, -851, -334, 402, 1013, 1119, 770, 284, -190, -721, -1357, -2007, -2531, -2812, -2769, -2443, -2052, -1823, -1773, -1743, -1618, -1354, -923, -442, -166, -207, -430, -705, -1042, -1419, -1787, -2275, -3070, -4014, -4605, -4494, -3774, -2691, -1304, 322, 1840, 2828, 3197, 3054, 2364, 1069, -665, -2565, -4302, -5359, -5354, -4565, -3542, -2366, -916, 468, 1369, 1902, 2265, 2216, 1650, 1062, 863, 786, 378, -392, -1220, -1735, -1713, -1343, -1142, -1347, -1661, -1729, -1526, -1197, -866, -616, -323, 313, 1300, 2172, 2529, 2458, 2183, 1690, 917, 8, -824, -1465, -1890, -2117, -2118, -1735, -820, 470, 1752, 2776, 3494, 3776, 3383, 2333, 1021, -158, -1138, -1984, -2565, -2679, -2395, -1978, -1562, -1133, -757, -546, -419, -161, 266, 696, 1054, 1411, 1652, 1424, 664, -188, -773, -1215, -1650, -1860, -1698, -1349, -946, -462, -59, 51, 22, 106, 198, 152, 131, 271, 482, 786, 1218, 1401, 968, 239, -253, -604, -1145, -1677, -1765, -1382, -718, 237, 1458, 2648, 3469, 3759, 3481, 2762, 1954, 1417, 1273, 1425, 1697, 1935, 2127, 2359, 2524, 2291, 1598, 834, 361, 206, 368, 946, 1854, 2855, 3889, 4930, 5676, 5853, 5575, 5041, 4265, 3388, 2747, 2416, 2185, 2030, 2048, 2082, 1912, 1722, 1811, 2063, 2137, 2009, 1977, 2243, 2745, 3332, 3867, 4210, 4246, 3993, 3577, 3091, 2547, 2009, 1605, 1388, 1327, 1370, 1411, 1333, 1168, 1078, 1061, 952, 779, 790, 1048, 1321, 1410, 1300, 1012, 566, 44, -480, -1019, -1547, -1961, -2197, -2244, -2049, -1587, -996, -467, -67, 210, 340, 286, 37, -395, -942, -1473, -1961, -2511, -3106, -3508, -3587, -3540, -3566, -3565, -3339, -2949, -2618, -2389, -2085, -1624, -1181, -962, -964, -1054, -1200, -1483, -1919, -2414, -2874, -3252, -3465, -3414, -3147, -2860, -2671, -2489, -2190, -1826, -1584, -1584, -1791, -2061, -2231, -2214, -2047, -1848, -1701, -1597, -1483, -1372, -1348, -1493, -1814, -2223, -2557, -2687, -2611, -2410, -2099, -1646, -1150, -867, -962, -1281, -1539, -1697, -1979, -2470, -2903, -2952, -2601, -2090, -1585, -1062, -479, 54, 360, 365, 151, -181, -606, -1121, -1644, -2060, -2333, -2509, -2590, -2482, -2111, -1553, -1006, -634, -452, -352, -208, 39, 325, 495, 462, 351, 399, 657, 864, 726, 295, -81, -189, -162, -249, -477, -647, -599, -407, -275, -222, -41, 350, 702, 764, 684, 745, 892, 824, 502, 237, 251, 387, 361, 144, -8, 92, 347, 535, 621, 757, 1005, 1223, 1263, 1161, 1036, 857, 507, 31, -328, -435, -401, -365, -319, -235, -182, -211, -278, -350, -447, -567, -691, -821, -943, -1036, -1114, -1188, -1165, -961, -692, -555, -530, -411, -161, -13, -119, -267, -161, 112, 140, -274, -834, -1138, -1195, -1367, -1858, -2410, -2604, -2369, -2024, -1812, -1613, -1257, -922, -935, -1277, -1571, -1583, -1507, -1644, -1943, -2027, -1671, -1122, -829, -931, -1129, -1114, -954, -930, -1086, -1167, -1067, -1004, -1052, -874, -281, 315, 409, 115, -78, -74, -217, -661, -1127, -1345, -1406, -1483, -1456, -1106, -521, -52, 141, 280, 593, 945, 983, 613, 157, -52, -97, -301, -658, -726, -215, 512, 858, 789, 845, 1245, 1463, 1013, 239, -127, 52, 273, 190, 69, 409, 1283, 2201, 2638, 2646, 2709, 2996, 3122, 2785, 2229, 1879, 1828, 1862, 1793, 1614, 1469, 1514, 1755, 2026, 2163, 2136, 2001, 1812, 1651, 1639, 1781, 1866, 1721, 1499, 1488, 1673, 1809, 1899, 2137, 2432, 2472, 2260, 2077, 2024, 2001, 1956, 1859, 1726, 1734, 1938, 1947, 1503, 1071, 1130, 1308, 1032, 575, 576, 1000, 1309, 1304, 1286, 1593, 2223, 2729, 2652, 2226, 2176, 2606, 2749, 2189, 1548, 1485, 1655, 1312, 479, -92, -2, 309, 266, -12, 88, 795, 1657, 2175, 2408, 2712, 3129, 3334, 3110, 2575, 1933, 1210, 355, -493, -1048, -1178, -1072, -976, -850, -450, 247, 895, 1156, 1084, 948, 758, 294, -396, -935, -1158, -1317, -1493, -1273, -433, 504, 902, 888, 1040, 1363, 1203, 290, -702, -1039, -1014, -1544, -2678, -3300, -2695, -1688, -1476, -1913, -1888, -1105, -423, -439, -691, -534, -60, 307, 626, 1286, 2218, 2838, 2849, 2631, 2660, 2813, 2544, 1604, 388, -493, -834, -894, -908, -727, -75, 993, 2105, 2959, 3569, 4040, 4299, 4156, 3618, 2979, 2479, 1993, 1270, 433, -58, -30, 133, -3, -332, -435, -304, -378, -810, -1190, -1200, -1040, -955, -874, -705, -437, 35, 630, 864, 565, 318, 500, 578, 107, -442, -515, -295, -154, -94, -40, -24, -35, -176, -683, -1424, -1985, -2448, -3206, -3983, -4094, -3564, -2963, -2342, -1400, -344, 377, 855, 1385, 1782, 1632, 945, 114, -516, -925, -1379, -2055, -2681, -2864, -2735, -2739, -2821, -2473, -1677, -1097, -1112, -1236, -824, 11, 521, 292, -247, -367, 43, 383, 153, -403, -685, -539, -396, -634, -1106, -1468, -1753, -2391, -3631, -5187, -6556, -7536, -8270, -8855, -9145, -8958, -8286, -7221, -5794, -4018, -2040, -146, 1396, 2431, 2912, 2950, 2783, 2481, 1758, 372, -1367, -2887, -3963, -4687, -5083, -5168, -5100, -4851, -4070, -2632, -904, 749, 2264, 3628, 4826, 5943, 6924, 7522, 7774, 8039, 8301, 8117, 7427, 6695, 6166, 5702, 5319, 5164, 5070, 4781, 4488, 4609, 5181, 5875, 6472, 6975, 7385, 7670, 7938, 8367, 8906, 9279, 9377, 9396, 9487, 9539, 9484, 9533, 9825, 10036, 9682, 8779, 7952, 7670, 7558, 6832, 5441, 4245, 3804, 3621, 3068, 2493, 2632, 3381, 3967, 4178, 4603, 5555, 6470, 6694, 6306, 5740, 5044, 4012, 2711, 1354, -8, -1335, -2464, -3330, -3937, -4146, -3918, -3577, -3380, -3199, -2990, -3025, -3315, -3543, -3730, -4245, -4990, -5391, -5309, -5239, -5468, -5688, -5580, -5326, -5374, -5889, -6625, -7271, -7795, -8394, -9155, -9871, -10228, -10183, -10012, -9946, -9858, -9500, -8919, -8381, -8007, -7694, -7377, -7069, -6735, -6348, -6037, -5959, -6044, -6076, -6067, -6285, -6814, -7347, -7628, -7810, -8131, -8452, -8410, -7849, -6976, -6174, -5619, -4995, -3891, -2598, -1901, -1935, -1985, -1665, -1451, -1777, -2426, -3018, -3372, -3397, -3227, -3230, -3442, -3420, -2995, -2560, -2366, -2242, -2100, -2064, -2096, -2065, -2049, -2091, -2002, -1752, -1613, -1636, -1515, -1144, -834, -835, -1044, -1242, -1360, -1493, -1800, -2313, -2790, -2978, -2964, -3036, -3247, -3387, -3321, -3126, -2888, -2610, -2344, -2206, -2184, -2088, -1817, -1501, -1290, -1165, -1098, -1200, -1503, -1809, -1965, -2124, -2525, -3157, -3776, -4154, -4252, -4168, -3971, -3627, -3125, -2583, -2141, -1759, -1260, -692, -443, -782, -1371, -1647, -1620, -1818, -2386, -2825, -2788, -2556, -2452, -2288, -1751, -1022, -622, -728, -935, -807, -501, -561, -1108, -1583, -1487, -1062, -880, -971, -798, -116, 603, 840, 750, 818, 1073, 1106, 781, 404, 244, 274, 338, 357, 442, 826, 1476, 1949, 1980, 1923, 2155, 2470, 2507, 2321, 2079, 1780, 1559, 1650, 1890, 1963, 2000, 2275, 2560, 2522, 2388, 2531, 2785, 2760, 2428, 2069, 1918, 2081, 2446, 2730, 2836, 2996, 3356, 3708, 3859, 3897, 3905, 3747, 3326, 2819, 2519, 2548, 2759, 2853, 2699, 2541, 2739, 3272, 3724, 3798, 3616, 3528, 3730, 4054, 4124, 3825, 3556, 3755, 4245, 4435, 4159, 3858, 3873, 3979, 3819, 3443, 3140, 2920, 2549, 2032, 1733, 1896, 2318, 2589, 2551, 2419, 2557, 3070, 3641, 3863, 3683, 3330, 2909, 2410, 1992, 1846, 1835, 1619, 1097, 529, 289, 573, 1156, 1460, 1114, 437, 89, 295, 665, 740, 463, 143, 47, 72, -84, -343, -182, 575, 1243, 1012, 85, -462, -15, 823, 997, 211, -910, -1635, -1726, -1427, -1197, -1301, -1518, -1508, -1373, -1352, -1148, -377, 489, 593, -5, -426, -176, 449, 979, 1121, 810, 323, 110, 305, 650, 821, 592, -73, -768, -937, -600, -274, -112, 127, 437, 696, 1173, 2022, 2790, 3159, 3435, 3731, 3630, 3155, 2925, 3011, 2822, 2272, 1924, 1958, 2024, 2001, 2137, 2589, 3272, 3905, 4095, 3822, 3693, 4148, 4740, 4804, 4389, 4013, 3950, 4197, 4644, 5012, 5104, 5124, 5309, 5454, 5343, 5232, 5357, 5372, 4866, 4072, 3555, 3490, 3615, 3667, 3590, 3433, 3260, 3152, 3193, 3372, 3493, 3357, 3054, 2891, 2979, 3079, 3016, 2955, 3054, 3094, 2762, 2168, 1734, 1566, 1296, 642, -166, -738, -972, -970, -799, -545, -364, -265, -76, 233, 444, 409, 240, 69, -147, -496, -897, -1177, -1265, -1228, -1165, -1138, -1185, -1288, -1325, -1193, -1016, -1094, -1534, -2044, -2232, -2067, -1853, -1820, -1886, -1835, -1565, -1153, -750, -472, -333, -226, -63, 64, -6, -211, -305, -271, -333, -522, -649, -737, -920, -1001, -780, -632, -991, -1472, -1357, -718, -236, -61, 302, 974, 1455, 1628, 2085, 2981, 3436, 2802, 1771, 1346, 1340, 892, -30, -623, -552, -326, -323, -236, 228, 823, 1240, 1502, 1585, 1358, 1074, 1101, 1182, 872, 484, 576, 903, 923, 796, 962, 1245, 1202, 836, 419, 76, -141, -198, -236, -417, -594, -493, -212, -137, -317, -362, -143, -126, -666, -1342, -1476, -1116, -886, -897, -596, 7, 34, -678, -934, -188, 237, -699, -2020, -2532, -2715, -3321, -3852, -3720, -3367, -3250, -3078, -2653, -2231, -1805, -1057, -197, 78, -403, -978, -1051, -846, -954, -1480, -2025, -2342, -2526, -2619, -2490, -2186, -1995, -2025, -2087, -2117, -2296, -2561, -2533, -2228, -2227, -2746, -3147, -2841, -2107, -1598, -1491, -1497, -1368, -1161, -1153, -1469, -1817, -1847, -1699, -1794, -2128, -2253, -1941, -1462, -1151, -1074, -1236, -1661, -2027, -1810, -1272, -1512, -2708, -3377, -2535, -1290, -954, -978, -317, 583, 745, 342, 87, -43, -397, -834, -1218, -1932, -3011, -3464, -2592, -1388, -1258, -1822, -1632, -707, -479, -1257, -1715, -1248, -1028, -2005, -3334, -3816, -3715, -3862, -4056, -3838, -3831, -4616, -5298, -4878, -4051, -3974, -4293, -3965, -3146, -2806, -3041, -3001, -2265, -1408, -1117, -1389, -1796, -2121, -2351, -2383, -2176, -2001, -2158, -2513, -2608, -2155, -1333, -518, 216, 1083, 2009, 2549, 2716, 3206, 4262, 5074, 5003, 4587, 4591, 4844, 4860, 4859, 5282, 5828, 5907, 5738, 6022, 6689, 6991, 6873, 7088, 7733, 7954, 7498, 7278, 7882, 8673, 8868, 8623, 8589, 8998, 9469, 9501, 9096, 8793, 8936, 9123, 8843, 8284, 7978, 7970, 7875, 7523, 7110, 6809, 6631, 6492, 6259, 5844, 5391, 5184, 5238, 5176, 4764, 4326, 4231, 4236, 3865, 3255, 2889, 2700, 2211, 1420, 796, 456, 25, -713, -1522, -2058, -2276, -2463, -2901, -3470, -3776, -3774, -3857, -4208, -4544, -4683, -4835, -5155, -5522, -5871, -6270, -6691, -7102, -7513, -7777, -7793, -7929, -8487, -8953, -8776, -8478, -8764, -9221, -9161, -8917, -9061, -9278, -9132, -8986, -9182, -9288, -8949, -8600, -8704, -8962, -8855, -8490, -8369, -8586, -8741, -8588, -8339, -8230, -8195, -8095, -7948, -7790, -7531, -7172, -6871, -6660, -6337, -5841, -5444, -5280, -5041, -4488, -3929, -3754, -3776, -3558, -3159, -3012, -3129, -3047, -2698, -2593, -2844, -2866, -2444, -2146, -2200, -2096, -1676, -1382, -1203, -695, -94, -16, -218, 16, 572, 780, 608, 542, 648, 616, 410, 295, 353, 394, 286, 138, 128, 222, 239, 142, 103, 153, 121, 34, 172, 521, 679, 532, 454, 595, 666, 591, 613, 650, 315, -288, -579, -431, -404, -834, -1305, -1305, -963, -775, -865, -926, -801, -675, -655, -579, -425, -487, -880, -1204, -1114, -915, -1095, -1511, -1568, -1176, -895, -1071, -1355, -1304, -1036, -950, -1106, -1244, -1260, -1244, -1201, -1060, -904, -859, -796, -503, -108, -1, -271, -530, -445, -170, -61, -177, -327, -394, -364, -189, 123, 387, 422, 325, 358, 574, 742, 684, 497, 356, 303, 315, 439, 707, 1013, 1192, 1222, 1241, 1371, 1574, 1708, 1722, 1692, 1661, 1562, 1382, 1334, 1660, 2210, 2451, 2169, 1872, 2116, 2643, 2754, 2364, 2021, 1993, 2040, 2064, 2321, 2802, 3027, 2820, 2727, 3183, 3759, 3836, 3549, 3348, 3175, 2843, 2625, 2757, 2941, 2946, 2994, 3163, 3174, 3084, 3375, 4032, 4280, 3656, 2784, 2639, 3288, 3812, 3534, 2906, 2836, 3395, 3827, 3735, 3502, 3410, 3174, 2656, 2296, 2364, 2457, 2181, 1819, 1851, 2195, 2390, 2352, 2458, 2868, 3129, 2719, 1848, 1243, 1158, 1093, 663, 178, 80, 300, 576, 902, 1308, 1585, 1555, 1323, 1076, 873, 663, 323, -238, -872, -1181, -953, -457, -116, -13, 127, 502, 939, 1082, 835, 486, 316, 264, 120, -103, -237, -212, 1, 430, 856, 904, 634, 576, 917, 1152, 854, 288, 14, 236, 703, 1036, 1126, 1301, 1867, 2526, 2713, 2433, 2204, 2204, 2114, 1773, 1409, 1244, 1311, 1592, 2025, 2447, 2787, 3158, 3594, 3848, 3720, 3462, 3472, 3664, 3547, 3010, 2586, 2733, 3222, 3562, 3666, 3798, 4004, 4095, 4066, 4099, 4138, 3952, 3619, 3431, 3391, 3302, 3272, 3575, 4062, 4312, 4319, 4482, 4805, 4768, 4240, 3833, 3899, 3864, 3222, 2480, 2324, 2571, 2730, 2841, 3065, 3173, 3035, 2992, 3207, 3315, 3030, 2614, 2419, 2367, 2231, 2105, 2223, 2473, 2487, 2216, 1991, 1965, 1903, 1581, 1085, 584, 99, -349, -578, -408, 37, 381, 449, 525, 963, 1622, 2009, 1922, 1597, 1220, 715, 70, -562, -1064, -1404, -1620, -1906, -2334, -2499, -2075, -1571, -1691, -2096, -1876, -1093, -725, -1042, -1181, -562, 213, 363, 49, -81, 24, -83, -545, -1161, -1868, -2613, -3063, -3050, -2937, -3026, -2962, -2318, -1464, -1120, -1218, -1028, -461, -289, -842, -1465, -1632, -1603, -1656, -1594, -1342, -1177, -1170, -1078, -901, -926, -1222, -1607, -2098, -2837, -3525, -3573, -3095, -3007, -3655, -4093, -3413, -2109, -1339, -1392, -1613, -1423, -926, -672, -993, -1530, -1622, -1269, -1221, -1830, -2411, -2189, -1472, -1245, -1774, -2304, -2182, -1663, -1345, -1390, -1584, -1671, -1415, -813, -329, -352, -540, -311, 128, 30, -675, -1207, -1195, -1320, -2209, -3372, -3968, -4064, -4287, -4715, -4965, -4954, -4785, -4294, -3417, -2594, -2276, -2315, -2270, -2037, -1834, -1823, -2061, -2618, -3369, -3846, -3806, -3724, -4146, -4784, -4984, -4790, -4771, -5048, -5244, -5196, -5078, -4944, -4694, -4361, -4066, -3761, -3292, -2702, -2250, -2076, -2072, -2129, -2268, -2496, -2751, -3032, -3341, -3577, -3707, -3828, -3866, -3594, -3095, -2717, -2518, -2281, -2064, -2054, -1970, -1371, -539, -249, -543, -520, 366, 1463, 1869, 1717, 1793, 2189, 2198, 1544, 894, 842, 1035, 842, 399, 317, 702, 1184, 1646, 2211, 2794, 3297, 3858, 4414, 4600, 4459, 4503, 4824, 4935, 4637, 4245, 3970, 3798, 3791, 3901, 3723, 3047, 2360, 2273, 2659, 2881, 2715, 2568, 2753, 3070, 3275, 3541, 4064, 4512, 4395, 3859, 3527, 3517, 3299, 2670, 2110, 1872, 1551, 962, 572, 621, 669, 432, 280, 466, 584, 243, -241, -306, 0, 62, -408, -933, -922, -509, -347, -658, -1018, -1098, -1124, -1379, -1703, -1842, -1977, -2428, -2993, -3114, -2745, -2466, -2578, -2675, -2373, -1931, -1757, -1799, -1766, -1624, -1514, -1456, -1453, -1632, -1979, -2139, -1921, -1745, -2073, -2587, -2594, -2103, -1779, -1897, -2048, -1883, -1531, -1198, -884, -586, -414, -355, -258, -179, -321, -564, -518, -247, -301, -791, -1087, -837, -578, -803, -1029, -617, -45, -268, -1011, -1022, -105, 500, 99, -517, -528, -185, 7, 142, 332, 221, -339, -805, -691, -339, -339, -614, -780, -969, -1459, -1857, -1565, -901, -790, -1396, -1896, -1750, -1348, -1119, -882, -573, -678, -1298, -1625, -1150, -553, -672, -1328, -1885, -2219, -2482, -2490, -2148, -2025, -2588, -3223, -3041, -2371, -2175, -2322, -1961, -1339, -1495, -2293, -2510, -1860, -1387, -1737, -2348, -2518, -2344, -2295, -2444, -2486, -2334, -2307, -2554, -2695, -2446, -2191, -2359, -2622, -2477, -2202, -2342, -2609, -2334, -1723, -1613, -2060, -2221, -1757, -1364, -1560, -1797, -1449, -955, -1117, -1728, -1853, -1288, -816, -966, -1347, -1405, -1206, -1056, -933, -715, -561, -586, -522, -113, 429, 779, 978, 1223, 1427, 1396, 1278, 1341, 1446, 1293, 1069, 1073, 982, 519, 384, 1204, 2145, 2146, 1758, 2120, 2972, 3333, 3285, 3486, 3709, 3310, 2561, 2320, 2653, 2857, 2692, 2609, 2754, 2720, 2551, 2955, 4063, 4894, 4706, 4104, 4027, 4330, 4336, 4240, 4690, 5214, 4616, 3044, 2154, 2812, 3948, 4165, 3382, 2474, 2178, 2642, 3457, 4004, 3989, 3661, 3442, 3550, 3876, 3996, 3592, 2963, 2594, 2273, 1506, 690, 650, 1141, 1137, 527, 148, 341, 694, 1014, 1435, 1761, 1607, 1036, 514, 396, 634, 786, 335, -693, -1577, -1652, -1145, -904, -1365, -2040, -2149, -1600, -1109, -1279, -1789, -1840, -1292, -912, -1305, -2005, -2047, -1273, -579, -752, -1547, -2162, -2185, -1800, -1430, -1450, -1898, -2317, -2213, -1769, -1631, -1919, -1982, -1466, -1016, -1292, -1811, -1696, -1115, -827, -765, -402, -31, -187, -329, 423, 1601, 1877, 1077, 388, 536, 907, 785, 355, 19, -312, -613, -419, 262, 745, 894, 1414, 2435, 3080, 2972, 2962, 3687, 4460, 4352, 3617, 3146, 3042, 2761, 2296, 2136, 2178, 1818, 1165, 1089, 1848, 2640, 2837, 2848, 3282, 3983, 4524, 4981, 5493, 5647, 5184, 4648, 4520, 4386, 3776, 3069, 2765, 2618, 2206, 1778, 1892, 2559, 3217, 3433, 3366, 3503, 4001, 4494, 4640, 4532, 4390, 4180, 3848, 3605, 3611, 3639, 3374, 2891, 2488, 2245, 2079, 2047, 2176, 2110, 1492, 686, 533, 1157, 1654, 1351, 820, 1033, 1887, 2408, 2298, 2307, 2849, 3279, 3007, 2402, 2068, 1977, 1790, 1353, 591, -416, -1148, -1092, -583, -548, -1264, -1920, -1684, -748, 7, 161, 130, 398, 848, 1099, 1113, 1090, 1021, 783, 516, 373, 121, -503, -1218, -1567, -1656, -1931, -2379, -2532, -2155, -1544, -1158, -1128, -1112, -683, 92, 633, 531, 64, -217, -180, -157, -382, -738, -1089, -1523, -2084, -2596, -2992, -3453, -4066, -4703, -5343, -5973, -6228, -5780, -4989, -4486, -4289, -3964, -3314, -2417, -1431, -749, -787, -1398, -2062, -2588, -3103, -3587, -4070, -4922, -6251, -7312, -7266, -6384, -5720, -5647, -5479, -4725, -3784, -3013, -2078, -835, 43, 80, -146, 61, 432, 302, -263, -719, -1032, -1609, -2350, -2624, -2281, -1912, -1830, -1534, -599, 553, 1311, 1801, 2541, 3507, 4129, 4199, 4178, 4433, 4624, 4276, 3637, 3381, 3570, 3587, 3207, 3011, 3428, 4073, 4388, 4413, 4569, 5025, 5587, 5928, 5878, 5661, 5727, 6170, 6506, 6333, 5968, 6024, 6483, 6687, 6299, 5761, 5551, 5497, 5185, 4683, 4359, 4200, 3892, 3482, 3359, 3517, 3501, 3237, 3224, 3616, 3827, 3500, 3113, 3144, 3253, 2905, 2289, 1941, 1767, 1196, 226, -513, -787, -1112, -1812, -2464, -2632, -2588, -2767, -2992, -2831, -2440, -2355, -2590, -2640, -2422, -2495, -3161, -3984, -4475, -4727, -5154, -5877, -6640, -7118, -7209, -7097, -7058, -7178, -7276, -7140, -6814, -6573, -6627, -6892, -7111, -7160, -7143, -7220, -7417, -7630, -7742, -7724, -7672, -7735, -7922, -8024, -7885, -7674, -7668, -7819, -7834, -7637, -7424, -7277, -7083, -6810, -6592, -6507, -6438, -6241, -5928, -5697, -5684, -5699, -5445, -5017, -4843, -5010, -5066, -4729, -4355, -4389, -4654, -4625, -4201, -3802, -3717, -3725, -3481, -3025, -2649, -2414, -2121, -1738, -1507, -1496, -1431, -1158, -954, -1070, -1279, -1223, -948, -774, -811, -858, -700, -356, -59, 25, 40, 247, 610, 838, 843, 853, 985, 1080, 1021, 933, 942, 974, 919, 842, 866, 956, 980, 950, 1025, 1236, 1386, 1333, 1220, 1263, 1404, 1381, 1114, 827, 724, 705, 582, 411, 375, 410, 305, 155, 265, 593, 736, 575, 438, 505, 535, 334, 73, -59, -168, -416, -693, -803, -811, -946, -1183, -1244, -1040, -842, -887, -1039, -1006, -760, -589, -691, -903, -918, -734, -644, -788, -961, -976, -951, -1062, -1201, -1169, -1040, -1063, -1219, -1200, -904, -620, -574, -602, -465, -198, 44, 247, 413, 434, 301, 249, 497, 897, 1076, 902, 682, 792, 1215, 1593, 1664, 1530, 1478, 1627, 1867, 2078, 2259, 2433, 2526, 2563, 2758, 3212, 3657, 3837, 3894, 4079, 4322, 4426, 4414, 4403, 4380, 4314, 4205, 4016, 3834, 3932, 4374, 4777, 4822, 4729, 4904, 5346, 5764, 6059, 6284, 6298, 5944, 5540, 5571, 5889, 5888, 5543, 5380, 5397, 5095, 4621, 4724, 5418, 5770, 5286, 4594, 4490, 4970, 5457, 5575, 5405, 5199, 5079, 5025, 4991, 4955, 4882, 4695, 4281, 3661, 3122, 2953, 3064, 3105, 2909, 2615, 2441, 2514, 2791, 2976, 2789, 2400, 2225, 2272, 2109, 1577, 1085, 965, 968, 692, 231, 6, 100, 158, -33, -289, -405, -482, -682, -957, -1161, -1274, -1381, -1515, -1638, -1718, -1734, -1669, -1576, -1590, -1776, -2034, -2236, -2375, -2505, -2633, -2745, -2839, -2888, -2857, -2775, -2664, -2484, -2222, -2050, -2176, -2460, -2472, -2128, -1912, -2158, -2495, -2482, -2277, -2194, -2103, -1814, -1585, -1692, -1896, -1838, -1614, -1536, -1595, -1556, -1427, -1415, -1476, -1311, -890, -544, -454, -418, -264, -124, -151, -242, -230, -145, -161, -347, -541, -509, -232, 51, 163, 188, 266, 379, 470, 570, 675, 677, 546, 396, 327, 353, 466, 607, 649, 554, 437, 379, 371, 431, 531, 472, 138, -205, -241, -48, 73, 47, -21, -58, -10, 114, 167, 78, 23, 69, 0, -233, -374, -401, -582, -846, -804, -560, -680, -1183, -1364, -882, -350, -423, -852, -979, -738, -566, -585, -601, -645, -858, -1019, -881, -736, -978, -1340, -1258, -844, -790, -1267, -1595, -1238, -582, -361, -687, -1071, -1105, -776, -354, -211, -568, -1148, -1329, -935, -616, -939, -1413, -1228, -647, -547, -862, -841, -494, -355, -274, 97, 298, -93, -412, -9, 482, 188, -532, -733, -347, -115, -388, -689, -484, 53, 305, 126, 32, 363, 796, 994, 1104, 1195, 956, 454, 396, 1024, 1510, 1152, 489, 414, 752, 645, 92, -29, 476, 721, 222, -274, 2, 789, 1389, 1559, 1399, 1131, 1164, 1704, 2243, 2051, 1174, 437, 426, 834, 851, 153, -609, -614, -47, 178, -134, -333, -194, -107, -50, 259, 413, -16, -341, 189, 947, 939, 402, 163, 354, 657, 820, 536, -222, -767, -602, -365, -835, -1554, -1523, -778, -285, -517, -932, -801, -43, 841, 1267, 979, 333, 176, 1023, 2249, 2589, 1667, 506, 118, 123, -521, -1840, -2901, -3468, -4321, -5717, -6748, -6558, -5229, -3260, -1155, 456, 1240, 1728, 2752, 4276, 5290, 4776, 2623, -196, -2374, -3417, -3963, -4789, -5786, -6223, -5710, -4511, -3010, -1443, -167, 509, 983, 1970, 3193, 3533, 2897, 2542, 2991, 3219, 2537, 1711, 1490, 1425, 884, 123, -351, -634, -911, -776, 205, 1594, 2576, 3144, 3992, 5335, 6624, 7352, 7446, 6993, 6210, 5498, 5079, 4729, 4194, 3609, 3308, 3425, 3804, 4179, 4418, 4619, 4870, 5010, 4866, 4607, 4533, 4716, 5117, 5719, 6284, 6477, 6483, 6852, 7515, 7678, 6942, 5784, 4682, 3561, 2356, 1389, 850, 451, -47, -329, 100, 1130, 2038, 2371, 2499, 2888, 3202, 2911, 2428, 2438, 2390, 1210, -645, -1621, -1509, -1675, -2783, -4017, -4663, -5005, -5384, -5586, -5409, -5081, -4842, -4567, -4070, -3521, -3282, -3377, -3505, -3603, -4047, -5053, -6247, -7128, -7701, -8241, -8726, -8957, -8961, -8857, -8626, -8288, -8035, -7894, -7704, -7516, -7568, -7824, -7982, -7970, -7978, -8052, -8046, -7978, -8043, -8255, -8370, -8249, -8099, -8182, -8434, -8553, -8476, -8427, -8483, -8357, -7895, -7439, -7340, -7395, -7194, -6742, -6315, -5966, -5642, -5434, -5367, -5250, -5005, -4850, -4941, -5131, -5244, -5312, -5417, -5520, -5519, -5378, -5108, -4703, -4183, -3630, -3115, -2639, -2176, -1768, -1481, -1329, -1302, -1434, -1713, -1929, -1851, -1585, -1485, -1601, -1580, -1260, -912, -696, -393, 68, 366, 334, 300, 586, 1052, 1316, 1248, 1076, 1113, 1417, 1706, 1696, 1470, 1382, 1589, 1873, 2003, 2072, 2306, 2674, 2891, 2849, 2777, 2879, 2962, 2723, 2276, 2016, 1994, 1909, 1760, 1931, 2454, 2876, 3003, 3177, 3610, 4015, 4064, 3792, 3401, 3031, 2741, 2480, 2127, 1674, 1303, 1197, 1364, 1634, 1786, 1750, 1707, 1829, 1981, 1947, 1841, 1919, 2078, 2009, 1768, 1712, 1889, 1953, 1677, 1233, 912, 805, 754, 572, 300, 143, 156, 218, 351, 696, 1092, 1180, 997, 983, 1258, 1422, 1206, 883, 802, 923, 1012, 1029, 1071, 1116, 1074, 1013, 1091, 1241, 1188, 871, 605, 658, 869, 947, 977, 1263, 1804, 2289, 2574, 2781, 2997, 3176, 3257, 3154, 2780, 2248, 1865, 1740, 1657, 1479, 1369, 1514, 1852, 2237, 2673, 3209, 3714, 3965, 3986, 4087, 4434, 4709, 4513, 4005, 3722, 3776, 3763, 3517, 3317, 3247, 3044, 2727, 2709, 3098, 3441, 3404, 3213, 3295, 3757, 4304, 4550, 4394, 4115, 4042, 4199, 4350, 4268, 3872, 3293, 2879, 2855, 2986, 2886, 2575, 2348, 2277, 2283, 2401, 2577, 2529, 2213, 2066, 2355, 2709, 2671, 2366, 2199, 2167, 1990, 1741, 1738, 1843, 1549, 865, 413, 489, 689, 656, 536, 494, 390, 167, 113, 373, 589, 327, -265, -608, -437, -101, -56, -325, -573, -563, -394, -348, -558, -841, -922, -811, -831, -1173, -1565, -1586, -1257, -1008, -1072, -1242, -1269, -1146, -947, -743, -703, -932, -1212, -1213, -986, -917, -1151, -1354, -1188, -798, -619, -796, -1036, -1037, -837, -676, -669, -763, -855, -844, -639, -291, -41, -71, -230, -190, 91, 274, 92, -256, -394, -281, -185, -210, -176, 28, 274, 395, 392, 404, 546, 762, 864, 774, 638, 586, 559, 513, 580, 794, 897, 703, 460, 561, 963, 1209, 1033, 692, 597, 793, 991, 1000, 918, 910, 983, 1055, 1111, 1153, 1147, 1077, 1014, 1025, 1052, 979, 831, 765, 842, 919, 866, 748, 673, 645, 656, 698, 667, 522, 514, 800, 1013, 772, 392, 437, 821, 997, 813, 582, 447, 310, 216, 323, 523, 489, 193, 1, 131, 348, 376, 309, 356, 479, 525, 452, 297, 126, 22, -21, -128, -290, -333, -243, -215, -281, -211, 82, 379, 471, 395, 304, 296, 380, 477, 471, 311, 46, -215, -356, -311, -165, -128, -304, -533, -568, -400, -258, -229, -154, -5, -33, -282, -391, -188, -15, -135, -340, -427, -541, -765, -910, -894, -909, -1072, -1258, -1347, -1370, -1396, -1432, -1464, -1466, -1379, -1204, -1100, -1216, -1402, -1373, -1166, -1092, -1243, -1425, -1578, -1791, -1978, -2019, -2123, -2520, -2940, -2906, -2523, -2389, -2653, -2739, -2273, -1707, -1593, -1718, -1550, -1125, -895, -1016, -1325, -1698, -2061, -2277, -2374, -2618, -3118, -3557, -3586, -3307, -3085, -2990, -2844, -2639, -2469, -2226, -1865, -1738, -2095, -2634, -3012, -3358, -3786, -4006, -3882, -3782, -3918, -3876, -3280, -2469, -2027, -1920, -1647, -1135, -897, -1233, -1744, -1936, -1848, -1841, -2035, -2227, -2198, -1949, -1653, -1439, -1242, -912, -465, -122, -35, -63, 69, 457, 900, 1147, 1164, 1103, 1093, 1152, 1282, 1453, 1487, 1259, 1044, 1273, 1856, 2253, 2334, 2580, 3217, 3781, 3881, 3854, 4179, 4648, 4642, 4079, 3534, 3420, 3508, 3435, 3303, 3443, 3867, 4275, 4517, 4738, 5070, 5391, 5497, 5390, 5267, 5240, 5156, 4778, 4168, 3766, 3916, 4331, 4354, 3807, 3285, 3384, 3883, 4053, 3625, 3094, 2970, 3138, 3155, 2915, 2674, 2567, 2425, 2091, 1698, 1503, 1531, 1477, 1100, 589, 309, 259, 120, -174, -384, -513, -885, -1533, -2014, -2016, -1837, -2027, -2706, -3360, -3385, -2857, -2515, -2821, -3319, -3323, -2964, -2977, -3593, -4260, -4573, -4874, -5576, -6357, -6572, -6271, -6167, -6534, -6740, -6196, -5291, -4871, -5056, -5186, -4934, -4808, -5313, -6126, -6552, -6484, -6509, -7037, -7649, -7604, -6886, -6299, -6317, -6427, -6048, -5494, -5341, -5373, -5028, -4550, -4698, -5381, -5602, -4966, -4362, -4619, -5241, -5248, -4685, -4389, -4593, -4702, -4391, -4046, -3968, -3853, -3389, -2834, -2580, -2508, -2258, -1885, -1742, -1844, -1833, -1567, -1342, -1436, -1708, -1792, -1571, -1282, -1189, -1256, -1198, -836, -343, -60, -55, -31, 255, 612, 713, 619, 701, 1052, 1313, 1196, 916, 885, 1105, 1194, 985, 793, 901, 1113, 1061, 819, 853, 1311, 1741, 1708, 1465, 1598, 2124, 2433, 2205, 1877, 1932, 2185, 2142, 1765, 1455, 1414, 1424, 1271, 1080, 1092, 1287, 1403, 1333, 1278, 1470, 1826, 2011, 1862, 1605, 1543, 1604, 1464, 1103, 893, 1010, 1084, 713, 142, -3, 402, 779, 607, 126, -52, 207, 462, 400, 226, 213, 239, 69, -164, -130, 137, 229, -54, -423, -531, -431, -366, -384, -424, -521, -647, -622, -443, -362, -414, -289, 98, 411, 442, 442, 628, 804, 741, 606, 703, 941, 916, 532, 240, 447, 907, 1053, 846, 835, 1312, 1894, 2144, 2176, 2345, 2686, 2987, 3164, 3290, 3390, 3398, 3265, 3077, 3026, 3138, 3164, 2969, 2847, 3113, 3561, 3798, 3853, 4033, 4388, 4758, 5061, 5247, 5246, 5155, 5176, 5276, 5244, 5070, 4943, 4918, 4866, 4746, 4646, 4580, 4482, 4421, 4553, 4799, 4846, 4639, 4536, 4775, 5110, 5239, 5177, 5017, 4741, 4413, 4177, 4023, 3839, 3614, 3364, 3082, 2920, 3060, 3333, 3401, 3314, 3383, 3525, 3319, 2747, 2296, 2199, 2082, 1590, 993, 800, 1008, 1173, 1120, 1145, 1397, 1522, 1229, 849, 827, 938, 574, -259, -892, -937, -736, -756, -991, -1138, -1061, -920, -941, -1114, -1190, -1049, -923, -1049, -1260, -1192, -858, -681, -862, -1075, -1007, -886, -1092, -1516, -1774, -1874, -2126, -2481, -2495, -2018, -1468, -1251, -1216, -933, -347, 130, 172, -77, -249, -222, -265, -672, -1261, -1468, -1081, -609, -555, -675, -432, 146, 601, 744, 750, 739, 711, 728, 850, 995, 1052, 1032, 1052, 1206, 1462, 1660, 1693, 1614, 1467, 1196, 893, 857, 1127, 1293, 1139, 1070, 1490, 2136, 2494, 2533, 2599, 2795, 2848, 2556, 2084, 1776, 1696, 1532, 1136, 876, 1111, 1575, 1797, 1837, 2023, 2259, 2241, 2071, 2051, 2061, 1767, 1245, 901, 845, 809, 679, 672, 886, 1051, 962, 855, 1007, 1221, 1062, 505, -3, -130, -48, -136, -452, -702, -668, -485, -445, -614, -787, -820, -887, -1215, -1650, -1820, -1747, -1838, -2175, -2325, -2061, -1768, -1826, -2039, -2056, -1993, -2211, -2656, -2939, -2995, -3174, -3564, -3790, -3631, -3382, -3365, -3474, -3437, -3223, -3045, -3068, -3266, -3497, -3703, -3944, -4193, -4304, -4264, -4236, -4208, -3965, -3556, -3371, -3535, -3660, -3480, -3342, -3670, -4271, -4600, -4543, -4459, -4504, -4420, -4084, -3745, -3544, -3263, -2774, -2341, -2246, -2406, -2549, -2569, -2572, -2679, -2883, -3065, -3103, -2978, -2775, -2584, -2412, -2202, -1941, -1715, -1633, -1667, -1661, -1557, -1465, -1431, -1330, -1142, -1045, -1093, -1072, -900, -780, -833, -947, -1062, -1205, -1263, -1135, -973, -886, -673, -228, 152, 216, 153, 228, 318, 168, -165, -426, -564, -742, -979, -1047, -812, -499, -385, -358, -112, 263, 341, 89, -44, 68, -7, -440, -773, -684, -473, -482, -586, -560, -452, -416, -456, -487, -478, -518, -730, -1067, -1280, -1231, -1084, -1025, -1008, -945, -902, -924, -885, -743, -713, -962, -1312, -1449, -1350, -1275, -1386, -1531, -1495, -1291, -1097, -1018, -1017, -1028, -1062, -1186, -1392, -1521, -1459, -1358, -1471, -1732, -1759, -1364, -844, -629, -786, -996, -969, -779, -755, -1025, -1337, -1387, -1237, -1186, -1258, -1107, -602, -165, -184, -341, -74, 439, 491, 6, -302, -104, 46, -282, -613, -313, 325, 487, 95, -8, 682, 1511, 1566, 997, 756, 1161, 1514, 1286, 909, 977, 1310, 1364, 1158, 1195, 1630, 2029, 1976, 1638, 1515, 1775, 2059, 1999, 1734, 1688, 1984, 2322, 2443, 2466, 2607, 2779, 2742, 2531, 2397, 2370, 2243, 2030, 2021, 2312, 2629, 2700, 2605, 2630, 2939, 3378, 3591, 3348, 2844, 2579, 2762, 2957, 2640, 2030, 1890, 2421, 2913, 2766, 2355, 2409, 2924, 3250, 3114, 2893, 2848, 2747, 2443, 2222, 2268, 2305, 2095, 1828, 1768, 1918, 2144, 2314, 2310, 2172, 2138, 2306, 2445, 2363, 2225, 2256, 2325, 2134, 1726, 1513, 1704, 1966, 1866, 1462, 1206, 1303, 1495, 1535, 1533, 1654, 1741, 1574, 1324, 1353, 1644, 1764, 1450, 1023, 1022, 1460, 1666, 1184, 546, 577, 1106, 1228, 789, 573, 876, 1023, 631, 337, 742, 1388, 1412, 824, 457, 766, 1248, 1232, 773, 432, 423, 424, 194, -22, 104, 414, 404, -55, -450, -236, 399, 679, 225, -388, -439, -94, -71, -433, -575, -365, -370, -783, -1041, -791, -498, -670, -1082, -1201, -1036, -1046, -1365, -1577, -1388, -1105, -1144, -1373, -1358, -1135, -1151, -1480, -1679, -1531, -1367, -1500, -1828, -2085, -2086, -1784, -1387, -1241, -1362, -1449, -1431, -1500, -1616, -1574, -1533, -1843, -2340, -2474, -2155, -1876, -1923, -1977, -1713, -1366, -1354, -1623, -1764, -1660, -1614, -1835, -2182, -2460, -2626, -2636, -2398, -2048, -1933, -2140, -2287, -2063, -1732, -1745, -2050, -2214, -2122, -2115, -2367, -2561, -2435, -2222, -2238, -2372, -2360, -2287, -2382, -2577, -2609, -2465, -2405, -2590, -2838, -2814, -2450, -2121, -2184, -2446, -2403, -2030, -1855, -2182, -2641, -2735, -2479, -2275, -2311, -2378, -2255, -2053, -1992, -1996, -1792, -1439, -1383, -1792, -2191, -2096, -1734, -1679, -1953, -1972, -1489, -1010, -999, -1140, -851, -228, 73, -212, -640, -720, -479, -282, -335, -526, -630, -508, -187, 197, 502, 684, 778, 802, 772, 771, 879, 998, 908, 628, 529, 835, 1183, 1094, 775, 874, 1470, 1919, 1827, 1547, 1574, 1917, 2227, 2231, 2011, 1924, 2134, 2322, 2169, 1913, 1978, 2239, 2244, 1981, 1862, 2018, 2151, 2094, 2076, 2264, 2450, 2438, 2412, 2618, 2905, 2966, 2769, 2501, 2329, 2373, 2603, 2716, 2479, 2134, 2064, 2210, 2253, 2213, 2345, 2575, 2547, 2225, 2011, 2182, 2527, 2678, 2529, 2198, 1819, 1566, 1725, 2317, 2753, 2408, 1673, 1651, 2474, 3015, 2727, 2442, 2686, 2729, 2153, 1763, 2057, 2288, 1852, 1329, 1393, 1782, 1968, 2029, 2290, 2632, 2699, 2495, 2318, 2218, 1998, 1725, 1683, 1733, 1325, 484, 144, 909, 2021, 2324, 1874, 1721, 2267, 2811, 2783, 2510, 2448, 2402, 2051, 1592, 1264, 818, 207, 80, 689, 1131, 651, -26, 236, 1296, 2106, 2277, 2269, 2378, 2433, 2401, 2404, 2157, 1312, 312, -188, -621, -1781, -3076, -3222, -2432, -2014, -2106, -1670, -498, 557, 1158, 1828, 2722, 3208, 2779, 1673, 445, -629, -1515, -2159, -2593, -3080, -3728, -4040, -3356, -1838, -441, 273, 692, 1222, 1616, 1636, 1596, 1714, 1650, 1158, 542, 74, -338, -660, -587, -159, 70, -189, -460, -135, 649, 1218, 1311, 1378, 1850, 2563, 3037, 3073, 2886, 2792, 2883, 2954, 2785, 2415, 2014, 1695, 1576, 1759, 2076, 2204, 2199, 2405, 2792, 3017, 3120, 3423, 3789, 3785, 3487, 3370, 3520, 3616, 3563, 3568, 3656, 3571, 3167, 2653, 2348, 2259, 2030, 1422, 744, 531, 825, 1134, 1164, 1207, 1670, 2476, 3114, 3155, 2692, 2235, 2036, 1703, 830, -249, -951, -1382, -2017, -2708, -2874, -2499, -2164, -2124, -2050, -1728, -1405, -1339, -1417, -1432, -1464, -1729, -2197, -2623, -2925, -3258, -3771, -4408, -4977, -5343, -5553, -5781, -6078, -6269, -6181, -5881, -5566, -5283, -4914, -4505, -4315, -4438, -4627, -4717, -4933, -5488, -6179, -6681, -7009, -7353, -7679, -7805, -7724, -7577, -7378, -7038, -6630, -6334, -6137, -5870, -5582, -5495, -5594, -5637, -5597, -5662, -5856, -6021, -6135, -6323, -6543, -6606, -6504, -6444, -6484, -6413, -6094, -5705, -5453, -5286, -5066, -4780, -4443, -4084, -3892, -4001, -4150, -4008, -3746, -3801, -4179, -4468, -4464, -4348, -4287, -4236, -4116, -3950, -3779, -3540, -3089, -2450, -1931, -1772, -1758, -1534, -1204, -1139, -1336, -1486, -1577, -1840, -2187, -2278, -2082, -1905, -1881, -1828, -1582, -1185, -763, -370, -37, 187, 295, 375, 521, 656, 573, 251, -50, -159, -240, -470, -708, -742, -637, -562, -472, -226, 156, 555, 870, 1031, 1069, 1142, 1288, 1286, 963, 492, 163, -9, -188, -363, -378, -256, -242, -405, -456, -132, 377, 641, 533, 350, 353, 478, 565, 616, 672, 619, 373, 103, 29, 105, 89, -103, -309, -357, -249, -81, 113, 361, 620, 780, 847, 987, 1252, 1419, 1301, 1052, 957, 1023, 1046, 970, 919, 941, 975, 1070, 1351, 1723, 1886, 1755, 1640, 1835, 2175, 2302, 2196, 2188, 2433, 2711, 2811, 2866, 3071, 3302, 3282, 3014, 2791, 2797, 2891, 2845, 2655, 2557, 2773, 3217, 3594, 3761, 3892, 4171, 4503, 4661, 4582, 4394, 4223, 4100, 3988, 3867, 3783, 3810, 3922, 4010, 4049, 4149, 4371, 4601, 4692, 4640, 4547, 4483, 4466, 4527, 4687, 4834, 4733, 4324, 3942, 3993, 4349, 4392, 3874, 3341, 3387, 3813, 3975, 3748, 3630, 3933, 4323, 4320, 3943, 3629, 3603, 3625, 3363, 2837, 2381, 2222, 2269, 2298, 2261, 2281, 2389, 2462, 2445, 2456, 2553, 2555, 2302, 1935, 1718, 1597, 1282, 793, 547, 739, 995, 914, 612, 455, 536, 691, 781, 717, 440, 89, -17, 232, 515, 457, 152, -3, 90, 118, -131, -463, -607, -575, -566, -688, -873, -964, -843, -545, -258, -164, -255, -334, -218, 30, 129, -90, -440, -592, -495, -416, -543, -750, -821, -765, -736, -757, -707, -569, -490, -540, -612, -592, -523, -453, -316, -77, 119, 98, -82, -143, 25, 107, -293, -1018, -1428, -1223, -882, -973, -1324, -1296, -745, -217, -124, -229, -157, 2, -31, -203, -303, -393, -614, -826, -846, -824, -996, -1238, -1242, -1031, -950, -1140, -1322, -1229, -986, -893, -953, -911, -708, -583, -662, -768, -769, -832, -1097, -1365, -1379, -1258, -1335, -1622, -1787, -1662, -1477, -1448, -1445, -1260, -996, -897, -985, -1056, -973, -804, -763, -989, -1317, -1395, -1180, -1026, -1160, -1370, -1400, -1305, -1228, -1173, -1144, -1220, -1337, -1271, -991, -799, -912, -1085, -932, -529, -376, -696, -1076, -1033, -692, -581, -863, -1167, -1181, -995, -816, -673, -576, -606, -711, -660, -385, -152, -235, -526, -651, -462, -245, -335, -654, -791, -525, -137, -63, -344, -549, -338, 84, 190, -183, -602, -585, -226, -32, -197, -376, -249, 35, 156, 90, 49, 106, 142, 75, -20, -33, 0, -38, -145, -156, -36, -35, -299, -566, -493, -202, -112, -333, -506, -296, 206, 665, 856, 797, 663, 705, 1015, 1250, 906, 34, -702, -848, -661, -590, -680, -675, -388, 184, 866, 1326, 1359, 1174, 1180, 1424, 1463, 936, 80, -531, -630, -410, -197, -177, -297, -258, 175, 786, 1113, 1089, 1093, 1333, 1558, 1469, 1085, 706, 638, 864, 986, 703, 244, -5, 1, 167, 478, 674, 345, -222, -119, 831, 1658, 1601, 1071, 869, 1180, 1653, 1926, 1772, 1197, 554, 305, 508, 724, 533, 82, -85, 203, 455, 309, 265, 869, 1543, 1296, 434, 313, 1332, 2360, 2347, 1487, 680, 516, 876, 1092, 676, -36, -311, -79, 7, -447, -1137, -1530, -1413, -994, -725, -895, -1254, -1210, -543, 318, 845, 971, 990, 1031, 885, 346, -416, -1014, -1355, -1743, -2359, -2881, -2860, -2300, -1593, -965, -312, 369, 795, 857, 907, 1215, 1470, 1250, 653, 46, -429, -688, -521, 2, 371, 262, -28, -36, 290, 727, 1159, 1555, 1786, 1766, 1708, 1894, 2279, 2612, 2818, 2935, 2878, 2628, 2427, 2395, 2283, 1954, 1743, 1972, 2428, 2677, 2669, 2720, 3014, 3418, 3730, 3881, 3863, 3683, 3474, 3448, 3621, 3743, 3647, 3499, 3546, 3723, 3736, 3489, 3181, 2934, 2606, 2089, 1605, 1472, 1666, 1861, 1900, 2002, 2416, 3012, 3408, 3398, 3144, 2876, 2590, 2093, 1320, 471, -182, -567, -796, -970, -1082, -1097, -989, -752, -464, -299, -341, -472, -556, -627, -798, -1079, -1379, -1629, -1823, -2020, -2323, -2786, -3324, -3753, -3997, -4172, -4422, -4692, -4774, -4569, -4217, -3925, -3747, -3576, -3326, -3118, -3194, -3591, -4051, -4395, -4783, -5398, -6014, -6236, -6089, -5987, -6125, -6238, -6040, -5637, -5350, -5268, -5218, -5098, -5012, -5002, -4885, -4604, -4474, -4748, -5106, -5060, -4741, -4740, -5231, -5749, -5901, -5796, -5699, -5631, -5513, -5375, -5230, -4944, -4481, -4073, -3920, -3875, -3713, -3500, -3438, -3533, -3650, -3717, -3733, -3785, -4023, -4401, -4578, -4339, -3989, -3952, -4132, -4032, -3464, -2816, -2487, -2379, -2143, -1731, -1428, -1413, -1575, -1728, -1837, -2008, -2311, -2600, -2630, -2422, -2298, -2360, -2291, -1906, -1491, -1294, -1129, -780, -423, -318, -343, -179, 184, 390, 161, -308, -553, -418, -287, -590, -1192, -1510, -1242, -725, -437, -362, -159, 243, 634, 964, 1323, 1515, 1243, 710, 467, 595, 566, 76, -455, -496, -156, 58, -13, -58, 115, 315, 340, 287, 346, 520, 637, 570, 418, 448, 781, 1177, 1267, 962, 513, 221, 191, 255, 110, -342, -776, -764, -289, 260, 584, 724, 900, 1233, 1582, 1634, 1287, 892, 866, 1092, 1054, 590, 163, 256, 778, 1236, 1327, 1181, 1097, 1217, 1442, 1562, 1439, 1172, 1078, 1388, 1902, 2162, 2079, 2117, 2635, 3272, 3382, 2881, 2264, 1923, 1854, 1907, 1938, 1799, 1514, 1426, 1889, 2754, 3463, 3689, 3674, 3776, 3956, 3909, 3594, 3315, 3297, 3398, 3337, 3078, 2895, 3054, 3487, 3816, 3721, 3288, 2961, 3073, 3499, 3818, 3790, 3565, 3488, 3796, 4384, 4816, 4690, 4118, 3648, 3618, 3782, 3667, 3121, 2463, 2181, 2458, 2959, 3206, 3160, 3207, 3566, 4000, 4160, 3965, 3576, 3193, 2944, 2797, 2545, 2071, 1658, 1755, 2301, 2615, 2297, 1822, 1811, 2145, 2318, 2192, 1939, 1657, 1462, 1490, 1590, 1473, 1219, 1149, 1232, 1107, 710, 360, 236, 165, 49, 73, 280, 339, 108, -32, 176, 404, 287, -51, -377, -655, -783, -665, -600, -923, -1347, -1367, -1059, -857, -832, -776, -727, -866, -1095, -1129, -966, -896, -1053, -1249, -1312, -1266, -1125, -881, -715, -833, -1077, -1142, -1056, -1031, -1041, -1008, -1063, -1258, -1334, -1115, -765, -503, -396, -483, -721, -834, -584, -179, -81, -425, -858, -994, -809, -518, -282, -175, -232, -350, -331, -139, 47, 143, 195, 163, 17, -45, 145, 383, 377, 229, 237, 391, 444, 368, 371, 502, 542, 362, 151, 143, 305, 461, 505, 416, 282, 311, 583, 826, 759, 513, 392, 423, 455, 459, 438, 331, 188, 173, 264, 249, 91, 8, 90, 131, -20, -189, -141, 44, 146, 153, 146, 81, -6, 96, 338, 337, 14, -250, -316, -446, -653, -605, -314, -212, -430, -585, -393, -38, 158, 116, -48, -234, -351, -343, -301, -377, -492, -409, -180, -139, -321, -327, 19, 332, 221, -162, -407, -385, -290, -265, -250, -184, -109, -75, -63, -56, -30, 73, 242, 369, 406, 422, 446, 447, 498, 701, 937, 978, 827, 705, 680, 584, 335, 87, -74, -272, -479, -363, 157, 624, 741, 865, 1321, 1774, 1801, 1544, 1339, 1206, 1024, 740, 323, -94, -172, 160, 460, 381, 203, 347, 722, 916, 796, 606, 577, 714, 939, 1166, 1256, 1173, 1151, 1354, 1515, 1324, 937, 621, 241, -334, -764, -743, -520, -412, -293, 57, 557, 1061, 1556, 1978, 2162, 2052, 1710, 1204, 637, 142, -256, -654, -1074, -1375, -1426, -1229, -895, -560, -348, -302, -303, -161, 135, 313, 87, -465, -922, -1000, -869, -897, -1167, -1398, -1360, -1183, -1145, -1227, -1168, -946, -834, -902, -867, -609, -391, -389, -425, -312, -129, -9, 25, -28, -158, -250, -218, -134, -108, -117, -74, 52, 216, 339, 391, 479, 729, 1043, 1145, 974, 838, 1025, 1401, 1568, 1405, 1228, 1376, 1770, 2018, 1911, 1638, 1516, 1604, 1706, 1674, 1571, 1544, 1622, 1720, 1781, 1850, 2001, 2252, 2541, 2771, 2852, 2805, 2736, 2707, 2674, 2587, 2434, 2180, 1850, 1611, 1556, 1516, 1346, 1250, 1484, 1916, 2206, 2253, 2173, 2062, 1995, 2021, 2028, 1826, 1446, 1134, 993, 872, 652, 451, 415, 460, 355, 65, -160, -75, 241, 476, 418, 153, -84, -166, -173, -314, -706, -1207, -1554, -1666, -1720, -1853, -1951, -1849, -1609, -1439, -1411, -1450, -1521, -1692, -1970, -2260, -2540, -2887, -3282, -3587, -3733, -3754, -3623, -3324, -3057, -3013, -3033, -2808, -2390, -2175, -2419, -2977, -3491, -3753, -3887, -4172, -4604, -4800, -4522, -4066, -3868, -3912, -3811, -3395, -2942, -2795, -2956, -3126, -3100, -2995, -3087, -3442, -3835, -3991, -3865, -3647, -3587, -3761, -3981, -3974, -3691, -3405, -3400, -3573, -3546, -3212, -2930, -2970, -3047, -2776, -2357, -2318, -2713, -3069, -3087, -2987, -3115, -3497, -3820, -3793, -3504, -3265, -3129, -2838, -2374, -2125, -2270, -2434, -2282, -2094, -2300, -2727, -2815, -2509, -2374, -2721, -3108, -3013, -2564, -2258, -2305, -2532, -2677, -2586, -2308, -2063, -1987, -1993, -1995, -2053, -2154, -2159, -2082, -2138, -2374, -2561, -2541, -2442, -2399, -2293, -1989, -1646, -1486, -1433, -1329, -1296, -1441, -1550, -1512, -1643, -2069, -2333, -2105, -1749, -1674, -1705, -1503, -1121, -819, -720, -820, -1032, -1185, -1172, -1110, -1197, -1423, -1586, -1560, -1383, -1110, -787, -597, -689, -803, -555, -105, 34, -160, -225, -44, -1, -227, -387, -276, -96, -62, -120, -100, 37, 217, 373, 515, 650, 725, 725, 764, 934, 1111, 1054, 759, 523, 558, 667, 555, 354, 497, 1040, 1488, 1486, 1323, 1478, 1899, 2105, 1908, 1626, 1546, 1575, 1535, 1470, 1452, 1385, 1242, 1232, 1513, 1925, 2188, 2226, 2158, 2085, 2055, 2142, 2355, 2511, 2454, 2320, 2345, 2499, 2590, 2568, 2451, 2234, 2044, 2062, 2177, 2143, 2093, 2364, 2826, 2985, 2807, 2812, 3207, 3502, 3281, 2855, 2719, 2760, 2586, 2299, 2291, 2519, 2661, 2757, 3064, 3458, 3552, 3291, 2970, 2736, 2454, 2057, 1707, 1538, 1528, 1661, 1960, 2295, 2491, 2627, 2859, 3047, 2954, 2693, 2493, 2229, 1699, 1138, 956, 1073, 1053, 870, 963, 1435, 1759, 1583, 1274, 1250, 1303, 1075, 724, 622, 754, 835, 775, 692, 679, 749, 878, 945, 783, 418, 108, 0, -89, -301, -443, -338, -165, -103, 60, 487, 841, 733, 356, 199, 303, 237, -211, -692, -756, -443, -182, -159, -91, 308, 849, 1093, 918, 631, 547, 631, 634, 433, 186, 114, 237, 380, 467, 638, 953, 1144, 948, 562, 432, 590, 570, 157, -164, 151, 866, 1250, 1159, 1238, 1867, 2458, 2290, 1626, 1324, 1500, 1371, 539, -336, -506, -170, -37, -194, -61, 616, 1339, 1598, 1623, 1935, 2440, 2488, 1852, 1121, 907, 1025, 830, 202, -273, -179, 166, 262, 191, 417, 963, 1339, 1300, 1213, 1442, 1752, 1690, 1329, 1177, 1354, 1350, 859, 387, 489, 754, 384, -423, -692, -221, 184, 89, -25, 255, 684, 929, 1033, 1172, 1357, 1440, 1249, 833, 515, 493, 540, 370, 114, 85, 242, 280, 203, 351, 789, 1089, 997, 864, 1066, 1347, 1258, 899, 722, 823, 878, 699, 466, 424, 604, 849, 1046, 1242, 1492, 1681, 1647, 1469, 1407, 1539, 1635, 1468, 1153, 1030, 1242, 1576, 1730, 1659, 1566, 1597, 1658, 1568, 1327, 1136, 1092, 1014, 747, 512, 628, 974, 1173, 1233, 1464, 1818, 1892, 1623, 1409, 1446, 1437, 1075, 514, 187, 266, 462, 424, 264, 418, 950, 1346, 1202, 801, 682, 873, 923, 608, 246, 190, 364, 490, 520, 588, 673, 611, 355, 55, -108, -78, 49, 118, 98, 96, 164, 242, 335, 486, 537, 236, -320, -692, -673, -611, -904, -1366, -1445, -1002, -545, -548, -871, -1015, -795, -552, -730, -1366, -2037, -2326, -2278, -2300, -2609, -2952, -2952, -2610, -2255, -2091, -2023, -1970, -2001, -2085, -2045, -1893, -1886, -2106, -2334, -2406, -2384, -2350, -2322, -2349, -2424, -2418, -2270, -2108, -2042, -2015, -1919, -1724, -1470, -1245, -1158, -1201, -1214, -1104, -1024, -1169, -1419, -1418, -1104, -857, -963, -1173, -1060, -613, -182, -20, -77, -123, 19, 254, 300, 142, 95, 236, 271, 148, 213, 539, 748, 694, 654, 734, 718, 560, 475, 553, 705, 878, 1045, 1101, 1032, 1035, 1252, 1498, 1471, 1184, 906, 733, 568, 479, 621, 818, 713, 419, 466, 997, 1493, 1477, 1122, 955, 1154, 1366, 1194, 729, 426, 472, 570, 444, 254, 296, 529, 675, 626, 522, 521, 586, 509, 166, -219, -273, 4, 197, 69, -159, -260, -348, -546, -682, -578, -435, -599, -1013, -1200, -888, -417, -343, -726, -1052, -909, -548, -596, -1206, -1782, -1757, -1390, -1368, -1747, -1909, -1562, -1159, -1121, -1235, -1155, -1051, -1271, -1658, -1745, -1523, -1454, -1693, -1891, -1821, -1678, -1603, -1430, -1097, -903, -1115, -1526, -1683, -1481, -1342, -1643, -2160, -2355, -2152, -1969, -1986, -1911, -1631, -1539, -1872, -2198, -2023, -1614, -1621, -2010, -2105, -1715, -1438, -1616, -1817, -1665, -1480, -1639, -1924, -1973, -1934, -2175, -2649, -2971, -2992, -2909, -2841, -2687, -2442, -2278, -2242, -2159, -1988, -1967, -2272, -2717, -3019, -3152, -3277, -3421, -3456, -3349, -3224, -3141, -2998, -2743, -2503, -2458, -2634, -2921, -3201, -3419, -3566, -3685, -3800, -3826, -3670, -3443, -3286, -3085, -2685, -2304, -2220, -2267, -2161, -2072, -2291, -2639, -2811, -2973, -3420, -3918, -3996, -3684, -3441, -3426, -3306, -2851, -2361, -2230, -2334, -2229, -1924, -1921, -2343, -2595, -2291, -1961, -2257, -2891, -3055, -2639, -2330, -2512, -2770, -2606, -2136, -1780, -1606, -1380, -1084, -963, -1046, -1034, -782, -607, -851, -1349, -1588, -1392, -1113, -1129, -1333, -1310, -890, -348, -9, 171, 459, 849, 1016, 831, 605, 605, 592, 191, -445, -764, -602, -384, -352, -150, 513, 1282, 1714, 1939, 2254, 2489, 2329, 1890, 1518, 1272, 1016, 810, 812, 975, 1123, 1291, 1664, 2230, 2739, 3041, 3214, 3285, 3124, 2730, 2370, 2201, 2031, 1721, 1575, 1863, 2264, 2352, 2357, 2708, 3175, 3231, 2986, 2929, 3062, 2985, 2652, 2385, 2330, 2364, 2383, 2438, 2599, 2817, 2906, 2771, 2601, 2685, 2986, 3168, 3050, 2796, 2642, 2668, 2804, 2897, 2827, 2643, 2498, 2415, 2326, 2272, 2289, 2238, 2061, 2024, 2355, 2837, 3139, 3279, 3437, 3565, 3514, 3387, 3386, 3368, 2958, 2142, 1423, 1236, 1447, 1649, 1717, 1849, 2188, 2636, 3011, 3217, 3269, 3205, 2999, 2607, 2106, 1670, 1387, 1160, 887, 664, 713, 1098, 1593, 1917, 2034, 2127, 2260, 2272, 2041, 1717, 1505, 1348, 1031, 642, 615, 1113, 1642, 1672, 1419, 1490, 1897, 2067, 1758, 1370, 1241, 1225, 1090, 941, 1010, 1279, 1480, 1452, 1369, 1486, 1721, 1730, 1465, 1244, 1225, 1227, 1180, 1267, 1482, 1517, 1278, 1055, 1038, 997, 676, 218, -15, 89, 300, 386, 417, 615, 1005, 1344, 1444, 1364, 1300, 1332, 1371, 1218, 737, 64, -432, -539, -476, -590, -859, -933, -623, -127, 281, 552, 759, 910, 1010, 1154, 1331, 1314, 934, 319, -280, -713, -895, -820, -682, -689, -766, -685, -432, -180, 1, 150, 203, 67, -154, -236, -105, 38, -71, -478, -922, -1092, -938, -676, -560, -695, -1001, -1213, -1071, -678, -476, -681, -973, -946, -597, -180, 113, 188, 37, -203, -410, -644, -945, -1140, -1148, -1188, -1401, -1514, -1184, -532, -1, 224, 391, 751, 1143, 1167, 774, 384, 273, 155, -290, -773, -746, -248, 152, 153, 38, 168, 538, 881, 988, 841, 582, 432, 470, 501, 305, 12, -83, -43, -181, -455, -502, -279, -76, 52, 296, 596, 714, 688, 729, 803, 711, 441, 161, -20, -134, -264, -447, -609, -659, -625, -596, -506, -208, 243, 595, 754, 936, 1249, 1373, 994, 415, 210, 335, 175, -440, -895, -687, -122, 205, 224, 317, 690, 1061, 1044, 722, 589, 819, 971, 683, 275, 236, 494, 659, 635, 558, 484, 455, 537, 628, 531, 298, 175, 236, 360, 455, 481, 391, 258, 244, 368, 474, 499, 546, 656, 718, 696, 737, 930, 1119, 1152, 1169, 1373, 1613, 1533, 1137, 839, 831, 744, 222, -453, -672, -328, 57, 87, -22, 146, 631, 1162, 1601, 1968, 2158, 2016, 1657, 1379, 1215, 907, 358, -182, -468, -523, -487, -384, -154, 153, 376, 400, 304, 269, 348, 425, 365, 149, -151, -438, -625, -696, -730, -826, -954, -955, -781, -625, -644, -675, -488, -217, -152, -264, -324, -411, -774, -1274, -1462, -1206, -864, -772, -862, -834, -540, -150, 91, 188, 296, 368, 255, 120, 241, 401, 113, -534, -931, -854, -687, -680, -632, -386, -88, 127, 363, 748, 1156, 1242, 806, 125, -331, -509, -783, -1238, -1484, -1301, -968, -753, -584, -319, 47, 478, 832, 856, 543, 236, 97, -211, -975, -1879, -2375, -2403, -2343, -2365, -2244, -1845, -1360, -925, -442, 61, 320, 210, -100, -468, -923, -1445, -1896, -2207, -2394, -2443, -2341, -2187, -2128, -2170, -2176, -2023, -1739, -1474, -1339, -1310, -1272, -1159, -1039, -1041, -1204, -1397, -1472, -1480, -1645, -2009, -2246, -2090, -1772, -1667, -1658, -1364, -831, -442, -317, -281, -263, -268, -227, -184, -348, -715, -1004, -1067, -980, -737, -250, 338, 696, 704, 575, 585, 762, 802, 409, -225, -539, -324, 6, 90, 131, 447, 917, 1232, 1402, 1631, 1857, 1788, 1336, 714, 131, -296, -437, -304, -275, -643, -1022, -743, 164, 971, 1237, 1248, 1367, 1476, 1324, 1018, 756, 416, -151, -713, -973, -1056, -1212, -1344, -1269, -1104, -996, -782, -295, 254, 531, 514, 421, 350, 227, 17, -203, -433, -787, -1264, -1597, -1559, -1321, -1282, -1524, -1718, -1622, -1385, -1254, -1241, -1226, -1191, -1184, -1203, -1231, -1284, -1375, -1499, -1638, -1739, -1758, -1737, -1758, -1827, -1916, -2022, -2101, -2073, -2004, -2076, -2282, -2388, -2298, -2166, -2082, -1935, -1663, -1373, -1205, -1218, -1382, -1567, -1641, -1660, -1779, -1982, -2091, -2031, -1918, -1865, -1881, -1932, -1954, -1848, -1588, -1311, -1181, -1183, -1129, -915, -652, -505, -485, -487, -479, -526, -664, -847, -1033, -1245, -1492, -1694, -1734, -1574, -1311, -1057, -812, -530, -233, 32, 262, 387, 275, -63, -412, -624, -796, -1013, -1165, -1170, -1166, -1243, -1208, -848, -332, -89, -263, -509, -440, -132, 23, -116, -297, -287, -181, -145, -156, -167, -310, -672, -1060, -1214, -1113, -927, -798, -741, -665, -465, -162, 125, 342, 493, 522, 431, 388, 426, 281, -136, -455, -412, -296, -381, -427, -153, 225, 355, 287, 324, 574, 841, 833, 457, -30, -234, -62, 191, 277, 322, 596, 1069, 1423, 1476, 1370, 1250, 1028, 586, 50, -338, -515, -584, -582, -462, -257, -53, 214, 710, 1338, 1665, 1397, 848, 595, 694, 615, 64, -596, -894, -799, -503, -98, 272, 363, 209, 198, 479, 592, 112, -621, -963, -940, -1054, -1284, -1143, -607, -138, 166, 553, 955, 1130, 1212, 1392, 1391, 870, 90, -396, -496, -587, -893, -1256, -1468, -1423, -965, -83, 777, 1158, 1302, 1744, 2378, 2648, 2479, 2201, 1864, 1314, 703, 266, -98, -559, -938, -975, -757, -532, -249, 383, 1372, 2244, 2530, 2356, 2249, 2354, 2264, 1736, 1062, 478, -160, -781, -889, -376, 193, 441, 626, 975, 1320, 1525, 1644, 1629, 1396, 1043, 660, 206, -219, -386, -311, -223, -117, 228, 853, 1589, 2319, 2909, 3106, 2818, 2355, 2087, 1955, 1555, 727, -162, -598, -435, 53, 572, 1035, 1445, 1768, 2030, 2327, 2628, 2719, 2531, 2284, 2165, 2056, 1778, 1416, 1188, 1141, 1151, 1127, 1097, 1114, 1162, 1165, 1126, 1185, 1387, 1532, 1482, 1403, 1476, 1533, 1344, 1036, 876, 831, 697, 527, 588, 944, 1331, 1500, 1494, 1515, 1636, 1743, 1692, 1446, 1077, 730, 557, 608, 812, 1089, 1472, 2023, 2643, 3090, 3216, 3129, 3014, 2870, 2516, 1841, 1002, 332, 35, 2, -2, -12, 173, 684, 1444, 2265, 2904, 3147, 3061, 2944, 2858, 2522, 1866, 1244, 862, 516, 80, -245, -329, -321, -358, -395, -374, -279, -23, 459, 1010, 1369, 1559, 1869, 2312, 2522, 2341, 2013, 1591, 827, -142, -788, -1044, -1345, -1720, -1737, -1330, -843, -323, 436, 1286, 1840, 2054, 2201, 2360, 2307, 1870, 1177, 497, -63, -621, -1246, -1771, -1953, -1804, -1586, -1478, -1336, -910, -226, 407, 782, 964, 1059, 1076, 1055, 1040, 889, 392, -358, -988, -1295, -1451, -1685, -1931, -1926, -1546, -962, -448, -68, 345, 894, 1418, 1684, 1683, 1614, 1553, 1309, 705, -121, -837, -1274, -1501, -1621, -1650, -1557, -1284, -772, -89, 557, 1005, 1232, 1276, 1194, 1038, 788, 380, -136, -636, -1124, -1624, -1890, -1662, -1167, -934, -1056, -1071, -664, -94, 155, -59, -463, -731, -859, -1069, -1373, -1532, -1541, -1707, -2044, -2166, -1987, -1928, -2174, -2356, -2209, -1932, -1716, -1478, -1144, -780, -432, -145, -40, -172, -510, -1063, -1741, -2252, -2451, -2587, -2857, -3041, -2895, -2530, -2108, -1557, -873, -283, 66, 287, 457, 455, 172, -306, -802, -1205, -1554, -1901, -2092, -1860, -1268, -783, -670, -624, -293, 156, 286, -10, -462, -793, -919, -902, -842, -810, -787, -728, -630, -509, -324, -61, 122, 21, -311, -522, -388, -135, -152, -458, -691, -589, -274, 23, 279, 552, 809, 1033, 1264, 1384, 1250, 1100, 1316, 1690, 1573, 888, 334, 340, 455, 106, -552, -971, -1007, -862, -510, 206, 1067, 1690, 2124, 2615, 3009, 2997, 2661, 2210, 1511, 451, -589, -1157, -1401, -1784, -2260, -2313, -1796, -1129, -553, 172, 1114, 1835, 2028, 1894, 1673, 1293, 712, 105, -410, -892, -1333, -1579, -1540, -1305, -998, -646, -226, 211, 525, 651, 676, 692, 638, 445, 235, 159, 156, 110, 92, 203, 346, 429, 525, 661, 702, 635, 621, 661, 567, 331, 190, 258, 395, 483, 575, 733, 901, 967, 892, 766, 745, 909, 1194, 1432, 1452, 1162, 652, 141, -257, -681, -1273, -1898, -2290, -2335, -2068, -1518, -789, -107, 383, 739, 1033, 1209, 1204, 1069, 818, 327, -449, -1268, -1803, -2025, -2101, -2056, -1859, -1673, -1583, -1322, -680, 67, 554, 787, 870, 752, 508, 384, 354, 125, -329, -704, -822, -771, -638, -479, -432, -594, -849, -957, -811, -501, -198, -3, 100, 217, 406, 618, 699, 523, 104, -397, -801, -1016, -1078, -1116, -1254, -1507, -1795, -2039, -2156, -2056, -1799, -1608, -1540, -1356, -911, -437, -196, -144, -137, -158, -200, -241, -387, -756, -1165, -1281, -1092, -928, -978, -1040, -848, -445, -117, -24, -71, -120, -162, -221, -214, -58, 169, 310, 346, 387, 481, 563, 554, 365, -50, -559, -895, -950, -860, -751, -627, -496, -399, -261, 2, 271, 313, 141, -12, -104, -385, -926, -1355, -1354, -1172, -1266, -1570, -1570, -1102, -622, -540, -700, -734, -611, -491, -329, -35, 198, 128, -124, -274, -355, -586, -897, -994, -920, -1081, -1567, -1874, -1563, -871, -343, -108, 116, 481, 834, 1059, 1190, 1187, 894, 355, -132, -389, -494, -514, -404, -237, -111, 105, 495, 755, 575, 187, 12, 55, 76, 106, 338, 697, 916, 929, 923, 1031, 1161, 1154, 998, 780, 553, 338, 226, 298, 440, 436, 300, 254, 327, 281, 45, -120, -53, 29, -101, -335, -408, -260, -17, 249, 530, 732, 707, 466, 182, -16, -184, -432, -795, -1168, -1329, -1143, -790, -576, -507, -355, -111, 19, 32, 97, 180, 97, -123, -280, -331, -397, -518, -628, -722, -887, -1169, -1487, -1651, -1559, -1348, -1201, -1071, -814, -495, -234, 91, 601, 1036, 1063, 813, 684, 706, 536, 57, -432, -702, -894, -1172, -1382, -1341, -1181, -1121, -1060, -742, -175, 392, 819, 1156, 1431, 1566, 1476, 1233, 1043, 1012, 980, 751, 375, 6, -362, -725, -855, -653, -399, -268, 0, 593, 1207, 1515, 1604, 1639, 1526, 1189, 816, 606, 525, 422, 222, -51, -333, -541, -619, -576, -473, -352, -222, -98, 61, 396, 956, 1487, 1667, 1554, 1510, 1642, 1651, 1273, 562, -268, -1036, -1539, -1595, -1223, -682, -236, 99, 510, 1096, 1704, 2137, 2373, 2447, 2225, 1619, 876, 320, -99, -635, -1213, -1511, -1486, -1385, -1244, -827, -179, 201, 35, -261, -177, 183, 413, 492, 689, 991, 1144, 1085, 918, 644, 220, -245, -600, -832, -976, -971, -797, -653, -725, -822, -604, -123, 184, 116, -67, -91, -23, -48, -151, -174, -44, 217, 573, 871, 858, 476, 22, -221, -336, -536, -794, -960, -1049, -1151, -1177, -986, -657, -394, -161, 285, 963, 1543, 1744, 1605, 1263, 801, 335, -12, -308, -678, -1054, -1261, -1304, -1292, -1183, -851, -341, 165, 611, 1111, 1689, 2112, 2121, 1774, 1391, 1137, 850, 377, -120, -393, -467, -524, -581, -513, -272, 119, 627, 1105, 1358, 1379, 1340, 1306, 1180, 915, 596, 297, 81, 35, 197, 459, 648, 661, 491, 204, -17, 64, 514, 1063, 1336, 1237, 1008, 891, 888, 885, 857, 828, 759, 657, 694, 982, 1306, 1372, 1222, 1078, 895, 493, 7, -274, -382, -547, -746, -767, -566, -274, 32, 356, 652, 840, 881, 779, 550, 234, -100, -401, -637, -767, -715, -458, -88, 247, 481, 646, 777, 827, 719, 425, 8, -399, -661, -760, -819, -920, -930, -672, -261, 0, 51, 80, 114, -13, -264, -333, -129, 28, -88, -236, -130, 13, -194, -644, -903, -918, -1002, -1230, -1383, -1389, -1335, -1189, -910, -658, -599, -676, -759, -832, -939, -1105, -1290, -1371, -1306, -1299, -1483, -1541, -1121, -446, -25, 98, 234, 424, 512, 536, 572, 470, 130, -263, -507, -552, -403, -145, -24, -189, -477, -673, -755, -726, -500, -115, 198, 335, 426, 598, 782, 839, 712, 466, 227, 110, 131, 226, 305, 297, 207, 164, 257, 345, 216, -65, -250, -319, -430, -564, -567, -465, -396, -281, 46, 530, 965, 1275, 1500, 1616, 1560, 1340, 1021, 669, 310, -91, -555, -1002, -1329, -1533, -1610, -1470, -1135, -784, -410, 235, 1106, 1710, 1774, 1598, 1473, 1272, 803, 126, -627, -1360, -1901, -2129, -2176, -2224, -2238, -2048, -1552, -780, 37, 532, 581, 514, 687, 974, 967, 544, -2, -324, -357, -378, -704, -1286, -1711, -1703, -1425, -1142, -840, -392, 95, 363, 375, 362, 507, 699, 696, 401, -37, -362, -434, -401, -561, -940, -1165, -943, -495, -218, -116, 83, 379, 449, 182, -109, -156, -91, -185, -389, -426, -198, 130, 390, 512, 494, 388, 298, 249, 102, -230, -556, -593, -378, -227, -270, -289, -117, 108, 210, 225, 311, 566, 960, 1319, 1415, 1190, 856, 619, 425, 88, -401, -828, -996, -897, -625, -258, 127, 463, 759, 1031, 1169, 1052, 750, 434, 138, -198, -564, -902, -1214, -1491, -1641, -1629, -1536, -1415, -1213, -893, -532, -205, 123, 485, 745, 726, 455, 142, -100, -336, -606, -811, -864, -803, -704, -547, -245, 209, 650, 904, 1029, 1257, 1652, 1990, 2063, 1900, 1570, 1030, 302, -377, -752, -790, -634, -393, -92, 282, 744, 1235, 1547, 1437, 937, 424, 182, 44, -291, -750, -969, -812, -488, -189, 88, 334, 408, 236, -20, -177, -263, -391, -551, -654, -683, -620, -382, 59, 593, 1035, 1247, 1194, 1009, 942, 1116, 1372, 1449, 1276, 1012, 804, 658, 524, 391, 235, 16, -202, -286, -219, -106, 45, 325, 694, 982, 1142, 1286, 1448, 1498, 1310, 892, 309, -374, -1045, -1533, -1727, -1676, -1524, -1321, -1000, -537, -76, 171, 151, 21, -29, 35, 107, 99, 39, 15, 53, 100, 102, 59, 0, -54, -96, -129, -208, -380, -561, -581, -377, -39, 345, 744, 1059, 1131, 968, 774, 677, 557, 266, -58, -134, 77, 317, 385, 391, 510, 660, 611, 323, 1, -217, -440, -802, -1154, -1208, -943, -659, -514, -306, 120, 531, 597, 348, 66, -129, -338, -639, -993, -1289, -1419, -1325, -1075, -852, -789, -831, -812, -667, -486, -371, -288, -164, -24, 50, 82, 159, 259, 260, 156, 116, 228, 311, 138, -226, -517, -637, -725, -842, -837, -606, -249, 119, 523, 964, 1294, 1402, 1404, 1471, 1560, 1491, 1228, 870, 432, -108, -581, -720, -518, -234, -37, 134, 409, 806, 1192, 1395, 1429, 1492, 1616, 1568, 1296, 1101, 1135, 1151, 1002, 900, 940, 864, 535, 213, 144, 219, 167, -126, -492, -583, -237, 254, 482, 416, 303, 236, 198, 263, 398, 366, 128, 0, 181, 481, 673, 730, 634, 340, -38, -336, -559, -784, -984, -1087, -1068, -857, -386, 240, 794, 1159, 1358, 1396, 1250, 983, 714, 456, 106, -397, -954, -1351, -1463, -1352, -1153, -893, -546, -199, 31, 172, 280, 288, 160, 61, 99, 97, -119, -402, -528, -522, -547, -649, -793, -975, -1143, -1183, -1041, -794, -600, -582, -668, -615, -351, -132, -168, -323, -424, -559, -760, -806, -609, -400, -299, -174, -7, 37, -13, 9, 21, -236, -733, -1137, -1290, -1327, -1288, -981, -364, 260, 646, 906, 1179, 1301, 1118, 771, 401, -119, -842, -1447, -1607, -1458, -1398, -1534, -1576, -1265, -712, -225, 53, 202, 278, 254, 183, 210, 315, 293, 73, -172, -303, -384, -479, -541, -577, -735, -1054, -1311, -1288, -1051, -798, -547, -191, 209, 494, 675, 859, 984, 924, 728, 499, 229, -47, -200, -240, -312, -391, -276, 27, 272, 334, 340, 402, 467, 468, 448, 429, 340, 182, 89, 107, 69, -122, -296, -283, -182, -167, -263, -411, -571, -689, -773, -909, -1039, -940, -585, -241, -68, 39, 143, 175, 172, 212, 191, -13, -250, -297, -179, -56, 24, 87, 127, 175, 257, 305, 259, 194, 188, 169, 52, -90, -121, -32, 66, 91, 61, 70, 172, 295, 310, 193, 46, -30, -17, 61, 161, 197, 126, 15, -46, -68, -117, -182, -195, -181, -255, -442, -590, -522, -252, 43, 237, 365, 482, 552, 546, 512, 433, 175, -261, -630, -755, -751, -759, -715, -563, -405, -297, -153, 40, 189, 273, 366, 470, 519, 471, 309, 42, -218, -335, -325, -314, -369, -467, -606, -772, -872, -827, -664, -454, -222, 24, 258, 431, 491, 418, 255, 84, -53, -162, -234, -253, -265, -308, -335, -278, -150, -35, 28, 44, 12, -71, -176, -278, -395, -534, -612, -537, -370, -265, -258, -271, -291, -393, -546, -621, -601, -624, -748, -834, -752, -576, -468, -455, -445, -373, -256, -113, 27, 129, 234, 429, 644, 660, 411, 127, 40, 95, 68, -124, -373, -530, -526, -365, -138, 0, 15, 103, 440, 925, 1309, 1506, 1560, 1452, 1192, 959, 897, 894, 717, 342, -46, -343, -584, -763, -756, -507, -123, 287, 722, 1164, 1496, 1642, 1632, 1524, 1347, 1127, 866, 513, 60, -374, -651, -774, -855, -926, -884, -629, -200, 279, 711, 1038, 1222, 1278, 1249, 1143, 936, 642, 328, 43, -187, -312, -296, -187, -85, -22, 77, 281, 543, 751, 876, 984, 1132, 1271, 1308, 1233, 1116, 1020, 986, 1051, 1173, 1215, 1085, 845, 611, 413, 220, 44, -82, -162, -221, -238, -169, -16, 157, 278, 317, 319, 340, 387, 428, 394, 204, -170, -581, -768, -647, -378, -143, 0, 30, -73, -226, -295, -271, -252, -281, -325, -344, -259, 4, 356, 559, 510, 363, 309, 372, 449, 455, 353, 144, -121, -342, -427, -378, -299, -285, -293, -198, 42, 330, 525, 563, 459, 274, 102, -9, -92, -217, -385, -538, -658, -778, -856, -773, -555, -443, -576, -758, -768, -691, -713, -766, -688, -498, -304, -132, -25, -84, -263, -348, -249, -135, -156, -204, -91, 168, 393, 486, 495, 459, 346, 190, 97, 96, 87, 0, -81, -40, 125, 350, 585, 766, 792, 659, 517, 466, 417, 272, 77, -86, -223, -327, -325, -199, -40, 93, 272, 527, 739, 767, 643, 504, 378, 171, -113, -317, -333, -251, -218, -244, -244, -190, -138, -108, -47, 76, 206, 280, 324, 406, 513, 595, 646, 652, 514, 176, -211, -445, -537, -654, -824, -859, -630, -234, 165, 525, 846, 1035, 1017, 849, 586, 211, -213, -500, -586, -586, -525, -319, -56, 12, -136, -256, -222, -203, -328, -446, -369, -168, -44, -8, 77, 234, 365, 457, 570, 638, 521, 248, 23, -74, -175, -323, -331, -112, 134, 254, 386, 643, 823, 692, 330, -43, -325, -493, -495, -340, -152, -25, 102, 319, 582, 740, 720, 542, 257, -48, -248, -310, -326, -318, -191, 44, 246, 372, 525, 689, 713, 586, 466, 417, 350, 221, 113, 81, 57, -30, -128, -107, 68, 272, 357, 324, 267, 228, 196, 201, 254, 262, 163, 83, 171, 335, 363, 228, 113, 131, 195, 193, 142, 104, 54, -73, -251, -380, -418, -439, -528, -673, -780, -769, -677, -614, -605, -552, -387, -176, -15, 43, -51, -303, -576, -748, -877, -1037, -1102, -951, -731, -653, -672, -600, -445, -363, -370, -296, -59, 197, 295, 231, 120, 14, -117, -281, -424, -522, -606, -698, -744, -654, -430, -219, -200, -380, -533, -438, -124, 150, 197, 61, -108, -235, -290, -233, -99, -76, -308, -652, -794, -630, -380, -253, -217, -188, -210, -298, -344, -316, -339, -476, -598, -599, -530, -442, -279, -48, 49, -116, -372, -462, -425, -465, -598, -690, -723, -721, -593, -347, -203, -279, -365, -241, 23, 237, 348, 372, 271, 21, -265, -449, -533, -637, -813, -992, -1086, -1082, -991, -834, -650, -477, -288, -31, 241, 387, 349, 234, 156, 108, 81, 121, 193, 148, -33, -206, -303, -426, -600, -704, -698, -691, -707, -609, -340, -69, 35, 53, 166, 365, 467, 372, 155, -100, -364, -576, -668, -681, -718, -769, -707, -472, -210, -111, -167, -165, 32, 302, 451, 490, 566, 687, 715, 606, 449, 316, 196, 103, 82, 129, 193, 244, 281, 281, 228, 176, 219, 364, 520, 598, 597, 540, 433, 272, 58, -190, -381, -370, -142, 90, 122, -14, -156, -227, -278, -341, -403, -455, -485, -423, -222, 27, 187, 274, 409, 580, 627, 515, 386, 327, 259, 113, -33, -99, -124, -194, -279, -289, -219, -143, -85, 13, 160, 250, 210, 131, 152, 275, 399, 471, 516, 513, 422, 293, 242, 281, 307, 224, 59, -59, -18, 118, 164, 73, 15, 88, 168, 178, 212, 289, 256, 89, -1, 83, 160, 70, -41, 24, 194, 243, 168, 146, 206, 197, 97, 49, 99, 137, 121, 135, 199, 228, 172, 78, -5, -94, -208, -308, -319, -238, -181, -222, -249, -104, 166, 388, 520, 618, 645, 539, 378, 254, 122, -45, -165, -196, -172, -41, 242, 520, 599, 561, 562, 545, 422, 318, 362, 434, 372, 224, 115, 38, -78, -225, -342, -446, -582, -698, -673, -488, -276, -141, -21, 173, 395, 525, 585, 695, 847, 883, 712, 402, 35, -341, -647, -819, -884, -871, -716, -385, 14, 350, 612, 873, 1144, 1347, 1381, 1222, 961, 730, 553, 330, 9, -309, -484, -478, -372, -266, -183, -54, 183, 485, 745, 930, 1069, 1152, 1137, 1060, 985, 891, 707, 436, 157, -51, -154, -192, -272, -427, -529, -440, -232, -98, -93, -75, 72, 284, 395, 323, 137, -24, -97, -116, -132, -137, -103, -71, -139, -332, -546, -675, -749, -878, -1064, -1174, -1086, -842, -589, -435, -365, -297, -192, -78, 11, 75, 116, 103, 28, -50, -70, -88, -229, -500, -718, -730, -604, -490, -402, -242, 13, 279, 486, 621, 668, 619, 523, 453, 394, 263, 43, -167, -280, -333, -417, -537, -620, -598, -465, -268, -74, 82, 216, 353, 482, 550, 516, 388, 235, 148, 148, 181, 197, 211, 247, 271, 246, 196, 184, 228, 294, 364, 447, 514, 508, 431, 350, 297, 228, 115, 11, -21, 19, 104, 211, 312, 361, 325, 218, 78, -52, -149, -198, -217, -247, -296, -334, -344, -343, -318, -241, -150, -114, -129, -134, -116, -79, -1, 85, 54, -132, -316, -316, -182, -111, -188, -329, -447, -526, -549, -462, -279, -96, 52, 205, 335, 343, 233, 108, 14, -97, -236, -343, -378, -350, -274, -152, -15, 91, 150, 172, 164, 116, 21, -99, -219, -324, -410, -476, -507, -470, -327, -100, 107, 202, 214, 270, 418, 557, 586, 560, 578, 623, 589, 455, 284, 120, -28, -150, -242, -309, -326, -249, -83, 107, 274, 409, 519, 597, 627, 584, 478, 356, 232, 61, -146, -287, -291, -240, -242, -281, -267, -180, -71, 9, 61, 92, 104, 91, 60, 54, 127, 267, 393, 434, 403, 355, 312, 237, 84, -129, -312, -374, -312, -180, -8, 189, 365, 479, 568, 696, 836, 891, 820, 704, 641, 652, 668, 618, 504, 388, 315, 264, 210, 168, 164, 178, 155, 87, 30, 11, -8, -50, -55, 36, 203, 377, 498, 522, 434, 301, 217, 184, 113, -29, -167, -230, -251, -306, -403, -488, -533, -560, -569, -529, -456, -443, -538, -639, -608, -447, -303, -279, -328, -350, -335, -341, -403, -503, -619, -735, -820, -848, -826, -783, -716, -613, -511, -476, -508, -551, -567, -582, -632, -716, -787, -798, -751, -684, -632, -604, -590, -592, -621, -665, -704, -755, -856, -985, -1049, -1031, -1009, -991, -875, -645, -429, -314, -243, -150, -52, 50, 179, 287, 280, 183, 129, 175, 207, 115, -47, -143, -130, -84, -70, -100, -177, -293, -384, -376, -256, -59, 179, 431, 650, 774, 770, 659, 502, 347, 203, 76, -2, -16, 9, 37, 52, 60, 62, 83, 142, 199, 196, 146, 118, 126, 134, 128, 119, 103, 84, 77, 45, -47, -127, -89, 8, 12, -99, -198, -208, -169, -128, -96, -81, -76, -39, 57, 187, 292, 342, 348, 316, 246, 140, 31, -32, -16, 89, 246, 384, 454, 455, 402, 300, 174, 85, 70, 98, 115, 127, 172, 240, 269, 234, 180, 145, 120, 95, 80, 65, 19, -55, -130, -194, -248, -271, -242, -187, -147, -126, -100, -84, -106, -161, -211, -247, -297, -351, -355, -296, -223, -165, -105, -41, 7, 66, 149, 207, 174, 58, -68, -180, -291, -386, -404, -336, -250, -199, -159, -104, -70, -96, -149, -174, -164, -154, -185, -279, -388, -425, -365, -298, -316, -394, -441, -404, -305, -198, -138, -151, -221, -309, -386, -430, -414, -336, -252, -234, -288, -338, -310, -222, -134, -66, 9, 116, 250, 378, 454, 448, 373, 263, 143, 45, 2, 6, -3, -50, -79, -39, 59, 172, 285, 406, 521, 590, 578, 506, 446, 448, 475, 453, 370, 286, 246, 244, 242, 204, 126, 61, 70, 145, 202, 188, 138, 115, 146, 198, 213, 168, 118, 112, 113, 51, -56, -129, -147, -152, -149, -114, -56, 4, 68, 113, 83, -26, -142, -177, -124, -35, 28, 35, 9, 23, 126, 286, 414, 436, 357, 232, 111, 22, -17, -14, 5, 11, 19, 74, 178, 263, 286, 286, 316, 372, 434, 495, 512, 436, 312, 234, 209, 163, 90, 59, 99, 183, 287, 386, 428, 376, 266, 159, 65, -44, -167, -267, -305, -266, -157, -10, 105, 137, 102, 52, 4, -62, -145, -221, -288, -348, -384, -374, -334, -308, -332, -410, -498, -526, -479, -429, -461, -579, -687, -702, -634, -543, -457, -385, -350, -380, -446, -491, -506, -529, -574, -597, -566, -510, -478, -465, -416, -305, -187, -132, -160, -213, -238, -243, -271, -341, -417, -442, -403, -341, -303, -305, -329, -364, -415, -485, -553, -587, -587, -571, -538, -470, -386, -333, -316, -279, -180, -53, 30, 46, 30, 21, 27, 20, -12, -55, -88, -101, -99, -74, -10, 84, 189, 273, 313, 316, 317, 360, 428, 454, 402, 322, 296, 330, 356, 361, 394, 467, 507, 474, 424, 436, 499, 545, 528, 466, 424, 455, 544, 633, 686, 687, 637, 585, 607, 699, 754, 706, 628, 613, 646, 658, 633, 610, 616, 654, 719, 785, 803, 749, 648, 544, 447, 355, 293, 288, 335, 410, 516, 644, 747, 790, 793, 772, 714, 621, 528, 457, 379, 270, 165, 129, 180, 280, 410, 557, 669, 712, 712, 709, 677, 592, 494, 421, 335, 210, 91, 30, -6, -81, -179, -233, -233, -220, -197, -122, -13, 38, -12, -88, -93, -46, -33, -92, -181, -272, -372, -461, -501, -505, -509, -499, -435, -342, -279, -250, -229, -225, -237, -243, -235, -251, -299, -334, -318, -273, -233, -191, -126, -37, 46, 100, 114, 89, 38, -1, -2, 13, -8, -88, -154, -136, -50, 35, 96, 151, 191, 195, 180, 169, 150, 110, 88, 113, 146, 151, 143, 161, 206, 259, 309, 347, 351, 307, 237, 187, 161, 128, 66, 12, 2, 28, 47, 65, 95, 111, 88, 67, 111, 196, 251, 269, 269, 247, 202, 181, 206, 206, 122, 2, -61, -79, -119, -170, -151, -53, 31, 59, 83, 128, 136, 70, -16, -83, -156, -249, -325, -355, -380, -441, -508, -515, -447, -358, -298, -268, -255, -261, -287, -308, -312, -331, -386, -443, -449, -402, -336, -274, -218, -188, -206, -255, -286, -286, -291, -332, -381, -392, -348, -274, -202, -152, -126, -101, -61, -23, -20, -55, -113, -184, -257, -301, -299, -280, -267, -257, -233, -212, -217, -226, -206, -188, -222, -293, -329, -342, -395, -472, -494, -468, -463, -486, -493, -499, -524, -533, -513, -516, -551, -544, -479, -424, -409, -391, -352, -331, -335, -344, -355, -384, -424, -450, -450, -433, -411, -378, -314, -213, -104, -14, 61, 127, 159, 136, 88, 47, -2, -85, -175, -235, -273, -298, -293, -244, -179, -114, -45, 35, 118, 186, 232, 258, 274, 288, 292, 269, 229, 204, 198, 194, 173, 140, 108, 91, 84, 75, 61, 51, 44, 24, 8, 35, 99, 150, 161, 172, 212, 263, 302, 322, 308, 246, 150, 52, -30, -77, -66, -1, 60, 75, 54, 38, 49, 76, 119, 174, 221, 234, 206, 156, 96, 24, -47, -104, -141, -167, -188, -197, -198, -198, -200, -199, -191, -177, -161, -147, -141, -137, -137, -139, -143, -138, -123, -107, -105, -111, -106, -82, -67, -98, -168, -218, -213, -187, -176, -175, -167, -184, -237, -268, -240, -199, -200, -214, -184, -112, -44, -12, -15, -31, -23, 13, 37, 12, -29, -18, 46, 81, 23, -70, -97, -30, 57, 95, 77, 32, -17, -55, -56, -33, -33, -67, -73, -8, 83, 131, 122, 81, 32, 8, 46, 145, 250, 302, 300, 273, 233, 168, 91, 36, 8, -9, -18, 6, 73, 153, 216, 240, 241, 262, 318, 361, 326, 235, 165, 143, 123, 78, 35, 36, 84, 150, 199, 216, 201, 166, 126, 83, 45, 19, 9, 14, 21, 31, 61, 127, 211, 275, 309, 337, 377, 410, 414, 391, 369, 361, 350, 328, 305, 294, 298, 328, 378, 415, 406, 363, 338, 346, 364, 370, 377, 393, 410, 421, 429, 434, 431, 403, 343, 265, 212, 209, 228, 228, 190, 116, 29, -17, 16, 102, 156, 149, 112, 66, 6, -50, -66, -40, -9, -8, -39, -67, -47, 2, 15, -38, -103, -114, -79, -40, -13, -8, -32, -67, -78, -61, -40, -30, -35, -66, -112, -131, -98, -41, -9, -24, -70, -115, -132, -126, -124, -144, -170, -199, -242, -290, -303, -261, -220, -250, -342, -416, -440, -452, -469, -455, -400, -334, -275, -214, -170, -167, -179, -145, -74, -28, -39, -55, -18, 51, 88, 59, -3, -62, -97, -98, -61, -8, 27, 38, 50, 73, 87, 82, 81, 93, 97, 78, 55, 35, 4, -30, -45, -40, -38, -45, -47, -45, -46, -39, -6, 39, 54, 36, 23, 34, 40, 31, 42, 87, 127, 136, 136, 150, 165, 171, 176, 175, 158, 134, 120, 113, 107, 112, 140, 175, 189, 172, 143, 122, 113, 110, 112, 122, 150, 206, 288, 358, 383, 361, 315, 255, 184, 126, 99, 100, 106, 95, 67, 49, 68, 121, 157, 122, 36, -37, -52, -18, 32, 83, 119, 115, 82, 72, 125, 204, 243, 214, 149, 80, 19, -29, -62, -91, -135, -194, -235, -236, -215, -205, -215, -223, -221, -218, -212, -187, -154, -141, -135, -99, -44, -16, -9, 28, 103, 155, 145, 92, 28, -32, -82, -129, -179, -211, -200, -154, -104, -68, -40, -23, -22, -36, -50, -54, -55, -55, -53, -51, -46, -36, -17, 2, 16, 15, 2, -21, -60, -112, -168, -221, -273, -325, -346, -301, -213, -156, -162, -182, -143, -62, -21, -43, -71, -76, -100, -166, -226, -253, -281, -320, -338, -312, -280, -268, -268, -266, -270, -286, -302, -312, -325, -340, -333, -278, -191, -126, -105, -99, -75, -51, -56, -82, -93, -100, -142, -206, -242, -223, -195, -200, -230, -249, -242, -212, -156, -97, -93, -147, -181, -144, -84, -59, -51, -14, 45, 95, 140, 201, 252, 249, 204, 168, 145, 98, 37, 12, 21, 16, -6, 6, 80, 175, 250, 290, 303, 297, 282, 259, 232, 216, 219, 222, 211, 201, 212, 241, 267, 286, 301, 323, 350, 370, 368, 347, 325, 300, 270, 257, 286, 325, 317, 257, 199, 183, 193, 193, 163, 106, 58, 53, 84, 103, 82, 46, 29, 25, 0, -55, -112, -136, -138, -149, -183, -225, -244, -233, -217, -220, -237, -234, -199, -153, -121, -105, -106, -128, -159, -180, -185, -198, -230, -264, -276, -278, -288, -309, -318, -309, -290, -272, -266, -281, -296, -280, -240, -210, -195, -162, -101, -38, -7, -15, -52, -98, -135, -162, -191, -220, -232, -215, -188, -166, -151, -135, -119, -109, -107, -113, -135, -172, -200, -196, -160, -122, -94, -71, -48, -26, -3, 22, 36, 24, 0, -16, -16, -18, -36, -50, -36, -6, 14, 20, 24, 29, 11, -21, -20, 35, 103, 144, 169, 207, 250, 273, 270, 257, 244, 231, 217, 201, 173, 134, 105, 110, 137, 159, 179, 212, 255, 271, 249, 213, 189, 181, 176, 176, 175, 159, 119, 73, 39, 22, 19, 25, 27, 14, 14, 38, 59, 64, 92, 150, 183, 186, 222, 305, 357, 354, 357, 395, 406, 349, 273, 233, 210, 173, 142, 156, 194, 187, 112, 23, -12, 0, 13, 19, 43, 88, 126, 155, 196, 239, 252, 240, 239, 256, 256, 209, 123, 24, -77, -174, -248, -293, -327, -350, -332, -271, -213, -187, -164, -120, -75, -48, -29, -17, -41, -117, -206, -253, -244, -203, -143, -78, -33, -31, -50, -56, -52, -50, -46, -40, -46, -58, -43, 6, 43, 36, 7, -3, 0, -6, -36, -70, -98, -130, -179, -227, -250, -245, -229, -211, -188, -168, -167, -189, -214, -223, -222, -229, -241, -242, -221, -189, -156, -122, -100, -104, -122, -132, -134, -151, -191, -236, -266, -280, -280, -273, -261, -249, -229, -189, -132, -82, -47, -25, -23, -54, -107, -138, -134, -116, -115, -127, -137, -131, -98, -36, 23, 43, 25, 6, 0, -15, -68, -139, -184, -184, -167, -160, -147, -104, -52, -35, -53, -66, -51, -24, -5, -1, -12, -24, -15, 21, 60, 78, 90, 120, 159, 175, 160, 137, 129, 126, 116, 116, 136, 166, 194, 224, 260, 294, 308, 298, 275, 248, 212, 163, 114, 90, 100, 121, 133, 133, 125, 114, 115, 127, 121, 77, 27, 6, -1, -28, -50, -36, -5, 8, 1, -13, -30, -35, -14, 11, 6, -25, -43, -31, -26, -51, -70, -58, -31, -25, -26, -12, 11, 24, 43, 69, 73, 42, 17, 29, 58, 77, 88, 92, 83, 64, 49, 36, 11, -26, -53, -52, -38, -30, -28, -18, 1, 29, 53, 66, 60, 45, 36, 32, 22, 7, 9, 38, 70, 85, 104, 141, 167, 145, 98, 77, 81, 70, 47, 44, 59, 75, 90, 118, 145, 157, 160, 174, 193, 193, 163, 122, 88, 60, 43, 40, 47, 51, 50, 57, 75, 93, 110, 128, 135, 114, 75, 49, 37, 9, -48, -100, -112, -98, -88, -81, -73, -67, -56, -25, 9, 15, -10, -38, -47, -46, -39, -29, -20, -15, -13, -18, -44, -89, -120, -105, -61, -30, -23, -10, 27, 74, 111, 138, 152, 144, 125, 120, 130, 131, 114, 105, 123, 148, 156, 161, 178, 188, 176, 168, 181, 191, 179, 159, 152, 150, 140, 134, 150, 171, 163, 131, 110, 105, 98, 82, 68, 52, 25, 0, -1, 8, 16, 25, 45, 66, 78, 91, 104, 107, 100, 88, 65, 32, 8, 8, 29, 45, 42, 24, 1, -23, -48, -65, -65, -54, -44, -38, -31, -16, 6, 31, 43, 25, -17, -62, -88, -115, -172, -242, -281, -276, -255, -238, -227, -219, -208, -188, -152, -122, -117, -132, -149, -159, -164, -164, -159, -152, -141, -124, -105, -84, -63, -46, -37, -36, -37, -40, -45, -48, -50, -50, -56, -73, -90, -97, -90, -79, -77, -81, -82, -79, -84, -96, -103, -101, -97, -90, -79, -75, -74, -66, -51, -48, -65, -78, -83, -86, -91, -90, -90, -107, -134, -147, -143, -129, -107, -77, -46, -25, -20, -17, -12, 0, 7, 6, -9, -32, -56, -73, -84, -100, -128, -152, -156, -144, -139, -139, -115, -68, -29, -18, -22, -23, -25, -37, -51, -62, -82, -108, -126, -120, -101, -82, -56, -22, 1, -1, -20, -29, -26, -28, -38, -50, -56, -63, -71, -71, -62, -52, -45, -36, -20, -2, 9, 22, 38, 54, 67, 74, 78, 82, 84, 89, 96, 96, 90, 92, 112, 137, 150, 152, 149, 131, 96, 67, 65, 76, 75, 60, 53, 67, 88, 113, 152, 197, 217, 206, 194, 187, 173, 150, 138, 138, 131, 113, 100, 106, 118, 126, 135, 153, 178, 197, 212, 225, 227, 199, 138, 70, 21, -12, -33, -32, -1, 29, 47, 70, 107, 125, 103, 74, 70, 80, 70, 47, 37, 45, 51, 52, 59, 70, 75, 78, 96, 118, 120, 111, 106, 103, 83, 57, 52, 69, 85, 93, 106, 129, 143, 135, 114, 88, 54, 15, -10, -16, -18, -33, -50, -40, 0, 54, 93, 105, 93, 72, 51, 36, 23, 11, 2, 6, 19, 30, 29, 12, -18, -52, -79, -100, -115, -126, -129, -127, -121, -112, -104, -100, -85, -48, -5, 13, 4, -12, -22, -35, -59, -88, -108, -119, -111, -78, -31, 12, 38, 59, 82, 99, 97, 84, 70, 54, 25, -13, -46, -62, -63, -66, -82, -109, -137, -154, -165, -165, -151, -127, -104, -86, -65, -31, 4, 28, 32, 24, 19, 20, 16, -1, -28, -51, -74, -103, -131, -143, -127, -94, -55, -10, 42, 85, 103, 97, 82, 64, 46, 30, 17, 11, 13, 30, 52, 65, 67, 64, 58, 52, 47, 44, 36, 24, 21, 25, 31, 37, 42, 36, 14, -6, -3, 16, 31, 23, -5, -32, -45, -45, -45, -53, -65, -69, -60, -35, 0, 34, 57, 58, 43, 30, 34, 47, 64, 74, 78, 74, 61, 50, 36, 13, -20, -45, -50, -41, -39, -44, -44, -43, -46, -51, -40, -18, -3, -9, -25, -38, -45, -47, -51, -54, -55, -55, -56, -56, -51, -47, -52, -56, -47, -31, -24, -21, -15, -18, -46, -78, -96, -107, -131, -162, -180, -183, -187, -191, -185, -162, -136, -117, -107, -101, -98, -98, -100, -107, -119, -129, -130, -128, -122, -111, -92, -79, -83, -94, -99, -94, -96, -99, -88, -55, -22, -12, -18, -24, -22, -15, -2, 16, 40, 61, 76, 85, 84, 74, 70, 90, 121, 135, 125, 111, 107, 108, 99, 80, 59, 53, 67, 89, 99, 84, 57, 37, 29, 13, -20, -61, -101, -139, -168, -181, -176, -165, -153, -146, -147, -152, -143, -119, -96, -84, -70, -48, -26, -16, -5, 17, 39, 43, 28, 16, 16, 12, 0, -12, -17, -21, -24, -24, -25, -39, -60, -68, -59, -46, -43, -44, -41, -35, -26, -14, 6, 27, 37, 44, 53, 66, 76, 78, 69, 54, 44, 40, 40, 42, 44, 46, 47, 46, 40, 27, 4, -21, -32, -28, -18, -15, -9, 7, 35, 64, 92, 126, 157, 167, 159, 148, 148, 155, 149, 126, 96, 76, 69, 66, 59, 53, 46, 31, 15, 7, 4, 6, 21, 49, 65, 66, 73, 96, 106, 90, 72, 67, 69, 66, 64, 65, 65, 57, 42, 23, 6, -3, -12, -32, -70, -114, -142, -145, -137, -135, -141, -136, -114, -94, -90, -85, -65, -41, -35, -39, -44, -50, -60, -68, -75, -93, -116, -124, -116, -113, -122, -127, -111, -83, -66, -65, -67, -66, -65, -65, -67, -74, -77, -66, -41, -22, -15, -10, 0, 12, 14, 8, -1, -13, -22, -30, -38, -41, -40, -44, -58, -74, -81, -88, -107, -135, -142, -120, -90, -69, -45, -7, 32, 50, 49, 45, 42, 31, 15, 1, -2, 7, 39, 80, 112, 130, 148, 168, 188, 196, 189, 173, 164, 169, 171, 153, 127, 113, 111, 100, 82, 78, 92, 97, 76, 51, 46, 46, 25, -12, -43, -54, -48, -25, 5, 30, 47, 72, 104, 121, 107, 81, 72, 74, 67, 44, 17, -2, -20, -28, -26, -31, -50, -67, -71, -77, -92, -104, -101, -94, -97, -105, -109, -113, -121, -129, -130, -131, -139, -144, -135, -121, -120, -124, -123, -120, -122, -115, -88, -52, -35, -33, -32, -29, -44, -76, -100, -105, -101, -103, -98, -83, -65, -51, -31, -5, 19, 31, 36, 42, 44, 37, 21, 11, 13, 22, 25, 29, 40, 52, 45, 24, 14, 34, 60, 60, 32, 9, 13, 34, 42, 28, 12, 13, 21, 25, 37, 59, 78, 87, 98, 115, 120, 113, 121, 142, 142, 119, 106, 107, 99, 78, 74, 90, 107, 111, 108, 106, 103, 95, 89, 85, 81, 69, 54, 43, 37, 39, 46, 47, 43, 40, 47, 51, 43, 37, 50, 68, 74, 64, 51, 39, 25, 8, -12, -37, -62, -75, -65, -46, -40, -46, -45, -32, -25, -33, -47, -54, -48, -36, -32, -47, -61, -56, -40, -35, -44, -50, -48, -48, -53, -54, -48, -40, -37, -40, -47, -41, -22, -5, -10, -36, -54, -50, -39, -44, -53, -53, -52, -55, -53, -37, -28, -35, -39, -26, -8, 2, 11, 12, 2, 0, 16, 36, 43, 43, 50, 57, 54, 45, 42, 39, 30, 23, 29, 42, 38, 20, 5, 0, -1, 0, 11, 25, 34, 38, 52, 75, 95, 107, 113, 118, 130, 155, 169, 165, 159, 167, 179, 181, 179, 174, 161, 134, 107, 99, 105, 110, 102, 85, 74, 74, 78, 80, 74, 65, 53, 44, 39, 38, 37, 32, 24, 9, -3, -13, -20, -33, -55, -70, -74, -74, -78, -81, -71, -58, -51, -51, -55, -55, -40, -18, -6, -5, 1, 13, 19, 14, 15, 29, 36, 25, 7, -2, -10, -24, -33, -32, -35, -54, -74, -75, -68, -69, -73, -67, -60, -60, -53, -36, -28, -39, -61, -85, -109, -124, -122, -108, -92, -76, -59, -52, -67, -86, -86, -71, -70, -88, -92, -78, -73, -84, -88, -73, -54, -40, -24, -14, -20, -25, -15, 0, 5, 4, 13, 22, 16, 1, -2, 2, -2, -26, -54, -68, -69, -58, -40, -31, -41, -58, -61, -61, -69, -81, -88, -97, -109, -112, -99, -89, -98, -114, -114, -94, -74, -61, -50, -36, -31, -39, -47, -48, -48, -56, -69, -83, -91, -93, -93, -93, -94, -93, -88, -76, -60, -44, -35, -30, -23, -15, -17, -33, -47, -50, -48, -50, -50, -44, -41, -53, -71, -78, -73, -67, -62, -52, -33, -16, -6, 1, 7, 14, 23, 30, 27, 15, 2, -7, -20, -32, -38, -29, -9, 7, 13, 5, -2, -3, -3, -10, -16, -8, 13, 32, 40, 45, 57, 69, 73, 75, 82, 84, 80, 78, 84, 84, 73, 62, 55, 45, 39, 45, 53, 44, 22, 14, 29, 47, 47, 32, 17, 13, 17, 25, 23, 2, -22, -30, -24, -25, -36, -35, -20, -10, -17, -31, -43, -53, -67, -78, -83, -91, -108, -128, -138, -142, -146, -150, -146, -135, -122, -112, -104, -100, -103, -103, -96, -83, -71, -67, -62, -51, -35, -28, -35, -48, -56, -54, -48, -46, -50, -54, -55, -48, -40, -37, -36, -33, -30, -26, -17, -5, 2, 0, -2, 0, 5, 12, 16, 23, 27, 25, 23, 25, 27, 23, 12, 0, -7, -14, -23, -32, -35, -25, -8, 4, 5, 0, 0, 13, 30, 43, 50, 58, 68, 72, 70, 73, 78, 81, 83, 92, 99, 93, 82, 78, 83, 85, 85, 85, 84, 82, 85, 98, 114, 123, 126, 127, 133, 137, 140, 141, 138, 133, 133, 138, 140, 138, 146, 165, 172, 166, 165, 176, 181, 175, 169, 172, 172, 168, 164, 157, 145, 135, 128, 121, 107, 96, 93, 96, 95, 90, 95, 106, 113, 107, 95, 83, 80, 88, 99, 98, 83, 76, 88, 100, 100, 97, 97, 96, 91, 91, 96, 95, 85, 75, 67, 62, 65, 77, 83, 69, 44, 35, 47, 58, 52, 42, 36, 31, 29, 37, 44, 35, 16, 12, 21, 31, 37, 34, 17, -1, -5, 5, 11, 6, 4, 8, 12, 8, 8, 17, 23, 21, 21, 30, 31, 14, -3, -9, -16, -32, -43, -39, -37, -46, -52, -47, -36, -18, 1, 20, 32, 50, 66, 73, 75, 82, 87, 75, 59, 50, 40, 13, -17, -31, -24, -17, -24, -36, -46, -53, -56, -54, -46, -43, -46, -52, -51, -46, -40, -40, -44, -51, -59, -60, -59, -60, -69, -76, -75, -71, -74, -76, -71, -63, -58, -56, -61, -67, -61, -39, -21, -24, -35, -31, -21, -23, -35, -38, -28, -23, -31, -41, -47, -53, -62, -65, -61, -66, -78, -83, -73, -68, -73, -74, -66, -59, -56, -54, -53, -59, -70, -83, -97, -107, -109, -98, -78, -59, -43, -35, -38, -50, -58, -54, -54, -65, -76, -71, -63, -66, -73, -73, -69, -65, -58, -54, -61, -70, -69, -61, -61, -66, -66, -61, -65, -77, -86, -89, -94, -107, -121, -131, -137, -139, -132, -121, -119, -123, -122, -120, -126, -132, -129, -123, -124, -126, -114, -101, -106, -124, -134, -123, -107, -101, -101, -97, -93, -94, -97, -94, -92, -98, -106, -111, -108, -103, -97, -94, -96, -97, -94, -86, -75, -62, -53, -51, -53, -58, -68, -85, -105, -121, -128, -126, -117, -107, -101, -99, -100, -100, -96, -85, -77, -73, -71, -68, -60, -54, -50, -44, -33, -28, -30, -38, -45, -51, -58, -62, -59, -50, -37, -22, -7, -2, -7, -13, -16, -22, -26, -17, 0, 7, 5, 4, 13, 23, 24, 17, 11, 2, -5, -8, -7, -7, -15, -25, -32, -39, -40, -30, -15, -10, -23, -33, -26, -8, 4, 0, -12, -22, -24, -18, -12, -18, -40, -55, -54, -50, -53, -54, -44, -30, -24, -22, -22, -28, -32, -28, -22, -22, -23, -22, -23, -29, -25, -9, 6, 12, 13, 22, 35, 42, 38, 37, 43, 54, 66, 73, 75, 74, 77, 85, 88, 78, 67, 66, 73, 76, 72, 72, 82, 96, 103, 100, 97, 98, 103, 110, 110, 104, 98, 98, 98, 95, 98, 107, 108, 102, 100, 112, 127, 136, 138, 129, 112, 103, 107, 116, 118, 116, 122, 129, 135, 138, 140, 138, 140, 141, 138, 142, 157, 173, 173, 161, 159, 167, 168, 159, 148, 138, 130, 125, 116, 103, 85, 80, 92, 110, 120, 120, 115, 112, 112, 111, 100, 87, 81, 83, 82, 73, 62, 62, 70, 74, 65, 51, 46, 53, 55, 47, 37, 32, 29, 19, 9, 6, 4, -1, -8, -12, -16, -18, -16, -12, -10, -15, -21, -22, -20, -13, -7, -5, -8, -14, -15, -12, -10, -10, -6, 1, 7, 12, 17, 16, 7, 0, 0, -1, -8, -13, -10, -10, -17, -25, -31, -37, -43, -45, -41, -40, -47, -52, -47, -39, -38, -43, -46, -48, -51, -52, -46, -38, -35, -36, -36, -33, -29, -28, -30, -32, -35, -38, -41, -45, -46, -43, -38, -33, -33, -31, -23, -15, -14, -23, -33, -37, -38, -43, -46, -41, -25, -8, 0, 2, 2, 6, 13, 23, 32, 35, 27, 14, 8, 7, 0, -17, -35, -45, -48, -48, -48, -45, -43, -43, -36, -17, 1, 7, 2, -1, 0, 7, 17, 34, 51, 59, 55, 49, 47, 51, 53, 53, 49, 43, 40, 47, 58, 65, 69, 73, 74, 75, 77, 78, 72, 59, 51, 50, 51, 50, 49, 49, 45, 40, 44, 58, 68, 65, 59, 61, 65, 60, 52, 51, 59, 69, 78, 82, 78, 77, 88, 104, 106, 90, 74, 81, 98, 102, 88, 75, 74, 76, 77, 84, 95, 102, 98, 92, 90, 92, 97, 98, 95, 88, 87, 95, 103, 98, 89, 89, 90, 77, 60, 55, 59, 58, 50, 42, 34, 30, 36, 44, 40, 28, 21, 17, 8, -7, -16, -14, -1, 13, 22, 22, 20, 22, 28, 29, 24, 20, 16, 12, 8, 11, 14, 9, 0, -8, -7, -2, -3, -13, -21, -25, -24, -22, -28, -43, -53, -46, -31, -24, -31, -38, -35, -26, -26, -37, -51, -54, -51, -51, -59, -60, -51, -39, -39, -51, -59, -58, -56, -65, -79, -94, -101, -101, -100, -104, -112, -114, -107, -97, -92, -91, -91, -97, -109, -121, -124, -119, -114, -116, -122, -126, -117, -103, -96, -97, -97, -91, -88, -92, -99, -103, -103, -103, -103, -99, -93, -83, -73, -68, -74, -81, -83, -83, -88, -94, -97, -89, -76, -65, -58, -53, -47, -39, -31, -32, -39, -43, -43, -48, -63, -74, -74, -70, -69, -65, -56, -48, -41, -35, -25, -21, -22, -26, -32, -32, -24, -10, -1, -2, -9, -9, -2, 5, 7, 4, 0, 0, -2, -12, -18, -17, -9, -1, 0, -9, -24, -33, -29, -18, -17, -25, -32, -37, -44, -52, -55, -52, -52, -58, -62, -61, -59, -56, -51, -46, -53, -70, -83, -84, -81, -77, -75, -76, -79, -76, -63, -55, -63, -77, -83, -78, -76, -82, -90, -92, -90, -88, -89, -89, -86, -83, -83, -81, -76, -77, -88, -98, -98, -84, -69, -65, -66, -62, -53, -45, -53, -68, -76, -73, -70, -73, -73, -67, -65, -69, -73, -67, -58, -55, -60, -67, -70, -68, -60, -50, -45, -51, -61, -67, -67, -66, -65, -63, -66, -69, -67, -55, -46, -52, -67, -76, -74, -67, -61, -54, -54, -66, -73, -59, -41, -41, -48, -45, -40, -47, -51, -44, -43, -51, -50, -38, -39, -55, -65, -54, -36, -25, -29, -40, -45, -35, -17, -9, -14, -17, -16, -13, -9, -3, 2, 1, -6, -7, 0, 6, 2, -5, -7, -2, 5, 14, 22, 22, 13, 6, 5, 7, 13, 22, 27, 22, 14, 14, 23, 32, 37, 35, 35, 39, 47, 52, 53, 53, 54, 57, 59, 62, 66, 66, 65, 65, 66, 65, 62, 61, 64, 70, 76, 73, 59, 45, 40, 42, 43, 46, 51, 50, 46, 46, 54, 64, 73, 76, 73, 67, 73, 85, 82, 59, 38, 42, 61, 74, 69, 58, 53, 57, 65, 70, 73, 72, 67, 61, 60, 65, 68, 67, 60, 53, 49, 46, 45, 44, 43, 39, 35, 32, 34, 37, 42, 49, 54, 53, 50, 49, 49, 45, 38, 37, 44, 49, 43, 32, 25, 21, 13, 4, -2, -6, -6, -1, 1, 0, -5, 0, 8, 11, 7, 8, 12, 8, 0, -3, -8, -14, -15, -9, -3, -5, -10, -13, -9, -5, -3, -12, -18, -15, -5, 0, 0, 0, 0, -2, -8, -9, -9, -15, -22, -22, -15, -9, -8, -8, -6, -1, 2, 5, 6, 4, -1, -2, -1, 0, 4, 12, 16, 11, 0, -6, -7, -9, -8, -5, -3, -9, -20, -28, -30, -29, -24, -17, -7, -2, -6, -13, -16, -15, -13, -12, -10, -6, -5, -7, -10, -13, -13, -14, -15, -14, -9, -1, 4, 0, -13, -22, -17, -5, 0, -9, -20, -22, -18, -9, 5, 19, 17, 2, -3, 2, 8, 8, 9, 14, 19, 20, 22, 23, 23, 21, 22, 28, 36, 42, 43, 43, 46, 47, 40, 31, 27, 31, 35, 36, 39, 46, 52, 55, 57, 52, 44, 38, 40, 46, 49, 46, 46, 50, 52, 49, 43, 39, 40, 43, 45, 45, 42, 43, 50, 55, 54, 49, 47, 50, 51, 50, 49, 49, 51, 50, 43, 32, 24, 23, 27, 30, 29, 20, 8, 5, 16, 31, 37, 31, 23, 19, 19, 19, 19, 19, 22, 28, 31, 35, 40, 43, 35, 24, 24, 25, 14, 0, 0, 6, 2, -3, -6, -8, -13, -6, 7, 7, -8, -15, -8, -1, -1, -2, 0, 0, 1, 9, 21, 23, 13, 8, 15, 17, 11, 11, 22, 27, 20, 20, 23, 19, 13, 19, 24, 13, -3, -7, -1, 2, 6, 11, 9, -1, -14, -12, 1, 7, 6, 5, 5, 0, -6, -5, -3, -12, -17, -13, -13, -22, -28, -18, -6, -1, 0, 6, 8, 1, -7, -10, -13, -18, -21, -13, -3, -5, -12, -15, -15, -20, -23, -24, -26, -29, -25, -18, -20, -22, -10, 5, 7, -9, -25, -28, -22, -14, -9, -9, -17, -29, -30, -23, -24, -35, -39, -29, -17, -13, -6, 4, 9, 6, 0, -6, -8, -1, 9, 15, 15, 16, 21, 20, 14, 14, 16, 16, 14, 14, 16, 16, 14, 15, 16, 15, 19, 32, 49, 49, 31, 19, 23, 32, 30, 20, 17, 22, 24, 22, 23, 27, 25, 20, 21, 25, 23, 16, 19, 25, 23, 13, 5, 5, 7, 5, 0, -6, -13, -21, -24, -25, -26, -28, -29, -30, -31, -25, -14, -12, -21, -31, -35, -43, -55, -56, -46, -45, -55, -59, -50, -50, -61, -69, -69, -69, -69, -63, -56, -59, -69, -74, -68, -61, -59, -56, -53, -58, -68, -69, -61, -55, -54, -53, -53, -60, -61, -48, -38, -45, -56, -53, -39, -35, -43, -52, -55, -58, -58, -52, -45, -48, -63, -76, -76, -73, -70, -67, -61, -60, -66, -71, -74, -76, -81, -82, -81, -81, -86, -90, -83, -70, -66, -68, -73, -76, -79, -79, -78, -79, -78, -74, -67, -62, -62, -67, -74, -78, -73, -62, -58, -61, -69, -73, -73, -68, -62, -55, -53, -53, -53, -48, -44, -40, -40, -44, -47, -46, -37, -25, -23, -25, -23, -14, -10, -17, -26, -30, -30, -31, -31, -28, -23, -21, -20, -13, -1, 8, 17, 21, 13, 1, 1, 15, 27, 22, 8, 5, 13, 20, 21, 21, 20, 13, 4, 0, 0, 0, 6, 19, 23, 20, 23, 38, 44, 34, 22, 20, 23, 28, 37, 44, 43, 37, 36, 34, 28, 28, 35, 37, 22, 4, -1, 5, 8, 4, -1, -2, 0, 0, 0, -1, -7, -10, -6, -2, -6, -14, -15, -13, -14, -18, -23, -21, -17, -18, -26, -37, -40, -36, -28, -26, -33, -39, -37, -32, -35, -41, -43, -37, -30, -24, -22, -22, -21, -18, -15, -13, -14, -16, -16, -18, -23, -23, -15, -8, -12, -20, -18, -12, -13, -23, -32, -30, -25, -21, -15, -5, 1, 2, 7, 14, 8, -9, -20, -17, -16, -12, 5, 25, 30, 22, 20, 25, 31, 32, 32, 29, 24, 30, 43, 47, 37, 27, 28, 31, 28, 24, 32, 39, 31, 22, 24, 34, 30, 19, 12, 7, 0, 0, 12, 23, 25, 23, 29, 35, 31, 21, 17, 23, 29, 25, 14, 6, 4, 7, 12, 14, 11, 8, 9, 11, 8, 6, 6, 9, 13, 13, 9, 4, 2, 7, 9, 0, -10, -13, -3, 0, -5, -7, 0, 5, 0, -3, 4, 14, 15, 16, 22, 28, 23, 15, 16, 25, 31, 28, 21, 16, 15, 17, 24, 31, 35, 36, 35, 32, 30, 28, 24, 21, 23, 31, 38, 42, 49, 55, 53, 40, 36, 46, 60, 60, 50, 44, 49, 54, 53, 49, 47, 47, 45, 44, 50, 59, 61, 57, 58, 66, 67, 57, 51, 55, 58, 51, 45, 49, 50, 45, 40, 47, 59, 65, 60, 51, 44, 38, 37, 39, 44, 44, 39, 37, 39, 40, 35, 27, 23, 29, 35, 35, 29, 25, 25, 29, 34, 38, 38, 31, 28, 35, 42, 37, 24, 16, 19, 22, 21, 16, 12, 11, 14, 14, 7, 0, 1, 8, 9, 0, -7, -7, -1, 5, 8, 6, -2, -9, -7, -3, -7, -15, -15, -9, -10, -10, 0, 7, 0, -16, -24, -22, -18, -20, -21, -21, -21, -20, -17, -15, -16, -20, -21, -18, -15, -10, -8, -13, -21, -23, -17, -15, -21, -21, -15, -13, -20, -24, -21, -22, -28, -28, -13, 1, -2, -21, -35, -35, -30, -28, -28, -29, -30, -29, -23, -24, -30, -33, -32, -32, -26, -15, -9, -16, -22, -17, -14, -16, -14, -8, -14, -30, -36, -29, -22, -20, -18, -21, -29, -31, -24, -21, -26, -32, -32, -33, -38, -43, -40, -38, -40, -47, -52, -53, -54, -56, -61, -63, -65, -67, -68, -62, -55, -54, -55, -59, -63, -70, -71, -65, -61, -63, -65, -60, -59, -62, -62, -58, -56, -60, -62, -63, -69, -75, -73, -66, -65, -73, -79, -76, -68, -63, -65, -67, -68, -67, -62, -59, -60, -62, -66, -70, -79, -84, -81, -73, -65, -55, -47, -51, -62, -67, -58, -45, -43, -50, -53, -50, -51, -55, -55, -51, -47, -44, -36, -35, -45, -54, -51, -40, -36, -33, -30, -33, -46, -58, -58, -48, -44, -47, -52, -56, -59, -55, -44, -33, -37, -48, -54, -54, -50, -46, -46, -54, -61, -55, -40, -32, -40, -52, -50, -43, -41, -44, -39, -31, -31, -39, -43, -40, -39, -37, -32, -31, -33, -31, -25, -26, -37, -45, -44, -41, -43, -41, -35, -28, -23, -24, -28, -32, -40, -46, -45, -39, -31, -28, -28, -33, -39, -40, -36, -30, -29, -29, -25, -20, -16, -15, -14, -9, -2, 0, -1, -3, -5, -6, -8, -9, -7, -1, 4, 9, 13, 13, 11, 9, 5, 0, 2, 13, 23, 27, 22, 20, 23, 25, 25, 27, 28, 23, 17, 17, 23, 25, 22, 14, 7, 2, 5, 15, 22, 15, 0, -5, 6, 22, 27, 22, 15, 9, 11, 17, 24, 17, 2, 0, 9, 9, -3, -10, 0, 13, 15, 8, 0, -3, -2, 4, 8, 7, 4, 1, 1, 2, 5, 8, 12, 13, 12, 12, 14, 16, 12, 6, 6, 15, 24, 25, 23, 27, 37, 43, 40, 35, 34, 39, 44, 46, 45, 44, 46, 55, 64, 62, 55, 51, 57, 65, 66, 62, 64, 65, 61, 55, 58, 64, 64, 58, 58, 66, 74, 77, 77, 74, 70, 69, 74, 78, 83, 84, 84, 83, 83, 84, 82, 78, 77, 75, 70, 73, 83, 89, 83, 77, 81, 87, 88, 89, 90, 87, 83, 84, 81, 67, 58, 64, 75, 78, 81, 84, 84, 78, 77, 81, 81, 75, 72, 74, 74, 70, 67, 68, 70, 68, 59, 53, 54, 61, 64, 61, 58, 58, 55, 47, 39, 37, 39, 42, 38, 34, 30, 30, 32, 31, 25, 16, 9, 11, 14, 14, 13, 12, 9, 6, 4, 2, 1, 0, 0, 1, 5, 9, 12, 9, 6, 7, 9, 4, -1, 2, 9, 7, 0, -5, -2, -2, -5, -6, -6, -7, -13, -17, -17, -13, -10, -15, -24, -29, -25, -21, -22, -24, -24, -24, -25, -29, -29, -26, -26, -30, -30, -26, -24, -26, -30, -31, -31, -31, -32, -30, -25, -24, -26, -30, -32, -35, -40, -47, -50, -46, -40, -37, -37, -39, -41, -40, -36, -29, -21, -18, -20, -22, -21, -18, -23, -35, -44, -45, -41, -41, -43, -45, -47, -52, -52, -44, -35, -36, -45, -51, -48, -46, -45, -39, -30, -26, -33, -38, -35, -29, -26, -29, -31, -35, -35, -32, -29, -26, -26, -26, -25, -22, -17, -16, -20, -24, -29, -29, -24, -20, -18, -25, -33, -35, -31, -26, -26, -28, -25, -21, -18, -21, -24, -22, -15, -7, -5, -10, -17, -12, 1, 7, -2, -18, -17, -1, 6, -2, -14, -14, -10, -12, -10, -2, 1, -3, -12, -14, -10, -9, -9, -10, -14, -20, -20, -13, -9, -16, -17, -7, -1, -9, -17, -15, -8, -8, -14, -20, -23, -20, -12, -8, -13, -18, -17, -18, -24, -31, -31, -26, -21, -18, -20, -24, -26, -25, -23, -24, -26, -26, -25, -23, -23, -24, -26, -30, -31, -29, -24, -21, -22, -28, -32, -30, -22, -17, -29, -44, -44, -31, -23, -29, -35, -32, -24, -20, -21, -28, -33, -30, -23, -24, -32, -31, -20, -13, -20, -28, -25, -18, -20, -26, -30, -28, -28, -29, -26, -25, -29, -33, -31, -24, -18, -15, -16, -24, -32, -32, -29, -30, -33, -36, -37, -37, -32, -26, -26, -29, -26, -23, -28, -33, -31, -25, -23, -25, -25, -23, -21, -16, -10, -10, -15, -20, -21, -22, -24, -24, -23, -17, -10, -8, -9, -10, -5, 2, 7, 2, 0, 2, 7, 2, -6, -8, -3, -1, -3, -5, -1, 1, 1, 4, 9, 15, 14, 7, 1, 4, 12, 20, 21, 19, 16, 17, 23, 28, 28, 25, 23, 22, 20, 15, 14, 16, 22, 27, 29, 23, 13, 11, 19, 27, 28, 23, 21, 20, 19, 19, 20, 19, 16, 15, 15, 15, 12, 14, 22, 27, 19, 6, 2, 7, 12, 13, 13, 11, 8, 13, 24, 29, 24, 19, 17, 20, 20, 17, 12, 7, 6, 6, 5, 1, 0, 1, 4, 4, 2, 0, -5, -8, -7, -1, 0, -5, -7, 0, 12, 11, 0, -6, -2, 1, 0, -2, -1, 0, -1, -5, -5, 0, 1, 0, -2, -7, -10, -12, -6, 1, 2, -7, -18, -23, -21, -18, -17, -18, -20, -17, -13, -10, -12, -16, -20, -24, -26, -20, -9, -6, -15, -26, -28, -23, -24, -28, -26, -22, -22, -24, -22, -18, -21, -23, -20, -17, -23, -30, -29, -22, -16, -15, -18, -25, -28, -21, -13, -12, -15, -18, -22, -24, -22, -20, -23, -29, -30, -25, -23, -29, -33, -35, -32, -30, -28, -22, -17, -21, -29, -33, -33, -31, -28, -24, -24, -28, -31, -30, -28, -25, -26, -30, -31, -29, -24, -25, -30, -35, -35, -31, -26, -24, -26, -29, -28, -24, -28, -33, -31, -24, -18, -15, -13, -15, -21, -24, -22, -18, -16, -13, -10, -15, -23, -23, -14, -6, -5, -6, -3, 0, 1, 4, 1, -9, -22, -22, -7, 2, 0, -9, -12, -7, -1, 2, 2, -2, -5, -1, 0, -5, -6, -1, -1, -7, -10, -8, -6, -3, -2, -2, -6, -5, 0, 2, -1, -5, -2, 2, 5, 2, 0, -1, -5, -3, 2, 8, 6, 1, 2, 6, 1, -6, -9, -6, -1, 0, -3, -7, -5, 2, 6, 2, 0, 2, 5, 4, 1, 1, -1, -3, -3, -2, -2, 0, 6, 8, 4, 1, 4, 1, -3, -3, 4, 11, 12, 12, 12, 9, 5, 2, 2, 1, -2, 0, 8, 12, 5, 2, 8, 11, 8, 11, 16, 14, 7, 6, 9, 9, 9, 15, 20, 16, 9, 5, 5, 6, 9, 14, 13, 8, 7, 9, 14, 14, 13, 14, 17, 17, 15, 12, 7, 6, 9, 15, 17, 20, 23, 22, 14, 11, 15, 17, 11, 9, 17, 24, 24, 21, 20, 19, 22, 29, 30, 20, 9, 9, 14, 20, 29, 35, 30, 21, 17, 20, 23, 27, 28, 25, 24, 28, 30, 23, 19, 25, 35, 36, 35, 40, 46, 43, 34, 30, 32, 36, 38, 42, 40, 36, 37, 50, 59, 52, 36, 31, 42, 49, 45, 39, 38, 44, 49, 51, 50, 44, 40, 40, 40, 40, 38, 35, 31, 30, 35, 43, 44, 38, 31, 32, 35, 35, 37, 43, 44, 36, 28, 31, 39, 37, 25, 22, 30, 35, 28, 24, 34, 43, 40, 34, 27, 23, 24, 30, 32, 29, 29, 36, 40, 38, 36, 35, 32, 32, 35, 34, 23, 15, 19, 23, 23, 21, 21, 20, 19, 23, 28, 25, 17, 13, 14, 15, 15, 14, 14, 15, 16, 17, 17, 14, 8, 7, 11, 14, 13, 11, 9, 11, 12, 11, 5, 0, 1, 6, 5, -1, -3, -2, -2, 0, 7, 11, 1, -13, -20, -14, -7, -6, -9, -10, -14, -18, -21, -23, -26, -31, -28, -21, -21, -29, -31, -26, -24, -28, -32, -30, -26, -28, -32, -38, -43, -46, -46, -45, -44, -44, -44, -46, -52, -56, -54, -50, -48, -51, -51, -53, -58, -58, -48, -41, -50, -65, -70, -61, -54, -52, -52, -52, -59, -68, -66, -56, -56, -62, -58, -48, -50, -55, -51, -41, -40, -44, -47, -50, -52, -47, -41, -44, -45, -38, -33, -38, -43, -39, -36, -37, -38, -35, -33, -37, -35, -30, -30, -38, -39, -30, -23, -29, -39, -40, -36, -35, -35, -33, -33, -36, -35, -28, -25, -29, -32, -31, -32, -36, -39, -40, -39, -37, -37, -40, -44, -45, -43, -40, -40, -44, -50, -54, -53, -50, -48, -48, -45, -41, -38, -33, -29, -30, -38, -44, -46, -50, -53, -52, -47, -47, -48, -44, -38, -40, -50, -53, -48, -43, -43, -43, -41, -41, -45, -47, -46, -45, -41, -37, -37, -45, -54, -52, -43, -38, -40, -43, -43, -43, -41, -36, -29, -29, -38, -40, -32, -25, -29, -37, -41, -40, -38, -33, -32, -39, -48, -50, -43, -37, -37, -36, -32, -32, -37, -41, -41, -41, -44, -45, -45, -46, -50, -48, -44, -38, -38, -41, -45, -47, -44, -37, -32, -35, -39, -37, -30, -25, -25, -32, -41, -41, -31, -20, -16, -20, -26, -30, -31, -28, -21, -17, -20, -23, -23, -21, -20, -21, -23, -25, -24, -18, -9, -7, -12, -13, -6, -1, -7, -16, -17, -14, -9, -9, -9, -9, -7, -5, -3, -3, -1, 1, 0, -1, 0, 5, 6, 5, 6, 7, 6, 5, 6, 12, 19, 21, 17, 9, 5, 7, 14, 20, 23, 24, 24, 23, 23, 25, 28, 28, 25, 23, 25, 35, 43, 43, 34, 25, 24, 27, 29, 31, 34, 31, 24, 20, 23, 30, 32, 30, 28, 32, 37, 37, 34, 30, 31, 37, 43, 43, 38, 35, 32, 32, 35, 37, 37, 32, 31, 32, 32, 29, 27, 30, 36, 37, 35, 35, 39, 40, 35, 30, 30, 31, 34, 37, 43, 43, 35, 28, 31, 42, 46, 44, 42, 38, 36, 37, 44, 49, 44, 40, 46, 55, 55, 45, 36, 38, 45, 51, 55, 59, 59, 57, 59, 62, 58, 45, 34, 30, 35, 45, 53, 53, 45, 34, 30, 35, 39, 42, 42, 39, 35, 29, 30, 31, 25, 16, 15, 20, 19, 16, 20, 21, 15, 12, 16, 20, 14, 8, 9, 9, 4, 0, 6, 11, 7, 2, 7, 12, 5, -3, 0, 9, 7, -5, -13, -14, -13, -10, -8, -9, -14, -15, -13, -14, -15, -12, -8, -12, -16, -14, -10, -15, -21, -20, -15, -15, -20, -21, -16, -14, -15, -14, -12, -10, -14, -15, -8, -5, -8, -10, -3, 2, 0, -7, -3, 5, 5, -5, -13, -13, -9, -7, -5, -3, -5, -9, -14, -13, -8, -3, -3, -6, -6, -3, 0, 0, -1, -1, -1, -3, -7, -3, -1, -9, -21, -20, -12, -10, -18, -17, -7, -5, -13, -15, -9, -6, -8, -10, -6, 0, -3, -14, -23, -22, -16, -15, -16, -13, -6, -6, -10, -9, -5, -6, -7, -5, -2, -6, -9, -7, -3, -5, -5, -5, -9, -15, -16, -13, -8, -2, 0, -3, -13, -13, -6, 0, 0, 0, -1, -3, -2, 2, 6, 0, -9, -10, -3, -1, -7, -13, -13, -10, -9, -10, -13, -16, -18, -16, -13, -14, -15, -12, -6, -5, -7, -9, -14, -16, -14, -9, -12, -17, -16, -9, -6, -9, -12, -8, -7, -13, -20, -21, -20, -22, -24, -22, -16, -15, -15, -13, -9, -9, -13, -18, -20, -16, -10, -14, -22, -23, -16, -13, -14, -14, -14, -17, -22, -21, -15, -12, -13, -12, -8, -6, -9, -17, -22, -20, -14, -13, -16, -20, -23, -25, -28, -28, -26, -24, -22, -20, -17, -15, -17, -17, -16, -16, -20, -21, -17, -16, -22, -29, -29, -26, -25, -25, -25, -30, -33, -31, -28, -30, -32, -31, -30, -33, -37, -37, -37, -39, -40, -43, -45, -45, -40, -38, -43, -48, -50, -48, -46, -41, -38, -37, -38, -38, -39, -41, -43, -37, -32, -30, -30, -28, -26, -30, -37, -36, -30, -29, -35, -38, -37, -33, -30, -26, -28, -33, -36, -26, -17, -20, -28, -26, -17, -9, -13, -23, -28, -24, -18, -16, -18, -17, -15, -13, -10, -8, -6, -8, -10, -9, -2, 0, 0, -7, -12, -10, -5, -1, -5, -8, -3, 4, 7, 4, -3, -9, -7, 1, 9, 12, 12, 8, 0, -8, -8, 0, 2, 2, 5, 11, 12, 11, 9, 9, 6, 2, 1, 2, 5, 7, 6, 2, 1, 6, 13, 15, 11, 7, 9, 14, 15, 12, 11, 13, 14, 13, 12, 12, 12, 12, 11, 12, 14, 14, 11, 6, 5, 8, 9, 8, 9, 14, 16, 19, 23, 24, 17, 8, 9, 14, 15, 13, 15, 21, 22, 17, 14, 16, 20, 21, 19, 16, 15, 16, 21, 23, 20, 14, 14, 17, 20, 15, 9, 8, 11, 15, 17, 16, 14, 13, 14, 17, 17, 9, -1, -8, -6, 4, 12, 13, 6, 0, 0, 5, 8, 6, 2, 4, 6, 2, -1, -3, -2, -5, -6, -2, 0, 0, 0, 1, 0, -1, 4, 8, 2, -7, -9, -5, 0, 1, 4, 2, 0, -2, 4, 9, 6, 0, 0, 5, 6, 0, -5, -2, 0, 4, 5, 4, -1, -2, 2, 6, 5, 4, 6, 5, 2, 5, 11, 12, 2, -2, 2, 14, 17, 12, 11, 17, 24, 23, 16, 13, 14, 17, 22, 28, 28, 21, 20, 28, 32, 24, 16, 21, 29, 27, 19, 15, 16, 16, 15, 14, 15, 17, 16, 12, 8, 12, 17, 17, 14, 12, 16, 20, 21, 21, 21, 16, 11, 8, 12, 14, 8, 6, 9, 11, 7, 9, 19, 20, 12, 7, 14, 19, 15, 13, 16, 23, 24, 16, 4, -1, 5, 13, 13, 13, 19, 25, 23, 20, 20, 22, 21, 20, 23, 25, 24, 22, 21, 20, 20, 20, 16, 11, 12, 17, 22, 24, 25, 24, 19, 12, 12, 16, 19, 17, 16, 15, 14, 15, 19, 20, 14, 5, 5, 9, 9, 4, 0, 2, 2, 1, 2, 2, -1, -5, -2, 1, 2, 2, 2, 2, 1, 1, 0, -6, -7, -2, -1, -7, -10, -7, -2, -5, -8, -9, -6, -6, -12, -17, -17, -14, -13, -16, -17, -15, -10, -9, -12, -13, -13, -15, -20, -22, -17, -14, -15, -17, -15, -12, -12, -15, -15, -13, -15, -21, -21, -14, -9, -13, -16, -14, -9, -13, -21, -25, -22, -17, -18, -20, -20, -21, -23, -24, -21, -17, -16, -14, -10, -9, -10, -12, -12, -14, -16, -16, -12, -9, -12, -17, -23, -24, -20, -13, -10, -17, -25, -28, -22, -20, -21, -20, -16, -17, -21, -22, -20, -17, -20, -22, -24, -24, -22, -20, -20, -21, -22, -22, -21, -17, -13, -12, -15, -18, -18, -17, -15, -12, -9, -10, -14, -13, -10, -10, -15, -18, -16, -12, -12, -14, -14, -9, -5, -1, -2, -6, -8, -3, 6, 8, 0, -8, -2, 11, 13, 2, -6, -6, 0, 2, 4, 5, 7, 7, 8, 12, 14, 11, 9, 11, 11, 7, 6, 9, 9, 6, 8, 15, 15, 8, 8, 15, 20, 17, 14, 9, 6, 9, 20, 22, 17, 15, 14, 9, 4, 6, 11, 12, 11, 15, 19, 16, 12, 11, 11, 9, 8, 8, 11, 11, 12, 15, 16, 12, 9, 14, 20, 17, 11, 8, 12, 16, 16, 12, 6, 5, 8, 12, 12, 9, 9, 13, 14, 14, 11, 7, 7, 9, 13, 13, 12, 13, 16, 17, 15, 14, 12, 11, 8, 7, 8, 9, 11, 12, 13, 11, 7, 6, 6, 8, 8, 6, 2, 0, -1, 0, 1, 0, -5, -7, -9, -8, -7, -6, -6, -6, -5, -5, -6, -7, -8, -9, -10, -10, -9, -9, -10, -9, -5, -1, -5, -10, -14, -12, -8, -9, -13, -15, -14, -12, -13, -16, -17, -13, -8, -9, -13, -13, -10, -12, -17, -21, -18, -17, -22, -29, -28, -25, -25, -23, -14, -10, -18, -26, -26, -22, -22, -25, -24, -21, -21, -23, -22, -17, -16, -18, -18, -17, -20, -24, -23, -18, -17, -17, -17, -20, -25, -26, -21, -16, -16, -17, -18, -20, -18, -17, -18, -18, -15, -8, -10, -20, -24, -18, -12, -10, -17, -24, -28, -25, -22, -21, -26, -33, -31, -21, -16, -22, -28, -25, -20, -20, -24, -25, -22, -22, -25, -28, -26, -25, -29, -31, -31, -31, -32, -32, -35, -38, -39, -35, -31, -35, -37, -30, -22, -23, -31, -32, -28, -25, -32, -37, -35, -30, -31, -33, -32, -29, -25, -25, -26, -31, -35, -35, -29, -24, -28, -36, -41, -44, -44, -41, -38, -37, -38, -36, -30, -30, -36, -39, -38, -36, -38, -37, -30, -26, -32, -39, -39, -35, -36, -39, -37, -32, -32, -37, -38, -35, -30, -29, -30, -33, -37, -39, -38, -36, -33, -31, -32, -36, -35, -31, -29, -29, -29, -30, -31, -32, -30, -29, -31, -36, -35, -30, -28, -32, -35, -31, -28, -28, -29, -25, -23, -28, -35, -36, -31, -26, -26, -28, -28, -29, -29, -26, -24, -25, -28, -26, -23, -24, -26, -25, -24, -26, -28, -24, -21, -22, -25, -26, -23, -22, -25, -28, -23, -17, -15, -15, -15, -15, -18, -22, -20, -9, -3, -7, -14, -16, -14, -7, 0, 4, 2, 0, 4, 7, 8, 7, 4, -3, -10, -7, 4, 7, 4, 1, 4, 6, 8, 12, 12, 11, 12, 13, 8, 6, 11, 14, 9, 5, 8, 14, 15, 13, 11, 11, 11, 16, 23, 23, 16, 12, 16, 22, 23, 22, 23, 22, 20, 21, 28, 30, 23, 20, 24, 29, 24, 17, 17, 21, 24, 24, 22, 19, 21, 29, 31, 28, 28, 32, 34, 30, 29, 30, 29, 28, 28, 29, 31, 36, 39, 35, 30, 32, 36, 32, 29, 32, 39, 40, 37, 36, 37, 36, 34, 31, 31, 29, 28, 35, 43, 43, 36, 32, 35, 35, 35, 40, 44, 39, 35, 36, 37, 37, 38, 40, 39, 35, 34, 34, 34, 34, 36, 37, 32, 28, 29, 34, 36, 35, 35, 36, 37, 37, 35, 31, 27, 28, 34, 36, 34, 34, 38, 37, 30, 27, 30, 31, 27, 27, 31, 35, 34, 31, 29, 28, 30, 32, 28, 22, 21, 23, 23, 24, 30, 31, 23, 15, 16, 21, 22, 22, 23, 23, 22, 21, 16, 12, 13, 19, 22, 23, 24, 28, 30, 25, 20, 17, 21, 28, 30, 27, 21, 21, 28, 35, 32, 24, 19, 20, 24, 25, 21, 17, 19, 22, 24, 24, 23, 22, 20, 19, 17, 17, 17, 14, 12, 14, 20, 23, 20, 14, 13, 15, 15, 14, 17, 22, 20, 13, 13, 17, 19, 13, 7, 9, 14, 13, 9, 11, 16, 21, 21, 16, 8, 5, 9, 15, 13, 7, 9, 15, 16, 12, 11, 12, 9, 8, 9, 8, 2, 0, 0, 0, -2, -2, -2, -3, -3, 0, 1, 0, -5, -6, -6, -6, -6, -5, -6, -7, -7, -6, -7, -10, -14, -13, -10, -12, -15, -16, -14, -12, -12, -15, -18, -17, -13, -13, -18, -23, -23, -22, -22, -20, -14, -14, -24, -33, -31, -23, -20, -24, -26, -25, -25, -29, -31, -32, -36, -38, -35, -29, -30, -36, -39, -37, -35, -35, -35, -32, -32, -36, -43, -46, -47, -46, -46, -46, -44, -41, -40, -44, -50, -53, -52, -47, -44, -45, -48, -52, -53, -50, -47, -48, -52, -54, -53, -51, -51, -52, -50, -47, -50, -54, -56, -55, -54, -53, -52, -52, -54, -53, -46, -40, -40, -45, -47, -45, -40, -38, -38, -39, -38, -36, -32, -31, -35, -39, -39, -37, -33, -31, -30, -30, -30, -30, -31, -35, -36, -32, -29, -31, -36, -37, -35, -31, -29, -28, -29, -30, -28, -23, -21, -22, -24, -25, -24, -22, -22, -25, -29, -26, -22, -21, -22, -23, -20, -18, -22, -29, -30, -29, -26, -28, -28, -24, -22, -22, -22, -20, -17, -18, -21, -18, -15, -16, -22, -26, -25, -22, -18, -17, -17, -18, -22, -23, -21, -17, -17, -17, -14, -9, -9, -13, -16, -15, -10, -6, -7, -14, -17, -13, -7, -5, -7, -10, -13, -13, -9, -3, -1, -2, -6, -6, -2, -1, -2, -3, -3, -2, 0, 5, 5, -1, -8, -7, 0, 2, 1, 0, 1, 4, 2, 0, -3, -5, -6, -6, -7, -7, -5, -1, 0, -2, -5, -5, -3, -3, -2, 0, 0, 0, 0, 0, 0, -1, -2, -3, -7, -6, 0, 5, 7, 6, 2, 0, 0, 5, 7, 8, 8, 8, 6, 5, 6, 7, 1, -2, 1, 9, 12, 12, 12, 12, 11, 14, 15, 11, 5, 6, 11, 11, 9, 11, 12, 9, 5, 7, 12, 11, 8, 11, 16, 14, 8, 8, 15, 16, 12, 11, 14, 15, 16, 20, 20, 13, 5, 6, 11, 14, 17, 21, 21, 17, 13, 13, 16, 19, 17, 15, 17, 24, 28, 25, 21, 20, 21, 19, 16, 19, 24, 22, 12, 6, 12, 21, 20, 13, 14, 21, 24, 20, 16, 19, 24, 27, 23, 21, 20, 20, 20, 21, 22, 22, 22, 21, 21, 20, 20, 19, 19, 19, 20, 17, 17, 21, 25, 24, 20, 17, 17, 20, 21, 23, 21, 16, 15, 19, 22, 21, 19, 19, 21, 21, 20, 21, 25, 27, 22, 20, 23, 29, 28, 20, 16, 21, 25, 23, 22, 27, 30, 29, 28, 27, 24, 20, 16, 16, 20, 23, 23, 22, 23, 24, 23, 21, 23, 28, 27, 21, 20, 25, 27, 16, 6, 7, 13, 15, 11, 8, 8, 6, 2, 5, 11, 11, 4, -1, -1, 0, -1, -3, -5, -5, -5, -5, -5, -7, -12, -13, -9, -6, -6, -10, -15, -17, -15, -12, -13, -21, -23, -15, -10, -15, -21, -18, -14, -16, -20, -18, -17, -22, -31, -31, -24, -20, -22, -24, -22, -22, -22, -21, -20, -21, -23, -22, -17, -17, -20, -21, -20, -20, -22, -24, -22, -18, -17, -18, -18, -18, -20, -21, -22, -23, -21, -18, -20, -23, -22, -20, -23, -30, -28, -21, -21, -22, -18, -17, -28, -37, -30, -18, -17, -25, -28, -26, -26, -30, -31, -29, -26, -29, -32, -32, -26, -22, -23, -26, -25, -23, -23, -28, -30, -28, -24, -25, -28, -29, -26, -24, -21, -18, -17, -17, -18, -21, -23, -23, -20, -16, -15, -15, -16, -22, -26, -25, -21, -18, -20, -18, -14, -14, -18, -21, -18, -16, -15, -14, -12, -12, -13, -13, -12, -12, -13, -14, -13, -12, -14, -16, -15, -13, -13, -16, -20, -18, -15, -13, -16, -22, -21, -14, -9, -8, -8, -10, -14, -15, -13, -10, -12, -12, -8, -6, -8, -8, -5, -2, -3, -7, -9, -7, -3, -1, -2, -8, -10, -7, 0, 0, -3, -6, -5, -3, -5, -3, -1, -3, -6, -1, 4, 1, -1, 0, 1, 0, -3, -1, 4, 4, 2, 5, 9, 9, 4, -1, -1, 1, 2, 1, 0, 0, -1, -2, -2, 0, 4, 5, 2, 0, 4, 8, 7, 6, 7, 8, 6, 5, 8, 7, 0, -7, -7, -2, 4, 8, 7, 0, -2, 0, 5, 6, 5, 5, 4, 0, 0, 0, 2, 2, 0, 0, 0, 1, 2, 2, 2, 0, 0, 1, 5, 6, 4, 4, 4, 1, -1, 0, 5, 7, 2, 0, 1, 6, 6, 4, 2, 2, 2, 1, 0, 0, 0, 0, 2, 5, 5, 2, 1, 2, 5, 2, 0, 0, 5, 7, 6, 2, 2, 5, 7, 6, 2, 1, 4, 8, 12, 13, 13, 14, 14, 13, 13, 15, 15, 13, 9, 8, 9, 9, 9, 9, 12, 14, 13, 11, 9, 11, 15, 17, 19, 16, 14, 9, 6, 6, 7, 8, 8, 11, 14, 13, 8, 8, 13, 16, 13, 8, 7, 8, 9, 12, 12, 11, 13, 17, 21, 20, 15, 11, 11, 15, 20, 21, 16, 12, 9, 11, 12, 14, 14, 12, 9, 11, 13, 13, 9, 6, 4, 5, 6, 7, 7, 7, 11, 13, 12, 8, 5, 5, 6, 6, 5, 4, 4, 6, 7, 4, 0, 1, 5, 5, 1, 0, 1, 2, 1, 0, 0, 0, -1, -2, -3, -5, -7, -9, -8, -6, -6, -8, -8, -6, -6, -10, -16, -18, -17, -15, -14, -12, -8, -9, -15, -18, -14, -8, -8, -14, -21, -21, -17, -15, -18, -23, -22, -20, -21, -23, -21, -14, -13, -17, -21, -20, -17, -17, -20, -22, -26, -29, -26, -22, -22, -26, -26, -21, -17, -22, -28, -26, -22, -20, -22, -24, -24, -21, -17, -18, -22, -23, -22, -20, -21, -22, -22, -20, -18, -21, -22, -21, -16, -14, -15, -20, -20, -14, -12, -16, -22, -21, -15, -15, -22, -23, -16, -12, -14, -17, -20, -20, -16, -12, -12, -17, -22, -20, -16, -16, -18, -20, -17, -15, -15, -16, -16, -15, -14, -14, -16, -18, -20, -20, -18, -20, -23, -22, -18, -16, -18, -22, -22, -18, -17, -18, -20, -16, -14, -17, -20, -17, -16, -20, -25, -24, -20, -20, -24, -26, -23, -18, -18, -18, -16, -16, -20, -23, -22, -21, -23, -25, -28, -31, -32, -31, -29, -29, -28, -23, -22, -25, -26, -24, -25, -29, -30, -26, -23, -22, -23, -26, -30, -30, -25, -21, -22, -23, -25, -26, -26, -24, -20, -18, -18, -21, -21, -23, -24, -24, -21, -16, -14, -18, -24, -24, -18, -13, -12, -15, -16, -13, -10, -12, -14, -12, -7, -8, -13, -15, -12, -7, -7, -10, -12, -10, -8, -8, -10, -12, -9, -6, -6, -12, -14, -8, -2, -3, -8, -7, -2, -1, -5, -6, -3, -3, -6, -7, -3, -1, -2, -3, -1, 0, -2, -1, 1, 4, 4, 4, 5, 5, 5, 1, -1, 0, 5, 12, 11, 6, 5, 7, 11, 13, 14, 12, 8, 9, 12, 12, 12, 12, 8, 5, 8, 16, 17, 12, 12, 20, 24, 20, 14, 13, 15, 17, 17, 15, 14, 16, 21, 21, 17, 16, 19, 23, 22, 17, 15, 19, 25, 29, 28, 23, 20, 19, 21, 25, 30, 29, 24, 21, 23, 27, 28, 27, 24, 24, 24, 25, 25, 24, 24, 27, 28, 27, 25, 25, 28, 30, 31, 32, 32, 29, 27, 28, 31, 30, 27, 27, 30, 32, 30, 28, 25, 24, 22, 21, 22, 24, 24, 23, 24, 28, 28, 25, 23, 21, 20, 20, 20, 22, 24, 25, 23, 22, 24, 25, 21, 20, 24, 29, 24, 14, 12, 15, 19, 19, 17, 16, 15, 15, 17, 17, 15, 15, 19, 20, 15, 13, 15, 20, 21, 19, 17, 17, 16, 16, 17, 17, 16, 20, 23, 21, 16, 16, 19, 15, 8, 7, 13, 19, 17, 13, 8, 7, 9, 11, 9, 9, 11, 12, 12, 11, 11, 13, 13, 11, 7, 7, 8, 8, 7, 5, 5, 6, 8, 7, 6, 6, 8, 7, 4, 4, 6, 5, 1, 4, 7, 4, 0, 1, 6, 7, 6, 5, 2, 0, 2, 6, 4, -1, 0, 4, 4, 0, 0, 1, 2, 5, 4, 0, -2, 0, 2, 0, -1, 0, 1, 1, 0, 0, 0, -1, 0, 1, 1, 0, -2, -2, 0, 1, 4, 0, -5, -5, -1, 0, -1, -1, 1, 4, 2, 0, 0, 0, 0, -3, -9, -10, -6, -5, -6, -5, -1, -1, -5, -7, -7, -8, -9, -6, -5, -8, -13, -13, -7, -3, -3, -5, -6, -6, -5, -6, -8, -8, -7, -9, -13, -15, -14, -14, -12, -8, -8, -13, -14, -9, -8, -10, -13, -12, -9, -9, -10, -12, -13, -12, -9, -8, -9, -12, -12, -10, -9, -10, -16, -18, -14, -8, -12, -21, -23, -15, -10, -13, -16, -15, -10, -9, -10, -12, -8, -5, -5, -8, -13, -13, -9, -8, -12, -15, -13, -9, -12, -15, -13, -7, -6, -6, -5, -3, -3, -3, -3, -7, -12, -10, -8, -8, -9, -6, -2, -3, -9, -10, -6, 0, 1, -1, -3, -2, 1, 4, 2, 1, 1, 1, 0, -1, 0, 0, 0, -1, -1, 1, 1, -1, -3, -2, 0, 4, 6, 5, 1, 0, 0, 4, 2, 0, -2, -5, -3, -1, 0, -1, -3, -3, -2, -3, -6, -7, -7, -7, -7, -5, -2, -3, -7, -7, -2, -1, -2, -3, -2, -2, -2, -2, -3, -6, -6, -5, -5, -7, -8, -3, 0, 0, -2, -5, -3, -1, -2, -7, -9, -6, -2, -3, -5, -3, 0, 0, -1, -1, -1, -5, -9, -9, -5, 0, 0, -3, -5, -3, -1, -1, -2, -2, -3, -5, -3, 0, 5, 4, 0, -1, 1, 2, -1, -5, -2, 0, -2, -6, -3, 0, -1, -2, 0, 4, 2, 0, 1, 5, 4, 1, 1, 4, 4, 0, -1, 0, 4, 4, 0, -3, -2, 0, 2, 0, -2, -1, 0, 0, 0, 0, 1, -1, -3, 0, 1, 0, -1, 0, 1, 0, -2, 0, 1, 1, 0, -1, 0, 2, 6, 6, 4, 1, 0, 0, 0, 0, 2, 6, 5, 2, 2, 4, 2, 0, 0, 4, 4, 1, 0, 4, 6, 7, 6, 4, 4, 7, 12, 13, 9, 6, 7, 12, 13, 8, 0, -1, 2, 8, 8, 6, 5, 5, 5, 7, 11, 9, 7, 5, 6, 7, 8, 8, 5, 2, 5, 11, 12, 11, 9, 12, 13, 12, 8, 7, 8, 12, 16, 16, 14, 12, 8, 1, -1, 0, 6, 7, 7, 8, 11, 11, 9, 9, 9, 6, 2, 2, 6, 8, 8, 7, 8, 11, 13, 13, 13, 12, 9, 8, 8, 8, 7, 6, 4, 2, 2, 5, 6, 6, 4, 2, 5, 6, 2, -1, -2, 1, 4, 4, 2, 4, 5, 6, 7, 8, 5, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -3, -5, -1, 0, -3, -7, -6, -3, -3, -7, -9, -9, -8, -9, -12, -15, -15, -13, -12, -13, -13, -10, -9, -12, -12, -12, -13, -16, -17, -17, -15, -12, -9, -12, -16, -17, -12, -7, -10, -16, -20, -16, -14, -15, -20, -21, -20, -17, -17, -17, -14, -9, -8, -12, -16, -15, -10, -9, -13, -17, -21, -21, -17, -13, -13, -16, -15, -12, -10, -13, -16, -16, -15, -14, -14, -14, -14, -13, -10, -9, -10, -14, -13, -10, -9, -10, -10, -8, -8, -12, -13, -9, -6, -7, -9, -9, -6, -2, 0, -3, -6, -5, -2, -5, -10, -12, -6, -2, -3, -7, -9, -9, -7, -3, -5, -8, -10, -8, -3, -2, -5, -7, -8, -6, -6, -6, -6, -5, -3, -6, -7, -6, -3, -3, -8, -12, -12, -9, -7, -6, -6, -7, -8, -7, -5, -5, -2, 0, 0, -5, -5, -1, 0, -7, -12, -7, -2, -7, -13, -13, -9, -7, -6, -3, -2, -5, -7, -7, -5, -6, -9, -13, -15, -15, -15, -15, -15, -15, -13, -10, -12, -15, -14, -10, -12, -15, -16, -14, -9, -8, -9, -12, -15, -16, -14, -13, -13, -14, -15, -15, -12, -8, -7, -10, -13, -10, -9, -12, -14, -14, -10, -6, -6, -10, -14, -13, -7, -3, -6, -9, -9, -6, -5, -7, -8, -8, -6, -6, -7, -8, -7, -6, -5, -5, -7, -9, -9, -9, -9, -9, -9, -8, -9, -13, -14, -10, -6, -7, -9, -9, -9, -9, -9, -8, -7, -7, -9, -10, -9, -8, -7, -6, -6, -7, -8, -7, -5, -3, -3, -2, -2, -3, -3, -5, -6, -6, -2, 1, 1, -1, -3, -1, 2, 5, 4, 0, 0, 2, 2, 1, 1, 2, 0, -1, 2, 8, 7, 2, 6, 13, 15, 9, 5, 6, 9, 12, 12, 9, 8, 11, 14, 13, 9, 8, 14, 17, 14, 9, 8, 14, 19, 20, 17, 15, 13, 12, 13, 16, 19, 17, 14, 12, 14, 17, 19, 16, 15, 16, 20, 21, 19, 16, 17, 20, 21, 20, 17, 17, 19, 21, 23, 25, 22, 16, 15, 21, 27, 24, 17, 17, 22, 24, 21, 17, 16, 15, 13, 13, 16, 19, 17, 16, 17, 22, 24, 21, 16, 15, 15, 14, 14, 16, 20, 19, 14, 13, 15, 15, 11, 11, 17, 21, 13, 4, 4, 8, 13, 13, 13, 13, 12, 11, 12, 13, 12, 9, 8, 7, 6, 5, 7, 11, 13, 12, 9, 8, 7, 7, 7, 5, 4, 6, 7, 5, 2, 4, 6, 5, 0, 0, 4, 6, 2, -2, -3, -1, 0, 0, -1, -1, 0, 1, 4, 2, 0, 0, 2, 2, -1, -2, 0, 1, 0, -1, 0, 1, 1, 0, -1, 0, 0, 0, -1, -2, -3, -5, -2, 0, -1, -6, -7, -2, 0, 0, -1, -2, -3, -2, 0, -1, -5, -5, 0, 0, -6, -6, -2, -2, -7, -6, -2, -5, -8, -5, -2, -5, -7, -5, -3, -7, -8, -6, -6, -8, -7, -6, -7, -8, -9, -10, -10, -6, -1, -2, -7, -8, -5, -3, -3, -3, -1, -1, -5, -9, -9, -6, -5, -6, -10, -12, -10, -8, -5, -3, -7, -13, -14, -12, -9, -10, -10, -8, -7, -9, -10, -8, -6, -6, -7, -8, -12, -15, -15, -15, -12, -8, -6, -8, -13, -13, -9, -7, -8, -8, -6, -6, -10, -15, -16, -13, -10, -9, -9, -10, -13, -14, -13, -13, -10, -7, -8, -13, -16, -12, -8, -10, -15, -16, -14, -10, -8, -9, -14, -15, -10, -7, -10, -15, -16, -16, -17, -15, -12, -13, -15, -15, -15, -17, -18, -17, -17, -16, -13, -13, -18, -21, -16, -12, -14, -17, -17, -18, -22, -23, -20, -16, -14, -12, -13, -16, -17, -13, -12, -16, -18, -16, -14, -13, -13, -13, -14, -14, -10, -12, -15, -16, -14, -12, -12, -13, -14, -16, -16, -14, -13, -13, -14, -13, -12, -10, -10, -13, -15, -16, -15, -14, -15, -16, -13, -8, -8, -12, -14, -14, -12, -10, -10, -10, -10, -10, -10, -13, -15, -17, -14, -8, -6, -9, -14, -13, -7, -5, -6, -9, -9, -8, -8, -8, -8, -7, -7, -6, -6, -6, -6, -3, -2, -3, -7, -8, -6, -5, -5, -5, -3, -3, -5, -5, -5, -7, -7, -3, -2, -3, -5, -5, -6, -8, -8, -5, -2, -3, -6, -6, -3, -3, -5, -3, -2, -2, -2, -1, 0, 0, -1, -1, -1, -1, -1, 0, 2, 1, -2, -3, 0, 1, 0, 0, 4, 7, 8, 8, 7, 4, 4, 7, 8, 2, 0, 1, 5, 6, 6, 5, 5, 5, 7, 7, 5, 4, 5, 6, 5, 2, 5, 8, 11, 9, 5, 2, 5, 8, 8, 5, 5, 6, 6, 5, 6, 9, 11, 7, 4, 7, 8, 6, 5, 9, 14, 11, 6, 7, 11, 11, 8, 7, 7, 6, 7, 7, 6, 4, 4, 5, 7, 7, 8, 7, 6, 7, 8, 7, 5, 2, 4, 5, 4, 2, 4, 4, 2, 0, 0, 1, 0, 0, 4, 7, 8, 6, 4, 4, 4, 4, 4, 4, 4, 4, 5, 4, 0, -1, 0, 5, 5, 2, 1, 2, 4, 4, 1, 0, 0, 0, 4, 5, 2, 1, 4, 6, 4, -1, -2, 0, 4, 5, 2, 0, -1, 0, 2, 2, 0, 0, 1, 1, 0, 1, 4, 4, 0, -2, -2, -1, 0, 0, -1, -1, -1, 0, 0, 0, 2, 2, 2, 2, 0, -2, -3, 0, 2, -2, -7, -5, 0, 0, -2, -5, -6, -6, -1, 2, 2, 0, -2, -3, -3, 0, 2, 0, -3, -5, 0, 1, 0, -2, -2, -1, -1, -1, 1, 4, 1, -1, -1, 0, 0, 0, 1, 2, 0, -1, -2, -2, -6, -8, -6, -2, -1, -6, -8, -7, -5, -2, -2, -2, -3, -3, -3, -3, -5, -5, -3, -2, -3, -6, -7, -7, -5, -3, -6, -9, -8, -5, -1, -2, -2, -1, -2, -5, -5, -2, -2, -3, -2, 2, 4, 0, -5, -3, 0, 0, -1, -1, 0, 0, 0, 0, 0, -3, -7, -5, 1, 6, 4, -1, -3, -1, 0, 0, 1, 0, -1, -1, 2, 7, 5, 0, -2, 0, -1, -5, -2, 4, 8, 8, 5, 1, 0, 6, 11, 8, 2, 1, 5, 6, 4, 5, 7, 6, 0, -2, 0, 2, 0, 0, 2, 9, 9, 6, 1, 0, 0, 2, 4, 2, 0, 1, 4, 2, 0, 0, 1, 0, -2, -2, 0, 0, 0, 0, 0, -1, -1, 1, 2, 0, -6, -7, -5, -1, 0, -1, -3, -8, -9, -7, -6, -7, -9, -8, -6, -8, -10, -9, -6, -5, -8, -13, -15, -15, -16, -16, -16, -16, -17, -16, -13, -10, -13, -15, -16, -14, -12, -12, -14, -17, -18, -16, -12, -12, -15, -18, -17, -16, -16, -16, -14, -13, -13, -13, -15, -18, -20, -17, -14, -14, -17, -20, -18, -15, -14, -14, -15, -16, -15, -12, -10, -12, -15, -14, -9, -6, -8, -13, -14, -13, -10, -9, -8, -7, -8, -12, -15, -15, -13, -12, -13, -13, -10, -8, -9, -12, -14, -15, -14, -9, -6, -6, -9, -14, -17, -16, -14, -12, -12, -13, -12, -12, -13, -13, -12, -12, -12, -9, -5, -2, -6, -12, -13, -8, -5, -6, -8, -12, -13, -10, -6, -2, -5, -9, -12, -9, -6, -6, -6, -6, -7, -9, -10, -9, -8, -10, -12, -7, -2, -1, -5, -8, -8, -6, -2, -1, -2, -2, -2, -3, -5, -7, -8, -9, -10, -10, -9, -8, -5, -1, -2, -7, -10, -8, -6, -7, -8, -7, -2, -3, -7, -8, -8, -10, -14, -14, -12, -10, -9, -3, -1, -5, -10, -9, -3, -1, -2, -1, 0, -1, -7, -7, -2, -3, -10, -12, -7, -3, -2, 0, 0, -6, -6, 1, 5, -1, -7, -3, 0, 0, -2, -2, -1, -1, 0, 1, 0, -1, -2, -1, -1, -5, -5, 0, 1, -2, -5, -2, 0, 1, 5, 6, 0, -6, -6, -2, -1, -2, 0, 5, 5, 1, 0, 2, 5, 2, 0, -1, 4, 8, 8, 5, 5, 7, 5, 1, 2, 8, 9, 2, -3, 0, 6, 6, 1, 0, 6, 7, 5, 2, 5, 7, 8, 8, 7, 5, 2, 2, 5, 7, 6, 4, 4, 6, 7, 5, 1, 1, 4, 4, 0, 0, 2, 6, 7, 4, 1, 2, 4, 6, 8, 8, 5, 2, 6, 9, 7, 2, 2, 6, 5, 2, 2, 7, 11, 8, 4, 6, 12, 12, 6, 4, 6, 8, 5, 4, 7, 11, 9, 7, 8, 9, 8, 6, 6, 8, 9, 9, 8, 11, 14, 14, 11, 9, 15, 17, 13, 11, 19, 23, 16, 6, 8, 16, 20, 15, 13, 15, 15, 13, 14, 19, 21, 15, 12, 13, 16, 16, 15, 15, 14, 13, 12, 15, 17, 14, 9, 11, 14, 16, 15, 12, 9, 8, 12, 13, 8, 5, 8, 14, 12, 7, 8, 12, 11, 6, 4, 6, 6, 2, 1, 2, 4, 2, 2, 2, 1, 0, 0, 2, 2, 0, 1, 5, 5, 2, 1, 5, 5, 0, -1, 0, 2, 4, 4, 4, 5, 4, 4, 4, 4, 4, 6, 7, 5, 4, 6, 6, 1, 0, 5, 7, 5, 6, 9, 6, -1, -1, 7, 11, 7, 5, 5, 5, 4, 4, 5, 5, 4, 0, -2, 0, 4, 5, 2, 2, 5, 6, 2, 2, 5, 6, 5, 1, 0, 0, 1, 2, 5, 6, 7, 7, 5, 2, 2, 5, 7, 7, 7, 7, 4, 0, 0, 1, 2, 0, 0, 4, 5, 1, -1, 0, 2, 1, 0, 0, 2, 4, 2, 2, 4, 1, -1, 0, 1, 0, -1, -1, 2, 5, 0, -5, -7, -2, 1, 0, -8, -12, -8, -1, 0, 0, -2, -5, -8, -8, -5, -3, -5, -6, -5, -5, -5, -3, -1, 0, -3, -6, -3, 0, 1, 0, -2, -6, -6, -2, 0, -1, -6, -6, -2, -2, -2, -2, -5, -8, -7, -3, -2, -6, -7, -3, -3, -7, -8, -3, -1, -3, -5, -1, 1, -2, -8, -7, -2, -2, -6, -7, -7, -8, -8, -7, -7, -7, -7, -7, -8, -8, -5, -3, -5, -5, -3, -5, -5, -3, -2, -7, -12, -13, -7, -2, 0, 0, -2, -6, -6, -5, -3, -2, -2, -2, -6, -8, -6, -2, -1, -3, -6, -5, -3, -3, -3, -3, -3, -5, -5, -3, -3, -5, -5, -3, -3, -7, -9, -8, -3, -2, -6, -8, -5, -2, -2, -3, -5, -5, -7, -8, -8, -8, -9, -9, -8, -6, -6, -8, -9, -9, -8, -10, -12, -10, -9, -10, -13, -15, -14, -12, -14, -17, -21, -20, -16, -13, -12, -10, -12, -13, -14, -12, -10, -12, -14, -15, -16, -17, -18, -17, -17, -17, -15, -13, -14, -17, -18, -15, -13, -13, -13, -14, -16, -21, -22, -20, -18, -18, -18, -18, -21, -22, -20, -14, -12, -14, -18, -22, -22, -18, -15, -15, -18, -21, -16, -9, -9, -15, -21, -21, -17, -15, -15, -16, -15, -14, -15, -18, -18, -15, -12, -13, -15, -15, -13, -9, -10, -15, -17, -16, -14, -13, -13, -13, -10, -9, -9, -10, -12, -13, -14, -14, -13, -12, -9, -9, -10, -12, -10, -9, -8, -9, -10, -8, -6, -5, -6, -8, -7, -3, 0, -1, -5, -8, -8, -6, -5, -6, -8, -7, -1, 0, -2, -5, -5, -5, -7, -6, -2, 0, -2, -7, -8, -5, -1, 0, 0, -2, -5, -6, -5, -3, -3, -6, -8, -9, -8, -6, -5, -5, -8, -12, -12, -6, -1, -1, -3, -6, -6, -3, -2, -3, -7, -8, -5, 0, -1, -6, -8, -6, -3, -2, -5, -7, -8, -7, -5, -5, -6, -7, -5, -2, -3, -5, -3, 0, -1, -5, -6, -3, -2, -5, -7, -7, -3, -1, -2, -3, -5, -3, -1, -1, -2, -3, -2, 0, 0, -3, -6, -5, -1, 0, -1, -7, -7, -3, 0, -1, -3, -2, -1, -2, -5, -3, -1, -2, -6, -6, -2, -1, -2, -6, -6, -5, -5, -6, -5, -3, -5, -7, -6, -6, -7, -8, -6, -3, -5, -9, -7, 0, 0, -7, -9, -6, -3, -6, -6, -5, -7, -8, -7, -6, -9, -10, -7, -3, -2, -1, 0, 0, -1, -2, 0, 1, -1, -3, -1, 0, 0, -3, -2, 0, 0, -3, -5, -1, 2, 1, -2, -3, -2, -2, -2, -2, -1, -2, -2, -2, 0, 0, -1, -2, -2, -1, -1, -3, -5, -3, 0, 0, -1, -2, 0, 1, 2, 1, 1, 2, 5, 8, 8, 6, 4, 7, 9, 8, 4, 5, 9, 12, 7, 5, 7, 7, 6, 5, 6, 6, 5, 4, 4, 4, 5, 6, 6, 5, 5, 6, 6, 6, 8, 9, 9, 7, 6, 7, 9, 9, 8, 8, 9, 8, 7, 7, 9, 12, 12, 11, 12, 12, 11, 8, 6, 6, 8, 11, 11, 7, 6, 12, 16, 14, 9, 9, 14, 15, 13, 11, 11, 9, 5, 5, 9, 13, 9, 6, 9, 15, 16, 13, 12, 14, 16, 15, 13, 12, 13, 15, 15, 13, 11, 12, 16, 19, 16, 11, 9, 14, 20, 21, 17, 14, 15, 19, 21, 21, 21, 21, 20, 17, 20, 23, 22, 19, 16, 19, 22, 22, 20, 20, 22, 23, 22, 21, 22, 23, 23, 24, 28, 29, 25, 22, 23, 30, 34, 30, 25, 27, 30, 31, 28, 25, 24, 24, 24, 24, 24, 24, 25, 28, 30, 30, 29, 27, 25, 23, 23, 24, 27, 28, 27, 22, 21, 23, 27, 24, 20, 22, 29, 29, 20, 14, 15, 20, 21, 21, 21, 20, 20, 21, 21, 19, 16, 16, 17, 17, 14, 13, 15, 19, 21, 20, 17, 14, 14, 15, 15, 13, 12, 13, 14, 12, 11, 12, 12, 9, 6, 7, 11, 12, 8, 2, 0, 1, 5, 6, 2, 2, 5, 7, 7, 5, 4, 6, 7, 5, 0, 0, 0, 2, 1, 0, 0, 2, 5, 2, 0, 0, 2, 2, 0, 0, -1, -1, -1, 0, 0, -2, -3, -2, 0, 0, 0, -2, -3, -2, 0, -2, -5, -3, -1, -3, -6, -3, -1, -2, -5, -5, -6, -8, -8, -5, -6, -9, -9, -6, -6, -8, -9, -9, -10, -12, -10, -9, -10, -12, -13, -13, -10, -7, -6, -9, -12, -9, -6, -7, -9, -9, -8, -8, -12, -14, -14, -12, -12, -12, -13, -13, -14, -14, -13, -13, -16, -18, -20, -20, -18, -17, -14, -14, -16, -18, -18, -17, -16, -17, -20, -23, -24, -23, -25, -28, -26, -20, -15, -20, -26, -28, -25, -24, -23, -22, -22, -24, -25, -26, -28, -28, -26, -25, -25, -26, -29, -30, -29, -25, -24, -29, -31, -31, -29, -28, -26, -26, -29, -32, -31, -26, -25, -28, -29, -26, -23, -23, -26, -30, -30, -28, -26, -29, -31, -31, -30, -30, -30, -30, -30, -30, -28, -24, -24, -25, -26, -25, -24, -23, -23, -25, -26, -25, -25, -26, -26, -24, -23, -22, -24, -24, -24, -23, -23, -24, -24, -24, -22, -21, -21, -23, -24, -23, -22, -22, -24, -24, -23, -21, -20, -21, -23, -23, -21, -20, -21, -21, -20, -18, -18, -17, -17, -21, -25, -26, -24, -22, -23, -23, -20, -17, -20, -22, -23, -21, -18, -18, -17, -15, -14, -15, -16, -17, -17, -15, -10, -7, -9, -14, -15, -13, -8, -7, -9, -12, -13, -12, -12, -13, -12, -8, -7, -9, -13, -13, -7, -3, -5, -7, -9, -12, -9, -7, -5, -6, -8, -8, -8, -7, -7, -6, -8, -9, -7, -3, -5, -6, -5, -3, -5, -5, -3, -6, -9, -8, -5, -7, -9, -7, -2, -2, -5, -5, -2, -3, -5, -5, -3, -2, -2, -3, -5, -6, -6, -2, 0, 0, 0, 1, 4, 4, 2, 0, -2, -6, -2, 4, 4, -1, -6, -5, 0, 1, 2, 2, 1, 1, 0, -1, 0, 1, 1, -1, -5, -6, -3, -1, 0, -2, -5, -3, -1, 0, 0, -1, 0, 0, -1, -1, 0, 1, -1, -5, -2, 0, 0, -3, -5, 0, 2, 1, -2, -3, -1, 0, -2, -7, -8, -5, -1, -2, -3, -2, 0, 0, -5, -5, -2, 0, -1, -3, -3, -3, -3, -1, 1, 4, 4, 0, -2, -3, -1, 1, 1, 0, 0, 0, 2, 4, 4, 2, -1, -3, -1, 2, 2, 0, -1, 1, 5, 5, 2, 0, 0, 2, 4, 2, 1, 2, 6, 6, 4, 4, 2, 0, 0, 4, 7, 5, 2, 4, 7, 7, 4, 2, 6, 11, 12, 7, 2, 2, 6, 8, 6, 6, 8, 11, 8, 6, 7, 12, 11, 7, 6, 9, 12, 11, 9, 11, 12, 12, 12, 13, 12, 8, 6, 8, 11, 11, 11, 13, 13, 11, 9, 12, 13, 12, 11, 12, 12, 11, 9, 9, 11, 13, 14, 14, 14, 15, 16, 15, 13, 12, 15, 19, 17, 13, 14, 17, 17, 15, 14, 13, 12, 12, 13, 13, 9, 7, 9, 13, 13, 11, 8, 7, 6, 6, 8, 9, 8, 4, 4, 7, 8, 8, 7, 6, 5, 5, 6, 6, 4, 2, 1, 0, 0, 2, 2, -1, -3, -2, -1, -2, -2, 0, 5, 4, 0, -1, 0, 0, 0, -1, -2, -1, 1, 2, 1, 0, -2, -2, -1, -1, -3, -6, -6, -5, -6, -7, -8, -9, -9, -6, -2, -2, -6, -8, -7, -7, -7, -7, -7, -7, -8, -7, -5, -3, -7, -9, -7, -5, -6, -9, -8, -5, -3, -3, -6, -8, -9, -8, -7, -8, -9, -9, -9, -10, -9, -5, -3, -7, -10, -9, -6, -6, -8, -9, -7, -6, -6, -6, -5, -5, -5, -2, 0, 0, -2, -2, -2, -2, -3, -5, -5, -7, -7, -6, -5, -6, -9, -10, -7, -5, -3, -2, -3, -6, -9, -7, -2, 0, -2, -5, -6, -6, -6, -3, -2, -2, -3, -5, -2, -1, 0, 0, 0, 0, -1, -2, -2, -1, 0, 2, 1, -1, 0, 1, 2, 2, 2, 4, 4, 4, 6, 7, 5, 6, 9, 11, 9, 7, 6, 6, 6, 8, 9, 7, 6, 7, 8, 7, 4, 5, 7, 8, 7, 7, 8, 8, 9, 13, 15, 12, 6, 7, 13, 14, 12, 9, 9, 8, 6, 5, 4, 4, 5, 6, 7, 7, 8, 8, 8, 8, 6, 2, 0, 2, 7, 7, 7, 9, 11, 7, 4, 6, 9, 9, 6, 4, 4, 5, 5, 5, 6, 7, 7, 6, 4, 1, 2, 5, 6, 5, 5, 7, 7, 5, 2, 1, 1, 2, 7, 7, 0, -2, 0, 2, 1, 0, 2, 4, 0, -1, 4, 8, 5, 0, 0, 5, 7, 4, 1, 2, 4, 2, 0, 0, 0, 0, 1, 1, 2, 5, 5, 5, 5, 5, 2, 0, -1, 0, 1, -1, -3, 0, 4, 4, -2, -3, 1, 2, -2, -2, 1, 4, 0, -2, -1, 0, -1, -1, -1, -3, -1, 4, 7, 5, 2, 1, 0, -1, -1, 0, -1, -1, 0, 0, -1, -3, -6, -6, -5, -1, 1, 1, 0, 0, 0, 0, 2, 0, -5, -7, -5, -2, -3, -3, -2, -3, -6, -5, -1, -2, -5, -3, 0, 1, -1, -3, -2, -1, -1, -2, -1, -1, -2, -2, 0, 0, -5, -9, -8, -2, 0, -1, -2, -1, -1, -6, -10, -9, -3, -2, -6, -7, -2, 2, 0, -5, -8, -8, -6, -6, -7, -7, -6, -6, -6, -6, -3, -1, -1, -2, -2, -2, -3, -6, -6, -3, -2, -3, -5, -6, -6, -7, -7, -6, -6, -7, -10, -13, -10, -8, -7, -7, -6, -5, -6, -6, -5, -2, -5, -10, -12, -10, -9, -9, -8, -7, -7, -9, -12, -10, -7, -6, -7, -9, -10, -9, -8, -8, -10, -10, -9, -6, -6, -10, -16, -16, -12, -10, -12, -10, -8, -8, -12, -12, -9, -9, -13, -16, -16, -13, -9, -8, -12, -16, -15, -10, -7, -9, -14, -15, -13, -13, -15, -16, -17, -18, -20, -16, -14, -14, -14, -12, -10, -14, -15, -12, -9, -14, -18, -20, -17, -14, -13, -12, -12, -14, -14, -12, -9, -12, -15, -16, -15, -15, -17, -20, -20, -16, -13, -13, -17, -20, -16, -13, -13, -14, -14, -14, -15, -15, -12, -10, -12, -13, -9, -3, -1, -2, -2, 0, 0, -2, -3, -5, -5, -5, -2, -1, -1, -3, -5, -3, -1, -1, -2, -2, 0, 1, 2, 0, -1, -1, 1, 2, 0, 0, 1, 2, 1, 2, 8, 12, 7, 1, 1, 2, 4, 4, 4, 5, 4, 1, 2, 6, 8, 9, 9, 8, 7, 9, 15, 14, 6, 4, 11, 14, 11, 7, 6, 6, 6, 9, 12, 9, 6, 8, 12, 13, 12, 9, 7, 5, 6, 6, 5, 5, 7, 7, 4, 0, 0, 0, 2, 5, 5, 2, 2, 6, 7, 7, 7, 6, 4, 1, 2, 4, 2, 1, 2, 6, 7, 4, 2, 5, 7, 7, 5, 4, 5, 6, 6, 6, 5, 5, 6, 7, 6, 5, 5, 5, 5, 5, 5, 5, 2, 2, 4, 5, 6, 6, 6, 7, 7, 6, 2, 0, 0, 1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -2, -3, -2, -1, -1, -1, -2, -2, -2, -2, -1, 0, -1, -3, -6, -6, -5, -3, -3, -3, -3, -5, -5, -6, -7, -7, -2, 0, -2, -8, -8, -3, 0, -1, -6, -7, -5, -1, -3, -6, -7, -6, -7, -8, -6, -3, -5, -7, -3, 1, 0, -6, -10, -9, -6, -6, -6, -5, -5, -5, -5, -5, -5, -6, -3, -1, -3, -8, -7, -2, -1, -2, -5, -6, -7, -7, -5, -2, -3, -6, -8, -7, -5, -2, -3, -6, -7, -3, -1, -1, -6, -8, -7, -3, -1, -2, -5, -5, -3, 0, 2, 2, -2, -7, -7, 0, 2, 0, -6, -6, -1, 0, -2, -6, -6, -7, -9, -9, -5, -3, -6, -7, -3, 0, 0, -3, -7, -8, -7, -6, -6, -3, -3, -6, -8, -7, -5, -6, -10, -8, -2, -1, -8, -15, -14, -9, -8, -8, -8, -8, -9, -9, -7, -7, -9, -12, -10, -10, -12, -13, -9, -6, -6, -9, -10, -10, -10, -10, -12, -13, -13, -10, -9, -12, -13, -12, -10, -13, -15, -14, -10, -9, -12, -15, -15, -13, -10, -10, -12, -13, -12, -8, -6, -8, -9, -7, -5, -6, -10, -12, -8, -6, -8, -10, -8, -5, -5, -7, -8, -6, -5, -5, -5, -6, -8, -8, -5, -2, -3, -7, -8, -5, -2, -2, -2, -3, -5, -3, -2, -2, -5, -3, -1, -2, -5, -2, 0, 0, -2, -1, -1, -3, -5, 0, 0, -2, -3, 0, 0, -2, -2, -1, -2, -3, -2, -2, -3, -3, -2, -3, -2, 0, 5, 4, 0, 0, 1, 4, 4, 2, 4, 4, 2, 0, -1, 0, 2, 2, 0, -1, 0, 0, 2, 2, 1, 0, -1, -1, -1, 1, 4, 5, 4, 1, 2, 5, 4, 2, 1, 0, -3, -6, -6, -2, 1, 7, 7, 1, -3, -3, 0, 1, 1, 2, 5, 4, 0, -3, -5, -3, 0, 0, 0, 0, 0, -1, -2, 0, 2, 2, 0, -3, -3, 0, 0, 0, -2, -3, -2, 0, 2, 0, -2, -1, 2, 4, 0, -3, -3, -2, -3, -3, -3, -3, -5, -5, -2, -2, -3, -5, -3, 0, 0, -1, -5, -5, 0, 0, -1, -2, -1, -2, -5, -3, -1, 0, 0, -1, -3, -6, -5, -2, -3, -6, -5, -2, -1, -1, 0, -2, -5, -2, 1, 0, -5, -3, 0, 0, -1, -2, -2, -3, -5, -2, 0, -1, -2, -2, -2, -1, 0, -2, -6, -8, -7, -5, -5, -3, 0, 1, 0, -2, -3, -3, -2, -1, 0, 0, 2, 2, 0, -1, -2, -2, 1, 8, 9, 4, 0, 2, 8, 9, 5, 1, 1, 4, 4, 2, 2, 5, 7, 7, 5, 4, 6, 9, 9, 5, 2, 4, 6, 6, 7, 9, 9, 6, 4, 4, 6, 6, 6, 7, 9, 9, 8, 6, 6, 6, 7, 8, 11, 8, 6, 7, 8, 7, 6, 7, 9, 8, 7, 8, 9, 9, 7, 6, 6, 7, 7, 8, 8, 6, 5, 7, 12, 11, 8, 9, 13, 14, 15, 15, 11, 6, 7, 14, 14, 7, 2, 5, 9, 12, 12, 11, 9, 9, 12, 13, 9, 7, 8, 9, 7, 5, 6, 11, 13, 9, 6, 6, 7, 6, 5, 5, 6, 7, 6, 5, 5, 6, 5, 2, 2, 6, 6, 1, 0, 5, 8, 6, 1, 0, 2, 2, 1, 0, 0, 0, 2, 2, 1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, -1, -2, -3, -2, -1, -1, -2, -2, -1, 1, 2, 0, -3, -6, -5, 0, 0, -2, -3, -1, 0, -1, -3, -3, -2, -1, 0, -1, -2, -2, 0, 0, -2, -5, -5, -3, -2, 0, 0, -1, -1, 0, 0, -1, -3, -2, 0, 2, 0, -5, -6, -3, -1, -2, -5, -5, -3, -3, -3, -1, 0, -3, -7, -6, -3, -5, -5, -3, -2, -3, -5, -5, -2, 0, 0, 0, -1, -1, -3, -7, -6, -1, -1, -8, -10, -6, -2, -2, -5, -6, -6, -6, -3, 0, 0, -2, -6, -7, -6, 0, 1, -1, -6, -5, 0, 1, 0, -1, -1, 0, 0, 0, 0, 2, 2, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, -1, -3, -5, -2, 0, 0, -2, -5, -3, -1, 0, 0, 0, 0, 0, -2, -2, -1, 0, 0, 0, -1, -2, -2, -1, 0, 0, -3, -6, -2, 0, 1, 0, 0, 2, 1, 0, -1, 1, 2, 0, 1, 6, 8, 5, -1, -1, 2, 5, 1, 0, 1, 2, 2, 1, 0, -1, -3, 0, 7, 9, 4, -1, 0, 2, 4, 4, 2, 1, 0, 0, 2, 6, 4, -1, -2, 0, -1, -5, -2, 2, 7, 7, 4, 0, 0, 6, 11, 5, -1, -1, 2, 2, -1, -1, 1, 0, -5, -7, -2, -1, -5, -7, -3, 0, -1, -5, -5, -5, -5, -3, -1, -2, -5, -6, -6, -7, -7, -3, -2, -6, -8, -8, -7, -8, -9, -8, -7, -8, -9, -7, -3, -8, -14, -15, -10, -7, -6, -7, -10, -15, -16, -12, -9, -12, -14, -13, -13, -14, -15, -13, -10, -12, -15, -18, -18, -17, -16, -17, -20, -20, -17, -14, -10, -12, -15, -18, -17, -14, -9, -10, -15, -18, -17, -13, -9, -12, -16, -18, -17, -16, -15, -14, -14, -14, -14, -13, -14, -16, -17, -14, -12, -14, -17, -17, -14, -12, -12, -14, -15, -14, -12, -9, -12, -14, -14, -10, -8, -7, -9, -10, -12, -12, -10, -8, -7, -6, -8, -12, -14, -14, -12, -12, -13, -12, -8, -7, -8, -10, -13, -13, -10, -7, -6, -7, -10, -15, -16, -15, -13, -12, -13, -12, -9, -9, -12, -12, -9, -9, -10, -8, -5, -5, -8, -10, -9, -6, -3, -5, -7, -9, -10, -9, -5, -1, -2, -5, -8, -8, -6, -3, -2, -3, -6, -8, -7, -5, -6, -8, -8, -3, 0, 0, -1, -5, -5, -1, 1, 1, 0, 0, 0, 0, -3, -5, -6, -7, -7, -7, -7, -5, -1, 0, 0, -5, -6, -3, -2, -2, -2, 0, 2, 0, -3, -2, -1, -3, -8, -9, -7, -5, -2, 0, 2, 0, -5, -5, 0, 1, 0, 0, 4, 2, -2, -3, 0, 0, -5, -6, -2, 0, 1, 2, 0, -5, -1, 7, 7, 0, -5, 0, 4, 1, -1, -1, 0, 0, 0, 1, 1, 0, 0, 1, 0, -2, -1, 1, 1, -1, -2, 0, 2, 4, 6, 7, 1, -5, -2, 0, 0, 0, 1, 5, 4, 2, 2, 5, 6, 4, 0, 0, 6, 9, 7, 4, 5, 7, 5, 1, 4, 9, 8, 0, -3, 0, 7, 6, 1, 1, 5, 6, 4, 2, 2, 5, 6, 7, 6, 2, 0, 0, 5, 7, 4, 0, 2, 6, 6, 1, 0, 0, 2, 1, -1, -2, 1, 5, 4, 0, 0, 1, 4, 5, 6, 5, 1, 0, 5, 6, 4, 0, 2, 5, 2, 0, 0, 5, 7, 4, 1, 5, 8, 6, 1, 1, 5, 4, 0, 0, 4, 6, 4, 2, 5, 5, 2, 1, 2, 4, 4, 1, 1, 5, 7, 5, 1, 2, 7, 7, 1, 2, 11, 13, 5, 0, 2, 11, 9, 5, 4, 6, 5, 1, 5, 11, 11, 4, 0, 4, 6, 5, 4, 5, 7, 5, 5, 8, 9, 6, 1, 2, 7, 9, 8, 5, 2, 2, 5, 5, 0, 0, 4, 7, 4, 1, 5, 7, 5, 1, 1, 2, 1, -1, 0, 0, 0, -2, 0, 0, -1, -5, -3, -1, -2, -3, -1, 0, -1, -3, -1, 1, 0, -3, -5, -1, 0, -2, -2, 0, 0, 0, -1, 0, 0, 0, 2, 2, 0, -1, 0, 0, -3, -2, 1, 0, 0, 2, 4, -2, -9, -3, 4, 2, -1, 0, 1, 0, -1, 0, 0, -1, -3, -6, -7, -3, 0, -1, -2, 0, 1, 0, -3, -1, 1, 1, -1, -2, 0, 0, -1, 0, 1, 4, 4, 2, 1, 0, 0, 0, 2, 5, 4, 2, 0, 0, 0, 1, 1, 0, 0, 1, 2, 0, -1, 0, 1, 0, -1, 0, 2, 2, 0, 0, 1, 0, 0, 0, 0, -1, -3, -1, 2, 2, 0, -5, -6, -1, 2, 0, -7, -10, -5, 0, 0, -1, -2, -3, -5, -5, -2, -2, -2, -2, -2, -3, -3, 0, 1, 0, -3, -5, 0, 2, 2, 0, -1, -3, -6, -2, 1, 0, -2, -3, -1, 0, 0, 0, -2, -5, -3, 0, -1, -5, -3, 0, 0, -3, -3, 0, 0, -2, -2, 1, 2, -1, -5, -1, 0, -1, -3, -2, -2, -5, -5, -2, -3, -6, -7, -6, -6, -6, -3, -2, -3, -3, -3, -3, -2, -1, -1, -6, -9, -9, -5, 0, 1, 0, -2, -5, -3, -1, 0, 0, 0, 0, -2, -5, -2, 1, 1, -1, -2, -1, 0, -1, -1, 0, -1, -2, -1, 0, 0, -1, -2, 0, 0, -2, -5, -1, 2, 1, -2, -3, -1, 1, 1, 0, 0, 0, 0, -1, -1, 0, 0, -1, 0, 1, 2, 0, 0, 0, 0, 0, -1, -1, 0, -1, -2, -3, -3, -3, -5, -7, -9, -8, -5, -2, -2, -3, -5, -6, -6, -5, -5, -6, -8, -8, -8, -9, -9, -9, -9, -9, -7, -5, -7, -12, -10, -7, -6, -8, -9, -9, -10, -14, -15, -14, -10, -10, -13, -14, -14, -13, -12, -9, -8, -9, -13, -16, -16, -13, -9, -10, -15, -17, -13, -7, -8, -14, -18, -16, -13, -13, -14, -13, -12, -14, -18, -21, -20, -16, -14, -16, -17, -17, -15, -13, -14, -17, -21, -21, -17, -14, -14, -16, -17, -15, -13, -13, -16, -18, -20, -20, -18, -15, -14, -16, -18, -20, -17, -16, -15, -17, -17, -16, -15, -15, -16, -16, -15, -12, -8, -9, -14, -18, -17, -14, -15, -17, -17, -14, -12, -14, -16, -16, -15, -15, -15, -14, -12, -10, -13, -16, -16, -14, -14, -13, -9, -8, -13, -16, -13, -6, -6, -12, -14, -12, -8, -8, -9, -10, -13, -14, -13, -9, -6, -5, -7, -8, -7, -3, -1, -2, -7, -8, -5, -2, -5, -9, -9, -5, -2, -3, -6, -9, -9, -7, -3, -3, -8, -13, -12, -8, -8, -10, -9, -5, -2, -5, -7, -7, -6, -8, -10, -10, -8, -6, -6, -7, -8, -6, -5, -3, -3, -3, -3, -1, -1, -3, -7, -6, -1, 0, -5, -7, -3, 0, -1, -3, 0, 1, 0, -2, -3, 0, 2, 2, -1, -1, 2, 4, 1, 0, 5, 6, 0, -1, 2, 5, 0, -2, 2, 8, 6, 1, 1, 5, 6, 4, 2, 6, 7, 5, 1, 1, 4, 5, 4, 4, 5, 6, 6, 4, 1, 2, 5, 5, 4, 2, 4, 6, 6, 7, 7, 7, 6, 5, 6, 8, 8, 7, 8, 11, 9, 6, 5, 9, 12, 9, 6, 8, 12, 11, 7, 6, 8, 11, 11, 11, 12, 12, 12, 12, 12, 11, 8, 8, 9, 8, 6, 6, 9, 12, 11, 5, 4, 7, 13, 12, 7, 4, 6, 11, 14, 14, 12, 8, 6, 8, 14, 15, 13, 9, 11, 13, 14, 13, 13, 14, 13, 9, 11, 15, 19, 16, 13, 9, 11, 15, 17, 14, 11, 9, 12, 11, 9, 11, 9, 6, 5, 11, 12, 7, 6, 12, 14, 9, 6, 8, 12, 9, 7, 9, 13, 9, 5, 6, 11, 11, 7, 7, 7, 6, 5, 6, 6, 5, 6, 7, 5, 4, 7, 9, 8, 7, 8, 8, 6, 7, 9, 7, 1, 0, 4, 8, 9, 11, 8, 5, 2, 4, 7, 8, 8, 7, 5, 4, 4, 6, 7, 6, 2, 2, 4, 5, 5, 5, 5, 6, 6, 8, 8, 6, 2, 4, 6, 5, 1, 1, 6, 8, 4, 0, 1, 5, 5, 2, 1, 1, 1, 0, -1, 0, 0, 0, 0, 1, 2, 1, 0, 0, 0, 0, -1, -2, -1, 0, -1, -3, -3, -1, 0, -2, -6, -6, -3, 0, 0, -2, -2, -2, -2, -1, 0, 0, -2, -5, -5, -5, -5, -5, -5, -5, -3, -1, -1, -5, -6, -3, -1, -2, -3, -5, -5, -6, -7, -7, -6, -6, -5, -5, -5, -8, -8, -5, -1, -2, -6, -8, -8, -7, -5, -2, -3, -7, -6, 0, 1, -2, -7, -9, -7, -3, -2, -3, -6, -6, -5, -5, -6, -5, -3, -3, -6, -7, -6, -2, -2, -6, -8, -8, -6, -5, -5, -5, -2, -2, -3, -5, -5, -5, -6, -7, -7, -6, -3, -3, -5, -7, -6, -2, -1, -3, -6, -5, -1, 0, -2, -5, -5, -1, 1, 0, -2, -5, -5, -2, -1, -1, -3, -5, -1, 0, -1, -3, -3, -2, -3, -5, -2, 0, -1, -6, -8, -6, -1, 0, 0, -2, -3, -5, -5, -3, -3, -6, -7, -9, -10, -8, -5, -3, -8, -12, -10, -6, -1, -1, -3, -6, -7, -5, -2, -2, -6, -8, -5, -1, -1, -5, -6, -6, -5, -3, -5, -7, -8, -7, -3, -2, -6, -8, -6, -2, -2, -6, -5, 0, 0, -2, -3, -1, 0, -1, -3, -3, -2, 0, 1, 0, -2, -1, 1, 1, 0, -2, 0, 4, 2, 0, -3, -2, 0, 2, 0, -2, -3, -1, 2, 2, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 4, 2, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, -1, -3, -1, 1, 0, -2, -2, 2, 4, -2, -5, -2, -1, -3, -3, -1, -1, -3, -2, -1, -2, -3, -2, 0, 1, 2, 2, 1, 0, 1, 2, 2, 0, 0, 2, 4, 2, 0, 0, 2, 2, 0, -1, 0, 5, 4, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, -1, -5, -3, 0, 0, -2, -3, -2, 0, 0, -1, -2, -1, 0, 2, 4, 1, 0, 2, 6, 4, 0, 0, 4, 6, 2, 0, 0, 1, 0, 0, 0, 0, 0, -1, -2, -2, -1, 0, -1, -2, -2, -1, -1, -2, -1, 0, -1, -5, -5, -2, 0, 0, -1, -1, 0, -1, -2, -2, 0, 1, 0, -1, 0, 1, 1, -2, -6, -6, -2, -1, -3, -7, -6, 0, 0, -2, -6, -3, 0, 0, -2, -1, 0, 0, -6, -8, -3, -1, -5, -9, -8, -2, 0, -2, -3, -2, -1, -1, 0, 0, -1, -2, -2, 0, -2, -5, -3, 0, 0, -5, -8, -5, 0, 1, -1, -6, -5, -1, 0, 0, 0, 0, 0, 0, 0, 4, 2, -1, -5, -2, 1, 1, 0, 0, 4, 4, 0, -1, 2, 5, 1, 0, 2, 6, 4, 1, 1, 4, 6, 7, 5, 4, 5, 9, 12, 8, 1, 0, 6, 9, 6, 1, 1, 4, 5, 6, 6, 5, 1, 0, 1, 2, 4, 6, 7, 4, 0, 1, 8, 9, 5, 4, 9, 13, 8, 2, 2, 6, 6, 5, 5, 5, 6, 8, 6, 1, 0, 2, 5, 4, 1, 1, 2, 5, 7, 7, 6, 4, 4, 5, 7, 6, 4, 2, 4, 5, 6, 6, 4, 4, 5, 8, 8, 6, 5, 4, 4, 7, 7, 4, 0, 0, 5, 7, 5, 2, 2, 5, 6, 5, 1, 0, 1, 5, 4, 0, 0, 5, 7, 2, -2, 0, 6, 6, 0, -1, 1, 1, 0, 0, 2, 1, -1, -2, 0, 4, 5, 1, -2, -2, 0, 0, -2, -3, -2, -1, 0, 0, 1, 1, 2, 4, 2, 0, -1, 0, 1, 0, 0, 0, 0, 0, 1, 0, -1, -2, -1, -1, -2, -3, -2, -1, -1, -1, 0, 0, 0, 0, 4, 4, 0, -2, -1, 0, -1, -5, -3, -1, 0, 0, 0, 0, -1, -2, -1, 0, 0, 1, 0, -3, -5, -1, 2, 4, 0, -1, -1, 0, 0, 0, -1, -2, -2, -2, -3, -6, -5, 0, 2, 0, -2, -6, -6, -3, -1, -1, -2, -3, -3, -3, -5, -6, -3, -2, -2, -2, -5, -7, -7, -2, 0, -3, -8, -8, -5, -3, -2, -1, -5, -8, -9, -5, 0, -2, -6, -6, -1, 0, -3, -7, -7, -3, -5, -8, -9, -7, -6, -8, -9, -8, -6, -6, -7, -6, -3, -1, -1, -1, -1, 0, -1, -5, -6, -2, -2, -6, -7, -3, -1, -3, -6, -5, -1, -2, -2, -2, -2, -5, -6, -5, -2, -1, -3, -8, -10, -9, -7, -5, -7, -8, -7, -3, -2, -5, -6, -5, -5, -5, -3, -2, -3, -5, -6, -6, -9, -12, -10, -8, -8, -9, -9, -7, -7, -9, -10, -9, -8, -8, -8, -8, -8, -6, -3, -3, -5, -6, -3, -2, -3, -6, -7, -7, -5, -3, -5, -8, -9, -6, -3, -5, -8, -8, -5, -5, -7, -8, -6, -2, -2, -5, -7, -8, -7, -3, -2, -6, -8, -7, -5, -7, -8, -7, -7, -8, -7, -5, -6, -9, -10, -9, -8, -8, -7, -9, -13, -12, -8, -6, -7, -8, -7, -5, -5, -6, -6, -8, -10, -10, -6, -3, -5, -7, -7, -7, -7, -5, -1, -2, -6, -7, -3, -3, -5, -6, -7, -10, -9, -1, 1, -2, -8, -8, -7, -5, -5, -6, -8, -7, -5, -6, -9, -10, -7, -7, -9, -10, -7, -3, -5, -9, -10, -8, -3, -2, -5, -7, -7, -7, -7, -7, -6, -7, -9, -10, -8, -5, -5, -6, -7, -8, -7, -6, -7, -9, -10, -7, -5, -7, -9, -7, -2, -1, -5, -3, -1, 0, -3, -5, -2, -1, -3, -5, -3, -1, 0, 0, 0, 0, -2, -2, -2, -3, -5, -1, 1, 2, -1, -2, -1, -1, -2, -2, -2, -2, 0, 4, 5, 4, 2, 1, 0, 0, 4, 6, 4, 0, 0, 1, 0, 0, 4, 5, 0, -1, 0, 2, 2, 2, 4, 5, 2, 1, 2, 5, 5, 2, 0, 0, 4, 6, 4, 0, 0, 5, 9, 7, 4, 6, 8, 5, 1, 4, 5, 1, 0, 4, 6, 2, 1, 1, 1, 1, 4, 5, 4, 0, -3, -2, 1, 5, 4, 2, 2, 4, 4, 2, 2, 5, 6, 6, 6, 5, 2, 1, 2, 6, 9, 12, 11, 7, 6, 7, 7, 5, 4, 7, 9, 6, 2, 5, 8, 8, 5, 2, 4, 6, 6, 5, 4, 5, 7, 9, 8, 5, 4, 4, 4, 2, 2, 2, 1, 0, 1, 4, 4, 1, 1, 2, 1, 0, 1, 4, 4, 1, 0, 0, 0, 1, 0, -2, -2, 0, 1, 0, -1, 1, 5, 5, 2, 0, -2, -1, 2, 2, 0, -1, 1, 2, 1, 0, -2, -3, -3, 0, 0, -5, -7, -5, -2, -2, -3, -5, -5, -2, 0, -2, -6, -7, -6, -6, -7, -7, -6, -6, -8, -8, -5, -3, -6, -8, -7, -3, -2, -5, -6, -5, -2, -2, -5, -6, -7, -5, -3, -3, -5, -3, -2, -3, -5, -5, -3, -5, -8, -10, -9, -6, -3, -5, -6, -6, -3, -2, -3, -5, -3, 0, 0, -5, -8, -7, -3, -3, -6, -7, -7, -6, -6, -5, -5, -5, -6, -6, -5, -1, -1, -2, -5, -5, -3, -3, -3, -3, -3, -3, -3, -5, -5, -2, 0, -1, -5, -7, -5, -2, -2, -3, -5, -3, -1, -1, -1, -2, -1, 0, 0, 0, -1, -1, -2, -2, 0, 2, -1, -5, -1, 1, 0, -3, -1, 1, 0, -2, 0, 1, 1, 1, 2, 5, 5, 4, 4, 4, 4, 4, 2, 1, 2, 4, 4, 1, 0, 2, 4, 5, 4, 4, 4, 4, 1, 0, -1, -1, -1, -3, -3, -1, 0, 0, -1, -3, -3, -2, -1, -1, -3, -6, -6, -3, -1, -2, -3, -3, -2, -2, -2, -3, -3, -5, -7, -9, -12, -9, -6, -5, -6, -7, -6, -5, -7, -7, -5, -3, -7, -8, -5, -2, -3, -7, -8, -6, -6, -8, -8, -6, -7, -12, -14, -12, -6, -3, -3, -5, -5, -3, -2, -2, -5, -7, -8, -7, -7, -9, -9, -7, -6, -7, -9, -9, -7, -6, -6, -6, -5, -5, -5, -7, -6, -5, -2, -3, -7, -9, -8, -5, -5, -6, -6, -7, -8, -6, -2, -1, -5, -8, -6, -2, -3, -8, -8, -3, 0, -2, -8, -9, -3, 0, -1, -7, -9, -7, -5, -5, -6, -7, -6, -5, -3, -2, -2, -2, -3, -3, -6, -7, -7, -3, -1, -1, -2, -3, -5, -7, -7, -5, -2, -5, -6, -5, 0, 5, 5, 1, -1, -2, 0, 0, -1, -3, -3, -1, 1, 2, 0, -1, -2, 0, 4, 5, 2, 0, 0, 0, 1, 2, 2, 0, 1, 2, 4, 1, 0, 2, 5, 5, 1, 0, 1, 6, 8, 7, 5, 2, 2, 4, 5, 4, 2, 5, 7, 4, 1, 5, 9, 9, 5, 2, 5, 6, 5, 4, 4, 5, 6, 8, 9, 7, 4, 6, 8, 7, 2, 4, 8, 6, 0, 1, 7, 11, 7, 5, 5, 6, 6, 8, 8, 8, 8, 9, 11, 11, 11, 11, 11, 8, 8, 12, 13, 12, 11, 12, 13, 12, 11, 13, 14, 13, 13, 12, 11, 8, 9, 12, 13, 13, 12, 9, 7, 7, 8, 12, 12, 8, 6, 7, 11, 14, 13, 9, 7, 7, 9, 12, 12, 9, 6, 4, 4, 8, 9, 5, 0, 0, 1, 1, 0, 2, 7, 7, 4, 1, 2, 4, 6, 5, 2, 0, 1, 6, 7, 5, 2, 2, 5, 5, 2, 1, 2, 4, 2, 0, 0, 0, 0, -1, -1, 1, 5, 2, -1, -2, 1, 2, 0, -1, 0, 0, 0, 0, 1, 0, -3, -3, 0, 0, -1, -1, 0, 4, 4, 0, -2, -1, 4, 4, 0, -2, -1, 0, 0, 0, 4, 4, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 4, 6, 6, 4, 4, 6, 6, 2, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -2, -1, 1, 2, 0, -2, -1, 1, 2, 1, 0, 0, 0, -1, -2, -1, 0, 0, 0, 0, 1, 4, 4, 2, 1, 2, 1, -1, 0, 2, 4, 0, -1, 0, 1, 2, 2, 2, 0, 0, 1, 5, 6, 2, 0, 2, 6, 7, 5, 2, 1, 1, 4, 5, 4, 1, 0, 1, 2, 1, -1, -1, 0, 1, 1, 1, 1, 1, 4, 7, 7, 1, -1, 0, 5, 6, 4, 2, 0, -1, -1, 0, -1, -2, -1, 1, 2, 0, 0, 0, 0, 0, -3, -6, -6, -3, -2, -1, -1, 0, -1, -3, -3, -1, -1, -3, -5, -2, -1, -5, -9, -8, -3, -2, -6, -7, -6, -6, -6, -5, -3, -3, -3, -2, -3, -5, -7, -10, -14, -9, -2, -5, -13, -15, -10, -9, -12, -10, -7, -9, -13, -12, -7, -7, -12, -13, -12, -10, -12, -14, -15, -15, -13, -12, -15, -17, -16, -13, -13, -15, -16, -15, -14, -15, -16, -15, -17, -21, -20, -16, -17, -21, -21, -18, -17, -21, -24, -22, -18, -20, -22, -21, -17, -16, -17, -18, -20, -21, -21, -21, -22, -22, -17, -14, -15, -18, -20, -18, -20, -20, -18, -18, -21, -21, -18, -17, -17, -18, -18, -18, -16, -14, -14, -16, -17, -16, -14, -13, -14, -18, -22, -20, -16, -15, -17, -16, -15, -16, -18, -16, -14, -15, -17, -16, -14, -12, -13, -15, -17, -16, -12, -8, -9, -14, -14, -10, -9, -12, -15, -16, -13, -9, -8, -10, -14, -15, -17, -21, -22, -17, -12, -10, -14, -15, -10, -8, -10, -14, -15, -15, -16, -15, -13, -12, -13, -13, -10, -8, -7, -8, -8, -9, -10, -10, -9, -8, -8, -9, -12, -12, -10, -8, -7, -8, -12, -12, -9, -9, -13, -14, -12, -7, -6, -7, -7, -5, -3, -3, -3, -3, -5, -7, -8, -8, -7, -5, -5, -5, -5, -5, -7, -8, -5, -1, -3, -8, -8, -5, -2, -7, -10, -9, -7, -7, -9, -12, -10, -9, -8, -8, -8, -7, -6, -6, -6, -5, -5, -7, -7, -8, -9, -8, -6, -6, -9, -12, -8, -5, -5, -9, -13, -12, -8, -7, -8, -10, -10, -7, -6, -7, -6, -3, -2, -6, -10, -10, -8, -7, -9, -10, -12, -12, -9, -6, -2, -3, -7, -7, -6, -6, -7, -7, -5, -5, -5, -5, -3, -2, -2, -1, -1, -3, -6, -5, -2, -2, -2, -1, -1, -3, -3, 0, 4, 1, -1, 0, 1, 5, 6, 4, 0, -2, 1, 5, 2, -1, 0, 5, 6, 4, 0, 0, 1, 4, 5, 4, 1, 1, 4, 7, 6, 2, 1, 2, 5, 4, 1, 2, 5, 6, 5, 4, 5, 6, 5, 2, 0, 0, 2, 5, 5, 4, 5, 7, 8, 8, 8, 9, 8, 5, 4, 6, 8, 5, 0, 0, 4, 5, 2, 0, 0, 1, 4, 6, 6, 2, 0, -1, 0, 2, 4, 0, -2, -2, 0, 2, 0, 0, 1, 4, 4, 1, 0, 2, 4, 2, 1, 2, 5, 5, 4, 1, 0, 0, 0, 1, 2, 2, 1, 0, 1, 4, 6, 4, 1, 0, 1, 1, 1, 1, 2, 6, 7, 6, 2, 1, 2, 4, 4, 4, 2, 2, 0, 0, 1, 5, 6, 5, 4, 2, 2, 2, 2, 5, 6, 4, 0, 0, 0, 0, 0, 1, 2, 1, -1, 0, 2, 1, 0, 0, 1, 2, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 1, 0, 0, 0, 2, 2, 1, 2, 4, 4, 2, 1, 1, 0, 4, 7, 8, 6, 2, 1, 1, 4, 6, 5, 1, 0, 2, 5, 5, 5, 2, 0, 1, 7, 9, 6, 4, 6, 11, 9, 5, 2, 2, 5, 6, 4, 1, 2, 5, 6, 5, 2, 5, 8, 8, 5, 2, 4, 7, 11, 9, 6, 2, 0, 1, 5, 7, 6, 2, 2, 5, 6, 6, 6, 7, 7, 7, 7, 7, 7, 7, 7, 7, 8, 8, 7, 7, 8, 11, 13, 13, 8, 5, 7, 13, 14, 8, 4, 7, 12, 12, 7, 6, 7, 6, 4, 5, 8, 9, 7, 7, 9, 12, 11, 8, 7, 7, 8, 7, 6, 7, 9, 8, 5, 7, 8, 5, 0, 4, 13, 13, 4, 0, 5, 11, 8, 6, 7, 7, 6, 5, 8, 12, 9, 6, 5, 6, 6, 6, 6, 8, 8, 8, 7, 6, 5, 4, 4, 5, 7, 8, 7, 5, 4, 5, 5, 2, 1, 5, 7, 6, 2, 1, 4, 2, 0, 1, 4, 4, 4, 6, 7, 6, 5, 6, 8, 6, 0, 0, 1, 4, 2, 1, 4, 5, 5, 6, 6, 4, 1, 4, 6, 5, 2, 4, 6, 4, 0, 0, 2, 5, 5, 4, 4, 4, 4, 5, 5, 2, 1, 4, 5, 2, 1, 5, 7, 4, 1, 2, 1, 0, 0, 4, 2, 0, -1, 0, 0, 0, 2, 1, 0, -1, 0, 1, 1, 0, 0, 0, 0, 1, 2, 2, 0, 0, 2, 4, 4, 5, 7, 5, 0, -1, 1, 2, -1, -6, -5, -1, 0, 2, 2, 0, -2, -3, -1, 0, 0, 0, 0, 0, -2, -3, -1, 0, -1, -1, -2, -5, -6, -5, -3, -6, -8, -6, -3, -5, -7, -5, -5, -7, -8, -5, -1, -5, -9, -8, -3, -3, -7, -8, -5, -6, -9, -12, -10, -8, -6, -5, -8, -12, -10, -6, -5, -9, -12, -12, -9, -8, -8, -10, -12, -9, -6, -7, -10, -12, -13, -15, -15, -12, -9, -10, -12, -13, -16, -16, -13, -12, -15, -16, -15, -16, -20, -18, -15, -14, -15, -14, -13, -16, -20, -20, -16, -14, -12, -13, -16, -18, -15, -10, -12, -17, -17, -14, -13, -16, -20, -18, -15, -14, -15, -16, -16, -14, -14, -15, -15, -13, -13, -15, -15, -14, -14, -16, -17, -14, -12, -15, -20, -18, -15, -13, -14, -15, -16, -17, -14, -9, -8, -13, -15, -13, -12, -10, -10, -13, -15, -13, -10, -14, -18, -16, -12, -12, -16, -16, -14, -13, -13, -10, -9, -9, -12, -10, -9, -9, -9, -10, -12, -10, -8, -7, -8, -8, -9, -10, -12, -9, -8, -9, -10, -9, -8, -9, -9, -8, -9, -9, -7, -6, -8, -9, -8, -7, -9, -13, -10, -7, -8, -9, -9, -7, -6, -7, -7, -5, -3, -6, -6, -3, -3, -3, -3, -3, -5, -2, 0, 0, -2, -5, -2, -1, -2, -2, 0, 1, 1, 1, 4, 6, 5, 2, 4, 5, 4, 0, 0, 1, 4, 5, 2, 0, 0, 5, 6, 4, 1, 4, 6, 4, 2, 6, 8, 8, 8, 7, 5, 2, 5, 8, 8, 6, 5, 5, 6, 7, 11, 11, 8, 5, 5, 6, 6, 7, 11, 12, 9, 5, 6, 9, 11, 11, 9, 8, 6, 7, 9, 9, 7, 5, 6, 7, 8, 8, 8, 7, 7, 6, 5, 5, 6, 8, 7, 5, 2, 4, 7, 8, 8, 6, 2, 0, 0, 4, 8, 9, 6, 5, 5, 7, 7, 5, 4, 2, 2, 5, 6, 5, 1, 0, 2, 4, 2, 1, 1, 1, 1, 2, 2, 0, 0, 1, 2, 1, 0, 0, 2, 4, 0, -2, -3, 0, 1, 1, 0, -2, -1, 0, -1, -2, -2, 0, 0, 0, 0, 0, 1, 0, -1, -3, -3, -1, 0, 0, -2, -2, 0, 0, -1, -1, -1, -1, 0, -1, -5, -6, -3, 0, -5, -10, -9, -3, -1, -5, -8, -8, -7, -5, -2, -1, -2, -3, -5, -6, -3, 0, -2, -7, -7, -1, 1, 0, -5, -5, -2, -2, -2, -2, 0, 0, -1, -1, -2, -2, -3, -3, -1, 0, 0, -1, -5, -7, -8, -7, -5, -3, -6, -9, -9, -7, -3, -3, -6, -8, -8, -8, -7, -7, -7, -7, -7, -6, -6, -7, -8, -8, -8, -9, -13, -12, -8, -7, -8, -9, -7, -6, -8, -9, -8, -8, -10, -9, -5, -1, -5, -9, -9, -7, -7, -9, -10, -7, -6, -8, -9, -8, -9, -13, -13, -7, -2, -2, -7, -10, -9, -7, -7, -8, -8, -7, -9, -10, -6, -3, -7, -14, -14, -10, -10, -13, -10, -5, -1, -5, -9, -10, -7, -3, -5, -8, -9, -7, -6, -7, -8, -6, -6, -10, -14, -14, -12, -12, -14, -12, -7, -6, -8, -10, -12, -13, -12, -8, -7, -10, -12, -9, -8, -10, -13, -13, -12, -12, -13, -13, -13, -12, -10, -12, -14, -14, -10, -8, -9, -12, -14, -14, -12, -9, -8, -10, -16, -17, -15, -13, -14, -15, -14, -10, -10, -13, -14, -14, -13, -13, -14, -14, -15, -16, -16, -15, -15, -16, -16, -15, -12, -10, -12, -14, -13, -12, -10, -12, -14, -16, -15, -10, -8, -10, -14, -15, -13, -12, -12, -13, -12, -9, -7, -9, -13, -16, -15, -10, -7, -9, -14, -15, -12, -8, -7, -9, -12, -10, -8, -6, -6, -8, -9, -7, -5, -5, -7, -9, -9, -7, -5, -5, -3, -2, -3, -7, -9, -7, -5, -6, -8, -7, -3, -3, -6, -8, -8, -7, -6, -5, -3, -2, -5, -9, -10, -8, -5, -6, -7, -6, -3, -3, -5, -5, -3, -2, -3, -2, 1, 2, -1, -6, -3, 1, 2, 0, -3, -5, -3, 0, 2, 4, 1, -1, 0, 1, 2, 1, 1, 1, 0, -1, 0, 2, 0, -2, 0, 5, 6, 4, 2, 2, 2, 5, 9, 11, 8, 6, 6, 6, 6, 4, 4, 4, 4, 4, 5, 7, 9, 9, 7, 4, 4, 6, 7, 6, 6, 8, 9, 8, 6, 5, 4, 1, 2, 5, 4, 4, 7, 12, 11, 6, 5, 9, 11, 9, 9, 13, 12, 6, 5, 9, 11, 5, 1, 5, 7, 7, 8, 12, 9, 6, 8, 14, 13, 7, 7, 12, 13, 9, 7, 8, 9, 9, 9, 11, 9, 7, 7, 8, 7, 6, 7, 9, 8, 6, 8, 9, 9, 12, 15, 13, 5, 2, 8, 11, 8, 8, 12, 13, 9, 6, 8, 12, 13, 9, 7, 9, 14, 15, 13, 12, 12, 9, 6, 5, 11, 15, 12, 4, 2, 9, 13, 9, 6, 8, 12, 9, 6, 7, 11, 13, 12, 9, 7, 6, 6, 8, 11, 11, 8, 8, 8, 8, 7, 5, 5, 6, 6, 5, 5, 6, 8, 11, 11, 8, 6, 6, 8, 12, 13, 9, 7, 8, 11, 11, 7, 4, 5, 7, 5, 2, 6, 11, 9, 5, 6, 11, 13, 8, 4, 5, 8, 6, 1, 4, 9, 9, 5, 4, 7, 8, 6, 5, 5, 6, 5, 4, 5, 7, 8, 5, 2, 5, 8, 6, 1, 4, 11, 8, 0, -1, 4, 7, 5, 1, 2, 5, 1, 0, 5, 11, 7, 0, -1, 2, 6, 4, 2, 2, 2, 1, 2, 5, 4, 0, -1, 0, 4, 2, 1, 0, -1, -1, 0, -1, -6, -6, -1, 0, -5, -6, -1, 0, -2, -6, -5, -3, -6, -8, -8, -6, -6, -6, -6, -7, -8, -8, -6, -6, -8, -8, -5, -3, -6, -7, -5, -3, -6, -9, -8, -5, -3, -6, -6, -3, -3, -5, -5, -5, -3, -2, -1, -2, -3, -2, -2, -5, -6, -3, -2, -3, -3, -1, -2, -9, -12, -6, -1, -2, -5, -5, -5, -6, -7, -6, -5, -5, -8, -10, -12, -8, -6, -7, -8, -6, -5, -6, -7, -6, -3, -5, -6, -7, -7, -7, -6, -5, -3, -3, -1, -1, -3, -6, -3, -1, 0, -1, -1, -1, -3, -7, -6, -2, -2, -5, -3, 0, -1, -6, -7, -3, -2, -3, -3, -2, 0, -1, -2, -1, -1, -2, -2, 0, 0, -3, -5, -1, 2, 0, -5, -8, -5, 0, 1, -5, -9, -7, -1, 1, 0, 0, -1, -3, -5, -2, -1, -1, -2, -1, 0, -1, -1, 0, 1, 0, -2, -3, 0, 5, 5, 1, -2, -3, -1, 2, 2, 0, -2, -1, 0, 0, 0, -1, -3, -5, -1, 0, -1, -3, -1, 0, 0, -2, 0, 0, 0, -2, 0, 4, 1, -3, -3, 0, 0, -1, -1, -1, -2, -5, -3, -2, -2, -3, -3, -3, -3, -2, 0, -1, -2, -2, -1, -2, -2, -1, -2, -7, -9, -6, -1, 1, 1, 0, -1, -2, -1, 0, 0, 1, 0, -1, -5, -3, 0, 2, 0, -3, -2, 0, 0, -1, -2, -1, -1, -1, -1, -1, -1, -2, -2, -2, -3, -6, -6, -2, 0, -3, -7, -6, -1, 0, -2, -5, -5, -5, -7, -8, -7, -7, -8, -8, -6, -6, -7, -8, -8, -8, -9, -10, -10, -9, -9, -10, -13, -14, -12, -10, -13, -17, -18, -15, -13, -12, -13, -13, -14, -14, -13, -12, -13, -16, -17, -18, -18, -20, -18, -18, -20, -18, -16, -15, -18, -21, -17, -15, -16, -20, -20, -20, -23, -25, -25, -24, -24, -24, -24, -25, -28, -26, -23, -20, -21, -24, -28, -29, -28, -25, -24, -26, -29, -28, -22, -18, -23, -29, -31, -28, -25, -25, -26, -26, -26, -28, -30, -31, -30, -26, -24, -26, -29, -28, -24, -23, -25, -29, -29, -28, -26, -24, -24, -25, -25, -23, -21, -21, -24, -26, -26, -25, -23, -22, -22, -22, -24, -24, -23, -21, -21, -22, -22, -20, -18, -18, -20, -20, -16, -13, -14, -17, -21, -21, -17, -16, -18, -20, -18, -16, -15, -16, -18, -17, -16, -17, -18, -16, -13, -13, -17, -20, -17, -14, -13, -12, -9, -10, -16, -18, -15, -10, -12, -17, -18, -17, -15, -15, -14, -14, -17, -21, -17, -10, -7, -8, -12, -13, -12, -8, -6, -9, -14, -13, -7, -6, -12, -15, -13, -7, -5, -6, -8, -9, -8, -6, -2, -5, -9, -10, -7, -3, -6, -7, -3, -1, -3, -6, -5, -2, -3, -6, -6, -5, -2, 0, 0, -2, -3, -1, 1, 1, 0, -1, 0, 2, 1, -1, -1, 0, 4, 2, 0, 0, 1, 4, 4, 1, 1, 5, 5, 1, 0, 2, 5, 2, 0, 1, 5, 5, 2, 2, 4, 2, 0, 1, 5, 4, 1, 1, 5, 5, 2, 2, 5, 6, 1, 1, 6, 11, 7, 1, 1, 4, 5, 7, 8, 5, 2, 5, 7, 4, 0, 1, 6, 7, 6, 7, 8, 9, 11, 11, 11, 9, 11, 13, 13, 12, 11, 12, 13, 12, 9, 9, 11, 12, 12, 11, 13, 15, 15, 13, 11, 11, 12, 13, 13, 13, 13, 13, 14, 15, 14, 12, 8, 8, 11, 13, 12, 9, 11, 13, 13, 11, 8, 11, 12, 12, 11, 12, 14, 15, 15, 16, 16, 13, 12, 15, 19, 17, 14, 14, 16, 16, 16, 15, 14, 13, 13, 13, 13, 13, 14, 14, 12, 9, 8, 12, 13, 12, 9, 9, 11, 9, 9, 12, 12, 11, 12, 14, 14, 12, 13, 15, 16, 14, 13, 15, 19, 17, 15, 13, 13, 14, 14, 13, 11, 9, 11, 12, 12, 9, 9, 12, 14, 15, 15, 14, 13, 12, 13, 15, 14, 9, 6, 6, 8, 9, 9, 11, 11, 9, 9, 12, 14, 12, 9, 8, 8, 7, 7, 9, 13, 14, 9, 7, 8, 13, 14, 11, 7, 6, 9, 12, 12, 11, 11, 11, 11, 11, 12, 11, 7, 6, 6, 6, 7, 8, 11, 9, 6, 4, 5, 8, 8, 6, 5, 6, 8, 7, 6, 5, 7, 11, 12, 8, 6, 7, 12, 13, 9, 2, 2, 7, 12, 9, 5, 5, 7, 7, 7, 6, 6, 4, 4, 5, 6, 6, 5, 6, 6, 1, -1, 2, 8, 6, 1, 2, 8, 8, 6, 6, 7, 7, 7, 6, 5, 6, 8, 8, 5, 1, 1, 4, 4, 2, 0, 0, 1, 5, 6, 4, 0, 0, 2, 5, 4, 1, 0, 0, 2, 4, 4, 2, 0, 1, 4, 5, 2, 0, 0, 2, 6, 5, 0, -3, -5, -1, 1, 1, -1, -2, 0, 2, 4, 0, -3, -1, 1, 2, 0, -1, 1, 2, 0, -2, -2, 0, 0, 0, -1, -1, 0, 0, 0, -1, -2, -5, -6, -3, 0, 1, -2, -5, -3, -1, -2, -6, -7, -7, -6, -6, -6, -6, -6, -3, -2, -1, -2, -3, -3, -3, -3, -3, -3, -3, -3, -5, -5, -2, -1, -2, -5, -5, -5, -3, -3, -5, -7, -6, -2, -1, -3, -5, -1, -2, -6, -6, -2, -1, -6, -8, -7, -6, -6, -5, -3, -3, -5, -3, 0, 0, 0, 0, -2, -5, -5, -2, 0, 0, -1, -1, 0, 0, 0, 2, 2, 0, -3, -3, -1, -1, -1, 0, 2, 1, -1, -3, 0, 1, 0, -1, -1, 0, 2, 2, 0, -2, -1, 2, 5, 0, -1, 0, 5, 5, 1, -1, -1, 0, 1, 2, 1, -1, -2, -1, 1, 4, 0, -1, -1, 0, 1, -1, -3, -2, 0, 0, -3, -5, -2, -1, -5, -7, -6, -2, -1, -3, -5, -3, -1, 0, 0, -2, -2, -1, -3, -6, -5, -3, -6, -10, -10, -6, -5, -7, -9, -8, -6, -6, -6, -6, -7, -8, -9, -9, -8, -8, -12, -14, -14, -12, -10, -12, -13, -10, -8, -7, -8, -9, -8, -8, -9, -9, -7, -7, -8, -9, -10, -12, -13, -12, -9, -8, -9, -12, -12, -10, -9, -8, -7, -7, -8, -8, -9, -9, -9, -6, -2, -2, -3, -6, -7, -7, -3, -1, -2, -6, -5, -2, -2, -5, -5, -2, -2, -5, -6, -3, -2, -2, -3, -3, -2, -2, -1, -1, -5, -5, 0, 2, 0, -5, -2, 2, 2, 0, 0, 1, 0, -2, -5, -2, -2, -3, -2, 0, 0, -1, -1, 0, 0, -1, 0, 2, 5, 2, 2, 4, 5, 5, 2, 0, 0, 4, 9, 8, 5, 4, 2, 1, 2, 6, 7, 4, 0, 2, 5, 6, 6, 5, 4, 4, 7, 8, 7, 5, 6, 8, 8, 6, 4, 4, 6, 7, 4, 0, 1, 5, 7, 5, 4, 6, 8, 8, 5, 2, 4, 8, 11, 9, 6, 1, -1, -1, 1, 6, 5, 0, 0, 2, 5, 5, 5, 5, 4, 2, 4, 5, 5, 4, 5, 5, 5, 5, 6, 6, 7, 9, 12, 12, 6, 2, 4, 7, 8, 5, 2, 5, 7, 5, 1, 2, 4, 2, -1, 0, 2, 2, 1, 2, 5, 5, 1, 0, 0, 0, 2, 2, 0, 0, 2, 4, 0, 0, 4, 0, -3, 0, 5, 4, -3, -6, 0, 1, -2, -3, -1, 0, -2, -3, -2, 0, 0, 0, 0, 0, -2, -2, 0, 0, 0, -2, -2, -2, -1, 0, -1, -2, 0, 2, 0, -3, -3, 0, -2, -7, -8, -6, -5, -6, -6, -6, -7, -9, -10, -12, -12, -9, -6, -3, -6, -8, -8, -6, -3, -6, -10, -15, -16, -16, -16, -16, -14, -12, -10, -10, -10, -14, -15, -14, -12, -12, -13, -13, -15, -17, -17, -15, -14, -14, -13, -12, -13, -14, -14, -13, -13, -15, -15, -14, -13, -14, -15, -16, -16, -14, -13, -14, -20, -22, -20, -15, -16, -20, -21, -20, -20, -17, -15, -16, -18, -17, -13, -13, -16, -17, -15, -13, -13, -15, -17, -17, -16, -15, -15, -16, -15, -13, -13, -14, -15, -13, -12, -14, -20, -23, -20, -15, -14, -18, -17, -13, -12, -16, -18, -18, -18, -18, -16, -14, -16, -18, -16, -13, -13, -13, -13, -14, -14, -13, -13, -16, -17, -15, -14, -15, -16, -15, -13, -13, -13, -12, -10, -10, -9, -7, -6, -7, -9, -9, -6, -5, -6, -8, -8, -7, -6, -5, -3, -3, -6, -6, -5, -5, -7, -7, -3, -3, -8, -9, -2, 2, 2, 0, -1, 0, 2, 2, 1, 1, 6, 7, 2, -2, -1, 4, 4, 0, 0, 2, 6, 6, 5, 8, 11, 9, 6, 7, 12, 15, 13, 8, 6, 8, 12, 12, 11, 8, 8, 11, 12, 12, 11, 12, 13, 12, 8, 7, 12, 13, 12, 9, 9, 9, 11, 12, 9, 8, 9, 9, 7, 6, 7, 7, 5, 7, 13, 14, 9, 6, 7, 8, 6, 5, 7, 11, 11, 9, 9, 9, 9, 8, 8, 8, 9, 11, 11, 8, 6, 6, 8, 11, 13, 14, 12, 9, 8, 12, 13, 8, 4, 2, 5, 6, 5, 6, 8, 11, 7, 2, 4, 12, 16, 14, 7, 5, 7, 7, 6, 8, 11, 11, 9, 9, 9, 7, 6, 5, 2, 2, 5, 6, 4, 1, 2, 5, 6, 6, 5, 2, 1, 4, 6, 5, 1, 2, 5, 6, 4, 2, 2, 1, 0, 0, 2, 4, 1, 0, 2, 4, 2, 2, 2, 2, 4, 6, 6, 4, 1, 0, 0, 0, 0, 4, 4, 4, 4, 4, 1, 1, 4, 6, 5, 2, 2, 2, 2, 1, 0, 0, 0, -2, -3, -3, -3, -3, -3, -1, 0, 0, -3, -5, -5, -7, -7, -3, 0, -1, -6, -7, -5, -2, -5, -6, -5, -2, -1, -3, -8, -9, -5, 0, 0, -7, -10, -7, 0, 1, 0, 0, 0, -5, -7, -3, 0, -1, -5, -5, -2, -1, -2, -3, -5, -5, -5, -5, -6, -6, -3, -1, 0, -1, -3, -6, -6, -5, -3, -5, -6, -3, 0, 0, 0, -1, -1, -1, -2, 0, 2, 1, -3, -7, -5, -1, -1, -2, -2, -1, -1, -3, -3, -2, 0, 0, 0, 0, -2, -2, 0, 2, 2, 0, -1, -1, -1, -1, -1, -1, 0, 1, 2, 0, 0, 1, 1, -1, -3, -1, 0, -1, -2, -2, -2, -2, -3, -3, -2, -2, -1, -1, 0, 0, 0, 1, 2, 1, 0, -1, 0, 0, -1, -2, -1, 0, 0, 0, 1, 0, -1, -1, 1, 4, 0, 0, 0, 1, -1, -3, -2, 0, 0, 0, 0, 0, -1, 0, 1, 0, -2, -3, 0, 0, -2, -1, 2, 2, 0, 0, 0, -2, -3, -1, 0, -2, -5, -3, -3, -2, 0, 0, -2, -5, -3, -2, -3, -5, -3, -2, -3, -3, -1, 0, -2, -3, -2, 0, 1, 1, 1, 0, -2, -5, -3, -1, -2, -6, -7, -5, -2, -2, -1, -1, -2, -5, -5, -2, -2, -3, -3, -3, -5, -5, -2, 0, -1, -2, -1, -1, -3, -2, -1, -2, -6, -3, 0, 0, -3, -5, 0, 1, 0, 0, 2, 2, 0, -1, 0, 2, 0, 0, 0, 1, 0, -2, -1, 0, 1, 2, 1, -1, 0, 2, 5, 1, 0, 0, 0, 1, 2, 1, 0, 2, 6, 5, 0, -1, 0, -1, -2, 0, 2, 2, 1, 0, -1, -2, 0, 1, 0, 0, 1, 2, 0, 0, 4, 4, 0, 0, 4, 4, 0, -1, 2, 4, 4, 4, 2, 0, 0, 5, 7, 4, 0, 1, 4, 4, 1, 0, 0, 2, 5, 1, -1, 0, 5, 5, 4, 2, 1, -1, -1, 1, 2, 0, -1, 0, 2, 2, 0, 0, -1, 0, 0, 0, -3, -3, 0, 4, 4, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -2, -6, -6, -1, 2, 1, -2, -3, -2, 0, 1, 0, -2, -3, -2, -2, -2, -2, -1, -2, -3, -2, -2, -3, -3, -1, -2, -6, -7, -5, -3, -5, -5, -3, -3, -5, -5, -5, -7, -6, -3, -5, -8, -8, -7, -9, -12, -10, -8, -7, -8, -8, -7, -8, -10, -9, -6, -5, -6, -8, -8, -6, -6, -7, -8, -8, -8, -8, -7, -6, -8, -10, -9, -6, -6, -8, -7, -2, -1, -2, -2, -2, -6, -5, -2, -2, -8, -10, -8, -5, -3, -5, -6, -7, -5, -3, -5, -7, -8, -7, -7, -9, -9, -7, -3, -2, -5, -8, -8, -7, -6, -6, -7, -7, -7, -8, -9, -7, -3, -5, -8, -9, -7, -7, -9, -9, -5, -2, -6, -9, -8, -6, -7, -7, -8, -9, -10, -8, -7, -9, -10, -10, -9, -9, -9, -9, -10, -10, -9, -8, -10, -12, -12, -9, -10, -12, -12, -12, -12, -12, -12, -12, -12, -14, -14, -9, -6, -5, -9, -14, -14, -13, -12, -12, -13, -13, -12, -12, -12, -15, -17, -15, -12, -12, -13, -14, -14, -13, -13, -14, -15, -16, -15, -13, -12, -13, -15, -13, -10, -12, -15, -17, -15, -13, -12, -13, -15, -16, -14, -12, -13, -15, -14, -13, -13, -14, -12, -10, -12, -15, -15, -15, -14, -14, -13, -13, -13, -13, -13, -12, -10, -10, -10, -10, -10, -13, -17, -16, -10, -9, -15, -18, -14, -10, -12, -14, -15, -15, -14, -10, -8, -8, -12, -13, -13, -12, -8, -6, -8, -12, -10, -7, -5, -6, -7, -7, -6, -6, -5, -2, -1, -2, -3, -5, -5, -3, -3, -1, -1, -2, -5, -5, -5, -7, -9, -7, -2, -1, -6, -9, -8, -5, -3, -3, -3, -3, -5, -6, -6, -6, -5, -3, -3, -5, -5, -5, -5, -3, -3, -6, -8, -6, -1, 0, -1, 0, 0, 0, -2, -2, 0, 0, -1, 0, 5, 6, 1, -2, -1, 1, 2, 0, 0, 1, 2, 2, 1, 1, 0, -1, 0, 7, 9, 6, 1, 1, 4, 5, 5, 5, 5, 2, 1, 6, 9, 6, 0, 0, 1, 0, -2, 0, 6, 9, 9, 6, 2, 2, 8, 12, 8, 2, 4, 7, 7, 5, 5, 7, 5, 0, 0, 2, 4, 1, 0, 4, 6, 5, 1, 0, 0, 0, 2, 5, 4, 2, 2, 4, 2, 1, 1, 2, 1, 0, 0, 0, 1, 1, 0, 0, -1, 0, 1, 2, 0, -5, -5, -1, 0, 0, 0, -2, -6, -7, -3, -2, -3, -6, -3, -2, -5, -7, -6, -2, -2, -6, -9, -10, -10, -9, -9, -10, -12, -12, -8, -5, -3, -6, -9, -10, -7, -5, -6, -9, -13, -13, -8, -5, -6, -12, -14, -12, -9, -9, -10, -10, -9, -8, -7, -9, -13, -13, -9, -8, -10, -13, -14, -12, -8, -7, -9, -12, -12, -9, -6, -7, -10, -13, -10, -5, -2, -6, -12, -14, -12, -8, -7, -6, -6, -7, -10, -13, -13, -10, -10, -12, -12, -8, -6, -7, -12, -14, -14, -10, -7, -5, -5, -8, -14, -17, -15, -12, -10, -12, -10, -8, -8, -10, -10, -9, -10, -10, -7, -1, 0, -5, -9, -8, -2, 0, -1, -5, -8, -9, -7, -1, 0, -1, -5, -6, -3, -1, -1, -1, -1, -2, -3, -3, -1, 0, -1, -2, 0, 2, 4, 1, 0, 0, 2, 5, 6, 5, 5, 5, 4, 1, 0, 0, 0, 0, 0, 0, 1, 6, 7, 5, 1, 0, 2, 4, 4, 4, 6, 7, 6, 2, 2, 2, 0, -1, -1, 0, 1, 4, 7, 8, 5, 2, 4, 7, 8, 7, 9, 12, 8, 2, 4, 7, 5, -1, 0, 4, 5, 6, 9, 8, 2, 2, 11, 13, 7, 2, 7, 11, 9, 6, 6, 8, 8, 8, 8, 7, 6, 6, 7, 6, 2, 4, 7, 7, 4, 2, 5, 7, 9, 14, 14, 6, 0, 2, 7, 5, 2, 6, 11, 11, 6, 6, 8, 9, 6, 2, 5, 9, 13, 11, 8, 9, 9, 6, 2, 6, 12, 12, 2, -1, 4, 9, 7, 1, 4, 8, 9, 5, 2, 5, 8, 8, 7, 6, 2, 1, 2, 6, 7, 5, 4, 4, 6, 5, 1, 1, 2, 4, 2, 0, 0, 2, 6, 6, 4, 2, 2, 5, 7, 8, 5, 1, 2, 6, 7, 4, 0, 2, 5, 4, 0, 0, 5, 7, 4, 1, 5, 9, 7, 1, 0, 5, 6, 1, 0, 5, 7, 5, 2, 5, 7, 6, 4, 4, 5, 5, 4, 4, 6, 8, 7, 2, 5, 11, 11, 4, 4, 12, 15, 7, 0, 2, 9, 9, 6, 6, 8, 6, 2, 6, 14, 14, 7, 2, 6, 8, 7, 5, 6, 7, 7, 6, 8, 9, 5, 1, 4, 7, 8, 6, 2, 1, 1, 4, 4, 0, -1, 2, 6, 4, 0, 2, 6, 4, 0, 0, 1, 0, -1, -1, 0, 0, 0, 0, 0, -1, -3, -2, 0, 0, -1, 0, 2, 2, 0, 0, 2, 2, 0, -1, 0, 4, 4, 2, 4, 5, 5, 4, 2, 2, 5, 6, 6, 5, 5, 7, 5, 1, 2, 6, 7, 6, 7, 8, 4, -1, 0, 7, 8, 6, 5, 5, 4, 2, 4, 5, 6, 5, 0, 0, 1, 5, 4, 1, 4, 7, 6, 2, 4, 6, 7, 4, 1, 1, 2, 4, 5, 6, 7, 8, 8, 6, 5, 6, 8, 11, 11, 9, 8, 6, 2, 2, 5, 6, 4, 5, 7, 8, 5, 4, 6, 7, 6, 5, 7, 8, 8, 7, 7, 7, 5, 2, 4, 5, 4, 1, 4, 7, 8, 2, -1, -1, 2, 7, 4, -3, -6, -1, 2, 4, 4, 1, -2, -5, -2, 0, 0, -2, -2, 0, 0, -1, -1, 1, 1, 0, -2, 0, 6, 7, 4, 0, -3, -1, 1, 2, 0, -2, -1, 0, -1, -1, -1, -3, -7, -5, -1, -2, -7, -7, -3, -3, -6, -6, -2, -2, -6, -6, -1, -1, -6, -9, -7, -5, -6, -9, -8, -8, -10, -10, -8, -7, -8, -9, -9, -10, -10, -8, -7, -7, -7, -7, -8, -8, -8, -8, -13, -16, -15, -10, -5, -2, -3, -7, -9, -9, -8, -7, -6, -6, -7, -9, -10, -8, -3, -3, -7, -10, -9, -6, -6, -8, -8, -8, -8, -8, -8, -7, -8, -9, -9, -9, -12, -14, -10, -6, -7, -12, -13, -9, -6, -8, -10, -10, -10, -12, -13, -13, -12, -13, -14, -13, -12, -12, -14, -15, -14, -14, -15, -17, -16, -14, -15, -20, -20, -17, -16, -17, -22, -24, -22, -18, -16, -16, -16, -17, -18, -20, -17, -16, -17, -21, -21, -21, -22, -23, -22, -22, -22, -20, -18, -21, -24, -23, -18, -17, -18, -20, -21, -24, -26, -26, -25, -24, -23, -23, -24, -25, -25, -22, -17, -16, -20, -24, -28, -26, -23, -20, -21, -25, -24, -18, -13, -15, -21, -25, -24, -21, -18, -18, -20, -20, -18, -18, -21, -21, -18, -15, -16, -18, -18, -15, -13, -15, -18, -21, -18, -16, -16, -15, -14, -12, -10, -10, -10, -12, -14, -14, -14, -13, -12, -10, -10, -12, -12, -9, -8, -7, -9, -9, -8, -5, -5, -7, -9, -7, -1, 0, -1, -6, -7, -6, -2, -2, -5, -6, -3, 0, 1, -1, -2, -2, -2, -3, -2, 1, 2, 0, -5, -5, 0, 4, 5, 2, 0, 0, -1, -1, 0, 1, -1, -3, -5, -2, 0, 1, 1, 0, -5, -3, 2, 7, 7, 2, 0, 1, 4, 6, 4, 0, 0, 5, 8, 6, 1, 0, 2, 5, 5, 4, 2, 2, 5, 7, 7, 5, 5, 7, 9, 8, 8, 11, 13, 11, 7, 7, 11, 11, 8, 7, 8, 11, 13, 12, 9, 8, 11, 12, 12, 11, 11, 13, 15, 14, 9, 8, 11, 14, 15, 12, 9, 11, 15, 16, 13, 12, 13, 14, 12, 11, 13, 14, 13, 9, 9, 13, 14, 12, 8, 8, 9, 8, 7, 8, 9, 8, 6, 6, 7, 6, 5, 7, 9, 7, 2, 6, 12, 9, 4, 1, 5, 6, 5, 5, 5, 2, 2, 5, 4, 0, 0, 2, 5, 6, 7, 7, 6, 5, 5, 7, 7, 4, 1, 4, 5, 2, 0, 1, 4, 1, -1, -1, 1, 4, 1, -1, -1, 0, 0, -2, -2, -2, -2, -3, -3, -3, -2, -2, -3, -3, -2, -3, -7, -8, -6, -1, -1, -5, -6, -5, -2, -2, -5, -6, -3, 0, 0, 0, -2, -2, -1, -1, -3, -5, -3, 0, -1, -3, -6, -5, -5, -5, -5, -6, -8, -8, -8, -8, -9, -9, -8, -8, -8, -7, -7, -7, -7, -5, -3, -5, -8, -8, -7, -6, -6, -6, -6, -6, -8, -8, -7, -5, -5, -6, -5, -2, -2, -5, -6, -7, -7, -6, -3, -3, -6, -6, -1, 1, -1, -6, -3, 0, 0, -2, -2, -1, -3, -7, -6, 0, 0, -3, -5, 0, 6, 5, 0, -1, 1, 4, 4, 0, 0, 0, 2, 2, 1, 0, 0, 2, 5, 2, -1, -2, 1, 8, 9, 5, 1, 2, 7, 9, 8, 8, 8, 8, 7, 8, 12, 11, 6, 5, 8, 12, 12, 11, 11, 12, 12, 11, 11, 12, 12, 12, 14, 17, 17, 14, 11, 14, 21, 22, 19, 15, 17, 22, 22, 17, 15, 16, 17, 16, 14, 14, 14, 15, 17, 21, 22, 19, 16, 15, 15, 15, 17, 19, 19, 15, 12, 12, 16, 20, 15, 11, 14, 21, 21, 13, 8, 12, 16, 17, 15, 14, 15, 17, 19, 17, 14, 13, 15, 17, 16, 13, 12, 14, 19, 20, 19, 16, 15, 15, 16, 15, 13, 13, 15, 15, 13, 12, 13, 13, 9, 7, 11, 14, 15, 11, 5, 2, 6, 9, 8, 6, 6, 8, 12, 9, 6, 7, 9, 11, 7, 2, 2, 5, 6, 4, 0, 1, 6, 8, 6, 1, 2, 5, 5, 4, 2, 2, 1, 2, 5, 4, 1, 0, 1, 2, 4, 4, 2, 1, 1, 2, 0, 0, 1, 2, 0, 0, 1, 4, 2, 1, 1, 0, -3, -1, 1, 0, -2, -1, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -2, -3, -2, 0, 0, 0, -2, -2, 0, 1, 0, -1, -1, 0, 0, -2, -3, -2, -2, -2, -2, -1, -2, -3, -3, -2, -2, -5, -6, -8, -8, -7, -3, -2, -2, -5, -6, -6, -5, -3, -6, -9, -12, -10, -9, -13, -16, -13, -5, -2, -9, -15, -15, -13, -12, -12, -10, -10, -12, -12, -14, -16, -16, -13, -13, -15, -16, -18, -20, -17, -14, -15, -20, -21, -18, -18, -18, -17, -16, -20, -23, -22, -17, -16, -18, -18, -17, -14, -14, -17, -21, -22, -18, -18, -23, -24, -23, -21, -22, -22, -22, -23, -23, -21, -18, -17, -18, -20, -20, -18, -18, -20, -21, -22, -21, -21, -22, -22, -20, -20, -22, -23, -23, -23, -23, -22, -22, -23, -24, -23, -22, -22, -24, -25, -25, -24, -24, -25, -26, -24, -22, -22, -24, -25, -23, -22, -23, -25, -24, -21, -21, -22, -21, -21, -23, -28, -30, -28, -26, -26, -26, -23, -22, -23, -25, -25, -25, -24, -23, -21, -20, -20, -21, -22, -22, -22, -18, -15, -14, -17, -21, -22, -18, -14, -15, -17, -20, -18, -17, -17, -17, -16, -13, -13, -16, -18, -16, -10, -9, -12, -14, -15, -16, -16, -13, -10, -13, -14, -13, -12, -13, -13, -12, -13, -14, -10, -8, -9, -10, -9, -10, -13, -12, -9, -10, -13, -12, -9, -9, -12, -12, -8, -6, -7, -7, -7, -7, -8, -8, -5, -3, -5, -7, -7, -5, -2, 0, 0, -1, 0, 1, 1, 0, -1, -1, -5, -7, -3, 4, 4, 0, -3, -2, 0, 2, 4, 4, 1, 1, 1, 0, 0, 1, 2, 0, -2, -3, -1, 1, 2, 0, 0, 0, 2, 4, 2, 1, 1, 0, 0, 1, 5, 4, 0, 0, 1, 5, 6, 4, 2, 4, 7, 7, 2, 0, 4, 7, 5, 0, 0, 5, 8, 7, 7, 8, 9, 7, 5, 6, 9, 12, 12, 11, 11, 11, 12, 13, 14, 14, 13, 12, 9, 8, 12, 14, 14, 11, 9, 12, 13, 11, 9, 9, 8, 7, 11, 15, 14, 11, 11, 13, 14, 14, 14, 12, 11, 12, 13, 12, 9, 12, 15, 14, 11, 9, 11, 9, 8, 11, 13, 12, 9, 9, 12, 14, 12, 8, 8, 12, 15, 13, 7, 4, 8, 13, 13, 8, 9, 13, 12, 8, 8, 12, 12, 7, 6, 8, 9, 8, 7, 7, 7, 7, 8, 9, 7, 4, 1, 4, 6, 7, 7, 7, 6, 5, 6, 8, 8, 7, 7, 7, 5, 2, 2, 4, 5, 7, 9, 9, 8, 8, 8, 7, 4, 2, 6, 9, 7, 2, 1, 6, 8, 6, 2, 1, 2, 4, 4, 1, 0, 0, 2, 4, 2, 1, 0, 0, -1, -1, 0, 0, -2, -5, -3, -1, 0, 0, -1, -2, -2, -2, -1, -1, -2, -3, -6, -7, -7, -6, -7, -9, -10, -9, -9, -8, -6, -3, -2, -3, -7, -8, -8, -6, -6, -8, -9, -7, -5, -5, -6, -7, -8, -9, -9, -9, -10, -13, -13, -10, -10, -12, -14, -14, -13, -10, -9, -10, -14, -14, -12, -12, -13, -14, -13, -13, -15, -15, -12, -12, -14, -15, -12, -9, -12, -14, -14, -10, -8, -8, -10, -12, -13, -13, -12, -12, -12, -13, -13, -13, -12, -9, -8, -12, -15, -15, -12, -9, -12, -13, -10, -8, -7, -8, -9, -9, -7, -3, -2, -5, -6, -7, -7, -7, -7, -7, -9, -10, -9, -7, -7, -9, -10, -9, -7, -5, -3, -3, -5, -6, -6, -3, -2, -1, -2, -3, -6, -5, -2, 0, 0, -1, -1, -1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 1, 2, 4, 2, 1, 1, 2, 2, 4, 5, 4, 1, 1, 5, 6, 4, 5, 8, 8, 6, 7, 8, 8, 7, 8, 9, 8, 8, 11, 11, 7, 7, 9, 12, 12, 11, 11, 11, 9, 11, 14, 16, 13, 9, 11, 14, 13, 9, 8, 9, 9, 7, 5, 6, 8, 9, 9, 9, 9, 11, 11, 11, 11, 9, 6, 5, 8, 11, 11, 11, 13, 13, 9, 7, 8, 11, 11, 8, 5, 4, 7, 8, 7, 6, 8, 12, 11, 6, 5, 6, 8, 8, 8, 8, 7, 5, 5, 5, 4, 4, 6, 8, 6, 2, 0, 1, 2, 2, 4, 6, 6, 4, 2, 6, 8, 4, 0, 1, 6, 7, 2, 2, 5, 5, 1, 0, 0, 2, 2, 4, 4, 5, 5, 5, 5, 5, 5, 2, 1, 0, 1, 2, 1, 0, 1, 4, 2, 0, 0, 2, 1, -1, 0, 5, 4, -1, -2, 0, 1, 1, 1, 0, -1, 0, 5, 6, 1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -2, -3, -3, -3, -3, -3, -1, 0, -1, -2, -2, -1, -2, -3, -5, -5, -6, -6, -5, -3, -3, -3, -3, -3, -5, -5, -5, -3, -3, -3, -3, -3, -2, -2, -3, -6, -5, -2, -1, -1, -2, -5, -7, -8, -6, -2, -2, -5, -5, -3, -3, -7, -8, -5, -1, -3, -9, -9, -5, 0, -2, -7, -7, -7, -7, -8, -8, -8, -8, -8, -8, -7, -7, -6, -6, -5, -5, -5, -6, -8, -9, -7, -5, -5, -7, -7, -6, -8, -9, -7, -5, -7, -10, -9, -7, -8, -10, -9, -5, -3, -7, -8, -7, -6, -7, -8, -8, -8, -7, -7, -6, -7, -9, -10, -9, -7, -5, -3, -6, -9, -10, -8, -6, -6, -7, -7, -6, -2, -1, -7, -14, -13, -6, -3, -7, -8, -6, -6, -7, -7, -6, -7, -10, -10, -9, -8, -5, -3, -7, -12, -12, -7, -3, -6, -8, -9, -9, -12, -13, -12, -12, -15, -16, -13, -10, -10, -9, -6, -5, -8, -9, -7, -6, -8, -10, -10, -9, -9, -8, -6, -6, -7, -7, -6, -5, -7, -9, -10, -9, -9, -10, -12, -12, -9, -7, -7, -10, -12, -8, -6, -8, -10, -9, -7, -8, -9, -8, -7, -8, -9, -5, -1, -2, -3, 0, 4, 1, -3, -3, -1, 0, -3, -2, 0, 0, 0, -1, 0, 1, 0, 0, 0, 1, 2, 0, -1, -1, 0, 5, 4, 0, -1, 1, 2, 0, 0, 7, 11, 6, 0, 1, 5, 6, 4, 2, 0, -2, -3, 1, 6, 4, 0, 2, 5, 2, 2, 7, 9, 5, 1, 6, 9, 9, 7, 7, 7, 7, 7, 7, 6, 6, 8, 11, 11, 11, 11, 12, 11, 8, 7, 8, 11, 11, 11, 8, 6, 4, 5, 8, 9, 7, 4, 5, 6, 8, 11, 14, 14, 9, 5, 5, 7, 7, 7, 9, 9, 7, 6, 7, 8, 9, 9, 9, 9, 8, 7, 7, 8, 9, 11, 12, 9, 6, 5, 8, 9, 7, 6, 7, 7, 5, 4, 4, 5, 5, 4, 4, 6, 8, 7, 4, 2, 4, 4, 1, 0, 0, 1, 0, 0, 1, 4, 2, 0, 0, -1, -1, 0, 0, 0, -1, -2, -2, 0, 1, 1, 0, 0, 0, 0, -1, -1, -1, -1, -2, -2, -2, -2, -5, -7, -5, -1, -2, -7, -9, -7, -2, -1, -5, -8, -7, -3, -1, -3, -7, -7, -6, -6, -7, -8, -8, -8, -8, -5, -2, -3, -7, -12, -12, -10, -8, -7, -7, -8, -10, -8, -7, -8, -10, -9, -6, -7, -10, -10, -8, -7, -9, -12, -12, -10, -9, -8, -8, -8, -10, -12, -10, -7, -3, -7, -12, -13, -8, -5, -7, -10, -10, -8, -7, -7, -9, -9, -9, -7, -5, -2, -2, -6, -9, -7, -2, -1, -6, -10, -9, -5, -3, -6, -8, -9, -9, -9, -8, -6, -6, -7, -6, -3, -2, -2, -5, -6, -7, -7, -6, -6, -5, -6, -8, -9, -7, -3, -6, -9, -7, -1, -1, -9, -14, -10, -6, -6, -8, -7, -5, -5, -6, -6, -6, -7, -7, -6, -6, -8, -8, -5, -2, -5, -7, -6, -6, -6, -6, -7, -8, -7, -5, -5, -7, -6, -3, -2, -6, -8, -5, -1, -1, -5, -7, -7, -5, -2, -2, -5, -7, -3, 0, 2, 0, -1, 0, 4, 1, -2, -2, 1, 2, 0, -1, 0, 2, 2, 0, 0, 1, 2, 4, 4, 2, 0, 0, 4, 5, 2, 0, 0, 1, 2, 4, 5, 4, 1, 1, 2, 2, 1, 2, 4, 1, 0, 2, 6, 5, 4, 5, 4, 0, 0, 4, 5, 1, 1, 5, 5, 2, 2, 4, 2, 0, 1, 2, 2, 2, 1, 1, 4, 8, 11, 7, 4, 4, 7, 8, 7, 6, 6, 7, 6, 5, 4, 4, 5, 5, 5, 4, 4, 5, 6, 7, 7, 6, 5, 4, 6, 8, 9, 8, 7, 7, 8, 9, 8, 7, 5, 5, 4, 4, 1, 0, 5, 12, 14, 8, 2, 4, 6, 6, 6, 7, 8, 7, 5, 2, 1, 2, 4, 5, 4, 4, 2, 1, 2, 6, 8, 6, 1, 1, 4, 6, 6, 4, 1, 0, 0, 2, 4, 1, 0, 1, 6, 5, 0, -2, -2, -2, -2, -2, -1, -1, -2, -2, 0, -1, -2, -3, -1, 0, 0, 0, -2, 0, 0, 0, -2, -2, -1, -2, -3, -2, -1, -1, -2, -3, -6, -7, -6, -5, -5, -6, -6, -5, -3, -2, -2, -6, -8, -5, -1, -5, -8, -6, -2, -2, -5, -5, -5, -7, -8, -5, -3, -5, -6, -6, -6, -6, -3, -6, -10, -12, -9, -9, -10, -10, -7, -5, -7, -9, -10, -9, -8, -7, -6, -5, -5, -5, -6, -7, -9, -8, -5, 0, -1, -6, -8, -5, -1, -1, -6, -7, -7, -6, -6, -6, -6, -3, -2, -3, -6, -7, -3, 0, -1, -5, -7, -6, -3, -2, -1, -1, -2, -3, -3, -3, -2, -2, -3, -2, 0, 0, -2, -5, -5, -3, -3, -1, 0, -1, -3, -2, 0, 0, -1, -1, 0, 0, 0, 0, 1, 0, -1, -3, -3, -1, 0, 0, -1, -2, -1, 0, 1, 0, 0, 1, 4, 5, 5, 5, 0, -1, 0, 6, 6, 0, -2, 0, 5, 6, 5, 2, 2, 4, 5, 4, 2, 2, 4, 2, 0, 0, 1, 5, 6, 4, 0, 0, 1, 2, 2, 1, 1, 2, 2, 2, 4, 4, 2, 1, 2, 5, 5, 1, 0, 4, 5, 4, 1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, -1, -1, 0, 1, 1, 0, -2, -3, -1, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, -1, -2, -2, -2, -1, 0, 0, 0, 0, 0, 0, -1, -2, -1, 1, 2, 0, -5, -6, -2, -1, -2, -3, -2, -1, -2, -2, 0, 0, -2, -3, -2, -2, -3, -3, -2, -1, -2, -3, -3, -1, 0, 0, -1, -1, -1, -3, -5, -2, 0, -2, -7, -7, -2, 0, -2, -2, -2, -3, -3, -1, 0, 0, -2, -3, -5, -3, 0, 2, 0, -3, -2, 1, 2, 0, 0, 1, 1, 0, 0, 1, 2, 2, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, -2, -2, 0, 1, 0, 0, 1, 2, 0, -1, 0, 1, 1, 0, 0, 4, 6, 2, -1, -1, 1, 1, 0, 0, 0, 0, 0, 1, 0, -1, -3, 0, 4, 4, 0, -2, 0, 2, 2, 1, 1, 0, -1, -1, 2, 5, 1, -3, -2, 0, -2, -5, -2, 2, 5, 2, 0, -1, 0, 4, 5, 0, -3, -1, 0, 0, -3, -1, 0, -2, -7, -6, -2, -1, -5, -7, -6, -3, -3, -6, -6, -6, -5, -3, -2, -2, -3, -5, -6, -7, -7, -6, -6, -7, -7, -7, -8, -8, -8, -7, -7, -8, -8, -6, -6, -8, -12, -12, -9, -7, -6, -7, -10, -13, -12, -9, -9, -10, -9, -8, -9, -12, -12, -9, -8, -10, -14, -14, -13, -12, -13, -14, -15, -15, -15, -13, -10, -10, -14, -16, -14, -10, -9, -12, -14, -15, -13, -10, -8, -9, -13, -14, -13, -12, -10, -10, -12, -12, -9, -9, -10, -13, -12, -8, -7, -8, -12, -12, -8, -7, -8, -10, -10, -8, -6, -7, -8, -9, -8, -6, -5, -3, -6, -9, -9, -8, -6, -5, -3, -3, -5, -7, -8, -7, -6, -7, -8, -7, -5, -3, -3, -5, -7, -7, -6, -2, -2, -3, -6, -8, -10, -9, -6, -5, -7, -7, -5, -5, -6, -6, -5, -6, -6, -3, 0, -1, -5, -6, -5, 0, 0, 0, -2, -5, -6, -3, 0, 1, 0, -2, -5, -3, -1, 0, 0, -1, -2, -3, -3, -2, -3, -5, -3, 0, 1, 1, -1, -3, -2, 0, 2, 1, 0, 0, 1, 0, -1, -2, -1, 0, -2, -3, -3, -1, 0, 1, 0, -1, -2, -1, 0, 0, 1, 1, 1, 0, 0, 0, 1, 0, -2, -3, -1, 0, 2, 4, 2, 0, 0, 1, 4, 4, 4, 6, 7, 4, 0, 2, 5, 1, -2, -1, 1, 2, 2, 4, 2, 1, 4, 7, 6, 0, 0, 1, 4, 2, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, -1, 0, 2, 0, -2, -1, 0, 0, 0, 4, 4, -1, -6, -2, 1, 0, -1, 0, 2, 1, -1, -1, 1, 2, 0, -2, -1, 5, 6, 2, 0, 1, 4, 0, -1, 0, 6, 4, -2, -5, 0, 4, 2, 0, 0, 1, 1, 1, 0, 0, 1, 2, 4, 2, 0, -2, 0, 5, 4, 0, -1, 0, 4, 1, -1, -2, 0, 0, -1, -3, -1, 1, 4, 2, 0, 0, 0, 0, 1, 4, 2, 0, -1, 0, 2, 0, -1, 0, 0, 0, -1, 0, 4, 2, 0, 1, 5, 6, 2, 0, 4, 5, 2, 0, 0, 5, 4, 1, 2, 5, 4, 1, 1, 4, 5, 2, 1, 2, 5, 5, 2, 0, 4, 7, 5, 1, 4, 9, 8, 0, -2, 2, 7, 6, 2, 2, 5, 2, 0, 4, 8, 6, 1, 1, 5, 6, 5, 4, 6, 6, 4, 4, 7, 7, 4, 1, 4, 6, 6, 4, 2, 2, 2, 4, 2, 0, 0, 2, 5, 2, 0, 2, 5, 4, 1, 2, 2, 1, 0, 0, 0, 0, 0, 2, 1, -1, -1, 0, 1, 0, -1, 1, 2, 0, -3, 0, 2, 0, -3, -3, 0, 0, -2, -2, 0, 1, 0, -1, 0, 0, 0, 1, 2, 0, 0, 2, 1, 0, 0, 2, 2, 2, 5, 4, -2, -6, 0, 5, 2, 0, 0, 1, 0, -1, 0, 0, 0, -1, -3, -3, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 2, 5, 5, 2, 0, 0, 2, 5, 4, 2, 4, 4, 1, 0, 0, 1, 1, 1, 2, 2, 0, -1, -1, 1, 1, 0, 0, 2, 2, 0, 0, 0, 0, 0, 1, 1, -1, -1, 2, 5, 2, 0, -2, -1, 1, 2, 0, -5, -5, 0, 2, 2, 1, 0, -2, -3, -1, 0, 0, -2, -1, 0, 0, -1, 0, 1, 1, -1, -3, 0, 4, 5, 2, 0, -1, -1, 0, 2, 1, 0, 0, 0, 1, 1, 1, -1, -2, -1, 0, 0, -2, -1, 0, 0, 0, 0, 1, 0, -1, 0, 1, 0, -5, -3, 0, 1, -2, -3, -1, -1, -3, -3, -2, -3, -5, -6, -6, -5, -3, -2, -3, -5, -5, -3, -5, -5, -2, -2, -6, -9, -8, -3, 0, -1, -3, -5, -5, -3, -3, -3, -2, -1, -2, -5, -3, -1, 0, -1, -3, -3, -2, -2, -3, -2, -1, -1, -3, -3, -2, -1, -2, -3, -2, -2, -3, -5, -3, 0, 0, -3, -6, -3, -1, -1, -3, -3, -3, -3, -5, -5, -3, -3, -5, -3, -1, 0, -2, -3, -2, -2, -3, -5, -3, -2, -6, -7, -6, -3, -5, -6, -7, -7, -7, -6, -5, -5, -7, -8, -8, -6, -6, -7, -8, -8, -8, -9, -10, -8, -7, -9, -12, -8, -6, -9, -13, -10, -7, -8, -12, -10, -8, -9, -13, -13, -10, -9, -10, -12, -13, -13, -12, -9, -8, -8, -10, -13, -14, -13, -10, -8, -10, -13, -14, -9, -7, -8, -13, -15, -14, -12, -12, -13, -13, -12, -12, -14, -14, -13, -10, -10, -12, -13, -13, -10, -9, -10, -13, -14, -13, -10, -9, -9, -9, -9, -8, -8, -8, -9, -12, -13, -12, -10, -9, -9, -9, -10, -12, -10, -8, -8, -9, -9, -7, -6, -7, -9, -9, -7, -5, -3, -5, -8, -9, -8, -6, -7, -9, -8, -5, -5, -7, -7, -6, -6, -7, -6, -3, -1, -3, -7, -8, -6, -5, -5, -3, -2, -2, -6, -7, -3, 0, -1, -5, -7, -5, -1, -1, -1, -2, -3, -6, -5, 0, 2, 1, 0, 0, 0, 2, 2, 0, -1, -1, 1, 2, 0, -1, 0, 1, 2, 1, 0, -3, -3, 0, 4, 1, -2, -5, -1, 1, 0, -1, 0, 4, 2, 0, 0, 2, 1, 0, -1, 0, 0, 1, 2, 0, 0, 0, 2, 4, 1, 0, 2, 6, 4, 0, -1, 2, 5, 2, -1, 0, 1, 4, 2, 1, 2, 4, 4, 2, 2, 4, 4, 4, 2, 4, 6, 6, 4, 4, 5, 4, 1, 2, 6, 5, 0, 0, 4, 6, 1, 0, 4, 8, 5, 0, 1, 8, 7, 0, -1, 0, 1, 1, 2, 2, 0, 0, 2, 1, 0, 0, 1, 2, 2, 1, 1, 1, 2, 4, 4, 2, 2, 4, 5, 5, 2, 1, 2, 2, 1, 2, 4, 4, 2, 2, 2, 4, 5, 5, 2, 0, 1, 4, 4, 1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 1, 0, -1, -1, 1, 1, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 2, 2, -1, -2, 1, 5, 4, 0, 0, 1, 1, 1, 4, 4, 1, 0, 0, 1, 1, 1, 2, 1, 0, -1, 0, 2, 1, 0, -1, -1, -1, -1, -1, -2, -5, -3, -1, 0, -1, -1, 0, 0, 0, 0, 1, 2, 0, 0, 1, 1, 0, 0, -1, -1, -2, -2, -1, -1, -2, -2, -2, -1, 0, 0, 0, -1, -2, -1, 0, 0, -1, -2, -5, -3, -1, 0, 0, -2, -5, -2, 0, 0, 0, -2, -2, -3, -3, -2, -1, 0, 0, -1, -1, -1, 0, 1, 1, -1, -3, -2, 0, 0, 0, 0, 1, 1, 1, 1, 1, 0, -1, -1, 0, -1, -1, 0, 0, 0, -3, -2, 0, 0, -1, -2, -1, -1, -2, -3, -3, -1, 0, 0, -1, -2, -2, 0, 0, 0, -5, -7, -3, 0, 0, -2, -2, -1, 0, 0, 0, -1, -5, -3, 0, 0, -3, -5, -1, 0, -1, -5, -2, 1, 0, -3, -5, -1, 0, -1, -1, 0, 1, 0, -2, -2, -1, 0, 0, -1, -2, -3, -3, -2, -1, -2, -2, -1, 0, 0, 0, -2, -2, -1, 0, -1, -3, -3, -1, 0, 0, 0, 0, 0, 1, 2, 0, -1, -1, 0, 0, 0, 1, 0, -1, -2, 0, 0, 0, -1, 0, 0, 0, -1, -2, -1, 0, 0, 0, -1, -1, 0, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 2, 1, 0, -1, 0, 4, 4, 0, 1, 5, 6, 2, 0, 0, 1, 2, 1, 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 0, -1, 0, 2, 4, 0, -2, -1, 0, 0, -1, -2, -2, -2, -2, -2, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, 0, -1, 0, 0, 1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 1, 5, 4, 0, -2, 0, 1, 0, -1, 0, 2, 1, -1, -1, 0, 2, 1, 0, 0, 2, 4, 4, 1, 0, 0, 1, 1, 0, 1, 4, 5, 2, 0, -1, 0, 4, 4, 0, -1, -1, 0, 2, 4, 1, -1, -1, 0, 1, 0, -1, -1, 0, 0, -2, -2, -2, -2, -2, -3, -3, -3, -2, -1, -2, -5, -5, -2, -1, -2, -2, -1, -1, -3, -3, -1, -2, -6, -7, -5, -2, -3, -6, -5, -2, -2, -3, -3, -1, -1, -2, -2, -2, -3, -5, -6, -6, -7, -8, -8, -6, -3, -3, -6, -7, -7, -5, -5, -7, -8, -6, -3, -3, -3, -5, -6, -7, -7, -6, -5, -5, -6, -7, -8, -8, -7, -7, -8, -10, -9, -6, -7, -9, -9, -5, -2, -6, -9, -9, -7, -6, -7, -8, -8, -6, -5, -5, -6, -7, -7, -6, -6, -6, -6, -5, -5, -6, -7, -7, -6, -6, -6, -7, -7, -7, -7, -9, -9, -7, -3, -3, -6, -6, -5, -5, -5, -3, -3, -6, -8, -8, -7, -7, -7, -6, -5, -6, -8, -6, -3, -5, -7, -6, -3, -3, -6, -7, -7, -7, -6, -3, -3, -6, -8, -7, -6, -6, -6, -7, -8, -8, -7, -7, -6, -6, -7, -8, -7, -3, -2, -5, -7, -5, -1, -2, -6, -9, -8, -6, -5, -6, -8, -8, -3, -2, -5, -7, -7, -3, -3, -6, -8, -7, -3, -1, 0, -2, -6, -8, -7, -2, 0, -1, -3, -3, -2, -1, -1, -1, -1, -2, -2, -2, -1, -1, -1, 0, 0, -1, 0, 1, 1, -1, -1, 2, 5, 1, -1, 0, 5, 6, 1, 0, 1, 5, 4, 1, 0, 1, 1, 0, 0, 2, 2, 2, 2, 4, 4, 4, 4, 2, 2, 2, 4, 2, 2, 4, 2, 0, 1, 5, 4, 0, 0, 5, 8, 4, -1, 0, 2, 4, 4, 2, 1, 1, 1, 4, 4, 2, 1, 1, 2, 1, 0, 0, 2, 4, 4, 2, 2, 4, 4, 2, 1, 2, 4, 2, 0, 0, 4, 4, 1, 0, 1, 5, 5, 2, 0, 0, 0, 1, 1, 0, 0, 1, 4, 4, 1, 1, 4, 2, 0, 0, 0, 0, 0, 1, 1, 0, 0, 2, 4, 2, 0, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, -1, 0, -1, -3, -2, 0, 1, -1, -3, -1, 0, 0, -1, -2, -3, -3, -2, -2, -2, -2, -1, -1, -1, -1, -1, -1, -2, -2, -1, -1, -3, -6, -5, -2, -1, -3, -5, -3, -2, -3, -3, -2, 0, 0, -2, -5, -3, -1, -1, -2, -2, -2, -3, -5, -5, -2, -1, -3, -6, -6, -3, -2, -2, -2, -2, -3, -5, -3, -2, -1, -3, -6, -7, -7, -5, -6, -8, -8, -6, -3, -5, -6, -6, -6, -6, -6, -3, -2, -2, -2, -3, -5, -5, -3, -3, -6, -6, -6, -7, -7, -5, -2, -3, -7, -7, -5, -3, -3, -6, -7, -7, -6, -3, -3, -5, -6, -3, 0, -1, -5, -5, -3, -3, -5, -5, -3, -3, -6, -7, -7, -6, -6, -7, -6, -3, -1, -2, -5, -3, -1, -1, -3, -3, -2, -3, -5, -5, -3, -2, -2, -2, -3, -6, -6, -2, -1, -1, -3, -3, -2, -1, -1, -3, -3, -2, -2, -2, -3, -2, -1, 0, -1, -3, -3, -2, -2, -2, -3, -5, -5, -2, 0, -1, -3, -5, -3, -2, -2, -2, -1, -1, -2, -2, -1, -2, -3, -3, -2, -1, -1, -2, -3, -2, -1, -2, -6, -5, -1, 0, 0, -2, -3, -3, -2, 0, 0, -2, -3, -3, -3, -3, -2, -2, -3, -3, -2, -2, -3, -3, -1, -2, -5, -6, -3, -2, -3, -5, -5, -3, -2, -2, -2, -5, -5, -5, -3, -3, -3, -5, -6, -7, -5, -2, -1, -2, -3, -3, -2, -2, -3, -3, -2, -3, -3, -2, 0, -1, -5, -7, -5, -2, -2, -3, -5, -5, -6, -6, -5, -1, 0, 0, -1, -2, -2, 0, 0, -2, -5, -5, -2, -2, -5, -5, -2, 0, -2, -3, -3, -1, 0, 0, -1, -2, -3, -3, -3, -3, -3, -1, -1, -3, -6, -5, -2, -1, -3, -5, -5, -5, -6, -3, 0, -1, -5, -7, -2, 0, -1, -6, -7, -2, -1, -3, -6, -6, -2, -2, -5, -7, -6, -5, -3, -3, -6, -6, -6, -6, -6, -7, -6, -3, -2, -5, -7, -6, -3, -2, -3, -5, -5, -6, -8, -8, -5, -3, -5, -7, -7, -5, -2, -2, -2, -3, -5, -6, -3, -2, -3, -6, -7, -5, -2, -2, -5, -7, -7, -3, -1, -3, -6, -5, -1, -2, -6, -5, -2, -2, -5, -5, -2, -2, -3, -2, -1, -1, -3, -5, -3, -2, -1, -2, -5, -7, -6, -3, -3, -5, -3, 0, 0, -2, -3, -1, 0, -2, -2, -2, -3, -5, -3, -2, -2, -3, -2, 0, -1, -5, -5, -1, 0, -1, -3, -2, -1, -1, -2, -1, 0, -1, -2, -2, -1, -1, -2, -2, 0, 0, 0, 0, 1, 1, 0, -1, -1, 1, 5, 4, 0, -2, -2, 0, 2, 1, 0, 0, 1, 1, 0, -1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 2, 4, 1, 0, 0, 1, 1, 1, 1, 0, -1, -1, 0, 0, -1, -1, -1, 0, 0, 0, 2, 1, 0, 1, 2, 0, -1, 0, 4, 2, -1, 0, 4, 4, 0, 0, 1, 1, 0, 1, 1, 0, 0, 1, 4, 2, 1, 1, 2, 2, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 1, 2, 1, 0, 0, 2, 2, 0, 0, 1, 4, 1, 0, 1, 4, 4, 1, 0, 0, 2, 2, 0, -1, 0, 2, 2, 1, 0, 2, 4, 4, 1, 1, 5, 7, 5, 0, 0, 1, 2, 1, 0, 0, 0, 0, 1, 4, 4, 1, 0, 1, 4, 6, 6, 4, 1, 2, 4, 4, 2, 2, 4, 4, 1, 0, 2, 5, 4, 1, 1, 2, 1, 1, 2, 4, 2, 2, 4, 5, 4, 2, 4, 5, 5, 4, 4, 4, 1, 0, 5, 6, 1, -1, 1, 5, 2, 0, 2, 4, 1, 0, 5, 5, 2, 2, 6, 7, 5, 4, 6, 8, 7, 5, 5, 5, 4, 4, 5, 5, 5, 5, 7, 7, 5, 4, 5, 5, 4, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 1, 0, 0, 2, 2, 0, -1, -1, 1, 2, 1, 1, 2, 2, 1, 0, 1, 1, 0, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -2, -2, 1, 4, 0, -5, -5, -1, 0, -3, -3, -2, -3, -6, -6, -2, 0, 0, 0, 0, -1, -1, 0, 0, -1, -5, -2, -1, -2, -6, -5, -1, 0, -3, -5, -3, 0, 0, -1, -2, -2, -2, -2, -3, -3, -2, 0, -1, -5, -6, -3, -1, -2, -5, -5, -5, -6, -5, -2, -1, -5, -7, -3, 0, -1, -6, -6, -3, -1, -2, -5, -5, -3, -3, -3, -5, -5, -5, -3, -3, -5, -6, -7, -6, -5, -5, -5, -3, -3, -5, -5, -3, -2, -2, -2, -2, -3, -6, -8, -7, -5, -3, -3, -5, -6, -3, 0, 1, 0, -1, -3, -2, -1, -1, -1, -2, -3, -2, 0, 0, -1, -3, -2, 0, 0, -1, -2, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 1, 4, 2, 0, -1, 0, 2, 2, 0, -2, -1, 0, 0, -1, -1, 0, 1, 0, 0, 0, 2, 4, 2, 1, 0, 0, 0, 0, 0, 0, 0, 1, 2, 4, 0, 0, 1, 4, 1, 0, 1, 4, 1, -1, 0, 5, 4, 1, 2, 2, 1, 1, 4, 4, 2, 1, 2, 4, 4, 2, 2, 4, 4, 5, 5, 5, 5, 5, 6, 4, 2, 4, 6, 6, 5, 5, 5, 4, 2, 4, 5, 6, 4, 2, 2, 1, 1, 4, 6, 5, 1, 0, 2, 5, 5, 4, 2, 1, 1, 2, 4, 5, 2, 0, -1, -1, 0, 0, -1, -2, -1, -1, -1, -1, 1, 1, 0, -1, 0, 0, -1, 0, 0, 0, -2, -2, 0, 1, -1, -3, -2, -1, -1, -2, -2, -1, -2, -3, -3, -1, -1, -2, -2, -1, 0, -1, -3, -5, -3, -3, -5, -5, -5, -5, -6, -6, -3, -3, -7, -8, -5, -2, -5, -8, -7, -3, -2, -5, -8, -8, -5, -3, -6, -8, -7, -6, -7, -8, -7, -5, -6, -9, -10, -8, -7, -7, -8, -9, -9, -9, -8, -7, -7, -7, -6, -5, -6, -7, -7, -7, -8, -9, -10, -10, -9, -9, -9, -9, -10, -10, -9, -9, -9, -9, -8, -8, -8, -10, -10, -10, -9, -8, -8, -9, -10, -10, -8, -8, -10, -9, -7, -7, -9, -9, -7, -7, -8, -10, -10, -9, -7, -7, -8, -12, -12, -9, -7, -6, -6, -7, -9, -9, -8, -6, -6, -8, -10, -10, -9, -7, -6, -7, -9, -9, -8, -6, -7, -8, -8, -7, -7, -7, -8, -8, -8, -7, -6, -6, -7, -7, -5, -2, -2, -6, -7, -6, -3, -3, -3, -6, -8, -8, -6, -5, -6, -7, -7, -5, -5, -5, -6, -6, -6, -6, -7, -7, -5, -3, -3, -5, -5, -3, -3, -5, -3, -3, -5, -6, -6, -3, -5, -6, -6, -5, -5, -6, -6, -3, -3, -6, -6, -3, -2, -3, -5, -3, -2, -3, -6, -7, -6, -3, -2, -3, -6, -5, -3, -5, -5, -1, 0, -3, -5, -1, 0, -3, -6, -3, -1, -2, -6, -7, -3, -1, -2, -5, -5, -3, -1, -1, -3, -6, -5, -2, -3, -7, -6, -2, -2, -5, -3, -1, -1, -3, -5, -5, -5, -5, -3, -3, -3, -3, -3, -3, -3, -2, -1, -3, -7, -7, -3, -3, -6, -7, -5, -3, -7, -8, -6, -5, -7, -8, -5, -5, -7, -8, -6, -5, -6, -7, -6, -3, -3, -5, -6, -7, -7, -7, -6, -5, -6, -8, -9, -7, -5, -6, -7, -7, -8, -9, -9, -6, -5, -7, -7, -5, -5, -6, -5, -5, -7, -8, -5, -1, -2, -6, -7, -5, -3, -5, -6, -5, -5, -6, -6, -6, -7, -8, -8, -7, -8, -7, -3, -2, -5, -6, -5, -5, -7, -7, -5, -5, -7, -7, -5, -3, -5, -6, -6, -3, -3, -3, -5, -6, -6, -5, -3, -2, -3, -6, -7, -6, -2, -2, -3, -3, -2, -1, -1, -2, -3, -3, -1, 0, 0, -1, -1, 0, -1, -2, -2, -1, 0, -2, -2, 0, 2, 2, 1, 0, 1, 1, 0, -2, 0, 4, 2, -1, -3, -1, 0, 0, -1, -1, 0, -1, -1, 0, 2, 4, 2, 2, 2, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 2, 2, 0, -1, 0, 1, 0, 0, 0, 0, 1, 2, 1, 0, 0, 2, 2, 0, 0, 1, 0, -1, -1, 0, 0, 0, 1, 2, 1, 0, 0, 4, 6, 5, 2, 1, 2, 4, 4, 5, 5, 5, 5, 5, 4, 4, 5, 5, 5, 2, 1, 0, 1, 4, 7, 6, 4, 1, 4, 6, 6, 6, 6, 7, 6, 4, 2, 4, 4, 4, 4, 5, 5, 2, 2, 7, 8, 5, 0, 0, 4, 6, 6, 5, 2, 1, 4, 6, 5, 2, 2, 4, 5, 5, 2, 2, 2, 4, 2, 0, 0, 2, 4, 2, 1, 2, 4, 2, 0, 1, 4, 5, 4, 2, 2, 4, 4, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, -1, -1, 1, 2, 0, -1, 0, 2, 2, 0, 0, 0, -1, -1, 0, 1, 0, 0, 0, 0, 1, 0, -1, -1, -1, 0, 1, 1, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -2, -2, -1, -1, -3, -5, -3, -2, -1, 0, -1, -3, -3, 0, 0, -1, -3, -3, -2, -2, -2, -3, -3, -3, -2, -1, -1, -3, -3, -2, -1, -2, -5, -3, -1, -1, -2, -5, -5, -3, 0, 0, -1, -3, -3, -2, -3, -5, -2, -1, -2, -5, -3, -2, -2, -3, -5, -6, -5, -2, -2, -3, -3, -2, -2, -2, -3, -3, -3, -2, -1, -1, -2, -3, -3, -2, -1, -1, -2, -3, -3, -1, 0, 0, 0, 0, -1, -3, -1, 1, 0, -5, -6, 0, 6, 6, 0, -3, -1, 1, 1, 0, -1, 0, 0, -3, -5, -3, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 1, 0, 0, 0, 1, 1, 1, 1, 2, 1, 0, 0, 0, 2, 4, 2, 1, 0, 1, 1, 1, 1, 1, 0, -1, 0, 1, 2, 1, 0, 1, 2, 2, 0, 0, 2, 4, 2, 1, 1, 2, 4, 4, 2, 2, 2, 2, 2, 2, 2, 1, 0, 0, 4, 5, 1, 0, 1, 2, 1, 1, 1, 1, 1, 4, 5, 6, 4, 2, 2, 2, 2, 4, 4, 4, 1, 0, 0, 2, 6, 5, 2, 0, 2, 5, 6, 6, 5, 2, 2, 2, 2, 1, 1, 1, 2, 2, 2, 1, 0, 0, 1, 1, 4, 5, 5, 4, 2, 2, 2, 2, 1, 0, 2, 4, 2, 0, 0, 0, 1, 0, 0, 1, 2, 1, 0, -1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 1, 0, 0, 0, 4, 5, 4, 0, 0, 0, 2, 2, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 1, 1, 1, 0, 0, 0, 0, -2, -2, 0, 0, 0, 0, -1, -1, 0, 1, 1, 0, 0, 1, 0, 0, -1, 0, 0, 0, 0, 0, 1, 0, -1, -2, -1, -1, -2, -3, -1, 0, -1, -2, -2, -1, -1, -2, -1, 0, -1, -3, -3, -1, 0, 0, -2, -3, -3, -3, -2, 0, -1, -3, -5, -2, -3, -6, -6, -2, 0, -1, -3, -5, -5, -3, -3, -5, -7, -7, -7, -7, -7, -6, -6, -8, -10, -9, -6, -5, -7, -9, -9, -8, -7, -7, -8, -8, -7, -7, -7, -7, -7, -9, -10, -10, -9, -9, -9, -9, -9, -9, -10, -12, -10, -9, -9, -9, -8, -8, -9, -12, -12, -12, -10, -9, -8, -9, -10, -12, -9, -8, -8, -10, -10, -10, -10, -12, -12, -10, -10, -13, -14, -14, -13, -13, -12, -12, -13, -14, -13, -10, -9, -10, -13, -13, -13, -12, -10, -10, -12, -13, -13, -13, -12, -12, -12, -12, -13, -12, -9, -8, -9, -12, -13, -12, -12, -12, -10, -9, -10, -13, -14, -14, -12, -10, -9, -12, -13, -12, -7, -7, -10, -12, -10, -8, -8, -9, -9, -9, -9, -9, -9, -9, -8, -7, -9, -10, -10, -10, -12, -12, -10, -9, -9, -9, -9, -8, -8, -9, -10, -9, -7, -8, -9, -10, -10, -9, -8, -8, -9, -9, -9, -7, -7, -8, -9, -9, -8, -6, -5, -6, -8, -8, -7, -5, -2, -3, -6, -8, -9, -8, -6, -5, -3, -6, -7, -7, -5, -3, -3, -3, -3, -3, -5, -5, -5, -5, -5, -5, -1, 0, -2, -5, -3, -2, -2, -5, -5, -3, -2, -2, -3, -3, -3, -3, -2, -2, -2, -3, -2, -1, -1, -2, -2, -1, -1, -1, 0, 0, 0, -2, -2, -1, 0, 0, -1, -1, -1, 0, 0, 1, 0, -1, -3, -1, 0, 0, 0, 0, 1, 0, -3, -2, 0, 1, -1, -3, 0, 2, 2, 0, 0, 0, 2, 2, 0, -2, -1, 0, 0, -1, 0, 1, 0, -1, -2, 0, 1, 1, 1, 0, 0, -1, 0, 1, 1, 0, 0, 1, 0, 0, 1, 2, 0, -3, -2, 0, 1, 0, 0, 1, 1, 0, 0, 1, 2, 1, -1, 0, 4, 5, 1, -1, 0, 1, 0, -2, -1, 2, 4, 0, -2, 0, 2, 4, 1, 0, 0, 1, 1, 0, 0, 0, 1, 1, 0, 0, -1, -1, 0, 1, 0, -2, -1, 1, 2, -1, -3, -1, 1, 0, -1, -1, 1, 2, 0, 0, 0, 1, 1, 1, 2, 2, 0, -1, 0, 2, 1, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 1, 2, 0, 0, 1, 4, 2, -1, 0, 2, 4, 1, 0, 2, 2, 0, -1, 0, 4, 1, 0, -1, 1, 2, 1, 0, 2, 6, 5, 0, 0, 5, 7, 1, -2, 0, 4, 5, 2, 1, 1, 1, 0, 1, 5, 4, 0, 0, 1, 2, 1, 0, 0, 1, 1, 1, 4, 4, 1, 0, 0, 2, 1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 1, 0, -1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, -1, -2, 0, 1, 0, -2, 0, 2, 1, -2, -2, 1, 1, -1, -2, 0, 1, -1, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 4, 2, -2, -6, -1, 2, 1, -2, -1, 0, 0, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, -1, 0, 2, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, -2, 0, 1, 0, -1, -3, -3, 0, 1, 1, -2, -5, -1, 2, 4, 1, 0, 0, -1, 0, 1, 0, 0, 0, 1, 1, 0, 0, 4, 4, 0, -2, 0, 2, 2, 1, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 1, 2, 1, 0, 0, 4, 2, 0, -1, 1, 4, 1, 0, 1, 1, 0, 0, 1, 1, 0, 0, -1, -1, 0, 2, 2, 0, 0, 0, 0, 0, 1, 1, 0, -1, -1, 0, 4, 4, 0, 0, 0, 2, 2, 1, 1, 4, 2, 0, 0, 2, 5, 4, 1, 1, 2, 2, 2, 2, 5, 5, 2, 1, 2, 4, 4, 2, 1, 1, 1, 1, 2, 5, 4, 0, 0, 0, 2, 2, 1, 1, 1, 0, 0, 0, 1, 0, 0, 0, 1, 2, 0, 0, 0, 1, 1, 0, 0, 0, -1, -1, 0, 1, 0, -1, 0, 0, -1, -1, 0, 0, -1, -3, -3, -2, -2, -2, -2, -2, -2, -3, -5, -3, -2, -3, -5, -2, 0, -2, -6, -5, -1, -2, -5, -5, -3, -3, -6, -6, -5, -3, -5, -6, -6, -6, -6, -6, -5, -3, -3, -6, -8, -8, -6, -5, -5, -7, -8, -5, -1, -2, -6, -8, -8, -7, -6, -6, -6, -6, -7, -8, -8, -8, -6, -5, -6, -7, -8, -7, -6, -6, -7, -8, -8, -6, -6, -6, -6, -6, -5, -3, -3, -5, -7, -7, -7, -7, -6, -5, -5, -7, -8, -7, -6, -5, -6, -6, -5, -5, -6, -7, -7, -6, -5, -3, -3, -6, -7, -6, -5, -5, -7, -8, -7, -6, -6, -6, -6, -7, -7, -7, -6, -5, -5, -6, -8, -8, -7, -6, -6, -6, -6, -7, -8, -7, -5, -6, -8, -9, -7, -6, -6, -6, -7, -8, -9, -8, -7, -6, -6, -6, -7, -7, -6, -3, -5, -7, -8, -7, -6, -7, -8, -8, -6, -6, -6, -8, -9, -9, -7, -5, -6, -9, -12, -9, -7, -8, -10, -9, -6, -5, -6, -7, -7, -7, -7, -7, -8, -8, -6, -3, -5, -8, -7, -3, -3, -7, -8, -3, 0, -2, -9, -9, -5, -1, -5, -8, -7, -5, -5, -7, -6, -3, -3, -5, -6, -6, -5, -3, -3, -5, -5, -3, -2, -3, -3, -2, -2, -5, -5, -1, -2, -7, -8, -5, -1, -3, -7, -6, -1, -2, -6, -5, -1, 0, -5, -8, -7, -5, -5, -5, -5, -5, -5, -5, -5, -6, -5, -3, -3, -5, -6, -6, -6, -5, -2, -2, -3, -3, -3, -2, -2, -2, -2, -2, -2, -5, -5, -3, -2, -2, -3, -3, -1, 0, -1, -5, -6, -3, -2, -2, -3, -2, -2, -3, -3, -3, -3, -5, -5, -3, -5, -6, -5, -2, -1, -2, -5, -6, -3, -1, 0, -3, -6, -6, -2, 0, 0, 0, -3, -5, -2, 0, 0, -2, -2, -1, 0, 0, 0, 0, 0, -2, -2, -1, 0, 1, 1, 0, -1, -2, 0, 1, 0, -2, -3, -2, 0, -1, -2, -3, -5, -5, -2, -1, -2, -2, 0, 0, 0, 0, 0, 0, 0, -1, 0, 0, -1, -3, -2, 0, -1, -2, -2, -1, -2, -3, -2, -2, -2, -2, -2, -3, -3, -1, 0, -1, -2, -2, -2, -3, -2, -1, -2, -5, -6, -3, -1, 0, 0, -2, -3, -3, -2, -2, -1, 0, 0, -1, -2, -2, 0, 0, -1, -3, -3, -2, -2, -2, -2, -1, 0, 0, -1, 0, 0, -1, -3, -3, -2, -3, -3, -1, 0, -2, -5, -5, -2, -1, -2, -3, -3, -3, -5, -6, -6, -5, -3, -3, -2, -2, -3, -5, -3, -2, -5, -6, -3, -2, -3, -6, -3, -1, -2, -3, -3, -2, -3, -5, -2, -1, -2, -5, -3, -2, -2, -2, -2, -1, -3, -5, -3, -2, -2, -5, -5, -2, 0, -1, -3, -5, -3, -2, -2, -3, -5, -6, -6, -6, -5, -5, -5, -3, -3, -3, -5, -5, -3, -1, -1, -3, -6, -6, -5, -2, -2, -3, -3, -2, 0, 0, -1, -3, -3, -3, -3, -1, -1, -3, -5, -5, -2, -1, -2, -2, -2, -2, -3, -3, -2, -2, -3, -3, -2, -2, -3, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 0, 0, -2, -2, 0, 1, 0, -1, 0, 2, 2, 0, -1, 0, 0, 1, 1, 0, -1, -1, 0, 1, 0, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, -1, -2, -1, 1, 2, 0, -1, -1, 0, 0, -1, -1, -1, -1, -1, -1, 0, 1, 2, 1, 1, 1, 1, 4, 5, 2, 0, 0, 2, 4, 1, -1, 0, 5, 6, 4, 2, 2, 4, 4, 4, 5, 5, 2, 2, 5, 6, 4, 1, 2, 5, 5, 2, 4, 7, 6, 2, 2, 6, 6, 5, 4, 5, 6, 6, 7, 7, 5, 5, 6, 6, 5, 4, 6, 8, 7, 5, 4, 6, 8, 7, 7, 6, 5, 5, 7, 9, 8, 5, 4, 6, 7, 6, 5, 5, 6, 6, 5, 5, 5, 5, 5, 4, 2, 2, 5, 6, 5, 4, 2, 5, 5, 5, 5, 6, 5, 2, 2, 5, 6, 4, 1, 2, 5, 6, 5, 4, 4, 5, 6, 6, 6, 6, 6, 6, 7, 7, 6, 6, 5, 2, 1, 2, 4, 4, 4, 4, 4, 2, 2, 4, 5, 4, 2, 2, 5, 6, 5, 2, 2, 2, 4, 5, 5, 5, 4, 2, 2, 2, 2, 0, 0, 1, 4, 2, 0, 0, 4, 6, 4, 0, 0, 4, 4, 2, 1, 2, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 5, 5, 2, 1, 1, 4, 2, 1, 1, 2, 2, 1, 0, 0, 1, 2, 2, 2, 2, 2, 2, 2, 4, 5, 4, 2, 0, 0, 0, 1, 2, 2, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1, 0, 0, 0, 1, 4, 4, 1, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 2, 4, 2, 0, 0, 2, 4, 1, -1, -2, 0, 1, 0, -1, 0, 2, 4, 1, 0, 0, 2, 4, 1, 0, 0, 1, 4, 5, 5, 2, 0, -1, 1, 4, 4, 2, 1, 2, 2, 2, 4, 5, 5, 2, 2, 2, 4, 4, 4, 2, 2, 5, 6, 5, 2, 4, 7, 8, 5, 2, 4, 7, 7, 5, 4, 4, 5, 5, 5, 4, 4, 2, 2, 4, 5, 5, 4, 5, 7, 6, 4, 2, 1, 1, 2, 5, 5, 2, 1, 2, 2, 1, 1, 2, 0, 0, 0, 4, 2, 0, -1, 0, 2, 2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -2, -2, 0, 0, -2, -3, -2, -1, -1, -2, -3, -5, -5, -3, -2, -2, -5, -3, -2, -1, -2, -3, -3, -2, -2, -3, -6, -6, -6, -5, -3, -5, -5, -3, -2, -3, -5, -5, -5, -5, -6, -6, -6, -5, -5, -5, -5, -5, -6, -6, -6, -6, -6, -6, -6, -6, -7, -9, -7, -3, -5, -7, -8, -6, -3, -5, -7, -8, -8, -8, -8, -8, -7, -7, -8, -8, -7, -7, -7, -7, -7, -8, -8, -7, -8, -10, -10, -7, -6, -8, -10, -10, -8, -8, -8, -8, -7, -7, -8, -8, -7, -7, -8, -8, -8, -8, -8, -9, -9, -8, -8, -8, -8, -9, -10, -9, -7, -7, -9, -9, -9, -9, -9, -9, -9, -10, -12, -12, -10, -10, -10, -10, -9, -9, -9, -10, -10, -10, -12, -12, -12, -9, -8, -9, -10, -9, -8, -7, -8, -10, -10, -9, -9, -10, -12, -10, -7, -6, -8, -9, -8, -7, -9, -12, -12, -8, -8, -10, -12, -10, -8, -7, -7, -7, -7, -7, -6, -6, -6, -6, -5, -6, -9, -10, -9, -8, -8, -7, -5, -3, -6, -8, -7, -5, -3, -5, -5, -2, -2, -5, -7, -7, -5, -3, -3, -6, -7, -7, -6, -3, -5, -6, -5, -3, -3, -6, -7, -6, -5, -3, -2, -2, -3, -6, -5, -3, -3, -5, -3, -2, -3, -6, -6, -5, -3, -2, -3, -5, -5, -2, -2, -5, -3, -1, -1, -3, -3, -2, -1, -2, -2, 0, 0, -1, -2, -2, -2, -2, -2, -1, 0, -1, -2, -2, -1, 0, 0, 0, -1, -1, 0, 0, 0, -1, 0, 0, -1, -1, -1, -1, 0, 0, 1, 0, -2, -2, 0, 2, 1, -1, -2, -2, -2, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 0, -2, -2, 0, 0, 0, 0, 0, -2, -3, -3, -1, 0, 1, 0, 0, -1, 0, 1, 1, -1, -3, -1, 0, -1, -3, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, -1, -1, -2, -1, 1, 1, -1, -3, -1, 0, -1, -3, -3, -1, -1, -3, -3, -1, 0, -1, -3, -5, -3, -2, -1, -2, -3, -2, -1, -1, -2, -2, -2, -3, -3, -2, -2, -3, -3, -2, -2, -3, -5, -5, -3, -2, -1, -1, -3, -5, -5, -2, -2, -3, -5, -3, -3, -5, -5, -2, -2, -5, -6, -5, -3, -5, -6, -5, -2, -2, -2, -2, -2, -3, -5, -5, -2, -2, -3, -6, -3, -2, -3, -7, -7, -3, -3, -5, -6, -6, -6, -6, -6, -6, -6, -3, -2, -3, -6, -5, -3, -3, -5, -6, -6, -7, -7, -5, -5, -6, -6, -5, -3, -2, -1, -1, -2, -3, -5, -5, -5, -5, -5, -7, -7, -5, -3, -3, -5, -5, -3, -3, -5, -6, -7, -6, -2, -1, -2, -3, -2, -2, -2, -2, -1, -1, -3, -6, -3, -1, 0, -1, -3, -2, -1, -1, -2, -1, 0, 0, -2, -3, -2, -1, -2, -3, -3, -3, -3, -3, -3, -3, -1, 0, 0, -2, -2, 0, 1, 1, 0, -1, -1, -1, -1, -1, -1, 0, 0, -1, -2, -1, 0, 0, -1, -3, -3, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -2, -2, -2, -1, -1, -1, -3, -3, -1, 1, 2, 0, -1, 0, 0, 0, -1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 1, 2, 2, 1, 0, 0, 1, 4, 4, 4, 4, 4, 2, 2, 2, 1, 0, 0, 2, 4, 2, 1, 4, 6, 5, 2, 0, 1, 4, 6, 5, 1, 0, 2, 7, 6, 2, 1, 5, 7, 6, 4, 2, 4, 5, 6, 5, 4, 5, 6, 6, 4, 4, 5, 6, 6, 5, 5, 7, 7, 7, 7, 7, 7, 6, 6, 6, 6, 6, 5, 5, 4, 4, 5, 5, 4, 4, 5, 6, 5, 4, 5, 7, 7, 5, 4, 4, 4, 4, 2, 5, 6, 6, 4, 4, 6, 6, 4, 2, 2, 5, 6, 6, 6, 5, 4, 4, 4, 5, 5, 4, 4, 4, 5, 5, 2, 0, 1, 4, 4, 1, 0, 0, 1, 2, 4, 5, 5, 2, 2, 4, 4, 1, 0, 0, 2, 2, 1, 0, 0, 1, 4, 4, 1, 0, 0, 1, 1, 1, 1, 2, 2, 0, 0, 0, 0, 1, 2, 2, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 1, 0, 0, -1, -1, -1, 0, 0, 0, -2, -2, -1, 0, 1, 1, 0, -1, -2, -1, 0, 1, 0, -5, -3, 0, 4, 1, -2, -2, 0, 0, -1, -2, -2, -2, -5, -6, -6, -5, -2, -2, -3, -3, -3, -2, -2, -3, -5, -2, -1, -2, -2, -1, -1, -3, -3, -1, 0, -2, -5, -5, -2, -1, -1, -2, -2, -2, -2, -2, -2, -2, -2, -5, -5, -3, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, -1, -2, -2, -2, -2, -3, -1, -1, -2, -3, -1, 1, 0, -2, -3, -1, 0, -1, -2, -3, -3, 0, 1, 1, 0, -2, -2, -2, -2, -1, -1, -1, -2, -3, -3, -2, 0, 0, -1, -3, -3, -1, 0, 0, 0, -2, -3, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, -3, -3, -2, -1, -1, -1, 0, 0, -1, -3, -3, -2, -2, -2, -1, -1, -3, -6, -5, -3, -5, -6, -5, -2, -1, -3, -5, -3, -2, -3, -3, -3, -3, -3, -3, -2, -2, -3, -3, -2, -2, -5, -3, -2, -1, -1, -2, -2, -1, 0, 0, 0, -2, -3, -2, -1, -1, -2, -2, -2, -1, -1, -1, -1, -1, -2, -2, -1, 0, 0, -1, -1, -1, -1, -1, -2, -2, 0, 0, -1, -2, -2, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -2, -1, 0, 0, -1, -2, -1, 0, 1, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -2, -2, -2, -2, -2, -2, -1, -1, -2, -3, -2, -1, -1, -1, -1, -1, -2, -3, -3, -2, -1, -1, -3, -5, -5, -3, -2, -2, -3, -5, -3, -2, -3, -5, -2, 0, 0, -3, -6, -5, -3, -2, -3, -6, -6, -6, -6, -5, -3, -3, -5, -7, -9, -7, -5, -3, -6, -7, -6, -5, -5, -5, -5, -3, -3, -3, -3, -5, -7, -6, -5, -3, -5, -7, -7, -6, -6, -7, -8, -6, -5, -5, -6, -6, -6, -7, -7, -7, -6, -6, -6, -6, -6, -6, -7, -6, -3, -2, -3, -7, -7, -7, -6, -6, -5, -5, -7, -8, -8, -6, -6, -6, -6, -5, -6, -7, -7, -6, -6, -6, -5, -6, -8, -7, -5, -5, -7, -7, -7, -9, -9, -5, -2, -5, -8, -6, -3, -3, -3, -3, -3, -6, -6, -3, -2, -3, -7, -9, -8, -7, -5, -5, -6, -7, -6, -3, -2, -3, -3, -3, -3, -5, -5, -3, -3, -3, -3, -3, -6, -6, -5, -2, -3, -5, -5, -5, -6, -7, -7, -5, -3, -5, -5, -5, -5, -3, -2, -3, -6, -7, -6, -6, -6, -6, -3, -3, -6, -7, -5, -2, -2, -6, -6, -3, -3, -6, -6, -6, -6, -6, -3, -2, -3, -6, -7, -7, -6, -6, -5, -3, -3, -5, -5, -2, -1, -2, -5, -5, -3, -3, -3, -5, -5, -6, -7, -6, -3, -3, -6, -6, -5, -5, -6, -7, -7, -7, -6, -6, -7, -7, -6, -3, -3, -5, -5, -5, -5, -5, -5, -5, -5, -5, -3, -2, -2, -5, -6, -5, -3, -2, -2, -5, -5, -5, -3, -1, -1, -2, -5, -6, -5, -5, -6, -6, -2, -2, -5, -7, -7, -3, -2, -5, -8, -7, -2, -1, -3, -6, -5, -2, -1, -2, -5, -6, -6, -6, -6, -5, -2, -2, -3, -5, -5, -2, -1, -2, -5, -5, -5, -3, -3, -3, -5, -5, -3, -3, -3, -3, -3, -5, -7, -6, -3, -2, -3, -3, -3, -3, -3, -3, -2, -1, -1, -3, -5, -3, -1, -3, -6, -5, -2, -3, -7, -6, -1, 0, -3, -8, -6, -2, 0, -1, -3, -5, -5, -3, -3, -3, -5, -6, -5, -3, -3, -6, -6, -5, -3, -3, -5, -6, -5, -2, -3, -6, -7, -3, -1, -5, -7, -6, -3, -3, -5, -5, -3, -3, -3, -3, -2, -3, -6, -7, -5, -1, -1, -2, -3, -2, -2, -2, -3, -3, -3, -2, -1, -1, -2, -2, -2, -1, -1, -2, -2, -2, -1, -1, -1, 0, 0, -1, -2, -2, -2, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, -3, -2, 0, 1, 0, -2, -2, -1, 0, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, -2, -2, 0, 1, 0, 0, 1, 2, 2, 0, 0, 0, 2, 2, 0, -1, -1, 0, 1, 0, 0, 1, 1, 0, 0, 0, 1, 2, 2, 2, 1, 0, 0, 2, 4, 2, 0, 1, 2, 0, 0, 1, 4, 2, 0, 0, 1, 2, 1, 2, 5, 4, 0, 0, 2, 5, 4, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 1, 2, 5, 6, 4, 2, 4, 7, 6, 1, 0, 2, 5, 4, 1, 1, 2, 4, 4, 1, 1, 2, 2, 2, 2, 1, 1, 1, 2, 4, 4, 4, 2, 2, 4, 4, 4, 4, 2, 1, 1, 1, 2, 4, 4, 4, 4, 2, 1, 2, 4, 4, 1, 0, 4, 6, 5, 1, 1, 2, 4, 2, 2, 2, 0, -1, 0, 2, 2, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 0, -1, -1, 0, 0, 0, -2, -2, -1, 0, 1, 0, -3, -2, 1, 4, 2, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 1, 1, 1, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -2, -2, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -1, 0, 0, -2, -3, -3, -1, 0, 0, -1, -2, -2, -2, 0, 0, -1, -2, -3, -3, -1, 0, 0, -2, -3, -3, -3, -2, -2, -2, -3, -3, -2, -1, 0, 0, -1, -3, -3, -1, 0, -1, -2, -1, -1, -2, -2, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -2, 0, 1, 0, -1, -2, -1, 0, 0, 0, 0, 0, -1, -1, 0, -1, -2, -1, 0, 0, -2, -3, -2, -1, 0, 0, 0, -1, -3, -1, 0, 0, -2, -2, -1, 0, -1, -2, -1, -1, -2, -3, -3, -2, -2, -3, -3, -2, -2, -3, -3, -3, -2, -3, -5, -2, 0, -1, -5, -6, -1, 0, -1, -3, -1, 0, -2, -5, -3, -1, 0, -1, -3, -3, -2, -2, -2, -2, -2, -2, -5, -6, -3, -1, 0, -3, -5, -3, 0, 0, 0, -2, -3, -2, -2, -1, -1, -1, -1, -2, -3, -3, -2, -1, 0, -1, -2, -2, -1, -1, -1, -2, -2, -2, -1, 0, 0, -1, -1, 0, 2, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 1, 2, 1, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -2, -3, -2, -1, 0, 0, 0, 0, -2, -2, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -2, -2, 0, 0, -2, -3, -2, -1, -1, -2, -3, -3, -3, -2, -2, -5, -6, -5, -3, -3, -6, -6, -5, -3, -2, -2, -3, -5, -5, -3, -3, -7, -6, -2, -1, -5, -7, -3, -2, -5, -7, -6, -1, -2, -6, -7, -5, -2, -3, -7, -7, -5, -5, -6, -6, -3, -3, -5, -5, -6, -6, -5, -2, -2, -5, -5, -2, -2, -5, -5, -3, -3, -5, -3, -3, -7, -9, -8, -5, -3, -6, -6, -5, -5, -7, -7, -5, -3, -6, -9, -9, -7, -7, -7, -7, -6, -6, -6, -6, -6, -6, -5, -5, -7, -7, -7, -6, -6, -5, -5, -5, -5, -6, -6, -6, -6, -5, -5, -5, -6, -6, -6, -6, -6, -6, -6, -5, -3, -3, -6, -7, -7, -6, -6, -5, -5, -5, -6, -6, -5, -5, -6, -6, -5, -5, -8, -7, -3, -1, -3, -7, -8, -7, -5, -3, -3, -6, -7, -5, -1, 0, -1, -3, -5, -5, -2, -1, -2, -5, -5, -2, -1, -2, -2, -1, -1, -2, -3, -2, 0, 0, 0, -1, -3, -2, 0, 0, -1, -3, -3, 0, 0, -1, -3, -3, -3, -3, -2, -2, -2, -2, -1, 0, 0, 0, 0, -1, -2, -1, 0, 0, -3, -5, -1, 0, -1, -2, -1, -1, -2, -2, -1, -1, -1, -2, -2, -2, -1, 0, 0, -1, -1, -1, -2, -2, -1, -1, -2, -3, -3, -1, 0, 0, 0, -2, -3, -2, -1, 0, 0, 0, -1, -2, -2, -1, 0, 0, -1, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -2, -2, -2, -2, -2, -1, 0, -1, -3, -5, -3, -2, -2, -2, -3, -5, -5, -5, -5, -5, -5, -5, -3, -2, -3, -5, -3, -2, -3, -5, -5, -2, -2, -5, -6, -3, -2, -5, -5, -5, -5, -6, -5, -3, -3, -6, -7, -7, -5, -3, -3, -5, -6, -7, -7, -6, -6, -7, -7, -6, -3, -3, -6, -7, -6, -5, -3, -5, -7, -7, -8, -8, -8, -7, -7, -7, -7, -7, -7, -7, -6, -5, -3, -5, -8, -9, -8, -6, -5, -6, -7, -6, -5, -3, -5, -6, -7, -7, -7, -6, -6, -6, -7, -8, -8, -7, -7, -6, -6, -6, -7, -7, -6, -6, -8, -8, -7, -7, -7, -6, -5, -5, -5, -3, -3, -3, -5, -5, -5, -6, -7, -6, -3, -3, -6, -7, -5, -3, -5, -5, -3, -2, -2, -3, -5, -6, -6, -3, -1, -1, -5, -6, -5, -2, -3, -5, -5, -3, -2, -2, -2, -2, -2, -2, -2, -1, -1, -2, -5, -6, -5, -2, -1, -2, -3, -2, -1, -2, -3, -3, -2, -2, -5, -5, -3, -1, 0, -1, -1, -1, -1, 0, 1, 2, 0, -2, -1, 1, 0, -2, -2, 1, 4, 1, 0, 0, 1, 1, 0, 1, 1, 0, 0, 2, 4, 2, 0, 0, 2, 2, 0, 0, 4, 5, 2, 0, 2, 5, 4, 4, 4, 4, 4, 6, 7, 6, 4, 4, 6, 5, 2, 2, 6, 7, 5, 2, 4, 6, 7, 7, 6, 4, 5, 7, 8, 7, 5, 5, 6, 6, 6, 6, 6, 5, 5, 6, 7, 6, 5, 5, 6, 6, 4, 5, 7, 7, 4, 2, 4, 5, 5, 5, 5, 6, 4, 4, 5, 7, 6, 2, 1, 2, 5, 5, 4, 4, 4, 4, 5, 5, 5, 5, 6, 7, 7, 7, 7, 6, 5, 5, 6, 6, 5, 5, 6, 7, 6, 4, 5, 6, 5, 4, 4, 6, 7, 7, 6, 7, 7, 6, 6, 6, 6, 6, 5, 5, 5, 5, 4, 4, 6, 6, 5, 2, 4, 6, 7, 6, 4, 4, 6, 6, 6, 5, 5, 6, 6, 7, 8, 7, 5, 5, 6, 6, 5, 6, 7, 6, 5, 5, 6, 6, 5, 5, 7, 6, 5, 4, 4, 5, 5, 5, 5, 5, 4, 4, 4, 6, 7, 6, 5, 5, 5, 6, 6, 6, 6, 5, 5, 6, 5, 4, 4, 5, 5, 5, 5, 5, 5, 2, 2, 4, 6, 5, 2, 2, 4, 5, 4, 2, 2, 5, 5, 5, 4, 4, 2, 2, 2, 4, 5, 5, 4, 4, 5, 5, 5, 4, 2, 1, 2, 4, 2, 2, 4, 7, 7, 4, 2, 4, 5, 5, 2, 1, 2, 4, 5, 5, 4, 1, 1, 4, 5, 5, 5, 2, 2, 2, 4, 5, 4, 1, 2, 4, 5, 4, 4, 5, 4, 2, 1, 2, 4, 2, 2, 5, 6, 5, 2, 4, 5, 5, 5, 4, 2, 2, 5, 6, 4, 1, 1, 2, 4, 4, 4, 5, 5, 4, 4, 5, 5, 2, 0, 1, 2, 2, 2, 2, 2, 0, 0, 1, 5, 5, 1, 1, 2, 2, 0, -1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -2, -2, -2, -2, -1, 0, -1, -3, -3, -2, -1, -1, -3, -5, -5, -2, -1, -1, -2, -2, -1, -1, -3, -6, -6, -5, -3, -5, -5, -3, -1, -2, -5, -6, -5, -3, -3, -5, -6, -6, -5, -3, -3, -5, -6, -6, -6, -5, -5, -5, -5, -6, -6, -6, -6, -7, -6, -5, -5, -5, -5, -5, -3, -3, -6, -7, -7, -7, -7, -6, -6, -6, -6, -5, -5, -5, -5, -6, -7, -7, -6, -6, -7, -8, -7, -5, -6, -7, -7, -7, -6, -6, -6, -7, -7, -6, -6, -7, -7, -7, -7, -6, -5, -5, -7, -8, -8, -6, -5, -5, -6, -6, -7, -7, -6, -3, -3, -6, -7, -7, -5, -6, -7, -8, -8, -7, -7, -8, -9, -7, -5, -3, -6, -9, -9, -8, -7, -7, -7, -6, -6, -6, -8, -8, -7, -6, -5, -5, -6, -7, -8, -6, -3, -5, -7, -9, -8, -7, -6, -7, -8, -9, -9, -7, -6, -7, -7, -6, -5, -5, -5, -6, -7, -7, -7, -7, -6, -6, -7, -8, -8, -7, -6, -6, -7, -7, -5, -5, -5, -5, -5, -5, -6, -7, -6, -6, -7, -7, -5, -5, -6, -7, -7, -7, -7, -6, -5, -3, -6, -7, -6, -5, -2, -3, -5, -7, -8, -8, -7, -6, -5, -5, -6, -6, -5, -5, -6, -7, -7, -6, -5, -3, -3, -5, -5, -5, -5, -6, -6, -6, -6, -6, -5, -5, -6, -7, -7, -7, -6, -6, -6, -6, -6, -6, -3, -3, -5, -6, -6, -3, -3, -5, -7, -7, -6, -5, -6, -6, -6, -5, -3, -3, -3, -3, -3, -3, -3, -5, -3, -1, -2, -5, -6, -6, -5, -3, -3, -3, -5, -3, -1, -1, -3, -5, -5, -3, -2, -3, -3, -5, -5, -5, -3, -2, -2, -3, -5, -6, -6, -3, -2, -3, -6, -6, -2, -1, -2, -5, -6, -6, -3, -1, -1, -2, -5, -5, -5, -3, -2, -1, -2, -5, -6, -6, -5, -2, -2, -3, -3, -2, 0, 0, 0, -1, -1, -2, -3, -3, -2, -2, -3, -5, -5, -3, -2, -2, -3, -3, -1, -1, -2, -5, -5, -2, -1, 0, 0, -1, -3, -5, -3, -1, 0, -1, -2, -3, -3, -2, 0, 0, -1, -2, -2, -1, -1, -2, -3, -3, -2, -2, -2, -1, 0, 0, 0, 0, 0, 0, -2, -2, 0, 0, -1, -2, -1, 0, 0, -1, -2, -3, -3, -2, 0, 0, -1, -1, 0, 0, 0, -1, -2, -2, -1, -1, -1, -1, 0, 0, 0, 0, -2, -2, -1, -1, -1, 0, 0, 0, -2, -2, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -2, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, -1, -2, -2, -1, -1, -2, -3, -2, -2, -3, -3, -2, 0, 0, -2, -2, -1, 0, -1, -1, -2, -3, -3, -3, -2, -2, -2, -1, -1, -2, -3, -3, -3, -2, -1, 0, -1, -2, -3, -2, -1, -1, -2, -2, -1, -1, -2, -3, -2, -1, -3, -3, -2, -1, -2, -5, -3, 0, 0, -1, -2, -2, -5, -5, -3, -2, -3, -5, -6, -5, -3, -2, -2, -3, -3, -3, -3, -3, -5, -5, -3, -2, -3, -5, -6, -6, -5, -5, -3, -2, -2, -3, -5, -5, -5, -5, -5, -5, -5, -6, -6, -6, -6, -5, -5, -5, -6, -7, -7, -5, -3, -3, -6, -7, -7, -6, -5, -3, -6, -7, -7, -5, -5, -7, -8, -7, -6, -6, -7, -7, -6, -6, -7, -7, -5, -2, -2, -5, -6, -5, -5, -6, -6, -3, -3, -6, -7, -7, -6, -3, -2, -5, -6, -5, -2, -2, -5, -6, -5, -3, -3, -3, -3, -3, -2, -1, -1, -3, -3, -3, -5, -5, -2, 0, 0, -3, -5, -3, -1, -1, -3, -3, -2, -1, -1, -1, -1, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 1, 2, 0, -2, -2, 0, 1, 1, 0, 0, 1, 1, 0, 0, 0, 2, 1, 0, 0, 1, 2, 4, 4, 2, 1, 1, 2, 2, 2, 1, 1, 2, 2, 1, 0, 1, 2, 2, 2, 2, 2, 1, 1, 4, 5, 2, 0, 0, 2, 4, 4, 2, 1, 1, 2, 2, 0, 0, 4, 5, 4, 1, 2, 2, 2, 4, 5, 5, 4, 2, 2, 2, 2, 2, 2, 4, 2, 1, 0, 2, 4, 2, -1, 0, 2, 4, 1, 0, 0, 1, 1, 1, 1, 2, 1, 0, 0, 1, 2, 1, 0, -1, 0, 1, 1, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 0, 0, 0, 0, 0, 1, 0, -1, -1, 0, 0, 1, 2, 4, 2, 1, 1, 5, 5, 1, 0, 1, 1, 0, -2, 0, 4, 5, 2, 0, 0, 2, 2, 1, 0, 0, 0, 0, 0, 0, 1, 2, 4, 1, 0, 0, 0, 1, 1, 1, 0, 0, -1, 0, 2, 2, 0, -1, 0, 0, 0, 0, 0, 2, 2, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, -1, -2, -1, 0, 0, -1, -2, -3, -1, 0, 0, -1, -2, -2, -2, -1, -1, -1, -3, -3, -2, -1, 0, 0, 0, 0, -2, -3, -1, 0, 0, -2, -2, -1, 0, -1, -2, -3, -2, -1, -1, -1, -2, -2, -2, -2, -1, -1, -2, -2, -2, -1, -1, -1, -1, 0, 0, -2, -3, -3, -2, -1, -2, -5, -5, -3, -2, -2, -3, -3, -3, -3, -2, -1, -1, -2, -2, -2, -2, -3, -3, -3, -3, -3, -3, -3, -2, -2, -2, -3, -3, -3, -3, -5, -5, -2, -2, -5, -6, -5, -2, -3, -5, -5, -5, -5, -2, -2, -3, -5, -5, -5, -3, -2, -1, -2, -3, -3, -2, -1, -1, -2, -2, -2, -2, -2, -2, -2, -1, -2, -5, -5, -2, -2, -3, -3, -2, -3, -5, -5, -5, -5, -5, -2, -2, -3, -3, -3, -2, -2, -2, -2, -3, -3, -3, -5, -5, -3, -2, -3, -5, -5, -3, -3, -5, -5, -5, -3, -2, -1, -2, -3, -2, -1, -1, -2, -2, -2, -2, -2, -1, 0, 0, -2, -3, -2, -1, -2, -3, -2, -2, -2, -2, -2, -2, -3, -3, -2, 0, 0, -1, -3, -3, 0, 1, 0, -2, -2, -2, -2, 0, 0, 0, -3, -3, -1, -1, -3, -2, 0, 1, 0, -1, -3, -2, 0, 0, -1, -2, -1, 0, -1, -2, -1, 0, -2, -5, -3, -1, -1, -2, -3, -2, -1, -1, -1, -2, -2, -1, 0, 0, 0, 0, -1, -1, -2, -2, -2, -1, -1, -2, -3, -2, -1, -1, -1, -2, -2, -1, 0, 0, -1, -3, -3, -2, -1, 0, 0, -2, -3, -2, 0, 0, -1, -2, -2, -3, -3, -2, -1, -1, -3, -3, -3, -2, -2, -2, -2, -3, -5, -5, -2, 0, 0, -3, -6, -5, -1, 0, -3, -6, -7, -6, -3, -2, -3, -5, -6, -5, -3, -2, -2, -2, -3, -3, -3, -3, -5, -5, -3, -2, -3, -6, -6, -3, -1, -1, -3, -5, -3, -1, -1, -2, -5, -5, -1, 0, 0, -2, -5, -5, -3, -3, -2, -1, -1, -3, -6, -6, -5, -5, -5, -6, -5, -3, -2, -2, -3, -6, -7, -7, -5, -2, -2, -5, -7, -6, -5, -3, -5, -6, -6, -5, -5, -6, -6, -5, -5, -5, -3, -3, -3, -6, -7, -7, -5, -2, -2, -6, -8, -7, -5, -3, -3, -3, -5, -7, -6, -3, -2, -3, -5, -5, -5, -5, -6, -6, -5, -5, -3, -2, -1, -3, -5, -6, -3, -3, -3, -5, -5, -3, -3, -5, -6, -5, -2, -3, -6, -6, -3, -2, -3, -5, -5, -5, -5, -3, -3, -3, -3, -3, -3, -5, -5, -3, -3, -3, -3, -3, -2, -2, -2, -3, -6, -5, -2, -2, -5, -5, -1, -1, -5, -7, -5, -2, -5, -7, -6, -3, -2, -3, -3, -2, -3, -3, -2, -2, -3, -5, -5, -2, -2, -5, -5, -2, -2, -5, -6, -5, -3, -2, -2, -3, -5, -3, -2, -3, -5, -3, -2, -3, -3, 0, 0, -5, -7, -3, -2, -3, -5, -2, -1, -2, -5, -3, -1, -1, -3, -3, -2, -2, -2, -3, -3, -3, -3, -5, -6, -3, -1, 0, -3, -7, -5, -1, -1, -2, -3, -2, -1, -3, -3, -2, 0, 0, -1, -2, -3, -3, -2, -1, -1, -2, -3, -3, -2, -2, -3, -3, -2, -1, -1, -3, -3, -1, 0, 0, -1, -2, -2, -1, 0, 0, -1, -2, -2, -1, -1, -1, -1, -1, -2, -2, -1, 0, -1, -3, -3, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, -2, -1, 0, 0, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -2, 0, 2, 0, -2, -2, 0, 1, -1, -3, -2, 0, 0, 0, 0, 0, -1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, -1, 0, 1, 0, -1, -1, -1, 0, 0, 0, -1, -2, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 1, 0, -2, -1, 0, 0, -2, -2, 0, 1, -1, -2, 0, 1, 0, -2, -1, 0, 0, 0, 0, 0, 1, 1, 1, 0, 0, 0, 2, 2, 1, 1, 4, 4, 1, 0, 1, 1, 2, 4, 4, 0, -2, 0, 2, 2, 0, 0, 1, 1, 1, 1, 2, 2, 1, 0, 0, 0, 1, 1, 1, 1, 2, 2, 1, 1, 1, 2, 2, 1, 1, 1, 1, 2, 4, 4, 4, 4, 2, 2, 2, 4, 4, 4, 2, 2, 2, 2, 2, 2, 2, 2, 4, 5, 4, 1, 0, 1, 4, 4, 2, 2, 4, 2, 1, 1, 2, 1, 1, 2, 2, 1, 0, 2, 5, 4, 0, 0, 0, 2, 5, 4, 0, 0, 2, 5, 6, 5, 2, 1, 1, 4, 5, 5, 2, 2, 4, 5, 5, 4, 4, 4, 1, 1, 4, 7, 7, 5, 4, 1, 2, 5, 6, 4, 1, 1, 2, 4, 4, 2, 1, 0, 1, 2, 2, 2, 2, 2, 4, 4, 5, 5, 2, 1, 2, 4, 2, 0, 0, 1, 2, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -2, -2, 0, 2, 2, 0, -1, -2, -2, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -2, -1, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, -3, -3, -2, -2, -3, -2, 0, -1, -5, -6, -3, -1, -1, -3, -3, -5, -5, -5, -5, -5, -6, -6, -5, -3, -3, -6, -5, -3, -5, -6, -5, -3, -3, -7, -7, -5, -3, -6, -6, -5, -6, -7, -6, -5, -5, -7, -7, -6, -5, -5, -6, -6, -6, -7, -8, -8, -7, -7, -8, -7, -6, -5, -6, -8, -7, -6, -6, -8, -9, -9, -9, -9, -9, -9, -8, -7, -7, -7, -8, -8, -7, -5, -5, -6, -9, -10, -9, -7, -6, -7, -8, -7, -5, -3, -5, -6, -7, -7, -7, -6, -6, -6, -8, -8, -7, -6, -6, -6, -6, -7, -7, -7, -6, -6, -8, -8, -6, -6, -7, -7, -5, -3, -2, -2, -2, -5, -5, -3, -2, -3, -5, -5, -3, -3, -5, -5, -5, -3, -3, -3, -3, -2, -1, -2, -5, -6, -5, -2, -2, -3, -6, -6, -3, -2, -3, -6, -6, -2, -1, -1, -2, -2, -2, -2, -3, -3, -2, -1, -3, -7, -7, -3, 0, -1, -5, -6, -5, -3, -5, -5, -5, -5, -6, -6, -5, -2, -1, -1, -2, -2, -2, -1, 0, 0, -2, -5, -3, -1, -1, -3, -5, -2, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, -1, 0, 2, 1, -2, -3, 0, 0, -1, -2, 0, 1, -1, -3, -1, 1, 0, -1, 0, 0, 1, 2, 2, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, -1, 0, 2, 4, 2, 0, -1, 0, 2, 5, 4, 0, 0, 1, 2, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, 0, 0, 2, 2, 2, 2, 2, 1, 1, 2, 5, 2, 0, 0, 1, 4, 2, 1, 1, 4, 4, 4, 4, 5, 5, 5, 5, 5, 2, 2, 2, 1, 0, 0, 1, 4, 4, 4, 2, 0, 0, 1, 4, 2, 1, 1, 4, 6, 6, 2, 1, 1, 2, 2, 2, 2, 2, 1, 1, 1, 2, 2, 1, 1, 4, 4, 0, 0, 4, 7, 6, 1, 0, 1, 5, 4, 1, 1, 4, 5, 4, 2, 2, 1, 1, 1, 1, 2, 5, 5, 4, 2, 2, 4, 4, 2, 2, 2, 1, 1, 1, 1, 1, 2, 2, 2, 2, 2, 2, 2, 4, 5, 4, 1, 0, 0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 2, 2, 2, 2, 1, 1, 1, 2, 5, 4, 0, 0, 0, 2, 2, 0, 0, 0, 0, 1, 2, 2, 2, 1, 1, 2, 5, 5, 4, 4, 5, 6, 5, 2, 0, 0, 4, 4, 1, 0, 4, 7, 5, 1, 1, 4, 6, 4, 2, 1, 2, 4, 6, 6, 4, 0, 0, 2, 5, 5, 5, 4, 2, 2, 4, 6, 6, 4, 2, 4, 6, 6, 4, 4, 5, 4, 4, 5, 6, 5, 4, 6, 7, 6, 2, 2, 5, 7, 6, 4, 2, 4, 5, 5, 2, 2, 2, 2, 4, 4, 2, 1, 2, 5, 5, 4, 4, 2, 0, 0, 2, 4, 2, 1, 1, 1, 0, 0, 2, 1, -1, 0, 2, 2, -1, -3, 0, 2, 1, -1, -1, 0, 0, 0, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -2, -1, 0, -1, -3, -3, -1, 0, -1, -2, -5, -3, -2, -1, -2, -5, -5, -1, 0, -2, -3, -2, -1, -2, -3, -3, -3, -5, -5, -3, -3, -3, -3, -2, -3, -6, -6, -5, -3, -3, -5, -5, -3, -2, -2, -3, -5, -6, -5, -3, -2, -3, -5, -5, -3, -5, -6, -6, -3, -2, -5, -6, -5, -2, -2, -3, -6, -7, -7, -6, -5, -5, -6, -6, -5, -5, -5, -3, -3, -5, -6, -6, -5, -5, -6, -7, -6, -3, -5, -6, -7, -6, -5, -5, -5, -5, -5, -6, -6, -7, -7, -6, -5, -5, -5, -6, -7, -8, -7, -5, -5, -6, -8, -8, -7, -6, -5, -3, -6, -8, -9, -6, -5, -6, -8, -9, -9, -8, -8, -9, -10, -8, -3, -5, -8, -10, -9, -8, -7, -6, -6, -7, -7, -7, -8, -9, -8, -6, -6, -7, -7, -7, -9, -8, -5, -3, -8, -10, -9, -7, -6, -6, -7, -9, -9, -7, -5, -6, -7, -6, -3, -2, -3, -6, -7, -7, -7, -7, -6, -6, -7, -8, -7, -5, -5, -7, -8, -7, -3, -2, -3, -5, -3, -2, -5, -6, -5, -3, -6, -7, -6, -3, -3, -5, -6, -7, -7, -6, -5, -3, -5, -6, -5, -3, -1, -3, -5, -5, -3, -5, -7, -6, -3, -2, -5, -5, -5, -5, -6, -6, -5, -5, -5, -3, -3, -3, -3, -5, -6, -7, -7, -7, -6, -6, -5, -5, -5, -7, -8, -7, -7, -7, -7, -6, -5, -6, -6, -6, -7, -7, -6, -2, -2, -5, -8, -8, -7, -6, -6, -6, -7, -7, -7, -7, -6, -5, -3, -3, -6, -8, -8, -6, -3, -5, -7, -8, -8, -7, -5, -3, -5, -7, -7, -7, -6, -5, -5, -6, -7, -6, -5, -5, -5, -7, -8, -8, -6, -5, -6, -8, -7, -6, -6, -8, -8, -7, -5, -6, -7, -7, -7, -7, -7, -6, -6, -6, -7, -7, -6, -5, -3, -2, -2, -3, -6, -6, -5, -3, -5, -8, -8, -3, 0, -1, -5, -6, -5, -3, -3, -3, -3, -5, -7, -8, -7, -6, -3, -3, -6, -8, -7, -3, -3, -6, -6, -3, -3, -6, -6, -3, -2, -5, -5, -2, -2, -3, -5, -5, -5, -3, -1, -1, -3, -6, -5, -3, -3, -5, -6, -6, -6, -6, -6, -5, -3, -3, -5, -5, -3, -3, -5, -5, -2, -2, -3, -3, -2, -3, -5, -5, -3, -3, -3, -3, -3, -5, -7, -6, -2, 0, -2, -5, -6, -5, -3, -3, -3, -5, -6, -3, 0, 0, -1, -2, -2, -2, -3, -3, -1, -1, -2, -5, -6, -3, -1, 0, -2, -3, -3, -3, -2, -1, 0, -1, -2, -2, -2, -2, -2, -3, -3, -2, -1, -1, -2, -5, -5, -3, -1, 0, 0, 0, 0, 0, -1, -1, -1, -2, -2, -1, 0, -1, -2, -2, -2, -3, -3, -2, -1, -1, -3, -5, -2, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 1, 4, 4, 2, 0, 0, 1, 2, 1, 0, 0, 1, 2, 2, 1, 1, 1, 0, 0, 0, 1, 1, 0, 0, 1, 1, 1, 0, 0, 1, 2, 2, 1, 0, 1, 2, 2, 0, 0, 2, 4, 2, 1, 1, 2, 2, 1, 0, 0, 0, 0, 1, 0, 0, 0, 0, 1, 2, 4, 4, 2, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, 0, 0, -1, -1, -1, -2, -3, -1, 0, -1, -2, -1, 0, -2, -2, 0, 0, -1, -2, -2, 0, 0, 0, -2, -3, -5, -3, -2, -2, -5, -5, -2, -2, -5, -6, -2, 0, -1, -2, -5, -6, -5, -2, -2, -5, -6, -6, -6, -6, -5, -2, -3, -8, -10, -8, -5, -3, -7, -9, -7, -6, -6, -7, -7, -7, -6, -5, -5, -6, -8, -8, -7, -6, -6, -7, -8, -8, -9, -9, -9, -9, -8, -8, -7, -7, -8, -9, -9, -9, -9, -9, -9, -7, -7, -9, -10, -10, -7, -6, -7, -10, -10, -10, -9, -9, -8, -8, -10, -13, -13, -9, -8, -9, -9, -9, -10, -12, -10, -8, -7, -8, -9, -10, -12, -9, -8, -9, -10, -10, -10, -12, -12, -8, -7, -8, -9, -8, -6, -7, -7, -7, -7, -8, -9, -8, -5, -5, -8, -12, -13, -9, -6, -5, -7, -9, -9, -6, -3, -3, -6, -6, -6, -6, -6, -6, -5, -3, -3, -5, -6, -6, -3, -3, -3, -5, -6, -7, -7, -7, -6, -5, -5, -5, -5, -5, -5, -3, -3, -3, -3, -5, -6, -6, -5, -5, -5, -5, -5, -5, -5, -2, -2, -3, -5, -3, -3, -3, -3, -3, -3, -3, -2, 0, 1, 0, -2, -3, -2, -2, -1, 0, 0, 0, -1, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 1, 0, -1, -1, 0, 0, 0, -1, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, 0, 1, 2, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 2, 5, 4, 0, -1, 0, 0, 0, 1, 4, 5, 1, -2, -1, 4, 5, 0, -5, -2, 2, 5, 2, -1, 0, 2, 4, 2, 0, 0, -1, -2, -2, -1, 1, 1, 0, -3, -2, 1, 4, 1, 0, -1, 0, 0, 1, 0, -1, -2, -1, 0, 0, 0, 1, -1, -3, -2, 0, 0, 0, 0, 1, 0, 0, 0, 1, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, 0, 2, 4, 0, -3, -1, 2, 5, 2, 0, 0, 0, 0, 0, -1, -1, 0, 0, 1, 1, 0, -1, -1, 0, 0, 0, -1, 0, 1, 0, -3, -2, 0, 0, -1, -3, -2, 0, 0, -1, -1, 0, 0, 1, 1, 1, 0, -2, -2, 0, 2, 4, 2, 1, 0, 0, 0, 0, 0, 0, 0, 0, 2, 2, 0, -1, 0, 1, 1, 0, 0, 1, 0, 0, 1, 1, 0, -1, 0, 0, 1, 2, 2, 1, 0, 0, 0, 2, 5, 5, 1, -1, 0, 5, 6, 1, 0, 0, 2, 2, 1, 1, 1, 0, 0, 2, 4, 2, 1, 0, 0, -2, -1, 0, 2, 1, 0, 2, 5, 2, 0, 0, 2, 5, 2, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 2, 2, 1, 0, -1, 0, 1, 2, 0, -1, 0, 1, 0, -1, 0, 1, 2, 0, -1, 0, 1, 0, 0, 4, 4, 0, -1, 0, 5, 4, 0, -1, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 1, 1, 2, 2, 2, 4, 6, 6, 1, -2, 0, 4, 4, 0, -2, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 1, 2, 0, -2, -1, 0, 0, -1, -1, -1, -1, -2, -2, 0, 0, 0, 0, 0, -2, -2, 0, 0, -1, -2, -2, 0, 0, -1, -1, -2, -2, -2, -1, 0, -1, -5, -6, -3, 0, -1, -3, -3, -2, -1, -1, -3, -5, -5, -3, -2, -2, -3, -3, -3, -2, -2, -5, -6, -5, 0, 0, -5, -8, -6, 0, 0, 0, -1, -2, -5, -5, -2, -1, -3, -3, -2, -2, -2, -1, 0, 0, -3, -6, -5, 0, 0, -2, -5, -5, -5, -3, -2, -2, -5, -5, -2, -1, -1, -2, -3, -5, -5, -2, -2, -5, -5, -3, -3, -5, -3, -1, -1, -2, -2, 0, 0, -2, -6, -6, -3, -3, -3, -3, -3, -5, -6, -3, -1, -1, -2, -6, -7, -5, -1, 0, -1, -2, -2, -2, -2, -2, -1, -2, -6, -7, -5, 0, 1, 0, -3, -5, -3, -2, -1, 0, 0, 0, -3, -5, -2, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, -2, -2, 0, 1, 0, -2, -3, -3, -3, -3, -1, 0, -2, -5, -5, -1, 0, -1, -1, -1, -2, -5, -5, -2, -2, -5, -3, -1, -1, -3, -5, -3, -2, -2, -2, -2, -1, -2, -3, -3, -2, -2, -2, -3, -3, -3, -3, -2, 0, -1, -3, -5, -3, -1, 0, -1, -3, -3, -3, -3, -2, -1, -2, -5, -3, 0, 0, -5, -7, -1, 2, 0, -2, -1, 0, -1, -5, -5, -2, 0, 0, -1, -3, -3, -1, 1, 4, 2, 0, -2, -3, -1, 0, 0, 0, 0, 1, 6, 7, 5, 1, 0, 1, 2, 4, 5, 5, 4, 1, 0, 1, 4, 5, 5, 4, 2, 2, 4, 4, 2, 1, 0, 1, 2, 5, 5, 5, 6, 7, 7, 6, 5, 4, 4, 4, 4, 4, 5, 4, 2, 2, 5, 5, 4, 2, 4, 6, 7, 6, 4, 4, 6, 8, 8, 5, 2, 2, 5, 5, 4, 2, 2, 5, 6, 5, 4, 4, 5, 5, 4, 5, 7, 5, 0, 0, 1, 6, 7, 5, 2, 2, 1, 0, 1, 4, 4, 0, -2, -1, 0, 2, 2, 1, 0, -1, 0, 4, 5, 1, 0, 0, 0, 1, 1, 0, -1, 1, 5, 5, 1, 0, 0, 1, 2, 2, 1, 0, 0, 1, 2, 0, -1, 0, 1, 2, 1, 2, 6, 5, 1, 0, 1, 1, 0, 0, 0, 0, 1, 2, 2, 0, 0, 1, 1, 1, 1, 2, 4, 2, 0, 0, 0, 4, 4, 1, -1, -2, 0, 2, 4, 0, 0, 0, 1, 0, 0, 0, 1, 0, -1, -1, 0, 1, 0, -1, -1, -1, -2, -2, 0, 0, -2, -3, -2, -1, -1, -1, 0, 0, -2, -2, 1, 4, 0, -5, -2, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 2, 4, 4, 2, 2, 1, 0, 1, 2, 2, 0, 0, 1, 0, -1, -1, 0, 0, -1, -2, 0, 1, 1, 0, 0, 0, 0, -1, -2, -2, -1, -1, -1, -1, 0, 0, -1, -1, 0, 0, -1, -3, -1, 0, 1, 0, -2, -1, 0, 0, 0, -1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -2, -2, -1, -2, -5, -5, -3, -2, -3, -5, -5, -3, -3, -5, -5, -3, -1, 0, -2, -3, -3, -2, -2, -2, -2, -2, -3, -3, -3, -3, -3, -3, -3, -2, -1, -1, -2, -3, -5, -5, -3, -2, -1, -3, -5, -3, 0, -1, -5, -5, -1, 0, 0, -1, -1, -1, -5, -5, -2, 0, 0, -3, -2, 1, 1, 0, -2, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, -2, -1, 2, 1, -1, -5, -2, 0, 1, 0, -2, -3, -1, 1, 4, 2, 0, 0, 0, 2, 5, 2, 0, 0, 1, 4, 4, 2, 2, 4, 4, 1, 1, 2, 4, 2, 2, 6, 6, 4, 1, 1, 5, 7, 6, 2, 2, 4, 5, 5, 2, 1, 0, 0, 0, 1, 1, 1, 1, 4, 5, 5, 4, 1, 0, 0, 1, 2, 2, 0, -2, -5, -3, 1, 2, -1, -2, 1, 4, -1, -7, -5, 0, 0, -3, -5, -2, 0, 0, -2, -5, -5, -2, 0, 0, -2, -5, -2, 0, 1, 0, 0, 0, 0, -1, -2, -2, -2, -2, -2, -3, -3, -1, -1, -3, -6, -5, -1, -1, -3, -7, -8, -6, -3, -5, -8, -9, -6, -2, -3, -6, -6, -2, -1, -5, -8, -9, -7, -5, -6, -8, -8, -5, -2, -5, -8, -9, -6, -3, -3, -5, -7, -8, -8, -6, -3, -6, -9, -9, -6, -2, -1, -2, -6, -6, -5, -5, -6, -3, -2, -3, -7, -5, -1, 0, -2, -3, -3, -5, -5, -3, -2, -3, -3, -2, -3, -5, -3, -2, -3, -6, -6, -3, -3, -6, -6, -5, -2, -2, -2, -2, -2, -2, 0, 0, -1, -3, -3, -2, -3, -5, -5, -5, -5, -5, -3, -3, -6, -6, -3, -3, -3, -3, -5, -7, -7, -5, -1, 0, -3, -6, -5, -1, 0, -2, -7, -8, -8, -7, -9, -13, -10, -3, 0, -2, -9, -10, -8, -6, -6, -6, -7, -8, -8, -9, -10, -9, -6, -5, -6, -7, -8, -9, -9, -7, -5, -7, -12, -13, -9, -8, -6, -6, -7, -12, -13, -9, -7, -7, -8, -8, -6, -5, -8, -10, -12, -8, -8, -10, -12, -10, -10, -10, -10, -8, -9, -12, -12, -8, -7, -7, -6, -5, -3, -5, -7, -8, -8, -6, -7, -12, -12, -7, -6, -9, -12, -9, -8, -10, -10, -7, -6, -8, -9, -8, -7, -7, -7, -9, -10, -10, -8, -8, -8, -8, -7, -7, -7, -7, -6, -6, -7, -7, -6, -5, -6, -8, -8, -8, -10, -13, -12, -8, -8, -9, -10, -8, -7, -9, -10, -9, -8, -8, -7, -5, -5, -5, -5, -5, -6, -6, -1, 1, 0, -5, -7, -5, 0, 0, -2, -5, -5, -3, -2, -2, -2, -2, 0, 0, -1, -1, 1, 2, 0, -2, -3, -3, -2, 1, 5, 2, -1, -1, 0, 1, 1, 1, 0, 0, 0, 2, 1, 0, 0, 0, 0, -1, -1, -1, -3, -3, 0, 2, 2, 0, 0, 2, 5, 4, 1, 0, 0, 1, 2, 4, 4, 4, 1, 0, 0, 2, 6, 7, 5, 2, 2, 5, 6, 4, -1, -2, 1, 7, 9, 6, 2, 0, 1, 4, 5, 5, 4, 2, 1, 0, 0, 1, 4, 2, -1, -2, 1, 5, 4, 0, -1, 0, 2, 4, 4, 2, 1, 0, 0, 0, 0, 0, -1, -1, 0, 2, 5, 4, 0, 0, 0, 2, 2, 0, -1, 0, 0, 0, 0, 0, 2, 5, 4, 4, 6, 5, 2, 0, 2, 4, 4, 4, 5, 5, 5, 5, 5, 6, 6, 5, 2, 1, 2, 5, 7, 6, 4, 2, 4, 6, 6, 5, 2, 2, 4, 6, 9, 9, 8, 5, 2, 5, 9, 9, 6, 4, 5, 6, 6, 6, 8, 8, 7, 7, 6, 5, 6, 9, 11, 8, 6, 7, 9, 11, 9, 7, 6, 8, 12, 12, 8, 6, 7, 12, 13, 13, 13, 13, 11, 9, 9, 12, 12, 9, 8, 11, 14, 13, 9, 8, 11, 12, 9, 8, 9, 11, 7, 5, 7, 12, 13, 11, 8, 9, 13, 13, 11, 9, 11, 13, 13, 8, 4, 5, 11, 13, 12, 11, 12, 12, 12, 13, 13, 8, 5, 8, 13, 12, 6, 6, 12, 13, 11, 7, 8, 9, 7, 6, 6, 7, 8, 9, 11, 9, 6, 6, 7, 7, 6, 6, 6, 4, 2, 4, 4, 2, 1, 1, 1, 2, 4, 5, 4, 1, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 1, 5, 2, -1, -3, -1, 0, -2, -3, -1, 0, -1, -5, -3, -3, -6, -7, -5, -6, -9, -9, -5, -5, -8, -9, -6, -6, -7, -5, -2, -3, -7, -8, -6, -6, -6, -6, -6, -8, -8, -5, -2, -6, -10, -8, -3, -3, -7, -6, -3, -5, -6, -6, -7, -10, -10, -6, -3, -7, -10, -9, -7, -6, -2, -1, -3, -8, -9, -6, -3, -5, -6, -3, -2, -3, -3, -1, -1, -2, -1, 0, -1, -3, -2, 0, -1, -2, -2, -3, -7, -6, -2, 0, -3, -5, -3, 0, 0, 1, 2, 2, 0, 0, 2, 6, 6, 4, 1, 1, 1, 4, 5, 6, 4, 0, -1, 0, 1, 2, 4, 4, 4, 2, 2, 2, 2, 5, 6, 6, 4, 2, 5, 6, 6, 6, 4, 0, 1, 5, 7, 5, 4, 7, 9, 6, 5, 7, 9, 8, 7, 8, 9, 9, 8, 7, 6, 5, 5, 7, 8, 7, 4, 2, 4, 6, 7, 6, 5, 6, 6, 6, 5, 2, 1, 1, 1, 1, 0, 0, 2, 2, 0, 0, 1, 1, 0, 1, 2, 2, -1, -3, -2, 0, 2, 2, 4, 4, 0, -1, -1, 0, 0, -1, -2, -5, -6, -3, -1, -1, -2, -1, 0, -2, -5, -5, -3, -3, -5, -5, -5, -5, -5, -5, -5, -6, -6, -2, -2, -5, -9, -9, -8, -7, -6, -5, -5, -6, -5, -2, -1, -5, -8, -7, -3, -2, -6, -7, -6, -7, -10, -13, -9, -6, -5, -6, -6, -6, -5, -5, -6, -7, -7, -7, -9, -12, -12, -8, -7, -7, -8, -7, -8, -9, -9, -7, -7, -12, -14, -10, -8, -13, -16, -15, -12, -10, -12, -13, -14, -13, -8, -5, -6, -8, -12, -12, -13, -14, -14, -13, -12, -12, -15, -17, -18, -17, -17, -17, -16, -13, -12, -12, -13, -14, -13, -13, -13, -15, -15, -14, -14, -15, -15, -14, -14, -15, -13, -12, -13, -16, -15, -9, -8, -12, -14, -12, -8, -8, -10, -12, -10, -9, -8, -7, -8, -13, -14, -10, -6, -5, -7, -6, -6, -7, -9, -10, -9, -7, -7, -7, -7, -5, -2, -2, -5, -6, -6, -6, -6, -6, -6, -6, -6, -7, -6, -3, -3, -3, -2, -1, 0, -2, -6, -8, -7, -3, -1, -1, -5, -7, -6, -3, -3, -3, -3, -3, -6, -7, -3, -1, -3, -5, -1, 0, -3, -5, -3, -2, -6, -8, -5, -2, -2, -3, -3, -3, -6, -8, -7, -3, 0, -1, -3, -6, -5, -1, 0, -1, -3, -5, 0, 1, -1, -8, -9, -5, -1, -2, -3, -3, -2, -3, -6, -5, -5, -6, -7, -8, -7, -3, -1, -2, -7, -9, -9, -6, -3, -5, -7, -9, -10, -12, -10, -10, -14, -16, -15, -12, -12, -10, -7, -6, -9, -12, -8, -6, -8, -13, -14, -13, -10, -7, -6, -7, -9, -9, -7, -7, -9, -13, -15, -15, -15, -15, -16, -16, -14, -10, -9, -12, -14, -13, -9, -7, -8, -10, -12, -12, -12, -9, -9, -9, -9, -6, -2, -1, -2, -2, 0, 0, -3, -6, -5, -3, -5, -7, -6, -2, -2, -5, -5, -2, -3, -5, -3, 0, 0, -2, -5, -5, -2, 0, 0, 0, -1, -1, -1, -1, 0, 2, 5, 2, 0, 0, 1, 1, -2, -3, 0, 0, -2, -5, 0, 5, 5, 1, 0, 1, 5, 9, 11, 6, 4, 6, 11, 11, 6, 4, 5, 5, 4, 4, 5, 6, 6, 6, 6, 7, 7, 6, 6, 6, 4, 2, 4, 8, 7, 2, 0, 0, 1, 4, 5, 5, 4, 2, 4, 5, 7, 9, 9, 6, 1, 0, 2, 4, 4, 5, 5, 4, 1, 1, 1, 4, 5, 6, 5, 4, 2, 2, 2, 2, 5, 5, 4, 2, 1, 1, 1, 2, 4, 4, 1, 0, 0, 1, 2, 2, 2, 1, 0, 1, 5, 5, 1, 0, -1, -2, -3, -2, 0, -1, -3, -5, -1, 0, 0, -1, -2, -2, -2, -1, -1, -1, -2, -3, -2, -2, -1, -1, -2, -5, -5, -1, 0, 0, -1, 0, 0, 0, 0, -1, -2, -2, 0, 2, 0, -3, -5, 0, 2, 1, 0, -2, -1, 0, 0, -1, -1, -1, -3, -3, -2, 0, 0, -1, 0, 2, 1, 0, -2, -2, -2, -2, -1, 0, 0, -1, 0, 1, 0, -1, 0, 2, 1, -1, -2, 0, 1, 0, -1, -2, -3, -5, -3, -1, -1, -2, -6, -6, -1, 1, 2, 0, -2, -1, 2, 4, 0, -2, -1, 0, 0, 0, 0, 0, 0, 2, 7, 8, 4, -1, -1, 2, 6, 5, 0, -1, 0, 2, 2, 0, -1, -2, -2, -2, 0, 0, -1, -1, 1, 5, 5, 4, 0, 0, 0, 0, 1, 1, 0, -2, -5, -3, 0, 1, -3, -5, 0, 2, -3, -10, -8, -1, 0, -6, -7, -5, -2, -3, -5, -3, -3, -5, -5, -3, -5, -6, -3, 0, 0, -1, -2, -3, -5, -5, -5, -6, -8, -8, -6, -6, -7, -6, -5, -5, -8, -8, -3, -1, -6, -10, -8, -5, -3, -5, -5, -5, -6, -2, 1, 0, -3, -3, 0, 1, -2, -6, -3, 0, 0, -3, -2, 0, 1, 0, 0, -1, -2, 0, 0, 0, -5, -6, -2, 1, 0, -2, -3, -1, 0, 1, 1, 2, 1, 0, 0, 0, 0, 1, 2, 0, -2, -1, 2, 2, 0, 0, 0, -1, -2, 0, 1, -1, -2, 0, 0, -2, -1, 0, 0, -5, -6, -3, -2, -2, -3, -3, -3, -1, 2, 4, 0, -1, 0, 2, 1, 0, 0, 2, 0, -5, -5, -2, -1, -1, -1, -2, -5, -6, -1, 2, 1, -3, -7, -7, -6, -1, 1, 4, 4, 4, 4, 5, 5, 5, 2, -3, -12, -15, -13, -7, 0, 5, 8, 2, -6, -8, -5, -1, 0, 1, 1, -1, -5, -6, -6, -3, -1, 0, 0, 0, 0, -1, -3, -3, 0, 1, 0, -5, -6, -2, 0, -1, -5, -5, -5, -3, -2, -3, -5, -5, -1, 0, -3, -8, -8, -8, -7, -6, -5, -7, -9, -8, -6, -3, -5, -6, -5, -3, -2, -3, -5, -3, -2, -2, -3, -1, 0, -2, -8, -8, -2, 0, -2, -3, -3, -6, -6, -3, -2, -5, -6, -3, -2, -2, -1, -1, -1, -1, 0, 0, -2, -2, 0, 0, 0, -1, -2, -5, -5, -2, -1, -1, -1, -2, -2, -2, -1, -2, -5, -7, -6, -2, -3, -6, -6, -1, 2, 1, -2, -5, -2, 0, 1, 1, 1, 1, 1, 0, 0, -1, 0, 4, 6, 4, 0, 0, 4, 6, 5, 1, 0, 0, 0, 0, 1, 2, 2, 1, 0, 1, 4, 6, 6, 4, 1, 1, 4, 5, 5, 5, 5, 5, 4, 2, 2, 4, 5, 6, 6, 5, 5, 5, 4, 1, 2, 5, 6, 5, 2, 2, 4, 5, 5, 4, 5, 6, 7, 6, 5, 5, 5, 4, 4, 5, 5, 5, 5, 5, 2, 1, 4, 7, 6, 4, 4, 7, 9, 8, 5, 2, 2, 6, 7, 4, 0, 0, 2, 7, 7, 4, 2, 4, 6, 6, 2, 1, 2, 2, 0, 0, 0, 2, 5, 5, 1, 0, 0, 2, 2, 2, 1, 0, 0, 0, 1, 2, 1, 0, 0, 2, 4, 0, 0, 1, 4, 4, 1, 0, 0, 0, 0, 0, -1, -1, 0, 0, -1, -2, -2, -2, -1, -1, -1, -2, -2, -1, 0, -2, -3, -2, -1, -2, -2, -1, -1, -3, -3, -2, -1, -2, -5, -5, -2, 0, 0, -2, -6, -6, -5, -2, -2, -3, -5, -3, -2, -3, -6, -5, -3, -2, -2, -2, -2, -2, -2, -2, -2, -2, -3, -3, -1, -1, -2, -5, -3, 0, 0, -2, -3, -3, -1, 0, -1, -3, -6, -5, -1, -1, -3, -2, 0, -1, -3, -2, -1, -2, -3, -3, -3, -3, -2, 0, -1, -3, -3, -2, -1, -1, 0, 0, -1, -2, -3, -6, -6, -3, -1, -3, -7, -6, -2, -1, -3, -6, -6, -3, -2, -1, -1, -1, -3, -5, -3, -1, 0, 0, -2, -5, -3, -1, 0, -1, -2, -2, -2, -1, -1, 0, 0, -1, -3, -3, -1, 0, 0, -1, -1, -1, -2, -2, -3, -3, -2, 0, 0, -1, -2, -3, -1, 0, 0, 0, 0, 0, -1, -2, -1, 0, 0, -1, -5, -5, -2, -1, -2, -3, -5, -5, -3, -2, -2, -1, 0, 0, -1, -2, -2, -1, 0, 0, -1, 0, 2, 1, -1, -3, -1, 0, 0, -2, -2, 0, 0, 0, 0, -1, -5, -3, 0, 5, 2, -2, -2, 0, 2, 1, 0, 0, -1, -1, 0, 4, 2, -1, -2, 0, -1, -3, -2, 0, 2, 2, 1, 0, -1, 0, 5, 2, -2, -6, -2, 0, -2, -3, -1, 0, -5, -8, -5, -1, -2, -7, -6, -3, -3, -6, -6, -5, -6, -6, -3, -2, -3, -5, -5, -5, -6, -6, -5, -5, -6, -7, -7, -7, -7, -6, -5, -6, -7, -5, -2, -5, -9, -10, -7, -5, -5, -5, -6, -8, -9, -7, -6, -7, -8, -7, -7, -8, -8, -7, -5, -6, -9, -12, -12, -9, -9, -10, -12, -12, -12, -9, -7, -6, -8, -10, -12, -7, -3, -3, -7, -10, -10, -7, -2, -2, -6, -9, -8, -5, -3, -5, -6, -6, -5, -3, -3, -6, -6, -3, -2, -3, -7, -7, -3, -1, -1, -5, -6, -3, 0, 1, 0, -3, -5, -1, 1, 1, 0, -2, -3, -3, -2, 0, 1, 0, 0, -2, -5, -5, -2, -1, -3, -5, -1, 1, 0, -1, -3, -5, -3, -1, 1, 1, 0, -3, -6, -5, -3, -2, -3, -3, -3, -3, -3, -3, -2, -3, -5, -3, -1, -1, -2, -5, -5, -2, 0, 0, 0, -3, -7, -6, -3, 0, 0, -2, -5, -6, -3, -1, -2, -3, -3, -2, -2, -2, -3, -5, -5, -2, 0, 0, -2, -5, -3, -1, 0, 0, 0, 0, -1, -2, -3, -3, -2, -2, -3, -5, -5, -2, -1, -1, -2, -3, -3, -3, -3, -2, -1, 0, -1, -3, -3, -2, -1, -2, -5, -6, -5, -2, 0, 0, 0, -1, -2, -1, 0, 0, 0, 2, 5, 2, -2, -1, 2, 1, -5, -7, -2, 1, 1, 0, 0, -2, 0, 2, 4, 0, -3, -1, 1, 1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -3, -2, 0, 0, -2, -3, -1, 0, 0, 2, 4, 0, -5, -5, -1, 0, 0, 0, 2, 2, 0, 0, 0, 1, 0, -1, 0, 2, 5, 2, 0, 0, 1, 0, -2, -1, 2, 4, -1, -6, -3, 2, 4, 0, -1, 0, 1, 1, 0, 0, 0, 2, 4, 2, 0, -2, 0, 2, 4, 1, 0, 0, 2, 2, 0, -1, 0, 1, 0, -3, -3, 0, 2, 2, 0, 0, 0, 1, 4, 5, 4, 0, 0, 1, 4, 2, 0, 0, 1, 1, 0, 0, 4, 5, 1, 0, 2, 6, 4, 1, 1, 5, 4, 0, 0, 4, 5, 4, 2, 4, 4, 2, 2, 4, 4, 2, 2, 2, 4, 5, 5, 2, 4, 7, 7, 4, 2, 8, 12, 6, 0, 1, 6, 7, 4, 5, 6, 5, 2, 5, 9, 9, 5, 1, 4, 5, 4, 4, 6, 6, 4, 4, 7, 8, 5, 1, 2, 7, 7, 5, 4, 4, 4, 4, 4, 2, 1, 2, 5, 4, 2, 4, 6, 5, 4, 4, 4, 2, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 2, 1, 0, 0, 2, 2, 0, -1, 0, 1, 0, -1, 0, 2, 0, 0, 0, 1, 1, 1, 2, 2, 1, 2, 2, 1, 1, 2, 4, 4, 6, 6, 1, -3, -1, 4, 6, 4, 1, 1, 1, 1, 2, 2, 1, 0, -1, -1, 0, 1, 0, -1, 0, 2, 0, -2, 0, 2, 2, 0, -1, 0, 0, -1, -1, 0, 1, 1, 1, 0, 0, 0, 0, 2, 2, 1, 1, 0, -1, -1, 0, 0, -2, -2, 0, 1, -1, -5, -2, 0, 0, -1, -2, -1, 0, -1, -2, -3, -3, -2, -1, -2, -5, -7, -5, -1, 0, -3, -7, -8, -5, -1, -2, -8, -10, -7, -2, -1, -2, -3, -3, -6, -7, -6, -2, -3, -6, -6, -5, -5, -5, -2, -1, -5, -8, -6, 0, 0, 0, -3, -5, -7, -5, -1, -1, -5, -5, -2, -1, -1, -2, -5, -7, -7, -5, -3, -5, -5, -2, -2, -3, -3, -1, -1, -3, -3, 0, 0, -3, -7, -5, -1, -3, -6, -5, -3, -5, -6, -5, -3, -6, -8, -8, -8, -7, -6, -5, -5, -5, -7, -7, -6, -3, -3, -8, -12, -12, -7, -3, -2, -3, -6, -7, -6, -5, -3, -3, -3, -3, -6, -6, -3, -1, -2, -5, -6, -5, -3, -3, -5, -5, -2, -2, -5, -5, -3, -2, -3, -5, -5, -5, -6, -5, -2, -1, -5, -7, -5, -2, -2, -3, -3, -2, -5, -7, -6, -3, -3, -6, -5, -2, -2, -3, -5, -2, -2, -3, -5, -5, -3, -5, -6, -7, -6, -5, -7, -8, -9, -8, -7, -6, -6, -6, -7, -9, -9, -7, -6, -8, -10, -10, -9, -9, -9, -8, -9, -12, -9, -5, -6, -13, -13, -7, -5, -8, -10, -9, -8, -12, -14, -13, -9, -9, -12, -14, -14, -13, -12, -9, -8, -9, -13, -14, -13, -12, -9, -9, -12, -13, -9, -5, -5, -9, -13, -14, -12, -10, -10, -10, -10, -12, -13, -14, -12, -9, -7, -8, -10, -12, -9, -7, -8, -10, -13, -13, -10, -8, -8, -8, -8, -7, -5, -5, -7, -9, -10, -9, -9, -7, -6, -7, -9, -10, -9, -7, -7, -8, -9, -7, -3, -5, -7, -8, -6, -2, -1, -2, -6, -7, -7, -5, -3, -5, -7, -6, -3, -2, -3, -5, -3, -3, -5, -5, -2, 0, -2, -7, -7, -3, -2, -2, -2, -1, -2, -6, -5, -1, 0, -2, -7, -8, -6, -3, -2, -2, -3, -6, -6, -3, 0, 1, 0, -2, -2, 0, 0, 0, -3, -5, -1, 0, -1, -5, -5, -1, 0, -2, -3, -3, -3, -2, 0, 0, -1, -3, -3, -1, -2, -2, 0, 2, 1, -1, -1, 0, 0, -2, -5, -5, -2, 0, 0, -1, -2, -2, 0, 0, 0, -1, 0, 4, 2, -1, -3, -1, 2, 2, -1, -3, -1, 1, 2, 0, -1, 0, 1, 1, 0, 0, 1, 2, 0, -1, 0, 2, 4, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -2, 0, 4, 2, -2, -2, 4, 6, 0, -5, -3, 0, 0, 0, 0, -2, -2, 0, 0, -3, -5, -1, 1, 0, 0, 0, 0, 1, 2, 2, 1, 1, 2, 6, 6, 4, 1, 4, 5, 2, 1, 4, 6, 5, 5, 6, 7, 8, 7, 5, 2, 2, 5, 6, 5, 2, 4, 5, 6, 6, 5, 2, 1, 1, 4, 6, 2, 0, 2, 6, 6, 2, 1, 5, 6, 5, 4, 6, 9, 9, 9, 9, 8, 5, 7, 12, 12, 7, 6, 8, 11, 9, 9, 11, 11, 7, 6, 6, 8, 8, 7, 6, 5, 4, 5, 7, 8, 7, 6, 4, 4, 4, 5, 5, 4, 2, 5, 7, 7, 6, 7, 9, 8, 6, 7, 12, 12, 8, 6, 7, 8, 8, 6, 5, 5, 4, 4, 4, 4, 2, 1, 1, 4, 6, 5, 4, 2, 4, 6, 7, 6, 1, 0, 0, 2, 4, 2, 0, 0, 0, 2, 5, 5, 2, 0, 0, 0, 0, 1, 4, 4, 2, 1, 1, 2, 5, 5, 1, 0, 0, 2, 4, 2, 1, 1, 2, 4, 4, 4, 2, 0, 0, 0, 0, 0, 2, 4, 1, -1, -2, 0, 2, 1, -1, -1, 0, 0, -1, -3, -1, 0, 1, 0, -1, -2, 0, 2, 2, -1, -6, -3, 0, 1, -1, -2, -1, 0, 0, 0, 0, -1, -1, 0, 0, -1, -2, -1, 0, 0, -2, -2, 0, 0, -2, -3, 0, 1, 0, -1, 0, 1, 1, 0, -2, -3, -1, 1, 0, -1, -3, -3, -2, -2, -2, -2, -2, -1, 0, 0, -1, -3, -1, 0, 0, -3, -5, -2, 0, 0, -1, -1, 0, 0, 1, 1, 0, -1, -2, -2, -1, 0, 0, -2, -5, -3, -1, 0, -1, -5, -5, -2, -1, -5, -7, -6, -2, -2, -3, -5, -3, -1, 0, 0, 0, 0, -1, -2, -2, -1, 0, -1, -1, 0, 0, -2, -5, -3, 0, 0, -1, -2, -1, 0, 0, -1, -3, -3, -3, -3, -3, -5, -5, -2, -1, -3, -5, -3, -2, -3, -3, -2, -2, -3, -5, -6, -5, -2, -2, -3, -6, -5, -2, 0, -2, -5, -6, -5, -3, -3, -6, -7, -6, -5, -7, -7, -2, 0, -1, -6, -5, -2, -2, -5, -6, -6, -6, -5, -3, -2, -2, -2, -2, -2, -2, -3, -3, -2, -1, -1, -1, -2, -3, -1, 0, 1, 0, -3, -5, -2, -1, -2, -2, 0, 0, -3, -5, -2, 0, -1, -2, -3, -1, 0, 1, 0, -2, -1, 2, 1, -2, -3, 1, 4, 1, -1, -2, 0, 1, 1, 0, -1, -3, -2, 0, 1, 0, -3, -3, -1, 0, 0, -2, -2, -2, -1, -1, -1, -2, -3, -5, -6, -6, -6, -5, -2, -2, -3, -6, -5, -2, -2, -3, -2, -1, -3, -5, -2, -1, -6, -9, -8, -3, -3, -6, -6, -2, -2, -3, -3, -2, -2, -3, -1, 0, 0, -1, -2, -3, -5, -6, -5, -3, -3, -3, -1, -2, -5, -6, -2, -2, -5, -5, -2, 0, 0, -1, -1, -1, -2, -3, -3, -3, -3, -3, -3, -3, -3, -1, 0, -2, -3, -1, 0, -5, -7, -1, 4, 0, -5, -5, -1, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -3, -1, 0, 1, 0, 0, 0, 0, -1, -1, -1, -2, -3, -3, -3, -3, -3, -3, -2, -1, -1, -2, -3, -2, 0, 0, 0, -3, -5, -2, 0, 0, -2, -2, -1, -2, -3, -3, -2, -2, -2, -1, -1, -2, -2, -3, -3, -3, -2, -1, -2, -6, -7, -6, -3, -2, -3, -6, -5, -3, -3, -5, -5, -3, -6, -9, -8, -5, -5, -7, -6, -2, -2, -6, -8, -8, -7, -6, -6, -8, -8, -6, -5, -6, -8, -7, -6, -6, -8, -10, -10, -8, -6, -5, -6, -8, -10, -10, -7, -5, -3, -5, -7, -7, -6, -3, -3, -6, -7, -8, -6, -6, -7, -8, -7, -5, -6, -8, -9, -7, -6, -5, -3, -3, -5, -6, -6, -2, 0, -1, -6, -6, -3, -1, -2, -3, -6, -6, -5, -3, -3, -3, -5, -2, -1, 0, -1, -2, -2, -2, -3, -3, -3, -1, 0, -1, -3, -3, 0, 0, -2, -5, -1, 1, -1, -7, -8, -3, -2, -3, -5, -3, -2, -2, -1, -1, -3, -5, -2, -1, -3, -6, -3, 0, 0, -2, -2, -1, -1, -2, -2, -2, -1, -1, -1, -2, -3, -2, -1, -2, -3, -3, -1, 0, 0, -3, -6, -5, -1, -1, -5, -6, -2, 0, 0, -1, -1, 0, 0, -1, -2, -3, -3, -2, -1, -2, -2, -1, 0, 0, -2, -3, -1, 0, -1, -2, -1, -2, -3, -2, -1, -1, -2, -2, -1, 0, 0, 0, -2, -3, -2, -1, -3, -5, -1, 0, -1, -2, 0, 1, 1, 0, 0, -2, -3, -1, 0, -1, -2, -1, -1, -2, -1, 2, 2, 0, -1, 0, 1, 0, -2, -3, -1, 1, 0, -2, -3, -1, 0, 0, 0, 0, 2, 1, -1, -1, 0, 0, 0, 0, 1, 0, -2, -2, 0, 2, 1, 0, 0, 0, 0, 0, 1, 2, 0, -1, -1, 1, 2, 1, 0, 0, 0, 0, -1, -3, -2, 1, 4, 1, -2, -3, -2, -1, -1, 0, 0, 0, 0, 1, 1, 0, 0, 1, 1, 0, 0, -2, -2, 0, 2, 0, -3, -3, -1, 0, 0, 0, -2, -2, -1, 1, 1, -1, -1, 0, 2, 2, 0, -1, 0, 0, 0, -1, -1, -1, -2, -3, -2, 0, -1, -3, -5, 0, 2, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, -2, -1, 0, 1, 0, -1, 0, 0, 1, 1, 1, 1, 0, 1, 4, 5, 2, 0, -1, 0, 2, 2, 0, 0, 1, 2, 2, 1, 0, 0, 0, 0, 0, 1, 4, 4, 2, 1, 1, 2, 2, 1, 0, 0, 0, 2, 4, 1, 0, 0, 0, 1, 0, 0, 1, 2, 1, 0, 0, 0, 0, 1, 4, 4, 1, 0, 2, 6, 5, 2, 0, 0, 0, 0, 1, 1, 1, 1, 2, 1, 1, 2, 5, 5, 2, 1, 0, 0, 0, 1, 0, 0, 1, 4, 2, 1, 2, 4, 2, 1, 1, 1, 0, 0, 0, 1, 1, 1, 1, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, 0, 2, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 2, 2, 0, -2, -1, 0, 0, 0, -1, -2, -2, -1, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, -2, -2, 0, 0, -2, -3, -1, 0, -1, -1, -1, -2, -5, -5, -2, -1, -1, -3, -5, -5, -2, -2, -5, -6, -3, -1, -2, -6, -7, -5, -3, -3, -6, -7, -7, -7, -6, -5, -5, -5, -5, -5, -5, -5, -5, -5, -5, -5, -6, -5, -2, -5, -7, -7, -5, -3, -6, -8, -6, -3, -5, -7, -7, -6, -7, -8, -7, -6, -7, -7, -6, -3, -3, -5, -3, -3, -3, -1, 0, -2, -6, -5, -2, -1, -2, -5, -6, -7, -5, -3, -5, -6, -5, -3, -6, -7, -5, -3, -3, -5, -3, -1, -3, -6, -6, -5, -5, -6, -6, -3, -3, -3, -3, -3, -3, -2, 0, 0, -3, -5, -3, -1, -2, -2, -3, -5, -6, -5, -2, -1, -3, -5, -5, -2, -2, -5, -5, -2, 0, 0, -2, -3, -1, 0, 0, 0, 0, 0, -1, -2, -1, 0, 1, 0, -1, -1, 0, 0, -1, 0, 0, 1, 0, -1, -1, 0, 2, 0, -2, -1, 0, 0, -2, -3, 0, 1, 1, 0, -2, -1, 1, 1, 0, -1, -1, -1, -3, -5, -1, 0, 0, -3, -3, -2, 0, 0, -1, -2, -2, 0, 0, -2, -5, -3, -2, -2, -2, -1, 0, 0, -1, -3, -3, -2, 0, 0, -2, -5, -6, -5, 0, 2, 1, -1, -3, -2, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, -2, -3, -3, -2, -1, -1, -1, -2, -3, -3, -2, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -3, -3, 0, 1, -1, -5, -3, -1, 0, -1, -3, -5, -3, 0, 0, -1, -5, -3, 0, 0, -1, -3, -3, -1, -1, -2, -3, -1, -1, -2, -5, -3, -2, -2, -2, -2, -1, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -3, -3, -1, 0, -1, -1, 0, 0, 0, 1, 2, 0, 0, 0, 2, 4, 0, -2, -2, -2, -2, -1, 0, 0, 0, 0, 0, -1, -2, -1, 0, 0, 0, 1, 2, 2, 2, 1, 1, 0, 0, 1, 1, 0, 0, 1, 1, 1, 2, 2, 1, -1, 0, 2, 4, 0, -1, 1, 5, 4, 0, -1, 1, 2, 0, 0, 0, 1, 0, -1, -1, 0, 0, 0, 0, 0, 1, 2, 2, 1, 1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 1, 2, 2, 0, 0, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, -2, -1, 0, 1, 0, -1, -1, -1, 0, 0, 1, 0, -2, -3, -2, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, -1, -2, -2, -1, -1, -1, 0, 1, 0, -3, -5, -3, -1, -1, -3, -6, -5, 0, 0, -1, -2, 0, 0, -2, -6, -6, -5, -3, -3, -3, -2, -5, -7, -7, -3, -1, -2, -5, -6, -3, -1, -1, -2, -3, -3, -2, -2, -2, -3, -3, -3, -3, -5, -5, -3, -6, -7, -5, 0, 2, -1, -5, -3, 0, 0, -1, -2, -2, -1, -1, -2, -2, -2, -3, -3, -2, -1, -1, -2, -1, 0, 0, 0, -1, -2, -2, -2, -1, -1, -1, 0, 0, -1, -2, -1, -1, -2, -2, 0, 0, -3, -7, -7, -5, -3, -5, -5, -5, -5, -3, -2, -1, -3, -3, -3, -3, -5, -5, -2, -1, -3, -5, -3, -1, -1, -3, -3, -2, -1, -1, -1, -2, -2, -2, -2, -3, -3, -2, -1, -1, -2, -3, -5, -2, -1, -2, -6, -7, -3, 0, 0, -2, -3, -3, -2, -2, -2, -3, -3, -2, -2, -3, -3, -1, 0, -1, -2, -2, 0, 0, -2, -2, -2, -2, -3, -2, -2, -3, -3, -3, -3, -2, -1, -1, -2, -3, -2, -2, -5, -5, -2, -1, -3, -3, 0, 0, 0, 0, -1, -5, -6, -3, -2, -2, -2, -2, -2, -2, -1, 0, 0, -1, -2, -2, -1, -1, -3, -3, -1, 0, 0, -1, -3, -3, -2, -1, -1, 0, 0, -2, -3, -3, -2, -2, -1, 0, 0, -2, -5, -3, 0, 1, 0, -3, -3, -2, -2, -2, 0, 0, -2, -6, -3, 0, 0, -2, -6, -6, -6, -5, -5, -6, -6, -2, 0, -2, -5, -5, -3, -2, -2, -1, -1, 0, 0, 0, -2, -3, -2, -1, -1, -1, -3, -6, -6, -1, 0, -1, -5, -6, -2, -1, -1, -2, -2, -2, -1, 0, -1, -2, -1, 0, 0, 0, -1, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, 1, 2, 2, 2, 2, 4, 1, 0, 0, 1, 0, 0, 0, 2, 2, 1, 0, 0, 0, 0, 0, 2, 4, 2, 0, 1, 4, 4, 0, -1, 0, 2, 1, 0, 0, 4, 4, 1, 0, 0, 0, -1, 0, 1, 1, 1, 2, 2, 2, 2, 1, 0, 0, 1, 1, 0, 1, 4, 4, 1, 0, 0, 0, -1, -1, 0, 4, 2, 0, 0, 0, 0, 0, 2, 4, 2, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -3, -1, 1, 1, 0, 0, 0, 1, 0, 0, 0, -1, -2, -3, -2, -2, -2, -2, -1, -1, -1, -1, -2, -3, -3, -1, -2, -5, -5, -2, 0, 0, -2, -2, -2, -2, -2, -2, -1, -2, -3, -5, -3, -1, 0, 1, 1, 1, 0, -1, 0, 0, -1, -6, -7, -3, 0, 0, -1, -2, -1, -1, -2, -2, -1, 0, -1, -3, -5, -3, -1, 0, -2, -5, -5, -2, 0, -1, -3, -3, -2, -3, -5, -5, -3, -3, -5, -3, -2, -2, -5, -7, -6, -2, 0, 0, -1, -2, -3, -2, -1, -2, -5, -6, -5, -5, -6, -6, -5, -3, -3, -3, -1, 0, -2, -5, -3, 0, 0, -1, -2, -2, -2, -1, 0, 0, -2, -5, -2, -1, -5, -7, -3, 1, 1, -3, -6, -3, -1, -1, -1, -1, -3, -3, 0, 2, 0, -2, -2, -2, -1, 0, 0, -1, -2, -2, -2, -5, -3, 0, 0, -2, -3, -2, -2, -2, -1, 0, -2, -6, -5, -1, 0, -1, -5, -6, -5, -2, -1, -1, -5, -7, -3, 0, 0, -1, 0, 0, -2, -5, -2, -1, -3, -5, -2, -1, -3, -5, -5, -5, -5, -3, -3, -3, -3, -3, -5, -3, 0, 1, 0, -3, -2, -1, -1, -1, 0, 0, 1, 2, 1, 0, -1, 1, 4, 4, 4, 4, 2, 0, 0, 0, -1, -2, -1, 0, -1, -5, -3, 0, 2, 0, -1, 0, 0, 0, 0, 0, 0, 1, 1, 0, -1, -1, 0, 1, 0, -1, -3, -3, -2, 0, 0, -1, -2, -1, 1, 4, 0, -2, 0, 4, 2, 0, -1, 1, 1, -1, -1, 0, 1, 0, -2, -1, 0, 2, 1, 0, -2, -2, 0, 0, 0, 0, 1, 1, 0, -1, -2, -2, -1, 0, 0, -3, -7, -3, 0, 0, -3, -3, -2, -3, -5, -3, -5, -8, -8, -5, -5, -9, -9, -3, -3, -8, -8, -2, 0, -2, -5, -2, 0, -1, -2, -1, 0, -2, -5, -5, -2, -1, -2, -3, -3, -2, -2, -2, -3, -3, -3, -2, -2, -5, -6, -5, 0, 0, -1, -3, -3, -1, 0, 0, -2, -2, 0, 1, -1, -5, -2, 0, 0, -2, -5, -2, 0, 1, 1, 1, 0, 0, 1, 2, 4, 4, 4, 2, 2, 2, 6, 6, 4, 1, 2, 5, 4, 0, 0, 2, 2, 0, -1, 0, 2, 2, 1, 1, 5, 6, 5, 4, 4, 5, 4, 2, 2, 2, 1, 0, 1, 4, 5, 1, 0, 0, 2, 2, 2, 2, 2, 2, 4, 6, 8, 7, 4, 2, 4, 5, 5, 4, 4, 4, 4, 2, 0, 0, 2, 5, 6, 6, 4, 2, 4, 7, 8, 6, 2, 1, 2, 4, 2, 1, 0, 2, 4, 2, 1, 4, 5, 1, -1, 0, 2, 2, 1, 2, 2, 1, 1, 4, 5, 4, 2, 1, 0, 0, 1, 1, -2, -6, -3, 1, 2, 0, 0, 2, 4, 1, 0, 0, 1, 2, 2, 2, 1, 1, 1, 2, 2, 0, -1, -2, -2, -2, -2, -2, -1, 0, 2, 4, 4, 1, 1, 0, 0, 0, 0, 0, 0, -2, -2, 0, 2, 2, 0, 0, 2, 6, 6, 4, 2, 4, 5, 1, 0, 2, 7, 8, 4, 0, -1, 0, 0, -1, -1, 1, 2, 0, -1, 0, 1, 0, -3, -3, 0, 2, 0, -5, -2, 2, 4, 0, -2, 0, 0, -1, -6, -7, -6, -6, -7, -9, -8, -5, -5, -9, -12, -7, -3, -5, -7, -7, -3, -2, -3, -6, -6, -2, -2, -5, -8, -7, -3, -1, -5, -8, -8, -3, 0, 0, 0, -1, -7, -9, -3, 0, -1, -7, -6, 0, 0, -3, -7, -3, 1, 2, 0, -2, -1, 0, 0, 0, -1, -2, -5, -3, -2, 0, -1, -2, -2, -2, -2, -3, -5, -5, -3, -1, -1, -3, -6, -5, -3, -5, -6, -5, -2, -1, -2, -3, -2, -1, -1, -2, -3, -3, -6, -6, -6, -6, -8, -8, -7, -7, -8, -10, -12, -12, -13, -12, -8, -5, -6, -8, -6, -2, -1, -2, -3, -3, -3, -2, 0, 0, -2, -2, 0, 1, 1, 0, 1, 2, 0, 0, 2, 6, 5, 2, 2, 4, 5, 5, 5, 5, 1, -1, -2, -1, -1, -2, 0, 4, 2, -1, -2, 0, 0, -5, -2, 0, 0, -1, 0, 1, 1, 2, 5, 4, 0, 0, 4, 4, 1, 1, 0, -3, -7, -7, -5, -3, -2, 0, -1, -3, -2, 1, 1, -1, -5, -3, -2, -2, -3, -3, -1, 0, 0, 0, 0, 1, 4, 5, 5, 4, 4, 5, 6, 5, 2, 2, 5, 2, 0, -1, -1, -3, -7, -7, -5, -3, -5, -5, -3, -3, -6, -3, 0, 0, -6, -8, -6, -7, -10, -10, -6, -3, -2, -1, 0, -2, -2, 1, 2, 1, 5, 7, 4, 0, 5, 14, 11, 0, -5, 0, 5, 6, 4, 0, -3, -6, -3, -2, -5, -6, 0, 7, 4, -3, -3, 0, 0, -6, -7, -3, -3, -5, -2, -1, -3, -8, -7, -2, 0, 2, 5, 5, 1, -1, 0, 8, 12, 9, 5, 1, 0, 0, 2, 5, 2, -6, -13, -15, -12, -8, -6, -6, -8, -10, -10, -6, -3, -6, -8, -8, -12, -15, -13, -7, -3, -3, -9, -15, -16, -9, -6, -12, -18, -15, -8, -9, -14, -15, -13, -14, -15, -10, -5, -6, -10, -9, -5, -3, -6, -2, 5, 5, -2, -7, -3, 1, 4, 4, 5, 5, 5, 8, 9, 7, 4, 2, 2, 4, 5, 6, 5, 2, 2, 2, 2, 1, 1, 1, 0, -2, -8, -12, -12, -9, -8, -6, -3, -1, -2, -5, -7, -5, -1, 0, -7, -15, -17, -14, -10, -12, -16, -15, -9, -8, -15, -22, -21, -16, -17, -21, -21, -17, -17, -23, -26, -25, -24, -25, -24, -23, -25, -32, -30, -17, -8, -12, -13, -3, 5, 2, 0, 4, 7, 4, 0, 1, 4, 2, 0, 0, 0, 2, 5, 0, -7, -10, -5, 5, 7, 2, 0, 2, 5, 2, -2, -3, -2, 0, 0, 0, -1, 0, 1, -1, -6, -6, -2, -2, -6, -5, 0, 0, -5, -8, -3, 0, -2, -7, -5, 1, 6, 7, 8, 6, -1, -9, -10, -7, -8, -10, -10, -7, -8, -15, -16, -10, -8, -10, -10, -3, 2, 4, 0, -1, -2, -1, 0, -1, -6, -8, -6, -3, -6, -8, -6, -1, -2, -6, -6, -2, -1, -1, 0, -1, -6, -6, 1, 4, -2, -7, 0, 5, 0, -3, -2, -2, -9, -12, -5, 2, 4, 1, 0, 2, 2, 2, 4, 4, 1, 0, 0, 2, 5, 4, 1, 0, 0, 0, 0, 1, 2, 2, 1, 0, -2, -2, 0, 0, -1, -2, -2, -3, -6, -8, -6, 0, 0, -5, -10, -10, -8, -7, -10, -10, -8, -6, -9, -13, -13, -9, -6, -7, -9, -8, -6, -3, -2, 0, 0, -3, -9, -9, -5, -1, -2, -7, -10, -10, -5, 0, -2, -7, -6, 0, 0, -1, 0, 6, 5, 0, -1, 2, 6, 1, -3, -3, 0, 4, 4, 2, 4, 6, 8, 8, 6, 4, 5, 7, 6, 5, 7, 11, 11, 8, 7, 9, 11, 13, 15, 14, 8, 7, 11, 14, 11, 8, 11, 15, 14, 11, 13, 15, 12, 8, 12, 15, 15, 15, 19, 17, 14, 16, 22, 23, 17, 14, 19, 22, 17, 12, 13, 19, 20, 17, 15, 15, 16, 16, 15, 13, 9, 9, 13, 13, 9, 9, 11, 11, 9, 7, 7, 6, 4, 4, 5, 6, 5, 2, 2, 4, 6, 6, 6, 5, 5, 6, 8, 8, 5, 4, 7, 11, 9, 5, 4, 9, 14, 15, 12, 11, 12, 14, 15, 13, 11, 13, 19, 20, 17, 17, 21, 23, 21, 16, 16, 21, 23, 22, 17, 16, 17, 21, 24, 23, 20, 16, 14, 13, 12, 14, 15, 14, 9, 6, 6, 6, 6, 6, 4, 0, -6, -7, -6, -6, -9, -13, -14, -14, -16, -18, -18, -18, -21, -25, -28, -26, -24, -25, -29, -31, -30, -28, -26, -28, -30, -31, -26, -21, -17, -20, -24, -25, -23, -22, -22, -20, -17, -17, -18, -17, -17, -18, -17, -13, -12, -15, -14, -8, -6, -6, -5, -2, -3, -7, -6, 0, 2, 0, -3, -5, -3, -3, -6, -7, -6, -3, -6, -9, -13, -13, -12, -8, -8, -10, -14, -15, -13, -10, -9, -9, -9, -12, -12, -6, -2, -5, -9, -9, -6, -6, -6, -5, -6, -10, -15, -12, -3, -1, -7, -9, -7, -7, -9, -7, 0, 0, -2, -6, -5, -2, -1, 0, 1, -2, -6, -5, 0, 1, -1, -5, -2, 4, 7, 1, -3, -1, 7, 7, 0, -7, -2, 4, 5, 0, -2, 0, 6, 6, 2, 1, 6, 9, 7, 4, 6, 14, 17, 15, 12, 13, 16, 19, 19, 20, 21, 21, 21, 20, 19, 19, 22, 27, 25, 22, 23, 29, 32, 29, 24, 24, 29, 30, 28, 24, 25, 28, 29, 28, 27, 27, 28, 28, 24, 22, 23, 27, 25, 22, 20, 20, 23, 24, 24, 24, 24, 27, 25, 22, 20, 21, 23, 21, 17, 17, 17, 17, 16, 16, 15, 12, 9, 9, 12, 9, 8, 9, 12, 9, 5, 4, 7, 8, 7, 6, 6, 7, 5, 2, 2, 4, 4, 2, 1, 0, 0, 0, 0, 0, 0, -2, -5, -5, -3, -3, -5, -6, -7, -9, -9, -7, -6, -7, -8, -8, -9, -10, -10, -9, -8, -10, -13, -13, -10, -10, -10, -10, -10, -12, -13, -13, -13, -13, -15, -15, -13, -13, -15, -18, -16, -13, -10, -13, -13, -12, -12, -13, -15, -14, -12, -10, -12, -14, -16, -17, -15, -13, -13, -14, -14, -14, -14, -15, -14, -13, -12, -12, -13, -13, -12, -13, -14, -13, -10, -10, -13, -14, -14, -13, -13, -13, -10, -8, -9, -12, -13, -12, -10, -10, -12, -12, -13, -13, -10, -9, -10, -13, -13, -10, -9, -9, -9, -9, -10, -12, -12, -10, -12, -13, -13, -10, -8, -8, -10, -13, -12, -12, -12, -13, -14, -13, -12, -10, -13, -13, -12, -8, -8, -10, -10, -9, -8, -9, -12, -13, -13, -10, -12, -13, -12, -9, -7, -8, -10, -10, -8, -8, -9, -10, -12, -12, -12, -12, -12, -10, -9, -9, -10, -10, -10, -10, -9, -9, -10, -10, -10, -10, -10, -10, -9, -8, -9, -10, -10, -8, -7, -8, -9, -9, -9, -9, -9, -9, -9, -9, -10, -10, -10, -10, -10, -9, -9, -8, -8, -7, -7, -7, -8, -8, -7, -7, -8, -8, -9, -9, -9, -8, -6, -6, -7, -9, -9, -7, -7, -9, -10, -9, -8, -8, -9, -9, -9, -9, -8, -8, -8, -8, -9, -9, -8, -8, -9, -9, -8, -8, -8, -8, -8, -7, -7, -8, -9, -10, -10, -9, -8, -8, -9, -9, -7, -7, -8, -9, -9, -8, -7, -8, -8, -8, -7, -7, -8, -8, -7, -6, -6, -7, -9, -9, -7, -5, -3, -6, -9, -9, -8, -7, -7, -7, -7, -8, -8, -7, -8, -9, -9, -7, -6, -7, -7, -7, -7, -7, -8, -8, -6, -5, -6, -7, -8, -8, -7, -6, -6, -6, -6, -6, -6, -7, -8, -8, -7, -6, -7, -7, -7, -5, -3, -3, -3, -5, -6, -6, -5, -5, -6, -6, -6, -6, -6, -6, -6, -6, -6, -6, -5, -5, -3, -3, -5, -7, -7, -6, -3, -3, -5, -5, -5, -5, -5, -6, -6, -3, -3, -5, -6, -6, -5, -3, -5, -6, -6, -3, -3, -5, -6, -6, -6, -5, -5, -5, -5, -6, -6, -5, -5, -5, -5, -3, -3, -3, -5, -5, -5, -5, -5, -5, -5, -3, -2, -3, -5, -5, -3, -5, -5, -5, -5, -5, -5, -5, -6, -6, -6, -5, -3, -3, -2, -2, -3, -5, -5, -5, -5, -5, -5, -3, -3, -3, -3, -3, -3, -3, -2, -2, -2, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -5, -5, -5, -5, -3, -2, -2, -3, -5, -3, -2, -1, -2, -3, -3, -3, -3, -3, -3, -2, -2, -2, -3, -3, -2, -2, -2, -2, -3, -3, -3, -2, -1, -2, -2, -1, -1, -3, -3, -2, -1, -2, -3, -3, -3, -3, -3, -3, -1, -1, -2, -3, -3, -2, -2, -2, -1, -1, -1, -2, -3, -3, -3, -2, -1, -1, -1, -2, -3, -3, -3, -3, -2, -2, -1, -1, -2, -3, -3, -1, 0, 0, -2, -3, -3, -2, -2, -2, -1, -1, -1, -2, -2, -2, -2, -2, -2, -2, -1, 0, 0, -1, -2, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, -1, -2, -1, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, 0, 0, -1, -2, -2, 0, 0, -1, -1, 0, 0, -1, -2, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, -2, -2, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -2, -2, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -2, -1, 0, 0, -1, -1, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 1, 0, -1, 0, 0, -1, -1, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, -1, 0, 1, 0, -1, 0, 0, 1, 0, -1, -2 };
+// IMA ADPCM blocks, see audio_adpcm.h
+static const uint8_t __in_flash("audio_thirty_sample_data") audio_thirty_sample_data[] = { 0, 0, 0, 0, 255, 255, 63, 23, 185, 25, 3, 156, 83, 184, 24, 160, 9, 1, 153, 156, 65, 2, 168, 113, 164, 28, 4, 172, 33, 129, 203, 48, 161, 40, 200, 56, 248, 13, 35, 1, 33, 200, 140, 32, 128, 17, 160, 153, 169, 120, 22, 202, 9, 8, 115, 147, 170, 186, 11, 35, 32, 168, 155, 252, 42, 163, 123, 21, 155, 34, 33, 216, 155, 129, 189, 57, 39, 185, 41, 52, 146, 153, 144, 10, 130, 173, 192, 159, 36, 136, 51, 218, 0, 137, 71, 168, 10, 200, 27, 5, 170, 51, 187, 16, 81, 148, 140, 3, 154, 145, 142, 36, 219, 32, 51, 249, 57, 4, 50, 248, 13, 18, 137, 136, 10, 128, 138, 84, 18, 201, 138, 32, 1, 136, 168, 188, 41, 70, 19, 203, 64, 163, 156, 152, 155, 2, 88, 135, 156, 51, 249, 9, 128, 32, 168, 57, 133, 170, 16, 129, 33, 176, 156, 2, 16, 146, 90, 21, 26, 135, 191, 49, 160, 24, 216, 57, 6, 0, 129, 153, 32, 145, 11, 19, 223, 25, 1, 35, 217, 137, 201, 40, 3, 40, 252, 45, 21, 153, 64, 162, 157, 128, 27, 6, 26, 20, 26, 22, 155, 67, 186, 9, 172, 50, 233, 32, 144, 25, 1, 17, 1, 168, 234, 42, 6, 137, 194, 142, 1, 40, 177, 59, 194, 11, 3, 33, 168, 2, 219, 235, 156, 17, 84, 168, 64, 163, 157, 50, 208, 41, 147, 42, 179, 143, 128, 187, 81, 132, 12, 21, 138, 19, 138, 5, 156, 17, 218, 9, 2, 24, 129, 89, 6, 154, 129, 10, 144, 115, 176, 98, 161, 25, 168, 186, 191, 40, 39, 161, 25, 35, 201, 26, 131, 205, 9, 129, 9, 1, 169, 16, 17, 193, 175, 17, 128, 16, 251, 74, 36, 136, 8, 152, 154, 34, 128, 50, 203, 49, 144, 217, 139, 71, 161, 175, 65, 145, 50, 177, 26, 224, 42, 133, 188, 8, 170, 114, 19, 32, 17, 8, 136, 24, 20, 255, 10, 1, 34, 129, 32, 232, 43, 164, 157, 129, 48, 162, 89, 132, 10, 176, 157, 128, 0, 129, 25, 18, 64, 147, 159, 16, 234, 187, 10, 129, 64, 54, 18, 201, 26, 3, 139, 52, 202, 137, 0, 68, 192, 156, 16, 51, 251, 41, 130, 155, 115, 130, 16, 192, 142, 128, 139, 17, 152, 82, 131, 139, 68, 184, 11, 145, 156, 35, 145, 16, 37, 176, 157, 168, 72, 163, 175, 66, 168, 64, 19, 144, 9, 145, 190, 49, 33, 35, 168, 128, 250, 157, 33, 171, 101, 144, 9, 144, 8, 50, 177, 171, 153, 82, 80, 39, 203, 81, 192, 11, 2, 136, 154, 8, 128, 81, 35, 152, 203, 10, 1, 0, 145, 174, 115, 147, 153, 0, 34, 250, 156, 0, 48, 55, 161, 138, 168, 157, 0, 186, 171, 154, 54, 128, 1, 137, 85, 184, 10, 251, 11, 129, 41, 23, 16, 131, 204, 24, 128, 83, 160, 41, 161, 156, 168, 41, 4, 48, 240, 43, 22, 8, 116, 0, 44, 0, 2, 25, 70, 130, 153, 153, 185, 42, 3, 64, 4, 136, 184, 121, 132, 58, 133, 157, 18, 155, 53, 184, 40, 234, 56, 194, 13, 51, 50, 178, 141, 147, 175, 1, 187, 68, 234, 25, 144, 8, 160, 41, 1, 152, 202, 173, 25, 132, 154, 2, 157, 50, 33, 178, 207, 50, 185, 16, 251, 155, 25, 34, 235, 10, 84, 3, 170, 67, 130, 136, 65, 194, 191, 136, 24, 131, 156, 67, 152, 97, 35, 152, 170, 33, 233, 42, 131, 204, 203, 40, 3, 153, 40, 69, 160, 139, 128, 203, 114, 5, 153, 8, 152, 152, 154, 36, 169, 41, 69, 184, 90, 147, 25, 161, 10, 200, 10, 233, 26, 162, 190, 250, 191, 138, 168, 72, 71, 36, 34, 51, 18, 0, 144, 171, 48, 216, 25, 36, 8, 84, 34, 33, 17, 34, 146, 40, 53, 34, 2, 249, 220, 203, 188, 172, 138, 169, 26, 17, 0, 1, 233, 186, 204, 189, 187, 172, 187, 170, 169, 137, 168, 154, 129, 187, 96, 53, 34, 65, 20, 200, 187, 171, 173, 138, 8, 99, 52, 68, 67, 51, 35, 34, 145, 9, 128, 152, 136, 136, 16, 36, 128, 187, 115, 6, 24, 50, 129, 169, 235, 190, 218, 188, 187, 202, 188, 154, 137, 136, 128, 152, 56, 22, 186, 137, 144, 205, 155, 0, 1, 32, 69, 82, 67, 66, 54, 35, 36, 34, 19, 24, 51, 17, 51, 1, 85, 34, 34, 83, 53, 34, 66, 18, 184, 156, 144, 219, 25, 129, 205, 153, 189, 154, 186, 8, 153, 2, 238, 170, 186, 170, 203, 155, 152, 171, 202, 139, 33, 16, 71, 51, 51, 129, 9, 68, 19, 66, 53, 128, 24, 161, 73, 71, 35, 52, 37, 146, 137, 0, 152, 187, 48, 225, 189, 202, 171, 137, 50, 84, 35, 234, 137, 168, 219, 10, 1, 233, 171, 154, 203, 155, 0, 32, 71, 18, 32, 17, 18, 84, 37, 1, 17, 192, 204, 171, 186, 25, 51, 51, 68, 54, 34, 65, 34, 1, 186, 222, 219, 187, 137, 66, 71, 52, 51, 51, 34, 1, 128, 136, 137, 186, 205, 155, 136, 17, 83, 53, 18, 16, 0, 16, 1, 32, 35, 250, 205, 220, 203, 203, 187, 170, 153, 137, 16, 17, 16, 1, 201, 235, 205, 188, 219, 186, 170, 153, 136, 17, 34, 67, 35, 83, 51, 49, 34, 2, 201, 155, 202, 170, 170, 115, 52, 68, 53, 52, 36, 18, 18, 128, 185, 186, 189, 186, 204, 170, 154, 136, 137, 66, 146, 187, 204, 205, 219, 187, 204, 187, 219, 203, 186, 186, 153, 137, 0, 17, 34, 52, 34, 66, 34, 50, 2, 49, 144, 41, 87, 84, 52, 69, 52, 50, 67, 50, 34, 17, 34, 19, 136, 152, 185, 174, 138, 137, 33, 66, 52, 34, 35, 152, 17, 251, 189, 235, 187, 189, 171, 186, 156, 16, 16, 99, 34, 50, 50, 50, 20, 129, 0, 152, 185, 174, 64, 53, 69, 67, 53, 35, 51, 36, 16, 1, 136, 136, 145, 34, 41, 0, 153, 16, 1, 1, 32, 21, 18, 128, 48, 192, 207, 204, 186, 205, 203, 170, 171, 203, 172, 153, 203, 172, 169, 184, 187, 152, 219, 187, 188, 171, 171, 24, 50, 50, 35, 49, 55, 83, 100, 51, 51, 52, 2, 0, 160, 43, 55, 49, 69, 35, 34, 66, 69, 36, 34, 84, 1, 152, 218, 170, 153, 170, 82, 35, 33, 50, 17, 184, 25, 232, 25, 251, 143, 184, 139, 217, 10, 2, 169, 170, 201, 207, 188, 171, 24, 100, 84, 52, 51, 51, 1, 144, 185, 171, 170, 235, 154, 152, 8, 69, 67, 53, 2, 1, 128, 168, 203, 170, 219, 203, 202, 203, 203, 203, 171, 169, 9, 17, 49, 18, 33, 200, 205, 203, 190, 203, 187, 203, 170, 8, 32, 68, 52, 53, 50, 34, 129, 136, 152, 170, 170, 188, 155, 185, 156, 82, 53, 53, 53, 67, 35, 34, 128, 152, 203, 188, 204, 203, 202, 186, 170, 154, 16, 51, 82, 35, 128, 185, 190, 189, 204, 203, 186, 171, 171, 154, 152, 8, 83, 68, 67, 67, 51, 34, 18, 18, 18, 34, 33, 34, 128, 114, 54, 84, 67, 83, 51, 51, 50, 17, 128, 170, 187, 219, 172, 186, 189, 172, 170, 154, 16, 50, 83, 2, 128, 154, 152, 238, 187, 186, 188, 204, 170, 169, 156, 16, 82, 68, 66, 67, 18, 17, 129, 136, 137, 169, 185, 173, 16, 1, 114, 55, 51, 68, 51, 35, 144, 128, 217, 171, 154, 153, 154, 169, 171, 169, 156, 0, 84, 2, 8, 192, 223, 171, 202, 172, 153, 152, 186, 204, 203, 154, 154, 56, 51, 66, 145, 172, 233, 172, 32, 129, 64, 130, 139, 160, 27, 37, 117, 36, 17, 2, 152, 187, 25, 19, 64, 71, 18, 1, 152, 33, 200, 97, 131, 48, 53, 144, 138, 35, 251, 41, 176, 58, 240, 12, 131, 156, 67, 152, 49, 200, 171, 255, 154, 202, 138, 1, 98, 84, 50, 51, 51, 18, 136, 153, 186, 189, 188, 172, 153, 8, 98, 36, 36, 35, 17, 0, 128, 186, 189, 188, 204, 187, 172, 186, 187, 170, 137, 48, 18, 67, 18, 144, 235, 188, 204, 203, 219, 187, 187, 172, 155, 25, 66, 84, 68, 35, 51, 35, 2, 0, 169, 204, 187, 189, 187, 170, 40, 99, 68, 52, 36, 35, 2, 128, 169, 189, 188, 204, 186, 171, 171, 137, 8, 49, 51, 36, 18, 160, 221, 219, 187, 173, 187, 187, 187, 187, 171, 171, 16, 99, 84, 52, 52, 67, 35, 34, 34, 129, 128, 153, 203, 171, 25, 115, 83, 69, 52, 67, 50, 18, 17, 153, 169, 235, 186, 187, 188, 170, 154, 24, 50, 53, 50, 20, 152, 201, 172, 203, 188, 170, 170, 186, 205, 153, 16, 0, 116, 51, 52, 51, 66, 18, 0, 18, 152, 33, 250, 25, 145, 88, 53, 99, 67, 67, 34, 33, 2, 152, 138, 202, 188, 188, 170, 202, 140, 1, 9, 49, 33, 37, 168, 170, 250, 188, 188, 188, 203, 172, 170, 152, 205, 240, 48, 0, 154, 32, 18, 67, 34, 52, 160, 138, 250, 189, 171, 171, 154, 138, 64, 55, 17, 84, 35, 49, 67, 34, 18, 136, 136, 218, 153, 186, 138, 152, 24, 145, 171, 118, 133, 155, 115, 146, 153, 49, 20, 152, 41, 37, 145, 219, 24, 248, 157, 144, 154, 32, 1, 84, 18, 17, 34, 217, 26, 161, 174, 8, 201, 203, 138, 144, 42, 23, 16, 3, 219, 203, 204, 153, 24, 86, 52, 68, 51, 50, 18, 17, 136, 186, 204, 203, 187, 155, 24, 68, 68, 67, 35, 17, 1, 152, 219, 204, 203, 188, 187, 187, 154, 137, 16, 34, 51, 35, 3, 220, 188, 221, 187, 187, 171, 186, 154, 8, 152, 32, 68, 51, 85, 36, 51, 52, 50, 83, 2, 32, 145, 188, 204, 204, 169, 170, 32, 68, 68, 67, 51, 34, 17, 168, 188, 205, 203, 172, 171, 170, 153, 16, 49, 83, 19, 17, 129, 204, 188, 204, 186, 202, 153, 153, 138, 128, 9, 16, 8, 67, 50, 68, 67, 53, 36, 82, 51, 34, 33, 130, 153, 187, 156, 16, 82, 69, 54, 51, 52, 35, 51, 145, 8, 217, 189, 186, 204, 155, 154, 24, 128, 65, 35, 1, 0, 144, 185, 189, 188, 9, 250, 139, 128, 187, 136, 25, 68, 128, 115, 19, 32, 68, 52, 50, 53, 33, 34, 144, 32, 161, 11, 70, 33, 85, 34, 52, 51, 50, 35, 1, 17, 170, 154, 207, 154, 153, 154, 168, 64, 3, 171, 17, 237, 187, 219, 188, 203, 154, 168, 189, 154, 185, 188, 187, 172, 137, 206, 138, 144, 171, 18, 153, 83, 233, 56, 163, 43, 5, 154, 100, 130, 56, 37, 16, 20, 24, 35, 129, 40, 128, 97, 147, 27, 87, 169, 56, 147, 27, 71, 144, 49, 34, 128, 10, 0, 187, 250, 159, 128, 220, 10, 145, 154, 50, 19, 33, 130, 153, 233, 172, 153, 173, 202, 188, 153, 205, 24, 162, 64, 20, 137, 161, 173, 16, 17, 119, 38, 50, 52, 35, 34, 18, 1, 152, 170, 220, 188, 170, 154, 16, 83, 53, 51, 36, 18, 0, 168, 218, 205, 188, 203, 188, 171, 155, 154, 9, 33, 34, 19, 34, 160, 204, 204, 173, 187, 188, 186, 172, 137, 137, 16, 66, 68, 36, 51, 52, 66, 34, 50, 36, 17, 1, 144, 186, 235, 172, 169, 9, 17, 82, 54, 51, 52, 67, 18, 129, 184, 204, 205, 204, 186, 203, 186, 169, 153, 9, 8, 0, 17, 8, 16, 201, 170, 221, 203, 219, 171, 188, 171, 170, 136, 24, 82, 68, 52, 53, 52, 67, 35, 50, 3, 1, 144, 153, 169, 154, 33, 52, 69, 69, 50, 68, 35, 51, 18, 1, 169, 188, 205, 203, 171, 187, 203, 153, 137, 137, 49, 160, 115, 2, 24, 144, 152, 220, 172, 171, 154, 170, 155, 84, 161, 64, 68, 36, 32, 55, 19, 33, 83, 2, 32, 35, 49, 1, 17, 2, 152, 24, 71, 2, 64, 38, 33, 51, 50, 53, 131, 9, 18, 216, 172, 152, 59, 33, 39, 0, 202, 188, 170, 186, 204, 187, 186, 188, 186, 203, 187, 170, 204, 154, 188, 152, 220, 219, 203, 187, 189, 187, 154, 154, 153, 40, 52, 66, 69, 67, 18, 16, 2, 152, 169, 8, 128, 97, 53, 83, 54, 36, 67, 52, 19, 18, 35, 168, 137, 144, 203, 10, 35, 253, 138, 144, 173, 16, 153, 49, 224, 138, 161, 173, 202, 170, 250, 172, 186, 190, 136, 171, 32, 33, 68, 67, 66, 50, 130, 50, 168, 48, 233, 171, 204, 170, 173, 24, 34, 33, 87, 2, 48, 2, 9, 67, 34, 115, 54, 36, 66, 51, 19, 2, 33, 129, 219, 188, 186, 205, 171, 136, 8, 65, 36, 51, 36, 19, 128, 217, 205, 219, 172, 188, 171, 187, 171, 9, 16, 49, 68, 35, 17, 1, 216, 188, 188, 188, 188, 171, 154, 9, 33, 69, 52, 52, 36, 34, 34, 0, 8, 169, 9, 185, 155, 16, 0, 24, 84, 52, 2, 49, 146, 235, 203, 187, 202, 137, 145, 170, 217, 204, 236, 203, 186, 204, 187, 187, 203, 187, 9, 0, 50, 53, 52, 34, 2, 169, 203, 206, 202, 186, 187, 170, 8, 81, 84, 83, 67, 51, 52, 50, 34, 17, 128, 169, 154, 201, 170, 128, 8, 99, 53, 67, 83, 51, 34, 34, 145, 172, 153, 221, 156, 153, 187, 187, 153, 169, 25, 36, 2, 49, 38, 168, 137, 49, 176, 156, 66, 36, 155, 118, 2, 24, 67, 2, 24, 67, 18, 33, 101, 35, 48, 70, 18, 33, 52, 2, 33, 34, 152, 137, 168, 189, 137, 153, 170, 8, 51, 68, 85, 67, 36, 33, 33, 160, 187, 234, 189, 173, 188, 219, 186, 170, 155, 8, 16, 33, 52, 34, 34, 16, 152, 204, 207, 219, 203, 187, 172, 169, 137, 24, 17, 66, 83, 67, 67, 67, 34, 34, 129, 152, 169, 170, 154, 24, 161, 56, 130, 120, 53, 83, 53, 36, 1, 34, 131, 154, 48, 35, 250, 10, 216, 191, 171, 153, 235, 10, 145, 172, 24, 144, 137, 48, 22, 202, 9, 216, 189, 8, 136, 137, 115, 19, 32, 55, 2, 24, 36, 200, 10, 129, 203, 136, 41, 4, 189, 82, 160, 139, 3, 204, 137, 218, 153, 203, 97, 51, 84, 85, 51, 50, 52, 51, 1, 33, 176, 189, 187, 206, 171, 153, 154, 40, 99, 51, 83, 52, 34, 18, 129, 186, 206, 173, 188, 172, 186, 171, 138, 9, 16, 67, 51, 52, 34, 128, 168, 236, 188, 203, 188, 186, 154, 154, 16, 51, 115, 51, 52, 19, 51, 18, 153, 128, 201, 172, 153, 186, 25, 2, 48, 69, 36, 34, 50, 51, 66, 67, 50, 36, 34, 168, 172, 252, 189, 203, 204, 187, 203, 187, 155, 154, 137, 65, 51, 52, 51, 50, 160, 204, 190, 189, 203, 203, 171, 185, 138, 17, 83, 84, 51, 53, 51, 51, 50, 19, 8, 8, 176, 188, 24, 185, 8, 100, 52, 68, 52, 51, 51, 52, 129, 8, 146, 219, 170, 219, 188, 171, 169, 187, 80, 129, 193, 244, 40, 0, 40, 18, 0, 8, 33, 217, 48, 240, 155, 145, 188, 138, 2, 203, 64, 145, 219, 57, 19, 57, 119, 36, 49, 53, 35, 52, 67, 1, 33, 145, 187, 169, 220, 155, 136, 137, 49, 68, 52, 85, 51, 50, 37, 3, 128, 129, 219, 170, 219, 202, 171, 170, 155, 137, 32, 51, 85, 19, 49, 19, 0, 184, 175, 187, 205, 188, 187, 187, 187, 138, 136, 65, 37, 17, 68, 19, 17, 18, 160, 186, 219, 205, 172, 153, 185, 138, 51, 18, 97, 85, 34, 49, 53, 1, 16, 129, 152, 234, 10, 144, 173, 48, 160, 41, 39, 51, 21, 65, 21, 184, 24, 192, 190, 154, 218, 172, 154, 169, 156, 32, 128, 40, 36, 16, 128, 171, 136, 251, 155, 137, 0, 171, 119, 146, 40, 38, 144, 8, 34, 168, 58, 20, 187, 40, 232, 205, 137, 137, 234, 172, 0, 250, 138, 17, 136, 115, 55, 17, 84, 34, 32, 50, 2, 136, 152, 200, 190, 155, 218, 155, 0, 128, 81, 68, 34, 66, 51, 18, 0, 168, 206, 188, 202, 188, 156, 154, 170, 9, 34, 16, 99, 19, 16, 17, 144, 189, 186, 220, 203, 170, 170, 154, 8, 48, 34, 68, 53, 17, 66, 51, 144, 49, 131, 187, 48, 224, 156, 0, 202, 138, 128, 153, 32, 67, 84, 52, 53, 51, 51, 35, 128, 251, 203, 220, 203, 203, 187, 187, 170, 138, 8, 50, 68, 67, 50, 18, 0, 202, 190, 204, 203, 187, 203, 170, 153, 0, 50, 85, 67, 36, 51, 51, 51, 34, 0, 128, 169, 188, 187, 187, 155, 32, 100, 68, 67, 67, 51, 36, 35, 34, 2, 0, 217, 189, 185, 190, 154, 186, 185, 138, 33, 136, 100, 51, 68, 34, 52, 17, 17, 160, 187, 218, 188, 187, 172, 169, 9, 51, 115, 55, 66, 67, 35, 51, 51, 2, 17, 129, 189, 153, 204, 187, 137, 152, 25, 86, 36, 33, 70, 17, 34, 18, 17, 136, 169, 188, 189, 187, 188, 172, 154, 129, 8, 50, 84, 35, 34, 37, 144, 152, 234, 204, 172, 202, 188, 169, 171, 154, 136, 24, 66, 52, 50, 52, 20, 0, 144, 171, 220, 187, 235, 155, 153, 154, 56, 36, 81, 37, 33, 34, 67, 161, 41, 163, 172, 171, 9, 250, 139, 19, 154, 115, 1, 16, 48, 132, 140, 20, 188, 16, 170, 185, 140, 249, 139, 201, 203, 170, 160, 158, 152, 25, 146, 80, 161, 114, 180, 41, 192, 138, 252, 25, 201, 27, 19, 10, 84, 34, 53, 33, 52, 18, 0, 153, 136, 222, 138, 176, 157, 128, 154, 49, 152, 115, 130, 40, 4, 171, 128, 186, 9, 80, 71, 50, 70, 51, 67, 67, 34, 2, 17, 152, 188, 202, 203, 187, 154, 0, 49, 71, 66, 51, 67, 19, 1, 168, 204, 205, 187, 188, 188, 171, 154, 154, 24, 50, 50, 67, 18, 136, 235, 204, 235, 187, 203, 171, 171, 138, 8, 33, 68, 66, 36, 18, 34, 129, 136, 186, 172, 219, 154, 153, 162, 229, 42, 0, 25, 67, 98, 52, 50, 68, 33, 33, 17, 20, 128, 50, 145, 170, 185, 205, 205, 171, 203, 173, 186, 171, 168, 138, 50, 16, 69, 1, 144, 201, 207, 171, 205, 186, 172, 170, 170, 137, 17, 48, 70, 50, 52, 34, 36, 128, 128, 185, 154, 188, 11, 144, 57, 70, 68, 83, 51, 68, 34, 50, 2, 16, 128, 154, 185, 156, 184, 156, 0, 152, 80, 51, 66, 50, 51, 176, 140, 249, 172, 152, 187, 136, 218, 187, 138, 201, 158, 34, 200, 26, 176, 11, 131, 113, 37, 98, 35, 51, 17, 50, 176, 25, 248, 155, 200, 173, 136, 152, 66, 54, 36, 68, 36, 18, 51, 35, 33, 18, 152, 152, 204, 138, 234, 27, 51, 32, 55, 52, 52, 35, 52, 18, 18, 144, 219, 219, 219, 203, 171, 187, 169, 170, 137, 33, 2, 72, 22, 8, 161, 173, 217, 189, 170, 204, 154, 153, 154, 128, 0, 48, 37, 65, 36, 34, 20, 16, 1, 153, 24, 216, 12, 18, 203, 64, 4, 16, 37, 51, 52, 33, 35, 145, 153, 202, 205, 187, 171, 190, 171, 203, 154, 189, 169, 171, 184, 140, 161, 141, 168, 156, 145, 11, 53, 50, 52, 202, 137, 238, 9, 168, 25, 2, 8, 35, 67, 84, 68, 34, 35, 1, 144, 221, 153, 202, 26, 18, 32, 103, 50, 51, 37, 35, 50, 128, 168, 189, 235, 188, 138, 187, 41, 18, 115, 21, 49, 35, 17, 0, 153, 234, 187, 235, 188, 187, 187, 204, 10, 2, 1, 83, 51, 16, 17, 9, 69, 51, 71, 37, 51, 37, 34, 35, 33, 1, 171, 168, 206, 187, 154, 138, 48, 84, 84, 35, 35, 20, 0, 168, 204, 188, 190, 186, 204, 153, 154, 9, 16, 49, 36, 49, 129, 170, 252, 188, 188, 188, 202, 170, 153, 136, 49, 50, 70, 34, 50, 2, 153, 201, 189, 202, 187, 154, 153, 24, 51, 55, 52, 53, 51, 51, 20, 1, 136, 170, 187, 204, 169, 154, 137, 17, 34, 100, 35, 99, 19, 17, 1, 137, 202, 174, 187, 204, 170, 188, 154, 186, 155, 138, 32, 16, 84, 51, 50, 1, 152, 233, 173, 170, 204, 153, 186, 138, 168, 88, 53, 83, 54, 66, 35, 34, 18, 17, 153, 8, 201, 172, 169, 171, 8, 49, 119, 50, 83, 35, 50, 18, 136, 160, 187, 189, 172, 172, 170, 153, 25, 66, 84, 36, 67, 34, 16, 145, 188, 185, 205, 171, 187, 170, 172, 25, 0, 99, 51, 52, 36, 34, 152, 154, 234, 172, 154, 186, 10, 18, 138, 101, 35, 52, 67, 69, 2, 16, 18, 169, 10, 185, 139, 129, 11, 101, 34, 99, 52, 67, 35, 34, 34, 1, 185, 169, 237, 154, 218, 155, 136, 154, 65, 1, 99, 35, 8, 19, 219, 170, 206, 171, 202, 171, 169, 171, 136, 137, 49, 19, 136, 51, 224, 189, 170, 170, 189, 81, 18, 49, 36, 68, 1, 40, 34, 170, 186, 206, 154, 169, 48, 67, 68, 33, 84, 130, 8, 18, 198, 9, 30, 0, 128, 203, 26, 192, 207, 9, 184, 172, 32, 152, 64, 146, 156, 168, 175, 168, 171, 84, 144, 49, 2, 82, 176, 43, 161, 188, 253, 138, 160, 202, 154, 50, 144, 73, 55, 33, 68, 129, 24, 144, 204, 170, 172, 153, 188, 138, 0, 32, 85, 51, 55, 19, 32, 3, 171, 218, 175, 170, 186, 155, 170, 66, 18, 116, 34, 50, 2, 136, 176, 204, 188, 155, 202, 155, 138, 0, 16, 115, 18, 17, 192, 188, 237, 171, 169, 139, 68, 84, 52, 52, 52, 34, 33, 129, 186, 202, 205, 170, 154, 138, 33, 85, 36, 67, 36, 34, 1, 152, 202, 204, 187, 188, 186, 169, 0, 50, 83, 53, 18, 34, 129, 234, 219, 203, 188, 172, 170, 170, 8, 17, 66, 52, 50, 35, 128, 185, 221, 188, 203, 187, 170, 153, 17, 51, 69, 67, 50, 35, 18, 128, 185, 203, 204, 172, 169, 137, 16, 83, 68, 67, 51, 35, 34, 2, 144, 186, 188, 189, 173, 169, 154, 8, 18, 84, 52, 66, 51, 18, 2, 169, 170, 221, 172, 186, 171, 171, 153, 49, 68, 99, 67, 34, 18, 17, 136, 170, 187, 186, 186, 173, 8, 129, 32, 102, 51, 50, 99, 19, 128, 33, 160, 154, 160, 10, 200, 156, 0, 9, 35, 97, 71, 35, 99, 36, 2, 34, 1, 144, 186, 138, 192, 203, 153, 136, 81, 52, 84, 37, 32, 67, 129, 48, 4, 186, 171, 219, 188, 203, 8, 129, 97, 52, 49, 38, 17, 18, 216, 171, 217, 188, 169, 171, 152, 137, 50, 33, 100, 2, 81, 19, 0, 160, 204, 219, 188, 188, 170, 137, 1, 65, 54, 34, 51, 52, 130, 8, 185, 221, 203, 170, 154, 40, 49, 70, 51, 67, 53, 34, 17, 0, 184, 221, 154, 153, 154, 32, 37, 98, 51, 50, 19, 129, 201, 188, 205, 187, 153, 153, 40, 66, 50, 84, 18, 136, 152, 220, 203, 204, 170, 186, 25, 0, 32, 35, 83, 18, 144, 185, 251, 204, 171, 169, 171, 137, 17, 34, 69, 68, 34, 0, 152, 202, 204, 172, 154, 0, 0, 17, 66, 67, 50, 36, 68, 36, 0, 17, 202, 203, 188, 169, 171, 40, 34, 101, 34, 52, 19, 24, 136, 152, 169, 170, 10, 216, 190, 186, 172, 169, 171, 50, 99, 55, 18, 67, 2, 24, 129, 186, 219, 187, 220, 187, 152, 171, 64, 19, 114, 3, 48, 18, 99, 37, 18, 0, 186, 205, 172, 153, 152, 0, 50, 69, 17, 52, 35, 34, 34, 130, 203, 170, 187, 202, 156, 9, 65, 37, 83, 54, 2, 1, 168, 186, 206, 137, 201, 138, 34, 18, 17, 68, 19, 128, 16, 161, 191, 170, 220, 172, 186, 170, 138, 24, 8, 0, 184, 16, 251, 143, 202, 172, 153, 172, 136, 169, 40, 1, 65, 52, 67, 19, 50, 160, 11, 178, 255, 137, 202, 138, 168, 9, 34, 98, 36, 33, 37, 136, 32, 168, 186, 172, 128, 218, 8, 0, 34, 144, 32, 1, 136, 101, 177, 12, 171, 254, 22, 0, 232, 156, 169, 139, 35, 49, 39, 234, 40, 249, 155, 160, 10, 130, 40, 18, 40, 145, 174, 186, 174, 187, 188, 187, 168, 171, 18, 174, 115, 145, 49, 162, 57, 240, 157, 184, 172, 8, 136, 0, 128, 32, 201, 41, 249, 12, 184, 173, 152, 171, 137, 170, 97, 131, 9, 2, 65, 192, 27, 161, 142, 0, 154, 160, 207, 153, 186, 138, 66, 85, 67, 50, 37, 128, 16, 152, 137, 136, 24, 50, 82, 69, 35, 82, 35, 18, 66, 51, 145, 57, 38, 16, 100, 18, 82, 35, 66, 36, 16, 34, 17, 1, 136, 68, 34, 50, 84, 35, 17, 34, 51, 161, 114, 17, 99, 129, 84, 2, 49, 18, 24, 184, 138, 192, 155, 36, 34, 84, 18, 65, 177, 14, 177, 175, 17, 169, 50, 160, 56, 160, 64, 160, 11, 192, 57, 240, 12, 162, 175, 8, 152, 16, 152, 49, 3, 0, 255, 155, 184, 139, 18, 8, 51, 145, 170, 235, 155, 8, 218, 137, 201, 9, 201, 41, 163, 14, 192, 157, 144, 138, 68, 50, 36, 51, 53, 144, 138, 162, 207, 138, 136, 187, 8, 153, 87, 161, 24, 19, 169, 171, 136, 223, 137, 160, 24, 176, 26, 163, 141, 176, 141, 2, 170, 218, 187, 221, 137, 9, 176, 175, 128, 172, 136, 153, 128, 153, 220, 8, 160, 187, 155, 36, 251, 140, 33, 145, 33, 1, 116, 19, 144, 201, 235, 171, 169, 189, 24, 52, 17, 86, 130, 16, 146, 169, 153, 202, 187, 9, 201, 73, 36, 16, 35, 16, 184, 207, 168, 219, 170, 152, 9, 50, 35, 66, 85, 131, 171, 18, 205, 138, 203, 154, 169, 66, 19, 67, 3, 65, 132, 172, 153, 137, 49, 8, 117, 35, 33, 18, 0, 217, 205, 187, 154, 185, 41, 71, 33, 68, 35, 48, 36, 218, 138, 217, 172, 169, 8, 152, 82, 36, 33, 36, 35, 145, 153, 219, 171, 153, 137, 8, 68, 1, 50, 130, 11, 53, 250, 57, 3, 138, 50, 68, 19, 40, 20, 185, 154, 17, 220, 112, 19, 50, 2, 67, 49, 4, 190, 152, 219, 137, 188, 155, 184, 13, 52, 128, 83, 18, 0, 56, 178, 175, 168, 191, 9, 153, 154, 154, 65, 67, 34, 82, 54, 129, 34, 177, 188, 205, 188, 169, 186, 41, 20, 24, 53, 160, 8, 2, 236, 137, 160, 156, 130, 188, 25, 184, 139, 34, 201, 57, 148, 141, 160, 43, 196, 12, 3, 88, 4, 24, 2, 24, 240, 158, 33, 129, 48, 18, 115, 36, 33, 19, 170, 138, 235, 188, 26, 185, 112, 23, 8, 67, 1, 0, 17, 184, 171, 251, 141, 128, 136, 136, 65, 19, 50, 67, 2, 169, 252, 188, 219, 41, 35, 87, 35, 83, 3, 169, 221, 188, 187, 156, 16, 50, 52, 52, 18, 33, 129, 200, 205, 187, 190, 171, 25, 115, 36, 51, 51, 2, 168, 218, 188, 203, 171, 153, 8, 50, 37, 67, 51, 2, 153, 154, 219, 188, 187, 8, 153, 115, 2, 82, 201, 1, 48, 0, 129, 8, 169, 204, 188, 154, 170, 16, 66, 69, 18, 35, 34, 184, 207, 170, 187, 40, 84, 52, 20, 129, 152, 187, 172, 137, 128, 40, 67, 53, 34, 33, 192, 189, 203, 154, 65, 52, 82, 36, 144, 170, 154, 204, 170, 203, 155, 168, 80, 70, 51, 35, 160, 220, 203, 171, 154, 24, 33, 35, 82, 68, 51, 1, 185, 190, 155, 170, 136, 168, 153, 88, 71, 67, 34, 152, 187, 189, 171, 16, 49, 37, 33, 49, 1, 152, 153, 186, 189, 138, 49, 68, 161, 191, 138, 40, 70, 51, 129, 235, 204, 171, 40, 68, 52, 19, 184, 221, 156, 9, 50, 67, 34, 185, 172, 138, 48, 51, 3, 219, 187, 188, 57, 71, 51, 0, 168, 202, 170, 153, 154, 187, 138, 114, 70, 34, 129, 219, 172, 139, 48, 83, 34, 160, 236, 155, 8, 67, 34, 18, 169, 174, 171, 25, 34, 33, 35, 184, 189, 153, 154, 66, 70, 37, 1, 186, 190, 186, 138, 66, 52, 35, 18, 201, 172, 186, 138, 144, 41, 54, 35, 2, 152, 186, 112, 53, 36, 160, 204, 204, 155, 9, 51, 67, 51, 144, 185, 173, 16, 67, 3, 186, 203, 204, 154, 16, 19, 0, 33, 54, 130, 186, 219, 218, 205, 9, 82, 68, 51, 128, 202, 205, 170, 16, 50, 52, 18, 1, 186, 136, 218, 171, 16, 145, 138, 50, 51, 115, 55, 129, 169, 219, 187, 153, 56, 86, 51, 2, 201, 173, 171, 137, 32, 33, 18, 17, 67, 35, 162, 223, 154, 153, 32, 50, 19, 8, 129, 40, 83, 21, 251, 170, 187, 56, 85, 53, 2, 184, 171, 8, 33, 17, 161, 207, 138, 49, 69, 36, 18, 169, 219, 154, 136, 8, 153, 17, 145, 56, 55, 20, 144, 203, 172, 155, 8, 128, 138, 152, 11, 53, 145, 221, 204, 187, 154, 24, 84, 35, 17, 168, 204, 172, 203, 138, 128, 40, 36, 50, 53, 1, 153, 235, 203, 170, 48, 34, 66, 20, 160, 171, 32, 36, 17, 2, 251, 189, 25, 50, 70, 129, 170, 185, 189, 56, 53, 52, 20, 144, 202, 203, 170, 137, 49, 39, 18, 16, 49, 129, 25, 51, 250, 140, 136, 154, 32, 2, 115, 3, 8, 146, 173, 40, 184, 43, 53, 48, 68, 144, 186, 207, 139, 0, 0, 129, 153, 185, 187, 187, 186, 113, 23, 16, 35, 170, 98, 224, 156, 152, 204, 41, 18, 49, 3, 173, 0, 201, 72, 21, 152, 40, 152, 25, 145, 115, 7, 137, 136, 187, 138, 8, 100, 18, 33, 2, 219, 137, 186, 121, 20, 8, 18, 235, 9, 129, 57, 55, 130, 16, 161, 172, 8, 152, 26, 66, 129, 170, 138, 34, 235, 56, 34, 69, 176, 154, 144, 186, 96, 240, 12, 161, 140, 36, 136, 99, 131, 139, 19, 205, 8, 234, 10, 129, 9, 54, 18, 34, 145, 189, 189, 172, 8, 16, 66, 20, 152, 169, 174, 152, 24, 69, 130, 16, 232, 155, 160, 174, 50, 161, 64, 2, 9, 35, 51, 1, 44, 0, 82, 37, 144, 16, 234, 173, 136, 24, 82, 51, 34, 145, 202, 171, 204, 10, 128, 138, 128, 172, 24, 1, 50, 71, 161, 25, 192, 140, 17, 0, 128, 249, 173, 186, 140, 50, 84, 51, 49, 129, 204, 155, 202, 139, 0, 40, 54, 136, 98, 129, 138, 18, 201, 9, 161, 172, 234, 222, 170, 169, 8, 66, 53, 53, 34, 129, 136, 218, 188, 154, 9, 24, 99, 52, 51, 51, 19, 17, 128, 188, 186, 154, 168, 26, 70, 35, 19, 50, 37, 0, 0, 8, 36, 252, 156, 176, 175, 137, 169, 48, 18, 82, 19, 170, 220, 188, 188, 186, 153, 17, 16, 129, 154, 217, 172, 0, 169, 33, 232, 188, 187, 174, 137, 1, 32, 52, 34, 35, 83, 2, 136, 168, 191, 154, 186, 96, 38, 34, 54, 130, 24, 161, 187, 10, 129, 137, 53, 17, 1, 8, 144, 66, 130, 114, 132, 169, 153, 236, 139, 136, 154, 33, 67, 19, 16, 69, 17, 145, 204, 153, 221, 187, 24, 49, 84, 34, 67, 145, 157, 144, 172, 16, 16, 69, 130, 9, 147, 204, 48, 129, 113, 19, 8, 1, 187, 9, 0, 97, 38, 128, 33, 144, 187, 26, 19, 96, 131, 42, 132, 189, 25, 37, 17, 68, 129, 144, 205, 10, 17, 154, 114, 3, 153, 50, 176, 44, 22, 170, 0, 201, 171, 205, 26, 20, 136, 81, 35, 185, 204, 155, 160, 205, 41, 20, 202, 26, 2, 185, 9, 201, 114, 149, 156, 65, 176, 173, 0, 129, 9, 0, 81, 5, 170, 49, 3, 186, 42, 19, 250, 141, 17, 17, 33, 100, 34, 17, 169, 9, 217, 10, 128, 65, 54, 144, 57, 5, 170, 24, 67, 0, 17, 153, 130, 239, 138, 0, 152, 152, 16, 145, 156, 16, 152, 2, 239, 154, 217, 172, 9, 32, 16, 33, 130, 154, 235, 187, 9, 1, 153, 40, 148, 239, 25, 1, 8, 66, 36, 16, 17, 184, 9, 200, 154, 171, 22, 221, 65, 19, 98, 2, 98, 161, 156, 152, 172, 0, 0, 66, 18, 161, 10, 176, 12, 132, 41, 131, 205, 155, 136, 170, 65, 177, 72, 248, 142, 17, 16, 4, 141, 35, 206, 137, 169, 16, 16, 34, 83, 5, 169, 8, 184, 171, 138, 49, 130, 136, 219, 64, 248, 42, 37, 129, 17, 168, 12, 128, 140, 83, 2, 201, 43, 149, 191, 83, 129, 50, 144, 137, 186, 219, 158, 82, 144, 48, 176, 42, 225, 156, 144, 24, 200, 26, 4, 25, 21, 9, 52, 145, 170, 137, 18, 201, 72, 55, 51, 37, 32, 52, 152, 24, 128, 83, 144, 82, 129, 65, 177, 73, 5, 136, 50, 168, 10, 178, 159, 136, 202, 153, 169, 188, 10, 216, 155, 192, 158, 185, 189, 169, 189, 154, 169, 156, 136, 170, 153, 188, 203, 188, 171, 152, 175, 32, 186, 32, 169, 33, 155, 70, 169, 65, 161, 42, 35, 16, 67, 85, 34, 99, 3, 82, 19, 40, 19, 8, 5, 138, 37, 24, 37, 65, 5, 25, 16, 0, 45, 0, 4, 136, 128, 153, 0, 153, 24, 160, 24, 169, 116, 147, 41, 145, 0, 255, 27, 192, 11, 19, 137, 33, 24, 147, 207, 32, 217, 56, 146, 11, 4, 169, 8, 33, 19, 113, 6, 170, 49, 161, 153, 48, 39, 144, 33, 147, 187, 9, 115, 37, 8, 34, 2, 136, 218, 104, 22, 169, 81, 160, 138, 128, 99, 145, 73, 5, 138, 169, 26, 1, 32, 144, 117, 177, 142, 34, 185, 72, 130, 153, 217, 10, 160, 11, 20, 0, 37, 236, 138, 168, 139, 33, 66, 2, 171, 186, 221, 172, 65, 1, 49, 19, 202, 137, 185, 137, 84, 4, 138, 35, 251, 42, 35, 17, 70, 161, 9, 184, 155, 48, 54, 50, 21, 168, 40, 233, 27, 36, 16, 17, 8, 160, 158, 152, 72, 37, 40, 2, 175, 128, 220, 24, 0, 17, 137, 2, 219, 137, 153, 49, 192, 139, 232, 189, 172, 25, 51, 0, 70, 130, 186, 204, 187, 154, 202, 57, 149, 26, 23, 137, 67, 144, 8, 200, 219, 171, 8, 8, 70, 129, 48, 176, 156, 128, 32, 1, 32, 200, 220, 189, 56, 192, 91, 37, 136, 32, 145, 139, 2, 189, 65, 177, 11, 36, 152, 40, 39, 136, 49, 248, 10, 201, 158, 136, 153, 0, 82, 19, 8, 17, 160, 220, 10, 176, 156, 1, 154, 0, 34, 37, 83, 52, 129, 152, 170, 172, 155, 137, 116, 18, 33, 24, 86, 145, 64, 21, 8, 1, 203, 24, 169, 40, 52, 68, 50, 19, 9, 3, 203, 155, 24, 250, 143, 17, 137, 17, 18, 52, 216, 137, 217, 154, 202, 10, 144, 25, 193, 140, 2, 204, 56, 177, 139, 184, 157, 233, 155, 35, 137, 99, 129, 16, 1, 176, 173, 35, 221, 72, 146, 41, 66, 34, 2, 1, 201, 64, 248, 25, 145, 74, 149, 13, 36, 185, 40, 1, 129, 189, 33, 168, 169, 174, 82, 176, 28, 18, 34, 233, 41, 132, 188, 153, 40, 209, 28, 19, 57, 133, 157, 35, 201, 25, 144, 0, 160, 57, 179, 44, 164, 75, 7, 154, 36, 169, 67, 201, 73, 147, 138, 17, 49, 1, 112, 21, 33, 129, 9, 145, 139, 249, 121, 132, 41, 35, 24, 177, 158, 2, 136, 0, 57, 119, 152, 24, 136, 34, 251, 43, 3, 187, 41, 52, 168, 25, 18, 220, 169, 204, 40, 192, 9, 34, 34, 232, 138, 1, 251, 140, 2, 185, 40, 131, 140, 36, 203, 88, 130, 172, 40, 130, 187, 65, 160, 88, 163, 12, 21, 32, 146, 121, 5, 170, 16, 168, 169, 25, 53, 48, 39, 128, 67, 184, 154, 185, 9, 235, 72, 20, 40, 36, 50, 176, 155, 233, 156, 168, 27, 53, 129, 64, 3, 152, 186, 10, 184, 191, 154, 24, 248, 142, 34, 185, 97, 129, 32, 146, 156, 152, 219, 173, 40, 192, 10, 37, 129, 33, 129, 128, 170, 185, 207, 137, 170, 57, 37, 8, 99, 147, 154, 8, 185, 188, 189, 202, 219, 186, 58, 37, 17, 84, 35, 176, 138, 250, 48, 0, 187, 187, 251, 189, 48, 130, 49, 52, 69, 130, 8, 129, 170, 186, 157, 18, 32, 71, 18, 66, 130, 0, 161, 155, 129, 155, 84, 130, 49, 21, 152, 49, 163, 11, 22, 219, 137, 202, 153, 187, 25, 192, 64, 178, 13, 176, 159, 185, 175, 152, 187, 136, 152, 48, 161, 40, 249, 159, 153, 187, 138, 0, 137, 49, 130, 187, 136, 201, 171, 24, 217, 58, 5, 139, 68, 50, 52, 17, 84, 2, 72, 21, 137, 67, 168, 80, 4, 40, 37, 49, 35, 24, 51, 201, 80, 129, 40, 38, 129, 67, 131, 16, 129, 137, 144, 9, 3, 73, 55, 169, 49, 248, 141, 152, 154, 161, 59, 23, 169, 1, 219, 154, 188, 10, 218, 40, 131, 27, 53, 202, 48, 177, 140, 160, 11, 132, 12, 55, 129, 66, 51, 3, 154, 102, 145, 26, 53, 144, 24, 51, 51, 1, 117, 19, 17, 18, 128, 152, 201, 27, 87, 128, 65, 35, 1, 188, 48, 200, 10, 220, 96, 161, 155, 67, 144, 137, 136, 152, 234, 189, 8, 144, 155, 48, 162, 158, 160, 190, 9, 203, 9, 160, 155, 184, 173, 154, 169, 10, 33, 232, 188, 170, 170, 154, 32, 84, 37, 217, 72, 162, 12, 17, 65, 146, 10, 20, 25, 2, 90, 55, 0, 33, 152, 40, 200, 11, 54, 1, 33, 33, 2, 188, 26, 83, 160, 155, 40, 164, 255, 41, 0, 137, 17, 161, 8, 249, 137, 219, 48, 249, 74, 132, 139, 17, 128, 168, 42, 210, 12, 5, 172, 83, 161, 138, 66, 177, 157, 35, 203, 81, 160, 32, 1, 20, 187, 84, 218, 24, 145, 42, 20, 137, 67, 17, 160, 142, 37, 202, 40, 200, 56, 193, 43, 38, 145, 9, 67, 233, 138, 130, 188, 32, 145, 9, 1, 19, 189, 85, 176, 25, 18, 250, 10, 161, 13, 35, 169, 81, 21, 169, 73, 6, 186, 9, 219, 155, 219, 11, 84, 36, 1, 50, 146, 206, 155, 153, 153, 49, 68, 18, 33, 19, 154, 2, 219, 136, 202, 138, 26, 86, 18, 66, 35, 144, 187, 169, 187, 26, 51, 34, 34, 202, 57, 102, 18, 32, 5, 220, 203, 187, 154, 154, 98, 3, 17, 145, 11, 248, 159, 136, 170, 138, 137, 16, 17, 50, 129, 152, 252, 173, 169, 153, 0, 17, 17, 17, 168, 137, 144, 24, 201, 42, 147, 159, 1, 41, 87, 128, 50, 36, 19, 16, 35, 185, 154, 170, 64, 86, 53, 67, 50, 18, 136, 187, 65, 161, 80, 20, 83, 130, 32, 37, 168, 48, 132, 154, 67, 17, 99, 1, 25, 193, 173, 144, 25, 55, 16, 67, 160, 172, 170, 188, 155, 49, 130, 40, 130, 26, 149, 157, 19, 237, 154, 152, 155, 24, 98, 4, 137, 19, 218, 24, 0, 0, 152, 50, 249, 12, 18, 64, 55, 18, 17, 145, 236, 138, 152, 8, 52, 99, 34, 24, 34, 233, 9, 168, 137, 202, 72, 131, 9, 70, 129, 138, 17, 201, 174, 24, 169, 138, 16, 130, 225, 9, 36, 0, 157, 83, 184, 137, 187, 16, 254, 10, 129, 137, 168, 56, 178, 207, 33, 160, 138, 2, 187, 25, 248, 140, 35, 152, 24, 51, 209, 12, 18, 172, 98, 145, 138, 50, 152, 10, 101, 130, 10, 36, 218, 25, 129, 48, 35, 0, 83, 162, 154, 153, 114, 194, 27, 39, 201, 24, 2, 9, 16, 1, 152, 9, 160, 158, 33, 185, 155, 32, 249, 120, 179, 14, 35, 186, 169, 42, 132, 174, 34, 144, 33, 161, 188, 154, 219, 41, 161, 114, 22, 137, 24, 129, 234, 170, 32, 160, 141, 34, 32, 147, 158, 35, 202, 169, 173, 0, 203, 153, 136, 136, 114, 161, 11, 21, 187, 219, 139, 250, 13, 3, 138, 69, 128, 49, 146, 219, 155, 169, 190, 40, 18, 33, 66, 20, 220, 170, 155, 16, 9, 87, 2, 33, 145, 156, 0, 169, 32, 36, 50, 38, 129, 65, 20, 128, 24, 33, 192, 58, 71, 16, 53, 128, 50, 200, 156, 129, 25, 52, 34, 67, 128, 137, 233, 174, 33, 192, 11, 4, 202, 8, 160, 153, 201, 156, 144, 204, 138, 169, 170, 252, 138, 145, 189, 56, 162, 12, 130, 205, 169, 204, 24, 160, 73, 21, 136, 1, 235, 9, 168, 12, 36, 136, 50, 129, 67, 233, 56, 163, 12, 35, 153, 51, 16, 55, 1, 50, 146, 72, 146, 155, 83, 129, 96, 36, 8, 67, 128, 64, 130, 12, 2, 186, 50, 232, 96, 131, 9, 38, 170, 32, 184, 140, 160, 10, 34, 153, 101, 145, 139, 161, 174, 17, 205, 57, 147, 157, 18, 152, 8, 186, 80, 193, 140, 0, 128, 154, 48, 129, 115, 6, 24, 130, 26, 132, 173, 81, 161, 80, 35, 16, 51, 18, 130, 186, 41, 225, 90, 37, 16, 52, 35, 152, 32, 185, 138, 201, 154, 155, 116, 160, 74, 21, 168, 219, 170, 185, 188, 42, 20, 9, 195, 207, 152, 219, 25, 129, 32, 176, 140, 193, 191, 8, 144, 9, 129, 153, 18, 201, 81, 145, 27, 177, 191, 184, 140, 69, 1, 66, 3, 169, 128, 205, 41, 4, 41, 53, 0, 136, 16, 2, 8, 82, 18, 185, 205, 56, 162, 120, 37, 0, 1, 203, 139, 201, 42, 21, 16, 2, 138, 208, 174, 128, 137, 34, 153, 50, 250, 143, 128, 169, 16, 144, 137, 201, 157, 145, 155, 51, 184, 24, 253, 137, 186, 42, 2, 9, 36, 184, 188, 173, 26, 0, 116, 145, 41, 193, 174, 16, 8, 51, 50, 54, 161, 9, 152, 171, 40, 52, 83, 67, 145, 32, 1, 82, 146, 64, 146, 186, 156, 83, 81, 54, 128, 16, 217, 155, 185, 73, 20, 56, 6, 154, 129, 174, 32, 152, 16, 128, 8, 217, 173, 32, 0, 16, 8, 4, 206, 9, 145, 10, 52, 129, 136, 235, 26, 178, 142, 70, 145, 9, 1, 203, 40, 144, 114, 133, 24, 4, 156, 1, 170, 114, 144, 73, 4, 154, 34, 185, 48, 160, 96, 131, 155, 66, 184, 56, 21, 16, 130, 171, 184, 13, 229, 7, 35, 0, 69, 144, 64, 21, 217, 25, 177, 157, 36, 184, 64, 130, 138, 184, 11, 176, 156, 66, 131, 154, 36, 185, 32, 253, 26, 147, 173, 32, 0, 17, 218, 64, 193, 13, 35, 205, 72, 160, 25, 177, 74, 5, 156, 49, 184, 11, 168, 43, 4, 175, 81, 161, 140, 130, 138, 129, 187, 51, 234, 25, 192, 42, 131, 11, 132, 173, 33, 217, 11, 99, 145, 8, 153, 0, 237, 57, 130, 57, 4, 155, 1, 251, 154, 56, 20, 170, 83, 184, 26, 192, 26, 3, 11, 161, 141, 19, 205, 80, 132, 11, 21, 203, 41, 130, 24, 3, 64, 5, 204, 48, 177, 104, 132, 40, 21, 185, 24, 130, 154, 81, 36, 17, 128, 24, 146, 158, 52, 200, 97, 147, 137, 51, 176, 57, 163, 13, 4, 156, 18, 136, 67, 136, 68, 177, 172, 64, 177, 142, 1, 24, 131, 173, 97, 145, 188, 25, 54, 219, 88, 146, 25, 192, 42, 177, 12, 19, 32, 3, 170, 201, 139, 240, 159, 83, 161, 40, 131, 137, 184, 187, 220, 56, 179, 30, 53, 128, 0, 128, 249, 171, 217, 140, 18, 24, 53, 33, 20, 201, 188, 154, 154, 155, 100, 35, 17, 129, 0, 184, 187, 171, 64, 161, 58, 71, 0, 67, 2, 137, 0, 201, 171, 41, 35, 56, 23, 49, 132, 139, 17, 136, 145, 239, 137, 202, 156, 18, 0, 115, 131, 170, 169, 222, 153, 186, 24, 2, 16, 3, 9, 184, 175, 170, 204, 171, 169, 154, 48, 52, 83, 129, 138, 251, 172, 170, 138, 16, 50, 37, 34, 19, 153, 145, 172, 186, 157, 2, 24, 87, 17, 34, 52, 146, 42, 148, 188, 24, 1, 50, 68, 86, 19, 24, 3, 154, 200, 155, 34, 16, 85, 36, 35, 16, 33, 233, 154, 184, 139, 2, 82, 54, 34, 0, 130, 221, 154, 154, 24, 160, 88, 38, 153, 16, 0, 145, 188, 25, 184, 141, 49, 68, 35, 33, 37, 201, 9, 144, 8, 32, 103, 145, 41, 35, 137, 52, 17, 83, 200, 138, 129, 171, 101, 19, 49, 20, 168, 170, 169, 9, 34, 49, 71, 145, 137, 8, 52, 250, 14, 2, 188, 72, 144, 40, 132, 187, 128, 251, 155, 0, 136, 17, 8, 1, 206, 154, 251, 25, 129, 170, 17, 129, 189, 57, 148, 171, 1, 205, 137, 144, 155, 98, 19, 153, 82, 177, 158, 1, 185, 8, 0, 48, 146, 10, 35, 87, 131, 155, 35, 255, 28, 129, 10, 52, 128, 16, 152, 153, 187, 8, 204, 72, 160, 27, 21, 25, 35, 169, 152, 223, 16, 201, 25, 2, 48, 21, 153, 49, 225, 140, 34, 186, 24, 17, 161, 44, 55, 170, 114, 178, 12, 3, 203, 32, 18, 130, 26, 54, 217, 41, 147, 157, 83, 160, 42, 21, 188, 48, 162, 42, 20, 136, 0, 169, 0, 185, 88, 248, 12, 20, 171, 115, 20, 152, 32, 178, 239, 8, 128, 16, 67, 2, 137, 2, 221, 138, 16, 144, 48, 22, 128, 33, 200, 154, 126, 2, 42, 0, 18, 235, 137, 49, 177, 15, 54, 168, 41, 18, 200, 156, 17, 185, 41, 146, 120, 148, 140, 53, 192, 154, 2, 186, 26, 193, 172, 48, 145, 11, 87, 1, 0, 185, 188, 185, 172, 72, 36, 36, 2, 16, 145, 189, 155, 65, 130, 138, 83, 51, 130, 40, 53, 17, 184, 139, 234, 58, 22, 0, 82, 18, 168, 137, 18, 185, 65, 200, 173, 220, 155, 33, 0, 85, 130, 169, 202, 190, 171, 137, 9, 32, 19, 152, 153, 234, 187, 186, 221, 172, 153, 170, 41, 52, 18, 51, 248, 172, 219, 155, 1, 137, 81, 2, 0, 1, 65, 177, 14, 131, 205, 8, 0, 17, 49, 39, 1, 32, 128, 153, 136, 236, 41, 3, 26, 87, 1, 49, 1, 153, 168, 172, 40, 129, 97, 20, 50, 4, 40, 36, 234, 9, 177, 173, 81, 1, 49, 35, 20, 218, 9, 200, 140, 34, 136, 33, 144, 33, 146, 11, 103, 160, 156, 8, 201, 12, 83, 17, 33, 2, 203, 40, 216, 28, 67, 144, 24, 18, 201, 73, 21, 8, 69, 176, 171, 136, 144, 139, 102, 19, 8, 129, 170, 24, 184, 42, 39, 200, 10, 36, 152, 57, 39, 200, 138, 129, 189, 42, 35, 8, 68, 144, 203, 153, 219, 27, 21, 186, 32, 146, 203, 10, 145, 140, 144, 191, 137, 9, 3, 187, 68, 217, 187, 25, 208, 140, 35, 0, 160, 140, 3, 202, 9, 99, 146, 156, 1, 0, 217, 73, 37, 129, 171, 84, 177, 157, 49, 18, 153, 48, 35, 128, 156, 53, 176, 48, 145, 88, 192, 13, 34, 161, 27, 55, 200, 9, 128, 168, 139, 131, 158, 17, 188, 80, 1, 160, 58, 7, 189, 168, 10, 21, 171, 115, 129, 169, 9, 144, 42, 20, 12, 54, 217, 137, 1, 24, 0, 0, 32, 37, 0, 128, 113, 3, 170, 168, 191, 185, 43, 87, 1, 67, 152, 153, 186, 204, 57, 131, 26, 22, 153, 24, 51, 145, 88, 178, 175, 204, 138, 2, 49, 54, 51, 145, 219, 188, 171, 156, 24, 51, 2, 40, 21, 250, 139, 129, 170, 32, 144, 64, 129, 80, 131, 40, 35, 145, 172, 33, 128, 97, 67, 32, 55, 161, 74, 21, 169, 98, 129, 154, 16, 152, 24, 18, 65, 70, 18, 137, 136, 186, 206, 154, 168, 73, 38, 128, 137, 8, 251, 154, 169, 138, 144, 189, 81, 130, 187, 137, 250, 173, 136, 137, 33, 130, 136, 235, 187, 204, 155, 40, 67, 128, 115, 145, 189, 138, 202, 41, 20, 24, 52, 145, 10, 145, 205, 25, 2, 186, 88, 132, 137, 37, 136, 83, 192, 138, 128, 173, 56, 34, 115, 129, 25, 161, 141, 18, 219, 49, 131, 170, 65, 19, 128, 169, 32, 250, 11, 2, 114, 20, 16, 160, 9, 250, 43, 4, 40, 37, 128, 170, 16, 201, 10, 98, 35, 153, 100, 161, 40, 176, 42, 18, 9, 67, 51, 20, 0, 53, 249, 10, 145, 43, 103, 136, 48, 145, 154, 128, 136, 169, 104, 37, 140, 8, 42, 0, 128, 137, 49, 130, 11, 20, 168, 174, 40, 152, 87, 145, 72, 162, 140, 152, 11, 34, 97, 4, 186, 202, 203, 137, 65, 35, 49, 146, 188, 252, 155, 0, 26, 37, 185, 0, 203, 25, 129, 137, 33, 193, 191, 153, 170, 49, 49, 103, 184, 25, 216, 139, 35, 24, 100, 145, 138, 129, 170, 24, 18, 98, 162, 157, 1, 189, 115, 130, 72, 147, 171, 145, 207, 24, 128, 64, 19, 40, 3, 205, 25, 201, 10, 2, 24, 37, 144, 34, 200, 41, 232, 27, 177, 159, 34, 152, 50, 18, 33, 177, 190, 8, 185, 40, 144, 115, 133, 25, 147, 156, 16, 187, 56, 37, 67, 130, 139, 34, 236, 41, 36, 153, 16, 217, 138, 217, 43, 21, 33, 5, 170, 128, 237, 9, 0, 25, 37, 184, 41, 192, 155, 18, 1, 129, 190, 10, 17, 8, 33, 82, 241, 174, 8, 202, 72, 131, 154, 49, 250, 157, 0, 170, 32, 19, 0, 136, 32, 208, 139, 0, 128, 10, 68, 1, 82, 52, 129, 40, 194, 141, 53, 185, 114, 19, 136, 49, 160, 41, 177, 114, 131, 25, 176, 42, 83, 19, 137, 55, 216, 155, 154, 50, 234, 112, 131, 154, 33, 233, 10, 145, 10, 35, 153, 0, 249, 141, 34, 169, 153, 171, 34, 251, 75, 4, 187, 65, 232, 12, 130, 154, 51, 128, 16, 235, 24, 177, 10, 18, 84, 178, 157, 18, 220, 25, 130, 48, 209, 26, 4, 140, 35, 169, 49, 218, 8, 236, 10, 0, 49, 1, 49, 224, 173, 137, 137, 17, 33, 52, 177, 190, 170, 169, 56, 37, 115, 3, 24, 177, 157, 218, 140, 34, 24, 69, 128, 32, 192, 58, 179, 159, 34, 169, 81, 18, 49, 145, 48, 178, 191, 34, 168, 96, 21, 33, 18, 169, 8, 237, 9, 1, 81, 36, 17, 129, 187, 170, 138, 34, 114, 68, 17, 144, 187, 154, 156, 83, 0, 83, 160, 24, 200, 154, 0, 33, 20, 186, 113, 129, 171, 32, 145, 172, 169, 9, 233, 104, 37, 17, 129, 137, 232, 191, 25, 1, 48, 51, 2, 184, 221, 171, 169, 10, 84, 2, 17, 168, 172, 201, 139, 54, 160, 49, 194, 155, 168, 9, 37, 152, 66, 208, 138, 128, 49, 209, 139, 233, 157, 32, 0, 82, 19, 137, 0, 250, 159, 136, 152, 40, 36, 33, 16, 33, 216, 190, 138, 0, 144, 33, 35, 18, 203, 41, 163, 239, 25, 17, 185, 25, 21, 185, 64, 37, 144, 170, 203, 10, 184, 106, 54, 17, 50, 192, 139, 217, 139, 37, 136, 49, 19, 186, 10, 193, 141, 160, 140, 35, 66, 21, 8, 144, 188, 155, 202, 154, 1, 114, 38, 17, 18, 220, 25, 217, 27, 36, 8, 51, 184, 57, 193, 141, 34, 152, 136, 17, 202, 26, 34, 160, 140, 51, 17, 21, 24, 71, 128, 52, 249, 138, 232, 156, 34, 144, 81, 51, 18, 185, 155, 236, 171, 8, 32, 20, 128, 8, 145, 235, 171, 152, 169, 48, 132, 72, 24, 254, 34, 0, 21, 138, 249, 157, 34, 128, 48, 21, 1, 145, 42, 210, 175, 0, 0, 34, 35, 69, 176, 159, 153, 154, 48, 17, 67, 67, 168, 155, 252, 172, 128, 0, 50, 67, 35, 184, 188, 173, 154, 8, 17, 136, 66, 20, 0, 33, 184, 156, 184, 191, 81, 0, 99, 3, 128, 0, 160, 189, 24, 115, 20, 128, 24, 192, 157, 33, 0, 82, 2, 34, 201, 190, 138, 0, 187, 115, 21, 8, 128, 169, 202, 155, 137, 9, 2, 115, 20, 136, 152, 169, 202, 173, 32, 168, 9, 35, 128, 129, 136, 185, 204, 138, 128, 186, 173, 33, 251, 26, 35, 100, 20, 160, 139, 168, 172, 33, 129, 153, 116, 20, 24, 82, 1, 8, 169, 203, 219, 139, 67, 36, 52, 51, 145, 190, 170, 171, 128, 9, 119, 145, 9, 18, 169, 16, 128, 160, 207, 8, 17, 16, 82, 34, 2, 137, 176, 207, 16, 137, 83, 129, 32, 132, 220, 25, 2, 48, 53, 144, 169, 206, 154, 8, 17, 50, 71, 145, 171, 145, 220, 9, 49, 2, 136, 19, 207, 10, 152, 64, 35, 67, 1, 1, 222, 138, 160, 154, 64, 54, 1, 66, 145, 169, 219, 154, 171, 24, 34, 87, 19, 137, 128, 203, 203, 139, 67, 1, 35, 17, 168, 204, 203, 9, 1, 84, 53, 18, 170, 138, 251, 156, 32, 34, 34, 33, 2, 185, 153, 235, 138, 128, 8, 0, 25, 37, 153, 17, 252, 137, 154, 96, 19, 0, 17, 200, 174, 10, 50, 70, 51, 129, 153, 236, 188, 9, 8, 64, 53, 19, 137, 168, 205, 169, 154, 136, 136, 16, 99, 36, 33, 35, 186, 237, 157, 153, 9, 49, 83, 36, 0, 129, 203, 172, 187, 155, 17, 17, 100, 35, 1, 128, 152, 237, 154, 153, 9, 82, 35, 66, 35, 136, 168, 207, 155, 153, 0, 66, 68, 17, 128, 153, 219, 187, 171, 81, 129, 72, 20, 185, 153, 186, 10, 219, 41, 176, 59, 53, 83, 52, 18, 201, 206, 139, 153, 25, 67, 84, 34, 1, 160, 188, 187, 170, 114, 3, 32, 19, 218, 154, 0, 128, 17, 49, 37, 217, 26, 132, 172, 65, 50, 51, 67, 145, 75, 150, 190, 0, 218, 10, 32, 54, 35, 34, 160, 204, 190, 138, 170, 32, 52, 68, 3, 152, 186, 188, 171, 10, 50, 83, 36, 0, 136, 185, 136, 136, 50, 33, 20, 138, 177, 191, 33, 34, 53, 145, 140, 100, 2, 220, 172, 203, 156, 24, 68, 35, 33, 129, 153, 221, 172, 136, 0, 1, 82, 36, 1, 168, 136, 202, 155, 17, 1, 202, 41, 53, 18, 34, 20, 251, 188, 137, 152, 186, 140, 64, 17, 98, 20, 0, 136, 152, 205, 24, 129, 40, 53, 128, 136, 136, 67, 2, 17, 130, 253, 173, 24, 16, 1, 50, 4, 170, 217, 175, 24, 168, 88, 3, 9, 16, 66, 130, 156, 169, 141, 160, 174, 98, 19, 33, 34, 0, 251, 170, 8, 16, 33, 37, 186, 10, 0, 115, 1, 24, 7, 4, 39, 0, 1, 202, 171, 26, 2, 155, 146, 191, 17, 219, 41, 53, 36, 192, 171, 187, 191, 41, 51, 32, 20, 16, 145, 173, 152, 170, 218, 189, 26, 35, 98, 36, 99, 3, 154, 160, 205, 154, 154, 16, 1, 85, 36, 18, 129, 170, 136, 234, 187, 155, 50, 81, 70, 1, 144, 186, 137, 169, 188, 138, 16, 34, 66, 87, 19, 137, 1, 252, 187, 139, 66, 34, 82, 35, 1, 217, 188, 185, 171, 24, 65, 37, 153, 32, 18, 65, 129, 186, 191, 170, 136, 18, 153, 100, 130, 137, 128, 9, 81, 52, 200, 157, 153, 154, 137, 40, 53, 98, 53, 145, 186, 172, 186, 155, 136, 81, 53, 67, 36, 160, 171, 218, 171, 136, 8, 83, 37, 130, 128, 185, 203, 138, 65, 2, 218, 10, 70, 129, 153, 128, 128, 153, 80, 4, 169, 218, 173, 152, 137, 50, 52, 20, 144, 218, 187, 155, 64, 53, 18, 2, 202, 190, 153, 152, 48, 38, 0, 152, 139, 35, 186, 66, 252, 138, 169, 137, 33, 68, 144, 152, 186, 171, 1, 142, 119, 1, 1, 0, 144, 202, 138, 49, 161, 172, 136, 84, 3, 33, 2, 201, 156, 16, 129, 153, 34, 251, 155, 170, 40, 50, 119, 20, 1, 152, 187, 188, 189, 154, 24, 67, 84, 37, 144, 152, 218, 203, 138, 136, 0, 84, 35, 128, 32, 192, 171, 136, 235, 11, 34, 82, 19, 0, 17, 192, 173, 8, 186, 59, 38, 17, 19, 188, 24, 185, 89, 52, 129, 153, 169, 191, 40, 146, 32, 21, 40, 100, 18, 186, 171, 221, 139, 32, 52, 50, 19, 201, 188, 203, 172, 154, 24, 49, 69, 51, 51, 192, 172, 186, 139, 17, 99, 54, 17, 65, 3, 201, 205, 171, 24, 33, 83, 35, 216, 155, 169, 156, 48, 51, 18, 202, 154, 185, 138, 97, 55, 35, 168, 40, 19, 203, 171, 186, 219, 155, 33, 115, 52, 33, 2, 251, 205, 171, 8, 16, 67, 35, 152, 8, 129, 136, 0, 144, 153, 153, 236, 139, 85, 68, 2, 169, 153, 219, 40, 18, 40, 130, 206, 170, 188, 57, 20, 98, 3, 170, 186, 235, 154, 33, 3, 8, 66, 17, 50, 2, 50, 184, 90, 227, 191, 152, 9, 83, 68, 35, 129, 1, 200, 204, 173, 25, 34, 33, 68, 1, 16, 185, 10, 160, 10, 249, 156, 129, 204, 56, 21, 136, 136, 16, 184, 58, 23, 145, 204, 170, 171, 9, 115, 38, 18, 136, 170, 186, 190, 154, 17, 66, 35, 17, 152, 9, 200, 157, 8, 170, 203, 40, 38, 144, 80, 130, 154, 202, 56, 20, 50, 145, 0, 255, 155, 128, 115, 35, 33, 144, 203, 220, 154, 1, 137, 67, 20, 1, 136, 16, 184, 171, 169, 137, 252, 138, 51, 68, 36, 33, 145, 186, 204, 137, 153, 82, 3, 16, 0, 136, 218, 9, 217, 11, 2, 202, 172, 185, 44, 71, 2, 1, 8, 192, 139, 33, 18, 1, 19, 185, 144, 191, 57, 3, 136, 54, 192, 156, 226, 255, 31, 0, 32, 19, 203, 154, 185, 8, 253, 27, 55, 18, 2, 144, 233, 174, 9, 8, 33, 33, 36, 17, 2, 201, 205, 9, 136, 185, 171, 80, 52, 37, 18, 185, 171, 155, 136, 153, 98, 19, 128, 219, 202, 171, 82, 2, 136, 235, 9, 200, 42, 37, 0, 49, 37, 35, 54, 208, 140, 128, 202, 10, 66, 1, 113, 52, 1, 184, 139, 168, 191, 170, 138, 68, 67, 36, 0, 153, 186, 205, 171, 152, 8, 99, 52, 18, 128, 169, 188, 187, 137, 34, 33, 69, 35, 49, 3, 201, 138, 50, 209, 190, 187, 156, 138, 24, 52, 19, 24, 17, 249, 223, 25, 18, 1, 153, 9, 128, 137, 114, 21, 160, 8, 1, 186, 190, 8, 1, 40, 85, 2, 185, 170, 185, 172, 171, 42, 23, 170, 24, 152, 98, 51, 146, 172, 50, 152, 116, 19, 136, 186, 10, 168, 27, 71, 36, 160, 154, 184, 174, 154, 56, 67, 99, 3, 170, 218, 172, 24, 128, 16, 16, 65, 35, 33, 52, 1, 254, 157, 152, 10, 82, 36, 34, 152, 219, 172, 8, 32, 3, 154, 0, 171, 97, 2, 49, 35, 35, 252, 155, 185, 64, 36, 81, 162, 189, 171, 40, 35, 82, 20, 176, 204, 138, 8, 65, 35, 50, 176, 155, 217, 154, 168, 11, 71, 129, 137, 9, 1, 187, 115, 177, 11, 130, 154, 234, 173, 137, 202, 10, 34, 16, 71, 18, 233, 171, 170, 57, 21, 24, 34, 40, 70, 129, 154, 187, 187, 170, 57, 87, 176, 42, 54, 160, 170, 24, 2, 222, 41, 34, 0, 168, 8, 200, 11, 34, 70, 161, 157, 128, 170, 8, 115, 146, 41, 37, 2, 218, 187, 153, 172, 10, 50, 53, 99, 19, 152, 153, 24, 129, 190, 185, 172, 0, 40, 87, 0, 49, 145, 204, 171, 137, 152, 97, 19, 136, 68, 2, 17, 161, 172, 155, 25, 34, 0, 170, 114, 21, 144, 203, 205, 138, 52, 160, 154, 153, 154, 40, 71, 34, 50, 160, 171, 233, 154, 153, 138, 50, 66, 22, 168, 64, 35, 129, 219, 25, 176, 175, 64, 160, 24, 2, 33, 249, 42, 178, 43, 22, 138, 130, 171, 18, 8, 20, 235, 202, 187, 56, 162, 121, 71, 1, 144, 170, 202, 153, 48, 71, 128, 128, 154, 16, 185, 170, 204, 170, 187, 96, 36, 50, 37, 32, 18, 236, 188, 155, 9, 82, 52, 50, 35, 177, 188, 203, 204, 137, 17, 33, 68, 35, 18, 152, 169, 221, 187, 137, 185, 25, 38, 8, 67, 162, 203, 137, 136, 17, 250, 172, 168, 156, 65, 36, 1, 34, 17, 129, 170, 137, 254, 11, 33, 49, 69, 34, 128, 154, 185, 205, 137, 170, 9, 99, 35, 35, 35, 201, 156, 24, 0, 16, 169, 56, 83, 36, 184, 172, 219, 140, 33, 52, 146, 205, 171, 137, 153, 137, 24, 53, 146, 0, 99, 147, 223, 40, 145, 187, 138, 115, 51, 35, 176, 172, 203, 154, 48, 68, 19, 129, 202, 188, 187, 154, 113, 38, 107, 0, 37, 0, 1, 48, 3, 8, 145, 205, 172, 170, 137, 82, 52, 34, 2, 185, 204, 235, 10, 0, 9, 50, 34, 1, 168, 88, 54, 128, 169, 250, 188, 24, 66, 36, 18, 51, 145, 156, 0, 202, 156, 169, 9, 144, 187, 153, 139, 119, 51, 160, 156, 169, 188, 138, 186, 171, 137, 82, 208, 27, 54, 145, 9, 176, 204, 172, 8, 49, 52, 145, 153, 184, 174, 40, 35, 2, 160, 188, 252, 156, 0, 80, 54, 17, 18, 51, 2, 171, 17, 252, 137, 1, 169, 203, 64, 54, 37, 130, 170, 187, 170, 8, 1, 128, 49, 132, 155, 0, 136, 169, 201, 223, 49, 208, 139, 33, 1, 32, 86, 19, 152, 202, 156, 48, 54, 1, 185, 173, 24, 0, 49, 161, 170, 154, 153, 221, 187, 155, 65, 19, 17, 233, 170, 188, 64, 36, 51, 67, 52, 234, 188, 186, 40, 35, 50, 162, 156, 1, 251, 157, 34, 184, 26, 54, 130, 203, 155, 64, 19, 171, 97, 51, 83, 53, 1, 202, 187, 137, 152, 25, 55, 67, 35, 168, 11, 145, 189, 10, 168, 189, 64, 130, 154, 65, 177, 140, 208, 173, 9, 40, 51, 52, 250, 140, 33, 2, 8, 85, 3, 186, 173, 8, 128, 32, 37, 129, 33, 67, 192, 173, 152, 155, 66, 52, 162, 189, 172, 188, 24, 99, 2, 152, 169, 187, 187, 26, 34, 250, 140, 33, 233, 139, 50, 36, 145, 186, 152, 155, 82, 2, 116, 19, 168, 136, 201, 155, 65, 130, 169, 204, 171, 0, 83, 37, 16, 69, 2, 8, 136, 169, 138, 16, 86, 51, 130, 32, 20, 219, 24, 1, 81, 162, 10, 36, 200, 26, 54, 2, 186, 97, 162, 139, 1, 153, 48, 70, 160, 190, 203, 137, 49, 69, 18, 128, 202, 171, 188, 156, 50, 54, 19, 136, 200, 187, 235, 155, 169, 156, 8, 49, 22, 185, 16, 160, 205, 171, 10, 8, 68, 18, 0, 136, 144, 172, 49, 52, 85, 35, 144, 170, 24, 250, 27, 52, 51, 1, 152, 185, 59, 4, 24, 55, 51, 192, 173, 154, 188, 24, 17, 19, 170, 117, 3, 136, 155, 1, 223, 138, 153, 64, 19, 33, 192, 188, 219, 154, 184, 139, 68, 18, 129, 154, 160, 189, 56, 38, 19, 184, 138, 200, 140, 99, 35, 33, 50, 176, 206, 171, 24, 1, 18, 144, 34, 253, 153, 218, 8, 144, 136, 153, 130, 12, 39, 1, 18, 144, 184, 172, 40, 66, 87, 36, 34, 129, 170, 219, 187, 154, 48, 53, 52, 37, 17, 0, 144, 170, 136, 186, 156, 137, 154, 201, 90, 39, 16, 66, 18, 232, 204, 154, 32, 3, 153, 33, 83, 3, 202, 204, 171, 154, 138, 128, 128, 17, 35, 1, 128, 25, 84, 144, 96, 210, 175, 16, 0, 144, 173, 50, 152, 115, 20, 136, 32, 145, 28, 36, 220, 57, 20, 168, 170, 24, 176, 120, 36, 168, 154, 114, 19, 144, 185, 173, 152, 24, 68, 18, 16, 51, 251, 139, 169, 10, 83, 18, 216, 0, 22, 0, 169, 202, 170, 8, 16, 115, 38, 17, 33, 152, 137, 153, 154, 64, 53, 185, 27, 2, 33, 35, 2, 248, 239, 137, 0, 202, 156, 65, 130, 170, 187, 41, 2, 187, 98, 193, 141, 18, 2, 170, 25, 18, 200, 158, 82, 129, 187, 9, 160, 203, 189, 73, 162, 191, 137, 9, 68, 50, 2, 57, 38, 137, 82, 145, 203, 137, 66, 17, 16, 129, 16, 176, 187, 190, 26, 144, 8, 24, 87, 145, 25, 144, 113, 3, 24, 2, 128, 202, 153, 25, 85, 161, 171, 137, 32, 117, 53, 145, 202, 203, 136, 128, 154, 81, 162, 175, 24, 34, 130, 138, 84, 162, 203, 171, 170, 219, 10, 1, 152, 0, 48, 21, 80, 36, 48, 39, 184, 203, 170, 171, 64, 51, 18, 152, 153, 128, 0, 33, 53, 3, 235, 206, 188, 187, 57, 55, 152, 82, 146, 137, 201, 140, 154, 25, 18, 128, 152, 170, 170, 113, 87, 0, 16, 152, 136, 218, 26, 130, 170, 33, 55, 184, 58, 21, 32, 52, 67, 3, 187, 218, 156, 128, 25, 86, 18, 129, 137, 154, 0, 137, 49, 51, 51, 38, 184, 203, 156, 52, 248, 155, 0, 218, 139, 18, 201, 137, 234, 171, 144, 203, 9, 130, 10, 85, 2, 160, 171, 152, 189, 137, 185, 42, 67, 177, 59, 103, 33, 53, 130, 203, 170, 170, 25, 36, 33, 18, 144, 252, 10, 67, 34, 34, 51, 162, 172, 128, 172, 98, 18, 0, 235, 96, 36, 33, 19, 152, 153, 169, 220, 10, 50, 66, 21, 186, 154, 8, 184, 207, 154, 0, 152, 48, 3, 117, 130, 99, 130, 32, 192, 172, 168, 26, 130, 222, 9, 129, 33, 19, 51, 129, 40, 248, 206, 187, 170, 153, 49, 20, 49, 20, 1, 249, 156, 16, 51, 2, 137, 8, 0, 152, 114, 131, 139, 144, 188, 188, 189, 10, 33, 50, 192, 155, 144, 11, 116, 51, 130, 154, 184, 223, 153, 0, 16, 82, 37, 18, 160, 173, 16, 144, 8, 100, 19, 153, 152, 221, 10, 0, 49, 20, 153, 49, 2, 169, 113, 19, 49, 21, 169, 136, 137, 99, 51, 52, 129, 203, 220, 171, 17, 1, 153, 40, 249, 157, 168, 9, 35, 169, 138, 83, 200, 26, 192, 26, 5, 16, 51, 83, 192, 27, 36, 2, 186, 187, 253, 10, 17, 24, 67, 34, 169, 153, 186, 112, 21, 66, 162, 173, 128, 138, 33, 82, 19, 32, 3, 206, 187, 10, 0, 16, 67, 67, 193, 174, 184, 190, 25, 16, 0, 81, 3, 187, 9, 17, 2, 144, 239, 26, 36, 0, 68, 34, 145, 137, 0, 154, 67, 17, 51, 171, 36, 235, 137, 154, 99, 217, 138, 169, 186, 189, 24, 33, 68, 33, 3, 185, 222, 138, 35, 184, 189, 171, 16, 18, 81, 52, 178, 223, 169, 204, 10, 17, 16, 32, 36, 161, 169, 8, 32, 50, 54, 51, 2, 152, 153, 8, 251, 156, 33, 128, 8, 217, 26, 33, 20, 48, 6, 188, 152, 10, 224, 158, 109, 255, 14, 0, 32, 52, 37, 0, 32, 129, 219, 187, 186, 175, 24, 0, 100, 3, 8, 152, 154, 219, 10, 51, 69, 130, 154, 0, 170, 153, 138, 51, 67, 69, 50, 83, 18, 1, 17, 2, 10, 119, 1, 168, 174, 24, 160, 41, 52, 85, 129, 137, 170, 9, 185, 10, 19, 83, 37, 50, 224, 191, 155, 10, 50, 34, 36, 202, 24, 185, 25, 1, 33, 17, 70, 160, 152, 220, 40, 18, 67, 146, 204, 189, 154, 160, 26, 87, 2, 153, 153, 153, 9, 33, 192, 189, 156, 154, 8, 17, 2, 115, 23, 137, 137, 186, 154, 65, 54, 33, 18, 160, 185, 220, 155, 136, 202, 171, 137, 82, 35, 68, 36, 144, 8, 169, 189, 203, 171, 83, 68, 36, 129, 153, 154, 153, 48, 20, 128, 153, 152, 187, 25, 50, 179, 255, 32, 129, 189, 137, 144, 154, 82, 54, 2, 154, 32, 35, 128, 172, 251, 172, 24, 136, 128, 152, 114, 129, 170, 137, 152, 128, 8, 33, 186, 101, 1, 129, 223, 153, 202, 10, 137, 65, 35, 18, 0, 168, 172, 0, 50, 55, 169, 25, 144, 116, 6, 136, 0, 49, 51, 35, 168, 105, 21, 153, 136, 201, 155, 82, 161, 173, 169, 221, 187, 154, 16, 2, 144, 82, 35, 67, 35, 82, 19, 171, 136, 203, 153, 136, 216, 158, 49, 128, 32, 51, 71, 1, 34, 2, 202, 154, 0, 1, 128, 250, 190, 9, 17, 49, 71, 51, 4, 152, 24, 201, 172, 137, 153, 185, 156, 8, 115, 3, 64, 161, 155, 128, 9, 176, 206, 155, 218, 206, 10, 0, 25, 50, 1, 68, 128, 152, 154, 217, 156, 1, 153, 115, 2, 8, 0, 168, 56, 55, 17, 34, 144, 203, 186, 154, 144, 191, 154, 222, 40, 36, 83, 35, 136, 152, 171, 24, 87, 18, 33, 18, 169, 25, 192, 157, 168, 139, 3, 220, 136, 251, 139, 32, 36, 50, 20, 185, 9, 217, 187, 155, 144, 204, 152, 171, 32, 169, 154, 203, 136, 203, 84, 144, 0, 40, 119, 131, 0, 202, 155, 129, 48, 36, 68, 35, 16, 144, 187, 48, 32, 68, 250, 57, 5, 172, 32, 161, 11, 2, 115, 18, 50, 145, 97, 192, 10, 201, 56, 3, 136, 169, 154, 217, 173, 9, 2, 153, 34, 203, 101, 161, 186, 219, 219, 171, 65, 144, 48, 145, 156, 64, 176, 28, 35, 171, 1, 138, 83, 129, 43, 103, 200, 10, 129, 10, 128, 64, 162, 73, 37, 1, 138, 69, 129, 17, 168, 137, 187, 98, 217, 155, 8, 83, 2, 84, 35, 16, 83, 147, 41, 18, 153, 252, 156, 1 };
 
-static const size_t audio_thirty_sample_data_length = sizeof(audio_thirty_sample_data) / sizeof(audio_thirty_sample_data[0]);
+static const size_t audio_thirty_sample_data_length = 23420;
@@ -1,4 +1,4 @@
-// This file was generated by a script on 03-12-2024 09:42:17
+// This file was generated by a script on 17-10-2026 14:19:03
 
 #pragma once
 
@@ -6,6 +6,7 @@
 #include <stdint.h>
 #include <pico/platform/sections.h>
 
-static const int16_t __in_flash("audio_twenty_sample_data") audio_twenty_sample_data[] = { 117, 39, -115, -197, -141, -18, 74, 109, 104, 52, -43, -129, -145, -82, 25, 111, 87, -38, -100, 31, 224, 222, 3, -185, -167, -31, 42, 24, -14, -51, -81, -46, 54, 80, -38, -172, -195, -145, -71, 38, 119, 67, -20, 33, 173, 196, 99, 65, 144, 204, 159, 69, 21, 26, 41, 23, -26, -58, -18, 77, 126, 60, -65, -150, -198, -283, -420, -561, -640, -586, -380, -148, -51, -46, 64, 296, 414, 319, 293, 604, 1023, 1130, 959, 877, 886, 663, 197, -275, -847, -1718, -2570, -2840, -2452, -1724, -880, -25, 782, 1729, 3060, 4475, 5220, 4914, 3931, 2876, 1987, 1107, 83, -876, -1316, -1086, -611, -383, -343, -84, 384, 480, -220, -1370, -2212, -2384, -2112, -1709, -1200, -504, 304, 970, 1204, 911, 339, -93, -186, -114, -103, -82, 229, 965, 1905, 2632, 2796, 2303, 1362, 356, -443, -1026, -1430, -1545, -1282, -815, -425, -196, -72, -89, -340, -755, -1097, -1208, -1108, -836, -371, 203, 667, 855, 762, 362, -391, -1370, -2255, -2758, -2712, -2060, -983, 139, 1098, 1946, 2584, 2605, 1828, 676, -232, -729, -1033, -1235, -1132, -612, 39, 414, 409, 238, 54, -192, -500, -700, -688, -550, -347, 5, 475, 801, 795, 566, 269, -129, -656, -1041, -906, -243, 466, 677, 287, -335, -781, -934, -911, -816, -653, -392, -7, 492, 1018, 1362, 1337, 1017, 719, 614, 555, 397, 224, 113, 75, 271, 708, 809, 140, -591, -334, 708, 1389, 1288, 976, 813, 533, -52, -763, -1353, -1676, -1656, -1336, -826, -146, 686, 1453, 1839, 1731, 1339, 1028, 973, 959, 718, 505, 950, 2089, 2983, 2679, 1309, -173, -1168, -1842, -2436, -2757, -2572, -2011, -1250, -289, 645, 992, 531, -296, -1022, -1542, -1767, -1482, -776, -30, 575, 1177, 1840, 2380, 2521, 2126, 1408, 924, 1059, 1521, 1586, 851, -468, -1889, -3028, -3639, -3643, -3271, -2921, -2609, -1833, -289, 1531, 2829, 3259, 2905, 1876, 358, -1163, -2053, -1855, -579, 1138, 2477, 3289, 4087, 4936, 5040, 3861, 2019, 512, -454, -1300, -2099, -2353, -1696, -406, 916, 1819, 2084, 1663, 746, -260, -931, -991, -444, 286, 585, 259, -206, -293, -150, -272, -610, -537, 136, 774, 849, 569, 204, -352, -988, -1311, -1490, -2042, -2719, -2756, -2113, -1315, -514, 175, 184, -634, -1526, -2046, -2753, -4094, -5554, -6202, -5354, -2932, 79, 2070, 2390, 1912, 1549, 1139, 269, -718, -1193, -1056, -488, 635, 2412, 4213, 5046, 4658, 3660, 2559, 1306, -229, -1987, -3643, -4333, -3215, -853, 969, 1336, 888, 354, -158, -509, -757, -1580, -2958, -3398, -1957, 172, 1488, 2168, 3007, 3728, 3491, 2133, 252, -1279, -1754, -1181, -298, 310, 749, 1172, 1178, 232, -1550, -3341, -4235, -3866, -2579, -1174, -299, 125, 689, 1420, 1409, 71, -1745, -2666, -2407, -1739, -1319, -1251, -1360, -1294, -777, -132, -115, -898, -1728, -1988, -2013, -2309, -2398, -1410, 300, 1172, 352, -1264, -2302, -2421, -2157, -1877, -1467, -811, -156, 102, -94, -500, -1098, -2044, -2894, -2779, -1763, -973, -885, -720, -67, 325, 53, -90, 455, 928, 472, -418, -531, 472, 1760, 2420, 2292, 1792, 1412, 1398, 1553, 1384, 749, 242, 494, 1250, 1735, 1873, 2350, 3231, 3475, 2425, 906, 11, -322, -618, -642, 44, 1102, 1994, 2871, 3923, 4448, 3602, 1846, 613, 463, 484, -169, -1037, -1122, -205, 1054, 1775, 1438, 366, -457, -485, -270, -568, -1341, -2027, -2211, -1719, -732, 54, 32, -530, -866, -742, -563, -576, -487, 159, 1419, 2664, 3008, 2217, 975, 1, -624, -965, -781, -58, 644, 813, 489, -19, -470, -818, -1375, -2498, -3707, -3802, -2368, -514, 461, 549, 633, 1106, 1436, 966, -183, -1126, -1130, -411, 210, 439, 882, 2104, 3594, 4192, 3497, 2295, 1452, 991, 585, 344, 580, 1177, 1680, 1781, 1474, 877, 155, -483, -849, -834, -443, 163, 696, 871, 598, 90, -245, -89, 534, 1264, 1698, 1774, 1797, 1996, 2185, 2045, 1624, 1239, 986, 657, 135, -412, -783, -950, -987, -893, -572, -63, 292, 199, -97, -96, 118, -93, -893, -1576, -1527, -954, -339, 305, 1147, 1874, 1930, 1314, 594, 114, -289, -713, -904, -668, -119, 489, 842, 670, 122, -325, -610, -1183, -2057, -2440, -1710, -285, 893, 1363, 1315, 1101, 905, 740, 475, -50, -694, -908, -316, 687, 1251, 1012, 350, -273, -807, -1258, -1342, -874, -211, 201, 502, 1120, 1956, 2385, 2034, 1144, 226, -323, -355, -66, 70, -257, -846, -1198, -1137, -997, -1160, -1592, -1952, -1974, -1627, -1063, -545, -313, -414, -622, -548, 92, 1151, 1983, 1955, 1180, 566, 835, 1576, 1750, 1131, 596, 807, 1422, 1929, 2332, 2660, 2710, 2552, 2491, 2462, 2227, 1971, 1923, 1779, 1227, 594, 311, 246, 28, -431, -1010, -1606, -2182, -2768, -3276, -3307, -2580, -1548, -942, -758, -415, 146, 327, -127, -754, -1150, -1481, -1852, -1861, -1284, -675, -561, -623, -456, -496, -1249, -2206, -2547, -2378, -2375, -2672, -2919, -3067, -3318, -3522, -3362, -3048, -3086, -3316, -3087, -2396, -1886, -1723, -1607, -1690, -2200, -2561, -2179, -1542, -1260, -877, 114, 1037, 1025, 449, 214, 286, -90, -1033, -1754, -1695, -1231, -984, -936, -670, -98, 406, 458, 55, -332, -217, 257, 450, 122, -369, -712, -761, -183, 1050, 2091, 2135, 1659, 1725, 2384, 2798, 2734, 2843, 3428, 3878, 3666, 3074, 2511, 1879, 1227, 1174, 1964, 2796, 2827, 2215, 1577, 1093, 724, 706, 1141, 1470, 1103, 340, -27, 89, 126, -2, 207, 871, 1562, 2030, 2221, 1865, 870, -212, -768, -762, -353, 520, 1699, 2510, 2470, 1920, 1412, 834, -92, -824, -637, 33, 178, -163, -320, -521, -1392, -2465, -2826, -2707, -2954, -3448, -3366, -2604, -1829, -1397, -1092, -813, -850, -1340, -1880, -2016, -1876, -1942, -2263, -2365, -1979, -1419, -1073, -926, -830, -892, -1260, -1758, -2048, -2048, -1900, -1599, -1045, -444, -189, -264, -255, -70, -41, -206, -217, -66, -149, -541, -885, -1087, -1381, -1667, -1494, -917, -665, -1027, -1300, -964, -659, -1094, -1831, -2166, -2256, -2333, -1986, -1193, -732, -757, -451, 347, 727, 284, -290, -434, -323, -193, -36, 79, 58, 24, 157, 417, 579, 424, -50, -517, -632, -498, -462, -546, -574, -684, -1092, -1535, -1616, -1449, -1333, -1169, -739, -198, 204, 479, 629, 444, -58, -417, -325, -128, -234, -322, 147, 912, 1294, 1311, 1338, 1100, 226, -673, -836, -694, -1066, -1615, -1376, -343, 589, 954, 1080, 1328, 1653, 1959, 2327, 2720, 2862, 2654, 2449, 2562, 2744, 2555, 2132, 2034, 2307, 2396, 2090, 1873, 2041, 2212, 2054, 1793, 1680, 1570, 1319, 1059, 988, 1263, 1963, 2852, 3504, 3798, 3891, 3725, 3156, 2399, 1731, 1082, 450, 210, 467, 775, 923, 1220, 1711, 1942, 1750, 1507, 1449, 1440, 1373, 1258, 1081, 892, 806, 742, 516, 226, 155, 297, 361, 151, -320, -941, -1526, -1949, -2313, -2725, -2923, -2516, -1582, -647, -60, 274, 549, 746, 760, 600, 374, 152, -61, -236, -279, -236, -403, -931, -1469, -1553, -1226, -791, -214, 608, 1236, 1092, 338, -320, -553, -590, -663, -777, -917, -1076, -1083, -754, -195, 239, 365, 376, 534, 765, 759, 443, 124, 116, 439, 966, 1606, 2172, 2329, 1897, 1050, 106, -639, -919, -676, -215, 147, 476, 905, 1203, 1043, 474, -183, -718, -1069, -1276, -1506, -1887, -2310, -2589, -2703, -2712, -2673, -2736, -2971, -3087, -2789, -2291, -1971, -1818, -1741, -1902, -2202, -2030, -1125, -58, 586, 892, 1070, 953, 413, -249, -737, -1195, -1799, -2245, -2080, -1365, -546, 220, 1097, 1986, 2458, 2324, 1816, 1150, 323, -549, -1116, -1228, -1159, -1123, -951, -509, -53, 213, 449, 696, 606, 74, -362, -257, 97, 236, 354, 944, 1824, 2247, 2018, 1724, 1677, 1337, 240, -1090, -1668, -1183, -252, 313, 293, 164, 449, 1058, 1459, 1434, 1338, 1568, 2074, 2474, 2483, 2213, 2090, 2369, 2736, 2617, 1890, 1007, 407, 131, -11, -193, -454, -644, -532, -141, 154, 49, -338, -648, -709, -581, -308, 154, 753, 1295, 1672, 1953, 2194, 2325, 2309, 2268, 2364, 2652, 3026, 3252, 3136, 2731, 2300, 2007, 1795, 1595, 1495, 1559, 1672, 1688, 1635, 1596, 1446, 924, -3, -1038, -1872, -2447, -2829, -3006, -2958, -2799, -2699, -2709, -2723, -2684, -2731, -3045, -3532, -3803, -3604, -3091, -2619, -2358, -2228, -2079, -1807, -1383, -899, -519, -262, 102, 704, 1209, 1171, 721, 458, 584, 726, 669, 634, 700, 620, 327, 86, -6, -213, -724, -1384, -1917, -2203, -2309, -2345, -2373, -2411, -2460, -2478, -2362, -2104, -1923, -2108, -2664, -3229, -3415, -3177, -2743, -2271, -1756, -1244, -894, -763, -721, -661, -585, -412, 56, 830, 1563, 1877, 1759, 1462, 1147, 785, 405, 200, 267, 401, 328, 76, -146, -379, -898, -1723, -2458, -2765, -2710, -2504, -2179, -1743, -1394, -1375, -1685, -2073, -2289, -2304, -2278, -2315, -2337, -2243, -2096, -2019, -1939, -1626, -1094, -765, -966, -1428, -1617, -1460, -1271, -1131, -853, -434, -26, 363, 707, 762, 457, 150, 153, 305, 356, 425, 759, 1292, 1721, 1885, 1786, 1390, 727, 135, -17, 170, 279, 232, 376, 845, 1295, 1402, 1290, 1221, 1167, 985, 798, 826, 991, 1063, 1068, 1193, 1408, 1511, 1458, 1368, 1315, 1335, 1521, 1909, 2343, 2646, 2851, 3088, 3286, 3212, 2831, 2387, 2095, 1973, 2012, 2243, 2554, 2668, 2499, 2276, 2178, 2015, 1562, 1012, 733, 713, 694, 696, 928, 1277, 1369, 1099, 697, 346, 7, -433, -999, -1554, -1905, -2020, -2028, -1951, -1697, -1412, -1433, -1769, -1974, -1722, -1226, -905, -902, -1026, -1014, -754, -366, -105, -123, -255, -139, 380, 1075, 1636, 1986, 2157, 2136, 1958, 1717, 1381, 894, 443, 266, 228, 28, -282, -434, -465, -661, -1049, -1383, -1588, -1834, -2142, -2290, -2194, -2140, -2396, -2796, -2957, -2809, -2584, -2352, -1926, -1340, -987, -1042, -1127, -887, -500, -259, -88, 157, 355, 402, 448, 569, 613, 542, 535, 668, 775, 659, 262, -294, -777, -1123, -1559, -2170, -2604, -2558, -2281, -2171, -2178, -2043, -1840, -1820, -1963, -2010, -1835, -1568, -1424, -1439, -1403, -1175, -996, -1135, -1321, -1057, -425, 5, 71, 226, 728, 1239, 1395, 1340, 1413, 1624, 1781, 1909, 2152, 2404, 2443, 2328, 2308, 2405, 2430, 2297, 2060, 1792, 1607, 1615, 1797, 2077, 2453, 2851, 3133, 3402, 3820, 4103, 3812, 3200, 2954, 3113, 3088, 2703, 2351, 2175, 1923, 1594, 1509, 1724, 1879, 1720, 1413, 1248, 1243, 1174, 916, 564, 235, -106, -518, -891, -1042, -945, -746, -590, -548, -585, -575, -432, -303, -395, -635, -779, -791, -777, -649, -299, 52, 84, -141, -311, -339, -353, -354, -217, 3, 100, 33, -41, -119, -409, -933, -1340, -1352, -1189, -1216, -1340, -1178, -818, -839, -1424, -2070, -2423, -2747, -3224, -3474, -3144, -2404, -1604, -960, -665, -776, -970, -894, -653, -588, -659, -509, -74, 316, 484, 668, 1045, 1360, 1309, 1015, 810, 829, 1033, 1370, 1748, 2081, 2445, 2937, 3382, 3472, 3186, 2835, 2673, 2682, 2773, 2949, 3205, 3395, 3366, 3151, 2910, 2708, 2483, 2253, 2159, 2270, 2470, 2673, 2890, 3009, 2792, 2310, 1995, 2030, 2083, 1919, 1806, 2020, 2312, 2256, 1839, 1368, 980, 581, 184, -12, 47, 161, 172, 181, 318, 478, 471, 302, 151, 131, 214, 358, 509, 544, 370, 98, -68, -114, -199, -403, -607, -685, -660, -617, -586, -566, -609, -746, -935, -1164, -1452, -1714, -1823, -1844, -1895, -1826, -1451, -1032, -1020, -1346, -1538, -1470, -1488, -1747, -1951, -1870, -1668, -1515, -1243, -732, -273, -149, -182, -84, 45, 2, -71, 44, 254, 359, 441, 669, 929, 981, 851, 776, 790, 717, 541, 447, 452, 339, 44, -246, -395, -422, -348, -175, -43, -123, -294, -217, 161, 477, 514, 473, 462, 261, -92, -233, -216, -464, -820, -711, -274, -193, -475, -567, -478, -679, -1079, -1157, -947, -997, -1373, -1510, -1141, -736, -760, -1014, -1108, -1120, -1333, -1682, -1931, -2115, -2374, -2640, -2778, -2862, -3036, -3242, -3246, -2911, -2394, -2020, -1921, -1929, -1926, -2028, -2255, -2369, -2327, -2402, -2630, -2664, -2450, -2328, -2376, -2342, -2241, -2261, -2254, -2061, -2002, -2341, -2752, -2882, -2863, -2826, -2584, -2099, -1663, -1393, -1106, -778, -624, -663, -612, -334, -37, 96, 214, 484, 775, 913, 985, 1089, 1068, 818, 578, 579, 687, 654, 493, 382, 401, 479, 513, 482, 485, 601, 732, 730, 607, 454, 283, 124, 60, -10, -325, -810, -1096, -1120, -1231, -1540, -1704, -1545, -1373, -1502, -1810, -2006, -2054, -2108, -2211, -2287, -2351, -2520, -2784, -2918, -2785, -2562, -2489, -2523, -2484, -2436, -2592, -2883, -3020, -2940, -2834, -2763, -2570, -2226, -1917, -1720, -1490, -1197, -1082, -1262, -1482, -1515, -1516, -1627, -1642, -1430, -1243, -1253, -1239, -1027, -790, -663, -536, -397, -422, -616, -740, -741, -891, -1311, -1688, -1678, -1397, -1196, -1144, -1064, -900, -716, -498, -259, -142, -184, -179, 12, 223, 253, 200, 259, 392, 459, 566, 926, 1409, 1658, 1633, 1651, 1812, 1860, 1690, 1598, 1804, 2069, 2062, 1878, 1891, 2206, 2570, 2782, 2870, 2879, 2749, 2492, 2246, 2108, 2058, 2091, 2251, 2455, 2490, 2328, 2208, 2238, 2205, 1978, 1761, 1729, 1761, 1752, 1817, 2008, 2161, 2173, 2138, 2131, 2107, 2072, 2127, 2278, 2374, 2318, 2205, 2141, 2085, 1977, 1871, 1782, 1620, 1405, 1316, 1377, 1392, 1271, 1156, 1106, 952, 618, 318, 234, 236, 178, 241, 615, 1000, 923, 437, 50, 26, 188, 356, 550, 794, 1043, 1310, 1626, 1868, 1856, 1653, 1548, 1683, 1932, 2208, 2552, 2876, 2998, 3010, 3171, 3406, 3378, 3047, 2741, 2654, 2688, 2763, 2924, 3134, 3215, 3104, 2938, 2813, 2639, 2324, 1962, 1699, 1573, 1585, 1728, 1848, 1724, 1372, 1085, 1058, 1169, 1232, 1262, 1310, 1279, 1164, 1247, 1631, 1892, 1713, 1507, 1755, 2187, 2281, 2105, 1989, 1884, 1651, 1514, 1690, 1968, 2039, 1895, 1677, 1408, 1068, 751, 549, 390, 152, -125, -298, -326, -274, -165, -4, 120, 139, 98, 21, -192, -582, -957, -1086, -1004, -919, -874, -718, -421, -158, -3, 135, 250, 208, 56, 29, 203, 403, 526, 678, 927, 1130, 1150, 1068, 1037, 1048, 994, 870, 733, 579, 424, 356, 370, 331, 211, 140, 163, 187, 173, 145, 74, -65, -205, -322, -521, -816, -1005, -938, -761, -680, -600, -279, 222, 569, 675, 824, 1172, 1469, 1481, 1371, 1420, 1589, 1660, 1643, 1730, 1922, 2031, 2051, 2193, 2458, 2534, 2277, 2013, 2085, 2328, 2298, 1916, 1556, 1496, 1596, 1607, 1554, 1581, 1627, 1547, 1443, 1507, 1571, 1281, 709, 315, 252, 223, 85, 48, 209, 379, 427, 400, 287, 7, -369, -648, -763, -838, -992, -1171, -1209, -1055, -874, -828, -836, -721, -537, -510, -666, -777, -707, -600, -635, -787, -895, -859, -741, -679, -725, -807, -880, -989, -1116, -1171, -1190, -1324, -1520, -1540, -1375, -1310, -1429, -1433, -1135, -808, -786, -968, -1048, -1039, -1191, -1472, -1548, -1308, -1012, -841, -684, -474, -362, -432, -519, -466, -367, -355, -343, -154, 163, 367, 328, 128, -133, -437, -748, -964, -1053, -1098, -1166, -1238, -1289, -1365, -1496, -1661, -1890, -2258, -2692, -2995, -3104, -3141, -3173, -3160, -3132, -3176, -3276, -3367, -3496, -3733, -4022, -4253, -4442, -4667, -4881, -4957, -4906, -4901, -5031, -5215, -5367, -5544, -5783, -5928, -5805, -5525, -5370, -5366, -5283, -5131, -5172, -5393, -5479, -5447, -5644, -6033, -6168, -5948, -5695, -5551, -5399, -5259, -5221, -5149, -4921, -4715, -4745, -4885, -4903, -4826, -4834, -4885, -4814, -4660, -4586, -4527, -4353, -4297, -4645, -5121, -5202, -4976, -4986, -5315, -5471, -5195, -4801, -4658, -4724, -4732, -4583, -4407, -4320, -4263, -4155, -4077, -4102, -4099, -3900, -3618, -3519, -3575, -3442, -2964, -2462, -2293, -2342, -2305, -2243, -2433, -2761, -2811, -2562, -2383, -2364, -2196, -1762, -1319, -1061, -910, -755, -620, -605, -761, -990, -1083, -965, -792, -668, -499, -250, -63, 10, 117, 303, 403, 326, 220, 188, 140, 6, -60, 57, 190, 127, 9, 142, 480, 650, 463, 99, -192, -324, -356, -435, -638, -811, -746, -471, -142, 228, 646, 964, 1121, 1293, 1539, 1657, 1594, 1601, 1803, 1998, 2019, 1958, 1958, 2042, 2186, 2372, 2628, 3019, 3501, 3842, 3960, 4094, 4360, 4502, 4404, 4366, 4548, 4675, 4615, 4648, 4895, 5089, 5119, 5202, 5386, 5432, 5267, 5135, 5228, 5447, 5573, 5537, 5517, 5740, 6135, 6422, 6547, 6720, 6957, 7038, 6993, 7069, 7196, 7064, 6762, 6655, 6714, 6589, 6270, 6082, 6120, 6153, 6013, 5725, 5388, 5086, 4797, 4428, 4005, 3685, 3436, 3080, 2708, 2630, 2807, 2825, 2546, 2331, 2437, 2630, 2607, 2461, 2438, 2492, 2441, 2343, 2355, 2362, 2212, 2097, 2238, 2440, 2455, 2456, 2679, 2927, 2906, 2743, 2776, 3044, 3310, 3417, 3406, 3394, 3453, 3588, 3742, 3821, 3765, 3608, 3457, 3414, 3505, 3662, 3725, 3542, 3145, 2764, 2614, 2651, 2684, 2700, 2857, 3111, 3153, 2893, 2616, 2459, 2204, 1750, 1335, 1095, 909, 761, 724, 651, 357, 37, -6, 79, -93, -510, -771, -731, -710, -959, -1280, -1368, -1260, -1195, -1231, -1277, -1355, -1545, -1748, -1793, -1746, -1828, -2022, -2105, -2077, -2166, -2346, -2387, -2383, -2650, -3042, -3084, -2780, -2624, -2786, -2925, -2836, -2704, -2681, -2645, -2477, -2271, -2144, -2051, -1906, -1747, -1621, -1453, -1174, -829, -463, -26, 480, 960, 1372, 1798, 2267, 2695, 3047, 3423, 3917, 4472, 4967, 5366, 5712, 6026, 6316, 6621, 6965, 7285, 7501, 7673, 7917, 8208, 8359, 8318, 8265, 8306, 8316, 8220, 8194, 8336, 8434, 8309, 8099, 8016, 8024, 8001, 7955, 7920, 7810, 7542, 7219, 6986, 6821, 6615, 6394, 6213, 5976, 5603, 5260, 5105, 4995, 4720, 4338, 4005, 3702, 3382, 3110, 2872, 2534, 2094, 1732, 1514, 1280, 890, 374, -151, -618, -1017, -1376, -1733, -2121, -2570, -3073, -3556, -3921, -4163, -4361, -4580, -4851, -5206, -5601, -5876, -5974, -6054, -6284, -6593, -6832, -6985, -7091, -7162, -7265, -7472, -7691, -7784, -7804, -7905, -8078, -8249, -8418, -8555, -8522, -8301, -8085, -8017, -8019, -7976, -7906, -7884, -7911, -7920, -7847, -7720, -7670, -7784, -7988, -8126, -8153, -8167, -8270, -8455, -8646, -8768, -8795, -8751, -8694, -8659, -8645, -8642, -8675, -8810, -9065, -9362, -9543, -9545, -9494, -9561, -9757, -9944, -10021, -10017, -10005, -10071, -10266, -10518, -10645, -10539, -10332, -10256, -10381, -10567, -10661, -10636, -10519, -10313, -10060, -9855, -9740, -9671, -9634, -9641, -9660, -9626, -9575, -9593, -9639, -9574, -9362, -9128, -8996, -8949, -8896, -8812, -8697, -8544, -8367, -8237, -8154, -8016, -7806, -7644, -7596, -7570, -7477, -7355, -7258, -7144, -6942, -6679, -6445, -6312, -6265, -6225, -6099, -5849, -5546, -5328, -5253, -5210, -5027, -4657, -4229, -3900, -3694, -3482, -3140, -2730, -2466, -2447, -2509, -2444, -2221, -1931, -1634, -1386, -1267, -1260, -1230, -1070, -810, -576, -472, -441, -235, 285, 853, 1089, 1052, 1133, 1459, 1810, 2044, 2204, 2321, 2443, 2639, 2827, 2863, 2876, 3102, 3430, 3579, 3615, 3774, 3969, 3985, 3904, 3934, 4043, 4096, 4118, 4158, 4137, 4009, 3901, 3911, 3941, 3887, 3857, 4029, 4350, 4602, 4737, 4891, 5086, 5189, 5152, 5080, 5070, 5123, 5218, 5323, 5432, 5580, 5776, 5925, 5968, 6004, 6103, 6182, 6136, 6017, 5920, 5867, 5872, 5959, 6089, 6211, 6355, 6567, 6791, 6969, 7139, 7336, 7536, 7715, 7880, 7990, 7995, 7963, 8014, 8141, 8231, 8231, 8219, 8291, 8475, 8715, 8926, 9031, 9012, 8933, 8884, 8856, 8756, 8553, 8340, 8229, 8248, 8363, 8482, 8494, 8341, 8101, 7882, 7721, 7607, 7508, 7361, 7124, 6884, 6755, 6716, 6657, 6549, 6431, 6289, 6107, 5960, 5945, 6052, 6185, 6258, 6273, 6335, 6549, 6884, 7175, 7333, 7466, 7747, 8231, 8832, 9434, 9981, 10474, 10944, 11424, 11939, 12511, 13192, 13971, 14762, 15452, 16053, 16704, 17514, 18401, 19174, 19743, 20182, 20605, 21025, 21379, 21625, 21817, 22027, 22242, 22354, 22284, 22085, 21874, 21697, 21480, 21109, 20539, 19844, 19148, 18472, 17725, 16812, 15775, 14749, 13814, 12978, 12161, 11251, 10197, 9065, 8004, 7101, 6309, 5487, 4487, 3298, 2123, 1173, 417, -372, -1285, -2193, -2981, -3706, -4453, -5193, -5830, -6332, -6778, -7278, -7852, -8379, -8736, -8948, -9167, -9512, -9944, -10313, -10485, -10456, -10361, -10371, -10539, -10751, -10877, -10937, -11053, -11236, -11334, -11261, -11122, -11046, -11035, -11035, -11050, -11113, -11207, -11309, -11417, -11542, -11713, -11952, -12218, -12411, -12511, -12598, -12769, -13006, -13195, -13281, -13332, -13474, -13740, -14007, -14142, -14164, -14207, -14335, -14426, -14363, -14206, -14149, -14234, -14298, -14225, -14079, -13971, -13882, -13744, -13558, -13386, -13240, -13070, -12856, -12640, -12476, -12360, -12227, -12025, -11765, -11506, -11295, -11145, -11052, -10995, -10930, -10825, -10683, -10556, -10485, -10463, -10451, -10423, -10401, -10410, -10450, -10527, -10681, -10941, -11217, -11419, -11558, -11708, -11856, -11952, -12048, -12229, -12447, -12558, -12551, -12589, -12799, -13086, -13262, -13269, -13231, -13260, -13328, -13341, -13282, -13215, -13197, -13184, -13066, -12831, -12574, -12348, -12107, -11841, -11629, -11468, -11220, -10870, -10564, -10340, -10042, -9571, -9038, -8581, -8205, -7850, -7462, -7030, -6597, -6217, -5860, -5434, -4949, -4487, -4069, -3620, -3106, -2582, -2106, -1674, -1261, -845, -399, 92, 593, 1024, 1367, 1683, 2017, 2329, 2566, 2742, 2882, 3001, 3144, 3347, 3560, 3696, 3740, 3729, 3691, 3675, 3701, 3676, 3498, 3251, 3101, 3008, 2798, 2474, 2229, 2123, 1989, 1710, 1377, 1122, 918, 658, 347, 92, -59, -162, -261, -380, -544, -748, -922, -1011, -1027, -1028, -1076, -1185, -1234, -1099, -889, -820, -834, -669, -327, -90, -40, 48, 263, 400, 377, 428, 684, 881, 801, 710, 940, 1304, 1396, 1307, 1447, 1807, 1991, 1908, 1888, 2097, 2280, 2200, 1997, 1944, 2025, 1982, 1745, 1598, 1762, 2010, 1968, 1683, 1579, 1830, 2075, 1942, 1582, 1438, 1603, 1773, 1792, 1866, 2120, 2334, 2300, 2181, 2281, 2620, 2951, 3109, 3140, 3168, 3260, 3469, 3825, 4228, 4457, 4420, 4345, 4532, 4962, 5284, 5286, 5188, 5335, 5711, 5980, 6012, 6058, 6309, 6585, 6678, 6742, 7018, 7384, 7521, 7443, 7483, 7753, 7959, 7830, 7491, 7213, 7063, 6942, 6825, 6730, 6604, 6425, 6293, 6258, 6187, 5908, 5433, 4891, 4294, 3538, 2595, 1624, 812, 185, -362, -864, -1221, -1321, -1185, -917, -593, -203, 275, 795, 1303, 1811, 2360, 2939, 3534, 4241, 5190, 6386, 7684, 8999, 10388, 11917, 13519, 15060, 16545, 18072, 19655, 21190, 22552, 23690, 24647, 25537, 26453, 27349, 28086, 28627, 29020, 29337, 29574, 29776, 29977, 30130, 30156, 30055, 29932, 29874, 29868, 29822, 29645, 29303, 28827, 28318, 27861, 27432, 26862, 26006, 24868, 23591, 22296, 21012, 19774, 18653, 17607, 16470, 15187, 13919, 12865, 12027, 11219, 10209, 8899, 7495, 6334, 5464, 4561, 3428, 2324, 1577, 1165, 801, 331, -179, -625, -934, -1078, -1137, -1319, -1741, -2220, -2523, -2711, -2995, -3364, -3689, -3989, -4289, -4448, -4462, -4581, -4897, -5155, -5231, -5388, -5807, -6325, -6759, -7216, -7823, -8470, -8978, -9350, -9739, -10212, -10734, -11280, -11846, -12336, -12671, -12971, -13441, -14060, -14513, -14592, -14457, -14446, -14668, -14905, -14947, -14863, -14826, -14762, -14478, -14049, -13780, -13714, -13560, -13138, -12605, -12120, -11624, -11033, -10394, -9803, -9243, -8627, -7930, -7255, -6751, -6443, -6153, -5697, -5158, -4864, -4949, -5092, -4932, -4602, -4495, -4629, -4712, -4737, -4942, -5324, -5643, -5908, -6367, -7071, -7789, -8409, -9084, -9916, -10770, -11494, -12153, -12919, -13774, -14553, -15191, -15798, -16473, -17202, -17923, -18638, -19357, -20059, -20661, -21133, -21511, -21853, -22163, -22365, -22396, -22290, -22151, -22010, -21794, -21459, -21094, -20811, -20535, -20035, -19209, -18268, -17497, -16938, -16418, -15796, -15016, -14108, -13243, -12614, -12159, -11607, -10904, -10225, -9598, -8857, -8035, -7370, -6841, -6126, -5141, -4281, -3876, -3681, -3285, -2739, -2428, -2405, -2339, -2071, -1768, -1561, -1385, -1194, -1048, -947, -795, -580, -434, -442, -533, -615, -710, -850, -987, -1097, -1224, -1361, -1424, -1399, -1335, -1247, -1142, -1098, -1128, -1104, -943, -778, -769, -879, -947, -927, -882, -808, -641, -440, -367, -403, -297, 88, 548, 782, 739, 634, 677, 872, 1040, 1073, 1107, 1287, 1452, 1323, 960, 706, 730, 872, 925, 788, 464, 97, -67, 19, 121, 18, -230, -435, -553, -660, -767, -821, -858, -1002, -1272, -1528, -1657, -1685, -1693, -1715, -1753, -1806, -1825, -1739, -1539, -1308, -1142, -1059, -990, -854, -637, -417, -312, -326, -284, -25, 374, 697, 898, 1142, 1529, 1962, 2344, 2718, 3121, 3460, 3657, 3821, 4065, 4281, 4278, 4105, 3965, 3919, 3899, 3878, 3825, 3653, 3445, 3449, 3676, 3799, 3602, 3262, 3029, 2894, 2676, 2268, 1706, 1104, 566, 125, -258, -599, -845, -950, -976, -1071, -1295, -1522, -1579, -1511, -1572, -1891, -2227, -2236, -1922, -1656, -1709, -1903, -1860, -1480, -1043, -845, -872, -872, -636, -192, 221, 417, 520, 818, 1340, 1770, 1900, 1897, 1994, 2156, 2217, 2179, 2168, 2218, 2262, 2295, 2398, 2591, 2785, 2917, 3028, 3151, 3185, 2989, 2562, 1972, 1158, 39, -1231, -2367, -3288, -4067, -4642, -4901, -4931, -4757, -4075, -2668, -887, 677, 1870, 2949, 4115, 5344, 6627, 7978, 9313, 10558, 11951, 13874, 16281, 18713, 20922, 23079, 25272, 27242, 28778, 29942, 30805, 31369, 31684, 31913, 32138, 32327, 32467, 32558, 32585, 32557, 32507, 32451, 32378, 32250, 32068, 31851, 31595, 31217, 30667, 30010, 29398, 28799, 27955, 26653, 25010, 23298, 21633, 19884, 17917, 15780, 13625, 11584, 9703, 7992, 6398, 4922, 3680, 2785, 2140, 1530, 942, 505, 165, -270, -829, -1376, -1865, -2297, -2561, -2560, -2402, -2243, -2060, -1725, -1234, -701, -205, 258, 645, 840, 753, 409, -101, -659, -1141, -1540, -2007, -2656, -3336, -3753, -3842, -3873, -4110, -4507, -4873, -5174, -5555, -6079, -6643, -7155, -7619, -8046, -8382, -8567, -8583, -8458, -8243, -7971, -7637, -7255, -6889, -6585, -6266, -5804, -5195, -4609, -4188, -3858, -3440, -2883, -2276, -1700, -1204, -822, -527, -256, -48, 42, 115, 257, 291, 34, -322, -442, -359, -392, -683, -1113, -1578, -2068, -2574, -3121, -3822, -4738, -5726, -6593, -7353, -8156, -8973, -9633, -10130, -10608, -11048, -11395, -11811, -12462, -13163, -13637, -13979, -14459, -15097, -15726, -16263, -16702, -16997, -17160, -17279, -17389, -17467, -17542, -17692, -17887, -17994, -18023, -18166, -18497, -18815, -18946, -19031, -19229, -19412, -19436, -19397, -19408, -19361, -19178, -18927, -18689, -18486, -18399, -18427, -18363, -18024, -17542, -17143, -16809, -16359, -15766, -15182, -14650, -14089, -13533, -13116, -12730, -12180, -11675, -11527, -11465, -10982, -10224, -9663, -9191, -8440, -7576, -6919, -6297, -5504, -4776, -4267, -3727, -3152, -2997, -3299, -3322, -2647, -1949, -1974, -2230, -1740, -687, -28, 154, 502, 945, 985, 866, 1032, 1085, 601, 106, 141, 287, 58, -220, -116, 144, 175, 41, -17, -24, -134, -337, -612, -1093, -1760, -2253, -2455, -2820, -3623, -4421, -4807, -5003, -5255, -5409, -5492, -5818, -6277, -6388, -6150, -6031, -6170, -6328, -6375, -6322, -6099, -5756, -5541, -5518, -5441, -5146, -4765, -4440, -4100, -3681, -3286, -2932, -2365, -1432, -444, 242, 752, 1360, 1960, 2326, 2599, 3008, 3388, 3446, 3276, 3231, 3421, 3645, 3712, 3642, 3559, 3564, 3696, 3872, 3900, 3695, 3424, 3212, 2895, 2345, 1774, 1383, 1040, 605, 221, 0, -183, -348, -287, -8, 118, -66, -186, 73, 384, 270, -60, -74, 156, 152, -37, 2, 203, 184, 48, 163, 468, 638, 604, 476, 332, 302, 460, 564, 329, -130, -503, -759, -1094, -1507, -1833, -2122, -2560, -3015, -3102, -2831, -2683, -2821, -2798, -2384, -1988, -1930, -1937, -1762, -1660, -1931, -2430, -2786, -2806, -2618, -2530, -2672, -2747, -2373, -1650, -1054, -780, -558, -176, 201, 395, 548, 826, 1032, 940, 804, 1047, 1581, 1962, 2089, 2259, 2622, 3028, 3344, 3544, 3618, 3574, 3496, 3450, 3482, 3641, 3906, 4091, 4031, 3861, 3910, 4187, 4304, 4111, 4018, 4325, 4714, 4890, 5162, 5778, 6307, 6340, 6163, 6188, 6187, 5616, 4298, 2499, 615, -1082, -2638, -4290, -6031, -7337, -7606, -6795, -5396, -3769, -1839, 462, 2902, 5294, 7658, 9786, 11268, 12159, 13069, 14358, 15895, 17607, 19684, 22102, 24518, 26696, 28583, 30102, 31169, 31838, 32255, 32481, 32560, 32576, 32578, 32549, 32420, 32191, 31915, 31644, 31390, 31121, 30757, 30225, 29520, 28712, 27842, 26821, 25572, 24091, 22428, 20635, 18862, 17334, 16105, 14878, 13370, 11759, 10491, 9562, 8532, 7299, 6284, 5719, 5260, 4646, 4172, 4241, 4735, 5185, 5312, 5241, 5211, 5215, 5001, 4365, 3378, 2310, 1346, 460, -361, -951, -1179, -1248, -1422, -1569, -1439, -1271, -1600, -2470, -3407, -4198, -5169, -6508, -7827, -8692, -9206, -9711, -10103, -9947, -9180, -8295, -7669, -7150, -6463, -5720, -5219, -4925, -4532, -3964, -3458, -3087, -2515, -1439, -36, 1236, 2211, 3172, 4382, 5575, 6181, 6087, 5773, 5538, 5037, 3942, 2610, 1578, 759, -323, -1673, -2784, -3440, -3996, -4762, -5581, -6293, -7106, -8186, -9279, -10105, -10740, -11324, -11792, -12076, -12192, -12053, -11588, -10985, -10476, -10006, -9391, -8674, -8031, -7485, -6929, -6316, -5669, -4983, -4257, -3578, -3079, -2800, -2701, -2794, -3150, -3762, -4579, -5591, -6772, -7988, -9092, -10120, -11172, -12276, -13415, -14587, -15773, -16919, -18033, -19173, -20350, -21549, -22712, -23707, -24377, -24726, -24927, -25067, -25013, -24635, -24003, -23273, -22430, -21366, -20180, -19112, -18194, -17220, -16121, -15058, -14119, -13168, -12074, -10844, -9563, -8288, -7069, -5895, -4741, -3727, -3094, -2974, -3202, -3536, -3913, -4420, -5026, -5602, -6170, -6818, -7420, -7697, -7586, -7306, -7049, -6859, -6780, -6829, -6823, -6559, -6199, -6189, -6615, -6969, -6768, -6149, -5508, -4867, -3997, -2954, -2036, -1332, -672, 65, 786, 1283, 1410, 1211, 884, 575, 262, -68, -289, -319, -378, -785, -1526, -2221, -2650, -3049, -3716, -4587, -5422, -6170, -6884, -7482, -7860, -8086, -8327, -8654, -8973, -9101, -8948, -8636, -8329, -7973, -7448, -6899, -6565, -6300, -5669, -4594, -3534, -2870, -2427, -1825, -1084, -504, -95, 426, 1113, 1665, 1862, 1817, 1820, 2101, 2651, 3149, 3298, 3251, 3367, 3594, 3569, 3267, 3014, 2847, 2413, 1642, 1037, 1038, 1402, 1560, 1419, 1435, 1899, 2512, 2831, 2847, 2929, 3308, 3748, 3863, 3687, 3710, 4200, 4792, 5016, 5000, 5225, 5734, 6074, 6014, 5877, 5980, 6103, 5815, 5128, 4471, 4036, 3519, 2667, 1766, 1193, 779, 47, -970, -1704, -1905, -2032, -2566, -3349, -3850, -3913, -3916, -4194, -4541, -4480, -3990, -3572, -3527, -3522, -3174, -2663, -2377, -2270, -2017, -1585, -1213, -936, -531, 75, 633, 911, 991, 1080, 1213, 1273, 1193, 966, 556, -43, -695, -1207, -1530, -1785, -2089, -2401, -2581, -2571, -2466, -2360, -2196, -1896, -1548, -1359, -1402, -1554, -1636, -1565, -1388, -1210, -1023, -709, -310, -75, -24, 219, 832, 1416, 1547, 1348, 1188, 1217, 1393, 1606, 1700, 1687, 1847, 2309, 2726, 2815, 2836, 3125, 3406, 3177, 2655, 2628, 3256, 3751, 3617, 3427, 3836, 4531, 4825, 4690, 4552, 4541, 4429, 4031, 3392, 2801, 2579, 2703, 2863, 3013, 3431, 4080, 4426, 4183, 3754, 3520, 3072, 1697, -524, -2765, -4610, -6443, -8505, -10241, -10920, -10330, -8697, -6290, -3308, 197, 4282, 8746, 12977, 16407, 18979, 21007, 22748, 24279, 25582, 26633, 27504, 28325, 29230, 30221, 31152, 31892, 32394, 32676, 32767, 32702, 32571, 32421, 32162, 31655, 30860, 29879, 28831, 27807, 26845, 25918, 24847, 23443, 21781, 20168, 18749, 17467, 16336, 15378, 14396, 13297, 12524, 12461, 12758, 12847, 12844, 13123, 13537, 13720, 13658, 13505, 13193, 12699, 12232, 11881, 11389, 10543, 9514, 8635, 8023, 7493, 6779, 5678, 4091, 2090, -41, -2018, -3843, -5796, -7989, -10101, -11700, -12690, -13276, -13546, -13416, -12934, -12407, -12046, -11714, -11182, -10471, -9761, -9040, -8135, -7024, -5836, -4564, -3032, -1180, 798, 2657, 4235, 5424, 6167, 6554, 6748, 6753, 6389, 5587, 4571, 3591, 2672, 1740, 879, 184, -485, -1399, -2625, -3947, -5139, -6211, -7372, -8754, -10231, -11564, -12610, -13310, -13588, -13475, -13186, -12867, -12314, -11267, -9860, -8489, -7324, -6197, -5014, -3948, -3170, -2557, -1875, -1129, -543, -213, 27, 333, 581, 486, -23, -705, -1336, -2086, -3294, -4892, -6397, -7605, -8826, -10221, -11437, -12216, -12861, -13745, -14749, -15496, -15875, -16140, -16597, -17185, -17458, -17122, -16494, -16077, -15771, -15101, -14111, -13373, -13067, -12666, -11807, -10944, -10721, -11037, -11241, -11133, -11190, -11759, -12508, -12955, -13133, -13431, -13959, -14437, -14683, -14977, -15698, -16680, -17330, -17450, -17555, -18035, -18528, -18460, -17843, -17048, -16135, -14898, -13341, -11725, -10203, -8690, -7067, -5435, -4067, -3055, -2113, -961, 219, 1042, 1547, 2153, 2982, 3671, 3937, 4009, 4227, 4471, 4317, 3582, 2475, 1263, 93, -970, -2004, -3208, -4569, -5669, -6178, -6373, -6808, -7520, -7982, -7887, -7558, -7430, -7489, -7501, -7459, -7428, -7241, -6707, -6008, -5502, -5231, -4894, -4311, -3626, -3075, -2740, -2649, -2876, -3396, -3996, -4438, -4671, -4859, -5291, -6130, -7097, -7649, -7625, -7498, -7753, -8298, -8722, -8834, -8698, -8383, -7963, -7647, -7548, -7366, -6656, -5448, -4301, -3589, -3006, -2060, -784, 349, 1142, 1873, 2773, 3651, 4245, 4647, 5125, 5698, 6114, 6179, 5997, 5865, 5891, 5780, 5165, 4138, 3179, 2503, 1870, 1120, 490, 170, -101, -629, -1141, -1069, -411, 128, 40, -343, -355, 146, 728, 1037, 1206, 1595, 2290, 3066, 3774, 4553, 5474, 6225, 6469, 6383, 6450, 6733, 6756, 6244, 5550, 5120, 4817, 4203, 3307, 2619, 2300, 1903, 1069, 79, -561, -862, -1259, -1927, -2548, -2857, -3019, -3311, -3669, -3796, -3604, -3346, -3265, -3238, -2892, -2181, -1559, -1365, -1266, -757, 24, 468, 465, 617, 1301, 2050, 2293, 2231, 2424, 2772, 2678, 2034, 1347, 899, 458, -163, -807, -1279, -1595, -1873, -2181, -2506, -2794, -3024, -3252, -3523, -3785, -3971, -4091, -4169, -4116, -3788, -3180, -2470, -1792, -1087, -273, 536, 1169, 1631, 2083, 2570, 2918, 2931, 2656, 2408, 2477, 2807, 3057, 3019, 2790, 2513, 2248, 2080, 2070, 2015, 1617, 931, 394, 359, 747, 1157, 1256, 1164, 1365, 2089, 2899, 3226, 3135, 3165, 3449, 3554, 3290, 3142, 3527, 4050, 4058, 3650, 3498, 3787, 4036, 3934, 3715, 3645, 3608, 3408, 3109, 2922, 2880, 2798, 2594, 2528, 2877, 3384, 3318, 2243, 547, -1086, -2527, -4180, -6118, -7713, -8419, -8337, -7685, -6118, -3118, 1271, 6475, 11902, 17067, 21489, 24872, 27234, 28758, 29619, 29984, 30077, 30096, 30113, 30140, 30204, 30336, 30537, 30789, 31094, 31308, 31268, 31004, 30624, 29966, 28761, 27179, 25689, 24404, 23039, 21569, 20375, 19621, 19040, 18422, 17981, 17949, 18178, 18389, 18591, 18883, 19125, 19189, 19272, 19533, 19817, 20032, 20308, 20493, 20080, 18880, 17271, 15564, 13683, 11530, 9232, 6888, 4487, 2163, 179, -1407, -2834, -4203, -5283, -5929, -6439, -7200, -8233, -9323, -10329, -11072, -11291, -10963, -10397, -9778, -8899, -7497, -5641, -3617, -1631, 213, 1776, 2906, 3618, 4047, 4235, 4110, 3671, 3052, 2368, 1639, 849, -9, -948, -1955, -2979, -3953, -4837, -5683, -6639, -7763, -8810, -9419, -9540, -9476, -9421, -9217, -8677, -7900, -7085, -6241, -5314, -4467, -3941, -3642, -3186, -2447, -1807, -1674, -1960, -2246, -2355, -2461, -2703, -3049, -3561, -4398, -5456, -6379, -7056, -7800, -8849, -9963, -10737, -11101, -11293, -11449, -11464, -11228, -10851, -10496, -10118, -9528, -8717, -7959, -7516, -7282, -6884, -6167, -5414, -4917, -4545, -3994, -3336, -2911, -2811, -2871, -3111, -3781, -4933, -6264, -7476, -8660, -10150, -12034, -13864, -15148, -15990, -16935, -18074, -18883, -19121, -19237, -19618, -19942, -19745, -19175, -18757, -18585, -18235, -17447, -16489, -15724, -15088, -14278, -13249, -12257, -11457, -10718, -9897, -9176, -8915, -9130, -9341, -9182, -8953, -9147, -9644, -9931, -9915, -9912, -10011, -10050, -10040, -10095, -10121, -9938, -9590, -9198, -8787, -8288, -7564, -6476, -5111, -3808, -2738, -1680, -439, 807, 1761, 2386, 2820, 3071, 3025, 2674, 2133, 1482, 798, 251, -113, -575, -1395, -2304, -2794, -2925, -3352, -4400, -5575, -6244, -6459, -6755, -7332, -7881, -8123, -8104, -7889, -7407, -6726, -6191, -6012, -5937, -5593, -4988, -4427, -4048, -3770, -3590, -3579, -3651, -3619, -3443, -3246, -3187, -3391, -3805, -4102, -4020, -3789, -3894, -4442, -5030, -5273, -5155, -4866, -4557, -4345, -4320, -4356, -4093, -3368, -2521, -2033, -1909, -1713, -1144, -393, 156, 390, 563, 979, 1639, 2251, 2555, 2602, 2606, 2627, 2525, 2262, 2033, 1932, 1704, 1096, 323, -130, -136, 0, 29, 29, 134, 279, 388, 659, 1340, 2253, 2793, 2629, 2207, 2245, 2822, 3298, 3208, 2832, 2716, 2926, 3129, 3218, 3417, 3746, 3832, 3459, 2938, 2662, 2510, 2074, 1334, 702, 381, 75, -466, -947, -907, -448, -177, -369, -602, -407, 50, 270, 183, 168, 389, 545, 380, 123, 162, 464, 626, 473, 304, 397, 518, 255, -317, -711, -792, -1015, -1698, -2432, -2605, -2296, -2115, -2225, -2141, -1643, -1242, -1376, -1713, -1675, -1277, -998, -1069, -1220, -1089, -621, -87, 226, 278, 225, 176, 96, -87, -400, -855, -1490, -2240, -2868, -3175, -3266, -3411, -3650, -3776, -3673, -3429, -3117, -2705, -2199, -1677, -1216, -898, -739, -539, -27, 736, 1340, 1498, 1389, 1441, 1900, 2614, 3180, 3339, 3265, 3408, 4038, 4962, 5705, 5928, 5715, 5510, 5710, 6229, 6508, 6074, 5081, 4167, 3753, 3631, 3325, 2717, 2136, 1870, 1825, 1721, 1508, 1404, 1599, 2009, 2331, 2315, 2051, 1965, 2355, 2923, 3064, 2666, 2267, 2250, 2277, 1731, 425, -1373, -3418, -5571, -7491, -8562, -8341, -6972, -4941, -2384, 1149, 6109, 12197, 18349, 23412, 26851, 28827, 29822, 30305, 30582, 30725, 30599, 30113, 29453, 29011, 28992, 29304, 29692, 29938, 29972, 29871, 29664, 29243, 28610, 27936, 27196, 26076, 24624, 23426, 22864, 22694, 22570, 22584, 22780, 22858, 22645, 22517, 22892, 23584, 24094, 24295, 24397, 24430, 24253, 23963, 23716, 23200, 21983, 20229, 18390, 16418, 13860, 10707, 7485, 4594, 1947, -707, -3263, -5138, -5809, -5569, -5306, -5400, -5278, -4342, -2919, -1862, -1543, -1714, -2125, -2715, -3198, -3087, -2355, -1594, -1215, -898, -144, 972, 1956, 2482, 2519, 2075, 1136, -171, -1603, -3019, -4500, -6118, -7670, -8794, -9367, -9595, -9662, -9522, -9160, -8785, -8521, -8120, -7280, -6151, -5194, -4544, -3845, -2832, -1739, -914, -310, 319, 881, 1008, 590, -79, -802, -1760, -3097, -4496, -5491, -6137, -7001, -8358, -9722, -10402, -10382, -10333, -10769, -11457, -11872, -11937, -11950, -11924, -11553, -10805, -10008, -9182, -7908, -6060, -4175, -2793, -1757, -650, 419, 924, 713, 177, -409, -1202, -2314, -3510, -4548, -5487, -6459, -7414, -8215, -8855, -9501, -10347, -11418, -12565, -13677, -14774, -15823, -16643, -17185, -17651, -18147, -18350, -17854, -16751, -15583, -14670, -13823, -12847, -11940, -11382, -11095, -10898, -10935, -11423, -12209, -12854, -13219, -13602, -14294, -15162, -15825, -16183, -16538, -17090, -17600, -17769, -17749, -17885, -18069, -17842, -17095, -16230, -15485, -14525, -13058, -11436, -10164, -9120, -7857, -6434, -5275, -4356, -3260, -2033, -1234, -986, -649, 252, 1257, 1603, 1312, 1096, 1266, 1311, 682, -440, -1508, -2360, -3267, -4346, -5339, -6005, -6379, -6586, -6623, -6417, -5946, -5315, -4726, -4292, -3903, -3465, -3151, -3124, -3171, -3000, -2734, -2682, -2786, -2716, -2466, -2440, -2865, -3493, -3991, -4394, -4954, -5747, -6638, -7481, -8154, -8505, -8516, -8407, -8421, -8522, -8429, -7940, -7096, -6106, -5265, -4845, -4746, -4399, -3444, -2365, -1898, -1984, -1926, -1455, -930, -605, -368, -171, -142, -231, -210, -94, -193, -612, -990, -983, -859, -1234, -2128, -2749, -2493, -1819, -1646, -2085, -2338, -1832, -875, -81, 397, 808, 1316, 1878, 2479, 3183, 3898, 4320, 4347, 4383, 4853, 5513, 5720, 5416, 5229, 5455, 5562, 5044, 4221, 3747, 3701, 3571, 3012, 2196, 1479, 1005, 723, 570, 462, 255, -74, -266, -80, 302, 472, 395, 457, 859, 1338, 1656, 1988, 2546, 3124, 3364, 3296, 3269, 3386, 3325, 2814, 2027, 1339, 867, 486, 139, -114, -335, -676, -1062, -1194, -999, -904, -1337, -2098, -2586, -2655, -2801, -3331, -3821, -3743, -3225, -2757, -2405, -1819, -905, -21, 535, 873, 1191, 1408, 1342, 1065, 809, 588, 179, -476, -1086, -1369, -1413, -1526, -1856, -2289, -2636, -2789, -2830, -3012, -3455, -3929, -4145, -4185, -4318, -4524, -4541, -4294, -3956, -3620, -3215, -2685, -2062, -1381, -674, -42, 391, 640, 835, 1043, 1180, 1160, 1049, 949, 795, 488, 187, 168, 324, 211, -289, -747, -796, -594, -450, -372, -276, -294, -463, -403, 172, 817, 936, 848, 1360, 2372, 3013, 3122, 3450, 4285, 4993, 5076, 4775, 4543, 4529, 4515, 4049, 2884, 1467, 598, 498, 591, 229, -618, -1389, -1493, -964, -512, -671, -1091, -1090, -684, -459, -639, -884, -1017, -1351, -2239, -3586, -4840, -5470, -5557, -5744, -6274, -6375, -4950, -1699, 2719, 7417, 11822, 15902, 19950, 23947, 27192, 29000, 29514, 29379, 28941, 28231, 27306, 26234, 25028, 23931, 23409, 23619, 24288, 25161, 26201, 27235, 27934, 28145, 28065, 27912, 27676, 27274, 26713, 26012, 25107, 24081, 23394, 23511, 24241, 24765, 24713, 24690, 25304, 26192, 26589, 26454, 26187, 25744, 24830, 23615, 22387, 20814, 18392, 15516, 13147, 11408, 9440, 6915, 4629, 3115, 1880, 557, -228, 8, 644, 1025, 1635, 3156, 5037, 6149, 6475, 6892, 7442, 7216, 6092, 4996, 4215, 2932, 958, -548, -786, -532, -818, -1347, -1256, -768, -924, -1927, -2924, -3498, -4285, -5794, -7526, -8717, -9296, -9602, -9652, -9279, -8605, -7810, -6706, -5108, -3366, -1944, -815, 198, 969, 1429, 1824, 2170, 2018, 1173, 77, -862, -1808, -3034, -4385, -5512, -6385, -7230, -8077, -8691, -8959, -9047, -9067, -8863, -8331, -7729, -7302, -6855, -6101, -5271, -4798, -4601, -4270, -3830, -3651, -3679, -3480, -2960, -2470, -2192, -1925, -1556, -1294, -1325, -1568, -1961, -2721, -4035, -5673, -7202, -8498, -9743, -10968, -11898, -12292, -12233, -11979, -11626, -11059, -10205, -9254, -8520, -8157, -8064, -8056, -8099, -8289, -8657, -9100, -9543, -9989, -10418, -10770, -11095, -11477, -11848, -12122, -12464, -13106, -13963, -14764, -15475, -16277, -17217, -18122, -18857, -19387, -19678, -19709, -19525, -19178, -18637, -17847, -16830, -15677, -14454, -13186, -11934, -10808, -9816, -8847, -7868, -7038, -6530, -6252, -6025, -5910, -6184, -6869, -7551, -7836, -7845, -7977, -8278, -8310, -7752, -6857, -6129, -5638, -4997, -3979, -2923, -2304, -2147, -2091, -1944, -1852, -1972, -2220, -2411, -2457, -2405, -2318, -2149, -1851, -1572, -1557, -1780, -1972, -2112, -2530, -3310, -4064, -4514, -4893, -5494, -6125, -6383, -6256, -6167, -6400, -6775, -6931, -6775, -6506, -6295, -6140, -6001, -5878, -5695, -5290, -4662, -4079, -3808, -3779, -3711, -3523, -3414, -3512, -3632, -3565, -3438, -3566, -3968, -4290, -4268, -4062, -3979, -4044, -4050, -3933, -3819, -3733, -3522, -3171, -2961, -3076, -3223, -2969, -2314, -1660, -1249, -962, -592, -38, 650, 1230, 1428, 1316, 1271, 1419, 1462, 1211, 937, 980, 1238, 1346, 1238, 1253, 1635, 2168, 2479, 2561, 2742, 3141, 3479, 3512, 3379, 3317, 3242, 2906, 2337, 1874, 1719, 1675, 1418, 921, 528, 555, 918, 1261, 1379, 1376, 1429, 1595, 1836, 2070, 2190, 2154, 2054, 1998, 1966, 1905, 1864, 1883, 1859, 1655, 1337, 1138, 1139, 1135, 893, 465, 79, -191, -479, -859, -1180, -1263, -1188, -1232, -1459, -1514, -1085, -471, -264, -501, -618, -306, 60, 4, -476, -1044, -1471, -1792, -2167, -2670, -3160, -3359, -3190, -2951, -2938, -2927, -2450, -1644, -1274, -1662, -2228, -2430, -2566, -3155, -4053, -4691, -4837, -4694, -4412, -3841, -2781, -1345, 25, 968, 1542, 2014, 2464, 2761, 2753, 2313, 1421, 425, -157, -279, -404, -811, -1319, -1778, -2259, -2703, -2942, -3075, -3348, -3716, -3934, -3936, -3836, -3667, -3374, -2994, -2692, -2647, -2810, -2841, -2538, -2252, -2429, -2787, -2603, -1837, -1248, -1213, -1121, -347, 749, 1343, 1340, 1345, 1614, 1743, 1458, 1017, 664, 294, -171, -533, -573, -242, 338, 912, 1301, 1658, 2236, 2896, 3229, 3051, 2493, 1743, 982, 357, -236, -1008, -1778, -2068, -1800, -1443, -1322, -1206, -761, -65, 508, 733, 699, 612, 487, 170, -351, -991, -1892, -3268, -4789, -5786, -6229, -6675, -7119, -6759, -5157, -2676, 322, 3907, 8022, 12286, 16379, 20088, 23107, 25151, 26184, 26341, 25829, 24916, 23758, 22369, 20994, 20143, 20079, 20526, 21166, 22116, 23534, 25109, 26295, 26907, 27235, 27556, 27793, 27739, 27350, 26752, 26131, 25738, 25750, 26065, 26319, 26301, 26188, 26285, 26611, 26909, 26961, 26794, 26519, 26048, 25185, 23927, 22538, 21138, 19588, 17784, 15914, 14226, 12707, 11240, 9917, 8934, 8244, 7613, 7017, 6710, 6824, 7186, 7649, 8249, 8945, 9454, 9621, 9673, 9773, 9522, 8382, 6459, 4453, 2753, 1085, -772, -2435, -3398, -3757, -4003, -4312, -4404, -4132, -3813, -3855, -4302, -4884, -5339, -5605, -5798, -6053, -6299, -6218, -5621, -4747, -3975, -3332, -2548, -1575, -780, -481, -537, -587, -577, -793, -1411, -2272, -3118, -3903, -4768, -5787, -6772, -7433, -7749, -7995, -8294, -8404, -8098, -7491, -6801, -6058, -5221, -4342, -3450, -2536, -1697, -1100, -772, -610, -568, -690, -1001, -1472, -2032, -2581, -3042, -3384, -3563, -3523, -3330, -3177, -3152, -3158, -3119, -3151, -3417, -3917, -4509, -5059, -5479, -5689, -5652, -5416, -5090, -4726, -4263, -3657, -3050, -2709, -2760, -3093, -3578, -4246, -5178, -6268, -7264, -8092, -8933, -9916, -10889, -11606, -12054, -12409, -12803, -13258, -13716, -14011, -14024, -13916, -13972, -14230, -14451, -14475, -14346, -14161, -13982, -13894, -13900, -13844, -13579, -13162, -12768, -12426, -12038, -11606, -11304, -11203, -11129, -10943, -10773, -10841, -11130, -11404, -11506, -11513, -11584, -11732, -11819, -11713, -11417, -10993, -10455, -9801, -9077, -8300, -7375, -6229, -5024, -4045, -3400, -2960, -2601, -2420, -2611, -3182, -3884, -4474, -4956, -5486, -6053, -6426, -6439, -6207, -5950, -5762, -5600, -5443, -5343, -5352, -5477, -5646, -5748, -5686, -5445, -5098, -4755, -4468, -4194, -3852, -3485, -3240, -3188, -3253, -3374, -3617, -4037, -4505, -4814, -4936, -5056, -5335, -5729, -6053, -6178, -6129, -6032, -5979, -5906, -5648, -5182, -4695, -4315, -3932, -3490, -3174, -3073, -2933, -2523, -2066, -1946, -2140, -2258, -2083, -1829, -1799, -2002, -2193, -2225, -2180, -2168, -2151, -2059, -1951, -1919, -1906, -1802, -1624, -1500, -1513, -1630, -1707, -1557, -1159, -755, -546, -361, 69, 672, 1144, 1433, 1750, 2162, 2445, 2415, 2179, 1994, 1945, 1849, 1520, 1012, 574, 360, 262, 95, -120, -178, -6, 192, 232, 234, 436, 840, 1225, 1448, 1553, 1671, 1896, 2231, 2551, 2665, 2514, 2239, 2019, 1862, 1623, 1205, 682, 181, -274, -738, -1201, -1575, -1829, -2065, -2371, -2648, -2677, -2420, -2119, -2022, -2086, -2078, -1903, -1684, -1531, -1446, -1426, -1550, -1815, -2055, -2140, -2178, -2356, -2659, -2910, -3024, -3059, -3088, -3162, -3308, -3448, -3434, -3230, -2982, -2843, -2835, -2886, -2877, -2685, -2282, -1803, -1431, -1220, -1058, -814, -454, -65, 258, 536, 826, 1059, 1119, 1048, 1000, 983, 870, 653, 456, 301, 103, -155, -392, -557, -642, -662, -680, -742, -766, -663, -528, -543, -712, -867, -883, -762, -548, -288, -53, 110, 243, 423, 642, 811, 905, 1005, 1147, 1206, 1039, 684, 359, 255, 347, 403, 230, -58, -163, 15, 302, 592, 980, 1495, 1977, 2272, 2372, 2388, 2512, 2849, 3170, 3160, 2947, 2967, 3285, 3550, 3613, 3620, 3600, 3467, 3268, 3048, 2742, 2437, 2319, 2251, 1946, 1564, 1479, 1652, 1833, 2051, 2321, 2375, 2187, 2178, 2529, 2929, 3178, 3334, 3276, 2760, 1944, 1235, 763, 395, 31, -338, -552, -195, 997, 2697, 4374, 5932, 7583, 9309, 10871, 12121, 12973, 13336, 13257, 12960, 12673, 12594, 12828, 13205, 13363, 13281, 13403, 14056, 15036, 16002, 16960, 18032, 19021, 19554, 19654, 19763, 20144, 20579, 20736, 20664, 20611, 20668, 20713, 20665, 20610, 20727, 21117, 21665, 22198, 22708, 23242, 23670, 23861, 23944, 24089, 24145, 23880, 23327, 22594, 21650, 20561, 19545, 18625, 17714, 16979, 16668, 16647, 16595, 16498, 16514, 16614, 16763, 17013, 17212, 17020, 16400, 15659, 14949, 14154, 13254, 12394, 11652, 11013, 10501, 10134, 9870, 9675, 9486, 9135, 8470, 7578, 6664, 5748, 4627, 3221, 1787, 642, -173, -833, -1397, -1759, -1887, -1922, -1977, -2003, -1949, -1923, -2051, -2265, -2401, -2470, -2654, -3052, -3565, -4022, -4346, -4632, -5060, -5738, -6543, -7231, -7683, -7968, -8191, -8401, -8590, -8712, -8713, -8615, -8547, -8644, -8919, -9278, -9623, -9894, -10044, -10063, -10025, -9994, -9873, -9489, -8832, -8082, -7399, -6832, -6413, -6149, -5976, -5840, -5816, -6016, -6417, -6868, -7234, -7481, -7682, -7921, -8163, -8209, -7893, -7260, -6518, -5863, -5359, -4966, -4633, -4382, -4305, -4450, -4765, -5195, -5716, -6246, -6655, -6913, -7091, -7214, -7263, -7288, -7358, -7430, -7450, -7524, -7803, -8265, -8704, -9030, -9354, -9811, -10368, -10911, -11387, -11791, -12094, -12277, -12368, -12384, -12279, -12025, -11689, -11339, -11009, -10726, -10550, -10496, -10506, -10537, -10635, -10857, -11144, -11392, -11577, -11746, -11902, -11968, -11902, -11747, -11538, -11254, -10892, -10527, -10208, -9882, -9523, -9246, -9167, -9219, -9209, -9097, -9020, -9074, -9137, -9024, -8709, -8274, -7783, -7293, -6929, -6744, -6656, -6601, -6629, -6755, -6937, -7159, -7378, -7437, -7319, -7243, -7251, -7081, -6649, -6237, -5973, -5705, -5486, -5570, -5885, -6111, -6176, -6144, -5909, -5488, -5213, -5237, -5289, -5145, -4821, -4300, -3672, -3379, -3701, -4261, -4583, -4683, -4736, -4707, -4646, -4704, -4760, -4567, -4233, -3950, -3596, -3111, -2810, -2828, -2757, -2297, -1693, -1316, -1255, -1439, -1690, -1723, -1488, -1323, -1483, -1785, -1976, -2068, -2135, -2108, -1908, -1569, -1170, -831, -665, -617, -493, -240, -34, 1, -36, -14, 70, 167, 289, 470, 658, 766, 803, 859, 985, 1134, 1232, 1248, 1190, 1112, 1070, 1032, 917, 713, 514, 389, 339, 344, 403, 479, 543, 641, 855, 1178, 1490, 1657, 1627, 1455, 1256, 1125, 1055, 939, 658, 202, -289, -639, -767, -754, -748, -813, -858, -748, -473, -206, -124, -212, -311, -369, -539, -926, -1378, -1692, -1873, -2008, -2039, -1873, -1581, -1276, -940, -567, -319, -362, -647, -967, -1200, -1418, -1743, -2160, -2490, -2634, -2719, -2869, -2964, -2829, -2568, -2396, -2314, -2150, -1835, -1412, -967, -650, -561, -556, -416, -231, -319, -741, -1210, -1496, -1660, -1793, -1792, -1544, -1168, -880, -704, -499, -224, 18, 147, 155, 23, -246, -550, -760, -899, -1077, -1287, -1391, -1331, -1191, -1009, -735, -418, -228, -199, -141, 42, 175, 58, -207, -398, -515, -727, -999, -1101, -997, -893, -873, -822, -690, -558, -469, -431, -478, -564, -534, -381, -311, -407, -476, -326, -52, 93, -16, -272, -460, -434, -246, -91, -111, -240, -234, 105, 713, 1281, 1527, 1455, 1259, 1082, 983, 993, 995, 733, 207, -174, -121, 149, 344, 527, 854, 1223, 1487, 1714, 1971, 2127, 2065, 1877, 1691, 1483, 1184, 842, 549, 287, 18, -174, -175, -41, 87, 249, 591, 1026, 1225, 1135, 1194, 1699, 2289, 2447, 2245, 2074, 1935, 1528, 787, -123, -1021, -1688, -1979, -2046, -2038, -1677, -636, 940, 2735, 4719, 6834, 8688, 9998, 10933, 11676, 12119, 12137, 11840, 11463, 11260, 11431, 11890, 12347, 12705, 13159, 13818, 14566, 15341, 16216, 17099, 17719, 17983, 18179, 18637, 19314, 19901, 20227, 20404, 20611, 20875, 21138, 21341, 21434, 21441, 21500, 21760, 22218, 22743, 23175, 23459, 23670, 23911, 24113, 24088, 23783, 23317, 22716, 21926, 21083, 20445, 20043, 19667, 19295, 19086, 19119, 19271, 19394, 19428, 19388, 19383, 19409, 19226, 18645, 17841, 17100, 16416, 15659, 14889, 14248, 13665, 12990, 12250, 11588, 11039, 10519, 9954, 9320, 8591, 7782, 6988, 6287, 5608, 4804, 3885, 3084, 2593, 2330, 2041, 1602, 1093, 639, 305, 133, 94, 21, -240, -600, -840, -937, -1099, -1494, -2086, -2730, -3310, -3863, -4540, -5385, -6227, -6923, -7540, -8129, -8542, -8683, -8666, -8572, -8397, -8269, -8343, -8442, -8248, -7832, -7589, -7659, -7849, -8017, -8197, -8342, -8318, -8238, -8433, -8940, -9313, -9191, -8785, -8504, -8416, -8331, -8175, -7979, -7738, -7496, -7368, -7378, -7426, -7483, -7550, -7499, -7144, -6539, -5984, -5670, -5459, -5140, -4767, -4595, -4720, -4978, -5260, -5675, -6301, -6944, -7398, -7740, -8110, -8417, -8583, -8782, -9120, -9375, -9403, -9412, -9562, -9689, -9689, -9693, -9734, -9642, -9457, -9484, -9806, -10092, -10095, -10033, -10211, -10555, -10802, -10986, -11299, -11647, -11794, -11789, -11859, -12019, -12114, -12146, -12227, -12354, -12454, -12515, -12590, -12651, -12616, -12418, -12119, -11894, -11789, -11596, -11127, -10507, -9989, -9610, -9251, -8915, -8680, -8506, -8340, -8249, -8301, -8455, -8635, -8757, -8710, -8524, -8401, -8367, -8175, -7734, -7273, -6943, -6638, -6339, -6186, -6160, -6091, -5947, -5808, -5671, -5555, -5554, -5555, -5282, -4757, -4370, -4328, -4384, -4241, -3933, -3713, -3748, -3960, -4133, -4179, -4249, -4445, -4599, -4530, -4329, -4107, -3806, -3466, -3250, -3056, -2596, -1984, -1610, -1467, -1236, -936, -791, -703, -462, -197, -101, -82, -35, -68, -192, -250, -265, -430, -737, -994, -1144, -1265, -1341, -1267, -1040, -791, -703, -845, -1039, -1042, -904, -918, -1158, -1400, -1535, -1626, -1607, -1350, -1003, -809, -706, -534, -417, -552, -822, -1011, -1177, -1530, -2080, -2647, -3077, -3304, -3318, -3204, -3136, -3190, -3190, -2908, -2404, -2007, -1889, -1867, -1683, -1349, -1085, -1014, -1051, -1070, -1067, -1128, -1267, -1423, -1593, -1833, -2098, -2293, -2517, -2935, -3390, -3546, -3396, -3230, -3101, -2811, -2365, -1967, -1665, -1384, -1219, -1301, -1532, -1739, -1939, -2217, -2477, -2547, -2450, -2375, -2407, -2401, -2207, -1983, -2074, -2538, -3022, -3269, -3457, -3802, -4169, -4356, -4431, -4469, -4304, -3861, -3426, -3260, -3216, -2990, -2571, -2218, -2110, -2162, -2181, -2120, -2078, -2083, -1986, -1691, -1352, -1190, -1186, -1143, -980, -826, -809, -895, -999, -1083, -1062, -797, -309, 139, 358, 494, 798, 1241, 1563, 1616, 1469, 1223, 947, 797, 893, 1052, 956, 664, 565, 747, 886, 849, 825, 820, 592, 174, -115, -212, -375, -677, -869, -776, -529, -317, -118, 181, 553, 824, 926, 979, 1101, 1221, 1154, 835, 405, 67, -100, -180, -287, -449, -606, -716, -806, -883, -884, -794, -741, -819, -908, -840, -645, -453, -254, 21, 300, 416, 340, 207, 141, 139, 122, 39, -86, -147, -30, 271, 611, 827, 909, 976, 1074, 1096, 938, 670, 442, 309, 226, 203, 325, 602, 917, 1193, 1483, 1871, 2319, 2720, 3035, 3266, 3355, 3247, 3037, 2868, 2725, 2445, 1987, 1528, 1215, 944, 603, 321, 243, 220, 143, 310, 916, 1576, 1950, 2360, 3140, 3986, 4575, 5047, 5393, 5229, 4575, 3951, 3512, 2937, 2186, 1599, 1396, 1690, 2634, 4084, 5664, 7307, 9149, 10920, 12193, 13025, 13684, 14024, 13783, 13157, 12540, 12114, 11975, 12243, 12796, 13368, 13956, 14789, 15851, 16884, 17736, 18471, 19126, 19599, 19824, 19909, 20116, 20592, 21163, 21498, 21565, 21595, 21663, 21570, 21251, 20920, 20736, 20647, 20633, 20850, 21372, 22008, 22568, 23056, 23527, 23847, 23843, 23580, 23207, 22698, 21973, 21193, 20586, 20164, 19815, 19559, 19462, 19474, 19489, 19464, 19369, 19156, 18806, 18251, 17424, 16381, 15340, 14449, 13662, 12881, 12120, 11440, 10854, 10353, 9960, 9679, 9419, 9062, 8620, 8181, 7760, 7275, 6680, 5988, 5232, 4457, 3695, 2923, 2043, 1030, -9, -956, -1764, -2423, -2933, -3329, -3648, -3859, -3938, -3966, -4077, -4279, -4445, -4544, -4703, -4992, -5289, -5489, -5693, -6015, -6365, -6613, -6796, -7017, -7262, -7467, -7671, -7928, -8148, -8218, -8227, -8376, -8661, -8897, -9030, -9183, -9384, -9548, -9701, -9960, -10251, -10345, -10222, -10130, -10166, -10074, -9652, -9107, -8750, -8530, -8241, -7939, -7802, -7793, -7787, -7842, -8012, -8176, -8198, -8129, -8031, -7852, -7566, -7269, -7032, -6817, -6636, -6636, -6858, -7091, -7189, -7313, -7603, -7854, -7847, -7760, -7855, -8033, -8064, -7996, -8011, -8158, -8376, -8617, -8826, -8961, -9065, -9193, -9307, -9367, -9435, -9595, -9838, -10108, -10375, -10624, -10825, -10969, -11084, -11191, -11222, -11089, -10803, -10515, -10364, -10300, -10157, -9888, -9645, -9582, -9678, -9808, -9918, -10014, -10073, -10053, -10009, -10049, -10180, -10265, -10182, -9982, -9781, -9633, -9518, -9393, -9197, -8924, -8650, -8437, -8253, -8108, -8069, -8081, -7990, -7849, -7858, -7992, -8031, -7923, -7756, -7525, -7255, -7104, -7076, -6931, -6655, -6562, -6763, -6966, -6990, -6992, -7064, -7036, -6821, -6598, -6512, -6429, -6171, -5834, -5667, -5746, -5915, -6062, -6239, -6499, -6757, -6911, -6953, -6886, -6658, -6295, -5985, -5861, -5819, -5689, -5469, -5256, -5100, -5054, -5161, -5285, -5174, -4817, -4493, -4391, -4369, -4206, -3920, -3688, -3572, -3514, -3491, -3496, -3450, -3351, -3339, -3399, -3245, -2800, -2409, -2282, -2170, -1847, -1486, -1280, -1173, -1116, -1178, -1320, -1414, -1460, -1492, -1421, -1192, -941, -796, -714, -611, -471, -312, -180, -187, -366, -575, -640, -536, -364, -240, -203, -148, 62, 358, 516, 520, 602, 813, 965, 1021, 1145, 1335, 1447, 1536, 1729, 1919, 1951, 1937, 2014, 2060, 1947, 1784, 1698, 1623, 1468, 1296, 1193, 1135, 1093, 1124, 1247, 1348, 1326, 1263, 1274, 1301, 1244, 1136, 1015, 816, 566, 420, 365, 192, -120, -344, -389, -439, -582, -647, -525, -384, -387, -428, -351, -273, -382, -579, -633, -590, -682, -914, -1055, -1013, -927, -860, -714, -505, -446, -616, -770, -698, -518, -443, -448, -401, -321, -290, -266, -191, -125, -163, -292, -447, -583, -664, -667, -640, -670, -726, -634, -322, 17, 164, 163, 215, 361, 449, 389, 256, 133, 26, -35, 15, 141, 200, 183, 245, 425, 571, 620, 672, 735, 711, 649, 720, 925, 1080, 1121, 1171, 1283, 1352, 1367, 1485, 1739, 1893, 1804, 1711, 1894, 2226, 2362, 2259, 2184, 2272, 2377, 2366, 2322, 2372, 2502, 2635, 2798, 3042, 3294, 3426, 3455, 3502, 3596, 3628, 3544, 3453, 3501, 3671, 3801, 3822, 3851, 3973, 4074, 4047, 4000, 4014, 3930, 3659, 3434, 3445, 3567, 3643, 3738, 3877, 3942, 3982, 4172, 4448, 4558, 4461, 4307, 4158, 4030, 4010, 4119, 4271, 4456, 4702, 4903, 4966, 5038, 5251, 5461, 5473, 5341, 5218, 5116, 5010, 4919, 4833, 4730, 4668, 4691, 4722, 4715, 4738, 4802, 4793, 4686, 4577, 4515, 4464, 4466, 4605, 4817, 4936, 4934, 4979, 5179, 5420, 5481, 5279, 4920, 4573, 4369, 4315, 4250, 3996, 3596, 3264, 3102, 3062, 3128, 3268, 3330, 3237, 3151, 3199, 3305, 3459, 3738, 3989, 3942, 3688, 3519, 3435, 3301, 3217, 3238, 3116, 2789, 2689, 3130, 3857, 4505, 5024, 5479, 5869, 6229, 6592, 6820, 6770, 6513, 6248, 6096, 6081, 6167, 6265, 6354, 6543, 6928, 7430, 7905, 8348, 8816, 9281, 9654, 9937, 10198, 10412, 10483, 10452, 10530, 10803, 11054, 11010, 10738, 10562, 10635, 10777, 10851, 10975, 11263, 11569, 11739, 11877, 12170, 12565, 12855, 12982, 13030, 13018, 12890, 12696, 12555, 12464, 12311, 12126, 12057, 12095, 12081, 11995, 11988, 12083, 12119, 12012, 11851, 11725, 11584, 11373, 11117, 10860, 10595, 10292, 9970, 9673, 9446, 9314, 9254, 9130, 8841, 8491, 8259, 8119, 7914, 7617, 7301, 6926, 6410, 5831, 5324, 4904, 4511, 4114, 3664, 3122, 2579, 2186, 1929, 1654, 1297, 940, 640, 377, 104, -188, -469, -723, -1006, -1393, -1840, -2235, -2572, -2946, -3329, -3624, -3896, -4268, -4652, -4877, -5013, -5261, -5617, -5954, -6297, -6746, -7253, -7673, -7978, -8254, -8526, -8771, -9023, -9347, -9695, -9934, -10049, -10164, -10345, -10530, -10664, -10752, -10780, -10760, -10796, -10971, -11200, -11359, -11467, -11611, -11802, -11984, -12126, -12211, -12205, -12088, -11913, -11769, -11708, -11700, -11681, -11626, -11560, -11524, -11531, -11570, -11613, -11647, -11660, -11624, -11546, -11454, -11404, -11374, -11298, -11149, -11011, -10979, -11010, -10964, -10791, -10600, -10501, -10483, -10482, -10475, -10451, -10400, -10327, -10259, -10200, -10109, -9971, -9832, -9711, -9533, -9253, -8951, -8705, -8481, -8216, -7959, -7767, -7606, -7446, -7326, -7241, -7127, -6987, -6880, -6784, -6637, -6452, -6271, -6060, -5787, -5510, -5278, -5031, -4725, -4419, -4195, -4027, -3841, -3632, -3481, -3432, -3435, -3420, -3376, -3323, -3234, -3056, -2799, -2555, -2373, -2224, -2079, -1938, -1783, -1608, -1489, -1491, -1543, -1538, -1494, -1469, -1440, -1396, -1398, -1452, -1459, -1397, -1366, -1403, -1427, -1399, -1396, -1455, -1508, -1511, -1540, -1660, -1812, -1923, -2033, -2188, -2324, -2399, -2505, -2697, -2858, -2877, -2840, -2893, -3013, -3099, -3154, -3254, -3385, -3472, -3530, -3652, -3841, -4002, -4114, -4259, -4457, -4621, -4705, -4749, -4763, -4707, -4606, -4559, -4599, -4620, -4533, -4397, -4330, -4356, -4428, -4525, -4634, -4692, -4680, -4664, -4678, -4672, -4606, -4524, -4455, -4358, -4212, -4058, -3939, -3840, -3729, -3602, -3487, -3398, -3309, -3191, -3063, -2967, -2884, -2746, -2540, -2333, -2163, -1991, -1783, -1569, -1371, -1161, -908, -638, -407, -238, -119, -28, 83, 273, 512, 672, 698, 697, 799, 997, 1233, 1510, 1805, 2022, 2129, 2226, 2392, 2571, 2683, 2744, 2809, 2877, 2914, 2934, 2985, 3076, 3160, 3217, 3297, 3440, 3597, 3694, 3737, 3795, 3876, 3946, 4019, 4128, 4231, 4262, 4265, 4329, 4436, 4506, 4541, 4582, 4619, 4627, 4634, 4667, 4693, 4680, 4657, 4645, 4619, 4541, 4432, 4352, 4308, 4257, 4181, 4087, 3972, 3841, 3742, 3711, 3711, 3700, 3683, 3665, 3611, 3525, 3466, 3453, 3427, 3347, 3246, 3180, 3135, 3068, 2966, 2854, 2751, 2649, 2549, 2489, 2488, 2507, 2486, 2416, 2353, 2364, 2445, 2531, 2581, 2610, 2642, 2664, 2690, 2760, 2861, 2916, 2883, 2823, 2800, 2810, 2826, 2835, 2823, 2779, 2746, 2772, 2844, 2911, 2960, 3028, 3126, 3221, 3277, 3304, 3355, 3454, 3549, 3569, 3521, 3471, 3445, 3434, 3462, 3561, 3662, 3646, 3523, 3471, 3617, 3852, 3951, 3850, 3713, 3708, 3803, 3844, 3788, 3731, 3731, 3729, 3699, 3710, 3794, 3846, 3772, 3631, 3554, 3586, 3666, 3699, 3636, 3519, 3434, 3414, 3401, 3336, 3260, 3252, 3304, 3305, 3199, 3065, 2990, 2956, 2890, 2790, 2707, 2664, 2644, 2604, 2521, 2428, 2406, 2477, 2537, 2474, 2326, 2239, 2275, 2325, 2245, 2048, 1891, 1884, 1954, 1950, 1827, 1687, 1625, 1615, 1583, 1518, 1470, 1459, 1433, 1359, 1261, 1183, 1118, 1044, 976, 946, 927, 852, 741, 697, 735, 727, 590, 416, 340, 371, 434, 447, 367, 237, 190, 278, 385, 381, 291, 220, 185, 143, 93, 71, 61, 22, -21, -17, 8, 9, 57, 242, 444, 444, 246, 49, -77, -252, -533, -852, -1184, -1579, -1993, -2275, -2369, -2376, -2357, -2218, -1913, -1579, -1346, -1151, -902, -664, -548, -534, -557, -630, -779, -942, -1056, -1162, -1318, -1470, -1489, -1352, -1187, -1091, -999, -788, -476, -187, 36, 266, 511, 669, 687, 664, 707, 778, 758, 637, 520, 486, 512, 575, 709, 937, 1199, 1410, 1568, 1723, 1890, 2020, 2085, 2098, 2067, 1990, 1898, 1849, 1858, 1891, 1939, 2026, 2164, 2351, 2586, 2829, 3023, 3186, 3385, 3578, 3655, 3628, 3596, 3570, 3486, 3352, 3229, 3115, 2989, 2901, 2902, 2941, 2944, 2948, 3033, 3185, 3302, 3332, 3322, 3293, 3209, 3060, 2889, 2709, 2486, 2241, 2055, 1959, 1898, 1835, 1804, 1828, 1855, 1828, 1764, 1726, 1727, 1727, 1688, 1592, 1445, 1295, 1191, 1109, 973, 779, 604, 488, 389, 288, 216, 201, 207, 197, 174, 141, 71, -37, -140, -209, -306, -488, -714, -908, -1060, -1203, -1346, -1480, -1621, -1769, -1874, -1895, -1849, -1804, -1796, -1819, -1852, -1896, -1954, -2010, -2042, -2068, -2130, -2227, -2297, -2308, -2305, -2331, -2367, -2383, -2382, -2381, -2384, -2407, -2466, -2541, -2608, -2667, -2721, -2765, -2810, -2879, -2953, -2995, -3008, -3025, -3041, -3028, -2993, -2962, -2940, -2914, -2902, -2927, -2974, -2998, -2982, -2953, -2946, -2966, -2994, -3014, -3032, -3039, -3014, -2971, -2958, -2984, -2986, -2935, -2877, -2840, -2794, -2745, -2750, -2791, -2777, -2708, -2673, -2693, -2711, -2703, -2695, -2687, -2656, -2619, -2598, -2576, -2543, -2502, -2453, -2390, -2328, -2289, -2274, -2268, -2272, -2284, -2297, -2308, -2326, -2345, -2341, -2307, -2254, -2192, -2119, -2041, -1981, -1950, -1939, -1933, -1924, -1917, -1913, -1900, -1880, -1878, -1907, -1942, -1952, -1952, -1967, -1988, -1989, -1989, -2014, -2046, -2056, -2056, -2071, -2100, -2136, -2176, -2203, -2212, -2227, -2271, -2317, -2335, -2332, -2322, -2297, -2267, -2253, -2248, -2229, -2219, -2238, -2259, -2257, -2252, -2260, -2256, -2241, -2255, -2309, -2362, -2388, -2400, -2413, -2425, -2439, -2443, -2418, -2375, -2343, -2315, -2273, -2235, -2227, -2237, -2236, -2237, -2254, -2259, -2241, -2234, -2261, -2294, -2290, -2246, -2178, -2106, -2056, -2032, -2021, -2013, -2002, -1977, -1946, -1938, -1957, -1956, -1916, -1886, -1905, -1933, -1914, -1850, -1774, -1692, -1599, -1510, -1440, -1377, -1297, -1198, -1107, -1061, -1071, -1091, -1077, -1031, -992, -979, -979, -972, -946, -898, -841, -783, -700, -576, -455, -393, -375, -324, -214, -100, -32, 4, 52, 111, 166, 233, 320, 392, 430, 468, 534, 596, 630, 666, 718, 746, 735, 740, 792, 848, 862, 855, 870, 893, 883, 867, 900, 980, 1047, 1079, 1114, 1178, 1262, 1349, 1421, 1447, 1417, 1365, 1333, 1326, 1336, 1359, 1393, 1421, 1425, 1414, 1420, 1455, 1491, 1493, 1476, 1492, 1543, 1557, 1511, 1463, 1452, 1438, 1400, 1380, 1391, 1397, 1406, 1458, 1533, 1566, 1563, 1583, 1634, 1662, 1655, 1650, 1662, 1660, 1611, 1534, 1468, 1439, 1437, 1448, 1461, 1472, 1477, 1482, 1509, 1551, 1579, 1577, 1556, 1530, 1505, 1503, 1539, 1573, 1547, 1477, 1438, 1456, 1487, 1503, 1517, 1538, 1535, 1497, 1458, 1457, 1498, 1551, 1580, 1576, 1549, 1522, 1514, 1528, 1555, 1575, 1577, 1560, 1543, 1545, 1570, 1596, 1608, 1617, 1651, 1710, 1780, 1846, 1898, 1923, 1921, 1908, 1917, 1946, 1960, 1937, 1893, 1862, 1866, 1908, 1958, 1970, 1925, 1868, 1845, 1856, 1886, 1939, 1993, 1998, 1959, 1932, 1936, 1939, 1925, 1896, 1848, 1788, 1764, 1790, 1813, 1788, 1744, 1722, 1733, 1768, 1808, 1818, 1779, 1729, 1713, 1725, 1729, 1717, 1704, 1702, 1708, 1706, 1688, 1647, 1595, 1551, 1533, 1536, 1542, 1524, 1486, 1457, 1446, 1432, 1405, 1392, 1394, 1376, 1319, 1258, 1221, 1195, 1157, 1111, 1070, 1028, 986, 956, 949, 956, 960, 960, 961, 958, 946, 936, 922, 884, 830, 795, 785, 767, 729, 704, 709, 717, 698, 668, 646, 631, 618, 619, 633, 622, 571, 517, 507, 532, 529, 468, 381, 320, 307, 323, 327, 292, 240, 216, 231, 251, 251, 246, 262, 285, 288, 272, 262, 261, 256, 248, 248, 255, 263, 262, 241, 199, 171, 194, 237, 244, 221, 215, 230, 229, 215, 225, 259, 291, 313, 322, 316, 302, 295, 293, 278, 248, 221, 201, 183, 164, 149, 146, 152, 153, 143, 131, 135, 156, 177, 190, 191, 174, 139, 111, 114, 133, 141, 144, 147, 135, 111, 111, 128, 117, 68, 27, 13, 5, -10, -30, -57, -85, -93, -89, -98, -113, -105, -93, -118, -165, -189, -189, -186, -183, -179, -188, -210, -225, -236, -258, -278, -283, -289, -317, -348, -362, -381, -431, -492, -525, -527, -533, -558, -579, -578, -571, -570, -565, -563, -582, -619, -647, -655, -665, -693, -737, -785, -823, -836, -824, -813, -822, -847, -858, -837, -796, -772, -783, -811, -824, -817, -811, -820, -829, -823, -814, -823, -844, -848, -833, -831, -856, -877, -863, -827, -808, -818, -839, -854, -864, -870, -870, -857, -849, -863, -895, -918, -926, -930, -944, -956, -964, -985, -1011, -1012, -981, -946, -926, -910, -900, -896, -887, -879, -889, -910, -912, -904, -925, -965, -975, -948, -928, -928, -928, -915, -903, -887, -850, -801, -772, -777, -792, -793, -783, -768, -751, -734, -729, -717, -683, -664, -693, -737, -740, -706, -677, -668, -663, -668, -696, -728, -731, -709, -691, -681, -670, -665, -676, -682, -650, -602, -595, -626, -631, -585, -547, -562, -600, -604, -581, -564, -548, -505, -458, -458, -512, -577, -622, -642, -637, -620, -622, -641, -638, -610, -596, -609, -624, -625, -616, -592, -568, -575, -613, -643, -650, -667, -711, -750, -757, -746, -736, -725, -706, -696, -702, -701, -681, -678, -716, -757, -761, -750, -752, -751, -728, -708, -709, -703, -674, -650, -645, -632, -604, -595, -624, -654, -648, -625, -626, -649, -654, -637, -621, -615, -606, -587, -566, -541, -508, -481, -474, -483, -495, -497, -476, -442, -426, -435, -438, -405, -349, -313, -306, -304, -287, -269, -266, -268, -263, -255, -246, -230, -200, -170, -152, -140, -121, -90, -54, -25, -16, -20, -20, -5, 12, 19, 21, 37, 71, 99, 97, 74, 64, 93, 137, 161, 164, 152, 122, 98, 123, 179, 191, 150, 140, 186, 224, 212, 183, 156, 122, 108, 142, 186, 190, 171, 179, 214, 235, 224, 197, 177, 176, 196, 215, 213, 188, 164, 149, 133, 92, 35, 0, 8, 41, 56, 33, 4, 6, 28, 24, -6, -11, 22, 27, -18, -43, -25, -40, -122, -193, -208, -214, -230, -222, -201, -220, -265, -298, -329, -372, -397, -396, -401, -409, -385, -348, -356, -407, -436, -421, -402, -408, -430, -451, -471, -496, -522, -532, -523, -519, -539, -563, -553, -524, -523, -553, -564, -536, -507, -513, -545, -565, -549, -513, -503, -536, -559, -531, -491, -497, -525, -515, -467, -433, -427, -419, -402, -389, -382, -367, -343, -333, -340, -337, -310, -279, -269, -278, -276, -253, -210, -168, -140, -123, -108, -98, -103, -103, -75, -30, -8, -12, -1, 44, 88, 96, 89, 109, 152, 177, 168, 156, 175, 212, 239, 245, 243, 243, 241, 237, 241, 273, 328, 369, 375, 370, 383, 414, 443, 462, 469, 463, 450, 455, 478, 500, 502, 494, 488, 488, 497, 519, 546, 553, 535, 522, 542, 577, 594, 594, 593, 592, 591, 603, 620, 620, 604, 602, 621, 631, 610, 588, 601, 636, 661, 658, 639, 628, 636, 660, 679, 673, 653, 655, 678, 684, 660, 641, 654, 677, 678, 666, 658, 650, 639, 633, 643, 666, 684, 686, 672, 663, 672, 690, 697, 689, 675, 672, 689, 718, 733, 724, 708, 706, 705, 692, 681, 689, 695, 681, 669, 678, 698, 707, 708, 711, 722, 734, 746, 751, 749, 750, 753, 754, 754, 762, 776, 781, 774, 763, 755, 750, 750, 768, 803, 828, 824, 801, 792, 812, 841, 853, 849, 849, 858, 863, 856, 853, 858, 867, 873, 871, 855, 832, 821, 824, 823, 817, 820, 823, 812, 801, 819, 848, 851, 829, 815, 813, 806, 786, 769, 761, 758, 750, 735, 715, 695, 683, 682, 678, 661, 642, 639, 646, 645, 632, 619, 615, 615, 614, 605, 583, 561, 553, 552, 535, 500, 471, 471, 483, 477, 458, 448, 448, 439, 426, 424, 428, 424, 420, 420, 404, 376, 372, 394, 401, 382, 362, 352, 331, 304, 293, 300, 302, 293, 280, 271, 266, 264, 264, 253, 226, 198, 194, 210, 221, 208, 186, 176, 177, 184, 194, 200, 192, 168, 148, 149, 166, 174, 159, 139, 134, 139, 133, 115, 109, 117, 114, 88, 63, 59, 65, 67, 67, 74, 78, 70, 54, 46, 41, 31, 21, 22, 27, 19, 4, 3, 18, 28, 26, 23, 23, 21, 10, 3, 8, 24, 30, 18, -2, -10, 0, 7, -7, -36, -46, -21, 12, 22, 0, -27, -40, -41, -38, -33, -24, -12, -8, -14, -28, -41, -43, -29, -16, -21, -39, -48, -45, -48, -62, -71, -64, -60, -67, -71, -60, -55, -78, -104, -97, -76, -75, -93, -106, -111, -118, -116, -101, -100, -119, -129, -124, -125, -144, -164, -165, -154, -145, -150, -170, -191, -194, -183, -183, -205, -223, -213, -189, -185, -202, -212, -212, -224, -249, -266, -271, -272, -267, -257, -259, -278, -297, -312, -326, -325, -300, -287, -310, -337, -332, -320, -329, -347, -354, -357, -359, -353, -355, -398, -461, -486, -454, -420, -437, -478, -494, -486, -493, -516, -521, -503, -490, -490, -491, -487, -487, -489, -492, -495, -499, -500, -503, -506, -502, -493, -492, -496, -494, -490, -496, -506, -504, -495, -488, -477, -458, -443, -441, -440, -435, -432, -432, -427, -429, -450, -474, -475, -460, -456, -465, -469, -458, -442, -432, -422, -405, -383, -367, -367, -374, -382, -393, -411, -419, -411, -397, -390, -388, -386, -395, -415, -426, -416, -407, -417, -435, -435, -420, -414, -417, -412, -401, -404, -415, -417, -416, -430, -444, -436, -425, -439, -463, -464, -448, -443, -451, -457, -462, -475, -485, -472, -445, -431, -438, -450, -449, -434, -424, -426, -432, -443, -463, -470, -441, -406, -414, -447, -446, -420, -431, -470, -465, -415, -396, -433, -475, -483, -469, -462, -467, -476, -478, -465, -439, -421, -426, -435, -427, -407, -400, -411, -417, -408, -400, -403, -406, -400, -392, -389, -388, -388, -396, -407, -410, -398, -384, -376, -367, -358, -366, -381, -379, -357, -351, -372, -390, -383, -363, -349, -349, -360, -373, -368, -354, -358, -380, -389, -366, -330, -319, -341, -373, -384, -363, -333, -328, -349, -363, -345, -314, -310, -332, -339, -314, -289, -288, -293, -285, -272, -267, -261, -245, -229, -216, -204, -195, -189, -181, -165, -144, -134, -135, -140, -137, -125, -114, -113, -116, -109, -92, -80, -70, -58, -39, -24, -12, -2, 6, 17, 29, 47, 61, 71, 81, 92, 99, 98, 96, 100, 111, 125, 140, 151, 152, 145, 148, 165, 179, 184, 198, 226, 249, 254, 256, 262, 262, 259, 274, 303, 319, 312, 305, 317, 332, 334, 326, 324, 332, 340, 338, 333, 342, 360, 379, 389, 389, 380, 374, 386, 416, 436, 427, 410, 414, 437, 445, 435, 431, 444, 455, 442, 425, 427, 440, 443, 441, 446, 455, 459, 463, 471, 474, 471, 475, 492, 506, 502, 487, 480, 488, 500, 514, 528, 530, 517, 503, 507, 514, 506, 493, 488, 489, 486, 479, 474, 473, 482, 495, 502, 500, 503, 516, 528, 530, 525, 518, 511, 508, 520, 533, 534, 524, 519, 523, 517, 495, 485, 507, 536, 532, 501, 482, 490, 513, 528, 526, 505, 478, 466, 477, 499, 511, 491, 447, 420, 437, 466, 460, 427, 416, 437, 442, 411, 384, 397, 424, 426, 408, 401, 400, 379, 349, 340, 350, 357, 357, 355, 346, 327, 319, 329, 342, 339, 337, 345, 345, 317, 287, 291, 313, 304, 265, 243, 262, 285, 279, 257, 251, 260, 267, 274, 281, 274, 257, 258, 289, 307, 282, 252, 258, 275, 272, 258, 248, 234, 219, 221, 234, 229, 205, 193, 200, 211, 213, 203, 180, 158, 147, 142, 140, 149, 168, 176, 165, 152, 143, 125, 103, 92, 90, 81, 71, 76, 81, 75, 67, 67, 61, 38, 19, 31, 62, 69, 44, 17, 15, 26, 30, 26, 17, 1, -9, -4, 6, -1, -26, -40, -33, -22, -27, -40, -50, -53, -56, -57, -59, -72, -88, -86, -82, -99, -118, -105, -86, -114, -164, -178, -164, -167, -188, -202, -212, -234, -250, -241, -228, -235, -267, -300, -310, -290, -265, -263, -278, -282, -278, -283, -284, -274, -278, -308, -335, -339, -337, -348, -355, -352, -356, -368, -376, -391, -422, -440, -422, -392, -377, -371, -374, -395, -419, -425, -418, -419, -421, -417, -427, -453, -464, -446, -427, -430, -448, -467, -479, -481, -473, -467, -464, -458, -450, -456, -474, -483, -474, -461, -460, -469, -479, -489, -494, -489, -477, -474, -487, -502, -499, -477, -466, -484, -507, -507, -493, -488, -488, -474, -461, -468, -480, -478, -469, -468, -469, -465, -466, -464, -453, -456, -488, -512, -493, -459, -444, -444, -440, -440, -448, -447, -440, -442, -451, -453, -453, -457, -453, -436, -427, -432, -432, -416, -402, -403, -412, -414, -405, -395, -397, -410, -418, -407, -386, -372, -363, -353, -347, -349, -347, -335, -323, -315, -303, -297, -305, -317, -314, -299, -289, -287, -284, -283, -283, -275, -261, -254, -261, -267, -255, -236, -230, -237, -238, -229, -227, -236, -235, -211, -180, -169, -177, -184, -178, -172, -182, -198, -187, -151, -123, -127, -147, -155, -151, -147, -139, -125, -119, -122, -120, -101, -82, -77, -80, -75, -56, -38, -38, -51, -56, -46, -37, -41, -49, -47, -40, -33, -22, -11, -10, -9, 2, 13, 1, -14, -1, 32, 51, 42, 32, 35, 56, 77, 77, 54, 46, 67, 88, 88, 87, 98, 102, 94, 97, 104, 87, 69, 83, 111, 119, 124, 144, 156, 141, 133, 159, 193, 190, 166, 164, 187, 201, 187, 173, 178, 195, 204, 208, 209, 200, 186, 192, 217, 236, 223, 197, 196, 222, 241, 235, 223, 225, 236, 238, 231, 230, 240, 256, 264, 267, 266, 262, 252, 239, 233, 244, 266, 278, 262, 241, 243, 267, 287, 289, 289, 296, 302, 302, 303, 312, 311, 288, 260, 257, 282, 304, 298, 280, 277, 290, 298, 297, 296, 294, 287, 284, 296, 311, 309, 298, 297, 301, 300, 301, 304, 300, 284, 265, 257, 262, 280, 297, 297, 287, 285, 294, 303, 308, 307, 298, 286, 287, 296, 289, 266, 258, 269, 273, 260, 252, 262, 275, 284, 292, 303, 319, 334, 336, 317, 298, 302, 321, 320, 290, 263, 269, 291, 293, 278, 265, 261, 254, 255, 274, 294, 291, 280, 281, 289, 285, 275, 277, 287, 293, 286, 268, 260, 278, 300, 294, 260, 235, 239, 252, 254, 248, 242, 237, 234, 238, 246, 251, 248, 243, 244, 246, 253, 268, 288, 298, 294, 285, 277, 269, 263, 267, 278, 279, 265, 254, 257, 272, 285, 284, 272, 266, 268, 270, 263, 255, 252, 251, 253, 267, 279, 263, 233, 225, 244, 258, 252, 241, 234, 223, 211, 214, 230, 240, 234, 214, 190, 174, 181, 202, 211, 198, 176, 171, 180, 187, 192, 200, 203, 192, 178, 179, 188, 191, 190, 190, 183, 171, 167, 175, 185, 182, 173, 166, 163, 159, 155, 154, 156, 158, 156, 151, 140, 124, 111, 107, 112, 124, 139, 146, 138, 121, 113, 120, 141, 162, 167, 152, 135, 138, 151, 146, 121, 104, 110, 123, 125, 116, 107, 97, 83, 71, 76, 90, 97, 87, 70, 60, 62, 73, 82, 79, 69, 68, 80, 88, 81, 62, 46, 42, 49, 55, 50, 32, 17, 15, 24, 28, 17, -3, -14, -4, 21, 40, 45, 39, 34, 30, 27, 26, 25, 19, 7, 2, 7, 11, -1, -23, -31, -19, -1, 5, 3, 0, -2, -6, -12, -19, -19, -17, -20, -34, -50, -49, -32, -19, -22, -30, -31, -29, -32, -40, -43, -41, -42, -46, -46, -40, -36, -38, -43, -50, -54, -57, -60, -62, -61, -56, -53, -56, -61, -56, -42, -40, -57, -71, -67, -55, -54, -57, -50, -42, -52, -68, -71, -63, -59, -62, -60, -48, -39, -49, -68, -72, -60, -58, -78, -95, -87, -74, -81, -101, -110, -106, -97, -88, -80, -78, -82, -85, -92, -111, -127, -119, -92, -77, -85, -94, -91, -91, -104, -111, -97, -77, -74, -83, -89, -92, -99, -104, -98, -89, -87, -92, -99, -105, -106, -101, -98, -96, -93, -87, -83, -87, -101, -118, -125, -121, -111, -107, -115, -127, -132, -124, -117, -119, -123, -118, -108, -110, -126, -141, -135, -118, -114, -127, -146, -157, -156, -148, -140, -140, -145, -144, -141, -143, -145, -135, -119, -113, -117, -124, -132, -139, -141, -144, -155, -164, -153, -134, -130, -142, -150, -148, -142, -134, -128, -134, -146, -148, -136, -126, -135, -148, -149, -147, -160, -180, -179, -157, -145, -152, -165, -168, -165, -159, -151, -144, -144, -150, -158, -166, -167, -158, -144, -137, -140, -141, -133, -124, -129, -141, -145, -144, -150, -165, -176, -177, -179, -181, -172, -149, -136, -148, -167, -172, -167, -170, -175, -170, -160, -157, -156, -153, -152, -156, -158, -152, -142, -135, -138, -156, -173, -168, -142, -124, -127, -141, -147, -141, -126, -113, -112, -129, -151, -163, -158, -150, -149, -153, -152, -145, -138, -138, -138, -126, -110, -100, -100, -101, -100, -104, -115, -127, -134, -130, -122, -114, -111, -115, -121, -120, -113, -108, -104, -92, -76, -67, -67, -65, -61, -69, -89, -92, -68, -46, -55, -82, -82, -53, -32, -45, -66, -66, -48, -34, -34, -41, -49, -55, -52, -33, -4, 9, -1, -21, -18, 9, 33, 30, 15, 10, 20, 32, 39, 37, 25, 11, 6, 3, -3, -1, 17, 38, 41, 27, 15, 13, 20, 23, 16, 7, 11, 26, 36, 35, 30, 28, 26, 18, 12, 27, 44, 38, 12, 0, 7, 17, 17, 23, 35, 38, 31, 30, 36, 37, 33, 36, 47, 46, 29, 16, 22, 36, 45, 46, 47, 47, 44, 42, 45, 45, 46, 52, 55, 44, 26, 19, 23, 26, 26, 27, 31, 30, 25, 23, 32, 40, 36, 22, 15, 22, 34, 35, 25, 15, 16, 27, 44, 48, 28, 1, -10, -14, -28, -39, -26, 2, 15, 3, -16, -34, -47, -45, -27, -10, -7, -11, -17, -28, -38, -35, -18, -3, -4, -13, -19, -14, -8, -3, -2, -12, -30, -36, -22, -5, -6, -17, -13, 3, 18, 10, -8, -23, -22, -13, -10, -16, -22, -25, -24, -19, -10, 2, 12, 12, 0, -16, -34, -53, -59, -43, -23, -10, 0, 12, 15, 0, -9, 0, 6, 1, -2, 2, 8, 16, 26, 23, 0, -10, 8, 35, 44, 36, 27, 19, 18, 24, 22, 11, 15, 31, 34, 15, 4, 16, 26, 25, 25, 29, 28, 26, 29, 31, 31, 38, 44, 32, 10, 3, 20, 46, 67, 76, 59, 33, 29, 54, 83, 95, 90, 75, 56, 49, 61, 77, 77, 65, 67, 87, 110, 119, 116, 109, 104, 100, 99, 97, 96, 99, 103, 95, 79, 79, 111, 149, 158, 146, 146, 162, 155, 110, 66, 73, 120, 163, 176, 173, 166, 151, 137, 144, 178, 213, 226, 217, 197, 164, 127, 113, 129, 154, 172, 186, 196, 184, 163, 157, 171, 183, 186, 178, 162, 148, 146, 141, 122, 122, 152, 173, 159, 154, 185, 206, 196, 202, 253, 299, 298, 270, 241, 223, 221, 212, 162, 86, 57, 92, 150, 223, 336, 458, 517, 490, 404, 292, 187, 117, 61, -27, -128, -175, -154, -130, -139, -145, -121, -95, -88, -70, -23, 12, 5, -8, 3, 25, 56, 139, 238, 225, 79, -27, 44, 203, 260, 151, -40, -221, -339, -360, -256, -42, 224, 569, 1137, 1970, 2707, 2775, 1990, 769, -323, -1021, -1275, -1103, -683, -321, -141, -34, 50, -12, -271, -534, -583, -425, -253, -195, -199, -152, -50, 12, -36, -164, -266, -291, -287, -292, -244, -93, 48, 37, -81, -154, -150, -147, -202, -313, -438, -484, -430, -428, -585, -760, -794, -764, -769, -678, -361, 13, 203, 220, 223, 199, 5, -312, -542, -642, -762, -884, -796, -484, -197, -53, 54, 135, 70, -106, -242, -328, -415, -426, -279, -67, 89, 205, 307, 310, 150, -84, -266, -389, -485, -463, -234, 62, 163, 37, -69, 11, 174, 229, 135, -52, -292, -529, -651, -619, -553, -572, -609, -542, -416, -374, -416, -398, -274, -171, -188, -267, -311, -320, -350, -381, -355, -285, -233, -207, -159, -105, -121, -214, -275, -215, -59, 169, 536, 1083, 1666, 2034, 2055, 1792, 1368, 877, 446, 270, 496, 1115, 1979, 2853, 3406, 3262, 2210, 408, -1618, -3179, -3701, -2968, -1181, 1144, 3285, 4368, 3668, 1111, -2423, -5416, -6507, -5275, -2373, 1099, 4368, 7039, 8553, 8089, 5340, 1184, -2757, -5280, -6206, -5943, -4724, -2514, 482, 3498, 5532, 5960, 4839, 2711, 236, -2005, -3496, -3894, -3218, -1694, 483, 2892, 4617, 4828, 3538, 1223, -1882, -5271, -7315, -6096, -1235, 5636, 12092, 16125, 16627, 13484, 7467, -52, -7390, -12850, -14965, -12598, -5523, 4298, 12488, 14857, 10773, 3279, -4046, -9358, -11834, -10568, -5504, 1277, 6776, 9403, 9022, 5480, -934, -7819, -11648, -10882, -6939, -2360, 994, 2696, 3693, 4821, 5139, 3023, -976, -4132, -4643, -3310, -1863, -877, 388, 2588, 4927, 5518, 3601, 798, -829, -1225, -1612, -2137, -1869, -719, 198, 105, -661, -1532, -2639, -4467, -6746, -8126, -7473, -5257, -2832, -489, 2464, 5649, 7137, 5496, 1238, -3729, -7080, -7048, -3807, 491, 3834, 5720, 6073, 4404, 666, -4194, -8631, -10583, -8327, -2635, 3293, 7199, 9245, 9540, 7118, 2516, -1449, -2873, -2592, -2020, -1079, 965, 3905, 6443, 7181, 5790, 3366, 1388, 410, 163, 529, 1620, 2990, 3599, 2864, 1378, 315, 214, 556, 564, 203, 16, 168, 300, 346, 671, 1214, 1321, 694, -285, -1316, -2446, -3441, -3759, -3423, -3085, -2848, -1922, -100, 1126, -13, -3276, -6431, -7602, -6780, -4886, -2405, 356, 2523, 3277, 2713, 952, -2628, -7767, -11960, -12708, -10192, -6117, -1496, 2675, 4457, 2777, -1074, -5048, -8040, -9296, -8037, -4732, -1401, 272, 428, 177, -125, -1169, -3070, -4155, -2531, 981, 3106, 1996, -775, -2811, -3522, -3261, -1955, 29, 1227, 463, -1985, -4885, -6687, -5759, -1580, 3792, 6662, 5041, 373, -4629, -8559, -10666, -9568, -4792, 1667, 7174, 10385, 10374, 6414, 51, -5100, -6905, -6020, -3578, 0, 3886, 6768, 7888, 6799, 2939, -2999, -8138, -9539, -7054, -2931, 1150, 5306, 9470, 11672, 9651, 3792, -2701, -6628, -7023, -4765, -1300, 1872, 3645, 4069, 3876, 2879, 118, -3887, -6624, -6246, -3583, -806, 786, 1228, 1234, 1592, 2611, 3895, 4558, 3494, 162, -3979, -5889, -4343, -1696, -629, -654, 262, 2280, 3741, 3194, 249, -4006, -6948, -6481, -3094, 1339, 5406, 7465, 5537, 45, -5387, -7594, -6567, -3810, -360, 2780, 4519, 4881, 4877, 4603, 2766, -1194, -5329, -6479, -3475, 1523, 5212, 6293, 5863, 5049, 3387, 52, -4015, -6250, -4933, -958, 3202, 5733, 6305, 5421, 3906, 2672, 2076, 1536, 288, -1521, -2775, -2406, -782, 114, -1061, -2626, -1668, 1466, 3027, 1086, -1717, -2106, -329, 1497, 3144, 5655, 7995, 7362, 3256, -1276, -3417, -3552, -3457, -3362, -1995, 1557, 6472, 9962, 9061, 3770, -2270, -5272, -4684, -2498, -473, 827, 1317, 1083, 572, 19, -1129, -3098, -4462, -3563, -1092, 694, 1218, 1787, 2750, 2804, 1274, -917, -2559, -3163, -3000, -2748, -2522, -1376, 1033, 3010, 2659, 386, -1993, -3575, -4278, -3707, -1715, 771, 2595, 3368, 3141, 1939, 199, -1126, -1492, -1394, -1504, -1601, -1060, -93, 436, 228, -232, -403, 30, 1039, 1864, 1681, 1010, 1213, 2259, 2573, 1576, 648, 798, 1005, 155, -641, 572, 3321, 4685, 3112, 677, 353, 1980, 2626, 710, -1911, -2407, -193, 2815, 4073, 2142, -2125, -5594, -5180, -846, 4400, 7520, 7814, 6591, 5370, 4433, 3036, 1126, 13, 380, 775, -359, -2282, -3221, -2964, -2630, -2853, -3246, -2760, -328, 3501, 5941, 4759, 1369, -741, -239, 1160, 1558, 957, 506, 800, 1253, 930, -255, -1599, -2776, -3988, -4836, -4356, -2616, -1017, -555, -836, -956, -437, 584, 1316, 971, 123, 390, 1937, 2546, 520, -2465, -3072, -541, 2383, 3000, 1527, -135, -1033, -1448, -1658, -1670, -1597, -1389, -627, 628, 1285, 477, -917, -1257, -505, -155, -718, -919, 382, 2957, 5700, 7104, 5966, 2959, 447, -278, -86, 121, 447, 554, -280, -1349, -1185, -254, -602, -2490, -3508, -1750, 1557, 3513, 2980, 1627, 1464, 2169, 1693, -751, -3445, -4078, -2035, 1409, 4229, 4793, 2833, -292, -2696, -3256, -1840, 820, 3045, 3176, 1437, -104, -251, -280, -1752, -3614, -3209, -53, 3232, 4163, 2935, 1168, -128, -605, -209, 509, 970, 1554, 2815, 3981, 3695, 1934, -49, -1448, -2422, -3125, -3148, -2086, -314, 1089, 1382, 1100, 1464, 2807, 4123, 4202, 2668, 285, -1213, -501, 1392, 1997, 939, 369, 1058, 974, -904, -2476, -1999, -957, -1403, -2563, -2251, -411, 794, 93, -1384, -2003, -1741, -1667, -2066, -2123, -1159, 618, 2506, 3752, 3733, 2354, 322, -1552, -3105, -4198, -3954, -1842, 920, 2276, 1391, -964, -3392, -4563, -3956, -2513, -1641, -1403, -729, 801, 2564, 3850, 4161, 3111, 1040, -808, -1559, -1661, -2004, -2654, -2911, -2236, -813, 600, 1296, 1227, 914, 772, 718, 334, -705, -1964, -2034, -100, 2215, 2336, 282, -1288, -874, 419, 1482, 2581, 3674, 3777, 2801, 1948, 1639, 755, -1183, -2662, -2368, -1514, -2228, -4355, -5703, -4926, -2544, 137, 1843, 2038, 1732, 2372, 3684, 4336, 4433, 5111, 5917, 5013, 2005, -1456, -3881, -5154, -5507, -4805, -3238, -1681, -730, -129, 338, 246, -478, -942, -624, -432, -1225, -1986, -833, 2265, 4819, 4291, 849, -2838, -4571, -4597, -4223, -3593, -2110, -140, 1358, 2352, 3253, 3351, 1484, -1763, -4157, -4488, -3847, -3641, -3546, -2425, -282, 1917, 3530, 4191, 3412, 1405, -547, -1329, -711, 1122, 3313, 3962, 1936, -1297, -3338, -3691, -3498, -3309, -2701, -1400, 272, 1688, 2305, 2248, 2204, 2274, 1753, 585, -97, 405, 1389, 1949, 2003, 1644, 644, -992, -2714, -3816, -3767, -2450, -456, 1259, 2257, 2741, 2867, 2488, 1481, -189, -2544, -5101, -6540, -5818, -3774, -2562, -2955, -3431, -2750, -2009, -2578, -3307, -1894, 1479, 3985, 3695, 1572, -457, -1859, -3037, -3906, -4186, -4308, -4725, -4985, -4498, -3618, -3112, -3218, -3716, -4212, -4154, -3318, -2220, -1366, -438, 1013, 2467, 2784, 1526, -651, -2741, -4076, -4366, -3638, -2333, -1100, -251, 266, 356, -173, -1021, -1558, -1621, -1514, -1344, -938, -214, 848, 2186, 3219, 3133, 1895, 397, -524, -655, -167, 474, 650, 310, 181, 719, 1321, 1165, 368, -146, 295, 1449, 2363, 2245, 1246, 283, 79, 625, 1551, 2563, 3509, 4380, 5193, 5592, 4892, 3008, 957, -56, 165, 855, 1220, 1146, 1194, 1833, 2577, 2315, 811, -784, -1369, -1159, -995, -1005, -588, 695, 2650, 4585, 5647, 5275, 3618, 1526, 1, -496, -329, -275, -765, -1580, -2310, -2811, -3024, -2627, -1312, 600, 2139, 2434, 1464, 33, -931, -1073, -638, -11, 611, 1135, 1423, 1267, 390, -1386, -3630, -5133, -4820, -2909, -778, 444, 833, 1090, 1481, 1711, 1549, 1066, 376, -410, -1048, -1354, -1538, -1878, -2055, -1336, 299, 1795, 2301, 2197, 2178, 2063, 1447, 704, 361, 214, -35, -138, -49, -385, -1390, -2268, -2244, -1623, -1243, -1358, -1595, -1636, -1330, -451, 915, 2045, 2364, 2263, 2245, 1941, 916, -308, -1091, -1671, -2441, -3143, -3429, -3318, -2675, -1233, 614, 1866, 1925, 1044, -142, -1100, -1566, -1598, -1335, -678, 520, 1932, 2747, 2352, 887, -917, -2403, -3432, -4173, -4498, -3881, -2082, 361, 2558, 3797, 3579, 1766, -936, -3245, -4374, -4381, -3578, -2330, -1297, -985, -1122, -1134, -998, -1030, -1108, -728, 286, 1516, 2315, 2233, 1205, -367, -1786, -2528, -2592, -2197, -1414, -520, -299, -1215, -2574, -3336, -3329, -2890, -1842, 170, 2731, 4820, 5721, 5245, 3498, 946, -1518, -3009, -3199, -2410, -1280, -409, -101, -152, 86, 1089, 2544, 3543, 3428, 2299, 757, -562, -1229, -1043, -33, 1539, 3156, 4076, 3682, 2022, -56, -1460, -1611, -648, 997, 2910, 4573, 5346, 4933, 3755, 2558, 1666, 907, 231, -14, 360, 934, 1098, 812, 528, 472, 479, 615, 1350, 2755, 4030, 4311, 3654, 2829, 2366, 2149, 1785, 1148, 580, 555, 1087, 1669, 1901, 1944, 2163, 2527, 2568, 1870, 495, -936, -1575, -919, 776, 2683, 3998, 4453, 4319, 3942, 3297, 2155, 729, -186, 17, 1082, 2186, 2695, 2442, 1577, 499, -294, -576, -539, -508, -520, -241, 684, 2110, 3298, 3664, 3373, 2872, 2178, 1196, 326, 10, 67, 136, 390, 1114, 1888, 1918, 1030, -176, -1052, -1308, -876, 95, 1022, 1200, 654, 262, 684, 1479, 1711, 1253, 942, 1448, 2467, 3174, 3049, 2091, 664, -624, -1290, -1378, -1234, -953, -491, -122, -235, -818, -1554, -2210, -2634, -2683, -2371, -1849, -1197, -473, 175, 739, 1422, 2181, 2449, 1735, 340, -984, -1989, -2994, -3921, -4093, -3301, -2258, -1528, -884, -218, -103, -877, -2033, -2952, -3528, -3734, -3369, -2540, -1830, -1636, -1733, -1753, -1772, -2045, -2485, -2867, -3285, -3876, -4391, -4520, -4290, -3840, -3317, -3124, -3551, -4166, -4378, -4376, -4629, -4854, -4501, -3861, -3671, -3902, -3860, -3345, -2962, -3240, -3919, -4325, -4207, -3942, -3930, -4071, -4048, -3850, -3695, -3559, -3194, -2502, -1588, -575, 349, 838, 733, 363, 174, 196, 68, -492, -1277, -1626, -1101, -143, 381, 356, 522, 1257, 2022, 2295, 2298, 2463, 2775, 3092, 3620, 4479, 5181, 5146, 4564, 4092, 3865, 3536, 3175, 3269, 3813, 4206, 4169, 4072, 4270, 4665, 5029, 5342, 5605, 5644, 5343, 4876, 4491, 4208, 3942, 3729, 3654, 3782, 4218, 4972, 5756, 6235, 6429, 6495, 6305, 5679, 4817, 4083, 3494, 2832, 2132, 1676, 1551, 1570, 1661, 1954, 2385, 2664, 2781, 3078, 3607, 3888, 3616, 3151, 2958, 2908, 2579, 1992, 1449, 843, -186, -1429, -2167, -2169, -1875, -1595, -1248, -876, -667, -532, -280, -52, -119, -416, -678, -857, -1119, -1595, -2265, -2977, -3532, -3816, -3850, -3683, -3375, -3068, -2930, -2953, -2959, -2833, -2668, -2674, -3008, -3639, -4295, -4654, -4611, -4321, -4028, -3914, -4001, -4058, -3775, -3190, -2722, -2622, -2664, -2584, -2518, -2764, -3318, -3871, -4184, -4297, -4408, -4650, -4958, -5127, -4975, -4453, -3679, -2938, -2516, -2423, -2390, -2245, -2101, -2126, -2365, -2851, -3559, -4227, -4529, -4478, -4340, -4263, -4266, -4379, -4514, -4387, -3889, -3349, -3147, -3224, -3270, -3262, -3436, -3753, -3894, -3848, -3918, -4110, -4183, -4271, -4638, -4931, -4610, -3946, -3651, -3729, -3583, -3126, -2891, -3101, -3417, -3669, -4087, -4589, -4645, -4214, -3966, -4076, -3827, -2961, -2253, -2157, -2099, -1669, -1331, -1498, -1931, -2296, -2520, -2589, -2548, -2544, -2536, -2336, -2047, -1953, -2014, -1963, -1837, -1867, -1903, -1504, -672, 23, 281, 482, 904, 1161, 994, 894, 1215, 1434, 1073, 545, 373, 423, 498, 819, 1432, 1968, 2233, 2415, 2657, 2902, 3006, 2723, 1982, 1259, 1160, 1604, 2026, 2269, 2627, 3203, 3809, 4306, 4587, 4494, 4073, 3634, 3391, 3342, 3406, 3418, 3226, 3039, 3184, 3412, 3247, 3005, 3411, 4239, 4470, 3830, 3045, 2656, 2599, 2813, 3338, 3949, 4306, 4312, 4040, 3601, 3148, 2704, 2182, 1743, 1658, 1708, 1509, 1417, 2009, 2856, 3092, 2926, 3168, 3664, 3654, 3180, 2830, 2631, 2251, 1754, 1417, 1323, 1530, 2067, 2650, 2893, 2773, 2481, 2078, 1613, 1261, 1097, 1020, 987, 1004, 1001, 1002, 1214, 1644, 1922, 1802, 1536, 1498, 1758, 2168, 2548, 2717, 2603, 2325, 2007, 1730, 1689, 2004, 2330, 2132, 1424, 755, 459, 378, 324, 363, 599, 975, 1379, 1710, 1898, 1991, 2163, 2488, 2735, 2615, 2244, 2042, 2113, 2103, 1775, 1358, 1171, 1251, 1496, 1845, 2196, 2416, 2514, 2638, 2849, 3023, 2989, 2683, 2209, 1811, 1730, 1988, 2311, 2339, 1967, 1472, 1221, 1265, 1367, 1451, 1717, 2140, 2298, 2030, 1790, 1957, 2281, 2383, 2226, 1925, 1654, 1683, 1893, 1624, 723, 51, 165, 379, -9, -512, -299, 549, 1352, 1710, 1658, 1448, 1387, 1516, 1486, 992, 185, -548, -950, -916, -465, 232, 949, 1501, 1731, 1668, 1670, 1984, 2221, 1877, 1236, 1033, 1288, 1257, 605, -138, -453, -526, -789, -1209, -1437, -1372, -1164, -878, -527, -206, 147, 799, 1680, 2260, 2258, 1953, 1588, 1049, 314, -347, -785, -1128, -1441, -1609, -1593, -1553, -1676, -1977, -2286, -2337, -1928, -1249, -922, -1315, -1875, -1748, -1043, -665, -883, -1045, -729, -226, 203, 638, 1059, 1294, 1340, 1214, 746, -56, -766, -1091, -1403, -2208, -3269, -3746, -3230, -2215, -1349, -653, 176, 1017, 1426, 1419, 1512, 1861, 1957, 1464, 784, 410, 261, -2, -514, -1239, -1987, -2327, -2048, -1540, -1210, -948, -591, -283, -4, 517, 1280, 2110, 3069, 3904, 3749, 2409, 1091, 778, 792, -3, -1556, -3008, -3876, -4150, -3950, -3467, -2836, -1977, -864, 225, 1068, 1784, 2426, 2606, 1975, 912, 219, 78, -118, -778, -1529, -1858, -1706, -1252, -709, -487, -905, -1675, -2226, -2488, -2785, -3077, -2969, -2484, -2191, -2332, -2381, -1818, -932, -375, -287, -318, -247, -127, -48, -139, -541, -1116, -1487, -1602, -1961, -2972, -4285, -5173, -5455, -5617, -6034, -6469, -6463, -5811, -4617, -3225, -2106, -1469, -1044, -447, 368, 1155, 1611, 1462, 621, -567, -1512, -1940, -2133, -2441, -2816, -3001, -2989, -2956, -2832, -2373, -1616, -862, -262, 250, 740, 1286, 1977, 2700, 3213, 3506, 3738, 3839, 3644, 3325, 3169, 3067, 2724, 2224, 1960, 2067, 2322, 2522, 2702, 2958, 3294, 3655, 4027, 4403, 4696, 4810, 4786, 4763, 4784, 4806, 4925, 5310, 5795, 5872, 5351, 4761, 4717, 5043, 4975, 4231, 3401, 3084, 3121, 3032, 2783, 2668, 2745, 2872, 3055, 3319, 3489, 3389, 3138, 2967, 2909, 2783, 2430, 1920, 1526, 1389, 1281, 901, 344, -38, -179, -363, -746, -1145, -1399, -1625, -1926, -2110, -1979, -1715, -1656, -1779, -1801, -1699, -1765, -2100, -2473, -2766, -3181, -3812, -4332, -4434, -4333, -4504, -4946, -5172, -4971, -4780, -4994, -5322, -5290, -5070, -5202, -5644, -5789, -5418, -4993, -4936, -5125, -5220, -5090, -4867, -4762, -4889, -5172, -5483, -5801, -6143, -6431, -6566, -6551, -6431, -6200, -5867, -5498, -5119, -4655, -4128, -3820, -3934, -4165, -4078, -3845, -3936, -4171, -3973, -3485, -3409, -3768, -3896, -3602, -3331, -3288, -3276, -3277, -3440, -3643, -3614, -3344, -3046, -2801, -2518, -2182, -1936, -1885, -1886, -1705, -1424, -1414, -1749, -2004, -1909, -1790, -1957, -2172, -2154, -2111, -2279, -2417, -2271, -2076, -2179, -2537, -2856, -2952, -2823, -2596, -2396, -2200, -1895, -1497, -1123, -808, -577, -601, -967, -1444, -1742, -1958, -2422, -3120, -3637, -3762, -3742, -3737, -3481, -2872, -2373, -2338, -2371, -1946, -1300, -1097, -1422, -1680, -1446, -960, -747, -991, -1424, -1686, -1682, -1625, -1799, -2260, -2730, -2847, -2568, -2220, -2081, -2016, -1696, -1093, -558, -351, -359, -339, -227, -170, -343, -730, -1005, -865, -507, -393, -490, -315, 177, 417, 155, -68, 289, 975, 1278, 899, 224, -179, -85, 316, 674, 768, 679, 690, 959, 1397, 1876, 2324, 2569, 2469, 2242, 2296, 2607, 2706, 2388, 2032, 2004, 2117, 2002, 1743, 1740, 2048, 2331, 2411, 2450, 2595, 2849, 3219, 3647, 3936, 4060, 4226, 4457, 4548, 4495, 4439, 4269, 3835, 3354, 3052, 2792, 2514, 2505, 2800, 2926, 2712, 2693, 3269, 3977, 4201, 4134, 4360, 4754, 4645, 4046, 3727, 3964, 4125, 3782, 3338, 3297, 3567, 3756, 3641, 3276, 2930, 2855, 2985, 3009, 2815, 2622, 2599, 2650, 2656, 2705, 2870, 2981, 2875, 2731, 2797, 2942, 2885, 2704, 2677, 2755, 2669, 2464, 2450, 2643, 2698, 2458, 2165, 2009, 1872, 1719, 1763, 1981, 1941, 1518, 1231, 1459, 1885, 2066, 2083, 2236, 2507, 2643, 2523, 2279, 2134, 2183, 2257, 2073, 1589, 1143, 1125, 1555, 2063, 2288, 2249, 2242, 2420, 2636, 2727, 2754, 2830, 2870, 2752, 2602, 2642, 2833, 2916, 2761, 2481, 2260, 2196, 2277, 2412, 2504, 2501, 2386, 2231, 2235, 2487, 2733, 2640, 2318, 2197, 2383, 2506, 2329, 2112, 2153, 2274, 2192, 2078, 2233, 2444, 2359, 2217, 2458, 2817, 2704, 2218, 1914, 1805, 1461, 893, 559, 565, 503, 172, -52, 228, 829, 1227, 1295, 1432, 1874, 2266, 2161, 1649, 1144, 792, 441, 68, -181, -326, -518, -737, -806, -695, -610, -709, -904, -985, -879, -717, -613, -526, -396, -312, -344, -340, -142, 86, 47, -240, -491, -674, -1093, -1782, -2219, -2015, -1570, -1549, -1909, -2010, -1611, -1159, -1005, -947, -752, -641, -876, -1205, -1147, -691, -288, -164, -43, 271, 497, 394, 275, 402, 253, -792, -2278, -3096, -2994, -2760, -2849, -2785, -2178, -1453, -1035, -509, 633, 1929, 2478, 2241, 1949, 1890, 1709, 1322, 1132, 1183, 891, -40, -1053, -1460, -1286, -960, -671, -526, -772, -1262, -1222, -211, 1130, 1824, 1663, 1198, 1001, 1226, 1586, 1642, 1214, 516, -115, -460, -361, 193, 866, 1126, 809, 362, 350, 784, 1089, 753, -157, -1164, -1873, -2281, -2680, -3143, -3146, -2222, -964, -448, -572, -168, 1059, 2102, 2267, 1844, 1169, 330, -308, -558, -1071, -2417, -3877, -4231, -3497, -2836, -2807, -2767, -2197, -1584, -1414, -1247, -530, 462, 1154, 1400, 1254, 737, 148, -90, -61, -213, -662, -1138, -1519, -1789, -1596, -597, 604, 918, 512, 801, 2054, 2613, 1426, -455, -1933, -3454, -5427, -6996, -7441, -7265, -7076, -6659, -5669, -4152, -2035, 828, 3666, 4925, 4206, 3039, 2703, 2348, 659, -1865, -3849, -5120, -6261, -7150, -7390, -7232, -7003, -6439, -5287, -3851, -2442, -985, 490, 1557, 2022, 2392, 3196, 4086, 4230, 3490, 2572, 1948, 1305, 213, -1162, -2236, -2612, -2343, -1762, -1207, -788, -273, 657, 1953, 3168, 3973, 4421, 4602, 4514, 4288, 4090, 3849, 3562, 3549, 3903, 4191, 4171, 4141, 4180, 3906, 3285, 2777, 2450, 1881, 1049, 445, 260, 227, 297, 775, 1663, 2489, 2996, 3479, 4156, 4708, 4831, 4631, 4139, 3192, 2139, 1677, 1649, 1050, -378, -1650, -2063, -2200, -2787, -3457, -3509, -3229, -3366, -3706, -3380, -2363, -1426, -821, -274, 67, -110, -472, -559, -707, -1511, -2810, -3966, -4778, -5460, -6036, -6338, -6490, -6786, -7111, -7039, -6587, -6228, -6114, -5912, -5498, -5143, -4928, -4600, -4104, -3709, -3541, -3444, -3389, -3610, -4137, -4634, -4961, -5452, -6284, -7055, -7376, -7398, -7319, -6920, -6083, -5209, -4681, -4307, -3700, -2904, -2348, -2288, -2550, -2774, -2791, -2697, -2607, -2499, -2351, -2267, -2313, -2419, -2531, -2662, -2737, -2657, -2555, -2612, -2693, -2529, -2140, -1680, -1145, -635, -445, -525, -366, 178, 572, 406, -34, -303, -322, -237, -178, -305, -747, -1393, -1928, -2111, -1992, -1871, -1989, -2195, -2145, -1829, -1509, -1144, -462, 324, 587, 237, -107, -82, -50, -421, -1108, -1809, -2396, -2862, -3176, -3286, -3191, -3006, -2871, -2750, -2449, -1958, -1529, -1289, -1081, -841, -766, -932, -1082, -1018, -912, -1073, -1573, -2208, -2677, -2853, -2873, -2900, -2845, -2573, -2216, -1939, -1589, -956, -214, 296, 529, 626, 581, 323, -26, -295, -490, -720, -981, -1168, -1243, -1235, -1129, -844, -403, 15, 244, 353, 566, 981, 1464, 1838, 2047, 2121, 2091, 2012, 1991, 2081, 2189, 2144, 1869, 1495, 1301, 1448, 1793, 2051, 2155, 2287, 2564, 2866, 3092, 3339, 3682, 3916, 3774, 3349, 3026, 2998, 3081, 3074, 3055, 3175, 3389, 3596, 3889, 4394, 4913, 5110, 4996, 4831, 4611, 4147, 3550, 3090, 2714, 2249, 1843, 1708, 1772, 2022, 2653, 3529, 4103, 4179, 4166, 4378, 4604, 4518, 4068, 3389, 2684, 2185, 1983, 1866, 1559, 1124, 917, 1126, 1497, 1690, 1716, 1842, 2084, 2138, 1939, 1907, 2344, 2896, 2960, 2440, 1735, 1225, 1038, 1110, 1148, 771, 13, -546, -421, 208, 808, 1197, 1620, 2159, 2516, 2508, 2422, 2590, 2785, 2448, 1460, 404, -85, 42, 381, 577, 575, 556, 772, 1297, 1889, 2258, 2394, 2439, 2415, 2301, 2175, 2089, 2012, 2006, 2192, 2440, 2404, 2030, 1741, 1910, 2334, 2501, 2243, 1810, 1454, 1310, 1533, 2059, 2416, 2287, 2025, 2132, 2531, 2818, 2893, 2883, 2788, 2595, 2460, 2487, 2543, 2480, 2342, 2198, 1958, 1583, 1308, 1308, 1324, 1028, 592, 430, 554, 700, 841, 1106, 1443, 1732, 1943, 2018, 1929, 1871, 1976, 1958, 1509, 833, 347, 73, -246, -641, -930, -1069, -1138, -1075, -760, -351, -181, -256, -200, 172, 585, 729, 626, 460, 349, 356, 433, 375, 83, -286, -575, -810, -996, -1057, -1054, -1161, -1306, -1183, -738, -333, -237, -222, 74, 555, 805, 698, 528, 523, 610, 682, 775, 874, 851, 698, 606, 668, 683, 468, 154, -30, -130, -316, -485, -361, 48, 406, 501, 532, 835, 1420, 1936, 2081, 1970, 1952, 2135, 2255, 2071, 1680, 1371, 1290, 1292, 1080, 547, -12, -198, -55, -52, -393, -684, -474, 147, 716, 974, 1046, 1161, 1416, 1763, 2032, 1984, 1608, 1242, 1135, 1041, 607, -18, -415, -532, -617, -713, -696, -619, -621, -590, -315, 86, 224, -42, -385, -437, -273, -261, -568, -989, -1220, -1164, -987, -913, -987, -1077, -1162, -1394, -1805, -2156, -2215, -2030, -1823, -1769, -1907, -2139, -2224, -1949, -1422, -1088, -1302, -1905, -2393, -2436, -2130, -1818, -1861, -2357, -2915, -2991, -2622, -2383, -2501, -2598, -2449, -2318, -2401, -2530, -2561, -2518, -2383, -2163, -2136, -2508, -2870, -2569, -1761, -1447, -2059, -2799, -2902, -2701, -2720, -2725, -2431, -2137, -2008, -1738, -1323, -1119, -1008, -560, -21, -64, -694, -1245, -1394, -1393, -1405, -1305, -1193, -1404, -1778, -1653, -940, -396, -413, -543, -529, -696, -1054, -1259, -1489, -2168, -2982, -3349, -3466, -3770, -3947, -3485, -2652, -2074, -1820, -1524, -1084, -729, -599, -636, -793, -1050, -1271, -1413, -1729, -2329, -2793, -2776, -2622, -2722, -2825, -2628, -2393, -2326, -2101, -1527, -875, -326, 138, 351, 261, 310, 752, 1083, 836, 327, 51, -53, -224, -335, -216, -48, -19, 99, 605, 1291, 1737, 1974, 2294, 2591, 2624, 2586, 2698, 2657, 2262, 1985, 2187, 2472, 2464, 2458, 2754, 3124, 3332, 3492, 3628, 3512, 3192, 3129, 3442, 3553, 3083, 2592, 2716, 3096, 3018, 2637, 2602, 2900, 3032, 2927, 2881, 2889, 2767, 2613, 2597, 2532, 2172, 1764, 1717, 1821, 1487, 761, 305, 311, 325, 173, 105, 111, -31, -172, -41, 182, 214, 145, 111, -87, -578, -1073, -1310, -1505, -1985, -2610, -2950, -2933, -2902, -3024, -3073, -2880, -2581, -2353, -2232, -2217, -2250, -2225, -2212, -2429, -2857, -3172, -3203, -3135, -3178, -3316, -3436, -3428, -3242, -2993, -2910, -3023, -3096, -2979, -2829, -2837, -2919, -2840, -2564, -2261, -2038, -1827, -1580, -1370, -1250, -1181, -1128, -1085, -1016, -886, -785, -830, -986, -1072, -1005, -903, -864, -827, -719, -574, -401, -123, 207, 409, 499, 716, 1092, 1368, 1404, 1359, 1351, 1303, 1153, 975, 792, 507, 152, -46, -3, 35, -121, -274, -144, 187, 467, 646, 790, 850, 793, 717, 649, 488, 226, -16, -212, -463, -780, -1032, -1119, -1076, -1046, -1169, -1439, -1657, -1616, -1366, -1210, -1405, -1863, -2218, -2194, -1898, -1681, -1746, -1949, -2017, -1894, -1755, -1715, -1687, -1629, -1734, -2124, -2523, -2573, -2380, -2369, -2660, -2932, -2923, -2716, -2506, -2322, -2060, -1685, -1358, -1265, -1309, -1166, -781, -528, -680, -987, -1055, -915, -892, -1064, -1193, -1163, -1136, -1193, -1122, -758, -311, -100, -61, 154, 639, 1080, 1228, 1231, 1331, 1466, 1417, 1216, 1147, 1305, 1448, 1396, 1309, 1420, 1690, 1937, 2119, 2260, 2292, 2206, 2229, 2533, 2894, 2923, 2602, 2357, 2535, 2974, 3219, 3067, 2761, 2651, 2818, 3077, 3252, 3279, 3163, 2963, 2792, 2717, 2690, 2644, 2572, 2465, 2264, 1974, 1732, 1661, 1718, 1763, 1706, 1578, 1494, 1562, 1783, 2025, 2099, 1905, 1530, 1184, 1011, 929, 700, 195, -444, -931, -1077, -930, -713, -633, -683, -646, -348, 100, 402, 376, 118, -160, -368, -602, -989, -1487, -1882, -2023, -1985, -1947, -1955, -1871, -1582, -1193, -954, -991, -1160, -1200, -1023, -821, -853, -1104, -1242, -1029, -670, -556, -754, -974, -1030, -1024, -1102, -1256, -1390, -1419, -1307, -1107, -900, -667, -343, -8, 126, 31, -28, 159, 392, 291, -140, -478, -421, -95, 217, 388, 450, 523, 755, 1150, 1494, 1584, 1454, 1277, 1144, 1050, 978, 927, 923, 1005, 1195, 1487, 1869, 2277, 2568, 2688, 2783, 2968, 3085, 2943, 2635, 2390, 2267, 2221, 2239, 2278, 2303, 2418, 2703, 2974, 3057, 3080, 3200, 3301, 3282, 3300, 3423, 3479, 3405, 3367, 3423, 3435, 3392, 3417, 3450, 3269, 2837, 2402, 2200, 2229, 2345, 2442, 2488, 2529, 2691, 3092, 3635, 4058, 4240, 4245, 4076, 3680, 3185, 2802, 2548, 2323, 2074, 1749, 1354, 1198, 1571, 2161, 2356, 2150, 2095, 2331, 2375, 1992, 1621, 1673, 1905, 1871, 1649, 1656, 1980, 2342, 2567, 2634, 2484, 2169, 1959, 1932, 1815, 1479, 1169, 1044, 954, 841, 890, 1132, 1288, 1167, 924, 795, 791, 794, 799, 878, 999, 1096, 1211, 1403, 1589, 1636, 1517, 1242, 762, 141, -329, -469, -583, -1135, -1989, -2404, -1969, -1152, -652, -572, -509, -205, 200, 402, 265, -20, -138, -55, -135, -647, -1257, -1313, -745, -259, -418, -887, -994, -683, -443, -534, -775, -912, -883, -777, -726, -739, -649, -399, -225, -331, -539, -525, -320, -289, -633, -1147, -1505, -1633, -1720, -1948, -2328, -2721, -2948, -2951, -2892, -2961, -3142, -3283, -3366, -3481, -3580, -3499, -3271, -3155, -3239, -3248, -2988, -2709, -2735, -2955, -3090, -3219, -3618, -4215, -4681, -4926, -5130, -5377, -5552, -5560, -5422, -5170, -4801, -4336, -3866, -3496, -3252, -3106, -3020, -2991, -3055, -3233, -3450, -3594, -3679, -3826, -4007, -4035, -3874, -3715, -3671, -3627, -3510, -3394, -3281, -3027, -2626, -2345, -2352, -2399, -2167, -1755, -1521, -1536, -1555, -1512, -1622, -1935, -2142, -2027, -1822, -1846, -2005, -1954, -1645, -1358, -1237, -1144, -951, -717, -559, -524, -574, -597, -539, -504, -564, -600, -519, -436, -416, -302, -59, 32, -187, -408, -289, -14, -29, -335, -516, -418, -325, -351, -244, 48, 204, 125, 150, 446, 698, 634, 439, 391, 431, 338, 115, -53, -118, -205, -362, -465, -430, -347, -330, -362, -346, -231, -72, 28, 49, 75, 185, 322, 329, 165, -19, -89, -134, -290, -508, -691, -904, -1129, -1094, -735, -443, -472, -478, -134, 290, 386, 244, 195, 261, 252, 126, -20, -181, -374, -474, -370, -208, -214, -301, -168, 203, 467, 414, 256, 279, 457, 584, 611, 649, 731, 782, 776, 754, 735, 747, 828, 902, 807, 572, 443, 516, 593, 544, 532, 710, 900, 844, 651, 673, 965, 1201, 1147, 915, 717, 666, 794, 1004, 1043, 792, 488, 429, 600, 771, 837, 833, 741, 519, 280, 245, 434, 596, 526, 287, 71, 25, 225, 594, 858, 787, 502, 322, 373, 523, 616, 571, 362, 54, -204, -278, -147, 44, 60, -166, -354, -212, 112, 251, 203, 257, 400, 330, 51, -71, 107, 278, 147, -152, -284, -135, 98, 194, 147, 106, 158, 261, 323, 322, 309, 339, 399, 427, 404, 391, 452, 573, 673, 694, 666, 690, 799, 901, 934, 984, 1129, 1273, 1299, 1264, 1291, 1387, 1487, 1556, 1546, 1452, 1416, 1564, 1772, 1827, 1757, 1768, 1927, 2135, 2327, 2501, 2599, 2565, 2501, 2567, 2698, 2654, 2422, 2304, 2454, 2605, 2476, 2228, 2255, 2626, 3026, 3189, 3165, 3136, 3189, 3323, 3485, 3537, 3357, 3042, 2838, 2810, 2812, 2766, 2768, 2859, 2893, 2800, 2771, 2980, 3281, 3401, 3317, 3190, 3038, 2797, 2605, 2677, 2918, 2960, 2613, 2104, 1857, 2054, 2449, 2592, 2284, 1776, 1489, 1563, 1748, 1776, 1658, 1538, 1435, 1349, 1372, 1459, 1382, 1121, 947, 902, 689, 279, 79, 241, 356, 125, -139, -47, 233, 255, -4, -145, -10, 81, -144, -533, -778, -822, -857, -1039, -1293, -1395, -1269, -1180, -1398, -1734, -1727, -1350, -1164, -1546, -2094, -2180, -1871, -1778, -2077, -2294, -2142, -1953, -2064, -2298, -2325, -2173, -2123, -2305, -2612, -2862, -2930, -2819, -2647, -2577, -2682, -2828, -2753, -2418, -2172, -2313, -2614, -2667, -2543, -2591, -2767, -2771, -2667, -2723, -2803, -2580, -2194, -2099, -2346, -2534, -2440, -2306, -2429, -2766, -3079, -3229, -3198, -3035, -2883, -2851, -2798, -2517, -2138, -1988, -2079, -2113, -1994, -1943, -2102, -2360, -2580, -2746, -2831, -2770, -2629, -2606, -2734, -2767, -2526, -2181, -2009, -2034, -2082, -2047, -1937, -1779, -1629, -1579, -1650, -1732, -1738, -1712, -1753, -1846, -1888, -1867, -1893, -2016, -2135, -2091, -1821, -1444, -1195, -1194, -1257, -1087, -689, -400, -459, -724, -901, -887, -787, -698, -640, -620, -661, -702, -616, -349, -17, 183, 162, 12, -67, 27, 213, 328, 343, 368, 462, 561, 635, 803, 1146, 1482, 1531, 1309, 1139, 1235, 1445, 1487, 1293, 1012, 830, 850, 1050, 1295, 1439, 1464, 1482, 1598, 1797, 2000, 2146, 2193, 2134, 2055, 2065, 2094, 1971, 1738, 1667, 1843, 1983, 1839, 1577, 1549, 1789, 1991, 1955, 1862, 1977, 2258, 2424, 2361, 2263, 2319, 2457, 2465, 2296, 2071, 1883, 1720, 1581, 1518, 1546, 1576, 1500, 1368, 1404, 1727, 2099, 2171, 1974, 1856, 1946, 2019, 1927, 1767, 1618, 1442, 1257, 1134, 1088, 1143, 1332, 1542, 1567, 1406, 1280, 1317, 1442, 1527, 1461, 1144, 650, 344, 540, 994, 1107, 791, 654, 1055, 1554, 1739, 1859, 2159, 2292, 2001, 1677, 1677, 1716, 1428, 990, 729, 574, 311, 92, 258, 763, 1162, 1192, 1069, 1102, 1301, 1518, 1708, 1807, 1625, 1144, 768, 918, 1414, 1592, 1149, 598, 581, 1000, 1229, 1075, 916, 940, 923, 795, 723, 679, 599, 717, 1057, 995, 143, -712, -505, 544, 1182, 904, 519, 734, 1211, 1487, 1770, 2109, 1985, 1360, 866, 443, -709, -2421, -3474, -3599, -3844, -4655, -5149, -4605, -3442, -2340, -1312, -37, 1382, 2421, 2706, 2335, 1664, 968, 271, -672, -2135, -3940, -5365, -5789, -5345, -4716, -4332, -4031, -3457, -2576, -1614, -668, 356, 1371, 1959, 1839, 1291, 900, 943, 1197, 1167, 441, -887, -2074, -2362, -1898, -1554, -1745, -1921, -1422, -352, 671, 1335, 1831, 2415, 3045, 3488, 3599, 3409, 2995, 2485, 2117, 1972, 1746, 1167, 605, 658, 1196, 1548, 1556, 1633, 1875, 2001, 2027, 2198, 2408, 2405, 2333, 2474, 2746, 2883, 2871, 2901, 3013, 3018, 2688, 2022, 1329, 936, 770, 386, -442, -1300, -1547, -1139, -695, -676, -810, -579, -18, 374, 417, 463, 698, 748, 261, -504, -1108, -1543, -2042, -2608, -3159, -3770, -4437, -4896, -4958, -4763, -4546, -4381, -4234, -4024, -3652, -3133, -2686, -2540, -2680, -2891, -3068, -3329, -3785, -4369, -4951, -5470, -5868, -6087, -6192, -6284, -6263, -5960, -5490, -5168, -5060, -4885, -4490, -4116, -4012, -4045, -3987, -3944, -4076, -4171, -4001, -3800, -3899, -4152, -4233, -4163, -4157, -4255, -4396, -4535, -4533, -4264, -3875, -3582, -3317, -2902, -2392, -1971, -1673, -1415, -1156, -918, -792, -893, -1193, -1496, -1677, -1771, -1793, -1749, -1790, -2002, -2091, -1722, -1079, -666, -618, -601, -340, 97, 533, 842, 899, 640, 251, 76, 243, 475, 417, 89, -183, -239, -233, -241, -85, 241, 363, 88, -172, 26, 496, 733, 640, 495, 474, 532, 611, 687, 705, 618, 452, 296, 234, 242, 199, 54, -64, -50, -20, -124, -273, -265, -121, -61, -188, -362, -393, -259, -98, -34, -27, 52, 210, 301, 245, 126, 29, -54, -140, -203, -292, -513, -826, -1002, -883, -606, -416, -372, -360, -337, -311, -180, 128, 439, 497, 342, 254, 380, 608, 766, 777, 664, 525, 462, 493, 543, 555, 555, 555, 503, 434, 551, 957, 1404, 1589, 1580, 1684, 1982, 2289, 2487, 2601, 2633, 2560, 2471, 2497, 2593, 2580, 2419, 2281, 2314, 2432, 2483, 2483, 2562, 2742, 2907, 3008, 3130, 3339, 3566, 3717, 3801, 3876, 3975, 4099, 4205, 4200, 4065, 3936, 3891, 3791, 3497, 3143, 2946, 2906, 2865, 2788, 2768, 2856, 3034, 3304, 3670, 4034, 4265, 4356, 4401, 4421, 4349, 4183, 4002, 3790, 3426, 2914, 2462, 2264, 2290, 2346, 2260, 2016, 1758, 1733, 2053, 2480, 2589, 2297, 2024, 2149, 2494, 2626, 2459, 2301, 2317, 2306, 2030, 1587, 1286, 1215, 1114, 724, 140, -272, -295, -86, 49, 29, 41, 245, 570, 853, 1029, 1093, 1003, 765, 522, 386, 245, -90, -557, -828, -728, -488, -460, -674, -831, -705, -402, -199, -264, -560, -896, -1013, -808, -527, -513, -723, -770, -513, -263, -306, -514, -588, -478, -384, -487, -768, -1022, -1035, -814, -623, -712, -969, -1024, -747, -443, -415, -572, -659, -618, -537, -456, -392, -371, -368, -372, -434, -506, -447, -305, -347, -630, -884, -913, -841, -848, -940, -1043, -1091, -1011, -782, -542, -480, -625, -811, -869, -801, -750, -848, -1114, -1400, -1477, -1301, -1133, -1223, -1446, -1519, -1446, -1412, -1426, -1399, -1431, -1624, -1777, -1636, -1354, -1317, -1553, -1682, -1499, -1280, -1320, -1522, -1650, -1723, -1864, -1982, -1921, -1775, -1781, -1950, -2062, -1996, -1855, -1749, -1680, -1661, -1734, -1823, -1758, -1551, -1411, -1464, -1602, -1656, -1565, -1381, -1234, -1244, -1375, -1435, -1325, -1214, -1313, -1522, -1519, -1221, -937, -929, -1050, -993, -730, -494, -440, -497, -528, -470, -340, -207, -172, -263, -340, -211, 92, 291, 204, 34, 110, 404, 550, 371, 105, 33, 159, 349, 537, 670, 689, 687, 883, 1302, 1640, 1610, 1304, 1089, 1153, 1283, 1177, 859, 658, 786, 1095, 1286, 1303, 1355, 1588, 1834, 1816, 1531, 1289, 1359, 1665, 1900, 1865, 1647, 1500, 1612, 1959, 2304, 2334, 1921, 1302, 929, 1023, 1308, 1309, 913, 524, 581, 1031, 1423, 1483, 1409, 1537, 1867, 2081, 1928, 1496, 1099, 972, 1066, 1079, 748, 200, -34, 360, 930, 906, 299, -105, 96, 469, 560, 443, 339, 343, 538, 834, 866, 555, 359, 558, 753, 498, -53, -496, -735, -857, -779, -437, -107, -82, -164, 59, 518, 776, 744, 665, 570, 360, 144, -57, -479, -1058, -1288, -1054, -883, -1055, -1190, -968, -605, -384, -273, -147, -25, 25, 3, -75, -186, -202, -19, 150, -70, -634, -990, -840, -513, -400, -509, -724, -968, -1043, -790, -392, -110, 33, 13, -287, -648, -574, -56, 304, 111, -439, -977, -1264, -1139, -663, -243, -251, -560, -736, -567, -199, 173, 450, 489, 181, -253, -443, -401, -451, -622, -672, -655, -825, -1062, -1040, -792, -571, -441, -435, -721, -1216, -1476, -1324, -1196, -1520, -2083, -2367, -2269, -2114, -2064, -1940, -1618, -1169, -660, -200, -67, -337, -616, -597, -574, -934, -1529, -1961, -2150, -2244, -2268, -2143, -1851, -1402, -817, -252, 65, 144, 293, 705, 1139, 1258, 1092, 849, 555, 236, 145, 381, 581, 386, -13, -148, 154, 677, 1109, 1318, 1434, 1718, 2242, 2751, 2951, 2900, 2928, 3129, 3181, 2805, 2223, 1875, 1848, 1836, 1592, 1231, 1097, 1429, 2104, 2689, 2890, 2870, 2980, 3274, 3508, 3494, 3274, 3009, 2842, 2798, 2732, 2455, 1988, 1610, 1525, 1582, 1486, 1230, 1049, 1003, 928, 791, 778, 927, 1021, 943, 858, 879, 815, 523, 245, 246, 309, 47, -448, -790, -919, -1075, -1342, -1639, -1939, -2170, -2186, -2081, -2191, -2582, -2885, -2815, -2587, -2557, -2720, -2811, -2767, -2738, -2739, -2683, -2669, -2855, -3159, -3462, -3814, -4186, -4360, -4373, -4564, -4955, -5122, -4876, -4488, -4178, -3921, -3773, -3857, -4016, -3906, -3521, -3279, -3535, -4121, -4511, -4395, -4018, -3840, -3966, -4070, -3886, -3583, -3491, -3608, -3617, -3413, -3262, -3299, -3238, -2845, -2413, -2356, -2564, -2553, -2168, -1757, -1655, -1783, -1868, -1868, -1973, -2193, -2224, -1896, -1531, -1499, -1623, -1443, -947, -548, -439, -430, -371, -329, -352, -351, -253, -113, -100, -303, -484, -281, 219, 478, 274, 31, 127, 354, 373, 292, 375, 516, 445, 285, 432, 909, 1252, 1168, 968, 1081, 1438, 1617, 1432, 1108, 930, 896, 803, 602, 503, 648, 820, 741, 543, 616, 1046, 1496, 1681, 1658, 1621, 1624, 1600, 1516, 1430, 1379, 1252, 925, 545, 418, 546, 571, 370, 288, 593, 1054, 1289, 1244, 1129, 1117, 1222, 1333, 1328, 1223, 1142, 1091, 941, 672, 468, 453, 491, 379, 140, -19, 4, 146, 350, 620, 887, 1011, 985, 963, 1033, 1107, 1045, 804, 461, 164, -2, -85, -162, -170, -7, 246, 376, 339, 374, 671, 1059, 1199, 1018, 767, 662, 671, 699, 755, 863, 917, 804, 601, 566, 849, 1260, 1425, 1205, 920, 1022, 1547, 2001, 1965, 1663, 1661, 2077, 2433, 2332, 1941, 1676, 1684, 1808, 1906, 1994, 2153, 2395, 2645, 2800, 2835, 2858, 2999, 3198, 3204, 2890, 2428, 2082, 1959, 2019, 2160, 2259, 2311, 2487, 2842, 3153, 3285, 3483, 3933, 4263, 3961, 3182, 2650, 2676, 2763, 2390, 1791, 1559, 1761, 1951, 1958, 2112, 2570, 2921, 2802, 2488, 2433, 2533, 2359, 1908, 1600, 1618, 1721, 1617, 1307, 1063, 1150, 1466, 1552, 1148, 582, 338, 416, 415, 201, 69, 154, 177, 36, 98, 480, 665, 353, 1, -32, -104, -506, -904, -1011, -1085, -1333, -1496, -1383, -1219, -1180, -1067, -781, -680, -1002, -1335, -1260, -1108, -1366, -1770, -1800, -1598, -1584, -1654, -1516, -1333, -1385, -1541, -1515, -1330, -1242, -1449, -1898, -2231, -2063, -1494, -1112, -1256, -1538, -1400, -933, -719, -930, -1103, -924, -740, -938, -1251, -1169, -763, -566, -709, -757, -470, -181, -197, -314, -270, -244, -490, -808, -806, -481, -217, -238, -346, -213, 167, 488, 516, 392, 455, 739, 821, 360, -251, -302, 154, 331, -33, -278, 30, 450, 537, 491, 563, 607, 506, 468, 599, 680, 561, 415, 467, 662, 798, 837, 887, 910, 695, 229, -150, -189, -111, -309, -721, -842, -421, 157, 419, 443, 672, 1174, 1489, 1280, 819, 569, 475, 117, -520, -923, -842, -658, -667, -602, -184, 331, 610, 741, 921, 982, 684, 203, -98, -220, -438, -747, -829, -592, -294, -62, 251, 659, 910, 876, 722, 637, 620, 531, 240, -222, -605, -649, -429, -306, -432, -486, -178, 206, 193, -108, -171, 77, 214, 121, 156, 438, 610, 469, 302, 362, 442, 236, -171, -510, -778, -1116, -1393, -1322, -943, -597, -483, -455, -231, 348, 1109, 1556, 1315, 604, 19, -157, -209, -538, -1148, -1639, -1694, -1477, -1402, -1493, -1297, -612, 68, 176, -139, -244, 89, 447, 397, 5, -384, -626, -798, -935, -958, -871, -829, -991, -1314, -1551, -1477, -1178, -982, -988, -887, -425, 117, 272, 145, 336, 960, 1301, 810, -49, -512, -649, -1091, -1853, -2275, -2138, -2023, -2283, -2377, -1752, -817, -354, -364, -255, 99, 227, -149, -760, -1235, -1502, -1754, -2190, -2721, -2962, -2652, -2020, -1514, -1189, -732, -124, 165, -77, -352, -211, -22, -359, -984, -1180, -925, -860, -1104, -965, -187, 407, 188, -191, 171, 990, 1381, 1246, 1135, 1227, 1314, 1370, 1498, 1637, 1677, 1616, 1471, 1310, 1311, 1549, 1809, 1861, 1828, 2020, 2457, 2852, 3073, 3274, 3467, 3432, 3213, 3176, 3332, 3208, 2639, 2120, 2079, 2325, 2457, 2446, 2539, 2862, 3282, 3594, 3726, 3753, 3732, 3584, 3236, 2817, 2566, 2534, 2473, 2152, 1704, 1486, 1605, 1793, 1792, 1659, 1594, 1615, 1560, 1328, 1061, 981, 1014, 825, 356, 29, 123, 284, 90, -257, -338, -280, -527, -1043, -1354, -1330, -1396, -1877, -2462, -2615, -2333, -2177, -2484, -2889, -2864, -2515, -2442, -2868, -3321, -3320, -3071, -3129, -3563, -3888, -3837, -3735, -3938, -4325, -4573, -4665, -4832, -5149, -5408, -5371, -5080, -4843, -4819, -4766, -4438, -4065, -4029, -4234, -4283, -4178, -4323, -4815, -5230, -5282, -5236, -5423, -5644, -5463, -4900, -4425, -4312, -4336, -4152, -3697, -3240, -3132, -3410, -3671, -3555, -3263, -3263, -3570, -3756, -3613, -3394, -3310, -3204, -2919, -2659, -2640, -2666, -2419, -2009, -1797, -1827, -1834, -1685, -1473, -1312, -1263, -1327, -1369, -1249, -1075, -1073, -1209, -1214, -1019, -896, -1014, -1129, -944, -586, -387, -375, -313, -130, 66, 271, 503, 638, 571, 416, 355, 441, 598, 631, 368, -33, -148, 140, 459, 540, 560, 709, 859, 897, 965, 1194, 1462, 1559, 1429, 1212, 1118, 1199, 1273, 1202, 1118, 1173, 1207, 969, 621, 625, 1042, 1326, 1109, 797, 961, 1431, 1617, 1475, 1452, 1650, 1686, 1385, 1025, 894, 945, 922, 684, 446, 554, 959, 1190, 1045, 920, 1148, 1430, 1317, 940, 783, 922, 959, 704, 486, 619, 902, 944, 785, 808, 1120, 1380, 1300, 1025, 839, 717, 453, 133, 128, 521, 841, 681, 337, 459, 1110, 1628, 1516, 1110, 1063, 1424, 1602, 1238, 756, 800, 1311, 1594, 1332, 1002, 1074, 1353, 1467, 1468, 1531, 1519, 1320, 1239, 1580, 2112, 2346, 2211, 2098, 2270, 2537, 2615, 2521, 2432, 2334, 2063, 1643, 1364, 1471, 1822, 1976, 1771, 1649, 2072, 2805, 3228, 3227, 3184, 3210, 3051, 2694, 2470, 2462, 2379, 2058, 1745, 1753, 2080, 2480, 2747, 2829, 2782, 2733, 2783, 2867, 2784, 2463, 2079, 1808, 1604, 1395, 1360, 1713, 2245, 2482, 2350, 2265, 2433, 2554, 2343, 1943, 1585, 1301, 1042, 807, 617, 574, 777, 1082, 1200, 1137, 1170, 1340, 1380, 1201, 1022, 976, 909, 700, 494, 491, 676, 848, 882, 845, 820, 734, 509, 285, 212, 137, -145, -421, -349, -89, -56, -156, 55, 565, 876, 741, 413, 191, 103, -20, -304, -638, -777, -754, -840, -957, -652, 65, 469, 117, -413, -352, 127, 215, -302, -796, -790, -603, -695, -908, -804, -435, -260, -392, -463, -257, -93, -338, -802, -967, -736, -606, -929, -1343, -1265, -727, -322, -378, -587, -566, -402, -431, -697, -948, -1053, -1119, -1213, -1227, -1103, -937, -822, -711, -541, -359, -262, -267, -377, -602, -829, -873, -770, -779, -887, -769, -370, -62, -28, -18, 107, 149, 41, -8, 15, -143, -526, -781, -653, -350, -224, -263, -143, 237, 533, 419, 87, -20, 132, 143, -171, -491, -466, -184, 40, 107, 179, 414, 735, 914, 901, 925, 1071, 989, 428, -182, -224, 187, 338, -39, -417, -293, 151, 478, 644, 830, 965, 888, 766, 839, 949, 792, 465, 324, 464, 689, 867, 1007, 1078, 989, 753, 536, 495, 582, 549, 186, -356, -554, 0, 983, 1555, 1385, 1084, 1281, 1730, 1785, 1373, 942, 693, 409, -32, -356, -215, 258, 472, 176, -30, 472, 1255, 1400, 926, 668, 824, 708, 86, -324, -36, 358, 84, -604, -762, -120, 518, 379, -306, -752, -682, -547, -749, -1092, -1152, -936, -836, -937, -804, -187, 423, 386, -208, -685, -702, -599, -817, -1321, -1716, -1765, -1607, -1452, -1234, -808, -354, -227, -388, -458, -346, -344, -538, -638, -502, -393, -571, -925, -1130, -990, -630, -443, -729, -1283, -1527, -1188, -704, -659, -940, -862, -172, 514, 555, 159, 33, 360, 612, 347, -246, -733, -988, -1140, -1220, -1159, -1028, -1003, -1116, -1187, -1016, -587, -106, 102, -180, -826, -1431, -1696, -1693, -1657, -1684, -1796, -2089, -2511, -2655, -2156, -1273, -724, -854, -1263, -1383, -1164, -966, -1025, -1286, -1625, -1922, -2035, -1951, -1855, -1880, -1916, -1770, -1444, -1129, -988, -990, -912, -587, -167, -5, -213, -471, -444, -259, -285, -502, -519, -280, -249, -627, -905, -565, 149, 611, 634, 553, 648, 829, 917, 1002, 1306, 1701, 1687, 1068, 402, 402, 999, 1431, 1279, 968, 1061, 1459, 1699, 1743, 1905, 2179, 2225, 2022, 1915, 2008, 2041, 1896, 1775, 1844, 2012, 2090, 2013, 1928, 2046, 2305, 2367, 2107, 1841, 1839, 1914, 1775, 1530, 1472, 1581, 1568, 1345, 1171, 1284, 1599, 1862, 1972, 1993, 1951, 1796, 1577, 1447, 1419, 1273, 814, 204, -156, -153, -134, -353, -506, -243, 154, 199, 15, 82, 404, 584, 500, 317, 63, -296, -619, -793, -980, -1354, -1798, -2051, -2069, -2013, -1972, -1868, -1650, -1381, -1145, -1006, -1026, -1142, -1176, -1146, -1327, -1809, -2290, -2522, -2585, -2597, -2568, -2600, -2815, -3016, -2838, -2323, -1958, -2044, -2304, -2272, -1893, -1574, -1680, -2112, -2453, -2431, -2180, -2040, -2182, -2456, -2637, -2677, -2604, -2395, -2128, -2074, -2316, -2521, -2395, -2135, -2096, -2246, -2278, -2113, -1961, -1973, -2038, -1974, -1784, -1677, -1839, -2193, -2426, -2328, -2099, -2165, -2605, -2981, -2916, -2579, -2349, -2263, -2130, -1957, -1877, -1839, -1675, -1428, -1338, -1526, -1796, -1839, -1656, -1637, -2050, -2558, -2592, -2136, -1750, -1783, -1957, -1848, -1456, -1093, -925, -831, -678, -521, -473, -485, -411, -280, -323, -667, -1100, -1292, -1226, -1209, -1376, -1452, -1208, -870, -695, -483, 35, 606, 772, 551, 330, 307, 363, 341, 149, -199, -551, -740, -757, -676, -490, -204, 25, 31, -99, -91, 169, 483, 602, 480, 234, 38, 105, 463, 742, 521, -23, -214, 222, 758, 779, 377, 69, 0, -64, -121, 128, 657, 1011, 986, 899, 1069, 1395, 1589, 1534, 1311, 1069, 891, 713, 432, 93, -87, 36, 369, 675, 846, 1011, 1339, 1756, 1967, 1835, 1603, 1598, 1792, 1855, 1606, 1249, 1075, 1111, 1172, 1140, 1053, 976, 954, 1034, 1214, 1354, 1322, 1180, 1162, 1459, 2016, 2482, 2469, 2019, 1706, 2002, 2614, 2752, 2143, 1433, 1301, 1542, 1506, 1117, 829, 830, 980, 1274, 1734, 2083, 2125, 2112, 2299, 2517, 2551, 2512, 2499, 2310, 1834, 1419, 1474, 1880, 2179, 2211, 2189, 2212, 2189, 2186, 2324, 2423, 2226, 1843, 1569, 1483, 1546, 1822, 2249, 2485, 2354, 2199, 2475, 3092, 3495, 3331, 2784, 2218, 1806, 1597, 1613, 1746, 1775, 1643, 1544, 1656, 1950, 2274, 2478, 2468, 2260, 1986, 1789, 1716, 1694, 1605, 1438, 1343, 1420, 1522, 1468, 1362, 1388, 1408, 1178, 833, 707, 762, 620, 188, -187, -207, 27, 196, 138, -32, -99, 9, 155, 138, -59, -232, -232, -204, -374, -673, -847, -847, -837, -905, -1042, -1232, -1360, -1279, -1134, -1215, -1440, -1458, -1216, -954, -741, -521, -411, -495, -574, -514, -506, -683, -839, -829, -899, -1259, -1630, -1635, -1441, -1506, -1770, -1760, -1411, -1126, -1017, -829, -520, -261, -9, 287, 340, -39, -503, -682, -819, -1309, -1922, -2047, -1616, -1213, -1176, -1133, -646, 123, 696, 829, 590, 215, 30, 148, 229, -117, -754, -1154, -1020, -534, -85, 64, -49, -144, 15, 355, 600, 612, 515, 460, 448, 427, 442, 561, 719, 794, 780, 707, 511, 157, -179, -288, -233, -309, -618, -835, -522, 293, 1003, 1065, 672, 549, 972, 1350, 963, -83, -962, -1129, -900, -932, -1331, -1556, -1187, -472, 24, 124, 106, 212, 377, 435, 355, 200, 42, -14, 84, 177, -27, -487, -710, -401, 37, -5, -558, -1113, -1259, -969, -486, -170, -214, -297, 156, 1192, 2088, 2218, 1866, 1713, 1767, 1479, 766, 97, -379, -876, -1249, -1171, -836, -613, -297, 477, 1430, 2001, 2191, 2406, 2751, 2971, 2865, 2408, 1654, 824, 316, 245, 149, -442, -1178, -1213, -375, 578, 997, 1061, 1295, 1833, 2413, 2791, 2902, 2749, 2384, 1943, 1528, 1100, 609, 157, -152, -378, -580, -662, -495, -74, 521, 1154, 1604, 1743, 1739, 1870, 2134, 2220, 1904, 1329, 838, 613, 555, 489, 389, 328, 287, 187, 91, 199, 558, 859, 740, 288, -5, 126, 383, 368, 139, 44, 188, 387, 506, 611, 796, 1008, 1063, 845, 461, 165, 47, -85, -446, -959, -1301, -1239, -874, -543, -473, -538, -371, 222, 940, 1207, 832, 267, 3, -61, -313, -776, -1203, -1478, -1529, -1279, -968, -1009, -1287, -1252, -840, -615, -876, -1303, -1600, -1868, -2193, -2403, -2423, -2463, -2586, -2500, -2138, -1921, -2015, -1919, -1352, -838, -830, -1051, -1199, -1447, -1823, -2026, -2099, -2421, -2924, -3119, -2906, -2637, -2450, -2131, -1628, -1183, -902, -599, -174, 170, 266, 202, 18, -402, -928, -1185, -1141, -1170, -1431, -1724, -1864, -1701, -1083, -234, 322, 537, 852, 1308, 1524, 1546, 1746, 1957, 1708, 1132, 765, 645, 410, 84, 8, 142, 141, 109, 557, 1414, 1913, 1791, 1750, 2259, 2858, 3048, 2936, 2662, 2214, 1879, 1956, 2121, 1929, 1574, 1409, 1303, 1095, 1043, 1252, 1312, 997, 747, 994, 1451, 1555, 1376, 1515, 2132, 2628, 2498, 2034, 1864, 2083, 2171, 1641, 661, -48, -75, 109, -167, -788, -1155, -1131, -952, -605, -99, 137, -82, -209, 201, 695, 642, 212, -5, 32, -135, -692, -1315, -1733, -2068, -2510, -2995, -3352, -3496, -3379, -3053, -2746, -2577, -2328, -1822, -1256, -892, -767, -893, -1292, -1786, -2179, -2610, -3250, -3858, -4150, -4268, -4439, -4529, -4350, -4005, -3701, -3526, -3486, -3446, -3105, -2439, -1946, -2068, -2534, -2692, -2402, -2182, -2487, -3187, -3838, -4201, -4312, -4299, -4314, -4461, -4608, -4413, -3782, -3121, -2876, -2916, -2744, -2261, -1903, -1955, -2198, -2386, -2571, -2792, -2884, -2871, -3100, -3696, -4221, -4207, -3817, -3579, -3620, -3565, -3214, -2852, -2737, -2657, -2251, -1572, -1092, -1167, -1647, -2033, -1998, -1716, -1653, -2043, -2615, -2936, -2941, -2865, -2739, -2405, -2028, -1973, -2103, -1867, -1205, -697, -656, -746, -608, -350, -227, -255, -252, -122, -40, -290, -825, -1183, -1062, -777, -820, -1166, -1325, -1015, -437, 88, 475, 764, 981, 1239, 1658, 2003, 1840, 1231, 754, 640, 487, 53, -330, -372, -242, -186, -153, 5, 325, 764, 1222, 1509, 1518, 1425, 1504, 1715, 1768, 1636, 1641, 1834, 1797, 1330, 862, 837, 1087, 1146, 850, 453, 338, 672, 1186, 1459, 1498, 1685, 2110, 2403, 2338, 2141, 2066, 2050, 1901, 1578, 1247, 1155, 1368, 1632, 1649, 1488, 1471, 1667, 1815, 1767, 1698, 1757, 1757, 1492, 1145, 1068, 1250, 1389, 1376, 1395, 1592, 1952, 2373, 2627, 2453, 1941, 1578, 1652, 1819, 1558, 892, 380, 430, 890, 1371, 1677, 1820, 1903, 2082, 2428, 2770, 2890, 2791, 2580, 2258, 1886, 1708, 1839, 2052, 2092, 1971, 1815, 1698, 1726, 2027, 2512, 2828, 2724, 2373, 2231, 2550, 3104, 3415, 3230, 2745, 2401, 2476, 2866, 3235, 3335, 3156, 2805, 2406, 2113, 2088, 2335, 2634, 2667, 2296, 1753, 1518, 1888, 2616, 3106, 3004, 2509, 2123, 2153, 2510, 2862, 2920, 2626, 2172, 1857, 1863, 2131, 2405, 2413, 2029, 1394, 881, 806, 1083, 1306, 1196, 865, 633, 774, 1360, 2114, 2527, 2350, 1932, 1796, 1991, 2112, 1860, 1319, 717, 165, -264, -457, -399, -260, -185, -128, 16, 254, 541, 819, 949, 806, 505, 331, 356, 307, -21, -421, -551, -424, -326, -364, -408, -414, -461, -554, -667, -876, -1186, -1396, -1370, -1249, -1213, -1190, -1021, -756, -573, -466, -260, 45, 174, -70, -551, -938, -1017, -806, -550, -566, -922, -1302, -1370, -1201, -1179, -1498, -1924, -2079, -1884, -1625, -1505, -1267, -561, 399, 969, 943, 786, 863, 895, 420, -542, -1553, -2242, -2533, -2539, -2431, -2318, -2102, -1547, -650, 207, 705, 973, 1251, 1399, 1132, 506, -141, -593, -829, -908, -972, -1189, -1521, -1697, -1513, -1076, -676, -491, -445, -310, 84, 703, 1318, 1684, 1734, 1633, 1563, 1483, 1160, 511, -233, -793, -1151, -1406, -1466, -1146, -491, 226, 827, 1359, 1893, 2385, 2774, 3032, 3030, 2579, 1749, 932, 443, 240, 162, 146, 77, -204, -510, -334, 474, 1340, 1578, 1213, 906, 1139, 1692, 2016, 1922, 1741, 1829, 2110, 2197, 1866, 1291, 832, 628, 443, -45, -771, -1230, -1043, -447, 17, 179, 316, 672, 1189, 1688, 2040, 2151, 1968, 1580, 1174, 840, 517, 166, -159, -458, -778, -1053, -1151, -1142, -1188, -1194, -930, -483, -199, -149, -28, 408, 1060, 1638, 1894, 1713, 1175, 543, 52, -323, -794, -1434, -2088, -2609, -2965, -3045, -2709, -2031, -1268, -570, 4, 318, 353, 413, 734, 1014, 706, -252, -1308, -1904, -2017, -2025, -2234, -2622, -2943, -2945, -2612, -2214, -2022, -1971, -1813, -1553, -1424, -1491, -1566, -1551, -1588, -1846, -2302, -2785, -3113, -3222, -3216, -3244, -3304, -3227, -2909, -2518, -2330, -2395, -2513, -2505, -2359, -2138, -1951, -1932, -2044, -2034, -1768, -1444, -1283, -1278, -1411, -1775, -2287, -2589, -2442, -2046, -1769, -1705, -1670, -1481, -1079, -495, 106, 440, 405, 278, 336, 435, 286, -14, -137, -50, -62, -293, -457, -240, 256, 584, 489, 285, 513, 1233, 1906, 2031, 1728, 1530, 1748, 2170, 2338, 2046, 1568, 1360, 1534, 1771, 1756, 1543, 1410, 1528, 1845, 2200, 2432, 2455, 2371, 2420, 2621, 2624, 2208, 1745, 1689, 1837, 1697, 1363, 1338, 1700, 2077, 2305, 2516, 2744, 2883, 2923, 2878, 2616, 2054, 1403, 934, 578, 97, -367, -388, 80, 635, 1036, 1377, 1672, 1833, 1919, 1934, 1655, 1055, 500, 148, -278, -850, -1162, -1012, -780, -839, -1034, -997, -693, -415, -399, -625, -941, -1225, -1394, -1422, -1376, -1367, -1411, -1446, -1419, -1340, -1286, -1358, -1536, -1676, -1782, -2047, -2465, -2723, -2713, -2718, -2853, -2825, -2514, -2242, -2216, -2205, -2003, -1796, -1835, -2039, -2164, -2145, -2096, -2071, -2060, -2110, -2281, -2517, -2766, -3057, -3330, -3412, -3310, -3230, -3179, -2945, -2518, -2123, -1802, -1424, -1120, -1229, -1695, -2019, -2017, -2166, -2827, -3554, -3727, -3517, -3526, -3772, -3740, -3239, -2585, -2044, -1665, -1521, -1648, -1782, -1624, -1380, -1571, -2216, -2720, -2733, -2590, -2653, -2794, -2795, -2703, -2591, -2451, -2381, -2433, -2402, -2144, -1935, -2071, -2317, -2230, -1868, -1690, -1830, -1950, -1889, -1886, -1967, -1764, -1224, -884, -1039, -1216, -939, -516, -556, -1070, -1573, -1869, -2152, -2438, -2476, -2260, -2035, -1764, -1205, -485, -25, 116, 241, 404, 339, -60, -607, -1134, -1607, -1981, -2179, -2208, -2135, -1928, -1462, -768, -185, -69, -315, -425, -180, 62, -35, -292, -389, -370, -374, -355, -329, -437, -586, -573, -563, -817, -1075, -925, -536, -358, -376, -238, 198, 827, 1449, 1760, 1599, 1220, 981, 882, 739, 527, 265, -32, -141, 166, 670, 1003, 1257, 1724, 2254, 2449, 2259, 1924, 1646, 1627, 1981, 2381, 2292, 1741, 1401, 1738, 2447, 2875, 2717, 2234, 1881, 1821, 1819, 1664, 1469, 1431, 1570, 1881, 2411, 3019, 3441, 3698, 4022, 4306, 4167, 3632, 3207, 3103, 2922, 2312, 1531, 1047, 913, 943, 1179, 1706, 2260, 2580, 2910, 3569, 4277, 4466, 4093, 3600, 3259, 3001, 2747, 2508, 2230, 1893, 1689, 1835, 2197, 2424, 2478, 2684, 3153, 3522, 3486, 3264, 3230, 3323, 3237, 3002, 2898, 2889, 2725, 2528, 2585, 2675, 2347, 1773, 1518, 1625, 1653, 1506, 1495, 1693, 1846, 1875, 1997, 2339, 2712, 2837, 2664, 2388, 2187, 2037, 1840, 1579, 1249, 807, 378, 272, 559, 857, 835, 639, 581, 711, 939, 1179, 1242, 995, 703, 763, 1135, 1406, 1379, 1205, 1073, 1072, 1252, 1508, 1503, 995, 246, -195, -169, -23, -4, 42, 268, 566, 887, 1311, 1681, 1693, 1373, 1026, 742, 397, -2, -327, -558, -734, -829, -796, -589, -179, 292, 534, 453, 288, 235, 156, -117, -474, -718, -896, -1104, -1117, -685, -137, -52, -321, -284, 119, 239, -153, -563, -685, -731, -800, -742, -596, -504, -348, 22, 423, 566, 459, 290, 164, 40, -148, -333, -266, 136, 499, 441, 195, 252, 529, 489, 1, -507, -697, -596, -372, -155, 7, 250, 691, 1150, 1328, 1226, 1082, 1007, 936, 786, 449, -107, -612, -670, -313, -62, -236, -488, -303, 246, 646, 665, 519, 395, 345, 549, 1079, 1493, 1283, 622, 129, 22, 47, 42, 57, 46, -112, -311, -237, 238, 862, 1267, 1381, 1425, 1528, 1553, 1409, 1241, 1072, 600, -270, -974, -898, -240, 205, 57, -285, -222, 367, 1039, 1279, 1053, 769, 711, 763, 766, 734, 620, 314, -53, -212, -226, -415, -810, -1108, -1183, -1193, -1161, -849, -245, 249, 389, 503, 965, 1513, 1560, 1015, 331, -179, -631, -1155, -1593, -1684, -1402, -1012, -785, -694, -462, 29, 524, 675, 421, 2, -312, -442, -531, -737, -971, -997, -809, -656, -627, -537, -317, -173, -240, -391, -512, -665, -870, -980, -928, -884, -969, -1025, -934, -894, -1035, -1079, -839, -687, -950, -1314, -1364, -1229, -1195, -1172, -1042, -1008, -1235, -1549, -1711, -1690, -1618, -1702, -2044, -2406, -2417, -2084, -1782, -1698, -1661, -1500, -1223, -951, -888, -1144, -1455, -1468, -1323, -1469, -1914, -2241, -2293, -2278, -2315, -2369, -2469, -2567, -2373, -1742, -1028, -699, -685, -516, -28, 406, 452, 192, -172, -602, -1033, -1323, -1502, -1705, -1836, -1716, -1458, -1272, -1064, -644, -95, 346, 555, 501, 291, 232, 502, 798, 690, 181, -349, -586, -435, -43, 243, 228, 117, 151, 232, 253, 396, 689, 780, 542, 324, 338, 378, 343, 387, 502, 503, 443, 557, 877, 1230, 1476, 1528, 1361, 1122, 1007, 961, 756, 301, -272, -747, -902, -644, -154, 263, 557, 929, 1458, 1939, 2150, 2076, 1856, 1585, 1237, 719, 36, -640, -1147, -1449, -1511, -1263, -775, -272, 157, 650, 1234, 1677, 1819, 1797, 1758, 1568, 1056, 397, -117, -547, -1128, -1713, -1910, -1746, -1618, -1577, -1236, -518, 108, 291, 256, 390, 665, 722, 363, -251, -829, -1180, -1282, -1266, -1307, -1399, -1313, -922, -454, -243, -311, -384, -344, -420, -848, -1469, -1856, -1828, -1659, -1681, -1823, -1743, -1284, -616, -25, 269, 208, -7, -123, -204, -522, -1041, -1438, -1635, -1850, -2089, -2079, -1745, -1331, -1038, -841, -651, -437, -241, -172, -287, -513, -763, -1066, -1429, -1702, -1751, -1687, -1748, -1993, -2216, -2160, -1779, -1294, -983, -913, -900, -742, -485, -371, -543, -856, -1086, -1208, -1389, -1727, -2130, -2392, -2375, -2164, -2028, -2076, -2021, -1550, -840, -395, -392, -492, -375, -152, -123, -367, -782, -1297, -1782, -1972, -1834, -1751, -1969, -2159, -1920, -1393, -960, -704, -495, -271, -41, 120, 49, -258, -504, -538, -650, -1079, -1520, -1534, -1226, -1089, -1263, -1389, -1219, -934, -709, -447, -143, -38, -180, -281, -223, -233, -428, -652, -834, -1078, -1350, -1431, -1228, -923, -751, -749, -700, -356, 223, 639, 576, 190, -62, 10, 142, -10, -437, -853, -1064, -1061, -875, -564, -269, -98, 19, 223, 483, 620, 537, 319, 94, -78, -188, -245, -306, -383, -305, 75, 577, 854, 849, 761, 669, 515, 350, 257, 155, -34, -206, -239, -151, 41, 386, 792, 1026, 1003, 894, 891, 983, 997, 823, 540, 321, 238, 250, 372, 670, 1023, 1162, 1067, 1072, 1396, 1813, 1945, 1702, 1310, 1040, 979, 984, 873, 683, 614, 713, 825, 886, 1037, 1348, 1639, 1724, 1703, 1817, 2076, 2238, 2132, 1822, 1454, 1168, 1083, 1154, 1150, 1015, 1019, 1344, 1759, 1993, 2131, 2388, 2730, 2943, 2882, 2531, 1991, 1463, 1117, 931, 754, 543, 444, 633, 1131, 1825, 2551, 3120, 3365, 3302, 3156, 3105, 3069, 2837, 2351, 1761, 1264, 925, 668, 421, 259, 337, 664, 1070, 1435, 1809, 2253, 2654, 2796, 2568, 2083, 1607, 1346, 1248, 1090, 762, 378, 118, 80, 249, 480, 588, 556, 559, 665, 711, 581, 345, 86, -169, -317, -255, -63, 139, 399, 733, 959, 935, 783, 671, 577, 384, 39, -433, -927, -1274, -1414, -1434, -1342, -984, -295, 489, 1045, 1287, 1335, 1251, 1025, 753, 581, 428, 48, -545, -1000, -1112, -1138, -1373, -1654, -1584, -1151, -706, -360, 128, 812, 1326, 1405, 1197, 962, 754, 543, 337, 78, -356, -922, -1326, -1323, -983, -600, -382, -315, -269, -121, 221, 754, 1303, 1611, 1545, 1209, 861, 688, 639, 528, 313, 86, -146, -398, -435, -11, 609, 830, 536, 296, 603, 1252, 1662, 1551, 1111, 705, 585, 768, 983, 844, 274, -326, -550, -441, -293, -134, 230, 764, 1133, 1143, 1017, 1073, 1286, 1296, 863, 158, -382, -496, -334, -272, -400, -395, -40, 415, 678, 850, 1100, 1256, 1112, 783, 443, 52, -413, -799, -1025, -1164, -1201, -999, -567, -97, 298, 677, 1066, 1306, 1207, 827, 499, 463, 504, 179, -566, -1248, -1392, -1028, -555, -301, -320, -443, -446, -230, 121, 456, 641, 569, 246, -87, -147, 31, 77, -251, -740, -1003, -953, -792, -625, -368, -26, 222, 271, 174, 7, -137, -173, -227, -596, -1289, -1845, -1871, -1495, -1097, -793, -449, -23, 326, 476, 520, 618, 745, 655, 125, -746, -1481, -1634, -1345, -1209, -1469, -1691, -1441, -802, -67, 580, 953, 946, 813, 843, 898, 704, 382, 182, 13, -301, -578, -524, -243, -109, -239, -383, -312, -77, 161, 368, 561, 667, 576, 323, 74, -37, -26, -28, -175, -436, -587, -433, -62, 210, 201, 36, -46, -12, -20, -136, -220, -140, 22, 136, 232, 331, 305, 146, 92, 165, 33, -330, -404, 52, 528, 528, 223, -12, -129, -209, -229, -262, -495, -817, -789, -269, 248, 264, -29, -107, 67, 99, -155, -469, -643, -612, -378, -105, -5, 25, 272, 638, 700, 361, -11, -173, -288, -595, -1027, -1319, -1314, -1086, -794, -503, -183, 176, 515, 723, 708, 433, -33, -546, -999, -1378, -1642, -1673, -1436, -1109, -904, -782, -532, -113, 200, 99, -372, -805, -849, -620, -522, -728, -1029, -1214, -1329, -1476, -1550, -1406, -1147, -996, -930, -732, -400, -203, -258, -409, -574, -820, -1074, -1174, -1186, -1244, -1204, -860, -331, 141, 538, 894, 1056, 905, 555, 161, -282, -828, -1411, -1852, -1980, -1749, -1320, -921, -591, -160, 490, 1225, 1762, 1926, 1759, 1411, 935, 300, -370, -758, -716, -517, -510, -615, -463, 48, 606, 873, 817, 622, 489, 566, 896, 1300, 1484, 1399, 1307, 1378, 1462, 1365, 1090, 691, 231, -50, 67, 440, 731, 852, 928, 1015, 1127, 1300, 1449, 1436, 1351, 1364, 1402, 1341, 1344, 1605, 1944, 2041, 1877, 1608, 1248, 756, 268, -58, -299, -588, -756, -458, 311, 1141, 1705, 2058, 2332, 2465, 2344, 1966, 1379, 651, -79, -690, -1156, -1465, -1556, -1414, -1097, -647, -143, 256, 461, 560, 629, 570, 297, -138, -650, -1145, -1419, -1342, -1097, -993, -1105, -1275, -1336, -1201, -946, -875, -1180, -1577, -1624, -1344, -1123, -1133, -1246, -1353, -1424, -1410, -1322, -1207, -1006, -698, -496, -574, -733, -689, -480, -342, -415, -764, -1336, -1814, -1905, -1746, -1660, -1603, -1274, -643, 10, 454, 624, 566, 430, 327, 184, -124, -561, -1034, -1524, -1922, -2016, -1816, -1570, -1350, -976, -399, 181, 603, 853, 906, 708, 279, -324, -969, -1403, -1495, -1468, -1588, -1771, -1780, -1607, -1342, -956, -544, -431, -748, -1157, -1262, -1038, -725, -529, -523, -660, -849, -1039, -1173, -1168, -1082, -1200, -1665, -2196, -2447, -2401, -2189, -1826, -1408, -1172, -1101, -893, -499, -261, -393, -738, -1098, -1440, -1802, -2195, -2577, -2782, -2689, -2432, -2208, -1948, -1516, -1057, -833, -866, -1050, -1340, -1631, -1759, -1768, -1853, -2018, -2095, -2106, -2229, -2473, -2684, -2747, -2580, -2150, -1600, -1154, -836, -522, -258, -239, -510, -919, -1341, -1770, -2231, -2708, -3076, -3154, -2874, -2383, -1823, -1199, -548, -27, 289, 453, 419, 98, -414, -962, -1547, -2080, -2196, -1721, -1042, -609, -397, -172, 56, 143, 71, -117, -433, -797, -996, -926, -729, -556, -318, 124, 622, 828, 658, 427, 380, 318, -83, -727, -1186, -1235, -963, -472, 108, 473, 472, 390, 492, 534, 215, -222, -325, -115, -5, -184, -408, -344, 61, 527, 677, 381, -141, -509, -485, -118, 290, 462, 445, 559, 975, 1507, 1893, 2025, 1838, 1329, 729, 324, 59, -285, -603, -557, -82, 577, 1260, 1950, 2540, 2838, 2805, 2597, 2371, 2166, 1972, 1771, 1517, 1217, 1047, 1207, 1614, 1952, 2047, 1986, 1865, 1699, 1545, 1463, 1440, 1486, 1652, 1873, 2015, 2110, 2288, 2470, 2445, 2196, 1891, 1610, 1344, 1138, 1047, 1034, 1055, 1139, 1326, 1611, 1928, 2125, 2027, 1660, 1260, 1018, 918, 887, 923, 1022, 1138, 1276, 1492, 1759, 1926, 1862, 1588, 1232, 891, 589, 353, 272, 413, 709, 1007, 1226, 1389, 1527, 1653, 1809, 2016, 2142, 1988, 1576, 1230, 1201, 1326, 1268, 1015, 842, 854, 920, 996, 1114, 1115, 842, 525, 558, 992, 1555, 2026, 2314, 2357, 2175, 1892, 1617, 1416, 1328, 1296, 1174, 944, 739, 604, 521, 600, 887, 1165, 1302, 1550, 2062, 2467, 2409, 2106, 1934, 1849, 1604, 1217, 908, 805, 904, 1125, 1302, 1278, 1078, 898, 900, 1060, 1248, 1358, 1331, 1188, 1102, 1273, 1641, 1903, 1910, 1820, 1769, 1680, 1469, 1155, 725, 165, -350, -529, -247, 351, 1021, 1550, 1817, 1828, 1715, 1623, 1574, 1424, 1010, 379, -177, -390, -303, -191, -225, -317, -303, -139, 151, 564, 973, 1039, 544, -212, -672, -665, -501, -442, -396, -212, 44, 219, 265, 209, 42, -223, -486, -629, -605, -409, -114, 34, -174, -537, -599, -292, -74, -246, -561, -662, -568, -489, -440, -294, -33, 258, 533, 736, 702, 342, -152, -503, -703, -947, -1230, -1301, -1063, -756, -585, -438, -158, 114, 184, 166, 282, 450, 408, 93, -323, -663, -810, -792, -816, -1000, -1134, -1004, -782, -740, -787, -644, -333, -105, -1, 202, 623, 1027, 1043, 579, -57, -520, -809, -1107, -1362, -1348, -1071, -754, -461, -68, 415, 816, 1028, 1039, 841, 497, 150, -139, -439, -776, -1090, -1333, -1422, -1239, -801, -327, 19, 256, 391, 313, 39, -124, 66, 411, 444, 3, -587, -945, -1030, -1031, -1023, -952, -855, -831, -768, -435, 110, 504, 558, 409, 168, -208, -640, -913, -1035, -1208, -1447, -1554, -1452, -1236, -964, -615, -249, -16, 6, -120, -308, -544, -856, -1222, -1566, -1793, -1820, -1642, -1366, -1087, -791, -457, -188, -105, -197, -395, -639, -824, -829, -730, -790, -1110, -1418, -1399, -1122, -893, -793, -694, -626, -722, -802, -521, 46, 420, 392, 243, 206, 133, -150, -499, -684, -757, -876, -985, -911, -678, -411, -106, 232, 399, 266, 49, 7, 61, -51, -348, -575, -543, -384, -404, -674, -900, -814, -563, -446, -442, -340, -153, -29, 77, 250, 310, 55, -372, -633, -571, -276, 32, 134, -49, -384, -721, -992, -1086, -907, -618, -491, -473, -316, -64, 18, -104, -281, -531, -927, -1301, -1411, -1261, -1031, -875, -824, -735, -424, -34, 29, -298, -624, -730, -845, -1114, -1355, -1461, -1548, -1617, -1511, -1242, -986, -780, -542, -339, -321, -437, -448, -274, -124, -233, -565, -897, -1116, -1300, -1506, -1657, -1683, -1603, -1390, -948, -367, 38, 104, 36, 81, 181, 148, -56, -366, -729, -1056, -1203, -1117, -894, -671, -510, -361, -116, 223, 462, 423, 207, 105, 225, 374, 342, 176, 74, 86, 58, -123, -335, -373, -237, -104, -27, 139, 461, 765, 866, 764, 581, 411, 303, 229, 80, -155, -295, -209, -74, -171, -483, -694, -605, -350, -151, -8, 205, 466, 584, 485, 309, 185, 48, -223, -577, -839, -921, -885, -818, -753, -674, -543, -371, -281, -395, -646, -822, -822, -756, -767, -876, -979, -971, -876, -853, -1012, -1248, -1363, -1330, -1296, -1359, -1462, -1519, -1507, -1418, -1245, -1038, -902, -891, -930, -919, -868, -873, -971, -1076, -1108, -1101, -1112, -1109, -1047, -964, -895, -792, -668, -634, -696, -710, -666, -726, -902, -970, -811, -571, -392, -226, -10, 162, 164, -1, -210, -348, -389, -362, -294, -163, 81, 400, 600, 534, 366, 377, 547, 589, 419, 274, 367, 681, 1082, 1379, 1367, 1039, 719, 736, 993, 1079, 838, 561, 551, 737, 894, 1001, 1177, 1421, 1649, 1808, 1849, 1724, 1501, 1312, 1183, 1081, 1039, 1100, 1223, 1366, 1548, 1754, 1890, 1903, 1829, 1708, 1553, 1382, 1216, 1066, 970, 965, 991, 950, 862, 863, 1033, 1310, 1547, 1629, 1591, 1605, 1732, 1766, 1537, 1259, 1226, 1341, 1284, 1004, 719, 538, 423, 343, 314, 352, 537, 936, 1421, 1729, 1743, 1573, 1381, 1216, 1008, 697, 356, 155, 131, 113, -1, -53, 152, 526, 811, 913, 962, 1068, 1187, 1215, 1121, 957, 769, 575, 400, 312, 367, 516, 624, 610, 547, 574, 697, 758, 642, 466, 448, 636, 841, 890, 818, 777, 796, 764, 616, 465, 427, 435, 372, 317, 439, 678, 784, 682, 545, 491, 445, 337, 233, 225, 299, 376, 414, 468, 604, 765, 790, 623, 423, 361, 399, 357, 170, -52, -177, -176, -72, 117, 350, 543, 673, 795, 901, 887, 711, 472, 274, 113, -50, -200, -324, -462, -622, -708, -589, -266, 106, 378, 541, 689, 861, 995, 1014, 898, 672, 391, 138, -51, -235, -443, -565, -508, -349, -208, -47, 224, 553, 797, 899, 891, 817, 726, 659, 610, 529, 386, 190, -25, -201, -274, -234, -175, -192, -224, -101, 193, 464, 574, 582, 558, 473, 345, 259, 223, 186, 203, 322, 411, 339, 216, 238, 360, 383, 278, 220, 307, 417, 397, 263, 152, 114, 64, -61, -208, -274, -214, -54, 153, 339, 432, 424, 374, 336, 289, 192, 44, -115, -272, -421, -522, -537, -513, -521, -533, -468, -378, -421, -609, -747, -693, -531, -441, -500, -649, -784, -865, -962, -1152, -1381, -1509, -1480, -1377, -1286, -1202, -1105, -1037, -1058, -1154, -1235, -1236, -1156, -1040, -969, -1006, -1112, -1176, -1178, -1240, -1425, -1603, -1612, -1466, -1303, -1169, -993, -767, -625, -677, -845, -941, -893, -806, -811, -914, -1001, -972, -848, -727, -660, -584, -427, -225, -108, -140, -238, -292, -308, -366, -464, -507, -448, -352, -313, -320, -275, -111, 114, 278, 349, 391, 420, 355, 175, -4, -85, -129, -250, -402, -430, -275, -48, 138, 269, 366, 406, 380, 318, 210, 47, -105, -166, -168, -181, -184, -147, -119, -129, -112, -42, 16, 41, 75, 90, 19, -114, -209, -241, -271, -344, -445, -516, -487, -378, -312, -355, -415, -377, -272, -199, -157, -84, 22, 84, 34, -121, -317, -499, -689, -933, -1167, -1231, -1055, -764, -530, -382, -228, -35, 105, 98, -28, -171, -270, -363, -503, -681, -818, -840, -735, -591, -528, -577, -621, -513, -257, -2, 152, 240, 307, 324, 252, 104, -81, -273, -445, -553, -547, -414, -237, -146, -145, -92, 82, 246, 255, 155, 89, 89, 87, 40, -47, -153, -236, -250, -198, -120, -32, 83, 233, 399, 551, 654, 678, 607, 452, 253, 65, -75, -169, -233, -255, -204, -75, 105, 297, 458, 536, 507, 409, 301, 213, 129, 41, -27, -59, -75, -137, -275, -427, -472, -375, -241, -204, -263, -289, -201, -80, -51, -124, -212, -258, -260, -231, -188, -142, -62, 56, 123, 37, -164, -332, -387, -364, -329, -311, -305, -278, -177, -8, 146, 208, 194, 188, 226, 243, 184, 93, 69, 139, 229, 255, 222, 207, 245, 265, 173, 5, -96, -71, -14, -33, -89, -47, 140, 373, 525, 582, 607, 632, 628, 587, 541, 459, 246, -96, -388, -461, -359, -245, -162, -21, 241, 576, 854, 945, 814, 555, 313, 156, 58, -24, -82, -87, -43, 15, 66, 122, 188, 238, 231, 153, 39, -56, -112, -139, -138, -72, 80, 278, 441, 527, 527, 446, 297, 111, -79, -234, -292, -214, -56, 84, 170, 230, 284, 295, 220, 61, -110, -215, -226, -165, -38, 158, 373, 483, 429, 299, 207, 147, 25, -182, -371, -430, -358, -245, -141, 1, 232, 501, 698, 768, 733, 629, 467, 272, 71, -128, -331, -485, -501, -341, -75, 152, 248, 267, 354, 565, 776, 804, 625, 390, 236, 158, 106, 107, 187, 266, 245, 167, 133, 150, 155, 131, 115, 127, 163, 225, 319, 424, 504, 537, 524, 475, 387, 251, 86, -32, -57, -20, 3, -11, -20, 16, 76, 131, 187, 246, 256, 183, 89, 60, 84, 70, -9, -77, -52, 40, 117, 129, 92, 42, 8, -6, -31, -100, -202, -270, -265, -229, -230, -283, -355, -406, -415, -384, -330, -263, -181, -85, 1, 50, 45, -13, -128, -293, -465, -581, -619, -613, -592, -543, -451, -341, -235, -127, -7, 98, 141, 93, -12, -112, -175, -230, -310, -401, -456, -479, -525, -608, -642, -528, -286, -42, 97, 147, 175, 204, 203, 158, 87, 2, -99, -198, -249, -238, -211, -211, -227, -220, -179, -129, -80, -16, 65, 150, 224, 269, 253, 159, 39, -42, -88, -132, -170, -171, -124, -40, 53, 121, 132, 100, 68, 42, 18, 13, 52, 103, 108, 64, 32, 50, 80, 66, 16, -16, 5, 63, 120, 142, 121, 84, 75, 97, 117, 103, 63, 20, -28, -87, -126, -106, -35, 35, 81, 103, 106, 86, 52, 15, -31, -75, -90, -81, -88, -121, -150, -160, -174, -195, -197, -155, -90, -41, -30, -38, -26, 13, 42, 13, -65, -146, -187, -182, -147, -111, -89, -71, -40, -3, 22, 37, 65, 102, 116, 85, 26, -24, -41, -27, 3, 41, 83, 121, 152, 173, 182, 178, 158, 137, 129, 144, 171, 198, 201, 169, 124, 111, 133, 150, 139, 111, 75, 27, -13, -20, 11, 51, 74, 80, 78, 82, 98, 113, 93, 25, -57, -101, -93, -68, -55, -47, -24, 9, 36, 45, 33, 15, 9, 13, 0, -46, -93, -103, -69, -28, -3, 11, 31, 50, 56, 50, 46, 48, 46, 34, 21, 19, 24, 22, 5, -7, 2, 34, 61, 67, 60, 49, 34, 24, 29, 45, 55, 50, 36, 25, 19, 12, 9, 12, 18, 23, 25, 21, 8, -3, -2, 9, 11, -3, -23, -33, -34, -25, -9, 0, -3, -12, -16, -16, -17, -14, -9, -11, -25, -34, -26, -8, -1, -7, -13, -12, -6, -2, -1, -2, -5, -2, 9, 27, 36, 36, 31, 28, 26, 25, 22, 18, 12, 8, 1, -4, -4, 3, 17, 23, 18, 7, 2, 7, 16, 17, 8, 1, 0, 2, 0, -4, -4, 2, 5, 0, -5, -5, -2, -2, -5, -7, -9, -9, -8, -9, -12, -16, -14, -10, -9, -8, -5, -3, -1, -1, 0, 0, -1, -1, -2, -3, -3, -1, -1, -2, -2, -2, -2, -2, -2, -1, 0, 1, 2, 2, 1, 2, 4, 4, 3, 2, 1, 1, 2, 3, 1, 0, 0, 0, 0, -1, 0, 0, 0, 0, 0, 0, 2, 2, 1, -1, -2, -1, 0, 1, 0, -1, -4, -5, -4, -3, -3, -4, -4, -3, -4, -5, -6, -4, -3, -3, -5, -5, -3, -1, -1, -3, -4, -3, -1, -1, -3, -4, -3, -1, -1, -1, 0, 1, 0, -1, -1, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, -1, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 0, 0, -1, 0, 1, 0, -1, -1, 0, 1, 0, 0, -1 };
+// IMA ADPCM blocks, see audio_adpcm.h
+static const uint8_t __in_flash("audio_twenty_sample_data") audio_twenty_sample_data[] = { 0, 0, 0, 0, 103, 255, 72, 2, 160, 187, 57, 54, 201, 74, 134, 203, 32, 129, 152, 8, 4, 219, 24, 50, 146, 44, 5, 154, 34, 201, 10, 128, 155, 114, 178, 173, 185, 205, 25, 69, 1, 81, 145, 104, 4, 137, 168, 190, 221, 155, 50, 53, 67, 69, 129, 186, 187, 203, 9, 2, 16, 3, 237, 138, 16, 50, 52, 144, 171, 8, 128, 115, 37, 161, 204, 170, 137, 33, 18, 128, 201, 154, 33, 69, 19, 185, 207, 155, 56, 54, 35, 131, 235, 170, 152, 32, 20, 136, 153, 154, 16, 65, 36, 160, 203, 188, 97, 19, 202, 154, 0, 33, 68, 35, 176, 139, 153, 155, 56, 39, 207, 81, 130, 137, 185, 188, 9, 50, 69, 19, 168, 137, 152, 74, 87, 185, 173, 153, 9, 50, 52, 161, 172, 154, 65, 51, 67, 3, 218, 10, 3, 237, 172, 9, 16, 33, 55, 3, 184, 204, 10, 83, 19, 18, 176, 175, 169, 137, 65, 35, 144, 203, 10, 34, 145, 138, 128, 11, 55, 160, 201, 171, 201, 140, 52, 52, 200, 171, 236, 155, 114, 21, 128, 136, 153, 9, 49, 53, 146, 186, 204, 172, 41, 53, 128, 153, 137, 218, 56, 38, 17, 129, 235, 138, 32, 17, 0, 251, 155, 48, 51, 32, 131, 222, 9, 17, 136, 32, 130, 203, 9, 138, 87, 145, 172, 0, 16, 33, 129, 186, 189, 80, 2, 48, 145, 56, 195, 141, 84, 130, 154, 0, 184, 27, 37, 48, 21, 221, 153, 136, 66, 50, 35, 236, 138, 160, 138, 83, 146, 187, 0, 201, 154, 98, 2, 154, 0, 0, 116, 19, 203, 170, 9, 51, 161, 171, 203, 207, 72, 36, 128, 17, 201, 11, 34, 17, 55, 145, 172, 153, 24, 34, 160, 219, 155, 56, 36, 145, 172, 65, 21, 0, 1, 184, 171, 235, 171, 137, 48, 38, 168, 40, 250, 12, 50, 83, 3, 203, 170, 138, 65, 35, 216, 170, 251, 57, 38, 1, 137, 152, 186, 73, 21, 168, 187, 138, 83, 18, 68, 145, 204, 10, 1, 201, 9, 128, 171, 56, 69, 145, 9, 86, 2, 187, 65, 160, 27, 36, 34, 136, 136, 186, 168, 223, 9, 185, 188, 203, 11, 69, 18, 49, 160, 157, 154, 72, 3, 24, 240, 156, 0, 153, 168, 25, 131, 42, 55, 1, 200, 58, 21, 114, 131, 138, 152, 189, 32, 129, 50, 4, 171, 80, 144, 172, 88, 54, 152, 32, 130, 64, 146, 203, 203, 72, 4, 171, 155, 56, 178, 159, 0, 25, 53, 2, 249, 171, 16, 68, 2, 170, 218, 10, 3, 138, 233, 156, 128, 10, 52, 18, 129, 203, 8, 168, 73, 21, 1, 184, 172, 0, 99, 20, 136, 1, 137, 129, 173, 170, 27, 39, 170, 50, 236, 137, 41, 22, 16, 20, 186, 8, 17, 128, 16, 19, 250, 155, 1, 137, 233, 155, 18, 97, 36, 2, 201, 27, 129, 105, 21, 0, 218, 140, 160, 26, 54, 1, 17, 34, 18, 154, 32, 218, 57, 176, 43, 179, 6, 8, 34, 0, 157, 201, 140, 115, 23, 1, 184, 187, 203, 25, 2, 66, 145, 153, 128, 185, 154, 201, 141, 17, 251, 189, 170, 154, 115, 36, 17, 0, 153, 153, 137, 144, 191, 40, 83, 52, 200, 155, 136, 152, 136, 99, 18, 0, 2, 172, 56, 55, 4, 218, 172, 25, 33, 49, 146, 189, 156, 153, 186, 154, 0, 185, 89, 37, 1, 185, 114, 55, 0, 168, 186, 202, 26, 68, 67, 35, 184, 219, 156, 8, 24, 34, 18, 130, 174, 32, 17, 85, 146, 137, 250, 156, 33, 130, 24, 35, 144, 66, 2, 154, 51, 249, 159, 137, 152, 8, 34, 169, 139, 49, 85, 35, 33, 129, 24, 83, 146, 189, 154, 154, 17, 136, 184, 255, 159, 153, 8, 128, 128, 128, 185, 26, 53, 17, 32, 53, 34, 99, 131, 155, 16, 136, 128, 188, 185, 223, 155, 136, 8, 136, 49, 178, 223, 25, 51, 52, 2, 0, 32, 86, 19, 152, 186, 170, 16, 184, 203, 223, 155, 16, 49, 131, 202, 10, 128, 24, 2, 113, 21, 185, 25, 18, 83, 36, 3, 187, 32, 0, 86, 19, 185, 175, 25, 128, 65, 3, 152, 152, 10, 2, 32, 21, 153, 8, 116, 36, 33, 146, 204, 154, 32, 4, 185, 184, 207, 137, 8, 50, 193, 203, 203, 189, 138, 0, 34, 192, 58, 53, 152, 48, 37, 152, 113, 52, 2, 136, 186, 189, 9, 186, 137, 234, 170, 186, 26, 193, 158, 33, 82, 36, 136, 65, 17, 34, 0, 1, 136, 34, 250, 191, 186, 172, 40, 129, 33, 160, 40, 21, 0, 51, 202, 116, 4, 64, 18, 8, 18, 48, 3, 138, 2, 219, 188, 48, 69, 36, 66, 162, 158, 0, 187, 169, 155, 35, 219, 10, 201, 173, 188, 155, 48, 17, 9, 35, 234, 10, 56, 55, 160, 138, 8, 82, 145, 153, 238, 11, 129, 25, 133, 205, 169, 155, 98, 36, 129, 9, 1, 24, 36, 18, 67, 184, 10, 82, 36, 83, 3, 186, 137, 33, 36, 184, 172, 203, 41, 66, 19, 251, 12, 144, 41, 131, 206, 186, 155, 16, 8, 49, 184, 139, 66, 19, 221, 138, 201, 139, 0, 0, 185, 206, 188, 137, 8, 71, 176, 9, 184, 26, 35, 86, 19, 24, 129, 41, 19, 66, 5, 153, 144, 156, 160, 206, 137, 33, 146, 27, 55, 128, 176, 173, 176, 29, 20, 155, 161, 142, 129, 156, 52, 168, 136, 219, 170, 187, 154, 202, 104, 37, 129, 144, 154, 144, 139, 20, 8, 130, 80, 241, 156, 0, 98, 19, 50, 129, 49, 36, 49, 21, 17, 200, 11, 129, 171, 16, 145, 64, 4, 188, 173, 153, 239, 137, 184, 41, 145, 172, 136, 153, 185, 158, 49, 129, 16, 220, 26, 17, 100, 34, 50, 178, 139, 168, 104, 2, 48, 22, 33, 184, 138, 251, 15, 17, 0, 33, 50, 129, 56, 4, 24, 18, 115, 39, 8, 129, 137, 50, 168, 96, 20, 129, 185, 171, 9, 52, 176, 27, 249, 139, 128, 66, 131, 136, 83, 8, 30, 0, 152, 82, 146, 171, 202, 172, 221, 25, 160, 154, 252, 139, 136, 96, 131, 189, 16, 33, 50, 68, 130, 154, 66, 83, 19, 32, 131, 190, 8, 32, 19, 201, 186, 191, 155, 16, 162, 175, 24, 0, 128, 25, 55, 170, 115, 144, 137, 154, 50, 161, 204, 188, 154, 203, 138, 17, 35, 144, 249, 189, 9, 1, 82, 19, 18, 184, 72, 35, 99, 131, 137, 144, 202, 187, 10, 201, 9, 128, 185, 191, 219, 174, 33, 16, 86, 2, 49, 3, 9, 18, 24, 36, 32, 7, 187, 65, 232, 139, 1, 9, 128, 26, 241, 174, 136, 137, 18, 128, 201, 173, 153, 169, 40, 3, 32, 5, 171, 49, 201, 27, 35, 185, 235, 171, 216, 141, 19, 138, 87, 160, 136, 201, 57, 36, 50, 145, 25, 2, 104, 38, 184, 203, 172, 136, 137, 153, 186, 222, 187, 137, 8, 144, 169, 235, 188, 186, 155, 0, 203, 203, 173, 66, 2, 33, 201, 9, 252, 41, 18, 18, 1, 52, 168, 24, 152, 82, 17, 5, 222, 24, 184, 57, 21, 136, 34, 1, 18, 8, 85, 145, 114, 20, 136, 144, 139, 35, 32, 71, 17, 17, 152, 154, 49, 65, 67, 32, 19, 169, 168, 156, 67, 185, 116, 179, 189, 137, 184, 10, 54, 53, 19, 49, 129, 72, 2, 136, 50, 100, 84, 18, 32, 129, 40, 129, 80, 2, 49, 193, 42, 36, 136, 101, 3, 50, 128, 33, 235, 9, 217, 10, 160, 204, 203, 219, 170, 187, 41, 192, 26, 2, 139, 145, 10, 224, 58, 5, 72, 132, 10, 53, 129, 0, 51, 145, 188, 41, 21, 252, 156, 0, 16, 3, 219, 185, 190, 154, 137, 200, 139, 160, 175, 0, 186, 25, 145, 152, 188, 25, 218, 9, 202, 136, 222, 56, 145, 26, 2, 48, 37, 49, 51, 100, 52, 69, 50, 67, 50, 67, 52, 34, 35, 67, 34, 34, 20, 136, 0, 137, 34, 235, 9, 152, 184, 207, 155, 187, 202, 174, 153, 203, 203, 186, 202, 188, 170, 204, 188, 170, 187, 189, 172, 153, 185, 203, 154, 184, 172, 154, 168, 203, 137, 186, 188, 11, 54, 129, 17, 144, 32, 20, 251, 138, 168, 204, 137, 16, 0, 144, 237, 156, 8, 184, 155, 8, 233, 156, 49, 161, 156, 32, 69, 34, 0, 128, 16, 152, 114, 21, 16, 32, 67, 18, 67, 19, 32, 36, 98, 52, 2, 32, 54, 19, 48, 71, 18, 50, 21, 128, 32, 36, 19, 128, 67, 35, 64, 87, 129, 32, 34, 1, 49, 2, 48, 23, 16, 2, 9, 2, 1, 200, 10, 144, 121, 38, 33, 18, 152, 24, 50, 82, 36, 1, 34, 185, 156, 48, 68, 68, 36, 51, 36, 35, 144, 65, 1, 40, 71, 18, 160, 136, 234, 155, 32, 2, 220, 171, 170, 219, 156, 152, 185, 202, 139, 66, 1, 97, 53, 18, 100, 52, 51, 52, 67, 68, 51, 51, 69, 34, 33, 34, 17, 17, 129, 186, 186, 253, 203, 187, 190, 203, 186, 203, 213, 39, 52, 0, 188, 186, 203, 188, 171, 187, 173, 186, 171, 171, 187, 172, 153, 187, 156, 0, 160, 155, 153, 156, 33, 1, 128, 186, 188, 220, 204, 155, 169, 173, 153, 218, 171, 136, 170, 65, 161, 41, 52, 66, 53, 66, 67, 19, 67, 68, 34, 1, 33, 35, 2, 16, 128, 201, 223, 187, 170, 171, 202, 157, 136, 204, 138, 128, 9, 17, 0, 116, 51, 52, 35, 69, 35, 115, 51, 50, 67, 36, 66, 51, 67, 52, 51, 67, 67, 51, 35, 51, 35, 34, 50, 37, 128, 136, 128, 221, 138, 204, 154, 202, 172, 186, 172, 154, 153, 203, 170, 128, 169, 73, 21, 72, 38, 16, 34, 8, 53, 153, 84, 128, 81, 129, 40, 147, 155, 129, 158, 50, 216, 57, 148, 158, 18, 0, 51, 168, 114, 35, 8, 65, 84, 129, 40, 52, 136, 81, 2, 48, 19, 81, 20, 8, 51, 234, 155, 153, 169, 171, 168, 239, 219, 235, 171, 170, 170, 8, 34, 67, 52, 67, 67, 68, 53, 52, 52, 67, 67, 35, 35, 50, 35, 34, 17, 1, 1, 152, 9, 184, 221, 172, 203, 221, 203, 172, 186, 203, 187, 186, 235, 187, 186, 203, 170, 153, 170, 138, 152, 203, 170, 186, 172, 155, 152, 173, 153, 206, 186, 204, 170, 186, 188, 172, 170, 219, 138, 0, 170, 24, 0, 84, 2, 81, 52, 67, 52, 66, 67, 18, 34, 20, 152, 49, 144, 136, 219, 187, 237, 187, 188, 173, 186, 188, 186, 203, 187, 188, 187, 170, 154, 24, 33, 82, 51, 84, 69, 35, 50, 68, 51, 34, 52, 67, 67, 50, 53, 1, 34, 1, 32, 18, 34, 17, 50, 131, 154, 187, 173, 187, 9, 50, 20, 8, 71, 152, 26, 32, 69, 129, 114, 22, 136, 16, 130, 48, 162, 175, 16, 144, 204, 9, 145, 171, 170, 153, 185, 207, 137, 128, 152, 40, 53, 19, 49, 54, 1, 96, 52, 50, 69, 50, 36, 17, 35, 168, 138, 136, 200, 12, 35, 236, 154, 234, 188, 172, 170, 138, 136, 171, 8, 232, 139, 36, 168, 96, 35, 136, 99, 19, 33, 38, 129, 17, 128, 24, 0, 65, 35, 34, 208, 223, 220, 188, 170, 154, 0, 115, 53, 34, 50, 52, 51, 69, 52, 36, 36, 33, 1, 1, 0, 128, 128, 128, 136, 153, 186, 205, 187, 221, 189, 219, 187, 188, 172, 186, 154, 169, 153, 153, 170, 171, 9, 16, 50, 69, 51, 18, 184, 190, 187, 204, 156, 136, 169, 171, 235, 187, 186, 155, 24, 66, 83, 35, 83, 68, 18, 66, 67, 34, 33, 1, 16, 160, 157, 129, 204, 219, 187, 221, 187, 203, 171, 170, 155, 219, 187, 201, 203, 170, 154, 152, 136, 169, 10, 219, 156, 168, 11, 128, 64, 68, 18, 8, 86, 50, 83, 36, 51, 51, 52, 1, 100, 34, 83, 50, 67, 34, 18, 10, 53, 160, 115, 3, 33, 136, 1, 188, 16, 170, 49, 152, 136, 202, 236, 173, 169, 205, 137, 137, 153, 155, 18, 169, 72, 231, 39, 0, 8, 99, 1, 49, 53, 67, 36, 85, 20, 34, 34, 33, 1, 136, 33, 128, 9, 34, 209, 172, 236, 187, 186, 156, 153, 48, 177, 73, 148, 12, 130, 10, 3, 43, 39, 168, 137, 34, 253, 170, 202, 170, 188, 40, 145, 104, 3, 24, 177, 190, 16, 144, 88, 54, 17, 35, 17, 35, 153, 115, 19, 65, 35, 18, 137, 8, 82, 130, 10, 21, 154, 85, 33, 54, 136, 8, 253, 190, 186, 188, 138, 50, 53, 69, 50, 35, 18, 51, 84, 67, 35, 34, 1, 0, 128, 136, 152, 153, 169, 204, 204, 219, 188, 188, 172, 186, 187, 187, 188, 153, 170, 32, 18, 136, 152, 207, 188, 187, 138, 152, 25, 177, 207, 187, 190, 154, 153, 48, 36, 50, 36, 17, 51, 82, 85, 35, 66, 19, 144, 153, 205, 171, 203, 171, 170, 172, 203, 172, 154, 154, 24, 66, 34, 52, 36, 51, 52, 52, 18, 145, 218, 220, 219, 186, 202, 202, 186, 187, 204, 170, 154, 136, 16, 67, 68, 67, 50, 52, 50, 53, 67, 51, 36, 130, 152, 169, 187, 203, 156, 17, 17, 128, 32, 132, 172, 97, 36, 53, 36, 34, 35, 144, 169, 186, 137, 216, 190, 170, 204, 172, 186, 153, 153, 154, 33, 67, 53, 34, 101, 35, 49, 51, 34, 37, 129, 16, 52, 129, 32, 184, 171, 238, 11, 2, 9, 68, 1, 48, 19, 10, 70, 129, 65, 130, 9, 161, 207, 169, 189, 169, 219, 154, 168, 172, 128, 169, 48, 4, 56, 36, 32, 37, 50, 53, 2, 16, 145, 234, 204, 170, 169, 154, 0, 33, 83, 130, 138, 48, 51, 71, 17, 98, 4, 137, 24, 2, 40, 53, 1, 51, 251, 72, 131, 57, 22, 152, 144, 219, 140, 0, 49, 37, 185, 186, 255, 159, 170, 138, 48, 68, 68, 36, 35, 33, 17, 17, 17, 34, 17, 0, 128, 137, 203, 204, 187, 188, 205, 171, 187, 186, 172, 24, 128, 33, 129, 169, 188, 202, 206, 170, 170, 206, 204, 186, 219, 170, 138, 136, 17, 1, 34, 51, 69, 67, 68, 51, 36, 1, 128, 168, 172, 187, 187, 203, 205, 186, 203, 188, 154, 9, 17, 66, 54, 50, 51, 50, 50, 35, 17, 130, 205, 203, 206, 171, 203, 171, 185, 187, 153, 186, 41, 37, 65, 37, 17, 52, 145, 9, 184, 158, 153, 171, 170, 206, 138, 169, 10, 68, 84, 52, 36, 36, 35, 34, 20, 33, 34, 1, 16, 201, 190, 172, 187, 173, 153, 169, 9, 1, 8, 128, 81, 52, 17, 68, 34, 160, 203, 155, 185, 207, 10, 144, 186, 24, 50, 3, 114, 55, 18, 83, 35, 50, 35, 49, 35, 144, 9, 249, 189, 186, 187, 154, 203, 64, 131, 138, 68, 17, 82, 52, 83, 18, 8, 129, 203, 170, 220, 154, 202, 172, 153, 187, 153, 185, 24, 3, 64, 55, 1, 68, 130, 65, 19, 0, 147, 205, 170, 188, 155, 170, 170, 186, 187, 170, 9, 103, 52, 83, 35, 34, 34, 160, 96, 10, 43, 0, 10, 20, 160, 187, 138, 248, 174, 40, 18, 41, 70, 129, 16, 144, 57, 133, 154, 34, 169, 136, 203, 139, 185, 121, 133, 239, 187, 204, 154, 16, 115, 54, 52, 35, 18, 1, 8, 8, 8, 0, 1, 136, 185, 206, 187, 203, 155, 169, 137, 1, 17, 1, 32, 34, 35, 253, 207, 203, 187, 173, 171, 170, 154, 168, 187, 187, 24, 66, 84, 53, 52, 34, 17, 128, 169, 186, 203, 188, 188, 187, 204, 170, 8, 24, 67, 83, 51, 18, 50, 4, 153, 152, 185, 237, 188, 170, 204, 154, 136, 24, 18, 66, 37, 18, 65, 51, 65, 35, 128, 233, 205, 187, 205, 171, 170, 170, 137, 137, 48, 2, 98, 36, 51, 68, 50, 50, 145, 8, 145, 156, 8, 137, 128, 40, 54, 68, 85, 52, 51, 37, 19, 17, 152, 187, 187, 187, 191, 138, 234, 171, 153, 186, 9, 65, 36, 1, 66, 51, 18, 136, 32, 2, 251, 10, 146, 206, 9, 34, 1, 56, 103, 1, 32, 20, 1, 66, 34, 8, 144, 154, 169, 207, 138, 129, 0, 17, 114, 21, 152, 32, 147, 138, 33, 32, 4, 204, 154, 220, 171, 201, 10, 19, 169, 82, 129, 40, 145, 11, 36, 170, 33, 253, 139, 234, 140, 17, 9, 36, 169, 48, 130, 25, 70, 130, 128, 153, 235, 204, 155, 136, 138, 32, 67, 53, 35, 17, 85, 3, 8, 98, 2, 24, 68, 19, 153, 49, 178, 223, 137, 168, 154, 136, 137, 49, 2, 139, 85, 160, 11, 216, 255, 187, 171, 48, 85, 84, 52, 35, 2, 0, 8, 137, 136, 16, 128, 136, 169, 187, 221, 155, 136, 0, 144, 40, 52, 0, 144, 170, 253, 190, 204, 188, 172, 187, 154, 16, 8, 65, 2, 136, 154, 32, 20, 49, 38, 130, 201, 204, 203, 203, 154, 8, 0, 17, 65, 52, 34, 53, 34, 34, 160, 219, 204, 172, 170, 188, 10, 152, 155, 136, 32, 54, 84, 68, 34, 50, 128, 169, 218, 187, 203, 171, 186, 204, 203, 187, 155, 170, 57, 55, 35, 52, 17, 0, 203, 155, 202, 188, 169, 186, 9, 153, 113, 37, 84, 51, 66, 51, 50, 36, 1, 52, 145, 25, 184, 191, 186, 188, 154, 9, 48, 67, 50, 34, 128, 34, 144, 65, 224, 189, 202, 204, 187, 9, 128, 8, 100, 36, 1, 65, 20, 128, 34, 17, 1, 136, 129, 189, 16, 252, 10, 19, 170, 84, 35, 33, 67, 67, 130, 48, 20, 154, 2, 236, 138, 184, 189, 153, 137, 169, 42, 35, 25, 70, 34, 68, 129, 24, 216, 189, 169, 154, 169, 155, 2, 237, 138, 184, 11, 52, 82, 53, 18, 2, 160, 154, 204, 156, 136, 186, 155, 160, 205, 137, 153, 56, 52, 84, 83, 51, 18, 33, 0, 153, 201, 139, 162, 207, 40, 0, 129, 9, 71, 128, 115, 2, 64, 2, 153, 128, 250, 173, 128, 184, 138, 34, 169, 32, 146, 154, 252, 190, 137, 152, 104, 87, 67, 35, 51, 2, 136, 153, 170, 106, 59, 0, 170, 138, 16, 51, 36, 128, 152, 185, 220, 187, 64, 1, 56, 21, 152, 218, 189, 236, 172, 170, 172, 154, 154, 16, 16, 84, 1, 17, 169, 171, 205, 139, 128, 137, 130, 173, 170, 206, 153, 136, 32, 66, 68, 35, 34, 17, 128, 219, 187, 189, 187, 186, 139, 136, 49, 37, 66, 36, 32, 18, 24, 52, 34, 35, 176, 253, 190, 188, 171, 155, 16, 33, 68, 18, 0, 152, 170, 203, 171, 202, 170, 235, 189, 187, 189, 170, 137, 33, 99, 68, 67, 51, 51, 36, 2, 1, 201, 155, 144, 137, 100, 19, 83, 20, 0, 0, 152, 9, 0, 33, 131, 170, 250, 190, 154, 203, 9, 144, 154, 33, 34, 33, 114, 53, 130, 32, 128, 9, 145, 175, 16, 145, 16, 17, 84, 146, 74, 55, 34, 66, 52, 128, 24, 160, 11, 19, 9, 71, 2, 65, 2, 137, 185, 191, 137, 217, 10, 50, 0, 32, 66, 129, 153, 152, 8, 232, 173, 128, 251, 171, 202, 138, 128, 139, 86, 145, 41, 131, 220, 170, 186, 156, 17, 128, 86, 145, 155, 200, 173, 8, 49, 86, 35, 18, 17, 168, 204, 138, 152, 171, 171, 154, 186, 138, 33, 69, 2, 137, 52, 218, 114, 131, 80, 21, 128, 1, 169, 170, 171, 56, 69, 34, 83, 146, 219, 172, 186, 156, 17, 1, 83, 3, 128, 169, 205, 236, 187, 153, 25, 87, 68, 67, 36, 18, 129, 136, 154, 154, 24, 33, 52, 35, 16, 0, 186, 171, 32, 1, 25, 67, 144, 220, 222, 188, 204, 187, 187, 172, 153, 138, 16, 49, 51, 1, 160, 255, 173, 186, 155, 137, 136, 16, 160, 170, 138, 154, 80, 53, 67, 36, 1, 136, 185, 190, 203, 188, 138, 153, 24, 52, 68, 67, 51, 18, 0, 168, 219, 171, 154, 40, 1, 8, 200, 191, 172, 9, 49, 67, 53, 130, 202, 220, 188, 187, 188, 170, 169, 186, 137, 128, 170, 24, 51, 129, 97, 38, 51, 21, 1, 33, 185, 171, 144, 155, 114, 85, 83, 67, 68, 34, 1, 145, 186, 172, 186, 10, 33, 17, 2, 160, 170, 81, 53, 51, 53, 2, 152, 220, 187, 153, 219, 155, 1, 1, 100, 36, 50, 3, 65, 20, 138, 49, 176, 138, 0, 40, 3, 64, 37, 168, 74, 103, 17, 82, 19, 50, 130, 170, 152, 221, 155, 152, 138, 49, 0, 115, 20, 16, 66, 18, 185, 171, 220, 189, 187, 203, 169, 186, 56, 20, 9, 66, 17, 160, 189, 137, 235, 154, 136, 169, 11, 69, 1, 9, 100, 52, 17, 66, 36, 34, 2, 136, 168, 203, 202, 203, 154, 128, 137, 50, 216, 139, 99, 52, 34, 67, 34, 49, 193, 191, 25, 160, 157, 66, 67, 53, 18, 24, 36, 160, 72, 3, 128, 186, 220, 155, 201, 156, 34, 66, 160, 104, 51, 129, 223, 171, 169, 154, 115, 55, 51, 52, 19, 129, 137, 24, 1, 24, 84, 52, 67, 1, 16, 2, 8, 128, 136, 65, 53, 67, 19, 0, 25, 94, 42, 0, 160, 222, 188, 188, 171, 137, 128, 8, 33, 145, 207, 187, 204, 170, 170, 152, 169, 205, 188, 204, 172, 154, 153, 136, 8, 128, 152, 137, 201, 188, 170, 220, 172, 154, 153, 153, 0, 145, 219, 171, 137, 0, 113, 69, 51, 18, 17, 152, 204, 154, 154, 139, 100, 52, 34, 18, 128, 203, 204, 154, 137, 136, 136, 152, 220, 172, 186, 189, 187, 170, 136, 49, 53, 36, 2, 136, 185, 189, 170, 139, 64, 99, 52, 51, 52, 128, 16, 145, 41, 87, 36, 19, 0, 152, 170, 155, 18, 72, 71, 34, 129, 187, 8, 115, 2, 24, 84, 20, 201, 153, 8, 128, 40, 36, 68, 2, 64, 37, 144, 10, 33, 186, 155, 8, 84, 52, 1, 50, 3, 9, 34, 83, 35, 17, 83, 2, 169, 153, 221, 187, 136, 34, 49, 119, 18, 152, 170, 168, 221, 172, 9, 144, 24, 36, 145, 137, 251, 172, 153, 24, 52, 67, 147, 203, 170, 189, 171, 168, 41, 36, 49, 86, 35, 129, 33, 233, 187, 153, 56, 38, 33, 35, 130, 217, 156, 154, 155, 48, 99, 20, 0, 19, 217, 154, 203, 25, 1, 33, 35, 145, 27, 22, 170, 101, 145, 187, 48, 132, 138, 119, 19, 152, 153, 0, 235, 11, 34, 65, 35, 50, 130, 187, 220, 203, 186, 10, 33, 99, 21, 8, 69, 144, 152, 251, 188, 154, 128, 98, 54, 68, 34, 33, 0, 137, 25, 17, 34, 83, 67, 35, 17, 66, 19, 17, 34, 17, 8, 84, 36, 18, 33, 184, 206, 204, 154, 154, 9, 16, 128, 8, 250, 189, 203, 187, 202, 187, 187, 188, 189, 203, 202, 203, 153, 168, 186, 153, 136, 202, 153, 201, 190, 187, 189, 173, 170, 138, 0, 1, 152, 66, 130, 154, 155, 16, 252, 11, 36, 0, 33, 51, 130, 137, 25, 119, 35, 33, 19, 184, 235, 204, 170, 154, 169, 186, 128, 154, 8, 41, 132, 191, 0, 218, 170, 219, 9, 153, 137, 169, 154, 153, 112, 36, 34, 87, 34, 34, 33, 1, 168, 154, 48, 3, 116, 37, 33, 1, 32, 17, 130, 80, 39, 128, 33, 130, 170, 152, 187, 65, 69, 51, 114, 36, 16, 18, 48, 18, 0, 168, 137, 251, 156, 137, 48, 20, 170, 40, 224, 171, 9, 69, 18, 18, 217, 170, 221, 172, 137, 1, 136, 99, 3, 16, 51, 128, 8, 169, 172, 189, 187, 207, 25, 17, 67, 36, 18, 169, 186, 219, 24, 128, 48, 148, 207, 154, 186, 138, 40, 70, 0, 50, 4, 8, 0, 24, 53, 2, 32, 131, 169, 10, 119, 35, 48, 36, 144, 186, 26, 146, 157, 34, 136, 216, 175, 152, 171, 49, 51, 69, 3, 17, 129, 206, 155, 152, 169, 154, 9, 2, 185, 114, 51, 54, 145, 138, 136, 185, 57, 103, 2, 16, 152, 188, 153, 40, 69, 51, 54, 51, 17, 169, 171, 252, 171, 186, 154, 144, 114, 22, 66, 51, 18, 216, 170, 219, 154, 82, 69, 52, 35, 18, 129, 170, 252, 48, 50, 0, 153, 49, 36, 69, 51, 50, 2, 16, 67, 2, 0, 184, 156, 9, 114, 36, 51, 1, 186, 221, 187, 170, 138, 128, 144, 218, 221, 204, 170, 171, 171, 171, 153, 187, 188, 204, 219, 187, 204, 203, 171, 170, 154, 137, 136, 153, 153, 172, 186, 188, 171, 203, 171, 188, 9, 219, 171, 186, 187, 206, 24, 128, 114, 36, 34, 18, 0, 169, 138, 17, 100, 51, 50, 200, 155, 234, 138, 145, 139, 129, 219, 188, 170, 170, 153, 221, 203, 171, 154, 138, 99, 20, 17, 52, 144, 170, 153, 16, 201, 42, 55, 18, 82, 52, 50, 2, 40, 131, 140, 82, 84, 1, 65, 161, 139, 152, 81, 19, 82, 21, 168, 170, 188, 138, 80, 37, 1, 49, 35, 161, 59, 87, 0, 49, 19, 0, 0, 2, 73, 103, 16, 34, 18, 128, 154, 152, 81, 20, 17, 34, 131, 204, 41, 51, 16, 86, 1, 48, 3, 66, 18, 52, 0, 17, 219, 154, 188, 155, 8, 52, 168, 0, 234, 235, 172, 169, 175, 144, 137, 33, 136, 33, 219, 25, 234, 10, 2, 83, 177, 27, 21, 8, 2, 32, 146, 205, 155, 24, 169, 116, 22, 24, 1, 168, 169, 25, 19, 40, 54, 16, 129, 41, 55, 16, 34, 48, 55, 153, 115, 146, 25, 130, 25, 51, 69, 36, 0, 1, 169, 81, 2, 48, 147, 9, 251, 143, 17, 17, 1, 68, 145, 170, 138, 66, 99, 3, 49, 4, 170, 170, 170, 156, 16, 24, 130, 205, 169, 80, 22, 0, 68, 176, 205, 153, 184, 189, 137, 17, 161, 25, 50, 55, 200, 153, 154, 160, 159, 101, 34, 34, 34, 130, 186, 137, 17, 65, 85, 51, 52, 34, 34, 129, 64, 131, 172, 33, 32, 54, 18, 84, 18, 128, 169, 154, 187, 9, 168, 48, 209, 188, 235, 188, 204, 187, 154, 169, 205, 154, 202, 219, 204, 186, 186, 219, 187, 169, 203, 170, 186, 203, 203, 188, 203, 171, 187, 157, 185, 203, 219, 172, 170, 154, 187, 172, 153, 186, 169, 8, 216, 172, 169, 188, 154, 32, 52, 1, 32, 18, 168, 154, 57, 85, 17, 115, 3, 24, 69, 1, 128, 17, 34, 50, 55, 82, 53, 51, 37, 34, 34, 33, 35, 66, 68, 83, 51, 83, 51, 49, 51, 128, 16, 49, 86, 35, 35, 50, 36, 144, 16, 16, 129, 138, 35, 170, 131, 190, 160, 239, 170, 203, 169, 189, 24, 185, 170, 219, 154, 220, 170, 219, 154, 137, 49, 145, 57, 22, 168, 202, 9, 144, 48, 52, 100, 35, 51, 67, 35, 52, 51, 85, 36, 51, 52, 83, 36, 18, 17, 83, 2, 40, 83, 52, 19, 34, 20, 17, 1, 16, 51, 50, 70, 2, 34, 49, 52, 129, 67, 19, 33, 0, 18, 168, 169, 255, 154, 185, 219, 187, 137, 136, 184, 158, 137, 188, 171, 235, 203, 186, 138, 145, 187, 80, 36, 16, 17, 69, 129, 139, 0, 128, 187, 114, 51, 99, 35, 33, 53, 144, 154, 41, 55, 216, 195, 13, 31, 0, 73, 22, 169, 24, 145, 137, 144, 48, 195, 158, 32, 161, 173, 136, 170, 40, 232, 156, 169, 187, 138, 202, 156, 35, 250, 27, 177, 191, 16, 184, 156, 144, 154, 152, 219, 170, 187, 153, 205, 42, 248, 171, 17, 176, 172, 67, 176, 155, 185, 137, 186, 32, 88, 119, 177, 156, 235, 203, 188, 154, 128, 66, 36, 50, 34, 128, 170, 172, 202, 138, 67, 18, 70, 36, 34, 2, 24, 0, 187, 8, 82, 70, 34, 34, 18, 144, 185, 9, 17, 84, 69, 51, 67, 19, 137, 168, 203, 187, 11, 1, 72, 39, 128, 168, 189, 220, 171, 153, 137, 0, 168, 9, 152, 221, 187, 202, 189, 170, 154, 136, 144, 185, 205, 185, 222, 170, 170, 171, 156, 8, 1, 137, 170, 154, 201, 173, 8, 169, 136, 128, 233, 172, 171, 186, 204, 138, 137, 48, 34, 18, 235, 42, 2, 186, 186, 73, 7, 137, 53, 66, 131, 11, 23, 152, 0, 32, 35, 50, 69, 52, 3, 128, 152, 169, 27, 101, 52, 37, 1, 8, 129, 17, 176, 140, 152, 138, 200, 156, 160, 204, 172, 168, 204, 9, 32, 35, 48, 177, 12, 161, 49, 251, 207, 136, 152, 40, 36, 50, 4, 8, 168, 40, 193, 13, 85, 51, 1, 1, 50, 161, 104, 146, 43, 87, 51, 52, 66, 67, 129, 8, 34, 129, 32, 68, 68, 53, 2, 66, 20, 33, 18, 83, 18, 49, 35, 50, 146, 96, 3, 24, 129, 57, 87, 17, 67, 51, 145, 171, 24, 65, 2, 9, 68, 152, 97, 160, 140, 169, 26, 16, 86, 1, 48, 130, 8, 208, 174, 137, 0, 1, 32, 36, 152, 187, 88, 163, 191, 33, 1, 130, 188, 72, 37, 168, 138, 33, 3, 187, 80, 20, 80, 69, 51, 1, 25, 18, 218, 11, 68, 177, 157, 32, 52, 176, 10, 144, 204, 157, 17, 201, 9, 67, 176, 156, 0, 168, 0, 176, 223, 154, 0, 185, 155, 186, 10, 251, 159, 169, 186, 186, 154, 1, 8, 168, 170, 239, 138, 185, 9, 160, 187, 170, 32, 250, 159, 1, 220, 138, 0, 186, 25, 129, 40, 2, 154, 152, 137, 34, 240, 175, 50, 177, 40, 168, 113, 35, 128, 153, 184, 190, 170, 171, 24, 160, 28, 68, 2, 251, 11, 2, 16, 218, 32, 250, 156, 152, 185, 139, 144, 43, 226, 158, 8, 0, 169, 154, 172, 152, 205, 169, 206, 137, 168, 137, 129, 1, 235, 154, 185, 190, 155, 1, 200, 40, 37, 169, 26, 144, 26, 146, 142, 2, 189, 98, 146, 170, 137, 40, 178, 191, 136, 170, 201, 13, 83, 33, 1, 1, 201, 24, 251, 41, 2, 40, 50, 71, 130, 9, 32, 34, 33, 23, 218, 56, 18, 128, 188, 40, 19, 18, 154, 119, 160, 72, 146, 11, 33, 81, 4, 204, 154, 16, 152, 32, 162, 137, 65, 148, 173, 153, 174, 8, 1, 18, 136, 4, 190, 8, 128, 51, 24, 38, 17, 20, 188, 48, 192, 40, 3, 66, 52, 38, 31, 254, 17, 0, 128, 137, 98, 129, 72, 37, 129, 33, 128, 16, 49, 54, 34, 82, 36, 129, 16, 19, 48, 55, 168, 73, 37, 144, 187, 115, 177, 72, 130, 171, 156, 52, 144, 64, 146, 187, 48, 3, 190, 185, 207, 10, 3, 185, 32, 200, 89, 208, 25, 249, 139, 152, 16, 200, 170, 187, 128, 57, 134, 157, 16, 152, 170, 203, 8, 177, 28, 4, 156, 67, 200, 42, 20, 172, 67, 168, 96, 2, 32, 1, 50, 145, 80, 20, 9, 115, 35, 33, 128, 64, 37, 24, 68, 128, 66, 146, 41, 37, 128, 128, 8, 101, 2, 24, 51, 17, 168, 64, 19, 138, 40, 70, 160, 57, 38, 136, 128, 50, 184, 88, 194, 44, 37, 168, 25, 36, 200, 48, 193, 26, 133, 153, 169, 41, 53, 160, 42, 21, 170, 89, 37, 169, 136, 171, 33, 172, 98, 1, 32, 51, 146, 16, 0, 85, 161, 187, 137, 119, 130, 154, 67, 129, 16, 144, 24, 34, 217, 173, 0, 9, 176, 107, 6, 155, 152, 172, 153, 185, 189, 138, 200, 140, 129, 186, 137, 184, 223, 9, 234, 11, 129, 155, 160, 138, 128, 137, 222, 56, 193, 170, 204, 25, 160, 154, 137, 184, 223, 24, 162, 155, 24, 18, 250, 138, 19, 203, 25, 201, 41, 248, 155, 1, 16, 144, 157, 169, 10, 178, 141, 36, 136, 136, 172, 97, 161, 157, 33, 251, 57, 20, 202, 137, 16, 33, 128, 203, 56, 147, 173, 128, 172, 18, 170, 36, 223, 48, 168, 154, 9, 3, 173, 129, 205, 16, 146, 204, 40, 200, 43, 20, 171, 168, 175, 136, 17, 200, 187, 11, 38, 188, 32, 186, 153, 40, 249, 223, 33, 185, 8, 168, 41, 130, 0, 128, 152, 137, 153, 65, 144, 48, 204, 49, 83, 54, 0, 16, 16, 248, 141, 2, 153, 66, 33, 68, 130, 153, 202, 42, 19, 1, 251, 42, 161, 13, 19, 24, 147, 155, 240, 27, 179, 143, 18, 138, 201, 58, 39, 153, 56, 130, 185, 143, 68, 185, 48, 249, 64, 177, 139, 1, 152, 40, 37, 152, 49, 178, 57, 146, 40, 19, 1, 205, 56, 37, 50, 219, 96, 176, 27, 52, 168, 27, 132, 158, 68, 161, 141, 50, 176, 41, 6, 154, 67, 144, 33, 17, 67, 50, 18, 83, 36, 152, 64, 2, 41, 53, 50, 38, 34, 49, 83, 35, 50, 130, 24, 84, 51, 161, 112, 18, 115, 2, 16, 136, 99, 146, 40, 2, 137, 34, 168, 115, 36, 168, 40, 55, 169, 64, 145, 41, 179, 13, 3, 24, 19, 49, 129, 114, 132, 155, 65, 67, 176, 28, 161, 140, 152, 154, 56, 38, 8, 37, 145, 186, 89, 4, 171, 161, 175, 84, 200, 9, 19, 192, 171, 66, 177, 191, 34, 200, 40, 192, 27, 4, 154, 184, 142, 16, 128, 186, 25, 131, 57, 248, 15, 129, 172, 34, 184, 41, 17, 145, 13, 38, 203, 32, 168, 185, 11, 147, 175, 33, 160, 189, 154, 16, 36, 186, 219, 172, 152, 10, 76, 0, 7, 0, 145, 11, 250, 29, 5, 202, 16, 128, 185, 26, 146, 175, 17, 168, 138, 9, 201, 12, 192, 44, 212, 157, 129, 154, 185, 26, 147, 191, 41, 3, 139, 128, 56, 249, 141, 160, 8, 169, 185, 175, 66, 17, 184, 140, 0, 8, 234, 41, 3, 188, 138, 17, 33, 162, 174, 50, 160, 188, 41, 20, 189, 112, 161, 12, 17, 32, 147, 11, 2, 16, 24, 135, 207, 66, 129, 0, 9, 0, 138, 144, 96, 129, 56, 4, 154, 51, 216, 58, 39, 33, 0, 48, 51, 20, 202, 65, 3, 1, 48, 38, 170, 100, 145, 40, 176, 112, 21, 137, 16, 186, 114, 3, 155, 1, 49, 129, 96, 19, 25, 68, 168, 41, 146, 27, 34, 53, 0, 68, 219, 114, 130, 137, 67, 184, 57, 4, 40, 161, 33, 205, 98, 16, 34, 155, 85, 168, 56, 145, 27, 35, 16, 203, 113, 163, 140, 36, 168, 32, 144, 40, 21, 129, 185, 156, 115, 161, 12, 36, 0, 17, 8, 2, 207, 56, 147, 139, 34, 136, 184, 89, 132, 11, 129, 0, 249, 157, 48, 4, 138, 34, 1, 219, 32, 250, 42, 177, 41, 20, 51, 53, 208, 11, 132, 190, 49, 168, 154, 9, 53, 176, 32, 185, 64, 178, 159, 83, 232, 10, 1, 152, 137, 17, 145, 9, 48, 86, 129, 154, 169, 49, 208, 27, 68, 168, 10, 177, 155, 24, 55, 236, 41, 146, 169, 170, 80, 146, 205, 26, 4, 201, 24, 17, 1, 202, 32, 0, 168, 157, 50, 200, 138, 154, 24, 146, 204, 174, 25, 83, 145, 172, 66, 20, 187, 48, 249, 10, 2, 154, 202, 10, 20, 202, 10, 35, 200, 48, 163, 207, 24, 145, 188, 40, 177, 159, 81, 2, 152, 136, 136, 201, 25, 194, 158, 50, 129, 136, 169, 138, 128, 207, 72, 130, 10, 144, 154, 128, 153, 20, 200, 170, 170, 9, 51, 186, 115, 209, 10, 2, 40, 178, 143, 17, 8, 51, 251, 41, 192, 27, 146, 158, 16, 34, 144, 169, 191, 97, 146, 9, 160, 58, 6, 153, 153, 41, 18, 170, 139, 51, 49, 20, 249, 157, 17, 145, 140, 33, 153, 66, 217, 27, 5, 202, 138, 34, 152, 0, 136, 101, 129, 170, 138, 201, 75, 6, 154, 16, 18, 201, 73, 179, 140, 192, 13, 36, 185, 8, 49, 2, 202, 138, 115, 129, 40, 163, 156, 160, 174, 137, 56, 55, 202, 25, 152, 49, 1, 1, 153, 115, 129, 190, 81, 130, 154, 65, 2, 204, 9, 1, 8, 33, 0, 84, 2, 9, 185, 173, 33, 19, 169, 64, 18, 71, 130, 16, 250, 72, 147, 13, 51, 186, 56, 3, 170, 26, 103, 145, 10, 36, 160, 25, 19, 184, 156, 153, 96, 4, 170, 24, 161, 27, 38, 152, 152, 170, 70, 233, 9, 1, 33, 144, 16, 144, 65, 240, 26, 19, 1, 152, 8, 16, 4, 252, 9, 0, 16, 168, 72, 146, 158, 65, 176, 11, 84, 192, 157, 168, 58, 37, 186, 187, 64, 19, 249, 255, 8, 0, 168, 187, 112, 131, 154, 33, 1, 251, 58, 4, 27, 52, 217, 11, 2, 169, 9, 50, 54, 200, 204, 155, 83, 18, 3, 187, 35, 154, 49, 53, 248, 59, 7, 152, 9, 0, 27, 4, 172, 34, 0, 129, 25, 16, 36, 253, 57, 37, 161, 140, 83, 129, 186, 41, 3, 10, 70, 129, 153, 9, 152, 17, 235, 112, 4, 136, 146, 191, 64, 3, 128, 154, 65, 20, 169, 188, 42, 51, 34, 203, 57, 2, 217, 139, 217, 96, 162, 72, 147, 112, 4, 170, 137, 232, 156, 65, 115, 19, 184, 188, 155, 188, 26, 0, 24, 1, 81, 146, 8, 50, 103, 200, 43, 21, 203, 172, 40, 69, 85, 53, 192, 189, 138, 16, 17, 0, 152, 138, 33, 128, 17, 145, 171, 8, 24, 54, 184, 137, 160, 189, 25, 240, 139, 128, 115, 23, 8, 152, 156, 153, 25, 52, 18, 145, 187, 169, 72, 38, 33, 184, 189, 154, 80, 5, 153, 49, 144, 204, 156, 16, 136, 33, 145, 64, 130, 154, 152, 25, 36, 33, 131, 175, 114, 100, 53, 131, 186, 189, 41, 101, 19, 216, 221, 138, 49, 53, 129, 221, 154, 49, 53, 18, 184, 175, 138, 0, 51, 36, 144, 203, 171, 24, 67, 52, 176, 220, 156, 81, 53, 2, 202, 189, 154, 81, 36, 145, 172, 154, 48, 36, 130, 218, 156, 32, 34, 1, 0, 202, 139, 18, 17, 52, 176, 157, 152, 8, 34, 168, 186, 191, 27, 53, 68, 35, 250, 171, 56, 52, 1, 202, 189, 41, 53, 19, 160, 173, 9, 16, 65, 18, 186, 170, 24, 50, 161, 173, 0, 144, 25, 128, 50, 192, 190, 172, 25, 1, 116, 162, 191, 25, 50, 37, 145, 234, 173, 24, 52, 19, 186, 173, 8, 36, 1, 136, 169, 41, 39, 185, 154, 32, 51, 234, 187, 113, 21, 200, 170, 9, 68, 35, 184, 189, 8, 49, 51, 145, 221, 155, 50, 83, 34, 218, 172, 16, 34, 1, 152, 219, 10, 50, 18, 8, 34, 178, 255, 25, 2, 0, 18, 200, 173, 48, 53, 161, 205, 8, 49, 18, 128, 176, 205, 57, 37, 0, 153, 188, 26, 53, 2, 168, 153, 168, 187, 65, 161, 44, 23, 186, 40, 67, 52, 249, 171, 128, 16, 69, 147, 220, 9, 17, 0, 128, 153, 170, 66, 18, 32, 184, 174, 9, 0, 99, 131, 204, 153, 49, 36, 129, 186, 155, 128, 40, 36, 153, 41, 38, 168, 80, 193, 10, 176, 91, 55, 203, 56, 176, 142, 67, 161, 175, 48, 37, 136, 137, 169, 9, 144, 171, 0, 136, 113, 23, 184, 10, 2, 137, 16, 169, 203, 170, 81, 19, 136, 65, 129, 27, 22, 221, 73, 3, 170, 137, 8, 8, 66, 161, 140, 17, 153, 102, 35, 233, 138, 8, 0, 169, 32, 217, 74, 38, 153, 24, 216, 139, 83, 3, 218, 138, 65, 2, 170, 136, 202, 96, 4, 153, 138, 16, 1, 35, 216, 172, 153, 56, 52, 128, 80, 2, 220, 26, 19, 154, 113, 1, 55, 0, 1, 190, 33, 185, 97, 146, 171, 129, 136, 115, 36, 168, 173, 170, 64, 21, 200, 170, 33, 1, 65, 35, 177, 190, 9, 153, 40, 68, 129, 136, 152, 204, 80, 133, 186, 33, 34, 3, 187, 185, 207, 16, 217, 26, 53, 131, 24, 19, 16, 179, 255, 139, 8, 34, 1, 0, 153, 0, 170, 116, 133, 188, 137, 16, 49, 35, 1, 237, 138, 0, 16, 52, 3, 201, 171, 81, 19, 220, 138, 0, 32, 51, 1, 8, 202, 26, 20, 144, 236, 171, 48, 53, 18, 144, 219, 190, 26, 35, 152, 34, 170, 117, 132, 170, 154, 137, 136, 25, 19, 168, 10, 84, 50, 53, 176, 191, 138, 49, 35, 129, 185, 138, 16, 82, 69, 2, 204, 10, 17, 144, 40, 147, 172, 114, 130, 187, 40, 52, 52, 19, 251, 158, 16, 128, 16, 129, 189, 9, 0, 65, 39, 130, 219, 138, 128, 153, 154, 24, 85, 18, 186, 139, 33, 19, 129, 253, 172, 64, 19, 1, 0, 152, 170, 139, 153, 89, 55, 128, 128, 170, 137, 137, 144, 191, 32, 129, 9, 97, 53, 0, 152, 204, 154, 171, 9, 115, 37, 160, 186, 9, 48, 69, 129, 204, 171, 153, 82, 53, 130, 235, 155, 16, 18, 0, 8, 8, 65, 36, 184, 190, 137, 33, 3, 204, 138, 50, 103, 18, 169, 188, 138, 33, 2, 0, 83, 130, 219, 170, 48, 53, 130, 205, 138, 50, 37, 129, 186, 170, 138, 33, 144, 137, 24, 118, 18, 170, 137, 185, 138, 51, 2, 49, 240, 191, 42, 69, 18, 152, 185, 157, 32, 19, 184, 173, 136, 0, 80, 37, 129, 170, 203, 136, 16, 83, 184, 174, 24, 51, 177, 41, 5, 169, 99, 130, 220, 170, 8, 17, 146, 202, 171, 40, 83, 36, 51, 20, 236, 171, 171, 57, 37, 33, 176, 189, 153, 65, 3, 136, 160, 186, 235, 138, 33, 20, 203, 137, 169, 115, 128, 56, 163, 158, 16, 136, 16, 17, 100, 53, 35, 152, 9, 201, 157, 82, 130, 48, 20, 24, 33, 115, 130, 170, 168, 10, 36, 144, 50, 67, 2, 235, 170, 170, 24, 101, 20, 129, 184, 174, 186, 171, 8, 32, 35, 49, 23, 185, 137, 235, 187, 207, 10, 1, 17, 1, 17, 168, 154, 218, 205, 154, 0, 34, 0, 24, 1, 221, 172, 32, 17, 137, 99, 3, 24, 176, 190, 138, 169, 170, 114, 68, 1, 16, 128, 201, 189, 9, 1, 152, 24, 69, 129, 136, 185, 9, 184, 153, 191, 115, 130, 48, 145, 171, 220, 56, 146, 114, 4, 16, 146, 186, 137, 128, 32, 4, 24, 129, 120, 55, 17, 18, 137, 34, 204, 9, 48, 54, 17, 33, 177, 207, 40, 2, 66, 51, 130, 188, 137, 0, 170, 50, 203, 118, 160, 171, 24, 83, 1, 185, 203, 187, 136, 153, 87, 128, 33, 176, 154, 219, 138, 66, 20, 153, 203, 154, 136, 0, 56, 38, 169, 56, 53, 146, 219, 138, 67, 249, 156, 8, 24, 51, 18, 17, 115, 8, 39, 0, 36, 201, 10, 192, 157, 32, 36, 18, 48, 130, 221, 139, 50, 208, 156, 0, 48, 20, 170, 81, 144, 187, 48, 253, 13, 161, 26, 53, 129, 137, 129, 251, 155, 32, 83, 18, 136, 18, 234, 24, 200, 156, 144, 155, 32, 50, 51, 87, 2, 169, 203, 171, 170, 9, 144, 203, 72, 38, 202, 64, 146, 41, 51, 36, 2, 217, 189, 169, 205, 25, 52, 66, 34, 8, 2, 219, 153, 185, 204, 25, 34, 49, 34, 85, 52, 132, 205, 8, 202, 156, 8, 17, 51, 52, 34, 160, 174, 144, 186, 9, 51, 177, 175, 152, 9, 34, 9, 85, 2, 8, 1, 200, 187, 184, 255, 138, 152, 137, 83, 36, 17, 34, 35, 201, 173, 137, 153, 9, 24, 98, 51, 34, 52, 36, 17, 144, 154, 184, 158, 32, 17, 66, 51, 52, 0, 8, 16, 71, 192, 139, 130, 191, 137, 152, 8, 32, 34, 185, 139, 250, 188, 137, 204, 139, 201, 155, 186, 25, 19, 138, 162, 207, 187, 191, 8, 184, 42, 161, 12, 146, 158, 67, 144, 25, 18, 201, 188, 187, 10, 50, 55, 52, 37, 153, 32, 184, 114, 160, 41, 131, 0, 186, 80, 51, 68, 2, 32, 4, 173, 17, 186, 0, 186, 83, 234, 155, 34, 51, 70, 50, 130, 220, 169, 251, 138, 128, 50, 4, 56, 21, 154, 65, 145, 156, 8, 201, 140, 49, 1, 84, 19, 128, 1, 202, 43, 20, 41, 38, 170, 115, 162, 172, 32, 18, 136, 82, 36, 129, 9, 18, 219, 24, 185, 64, 19, 32, 100, 35, 33, 18, 152, 250, 173, 169, 32, 161, 120, 5, 24, 130, 156, 1, 186, 40, 146, 189, 24, 176, 138, 0, 49, 179, 28, 148, 140, 161, 14, 3, 205, 154, 10, 132, 175, 50, 2, 65, 145, 171, 16, 251, 142, 51, 129, 16, 18, 16, 160, 27, 20, 235, 139, 48, 129, 202, 96, 147, 157, 18, 202, 32, 169, 83, 169, 84, 217, 138, 235, 137, 168, 58, 38, 0, 51, 216, 187, 202, 153, 169, 25, 145, 155, 50, 34, 20, 8, 70, 216, 170, 222, 26, 2, 154, 83, 129, 2, 186, 96, 19, 48, 146, 41, 250, 255, 8, 8, 33, 33, 68, 129, 137, 152, 9, 233, 155, 16, 1, 185, 112, 22, 152, 24, 0, 185, 171, 64, 35, 186, 72, 178, 223, 138, 169, 64, 21, 24, 36, 161, 186, 155, 250, 141, 17, 128, 34, 0, 83, 18, 168, 155, 136, 203, 170, 113, 6, 8, 20, 235, 186, 188, 8, 0, 83, 84, 35, 169, 136, 235, 155, 154, 8, 16, 52, 67, 20, 17, 49, 176, 171, 235, 172, 25, 33, 33, 84, 35, 1, 136, 137, 10, 34, 136, 176, 191, 201, 173, 136, 48, 53, 50, 51, 145, 252, 155, 168, 175, 137, 169, 24, 152, 97, 34, 18, 168, 136, 222, 171, 169, 137, 153, 32, 18, 65, 18, 83, 18, 1, 234, 171, 251, 155, 0, 82, 35, 50, 37, 144, 137, 1, 16, 129, 153, 154, 79, 245, 35, 0, 33, 169, 116, 69, 18, 24, 52, 201, 137, 0, 216, 173, 9, 145, 9, 51, 116, 19, 169, 0, 251, 171, 154, 25, 16, 49, 53, 18, 18, 170, 17, 250, 175, 136, 128, 34, 50, 55, 18, 129, 186, 154, 171, 139, 40, 101, 19, 33, 84, 18, 128, 136, 16, 184, 159, 49, 18, 65, 35, 83, 146, 173, 8, 128, 49, 83, 54, 146, 169, 205, 171, 203, 8, 82, 22, 0, 16, 184, 204, 138, 153, 155, 49, 2, 49, 176, 120, 6, 203, 154, 0, 235, 10, 67, 33, 20, 144, 17, 250, 157, 0, 129, 0, 51, 3, 128, 152, 153, 48, 132, 174, 65, 161, 188, 41, 38, 168, 64, 2, 144, 154, 0, 169, 235, 173, 128, 235, 25, 17, 66, 35, 128, 25, 240, 175, 153, 154, 137, 48, 20, 8, 52, 129, 154, 24, 232, 172, 170, 136, 169, 114, 4, 32, 37, 153, 0, 16, 129, 154, 0, 221, 153, 171, 114, 3, 48, 55, 128, 40, 144, 173, 8, 234, 155, 0, 171, 114, 19, 16, 34, 131, 189, 152, 236, 138, 136, 0, 8, 83, 177, 139, 130, 220, 26, 1, 152, 185, 191, 24, 18, 186, 89, 38, 217, 138, 33, 208, 139, 34, 137, 17, 168, 8, 67, 240, 59, 39, 219, 24, 8, 33, 32, 20, 49, 134, 172, 9, 24, 144, 28, 54, 152, 144, 170, 250, 156, 153, 40, 38, 17, 33, 129, 169, 154, 251, 138, 129, 25, 3, 114, 52, 18, 8, 51, 234, 137, 153, 17, 16, 71, 18, 33, 128, 129, 188, 50, 128, 68, 18, 146, 141, 19, 206, 33, 184, 56, 145, 136, 185, 152, 223, 24, 251, 138, 128, 9, 153, 49, 144, 184, 223, 153, 203, 10, 136, 40, 35, 1, 8, 208, 174, 8, 152, 10, 67, 161, 41, 3, 42, 87, 34, 35, 2, 1, 34, 147, 173, 34, 17, 99, 115, 51, 48, 39, 136, 128, 170, 218, 156, 0, 154, 81, 35, 2, 152, 201, 204, 186, 188, 9, 144, 174, 48, 178, 191, 32, 130, 154, 34, 0, 161, 255, 24, 176, 10, 34, 66, 52, 129, 97, 146, 139, 1, 155, 0, 25, 119, 129, 50, 19, 16, 129, 155, 35, 153, 114, 20, 2, 9, 69, 176, 43, 38, 185, 41, 51, 160, 172, 153, 168, 234, 188, 25, 144, 170, 113, 19, 251, 155, 168, 191, 155, 33, 128, 48, 38, 168, 170, 219, 188, 9, 0, 64, 36, 168, 40, 131, 172, 115, 144, 138, 144, 170, 40, 68, 83, 35, 153, 67, 249, 10, 50, 2, 49, 54, 145, 170, 153, 136, 66, 70, 51, 17, 18, 218, 155, 8, 0, 114, 3, 32, 129, 32, 145, 25, 144, 32, 255, 159, 0, 1, 24, 84, 18, 152, 203, 171, 169, 188, 57, 23, 137, 2, 172, 16, 176, 64, 36, 144, 172, 152, 188, 153, 26, 36, 202, 137, 128, 34, 50, 39, 161, 222, 173, 136, 220, 25, 36, 128, 18, 129, 154, 145, 205, 56, 148, 139, 34, 184, 9, 17, 24, 119, 253, 33, 0, 37, 185, 88, 224, 188, 152, 202, 171, 24, 169, 154, 170, 82, 146, 104, 132, 155, 249, 188, 153, 154, 24, 83, 52, 35, 17, 136, 202, 153, 186, 56, 19, 65, 35, 119, 1, 40, 20, 128, 144, 172, 49, 184, 97, 19, 33, 36, 144, 24, 144, 40, 18, 116, 177, 44, 132, 172, 17, 24, 22, 8, 52, 169, 25, 218, 138, 170, 10, 2, 9, 69, 2, 48, 4, 189, 138, 220, 186, 12, 38, 8, 68, 144, 24, 152, 170, 156, 49, 160, 115, 132, 9, 18, 0, 2, 144, 8, 35, 251, 29, 145, 48, 149, 11, 54, 185, 139, 82, 192, 140, 18, 1, 202, 140, 35, 201, 155, 100, 130, 171, 32, 129, 220, 139, 49, 192, 26, 22, 8, 146, 156, 34, 218, 42, 20, 152, 17, 1, 24, 17, 137, 99, 18, 25, 52, 33, 55, 128, 48, 35, 200, 105, 5, 136, 52, 36, 146, 24, 147, 175, 35, 234, 80, 35, 136, 32, 18, 220, 138, 128, 40, 160, 88, 21, 168, 202, 27, 4, 237, 25, 3, 218, 26, 129, 152, 153, 16, 217, 138, 220, 25, 177, 27, 4, 156, 17, 251, 138, 152, 155, 18, 220, 64, 193, 140, 2, 170, 33, 185, 40, 193, 174, 24, 2, 169, 113, 146, 155, 146, 11, 146, 106, 22, 155, 32, 233, 155, 32, 2, 80, 20, 136, 17, 203, 187, 25, 3, 155, 103, 129, 8, 33, 17, 153, 8, 184, 25, 217, 27, 119, 130, 24, 37, 169, 9, 16, 1, 137, 113, 51, 168, 25, 20, 0, 34, 81, 55, 160, 26, 18, 204, 10, 67, 1, 32, 52, 18, 169, 0, 251, 41, 179, 142, 51, 152, 114, 129, 9, 2, 219, 186, 154, 1, 202, 113, 5, 153, 16, 169, 186, 187, 24, 69, 176, 26, 34, 249, 191, 65, 160, 56, 21, 32, 161, 12, 176, 158, 169, 25, 53, 144, 32, 34, 161, 207, 49, 177, 142, 19, 153, 128, 137, 152, 98, 248, 14, 35, 152, 32, 33, 146, 173, 251, 158, 136, 154, 65, 35, 68, 2, 153, 170, 204, 173, 25, 17, 32, 66, 51, 20, 152, 10, 129, 252, 154, 17, 152, 82, 35, 34, 34, 145, 187, 155, 250, 138, 51, 8, 18, 32, 2, 41, 37, 8, 130, 255, 155, 169, 190, 41, 2, 25, 21, 0, 1, 220, 170, 187, 188, 172, 24, 17, 17, 68, 3, 168, 170, 206, 187, 154, 137, 48, 53, 16, 37, 129, 0, 153, 50, 217, 25, 160, 186, 120, 37, 66, 52, 18, 50, 128, 188, 154, 8, 200, 121, 37, 0, 65, 34, 160, 171, 50, 217, 139, 128, 98, 177, 43, 23, 152, 0, 16, 144, 171, 9, 201, 10, 160, 13, 19, 235, 40, 4, 32, 35, 201, 170, 155, 252, 172, 65, 2, 0, 32, 55, 160, 24, 20, 144, 139, 16, 8, 160, 74, 119, 131, 49, 35, 1, 153, 32, 200, 11, 19, 32, 55, 34, 53, 19, 33, 51, 200, 140, 251, 173, 128, 137, 49, 100, 19, 1, 144, 253, 16, 37, 0, 186, 251, 173, 137, 128, 186, 88, 19, 187, 81, 145, 10, 200, 174, 136, 220, 138, 17, 8, 50, 51, 144, 188, 186, 222, 26, 1, 154, 65, 130, 204, 41, 3, 139, 68, 184, 24, 145, 190, 56, 147, 141, 52, 160, 9, 18, 1, 128, 170, 98, 248, 140, 129, 153, 41, 68, 161, 155, 17, 251, 140, 18, 200, 8, 0, 144, 188, 115, 176, 41, 132, 171, 169, 27, 132, 187, 81, 18, 160, 42, 55, 185, 57, 37, 176, 41, 180, 141, 39, 144, 64, 3, 137, 33, 3, 170, 116, 147, 26, 21, 202, 24, 51, 130, 64, 71, 168, 10, 145, 172, 66, 1, 64, 2, 188, 65, 147, 186, 114, 3, 205, 10, 130, 203, 64, 3, 25, 20, 201, 140, 0, 235, 41, 132, 187, 49, 145, 137, 83, 192, 42, 178, 191, 138, 48, 4, 41, 22, 144, 168, 170, 206, 25, 145, 41, 36, 16, 17, 152, 10, 67, 252, 11, 19, 169, 155, 84, 18, 192, 11, 38, 201, 171, 64, 3, 155, 81, 50, 192, 171, 128, 138, 168, 13, 67, 1, 221, 26, 177, 174, 1, 16, 83, 36, 161, 10, 184, 175, 137, 8, 67, 53, 17, 48, 20, 169, 187, 57, 179, 159, 83, 34, 32, 38, 129, 32, 192, 157, 136, 185, 57, 55, 129, 17, 130, 185, 138, 201, 190, 8, 184, 138, 153, 40, 146, 10, 250, 14, 176, 174, 152, 171, 187, 40, 250, 10, 2, 154, 1, 24, 208, 189, 188, 138, 234, 41, 36, 18, 168, 97, 162, 174, 48, 128, 41, 19, 10, 35, 24, 103, 144, 56, 4, 152, 144, 11, 68, 144, 114, 2, 0, 128, 0, 2, 187, 115, 148, 26, 2, 25, 146, 59, 103, 152, 48, 145, 156, 152, 154, 50, 201, 113, 20, 136, 128, 137, 153, 205, 25, 160, 73, 22, 136, 24, 129, 153, 184, 173, 8, 202, 138, 67, 53, 129, 24, 129, 222, 154, 137, 40, 20, 8, 54, 162, 171, 0, 33, 177, 142, 85, 161, 10, 39, 152, 56, 131, 172, 24, 17, 66, 35, 0, 66, 224, 173, 9, 17, 32, 53, 33, 38, 250, 10, 160, 156, 17, 0, 36, 184, 24, 218, 138, 145, 187, 80, 209, 157, 0, 153, 0, 9, 21, 202, 136, 204, 136, 170, 33, 16, 21, 188, 32, 204, 40, 144, 34, 184, 64, 193, 175, 81, 146, 9, 36, 154, 33, 202, 80, 129, 40, 132, 9, 176, 141, 36, 144, 97, 2, 9, 4, 205, 56, 177, 58, 20, 8, 144, 40, 161, 11, 37, 1, 225, 175, 8, 201, 73, 20, 16, 36, 201, 137, 235, 10, 1, 48, 36, 17, 176, 174, 152, 139, 50, 83, 20, 160, 136, 201, 189, 40, 145, 89, 3, 140, 19, 9, 21, 169, 16, 251, 187, 187, 96, 18, 32, 71, 146, 172, 137, 201, 139, 2, 41, 55, 160, 40, 131, 172, 154, 137, 16, 234, 26, 35, 24, 71, 145, 97, 161, 157, 153, 156, 0, 137, 84, 1, 16, 161, 173, 168, 186, 42, 164, 245, 42, 0, 38, 34, 20, 153, 32, 235, 25, 144, 113, 146, 41, 21, 136, 0, 0, 1, 168, 137, 67, 129, 114, 20, 17, 152, 24, 249, 140, 17, 8, 67, 3, 128, 217, 187, 144, 220, 9, 130, 137, 144, 219, 8, 251, 10, 161, 155, 176, 191, 128, 205, 24, 161, 139, 4, 188, 16, 200, 11, 161, 173, 153, 172, 48, 3, 96, 4, 138, 161, 190, 8, 170, 114, 3, 16, 52, 177, 26, 3, 157, 33, 17, 37, 128, 84, 129, 16, 34, 145, 24, 4, 11, 36, 186, 101, 2, 32, 51, 20, 184, 41, 19, 239, 40, 18, 16, 2, 64, 20, 186, 25, 162, 25, 240, 141, 37, 170, 81, 145, 16, 176, 157, 0, 187, 113, 129, 41, 147, 157, 1, 187, 66, 160, 80, 131, 172, 201, 12, 36, 185, 113, 132, 138, 18, 203, 64, 145, 27, 18, 24, 184, 121, 21, 137, 33, 128, 153, 220, 26, 19, 154, 102, 130, 8, 184, 137, 200, 138, 52, 18, 136, 16, 249, 171, 186, 88, 22, 137, 17, 202, 171, 170, 154, 83, 129, 32, 176, 155, 233, 11, 51, 128, 168, 191, 153, 190, 49, 144, 116, 146, 170, 152, 219, 9, 168, 116, 146, 11, 3, 204, 16, 153, 64, 145, 40, 194, 157, 18, 219, 80, 130, 137, 1, 171, 153, 136, 50, 34, 68, 1, 234, 139, 130, 42, 87, 128, 1, 137, 160, 159, 48, 0, 81, 146, 155, 130, 189, 48, 19, 81, 20, 0, 129, 255, 40, 144, 10, 35, 17, 129, 9, 178, 173, 50, 35, 161, 205, 24, 232, 142, 99, 130, 9, 131, 186, 170, 188, 81, 161, 73, 6, 154, 129, 172, 33, 233, 56, 131, 173, 16, 169, 24, 145, 113, 3, 188, 0, 201, 138, 32, 81, 19, 153, 1, 155, 34, 251, 26, 36, 251, 41, 3, 10, 55, 160, 41, 162, 174, 153, 8, 1, 137, 82, 36, 219, 156, 128, 144, 186, 89, 23, 152, 24, 0, 170, 154, 16, 136, 82, 35, 24, 85, 161, 10, 130, 139, 4, 189, 100, 2, 8, 1, 33, 133, 189, 72, 146, 9, 35, 16, 19, 171, 2, 187, 82, 145, 58, 23, 188, 24, 202, 24, 200, 43, 54, 1, 169, 156, 184, 239, 10, 160, 24, 4, 9, 19, 168, 204, 171, 202, 173, 0, 0, 51, 35, 176, 24, 253, 157, 8, 128, 154, 97, 130, 10, 36, 200, 11, 18, 201, 137, 48, 4, 187, 82, 160, 56, 2, 42, 37, 251, 27, 130, 191, 48, 18, 33, 1, 67, 177, 141, 2, 207, 56, 3, 26, 68, 1, 33, 128, 33, 233, 157, 0, 153, 67, 34, 55, 145, 10, 128, 218, 155, 8, 67, 2, 10, 84, 145, 171, 96, 162, 158, 67, 176, 138, 136, 114, 130, 24, 18, 168, 171, 202, 157, 49, 20, 50, 22, 168, 40, 176, 157, 0, 152, 137, 65, 130, 139, 119, 2, 171, 98, 176, 140, 0, 155, 24, 83, 2, 40, 2, 136, 251, 12, 35, 128, 128, 16, 177, 175, 9, 68, 201, 8, 43, 0, 146, 41, 39, 200, 171, 9, 0, 137, 64, 20, 160, 156, 9, 185, 25, 146, 10, 241, 157, 144, 190, 32, 129, 154, 34, 200, 138, 176, 175, 128, 168, 187, 50, 234, 72, 36, 19, 153, 1, 188, 160, 223, 40, 169, 88, 18, 50, 67, 19, 206, 152, 204, 40, 131, 64, 38, 128, 154, 16, 235, 26, 50, 129, 25, 36, 136, 136, 8, 34, 130, 218, 191, 25, 201, 74, 71, 152, 40, 178, 175, 25, 152, 41, 36, 0, 16, 128, 169, 24, 177, 175, 82, 200, 155, 66, 130, 73, 55, 161, 8, 217, 170, 170, 32, 33, 71, 2, 32, 128, 218, 172, 128, 203, 72, 20, 16, 34, 18, 185, 203, 187, 172, 154, 41, 85, 51, 0, 32, 193, 189, 137, 136, 136, 153, 97, 130, 173, 33, 168, 25, 35, 65, 3, 236, 154, 217, 172, 48, 3, 24, 87, 161, 154, 168, 187, 139, 51, 184, 112, 161, 172, 186, 138, 152, 97, 146, 113, 3, 153, 202, 137, 235, 25, 18, 83, 19, 51, 4, 168, 220, 9, 168, 154, 113, 37, 16, 18, 16, 145, 158, 153, 138, 1, 88, 38, 136, 51, 129, 202, 27, 161, 156, 168, 57, 208, 58, 6, 25, 54, 185, 41, 208, 175, 0, 185, 9, 32, 20, 153, 52, 184, 10, 250, 171, 202, 186, 8, 51, 49, 55, 3, 185, 173, 235, 154, 137, 8, 51, 1, 64, 55, 169, 41, 161, 191, 153, 128, 152, 113, 3, 0, 51, 168, 169, 139, 184, 239, 40, 129, 48, 18, 80, 37, 184, 10, 2, 204, 138, 1, 67, 144, 115, 3, 8, 18, 136, 2, 251, 11, 131, 156, 99, 35, 34, 66, 146, 174, 137, 187, 24, 0, 66, 54, 1, 8, 2, 137, 131, 223, 40, 168, 155, 68, 2, 65, 130, 153, 160, 189, 57, 3, 138, 51, 168, 1, 255, 24, 129, 32, 69, 145, 188, 32, 251, 138, 51, 18, 32, 67, 145, 202, 156, 33, 160, 154, 96, 37, 184, 57, 23, 200, 9, 50, 144, 188, 138, 66, 192, 157, 98, 146, 170, 32, 3, 203, 138, 35, 208, 174, 24, 129, 155, 97, 21, 168, 8, 161, 204, 171, 9, 1, 16, 51, 20, 201, 10, 217, 156, 17, 152, 128, 170, 220, 138, 2, 48, 38, 33, 21, 250, 138, 33, 184, 140, 1, 204, 25, 19, 114, 23, 128, 128, 202, 188, 136, 16, 64, 52, 3, 2, 217, 171, 137, 153, 155, 82, 19, 16, 85, 35, 128, 152, 251, 187, 170, 56, 85, 34, 35, 34, 184, 207, 137, 136, 152, 26, 70, 144, 25, 34, 152, 32, 176, 190, 168, 251, 26, 35, 1, 82, 34, 144, 202, 186, 202, 170, 155, 128, 72, 38, 16, 84, 19, 200, 172, 186, 188, 187, 56, 70, 50, 1, 32, 161, 223, 137, 136, 154, 16, 18, 16, 18, 136, 136, 236, 187, 136, 136, 65, 21, 152, 16, 35, 144, 104, 20, 160, 205, 26, 51, 0, 98, 53, 130, 9, 145, 171, 1, 172, 115, 147, 41, 1, 2, 40, 0, 71, 144, 25, 18, 186, 26, 131, 155, 97, 51, 136, 48, 240, 141, 145, 138, 67, 34, 18, 128, 252, 172, 186, 138, 52, 51, 18, 129, 251, 157, 186, 9, 146, 9, 51, 176, 189, 10, 128, 136, 16, 145, 174, 218, 174, 128, 9, 36, 0, 51, 200, 10, 16, 152, 236, 203, 155, 17, 65, 55, 50, 147, 189, 144, 207, 8, 144, 48, 37, 18, 153, 33, 249, 138, 128, 136, 1, 2, 8, 36, 201, 81, 145, 25, 152, 116, 130, 58, 132, 189, 169, 138, 34, 115, 21, 1, 128, 202, 187, 155, 24, 82, 38, 161, 40, 129, 154, 128, 0, 170, 0, 190, 113, 129, 65, 53, 146, 170, 152, 186, 156, 84, 18, 52, 145, 186, 72, 132, 173, 82, 130, 171, 136, 153, 24, 100, 51, 34, 146, 189, 153, 206, 138, 24, 52, 33, 69, 144, 155, 169, 169, 171, 81, 1, 82, 131, 138, 145, 155, 168, 28, 241, 157, 0, 137, 18, 32, 53, 161, 187, 186, 205, 189, 40, 131, 154, 50, 5, 203, 80, 130, 153, 40, 4, 223, 10, 0, 40, 50, 52, 184, 203, 203, 171, 153, 32, 55, 130, 153, 200, 187, 186, 120, 5, 137, 19, 188, 136, 8, 17, 98, 35, 169, 169, 187, 113, 132, 26, 130, 206, 8, 17, 34, 68, 129, 137, 153, 221, 139, 35, 170, 98, 131, 152, 40, 54, 218, 139, 128, 0, 170, 97, 37, 128, 129, 152, 218, 175, 32, 130, 10, 68, 128, 10, 8, 136, 203, 137, 202, 139, 8, 101, 18, 48, 5, 219, 170, 171, 24, 35, 33, 54, 161, 172, 152, 170, 56, 17, 65, 146, 171, 235, 9, 161, 24, 193, 104, 194, 141, 1, 16, 176, 158, 0, 217, 139, 52, 0, 66, 19, 204, 16, 218, 139, 128, 153, 57, 119, 2, 48, 2, 186, 219, 153, 138, 48, 34, 55, 35, 168, 56, 148, 206, 25, 34, 144, 0, 32, 20, 187, 24, 25, 2, 74, 87, 2, 170, 137, 251, 188, 41, 36, 50, 53, 129, 170, 235, 188, 171, 16, 52, 67, 36, 0, 152, 205, 170, 172, 9, 1, 114, 18, 8, 2, 219, 171, 8, 152, 65, 20, 136, 144, 221, 10, 129, 25, 84, 35, 152, 137, 235, 154, 169, 48, 52, 33, 50, 144, 204, 219, 138, 128, 187, 112, 36, 128, 49, 144, 172, 170, 205, 137, 18, 8, 87, 130, 8, 1, 201, 172, 9, 144, 58, 54, 33, 33, 146, 172, 152, 191, 32, 145, 25, 36, 67, 161, 25, 184, 188, 204, 57, 36, 24, 117, 130, 170, 16, 201, 171, 16, 52, 17, 51, 146, 188, 171, 153, 42, 119, 131, 136, 169, 153, 186, 40, 100, 20, 144, 24, 160, 173, 9, 66, 21, 9, 99, 161, 187, 136, 169, 25, 18, 100, 3, 16, 36, 217, 172, 25, 152, 88, 21, 33, 35, 216, 189, 154, 153, 41, 70, 52, 0, 137, 152, 220, 170, 153, 9, 67, 51, 52, 161, 189, 154, 185, 173, 40, 18, 136, 2, 218, 188, 87, 255, 38, 0, 26, 51, 69, 2, 154, 201, 205, 172, 137, 49, 71, 18, 128, 169, 153, 235, 138, 152, 10, 52, 83, 37, 144, 153, 154, 202, 173, 32, 19, 0, 65, 54, 129, 186, 137, 169, 187, 140, 86, 145, 42, 22, 168, 154, 33, 233, 155, 16, 49, 53, 152, 17, 208, 174, 8, 128, 56, 20, 33, 146, 188, 189, 171, 137, 83, 52, 51, 130, 173, 8, 252, 154, 34, 1, 9, 65, 34, 185, 140, 2, 205, 10, 33, 66, 18, 169, 138, 249, 190, 32, 34, 51, 35, 16, 145, 255, 139, 16, 153, 81, 67, 1, 9, 144, 170, 201, 10, 19, 169, 65, 51, 20, 217, 170, 0, 219, 25, 38, 160, 8, 152, 42, 35, 35, 232, 24, 251, 106, 3, 186, 152, 136, 235, 80, 4, 138, 1, 187, 10, 52, 1, 115, 176, 171, 201, 188, 32, 67, 83, 34, 184, 205, 187, 137, 50, 34, 115, 130, 188, 24, 161, 187, 169, 57, 37, 49, 38, 168, 202, 155, 136, 112, 53, 51, 145, 188, 189, 173, 24, 51, 66, 84, 2, 168, 203, 171, 24, 144, 82, 20, 160, 8, 67, 146, 8, 145, 205, 172, 49, 3, 17, 49, 130, 137, 145, 120, 7, 169, 235, 171, 169, 57, 87, 17, 1, 168, 219, 187, 170, 24, 66, 36, 1, 128, 218, 188, 9, 2, 168, 24, 4, 204, 56, 130, 153, 9, 33, 85, 146, 26, 35, 249, 174, 25, 0, 115, 19, 129, 152, 184, 204, 187, 24, 35, 100, 35, 130, 185, 191, 137, 136, 137, 49, 52, 177, 141, 49, 2, 170, 171, 40, 251, 175, 16, 66, 1, 65, 129, 203, 186, 188, 26, 35, 115, 19, 152, 187, 137, 184, 9, 235, 154, 115, 37, 18, 2, 187, 189, 188, 138, 82, 83, 51, 17, 168, 204, 172, 40, 21, 17, 1, 152, 187, 26, 34, 100, 35, 169, 137, 237, 138, 50, 36, 136, 129, 218, 24, 144, 10, 54, 177, 173, 32, 20, 24, 68, 18, 217, 187, 185, 11, 70, 67, 18, 144, 169, 153, 202, 41, 52, 128, 169, 154, 24, 83, 18, 36, 200, 189, 171, 137, 16, 84, 20, 216, 171, 136, 16, 33, 52, 147, 221, 171, 139, 65, 36, 17, 34, 35, 251, 140, 129, 171, 16, 32, 224, 12, 69, 19, 144, 186, 138, 168, 203, 138, 96, 19, 115, 131, 170, 168, 173, 25, 34, 184, 138, 67, 146, 170, 116, 131, 136, 201, 204, 189, 41, 53, 35, 136, 136, 218, 189, 9, 129, 136, 50, 54, 208, 172, 24, 128, 34, 1, 168, 188, 137, 99, 161, 140, 35, 218, 8, 1, 66, 52, 130, 206, 154, 170, 40, 20, 65, 2, 16, 130, 206, 154, 8, 170, 50, 128, 115, 18, 99, 3, 205, 170, 154, 56, 51, 84, 34, 152, 203, 186, 172, 139, 98, 51, 33, 185, 58, 5, 221, 138, 128, 1, 0, 84, 131, 168, 188, 154, 186, 41, 83, 52, 131, 169, 204, 188, 138, 66, 51, 52, 145, 203, 138, 146, 190, 72, 18, 231, 252, 38, 0, 17, 154, 102, 130, 136, 184, 156, 152, 9, 52, 83, 162, 138, 144, 189, 32, 208, 10, 20, 24, 35, 66, 208, 173, 48, 19, 218, 172, 24, 35, 32, 20, 186, 252, 154, 33, 17, 80, 4, 187, 153, 203, 152, 25, 53, 66, 2, 10, 50, 250, 156, 170, 137, 64, 101, 1, 128, 129, 186, 203, 9, 51, 34, 84, 130, 154, 33, 184, 10, 217, 140, 34, 66, 54, 145, 171, 154, 234, 26, 146, 174, 49, 34, 68, 145, 155, 234, 187, 9, 1, 49, 20, 234, 10, 0, 170, 32, 208, 157, 0, 169, 9, 98, 51, 136, 16, 184, 156, 128, 32, 37, 52, 161, 40, 251, 75, 38, 66, 130, 202, 138, 16, 99, 36, 169, 48, 176, 43, 87, 2, 203, 32, 177, 139, 35, 66, 52, 18, 203, 187, 138, 65, 67, 21, 144, 186, 188, 171, 0, 185, 112, 53, 129, 32, 208, 141, 129, 188, 170, 152, 65, 71, 130, 153, 154, 188, 138, 152, 73, 53, 1, 17, 144, 203, 203, 25, 50, 168, 49, 194, 142, 52, 144, 8, 200, 140, 160, 73, 37, 170, 153, 186, 40, 19, 115, 19, 205, 8, 185, 158, 40, 67, 35, 34, 200, 189, 186, 186, 203, 41, 87, 18, 33, 1, 201, 203, 170, 171, 49, 51, 71, 18, 136, 153, 168, 218, 187, 9, 129, 56, 103, 129, 136, 138, 137, 32, 146, 12, 19, 171, 83, 216, 138, 201, 155, 81, 52, 130, 137, 185, 205, 187, 10, 128, 40, 148, 175, 48, 146, 188, 170, 206, 26, 17, 34, 129, 186, 56, 22, 184, 138, 250, 13, 34, 51, 22, 168, 26, 1, 171, 65, 35, 98, 36, 168, 137, 185, 41, 35, 40, 119, 18, 0, 200, 155, 169, 140, 99, 34, 2, 152, 203, 140, 136, 24, 129, 48, 18, 17, 237, 154, 184, 187, 81, 146, 26, 38, 48, 20, 233, 188, 188, 156, 83, 34, 50, 130, 186, 186, 220, 138, 50, 146, 57, 103, 17, 0, 169, 203, 170, 32, 21, 24, 36, 160, 137, 144, 203, 138, 49, 68, 53, 36, 160, 204, 171, 154, 41, 115, 35, 129, 170, 186, 171, 137, 251, 156, 66, 144, 40, 4, 170, 10, 17, 82, 36, 251, 155, 16, 0, 48, 39, 129, 0, 144, 139, 66, 145, 41, 225, 158, 0, 152, 113, 51, 1, 128, 153, 250, 175, 8, 17, 65, 36, 145, 203, 153, 153, 0, 17, 33, 129, 203, 171, 137, 100, 37, 1, 186, 189, 155, 66, 19, 18, 176, 190, 11, 65, 69, 145, 154, 185, 189, 25, 35, 100, 51, 145, 201, 203, 187, 139, 84, 19, 16, 52, 176, 173, 153, 16, 130, 154, 0, 152, 32, 68, 37, 128, 201, 220, 138, 1, 136, 33, 34, 3, 205, 8, 184, 28, 52, 160, 154, 153, 221, 138, 1, 202, 138, 49, 53, 53, 1, 235, 204, 154, 0, 49, 52, 67, 34, 202, 171, 185, 172, 169, 156, 102, 35, 1, 0, 169, 202, 154, 24, 144, 32, 51, 69, 51, 130, 206, 39, 0, 30, 0, 154, 153, 40, 68, 2, 153, 153, 40, 4, 171, 33, 217, 26, 69, 128, 154, 18, 201, 219, 187, 97, 35, 1, 169, 203, 155, 128, 172, 153, 138, 86, 3, 8, 51, 251, 157, 16, 17, 17, 34, 33, 20, 235, 139, 32, 67, 35, 17, 168, 139, 82, 3, 205, 41, 145, 219, 188, 56, 20, 0, 16, 162, 255, 10, 1, 0, 34, 144, 137, 144, 175, 41, 20, 17, 2, 152, 128, 185, 24, 216, 42, 55, 144, 169, 9, 35, 200, 154, 154, 33, 17, 249, 11, 19, 221, 137, 65, 129, 138, 136, 17, 232, 42, 22, 153, 16, 1, 152, 80, 37, 136, 153, 144, 170, 217, 10, 99, 162, 171, 66, 192, 10, 128, 10, 4, 201, 16, 160, 169, 16, 169, 27, 19, 49, 33, 16, 144, 144, 9, 17, 9, 0, 0, 17, 17, 144, 17, 145, 153, 16, 145, 153, 0, 25, 0, 0, 16, 145, 153, 16, 145, 169, 25, 1, 9, 145, 153, 17, 145, 25, 2, 153, 16, 145, 9, 17, 16, 145, 9, 1, 0, 16, 144, 0, 1, 9, 0, 0, 0, 0, 16, 0, 0, 144, 0, 0, 0, 0, 0, 0, 0, 16, 144, 0, 0, 0, 0, 0, 0, 0, 0, 16, 153, 16, 0, 0, 0, 0, 0, 0, 9, 17, 9, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 16, 0, 0, 0, 0, 0, 9, 1, 0, 9, 16, 144, 16, 0, 0, 0, 9, 0, 0, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 16, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
-static const size_t audio_twenty_sample_data_length = sizeof(audio_twenty_sample_data) / sizeof(audio_twenty_sample_data[0]);
+static const size_t audio_twenty_sample_data_length = 24846;
@@ -1,4 +1,4 @@
-// This file was generated by a script on 20-11-2024 08:37:38
+// This file was generated by a script on 17-10-2026 14:19:03
 
 #pragma once
 
@@ -6,6 +6,7 @@
 #include <stdint.h>
 #include <pico/platform/sections.h>
 
-static const int16_t __in_flash("audio_unknown_sample_data") audio_unknown_sample_data[] = { 305, 280, 219, 163, 150, 169, 166, 132, 89, 41, -10, -35, -21, -2, -9, -17, -9, -6, -18, -13, 16, 36, 20, 6, 33, 76, 91, 84, 99, 136, 158, 159, 174, 205, 218, 196, 171, 178, 204, 220, 214, 199, 192, 191, 182, 171, 170, 181, 188, 193, 200, 196, 169, 147, 152, 164, 157, 147, 157, 160, 133, 103, 98, 104, 88, 58, 42, 44, 41, 27, 14, -4, -44, -89, -109, -112, -133, -170, -194, -203, -226, -270, -304, -302, -261, -211, -193, -208, -212, -194, -186, -193, -172, -116, -95, -147, -212, -228, -212, -215, -228, -223, -226, -261, -278, -206, -96, -77, -172, -281, -341, -388, -446, -484, -509, -585, -718, -808, -751, -545, -284, -61, 106, 246, 378, 517, 678, 849, 959, 965, 920, 918, 982, 1064, 1138, 1196, 1196, 1133, 1080, 1081, 1078, 997, 845, 686, 537, 374, 191, 16, -122, -236, -357, -492, -601, -646, -654, -683, -730, -747, -708, -645, -593, -546, -487, -435, -404, -363, -282, -192, -138, -103, -45, 23, 78, 136, 222, 310, 356, 371, 398, 436, 437, 392, 348, 334, 323, 290, 253, 235, 237, 259, 308, 365, 417, 467, 526, 580, 618, 652, 685, 696, 686, 674, 662, 639, 619, 619, 634, 640, 630, 612, 581, 530, 452, 354, 244, 136, 30, -77, -187, -292, -386, -470, -540, -576, -573, -556, -558, -562, -526, -453, -392, -361, -322, -258, -194, -153, -99, -4, 103, 172, 205, 248, 316, 385, 441, 491, 530, 539, 526, 522, 520, 491, 431, 368, 314, 263, 220, 207, 209, 182, 136, 137, 205, 265, 253, 213, 209, 229, 216, 178, 164, 165, 135, 72, 36, 42, 36, -6, -44, -59, -95, -179, -256, -278, -288, -355, -470, -564, -622, -683, -750, -781, -770, -758, -756, -734, -680, -613, -548, -485, -425, -372, -305, -209, -100, -12, 56, 141, 244, 334, 389, 437, 506, 572, 611, 630, 656, 682, 680, 641, 578, 509, 439, 356, 260, 165, 86, 23, -34, -104, -186, -263, -320, -353, -374, -394, -425, -458, -471, -468, -476, -513, -556, -581, -590, -596, -586, -547, -488, -443, -426, -420, -404, -383, -371, -372, -371, -363, -359, -366, -379, -392, -404, -408, -385, -337, -295, -283, -282, -255, -198, -137, -94, -62, -33, -4, 32, 88, 149, 171, 143, 113, 136, 210, 287, 338, 364, 356, 303, 248, 238, 265, 269, 231, 171, 89, -17, -105, -120, -83, -68, -117, -217, -320, -379, -383, -377, -396, -431, -460, -482, -493, -484, -464, -468, -498, -526, -529, -512, -486, -465, -468, -497, -520, -501, -441, -390, -387, -419, -436, -413, -368, -321, -271, -208, -154, -136, -138, -112, -44, 28, 61, 60, 67, 110, 185, 262, 318, 353, 376, 406, 448, 490, 503, 481, 461, 479, 513, 509, 462, 424, 426, 434, 393, 313, 244, 211, 199, 192, 189, 165, 80, -54, -167, -210, -216, -248, -309, -360, -386, -411, -446, -452, -409, -365, -376, -426, -451, -429, -407, -422, -442, -424, -392, -397, -419, -385, -280, -182, -137, -95, -6, 95, 153, 170, 180, 199, 229, 273, 327, 386, 447, 502, 540, 573, 622, 682, 732, 778, 829, 857, 821, 741, 693, 700, 701, 641, 551, 494, 464, 407, 318, 255, 249, 244, 193, 116, 76, 81, 75, 17, -62, -109, -123, -148, -176, -159, -93, -39, -26, 3, 91, 188, 222, 200, 194, 247, 319, 364, 379, 384, 371, 338, 315, 343, 414, 474, 492, 490, 494, 506, 528, 558, 569, 534, 486, 498, 572, 597, 490, 316, 255, 386, 596, 744, 855, 1050, 1293, 1376, 1215, 1010, 993, 1102, 1067, 780, 414, 186, 126, 119, 84, 41, 22, 25, 22, 3, -23, -45, -92, -256, -595, -1018, -1352, -1491, -1492, -1480, -1526, -1601, -1639, -1620, -1571, -1475, -1271, -983, -756, -700, -752, -762, -661, -490, -300, -107, 60, 159, 196, 249, 389, 608, 851, 1058, 1168, 1150, 1047, 960, 949, 987, 994, 912, 739, 529, 369, 308, 303, 258, 125, -46, -171, -226, -274, -361, -468, -547, -618, -730, -874, -969, -976, -959, -1007, -1121, -1214, -1219, -1158, -1104, -1085, -1070, -1020, -946, -895, -889, -904, -893, -840, -779, -763, -802, -839, -805, -695, -569, -476, -392, -272, -143, -76, -85, -96, -40, 58, 122, 126, 113, 146, 235, 330, 379, 392, 417, 464, 500, 498, 485, 495, 518, 519, 489, 446, 403, 358, 315, 279, 230, 161, 119, 147, 192, 148, 1, -132, -156, -120, -122, -175, -208, -205, -220, -260, -261, -194, -123, -120, -162, -176, -132, -78, -56, -33, 37, 124, 154, 138, 163, 255, 341, 364, 360, 381, 417, 435, 452, 492, 550, 588, 596, 605, 639, 679, 683, 642, 594, 563, 547, 548, 575, 611, 614, 588, 575, 592, 599, 552, 459, 352, 254, 169, 71, -35, -101, -98, -92, -159, -261, -295, -250, -234, -319, -444, -512, -512, -508, -529, -542, -525, -493, -464, -409, -309, -186, -81, -2, 72, 160, 243, 302, 352, 417, 469, 465, 436, 450, 502, 531, 526, 528, 524, 481, 425, 398, 370, 286, 170, 88, 27, -79, -221, -304, -313, -338, -409, -442, -421, -433, -487, -491, -454, -482, -560, -578, -541, -547, -570, -503, -372, -310, -330, -319, -233, -160, -149, -128, -53, -6, -63, -159, -192, -166, -137, -109, -83, -103, -183, -250, -244, -217, -247, -300, -303, -280, -308, -349, -311, -225, -195, -234, -281, -319, -350, -333, -263, -225, -265, -302, -255, -171, -133, -128, -96, -65, -95, -149, -128, -65, -98, -250, -383, -403, -377, -391, -408, -385, -379, -453, -527, -487, -385, -347, -372, -363, -314, -316, -370, -379, -324, -292, -327, -346, -280, -192, -164, -177, -171, -151, -148, -138, -90, -28, 17, 41, 41, 23, 8, 3, 0, 1, 26, 49, 25, -26, -31, 16, 54, 45, 30, 34, 17, -40, -83, -55, -10, -31, -85, -81, -18, 11, -15, -24, 41, 148, 226, 257, 287, 356, 420, 414, 357, 351, 442, 566, 640, 663, 672, 685, 716, 787, 876, 898, 822, 766, 826, 896, 849, 780, 835, 904, 804, 629, 583, 628, 607, 535, 496, 450, 357, 304, 334, 336, 242, 150, 146, 127, 11, -72, 14, 136, 98, 4, 62, 188, 174, 100, 172, 313, 297, 197, 279, 529, 646, 540, 479, 627, 754, 619, 374, 301, 376, 365, 235, 165, 203, 220, 224, 352, 507, 420, 159, 97, 263, 273, 16, -136, 21, 216, 199, 86, 97, 235, 354, 359, 274, 200, 204, 224, 142, -32, -117, 9, 203, 210, 28, -93, -32, 30, -100, -344, -497, -538, -612, -757, -850, -806, -685, -564, -447, -343, -299, -326, -372, -437, -584, -769, -810, -686, -672, -897, -1051, -844, -497, -327, -216, 25, 182, 21, -249, -339, -331, -431, -596, -679, -667, -620, -548, -442, -287, -92, 76, 168, 220, 249, 183, 33, -46, -21, -54, -169, -117, 220, 592, 758, 885, 1237, 1652, 1741, 1522, 1412, 1536, 1569, 1352, 1137, 1074, 979, 769, 617, 583, 514, 378, 294, 235, -6, -460, -885, -1096, -1206, -1440, -1791, -2033, -2099, -2253, -2683, -3137, -3260, -3150, -3156, -3281, -3256, -3032, -2747, -2407, -1989, -1650, -1463, -1263, -974, -775, -720, -574, -200, 214, 484, 705, 1060, 1550, 2053, 2536, 3016, 3406, 3610, 3699, 3799, 3875, 3800, 3613, 3468, 3389, 3254, 3023, 2804, 2686, 2624, 2524, 2376, 2242, 2127, 1947, 1619, 1170, 682, 211, -208, -564, -894, -1247, -1567, -1727, -1727, -1694, -1662, -1574, -1509, -1635, -1899, -2045, -1988, -1928, -2067, -2407, -2785, -3015, -3046, -3016, -3028, -2987, -2823, -2683, -2655, -2581, -2374, -2241, -2363, -2631, -2932, -3330, -3818, -4151, -4173, -4042, -3918, -3698, -3267, -2832, -2626, -2471, -2006, -1321, -910, -951, -1066, -907, -586, -284, 174, 949, 1715, 2096, 2307, 2774, 3418, 3923, 4368, 4883, 5179, 5037, 4848, 5005, 5285, 5296, 5135, 5083, 5077, 4873, 4524, 4314, 4301, 4234, 3926, 3492, 3128, 2834, 2531, 2292, 2177, 1988, 1495, 873, 524, 468, 397, 265, 296, 437, 374, 115, 5, 166, 380, 492, 545, 534, 392, 185, 120, 321, 683, 981, 1100, 1150, 1280, 1464, 1614, 1768, 1967, 2067, 1959, 1773, 1622, 1408, 1175, 1186, 1423, 1534, 1456, 1487, 1644, 1622, 1439, 1396, 1431, 1183, 661, 264, 147, 53, -148, -231, -62, 117, 102, 69, 215, 397, 415, 347, 288, 137, -111, -245, -186, -116, -128, -70, 149, 398, 519, 529, 564, 699, 822, 744, 450, 105, -209, -520, -700, -579, -349, -386, -647, -801, -824, -908, -952, -795, -716, -1053, -1590, -1894, -1944, -1967, -1955, -1773, -1517, -1424, -1518, -1559, -1324, -863, -455, -275, -209, -76, 109, 253, 391, 572, 690, 655, 573, 553, 531, 443, 357, 302, 193, -29, -360, -746, -1039, -1127, -1212, -1644, -2370, -2982, -3325, -3608, -3900, -4012, -3965, -4064, -4404, -4692, -4713, -4637, -4681, -4744, -4657, -4558, -4667, -4838, -4713, -4276, -3879, -3679, -3438, -3000, -2578, -2319, -1976, -1386, -878, -745, -733, -502, -181, -23, 62, 253, 453, 557, 696, 961, 1172, 1177, 1115, 1160, 1193, 1060, 928, 947, 860, 478, 148, 176, 248, 55, -121, -68, -120, -447, -620, -402, -215, -409, -717, -802, -788, -919, -1104, -1084, -899, -863, -1093, -1299, -1220, -1038, -1099, -1344, -1433, -1359, -1488, -1928, -2321, -2436, -2529, -2868, -3239, -3308, -3208, -3310, -3563, -3596, -3442, -3481, -3696, -3670, -3369, -3213, -3341, -3410, -3219, -2944, -2740, -2514, -2177, -1806, -1509, -1293, -1101, -910, -728, -545, -338, -132, 1, 47, 82, 186, 336, 441, 467, 480, 542, 589, 517, 362, 257, 233, 215, 157, 43, -173, -466, -700, -850, -1059, -1341, -1512, -1546, -1672, -1974, -2219, -2237, -2216, -2363, -2537, -2484, -2278, -2193, -2232, -2194, -2100, -2105, -2087, -1823, -1441, -1228, -1145, -956, -636, -292, 82, 511, 912, 1230, 1490, 1697, 1890, 2180, 2563, 2862, 2991, 3118, 3411, 3787, 4042, 4125, 4132, 4108, 4037, 3950, 3822, 3462, 2813, 2214, 1909, 1579, 916, 220, -182, -575, -1204, -1731, -1954, -2281, -2938, -3524, -3794, -4029, -4387, -4640, -4688, -4673, -4595, -4320, -3901, -3496, -3104, -2630, -2082, -1540, -1015, -460, 147, 779, 1404, 2049, 2772, 3574, 4365, 5063, 5678, 6259, 6815, 7353, 7843, 8166, 8263, 8282, 8412, 8574, 8612, 8610, 8707, 8755, 8541, 8204, 8025, 7965, 7760, 7334, 6856, 6452, 6108, 5801, 5547, 5315, 5038, 4712, 4412, 4166, 3959, 3803, 3650, 3352, 2906, 2569, 2475, 2403, 2147, 1860, 1744, 1699, 1578, 1500, 1583, 1633, 1423, 1133, 1098, 1226, 1164, 964, 992, 1207, 1210, 1036, 1148, 1589, 1856, 1748, 1660, 1876, 2127, 2125, 2063, 2241, 2539, 2646, 2617, 2738, 3017, 3216, 3285, 3354, 3426, 3384, 3249, 3132, 3000, 2749, 2441, 2268, 2240, 2155, 1905, 1611, 1380, 1139, 813, 429, 0, -490, -966, -1327, -1602, -1878, -2151, -2385, -2579, -2713, -2741, -2713, -2758, -2912, -3106, -3264, -3329, -3294, -3259, -3294, -3278, -3062, -2744, -2507, -2305, -2013, -1734, -1611, -1554, -1409, -1219, -1084, -982, -872, -757, -609, -422, -275, -182, -51, 93, 113, 34, 15, -1, -190, -462, -590, -618, -761, -996, -1139, -1198, -1331, -1559, -1763, -1926, -2150, -2469, -2753, -2865, -2851, -2915, -3165, -3470, -3656, -3728, -3773, -3780, -3750, -3804, -3967, -4083, -4093, -4106, -4088, -3894, -3666, -3656, -3752, -3678, -3521, -3497, -3482, -3329, -3260, -3451, -3620, -3490, -3227, -3120, -3137, -3095, -2971, -2868, -2813, -2751, -2661, -2601, -2628, -2703, -2733, -2667, -2565, -2564, -2692, -2767, -2633, -2464, -2480, -2524, -2386, -2298, -2510, -2712, -2568, -2383, -2517, -2685, -2562, -2410, -2508, -2603, -2457, -2288, -2311, -2383, -2353, -2308, -2354, -2458, -2546, -2573, -2559, -2586, -2683, -2741, -2684, -2602, -2579, -2562, -2519, -2530, -2592, -2567, -2420, -2299, -2293, -2314, -2272, -2182, -2055, -1883, -1720, -1662, -1700, -1702, -1592, -1443, -1353, -1302, -1236, -1161, -1064, -891, -685, -568, -537, -490, -422, -398, -357, -219, -79, -62, -73, 37, 233, 368, 410, 447, 551, 716, 859, 894, 862, 882, 949, 978, 1000, 1095, 1183, 1149, 1104, 1197, 1309, 1249, 1111, 1104, 1168, 1080, 829, 625, 579, 561, 396, 106, -93, -84, -29, -136, -347, -481, -558, -696, -810, -734, -587, -630, -810, -797, -474, -109, 30, 27, 149, 476, 809, 995, 1166, 1525, 1998, 2347, 2559, 2832, 3202, 3487, 3635, 3803, 4048, 4230, 4297, 4408, 4668, 4936, 5011, 4917, 4851, 4909, 4944, 4803, 4545, 4335, 4160, 3914, 3671, 3588, 3564, 3356, 3003, 2787, 2755, 2683, 2480, 2288, 2170, 2023, 1807, 1629, 1577, 1583, 1495, 1252, 1019, 1023, 1232, 1365, 1297, 1181, 1153, 1182, 1231, 1264, 1155, 890, 708, 754, 840, 806, 790, 898, 986, 987, 1055, 1226, 1298, 1193, 1109, 1160, 1169, 1032, 990, 1210, 1413, 1335, 1253, 1528, 1922, 1983, 1817, 1850, 2038, 1999, 1741, 1660, 1818, 1834, 1544, 1304, 1421, 1629, 1507, 1192, 1179, 1454, 1441, 965, 639, 843, 1042, 715, 251, 230, 450, 430, 281, 342, 483, 417, 296, 396, 524, 324, -32, -48, 249, 326, 33, -184, -70, 138, 249, 327, 342, 202, 53, 75, 142, 66, -90, -203, -272, -308, -293, -332, -520, -724, -724, -554, -466, -628, -943, -1162, -1144, -1083, -1303, -1761, -2028, -1913, -1762, -1918, -2241, -2369, -2203, -1924, -1777, -1873, -2073, -2111, -1954, -1855, -1929, -1961, -1794, -1591, -1538, -1574, -1535, -1348, -1056, -775, -598, -457, -253, -98, -140, -281, -375, -514, -755, -860, -727, -635, -757, -844, -734, -679, -841, -965, -924, -1134, -1883, -2686, -3022, -3405, -4727, -6695, -8093, -8564, -8951, -9722, -10282, -10152, -9657, -9125, -8312, -7110, -6130, -5899, -6005, -5647, -4839, -4309, -4217, -3688, -1932, 739, 3375, 5525, 7438, 9384, 11317, 13051, 14394, 15175, 15496, 15743, 16118, 16440, 16671, 17165, 18135, 19291, 20218, 20722, 20687, 20035, 18993, 17976, 17021, 15665, 13716, 11733, 10314, 9298, 8237, 7249, 6676, 6300, 5688, 4971, 4501, 4086, 3248, 1990, 787, 16, -339, -573, -841, -908, -502, 114, 548, 1019, 1853, 2589, 2647, 2489, 2889, 3542, 3652, 3362, 3382, 3733, 3953, 4020, 4196, 4352, 4179, 3765, 3542, 3746, 4135, 4270, 4071, 3909, 3964, 3848, 3270, 2639, 2400, 2285, 1888, 1478, 1509, 1857, 2170, 2508, 3059, 3666, 4049, 4118, 3865, 3331, 2732, 2314, 2087, 1909, 1755, 1727, 1856, 2049, 2190, 2224, 2150, 1962, 1588, 940, 30, -1037, -2126, -3117, -3901, -4426, -4758, -5037, -5321, -5553, -5647, -5629, -5652, -5874, -6303, -6780, -7131, -7286, -7264, -7078, -6744, -6303, -5801, -5242, -4629, -4057, -3640, -3332, -2954, -2480, -2083, -1824, -1532, -1126, -733, -394, -17, 299, 282, -89, -562, -1012, -1535, -2117, -2604, -2938, -3222, -3547, -3933, -4392, -4932, -5561, -6271, -7001, -7679, -8360, -9181, -10084, -10776, -11043, -11009, -10939, -10932, -10893, -10777, -10704, -10806, -11043, -11229, -11312, -11408, -11511, -11411, -11060, -10765, -10718, -10634, -10152, -9451, -9011, -8894, -8697, -8301, -8099, -8296, -8462, -8205, -7819, -7755, -7905, -7879, -7688, -7586, -7535, -7279, -6817, -6391, -6072, -5697, -5235, -4918, -4929, -5090, -5095, -4928, -4865, -5029, -5210, -5156, -4885, -4550, -4175, -3733, -3335, -3180, -3307, -3579, -3885, -4258, -4729, -5230, -5679, -6062, -6348, -6441, -6302, -6075, -5954, -5967, -5999, -5995, -6077, -6399, -6962, -7564, -7982, -8133, -8043, -7755, -7354, -6976, -6631, -6147, -5427, -4683, -4214, -4032, -3888, -3635, -3374, -3200, -3005, -2644, -2159, -1679, -1236, -769, -252, 292, 754, 948, 863, 818, 1059, 1332, 1211, 762, 465, 540, 750, 882, 1016, 1225, 1336, 1197, 1010, 1128, 1534, 1762, 1524, 1120, 1009, 1164, 1264, 1286, 1408, 1537, 1508, 1557, 1998, 2610, 2903, 2813, 2694, 2778, 3009, 3192, 3132, 2818, 2511, 2450, 2611, 2877, 3175, 3341, 3259, 3179, 3411, 3767, 3833, 3628, 3469, 3418, 3395, 3495, 3722, 3844, 3812, 3894, 4175, 4425, 4571, 4796, 5105, 5249, 5175, 5144, 5340, 5575, 5574, 5352, 5202, 5301, 5495, 5540, 5420, 5285, 5157, 4988, 4886, 4981, 5104, 4920, 4425, 3988, 3850, 3840, 3689, 3384, 3094, 2900, 2738, 2563, 2437, 2426, 2514, 2592, 2529, 2285, 2027, 1942, 1955, 1828, 1540, 1329, 1343, 1496, 1656, 1765, 1785, 1732, 1730, 1853, 1970, 1914, 1708, 1527, 1468, 1475, 1458, 1425, 1439, 1485, 1491, 1483, 1566, 1693, 1629, 1343, 1159, 1281, 1411, 1191, 780, 599, 677, 663, 413, 226, 402, 785, 953, 813, 771, 1127, 1553, 1512, 1065, 779, 904, 1102, 1108, 1133, 1392, 1638, 1586, 1500, 1806, 2291, 2279, 1657, 1126, 1207, 1540, 1470, 947, 465, 330, 348, 254, 117, 150, 312, 367, 280, 232, 225, -35, -687, -1332, -1480, -1333, -1622, -2413, -2796, -2222, -1447, -1365, -1650, -1468, -882, -632, -955, -1414, -1590, -1463, -1321, -1443, -1702, -1607, -963, -209, 180, 327, 627, 1054, 1260, 1263, 1415, 1624, 1345, 594, 104, 155, 225, 66, 43, 227, 283, 329, 774, 1382, 1506, 1116, 663, 161, -696, -1713, -2270, -2254, -2223, -2502, -2705, -2463, -2045, -1849, -1773, -1596, -1492, -1790, -2573, -3746, -5121, -6386, -7321, -7956, -8318, -8307, -8040, -7763, -7323, -6288, -4673, -3011, -1762, -1055, -803, -592, 147, 1507, 3019, 4414, 5966, 7969, 10395, 13187, 16247, 19164, 21365, 22666, 23390, 23903, 24299, 24515, 24565, 24527, 24459, 24420, 24446, 24477, 24382, 24173, 23891, 23321, 22096, 20169, 17904, 15660, 13555, 11594, 9762, 8027, 6466, 5296, 4613, 4172, 3657, 3121, 2811, 2608, 2049, 1063, 155, -341, -670, -1067, -1294, -1122, -685, -147, 572, 1509, 2443, 3128, 3527, 3766, 3992, 4229, 4348, 4238, 3967, 3705, 3505, 3297, 3128, 3214, 3592, 3951, 4016, 3942, 3959, 3900, 3534, 3074, 2827, 2628, 2150, 1518, 1115, 1067, 1280, 1719, 2352, 3022, 3586, 4006, 4218, 4111, 3738, 3365, 3146, 2887, 2368, 1739, 1338, 1229, 1236, 1262, 1249, 1071, 701, 240, -381, -1342, -2537, -3680, -4729, -5794, -6741, -7373, -7818, -8303, -8706, -8779, -8636, -8650, -8906, -9154, -9266, -9417, -9695, -9846, -9611, -9083, -8492, -7856, -7058, -6127, -5220, -4399, -3633, -2951, -2437, -2066, -1708, -1335, -1071, -989, -977, -868, -620, -382, -425, -866, -1460, -1895, -2277, -2959, -3915, -4758, -5402, -6159, -7141, -7994, -8487, -8898, -9556, -10320, -10849, -11185, -11629, -12201, -12673, -13022, -13370, -13619, -13602, -13479, -13557, -13796, -13853, -13553, -13074, -12674, -12452, -12336, -12229, -12086, -11860, -11505, -11086, -10812, -10741, -10612, -10171, -9581, -9233, -9181, -9065, -8624, -8034, -7601, -7343, -7131, -7000, -7065, -7153, -6909, -6310, -5780, -5634, -5645, -5385, -4829, -4340, -4109, -3944, -3656, -3393, -3391, -3552, -3604, -3541, -3602, -3808, -3871, -3661, -3436, -3446, -3609, -3749, -3909, -4235, -4686, -5054, -5265, -5542, -6114, -6764, -6995, -6738, -6511, -6650, -6839, -6727, -6540, -6602, -6739, -6629, -6459, -6634, -7011, -7006, -6456, -5877, -5685, -5612, -5191, -4445, -3757, -3325, -3056, -2829, -2590, -2308, -1973, -1592, -1181, -792, -537, -442, -310, 121, 826, 1430, 1608, 1457, 1336, 1436, 1650, 1789, 1776, 1628, 1419, 1315, 1441, 1661, 1683, 1487, 1387, 1546, 1780, 1918, 1955, 1804, 1398, 994, 872, 870, 685, 415, 308, 304, 263, 301, 524, 754, 805, 746, 706, 661, 572, 491, 450, 380, 253, 192, 335, 642, 966, 1269, 1636, 2086, 2496, 2765, 2883, 2873, 2748, 2577, 2470, 2475, 2502, 2468, 2474, 2750, 3340, 3944, 4265, 4395, 4599, 4842, 4844, 4541, 4130, 3724, 3323, 3041, 3060, 3364, 3713, 3905, 3970, 4160, 4605, 4959, 4727, 4041, 3592, 3597, 3445, 2750, 2047, 1954, 2214, 2176, 1895, 2015, 2646, 3104, 2907, 2398, 2059, 1794, 1312, 710, 287, 94, -57, -311, -547, -447, 49, 458, 363, 119, 285, 612, 473, 36, 11, 414, 547, 193, -35, 374, 1142, 1639, 1716, 1822, 2341, 3017, 3285, 3041, 2716, 2579, 2408, 2019, 1689, 1734, 1955, 1906, 1621, 1641, 2213, 2816, 2783, 2209, 1824, 1992, 2237, 1978, 1357, 987, 1103, 1358, 1507, 1787, 2343, 2776, 2759, 2696, 3047, 3420, 3160, 2425, 1884, 1708, 1625, 1562, 1566, 1457, 1157, 1008, 1292, 1711, 1844, 1818, 1874, 1585, 517, -611, -687, -26, 42, -639, -851, -90, 729, 901, 855, 1108, 1386, 1268, 1023, 1236, 1848, 2158, 1855, 1601, 2219, 3563, 4650, 4873, 4621, 4553, 4668, 4463, 3870, 3519, 3934, 4784, 5275, 5138, 4837, 4757, 4685, 4340, 3964, 3881, 3774, 3056, 1811, 789, 430, 448, 497, 666, 1004, 1036, 321, -822, -1735, -2305, -2887, -3581, -4131, -4352, -4266, -4044, -3943, -3995, -3799, -3059, -2169, -1770, -1967, -2444, -3068, -3874, -4756, -5510, -5992, -6025, -5416, -4243, -2847, -1506, -155, 1432, 3306, 5263, 7017, 8344, 9136, 9499, 9816, 10583, 12024, 13924, 15940, 17943, 20004, 22051, 23826, 25168, 26111, 26714, 26936, 26693, 25924, 24699, 23307, 22095, 21184, 20539, 20169, 19998, 19666, 18825, 17556, 16129, 14578, 12777, 10794, 8820, 6844, 4772, 2853, 1567, 999, 696, 335, 154, 417, 817, 866, 506, 38, -385, -836, -1305, -1563, -1408, -968, -596, -403, -43, 815, 1936, 2746, 3085, 3308, 3657, 3843, 3536, 2932, 2492, 2293, 2025, 1589, 1273, 1279, 1432, 1533, 1661, 1939, 2224, 2265, 2053, 1732, 1292, 631, -127, -681, -900, -906, -808, -597, -263, 194, 765, 1338, 1689, 1644, 1205, 497, -295, -998, -1580, -2139, -2686, -3067, -3182, -3117, -2996, -2835, -2701, -2847, -3464, -4346, -5138, -5841, -6735, -7766, -8513, -8798, -8873, -8892, -8640, -8043, -7489, -7351, -7448, -7352, -7073, -7032, -7371, -7705, -7656, -7304, -6921, -6534, -5962, -5158, -4316, -3659, -3191, -2751, -2330, -2128, -2270, -2562, -2731, -2800, -3026, -3468, -3843, -3904, -3797, -3824, -4033, -4313, -4719, -5385, -6215, -6970, -7573, -8137, -8794, -9584, -10384, -10926, -11086, -11109, -11298, -11595, -11722, -11718, -11923, -12447, -12951, -13155, -13224, -13448, -13719, -13684, -13360, -13155, -13221, -13161, -12678, -12114, -11954, -12049, -11885, -11452, -11241, -11400, -11487, -11175, -10693, -10364, -10081, -9531, -8769, -8192, -7994, -7913, -7642, -7235, -6940, -6823, -6702, -6464, -6221, -6079, -5858, -5308, -4586, -4184, -4227, -4274, -4004, -3690, -3673, -3813, -3808, -3722, -3844, -4180, -4437, -4421, -4291, -4322, -4554, -4760, -4763, -4724, -4971, -5572, -6186, -6453, -6458, -6578, -6933, -7239, -7309, -7349, -7545, -7606, -7172, -6529, -6391, -6893, -7341, -7217, -6918, -7042, -7398, -7325, -6751, -6282, -6213, -6077, -5431, -4602, -4215, -4228, -3981, -3209, -2468, -2326, -2539, -2396, -1697, -921, -449, -71, 550, 1254, 1616, 1669, 1959, 2756, 3589, 3799, 3381, 2987, 3119, 3573, 3811, 3695, 3613, 3851, 4157, 4159, 3962, 3961, 4166, 4144, 3694, 3207, 3077, 3058, 2624, 1818, 1248, 1240, 1458, 1490, 1393, 1454, 1667, 1744, 1547, 1318, 1349, 1534, 1472, 1081, 799, 973, 1369, 1575, 1658, 1986, 2584, 3055, 3149, 3091, 3221, 3546, 3795, 3860, 3934, 4161, 4343, 4268, 4129, 4281, 4689, 5008, 5130, 5254, 5475, 5677, 5746, 5665, 5464, 5270, 5194, 5122, 4823, 4363, 4072, 4080, 4144, 4067, 3989, 4081, 4166, 3915, 3348, 2859, 2652, 2452, 1980, 1446, 1237, 1255, 1056, 621, 450, 745, 983, 675, 124, -38, 159, 119, -324, -625, -444, -228, -466, -858, -768, -197, 219, 148, -13, 219, 672, 789, 557, 596, 1128, 1483, 1146, 702, 993, 1785, 2141, 1878, 1745, 2187, 2711, 2708, 2331, 2164, 2309, 2285, 1815, 1316, 1295, 1584, 1636, 1391, 1343, 1717, 2102, 2074, 1800, 1751, 2048, 2367, 2408, 2296, 2386, 2781, 3180, 3324, 3368, 3646, 4119, 4386, 4304, 4280, 4674, 5187, 5288, 5070, 5118, 5528, 5731, 5447, 5192, 5463, 5871, 5575, 4496, 3583, 3586, 3909, 3328, 1851, 879, 1186, 1768, 1457, 816, 1263, 2789, 3811, 3352, 2277, 1904, 2251, 2362, 1884, 1458, 1693, 2457, 3306, 4091, 4942, 5906, 6823, 7440, 7558, 7169, 6441, 5499, 4259, 2846, 1932, 2089, 2912, 3415, 3187, 2577, 2000, 1701, 1818, 2056, 1672, 338, -1366, -2720, -3636, -4343, -4755, -4637, -4117, -3514, -2833, -1930, -1070, -734, -883, -972, -750, -477, -368, -386, -632, -1300, -2139, -2520, -2227, -1714, -1317, -713, 370, 1467, 1995, 2255, 3036, 4434, 5778, 6632, 7246, 7961, 8731, 9463, 10486, 12274, 14772, 17338, 19360, 20764, 21842, 22813, 23641, 24191, 24412, 24323, 23948, 23388, 22914, 22702, 22538, 22073, 21365, 20793, 20347, 19476, 17810, 15760, 13954, 12414, 10695, 8724, 6919, 5429, 4016, 2669, 1749, 1331, 1023, 525, -81, -623, -1057, -1440, -1854, -2336, -2756, -2955, -3011, -3103, -3125, -2788, -2103, -1510, -1261, -1066, -630, -236, -304, -626, -653, -361, -242, -481, -785, -976, -1222, -1597, -1857, -1835, -1736, -1827, -2005, -1951, -1609, -1278, -1197, -1283, -1391, -1564, -1869, -2164, -2298, -2333, -2336, -2150, -1687, -1197, -961, -927, -888, -818, -853, -1134, -1738, -2589, -3435, -4086, -4562, -4931, -5236, -5626, -6186, -6670, -6819, -6844, -7159, -7779, -8412, -8929, -9386, -9735, -9936, -10103, -10303, -10386, -10225, -9907, -9574, -9225, -8805, -8353, -7972, -7667, -7340, -6948, -6586, -6348, -6150, -5821, -5338, -4900, -4681, -4607, -4435, -4089, -3768, -3670, -3750, -3861, -4028, -4355, -4775, -5090, -5287, -5579, -6112, -6735, -7115, -7142, -7164, -7634, -8470, -9116, -9330, -9437, -9680, -9915, -10084, -10389, -10818, -11122, -11302, -11570, -11878, -12026, -12080, -12227, -12393, -12429, -12437, -12606, -12883, -13038, -12923, -12601, -12324, -12313, -12495, -12594, -12437, -12011, -11314, -10573, -10220, -10280, -10191, -9651, -9001, -8429, -7646, -6722, -6221, -6125, -5685, -4731, -4075, -4151, -4266, -3769, -3148, -3208, -3689, -3629, -2904, -2476, -2876, -3336, -3042, -2507, -2771, -3679, -4099, -3720, -3445, -3823, -4281, -4286, -4214, -4485, -4666, -4205, -3464, -3238, -3551, -3712, -3454, -3244, -3408, -3658, -3714, -3736, -3835, -3701, -3203, -2876, -3231, -3869, -4018, -3647, -3327, -3287, -3418, -3855, -4692, -5506, -5813, -5650, -5192, -4453, -3696, -3445, -3735, -3976, -3741, -3175, -2524, -1840, -1266, -1105, -1324, -1353, -692, 399, 1176, 1404, 1682, 2397, 2911, 2606, 2161, 2588, 3491, 3785, 3566, 3638, 3843, 3552, 3118, 3202, 3426, 3144, 2730, 2853, 3225, 3190, 2853, 2771, 2916, 2784, 2338, 2164, 2552, 2980, 2822, 2238, 1853, 1827, 1889, 2104, 2776, 3535, 3514, 2707, 2186, 2601, 3362, 3683, 3553, 3332, 3163, 3059, 3043, 3064, 3109, 3280, 3560, 3743, 3735, 3607, 3374, 3053, 2826, 2832, 2955, 3037, 3080, 3066, 2931, 2785, 2878, 3199, 3484, 3596, 3623, 3644, 3667, 3734, 3883, 4054, 4155, 4150, 4081, 4105, 4396, 4840, 5025, 4710, 4148, 3777, 3793, 4060, 4214, 3897, 3191, 2647, 2599, 2726, 2627, 2391, 2284, 2232, 2048, 1805, 1667, 1597, 1483, 1358, 1320, 1365, 1425, 1502, 1644, 1822, 1917, 1898, 1942, 2242, 2693, 2983, 3005, 2950, 2984, 3119, 3370, 3690, 3792, 3487, 3114, 3170, 3583, 3807, 3649, 3505, 3717, 4066, 4126, 3826, 3429, 3149, 3058, 3141, 3225, 3089, 2839, 2843, 3128, 3282, 3126, 3004, 3235, 3689, 4097, 4363, 4470, 4411, 4324, 4418, 4640, 4624, 4131, 3501, 3408, 4013, 4580, 4364, 3702, 3553, 4065, 4453, 4254, 3721, 3103, 2497, 2219, 2346, 2371, 2078, 2042, 2518, 2799, 2436, 2067, 2356, 2976, 3234, 2981, 2542, 2203, 2016, 1900, 1846, 1992, 2335, 2611, 2738, 3086, 3882, 4656, 4779, 4304, 3818, 3667, 3695, 3621, 3264, 2534, 1553, 799, 727, 1181, 1485, 1243, 750, 396, 76, -492, -1112, -1280, -926, -597, -739, -1166, -1382, -1111, -414, 434, 1066, 1346, 1651, 2456, 3512, 3857, 2867, 1109, -137, -93, 865, 1805, 2363, 3032, 4389, 6402, 8701, 11007, 13073, 14600, 15523, 16071, 16408, 16615, 16983, 17799, 18847, 19744, 20581, 21695, 23058, 24235, 24813, 24558, 23537, 22244, 21186, 20302, 19085, 17264, 15055, 12931, 11351, 10493, 9992, 9226, 7969, 6529, 5201, 3898, 2469, 1027, -161, -1056, -1895, -2878, -3884, -4594, -4791, -4628, -4513, -4663, -4755, -4365, -3720, -3415, -3463, -3440, -3340, -3380, -3296, -2849, -2606, -3111, -3844, -4016, -3802, -3793, -3849, -3523, -3056, -3038, -3351, -3343, -2960, -2883, -3436, -4053, -4191, -4126, -4343, -4604, -4358, -3728, -3286, -2957, -2139, -974, -415, -733, -1098, -1010, -1026, -1607, -2303, -2592, -2631, -2758, -2907, -2867, -2697, -2637, -2797, -3079, -3412, -3967, -4967, -6250, -7354, -8097, -8711, -9318, -9718, -9844, -9940, -10119, -10203, -10108, -10003, -9983, -9946, -9840, -9756, -9767, -9805, -9778, -9623, -9343, -8987, -8597, -8203, -7848, -7537, -7159, -6639, -6133, -5832, -5645, -5409, -5231, -5324, -5587, -5773, -5905, -6163, -6448, -6484, -6309, -6272, -6465, -6522, -6198, -5782, -5651, -5785, -6006, -6341, -6816, -7188, -7282, -7332, -7663, -8199, -8590, -8714, -8729, -8688, -8519, -8352, -8520, -9067, -9624, -9929, -10127, -10501, -11139, -11904, -12480, -12590, -12313, -12075, -12130, -12292, -12248, -11909, -11395, -10909, -10635, -10535, -10378, -10027, -9557, -9000, -8335, -7661, -7031, -6286, -5430, -4806, -4476, -3983, -3155, -2453, -2143, -1922, -1669, -1687, -2023, -2358, -2662, -3164, -3755, -4114, -4253, -4412, -4648, -4871, -4999, -4989, -4941, -5104, -5470, -5717, -5782, -5988, -6396, -6641, -6570, -6344, -5924, -5219, -4584, -4408, -4419, -4134, -3667, -3437, -3435, -3415, -3482, -3874, -4391, -4529, -4132, -3669, -3729, -4249, -4532, -4242, -3944, -4098, -4271, -4149, -4365, -5238, -5786, -5252, -4446, -4338, -4491, -4087, -3347, -2845, -2408, -1731, -1215, -1198, -1070, -162, 949, 1209, 866, 1148, 2209, 2811, 2400, 2023, 2546, 3223, 3048, 2509, 2691, 3328, 3312, 2726, 2660, 3183, 3207, 2400, 1707, 1765, 2110, 2136, 1844, 1501, 1268, 1352, 1906, 2590, 2784, 2453, 2249, 2475, 2634, 2362, 2076, 2203, 2467, 2470, 2422, 2693, 3124, 3360, 3542, 3992, 4446, 4385, 4000, 3992, 4403, 4550, 4152, 3680, 3520, 3556, 3708, 4130, 4713, 4977, 4704, 4328, 4396, 4832, 5066, 4805, 4326, 3992, 3806, 3680, 3743, 4061, 4343, 4314, 4207, 4448, 4987, 5387, 5491, 5544, 5704, 5811, 5691, 5417, 5212, 5194, 5276, 5297, 5225, 5147, 5120, 5130, 5177, 5238, 5179, 4887, 4477, 4146, 3926, 3728, 3506, 3192, 2733, 2275, 2056, 2067, 2142, 2292, 2525, 2595, 2367, 2202, 2443, 2844, 2991, 2953, 3043, 3207, 3139, 2867, 2770, 3034, 3445, 3754, 3955, 4078, 4086, 4098, 4361, 4806, 4970, 4557, 3826, 3271, 3098, 3091, 2917, 2512, 2138, 2049, 2209, 2530, 3096, 3882, 4491, 4584, 4378, 4363, 4649, 4895, 4876, 4730, 4705, 4853, 5107, 5495, 6121, 6949, 7720, 8186, 8335, 8320, 8273, 8251, 8212, 7928, 7196, 6249, 5644, 5513, 5332, 4710, 4061, 4006, 4328, 4185, 3378, 2640, 2430, 2226, 1448, 337, -570, -1171, -1508, -1443, -1085, -982, -1365, -1656, -1155, -5, 972, 1269, 1176, 1274, 1765, 2402, 2790, 2746, 2512, 2451, 2439, 1982, 1065, 298, 36, 64, 370, 1514, 3855, 6966, 10092, 12764, 14880, 16471, 17623, 18448, 18968, 19161, 19134, 19257, 19932, 21177, 22555, 23620, 24445, 25472, 26790, 27765, 27456, 25387, 22095, 18940, 16947, 15712, 14014, 11650, 9613, 8413, 7406, 6129, 4997, 4291, 3573, 2484, 1200, -83, -1414, -2568, -3056, -2946, -2973, -3442, -3612, -2851, -1753, -1305, -1535, -1797, -1783, -1512, -985, -507, -738, -1789, -2822, -3133, -3128, -3626, -4630, -5436, -5797, -6199, -6915, -7491, -7464, -7016, -6548, -6086, -5550, -5214, -5346, -5640, -5602, -5330, -5250, -5246, -4779, -3834, -2941, -2247, -1326, -16, 1207, 1866, 2004, 1835, 1335, 459, -547, -1457, -2358, -3335, -4099, -4374, -4468, -4950, -5802, -6437, -6667, -6996, -7739, -8515, -9039, -9605, -10330, -10756, -10711, -10669, -10800, -10583, -9798, -9033, -8738, -8511, -7849, -7001, -6493, -6269, -5885, -5380, -5249, -5608, -6006, -6156, -6277, -6540, -6708, -6607, -6456, -6484, -6503, -6244, -5867, -5751, -5895, -5940, -5827, -5942, -6425, -6760, -6470, -5816, -5326, -4972, -4449, -3876, -3521, -3184, -2567, -2015, -2101, -2724, -3307, -3729, -4359, -5188, -5689, -5707, -5854, -6609, -7561, -8044, -8111, -8360, -9128, -10247, -11329, -12021, -12208, -12207, -12479, -13054, -13450, -13235, -12509, -11766, -11351, -11109, -10682, -10081, -9608, -9192, -8471, -7590, -7034, -6658, -5961, -5254, -5172, -5286, -4684, -3681, -3303, -3568, -3695, -3523, -3457, -3586, -3836, -4342, -5039, -5534, -5688, -5746, -5872, -6049, -6187, -6048, -5496, -4900, -4589, -4197, -3440, -2971, -3377, -4029, -4050, -3576, -3105, -2640, -2255, -2355, -2751, -2651, -1994, -1630, -1917, -2267, -2364, -2774, -3888, -5047, -5382, -5076, -5133, -5950, -6801, -6971, -6733, -6678, -6672, -6401, -6358, -7070, -7805, -7481, -6463, -5983, -6171, -6144, -5655, -5219, -4893, -4282, -3592, -3424, -3567, -3149, -2160, -1626, -1877, -1884, -1037, -311, -708, -1590, -1739, -1217, -972, -1180, -1192, -844, -664, -718, -349, 575, 1194, 905, 318, 336, 927, 1408, 1474, 1354, 1291, 1408, 1904, 2768, 3494, 3632, 3480, 3577, 3796, 3685, 3354, 3231, 3232, 2970, 2531, 2327, 2385, 2403, 2381, 2584, 2914, 2911, 2501, 2236, 2513, 2961, 2989, 2584, 2183, 2055, 2186, 2552, 3102, 3560, 3603, 3296, 3116, 3403, 3881, 3987, 3613, 3190, 2971, 2773, 2568, 2633, 2868, 2706, 2088, 1732, 2050, 2555, 2735, 2752, 2912, 3067, 2961, 2746, 2790, 3177, 3638, 3905, 3987, 4058, 4207, 4448, 4887, 5528, 5994, 5866, 5339, 5046, 5204, 5433, 5411, 5148, 4662, 4025, 3591, 3634, 3923, 4038, 3824, 3304, 2578, 2003, 1970, 2303, 2358, 1859, 1247, 1076, 1390, 1815, 2037, 2074, 2122, 2292, 2490, 2529, 2329, 2032, 1909, 2055, 2176, 1853, 1152, 706, 944, 1508, 1782, 1707, 1663, 1791, 1953, 2104, 2287, 2378, 2187, 1700, 1106, 690, 655, 896, 1132, 1319, 1646, 2083, 2406, 2678, 3124, 3475, 3120, 2028, 938, 386, 81, -435, -1009, -1271, -1361, -1608, -1813, -1629, -1358, -1538, -1919, -1769, -1186, -1200, -2326, -3789, -4623, -4867, -5104, -5504, -5929, -6332, -6287, -4855, -1768, 1874, 4908, 7534, 10638, 14131, 16952, 18473, 19056, 19238, 19186, 19231, 20004, 21643, 23573, 25368, 27184, 29019, 30288, 30626, 30464, 30241, 29534, 27630, 24736, 21918, 19898, 18520, 17447, 16683, 16224, 15810, 15264, 14678, 14132, 13530, 12825, 12152, 11563, 10894, 10011, 9136, 8643, 8588, 8586, 8290, 7801, 7435, 7280, 7171, 6908, 6295, 5215, 3938, 2973, 2374, 1611, 379, -1054, -2524, -4310, -6392, -8015, -8509, -8193, -7907, -7949, -7909, -7424, -6554, -5456, -4263, -3368, -3208, -3635, -3981, -3797, -3214, -2509, -1769, -910, 198, 1589, 3025, 4063, 4423, 4208, 3694, 2988, 2022, 811, -416, -1425, -2230, -3007, -3790, -4376, -4647, -4788, -5097, -5645, -6253, -6728, -7048, -7296, -7508, -7631, -7592, -7441, -7318, -7279, -7208, -7003, -6732, -6486, -6169, -5616, -4959, -4620, -4830, -5304, -5591, -5620, -5729, -6247, -7189, -8326, -9330, -9927, -10082, -10037, -10078, -10221, -10241, -10003, -9629, -9297, -9060, -8878, -8714, -8475, -8050, -7437, -6728, -5927, -4934, -3793, -2775, -2153, -1895, -1758, -1625, -1656, -2040, -2719, -3464, -4204, -5016, -5837, -6468, -6934, -7501, -8324, -9353, -10483, -11464, -12014, -12306, -12904, -13842, -14463, -14456, -14201, -13917, -13404, -12762, -12367, -12113, -11581, -10794, -10048, -9396, -8817, -8451, -8215, -7808, -7280, -6945, -6752, -6386, -5942, -5821, -6106, -6507, -6669, -6423, -6007, -5989, -6482, -6830, -6620, -6338, -6423, -6503, -6227, -5816, -5358, -4604, -3739, -3155, -2525, -1261, 271, 1229, 1595, 1995, 2599, 3060, 3187, 3036, 2739, 2511, 2507, 2617, 2634, 2468, 2064, 1476, 1037, 928, 644, -449, -2068, -3233, -3567, -3667, -4149, -4895, -5403, -5431, -5064, -4495, -3961, -3689, -3677, -3656, -3454, -3217, -3083, -2847, -2326, -1878, -2046, -2620, -2700, -1974, -1214, -1121, -1469, -1811, -2183, -2507, -2221, -1286, -766, -1521, -2811, -3197, -2525, -1930, -1985, -2109, -1900, -1650, -1300, -336, 1022, 1909, 2233, 2704, 3437, 3851, 3904, 4221, 4889, 5192, 4801, 4370, 4527, 4956, 5060, 4886, 4768, 4605, 4164, 3655, 3308, 2848, 1993, 1098, 679, 601, 326, -186, -424, -169, 229, 503, 793, 1160, 1408, 1516, 1700, 1939, 1972, 1820, 1827, 2124, 2433, 2501, 2395, 2295, 2221, 2120, 2025, 1966, 1838, 1520, 1088, 706, 409, 150, -6, 21, 103, 26, -101, 106, 751, 1419, 1724, 1795, 2015, 2519, 3144, 3696, 4059, 4181, 4143, 4191, 4481, 4867, 5072, 5043, 4912, 4716, 4396, 4017, 3687, 3328, 2828, 2292, 1895, 1611, 1314, 1004, 757, 588, 478, 413, 407, 514, 730, 879, 855, 921, 1368, 1956, 2213, 2126, 2025, 2023, 2088, 2291, 2503, 2352, 1873, 1546, 1467, 1242, 757, 263, -165, -570, -849, -1100, -1597, -2081, -1985, -1593, -1816, -2673, -3183, -2858, -2222, -1822, -1657, -1589, -1548, -1316, -659, 240, 870, 961, 768, 706, 883, 1078, 1033, 672, 207, 47, 334, 655, 555, 188, 55, 252, 448, 420, 177, -222, -612, -685, -331, 133, 318, 252, 414, 1204, 2336, 2945, 2657, 2183, 2290, 2597, 2269, 1442, 932, 823, 475, -282, -938, -1172, -1219, -1407, -1882, -2659, -3568, -4205, -4271, -3946, -3706, -3742, -3761, -3477, -3050, -2908, -3281, -4049, -4917, -5623, -6067, -6357, -6570, -6446, -5440, -3265, -265, 2895, 5789, 8293, 10309, 11693, 12534, 13146, 13689, 14073, 14356, 14994, 16341, 18203, 20163, 22064, 23776, 24893, 25197, 25051, 24882, 24556, 23671, 22200, 20548, 19219, 18573, 18632, 18938, 18898, 18369, 17771, 17469, 17295, 16828, 16029, 15264, 14786, 14484, 14215, 14021, 13887, 13551, 12822, 11884, 11129, 10616, 10021, 9093, 7996, 7037, 6240, 5488, 4905, 4616, 4259, 3275, 1721, 247, -790, -1663, -2675, -3725, -4501, -4764, -4397, -3510, -2537, -1926, -1690, -1476, -1085, -728, -707, -1033, -1531, -2122, -2722, -2988, -2574, -1712, -1106, -1064, -1136, -944, -843, -1309, -2134, -2771, -3181, -3734, -4475, -5000, -5038, -4845, -4906, -5294, -5525, -5222, -4714, -4559, -4679, -4562, -4143, -3780, -3481, -2945, -2348, -2286, -2866, -3477, -3688, -3824, -4373, -5161, -5587, -5495, -5395, -5667, -6016, -6023, -5915, -6195, -6791, -7231, -7529, -8126, -8992, -9531, -9485, -9213, -8972, -8525, -7664, -6663, -5931, -5474, -4971, -4314, -3799, -3725, -3979, -4162, -4054, -3791, -3639, -3698, -3901, -4143, -4410, -4764, -5258, -5837, -6414, -6981, -7631, -8414, -9171, -9699, -10006, -10316, -10746, -11161, -11428, -11624, -11842, -11938, -11730, -11304, -10922, -10656, -10348, -9925, -9575, -9530, -9738, -9928, -9997, -10177, -10656, -11236, -11586, -11691, -11763, -11837, -11807, -11732, -11755, -11818, -11744, -11569, -11512, -11667, -11889, -12033, -12038, -11769, -11091, -10133, -9224, -8430, -7553, -6607, -5819, -5132, -4233, -3228, -2698, -2816, -2919, -2371, -1427, -822, -727, -690, -476, -360, -510, -656, -597, -587, -912, -1397, -1663, -1669, -1667, -1775, -1901, -1996, -2081, -2105, -2062, -2104, -2254, -2241, -1880, -1473, -1407, -1580, -1578, -1379, -1398, -1783, -2170, -2342, -2635, -3335, -4127, -4541, -4612, -4717, -5004, -5318, -5526, -5630, -5635, -5548, -5467, -5508, -5598, -5462, -4943, -4243, -3679, -3245, -2701, -2009, -1386, -847, -134, 756, 1439, 1669, 1710, 1938, 2396, 2903, 3362, 3756, 3992, 3975, 3788, 3650, 3678, 3784, 3772, 3503, 3023, 2618, 2592, 2903, 3160, 3136, 3093, 3409, 3967, 4299, 4288, 4292, 4458, 4519, 4457, 4674, 5209, 5496, 5270, 5004, 5120, 5389, 5423, 5213, 4926, 4588, 4186, 3818, 3551, 3318, 3053, 2759, 2356, 1757, 1213, 1159, 1511, 1635, 1302, 1086, 1446, 2004, 2213, 2201, 2382, 2640, 2563, 2315, 2538, 3319, 3939, 3903, 3665, 3894, 4497, 4829, 4616, 4196, 3914, 3702, 3360, 2972, 2810, 2907, 2965, 2713, 2275, 2050, 2185, 2314, 2063, 1683, 1705, 2060, 2203, 2055, 2100, 2445, 2590, 2324, 2116, 2360, 2768, 2833, 2568, 2433, 2660, 2955, 2960, 2778, 2796, 3069, 3199, 2907, 2457, 2314, 2568, 2879, 2980, 2959, 2986, 3021, 2937, 2782, 2675, 2588, 2418, 2212, 2110, 2164, 2286, 2343, 2276, 2188, 2227, 2320, 2248, 1993, 1711, 1389, 965, 673, 752, 942, 856, 614, 501, 367, -46, -551, -801, -824, -830, -843, -775, -578, -242, 108, 279, 294, 385, 550, 541, 316, 77, -104, -259, -212, 169, 574, 586, 331, 320, 669, 958, 931, 879, 1091, 1365, 1398, 1321, 1407, 1480, 1164, 584, 362, 850, 1733, 2463, 2879, 3210, 3592, 3850, 3778, 3448, 3085, 2734, 2216, 1436, 605, 75, 33, 397, 961, 1514, 1859, 1876, 1650, 1437, 1379, 1260, 807, 189, -77, 141, 420, 480, 566, 918, 1385, 1726, 1870, 1783, 1509, 1270, 1117, 728, -51, -839, -1231, -1310, -1365, -1481, -1650, -1913, -2206, -2338, -2252, -2100, -1982, -1828, -1657, -1664, -1836, -1775, -1239, -640, -579, -1060, -1570, -1872, -2220, -2727, -3024, -2786, -2155, -1353, -206, 1539, 3729, 6020, 8257, 10261, 11628, 12146, 12168, 12210, 12367, 12429, 12408, 12622, 13291, 14312, 15467, 16665, 17848, 18887, 19601, 19791, 19325, 18396, 17499, 16915, 16540, 16277, 16185, 16140, 15926, 15742, 15975, 16435, 16473, 15875, 15086, 14504, 14118, 13836, 13716, 13712, 13588, 13218, 12778, 12429, 12007, 11225, 10081, 8867, 7744, 6646, 5640, 5032, 4865, 4706, 4238, 3712, 3375, 2938, 2049, 928, -24, -883, -1951, -3165, -4081, -4375, -4139, -3757, -3518, -3363, -3088, -2763, -2692, -2968, -3382, -3799, -4310, -4937, -5479, -5832, -6182, -6616, -6841, -6673, -6512, -6797, -7252, -7338, -7228, -7519, -8133, -8364, -8000, -7650, -7784, -8125, -8222, -8155, -8283, -8564, -8585, -8239, -7928, -7881, -7701, -7004, -6084, -5476, -5112, -4669, -4333, -4484, -4922, -5203, -5416, -5894, -6484, -6786, -6811, -6832, -6884, -6819, -6672, -6595, -6592, -6511, -6311, -6192, -6324, -6523, -6441, -6119, -5989, -6171, -6195, -5728, -5139, -4941, -4971, -4688, -4095, -3736, -3772, -3714, -3316, -3053, -3294, -3626, -3553, -3349, -3553, -4116, -4611, -4918, -5242, -5681, -6148, -6523, -6738, -6816, -6887, -7042, -7232, -7352, -7404, -7487, -7690, -8001, -8305, -8486, -8528, -8551, -8652, -8747, -8636, -8291, -7989, -8011, -8334, -8730, -9084, -9396, -9640, -9860, -10218, -10769, -11316, -11616, -11622, -11481, -11401, -11454, -11415, -11061, -10663, -10573, -10459, -9784, -8872, -8426, -8285, -7789, -7051, -6600, -6292, -5723, -5180, -5099, -5160, -4812, -4162, -3700, -3547, -3468, -3286, -3056, -2929, -2930, -2887, -2734, -2746, -3122, -3564, -3670, -3485, -3245, -2935, -2541, -2335, -2420, -2424, -2049, -1546, -1288, -1263, -1254, -1211, -1193, -1159, -1012, -745, -476, -348, -366, -431, -554, -843, -1206, -1365, -1305, -1382, -1762, -2136, -2226, -2213, -2357, -2560, -2597, -2552, -2697, -3023, -3204, -3032, -2700, -2508, -2448, -2277, -1956, -1713, -1623, -1438, -1057, -788, -901, -1238, -1449, -1359, -971, -468, -217, -393, -664, -615, -320, -95, 19, 158, 244, 106, -154, -241, -4, 426, 822, 1054, 1147, 1194, 1271, 1464, 1848, 2331, 2650, 2677, 2606, 2652, 2787, 2932, 3144, 3390, 3458, 3312, 3197, 3286, 3487, 3682, 3832, 3882, 3795, 3693, 3705, 3807, 3918, 4015, 4038, 3877, 3575, 3379, 3439, 3627, 3723, 3697, 3691, 3763, 3779, 3651, 3569, 3792, 4168, 4264, 4019, 3828, 3861, 3849, 3695, 3639, 3674, 3470, 3042, 2820, 2943, 3064, 2948, 2752, 2683, 2710, 2696, 2570, 2352, 2133, 1978, 1860, 1708, 1536, 1429, 1434, 1512, 1603, 1694, 1759, 1750, 1721, 1821, 2061, 2235, 2205, 2119, 2136, 2177, 2105, 1989, 2004, 2161, 2320, 2382, 2379, 2387, 2439, 2520, 2627, 2756, 2839, 2765, 2559, 2403, 2390, 2384, 2252, 2089, 2058, 2141, 2191, 2164, 2142, 2213, 2379, 2558, 2669, 2728, 2820, 2947, 3023, 3027, 3017, 3005, 2983, 3030, 3191, 3328, 3303, 3224, 3292, 3497, 3658, 3707, 3750, 3875, 4026, 4099, 4063, 3958, 3843, 3766, 3748, 3754, 3695, 3528, 3326, 3220, 3268, 3376, 3387, 3247, 3087, 3058, 3121, 3107, 2964, 2811, 2727, 2633, 2462, 2274, 2153, 2070, 1954, 1824, 1750, 1729, 1704, 1674, 1708, 1788, 1779, 1611, 1398, 1297, 1270, 1174, 997, 873, 850, 815, 699, 589, 586, 655, 693, 657, 553, 379, 183, 87, 126, 132, -73, -414, -646, -667, -611, -636, -753, -866, -891, -811, -665, -520, -409, -327, -267, -243, -249, -238, -187, -159, -227, -343, -354, -210, -59, -50, -117, -120, -101, -170, -245, -230, -284, -553, -819, -836, -788, -966, -1253, -1358, -1326, -1386, -1491, -1408, -1154, -979, -965, -933, -807, -736, -785, -827, -835, -1011, -1419, -1792, -1907, -1913, -2037, -2133, -1893, -1371, -907, -571, -147, 397, 893, 1337, 1800, 2115, 2147, 2158, 2417, 2718, 2726, 2584, 2726, 3214, 3700, 3975, 4194, 4525, 4908, 5298, 5800, 6385, 6796, 6905, 6933, 7130, 7455, 7737, 7950, 8137, 8284, 8390, 8591, 9000, 9522, 9993, 10423, 10884, 11300, 11588, 11869, 12237, 12555, 12638, 12538, 12389, 12265, 12267, 12435, 12602, 12545, 12326, 12215, 12331, 12550, 12732, 12838, 12867, 12825, 12767, 12749, 12706, 12545, 12313, 12157, 12044, 11820, 11524, 11353, 11313, 11242, 11140, 11082, 10974, 10733, 10510, 10398, 10192, 9744, 9214, 8762, 8302, 7748, 7197, 6727, 6253, 5684, 5086, 4562, 4149, 3817, 3512, 3165, 2704, 2094, 1428, 863, 442, -18, -687, -1453, -2064, -2473, -2802, -3079, -3269, -3471, -3750, -3972, -4078, -4244, -4576, -4901, -5117, -5415, -5949, -6567, -7051, -7423, -7818, -8269, -8702, -9080, -9407, -9651, -9789, -9893, -10069, -10309, -10518, -10655, -10776, -10912, -11058, -11207, -11375, -11531, -11612, -11592, -11505, -11385, -11237, -11082, -10929, -10735, -10491, -10285, -10225, -10233, -10183, -10103, -10113, -10187, -10225, -10257, -10374, -10536, -10625, -10633, -10625, -10620, -10591, -10581, -10660, -10804, -10899, -10896, -10893, -11014, -11241, -11414, -11445, -11396, -11363, -11349, -11304, -11207, -11060, -10879, -10729, -10669, -10663, -10633, -10599, -10638, -10732, -10810, -10881, -10968, -11052, -11126, -11225, -11269, -11119, -10813, -10562, -10465, -10417, -10291, -10044, -9732, -9487, -9442, -9537, -9573, -9451, -9233, -8993, -8771, -8631, -8548, -8382, -8045, -7645, -7324, -7098, -6942, -6885, -6910, -6889, -6740, -6557, -6506, -6609, -6712, -6662, -6481, -6305, -6186, -6048, -5849, -5651, -5487, -5298, -5079, -4905, -4762, -4570, -4373, -4261, -4170, -3962, -3681, -3435, -3199, -2944, -2764, -2672, -2498, -2199, -1970, -1946, -1999, -1983, -1937, -1952, -1994, -1987, -1951, -1944, -1930, -1832, -1667, -1551, -1499, -1370, -1079, -799, -731, -814, -825, -735, -657, -560, -332, -77, 15, 27, 221, 656, 1166, 1614, 1969, 2193, 2285, 2341, 2478, 2699, 2895, 2987, 2986, 2983, 3055, 3205, 3365, 3470, 3558, 3737, 4026, 4307, 4468, 4561, 4674, 4783, 4793, 4729, 4727, 4849, 5015, 5133, 5204, 5271, 5353, 5485, 5716, 6025, 6290, 6424, 6488, 6561, 6585, 6453, 6212, 6033, 5969, 5875, 5667, 5452, 5361, 5376, 5411, 5431, 5447, 5467, 5512, 5594, 5660, 5607, 5408, 5166, 4992, 4879, 4759, 4610, 4461, 4323, 4207, 4146, 4124, 4098, 4092, 4152, 4205, 4142, 3994, 3876, 3776, 3575, 3253, 2903, 2592, 2330, 2130, 2008, 1920, 1807, 1700, 1705, 1842, 1982, 1999, 1921, 1855, 1823, 1754, 1621, 1495, 1445, 1442, 1413, 1337, 1284, 1315, 1414, 1503, 1531, 1528, 1551, 1590, 1573, 1473, 1347, 1237, 1128, 1014, 917, 823, 697, 597, 624, 767, 884, 907, 923, 1033, 1207, 1335, 1376, 1371, 1356, 1347, 1384, 1480, 1574, 1588, 1559, 1605, 1745, 1877, 1928, 1969, 2089, 2246, 2314, 2265, 2193, 2174, 2181, 2150, 2071, 1983, 1923, 1904, 1915, 1917, 1889, 1871, 1918, 1986, 1978, 1899, 1849, 1839, 1783, 1658, 1556, 1539, 1568, 1588, 1575, 1520, 1443, 1395, 1412, 1475, 1522, 1487, 1365, 1230, 1169, 1152, 1045, 787, 478, 265, 196, 191, 120, -74, -303, -374, -231, -70, -140, -422, -637, -643, -631, -810, -1103, -1330, -1485, -1635, -1725, -1717, -1752, -1940, -2128, -2104, -1918, -1811, -1857, -1926, -1930, -1939, -1970, -1927, -1799, -1738, -1824, -1910, -1850, -1735, -1719, -1741, -1626, -1396, -1215, -1081, -850, -567, -442, -484, -454, -263, -96, -84, -76, 82, 260, 230, 27, -87, 34, 312, 596, 782, 783, 607, 425, 424, 562, 633, 574, 528, 555, 519, 379, 307, 392, 485, 478, 470, 509, 467, 307, 168, 67, -173, -622, -1057, -1254, -1233, -1154, -1081, -963, -778, -520, -115, 502, 1210, 1762, 2065, 2270, 2530, 2801, 2965, 3049, 3175, 3354, 3496, 3585, 3750, 4075, 4481, 4857, 5224, 5690, 6291, 6930, 7488, 7932, 8296, 8632, 8985, 9380, 9788, 10105, 10313, 10525, 10841, 11202, 11543, 11935, 12467, 13077, 13629, 14082, 14445, 14707, 14899, 15124, 15385, 15540, 15478, 15314, 15242, 15279, 15275, 15168, 15048, 14977, 14952, 15002, 15142, 15248, 15146, 14861, 14599, 14454, 14329, 14134, 13919, 13727, 13463, 13063, 12655, 12413, 12316, 12212, 12059, 11893, 11663, 11263, 10726, 10236, 9887, 9541, 8992, 8231, 7469, 6892, 6451, 5980, 5415, 4846, 4357, 3969, 3661, 3374, 3003, 2490, 1907, 1346, 813, 292, -205, -668, -1126, -1620, -2158, -2691, -3110, -3313, -3369, -3506, -3857, -4354, -4857, -5281, -5596, -5861, -6241, -6845, -7602, -8352, -8993, -9469, -9773, -10044, -10435, -10911, -11288, -11479, -11550, -11584, -11663, -11895, -12277, -12610, -12683, -12541, -12450, -12585, -12888, -13152, -13259, -13218, -13076, -12878, -12695, -12621, -12650, -12660, -12572, -12440, -12321, -12192, -12096, -12155, -12351, -12478, -12440, -12360, -12345, -12353, -12347, -12343, -12302, -12166, -12000, -11934, -11977, -12033, -12041, -12012, -11978, -11943, -11918, -11925, -11958, -11965, -11882, -11723, -11547, -11411, -11293, -11197, -11155, -11163, -11138, -11047, -10975, -10992, -11063, -11149, -11262, -11357, -11337, -11182, -10981, -10790, -10612, -10439, -10248, -9997, -9693, -9417, -9210, -9053, -8940, -8882, -8832, -8713, -8552, -8467, -8468, -8402, -8150, -7822, -7583, -7404, -7170, -6912, -6732, -6583, -6368, -6142, -6026, -6023, -6066, -6132, -6199, -6186, -6034, -5790, -5553, -5393, -5292, -5152, -4904, -4597, -4325, -4082, -3812, -3548, -3398, -3379, -3365, -3248, -3059, -2890, -2767, -2630, -2444, -2241, -2066, -1946, -1877, -1818, -1719, -1589, -1497, -1504, -1597, -1727, -1827, -1834, -1756, -1665, -1574, -1409, -1175, -983, -863, -685, -382, -82, 69, 84, 70, 75, 93, 127, 174, 203, 222, 329, 610, 989, 1287, 1425, 1514, 1675, 1889, 2041, 2074, 2026, 1939, 1799, 1599, 1401, 1299, 1332, 1450, 1595, 1772, 2038, 2402, 2773, 3053, 3243, 3415, 3585, 3713, 3761, 3695, 3507, 3276, 3158, 3219, 3351, 3429, 3498, 3701, 4055, 4412, 4649, 4801, 4949, 5099, 5192, 5201, 5118, 4940, 4710, 4522, 4429, 4367, 4253, 4138, 4165, 4375, 4638, 4800, 4856, 4903, 4991, 5074, 5078, 4992, 4850, 4687, 4498, 4265, 4006, 3805, 3741, 3783, 3804, 3727, 3611, 3544, 3517, 3467, 3359, 3213, 3043, 2857, 2667, 2481, 2299, 2132, 1994, 1893, 1817, 1767, 1772, 1843, 1943, 2005, 1989, 1888, 1737, 1616, 1583, 1572, 1453, 1211, 975, 862, 882, 975, 1038, 989, 873, 839, 910, 934, 815, 651, 558, 503, 412, 298, 218, 171, 147, 182, 298, 430, 507, 551, 635, 760, 867, 936, 988, 1001, 940, 855, 840, 882, 854, 727, 647, 732, 898, 1021, 1128, 1284, 1423, 1454, 1450, 1536, 1683, 1727, 1632, 1541, 1556, 1594, 1546, 1445, 1390, 1428, 1552, 1717, 1828, 1822, 1782, 1838, 1973, 2047, 2005, 1956, 1980, 2011, 1943, 1776, 1603, 1486, 1414, 1365, 1323, 1238, 1084, 916, 832, 833, 817, 717, 589, 505, 454, 399, 343, 293, 208, 76, -39, -110, -197, -344, -499, -593, -654, -768, -927, -1005, -917, -770, -773, -941, -1056, -987, -875, -900, -1000, -1048, -1065, -1127, -1216, -1302, -1420, -1543, -1549, -1405, -1261, -1253, -1325, -1311, -1148, -895, -636, -440, -368, -397, -390, -263, -134, -158, -297, -379, -335, -234, -145, -68, -9, 19, 41, 114, 236, 375, 568, 833, 1008, 882, 517, 229, 198, 305, 357, 299, 158, -66, -330, -496, -457, -269, -88, -18, -63, -203, -403, -598, -731, -843, -1033, -1337, -1685, -1981, -2172, -2241, -2178, -2011, -1758, -1379, -834, -219, 331, 839, 1419, 2034, 2490, 2711, 2820, 2954, 3152, 3397, 3654, 3853, 3949, 4036, 4297, 4796, 5430, 6065, 6688, 7328, 7937, 8455, 8919, 9420, 9978, 10513, 10938, 11230, 11438, 11643, 11921, 12300, 12747, 13224, 13701, 14154, 14574, 15007, 15508, 16057, 16509, 16764, 16865, 16921, 16991, 17099, 17246, 17347, 17279, 17034, 16784, 16708, 16815, 16969, 17043, 17012, 16869, 16650, 16429, 16296, 16245, 16179, 16018, 15734, 15351, 14922, 14550, 14319, 14214, 14107, 13869, 13464, 12979, 12539, 12215, 11947, 11565, 10971, 10261, 9621, 9109, 8634, 8097, 7499, 6899, 6358, 5942, 5667, 5444, 5151, 4741, 4266, 3761, 3208, 2630, 2124, 1699, 1214, 563, -173, -823, -1294, -1593, -1794, -2010, -2325, -2703, -3076, -3452, -3855, -4248, -4628, -5103, -5742, -6464, -7138, -7756, -8359, -8921, -9374, -9725, -10055, -10378, -10631, -10809, -10987, -11207, -11431, -11622, -11780, -11899, -12011, -12198, -12502, -12838, -13074, -13177, -13207, -13230, -13279, -13336, -13351, -13279, -13135, -13006, -12945, -12900, -12821, -12782, -12845, -12937, -12967, -13002, -13114, -13226, -13246, -13232, -13251, -13233, -13137, -13054, -13060, -13056, -12948, -12788, -12711, -12715, -12697, -12636, -12584, -12530, -12420, -12288, -12216, -12172, -12061, -11903, -11822, -11838, -11839, -11762, -11688, -11685, -11694, -11638, -11546, -11487, -11437, -11327, -11149, -10932, -10683, -10431, -10226, -10054, -9840, -9569, -9329, -9178, -9077, -8971, -8878, -8833, -8756, -8594, -8420, -8310, -8181, -7949, -7708, -7550, -7381, -7125, -6896, -6801, -6743, -6601, -6446, -6380, -6355, -6275, -6143, -6023, -5885, -5652, -5337, -5064, -4904, -4790, -4612, -4351, -4066, -3790, -3529, -3315, -3192, -3133, -3042, -2863, -2672, -2565, -2532, -2470, -2336, -2213, -2178, -2195, -2176, -2099, -2027, -2016, -2070, -2153, -2223, -2249, -2223, -2175, -2138, -2103, -2021, -1872, -1695, -1551, -1443, -1333, -1203, -1082, -1005, -954, -891, -829, -811, -832, -810, -697, -551, -435, -333, -216, -131, -118, -103, 14, 191, 277, 198, 39, -76, -132, -201, -317, -418, -447, -436, -438, -427, -341, -183, -9, 148, 269, 318, 313, 342, 434, 480, 391, 235, 171, 265, 448, 624, 768, 904, 1049, 1207, 1393, 1627, 1861, 2001, 2032, 2042, 2086, 2114, 2104, 2137, 2249, 2356, 2395, 2414, 2473, 2575, 2737, 2962, 3180, 3296, 3342, 3429, 3567, 3650, 3628, 3581, 3585, 3585, 3530, 3479, 3481, 3478, 3414, 3347, 3332, 3340, 3340, 3362, 3393, 3373, 3293, 3218, 3179, 3161, 3150, 3132, 3071, 2961, 2859, 2821, 2835, 2833, 2787, 2729, 2700, 2680, 2630, 2547, 2468, 2403, 2334, 2269, 2246, 2232, 2152, 2039, 2001, 2016, 1942, 1767, 1633, 1583, 1534, 1464, 1417, 1360, 1244, 1147, 1185, 1324, 1423, 1431, 1420, 1429, 1418, 1386, 1396, 1458, 1497, 1479, 1448, 1403, 1302, 1198, 1202, 1277, 1285, 1204, 1144, 1150, 1143, 1083, 1032, 1041, 1053, 993, 870, 768, 743, 784, 843, 872, 856, 840, 899, 1044, 1203, 1284, 1274, 1231, 1218, 1253, 1319, 1386, 1426, 1447, 1496, 1583, 1655, 1695, 1768, 1906, 2039, 2117, 2172, 2210, 2199, 2202, 2307, 2448, 2485, 2436, 2409, 2407, 2390, 2419, 2533, 2608, 2534, 2398, 2362, 2413, 2423, 2349, 2252, 2131, 1928, 1690, 1555, 1541, 1507, 1369, 1224, 1154, 1097, 984, 893, 895, 889, 717, 429, 219, 146, 103, 25, -62, -167, -320, -452, -446, -330, -253, -281, -338, -348, -339, -343, -316, -238, -178, -184, -220, -248, -255, -176, 32, 259, 380, 451, 575, 712, 794, 863, 932, 909, 799, 747, 799, 826, 767, 729, 779, 840, 845, 865, 971, 1080, 1045, 862, 673, 572, 497, 370, 198, 37, -96, -203, -249, -215, -145, -106, -93, -55, 1, 8, -94, -309, -596, -906, -1208, -1514, -1825, -2088, -2238, -2266, -2167, -1905, -1471, -952, -448, 39, 567, 1092, 1481, 1697, 1835, 1940, 1944, 1861, 1845, 1964, 2136, 2331, 2625, 3027, 3474, 4003, 4682, 5441, 6122, 6705, 7263, 7795, 8236, 8579, 8895, 9192, 9419, 9607, 9860, 10186, 10501, 10811, 11259, 11881, 12505, 13002, 13438, 13932, 14425, 14778, 14963, 15065, 15146, 15196, 15242, 15333, 15443, 15489, 15474, 15501, 15624, 15809, 15999, 16167, 16272, 16288, 16236, 16173, 16109, 16007, 15852, 15682, 15522, 15347, 15153, 14986, 14882, 14805, 14697, 14551, 14395, 14224, 14008, 13726, 13362, 12898, 12361, 11822, 11357, 10930, 10440, 9860, 9292, 8850, 8527, 8234, 7944, 7679, 7414, 7071, 6630, 6143, 5630, 5072, 4481, 3900, 3335, 2738, 2128, 1594, 1170, 790, 389, -6, -347, -659, -1022, -1454, -1935, -2460, -3015, -3576, -4160, -4816, -5535, -6220, -6802, -7318, -7826, -8294, -8662, -8928, -9169, -9423, -9674, -9926, -10200, -10472, -10700, -10915, -11174, -11464, -11707, -11883, -12044, -12219, -12354, -12413, -12424, -12443, -12469, -12454, -12412, -12397, -12433, -12472, -12483, -12496, -12545, -12601, -12640, -12685, -12767, -12846, -12872, -12838, -12768, -12699, -12668, -12683, -12696, -12657, -12601, -12589, -12602, -12600, -12599, -12618, -12612, -12540, -12443, -12400, -12384, -12313, -12175, -12058, -12006, -11971, -11901, -11840, -11844, -11862, -11817, -11728, -11699, -11713, -11664, -11520, -11370, -11263, -11122, -10914, -10713, -10561, -10374, -10106, -9868, -9769, -9744, -9641, -9462, -9340, -9327, -9325, -9247, -9126, -9016, -8903, -8758, -8603, -8452, -8293, -8122, -7970, -7865, -7788, -7700, -7600, -7520, -7478, -7432, -7332, -7175, -7000, -6821, -6641, -6463, -6288, -6092, -5852, -5602, -5377, -5172, -4960, -4760, -4611, -4504, -4391, -4252, -4119, -4026, -3959, -3887, -3808, -3733, -3650, -3551, -3458, -3391, -3347, -3310, -3278, -3264, -3275, -3298, -3300, -3256, -3172, -3078, -2982, -2855, -2680, -2486, -2319, -2171, -1998, -1794, -1596, -1420, -1275, -1216, -1245, -1231, -1068, -868, -794, -817, -799, -725, -664, -604, -485, -332, -225, -178, -158, -162, -222, -319, -397, -455, -535, -628, -668, -634, -595, -601, -602, -518, -352, -173, -18, 113, 193, 200, 199, 270, 384, 452, 472, 506, 561, 601, 664, 837, 1121, 1414, 1611, 1707, 1776, 1884, 2064, 2286, 2464, 2519, 2473, 2439, 2494, 2630, 2811, 2987, 3104, 3157, 3224, 3369, 3568, 3762, 3926, 4033, 4060, 4038, 4038, 4080, 4118, 4118, 4081, 4003, 3889, 3795, 3795, 3887, 3977, 3972, 3882, 3804, 3821, 3923, 4028, 4064, 4030, 3987, 3982, 4000, 4010, 4005, 3993, 3958, 3894, 3835, 3815, 3822, 3812, 3777, 3721, 3638, 3522, 3415, 3369, 3375, 3357, 3268, 3137, 3016, 2923, 2868, 2857, 2853, 2794, 2667, 2535, 2450, 2390, 2308, 2208, 2132, 2087, 2054, 2026, 2011, 1994, 1958, 1921, 1907, 1909, 1910, 1893, 1831, 1704, 1556, 1470, 1457, 1424, 1308, 1172, 1106, 1091, 1039, 953, 896, 867, 804, 710, 650, 622, 561, 462, 384, 349, 318, 287, 321, 426, 513, 528, 544, 623, 695, 679, 628, 658, 761, 810, 739, 624, 597, 724, 965, 1216, 1387, 1451, 1465, 1528, 1699, 1929, 2109, 2166, 2124, 2049, 1978, 1917, 1870, 1854, 1856, 1851, 1848, 1905, 2042, 2193, 2285, 2314, 2320, 2331, 2364, 2424, 2450, 2338, 2065, 1746, 1539, 1475, 1484, 1506, 1530, 1513, 1417, 1308, 1296, 1369, 1432, 1457, 1448, 1341, 1063, 671, 285, -34, -277, -409, -436, -459, -562, -685, -690, -549, -376, -264, -194, -127, -112, -217, -435, -690, -937, -1158, -1308, -1328, -1219, -1055, -897, -727, -496, -219, 38, 231, 349, 378, 298, 164, 28, -155, -447, -736, -827, -691, -477, -286, -99, 105, 327, 579, 840, 1045, 1171, 1233, 1187, 961, 588, 193, -115, -293, -346, -359, -415, -453, -361, -166, 27, 200, 335, 307, 59, -267, -543, -817, -1155, -1488, -1773, -2068, -2354, -2423, -2106, -1515, -910, -415, 38, 530, 1031, 1483, 1893, 2258, 2502, 2561, 2507, 2492, 2574, 2710, 2884, 3135, 3467, 3883, 4446, 5176, 5928, 6523, 6939, 7284, 7638, 8009, 8381, 8696, 8909, 9059, 9213, 9385, 9605, 9983, 10576, 11257, 11842, 12291, 12726, 13207, 13685, 14112, 14493, 14771, 14843, 14761, 14729, 14804, 14823, 14701, 14576, 14595, 14707, 14833, 14986, 15202, 15399, 15455, 15380, 15280, 15219, 15163, 15055, 14872, 14610, 14274, 13936, 13727, 13679, 13665, 13546, 13381, 13291, 13250, 13131, 12927, 12696, 12418, 12032, 11566, 11080, 10547, 9956, 9384, 8884, 8402, 7887, 7409, 7074, 6888, 6761, 6601, 6369, 6049, 5656, 5248, 4881, 4512, 4014, 3339, 2610, 2001, 1544, 1136, 734, 371, 50, -283, -622, -877, -1040, -1258, -1658, -2215, -2811, -3414, -4031, -4603, -5134, -5782, -6636, -7507, -8142, -8518, -8761, -8914, -9022, -9225, -9568, -9887, -10030, -10064, -10142, -10314, -10541, -10788, -11044, -11258, -11409, -11547, -11718, -11872, -11904, -11805, -11671, -11578, -11506, -11442, -11425, -11446, -11401, -11242, -11094, -11128, -11338, -11567, -11722, -11802, -11815, -11728, -11585, -11509, -11553, -11624, -11603, -11494, -11390, -11341, -11336, -11357, -11406, -11464, -11513, -11552, -11584, -11597, -11590, -11555, -11498, -11468, -11491, -11509, -11463, -11420, -11473, -11545, -11508, -11442, -11507, -11641, -11656, -11542, -11447, -11387, -11231, -10943, -10642, -10391, -10132, -9823, -9558, -9382, -9221, -8999, -8784, -8678, -8644, -8585, -8482, -8374, -8257, -8100, -7918, -7751, -7589, -7395, -7189, -7015, -6868, -6724, -6623, -6602, -6606, -6554, -6478, -6437, -6399, -6292, -6132, -5985, -5845, -5642, -5385, -5141, -4927, -4691, -4441, -4255, -4148, -4038, -3882, -3736, -3613, -3462, -3299, -3238, -3304, -3343, -3213, -2976, -2816, -2806, -2869, -2908, -2891, -2819, -2735, -2719, -2780, -2819, -2771, -2708, -2701, -2686, -2578, -2386, -2186, -2029, -1924, -1812, -1608, -1314, -1070, -1001, -1050, -1023, -827, -560, -376, -313, -322, -333, -266, -88, 92, 110, -17, -95, -23, 75, 65, -15, -61, -66, -118, -264, -429, -493, -440, -388, -459, -625, -746, -735, -640, -573, -590, -658, -712, -714, -662, -570, -452, -305, -120, 94, 304, 485, 658, 862, 1082, 1219, 1200, 1095, 1064, 1204, 1430, 1572, 1550, 1448, 1421, 1580, 1926, 2325, 2594, 2690, 2761, 2951, 3205, 3375, 3440, 3498, 3585, 3627, 3595, 3579, 3647, 3746, 3803, 3832, 3873, 3925, 4008, 4170, 4346, 4369, 4187, 3932, 3745, 3644, 3573, 3476, 3302, 3048, 2785, 2606, 2555, 2619, 2741, 2843, 2892, 2925, 2977, 3027, 3058, 3081, 3088, 3033, 2901, 2752, 2650, 2592, 2546, 2489, 2417, 2341, 2296, 2321, 2398, 2439, 2376, 2233, 2077, 1927, 1771, 1625, 1507, 1378, 1196, 1001, 892, 909, 999, 1095, 1182, 1274, 1365, 1434, 1483, 1533, 1575, 1563, 1489, 1391, 1287, 1154, 1019, 949, 925, 852, 750, 732, 796, 812, 751, 717, 732, 693, 564, 428, 335, 254, 182, 163, 177, 147, 73, 94, 303, 602, 839, 995, 1158, 1360, 1574, 1768, 1918, 2025, 2124, 2253, 2382, 2446, 2452, 2478, 2567, 2675, 2756, 2820, 2896, 2981, 3071, 3186, 3287, 3284, 3187, 3127, 3154, 3166, 3088, 2971, 2881, 2818, 2778, 2768, 2767, 2761, 2772, 2793, 2765, 2680, 2614, 2616, 2628, 2569, 2434, 2279, 2146, 2037, 1932, 1802, 1630, 1446, 1324, 1287, 1257, 1139, 962, 820, 757, 738, 689, 573, 403, 238, 125, 47, -26, -103, -197, -330, -468, -552, -608, -719, -886, -1046, -1194, -1375, -1558, -1679, -1750, -1847, -1988, -2115, -2191, -2225, -2237, -2228, -2205, -2169, -2083, -1935, -1797, -1753, -1756, -1692, -1573, -1507, -1521, -1549, -1557, -1528, -1393, -1142, -883, -709, -579, -419, -233, -53, 111, 243, 332, 399, 437, 365, 139, -112, -198, -116, -72, -198, -365, -368, -177, 88, 307, 391, 310, 171, 133, 192, 187, 9, -319, -728, -1125, -1386, -1462, -1431, -1368, -1238, -989, -645, -261, 166, 653, 1136, 1512, 1765, 1969, 2175, 2364, 2500, 2580, 2616, 2646, 2761, 3032, 3428, 3850, 4231, 4561, 4868, 5207, 5627, 6131, 6662, 7118, 7419, 7574, 7728, 8041, 8500, 8941, 9247, 9494, 9837, 10331, 10910, 11479, 11997, 12475, 12935, 13346, 13656, 13872, 14049, 14240, 14422, 14543, 14595, 14629, 14703, 14843, 15030, 15214, 15346, 15413, 15479, 15604, 15787, 15920, 15921, 15799, 15626, 15472, 15366, 15319, 15307, 15262, 15134, 14965, 14834, 14760, 14704, 14643, 14555, 14383, 14077, 13653, 13186, 12743, 12333, 11900, 11395, 10850, 10359, 9960, 9587, 9179, 8764, 8414, 8160, 7972, 7796, 7591, 7317, 6947, 6491, 5998, 5509, 5027, 4520, 3999, 3516, 3071, 2599, 2080, 1608, 1270, 1004, 690, 282, -166, -615, -1081, -1600, -2170, -2772, -3381, -4009, -4659, -5325, -5959, -6491, -6888, -7191, -7473, -7763, -8036, -8239, -8381, -8519, -8711, -8959, -9211, -9428, -9625, -9856, -10130, -10409, -10656, -10855, -11006, -11097, -11147, -11213, -11310, -11384, -11369, -11302, -11280, -11343, -11442, -11520, -11561, -11589, -11651, -11768, -11899, -11998, -12061, -12093, -12075, -11994, -11911, -11876, -11874, -11873, -11860, -11824, -11766, -11734, -11798, -11937, -12053, -12076, -12042, -12037, -12108, -12225, -12325, -12349, -12297, -12209, -12165, -12215, -12332, -12451, -12507, -12474, -12384, -12338, -12391, -12469, -12462, -12354, -12197, -12014, -11804, -11613, -11473, -11320, -11082, -10795, -10583, -10486, -10426, -10320, -10196, -10108, -10043, -9968, -9882, -9791, -9679, -9540, -9407, -9286, -9145, -8968, -8791, -8663, -8592, -8535, -8443, -8313, -8189, -8113, -8054, -7943, -7750, -7506, -7268, -7080, -6927, -6750, -6509, -6239, -5979, -5714, -5427, -5164, -4976, -4839, -4703, -4568, -4442, -4287, -4079, -3887, -3805, -3807, -3774, -3655, -3503, -3348, -3154, -2970, -2902, -2933, -2915, -2788, -2625, -2465, -2263, -2034, -1866, -1762, -1598, -1313, -1004, -794, -652, -479, -260, -55, 110, 222, 253, 243, 309, 478, 633, 684, 668, 644, 610, 564, 555, 624, 771, 918, 965, 862, 694, 597, 619, 701, 773, 807, 799, 746, 661, 573, 520, 522, 568, 617, 641, 658, 693, 740, 774, 789, 811, 873, 995, 1169, 1354, 1490, 1529, 1500, 1491, 1588, 1798, 2042, 2219, 2263, 2182, 2071, 2048, 2170, 2375, 2547, 2614, 2606, 2607, 2668, 2774, 2879, 2951, 3003, 3063, 3148, 3247, 3325, 3357, 3335, 3290, 3274, 3313, 3378, 3417, 3403, 3330, 3194, 3027, 2898, 2848, 2851, 2851, 2804, 2685, 2509, 2342, 2253, 2254, 2303, 2347, 2357, 2325, 2274, 2242, 2258, 2314, 2373, 2386, 2324, 2203, 2087, 2038, 2047, 2039, 1951, 1801, 1679, 1658, 1732, 1811, 1793, 1653, 1484, 1403, 1442, 1514, 1519, 1434, 1301, 1169, 1069, 1008, 981, 979, 1003, 1044, 1083, 1097, 1095, 1128, 1227, 1362, 1453, 1458, 1402, 1348, 1326, 1316, 1282, 1210, 1120, 1025, 920, 815, 735, 684, 625, 537, 436, 345, 273, 238, 252, 268, 226, 126, 39, 44, 154, 299, 376, 374, 408, 575, 809, 950, 966, 975, 1074, 1214, 1281, 1251, 1210, 1251, 1368, 1473, 1486, 1406, 1310, 1292, 1369, 1472, 1505, 1439, 1332, 1273, 1288, 1316, 1268, 1138, 1011, 959, 964, 972, 961, 938, 906, 876, 862, 882, 912, 916, 878, 798, 667, 481, 279, 124, 39, -10, -70, -158, -260, -346, -393, -411, -420, -419, -427, -498, -637, -744, -735, -692, -756, -929, -1061, -1034, -897, -783, -750, -747, -700, -615, -562, -568, -591, -585, -559, -573, -670, -856, -1068, -1214, -1256, -1259, -1315, -1426, -1495, -1449, -1322, -1201, -1127, -1055, -908, -663, -360, -72, 152, 313, 467, 682, 967, 1246, 1420, 1474, 1459, 1426, 1403, 1441, 1603, 1898, 2224, 2435, 2476, 2456, 2563, 2877, 3258, 3483, 3463, 3315, 3202, 3163, 3131, 3067, 2984, 2890, 2779, 2684, 2655, 2697, 2774, 2849, 2884, 2840, 2726, 2616, 2559, 2505, 2318, 1905, 1309, 719, 346, 248, 303, 351, 371, 487, 794, 1260, 1801, 2356, 2871, 3280, 3564, 3766, 3901, 3945, 3905, 3849, 3804, 3745, 3707, 3821, 4171, 4654, 5069, 5339, 5590, 5992, 6580, 7247, 7853, 8286, 8501, 8554, 8612, 8839, 9217, 9588, 9839, 10014, 10232, 10568, 11029, 11587, 12181, 12744, 13234, 13629, 13927, 14146, 14309, 14427, 14486, 14482, 14425, 14357, 14339, 14419, 14559, 14668, 14739, 14843, 15035, 15266, 15458, 15549, 15529, 15408, 15207, 14968, 14751, 14615, 14540, 14428, 14203, 13927, 13745, 13706, 13734, 13721, 13627, 13466, 13256, 12986, 12632, 12186, 11665, 11097, 10530, 10015, 9566, 9138, 8670, 8175, 7735, 7411, 7195, 7058, 6966, 6850, 6615, 6204, 5665, 5107, 4612, 4182, 3749, 3243, 2662, 2043, 1452, 964, 624, 396, 165, -137, -506, -908, -1341, -1794, -2253, -2738, -3311, -4000, -4761, -5512, -6182, -6741, -7192, -7568, -7915, -8261, -8586, -8839, -8982, -9049, -9139, -9345, -9664, -10009, -10277, -10435, -10530, -10655, -10894, -11263, -11656, -11911, -11931, -11802, -11702, -11727, -11839, -11947, -12008, -12015, -11981, -11956, -12023, -12207, -12440, -12634, -12755, -12802, -12824, -12892, -13021, -13137, -13137, -13037, -12926, -12879, -12917, -13012, -13089, -13086, -13023, -12982, -12992, -13033, -13077, -13125, -13163, -13166, -13142, -13109, -13083, -13070, -13072, -13115, -13215, -13330, -13387, -13360, -13310, -13313, -13376, -13406, -13320, -13127, -12915, -12735, -12563, -12343, -12074, -11796, -11556, -11385, -11297, -11285, -11290, -11252, -11141, -10993, -10870, -10801, -10774, -10739, -10640, -10440, -10154, -9845, -9601, -9472, -9429, -9384, -9266, -9110, -9012, -9023, -9078, -9076, -8977, -8813, -8620, -8402, -8142, -7839, -7523, -7226, -6957, -6701, -6446, -6192, -5951, -5742, -5574, -5430, -5285, -5144, -5045, -4979, -4899, -4773, -4626, -4490, -4359, -4226, -4105, -4027, -3996, -3976, -3916, -3810, -3712, -3701, -3784, -3871, -3851, -3689, -3462, -3265, -3125, -2987, -2788, -2519, -2253, -2068, -1976, -1905, -1789, -1640, -1515, -1448, -1437, -1452, -1454, -1422, -1377, -1350, -1327, -1269, -1182, -1132, -1142, -1145, -1082, -998, -991, -1072, -1151, -1161, -1109, -1033, -982, -976, -957, -845, -645, -447, -292, -158, -60, -38, -40, 32, 183, 315, 352, 319, 294, 334, 441, 589, 724, 810, 871, 973, 1152, 1374, 1583, 1743, 1848, 1928, 2042, 2188, 2307, 2387, 2509, 2715, 2912, 3009, 3039, 3116, 3280, 3481, 3658, 3773, 3815, 3822, 3871, 4008, 4179, 4281, 4276, 4220, 4186, 4196, 4236, 4269, 4253, 4170, 4048, 3949, 3929, 4015, 4172, 4317, 4379, 4379, 4397, 4470, 4571, 4658, 4713, 4734, 4726, 4702, 4685, 4689, 4701, 4693, 4643, 4579, 4541, 4527, 4479, 4384, 4297, 4268, 4246, 4130, 3910, 3696, 3590, 3555, 3464, 3258, 2998, 2790, 2666, 2591, 2547, 2551, 2608, 2669, 2678, 2645, 2627, 2651, 2686, 2679, 2611, 2496, 2374, 2280, 2219, 2147, 2017, 1844, 1700, 1638, 1616, 1557, 1445, 1325, 1230, 1159, 1095, 1021, 901, 724, 526, 356, 220, 89, -54, -184, -258, -260, -226, -197, -166, -101, 5, 102, 141, 146, 183, 259, 303, 274, 220, 205, 224, 243, 257, 264, 242, 181, 138, 182, 293, 374, 364, 307, 282, 325, 409, 464, 430, 342, 336, 474, 651, 723, 691, 674, 746, 868, 968, 1021, 1030, 1012, 1000, 1003, 971, 877, 791, 801, 848, 812, 706, 646, 646, 631, 589, 570, 585, 601, 617, 634, 641, 664, 744, 859, 922, 906, 876, 895, 942, 958, 927, 861, 758, 683, 745, 921, 1006, 895, 724, 645, 622, 594, 595, 630, 627, 573, 539, 557, 596, 667, 789, 911, 968, 1001, 1117, 1351, 1621, 1827, 1950, 2021, 2081, 2172, 2299, 2381, 2351, 2286, 2324, 2470, 2624, 2749, 2865, 2950, 2970, 2961, 2967, 2950, 2849, 2663, 2414, 2117, 1800, 1491, 1211, 987, 844, 760, 699, 688, 791, 992, 1185, 1320, 1459, 1647, 1783, 1727, 1478, 1137, 765, 389, 95, -56, -143, -231, -216, 21, 429, 892, 1426, 2093, 2817, 3444, 3889, 4169, 4340, 4466, 4594, 4712, 4759, 4743, 4788, 5020, 5408, 5827, 6219, 6645, 7162, 7750, 8374, 8993, 9547, 9977, 10292, 10555, 10794, 10986, 11140, 11325, 11580, 11821, 11954, 12024, 12167, 12467, 12888, 13344, 13776, 14132, 14377, 14512, 14595, 14699, 14831, 14925, 14915, 14827, 14733, 14675, 14627, 14576, 14567, 14642, 14753, 14819, 14836, 14858, 14882, 14814, 14615, 14351, 14131, 13970, 13819, 13601, 13280, 12906, 12567, 12331, 12201, 12141, 12088, 11972, 11755, 11453, 11110, 10728, 10296, 9836, 9394, 8964, 8488, 7912, 7274, 6662, 6168, 5827, 5621, 5489, 5341, 5110, 4774, 4359, 3915, 3475, 3043, 2583, 2054, 1452, 818, 211, -317, -761, -1145, -1507, -1846, -2149, -2420, -2716, -3089, -3523, -3959, -4358, -4767, -5271, -5895, -6563, -7187, -7738, -8246, -8721, -9155, -9526, -9830, -10078, -10301, -10533, -10767, -10971, -11139, -11287, -11418, -11528, -11639, -11785, -11977, -12194, -12381, -12479, -12470, -12411, -12376, -12404, -12456, -12478, -12411, -12262, -12108, -12042, -12082, -12133, -12110, -12047, -12060, -12187, -12343, -12414, -12380, -12287, -12194, -12135, -12136, -12179, -12198, -12147, -12028, -11911, -11854, -11861, -11894, -11914, -11916, -11920, -11934, -11953, -11962, -11954, -11914, -11849, -11787, -11761, -11785, -11831, -11833, -11748, -11596, -11472, -11428, -11413, -11349, -11222, -11060, -10872, -10662, -10476, -10362, -10262, -10084, -9848, -9696, -9686, -9689, -9552, -9313, -9136, -9071, -9028, -8937, -8830, -8706, -8506, -8255, -8083, -8031, -7982, -7879, -7827, -7892, -7950, -7882, -7779, -7791, -7867, -7818, -7629, -7474, -7428, -7371, -7224, -7048, -6894, -6734, -6569, -6448, -6349, -6202, -6017, -5904, -5891, -5884, -5804, -5708, -5690, -5730, -5744, -5713, -5683, -5678, -5681, -5701, -5740, -5763, -5730, -5668, -5650, -5692, -5742, -5752, -5729, -5683, -5600, -5491, -5390, -5289, -5156, -4996, -4858, -4756, -4639, -4475, -4292, -4144, -4048, -3976, -3893, -3786, -3668, -3553, -3441, -3308, -3137, -2956, -2788, -2606, -2376, -2131, -1940, -1834, -1784, -1745, -1683, -1567, -1419, -1335, -1380, -1473, -1438, -1208, -900, -675, -562, -474, -361, -247, -123, 61, 287, 426, 424, 384, 393, 396, 371, 436, 636, 823, 888, 933, 1091, 1332, 1589, 1877, 2214, 2519, 2715, 2837, 2975, 3126, 3238, 3323, 3433, 3546, 3608, 3661, 3777, 3934, 4049, 4129, 4258, 4475, 4732, 4958, 5102, 5133, 5074, 5025, 5078, 5187, 5219, 5142, 5044, 4973, 4933, 4977, 5132, 5291, 5359, 5422, 5566, 5727, 5837, 5945, 6063, 6088, 6002, 5914, 5872, 5812, 5700, 5566, 5406, 5202, 4998, 4871, 4832, 4823, 4784, 4684, 4544, 4423, 4372, 4385, 4408, 4387, 4321, 4237, 4153, 4074, 4014, 3978, 3933, 3833, 3697, 3611, 3617, 3638, 3606, 3557, 3534, 3484, 3380, 3324, 3364, 3373, 3238, 3056, 2971, 2949, 2878, 2767, 2694, 2644, 2553, 2472, 2497, 2572, 2527, 2363, 2258, 2275, 2309, 2296, 2263, 2185, 2009, 1810, 1719, 1730, 1732, 1673, 1573, 1432, 1254, 1122, 1104, 1119, 1031, 867, 782, 790, 756, 651, 592, 592, 537, 424, 386, 457, 522, 524, 528, 574, 640, 741, 947, 1216, 1401, 1445, 1480, 1602, 1685, 1592, 1429, 1418, 1585, 1726, 1678, 1501, 1391, 1478, 1735, 2032, 2251, 2347, 2360, 2389, 2514, 2729, 2928, 3019, 3014, 2997, 3004, 2987, 2904, 2778, 2651, 2528, 2414, 2357, 2378, 2400, 2320, 2158, 2033, 2017, 2061, 2082, 2060, 1981, 1811, 1588, 1448, 1459, 1512, 1486, 1403, 1318, 1243, 1225, 1293, 1353, 1318, 1298, 1413, 1553, 1558, 1463, 1356, 1197, 979, 838, 843, 860, 767, 624, 569, 634, 758, 892, 1037, 1215, 1402, 1524, 1557, 1551, 1542, 1509, 1459, 1463, 1537, 1595, 1566, 1498, 1473, 1512, 1592, 1683, 1733, 1707, 1640, 1599, 1594, 1550, 1414, 1225, 1036, 844, 629, 413, 210, 4, -183, -309, -400, -491, -480, -281, -55, -18, -110, -116, -32, -22, -154, -392, -711, -1054, -1339, -1575, -1810, -1983, -2010, -1907, -1698, -1304, -716, -84, 462, 984, 1559, 2135, 2630, 3058, 3433, 3689, 3782, 3817, 3993, 4373, 4789, 5039, 5170, 5418, 5875, 6380, 6829, 7308, 7816, 8198, 8431, 8693, 9052, 9379, 9617, 9827, 10004, 10143, 10341, 10649, 10954, 11191, 11477, 11882, 12317, 12721, 13153, 13606, 13926, 14035, 14081, 14195, 14245, 14059, 13770, 13617, 13570, 13423, 13184, 12992, 12839, 12673, 12611, 12751, 12926, 12916, 12739, 12563, 12439, 12333, 12243, 12203, 12136, 11920, 11571, 11251, 11081, 11010, 10930, 10810, 10663, 10447, 10149, 9886, 9704, 9403, 8767, 7961, 7314, 6814, 6177, 5359, 4610, 4055, 3578, 3119, 2771, 2558, 2370, 2122, 1829, 1503, 1100, 607, 93, -375, -817, -1275, -1746, -2197, -2624, -3020, -3329, -3512, -3640, -3828, -4114, -4435, -4741, -5053, -5396, -5791, -6263, -6821, -7396, -7898, -8320, -8736, -9177, -9588, -9929, -10238, -10486, -10534, -10402, -10356, -10512, -10620, -10495, -10299, -10169, -9948, -9623, -9497, -9657, -9772, -9645, -9498, -9525, -9622, -9655, -9635, -9602, -9537, -9440, -9320, -9209, -9164, -9149, -9044, -8881, -8887, -9099, -9292, -9370, -9503, -9691, -9701, -9514, -9431, -9558, -9619, -9425, -9132, -8950, -8835, -8673, -8531, -8545, -8672, -8745, -8749, -8843, -9099, -9390, -9572, -9680, -9807, -9944, -10017, -10026, -10041, -10104, -10183, -10253, -10321, -10362, -10316, -10222, -10210, -10310, -10352, -10192, -9954, -9850, -9866, -9827, -9684, -9534, -9436, -9364, -9303, -9265, -9237, -9207, -9161, -9100, -9026, -8970, -8944, -8905, -8846, -8846, -8972, -9153, -9248, -9265, -9356, -9546, -9644, -9525, -9321, -9202, -9122, -8948, -8700, -8498, -8379, -8280, -8165, -8053, -7960, -7868, -7750, -7607, -7486, -7385, -7261, -7153, -7155, -7215, -7136, -6935, -6878, -7049, -7231, -7290, -7318, -7298, -7112, -6909, -6994, -7316, -7474, -7270, -6915, -6672, -6580, -6518, -6374, -6137, -5868, -5605, -5314, -5010, -4791, -4701, -4637, -4496, -4298, -4119, -3952, -3755, -3553, -3421, -3325, -3136, -2824, -2501, -2252, -2029, -1773, -1484, -1158, -792, -460, -236, -81, 103, 301, 417, 483, 666, 1012, 1351, 1580, 1832, 2204, 2579, 2867, 3172, 3520, 3702, 3624, 3503, 3513, 3525, 3398, 3276, 3345, 3469, 3380, 3125, 3055, 3324, 3667, 3778, 3667, 3535, 3474, 3440, 3409, 3384, 3307, 3108, 2818, 2541, 2345, 2280, 2418, 2705, 2931, 2995, 3075, 3368, 3831, 4309, 4755, 5136, 5290, 5125, 4845, 4781, 4980, 5152, 5037, 4699, 4374, 4214, 4226, 4352, 4513, 4628, 4691, 4757, 4818, 4770, 4630, 4632, 4859, 4997, 4761, 4385, 4248, 4312, 4353, 4448, 4699, 4853, 4701, 4520, 4646, 4926, 4971, 4710, 4361, 4055, 3751, 3414, 3085, 2791, 2519, 2276, 2081, 1879, 1621, 1396, 1346, 1442, 1518, 1479, 1390, 1356, 1430, 1583, 1704, 1706, 1634, 1572, 1524, 1451, 1369, 1305, 1268, 1296, 1441, 1627, 1710, 1691, 1699, 1785, 1883, 1901, 1771, 1487, 1186, 1028, 965, 822, 607, 518, 649, 898, 1133, 1313, 1486, 1787, 2275, 2778, 3048, 3087, 3093, 3136, 3116, 2983, 2782, 2570, 2417, 2403, 2489, 2492, 2349, 2244, 2370, 2635, 2761, 2641, 2475, 2474, 2578, 2561, 2389, 2266, 2332, 2502, 2686, 2944, 3287, 3558, 3671, 3795, 4078, 4346, 4336, 4155, 4191, 4522, 4767, 4635, 4339, 4253, 4404, 4530, 4491, 4354, 4212, 4119, 4136, 4304, 4569, 4833, 5072, 5337, 5618, 5790, 5743, 5536, 5353, 5281, 5221, 5056, 4816, 4619, 4524, 4486, 4418, 4295, 4218, 4323, 4531, 4550, 4229, 3809, 3616, 3651, 3668, 3497, 3169, 2805, 2527, 2356, 2154, 1756, 1215, 816, 728, 796, 779, 707, 782, 998, 1137, 1136, 1191, 1402, 1563, 1461, 1177, 942, 777, 467, -89, -642, -878, -864, -924, -1094, -1126, -1011, -993, -1046, -929, -752, -893, -1271, -1418, -1286, -1370, -1814, -2057, -1656, -972, -598, -486, -186, 334, 704, 787, 729, 548, 216, -49, -72, -127, -591, -1296, -1683, -1612, -1526, -1763, -2075, -2088, -1841, -1589, -1398, -1221, -1149, -1270, -1485, -1705, -2095, -2839, -3752, -4507, -5122, -5780, -6264, -6143, -5418, -4375, -2970, -1004, 1263, 3313, 5058, 6753, 8419, 9812, 10839, 11545, 11811, 11519, 11037, 10970, 11329, 11536, 11373, 11252, 11357, 11353, 11181, 11279, 11795, 12297, 12453, 12446, 12587, 13022, 13748, 14552, 15057, 15103, 15051, 15396, 16121, 16748, 17036, 17262, 17726, 18360, 18973, 19473, 19698, 19445, 18824, 18113, 17316, 16226, 14843, 13335, 11822, 10406, 9166, 7993, 6760, 5683, 5038, 4702, 4390, 4161, 4175, 4290, 4329, 4380, 4544, 4698, 4739, 4699, 4514, 4059, 3433, 2915, 2616, 2389, 2037, 1496, 866, 313, -193, -900, -1908, -3017, -4114, -5311, -6594, -7755, -8827, -9987, -11039, -11590, -11701, -11726, -11622, -11105, -10324, -9729, -9406, -8984, -8257, -7425, -6775, -6365, -6094, -5878, -5679, -5475, -5311, -5302, -5491, -5800, -6134, -6463, -6775, -7089, -7460, -7863, -8152, -8257, -8332, -8523, -8730, -8736, -8515, -8232, -7983, -7690, -7231, -6602, -5868, -5065, -4216, -3327, -2366, -1319, -267, 679, 1507, 2226, 2744, 2956, 2907, 2717, 2387, 1823, 1038, 205, -536, -1214, -1878, -2459, -2846, -3065, -3232, -3402, -3517, -3536, -3499, -3459, -3445, -3515, -3700, -3880, -3915, -3895, -4054, -4388, -4663, -4791, -4884, -4976, -5062, -5285, -5740, -6282, -6834, -7611, -8767, -10169, -11624, -13039, -14288, -15313, -16328, -17518, -18681, -19496, -19930, -20104, -20081, -19958, -19828, -19599, -19120, -18444, -17676, -16787, -15868, -15216, -14865, -14455, -13794, -13122, -12706, -12538, -12541, -12601, -12528, -12242, -11949, -11855, -11867, -11806, -11651, -11472, -11296, -11153, -11060, -10976, -10895, -10860, -10828, -10662, -10364, -10052, -9716, -9216, -8537, -7790, -7017, -6177, -5314, -4539, -3894, -3376, -3021, -2865, -2862, -2908, -2933, -2948, -3039, -3250, -3510, -3733, -3939, -4187, -4394, -4460, -4464, -4573, -4778, -4907, -4873, -4746, -4611, -4495, -4421, -4401, -4388, -4308, -4134, -3900, -3614, -3275, -2926, -2613, -2269, -1778, -1205, -803, -714, -807, -869, -844, -864, -1073, -1424, -1696, -1786, -1886, -2172, -2473, -2512, -2349, -2256, -2276, -2208, -1956, -1609, -1269, -978, -722, -436, -120, 93, 132, 144, 288, 515, 712, 878, 1053, 1257, 1564, 2034, 2535, 2867, 3044, 3232, 3485, 3679, 3674, 3435, 3096, 2888, 2884, 2854, 2557, 2127, 1942, 2142, 2484, 2699, 2794, 2942, 3216, 3571, 3942, 4235, 4337, 4298, 4320, 4485, 4727, 5116, 5857, 6862, 7691, 8107, 8385, 8923, 9761, 10566, 10959, 10803, 10286, 9815, 9693, 9836, 9873, 9563, 9091, 8817, 8821, 8793, 8462, 7959, 7595, 7423, 7259, 7049, 6921, 6938, 7044, 7158, 7188, 7121, 7182, 7561, 7991, 8016, 7674, 7411, 7363, 7273, 6992, 6582, 6015, 5248, 4501, 4032, 3687, 3037, 2014, 1070, 589, 414, 155, -317, -885, -1433, -1866, -2039, -1960, -1846, -1865, -1906, -1790, -1552, -1328, -1083, -658, -90, 371, 617, 816, 1165, 1655, 2116, 2392, 2437, 2367, 2387, 2570, 2722, 2597, 2212, 1820, 1577, 1389, 1150, 918, 761, 588, 330, 139, 227, 592, 1011, 1266, 1349, 1461, 1784, 2221, 2503, 2569, 2636, 2849, 3108, 3292, 3395, 3435, 3422, 3419, 3450, 3431, 3302, 3111, 2896, 2627, 2338, 2131, 1969, 1678, 1248, 932, 948, 1171, 1281, 1180, 1103, 1313, 1787, 2302, 2746, 3146, 3472, 3649, 3792, 4077, 4412, 4527, 4406, 4263, 4166, 4049, 3982, 4036, 4000, 3663, 3203, 2947, 2864, 2644, 2194, 1759, 1520, 1365, 1105, 747, 401, 66, -293, -549, -518, -339, -398, -714, -779, -255, 509, 989, 1076, 958, 851, 989, 1326, 1307, 535, -521, -1200, -1637, -2339, -3191, -3657, -3598, -3341, -3275, -3613, -4123, -4137, -3364, -2492, -2403, -3001, -3387, -2961, -1971, -1147, -972, -1171, -955, -31, 950, 1276, 1148, 1303, 1956, 2614, 2815, 2630, 2436, 2465, 2673, 2784, 2453, 1647, 898, 782, 1163, 1391, 1264, 1193, 1441, 1778, 1966, 2026, 1971, 1748, 1511, 1453, 1336, 663, -449, -1099, -713, 26, -44, -1023, -1829, -1679, -1010, -629, -580, -459, -316, -493, -900, -1238, -1625, -2292, -2979, -3302, -3326, -3307, -3138, -2403, -719, 1953, 5064, 7798, 9992, 12362, 15353, 18316, 20246, 20979, 21131, 21223, 21225, 20935, 20408, 19942, 19734, 19675, 19510, 19164, 18870, 18960, 19423, 19853, 19886, 19517, 18926, 18307, 17993, 18147, 18318, 17882, 17012, 16412, 16239, 16074, 15787, 15561, 15366, 15169, 15119, 15110, 14817, 14355, 14012, 13466, 12229, 10604, 9158, 7743, 5983, 4193, 2798, 1454, -330, -2198, -3351, -3716, -3976, -4510, -4993, -5122, -5094, -5100, -4988, -4708, -4543, -4661, -4952, -5366, -5888, -6290, -6380, -6305, -6213, -6023, -5753, -5618, -5625, -5572, -5512, -5766, -6453, -7419, -8533, -9688, -10678, -11348, -11776, -12075, -12180, -11945, -11358, -10512, -9502, -8430, -7471, -6791, -6311, -5745, -4926, -4092, -3623, -3520, -3390, -2985, -2518, -2249, -2137, -2037, -2009, -2182, -2557, -3048, -3581, -4066, -4436, -4740, -5048, -5360, -5650, -5850, -5811, -5506, -5176, -5028, -4920, -4669, -4369, -4114, -3775, -3297, -2773, -2137, -1276, -425, 170, 724, 1415, 1827, 1579, 945, 264, -657, -2006, -3468, -4736, -5911, -7078, -8009, -8539, -8865, -9233, -9611, -9861, -10038, -10324, -10773, -11324, -11949, -12613, -13141, -13357, -13337, -13260, -13130, -12801, -12263, -11694, -11247, -10934, -10740, -10733, -11030, -11674, -12638, -13817, -15036, -16185, -17337, -18569, -19713, -20489, -20889, -21167, -21445, -21593, -21456, -21071, -20588, -20086, -19461, -18585, -17546, -16586, -15751, -14822, -13658, -12440, -11363, -10371, -9347, -8426, -7846, -7503, -7038, -6344, -5707, -5298, -4989, -4736, -4661, -4670, -4523, -4307, -4364, -4725, -5144, -5563, -6053, -6410, -6358, -5998, -5664, -5396, -4912, -4086, -3148, -2369, -1763, -1221, -774, -551, -531, -567, -620, -783, -1016, -1144, -1186, -1393, -1833, -2194, -2285, -2431, -3078, -4162, -5169, -5740, -6017, -6374, -6988, -7695, -8196, -8330, -8159, -7837, -7458, -7034, -6563, -6067, -5548, -4961, -4275, -3539, -2855, -2311, -1937, -1648, -1293, -843, -480, -348, -325, -245, -172, -231, -347, -372, -321, -304, -390, -559, -663, -495, -95, 198, 218, 175, 270, 502, 914, 1559, 2210, 2589, 2866, 3387, 4126, 4856, 5580, 6321, 6849, 7016, 7071, 7270, 7508, 7579, 7534, 7495, 7361, 6969, 6456, 6179, 6224, 6221, 5790, 5035, 4418, 4208, 4234, 4187, 3910, 3415, 2905, 2746, 3091, 3608, 3956, 4236, 4584, 4745, 4636, 4843, 5814, 7002, 7508, 7322, 7207, 7557, 8005, 8152, 8137, 8275, 8507, 8547, 8406, 8350, 8390, 8247, 7944, 7922, 8248, 8274, 7503, 6406, 5785, 5724, 5671, 5256, 4630, 4188, 4235, 4746, 5302, 5484, 5381, 5467, 5937, 6446, 6562, 6297, 5959, 5667, 5278, 4757, 4332, 4191, 4188, 3969, 3353, 2613, 2243, 2320, 2276, 1578, 479, -286, -480, -586, -1065, -1768, -2226, -2243, -1976, -1628, -1300, -1029, -719, -194, 520, 1159, 1617, 2135, 2876, 3645, 4219, 4625, 4965, 5251, 5518, 5838, 6177, 6422, 6472, 6269, 5865, 5479, 5306, 5231, 4971, 4468, 3927, 3501, 3199, 3033, 3031, 3060, 2883, 2491, 2229, 2425, 2966, 3422, 3560, 3589, 3867, 4503, 5323, 6068, 6575, 6807, 6800, 6640, 6431, 6225, 5986, 5690, 5392, 5065, 4545, 3851, 3385, 3448, 3706, 3546, 2879, 2174, 1798, 1688, 1623, 1494, 1292, 1043, 818, 780, 1148, 1932, 2735, 3063, 2972, 3039, 3596, 4318, 4718, 4694, 4469, 4296, 4290, 4345, 4226, 3887, 3546, 3358, 3238, 3054, 2727, 2187, 1548, 1154, 1086, 873, 114, -882, -1429, -1209, -497, 78, 78, -140, 309, 1569, 2656, 2833, 2578, 2644, 2987, 3210, 3296, 3391, 3485, 3621, 3909, 4203, 4216, 4048, 4098, 4325, 4131, 3299, 2462, 2135, 1920, 1343, 705, 335, -96, -756, -1126, -1010, -961, -1226, -1353, -1197, -1143, -1183, -799, 70, 788, 805, 210, -410, -498, -155, -160, -995, -2278, -3418, -4077, -3876, -2887, -2410, -3493, -4896, -4594, -2918, -1901, -2115, -2570, -2928, -3573, -4358, -4945, -5456, -5723, -5219, -4213, -3495, -2780, -794, 3014, 7985, 13047, 17207, 19999, 22024, 24332, 27017, 29146, 29961, 29410, 27863, 26097, 25161, 25376, 25915, 25816, 25046, 24200, 23619, 23315, 23300, 23396, 22897, 21206, 18803, 16848, 15760, 14980, 14085, 13256, 12568, 11773, 10944, 10508, 10684, 11281, 11992, 12451, 12259, 11380, 10301, 9566, 9231, 8767, 7451, 5109, 2439, 263, -1412, -3177, -5167, -6998, -8563, -10088, -11443, -12190, -12325, -12331, -12530, -12778, -12791, -12474, -11976, -11557, -11334, -11164, -10890, -10506, -9984, -9188, -8098, -6940, -5921, -5032, -4161, -3236, -2318, -1676, -1676, -2376, -3420, -4482, -5587, -6877, -8246, -9423, -10244, -10700, -10812, -10631, -10301, -9960, -9598, -9149, -8697, -8429, -8363, -8310, -8121, -7797, -7376, -6846, -6175, -5326, -4293, -3192, -2242, -1586, -1199, -1011, -1033, -1359, -2078, -3143, -4327, -5442, -6524, -7673, -8750, -9509, -9981, -10429, -10972, -11473, -11811, -12017, -12127, -12086, -11857, -11457, -10857, -9949, -8729, -7386, -6112, -4929, -3799, -2835, -2265, -2175, -2430, -2877, -3474, -4210, -5026, -5898, -6833, -7777, -8657, -9558, -10567, -11542, -12365, -13308, -14706, -16369, -17766, -18702, -19362, -19884, -20218, -20339, -20214, -19660, -18541, -17092, -15774, -14788, -13958, -13126, -12396, -11876, -11561, -11502, -11754, -12087, -12202, -12153, -12196, -12375, -12603, -12988, -13588, -14174, -14555, -14861, -15271, -15690, -15949, -16037, -15969, -15645, -15015, -14230, -13462, -12677, -11680, -10450, -9247, -8277, -7315, -6009, -4473, -3142, -2078, -939, 298, 1238, 1780, 2281, 2838, 3071, 2726, 1983, 1045, -83, -1313, -2392, -3281, -4264, -5436, -6414, -6789, -6734, -6784, -7104, -7333, -7211, -6965, -6838, -6689, -6370, -6112, -6061, -5837, -5078, -4161, -3738, -3736, -3503, -2882, -2492, -2749, -3253, -3507, -3684, -4199, -4992, -5757, -6480, -7230, -7822, -8128, -8385, -8763, -9015, -8889, -8608, -8414, -7973, -6906, -5670, -4983, -4547, -3473, -1806, -424, 491, 1556, 2835, 3733, 4241, 5043, 6223, 6899, 6612, 6162, 6499, 7379, 7815, 7427, 6678, 6108, 5937, 6037, 5872, 4864, 3307, 2359, 2574, 2981, 2424, 1373, 1299, 2433, 3478, 3741, 4034, 5081, 6425, 7418, 8059, 8458, 8569, 8728, 9436, 10368, 10505, 9615, 8825, 9226, 10395, 10893, 10145, 9071, 8716, 8884, 8720, 8014, 7220, 6517, 5749, 5109, 4966, 5052, 4728, 4121, 4098, 4915, 5700, 5754, 5645, 6328, 7680, 8750, 9179, 9525, 10223, 10996, 11402, 11368, 11038, 10584, 10241, 10130, 9899, 9022, 7638, 6578, 6253, 6071, 5379, 4319, 3354, 2611, 2131, 2082, 2310, 2241, 1666, 1157, 1338, 2086, 2796, 3237, 3741, 4599, 5617, 6446, 7038, 7634, 8354, 9008, 9240, 8876, 8166, 7662, 7688, 7873, 7499, 6459, 5480, 5103, 5020, 4768, 4418, 4137, 3779, 3317, 3023, 2943, 2811, 2640, 2707, 2962, 3096, 3100, 3274, 3745, 4418, 5165, 5820, 6198, 6321, 6446, 6739, 7071, 7135, 6742, 6100, 5691, 5684, 5673, 5323, 4851, 4467, 3950, 3303, 2998, 3028, 2701, 1862, 1241, 1119, 895, 354, 149, 590, 1028, 885, 520, 674, 1491, 2385, 2755, 2655, 2634, 2983, 3469, 3854, 4210, 4558, 4717, 4739, 4959, 5456, 5945, 6219, 6214, 5817, 5159, 4774, 4870, 4854, 4187, 3234, 2688, 2630, 2646, 2529, 2463, 2650, 2983, 3130, 3054, 3213, 3817, 4207, 3705, 2817, 2639, 3246, 3644, 3280, 2685, 2574, 3008, 3623, 4113, 4276, 4082, 3866, 4004, 4199, 3730, 2690, 2125, 2439, 2585, 1612, 188, -343, 58, 172, -659, -1767, -2342, -2495, -2718, -3111, -3563, -4064, -4484, -4622, -4670, -5023, -5567, -5826, -5769, -5868, -6348, -6922, -7293, -7453, -7384, -6931, -6191, -5601, -5320, -4922, -4001, -2696, -1374, -341, 19, -460, -1171, -1238, -663, -245, -352, -435, 187, 1647, 3756, 6348, 9301, 12375, 15284, 17854, 20087, 22057, 23832, 25307, 26144, 26065, 25354, 24743, 24691, 24974, 25090, 24873, 24569, 24487, 24675, 24897, 24890, 24488, 23644, 22338, 20680, 18962, 17467, 16172, 14775, 13132, 11505, 10174, 9059, 7967, 7033, 6418, 5849, 5011, 4120, 3523, 3070, 2369, 1473, 658, -143, -1191, -2335, -3184, -3829, -4794, -6193, -7487, -8337, -9039, -9820, -10341, -10357, -10287, -10627, -11203, -11442, -11148, -10644, -10329, -10346, -10594, -10861, -10887, -10497, -9796, -9103, -8590, -8051, -7208, -6110, -5062, -4202, -3479, -2977, -2926, -3288, -3695, -3929, -4259, -5006, -5979, -6700, -7012, -7131, -7153, -7006, -6863, -7049, -7498, -7773, -7690, -7561, -7736, -8224, -8736, -8939, -8694, -8174, -7679, -7315, -6967, -6540, -6078, -5667, -5390, -5329, -5509, -5868, -6291, -6648, -6850, -6956, -7164, -7541, -7905, -8073, -8115, -8192, -8377, -8678, -9056, -9401, -9629, -9763, -9714, -9337, -8780, -8366, -7984, -7231, -6232, -5591, -5441, -5338, -5133, -5161, -5514, -5872, -6103, -6452, -7020, -7520, -7725, -7829, -8193, -8856, -9529, -10080, -10787, -11884, -13125, -14143, -15030, -16063, -17048, -17545, -17584, -17616, -17734, -17575, -16977, -16241, -15643, -15061, -14378, -13811, -13647, -13744, -13673, -13307, -12977, -12987, -13180, -13170, -12828, -12412, -12216, -12247, -12310, -12371, -12567, -12867, -13012, -12898, -12748, -12757, -12809, -12669, -12275, -11664, -10866, -9997, -9251, -8694, -8149, -7414, -6522, -5652, -4893, -4194, -3508, -2783, -1933, -962, -73, 525, 840, 1016, 1117, 1103, 895, 398, -404, -1305, -1972, -2316, -2612, -3117, -3695, -4029, -4110, -4220, -4490, -4755, -4918, -5163, -5600, -5977, -6032, -5898, -5835, -5755, -5446, -5077, -4905, -4711, -4176, -3614, -3640, -4153, -4407, -4127, -3905, -4267, -4929, -5316, -5412, -5594, -5865, -5826, -5399, -5077, -5175, -5315, -4951, -4126, -3311, -2764, -2399, -2037, -1386, -248, 1015, 1745, 2021, 2680, 4020, 5297, 5915, 6257, 6911, 7722, 8152, 8153, 8198, 8560, 8921, 8849, 8397, 8032, 8003, 8066, 7891, 7497, 7191, 7179, 7378, 7530, 7452, 7238, 7221, 7611, 8207, 8621, 8734, 8810, 9083, 9495, 9899, 10326, 10836, 11243, 11323, 11163, 11083, 11192, 11279, 11153, 10847, 10407, 9753, 8975, 8424, 8254, 8114, 7659, 7038, 6534, 6143, 5829, 5727, 5737, 5435, 4762, 4334, 4646, 5394, 5917, 6070, 6203, 6528, 6981, 7582, 8337, 8881, 8838, 8447, 8245, 8268, 8187, 7987, 7859, 7673, 7201, 6644, 6418, 6477, 6398, 6061, 5729, 5455, 5006, 4501, 4434, 4815, 5006, 4743, 4644, 5263, 6213, 6770, 6854, 6922, 7149, 7341, 7472, 7742, 8044, 7991, 7558, 7218, 7279, 7550, 7693, 7511, 6999, 6358, 5879, 5619, 5347, 4934, 4508, 4143, 3697, 3144, 2782, 2843, 3074, 3043, 2781, 2674, 2860, 3124, 3342, 3516, 3487, 3137, 2811, 3045, 3779, 4314, 4207, 3838, 3826, 4193, 4447, 4319, 4021, 3859, 3894, 3932, 3734, 3397, 3429, 4025, 4582, 4481, 4039, 3936, 4150, 4163, 3815, 3323, 2857, 2558, 2512, 2525, 2367, 2198, 2221, 2183, 1826, 1485, 1610, 1961, 1892, 1202, 373, 22, 259, 517, 227, -368, -532, -199, -95, -569, -1106, -1259, -1221, -1288, -1429, -1508, -1443, -1203, -944, -802, -506, 203, 882, 936, 588, 396, 260, -145, -534, -563, -652, -1254, -1851, -1613, -687, 4, 97, 97, 371, 610, 537, 393, 287, -212, -1317, -2393, -2636, -2017, -1170, -623, -418, -282, 31, 546, 1081, 1374, 1191, 470, -487, -1175, -1369, -1344, -1420, -1534, -1479, -1327, -1333, -1546, -1733, -1694, -1625, -2070, -3267, -4625, -5308, -5368, -5629, -6397, -7109, -7355, -7379, -7452, -7508, -7423, -7083, -6369, -5478, -4911, -4795, -4664, -4203, -3672, -3436, -3521, -3818, -4304, -4971, -5713, -6320, -6534, -6120, -5126, -3929, -2740, -1094, 1661, 5260, 8602, 11085, 13175, 15301, 17163, 18504, 19665, 20932, 22002, 22599, 23045, 23804, 24903, 26086, 27245, 28383, 29276, 29533, 29099, 28396, 27787, 26979, 25526, 23632, 21912, 20438, 18778, 16949, 15477, 14472, 13493, 12400, 11510, 10861, 10101, 9130, 8303, 7823, 7451, 6800, 5823, 4893, 4359, 4039, 3435, 2419, 1342, 398, -592, -1650, -2484, -3070, -3818, -4909, -5922, -6435, -6618, -6924, -7458, -8033, -8649, -9517, -10548, -11243, -11336, -11246, -11442, -11624, -11130, -10023, -8989, -8159, -6967, -5313, -3946, -3343, -3054, -2548, -2084, -2189, -2755, -3186, -3266, -3316, -3552, -3794, -3850, -3760, -3608, -3424, -3324, -3474, -3923, -4619, -5424, -6117, -6641, -7217, -7888, -8229, -7953, -7456, -7202, -6982, -6329, -5371, -4657, -4311, -3974, -3503, -3239, -3410, -3711, -3736, -3596, -3711, -4132, -4458, -4493, -4537, -4817, -5099, -5194, -5360, -5810, -6318, -6655, -6918, -7144, -7178, -7134, -7323, -7613, -7518, -7039, -6773, -6978, -7186, -6990, -6692, -6764, -7031, -6942, -6506, -6302, -6547, -6732, -6456, -6144, -6484, -7465, -8456, -9139, -9867, -11009, -12329, -13396, -14273, -15314, -16445, -17184, -17425, -17623, -18063, -18495, -18685, -18786, -19005, -19232, -19315, -19330, -19411, -19481, -19315, -18855, -18292, -17771, -17135, -16207, -15221, -14563, -14127, -13446, -12573, -12124, -12297, -12459, -12085, -11489, -11235, -11230, -10977, -10390, -9884, -9662, -9414, -8900, -8395, -8239, -8235, -7895, -7226, -6718, -6558, -6259, -5346, -4109, -3211, -2739, -2109, -1053, -73, 340, 406, 530, 635, 512, 348, 392, 445, 202, -192, -391, -426, -652, -1189, -1835, -2485, -3266, -4197, -5050, -5691, -6246, -6811, -7308, -7674, -7949, -8073, -7915, -7576, -7436, -7696, -8075, -8133, -7797, -7352, -7067, -7026, -7167, -7263, -7004, -6374, -5779, -5554, -5501, -5183, -4540, -3967, -3760, -3684, -3289, -2567, -2010, -1912, -1888, -1396, -537, 100, 380, 896, 2043, 3257, 3806, 3978, 4655, 5859, 6724, 6983, 7405, 8508, 9728, 10314, 10429, 10800, 11698, 12639, 12986, 12588, 11850, 11346, 11292, 11300, 10805, 9822, 8993, 8735, 8734, 8505, 8057, 7650, 7184, 6336, 5141, 4060, 3433, 3143, 2864, 2375, 1643, 915, 734, 1428, 2641, 3697, 4374, 4897, 5357, 5627, 5882, 6572, 7606, 8147, 7637, 6688, 6375, 6900, 7564, 7831, 7854, 8003, 8364, 8683, 8660, 8398, 8418, 8892, 9188, 8724, 7981, 7960, 8732, 9330, 9195, 8947, 9317, 9972, 10091, 9678, 9512, 9891, 10269, 10203, 9937, 9838, 9782, 9552, 9329, 9361, 9396, 9013, 8318, 7798, 7563, 7248, 6662, 6080, 5784, 5651, 5368, 4906, 4614, 4761, 5159, 5398, 5350, 5230, 5207, 5204, 5157, 5198, 5390, 5474, 5253, 5055, 5361, 5993, 6306, 6193, 6168, 6363, 6246, 5583, 4915, 4740, 4851, 4795, 4524, 4265, 4096, 3980, 4039, 4453, 5049, 5301, 4961, 4448, 4335, 4571, 4641, 4385, 4187, 4284, 4386, 4213, 3982, 4038, 4254, 4209, 3792, 3304, 2948, 2601, 2158, 1762, 1509, 1190, 630, 115, 38, 251, 205, -234, -631, -727, -835, -1237, -1624, -1602, -1366, -1361, -1469, -1155, -407, 174, 338, 617, 1420, 2290, 2562, 2378, 2459, 3061, 3679, 3887, 3982, 4490, 5313, 5859, 5972, 6168, 6755, 7264, 7137, 6597, 6287, 6276, 6033, 5348, 4669, 4331, 4033, 3440, 2838, 2656, 2635, 2103, 1020, 126, -129, -197, -629, -1234, -1525, -1581, -1843, -2280, -2457, -2277, -2117, -2259, -2652, -3166, -3694, -4033, -4028, -3906, -4178, -5003, -5827, -5942, -5381, -4939, -5236, -6032, -6648, -6791, -6675, -6530, -6379, -6353, -6730, -7388, -7579, -6733, -5352, -4568, -4766, -5169, -4905, -4048, -3335, -3165, -3217, -3056, -2812, -2960, -3438, -3513, -2796, -1895, -1571, -1769, -1913, -1757, -1429, -1021, -619, -429, -488, -482, -155, 296, 588, 872, 1429, 2017, 2210, 2219, 2627, 3321, 3625, 3480, 3610, 4308, 4861, 4497, 3468, 2875, 3389, 4282, 4085, 2393, 606, 308, 1205, 1446, 119, -1520, -1951, -1557, -1687, -2418, -2811, -2795, -3016, -3313, -3004, -2369, -2342, -2984, -3530, -3717, -3973, -4447, -4891, -5547, -7000, -8887, -9861, -9368, -8269, -7253, -5828, -3515, -797, 1824, 4622, 7855, 11020, 13366, 14723, 15566, 16507, 17838, 19308, 20402, 20984, 21606, 22991, 25073, 27007, 28114, 28514, 28624, 28570, 28352, 28061, 27654, 26834, 25443, 23730, 22064, 20658, 19561, 18744, 17993, 16988, 15633, 14252, 13247, 12649, 12171, 11626, 10997, 10282, 9478, 8667, 7988, 7506, 7151, 6712, 5953, 4872, 3767, 2906, 2218, 1462, 596, -252, -1073, -1967, -2780, -3221, -3474, -4191, -5569, -6996, -7964, -8749, -9761, -10816, -11514, -11834, -11942, -11824, -11431, -10909, -10378, -9723, -8850, -7992, -7463, -7219, -6985, -6714, -6545, -6443, -6259, -6018, -5844, -5691, -5451, -5127, -4724, -4186, -3620, -3358, -3603, -4199, -4851, -5443, -6032, -6634, -7221, -7808, -8334, -8564, -8337, -7855, -7473, -7238, -6911, -6440, -6095, -6037, -6069, -6043, -6133, -6426, -6591, -6402, -6198, -6335, -6559, -6412, -5944, -5554, -5370, -5258, -5217, -5358, -5626, -5860, -6108, -6579, -7270, -7861, -8144, -8380, -8917, -9586, -9843, -9572, -9337, -9603, -10069, -10137, -9760, -9414, -9387, -9493, -9430, -9165, -8860, -8636, -8548, -8682, -9084, -9548, -9716, -9622, -9824, -10644, -11597, -12023, -12078, -12447, -13308, -14136, -14602, -15048, -15807, -16682, -17376, -18054, -18945, -19771, -20121, -20169, -20414, -20816, -20822, -20304, -19793, -19572, -19169, -18185, -17098, -16639, -16646, -16269, -15221, -14132, -13511, -13043, -12204, -11093, -10174, -9502, -8745, -7860, -7224, -6957, -6686, -6200, -5885, -6144, -6653, -6756, -6413, -6220, -6406, -6402, -5753, -4922, -4600, -4603, -4169, -3227, -2560, -2584, -2766, -2536, -2115, -1990, -2072, -1940, -1617, -1464, -1444, -1140, -579, -402, -926, -1573, -1670, -1431, -1582, -2258, -2915, -3282, -3686, -4337, -4937, -5215, -5377, -5733, -6248, -6684, -6946, -7131, -7275, -7274, -7073, -6854, -6830, -6899, -6694, -6079, -5377, -4939, -4674, -4217, -3491, -2800, -2326, -1825, -985, 75, 955, 1520, 2042, 2755, 3542, 4197, 4734, 5243, 5650, 5881, 6115, 6575, 7119, 7406, 7450, 7624, 8046, 8331, 8257, 8235, 8662, 9185, 9151, 8600, 8209, 8353, 8679, 8595, 7983, 7353, 7300, 7744, 7972, 7600, 7132, 7251, 7864, 8292, 8196, 7871, 7717, 7849, 8221, 8760, 9174, 9114, 8709, 8585, 9066, 9711, 9941, 9765, 9554, 9425, 9256, 9082, 9162, 9554, 9864, 9599, 8788, 8069, 7994, 8380, 8524, 8036, 7249, 6816, 7037, 7657, 8184, 8309, 8136, 8052, 8372, 9007, 9546, 9726, 9684, 9692, 9795, 9904, 10061, 10323, 10546, 10488, 10171, 9928, 9991, 10198, 10174, 9761, 9138, 8580, 8230, 8052, 7875, 7467, 6723, 5877, 5387, 5485, 5826, 5768, 5102, 4331, 4071, 4313, 4569, 4542, 4328, 4103, 3991, 4172, 4740, 5409, 5734, 5625, 5456, 5563, 5837, 5905, 5661, 5389, 5324, 5295, 5004, 4552, 4358, 4511, 4495, 3851, 2922, 2479, 2619, 2600, 1953, 1155, 816, 776, 556, 225, 204, 453, 428, -98, -589, -394, 320, 695, 319, -159, 64, 794, 1171, 943, 729, 981, 1349, 1396, 1341, 1603, 1943, 1751, 1084, 699, 942, 1216, 862, 78, -379, -194, 153, 53, -477, -899, -937, -889, -1026, -1125, -952, -781, -949, -1178, -883, -82, 534, 518, 233, 321, 839, 1265, 1249, 1009, 896, 910, 877, 860, 1020, 1230, 1226, 1034, 884, 807, 661, 414, 132, -217, -674, -1104, -1326, -1366, -1448, -1723, -2051, -2104, -1723, -1192, -1020, -1357, -1709, -1509, -965, -886, -1521, -2134, -2101, -1792, -1851, -2184, -2266, -2044, -1938, -2162, -2528, -2797, -2858, -2680, -2465, -2711, -3644, -4656, -4885, -4437, -4376, -5224, -6123, -6018, -5173, -4780, -5222, -5576, -5012, -3941, -3341, -3447, -3656, -3437, -2876, -2344, -1994, -1702, -1402, -1189, -965, -331, 818, 1881, 2216, 2036, 2078, 2622, 3314, 3820, 4127, 4313, 4353, 4249, 4143, 4262, 4672, 5048, 4911, 4214, 3456, 3097, 3111, 3255, 3418, 3414, 2806, 1509, 389, 469, 1413, 1625, 259, -1625, -2482, -2166, -1752, -1896, -2228, -2222, -1954, -1802, -1896, -2142, -2436, -2700, -2894, -3245, -4187, -5729, -7112, -7596, -7462, -7508, -7656, -6951, -5036, -2477, 391, 3760, 7466, 10960, 14091, 16881, 18951, 20173, 21269, 22820, 24346, 25133, 25368, 25790, 26718, 28009, 29461, 30853, 31763, 31875, 31406, 30826, 30201, 29186, 27671, 25897, 24021, 22006, 19915, 17960, 16261, 14876, 13801, 12822, 11659, 10389, 9364, 8665, 8003, 7204, 6367, 5605, 4899, 4191, 3494, 2879, 2446, 2248, 2144, 1821, 1105, 198, -535, -1029, -1543, -2259, -3093, -3960, -4890, -5827, -6608, -7243, -8015, -9196, -10723, -12211, -13253, -13832, -14323, -14962, -15485, -15535, -15174, -14699, -14150, -13402, -12549, -11838, -11313, -10804, -10253, -9812, -9611, -9535, -9269, -8622, -7774, -7076, -6623, -6148, -5392, -4404, -3475, -2930, -2990, -3655, -4633, -5524, -6186, -6819, -7642, -8519, -9072, -9144, -8959, -8771, -8529, -8103, -7677, -7614, -7923, -8219, -8269, -8308, -8618, -9093, -9403, -9421, -9258, -8956, -8476, -7915, -7454, -7040, -6420, -5595, -4933, -4763, -5078, -5579, -5907, -5940, -5995, -6431, -7078, -7470, -7574, -7732, -7979, -8067, -8114, -8528, -9265, -9806, -9961, -10153, -10674, -11174, -11226, -11054, -11132, -11418, -11517, -11420, -11518, -11960, -12470, -12749, -12788, -12815, -13075, -13525, -13873, -13939, -13932, -14103, -14400, -14672, -14965, -15384, -15829, -16141, -16378, -16767, -17362, -17875, -17993, -17803, -17717, -17888, -17928, -17455, -16689, -16154, -15898, -15499, -14833, -14293, -14074, -13700, -12675, -11284, -10177, -9379, -8326, -6860, -5528, -4729, -4151, -3341, -2427, -1888, -1766, -1662, -1377, -1200, -1369, -1625, -1523, -1020, -557, -516, -735, -697, -232, 178, 6, -589, -943, -797, -617, -869, -1321, -1419, -1120, -871, -827, -680, -276, 76, 61, -249, -543, -596, -471, -497, -882, -1388, -1635, -1659, -1796, -2107, -2392, -2670, -3167, -3816, -4210, -4171, -4072, -4442, -5269, -5895, -5762, -5152, -4858, -5150, -5462, -5253, -4700, -4239, -3850, -3233, -2508, -2121, -2034, -1603, -502, 723, 1406, 1684, 2202, 3149, 4085, 4621, 4912, 5317, 5817, 6066, 5984, 6036, 6600, 7295, 7395, 6884, 6564, 6964, 7613, 7716, 7192, 6617, 6334, 6129, 5812, 5584, 5558, 5372, 4763, 4270, 4651, 5645, 6083, 5485, 4766, 4916, 5647, 6004, 5809, 5677, 5815, 5772, 5463, 5551, 6335, 7066, 7000, 6533, 6596, 7271, 7767, 7643, 7306, 7209, 7162, 6826, 6477, 6689, 7336, 7518, 6744, 5701, 5434, 6042, 6676, 6667, 6192, 5803, 5744, 5903, 6146, 6456, 6776, 6914, 6751, 6503, 6569, 7032, 7474, 7468, 7135, 6991, 7334, 7912, 8309, 8419, 8453, 8533, 8518, 8364, 8325, 8529, 8560, 7978, 7100, 6684, 6892, 7146, 6981, 6530, 6102, 5807, 5687, 5816, 6119, 6297, 6110, 5649, 5260, 5188, 5324, 5394, 5285, 5054, 4765, 4542, 4624, 5015, 5287, 5105, 4737, 4606, 4640, 4527, 4369, 4475, 4687, 4524, 4017, 3795, 4181, 4661, 4553, 3936, 3442, 3315, 3177, 2832, 2658, 2896, 3074, 2737, 2296, 2442, 3005, 3158, 2656, 2137, 2104, 2265, 2093, 1607, 1277, 1292, 1324, 1098, 871, 1030, 1421, 1550, 1338, 1207, 1354, 1468, 1269, 917, 688, 572, 410, 211, 137, 238, 376, 430, 461, 623, 934, 1224, 1343, 1397, 1651, 2097, 2327, 2116, 1903, 2215, 2834, 3097, 2934, 2932, 3371, 3820, 3833, 3566, 3436, 3505, 3463, 3176, 2920, 2942, 3000, 2689, 2125, 1861, 2049, 2197, 1920, 1461, 1198, 1067, 768, 294, -23, 45, 298, 287, -106, -470, -473, -346, -360, -315, -81, -109, -692, -1285, -1252, -818, -623, -799, -1037, -1203, -1371, -1504, -1486, -1348, -1175, -951, -777, -957, -1455, -1589, -930, -177, -276, -969, -1162, -553, 64, 142, 69, 288, 562, 535, 548, 1192, 2268, 2855, 2542, 2005, 2056, 2566, 2799, 2541, 2268, 2286, 2308, 2021, 1597, 1456, 1721, 2006, 1776, 1038, 484, 528, 634, 132, -718, -1245, -1441, -1733, -2117, -2372, -2741, -3517, -4216, -4056, -3276, -3049, -3804, -4476, -4015, -2889, -2349, -2684, -3103, -3059, -2940, -3394, -4440, -5427, -5877, -6120, -6840, -7964, -8485, -7630, -5666, -3383, -1127, 1411, 4599, 8339, 12033, 15084, 17349, 19073, 20405, 21354, 22181, 23333, 24893, 26395, 27404, 28099, 29018, 30370, 31771, 32643, 32767, 32356, 31688, 30787, 29515, 27870, 26007, 24117, 22280, 20509, 18803, 17164, 15549, 13887, 12193, 10685, 9574, 8705, 7652, 6309, 5015, 4045, 3247, 2442, 1744, 1268, 811, 211, -270, -303, -147, -393, -1094, -1694, -1897, -2029, -2380, -2834, -3327, -4098, -5219, -6335, -7109, -7710, -8655, -10176, -11900, -13175, -13754, -14014, -14424, -14972, -15306, -15296, -15188, -15193, -15202, -15052, -14839, -14744, -14680, -14436, -14036, -13688, -13362, -12738, -11673, -10446, -9336, -8253, -7051, -5932, -5155, -4592, -3968, -3419, -3342, -3808, -4510, -5149, -5620, -5893, -5942, -5818, -5661, -5589, -5579, -5463, -5189, -5006, -5236, -5830, -6408, -6760, -7067, -7530, -7998, -8210, -8213, -8232, -8207, -7786, -6888, -5950, -5409, -5136, -4712, -4138, -3802, -3762, -3677, -3513, -3668, -4178, -4508, -4371, -4150, -4233, -4501, -4700, -4872, -5150, -5510, -5883, -6325, -6932, -7649, -8320, -8892, -9432, -9998, -10533, -11008, -11500, -12094, -12757, -13392, -13959, -14428, -14724, -14811, -14846, -15097, -15572, -15930, -15950, -15903, -16138, -16517, -16674, -16720, -17053, -17651, -18020, -18021, -18049, -18333, -18534, -18309, -17900, -17757, -17849, -17737, -17312, -16980, -17002, -17065, -16762, -16213, -15778, -15435, -14844, -13961, -13041, -12119, -10972, -9603, -8323, -7333, -6548, -5832, -5167, -4551, -3930, -3291, -2718, -2330, -2137, -2012, -1778, -1342, -774, -248, 87, 235, 287, 321, 374, 373, 95, -578, -1339, -1750, -1867, -2142, -2637, -2897, -2729, -2556, -2734, -2979, -2893, -2691, -2871, -3357, -3598, -3457, -3399, -3703, -4055, -4116, -3994, -3913, -3817, -3615, -3501, -3646, -3840, -3804, -3644, -3628, -3702, -3690, -3739, -4065, -4404, -4310, -3972, -4051, -4531, -4573, -3883, -3319, -3462, -3574, -2883, -2015, -1973, -2432, -2276, -1401, -799, -941, -1116, -568, 418, 1059, 1266, 1673, 2508, 3201, 3402, 3661, 4519, 5531, 5938, 5832, 5915, 6380, 6817, 6980, 6998, 6975, 6883, 6783, 6782, 6782, 6610, 6352, 6328, 6637, 6975, 7035, 6900, 6867, 7015, 7122, 6949, 6546, 6308, 6583, 7219, 7755, 8017, 8193, 8391, 8585, 8956, 9687, 10453, 10645, 10214, 9764, 9732, 9906, 9859, 9567, 9373, 9424, 9402, 9029, 8637, 8766, 9241, 9352, 8960, 8607, 8484, 8218, 7756, 7481, 7351, 6903, 6165, 5727, 5857, 6205, 6347, 6199, 5937, 5777, 5784, 5844, 5884, 5971, 6052, 5914, 5589, 5423, 5588, 5914, 6225, 6446, 6418, 6103, 5864, 6057, 6511, 6788, 6746, 6542, 6309, 6141, 6152, 6300, 6359, 6198, 5956, 5873, 6009, 6168, 6092, 5763, 5440, 5373, 5484, 5480, 5249, 5003, 4936, 4936, 4820, 4723, 4853, 5005, 4793, 4284, 3938, 3944, 4067, 4096, 4013, 3821, 3528, 3275, 3235, 3428, 3710, 3810, 3491, 2857, 2384, 2384, 2572, 2422, 1892, 1457, 1426, 1573, 1586, 1568, 1771, 2053, 2015, 1660, 1474, 1722, 2023, 1944, 1658, 1634, 1868, 1949, 1787, 1769, 2091, 2419, 2391, 2136, 2048, 2204, 2301, 2144, 1922, 1866, 1860, 1630, 1216, 983, 1131, 1387, 1380, 1159, 1080, 1216, 1290, 1218, 1284, 1536, 1561, 1161, 863, 1232, 2000, 2417, 2337, 2390, 2934, 3503, 3530, 3172, 2992, 3175, 3452, 3544, 3392, 3146, 3070, 3307, 3638, 3640, 3165, 2525, 2164, 2188, 2236, 1874, 1158, 592, 462, 479, 290, -43, -303, -464, -579, -639, -684, -720, -575, -208, 22, -178, -585, -803, -712, -383, -4, 23, -504, -1070, -911, -98, 492, 329, -171, -344, -51, 476, 1056, 1414, 1143, 390, 154, 1161, 2672, 3229, 2442, 1341, 945, 1143, 1164, 746, 429, 641, 922, 505, -485, -1012, -495, 392, 564, -198, -1181, -1681, -1639, -1391, -1219, -1212, -1285, -1209, -839, -361, -155, -377, -867, -1440, -2006, -2474, -2821, -3304, -4241, -5407, -6026, -5609, -4512, -3254, -1713, 529, 3301, 5973, 8369, 10842, 13472, 15716, 17065, 17742, 18496, 19797, 21371, 22614, 23354, 24002, 25097, 26747, 28548, 29939, 30516, 30183, 29233, 28289, 27829, 27626, 26937, 25428, 23456, 21472, 19584, 17918, 16725, 15886, 14733, 12836, 10624, 8856, 7627, 6479, 5236, 4100, 3061, 1884, 747, 89, -173, -612, -1388, -2050, -2228, -2089, -2079, -2436, -2988, -3359, -3409, -3382, -3518, -3713, -3814, -4014, -4620, -5567, -6458, -7156, -7951, -9003, -9972, -10512, -10785, -11199, -11763, -12172, -12370, -12613, -12981, -13232, -13295, -13475, -13989, -14528, -14638, -14309, -13887, -13489, -12889, -12026, -11150, -10376, -9440, -8203, -6993, -6137, -5498, -4828, -4259, -4061, -4132, -4132, -3976, -3821, -3707, -3496, -3177, -2933, -2849, -2788, -2687, -2729, -3104, -3794, -4607, -5376, -6061, -6774, -7685, -8756, -9630, -9984, -10009, -10233, -10754, -11060, -10848, -10479, -10283, -10001, -9421, -8964, -8981, -9058, -8662, -8049, -7826, -7917, -7695, -7010, -6407, -6193, -5959, -5299, -4525, -4178, -4254, -4383, -4559, -5090, -5957, -6721, -7178, -7710, -8702, -10008, -11210, -12203, -13157, -14080, -14812, -15445, -16317, -17514, -18608, -19185, -19375, -19646, -20207, -20847, -21290, -21468, -21429, -21228, -20948, -20698, -20478, -20081, -19292, -18282, -17549, -17253, -16965, -16317, -15557, -15042, -14625, -14037, -13435, -13094, -12927, -12722, -12442, -12119, -11723, -11321, -10960, -10553, -10044, -9535, -9062, -8542, -8064, -7784, -7559, -7153, -6730, -6601, -6634, -6424, -5879, -5246, -4684, -4187, -3691, -3092, -2308, -1484, -912, -667, -460, -11, 579, 915, 767, 347, 33, -93, -244, -464, -537, -446, -519, -923, -1355, -1492, -1455, -1576, -1968, -2534, -3172, -3800, -4277, -4506, -4547, -4607, -4828, -5100, -5132, -4788, -4287, -3994, -4004, -4057, -3904, -3604, -3375, -3253, -3144, -3049, -2963, -2728, -2302, -1951, -1834, -1635, -1042, -358, -126, -256, -122, 431, 804, 588, 180, 58, 55, -85, -44, 500, 1119, 1190, 929, 1188, 2258, 3434, 3868, 3546, 3221, 3583, 4603, 5652, 6124, 6058, 6076, 6633, 7452, 7916, 7905, 7883, 8186, 8552, 8595, 8373, 8207, 8214, 8362, 8637, 8773, 8333, 7497, 7126, 7514, 7816, 7298, 6372, 5836, 5831, 6059, 6369, 6656, 6641, 6216, 5763, 5805, 6359, 6823, 6647, 6017, 5586, 5563, 5571, 5462, 5557, 5829, 5733, 5197, 4953, 5428, 6103, 6368, 6273, 6157, 6093, 6004, 5865, 5721, 5666, 5707, 5655, 5424, 5291, 5490, 5772, 5828, 5840, 6100, 6414, 6424, 6226, 6201, 6420, 6618, 6601, 6479, 6499, 6728, 6944, 6945, 6914, 7154, 7545, 7640, 7334, 6972, 6829, 6882, 7042, 7238, 7289, 7037, 6618, 6323, 6301, 6458, 6582, 6480, 6133, 5709, 5357, 5107, 4971, 4959, 4940, 4737, 4401, 4164, 4108, 4142, 4232, 4378, 4428, 4218, 3871, 3721, 3888, 4135, 4227, 4226, 4304, 4453, 4561, 4644, 4783, 4961, 5115, 5175, 5058, 4839, 4767, 4821, 4630, 4172, 3995, 4282, 4440, 4116, 3820, 3982, 4192, 3966, 3525, 3314, 3255, 2999, 2553, 2277, 2313, 2338, 2001, 1491, 1348, 1677, 1916, 1669, 1291, 1315, 1690, 1971, 1990, 1960, 2098, 2448, 2938, 3422, 3778, 3998, 4136, 4246, 4424, 4743, 5067, 5137, 4933, 4776, 4898, 5082, 4988, 4710, 4618, 4728, 4660, 4332, 4135, 4256, 4318, 3929, 3224, 2641, 2419, 2428, 2345, 1961, 1423, 1113, 1208, 1446, 1463, 1235, 1066, 1163, 1380, 1454, 1384, 1407, 1547, 1518, 1231, 1083, 1381, 1787, 1761, 1327, 938, 805, 812, 933, 1243, 1594, 1663, 1421, 1271, 1550, 2049, 2202, 1744, 1014, 562, 556, 649, 395, -256, -891, -1042, -706, -404, -625, -1230, -1582, -1327, -825, -698, -1087, -1530, -1514, -1068, -762, -1022, -1558, -1774, -1596, -1414, -1369, -1333, -1366, -1540, -1584, -1352, -1201, -1358, -1436, -1215, -1225, -1902, -2746, -2999, -2728, -2582, -2735, -2753, -2501, -2449, -2833, -3048, -2430, -1365, -946, -1581, -2553, -3094, -3274, -3589, -4228, -5103, -6007, -6535, -6281, -5414, -4513, -3685, -2366, -160, 2599, 5314, 7761, 10064, 12281, 14317, 16093, 17618, 18861, 19859, 20893, 22316, 24122, 25851, 27053, 27720, 28193, 28779, 29442, 29895, 29865, 29215, 27908, 26124, 24346, 22984, 21877, 20466, 18500, 16217, 13958, 11970, 10411, 9087, 7473, 5430, 3444, 1923, 727, -382, -1416, -2407, -3445, -4349, -4861, -5051, -5206, -5379, -5432, -5354, -5184, -4921, -4591, -4275, -3917, -3354, -2713, -2504, -3028, -3830, -4125, -3790, -3620, -4321, -5562, -6454, -6806, -7208, -7944, -8606, -8968, -9420, -10199, -10989, -11583, -12214, -12973, -13574, -13942, -14446, -15218, -15755, -15560, -14876, -14379, -14232, -13889, -12883, -11484, -10253, -9341, -8526, -7762, -7192, -6680, -5909, -4941, -4285, -4075, -3700, -2626, -1296, -565, -457, -203, 456, 862, 517, -209, -796, -1369, -2346, -3714, -5070, -6152, -7027, -7867, -8751, -9675, -10556, -11193, -11414, -11335, -11342, -11716, -12342, -12875, -13081, -12921, -12494, -12064, -11916, -11916, -11503, -10431, -9169, -8203, -7407, -6456, -5454, -4691, -4128, -3569, -3033, -2720, -2722, -2994, -3465, -4023, -4512, -4922, -5514, -6537, -7865, -9143, -10213, -11187, -12196, -13254, -14376, -15545, -16707, -17848, -18937, -19833, -20433, -20906, -21501, -22132, -22478, -22438, -22246, -22053, -21726, -21192, -20645, -20170, -19483, -18347, -17091, -16230, -15706, -15011, -13959, -12921, -12152, -11424, -10531, -9732, -9235, -8752, -7973, -7158, -6692, -6476, -6210, -5968, -6003, -6214, -6347, -6460, -6826, -7376, -7705, -7596, -7335, -7313, -7523, -7644, -7465, -7028, -6454, -5844, -5321, -4952, -4613, -4077, -3337, -2672, -2322, -2175, -1886, -1292, -554, 56, 448, 738, 1072, 1484, 1883, 2150, 2212, 2061, 1756, 1371, 967, 594, 288, -1, -429, -1061, -1701, -2050, -2092, -2161, -2567, -3211, -3736, -3937, -3919, -3889, -3941, -4060, -4184, -4231, -4112, -3838, -3491, -3075, -2476, -1720, -1076, -673, -161, 794, 1842, 2296, 2136, 2093, 2645, 3474, 4036, 4247, 4375, 4575, 4837, 5183, 5621, 5953, 5959, 5746, 5654, 5805, 5948, 5778, 5267, 4743, 4618, 4909, 5129, 4872, 4320, 3911, 3772, 3756, 3778, 3743, 3448, 2921, 2580, 2738, 3103, 3164, 2934, 2921, 3326, 3751, 3849, 3893, 4336, 5043, 5415, 5240, 4993, 5190, 5749, 6197, 6245, 5973, 5633, 5488, 5677, 6020, 6093, 5658, 4928, 4380, 4306, 4527, 4511, 3912, 2995, 2299, 1981, 1798, 1624, 1548, 1533, 1386, 1065, 700, 409, 260, 257, 266, 175, 125, 360, 876, 1454, 1977, 2437, 2756, 2896, 3098, 3658, 4423, 4853, 4740, 4506, 4564, 4774, 4837, 4875, 5152, 5513, 5571, 5323, 5171, 5336, 5612, 5729, 5627, 5317, 4825, 4389, 4390, 4844, 5249, 5209, 4966, 5053, 5574, 6153, 6497, 6672, 6795, 6823, 6766, 6899, 7417, 8052, 8320, 8157, 8003, 8245, 8776, 9232, 9439, 9423, 9175, 8695, 8280, 8326, 8757, 8947, 8508, 7844, 7634, 7989, 8452, 8626, 8501, 8265, 8050, 7937, 7960, 8031, 7934, 7552, 7011, 6612, 6574, 6870, 7186, 7177, 6893, 6738, 6859, 6922, 6709, 6474, 6391, 6198, 5724, 5260, 5113, 5187, 5204, 5020, 4719, 4596, 4848, 5181, 5087, 4575, 4163, 4070, 4006, 3800, 3636, 3600, 3492, 3307, 3379, 3867, 4381, 4436, 4096, 3859, 3953, 4096, 4016, 3873, 3881, 3849, 3529, 3210, 3387, 3937, 4187, 3897, 3602, 3777, 4147, 4179, 3901, 3732, 3711, 3465, 2955, 2666, 2900, 3268, 3174, 2566, 1939, 1741, 1954, 2224, 2244, 1961, 1506, 1061, 811, 861, 1106, 1293, 1263, 1082, 899, 831, 949, 1209, 1373, 1219, 849, 601, 647, 845, 1015, 1155, 1314, 1428, 1467, 1564, 1780, 1915, 1780, 1491, 1231, 1017, 882, 948, 1126, 1115, 923, 977, 1486, 2070, 2216, 1866, 1395, 1164, 1136, 965, 514, 52, -254, -622, -1128, -1404, -1298, -1239, -1481, -1685, -1663, -1753, -2077, -2278, -2277, -2482, -3026, -3501, -3595, -3460, -3396, -3528, -3752, -3868, -3836, -3847, -3946, -3904, -3735, -3858, -4409, -4888, -4906, -4746, -4806, -5020, -5119, -5047, -4912, -4856, -4974, -5141, -5121, -5000, -5145, -5624, -6126, -6501, -6882, -7290, -7608, -7885, -8220, -8474, -8440, -8076, -7373, -6264, -4863, -3460, -2140, -626, 1330, 3600, 5793, 7613, 9059, 10346, 11715, 13272, 14900, 16351, 17438, 18174, 18734, 19286, 19952, 20736, 21468, 21882, 21808, 21269, 20438, 19559, 18832, 18207, 17350, 16015, 14312, 12572, 11014, 9665, 8458, 7284, 6013, 4636, 3324, 2308, 1636, 1060, 238, -836, -1762, -2277, -2598, -2993, -3335, -3453, -3515, -3656, -3662, -3397, -3081, -2850, -2592, -2348, -2343, -2518, -2584, -2524, -2579, -2792, -2985, -3136, -3359, -3630, -3808, -3959, -4309, -4858, -5287, -5447, -5640, -6172, -6860, -7268, -7337, -7435, -7810, -8297, -8624, -8762, -8829, -8856, -8819, -8773, -8758, -8689, -8419, -7928, -7347, -6830, -6430, -6031, -5464, -4719, -3984, -3438, -2996, -2441, -1799, -1321, -1033, -617, 37, 572, 728, 723, 838, 1063, 1327, 1562, 1497, 927, 186, -177, -194, -400, -1060, -1867, -2429, -2707, -2944, -3316, -3724, -3952, -4004, -4115, -4383, -4579, -4467, -4173, -4048, -4231, -4497, -4501, -4142, -3640, -3293, -3162, -3056, -2777, -2328, -1860, -1517, -1366, -1398, -1553, -1810, -2145, -2451, -2652, -2935, -3586, -4550, -5412, -5928, -6348, -7050, -8065, -9136, -10153, -11158, -12097, -12892, -13704, -14728, -15766, -16484, -16963, -17468, -17954, -18281, -18580, -18906, -18987, -18715, -18409, -18259, -18035, -17615, -17201, -16833, -16229, -15281, -14298, -13557, -12920, -12104, -11126, -10238, -9531, -8804, -7932, -7084, -6452, -5909, -5230, -4513, -4046, -3822, -3514, -2995, -2558, -2474, -2593, -2626, -2608, -2802, -3244, -3694, -4000, -4233, -4413, -4457, -4452, -4629, -4941, -4989, -4576, -4097, -4053, -4347, -4385, -3952, -3608, -3893, -4403, -4272, -3470, -2865, -2876, -2955, -2629, -2165, -1875, -1633, -1353, -1256, -1401, -1558, -1609, -1635, -1719, -1922, -2223, -2436, -2484, -2613, -2913, -3009, -2718, -2569, -3018, -3657, -3818, -3539, -3361, -3537, -3876, -4159, -4347, -4448, -4393, -4103, -3716, -3590, -3810, -3922, -3523, -2846, -2304, -1819, -1173, -613, -426, -322, 146, 874, 1451, 1804, 2163, 2600, 2992, 3319, 3749, 4385, 5047, 5423, 5495, 5627, 6094, 6641, 6755, 6312, 5722, 5376, 5214, 5017, 4828, 4721, 4459, 3926, 3602, 3933, 4469, 4414, 3839, 3538, 3792, 4047, 3838, 3384, 3115, 3097, 3118, 3065, 2994, 2943, 2903, 2939, 3181, 3589, 3948, 4186, 4463, 4770, 4810, 4562, 4503, 4888, 5293, 5310, 5171, 5223, 5320, 5208, 4999, 4930, 4994, 5059, 5042, 4892, 4624, 4370, 4207, 4022, 3745, 3550, 3580, 3591, 3199, 2534, 2218, 2513, 2870, 2638, 1945, 1490, 1616, 2017, 2296, 2349, 2170, 1763, 1425, 1621, 2310, 2835, 2723, 2251, 1943, 1905, 1999, 2306, 2854, 3154, 2683, 1788, 1378, 1686, 2122, 2268, 2205, 1893, 1176, 490, 570, 1340, 1805, 1351, 475, 25, 174, 546, 867, 1037, 895, 456, 144, 310, 722, 947, 943, 887, 722, 364, 147, 501, 1238, 1652, 1454, 1150, 1285, 1737, 2067, 2212, 2370, 2480, 2321, 2058, 2131, 2534, 2760, 2603, 2439, 2513, 2610, 2570, 2567, 2684, 2767, 2745, 2669, 2511, 2249, 2004, 1860, 1811, 1850, 1826, 1479, 986, 964, 1513, 1894, 1668, 1381, 1596, 2020, 2165, 2171, 2390, 2680, 2688, 2513, 2562, 2890, 3169, 3269, 3406, 3661, 3851, 3929, 4081, 4379, 4698, 4920, 4976, 4835, 4671, 4749, 5033, 5163, 4970, 4667, 4451, 4238, 3927, 3617, 3409, 3150, 2633, 1945, 1437, 1312, 1406, 1431, 1304, 1149, 1098, 1230, 1580, 1997, 2163, 2026, 1947, 2105, 2174, 2000, 2050, 2600, 3039, 2728, 2076, 2036, 2812, 3660, 3856, 3450, 3036, 3114, 3705, 4409, 4784, 4744, 4646, 4860, 5298, 5567, 5502, 5317, 5247, 5304, 5362, 5320, 5220, 5240, 5474, 5711, 5641, 5273, 4939, 4894, 5060, 5181, 5025, 4490, 3721, 3141, 3091, 3307, 3102, 2290, 1563, 1580, 2031, 2087, 1570, 1089, 1089, 1274, 1109, 529, -61, -321, -298, -295, -591, -1187, -1728, -1847, -1651, -1650, -2166, -3004, -3722, -4042, -4027, -3990, -4126, -4246, -4104, -3887, -3926, -4023, -3642, -2779, -2065, -1926, -2076, -1989, -1473, -663, 200, 845, 1025, 784, 613, 1077, 2069, 2722, 2465, 1871, 1860, 2349, 2555, 2369, 2381, 2675, 2679, 2251, 1905, 1896, 1898, 1672, 1381, 1087, 557, -181, -595, -343, 104, 19, -618, -1127, -1076, -720, -516, -582, -799, -1094, -1422, -1623, -1559, -1352, -1263, -1344, -1386, -1187, -795, -426, -195, 5, 307, 590, 611, 415, 380, 686, 1023, 1009, 729, 596, 767, 998, 1067, 1050, 1050, 927, 540, 95, -59, 36, -53, -580, -1263, -1639, -1619, -1513, -1581, -1791, -2024, -2252, -2405, -2375, -2296, -2520, -3034, -3322, -3150, -3006, -3338, -3794, -3763, -3342, -3151, -3370, -3517, -3214, -2724, -2519, -2615, -2624, -2313, -1838, -1460, -1259, -1147, -994, -722, -357, -51, 0, -258, -579, -592, -272, -35, -159, -343, -210, 77, 139, 42, 150, 472, 640, 480, 200, 6, -127, -256, -321, -302, -337, -469, -457, -60, 567, 999, 1044, 948, 1076, 1461, 1768, 1740, 1552, 1545, 1696, 1721, 1622, 1712, 2039, 2227, 2037, 1690, 1519, 1545, 1516, 1202, 621, 20, -380, -600, -813, -1115, -1484, -1908, -2371, -2749, -2915, -2961, -3147, -3541, -3861, -3828, -3529, -3221, -3012, -2921, -2937, -2850, -2473, -2114, -2263, -2788, -3147, -3296, -3597, -4016, -4195, -4161, -4206, -4293, -4181, -3938, -3790, -3652, -3338, -3092, -3300, -3705, -3666, -3299, -3408, -4068, -4383, -3939, -3372, -3186, -3120, -2891, -2587, -2280, -1995, -1883, -1860, -1558, -998, -692, -773, -687, -77, 701, 1224, 1632, 2196, 2705, 2879, 3044, 3633, 4243, 4081, 3260, 2743, 2999, 3500, 3535, 2951, 2180, 1868, 2224, 2640, 2389, 1545, 713, 142, -319, -757, -1259, -2017, -2930, -3554, -3783, -4097, -4812, -5562, -5922, -6152, -6739, -7548, -8033, -8194, -8495, -8931, -9047, -8851, -8810, -8954, -8877, -8557, -8424, -8608, -8790, -8751, -8628, -8623, -8735, -8817, -8743, -8556, -8410, -8331, -8153, -7752, -7303, -7115, -7250, -7381, -7144, -6661, -6501, -6964, -7553, -7530, -6894, -6424, -6612, -6995, -6845, -6227, -5871, -6100, -6479, -6537, -6382, -6315, -6421, -6705, -7130, -7402, -7215, -6785, -6648, -6870, -6993, -6766, -6431, -6222, -6060, -5880, -5846, -5973, -5888, -5330, -4657, -4415, -4585, -4674, -4409, -3965, -3639, -3567, -3675, -3788, -3806, -3806, -3813, -3624, -3073, -2419, -2143, -2333, -2469, -1988, -1015, -304, -379, -904, -1133, -817, -332, -17, 209, 476, 677, 747, 889, 1258, 1633, 1701, 1480, 1214, 959, 630, 362, 401, 622, 575, 170, -68, 336, 1175, 1820, 1958, 1787, 1619, 1569, 1622, 1717, 1691, 1393, 994, 959, 1426, 1890, 1915, 1859, 2334, 3138, 3533, 3412, 3411, 3833, 4257, 4281, 4059, 3987, 4231, 4666, 5067, 5328, 5542, 5855, 6227, 6479, 6590, 6805, 7254, 7640, 7591, 7245, 7116, 7380, 7705, 7777, 7629, 7483, 7511, 7678, 7698, 7387, 7066, 7144, 7422, 7301, 6669, 6050, 5876, 6052, 6186, 5981, 5488, 5086, 5028, 5087, 4904, 4562, 4403, 4381, 4110, 3605, 3422, 3794, 4133, 3866, 3334, 3235, 3485, 3435, 2954, 2529, 2429, 2397, 2127, 1595, 998, 640, 730, 1089, 1220, 867, 369, 271, 642, 1042, 1111, 895, 608, 406, 396, 533, 610, 566, 578, 663, 601, 440, 570, 1039, 1352, 1202, 912, 899, 1088, 1176, 1144, 1182, 1265, 1182, 970, 923, 1161, 1478, 1611, 1443, 1064, 806, 945, 1231, 1171, 798, 572, 553, 386, 54, -56, 180, 487, 621, 533, 291, 128, 340, 849, 1127, 821, 241, -5, 218, 512, 561, 461, 392, 353, 324, 369, 489, 619, 729, 738, 540, 313, 410, 794, 1010, 856, 611, 537, 618, 788, 986, 1020, 744, 370, 265, 462, 638, 608, 531, 563, 595, 517, 469, 608, 810, 873, 822, 800, 824, 818, 784, 782, 820, 854, 845, 765, 603, 454, 468, 641, 749, 641, 478, 476, 607, 717, 795, 870, 844, 677, 566, 719, 1020, 1157, 1053, 915, 859, 769, 599, 515, 613, 700, 574, 323, 204, 347, 671, 989, 1149, 1131, 1078, 1157, 1335, 1407, 1277, 1111, 1100, 1169, 1106, 922, 862, 1071, 1384, 1558, 1572, 1595, 1734, 1927, 2045, 2021, 1870, 1688, 1569, 1494, 1368, 1177, 1011, 922, 903, 932, 956, 900, 795, 774, 851, 845, 646, 396, 294, 343, 390, 356, 271, 164, 65, 80, 215, 252, 45, -147, -11, 299, 391, 219, 84, 165, 389, 606, 685, 597, 513, 618, 818, 878, 794, 762, 831, 833, 685, 503, 373, 235, 83, 65, 192, 207, -46, -364, -490, -415, -239, -48, -39, -363, -751, -711, -200, 260, 244, -116, -366, -276, -43, -6, -214, -399, -408, -408, -529, -567, -287, 174, 463, 439, 288, 248, 390, 603, 711, 573, 211, -193, -454, -540, -547, -556, -601, -719, -875, -907, -727, -476, -360, -431, -622, -816, -857, -725, -662, -862, -1115, -1079, -827, -735, -917, -1078, -972, -706, -507, -421, -377, -365, -350, -214, 76, 351, 481, 535, 580, 570, 518, 541, 649, 705, 656, 597, 607, 683, 834, 1071, 1304, 1398, 1362, 1375, 1547, 1744, 1774, 1634, 1464, 1363, 1352, 1414, 1485, 1483, 1426, 1424, 1545, 1765, 2015, 2204, 2262, 2225, 2213, 2286, 2406, 2519, 2561, 2456, 2266, 2210, 2385, 2628, 2749, 2700, 2525, 2362, 2440, 2784, 3017, 2818, 2434, 2358, 2630, 2831, 2721, 2523, 2523, 2672, 2721, 2577, 2362, 2218, 2147, 2047, 1801, 1442, 1186, 1192, 1287, 1172, 826, 489, 303, 209, 88, -182, -654, -1180, -1560, -1845, -2191, -2513, -2636, -2673, -2847, -3050, -2944, -2474, -1988, -1825, -1991, -2193, -2149, -1860, -1576, -1490, -1510, -1382, -938, -150, 948, 2280, 3697, 5044, 6291, 7539, 8883, 10237, 11397, 12289, 13049, 13814, 14513, 15063, 15601, 16319, 17118, 17697, 17973, 18176, 18535, 18970, 19242, 19187, 18802, 18203, 17561, 16998, 16451, 15750, 14850, 13888, 12935, 11905, 10805, 9843, 9134, 8500, 7677, 6591, 5412, 4374, 3564, 2822, 2012, 1257, 631, -107, -1055, -1741, -1791, -1639, -1946, -2600, -2945, -2800, -2580, -2651, -2959, -3276, -3477, -3575, -3647, -3763, -3901, -3988, -4059, -4253, -4552, -4700, -4620, -4651, -5028, -5457, -5611, -5695, -6047, -6540, -6884, -7150, -7557, -8028, -8351, -8557, -8868, -9327, -9773, -10062, -10175, -10130, -9973, -9863, -9951, -10121, -10028, -9558, -9050, -8889, -8994, -8923, -8480, -7983, -7813, -7863, -7670, -7078, -6445, -6122, -5967, -5598, -4970, -4416, -4158, -4027, -3780, -3453, -3259, -3249, -3280, -3244, -3189, -3208, -3329, -3503, -3614, -3624, -3659, -3874, -4214, -4486, -4633, -4763, -4974, -5250, -5530, -5779, -5992, -6198, -6445, -6710, -6873, -6859, -6777, -6805, -6924, -6953, -6843, -6722, -6645, -6576, -6563, -6675, -6791, -6750, -6630, -6638, -6783, -6910, -6956, -6994, -7076, -7175, -7266, -7366, -7513, -7741, -8051, -8377, -8618, -8796, -9073, -9528, -9978, -10194, -10235, -10364, -10680, -11008, -11163, -11157, -11125, -11149, -11208, -11227, -11176, -11065, -10890, -10645, -10376, -10165, -9961, -9605, -9037, -8396, -7866, -7489, -7155, -6697, -6016, -5206, -4517, -4088, -3741, -3219, -2576, -2150, -1990, -1698, -1020, -321, -87, -215, -209, 126, 547, 789, 807, 678, 512, 436, 496, 572, 494, 255, 12, -131, -269, -521, -780, -841, -762, -874, -1317, -1779, -1865, -1624, -1476, -1668, -2020, -2239, -2275, -2242, -2181, -2060, -1915, -1819, -1785, -1770, -1738, -1624, -1386, -1111, -968, -1004, -1093, -1096, -956, -696, -416, -253, -241, -265, -178, 61, 382, 667, 804, 745, 613, 649, 922, 1170, 1092, 765, 551, 618, 771, 811, 822, 907, 921, 754, 664, 932, 1290, 1265, 922, 772, 995, 1286, 1375, 1275, 1109, 1022, 1153, 1429, 1572, 1440, 1240, 1222, 1352, 1430, 1450, 1558, 1744, 1802, 1667, 1503, 1452, 1498, 1606, 1730, 1738, 1537, 1279, 1198, 1308, 1403, 1326, 1125, 943, 862, 856, 862, 845, 758, 558, 345, 352, 583, 667, 378, 64, 176, 555, 639, 314, 55, 207, 517, 586, 425, 294, 268, 264, 316, 479, 619, 601, 501, 459, 480, 542, 663, 768, 701, 468, 281, 287, 408, 489, 487, 432, 340, 266, 319, 459, 506, 458, 515, 649, 619, 525, 745, 1213, 1403, 1199, 1108, 1450, 1918, 2130, 2116, 2130, 2269, 2472, 2679, 2889, 3103, 3346, 3671, 4048, 4346, 4506, 4635, 4831, 5060, 5269, 5420, 5451, 5412, 5519, 5812, 5995, 5917, 5840, 5978, 6185, 6332, 6511, 6687, 6678, 6568, 6645, 6882, 6945, 6732, 6495, 6440, 6463, 6368, 6138, 5971, 6036, 6253, 6345, 6166, 5948, 6059, 6521, 6897, 6834, 6549, 6514, 6816, 7149, 7286, 7241, 7088, 6950, 6960, 7063, 7063, 6969, 7000, 7188, 7332, 7376, 7462, 7657, 7875, 8016, 8031, 7912, 7782, 7799, 7911, 7855, 7512, 7132, 6984, 6950, 6774, 6530, 6461, 6422, 6078, 5571, 5373, 5533, 5612, 5363, 4965, 4662, 4540, 4585, 4644, 4447, 3953, 3525, 3511, 3715, 3644, 3231, 2923, 2969, 3127, 3154, 3078, 2920, 2666, 2556, 2838, 3232, 3180, 2665, 2265, 2373, 2723, 2802, 2463, 1995, 1763, 1867, 2097, 2120, 1815, 1458, 1432, 1695, 1774, 1378, 773, 453, 563, 809, 789, 389, -110, -310, -148, -1, -249, -773, -1057, -844, -479, -497, -974, -1452, -1459, -976, -402, -198, -506, -1017, -1230, -919, -371, -87, -250, -600, -811, -858, -904, -978, -966, -884, -961, -1352, -1827, -1915, -1462, -924, -897, -1438, -2051, -2349, -2442, -2631, -2995, -3416, -3843, -4359, -5034, -5775, -6354, -6594, -6530, -6385, -6414, -6702, -7009, -6844, -5933, -4644, -3673, -3272, -2999, -2361, -1366, -314, 662, 1629, 2592, 3467, 4291, 5201, 6251, 7403, 8676, 10086, 11431, 12424, 13099, 13869, 15003, 16262, 17175, 17566, 17672, 17782, 17957, 18092, 18146, 18112, 17930, 17529, 16981, 16487, 16136, 15837, 15436, 14866, 14136, 13264, 12323, 11433, 10674, 9971, 9169, 8218, 7230, 6337, 5552, 4810, 4108, 3514, 3043, 2600, 2086, 1564, 1188, 970, 717, 305, -121, -346, -411, -556, -850, -1117, -1220, -1252, -1342, -1422, -1444, -1567, -1873, -2115, -2118, -2153, -2512, -3016, -3331, -3490, -3711, -4056, -4507, -5016, -5409, -5569, -5710, -6108, -6641, -6979, -7086, -7216, -7522, -7942, -8390, -8805, -9066, -9121, -9152, -9396, -9719, -9749, -9462, -9219, -9160, -9044, -8776, -8563, -8484, -8358, -8083, -7762, -7475, -7237, -7071, -6957, -6761, -6399, -5981, -5659, -5445, -5204, -4841, -4413, -4046, -3810, -3677, -3574, -3475, -3451, -3565, -3723, -3753, -3717, -3845, -4111, -4215, -4057, -3928, -4042, -4267, -4403, -4429, -4416, -4437, -4587, -4906, -5265, -5478, -5539, -5611, -5808, -6112, -6474, -6828, -7005, -6901, -6780, -7001, -7448, -7675, -7628, -7692, -8007, -8326, -8544, -8810, -9130, -9365, -9555, -9851, -10210, -10467, -10623, -10840, -11183, -11533, -11765, -11911, -12086, -12343, -12616, -12805, -12884, -13006, -13351, -13751, -13799, -13500, -13400, -13721, -13983, -13792, -13407, -13147, -12903, -12552, -12265, -12125, -11967, -11689, -11308, -10827, -10302, -9950, -9854, -9746, -9331, -8686, -8141, -7826, -7597, -7327, -6985, -6470, -5750, -5171, -5083, -5216, -4990, -4412, -4005, -3989, -4097, -4082, -3901, -3569, -3241, -3160, -3309, -3387, -3266, -3105, -3027, -3009, -3073, -3252, -3410, -3379, -3245, -3260, -3427, -3468, -3255, -3035, -3026, -3090, -3018, -2871, -2803, -2764, -2646, -2510, -2487, -2573, -2657, -2625, -2436, -2203, -2094, -2112, -2109, -2023, -1867, -1587, -1241, -1137, -1440, -1773, -1641, -1148, -875, -1076, -1361, -1322, -1051, -895, -924, -977, -938, -769, -486, -303, -436, -664, -560, -205, -112, -382, -540, -300, 47, 142, 11, -106, -84, 97, 391, 574, 402, 69, 103, 567, 852, 606, 254, 265, 494, 640, 754, 903, 909, 746, 757, 1143, 1578, 1661, 1523, 1607, 1989, 2323, 2400, 2357, 2385, 2562, 2894, 3216, 3295, 3212, 3341, 3743, 4017, 3939, 3784, 3884, 4192, 4468, 4578, 4511, 4315, 4205, 4444, 4904, 5026, 4555, 4020, 4031, 4444, 4693, 4566, 4214, 3826, 3641, 3810, 4043, 3905, 3511, 3382, 3613, 3766, 3623, 3481, 3557, 3624, 3508, 3451, 3580, 3578, 3341, 3339, 3712, 3838, 3450, 3218, 3546, 3865, 3721, 3511, 3634, 3849, 3871, 3822, 3826, 3799, 3763, 3884, 4104, 4124, 3892, 3741, 3855, 4002, 4033, 4150, 4330, 4207, 3831, 3757, 4083, 4241, 3988, 3705, 3649, 3716, 3862, 4041, 3994, 3689, 3553, 3827, 4149, 4160, 4016, 4009, 4087, 4063, 3995, 4089, 4336, 4516, 4527, 4451, 4402, 4497, 4826, 5175, 5130, 4741, 4572, 4805, 4992, 4912, 4904, 5067, 5070, 4889, 4932, 5285, 5572, 5577, 5426, 5267, 5162, 5230, 5477, 5628, 5422, 5022, 4849, 5008, 5204, 5238, 5199, 5146, 5031, 4988, 5171, 5361, 5263, 5055, 5069, 5185, 5142, 5065, 5181, 5319, 5219, 5021, 5065, 5359, 5611, 5655, 5600, 5567, 5545, 5528, 5567, 5645, 5693, 5715, 5672, 5461, 5218, 5304, 5666, 5724, 5254, 4788, 4772, 4919, 4777, 4401, 4096, 3923, 3771, 3591, 3401, 3163, 2878, 2671, 2583, 2446, 2155, 1873, 1724, 1559, 1325, 1225, 1276, 1209, 1027, 1021, 1133, 1063, 936, 1083, 1308, 1181, 863, 860, 1114, 1117, 806, 689, 1019, 1419, 1513, 1494, 1727, 2176, 2555, 2722, 2680, 2541, 2578, 2856, 2909, 2393, 1785, 1719, 1998, 1987, 1621, 1305, 1202, 1185, 1230, 1357, 1406, 1222, 911, 658, 443, 174, -38, -66, -129, -513, -1027, -1244, -1161, -1107, -1164, -1189, -1226, -1399, -1578, -1543, -1348, -1191, -1116, -1076, -1121, -1263, -1247, -846, -303, -68, -123, -53, 219, 320, 149, 121, 500, 943, 997, 718, 541, 707, 1099, 1472, 1595, 1342, 910, 752, 1017, 1274, 1135, 809, 704, 828, 936, 967, 1021, 1045, 900, 595, 282, 22, -271, -652, -1090, -1565, -2045, -2382, -2435, -2344, -2457, -2891, -3359, -3493, -3263, -2976, -2967, -3365, -4056, -4762, -5206, -5360, -5463, -5711, -6047, -6310, -6419, -6294, -5854, -5186, -4563, -4158, -3843, -3398, -2792, -2199, -1758, -1404, -956, -353, 273, 810, 1357, 2100, 3004, 3804, 4378, 4975, 5837, 6729, 7289, 7628, 8155, 8893, 9492, 9825, 10048, 10265, 10494, 10801, 11127, 11240, 11090, 10899, 10819, 10772, 10710, 10681, 10630, 10401, 9999, 9628, 9412, 9248, 9000, 8688, 8351, 7950, 7499, 7143, 6895, 6549, 6047, 5652, 5546, 5508, 5240, 4803, 4483, 4336, 4135, 3751, 3363, 3163, 3027, 2669, 2060, 1519, 1332, 1397, 1354, 1042, 644, 412, 337, 197, -136, -567, -951, -1292, -1685, -2129, -2550, -2946, -3387, -3807, -4066, -4181, -4318, -4510, -4655, -4730, -4819, -4918, -4996, -5121, -5333, -5559, -5761, -5990, -6210, -6321, -6355, -6419, -6457, -6373, -6248, -6205, -6160, -5976, -5733, -5625, -5678, -5732, -5680, -5579, -5509, -5471, -5451, -5457, -5459, -5401, -5291, -5182, -5048, -4846, -4661, -4598, -4611, -4547, -4371, -4170, -4034, -4012, -4079, -4119, -4022, -3835, -3698, -3647, -3567, -3398, -3239, -3164, -3062, -2811, -2501, -2336, -2333, -2322, -2210, -2084, -2055, -2122, -2221, -2318, -2436, -2626, -2863, -3033, -3083, -3117, -3280, -3574, -3885, -4151, -4399, -4674, -4987, -5365, -5844, -6355, -6785, -7161, -7622, -8155, -8600, -8949, -9359, -9828, -10158, -10332, -10575, -10975, -11331, -11463, -11450, -11511, -11751, -12065, -12255, -12265, -12246, -12307, -12345, -12209, -11965, -11777, -11627, -11360, -10954, -10584, -10365, -10182, -9888, -9540, -9321, -9249, -9153, -8924, -8677, -8524, -8375, -8082, -7696, -7387, -7170, -6922, -6603, -6279, -5996, -5794, -5696, -5652, -5583, -5514, -5515, -5510, -5387, -5214, -5152, -5189, -5155, -4995, -4826, -4725, -4633, -4535, -4547, -4631, -4580, -4390, -4307, -4346, -4253, -4053, -4026, -4067, -3806, -3358, -3221, -3398, -3392, -3043, -2714, -2657, -2718, -2703, -2630, -2562, -2462, -2291, -2137, -2092, -2103, -2023, -1801, -1520, -1317, -1293, -1401, -1465, -1379, -1241, -1184, -1170, -1114, -1071, -1112, -1116, -911, -582, -416, -503, -607, -502, -259, -67, 53, 182, 270, 235, 253, 597, 1135, 1360, 1132, 966, 1288, 1774, 1839, 1513, 1354, 1651, 2088, 2210, 1988, 1821, 2034, 2461, 2680, 2621, 2610, 2818, 3023, 3031, 2980, 3087, 3313, 3473, 3503, 3503, 3578, 3724, 3859, 3949, 4059, 4247, 4462, 4608, 4669, 4707, 4765, 4840, 4930, 5016, 5031, 4922, 4809, 4898, 5170, 5348, 5288, 5194, 5253, 5336, 5265, 5098, 4945, 4768, 4518, 4259, 4054, 3894, 3788, 3745, 3701, 3592, 3467, 3426, 3490, 3584, 3614, 3528, 3323, 3058, 2809, 2612, 2447, 2275, 2102, 1958, 1851, 1779, 1735, 1716, 1700, 1704, 1761, 1846, 1866, 1769, 1635, 1566, 1574, 1583, 1533, 1435, 1351, 1336, 1385, 1431, 1412, 1343, 1319, 1385, 1478, 1533, 1570, 1643, 1726, 1765, 1773, 1810, 1879, 1942, 1998, 2083, 2185, 2240, 2258, 2327, 2464, 2578, 2635, 2696, 2788, 2868, 2948, 3065, 3175, 3213, 3234, 3315, 3395, 3362, 3291, 3367, 3597, 3777, 3794, 3821, 4055, 4411, 4630, 4654, 4684, 4882, 5140, 5229, 5104, 4982, 5067, 5270, 5339, 5241, 5219, 5397, 5571, 5523, 5368, 5354, 5457, 5420, 5182, 5000, 5055, 5160, 5058, 4821, 4760, 4956, 5160, 5162, 5066, 5077, 5170, 5164, 5032, 4948, 5003, 5043, 4883, 4589, 4426, 4533, 4729, 4752, 4589, 4484, 4588, 4744, 4715, 4538, 4458, 4509, 4428, 4089, 3783, 3788, 3944, 3901, 3668, 3557, 3662, 3743, 3644, 3531, 3558, 3585, 3430, 3212, 3172, 3269, 3248, 3069, 2984, 3115, 3234, 3113, 2879, 2813, 2909, 2909, 2713, 2502, 2414, 2354, 2214, 2102, 2208, 2480, 2625, 2489, 2275, 2271, 2472, 2622, 2568, 2401, 2207, 1912, 1509, 1254, 1351, 1514, 1271, 700, 402, 611, 850, 712, 448, 492, 744, 747, 378, 27, 89, 447, 628, 412, 108, 103, 349, 496, 409, 313, 391, 513, 475, 334, 316, 479, 669, 779, 834, 846, 785, 691, 666, 741, 849, 857, 668, 364, 213, 346, 567, 657, 686, 762, 743, 502, 286, 420, 784, 894, 515, -35, -299, -216, -133, -310, -618, -784, -786, -825, -974, -1042, -868, -628, -661, -1056, -1524, -1749, -1762, -1851, -2170, -2575, -2867, -3049, -3252, -3491, -3623, -3562, -3432, -3424, -3569, -3788, -4039, -4314, -4563, -4791, -5134, -5651, -6174, -6523, -6743, -6939, -7040, -6909, -6592, -6302, -6160, -6084, -5879, -5448, -4887, -4426, -4224, -4180, -4018, -3579, -2993, -2507, -2178, -1846, -1370, -777, -138, 535, 1249, 1929, 2508, 3048, 3655, 4296, 4806, 5113, 5367, 5731, 6144, 6403, 6472, 6531, 6733, 7025, 7270, 7407, 7467, 7511, 7552, 7540, 7446, 7342, 7311, 7279, 7107, 6809, 6539, 6372, 6253, 6142, 6028, 5864, 5596, 5303, 5140, 5137, 5105, 4854, 4433, 4080, 3936, 3872, 3680, 3321, 2965, 2752, 2612, 2379, 2069, 1884, 1865, 1785, 1486, 1138, 983, 945, 735, 286, -150, -365, -486, -811, -1381, -1886, -2087, -2133, -2347, -2730, -2992, -3001, -2996, -3199, -3486, -3604, -3578, -3670, -3981, -4309, -4465, -4515, -4604, -4747, -4851, -4880, -4874, -4846, -4779, -4663, -4542, -4470, -4425, -4333, -4181, -4067, -4075, -4133, -4106, -3999, -3955, -4029, -4088, -4001, -3844, -3763, -3730, -3593, -3365, -3232, -3258, -3247, -3037, -2777, -2746, -2940, -3046, -2888, -2680, -2711, -2897, -2876, -2519, -2142, -2065, -2156, -2010, -1528, -1081, -984, -1073, -978, -668, -458, -523, -672, -668, -573, -596, -751, -862, -869, -906, -1077, -1320, -1523, -1669, -1835, -2093, -2444, -2834, -3214, -3595, -4005, -4453, -4957, -5525, -6090, -6556, -6932, -7337, -7827, -8321, -8728, -9043, -9318, -9605, -9931, -10283, -10619, -10896, -11128, -11338, -11528, -11678, -11785, -11844, -11821, -11702, -11545, -11419, -11313, -11155, -10951, -10774, -10646, -10541, -10443, -10345, -10208, -10028, -9845, -9651, -9402, -9121, -8877, -8630, -8268, -7826, -7479, -7293, -7145, -6917, -6670, -6520, -6454, -6373, -6244, -6120, -5998, -5813, -5578, -5379, -5254, -5108, -4840, -4496, -4228, -4114, -4037, -3847, -3586, -3431, -3407, -3305, -2977, -2567, -2319, -2234, -2090, -1797, -1504, -1319, -1145, -896, -690, -632, -613, -469, -233, -51, 52, 147, 230, 249, 277, 462, 771, 961, 884, 733, 802, 1095, 1321, 1293, 1165, 1196, 1390, 1520, 1514, 1588, 1881, 2165, 2169, 2025, 2076, 2346, 2546, 2556, 2570, 2740, 2951, 3047, 3076, 3205, 3464, 3694, 3770, 3748, 3768, 3862, 3944, 3960, 3942, 3943, 3970, 4010, 4067, 4127, 4148, 4110, 4077, 4116, 4205, 4246, 4190, 4066, 3920, 3788, 3724, 3734, 3728, 3628, 3497, 3478, 3595, 3732, 3801, 3845, 3944, 4070, 4127, 4089, 4028, 3995, 3937, 3801, 3634, 3539, 3538, 3580, 3621, 3630, 3583, 3509, 3519, 3652, 3794, 3793, 3666, 3552, 3511, 3459, 3334, 3203, 3153, 3148, 3082, 2965, 2909, 2943, 2938, 2812, 2673, 2665, 2748, 2759, 2636, 2465, 2342, 2297, 2308, 2313, 2259, 2164, 2113, 2149, 2235, 2293, 2281, 2220, 2166, 2163, 2188, 2197, 2186, 2168, 2121, 2032, 1962, 1998, 2115, 2174, 2076, 1885, 1751, 1743, 1812, 1876, 1855, 1711, 1507, 1384, 1406, 1490, 1518, 1448, 1304, 1159, 1110, 1181, 1259, 1238, 1170, 1164, 1236, 1326, 1392, 1426, 1437, 1442, 1431, 1389, 1370, 1461, 1592, 1562, 1336, 1161, 1252, 1473, 1530, 1374, 1243, 1319, 1494, 1580, 1594, 1688, 1874, 1995, 1970, 1926, 2010, 2168, 2192, 2023, 1839, 1810, 1871, 1860, 1783, 1768, 1824, 1861, 1894, 1994, 2110, 2124, 2056, 2021, 2015, 1948, 1821, 1749, 1794, 1872, 1873, 1796, 1734, 1751, 1835, 1934, 2009, 2034, 2011, 1980, 1976, 1966, 1885, 1771, 1721, 1735, 1688, 1525, 1379, 1381, 1495, 1585, 1584, 1524, 1465, 1430, 1408, 1389, 1373, 1334, 1208, 992, 796, 754, 843, 895, 810, 680, 642, 675, 679, 660, 679, 675, 528, 285, 102, 42, 56, 81, 42, -118, -322, -387, -271, -144, -167, -328, -514, -639, -683, -698, -767, -913, -1065, -1118, -1078, -1046, -1099, -1204, -1298, -1375, -1462, -1556, -1650, -1760, -1907, -2070, -2180, -2167, -2032, -1877, -1825, -1856, -1806, -1589, -1327, -1208, -1247, -1305, -1319, -1364, -1482, -1540, -1404, -1200, -1200, -1429, -1557, -1309, -849, -574, -614, -730, -687, -521, -410, -426, -493, -534, -558, -614, -676, -665, -554, -411, -309, -238, -153, -54, 21, 80, 147, 203, 177, 67, -31, -43, -10, -7, -12, 45, 133, 135, 32, -37, 22, 124, 133, 71, 38, 43, 11, -48, -29, 104, 240, 253, 180, 159, 249, 360, 403, 407, 448, 506, 481, 365, 298, 403, 603, 706, 667, 613, 641, 718, 804, 896, 945, 895, 809, 815, 923, 1008, 994, 948, 947, 972, 955, 888, 840, 859, 901, 892, 806, 711, 697, 787, 910, 998, 1056, 1135, 1248, 1396, 1574, 1732, 1802, 1812, 1868, 1980, 2034, 1973, 1882, 1872, 1966, 2130, 2321, 2498, 2618, 2691, 2796, 2986, 3204, 3325, 3277, 3116, 2960, 2855, 2755, 2597, 2404, 2270, 2227, 2198, 2116, 2034, 2042, 2126, 2188, 2177, 2128, 2094, 2099, 2135, 2144, 2058, 1888, 1744, 1721, 1773, 1760, 1632, 1474, 1379, 1332, 1274, 1186, 1094, 1020, 960, 892, 794, 694, 636, 619, 603, 599, 636, 690, 715, 734, 806, 905, 950, 936, 938, 977, 984, 921, 849, 813, 758, 634, 511, 465, 441, 357, 251, 216, 255, 279, 227, 144, 111, 138, 124, -21, -208, -260, -170, -106, -170, -241, -183, -43, 54, 116, 244, 441, 573, 579, 552, 594, 684, 745, 734, 642, 490, 346, 294, 343, 399, 359, 207, 49, 14, 120, 269, 356, 359, 321, 291, 314, 432, 622, 758, 737, 610, 551, 635, 743, 744, 641, 508, 359, 188, 34, -54, -95, -138, -210, -313, -419, -476, -425, -282, -147, -112, -171, -236, -243, -194, -133, -131, -225, -371, -524, -731, -1046, -1376, -1557, -1595, -1654, -1850, -2150, -2471, -2719, -2800, -2707, -2613, -2750, -3134, -3528, -3718, -3752, -3807, -3962, -4177, -4410, -4652, -4882, -5072, -5159, -5057, -4807, -4597, -4545, -4518, -4329, -3961, -3513, -3027, -2532, -2137, -1915, -1769, -1508, -1071, -585, -215, 3, 126, 242, 446, 791, 1229, 1632, 1931, 2144, 2320, 2505, 2762, 3120, 3524, 3865, 4055, 4099, 4103, 4201, 4423, 4661, 4793, 4821, 4835, 4875, 4893, 4877, 4904, 5044, 5248, 5395, 5415, 5347, 5271, 5264, 5354, 5491, 5577, 5552, 5446, 5329, 5253, 5235, 5248, 5236, 5142, 4981, 4832, 4760, 4750, 4733, 4661, 4553, 4436, 4308, 4165, 4052, 3995, 3929, 3761, 3500, 3246, 3061, 2903, 2705, 2450, 2168, 1895, 1644, 1368, 1022, 650, 367, 221, 116, -76, -370, -669, -910, -1115, -1306, -1476, -1635, -1819, -2034, -2254, -2476, -2707, -2907, -3055, -3205, -3408, -3628, -3799, -3913, -4016, -4133, -4253, -4368, -4473, -4543, -4573, -4609, -4720, -4898, -5054, -5147, -5208, -5279, -5381, -5515, -5651, -5729, -5732, -5725, -5778, -5872, -5929, -5916, -5854, -5784, -5742, -5735, -5744, -5717, -5630, -5540, -5517, -5546, -5559, -5535, -5496, -5454, -5419, -5420, -5442, -5415, -5331, -5277, -5303, -5336, -5294, -5193, -5120, -5116, -5148, -5154, -5121, -5097, -5133, -5226, -5310, -5335, -5314, -5311, -5365, -5453, -5530, -5563, -5551, -5529, -5554, -5645, -5733, -5729, -5646, -5594, -5653, -5772, -5819, -5742, -5616, -5553, -5589, -5653, -5650, -5541, -5373, -5222, -5142, -5103, -5038, -4912, -4767, -4657, -4569, -4464, -4359, -4308, -4291, -4215, -4042, -3861, -3791, -3843, -3907, -3891, -3812, -3750, -3734, -3724, -3679, -3608, -3539, -3484, -3436, -3393, -3340, -3247, -3111, -2965, -2844, -2747, -2656, -2565, -2492, -2435, -2372, -2303, -2248, -2221, -2191, -2123, -2024, -1938, -1883, -1838, -1766, -1657, -1519, -1364, -1215, -1116, -1093, -1095, -1040, -897, -736, -640, -623, -626, -589, -488, -348, -217, -117, -31, 61, 158, 254, 370, 515, 667, 798, 894, 959, 1021, 1132, 1303, 1476, 1592, 1660, 1721, 1795, 1874, 1960, 2054, 2144, 2203, 2222, 2229, 2244, 2266, 2273, 2254, 2233, 2237, 2276, 2331, 2379, 2419, 2464, 2524, 2591, 2652, 2705, 2748, 2787, 2829, 2886, 2933, 2927, 2851, 2767, 2751, 2798, 2829, 2816, 2809, 2850, 2925, 2997, 3061, 3127, 3205, 3301, 3385, 3425, 3425, 3418, 3422, 3433, 3455, 3472, 3450, 3385, 3336, 3353, 3403, 3418, 3384, 3330, 3273, 3216, 3192, 3227, 3292, 3291, 3172, 2994, 2857, 2813, 2827, 2824, 2751, 2625, 2523, 2497, 2525, 2555, 2558, 2538, 2497, 2448, 2407, 2373, 2338, 2315, 2318, 2320, 2277, 2209, 2186, 2230, 2258, 2215, 2172, 2210, 2280, 2301, 2291, 2319, 2381, 2434, 2474, 2495, 2451, 2336, 2220, 2171, 2177, 2169, 2087, 1939, 1811, 1796, 1898, 2015, 2048, 2014, 2005, 2048, 2087, 2109, 2144, 2154, 2056, 1889, 1777, 1728, 1641, 1508, 1428, 1415, 1385, 1315, 1288, 1341, 1396, 1379, 1326, 1318, 1363, 1406, 1400, 1325, 1199, 1088, 1047, 1028, 954, 849, 785, 734, 639, 562, 584, 656, 684, 671, 662, 655, 640, 651, 680, 677, 628, 580, 566, 581, 618, 660, 664, 596, 509, 508, 601, 668, 634, 578, 605, 700, 780, 811, 799, 758, 738, 779, 851, 885, 870, 851, 868, 914, 955, 968, 961, 975, 1036, 1103, 1105, 1030, 929, 860, 829, 822, 843, 885, 922, 931, 932, 959, 1005, 1058, 1109, 1152, 1160, 1144, 1147, 1187, 1235, 1254, 1244, 1235, 1277, 1402, 1557, 1658, 1706, 1779, 1903, 1987, 1960, 1900, 1933, 2052, 2122, 2085, 2025, 2026, 2052, 2025, 1953, 1911, 1945, 2022, 2071, 2031, 1901, 1761, 1701, 1732, 1763, 1711, 1596, 1524, 1550, 1629, 1683, 1683, 1663, 1671, 1710, 1738, 1735, 1723, 1722, 1711, 1679, 1662, 1677, 1684, 1656, 1630, 1635, 1634, 1579, 1484, 1404, 1368, 1360, 1374, 1409, 1459, 1492, 1474, 1395, 1284, 1207, 1219, 1285, 1293, 1191, 1050, 976, 990, 1052, 1117, 1150, 1105, 989, 904, 949, 1084, 1152, 1044, 820, 603, 462, 382, 319, 229, 97, -45, -167, -272, -364, -408, -394, -379, -421, -502, -534, -458, -314, -199, -188, -277, -385, -414, -343, -243, -181, -147, -123, -158, -260, -324, -247, -67, 89, 160, 149, 80, -7, -34, 52, 207, 320, 307, 178, 16, -79, -51, 50, 100, 36, -70, -128, -148, -164, -158, -134, -164, -274, -404, -507, -579, -601, -571, -568, -658, -789, -841, -796, -723, -679, -664, -679, -746, -871, -1028, -1197, -1370, -1542, -1716, -1928, -2209, -2514, -2764, -2923, -2998, -2998, -2979, -3038, -3183, -3292, -3267, -3136, -2976, -2839, -2789, -2869, -3006, -3051, -2943, -2768, -2651, -2637, -2700, -2775, -2795, -2705, -2519, -2325, -2180, -2062, -1941, -1829, -1729, -1596, -1397, -1176, -1000, -899, -857, -823, -740, -611, -508, -485, -496, -460, -358, -236, -142, -84, -45, 3, 92, 226, 365, 470, 564, 683, 796, 861, 909, 1003, 1125, 1216, 1270, 1316, 1365, 1428, 1536, 1682, 1796, 1838, 1859, 1929, 2048, 2153, 2213, 2262, 2320, 2379, 2430, 2481, 2530, 2559, 2570, 2575, 2584, 2599, 2616, 2599, 2517, 2418, 2379, 2381, 2330, 2196, 2066, 2014, 1995, 1926, 1798, 1689, 1653, 1662, 1649, 1579, 1467, 1362, 1303, 1260, 1155, 975, 793, 669, 583, 491, 380, 251, 97, -66, -221, -361, -484, -581, -674, -783, -901, -1006, -1105, -1236, -1404, -1570, -1707, -1835, -1977, -2116, -2248, -2409, -2604, -2780, -2902, -3012, -3140, -3244, -3307, -3388, -3499, -3561, -3543, -3553, -3661, -3793, -3845, -3847, -3900, -4014, -4094, -4099, -4098, -4160, -4263, -4335, -4353, -4332, -4303, -4294, -4329, -4383, -4416, -4415, -4413, -4440, -4484, -4526, -4578, -4636, -4664, -4639, -4594, -4573, -4583, -4606, -4620, -4587, -4495, -4401, -4381, -4441, -4534, -4631, -4706, -4725, -4692, -4678, -4747, -4857, -4896, -4828, -4731, -4679, -4656, -4612, -4537, -4429, -4283, -4139, -4066, -4071, -4082, -4039, -3939, -3819, -3725, -3684, -3679, -3670, -3648, -3620, -3564, -3449, -3291, -3155, -3079, -3031, -2955, -2836, -2695, -2545, -2397, -2270, -2177, -2107, -2034, -1952, -1891, -1863, -1856, -1845, -1817, -1763, -1686, -1595, -1523, -1493, -1491, -1459, -1379, -1288, -1238, -1214, -1171, -1122, -1109, -1121, -1099, -1023, -941, -899, -895, -890, -853, -799, -775, -792, -796, -766, -753, -792, -828, -799, -741, -723, -740, -736, -674, -569, -452, -355, -298, -280, -278, -266, -236, -198, -177, -178, -187, -198, -221, -237, -199, -99, 10, 92, 159, 241, 347, 481, 647, 821, 958, 1041, 1092, 1148, 1225, 1307, 1356, 1348, 1305, 1287, 1335, 1418, 1463, 1467, 1476, 1508, 1541, 1592, 1678, 1732, 1705, 1671, 1706, 1748, 1727, 1702, 1726, 1740, 1712, 1702, 1746, 1802, 1853, 1928, 2021, 2094, 2170, 2287, 2418, 2498, 2536, 2602, 2722, 2850, 2937, 2989, 3027, 3043, 3032, 3038, 3125, 3270, 3378, 3411, 3434, 3496, 3558, 3596, 3652, 3735, 3782, 3787, 3813, 3860, 3849, 3790, 3784, 3851, 3909, 3915, 3917, 3943, 3939, 3872, 3782, 3726, 3694, 3644, 3567, 3485, 3396, 3291, 3186, 3111, 3065, 3032, 2999, 2959, 2910, 2876, 2877, 2909, 2953, 2982, 2955, 2853, 2728, 2660, 2641, 2573, 2403, 2209, 2086, 2010, 1895, 1751, 1656, 1599, 1507, 1395, 1347, 1352, 1310, 1199, 1092, 1021, 937, 806, 662, 547, 463, 380, 281, 166, 56, -24, -68, -103, -145, -171, -150, -117, -118, -140, -160, -206, -286, -326, -284, -227, -230, -261, -269, -280, -338, -381, -321, -206, -177, -244, -280, -238, -226, -302, -366, -341, -303, -348, -425, -430, -391, -418, -496, -523, -488, -475, -475, -419, -335, -305, -306, -244, -120, 0, 102, 218, 321, 369, 385, 430, 495, 533, 566, 661, 796, 876, 894, 948, 1058, 1154, 1213, 1277, 1360, 1428, 1475, 1508, 1507, 1486, 1516, 1614, 1706, 1724, 1704, 1706, 1716, 1664, 1546, 1459, 1498, 1622, 1677, 1561, 1343, 1196, 1227, 1397, 1568, 1627, 1573, 1514, 1545, 1662, 1805, 1938, 2054, 2126, 2132, 2111, 2114, 2125, 2077, 1944, 1780, 1684, 1700, 1773, 1796, 1722, 1605, 1520, 1508, 1570, 1683, 1779, 1782, 1683, 1579, 1558, 1597, 1621, 1613, 1596, 1531, 1374, 1202, 1125, 1103, 1031, 939, 939, 1010, 1032, 993, 984, 1023, 1049, 1064, 1150, 1286, 1321, 1194, 1034, 964, 933, 872, 849, 932, 1042, 1060, 1004, 970, 972, 970, 976, 1038, 1128, 1154, 1093, 1009, 921, 800, 675, 606, 574, 502, 387, 297, 248, 186, 94, 37, 55, 108, 138, 146, 158, 165, 159, 149, 121, 50, -23, -24, 37, 67, 23, -31, -32, -2, 6, -1, 9, 49, 82, 80, 73, 116, 194, 232, 189, 105, 34, 0, 1, 43, 94, 91, -2, -143, -272, -398, -551, -685, -739, -759, -877, -1122, -1365, -1479, -1473, -1421, -1352, -1282, -1299, -1449, -1620, -1667, -1636, -1675, -1807, -1981, -2226, -2556, -2834, -2951, -2985, -3051, -3115, -3115, -3086, -3054, -2952, -2741, -2508, -2350, -2247, -2129, -2028, -2004, -2004, -1941, -1855, -1840, -1884, -1894, -1868, -1847, -1797, -1661, -1487, -1361, -1254, -1059, -778, -518, -321, -128, 78, 226, 297, 382, 519, 629, 666, 691, 752, 810, 862, 992, 1214, 1382, 1406, 1426, 1607, 1849, 1956, 1967, 2050, 2191, 2251, 2249, 2303, 2409, 2480, 2523, 2601, 2701, 2759, 2773, 2800, 2864, 2929, 2977, 3026, 3092, 3141, 3139, 3119, 3131, 3164, 3160, 3110, 3083, 3119, 3174, 3190, 3154, 3085, 2997, 2918, 2878, 2861, 2789, 2616, 2384, 2177, 2038, 1967, 1967, 1992, 1933, 1766, 1625, 1621, 1694, 1757, 1824, 1894, 1862, 1705, 1552, 1505, 1487, 1393, 1221, 1031, 843, 641, 436, 253, 102, -51, -234, -419, -549, -631, -735, -895, -1078, -1263, -1471, -1700, -1890, -2017, -2162, -2397, -2667, -2872, -3018, -3188, -3364, -3457, -3486, -3575, -3735, -3846, -3857, -3860, -3918, -3996, -4056, -4126, -4211, -4264, -4267, -4278, -4349, -4445, -4485, -4457, -4426, -4421, -4398, -4344, -4338, -4424, -4506, -4487, -4436, -4478, -4590, -4661, -4669, -4670, -4679, -4668, -4657, -4664, -4658, -4608, -4546, -4523, -4534, -4562, -4619, -4711, -4794, -4830, -4879, -5009, -5186, -5330, -5438, -5531, -5551, -5471, -5390, -5412, -5479, -5465, -5351, -5214, -5117, -5059, -5031, -5032, -5029, -4981, -4894, -4826, -4816, -4841, -4857, -4839, -4773, -4658, -4530, -4452, -4447, -4458, -4403, -4246, -4026, -3813, -3655, -3568, -3531, -3482, -3348, -3120, -2899, -2813, -2893, -3011, -3021, -2893, -2727, -2622, -2584, -2573, -2563, -2526, -2423, -2255, -2101, -2033, -2042, -2051, -2011, -1927, -1799, -1637, -1508, -1481, -1528, -1535, -1457, -1336, -1209, -1085, -1024, -1072, -1159, -1158, -1050, -940, -895, -867, -811, -759, -748, -727, -634, -497, -379, -293, -241, -233, -244, -201, -96, -15, 1, 17, 92, 180, 222, 264, 392, 581, 718, 767, 811, 909, 1027, 1133, 1251, 1385, 1473, 1491, 1528, 1661, 1817, 1873, 1845, 1843, 1894, 1938, 1948, 1947, 1933, 1909, 1922, 2001, 2088, 2127, 2153, 2236, 2369, 2459, 2431, 2319, 2241, 2268, 2346, 2373, 2310, 2208, 2135, 2114, 2135, 2160, 2177, 2215, 2302, 2408, 2485, 2542, 2640, 2785, 2939, 3071, 3179, 3254, 3304, 3365, 3457, 3539, 3547, 3480, 3409, 3406, 3468, 3538, 3557, 3522, 3464, 3436, 3470, 3566, 3677, 3745, 3738, 3663, 3560, 3483, 3476, 3533, 3558, 3464, 3263, 3058, 2933, 2879, 2845, 2793, 2704, 2559, 2392, 2281, 2269, 2286, 2246, 2155, 2069, 1987, 1894, 1827, 1796, 1733, 1594, 1437, 1315, 1204, 1082, 970, 879, 784, 668, 547, 441, 374, 353, 330, 237, 92, -12, -20, 15, -1, -101, -243, -366, -441, -468, -475, -520, -639, -794, -899, -912, -897, -915, -921, -863, -818, -880, -979, -962, -829, -725, -714, -738, -768, -824, -873, -850, -781, -767, -845, -941, -983, -978, -978, -982, -961, -933, -935, -952, -916, -817, -724, -672, -620, -547, -502, -506, -485, -390, -282, -250, -281, -299, -275, -222, -133, 0, 131, 192, 209, 276, 425, 605, 776, 927, 1033, 1080, 1126, 1246, 1417, 1561, 1634, 1651, 1644, 1674, 1800, 2000, 2181, 2263, 2277, 2302, 2363, 2441, 2540, 2667, 2768, 2771, 2697, 2656, 2690, 2732, 2715, 2674, 2669, 2690, 2661, 2557, 2458, 2442, 2453, 2363, 2204, 2127, 2153, 2163, 2135, 2160, 2204, 2158, 2100, 2229, 2518, 2734, 2788, 2834, 2982, 3154, 3264, 3365, 3528, 3671, 3656, 3481, 3279, 3150, 3081, 3011, 2907, 2748, 2529, 2331, 2277, 2381, 2520, 2581, 2585, 2612, 2666, 2700, 2691, 2636, 2527, 2371, 2193, 1980, 1700, 1389, 1131, 951, 782, 585, 448, 464, 581, 667, 679, 699, 773, 850, 887, 933, 1053, 1203, 1277, 1231, 1097, 939, 844, 892, 1067, 1235, 1274, 1207, 1126, 1108, 1196, 1396, 1623, 1750, 1728, 1618, 1503, 1437, 1418, 1369, 1205, 939, 689, 547, 501, 470, 386, 242, 119, 114, 236, 368, 392, 315, 233, 176, 97, 25, 56, 170, 218, 143, 38, -42, -118, -116, 78, 376, 547, 511, 401, 363, 440, 612, 813, 938, 911, 769, 616, 509, 447, 393, 293, 75, -289, -709, -1043, -1248, -1420, -1663, -1977, -2281, -2491, -2547, -2454, -2304, -2223, -2239, -2250, -2180, -2064, -1928, -1720, -1468, -1335, -1388, -1470, -1419, -1283, -1188, -1143, -1103, -1079, -1081, -1035, -880, -684, -551, -466, -335, -144, 20, 133, 237, 316, 310, 229, 153, 108, 49, -38, -114, -150, -164, -175, -166, -121, -49, 42, 153, 268, 363, 447, 562, 708, 837, 917, 982, 1069, 1183, 1321, 1496, 1689, 1842, 1937, 2059, 2276, 2516, 2661, 2713, 2772, 2884, 3017, 3130, 3202, 3226, 3215, 3205, 3199, 3159, 3067, 2977, 2938, 2916, 2833, 2678, 2511, 2374, 2252, 2121, 1976, 1811, 1655, 1570, 1585, 1617, 1566, 1441, 1356, 1395, 1541, 1688, 1732, 1662, 1548, 1474, 1462, 1494, 1512, 1453, 1318, 1181, 1093, 1017, 927, 865, 838, 756, 567, 363, 243, 182, 75, -122, -385, -665, -929, -1165, -1393, -1630, -1868, -2090, -2292, -2480, -2656, -2808, -2929, -3022, -3111, -3211, -3310, -3377, -3392, -3366, -3340, -3354, -3423, -3503, -3535, -3493, -3415, -3353, -3325, -3324, -3337, -3348, -3337, -3311, -3300, -3325, -3377, -3447, -3545, -3679, -3822, -3929, -4004, -4105, -4264, -4440, -4565, -4631, -4681, -4746, -4811, -4868, -4937, -5023, -5094, -5121, -5127, -5156, -5217, -5286, -5353, -5421, -5471, -5465, -5412, -5376, -5398, -5423, -5373, -5258, -5158, -5123, -5126, -5119, -5077, -5001, -4902, -4816, -4786, -4813, -4857, -4890, -4896, -4863, -4786, -4716, -4722, -4815, -4913, -4924, -4840, -4725, -4639, -4596, -4572, -4502, -4349, -4151, -3983, -3856, -3755, -3701, -3702, -3688, -3576, -3416, -3310, -3286, -3287, -3267, -3204, -3083, -2908, -2744, -2652, -2629, -2607, -2547, -2464, -2370, -2256, -2151, -2100, -2088, -2049, -1963, -1871, -1817, -1814, -1849, -1871, -1829, -1742, -1687, -1711, -1770, -1806, -1792, -1734, -1636, -1532, -1485, -1503, -1501, -1398, -1237, -1107, -1016, -924, -852, -830, -802, -695, -530, -399, -353, -376, -419, -422, -342, -192, -49, 22, 27, 21, 48, 137, 304, 526, 717, 795, 773, 745, 788, 907, 1058, 1168, 1164, 1039, 901, 890, 1034, 1215, 1304, 1291, 1260, 1284, 1384, 1555, 1754, 1879, 1861, 1773, 1760, 1838, 1893, 1885, 1904, 1953, 1933, 1840, 1823, 1955, 2130, 2247, 2334, 2433, 2502, 2525, 2596, 2773, 2929, 2922, 2804, 2735, 2737, 2718, 2675, 2680, 2719, 2718, 2691, 2732, 2866, 3034, 3196, 3351, 3483, 3561, 3634, 3805, 4067, 4262, 4263, 4142, 4082, 4157, 4275, 4295, 4172, 3992, 3884, 3894, 3950, 3950, 3893, 3868, 3939, 4041, 4060, 3986, 3916, 3928, 3977, 3982, 3939, 3889, 3823, 3727, 3636, 3590, 3538, 3435, 3336, 3310, 3306, 3231, 3108, 3045, 3061, 3056, 2983, 2912, 2907, 2910, 2844, 2729, 2629, 2539, 2435, 2348, 2317, 2280, 2149, 1947, 1787, 1722, 1682, 1595, 1496, 1451, 1409, 1279, 1093, 993, 1003, 965, 782, 558, 437, 410, 382, 314, 219, 108, 20, 15, 76, 80, -43, -199, -260, -265, -325, -427, -479, -493, -559, -672, -772, -858, -918, -871, -724, -640, -725, -891, -989, -982, -924, -874, -877, -956, -1094, -1220, -1270, -1258, -1253, -1305, -1394, -1464, -1493, -1495, -1451, -1344, -1226, -1188, -1233, -1245, -1118, -889, -691, -614, -637, -675, -675, -642, -573, -432, -228, -59, -2, -1, 69, 252, 481, 669, 761, 760, 733, 754, 826, 881, 868, 795, 697, 612, 585, 638, 711, 704, 599, 507, 523, 606, 663, 678, 671, 644, 617, 635, 684, 679, 607, 555, 561, 540, 447, 386, 464, 608, 646, 555, 481, 536, 679, 837, 1012, 1187, 1255, 1172, 1111, 1265, 1556, 1711, 1613, 1412, 1273, 1231, 1271, 1352, 1365, 1233, 1015, 843, 744, 660, 566, 495, 428, 291, 71, -126, -206, -214, -274, -441, -650, -778, -746, -593, -464, -490, -659, -835, -872, -716, -440, -204, -150, -282, -458, -513, -377, -136, 28, -10, -189, -343, -387, -331, -187, 5, 114, 62, -12, 81, 351, 641, 839, 907, 848, 707, 584, 542, 573, 627, 617, 464, 194, -50, -150, -90, 64, 205, 214, 77, -46, 5, 231, 509, 747, 895, 912, 824, 746, 783, 934, 1106, 1186, 1102, 892, 688, 624, 741, 976, 1197, 1268, 1149, 950, 845, 916, 1083, 1181, 1097, 837, 502, 215, 38, -42, -105, -247, -499, -790, -999, -1064, -1022, -951, -906, -904, -928, -922, -828, -646, -436, -286, -263, -337, -381, -293, -131, -53, -123, -248, -319, -327, -313, -288, -252, -242, -281, -324, -298, -208, -96, 16, 122, 170, 130, 75, 97, 182, 232, 209, 178, 196, 226, 225, 225, 291, 428, 574, 688, 778, 872, 982, 1120, 1282, 1430, 1520, 1589, 1702, 1845, 1931, 1940, 1947, 1988, 2028, 2055, 2104, 2179, 2218, 2196, 2160, 2170, 2226, 2309, 2409, 2497, 2509, 2446, 2404, 2464, 2568, 2592, 2518, 2433, 2401, 2391, 2352, 2282, 2208, 2141, 2092, 2078, 2077, 2042, 1986, 1969, 1994, 1986, 1912, 1862, 1927, 2064, 2143, 2105, 2015, 1951, 1925, 1900, 1866, 1822, 1759, 1667, 1545, 1400, 1248, 1133, 1087, 1067, 977, 766, 497, 287, 181, 126, 44, -110, -327, -543, -696, -784, -860, -967, -1110, -1267, -1401, -1474, -1498, -1545, -1651, -1775, -1861, -1911, -1963, -2027, -2068, -2076, -2082, -2121, -2193, -2252, -2275, -2300, -2371, -2468, -2534, -2559, -2587, -2661, -2782, -2930, -3054, -3105, -3103, -3125, -3219, -3363, -3512, -3646, -3744, -3768, -3730, -3714, -3801, -3962, -4088, -4109, -4061, -4023, -4025, -4046, -4077, -4109, -4121, -4094, -4051, -4057, -4147, -4266, -4332, -4336, -4351, -4421, -4504, -4556, -4591, -4634, -4652, -4618, -4554, -4509, -4496, -4492, -4478, -4427, -4338, -4236, -4169, -4169, -4224, -4293, -4348, -4375, -4381, -4391, -4434, -4502, -4565, -4607, -4611, -4539, -4377, -4208, -4116, -4075, -3973, -3785, -3598, -3487, -3434, -3392, -3366, -3365, -3353, -3294, -3217, -3187, -3202, -3193, -3111, -2970, -2829, -2736, -2683, -2620, -2537, -2475, -2447, -2393, -2272, -2158, -2134, -2189, -2225, -2197, -2136, -2088, -2059, -2029, -1993, -1956, -1934, -1935, -1946, -1934, -1885, -1825, -1810, -1847, -1882, -1844, -1733, -1617, -1562, -1543, -1473, -1306, -1117, -1007, -984, -974, -919, -830, -738, -662, -615, -600, -591, -556, -499, -460, -455, -447, -397, -310, -214, -116, -26, 45, 92, 119, 138, 178, 266, 365, 375, 277, 180, 176, 231, 271, 291, 312, 304, 236, 168, 187, 283, 342, 302, 225, 191, 215, 270, 315, 312, 268, 275, 402, 592, 751, 855, 954, 1078, 1241, 1453, 1713, 1973, 2181, 2318, 2389, 2381, 2325, 2320, 2418, 2520, 2508, 2431, 2411, 2440, 2454, 2481, 2577, 2696, 2773, 2831, 2907, 2989, 3070, 3192, 3356, 3491, 3561, 3610, 3690, 3796, 3887, 3947, 3977, 3971, 3965, 4049, 4231, 4393, 4451, 4452, 4456, 4435, 4398, 4417, 4497, 4560, 4561, 4519, 4433, 4308, 4224, 4229, 4235, 4140, 3973, 3843, 3765, 3669, 3520, 3357, 3215, 3087, 2959, 2856, 2781, 2708, 2630, 2564, 2518, 2483, 2472, 2489, 2487, 2429, 2332, 2231, 2130, 2041, 1980, 1922, 1823, 1678, 1527, 1392, 1279, 1191, 1130, 1064, 965, 855, 788, 768, 747, 699, 647, 606, 525, 378, 208, 88, 15, -71, -208, -359, -476, -552, -618, -697, -791, -880, -949, -987, -1005, -1035, -1100, -1186, -1252, -1274, -1269, -1271, -1282, -1272, -1230, -1180, -1153, -1139, -1114, -1083, -1092, -1148, -1197, -1188, -1149, -1134, -1144, -1159, -1197, -1258, -1250, -1099, -867, -692, -608, -543, -446, -333, -238, -166, -122, -128, -206, -327, -429, -484, -536, -631, -742, -786, -735, -651, -604, -564, -462, -315, -211, -165, -98, 17, 111, 124, 86, 58, 81, 154, 232, 247, 200, 178, 251, 403, 588, 773, 929, 1019, 1036, 1019, 1015, 1045, 1095, 1127, 1114, 1058, 995, 950, 914, 871, 848, 878, 950, 1012, 1039, 1050, 1058, 1042, 982, 911, 872, 874, 882, 867, 845, 846, 872, 895, 896, 899, 956, 1091, 1238, 1309, 1281, 1233, 1233, 1254, 1224, 1121, 997, 899, 832, 771, 704, 639, 602, 621, 696, 789, 860, 909, 964, 1033, 1095, 1147, 1200, 1251, 1260, 1199, 1080, 977, 979, 1097, 1227, 1242, 1108, 905, 762, 772, 942, 1174, 1315, 1274, 1102, 943, 903, 976, 1099, 1221, 1318, 1369, 1379, 1380, 1390, 1395, 1384, 1378, 1397, 1409, 1353, 1207, 1032, 909, 857, 824, 752, 642, 556, 535, 563, 580, 552, 497, 445, 406, 379, 391, 461, 529, 487, 293, 34, -156, -236, -249, -271, -353, -509, -700, -839, -858, -766, -637, -548, -516, -508, -479, -408, -302, -173, -46, 50, 95, 87, 44, -2, -32, -33, -23, -29, -63, -92, -63, 22, 113, 172, 231, 323, 415, 451, 439, 448, 513, 579, 586, 555, 559, 628, 708, 747, 758, 796, 883, 999, 1121, 1231, 1310, 1354, 1390, 1447, 1520, 1574, 1585, 1555, 1514, 1509, 1563, 1649, 1717, 1740, 1729, 1718, 1739, 1789, 1829, 1829, 1809, 1810, 1840, 1871, 1878, 1884, 1914, 1966, 2021, 2064, 2093, 2119, 2154, 2209, 2275, 2330, 2352, 2345, 2313, 2257, 2172, 2076, 1978, 1872, 1729, 1550, 1376, 1266, 1230, 1210, 1144, 1031, 938, 926, 993, 1078, 1120, 1093, 1011, 907, 816, 763, 760, 771, 728, 597, 420, 265, 161, 110, 98, 78, 1, -105, -182, -228, -310, -426, -509, -538, -586, -705, -849, -969, -1109, -1305, -1498, -1602, -1648, -1716, -1797, -1849, -1896, -1983, -2071, -2105, -2100, -2093, -2086, -2084, -2128, -2216, -2287, -2292, -2252, -2228, -2261, -2346, -2448, -2541, -2626, -2725, -2849, -2961, -3027, -3082, -3177, -3291, -3361, -3403, -3473, -3545, -3541, -3481, -3465, -3509, -3526, -3485, -3464, -3525, -3603, -3620, -3608, -3651, -3758, -3872, -3971, -4072, -4162, -4214, -4237, -4265, -4303, -4326, -4332, -4335, -4335, -4333, -4338, -4353, -4355, -4322, -4260, -4214, -4225, -4292, -4369, -4409, -4403, -4382, -4396, -4465, -4558, -4611, -4607, -4584, -4554, -4480, -4365, -4283, -4253, -4182, -4031, -3896, -3856, -3861, -3858, -3880, -3944, -3992, -3996, -4005, -4040, -4046, -3967, -3843, -3752, -3708, -3661, -3580, -3484, -3394, -3336, -3324, -3342, -3338, -3294, -3248, -3220, -3181, -3122, -3068, -3031, -2978, -2889, -2778, -2683, -2630, -2617, -2596, -2523, -2423, -2366, -2382, -2416, -2396, -2310, -2217, -2175, -2155, -2064, -1855, -1618, -1488, -1482, -1474, -1359, -1167, -1017, -987, -1042, -1088, -1071, -1012, -951, -897, -850, -830, -840, -832, -780, -720, -685, -652, -598, -531, -457, -358, -249, -178, -169, -179, -165, -129, -104, -92, -81, -71, -53, 15, 142, 270, 370, 462, 544, 577, 591, 657, 749, 777, 758, 806, 944, 1087, 1183, 1264, 1369, 1497, 1656, 1862, 2081, 2229, 2271, 2276, 2318, 2384, 2413, 2402, 2401, 2415, 2398, 2338, 2286, 2288, 2337, 2407, 2498, 2618, 2741, 2837, 2909, 2984, 3063, 3114, 3127, 3119, 3100, 3078, 3065, 3072, 3078, 3055, 3027, 3053, 3136, 3223, 3266, 3276, 3281, 3280, 3247, 3169, 3069, 3002, 2994, 2988, 2912, 2777, 2666, 2621, 2603, 2552, 2465, 2382, 2321, 2255, 2161, 2069, 2025, 2021, 1993, 1915, 1833, 1798, 1820, 1887, 1977, 2048, 2067, 2065, 2092, 2137, 2139, 2081, 1992, 1888, 1737, 1528, 1305, 1136, 1030, 936, 823, 724, 668, 621, 550, 522, 586, 640, 568, 431, 352, 308, 229, 155, 142, 115, 6, -105, -128, -112, -149, -206, -205, -178, -212, -276, -271, -234, -283, -379, -383, -305, -264, -272, -265, -281, -366, -430, -375, -283, -278, -314, -265, -136, -28, 25, 95, 202, 275, 275, 264, 290, 299, 226, 113, 45, 37, 42, 67, 135, 174, 117, 66, 170, 378, 514, 568, 664, 816, 909, 922, 937, 981, 1011, 1021, 1036, 1053, 1043, 1000, 942, 894, 878, 888, 906, 910, 893, 865, 863, 921, 1017, 1091, 1124, 1175, 1281, 1396, 1453, 1441, 1381, 1307, 1260, 1266, 1281, 1242, 1150, 1063, 1032, 1086, 1243, 1485, 1733, 1893, 1959, 2020, 2146, 2320, 2507, 2683, 2791, 2765, 2633, 2495, 2376, 2214, 1990, 1763, 1564, 1381, 1222, 1125, 1100, 1136, 1231, 1392, 1590, 1777, 1938, 2091, 2220, 2273, 2231, 2143, 2047, 1929, 1782, 1612, 1435, 1282, 1188, 1116, 1011, 931, 1012, 1242, 1434, 1497, 1541, 1663, 1818, 1918, 1944, 1914, 1851, 1779, 1710, 1616, 1472, 1287, 1086, 896, 755, 669, 630, 635, 680, 713, 690, 653, 688, 777, 822, 796, 787, 865, 986, 1074, 1125, 1188, 1279, 1362, 1414, 1442, 1452, 1442, 1421, 1402, 1365, 1303, 1242, 1222, 1238, 1243, 1204, 1147, 1136, 1211, 1337, 1428, 1421, 1338, 1241, 1183, 1171, 1159, 1067, 850, 529, 185, -83, -211, -211, -187, -236, -349, -429, -407, -292, -151, -72, -129, -316, -546, -745, -899, -1026, -1156, -1350, -1639, -1946, -2131, -2145, -2084, -2076, -2151, -2236, -2249, -2186, -2101, -2053, -2045, -2053, -2057, -2070, -2095, -2110, -2086, -2037, -2002, -1988, -1960, -1918, -1889, -1878, -1869, -1856, -1845, -1847, -1879, -1934, -1952, -1880, -1751, -1667, -1672, -1683, -1603, -1438, -1277, -1164, -1054, -923, -821, -794, -800, -751, -622, -482, -413, -407, -388, -300, -154, -1, 139, 292, 465, 610, 677, 696, 746, 850, 950, 990, 982, 977, 1011, 1086, 1175, 1237, 1263, 1287, 1357, 1463, 1557, 1616, 1667, 1735, 1801, 1834, 1851, 1884, 1931, 1954, 1958, 1983, 2037, 2080, 2096, 2130, 2225, 2335, 2385, 2364, 2324, 2307, 2318, 2336, 2337, 2313, 2276, 2233, 2170, 2086, 2023, 2030, 2080, 2085, 1999, 1864, 1727, 1588, 1452, 1359, 1290, 1157, 958, 810, 777, 787, 761, 724, 706, 678, 621, 573, 572, 578, 540, 470, 402, 320, 211, 115, 56, -18, -166, -342, -459, -514, -560, -614, -668, -731, -825, -937, -1037, -1126, -1223, -1337, -1453, -1549, -1620, -1663, -1680, -1686, -1712, -1763, -1808, -1811, -1783, -1767, -1779, -1811, -1873, -1983, -2106, -2177, -2188, -2220, -2333, -2502, -2647, -2734, -2786, -2839, -2899, -2956, -3003, -3031, -3057, -3111, -3198, -3286, -3332, -3353, -3398, -3480, -3553, -3585, -3606, -3657, -3724, -3749, -3714, -3666, -3642, -3652, -3697, -3790, -3894, -3933, -3900, -3905, -4009, -4148, -4239, -4288, -4315, -4314, -4321, -4391, -4490, -4534, -4517, -4496, -4487, -4484, -4504, -4557, -4568, -4474, -4318, -4187, -4079, -3935, -3769, -3663, -3617, -3521, -3341, -3195, -3199, -3298, -3376, -3401, -3415, -3423, -3402, -3385, -3438, -3551, -3614, -3568, -3457, -3361, -3300, -3259, -3226, -3176, -3045, -2823, -2624, -2565, -2600, -2574, -2436, -2281, -2195, -2172, -2175, -2184, -2177, -2118, -2011, -1901, -1834, -1817, -1812, -1758, -1626, -1460, -1337, -1289, -1276, -1236, -1166, -1121, -1144, -1211, -1261, -1299, -1381, -1509, -1612, -1657, -1691, -1720, -1695, -1615, -1546, -1493, -1403, -1264, -1129, -1013, -879, -708, -543, -416, -317, -223, -136, -71, -28, 19, 89, 168, 227, 266, 290, 292, 273, 269, 327, 417, 446, 379, 307, 343, 467, 551, 545, 524, 572, 669, 752, 783, 784, 811, 892, 979, 1015, 1032, 1119, 1276, 1409, 1476, 1546, 1680, 1854, 2003, 2104, 2180, 2247, 2303, 2336, 2324, 2251, 2141, 2045, 1969, 1866, 1723, 1590, 1511, 1469, 1446, 1462, 1544, 1671, 1789, 1881, 1967, 2076, 2202, 2315, 2380, 2386, 2360, 2349, 2367, 2382, 2386, 2406, 2463, 2536, 2589, 2611, 2613, 2602, 2583, 2564, 2538, 2481, 2380, 2235, 2061, 1881, 1713, 1569, 1443, 1337, 1275, 1269, 1293, 1301, 1275, 1262, 1296, 1351, 1364, 1325, 1284, 1259, 1210, 1116, 1030, 1006, 1020, 1019, 1003, 1010, 1067, 1168, 1277, 1335, 1318, 1279, 1293, 1362, 1401, 1357, 1259, 1169, 1092, 1015, 959, 964, 1031, 1135, 1247, 1331, 1369, 1408, 1512, 1649, 1719, 1694, 1646, 1624, 1594, 1522, 1443, 1412, 1426, 1463, 1518, 1605, 1716, 1837, 1965, 2093, 2202, 2290, 2375, 2431, 2408, 2310, 2208, 2127, 2022, 1862, 1680, 1530, 1447, 1442, 1491, 1529, 1514, 1481, 1496, 1561, 1602, 1584, 1550, 1553, 1595, 1649, 1712, 1774, 1821, 1877, 1981, 2104, 2169, 2155, 2119, 2114, 2138, 2150, 2113, 2023, 1912, 1800, 1671, 1505, 1327, 1194, 1124, 1083, 1036, 989, 973, 992, 1025, 1047, 1039, 992, 937, 934, 998, 1056, 1028, 933, 876, 933, 1078, 1213, 1258, 1208, 1124, 1070, 1056, 1041, 962, 800, 602, 440, 313, 160, -15, -120, -128, -138, -198, -217, -112, 61, 198, 255, 262, 263, 288, 327, 320, 226, 89, -4, -33, -51, -98, -142, -137, -78, 10, 119, 237, 337, 398, 434, 457, 441, 349, 202, 50, -82, -208, -303, -338, -339, -357, -357, -263, -76, 135, 354, 603, 833, 945, 931, 883, 871, 854, 760, 594, 414, 269, 172, 139, 175, 260, 376, 531, 730, 931, 1081, 1193, 1321, 1461, 1529, 1473, 1341, 1221, 1149, 1087, 984, 827, 663, 575, 589, 634, 641, 618, 617, 645, 668, 650, 578, 473, 375, 318, 294, 271, 248, 249, 279, 312, 319, 314, 330, 374, 393, 348, 263, 197, 152, 54, -137, -379, -603, -802, -995, -1173, -1304, -1377, -1421, -1455, -1480, -1503, -1542, -1601, -1668, -1760, -1906, -2095, -2282, -2438, -2567, -2669, -2734, -2755, -2745, -2719, -2676, -2608, -2514, -2419, -2353, -2335, -2349, -2366, -2363, -2360, -2401, -2503, -2647, -2788, -2894, -2960, -2994, -2998, -2967, -2904, -2816, -2730, -2669, -2618, -2545, -2449, -2393, -2419, -2495, -2554, -2563, -2536, -2509, -2502, -2482, -2398, -2260, -2136, -2050, -1950, -1807, -1676, -1587, -1481, -1303, -1076, -864, -730, -714, -790, -857, -822, -694, -560, -497, -512, -547, -514, -360, -128, 72, 186, 257, 354, 484, 610, 717, 804, 850, 854, 860, 899, 944, 982, 1060, 1194, 1323, 1402, 1495, 1668, 1896, 2102, 2247, 2353, 2437, 2494, 2518, 2520, 2505, 2470, 2429, 2391, 2349, 2301, 2260, 2236, 2220, 2226, 2284, 2385, 2490, 2588, 2684, 2757, 2782, 2791, 2842, 2931, 3003, 3005, 2929, 2809, 2715, 2715, 2777, 2779, 2640, 2434, 2308, 2291, 2274, 2175, 2038, 1933, 1862, 1785, 1686, 1573, 1465, 1384, 1323, 1255, 1179, 1115, 1077, 1045, 999, 940, 881, 834, 821, 843, 862, 835, 762, 678, 595, 500, 402, 341, 308, 214, 0, -292, -568, -799, -1013, -1234, -1465, -1698, -1922, -2100, -2199, -2223, -2217, -2215, -2197, -2114, -1965, -1825, -1763, -1766, -1790, -1849, -2000, -2232, -2440, -2551, -2626, -2779, -3020, -3245, -3385, -3464, -3534, -3593, -3619, -3608, -3584, -3564, -3562, -3593, -3655, -3707, -3741, -3797, -3913, -4046, -4108, -4066, -3979, -3917, -3901, -3899, -3858, -3758, -3628, -3521, -3482, -3493, -3502, -3469, -3416, -3398, -3440, -3512, -3574, -3623, -3685, -3760, -3793, -3733, -3600, -3454, -3320, -3166, -2971, -2762, -2584, -2455, -2360, -2264, -2142, -2016, -1927, -1880, -1835, -1758, -1653, -1540, -1420, -1297, -1191, -1116, -1054, -962, -843, -747, -712, -703, -658, -560, -463, -414, -397, -355, -249, -87, 92, 253, 392, 525, 660, 787, 910, 1045, 1182, 1286, 1335, 1347, 1342, 1351, 1417, 1552, 1704, 1810, 1881, 1966, 2076, 2169, 2216, 2242, 2271, 2307, 2342, 2369, 2382, 2382, 2397, 2457, 2538, 2572, 2535, 2479, 2463, 2494, 2525, 2501, 2392, 2252, 2160, 2121, 2049, 1892, 1711, 1608, 1597, 1618, 1643, 1710, 1848, 2011, 2125, 2160, 2131, 2064, 1986, 1926, 1876, 1757, 1519, 1240, 1056, 998, 958, 861, 768, 744, 741, 680, 590, 551, 541, 464, 312, 169, 55, -79, -214, -274, -282, -332, -403, -388, -269, -121, 0, 108, 209, 296, 360, 387, 345, 233, 99, -18, -145, -330, -554, -755, -902, -1004, -1042, -998, -917, -841, -739, -570, -391, -291, -260, -201, -82, 23, 64, 87, 154, 242, 292, 315, 364, 461, 597, 768, 947, 1067, 1080, 1042, 1058, 1147, 1213, 1176, 1058, 926, 820, 763, 783, 868, 972, 1047, 1094, 1148, 1241, 1393, 1590, 1776, 1887, 1898, 1859, 1848, 1906, 1988, 2000, 1896, 1737, 1647, 1689, 1780, 1809, 1752, 1683, 1652, 1649, 1639, 1594, 1496, 1348, 1199, 1098, 1039, 979, 932, 943, 993, 984, 892, 815, 838, 910, 931, 868, 751, 614, 481, 360, 233, 72, -123, -330, -512, -645, -698, -659, -564, -481, -455, -471, -507, -565, -654, -775, -950, -1199, -1495, -1752, -1924, -2039, -2140, -2211, -2233, -2236, -2237, -2171, -2013, -1880, -1896, -1998, -2039, -2018, -2038, -2121, -2225, -2353, -2534, -2725, -2857, -2917, -2939, -2945, -2940, -2929, -2907, -2851, -2749, -2637, -2582, -2609, -2678, -2736, -2785, -2844, -2904, -2940, -2966, -3012, -3050, -3024, -2935, -2823, -2706, -2587, -2519, -2523, -2519, -2415, -2233, -2077, -2022, -2072, -2181, -2267, -2242, -2099, -1940, -1882, -1910, -1906, -1786, -1569, -1314, -1092, -963, -921, -867, -739, -597, -513, -460, -411, -396, -418, -415, -359, -284, -204, -93, 28, 109, 158, 257, 442, 652, 820, 951, 1061, 1124, 1158, 1243, 1384, 1464, 1447, 1436, 1506, 1590, 1634, 1702, 1837, 1976, 2064, 2137, 2255, 2406, 2546, 2658, 2738, 2768, 2757, 2779, 2889, 3025, 3048, 2922, 2776, 2746, 2816, 2860, 2802, 2674, 2542, 2464, 2465, 2511, 2516, 2473, 2457, 2502, 2546, 2546, 2539, 2562, 2599, 2629, 2655, 2662, 2616, 2527, 2442, 2381, 2302, 2191, 2102, 2092, 2128, 2135, 2098, 2072, 2087, 2103, 2080, 2027, 1976, 1917, 1818, 1668, 1468, 1216, 943, 712, 569, 472, 337, 150, -16, -81, -21, 108, 253, 401, 552, 673, 738, 795, 888, 955, 889, 704, 530, 448, 402, 303, 155, 17, -84, -153, -176, -171, -212, -332, -459, -531, -582, -648, -695, -713, -759, -846, -911, -916, -868, -739, -503, -242, -66, 26, 132, 307, 513, 696, 823, 871, 834, 755, 686, 641, 578, 465, 342, 258, 215, 186, 181, 236, 331, 395, 398, 410, 495, 634, 766, 850, 878, 882, 921, 1027, 1168, 1316, 1498, 1710, 1885, 1988, 2072, 2199, 2332, 2389, 2345, 2236, 2092, 1909, 1693, 1478, 1284, 1104, 936, 800, 719, 702, 738, 788, 816, 831, 876, 956, 1020, 1023, 986, 939, 900, 876, 878, 904, 931, 955, 1005, 1093, 1181, 1235, 1264, 1290, 1281, 1183, 998, 790, 608, 437, 249, 59, -116, -288, -451, -540, -523, -469, -487, -595, -716, -786, -808, -830, -896, -1026, -1189, -1335, -1431, -1496, -1547, -1556, -1496, -1408, -1346, -1291, -1180, -1027, -929, -956, -1092, -1271, -1440, -1565, -1675, -1845, -2120, -2434, -2652, -2695, -2597, -2465, -2385, -2379, -2419, -2447, -2415, -2326, -2264, -2311, -2451, -2576, -2626, -2634, -2612, -2528, -2397, -2297, -2231, -2105, -1866, -1579, -1339, -1183, -1101, -1075, -1085, -1127, -1204, -1310, -1414, -1498, -1578, -1663, -1722, -1706, -1600, -1430, -1242, -1045, -824, -579, -337, -125, 48, 174, 236, 255, 287, 362, 459, 567, 688, 813, 928, 1049, 1224, 1467, 1739, 1995, 2216, 2379, 2451, 2433, 2391, 2379, 2369, 2299, 2168, 2032, 1939, 1895, 1906, 1983, 2109, 2252, 2396, 2547, 2699, 2831, 2938, 3032, 3087, 3060, 2954, 2838, 2767, 2727, 2663, 2545, 2393, 2277, 2264, 2334, 2386, 2359, 2288, 2242, 2222, 2176, 2076, 1928, 1741, 1527, 1325, 1180, 1080, 983, 893, 839, 805, 733, 634, 573, 563, 544, 465, 357, 254, 138, -39, -278, -536, -774, -982, -1155, -1296, -1413, -1496, -1510, -1448, -1352, -1282, -1252, -1232, -1219, -1253, -1372, -1570, -1799, -2017, -2214, -2382, -2513, -2613, -2698, -2768, -2794, -2769, -2727, -2692, -2674, -2673, -2692, -2703, -2686, -2681, -2755, -2908, -3067, -3176, -3244, -3298, -3331, -3336, -3324, -3287, -3184, -3018, -2868, -2782, -2706, -2601, -2528, -2567, -2690, -2803, -2880, -2966, -3083, -3199, -3272, -3296, -3287, -3256, -3204, -3123, -3009, -2874, -2745, -2618, -2452, -2236, -2039, -1949, -1982, -2070, -2136, -2136, -2068, -1981, -1950, -2006, -2061, -1991, -1788, -1563, -1402, -1281, -1161, -1055, -968, -879, -808, -811, -883, -950, -973, -996, -1049, -1072, -989, -822, -663, -545, -397, -169, 83, 258, 346, 420, 520, 610, 642, 617, 551, 486, 468, 496, 519, 515, 535, 605, 671, 701, 747, 863, 1012, 1114, 1135, 1111, 1097, 1108, 1127, 1132, 1121, 1097, 1066, 1055, 1099, 1196, 1284, 1292, 1218, 1131, 1087, 1059, 988, 867, 738, 631, 546, 481, 434, 391, 368, 385, 430, 459, 468, 495, 555, 608, 618, 585, 535, 487, 458, 432, 375, 252, 81, -92, -237, -350, -422, -442, -448, -514, -653, -790, -857, -893, -969, -1085, -1186, -1261, -1353, -1438, -1442, -1365, -1309, -1314, -1281, -1120, -886, -716, -637, -578, -507, -496, -600, -759, -873, -928, -999, -1144, -1343, -1532, -1664, -1733, -1760, -1773, -1773, -1736, -1658, -1568, -1513, -1493, -1468, -1415, -1364, -1347, -1353, -1332, -1244, -1103, -959, -858, -807, -763, -683, -565, -458, -396, -371, -355, -332, -303, -270, -242, -245, -289, -335, -343, -338, -360, -385, -326, -165, 22, 170, 308, 489, 688, 824, 884, 934, 1030, 1148, 1242, 1299, 1334, 1359, 1404, 1496, 1628, 1752, 1820, 1816, 1782, 1785, 1855, 1934, 1934, 1838, 1727, 1693, 1744, 1813, 1843, 1843, 1871, 1960, 2093, 2229, 2341, 2428, 2500, 2568, 2624, 2649, 2643, 2643, 2654, 2614, 2474, 2280, 2135, 2065, 2017, 1960, 1922, 1922, 1927, 1896, 1840, 1812, 1848, 1911, 1939, 1909, 1846, 1780, 1722, 1689, 1689, 1679, 1605, 1480, 1369, 1309, 1291, 1282, 1235, 1119, 984, 918, 920, 901, 821, 713, 607, 491, 375, 297, 279, 315, 370, 395, 351, 262, 199, 197, 197, 120, -32, -188, -319, -447, -573, -654, -690, -717, -741, -746, -755, -805, -891, -977, -1054, -1144, -1249, -1354, -1452, -1540, -1591, -1575, -1502, -1418, -1347, -1278, -1201, -1118, -1021, -901, -788, -728, -727, -746, -758, -764, -777, -797, -839, -912, -1007, -1104, -1189, -1253, -1256, -1164, -1018, -911, -857, -780, -628, -451, -326, -278, -284, -300, -271, -165, -24, 67, 97, 144, 269, 429, 556, 656, 750, 809, 812, 809, 842, 881, 888, 863, 804, 693, 566, 512, 570, 679, 751, 762, 760, 802, 929, 1131, 1340, 1472, 1518, 1548, 1607, 1658, 1674, 1679, 1697, 1707, 1700, 1706, 1737, 1750, 1724, 1715, 1785, 1907, 1993, 2006, 1981, 1954, 1936, 1937, 1944, 1920, 1866, 1835, 1837, 1795, 1684, 1592, 1606, 1673, 1689, 1644, 1617, 1649, 1704, 1748, 1780, 1772, 1685, 1551, 1426, 1307, 1154, 993, 871, 765, 635, 513, 451, 441, 452, 484, 540, 581, 584, 591, 666, 761, 769, 675, 551, 428, 293, 185, 149, 136, 59, -46, -89, -76, -85, -115, -94, -24, -11, -100, -204, -236, -228, -263, -344, -422, -477, -507, -490, -422, -349, -316, -297, -233, -121, -6, 93, 189, 257, 264, 243, 249, 258, 236, 208, 194, 139, 22, -60, -34, 33, 47, 0, -53, -81, -61, 44, 222, 363, 387, 367, 419, 525, 575, 562, 572, 627, 674, 702, 738, 754, 713, 656, 651, 702, 755, 768, 751, 741, 757, 774, 747, 674, 618, 639, 726, 800, 820, 822, 854, 907, 942, 958, 1001, 1075, 1122, 1119, 1114, 1148, 1176, 1141, 1072, 1034, 1031, 1030, 1020, 1005, 962, 883, 809, 776, 765, 730, 682, 658, 666, 657, 616, 578, 568, 562, 526, 473, 435, 446, 489, 492, 401, 258, 154, 88, -11, -153, -259, -303, -339, -416, -507, -565, -579, -564, -541, -525, -527, -547, -565, -570, -569, -575, -593, -618, -656, -727, -818, -883, -895, -885, -900, -944, -994, -1031, -1040, -1024, -1006, -1026, -1103, -1219, -1342, -1455, -1551, -1636, -1734, -1852, -1954, -1965, -1874, -1766, -1706, -1663, -1590, -1509, -1442, -1358, -1260, -1220, -1263, -1321, -1357, -1412, -1510, -1619, -1718, -1833, -1966, -2072, -2125, -2138, -2133, -2110, -2068, -2020, -1965, -1897, -1836, -1816, -1818, -1789, -1722, -1680, -1698, -1749, -1811, -1893, -1972, -1982, -1905, -1802, -1742, -1712, -1659, -1574, -1487, -1421, -1381, -1375, -1409, -1459, -1513, -1582, -1651, -1667, -1619, -1560, -1535, -1513, -1458, -1385, -1341, -1337, -1348, -1364, -1383, -1398, -1399, -1409, -1443, -1470, -1449, -1398, -1353, -1300, -1216, -1121, -1048, -988, -906, -800, -719, -707, -748, -800, -823, -818, -817, -855, -915, -939, -900, -836, -785, -722, -639, -582, -579, -580, -553, -545, -593, -664, -720, -789, -897, -996, -1009, -946, -888, -874, -872, -852, -813, -744, -645, -563, -525, -493, -438, -396, -396, -413, -424, -463, -534, -579, -553, -496, -463, -466, -498, -579, -702, -796, -812, -822, -905, -1007, -1039, -1032, -1073, -1140, -1131, -1043, -979, -989, -1022, -1039, -1084, -1181, -1277, -1326, -1358, -1407, -1457, -1493, -1531, -1557, -1528, -1446, -1375, -1349, -1354, -1372, -1407, -1435, -1421, -1401, -1457, -1580, -1650, -1625, -1609, -1661, -1685, -1629, -1581, -1591, -1548, -1398, -1250, -1208, -1215, -1192, -1153, -1147, -1156, -1154, -1171, -1250, -1357, -1413, -1414, -1424, -1455, -1433, -1306, -1128, -993, -928, -872, -746, -548, -357, -249, -232, -247, -245, -225, -205, -186, -160, -140, -143, -145, -110, -38, 36, 81, 100, 119, 164, 257, 369, 442, 445, 410, 412, 483, 602, 726, 822, 881, 928, 1017, 1158, 1284, 1349, 1393, 1436, 1414, 1310, 1227, 1232, 1247, 1205, 1182, 1258, 1380, 1452, 1491, 1570, 1686, 1776, 1833, 1905, 1964, 1934, 1833, 1767, 1778, 1798, 1773, 1755, 1789, 1843, 1856, 1831, 1810, 1807, 1813, 1839, 1883, 1904, 1870, 1804, 1745, 1680, 1592, 1507, 1451, 1412, 1373, 1358, 1395, 1457, 1497, 1506, 1524, 1579, 1655, 1722, 1762, 1769, 1729, 1645, 1542, 1461, 1420, 1419, 1430, 1415, 1351, 1263, 1215, 1251, 1349, 1440, 1470, 1436, 1360, 1266, 1187, 1166, 1198, 1207, 1135, 1031, 981, 1011, 1114, 1291, 1500, 1638, 1657, 1646, 1712, 1828, 1885, 1849, 1765, 1656, 1503, 1342, 1270, 1303, 1342, 1319, 1280, 1288, 1319, 1336, 1398, 1557, 1708, 1707, 1595, 1548, 1613, 1674, 1686, 1700, 1712, 1664, 1607, 1656, 1790, 1871, 1832, 1763, 1760, 1810, 1864, 1918, 1977, 2008, 2005, 2031, 2138, 2296, 2445, 2547, 2579, 2542, 2506, 2538, 2617, 2680, 2717, 2750, 2772, 2781, 2805, 2860, 2912, 2921, 2887, 2824, 2744, 2649, 2553, 2465, 2380, 2306, 2265, 2280, 2324, 2340, 2313, 2312, 2408, 2567, 2683, 2724, 2748, 2770, 2751, 2678, 2596, 2518, 2425, 2326, 2247, 2172, 2071, 1942, 1810, 1700, 1638, 1643, 1689, 1721, 1705, 1650, 1590, 1561, 1552, 1511, 1408, 1281, 1175, 1067, 917, 732, 569, 441, 315, 189, 125, 146, 172, 125, 23, -71, -145, -201, -233, -289, -466, -745, -996, -1148, -1254, -1354, -1422, -1471, -1574, -1749, -1905, -1979, -2023, -2110, -2220, -2293, -2338, -2405, -2488, -2551, -2595, -2626, -2613, -2529, -2414, -2326, -2274, -2242, -2227, -2216, -2176, -2099, -2037, -2048, -2131, -2209, -2219, -2178, -2159, -2166, -2133, -2045, -1977, -1963, -1935, -1832, -1701, -1626, -1611, -1613, -1607, -1581, -1523, -1444, -1380, -1353, -1346, -1311, -1198, -1012, -822, -658, -499, -359, -297, -286, -209, -59, 19, -43, -123, -107, -46, -27, -45, -54, -56, -74, -95, -85, -38, 20, 59, 73, 72, 73, 99, 153, 214, 262, 290, 303, 309, 336, 406, 497, 572, 621, 661, 695, 713, 718, 716, 690, 611, 476, 326, 213, 165, 154, 115, 36, -38, -67, -55, -16, 21, 16, -56, -165, -254, -305, -321, -289, -233, -233, -348, -501, -557, -484, -400, -422, -518, -576, -557, -518, -510, -527, -548, -593, -678, -773, -861, -969, -1121, -1282, -1413, -1510, -1586, -1629, -1639, -1639, -1640, -1641, -1646, -1654, -1646, -1609, -1567, -1542, -1557, -1640, -1785, -1923, -2002, -2061, -2154, -2252, -2292, -2289, -2308, -2343, -2328, -2242, -2151, -2131, -2166, -2197, -2198, -2221, -2315, -2469, -2619, -2730, -2813, -2891, -2977, -3059, -3112, -3120, -3094, -3064, -3023, -2955, -2876, -2819, -2789, -2764, -2755, -2757, -2729, -2658, -2608, -2644, -2727, -2767, -2751, -2741, -2771, -2805, -2810, -2788, -2727, -2607, -2482, -2430, -2427, -2371, -2250, -2182, -2231, -2313, -2330, -2308, -2330, -2396, -2436, -2416, -2370, -2320, -2249, -2148, -2027, -1885, -1708, -1521, -1383, -1313, -1256, -1170, -1085, -1060, -1089, -1133, -1177, -1217, -1242, -1258, -1294, -1344, -1358, -1326, -1289, -1255, -1192, -1095, -998, -910, -827, -764, -722, -673, -613, -590, -624, -646, -582, -457, -366, -358, -375, -354, -300, -249, -205, -172, -173, -223, -272, -260, -189, -117, -73, -54, -66, -114, -144, -94, 12, 89, 89, 38, -26, -60, -38, 10, 20, -26, -82, -114, -126, -111, -56, 6, 20, -17, -44, -22, -1, -43, -142, -252, -344, -424, -474, -477, -469, -493, -531, -507, -409, -303, -210, -76, 78, 119, 0, -136, -155, -116, -145, -266, -424, -585, -725, -800, -791, -739, -697, -673, -643, -595, -523, -419, -308, -253, -286, -347, -359, -320, -276, -241, -195, -155, -156, -178, -150, -35, 113, 221, 265, 263, 240, 225, 252, 316, 367, 345, 258, 150, 61, 8, 8, 69, 159, 231, 294, 404, 583, 791, 968, 1088, 1163, 1240, 1357, 1492, 1589, 1625, 1625, 1613, 1597, 1597, 1633, 1684, 1716, 1722, 1716, 1718, 1738, 1782, 1839, 1893, 1936, 1983, 2037, 2064, 2052, 2044, 2080, 2117, 2116, 2119, 2175, 2249, 2296, 2357, 2475, 2601, 2679, 2759, 2903, 3070, 3198, 3292, 3396, 3501, 3568, 3606, 3662, 3739, 3779, 3730, 3612, 3495, 3417, 3356, 3286, 3204, 3116, 3038, 3008, 3052, 3146, 3232, 3302, 3390, 3514, 3650, 3762, 3829, 3849, 3842, 3842, 3845, 3804, 3693, 3558, 3458, 3389, 3314, 3251, 3244, 3303, 3369, 3411, 3457, 3531, 3597, 3612, 3574, 3511, 3441, 3362, 3259, 3108, 2890, 2634, 2414, 2284, 2226, 2186, 2137, 2091, 2069, 2099, 2209, 2385, 2562, 2685, 2741, 2745, 2724, 2716, 2719, 2679, 2549, 2356, 2187, 2088, 2038, 1994, 1950, 1926, 1929, 1953, 1972, 1951, 1873, 1763, 1653, 1527, 1367, 1218, 1121, 1031, 901, 780, 724, 715, 739, 855, 1065, 1257, 1348, 1390, 1456, 1540, 1597, 1616, 1592, 1495, 1315, 1109, 938, 800, 667, 550, 474, 420, 365, 356, 435, 553, 612, 586, 536, 512, 517, 535, 551, 518, 398, 235, 116, 73, 80, 144, 294, 459, 529, 514, 539, 645, 746, 756, 678, 553, 392, 194, -11, -208, -405, -609, -780, -878, -908, -897, -864, -838, -841, -851, -832, -810, -849, -959, -1092, -1220, -1350, -1490, -1620, -1738, -1850, -1934, -1951, -1907, -1854, -1805, -1714, -1573, -1454, -1421, -1437, -1435, -1420, -1443, -1504, -1567, -1634, -1744, -1867, -1918, -1879, -1836, -1847, -1873, -1858, -1799, -1708, -1598, -1499, -1454, -1462, -1481, -1496, -1523, -1549, -1535, -1476, -1437, -1432, -1385, -1239, -1051, -893, -766, -647, -545, -453, -339, -216, -156, -200, -298, -361, -339, -242, -140, -103, -134, -167, -126, 0, 147, 235, 248, 244, 268, 292, 290, 301, 363, 421, 406, 358, 391, 530, 691, 791, 829, 850, 893, 955, 1004, 1015, 999, 977, 947, 884, 784, 674, 599, 584, 607, 622, 616, 623, 662, 702, 717, 706, 671, 581, 439, 287, 171, 91, 25, -50, -151, -256, -313, -288, -210, -127, -57, -2, 8, -55, -173, -284, -375, -495, -676, -890, -1092, -1259, -1380, -1440, -1447, -1433, -1416, -1382, -1330, -1278, -1244, -1217, -1204, -1253, -1391, -1573, -1733, -1854, -1971, -2114, -2285, -2453, -2557, -2553, -2480, -2426, -2423, -2423, -2386, -2331, -2300, -2313, -2369, -2470, -2597, -2702, -2762, -2806, -2851, -2869, -2845, -2825, -2850, -2877, -2836, -2749, -2696, -2714, -2762, -2801, -2865, -2988, -3145, -3289, -3415, -3541, -3650, -3707, -3695, -3624, -3504, -3348, -3187, -3051, -2929, -2800, -2678, -2619, -2650, -2729, -2814, -2896, -2987, -3067, -3112, -3126, -3128, -3115, -3066, -2995, -2928, -2871, -2816, -2779, -2767, -2745, -2712, -2719, -2805, -2927, -3026, -3104, -3193, -3269, -3280, -3233, -3176, -3099, -2951, -2755, -2591, -2465, -2302, -2092, -1926, -1856, -1833, -1812, -1814, -1863, -1938, -2012, -2076, -2128, -2167, -2198, -2227, -2241, -2222, -2183, -2145, -2087, -1976, -1840, -1762, -1779, -1857, -1938, -1973, -1921, -1794, -1686, -1692, -1766, -1760, -1598, -1361, -1172, -1059, -972, -883, -791, -684, -554, -453, -453, -536, -604, -609, -612, -665, -722, -712, -663, -642, -635, -574, -454, -353, -319, -319, -300, -256, -214, -179, -154, -138, -120, -76, -9, 56, 126, 229, 352, 451, 511, 575, 688, 827, 936, 992, 1012, 1026, 1042, 1066, 1097, 1113, 1087, 1027, 977, 976, 1014, 1037, 994, 906, 857, 892, 948, 953, 918, 915, 967, 1043, 1102, 1130, 1141, 1168, 1235, 1329, 1421, 1503, 1580, 1651, 1726, 1810, 1885, 1928, 1960, 2010, 2065, 2077, 2034, 1967, 1895, 1817, 1748, 1707, 1696, 1682, 1633, 1550, 1467, 1417, 1389, 1362, 1337, 1336, 1351, 1368, 1414, 1517, 1639, 1717, 1763, 1867, 2053, 2235, 2325, 2348, 2382, 2426, 2404, 2290, 2168, 2124, 2137, 2120, 2031, 1916, 1828, 1766, 1695, 1603, 1507, 1430, 1378, 1329, 1259, 1176, 1109, 1080, 1083, 1106, 1136, 1164, 1204, 1290, 1415, 1533, 1597, 1630, 1671, 1730, 1795, 1850, 1883, 1871, 1813, 1741, 1694, 1678, 1664, 1616, 1525, 1429, 1357, 1297, 1244, 1230, 1269, 1312, 1296, 1241, 1211, 1236, 1285, 1315, 1319, 1315, 1340, 1413, 1524, 1651, 1782, 1905, 2010, 2098, 2180, 2242, 2254, 2209, 2128, 2037, 1938, 1822, 1677, 1514, 1379, 1308, 1288, 1274, 1260, 1292, 1393, 1528, 1646, 1739, 1821, 1887, 1912, 1888, 1842, 1805, 1784, 1759, 1689, 1566, 1431, 1353, 1346, 1358, 1353, 1359, 1426, 1540, 1634, 1671, 1685, 1732, 1806, 1855, 1846, 1799, 1740, 1661, 1550, 1442, 1379, 1349, 1308, 1226, 1122, 1031, 988, 989, 983, 926, 844, 796, 796, 798, 774, 757, 783, 831, 856, 861, 889, 976, 1089, 1164, 1168, 1128, 1097, 1083, 1058, 992, 904, 826, 757, 684, 623, 606, 634, 668, 679, 661, 623, 569, 501, 432, 385, 364, 342, 290, 215, 163, 160, 205, 290, 399, 496, 557, 613, 715, 845, 943, 975, 959, 925, 884, 838, 779, 702, 594, 459, 321, 207, 133, 97, 80, 77, 87, 109, 146, 198, 269, 340, 381, 371, 321, 273, 269, 307, 336, 307, 235, 186, 213, 307, 426, 528, 579, 553, 470, 404, 418, 483, 526, 503, 397, 224, 62, 23, 113, 208, 200, 104, -6, -87, -111, -59, 48, 121, 84, -27, -110, -109, -63, -48, -110, -256, -431, -542, -559, -563, -632, -744, -817, -823, -800, -783, -781, -806, -858, -902, -900, -866, -849, -850, -838, -822, -855, -932, -968, -923, -861, -855, -882, -873, -821, -777, -763, -757, -751, -753, -756, -759, -792, -856, -884, -833, -744, -687, -670, -635, -551, -447, -375, -347, -324, -275, -211, -161, -122, -85, -66, -78, -93, -66, 1, 77, 131, 154, 157, 169, 232, 348, 452, 484, 465, 465, 505, 535, 533, 534, 572, 634, 700, 754, 784, 802, 859, 976, 1087, 1122, 1094, 1081, 1102, 1103, 1049, 983, 951, 928, 865, 773, 721, 729, 756, 758, 750, 769, 839, 955, 1089, 1181, 1172, 1081, 1001, 1005, 1058, 1065, 977, 818, 647, 509, 426, 395, 379, 342, 270, 193, 148, 149, 165, 150, 87, 1, -71, -142, -243, -370, -479, -553, -623, -706, -775, -803, -814, -846, -901, -940, -937, -915, -927, -995, -1101, -1206, -1297, -1376, -1454, -1543, -1653, -1775, -1896, -2018, -2137, -2216, -2247, -2269, -2331, -2407, -2436, -2420, -2416, -2454, -2504, -2531, -2551, -2582, -2614, -2620, -2620, -2651, -2712, -2779, -2838, -2893, -2949, -3006, -3077, -3167, -3269, -3361, -3424, -3448, -3447, -3448, -3473, -3514, -3543, -3535, -3495, -3451, -3431, -3435, -3442, -3437, -3416, -3387, -3361, -3351, -3365, -3404, -3456, -3493, -3495, -3465, -3435, -3440, -3471, -3493, -3484, -3454, -3421, -3387, -3348, -3314, -3298, -3294, -3275, -3227, -3176, -3147, -3132, -3100, -3034, -2957, -2896, -2851, -2806, -2768, -2757, -2772, -2773, -2729, -2651, -2591, -2587, -2615, -2620, -2581, -2523, -2463, -2388, -2299, -2216, -2147, -2082, -2017, -1952, -1882, -1808, -1764, -1755, -1744, -1702, -1646, -1607, -1597, -1603, -1598, -1556, -1490, -1443, -1431, -1409, -1344, -1242, -1121, -996, -893, -823, -764, -683, -584, -497, -441, -411, -396, -361, -281, -166, -60, 11, 45, 50, 42, 59, 126, 224, 293, 307, 292, 299, 349, 423, 495, 558, 606, 624, 618, 630, 700, 804, 877, 890, 879, 904, 978, 1067, 1113, 1109, 1104, 1146, 1209, 1237, 1219, 1192, 1182, 1187, 1205, 1243, 1288, 1319, 1331, 1341, 1346, 1318, 1271, 1255, 1271, 1259, 1207, 1171, 1177, 1177, 1152, 1146, 1185, 1232, 1263, 1284, 1309, 1349, 1420, 1512, 1586, 1621, 1628, 1639, 1651, 1652, 1643, 1627, 1600, 1569, 1568, 1621, 1685, 1708, 1702, 1707, 1715, 1690, 1639, 1594, 1561, 1525, 1486, 1440, 1386, 1343, 1331, 1325, 1284, 1221, 1197, 1232, 1268, 1240, 1161, 1094, 1054, 1011, 959, 914, 884, 871, 885, 932, 986, 1033, 1078, 1114, 1127, 1136, 1152, 1152, 1114, 1061, 1003, 918, 811, 712, 627, 540, 469, 441, 424, 365, 283, 238, 251, 290, 330, 373, 415, 434, 418, 387, 373, 385, 402, 397, 359, 315, 307, 337, 363, 358, 354, 384, 424, 457, 505, 566, 601, 590, 568, 553, 523, 474, 441, 446, 465, 465, 441, 417, 412, 408, 376, 332, 321, 346, 353, 331, 316, 308, 263, 202, 211, 309, 407, 441, 450, 484, 534, 563, 579, 612, 672, 729, 745, 727, 712, 711, 691, 640, 606, 625, 672, 689, 679, 699, 766, 835, 870, 896, 958, 1049, 1132, 1193, 1237, 1269, 1284, 1281, 1257, 1210, 1155, 1121, 1124, 1154, 1191, 1213, 1220, 1225, 1236, 1244, 1246, 1248, 1259, 1275, 1286, 1284, 1259, 1203, 1130, 1075, 1061, 1080, 1111, 1147, 1183, 1214, 1233, 1248, 1269, 1305, 1352, 1401, 1447, 1490, 1523, 1525, 1494, 1446, 1408, 1397, 1412, 1439, 1456, 1445, 1414, 1390, 1391, 1403, 1392, 1352, 1314, 1318, 1360, 1395, 1384, 1351, 1346, 1390, 1452, 1496, 1518, 1533, 1548, 1557, 1551, 1539, 1525, 1514, 1507, 1498, 1489, 1487, 1518, 1578, 1625, 1603, 1514, 1426, 1402, 1430, 1465, 1481, 1475, 1445, 1400, 1358, 1327, 1301, 1285, 1296, 1327, 1358, 1384, 1395, 1368, 1288, 1188, 1121, 1116, 1155, 1176, 1136, 1063, 1028, 1037, 1017, 948, 895, 903, 926, 906, 852, 806, 771, 723, 666, 627, 628, 662, 704, 730, 735, 734, 744, 751, 729, 683, 651, 633, 594, 526, 465, 414, 341, 246, 176, 142, 111, 78, 83, 141, 196, 186, 110, 16, -70, -145, -201, -223, -245, -321, -453, -576, -645, -687, -748, -810, -830, -836, -880, -963, -1031, -1056, -1062, -1078, -1106, -1143, -1182, -1232, -1303, -1397, -1492, -1567, -1611, -1628, -1622, -1601, -1590, -1604, -1634, -1644, -1629, -1630, -1674, -1733, -1763, -1753, -1723, -1694, -1675, -1665, -1641, -1582, -1508, -1459, -1458, -1477, -1469, -1413, -1354, -1350, -1383, -1380, -1322, -1285, -1298, -1298, -1248, -1201, -1193, -1180, -1136, -1095, -1075, -1034, -967, -919, -906, -880, -822, -783, -802, -834, -807, -722, -631, -557, -508, -504, -504, -429, -280, -153, -90, -54, -39, -76, -118, -74, 38, 115, 106, 59, 28, 26, 59, 142, 244, 298, 288, 282, 326, 385, 408, 424, 481, 553, 567, 528, 517, 559, 586, 562, 541, 561, 580, 567, 556, 564, 548, 484, 420, 402, 414, 410, 368, 301, 241, 216, 231, 270, 304, 312, 287, 242, 199, 181, 176, 146, 82, 42, 43, 20, -67, -149, -167, -181, -241, -286, -259, -223, -260, -337, -372, -372, -416, -515, -600, -625, -643, -717, -825, -910, -950, -982, -1017, -1034, -1018, -996, -993, -998, -985, -966, -968, -995, -1020, -1021, -1010, -1004, -1005, -1011, -1042, -1106, -1175, -1189, -1159, -1159, -1234, -1337, -1397, -1431, -1497, -1589, -1639, -1644, -1683, -1778, -1828, -1784, -1745, -1800, -1875, -1880, -1855, -1865, -1873, -1846, -1838, -1879, -1900, -1844, -1758, -1717, -1717, -1727, -1739, -1753, -1746, -1714, -1703, -1741, -1775, -1762, -1739, -1752, -1774, -1784, -1814, -1873, -1902, -1901, -1922, -1961, -1963, -1944, -1945, -1941, -1883, -1803, -1778, -1794, -1794, -1774, -1789, -1854, -1923, -1950, -1935, -1902, -1874, -1871, -1888, -1886, -1812, -1679, -1568, -1528, -1514, -1466, -1409, -1407, -1453, -1482, -1486, -1523, -1593, -1633, -1619, -1618, -1668, -1720, -1714, -1662, -1609, -1562, -1499, -1440, -1420, -1424, -1394, -1322, -1258, -1244, -1276, -1303, -1265, -1167, -1094, -1083, -1060, -996, -979, -1037, -1048, -957, -901, -960, -1018, -969, -893, -889, -906, -853, -768, -728, -702, -612, -493, -464, -527, -562, -514, -474, -507, -548, -526, -490, -514, -567, -563, -519, -504, -509, -462, -374, -327, -333, -326, -272, -223, -211, -209, -193, -182, -189, -190, -186, -216, -287, -333, -315, -276, -258, -236, -186, -139, -136, -159, -179, -186, -179, -166, -155, -154, -156, -149, -132, -115, -98, -63, -9, 52, 108, 172, 257, 335, 369, 365, 365, 376, 368, 351, 373, 432, 457, 429, 426, 502, 600, 650, 671, 723, 796, 838, 831, 810, 793, 762, 732, 745, 812, 866, 862, 854, 911, 994, 1016, 997, 1023, 1071, 1053, 997, 1001, 1045, 1030, 967, 962, 1019, 1053, 1053, 1089, 1169, 1210, 1181, 1144, 1141, 1122, 1070, 1054, 1106, 1155, 1159, 1171, 1231, 1285, 1277, 1248, 1243, 1253, 1254, 1259, 1286, 1301, 1275, 1242, 1247, 1279, 1303, 1335, 1404, 1472, 1474, 1426, 1401, 1403, 1375, 1312, 1284, 1305, 1299, 1232, 1192, 1232, 1277, 1259, 1233, 1275, 1351, 1391, 1404, 1439, 1487, 1512, 1513, 1530, 1583, 1625, 1610, 1550, 1509, 1508, 1505, 1454, 1362, 1249, 1135, 1033, 976, 973, 983, 958, 904, 868, 887, 942, 987, 1001, 1009, 1026, 1031, 1008, 983, 984, 992, 988, 1019, 1131, 1279, 1363, 1360, 1336, 1338, 1345, 1326, 1304, 1305, 1308, 1295, 1290, 1308, 1319, 1298, 1268, 1244, 1207, 1157, 1120, 1102, 1078, 1045, 1015, 995, 999, 1037, 1082, 1094, 1082, 1083, 1108, 1127, 1127, 1127, 1141, 1154, 1161, 1183, 1219, 1238, 1225, 1211, 1224, 1232, 1204, 1168, 1170, 1215, 1265, 1291, 1287, 1282, 1323, 1411, 1494, 1514, 1480, 1425, 1364, 1298, 1229, 1159, 1103, 1091, 1120, 1139, 1119, 1091, 1100, 1139, 1170, 1180, 1180, 1179, 1185, 1194, 1193, 1182, 1176, 1160, 1103, 1030, 1003, 1027, 1048, 1037, 1010, 972, 914, 854, 828, 820, 767, 660, 570, 561, 588, 570, 497, 437, 441, 492, 556, 619, 672, 689, 660, 617, 613, 656, 691, 668, 607, 557, 520, 476, 445, 447, 428, 342, 249, 224, 236, 215, 168, 133, 92, 22, -37, -44, -24, -33, -89, -164, -195, -148, -66, -29, -44, -48, -7, 55, 124, 188, 215, 187, 143, 132, 147, 168, 196, 220, 209, 154, 86, 36, 6, -10, -38, -94, -164, -227, -284, -343, -379, -364, -327, -321, -346, -346, -303, -278, -327, -421, -496, -532, -547, -538, -516, -515, -547, -570, -559, -543, -542, -547, -576, -654, -748, -789, -768, -755, -783, -821, -829, -828, -843, -860, -853, -846, -879, -949, -1009, -1028, -1021, -1022, -1053, -1095, -1116, -1114, -1133, -1197, -1258, -1269, -1252, -1256, -1292, -1325, -1321, -1264, -1167, -1093, -1092, -1145, -1178, -1132, -1018, -900, -838, -834, -829, -797, -780, -803, -813, -767, -723, -744, -788, -777, -724, -700, -729, -758, -741, -683, -615, -546, -474, -411, -380, -366, -327, -252, -187, -186, -230, -228, -134, -29, -7, -22, 16, 65, 33, -27, -4, 64, 54, -11, -22, 17, 19, -11, 16, 108, 164, 138, 104, 125, 160, 130, 45, -1, 9, 3, -53, -78, -22, 32, 8, -29, 9, 93, 135, 136, 149, 165, 138, 76, 25, -15, -87, -203, -326, -424, -498, -560, -608, -645, -686, -729, -744, -720, -686, -673, -690, -716, -728, -739, -780, -853, -913, -917, -888, -880, -917, -967, -1006, -1032, -1055, -1070, -1070, -1073, -1098, -1128, -1116, -1045, -973, -971, -1020, -1053, -1053, -1040, -994, -890, -796, -788, -829, -823, -757, -702, -684, -668, -652, -675, -738, -778, -759, -733, -764, -836, -872, -864, -875, -918, -921, -858, -825, -878, -940, -935, -912, -924, -927, -877, -832, -832, -818, -742, -661, -651, -690, -701, -675, -673, -708, -740, -755, -775, -799, -796, -778, -770, -772, -775, -813, -886, -945, -957, -961, -984, -991, -956, -905, -885, -889, -879, -851, -833, -836, -855, -895, -967, -1051, -1120, -1173, -1225, -1247, -1215, -1160, -1154, -1187, -1175, -1081, -987, -962, -961, -921, -871, -858, -863, -846, -819, -797, -767, -731, -717, -730, -748, -759, -768, -764, -739, -702, -685, -705, -733, -720, -653, -576, -532, -497, -419, -324, -280, -291, -286, -231, -176, -161, -138, -46, 66, 116, 105, 100, 116, 125, 143, 175, 138, -12, -170, -204, -147, -114, -123, -112, -76, -68, -90, -77, -17, 21, 9, 1, 34, 66, 62, 56, 77, 104, 122, 155, 218, 282, 321, 329, 316, 301, 288, 274, 242, 192, 138, 102, 93, 104, 98, 53, 0, -7, 31, 67, 75, 72, 78, 88, 94, 102, 108, 104, 84, 60, 43, 36, 27, 11, 6, 23, 45, 55, 83, 142, 176, 142, 97, 113, 158, 171, 176, 225, 293, 324, 331, 357, 389, 391, 376, 375, 386, 385, 389, 429, 483, 501, 496, 519, 567, 605, 642, 695, 727, 713, 707, 758, 827, 855, 859, 882, 918, 936, 932, 922, 893, 831, 756, 717, 710, 699, 672, 657, 661, 657, 640, 645, 685, 713, 688, 650, 664, 729, 785, 817, 859, 907, 918, 890, 888, 947, 1006, 989, 906, 844, 849, 872, 857, 815, 793, 796, 796, 789, 802, 824, 812, 758, 704, 674, 660, 639, 607, 562, 507, 464, 456, 478, 517, 561, 610, 672, 737, 771, 758, 724, 707, 705, 680, 640, 618, 624, 621, 586, 556, 572, 619, 640, 599, 526, 485, 484, 476, 431, 385, 384, 426, 474, 505, 529, 553, 573, 570, 541, 511, 508, 523, 501, 428, 343, 292, 269, 264, 287, 327, 332, 275, 225, 258, 336, 351, 281, 222, 237, 296, 357, 421, 472, 479, 468, 498, 563, 572, 489, 391, 351, 329, 279, 248, 294, 367, 396, 410, 464, 544, 618, 697, 777, 809, 787, 776, 823, 887, 909, 888, 867, 861, 872, 915, 977, 1001, 975, 961, 990, 1000, 964, 943, 965, 967, 914, 866, 866, 868, 832, 784, 757, 729, 677, 638, 657, 700, 683, 596, 518, 506, 523, 515, 490, 476, 451, 387, 336, 352, 401, 410, 384, 359, 332, 294, 283, 312, 325, 301, 274, 254, 219, 172, 150, 147, 130, 106, 106, 132, 168, 214, 274, 312, 292, 252, 266, 330, 343, 252, 130, 80, 104, 126, 110, 82, 48, -9, -65, -71, -42, -40, -63, -50, -12, -22, -81, -104, -60, -9, 5, 6, 25, 42, 32, 15, 25, 59, 75, 55, 31, 31, 34, 11, -23, -45, -66, -107, -140, -132, -98, -63, -29, -10, -35, -66, -22, 70, 92, 14, -61, -56, -26, -43, -77, -65, -16, 12, 30, 71, 115, 117, 106, 137, 177, 159, 89, 45, 41, 12, -76, -179, -244, -266, -274, -281, -292, -325, -381, -432, -447, -446, -470, -526, -579, -613, -645, -674, -686, -690, -724, -785, -822, -808, -778, -769, -768, -753, -740, -741, -720, -650, -573, -549, -556, -530, -477, -451, -446, -422, -386, -372, -380, -381, -375, -375, -381, -382, -383, -393, -399, -394, -392, -399, -400, -380, -357, -352, -335, -272, -192, -131, -78, -21, 30, 83, 161, 225, 226, 205, 231, 280, 283, 258, 248, 232, 180, 130, 115, 106, 71, 23, -13, -40, -57, -76, -111, -148, -155, -142, -143, -148, -121, -84, -89, -123, -128, -92, -61, -61, -61, -48, -44, -62, -68, -49, -45, -77, -105, -107, -125, -173, -214, -221, -228, -266, -306, -326, -330, -336, -343, -357, -379, -410, -442, -480, -531, -574, -575, -551, -549, -571, -562, -519, -491, -479, -440, -388, -377, -396, -400, -407, -447, -499, -531, -557, -585, -591, -569, -559, -586, -626, -645, -637, -615, -586, -558, -537, -526, -513, -481, -427, -368, -322, -292, -261, -223, -179, -127, -70, -22, 1, 17, 43, 73, 111, 166, 219, 230, 209, 208, 236, 248, 220, 182, 154, 127, 87, 38, -22, -99, -173, -216, -225, -225, -231, -230, -221, -219, -219, -189, -126, -76, -71, -84, -71, -22, 30, 58, 62, 54, 41, 23, -1, -42, -85, -101, -88, -96, -169, -260, -291, -253, -215, -232, -287, -333, -361, -382, -397, -403, -419, -452, -480, -475, -446, -410, -380, -360, -355, -348, -317, -274, -244, -239, -238, -231, -231, -247, -250, -219, -172, -143, -131, -110, -78, -49, -31, -23, -26, -33, -33, -27, -35, -57, -66, -43, -12, -10, -26, -20, 12, 42, 54, 71, 103, 125, 113, 84, 73, 81, 83, 64, 33, 4, -7, 1, 25, 33, 17, 8, 26, 56, 76, 84, 95, 109, 116, 114, 108, 99, 88, 73, 58, 48, 45, 48, 49, 47, 41, 36, 34, 32, 26, 17, 20, 32, 32, 0, -45, -74, -76, -67, -67, -76, -90, -106, -116, -101, -66, -35, -32, -43, -54, -74, -104, -117, -104, -83, -71, -63, -51, -29, 5, 41, 41, 8, -10, 14, 54, 82, 100, 113, 113, 108, 119, 144, 165, 168, 158, 141, 127, 132, 161, 194, 205, 187, 160, 137, 120, 105, 98, 91, 69, 34, 8, 1, 12, 22, 16, -10, -42, -51, -42, -40, -63, -93, -103, -83, -53, -38, -59, -93, -105, -81, -49, -37, -45, -50, -35, -1, 34, 59, 65, 64, 73, 100, 133, 152, 154, 155, 157, 147, 121, 98, 99, 115, 119, 100, 75, 52, 32, 19, 17, 20, 20, 21, 23, 21, 12, 12, 32, 58, 78, 89, 93, 94, 102, 128, 175, 216, 233, 232, 230, 233, 240, 249, 254, 235, 194, 165, 166, 181, 178, 163, 152, 142, 115, 66, 20, -2, -11, -23, -44, -61, -59, -40, -18, -7, -9, -10, 3, 30, 60, 87, 114, 141, 159, 163, 164, 172, 187, 197, 200, 196, 180, 157, 139, 126, 106, 81, 58, 38, 16, -12, -35, -43, -42, -48, -62, -72, -67, -51, -35, -29, -32, -42, -50, -51, -44, -35, -29, -24, -21, -13, 0, 15, 27, 30, 27, 30, 36, 34, 23, 12, 4, -12, -37, -56, -60, -54, -54, -59, -60, -50, -37, -27, -18, -5, 11, 21, 23, 27, 33, 43, 49, 54, 59, 65, 72, 80, 82, 80, 75, 70, 62, 54, 43, 34, 25, 12, -1, -11, -13, -16, -18, -21, -20, -18, -16, -12, -10, -9, -9, -9, -9, -9, -9, -10, -11, -12, -11, -9, -6, -5, -1, 0, 0, 0, 3, 6, 9, 9, 8, 8, 8, 5, 1, -1, -6, -12, -17, -21, -27, -31, -32, -32, -32, -32, -29, -27, -27, -27, -23, -21, -18, -17, -17, -16, -15, -13, -12, -10, -7, -7, -10, -11, -11, -12, -13, -15, -16, -17, -18, -21, -21, -21, -22, -22, -21, -21, -21, -20, -20, -18, -18, -16, -15, -13, -12, -11, -11, -12, -13, -12, -11, -9, -7, -6, -6, -7, -7, -5, -1, -1, -2, -4, -4, -2, -1, -1, -1, -1, -2, -4, -5, -4, -2, -1, -2, -2, -2, -2, -2, -2, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, 0, 0, 0, 0, -1, -2, -2, -1, -1, -2, -4, -4, -2, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, -1, -2, -2, -1, 0, 0, 0, 0, -1, -2, -2, 0, 0, -1, -2, -2, -2, -1, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, -1, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, -1, -1, 0, 0, 1, 1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, 0, 0, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, -1, -1, 0, 1, 0, 0, 0, 1, 1, 0, 0, 0 };
+// IMA ADPCM blocks, see audio_adpcm.h
+static const uint8_t __in_flash("audio_unknown_sample_data") audio_unknown_sample_data[] = { 0, 0, 0, 0, 119, 55, 25, 176, 203, 156, 17, 137, 129, 9, 37, 154, 99, 129, 65, 130, 50, 178, 12, 36, 169, 9, 170, 56, 34, 146, 255, 16, 152, 0, 204, 24, 218, 9, 168, 186, 207, 9, 186, 154, 235, 10, 83, 145, 16, 128, 114, 177, 141, 0, 9, 184, 121, 6, 187, 170, 170, 217, 189, 114, 52, 34, 34, 52, 1, 9, 49, 34, 168, 11, 216, 191, 188, 219, 154, 186, 154, 136, 138, 49, 50, 67, 33, 54, 18, 67, 50, 53, 2, 33, 184, 155, 200, 155, 32, 70, 50, 52, 34, 18, 152, 185, 11, 18, 202, 237, 221, 203, 202, 186, 187, 154, 0, 8, 82, 19, 67, 51, 115, 20, 17, 35, 50, 2, 137, 176, 190, 203, 138, 152, 12, 68, 168, 24, 184, 137, 251, 10, 184, 155, 252, 139, 184, 175, 169, 154, 0, 16, 67, 36, 51, 84, 67, 34, 52, 33, 50, 2, 18, 192, 204, 203, 188, 186, 202, 187, 155, 169, 170, 9, 216, 171, 137, 81, 53, 0, 18, 129, 16, 144, 186, 154, 103, 3, 32, 54, 34, 34, 68, 19, 185, 114, 20, 129, 186, 24, 176, 221, 188, 24, 160, 190, 10, 144, 169, 137, 32, 184, 139, 66, 130, 188, 114, 133, 137, 33, 52, 52, 0, 97, 19, 0, 83, 36, 17, 49, 18, 169, 50, 232, 11, 192, 190, 138, 8, 250, 189, 9, 169, 154, 168, 56, 147, 172, 34, 170, 67, 184, 116, 23, 33, 19, 1, 16, 50, 68, 18, 50, 36, 51, 178, 175, 0, 235, 138, 187, 139, 200, 156, 8, 204, 153, 153, 65, 3, 114, 19, 136, 66, 2, 144, 169, 114, 2, 0, 16, 18, 219, 96, 209, 142, 66, 34, 68, 161, 12, 129, 206, 153, 128, 136, 8, 136, 152, 253, 203, 136, 128, 137, 0, 50, 39, 128, 24, 51, 67, 1, 49, 54, 20, 152, 10, 0, 218, 172, 137, 184, 188, 137, 187, 186, 220, 138, 144, 172, 40, 2, 48, 36, 144, 49, 20, 171, 115, 23, 34, 20, 136, 49, 2, 24, 68, 1, 33, 1, 8, 1, 203, 203, 187, 220, 26, 179, 255, 8, 144, 136, 144, 40, 3, 154, 51, 18, 55, 129, 97, 3, 24, 17, 33, 21, 16, 34, 176, 173, 9, 50, 176, 41, 241, 223, 170, 203, 137, 160, 156, 17, 220, 137, 128, 25, 17, 99, 52, 34, 67, 18, 35, 152, 48, 130, 128, 220, 154, 222, 170, 235, 137, 168, 25, 168, 40, 202, 41, 152, 117, 129, 32, 2, 49, 178, 158, 17, 17, 217, 11, 145, 139, 161, 75, 23, 154, 154, 80, 145, 42, 22, 16, 145, 27, 148, 239, 8, 8, 128, 170, 65, 129, 32, 184, 72, 161, 89, 20, 8, 0, 49, 37, 1, 153, 136, 48, 195, 142, 51, 152, 160, 191, 50, 217, 64, 145, 72, 39, 16, 35, 168, 88, 37, 0, 16, 83, 176, 58, 163, 44, 196, 143, 128, 153, 185, 25, 200, 139, 217, 59, 149, 26, 133, 58, 132, 59, 23, 1, 27, 0, 55, 154, 36, 219, 25, 168, 26, 0, 68, 234, 57, 216, 41, 2, 138, 51, 160, 11, 193, 159, 66, 192, 9, 161, 174, 152, 154, 48, 51, 19, 153, 251, 141, 2, 173, 99, 2, 35, 218, 136, 169, 9, 17, 66, 52, 17, 144, 172, 128, 28, 103, 17, 67, 160, 24, 168, 155, 201, 138, 185, 154, 239, 155, 169, 172, 152, 205, 8, 144, 32, 83, 67, 17, 35, 32, 69, 18, 68, 51, 52, 1, 16, 169, 153, 202, 155, 169, 186, 219, 207, 203, 171, 186, 171, 0, 16, 160, 173, 16, 250, 156, 136, 0, 18, 1, 36, 218, 204, 172, 24, 48, 53, 18, 85, 130, 8, 50, 84, 20, 33, 51, 67, 129, 25, 130, 137, 168, 174, 144, 235, 170, 171, 169, 191, 11, 137, 40, 185, 41, 20, 0, 203, 73, 38, 1, 49, 34, 35, 218, 202, 11, 20, 9, 131, 140, 224, 175, 152, 137, 17, 128, 34, 144, 185, 174, 1, 16, 69, 1, 32, 146, 207, 186, 26, 131, 172, 152, 56, 241, 174, 8, 40, 2, 136, 115, 19, 16, 18, 34, 130, 138, 168, 154, 236, 205, 139, 217, 174, 154, 138, 128, 187, 24, 152, 33, 186, 114, 23, 49, 34, 99, 3, 16, 18, 33, 18, 65, 131, 8, 177, 11, 250, 15, 160, 9, 200, 41, 162, 141, 152, 10, 3, 173, 48, 216, 25, 250, 155, 185, 141, 145, 138, 129, 11, 22, 137, 66, 51, 69, 34, 34, 50, 51, 3, 33, 36, 1, 17, 250, 138, 160, 235, 189, 185, 157, 168, 188, 128, 186, 65, 146, 17, 0, 103, 2, 65, 51, 53, 34, 18, 52, 35, 65, 21, 129, 144, 153, 238, 155, 202, 156, 186, 171, 218, 155, 170, 138, 0, 99, 51, 68, 51, 68, 51, 68, 51, 36, 50, 51, 17, 24, 1, 16, 176, 174, 168, 205, 187, 186, 186, 188, 171, 186, 221, 139, 184, 155, 153, 25, 209, 141, 146, 27, 3, 44, 55, 137, 50, 136, 99, 129, 65, 2, 17, 184, 186, 191, 138, 217, 187, 235, 203, 188, 170, 171, 170, 138, 128, 203, 139, 0, 8, 71, 35, 52, 2, 50, 35, 50, 68, 19, 67, 160, 136, 237, 137, 202, 153, 186, 188, 251, 154, 128, 188, 138, 136, 144, 187, 128, 112, 3, 25, 3, 80, 193, 43, 23, 8, 33, 16, 18, 153, 41, 132, 172, 84, 152, 35, 205, 50, 186, 50, 170, 68, 152, 16, 185, 140, 144, 187, 67, 1, 130, 28, 71, 128, 33, 84, 19, 9, 67, 34, 49, 115, 36, 0, 1, 65, 3, 72, 37, 16, 66, 3, 8, 2, 49, 148, 73, 148, 141, 161, 191, 136, 251, 137, 144, 155, 185, 42, 147, 13, 71, 129, 65, 35, 66, 53, 33, 36, 17, 34, 17, 52, 145, 25, 176, 175, 186, 156, 184, 174, 136, 171, 170, 188, 136, 233, 11, 35, 169, 25, 1, 251, 13, 129, 40, 1, 65, 178, 42, 200, 121, 147, 89, 5, 9, 130, 156, 2, 188, 49, 93, 6, 35, 0, 234, 56, 240, 26, 161, 13, 129, 9, 146, 25, 194, 141, 19, 172, 49, 17, 176, 11, 162, 173, 153, 144, 191, 48, 177, 191, 0, 251, 27, 145, 156, 50, 145, 139, 35, 138, 69, 128, 64, 53, 34, 51, 169, 202, 157, 18, 170, 19, 173, 192, 255, 171, 238, 138, 153, 9, 17, 83, 2, 24, 35, 48, 119, 36, 33, 35, 18, 0, 1, 16, 52, 34, 168, 189, 219, 189, 171, 170, 154, 185, 154, 220, 156, 137, 136, 49, 33, 37, 128, 50, 144, 56, 2, 18, 234, 25, 4, 153, 144, 207, 137, 186, 48, 50, 70, 1, 185, 173, 152, 9, 32, 129, 168, 222, 205, 203, 154, 137, 153, 8, 152, 187, 171, 32, 84, 52, 52, 34, 51, 20, 51, 36, 36, 184, 189, 219, 155, 170, 203, 204, 203, 187, 189, 155, 0, 0, 0, 184, 153, 153, 113, 2, 96, 36, 16, 34, 154, 82, 144, 16, 1, 115, 35, 67, 130, 137, 2, 170, 65, 69, 51, 146, 203, 204, 172, 171, 24, 18, 136, 144, 222, 172, 9, 50, 36, 84, 35, 1, 18, 33, 83, 36, 67, 51, 129, 40, 146, 189, 33, 17, 19, 186, 114, 164, 140, 16, 16, 129, 113, 37, 137, 32, 129, 203, 24, 67, 146, 73, 4, 154, 137, 50, 147, 114, 35, 67, 146, 72, 131, 187, 66, 160, 187, 157, 49, 253, 156, 144, 171, 170, 154, 24, 146, 190, 137, 233, 10, 33, 2, 137, 51, 249, 154, 128, 136, 1, 56, 165, 191, 34, 236, 9, 168, 42, 22, 137, 52, 208, 26, 1, 56, 131, 89, 134, 188, 32, 216, 154, 144, 136, 2, 137, 200, 239, 8, 185, 58, 5, 25, 19, 186, 26, 145, 27, 119, 1, 33, 129, 17, 250, 137, 128, 24, 0, 99, 160, 202, 220, 137, 144, 8, 18, 16, 177, 239, 203, 154, 9, 1, 66, 39, 19, 0, 66, 52, 83, 68, 52, 18, 16, 0, 8, 136, 0, 152, 184, 222, 189, 186, 203, 170, 137, 153, 137, 201, 155, 153, 25, 50, 69, 20, 2, 16, 128, 153, 154, 9, 52, 145, 144, 205, 154, 205, 138, 49, 69, 34, 129, 171, 170, 205, 138, 8, 160, 219, 221, 188, 187, 172, 153, 10, 128, 153, 153, 154, 114, 67, 68, 35, 51, 35, 49, 17, 24, 50, 248, 172, 218, 188, 202, 203, 153, 187, 155, 203, 170, 154, 24, 184, 72, 53, 17, 17, 82, 51, 16, 70, 2, 49, 53, 17, 129, 57, 55, 0, 81, 18, 33, 130, 137, 128, 155, 52, 168, 187, 223, 155, 234, 155, 17, 153, 33, 153, 49, 251, 104, 19, 32, 39, 2, 17, 34, 50, 20, 17, 84, 19, 152, 17, 129, 169, 42, 4, 171, 83, 2, 250, 156, 144, 155, 128, 48, 4, 136, 169, 153, 201, 74, 71, 66, 67, 2, 136, 154, 0, 9, 117, 20, 17, 129, 186, 188, 11, 67, 2, 98, 146, 174, 136, 189, 24, 152, 96, 146, 155, 186, 173, 153, 169, 81, 130, 26, 29, 1, 41, 0, 147, 141, 4, 170, 100, 2, 48, 21, 169, 152, 171, 32, 200, 96, 132, 171, 17, 218, 10, 18, 82, 131, 56, 164, 175, 136, 136, 168, 57, 4, 0, 251, 159, 130, 138, 67, 128, 17, 152, 65, 162, 90, 55, 128, 8, 184, 41, 37, 153, 136, 170, 152, 239, 154, 128, 17, 184, 175, 169, 170, 8, 16, 24, 69, 146, 186, 205, 170, 32, 70, 51, 53, 37, 18, 0, 50, 54, 67, 51, 19, 2, 169, 204, 186, 153, 152, 235, 188, 204, 187, 188, 138, 137, 8, 1, 169, 154, 155, 49, 34, 115, 39, 0, 1, 169, 138, 185, 10, 1, 49, 19, 219, 221, 172, 136, 16, 50, 53, 130, 235, 203, 170, 171, 8, 1, 145, 207, 187, 189, 155, 8, 49, 4, 24, 1, 187, 64, 52, 85, 51, 34, 19, 169, 137, 219, 139, 129, 202, 236, 188, 171, 188, 172, 136, 153, 9, 202, 156, 152, 10, 35, 8, 71, 128, 49, 145, 56, 38, 66, 37, 1, 49, 2, 33, 19, 115, 37, 136, 33, 144, 0, 201, 10, 129, 203, 0, 252, 156, 136, 170, 136, 138, 101, 160, 27, 129, 27, 53, 16, 70, 1, 65, 3, 25, 53, 34, 52, 2, 97, 19, 170, 49, 129, 41, 3, 138, 131, 223, 136, 251, 10, 0, 8, 1, 169, 16, 216, 26, 36, 64, 53, 128, 33, 18, 48, 146, 58, 71, 1, 34, 128, 187, 153, 238, 137, 128, 8, 177, 207, 153, 202, 137, 185, 41, 195, 157, 129, 187, 34, 235, 80, 131, 25, 20, 10, 37, 186, 114, 146, 57, 3, 155, 129, 190, 40, 160, 88, 131, 139, 52, 144, 81, 20, 32, 37, 136, 68, 144, 48, 178, 75, 164, 239, 24, 218, 26, 145, 42, 38, 184, 25, 160, 26, 68, 51, 68, 1, 185, 204, 157, 40, 129, 170, 8, 144, 239, 154, 137, 24, 34, 66, 128, 24, 1, 152, 220, 25, 34, 115, 19, 33, 54, 18, 50, 82, 85, 51, 18, 18, 1, 144, 154, 137, 202, 170, 253, 203, 186, 203, 171, 155, 153, 169, 169, 169, 171, 137, 136, 115, 19, 49, 147, 138, 19, 203, 186, 174, 16, 169, 80, 19, 153, 218, 155, 136, 115, 36, 8, 0, 251, 189, 170, 154, 187, 140, 168, 189, 187, 170, 169, 40, 52, 68, 36, 34, 36, 18, 99, 18, 17, 50, 129, 185, 205, 171, 250, 171, 136, 251, 155, 152, 137, 202, 153, 186, 137, 170, 8, 219, 26, 53, 160, 41, 103, 35, 8, 83, 67, 36, 16, 37, 136, 50, 168, 80, 162, 43, 164, 158, 17, 170, 0, 154, 84, 145, 25, 146, 138, 152, 113, 162, 157, 34, 128, 252, 154, 32, 83, 144, 24, 66, 36, 144, 64, 53, 16, 35, 185, 115, 145, 0, 169, 32, 202, 33, 176, 41, 234, 57, 148, 188, 0, 113, 3, 157, 49, 129, 137, 9, 8, 50, 130, 201, 173, 16, 1, 168, 43, 55, 1, 0, 33, 20, 160, 113, 21, 234, 10, 2, 234, 139, 129, 67, 10, 44, 0, 153, 152, 155, 153, 138, 17, 49, 22, 8, 71, 2, 8, 49, 21, 188, 80, 145, 41, 4, 203, 154, 1, 185, 88, 145, 74, 54, 2, 152, 49, 248, 141, 51, 201, 57, 147, 205, 170, 129, 137, 36, 187, 114, 145, 186, 137, 24, 36, 49, 103, 160, 137, 8, 218, 172, 40, 145, 171, 201, 140, 33, 185, 41, 71, 18, 65, 20, 220, 11, 50, 33, 85, 52, 20, 17, 0, 32, 50, 66, 36, 129, 203, 187, 220, 188, 155, 153, 172, 203, 187, 171, 202, 170, 8, 144, 40, 20, 128, 0, 64, 193, 141, 129, 40, 3, 138, 4, 205, 136, 153, 82, 19, 71, 145, 136, 176, 155, 136, 9, 1, 201, 235, 206, 171, 170, 138, 136, 8, 0, 0, 129, 8, 82, 68, 51, 67, 68, 17, 18, 184, 154, 203, 40, 176, 104, 20, 169, 204, 155, 184, 190, 136, 32, 161, 191, 154, 235, 172, 24, 129, 136, 83, 34, 16, 83, 52, 52, 68, 18, 66, 19, 17, 168, 186, 204, 154, 168, 154, 0, 218, 138, 219, 10, 83, 38, 129, 50, 1, 136, 220, 40, 3, 157, 33, 153, 161, 223, 50, 128, 66, 50, 36, 0, 70, 145, 80, 145, 41, 147, 10, 4, 12, 2, 189, 16, 160, 169, 80, 20, 154, 2, 170, 49, 136, 84, 18, 68, 184, 48, 193, 156, 16, 84, 145, 11, 20, 186, 171, 25, 52, 152, 115, 4, 16, 144, 170, 24, 144, 137, 24, 145, 255, 154, 154, 219, 171, 0, 34, 193, 57, 21, 24, 130, 141, 98, 18, 1, 56, 22, 251, 138, 152, 170, 24, 98, 52, 144, 40, 1, 137, 49, 101, 52, 2, 128, 136, 234, 173, 136, 187, 40, 232, 155, 216, 172, 154, 16, 160, 57, 71, 0, 40, 34, 152, 8, 220, 155, 16, 119, 52, 51, 18, 2, 0, 40, 52, 35, 68, 146, 222, 187, 169, 172, 154, 170, 153, 187, 204, 154, 0, 153, 83, 145, 136, 33, 147, 191, 136, 201, 155, 185, 11, 50, 83, 129, 10, 2, 80, 55, 66, 37, 2, 153, 203, 187, 188, 136, 202, 139, 202, 171, 219, 137, 128, 81, 35, 64, 36, 17, 3, 170, 153, 170, 33, 136, 100, 128, 8, 233, 42, 38, 50, 51, 98, 2, 188, 202, 172, 144, 204, 137, 201, 204, 138, 144, 154, 64, 35, 33, 52, 82, 36, 49, 3, 72, 22, 137, 0, 152, 219, 138, 136, 153, 81, 35, 99, 162, 139, 51, 36, 184, 97, 162, 138, 251, 158, 129, 186, 8, 0, 1, 189, 97, 129, 40, 18, 83, 128, 82, 146, 64, 163, 140, 2, 136, 18, 56, 71, 169, 32, 3, 137, 65, 39, 128, 16, 168, 9, 202, 9, 128, 66, 200, 42, 5, 203, 8, 68, 2, 154, 82, 160, 156, 153, 32, 249, 26, 4, 16, 128, 10, 53, 2, 32, 98, 37, 184, 26, 1, 219, 173, 16, 145, 205, 138, 2, 188, 24, 35, 0, 33, 160, 157, 33, 253, 26, 19, 136, 17, 33, 161, 207, 82, 4, 47, 0, 138, 18, 49, 36, 67, 162, 255, 137, 153, 137, 152, 17, 169, 65, 248, 157, 152, 152, 137, 118, 52, 50, 52, 1, 0, 24, 67, 67, 19, 129, 168, 237, 171, 169, 137, 152, 153, 154, 155, 203, 171, 8, 185, 154, 169, 238, 172, 170, 204, 219, 187, 9, 129, 16, 83, 51, 160, 25, 66, 83, 99, 35, 128, 169, 188, 173, 154, 155, 137, 185, 187, 169, 153, 16, 1, 49, 37, 85, 20, 169, 138, 216, 206, 170, 8, 136, 24, 34, 18, 33, 100, 83, 83, 19, 1, 128, 201, 203, 203, 154, 203, 204, 170, 168, 172, 24, 33, 20, 49, 53, 35, 18, 51, 19, 52, 177, 156, 82, 184, 27, 131, 73, 53, 71, 49, 69, 18, 32, 1, 152, 9, 0, 185, 174, 152, 223, 139, 152, 154, 40, 34, 130, 16, 2, 98, 147, 140, 68, 144, 170, 25, 39, 235, 24, 130, 8, 33, 85, 18, 33, 1, 49, 162, 27, 3, 153, 218, 173, 250, 155, 152, 154, 49, 33, 51, 32, 3, 10, 54, 144, 137, 154, 185, 239, 170, 154, 0, 168, 115, 23, 24, 50, 19, 129, 32, 20, 144, 202, 203, 219, 187, 186, 186, 154, 136, 66, 130, 113, 23, 136, 8, 33, 217, 138, 217, 171, 171, 218, 11, 147, 191, 65, 17, 128, 81, 37, 144, 24, 0, 202, 24, 130, 155, 34, 200, 204, 56, 20, 40, 103, 146, 9, 161, 156, 153, 188, 9, 185, 206, 10, 1, 128, 49, 177, 207, 154, 153, 81, 103, 51, 35, 18, 1, 1, 65, 68, 51, 17, 136, 169, 190, 170, 16, 168, 153, 169, 204, 153, 137, 153, 205, 171, 218, 172, 186, 154, 217, 189, 171, 203, 138, 49, 36, 16, 33, 152, 219, 155, 83, 131, 0, 193, 173, 170, 172, 8, 176, 41, 20, 8, 52, 98, 3, 188, 153, 204, 10, 144, 11, 160, 175, 201, 172, 16, 33, 70, 18, 49, 2, 153, 17, 129, 170, 219, 204, 172, 188, 172, 153, 186, 153, 138, 66, 51, 83, 3, 170, 184, 207, 153, 144, 0, 144, 33, 160, 156, 88, 103, 35, 67, 50, 83, 129, 32, 36, 128, 1, 152, 0, 219, 137, 144, 137, 137, 128, 10, 71, 144, 16, 208, 156, 234, 156, 136, 154, 137, 8, 129, 25, 87, 34, 67, 51, 84, 2, 16, 34, 35, 130, 153, 0, 192, 174, 40, 130, 72, 22, 128, 1, 40, 22, 153, 32, 160, 203, 173, 170, 186, 221, 139, 18, 170, 99, 1, 17, 168, 114, 133, 25, 35, 185, 154, 203, 25, 176, 157, 16, 218, 48, 145, 64, 177, 58, 7, 154, 50, 160, 64, 193, 157, 50, 129, 0, 185, 154, 204, 9, 18, 169, 49, 251, 190, 173, 17, 184, 153, 206, 10, 8, 32, 52, 1, 33, 192, 156, 10, 70, 168, 48, 131, 56, 4, 25, 225, 158, 115, 18, 33, 129, 170, 203, 205, 137, 49, 19, 144, 138, 216, 157, 17, 16, 66, 3, 168, 155, 253, 171, 136, 136, 170, 9, 18, 66, 248, 38, 0, 34, 168, 112, 7, 170, 170, 187, 114, 99, 69, 52, 34, 129, 0, 8, 32, 52, 52, 20, 144, 187, 170, 137, 144, 25, 4, 205, 155, 138, 144, 187, 188, 223, 203, 186, 153, 152, 155, 234, 203, 202, 187, 25, 17, 16, 2, 201, 202, 172, 170, 170, 17, 218, 8, 234, 41, 146, 154, 145, 12, 67, 16, 103, 2, 18, 168, 154, 203, 137, 136, 17, 128, 49, 161, 27, 23, 137, 71, 0, 81, 1, 56, 162, 11, 162, 191, 170, 203, 155, 137, 169, 153, 185, 190, 138, 152, 42, 55, 184, 174, 170, 202, 189, 10, 16, 136, 53, 16, 87, 1, 50, 18, 36, 128, 67, 3, 17, 17, 0, 130, 206, 24, 50, 20, 136, 69, 1, 128, 0, 50, 20, 152, 217, 172, 145, 189, 136, 185, 24, 235, 42, 36, 32, 37, 33, 37, 185, 27, 70, 145, 10, 35, 33, 161, 141, 99, 35, 0, 33, 70, 130, 8, 17, 51, 160, 42, 52, 19, 186, 48, 36, 225, 174, 33, 129, 24, 176, 105, 6, 154, 8, 154, 193, 159, 16, 169, 8, 168, 203, 155, 203, 137, 34, 18, 136, 115, 133, 9, 144, 10, 52, 1, 40, 66, 36, 234, 11, 184, 140, 17, 136, 98, 20, 33, 19, 128, 136, 113, 131, 42, 54, 16, 66, 129, 202, 137, 160, 206, 9, 2, 203, 24, 200, 171, 219, 172, 169, 171, 136, 25, 131, 239, 137, 185, 138, 184, 139, 18, 201, 191, 26, 216, 174, 8, 160, 137, 49, 51, 18, 129, 32, 177, 143, 68, 160, 0, 170, 160, 255, 8, 202, 9, 152, 65, 2, 32, 146, 137, 253, 156, 144, 57, 39, 50, 37, 51, 2, 40, 132, 25, 54, 18, 67, 67, 21, 129, 33, 19, 18, 33, 70, 51, 36, 34, 51, 145, 154, 32, 147, 157, 66, 34, 128, 153, 216, 173, 186, 174, 136, 153, 217, 155, 251, 173, 187, 188, 203, 203, 170, 185, 235, 187, 186, 205, 170, 153, 153, 154, 153, 203, 186, 191, 171, 187, 188, 170, 153, 185, 171, 170, 203, 187, 9, 50, 54, 67, 37, 129, 32, 152, 153, 235, 137, 128, 1, 219, 138, 192, 175, 24, 128, 33, 52, 20, 8, 145, 186, 202, 171, 156, 117, 19, 17, 53, 19, 138, 82, 67, 17, 99, 36, 18, 128, 32, 3, 154, 80, 35, 67, 36, 67, 35, 52, 33, 84, 51, 51, 49, 39, 144, 0, 144, 0, 0, 83, 18, 115, 4, 136, 17, 66, 20, 56, 87, 34, 1, 16, 34, 0, 24, 51, 33, 85, 35, 17, 2, 137, 83, 18, 33, 84, 53, 1, 1, 218, 138, 186, 156, 0, 0, 16, 34, 250, 173, 154, 186, 171, 138, 136, 34, 251, 171, 222, 172, 155, 138, 154, 32, 3, 170, 168, 189, 137, 169, 26, 53, 0, 32, 233, 188, 203, 171, 188, 80, 3, 48, 38, 129, 8, 48, 4, 41, 69, 1, 52, 146, 154, 144, 203, 139, 0, 154, 68, 200, 138, 251, 139, 0, 168, 187, 65, 162, 207, 5, 21, 0, 223, 137, 250, 172, 9, 185, 140, 34, 233, 138, 176, 173, 170, 137, 200, 11, 36, 153, 8, 25, 21, 170, 65, 128, 100, 35, 84, 129, 32, 2, 48, 132, 172, 98, 51, 184, 138, 19, 153, 144, 157, 34, 8, 161, 207, 217, 191, 9, 16, 32, 68, 54, 35, 17, 18, 17, 33, 33, 70, 51, 84, 36, 34, 33, 51, 35, 50, 53, 68, 52, 34, 18, 34, 146, 153, 0, 186, 137, 65, 179, 223, 153, 170, 203, 205, 153, 152, 170, 206, 186, 202, 205, 154, 170, 187, 171, 186, 205, 187, 187, 188, 188, 187, 137, 201, 204, 170, 186, 221, 171, 155, 185, 187, 137, 152, 219, 155, 18, 218, 139, 16, 51, 129, 32, 67, 35, 249, 10, 2, 136, 16, 69, 145, 137, 1, 17, 152, 72, 71, 34, 2, 0, 35, 184, 204, 11, 70, 67, 66, 83, 35, 18, 16, 50, 130, 114, 37, 34, 20, 34, 20, 136, 137, 56, 54, 18, 67, 53, 66, 19, 128, 50, 51, 67, 37, 2, 33, 35, 184, 172, 40, 67, 70, 35, 115, 19, 128, 8, 16, 0, 115, 53, 1, 34, 2, 152, 219, 155, 32, 52, 70, 51, 34, 19, 145, 204, 9, 34, 65, 55, 18, 34, 129, 185, 173, 138, 170, 80, 21, 1, 17, 160, 203, 204, 172, 8, 144, 154, 152, 219, 219, 187, 187, 187, 154, 32, 36, 200, 189, 136, 236, 171, 32, 145, 155, 18, 205, 138, 187, 154, 41, 69, 2, 67, 35, 1, 202, 24, 248, 42, 37, 66, 2, 32, 20, 171, 16, 202, 25, 85, 130, 25, 36, 153, 16, 251, 171, 154, 184, 205, 137, 168, 187, 169, 170, 236, 170, 202, 172, 185, 172, 82, 184, 43, 147, 171, 168, 189, 204, 64, 3, 10, 101, 51, 129, 56, 147, 187, 65, 35, 18, 64, 69, 84, 146, 174, 8, 145, 201, 171, 48, 19, 200, 188, 186, 236, 172, 138, 32, 68, 54, 67, 51, 19, 17, 49, 35, 17, 101, 52, 52, 51, 67, 67, 18, 17, 66, 67, 51, 67, 83, 18, 1, 0, 17, 184, 140, 33, 128, 218, 171, 152, 251, 204, 170, 137, 218, 188, 170, 235, 188, 170, 203, 187, 171, 185, 188, 189, 172, 187, 189, 172, 153, 153, 187, 203, 187, 205, 188, 187, 187, 186, 186, 169, 187, 171, 170, 236, 172, 136, 136, 136, 33, 19, 33, 160, 155, 233, 139, 128, 64, 3, 104, 36, 8, 18, 66, 21, 49, 21, 8, 34, 128, 66, 18, 101, 52, 36, 51, 37, 18, 18, 32, 83, 49, 53, 50, 53, 1, 35, 17, 65, 51, 71, 19, 49, 52, 52, 19, 17, 67, 2, 49, 19, 25, 50, 160, 173, 25, 34, 82, 71, 34, 50, 34, 34, 2, 25, 86, 34, 35, 0, 69, 162, 172, 169, 171, 9, 8, 116, 51, 19, 24, 19, 251, 41, 68, 34, 67, 83, 51, 128, 1, 24, 67, 16, 65, 85, 19, 17, 19, 152, 0, 170, 128, 188, 8, 16, 146, 191, 138, 152, 60, 12, 21, 0, 236, 155, 128, 185, 153, 204, 172, 186, 137, 221, 9, 250, 138, 153, 169, 187, 97, 2, 136, 144, 32, 146, 185, 207, 32, 176, 11, 184, 27, 208, 175, 25, 18, 152, 115, 21, 136, 8, 18, 17, 50, 20, 115, 35, 17, 8, 84, 144, 8, 25, 37, 218, 8, 160, 203, 191, 138, 184, 155, 186, 11, 248, 175, 136, 153, 169, 11, 34, 168, 128, 16, 67, 168, 137, 117, 22, 17, 18, 17, 168, 25, 144, 42, 3, 113, 131, 191, 154, 219, 186, 138, 32, 1, 33, 208, 223, 203, 202, 154, 24, 115, 67, 51, 36, 17, 128, 136, 18, 83, 68, 68, 36, 35, 51, 49, 18, 50, 67, 99, 52, 51, 67, 18, 1, 0, 17, 0, 32, 83, 34, 144, 169, 218, 203, 203, 171, 169, 188, 204, 220, 204, 187, 203, 188, 170, 170, 170, 204, 203, 188, 203, 203, 170, 171, 171, 187, 189, 204, 187, 189, 187, 187, 172, 169, 169, 171, 172, 170, 172, 170, 155, 137, 136, 16, 144, 137, 168, 187, 250, 154, 49, 35, 137, 67, 145, 128, 9, 103, 1, 83, 35, 33, 2, 41, 6, 40, 55, 66, 52, 67, 37, 1, 50, 130, 32, 51, 68, 67, 67, 35, 33, 35, 33, 84, 52, 52, 67, 68, 50, 51, 34, 50, 35, 50, 50, 68, 34, 18, 1, 152, 48, 55, 68, 69, 50, 67, 51, 19, 8, 69, 129, 32, 17, 68, 2, 0, 186, 171, 219, 25, 1, 72, 71, 35, 1, 40, 20, 16, 18, 114, 39, 18, 17, 51, 4, 152, 49, 53, 18, 49, 54, 19, 128, 16, 129, 185, 189, 48, 3, 173, 64, 4, 168, 0, 128, 168, 188, 9, 184, 221, 189, 9, 200, 188, 171, 8, 235, 172, 169, 171, 153, 153, 168, 154, 128, 249, 191, 138, 185, 158, 152, 154, 169, 172, 184, 188, 153, 25, 39, 0, 51, 184, 98, 161, 141, 100, 51, 1, 49, 54, 128, 169, 137, 136, 8, 98, 20, 129, 16, 2, 252, 174, 8, 8, 160, 137, 17, 129, 251, 191, 170, 137, 152, 137, 50, 34, 1, 251, 188, 171, 24, 36, 83, 52, 34, 144, 171, 205, 156, 34, 51, 67, 52, 35, 145, 221, 172, 153, 128, 8, 67, 34, 216, 188, 203, 172, 187, 72, 70, 34, 51, 36, 34, 144, 0, 34, 83, 69, 68, 34, 33, 34, 18, 33, 49, 116, 51, 51, 67, 50, 2, 136, 0, 169, 32, 66, 52, 144, 154, 185, 237, 188, 138, 152, 155, 168, 205, 235, 188, 188, 172, 187, 172, 152, 169, 203, 203, 203, 205, 170, 169, 170, 186, 154, 218, 189, 203, 187, 205, 171, 138, 137, 169, 155, 136, 170, 188, 170, 186, 139, 50, 35, 2, 41, 71, 216, 171, 137, 50, 145, 9, 52, 1, 168, 187, 170, 8, 83, 146, 74, 195, 45, 195, 142, 51, 82, 71, 50, 67, 33, 35, 2, 33, 50, 68, 51, 53, 51, 34, 129, 49, 17, 85, 51, 85, 50, 67, 34, 33, 51, 67, 145, 24, 243, 31, 0, 73, 53, 152, 8, 34, 160, 25, 3, 112, 69, 34, 66, 53, 128, 48, 37, 129, 0, 52, 160, 42, 130, 170, 168, 207, 25, 161, 188, 48, 129, 170, 56, 69, 69, 67, 51, 83, 130, 138, 83, 130, 137, 115, 22, 1, 33, 2, 17, 128, 24, 18, 16, 50, 70, 176, 175, 152, 169, 189, 138, 32, 18, 16, 17, 0, 234, 172, 153, 169, 170, 49, 178, 223, 187, 187, 204, 156, 16, 34, 34, 18, 18, 184, 190, 204, 153, 185, 57, 176, 9, 250, 173, 169, 8, 184, 112, 55, 17, 51, 35, 34, 66, 129, 33, 35, 51, 83, 36, 176, 10, 176, 175, 138, 136, 8, 145, 189, 0, 251, 173, 186, 219, 171, 137, 204, 154, 152, 235, 170, 154, 170, 204, 153, 203, 188, 203, 170, 186, 187, 136, 24, 66, 55, 0, 65, 129, 136, 97, 54, 34, 51, 52, 18, 2, 250, 155, 1, 202, 72, 37, 145, 138, 129, 236, 173, 154, 16, 49, 69, 67, 36, 17, 33, 1, 0, 66, 69, 50, 50, 69, 51, 17, 49, 53, 19, 68, 83, 50, 50, 18, 33, 33, 0, 33, 67, 18, 49, 52, 168, 189, 154, 144, 220, 154, 153, 202, 223, 203, 186, 204, 170, 187, 187, 170, 185, 204, 204, 203, 187, 203, 203, 170, 170, 188, 188, 219, 203, 187, 188, 171, 154, 171, 169, 169, 172, 187, 219, 187, 171, 153, 169, 10, 18, 187, 156, 185, 221, 154, 9, 51, 1, 24, 50, 227, 190, 8, 160, 189, 40, 19, 234, 155, 48, 162, 12, 85, 52, 36, 82, 51, 2, 34, 34, 49, 67, 52, 52, 68, 18, 33, 51, 34, 100, 52, 51, 83, 52, 67, 35, 34, 34, 83, 19, 24, 66, 83, 18, 8, 67, 83, 51, 50, 55, 34, 66, 34, 2, 24, 52, 129, 137, 137, 98, 19, 218, 10, 34, 128, 201, 155, 40, 18, 33, 20, 17, 86, 54, 18, 9, 114, 51, 144, 138, 99, 18, 8, 49, 34, 34, 83, 18, 153, 41, 20, 200, 206, 155, 0, 202, 189, 137, 17, 144, 138, 32, 4, 251, 155, 128, 235, 139, 34, 216, 157, 17, 168, 203, 170, 136, 17, 17, 40, 71, 2, 154, 137, 185, 205, 187, 171, 218, 203, 138, 0, 218, 11, 69, 1, 96, 36, 8, 34, 129, 25, 52, 176, 139, 83, 161, 157, 0, 233, 139, 8, 136, 153, 25, 130, 250, 221, 187, 153, 170, 171, 138, 136, 200, 175, 24, 233, 27, 35, 1, 49, 130, 9, 129, 255, 171, 9, 185, 26, 37, 34, 116, 67, 34, 49, 53, 2, 136, 8, 84, 20, 0, 65, 21, 144, 137, 152, 153, 170, 24, 33, 145, 189, 169, 255, 189, 138, 0, 24, 99, 67, 51, 18, 1, 137, 136, 24, 71, 35, 66, 53, 36, 129, 32, 51, 18, 67, 69, 36, 35, 18, 1, 129, 152, 24, 19, 34, 69, 18, 176, 204, 171, 153, 205, 138, 128, 185, 220, 204, 204, 187, 187, 219, 170, 153, 137, 219, 204, 186, 86, 16, 45, 0, 187, 189, 172, 154, 169, 202, 187, 204, 219, 203, 186, 170, 169, 155, 137, 169, 204, 154, 153, 219, 172, 0, 129, 153, 9, 0, 217, 172, 138, 168, 186, 56, 20, 185, 11, 34, 168, 187, 139, 66, 18, 216, 223, 9, 1, 154, 116, 36, 51, 69, 34, 129, 0, 50, 19, 16, 115, 54, 18, 16, 49, 129, 9, 83, 68, 83, 67, 50, 51, 51, 35, 51, 19, 67, 52, 67, 34, 1, 50, 4, 187, 112, 38, 34, 52, 21, 17, 33, 18, 128, 24, 1, 33, 20, 8, 67, 192, 139, 67, 2, 112, 54, 50, 17, 40, 52, 129, 25, 69, 35, 49, 70, 51, 18, 51, 51, 100, 19, 32, 83, 35, 129, 65, 36, 152, 9, 17, 184, 174, 57, 53, 130, 48, 67, 2, 152, 8, 128, 204, 153, 250, 154, 201, 207, 137, 185, 189, 153, 136, 17, 144, 8, 1, 235, 187, 170, 206, 154, 153, 187, 187, 186, 207, 172, 186, 186, 10, 16, 33, 53, 129, 50, 146, 140, 1, 1, 233, 42, 39, 152, 41, 51, 218, 120, 35, 137, 66, 19, 128, 8, 218, 11, 162, 158, 136, 153, 16, 16, 32, 87, 129, 8, 2, 201, 188, 114, 162, 172, 136, 0, 160, 9, 66, 69, 17, 115, 37, 1, 17, 18, 152, 49, 53, 34, 128, 128, 252, 204, 187, 172, 138, 9, 65, 35, 66, 130, 206, 203, 155, 152, 48, 55, 84, 51, 18, 17, 16, 128, 33, 54, 52, 68, 67, 34, 34, 17, 33, 50, 17, 82, 69, 50, 17, 1, 18, 152, 138, 153, 16, 20, 16, 160, 239, 170, 185, 190, 171, 138, 168, 204, 204, 203, 187, 189, 188, 171, 138, 169, 188, 189, 202, 219, 187, 187, 171, 187, 187, 205, 187, 219, 204, 186, 171, 187, 170, 185, 186, 170, 170, 186, 205, 170, 16, 128, 137, 82, 35, 153, 32, 232, 156, 48, 18, 144, 41, 54, 130, 137, 8, 153, 8, 99, 19, 185, 112, 38, 1, 65, 68, 36, 18, 83, 2, 56, 37, 1, 33, 83, 21, 1, 17, 153, 49, 168, 113, 3, 49, 37, 67, 18, 67, 2, 16, 3, 137, 17, 128, 169, 58, 21, 187, 41, 85, 53, 83, 52, 50, 53, 35, 34, 67, 51, 69, 51, 53, 52, 17, 16, 51, 146, 27, 119, 18, 16, 33, 51, 131, 8, 136, 114, 19, 49, 55, 83, 35, 17, 34, 33, 18, 49, 37, 50, 70, 35, 144, 25, 18, 186, 154, 113, 35, 65, 20, 35, 160, 154, 203, 189, 190, 137, 152, 186, 171, 16, 169, 173, 187, 169, 221, 138, 145, 138, 218, 26, 224, 157, 152, 170, 185, 10, 147, 191, 0, 144, 251, 156, 128, 169, 219, 11, 152, 157, 136, 155, 160, 156, 34, 0, 50, 103, 36, 16, 33, 202, 48, 147, 173, 98, 36, 129, 32, 36, 1, 8, 168, 172, 203, 25, 176, 189, 24, 128, 251, 172, 0, 152, 170, 40, 145, 104, 132, 186, 236, 10, 160, 155, 50, 68, 83, 2, 136, 152, 179, 5, 30, 0, 32, 129, 155, 66, 36, 185, 137, 251, 191, 202, 187, 203, 154, 137, 53, 161, 16, 176, 223, 187, 187, 138, 66, 86, 36, 67, 50, 34, 2, 32, 52, 19, 98, 36, 67, 18, 50, 50, 18, 34, 53, 67, 68, 51, 36, 0, 1, 186, 138, 203, 187, 155, 52, 200, 187, 170, 168, 239, 155, 152, 169, 235, 170, 251, 174, 185, 203, 170, 170, 137, 170, 203, 188, 203, 187, 203, 171, 153, 186, 204, 186, 189, 189, 171, 187, 172, 155, 41, 160, 25, 20, 68, 161, 41, 130, 138, 0, 50, 52, 1, 115, 208, 139, 202, 56, 178, 89, 37, 33, 2, 155, 160, 207, 154, 169, 136, 152, 169, 138, 49, 192, 105, 22, 8, 35, 18, 2, 1, 34, 51, 33, 4, 239, 137, 201, 58, 36, 49, 38, 18, 34, 33, 67, 35, 67, 152, 114, 177, 140, 8, 83, 233, 41, 36, 1, 50, 52, 37, 3, 17, 51, 52, 35, 66, 70, 18, 51, 68, 35, 33, 19, 64, 53, 50, 53, 51, 20, 152, 8, 154, 33, 250, 56, 21, 153, 137, 136, 201, 189, 139, 82, 18, 65, 70, 34, 145, 138, 18, 201, 156, 24, 34, 16, 145, 11, 38, 220, 9, 16, 51, 187, 114, 176, 204, 186, 172, 171, 170, 172, 25, 129, 153, 50, 132, 169, 169, 171, 26, 103, 129, 40, 1, 251, 172, 152, 171, 67, 36, 82, 69, 1, 8, 144, 170, 138, 1, 171, 115, 145, 138, 130, 172, 65, 83, 52, 17, 52, 176, 96, 146, 155, 34, 169, 171, 80, 53, 52, 51, 185, 140, 185, 189, 137, 185, 41, 6, 206, 9, 152, 188, 171, 234, 188, 8, 144, 33, 1, 64, 146, 189, 202, 191, 9, 152, 24, 136, 49, 250, 25, 216, 58, 23, 16, 35, 128, 185, 138, 232, 173, 0, 169, 40, 19, 18, 186, 220, 207, 171, 171, 64, 85, 53, 36, 35, 35, 1, 152, 24, 128, 8, 152, 65, 19, 24, 100, 20, 128, 66, 34, 48, 52, 19, 217, 188, 206, 203, 187, 202, 154, 153, 8, 128, 16, 0, 152, 204, 171, 185, 205, 186, 220, 188, 219, 186, 187, 138, 0, 66, 19, 82, 51, 18, 1, 18, 152, 172, 172, 202, 171, 153, 170, 72, 67, 99, 53, 53, 52, 52, 51, 50, 128, 168, 220, 203, 170, 171, 152, 137, 8, 0, 169, 154, 176, 175, 153, 153, 251, 189, 221, 188, 203, 170, 172, 154, 8, 0, 32, 52, 53, 18, 50, 20, 129, 8, 34, 129, 32, 34, 34, 17, 1, 101, 67, 69, 68, 51, 36, 18, 0, 136, 144, 185, 170, 187, 136, 202, 10, 51, 19, 1, 114, 53, 69, 50, 53, 19, 137, 128, 219, 154, 185, 140, 17, 0, 85, 35, 51, 36, 0, 50, 51, 52, 86, 36, 16, 34, 168, 172, 8, 220, 25, 35, 17, 68, 35, 129, 32, 84, 71, 19, 33, 52, 129, 186, 25, 176, 172, 128, 204, 155, 169, 136, 33, 144, 113, 133, 170, 136, 219, 220, 156, 185, 221, 11, 48, 0, 189, 138, 169, 187, 139, 0, 128, 33, 36, 70, 19, 49, 52, 2, 8, 33, 233, 156, 169, 170, 201, 9, 69, 1, 49, 37, 0, 34, 18, 0, 8, 184, 220, 188, 171, 236, 10, 17, 137, 99, 52, 35, 33, 66, 145, 153, 138, 128, 223, 137, 202, 155, 185, 188, 187, 11, 146, 141, 71, 131, 136, 33, 248, 173, 169, 156, 0, 144, 11, 69, 176, 41, 53, 128, 81, 19, 24, 67, 145, 9, 17, 251, 140, 17, 136, 33, 1, 168, 138, 250, 191, 49, 200, 11, 35, 24, 144, 187, 251, 156, 128, 65, 119, 67, 34, 67, 2, 0, 136, 152, 136, 136, 9, 18, 160, 203, 26, 193, 173, 137, 153, 153, 136, 219, 202, 239, 186, 219, 170, 203, 138, 152, 137, 0, 24, 145, 169, 187, 25, 32, 19, 0, 209, 255, 187, 156, 153, 24, 66, 68, 34, 33, 36, 2, 32, 18, 1, 160, 219, 188, 170, 186, 170, 48, 21, 49, 36, 84, 83, 68, 33, 19, 200, 203, 190, 203, 170, 153, 153, 137, 169, 188, 187, 137, 16, 99, 51, 34, 184, 223, 188, 172, 172, 154, 152, 8, 34, 51, 70, 35, 52, 52, 51, 20, 33, 50, 18, 1, 16, 129, 235, 202, 10, 35, 82, 54, 51, 34, 130, 136, 169, 137, 250, 138, 233, 205, 137, 169, 171, 8, 34, 67, 67, 83, 51, 35, 34, 36, 0, 16, 168, 0, 144, 156, 115, 131, 24, 99, 69, 17, 67, 52, 35, 1, 17, 128, 152, 220, 10, 192, 174, 9, 152, 203, 41, 36, 49, 145, 114, 23, 136, 17, 0, 16, 144, 8, 169, 72, 240, 158, 8, 170, 9, 50, 145, 64, 19, 186, 218, 203, 136, 233, 156, 128, 251, 138, 168, 170, 24, 34, 34, 69, 51, 82, 36, 17, 17, 34, 130, 201, 155, 184, 190, 187, 9, 152, 173, 97, 3, 32, 70, 35, 129, 153, 153, 187, 235, 173, 16, 216, 155, 9, 153, 170, 48, 103, 129, 56, 19, 144, 137, 128, 172, 138, 202, 205, 138, 233, 172, 49, 130, 40, 71, 128, 0, 1, 0, 16, 2, 137, 146, 239, 137, 170, 170, 171, 0, 138, 1, 88, 55, 176, 139, 130, 223, 155, 48, 210, 28, 36, 152, 169, 170, 154, 83, 35, 119, 54, 34, 17, 19, 129, 186, 9, 129, 169, 153, 8, 249, 174, 153, 153, 153, 154, 32, 34, 201, 172, 153, 253, 187, 187, 172, 187, 170, 8, 152, 0, 19, 17, 49, 100, 52, 36, 66, 34, 168, 189, 203, 172, 154, 8, 17, 33, 19, 0, 33, 53, 69, 68, 34, 17, 152, 204, 188, 203, 171, 169, 170, 153, 8, 49, 70, 69, 51, 50, 2, 153, 203, 188, 188, 203, 203, 186, 205, 171, 169, 136, 32, 69, 20, 34, 18, 129, 152, 9, 144, 186, 189, 171, 187, 139, 64, 71, 51, 69, 36, 50, 53, 50, 51, 33, 18, 202, 204, 172, 187, 203, 9, 152, 8, 1, 33, 1, 114, 21, 16, 34, 185, 154, 220, 203, 176, 230, 50, 0, 171, 154, 154, 33, 65, 103, 17, 82, 34, 50, 19, 82, 129, 25, 19, 201, 138, 144, 222, 10, 161, 139, 37, 1, 68, 19, 1, 48, 4, 203, 81, 161, 140, 128, 187, 203, 138, 160, 139, 54, 128, 115, 4, 33, 18, 152, 154, 152, 238, 138, 168, 187, 155, 24, 184, 28, 68, 33, 53, 35, 51, 4, 201, 10, 160, 191, 9, 153, 154, 155, 137, 9, 18, 32, 87, 36, 2, 32, 2, 235, 10, 168, 187, 205, 9, 234, 138, 169, 57, 130, 27, 87, 0, 24, 34, 33, 1, 65, 20, 176, 173, 128, 205, 138, 136, 24, 18, 24, 39, 219, 57, 162, 140, 66, 18, 153, 17, 252, 26, 208, 156, 129, 202, 138, 168, 185, 138, 168, 172, 128, 204, 154, 64, 37, 33, 70, 36, 145, 138, 18, 136, 115, 55, 53, 35, 51, 35, 1, 154, 24, 144, 137, 17, 168, 238, 188, 187, 219, 171, 171, 155, 186, 156, 186, 188, 203, 173, 185, 189, 154, 170, 128, 169, 25, 35, 160, 139, 101, 35, 83, 37, 35, 2, 170, 168, 221, 138, 136, 16, 185, 9, 145, 189, 42, 53, 34, 67, 35, 144, 204, 154, 169, 188, 137, 169, 204, 156, 9, 84, 50, 85, 2, 16, 168, 154, 218, 154, 184, 205, 202, 204, 171, 172, 10, 136, 48, 52, 66, 18, 136, 35, 152, 48, 21, 136, 168, 156, 33, 136, 114, 70, 67, 33, 52, 67, 50, 67, 52, 18, 0, 144, 235, 172, 153, 170, 138, 168, 154, 218, 138, 1, 64, 35, 114, 3, 156, 33, 235, 138, 153, 48, 147, 73, 71, 18, 50, 70, 17, 66, 20, 32, 18, 128, 18, 168, 138, 144, 172, 40, 145, 138, 86, 3, 32, 67, 52, 3, 153, 17, 217, 220, 157, 137, 186, 187, 138, 176, 175, 81, 2, 32, 66, 36, 160, 9, 153, 153, 205, 9, 184, 171, 205, 56, 161, 121, 36, 0, 16, 32, 130, 172, 32, 161, 206, 170, 185, 203, 203, 10, 129, 154, 66, 34, 216, 43, 71, 168, 32, 145, 154, 0, 218, 96, 131, 139, 1, 204, 171, 128, 153, 136, 189, 65, 248, 157, 17, 185, 41, 176, 156, 128, 137, 48, 35, 116, 5, 153, 168, 11, 217, 28, 53, 8, 17, 152, 200, 191, 41, 20, 1, 33, 19, 217, 173, 136, 144, 16, 152, 9, 208, 239, 9, 153, 138, 136, 128, 66, 36, 0, 50, 145, 201, 189, 155, 99, 53, 116, 52, 34, 34, 34, 33, 17, 49, 52, 35, 145, 187, 236, 188, 203, 172, 169, 170, 169, 171, 154, 203, 172, 184, 204, 187, 172, 186, 204, 137, 168, 186, 204, 11, 144, 57, 55, 66, 37, 1, 17, 160, 137, 152, 137, 16, 17, 217, 205, 171, 187, 42, 35, 98, 53, 17, 18, 168, 24, 201, 138, 184, 155, 250, 172, 153, 8, 186, 97, 162, 41, 130, 27, 23, 154, 51, 252, 158, 202, 187, 202, 171, 152, 169, 136, 154, 8, 137, 82, 37, 84, 35, 50, 36, 137, 50, 31, 211, 45, 0, 1, 82, 19, 81, 18, 56, 53, 32, 71, 34, 65, 19, 0, 128, 9, 144, 171, 168, 206, 188, 189, 170, 170, 170, 24, 18, 202, 56, 37, 144, 57, 55, 1, 98, 18, 32, 37, 0, 83, 19, 115, 35, 32, 37, 17, 52, 2, 65, 20, 170, 138, 176, 174, 137, 168, 186, 237, 170, 152, 170, 140, 83, 35, 34, 1, 84, 145, 140, 49, 0, 32, 130, 10, 36, 220, 48, 131, 41, 6, 138, 34, 168, 137, 170, 0, 223, 154, 202, 155, 169, 187, 66, 130, 137, 136, 48, 210, 91, 23, 8, 128, 205, 8, 152, 154, 8, 84, 161, 155, 2, 170, 17, 202, 48, 248, 172, 187, 187, 251, 154, 130, 172, 137, 203, 16, 144, 116, 3, 81, 4, 8, 50, 1, 115, 1, 33, 147, 171, 160, 190, 154, 188, 137, 236, 155, 160, 155, 168, 155, 18, 217, 204, 137, 161, 191, 40, 146, 173, 8, 16, 168, 157, 101, 129, 8, 35, 129, 16, 184, 88, 21, 152, 17, 35, 129, 72, 51, 98, 4, 32, 21, 25, 36, 249, 25, 131, 207, 40, 176, 140, 128, 153, 144, 25, 3, 172, 168, 186, 253, 157, 17, 50, 55, 67, 52, 34, 16, 34, 18, 65, 52, 18, 128, 152, 185, 206, 187, 170, 185, 189, 170, 169, 170, 188, 170, 170, 205, 172, 170, 203, 202, 154, 185, 206, 169, 186, 154, 8, 34, 67, 68, 17, 16, 1, 32, 17, 49, 69, 19, 217, 203, 187, 203, 155, 65, 18, 66, 2, 8, 184, 42, 163, 44, 55, 17, 144, 172, 234, 188, 154, 204, 25, 145, 139, 51, 144, 64, 51, 161, 207, 8, 249, 156, 152, 188, 170, 219, 186, 188, 137, 169, 48, 20, 114, 20, 24, 52, 34, 83, 35, 51, 19, 49, 145, 156, 19, 137, 71, 1, 82, 2, 25, 2, 24, 18, 48, 7, 203, 24, 216, 171, 218, 154, 169, 187, 154, 137, 50, 144, 116, 22, 33, 67, 34, 69, 34, 49, 36, 34, 18, 49, 51, 40, 52, 9, 69, 200, 26, 146, 205, 56, 177, 27, 37, 168, 25, 68, 131, 140, 99, 128, 137, 153, 64, 162, 191, 40, 176, 173, 49, 4, 137, 82, 18, 8, 16, 48, 130, 188, 33, 232, 174, 154, 169, 191, 10, 130, 204, 8, 1, 169, 24, 69, 129, 8, 2, 186, 136, 204, 26, 240, 158, 0, 187, 10, 154, 40, 216, 27, 37, 186, 97, 146, 25, 2, 56, 163, 175, 17, 250, 9, 129, 186, 8, 152, 18, 170, 116, 133, 9, 35, 152, 9, 8, 33, 176, 154, 219, 204, 204, 137, 168, 139, 84, 161, 43, 5, 189, 32, 168, 41, 177, 172, 24, 179, 255, 43, 184, 13, 19, 169, 115, 129, 24, 34, 33, 17, 97, 53, 129, 56, 51, 17, 144, 24, 52, 249, 156, 24, 0, 252, 11, 18, 221, 9, 0, 9, 0, 136, 153, 169, 238, 155, 0, 40, 87, 67, 52, 51, 34, 33, 34, 0, 66, 67, 1, 153, 201, 204, 188, 203, 186, 28, 58, 58, 0, 170, 186, 171, 170, 172, 171, 187, 139, 169, 206, 170, 202, 203, 203, 171, 219, 189, 154, 169, 137, 33, 66, 52, 33, 35, 1, 82, 37, 34, 99, 19, 168, 204, 169, 203, 10, 16, 32, 3, 170, 136, 204, 138, 34, 54, 51, 69, 19, 186, 10, 200, 173, 136, 138, 184, 191, 136, 172, 24, 168, 8, 216, 156, 136, 201, 139, 144, 172, 218, 171, 202, 173, 25, 144, 88, 37, 33, 52, 48, 71, 35, 83, 19, 34, 35, 0, 17, 169, 65, 3, 10, 52, 233, 9, 161, 155, 51, 16, 54, 184, 139, 129, 206, 10, 185, 187, 207, 10, 160, 174, 48, 161, 25, 52, 83, 20, 32, 55, 18, 50, 21, 17, 2, 8, 52, 176, 58, 5, 187, 154, 171, 168, 191, 114, 145, 11, 35, 137, 129, 11, 87, 152, 56, 130, 153, 168, 43, 23, 205, 40, 130, 154, 8, 34, 18, 185, 112, 2, 154, 83, 3, 0, 152, 40, 240, 159, 16, 169, 154, 25, 18, 217, 139, 1, 184, 172, 81, 146, 156, 144, 26, 163, 191, 52, 232, 138, 169, 41, 177, 29, 20, 188, 0, 201, 10, 168, 42, 21, 154, 17, 234, 138, 170, 41, 2, 48, 55, 2, 115, 162, 41, 23, 136, 51, 176, 8, 200, 138, 209, 173, 17, 202, 154, 219, 10, 130, 188, 16, 8, 131, 239, 16, 145, 153, 137, 24, 50, 162, 175, 70, 184, 57, 4, 24, 130, 80, 23, 168, 32, 144, 9, 160, 155, 50, 251, 13, 160, 173, 152, 154, 218, 27, 20, 188, 98, 145, 9, 160, 189, 153, 235, 41, 71, 66, 52, 52, 18, 18, 32, 50, 18, 66, 35, 145, 186, 221, 203, 203, 186, 187, 188, 170, 202, 171, 170, 170, 185, 138, 161, 189, 152, 186, 220, 205, 169, 234, 171, 138, 168, 9, 128, 0, 1, 17, 36, 98, 69, 67, 35, 19, 34, 160, 203, 154, 8, 1, 0, 35, 251, 157, 169, 155, 8, 72, 71, 17, 33, 1, 16, 201, 9, 129, 170, 185, 189, 205, 188, 186, 203, 186, 188, 188, 170, 8, 202, 11, 176, 171, 216, 174, 128, 154, 66, 128, 65, 131, 56, 55, 66, 54, 83, 36, 35, 34, 34, 35, 18, 17, 83, 35, 1, 0, 184, 223, 138, 169, 26, 145, 26, 162, 159, 0, 186, 24, 17, 34, 202, 48, 160, 144, 223, 48, 232, 88, 147, 88, 4, 10, 52, 137, 99, 2, 50, 4, 65, 20, 8, 34, 0, 144, 136, 160, 11, 68, 144, 40, 177, 175, 99, 19, 17, 49, 71, 144, 138, 129, 154, 128, 203, 80, 160, 155, 218, 138, 236, 9, 17, 153, 137, 0, 17, 218, 25, 52, 130, 172, 98, 130, 170, 137, 18, 203, 41, 147, 191, 25, 176, 156, 160, 41, 195, 223, 0, 128, 170, 139, 66, 193, 175, 24, 200, 11, 0, 40, 131, 157, 50, 200, 56, 177, 80, 132, 154, 18, 187, 137, 253, 25, 1, 154, 2, 8, 5, 174, 115, 130, 48, 132, 153, 33, 144, 139, 254, 11, 38, 0, 83, 216, 157, 8, 218, 139, 144, 155, 153, 152, 40, 38, 202, 26, 83, 208, 11, 38, 168, 41, 67, 146, 158, 85, 161, 139, 128, 153, 17, 234, 42, 4, 203, 137, 1, 128, 32, 20, 201, 203, 170, 251, 156, 64, 83, 69, 51, 83, 18, 1, 50, 18, 49, 53, 19, 169, 155, 184, 207, 172, 155, 170, 204, 171, 170, 171, 203, 137, 185, 138, 128, 201, 137, 144, 137, 234, 189, 203, 172, 154, 169, 154, 169, 138, 217, 140, 50, 82, 53, 67, 53, 34, 34, 128, 0, 16, 33, 18, 16, 232, 190, 188, 203, 173, 9, 169, 25, 18, 81, 130, 40, 21, 24, 52, 17, 69, 129, 152, 219, 156, 202, 189, 187, 186, 202, 173, 138, 168, 155, 9, 17, 18, 115, 37, 17, 50, 35, 67, 2, 33, 66, 50, 52, 37, 51, 18, 52, 0, 97, 52, 50, 68, 36, 16, 50, 146, 171, 153, 154, 145, 206, 136, 200, 189, 172, 137, 152, 138, 68, 1, 24, 35, 17, 17, 100, 3, 114, 19, 8, 36, 185, 136, 9, 55, 144, 113, 6, 136, 48, 20, 136, 66, 129, 16, 1, 153, 16, 18, 237, 25, 161, 174, 0, 18, 168, 11, 52, 217, 138, 144, 33, 233, 57, 21, 136, 152, 152, 8, 185, 57, 5, 48, 5, 138, 51, 168, 80, 3, 88, 6, 202, 9, 34, 192, 172, 24, 145, 205, 155, 137, 168, 173, 8, 32, 193, 157, 49, 129, 49, 18, 83, 18, 218, 9, 251, 59, 210, 26, 162, 158, 168, 157, 8, 219, 40, 145, 12, 35, 128, 82, 53, 34, 16, 50, 5, 154, 33, 201, 25, 232, 26, 225, 189, 9, 184, 172, 17, 160, 26, 19, 9, 130, 159, 99, 184, 140, 24, 51, 177, 74, 7, 234, 137, 144, 188, 24, 146, 173, 50, 176, 12, 51, 234, 25, 1, 8, 138, 35, 155, 133, 255, 8, 128, 24, 160, 73, 23, 186, 138, 185, 189, 10, 53, 83, 55, 52, 51, 51, 50, 34, 68, 20, 17, 32, 0, 202, 189, 187, 235, 203, 171, 186, 204, 154, 170, 185, 154, 136, 136, 0, 33, 34, 53, 177, 158, 17, 236, 138, 185, 154, 202, 171, 203, 155, 219, 26, 51, 32, 87, 35, 34, 18, 83, 17, 65, 21, 0, 18, 185, 186, 221, 187, 187, 187, 188, 8, 152, 188, 8, 51, 129, 116, 38, 33, 35, 34, 18, 152, 187, 172, 236, 188, 187, 203, 203, 203, 186, 169, 170, 9, 16, 66, 51, 101, 51, 49, 52, 51, 52, 18, 52, 18, 17, 160, 152, 235, 10, 2, 154, 82, 53, 35, 67, 53, 17, 65, 36, 18, 50, 34, 144, 203, 188, 186, 205, 156, 136, 203, 155, 8, 152, 137, 65, 68, 69, 19, 99, 35, 136, 82, 2, 1, 33, 35, 152, 41, 161, 207, 40, 161, 188, 136, 128, 251, 9, 2, 137, 52, 1, 116, 129, 9, 36, 160, 138, 49, 208, 189, 24, 208, 188, 153, 136, 136, 187, 170, 128, 137, 116, 52, 34, 17, 26, 12, 42, 0, 85, 129, 9, 1, 32, 3, 170, 66, 145, 236, 11, 67, 168, 81, 20, 1, 128, 81, 20, 152, 66, 19, 168, 204, 48, 177, 159, 34, 129, 154, 9, 144, 221, 138, 50, 184, 25, 177, 156, 250, 140, 128, 169, 41, 132, 174, 136, 154, 152, 9, 55, 160, 26, 145, 137, 216, 44, 37, 186, 66, 176, 10, 251, 26, 131, 206, 24, 129, 201, 154, 40, 130, 170, 24, 36, 234, 10, 34, 33, 2, 81, 162, 189, 155, 48, 200, 113, 7, 169, 137, 185, 156, 203, 9, 160, 10, 201, 10, 251, 155, 1, 169, 9, 160, 49, 251, 143, 0, 138, 16, 144, 137, 162, 223, 170, 170, 186, 10, 116, 69, 36, 68, 67, 34, 50, 67, 34, 18, 33, 50, 1, 203, 188, 202, 205, 172, 171, 187, 172, 155, 186, 172, 154, 153, 136, 9, 34, 34, 2, 154, 145, 188, 202, 157, 202, 190, 152, 189, 139, 184, 172, 137, 8, 0, 65, 70, 51, 67, 53, 35, 67, 19, 67, 19, 0, 34, 130, 223, 137, 200, 187, 153, 186, 138, 169, 26, 20, 202, 64, 38, 0, 66, 20, 129, 168, 172, 185, 223, 155, 186, 189, 188, 187, 219, 171, 170, 169, 169, 40, 18, 66, 36, 101, 35, 50, 37, 35, 67, 34, 67, 2, 49, 18, 137, 160, 204, 170, 137, 160, 140, 53, 160, 88, 179, 29, 38, 8, 49, 33, 2, 153, 136, 185, 174, 152, 140, 35, 207, 41, 145, 171, 154, 49, 22, 154, 85, 50, 36, 1, 83, 35, 49, 35, 84, 35, 0, 52, 176, 157, 153, 153, 218, 42, 133, 171, 33, 217, 137, 128, 137, 8, 84, 19, 51, 176, 121, 131, 25, 144, 154, 1, 176, 175, 170, 172, 128, 238, 25, 146, 173, 32, 2, 186, 43, 55, 184, 138, 33, 38, 251, 25, 1, 160, 188, 64, 162, 173, 32, 2, 200, 25, 34, 136, 201, 58, 55, 153, 64, 18, 16, 185, 81, 162, 9, 129, 16, 130, 202, 205, 137, 128, 222, 72, 146, 42, 35, 56, 3, 27, 54, 17, 36, 32, 53, 3, 170, 81, 178, 173, 202, 187, 251, 173, 8, 144, 9, 64, 19, 137, 17, 27, 87, 186, 104, 19, 170, 64, 51, 152, 66, 129, 137, 0, 152, 64, 147, 190, 24, 162, 255, 10, 128, 188, 16, 176, 11, 145, 190, 137, 160, 189, 25, 208, 189, 9, 136, 8, 130, 73, 55, 145, 48, 54, 18, 153, 115, 146, 10, 2, 136, 130, 187, 128, 202, 235, 173, 33, 200, 138, 19, 168, 187, 10, 19, 137, 116, 19, 50, 3, 138, 69, 184, 41, 19, 8, 251, 142, 128, 189, 11, 145, 169, 170, 16, 252, 9, 161, 12, 19, 154, 68, 146, 48, 53, 2, 50, 68, 176, 139, 52, 185, 66, 145, 97, 145, 187, 169, 9, 184, 112, 71, 128, 32, 2, 10, 1, 25, 37, 218, 9, 200, 190, 154, 185, 203, 203, 137, 201, 10, 51, 18, 24, 55, 233, 153, 186, 9, 136, 49, 33, 38, 218, 135, 241, 43, 0, 48, 249, 41, 19, 32, 50, 19, 64, 23, 8, 69, 18, 35, 17, 68, 201, 26, 2, 204, 25, 146, 205, 154, 186, 204, 138, 186, 156, 185, 173, 152, 154, 1, 25, 34, 186, 17, 160, 25, 37, 65, 71, 145, 41, 5, 203, 88, 146, 26, 21, 169, 24, 128, 203, 26, 5, 153, 66, 33, 1, 25, 103, 145, 24, 35, 144, 136, 8, 114, 21, 137, 99, 131, 154, 49, 18, 18, 17, 68, 160, 186, 203, 32, 232, 57, 55, 145, 136, 0, 184, 140, 53, 128, 100, 129, 32, 2, 138, 66, 35, 50, 37, 32, 53, 184, 41, 4, 153, 32, 224, 11, 148, 191, 25, 161, 203, 8, 185, 10, 220, 41, 163, 142, 129, 203, 136, 234, 171, 48, 160, 141, 50, 160, 186, 16, 129, 16, 201, 115, 149, 10, 17, 8, 145, 140, 68, 161, 173, 49, 216, 138, 201, 57, 35, 201, 58, 39, 218, 25, 2, 137, 136, 17, 18, 192, 28, 38, 185, 8, 51, 224, 140, 33, 152, 16, 138, 67, 145, 24, 152, 16, 129, 252, 11, 36, 202, 32, 19, 130, 174, 115, 145, 137, 185, 42, 178, 159, 81, 20, 136, 48, 160, 138, 145, 141, 115, 1, 32, 34, 184, 172, 169, 173, 137, 0, 185, 40, 240, 158, 1, 152, 154, 56, 225, 43, 22, 154, 64, 18, 153, 66, 161, 24, 192, 172, 203, 32, 240, 156, 33, 2, 190, 80, 132, 170, 17, 160, 10, 152, 88, 38, 152, 40, 18, 234, 187, 136, 144, 185, 72, 36, 185, 140, 2, 204, 64, 177, 42, 37, 1, 0, 115, 19, 0, 144, 32, 145, 9, 98, 53, 129, 48, 5, 186, 138, 33, 152, 88, 70, 18, 136, 33, 3, 250, 40, 21, 184, 26, 39, 202, 40, 146, 138, 18, 203, 155, 233, 173, 0, 201, 156, 137, 251, 171, 186, 154, 168, 26, 71, 128, 10, 35, 129, 113, 85, 68, 50, 67, 51, 34, 35, 34, 52, 18, 33, 19, 184, 190, 172, 204, 172, 188, 171, 186, 205, 170, 186, 186, 219, 138, 145, 156, 1, 152, 154, 137, 153, 152, 203, 26, 248, 155, 185, 174, 186, 172, 170, 173, 154, 16, 145, 42, 71, 128, 64, 19, 24, 54, 18, 82, 19, 17, 19, 128, 0, 152, 171, 136, 222, 170, 169, 188, 187, 219, 171, 16, 168, 40, 35, 2, 204, 49, 200, 156, 168, 187, 204, 206, 172, 186, 190, 10, 201, 170, 0, 152, 0, 66, 68, 34, 70, 52, 34, 99, 36, 33, 66, 17, 65, 19, 8, 50, 130, 153, 25, 128, 189, 170, 204, 24, 250, 139, 17, 201, 138, 0, 34, 1, 0, 115, 35, 152, 56, 70, 1, 24, 68, 19, 168, 80, 147, 173, 17, 0, 1, 171, 86, 184, 41, 4, 168, 41, 36, 186, 40, 2, 99, 177, 155, 49, 3, 223, 24, 145, 172, 137, 128, 218, 139, 21, 189, 81, 176, 26, 4, 169, 128, 33, 131, 154, 32, 37, 249, 11, 18, 152, 154, 81, 128, 65, 184, 119, 189, 4, 45, 0, 145, 57, 21, 8, 33, 49, 66, 52, 35, 49, 67, 2, 24, 23, 152, 50, 50, 131, 42, 22, 188, 9, 217, 10, 20, 202, 113, 131, 11, 67, 129, 170, 16, 144, 64, 3, 82, 20, 160, 10, 146, 239, 137, 169, 136, 205, 25, 160, 173, 8, 160, 190, 16, 200, 138, 2, 169, 171, 85, 216, 10, 3, 219, 9, 2, 203, 56, 192, 174, 17, 184, 156, 17, 219, 26, 3, 205, 48, 20, 202, 41, 36, 185, 137, 136, 24, 233, 140, 83, 192, 171, 152, 202, 203, 189, 155, 16, 168, 26, 119, 3, 17, 67, 51, 36, 51, 53, 52, 36, 33, 52, 18, 0, 16, 8, 185, 203, 170, 188, 190, 173, 171, 219, 171, 187, 187, 186, 203, 154, 186, 171, 153, 172, 137, 153, 168, 175, 136, 236, 153, 185, 204, 138, 185, 173, 152, 186, 173, 138, 168, 139, 67, 16, 36, 33, 68, 35, 34, 99, 36, 34, 68, 34, 1, 1, 169, 25, 219, 41, 162, 173, 128, 184, 207, 153, 168, 204, 155, 17, 251, 9, 184, 171, 203, 170, 204, 154, 202, 187, 169, 188, 154, 249, 139, 19, 172, 81, 34, 51, 33, 68, 53, 3, 49, 55, 17, 34, 84, 2, 24, 36, 144, 16, 51, 144, 25, 19, 144, 188, 48, 216, 72, 4, 25, 34, 48, 4, 170, 112, 35, 8, 50, 87, 177, 28, 21, 169, 48, 129, 8, 67, 163, 28, 6, 154, 82, 144, 136, 82, 145, 12, 37, 186, 32, 17, 2, 11, 87, 144, 49, 3, 8, 83, 19, 41, 38, 152, 64, 19, 184, 90, 21, 204, 56, 146, 203, 25, 146, 141, 33, 154, 1, 153, 2, 142, 22, 156, 50, 169, 33, 128, 144, 56, 5, 172, 49, 48, 164, 159, 35, 219, 8, 34, 216, 74, 3, 10, 129, 25, 38, 144, 24, 55, 200, 41, 146, 56, 184, 113, 3, 170, 25, 21, 250, 25, 130, 136, 137, 51, 202, 32, 153, 66, 218, 96, 18, 137, 8, 16, 1, 233, 28, 5, 205, 0, 185, 170, 170, 202, 187, 169, 190, 169, 140, 144, 138, 146, 59, 151, 141, 3, 156, 52, 129, 115, 18, 152, 48, 224, 141, 130, 170, 9, 16, 176, 188, 202, 138, 233, 157, 0, 8, 168, 26, 34, 17, 185, 112, 39, 24, 17, 137, 68, 160, 25, 53, 160, 141, 33, 185, 41, 1, 0, 251, 187, 204, 188, 172, 24, 201, 140, 33, 192, 190, 138, 153, 170, 25, 85, 35, 34, 53, 34, 82, 51, 83, 52, 34, 68, 2, 66, 18, 16, 17, 18, 153, 137, 136, 200, 189, 170, 202, 188, 173, 185, 188, 136, 219, 154, 201, 155, 201, 189, 9, 184, 156, 168, 219, 187, 188, 172, 188, 153, 168, 153, 153, 168, 204, 186, 156, 152, 24, 19, 96, 35, 137, 33, 2, 129, 56, 69, 115, 18, 24, 52, 3, 138, 98, 18, 65, 19, 114, 35, 0, 49, 160, 170, 220, 172, 137, 235, 203, 186, 189, 189, 187, 204, 170, 203, 154, 201, 154, 57, 211, 42, 0, 144, 186, 11, 136, 57, 38, 66, 53, 34, 83, 2, 33, 35, 82, 37, 34, 67, 34, 1, 17, 8, 66, 129, 64, 51, 34, 184, 114, 146, 98, 144, 85, 145, 72, 3, 9, 1, 34, 19, 40, 70, 3, 138, 49, 0, 18, 137, 119, 129, 25, 35, 34, 146, 112, 23, 153, 51, 177, 58, 22, 154, 66, 130, 40, 3, 41, 36, 0, 49, 20, 67, 37, 16, 32, 33, 176, 44, 55, 152, 32, 202, 203, 189, 171, 138, 169, 155, 50, 177, 255, 170, 170, 170, 154, 136, 8, 49, 192, 172, 0, 202, 139, 34, 185, 90, 36, 49, 20, 32, 36, 83, 20, 48, 53, 34, 51, 99, 19, 48, 147, 75, 87, 0, 84, 2, 32, 4, 153, 49, 161, 88, 147, 139, 130, 191, 17, 233, 40, 3, 10, 130, 171, 17, 238, 26, 3, 171, 66, 200, 25, 250, 12, 129, 170, 18, 170, 16, 220, 24, 184, 41, 179, 159, 1, 188, 153, 171, 115, 162, 139, 36, 184, 220, 173, 17, 235, 26, 146, 10, 2, 189, 64, 161, 139, 20, 153, 33, 184, 72, 36, 0, 169, 40, 3, 239, 25, 18, 16, 224, 26, 6, 219, 26, 160, 170, 128, 154, 67, 248, 156, 144, 202, 170, 185, 9, 2, 203, 188, 172, 205, 172, 153, 8, 51, 2, 115, 52, 129, 65, 52, 34, 68, 67, 36, 35, 36, 19, 33, 35, 16, 65, 18, 16, 128, 169, 152, 236, 171, 154, 186, 205, 138, 184, 191, 137, 202, 156, 169, 171, 152, 220, 137, 218, 171, 185, 191, 136, 186, 10, 168, 171, 144, 190, 138, 169, 138, 0, 50, 35, 66, 37, 160, 49, 178, 91, 37, 64, 37, 8, 84, 176, 41, 132, 11, 55, 145, 113, 18, 25, 34, 168, 16, 168, 138, 216, 188, 170, 221, 203, 187, 189, 188, 187, 203, 172, 170, 170, 203, 170, 170, 154, 9, 50, 51, 84, 34, 34, 50, 69, 67, 52, 83, 52, 17, 50, 2, 33, 50, 84, 34, 66, 37, 17, 66, 1, 97, 51, 16, 52, 34, 36, 0, 66, 34, 17, 16, 116, 129, 9, 52, 168, 64, 1, 96, 3, 10, 52, 8, 67, 1, 98, 3, 8, 33, 128, 8, 33, 2, 153, 82, 161, 206, 155, 8, 219, 56, 20, 49, 36, 169, 169, 206, 138, 17, 160, 10, 70, 184, 154, 202, 171, 160, 157, 0, 205, 16, 176, 189, 136, 144, 171, 65, 130, 171, 24, 128, 201, 175, 81, 177, 190, 16, 129, 220, 10, 17, 202, 155, 34, 169, 72, 35, 2, 136, 170, 87, 232, 27, 5, 170, 65, 129, 66, 130, 41, 4, 204, 24, 152, 24, 17, 67, 160, 137, 250, 9, 2, 186, 49, 53, 128, 10, 216, 157, 144, 175, 56, 1, 169, 137, 137, 250, 205, 24, 161, 154, 1, 25, 232, 174, 9, 128, 219, 41, 130, 219, 138, 168, 203, 9, 145, 172, 186, 172, 204, 172, 48, 20, 25, 55, 146, 136, 169, 57, 135, 171, 101, 130, 9, 18, 152, 136, 210, 253, 34, 0, 153, 48, 36, 49, 35, 34, 147, 175, 24, 8, 50, 224, 42, 4, 154, 144, 11, 71, 144, 40, 20, 24, 130, 158, 114, 129, 9, 18, 19, 170, 88, 130, 137, 129, 156, 32, 232, 139, 68, 34, 66, 53, 20, 16, 34, 186, 72, 85, 34, 33, 53, 146, 187, 171, 205, 154, 152, 138, 35, 168, 137, 2, 253, 155, 1, 204, 154, 169, 171, 170, 189, 138, 136, 50, 17, 85, 129, 16, 176, 172, 251, 140, 169, 139, 1, 202, 25, 248, 142, 17, 153, 49, 19, 100, 130, 24, 18, 184, 189, 25, 145, 205, 57, 51, 152, 8, 86, 130, 155, 50, 192, 219, 203, 153, 168, 187, 25, 54, 161, 137, 33, 192, 191, 220, 172, 144, 202, 172, 25, 161, 190, 138, 168, 187, 188, 155, 97, 2, 48, 55, 53, 18, 33, 68, 34, 16, 50, 53, 35, 33, 83, 52, 1, 0, 51, 2, 16, 8, 64, 53, 152, 137, 67, 146, 203, 138, 128, 251, 171, 136, 201, 203, 172, 153, 221, 187, 186, 205, 186, 188, 173, 137, 202, 186, 170, 186, 203, 203, 187, 186, 204, 170, 169, 171, 155, 153, 220, 171, 154, 219, 171, 0, 186, 10, 51, 3, 24, 71, 145, 8, 34, 2, 42, 55, 169, 114, 130, 136, 1, 217, 155, 129, 234, 154, 0, 232, 138, 35, 234, 41, 36, 169, 64, 54, 1, 50, 37, 34, 19, 48, 55, 146, 10, 19, 1, 65, 50, 34, 99, 69, 34, 50, 18, 50, 18, 66, 53, 33, 99, 52, 36, 128, 81, 35, 0, 64, 67, 35, 51, 83, 52, 20, 18, 83, 20, 17, 18, 35, 35, 1, 16, 144, 10, 68, 35, 83, 36, 35, 50, 36, 224, 155, 34, 9, 114, 50, 51, 38, 1, 8, 16, 144, 173, 48, 161, 204, 155, 82, 232, 174, 136, 160, 187, 25, 129, 168, 187, 186, 137, 208, 142, 33, 187, 99, 0, 49, 36, 177, 223, 9, 168, 189, 56, 19, 9, 33, 33, 240, 174, 153, 156, 136, 138, 33, 168, 40, 130, 253, 154, 168, 187, 202, 10, 19, 136, 152, 48, 232, 154, 33, 4, 206, 48, 147, 27, 39, 129, 153, 66, 129, 9, 51, 129, 113, 3, 205, 154, 24, 34, 128, 50, 53, 3, 9, 68, 145, 72, 103, 2, 50, 130, 26, 36, 184, 16, 217, 25, 20, 249, 155, 16, 202, 26, 34, 144, 48, 129, 136, 185, 42, 209, 27, 248, 175, 137, 16, 19, 217, 173, 32, 208, 172, 32, 18, 218, 43, 21, 250, 171, 153, 186, 203, 170, 9, 144, 155, 100, 2, 186, 41, 21, 1, 201, 58, 55, 1, 170, 57, 38, 184, 172, 48, 161, 156, 137, 16, 249, 187, 138, 129, 220, 25, 18, 145, 250, 219, 187, 219, 189, 155, 137, 128, 187, 49, 53, 144, 156, 83, 2, 169, 40, 55, 34, 50, 66, 68, 19, 1, 50, 3, 24, 68, 19, 33, 99, 36, 49, 35, 50, 37, 18, 49, 69, 19, 32, 37, 18, 33, 34, 19, 0, 16, 39, 10, 18, 0, 145, 239, 9, 218, 155, 168, 189, 136, 168, 204, 153, 220, 187, 169, 203, 188, 172, 171, 186, 203, 202, 173, 171, 203, 187, 189, 170, 171, 170, 156, 128, 204, 137, 201, 10, 168, 172, 25, 1, 186, 10, 168, 188, 205, 25, 19, 168, 57, 119, 144, 187, 138, 1, 251, 24, 19, 17, 68, 68, 129, 0, 67, 19, 8, 17, 114, 52, 17, 50, 53, 52, 33, 34, 2, 0, 49, 69, 18, 24, 68, 17, 33, 128, 81, 20, 0, 49, 145, 56, 176, 44, 22, 9, 116, 51, 2, 8, 18, 1, 152, 154, 116, 22, 34, 67, 53, 35, 32, 34, 130, 153, 82, 2, 16, 50, 38, 153, 34, 169, 18, 139, 69, 68, 36, 99, 35, 33, 68, 18, 1, 8, 100, 2, 32, 17, 50, 2, 49, 216, 72, 2, 16, 208, 157, 169, 219, 187, 173, 137, 169, 154, 16, 35, 250, 158, 153, 205, 154, 202, 153, 186, 9, 201, 187, 219, 172, 170, 203, 171, 138, 154, 33, 152, 201, 158, 49, 152, 152, 172, 100, 161, 25, 192, 26, 161, 141, 146, 156, 17, 72, 20, 48, 71, 50, 18, 17, 34, 81, 37, 16, 52, 33, 51, 33, 152, 114, 3, 8, 176, 175, 80, 177, 174, 48, 19, 153, 65, 52, 34, 144, 0, 250, 187, 32, 177, 173, 40, 52, 192, 139, 1, 136, 252, 156, 160, 10, 2, 137, 17, 80, 21, 188, 138, 138, 67, 160, 9, 8, 68, 161, 189, 204, 153, 202, 154, 186, 10, 34, 0, 128, 184, 207, 32, 161, 139, 2, 24, 52, 136, 117, 161, 203, 9, 34, 240, 188, 188, 140, 184, 191, 10, 17, 129, 204, 8, 184, 205, 173, 137, 137, 8, 17, 69, 18, 33, 128, 33, 144, 0, 33, 71, 34, 100, 50, 50, 2, 50, 2, 17, 34, 101, 3, 72, 20, 16, 19, 24, 35, 49, 36, 0, 51, 35, 37, 136, 32, 200, 58, 20, 234, 188, 137, 252, 173, 154, 0, 201, 138, 33, 33, 232, 155, 168, 190, 188, 187, 172, 203, 154, 202, 203, 188, 171, 218, 172, 170, 170, 152, 172, 8, 169, 170, 171, 136, 204, 25, 129, 49, 224, 11, 163, 175, 8, 8, 128, 48, 20, 153, 236, 155, 233, 173, 154, 41, 130, 10, 69, 18, 0, 40, 51, 144, 8, 101, 51, 136, 114, 53, 18, 1, 99, 19, 169, 56, 36, 1, 24, 68, 20, 136, 33, 68, 3, 137, 66, 36, 146, 11, 52, 17, 34, 16, 70, 51, 1, 40, 53, 0, 83, 17, 70, 3, 33, 51, 68, 2, 64, 20, 136, 17, 0, 152, 64, 20, 49, 39, 184, 27, 19, 219, 154, 1, 33, 69, 19, 84, 36, 18, 33, 35, 176, 11, 67, 161, 171, 114, 21, 160, 172, 16, 193, 191, 154, 152, 202, 172, 0, 169, 171, 172, 168, 206, 170, 171, 186, 188, 156, 152, 219, 138, 128, 235, 155, 137, 201, 173, 8, 8, 33, 203, 96, 2, 152, 154, 48, 209, 171, 0, 24, 1, 57, 87, 44, 253, 29, 0, 33, 34, 24, 69, 145, 8, 82, 68, 1, 66, 53, 34, 17, 83, 19, 0, 80, 68, 129, 16, 34, 36, 152, 9, 146, 137, 145, 191, 8, 236, 9, 128, 16, 169, 117, 19, 32, 20, 49, 3, 189, 155, 169, 205, 155, 50, 1, 16, 129, 202, 206, 235, 187, 170, 171, 56, 1, 32, 19, 97, 20, 185, 172, 65, 4, 153, 40, 70, 130, 170, 137, 201, 175, 138, 152, 170, 56, 3, 170, 186, 28, 21, 202, 170, 112, 37, 152, 8, 52, 146, 202, 138, 185, 238, 172, 153, 187, 187, 24, 34, 136, 65, 83, 36, 153, 49, 2, 17, 24, 71, 33, 66, 19, 34, 168, 154, 186, 156, 136, 32, 53, 69, 34, 52, 20, 34, 83, 68, 18, 82, 35, 1, 51, 34, 128, 128, 202, 156, 200, 205, 186, 202, 203, 9, 144, 187, 97, 3, 185, 138, 1, 251, 171, 170, 154, 251, 157, 169, 235, 187, 172, 203, 170, 187, 170, 154, 171, 138, 16, 200, 155, 66, 19, 136, 8, 18, 219, 221, 189, 155, 235, 187, 153, 169, 170, 187, 137, 202, 219, 170, 32, 146, 74, 71, 0, 24, 67, 19, 169, 137, 82, 131, 205, 56, 52, 1, 115, 52, 34, 129, 64, 36, 128, 32, 84, 35, 0, 49, 67, 19, 32, 83, 130, 153, 82, 146, 170, 49, 55, 129, 64, 54, 34, 17, 64, 53, 128, 136, 98, 19, 128, 49, 86, 18, 136, 33, 36, 192, 138, 99, 129, 8, 66, 36, 152, 40, 129, 32, 201, 88, 37, 34, 1, 114, 130, 154, 128, 9, 129, 41, 71, 51, 19, 98, 52, 152, 25, 18, 204, 10, 1, 138, 66, 160, 11, 2, 186, 236, 170, 201, 140, 168, 172, 128, 202, 128, 234, 171, 172, 137, 221, 155, 168, 154, 217, 172, 128, 205, 137, 152, 170, 11, 1, 220, 137, 169, 138, 218, 186, 42, 38, 218, 10, 17, 176, 204, 136, 144, 187, 136, 98, 19, 137, 102, 3, 144, 0, 65, 37, 1, 65, 52, 1, 8, 17, 176, 203, 24, 131, 189, 64, 1, 144, 9, 131, 173, 136, 175, 83, 161, 43, 54, 52, 145, 90, 37, 185, 154, 17, 176, 175, 154, 153, 186, 190, 137, 185, 158, 32, 130, 188, 56, 55, 160, 154, 83, 130, 187, 8, 68, 146, 41, 55, 18, 184, 138, 16, 200, 191, 25, 34, 176, 27, 55, 20, 144, 9, 67, 145, 189, 24, 53, 144, 156, 49, 145, 222, 154, 137, 186, 173, 8, 16, 136, 32, 84, 2, 153, 50, 162, 187, 0, 32, 160, 43, 71, 36, 145, 9, 51, 169, 33, 8, 118, 51, 50, 52, 38, 18, 50, 3, 24, 18, 66, 129, 10, 68, 37, 160, 41, 6, 186, 136, 186, 188, 154, 176, 140, 129, 174, 115, 146, 170, 137, 169, 204, 220, 171, 137, 251, 188, 153, 169, 189, 154, 169, 172, 171, 152, 203, 154, 170, 137, 168, 188, 153, 205, 139, 201, 205, 139, 136, 235, 187, 138, 16, 220, 138, 1, 144, 152, 8, 2, 240, 23, 0, 130, 206, 138, 168, 172, 169, 40, 51, 1, 81, 70, 130, 170, 155, 136, 218, 171, 88, 71, 1, 82, 34, 1, 0, 16, 19, 9, 100, 35, 18, 35, 33, 54, 161, 25, 34, 18, 50, 1, 25, 70, 160, 58, 87, 17, 97, 20, 0, 17, 34, 2, 24, 35, 8, 68, 53, 35, 2, 33, 69, 176, 140, 18, 1, 200, 11, 38, 185, 9, 51, 184, 112, 87, 17, 49, 68, 51, 18, 152, 32, 131, 139, 1, 97, 51, 50, 67, 85, 18, 33, 35, 18, 136, 116, 19, 0, 137, 48, 130, 217, 173, 0, 251, 154, 186, 188, 187, 171, 186, 170, 153, 129, 236, 203, 155, 202, 205, 170, 154, 186, 171, 137, 171, 219, 191, 171, 202, 172, 169, 170, 187, 137, 186, 189, 136, 128, 48, 20, 33, 130, 190, 48, 129, 202, 13, 119, 19, 33, 34, 17, 168, 173, 169, 203, 41, 34, 82, 37, 17, 36, 144, 8, 51, 177, 89, 71, 51, 1, 8, 32, 129, 187, 170, 155, 114, 18, 0, 200, 172, 0, 168, 32, 130, 112, 71, 129, 9, 144, 188, 156, 170, 154, 64, 67, 33, 51, 51, 3, 252, 12, 67, 192, 173, 48, 37, 169, 155, 50, 51, 1, 0, 144, 24, 209, 223, 138, 153, 171, 8, 145, 186, 154, 81, 163, 255, 140, 136, 184, 171, 40, 35, 129, 49, 69, 35, 1, 154, 137, 128, 170, 115, 36, 50, 20, 8, 67, 144, 72, 20, 32, 69, 52, 33, 32, 35, 144, 138, 84, 3, 136, 49, 3, 10, 51, 17, 85, 52, 33, 67, 53, 129, 202, 190, 219, 204, 171, 137, 201, 138, 50, 145, 219, 171, 8, 249, 173, 154, 136, 186, 154, 204, 138, 202, 188, 220, 155, 153, 153, 185, 154, 8, 0, 235, 138, 17, 217, 188, 203, 173, 169, 202, 154, 170, 56, 160, 57, 209, 156, 161, 191, 187, 156, 152, 153, 8, 8, 152, 56, 39, 200, 156, 0, 200, 157, 24, 49, 39, 32, 53, 129, 128, 155, 136, 138, 70, 19, 50, 52, 3, 9, 50, 50, 53, 67, 85, 34, 24, 67, 130, 9, 53, 2, 117, 20, 128, 66, 2, 137, 16, 33, 1, 8, 66, 17, 67, 68, 51, 128, 32, 1, 1, 114, 54, 35, 19, 32, 21, 41, 70, 18, 51, 69, 36, 0, 16, 128, 0, 168, 10, 50, 70, 51, 50, 35, 0, 153, 9, 160, 59, 119, 1, 128, 185, 173, 136, 251, 154, 168, 186, 171, 189, 137, 201, 155, 64, 36, 129, 33, 192, 205, 236, 171, 154, 171, 137, 154, 34, 251, 138, 170, 152, 189, 8, 169, 16, 202, 32, 251, 32, 129, 128, 173, 66, 144, 113, 18, 50, 131, 24, 192, 173, 8, 48, 178, 123, 39, 16, 35, 0, 16, 0, 128, 186, 154, 16, 144, 139, 103, 18, 82, 35, 168, 171, 0, 250, 155, 114, 69, 17, 32, 51, 36, 169, 187, 205, 203, 186, 137, 32, 53, 67, 50, 128, 186, 235, 187, 156, 170, 42, 55, 1, 50, 26, 7, 32, 0, 2, 168, 170, 220, 204, 171, 153, 16, 128, 25, 35, 137, 85, 34, 65, 34, 0, 136, 169, 188, 9, 176, 141, 101, 130, 186, 138, 216, 223, 172, 9, 136, 153, 32, 19, 217, 173, 170, 186, 191, 137, 0, 153, 24, 18, 128, 136, 152, 49, 17, 50, 3, 17, 130, 222, 89, 38, 8, 98, 51, 51, 19, 24, 70, 1, 32, 68, 51, 37, 1, 33, 3, 128, 49, 37, 16, 83, 35, 50, 35, 32, 35, 32, 54, 48, 71, 129, 137, 0, 144, 186, 206, 10, 2, 221, 203, 171, 202, 173, 9, 152, 136, 154, 8, 186, 189, 189, 185, 206, 154, 153, 153, 188, 186, 188, 188, 154, 136, 184, 138, 18, 169, 223, 156, 152, 251, 170, 152, 154, 137, 169, 188, 138, 218, 154, 169, 156, 34, 129, 251, 156, 129, 220, 154, 8, 184, 156, 16, 128, 184, 121, 53, 67, 51, 49, 54, 168, 138, 136, 1, 234, 42, 67, 33, 32, 102, 3, 8, 51, 2, 128, 32, 53, 2, 32, 71, 18, 24, 18, 169, 154, 220, 155, 153, 65, 34, 84, 67, 67, 51, 50, 34, 18, 67, 34, 129, 9, 84, 177, 27, 55, 136, 65, 3, 16, 52, 2, 101, 19, 65, 52, 33, 17, 129, 218, 170, 204, 155, 153, 48, 38, 35, 67, 35, 144, 8, 129, 65, 36, 129, 152, 169, 237, 205, 203, 170, 154, 8, 144, 40, 2, 170, 186, 207, 8, 144, 48, 69, 130, 26, 34, 234, 187, 171, 64, 68, 19, 65, 21, 152, 137, 187, 25, 65, 68, 68, 35, 50, 146, 188, 219, 204, 155, 24, 129, 9, 34, 153, 56, 68, 35, 115, 20, 136, 8, 161, 220, 203, 204, 154, 152, 137, 1, 129, 186, 64, 146, 158, 97, 19, 169, 138, 200, 206, 171, 203, 10, 152, 56, 38, 1, 24, 0, 204, 154, 152, 9, 66, 53, 35, 1, 216, 189, 172, 154, 128, 72, 54, 68, 19, 144, 8, 218, 171, 138, 32, 68, 52, 35, 51, 162, 188, 170, 220, 171, 16, 144, 0, 129, 220, 155, 153, 136, 18, 129, 49, 210, 190, 217, 207, 186, 187, 154, 153, 136, 169, 203, 221, 187, 171, 137, 0, 34, 68, 2, 152, 0, 250, 188, 155, 9, 48, 52, 34, 68, 129, 187, 24, 2, 113, 53, 50, 53, 50, 85, 35, 160, 25, 67, 129, 25, 101, 18, 33, 34, 35, 0, 16, 33, 84, 20, 82, 37, 18, 2, 0, 152, 137, 154, 154, 8, 115, 36, 51, 0, 82, 2, 235, 138, 2, 206, 138, 168, 187, 170, 188, 172, 170, 186, 153, 187, 172, 25, 162, 191, 204, 170, 201, 223, 171, 187, 203, 187, 137, 8, 32, 68, 129, 152, 221, 155, 185, 189, 154, 153, 8, 0, 144, 171, 185, 207, 25, 34, 128, 66, 53, 128, 0, 18, 202, 186, 219, 57, 55, 83, 83, 34, 33, 50, 18, 33, 68, 51, 35, 66, 52, 0, 65, 20, 16, 84, 67, 35, 51, 52, 51, 1, 8, 115, 51, 34, 36, 121, 8, 29, 0, 17, 16, 18, 0, 80, 20, 170, 41, 162, 239, 138, 202, 172, 8, 17, 53, 18, 168, 171, 233, 206, 138, 168, 137, 152, 138, 184, 205, 186, 171, 160, 10, 85, 50, 34, 2, 217, 203, 219, 188, 155, 25, 18, 68, 20, 16, 35, 1, 50, 18, 98, 68, 36, 136, 32, 146, 204, 154, 32, 36, 17, 68, 53, 2, 9, 33, 176, 175, 33, 144, 154, 128, 218, 189, 155, 154, 32, 216, 10, 19, 251, 203, 187, 220, 187, 154, 33, 2, 152, 202, 236, 204, 171, 154, 9, 136, 66, 131, 155, 129, 188, 221, 171, 137, 8, 0, 66, 35, 184, 187, 203, 154, 171, 113, 53, 20, 0, 115, 18, 184, 26, 68, 129, 56, 71, 18, 1, 50, 17, 1, 136, 50, 99, 51, 49, 87, 18, 2, 17, 35, 136, 50, 50, 55, 34, 83, 51, 18, 8, 84, 176, 140, 17, 217, 155, 24, 144, 41, 2, 24, 50, 2, 253, 171, 219, 138, 1, 154, 1, 201, 203, 237, 204, 188, 153, 186, 155, 49, 52, 36, 33, 34, 250, 155, 169, 172, 155, 136, 201, 156, 154, 138, 201, 11, 98, 55, 19, 49, 37, 2, 152, 138, 186, 172, 153, 40, 21, 0, 115, 19, 129, 49, 54, 68, 19, 49, 19, 185, 205, 204, 170, 171, 137, 16, 1, 49, 2, 185, 154, 40, 50, 117, 19, 17, 216, 207, 186, 187, 188, 155, 16, 184, 157, 136, 218, 203, 154, 137, 50, 34, 85, 146, 219, 187, 202, 206, 10, 32, 0, 136, 32, 145, 188, 137, 48, 38, 65, 85, 34, 0, 144, 169, 170, 170, 10, 85, 67, 52, 52, 34, 0, 32, 50, 52, 51, 71, 67, 34, 129, 9, 152, 172, 154, 32, 68, 67, 51, 50, 129, 204, 153, 186, 174, 24, 129, 170, 168, 221, 204, 187, 169, 154, 168, 156, 136, 203, 188, 221, 172, 171, 170, 137, 33, 2, 1, 233, 205, 187, 171, 154, 138, 32, 16, 136, 8, 208, 207, 154, 137, 8, 65, 53, 18, 35, 217, 170, 203, 171, 8, 48, 68, 53, 67, 53, 129, 153, 40, 18, 170, 115, 23, 33, 17, 17, 160, 137, 153, 73, 69, 50, 69, 18, 17, 2, 168, 153, 17, 8, 36, 33, 71, 2, 9, 24, 136, 168, 56, 54, 176, 172, 185, 191, 171, 170, 153, 33, 1, 82, 3, 202, 170, 202, 239, 171, 155, 136, 202, 156, 169, 187, 203, 138, 35, 40, 119, 3, 17, 168, 187, 169, 221, 186, 137, 128, 33, 35, 16, 50, 128, 114, 69, 2, 33, 36, 2, 16, 17, 129, 186, 9, 185, 119, 37, 66, 35, 16, 50, 34, 1, 66, 53, 130, 9, 66, 200, 155, 49, 130, 98, 53, 51, 34, 18, 8, 176, 255, 139, 153, 136, 144, 138, 49, 161, 219, 170, 128, 237, 155, 136, 217, 156, 136, 186, 204, 155, 25, 18, 202, 11, 200, 191, 187, 156, 137, 136, 168, 188, 203, 188, 187, 10, 52, 67, 51, 69, 35, 136, 136, 152, 218, 189, 170, 27, 251, 26, 0, 72, 38, 33, 68, 18, 136, 48, 37, 16, 68, 35, 18, 128, 17, 144, 251, 171, 66, 2, 40, 86, 51, 16, 17, 0, 0, 8, 17, 138, 102, 2, 137, 9, 144, 171, 176, 207, 32, 160, 24, 35, 130, 223, 187, 189, 187, 203, 137, 16, 33, 128, 84, 192, 203, 187, 137, 218, 9, 144, 48, 209, 156, 144, 187, 155, 80, 35, 64, 54, 51, 2, 136, 144, 153, 252, 11, 3, 170, 26, 103, 2, 24, 19, 136, 34, 17, 161, 140, 51, 145, 24, 177, 223, 65, 18, 40, 34, 49, 38, 136, 34, 234, 137, 136, 185, 190, 138, 186, 9, 216, 138, 185, 173, 48, 240, 175, 185, 172, 137, 186, 154, 1, 129, 153, 8, 168, 219, 222, 138, 128, 186, 138, 17, 249, 190, 187, 202, 203, 56, 51, 49, 52, 83, 145, 170, 234, 187, 204, 155, 8, 32, 49, 36, 129, 66, 146, 203, 189, 56, 38, 32, 67, 34, 160, 186, 189, 40, 35, 81, 20, 128, 137, 137, 200, 42, 53, 84, 36, 50, 37, 144, 138, 8, 202, 41, 52, 68, 2, 24, 176, 189, 251, 139, 34, 0, 33, 84, 34, 48, 130, 137, 235, 9, 35, 176, 238, 138, 184, 155, 160, 12, 52, 168, 184, 206, 153, 169, 169, 25, 38, 129, 168, 25, 209, 159, 0, 138, 34, 40, 87, 129, 0, 128, 128, 219, 10, 152, 97, 37, 2, 68, 35, 128, 8, 1, 16, 136, 66, 20, 1, 99, 51, 160, 64, 69, 34, 33, 38, 2, 129, 203, 0, 153, 68, 18, 83, 34, 34, 217, 10, 145, 24, 3, 153, 8, 82, 161, 190, 235, 155, 154, 24, 36, 0, 68, 35, 176, 221, 154, 8, 184, 173, 66, 19, 201, 203, 24, 184, 158, 64, 54, 3, 24, 35, 185, 236, 155, 1, 152, 16, 48, 71, 168, 41, 1, 0, 185, 114, 130, 138, 34, 50, 129, 114, 54, 17, 137, 48, 18, 17, 16, 36, 160, 220, 188, 203, 154, 32, 144, 120, 37, 1, 128, 186, 219, 171, 203, 204, 154, 24, 129, 170, 138, 250, 172, 219, 172, 171, 155, 0, 201, 186, 153, 251, 191, 153, 153, 153, 172, 138, 170, 154, 186, 155, 26, 85, 18, 1, 32, 67, 200, 139, 17, 40, 39, 16, 84, 2, 8, 48, 51, 1, 115, 55, 50, 19, 32, 21, 169, 32, 128, 136, 152, 48, 21, 129, 32, 68, 34, 0, 114, 36, 33, 17, 8, 234, 205, 155, 144, 171, 9, 33, 200, 190, 137, 48, 232, 157, 34, 169, 10, 1, 152, 234, 172, 204, 172, 154, 137, 128, 128, 8, 34, 146, 223, 156, 169, 155, 128, 26, 68, 144, 9, 233, 189, 170, 170, 155, 8, 34, 52, 20, 16, 24, 38, 202, 9, 144, 138, 66, 87, 0, 49, 146, 139, 128, 156, 48, 82, 53, 69, 36, 16, 18, 145, 153, 153, 152, 155, 50, 83, 54, 67, 18, 34, 161, 89, 53, 128, 32, 50, 1, 172, 80, 20, 145, 154, 115, 131, 185, 26, 3, 20, 0, 20, 0, 219, 153, 65, 4, 154, 17, 251, 174, 153, 8, 153, 65, 37, 68, 160, 155, 129, 205, 187, 10, 17, 17, 50, 54, 146, 138, 49, 49, 3, 58, 119, 4, 128, 8, 18, 200, 203, 137, 51, 51, 102, 67, 17, 49, 35, 129, 136, 40, 34, 136, 16, 68, 51, 52, 129, 56, 3, 112, 21, 99, 51, 82, 37, 33, 34, 32, 18, 233, 171, 169, 203, 154, 81, 34, 52, 37, 2, 8, 152, 205, 170, 170, 40, 35, 82, 18, 186, 189, 236, 189, 156, 137, 152, 24, 82, 51, 129, 136, 144, 237, 170, 152, 152, 0, 128, 219, 203, 189, 169, 203, 9, 48, 55, 2, 33, 1, 185, 191, 187, 187, 154, 138, 99, 129, 153, 0, 144, 207, 154, 16, 53, 130, 48, 3, 219, 205, 172, 203, 154, 136, 1, 136, 1, 217, 203, 203, 187, 171, 41, 34, 100, 3, 8, 144, 186, 235, 156, 17, 152, 33, 84, 34, 152, 152, 8, 51, 48, 119, 21, 18, 33, 19, 185, 9, 83, 128, 25, 69, 2, 24, 0, 56, 147, 42, 119, 17, 24, 17, 128, 137, 203, 172, 8, 0, 40, 3, 184, 255, 171, 169, 185, 156, 48, 35, 18, 220, 187, 221, 203, 155, 137, 0, 17, 17, 1, 250, 189, 170, 203, 156, 40, 0, 0, 18, 184, 205, 155, 154, 24, 144, 41, 23, 152, 186, 207, 171, 172, 9, 66, 52, 51, 67, 129, 171, 203, 170, 8, 32, 68, 34, 17, 33, 248, 173, 186, 138, 34, 100, 52, 67, 36, 1, 128, 153, 155, 154, 169, 24, 50, 101, 36, 168, 155, 98, 2, 138, 71, 34, 17, 34, 36, 168, 137, 168, 10, 3, 65, 54, 1, 16, 34, 17, 65, 68, 83, 36, 34, 68, 19, 0, 1, 17, 201, 138, 34, 251, 26, 2, 137, 99, 18, 16, 84, 51, 51, 52, 35, 34, 4, 218, 203, 170, 136, 235, 171, 137, 10, 1, 116, 36, 64, 68, 1, 1, 184, 140, 136, 218, 154, 186, 172, 169, 187, 140, 24, 33, 114, 52, 18, 33, 35, 130, 204, 138, 169, 191, 170, 138, 34, 185, 26, 21, 128, 114, 53, 52, 35, 35, 160, 188, 189, 205, 154, 136, 8, 99, 34, 18, 145, 153, 153, 220, 172, 8, 128, 83, 19, 16, 20, 152, 219, 188, 154, 201, 172, 137, 168, 172, 0, 138, 65, 1, 114, 36, 144, 137, 201, 188, 186, 155, 49, 144, 235, 188, 138, 186, 189, 32, 70, 35, 81, 51, 129, 169, 186, 205, 189, 155, 137, 8, 32, 67, 35, 184, 139, 51, 251, 28, 69, 19, 185, 10, 35, 249, 205, 40, 1, 187, 138, 81, 146, 172, 16, 160, 207, 137, 152, 171, 0, 0, 169, 11, 18, 0, 194, 159, 50, 152, 64, 18, 0, 128, 200, 159, 67, 3, 82, 36, 17, 50, 34, 19, 153, 114, 36, 129, 49, 71, 128, 16, 0, 40, 67, 19, 65, 54, 129, 8, 176, 156, 201, 157, 0, 128, 80, 53, 131, 187, 32, 224, 205, 170, 170, 1, 32, 0, 136, 169, 170, 0, 200, 203, 203, 189, 169, 171, 137, 185, 11, 146, 238, 186, 171, 204, 203, 187, 154, 168, 140, 128, 185, 153, 186, 8, 251, 172, 187, 219, 204, 155, 9, 152, 154, 48, 35, 152, 48, 52, 145, 207, 10, 34, 184, 10, 68, 66, 19, 32, 54, 18, 99, 52, 34, 18, 137, 100, 2, 137, 66, 67, 37, 35, 51, 52, 2, 33, 36, 129, 48, 39, 16, 84, 52, 51, 50, 52, 18, 17, 85, 35, 0, 24, 83, 3, 9, 67, 36, 18, 8, 69, 3, 24, 68, 1, 40, 19, 168, 9, 66, 36, 1, 176, 157, 145, 174, 0, 138, 99, 33, 49, 71, 18, 0, 128, 136, 170, 88, 20, 8, 144, 173, 186, 203, 172, 137, 235, 41, 162, 174, 170, 186, 138, 65, 36, 51, 16, 1, 205, 220, 188, 186, 155, 185, 157, 16, 50, 19, 185, 25, 146, 221, 40, 130, 56, 53, 68, 130, 154, 218, 10, 1, 186, 136, 205, 41, 177, 153, 207, 96, 19, 16, 19, 33, 52, 145, 9, 234, 26, 4, 24, 54, 17, 84, 34, 18, 0, 185, 172, 32, 34, 1, 1, 0, 50, 131, 255, 172, 25, 34, 50, 17, 82, 52, 67, 130, 202, 139, 33, 146, 173, 16, 217, 139, 37, 184, 72, 38, 1, 1, 136, 138, 153, 137, 102, 146, 190, 25, 2, 160, 203, 154, 9, 51, 4, 250, 175, 16, 144, 155, 144, 188, 32, 186, 172, 188, 138, 51, 3, 24, 193, 174, 185, 191, 202, 188, 153, 9, 67, 216, 188, 170, 137, 221, 155, 169, 154, 168, 188, 137, 168, 202, 219, 189, 155, 136, 17, 169, 25, 208, 172, 33, 18, 33, 71, 2, 9, 52, 160, 88, 146, 64, 18, 64, 18, 68, 3, 81, 129, 42, 70, 34, 8, 115, 20, 0, 152, 65, 130, 153, 40, 84, 129, 16, 3, 49, 5, 153, 19, 169, 34, 169, 161, 239, 25, 168, 188, 9, 35, 160, 188, 138, 251, 138, 249, 154, 168, 26, 178, 173, 176, 175, 137, 219, 154, 153, 25, 129, 0, 1, 171, 24, 129, 233, 191, 41, 216, 173, 185, 156, 152, 173, 18, 202, 24, 136, 2, 171, 101, 129, 136, 8, 2, 171, 33, 185, 201, 175, 144, 11, 129, 112, 5, 8, 128, 188, 26, 34, 152, 112, 55, 0, 33, 160, 137, 217, 9, 176, 11, 52, 67, 4, 16, 53, 144, 58, 39, 16, 18, 139, 38, 186, 66, 128, 98, 1, 68, 144, 25, 146, 10, 146, 12, 19, 72, 38, 8, 51, 0, 1, 136, 192, 175, 32, 33, 52, 160, 138, 32, 1, 25, 36, 115, 69, 66, 36, 1, 8, 144, 81, 161, 80, 37, 32, 35, 152, 169, 10, 39, 128, 83, 145, 34, 201, 48, 217, 72, 1, 97, 145, 137, 184, 73, 2, 81, 131, 138, 0, 48, 177, 13, 36, 115, 3, 155, 160, 158, 129, 157, 49, 169, 115, 1, 49, 129, 65, 146, 172, 136, 236, 204, 154, 8, 153, 26, 35, 1, 1, 186, 215, 3, 15, 0, 0, 88, 119, 3, 136, 144, 8, 136, 24, 144, 171, 204, 155, 186, 171, 96, 19, 9, 35, 128, 35, 81, 22, 168, 2, 204, 80, 35, 144, 101, 19, 185, 188, 188, 154, 18, 185, 65, 18, 136, 17, 168, 184, 255, 27, 129, 170, 189, 153, 251, 140, 128, 171, 32, 52, 3, 185, 56, 164, 189, 186, 11, 250, 142, 144, 153, 186, 139, 129, 205, 41, 36, 9, 66, 36, 145, 154, 33, 34, 233, 173, 137, 202, 203, 187, 26, 2, 137, 36, 252, 155, 9, 1, 154, 16, 128, 252, 157, 1, 153, 136, 137, 0, 251, 139, 128, 170, 10, 250, 139, 129, 171, 80, 39, 160, 41, 69, 130, 16, 144, 40, 147, 11, 21, 154, 81, 52, 52, 1, 98, 2, 138, 54, 128, 33, 185, 65, 200, 40, 160, 114, 146, 25, 162, 158, 128, 155, 67, 169, 98, 130, 16, 201, 171, 221, 172, 170, 153, 169, 24, 17, 169, 137, 221, 139, 2, 203, 170, 153, 136, 203, 113, 5, 154, 8, 115, 3, 10, 51, 16, 144, 173, 17, 234, 9, 184, 64, 194, 11, 129, 72, 3, 113, 4, 153, 1, 170, 168, 10, 18, 136, 223, 139, 152, 40, 21, 8, 18, 160, 237, 172, 170, 41, 3, 10, 87, 0, 17, 0, 16, 33, 18, 153, 153, 64, 36, 202, 113, 36, 65, 35, 8, 67, 16, 55, 130, 8, 16, 161, 255, 8, 0, 0, 128, 16, 130, 24, 130, 24, 19, 84, 36, 144, 152, 185, 189, 139, 128, 220, 40, 3, 8, 17, 16, 200, 187, 169, 155, 69, 65, 39, 186, 65, 1, 84, 1, 33, 144, 0, 0, 85, 129, 65, 50, 36, 137, 69, 1, 33, 129, 184, 207, 137, 152, 9, 160, 64, 146, 28, 69, 33, 3, 10, 53, 232, 11, 129, 155, 128, 24, 146, 191, 154, 185, 220, 138, 49, 83, 83, 129, 138, 168, 155, 128, 188, 97, 177, 158, 136, 186, 56, 36, 34, 130, 172, 24, 250, 175, 136, 17, 176, 43, 6, 187, 49, 68, 2, 24, 4, 205, 137, 154, 66, 1, 83, 51, 20, 137, 67, 128, 137, 48, 22, 153, 2, 155, 2, 175, 8, 203, 169, 188, 65, 233, 139, 128, 153, 233, 10, 3, 169, 186, 57, 161, 188, 220, 137, 170, 48, 69, 36, 185, 97, 208, 172, 1, 152, 185, 139, 1, 26, 132, 158, 66, 0, 17, 153, 49, 162, 12, 192, 172, 218, 10, 67, 35, 203, 101, 176, 11, 129, 10, 36, 49, 132, 40, 148, 174, 152, 206, 138, 136, 152, 187, 136, 202, 172, 170, 136, 251, 26, 1, 16, 129, 114, 21, 8, 19, 16, 19, 9, 0, 9, 168, 25, 160, 104, 4, 115, 55, 34, 35, 37, 144, 34, 144, 153, 189, 153, 203, 171, 170, 188, 41, 136, 84, 184, 89, 2, 24, 160, 56, 224, 139, 250, 139, 184, 172, 144, 152, 219, 203, 188, 40, 176, 97, 2, 52, 145, 152, 205, 154, 139, 18, 219, 26, 50, 36, 33, 116, 51, 33, 251, 254, 19, 0, 67, 52, 19, 34, 66, 53, 161, 32, 177, 188, 218, 204, 188, 138, 136, 0, 128, 115, 3, 25, 52, 2, 152, 186, 205, 25, 248, 156, 17, 184, 170, 153, 168, 187, 64, 52, 2, 65, 53, 128, 0, 138, 85, 18, 49, 51, 128, 9, 145, 173, 84, 160, 65, 19, 82, 146, 171, 1, 235, 155, 64, 144, 41, 38, 16, 2, 144, 170, 203, 138, 0, 168, 138, 200, 28, 5, 255, 10, 0, 153, 153, 81, 3, 153, 219, 25, 19, 49, 84, 4, 156, 66, 18, 1, 24, 67, 144, 187, 113, 19, 186, 172, 153, 201, 173, 25, 129, 204, 25, 192, 155, 82, 178, 156, 67, 145, 40, 69, 2, 0, 52, 2, 0, 218, 11, 3, 204, 171, 138, 128, 0, 184, 112, 37, 17, 24, 86, 19, 8, 24, 1, 251, 138, 1, 154, 217, 189, 138, 169, 138, 67, 129, 40, 54, 67, 34, 129, 49, 2, 216, 172, 187, 189, 187, 174, 136, 168, 26, 67, 128, 154, 40, 34, 18, 115, 36, 128, 33, 185, 173, 221, 138, 0, 9, 65, 34, 83, 2, 32, 19, 34, 50, 5, 168, 218, 203, 187, 189, 155, 137, 9, 17, 35, 1, 0, 0, 153, 25, 49, 49, 1, 32, 34, 144, 0, 186, 201, 170, 203, 137, 0, 32, 17, 48, 49, 1, 17, 17, 34, 160, 9, 153, 153, 153, 11, 144, 16, 0, 1, 17, 17, 18, 1, 153, 17, 33, 1, 9, 49, 145, 153, 17, 1, 144, 153, 16, 1, 0, 0, 16, 1, 9, 1, 0, 0, 0, 0, 16, 144, 0, 0, 153, 16, 144, 153, 17, 1, 0, 0, 16, 0, 9, 1, 0, 0, 153, 16, 1, 0, 153, 16, 145, 9, 16, 1, 0, 9, 1, 0, 25, 144, 16, 0, 0, 0, 0, 9, 1, 144, 16, 16, 144, 25, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 144, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16, 0, 0, 0, 0, 9, 0, 1, 0, 0, 0, 0, 0, 144, 0, 0, 1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0 };
 
-static const size_t audio_unknown_sample_data_length = sizeof(audio_unknown_sample_data) / sizeof(audio_unknown_sample_data[0]);
+static const size_t audio_unknown_sample_data_length = 33142;
@@ -1,22 +1,601 @@
-#include <float.h>
+#include <assert.h>
 #include <stddef.h>
+#include <stdio.h>
+#include <inttypes.h>
+
+#include <hardware/regs/addressmap.h>
 
 #include "cams.h"
-#include "cams_list.h"
-#include "gnss/gnss.h"
+#include "cams_db.h"
+#include "gnss/gnss_geo.h"
+
+// Database slots are read in place through XIP
+#ifndef CAMS_DB_SLOT_ADDRESS
+#define CAMS_DB_SLOT_ADDRESS(slot) (XIP_BASE + CAMS_DB_FLASH_OFFSET + (slot) * CAMS_DB_SLOT_SIZE)
+#endif
+
+// Sections of the active camera database, empty until cams_init() finds a valid one
+static const int32_t *cams_list_lat;
+static const int32_t *cams_list_lon;
+static const uint8_t *cams_list_limit;
+static const uint8_t *cams_list_direction;
+static size_t cams_list_length;
+
+static const uint32_t *cams_grid_cell_keys;
+static const uint32_t *cams_grid_cell_offsets;
+static size_t cams_grid_cells_length;
+static int32_t cams_grid_cell_size_e6;
+static int cams_grid_columns;
+static int cams_grid_rows;
+
+static const uint32_t *cams_kdtree;
+
+// Cells the grid search may visit, a few rows of a few columns even at high latitudes
+#define CAMS_GRID_MAX_SEARCH_CELLS 64
+
+// Cameras around the last refresh point, rebuilt when the vehicle has moved too far from it
+#define CAMS_CACHE_RADIUS_IN_METERS 3000
+#define CAMS_CACHE_MAX_CAMERAS      32
+
+// Only accessed by the task doing the camera lookups
+static struct {
+    bool valid;
+    struct gnss_position center;
+    uint32_t valid_radius_in_meters;
+    size_t length;
+    struct cams_camera_match cameras[CAMS_CACHE_MAX_CAMERAS];
+} cams_cache;
+
+static struct cams_cache_stats cams_cache_stats;
+
+// Heading cone, only cameras ahead of the vehicle monitoring its direction of travel pass it
+#define CAMS_CONE_HALF_ANGLE_DEG          60
+#define CAMS_CONE_DIRECTION_TOLERANCE_DEG 45
+// Cameras nearer than this are always ahead, we may be passing them
+#define CAMS_CONE_MIN_DISTANCE_IN_METERS  30
+
+struct cams_cone {
+    uint16_t course_deg;
+    int32_t course_sin_q14;
+    int32_t course_cos_q14;
+};
+
+static inline struct gnss_position cams_get_position(uint32_t id)
+{
+    return (struct gnss_position) {
+        .lat = cams_list_lat[id],
+        .lon = cams_list_lon[id],
+    };
+}
+
+static inline uint16_t cams_get_direction(uint32_t id)
+{
+    uint8_t direction = cams_list_direction[id];
+    return direction == CAMS_DB_DIRECTION_UNKNOWN ? CAMS_DIRECTION_UNKNOWN : direction * 2u;
+}
+
+static void cams_get_camera_info(struct cams_camera_info *cam, uint32_t id)
+{
+    cam->id = id;
+    cam->pos = cams_get_position(id);
+    cam->limit = cams_list_limit[id];
+    cam->direction_deg = cams_get_direction(id);
+}
+
+static void cams_cone_init(struct cams_cone *cone, uint16_t course_deg)
+{
+    cone->course_deg = course_deg % 360;
+    cone->course_sin_q14 = gnss_sin_q14(cone->course_deg * 1000000);
+    cone->course_cos_q14 = gnss_cos_q14(cone->course_deg * 1000000);
+}
+
+// Cheap check done before any distance is computed
+static bool cams_cone_accepts_direction(const struct cams_cone *cone, uint16_t direction_deg)
+{
+    if (cone == NULL || direction_deg == CAMS_DIRECTION_UNKNOWN) {
+        return true;
+    }
+
+    int32_t diff = (int32_t)direction_deg - cone->course_deg;
+    diff = diff < 0 ? -diff : diff;
+    if (diff > 180) {
+        diff = 360 - diff;
+    }
+    return diff <= CAMS_CONE_DIRECTION_TOLERANCE_DEG;
+}
+
+// Squared distance to the camera or GNSS_DISTANCE_FAR if it is outside of the cone
+static uint32_t cams_cone_distance(const struct cams_cone *cone, const struct gnss_position *pos, const struct gnss_position *cam_pos)
+{
+    int32_t east, north;
+    if (gnss_offset_in_meters(pos, cam_pos, &east, &north) == false) {
+        return GNSS_DISTANCE_FAR;
+    }
+
+    uint32_t dist = (uint32_t)(east * east) + (uint32_t)(north * north);
+    if (cone == NULL || dist < CAMS_CONE_MIN_DISTANCE_IN_METERS * CAMS_CONE_MIN_DISTANCE_IN_METERS) {
+        return dist;
+    }
+
+    // Projection of the camera offset on the course in Q14, compared against |offset| * cos(half angle)
+    int32_t dot = east * cone->course_sin_q14 + north * cone->course_cos_q14;
+    if (dot <= 0) {
+        return GNSS_DISTANCE_FAR;
+    }
+
+    int64_t cos_half_angle = gnss_cos_q14(CAMS_CONE_HALF_ANGLE_DEG * 1000000);
+    if ((int64_t)dot * dot < (int64_t)dist * cos_half_angle * cos_half_angle) {
+        return GNSS_DISTANCE_FAR;
+    }
+
+    return dist;
+}
+
+// Should be enough for 2^24 cameras
+#define CAMS_KDTREE_MAX_DEPTH 24
+
+struct cams_kdtree_subtree {
+    uint32_t lo;
+    uint32_t hi;
+    uint32_t depth;
+    uint32_t plane_distance_squared_in_meters;
+};
+
+static void cams_insert_match(struct cams_camera_match *matches, size_t *count, size_t max,
+                              uint32_t id, uint32_t dist)
+{
+    // Drop the farthest match if the list is full
+    size_t i = *count < max ? (*count)++ : max - 1;
+
+    while (i > 0 && matches[i - 1].distance_squared_in_meters > dist) {
+        matches[i] = matches[i - 1];
+        i--;
+    }
+
+    cams_get_camera_info(&matches[i].cam, id);
+    matches[i].distance_squared_in_meters = dist;
+}
+
+static int cams_grid_row(int32_t lat)
+{
+    int row = (lat + 90000000) / cams_grid_cell_size_e6;
+    return row < 0 ? 0 : (row >= cams_grid_rows ? cams_grid_rows - 1 : row);
+}
 
-void cams_get_nearest_camera(const struct cams_camera_info **cam, const struct gnss_position *pos)
+// Column of the longitude without clamping, below 0 and past the last one beyond the antimeridian
+static int64_t cams_grid_unwrapped_column(int64_t lon)
+{
+    int64_t x = lon + 180000000;
+    return x >= 0 ? x / cams_grid_cell_size_e6 : -((-x + cams_grid_cell_size_e6 - 1) / cams_grid_cell_size_e6);
+}
+
+// Index of the first non-empty grid cell with a key not below the given one
+static size_t cams_grid_lower_bound(uint32_t key)
+{
+    size_t lo = 0;
+    size_t hi = cams_grid_cells_length;
+
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (cams_grid_cell_keys[mid] < key) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+
+    return lo;
+}
+
+// Cells of a row are consecutive keys and their cameras consecutive ids, so a run of columns is one range of cameras
+static void cams_grid_search_columns(const struct gnss_position *pos, const struct cams_cone *cone, int row, int first_col, int last_col,
+                                     uint32_t max_dist, struct cams_camera_match *matches, size_t *count, size_t max)
+{
+    const uint32_t first_key = (uint32_t)row * cams_grid_columns + (uint32_t)first_col;
+    const uint32_t last_key = (uint32_t)row * cams_grid_columns + (uint32_t)last_col;
+    const uint32_t first = cams_grid_cell_offsets[cams_grid_lower_bound(first_key)];
+    const uint32_t last = cams_grid_cell_offsets[cams_grid_lower_bound(last_key + 1)];
+
+    for (uint32_t id=first; id<last; id++) {
+        // Cameras facing the wrong way don't even get a distance evaluation
+        if (cams_cone_accepts_direction(cone, cams_get_direction(id)) == false) {
+            continue;
+        }
+
+        const struct gnss_position cam_pos = cams_get_position(id);
+        uint32_t dist = cams_cone_distance(cone, pos, &cam_pos);
+        if (*count < max ? dist <= max_dist : dist < matches[max - 1].distance_squared_in_meters) {
+            cams_insert_match(matches, count, max, id, dist);
+        }
+    }
+}
+
+// Keeps the max nearest cameras within the radius and the cone, if any, from the grid cells it overlaps. Returns
+// false without searching if that's too many cells, close to the poles, then the k-d tree has to be used.
+static bool cams_grid_search(const struct gnss_position *pos, const struct cams_cone *cone, uint32_t radius_in_meters,
+                             struct cams_camera_match *matches, size_t max, size_t *count)
 {
-    assert(cam);
     assert(pos);
+    assert(matches);
+    assert(radius_in_meters <= UINT16_MAX);
+
+    *count = 0;
+    if (max == 0 || cams_list_length == 0) {
+        return true;
+    }
 
-    float min_dist = FLT_MAX;
+    // Microdegrees the radius spans, with a meter and a microdegree more for the rounding of the distance
+    const int32_t lat_span = (int32_t)(((radius_in_meters + 1) << 14) / GNSS_METERS_PER_E6_Q14) + 1;
+    const int32_t cos_lat_q14 = gnss_cos_q14(pos->lat);
+    if (cos_lat_q14 <= 0) {
+        return false;
+    }
+    // The distance shrinks the longitude difference with cos() of our latitude, widen the span by as much
+    const int64_t lon_span = ((int64_t)lat_span << 14) / cos_lat_q14 + 1;
+
+    const int first_row = cams_grid_row(pos->lat - lat_span);
+    const int last_row = cams_grid_row(pos->lat + lat_span);
+    const int64_t first_col = cams_grid_unwrapped_column((int64_t)pos->lon - lon_span);
+    const int64_t last_col = cams_grid_unwrapped_column((int64_t)pos->lon + lon_span);
+    if ((int64_t)(last_row - first_row + 1) * (last_col - first_col + 1) > CAMS_GRID_MAX_SEARCH_CELLS) {
+        return false;
+    }
 
-    for (size_t i=0; i<cams_list_length; i++) {
-        float dist = GNSS_DISTANCE_SQUARED_IN_METERS(cams_list[i].pos, *pos);
-        if (dist < min_dist) {
-            min_dist = dist;
-            *cam = &cams_list[i];
+    const uint32_t max_dist = radius_in_meters * radius_in_meters;
+    for (int row=first_row; row<=last_row; row++) {
+        // Split the columns at the antimeridian
+        if (first_col < 0) {
+            cams_grid_search_columns(pos, cone, row, (int)first_col + cams_grid_columns, cams_grid_columns - 1, max_dist, matches, count, max);
+            cams_grid_search_columns(pos, cone, row, 0, (int)last_col, max_dist, matches, count, max);
+        } else if (last_col >= cams_grid_columns) {
+            cams_grid_search_columns(pos, cone, row, (int)first_col, cams_grid_columns - 1, max_dist, matches, count, max);
+            cams_grid_search_columns(pos, cone, row, 0, (int)last_col - cams_grid_columns, max_dist, matches, count, max);
+        } else {
+            cams_grid_search_columns(pos, cone, row, (int)first_col, (int)last_col, max_dist, matches, count, max);
         }
     }
+
+    return true;
+}
+
+// Nearest first search of the implicit k-d tree, keeps the max nearest cameras not farther than max_dist
+static size_t cams_kdtree_search(const struct gnss_position *pos, const struct cams_cone *cone,
+                                 uint32_t max_dist, struct cams_camera_match *matches, size_t max)
+{
+    assert(pos);
+    assert(matches);
+
+    size_t count = 0;
+    if (max == 0 || cams_list_length == 0) {
+        return 0;
+    }
+
+    // Cameras too far away to measure never match
+    if (max_dist >= GNSS_DISTANCE_FAR) {
+        max_dist = GNSS_DISTANCE_FAR - 1;
+    }
+
+    struct cams_kdtree_subtree stack[CAMS_KDTREE_MAX_DEPTH];
+    size_t stack_length = 0;
+    stack[stack_length++] = (struct cams_kdtree_subtree) {
+        .lo = 0,
+        .hi = cams_list_length,
+        .depth = 0,
+        .plane_distance_squared_in_meters = 0,
+    };
+
+    while (stack_length > 0) {
+        struct cams_kdtree_subtree subtree = stack[--stack_length];
+
+        // Skip subtrees that are on the other side of a splitting plane farther than the worst match
+        uint32_t bound = count < max ? max_dist : matches[max - 1].distance_squared_in_meters;
+        if (subtree.plane_distance_squared_in_meters > bound) {
+            continue;
+        }
+
+        while (subtree.lo < subtree.hi) {
+            const uint32_t mid = subtree.lo + (subtree.hi - subtree.lo) / 2;
+            const uint32_t id = cams_kdtree[mid];
+            const struct gnss_position cam_pos = cams_get_position(id);
+
+            // Cameras facing the wrong way don't even get a distance evaluation
+            if (cams_cone_accepts_direction(cone, cams_get_direction(id))) {
+                uint32_t dist = cams_cone_distance(cone, pos, &cam_pos);
+                if (count < max ? dist <= max_dist : dist < matches[max - 1].distance_squared_in_meters) {
+                    cams_insert_match(matches, &count, max, id, dist);
+                }
+            }
+
+            // Distance from the position to the splitting plane
+            struct gnss_position plane = *pos;
+            bool near_is_low;
+            if (subtree.depth % 2 == 0) {
+                plane.lat = cam_pos.lat;
+                near_is_low = pos->lat < cam_pos.lat;
+            } else {
+                // The far side is also reached the other way around, across the antimeridian
+                near_is_low = pos->lon < cam_pos.lon;
+                if (near_is_low) {
+                    plane.lon = cam_pos.lon - pos->lon <= pos->lon + 180000000 ? cam_pos.lon : -180000000;
+                } else {
+                    plane.lon = pos->lon - cam_pos.lon <= 180000000 - pos->lon ? cam_pos.lon : 180000000;
+                }
+            }
+
+            struct cams_kdtree_subtree far = {
+                .lo = near_is_low ? mid + 1 : subtree.lo,
+                .hi = near_is_low ? subtree.hi : mid,
+                .depth = subtree.depth + 1,
+                .plane_distance_squared_in_meters = gnss_distance_squared_in_meters(pos, &plane),
+            };
+            if (far.lo < far.hi) {
+                assert(stack_length < CAMS_KDTREE_MAX_DEPTH);
+                stack[stack_length++] = far;
+            }
+
+            // Continue with the near side
+            subtree.lo = near_is_low ? subtree.lo : mid + 1;
+            subtree.hi = near_is_low ? mid : subtree.hi;
+            subtree.depth++;
+        }
+    }
+
+    return count;
+}
+
+size_t cams_k_nearest(const struct gnss_position *pos, size_t k, struct cams_camera_match *out)
+{
+    return cams_kdtree_search(pos, NULL, GNSS_DISTANCE_FAR, out, k);
+}
+
+static uint32_t cams_isqrt(uint32_t x)
+{
+    uint32_t root = 0;
+    uint32_t bit = 1u << 30;
+
+    while (bit > x) {
+        bit >>= 2;
+    }
+
+    while (bit != 0) {
+        if (x >= root + bit) {
+            x -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return root;
+}
+
+static void cams_cache_refresh(const struct gnss_position *pos)
+{
+    cams_cache.center = *pos;
+    // Without a cone on purpose: the cache serves every course, a refill whenever the course turns would
+    // defeat it. Lookups reject the cached cameras on direction before computing their distance.
+    if (cams_grid_search(pos, NULL, CAMS_CACHE_RADIUS_IN_METERS, cams_cache.cameras, CAMS_CACHE_MAX_CAMERAS, &cams_cache.length) == false) {
+        cams_cache.length = cams_kdtree_search(pos, NULL, CAMS_CACHE_RADIUS_IN_METERS * CAMS_CACHE_RADIUS_IN_METERS,
+                                               cams_cache.cameras, CAMS_CACHE_MAX_CAMERAS);
+    }
+
+    // When the cache is full only the cameras nearer than the farthest cached one are guaranteed to be in it
+    if (cams_cache.length < CAMS_CACHE_MAX_CAMERAS) {
+        cams_cache.valid_radius_in_meters = CAMS_CACHE_RADIUS_IN_METERS;
+    } else {
+        cams_cache.valid_radius_in_meters = cams_isqrt(cams_cache.cameras[CAMS_CACHE_MAX_CAMERAS - 1].distance_squared_in_meters);
+    }
+
+    cams_cache.valid = true;
+    cams_cache_stats.refreshes++;
+}
+
+// Check if every camera within the radius around the position is in the cache
+static bool cams_cache_covers(const struct gnss_position *pos, uint32_t radius_in_meters)
+{
+    if (cams_cache.valid == false) {
+        return false;
+    }
+
+    // Leave one meter for the distance rounding
+    if (cams_cache.valid_radius_in_meters <= radius_in_meters + 1) {
+        return false;
+    }
+
+    uint32_t max_moved = cams_cache.valid_radius_in_meters - radius_in_meters - 1;
+    return gnss_distance_squared_in_meters(&cams_cache.center, pos) <= max_moved * max_moved;
+}
+
+static size_t cams_cached_search(const struct gnss_position *pos, const struct cams_cone *cone,
+                                 uint32_t radius_in_meters, struct cams_camera_match *out, size_t max)
+{
+    assert(pos);
+    assert(out);
+    assert(radius_in_meters <= UINT16_MAX);
+
+    const uint32_t max_dist = radius_in_meters * radius_in_meters;
+
+    // Radiuses that would leave less than half of the cache for movement aren't worth caching
+    if (radius_in_meters >= CAMS_CACHE_RADIUS_IN_METERS / 2) {
+        size_t count;
+        if (cams_grid_search(pos, cone, radius_in_meters, out, max, &count)) {
+            return count;
+        }
+        return cams_kdtree_search(pos, cone, max_dist, out, max);
+    }
+
+    if (max == 0) {
+        return 0;
+    }
+
+    if (cams_cache_covers(pos, radius_in_meters)) {
+        cams_cache_stats.hits++;
+    } else {
+        cams_cache_refresh(pos);
+    }
+
+    size_t count = 0;
+
+    for (size_t i=0; i<cams_cache.length; i++) {
+        const struct cams_camera_info *cam = &cams_cache.cameras[i].cam;
+        if (cams_cone_accepts_direction(cone, cam->direction_deg) == false) {
+            continue;
+        }
+
+        uint32_t dist = cams_cone_distance(cone, pos, &cam->pos);
+        if (count < max ? dist <= max_dist : dist < out[max - 1].distance_squared_in_meters) {
+            cams_insert_match(out, &count, max, cam->id, dist);
+        }
+    }
+
+    return count;
+}
+
+size_t cams_within_radius(const struct gnss_position *pos, uint32_t radius_in_meters, struct cams_camera_match *out, size_t max)
+{
+    return cams_cached_search(pos, NULL, radius_in_meters, out, max);
+}
+
+size_t cams_ahead_within_radius(const struct gnss_position *pos, uint16_t course_deg, uint32_t radius_in_meters,
+                                struct cams_camera_match *out, size_t max)
+{
+    struct cams_cone cone;
+    cams_cone_init(&cone, course_deg);
+    return cams_cached_search(pos, &cone, radius_in_meters, out, max);
+}
+
+uint32_t cams_get_cached_radius(const struct gnss_position *pos)
+{
+    assert(pos);
+
+    if (cams_cache.valid == false) {
+        return 0;
+    }
+
+    // Inverse of cams_cache_covers(), rounding the distance moved up
+    uint32_t moved_squared = gnss_distance_squared_in_meters(&cams_cache.center, pos);
+    uint32_t moved = cams_isqrt(moved_squared);
+    if (moved * moved < moved_squared) {
+        moved++;
+    }
+    if (cams_cache.valid_radius_in_meters < moved + 2) {
+        return 0;
+    }
+
+    uint32_t radius_in_meters = cams_cache.valid_radius_in_meters - moved - 2;
+    if (radius_in_meters >= CAMS_CACHE_RADIUS_IN_METERS / 2) {
+        radius_in_meters = CAMS_CACHE_RADIUS_IN_METERS / 2 - 1;
+    }
+    return radius_in_meters;
+}
+
+void cams_get_cache_stats(struct cams_cache_stats *stats)
+{
+    assert(stats);
+    *stats = cams_cache_stats;
+}
+
+static uint32_t cams_db_crc32(const uint8_t *data, size_t length)
+{
+    // Reflected CRC-32 (IEEE 802.3), a nibble at a time to keep the table small
+    static const uint32_t table[16] = {
+        0x00000000, 0x1DB71064, 0x3B6E20C8, 0x26D930AC, 0x76DC4190, 0x6B6B51F4, 0x4DB26158, 0x5005713C,
+        0xEDB88320, 0xF00F9344, 0xD6D6A3E8, 0xCB61B38C, 0x9B64C2B0, 0x86D3D2D4, 0xA00AE278, 0xBDBDF21C,
+    };
+
+    uint32_t crc = 0xFFFFFFFF;
+    for (size_t i=0; i<length; i++) {
+        crc ^= data[i];
+        crc = (crc >> 4) ^ table[crc & 0xF];
+        crc = (crc >> 4) ^ table[crc & 0xF];
+    }
+    return ~crc;
+}
+
+static bool cams_db_section_is_valid(const struct cams_db_header *header, uint32_t offset, uint32_t count, uint32_t item_size)
+{
+    if (offset % 4 != 0 || offset < sizeof(*header) || offset > header->total_size) {
+        return false;
+    }
+    return count <= (header->total_size - offset) / item_size;
+}
+
+static bool cams_db_is_valid(const struct cams_db_header *header)
+{
+    if (header->magic != CAMS_DB_MAGIC || header->version != CAMS_DB_VERSION) {
+        return false;
+    }
+
+    if (header->total_size < sizeof(*header) || header->total_size > CAMS_DB_SLOT_SIZE) {
+        return false;
+    }
+
+    if (header->grid_cells_per_deg == 0 || 1000000 % header->grid_cells_per_deg != 0) {
+        return false;
+    }
+
+    if (!cams_db_section_is_valid(header, header->lat_offset, header->camera_count, sizeof(int32_t)) ||
+        !cams_db_section_is_valid(header, header->lon_offset, header->camera_count, sizeof(int32_t)) ||
+        !cams_db_section_is_valid(header, header->limit_offset, header->camera_count, sizeof(uint8_t)) ||
+        !cams_db_section_is_valid(header, header->direction_offset, header->camera_count, sizeof(uint8_t)) ||
+        !cams_db_section_is_valid(header, header->grid_keys_offset, header->grid_cell_count, sizeof(uint32_t)) ||
+        !cams_db_section_is_valid(header, header->grid_offsets_offset, header->grid_cell_count + 1, sizeof(uint32_t)) ||
+        !cams_db_section_is_valid(header, header->kdtree_offset, header->camera_count, sizeof(uint32_t))) {
+        return false;
+    }
+
+    // Checked last, it reads the whole image
+    const uint8_t *image = (const uint8_t *)header;
+    const size_t crc_start = offsetof(struct cams_db_header, version);
+    return cams_db_crc32(image + crc_start, header->total_size - crc_start) == header->crc32;
+}
+
+bool cams_init(void)
+{
+    const struct cams_db_header *active = NULL;
+    size_t active_slot = 0;
+
+    // Use the newest valid database, a half written slot fails the CRC check
+    for (size_t slot=0; slot<CAMS_DB_SLOT_COUNT; slot++) {
+        const struct cams_db_header *header = (const struct cams_db_header *)CAMS_DB_SLOT_ADDRESS(slot);
+        if (cams_db_is_valid(header) == false) {
+            printf("Camera database slot %c is invalid\n", 'A' + (int)slot);
+            continue;
+        }
+
+        if (active == NULL || header->sequence > active->sequence) {
+            active = header;
+            active_slot = slot;
+        }
+    }
+
+    if (active == NULL) {
+        printf("ERROR: No valid camera database, flash cams_db_a.uf2\n");
+        return false;
+    }
+
+    const uint8_t *image = (const uint8_t *)active;
+    cams_list_lat = (const int32_t *)(image + active->lat_offset);
+    cams_list_lon = (const int32_t *)(image + active->lon_offset);
+    cams_list_limit = image + active->limit_offset;
+    cams_list_direction = image + active->direction_offset;
+
+    cams_grid_cell_keys = (const uint32_t *)(image + active->grid_keys_offset);
+    cams_grid_cell_offsets = (const uint32_t *)(image + active->grid_offsets_offset);
+    cams_grid_cells_length = active->grid_cell_count;
+    cams_grid_cell_size_e6 = 1000000 / (int32_t)active->grid_cells_per_deg;
+    cams_grid_columns = 360 * (int)active->grid_cells_per_deg;
+    cams_grid_rows = 180 * (int)active->grid_cells_per_deg;
+
+    cams_kdtree = (const uint32_t *)(image + active->kdtree_offset);
+
+    // Publish the cameras last
+    cams_list_length = active->camera_count;
+    cams_cache.valid = false;
+
+    // Updates go to the other slot, the one in use stays as the fallback
+    printf("Camera database: slot %c, sequence %" PRIu32 ", %" PRIu32 " cameras, update with cams_db_%c.uf2\n",
+           'A' + (int)active_slot, active->sequence, active->camera_count, 'a' + (int)((active_slot + 1) % CAMS_DB_SLOT_COUNT));
+    return true;
 }
@@ -1,13 +1,58 @@
 #pragma once
 
+#include <stdbool.h>
+#include <stddef.h>
 #include <stdint.h>
-#include <pico/platform/compiler.h>
 
-#include "gnss/gnss.h"
+#include "gnss/gnss_geo.h"
 
-struct __packed cams_camera_info {
+// Camera id which doesn't belong to any camera
+#define CAMS_NO_CAMERA UINT32_MAX
+
+// Direction of a camera which monitors traffic in any direction
+#define CAMS_DIRECTION_UNKNOWN UINT16_MAX
+
+struct cams_camera_info {
+    // Index in the camera database, unique for each camera
+    uint32_t id;
     struct gnss_position pos;
     uint8_t limit;
+    // Bearing of the monitored traffic in degrees or CAMS_DIRECTION_UNKNOWN
+    uint16_t direction_deg;
+};
+
+struct cams_camera_match {
+    struct cams_camera_info cam;
+    uint32_t distance_squared_in_meters;
+};
+
+struct cams_cache_stats {
+    // Lookups served from the candidate cache
+    uint32_t hits;
+    // Lookups that had to rebuild the candidate cache
+    uint32_t refreshes;
 };
 
-void cams_get_nearest_camera(const struct cams_camera_info **cam, const struct gnss_position *pos);
+// Select the newest valid camera database in flash, lookups find no cameras if there is none
+bool cams_init(void);
+
+// Get up to k nearest cameras sorted by distance, returns the number of cameras found. Only cameras within
+// GNSS_DISTANCE_MAX_DELTA_E6 (about 44 km) of the position in latitude and longitude are searched, so fewer
+// than k can be found even if the database has more.
+size_t cams_k_nearest(const struct gnss_position *pos, size_t k, struct cams_camera_match *out);
+
+// Get up to max nearest cameras within the radius sorted by distance, returns the number of cameras found.
+// Small radiuses are served from a cache of the cameras around the last position, so consecutive
+// lookups should come from the same task.
+size_t cams_within_radius(const struct gnss_position *pos, uint32_t radius_in_meters, struct cams_camera_match *out, size_t max);
+
+// Like cams_within_radius() but only returns cameras ahead of the vehicle which monitor traffic moving
+// in the course direction, cameras with unknown direction are treated as monitoring every direction
+size_t cams_ahead_within_radius(const struct gnss_position *pos, uint16_t course_deg, uint32_t radius_in_meters,
+                                struct cams_camera_match *out, size_t max);
+
+// Get the largest radius a lookup around the position can have and still be served from the cache,
+// 0 if no lookup around it is
+uint32_t cams_get_cached_radius(const struct gnss_position *pos);
+
+void cams_get_cache_stats(struct cams_cache_stats *stats);
@@ -0,0 +1,34 @@
+#pragma once
+
+#include <stdint.h>
+
+// Binary camera database format, see scripts/fetch_cameras/fetch.py for the packer.
+// All values are little endian and every section is 4 byte aligned.
+
+#define CAMS_DB_MAGIC   0x42444343u // "CCDB"
+#define CAMS_DB_VERSION 1
+
+struct cams_db_header {
+    uint32_t magic;
+    // CRC-32 (IEEE 802.3) of the image from the version field up to total_size
+    uint32_t crc32;
+    uint32_t version;
+    // Size of the whole image including this header
+    uint32_t total_size;
+    // Increases with every database, the valid slot with the highest sequence is used
+    uint32_t sequence;
+    uint32_t camera_count;
+    // Spatial index, a uniform lat/lon grid with this many cells per degree
+    uint32_t grid_cells_per_deg;
+    uint32_t grid_cell_count;
+    // Section offsets from the start of the image
+    uint32_t lat_offset;          // int32_t[camera_count], microdegrees, sorted by grid cell
+    uint32_t lon_offset;          // int32_t[camera_count], microdegrees
+    uint32_t limit_offset;        // uint8_t[camera_count]
+    uint32_t direction_offset;    // uint8_t[camera_count], 2 degree steps or CAMS_DB_DIRECTION_UNKNOWN
+    uint32_t grid_keys_offset;    // uint32_t[grid_cell_count], sorted keys (row * columns + column) of non-empty cells
+    uint32_t grid_offsets_offset; // uint32_t[grid_cell_count + 1], first camera index of each cell
+    uint32_t kdtree_offset;       // uint32_t[camera_count], implicit k-d tree of camera indices
+};
+
+#define CAMS_DB_DIRECTION_UNKNOWN 255
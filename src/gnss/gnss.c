@@ -1,37 +1,109 @@
 #include <stdbool.h>
 #include <assert.h>
 #include <stdio.h>
+#include <inttypes.h>
 
 #include <pico/stdlib.h>
 #include <hardware/gpio.h>
 #include <hardware/uart.h>
 
 #include "gnss/gnss.h"
+#include "gnss/gnss_kalman.h"
+#include "gnss/gnss_nmea.h"
+#include "gnss/gnss_pmtk.h"
 #include "leds/leds.h"
 #include "audio/audio.h"
+#include "trace/trace.h"
 
 #include <FreeRTOS.h>
+#include <task.h>
 #include <stream_buffer.h>
-#include <queue.h>
 
-#include "minmea/minmea.h"
-
-#define BAUD_RATE        9600
+// The receiver comes up at its default baud rate and is switched to a faster one at boot,
+// 9600 baud can't carry the sentences of a 10 Hz fix rate
+#define GNSS_DEFAULT_BAUD_RATE 9600
+#define GNSS_BAUD_RATE         115200
+#define GNSS_FIX_INTERVAL_MS   100
 #define DATA_BITS        8
 #define STOP_BITS        1
 #define PARITY           UART_PARITY_NONE
 
+// The RX FIFO interrupts when it's half full (16 of 32 bytes), the RX timeout interrupt
+// flushes the rest once the line has been idle for 32 bit periods, i.e. at the end of a burst
+#define GNSS_UART_FIFO_DEPTH       32
+#define GNSS_UART_RX_FIFO_LEVEL    2
+#define GNSS_NMEA_STREAM_BUFF_SIZE 1024
+// Bytes taken from the stream buffer at once
+#define GNSS_NMEA_CHUNK_SIZE       64
+// The receiver sends the sentences of an epoch back to back, the line staying idle this long ends it
+#define GNSS_EPOCH_IDLE_MS         10
+
+// Sentences of one receiver epoch, merged into a single record once the epoch is complete
+struct gnss_epoch {
+    bool pending;
+    // UTC of the first sentence which has one, GNSS_NMEA_NO_TIME before
+    uint32_t time_ms;
+    // Tick count of the first sentence
+    TickType_t timestamp;
+    bool has_rmc;
+    bool has_gga;
+    bool has_vtg;
+    struct gnss_nmea_rmc rmc;
+    struct gnss_nmea_gga gga;
+    struct gnss_nmea_vtg vtg;
+    // Sums over the GSA of every constellation, HDOP is the same in each
+    uint8_t gsa_satellites;
+    uint16_t gsa_hdop_e2;
+    // UART IRQ and tokenizer times of the last sentence, for the latency trace
+    uint32_t rx_time_us;
+    uint32_t sentence_time_us;
+};
+
+// Time the receiver needs to switch its baud rate
+#define GNSS_PMTK_BAUD_RATE_SWITCH_MS 100
+#define GNSS_PMTK_ACK_TIMEOUT_MS      1000
+#define GNSS_PMTK_RETRIES             3
+#define GNSS_PMTK_MAX_ARGS_LENGTH     64
+
+// Millimeters per second of a speed in thousandths of a knot is knots_e3 * 1852 / 3600
+#define GNSS_KNOTS_E3_TO_MM_PER_S(knots_e3) ((uint32_t)(((uint64_t)(knots_e3) * 1852u) / 3600u))
+// Below this cos() of the latitude a longitude offset isn't meaningful anymore (about 89.9 degrees)
+#define GNSS_PREDICT_MIN_COS_Q14 32
+
 static StreamBufferHandle_t gnss_nmea_stream_buff;
+static struct gnss_nmea_tokenizer gnss_nmea_tokenizer;
+static struct gnss_uart_stats gnss_uart_stats;
+static struct gnss_kalman gnss_kalman;
+static struct gnss_epoch gnss_epoch;
+// Start of the last UART IRQ
+static volatile uint32_t gnss_rx_time_us;
+static uint32_t gnss_trace_id;
 
 static void __isr gnss_on_uart_nmea_rx(void)
 {
+    const uint32_t start_us = time_us_32();
     BaseType_t higher_priority_task_woken = pdFALSE;
+    uint8_t chunk[GNSS_UART_FIFO_DEPTH];
+    size_t chunk_length = 0;
 
     assert(gnss_nmea_stream_buff);
+    // Reading the FIFO empty clears both the RX and the RX timeout interrupt
     while (uart_is_readable(UART_NMEA_PMTK_ID)) {
-        char ch = uart_getc(UART_NMEA_PMTK_ID);
-        xStreamBufferSendFromISR(gnss_nmea_stream_buff, &ch, 1, &higher_priority_task_woken);
+        chunk[chunk_length++] = (uint8_t)uart_getc(UART_NMEA_PMTK_ID);
+        if (chunk_length == sizeof(chunk)) {
+            gnss_uart_stats.dropped_bytes += chunk_length - xStreamBufferSendFromISR(gnss_nmea_stream_buff, chunk, chunk_length, &higher_priority_task_woken);
+            gnss_uart_stats.bytes += chunk_length;
+            chunk_length = 0;
+        }
     }
+    if (chunk_length > 0) {
+        gnss_uart_stats.dropped_bytes += chunk_length - xStreamBufferSendFromISR(gnss_nmea_stream_buff, chunk, chunk_length, &higher_priority_task_woken);
+        gnss_uart_stats.bytes += chunk_length;
+    }
+
+    gnss_uart_stats.irqs++;
+    gnss_uart_stats.isr_time_us += time_us_32() - start_us;
+    gnss_rx_time_us = start_us;
 
     // Perform context switch if needed
     portYIELD_FROM_ISR(higher_priority_task_woken);
@@ -39,88 +111,287 @@ static void __isr gnss_on_uart_nmea_rx(void)
 
 static void uart_hw_init(void)
 {
-    uart_init(UART_NMEA_PMTK_ID, BAUD_RATE);
-    // Set up the UART RX pin
+    uart_init(UART_NMEA_PMTK_ID, GNSS_DEFAULT_BAUD_RATE);
+    // Set up the UART RX and TX pins, TX carries the PMTK commands
     gpio_set_function(UART_NMEA_PMTK_RX_PIN, UART_FUNCSEL_NUM(UART_NMEA_PMTK_ID, UART_NMEA_PMTK_RX_PIN));
+    gpio_set_function(UART_NMEA_PMTK_TX_PIN, UART_FUNCSEL_NUM(UART_NMEA_PMTK_ID, UART_NMEA_PMTK_TX_PIN));
     // Disable HW CTS/RTS flow control
     uart_set_hw_flow(UART_NMEA_PMTK_ID, false, false);
     uart_set_format(UART_NMEA_PMTK_ID, DATA_BITS, STOP_BITS, PARITY);
-    // Don't use the FIFOs
-    uart_set_fifo_enabled(UART_NMEA_PMTK_ID, false);
+    // Let the FIFO collect bytes so we get one interrupt per burst instead of one per byte
+    uart_set_fifo_enabled(UART_NMEA_PMTK_ID, true);
 
     // And set up and enable the interrupt handlers
     int uart_irq = UART_NMEA_PMTK_ID == uart0 ? UART0_IRQ : UART1_IRQ;
     irq_set_exclusive_handler(uart_irq, gnss_on_uart_nmea_rx);
     irq_set_enabled(uart_irq, true);
 
-    // Now enable the UART to send interrupts - RX only
+    // Now enable the UART to send interrupts - RX and RX timeout only
     uart_set_irq_enables(UART_NMEA_PMTK_ID, true, false);
+    // The SDK sets the lowest RX FIFO level, raise it
+    hw_write_masked(&uart_get_hw(UART_NMEA_PMTK_ID)->ifls, GNSS_UART_RX_FIFO_LEVEL << UART_UARTIFLS_RXIFLSEL_LSB, UART_UARTIFLS_RXIFLSEL_BITS);
 }
 
-static bool gnss_nmea_parse_sentence(struct gnss_data *gnss_data, const char *sentence)
+static void gnss_pmtk_send(uint16_t command, const char *args)
 {
-    assert(gnss_data);
-    assert(sentence);
+    char sentence[GNSS_NMEA_MAX_SENTENCE_LENGTH + 1];
+    size_t length = gnss_pmtk_format(sentence, sizeof(sentence), command, args);
+    assert(length > 0);
 
-    enum minmea_sentence_id sentence_id = minmea_sentence_id(sentence, true);
-    switch (sentence_id) {
-        case MINMEA_SENTENCE_RMC: {
-            struct minmea_sentence_rmc frame;
-            if (minmea_parse_rmc(&frame, sentence)) {
-                // TODO: see if valid is the right field to use
-                gnss_data->valid = frame.valid;
-                // TODO: handle NaN values
-                gnss_data->speed_knots = minmea_tofloat(&frame.speed);
-                gnss_data->course_deg = minmea_tofloat(&frame.course);
-                gnss_data->pos.lat = minmea_tocoord(&frame.latitude);
-                gnss_data->pos.lon = minmea_tocoord(&frame.longitude);
+    uart_write_blocking(UART_NMEA_PMTK_ID, (const uint8_t *)sentence, length);
+}
+
+// Waits for the acknowledgement of command, everything else received meanwhile is dropped
+static bool gnss_pmtk_wait_ack(uint16_t command, enum gnss_pmtk_ack *ack)
+{
+    const TickType_t start = xTaskGetTickCount();
+    const TickType_t timeout = pdMS_TO_TICKS(GNSS_PMTK_ACK_TIMEOUT_MS);
+    TickType_t elapsed;
+
+    while ((elapsed = xTaskGetTickCount() - start) < timeout) {
+        char chunk[GNSS_NMEA_CHUNK_SIZE];
+        size_t chunk_length = xStreamBufferReceive(gnss_nmea_stream_buff, chunk, sizeof(chunk), timeout - elapsed);
+
+        for (size_t i=0; i<chunk_length; i++) {
+            if (gnss_nmea_tokenizer_feed(&gnss_nmea_tokenizer, chunk[i]) == false) {
+                continue;
+            }
+
+            uint16_t acked_command;
+            if (gnss_pmtk_parse_ack(&gnss_nmea_tokenizer.sentence, &acked_command, ack) && acked_command == command) {
                 return true;
             }
-        } break;
-        default: {
-        } break;
+        }
     }
 
     return false;
 }
 
-static bool gnss_nmea_parse_char(struct gnss_data *gnss_data, char ch)
+static bool gnss_pmtk_command(uint16_t command, const char *args)
+{
+    enum gnss_pmtk_ack ack;
+
+    for (int i=0; i<GNSS_PMTK_RETRIES; i++) {
+        gnss_pmtk_send(command, args);
+        if (gnss_pmtk_wait_ack(command, &ack)) {
+            if (ack != GNSS_PMTK_ACK_SUCCEEDED) {
+                printf("GNSS PMTK%03u rejected: %d\n", command, ack);
+            }
+            return ack == GNSS_PMTK_ACK_SUCCEEDED;
+        }
+    }
+
+    printf("GNSS PMTK%03u not acknowledged\n", command);
+    return false;
+}
+
+static void gnss_pmtk_configure(void)
+{
+    char args[GNSS_PMTK_MAX_ARGS_LENGTH];
+
+    // The receiver doesn't acknowledge a baud rate change, the next command tells if it worked.
+    // If the receiver kept the fast baud rate over a reset of ours this one is lost, which is fine.
+    snprintf(args, sizeof(args), "%u", GNSS_BAUD_RATE);
+    gnss_pmtk_send(GNSS_PMTK_SET_NMEA_BAUDRATE, args);
+    uart_tx_wait_blocking(UART_NMEA_PMTK_ID);
+    uart_set_baudrate(UART_NMEA_PMTK_ID, GNSS_BAUD_RATE);
+    sleep_ms(GNSS_PMTK_BAUD_RATE_SWITCH_MS);
+    gnss_nmea_tokenizer_init(&gnss_nmea_tokenizer);
+
+    // Keep the sentences merged into an epoch, trim the rest before raising the rate so it fits the line
+    size_t length = 0;
+    for (int i=0; i<GNSS_PMTK_OUTPUT_LENGTH; i++) {
+        const bool output = i == GNSS_PMTK_OUTPUT_RMC || i == GNSS_PMTK_OUTPUT_GGA || i == GNSS_PMTK_OUTPUT_GSA || i == GNSS_PMTK_OUTPUT_VTG;
+        length += snprintf(&args[length], sizeof(args) - length, i == 0 ? "%d" : ",%d", output);
+    }
+    assert(length < sizeof(args));
+    if (gnss_pmtk_command(GNSS_PMTK_API_SET_NMEA_OUTPUT, args) == false) {
+        // Receiver isn't there at the new baud rate, carry on with its defaults
+        printf("GNSS receiver not configured, staying at %u baud\n", GNSS_DEFAULT_BAUD_RATE);
+        uart_set_baudrate(UART_NMEA_PMTK_ID, GNSS_DEFAULT_BAUD_RATE);
+        gnss_nmea_tokenizer_init(&gnss_nmea_tokenizer);
+        return;
+    }
+
+    snprintf(args, sizeof(args), "%u", GNSS_FIX_INTERVAL_MS);
+    if (gnss_pmtk_command(GNSS_PMTK_SET_NMEA_UPDATERATE, args)) {
+        printf("GNSS receiver configured: %u baud, %u ms fix interval\n", GNSS_BAUD_RATE, GNSS_FIX_INTERVAL_MS);
+    }
+}
+
+void gnss_predict_position(const struct gnss_data *fix, uint32_t elapsed_ms, struct gnss_position *pos)
+{
+    assert(fix);
+    assert(pos);
+
+    *pos = fix->pos;
+
+    // Distance covered in millimeters
+    const int64_t distance_mm = (int64_t)GNSS_KNOTS_E3_TO_MM_PER_S(fix->speed_knots_e3) * elapsed_ms / 1000;
+    const int32_t course = (int32_t)fix->course_deg_e2 * 10000;
+    const int64_t north_mm = (distance_mm * gnss_cos_q14(course)) / (1 << 14);
+    const int64_t east_mm = (distance_mm * gnss_sin_q14(course)) / (1 << 14);
+
+    // Millimeters to microdegrees, the longitude ones grow towards the poles
+    pos->lat += (int32_t)((north_mm * (1 << 14)) / (GNSS_METERS_PER_E6_Q14 * 1000));
+    const int32_t cos_lat_q14 = gnss_cos_q14(pos->lat);
+    if (cos_lat_q14 >= GNSS_PREDICT_MIN_COS_Q14) {
+        pos->lon += (int32_t)((east_mm * (1 << 14) * (1 << 14)) / ((int64_t)GNSS_METERS_PER_E6_Q14 * 1000 * cos_lat_q14));
+    }
+
+    // Stay within the coordinate ranges
+    if (pos->lon > 180000000) {
+        pos->lon -= 360000000;
+    } else if (pos->lon < -180000000) {
+        pos->lon += 360000000;
+    }
+}
+
+// Finish the epoch into gnss_data, returns false if none of its sentences had a position
+static bool gnss_epoch_finish(struct gnss_epoch *epoch, struct gnss_data *gnss_data)
 {
+    assert(epoch);
     assert(gnss_data);
 
-    bool ret;
-    static char nmea_buff[1024];
-    static size_t nmea_buff_idx = 0;
-    static bool nmea_start_found = false;
-
-    ret = false;
-    if (nmea_start_found == false) {
-        // Skip any characters until we find the start of a NMEA sentence
-        if (ch == '$') {
-            nmea_buff[nmea_buff_idx++] = ch;
-            nmea_start_found = true;
+    epoch->pending = false;
+    if (epoch->has_rmc == false && epoch->has_gga == false) {
+        return false;
+    }
+
+    // RMC has the receiver's own verdict on the fix, GGA the rest of what we need
+    gnss_data->valid = epoch->has_rmc ? epoch->rmc.valid : epoch->gga.fix_quality > 0;
+    gnss_data->pos.lat = epoch->has_rmc ? epoch->rmc.lat_e6 : epoch->gga.lat_e6;
+    gnss_data->pos.lon = epoch->has_rmc ? epoch->rmc.lon_e6 : epoch->gga.lon_e6;
+    gnss_data->speed_knots_e3 = epoch->has_vtg ? epoch->vtg.speed_knots_e3 : epoch->has_rmc ? epoch->rmc.speed_knots_e3 : 0;
+    gnss_data->course_deg_e2 = epoch->has_vtg ? epoch->vtg.course_deg_e2 : epoch->has_rmc ? epoch->rmc.course_deg_e2 : 0;
+    gnss_data->fix_quality = epoch->has_gga ? epoch->gga.fix_quality : gnss_data->valid;
+    gnss_data->satellites = epoch->has_gga ? epoch->gga.satellites : epoch->gsa_satellites;
+    gnss_data->hdop_e2 = epoch->has_gga && epoch->gga.hdop_e2 > 0 ? epoch->gga.hdop_e2 : epoch->gsa_hdop_e2;
+    gnss_data->time_ms = epoch->time_ms;
+    gnss_data->timestamp = epoch->timestamp;
+
+    if (++gnss_trace_id == TRACE_NO_ID) {
+        gnss_trace_id++;
+    }
+    gnss_data->trace_id = gnss_trace_id;
+    // The stream buffer doesn't keep byte times, the last IRQ before the sentence was taken from it stands in
+    trace_stage_at(TRACE_STAGE_UART_RX, gnss_data->trace_id, epoch->rx_time_us);
+    trace_stage_at(TRACE_STAGE_SENTENCE, gnss_data->trace_id, epoch->sentence_time_us);
+    return true;
+}
+
+// Merge a sentence into the epoch. A sentence of the next epoch finishes the current one
+// into gnss_data first, then true is returned.
+static bool gnss_epoch_add(struct gnss_epoch *epoch, const struct gnss_nmea_sentence *sentence, struct gnss_data *gnss_data)
+{
+    assert(epoch);
+    assert(sentence);
+
+    // The tokenizer already verified the checksum and split the fields
+    struct gnss_nmea_rmc rmc;
+    struct gnss_nmea_gga gga;
+    struct gnss_nmea_gsa gsa;
+    struct gnss_nmea_vtg vtg;
+    const bool is_rmc = gnss_nmea_parse_rmc(sentence, &rmc);
+    const bool is_gga = is_rmc == false && gnss_nmea_parse_gga(sentence, &gga);
+    const bool is_gsa = is_rmc == false && is_gga == false && gnss_nmea_parse_gsa(sentence, &gsa);
+    const bool is_vtg = is_rmc == false && is_gga == false && is_gsa == false && gnss_nmea_parse_vtg(sentence, &vtg);
+    if (is_rmc == false && is_gga == false && is_gsa == false && is_vtg == false) {
+        return false;
+    }
+
+    // Another time of day starts the next epoch, so does a repeated sentence if the receiver
+    // leaves the time empty. GSA is repeated for every constellation.
+    const uint32_t time_ms = is_rmc ? rmc.time_ms : is_gga ? gga.time_ms : GNSS_NMEA_NO_TIME;
+    const bool new_time = time_ms != GNSS_NMEA_NO_TIME && epoch->time_ms != GNSS_NMEA_NO_TIME && time_ms != epoch->time_ms;
+    const bool repeated = (is_rmc && epoch->has_rmc) || (is_gga && epoch->has_gga) || (is_vtg && epoch->has_vtg);
+    bool finished = false;
+    if (epoch->pending && (new_time || repeated)) {
+        finished = gnss_epoch_finish(epoch, gnss_data);
+    }
+
+    if (epoch->pending == false) {
+        *epoch = (struct gnss_epoch){
+            .pending = true,
+            .time_ms = GNSS_NMEA_NO_TIME,
+            .timestamp = xTaskGetTickCount(),
+        };
+    }
+    if (epoch->time_ms == GNSS_NMEA_NO_TIME) {
+        epoch->time_ms = time_ms;
+    }
+
+    if (is_rmc) {
+        epoch->has_rmc = true;
+        epoch->rmc = rmc;
+    } else if (is_gga) {
+        epoch->has_gga = true;
+        epoch->gga = gga;
+    } else if (is_gsa) {
+        epoch->gsa_satellites += gsa.satellites;
+        if (epoch->gsa_hdop_e2 == 0) {
+            epoch->gsa_hdop_e2 = gsa.hdop_e2;
         }
     } else {
-        // Copy characters until we find the end of the NMEA sentence
-        if (ch == '\r' || ch == '\n') {
-            nmea_buff[nmea_buff_idx] = '\0';
-            ret = gnss_nmea_parse_sentence(gnss_data, nmea_buff);
-
-            // Reset buffer
-            nmea_buff_idx = 0;
-            nmea_start_found = false;
-        } else {
-            nmea_buff[nmea_buff_idx++] = ch;
-        }
+        epoch->has_vtg = true;
+        epoch->vtg = vtg;
+    }
+    epoch->rx_time_us = gnss_rx_time_us;
+    epoch->sentence_time_us = trace_time_us();
+
+    return finished;
+}
+
+// Replace the receiver position with the filtered one
+static void gnss_filter_position(struct gnss_data *gnss_data)
+{
+    if (gnss_data->valid == false) {
+        gnss_kalman_reset(&gnss_kalman);
+        gnss_data->pos_error_cm = 0;
+        return;
+    }
+
+    // An outlier leaves the position to the prediction of the filter
+    const uint32_t time_ms = pdTICKS_TO_MS(gnss_data->timestamp);
+    if (gnss_kalman_update(&gnss_kalman, &gnss_data->pos, gnss_data->speed_knots_e3, gnss_data->course_deg_e2, gnss_data->hdop_e2, time_ms) == false) {
+        printf("GNSS position rejected as an outlier: lat=%" PRId32 "e-6, lon=%" PRId32 "e-6\n", gnss_data->pos.lat, gnss_data->pos.lon);
     }
+    gnss_kalman_get_position(&gnss_kalman, &gnss_data->pos);
+    gnss_data->pos_error_cm = gnss_kalman_get_error_cm(&gnss_kalman);
+}
+
+static void gnss_post_data(struct gnss_data *gnss_data, struct ring *gnss_data_ring, struct ring *audio_sample_ring, bool *fix_acquired_played)
+{
+    gnss_filter_position(gnss_data);
+    // The main task only uses the newest fix, if it falls behind the oldest one is overwritten
+    ring_push(gnss_data_ring, gnss_data);
+    trace_stage(TRACE_STAGE_RING_POST, gnss_data->trace_id);
+
+    if (gnss_data->valid) {
+        leds_set_gnss_fix_leds_state(true);
+
+        // Play GNSS fix acquired only when fix was previously lost
+        if (*fix_acquired_played == false) {
+            audio_play_sample_async(audio_sample_ring, AUDIO_SAMPLES_GPS_SIGNAL_ACQUIRED);
+            *fix_acquired_played = true;
+        }
+    } else {
+        leds_set_gnss_fix_leds_state(false);
 
-    // Clear buffer if it's full
-    if (nmea_buff_idx >= sizeof(nmea_buff)) {
-        nmea_buff_idx = 0;
-        nmea_start_found = false;
+        if (*fix_acquired_played) {
+            audio_play_sample_async(audio_sample_ring, AUDIO_SAMPLES_GPS_SIGNAL_LOST);
+            *fix_acquired_played = false;
+        }
     }
+}
 
-    return ret;
+void gnss_get_uart_stats(struct gnss_uart_stats *stats)
+{
+    assert(stats);
+    // Updated from the UART IRQ
+    taskENTER_CRITICAL();
+    *stats = gnss_uart_stats;
+    taskEXIT_CRITICAL();
 }
 
 void gnss_task(void *params)
@@ -135,44 +406,44 @@ void gnss_task(void *params)
     sleep_ms(1000);
     leds_set_gnss_fix_leds_state(false);
 
-    gnss_nmea_stream_buff = xStreamBufferCreate(1024, 1);
+    gnss_nmea_stream_buff = xStreamBufferCreate(GNSS_NMEA_STREAM_BUFF_SIZE, 1);
     assert(gnss_nmea_stream_buff);
+    gnss_nmea_tokenizer_init(&gnss_nmea_tokenizer);
 
     uart_hw_init();
+    gnss_pmtk_configure();
+
+    struct ring *gnss_data_ring = task_params->gnss_data_ring;
+    assert(gnss_data_ring);
+    struct ring *audio_sample_ring = task_params->audio_sample_ring;
+    assert(audio_sample_ring);
 
-    QueueHandle_t gnss_data_queue = task_params->gnss_data_queue;
-    assert(gnss_data_queue);
-    QueueHandle_t audio_sample_data_queue = task_params->audio_sample_data_queue;
-    assert(audio_sample_data_queue);
+    audio_play_sample_async(audio_sample_ring, AUDIO_SAMPLES_SEARCHING_FOR_A_GPS_SIGNAL);
 
-    audio_play_sample_async(audio_sample_data_queue, AUDIO_SAMPLES_SEARCHING_FOR_A_GPS_SIGNAL);
+    // Never 0, that would poll while an epoch is pending
+    const TickType_t epoch_idle_ticks = pdMS_TO_TICKS(GNSS_EPOCH_IDLE_MS) > 0 ? pdMS_TO_TICKS(GNSS_EPOCH_IDLE_MS) : 1;
 
     while (true) {
-        // Wait for gnss data
-        // TODO: See if we need to set a timeout here
-        char ch;
-        xStreamBufferReceive(gnss_nmea_stream_buff, &ch, sizeof(ch), portMAX_DELAY);
-
-        // Parse NMEA sentence and send data to main task if available
-        bool new_data_available = gnss_nmea_parse_char(&gnss_data, ch);
-        if (new_data_available) {
-            xQueueOverwrite(task_params->gnss_data_queue, &gnss_data);
-
-            if (gnss_data.valid) {
-                leds_set_gnss_fix_leds_state(true);
-
-                // Play GNSS fix acquired only when fix was previously lost
-                if (gnss_fix_acquired_played == false) {
-                    audio_play_sample_async(audio_sample_data_queue, AUDIO_SAMPLES_GPS_SIGNAL_ACQUIRED);
-                    gnss_fix_acquired_played = true;
-                }
-            } else {
-                leds_set_gnss_fix_leds_state(false);
-
-                if (gnss_fix_acquired_played) {
-                    audio_play_sample_async(audio_sample_data_queue, AUDIO_SAMPLES_GPS_SIGNAL_LOST);
-                    gnss_fix_acquired_played = false;
-                }
+        // Wait for gnss data, a whole burst from the UART IRQ is taken at once
+        char chunk[GNSS_NMEA_CHUNK_SIZE];
+        const TickType_t timeout = gnss_epoch.pending ? epoch_idle_ticks : portMAX_DELAY;
+        size_t chunk_length = xStreamBufferReceive(gnss_nmea_stream_buff, chunk, sizeof(chunk), timeout);
+
+        if (chunk_length == 0) {
+            // The line went idle, the epoch is complete
+            if (gnss_epoch_finish(&gnss_epoch, &gnss_data)) {
+                gnss_post_data(&gnss_data, gnss_data_ring, audio_sample_ring, &gnss_fix_acquired_played);
+            }
+            continue;
+        }
+
+        for (size_t i=0; i<chunk_length; i++) {
+            // Merge NMEA sentences and send data to main task once per epoch
+            if (gnss_nmea_tokenizer_feed(&gnss_nmea_tokenizer, chunk[i]) == false) {
+                continue;
+            }
+            if (gnss_epoch_add(&gnss_epoch, &gnss_nmea_tokenizer.sentence, &gnss_data)) {
+                gnss_post_data(&gnss_data, gnss_data_ring, audio_sample_ring, &gnss_fix_acquired_played);
             }
         }
     }
@@ -1,30 +1,52 @@
 #pragma once
 
 #include <stdbool.h>
+#include <stdint.h>
 
-#include <FreeRTOS.h>
-#include <queue.h>
+#include "gnss/gnss_geo.h"
+#include "ring/ring.h"
 
 struct gnss_task_params {
-    QueueHandle_t gnss_data_queue;
-    QueueHandle_t audio_sample_data_queue;
-};
-
-struct gnss_position {
-    float lat;
-    float lon;
+    // Consumed by the main task, holds struct gnss_data
+    struct ring *gnss_data_ring;
+    // Consumed by the audio task, holds struct audio_sample_data
+    struct ring *audio_sample_ring;
 };
 
+// Everything the receiver reported for one epoch, merged from its RMC, GGA, GSA and VTG
 struct gnss_data {
     bool valid;
-    float speed_knots;
-    float course_deg;
+    // Thousandths of a knot
+    uint32_t speed_knots_e3;
+    // Hundredths of a degree, clockwise from true north
+    uint32_t course_deg_e2;
+    // Kalman filtered position and its 1-sigma error
     struct gnss_position pos;
+    uint32_t pos_error_cm;
+    // GGA fix quality (0 no fix, 1 GPS, 2 DGPS, ...) and satellites used
+    uint8_t fix_quality;
+    uint8_t satellites;
+    // Horizontal dilution of precision in hundredths, 0 if unknown
+    uint16_t hdop_e2;
+    // UTC milliseconds of the day, GNSS_NMEA_NO_TIME if the receiver has none yet
+    uint32_t time_ms;
+    // Tick count when the first sentence of the epoch was received
+    TickType_t timestamp;
+    // Ties the latency trace events of the fix together, never TRACE_NO_ID
+    uint32_t trace_id;
 };
 
+// NMEA receive counters, the ISR time has microsecond resolution so it is only meaningful summed up
+struct gnss_uart_stats {
+    uint32_t irqs;
+    uint32_t bytes;
+    uint32_t dropped_bytes;
+    uint32_t isr_time_us;
+};
+
+void gnss_get_uart_stats(struct gnss_uart_stats *stats);
 void gnss_task(void *params);
 
-#define GNSS_DISTANCE_SQUARED_IN_METERS(pos1, pos2) \
-    (((pos1).lat - (pos2).lat) * ((pos1).lat - (pos2).lat) + \
-    ((pos1).lon - (pos2).lon) * ((pos1).lon - (pos2).lon)) * \
-    (111317.099692198f * 111317.099692198f)
+// Dead reckoning: position of the fix after elapsed_ms moving straight at its speed and course
+void gnss_predict_position(const struct gnss_data *fix, uint32_t elapsed_ms, struct gnss_position *pos);
+
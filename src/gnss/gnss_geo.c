@@ -0,0 +1,101 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "gnss/gnss_geo.h"
+
+// cos() in Q14 for every whole degree from 0 to 90
+static const uint16_t gnss_cos_deg_q14[91] = {
+    16384, 16382, 16374, 16362, 16344, 16322, 16294, 16262, 16225, 16182,
+    16135, 16083, 16026, 15964, 15897, 15826, 15749, 15668, 15582, 15491,
+    15396, 15296, 15191, 15082, 14968, 14849, 14726, 14598, 14466, 14330,
+    14189, 14044, 13894, 13741, 13583, 13421, 13255, 13085, 12911, 12733,
+    12551, 12365, 12176, 11982, 11786, 11585, 11381, 11174, 10963, 10749,
+    10531, 10311, 10087, 9860, 9630, 9397, 9162, 8923, 8682, 8438,
+    8192, 7943, 7692, 7438, 7182, 6924, 6664, 6402, 6138, 5872,
+    5604, 5334, 5063, 4790, 4516, 4240, 3964, 3686, 3406, 3126,
+    2845, 2563, 2280, 1997, 1713, 1428, 1143, 857, 572, 286,
+    0,
+};
+
+int32_t gnss_cos_q14(int32_t angle)
+{
+    // Reduce to [0, 180] degrees, cos is even
+    uint32_t abs_angle = angle < 0 ? -(uint32_t)angle : (uint32_t)angle;
+    abs_angle %= 360000000;
+    if (abs_angle > 180000000) {
+        abs_angle = 360000000 - abs_angle;
+    }
+
+    // Mirror (90, 180] to [0, 90) with a negative sign
+    int32_t sign = 1;
+    if (abs_angle > 90000000) {
+        abs_angle = 180000000 - abs_angle;
+        sign = -1;
+    }
+    if (abs_angle == 90000000) {
+        return 0;
+    }
+
+    // Linearly interpolate between whole degrees
+    uint32_t deg = abs_angle / 1000000;
+    uint32_t frac = abs_angle % 1000000;
+    uint32_t cos0 = gnss_cos_deg_q14[deg];
+    uint32_t cos1 = gnss_cos_deg_q14[deg + 1];
+    return sign * (int32_t)(cos0 - ((cos0 - cos1) * frac) / 1000000);
+}
+
+int32_t gnss_sin_q14(int32_t angle)
+{
+    return gnss_cos_q14(angle - 90000000);
+}
+
+static int32_t gnss_e6_to_meters(int32_t delta)
+{
+    // Round to the nearest meter, symmetric around zero
+    uint32_t abs_delta = delta < 0 ? -(uint32_t)delta : (uint32_t)delta;
+    int32_t meters = (int32_t)((abs_delta * GNSS_METERS_PER_E6_Q14 + (1u << 13)) >> 14);
+    return delta < 0 ? -meters : meters;
+}
+
+bool gnss_offset_in_meters(const struct gnss_position *pos1, const struct gnss_position *pos2, int32_t *east, int32_t *north)
+{
+    assert(pos1);
+    assert(pos2);
+    assert(east);
+    assert(north);
+
+    int32_t dlat = pos2->lat - pos1->lat;
+    int32_t dlon = pos2->lon - pos1->lon;
+
+    // Take the shorter way around the antimeridian
+    if (dlon > 180000000) {
+        dlon -= 360000000;
+    } else if (dlon < -180000000) {
+        dlon += 360000000;
+    }
+
+    if (dlat > GNSS_DISTANCE_MAX_DELTA_E6 || dlat < -GNSS_DISTANCE_MAX_DELTA_E6) {
+        return false;
+    }
+
+    // Shrink the longitude difference to its length at the equator
+    dlon = (int32_t)(((int64_t)dlon * gnss_cos_q14(pos1->lat)) / (1 << 14));
+    if (dlon > GNSS_DISTANCE_MAX_DELTA_E6 || dlon < -GNSS_DISTANCE_MAX_DELTA_E6) {
+        return false;
+    }
+
+    *north = gnss_e6_to_meters(dlat);
+    *east = gnss_e6_to_meters(dlon);
+    return true;
+}
+
+uint32_t gnss_distance_squared_in_meters(const struct gnss_position *pos1, const struct gnss_position *pos2)
+{
+    int32_t east, north;
+    if (gnss_offset_in_meters(pos1, pos2, &east, &north) == false) {
+        return GNSS_DISTANCE_FAR;
+    }
+
+    return (uint32_t)(east * east) + (uint32_t)(north * north);
+}
@@ -0,0 +1,28 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+// Coordinates in microdegrees
+struct gnss_position {
+    int32_t lat;
+    int32_t lon;
+};
+
+// Meters per microdegree on a sphere with the mean Earth radius (6371008.8 m) in Q14
+#define GNSS_METERS_PER_E6_Q14 1822
+
+// Max coordinate difference (about 44 km) for which the distance is computed, farther is GNSS_DISTANCE_FAR
+#define GNSS_DISTANCE_MAX_DELTA_E6 400000
+#define GNSS_DISTANCE_FAR          UINT32_MAX
+
+// cos() and sin() of an angle in microdegrees, result is in Q14
+int32_t gnss_cos_q14(int32_t angle);
+int32_t gnss_sin_q14(int32_t angle);
+
+// Equirectangular offset of pos2 from pos1 in meters using integer math only, the longitude
+// difference is scaled by cos() of the pos1 latitude. Returns false if pos2 is too far away.
+bool gnss_offset_in_meters(const struct gnss_position *pos1, const struct gnss_position *pos2, int32_t *east, int32_t *north);
+
+// Squared length of gnss_offset_in_meters() or GNSS_DISTANCE_FAR
+uint32_t gnss_distance_squared_in_meters(const struct gnss_position *pos1, const struct gnss_position *pos2);
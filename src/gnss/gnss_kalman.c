@@ -0,0 +1,289 @@
+#include <assert.h>
+
+#include "gnss/gnss_kalman.h"
+
+// Horizontal error of the receiver at HDOP 1, and the HDOP assumed until GGA tells
+#define GNSS_KALMAN_UERE_CM          400
+#define GNSS_KALMAN_DEFAULT_HDOP_E2  200
+#define GNSS_KALMAN_SPEED_SIGMA_MM_S 300
+// Process noise, white acceleration of 3 m/s^2 in Q8 m^2/s^3
+#define GNSS_KALMAN_ACCEL_NOISE_Q8   (9 * 256)
+// Longer gaps start over from the next fix
+#define GNSS_KALMAN_MAX_GAP_MS       5000
+// Squared Mahalanobis distance of a position outlier in Q8, 99.9 % of a 2-D normal are below 13.8
+#define GNSS_KALMAN_GATE_Q8          (14 * 256)
+// Fixes farther from the estimate are outliers without any math, the squared innovation in
+// millimeters overflows past about 190 km. 1 degree is about 111 km.
+#define GNSS_KALMAN_MAX_OFFSET_E6    1000000
+// Faster speeds are garbage and left out, 100 m/s is 360 km/h
+#define GNSS_KALMAN_MAX_SPEED_MM_S   100000
+// A receiver that keeps disagreeing this long is right after all, start over from its position
+#define GNSS_KALMAN_MAX_REJECTED_MS  3000
+// Receiver errors are correlated over many seconds, averaging fixes doesn't shrink them below
+// a part of the measurement variance. Without the floor the error estimate gets far too small.
+#define GNSS_KALMAN_MIN_VARIANCE_DIV 4
+
+// Millimeters per microdegree of latitude in Q8
+#define GNSS_KALMAN_MM_PER_E6_Q8     28466
+// cos() of the latitude below which longitude offsets aren't meaningful anymore (about 89.9 degrees)
+#define GNSS_KALMAN_MIN_COS_Q14      32
+
+// Squares of millimeters and of Q8 meters differ by 10^6 / 256
+#define GNSS_KALMAN_MM2_TO_Q8(mm2)   ((mm2) * 256 / 1000000)
+
+static uint32_t gnss_kalman_isqrt(uint32_t value)
+{
+    uint32_t root = 0;
+    uint32_t bit = 1u << 30;
+
+    while (bit > value) {
+        bit >>= 2;
+    }
+    while (bit != 0) {
+        if (value >= root + bit) {
+            value -= root + bit;
+            root = (root >> 1) + bit;
+        } else {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+    return root;
+}
+
+static int32_t gnss_kalman_cos_lat_q14(const struct gnss_kalman *kalman)
+{
+    const int32_t cos_lat_q14 = gnss_cos_q14(kalman->origin.lat);
+    return cos_lat_q14 > GNSS_KALMAN_MIN_COS_Q14 ? cos_lat_q14 : GNSS_KALMAN_MIN_COS_Q14;
+}
+
+static int32_t gnss_kalman_wrap_lon(int32_t lon)
+{
+    if (lon > 180000000) {
+        return lon - 360000000;
+    }
+    if (lon < -180000000) {
+        return lon + 360000000;
+    }
+    return lon;
+}
+
+static bool gnss_kalman_is_near(const struct gnss_kalman *kalman, const struct gnss_position *pos)
+{
+    const int32_t dlat = pos->lat - kalman->origin.lat;
+    const int32_t dlon = gnss_kalman_wrap_lon(pos->lon - kalman->origin.lon);
+    return dlat <= GNSS_KALMAN_MAX_OFFSET_E6 && dlat >= -GNSS_KALMAN_MAX_OFFSET_E6 &&
+           dlon <= GNSS_KALMAN_MAX_OFFSET_E6 && dlon >= -GNSS_KALMAN_MAX_OFFSET_E6;
+}
+
+// Offset of pos from the origin in millimeters, pos must be near the origin
+static void gnss_kalman_to_local(const struct gnss_kalman *kalman, const struct gnss_position *pos, int32_t *north_mm, int32_t *east_mm)
+{
+    const int32_t dlat = pos->lat - kalman->origin.lat;
+    const int32_t dlon = gnss_kalman_wrap_lon(pos->lon - kalman->origin.lon);
+
+    *north_mm = (int32_t)(((int64_t)dlat * GNSS_KALMAN_MM_PER_E6_Q8) / 256);
+    *east_mm = (int32_t)(((int64_t)dlon * GNSS_KALMAN_MM_PER_E6_Q8 * gnss_kalman_cos_lat_q14(kalman)) / (256 << 14));
+}
+
+// Per axis position and velocity measurement variances in Q8
+static int32_t gnss_kalman_position_variance_q8(uint16_t hdop_e2)
+{
+    if (hdop_e2 == 0) {
+        hdop_e2 = GNSS_KALMAN_DEFAULT_HDOP_E2;
+    }
+    // HDOP times UERE is the horizontal error, half its square falls on each axis
+    const uint64_t sigma_cm = (uint64_t)hdop_e2 * GNSS_KALMAN_UERE_CM / 100;
+    const uint64_t variance_q8 = sigma_cm * sigma_cm * 256 / (2 * 10000);
+    return variance_q8 > INT32_MAX / 2 ? INT32_MAX / 2 : (int32_t)variance_q8;
+}
+
+static int32_t gnss_kalman_velocity_variance_q8(void)
+{
+    return (int32_t)GNSS_KALMAN_MM2_TO_Q8((int64_t)GNSS_KALMAN_SPEED_SIGMA_MM_S * GNSS_KALMAN_SPEED_SIGMA_MM_S);
+}
+
+// Returns false for an impossible speed, the velocity is 0 then
+static bool gnss_kalman_velocity(uint32_t speed_knots_e3, uint32_t course_deg_e2, int32_t *north_mm_s, int32_t *east_mm_s)
+{
+    const int64_t speed_mm_s = ((int64_t)speed_knots_e3 * 1852) / 3600;
+    if (speed_mm_s > GNSS_KALMAN_MAX_SPEED_MM_S) {
+        *north_mm_s = 0;
+        *east_mm_s = 0;
+        return false;
+    }
+    const int32_t course = (int32_t)(course_deg_e2 % 36000) * 10000;
+    *north_mm_s = (int32_t)((speed_mm_s * gnss_cos_q14(course)) / (1 << 14));
+    *east_mm_s = (int32_t)((speed_mm_s * gnss_sin_q14(course)) / (1 << 14));
+    return true;
+}
+
+static void gnss_kalman_init_axis(struct gnss_kalman_axis *axis, int32_t vel_mm_s, int32_t position_variance_q8)
+{
+    axis->pos_mm = 0;
+    axis->vel_mm_s = vel_mm_s;
+    axis->p00 = position_variance_q8;
+    axis->p01 = 0;
+    axis->p11 = gnss_kalman_velocity_variance_q8();
+}
+
+static void gnss_kalman_predict_axis(struct gnss_kalman_axis *axis, uint32_t dt_ms)
+{
+    const int64_t dt = dt_ms;
+    const int64_t q = GNSS_KALMAN_ACCEL_NOISE_Q8;
+    const int64_t p01 = axis->p01;
+    const int64_t p11 = axis->p11;
+
+    // x = F x, P = F P F' + Q with F = [1 dt; 0 1] and Q = q [dt^3/3 dt^2/2; dt^2/2 dt]
+    axis->pos_mm += (int32_t)(axis->vel_mm_s * dt / 1000);
+    axis->p00 += (int32_t)(2 * dt * p01 / 1000 + dt * dt * p11 / 1000000 + q * dt * dt * dt / 3000000000);
+    axis->p01 += (int32_t)(dt * p11 / 1000 + q * dt * dt / 2000000);
+    axis->p11 += (int32_t)(q * dt / 1000);
+}
+
+// Scalar update with the position innovation y_mm, K = P H' / (H P H' + R) with H = [1 0]
+static void gnss_kalman_update_position_axis(struct gnss_kalman_axis *axis, int32_t y_mm, int32_t variance_q8)
+{
+    const int64_t s = (int64_t)axis->p00 + variance_q8;
+    const int32_t p00 = axis->p00;
+    const int32_t p01 = axis->p01;
+    // Gains in Q16, k1 per second
+    const int32_t k0 = (int32_t)(((int64_t)p00 * 65536) / s);
+    const int32_t k1 = (int32_t)(((int64_t)p01 * 65536) / s);
+
+    axis->pos_mm += (int32_t)(((int64_t)k0 * y_mm) >> 16);
+    axis->vel_mm_s += (int32_t)(((int64_t)k1 * y_mm) >> 16);
+    axis->p00 -= (int32_t)(((int64_t)k0 * p00) >> 16);
+    axis->p01 -= (int32_t)(((int64_t)k0 * p01) >> 16);
+    axis->p11 -= (int32_t)(((int64_t)k1 * p01) >> 16);
+
+    if (axis->p00 < variance_q8 / GNSS_KALMAN_MIN_VARIANCE_DIV) {
+        axis->p00 = variance_q8 / GNSS_KALMAN_MIN_VARIANCE_DIV;
+    }
+}
+
+// Same with the velocity innovation y_mm_s and H = [0 1]
+static void gnss_kalman_update_velocity_axis(struct gnss_kalman_axis *axis, int32_t y_mm_s, int32_t variance_q8)
+{
+    const int64_t s = (int64_t)axis->p11 + variance_q8;
+    const int32_t p01 = axis->p01;
+    const int32_t p11 = axis->p11;
+    // Gains in Q16, k0 in seconds
+    const int32_t k0 = (int32_t)(((int64_t)p01 * 65536) / s);
+    const int32_t k1 = (int32_t)(((int64_t)p11 * 65536) / s);
+
+    axis->pos_mm += (int32_t)(((int64_t)k0 * y_mm_s) >> 16);
+    axis->vel_mm_s += (int32_t)(((int64_t)k1 * y_mm_s) >> 16);
+    axis->p00 -= (int32_t)(((int64_t)k0 * p01) >> 16);
+    axis->p01 -= (int32_t)(((int64_t)k0 * p11) >> 16);
+    axis->p11 -= (int32_t)(((int64_t)k1 * p11) >> 16);
+}
+
+// Squared Mahalanobis distance of an innovation in Q8
+static int64_t gnss_kalman_distance_q8(const struct gnss_kalman_axis *axis, int32_t y_mm, int32_t variance_q8)
+{
+    const int64_t y2_q8 = GNSS_KALMAN_MM2_TO_Q8((int64_t)y_mm * y_mm);
+    return y2_q8 * 256 / ((int64_t)axis->p00 + variance_q8);
+}
+
+// Move whole microdegrees of the offsets into the origin
+static void gnss_kalman_recenter(struct gnss_kalman *kalman)
+{
+    const int64_t east_mm_per_e6_q22 = (int64_t)GNSS_KALMAN_MM_PER_E6_Q8 * gnss_kalman_cos_lat_q14(kalman);
+    const int32_t dlon = (int32_t)(((int64_t)kalman->east.pos_mm * (256 << 14)) / east_mm_per_e6_q22);
+    kalman->origin.lon = gnss_kalman_wrap_lon(kalman->origin.lon + dlon);
+    kalman->east.pos_mm -= (int32_t)((dlon * east_mm_per_e6_q22) / (256 << 14));
+
+    const int32_t dlat = (int32_t)(((int64_t)kalman->north.pos_mm * 256) / GNSS_KALMAN_MM_PER_E6_Q8);
+    kalman->origin.lat += dlat;
+    kalman->north.pos_mm -= (int32_t)(((int64_t)dlat * GNSS_KALMAN_MM_PER_E6_Q8) / 256);
+}
+
+void gnss_kalman_reset(struct gnss_kalman *kalman)
+{
+    assert(kalman);
+    kalman->initialized = false;
+    kalman->rejected = false;
+}
+
+bool gnss_kalman_update(struct gnss_kalman *kalman, const struct gnss_position *pos, uint32_t speed_knots_e3,
+                        uint32_t course_deg_e2, uint16_t hdop_e2, uint32_t time_ms)
+{
+    assert(kalman);
+    assert(pos);
+
+    const int32_t position_variance_q8 = gnss_kalman_position_variance_q8(hdop_e2);
+    const int32_t velocity_variance_q8 = gnss_kalman_velocity_variance_q8();
+    int32_t vel_north_mm_s;
+    int32_t vel_east_mm_s;
+    const bool velocity_valid = gnss_kalman_velocity(speed_knots_e3, course_deg_e2, &vel_north_mm_s, &vel_east_mm_s);
+
+    const uint32_t dt_ms = time_ms - kalman->time_ms;
+    const bool rejected_too_long = kalman->rejected && time_ms - kalman->first_rejected_ms > GNSS_KALMAN_MAX_REJECTED_MS;
+    if (kalman->initialized == false || dt_ms > GNSS_KALMAN_MAX_GAP_MS || rejected_too_long) {
+        kalman->initialized = true;
+        kalman->time_ms = time_ms;
+        kalman->origin = *pos;
+        kalman->rejected = false;
+        gnss_kalman_init_axis(&kalman->north, vel_north_mm_s, position_variance_q8);
+        gnss_kalman_init_axis(&kalman->east, vel_east_mm_s, position_variance_q8);
+        return true;
+    }
+
+    kalman->time_ms = time_ms;
+    gnss_kalman_predict_axis(&kalman->north, dt_ms);
+    gnss_kalman_predict_axis(&kalman->east, dt_ms);
+
+    // A multipath jump is far outside of what the filter expects, leave the position out then.
+    // Fixes like 0/0 are rejected before they get near the math.
+    bool accepted = gnss_kalman_is_near(kalman, pos);
+    int32_t y_north_mm = 0;
+    int32_t y_east_mm = 0;
+    if (accepted) {
+        int32_t north_mm;
+        int32_t east_mm;
+        gnss_kalman_to_local(kalman, pos, &north_mm, &east_mm);
+        y_north_mm = north_mm - kalman->north.pos_mm;
+        y_east_mm = east_mm - kalman->east.pos_mm;
+        const int64_t distance_q8 = gnss_kalman_distance_q8(&kalman->north, y_north_mm, position_variance_q8) +
+                                    gnss_kalman_distance_q8(&kalman->east, y_east_mm, position_variance_q8);
+        accepted = distance_q8 <= GNSS_KALMAN_GATE_Q8;
+    }
+    if (accepted) {
+        gnss_kalman_update_position_axis(&kalman->north, y_north_mm, position_variance_q8);
+        gnss_kalman_update_position_axis(&kalman->east, y_east_mm, position_variance_q8);
+        kalman->rejected = false;
+    } else if (kalman->rejected == false) {
+        kalman->rejected = true;
+        kalman->first_rejected_ms = time_ms;
+    }
+
+    if (velocity_valid) {
+        gnss_kalman_update_velocity_axis(&kalman->north, vel_north_mm_s - kalman->north.vel_mm_s, velocity_variance_q8);
+        gnss_kalman_update_velocity_axis(&kalman->east, vel_east_mm_s - kalman->east.vel_mm_s, velocity_variance_q8);
+    }
+
+    gnss_kalman_recenter(kalman);
+    return accepted;
+}
+
+void gnss_kalman_get_position(const struct gnss_kalman *kalman, struct gnss_position *pos)
+{
+    assert(kalman);
+    assert(pos);
+    assert(kalman->initialized);
+
+    // Offsets are below a microdegree after recentering
+    pos->lat = kalman->origin.lat + (int32_t)(((int64_t)kalman->north.pos_mm * 256) / GNSS_KALMAN_MM_PER_E6_Q8);
+    pos->lon = gnss_kalman_wrap_lon(kalman->origin.lon + (int32_t)(((int64_t)kalman->east.pos_mm * (256 << 14)) /
+                                    ((int64_t)GNSS_KALMAN_MM_PER_E6_Q8 * gnss_kalman_cos_lat_q14(kalman))));
+}
+
+uint32_t gnss_kalman_get_error_cm(const struct gnss_kalman *kalman)
+{
+    assert(kalman);
+
+    const uint64_t variance_q8 = (uint64_t)kalman->north.p00 + (uint64_t)kalman->east.p00;
+    const uint64_t variance_cm2 = variance_q8 * 10000 / 256;
+    return gnss_kalman_isqrt(variance_cm2 > UINT32_MAX ? UINT32_MAX : (uint32_t)variance_cm2);
+}
@@ -0,0 +1,38 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "gnss/gnss_geo.h"
+
+// Constant velocity Kalman filter of the horizontal position, integer math only. North and
+// east are filtered independently in a local frame around origin, which follows the estimate
+// so the offsets stay small. Offsets are in millimeters, variances in Q8 square meters.
+struct gnss_kalman_axis {
+    int32_t pos_mm;
+    int32_t vel_mm_s;
+    // Covariance of position and velocity, in m^2, m^2/s and m^2/s^2
+    int32_t p00;
+    int32_t p01;
+    int32_t p11;
+};
+
+struct gnss_kalman {
+    bool initialized;
+    uint32_t time_ms;
+    struct gnss_position origin;
+    struct gnss_kalman_axis north;
+    struct gnss_kalman_axis east;
+    // Positions are rejected as outliers since first_rejected_ms
+    bool rejected;
+    uint32_t first_rejected_ms;
+};
+
+void gnss_kalman_reset(struct gnss_kalman *kalman);
+// Feed a fix received at time_ms, hdop_e2 is 0 if unknown. Returns false if the position
+// was rejected as an outlier, the velocity is used either way unless the speed is impossible.
+bool gnss_kalman_update(struct gnss_kalman *kalman, const struct gnss_position *pos, uint32_t speed_knots_e3,
+                        uint32_t course_deg_e2, uint16_t hdop_e2, uint32_t time_ms);
+void gnss_kalman_get_position(const struct gnss_kalman *kalman, struct gnss_position *pos);
+// 1-sigma horizontal position error of the estimate
+uint32_t gnss_kalman_get_error_cm(const struct gnss_kalman *kalman);
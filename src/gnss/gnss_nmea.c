@@ -0,0 +1,516 @@
+#include <assert.h>
+#include <string.h>
+
+#include "gnss_nmea.h"
+
+// Fields of an RMC sentence, up to the last one minmea requires
+enum gnss_nmea_rmc_fields {
+    GNSS_NMEA_RMC_ADDRESS,
+    GNSS_NMEA_RMC_TIME,
+    GNSS_NMEA_RMC_STATUS,
+    GNSS_NMEA_RMC_LAT,
+    GNSS_NMEA_RMC_LAT_HEMISPHERE,
+    GNSS_NMEA_RMC_LON,
+    GNSS_NMEA_RMC_LON_HEMISPHERE,
+    GNSS_NMEA_RMC_SPEED,
+    GNSS_NMEA_RMC_COURSE,
+    GNSS_NMEA_RMC_DATE,
+    GNSS_NMEA_RMC_VARIATION,
+    GNSS_NMEA_RMC_VARIATION_HEMISPHERE,
+    GNSS_NMEA_RMC_FIELDS_LENGTH
+};
+
+// Fields of a GGA sentence, up to HDOP
+enum gnss_nmea_gga_fields {
+    GNSS_NMEA_GGA_ADDRESS,
+    GNSS_NMEA_GGA_TIME,
+    GNSS_NMEA_GGA_LAT,
+    GNSS_NMEA_GGA_LAT_HEMISPHERE,
+    GNSS_NMEA_GGA_LON,
+    GNSS_NMEA_GGA_LON_HEMISPHERE,
+    GNSS_NMEA_GGA_FIX_QUALITY,
+    GNSS_NMEA_GGA_SATELLITES,
+    GNSS_NMEA_GGA_HDOP,
+    GNSS_NMEA_GGA_FIELDS_LENGTH
+};
+
+// Fields of a GSA sentence, satellite IDs of up to twelve channels between fix type and PDOP
+enum gnss_nmea_gsa_fields {
+    GNSS_NMEA_GSA_ADDRESS,
+    GNSS_NMEA_GSA_MODE,
+    GNSS_NMEA_GSA_FIX_TYPE,
+    GNSS_NMEA_GSA_SATELLITE_FIRST,
+    GNSS_NMEA_GSA_SATELLITE_LAST = GNSS_NMEA_GSA_SATELLITE_FIRST + 11,
+    GNSS_NMEA_GSA_PDOP,
+    GNSS_NMEA_GSA_HDOP,
+    GNSS_NMEA_GSA_VDOP,
+    GNSS_NMEA_GSA_FIELDS_LENGTH
+};
+
+// Fields of a VTG sentence, NMEA 2.3 style with unit letters
+enum gnss_nmea_vtg_fields {
+    GNSS_NMEA_VTG_ADDRESS,
+    GNSS_NMEA_VTG_COURSE_TRUE,
+    GNSS_NMEA_VTG_COURSE_TRUE_UNIT,
+    GNSS_NMEA_VTG_COURSE_MAGNETIC,
+    GNSS_NMEA_VTG_COURSE_MAGNETIC_UNIT,
+    GNSS_NMEA_VTG_SPEED_KNOTS,
+    GNSS_NMEA_VTG_SPEED_KNOTS_UNIT,
+    GNSS_NMEA_VTG_SPEED_KMPH,
+    GNSS_NMEA_VTG_SPEED_KMPH_UNIT,
+    GNSS_NMEA_VTG_FIELDS_LENGTH
+};
+
+// Old VTG without the unit letters
+enum gnss_nmea_vtg_old_fields {
+    GNSS_NMEA_VTG_OLD_ADDRESS,
+    GNSS_NMEA_VTG_OLD_COURSE_TRUE,
+    GNSS_NMEA_VTG_OLD_COURSE_MAGNETIC,
+    GNSS_NMEA_VTG_OLD_SPEED_KNOTS,
+    GNSS_NMEA_VTG_OLD_SPEED_KMPH,
+    GNSS_NMEA_VTG_OLD_FIELDS_LENGTH
+};
+
+static int gnss_nmea_hex_value(char ch)
+{
+    if (ch >= '0' && ch <= '9') {
+        return ch - '0';
+    }
+    if (ch >= 'A' && ch <= 'F') {
+        return ch - 'A' + 10;
+    }
+    if (ch >= 'a' && ch <= 'f') {
+        return ch - 'a' + 10;
+    }
+    return -1;
+}
+
+static void gnss_nmea_tokenizer_start(struct gnss_nmea_tokenizer *tokenizer)
+{
+    struct gnss_nmea_sentence *sentence = &tokenizer->sentence;
+
+    sentence->data[0] = '$';
+    sentence->length = 1;
+    sentence->field_offsets[0] = 1;
+    sentence->field_count = 1;
+    tokenizer->checksum = 0;
+    tokenizer->state = GNSS_NMEA_TOKENIZER_STATE_FIELDS;
+}
+
+// Returns false if the sentence got longer than NMEA allows
+static bool gnss_nmea_tokenizer_store(struct gnss_nmea_tokenizer *tokenizer, char ch)
+{
+    struct gnss_nmea_sentence *sentence = &tokenizer->sentence;
+
+    // Keep room for the NUL
+    if (sentence->length >= sizeof(sentence->data) - 1) {
+        return false;
+    }
+    sentence->data[sentence->length++] = ch;
+    return true;
+}
+
+void gnss_nmea_tokenizer_init(struct gnss_nmea_tokenizer *tokenizer)
+{
+    assert(tokenizer);
+    tokenizer->state = GNSS_NMEA_TOKENIZER_STATE_START;
+}
+
+bool gnss_nmea_tokenizer_feed(struct gnss_nmea_tokenizer *tokenizer, char ch)
+{
+    assert(tokenizer);
+    struct gnss_nmea_sentence *sentence = &tokenizer->sentence;
+
+    // A start character always begins a new sentence, whatever came before it is dropped
+    if (ch == '$') {
+        gnss_nmea_tokenizer_start(tokenizer);
+        return false;
+    }
+
+    switch (tokenizer->state) {
+        case GNSS_NMEA_TOKENIZER_STATE_START:
+            return false;
+
+        case GNSS_NMEA_TOKENIZER_STATE_FIELDS:
+            if (ch == '*') {
+                if (gnss_nmea_tokenizer_store(tokenizer, ch)) {
+                    tokenizer->state = GNSS_NMEA_TOKENIZER_STATE_CHECKSUM_HI;
+                    return false;
+                }
+                break;
+            }
+
+            // Line endings before the checksum and non-printable characters both mean a broken sentence
+            if (ch < 0x20 || ch > 0x7e) {
+                break;
+            }
+
+            if (gnss_nmea_tokenizer_store(tokenizer, ch) == false) {
+                break;
+            }
+            tokenizer->checksum ^= (uint8_t)ch;
+
+            if (ch == ',') {
+                if (sentence->field_count == GNSS_NMEA_MAX_FIELDS) {
+                    break;
+                }
+                sentence->field_offsets[sentence->field_count++] = sentence->length;
+            }
+            return false;
+
+        case GNSS_NMEA_TOKENIZER_STATE_CHECKSUM_HI: {
+            int value = gnss_nmea_hex_value(ch);
+            if (value < 0 || gnss_nmea_tokenizer_store(tokenizer, ch) == false) {
+                break;
+            }
+            tokenizer->received_checksum = (uint8_t)(value << 4);
+            tokenizer->state = GNSS_NMEA_TOKENIZER_STATE_CHECKSUM_LO;
+            return false;
+        }
+
+        case GNSS_NMEA_TOKENIZER_STATE_CHECKSUM_LO: {
+            int value = gnss_nmea_hex_value(ch);
+            if (value < 0 || gnss_nmea_tokenizer_store(tokenizer, ch) == false) {
+                break;
+            }
+            tokenizer->received_checksum |= (uint8_t)value;
+            tokenizer->state = GNSS_NMEA_TOKENIZER_STATE_END;
+            return false;
+        }
+
+        case GNSS_NMEA_TOKENIZER_STATE_END:
+            if ((ch == '\r' || ch == '\n') && tokenizer->received_checksum == tokenizer->checksum) {
+                sentence->data[sentence->length] = '\0';
+                tokenizer->state = GNSS_NMEA_TOKENIZER_STATE_START;
+                return true;
+            }
+            break;
+
+        default:
+            assert(0);
+    }
+
+    // Broken sentence, wait for the next start character
+    tokenizer->state = GNSS_NMEA_TOKENIZER_STATE_START;
+    return false;
+}
+
+const char *gnss_nmea_field(const struct gnss_nmea_sentence *sentence, size_t index, size_t *length)
+{
+    assert(sentence);
+    assert(index < sentence->field_count);
+    assert(length);
+
+    const size_t start = sentence->field_offsets[index];
+    // Every field but the last one ends at a ',', the last one at the '*'
+    const size_t end = index + 1 < sentence->field_count ? sentence->field_offsets[index + 1] - 1u : sentence->length - 3u;
+    *length = end - start;
+    return &sentence->data[start];
+}
+
+bool gnss_nmea_sentence_is(const struct gnss_nmea_sentence *sentence, const char *type)
+{
+    assert(sentence);
+    assert(type);
+
+    size_t length;
+    const char *address = gnss_nmea_field(sentence, 0, &length);
+    const size_t type_length = strlen(type);
+    // Two character talker ID ("GP", "GN") followed by the type
+    return length == 2 + type_length && memcmp(&address[2], type, type_length) == 0;
+}
+
+// Unsigned decimal number as value / scale, where scale is a power of ten up to 10^9. Digits
+// which don't fit into the value or the scale are truncated, so the result matches minmea_float.
+static bool gnss_nmea_parse_decimal(const char *field, size_t length, uint32_t *value, uint32_t *scale)
+{
+    uint32_t v = 0;
+    uint32_t s = 0;
+    bool digits = false;
+
+    for (size_t i=0; i<length; i++) {
+        const char ch = field[i];
+        if (ch == '.' && s == 0) {
+            s = 1;
+            continue;
+        }
+        if (ch < '0' || ch > '9') {
+            return false;
+        }
+
+        const uint32_t digit = (uint32_t)(ch - '0');
+        if (v > (INT32_MAX - digit) / 10 || s > INT32_MAX / 10) {
+            // Out of bits, drop the extra precision but not integer digits
+            if (s == 0) {
+                return false;
+            }
+            break;
+        }
+        v = v * 10 + digit;
+        if (s != 0) {
+            s *= 10;
+        }
+        digits = true;
+    }
+
+    if (digits == false) {
+        // Empty, a lone '.' is malformed
+        if (s != 0) {
+            return false;
+        }
+        *value = 0;
+        *scale = 0;
+        return true;
+    }
+
+    *value = v;
+    *scale = s == 0 ? 1 : s;
+    return true;
+}
+
+// value / scale in units of 1 / unit_scale, unit_scale being a power of ten as well. Fails if the result
+// doesn't fit 32 bits.
+static bool gnss_nmea_rescale(uint32_t value, uint32_t scale, uint32_t unit_scale, uint32_t *fixed)
+{
+    if (scale == 0) {
+        *fixed = 0;
+        return true;
+    }
+    // Both are powers of ten, so this is exact and needs no 64 bit division
+    if (scale >= unit_scale) {
+        *fixed = value / (scale / unit_scale);
+        return true;
+    }
+
+    const uint32_t factor = unit_scale / scale;
+    if (value > UINT32_MAX / factor) {
+        return false;
+    }
+    *fixed = value * factor;
+    return true;
+}
+
+// Hemisphere as the sign of the coordinate, 0 if the field is empty
+static bool gnss_nmea_parse_hemisphere(const char *field, size_t length, char positive, char negative, int32_t *sign)
+{
+    if (length == 0) {
+        *sign = 0;
+        return true;
+    }
+    if (field[0] == positive) {
+        *sign = 1;
+        return true;
+    }
+    if (field[0] == negative) {
+        *sign = -1;
+        return true;
+    }
+    return false;
+}
+
+// NMEA (d)ddmm.mmmm to microdegrees
+static bool gnss_nmea_parse_coord(const struct gnss_nmea_sentence *sentence, size_t coord_index, char positive, char negative, int32_t *coord_e6)
+{
+    size_t length;
+    const char *field = gnss_nmea_field(sentence, coord_index, &length);
+    uint32_t value;
+    uint32_t scale;
+    if (gnss_nmea_parse_decimal(field, length, &value, &scale) == false) {
+        return false;
+    }
+
+    field = gnss_nmea_field(sentence, coord_index + 1, &length);
+    int32_t sign;
+    if (gnss_nmea_parse_hemisphere(field, length, positive, negative, &sign) == false) {
+        return false;
+    }
+
+    if (scale == 0) {
+        *coord_e6 = 0;
+        return true;
+    }
+
+    // Digits past 10^-7 minutes don't reach a microdegree, dropping them keeps scale * 100 in 32 bits
+    while (scale > 10000000) {
+        value /= 10;
+        scale /= 10;
+    }
+
+    const uint32_t degrees = value / (scale * 100);
+    const uint32_t minutes = value % (scale * 100);
+    if (degrees > 180) {
+        return false;
+    }
+    // minutes * 1e6 / (60 * scale) without 64 bit math, exact because scale is a power of ten
+    const uint32_t minutes_e6 = scale <= 1000000 ? minutes * (1000000 / scale) : minutes / (scale / 1000000);
+    *coord_e6 = sign * (int32_t)(degrees * 1000000 + minutes_e6 / 60);
+    return true;
+}
+
+static bool gnss_nmea_parse_fixed(const struct gnss_nmea_sentence *sentence, size_t index, uint32_t unit_scale, uint32_t *fixed)
+{
+    size_t length;
+    const char *field = gnss_nmea_field(sentence, index, &length);
+    uint32_t value;
+    uint32_t scale;
+    if (gnss_nmea_parse_decimal(field, length, &value, &scale) == false) {
+        return false;
+    }
+    return gnss_nmea_rescale(value, scale, unit_scale, fixed);
+}
+
+// hhmmss with optional fraction to milliseconds of the day, GNSS_NMEA_NO_TIME if the field is empty
+static bool gnss_nmea_parse_time(const struct gnss_nmea_sentence *sentence, size_t index, uint32_t *time_ms)
+{
+    size_t length;
+    const char *field = gnss_nmea_field(sentence, index, &length);
+    if (length == 0) {
+        *time_ms = GNSS_NMEA_NO_TIME;
+        return true;
+    }
+    if (length < 6) {
+        return false;
+    }
+
+    uint32_t digits[6];
+    for (size_t i=0; i<6; i++) {
+        if (field[i] < '0' || field[i] > '9') {
+            return false;
+        }
+        digits[i] = (uint32_t)(field[i] - '0');
+    }
+    const uint32_t hours = digits[0] * 10 + digits[1];
+    const uint32_t minutes = digits[2] * 10 + digits[3];
+    // 60 is a leap second
+    const uint32_t seconds = digits[4] * 10 + digits[5];
+    if (hours > 23 || minutes > 59 || seconds > 60) {
+        return false;
+    }
+
+    uint32_t ms = 0;
+    if (length > 6) {
+        uint32_t value;
+        uint32_t scale;
+        if (field[6] != '.' || gnss_nmea_parse_decimal(&field[6], length - 6, &value, &scale) == false ||
+            gnss_nmea_rescale(value, scale, 1000, &ms) == false) {
+            return false;
+        }
+    }
+
+    *time_ms = ((hours * 60 + minutes) * 60 + seconds) * 1000 + ms;
+    return true;
+}
+
+bool gnss_nmea_parse_rmc(const struct gnss_nmea_sentence *sentence, struct gnss_nmea_rmc *rmc)
+{
+    assert(sentence);
+    assert(rmc);
+
+    if (sentence->field_count < GNSS_NMEA_RMC_FIELDS_LENGTH || gnss_nmea_sentence_is(sentence, "RMC") == false) {
+        return false;
+    }
+
+    size_t length;
+    const char *status = gnss_nmea_field(sentence, GNSS_NMEA_RMC_STATUS, &length);
+    rmc->valid = length > 0 && status[0] == 'A';
+
+    return gnss_nmea_parse_time(sentence, GNSS_NMEA_RMC_TIME, &rmc->time_ms) &&
+           gnss_nmea_parse_coord(sentence, GNSS_NMEA_RMC_LAT, 'N', 'S', &rmc->lat_e6) &&
+           gnss_nmea_parse_coord(sentence, GNSS_NMEA_RMC_LON, 'E', 'W', &rmc->lon_e6) &&
+           gnss_nmea_parse_fixed(sentence, GNSS_NMEA_RMC_SPEED, 1000, &rmc->speed_knots_e3) &&
+           gnss_nmea_parse_fixed(sentence, GNSS_NMEA_RMC_COURSE, 100, &rmc->course_deg_e2);
+}
+
+bool gnss_nmea_parse_gga(const struct gnss_nmea_sentence *sentence, struct gnss_nmea_gga *gga)
+{
+    assert(sentence);
+    assert(gga);
+
+    if (sentence->field_count < GNSS_NMEA_GGA_FIELDS_LENGTH || gnss_nmea_sentence_is(sentence, "GGA") == false) {
+        return false;
+    }
+
+    uint32_t fix_quality;
+    uint32_t satellites;
+    uint32_t hdop_e2;
+    if (gnss_nmea_parse_time(sentence, GNSS_NMEA_GGA_TIME, &gga->time_ms) == false ||
+        gnss_nmea_parse_coord(sentence, GNSS_NMEA_GGA_LAT, 'N', 'S', &gga->lat_e6) == false ||
+        gnss_nmea_parse_coord(sentence, GNSS_NMEA_GGA_LON, 'E', 'W', &gga->lon_e6) == false ||
+        gnss_nmea_parse_fixed(sentence, GNSS_NMEA_GGA_FIX_QUALITY, 1, &fix_quality) == false ||
+        gnss_nmea_parse_fixed(sentence, GNSS_NMEA_GGA_SATELLITES, 1, &satellites) == false ||
+        gnss_nmea_parse_fixed(sentence, GNSS_NMEA_GGA_HDOP, 100, &hdop_e2) == false) {
+        return false;
+    }
+    if (fix_quality > UINT8_MAX || satellites > UINT8_MAX || hdop_e2 > UINT16_MAX) {
+        return false;
+    }
+
+    gga->fix_quality = (uint8_t)fix_quality;
+    gga->satellites = (uint8_t)satellites;
+    gga->hdop_e2 = (uint16_t)hdop_e2;
+    return true;
+}
+
+bool gnss_nmea_parse_gsa(const struct gnss_nmea_sentence *sentence, struct gnss_nmea_gsa *gsa)
+{
+    assert(sentence);
+    assert(gsa);
+
+    if (sentence->field_count < GNSS_NMEA_GSA_FIELDS_LENGTH || gnss_nmea_sentence_is(sentence, "GSA") == false) {
+        return false;
+    }
+
+    uint32_t fix_type;
+    uint32_t pdop_e2;
+    uint32_t hdop_e2;
+    uint32_t vdop_e2;
+    if (gnss_nmea_parse_fixed(sentence, GNSS_NMEA_GSA_FIX_TYPE, 1, &fix_type) == false ||
+        gnss_nmea_parse_fixed(sentence, GNSS_NMEA_GSA_PDOP, 100, &pdop_e2) == false ||
+        gnss_nmea_parse_fixed(sentence, GNSS_NMEA_GSA_HDOP, 100, &hdop_e2) == false ||
+        gnss_nmea_parse_fixed(sentence, GNSS_NMEA_GSA_VDOP, 100, &vdop_e2) == false) {
+        return false;
+    }
+    if (fix_type > UINT8_MAX || pdop_e2 > UINT16_MAX || hdop_e2 > UINT16_MAX || vdop_e2 > UINT16_MAX) {
+        return false;
+    }
+
+    // Channels without a satellite are left empty
+    uint8_t satellites = 0;
+    for (size_t i=GNSS_NMEA_GSA_SATELLITE_FIRST; i<=GNSS_NMEA_GSA_SATELLITE_LAST; i++) {
+        size_t length;
+        gnss_nmea_field(sentence, i, &length);
+        satellites += length > 0;
+    }
+
+    gsa->fix_type = (uint8_t)fix_type;
+    gsa->satellites = satellites;
+    gsa->pdop_e2 = (uint16_t)pdop_e2;
+    gsa->hdop_e2 = (uint16_t)hdop_e2;
+    gsa->vdop_e2 = (uint16_t)vdop_e2;
+    return true;
+}
+
+bool gnss_nmea_parse_vtg(const struct gnss_nmea_sentence *sentence, struct gnss_nmea_vtg *vtg)
+{
+    assert(sentence);
+    assert(vtg);
+
+    if (gnss_nmea_sentence_is(sentence, "VTG") == false) {
+        return false;
+    }
+
+    // The unit letter after the true course tells the two formats apart
+    size_t length;
+    if (sentence->field_count >= GNSS_NMEA_VTG_FIELDS_LENGTH) {
+        const char *unit = gnss_nmea_field(sentence, GNSS_NMEA_VTG_COURSE_TRUE_UNIT, &length);
+        if (length == 1 && unit[0] == 'T') {
+            return gnss_nmea_parse_fixed(sentence, GNSS_NMEA_VTG_COURSE_TRUE, 100, &vtg->course_deg_e2) &&
+                   gnss_nmea_parse_fixed(sentence, GNSS_NMEA_VTG_SPEED_KNOTS, 1000, &vtg->speed_knots_e3);
+        }
+    }
+    if (sentence->field_count >= GNSS_NMEA_VTG_OLD_FIELDS_LENGTH) {
+        return gnss_nmea_parse_fixed(sentence, GNSS_NMEA_VTG_OLD_COURSE_TRUE, 100, &vtg->course_deg_e2) &&
+               gnss_nmea_parse_fixed(sentence, GNSS_NMEA_VTG_OLD_SPEED_KNOTS, 1000, &vtg->speed_knots_e3);
+    }
+    return false;
+}
@@ -0,0 +1,98 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+// NMEA 0183 limits a sentence to 82 characters from '$' through <CR><LF>
+#define GNSS_NMEA_MAX_SENTENCE_LENGTH 82
+// GSV with four satellites has the most fields of the sentences we may get
+#define GNSS_NMEA_MAX_FIELDS          21
+
+// A complete sentence with a verified checksum, "$GPRMC,...*hh" without the line ending
+struct gnss_nmea_sentence {
+    char data[GNSS_NMEA_MAX_SENTENCE_LENGTH - 2 + 1];
+    uint8_t length;
+    // Offsets of the first character of every field, field 0 is the address ("GPRMC")
+    uint8_t field_offsets[GNSS_NMEA_MAX_FIELDS];
+    uint8_t field_count;
+};
+
+enum gnss_nmea_tokenizer_state {
+    GNSS_NMEA_TOKENIZER_STATE_START,
+    GNSS_NMEA_TOKENIZER_STATE_FIELDS,
+    GNSS_NMEA_TOKENIZER_STATE_CHECKSUM_HI,
+    GNSS_NMEA_TOKENIZER_STATE_CHECKSUM_LO,
+    GNSS_NMEA_TOKENIZER_STATE_END
+};
+
+// Time of day of a sentence that left it empty
+#define GNSS_NMEA_NO_TIME UINT32_MAX
+
+// Fixed-point contents of an RMC sentence
+struct gnss_nmea_rmc {
+    bool valid;
+    // UTC milliseconds of the day or GNSS_NMEA_NO_TIME
+    uint32_t time_ms;
+    // Microdegrees, negative south and west
+    int32_t lat_e6;
+    int32_t lon_e6;
+    // Thousandths of a knot and hundredths of a degree, 0 when the receiver leaves them empty
+    uint32_t speed_knots_e3;
+    uint32_t course_deg_e2;
+};
+
+// Fixed-point contents of a GGA sentence, the fields we use
+struct gnss_nmea_gga {
+    // UTC milliseconds of the day or GNSS_NMEA_NO_TIME
+    uint32_t time_ms;
+    // Microdegrees, negative south and west
+    int32_t lat_e6;
+    int32_t lon_e6;
+    // 0 no fix, 1 GPS, 2 DGPS, ...
+    uint8_t fix_quality;
+    uint8_t satellites;
+    // Horizontal dilution of precision in hundredths, 0 when the receiver leaves it empty
+    uint16_t hdop_e2;
+};
+
+// Fixed-point contents of a GSA sentence
+struct gnss_nmea_gsa {
+    // 1 no fix, 2 2D, 3 3D
+    uint8_t fix_type;
+    // Channels with a satellite used in the fix
+    uint8_t satellites;
+    // Dilutions of precision in hundredths, 0 when the receiver leaves them empty
+    uint16_t pdop_e2;
+    uint16_t hdop_e2;
+    uint16_t vdop_e2;
+};
+
+// Fixed-point contents of a VTG sentence, 0 when the receiver leaves them empty
+struct gnss_nmea_vtg {
+    // Hundredths of a degree, clockwise from true north
+    uint32_t course_deg_e2;
+    uint32_t speed_knots_e3;
+};
+
+struct gnss_nmea_tokenizer {
+    enum gnss_nmea_tokenizer_state state;
+    uint8_t checksum;
+    uint8_t received_checksum;
+    struct gnss_nmea_sentence sentence;
+};
+
+void gnss_nmea_tokenizer_init(struct gnss_nmea_tokenizer *tokenizer);
+// Consume one received character, returns true when tokenizer->sentence holds a new valid sentence
+bool gnss_nmea_tokenizer_feed(struct gnss_nmea_tokenizer *tokenizer, char ch);
+
+// Field index of the sentence and its length, the field isn't NUL terminated
+const char *gnss_nmea_field(const struct gnss_nmea_sentence *sentence, size_t index, size_t *length);
+// Compare the sentence type ("RMC") ignoring the talker ID
+bool gnss_nmea_sentence_is(const struct gnss_nmea_sentence *sentence, const char *type);
+
+// Decode an RMC sentence straight from its digits, no floats and no format strings
+bool gnss_nmea_parse_rmc(const struct gnss_nmea_sentence *sentence, struct gnss_nmea_rmc *rmc);
+bool gnss_nmea_parse_gga(const struct gnss_nmea_sentence *sentence, struct gnss_nmea_gga *gga);
+bool gnss_nmea_parse_gsa(const struct gnss_nmea_sentence *sentence, struct gnss_nmea_gsa *gsa);
+bool gnss_nmea_parse_vtg(const struct gnss_nmea_sentence *sentence, struct gnss_nmea_vtg *vtg);
@@ -0,0 +1,103 @@
+#include <assert.h>
+#include <string.h>
+
+#include "gnss_pmtk.h"
+
+static const char gnss_pmtk_hex_digits[] = "0123456789ABCDEF";
+
+// Non-negative decimal field that fits into max, false if empty or malformed
+static bool gnss_pmtk_parse_uint(const char *field, size_t length, uint32_t max, uint32_t *value)
+{
+    uint32_t v = 0;
+
+    if (length == 0) {
+        return false;
+    }
+    for (size_t i=0; i<length; i++) {
+        if (field[i] < '0' || field[i] > '9') {
+            return false;
+        }
+        v = v * 10 + (uint32_t)(field[i] - '0');
+        if (v > max) {
+            return false;
+        }
+    }
+
+    *value = v;
+    return true;
+}
+
+size_t gnss_pmtk_format(char *buffer, size_t size, uint16_t command, const char *args)
+{
+    assert(buffer);
+    assert(command <= 999);
+    assert(args);
+
+    const size_t args_length = strlen(args);
+    // "$PMTK" + 3 digit command + ("," + args) + "*hh\r\n"
+    const size_t length = 5 + 3 + (args_length > 0 ? 1 + args_length : 0) + 5;
+    // Keep room for the NUL
+    if (length >= size || length > GNSS_NMEA_MAX_SENTENCE_LENGTH) {
+        return 0;
+    }
+
+    size_t i = 0;
+    memcpy(&buffer[i], "$PMTK", 5);
+    i += 5;
+    buffer[i++] = (char)('0' + command / 100);
+    buffer[i++] = (char)('0' + command / 10 % 10);
+    buffer[i++] = (char)('0' + command % 10);
+    if (args_length > 0) {
+        buffer[i++] = ',';
+        memcpy(&buffer[i], args, args_length);
+        i += args_length;
+    }
+
+    // XOR of everything between '$' and '*'
+    uint8_t checksum = 0;
+    for (size_t j=1; j<i; j++) {
+        checksum ^= (uint8_t)buffer[j];
+    }
+
+    buffer[i++] = '*';
+    buffer[i++] = gnss_pmtk_hex_digits[checksum >> 4];
+    buffer[i++] = gnss_pmtk_hex_digits[checksum & 0xf];
+    buffer[i++] = '\r';
+    buffer[i++] = '\n';
+    buffer[i] = '\0';
+
+    assert(i == length);
+    return length;
+}
+
+bool gnss_pmtk_parse_ack(const struct gnss_nmea_sentence *sentence, uint16_t *command, enum gnss_pmtk_ack *ack)
+{
+    assert(sentence);
+    assert(command);
+    assert(ack);
+
+    // $PMTK001,<command>,<flag>
+    if (sentence->field_count < 3) {
+        return false;
+    }
+
+    size_t length;
+    const char *field = gnss_nmea_field(sentence, 0, &length);
+    if (length != 7 || memcmp(field, "PMTK001", 7) != 0) {
+        return false;
+    }
+
+    uint32_t value;
+    field = gnss_nmea_field(sentence, 1, &length);
+    if (gnss_pmtk_parse_uint(field, length, 999, &value) == false) {
+        return false;
+    }
+    *command = (uint16_t)value;
+
+    field = gnss_nmea_field(sentence, 2, &length);
+    if (gnss_pmtk_parse_uint(field, length, GNSS_PMTK_ACK_SUCCEEDED, &value) == false) {
+        return false;
+    }
+    *ack = (enum gnss_pmtk_ack)value;
+    return true;
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include "gnss_nmea.h"
+
+// MTK receiver commands we use
+#define GNSS_PMTK_ACK                 1
+#define GNSS_PMTK_SET_NMEA_UPDATERATE 220
+#define GNSS_PMTK_SET_NMEA_BAUDRATE   251
+#define GNSS_PMTK_API_SET_NMEA_OUTPUT 314
+
+// Sentence output rates of PMTK314, in this order
+enum gnss_pmtk_output {
+    GNSS_PMTK_OUTPUT_GLL,
+    GNSS_PMTK_OUTPUT_RMC,
+    GNSS_PMTK_OUTPUT_VTG,
+    GNSS_PMTK_OUTPUT_GGA,
+    GNSS_PMTK_OUTPUT_GSA,
+    GNSS_PMTK_OUTPUT_GSV,
+    GNSS_PMTK_OUTPUT_LENGTH = 19
+};
+
+// Flag of a PMTK001 acknowledgement
+enum gnss_pmtk_ack {
+    GNSS_PMTK_ACK_INVALID_COMMAND,
+    GNSS_PMTK_ACK_UNSUPPORTED_COMMAND,
+    GNSS_PMTK_ACK_FAILED,
+    GNSS_PMTK_ACK_SUCCEEDED
+};
+
+// Write "$PMTKccc,<args>*hh\r\n" into buffer, returns its length or 0 if it doesn't fit
+size_t gnss_pmtk_format(char *buffer, size_t size, uint16_t command, const char *args);
+// Returns true if the sentence is a PMTK001 acknowledgement
+bool gnss_pmtk_parse_ack(const struct gnss_nmea_sentence *sentence, uint16_t *command, enum gnss_pmtk_ack *ack);
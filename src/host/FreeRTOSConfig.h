@@ -0,0 +1,99 @@
+#ifndef FREERTOS_CONFIG_H_INCLUDED
+#define FREERTOS_CONFIG_H_INCLUDED
+
+/*-----------------------------------------------------------
+ * FreeRTOS configuration of the host build on the POSIX port.
+ *
+ * Mirrors src/FreeRTOSConfig.h where it matters to the application,
+ * the port specific parts follow the POSIX demo.
+ *----------------------------------------------------------*/
+
+#include <assert.h>
+
+// Board definitions reach the firmware through the RP2040 port headers, do the same here
+#include "pico.h"
+
+/* Scheduler Related */
+#define configUSE_PREEMPTION                    1
+#define configUSE_TICKLESS_IDLE                 0
+#define configUSE_IDLE_HOOK                     0
+#define configUSE_TICK_HOOK                     0
+#define configTICK_RATE_HZ                      ( ( TickType_t ) 1000 )
+// Replay time runs host_speedup times faster than real time, firmware delays and timeouts
+// are converted with these so the application sees drive time throughout
+extern uint32_t host_speedup;
+#define pdMS_TO_TICKS( xTimeInMs )       ( ( TickType_t ) ( ( ( uint64_t ) ( xTimeInMs ) * configTICK_RATE_HZ ) / ( 1000U * ( uint64_t ) host_speedup ) ) )
+#define pdTICKS_TO_MS( xTimeInTicks )    ( ( TickType_t ) ( ( ( uint64_t ) ( xTimeInTicks ) * 1000U * host_speedup ) / configTICK_RATE_HZ ) )
+#define configMAX_PRIORITIES                    32
+// The POSIX port is single core, trace.c keeps a ring per core
+#define configNUMBER_OF_CORES                   1
+// Each task runs on its own pthread on the task stack, which needs at least PTHREAD_STACK_MIN.
+// host_main.c checks it at startup rather than leaving a too small stack to the port.
+#define configMINIMAL_STACK_SIZE                ( configSTACK_DEPTH_TYPE ) 4096
+#define configUSE_16_BIT_TICKS                  0
+#define configIDLE_SHOULD_YIELD                 1
+
+/* Synchronization Related */
+#define configUSE_MUTEXES                       1
+#define configUSE_RECURSIVE_MUTEXES             1
+#define configUSE_COUNTING_SEMAPHORES           1
+#define configQUEUE_REGISTRY_SIZE               8
+#define configUSE_QUEUE_SETS                    1
+#define configUSE_TIME_SLICING                  1
+
+/* System */
+#define configSTACK_DEPTH_TYPE                  uint32_t
+#define configMESSAGE_BUFFER_LENGTH_TYPE        size_t
+
+/* Memory allocation related definitions. */
+#define configSUPPORT_STATIC_ALLOCATION         0
+#define configSUPPORT_DYNAMIC_ALLOCATION        1
+// Unused with heap_3, which allocates from the host heap
+#define configTOTAL_HEAP_SIZE                   (128*1024)
+
+/* Hook function related definitions. */
+#define configCHECK_FOR_STACK_OVERFLOW          0
+#define configUSE_MALLOC_FAILED_HOOK            0
+
+/* Run time and task stats gathering related definitions. */
+#define configGENERATE_RUN_TIME_STATS           0
+#define configUSE_TRACE_FACILITY                1
+#define configUSE_STATS_FORMATTING_FUNCTIONS    0
+
+/* Co-routine related definitions. */
+#define configUSE_CO_ROUTINES                   0
+#define configMAX_CO_ROUTINE_PRIORITIES         1
+
+/* Software timer related definitions. */
+#define configUSE_TIMERS                        1
+#define configTIMER_TASK_PRIORITY               ( configMAX_PRIORITIES - 1 )
+#define configTIMER_QUEUE_LENGTH                10
+#define configTIMER_TASK_STACK_DEPTH            configMINIMAL_STACK_SIZE
+
+/* Debugging */
+#define configASSERT(x)                         assert(x)
+
+/* Set the following definitions to 1 to include the API function, or zero
+to exclude the API function. */
+#define INCLUDE_vTaskPrioritySet                1
+#define INCLUDE_uxTaskPriorityGet               1
+#define INCLUDE_vTaskDelete                     1
+#define INCLUDE_vTaskSuspend                    1
+#define INCLUDE_vTaskDelayUntil                 1
+#define INCLUDE_vTaskDelay                      1
+#define INCLUDE_xTaskGetSchedulerState          1
+#define INCLUDE_xTaskGetCurrentTaskHandle       1
+#define INCLUDE_uxTaskGetStackHighWaterMark     1
+#define INCLUDE_xTaskGetIdleTaskHandle          1
+#define INCLUDE_eTaskGetState                   1
+#define INCLUDE_xTimerPendFunctionCall          1
+#define INCLUDE_xTaskAbortDelay                 1
+#define INCLUDE_xTaskGetHandle                  1
+#define INCLUDE_xTaskResumeFromISR              1
+#define INCLUDE_xQueueGetMutexHolder            1
+
+// The POSIX port is single core, core affinity has no meaning here
+#define xTaskCreateAffinitySet(task, name, stack_depth, params, priority, affinity_mask, created_task) \
+    xTaskCreate(task, name, stack_depth, params, priority, created_task)
+
+#endif /* FREERTOS_CONFIG_H_INCLUDED */
@@ -0,0 +1,47 @@
+#pragma once
+
+// Host side of the hardware shims, drives the firmware tasks with replayed input
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include <hardware/uart.h>
+#include <hardware/regs/addressmap.h>
+
+// The firmware main() is renamed to this by the host build
+int catchcam_main(void);
+
+// Replay time runs this many times faster than real time, see FreeRTOSConfig.h
+extern uint32_t host_speedup;
+
+// Write everything the I2S DMA sends to the speaker into a mono WAV file, the time it's stopped is left out
+void host_audio_record(const char *path);
+
+// Call the handler of an enabled interrupt, from task context
+void host_irq_raise(uint num);
+
+// True once the firmware installed and enabled the RX interrupt
+bool host_uart_rx_ready(uart_inst_t *uart);
+uint32_t host_uart_baudrate(uart_inst_t *uart);
+// Queue a received byte and raise the RX interrupt once the FIFO level is reached, drops it if the FIFO is full
+void host_uart_rx(uart_inst_t *uart, uint8_t byte);
+// The line went idle, raise the RX timeout interrupt if anything is left in the FIFO
+void host_uart_rx_idle(uart_inst_t *uart);
+
+// Simulated GNSS receiver, replays a recorded NMEA log as its fixes
+struct host_gnss_replay {
+    char *data;
+    size_t length;
+};
+void host_gnss_task(void *params);
+// Fastest fix rate the receiver accepts, to emulate older modules
+extern uint32_t host_gnss_min_fix_interval_ms;
+// Receiver time since the replay started
+uint32_t host_gnss_time_ms(void);
+// A byte the firmware sent to the receiver
+void host_gnss_tx(uart_inst_t *uart, uint8_t byte);
+
+// A full NMEA line was delivered to the UART, all warnings are timed from the last one
+void host_trace_nmea_line_received(void);
+void host_trace_report(void);
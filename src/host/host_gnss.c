@@ -0,0 +1,507 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "host.h"
+#include "gnss/gnss_nmea.h"
+#include "gnss/gnss_pmtk.h"
+
+// Simulated MTK receiver: replays a recorded 1 Hz log as its fixes and obeys the PMTK commands
+// the firmware sends, so baud rate, fix rate and sentence output behave like on the device
+
+// Power-on defaults of the receiver
+#define HOST_GNSS_DEFAULT_BAUD_RATE       9600
+#define HOST_GNSS_DEFAULT_FIX_INTERVAL_MS 1000
+#define HOST_GNSS_MIN_FIX_INTERVAL_MS     100
+#define HOST_GNSS_MAX_FIX_INTERVAL_MS     10000
+
+// Start bits, data bits and stop bits of one UART frame
+#define HOST_GNSS_UART_BITS_PER_BYTE 10
+// What the UART makes of bytes sent at the wrong baud rate
+#define HOST_GNSS_GARBLE_MASK 0x5a
+
+#define HOST_GNSS_REPLIES_SIZE 256
+#define HOST_GNSS_MAX_ARGS_LENGTH 64
+
+// Time the firmware gets to finish the last warnings after the replay ends
+#define HOST_GNSS_DRAIN_MS 10000
+
+struct host_gnss_line {
+    const char *data;
+    size_t length;
+};
+
+// The lines of one recorded fix
+struct host_gnss_epoch {
+    struct host_gnss_line *lines;
+    size_t lines_length;
+    bool rmc_valid;
+    struct gnss_nmea_sentence rmc;
+    struct gnss_nmea_rmc rmc_fix;
+    uint32_t time_of_day_ms;
+};
+
+struct host_gnss {
+    // Written by the GNSS task through uart_write_blocking(), guarded by a critical section
+    uint32_t baudrate;
+    uint32_t fix_interval_ms;
+    bool output_filtered;
+    bool outputs[GNSS_PMTK_OUTPUT_LENGTH];
+    char replies[HOST_GNSS_REPLIES_SIZE];
+    size_t replies_length;
+    struct gnss_nmea_tokenizer tokenizer;
+    TaskHandle_t task;
+};
+
+uint32_t host_gnss_min_fix_interval_ms = HOST_GNSS_MIN_FIX_INTERVAL_MS;
+static TickType_t host_gnss_start;
+
+static struct host_gnss host_gnss = {
+    .baudrate = HOST_GNSS_DEFAULT_BAUD_RATE,
+    .fix_interval_ms = HOST_GNSS_DEFAULT_FIX_INTERVAL_MS,
+};
+
+// Sentence types in PMTK314 order
+static const char *const host_gnss_output_names[] = { "GLL", "RMC", "VTG", "GGA", "GSA", "GSV" };
+
+static bool host_gnss_parse_uint(const char *field, size_t length, uint32_t *value)
+{
+    if (length == 0) {
+        return false;
+    }
+    char *end;
+    *value = (uint32_t)strtoul(field, &end, 10);
+    return end == field + length && field[0] >= '0' && field[0] <= '9';
+}
+
+// hhmmss or hhmmss.ss
+static bool host_gnss_parse_time(const char *field, size_t length, uint32_t *time_of_day_ms)
+{
+    if (length < 6) {
+        return false;
+    }
+    for (size_t i=0; i<6; i++) {
+        if (field[i] < '0' || field[i] > '9') {
+            return false;
+        }
+    }
+
+    const uint32_t hours = (uint32_t)((field[0] - '0') * 10 + field[1] - '0');
+    const uint32_t minutes = (uint32_t)((field[2] - '0') * 10 + field[3] - '0');
+    const uint32_t seconds = (uint32_t)((field[4] - '0') * 10 + field[5] - '0');
+    uint32_t ms = 0;
+    if (length >= 8 && field[6] == '.' && field[7] >= '0' && field[7] <= '9') {
+        ms = (uint32_t)(field[7] - '0') * 100;
+        if (length >= 9 && field[8] >= '0' && field[8] <= '9') {
+            ms += (uint32_t)(field[8] - '0') * 10;
+        }
+    }
+
+    *time_of_day_ms = ((hours * 60 + minutes) * 60 + seconds) * 1000 + ms;
+    return true;
+}
+
+// "$<body>*hh\r\n"
+static size_t host_gnss_format_sentence(char *buffer, size_t size, const char *body)
+{
+    uint8_t checksum = 0;
+    for (const char *ch = body; *ch != '\0'; ch++) {
+        checksum ^= (uint8_t)*ch;
+    }
+    int length = snprintf(buffer, size, "$%s*%02X\r\n", body, checksum);
+    assert(length > 0 && (size_t)length < size);
+    return (size_t)length;
+}
+
+static void host_gnss_queue_ack(uint16_t command, enum gnss_pmtk_ack ack)
+{
+    char args[HOST_GNSS_MAX_ARGS_LENGTH];
+    snprintf(args, sizeof(args), "%03u,%d", command, ack);
+
+    char *reply = &host_gnss.replies[host_gnss.replies_length];
+    size_t length = gnss_pmtk_format(reply, sizeof(host_gnss.replies) - host_gnss.replies_length, GNSS_PMTK_ACK, args);
+    // A receiver flooded with commands drops replies as well
+    host_gnss.replies_length += length;
+}
+
+static enum gnss_pmtk_ack host_gnss_set_output(const struct gnss_nmea_sentence *sentence)
+{
+    bool outputs[GNSS_PMTK_OUTPUT_LENGTH];
+
+    if (sentence->field_count != 1 + GNSS_PMTK_OUTPUT_LENGTH) {
+        return GNSS_PMTK_ACK_INVALID_COMMAND;
+    }
+    for (int i=0; i<GNSS_PMTK_OUTPUT_LENGTH; i++) {
+        size_t length;
+        uint32_t rate;
+        const char *field = gnss_nmea_field(sentence, 1 + i, &length);
+        if (host_gnss_parse_uint(field, length, &rate) == false || rate > 5) {
+            return GNSS_PMTK_ACK_INVALID_COMMAND;
+        }
+        // Every fix or every n-th, the difference doesn't matter here
+        outputs[i] = rate > 0;
+    }
+
+    memcpy(host_gnss.outputs, outputs, sizeof(outputs));
+    host_gnss.output_filtered = true;
+    return GNSS_PMTK_ACK_SUCCEEDED;
+}
+
+static void host_gnss_handle_command(const struct gnss_nmea_sentence *sentence)
+{
+    size_t length;
+    const char *field = gnss_nmea_field(sentence, 0, &length);
+    uint32_t command;
+    if (length != 7 || memcmp(field, "PMTK", 4) != 0 || host_gnss_parse_uint(&field[4], 3, &command) == false) {
+        return;
+    }
+
+    uint32_t value;
+    if (sentence->field_count > 1) {
+        field = gnss_nmea_field(sentence, 1, &length);
+    } else {
+        field = NULL;
+        length = 0;
+    }
+
+    switch (command) {
+        case GNSS_PMTK_SET_NMEA_BAUDRATE:
+            // Switches right away and doesn't acknowledge, like the real one
+            if (host_gnss_parse_uint(field, length, &value) && value >= 4800 && value <= 921600) {
+                host_gnss.baudrate = value;
+            }
+            break;
+        case GNSS_PMTK_SET_NMEA_UPDATERATE:
+            if (host_gnss_parse_uint(field, length, &value) == false) {
+                host_gnss_queue_ack((uint16_t)command, GNSS_PMTK_ACK_INVALID_COMMAND);
+            } else if (value < host_gnss_min_fix_interval_ms || value > HOST_GNSS_MAX_FIX_INTERVAL_MS) {
+                host_gnss_queue_ack((uint16_t)command, GNSS_PMTK_ACK_FAILED);
+            } else {
+                host_gnss.fix_interval_ms = value;
+                host_gnss_queue_ack((uint16_t)command, GNSS_PMTK_ACK_SUCCEEDED);
+            }
+            break;
+        case GNSS_PMTK_API_SET_NMEA_OUTPUT:
+            host_gnss_queue_ack((uint16_t)command, host_gnss_set_output(sentence));
+            break;
+        default:
+            host_gnss_queue_ack((uint16_t)command, GNSS_PMTK_ACK_UNSUPPORTED_COMMAND);
+    }
+
+    printf("host: receiver got PMTK%03u, now %u baud, %u ms fix interval\n",
+           (unsigned)command, (unsigned)host_gnss.baudrate, (unsigned)host_gnss.fix_interval_ms);
+}
+
+void host_gnss_tx(uart_inst_t *uart, uint8_t byte)
+{
+    if (uart != UART_NMEA_PMTK_ID) {
+        return;
+    }
+
+    bool reply_queued = false;
+    taskENTER_CRITICAL();
+    if (host_uart_baudrate(uart) != host_gnss.baudrate) {
+        // Framing errors on the receiver side, the command is lost
+        gnss_nmea_tokenizer_init(&host_gnss.tokenizer);
+    } else if (gnss_nmea_tokenizer_feed(&host_gnss.tokenizer, (char)byte)) {
+        const size_t replies_length = host_gnss.replies_length;
+        host_gnss_handle_command(&host_gnss.tokenizer.sentence);
+        reply_queued = host_gnss.replies_length != replies_length;
+    }
+    taskEXIT_CRITICAL();
+
+    if (reply_queued && host_gnss.task != NULL) {
+        xTaskNotifyGive(host_gnss.task);
+    }
+}
+
+static void host_gnss_send(const char *data, size_t length)
+{
+    const bool garbled = host_uart_baudrate(UART_NMEA_PMTK_ID) != host_gnss.baudrate;
+    for (size_t i=0; i<length; i++) {
+        host_uart_rx(UART_NMEA_PMTK_ID, garbled ? (uint8_t)(data[i] ^ HOST_GNSS_GARBLE_MASK) : (uint8_t)data[i]);
+    }
+}
+
+static void host_gnss_flush_replies(void)
+{
+    char replies[HOST_GNSS_REPLIES_SIZE];
+
+    taskENTER_CRITICAL();
+    const size_t length = host_gnss.replies_length;
+    memcpy(replies, host_gnss.replies, length);
+    host_gnss.replies_length = 0;
+    taskEXIT_CRITICAL();
+
+    if (length > 0) {
+        host_gnss_send(replies, length);
+        host_uart_rx_idle(UART_NMEA_PMTK_ID);
+    }
+}
+
+// Sleep until deadline, answering commands meanwhile
+static void host_gnss_wait_until(TickType_t deadline)
+{
+    TickType_t now;
+    while ((int32_t)(deadline - (now = xTaskGetTickCount())) > 0) {
+        ulTaskNotifyTake(pdTRUE, deadline - now);
+        host_gnss_flush_replies();
+    }
+    host_gnss_flush_replies();
+}
+
+static int host_gnss_output_of(const struct host_gnss_line *line)
+{
+    // $ttSSS,...
+    if (line->length < 6 || line->data[0] != '$') {
+        return -1;
+    }
+    for (int i=0; i<(int)(sizeof(host_gnss_output_names) / sizeof(host_gnss_output_names[0])); i++) {
+        if (memcmp(&line->data[3], host_gnss_output_names[i], 3) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+static bool host_gnss_output_enabled(int output)
+{
+    if (host_gnss.output_filtered == false) {
+        return true;
+    }
+    // Sentences PMTK314 doesn't know of are off once it was used
+    return output >= 0 && host_gnss.outputs[output];
+}
+
+// Returns how long the line takes on the wire
+static uint32_t host_gnss_send_line(const struct host_gnss_line *line)
+{
+    host_gnss_send(line->data, line->length);
+    host_trace_nmea_line_received();
+    return (uint32_t)line->length * HOST_GNSS_UART_BITS_PER_BYTE * 1000u / host_gnss.baudrate;
+}
+
+static size_t host_gnss_format_coord(char *buffer, size_t size, int32_t coord_e6, int degree_digits, char positive, char negative)
+{
+    const uint32_t abs_coord = coord_e6 < 0 ? -(uint32_t)coord_e6 : (uint32_t)coord_e6;
+    const uint32_t degrees = abs_coord / 1000000;
+    const uint32_t minutes_e4 = (uint32_t)((uint64_t)(abs_coord % 1000000) * 60 / 100);
+    int length = snprintf(buffer, size, "%0*u%02u.%04u,%c", degree_digits, (unsigned)degrees,
+                          (unsigned)(minutes_e4 / 10000), (unsigned)(minutes_e4 % 10000), coord_e6 < 0 ? negative : positive);
+    assert(length > 0 && (size_t)length < size);
+    return (size_t)length;
+}
+
+// RMC of a fix between two recorded ones, positions are interpolated and the rest is copied
+static void host_gnss_send_interpolated_rmc(const struct host_gnss_epoch *epoch, const struct host_gnss_epoch *next,
+                                            uint32_t offset_ms, uint32_t epoch_ms)
+{
+    int32_t lat = epoch->rmc_fix.lat_e6;
+    int32_t lon = epoch->rmc_fix.lon_e6;
+    if (next != NULL && next->rmc_valid) {
+        lat += (int32_t)((int64_t)(next->rmc_fix.lat_e6 - lat) * offset_ms / epoch_ms);
+        lon += (int32_t)((int64_t)(next->rmc_fix.lon_e6 - lon) * offset_ms / epoch_ms);
+    }
+
+    char body[GNSS_NMEA_MAX_SENTENCE_LENGTH + 1];
+    size_t body_length = 0;
+    for (uint8_t i=0; i<epoch->rmc.field_count; i++) {
+        size_t length;
+        const char *field = gnss_nmea_field(&epoch->rmc, i, &length);
+        if (i > 0) {
+            body[body_length++] = ',';
+        }
+
+        if (i == 1) {
+            const uint32_t time_ms = (epoch->time_of_day_ms + offset_ms) % (24 * 3600 * 1000);
+            body_length += (size_t)snprintf(&body[body_length], sizeof(body) - body_length, "%02u%02u%02u.%02u",
+                                            (unsigned)(time_ms / 3600000), (unsigned)(time_ms / 60000 % 60),
+                                            (unsigned)(time_ms / 1000 % 60), (unsigned)(time_ms % 1000 / 10));
+        } else if (i == 3) {
+            body_length += host_gnss_format_coord(&body[body_length], sizeof(body) - body_length, lat, 2, 'N', 'S');
+            i++;
+        } else if (i == 5) {
+            body_length += host_gnss_format_coord(&body[body_length], sizeof(body) - body_length, lon, 3, 'E', 'W');
+            i++;
+        } else {
+            assert(body_length + length < sizeof(body));
+            memcpy(&body[body_length], field, length);
+            body_length += length;
+        }
+    }
+    body[body_length] = '\0';
+
+    char sentence[GNSS_NMEA_MAX_SENTENCE_LENGTH + 8];
+    const struct host_gnss_line line = {
+        .data = sentence,
+        .length = host_gnss_format_sentence(sentence, sizeof(sentence), body),
+    };
+    host_gnss_send_line(&line);
+    host_uart_rx_idle(UART_NMEA_PMTK_ID);
+}
+
+static size_t host_gnss_split(struct host_gnss_replay *replay, struct host_gnss_line **lines)
+{
+    size_t lines_length = 0;
+    for (size_t i=0; i<replay->length; i++) {
+        lines_length += replay->data[i] == '\n';
+    }
+
+    *lines = malloc((lines_length + 1) * sizeof(**lines));
+    assert(*lines);
+
+    size_t count = 0;
+    size_t line_start = 0;
+    for (size_t i=0; i<replay->length; i++) {
+        if (replay->data[i] == '\n') {
+            (*lines)[count++] = (struct host_gnss_line){ &replay->data[line_start], i + 1 - line_start };
+            line_start = i + 1;
+        }
+    }
+    return count;
+}
+
+// Time field of an RMC or GGA line, false for the others
+static bool host_gnss_line_time(const struct host_gnss_line *line, const char **time, size_t *length)
+{
+    const int output = host_gnss_output_of(line);
+    if (output != GNSS_PMTK_OUTPUT_RMC && output != GNSS_PMTK_OUTPUT_GGA) {
+        return false;
+    }
+    // $ttSSS,hhmmss.ss,...
+    if (line->length < 7 || line->data[6] != ',') {
+        return false;
+    }
+    const char *end = memchr(&line->data[7], ',', line->length - 7);
+    if (end == NULL) {
+        return false;
+    }
+    *time = &line->data[7];
+    *length = (size_t)(end - *time);
+    return true;
+}
+
+static void host_gnss_parse_epoch_rmc(struct host_gnss_epoch *epoch, const struct host_gnss_line *line)
+{
+    struct gnss_nmea_tokenizer tokenizer;
+    gnss_nmea_tokenizer_init(&tokenizer);
+    for (size_t i=0; i<line->length; i++) {
+        if (gnss_nmea_tokenizer_feed(&tokenizer, line->data[i])) {
+            size_t length;
+            const char *time = gnss_nmea_field(&tokenizer.sentence, 1, &length);
+            epoch->rmc = tokenizer.sentence;
+            epoch->rmc_valid = gnss_nmea_parse_rmc(&epoch->rmc, &epoch->rmc_fix) &&
+                               host_gnss_parse_time(time, length, &epoch->time_of_day_ms);
+        }
+    }
+}
+
+// An epoch starts with the first line carrying a new time, lines without one stay with the epoch before
+static size_t host_gnss_split_epochs(struct host_gnss_line *lines, size_t lines_length, struct host_gnss_epoch **epochs)
+{
+    *epochs = calloc(lines_length + 1, sizeof(**epochs));
+    assert(*epochs);
+
+    size_t count = 0;
+    const char *epoch_time = NULL;
+    size_t epoch_time_length = 0;
+    for (size_t i=0; i<lines_length; i++) {
+        const char *time;
+        size_t time_length;
+        const bool has_time = host_gnss_line_time(&lines[i], &time, &time_length);
+        const bool new_time = has_time && (epoch_time == NULL || time_length != epoch_time_length || memcmp(time, epoch_time, time_length) != 0);
+
+        if (count == 0 || new_time) {
+            (*epochs)[count++] = (struct host_gnss_epoch){ .lines = &lines[i] };
+        }
+        if (has_time) {
+            epoch_time = time;
+            epoch_time_length = time_length;
+        }
+
+        struct host_gnss_epoch *epoch = &(*epochs)[count - 1];
+        epoch->lines_length++;
+        if (host_gnss_output_of(&lines[i]) == GNSS_PMTK_OUTPUT_RMC) {
+            host_gnss_parse_epoch_rmc(epoch, &lines[i]);
+        }
+    }
+    return count;
+}
+
+static uint32_t host_gnss_epoch_ms(const struct host_gnss_epoch *epoch, const struct host_gnss_epoch *next)
+{
+    // The log is expected at 1 Hz, the timestamps tell if it isn't
+    if (next == NULL || epoch->rmc_valid == false || next->rmc_valid == false) {
+        return HOST_GNSS_DEFAULT_FIX_INTERVAL_MS;
+    }
+    const uint32_t day_ms = 24 * 3600 * 1000;
+    const uint32_t epoch_ms = (next->time_of_day_ms + day_ms - epoch->time_of_day_ms) % day_ms;
+    return epoch_ms > 0 && epoch_ms <= HOST_GNSS_MAX_FIX_INTERVAL_MS ? epoch_ms : HOST_GNSS_DEFAULT_FIX_INTERVAL_MS;
+}
+
+uint32_t host_gnss_time_ms(void)
+{
+    if (host_gnss_start == 0) {
+        return 0;
+    }
+    return pdTICKS_TO_MS(xTaskGetTickCount() - host_gnss_start);
+}
+
+void host_gnss_task(void *params)
+{
+    assert(params);
+    struct host_gnss_replay *replay = (struct host_gnss_replay *)params;
+
+    host_gnss.task = xTaskGetCurrentTaskHandle();
+    gnss_nmea_tokenizer_init(&host_gnss.tokenizer);
+
+    struct host_gnss_line *lines;
+    struct host_gnss_epoch *epochs;
+    const size_t lines_length = host_gnss_split(replay, &lines);
+    const size_t epochs_length = host_gnss_split_epochs(lines, lines_length, &epochs);
+
+    // Bytes sent before the GNSS task is listening are lost on the device too, don't replay into the void
+    while (host_uart_rx_ready(UART_NMEA_PMTK_ID) == false) {
+        vTaskDelay(1);
+    }
+
+    // Fixes are scheduled on receiver time, sentence transmission doesn't make the replay drift
+    const TickType_t start = xTaskGetTickCount();
+    host_gnss_start = start;
+    uint64_t receiver_time_ms = 0;
+    for (size_t i=0; i<epochs_length; i++) {
+        const struct host_gnss_epoch *epoch = &epochs[i];
+        const struct host_gnss_epoch *next = i + 1 < epochs_length ? &epochs[i + 1] : NULL;
+        const uint32_t epoch_ms = host_gnss_epoch_ms(epoch, next);
+
+        // The recorded fix first, then the receiver's own ones in between at its fix rate
+        for (uint32_t offset_ms = 0; offset_ms < epoch_ms; offset_ms += host_gnss.fix_interval_ms) {
+            host_gnss_wait_until(start + pdMS_TO_TICKS(receiver_time_ms + offset_ms));
+
+            if (offset_ms == 0) {
+                // The sentences of an epoch go out back to back, then the line is idle until the next one.
+                // The burst arrives at once and the receiver stays quiet for as long as it took on the wire.
+                const TickType_t now = xTaskGetTickCount();
+                uint32_t burst_ms = 0;
+                for (size_t j=0; j<epoch->lines_length; j++) {
+                    if (host_gnss_output_enabled(host_gnss_output_of(&epoch->lines[j]))) {
+                        burst_ms += host_gnss_send_line(&epoch->lines[j]);
+                    }
+                }
+                host_uart_rx_idle(UART_NMEA_PMTK_ID);
+                host_gnss_wait_until(now + pdMS_TO_TICKS(burst_ms));
+            } else if (epoch->rmc_valid && host_gnss_output_enabled(GNSS_PMTK_OUTPUT_RMC)) {
+                host_gnss_send_interpolated_rmc(epoch, next, offset_ms, epoch_ms);
+            }
+        }
+        receiver_time_ms += epoch_ms;
+    }
+
+    host_gnss_wait_until(start + pdMS_TO_TICKS(receiver_time_ms + HOST_GNSS_DRAIN_MS));
+    host_trace_report();
+    exit(EXIT_SUCCESS);
+}
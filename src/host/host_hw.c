@@ -0,0 +1,579 @@
+#include <assert.h>
+#include <inttypes.h>
+#include <stdarg.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+#include <pico/stdlib.h>
+#include <hardware/gpio.h>
+#include <hardware/uart.h>
+#include <hardware/irq.h>
+#include <hardware/clocks.h>
+#include <hardware/pio.h>
+#include <hardware/dma.h>
+#include <hardware/sync.h>
+#include <i2s_lsbj.pio.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+#include <timers.h>
+
+#include "host.h"
+
+#define HOST_GPIO_COUNT    30
+#define HOST_IRQ_COUNT     32
+#define HOST_PIO_SM_COUNT  4
+#define HOST_CLK_SYS_HZ    125000000u
+
+struct host_dma_channel {
+    bool claimed;
+    bool irq0_enabled;
+    bool irq0_status;
+    bool busy;
+    dma_channel_config config;
+    const volatile void *read_addr;
+    uint transfer_count;
+    TimerHandle_t done_timer;
+};
+
+uint8_t host_flash[PICO_FLASH_SIZE_BYTES];
+uart_inst_t host_uart_instances[2];
+pio_hw_t host_pio_instances[2];
+const pio_program_t pio_lsbj_out_program = { NULL, 0, -1 };
+uint32_t host_speedup = 1;
+
+static bool host_gpio_values[HOST_GPIO_COUNT];
+static irq_handler_t host_irq_handlers[HOST_IRQ_COUNT];
+static bool host_irq_enabled[HOST_IRQ_COUNT];
+static float host_pio_clkdiv[2][HOST_PIO_SM_COUNT];
+static uint host_pio_cycles_per_word[2][HOST_PIO_SM_COUNT];
+static struct host_dma_channel host_dma_channels[NUM_DMA_CHANNELS];
+static FILE *host_wav_file;
+static uint32_t host_wav_sample_rate;
+static uint32_t host_wav_samples;
+
+void sleep_ms(uint32_t ms)
+{
+    vTaskDelay(pdMS_TO_TICKS(ms));
+}
+
+int host_printf(const char *format, ...)
+{
+    // No tick while the stdout lock is held, before the scheduler runs there is nothing to keep out
+    const bool scheduler_running = xTaskGetSchedulerState() == taskSCHEDULER_RUNNING;
+    if (scheduler_running) {
+        taskENTER_CRITICAL();
+    }
+
+    va_list args;
+    va_start(args, format);
+    const int ret = vprintf(format, args);
+    va_end(args);
+
+    if (scheduler_running) {
+        taskEXIT_CRITICAL();
+    }
+    return ret;
+}
+
+uint64_t time_us_64(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000u + (uint64_t)ts.tv_nsec / 1000u;
+}
+
+uint32_t time_us_32(void)
+{
+    return (uint32_t)time_us_64();
+}
+
+bool stdio_init_all(void)
+{
+    // Keep the firmware output in order with the host reports
+    setvbuf(stdout, NULL, _IOLBF, 0);
+    return true;
+}
+
+int getchar_timeout_us(uint32_t timeout_us)
+{
+    (void)timeout_us;
+    return PICO_ERROR_TIMEOUT;
+}
+
+uint get_core_num(void)
+{
+    return 0;
+}
+
+uint32_t save_and_disable_interrupts(void)
+{
+    taskENTER_CRITICAL();
+    return 0;
+}
+
+void restore_interrupts(uint32_t status)
+{
+    (void)status;
+    taskEXIT_CRITICAL();
+}
+
+void gpio_init(uint gpio)
+{
+    assert(gpio < HOST_GPIO_COUNT);
+    host_gpio_values[gpio] = false;
+}
+
+void gpio_set_dir(uint gpio, bool out)
+{
+    assert(gpio < HOST_GPIO_COUNT);
+    (void)out;
+}
+
+void gpio_put(uint gpio, bool value)
+{
+    assert(gpio < HOST_GPIO_COUNT);
+    host_gpio_values[gpio] = value;
+}
+
+bool gpio_get(uint gpio)
+{
+    assert(gpio < HOST_GPIO_COUNT);
+    return host_gpio_values[gpio];
+}
+
+void gpio_set_function(uint gpio, enum gpio_function fn)
+{
+    assert(gpio < HOST_GPIO_COUNT);
+    (void)fn;
+}
+
+void irq_set_exclusive_handler(uint num, irq_handler_t handler)
+{
+    assert(num < HOST_IRQ_COUNT);
+    assert(host_irq_handlers[num] == NULL);
+    host_irq_handlers[num] = handler;
+}
+
+void irq_set_enabled(uint num, bool enabled)
+{
+    assert(num < HOST_IRQ_COUNT);
+    host_irq_enabled[num] = enabled;
+}
+
+void host_irq_raise(uint num)
+{
+    assert(num < HOST_IRQ_COUNT);
+    if (host_irq_enabled[num] && host_irq_handlers[num] != NULL) {
+        // Handlers run on the raising task, keep the tick from switching to another task halfway
+        // through like it can't on the device. A yield at their end still switches right away.
+        taskENTER_CRITICAL();
+        host_irq_handlers[num]();
+        taskEXIT_CRITICAL();
+    }
+}
+
+static uint host_uart_irq(uart_inst_t *uart)
+{
+    return uart == uart0 ? UART0_IRQ : UART1_IRQ;
+}
+
+uint uart_init(uart_inst_t *uart, uint baudrate)
+{
+    uart->baudrate = baudrate;
+    uart->fifo_enabled = false;
+    uart->rx_fifo_head = 0;
+    uart->rx_fifo_length = 0;
+    return baudrate;
+}
+
+uint uart_set_baudrate(uart_inst_t *uart, uint baudrate)
+{
+    uart->baudrate = baudrate;
+    return baudrate;
+}
+
+void uart_set_hw_flow(uart_inst_t *uart, bool cts, bool rts)
+{
+    (void)uart;
+    (void)cts;
+    (void)rts;
+}
+
+void uart_set_format(uart_inst_t *uart, uint data_bits, uint stop_bits, uart_parity_t parity)
+{
+    (void)uart;
+    (void)data_bits;
+    (void)stop_bits;
+    (void)parity;
+}
+
+void uart_set_fifo_enabled(uart_inst_t *uart, bool enabled)
+{
+    uart->fifo_enabled = enabled;
+}
+
+void uart_set_irq_enables(uart_inst_t *uart, bool rx_has_data, bool tx_needs_data)
+{
+    (void)tx_needs_data;
+    uart->rx_irq_enabled = rx_has_data;
+    // Like the SDK, start from the lowest RX FIFO level
+    if (rx_has_data) {
+        hw_write_masked(&uart->hw.ifls, 0, UART_UARTIFLS_RXIFLSEL_BITS);
+    }
+}
+
+bool uart_is_readable(uart_inst_t *uart)
+{
+    return uart->rx_fifo_length > 0;
+}
+
+char uart_getc(uart_inst_t *uart)
+{
+    assert(uart->rx_fifo_length > 0);
+    const uint8_t byte = uart->rx_fifo[uart->rx_fifo_head];
+    uart->rx_fifo_head = (uart->rx_fifo_head + 1) % UART_FIFO_DEPTH;
+    uart->rx_fifo_length--;
+    return (char)byte;
+}
+
+void uart_write_blocking(uart_inst_t *uart, const uint8_t *src, size_t len)
+{
+    for (size_t i=0; i<len; i++) {
+        host_gnss_tx(uart, src[i]);
+    }
+}
+
+void uart_tx_wait_blocking(uart_inst_t *uart)
+{
+    // Sent bytes are handed over right away
+    (void)uart;
+}
+
+bool host_uart_rx_ready(uart_inst_t *uart)
+{
+    const uint irq = host_uart_irq(uart);
+    return uart->rx_irq_enabled && host_irq_enabled[irq] && host_irq_handlers[irq] != NULL;
+}
+
+uint32_t host_uart_baudrate(uart_inst_t *uart)
+{
+    return uart->baudrate;
+}
+
+// Bytes in the FIFO that raise the RX interrupt, 1/8, 1/4, 1/2, 3/4 or 7/8 of it
+static uint32_t host_uart_rx_level(uart_inst_t *uart)
+{
+    static const uint32_t levels[] = { 4, 8, 16, 24, 28 };
+    if (uart->fifo_enabled == false) {
+        return 1;
+    }
+
+    const uint32_t rxiflsel = (uart->hw.ifls & UART_UARTIFLS_RXIFLSEL_BITS) >> UART_UARTIFLS_RXIFLSEL_LSB;
+    assert(rxiflsel < sizeof(levels) / sizeof(levels[0]));
+    return levels[rxiflsel];
+}
+
+void host_uart_rx(uart_inst_t *uart, uint8_t byte)
+{
+    const uint32_t depth = uart->fifo_enabled ? UART_FIFO_DEPTH : 1;
+    if (uart->rx_fifo_length == depth) {
+        // Overrun, the new byte is lost
+        return;
+    }
+
+    uart->rx_fifo[(uart->rx_fifo_head + uart->rx_fifo_length) % UART_FIFO_DEPTH] = byte;
+    uart->rx_fifo_length++;
+    if (uart->rx_irq_enabled && uart->rx_fifo_length >= host_uart_rx_level(uart)) {
+        host_irq_raise(host_uart_irq(uart));
+    }
+}
+
+void host_uart_rx_idle(uart_inst_t *uart)
+{
+    if (uart->rx_irq_enabled && uart->rx_fifo_length > 0) {
+        host_irq_raise(host_uart_irq(uart));
+    }
+}
+
+uint32_t clock_get_hz(enum clock_index clk_index)
+{
+    assert(clk_index == clk_sys);
+    return HOST_CLK_SYS_HZ;
+}
+
+static uint host_pio_index(PIO pio)
+{
+    return pio == pio0 ? 0 : 1;
+}
+
+uint pio_add_program(PIO pio, const pio_program_t *program)
+{
+    (void)pio;
+    (void)program;
+    return 0;
+}
+
+void pio_sm_set_clkdiv(PIO pio, uint sm, float div)
+{
+    assert(sm < HOST_PIO_SM_COUNT);
+    host_pio_clkdiv[host_pio_index(pio)][sm] = div;
+}
+
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled)
+{
+    (void)pio;
+    (void)sm;
+    (void)enabled;
+}
+
+uint pio_get_dreq(PIO pio, uint sm, bool is_tx)
+{
+    assert(sm < HOST_PIO_SM_COUNT);
+    assert(is_tx);
+    // DREQ_PIO0_TX0 is 0 and DREQ_PIO1_TX0 is 8 on the RP2040
+    return host_pio_index(pio) * 8 + sm;
+}
+
+void host_pio_set_cycles_per_word(PIO pio, uint sm, uint cycles)
+{
+    assert(sm < HOST_PIO_SM_COUNT);
+    host_pio_cycles_per_word[host_pio_index(pio)][sm] = cycles;
+}
+
+// Rate the state machine behind a PIO DREQ takes words at
+static float host_dreq_words_per_second(uint dreq)
+{
+    const uint pio_index = dreq / 8;
+    const uint sm = dreq % 8;
+    assert(pio_index < 2 && sm < HOST_PIO_SM_COUNT);
+    const float clkdiv = host_pio_clkdiv[pio_index][sm];
+    const uint cycles_per_word = host_pio_cycles_per_word[pio_index][sm];
+    assert(clkdiv > 0.0f && cycles_per_word > 0);
+
+    return clock_get_hz(clk_sys) / clkdiv / cycles_per_word;
+}
+
+// How long the state machine behind a DREQ needs to take transfer_count words
+static uint32_t host_dreq_duration_ms(uint dreq, uint transfer_count)
+{
+    if (dreq == DREQ_FORCE) {
+        return 0;
+    }
+
+    return (uint32_t)(transfer_count * 1000.0f / host_dreq_words_per_second(dreq));
+}
+
+static void host_wav_write_u32(uint32_t value)
+{
+    const uint8_t bytes[4] = { value, value >> 8, value >> 16, value >> 24 };
+    fwrite(bytes, 1, sizeof(bytes), host_wav_file);
+}
+
+static void host_wav_write_header(void)
+{
+    const uint32_t data_size = host_wav_samples * sizeof(int16_t);
+    fseek(host_wav_file, 0, SEEK_SET);
+    fwrite("RIFF", 1, 4, host_wav_file);
+    host_wav_write_u32(36 + data_size);
+    fwrite("WAVEfmt ", 1, 8, host_wav_file);
+    host_wav_write_u32(16);
+    // PCM, mono
+    host_wav_write_u32(1 | (1u << 16));
+    host_wav_write_u32(host_wav_sample_rate);
+    host_wav_write_u32(host_wav_sample_rate * sizeof(int16_t));
+    // Block align and bits per sample
+    host_wav_write_u32(sizeof(int16_t) | (16u << 16));
+    fwrite("data", 1, 4, host_wav_file);
+    host_wav_write_u32(data_size);
+}
+
+static void host_wav_close(void)
+{
+    host_wav_write_header();
+    fclose(host_wav_file);
+    printf("Host audio: %" PRIu32 " samples at %" PRIu32 " Hz recorded\n", host_wav_samples, host_wav_sample_rate);
+}
+
+void host_audio_record(const char *path)
+{
+    host_wav_file = fopen(path, "wb");
+    if (host_wav_file == NULL) {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+    // Rewritten with the sizes on exit
+    host_wav_write_header();
+    atexit(host_wav_close);
+}
+
+// A transfer to the I2S state machine is what the speaker would play
+static void host_wav_record(const struct host_dma_channel *dma_channel)
+{
+    if (host_wav_file == NULL || dma_channel->config.dreq == DREQ_FORCE || dma_channel->config.data_size != DMA_SIZE_16) {
+        return;
+    }
+
+    host_wav_sample_rate = (uint32_t)(host_dreq_words_per_second(dma_channel->config.dreq) + 0.5f);
+    // Like host_printf(), the file lock must not be held by a preempted task when exit() closes it
+    taskENTER_CRITICAL();
+    fwrite((const void *)dma_channel->read_addr, sizeof(int16_t), dma_channel->transfer_count, host_wav_file);
+    taskEXIT_CRITICAL();
+    host_wav_samples += dma_channel->transfer_count;
+}
+
+// The completion interrupt fires from the timer task once the transfer would have finished
+static void host_dma_trigger(uint channel, TickType_t ticks_to_wait)
+{
+    struct host_dma_channel *dma_channel = &host_dma_channels[channel];
+    host_wav_record(dma_channel);
+    TickType_t ticks = pdMS_TO_TICKS(host_dreq_duration_ms(dma_channel->config.dreq, dma_channel->transfer_count));
+    if (ticks == 0) {
+        ticks = 1;
+    }
+
+    dma_channel->busy = true;
+    BaseType_t ret = xTimerChangePeriod(dma_channel->done_timer, ticks, ticks_to_wait);
+    assert(ret == pdPASS);
+}
+
+static void host_dma_on_done(TimerHandle_t timer)
+{
+    const uint channel = (uint)(uintptr_t)pvTimerGetTimerID(timer);
+    struct host_dma_channel *dma_channel = &host_dma_channels[channel];
+    dma_channel->busy = false;
+
+    // Like the hardware the chained channel starts before the interrupt is handled, a channel chained to itself ends the chain
+    const uint chain_to = dma_channel->config.chain_to;
+    if (chain_to != channel) {
+        assert(chain_to < NUM_DMA_CHANNELS && host_dma_channels[chain_to].claimed);
+        // The timer task can't wait on its own command queue
+        host_dma_trigger(chain_to, 0);
+    }
+
+    if (dma_channel->irq0_enabled) {
+        dma_channel->irq0_status = true;
+        host_irq_raise(DMA_IRQ_0);
+    }
+}
+
+int dma_claim_unused_channel(bool required)
+{
+    for (uint channel=0; channel<NUM_DMA_CHANNELS; channel++) {
+        struct host_dma_channel *dma_channel = &host_dma_channels[channel];
+        if (dma_channel->claimed) {
+            continue;
+        }
+
+        dma_channel->done_timer = xTimerCreate("HostDma", 1, pdFALSE, (void *)(uintptr_t)channel, host_dma_on_done);
+        assert(dma_channel->done_timer);
+        dma_channel->claimed = true;
+        return (int)channel;
+    }
+
+    assert(!required);
+    return -1;
+}
+
+dma_channel_config dma_channel_get_default_config(uint channel)
+{
+    dma_channel_config config = {
+        .data_size = DMA_SIZE_32,
+        .read_increment = true,
+        .write_increment = false,
+        .dreq = DREQ_FORCE,
+        .chain_to = channel,
+    };
+    return config;
+}
+
+void channel_config_set_transfer_data_size(dma_channel_config *c, enum dma_channel_transfer_size size)
+{
+    c->data_size = size;
+}
+
+void channel_config_set_read_increment(dma_channel_config *c, bool incr)
+{
+    c->read_increment = incr;
+}
+
+void channel_config_set_write_increment(dma_channel_config *c, bool incr)
+{
+    c->write_increment = incr;
+}
+
+void channel_config_set_dreq(dma_channel_config *c, uint dreq)
+{
+    c->dreq = dreq;
+}
+
+void channel_config_set_chain_to(dma_channel_config *c, uint chain_to)
+{
+    c->chain_to = chain_to;
+}
+
+void dma_channel_configure(uint channel, const dma_channel_config *config, volatile void *write_addr,
+                           const volatile void *read_addr, uint transfer_count, bool trigger)
+{
+    assert(channel < NUM_DMA_CHANNELS);
+    struct host_dma_channel *dma_channel = &host_dma_channels[channel];
+    assert(dma_channel->claimed);
+    (void)write_addr;
+
+    dma_channel->config = *config;
+    dma_channel->read_addr = read_addr;
+    dma_channel->transfer_count = transfer_count;
+    if (trigger) {
+        host_dma_trigger(channel, portMAX_DELAY);
+    }
+}
+
+void dma_channel_set_read_addr(uint channel, const volatile void *read_addr, bool trigger)
+{
+    assert(channel < NUM_DMA_CHANNELS);
+    host_dma_channels[channel].read_addr = read_addr;
+    if (trigger) {
+        host_dma_trigger(channel, portMAX_DELAY);
+    }
+}
+
+void dma_channel_start(uint channel)
+{
+    assert(channel < NUM_DMA_CHANNELS);
+    assert(host_dma_channels[channel].claimed);
+    host_dma_trigger(channel, portMAX_DELAY);
+}
+
+bool dma_channel_is_busy(uint channel)
+{
+    assert(channel < NUM_DMA_CHANNELS);
+    return host_dma_channels[channel].busy;
+}
+
+void dma_channel_abort(uint channel)
+{
+    assert(channel < NUM_DMA_CHANNELS);
+    struct host_dma_channel *dma_channel = &host_dma_channels[channel];
+    BaseType_t ret = xTimerStop(dma_channel->done_timer, portMAX_DELAY);
+    assert(ret == pdPASS);
+    dma_channel->busy = false;
+}
+
+void dma_channel_set_irq0_enabled(uint channel, bool enabled)
+{
+    assert(channel < NUM_DMA_CHANNELS);
+    host_dma_channels[channel].irq0_enabled = enabled;
+}
+
+void dma_channel_acknowledge_irq0(uint channel)
+{
+    assert(channel < NUM_DMA_CHANNELS);
+    host_dma_channels[channel].irq0_status = false;
+}
+
+bool dma_channel_get_irq0_status(uint channel)
+{
+    assert(channel < NUM_DMA_CHANNELS);
+    return host_dma_channels[channel].irq0_status;
+}
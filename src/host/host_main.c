@@ -0,0 +1,113 @@
+#include <assert.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+#include "host.h"
+
+#define HOST_GNSS_TASK_PRIORITY   (configMAX_PRIORITIES - 1)
+#define HOST_GNSS_TASK_STACK_SIZE configMINIMAL_STACK_SIZE
+
+static void host_usage(const char *program)
+{
+    fprintf(stderr, "usage: %s [-s speedup] [-d cams_db.bin] [-r max_fix_rate_hz] [-w audio.wav] nmea_replay_file\n", program);
+    exit(EXIT_FAILURE);
+}
+
+static char *host_read_file(const char *path, size_t *length)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+
+    fseek(file, 0, SEEK_END);
+    long size = ftell(file);
+    fseek(file, 0, SEEK_SET);
+    assert(size >= 0);
+
+    char *data = malloc((size_t)size + 1);
+    assert(data);
+    if (fread(data, 1, (size_t)size, file) != (size_t)size) {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+    fclose(file);
+
+    *length = (size_t)size;
+    return data;
+}
+
+static void host_load_camera_db(const char *path)
+{
+    size_t length;
+    char *data = host_read_file(path, &length);
+    if (length > CAMS_DB_SLOT_SIZE) {
+        fprintf(stderr, "%s: doesn't fit into a database slot\n", path);
+        exit(EXIT_FAILURE);
+    }
+
+    // The firmware picks whichever slot is valid
+    memcpy(&host_flash[CAMS_DB_FLASH_OFFSET], data, length);
+    free(data);
+}
+
+int main(int argc, char **argv)
+{
+    // Task stacks are the stacks of their pthreads, the smallest one must be enough for one
+    const long stack_min = sysconf(_SC_THREAD_STACK_MIN);
+    if (stack_min > 0 && configMINIMAL_STACK_SIZE * sizeof(StackType_t) < (size_t)stack_min) {
+        fprintf(stderr, "configMINIMAL_STACK_SIZE is below the %ld bytes of PTHREAD_STACK_MIN\n", stack_min);
+        return EXIT_FAILURE;
+    }
+
+    const char *camera_db_path = NULL;
+    int opt;
+    while ((opt = getopt(argc, argv, "s:d:r:w:")) != -1) {
+        switch (opt) {
+            case 's':
+                host_speedup = (uint32_t)strtoul(optarg, NULL, 10);
+                if (host_speedup == 0) {
+                    host_usage(argv[0]);
+                }
+                break;
+            case 'r': {
+                const uint32_t max_fix_rate_hz = (uint32_t)strtoul(optarg, NULL, 10);
+                if (max_fix_rate_hz == 0) {
+                    host_usage(argv[0]);
+                }
+                host_gnss_min_fix_interval_ms = 1000u / max_fix_rate_hz;
+                break;
+            }
+            case 'd':
+                camera_db_path = optarg;
+                break;
+            case 'w':
+                host_audio_record(optarg);
+                break;
+            default:
+                host_usage(argv[0]);
+        }
+    }
+    if (optind + 1 != argc) {
+        host_usage(argv[0]);
+    }
+
+    if (camera_db_path != NULL) {
+        host_load_camera_db(camera_db_path);
+    }
+
+    static struct host_gnss_replay replay;
+    replay.data = host_read_file(argv[optind], &replay.length);
+
+    BaseType_t ret = xTaskCreate(host_gnss_task, "HostGnssThread", HOST_GNSS_TASK_STACK_SIZE, &replay, HOST_GNSS_TASK_PRIORITY, NULL);
+    assert(ret == pdPASS);
+
+    // Never returns, the simulated receiver exits once the replay is consumed
+    return catchcam_main();
+}
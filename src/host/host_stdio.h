@@ -0,0 +1,9 @@
+#pragma once
+
+// Included ahead of every source of catchcam_host. The POSIX port preempts a task wherever its
+// thread is, also inside printf() holding the stdout lock. The next task to print then blocks on
+// that lock without FreeRTOS knowing, forever if it has the higher priority.
+#include <stdio.h>
+
+int host_printf(const char *format, ...) __attribute__((format(printf, 1, 2)));
+#define printf(...) host_printf(__VA_ARGS__)
@@ -0,0 +1,110 @@
+#include <assert.h>
+#include <inttypes.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <pico/stdlib.h>
+
+#include "cams/cams.h"
+#include "host.h"
+#include "trace/trace.h"
+
+// Enough for a few hours of 1 Hz fixes, later samples only update the counters
+#define HOST_TRACE_MAX_SAMPLES 16384
+
+struct host_trace_stat {
+    const char *name;
+    uint32_t samples[HOST_TRACE_MAX_SAMPLES];
+    uint32_t length;
+    uint32_t count;
+};
+
+// Every hook runs on a FreeRTOS task, which the POSIX port runs one at a time
+static uint32_t host_trace_line_time_us;
+static uint32_t host_trace_fix_time_us;
+static bool host_trace_fix_pending;
+static uint32_t host_trace_fix_count;
+
+static struct host_trace_stat host_trace_rx_to_fix = { .name = "NMEA line -> main task" };
+static struct host_trace_stat host_trace_fix_processing = { .name = "fix processing" };
+static struct host_trace_stat host_trace_rx_to_warning = { .name = "NMEA line -> warning enqueued" };
+
+static void host_trace_add(struct host_trace_stat *stat, uint32_t value_us)
+{
+    if (stat->length < HOST_TRACE_MAX_SAMPLES) {
+        stat->samples[stat->length++] = value_us;
+    }
+    stat->count++;
+}
+
+static int host_trace_compare(const void *a, const void *b)
+{
+    const uint32_t lhs = *(const uint32_t *)a;
+    const uint32_t rhs = *(const uint32_t *)b;
+    return (lhs > rhs) - (lhs < rhs);
+}
+
+static void host_trace_print(struct host_trace_stat *stat)
+{
+    if (stat->length == 0) {
+        printf("host: %-30s no samples\n", stat->name);
+        return;
+    }
+
+    qsort(stat->samples, stat->length, sizeof(stat->samples[0]), host_trace_compare);
+    uint64_t sum = 0;
+    for (uint32_t i=0; i<stat->length; i++) {
+        sum += stat->samples[i];
+    }
+
+    printf("host: %-30s n=%" PRIu32 " min=%" PRIu32 " us median=%" PRIu32 " us p99=%" PRIu32 " us max=%" PRIu32 " us mean=%" PRIu64 " us\n",
+           stat->name, stat->count, stat->samples[0], stat->samples[stat->length / 2],
+           stat->samples[(uint64_t)stat->length * 99 / 100], stat->samples[stat->length - 1], sum / stat->length);
+}
+
+void host_trace_nmea_line_received(void)
+{
+    host_trace_line_time_us = time_us_32();
+}
+
+void trace_fix_received(void)
+{
+    host_trace_fix_time_us = time_us_32();
+    host_trace_fix_pending = true;
+    host_trace_add(&host_trace_rx_to_fix, host_trace_fix_time_us - host_trace_line_time_us);
+}
+
+void trace_fix_done(void)
+{
+    // The first wait of the main task has no fix before it
+    if (host_trace_fix_pending == false) {
+        return;
+    }
+    host_trace_fix_pending = false;
+
+    const uint32_t processing_us = time_us_32() - host_trace_fix_time_us;
+    host_trace_add(&host_trace_fix_processing, processing_us);
+    printf("host: fix %" PRIu32 " processed in %" PRIu32 " us\n", host_trace_fix_count++, processing_us);
+}
+
+void trace_warning_enqueued(void)
+{
+    const uint32_t latency_us = time_us_32() - host_trace_line_time_us;
+    host_trace_add(&host_trace_rx_to_warning, latency_us);
+    // Predicted positions warn without a new line, the drive time shows how early
+    printf("host: warning enqueued %" PRIu32 " us after the last NMEA line, at drive time %" PRIu32 " ms\n",
+           latency_us, host_gnss_time_ms());
+}
+
+void host_trace_report(void)
+{
+    host_trace_print(&host_trace_rx_to_fix);
+    host_trace_print(&host_trace_fix_processing);
+    host_trace_print(&host_trace_rx_to_warning);
+
+    struct cams_cache_stats cams_cache_stats;
+    cams_get_cache_stats(&cams_cache_stats);
+    printf("host: camera cache hits=%" PRIu32 " refreshes=%" PRIu32 "\n", cams_cache_stats.hits, cams_cache_stats.refreshes);
+    // Stage histograms of the firmware's own latency trace
+    trace_report();
+}
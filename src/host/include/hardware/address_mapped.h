@@ -0,0 +1,9 @@
+#pragma once
+
+#include "pico.h"
+
+typedef volatile uint32_t io_rw_32;
+
+static inline void hw_write_masked(io_rw_32 *addr, uint32_t values, uint32_t write_mask) {
+    *addr = (*addr & ~write_mask) | (values & write_mask);
+}
@@ -0,0 +1,20 @@
+#pragma once
+
+#include "pico.h"
+
+#define GPIO_OUT true
+#define GPIO_IN  false
+
+enum gpio_function {
+    GPIO_FUNC_UART = 2,
+    GPIO_FUNC_PIO0 = 6,
+    GPIO_FUNC_SIO  = 5,
+};
+
+#define UART_FUNCSEL_NUM(uart, gpio) GPIO_FUNC_UART
+
+void gpio_init(uint gpio);
+void gpio_set_dir(uint gpio, bool out);
+void gpio_put(uint gpio, bool value);
+bool gpio_get(uint gpio);
+void gpio_set_function(uint gpio, enum gpio_function fn);
@@ -0,0 +1,14 @@
+#pragma once
+
+#include "pico.h"
+
+// RP2040 interrupt numbers
+#define DMA_IRQ_0 11
+#define DMA_IRQ_1 12
+#define UART0_IRQ 20
+#define UART1_IRQ 21
+
+typedef void (*irq_handler_t)(void);
+
+void irq_set_exclusive_handler(uint num, irq_handler_t handler);
+void irq_set_enabled(uint num, bool enabled);
@@ -0,0 +1,27 @@
+#pragma once
+
+#include "pico.h"
+
+typedef struct {
+    volatile uint32_t txf[4];
+} pio_hw_t;
+
+typedef pio_hw_t *PIO;
+
+extern pio_hw_t host_pio_instances[2];
+#define pio0 (&host_pio_instances[0])
+#define pio1 (&host_pio_instances[1])
+
+typedef struct pio_program {
+    const uint16_t *instructions;
+    uint8_t length;
+    int8_t origin;
+} pio_program_t;
+
+uint pio_add_program(PIO pio, const pio_program_t *program);
+void pio_sm_set_clkdiv(PIO pio, uint sm, float div);
+void pio_sm_set_enabled(PIO pio, uint sm, bool enabled);
+uint pio_get_dreq(PIO pio, uint sm, bool is_tx);
+
+// How many state machine cycles the loaded program spends on one TX FIFO word, paces the DMA
+void host_pio_set_cycles_per_word(PIO pio, uint sm, uint cycles);
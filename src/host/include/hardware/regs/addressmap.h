@@ -0,0 +1,7 @@
+#pragma once
+
+#include "pico.h"
+
+// The flash is an in-memory image on the host, see host_flash in host.h
+extern uint8_t host_flash[PICO_FLASH_SIZE_BYTES];
+#define XIP_BASE ((uintptr_t)host_flash)
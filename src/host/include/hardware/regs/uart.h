@@ -0,0 +1,4 @@
+#pragma once
+
+#define UART_UARTIFLS_RXIFLSEL_LSB  3
+#define UART_UARTIFLS_RXIFLSEL_BITS 0x00000038
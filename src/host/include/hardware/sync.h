@@ -0,0 +1,7 @@
+#pragma once
+
+#include "pico.h"
+
+// Interrupt handlers run in task context on the host, a critical section keeps them and the other tasks out
+uint32_t save_and_disable_interrupts(void);
+void restore_interrupts(uint32_t status);
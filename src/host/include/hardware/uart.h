@@ -0,0 +1,50 @@
+#pragma once
+
+#include "pico.h"
+#include "hardware/address_mapped.h"
+#include "hardware/irq.h"
+#include "hardware/regs/uart.h"
+
+#define UART_FIFO_DEPTH 32
+
+// Only the registers the firmware touches directly
+typedef struct {
+    io_rw_32 ifls;
+} uart_hw_t;
+
+// Host state of one UART, replayed bytes arrive through host_uart_rx(), see host.h
+typedef struct uart_inst {
+    uart_hw_t hw;
+    uint32_t baudrate;
+    bool fifo_enabled;
+    bool rx_irq_enabled;
+    uint8_t rx_fifo[UART_FIFO_DEPTH];
+    uint32_t rx_fifo_head;
+    uint32_t rx_fifo_length;
+} uart_inst_t;
+
+extern uart_inst_t host_uart_instances[2];
+#define uart0 (&host_uart_instances[0])
+#define uart1 (&host_uart_instances[1])
+
+typedef enum {
+    UART_PARITY_NONE,
+    UART_PARITY_EVEN,
+    UART_PARITY_ODD
+} uart_parity_t;
+
+uint uart_init(uart_inst_t *uart, uint baudrate);
+uint uart_set_baudrate(uart_inst_t *uart, uint baudrate);
+void uart_set_hw_flow(uart_inst_t *uart, bool cts, bool rts);
+void uart_set_format(uart_inst_t *uart, uint data_bits, uint stop_bits, uart_parity_t parity);
+void uart_set_fifo_enabled(uart_inst_t *uart, bool enabled);
+void uart_set_irq_enables(uart_inst_t *uart, bool rx_has_data, bool tx_needs_data);
+bool uart_is_readable(uart_inst_t *uart);
+char uart_getc(uart_inst_t *uart);
+// Sent bytes go to the simulated receiver, see host.h
+void uart_write_blocking(uart_inst_t *uart, const uint8_t *src, size_t len);
+void uart_tx_wait_blocking(uart_inst_t *uart);
+
+static inline uart_hw_t *uart_get_hw(uart_inst_t *uart) {
+    return &uart->hw;
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+// Host stand-in for the header pico_generate_pio_header() makes from i2s_lsbj.pio
+
+#include "hardware/pio.h"
+
+extern const pio_program_t pio_lsbj_out_program;
+
+static inline void pio_lsbj_out_program_init(PIO pio, uint sm, uint offset, uint data_pin, uint clock_pin_base, uint bits) {
+    (void)offset;
+    (void)data_pin;
+    (void)clock_pin_base;
+    // Every FIFO word holds both channels and every bit takes two cycles
+    host_pio_set_cycles_per_word(pio, sm, 2 * 2 * bits);
+}
@@ -0,0 +1,17 @@
+#pragma once
+
+// Host stand-in for the Pico SDK base header, pulls in the board definitions like the SDK does
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "boards/custom_catchcam.h"
+#include "pico/platform/compiler.h"
+
+typedef unsigned int uint;
+
+#define PICO_ERROR_TIMEOUT -1
+
+// The POSIX port runs one task at a time, everything is on core 0
+uint get_core_num(void);
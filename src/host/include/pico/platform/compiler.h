@@ -0,0 +1,6 @@
+#pragma once
+
+#include "pico/platform/sections.h"
+
+#define __unused __attribute__((unused))
+#define __isr
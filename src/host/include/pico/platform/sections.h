@@ -0,0 +1,5 @@
+#pragma once
+
+// Everything lives in host memory, section placement is meaningless
+#define __in_flash(group)
+#define __not_in_flash_func(func_name) func_name
@@ -0,0 +1,15 @@
+#pragma once
+
+#include "pico.h"
+#include "hardware/gpio.h"
+#include "hardware/uart.h"
+
+// Delays block the calling task, scaled by the replay speedup
+void sleep_ms(uint32_t ms);
+
+uint32_t time_us_32(void);
+uint64_t time_us_64(void);
+
+bool stdio_init_all(void);
+// Stdin isn't read, always times out
+int getchar_timeout_us(uint32_t timeout_us);
@@ -1,6 +1,6 @@
 #include <stdio.h>
+#include <inttypes.h>
 #include <assert.h>
-#include <float.h>
 #include <math.h>
 
 #include <pico/stdlib.h>
@@ -14,6 +14,8 @@
 #include "gnss/gnss.h"
 #include "cams/cams.h"
 #include "audio/audio.h"
+#include "ring/ring.h"
+#include "trace/trace.h"
 
 // Priorities of our threads - higher numbers are higher priority
 #define MAIN_TASK_PRIORITY              (tskIDLE_PRIORITY        + 1)
@@ -22,16 +24,57 @@
 #define SYS_BLINK_TASK_PRIORITY         (AUDIO_TASK_PRIORITY     + 1)
 #define CAM_DET_LED_WRN_TASK_PRIORITY   (SYS_BLINK_TASK_PRIORITY + 1)
 #define CAM_DET_AUDIO_WRN_TASK_PRIORITY (CAM_DET_LED_WRN_TASK_PRIORITY + 1)
+// Only folds the latency trace into histograms, anything else goes first
+#define TRACE_TASK_PRIORITY             (tskIDLE_PRIORITY        + 1)
+
+// Core placement of our threads, NMEA ingest and the camera decision share one core,
+// the audio playback and the LEDs run on the other so a long prompt never delays a fix
+#define INGEST_CORE_AFFINITY_MASK (1u << 0)
+#define OUTPUT_CORE_AFFINITY_MASK (1u << 1)
 
 // Stack sizes of our threads in words (4 bytes)
-#define MAIN_TASK_STACK_SIZE                configMINIMAL_STACK_SIZE
+#define MAIN_TASK_STACK_SIZE                (configMINIMAL_STACK_SIZE * 2)
 #define AUDIO_TASK_STACK_SIZE               configMINIMAL_STACK_SIZE
 #define GNSS_TASK_STACK_SIZE                configMINIMAL_STACK_SIZE
 #define SYS_BLINK_TASK_STACK_SIZE           configMINIMAL_STACK_SIZE
 #define CAM_DET_LED_WRN_TASK_STACK_SIZE     configMINIMAL_STACK_SIZE
 #define CAM_DET_AUDIO_WRN_TASK_STACK_SIZE   configMINIMAL_STACK_SIZE
-
-#define KNOTS_TO_KMPH(knots) ((knots) * 1.852f)
+#define TRACE_TASK_STACK_SIZE               configMINIMAL_STACK_SIZE
+
+// Capacities of the inter-core rings, must be powers of two
+#define GNSS_DATA_RING_CAPACITY         4
+#define MAIN_AUDIO_SAMPLE_RING_CAPACITY 16
+#define GNSS_AUDIO_SAMPLE_RING_CAPACITY 4
+#define WRN_AUDIO_SAMPLE_RING_CAPACITY  2
+
+#define KNOTS_E3_TO_KMPH_E3(knots_e3) ((uint32_t)(((uint64_t)(knots_e3) * 1852u) / 1000u))
+
+#define CAMERA_DETECTION_RADIUS_IN_METERS 350
+// Max number of cameras we can be close to at once
+#define MAX_CAMERAS_IN_RANGE 4
+// Min speed for the GNSS course to be trusted
+#define COURSE_MIN_SPEED_KMPH 10u
+// Between fixes the position is extrapolated at this interval, for at most PREDICTION_MAX_MS after the last fix
+#define PREDICTION_INTERVAL_MS 50
+#define PREDICTION_MAX_MS      2000
+// The amplifier stays on this long after the last sample, a camera's next beep is usually due by then
+#define AMP_IDLE_TIMEOUT_MS 5000
+// A camera this close ahead turns the amplifier on before its first warning
+#define AMP_PREWARM_RADIUS_IN_METERS 1000
+// Renewed on every fix and prediction near a camera, outlasts PREDICTION_MAX_MS without fixes
+#define AMP_HOLD_MS 3000
+// A warning played later than this is misleading, it is dropped instead
+#define ANNOUNCEMENT_MAX_DELAY_MS 10000
+#define BEEP_MAX_DELAY_MS         1000
+// Beep trains, one per warning, the period shortens and the pitch rises up to this much over the limit
+#define BEEP_TRAIN_MS              2000
+#define BEEP_MAX_OVERSPEED_KMPH    30
+#define BEEP_MS                    100
+#define BEEP_UNDER_FREQUENCY_HZ    800
+#define BEEP_OVER_MIN_FREQUENCY_HZ 1000
+#define BEEP_OVER_MAX_FREQUENCY_HZ 2000
+#define BEEP_OVER_MAX_PERIOD_MS    330
+#define BEEP_OVER_MIN_PERIOD_MS    125
 
 // Camera detection LED warning data and task parameters
 struct cam_det_led_wrn_data {
@@ -42,14 +85,25 @@ struct cam_det_led_wrn_task_params {
     QueueHandle_t cam_det_led_wrn_data_queue;
 };
 
+// Audio sample rings, one per producer task, requests of the same priority play in this order
+enum audio_sample_ring_ids {
+    AUDIO_SAMPLE_RING_WRN,
+    AUDIO_SAMPLE_RING_GNSS,
+    AUDIO_SAMPLE_RING_MAIN,
+    AUDIO_SAMPLE_RINGS_LENGTH
+};
+
 // Camera detection audio warning data and task parameters
 struct cam_det_audio_wrn_data {
-    enum audio_samples audio_sample;
+    // How far above the camera limit we are, zero if not above
+    uint32_t overspeed_kmph;
+    // Fix that raised the warning
+    uint32_t trace_id;
 };
 
 struct cam_det_audio_wrn_task_params {
     QueueHandle_t cam_det_audio_wrn_data_queue;
-    QueueHandle_t audio_sample_data_queue;
+    struct ring *audio_sample_ring;
 };
 
 static void sys_blink_task(__unused void *params)
@@ -95,6 +149,42 @@ static void cam_det_led_wrn_task(void *params)
     }
 }
 
+// A single low beep below the limit, above it faster and higher beeps the more we are over
+static struct audio_beeps cam_det_audio_wrn_beeps(uint32_t overspeed_kmph)
+{
+    if (overspeed_kmph == 0) {
+        return (struct audio_beeps){
+            .frequency_hz = BEEP_UNDER_FREQUENCY_HZ,
+            .beep_ms = BEEP_MS,
+            .period_ms = BEEP_TRAIN_MS,
+            .count = 1,
+        };
+    }
+
+    if (overspeed_kmph > BEEP_MAX_OVERSPEED_KMPH) {
+        overspeed_kmph = BEEP_MAX_OVERSPEED_KMPH;
+    }
+    const uint32_t period_ms = BEEP_OVER_MAX_PERIOD_MS -
+        (BEEP_OVER_MAX_PERIOD_MS - BEEP_OVER_MIN_PERIOD_MS) * overspeed_kmph / BEEP_MAX_OVERSPEED_KMPH;
+    // Half on, half off, so the beeps stay apart at the fastest cadence
+    uint32_t beep_ms = period_ms / 2;
+    if (beep_ms > BEEP_MS) {
+        beep_ms = BEEP_MS;
+    }
+    uint32_t count = BEEP_TRAIN_MS / period_ms;
+    if (count > AUDIO_BEEPS_MAX_COUNT) {
+        count = AUDIO_BEEPS_MAX_COUNT;
+    }
+
+    return (struct audio_beeps){
+        .frequency_hz = BEEP_OVER_MIN_FREQUENCY_HZ +
+            (BEEP_OVER_MAX_FREQUENCY_HZ - BEEP_OVER_MIN_FREQUENCY_HZ) * overspeed_kmph / BEEP_MAX_OVERSPEED_KMPH,
+        .beep_ms = beep_ms,
+        .period_ms = period_ms,
+        .count = count,
+    };
+}
+
 static void cam_det_audio_wrn_task(void *params)
 {
     assert(params);
@@ -105,96 +195,109 @@ static void cam_det_audio_wrn_task(void *params)
 
     QueueHandle_t wrn_data_queue = task_params->cam_det_audio_wrn_data_queue;
     assert(wrn_data_queue);
-    QueueHandle_t audio_sample_data_queue = task_params->audio_sample_data_queue;
-    assert(audio_sample_data_queue);
+    struct ring *audio_sample_ring = task_params->audio_sample_ring;
+    assert(audio_sample_ring);
 
     while (true) {
         // Wait for camera detection warning data
         struct cam_det_audio_wrn_data wrn_data;
         xQueueReceive(wrn_data_queue, &wrn_data, portMAX_DELAY);
-        assert(wrn_data.audio_sample == AUDIO_SAMPLES_ONE_BEEP || wrn_data.audio_sample == AUDIO_SAMPLES_THREE_BEEPS);
-
-        // Do it twice so the beep period is more periodical
-        for (size_t i=0; i<2; i++) {
-            // Play audio warning sample with blocking
-            audio_play_sample_blocking(audio_sample_data_queue, wrn_data.audio_sample, done_playing_semaphore);
-            if (wrn_data.audio_sample == AUDIO_SAMPLES_THREE_BEEPS) {
-                sleep_ms(1000);
-            } else {
-                sleep_ms(2000);
-            }
-        }
+
+        // Above the limit the beeps cut off anything else
+        const struct audio_beeps beeps = cam_det_audio_wrn_beeps(wrn_data.overspeed_kmph);
+        const enum audio_priority priority = wrn_data.overspeed_kmph > 0 ? AUDIO_PRIORITY_URGENT : AUDIO_PRIORITY_WARNING;
+
+        // The whole train streams as one request, the next warning starts right after it
+        audio_play_beeps_blocking(audio_sample_ring, &beeps, priority, BEEP_MAX_DELAY_MS,
+                                  done_playing_semaphore, wrn_data.trace_id);
     }
 }
 
-static void play_camera_detected_warning(QueueHandle_t queue, uint8_t limit) {
-    static_assert(AUDIO_SAMPLES_LENGTH == 20 && "Add new audio sample handling code.");
-    assert(queue);
-    enum audio_samples audio_sample;
+static void play_camera_detected_warning(struct ring *samples, uint8_t limit, uint32_t trace_id) {
+    static const enum audio_samples tens_samples[10] = {
+        AUDIO_SAMPLES_LENGTH, AUDIO_SAMPLES_TEN, AUDIO_SAMPLES_TWENTY, AUDIO_SAMPLES_THIRTY, AUDIO_SAMPLES_FORTY,
+        AUDIO_SAMPLES_FIFTY, AUDIO_SAMPLES_SIXTY, AUDIO_SAMPLES_SEVENTY, AUDIO_SAMPLES_EIGHTY, AUDIO_SAMPLES_NINETY
+    };
+    assert(samples);
 
-    audio_play_sample_async(queue, AUDIO_SAMPLES_WARNING_SPEED_CAMERA_AHEAD_LIMIT);
+    // The whole announcement is one playlist, so its parts follow each other without gaps
+    enum audio_samples segments[AUDIO_PLAYLIST_MAX_SEGMENTS];
+    size_t segments_length = 0;
+    segments[segments_length++] = AUDIO_SAMPLES_THREE_BEEPS;
+    segments[segments_length++] = AUDIO_SAMPLES_WARNING_SPEED_CAMERA_AHEAD_LIMIT;
 
     if (limit == 0) {
-        audio_play_sample_async(queue, AUDIO_SAMPLES_UNKNOWN);
+        segments[segments_length++] = AUDIO_SAMPLES_UNKNOWN;
+        audio_play_playlist_async(samples, segments, segments_length, AUDIO_PRIORITY_WARNING, ANNOUNCEMENT_MAX_DELAY_MS, trace_id);
         return;
     }
 
     // TODO: support 200 speed limit (if needed)
     int hundreds = limit / 100;
     if (hundreds == 1) {
-        audio_play_sample_async(queue, AUDIO_SAMPLES_ONE_HUNDRED);
+        segments[segments_length++] = AUDIO_SAMPLES_ONE_HUNDRED;
     }
 
     // TODO: support (100 + 15) (although it seems to be an unused speed limit)
     int tens = (limit % 100) / 10;
-    switch (tens) {
-        case 0:
-            break;
-        case 1:
-            audio_play_sample_async(queue, AUDIO_SAMPLES_TEN);
-            break;
-        case 2:
-            audio_play_sample_async(queue, AUDIO_SAMPLES_TWENTY);
-            break;
-        case 3:
-            audio_play_sample_async(queue, AUDIO_SAMPLES_THIRTY);
-            break;
-        case 4:
-            audio_play_sample_async(queue, AUDIO_SAMPLES_FORTY);
-            break;
-        case 5:
-            audio_play_sample_async(queue, AUDIO_SAMPLES_FIFTY);
-            break;
-        case 6:
-            audio_play_sample_async(queue, AUDIO_SAMPLES_SIXTY);
-            break;
-        case 7:
-            audio_play_sample_async(queue, AUDIO_SAMPLES_SEVENTY);
-            break;
-        case 8:
-            audio_play_sample_async(queue, AUDIO_SAMPLES_EIGHTY);
-            break;
-        case 9:
-            audio_play_sample_async(queue, AUDIO_SAMPLES_NINETY);
-            break;
-        default:
-            assert(0);
+    if (tens > 0) {
+        segments[segments_length++] = tens_samples[tens];
     }
 
     int ones = limit % 10;
     if (ones == 5) {
-        audio_play_sample_async(queue, AUDIO_SAMPLES_FIVE);
+        segments[segments_length++] = AUDIO_SAMPLES_FIVE;
+    }
+
+    assert(segments_length <= AUDIO_PLAYLIST_MAX_SEGMENTS);
+    audio_play_playlist_async(samples, segments, segments_length, AUDIO_PRIORITY_WARNING, ANNOUNCEMENT_MAX_DELAY_MS, trace_id);
+}
+
+static bool camera_is_announced(const uint32_t *announced, size_t length, uint32_t camera_id)
+{
+    for (size_t i=0; i<length; i++) {
+        if (announced[i] == camera_id) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Check for a camera close enough that its warning is likely to come soon. It runs on every prediction,
+// so it only looks as far as the cache filled by the detection lookup reaches, where cameras are dense
+// a farther lookup would refill the cache every PREDICTION_INTERVAL_MS.
+static bool camera_is_upcoming(const struct gnss_position *pos, bool course_known, uint16_t course_deg)
+{
+    uint32_t radius_in_meters = cams_get_cached_radius(pos);
+    if (radius_in_meters > AMP_PREWARM_RADIUS_IN_METERS) {
+        radius_in_meters = AMP_PREWARM_RADIUS_IN_METERS;
+    }
+
+    struct cams_camera_match camera;
+    if (course_known) {
+        return cams_ahead_within_radius(pos, course_deg, radius_in_meters, &camera, 1) > 0;
     }
+    return cams_within_radius(pos, radius_in_meters, &camera, 1) > 0;
 }
 
 static void main_task(__unused void *params)
 {
     BaseType_t ret;
-    QueueHandle_t gnss_data_queue = xQueueCreate(1, sizeof(struct gnss_data));
-    assert(gnss_data_queue);
 
-    QueueHandle_t audio_sample_data_queue = xQueueCreate(16, sizeof(struct audio_sample_data));
-    assert(audio_sample_data_queue);
+    // Lock-free handoff between the cores, the warning queues below keep their overwrite semantics
+    static struct gnss_data gnss_data_ring_buffer[GNSS_DATA_RING_CAPACITY];
+    struct ring gnss_data_ring;
+    ring_init(&gnss_data_ring, gnss_data_ring_buffer, sizeof(gnss_data_ring_buffer[0]), GNSS_DATA_RING_CAPACITY, RING_OVERWRITE_OLDEST);
+    ring_set_consumer(&gnss_data_ring, xTaskGetCurrentTaskHandle());
+
+    static struct audio_sample_data wrn_audio_sample_ring_buffer[WRN_AUDIO_SAMPLE_RING_CAPACITY];
+    static struct audio_sample_data gnss_audio_sample_ring_buffer[GNSS_AUDIO_SAMPLE_RING_CAPACITY];
+    static struct audio_sample_data main_audio_sample_ring_buffer[MAIN_AUDIO_SAMPLE_RING_CAPACITY];
+    struct ring audio_sample_rings[AUDIO_SAMPLE_RINGS_LENGTH];
+    ring_init(&audio_sample_rings[AUDIO_SAMPLE_RING_WRN], wrn_audio_sample_ring_buffer, sizeof(wrn_audio_sample_ring_buffer[0]), WRN_AUDIO_SAMPLE_RING_CAPACITY, RING_DROP_NEWEST);
+    ring_init(&audio_sample_rings[AUDIO_SAMPLE_RING_GNSS], gnss_audio_sample_ring_buffer, sizeof(gnss_audio_sample_ring_buffer[0]), GNSS_AUDIO_SAMPLE_RING_CAPACITY, RING_DROP_NEWEST);
+    ring_init(&audio_sample_rings[AUDIO_SAMPLE_RING_MAIN], main_audio_sample_ring_buffer, sizeof(main_audio_sample_ring_buffer[0]), MAIN_AUDIO_SAMPLE_RING_CAPACITY, RING_DROP_NEWEST);
+    struct ring *audio_sample_ring = &audio_sample_rings[AUDIO_SAMPLE_RING_MAIN];
 
     QueueHandle_t cam_det_led_wrn_data_queue = xQueueCreate(1, sizeof(struct cam_det_led_wrn_data));
     assert(cam_det_led_wrn_data_queue);
@@ -202,121 +305,218 @@ static void main_task(__unused void *params)
     QueueHandle_t cam_det_audio_wrn_data_queue = xQueueCreate(1, sizeof(struct cam_det_audio_wrn_data));
     assert(cam_det_audio_wrn_data_queue);
 
-    ret = xTaskCreate(sys_blink_task, "SysBlinkThread", SYS_BLINK_TASK_STACK_SIZE, NULL, SYS_BLINK_TASK_PRIORITY, NULL);
+    ret = xTaskCreateAffinitySet(sys_blink_task, "SysBlinkThread", SYS_BLINK_TASK_STACK_SIZE, NULL, SYS_BLINK_TASK_PRIORITY, OUTPUT_CORE_AFFINITY_MASK, NULL);
     assert(ret == pdPASS);
 
     struct gnss_task_params gnss_task_params = {
-        .gnss_data_queue = gnss_data_queue,
-        .audio_sample_data_queue = audio_sample_data_queue,
+        .gnss_data_ring = &gnss_data_ring,
+        .audio_sample_ring = &audio_sample_rings[AUDIO_SAMPLE_RING_GNSS],
     };
-    ret = xTaskCreate(gnss_task, "GnssThread", GNSS_TASK_STACK_SIZE, &gnss_task_params, GNSS_TASK_PRIORITY, NULL);
+    // The UART IRQ is enabled from the GNSS task, so it is serviced on the ingest core as well
+    ret = xTaskCreateAffinitySet(gnss_task, "GnssThread", GNSS_TASK_STACK_SIZE, &gnss_task_params, GNSS_TASK_PRIORITY, INGEST_CORE_AFFINITY_MASK, NULL);
     assert(ret == pdPASS);
 
     struct audio_task_params audio_task_params = {
-        .audio_sample_data_queue = audio_sample_data_queue,
+        .audio_sample_rings = audio_sample_rings,
+        .audio_sample_rings_length = AUDIO_SAMPLE_RINGS_LENGTH,
+        .amp_idle_timeout_ms = AMP_IDLE_TIMEOUT_MS,
     };
-    ret = xTaskCreate(audio_task, "AudioThread", AUDIO_TASK_STACK_SIZE, &audio_task_params, AUDIO_TASK_PRIORITY, NULL);
+    // Same for the DMA IRQ of the audio task
+    ret = xTaskCreateAffinitySet(audio_task, "AudioThread", AUDIO_TASK_STACK_SIZE, &audio_task_params, AUDIO_TASK_PRIORITY, OUTPUT_CORE_AFFINITY_MASK, NULL);
     assert(ret == pdPASS);
 
     struct cam_det_led_wrn_task_params cam_det_led_wrn_task_params = {
         .cam_det_led_wrn_data_queue = cam_det_led_wrn_data_queue,
     };
-    ret = xTaskCreate(cam_det_led_wrn_task, "CamDetLedWrnThread", CAM_DET_LED_WRN_TASK_STACK_SIZE, &cam_det_led_wrn_task_params, CAM_DET_LED_WRN_TASK_PRIORITY, NULL);
+    ret = xTaskCreateAffinitySet(cam_det_led_wrn_task, "CamDetLedWrnThread", CAM_DET_LED_WRN_TASK_STACK_SIZE, &cam_det_led_wrn_task_params, CAM_DET_LED_WRN_TASK_PRIORITY, OUTPUT_CORE_AFFINITY_MASK, NULL);
     assert(ret == pdPASS);
 
     struct cam_det_audio_wrn_task_params cam_det_audio_wrn_task_params = {
         .cam_det_audio_wrn_data_queue = cam_det_audio_wrn_data_queue,
-        .audio_sample_data_queue = audio_sample_data_queue,
+        .audio_sample_ring = &audio_sample_rings[AUDIO_SAMPLE_RING_WRN],
     };
-    ret = xTaskCreate(cam_det_audio_wrn_task, "CamDetAudioWrnThread", CAM_DET_AUDIO_WRN_TASK_STACK_SIZE, &cam_det_audio_wrn_task_params, CAM_DET_AUDIO_WRN_TASK_PRIORITY, NULL);
+    ret = xTaskCreateAffinitySet(cam_det_audio_wrn_task, "CamDetAudioWrnThread", CAM_DET_AUDIO_WRN_TASK_STACK_SIZE, &cam_det_audio_wrn_task_params, CAM_DET_AUDIO_WRN_TASK_PRIORITY, OUTPUT_CORE_AFFINITY_MASK, NULL);
+    assert(ret == pdPASS);
+
+#ifdef CATCHCAM_TRACE
+    // Keep the histograms off the ingest core
+    ret = xTaskCreateAffinitySet(trace_task, "TraceThread", TRACE_TASK_STACK_SIZE, NULL, TRACE_TASK_PRIORITY, OUTPUT_CORE_AFFINITY_MASK, NULL);
     assert(ret == pdPASS);
+#endif
+
+    // Select the camera database, without one we still report the GNSS state
+    cams_init();
 
-    // Play startup audio sample
-    audio_play_sample_async(audio_sample_data_queue, AUDIO_SAMPLES_STARTUP);
+    // Play startup audio sample followed by one second pause
+    static const enum audio_samples startup_segments[] = { AUDIO_SAMPLES_STARTUP, AUDIO_SAMPLES_ONE_SECOND_PAUSE };
+    audio_play_playlist_async(audio_sample_ring, startup_segments, sizeof(startup_segments) / sizeof(startup_segments[0]),
+                              AUDIO_PRIORITY_INFO, AUDIO_NO_DEADLINE, TRACE_NO_ID);
 
-    // Play one second pause
-    audio_play_sample_async(audio_sample_data_queue, AUDIO_SAMPLES_ONE_SECOND_PAUSE);
+    // Cameras in range that were already announced
+    uint32_t announced_cameras[MAX_CAMERAS_IN_RANGE];
+    size_t announced_cameras_length = 0;
 
-    const struct cams_camera_info *last_camera = NULL;
-    float last_distance_squared_in_meters = FLT_MAX;
+    uint32_t last_camera = CAMS_NO_CAMERA;
+    uint32_t last_distance_squared_in_meters = GNSS_DISTANCE_FAR;
+
+    uint16_t course_deg = 0;
+    bool course_known = false;
+
+    // Last fix from the GNSS task, predictions start from it
+    struct gnss_data last_fix = {0};
+    const TickType_t prediction_interval = pdMS_TO_TICKS(PREDICTION_INTERVAL_MS) > 0 ? pdMS_TO_TICKS(PREDICTION_INTERVAL_MS) : 1;
+    TickType_t next_prediction = xTaskGetTickCount() + prediction_interval;
 
     while(true) {
-        // Wait for gnss data
+        trace_fix_done();
+
+        // Wait for gnss data until the next prediction is due and skip to the newest fix if we fell behind
         struct gnss_data gnss_data;
-        xQueueReceive(gnss_data_queue, &gnss_data, portMAX_DELAY);
+        // Only real fixes are logged, predictions every PREDICTION_INTERVAL_MS would flood the UART
+        bool is_fix = false;
+        const TickType_t now = xTaskGetTickCount();
+        const TickType_t timeout = (int32_t)(next_prediction - now) > 0 ? next_prediction - now : 0;
+        if (ring_pop_timeout(&gnss_data_ring, &gnss_data, timeout)) {
+            while (ring_pop(&gnss_data_ring, &gnss_data)) {
+            }
+            trace_fix_received();
+            is_fix = true;
+            last_fix = gnss_data;
+            next_prediction = gnss_data.timestamp + prediction_interval;
+
+            printf("GNSS data: time=%" PRIu32 " ms, valid=%d, quality=%u, satellites=%u, speed=%" PRIu32 "e-3 kmph, course=%" PRIu32 "e-2 deg, lat=%" PRId32 "e-6, lon=%" PRId32 "e-6, error=%" PRIu32 " cm, hdop=%ue-2\n",
+                   gnss_data.time_ms, gnss_data.valid, gnss_data.fix_quality, gnss_data.satellites, KNOTS_E3_TO_KMPH_E3(gnss_data.speed_knots_e3),
+                   gnss_data.course_deg_e2, gnss_data.pos.lat, gnss_data.pos.lon, gnss_data.pos_error_cm, gnss_data.hdop_e2);
+
+            struct gnss_uart_stats gnss_uart_stats;
+            gnss_get_uart_stats(&gnss_uart_stats);
+            printf("GNSS UART: irqs=%" PRIu32 ", bytes=%" PRIu32 ", dropped=%" PRIu32 ", isr_time=%" PRIu32 " us\n",
+                   gnss_uart_stats.irqs, gnss_uart_stats.bytes, gnss_uart_stats.dropped_bytes, gnss_uart_stats.isr_time_us);
+        } else {
+            next_prediction = xTaskGetTickCount() + prediction_interval;
+
+            // Nothing to extrapolate from, or the last fix is too old to trust its speed and course
+            const uint32_t elapsed_ms = pdTICKS_TO_MS(xTaskGetTickCount() - last_fix.timestamp);
+            if (last_fix.valid == false || elapsed_ms > PREDICTION_MAX_MS) {
+                continue;
+            }
 
-        printf("GNSS data: valid=%d, speed=%.2f kmph, course=%.2f deg, lat=%.6f, lon=%.6f\n",
-               gnss_data.valid, KNOTS_TO_KMPH(gnss_data.speed_knots), gnss_data.course_deg, gnss_data.pos.lat, gnss_data.pos.lon);
+            // Run the camera checks on where we should be by now
+            gnss_data = last_fix;
+            gnss_predict_position(&last_fix, elapsed_ms, &gnss_data.pos);
+        }
 
         if (gnss_data.valid == false) {
             // Clear camera detection warning
-            last_camera = NULL;
-            last_distance_squared_in_meters = FLT_MAX;
+            announced_cameras_length = 0;
+            last_camera = CAMS_NO_CAMERA;
+            last_distance_squared_in_meters = GNSS_DISTANCE_FAR;
             continue;
         }
 
-        // Get nearest camera
-        const struct cams_camera_info *camera;
-        cams_get_nearest_camera(&camera, &gnss_data.pos);
+        const uint32_t current_speed_kmph_e3 = KNOTS_E3_TO_KMPH_E3(gnss_data.speed_knots_e3);
 
-        printf("Nearest camera: lat=%.6f, lon=%.6f, limit=%d\n", camera->pos.lat, camera->pos.lon, camera->limit);
+        // Course is meaningless when standing still, keep the last one
+        if (current_speed_kmph_e3 > COURSE_MIN_SPEED_KMPH * 1000u) {
+            course_deg = (uint16_t)(gnss_data.course_deg_e2 / 100u);
+            course_known = true;
+        }
+
+        // Get all cameras we are close to, once we know where we're heading only the ones ahead of us
+        struct cams_camera_match cameras[MAX_CAMERAS_IN_RANGE];
+        size_t cameras_length;
+        if (course_known) {
+            cameras_length = cams_ahead_within_radius(&gnss_data.pos, course_deg, CAMERA_DETECTION_RADIUS_IN_METERS, cameras, MAX_CAMERAS_IN_RANGE);
+        } else {
+            cameras_length = cams_within_radius(&gnss_data.pos, CAMERA_DETECTION_RADIUS_IN_METERS, cameras, MAX_CAMERAS_IN_RANGE);
+        }
+        // Predictions carry the ID of their fix, only its first decision is traced
+        trace_stage(TRACE_STAGE_CAMERA_DECISION, gnss_data.trace_id);
 
-        float distance_squared_in_meters = GNSS_DISTANCE_SQUARED_IN_METERS(gnss_data.pos, camera->pos);
-        printf("Distance: %.2f m\n", sqrtf(distance_squared_in_meters));
+        if (is_fix) {
+            struct cams_cache_stats cams_cache_stats;
+            cams_get_cache_stats(&cams_cache_stats);
+            printf("Cameras cache: hits=%" PRIu32 ", refreshes=%" PRIu32 "\n", cams_cache_stats.hits, cams_cache_stats.refreshes);
+        }
 
-        // Check if we are close to a camera
-        if (distance_squared_in_meters <= 350.0f * 350.0f) {
-            const uint8_t camera_limit = camera->limit;
+        // Keep the amplifier on while a camera is near or coming up, its warnings then skip the warm-up
+        if (cameras_length > 0 || camera_is_upcoming(&gnss_data.pos, course_known, course_deg)) {
+            audio_amp_hold(AMP_HOLD_MS);
+        }
 
-            // Alert only if this is a new camera
-            if (last_camera != camera) {
-                // Flash and play camera detected warning
-                struct cam_det_led_wrn_data cam_det_led_wrn_data = {
-                    .flash_count = camera_limit / 10u,
-                };
-                xQueueOverwrite(cam_det_led_wrn_data_queue, &cam_det_led_wrn_data);
+        for (size_t i=0; is_fix && i<cameras_length; i++) {
+            const struct cams_camera_info *camera = &cameras[i].cam;
+            printf("Camera in range: lat=%" PRId32 "e-6, lon=%" PRId32 "e-6, limit=%d, distance=%.2f m\n",
+                   camera->pos.lat, camera->pos.lon, camera->limit, sqrtf((float)cameras[i].distance_squared_in_meters));
+        }
 
-                audio_play_sample_async(audio_sample_data_queue, AUDIO_SAMPLES_THREE_BEEPS);
-                play_camera_detected_warning(audio_sample_data_queue, camera_limit);
+        if (cameras_length == 0) {
+            // Clear camera detection warning
+            announced_cameras_length = 0;
+            last_camera = CAMS_NO_CAMERA;
+            last_distance_squared_in_meters = GNSS_DISTANCE_FAR;
+            continue;
+        }
 
-                last_camera = camera;
+        // Alert only for cameras which weren't announced yet, nearest first
+        for (size_t i=0; i<cameras_length; i++) {
+            const struct cams_camera_info *camera = &cameras[i].cam;
+            if (camera_is_announced(announced_cameras, announced_cameras_length, camera->id)) {
+                continue;
             }
 
-            float current_speed_kmph = KNOTS_TO_KMPH(gnss_data.speed_knots);
-
-            // Trigger camera detection warnings only if we're getting closer to the camera and the speed is above certain threshold
-            if (distance_squared_in_meters < last_distance_squared_in_meters && current_speed_kmph > 10.0f) {
-                // Play three beeps if the current speed is above the camera speed limit, otherwise play one beep
-                struct cam_det_audio_wrn_data cam_det_audio_wrn_data = {
-                    // TODO: handle different camera speed limit units
-                    .audio_sample = current_speed_kmph > camera_limit ? AUDIO_SAMPLES_THREE_BEEPS : AUDIO_SAMPLES_ONE_BEEP,
-                };
-                xQueueOverwrite(cam_det_audio_wrn_data_queue, &cam_det_audio_wrn_data);
-
-                // Flash camera detected LED based on the speed limit
-                struct cam_det_led_wrn_data cam_det_led_wrn_data = {
-                    .flash_count = camera_limit / 10u,
-                };
-                xQueueOverwrite(cam_det_led_wrn_data_queue, &cam_det_led_wrn_data);
-            }
-        } else {
-            // Clear camera detection warning
-            last_camera = NULL;
+            // Flash and play camera detected warning
+            struct cam_det_led_wrn_data cam_det_led_wrn_data = {
+                .flash_count = camera->limit / 10u,
+            };
+            xQueueOverwrite(cam_det_led_wrn_data_queue, &cam_det_led_wrn_data);
+
+            play_camera_detected_warning(audio_sample_ring, camera->limit, gnss_data.trace_id);
+            trace_warning_enqueued();
         }
 
+        // Forget the cameras we're no longer close to
+        for (size_t i=0; i<cameras_length; i++) {
+            announced_cameras[i] = cameras[i].cam.id;
+        }
+        announced_cameras_length = cameras_length;
+
+        // Beep for the nearest camera
+        const struct cams_camera_info *camera = &cameras[0].cam;
+        const uint32_t distance_squared_in_meters = cameras[0].distance_squared_in_meters;
+        const uint8_t camera_limit = camera->limit;
+
+        // Trigger camera detection warnings only if we're getting closer to the camera and the speed is above certain threshold
+        const bool getting_closer = camera->id != last_camera || distance_squared_in_meters < last_distance_squared_in_meters;
+        if (getting_closer && current_speed_kmph_e3 > 10u * 1000u) {
+            // Beep faster and higher the more the current speed is above the camera speed limit, otherwise beep once
+            struct cam_det_audio_wrn_data cam_det_audio_wrn_data = {
+                // TODO: handle different camera speed limit units
+                .overspeed_kmph = current_speed_kmph_e3 > camera_limit * 1000u ?
+                    (current_speed_kmph_e3 - camera_limit * 1000u + 999u) / 1000u : 0,
+                .trace_id = gnss_data.trace_id,
+            };
+            xQueueOverwrite(cam_det_audio_wrn_data_queue, &cam_det_audio_wrn_data);
+            trace_warning_enqueued();
+
+            // Flash camera detected LED based on the speed limit
+            struct cam_det_led_wrn_data cam_det_led_wrn_data = {
+                .flash_count = camera_limit / 10u,
+            };
+            xQueueOverwrite(cam_det_led_wrn_data_queue, &cam_det_led_wrn_data);
+        }
+
+        last_camera = camera->id;
         last_distance_squared_in_meters = distance_squared_in_meters;
     }
 }
 
 static void vLaunch(void)
 {
-    TaskHandle_t task;
-    BaseType_t ret = xTaskCreate(main_task, "MainThread", MAIN_TASK_STACK_SIZE, NULL, MAIN_TASK_PRIORITY, &task);
+    // The camera decision runs in the main task, keep it next to the NMEA ingest
+    BaseType_t ret = xTaskCreateAffinitySet(main_task, "MainThread", MAIN_TASK_STACK_SIZE, NULL, MAIN_TASK_PRIORITY, INGEST_CORE_AFFINITY_MASK, NULL);
     assert(ret == pdPASS);
 
-    // we must bind the main task to one core (well at least while the init is called)
-    vTaskCoreAffinitySet(task, 1);
-
     /* Start the tasks and timer running. */
     vTaskStartScheduler();
 }
@@ -0,0 +1,145 @@
+#include <assert.h>
+#include <string.h>
+
+#include "ring.h"
+
+void ring_init(struct ring *ring, void *buffer, size_t item_size, uint32_t capacity, enum ring_mode mode)
+{
+    assert(ring);
+    assert(buffer);
+    assert(item_size > 0);
+    assert(capacity > 0 && (capacity & (capacity - 1)) == 0);
+    assert(mode == RING_DROP_NEWEST || capacity >= 2);
+
+    ring->buffer = buffer;
+    ring->item_size = item_size;
+    ring->capacity = capacity;
+    ring->mode = mode;
+    ring->head = 0;
+    ring->dropped = 0;
+    ring->tail = 0;
+    ring->overwritten = 0;
+    ring->consumer = NULL;
+}
+
+void ring_set_consumer(struct ring *ring, TaskHandle_t consumer)
+{
+    assert(ring);
+    __atomic_store_n(&ring->consumer, consumer, __ATOMIC_RELEASE);
+}
+
+bool ring_push(struct ring *ring, const void *item)
+{
+    assert(ring);
+    assert(item);
+
+    const uint32_t head = ring->head;
+    if (ring->mode == RING_OVERWRITE_OLDEST) {
+        // The consumer may be copying the oldest item, it sees the new head and retries. The
+        // previous head must be visible before the slot changes, there is no CAS on the M0+.
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+    } else if (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) == ring->capacity) {
+        ring->dropped++;
+        return false;
+    }
+
+    memcpy(&ring->buffer[(head & (ring->capacity - 1)) * ring->item_size], item, ring->item_size);
+    // Publish the item before the new head
+    __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+
+    TaskHandle_t consumer = __atomic_load_n(&ring->consumer, __ATOMIC_ACQUIRE);
+    if (consumer != NULL) {
+        xTaskNotifyGive(consumer);
+    }
+    return true;
+}
+
+// Take the oldest item which isn't overwritten while it's copied
+static bool ring_pop_overwritten(struct ring *ring, void *item)
+{
+    uint32_t tail = ring->tail;
+
+    while (true) {
+        const uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+        if (head == tail) {
+            return false;
+        }
+
+        // The slot of head - capacity is the one the producer writes next
+        if (head - tail >= ring->capacity) {
+            ring->overwritten += head - ring->capacity + 1 - tail;
+            tail = head - ring->capacity + 1;
+        }
+
+        memcpy(item, &ring->buffer[(tail & (ring->capacity - 1)) * ring->item_size], ring->item_size);
+        // The copy is good if the producer didn't start on the slot meanwhile
+        __atomic_thread_fence(__ATOMIC_SEQ_CST);
+        if (__atomic_load_n(&ring->head, __ATOMIC_RELAXED) - tail < ring->capacity) {
+            break;
+        }
+    }
+
+    ring->tail = tail + 1;
+    return true;
+}
+
+bool ring_pop(struct ring *ring, void *item)
+{
+    assert(ring);
+    assert(item);
+
+    if (ring->mode == RING_OVERWRITE_OLDEST) {
+        return ring_pop_overwritten(ring, item);
+    }
+
+    const uint32_t tail = ring->tail;
+    const uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    if (head == tail) {
+        return false;
+    }
+
+    memcpy(item, &ring->buffer[(tail & (ring->capacity - 1)) * ring->item_size], ring->item_size);
+    // Release the slot only after the item was copied out
+    __atomic_store_n(&ring->tail, tail + 1, __ATOMIC_RELEASE);
+    return true;
+}
+
+bool ring_peek(struct ring *ring, void *item)
+{
+    assert(ring);
+    assert(item);
+    assert(ring->mode == RING_DROP_NEWEST);
+
+    const uint32_t tail = ring->tail;
+    const uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    if (head == tail) {
+        return false;
+    }
+
+    // The producer won't touch the slot until the consumer moves the tail
+    memcpy(item, &ring->buffer[(tail & (ring->capacity - 1)) * ring->item_size], ring->item_size);
+    return true;
+}
+
+void ring_pop_blocking(struct ring *ring, void *item)
+{
+    // A push between the check and the wait leaves a pending notification, so no wakeup is lost
+    while (ring_pop(ring, item) == false) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+}
+
+bool ring_pop_timeout(struct ring *ring, void *item, TickType_t timeout)
+{
+    const TickType_t start = xTaskGetTickCount();
+
+    // A stale notification wakes us early, keep waiting for the rest of the timeout
+    while (ring_pop(ring, item) == false) {
+        const TickType_t elapsed = xTaskGetTickCount() - start;
+        if (elapsed >= timeout) {
+            return false;
+        }
+        ulTaskNotifyTake(pdTRUE, timeout - elapsed);
+    }
+    return true;
+}
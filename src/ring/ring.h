@@ -0,0 +1,49 @@
+#pragma once
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#include <FreeRTOS.h>
+#include <task.h>
+
+// What a push does when the ring is full
+enum ring_mode {
+    // The new item is dropped, for requests which must not be lost once queued
+    RING_DROP_NEWEST,
+    // The oldest item is overwritten, for state where only the newest value matters.
+    // The producer never waits for the consumer.
+    RING_OVERWRITE_OLDEST,
+};
+
+// Lock-free single producer, single consumer ring of fixed size items. The producer
+// and the consumer may run on different cores. The consumer task is woken with a task
+// notification, so a task consuming several rings wakes up on a push to any of them.
+struct ring {
+    uint8_t *buffer;
+    size_t item_size;
+    // Power of two
+    uint32_t capacity;
+    enum ring_mode mode;
+    // Only written by the producer
+    uint32_t head;
+    uint32_t dropped;
+    // Only written by the consumer
+    uint32_t tail;
+    uint32_t overwritten;
+    TaskHandle_t consumer;
+};
+
+// RING_OVERWRITE_OLDEST needs a capacity of at least 2, the slot being overwritten can't be read
+void ring_init(struct ring *ring, void *buffer, size_t item_size, uint32_t capacity, enum ring_mode mode);
+// Must be called by the consumer task before it waits on the ring
+void ring_set_consumer(struct ring *ring, TaskHandle_t consumer);
+// Returns false and counts a drop if the ring is full, never fails when overwriting
+bool ring_push(struct ring *ring, const void *item);
+bool ring_pop(struct ring *ring, void *item);
+// Copy the next item without taking it, consumer only and RING_DROP_NEWEST only
+bool ring_peek(struct ring *ring, void *item);
+// Block the consumer until an item is available
+void ring_pop_blocking(struct ring *ring, void *item);
+// Same, but gives up after timeout ticks and returns false
+bool ring_pop_timeout(struct ring *ring, void *item, TickType_t timeout);
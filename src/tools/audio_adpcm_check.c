@@ -0,0 +1,126 @@
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "audio/audio_adpcm.h"
+
+// Longest signal of the reference, the longest prompt is about 3.5 s at 24 kHz
+#define CHECK_MAX_SAMPLES (1u << 20)
+#define CHECK_MAX_NAME    255
+
+static uint8_t check_encoded[CHECK_MAX_SAMPLES / 2 + (CHECK_MAX_SAMPLES / AUDIO_ADPCM_BLOCK_SAMPLES + 1) * AUDIO_ADPCM_BLOCK_HEADER_SIZE];
+static int16_t check_expected[CHECK_MAX_SAMPLES];
+
+static bool check_read(FILE *file, void *data, size_t size)
+{
+    return fread(data, 1, size, file) == size;
+}
+
+static uint32_t check_le32(const uint8_t *data)
+{
+    return data[0] | (data[1] << 8) | (data[2] << 16) | ((uint32_t)data[3] << 24);
+}
+
+// Decode every block of a signal and compare it with what convert.py expects, returns the mismatches
+static uint32_t check_signal(const char *name, size_t length, size_t encoded_size)
+{
+    const struct audio_adpcm_sample sample = {
+        .data = check_encoded,
+        .length = length,
+    };
+    const size_t blocks = audio_adpcm_get_blocks(&sample);
+    const size_t last_samples = length - (blocks - 1) * AUDIO_ADPCM_BLOCK_SAMPLES;
+    if (encoded_size != (blocks - 1) * AUDIO_ADPCM_BLOCK_SIZE + AUDIO_ADPCM_BLOCK_HEADER_SIZE + (last_samples + 1) / 2) {
+        printf("  %-40s %zu bytes of blocks for %zu samples\n", name, encoded_size, length);
+        return 1;
+    }
+
+    uint32_t mismatches = 0;
+    for (size_t block = 0; block < blocks; block++) {
+        int16_t pcm[AUDIO_ADPCM_BLOCK_SAMPLES];
+        const size_t count = audio_adpcm_decode_block(&sample, block, pcm);
+        for (size_t i = 0; i < count; i++) {
+            const size_t index = block * AUDIO_ADPCM_BLOCK_SAMPLES + i;
+            if (pcm[i] == check_expected[index])
+                continue;
+            if (mismatches < 5)
+                printf("  %-40s sample %zu: decoded %d, convert.py %d\n", name, index, pcm[i], check_expected[index]);
+            mismatches++;
+        }
+    }
+
+    printf("  %-40s %8zu samples %4zu blocks %6u mismatches\n", name, length, blocks, mismatches);
+    return mismatches;
+}
+
+static bool check_file(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        perror(path);
+        return false;
+    }
+
+    printf("%s\n", path);
+    bool passed = true;
+    uint32_t signals = 0;
+    uint8_t name_length;
+    while (check_read(file, &name_length, 1)) {
+        char name[CHECK_MAX_NAME + 1];
+        uint8_t sizes[8];
+        if (check_read(file, name, name_length) == false || check_read(file, sizes, sizeof(sizes)) == false) {
+            printf("  truncated record\n");
+            passed = false;
+            break;
+        }
+        name[name_length] = '\0';
+
+        const uint32_t length = check_le32(&sizes[0]);
+        const uint32_t encoded_size = check_le32(&sizes[4]);
+        if (length == 0 || length > CHECK_MAX_SAMPLES || encoded_size > sizeof(check_encoded)) {
+            printf("  %-40s %u samples in %u bytes don't fit\n", name, length, encoded_size);
+            passed = false;
+            break;
+        }
+
+        uint8_t expected[2 * 1024];
+        bool read = check_read(file, check_encoded, encoded_size);
+        for (uint32_t i = 0; read && i < length; i += sizeof(expected) / 2) {
+            const uint32_t count = length - i < sizeof(expected) / 2 ? length - i : sizeof(expected) / 2;
+            read = check_read(file, expected, count * 2);
+            for (uint32_t j = 0; read && j < count; j++)
+                check_expected[i + j] = (int16_t)(expected[2 * j] | (expected[2 * j + 1] << 8));
+        }
+        if (read == false) {
+            printf("  %-40s truncated\n", name);
+            passed = false;
+            break;
+        }
+
+        passed &= check_signal(name, length, encoded_size) == 0;
+        signals++;
+    }
+
+    fclose(file);
+    if (signals == 0)
+        passed = false;
+    return passed;
+}
+
+int main(int argc, char **argv)
+{
+    if (argc < 2) {
+        fprintf(stderr, "usage: %s <reference.bin>...\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    bool passed = true;
+    for (int i = 1; i < argc; i++)
+        passed &= check_file(argv[i]);
+
+    if (passed == false)
+        printf("FAILED\n");
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
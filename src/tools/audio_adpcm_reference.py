@@ -0,0 +1,57 @@
+# Reference for audio_adpcm_check: signals encoded by convert.py together with the samples its encoder
+# expects the firmware to decode from them. Synthetic signals drive the decoder into its clamps and
+# odd block lengths, the voice prompts are read with the wave module, so ffmpeg isn't needed.
+#
+# Every record is the name length (uint8) and name, the length in samples and the size of the blocks
+# (uint32, little endian), the blocks and the decoded samples (int16, little endian).
+import glob
+import math
+import os
+import random
+import struct
+import sys
+import wave
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'scripts', 'convert_audio_samples'))
+import convert
+
+SAMPLE_RATE = 24000
+
+def synthetic_signals():
+    rand = random.Random(1)
+    n = 3 * convert.ADPCM_BLOCK_SAMPLES + 321
+    yield 'silence', [0] * n
+    yield 'sweep', [int(20000 * math.sin(2 * math.pi * (50 + 5000 * i / n) * i / SAMPLE_RATE)) for i in range(n)]
+    # Full scale edges the step can't follow, predictions clamp at both ends of int16
+    yield 'square', [convert.INT16_MAX if (i // 37) % 2 else convert.INT16_MIN for i in range(n)]
+    yield 'noise', [rand.randint(convert.INT16_MIN, convert.INT16_MAX) for _ in range(n)]
+    # A loud burst drives the step index to its top, the silence after it to the bottom
+    yield 'burst', [rand.randint(convert.INT16_MIN, convert.INT16_MAX) if i < 500 else 0 for i in range(n)]
+    for length in (1, 2, convert.ADPCM_BLOCK_SAMPLES - 1, convert.ADPCM_BLOCK_SAMPLES, convert.ADPCM_BLOCK_SAMPLES + 1):
+        yield f'length {length}', [int(10000 * math.sin(i / 7)) for i in range(length)]
+
+def prompt_signals(samples_dir):
+    for path in sorted(glob.glob(os.path.join(samples_dir, '*.wav'))):
+        with wave.open(path) as w:
+            assert w.getnchannels() == 1 and w.getsampwidth() == 2
+            data = w.readframes(w.getnframes())
+        samples = list(struct.unpack('<' + 'h' * (len(data) // 2), data))
+        yield os.path.basename(path), convert.trim_silence(convert.normalize_samples(samples))
+
+def main(output_file):
+    samples_dir = os.path.join(os.path.dirname(os.path.abspath(convert.__file__)), 'samples')
+    with open(output_file, 'wb') as f:
+        for name, samples in list(synthetic_signals()) + list(prompt_signals(samples_dir)):
+            encoded, decoded = convert.adpcm_encode(samples)
+            assert len(decoded) == len(samples)
+            f.write(struct.pack('<B', len(name)) + name.encode())
+            f.write(struct.pack('<II', len(samples), len(encoded)))
+            f.write(encoded)
+            f.write(struct.pack('<' + 'h' * len(decoded), *decoded))
+
+if __name__ == "__main__":
+    if len(sys.argv) != 2:
+        print("Usage: python3 audio_adpcm_reference.py <output_bin_file>")
+        sys.exit(1)
+
+    main(sys.argv[1])
@@ -0,0 +1,46 @@
+#pragma once
+
+// Shared by the host tools: a reproducible random source, a clock and the loop timing a variant
+
+#include <stdint.h>
+#include <time.h>
+
+// Every variant runs at least this long
+#define BENCH_MIN_SECONDS 0.5
+
+static uint32_t bench_random_state = 1;
+
+static inline uint32_t bench_random(void)
+{
+    // xorshift32, the generated inputs must be the same on every run
+    bench_random_state ^= bench_random_state << 13;
+    bench_random_state ^= bench_random_state >> 17;
+    bench_random_state ^= bench_random_state << 5;
+    return bench_random_state;
+}
+
+// Uniform in [min, max)
+static inline double bench_uniform(double min, double max)
+{
+    return min + (max - min) * (bench_random() / 4294967296.0);
+}
+
+static inline double bench_now(void)
+{
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+// Run the variant for at least BENCH_MIN_SECONDS and min_runs times, returns the seconds taken
+static inline double bench_repeat(void (*run)(void *context), void *context, uint32_t min_runs, uint32_t *runs)
+{
+    const double start = bench_now();
+    double elapsed;
+    *runs = 0;
+    do {
+        run(context);
+        (*runs)++;
+    } while ((elapsed = bench_now() - start) < BENCH_MIN_SECONDS || *runs < min_runs);
+    return elapsed;
+}
@@ -0,0 +1,376 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <hardware/regs/addressmap.h>
+
+#include "cams/cams.h"
+#include "cams/cams_db.h"
+#include "gnss/gnss_geo.h"
+
+#include "bench.h"
+
+// Every variant runs over the queries at least BENCH_MIN_SECONDS and at least once
+#define BENCH_QUERIES 2000
+// Queries around each of the clusters at high latitudes and on the antimeridian
+#define BENCH_EDGE_QUERIES 50
+
+// The cache refresh: nearest cameras within its radius
+#define BENCH_RADIUS_IN_METERS 3000
+#define BENCH_MAX_CAMERAS      32
+// Radius of the cached lookups, small enough to be served from the cache
+#define BENCH_CACHED_RADIUS_IN_METERS 1000
+
+// Same heading cone as cams.c
+#define BENCH_CONE_HALF_ANGLE_DEG          60
+#define BENCH_CONE_DIRECTION_TOLERANCE_DEG 45
+#define BENCH_CONE_MIN_DISTANCE_IN_METERS  30
+
+// Flash image the camera database slots are read from, see addressmap.h
+uint8_t host_flash[PICO_FLASH_SIZE_BYTES];
+
+// Camera list and lookup before the database image, a linear scan of floats in degrees
+struct __attribute__((packed)) bench_packed_camera {
+    float lat;
+    float lon;
+    uint8_t limit;
+};
+
+#define GNSS_DISTANCE_SQUARED_IN_METERS(pos1, pos2) \
+    (((pos1).lat - (pos2).lat) * ((pos1).lat - (pos2).lat) + \
+    ((pos1).lon - (pos2).lon) * ((pos1).lon - (pos2).lon)) * \
+    (111317.099692198f * 111317.099692198f)
+
+struct bench_float_position {
+    float lat;
+    float lon;
+};
+
+// Same clusters as in cams_synthetic_db.py
+static const struct gnss_position bench_edge_positions[] = {
+    {78200000, 15600000},
+    {-17800000, 179950000},
+    {65800000, -179900000},
+};
+
+static const struct cams_db_header *bench_header;
+static struct bench_packed_camera *bench_packed_cameras;
+static const int32_t *bench_lat;
+static const int32_t *bench_lon;
+static const uint8_t *bench_direction;
+static size_t bench_camera_count;
+
+static struct gnss_position bench_queries[BENCH_QUERIES];
+static uint16_t bench_courses[BENCH_QUERIES];
+static struct bench_float_position bench_float_queries[BENCH_QUERIES];
+
+// Keeps the compiler from dropping the results
+static volatile uint32_t bench_sink;
+
+static int32_t bench_offset(int32_t max)
+{
+    return (int32_t)(bench_random() % (2 * (uint32_t)max + 1)) - max;
+}
+
+static int32_t bench_wrap_lon(int32_t lon)
+{
+    return lon > 180000000 ? lon - 360000000 : (lon < -180000000 ? lon + 360000000 : lon);
+}
+
+// Flash per camera of every section, padding and the grid cells included, against the packed struct
+static void bench_print_flash(const struct cams_db_header *header)
+{
+    const struct {
+        const char *name;
+        uint32_t offset;
+    } sections[] = {
+        {"lat", header->lat_offset},
+        {"lon", header->lon_offset},
+        {"limit", header->limit_offset},
+        {"direction", header->direction_offset},
+        {"grid keys", header->grid_keys_offset},
+        {"grid offsets", header->grid_offsets_offset},
+        {"k-d tree", header->kdtree_offset},
+    };
+    const size_t count = sizeof(sections) / sizeof(sections[0]);
+    const double cameras = (double)header->camera_count;
+
+    printf("  flash per camera:");
+    for (size_t i = 0; i < count; i++) {
+        const uint32_t end = i + 1 < count ? sections[i + 1].offset : header->total_size;
+        printf(" %s %.2f,", sections[i].name, (end - sections[i].offset) / cameras);
+    }
+    printf(" total %.2f bytes (packed floats: %zu bytes, list only %.2f)\n", header->total_size / cameras,
+           sizeof(struct bench_packed_camera), (header->direction_offset - header->lat_offset) / cameras);
+}
+
+static bool bench_load(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        perror(path);
+        return false;
+    }
+
+    memset(&host_flash[CAMS_DB_FLASH_OFFSET], 0xFF, CAMS_DB_SLOT_SIZE * CAMS_DB_SLOT_COUNT);
+    size_t length = fread(&host_flash[CAMS_DB_FLASH_OFFSET], 1, CAMS_DB_SLOT_SIZE, file);
+    fclose(file);
+    if (length < sizeof(struct cams_db_header) || cams_init() == false) {
+        fprintf(stderr, "%s: not a valid camera database\n", path);
+        return false;
+    }
+
+    const struct cams_db_header *header = (const struct cams_db_header *)&host_flash[CAMS_DB_FLASH_OFFSET];
+    bench_header = header;
+    bench_lat = (const int32_t *)((const uint8_t *)header + header->lat_offset);
+    bench_lon = (const int32_t *)((const uint8_t *)header + header->lon_offset);
+    bench_direction = (const uint8_t *)header + header->direction_offset;
+    bench_camera_count = header->camera_count;
+    const uint8_t *limit = (const uint8_t *)header + header->limit_offset;
+
+    free(bench_packed_cameras);
+    bench_packed_cameras = malloc(bench_camera_count * sizeof(*bench_packed_cameras));
+    assert(bench_packed_cameras);
+    for (size_t i = 0; i < bench_camera_count; i++)
+        bench_packed_cameras[i] = (struct bench_packed_camera){bench_lat[i] * 1e-6f, bench_lon[i] * 1e-6f, limit[i]};
+    return true;
+}
+
+// Every other query close to a camera, the rest anywhere over the area of the cities. Consecutive
+// queries are far apart, so every cached lookup refreshes the cache.
+static void bench_generate_queries(void)
+{
+    for (size_t i = 0; i < BENCH_QUERIES; i++) {
+        struct gnss_position *pos = &bench_queries[i];
+        if (i < BENCH_EDGE_QUERIES * sizeof(bench_edge_positions) / sizeof(bench_edge_positions[0])) {
+            *pos = bench_edge_positions[i % (sizeof(bench_edge_positions) / sizeof(bench_edge_positions[0]))];
+            pos->lat += bench_offset(30000);
+            pos->lon = bench_wrap_lon(pos->lon + bench_offset(100000));
+        } else if (i % 2 == 0) {
+            const size_t id = bench_random() % bench_camera_count;
+            pos->lat = bench_lat[id] + bench_offset(20000);
+            pos->lon = bench_wrap_lon(bench_lon[id] + bench_offset(20000));
+        } else {
+            pos->lat = 35000000 + (int32_t)(bench_random() % 35000000);
+            pos->lon = -10000000 + (int32_t)(bench_random() % 50000000);
+        }
+        bench_float_queries[i] = (struct bench_float_position){pos->lat * 1e-6f, pos->lon * 1e-6f};
+        bench_courses[i] = (uint16_t)(bench_random() % 360);
+    }
+}
+
+static void bench_insert(struct cams_camera_match *matches, size_t *count, uint32_t id, uint32_t dist)
+{
+    size_t i = *count < BENCH_MAX_CAMERAS ? (*count)++ : BENCH_MAX_CAMERAS - 1;
+    while (i > 0 && matches[i - 1].distance_squared_in_meters > dist) {
+        matches[i] = matches[i - 1];
+        i--;
+    }
+    matches[i].cam.id = id;
+    matches[i].distance_squared_in_meters = dist;
+}
+
+// Whether a camera at the squared distance passes the heading cone of cams_ahead_within_radius()
+static bool bench_in_cone(const struct gnss_position *pos, uint16_t course_deg, size_t id, uint32_t dist)
+{
+    if (bench_direction[id] != CAMS_DB_DIRECTION_UNKNOWN) {
+        int32_t diff = abs((int32_t)bench_direction[id] * 2 - course_deg);
+        if ((diff > 180 ? 360 - diff : diff) > BENCH_CONE_DIRECTION_TOLERANCE_DEG)
+            return false;
+    }
+    if (dist < BENCH_CONE_MIN_DISTANCE_IN_METERS * BENCH_CONE_MIN_DISTANCE_IN_METERS)
+        return true;
+
+    const struct gnss_position cam_pos = {bench_lat[id], bench_lon[id]};
+    int32_t east, north;
+    gnss_offset_in_meters(pos, &cam_pos, &east, &north);
+    const int32_t dot = east * gnss_sin_q14(course_deg * 1000000) + north * gnss_cos_q14(course_deg * 1000000);
+    const int64_t cos_half_angle = gnss_cos_q14(BENCH_CONE_HALF_ANGLE_DEG * 1000000);
+    return dot > 0 && (int64_t)dot * dot >= (int64_t)dist * cos_half_angle * cos_half_angle;
+}
+
+// The nearest cameras not farther than max_dist, with a course only the ones in its cone
+static size_t bench_linear_search(const struct gnss_position *pos, const uint16_t *course_deg, uint32_t max_dist, struct cams_camera_match *matches)
+{
+    size_t count = 0;
+
+    for (size_t id = 0; id < bench_camera_count; id++) {
+        const struct gnss_position cam_pos = {bench_lat[id], bench_lon[id]};
+        const uint32_t dist = gnss_distance_squared_in_meters(pos, &cam_pos);
+        if (count < BENCH_MAX_CAMERAS ? dist > max_dist : dist >= matches[BENCH_MAX_CAMERAS - 1].distance_squared_in_meters)
+            continue;
+        if (course_deg == NULL || bench_in_cone(pos, *course_deg, id, dist))
+            bench_insert(matches, &count, (uint32_t)id, dist);
+    }
+    return count;
+}
+
+static size_t bench_linear_within_radius(const struct gnss_position *pos, uint32_t radius_in_meters, struct cams_camera_match *matches)
+{
+    return bench_linear_search(pos, NULL, radius_in_meters * radius_in_meters, matches);
+}
+
+static uint32_t bench_run_packed_nearest(size_t query)
+{
+    const struct bench_packed_camera *nearest = NULL;
+    float min_dist = 3.4e38f;
+
+    for (size_t i = 0; i < bench_camera_count; i++) {
+        const struct bench_float_position cam_pos = {bench_packed_cameras[i].lat, bench_packed_cameras[i].lon};
+        const float dist = GNSS_DISTANCE_SQUARED_IN_METERS(cam_pos, bench_float_queries[query]);
+        if (dist < min_dist) {
+            min_dist = dist;
+            nearest = &bench_packed_cameras[i];
+        }
+    }
+    return nearest ? nearest->limit : 0;
+}
+
+static uint32_t bench_run_linear(size_t query)
+{
+    struct cams_camera_match matches[BENCH_MAX_CAMERAS];
+    return (uint32_t)bench_linear_within_radius(&bench_queries[query], BENCH_RADIUS_IN_METERS, matches);
+}
+
+static uint32_t bench_run_grid(size_t query)
+{
+    struct cams_camera_match matches[BENCH_MAX_CAMERAS];
+    return (uint32_t)cams_within_radius(&bench_queries[query], BENCH_CACHED_RADIUS_IN_METERS, matches, BENCH_MAX_CAMERAS);
+}
+
+static uint32_t bench_run_grid_uncached(size_t query)
+{
+    struct cams_camera_match matches[BENCH_MAX_CAMERAS];
+    return (uint32_t)cams_within_radius(&bench_queries[query], BENCH_RADIUS_IN_METERS, matches, BENCH_MAX_CAMERAS);
+}
+
+static uint32_t bench_run_grid_cone(size_t query)
+{
+    struct cams_camera_match matches[BENCH_MAX_CAMERAS];
+    return (uint32_t)cams_ahead_within_radius(&bench_queries[query], bench_courses[query], BENCH_RADIUS_IN_METERS, matches, BENCH_MAX_CAMERAS);
+}
+
+static uint32_t bench_run_kdtree(size_t query)
+{
+    struct cams_camera_match matches[BENCH_MAX_CAMERAS];
+    return (uint32_t)cams_k_nearest(&bench_queries[query], BENCH_MAX_CAMERAS, matches);
+}
+
+static void bench_run_queries(void *context)
+{
+    uint32_t (*run)(size_t query) = *(uint32_t (**)(size_t))context;
+    uint32_t sink = 0;
+    for (size_t i = 0; i < BENCH_QUERIES; i++)
+        sink += run(i);
+    bench_sink += sink;
+}
+
+// Linear scans also report their time per camera scanned
+static void bench_run(const char *name, uint32_t (*run)(size_t query), bool linear)
+{
+    uint32_t runs;
+    const double elapsed = bench_repeat(bench_run_queries, &run, 1, &runs);
+    const double calls = (double)runs * BENCH_QUERIES;
+
+    printf("  %-36s %10.2f us/query", name, elapsed * 1e6 / calls);
+    if (linear)
+        printf(" %6.2f ns/camera", elapsed * 1e9 / calls / (double)bench_camera_count);
+    printf("\n");
+}
+
+static bool bench_same_distances(const struct cams_camera_match *a, size_t a_count, const struct cams_camera_match *b, size_t b_count)
+{
+    if (a_count != b_count)
+        return false;
+    for (size_t i = 0; i < a_count; i++) {
+        if (a[i].distance_squared_in_meters != b[i].distance_squared_in_meters)
+            return false;
+    }
+    return true;
+}
+
+// The grid, the cache and the k-d tree must find what the linear scan finds, with and without the
+// heading cone. Ties may come in another order.
+static bool bench_check(void)
+{
+    size_t mismatches = 0;
+    size_t found = 0;
+
+    for (size_t i = 0; i < BENCH_QUERIES; i++) {
+        const struct gnss_position *pos = &bench_queries[i];
+        const uint16_t *course = &bench_courses[i];
+        struct cams_camera_match expected[BENCH_MAX_CAMERAS], matches[BENCH_MAX_CAMERAS];
+
+        size_t expected_count = bench_linear_within_radius(pos, BENCH_RADIUS_IN_METERS, expected);
+        size_t count = cams_within_radius(pos, BENCH_RADIUS_IN_METERS, matches, BENCH_MAX_CAMERAS);
+        mismatches += bench_same_distances(expected, expected_count, matches, count) == false;
+        found += expected_count;
+
+        expected_count = bench_linear_within_radius(pos, BENCH_CACHED_RADIUS_IN_METERS, expected);
+        count = cams_within_radius(pos, BENCH_CACHED_RADIUS_IN_METERS, matches, BENCH_MAX_CAMERAS);
+        mismatches += bench_same_distances(expected, expected_count, matches, count) == false;
+
+        // The largest radius the cache claims to serve must be served from it, and be exact
+        struct cams_cache_stats before, after;
+        const uint32_t cached_radius = cams_get_cached_radius(pos);
+        cams_get_cache_stats(&before);
+        expected_count = bench_linear_within_radius(pos, cached_radius, expected);
+        count = cams_within_radius(pos, cached_radius, matches, BENCH_MAX_CAMERAS);
+        cams_get_cache_stats(&after);
+        mismatches += bench_same_distances(expected, expected_count, matches, count) == false || after.refreshes != before.refreshes;
+
+        expected_count = bench_linear_search(pos, course, BENCH_RADIUS_IN_METERS * BENCH_RADIUS_IN_METERS, expected);
+        count = cams_ahead_within_radius(pos, *course, BENCH_RADIUS_IN_METERS, matches, BENCH_MAX_CAMERAS);
+        mismatches += bench_same_distances(expected, expected_count, matches, count) == false;
+
+        expected_count = bench_linear_search(pos, course, BENCH_CACHED_RADIUS_IN_METERS * BENCH_CACHED_RADIUS_IN_METERS, expected);
+        count = cams_ahead_within_radius(pos, *course, BENCH_CACHED_RADIUS_IN_METERS, matches, BENCH_MAX_CAMERAS);
+        mismatches += bench_same_distances(expected, expected_count, matches, count) == false;
+
+        expected_count = bench_linear_search(pos, NULL, GNSS_DISTANCE_FAR - 1, expected);
+        count = cams_k_nearest(pos, BENCH_MAX_CAMERAS, matches);
+        mismatches += bench_same_distances(expected, expected_count, matches, count) == false;
+    }
+
+    printf("  checked %d queries against the linear scan: %zu cameras within %d m, %zu mismatches\n",
+           BENCH_QUERIES, found, BENCH_RADIUS_IN_METERS, mismatches);
+    return mismatches == 0;
+}
+
+int main(int argc, char **argv)
+{
+    bool check_only = argc > 1 && strcmp(argv[1], "--check") == 0;
+    if (argc < 2 + check_only) {
+        fprintf(stderr, "usage: %s [--check] cams_db.bin ...\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    bool passed = true;
+    for (int i = 1 + check_only; i < argc; i++) {
+        if (bench_load(argv[i]) == false)
+            return EXIT_FAILURE;
+
+        printf("%s: %zu cameras\n", argv[i], bench_camera_count);
+        bench_print_flash(bench_header);
+        bench_generate_queries();
+        passed &= bench_check();
+        if (check_only)
+            continue;
+
+        struct cams_cache_stats before, after;
+        bench_run("baseline: nearest, packed float scan", bench_run_packed_nearest, true);
+        bench_run("linear int32 scan", bench_run_linear, true);
+        cams_get_cache_stats(&before);
+        bench_run("grid (cache refresh)", bench_run_grid, false);
+        cams_get_cache_stats(&after);
+        bench_run("grid (3000 m, uncached)", bench_run_grid_uncached, false);
+        bench_run("grid (3000 m, heading cone)", bench_run_grid_cone, false);
+        bench_run("k-d tree (32 nearest)", bench_run_kdtree, false);
+        printf("  grid lookups: %u refreshes, %u cache hits\n", after.refreshes - before.refreshes, after.hits - before.hits);
+    }
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
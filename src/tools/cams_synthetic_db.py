@@ -0,0 +1,49 @@
+# Synthetic camera database for cams_bench, packed by fetch.py like the real one.
+# Most cameras are clustered around cities like on the map, a few sit at high latitudes and
+# on the antimeridian where the grid search has to widen or wrap around.
+import os
+import random
+import sys
+
+sys.path.insert(0, os.path.join(os.path.dirname(os.path.abspath(__file__)), '..', '..', 'scripts', 'fetch_cameras'))
+import fetch
+
+CITIES = 200
+# Degrees around the city center the cameras spread over
+CITY_RADIUS = 0.3
+EDGE_CLUSTERS = [
+    (78.2, 15.6),    # Longyearbyen
+    (-17.8, 179.95), # Fiji, across the antimeridian
+    (65.8, -179.9),  # Chukotka, both
+]
+LIMITS = [30, 40, 50, 60, 70, 80, 90, 100, 110, 120, 130]
+
+def generate_cameras(count):
+    rand = random.Random(count)
+    cities = [(rand.uniform(35.0, 60.0), rand.uniform(-10.0, 40.0)) for _ in range(CITIES)]
+    cameras = []
+    for i in range(count):
+        if i % 100 == 0:
+            lat, lon = EDGE_CLUSTERS[(i // 100) % len(EDGE_CLUSTERS)]
+        elif i % 10 == 0:
+            lat, lon = rand.uniform(35.0, 70.0), rand.uniform(-10.0, 40.0)
+        else:
+            lat, lon = rand.choice(cities)
+        lat = max(min(lat + rand.gauss(0.0, CITY_RADIUS / 2), 89.9), -89.9)
+        lon = lon + rand.gauss(0.0, CITY_RADIUS / 2)
+        lon = (lon + 180.0) % 360.0 - 180.0
+        direction = rand.uniform(0.0, 360.0) if rand.random() < 0.5 else None
+        cameras.append({'id': i, 'lat': lat, 'lon': lon, 'limit': rand.choice(LIMITS), 'direction': direction})
+    return cameras
+
+def main(count, output_file):
+    image = fetch.pack_db(generate_cameras(count), 1)
+    with open(output_file, 'wb') as f:
+        f.write(image)
+
+if __name__ == "__main__":
+    if len(sys.argv) != 3:
+        print("Usage: python3 cams_synthetic_db.py <camera_count> <output_bin_file>")
+        sys.exit(1)
+
+    main(int(sys.argv[1]), sys.argv[2])
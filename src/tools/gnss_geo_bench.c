@@ -0,0 +1,105 @@
+#include <math.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "gnss/gnss_geo.h"
+
+#include "bench.h"
+
+// Every variant runs over the pairs at least BENCH_MIN_SECONDS
+#define BENCH_PAIRS 4096
+// Pairs up to this far apart, the distances the cameras are looked up at
+#define BENCH_MAX_DELTA_E6 45000
+
+// Positions and the distance macro before the integer geo math, degrees in floats. It leaves
+// out cos() of the latitude, so it is only right on the equator.
+struct bench_float_position {
+    float lat;
+    float lon;
+};
+
+#define GNSS_DISTANCE_SQUARED_IN_METERS(pos1, pos2) \
+    (((pos1).lat - (pos2).lat) * ((pos1).lat - (pos2).lat) + \
+    ((pos1).lon - (pos2).lon) * ((pos1).lon - (pos2).lon)) * \
+    (111317.099692198f * 111317.099692198f)
+
+static struct gnss_position bench_pos1[BENCH_PAIRS];
+static struct gnss_position bench_pos2[BENCH_PAIRS];
+static struct bench_float_position bench_float_pos1[BENCH_PAIRS];
+static struct bench_float_position bench_float_pos2[BENCH_PAIRS];
+
+// Keeps the compiler from dropping the distances
+static volatile double bench_sink;
+
+static int32_t bench_delta(void)
+{
+    return (int32_t)(bench_random() % (2 * BENCH_MAX_DELTA_E6 + 1)) - BENCH_MAX_DELTA_E6;
+}
+
+static void bench_generate(void)
+{
+    for (size_t i = 0; i < BENCH_PAIRS; i++) {
+        bench_pos1[i].lat = (int32_t)(bench_random() % 140000000) - 70000000;
+        bench_pos1[i].lon = (int32_t)(bench_random() % 359000000) - 179500000;
+        bench_pos2[i].lat = bench_pos1[i].lat + bench_delta();
+        bench_pos2[i].lon = bench_pos1[i].lon + bench_delta();
+
+        bench_float_pos1[i] = (struct bench_float_position){bench_pos1[i].lat * 1e-6f, bench_pos1[i].lon * 1e-6f};
+        bench_float_pos2[i] = (struct bench_float_position){bench_pos2[i].lat * 1e-6f, bench_pos2[i].lon * 1e-6f};
+    }
+}
+
+static double bench_float_macro(void)
+{
+    float sum = 0.0f;
+    for (size_t i = 0; i < BENCH_PAIRS; i++)
+        sum += GNSS_DISTANCE_SQUARED_IN_METERS(bench_float_pos1[i], bench_float_pos2[i]);
+    return sum;
+}
+
+static double bench_integer(void)
+{
+    uint64_t sum = 0;
+    for (size_t i = 0; i < BENCH_PAIRS; i++)
+        sum += gnss_distance_squared_in_meters(&bench_pos1[i], &bench_pos2[i]);
+    return (double)sum;
+}
+
+static double bench_integer_offset(void)
+{
+    int64_t sum = 0;
+    for (size_t i = 0; i < BENCH_PAIRS; i++) {
+        int32_t east, north;
+        if (gnss_offset_in_meters(&bench_pos1[i], &bench_pos2[i], &east, &north))
+            sum += east + north;
+    }
+    return (double)sum;
+}
+
+static void bench_run_pairs(void *context)
+{
+    double (*run)(void) = *(double (**)(void))context;
+    bench_sink = run();
+}
+
+static void bench_run(const char *name, double (*run)(void))
+{
+    uint32_t runs;
+    const double elapsed = bench_repeat(bench_run_pairs, &run, 1, &runs);
+
+    printf("  %-34s %7.2f ns/call\n", name, elapsed * 1e9 / ((double)runs * BENCH_PAIRS));
+}
+
+int main(void)
+{
+    bench_generate();
+
+    // The host has an FPU, on the M0+ every float operation of the macro is a soft-float library call
+    printf("%d position pairs up to %d microdegrees apart\n", BENCH_PAIRS, BENCH_MAX_DELTA_E6);
+    bench_run("GNSS_DISTANCE_SQUARED_IN_METERS", bench_float_macro);
+    bench_run("gnss_distance_squared_in_meters()", bench_integer);
+    bench_run("gnss_offset_in_meters()", bench_integer_offset);
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,107 @@
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "gnss/gnss_geo.h"
+
+#include "bench.h"
+
+// Mean Earth radius, the one GNSS_METERS_PER_E6_Q14 is derived from
+#define CHECK_EARTH_RADIUS_M 6371008.8
+#define CHECK_PAIRS_PER_BAND 200000
+// Distances the cameras are looked up at, from standing next to one to the cache radius
+#define CHECK_MIN_DISTANCE_M 10.0
+#define CHECK_MAX_DISTANCE_M 5000.0
+// Rounding both offsets to meters plus the flat Earth approximation, which grows with the latitude
+#define CHECK_MAX_ERROR_M        1.0
+#define CHECK_MAX_RELATIVE_ERROR 0.002
+
+#define CHECK_DEG_TO_RAD (3.14159265358979323846 / 180.0)
+
+struct check_band {
+    double min_lat;
+    double max_lat;
+};
+
+// Latitudes of the roads, split so a regression at high latitudes doesn't hide in the average
+static const struct check_band check_bands[] = {
+    {0.0, 30.0},
+    {30.0, 50.0},
+    {50.0, 65.0},
+    {65.0, 80.0},
+};
+
+static double check_haversine_m(double lat1, double lon1, double lat2, double lon2)
+{
+    const double dlat = (lat2 - lat1) * CHECK_DEG_TO_RAD;
+    const double dlon = (lon2 - lon1) * CHECK_DEG_TO_RAD;
+    const double a = sin(dlat / 2) * sin(dlat / 2) + cos(lat1 * CHECK_DEG_TO_RAD) * cos(lat2 * CHECK_DEG_TO_RAD) * sin(dlon / 2) * sin(dlon / 2);
+    return 2 * CHECK_EARTH_RADIUS_M * asin(sqrt(a));
+}
+
+// Great circle destination, in degrees
+static void check_destination(double lat, double lon, double bearing, double distance_m, double *lat2, double *lon2)
+{
+    const double phi = lat * CHECK_DEG_TO_RAD;
+    const double theta = bearing * CHECK_DEG_TO_RAD;
+    const double delta = distance_m / CHECK_EARTH_RADIUS_M;
+    const double phi2 = asin(sin(phi) * cos(delta) + cos(phi) * sin(delta) * cos(theta));
+    const double lambda = atan2(sin(theta) * sin(delta) * cos(phi), cos(delta) - sin(phi) * sin(phi2));
+    *lat2 = phi2 / CHECK_DEG_TO_RAD;
+    *lon2 = lon + lambda / CHECK_DEG_TO_RAD;
+    if (*lon2 > 180.0)
+        *lon2 -= 360.0;
+    else if (*lon2 < -180.0)
+        *lon2 += 360.0;
+}
+
+static bool check_band(const struct check_band *band)
+{
+    double max_error = 0.0, max_relative = 0.0, sum_error = 0.0;
+    size_t failed = 0;
+
+    for (size_t i = 0; i < CHECK_PAIRS_PER_BAND; i++) {
+        const double lat = bench_uniform(band->min_lat, band->max_lat) * (bench_random() % 2 ? 1 : -1);
+        const double lon = bench_uniform(-180.0, 180.0);
+        double lat2, lon2;
+        check_destination(lat, lon, bench_uniform(0.0, 360.0), bench_uniform(CHECK_MIN_DISTANCE_M, CHECK_MAX_DISTANCE_M), &lat2, &lon2);
+
+        const struct gnss_position pos1 = {.lat = (int32_t)lround(lat * 1e6), .lon = (int32_t)lround(lon * 1e6)};
+        const struct gnss_position pos2 = {.lat = (int32_t)lround(lat2 * 1e6), .lon = (int32_t)lround(lon2 * 1e6)};
+        // The reference gets the same microdegrees, their rounding isn't the function's error
+        const double reference = check_haversine_m(pos1.lat * 1e-6, pos1.lon * 1e-6, pos2.lat * 1e-6, pos2.lon * 1e-6);
+
+        const uint32_t distance_squared = gnss_distance_squared_in_meters(&pos1, &pos2);
+        if (distance_squared == GNSS_DISTANCE_FAR) {
+            failed++;
+            continue;
+        }
+
+        const double error = fabs(sqrt((double)distance_squared) - reference);
+        sum_error += error;
+        if (error > max_error)
+            max_error = error;
+        if (error - CHECK_MAX_ERROR_M > max_relative * reference)
+            max_relative = (error - CHECK_MAX_ERROR_M) / reference;
+        if (error > CHECK_MAX_ERROR_M + CHECK_MAX_RELATIVE_ERROR * reference)
+            failed++;
+    }
+
+    printf("  |lat| %4.0f-%2.0f deg: mean error %6.3f m, max %6.3f m, max past %.0f m %.3f %%, %zu over the bound\n",
+           band->min_lat, band->max_lat, sum_error / CHECK_PAIRS_PER_BAND, max_error, CHECK_MAX_ERROR_M, max_relative * 100.0, failed);
+    return failed == 0;
+}
+
+int main(void)
+{
+    printf("gnss_distance_squared_in_meters() against haversine, %.0f-%.0f m, bound %.0f m + %.1f %%\n",
+           CHECK_MIN_DISTANCE_M, CHECK_MAX_DISTANCE_M, CHECK_MAX_ERROR_M, CHECK_MAX_RELATIVE_ERROR * 100.0);
+
+    bool passed = true;
+    for (size_t i = 0; i < sizeof(check_bands) / sizeof(check_bands[0]); i++)
+        passed &= check_band(&check_bands[i]);
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
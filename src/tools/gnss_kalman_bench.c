@@ -0,0 +1,332 @@
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gnss/gnss_kalman.h"
+
+#include "bench.h"
+
+// Simulated drives at the 10 Hz of the receiver
+#define BENCH_FIX_INTERVAL_MS 100
+#define BENCH_DRIVE_FIXES     6000
+// Meters per degree of latitude on the sphere gnss_geo.h uses
+#define BENCH_METERS_PER_DEG  111194.93
+#define BENCH_DEG_TO_RAD      (3.14159265358979323846 / 180.0)
+
+// Receiver error: a slow wander like the one of real receivers plus white noise, per axis
+#define BENCH_WANDER_SIGMA_M  2.0
+#define BENCH_WANDER_TAU_S    20.0
+#define BENCH_WHITE_SIGMA_M   1.0
+#define BENCH_SPEED_SIGMA_M_S 0.1
+#define BENCH_COURSE_SIGMA_DEG 1.0
+#define BENCH_HDOP_E2         100
+
+// Multipath: jumps of this many meters lasting a few fixes, every BENCH_MULTIPATH_INTERVAL fixes
+#define BENCH_MULTIPATH_MIN_M    40.0
+#define BENCH_MULTIPATH_MAX_M    80.0
+#define BENCH_MULTIPATH_FIXES    20
+#define BENCH_MULTIPATH_INTERVAL 300
+
+// The receiver jumps for good at this fix in the relocation drive
+#define BENCH_RELOCATION_FIX     3000
+#define BENCH_RELOCATION_M       2000.0
+// The filter must follow within its 3 s of rejections and a second
+#define BENCH_RELOCATION_MAX_MS  4000
+
+enum bench_outliers {
+    BENCH_OUTLIERS_NONE,
+    BENCH_OUTLIERS_MULTIPATH,
+    // Single fixes at 0/0, on the other side of the world and tens to hundreds of km off, and
+    // single absurd speeds
+    BENCH_OUTLIERS_FAR,
+    BENCH_OUTLIERS_RELOCATION,
+};
+
+struct bench_drive {
+    const char *name;
+    double lat;
+    double lon;
+    enum bench_outliers outliers;
+    // Limits of the check, in meters. The wander of the receiver is as slow as the car, no filter
+    // of single fixes removes it, so the filtered error only has to stay below the raw one.
+    double max_rms_m;
+    double max_error_m;
+};
+
+static const struct bench_drive bench_drives[] = {
+    {"Munich", 48.137, 11.575, BENCH_OUTLIERS_NONE, 3.5, 10.0},
+    {"Munich, multipath", 48.137, 11.575, BENCH_OUTLIERS_MULTIPATH, 3.5, 15.0},
+    {"Munich, far outliers", 48.137, 11.575, BENCH_OUTLIERS_FAR, 3.5, 10.0},
+    {"Munich, relocation", 48.137, 11.575, BENCH_OUTLIERS_RELOCATION, 3.5, 10.0},
+    {"Fiji, antimeridian", -17.8, 179.97, BENCH_OUTLIERS_NONE, 3.5, 10.0},
+    {"Longyearbyen", 78.2, 15.6, BENCH_OUTLIERS_MULTIPATH, 3.5, 15.0},
+};
+
+struct bench_fix {
+    struct gnss_position truth;
+    struct gnss_position pos;
+    uint32_t speed_knots_e3;
+    uint32_t course_deg_e2;
+    uint32_t time_ms;
+    bool outlier;
+};
+
+static struct bench_fix bench_fixes[BENCH_DRIVE_FIXES];
+
+static volatile int32_t bench_sink;
+
+static double bench_gauss(double sigma)
+{
+    // Box-Muller
+    const double u1 = (bench_random() + 1.0) / 4294967297.0;
+    const double u2 = bench_random() / 4294967296.0;
+    return sigma * sqrt(-2.0 * log(u1)) * cos(2.0 * 3.14159265358979323846 * u2);
+}
+
+static double bench_wrap_lon(double lon)
+{
+    return lon >= 180.0 ? lon - 360.0 : lon < -180.0 ? lon + 360.0 : lon;
+}
+
+static int32_t bench_e6(double deg)
+{
+    return (int32_t)lround(deg * 1e6);
+}
+
+// Move by east and north meters
+static void bench_move(double *lat, double *lon, double east_m, double north_m)
+{
+    *lon = bench_wrap_lon(*lon + east_m / (BENCH_METERS_PER_DEG * cos(*lat * BENCH_DEG_TO_RAD)));
+    *lat += north_m / BENCH_METERS_PER_DEG;
+}
+
+static double bench_error_m(const struct gnss_position *pos, const struct gnss_position *truth)
+{
+    double dlon = (pos->lon - truth->lon) * 1e-6;
+    dlon = dlon > 180.0 ? dlon - 360.0 : dlon < -180.0 ? dlon + 360.0 : dlon;
+    const double east_m = dlon * BENCH_METERS_PER_DEG * cos(truth->lat * 1e-6 * BENCH_DEG_TO_RAD);
+    const double north_m = (pos->lat - truth->lat) * 1e-6 * BENCH_METERS_PER_DEG;
+    return sqrt(east_m * east_m + north_m * north_m);
+}
+
+// A drive with stops, speeds up to 30 m/s and curves, and what the receiver reports on it
+static void bench_generate(const struct bench_drive *drive)
+{
+    const double dt = BENCH_FIX_INTERVAL_MS / 1000.0;
+    const double wander_decay = exp(-dt / BENCH_WANDER_TAU_S);
+    const double wander_sigma = BENCH_WANDER_SIGMA_M * sqrt(1.0 - wander_decay * wander_decay);
+
+    double lat = drive->lat;
+    double lon = drive->lon;
+    double speed = 0.0;
+    double target_speed = 15.0;
+    double heading = bench_uniform(0.0, 360.0);
+    double turn_rate = 0.0;
+    double wander_east = 0.0;
+    double wander_north = 0.0;
+    double multipath_east = 0.0;
+    double multipath_north = 0.0;
+
+    for (uint32_t i = 0; i < BENCH_DRIVE_FIXES; i++) {
+        struct bench_fix *fix = &bench_fixes[i];
+
+        if (i % 200 == 0)
+            target_speed = bench_random() % 4 == 0 ? 0.0 : bench_uniform(5.0, 30.0);
+        speed += fmax(fmin(target_speed - speed, 2.0 * dt), -3.0 * dt);
+        turn_rate = fmax(fmin(turn_rate + bench_gauss(1.0), 10.0), -10.0);
+        if (speed > 0.5)
+            heading = fmod(heading + turn_rate * dt + 360.0, 360.0);
+        bench_move(&lat, &lon, speed * dt * sin(heading * BENCH_DEG_TO_RAD), speed * dt * cos(heading * BENCH_DEG_TO_RAD));
+
+        wander_east = wander_decay * wander_east + bench_gauss(wander_sigma);
+        wander_north = wander_decay * wander_north + bench_gauss(wander_sigma);
+        double east_m = wander_east + bench_gauss(BENCH_WHITE_SIGMA_M);
+        double north_m = wander_north + bench_gauss(BENCH_WHITE_SIGMA_M);
+
+        fix->outlier = false;
+        if (drive->outliers == BENCH_OUTLIERS_MULTIPATH) {
+            if (i % BENCH_MULTIPATH_INTERVAL == BENCH_MULTIPATH_INTERVAL / 2) {
+                const double distance = bench_uniform(BENCH_MULTIPATH_MIN_M, BENCH_MULTIPATH_MAX_M);
+                const double bearing = bench_uniform(0.0, 360.0) * BENCH_DEG_TO_RAD;
+                multipath_east = distance * sin(bearing);
+                multipath_north = distance * cos(bearing);
+            }
+            if (i % BENCH_MULTIPATH_INTERVAL >= BENCH_MULTIPATH_INTERVAL / 2 &&
+                i % BENCH_MULTIPATH_INTERVAL < BENCH_MULTIPATH_INTERVAL / 2 + BENCH_MULTIPATH_FIXES) {
+                east_m += multipath_east;
+                north_m += multipath_north;
+                fix->outlier = true;
+            }
+        } else if (drive->outliers == BENCH_OUTLIERS_RELOCATION && i == BENCH_RELOCATION_FIX) {
+            // The receiver was off by kilometers and corrects itself, the filter has to give in and follow
+            bench_move(&lat, &lon, BENCH_RELOCATION_M, 0.0);
+        }
+
+        fix->truth.lat = bench_e6(lat);
+        fix->truth.lon = bench_e6(lon);
+        double fix_lat = lat;
+        double fix_lon = lon;
+        bench_move(&fix_lat, &fix_lon, east_m, north_m);
+        fix->pos.lat = bench_e6(fix_lat);
+        fix->pos.lon = bench_e6(fix_lon);
+
+        if (drive->outliers == BENCH_OUTLIERS_FAR && i % 500 == 250) {
+            static const struct gnss_position far[] = {
+                {0, 0},
+                {-48137000, -168425000},
+                {48137000 + 1800000, 11575000},
+                {48137000 - 500000, 11575000},
+                {48137000, 11575000 - 3000000},
+                {89999999, 179999999},
+            };
+            fix->pos = far[(i / 500) % (sizeof(far) / sizeof(far[0]))];
+            fix->outlier = true;
+        }
+
+        const double reported_speed = fmax(speed + bench_gauss(BENCH_SPEED_SIGMA_M_S), 0.0);
+        fix->speed_knots_e3 = (uint32_t)lround(reported_speed * 3600.0 / 1852.0 * 1000.0);
+        fix->course_deg_e2 = (uint32_t)lround(fmod(heading + bench_gauss(BENCH_COURSE_SIGMA_DEG) + 360.0, 360.0) * 100.0) % 36000;
+        fix->time_ms = 1000000 + i * BENCH_FIX_INTERVAL_MS;
+        // A speed no car drives, 0xffffffff e-3 knots is what a corrupted field could parse to
+        if (drive->outliers == BENCH_OUTLIERS_FAR && i % 500 == 400)
+            fix->speed_knots_e3 = UINT32_MAX;
+    }
+}
+
+static int bench_compare_doubles(const void *a, const void *b)
+{
+    const double x = *(const double *)a;
+    const double y = *(const double *)b;
+    return (x > y) - (x < y);
+}
+
+// Errors of the receiver and the filter against the truth, outliers left out of the receiver's
+static bool bench_accuracy(const struct bench_drive *drive)
+{
+    static double errors[BENCH_DRIVE_FIXES];
+    struct gnss_kalman kalman;
+    gnss_kalman_reset(&kalman);
+
+    double raw_sum = 0.0;
+    uint32_t raw_count = 0;
+    double filtered_sum = 0.0;
+    uint32_t within_2_sigma = 0;
+    uint32_t outliers = 0;
+    uint32_t outliers_rejected = 0;
+    uint32_t inliers_rejected = 0;
+    uint32_t followed_ms = 0;
+    bool followed = false;
+    uint32_t counted = 0;
+
+    for (uint32_t i = 0; i < BENCH_DRIVE_FIXES; i++) {
+        const struct bench_fix *fix = &bench_fixes[i];
+        const bool accepted = gnss_kalman_update(&kalman, &fix->pos, fix->speed_knots_e3, fix->course_deg_e2, BENCH_HDOP_E2, fix->time_ms);
+        struct gnss_position filtered;
+        gnss_kalman_get_position(&kalman, &filtered);
+
+        if (fix->outlier) {
+            outliers++;
+            outliers_rejected += accepted == false;
+        } else if (accepted == false) {
+            inliers_rejected++;
+        }
+
+        const double error = bench_error_m(&filtered, &fix->truth);
+        if (drive->outliers == BENCH_OUTLIERS_RELOCATION && i >= BENCH_RELOCATION_FIX && followed == false) {
+            if (error < drive->max_error_m) {
+                followed = true;
+                followed_ms = fix->time_ms - bench_fixes[BENCH_RELOCATION_FIX].time_ms;
+            }
+            continue;
+        }
+        // The first seconds only show how fast the filter settles
+        if (i < 50)
+            continue;
+
+        if (fix->outlier == false) {
+            const double raw_error = bench_error_m(&fix->pos, &fix->truth);
+            raw_sum += raw_error * raw_error;
+            raw_count++;
+        }
+        filtered_sum += error * error;
+        within_2_sigma += error * 100.0 <= 2.0 * gnss_kalman_get_error_cm(&kalman);
+        errors[counted++] = error;
+    }
+
+    qsort(errors, counted, sizeof(errors[0]), bench_compare_doubles);
+    const double raw_rms = sqrt(raw_sum / raw_count);
+    const double filtered_rms = sqrt(filtered_sum / counted);
+    const double p95 = errors[counted * 95 / 100];
+    const double max = errors[counted - 1];
+
+    printf("  %-22s %6.2f m %6.2f m %6.2f m %7.2f m %5.1f %% %4u/%-4u %4u", drive->name, raw_rms, filtered_rms, p95, max,
+           within_2_sigma * 100.0 / counted, outliers_rejected, outliers, inliers_rejected);
+    if (drive->outliers == BENCH_OUTLIERS_RELOCATION)
+        printf("  followed after %u ms", followed_ms);
+    printf("\n");
+
+    bool passed = filtered_rms < raw_rms && filtered_rms <= drive->max_rms_m && max <= drive->max_error_m;
+    if (drive->outliers == BENCH_OUTLIERS_FAR)
+        passed &= outliers_rejected == outliers;
+    if (drive->outliers == BENCH_OUTLIERS_RELOCATION)
+        passed &= followed && followed_ms <= BENCH_RELOCATION_MAX_MS;
+    return passed;
+}
+
+static void bench_time_drive(void *context)
+{
+    struct gnss_kalman *kalman = context;
+    int32_t sink = 0;
+
+    gnss_kalman_reset(kalman);
+    for (uint32_t i = 0; i < BENCH_DRIVE_FIXES; i++) {
+        const struct bench_fix *fix = &bench_fixes[i];
+        struct gnss_position filtered;
+        gnss_kalman_update(kalman, &fix->pos, fix->speed_knots_e3, fix->course_deg_e2, BENCH_HDOP_E2, fix->time_ms);
+        gnss_kalman_get_position(kalman, &filtered);
+        sink += filtered.lat + (int32_t)gnss_kalman_get_error_cm(kalman);
+    }
+    bench_sink = sink;
+}
+
+static void bench_time(const struct bench_drive *drive)
+{
+    struct gnss_kalman kalman;
+    uint32_t runs;
+    const double elapsed = bench_repeat(bench_time_drive, &kalman, 1, &runs);
+
+    printf("  %-22s %8.1f ns/fix\n", drive->name, elapsed * 1e9 / ((double)runs * BENCH_DRIVE_FIXES));
+}
+
+int main(int argc, char **argv)
+{
+    const bool check_only = argc > 1 && strcmp(argv[1], "--check") == 0;
+    if (argc > 1 + check_only) {
+        fprintf(stderr, "usage: %s [--check]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    printf("Error against the truth over %u fixes at %u ms, filter with the position, speed and course of the receiver\n",
+           BENCH_DRIVE_FIXES, BENCH_FIX_INTERVAL_MS);
+    printf("  %-22s %8s %8s %8s %9s %7s %9s %4s\n", "drive", "raw rms", "rms", "p95", "max", "2 sigma", "outliers", "lost");
+    bool passed = true;
+    for (size_t i = 0; i < sizeof(bench_drives) / sizeof(bench_drives[0]); i++) {
+        bench_generate(&bench_drives[i]);
+        passed &= bench_accuracy(&bench_drives[i]);
+    }
+
+    if (check_only == false) {
+        printf("Filter update, position and error estimate per fix\n");
+        for (size_t i = 0; i < sizeof(bench_drives) / sizeof(bench_drives[0]); i++) {
+            bench_generate(&bench_drives[i]);
+            bench_time(&bench_drives[i]);
+        }
+    }
+
+    if (passed == false)
+        printf("FAILED\n");
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
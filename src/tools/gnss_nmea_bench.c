@@ -0,0 +1,363 @@
+#include <assert.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gnss/gnss_nmea.h"
+#include "gnss/minmea/minmea.h"
+
+#include "bench.h"
+
+// Every parser runs over a corpus at least BENCH_MIN_SECONDS and this many times
+#define BENCH_MIN_RUNS 3
+
+// Synthetic drive at the firmware fix rate, GSV comes once a second like on a module left at its defaults
+#define BENCH_SYNTHETIC_EPOCHS      36000
+#define BENCH_SYNTHETIC_FIX_RATE_HZ 10
+// Corruption of the noisy corpus, one in this many bytes
+#define BENCH_NOISE_BIT_FLIP_RATE   500
+#define BENCH_NOISE_DROP_RATE       2000
+// One in this many epochs is followed by a run of line noise without a line ending,
+// longer than the 1024 byte buffer of the line parser
+#define BENCH_NOISE_RUN_RATE        200
+#define BENCH_NOISE_RUN_LENGTH      1500
+
+// The line parser the GNSS task used before the streaming tokenizer
+#define BENCH_LINE_BUFFER_SIZE 1024
+
+struct bench_corpus {
+    const char *name;
+    char *data;
+    size_t length;
+    size_t capacity;
+};
+
+struct bench_result {
+    size_t parsed;
+    int64_t sink;
+};
+
+struct bench_parser {
+    const char *name;
+    void (*run)(const struct bench_corpus *corpus, struct bench_result *result);
+};
+
+// Keeps the compiler from dropping the decoded values
+static volatile int64_t bench_sink;
+
+static void bench_corpus_append(struct bench_corpus *corpus, const char *data, size_t length)
+{
+    if (corpus->length + length > corpus->capacity) {
+        corpus->capacity = (corpus->length + length) * 2;
+        corpus->data = realloc(corpus->data, corpus->capacity);
+        assert(corpus->data);
+    }
+    memcpy(&corpus->data[corpus->length], data, length);
+    corpus->length += length;
+}
+
+static void bench_corpus_append_sentence(struct bench_corpus *corpus, const char *body)
+{
+    uint8_t checksum = 0;
+    for (const char *ch = body; *ch; ch++)
+        checksum ^= (uint8_t)*ch;
+
+    char sentence[128];
+    int length = snprintf(sentence, sizeof(sentence), "$%s*%02X\r\n", body, checksum);
+    assert(length > 0 && (size_t)length < sizeof(sentence));
+    bench_corpus_append(corpus, sentence, (size_t)length);
+}
+
+static void bench_format_coord(char *buff, size_t size, double deg, bool lat)
+{
+    double abs_deg = deg < 0 ? -deg : deg;
+    int whole = (int)abs_deg;
+    double min = (abs_deg - whole) * 60.0;
+    snprintf(buff, size, lat ? "%02d%07.4f,%c" : "%03d%07.4f,%c", whole, min, lat ? (deg < 0 ? 'S' : 'N') : (deg < 0 ? 'W' : 'E'));
+}
+
+static void bench_generate_synthetic(struct bench_corpus *corpus)
+{
+    double lat = 45.8150;
+    double lon = 15.9819;
+    double course_deg = 30.0;
+    double speed_knots = 35.0;
+
+    for (uint32_t epoch = 0; epoch < BENCH_SYNTHETIC_EPOCHS; epoch++) {
+        uint32_t time_ms = 36000000 + epoch * (1000 / BENCH_SYNTHETIC_FIX_RATE_HZ);
+        char time[16], lat_field[24], lon_field[24], body[128];
+        snprintf(time, sizeof(time), "%02u%02u%02u.%03u", time_ms / 3600000, time_ms / 60000 % 60, time_ms / 1000 % 60, time_ms % 1000);
+        bench_format_coord(lat_field, sizeof(lat_field), lat, true);
+        bench_format_coord(lon_field, sizeof(lon_field), lon, false);
+        uint32_t satellites = 6 + bench_random() % 6;
+        uint32_t hdop_e2 = 70 + bench_random() % 80;
+
+        snprintf(body, sizeof(body), "GPGGA,%s,%s,%s,1,%02u,%u.%02u,112.4,M,42.3,M,,", time, lat_field, lon_field, satellites, hdop_e2 / 100, hdop_e2 % 100);
+        bench_corpus_append_sentence(corpus, body);
+        snprintf(body, sizeof(body), "GPGSA,A,3,04,05,09,12,24,25,29,,,,,,1.%02u,%u.%02u,1.%02u", bench_random() % 100, hdop_e2 / 100, hdop_e2 % 100, bench_random() % 100);
+        bench_corpus_append_sentence(corpus, body);
+        if (epoch % BENCH_SYNTHETIC_FIX_RATE_HZ == 0) {
+            bench_corpus_append_sentence(corpus, "GPGSV,3,1,11,04,62,277,45,05,39,057,43,09,22,316,38,12,14,190,32");
+            bench_corpus_append_sentence(corpus, "GPGSV,3,2,11,24,55,110,44,25,18,036,36,29,72,213,47,02,08,152,");
+            bench_corpus_append_sentence(corpus, "GPGSV,3,3,11,10,05,245,,17,03,091,,31,01,333,");
+        }
+        snprintf(body, sizeof(body), "GPRMC,%s,A,%s,%s,%.2f,%.2f,171026,,,A", time, lat_field, lon_field, speed_knots, course_deg);
+        bench_corpus_append_sentence(corpus, body);
+        snprintf(body, sizeof(body), "GPVTG,%.2f,T,,M,%.2f,N,%.2f,K,A", course_deg, speed_knots, speed_knots * 1.852);
+        bench_corpus_append_sentence(corpus, body);
+
+        // Wander around at city speeds
+        double step_deg = speed_knots * 0.514444 / BENCH_SYNTHETIC_FIX_RATE_HZ / 111195.0;
+        lat += step_deg * cos(course_deg * M_PI / 180.0);
+        lon += step_deg * sin(course_deg * M_PI / 180.0) / cos(lat * M_PI / 180.0);
+        course_deg += (double)(bench_random() % 200) / 100.0 - 1.0;
+        if (course_deg < 0.0)
+            course_deg += 360.0;
+        if (course_deg >= 360.0)
+            course_deg -= 360.0;
+        speed_knots = 20.0 + (double)(bench_random() % 4000) / 100.0;
+    }
+}
+
+static void bench_generate_noisy(struct bench_corpus *corpus, const struct bench_corpus *clean)
+{
+    size_t lines = 0;
+    for (size_t i = 0; i < clean->length; i++) {
+        char ch = clean->data[i];
+        if (bench_random() % BENCH_NOISE_DROP_RATE == 0)
+            continue;
+        if (bench_random() % BENCH_NOISE_BIT_FLIP_RATE == 0)
+            ch ^= (char)(1u << (bench_random() % 8));
+        bench_corpus_append(corpus, &ch, 1);
+
+        // A run of printable noise, like a receiver talking at the wrong baud rate
+        if (ch == '\n' && ++lines % BENCH_NOISE_RUN_RATE == 0) {
+            for (size_t j = 0; j < BENCH_NOISE_RUN_LENGTH; j++) {
+                char noise = (char)(' ' + bench_random() % 94);
+                bench_corpus_append(corpus, &noise, 1);
+            }
+        }
+    }
+}
+
+static void bench_load_recorded(struct bench_corpus *corpus, const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        perror(path);
+        exit(EXIT_FAILURE);
+    }
+
+    char buff[4096];
+    size_t length;
+    while ((length = fread(buff, 1, sizeof(buff), file)) > 0)
+        bench_corpus_append(corpus, buff, length);
+    fclose(file);
+}
+
+// minmea returns NaN for empty fields
+static int64_t bench_minmea_value(float value, float scale)
+{
+    return isnan(value) ? 0 : (int64_t)(value * scale);
+}
+
+// The sentences the GNSS task uses, through minmea
+static bool bench_minmea_parse(const char *sentence, int64_t *sink)
+{
+    switch (minmea_sentence_id(sentence, true)) {
+        case MINMEA_SENTENCE_RMC: {
+            struct minmea_sentence_rmc frame;
+            if (!minmea_parse_rmc(&frame, sentence))
+                return false;
+            *sink += frame.valid + bench_minmea_value(minmea_tocoord(&frame.latitude), 1e6f) + bench_minmea_value(minmea_tocoord(&frame.longitude), 1e6f)
+                   + bench_minmea_value(minmea_tofloat(&frame.speed), 1e3f) + bench_minmea_value(minmea_tofloat(&frame.course), 1e2f);
+        } break;
+        case MINMEA_SENTENCE_GGA: {
+            struct minmea_sentence_gga frame;
+            if (!minmea_parse_gga(&frame, sentence))
+                return false;
+            *sink += frame.fix_quality + frame.satellites_tracked + bench_minmea_value(minmea_tofloat(&frame.hdop), 1e2f);
+        } break;
+        case MINMEA_SENTENCE_GSA: {
+            struct minmea_sentence_gsa frame;
+            if (!minmea_parse_gsa(&frame, sentence))
+                return false;
+            *sink += frame.fix_type + bench_minmea_value(minmea_tofloat(&frame.hdop), 1e2f);
+        } break;
+        case MINMEA_SENTENCE_VTG: {
+            struct minmea_sentence_vtg frame;
+            if (!minmea_parse_vtg(&frame, sentence))
+                return false;
+            *sink += bench_minmea_value(minmea_tofloat(&frame.true_track_degrees), 1e2f) + bench_minmea_value(minmea_tofloat(&frame.speed_knots), 1e3f);
+        } break;
+        default: {
+            return false;
+        } break;
+    }
+
+    return true;
+}
+
+// The same sentences through the fixed-point parsers of the GNSS task
+static bool bench_fixed_parse(const struct gnss_nmea_sentence *sentence, int64_t *sink)
+{
+    if (gnss_nmea_sentence_is(sentence, "RMC")) {
+        struct gnss_nmea_rmc rmc;
+        if (!gnss_nmea_parse_rmc(sentence, &rmc))
+            return false;
+        *sink += rmc.valid + rmc.lat_e6 + rmc.lon_e6 + rmc.speed_knots_e3 + rmc.course_deg_e2;
+    } else if (gnss_nmea_sentence_is(sentence, "GGA")) {
+        struct gnss_nmea_gga gga;
+        if (!gnss_nmea_parse_gga(sentence, &gga))
+            return false;
+        *sink += gga.fix_quality + gga.satellites + gga.hdop_e2;
+    } else if (gnss_nmea_sentence_is(sentence, "GSA")) {
+        struct gnss_nmea_gsa gsa;
+        if (!gnss_nmea_parse_gsa(sentence, &gsa))
+            return false;
+        *sink += gsa.fix_type + gsa.hdop_e2;
+    } else if (gnss_nmea_sentence_is(sentence, "VTG")) {
+        struct gnss_nmea_vtg vtg;
+        if (!gnss_nmea_parse_vtg(sentence, &vtg))
+            return false;
+        *sink += vtg.course_deg_e2 + vtg.speed_knots_e3;
+    } else {
+        return false;
+    }
+
+    return true;
+}
+
+// Line buffer and minmea, as gnss_nmea_parse_char() did it
+static void bench_run_line_minmea(const struct bench_corpus *corpus, struct bench_result *result)
+{
+    static char buff[BENCH_LINE_BUFFER_SIZE];
+    size_t buff_idx = 0;
+    bool start_found = false;
+
+    for (size_t i = 0; i < corpus->length; i++) {
+        char ch = corpus->data[i];
+        if (start_found == false) {
+            if (ch == '$') {
+                buff[buff_idx++] = ch;
+                start_found = true;
+            }
+        } else if (ch == '\r' || ch == '\n') {
+            buff[buff_idx] = '\0';
+            result->parsed += bench_minmea_parse(buff, &result->sink);
+            buff_idx = 0;
+            start_found = false;
+        } else {
+            buff[buff_idx++] = ch;
+        }
+
+        if (buff_idx >= sizeof(buff)) {
+            buff_idx = 0;
+            start_found = false;
+        }
+    }
+}
+
+// Only the tokenizer, what framing and checksums cost on their own
+static void bench_run_tokenizer(const struct bench_corpus *corpus, struct bench_result *result)
+{
+    struct gnss_nmea_tokenizer tokenizer;
+    gnss_nmea_tokenizer_init(&tokenizer);
+
+    for (size_t i = 0; i < corpus->length; i++) {
+        if (gnss_nmea_tokenizer_feed(&tokenizer, corpus->data[i])) {
+            result->parsed++;
+            result->sink += tokenizer.sentence.field_count;
+        }
+    }
+}
+
+static void bench_run_tokenizer_minmea(const struct bench_corpus *corpus, struct bench_result *result)
+{
+    struct gnss_nmea_tokenizer tokenizer;
+    gnss_nmea_tokenizer_init(&tokenizer);
+
+    for (size_t i = 0; i < corpus->length; i++) {
+        if (gnss_nmea_tokenizer_feed(&tokenizer, corpus->data[i]))
+            result->parsed += bench_minmea_parse(tokenizer.sentence.data, &result->sink);
+    }
+}
+
+// What the GNSS task runs
+static void bench_run_tokenizer_fixed(const struct bench_corpus *corpus, struct bench_result *result)
+{
+    struct gnss_nmea_tokenizer tokenizer;
+    gnss_nmea_tokenizer_init(&tokenizer);
+
+    for (size_t i = 0; i < corpus->length; i++) {
+        if (gnss_nmea_tokenizer_feed(&tokenizer, corpus->data[i]))
+            result->parsed += bench_fixed_parse(&tokenizer.sentence, &result->sink);
+    }
+}
+
+static const struct bench_parser bench_parsers[] = {
+    {"line+minmea",      bench_run_line_minmea},
+    {"tokenizer",        bench_run_tokenizer},
+    {"tokenizer+minmea", bench_run_tokenizer_minmea},
+    {"tokenizer+fixed",  bench_run_tokenizer_fixed},
+};
+
+struct bench_parser_run {
+    const struct bench_parser *parser;
+    const struct bench_corpus *corpus;
+    struct bench_result result;
+    size_t parsed;
+};
+
+static void bench_parser_run(void *context)
+{
+    struct bench_parser_run *run = context;
+    run->result = (struct bench_result){0};
+    run->parser->run(run->corpus, &run->result);
+    run->parsed += run->result.parsed;
+    bench_sink = run->result.sink;
+}
+
+static void bench_corpus(const struct bench_corpus *corpus)
+{
+    printf("%s: %zu bytes\n", corpus->name, corpus->length);
+
+    for (size_t i = 0; i < sizeof(bench_parsers) / sizeof(bench_parsers[0]); i++) {
+        struct bench_parser_run run = {.parser = &bench_parsers[i], .corpus = corpus};
+        uint32_t runs;
+        const double elapsed = bench_repeat(bench_parser_run, &run, BENCH_MIN_RUNS, &runs);
+
+        printf("  %-18s %8.1f MB/s %12.0f sentences/s %9zu parsed\n", run.parser->name,
+               (double)corpus->length * runs / elapsed / 1e6, (double)run.parsed / elapsed, run.result.parsed);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1 && argv[1][0] == '-') {
+        fprintf(stderr, "usage: %s [recorded.nmea ...]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    struct bench_corpus synthetic = {.name = "synthetic"};
+    bench_generate_synthetic(&synthetic);
+    bench_corpus(&synthetic);
+
+    struct bench_corpus noisy = {.name = "synthetic noisy"};
+    bench_generate_noisy(&noisy, &synthetic);
+    bench_corpus(&noisy);
+
+    for (int i = 1; i < argc; i++) {
+        struct bench_corpus recorded = {.name = argv[i]};
+        bench_load_recorded(&recorded, argv[i]);
+        bench_corpus(&recorded);
+        free(recorded.data);
+    }
+
+    free(noisy.data);
+    free(synthetic.data);
+    return EXIT_SUCCESS;
+}
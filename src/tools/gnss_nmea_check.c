@@ -0,0 +1,294 @@
+#include <assert.h>
+#include <inttypes.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gnss/gnss_nmea.h"
+#include "gnss/minmea/minmea.h"
+
+#include "bench.h"
+
+// Generated sentences of each type
+#define CHECK_SYNTHETIC_SENTENCES 20000
+// Longest fraction of the generated minutes, speeds and courses. minmea truncates past 10^-9,
+// anything longer checks that both drop the same digits.
+#define CHECK_MAX_FRACTION_DIGITS 14
+
+struct check_counts {
+    size_t sentences;
+    size_t compared;
+    size_t mismatches;
+    // Sentences only one of the parsers accepts, the fixed-point one rejects signs, spaces and degrees > 180
+    size_t only_minmea;
+    size_t only_fixed;
+};
+
+// Checksum-valid sentences that broke the decimal parser before
+static const char *const check_edge_sentences[] = {
+    "GPRMC,,A,0000.000000000000000000000000000000,N,,,,,,,",
+    "GPRMC,,A,4807.0000000000038,N,01131.000000000000000000000001,E,,,,,,",
+    "GPRMC,,A,8959.9999999999,S,17959.99999999,W,0.00000000001,359.999999999,,,",
+    "GPGGA,,0000.000000000000000,N,00000.00000000000,E,1,08,0.90000000000,,,,,,",
+};
+
+// Checksum-valid sentences with a speed, course or HDOP that doesn't fit 32 bits in the fixed-point
+// units, the fixed-point parsers have to reject them instead of wrapping around
+static const char *const check_overflow_sentences[] = {
+    "GPRMC,,A,,,,,4294968,,,,",
+    "GPRMC,,A,,,,,4294967.3,,,,",
+    "GPRMC,,A,,,,,,42949673,,,",
+    "GPGGA,,,,,,1,08,42949673,,,,,,",
+};
+
+static void check_append_fraction(char *buff, size_t size, uint32_t max_digits)
+{
+    const uint32_t digits = bench_random() % (max_digits + 1);
+    if (digits == 0)
+        return;
+
+    size_t length = strlen(buff);
+    assert(length + digits + 2 <= size);
+    buff[length++] = '.';
+    // Mostly zeros now and then, like a receiver padding its output
+    const bool zeros = bench_random() % 4 == 0;
+    for (uint32_t i = 0; i < digits; i++)
+        buff[length++] = zeros && i + 1 < digits ? '0' : (char)('0' + bench_random() % 10);
+    buff[length] = '\0';
+}
+
+static void check_format_coord(char *buff, size_t size, bool lat)
+{
+    if (bench_random() % 20 == 0) {
+        snprintf(buff, size, ",");
+        return;
+    }
+
+    // dddmm, the fraction and its '.'
+    char number[5 + 1 + CHECK_MAX_FRACTION_DIGITS + 1];
+    snprintf(number, sizeof(number), lat ? "%02u%02u" : "%03u%02u", bench_random() % (lat ? 90 : 180), bench_random() % 60);
+    check_append_fraction(number, sizeof(number), CHECK_MAX_FRACTION_DIGITS);
+    const int length = snprintf(buff, size, "%s,%c", number, lat ? "NS"[bench_random() % 2] : "EW"[bench_random() % 2]);
+    assert(length > 0 && (size_t)length < size);
+}
+
+static void check_format_decimal(char *buff, size_t size, uint32_t max_integer, uint32_t max_digits)
+{
+    if (bench_random() % 20 == 0) {
+        buff[0] = '\0';
+        return;
+    }
+    snprintf(buff, size, "%u", bench_random() % (max_integer + 1));
+    check_append_fraction(buff, size, max_digits);
+}
+
+static void check_format_time(char *buff, size_t size)
+{
+    if (bench_random() % 20 == 0) {
+        buff[0] = '\0';
+        return;
+    }
+    snprintf(buff, size, "%02u%02u%02u", bench_random() % 24, bench_random() % 60, bench_random() % 60);
+    check_append_fraction(buff, size, 3);
+}
+
+// NMEA body of a random RMC or GGA sentence, NULL if it came out longer than a sentence may be
+static const char *check_generate_sentence(char *body, size_t size, bool rmc)
+{
+    char time[16], lat[32], lon[32], first[24], second[24];
+    check_format_time(time, sizeof(time));
+    check_format_coord(lat, sizeof(lat), true);
+    check_format_coord(lon, sizeof(lon), false);
+
+    if (rmc) {
+        check_format_decimal(first, sizeof(first), 999, CHECK_MAX_FRACTION_DIGITS);
+        check_format_decimal(second, sizeof(second), 359, CHECK_MAX_FRACTION_DIGITS);
+        snprintf(body, size, "GPRMC,%s,%c,%s,%s,%s,%s,%02u%02u%02u,,,A", time, "AV"[bench_random() % 2], lat, lon, first, second,
+                 1 + bench_random() % 28, 1 + bench_random() % 12, bench_random() % 100);
+    } else {
+        check_format_decimal(first, sizeof(first), 50, CHECK_MAX_FRACTION_DIGITS);
+        snprintf(body, size, "GPGGA,%s,%s,%s,%u,%02u,%s,545.4,M,46.9,M,,", time, lat, lon, bench_random() % 9, bench_random() % 24, first);
+    }
+
+    // '$', '*', the checksum and the line ending
+    return strlen(body) + 6 <= GNSS_NMEA_MAX_SENTENCE_LENGTH ? body : NULL;
+}
+
+// What the GNSS task did with minmea's coordinates before the fixed-point decoder, in 64 bits
+static int32_t check_minmea_coord_e6(const struct minmea_float *f)
+{
+    if (f->scale == 0)
+        return 0;
+    const int64_t degrees = f->value / ((int64_t)f->scale * 100);
+    const int64_t minutes = f->value % ((int64_t)f->scale * 100);
+    return (int32_t)(degrees * 1000000 + minutes * 1000000 / (60 * (int64_t)f->scale));
+}
+
+// minmea_float in 1 / unit_scale, truncated like the fixed-point decoder and 0 when empty
+static int64_t check_minmea_fixed(const struct minmea_float *f, int64_t unit_scale)
+{
+    if (f->scale == 0)
+        return 0;
+    return f->scale >= unit_scale ? f->value / (f->scale / unit_scale) : f->value * (unit_scale / f->scale);
+}
+
+static uint32_t check_minmea_time_ms(const struct minmea_time *time)
+{
+    if (time->hours == -1)
+        return GNSS_NMEA_NO_TIME;
+    return (uint32_t)(((time->hours * 60 + time->minutes) * 60 + time->seconds) * 1000 + time->microseconds / 1000);
+}
+
+static bool check_field(const struct gnss_nmea_sentence *sentence, const char *name, int64_t fixed, int64_t minmea)
+{
+    if (fixed == minmea)
+        return true;
+    printf("  mismatch in %s: fixed %" PRId64 ", minmea %" PRId64 ": %s\n", name, fixed, minmea, sentence->data);
+    return false;
+}
+
+static void check_sentence(const struct gnss_nmea_sentence *sentence, struct check_counts *counts)
+{
+    bool equal = true;
+
+    if (gnss_nmea_sentence_is(sentence, "RMC")) {
+        struct gnss_nmea_rmc rmc;
+        struct minmea_sentence_rmc frame;
+        const bool fixed_ok = gnss_nmea_parse_rmc(sentence, &rmc);
+        const bool minmea_ok = minmea_parse_rmc(&frame, sentence->data);
+        counts->sentences++;
+        if (fixed_ok != minmea_ok) {
+            fixed_ok ? counts->only_fixed++ : counts->only_minmea++;
+            return;
+        }
+        if (fixed_ok == false)
+            return;
+
+        equal &= check_field(sentence, "valid", rmc.valid, frame.valid);
+        equal &= check_field(sentence, "time", rmc.time_ms, check_minmea_time_ms(&frame.time));
+        equal &= check_field(sentence, "latitude", rmc.lat_e6, check_minmea_coord_e6(&frame.latitude));
+        equal &= check_field(sentence, "longitude", rmc.lon_e6, check_minmea_coord_e6(&frame.longitude));
+        equal &= check_field(sentence, "speed", rmc.speed_knots_e3, check_minmea_fixed(&frame.speed, 1000));
+        equal &= check_field(sentence, "course", rmc.course_deg_e2, check_minmea_fixed(&frame.course, 100));
+    } else if (gnss_nmea_sentence_is(sentence, "GGA")) {
+        struct gnss_nmea_gga gga;
+        struct minmea_sentence_gga frame;
+        const bool fixed_ok = gnss_nmea_parse_gga(sentence, &gga);
+        const bool minmea_ok = minmea_parse_gga(&frame, sentence->data);
+        counts->sentences++;
+        if (fixed_ok != minmea_ok) {
+            fixed_ok ? counts->only_fixed++ : counts->only_minmea++;
+            return;
+        }
+        if (fixed_ok == false)
+            return;
+
+        equal &= check_field(sentence, "time", gga.time_ms, check_minmea_time_ms(&frame.time));
+        equal &= check_field(sentence, "latitude", gga.lat_e6, check_minmea_coord_e6(&frame.latitude));
+        equal &= check_field(sentence, "longitude", gga.lon_e6, check_minmea_coord_e6(&frame.longitude));
+        equal &= check_field(sentence, "fix quality", gga.fix_quality, frame.fix_quality);
+        equal &= check_field(sentence, "satellites", gga.satellites, frame.satellites_tracked);
+        equal &= check_field(sentence, "HDOP", gga.hdop_e2, check_minmea_fixed(&frame.hdop, 100));
+    } else {
+        return;
+    }
+
+    counts->compared++;
+    counts->mismatches += equal == false;
+}
+
+static void check_feed(struct gnss_nmea_tokenizer *tokenizer, const char *data, size_t length, struct check_counts *counts)
+{
+    for (size_t i = 0; i < length; i++) {
+        if (gnss_nmea_tokenizer_feed(tokenizer, data[i]))
+            check_sentence(&tokenizer->sentence, counts);
+    }
+}
+
+static void check_feed_body(struct gnss_nmea_tokenizer *tokenizer, const char *body, struct check_counts *counts)
+{
+    uint8_t checksum = 0;
+    for (const char *ch = body; *ch; ch++)
+        checksum ^= (uint8_t)*ch;
+
+    char sentence[128];
+    int length = snprintf(sentence, sizeof(sentence), "$%s*%02X\r\n", body, checksum);
+    assert(length > 0 && length <= GNSS_NMEA_MAX_SENTENCE_LENGTH);
+    check_feed(tokenizer, sentence, (size_t)length, counts);
+}
+
+static bool check_report(const char *name, const struct check_counts *counts)
+{
+    printf("%s: %zu RMC/GGA sentences, %zu compared, %zu mismatches, %zu only minmea, %zu only fixed-point\n",
+           name, counts->sentences, counts->compared, counts->mismatches, counts->only_minmea, counts->only_fixed);
+    return counts->mismatches == 0;
+}
+
+static bool check_synthetic(void)
+{
+    struct gnss_nmea_tokenizer tokenizer;
+    gnss_nmea_tokenizer_init(&tokenizer);
+    struct check_counts counts = {0};
+    size_t generated = 0;
+
+    for (size_t i = 0; i < sizeof(check_edge_sentences) / sizeof(check_edge_sentences[0]); i++) {
+        check_feed_body(&tokenizer, check_edge_sentences[i], &counts);
+        generated++;
+    }
+
+    for (size_t i = 0; i < 2 * CHECK_SYNTHETIC_SENTENCES; i++) {
+        char body[256];
+        if (check_generate_sentence(body, sizeof(body), i % 2 == 0) == NULL)
+            continue;
+        check_feed_body(&tokenizer, body, &counts);
+        generated++;
+    }
+
+    // Generated sentences are conformant, both parsers have to take every one of them
+    bool passed = check_report("synthetic", &counts) && counts.compared == generated;
+
+    counts = (struct check_counts){0};
+    for (size_t i = 0; i < sizeof(check_overflow_sentences) / sizeof(check_overflow_sentences[0]); i++)
+        check_feed_body(&tokenizer, check_overflow_sentences[i], &counts);
+    check_report("overflow", &counts);
+    passed &= counts.sentences == sizeof(check_overflow_sentences) / sizeof(check_overflow_sentences[0]);
+    passed &= counts.compared == 0 && counts.only_fixed == 0;
+    return passed;
+}
+
+static bool check_recorded(const char *path)
+{
+    FILE *file = fopen(path, "rb");
+    if (file == NULL) {
+        perror(path);
+        return false;
+    }
+
+    struct gnss_nmea_tokenizer tokenizer;
+    gnss_nmea_tokenizer_init(&tokenizer);
+    struct check_counts counts = {0};
+
+    char buff[4096];
+    size_t length;
+    while ((length = fread(buff, 1, sizeof(buff), file)) > 0)
+        check_feed(&tokenizer, buff, length, &counts);
+    fclose(file);
+
+    return check_report(path, &counts);
+}
+
+int main(int argc, char **argv)
+{
+    if (argc > 1 && argv[1][0] == '-') {
+        fprintf(stderr, "usage: %s [recorded.nmea ...]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    bool passed = check_synthetic();
+    for (int i = 1; i < argc; i++)
+        passed &= check_recorded(argv[i]);
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,161 @@
+#include <assert.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "gnss/gnss_nmea.h"
+#include "gnss/gnss_pmtk.h"
+#include "gnss/minmea/minmea.h"
+
+// Longer inputs only repeat what shorter ones already cover
+#define FUZZ_MAX_INPUT_LENGTH 4096
+
+// A day with a leap second at its end
+#define FUZZ_MAX_TIME_MS  ((24u * 3600u + 1u) * 1000u)
+// (d)ddmm.mmmm caps at 180 degrees and 99.99... minutes, the parsers don't check the range any further
+#define FUZZ_MAX_COORD_E6 (180 * 1000000 + 100 * 1000000 / 60)
+
+static void fuzz_check_sentence(const struct gnss_nmea_sentence *sentence)
+{
+    assert(sentence->length > 0 && sentence->length < sizeof(sentence->data));
+    assert(sentence->data[0] == '$');
+    assert(sentence->data[sentence->length] == '\0');
+    assert(strlen(sentence->data) == sentence->length);
+    assert(sentence->field_count > 0 && sentence->field_count <= GNSS_NMEA_MAX_FIELDS);
+
+    for (size_t i = 0; i < sentence->field_count; i++) {
+        size_t length;
+        const char *field = gnss_nmea_field(sentence, i, &length);
+        assert(field >= sentence->data && field + length <= sentence->data + sentence->length);
+        assert(memchr(field, ',', length) == NULL);
+    }
+
+    struct gnss_nmea_rmc rmc;
+    if (gnss_nmea_parse_rmc(sentence, &rmc)) {
+        assert(rmc.time_ms == GNSS_NMEA_NO_TIME || rmc.time_ms < FUZZ_MAX_TIME_MS);
+        assert(rmc.lat_e6 >= -FUZZ_MAX_COORD_E6 && rmc.lat_e6 <= FUZZ_MAX_COORD_E6);
+        assert(rmc.lon_e6 >= -FUZZ_MAX_COORD_E6 && rmc.lon_e6 <= FUZZ_MAX_COORD_E6);
+    }
+    struct gnss_nmea_gga gga;
+    if (gnss_nmea_parse_gga(sentence, &gga)) {
+        assert(gga.time_ms == GNSS_NMEA_NO_TIME || gga.time_ms < FUZZ_MAX_TIME_MS);
+        assert(gga.lat_e6 >= -FUZZ_MAX_COORD_E6 && gga.lat_e6 <= FUZZ_MAX_COORD_E6);
+        assert(gga.lon_e6 >= -FUZZ_MAX_COORD_E6 && gga.lon_e6 <= FUZZ_MAX_COORD_E6);
+    }
+    struct gnss_nmea_gsa gsa;
+    (void)gnss_nmea_parse_gsa(sentence, &gsa);
+    struct gnss_nmea_vtg vtg;
+    (void)gnss_nmea_parse_vtg(sentence, &vtg);
+
+    uint16_t command;
+    enum gnss_pmtk_ack ack;
+    if (gnss_pmtk_parse_ack(sentence, &command, &ack))
+        assert(ack <= GNSS_PMTK_ACK_SUCCEEDED);
+}
+
+// Every minmea entry point the firmware could reach, on a NUL terminated line
+static void fuzz_minmea(const char *line)
+{
+    char talker[3];
+    (void)minmea_check(line, false);
+    (void)minmea_talker_id(talker, line);
+
+    switch (minmea_sentence_id(line, false)) {
+        case MINMEA_SENTENCE_GBS: {
+            struct minmea_sentence_gbs frame;
+            (void)minmea_parse_gbs(&frame, line);
+        } break;
+        case MINMEA_SENTENCE_GGA: {
+            struct minmea_sentence_gga frame;
+            (void)minmea_parse_gga(&frame, line);
+        } break;
+        case MINMEA_SENTENCE_GLL: {
+            struct minmea_sentence_gll frame;
+            (void)minmea_parse_gll(&frame, line);
+        } break;
+        case MINMEA_SENTENCE_GSA: {
+            struct minmea_sentence_gsa frame;
+            (void)minmea_parse_gsa(&frame, line);
+        } break;
+        case MINMEA_SENTENCE_GST: {
+            struct minmea_sentence_gst frame;
+            (void)minmea_parse_gst(&frame, line);
+        } break;
+        case MINMEA_SENTENCE_GSV: {
+            struct minmea_sentence_gsv frame;
+            (void)minmea_parse_gsv(&frame, line);
+        } break;
+        case MINMEA_SENTENCE_RMC: {
+            struct minmea_sentence_rmc frame;
+            if (minmea_parse_rmc(&frame, line)) {
+                (void)minmea_tocoord(&frame.latitude);
+                (void)minmea_tocoord(&frame.longitude);
+            }
+        } break;
+        case MINMEA_SENTENCE_VTG: {
+            struct minmea_sentence_vtg frame;
+            (void)minmea_parse_vtg(&frame, line);
+        } break;
+        case MINMEA_SENTENCE_ZDA: {
+            struct minmea_sentence_zda frame;
+            (void)minmea_parse_zda(&frame, line);
+        } break;
+        default: {
+        } break;
+    }
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    if (size > FUZZ_MAX_INPUT_LENGTH)
+        return 0;
+
+    // The input as it would come off the UART
+    struct gnss_nmea_tokenizer tokenizer;
+    gnss_nmea_tokenizer_init(&tokenizer);
+    for (size_t i = 0; i < size; i++) {
+        if (gnss_nmea_tokenizer_feed(&tokenizer, (char)data[i])) {
+            fuzz_check_sentence(&tokenizer.sentence);
+            fuzz_minmea(tokenizer.sentence.data);
+        }
+    }
+
+    // And every line of it straight into minmea, checksum or not
+    static char line[FUZZ_MAX_INPUT_LENGTH + 1];
+    size_t start = 0;
+    for (size_t i = 0; i <= size; i++) {
+        if (i == size || data[i] == '\n') {
+            memcpy(line, &data[start], i - start);
+            line[i - start] = '\0';
+            fuzz_minmea(line);
+            start = i + 1;
+        }
+    }
+
+    return 0;
+}
+
+#ifdef GNSS_NMEA_FUZZ_REPLAY
+// Without libFuzzer run the inputs given on the command line, e.g. a crash or a corpus found elsewhere
+int main(int argc, char **argv)
+{
+    static uint8_t data[FUZZ_MAX_INPUT_LENGTH];
+
+    for (int i = 1; i < argc; i++) {
+        FILE *file = fopen(argv[i], "rb");
+        if (file == NULL) {
+            perror(argv[i]);
+            return EXIT_FAILURE;
+        }
+        size_t size = fread(data, 1, sizeof(data), file);
+        fclose(file);
+
+        LLVMFuzzerTestOneInput(data, size);
+    }
+
+    printf("%d inputs ok\n", argc - 1);
+    return EXIT_SUCCESS;
+}
+#endif
@@ -0,0 +1,14 @@
+#pragma once
+
+// Just enough of the FreeRTOS API for the host tools to build src/ring, without the kernel.
+// There are no tasks: consumers never block and nobody gets notified.
+
+#include <stdint.h>
+
+typedef uint32_t TickType_t;
+typedef long BaseType_t;
+typedef void *TaskHandle_t;
+
+#define pdFALSE       0
+#define pdTRUE        1
+#define portMAX_DELAY UINT32_MAX
@@ -0,0 +1,21 @@
+#pragma once
+
+#include "FreeRTOS.h"
+
+static inline BaseType_t xTaskNotifyGive(TaskHandle_t task)
+{
+    (void)task;
+    return pdTRUE;
+}
+
+static inline uint32_t ulTaskNotifyTake(BaseType_t clear_on_exit, TickType_t ticks_to_wait)
+{
+    (void)clear_on_exit;
+    (void)ticks_to_wait;
+    return 0;
+}
+
+static inline TickType_t xTaskGetTickCount(void)
+{
+    return 0;
+}
@@ -0,0 +1,176 @@
+#include <pthread.h>
+#include <sched.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "ring/ring.h"
+
+#include "bench.h"
+
+// The GNSS to main handoff: 10 Hz fixes into a ring of 4, the main task drains it to the newest fix
+#define BENCH_FIX_INTERVAL_MS 100
+#define BENCH_GNSS_CAPACITY   4
+#define BENCH_MAX_STALL_EPOCHS 20
+
+// Items of the threaded run, about a struct gnss_data each. Every word holds the sequence number,
+// a copy torn by the producer has words of two items.
+#define BENCH_ITEM_WORDS    12
+#define BENCH_THREAD_ITEMS  2000000
+#define BENCH_CHECK_ITEMS   200000
+#define BENCH_THREAD_CAPACITY 4
+
+struct bench_item {
+    uint32_t words[BENCH_ITEM_WORDS];
+};
+
+struct bench_thread_run {
+    struct ring ring;
+    struct bench_item buffer[BENCH_THREAD_CAPACITY];
+    uint32_t items;
+    volatile bool producer_done;
+    uint32_t popped;
+    uint32_t torn;
+    uint32_t out_of_order;
+};
+
+static const char *bench_mode_name(enum ring_mode mode)
+{
+    return mode == RING_DROP_NEWEST ? "drop newest" : "overwrite oldest";
+}
+
+// The main task stops taking fixes for stall epochs, e.g. behind a flash write or a long printf, and
+// then drains the ring. Returns the age of the fix it continues with and counts the lost fixes.
+static uint32_t bench_stall(enum ring_mode mode, uint32_t stall, uint32_t *lost)
+{
+    struct bench_item buffer[BENCH_GNSS_CAPACITY];
+    struct ring ring;
+    ring_init(&ring, buffer, sizeof(buffer[0]), BENCH_GNSS_CAPACITY, mode);
+
+    uint32_t epoch = 0;
+    struct bench_item item;
+    // Steady state, every fix is taken right away
+    for (; epoch < 10; epoch++) {
+        item.words[0] = epoch;
+        ring_push(&ring, &item);
+        while (ring_pop(&ring, &item)) {
+        }
+    }
+
+    for (uint32_t i = 0; i <= stall; i++, epoch++) {
+        item.words[0] = epoch;
+        ring_push(&ring, &item);
+    }
+
+    uint32_t newest = UINT32_MAX;
+    uint32_t taken = 0;
+    while (ring_pop(&ring, &item)) {
+        newest = item.words[0];
+        taken++;
+    }
+
+    *lost = stall + 1 - taken;
+    return epoch - 1 - newest;
+}
+
+static void bench_stalls(void)
+{
+    printf("Age of the fix the main task continues with after a stall, %u ms fixes into a ring of %u\n",
+           BENCH_FIX_INTERVAL_MS, BENCH_GNSS_CAPACITY);
+    printf("  %8s  %22s  %22s\n", "stall", bench_mode_name(RING_DROP_NEWEST), bench_mode_name(RING_OVERWRITE_OLDEST));
+    for (uint32_t stall = 1; stall <= BENCH_MAX_STALL_EPOCHS; stall = stall < 4 ? stall + 1 : stall * 2) {
+        uint32_t drop_lost, overwrite_lost;
+        const uint32_t drop_age = bench_stall(RING_DROP_NEWEST, stall, &drop_lost);
+        const uint32_t overwrite_age = bench_stall(RING_OVERWRITE_OLDEST, stall, &overwrite_lost);
+        printf("  %5u ms  %8u ms, %3u lost  %8u ms, %3u lost\n", stall * BENCH_FIX_INTERVAL_MS,
+               drop_age * BENCH_FIX_INTERVAL_MS, drop_lost, overwrite_age * BENCH_FIX_INTERVAL_MS, overwrite_lost);
+    }
+}
+
+static void *bench_producer(void *arg)
+{
+    struct bench_thread_run *run = arg;
+    struct bench_item item;
+
+    for (uint32_t sequence = 1; sequence <= run->items; sequence++) {
+        for (size_t i = 0; i < BENCH_ITEM_WORDS; i++)
+            item.words[i] = sequence;
+        // A full drop newest ring is retried, like the audio requests are
+        while (ring_push(&run->ring, &item) == false)
+            sched_yield();
+    }
+
+    __atomic_store_n(&run->producer_done, true, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+static void *bench_consumer(void *arg)
+{
+    struct bench_thread_run *run = arg;
+    struct bench_item item;
+    uint32_t last = 0;
+
+    while (true) {
+        const bool done = __atomic_load_n(&run->producer_done, __ATOMIC_ACQUIRE);
+        if (ring_pop(&run->ring, &item) == false) {
+            if (done)
+                break;
+            sched_yield();
+            continue;
+        }
+
+        run->popped++;
+        for (size_t i = 1; i < BENCH_ITEM_WORDS; i++) {
+            if (item.words[i] != item.words[0]) {
+                run->torn++;
+                break;
+            }
+        }
+        if (item.words[0] <= last)
+            run->out_of_order++;
+        last = item.words[0];
+    }
+    return NULL;
+}
+
+// Producer and consumer on two threads as fast as they go, every item taken is checked
+static bool bench_threads(enum ring_mode mode, uint32_t items)
+{
+    static struct bench_thread_run run;
+    memset(&run, 0, sizeof(run));
+    ring_init(&run.ring, run.buffer, sizeof(run.buffer[0]), BENCH_THREAD_CAPACITY, mode);
+    run.items = items;
+
+    pthread_t producer, consumer;
+    const double start = bench_now();
+    pthread_create(&consumer, NULL, bench_consumer, &run);
+    pthread_create(&producer, NULL, bench_producer, &run);
+    pthread_join(producer, NULL);
+    pthread_join(consumer, NULL);
+    const double elapsed = bench_now() - start;
+
+    printf("  %-16s %9u pushed, %9u taken, %9u overwritten, %u torn, %u out of order, %6.1f ns/push\n",
+           bench_mode_name(mode), items, run.popped, run.ring.overwritten, run.torn, run.out_of_order, elapsed * 1e9 / items);
+    return run.torn == 0 && run.out_of_order == 0 && run.popped + run.ring.overwritten == items;
+}
+
+int main(int argc, char **argv)
+{
+    const bool check_only = argc > 1 && strcmp(argv[1], "--check") == 0;
+    if (argc > 1 + check_only) {
+        fprintf(stderr, "usage: %s [--check]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    if (check_only == false)
+        bench_stalls();
+
+    const uint32_t items = check_only ? BENCH_CHECK_ITEMS : BENCH_THREAD_ITEMS;
+    printf("Producer and consumer threads, %u items of %zu bytes into a ring of %u\n", items, sizeof(struct bench_item), BENCH_THREAD_CAPACITY);
+    bool passed = bench_threads(RING_DROP_NEWEST, items);
+    passed &= bench_threads(RING_OVERWRITE_OLDEST, items);
+
+    return passed ? EXIT_SUCCESS : EXIT_FAILURE;
+}
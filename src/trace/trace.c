@@ -0,0 +1,243 @@
+#include <assert.h>
+#include <inttypes.h>
+#include <stdio.h>
+
+#include <pico/stdlib.h>
+#include <hardware/sync.h>
+
+#include "trace/trace.h"
+
+#include <FreeRTOS.h>
+#include <task.h>
+#include <semphr.h>
+
+// Events per core, must be a power of two. A fix records at most one event per stage,
+// so this holds several seconds of 10 Hz fixes.
+#define TRACE_RING_CAPACITY    128
+#define TRACE_DRAIN_INTERVAL_MS 200
+// Fixes whose stages are still being collected, a warning plays within a few fixes of the decision
+#define TRACE_FIXES_LENGTH     16
+// Power of two buckets of microseconds, the last one holds everything from 2^22 us (about 4 s) up
+#define TRACE_HISTOGRAM_BUCKETS 23
+// Sent over USB to print the histograms
+#define TRACE_REPORT_CHAR      't'
+
+struct trace_event {
+    uint32_t time_us;
+    uint32_t id;
+    enum trace_stage stage;
+};
+
+// Single producer ring: every core writes only its own one with its interrupts disabled,
+// the trace task reads all of them
+struct trace_ring {
+    struct trace_event events[TRACE_RING_CAPACITY];
+    uint32_t head;
+    uint32_t dropped;
+    uint32_t tail;
+};
+
+// Stage times of one fix, the first event of a stage wins
+struct trace_fix {
+    uint32_t id;
+    uint32_t times_us[TRACE_STAGES_LENGTH];
+    uint32_t seen;
+    uint32_t counted;
+};
+
+struct trace_histogram {
+    uint32_t buckets[TRACE_HISTOGRAM_BUCKETS];
+    uint32_t count;
+    uint32_t min_us;
+    uint32_t max_us;
+    uint64_t sum_us;
+};
+
+static const char *const trace_stage_names[TRACE_STAGES_LENGTH] = {
+    [TRACE_STAGE_UART_RX]         = "UART IRQ",
+    [TRACE_STAGE_SENTENCE]        = "sentence complete",
+    [TRACE_STAGE_RING_POST]       = "fix posted",
+    [TRACE_STAGE_CAMERA_DECISION] = "camera decision",
+    [TRACE_STAGE_AUDIO_DEQUEUE]   = "audio dequeue",
+    [TRACE_STAGE_AMP_UNMUTE]      = "amp unmute",
+    [TRACE_STAGE_DMA_START]       = "DMA start",
+};
+
+static struct trace_ring trace_rings[configNUMBER_OF_CORES];
+
+// Owned by whoever holds the mutex, the trace task or a trace_report() caller
+static SemaphoreHandle_t trace_mutex;
+static struct trace_fix trace_fixes[TRACE_FIXES_LENGTH];
+static uint32_t trace_fixes_next;
+static struct trace_histogram trace_histograms[TRACE_STAGES_LENGTH];
+
+uint32_t trace_time_us(void)
+{
+    return time_us_32();
+}
+
+void trace_stage(enum trace_stage stage, uint32_t id)
+{
+    trace_stage_at(stage, id, time_us_32());
+}
+
+void trace_stage_at(enum trace_stage stage, uint32_t id, uint32_t time_us)
+{
+    assert(stage < TRACE_STAGES_LENGTH);
+    if (id == TRACE_NO_ID) {
+        return;
+    }
+
+    // Nothing else on this core can touch its ring now, and the task can't move to the other core
+    const uint32_t interrupts = save_and_disable_interrupts();
+    const uint core = get_core_num();
+    assert(core < configNUMBER_OF_CORES);
+    struct trace_ring *ring = &trace_rings[core];
+
+    const uint32_t head = ring->head;
+    if (head - __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE) == TRACE_RING_CAPACITY) {
+        ring->dropped++;
+    } else {
+        ring->events[head & (TRACE_RING_CAPACITY - 1)] = (struct trace_event){
+            .time_us = time_us,
+            .id = id,
+            .stage = stage,
+        };
+        // Publish the event before the new head
+        __atomic_store_n(&ring->head, head + 1, __ATOMIC_RELEASE);
+    }
+
+    restore_interrupts(interrupts);
+}
+
+static void trace_histogram_add(struct trace_histogram *histogram, uint32_t latency_us)
+{
+    uint32_t bucket = 0;
+    while (bucket < TRACE_HISTOGRAM_BUCKETS - 1 && latency_us >= (2u << bucket)) {
+        bucket++;
+    }
+    histogram->buckets[bucket]++;
+
+    if (histogram->count == 0 || latency_us < histogram->min_us) {
+        histogram->min_us = latency_us;
+    }
+    if (latency_us > histogram->max_us) {
+        histogram->max_us = latency_us;
+    }
+    histogram->sum_us += latency_us;
+    histogram->count++;
+}
+
+static struct trace_fix *trace_find_fix(uint32_t id)
+{
+    for (size_t i=0; i<TRACE_FIXES_LENGTH; i++) {
+        if (trace_fixes[i].id == id) {
+            return &trace_fixes[i];
+        }
+    }
+
+    // Take the slot of the oldest fix, its later stages won't show up anymore
+    struct trace_fix *fix = &trace_fixes[trace_fixes_next++ % TRACE_FIXES_LENGTH];
+    *fix = (struct trace_fix){ .id = id };
+    return fix;
+}
+
+// The rings are drained one after the other, so a fix may show its later stages before its UART IRQ
+static void trace_add_event(const struct trace_event *event)
+{
+    struct trace_fix *fix = trace_find_fix(event->id);
+    const uint32_t stage_bit = 1u << event->stage;
+    if (fix->seen & stage_bit) {
+        return;
+    }
+    fix->times_us[event->stage] = event->time_us;
+    fix->seen |= stage_bit;
+
+    const uint32_t origin_bit = 1u << TRACE_STAGE_UART_RX;
+    if ((fix->seen & origin_bit) == 0) {
+        return;
+    }
+    for (uint32_t stage=TRACE_STAGE_UART_RX + 1; stage<TRACE_STAGES_LENGTH; stage++) {
+        if ((fix->seen & ~fix->counted) & (1u << stage)) {
+            trace_histogram_add(&trace_histograms[stage], fix->times_us[stage] - fix->times_us[TRACE_STAGE_UART_RX]);
+            fix->counted |= 1u << stage;
+        }
+    }
+}
+
+static void trace_drain(void)
+{
+    for (size_t core=0; core<configNUMBER_OF_CORES; core++) {
+        struct trace_ring *ring = &trace_rings[core];
+        const uint32_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+        uint32_t tail = ring->tail;
+
+        while (tail != head) {
+            const struct trace_event event = ring->events[tail & (TRACE_RING_CAPACITY - 1)];
+            // Release the slot only after the event was copied out
+            __atomic_store_n(&ring->tail, ++tail, __ATOMIC_RELEASE);
+            trace_add_event(&event);
+        }
+    }
+}
+
+static void trace_print(void)
+{
+    for (size_t core=0; core<configNUMBER_OF_CORES; core++) {
+        printf("Trace: core %zu dropped=%" PRIu32 "\n", core, trace_rings[core].dropped);
+    }
+
+    for (uint32_t stage=TRACE_STAGE_UART_RX + 1; stage<TRACE_STAGES_LENGTH; stage++) {
+        const struct trace_histogram *histogram = &trace_histograms[stage];
+        printf("Trace: %s -> %s: n=%" PRIu32, trace_stage_names[TRACE_STAGE_UART_RX], trace_stage_names[stage], histogram->count);
+        if (histogram->count == 0) {
+            printf("\n");
+            continue;
+        }
+
+        printf(", min=%" PRIu32 " us, max=%" PRIu32 " us, mean=%" PRIu32 " us\n",
+               histogram->min_us, histogram->max_us, (uint32_t)(histogram->sum_us / histogram->count));
+        for (uint32_t bucket=0; bucket<TRACE_HISTOGRAM_BUCKETS; bucket++) {
+            if (histogram->buckets[bucket] == 0) {
+                continue;
+            }
+            if (bucket == TRACE_HISTOGRAM_BUCKETS - 1) {
+                printf("Trace:   >= %" PRIu32 " us: %" PRIu32 "\n", 1u << bucket, histogram->buckets[bucket]);
+            } else {
+                printf("Trace:   < %" PRIu32 " us: %" PRIu32 "\n", 2u << bucket, histogram->buckets[bucket]);
+            }
+        }
+    }
+}
+
+void trace_report(void)
+{
+    // Before the trace task started there is nothing to report
+    if (trace_mutex == NULL) {
+        return;
+    }
+
+    xSemaphoreTake(trace_mutex, portMAX_DELAY);
+    trace_drain();
+    trace_print();
+    xSemaphoreGive(trace_mutex);
+}
+
+void trace_task(__unused void *params)
+{
+    trace_mutex = xSemaphoreCreateMutex();
+    assert(trace_mutex);
+
+    while (true) {
+        sleep_ms(TRACE_DRAIN_INTERVAL_MS);
+
+        xSemaphoreTake(trace_mutex, portMAX_DELAY);
+        trace_drain();
+        xSemaphoreGive(trace_mutex);
+
+        // Any other character is dropped
+        if (getchar_timeout_us(0) == TRACE_REPORT_CHAR) {
+            trace_report();
+        }
+    }
+}
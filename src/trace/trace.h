@@ -0,0 +1,66 @@
+#pragma once
+
+#include <stdint.h>
+
+// Timing hooks around the camera decision. Only the host build implements them,
+// on the device they compile to nothing.
+#ifdef CATCHCAM_HOST
+
+// The main task got a new fix from the GNSS task
+void trace_fix_received(void);
+// The main task finished with the last fix and waits for the next one
+void trace_fix_done(void);
+// A camera warning was handed to the audio or LED tasks
+void trace_warning_enqueued(void);
+
+#else
+
+static inline void trace_fix_received(void) {}
+static inline void trace_fix_done(void) {}
+static inline void trace_warning_enqueued(void) {}
+
+#endif
+
+// Stages a fix passes from the UART to the speaker, every stage is timed from the first one
+enum trace_stage {
+    // UART IRQ that received the last sentence of the epoch
+    TRACE_STAGE_UART_RX,
+    // The tokenizer completed that sentence
+    TRACE_STAGE_SENTENCE,
+    // The merged fix was pushed to the main task
+    TRACE_STAGE_RING_POST,
+    // The main task ran the camera checks on it
+    TRACE_STAGE_CAMERA_DECISION,
+    // The audio task took a warning raised by it
+    TRACE_STAGE_AUDIO_DEQUEUE,
+    // The amplifier was unmuted for the warning, not if it already was
+    TRACE_STAGE_AMP_UNMUTE,
+    // The first DMA transfer of the warning started
+    TRACE_STAGE_DMA_START,
+    TRACE_STAGES_LENGTH
+};
+
+// Events of this ID aren't recorded, e.g. audio samples no fix asked for
+#define TRACE_NO_ID 0u
+
+// Latency probes, built with CATCHCAM_TRACE (debug builds) they record into a lock-free ring per core
+// which a low priority task folds into histograms, sending 't' over USB prints them. In release builds
+// they compile to nothing.
+#ifdef CATCHCAM_TRACE
+
+uint32_t trace_time_us(void);
+// Stage of the fix with this ID reached now or at time_us, callable from interrupts on both cores
+void trace_stage(enum trace_stage stage, uint32_t id);
+void trace_stage_at(enum trace_stage stage, uint32_t id, uint32_t time_us);
+// Fold the recorded events into the histograms and print them
+void trace_report(void);
+void trace_task(void *params);
+
+#else
+
+static inline uint32_t trace_time_us(void) { return 0; }
+static inline void trace_stage(enum trace_stage stage, uint32_t id) { (void)stage; (void)id; }
+static inline void trace_stage_at(enum trace_stage stage, uint32_t id, uint32_t time_us) { (void)stage; (void)id; (void)time_us; }
+static inline void trace_report(void) {}
+
+#endif